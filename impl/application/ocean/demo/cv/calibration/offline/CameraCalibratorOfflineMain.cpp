@@ -240,7 +240,7 @@ using namespace Ocean::CV::Calibration;
 		}
 
 		bool needAdditionalIteration = false;
-		if (!cameraCalibrator.finalize(needAdditionalIteration))
+		if (!cameraCalibrator.finalize(needAdditionalIteration, WorkerPool::get().scopedWorker()()))
 		{
 			Log::error() << "Failed to finalize the camera calibration.";
 			break;
@@ -0,0 +1,288 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "application/ocean/demo/tracking/slam/benchmark/BenchmarkMain.h"
+#include "application/ocean/demo/tracking/slam/benchmark/TrackerBenchmark.h"
+
+#include "ocean/base/Build.h"
+#include "ocean/base/CommandArguments.h"
+#include "ocean/base/DateTime.h"
+#include "ocean/base/Messenger.h"
+#include "ocean/base/RandomI.h"
+#include "ocean/base/String.h"
+
+#include "ocean/devices/serialization/Serialization.h"
+
+#include "ocean/io/Directory.h"
+
+#include "ocean/test/Benchmark.h"
+
+#if defined(OCEAN_PLATFORM_BUILD_APPLE_MACOS)
+	#include "ocean/media/avfoundation/AVFoundation.h"
+	#include "ocean/media/imageio/ImageIO.h"
+#endif
+
+#if defined(OCEAN_PLATFORM_BUILD_WINDOWS)
+	#include "ocean/media/wic/WIC.h"
+	#include "ocean/media/mediafoundation/MediaFoundation.h"
+#endif
+
+#include <cstdlib>
+#include <new>
+
+using namespace Ocean;
+using namespace Ocean::Test::TestTracking::TestSLAM;
+
+// the global new operators are replaced to count the memory allocations of the trackers, the array variants of the new and delete operators forward to these operators
+
+void* operator new(std::size_t size)
+{
+	TrackerBenchmark::allocationCounter_.fetch_add(1u, std::memory_order_relaxed);
+
+	void* const pointer = std::malloc(size != 0 ? size : 1);
+
+	if (pointer == nullptr)
+	{
+		throw std::bad_alloc();
+	}
+
+	return pointer;
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment)
+{
+	TrackerBenchmark::allocationCounter_.fetch_add(1u, std::memory_order_relaxed);
+
+	const std::size_t alignmentValue = std::size_t(alignment);
+	ocean_assert(alignmentValue != 0 && (alignmentValue & (alignmentValue - 1)) == 0);
+
+#if defined(_WINDOWS)
+	void* const pointer = _aligned_malloc(size != 0 ? size : 1, alignmentValue);
+#else
+	// aligned_alloc() needs a size which is a multiple of the alignment
+	const std::size_t alignedSize = ((size != 0 ? size : 1) + alignmentValue - 1) & ~(alignmentValue - 1);
+
+	void* const pointer = std::aligned_alloc(alignmentValue, alignedSize);
+#endif
+
+	if (pointer == nullptr)
+	{
+		throw std::bad_alloc();
+	}
+
+	return pointer;
+}
+
+void operator delete(void* pointer) noexcept
+{
+	std::free(pointer);
+}
+
+void operator delete(void* pointer, std::size_t /*size*/) noexcept
+{
+	std::free(pointer);
+}
+
+void operator delete(void* pointer, std::align_val_t /*alignment*/) noexcept
+{
+#if defined(_WINDOWS)
+	_aligned_free(pointer);
+#else
+	std::free(pointer);
+#endif
+}
+
+void operator delete(void* pointer, std::size_t /*size*/, std::align_val_t alignment) noexcept
+{
+	operator delete(pointer, alignment);
+}
+
+#if defined(_WINDOWS)
+	// main function on Windows platforms
+	int wmain(int argc, wchar_t* argv[])
+#elif defined(__APPLE__) || defined(__linux__)
+	// main function on OSX platforms
+	int main(int argc, char* argv[])
+#else
+	#error Missing implementation.
+#endif
+{
+#ifdef OCEAN_COMPILER_MSC
+	// prevent the debugger to abort the application after an assert has been caught
+	_set_error_mode(_OUT_TO_MSGBOX);
+#endif
+
+#ifdef OCEAN_DEBUG
+	#warning Benchmarks should be executed with a release build.
+#endif
+
+	const ScopedPlugin scopedPlugin;
+
+	Messenger::get().setOutputType(Messenger::OUTPUT_STANDARD);
+
+	RandomI::initialize();
+
+	CommandArguments commandArguments;
+	commandArguments.registerNamelessParameters("Optional the first command argument is interpreted as input directory");
+	commandArguments.registerParameter("input", "i", "The directory containing the .osn files to replay");
+	commandArguments.registerParameter("output", "o", "The optional output file for the latency results, \".json\" for JSON, CSV otherwise, e.g., results.csv");
+	commandArguments.registerParameter("baseline", "b", "The optional CSV file with baseline latency results, e.g., baseline.csv");
+	commandArguments.registerParameter("tolerance", "t", "The relative tolerance before a latency counts as regression, e.g., 0.1", Value(0.1));
+	commandArguments.registerParameter("map", "m", "The optional feature map (.ocean_map) to benchmark the relocalizer, e.g., map.ocean_map");
+	commandArguments.registerParameter("pattern", "p", "The optional image of a planar pattern to benchmark the pattern tracker, e.g., pattern.png");
+	commandArguments.registerParameter("patternWidth", "pw", "The width of the pattern in meter, e.g., 0.2", Value(0.2));
+	commandArguments.registerParameter("help", "h", "Showing this help");
+
+	if (!commandArguments.parse(argv, argc))
+	{
+		Log::warning() << "Failure when parsing the command arguments";
+	}
+
+	if (commandArguments.hasValue("help"))
+	{
+		Log::info() << "SLAM Benchmark Tool";
+		Log::info() << " ";
+		Log::info() << "This tool replays .osn recordings as fast as possible through the SLAM tracker (and optionally the relocalizer and the pattern tracker)";
+		Log::info() << "and reports latencies, throughput, allocations, and accuracy.";
+		Log::info() << " ";
+		Log::info() << commandArguments.makeSummary();
+
+		return 0;
+	}
+
+	std::string inputValue;
+	if (!commandArguments.hasValue("input", inputValue, false, 0u) || inputValue.empty())
+	{
+		Log::error() << "No input directory defined";
+		Log::info() << " ";
+		Log::info() << commandArguments.makeSummary();
+
+		return 1;
+	}
+
+	const IO::Directory inputDirectory(inputValue);
+
+	if (!inputDirectory.exists())
+	{
+		Log::error() << "The provided input directory '" << inputDirectory() << "' does not exist";
+
+		return 1;
+	}
+
+	const std::string outputFilename = commandArguments.value<std::string>("output", "", false);
+	const std::string baselineFilename = commandArguments.value<std::string>("baseline", "", false);
+
+	const double tolerance = std::max(0.0, commandArguments.value<double>("tolerance", 0.1, true));
+
+	TrackerBenchmark::Configuration configuration;
+	configuration.mapFilename_ = commandArguments.value<std::string>("map", "", false);
+	configuration.patternFilename_ = commandArguments.value<std::string>("pattern", "", false);
+	configuration.patternWidth_ = Scalar(commandArguments.value<double>("patternWidth", 0.2, true));
+
+	if (!configuration.patternFilename_.empty() && configuration.patternWidth_ <= Numeric::eps())
+	{
+		Log::error() << "Invalid pattern width";
+
+		return 1;
+	}
+
+	Log::info() << "Start: " << DateTime::stringDate() << ", " << DateTime::stringTime() << " UTC";
+	Log::info() << "Platform: " << Build::buildString();
+	Log::info() << " ";
+
+	const Test::TestDataManager::ScopedSubscription scopedSubscription = TrackerBenchmark::registerRecordings(inputDirectory());
+
+	if (!scopedSubscription)
+	{
+		Log::error() << "The provided input directory '" << inputDirectory() << "' does not contain any .osn file";
+
+		return 1;
+	}
+
+	Test::Benchmark benchmark;
+	TrackerBenchmark::RecordingResults recordingResults;
+
+	int resultValue = 0;
+
+	if (!TrackerBenchmark::benchmark(configuration, benchmark, recordingResults))
+	{
+		resultValue = 1;
+	}
+
+	if (!outputFilename.empty())
+	{
+		if (benchmark.writeResults(outputFilename))
+		{
+			Log::info() << "Results written to '" << outputFilename << "'";
+		}
+		else
+		{
+			Log::error() << "Failed to write the results to '" << outputFilename << "'";
+			resultValue = 1;
+		}
+	}
+
+	if (!baselineFilename.empty())
+	{
+		Test::Benchmark::Results baselineResults;
+
+		if (Test::Benchmark::readCSV(baselineFilename, baselineResults))
+		{
+			const Test::Benchmark::Regressions regressions = Test::Benchmark::determineRegressions(benchmark.results(), baselineResults, tolerance);
+
+			if (regressions.empty())
+			{
+				Log::info() << "No regression in relation to the baseline '" << baselineFilename << "' (tolerance " << String::toAString(tolerance * 100.0, 1u) << "%)";
+			}
+			else
+			{
+				Log::info() << regressions.size() << " regression(s) in relation to the baseline '" << baselineFilename << "' (tolerance " << String::toAString(tolerance * 100.0, 1u) << "%):";
+
+				for (const Test::Benchmark::Regression& regression : regressions)
+				{
+					Log::info() << regression.current_.name_ << " (" << regression.current_.parameters_ << "): " << String::toAString(regression.baseline_.medianMs_, 3u) << "ms -> " << String::toAString(regression.current_.medianMs_, 3u) << "ms (" << String::toAString(regression.ratio_, 2u) << "x)";
+				}
+
+				resultValue = 1;
+			}
+		}
+		else
+		{
+			Log::error() << "Failed to read the baseline '" << baselineFilename << "'";
+			resultValue = 1;
+		}
+	}
+
+	Log::info() << " ";
+	Log::info() << "End: " << DateTime::stringDate() << ", " << DateTime::stringTime() << " UTC";
+
+	return resultValue;
+}
+
+ScopedPlugin::ScopedPlugin()
+{
+#ifdef OCEAN_RUNTIME_STATIC
+	OCEAN_APPLY_IF_WINDOWS(Media::WIC::registerWICLibrary());
+	OCEAN_APPLY_IF_WINDOWS(Media::MediaFoundation::registerMediaFoundationLibrary());
+	OCEAN_APPLY_IF_APPLE(Media::AVFoundation::registerAVFLibrary());
+	OCEAN_APPLY_IF_APPLE(Media::ImageIO::registerImageIOLibrary());
+
+	Devices::Serialization::registerSerializationLibrary();
+#endif // OCEAN_RUNTIME_STATIC
+}
+
+ScopedPlugin::~ScopedPlugin()
+{
+#ifdef OCEAN_RUNTIME_STATIC
+	Devices::Serialization::unregisterSerializationLibrary();
+
+	OCEAN_APPLY_IF_APPLE(Media::ImageIO::unregisterImageIOLibrary());
+	OCEAN_APPLY_IF_APPLE(Media::AVFoundation::unregisterAVFLibrary());
+	OCEAN_APPLY_IF_WINDOWS(Media::MediaFoundation::unregisterMediaFoundationLibrary());
+	OCEAN_APPLY_IF_WINDOWS(Media::WIC::unregisterWICLibrary());
+#endif // OCEAN_RUNTIME_STATIC
+}
@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#ifndef META_OCEAN_APPLICATION_OCEAN_DEMO_TRACKING_SLAM_BENCHMARK_BENCHMARK_MAIN_H
+#define META_OCEAN_APPLICATION_OCEAN_DEMO_TRACKING_SLAM_BENCHMARK_BENCHMARK_MAIN_H
+
+#include "application/ocean/demo/tracking/slam/ApplicationDemoTrackingSLAM.h"
+
+/**
+ * @ingroup applicationdemotrackingslam
+ * @defgroup applicationdemotrackingslambenchmark SLAM Benchmark
+ * @{
+ * The demo application benchmarks the SLAM tracker end-to-end on recordings (.osn files).<br>
+ * In contrast to the regression application, the recordings are replayed as fast as possible so that the throughput of the tracker can be measured.
+ *
+ * The recordings are registered as test data collection in the TestDataManager, for each recording the application reports:<br>
+ * - The per-frame latency of the tracker and of the individual stages (pyramid, tracking, pose, Bundle Adjustment)<br>
+ * - The number of processed frames per second<br>
+ * - The number of memory allocations per frame<br>
+ * - The accuracy of the relative camera rotations in relation to ground truth poses, if the recording contains a 6-DOF tracker
+ *
+ * The latencies can be written as JSON or CSV file and can be compared with a baseline to detect performance regressions.<br>
+ * This application is platform independent and is available on desktop platforms like e.g., Windows or MacOS.
+ * @}
+ */
+
+using namespace Ocean;
+
+/**
+ * Just a helper class to ensure that all media plugins are unregistered when this object is disposed.
+ * @ingroup applicationdemotrackingslambenchmark
+ */
+class ScopedPlugin
+{
+	public:
+
+		/**
+		 * Creates a new object and registers all plugins.
+		 */
+		ScopedPlugin();
+
+		/**
+		 * Destructs this object and unregisters all plugins.
+		 */
+		~ScopedPlugin();
+};
+
+#endif // META_OCEAN_APPLICATION_OCEAN_DEMO_TRACKING_SLAM_BENCHMARK_BENCHMARK_MAIN_H
@@ -0,0 +1,739 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "application/ocean/demo/tracking/slam/benchmark/TrackerBenchmark.h"
+
+#include "ocean/base/MemoryTracker.h"
+#include "ocean/base/String.h"
+
+#include "ocean/cv/FrameConverter.h"
+
+#include "ocean/devices/GravityTracker3DOF.h"
+#include "ocean/devices/Manager.h"
+#include "ocean/devices/OrientationTracker3DOF.h"
+#include "ocean/devices/Tracker6DOF.h"
+
+#include "ocean/devices/serialization/SerializerDevicePlayer.h"
+
+#include "ocean/io/Bitstream.h"
+#include "ocean/io/Directory.h"
+#include "ocean/io/File.h"
+
+#include "ocean/media/Utilities.h"
+
+#include "ocean/tracking/Utilities.h"
+
+#include "ocean/tracking/mapbuilding/RelocalizerMono.h"
+#include "ocean/tracking/mapbuilding/UnifiedFeatureMap.h"
+#include "ocean/tracking/mapbuilding/Utilities.h"
+
+#include "ocean/tracking/pattern/PatternTrackerCore6DOF.h"
+
+#include "ocean/tracking/slam/TrackerMono.h"
+
+#include <algorithm>
+#include <fstream>
+
+namespace Ocean
+{
+
+namespace Test
+{
+
+namespace TestTracking
+{
+
+namespace TestSLAM
+{
+
+/**
+ * Helper class providing access to gravity, orientation and ground truth sensor data.
+ * This class manages GravityTracker3DOF, OrientationTracker3DOF and Tracker6DOF devices and provides convenience functions to retrieve sensor measurements transformed into the camera coordinate system.
+ */
+class SensorAccessor
+{
+	public:
+
+		/**
+		 * Creates a new sensor accessor object.
+		 */
+		SensorAccessor() = default;
+
+		/**
+		 * Returns the gravity vector in the camera coordinate system.
+		 * On first call, this function will initialize and start the gravity tracker device.
+		 * @param device_Q_camera The rotation transforming points in camera coordinates to device coordinates
+		 * @param timestamp The timestamp for which the gravity measurement is requested
+		 * @return The gravity vector in camera coordinates, a null vector if unavailable
+		 */
+		Vector3 cameraGravity(const Quaternion& device_Q_camera, const Timestamp& timestamp);
+
+		/**
+		 * Returns the camera's orientation in world coordinates.
+		 * On first call, this function will initialize and start the orientation tracker device.
+		 * @param device_Q_camera The rotation transforming points in camera coordinates to device coordinates
+		 * @param timestamp The timestamp for which the orientation measurement is requested
+		 * @return The rotation transforming points in camera coordinates to world coordinates, invalid if unavailable
+		 */
+		Quaternion anyWorld_Q_camera(const Quaternion& device_Q_camera, const Timestamp& timestamp);
+
+		/**
+		 * Returns the ground truth pose of the camera as recorded by a 6-DOF tracker.
+		 * On first call, this function will initialize and start the 6-DOF tracker device.
+		 * @param device_T_camera The transformation transforming points in camera coordinates to device coordinates
+		 * @param timestamp The timestamp for which the pose is requested
+		 * @return The transformation transforming points in camera coordinates to ground truth world coordinates, invalid if unavailable
+		 */
+		HomogenousMatrix4 groundTruth_world_T_camera(const HomogenousMatrix4& device_T_camera, const Timestamp& timestamp);
+
+		/**
+		 * Releases all device references held by this object.
+		 */
+		void release();
+
+	protected:
+
+		/// The gravity tracker device providing gravity measurements.
+		Devices::GravityTracker3DOFRef gravityTracker_;
+
+		/// The orientation tracker device providing orientation measurements.
+		Devices::OrientationTracker3DOFRef orientationTracker_;
+
+		/// The 6-DOF tracker device providing ground truth poses.
+		Devices::Tracker6DOFRef tracker6DOF_;
+};
+
+Vector3 SensorAccessor::cameraGravity(const Quaternion& device_Q_camera, const Timestamp& timestamp)
+{
+	if (!device_Q_camera.isValid())
+	{
+		return Vector3(0, 0, 0);
+	}
+
+	if (gravityTracker_.isNull())
+	{
+		gravityTracker_ = Devices::Manager::get().device(Devices::GravityTracker3DOF::deviceTypeGravityTracker3DOF());
+
+		if (gravityTracker_)
+		{
+			gravityTracker_->start();
+		}
+	}
+
+	if (gravityTracker_)
+	{
+		const Devices::GravityTracker3DOF::GravityTracker3DOFSampleRef sample = gravityTracker_->sample(timestamp, Devices::Measurement::IS_TIMESTAMP_INTERPOLATE);
+
+		if (sample && sample->gravities().size() >= 1)
+		{
+			ocean_assert(sample->referenceSystem() == Devices::Tracker::RS_OBJECT_IN_DEVICE);
+
+			const Vector3& deviceGravity = sample->gravities().front();
+			const Quaternion camera_Q_device = device_Q_camera.inverted();
+
+			return camera_Q_device * deviceGravity;
+		}
+	}
+
+	return Vector3(0, 0, 0);
+}
+
+Quaternion SensorAccessor::anyWorld_Q_camera(const Quaternion& device_Q_camera, const Timestamp& timestamp)
+{
+	if (!device_Q_camera.isValid())
+	{
+		return Quaternion(false);
+	}
+
+	if (orientationTracker_.isNull())
+	{
+		orientationTracker_ = Devices::Manager::get().device(Devices::OrientationTracker3DOF::deviceTypeOrientationTracker3DOF());
+
+		if (orientationTracker_)
+		{
+			orientationTracker_->start();
+		}
+	}
+
+	if (orientationTracker_)
+	{
+		const Devices::OrientationTracker3DOF::OrientationTracker3DOFSampleRef sample = orientationTracker_->sample(timestamp, Devices::Measurement::IS_TIMESTAMP_INTERPOLATE);
+
+		if (sample && sample->orientations().size() >= 1)
+		{
+			ocean_assert(sample->referenceSystem() == Devices::Tracker::RS_DEVICE_IN_OBJECT);
+
+			const Quaternion anyWorld_Q_device = sample->orientations().front();
+
+			return anyWorld_Q_device * device_Q_camera;
+		}
+	}
+
+	return Quaternion(false);
+}
+
+HomogenousMatrix4 SensorAccessor::groundTruth_world_T_camera(const HomogenousMatrix4& device_T_camera, const Timestamp& timestamp)
+{
+	if (!device_T_camera.isValid())
+	{
+		return HomogenousMatrix4(false);
+	}
+
+	if (tracker6DOF_.isNull())
+	{
+		tracker6DOF_ = Devices::Manager::get().device(Devices::Tracker6DOF::deviceTypeTracker6DOF());
+
+		if (tracker6DOF_)
+		{
+			tracker6DOF_->start();
+		}
+	}
+
+	if (tracker6DOF_)
+	{
+		const Devices::Tracker6DOF::Tracker6DOFSampleRef sample = tracker6DOF_->sample(timestamp, Devices::Measurement::IS_TIMESTAMP_INTERPOLATE);
+
+		if (sample && sample->orientations().size() >= 1 && sample->positions().size() >= 1)
+		{
+			HomogenousMatrix4 world_T_device(sample->positions().front(), sample->orientations().front());
+
+			if (sample->referenceSystem() == Devices::Tracker::RS_OBJECT_IN_DEVICE)
+			{
+				world_T_device.invert();
+			}
+
+			return world_T_device * device_T_camera;
+		}
+	}
+
+	return HomogenousMatrix4(false);
+}
+
+void SensorAccessor::release()
+{
+	gravityTracker_.release();
+	orientationTracker_.release();
+	tracker6DOF_.release();
+}
+
+std::atomic<uint64_t> TrackerBenchmark::allocationCounter_(0u);
+
+TrackerBenchmark::RecordingCollection::RecordingCollection(Strings&& filenames) :
+	filenames_(std::move(filenames))
+{
+	ocean_assert(!filenames_.empty());
+}
+
+SharedTestData TrackerBenchmark::RecordingCollection::data(const size_t index)
+{
+	ocean_assert(index < filenames_.size());
+
+	if (index >= filenames_.size())
+	{
+		return nullptr;
+	}
+
+	return std::make_shared<TestData>(Value(filenames_[index]));
+}
+
+size_t TrackerBenchmark::RecordingCollection::size()
+{
+	return filenames_.size();
+}
+
+TestDataManager::ScopedSubscription TrackerBenchmark::registerRecordings(const std::string& directory)
+{
+	ocean_assert(!directory.empty());
+
+	const IO::Files osnFiles = IO::Directory(directory).findFiles("osn", false);
+
+	if (osnFiles.empty())
+	{
+		return TestDataManager::ScopedSubscription();
+	}
+
+	Strings filenames;
+	filenames.reserve(osnFiles.size());
+
+	for (const IO::File& osnFile : osnFiles)
+	{
+		filenames.emplace_back(osnFile());
+	}
+
+	return TestDataManager::get().registerTestDataCollection(recordingCollectionName_, std::make_unique<RecordingCollection>(std::move(filenames)));
+}
+
+bool TrackerBenchmark::benchmark(const Configuration& configuration, Benchmark& benchmark, RecordingResults& recordingResults)
+{
+	const SharedTestDataCollection recordingCollection = TestDataManager::get().testDataCollection(recordingCollectionName_);
+
+	if (!recordingCollection || recordingCollection->size() == 0)
+	{
+		Log::error() << "No recordings registered";
+		return false;
+	}
+
+	Log::info() << "Benchmarking with " << recordingCollection->size() << " recording(s)";
+	Log::info() << " ";
+
+	bool allSucceeded = true;
+
+	for (size_t index = 0; index < recordingCollection->size(); ++index)
+	{
+		const SharedTestData testData = recordingCollection->data(index);
+
+		if (!testData || testData->dataType() != TestData::DT_VALUE || !testData->value().isString())
+		{
+			ocean_assert(false && "Invalid test data!");
+			allSucceeded = false;
+
+			continue;
+		}
+
+		const std::string osnFilename = testData->value().stringValue();
+
+		Log::info() << "Recording: " << osnFilename;
+		Log::info() << " ";
+
+		for (unsigned int trackerIndex = 0u; trackerIndex < 3u; ++trackerIndex)
+		{
+			RecordingResult recordingResult;
+
+			MemoryTracker::resetPeaks();
+
+			bool succeeded = false;
+
+			switch (trackerIndex)
+			{
+				case 0u:
+					succeeded = benchmarkRecording(osnFilename, benchmark, recordingResult);
+					break;
+
+				case 1u:
+					if (configuration.mapFilename_.empty())
+					{
+						continue;
+					}
+
+					succeeded = benchmarkRelocalizerRecording(osnFilename, configuration.mapFilename_, benchmark, recordingResult);
+					break;
+
+				default:
+					ocean_assert(trackerIndex == 2u);
+
+					if (configuration.patternFilename_.empty())
+					{
+						continue;
+					}
+
+					succeeded = benchmarkPatternRecording(osnFilename, configuration.patternFilename_, configuration.patternWidth_, benchmark, recordingResult);
+					break;
+			}
+
+			if (!succeeded)
+			{
+				Log::error() << "Failed to replay the recording";
+				Log::info() << " ";
+
+				allSucceeded = false;
+
+				continue;
+			}
+
+			logRecordingResult(recordingResult);
+
+			recordingResults.emplace_back(std::move(recordingResult));
+		}
+	}
+
+	return allSucceeded;
+}
+
+bool TrackerBenchmark::benchmarkRecording(const std::string& osnFilename, Benchmark& benchmark, RecordingResult& recordingResult)
+{
+	// the tracker is disposed after the performance statistics have been accessed, so that all background tasks have finished
+
+	Tracking::SLAM::TrackerMono trackerMono;
+	Frame yFrame;
+
+	const FrameFunction frameFunction = [&trackerMono, &yFrame](const Frame& frame, const AnyCamera& camera, const Vector3& cameraGravity, const Quaternion& anyWorld_Q_camera, HomogenousMatrix4& world_T_camera)
+	{
+		if (!CV::FrameConverter::Comfort::convert(frame, FrameType::formatGrayscalePixelFormat(frame.pixelFormat()), FrameType::ORIGIN_UPPER_LEFT, yFrame))
+		{
+			Log::error() << "Failed to convert frame to grayscale";
+			return false;
+		}
+
+		trackerMono.handleFrame(camera, std::move(yFrame), world_T_camera, cameraGravity, anyWorld_Q_camera, nullptr);
+
+		return true;
+	};
+
+	if (!replayRecording(osnFilename, "trackermono", frameFunction, benchmark, recordingResult))
+	{
+		return false;
+	}
+
+	const Tracking::SLAM::TrackerMono::PerformanceStatistics& performanceStatistics = trackerMono.performanceStatistics();
+
+	benchmark.addMeasurements("trackermono.handleframe", recordingResult.name_, performanceStatistics.handleFrame_);
+	benchmark.addMeasurements("trackermono.pyramid", recordingResult.name_, performanceStatistics.createPyramid_);
+	benchmark.addMeasurements("trackermono.tracking", recordingResult.name_, performanceStatistics.trackImagePoints_);
+	benchmark.addMeasurements("trackermono.pose", recordingResult.name_, performanceStatistics.determineCameraPose_);
+	benchmark.addMeasurements("trackermono.bundleadjustment", recordingResult.name_, performanceStatistics.bundleAdjustment_);
+
+	return true;
+}
+
+bool TrackerBenchmark::benchmarkRelocalizerRecording(const std::string& osnFilename, const std::string& mapFilename, Benchmark& benchmark, RecordingResult& recordingResult)
+{
+	const IO::File mapFile(mapFilename);
+
+	if (!mapFile.exists() || mapFile.extension() != "ocean_map")
+	{
+		Log::error() << "Invalid feature map file: " << mapFilename;
+		return false;
+	}
+
+	std::ifstream stream(mapFile(), std::ios::binary);
+	IO::InputBitstream inputBitstream(stream);
+
+	Tracking::Database database;
+	std::shared_ptr<Tracking::MapBuilding::UnifiedDescriptorMap> descriptorMap;
+
+	if (!Tracking::Utilities::readDatabase(inputBitstream, database) || !Tracking::MapBuilding::Utilities::readDescriptorMap(inputBitstream, descriptorMap))
+	{
+		Log::error() << "Failed to read the feature map: " << mapFilename;
+		return false;
+	}
+
+	ocean_assert(descriptorMap);
+
+	Vectors3 databaseObjectPoints;
+	Indices32 databaseObjectPointIds = database.objectPointIds<false, false>(Tracking::Database::invalidObjectPoint(), &databaseObjectPoints);
+
+	using ImagePointDescriptor = Tracking::MapBuilding::UnifiedDescriptor::FreakMultiDescriptor256;
+	using ObjectPointDescriptor = Tracking::MapBuilding::UnifiedDescriptor::FreakMultiDescriptors256;
+	using ObjectPointVocabularyDescriptor = Tracking::MapBuilding::UnifiedDescriptor::BinaryDescriptor<256u>;
+
+	using UnifiedFeatureMap = Tracking::MapBuilding::UnifiedFeatureMapT<ImagePointDescriptor, ObjectPointDescriptor, ObjectPointVocabularyDescriptor>;
+
+	RandomGenerator randomGenerator;
+	Tracking::MapBuilding::SharedUnifiedFeatureMap featureMap = std::make_shared<UnifiedFeatureMap>(std::move(databaseObjectPoints), std::move(databaseObjectPointIds), std::move(descriptorMap), randomGenerator, &UnifiedFeatureMap::VocabularyForest::TVocabularyTree::determineClustersMeanForBinaryDescriptor<256u>, &Tracking::MapBuilding::UnifiedHelperFreakMultiDescriptor256::extractVocabularyDescriptorsFromMap);
+
+	Tracking::MapBuilding::RelocalizerMono relocalizerMono(Tracking::MapBuilding::Relocalizer::detectFreakFeatures);
+
+	if (!relocalizerMono.setFeatureMap(std::move(featureMap)))
+	{
+		Log::error() << "Failed to initialize the feature map: " << mapFilename;
+		return false;
+	}
+
+	Frame yFrame;
+	HomogenousMatrix4 world_T_previousCamera(false);
+
+	const FrameFunction frameFunction = [&relocalizerMono, &yFrame, &world_T_previousCamera](const Frame& frame, const AnyCamera& camera, const Vector3& /*cameraGravity*/, const Quaternion& /*anyWorld_Q_camera*/, HomogenousMatrix4& world_T_camera)
+	{
+		if (!CV::FrameConverter::Comfort::convert(frame, FrameType::FORMAT_Y8, FrameType::ORIGIN_UPPER_LEFT, yFrame, CV::FrameConverter::CP_AVOID_COPY_IF_POSSIBLE))
+		{
+			Log::error() << "Failed to convert frame to grayscale";
+			return false;
+		}
+
+		// same parameters as used by the on-device relocalizer, the previous pose is used as rough pose
+
+		constexpr unsigned int minimalNumberCorrespondences = 20u;
+		constexpr Scalar maximalProjectionError = Scalar(3.5);
+		constexpr Scalar inlierRate = Scalar(0.15);
+
+		if (!relocalizerMono.relocalize(camera, yFrame, world_T_camera, minimalNumberCorrespondences, maximalProjectionError, inlierRate, world_T_previousCamera))
+		{
+			world_T_camera.toNull();
+		}
+
+		world_T_previousCamera = world_T_camera;
+
+		return true;
+	};
+
+	return replayRecording(osnFilename, "relocalizermono", frameFunction, benchmark, recordingResult);
+}
+
+bool TrackerBenchmark::benchmarkPatternRecording(const std::string& osnFilename, const std::string& patternFilename, const Scalar patternWidth, Benchmark& benchmark, RecordingResult& recordingResult)
+{
+	ocean_assert(patternWidth > Numeric::eps());
+
+	Tracking::Pattern::PatternTrackerCore6DOF patternTracker;
+
+	const Frame patternFrame = Media::Utilities::loadImage(patternFilename);
+
+	if (!patternFrame.isValid())
+	{
+		Log::error() << "Failed to load the pattern image: " << patternFilename;
+		return false;
+	}
+
+	Frame yPatternFrame;
+	if (!CV::FrameConverter::Comfort::convert(patternFrame, FrameType::FORMAT_Y8, FrameType::ORIGIN_UPPER_LEFT, yPatternFrame, CV::FrameConverter::CP_AVOID_COPY_IF_POSSIBLE))
+	{
+		Log::error() << "Failed to convert the pattern image to grayscale";
+		return false;
+	}
+
+	const Vector2 patternDimension(patternWidth, patternWidth * Scalar(yPatternFrame.height()) / Scalar(yPatternFrame.width()));
+
+	if (patternTracker.addPattern(yPatternFrame.constdata<uint8_t>(), yPatternFrame.width(), yPatternFrame.height(), yPatternFrame.paddingElements(), patternDimension) == (unsigned int)(-1))
+	{
+		Log::error() << "Failed to add the pattern: " << patternFilename;
+		return false;
+	}
+
+	Frame yFrame;
+	Tracking::VisualTracker::TransformationSamples transformations;
+
+	const FrameFunction frameFunction = [&patternTracker, &yFrame, &transformations](const Frame& frame, const AnyCamera& camera, const Vector3& /*cameraGravity*/, const Quaternion& anyWorld_Q_camera, HomogenousMatrix4& world_T_camera)
+	{
+		if (!CV::FrameConverter::Comfort::convert(frame, FrameType::FORMAT_Y8, FrameType::ORIGIN_UPPER_LEFT, yFrame, CV::FrameConverter::CP_AVOID_COPY_IF_POSSIBLE))
+		{
+			Log::error() << "Failed to convert frame to grayscale";
+			return false;
+		}
+
+		// the pattern tracker needs a pinhole camera, other camera models are approximated
+
+		const PinholeCamera pinholeCamera = camera.name() == AnyCameraPinhole::WrappedCamera::name() ? ((const AnyCameraPinhole&)(camera)).actualCamera() : PinholeCamera(camera.width(), camera.height(), camera.focalLengthX(), camera.focalLengthY(), camera.principalPointX(), camera.principalPointY());
+
+		transformations.clear();
+
+		if (patternTracker.determinePoses(yFrame.constdata<uint8_t>(), pinholeCamera, yFrame.paddingElements(), false /*frameIsUndistorted*/, frame.timestamp(), transformations, anyWorld_Q_camera) && !transformations.empty())
+		{
+			// the pose of the pattern is used as world
+
+			world_T_camera = transformations.front().transformation();
+		}
+		else
+		{
+			world_T_camera.toNull();
+		}
+
+		return true;
+	};
+
+	return replayRecording(osnFilename, "patterntracker6dof", frameFunction, benchmark, recordingResult);
+}
+
+bool TrackerBenchmark::replayRecording(const std::string& osnFilename, const std::string& tracker, const FrameFunction& frameFunction, Benchmark& benchmark, RecordingResult& recordingResult)
+{
+	ocean_assert(!tracker.empty() && frameFunction);
+
+	const IO::File inputFile(osnFilename);
+
+	if (!inputFile.exists() || inputFile.extension() != "osn")
+	{
+		Log::error() << "Invalid OSN file: " << osnFilename;
+		return false;
+	}
+
+	Devices::Serialization::SerializerDevicePlayer devicePlayer;
+
+	if (!devicePlayer.initialize(inputFile()))
+	{
+		Log::error() << "Failed to initialize device player for: " << osnFilename;
+		return false;
+	}
+
+	if (devicePlayer.frameMediums().empty())
+	{
+		Log::error() << "Device player has no frame mediums: " << osnFilename;
+		return false;
+	}
+
+	// speed 0 replays the recording in stop-motion mode, each frame is delivered when requested, without any real-time constraint
+
+	if (!devicePlayer.start(0.0f))
+	{
+		Log::error() << "Failed to start device player";
+		return false;
+	}
+
+	constexpr double stopMotionTolerance = 0.005; // 5ms
+
+	devicePlayer.setStopMotionTolerance(IO::Serialization::DataTimestamp(stopMotionTolerance));
+
+	Media::FrameMediumRef frameMedium = devicePlayer.frameMediums().front();
+
+	// the name of the recording is used as benchmark parameter, which must not contain a comma
+
+	std::string recordingName = inputFile.name();
+	std::replace(recordingName.begin(), recordingName.end(), ',', '_');
+
+	HomogenousMatrices4 world_T_cameras;
+	HomogenousMatrices4 groundTruth_world_T_cameras;
+
+	HighPerformanceStatistic performanceFrame;
+	uint64_t frameAllocations = 0u;
+
+	SensorAccessor sensorAccessor;
+
+	while (devicePlayer.isPlaying())
+	{
+		const Timestamp frameTimestamp = devicePlayer.playNextFrame();
+
+		if (frameTimestamp.isInvalid())
+		{
+			// we have reached the end of the replay
+			break;
+		}
+
+		SharedAnyCamera camera;
+		FrameRef frame = frameMedium->frame(frameTimestamp, &camera);
+
+		if (!frame || !camera)
+		{
+			ocean_assert(false && "This should never happen!");
+			return false;
+		}
+
+		const HomogenousMatrix4 device_T_camera(frameMedium->device_T_camera());
+		const Quaternion device_Q_camera(device_T_camera.rotation());
+
+		const Vector3 cameraGravity = sensorAccessor.cameraGravity(device_Q_camera, frameTimestamp);
+		const Quaternion anyWorld_Q_camera = sensorAccessor.anyWorld_Q_camera(device_Q_camera, frameTimestamp);
+
+		HomogenousMatrix4 world_T_camera(false);
+
+		const uint64_t allocationsBefore = allocations();
+
+		performanceFrame.start();
+
+			const bool frameSucceeded = frameFunction(*frame, *camera, cameraGravity, anyWorld_Q_camera, world_T_camera);
+
+		performanceFrame.stop();
+
+		if (!frameSucceeded)
+		{
+			return false;
+		}
+
+		frameAllocations += allocations() - allocationsBefore;
+
+		world_T_cameras.emplace_back(world_T_camera);
+		groundTruth_world_T_cameras.emplace_back(sensorAccessor.groundTruth_world_T_camera(device_T_camera, frameTimestamp));
+	}
+
+	if (world_T_cameras.empty())
+	{
+		Log::error() << "The recording does not contain any frame";
+		return false;
+	}
+
+	benchmark.addMeasurements(tracker + ".frame", recordingName, performanceFrame);
+
+	sensorAccessor.release();
+	frameMedium.release();
+	devicePlayer.release();
+
+	recordingResult.tracker_ = tracker;
+	recordingResult.name_ = std::move(recordingName);
+	recordingResult.frames_ = world_T_cameras.size();
+
+	for (const HomogenousMatrix4& world_T_camera : world_T_cameras)
+	{
+		if (world_T_camera.isValid())
+		{
+			++recordingResult.validPoses_;
+		}
+	}
+
+	if (performanceFrame.total() > 0.0)
+	{
+		recordingResult.framesPerSecond_ = double(performanceFrame.measurements()) / performanceFrame.total();
+	}
+
+	if (allocations() != 0u)
+	{
+		recordingResult.allocationsPerFrame_ = double(frameAllocations) / double(recordingResult.frames_);
+	}
+
+	Scalars rotationErrors = determineRelativeRotationErrors(world_T_cameras, groundTruth_world_T_cameras);
+
+	recordingResult.groundTruthPairs_ = rotationErrors.size();
+
+	if (!rotationErrors.empty())
+	{
+		std::sort(rotationErrors.begin(), rotationErrors.end());
+
+		recordingResult.medianRotationError_ = double(rotationErrors[rotationErrors.size() / 2]);
+		recordingResult.p90RotationError_ = double(rotationErrors[std::min(rotationErrors.size() * 9 / 10, rotationErrors.size() - 1)]);
+	}
+
+	return true;
+}
+
+void TrackerBenchmark::logRecordingResult(const RecordingResult& recordingResult)
+{
+	Log::info() << "Tracker: " << recordingResult.tracker_;
+	Log::info() << "Frames: " << recordingResult.frames_ << ", valid poses: " << recordingResult.validPoses_;
+	Log::info() << "Throughput: " << String::toAString(recordingResult.framesPerSecond_, 1u) << " frames/s";
+
+	if (recordingResult.allocationsPerFrame_ >= 0.0)
+	{
+		Log::info() << "Allocations: " << String::toAString(recordingResult.allocationsPerFrame_, 1u) << " per frame";
+	}
+
+	for (const MemoryTracker::Statistic& statistic : MemoryTracker::statistics())
+	{
+		Log::info() << "Memory " << statistic.name_ << ": peak " << String::toAString(double(statistic.peakBytes_) / (1024.0 * 1024.0), 2u) << "MB";
+	}
+
+	if (recordingResult.groundTruthPairs_ != 0)
+	{
+		Log::info() << "Relative rotation error (" << recordingResult.groundTruthPairs_ << " frame pairs): median: " << String::toAString(recordingResult.medianRotationError_, 3u) << "deg, P90: " << String::toAString(recordingResult.p90RotationError_, 3u) << "deg";
+	}
+	else
+	{
+		Log::info() << "No ground truth poses available";
+	}
+
+	Log::info() << " ";
+}
+
+Scalars TrackerBenchmark::determineRelativeRotationErrors(const HomogenousMatrices4& world_T_cameras, const HomogenousMatrices4& groundTruth_world_T_cameras)
+{
+	ocean_assert(world_T_cameras.size() == groundTruth_world_T_cameras.size());
+
+	Scalars rotationErrors;
+
+	for (size_t n = 1; n < world_T_cameras.size(); ++n)
+	{
+		const HomogenousMatrix4& world_T_previousCamera = world_T_cameras[n - 1];
+		const HomogenousMatrix4& world_T_currentCamera = world_T_cameras[n];
+
+		const HomogenousMatrix4& groundTruth_world_T_previousCamera = groundTruth_world_T_cameras[n - 1];
+		const HomogenousMatrix4& groundTruth_world_T_currentCamera = groundTruth_world_T_cameras[n];
+
+		if (!world_T_previousCamera.isValid() || !world_T_currentCamera.isValid() || !groundTruth_world_T_previousCamera.isValid() || !groundTruth_world_T_currentCamera.isValid())
+		{
+			continue;
+		}
+
+		const Quaternion previous_Q_current = world_T_previousCamera.rotation().inverted() * world_T_currentCamera.rotation();
+		const Quaternion groundTruth_previous_Q_current = groundTruth_world_T_previousCamera.rotation().inverted() * groundTruth_world_T_currentCamera.rotation();
+
+		rotationErrors.emplace_back(Numeric::rad2deg(previous_Q_current.smallestAngle(groundTruth_previous_Q_current)));
+	}
+
+	return rotationErrors;
+}
+
+}
+
+}
+
+}
+
+}
@@ -0,0 +1,252 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#ifndef META_OCEAN_APPLICATION_OCEAN_DEMO_TRACKING_SLAM_BENCHMARK_TRACKER_BENCHMARK_H
+#define META_OCEAN_APPLICATION_OCEAN_DEMO_TRACKING_SLAM_BENCHMARK_TRACKER_BENCHMARK_H
+
+#include "application/ocean/demo/tracking/slam/ApplicationDemoTrackingSLAM.h"
+
+#include "ocean/base/Frame.h"
+
+#include "ocean/math/AnyCamera.h"
+#include "ocean/math/HomogenousMatrix4.h"
+
+#include "ocean/test/Benchmark.h"
+#include "ocean/test/TestDataCollection.h"
+#include "ocean/test/TestDataManager.h"
+
+#include <atomic>
+#include <functional>
+
+namespace Ocean
+{
+
+namespace Test
+{
+
+namespace TestTracking
+{
+
+namespace TestSLAM
+{
+
+/**
+ * This class implements an end-to-end throughput benchmark for the SLAM tracker, the relocalizer, and the pattern tracker.
+ * The benchmark replays .osn files as fast as possible through TrackerMono and measures the latency of the tracker and its individual stages.<br>
+ * Optionally, the recordings are also replayed through MapBuilding::RelocalizerMono (with a given feature map) and through PatternTrackerCore6DOF (with a given pattern image).
+ * @ingroup applicationdemotrackingslambenchmark
+ */
+class TrackerBenchmark
+{
+	public:
+
+		/**
+		 * This class implements a test data collection holding the filenames of recordings.
+		 * Each test data object holds the filename of one recording as value.
+		 */
+		class RecordingCollection : public TestDataCollection
+		{
+			public:
+
+				/**
+				 * Creates a new test data collection object.
+				 * @param filenames The filenames of all recordings which will be part of the test collection, at least one
+				 */
+				explicit RecordingCollection(Strings&& filenames);
+
+				/**
+				 * Returns the test data object associated with a specified index.
+				 * @see TestDataCollection::data().
+				 */
+				SharedTestData data(const size_t index) override;
+
+				/**
+				 * Returns the number of data object objects this collection holds.
+				 * @see TestDataCollection::size().
+				 */
+				size_t size() override;
+
+			protected:
+
+				/// The filenames of all recordings belonging to this test collection.
+				Strings filenames_;
+		};
+
+		/**
+		 * This class holds the configuration of the benchmark.
+		 */
+		class Configuration
+		{
+			public:
+
+				/// The optional feature map file (.ocean_map) for the relocalizer, empty to skip the relocalizer.
+				std::string mapFilename_;
+
+				/// The optional image file of a planar pattern for the pattern tracker, empty to skip the pattern tracker.
+				std::string patternFilename_;
+
+				/// The width of the pattern, in meter, with range (0, infinity).
+				Scalar patternWidth_ = Scalar(0.2);
+		};
+
+		/**
+		 * This class holds the benchmark result of one recording which does not fit into a latency measurement.
+		 */
+		class RecordingResult
+		{
+			public:
+
+				/// The name of the benchmarked tracker, e.g., "trackermono".
+				std::string tracker_;
+
+				/// The name of the recording.
+				std::string name_;
+
+				/// The number of frames which have been processed.
+				size_t frames_ = 0;
+
+				/// The number of frames for which the tracker determined a valid pose.
+				size_t validPoses_ = 0;
+
+				/// The number of frames the tracker processed per second, based on the accumulated processing time of all frames.
+				double framesPerSecond_ = 0.0;
+
+				/// The average number of memory allocations (in all threads) while the tracker processed one frame, -1 if unknown.
+				double allocationsPerFrame_ = -1.0;
+
+				/// The number of pairs of successive frames for which both, tracker and ground truth, provided a pose.
+				size_t groundTruthPairs_ = 0;
+
+				/// The median error between the relative camera rotations of the tracker and of the ground truth, in degree, -1 if unknown.
+				double medianRotationError_ = -1.0;
+
+				/// The P90 error between the relative camera rotations of the tracker and of the ground truth, in degree, -1 if unknown.
+				double p90RotationError_ = -1.0;
+		};
+
+		/**
+		 * Definition of a vector holding recording results.
+		 */
+		using RecordingResults = std::vector<RecordingResult>;
+
+		/// The name of the test data collection holding the recordings.
+		static constexpr const char* recordingCollectionName_ = "slam_trackermono_benchmark_recordings";
+
+	public:
+
+		/**
+		 * Registers all recordings (.osn files) of a directory as test data collection.
+		 * @param directory The directory containing the recordings, must be valid
+		 * @return The subscription of the registered collection, invalid if the directory does not contain any recording
+		 */
+		[[nodiscard]] static TestDataManager::ScopedSubscription registerRecordings(const std::string& directory);
+
+		/**
+		 * Benchmarks the trackers with all recordings of the registered test data collection.
+		 * @param configuration The configuration of the benchmark
+		 * @param benchmark The benchmark object receiving the latency measurements
+		 * @param recordingResults The resulting results of all recordings which could be replayed, one for each recording and tracker
+		 * @return True, if all recordings could be replayed
+		 */
+		static bool benchmark(const Configuration& configuration, Benchmark& benchmark, RecordingResults& recordingResults);
+
+		/**
+		 * Benchmarks the SLAM tracker with one recording.
+		 * @param osnFilename The filename of the recording, must be valid
+		 * @param benchmark The benchmark object receiving the latency measurements
+		 * @param recordingResult The resulting result of the recording
+		 * @return True, if succeeded
+		 */
+		static bool benchmarkRecording(const std::string& osnFilename, Benchmark& benchmark, RecordingResult& recordingResult);
+
+		/**
+		 * Benchmarks the relocalizer with one recording, each frame is relocalized individually.
+		 * @param osnFilename The filename of the recording, must be valid
+		 * @param mapFilename The filename of the feature map (.ocean_map) in which the frames will be relocalized, must be valid
+		 * @param benchmark The benchmark object receiving the latency measurements
+		 * @param recordingResult The resulting result of the recording
+		 * @return True, if succeeded
+		 */
+		static bool benchmarkRelocalizerRecording(const std::string& osnFilename, const std::string& mapFilename, Benchmark& benchmark, RecordingResult& recordingResult);
+
+		/**
+		 * Benchmarks the pattern tracker with one recording.
+		 * Cameras which are not pinhole cameras are approximated by a pinhole camera without distortion.
+		 * @param osnFilename The filename of the recording, must be valid
+		 * @param patternFilename The filename of the image of the pattern, must be valid
+		 * @param patternWidth The width of the pattern, in meter, with range (0, infinity)
+		 * @param benchmark The benchmark object receiving the latency measurements
+		 * @param recordingResult The resulting result of the recording
+		 * @return True, if succeeded
+		 */
+		static bool benchmarkPatternRecording(const std::string& osnFilename, const std::string& patternFilename, const Scalar patternWidth, Benchmark& benchmark, RecordingResult& recordingResult);
+
+		/**
+		 * Returns the number of memory allocations the application has made so far.
+		 * The counter is incremented by the application's replacement of the global new operator, without replacement the counter is always zero.
+		 * @return The number of allocations
+		 */
+		static inline uint64_t allocations();
+
+	protected:
+
+		/**
+		 * Definition of a function processing one frame of a recording with a tracker.
+		 * The function receives the frame, the camera profile, the gravity in camera coordinates (a null vector if unknown), and the camera orientation in an arbitrary world (invalid if unknown).<br>
+		 * The function returns false to stop the replay, and provides the resulting camera pose (invalid if unknown) in the last parameter.
+		 */
+		using FrameFunction = std::function<bool(const Frame& frame, const AnyCamera& camera, const Vector3& cameraGravity, const Quaternion& anyWorld_Q_camera, HomogenousMatrix4& world_T_camera)>;
+
+	protected:
+
+		/**
+		 * Replays a recording as fast as possible through a tracker and determines the throughput, allocations, and accuracy of the tracker.
+		 * The latency of each frame is added as measurement '<tracker>.frame' to the benchmark.
+		 * @param osnFilename The filename of the recording, must be valid
+		 * @param tracker The name of the tracker, used as prefix of the measurements, must be valid
+		 * @param frameFunction The function processing each frame, must be valid
+		 * @param benchmark The benchmark object receiving the latency measurements
+		 * @param recordingResult The resulting result of the recording
+		 * @return True, if succeeded
+		 */
+		static bool replayRecording(const std::string& osnFilename, const std::string& tracker, const FrameFunction& frameFunction, Benchmark& benchmark, RecordingResult& recordingResult);
+
+		/**
+		 * Logs the result of one recording.
+		 * @param recordingResult The result to log
+		 */
+		static void logRecordingResult(const RecordingResult& recordingResult);
+
+		/**
+		 * Determines the errors between the relative camera rotations of successive frames of the tracker and of the ground truth.
+		 * Relative rotations are independent of the world coordinate systems and of the scale of the tracker so that no alignment is necessary.
+		 * @param world_T_cameras The camera poses of the tracker, one for each frame, invalid if unknown
+		 * @param groundTruth_world_T_cameras The ground truth camera poses, one for each frame, invalid if unknown
+		 * @return The rotation errors of all frame pairs with known poses, in degree
+		 */
+		static Scalars determineRelativeRotationErrors(const HomogenousMatrices4& world_T_cameras, const HomogenousMatrices4& groundTruth_world_T_cameras);
+
+	public:
+
+		/// The number of memory allocations the application has made so far.
+		static std::atomic<uint64_t> allocationCounter_;
+};
+
+inline uint64_t TrackerBenchmark::allocations()
+{
+	return allocationCounter_.load(std::memory_order_relaxed);
+}
+
+}
+
+}
+
+}
+
+}
+
+#endif // META_OCEAN_APPLICATION_OCEAN_DEMO_TRACKING_SLAM_BENCHMARK_TRACKER_BENCHMARK_H
@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "ocean/base/Build.h"
+#include "ocean/base/CommandArguments.h"
+#include "ocean/base/DateTime.h"
+#include "ocean/base/String.h"
+#include "ocean/base/Worker.h"
+
+#include "ocean/cv/CPUDispatch.h"
+
+#include "ocean/system/Process.h"
+
+#include "ocean/test/Benchmark.h"
+
+#include "ocean/test/benchmarkcv/BenchmarkCV.h"
+
+using namespace Ocean;
+
+#if defined(_WINDOWS)
+	// main function on Windows platforms
+	int wmain(int argc, wchar_t* argv[])
+#elif defined(__APPLE__) || defined(__linux__)
+	// main function on non-Windows platforms
+	int main(int argc, char* argv[])
+#else
+	#error Missing implementation.
+#endif
+{
+#ifdef OCEAN_COMPILER_MSC
+	// prevent the debugger to abort the application after an assert has been caught
+	_set_error_mode(_OUT_TO_MSGBOX);
+#endif
+
+#ifdef OCEAN_DEBUG
+	#warning Benchmarks should be executed with a release build.
+#endif
+
+	CommandArguments commandArguments;
+	commandArguments.registerParameter("functions", "f", "The optional subset of benchmarks to execute, e.g., \"frameconverter, frameshrinker.downsamplebytwo11\"");
+	commandArguments.registerParameter("output", "o", "The optional output file for the benchmark results, \".json\" for JSON, CSV otherwise, e.g., results.csv");
+	commandArguments.registerParameter("baseline", "b", "The optional CSV file with baseline results, e.g., baseline.csv");
+	commandArguments.registerParameter("tolerance", "t", "The relative tolerance before a benchmark counts as regression, e.g., 0.1", Value(0.1));
+	commandArguments.registerParameter("warmup", "w", "The number of warm-up iterations for each benchmark", Value(5));
+	commandArguments.registerParameter("repetitions", "r", "The number of measured repetitions for each benchmark", Value(50));
+	commandArguments.registerParameter("singlecore", "s", "Execute all benchmarks single-core only");
+	commandArguments.registerParameter("isa", "i", "The optional instruction set level to be used by the CV kernels, e.g., \"none\", \"sse4.1\", \"avx2\", \"avx512\", \"neon\"");
+	commandArguments.registerParameter("help", "h", "Show this help output");
+
+	commandArguments.parse(argv, size_t(argc));
+
+	if (commandArguments.hasValue("help", nullptr, false))
+	{
+		std::cout << "Ocean Framework benchmark for the CV library:" << std::endl << std::endl;
+		std::cout << commandArguments.makeSummary() << std::endl;
+		return 0;
+	}
+
+	const std::string functionList = commandArguments.value<std::string>("functions", "", false);
+	const std::string outputFilename = commandArguments.value<std::string>("output", "", false);
+	const std::string baselineFilename = commandArguments.value<std::string>("baseline", "", false);
+
+	const double tolerance = std::max(0.0, commandArguments.value<double>("tolerance", 0.1, true));
+	const int warmupIterations = std::max(0, commandArguments.value<int>("warmup", 5, true));
+	const int repetitions = std::max(1, commandArguments.value<int>("repetitions", 50, true));
+
+	const bool singleCore = commandArguments.hasValue("singlecore");
+	const std::string isaLevelValue = commandArguments.value<std::string>("isa", "", false);
+
+	Messenger::get().setOutputType(Messenger::OUTPUT_STANDARD);
+
+	Log::info() << "Ocean Framework benchmark for the Computer Vision library:";
+	Log::info() << " ";
+	Log::info() << "Start: " << DateTime::stringDate() << ", " << DateTime::stringTime() << " UTC";
+	Log::info() << "Function list: " << (functionList.empty() ? "All functions" : functionList);
+
+	if (!isaLevelValue.empty())
+	{
+		CV::CPUDispatch::ISALevel isaLevel = CV::CPUDispatch::IL_NONE;
+
+		if (!CV::CPUDispatch::translateLevel(isaLevelValue, isaLevel) || !CV::CPUDispatch::forceLevel(isaLevel))
+		{
+			Log::error() << "The instruction set level '" << isaLevelValue << "' is not supported, the supported level is '" << CV::CPUDispatch::translateLevel(CV::CPUDispatch::supportedLevel()) << "'";
+			return 1;
+		}
+	}
+
+	Log::info() << "Instruction set level: " << CV::CPUDispatch::translateLevel(CV::CPUDispatch::level());
+	Log::info() << " ";
+
+	System::Process::setPriority(System::Process::PRIORITY_ABOVE_NORMAL);
+
+	Worker worker;
+
+	Test::Benchmark benchmark(Test::Benchmark::Configuration((unsigned int)(warmupIterations), (unsigned int)(repetitions), !singleCore));
+
+	Test::BenchmarkCV::benchmarkCV(benchmark, worker, functionList);
+
+	int resultValue = 0;
+
+	if (!outputFilename.empty())
+	{
+		if (benchmark.writeResults(outputFilename))
+		{
+			Log::info() << "Results written to '" << outputFilename << "'";
+		}
+		else
+		{
+			Log::error() << "Failed to write the results to '" << outputFilename << "'";
+			resultValue = 1;
+		}
+	}
+
+	if (!baselineFilename.empty())
+	{
+		Test::Benchmark::Results baselineResults;
+
+		if (Test::Benchmark::readCSV(baselineFilename, baselineResults))
+		{
+			const Test::Benchmark::Regressions regressions = Test::Benchmark::determineRegressions(benchmark.results(), baselineResults, tolerance);
+
+			if (regressions.empty())
+			{
+				Log::info() << "No regression in relation to the baseline '" << baselineFilename << "' (tolerance " << String::toAString(tolerance * 100.0, 1u) << "%)";
+			}
+			else
+			{
+				Log::info() << regressions.size() << " regression(s) in relation to the baseline '" << baselineFilename << "' (tolerance " << String::toAString(tolerance * 100.0, 1u) << "%):";
+
+				for (const Test::Benchmark::Regression& regression : regressions)
+				{
+					Log::info() << regression.current_.name_ << " (" << regression.current_.parameters_ << ", " << regression.current_.threads_ << " threads): " << String::toAString(regression.baseline_.medianMs_, 3u) << "ms -> " << String::toAString(regression.current_.medianMs_, 3u) << "ms (" << String::toAString(regression.ratio_, 2u) << "x)";
+				}
+
+				resultValue = 1;
+			}
+		}
+		else
+		{
+			Log::error() << "Failed to read the baseline '" << baselineFilename << "'";
+			resultValue = 1;
+		}
+	}
+
+	Log::info() << " ";
+	Log::info() << "End: " << DateTime::stringDate() << ", " << DateTime::stringTime() << " UTC";
+
+	return resultValue;
+}
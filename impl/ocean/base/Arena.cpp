@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "ocean/base/Arena.h"
+
+namespace Ocean
+{
+
+Arena::Arena(const size_t initialCapacity)
+{
+	blocks_.reserve(8);
+
+	if (initialCapacity != 0)
+	{
+		addBlock(initialCapacity);
+	}
+}
+
+void* Arena::allocate(const size_t bytes, const size_t alignment)
+{
+	ocean_assert(alignment != 0 && (alignment & (alignment - 1)) == 0);
+
+	for (unsigned int nAttempt = 0u; nAttempt < 2u; ++nAttempt)
+	{
+		if (!blocks_.empty())
+		{
+			const Block& block = blocks_.back();
+
+			const uintptr_t blockStart = uintptr_t(block.memory_.get());
+			const uintptr_t alignedPosition = (blockStart + offset_ + alignment - 1) & ~uintptr_t(alignment - 1);
+
+			const size_t newOffset = size_t(alignedPosition - blockStart) + bytes;
+
+			if (newOffset <= block.size_)
+			{
+				usedBytes_ += newOffset - offset_;
+				peakBytes_ = std::max(peakBytes_, usedBytes_);
+
+				offset_ = newOffset;
+
+				++pendingAllocations_;
+
+				return reinterpret_cast<void*>(alignedPosition);
+			}
+		}
+
+		// the current block is exhausted, the arena grows geometrically
+
+		addBlock(std::max(bytes + alignment, std::max(minimalBlockSize_, capacity_)));
+	}
+
+	ocean_assert(false && "This should never happen!");
+	return nullptr;
+}
+
+void Arena::deallocate(void* data, const size_t bytes)
+{
+	ocean_assert(pendingAllocations_ != 0);
+	--pendingAllocations_;
+
+	if (!blocks_.empty())
+	{
+		uint8_t* const blockPosition = blocks_.back().memory_.get() + offset_;
+
+		if (static_cast<uint8_t*>(data) + bytes == blockPosition && offset_ >= bytes)
+		{
+			// the memory is the most recent allocation, so that we can reuse it immediately
+
+			offset_ -= bytes;
+
+			ocean_assert(usedBytes_ >= bytes);
+			usedBytes_ -= bytes;
+		}
+	}
+}
+
+void Arena::reset()
+{
+	ocean_assert(pendingAllocations_ == 0 && "All containers using the arena must be disposed before the arena is reset!");
+
+	if (blocks_.size() > 1)
+	{
+		// we replace all blocks by one block so that the next frame fits into one block
+
+		const size_t capacity = capacity_;
+
+		blocks_.clear();
+		capacity_ = 0;
+
+		addBlock(capacity);
+	}
+
+	offset_ = 0;
+	usedBytes_ = 0;
+}
+
+void Arena::addBlock(const size_t size)
+{
+	ocean_assert(size != 0);
+
+	Block block;
+	block.memory_ = BlockMemory(new uint8_t[size]);
+	block.size_ = size;
+
+	blocks_.emplace_back(std::move(block));
+
+	capacity_ += size;
+	offset_ = 0;
+
+	++heapAllocations_;
+}
+
+}
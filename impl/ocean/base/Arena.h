@@ -0,0 +1,359 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#ifndef META_OCEAN_BASE_ARENA_H
+#define META_OCEAN_BASE_ARENA_H
+
+#include "ocean/base/Base.h"
+
+#include <memory>
+#include <scoped_allocator>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace Ocean
+{
+
+/**
+ * This class implements a bump allocator for temporary objects which are created and released at a high frequency, e.g., once for each camera frame.
+ * Memory is handed out by increasing an offset within a large block, individual allocations are not released; instead, the entire arena is reset at once.<br>
+ * Whenever the current block is exhausted, an additional block is allocated; the next reset replaces all blocks with one block providing the entire capacity.<br>
+ * Thus, after a short warm-up phase, an arena which is reset once per frame does not allocate any heap memory anymore.
+ *
+ * The arena is not thread-safe, each thread should use an own arena.<br>
+ * All containers using the arena must be disposed before the arena is reset.
+ *
+ * Here is a tutorial how to use this class:
+ * @code
+ * void Tracker::handleFrame()
+ * {
+ *     // all containers of the previous frame have been disposed
+ *     frameArena_.reset();
+ *
+ *     ArenaVector<Vector2> imagePoints(frameArena_);
+ *     imagePoints.reserve(expectedPoints);
+ *
+ *     ArenaUnorderedSet<Index32> pointIdSet(expectedPoints, frameArena_);
+ *     ...
+ * }
+ * @endcode
+ * @see ArenaAllocator, ArenaVector.
+ * @ingroup base
+ */
+class OCEAN_BASE_EXPORT Arena
+{
+	protected:
+
+		/**
+		 * Definition of a unique pointer holding the memory of a block.
+		 */
+		using BlockMemory = std::unique_ptr<uint8_t[]>;
+
+		/**
+		 * This class holds one memory block of the arena.
+		 */
+		class Block
+		{
+			public:
+
+				/// The memory of the block.
+				BlockMemory memory_;
+
+				/// The size of the block in bytes.
+				size_t size_ = 0;
+		};
+
+		/**
+		 * Definition of a vector holding blocks.
+		 */
+		using Blocks = std::vector<Block>;
+
+	public:
+
+		/**
+		 * Creates a new arena.
+		 * @param initialCapacity The capacity of the first block in bytes, 0 to allocate the first block with the first allocation
+		 */
+		explicit Arena(const size_t initialCapacity = 0);
+
+		/**
+		 * Allocates memory from the arena.
+		 * @param bytes The number of bytes to allocate, with range [0, infinity)
+		 * @param alignment The alignment of the memory in bytes, must be a power of two
+		 * @return The allocated memory
+		 */
+		void* allocate(const size_t bytes, const size_t alignment);
+
+		/**
+		 * Releases memory which has been allocated from the arena.
+		 * The memory is reused only if it is the most recent allocation, otherwise the memory is reused after the next reset.
+		 * @param data The memory to release, must have been allocated from this arena
+		 * @param bytes The number of bytes which have been allocated, with range [0, infinity)
+		 */
+		void deallocate(void* data, const size_t bytes);
+
+		/**
+		 * Resets the arena so that the entire memory can be reused.
+		 * All memory which has been allocated from the arena must have been released before.<br>
+		 * In case the arena needed several blocks since the last reset, the blocks are replaced by one block with the entire capacity.
+		 */
+		void reset();
+
+		/**
+		 * Returns the number of bytes which have been allocated since the last reset, including alignment padding.
+		 * @return The used bytes
+		 */
+		inline size_t usedBytes() const;
+
+		/**
+		 * Returns the maximal number of bytes which have been used between two resets.
+		 * @return The peak bytes
+		 */
+		inline size_t peakBytes() const;
+
+		/**
+		 * Returns the overall capacity of all blocks of the arena.
+		 * @return The capacity in bytes
+		 */
+		inline size_t capacity() const;
+
+		/**
+		 * Returns the number of heap allocations the arena has made since it has been created.
+		 * This number does not change anymore once the arena has reached a steady state.
+		 * @return The number of allocated blocks
+		 */
+		inline size_t heapAllocations() const;
+
+	protected:
+
+		/**
+		 * Disabled copy constructor.
+		 */
+		Arena(const Arena&) = delete;
+
+		/**
+		 * Disabled copy operator.
+		 * @return Reference to this object
+		 */
+		Arena& operator=(const Arena&) = delete;
+
+		/**
+		 * Adds a new block to the arena.
+		 * @param size The size of the new block in bytes, with range [1, infinity)
+		 */
+		void addBlock(const size_t size);
+
+	protected:
+
+		/// The blocks of the arena, the last block is the block from which memory is allocated.
+		Blocks blocks_;
+
+		/// The offset of the next allocation within the last block, in bytes.
+		size_t offset_ = 0;
+
+		/// The number of bytes which have been allocated since the last reset.
+		size_t usedBytes_ = 0;
+
+		/// The maximal number of bytes which have been used between two resets.
+		size_t peakBytes_ = 0;
+
+		/// The overall capacity of all blocks.
+		size_t capacity_ = 0;
+
+		/// The number of heap allocations.
+		size_t heapAllocations_ = 0;
+
+		/// The number of allocations which have not yet been released.
+		size_t pendingAllocations_ = 0;
+
+		/// The minimal size of a block in bytes.
+		static constexpr size_t minimalBlockSize_ = 4096;
+};
+
+/**
+ * This class implements an STL allocator which allocates memory from an arena.
+ * The allocator can be created implicitly from an arena, so that arena-backed containers can be created by simply providing the arena.
+ * @tparam T The data type of the elements to allocate
+ * @see Arena.
+ * @ingroup base
+ */
+template <typename T>
+class ArenaAllocator
+{
+	template <typename U>
+	friend class ArenaAllocator;
+
+	public:
+
+		/**
+		 * Definition of the data type of the elements to allocate.
+		 */
+		using value_type = T;
+
+	public:
+
+		/**
+		 * Creates a new allocator for an arena.
+		 * @param arena The arena from which the memory will be allocated, must be valid as long as the allocator exists
+		 */
+		inline ArenaAllocator(Arena& arena) noexcept;
+
+		/**
+		 * Creates a new allocator for the same arena as a given allocator of another type.
+		 * @param allocator The allocator providing the arena
+		 * @tparam U The data type of the elements of the other allocator
+		 */
+		template <typename U>
+		inline ArenaAllocator(const ArenaAllocator<U>& allocator) noexcept;
+
+		/**
+		 * Allocates memory for several elements.
+		 * @param size The number of elements, with range [0, infinity)
+		 * @return The allocated memory
+		 */
+		inline T* allocate(const size_t size);
+
+		/**
+		 * Releases memory of several elements.
+		 * @param elements The elements to release, must have been allocated by an allocator of the same arena
+		 * @param size The number of elements, with range [0, infinity)
+		 */
+		inline void deallocate(T* elements, const size_t size) noexcept;
+
+		/**
+		 * Returns the arena of this allocator.
+		 * @return The allocator's arena
+		 */
+		inline Arena& arena() const noexcept;
+
+		/**
+		 * Returns whether two allocators use the same arena.
+		 * @param allocator The second allocator
+		 * @return True, if so
+		 * @tparam U The data type of the elements of the second allocator
+		 */
+		template <typename U>
+		inline bool operator==(const ArenaAllocator<U>& allocator) const noexcept;
+
+		/**
+		 * Returns whether two allocators use different arenas.
+		 * @param allocator The second allocator
+		 * @return True, if so
+		 * @tparam U The data type of the elements of the second allocator
+		 */
+		template <typename U>
+		inline bool operator!=(const ArenaAllocator<U>& allocator) const noexcept;
+
+	protected:
+
+		/// The arena from which the memory is allocated.
+		Arena* arena_ = nullptr;
+};
+
+/**
+ * Definition of a vector with elements allocated from an arena.
+ * @tparam T The data type of the elements
+ * @ingroup base
+ */
+template <typename T>
+using ArenaVector = std::vector<T, ArenaAllocator<T>>;
+
+/**
+ * Definition of an unordered set with elements allocated from an arena.
+ * @tparam T The data type of the elements
+ * @ingroup base
+ */
+template <typename T>
+using ArenaUnorderedSet = std::unordered_set<T, std::hash<T>, std::equal_to<T>, ArenaAllocator<T>>;
+
+/**
+ * Definition of an unordered map with elements allocated from an arena.
+ * The arena is forwarded to the values, so that values can be arena-backed containers as well, e.g., ArenaUnorderedMap<Index32, ArenaVector<Index32>>.
+ * @tparam TKey The data type of the keys
+ * @tparam TValue The data type of the values
+ * @ingroup base
+ */
+template <typename TKey, typename TValue>
+using ArenaUnorderedMap = std::unordered_map<TKey, TValue, std::hash<TKey>, std::equal_to<TKey>, std::scoped_allocator_adaptor<ArenaAllocator<std::pair<const TKey, TValue>>>>;
+
+inline size_t Arena::usedBytes() const
+{
+	return usedBytes_;
+}
+
+inline size_t Arena::peakBytes() const
+{
+	return peakBytes_;
+}
+
+inline size_t Arena::capacity() const
+{
+	return capacity_;
+}
+
+inline size_t Arena::heapAllocations() const
+{
+	return heapAllocations_;
+}
+
+template <typename T>
+inline ArenaAllocator<T>::ArenaAllocator(Arena& arena) noexcept :
+	arena_(&arena)
+{
+	// nothing to do here
+}
+
+template <typename T>
+template <typename U>
+inline ArenaAllocator<T>::ArenaAllocator(const ArenaAllocator<U>& allocator) noexcept :
+	arena_(allocator.arena_)
+{
+	// nothing to do here
+}
+
+template <typename T>
+inline T* ArenaAllocator<T>::allocate(const size_t size)
+{
+	ocean_assert(arena_ != nullptr);
+
+	return static_cast<T*>(arena_->allocate(size * sizeof(T), alignof(T)));
+}
+
+template <typename T>
+inline void ArenaAllocator<T>::deallocate(T* elements, const size_t size) noexcept
+{
+	ocean_assert(arena_ != nullptr);
+
+	arena_->deallocate(elements, size * sizeof(T));
+}
+
+template <typename T>
+inline Arena& ArenaAllocator<T>::arena() const noexcept
+{
+	ocean_assert(arena_ != nullptr);
+
+	return *arena_;
+}
+
+template <typename T>
+template <typename U>
+inline bool ArenaAllocator<T>::operator==(const ArenaAllocator<U>& allocator) const noexcept
+{
+	return arena_ == allocator.arena_;
+}
+
+template <typename T>
+template <typename U>
+inline bool ArenaAllocator<T>::operator!=(const ArenaAllocator<U>& allocator) const noexcept
+{
+	return !(*this == allocator);
+}
+
+}
+
+#endif // META_OCEAN_BASE_ARENA_H
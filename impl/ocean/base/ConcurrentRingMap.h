@@ -0,0 +1,434 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#ifndef META_OCEAN_BASE_CONCURRENT_RING_MAP_H
+#define META_OCEAN_BASE_CONCURRENT_RING_MAP_H
+
+#include "ocean/base/Base.h"
+#include "ocean/base/Lock.h"
+#include "ocean/base/RingMap.h"
+
+#include <atomic>
+#include <functional>
+
+namespace Ocean
+{
+
+/**
+ * This class implements a thread-safe ring map for many concurrent threads.
+ * The map distributes the elements over several independent shards based on the hash of the keys, each shard is a RingMapT object with own lock.<br>
+ * Therefore, threads accessing elements in different shards do not block each other, while a thread-safe RingMapT object serializes all accesses.<br>
+ * The oldest element is replaced per shard (not globally) once the shard is full, so that the capacity of the map is rounded up to a multiple of the number of shards.<br>
+ * Accessing an element in an empty shard does not acquire any lock.<br>
+ * The map does not provide ordered keys, elements can be accessed with perfect match only.
+ * <pre>
+ * ConcurrentRingMapT<Index32, SharedFramePyramid> pyramidCache(64);
+ *
+ * // any thread
+ * pyramidCache.insertElement(frameIndex, framePyramid, true);
+ *
+ * // any other thread
+ * SharedFramePyramid framePyramid;
+ * if (pyramidCache.element(frameIndex, framePyramid))
+ * {
+ *     ...
+ * }
+ * </pre>
+ * @tparam TKey Data type of the map keys
+ * @tparam T Data type of the map elements
+ * @tparam tShards The number of shards, with range [1, infinity)
+ * @tparam THash The hash function for the keys
+ * @see RingMapT.
+ * @ingroup base
+ */
+template <typename TKey, typename T, unsigned int tShards = 16u, typename THash = std::hash<TKey>>
+class ConcurrentRingMapT
+{
+	static_assert(tShards >= 1u, "Invalid number of shards!");
+
+	public:
+
+		/**
+		 * The data type of the objects that are stored in this container.
+		 */
+		using Type = T;
+
+		/**
+		 * The data type of the keys that are used to address the data objects.
+		 */
+		using TypeKey = TKey;
+
+	protected:
+
+		/**
+		 * Definition of the (not thread-safe) ring map of each shard.
+		 */
+		using ShardRingMap = RingMapT<TKey, T, false, false>;
+
+		/**
+		 * This class implements one shard of the map.
+		 * Each shard is located in an own cache line to avoid false sharing between the locks of neighboring shards.
+		 */
+		class alignas(64) Shard
+		{
+			public:
+
+				/// The ring map of this shard.
+				ShardRingMap ringMap_;
+
+				/// The number of elements in this shard, can be read without lock.
+				std::atomic<size_t> size_ = 0;
+
+				/// The lock of this shard.
+				mutable Lock lock_;
+		};
+
+	public:
+
+		/**
+		 * Creates a new map with no capacity.
+		 */
+		ConcurrentRingMapT() = default;
+
+		/**
+		 * Creates a new map with a specified capacity.
+		 * @param capacity The capacity of the map, will be rounded up to a multiple of the number of shards, with range [0, infinity)
+		 */
+		explicit inline ConcurrentRingMapT(const size_t capacity);
+
+		/**
+		 * Returns the capacity of this map.
+		 * @return The capacity, a multiple of the number of shards
+		 */
+		inline size_t capacity() const;
+
+		/**
+		 * Returns the number of elements that are currently stored in this map.
+		 * The result is not synchronized with concurrent modifications.
+		 * @return Number of elements, with range [0, capacity()]
+		 */
+		inline size_t size() const;
+
+		/**
+		 * Sets or changes the capacity of this map.
+		 * @param capacity The capacity to be set, will be rounded up to a multiple of the number of shards, with range [0, infinity)
+		 */
+		void setCapacity(const size_t capacity);
+
+		/**
+		 * Inserts a new element into this map.
+		 * @param key The key of the new element
+		 * @param element The element that will be inserted
+		 * @param forceOverwrite True, to overwrite an existing element with some key, False to avoid that an element is inserted if an element with same key exists already
+		 * @return True, if the element has been inserted
+		 */
+		inline bool insertElement(const TKey& key, const T& element, const bool forceOverwrite = false);
+
+		/**
+		 * Inserts a new element into this map.
+		 * This function moves the new element.
+		 * @param key The key of the new element
+		 * @param element The element that will be inserted
+		 * @param forceOverwrite True, to overwrite an existing element with some key, False to avoid that an element is inserted if an element with same key exists already
+		 * @return True, if the element has been inserted
+		 */
+		bool insertElement(const TKey& key, T&& element, const bool forceOverwrite = false);
+
+		/**
+		 * Returns an element of this map.
+		 * @param key The key of the element to be returned
+		 * @param element Resulting element
+		 * @return True, if the requested element exists
+		 * @see checkoutElement().
+		 */
+		bool element(const TKey& key, T& element) const;
+
+		/**
+		 * Returns an element of this map and removes the element from the map.
+		 * @param key The key of the element to be returned
+		 * @param element Resulting element
+		 * @return True, if the requested element exists
+		 * @see element().
+		 */
+		bool checkoutElement(const TKey& key, T& element);
+
+		/**
+		 * Returns whether this map holds a specific element.
+		 * @param key The key of the element that is checked
+		 * @return True, if so
+		 */
+		bool hasElement(const TKey& key) const;
+
+		/**
+		 * Checks whether a specified element exists and makes the element the newest element of its shard.
+		 * @param key The key of the element that will be refreshed
+		 * @return True, if the element exists
+		 */
+		bool refreshElement(const TKey& key);
+
+		/**
+		 * Returns all elements of this map as a vector.
+		 * The shards are accessed one after another, so that the result is not a snapshot if the map is modified concurrently.
+		 * @return The map's elements
+		 */
+		std::vector<T> elements() const;
+
+		/**
+		 * Clears all elements of this map.
+		 */
+		void clear();
+
+		/**
+		 * Returns whether this map holds at least one element.
+		 * @return True, if so
+		 */
+		inline bool isEmpty() const;
+
+		/**
+		 * Returns the number of shards of this map.
+		 * @return The number of shards
+		 */
+		static constexpr unsigned int numberShards();
+
+	protected:
+
+		/**
+		 * Returns the shard of a key.
+		 * @param key The key for which the shard will be returned
+		 * @return The key's shard
+		 */
+		inline Shard& shard(const TKey& key);
+
+		/**
+		 * Returns the shard of a key.
+		 * @param key The key for which the shard will be returned
+		 * @return The key's shard
+		 */
+		inline const Shard& shard(const TKey& key) const;
+
+		/**
+		 * Returns the capacity of each shard for a given capacity of the entire map.
+		 * @param capacity The capacity of the entire map, with range [0, infinity)
+		 * @return The capacity of each shard
+		 */
+		static constexpr size_t shardCapacity(const size_t capacity);
+
+	protected:
+
+		/// The shards of this map.
+		Shard shards_[tShards];
+};
+
+template <typename TKey, typename T, unsigned int tShards, typename THash>
+inline ConcurrentRingMapT<TKey, T, tShards, THash>::ConcurrentRingMapT(const size_t capacity)
+{
+	const size_t capacityPerShard = shardCapacity(capacity);
+
+	for (Shard& shard : shards_)
+	{
+		shard.ringMap_.setCapacity(capacityPerShard);
+	}
+}
+
+template <typename TKey, typename T, unsigned int tShards, typename THash>
+inline size_t ConcurrentRingMapT<TKey, T, tShards, THash>::capacity() const
+{
+	const ScopedLock scopedLock(shards_[0].lock_);
+
+	return shards_[0].ringMap_.capacity() * size_t(tShards);
+}
+
+template <typename TKey, typename T, unsigned int tShards, typename THash>
+inline size_t ConcurrentRingMapT<TKey, T, tShards, THash>::size() const
+{
+	size_t result = 0;
+
+	for (const Shard& shard : shards_)
+	{
+		result += shard.size_.load(std::memory_order_relaxed);
+	}
+
+	return result;
+}
+
+template <typename TKey, typename T, unsigned int tShards, typename THash>
+void ConcurrentRingMapT<TKey, T, tShards, THash>::setCapacity(const size_t capacity)
+{
+	const size_t capacityPerShard = shardCapacity(capacity);
+
+	for (Shard& shard : shards_)
+	{
+		const ScopedLock scopedLock(shard.lock_);
+
+		shard.ringMap_.setCapacity(capacityPerShard);
+		shard.size_.store(shard.ringMap_.size(), std::memory_order_release);
+	}
+}
+
+template <typename TKey, typename T, unsigned int tShards, typename THash>
+inline bool ConcurrentRingMapT<TKey, T, tShards, THash>::insertElement(const TKey& key, const T& element, const bool forceOverwrite)
+{
+	T copyElement(element);
+
+	return insertElement(key, std::move(copyElement), forceOverwrite);
+}
+
+template <typename TKey, typename T, unsigned int tShards, typename THash>
+bool ConcurrentRingMapT<TKey, T, tShards, THash>::insertElement(const TKey& key, T&& element, const bool forceOverwrite)
+{
+	Shard& keyShard = shard(key);
+
+	const ScopedLock scopedLock(keyShard.lock_);
+
+	if (!keyShard.ringMap_.insertElement(key, std::move(element), forceOverwrite))
+	{
+		return false;
+	}
+
+	keyShard.size_.store(keyShard.ringMap_.size(), std::memory_order_release);
+
+	return true;
+}
+
+template <typename TKey, typename T, unsigned int tShards, typename THash>
+bool ConcurrentRingMapT<TKey, T, tShards, THash>::element(const TKey& key, T& element) const
+{
+	const Shard& keyShard = shard(key);
+
+	if (keyShard.size_.load(std::memory_order_acquire) == 0)
+	{
+		return false;
+	}
+
+	const ScopedLock scopedLock(keyShard.lock_);
+
+	return keyShard.ringMap_.element(key, element);
+}
+
+template <typename TKey, typename T, unsigned int tShards, typename THash>
+bool ConcurrentRingMapT<TKey, T, tShards, THash>::checkoutElement(const TKey& key, T& element)
+{
+	Shard& keyShard = shard(key);
+
+	if (keyShard.size_.load(std::memory_order_acquire) == 0)
+	{
+		return false;
+	}
+
+	const ScopedLock scopedLock(keyShard.lock_);
+
+	if (!keyShard.ringMap_.checkoutElement(key, element))
+	{
+		return false;
+	}
+
+	keyShard.size_.store(keyShard.ringMap_.size(), std::memory_order_release);
+
+	return true;
+}
+
+template <typename TKey, typename T, unsigned int tShards, typename THash>
+bool ConcurrentRingMapT<TKey, T, tShards, THash>::hasElement(const TKey& key) const
+{
+	const Shard& keyShard = shard(key);
+
+	if (keyShard.size_.load(std::memory_order_acquire) == 0)
+	{
+		return false;
+	}
+
+	const ScopedLock scopedLock(keyShard.lock_);
+
+	return keyShard.ringMap_.hasElement(key);
+}
+
+template <typename TKey, typename T, unsigned int tShards, typename THash>
+bool ConcurrentRingMapT<TKey, T, tShards, THash>::refreshElement(const TKey& key)
+{
+	Shard& keyShard = shard(key);
+
+	if (keyShard.size_.load(std::memory_order_acquire) == 0)
+	{
+		return false;
+	}
+
+	const ScopedLock scopedLock(keyShard.lock_);
+
+	return keyShard.ringMap_.refreshElement(key);
+}
+
+template <typename TKey, typename T, unsigned int tShards, typename THash>
+std::vector<T> ConcurrentRingMapT<TKey, T, tShards, THash>::elements() const
+{
+	std::vector<T> result;
+	result.reserve(size());
+
+	for (const Shard& shard : shards_)
+	{
+		if (shard.size_.load(std::memory_order_acquire) == 0)
+		{
+			continue;
+		}
+
+		const ScopedLock scopedLock(shard.lock_);
+
+		std::vector<T> shardElements = shard.ringMap_.elements();
+
+		for (T& shardElement : shardElements)
+		{
+			result.emplace_back(std::move(shardElement));
+		}
+	}
+
+	return result;
+}
+
+template <typename TKey, typename T, unsigned int tShards, typename THash>
+void ConcurrentRingMapT<TKey, T, tShards, THash>::clear()
+{
+	for (Shard& shard : shards_)
+	{
+		const ScopedLock scopedLock(shard.lock_);
+
+		shard.ringMap_.clear();
+		shard.size_.store(0, std::memory_order_release);
+	}
+}
+
+template <typename TKey, typename T, unsigned int tShards, typename THash>
+inline bool ConcurrentRingMapT<TKey, T, tShards, THash>::isEmpty() const
+{
+	return size() == 0;
+}
+
+template <typename TKey, typename T, unsigned int tShards, typename THash>
+constexpr unsigned int ConcurrentRingMapT<TKey, T, tShards, THash>::numberShards()
+{
+	return tShards;
+}
+
+template <typename TKey, typename T, unsigned int tShards, typename THash>
+inline typename ConcurrentRingMapT<TKey, T, tShards, THash>::Shard& ConcurrentRingMapT<TKey, T, tShards, THash>::shard(const TKey& key)
+{
+	return shards_[THash()(key) % size_t(tShards)];
+}
+
+template <typename TKey, typename T, unsigned int tShards, typename THash>
+inline const typename ConcurrentRingMapT<TKey, T, tShards, THash>::Shard& ConcurrentRingMapT<TKey, T, tShards, THash>::shard(const TKey& key) const
+{
+	return shards_[THash()(key) % size_t(tShards)];
+}
+
+template <typename TKey, typename T, unsigned int tShards, typename THash>
+constexpr size_t ConcurrentRingMapT<TKey, T, tShards, THash>::shardCapacity(const size_t capacity)
+{
+	return (capacity + size_t(tShards) - 1) / size_t(tShards);
+}
+
+}
+
+#endif // META_OCEAN_BASE_CONCURRENT_RING_MAP_H
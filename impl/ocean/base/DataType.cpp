@@ -10,6 +10,80 @@
 namespace Ocean
 {
 
+Float16::Float16(const float value)
+{
+	static_assert(sizeof(uint32_t) == sizeof(float), "Invalid data type!");
+
+	uint32_t floatBinary;
+	memcpy(&floatBinary, &value, sizeof(floatBinary));
+
+	const uint16_t sign = uint16_t((floatBinary >> 31u) << 15u);
+	const uint32_t floatExponent = (floatBinary >> 23u) & 0xFFu;
+	uint32_t floatMantissa = floatBinary & 0x7FFFFFu;
+
+	if (floatExponent == 0xFFu)
+	{
+		// infinity or NaN, NaN keeps a non-zero fraction
+
+		data_.binary_ = uint16_t(sign | 0x7C00u | (floatMantissa != 0u ? 0x0200u : 0x0000u));
+		return;
+	}
+
+	const int exponent = int(floatExponent) - 127 + 15;
+
+	if (exponent >= 31)
+	{
+		// the value is too large, +/- infinity
+
+		data_.binary_ = uint16_t(sign | 0x7C00u);
+		return;
+	}
+
+	if (exponent <= 0)
+	{
+		if (exponent < -10)
+		{
+			// the value is too small even for a subnormal 16-bit float, +/- zero
+
+			data_.binary_ = sign;
+			return;
+		}
+
+		// subnormal 16-bit float, the implicit leading one of the 32-bit float becomes explicit
+
+		floatMantissa |= 0x800000u;
+
+		const unsigned int shift = (unsigned int)(14 - exponent);
+		ocean_assert(shift >= 14u && shift <= 24u);
+
+		uint32_t fraction = floatMantissa >> shift;
+
+		const uint32_t remainder = floatMantissa & ((1u << shift) - 1u);
+		const uint32_t halfway = 1u << (shift - 1u);
+
+		if (remainder > halfway || (remainder == halfway && (fraction & 1u) != 0u))
+		{
+			// a carry into the exponent results in the smallest normal 16-bit float, which is correct
+			++fraction;
+		}
+
+		data_.binary_ = uint16_t(sign | fraction);
+		return;
+	}
+
+	uint32_t binary = (uint32_t(exponent) << 10u) | (floatMantissa >> 13u);
+
+	const uint32_t remainder = floatMantissa & 0x1FFFu;
+
+	if (remainder > 0x1000u || (remainder == 0x1000u && (binary & 1u) != 0u))
+	{
+		// a carry into the exponent is correct, also if the result becomes infinity
+		++binary;
+	}
+
+	data_.binary_ = uint16_t(sign | binary);
+}
+
 Float16::operator float() const
 {
 	if (data_.ieee_.exponent_ == 0u)
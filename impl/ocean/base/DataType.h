@@ -567,6 +567,13 @@ class OCEAN_BASE_EXPORT Float16
 		 */
 		explicit inline Float16(const uint16_t binary);
 
+		/**
+		 * Creates a new 16-bit float based on a 32-bit float value.
+		 * The value is rounded to the nearest representable 16-bit float (ties to even), values outside the 16-bit float range result in +/- infinity.
+		 * @param value The 32-bit float value to be converted
+		 */
+		explicit Float16(const float value);
+
 		/**
 		 * Returns the binary representation of this 16-bit float value.
 		 * @return The value's binary representation
@@ -1576,7 +1583,7 @@ inline Float16 Float16::infinity()
 {
 	constexpr uint16_t maxExponent = 31u;
 
-	return Float16(0u, maxExponent, 0u);
+	return Float16(0u, 0u, maxExponent);
 }
 
 }
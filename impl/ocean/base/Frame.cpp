@@ -6,6 +6,7 @@
  */
 
 #include "ocean/base/Frame.h"
+#include "ocean/base/MemoryPool.h"
 #include "ocean/base/Messenger.h"
 #include "ocean/base/String.h"
 
@@ -2190,7 +2191,7 @@ Frame::Plane::Plane(const unsigned int width, const unsigned int height, const u
 	ocean_assert(channels_ != 0u);
 	ocean_assert(elementTypeSize_ != 0u);
 
-	allocatedData_ = alignedMemory(size(), elementTypeSize, data_);
+	allocatedData_ = alignedMemory(size(), elementTypeSize, data_, poolCapacity_);
 	allocatedCapacity_ = size();
 	constData_ = data_;
 
@@ -2263,7 +2264,7 @@ Frame::Plane::Plane(const unsigned int width, const unsigned int height, const u
 
 	ocean_assert(elementTypeSize >= 1u);
 
-	allocatedData_ = alignedMemory(size(), elementTypeSize, data_);
+	allocatedData_ = alignedMemory(size(), elementTypeSize, data_, poolCapacity_);
 	allocatedCapacity_ = size();
 	constData_ = data_;
 
@@ -2313,7 +2314,7 @@ Frame::Plane::Plane(const unsigned int width, const unsigned int height, const u
 
 		// all three copy modes copy the memory
 
-		allocatedData_ = alignedMemory(size(), elementTypeSize, data_);
+		allocatedData_ = alignedMemory(size(), elementTypeSize, data_, poolCapacity_);
 		allocatedCapacity_ = size();
 		constData_ = data_;
 
@@ -2336,11 +2337,33 @@ void Frame::Plane::release()
 {
 	if (allocatedData_ != nullptr)
 	{
-		free(allocatedData_);
+		ReferenceCounter* referenceCounter = referenceCounter_.load(std::memory_order_acquire);
+
+		// the memory is freed by the last plane using the memory
+
+		if (referenceCounter == nullptr || referenceCounter->fetch_sub(1u, std::memory_order_acq_rel) == 1u)
+		{
+			delete referenceCounter;
+
+			MemoryTracker::deallocate(memoryCategoryId(), allocatedCapacity_);
+
+			if (poolCapacity_ != 0)
+			{
+				MemoryPool::get().free(allocatedData_, poolCapacity_);
+			}
+			else
+			{
+				free(allocatedData_);
+			}
+		}
+
+		referenceCounter_.store(nullptr, std::memory_order_release);
+
 		allocatedData_ = nullptr;
 	}
 
 	allocatedCapacity_ = 0u;
+	poolCapacity_ = 0;
 
 	constData_ = nullptr;
 	data_ = nullptr;
@@ -2385,6 +2408,22 @@ bool Frame::Plane::copy(const Plane& sourcePlane, const AdvancedCopyMode advance
 		strideBytes_ = sourcePlane.strideBytes_;
 		bytesPerPixel_ = sourcePlane.bytesPerPixel_;
 
+		if (sourcePlane.isShared())
+		{
+			// the memory is used by several planes, so that the plane must not modify the memory
+			data_ = nullptr;
+		}
+
+		return true;
+	}
+
+	if (advancedCopyMode == ACM_SHARE_OR_COPY_KEEP_LAYOUT && sourcePlane.isOwner())
+	{
+		// ACM_SHARE_OR_COPY_KEEP_LAYOUT
+		// The source memory is shared if the source is owner of the memory.
+
+		share(sourcePlane);
+
 		return true;
 	}
 
@@ -2399,7 +2438,7 @@ bool Frame::Plane::copy(const Plane& sourcePlane, const AdvancedCopyMode advance
 
 	const unsigned int newMemorySize = newStrideBytes * sourcePlane.height_;
 
-	if (newMemorySize > allocatedCapacity_ || !isOwner() || isReadOnly())
+	if (newMemorySize > allocatedCapacity_ || !isOwner() || isReadOnly() || isShared())
 	{
 		if (reallocateIfNecessary)
 		{
@@ -2422,7 +2461,7 @@ bool Frame::Plane::copy(const Plane& sourcePlane, const AdvancedCopyMode advance
 	if (allocatedData_ == nullptr)
 	{
 		data_ = nullptr;
-		allocatedData_ = alignedMemory(newMemorySize, elementTypeSize_, data_);
+		allocatedData_ = alignedMemory(newMemorySize, elementTypeSize_, data_, poolCapacity_);
 
 		if (allocatedData_ == nullptr)
 		{
@@ -2491,6 +2530,16 @@ bool Frame::Plane::copy(const Plane& sourcePlane, const AdvancedCopyMode advance
 				break;
 			}
 
+			case ACM_SHARE_OR_COPY_KEEP_LAYOUT:
+			{
+				// The source memory is copied if the source is not owner of the memory, padding layout is preserved, but padding data is not copied.
+
+				ocean_assert(!sourcePlane.isOwner());
+
+				debugMakeCopyOfPaddingData = false;
+				break;
+			}
+
 			case ACM_USE_KEEP_LAYOUT:
 			default:
 			{
@@ -2532,6 +2581,8 @@ Frame::Plane& Frame::Plane::operator=(Plane&& plane) noexcept
 
 		allocatedData_ = plane.allocatedData_;
 		allocatedCapacity_ = plane.allocatedCapacity_;
+		poolCapacity_ = plane.poolCapacity_;
+		referenceCounter_.store(plane.referenceCounter_.load(std::memory_order_acquire), std::memory_order_release);
 		constData_ = plane.constData_;
 		data_ = plane.data_;
 
@@ -2545,6 +2596,8 @@ Frame::Plane& Frame::Plane::operator=(Plane&& plane) noexcept
 
 		plane.allocatedData_ = nullptr;
 		plane.allocatedCapacity_ = 0u;
+		plane.poolCapacity_ = 0;
+		plane.referenceCounter_.store(nullptr, std::memory_order_release);
 		plane.constData_ = nullptr;
 		plane.data_ = nullptr;
 
@@ -2589,6 +2642,158 @@ void* Frame::Plane::alignedMemory(const size_t size, const size_t alignment, voi
 	return nullptr;
 }
 
+void* Frame::Plane::alignedMemory(const size_t size, const size_t alignment, void*& alignedData, size_t& poolCapacity)
+{
+	ocean_assert(alignment >= size_t(1));
+
+	poolCapacity = 0;
+
+	if (size != size_t(0))
+	{
+		void* allocatedData = MemoryPool::isEnabled() ? MemoryPool::get().allocate(size + alignment, poolCapacity) : malloc(size + alignment);
+		ocean_assert(allocatedData != nullptr);
+
+		if (allocatedData != nullptr)
+		{
+			MemoryTracker::allocate(memoryCategoryId(), size);
+
+			const size_t alignmentOffset = (alignment - (size_t(allocatedData) % alignment)) % alignment;
+
+			ocean_assert(alignmentOffset < alignment);
+			ocean_assert((size_t(allocatedData) + alignmentOffset) % alignment == size_t(0));
+
+			alignedData = (void*)(((uint8_t*)allocatedData) + alignmentOffset);
+			ocean_assert(alignedData >= allocatedData);
+
+			return allocatedData;
+		}
+	}
+
+	alignedData = nullptr;
+	return nullptr;
+}
+
+MemoryTracker::CategoryId Frame::Plane::memoryCategoryId()
+{
+	static const MemoryTracker::CategoryId categoryId = MemoryTracker::registerCategory("Frame");
+
+	return categoryId;
+}
+
+void Frame::Plane::share(const Plane& sourcePlane)
+{
+	ocean_assert(sourcePlane.isOwner());
+
+	if (allocatedData_ == sourcePlane.allocatedData_)
+	{
+		// both planes share the memory already
+		return;
+	}
+
+	// the reference is added before this plane is released, as this plane may hold the last reference of a plane sharing the same memory
+
+	ReferenceCounter& referenceCounter = sourcePlane.referenceCounter();
+	referenceCounter.fetch_add(1u, std::memory_order_relaxed);
+
+	release();
+
+	allocatedData_ = sourcePlane.allocatedData_;
+	allocatedCapacity_ = sourcePlane.allocatedCapacity_;
+	poolCapacity_ = sourcePlane.poolCapacity_;
+	referenceCounter_.store(&referenceCounter, std::memory_order_release);
+	constData_ = sourcePlane.constData_;
+	data_ = sourcePlane.data_;
+
+	width_ = sourcePlane.width_;
+	height_ = sourcePlane.height_;
+	channels_ = sourcePlane.channels_;
+	elementTypeSize_ = sourcePlane.elementTypeSize_;
+	paddingElements_ = sourcePlane.paddingElements_;
+	strideBytes_ = sourcePlane.strideBytes_;
+	bytesPerPixel_ = sourcePlane.bytesPerPixel_;
+
+	ocean_assert(isShared());
+}
+
+bool Frame::Plane::makeExclusive()
+{
+	ocean_assert(isOwner() && !isReadOnly());
+
+	ReferenceCounter* referenceCounter = referenceCounter_.load(std::memory_order_acquire);
+	ocean_assert(referenceCounter != nullptr);
+
+	const unsigned int memorySize = size();
+
+	void* newData = nullptr;
+	size_t newPoolCapacity = 0;
+	void* newAllocatedData = alignedMemory(memorySize, elementTypeSize_, newData, newPoolCapacity);
+
+	if (newAllocatedData == nullptr)
+	{
+		ocean_assert(false && "Out of memory!");
+		return false;
+	}
+
+	memcpy(newData, constData_, memorySize);
+
+	// the plane releases the shared memory, the memory may have become exclusive in the meantime
+
+	if (referenceCounter->fetch_sub(1u, std::memory_order_acq_rel) == 1u)
+	{
+		delete referenceCounter;
+
+		MemoryTracker::deallocate(memoryCategoryId(), allocatedCapacity_);
+
+		if (poolCapacity_ != 0)
+		{
+			MemoryPool::get().free(allocatedData_, poolCapacity_);
+		}
+		else
+		{
+			free(allocatedData_);
+		}
+	}
+
+	referenceCounter_.store(nullptr, std::memory_order_release);
+
+	allocatedData_ = newAllocatedData;
+	allocatedCapacity_ = memorySize;
+	poolCapacity_ = newPoolCapacity;
+	constData_ = newData;
+	data_ = newData;
+
+	return true;
+}
+
+Frame::Plane::ReferenceCounter& Frame::Plane::referenceCounter() const
+{
+	ocean_assert(isOwner());
+
+	ReferenceCounter* referenceCounter = referenceCounter_.load(std::memory_order_acquire);
+
+	if (referenceCounter == nullptr)
+	{
+		// the counter is created on demand, several threads may share the same (const) plane concurrently
+
+		ReferenceCounter* newReferenceCounter = new ReferenceCounter(1u);
+
+		if (referenceCounter_.compare_exchange_strong(referenceCounter, newReferenceCounter, std::memory_order_acq_rel, std::memory_order_acquire))
+		{
+			referenceCounter = newReferenceCounter;
+		}
+		else
+		{
+			// another thread was faster, 'referenceCounter' holds the counter of the other thread
+
+			delete newReferenceCounter;
+		}
+	}
+
+	ocean_assert(referenceCounter != nullptr);
+
+	return *referenceCounter;
+}
+
 void Frame::Plane::copy(const void* sourceData, const unsigned int sourceStrideBytes, const unsigned int sourcePaddingElements, const bool makeCopyOfPaddingData)
 {
 	ocean_assert(isValid());
@@ -2879,6 +3084,12 @@ bool Frame::copy(const int targetLeft, const int targetTop, const Frame& source,
 		return false;
 	}
 
+	if (!makeWritable())
+	{
+		ocean_assert(false && "The frame is not writable!");
+		return false;
+	}
+
 	if (copyTimestamp)
 	{
 		timestamp_ = source.timestamp_;
@@ -3028,7 +3239,9 @@ bool Frame::set(const FrameType& frameType, const bool forceOwner, const bool fo
 
 	if (forceWritable)
 	{
-		if (isReadOnly())
+		// a frame sharing its memory would need to copy the memory before writing
+
+		if (isReadOnly() || isShared())
 		{
 			needsReallocation = true;
 		}
@@ -3127,6 +3340,24 @@ void Frame::makeOwner()
 	}
 }
 
+bool Frame::makeWritable()
+{
+	if (isReadOnly())
+	{
+		return false;
+	}
+
+	for (Plane& plane : planes_)
+	{
+		if (plane.isShared() && !plane.makeExclusive())
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
 Frame Frame::subFrame(const unsigned int subFrameLeft, const unsigned int subFrameTop, const unsigned int subFrameWidth, const unsigned int subFrameHeight, const CopyMode copyMode) const
 {
 	if (isValid() == false)
@@ -3237,6 +3468,11 @@ bool Frame::setValue(const uint8_t value, const unsigned int planeIndex, const b
 		return false;
 	}
 
+	if (plane.isShared() && !plane.makeExclusive())
+	{
+		return false;
+	}
+
 	if (plane.paddingElements_ == 0u || skipPaddingData == false)
 	{
 		memset(plane.data<void>(), value, plane.size());
@@ -10,10 +10,12 @@
 
 #include "ocean/base/Base.h"
 #include "ocean/base/DataType.h"
+#include "ocean/base/MemoryTracker.h"
 #include "ocean/base/ObjectRef.h"
 #include "ocean/base/StackHeapVector.h"
 #include "ocean/base/Timestamp.h"
 
+#include <atomic>
 #include <type_traits>
 
 namespace Ocean
@@ -1873,6 +1875,9 @@ using FrameRefs = std::vector<FrameRef>;
  * |              |                        |
  *  -------------- ------------------------
  * </pre>
+ * Frames owning their memory can share the memory with copies created with ACM_SHARE_OR_COPY_KEEP_LAYOUT.<br>
+ * The shared memory is reference counted, a frame which may share its memory must be made writable via makeWritable() before the memory is modified (copy-on-write).<br>
+ * The accessors data(), row(), and pixel() do not copy shared memory, so that they stay cheap and can be used concurrently, e.g., by several worker threads.
  * @ingroup base
  */
 class OCEAN_BASE_EXPORT Frame : public FrameType
@@ -1912,6 +1917,8 @@ class OCEAN_BASE_EXPORT Frame : public FrameType
 			ACM_USE_OR_COPY = ACM_USE_KEEP_LAYOUT | ACM_COPY_REMOVE_PADDING_LAYOUT,
 			/// The source memory is used if the source is not owner of the memory; The source memory is copied if the source is owner of the memory, padding layout is preserved, but padding data is not copied.
 			ACM_USE_OR_COPY_KEEP_LAYOUT = ACM_USE_KEEP_LAYOUT | ACM_COPY_KEEP_LAYOUT_DO_NOT_COPY_PADDING_DATA,
+			/// The source memory is shared if the source is owner of the memory, the shared memory must be copied via makeWritable() before it is modified; The source memory is copied if the source is not owner of the memory, padding layout is preserved, but padding data is not copied.
+			ACM_SHARE_OR_COPY_KEEP_LAYOUT = 1u << 4u,
 		};
 
 		/**
@@ -1939,11 +1946,22 @@ class OCEAN_BASE_EXPORT Frame : public FrameType
 		 * The plane's channels are defined in relation to the data type of each pixel:<br>
 		 * A frame with pixel format FORMAT_RGB24 has three channels, one plane, and the plane has three channels (as the data type of each pixel element is uint8_t).<br>
 		 * However, a frame with pixel format FORMAT_RGB565 has three channels, one plane, but the plane has one channel only (as the data type of each pixel is uint16_t).
+		 *
+		 * Planes owning their memory can share the memory with other planes (see ACM_SHARE_OR_COPY_KEEP_LAYOUT), the memory is reference counted.<br>
+		 * A plane sharing its memory must create an own copy of the memory before the memory is modified (copy-on-write, see Frame::makeWritable()), so that the other planes are not affected.<br>
+		 * Thus, writable memory pointers must not be stored across a copy of the plane; read-only memory pointers stay valid as long as the plane is not modified.
 		 */
 		class OCEAN_BASE_EXPORT Plane
 		{
 			friend class Frame;
 
+			protected:
+
+				/**
+				 * Definition of the reference counter of memory which is shared between several planes.
+				 */
+				using ReferenceCounter = std::atomic<unsigned int>;
+
 			public:
 
 				/**
@@ -2058,6 +2076,7 @@ class OCEAN_BASE_EXPORT Frame : public FrameType
 
 				/**
 				 * Returns the writable memory pointer to this plane with a specific data type compatible with elementTypeSize().
+				 * In case the plane shares its memory with other planes, the plane must be made writable before, see Frame::makeWritable(); debug builds assert this.
 				 * @return The plane's writable memory pointer, nullptr if this plane is not writable or invalid
 				 * @tparam T the data type of the resulting memory pointer, with `sizeof(T) == elementTypeSize()`
 				 */
@@ -2162,6 +2181,14 @@ class OCEAN_BASE_EXPORT Frame : public FrameType
 				 */
 				inline bool isReadOnly() const;
 
+				/**
+				 * Returns whether this plane currently shares its memory with at least one other plane.
+				 * A shared plane is owner of the memory, the plane must create an own copy of the memory before the memory is modified.
+				 * @return True, if so
+				 * @see ACM_SHARE_OR_COPY_KEEP_LAYOUT.
+				 */
+				inline bool isShared() const;
+
 				/**
 				 * Returns whether this plane holds valid data.
 				 * @return True, if so; False, if the plane is empty
@@ -2204,6 +2231,24 @@ class OCEAN_BASE_EXPORT Frame : public FrameType
 				 */
 				static void* alignedMemory(const size_t size, const size_t alignment, void*& alignedData);
 
+				/**
+				 * Allocates memory with specific byte alignment, the memory is taken from the MemoryPool if the pool is enabled.
+				 * @param size The size of the resulting buffer in bytes, with range [0, infinity)
+				 * @param alignment The requested byte alignment, with range [1, infinity)
+				 * @param alignedData the resulting pointer to the aligned memory
+				 * @param poolCapacity The resulting capacity of the pooled memory block, 0 if the memory has not been taken from the pool
+				 * @return The allocated memory with arbitrary alignment
+				 * @see MemoryPool.
+				 */
+				static void* alignedMemory(const size_t size, const size_t alignment, void*& alignedData, size_t& poolCapacity);
+
+				/**
+				 * Returns the id of the memory category to which the memory of all planes is reported.
+				 * @return The id of the category
+				 * @see MemoryTracker.
+				 */
+				static MemoryTracker::CategoryId memoryCategoryId();
+
 				/**
 				 * Returns whether the memory layout of a plane is valid (and fits into the memory).
 				 * @param planeWidth The width of the plane, in pixel, with range [0, infinity)
@@ -2285,6 +2330,25 @@ class OCEAN_BASE_EXPORT Frame : public FrameType
 				 */
 				void copy(const void* sourceData, const unsigned int sourceStrideBytes, const unsigned int sourcePaddingElements, const bool makeCopyOfPaddingData = false);
 
+				/**
+				 * Shares the memory of a given plane which is owner of the memory.
+				 * @param sourcePlane The plane with which the memory will be shared, must be owner of the memory
+				 */
+				void share(const Plane& sourcePlane);
+
+				/**
+				 * Replaces the shared memory of this plane with an own copy of the memory, including the padding data.
+				 * @return True, if succeeded
+				 */
+				bool makeExclusive();
+
+				/**
+				 * Returns the reference counter of the memory of this plane, the counter is created if it does not exist yet.
+				 * The plane must be owner of the memory.
+				 * @return The plane's reference counter
+				 */
+				ReferenceCounter& referenceCounter() const;
+
 				/**
 				 * Calculates the number of bytes between the start positions of two consecutive rows, in bytes.
 				 * @return The number of bytes, with range [width * bytesPerPlanePixel, infinity).
@@ -2305,6 +2369,12 @@ class OCEAN_BASE_EXPORT Frame : public FrameType
 				/// The usable capacity of the allocated buffer in bytes, used for buffer reuse when sizes differ but the existing buffer is large enough.
 				unsigned int allocatedCapacity_ = 0u;
 
+				/// The capacity of the allocated memory block if the block has been taken from the MemoryPool, 0 if the block has been allocated directly.
+				size_t poolCapacity_ = 0;
+
+				/// The reference counter of the allocated memory, nullptr if the memory has never been shared; the counter is created on demand when a copy shares the memory.
+				mutable std::atomic<ReferenceCounter*> referenceCounter_ = nullptr;
+
 				/// The pointer to the read-only memory of the plane (not the pointer to the allocated memory), nullptr, if the plane is not read-only, or invalid.
 				const void* constData_ = nullptr;
 
@@ -2619,6 +2689,16 @@ class OCEAN_BASE_EXPORT Frame : public FrameType
 		 */
 		void makeOwner();
 
+		/**
+		 * Makes the memory of this frame writable without affecting any other frame (copy-on-write).
+		 * Each plane sharing its memory with other frames receives an own copy of the memory, including the padding data.<br>
+		 * This function must be called before a frame which may share its memory is modified, e.g., once before the frame is modified by several threads concurrently.<br>
+		 * Writable memory pointers which have been determined before this call are invalid afterwards.
+		 * @return True, if succeeded; False, if the frame is read-only, or if the memory could not be copied
+		 * @see isShared(), ACM_SHARE_OR_COPY_KEEP_LAYOUT.
+		 */
+		bool makeWritable();
+
 		/**
 		 * Returns a sub-frame of this frame.
 		 * The copy mode defines whether the resulting sub-frame owns the memory or uses the memory.
@@ -3007,6 +3087,14 @@ class OCEAN_BASE_EXPORT Frame : public FrameType
 		 */
 		inline bool isReadOnly() const;
 
+		/**
+		 * Returns whether at least one plane of this frame currently shares its memory with another frame.
+		 * A shared frame must be made writable via makeWritable() before the memory is modified.
+		 * @return True, if so
+		 * @see Plane::isShared(), makeWritable(), ACM_SHARE_OR_COPY_KEEP_LAYOUT.
+		 */
+		inline bool isShared() const;
+
 		/**
 		 * Returns whether the frame's pixel format contains an alpha channel.
 		 * @return True, if so
@@ -3418,6 +3506,13 @@ constexpr FrameType::DataType FrameType::dataType<long long>()
 	return DT_SIGNED_INTEGER_64;
 }
 
+template <>
+constexpr FrameType::DataType FrameType::dataType<Float16>()
+{
+	static_assert(sizeof(Float16) == 2, "Invalid data type!");
+	return DT_SIGNED_FLOAT_16;
+}
+
 template <>
 constexpr FrameType::DataType FrameType::dataType<float>()
 {
@@ -3672,6 +3767,8 @@ inline const T* Frame::Plane::constdata() const
 template <typename T>
 inline T* Frame::Plane::data()
 {
+	ocean_assert(!isShared() && "A shared plane must be made writable via Frame::makeWritable() before it is accessed for writing");
+
 	return reinterpret_cast<T*>(data_);
 }
 
@@ -3754,6 +3851,13 @@ inline bool Frame::Plane::isReadOnly() const
 	return data_ == nullptr;
 }
 
+inline bool Frame::Plane::isShared() const
+{
+	const ReferenceCounter* referenceCounter = referenceCounter_.load(std::memory_order_acquire);
+
+	return referenceCounter != nullptr && referenceCounter->load(std::memory_order_acquire) >= 2u;
+}
+
 inline bool Frame::Plane::isValid() const
 {
 	return width_ != 0u && height_ != 0u && channels_ != 0u;
@@ -4057,6 +4161,11 @@ bool Frame::setValue(const PixelType<T, tPlaneChannels>& planePixelValue, const
 		return false;
 	}
 
+	if (plane.isShared() && !plane.makeExclusive())
+	{
+		return false;
+	}
+
 	if (plane.paddingElements_ == 0u)
 	{
 		PixelType<T, tPlaneChannels>* const data = plane.data<PixelType<T, tPlaneChannels>>();
@@ -4485,6 +4594,21 @@ inline bool Frame::isReadOnly() const
 	return false;
 }
 
+inline bool Frame::isShared() const
+{
+	ocean_assert(planes_.size() >= 1);
+
+	for (const Plane& plane : planes_)
+	{
+		if (plane.isShared())
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
 inline bool Frame::hasAlphaChannel() const
 {
 	ocean_assert(isValid());
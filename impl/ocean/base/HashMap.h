@@ -10,8 +10,22 @@
 
 #include "ocean/base/Base.h"
 
+#include <algorithm>
+#include <bit>
+#include <functional>
+#include <limits>
+#include <tuple>
+#include <utility>
 #include <vector>
 
+#if defined(OCEAN_HARDWARE_SSE_VERSION) && OCEAN_HARDWARE_SSE_VERSION >= 20
+	#include <emmintrin.h>
+#elif defined(OCEAN_HARDWARE_NEON_VERSION) && OCEAN_HARDWARE_NEON_VERSION >= 10
+	#if defined(__ARM_NEON__) || defined(__ARM_NEON)
+		#include <arm_neon.h>
+	#endif // __ARM_NEON__
+#endif // OCEAN_HARDWARE_SSE_VERSION, OCEAN_HARDWARE_NEON_VERSION
+
 namespace Ocean
 {
 
@@ -191,6 +205,319 @@ class HashMap
 		ValueFunction mapFunction;
 };
 
+/**
+ * This class implements a cache-friendly hash map based on open addressing.
+ * All key-value pairs are stored contiguously in one vector, a separate table with one control byte and one value index per slot is used for lookups.<br>
+ * The control bytes hold seven bits of the hash value of a key, several control bytes are probed at once (with SSE or NEON instructions if available) so that the key-value pairs are accessed for promising slots only.<br>
+ * The interface follows the interface of std::unordered_map so that the map can be used as a replacement whenever lookups are performance critical.<br>
+ * Beware: In contrast to std::unordered_map, inserting elements may invalidate all iterators, pointers, and references.<br>
+ * Erasing an element moves the last element into the gap, so that iterators, pointers, and references to the last element are invalidated, while the iterator of the erased element points to the moved element afterwards.<br>
+ * Thus, elements can be erased while iterating by using the iterator returned by erase(), an iteration always visits the elements in the order of their storage.
+ * @tparam TKey The data type of the keys, the keys must not be modified via iterators
+ * @tparam T The data type of the mapped values
+ * @tparam THash The hash function to be used
+ * @tparam TKeyEqual The function to compare two keys
+ * @see HashMap.
+ * @ingroup base
+ */
+template <typename TKey, typename T, typename THash = std::hash<TKey>, typename TKeyEqual = std::equal_to<TKey>>
+class FlatHashMap
+{
+	public:
+
+		/**
+		 * Definition of the key type.
+		 */
+		using key_type = TKey;
+
+		/**
+		 * Definition of the mapped type.
+		 */
+		using mapped_type = T;
+
+		/**
+		 * Definition of a key-value pair, the key must not be modified.
+		 */
+		using value_type = std::pair<TKey, T>;
+
+		/**
+		 * Definition of an iterator.
+		 */
+		using iterator = typename std::vector<value_type>::iterator;
+
+		/**
+		 * Definition of a const iterator.
+		 */
+		using const_iterator = typename std::vector<value_type>::const_iterator;
+
+	protected:
+
+		/**
+		 * Definition of a vector holding the key-value pairs.
+		 */
+		using Values = std::vector<value_type>;
+
+		/**
+		 * Definition of a vector holding control bytes.
+		 */
+		using Controls = std::vector<uint8_t>;
+
+		/// The number of slots which are probed at once.
+		static constexpr size_t groupSize_ = 16;
+
+		/// The control byte of an empty slot.
+		static constexpr uint8_t controlEmpty_ = 0x80u;
+
+		/// The control byte of a slot with an erased element, the control byte of an occupied slot has range [0, 127].
+		static constexpr uint8_t controlDeleted_ = 0xFEu;
+
+		/// The number of bits used for each slot within a match mask.
+#if defined(OCEAN_HARDWARE_NEON_VERSION) && OCEAN_HARDWARE_NEON_VERSION >= 10 && !(defined(OCEAN_HARDWARE_SSE_VERSION) && OCEAN_HARDWARE_SSE_VERSION >= 20)
+		static constexpr unsigned int maskBitsPerSlot_ = 4u;
+#else
+		static constexpr unsigned int maskBitsPerSlot_ = 1u;
+#endif
+
+	public:
+
+		/**
+		 * Creates a new empty hash map.
+		 */
+		FlatHashMap() = default;
+
+		/**
+		 * Creates a new empty hash map with a given capacity.
+		 * @param capacity The number of elements the map can hold without rehashing, with range [0, infinity)
+		 */
+		explicit inline FlatHashMap(const size_t capacity);
+
+		/**
+		 * Returns the iterator to the first element of this map.
+		 * @return The iterator to the first element
+		 */
+		inline iterator begin();
+
+		/**
+		 * Returns the iterator behind the last element of this map.
+		 * @return The end iterator
+		 */
+		inline iterator end();
+
+		/**
+		 * Returns the const iterator to the first element of this map.
+		 * @return The iterator to the first element
+		 */
+		inline const_iterator begin() const;
+
+		/**
+		 * Returns the const iterator behind the last element of this map.
+		 * @return The end iterator
+		 */
+		inline const_iterator end() const;
+
+		/**
+		 * Returns the const iterator to the first element of this map.
+		 * @return The iterator to the first element
+		 */
+		inline const_iterator cbegin() const;
+
+		/**
+		 * Returns the const iterator behind the last element of this map.
+		 * @return The end iterator
+		 */
+		inline const_iterator cend() const;
+
+		/**
+		 * Returns the element with a specific key.
+		 * @param key The key of the element to find
+		 * @return The iterator to the element, end() if the map does not contain the key
+		 */
+		inline iterator find(const TKey& key);
+
+		/**
+		 * Returns the element with a specific key.
+		 * @param key The key of the element to find
+		 * @return The iterator to the element, end() if the map does not contain the key
+		 */
+		inline const_iterator find(const TKey& key) const;
+
+		/**
+		 * Returns whether this map contains an element with a specific key.
+		 * @param key The key to check
+		 * @return True, if so
+		 */
+		inline bool contains(const TKey& key) const;
+
+		/**
+		 * Returns the number of elements with a specific key.
+		 * @param key The key to check
+		 * @return The number of elements, with range [0, 1]
+		 */
+		inline size_t count(const TKey& key) const;
+
+		/**
+		 * Inserts a new element if the map does not contain the key already.
+		 * The value is constructed only if the key does not exist.
+		 * @param key The key of the new element
+		 * @param args The arguments to construct the value
+		 * @return The iterator to the element with the key, and True if the element has been inserted
+		 * @tparam TArgs The data types of the arguments
+		 */
+		template <typename... TArgs>
+		std::pair<iterator, bool> try_emplace(const TKey& key, TArgs&&... args);
+
+		/**
+		 * Inserts a new element if the map does not contain the key already.
+		 * This function has the same behavior as try_emplace().
+		 * @param key The key of the new element
+		 * @param args The arguments to construct the value
+		 * @return The iterator to the element with the key, and True if the element has been inserted
+		 * @tparam TArgs The data types of the arguments
+		 */
+		template <typename... TArgs>
+		inline std::pair<iterator, bool> emplace(const TKey& key, TArgs&&... args);
+
+		/**
+		 * Inserts a new element if the map does not contain the key already.
+		 * @param value The key-value pair to insert
+		 * @return The iterator to the element with the key, and True if the element has been inserted
+		 */
+		inline std::pair<iterator, bool> insert(value_type&& value);
+
+		/**
+		 * Inserts a new element if the map does not contain the key already.
+		 * @param value The key-value pair to insert
+		 * @return The iterator to the element with the key, and True if the element has been inserted
+		 */
+		inline std::pair<iterator, bool> insert(const value_type& value);
+
+		/**
+		 * Erases the element with a specific key.
+		 * @param key The key of the element to erase
+		 * @return The number of erased elements, with range [0, 1]
+		 */
+		size_t erase(const TKey& key);
+
+		/**
+		 * Erases an element.
+		 * @param iElement The iterator of the element to erase, must be valid
+		 * @return The iterator to the element which took the place of the erased element, end() if the erased element was the last element
+		 */
+		iterator erase(const const_iterator iElement);
+
+		/**
+		 * Reserves memory for a given number of elements.
+		 * @param capacity The number of elements the map can hold without rehashing, with range [0, infinity)
+		 */
+		void reserve(const size_t capacity);
+
+		/**
+		 * Removes all elements from this map, the allocated memory is kept.
+		 */
+		void clear();
+
+		/**
+		 * Returns the number of elements of this map.
+		 * @return The map's size
+		 */
+		inline size_t size() const;
+
+		/**
+		 * Returns whether this map is empty.
+		 * @return True, if so
+		 */
+		inline bool empty() const;
+
+		/**
+		 * Returns the value of an element with a specific key, the element will be inserted with a default value if it does not exist.
+		 * @param key The key of the element
+		 * @return The element's value
+		 */
+		inline T& operator[](const TKey& key);
+
+	protected:
+
+		/**
+		 * Returns the hash value of a key, the hash value is mixed so that weak hash functions (like the identity) are distributed well.
+		 * @param key The key for which the hash value will be returned
+		 * @return The mixed hash value
+		 */
+		inline uint64_t hashValue(const TKey& key) const;
+
+		/**
+		 * Returns the slot of the element with a specific key.
+		 * @param key The key of the element
+		 * @param hash The mixed hash value of the key
+		 * @return The index of the slot, -1 if the map does not contain the key
+		 */
+		size_t findSlot(const TKey& key, const uint64_t hash) const;
+
+		/**
+		 * Returns the first free (empty or deleted) slot for a specific hash value.
+		 * The map must contain at least one free slot.
+		 * @param hash The mixed hash value
+		 * @return The index of the free slot
+		 */
+		size_t findFreeSlot(const uint64_t hash) const;
+
+		/**
+		 * Erases the element of an occupied slot.
+		 * The last element is moved into the gap of the erased element.
+		 * @param slot The index of the occupied slot, with range [0, controls_.size() - 1]
+		 * @return The index of the erased element within the vector of key-value pairs
+		 */
+		size_t eraseSlot(const size_t slot);
+
+		/**
+		 * Rehashes all elements into a slot table with a given size.
+		 * @param numberSlots The number of slots, must be a power of two, with range [groupSize_, infinity)
+		 */
+		void rehash(const size_t numberSlots);
+
+		/**
+		 * Returns the number of slots which are necessary to hold a given number of elements.
+		 * @param capacity The number of elements, with range [0, infinity)
+		 * @return The number of slots, a power of two with range [groupSize_, infinity)
+		 */
+		static inline size_t necessarySlots(const size_t capacity);
+
+		/**
+		 * Returns a mask of all slots within a group with a specific control byte.
+		 * @param controls The control bytes of the group, must be valid
+		 * @param control The control byte to match
+		 * @return The mask with maskBitsPerSlot_ bits for each matching slot
+		 */
+		static inline uint64_t matchGroup(const uint8_t* controls, const uint8_t control);
+
+		/**
+		 * Returns a mask of all free (empty or deleted) slots within a group.
+		 * @param controls The control bytes of the group, must be valid
+		 * @return The mask with maskBitsPerSlot_ bits for each free slot
+		 */
+		static inline uint64_t matchGroupFree(const uint8_t* controls);
+
+		/**
+		 * Returns the index of the first slot within a mask and removes the slot from the mask.
+		 * @param mask The mask of slots, must not be zero
+		 * @return The index of the slot within the group, with range [0, groupSize_ - 1]
+		 */
+		static inline size_t popSlot(uint64_t& mask);
+
+	protected:
+
+		/// The key-value pairs of this map, stored contiguously.
+		Values values_;
+
+		/// The control bytes of all slots.
+		Controls controls_;
+
+		/// The index of the key-value pair for each occupied slot.
+		Indices32 valueIndices_;
+
+		/// The number of slots with an erased element.
+		size_t deletedSlots_ = 0;
+};
+
 template <typename TKey, typename T>
 inline HashMap<TKey, T>::HashMap(const HashMap<TKey, T>& hashMap) :
 	mapElements(hashMap.mapElements),
@@ -674,6 +1001,448 @@ bool HashMap<TKey, T>::isConsistent() const
 	return count == mapSize;
 }
 
+
+template <typename TKey, typename T, typename THash, typename TKeyEqual>
+inline FlatHashMap<TKey, T, THash, TKeyEqual>::FlatHashMap(const size_t capacity)
+{
+	reserve(capacity);
+}
+
+template <typename TKey, typename T, typename THash, typename TKeyEqual>
+inline typename FlatHashMap<TKey, T, THash, TKeyEqual>::iterator FlatHashMap<TKey, T, THash, TKeyEqual>::begin()
+{
+	return values_.begin();
+}
+
+template <typename TKey, typename T, typename THash, typename TKeyEqual>
+inline typename FlatHashMap<TKey, T, THash, TKeyEqual>::iterator FlatHashMap<TKey, T, THash, TKeyEqual>::end()
+{
+	return values_.end();
+}
+
+template <typename TKey, typename T, typename THash, typename TKeyEqual>
+inline typename FlatHashMap<TKey, T, THash, TKeyEqual>::const_iterator FlatHashMap<TKey, T, THash, TKeyEqual>::begin() const
+{
+	return values_.cbegin();
+}
+
+template <typename TKey, typename T, typename THash, typename TKeyEqual>
+inline typename FlatHashMap<TKey, T, THash, TKeyEqual>::const_iterator FlatHashMap<TKey, T, THash, TKeyEqual>::end() const
+{
+	return values_.cend();
+}
+
+template <typename TKey, typename T, typename THash, typename TKeyEqual>
+inline typename FlatHashMap<TKey, T, THash, TKeyEqual>::const_iterator FlatHashMap<TKey, T, THash, TKeyEqual>::cbegin() const
+{
+	return values_.cbegin();
+}
+
+template <typename TKey, typename T, typename THash, typename TKeyEqual>
+inline typename FlatHashMap<TKey, T, THash, TKeyEqual>::const_iterator FlatHashMap<TKey, T, THash, TKeyEqual>::cend() const
+{
+	return values_.cend();
+}
+
+template <typename TKey, typename T, typename THash, typename TKeyEqual>
+inline typename FlatHashMap<TKey, T, THash, TKeyEqual>::iterator FlatHashMap<TKey, T, THash, TKeyEqual>::find(const TKey& key)
+{
+	const size_t slot = findSlot(key, hashValue(key));
+
+	if (slot == size_t(-1))
+	{
+		return values_.end();
+	}
+
+	return values_.begin() + valueIndices_[slot];
+}
+
+template <typename TKey, typename T, typename THash, typename TKeyEqual>
+inline typename FlatHashMap<TKey, T, THash, TKeyEqual>::const_iterator FlatHashMap<TKey, T, THash, TKeyEqual>::find(const TKey& key) const
+{
+	const size_t slot = findSlot(key, hashValue(key));
+
+	if (slot == size_t(-1))
+	{
+		return values_.cend();
+	}
+
+	return values_.cbegin() + valueIndices_[slot];
+}
+
+template <typename TKey, typename T, typename THash, typename TKeyEqual>
+inline bool FlatHashMap<TKey, T, THash, TKeyEqual>::contains(const TKey& key) const
+{
+	return findSlot(key, hashValue(key)) != size_t(-1);
+}
+
+template <typename TKey, typename T, typename THash, typename TKeyEqual>
+inline size_t FlatHashMap<TKey, T, THash, TKeyEqual>::count(const TKey& key) const
+{
+	return contains(key) ? 1 : 0;
+}
+
+template <typename TKey, typename T, typename THash, typename TKeyEqual>
+template <typename... TArgs>
+std::pair<typename FlatHashMap<TKey, T, THash, TKeyEqual>::iterator, bool> FlatHashMap<TKey, T, THash, TKeyEqual>::try_emplace(const TKey& key, TArgs&&... args)
+{
+	const uint64_t hash = hashValue(key);
+
+	const size_t existingSlot = findSlot(key, hash);
+
+	if (existingSlot != size_t(-1))
+	{
+		return std::make_pair(values_.begin() + valueIndices_[existingSlot], false);
+	}
+
+	// we keep at least 1/8 of all slots empty, deleted slots are removed when rehashing
+
+	if ((values_.size() + deletedSlots_ + 1) * 8 > controls_.size() * 7)
+	{
+		rehash(std::max(controls_.size(), necessarySlots((values_.size() + 1) * 2)));
+	}
+
+	ocean_assert(values_.size() < size_t(std::numeric_limits<Index32>::max()));
+
+	const size_t slot = findFreeSlot(hash);
+
+	if (controls_[slot] == controlDeleted_)
+	{
+		ocean_assert(deletedSlots_ >= 1);
+		--deletedSlots_;
+	}
+
+	controls_[slot] = uint8_t(hash & 0x7Fu);
+	valueIndices_[slot] = Index32(values_.size());
+
+	values_.emplace_back(std::piecewise_construct, std::forward_as_tuple(key), std::forward_as_tuple(std::forward<TArgs>(args)...));
+
+	return std::make_pair(values_.end() - 1, true);
+}
+
+template <typename TKey, typename T, typename THash, typename TKeyEqual>
+template <typename... TArgs>
+inline std::pair<typename FlatHashMap<TKey, T, THash, TKeyEqual>::iterator, bool> FlatHashMap<TKey, T, THash, TKeyEqual>::emplace(const TKey& key, TArgs&&... args)
+{
+	return try_emplace(key, std::forward<TArgs>(args)...);
+}
+
+template <typename TKey, typename T, typename THash, typename TKeyEqual>
+inline std::pair<typename FlatHashMap<TKey, T, THash, TKeyEqual>::iterator, bool> FlatHashMap<TKey, T, THash, TKeyEqual>::insert(value_type&& value)
+{
+	return try_emplace(value.first, std::move(value.second));
+}
+
+template <typename TKey, typename T, typename THash, typename TKeyEqual>
+inline std::pair<typename FlatHashMap<TKey, T, THash, TKeyEqual>::iterator, bool> FlatHashMap<TKey, T, THash, TKeyEqual>::insert(const value_type& value)
+{
+	return try_emplace(value.first, value.second);
+}
+
+template <typename TKey, typename T, typename THash, typename TKeyEqual>
+size_t FlatHashMap<TKey, T, THash, TKeyEqual>::erase(const TKey& key)
+{
+	const size_t slot = findSlot(key, hashValue(key));
+
+	if (slot == size_t(-1))
+	{
+		return 0;
+	}
+
+	eraseSlot(slot);
+
+	return 1;
+}
+
+template <typename TKey, typename T, typename THash, typename TKeyEqual>
+typename FlatHashMap<TKey, T, THash, TKeyEqual>::iterator FlatHashMap<TKey, T, THash, TKeyEqual>::erase(const const_iterator iElement)
+{
+	ocean_assert(iElement >= values_.cbegin() && iElement < values_.cend());
+
+	const size_t valueIndex = size_t(iElement - values_.cbegin());
+
+	const size_t slot = findSlot(iElement->first, hashValue(iElement->first));
+	ocean_assert(slot != size_t(-1) && valueIndices_[slot] == valueIndex);
+
+	const size_t erasedValueIndex = eraseSlot(slot);
+	ocean_assert_and_suppress_unused(erasedValueIndex == valueIndex, erasedValueIndex);
+
+	return values_.begin() + valueIndex;
+}
+
+template <typename TKey, typename T, typename THash, typename TKeyEqual>
+void FlatHashMap<TKey, T, THash, TKeyEqual>::reserve(const size_t capacity)
+{
+	values_.reserve(capacity);
+
+	const size_t numberSlots = necessarySlots(capacity);
+
+	if (numberSlots > controls_.size())
+	{
+		rehash(numberSlots);
+	}
+}
+
+template <typename TKey, typename T, typename THash, typename TKeyEqual>
+void FlatHashMap<TKey, T, THash, TKeyEqual>::clear()
+{
+	values_.clear();
+
+	std::fill(controls_.begin(), controls_.end(), controlEmpty_);
+	deletedSlots_ = 0;
+}
+
+template <typename TKey, typename T, typename THash, typename TKeyEqual>
+inline size_t FlatHashMap<TKey, T, THash, TKeyEqual>::size() const
+{
+	return values_.size();
+}
+
+template <typename TKey, typename T, typename THash, typename TKeyEqual>
+inline bool FlatHashMap<TKey, T, THash, TKeyEqual>::empty() const
+{
+	return values_.empty();
+}
+
+template <typename TKey, typename T, typename THash, typename TKeyEqual>
+inline T& FlatHashMap<TKey, T, THash, TKeyEqual>::operator[](const TKey& key)
+{
+	return try_emplace(key).first->second;
+}
+
+template <typename TKey, typename T, typename THash, typename TKeyEqual>
+inline uint64_t FlatHashMap<TKey, T, THash, TKeyEqual>::hashValue(const TKey& key) const
+{
+	// the multiplication and the folding ensure that also the identity hash function (e.g., for integers) provides well distributed slots and control bytes
+
+	const uint64_t value = uint64_t(THash()(key)) * 0x9E3779B97F4A7C15ull;
+
+	return value ^ (value >> 32u);
+}
+
+template <typename TKey, typename T, typename THash, typename TKeyEqual>
+size_t FlatHashMap<TKey, T, THash, TKeyEqual>::findSlot(const TKey& key, const uint64_t hash) const
+{
+	if (controls_.empty())
+	{
+		return size_t(-1);
+	}
+
+	ocean_assert(controls_.size() % groupSize_ == 0);
+
+	const uint8_t control = uint8_t(hash & 0x7Fu);
+
+	const size_t groupMask = controls_.size() / groupSize_ - 1;
+
+	size_t group = size_t(hash >> 7u) & groupMask;
+
+	// the groups are probed with triangular numbers which visits each group once as the number of groups is a power of two
+
+	for (size_t nProbe = 1; nProbe <= groupMask + 1; ++nProbe)
+	{
+		const uint8_t* const groupControls = controls_.data() + group * groupSize_;
+
+		uint64_t mask = matchGroup(groupControls, control);
+
+		while (mask != 0u)
+		{
+			const size_t slot = group * groupSize_ + popSlot(mask);
+
+			if (TKeyEqual()(values_[valueIndices_[slot]].first, key))
+			{
+				return slot;
+			}
+		}
+
+		if (matchGroup(groupControls, controlEmpty_) != 0u)
+		{
+			// the probe sequence of the key ends at the first group with an empty slot
+
+			return size_t(-1);
+		}
+
+		group = (group + nProbe) & groupMask;
+	}
+
+	return size_t(-1);
+}
+
+template <typename TKey, typename T, typename THash, typename TKeyEqual>
+size_t FlatHashMap<TKey, T, THash, TKeyEqual>::findFreeSlot(const uint64_t hash) const
+{
+	ocean_assert(!controls_.empty() && controls_.size() % groupSize_ == 0);
+
+	const size_t groupMask = controls_.size() / groupSize_ - 1;
+
+	size_t group = size_t(hash >> 7u) & groupMask;
+
+	for (size_t nProbe = 1; nProbe <= groupMask + 1; ++nProbe)
+	{
+		uint64_t mask = matchGroupFree(controls_.data() + group * groupSize_);
+
+		if (mask != 0u)
+		{
+			return group * groupSize_ + popSlot(mask);
+		}
+
+		group = (group + nProbe) & groupMask;
+	}
+
+	ocean_assert(false && "The map does not contain a free slot!");
+	return size_t(-1);
+}
+
+template <typename TKey, typename T, typename THash, typename TKeyEqual>
+size_t FlatHashMap<TKey, T, THash, TKeyEqual>::eraseSlot(const size_t slot)
+{
+	ocean_assert(slot < controls_.size() && controls_[slot] < controlEmpty_);
+
+	const size_t valueIndex = size_t(valueIndices_[slot]);
+	ocean_assert(valueIndex < values_.size());
+
+	controls_[slot] = controlDeleted_;
+	++deletedSlots_;
+
+	const size_t lastValueIndex = values_.size() - 1;
+
+	if (valueIndex != lastValueIndex)
+	{
+		// the last element is moved into the gap so that all elements stay contiguous
+
+		const TKey& lastKey = values_[lastValueIndex].first;
+
+		const size_t lastSlot = findSlot(lastKey, hashValue(lastKey));
+		ocean_assert(lastSlot != size_t(-1) && valueIndices_[lastSlot] == lastValueIndex);
+
+		valueIndices_[lastSlot] = Index32(valueIndex);
+
+		values_[valueIndex] = std::move(values_[lastValueIndex]);
+	}
+
+	values_.pop_back();
+
+	return valueIndex;
+}
+
+template <typename TKey, typename T, typename THash, typename TKeyEqual>
+void FlatHashMap<TKey, T, THash, TKeyEqual>::rehash(const size_t numberSlots)
+{
+	ocean_assert(numberSlots >= groupSize_ && (numberSlots & (numberSlots - 1)) == 0);
+	ocean_assert(values_.size() * 8 <= numberSlots * 7);
+
+	controls_.assign(numberSlots, controlEmpty_);
+	valueIndices_.resize(numberSlots);
+
+	deletedSlots_ = 0;
+
+	for (size_t n = 0; n < values_.size(); ++n)
+	{
+		const uint64_t hash = hashValue(values_[n].first);
+
+		const size_t slot = findFreeSlot(hash);
+
+		controls_[slot] = uint8_t(hash & 0x7Fu);
+		valueIndices_[slot] = Index32(n);
+	}
+}
+
+template <typename TKey, typename T, typename THash, typename TKeyEqual>
+inline size_t FlatHashMap<TKey, T, THash, TKeyEqual>::necessarySlots(const size_t capacity)
+{
+	size_t numberSlots = groupSize_;
+
+	while (capacity * 8 > numberSlots * 7)
+	{
+		numberSlots *= 2;
+	}
+
+	return numberSlots;
+}
+
+template <typename TKey, typename T, typename THash, typename TKeyEqual>
+inline uint64_t FlatHashMap<TKey, T, THash, TKeyEqual>::matchGroup(const uint8_t* controls, const uint8_t control)
+{
+	ocean_assert(controls != nullptr);
+
+#if defined(OCEAN_HARDWARE_SSE_VERSION) && OCEAN_HARDWARE_SSE_VERSION >= 20
+
+	const __m128i controls_u_8x16 = _mm_loadu_si128((const __m128i*)controls);
+
+	return uint64_t(uint32_t(_mm_movemask_epi8(_mm_cmpeq_epi8(controls_u_8x16, _mm_set1_epi8(char(control))))));
+
+#elif defined(OCEAN_HARDWARE_NEON_VERSION) && OCEAN_HARDWARE_NEON_VERSION >= 10
+
+	const uint8x16_t equal_u_8x16 = vceqq_u8(vld1q_u8(controls), vdupq_n_u8(control));
+
+	// narrowing each 16 bit lane by 4 bits provides 4 bits for each slot
+
+	return vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(equal_u_8x16), 4)), 0);
+
+#else
+
+	uint64_t mask = 0u;
+
+	for (size_t n = 0; n < groupSize_; ++n)
+	{
+		if (controls[n] == control)
+		{
+			mask |= uint64_t(1u) << n;
+		}
+	}
+
+	return mask;
+
+#endif // OCEAN_HARDWARE_SSE_VERSION, OCEAN_HARDWARE_NEON_VERSION
+}
+
+template <typename TKey, typename T, typename THash, typename TKeyEqual>
+inline uint64_t FlatHashMap<TKey, T, THash, TKeyEqual>::matchGroupFree(const uint8_t* controls)
+{
+	ocean_assert(controls != nullptr);
+
+	// empty and deleted slots are the only slots with the highest bit set
+
+#if defined(OCEAN_HARDWARE_SSE_VERSION) && OCEAN_HARDWARE_SSE_VERSION >= 20
+
+	return uint64_t(uint32_t(_mm_movemask_epi8(_mm_loadu_si128((const __m128i*)controls))));
+
+#elif defined(OCEAN_HARDWARE_NEON_VERSION) && OCEAN_HARDWARE_NEON_VERSION >= 10
+
+	const uint8x16_t free_u_8x16 = vtstq_u8(vld1q_u8(controls), vdupq_n_u8(0x80u));
+
+	return vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(free_u_8x16), 4)), 0);
+
+#else
+
+	uint64_t mask = 0u;
+
+	for (size_t n = 0; n < groupSize_; ++n)
+	{
+		if ((controls[n] & 0x80u) != 0u)
+		{
+			mask |= uint64_t(1u) << n;
+		}
+	}
+
+	return mask;
+
+#endif // OCEAN_HARDWARE_SSE_VERSION, OCEAN_HARDWARE_NEON_VERSION
+}
+
+template <typename TKey, typename T, typename THash, typename TKeyEqual>
+inline size_t FlatHashMap<TKey, T, THash, TKeyEqual>::popSlot(uint64_t& mask)
+{
+	ocean_assert(mask != 0u);
+
+	const unsigned int bit = (unsigned int)(std::countr_zero(mask));
+
+	constexpr uint64_t slotBits = (uint64_t(1u) << maskBitsPerSlot_) - 1u;
+
+	mask &= ~(slotBits << bit);
+
+	return size_t(bit / maskBitsPerSlot_);
+}
+
 }
 
 #endif // META_OCEAN_BASE_HASH_MAP_H
@@ -8,8 +8,12 @@
 #include "ocean/base/HighPerformanceTimer.h"
 #include "ocean/base/Median.h"
 #include "ocean/base/String.h"
+#include "ocean/base/Thread.h"
 
 #include <deque>
+#include <fstream>
+#include <mutex>
+#include <sstream>
 
 #if defined(_WINDOWS)
 	#include <winsock2.h>
@@ -976,6 +980,139 @@ bool HighPerformanceBenchmark::createTokenMatrixFromCategoryHierarchy(const Cate
 	return true;
 }
 
+bool HighPerformanceBenchmark::startTracing(const size_t eventsPerThread)
+{
+	ocean_assert(eventsPerThread >= 1);
+
+	const ScopedLock scopedLock(lock_);
+
+	if (isTracing_ || eventsPerThread == 0)
+	{
+		return false;
+	}
+
+	traceBuffers_.clear();
+	traceEventsPerThread_ = eventsPerThread;
+	traceStartTicks_ = HighPerformanceTimer::ticks();
+
+	// all threads will register new buffers with their next event
+	++traceGeneration_;
+
+	isTracing_ = true;
+
+	return true;
+}
+
+bool HighPerformanceBenchmark::stopTracing()
+{
+	const ScopedLock scopedLock(lock_);
+
+	if (!isTracing_)
+	{
+		return false;
+	}
+
+	isTracing_ = false;
+
+	return true;
+}
+
+bool HighPerformanceBenchmark::exportChromeTrace(std::string& json) const
+{
+	const ScopedLock scopedLock(lock_);
+
+	ocean_assert(!isTracing_ && "The trace must not be exported while tracing is active");
+	if (isTracing_)
+	{
+		return false;
+	}
+
+	const double ticksToMicroseconds = 1.0e6 / double(HighPerformanceTimer::precision());
+
+	json = "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+
+	bool firstEvent = true;
+
+	for (size_t bufferIndex = 0; bufferIndex < traceBuffers_.size(); ++bufferIndex)
+	{
+		const TraceBuffer& traceBuffer = *traceBuffers_[bufferIndex];
+
+		const std::string threadId = String::toAString(traceBuffer.threadId_);
+
+		json += std::string(firstEvent ? "" : ",") + "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":" + threadId + ",\"args\":{\"name\":\"Thread " + String::toAString(bufferIndex) + "\"}}";
+		firstEvent = false;
+
+		const size_t numberAddedEvents = traceBuffer.numberAddedEvents_.load(std::memory_order_acquire);
+		const size_t numberEvents = std::min(numberAddedEvents, traceBuffer.events_.size());
+
+		// the buffer holds the latest events, starting with the oldest one
+		for (size_t n = numberAddedEvents - numberEvents; n < numberAddedEvents; ++n)
+		{
+			const TraceEvent& traceEvent = traceBuffer.events_[n % traceBuffer.events_.size()];
+
+			std::string name;
+
+			for (const char* character = traceEvent.name_; *character != '\0'; ++character)
+			{
+				if (*character == '"' || *character == '\\')
+				{
+					name += '\\';
+				}
+
+				if ((unsigned char)(*character) >= 0x20u)
+				{
+					name += *character;
+				}
+			}
+
+			const double timestamp = double(traceEvent.startTicks_ - traceStartTicks_) * ticksToMicroseconds;
+
+			if (traceEvent.isCounter_)
+			{
+				json += ",{\"name\":\"" + name + "\",\"cat\":\"ocean\",\"ph\":\"C\",\"pid\":0,\"tid\":" + threadId + ",\"ts\":" + String::toAString(timestamp, 3u) + ",\"args\":{\"value\":" + String::toAString(traceEvent.counterValue_, 3u) + "}}";
+				continue;
+			}
+
+			const double duration = double(traceEvent.stopTicks_ - traceEvent.startTicks_) * ticksToMicroseconds;
+
+			json += ",{\"name\":\"" + name + "\",\"cat\":\"ocean\",\"ph\":\"X\",\"pid\":0,\"tid\":" + threadId + ",\"ts\":" + String::toAString(timestamp, 3u) + ",\"dur\":" + String::toAString(duration, 3u);
+
+			if (traceEvent.frameId_ != invalidTraceFrameId_)
+			{
+				json += ",\"args\":{\"frame\":" + String::toAString(traceEvent.frameId_) + "}";
+			}
+
+			json += "}";
+		}
+	}
+
+	json += "]}";
+
+	return true;
+}
+
+bool HighPerformanceBenchmark::writeChromeTrace(const std::string& filename) const
+{
+	ocean_assert(!filename.empty());
+
+	std::string json;
+	if (!exportChromeTrace(json))
+	{
+		return false;
+	}
+
+	std::ofstream stream(filename.c_str(), std::ios::binary);
+
+	if (!stream.is_open())
+	{
+		return false;
+	}
+
+	stream << json;
+
+	return stream.good();
+}
+
 void HighPerformanceBenchmark::addMeasurement(const std::string& name, const double measurement)
 {
 	const ScopedLock scopedLock(lock_);
@@ -997,4 +1134,433 @@ void HighPerformanceBenchmark::addMeasurement(const std::string& name, const dou
 	}
 }
 
+void HighPerformanceBenchmark::addTraceEvent(const std::string& name, const HighPerformanceTimer::Ticks startTicks, const HighPerformanceTimer::Ticks stopTicks, const TraceFrameId frameId)
+{
+	TraceBuffer* traceBuffer = threadTraceBuffer();
+
+	if (traceBuffer == nullptr)
+	{
+		return;
+	}
+
+	if (startTicks < traceStartTicks_)
+	{
+		// the category started before tracing started
+		return;
+	}
+
+	traceBuffer->addEvent(name, startTicks, stopTicks, frameId);
+}
+
+void HighPerformanceBenchmark::addTraceCounter(const std::string& name, const double value)
+{
+	ocean_assert(!name.empty());
+
+	if (!isTracing())
+	{
+		return;
+	}
+
+	TraceBuffer* traceBuffer = threadTraceBuffer();
+
+	if (traceBuffer != nullptr)
+	{
+		traceBuffer->addCounter(name, HighPerformanceTimer::ticks(), value);
+	}
+}
+
+HighPerformanceBenchmark::TraceBuffer* HighPerformanceBenchmark::threadTraceBuffer()
+{
+	// each thread holds a reference to its own buffer, so that events can be added without any lock
+
+	thread_local std::shared_ptr<TraceBuffer> threadTraceBuffer;
+	thread_local unsigned int threadTraceGeneration = 0u;
+
+	const unsigned int traceGeneration = traceGeneration_.load(std::memory_order_relaxed);
+
+	if (!threadTraceBuffer || threadTraceGeneration != traceGeneration)
+	{
+		const ScopedLock scopedLock(lock_);
+
+		if (!isTracing_)
+		{
+			return nullptr;
+		}
+
+		threadTraceBuffer = std::make_shared<TraceBuffer>(Thread::currentThreadId().hash(), traceEventsPerThread_);
+		threadTraceGeneration = traceGeneration_;
+
+		traceBuffers_.emplace_back(threadTraceBuffer);
+	}
+
+	return threadTraceBuffer.get();
+}
+
+HighPerformanceBenchmark::TraceBuffer::TraceBuffer(const uint64_t threadId, const size_t capacity) :
+	threadId_(threadId),
+	events_(capacity)
+{
+	ocean_assert(capacity >= 1);
+}
+
+void HighPerformanceBenchmark::TraceBuffer::addEvent(const std::string& name, const HighPerformanceTimer::Ticks startTicks, const HighPerformanceTimer::Ticks stopTicks, const TraceFrameId frameId)
+{
+	ocean_assert(!events_.empty());
+	ocean_assert(startTicks <= stopTicks);
+
+	// only the owning thread writes to the buffer, so that a relaxed load is sufficient
+
+	const size_t eventIndex = numberAddedEvents_.load(std::memory_order_relaxed);
+
+	TraceEvent& traceEvent = events_[eventIndex % events_.size()];
+
+	const size_t nameLength = std::min(name.size(), TraceEvent::maximalNameLength_);
+	memcpy(traceEvent.name_, name.c_str(), nameLength);
+	traceEvent.name_[nameLength] = '\0';
+
+	traceEvent.startTicks_ = startTicks;
+	traceEvent.stopTicks_ = stopTicks;
+	traceEvent.frameId_ = frameId;
+	traceEvent.isCounter_ = false;
+
+	numberAddedEvents_.store(eventIndex + 1, std::memory_order_release);
+}
+
+void HighPerformanceBenchmark::TraceBuffer::addCounter(const std::string& name, const HighPerformanceTimer::Ticks ticks, const double value)
+{
+	ocean_assert(!events_.empty());
+
+	const size_t eventIndex = numberAddedEvents_.load(std::memory_order_relaxed);
+
+	TraceEvent& traceEvent = events_[eventIndex % events_.size()];
+
+	const size_t nameLength = std::min(name.size(), TraceEvent::maximalNameLength_);
+	memcpy(traceEvent.name_, name.c_str(), nameLength);
+	traceEvent.name_[nameLength] = '\0';
+
+	traceEvent.startTicks_ = ticks;
+	traceEvent.stopTicks_ = ticks;
+	traceEvent.frameId_ = invalidTraceFrameId_;
+	traceEvent.isCounter_ = true;
+	traceEvent.counterValue_ = value;
+
+	numberAddedEvents_.store(eventIndex + 1, std::memory_order_release);
+}
+
+
+/**
+ * This class implements the registry of all profiling records.
+ * The registry uses a std::mutex instead of a Lock object, as Lock objects must not be profiled while the registry is accessed.
+ */
+class LockProfiler::Registry
+{
+	public:
+
+		/**
+		 * Definition of a map mapping lock names to statistics.
+		 */
+		using StatisticMap = std::unordered_map<std::string, LockStatistic>;
+
+	public:
+
+		/// The records of all existing locks which have been profiled.
+		std::vector<std::unique_ptr<Lock::ProfilingRecord>> records_;
+
+		/// The statistics of all destroyed locks, combined by name.
+		StatisticMap releasedStatistics_;
+
+		/// The mutex of the registry.
+		std::mutex mutex_;
+};
+
+double LockProfiler::LockStatistic::waitPercentileSeconds(const double percentile) const
+{
+	ocean_assert(percentile >= 0.0 && percentile <= 1.0);
+
+	const uint64_t contentions = std::accumulate(waitHistogram_.cbegin(), waitHistogram_.cend(), uint64_t(0u));
+
+	if (contentions == 0u)
+	{
+		return 0.0;
+	}
+
+	const uint64_t targetContentions = std::max(uint64_t(1u), uint64_t(double(contentions) * percentile + 0.5));
+
+	uint64_t sumContentions = 0u;
+
+	for (size_t n = 0; n < waitHistogram_.size() - 1; ++n)
+	{
+		sumContentions += waitHistogram_[n];
+
+		if (sumContentions >= targetContentions)
+		{
+			return double(uint64_t(1u) << (n + 1)) * 0.000001;
+		}
+	}
+
+	return maximalWaitSeconds_;
+}
+
+bool LockProfiler::start()
+{
+	bool expected = false;
+	return Lock::profiling_.compare_exchange_strong(expected, true);
+}
+
+bool LockProfiler::stop()
+{
+	bool expected = true;
+	return Lock::profiling_.compare_exchange_strong(expected, false);
+}
+
+void LockProfiler::reset()
+{
+	Registry& profilerRegistry = registry();
+
+	const std::lock_guard<std::mutex> lockGuard(profilerRegistry.mutex_);
+
+	for (const std::unique_ptr<Lock::ProfilingRecord>& record : profilerRegistry.records_)
+	{
+		record->acquisitions_.store(0u, std::memory_order_relaxed);
+		record->contentions_.store(0u, std::memory_order_relaxed);
+		record->waitTicks_.store(0u, std::memory_order_relaxed);
+		record->maximalWaitTicks_.store(0u, std::memory_order_relaxed);
+		record->holdTicks_.store(0u, std::memory_order_relaxed);
+		record->maximalHoldTicks_.store(0u, std::memory_order_relaxed);
+
+		for (std::atomic<uint64_t>& bin : record->waitHistogram_)
+		{
+			bin.store(0u, std::memory_order_relaxed);
+		}
+	}
+
+	profilerRegistry.releasedStatistics_.clear();
+}
+
+bool LockProfiler::isRunning() const
+{
+	return Lock::profiling_.load(std::memory_order_relaxed);
+}
+
+LockProfiler::LockStatistics LockProfiler::statistics() const
+{
+	Registry::StatisticMap statisticMap;
+
+	{
+		Registry& profilerRegistry = registry();
+
+		const std::lock_guard<std::mutex> lockGuard(profilerRegistry.mutex_);
+
+		for (const std::unique_ptr<Lock::ProfilingRecord>& record : profilerRegistry.records_)
+		{
+			addRecord(*record, statisticMap[recordName(*record, false)]);
+		}
+
+		for (const Registry::StatisticMap::value_type& releasedStatistic : profilerRegistry.releasedStatistics_)
+		{
+			addStatistic(releasedStatistic.second, statisticMap[releasedStatistic.first]);
+		}
+	}
+
+	LockStatistics result;
+	result.reserve(statisticMap.size());
+
+	for (Registry::StatisticMap::value_type& statistic : statisticMap)
+	{
+		if (statistic.second.acquisitions_ != 0u)
+		{
+			statistic.second.name_ = statistic.first;
+			result.emplace_back(std::move(statistic.second));
+		}
+	}
+
+	std::sort(result.begin(), result.end(), [](const LockStatistic& left, const LockStatistic& right)
+	{
+		if (left.waitSeconds_ != right.waitSeconds_)
+		{
+			return left.waitSeconds_ > right.waitSeconds_;
+		}
+
+		return left.acquisitions_ > right.acquisitions_;
+	});
+
+	return result;
+}
+
+Strings LockProfiler::report(const size_t maximalLocks) const
+{
+	ocean_assert(maximalLocks >= 1);
+
+	const LockStatistics lockStatistics = statistics();
+
+	if (lockStatistics.empty())
+	{
+		return Strings();
+	}
+
+	std::vector<Strings> tokenMatrix;
+	tokenMatrix.emplace_back(Strings{"Name", "Locks", "Acquisitions", "Contentions", "Contended", "Wait (ms)", "P50 wait (ms)", "P99 wait (ms)", "Worst wait (ms)", "Hold (ms)", "Worst hold (ms)", "Last owner"});
+
+	for (size_t n = 0; n < std::min(lockStatistics.size(), maximalLocks); ++n)
+	{
+		const LockStatistic& lockStatistic = lockStatistics[n];
+
+		const double contended = double(lockStatistic.contentions_) / double(std::max(lockStatistic.acquisitions_, uint64_t(1u)));
+
+		tokenMatrix.emplace_back(Strings{lockStatistic.name_, String::toAString(lockStatistic.locks_), String::toAString(lockStatistic.acquisitions_), String::toAString(lockStatistic.contentions_), String::toAString(contended * 100.0, 2u) + "%",
+			String::toAString(lockStatistic.waitSeconds_ * 1000.0, 3u), String::toAString(lockStatistic.waitPercentileSeconds(0.5) * 1000.0, 3u), String::toAString(lockStatistic.waitPercentileSeconds(0.99) * 1000.0, 3u), String::toAString(lockStatistic.maximalWaitSeconds_ * 1000.0, 3u),
+			String::toAString(lockStatistic.holdSeconds_ * 1000.0, 3u), String::toAString(lockStatistic.maximalHoldSeconds_ * 1000.0, 3u), String::toAString(lockStatistic.ownerThreadId_)});
+	}
+
+	// Find the max. column width to align the tokens when printing them.
+	std::vector<size_t> maximumColumnWidths(tokenMatrix.front().size(), 0);
+
+	for (const Strings& rowTokens : tokenMatrix)
+	{
+		ocean_assert(rowTokens.size() == maximumColumnWidths.size());
+
+		for (size_t columnIndex = 0; columnIndex < rowTokens.size(); ++columnIndex)
+		{
+			maximumColumnWidths[columnIndex] = std::max(maximumColumnWidths[columnIndex], rowTokens[columnIndex].size());
+		}
+	}
+
+	// Create a column-aligned report.
+	Strings result;
+
+	for (size_t rowIndex = 0; rowIndex < tokenMatrix.size(); ++rowIndex)
+	{
+		const Strings& rowTokens = tokenMatrix[rowIndex];
+
+		std::string rowString;
+
+		for (size_t columnIndex = 0; columnIndex < rowTokens.size(); ++columnIndex)
+		{
+			const std::string padding(maximumColumnWidths[columnIndex] - rowTokens[columnIndex].size(), ' ');
+
+			if (rowIndex == 0 || columnIndex == 0)
+			{
+				// Align left
+				rowString += rowTokens[columnIndex] + padding;
+			}
+			else
+			{
+				// Align right
+				rowString += padding + rowTokens[columnIndex];
+			}
+
+			if (columnIndex + 1 < rowTokens.size())
+			{
+				rowString += " | ";
+			}
+		}
+
+		result.emplace_back(std::move(rowString));
+	}
+
+	return result;
+}
+
+Lock::ProfilingRecord* LockProfiler::createRecord(const Lock& lock)
+{
+	Registry& profilerRegistry = registry();
+
+	const std::lock_guard<std::mutex> lockGuard(profilerRegistry.mutex_);
+
+	profilerRegistry.records_.emplace_back(std::make_unique<Lock::ProfilingRecord>(&lock, lock.name()));
+
+	return profilerRegistry.records_.back().get();
+}
+
+void LockProfiler::releaseRecord(Lock::ProfilingRecord* record)
+{
+	ocean_assert(record != nullptr);
+
+	Registry& profilerRegistry = registry();
+
+	const std::lock_guard<std::mutex> lockGuard(profilerRegistry.mutex_);
+
+	for (size_t n = 0; n < profilerRegistry.records_.size(); ++n)
+	{
+		if (profilerRegistry.records_[n].get() == record)
+		{
+			addRecord(*record, profilerRegistry.releasedStatistics_[recordName(*record, true)]);
+
+			profilerRegistry.records_[n] = std::move(profilerRegistry.records_.back());
+			profilerRegistry.records_.pop_back();
+
+			return;
+		}
+	}
+
+	ocean_assert(false && "The record does not exist!");
+}
+
+void LockProfiler::addRecord(const Lock::ProfilingRecord& record, LockStatistic& statistic)
+{
+	LockStatistic recordStatistic;
+
+	recordStatistic.locks_ = 1;
+	recordStatistic.acquisitions_ = record.acquisitions_.load(std::memory_order_relaxed);
+	recordStatistic.contentions_ = record.contentions_.load(std::memory_order_relaxed);
+	recordStatistic.waitSeconds_ = HighPerformanceTimer::ticks2seconds(HighPerformanceTimer::Ticks(record.waitTicks_.load(std::memory_order_relaxed)));
+	recordStatistic.maximalWaitSeconds_ = HighPerformanceTimer::ticks2seconds(HighPerformanceTimer::Ticks(record.maximalWaitTicks_.load(std::memory_order_relaxed)));
+	recordStatistic.holdSeconds_ = HighPerformanceTimer::ticks2seconds(HighPerformanceTimer::Ticks(record.holdTicks_.load(std::memory_order_relaxed)));
+	recordStatistic.maximalHoldSeconds_ = HighPerformanceTimer::ticks2seconds(HighPerformanceTimer::Ticks(record.maximalHoldTicks_.load(std::memory_order_relaxed)));
+	recordStatistic.ownerThreadId_ = record.ownerThreadId_.load(std::memory_order_relaxed);
+
+	for (size_t n = 0; n < recordStatistic.waitHistogram_.size(); ++n)
+	{
+		recordStatistic.waitHistogram_[n] = record.waitHistogram_[n].load(std::memory_order_relaxed);
+	}
+
+	addStatistic(recordStatistic, statistic);
+}
+
+void LockProfiler::addStatistic(const LockStatistic& source, LockStatistic& target)
+{
+	target.locks_ += source.locks_;
+	target.acquisitions_ += source.acquisitions_;
+	target.contentions_ += source.contentions_;
+	target.waitSeconds_ += source.waitSeconds_;
+	target.maximalWaitSeconds_ = std::max(target.maximalWaitSeconds_, source.maximalWaitSeconds_);
+	target.holdSeconds_ += source.holdSeconds_;
+	target.maximalHoldSeconds_ = std::max(target.maximalHoldSeconds_, source.maximalHoldSeconds_);
+
+	if (source.ownerThreadId_ != 0u)
+	{
+		target.ownerThreadId_ = source.ownerThreadId_;
+	}
+
+	for (size_t n = 0; n < target.waitHistogram_.size(); ++n)
+	{
+		target.waitHistogram_[n] += source.waitHistogram_[n];
+	}
+}
+
+std::string LockProfiler::recordName(const Lock::ProfilingRecord& record, const bool released)
+{
+	if (record.name_ != nullptr)
+	{
+		return std::string(record.name_);
+	}
+
+	if (released)
+	{
+		return std::string("Unnamed destroyed locks");
+	}
+
+	std::ostringstream stream;
+	stream << "Unnamed lock " << record.lock_;
+
+	return stream.str();
+}
+
+LockProfiler::Registry& LockProfiler::registry()
+{
+	static Registry* registry = new Registry();
+
+	return *registry;
+}
+
 }
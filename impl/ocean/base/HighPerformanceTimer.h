@@ -13,7 +13,10 @@
 #include "ocean/base/Singleton.h"
 #include "ocean/base/Value.h"
 
+#include <array>
+#include <atomic>
 #include <cfloat>
+#include <memory>
 #include <numeric>
 
 namespace Ocean
@@ -473,7 +476,22 @@ class OCEAN_BASE_EXPORT HighPerformanceStatistic
  *   Function1      | ...
  * UtilityFunction0 | ...
  * </pre>
- * Of course, the actual order of the categories depends on their proportional contribution to the overall measured CPU time
+ * Of course, the actual order of the categories depends on their proportional contribution to the overall measured CPU time.
+ *
+ * Additionally, the benchmark can trace the individual executions of all scoped categories to find out which frame had a latency spike and what each thread was doing at that time.<br>
+ * Tracing is independent of benchmarking, each thread records its events into an own lock-free ring buffer, and the trace can be exported as Chrome/Perfetto trace JSON (e.g., for chrome://tracing or ui.perfetto.dev):
+ * <pre>
+ * HighPerformanceBenchmark::get().startTracing();
+ *
+ * while (keepLooping)
+ * {
+ *     HighPerformanceBenchmark::get().setTraceFrameId(frameIndex++);
+ *     SomeClass::computeSomething();
+ * }
+ *
+ * HighPerformanceBenchmark::get().stopTracing();
+ * HighPerformanceBenchmark::get().writeChromeTrace("trace.json");
+ * </pre>
  * @ingroup base
  */
 class OCEAN_BASE_EXPORT HighPerformanceBenchmark : public Singleton<HighPerformanceBenchmark>
@@ -498,6 +516,16 @@ class OCEAN_BASE_EXPORT HighPerformanceBenchmark : public Singleton<HighPerforma
 		/// Typedef for a vector of categories
 		using Categories = std::vector<Category>;
 
+		/**
+		 * Definition of a frame id which is assigned to trace events.
+		 */
+		using TraceFrameId = uint64_t;
+
+		/**
+		 * Definition of an invalid trace frame id.
+		 */
+		static constexpr TraceFrameId invalidTraceFrameId_ = TraceFrameId(-1);
+
 		/**
 		 * This class defines a hierarchical category
 		 * This class is used to group categories based on their names into a hierarchy. A hierarchy of categories is created by appending the name of a
@@ -652,6 +680,9 @@ class OCEAN_BASE_EXPORT HighPerformanceBenchmark : public Singleton<HighPerforma
 
 				/// The CPU ticks when the benchmark of this category started.
 				HighPerformanceTimer::Ticks startTicks_;
+
+				/// The trace frame id when the benchmark of this category started.
+				TraceFrameId traceFrameId_;
 		};
 
 	public:
@@ -737,6 +768,150 @@ class OCEAN_BASE_EXPORT HighPerformanceBenchmark : public Singleton<HighPerforma
 		 */
 		static bool createTokenMatrixFromCategoryHierarchy(const Categories& categories, const std::string referenceCategory, const std::string& categoryNameDelimiter, const bool valuesAsStrings, std::vector<std::vector<Value>>& tokenMatrix);
 
+		/**
+		 * Starts tracing of all scoped categories.
+		 * Previously recorded trace events are discarded.<br>
+		 * Each thread executing a scoped category records its events into an own ring buffer, once the buffer is full the oldest events are overwritten.
+		 * @param eventsPerThread The maximal number of events each thread can hold, with range [1, infinity)
+		 * @return True, if succeeded
+		 * @see stopTracing(), isTracing().
+		 */
+		bool startTracing(const size_t eventsPerThread = 65536);
+
+		/**
+		 * Stops tracing.
+		 * All recorded events stay available until tracing is started again.
+		 * @return True, if succeeded
+		 * @see startTracing().
+		 */
+		bool stopTracing();
+
+		/**
+		 * Returns whether tracing is currently active; False by default.
+		 * @return True, if so
+		 */
+		inline bool isTracing() const;
+
+		/**
+		 * Sets the frame id which will be assigned to all trace events which start afterwards, on all threads.
+		 * @param frameId The id of the current frame, invalidTraceFrameId_ to assign no frame id
+		 */
+		inline void setTraceFrameId(const TraceFrameId frameId);
+
+		/**
+		 * Returns the frame id which is currently assigned to new trace events.
+		 * @return The current frame id, invalidTraceFrameId_ if no frame id is set
+		 */
+		inline TraceFrameId traceFrameId() const;
+
+		/**
+		 * Adds the current value of a counter to the trace, e.g., the number of bytes a socket has sent.
+		 * Trace viewers show counters as graphs along the trace events, the value is recorded only while tracing is active.
+		 * @param name The name of the counter, must be valid
+		 * @param value The current value of the counter
+		 */
+		void addTraceCounter(const std::string& name, const double value);
+
+		/**
+		 * Exports all recorded trace events as Chrome/Perfetto trace JSON.
+		 * The export must not be invoked while tracing is active.
+		 * @param json The resulting JSON string
+		 * @return True, if succeeded
+		 */
+		bool exportChromeTrace(std::string& json) const;
+
+		/**
+		 * Writes all recorded trace events as Chrome/Perfetto trace JSON file.
+		 * The export must not be invoked while tracing is active.
+		 * @param filename The name of the resulting file, must be valid
+		 * @return True, if succeeded
+		 */
+		bool writeChromeTrace(const std::string& filename) const;
+
+	protected:
+
+		/**
+		 * This class holds one trace event, the execution of a scoped category or the value of a counter.
+		 */
+		class TraceEvent
+		{
+			public:
+
+				/// The maximal number of characters of a name, longer names will be truncated.
+				static constexpr size_t maximalNameLength_ = 63;
+
+			public:
+
+				/// The zero-terminated (and possibly truncated) name of the category.
+				char name_[maximalNameLength_ + 1] = {'\0'};
+
+				/// The CPU ticks when the category started.
+				HighPerformanceTimer::Ticks startTicks_ = 0;
+
+				/// The CPU ticks when the category stopped.
+				HighPerformanceTimer::Ticks stopTicks_ = 0;
+
+				/// The frame id of the event.
+				TraceFrameId frameId_ = invalidTraceFrameId_;
+
+				/// True, if the event holds the value of a counter; False, if the event is the execution of a scoped category.
+				bool isCounter_ = false;
+
+				/// The value of the counter, if the event holds a counter.
+				double counterValue_ = 0.0;
+		};
+
+		/**
+		 * This class implements a ring buffer for trace events with one writing thread.
+		 * The owning thread adds events without any lock, the events can be read once tracing has stopped.
+		 */
+		class TraceBuffer
+		{
+			public:
+
+				/**
+				 * Creates a new buffer.
+				 * @param threadId The id of the thread owning this buffer
+				 * @param capacity The maximal number of events the buffer can hold, with range [1, infinity)
+				 */
+				TraceBuffer(const uint64_t threadId, const size_t capacity);
+
+				/**
+				 * Adds a new event, overwriting the oldest event if the buffer is full.
+				 * This function must be called by the owning thread only.
+				 * @param name The name of the event, must be valid
+				 * @param startTicks The CPU ticks when the event started
+				 * @param stopTicks The CPU ticks when the event stopped, with range [startTicks, infinity)
+				 * @param frameId The frame id of the event
+				 */
+				void addEvent(const std::string& name, const HighPerformanceTimer::Ticks startTicks, const HighPerformanceTimer::Ticks stopTicks, const TraceFrameId frameId);
+
+				/**
+				 * Adds a new counter value, overwriting the oldest event if the buffer is full.
+				 * This function must be called by the owning thread only.
+				 * @param name The name of the counter, must be valid
+				 * @param ticks The CPU ticks when the counter had the value
+				 * @param value The value of the counter
+				 */
+				void addCounter(const std::string& name, const HighPerformanceTimer::Ticks ticks, const double value);
+
+			public:
+
+				/// The id of the thread owning this buffer.
+				uint64_t threadId_ = 0u;
+
+				/// The events of this buffer.
+				std::vector<TraceEvent> events_;
+
+				/// The overall number of events which have been added to this buffer, while the buffer holds the latest events only.
+				std::atomic<size_t> numberAddedEvents_ = 0;
+		};
+
+		/**
+		 * Definition of a vector holding trace buffers.
+		 */
+		using TraceBuffers = std::vector<std::shared_ptr<TraceBuffer>>;
+
 	protected:
 
 		/**
@@ -746,6 +921,21 @@ class OCEAN_BASE_EXPORT HighPerformanceBenchmark : public Singleton<HighPerforma
 		 */
 		void addMeasurement(const std::string& name, const double measurement);
 
+		/**
+		 * Adds a trace event to the ring buffer of the calling thread.
+		 * @param name The name of the category
+		 * @param startTicks The CPU ticks when the category started
+		 * @param stopTicks The CPU ticks when the category stopped, with range [startTicks, infinity)
+		 * @param frameId The trace frame id when the category started
+		 */
+		void addTraceEvent(const std::string& name, const HighPerformanceTimer::Ticks startTicks, const HighPerformanceTimer::Ticks stopTicks, const TraceFrameId frameId);
+
+		/**
+		 * Returns the trace buffer of the calling thread, a new buffer is registered if necessary.
+		 * @return The thread's trace buffer, nullptr if tracing is not active
+		 */
+		TraceBuffer* threadTraceBuffer();
+
 	protected:
 
 		/**
@@ -766,10 +956,211 @@ class OCEAN_BASE_EXPORT HighPerformanceBenchmark : public Singleton<HighPerforma
 		/// True, if benchmarking is running, false by default.
 		bool isRunning_;
 
+		/// True, if tracing is running, false by default.
+		std::atomic<bool> isTracing_ = false;
+
+		/// The frame id which is assigned to new trace events.
+		std::atomic<TraceFrameId> traceFrameId_ = invalidTraceFrameId_;
+
+		/// The generation of the trace, increased whenever tracing starts so that threads register new buffers.
+		std::atomic<unsigned int> traceGeneration_ = 0u;
+
+		/// The capacity of each new trace buffer.
+		size_t traceEventsPerThread_ = 0;
+
+		/// The CPU ticks when tracing started.
+		HighPerformanceTimer::Ticks traceStartTicks_ = 0;
+
+		/// The trace buffers of all threads which recorded events since tracing started.
+		TraceBuffers traceBuffers_;
+
 		/// The lock object.
 		mutable Lock lock_;
 };
 
+/**
+ * This class implements a profiler for the contention of Lock objects.
+ * The profiler is not running by default, in this case locking a Lock object costs one additional relaxed atomic load.<br>
+ * While running, each acquisition and release of a lock reads the high performance timer once for the hold time, wait times are measured only if the lock is contended.<br>
+ * The profiler determines for each lock the number of acquisitions and contentions, a histogram of the wait times, the hold times, and the thread which acquired the lock most recently.<br>
+ * Locks can be named with Lock::Lock(const char*) so that they can be identified in the report, the statistics of all locks with the same name are combined.<br>
+ * The statistics of destroyed locks are kept, so that short living locks appear in the report as well.
+ * <pre>
+ * LockProfiler::get().start();
+ *
+ * while (keepLooping)
+ * {
+ *     SomeClass::computeSomething();
+ * }
+ *
+ * LockProfiler::get().stop();
+ *
+ * const Strings report = LockProfiler::get().report();
+ * </pre>
+ * @see Lock, HighPerformanceBenchmark.
+ * @ingroup base
+ */
+class OCEAN_BASE_EXPORT LockProfiler : public Singleton<LockProfiler>
+{
+	friend class Singleton<LockProfiler>;
+	friend class Lock;
+
+	public:
+
+		/**
+		 * Definition of a histogram of wait times, bin i holds wait times in range [2^i, 2^(i+1)) microseconds.
+		 */
+		using WaitHistogram = std::array<uint64_t, Lock::ProfilingRecord::histogramBins_>;
+
+		/**
+		 * This class holds the contention statistic of one lock, or of all locks with the same name.
+		 */
+		class LockStatistic
+		{
+			public:
+
+				/**
+				 * Returns the wait time percentile of all contended acquisitions, based on the wait histogram.
+				 * @param percentile The percentile to determine, with range [0, 1]
+				 * @return The upper bound of the histogram bin containing the percentile, in seconds, 0 if the lock has never been contended
+				 */
+				double waitPercentileSeconds(const double percentile) const;
+
+			public:
+
+				/// The name of the lock(s).
+				std::string name_;
+
+				/// The number of lock objects which are combined in this statistic.
+				size_t locks_ = 0;
+
+				/// The number of acquisitions, recursive acquisitions are not counted.
+				uint64_t acquisitions_ = 0u;
+
+				/// The number of acquisitions which had to wait for another thread.
+				uint64_t contentions_ = 0u;
+
+				/// The overall wait time of all contended acquisitions, in seconds.
+				double waitSeconds_ = 0.0;
+
+				/// The maximal wait time of one acquisition, in seconds.
+				double maximalWaitSeconds_ = 0.0;
+
+				/// The overall time the lock(s) have been held, in seconds.
+				double holdSeconds_ = 0.0;
+
+				/// The maximal time a lock has been held at once, in seconds.
+				double maximalHoldSeconds_ = 0.0;
+
+				/// The hash of the id of the thread which acquired the lock most recently, 0 if unknown.
+				uint64_t ownerThreadId_ = 0u;
+
+				/// The histogram of the wait times of all contended acquisitions.
+				WaitHistogram waitHistogram_ = {};
+		};
+
+		/**
+		 * Definition of a vector holding lock statistics.
+		 */
+		using LockStatistics = std::vector<LockStatistic>;
+
+	protected:
+
+		/**
+		 * Forward declaration of the registry of all profiling records.
+		 */
+		class Registry;
+
+	public:
+
+		/**
+		 * Starts profiling all locks.
+		 * @return True, if succeeded; False, if the profiler is already running
+		 * @see stop(), isRunning().
+		 */
+		bool start();
+
+		/**
+		 * Stops profiling, the gathered statistics are kept.
+		 * @return True, if succeeded; False, if the profiler is not running
+		 * @see start(), isRunning().
+		 */
+		bool stop();
+
+		/**
+		 * Resets the statistics of all locks.
+		 */
+		void reset();
+
+		/**
+		 * Returns whether the profiler is currently running; False by default.
+		 * @return True, if so
+		 */
+		bool isRunning() const;
+
+		/**
+		 * Returns the statistics of all profiled locks, locks with the same name are combined.
+		 * @return The statistics, sorted by the overall wait time in descending order
+		 */
+		LockStatistics statistics() const;
+
+		/**
+		 * Creates a contention report as a readable string.
+		 * @param maximalLocks The maximal number of locks in the report, the locks with the highest overall wait time are reported, with range [1, infinity)
+		 * @return The report as readable string, one string for each line in the report
+		 */
+		Strings report(const size_t maximalLocks = 20) const;
+
+	protected:
+
+		/**
+		 * Creates a new profiler object.
+		 */
+		LockProfiler() = default;
+
+		/**
+		 * Creates the profiling record for a lock, called by the lock's owning thread when the lock is profiled for the first time.
+		 * @param lock The lock for which the record will be created
+		 * @return The new record, owned by the profiler
+		 */
+		static Lock::ProfilingRecord* createRecord(const Lock& lock);
+
+		/**
+		 * Releases the profiling record of a lock which is destroyed, the statistic of the lock is kept.
+		 * @param record The record to release, must be valid
+		 */
+		static void releaseRecord(Lock::ProfilingRecord* record);
+
+		/**
+		 * Adds the values of a profiling record to a lock statistic.
+		 * @param record The record to add
+		 * @param statistic The statistic to which the record will be added
+		 */
+		static void addRecord(const Lock::ProfilingRecord& record, LockStatistic& statistic);
+
+		/**
+		 * Adds a lock statistic to another lock statistic.
+		 * @param source The statistic to add
+		 * @param target The statistic to which the source statistic will be added
+		 */
+		static void addStatistic(const LockStatistic& source, LockStatistic& target);
+
+		/**
+		 * Returns the name of a profiling record.
+		 * @param record The record for which the name will be returned
+		 * @param released True, if the lock of the record has been destroyed
+		 * @return The record's name
+		 */
+		static std::string recordName(const Lock::ProfilingRecord& record, const bool released);
+
+		/**
+		 * Returns the registry of all profiling records.
+		 * The registry is created once and never released, as locks may be destroyed during static deinitialization.
+		 * @return The registry
+		 */
+		static Registry& registry();
+};
+
 inline HighPerformanceStatistic::ScopedStatistic::ScopedStatistic(HighPerformanceStatistic& performance) :
 	statisticPerformance(&performance)
 {
@@ -985,7 +1376,8 @@ MessageObject<tActive>& operator<<(MessageObject<tActive>&& messageObject, const
 
 inline HighPerformanceBenchmark::ScopedCategory::ScopedCategory(std::string name) :
 	name_(std::move(name)),
-	startTicks_(HighPerformanceTimer::ticks())
+	startTicks_(HighPerformanceTimer::ticks()),
+	traceFrameId_(HighPerformanceBenchmark::get().traceFrameId())
 {
 	// nothing to do here
 }
@@ -1010,7 +1402,15 @@ inline void HighPerformanceBenchmark::ScopedCategory::release()
 		const HighPerformanceTimer::Ticks ticks = stopTicks - startTicks_;
 
 		const double measurement = HighPerformanceTimer::ticks2seconds(ticks);
-		HighPerformanceBenchmark::get().addMeasurement(name_, measurement);
+
+		HighPerformanceBenchmark& highPerformanceBenchmark = HighPerformanceBenchmark::get();
+
+		highPerformanceBenchmark.addMeasurement(name_, measurement);
+
+		if (highPerformanceBenchmark.isTracing())
+		{
+			highPerformanceBenchmark.addTraceEvent(name_, startTicks_, stopTicks, traceFrameId_);
+		}
 
 		name_.clear();
 	}
@@ -1029,9 +1429,25 @@ inline void HighPerformanceBenchmark::ScopedCategory::change(std::string name)
 	{
 		name_ = std::move(name);
 		startTicks_ = HighPerformanceTimer::ticks();
+		traceFrameId_ = HighPerformanceBenchmark::get().traceFrameId();
 	}
 }
 
+inline bool HighPerformanceBenchmark::isTracing() const
+{
+	return isTracing_.load(std::memory_order_relaxed);
+}
+
+inline void HighPerformanceBenchmark::setTraceFrameId(const TraceFrameId frameId)
+{
+	traceFrameId_.store(frameId, std::memory_order_relaxed);
+}
+
+inline HighPerformanceBenchmark::TraceFrameId HighPerformanceBenchmark::traceFrameId() const
+{
+	return traceFrameId_.load(std::memory_order_relaxed);
+}
+
 inline HighPerformanceBenchmark::HighPerformanceBenchmark() :
 	isRunning_(false)
 {
@@ -12,9 +12,20 @@
 #include "ocean/base/DataType.h"
 #include "ocean/base/Median.h"
 #include "ocean/base/Utilities.h"
+#include "ocean/base/Worker.h"
 
+#include <algorithm>
+#include <array>
 #include <limits>
 
+#if defined(OCEAN_HARDWARE_SSE_VERSION) && OCEAN_HARDWARE_SSE_VERSION >= 20
+	#include <emmintrin.h>
+#elif defined(OCEAN_HARDWARE_NEON_VERSION) && OCEAN_HARDWARE_NEON_VERSION >= 10
+	#if defined(__ARM_NEON__) || defined(__ARM_NEON)
+		#include <arm_neon.h>
+	#endif // __ARM_NEON__
+#endif // OCEAN_HARDWARE_SSE_VERSION, OCEAN_HARDWARE_NEON_VERSION
+
 namespace Ocean
 {
 
@@ -246,6 +257,242 @@ class KdTree
 		const unsigned int dimension_ = 0u;
 };
 
+/**
+ * This class implements a k-d tree with a flat memory layout.
+ * In contrast to KdTree, the tree does not use individual nodes linked by pointers.<br>
+ * The split planes of all inner nodes are stored in one array with an implicit layout, the children of the inner node `i` are the nodes `2i + 1` and `2i + 2`.<br>
+ * All leaves are located in the same depth, each leaf holds a bucket with up to 16 values (and at least 8 values if the tree has more than 16 values).<br>
+ * The values are copied into the buckets in a structure-of-arrays layout so that the distances between a query value and all values of a bucket are determined with SIMD instructions.<br>
+ * The tree returns indices of the values which have been used to build the tree.
+ * @tparam T The data type of one element for all dimensions, either 'float' or 'double'
+ * @see KdTree.
+ * @ingroup base
+ */
+template <typename T>
+class FlatKdTree
+{
+	static_assert(std::is_same<T, float>::value || std::is_same<T, double>::value, "Invalid data type!");
+
+	public:
+
+		/**
+		 * Definition of the data type of square distances.
+		 */
+		using DistanceType = typename SquareValueTyper<T>::Type;
+
+		/**
+		 * Definition of a vector holding square distances.
+		 */
+		using DistanceTypes = std::vector<DistanceType>;
+
+		/**
+		 * Definition of an invalid index.
+		 */
+		static constexpr Index32 invalidIndex = Index32(-1);
+
+		/**
+		 * The maximal number of values in one leaf bucket.
+		 */
+		static constexpr unsigned int bucketSize_ = 16u;
+
+	protected:
+
+		/**
+		 * Definition of a pair combining a square distance and the index of a value.
+		 */
+		using DistanceIndexPair = std::pair<DistanceType, Index32>;
+
+		/**
+		 * Definition of a vector holding pairs of square distances and indices.
+		 */
+		using DistanceIndexPairs = std::vector<DistanceIndexPair>;
+
+		/**
+		 * Definition of an entry of the traversal stack, the index of a node and the lower bound of the square distance to all values of the node.
+		 */
+		using StackEntry = std::pair<Index32, DistanceType>;
+
+		/**
+		 * Definition of the traversal stack, one entry for each level is sufficient.
+		 */
+		using Stack = std::array<StackEntry, 64>;
+
+	public:
+
+		/**
+		 * Creates a new k-d tree.
+		 * @param dimension Number of dimensions the tree will have, with range [1, infinity)
+		 */
+		explicit inline FlatKdTree(const unsigned int dimension);
+
+		/**
+		 * Builds the tree for a given set of values, an existing tree is replaced.
+		 * The values are copied into the tree, so that the given memory does not need to exist after the tree has been built.
+		 * @param values The values, stored consecutively with `dimension()` elements for each value, must be valid if `number != 0`
+		 * @param number The number of values, with range [0, 2^31)
+		 * @param worker Optional worker to distribute the computation
+		 * @return True, if succeeded
+		 */
+		bool build(const T* values, const size_t number, Worker* worker = nullptr);
+
+		/**
+		 * Applies a nearest neighbor search for a given value.
+		 * @param value The value to be searched, with `dimension()` elements, must be valid
+		 * @param sqrDistance The resulting square distance between the value and the nearest neighbor
+		 * @return The index of the nearest neighbor, invalidIndex if the tree is empty
+		 */
+		Index32 nearestNeighbor(const T* value, DistanceType& sqrDistance) const;
+
+		/**
+		 * Applies a k-nearest-neighbors search for a given value.
+		 * @param value The value to be searched, with `dimension()` elements, must be valid
+		 * @param k The number of neighbors to be found, with range [1, infinity)
+		 * @param indices The resulting indices of the neighbors, sorted by ascending distance, must be valid with `k` elements
+		 * @param sqrDistances Optional resulting square distances, one for each resulting index, nullptr if not of interest
+		 * @return The number of found neighbors, with range [0, min(k, size())]
+		 */
+		size_t nearestNeighbors(const T* value, const unsigned int k, Index32* indices, DistanceType* sqrDistances = nullptr) const;
+
+		/**
+		 * Applies a k-nearest-neighbors search for several values.
+		 * @param values The values to be searched, stored consecutively with `dimension()` elements for each value, must be valid
+		 * @param number The number of values to be searched, with range [1, infinity)
+		 * @param k The number of neighbors to be found for each value, with range [1, infinity)
+		 * @param indices The resulting indices of the neighbors, `k` indices for each value sorted by ascending distance, invalidIndex if less than `k` neighbors exist
+		 * @param sqrDistances Optional resulting square distances, one for each resulting index, nullptr if not of interest
+		 * @param worker Optional worker to distribute the computation
+		 */
+		void nearestNeighbors(const T* values, const size_t number, const unsigned int k, Indices32& indices, DistanceTypes* sqrDistances = nullptr, Worker* worker = nullptr) const;
+
+		/**
+		 * Applies a radius search for neighbors of a given value.
+		 * @param value The value to be searched, with `dimension()` elements, must be valid
+		 * @param sqrRadius The square of the neighborhood radius, with range [0, infinity)
+		 * @param indices The resulting indices of all values within the radius, in arbitrary order
+		 * @return The number of found neighbors
+		 */
+		size_t radiusSearch(const T* value, const DistanceType sqrRadius, Indices32& indices) const;
+
+		/**
+		 * Applies a radius search for neighbors of several values.
+		 * @param values The values to be searched, stored consecutively with `dimension()` elements for each value, must be valid
+		 * @param number The number of values to be searched, with range [1, infinity)
+		 * @param sqrRadius The square of the neighborhood radius, with range [0, infinity)
+		 * @param indicesGroups The resulting groups of indices, one group with the indices of all values within the radius for each searched value
+		 * @param worker Optional worker to distribute the computation
+		 */
+		void radiusSearch(const T* values, const size_t number, const DistanceType sqrRadius, std::vector<Indices32>& indicesGroups, Worker* worker = nullptr) const;
+
+		/**
+		 * Returns the dimension of the tree's values.
+		 * @return The tree's dimension
+		 */
+		inline unsigned int dimension() const;
+
+		/**
+		 * Returns the number of values in this tree.
+		 * @return Tree size
+		 */
+		inline size_t size() const;
+
+	protected:
+
+		/**
+		 * Returns the number of inner nodes of this tree.
+		 * @return The number of inner nodes, with range [0, infinity)
+		 */
+		inline Index32 innerNodes() const;
+
+		/**
+		 * Determines the range of values which belong to a node.
+		 * @param node The index of the node, with range [0, 2 * innerNodes()]
+		 * @param begin The resulting index of the first value of the node
+		 * @param end The resulting index of the value after the last value of the node
+		 */
+		inline void nodeRange(const Index32 node, size_t& begin, size_t& end) const;
+
+		/**
+		 * Determines the split planes for a subset of the nodes within one level.
+		 * @param values The values of the tree, must be valid
+		 * @param permutation The permutation of the values, will be partitioned for each node, must be valid
+		 * @param firstNode The first node to be handled
+		 * @param numberNodes The number of nodes to be handled
+		 */
+		void buildNodesSubset(const T* values, Index32* permutation, const unsigned int firstNode, const unsigned int numberNodes);
+
+		/**
+		 * Copies the values of a subset of the leaves into the leaf buckets.
+		 * @param values The values of the tree, must be valid
+		 * @param permutation The permutation of the values, with partitions for all nodes, must be valid
+		 * @param firstLeaf The first leaf to be handled
+		 * @param numberLeaves The number of leaves to be handled
+		 */
+		void fillBucketsSubset(const T* values, const Index32* permutation, const unsigned int firstLeaf, const unsigned int numberLeaves);
+
+		/**
+		 * Applies a k-nearest-neighbors search for a given value.
+		 * @param value The value to be searched, must be valid
+		 * @param k The number of neighbors to be found, with range [1, infinity)
+		 * @param heap The resulting neighbors, ordered as max heap, at most `k` entries
+		 */
+		void nearestNeighbors(const T* value, const unsigned int k, DistanceIndexPairs& heap) const;
+
+		/**
+		 * Applies a k-nearest-neighbors search for a subset of several values.
+		 * @param values The values to be searched, must be valid
+		 * @param k The number of neighbors to be found for each value, with range [1, infinity)
+		 * @param indices The resulting indices, `k` for each value, must be valid
+		 * @param sqrDistances Optional resulting square distances, `k` for each value, nullptr if not of interest
+		 * @param firstValue The first value to be handled
+		 * @param numberValues The number of values to be handled
+		 */
+		void nearestNeighborsSubset(const T* values, const unsigned int k, Index32* indices, DistanceType* sqrDistances, const unsigned int firstValue, const unsigned int numberValues) const;
+
+		/**
+		 * Applies a radius search for a subset of several values.
+		 * @param values The values to be searched, must be valid
+		 * @param sqrRadius The square of the neighborhood radius, with range [0, infinity)
+		 * @param indicesGroups The resulting groups of indices, one for each value, must be valid
+		 * @param firstValue The first value to be handled
+		 * @param numberValues The number of values to be handled
+		 */
+		void radiusSearchSubset(const T* values, const DistanceType sqrRadius, Indices32* indicesGroups, const unsigned int firstValue, const unsigned int numberValues) const;
+
+		/**
+		 * Determines the square distances between a value and all values of a leaf bucket.
+		 * @param leaf The index of the leaf, with range [0, innerNodes()]
+		 * @param value The value for which the distances will be determined, must be valid
+		 * @param sqrDistances The resulting square distances, one for each slot of the bucket (padding slots included), must be valid
+		 */
+		inline void bucketSquareDistances(const Index32 leaf, const T* value, DistanceType* sqrDistances) const;
+
+	protected:
+
+		/// The values of all leaf buckets, for each leaf `bucketSize_` elements for each dimension.
+		std::vector<T> bucketValues_;
+
+		/// The indices of the values in all leaf buckets, `bucketSize_` indices for each leaf.
+		Indices32 bucketIndices_;
+
+		/// The number of values in each leaf bucket.
+		Indices32 bucketSizes_;
+
+		/// The split values of all inner nodes.
+		std::vector<T> splitValues_;
+
+		/// The split dimensions of all inner nodes.
+		Indices32 splitDimensions_;
+
+		/// The number of values in this tree.
+		size_t size_ = 0;
+
+		/// The number of levels with inner nodes, the tree has 2^levels_ leaves.
+		unsigned int levels_ = 0u;
+
+		/// Number of dimensions.
+		const unsigned int dimension_ = 0u;
+};
+
 template <typename T>
 inline KdTree<T>::Node::Node(const T* value) :
 	value_(value)
@@ -635,6 +882,646 @@ inline typename SquareValueTyper<T>::Type KdTree<T>::determineSquareDistance(con
 	return ssd;
 }
 
+
+template <typename T>
+inline FlatKdTree<T>::FlatKdTree(const unsigned int dimension) :
+	dimension_(dimension)
+{
+	ocean_assert(dimension >= 1u);
+}
+
+template <typename T>
+bool FlatKdTree<T>::build(const T* values, const size_t number, Worker* worker)
+{
+	ocean_assert(values != nullptr || number == 0);
+	ocean_assert(number < size_t(1u << 31u));
+
+	bucketValues_.clear();
+	bucketIndices_.clear();
+	bucketSizes_.clear();
+	splitValues_.clear();
+	splitDimensions_.clear();
+
+	size_ = 0;
+	levels_ = 0u;
+
+	if (number == 0)
+	{
+		return true;
+	}
+
+	if (values == nullptr || number >= size_t(1u << 31u) || dimension_ == 0u)
+	{
+		return false;
+	}
+
+	// all leaves are located in the same level, nodes are split in halves until all leaves fit into a bucket
+
+	while (((number + (size_t(1) << levels_) - 1) >> levels_) > size_t(bucketSize_))
+	{
+		++levels_;
+	}
+
+	size_ = number;
+
+	const Index32 numberInnerNodes = innerNodes();
+	const Index32 numberLeaves = numberInnerNodes + 1u;
+
+	splitValues_.resize(numberInnerNodes);
+	splitDimensions_.resize(numberInnerNodes);
+
+	Indices32 permutation(createIndices<Index32>(number, 0u));
+
+	for (unsigned int level = 0u; level < levels_; ++level)
+	{
+		// the nodes within one level cover disjoint ranges of the permutation
+
+		const unsigned int firstNode = (1u << level) - 1u;
+		const unsigned int numberNodes = 1u << level;
+
+		if (worker != nullptr && numberNodes >= 2u)
+		{
+			worker->executeFunction(Worker::Function::create(*this, &FlatKdTree<T>::buildNodesSubset, values, permutation.data(), 0u, 0u), firstNode, numberNodes);
+		}
+		else
+		{
+			buildNodesSubset(values, permutation.data(), firstNode, numberNodes);
+		}
+	}
+
+	bucketValues_.resize(size_t(numberLeaves) * size_t(dimension_) * size_t(bucketSize_), T(0));
+	bucketIndices_.resize(size_t(numberLeaves) * size_t(bucketSize_), invalidIndex);
+	bucketSizes_.resize(numberLeaves);
+
+	if (worker != nullptr && numberLeaves >= 2u)
+	{
+		worker->executeFunction(Worker::Function::create(*this, &FlatKdTree<T>::fillBucketsSubset, values, (const Index32*)(permutation.data()), 0u, 0u), 0u, numberLeaves);
+	}
+	else
+	{
+		fillBucketsSubset(values, permutation.data(), 0u, numberLeaves);
+	}
+
+	return true;
+}
+
+template <typename T>
+Index32 FlatKdTree<T>::nearestNeighbor(const T* value, DistanceType& sqrDistance) const
+{
+	ocean_assert(value != nullptr);
+
+	sqrDistance = std::numeric_limits<DistanceType>::max();
+
+	if (size_ == 0)
+	{
+		return invalidIndex;
+	}
+
+	const Index32 numberInnerNodes = innerNodes();
+
+	Index32 nearest = invalidIndex;
+
+	Stack stack;
+	size_t stackSize = 0;
+
+	stack[stackSize++] = StackEntry(0u, DistanceType(0));
+
+	DistanceType sqrDistances[bucketSize_];
+
+	while (stackSize != 0)
+	{
+		const StackEntry entry = stack[--stackSize];
+
+		if (entry.second >= sqrDistance)
+		{
+			continue;
+		}
+
+		Index32 node = entry.first;
+
+		while (node < numberInnerNodes)
+		{
+			const DistanceType difference = DistanceType(value[splitDimensions_[node]] - splitValues_[node]);
+
+			const Index32 nearChild = difference < DistanceType(0) ? 2u * node + 1u : 2u * node + 2u;
+			const Index32 farChild = difference < DistanceType(0) ? 2u * node + 2u : 2u * node + 1u;
+
+			ocean_assert(stackSize < stack.size());
+			stack[stackSize++] = StackEntry(farChild, std::max(entry.second, difference * difference));
+
+			node = nearChild;
+		}
+
+		const Index32 leaf = node - numberInnerNodes;
+
+		bucketSquareDistances(leaf, value, sqrDistances);
+
+		const Index32* const indices = bucketIndices_.data() + size_t(leaf) * size_t(bucketSize_);
+
+		for (Index32 n = 0u; n < bucketSizes_[leaf]; ++n)
+		{
+			if (sqrDistances[n] < sqrDistance)
+			{
+				sqrDistance = sqrDistances[n];
+				nearest = indices[n];
+			}
+		}
+	}
+
+	return nearest;
+}
+
+template <typename T>
+size_t FlatKdTree<T>::nearestNeighbors(const T* value, const unsigned int k, Index32* indices, DistanceType* sqrDistances) const
+{
+	ocean_assert(value != nullptr && indices != nullptr);
+	ocean_assert(k >= 1u);
+
+	DistanceIndexPairs heap;
+	nearestNeighbors(value, k, heap);
+
+	std::sort_heap(heap.begin(), heap.end());
+
+	for (size_t n = 0; n < heap.size(); ++n)
+	{
+		indices[n] = heap[n].second;
+
+		if (sqrDistances != nullptr)
+		{
+			sqrDistances[n] = heap[n].first;
+		}
+	}
+
+	return heap.size();
+}
+
+template <typename T>
+void FlatKdTree<T>::nearestNeighbors(const T* values, const size_t number, const unsigned int k, Indices32& indices, DistanceTypes* sqrDistances, Worker* worker) const
+{
+	ocean_assert(values != nullptr && number >= 1);
+	ocean_assert(k >= 1u);
+
+	indices.resize(number * size_t(k));
+
+	if (sqrDistances != nullptr)
+	{
+		sqrDistances->resize(number * size_t(k));
+	}
+
+	DistanceType* const sqrDistancesData = sqrDistances != nullptr ? sqrDistances->data() : nullptr;
+
+	if (worker != nullptr && number >= 64)
+	{
+		worker->executeFunction(Worker::Function::create(*this, &FlatKdTree<T>::nearestNeighborsSubset, values, k, indices.data(), sqrDistancesData, 0u, 0u), 0u, (unsigned int)(number), 4u, 5u, 16u);
+	}
+	else
+	{
+		nearestNeighborsSubset(values, k, indices.data(), sqrDistancesData, 0u, (unsigned int)(number));
+	}
+}
+
+template <typename T>
+size_t FlatKdTree<T>::radiusSearch(const T* value, const DistanceType sqrRadius, Indices32& indices) const
+{
+	ocean_assert(value != nullptr);
+	ocean_assert(sqrRadius >= DistanceType(0));
+
+	indices.clear();
+
+	if (size_ == 0)
+	{
+		return 0;
+	}
+
+	const Index32 numberInnerNodes = innerNodes();
+
+	Stack stack;
+	size_t stackSize = 0;
+
+	stack[stackSize++] = StackEntry(0u, DistanceType(0));
+
+	DistanceType sqrDistances[bucketSize_];
+
+	while (stackSize != 0)
+	{
+		const StackEntry entry = stack[--stackSize];
+
+		if (entry.second > sqrRadius)
+		{
+			continue;
+		}
+
+		Index32 node = entry.first;
+
+		while (node < numberInnerNodes)
+		{
+			const DistanceType difference = DistanceType(value[splitDimensions_[node]] - splitValues_[node]);
+			const DistanceType sqrDifference = difference * difference;
+
+			const Index32 nearChild = difference < DistanceType(0) ? 2u * node + 1u : 2u * node + 2u;
+
+			if (sqrDifference <= sqrRadius)
+			{
+				const Index32 farChild = difference < DistanceType(0) ? 2u * node + 2u : 2u * node + 1u;
+
+				ocean_assert(stackSize < stack.size());
+				stack[stackSize++] = StackEntry(farChild, std::max(entry.second, sqrDifference));
+			}
+
+			node = nearChild;
+		}
+
+		const Index32 leaf = node - numberInnerNodes;
+
+		bucketSquareDistances(leaf, value, sqrDistances);
+
+		const Index32* const bucketIndices = bucketIndices_.data() + size_t(leaf) * size_t(bucketSize_);
+
+		for (Index32 n = 0u; n < bucketSizes_[leaf]; ++n)
+		{
+			if (sqrDistances[n] <= sqrRadius)
+			{
+				indices.emplace_back(bucketIndices[n]);
+			}
+		}
+	}
+
+	return indices.size();
+}
+
+template <typename T>
+void FlatKdTree<T>::radiusSearch(const T* values, const size_t number, const DistanceType sqrRadius, std::vector<Indices32>& indicesGroups, Worker* worker) const
+{
+	ocean_assert(values != nullptr && number >= 1);
+	ocean_assert(sqrRadius >= DistanceType(0));
+
+	indicesGroups.resize(number);
+
+	if (worker != nullptr && number >= 64)
+	{
+		worker->executeFunction(Worker::Function::create(*this, &FlatKdTree<T>::radiusSearchSubset, values, sqrRadius, indicesGroups.data(), 0u, 0u), 0u, (unsigned int)(number), 3u, 4u, 16u);
+	}
+	else
+	{
+		radiusSearchSubset(values, sqrRadius, indicesGroups.data(), 0u, (unsigned int)(number));
+	}
+}
+
+template <typename T>
+inline unsigned int FlatKdTree<T>::dimension() const
+{
+	return dimension_;
+}
+
+template <typename T>
+inline size_t FlatKdTree<T>::size() const
+{
+	return size_;
+}
+
+template <typename T>
+inline Index32 FlatKdTree<T>::innerNodes() const
+{
+	return (1u << levels_) - 1u;
+}
+
+template <typename T>
+inline void FlatKdTree<T>::nodeRange(const Index32 node, size_t& begin, size_t& end) const
+{
+	ocean_assert(node <= 2u * innerNodes());
+
+	unsigned int level = 0u;
+	while ((2u << level) - 1u <= node)
+	{
+		++level;
+	}
+
+	// the position of the node within its level defines the path from the root, one bit per level, the most significant bit first
+
+	const Index32 position = node + 1u - (1u << level);
+
+	begin = 0;
+	end = size_;
+
+	for (unsigned int n = level; n != 0u; --n)
+	{
+		const size_t middle = begin + (end - begin) / 2;
+
+		if ((position >> (n - 1u)) & 1u)
+		{
+			begin = middle;
+		}
+		else
+		{
+			end = middle;
+		}
+	}
+}
+
+template <typename T>
+void FlatKdTree<T>::buildNodesSubset(const T* values, Index32* permutation, const unsigned int firstNode, const unsigned int numberNodes)
+{
+	ocean_assert(values != nullptr && permutation != nullptr);
+	ocean_assert(firstNode + numberNodes <= innerNodes());
+
+	std::vector<T> minimalValues(dimension_);
+	std::vector<T> maximalValues(dimension_);
+
+	for (unsigned int node = firstNode; node < firstNode + numberNodes; ++node)
+	{
+		size_t begin = 0;
+		size_t end = 0;
+		nodeRange(node, begin, end);
+
+		ocean_assert(end - begin >= size_t(bucketSize_));
+
+		// the node is split along the dimension with largest extent
+
+		const T* const firstValue = values + size_t(permutation[begin]) * size_t(dimension_);
+
+		for (unsigned int d = 0u; d < dimension_; ++d)
+		{
+			minimalValues[d] = firstValue[d];
+			maximalValues[d] = firstValue[d];
+		}
+
+		for (size_t n = begin + 1; n < end; ++n)
+		{
+			const T* const value = values + size_t(permutation[n]) * size_t(dimension_);
+
+			for (unsigned int d = 0u; d < dimension_; ++d)
+			{
+				minimalValues[d] = std::min(minimalValues[d], value[d]);
+				maximalValues[d] = std::max(maximalValues[d], value[d]);
+			}
+		}
+
+		unsigned int splitDimension = 0u;
+
+		for (unsigned int d = 1u; d < dimension_; ++d)
+		{
+			if (maximalValues[d] - minimalValues[d] > maximalValues[splitDimension] - minimalValues[splitDimension])
+			{
+				splitDimension = d;
+			}
+		}
+
+		const size_t middle = begin + (end - begin) / 2;
+
+		std::nth_element(permutation + begin, permutation + middle, permutation + end, [values, splitDimension, this](const Index32 first, const Index32 second)
+		{
+			return values[size_t(first) * size_t(dimension_) + splitDimension] < values[size_t(second) * size_t(dimension_) + splitDimension];
+		});
+
+		// all values of the left child are not larger than the split value, all values of the right child are not smaller
+
+		splitValues_[node] = values[size_t(permutation[middle]) * size_t(dimension_) + splitDimension];
+		splitDimensions_[node] = splitDimension;
+	}
+}
+
+template <typename T>
+void FlatKdTree<T>::fillBucketsSubset(const T* values, const Index32* permutation, const unsigned int firstLeaf, const unsigned int numberLeaves)
+{
+	ocean_assert(values != nullptr && permutation != nullptr);
+	ocean_assert(firstLeaf + numberLeaves <= innerNodes() + 1u);
+
+	const Index32 numberInnerNodes = innerNodes();
+
+	for (unsigned int leaf = firstLeaf; leaf < firstLeaf + numberLeaves; ++leaf)
+	{
+		size_t begin = 0;
+		size_t end = 0;
+		nodeRange(numberInnerNodes + leaf, begin, end);
+
+		ocean_assert(end - begin <= size_t(bucketSize_));
+		ocean_assert(size_ <= size_t(bucketSize_) || end - begin >= size_t(bucketSize_ / 2u));
+
+		bucketSizes_[leaf] = Index32(end - begin);
+
+		T* const bucketValues = bucketValues_.data() + size_t(leaf) * size_t(dimension_) * size_t(bucketSize_);
+		Index32* const bucketIndices = bucketIndices_.data() + size_t(leaf) * size_t(bucketSize_);
+
+		for (size_t n = begin; n < end; ++n)
+		{
+			const Index32 index = permutation[n];
+			const T* const value = values + size_t(index) * size_t(dimension_);
+
+			for (unsigned int d = 0u; d < dimension_; ++d)
+			{
+				bucketValues[d * bucketSize_ + (n - begin)] = value[d];
+			}
+
+			bucketIndices[n - begin] = index;
+		}
+	}
+}
+
+template <typename T>
+void FlatKdTree<T>::nearestNeighbors(const T* value, const unsigned int k, DistanceIndexPairs& heap) const
+{
+	ocean_assert(value != nullptr);
+	ocean_assert(k >= 1u);
+
+	heap.clear();
+
+	if (size_ == 0)
+	{
+		return;
+	}
+
+	const Index32 numberInnerNodes = innerNodes();
+
+	Stack stack;
+	size_t stackSize = 0;
+
+	stack[stackSize++] = StackEntry(0u, DistanceType(0));
+
+	DistanceType sqrDistances[bucketSize_];
+
+	while (stackSize != 0)
+	{
+		const StackEntry entry = stack[--stackSize];
+
+		if (heap.size() == size_t(k) && entry.second >= heap.front().first)
+		{
+			continue;
+		}
+
+		Index32 node = entry.first;
+
+		while (node < numberInnerNodes)
+		{
+			const DistanceType difference = DistanceType(value[splitDimensions_[node]] - splitValues_[node]);
+
+			const Index32 nearChild = difference < DistanceType(0) ? 2u * node + 1u : 2u * node + 2u;
+			const Index32 farChild = difference < DistanceType(0) ? 2u * node + 2u : 2u * node + 1u;
+
+			ocean_assert(stackSize < stack.size());
+			stack[stackSize++] = StackEntry(farChild, std::max(entry.second, difference * difference));
+
+			node = nearChild;
+		}
+
+		const Index32 leaf = node - numberInnerNodes;
+
+		bucketSquareDistances(leaf, value, sqrDistances);
+
+		const Index32* const bucketIndices = bucketIndices_.data() + size_t(leaf) * size_t(bucketSize_);
+
+		for (Index32 n = 0u; n < bucketSizes_[leaf]; ++n)
+		{
+			if (heap.size() < size_t(k))
+			{
+				heap.emplace_back(sqrDistances[n], bucketIndices[n]);
+				std::push_heap(heap.begin(), heap.end());
+			}
+			else if (sqrDistances[n] < heap.front().first)
+			{
+				std::pop_heap(heap.begin(), heap.end());
+				heap.back() = DistanceIndexPair(sqrDistances[n], bucketIndices[n]);
+				std::push_heap(heap.begin(), heap.end());
+			}
+		}
+	}
+}
+
+template <typename T>
+void FlatKdTree<T>::nearestNeighborsSubset(const T* values, const unsigned int k, Index32* indices, DistanceType* sqrDistances, const unsigned int firstValue, const unsigned int numberValues) const
+{
+	ocean_assert(values != nullptr && indices != nullptr);
+
+	DistanceIndexPairs heap;
+	heap.reserve(k);
+
+	for (unsigned int n = firstValue; n < firstValue + numberValues; ++n)
+	{
+		nearestNeighbors(values + size_t(n) * size_t(dimension_), k, heap);
+
+		std::sort_heap(heap.begin(), heap.end());
+
+		Index32* const valueIndices = indices + size_t(n) * size_t(k);
+		DistanceType* const valueSqrDistances = sqrDistances != nullptr ? sqrDistances + size_t(n) * size_t(k) : nullptr;
+
+		for (unsigned int i = 0u; i < k; ++i)
+		{
+			const bool found = i < heap.size();
+
+			valueIndices[i] = found ? heap[i].second : invalidIndex;
+
+			if (valueSqrDistances != nullptr)
+			{
+				valueSqrDistances[i] = found ? heap[i].first : std::numeric_limits<DistanceType>::max();
+			}
+		}
+	}
+}
+
+template <typename T>
+void FlatKdTree<T>::radiusSearchSubset(const T* values, const DistanceType sqrRadius, Indices32* indicesGroups, const unsigned int firstValue, const unsigned int numberValues) const
+{
+	ocean_assert(values != nullptr && indicesGroups != nullptr);
+
+	for (unsigned int n = firstValue; n < firstValue + numberValues; ++n)
+	{
+		radiusSearch(values + size_t(n) * size_t(dimension_), sqrRadius, indicesGroups[n]);
+	}
+}
+
+template <typename T>
+inline void FlatKdTree<T>::bucketSquareDistances(const Index32 leaf, const T* value, DistanceType* sqrDistances) const
+{
+	static_assert(bucketSize_ == 16u, "Invalid bucket size!");
+
+	ocean_assert(value != nullptr && sqrDistances != nullptr);
+	ocean_assert(size_t(leaf) < bucketSizes_.size());
+
+	const T* const bucketValues = bucketValues_.data() + size_t(leaf) * size_t(dimension_) * size_t(bucketSize_);
+
+	if constexpr (std::is_same<T, float>::value)
+	{
+#if defined(OCEAN_HARDWARE_SSE_VERSION) && OCEAN_HARDWARE_SSE_VERSION >= 20
+
+		__m128 sqrDistances_f_32x4_0 = _mm_setzero_ps();
+		__m128 sqrDistances_f_32x4_1 = _mm_setzero_ps();
+		__m128 sqrDistances_f_32x4_2 = _mm_setzero_ps();
+		__m128 sqrDistances_f_32x4_3 = _mm_setzero_ps();
+
+		for (unsigned int d = 0u; d < dimension_; ++d)
+		{
+			const __m128 value_f_32x4 = _mm_set1_ps(value[d]);
+			const float* const dimensionValues = bucketValues + d * bucketSize_;
+
+			const __m128 difference_f_32x4_0 = _mm_sub_ps(_mm_loadu_ps(dimensionValues + 0), value_f_32x4);
+			const __m128 difference_f_32x4_1 = _mm_sub_ps(_mm_loadu_ps(dimensionValues + 4), value_f_32x4);
+			const __m128 difference_f_32x4_2 = _mm_sub_ps(_mm_loadu_ps(dimensionValues + 8), value_f_32x4);
+			const __m128 difference_f_32x4_3 = _mm_sub_ps(_mm_loadu_ps(dimensionValues + 12), value_f_32x4);
+
+			sqrDistances_f_32x4_0 = _mm_add_ps(sqrDistances_f_32x4_0, _mm_mul_ps(difference_f_32x4_0, difference_f_32x4_0));
+			sqrDistances_f_32x4_1 = _mm_add_ps(sqrDistances_f_32x4_1, _mm_mul_ps(difference_f_32x4_1, difference_f_32x4_1));
+			sqrDistances_f_32x4_2 = _mm_add_ps(sqrDistances_f_32x4_2, _mm_mul_ps(difference_f_32x4_2, difference_f_32x4_2));
+			sqrDistances_f_32x4_3 = _mm_add_ps(sqrDistances_f_32x4_3, _mm_mul_ps(difference_f_32x4_3, difference_f_32x4_3));
+		}
+
+		_mm_storeu_ps(sqrDistances + 0, sqrDistances_f_32x4_0);
+		_mm_storeu_ps(sqrDistances + 4, sqrDistances_f_32x4_1);
+		_mm_storeu_ps(sqrDistances + 8, sqrDistances_f_32x4_2);
+		_mm_storeu_ps(sqrDistances + 12, sqrDistances_f_32x4_3);
+
+		return;
+
+#elif defined(OCEAN_HARDWARE_NEON_VERSION) && OCEAN_HARDWARE_NEON_VERSION >= 10
+
+		float32x4_t sqrDistances_f_32x4_0 = vdupq_n_f32(0.0f);
+		float32x4_t sqrDistances_f_32x4_1 = vdupq_n_f32(0.0f);
+		float32x4_t sqrDistances_f_32x4_2 = vdupq_n_f32(0.0f);
+		float32x4_t sqrDistances_f_32x4_3 = vdupq_n_f32(0.0f);
+
+		for (unsigned int d = 0u; d < dimension_; ++d)
+		{
+			const float32x4_t value_f_32x4 = vdupq_n_f32(value[d]);
+			const float* const dimensionValues = bucketValues + d * bucketSize_;
+
+			const float32x4_t difference_f_32x4_0 = vsubq_f32(vld1q_f32(dimensionValues + 0), value_f_32x4);
+			const float32x4_t difference_f_32x4_1 = vsubq_f32(vld1q_f32(dimensionValues + 4), value_f_32x4);
+			const float32x4_t difference_f_32x4_2 = vsubq_f32(vld1q_f32(dimensionValues + 8), value_f_32x4);
+			const float32x4_t difference_f_32x4_3 = vsubq_f32(vld1q_f32(dimensionValues + 12), value_f_32x4);
+
+			sqrDistances_f_32x4_0 = vmlaq_f32(sqrDistances_f_32x4_0, difference_f_32x4_0, difference_f_32x4_0);
+			sqrDistances_f_32x4_1 = vmlaq_f32(sqrDistances_f_32x4_1, difference_f_32x4_1, difference_f_32x4_1);
+			sqrDistances_f_32x4_2 = vmlaq_f32(sqrDistances_f_32x4_2, difference_f_32x4_2, difference_f_32x4_2);
+			sqrDistances_f_32x4_3 = vmlaq_f32(sqrDistances_f_32x4_3, difference_f_32x4_3, difference_f_32x4_3);
+		}
+
+		vst1q_f32(sqrDistances + 0, sqrDistances_f_32x4_0);
+		vst1q_f32(sqrDistances + 4, sqrDistances_f_32x4_1);
+		vst1q_f32(sqrDistances + 8, sqrDistances_f_32x4_2);
+		vst1q_f32(sqrDistances + 12, sqrDistances_f_32x4_3);
+
+		return;
+
+#endif // OCEAN_HARDWARE_SSE_VERSION, OCEAN_HARDWARE_NEON_VERSION
+	}
+
+	// the structure-of-arrays layout allows the compiler to vectorize the remaining cases
+
+	for (unsigned int n = 0u; n < bucketSize_; ++n)
+	{
+		sqrDistances[n] = DistanceType(0);
+	}
+
+	for (unsigned int d = 0u; d < dimension_; ++d)
+	{
+		const T* const dimensionValues = bucketValues + d * bucketSize_;
+
+		for (unsigned int n = 0u; n < bucketSize_; ++n)
+		{
+			const DistanceType difference = DistanceType(dimensionValues[n] - value[d]);
+			sqrDistances[n] += difference * difference;
+		}
+	}
+}
+
 }
 
 #endif // META_OCEAN_BASE_KD_TREE_H
@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "ocean/base/Lock.h"
+#include "ocean/base/HighPerformanceTimer.h"
+#include "ocean/base/Thread.h"
+
+namespace Ocean
+{
+
+std::atomic<bool> Lock::profiling_ = false;
+
+void Lock::lockProfiled()
+{
+	HighPerformanceTimer::Ticks waitTicks = 0;
+
+	// the wait time is measured only if the lock is contended, so that uncontended acquisitions stay cheap
+
+	const bool contended = !tryLockNative();
+
+	if (contended)
+	{
+		const HighPerformanceTimer::Ticks startTicks = HighPerformanceTimer::ticks();
+
+		lockNative();
+
+		waitTicks = std::max(HighPerformanceTimer::Ticks(0), HighPerformanceTimer::ticks() - startTicks);
+	}
+
+	// from now on, this thread owns the lock
+
+	if (profilingDepth_++ != 0u)
+	{
+		// recursive acquisitions are not contended and not counted
+		ocean_assert(!contended);
+		return;
+	}
+
+	if (profilingRecord_ == nullptr)
+	{
+		profilingRecord_ = LockProfiler::createRecord(*this);
+	}
+
+	ProfilingRecord& record = *profilingRecord_;
+
+	// the record is modified by the owning thread only, therefore load and store is sufficient
+
+	record.acquisitions_.store(record.acquisitions_.load(std::memory_order_relaxed) + 1u, std::memory_order_relaxed);
+
+	if (contended)
+	{
+		record.contentions_.store(record.contentions_.load(std::memory_order_relaxed) + 1u, std::memory_order_relaxed);
+		record.waitTicks_.store(record.waitTicks_.load(std::memory_order_relaxed) + uint64_t(waitTicks), std::memory_order_relaxed);
+
+		if (uint64_t(waitTicks) > record.maximalWaitTicks_.load(std::memory_order_relaxed))
+		{
+			record.maximalWaitTicks_.store(uint64_t(waitTicks), std::memory_order_relaxed);
+		}
+
+		const uint64_t waitMicroseconds = uint64_t(HighPerformanceTimer::ticks2seconds(waitTicks) * 1000000.0);
+
+		size_t bin = 0;
+		while (bin + 1 < ProfilingRecord::histogramBins_ && (waitMicroseconds >> (bin + 1)) != 0u)
+		{
+			++bin;
+		}
+
+		record.waitHistogram_[bin].store(record.waitHistogram_[bin].load(std::memory_order_relaxed) + 1u, std::memory_order_relaxed);
+	}
+
+	record.ownerThreadId_.store(Thread::currentThreadId().hash(), std::memory_order_relaxed);
+
+	profilingAcquisitionTicks_ = HighPerformanceTimer::ticks();
+}
+
+void Lock::unlockProfiled()
+{
+	ocean_assert(profilingDepth_ != 0u);
+
+	if (--profilingDepth_ == 0u)
+	{
+		ocean_assert(profilingRecord_ != nullptr);
+		ProfilingRecord& record = *profilingRecord_;
+
+		const uint64_t holdTicks = uint64_t(std::max(HighPerformanceTimer::Ticks(0), HighPerformanceTimer::ticks() - profilingAcquisitionTicks_));
+
+		record.holdTicks_.store(record.holdTicks_.load(std::memory_order_relaxed) + holdTicks, std::memory_order_relaxed);
+
+		if (holdTicks > record.maximalHoldTicks_.load(std::memory_order_relaxed))
+		{
+			record.maximalHoldTicks_.store(holdTicks, std::memory_order_relaxed);
+		}
+	}
+
+	unlockNative();
+}
+
+void Lock::releaseProfilingRecord()
+{
+	ocean_assert(profilingRecord_ != nullptr);
+
+	LockProfiler::releaseRecord(profilingRecord_);
+	profilingRecord_ = nullptr;
+}
+
+}
@@ -10,6 +10,8 @@
 
 #include "ocean/base/Base.h"
 
+#include <atomic>
+
 #if defined(_WINDOWS)
 	#include <winsock2.h>
 	#include <windows.h>
@@ -20,15 +22,77 @@
 namespace Ocean
 {
 
+// Forward declaration.
+class LockProfiler;
+
 /**
  * This class implements a recursive lock object.
  * You can either explicitly lock and unlock an Lock object by using the appropriated functions.<br>
- * However, it's recommended to use the corresponding scope classes for this lock object.
- * @see TemplatedLock, ScopedLock, TemplatedScopedLock, TemporaryScopedLock, OptionalScopedLock.
+ * However, it's recommended to use the corresponding scope classes for this lock object.<br>
+ * Lock objects can be profiled with the LockProfiler, a name helps to identify the lock in the profiler's report.
+ * @see TemplatedLock, ScopedLock, TemplatedScopedLock, TemporaryScopedLock, OptionalScopedLock, LockProfiler.
  * @ingroup base
  */
 class OCEAN_BASE_EXPORT Lock
 {
+	friend class LockProfiler;
+
+	public:
+
+		/**
+		 * This class holds the contention statistic of one lock while the lock is profiled.
+		 * The values are modified only by the thread owning the lock and are read by the LockProfiler, therefore relaxed atomics are sufficient.
+		 * @see LockProfiler.
+		 */
+		class ProfilingRecord
+		{
+			public:
+
+				/// The number of bins of the wait time histogram, bin i holds wait times in range [2^i, 2^(i+1)) microseconds, the first bin holds all shorter and the last bin all longer wait times.
+				static constexpr size_t histogramBins_ = 20;
+
+			public:
+
+				/**
+				 * Creates a new profiling record.
+				 * @param lock The lock to which the record belongs, must be valid
+				 * @param name The name of the lock, nullptr if the lock does not have a name
+				 */
+				inline ProfilingRecord(const Lock* lock, const char* name);
+
+			public:
+
+				/// The lock to which the record belongs.
+				const Lock* lock_ = nullptr;
+
+				/// The name of the lock, nullptr if the lock does not have a name.
+				const char* name_ = nullptr;
+
+				/// The number of acquisitions of the lock, recursive acquisitions are not counted.
+				std::atomic<uint64_t> acquisitions_ = 0u;
+
+				/// The number of acquisitions for which the lock had to wait for another thread.
+				std::atomic<uint64_t> contentions_ = 0u;
+
+				/// The overall wait time of all contended acquisitions, in ticks.
+				std::atomic<uint64_t> waitTicks_ = 0u;
+
+				/// The maximal wait time of one acquisition, in ticks.
+				std::atomic<uint64_t> maximalWaitTicks_ = 0u;
+
+				/// The overall time the lock has been held, in ticks.
+				std::atomic<uint64_t> holdTicks_ = 0u;
+
+				/// The maximal time the lock has been held at once, in ticks.
+				std::atomic<uint64_t> maximalHoldTicks_ = 0u;
+
+				/// The hash of the id of the thread which acquired the lock most recently.
+				std::atomic<uint64_t> ownerThreadId_ = 0u;
+
+				/// The histogram of the wait times of all contended acquisitions.
+				std::atomic<uint64_t> waitHistogram_[histogramBins_] = {};
+		};
+
 	public:
 
 		/**
@@ -36,6 +100,12 @@ class OCEAN_BASE_EXPORT Lock
 		 */
 		inline Lock();
 
+		/**
+		 * Creates a new lock object with name.
+		 * @param name The name of the lock, must be a string with static storage duration (e.g., a string literal), nullptr to create a lock without name
+		 */
+		explicit inline Lock(const char* name);
+
 		/**
 		 * Destructs a lock object.
 		 */
@@ -57,6 +127,12 @@ class OCEAN_BASE_EXPORT Lock
 		 */
 		inline bool isLocked();
 
+		/**
+		 * Returns the name of this lock.
+		 * @return The lock's name, nullptr if the lock does not have a name
+		 */
+		inline const char* name() const;
+
 	protected:
 
 		/**
@@ -72,6 +148,42 @@ class OCEAN_BASE_EXPORT Lock
 		 */
 		Lock& operator=(const Lock& lock) = delete;
 
+		/**
+		 * Initializes the native lock object.
+		 */
+		inline void initializeNative();
+
+		/**
+		 * Locks the native lock object.
+		 */
+		inline void lockNative();
+
+		/**
+		 * Tries to lock the native lock object without waiting.
+		 * @return True, if the lock could be acquired
+		 */
+		inline bool tryLockNative();
+
+		/**
+		 * Unlocks the native lock object.
+		 */
+		inline void unlockNative();
+
+		/**
+		 * Locks the critical section while the lock profiler is running and updates the profiling record.
+		 */
+		void lockProfiled();
+
+		/**
+		 * Unlocks the critical section which has been locked with lockProfiled() and updates the profiling record.
+		 */
+		void unlockProfiled();
+
+		/**
+		 * Releases the profiling record of this lock, the statistic of the lock is kept by the LockProfiler.
+		 */
+		void releaseProfilingRecord();
+
 	protected:
 
 #if defined(_WINDOWS)
@@ -86,6 +198,20 @@ class OCEAN_BASE_EXPORT Lock
 
 #endif
 
+		/// The name of the lock, nullptr if the lock does not have a name.
+		const char* name_ = nullptr;
+
+		/// The profiling record of this lock, nullptr if the lock has not been profiled yet, owned by the LockProfiler.
+		ProfilingRecord* profilingRecord_ = nullptr;
+
+		/// The recursion depth of profiled acquisitions, modified by the owning thread only.
+		unsigned int profilingDepth_ = 0u;
+
+		/// The ticks at which the owning thread acquired the lock, modified by the owning thread only.
+		int64_t profilingAcquisitionTicks_ = 0;
+
+		/// True, if the lock profiler is running.
+		static std::atomic<bool> profiling_;
 };
 
 /**
@@ -432,45 +558,109 @@ class OCEAN_BASE_EXPORT OptionalScopedLock
 		Lock* lock_ = nullptr;
 };
 
+inline Lock::ProfilingRecord::ProfilingRecord(const Lock* lock, const char* name) :
+	lock_(lock),
+	name_(name)
+{
+	ocean_assert(lock_ != nullptr);
+}
+
 inline Lock::Lock()
 {
-#if defined(_WINDOWS)
+	initializeNative();
+}
 
-	InitializeCriticalSection(&criticalSection_);
+inline Lock::Lock(const char* name) :
+	name_(name)
+{
+	initializeNative();
+}
 
-#elif defined(__APPLE__) || defined(__linux__) || defined(__EMSCRIPTEN__)
+inline Lock::~Lock()
+{
+	ocean_assert(profilingDepth_ == 0u);
 
-	pthread_mutexattr_t mutexAttribute;
-	pthread_mutexattr_init(&mutexAttribute);
-	pthread_mutexattr_settype(&mutexAttribute, PTHREAD_MUTEX_RECURSIVE);
-	pthread_mutex_init(&mutex_, &mutexAttribute);
+	if (profilingRecord_ != nullptr)
+	{
+		releaseProfilingRecord();
+	}
+
+#if defined(_WINDOWS)
+
+	ocean_assert(criticalSection_.RecursionCount == 0);
+	DeleteCriticalSection(&criticalSection_);
 
 #else
 
-	pthread_mutexattr_t mutexAttribute = PTHREAD_MUTEX_RECURSIVE;
-	pthread_mutex_init(&mutex_, &mutexAttribute);
+	pthread_mutex_destroy(&mutex_);
 
 #endif
 
 }
 
-inline Lock::~Lock()
+inline void Lock::lock()
+{
+	if (profiling_.load(std::memory_order_relaxed))
+	{
+		lockProfiled();
+		return;
+	}
+
+	lockNative();
+}
+
+inline void Lock::unlock()
+{
+	// the depth is modified by the owning thread only, and the calling thread owns the lock
+
+	if (profilingDepth_ != 0u)
+	{
+		unlockProfiled();
+		return;
+	}
+
+	unlockNative();
+}
+
+inline bool Lock::isLocked()
+{
+	if (tryLockNative())
+	{
+		unlockNative();
+		return false;
+	}
+
+	return true;
+}
+
+inline const char* Lock::name() const
 {
+	return name_;
+}
 
+inline void Lock::initializeNative()
+{
 #if defined(_WINDOWS)
 
-	ocean_assert(criticalSection_.RecursionCount == 0);
-	DeleteCriticalSection(&criticalSection_);
+	InitializeCriticalSection(&criticalSection_);
+
+#elif defined(__APPLE__) || defined(__linux__) || defined(__EMSCRIPTEN__)
+
+	pthread_mutexattr_t mutexAttribute;
+	pthread_mutexattr_init(&mutexAttribute);
+	pthread_mutexattr_settype(&mutexAttribute, PTHREAD_MUTEX_RECURSIVE);
+	pthread_mutex_init(&mutex_, &mutexAttribute);
 
 #else
 
-	pthread_mutex_destroy(&mutex_);
+	pthread_mutexattr_t mutexAttribute = PTHREAD_MUTEX_RECURSIVE;
+	pthread_mutex_init(&mutex_, &mutexAttribute);
 
 #endif
 
 }
 
-inline void Lock::lock()
+inline void Lock::lockNative()
 {
 #if defined(_WINDOWS)
 
@@ -484,42 +674,33 @@ inline void Lock::lock()
 
 }
 
-inline void Lock::unlock()
+inline bool Lock::tryLockNative()
 {
-
 #if defined(_WINDOWS)
 
-	LeaveCriticalSection(&criticalSection_);
+	return TryEnterCriticalSection(&criticalSection_) == TRUE;
 
 #else
 
-	pthread_mutex_unlock(&mutex_);
+	return pthread_mutex_trylock(&mutex_) == 0;
 
 #endif
 
 }
 
-inline bool Lock::isLocked()
+inline void Lock::unlockNative()
 {
+
 #if defined(_WINDOWS)
 
-	if (TryEnterCriticalSection(&criticalSection_) == TRUE)
-	{
-		LeaveCriticalSection(&criticalSection_);
-		return false;
-	}
+	LeaveCriticalSection(&criticalSection_);
 
 #else
 
-	if (pthread_mutex_trylock(&mutex_) == 0)
-	{
-		pthread_mutex_unlock(&mutex_);
-		return false;
-	}
+	pthread_mutex_unlock(&mutex_);
 
 #endif
 
-	return true;
 }
 
 inline ScopedLock::ScopedLock(Lock& lock) :
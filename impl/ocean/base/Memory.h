@@ -9,6 +9,7 @@
 #define META_OCEAN_BASE_MEMORY_H
 
 #include "ocean/base/Base.h"
+#include "ocean/base/MemoryPool.h"
 #include "ocean/base/Worker.h"
 
 namespace Ocean
@@ -16,6 +17,8 @@ namespace Ocean
 
 /**
  * This class implements an object able to allocate memory.
+ * The memory is taken from the MemoryPool if the pool is enabled.
+ * @see MemoryPool.
  * @ingroup base
  */
 class Memory
@@ -221,6 +224,9 @@ class Memory
 
 		/// The size of the actual usable memory in bytes, with range [0, infinity)
 		size_t size_ = 0;
+
+		/// The capacity of the allocated memory block if the block has been taken from the MemoryPool, 0 if the block has been allocated directly.
+		size_t poolCapacity_ = 0;
 };
 
 inline Memory::Memory(Memory&& memory) noexcept :
@@ -238,7 +244,7 @@ inline Memory::Memory(const size_t size, const size_t alignment) :
 	{
 		static_assert(sizeof(uint8_t) == 1, "Invalid data type!");
 
-		allocatedData_ = malloc(size + alignment);
+		allocatedData_ = MemoryPool::isEnabled() ? MemoryPool::get().allocate(size + alignment, poolCapacity_) : malloc(size + alignment);
 		ocean_assert(allocatedData_ != nullptr);
 
 		if (allocatedData_ != nullptr)
@@ -373,9 +379,17 @@ inline void Memory::free()
 	{
 		ocean_assert(alignedData_ != nullptr);
 
-		::free(allocatedData_);
+		if (poolCapacity_ != 0)
+		{
+			MemoryPool::get().free(allocatedData_, poolCapacity_);
+		}
+		else
+		{
+			::free(allocatedData_);
+		}
 
 		allocatedData_ = nullptr;
+		poolCapacity_ = 0;
 	}
 
 	constAlignedData_ = nullptr;
@@ -422,8 +436,10 @@ inline Memory& Memory::operator=(Memory&& memory) noexcept
 		constAlignedData_ = memory.constAlignedData_;
 		alignedData_ = memory.alignedData_;
 		size_ = memory.size_;
+		poolCapacity_ = memory.poolCapacity_;
 
 		memory.allocatedData_ = nullptr;
+		memory.poolCapacity_ = 0;
 		memory.constAlignedData_ = nullptr;
 		memory.alignedData_ = nullptr;
 		memory.size_ = size_t(0);
@@ -0,0 +1,180 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "ocean/base/MemoryPool.h"
+
+#include <cstdlib>
+
+namespace Ocean
+{
+
+std::atomic<bool> MemoryPool::enabled_ = false;
+
+MemoryPool::~MemoryPool()
+{
+	clear();
+}
+
+void MemoryPool::setEnabled(const bool enable)
+{
+	enabled_ = enable;
+}
+
+void MemoryPool::setMaximalCachedBytes(const size_t bytes)
+{
+	const ScopedLock scopedLock(lock_);
+
+	maximalCachedBytes_ = bytes;
+}
+
+void* MemoryPool::allocate(const size_t size, size_t& capacity)
+{
+	ocean_assert(size != 0);
+
+	if (!isEnabled() || !isPoolable(size))
+	{
+		capacity = 0;
+		return malloc(size);
+	}
+
+	const unsigned int bucket = bucketIndex(size);
+	ocean_assert(bucket < numberBuckets_);
+
+	capacity = bucketCapacity(bucket);
+	ocean_assert(capacity >= size);
+
+	TemporaryScopedLock scopedLock(lock_);
+
+	Blocks& blocks = buckets_[bucket];
+
+	if (!blocks.empty())
+	{
+		void* memory = blocks.back();
+		blocks.pop_back();
+
+		ocean_assert(statistic_.cachedBytes_ >= capacity);
+		statistic_.cachedBytes_ -= capacity;
+
+		++statistic_.hits_;
+
+		return memory;
+	}
+
+	++statistic_.misses_;
+
+	scopedLock.release();
+
+	void* memory = malloc(capacity);
+
+	if (memory == nullptr)
+	{
+		capacity = 0;
+	}
+
+	return memory;
+}
+
+void MemoryPool::free(void* memory, const size_t capacity)
+{
+	ocean_assert(memory != nullptr);
+
+	if (capacity == 0)
+	{
+		::free(memory);
+		return;
+	}
+
+	const unsigned int bucket = bucketIndex(capacity);
+	ocean_assert(bucketCapacity(bucket) == capacity);
+
+	TemporaryScopedLock scopedLock(lock_);
+
+	if (statistic_.cachedBytes_ + capacity <= maximalCachedBytes_)
+	{
+		buckets_[bucket].emplace_back(memory);
+		statistic_.cachedBytes_ += capacity;
+
+		++statistic_.recycled_;
+
+		return;
+	}
+
+	++statistic_.discarded_;
+
+	scopedLock.release();
+
+	::free(memory);
+}
+
+void MemoryPool::clear()
+{
+	const ScopedLock scopedLock(lock_);
+
+	for (Blocks& blocks : buckets_)
+	{
+		for (void* memory : blocks)
+		{
+			::free(memory);
+		}
+
+		blocks.clear();
+	}
+
+	statistic_.cachedBytes_ = 0;
+}
+
+MemoryPool::Statistic MemoryPool::statistic() const
+{
+	const ScopedLock scopedLock(lock_);
+
+	return statistic_;
+}
+
+void MemoryPool::resetStatistic()
+{
+	const ScopedLock scopedLock(lock_);
+
+	statistic_.hits_ = 0ull;
+	statistic_.misses_ = 0ull;
+	statistic_.recycled_ = 0ull;
+	statistic_.discarded_ = 0ull;
+}
+
+unsigned int MemoryPool::bucketIndex(const size_t size)
+{
+	ocean_assert(size >= minimalPoolSize_);
+
+	// the bucket holds blocks with capacity (4 + subBucket + 1) * 2^(k - 2), with 2^k <= size - 1 < 2^(k+1)
+
+	const uint64_t value = uint64_t(size - 1);
+
+	unsigned int highestBit = 0u;
+	while ((value >> (highestBit + 1u)) != 0ull)
+	{
+		++highestBit;
+	}
+
+	ocean_assert(highestBit >= subBucketBits_);
+
+	const unsigned int subBucket = (unsigned int)((value >> (highestBit - subBucketBits_)) & ((1ull << subBucketBits_) - 1ull));
+
+	return (highestBit << subBucketBits_) + subBucket;
+}
+
+size_t MemoryPool::bucketCapacity(const unsigned int bucket)
+{
+	ocean_assert(bucket < numberBuckets_);
+
+	const unsigned int highestBit = bucket >> subBucketBits_;
+	const unsigned int subBucket = bucket & ((1u << subBucketBits_) - 1u);
+
+	ocean_assert(highestBit >= subBucketBits_);
+
+	return size_t((1u << subBucketBits_) + subBucket + 1u) << (highestBit - subBucketBits_);
+}
+
+}
@@ -0,0 +1,272 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#ifndef META_OCEAN_BASE_MEMORY_POOL_H
+#define META_OCEAN_BASE_MEMORY_POOL_H
+
+#include "ocean/base/Base.h"
+#include "ocean/base/Lock.h"
+#include "ocean/base/Singleton.h"
+
+#include <atomic>
+#include <vector>
+
+namespace Ocean
+{
+
+/**
+ * This class implements a thread-safe, size-bucketed pool recycling memory blocks.
+ * The pool is intended for frequently created temporary buffers of identical size, e.g., camera frames or frame pyramids which are created and released at camera frame rate.<br>
+ * The pool is disabled by default, once enabled, the memory of Frame planes and of Memory objects (e.g., used by CV::FramePyramid) is taken from the pool.<br>
+ * Blocks are grouped in buckets with four sub-buckets per power of two, so that a recycled block is at most 25% larger than requested.<br>
+ * Small blocks are not pooled and are allocated directly.
+ * @see Frame, Memory.
+ * @ingroup base
+ */
+class OCEAN_BASE_EXPORT MemoryPool : public Singleton<MemoryPool>
+{
+	friend class Singleton<MemoryPool>;
+
+	public:
+
+		/**
+		 * This class holds the usage statistic of the pool.
+		 */
+		class Statistic
+		{
+			friend class MemoryPool;
+
+			public:
+
+				/**
+				 * Returns the number of allocations which have been served by a recycled block.
+				 * @return The number of pool hits
+				 */
+				inline uint64_t hits() const;
+
+				/**
+				 * Returns the number of allocations which needed a new block.
+				 * @return The number of pool misses
+				 */
+				inline uint64_t misses() const;
+
+				/**
+				 * Returns the number of blocks which have been returned to the pool.
+				 * @return The number of recycled blocks
+				 */
+				inline uint64_t recycled() const;
+
+				/**
+				 * Returns the number of blocks which have been freed as the pool was full.
+				 * @return The number of discarded blocks
+				 */
+				inline uint64_t discarded() const;
+
+				/**
+				 * Returns the number of bytes currently cached in the pool.
+				 * @return The cached bytes
+				 */
+				inline size_t cachedBytes() const;
+
+				/**
+				 * Returns the ratio between hits and all allocations.
+				 * @return The hit ratio, with range [0, 1]
+				 */
+				inline double hitRatio() const;
+
+			protected:
+
+				/// The number of pool hits.
+				uint64_t hits_ = 0ull;
+
+				/// The number of pool misses.
+				uint64_t misses_ = 0ull;
+
+				/// The number of recycled blocks.
+				uint64_t recycled_ = 0ull;
+
+				/// The number of discarded blocks.
+				uint64_t discarded_ = 0ull;
+
+				/// The number of cached bytes.
+				size_t cachedBytes_ = 0;
+		};
+
+	protected:
+
+		/**
+		 * Definition of a vector holding memory blocks.
+		 */
+		using Blocks = std::vector<void*>;
+
+		/**
+		 * The number of bits for sub-buckets within one power of two.
+		 */
+		static constexpr unsigned int subBucketBits_ = 2u;
+
+		/**
+		 * The number of buckets.
+		 */
+		static constexpr unsigned int numberBuckets_ = 64u << subBucketBits_;
+
+	public:
+
+		/**
+		 * Enables or disables the pool.
+		 * When disabled, cached blocks stay in the pool until clear() is called, blocks allocated while the pool was enabled are still recycled.
+		 * @param enable True, to enable the pool; False, to disable the pool
+		 */
+		static void setEnabled(const bool enable);
+
+		/**
+		 * Returns whether the pool is enabled.
+		 * @return True, if so
+		 */
+		static inline bool isEnabled();
+
+		/**
+		 * Sets the maximal number of bytes the pool caches, released blocks exceeding this limit are freed.
+		 * @param bytes The maximal number of cached bytes, with range [0, infinity)
+		 */
+		void setMaximalCachedBytes(const size_t bytes);
+
+		/**
+		 * Allocates a memory block from the pool.
+		 * Blocks which are too small to be pooled, or blocks allocated while the pool is disabled are allocated directly (with capacity 0).
+		 * @param size The number of bytes to allocate, with range [1, infinity)
+		 * @param capacity The resulting capacity of the block, which must be provided when the block is returned, with range [size, infinity), 0 if the block is not pooled
+		 * @return The memory block, nullptr if the allocation failed
+		 */
+		void* allocate(const size_t size, size_t& capacity);
+
+		/**
+		 * Returns a memory block to the pool.
+		 * @param memory The memory block to return, allocated via allocate(), must be valid
+		 * @param capacity The capacity of the block as returned by allocate(), 0 if the block is not pooled
+		 */
+		void free(void* memory, const size_t capacity);
+
+		/**
+		 * Frees all blocks which are currently cached.
+		 */
+		void clear();
+
+		/**
+		 * Returns the usage statistic of this pool.
+		 * @return The pool's statistic
+		 */
+		Statistic statistic() const;
+
+		/**
+		 * Resets the usage counters of this pool.
+		 */
+		void resetStatistic();
+
+		/**
+		 * Returns whether a block of given size is pooled, small blocks are allocated directly.
+		 * @param size The size of the block, in bytes
+		 * @return True, if so
+		 */
+		static inline bool isPoolable(const size_t size);
+
+	protected:
+
+		/**
+		 * Creates a new pool object.
+		 */
+		MemoryPool() = default;
+
+		/**
+		 * Destructs the pool and frees all cached blocks.
+		 */
+		~MemoryPool();
+
+		/**
+		 * Returns the index of the bucket holding blocks of a given size.
+		 * @param size The size of the block, in bytes, with range [1, infinity)
+		 * @return The bucket index, with range [0, numberBuckets_)
+		 */
+		static unsigned int bucketIndex(const size_t size);
+
+		/**
+		 * Returns the capacity of blocks within a bucket.
+		 * @param bucket The index of the bucket, with range [0, numberBuckets_)
+		 * @return The capacity, in bytes
+		 */
+		static size_t bucketCapacity(const unsigned int bucket);
+
+	protected:
+
+		/// The buckets holding the cached blocks.
+		Blocks buckets_[numberBuckets_];
+
+		/// The usage statistic.
+		Statistic statistic_;
+
+		/// The maximal number of cached bytes.
+		size_t maximalCachedBytes_ = size_t(256) * size_t(1024 * 1024);
+
+		/// The minimal size of a pooled block, in bytes.
+		static constexpr size_t minimalPoolSize_ = size_t(4096);
+
+		/// The pool's lock.
+		mutable Lock lock_;
+
+		/// True, if the pool is enabled, a static member so that disabled pools do not need to create the singleton.
+		static std::atomic<bool> enabled_;
+};
+
+inline uint64_t MemoryPool::Statistic::hits() const
+{
+	return hits_;
+}
+
+inline uint64_t MemoryPool::Statistic::misses() const
+{
+	return misses_;
+}
+
+inline uint64_t MemoryPool::Statistic::recycled() const
+{
+	return recycled_;
+}
+
+inline uint64_t MemoryPool::Statistic::discarded() const
+{
+	return discarded_;
+}
+
+inline size_t MemoryPool::Statistic::cachedBytes() const
+{
+	return cachedBytes_;
+}
+
+inline double MemoryPool::Statistic::hitRatio() const
+{
+	const uint64_t allocations = hits_ + misses_;
+
+	if (allocations == 0ull)
+	{
+		return 0.0;
+	}
+
+	return double(hits_) / double(allocations);
+}
+
+inline bool MemoryPool::isEnabled()
+{
+	return enabled_.load();
+}
+
+inline bool MemoryPool::isPoolable(const size_t size)
+{
+	return size >= minimalPoolSize_;
+}
+
+}
+
+#endif // META_OCEAN_BASE_MEMORY_POOL_H
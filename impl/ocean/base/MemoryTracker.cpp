@@ -0,0 +1,244 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "ocean/base/MemoryTracker.h"
+#include "ocean/base/Lock.h"
+#include "ocean/base/String.h"
+
+namespace Ocean
+{
+
+namespace
+{
+
+/**
+ * Returns the lock and the names of all registered categories.
+ * The objects are created on first use so that categories can be registered during static initialization.
+ * @param names The resulting names of all registered categories
+ * @return The lock protecting the names
+ */
+Lock& categoryRegistry(Strings*& names)
+{
+	static Lock lock;
+	static Strings registeredNames;
+
+	names = &registeredNames;
+
+	return lock;
+}
+
+}
+
+MemoryTracker::Counters MemoryTracker::counters_[maximalCategories_];
+
+std::atomic<unsigned int> MemoryTracker::numberCategories_(0u);
+
+void MemoryTracker::TrackedBytes::setBytes(const size_t bytes)
+{
+	if (bytes > bytes_)
+	{
+		allocate(categoryId_, bytes - bytes_);
+	}
+	else if (bytes < bytes_)
+	{
+		deallocate(categoryId_, bytes_ - bytes);
+	}
+
+	bytes_ = bytes;
+}
+
+MemoryTracker::TrackedBytes& MemoryTracker::TrackedBytes::operator=(const TrackedBytes& trackedBytes)
+{
+	if (this != &trackedBytes)
+	{
+		setBytes(0);
+
+		categoryId_ = trackedBytes.categoryId_;
+		setBytes(trackedBytes.bytes_);
+	}
+
+	return *this;
+}
+
+MemoryTracker::TrackedBytes& MemoryTracker::TrackedBytes::operator=(TrackedBytes&& trackedBytes) noexcept
+{
+	if (this != &trackedBytes)
+	{
+		setBytes(0);
+
+		categoryId_ = trackedBytes.categoryId_;
+		bytes_ = trackedBytes.bytes_;
+
+		trackedBytes.bytes_ = 0;
+	}
+
+	return *this;
+}
+
+MemoryTracker::CategoryId MemoryTracker::registerCategory(const std::string& name)
+{
+	ocean_assert(!name.empty());
+
+	Strings* names = nullptr;
+	const ScopedLock scopedLock(categoryRegistry(names));
+
+	ocean_assert(names != nullptr);
+
+	for (size_t n = 0; n < names->size(); ++n)
+	{
+		if ((*names)[n] == name)
+		{
+			return CategoryId(n);
+		}
+	}
+
+	if (names->size() >= size_t(maximalCategories_))
+	{
+		ocean_assert(false && "Too many memory categories!");
+		return invalidCategoryId_;
+	}
+
+	names->emplace_back(name);
+	numberCategories_.store((unsigned int)(names->size()));
+
+	return CategoryId(names->size() - 1);
+}
+
+bool MemoryTracker::setBudget(const CategoryId categoryId, const uint64_t budgetBytes)
+{
+	if (categoryId >= numberCategories_.load())
+	{
+		ocean_assert(false && "Invalid category!");
+		return false;
+	}
+
+	counters_[categoryId].budgetBytes_.store(budgetBytes, std::memory_order_relaxed);
+
+	return true;
+}
+
+void MemoryTracker::startFrame()
+{
+	const unsigned int numberCategories = numberCategories_.load();
+
+	for (unsigned int n = 0u; n < numberCategories; ++n)
+	{
+		Counters& counters = counters_[n];
+
+		counters.frameAllocations_.store(0ull, std::memory_order_relaxed);
+		counters.framePeakBytes_.store(counters.currentBytes_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+	}
+}
+
+void MemoryTracker::resetPeaks()
+{
+	const unsigned int numberCategories = numberCategories_.load();
+
+	for (unsigned int n = 0u; n < numberCategories; ++n)
+	{
+		Counters& counters = counters_[n];
+
+		counters.peakBytes_.store(counters.currentBytes_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+	}
+}
+
+MemoryTracker::Statistic MemoryTracker::statistic(const CategoryId categoryId)
+{
+	const Strings names = categoryNames();
+
+	Statistic result;
+
+	if (categoryId >= names.size())
+	{
+		ocean_assert(false && "Invalid category!");
+		return result;
+	}
+
+	const Counters& counters = counters_[categoryId];
+
+	result.name_ = names[categoryId];
+	result.currentBytes_ = counters.currentBytes_.load(std::memory_order_relaxed);
+	result.peakBytes_ = counters.peakBytes_.load(std::memory_order_relaxed);
+	result.framePeakBytes_ = counters.framePeakBytes_.load(std::memory_order_relaxed);
+	result.allocations_ = counters.allocations_.load(std::memory_order_relaxed);
+	result.deallocations_ = counters.deallocations_.load(std::memory_order_relaxed);
+	result.frameAllocations_ = counters.frameAllocations_.load(std::memory_order_relaxed);
+	result.budgetBytes_ = counters.budgetBytes_.load(std::memory_order_relaxed);
+
+	return result;
+}
+
+MemoryTracker::Statistics MemoryTracker::statistics()
+{
+	const size_t numberCategories = categoryNames().size();
+
+	Statistics result;
+	result.reserve(numberCategories);
+
+	for (size_t n = 0; n < numberCategories; ++n)
+	{
+		result.emplace_back(statistic(CategoryId(n)));
+	}
+
+	return result;
+}
+
+MemoryTracker::Statistics MemoryTracker::exceededBudgets()
+{
+	Statistics result;
+
+	for (Statistic& categoryStatistic : statistics())
+	{
+		if (categoryStatistic.exceedsBudget())
+		{
+			result.emplace_back(std::move(categoryStatistic));
+		}
+	}
+
+	return result;
+}
+
+std::string MemoryTracker::report()
+{
+	std::string result;
+
+	for (const Statistic& categoryStatistic : statistics())
+	{
+		if (!result.empty())
+		{
+			result += "\n";
+		}
+
+		result += categoryStatistic.name_ + ": " + String::toAString(double(categoryStatistic.currentBytes_) / (1024.0 * 1024.0), 2u) + "MB";
+		result += ", peak " + String::toAString(double(categoryStatistic.peakBytes_) / (1024.0 * 1024.0), 2u) + "MB";
+		result += ", allocations " + String::toAString(categoryStatistic.allocations_) + " (" + String::toAString(categoryStatistic.frameAllocations_) + " in frame)";
+
+		if (categoryStatistic.budgetBytes_ != 0ull)
+		{
+			result += ", budget " + String::toAString(double(categoryStatistic.budgetBytes_) / (1024.0 * 1024.0), 2u) + "MB";
+
+			if (categoryStatistic.exceedsBudget())
+			{
+				result += " EXCEEDED";
+			}
+		}
+	}
+
+	return result;
+}
+
+Strings MemoryTracker::categoryNames()
+{
+	Strings* names = nullptr;
+	const ScopedLock scopedLock(categoryRegistry(names));
+
+	ocean_assert(names != nullptr);
+
+	return *names;
+}
+
+}
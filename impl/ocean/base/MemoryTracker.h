@@ -0,0 +1,382 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#ifndef META_OCEAN_BASE_MEMORY_TRACKER_H
+#define META_OCEAN_BASE_MEMORY_TRACKER_H
+
+#include "ocean/base/Base.h"
+
+#include <atomic>
+#include <vector>
+
+namespace Ocean
+{
+
+/**
+ * This class implements a thread-safe accounting of memory which is held by individual subsystems.
+ * Subsystems register a named category once and report the bytes they allocate and release, e.g., Frame planes, frame pyramids, descriptor maps, or GPU buffers.<br>
+ * For each category the tracker counts the currently held bytes, the peak bytes, and the number of allocations, in total and since the last call of startFrame().<br>
+ * A budget can be defined for each category so that memory regressions can be detected at runtime.<br>
+ * Reporting bytes does not need any lock, so that the tracker can be used in performance critical code.
+ *
+ * Here is a tutorial how to use this class:
+ * @code
+ * // registering the category once, categories with identical names share the same id
+ * static const MemoryTracker::CategoryId categoryId = MemoryTracker::registerCategory("MyModule");
+ *
+ * MemoryTracker::allocate(categoryId, bytes);
+ * ...
+ * MemoryTracker::deallocate(categoryId, bytes);
+ *
+ * // alternatively, an object can hold a TrackedBytes member which reports the difference whenever the size changes
+ * MemoryTracker::TrackedBytes trackedBytes(categoryId);
+ * trackedBytes.setBytes(buffer.size());
+ *
+ * Log::info() << MemoryTracker::report();
+ * @endcode
+ * @ingroup base
+ */
+class OCEAN_BASE_EXPORT MemoryTracker
+{
+	public:
+
+		/**
+		 * Definition of the id of a memory category.
+		 */
+		using CategoryId = unsigned int;
+
+		/**
+		 * Definition of an invalid category id.
+		 */
+		static constexpr CategoryId invalidCategoryId_ = CategoryId(-1);
+
+		/**
+		 * The maximal number of categories which can be registered.
+		 */
+		static constexpr unsigned int maximalCategories_ = 64u;
+
+		/**
+		 * This class holds the statistic of one memory category.
+		 */
+		class Statistic
+		{
+			public:
+
+				/**
+				 * Returns whether the peak bytes of the category exceed the category's budget.
+				 * @return True, if a budget is defined and if the peak bytes exceed the budget
+				 */
+				inline bool exceedsBudget() const;
+
+			public:
+
+				/// The name of the category.
+				std::string name_;
+
+				/// The number of bytes the category currently holds.
+				uint64_t currentBytes_ = 0ull;
+
+				/// The maximal number of bytes the category held since the peaks have been reset.
+				uint64_t peakBytes_ = 0ull;
+
+				/// The maximal number of bytes the category held since startFrame() has been called.
+				uint64_t framePeakBytes_ = 0ull;
+
+				/// The number of allocations of the category.
+				uint64_t allocations_ = 0ull;
+
+				/// The number of deallocations of the category.
+				uint64_t deallocations_ = 0ull;
+
+				/// The number of allocations of the category since startFrame() has been called.
+				uint64_t frameAllocations_ = 0ull;
+
+				/// The budget of the category in bytes, 0 if no budget is defined.
+				uint64_t budgetBytes_ = 0ull;
+		};
+
+		/**
+		 * Definition of a vector holding statistics.
+		 */
+		using Statistics = std::vector<Statistic>;
+
+		/**
+		 * This class implements a helper object which reports the bytes of an owning object to a category.
+		 * Whenever the number of bytes changes, the difference is reported; the remaining bytes are released when the object is disposed.<br>
+		 * A copy of the object reports its bytes again, as the owning object's memory is copied as well.
+		 */
+		class OCEAN_BASE_EXPORT TrackedBytes
+		{
+			public:
+
+				/**
+				 * Creates a new object without category.
+				 */
+				TrackedBytes() = default;
+
+				/**
+				 * Creates a new object for a specified category.
+				 * @param categoryId The id of the category to which the bytes will be reported, must be valid
+				 */
+				explicit inline TrackedBytes(const CategoryId categoryId);
+
+				/**
+				 * Copy constructor, the bytes of the copied object are reported again.
+				 * @param trackedBytes The object to copy
+				 */
+				inline TrackedBytes(const TrackedBytes& trackedBytes);
+
+				/**
+				 * Move constructor.
+				 * @param trackedBytes The object to move
+				 */
+				inline TrackedBytes(TrackedBytes&& trackedBytes) noexcept;
+
+				/**
+				 * Destructs this object and releases the reported bytes.
+				 */
+				inline ~TrackedBytes();
+
+				/**
+				 * Sets the number of bytes the owning object currently holds.
+				 * An increase of bytes counts as one allocation, a decrease of bytes as one deallocation.
+				 * @param bytes The number of bytes, with range [0, infinity)
+				 */
+				void setBytes(const size_t bytes);
+
+				/**
+				 * Returns the number of bytes which are currently reported by this object.
+				 * @return The reported bytes
+				 */
+				inline size_t bytes() const;
+
+				/**
+				 * Copy assignment operator, the bytes of the copied object are reported again.
+				 * @param trackedBytes The object to copy
+				 * @return Reference to this object
+				 */
+				TrackedBytes& operator=(const TrackedBytes& trackedBytes);
+
+				/**
+				 * Move operator.
+				 * @param trackedBytes The object to move
+				 * @return Reference to this object
+				 */
+				TrackedBytes& operator=(TrackedBytes&& trackedBytes) noexcept;
+
+			protected:
+
+				/// The id of the category to which the bytes are reported.
+				CategoryId categoryId_ = invalidCategoryId_;
+
+				/// The number of reported bytes.
+				size_t bytes_ = 0;
+		};
+
+	protected:
+
+		/**
+		 * This class holds the lock-free counters of one category.
+		 */
+		class Counters
+		{
+			public:
+
+				/// The number of bytes the category currently holds.
+				std::atomic<uint64_t> currentBytes_ = 0ull;
+
+				/// The maximal number of bytes since the peaks have been reset.
+				std::atomic<uint64_t> peakBytes_ = 0ull;
+
+				/// The maximal number of bytes since the current frame has been started.
+				std::atomic<uint64_t> framePeakBytes_ = 0ull;
+
+				/// The number of allocations.
+				std::atomic<uint64_t> allocations_ = 0ull;
+
+				/// The number of deallocations.
+				std::atomic<uint64_t> deallocations_ = 0ull;
+
+				/// The number of allocations since the current frame has been started.
+				std::atomic<uint64_t> frameAllocations_ = 0ull;
+
+				/// The budget in bytes, 0 if no budget is defined.
+				std::atomic<uint64_t> budgetBytes_ = 0ull;
+		};
+
+	public:
+
+		/**
+		 * Registers a new category or returns the id of an existing category with the same name.
+		 * @param name The name of the category, must be valid
+		 * @return The id of the category, invalidCategoryId_ if the maximal number of categories has been reached
+		 */
+		static CategoryId registerCategory(const std::string& name);
+
+		/**
+		 * Reports an allocation for a category.
+		 * @param categoryId The id of the category, invalidCategoryId_ to ignore the allocation
+		 * @param bytes The number of allocated bytes, with range [0, infinity)
+		 */
+		static inline void allocate(const CategoryId categoryId, const size_t bytes);
+
+		/**
+		 * Reports a deallocation for a category.
+		 * @param categoryId The id of the category, invalidCategoryId_ to ignore the deallocation
+		 * @param bytes The number of released bytes, with range [0, currentBytes]
+		 */
+		static inline void deallocate(const CategoryId categoryId, const size_t bytes);
+
+		/**
+		 * Defines the memory budget for a category.
+		 * @param categoryId The id of the category, must be valid
+		 * @param budgetBytes The budget in bytes, 0 to remove the budget
+		 * @return True, if succeeded
+		 */
+		static bool setBudget(const CategoryId categoryId, const uint64_t budgetBytes);
+
+		/**
+		 * Starts a new frame, resets the per-frame allocation counters and per-frame peaks of all categories.
+		 * The function is typically called once for each camera frame e.g., to determine how many allocations a tracker needs per frame.
+		 */
+		static void startFrame();
+
+		/**
+		 * Resets the peaks of all categories to the bytes the categories currently hold.
+		 */
+		static void resetPeaks();
+
+		/**
+		 * Returns the statistic of one category.
+		 * @param categoryId The id of the category, must be valid
+		 * @return The category's statistic
+		 */
+		static Statistic statistic(const CategoryId categoryId);
+
+		/**
+		 * Returns the statistics of all registered categories.
+		 * @return The categories' statistics
+		 */
+		static Statistics statistics();
+
+		/**
+		 * Returns the statistics of all categories exceeding their budget.
+		 * @return The categories' statistics, empty if all categories are within their budget
+		 * @see Statistic::exceedsBudget().
+		 */
+		static Statistics exceededBudgets();
+
+		/**
+		 * Returns a readable report of all registered categories.
+		 * @return The report, one line for each category
+		 */
+		static std::string report();
+
+	protected:
+
+		/**
+		 * Raises a peak value if necessary.
+		 * @param peak The peak to raise
+		 * @param value The new value
+		 */
+		static inline void updatePeak(std::atomic<uint64_t>& peak, const uint64_t value);
+
+		/**
+		 * Returns the names of all registered categories.
+		 * @return The names
+		 */
+		static Strings categoryNames();
+
+	protected:
+
+		/// The counters of all categories.
+		static Counters counters_[maximalCategories_];
+
+		/// The number of registered categories.
+		static std::atomic<unsigned int> numberCategories_;
+};
+
+inline bool MemoryTracker::Statistic::exceedsBudget() const
+{
+	return budgetBytes_ != 0ull && peakBytes_ > budgetBytes_;
+}
+
+inline MemoryTracker::TrackedBytes::TrackedBytes(const CategoryId categoryId) :
+	categoryId_(categoryId)
+{
+	// nothing to do here
+}
+
+inline MemoryTracker::TrackedBytes::TrackedBytes(const TrackedBytes& trackedBytes) :
+	categoryId_(trackedBytes.categoryId_)
+{
+	setBytes(trackedBytes.bytes_);
+}
+
+inline MemoryTracker::TrackedBytes::TrackedBytes(TrackedBytes&& trackedBytes) noexcept :
+	categoryId_(trackedBytes.categoryId_),
+	bytes_(trackedBytes.bytes_)
+{
+	trackedBytes.bytes_ = 0;
+}
+
+inline MemoryTracker::TrackedBytes::~TrackedBytes()
+{
+	deallocate(categoryId_, bytes_);
+}
+
+inline size_t MemoryTracker::TrackedBytes::bytes() const
+{
+	return bytes_;
+}
+
+inline void MemoryTracker::allocate(const CategoryId categoryId, const size_t bytes)
+{
+	if (categoryId >= maximalCategories_)
+	{
+		return;
+	}
+
+	Counters& counters = counters_[categoryId];
+
+	const uint64_t currentBytes = counters.currentBytes_.fetch_add(uint64_t(bytes), std::memory_order_relaxed) + uint64_t(bytes);
+
+	counters.allocations_.fetch_add(1ull, std::memory_order_relaxed);
+	counters.frameAllocations_.fetch_add(1ull, std::memory_order_relaxed);
+
+	updatePeak(counters.peakBytes_, currentBytes);
+	updatePeak(counters.framePeakBytes_, currentBytes);
+}
+
+inline void MemoryTracker::deallocate(const CategoryId categoryId, const size_t bytes)
+{
+	if (categoryId >= maximalCategories_ || bytes == 0)
+	{
+		return;
+	}
+
+	Counters& counters = counters_[categoryId];
+
+	ocean_assert(counters.currentBytes_.load(std::memory_order_relaxed) >= uint64_t(bytes));
+	counters.currentBytes_.fetch_sub(uint64_t(bytes), std::memory_order_relaxed);
+
+	counters.deallocations_.fetch_add(1ull, std::memory_order_relaxed);
+}
+
+inline void MemoryTracker::updatePeak(std::atomic<uint64_t>& peak, const uint64_t value)
+{
+	uint64_t previousPeak = peak.load(std::memory_order_relaxed);
+
+	while (value > previousPeak && !peak.compare_exchange_weak(previousPeak, value, std::memory_order_relaxed))
+	{
+		// previousPeak has been updated, we try again
+	}
+}
+
+}
+
+#endif // META_OCEAN_BASE_MEMORY_TRACKER_H
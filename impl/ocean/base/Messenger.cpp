@@ -9,6 +9,7 @@
 #include "ocean/base/DateTime.h"
 #include "ocean/base/Maintenance.h"
 
+#include <algorithm>
 #include <fstream>
 #include <iostream>
 
@@ -23,7 +24,79 @@
 namespace Ocean
 {
 
-Messenger::Messenger()
+Messenger::MessageBuffer::MessageBuffer(const size_t capacity) :
+	messages_(capacity)
+{
+	ocean_assert(capacity >= 1);
+}
+
+bool Messenger::MessageBuffer::push(AsynchronousMessage&& message)
+{
+	ocean_assert(!messages_.empty());
+
+	// only the owning thread writes to the buffer, so that a relaxed load is sufficient
+
+	const size_t numberPushedMessages = numberPushedMessages_.load(std::memory_order_relaxed);
+
+	if (numberPushedMessages - numberPoppedMessages_.load(std::memory_order_acquire) >= messages_.size())
+	{
+		return false;
+	}
+
+	messages_[numberPushedMessages % messages_.size()] = std::move(message);
+
+	numberPushedMessages_.store(numberPushedMessages + 1, std::memory_order_release);
+
+	return true;
+}
+
+bool Messenger::MessageBuffer::pop(AsynchronousMessage& message)
+{
+	ocean_assert(!messages_.empty());
+
+	const size_t numberPoppedMessages = numberPoppedMessages_.load(std::memory_order_relaxed);
+
+	if (numberPoppedMessages == numberPushedMessages_.load(std::memory_order_acquire))
+	{
+		return false;
+	}
+
+	message = std::move(messages_[numberPoppedMessages % messages_.size()]);
+
+	numberPoppedMessages_.store(numberPoppedMessages + 1, std::memory_order_release);
+
+	return true;
+}
+
+Messenger::WriterThread::WriterThread(Messenger& messenger) :
+	Thread("Messenger writer thread"),
+	messenger_(messenger)
+{
+	// nothing to do here
+}
+
+Messenger::WriterThread::~WriterThread()
+{
+	stopThreadExplicitly();
+}
+
+void Messenger::WriterThread::stop()
+{
+	stopThreadExplicitly();
+}
+
+void Messenger::WriterThread::threadRun()
+{
+	while (!shouldThreadStop())
+	{
+		messenger_.writeAsynchronousMessages();
+
+		sleep(sleepTime_);
+	}
+}
+
+Messenger::Messenger() :
+	writerThread_(*this)
 {
 #ifdef OCEAN_INTENSIVE_DEBUG
 	writeToDebugOutput("Messenger::Messenger()");
@@ -32,6 +105,8 @@ Messenger::Messenger()
 
 Messenger::~Messenger()
 {
+	setAsynchronousOutput(false);
+
 #ifdef OCEAN_INTENSIVE_DEBUG
 	writeToDebugOutput("Messenger::~Messenger()");
 #endif
@@ -47,20 +122,84 @@ void Messenger::push(const MessageType type, std::string&& location, std::string
 	}
 #endif
 
+	// the pending push is registered before the state of the asynchronous output is checked,
+	// so that setAsynchronousOutput() can wait for all pushes which have seen the enabled output
+
+	pendingPushes_.fetch_add(1u);
+
+	if (asynchronousOutput_.load())
+	{
+		// the message is formatted by the writer thread, only the time and the order need to be determined now
+
+		MessageBuffer& messageBuffer = threadMessageBuffer();
+
+		if (messageBuffer.isFull())
+		{
+			droppedMessages_.fetch_add(1u, std::memory_order_relaxed);
+		}
+		else
+		{
+			// a sequence number is assigned to messages which will be written only, so that the writer does not wait for dropped messages
+
+			AsynchronousMessage asynchronousMessage;
+			asynchronousMessage.type_ = type;
+			asynchronousMessage.location_ = std::move(location);
+			asynchronousMessage.message_ = std::move(message);
+			asynchronousMessage.sequenceNumber_ = nextSequenceNumber_.fetch_add(1u, std::memory_order_relaxed);
+
+			if (integrateDateTime_.load(std::memory_order_relaxed))
+			{
+				asynchronousMessage.localTimestamp_ = DateTime::localTimestamp();
+			}
+
+			const bool result = messageBuffer.push(std::move(asynchronousMessage));
+			ocean_assert_and_suppress_unused(result, result);
+		}
+
+		pendingPushes_.fetch_sub(1u, std::memory_order_release);
+
+		return;
+	}
+
+	pendingPushes_.fetch_sub(1u, std::memory_order_release);
+
+	// messages which have been pushed while the asynchronous output was enabled must be written first
+
+	while (drainingAsynchronousOutput_.load())
+	{
+		Thread::sleep(0u);
+	}
+
+	writeMessage(type, std::move(location), std::move(message), -1.0);
+}
+
+void Messenger::writeMessage(const MessageType type, std::string&& location, std::string&& message, const double localTimestamp)
+{
 	const ScopedLock scopedLock(lock_);
 
 	std::string messagePrefix;
 	std::string locationAndTime = location;
 
-	if (integrateDateTime_)
+	std::string dateTime;
+
+	if (localTimestamp >= 0.0)
+	{
+		dateTime = DateTime::stringDate(localTimestamp) + std::string(", ") + DateTime::stringTime(localTimestamp, true, ':');
+	}
+	else if (integrateDateTime_)
+	{
+		dateTime = DateTime::localStringDate() + std::string(", ") + DateTime::localStringTime(true);
+	}
+
+	if (!dateTime.empty())
 	{
 		if (location.empty())
 		{
-			locationAndTime = DateTime::localStringDate() + std::string(", ") + DateTime::localStringTime(true);
+			locationAndTime = std::move(dateTime);
 		}
 		else
 		{
-			locationAndTime = DateTime::localStringDate() + std::string(", ") + DateTime::localStringTime(true) + std::string(": ") + location;
+			locationAndTime = dateTime + std::string(": ") + location;
 		}
 	}
 
@@ -434,6 +573,66 @@ void Messenger::setIntegrateDateTime(const bool state)
 	integrateDateTime_ = state;
 }
 
+bool Messenger::setAsynchronousOutput(const bool state, const size_t bufferCapacity)
+{
+	ocean_assert(bufferCapacity >= 1);
+
+	const ScopedLock scopedLock(writerThreadLock_);
+
+	if (state)
+	{
+		{
+			const ScopedLock buffersScopedLock(messageBuffersLock_);
+			messageBufferCapacity_ = std::max(size_t(1), bufferCapacity);
+		}
+
+		if (!asynchronousOutput_)
+		{
+			asynchronousOutput_ = true;
+			writerThread_.startThread();
+		}
+
+		return true;
+	}
+
+	if (asynchronousOutput_)
+	{
+		drainingAsynchronousOutput_ = true;
+		asynchronousOutput_ = false;
+
+		// threads which have seen the enabled output may still be pushing into their buffers
+
+		while (pendingPushes_.load() != 0u)
+		{
+			Thread::sleep(0u);
+		}
+
+		writerThread_.stop();
+
+		// messages which have been pushed before the output has been disabled are written by the calling thread
+
+		writeAsynchronousMessages();
+
+		ocean_assert(pendingAsynchronousMessages_.empty());
+
+		drainingAsynchronousOutput_ = false;
+	}
+
+	return true;
+}
+
+void Messenger::flushAsynchronousOutput()
+{
+	// messages of threads which are currently pushing may be held back, so that we write until all messages pushed before this call have been written
+
+	const uint64_t sequenceNumber = nextSequenceNumber_.load();
+
+	while (writeAsynchronousMessages() < sequenceNumber)
+	{
+		Thread::sleep(0u);
+	}
+}
+
 void Messenger::flush(std::ostream& stream)
 {
 	const ScopedLock scopedLock(lock_);
@@ -481,6 +680,74 @@ void Messenger::clearErrors()
 	errorMessageQueue_ = MessageQueue();
 }
 
+uint64_t Messenger::writeAsynchronousMessages()
+{
+	const ScopedLock scopedLock(asynchronousWriteLock_);
+
+	MessageBuffers messageBuffers;
+
+	{
+		const ScopedLock buffersScopedLock(messageBuffersLock_);
+		messageBuffers = messageBuffers_;
+	}
+
+	AsynchronousMessage asynchronousMessage;
+
+	for (const std::shared_ptr<MessageBuffer>& messageBuffer : messageBuffers)
+	{
+		while (messageBuffer->pop(asynchronousMessage))
+		{
+			pendingAsynchronousMessages_.emplace_back(std::move(asynchronousMessage));
+		}
+	}
+
+	messageBuffers.clear();
+
+	// the buffers hold the messages of individual threads, the messages of all threads are written in the order they have been pushed,
+	// a message is written once all messages with lower sequence numbers have been read, as a thread may still be pushing a message with a lower number
+
+	std::sort(pendingAsynchronousMessages_.begin(), pendingAsynchronousMessages_.end(), [](const AsynchronousMessage& messageA, const AsynchronousMessage& messageB) { return messageA.sequenceNumber_ < messageB.sequenceNumber_; });
+
+	size_t numberWrittenMessages = 0;
+
+	while (numberWrittenMessages < pendingAsynchronousMessages_.size() && pendingAsynchronousMessages_[numberWrittenMessages].sequenceNumber_ == nextWrittenSequenceNumber_)
+	{
+		AsynchronousMessage& message = pendingAsynchronousMessages_[numberWrittenMessages];
+
+		writeMessage(message.type_, std::move(message.location_), std::move(message.message_), message.localTimestamp_);
+
+		++numberWrittenMessages;
+		++nextWrittenSequenceNumber_;
+	}
+
+	pendingAsynchronousMessages_.erase(pendingAsynchronousMessages_.begin(), pendingAsynchronousMessages_.begin() + numberWrittenMessages);
+
+	// the messenger holds the last reference to buffers of threads which do not exist anymore
+
+	const ScopedLock buffersScopedLock(messageBuffersLock_);
+
+	messageBuffers_.erase(std::remove_if(messageBuffers_.begin(), messageBuffers_.end(), [](const std::shared_ptr<MessageBuffer>& messageBuffer) { return messageBuffer.use_count() == 1 && messageBuffer->isEmpty(); }), messageBuffers_.end());
+
+	return nextWrittenSequenceNumber_;
+}
+
+Messenger::MessageBuffer& Messenger::threadMessageBuffer()
+{
+	// each thread holds a reference to its own buffer, so that messages can be pushed without any lock
+
+	thread_local std::shared_ptr<MessageBuffer> threadMessageBuffer;
+
+	if (!threadMessageBuffer)
+	{
+		const ScopedLock scopedLock(messageBuffersLock_);
+
+		threadMessageBuffer = std::make_shared<MessageBuffer>(messageBufferCapacity_);
+		messageBuffers_.emplace_back(threadMessageBuffer);
+	}
+
+	return *threadMessageBuffer;
+}
+
 void Messenger::queueMessage(const MessageType messageType, std::string&& locationAndTime, std::string&& message)
 {
 	ocean_assert(!message.empty());
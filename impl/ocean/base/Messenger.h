@@ -12,11 +12,15 @@
 #include "ocean/base/Lock.h"
 #include "ocean/base/Singleton.h"
 #include "ocean/base/String.h"
+#include "ocean/base/Thread.h"
 
+#include <atomic>
 #include <fstream>
 #include <iostream>
+#include <memory>
 #include <queue>
 #include <ostream>
+#include <vector>
 
 namespace Ocean
 {
@@ -36,7 +40,10 @@ namespace Ocean
  * Applications interested in messages use the Messenger object implemented as singleton to receive messages.
  * Modules use the MessageObject objects to post new messages.<br>
  * Three basic message types are defined: error, warning and info.
- * @see SpecificMessenger.
+ *
+ * By default, messages are forwarded to the outputs by the thread pushing the message.<br>
+ * The asynchronous output moves messages into a lock-free buffer of the pushing thread instead, a dedicated writer thread formats the messages and forwards them to the outputs.
+ * @see SpecificMessenger, setAsynchronousOutput().
  *
  * Tutorial explaining the usage on application side:
  * @code
@@ -146,6 +153,133 @@ class OCEAN_BASE_EXPORT Messenger : public Singleton<Messenger>
 		 */
 		using MessageQueue = std::queue<Message>;
 
+		/**
+		 * This class holds a message which has been pushed while the asynchronous output is enabled, the message is not yet formatted.
+		 */
+		class AsynchronousMessage
+		{
+			public:
+
+				/// The type of the message.
+				MessageType type_ = TYPE_UNDEFINED;
+
+				/// The location of the message.
+				std::string location_;
+
+				/// The text message.
+				std::string message_;
+
+				/// The local timestamp when the message has been pushed, -1 if the date/time integration was not active.
+				double localTimestamp_ = -1.0;
+
+				/// The sequence number of the message, defining the order of the messages of all threads.
+				uint64_t sequenceNumber_ = 0u;
+		};
+
+		/**
+		 * Definition of a vector holding asynchronous messages.
+		 */
+		using AsynchronousMessages = std::vector<AsynchronousMessage>;
+
+		/**
+		 * This class implements a ring buffer for asynchronous messages with one writing and one reading thread.
+		 * The owning thread adds messages without any lock, the writer thread of the messenger reads the messages.
+		 */
+		class MessageBuffer
+		{
+			public:
+
+				/**
+				 * Creates a new buffer.
+				 * @param capacity The maximal number of messages the buffer can hold, with range [1, infinity)
+				 */
+				explicit MessageBuffer(const size_t capacity);
+
+				/**
+				 * Adds a new message to this buffer.
+				 * This function must be called by the owning thread only.
+				 * @param message The message to add
+				 * @return True, if succeeded; False, if the buffer is full
+				 */
+				bool push(AsynchronousMessage&& message);
+
+				/**
+				 * Removes the oldest message from this buffer.
+				 * This function must be called by one reading thread at a time only.
+				 * @param message The resulting message
+				 * @return True, if succeeded; False, if the buffer is empty
+				 */
+				bool pop(AsynchronousMessage& message);
+
+				/**
+				 * Returns whether this buffer does not hold any message.
+				 * @return True, if so
+				 */
+				inline bool isEmpty() const;
+
+				/**
+				 * Returns whether this buffer cannot hold any further message.
+				 * This function must be called by the owning thread only.
+				 * @return True, if so
+				 */
+				inline bool isFull() const;
+
+			protected:
+
+				/// The messages of this buffer.
+				std::vector<AsynchronousMessage> messages_;
+
+				/// The overall number of messages which have been added to this buffer.
+				std::atomic<size_t> numberPushedMessages_ = 0;
+
+				/// The overall number of messages which have been removed from this buffer.
+				std::atomic<size_t> numberPoppedMessages_ = 0;
+		};
+
+		/**
+		 * Definition of a vector holding message buffers.
+		 */
+		using MessageBuffers = std::vector<std::shared_ptr<MessageBuffer>>;
+
+		/**
+		 * This class implements the thread writing the asynchronous messages to the outputs.
+		 */
+		class WriterThread : public Thread
+		{
+			public:
+
+				/**
+				 * Creates a new writer thread.
+				 * @param messenger The messenger owning the thread
+				 */
+				explicit WriterThread(Messenger& messenger);
+
+				/**
+				 * Destructs the writer thread.
+				 */
+				~WriterThread() override;
+
+				/**
+				 * Stops the thread and waits until the thread has finished.
+				 */
+				void stop();
+
+			protected:
+
+				/**
+				 * The thread's run function.
+				 */
+				void threadRun() override;
+
+			protected:
+
+				/// The messenger owning the thread.
+				Messenger& messenger_;
+
+				/// The time in milliseconds the thread sleeps between two write iterations.
+				static constexpr unsigned int sleepTime_ = 5u;
+		};
+
 	public:
 
 		/**
@@ -244,6 +378,26 @@ class OCEAN_BASE_EXPORT Messenger : public Singleton<Messenger>
 		 */
 		void setIntegrateDateTime(const bool state);
 
+		/**
+		 * Enables or disables the asynchronous output of messages.
+		 * While enabled, push() moves each message into a lock-free buffer of the calling thread and returns immediately.<br>
+		 * A dedicated writer thread integrates the date/time information, formats the messages and forwards them to the outputs.<br>
+		 * Messages which do not fit into the buffer of the calling thread are dropped, see droppedMessages().<br>
+		 * Messages of all threads pending at the same time are written in the order in which they have been pushed.<br>
+		 * When disabling, the function waits for all threads currently pushing a message, so that no message is lost.
+		 * @param state True, to enable the asynchronous output; False, to write all pending messages and to forward messages synchronously again
+		 * @param bufferCapacity The number of messages the buffer of each thread can hold, applies to buffers of threads pushing their first message afterwards, with range [1, infinity)
+		 * @return True, if succeeded
+		 * @see asynchronousOutput(), flushAsynchronousOutput().
+		 */
+		bool setAsynchronousOutput(const bool state, const size_t bufferCapacity = 1024);
+
+		/**
+		 * Forwards all messages pending in the buffers of the asynchronous output to the outputs.
+		 * The function returns after all messages which have been pushed before the call have been written.
+		 */
+		void flushAsynchronousOutput();
+
 		/**
 		 * Flushes the current message stack to a given output stream, the output type is unchanged.
 		 * @param stream Output stream
@@ -302,6 +456,19 @@ class OCEAN_BASE_EXPORT Messenger : public Singleton<Messenger>
 		 */
 		inline bool integrateDateTime() const;
 
+		/**
+		 * Returns whether the asynchronous output is enabled.
+		 * @return True, if so
+		 * @see setAsynchronousOutput().
+		 */
+		inline bool asynchronousOutput() const;
+
+		/**
+		 * Returns the number of messages which have been dropped because the buffer of the pushing thread was full.
+		 * @return The overall number of dropped messages
+		 */
+		inline uint64_t droppedMessages() const;
+
 		/**
 		 * Returns whether no message exists.
 		 * @return True, if so
@@ -339,6 +506,28 @@ class OCEAN_BASE_EXPORT Messenger : public Singleton<Messenger>
 		 */
 		~Messenger();
 
+		/**
+		 * Formats a message and forwards the message to all outputs.
+		 * @param type The type of the message
+		 * @param location The location of the message
+		 * @param message The text message
+		 * @param localTimestamp The local timestamp to be integrated, -1 to integrate the current date/time if the date/time integration is active
+		 */
+		void writeMessage(const MessageType type, std::string&& location, std::string&& message, const double localTimestamp);
+
+		/**
+		 * Forwards the messages of all message buffers to the outputs, ordered by their sequence numbers.
+		 * A message is held back until all messages with lower sequence numbers have been read from the buffers.
+		 * @return The sequence number of the next message to be written
+		 */
+		uint64_t writeAsynchronousMessages();
+
+		/**
+		 * Returns the message buffer of the calling thread, a new buffer is registered if necessary.
+		 * @return The thread's message buffer
+		 */
+		MessageBuffer& threadMessageBuffer();
+
 		/**
 		 * Queues a message.
 		 * @param messageType The type of the message
@@ -409,10 +598,49 @@ class OCEAN_BASE_EXPORT Messenger : public Singleton<Messenger>
 		std::ostream* outputStream_ = nullptr;
 
 		/// Date and time integration state.
-		bool integrateDateTime_ = false;
+		std::atomic<bool> integrateDateTime_ = false;
 
 		/// Messenger lock.
-		mutable Lock lock_;
+		mutable Lock lock_{"Messenger"};
+
+		/// True, if the asynchronous output is enabled.
+		std::atomic<bool> asynchronousOutput_ = false;
+
+		/// The overall number of messages which have been dropped by the asynchronous output.
+		std::atomic<uint64_t> droppedMessages_ = 0u;
+
+		/// True, while the asynchronous output is disabled and the pending messages are written, synchronous messages wait until all pending messages have been written.
+		std::atomic<bool> drainingAsynchronousOutput_ = false;
+
+		/// The number of threads currently pushing a message while the asynchronous output may be enabled.
+		std::atomic<unsigned int> pendingPushes_ = 0u;
+
+		/// The sequence number of the next asynchronous message, a number is assigned to messages which fit into the buffer only.
+		std::atomic<uint64_t> nextSequenceNumber_ = 0u;
+
+		/// The messages which have been read from the buffers but which cannot be written before messages with lower sequence numbers have been read.
+		AsynchronousMessages pendingAsynchronousMessages_;
+
+		/// The sequence number of the next message to be written.
+		uint64_t nextWrittenSequenceNumber_ = 0u;
+
+		/// The capacity of each new message buffer.
+		size_t messageBufferCapacity_ = 1024;
+
+		/// The message buffers of all threads which pushed messages while the asynchronous output was enabled.
+		MessageBuffers messageBuffers_;
+
+		/// The lock for the message buffers.
+		Lock messageBuffersLock_;
+
+		/// The lock ensuring that the message buffers are read by one thread at a time, also protecting the pending messages.
+		Lock asynchronousWriteLock_;
+
+		/// The lock for enabling and disabling the writer thread.
+		Lock writerThreadLock_;
+
+		/// The thread writing the asynchronous messages.
+		WriterThread writerThread_;
 
 		/// Maximum number of messages.
 		static constexpr unsigned int maxMessages_ = 5000u;
@@ -895,6 +1123,16 @@ class OCEAN_BASE_EXPORT Log
 		static constexpr bool isSupported();
 };
 
+inline bool Messenger::MessageBuffer::isEmpty() const
+{
+	return numberPoppedMessages_.load(std::memory_order_acquire) == numberPushedMessages_.load(std::memory_order_acquire);
+}
+
+inline bool Messenger::MessageBuffer::isFull() const
+{
+	return numberPushedMessages_.load(std::memory_order_relaxed) - numberPoppedMessages_.load(std::memory_order_acquire) >= messages_.size();
+}
+
 inline Messenger::MessageOutput Messenger::outputType() const
 {
 	const ScopedLock scopedLock(lock_);
@@ -925,6 +1163,16 @@ inline bool Messenger::integrateDateTime() const
 	return integrateDateTime_;
 }
 
+inline bool Messenger::asynchronousOutput() const
+{
+	return asynchronousOutput_.load(std::memory_order_relaxed);
+}
+
+inline uint64_t Messenger::droppedMessages() const
+{
+	return droppedMessages_.load(std::memory_order_relaxed);
+}
+
 inline bool Messenger::empty() const
 {
 	const ScopedLock scopedLock(lock_);
@@ -285,9 +285,13 @@ void ObjectRef<T>::ObjectHolder::unref()
 {
 	ocean_assert(atomicReferenceCounter_ != 0u);
 
+	// the callback must be checked before the counter is decremented, as another thread may dispose the holder right after the decrement
+
+	const bool hasCallback = bool(callback_);
+
 	const unsigned int newReferenceCount = atomicReferenceCounter_.fetch_sub(1u) - 1u;
 
-	if (newReferenceCount == 1u && callback_)
+	if (newReferenceCount == 1u && hasCallback)
 	{
 		// from this point on the reference counter cannot (and also must not) be decremented from any caller but from the object which receives the callback
 
@@ -0,0 +1,303 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "ocean/base/Pipeline.h"
+#include "ocean/base/HighPerformanceTimer.h"
+#include "ocean/base/Messenger.h"
+#include "ocean/base/String.h"
+
+namespace Ocean
+{
+
+Pipeline::Queue::Queue(std::string name, const size_t capacity, const DropPolicy dropPolicy, const double maximalAge) :
+	name_(std::move(name)),
+	capacity_(capacity),
+	dropPolicy_(dropPolicy),
+	maximalAge_(maximalAge)
+{
+	ocean_assert(capacity_ >= 1);
+	ocean_assert(maximalAge_ >= 0.0);
+}
+
+Pipeline::QueueStatistic Pipeline::Queue::statistic() const
+{
+	const size_t currentSize = size();
+
+	const ScopedLock scopedLock(lock_);
+
+	QueueStatistic result;
+
+	result.name_ = name_;
+	result.capacity_ = capacity_;
+	result.size_ = currentSize;
+	result.pushed_ = pushed_;
+	result.popped_ = popped_;
+	result.dropped_ = dropped_;
+	result.droppedStale_ = droppedStale_;
+	result.averageLatency_ = popped_ != 0ull ? sumLatency_ / double(popped_) : 0.0;
+	result.maximalLatency_ = maximalLatency_;
+
+	return result;
+}
+
+void Pipeline::Queue::setClosed(const bool closed)
+{
+	closed_ = closed;
+
+	if (closed)
+	{
+		// waking up all producers and consumers which may wait for the queue
+
+		pushedSignal_.pulse();
+		poppedSignal_.pulse();
+	}
+}
+
+void Pipeline::Queue::registerLatency(const double latency)
+{
+	ocean_assert(latency >= 0.0);
+
+	++popped_;
+
+	sumLatency_ += latency;
+	maximalLatency_ = std::max(maximalLatency_, latency);
+}
+
+Pipeline::Stage::Stage(std::string name, StepFunction&& stepFunction, const PriorityClass priorityClass, const CoreAffinity coreAffinity) :
+	Thread(name),
+	name_(std::move(name)),
+	stepFunction_(std::move(stepFunction)),
+	priorityClass_(priorityClass),
+	coreAffinity_(coreAffinity)
+{
+	ocean_assert(stepFunction_);
+}
+
+Pipeline::Stage::~Stage()
+{
+	stopThreadExplicitly();
+}
+
+bool Pipeline::Stage::start()
+{
+	return startThread();
+}
+
+void Pipeline::Stage::stop()
+{
+	stopThread();
+
+	joinThread();
+}
+
+Pipeline::StageStatistic Pipeline::Stage::statistic() const
+{
+	const ScopedLock scopedLock(lock_);
+
+	StageStatistic result;
+
+	result.name_ = name_;
+	result.executions_ = executions_;
+	result.averageDuration_ = executions_ != 0ull ? sumDuration_ / double(executions_) : 0.0;
+	result.maximalDuration_ = maximalDuration_;
+
+	return result;
+}
+
+void Pipeline::Stage::threadRun()
+{
+	if (priorityClass_ != PC_DEFAULT || coreAffinity_ != CA_ANY)
+	{
+		if (!setThreadPriorityClass(priorityClass_, coreAffinity_))
+		{
+			Log::debug() << "Failed to apply the priority class " << int(priorityClass_) << " to the pipeline stage '" << name_ << "'";
+		}
+	}
+
+	HighPerformanceTimer timer;
+
+	while (!shouldThreadStop())
+	{
+		timer.start();
+
+		if (stepFunction_())
+		{
+			const double duration = timer.seconds();
+
+			const ScopedLock scopedLock(lock_);
+
+			++executions_;
+
+			sumDuration_ += duration;
+			maximalDuration_ = std::max(maximalDuration_, duration);
+		}
+	}
+}
+
+Pipeline::~Pipeline()
+{
+	stop();
+}
+
+bool Pipeline::start()
+{
+	const ScopedLock scopedLock(lock_);
+
+	if (isRunning_)
+	{
+		return true;
+	}
+
+	if (stages_.empty())
+	{
+		return false;
+	}
+
+	for (const std::shared_ptr<Queue>& queue : queues_)
+	{
+		queue->setClosed(false);
+	}
+
+	for (const UniqueStage& stage : stages_)
+	{
+		if (!stage->start())
+		{
+			ocean_assert(false && "This should never happen!");
+		}
+	}
+
+	isRunning_ = true;
+
+	return true;
+}
+
+void Pipeline::stop()
+{
+	const ScopedLock scopedLock(lock_);
+
+	if (!isRunning_)
+	{
+		return;
+	}
+
+	// first, we close all queues so that stages blocked in a full queue return
+
+	for (const std::shared_ptr<Queue>& queue : queues_)
+	{
+		queue->setClosed(true);
+	}
+
+	for (const UniqueStage& stage : stages_)
+	{
+		stage->stop();
+	}
+
+	isRunning_ = false;
+}
+
+bool Pipeline::isRunning() const
+{
+	const ScopedLock scopedLock(lock_);
+
+	return isRunning_;
+}
+
+Pipeline::QueueStatistics Pipeline::queueStatistics() const
+{
+	const ScopedLock scopedLock(lock_);
+
+	QueueStatistics result;
+	result.reserve(queues_.size());
+
+	for (const std::shared_ptr<Queue>& queue : queues_)
+	{
+		result.emplace_back(queue->statistic());
+	}
+
+	return result;
+}
+
+Pipeline::StageStatistics Pipeline::stageStatistics() const
+{
+	const ScopedLock scopedLock(lock_);
+
+	StageStatistics result;
+	result.reserve(stages_.size());
+
+	for (const UniqueStage& stage : stages_)
+	{
+		result.emplace_back(stage->statistic());
+	}
+
+	return result;
+}
+
+std::string Pipeline::report() const
+{
+	std::string result;
+
+	for (const QueueStatistic& queueStatistic : queueStatistics())
+	{
+		if (!result.empty())
+		{
+			result += "\n";
+		}
+
+		result += "Queue " + queueStatistic.name_ + ": " + String::toAString(queueStatistic.size_) + "/" + String::toAString(queueStatistic.capacity_);
+		result += ", pushed " + String::toAString(queueStatistic.pushed_) + ", dropped " + String::toAString(queueStatistic.dropped_) + ", stale " + String::toAString(queueStatistic.droppedStale_);
+		result += ", latency " + String::toAString(queueStatistic.averageLatency_ * 1000.0, 2u) + "ms (max " + String::toAString(queueStatistic.maximalLatency_ * 1000.0, 2u) + "ms)";
+	}
+
+	for (const StageStatistic& stageStatistic : stageStatistics())
+	{
+		if (!result.empty())
+		{
+			result += "\n";
+		}
+
+		result += "Stage " + stageStatistic.name_ + ": " + String::toAString(stageStatistic.executions_) + " executions";
+		result += ", duration " + String::toAString(stageStatistic.averageDuration_ * 1000.0, 2u) + "ms (max " + String::toAString(stageStatistic.maximalDuration_ * 1000.0, 2u) + "ms)";
+	}
+
+	return result;
+}
+
+bool Pipeline::addStage(std::string name, Stage::StepFunction&& stepFunction, const Thread::PriorityClass priorityClass, const Thread::CoreAffinity coreAffinity)
+{
+	ocean_assert(stepFunction);
+
+	const ScopedLock scopedLock(lock_);
+
+	if (isRunning_)
+	{
+		ocean_assert(false && "Stages cannot be added to a running pipeline!");
+		return false;
+	}
+
+	stages_.emplace_back(std::make_unique<Stage>(std::move(name), std::move(stepFunction), priorityClass, coreAffinity));
+
+	return true;
+}
+
+bool Pipeline::addQueue(std::shared_ptr<Queue> queue)
+{
+	ocean_assert(queue);
+
+	const ScopedLock scopedLock(lock_);
+
+	if (isRunning_)
+	{
+		ocean_assert(false && "Queues cannot be added to a running pipeline!");
+		return false;
+	}
+
+	queues_.emplace_back(std::move(queue));
+
+	return true;
+}
+
+}
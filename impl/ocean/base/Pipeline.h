@@ -0,0 +1,759 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#ifndef META_OCEAN_BASE_PIPELINE_H
+#define META_OCEAN_BASE_PIPELINE_H
+
+#include "ocean/base/Base.h"
+#include "ocean/base/Lock.h"
+#include "ocean/base/Signal.h"
+#include "ocean/base/Thread.h"
+#include "ocean/base/Timestamp.h"
+
+#include <atomic>
+#include <deque>
+#include <functional>
+
+namespace Ocean
+{
+
+// Forward declaration.
+class Worker;
+
+/**
+ * This class implements a small dataflow runtime composing processing stages which run concurrently.
+ * A pipeline is composed of typed queues (the edges) and stages (the nodes).<br>
+ * Each stage runs in an own thread, takes one element from its input queue, processes the element, and forwards the result to its output queue.<br>
+ * Queues are bounded, a full queue either blocks the producer (backpressure) or drops elements, and elements exceeding a maximal age can be dropped when they are taken from a queue.<br>
+ * Thus, e.g., the frame conversion, the tracking, and the rendering of consecutive camera frames can overlap on individual cores.
+ *
+ * Here is a tutorial how to use this class:
+ * @code
+ * Pipeline pipeline;
+ *
+ * // the camera queue keeps the latest frame only, frames older than 50ms are not processed anymore
+ * Pipeline::SharedQueue<Frame> cameraQueue = pipeline.addQueue<Frame>("Camera", 1, Pipeline::DP_DROP_OLDEST, 0.05);
+ * Pipeline::SharedQueue<Frame> yQueue = pipeline.addQueue<Frame>("Y8", 2, Pipeline::DP_BLOCK);
+ *
+ * pipeline.addStage<Frame, Frame>("Conversion", cameraQueue, yQueue, [](Frame& frame, Frame& yFrame, Worker* worker)
+ * {
+ *     return CV::FrameConverter::Comfort::convert(frame, FrameType::FORMAT_Y8, yFrame, CV::FrameConverter::CP_ALWAYS_COPY, worker);
+ * }, &worker);
+ *
+ * pipeline.addSink<Frame>("Tracking", yQueue, [&tracker](Frame& yFrame, Worker*)
+ * {
+ *     tracker.handleFrame(yFrame);
+ * }, nullptr, Thread::PC_REALTIME_TRACKING);
+ *
+ * pipeline.start();
+ *
+ * // e.g., in the callback of a frame medium
+ * cameraQueue->push(std::move(frame));
+ *
+ * pipeline.stop();
+ * @endcode
+ * @ingroup base
+ */
+class OCEAN_BASE_EXPORT Pipeline
+{
+	public:
+
+		/**
+		 * Definition of individual policies applied when an element is pushed into a full queue.
+		 */
+		enum DropPolicy : uint32_t
+		{
+			/// The producer waits until the queue has space again (backpressure), no element is dropped.
+			DP_BLOCK = 0u,
+			/// The oldest element in the queue is dropped, e.g., to process always the latest camera frame.
+			DP_DROP_OLDEST,
+			/// The new element is dropped.
+			DP_DROP_NEWEST
+		};
+
+		/**
+		 * This class holds the statistic of one queue.
+		 */
+		class QueueStatistic
+		{
+			public:
+
+				/// The name of the queue.
+				std::string name_;
+
+				/// The capacity of the queue.
+				size_t capacity_ = 0;
+
+				/// The number of elements currently in the queue.
+				size_t size_ = 0;
+
+				/// The number of elements which have been pushed into the queue.
+				uint64_t pushed_ = 0ull;
+
+				/// The number of elements which have been taken from the queue.
+				uint64_t popped_ = 0ull;
+
+				/// The number of elements which have been dropped because the queue was full.
+				uint64_t dropped_ = 0ull;
+
+				/// The number of elements which have been dropped because they exceeded the maximal age.
+				uint64_t droppedStale_ = 0ull;
+
+				/// The average time elements waited in the queue, in seconds.
+				double averageLatency_ = 0.0;
+
+				/// The maximal time an element waited in the queue, in seconds.
+				double maximalLatency_ = 0.0;
+		};
+
+		/**
+		 * Definition of a vector holding queue statistics.
+		 */
+		using QueueStatistics = std::vector<QueueStatistic>;
+
+		/**
+		 * This class holds the statistic of one stage.
+		 */
+		class StageStatistic
+		{
+			public:
+
+				/// The name of the stage.
+				std::string name_;
+
+				/// The number of processed elements.
+				uint64_t executions_ = 0ull;
+
+				/// The average processing time of one element, in seconds.
+				double averageDuration_ = 0.0;
+
+				/// The maximal processing time of one element, in seconds.
+				double maximalDuration_ = 0.0;
+		};
+
+		/**
+		 * Definition of a vector holding stage statistics.
+		 */
+		using StageStatistics = std::vector<StageStatistic>;
+
+		/**
+		 * This class implements the type independent part of a bounded thread-safe queue connecting stages.
+		 */
+		class OCEAN_BASE_EXPORT Queue
+		{
+			friend class Pipeline;
+
+			public:
+
+				/**
+				 * Destructs the queue.
+				 */
+				virtual ~Queue() = default;
+
+				/**
+				 * Returns the name of this queue.
+				 * @return The queue's name
+				 */
+				inline const std::string& name() const;
+
+				/**
+				 * Returns the statistic of this queue.
+				 * @return The queue's statistic
+				 */
+				QueueStatistic statistic() const;
+
+				/**
+				 * Returns the number of elements currently in this queue.
+				 * @return The number of elements, with range [0, capacity]
+				 */
+				virtual size_t size() const = 0;
+
+				/**
+				 * Returns whether this queue is closed.
+				 * @return True, if so
+				 */
+				inline bool isClosed() const;
+
+			protected:
+
+				/**
+				 * Creates a new queue.
+				 * @param name The name of the queue
+				 * @param capacity The capacity of the queue, with range [1, infinity)
+				 * @param dropPolicy The policy applied when an element is pushed into the full queue
+				 * @param maximalAge The maximal age of an element in seconds before it is dropped when taken from the queue, 0 to keep all elements
+				 */
+				Queue(std::string name, const size_t capacity, const DropPolicy dropPolicy, const double maximalAge);
+
+				/**
+				 * Closes or re-opens this queue.
+				 * A closed queue does not accept new elements, and all waiting producers and consumers return immediately.
+				 * @param closed True, to close the queue; False, to re-open the queue
+				 */
+				void setClosed(const bool closed);
+
+				/**
+				 * Registers the latency of an element which has been taken from the queue, the lock must be locked.
+				 * @param latency The time the element waited in the queue, in seconds, with range [0, infinity)
+				 */
+				void registerLatency(const double latency);
+
+			protected:
+
+				/// The name of the queue.
+				std::string name_;
+
+				/// The capacity of the queue.
+				size_t capacity_ = 0;
+
+				/// The policy applied when an element is pushed into the full queue.
+				DropPolicy dropPolicy_ = DP_BLOCK;
+
+				/// The maximal age of an element in seconds, 0 to keep all elements.
+				double maximalAge_ = 0.0;
+
+				/// The signal which is pulsed whenever an element has been pushed.
+				Signal pushedSignal_;
+
+				/// The signal which is pulsed whenever an element has been taken.
+				Signal poppedSignal_;
+
+				/// True, if the queue is closed.
+				std::atomic<bool> closed_ = false;
+
+				/// The number of pushed elements.
+				uint64_t pushed_ = 0ull;
+
+				/// The number of taken elements.
+				uint64_t popped_ = 0ull;
+
+				/// The number of elements dropped because the queue was full.
+				uint64_t dropped_ = 0ull;
+
+				/// The number of elements dropped because they exceeded the maximal age.
+				uint64_t droppedStale_ = 0ull;
+
+				/// The sum of all latencies, in seconds.
+				double sumLatency_ = 0.0;
+
+				/// The maximal latency, in seconds.
+				double maximalLatency_ = 0.0;
+
+				/// The queue's lock.
+				mutable Lock lock_;
+		};
+
+		/**
+		 * This class implements a bounded thread-safe queue for elements with specific data type.
+		 * @tparam T The data type of the elements, e.g., Frame
+		 */
+		template <typename T>
+		class QueueT : public Queue
+		{
+			friend class Pipeline;
+
+			protected:
+
+				/**
+				 * Definition of a pair combining an element with the timestamp the element has been pushed.
+				 */
+				using TimedElement = std::pair<T, Timestamp>;
+
+			public:
+
+				/**
+				 * Pushes a new element into this queue.
+				 * In case the queue is full, the queue's drop policy is applied.
+				 * @param element The element to push
+				 * @return True, if the element has been pushed; False, if the element has been dropped or if the queue is closed
+				 */
+				bool push(T&& element);
+
+				/**
+				 * Takes the oldest element from this queue.
+				 * Elements exceeding the maximal age of the queue are dropped.
+				 * @param element The resulting element
+				 * @param timeout The maximal time to wait for an element, in milliseconds, 0 to return immediately
+				 * @return True, if an element could be taken
+				 */
+				bool pop(T& element, const unsigned int timeout = 0u);
+
+				/**
+				 * Returns the number of elements currently in this queue.
+				 * @see Queue::size().
+				 */
+				size_t size() const override;
+
+			protected:
+
+				/**
+				 * Creates a new queue.
+				 * @see Queue::Queue().
+				 */
+				inline QueueT(std::string name, const size_t capacity, const DropPolicy dropPolicy, const double maximalAge);
+
+			protected:
+
+				/// The elements of this queue, the oldest element first.
+				std::deque<TimedElement> elements_;
+		};
+
+		/**
+		 * Definition of a shared pointer holding a queue.
+		 * @tparam T The data type of the queue's elements
+		 */
+		template <typename T>
+		using SharedQueue = std::shared_ptr<QueueT<T>>;
+
+		/**
+		 * Definition of a stage function transforming an input element into an output element.
+		 * The function returns False if no output element has been created.
+		 * @tparam TInput The data type of the input elements
+		 * @tparam TOutput The data type of the output elements
+		 */
+		template <typename TInput, typename TOutput>
+		using StageFunction = std::function<bool(TInput& input, TOutput& output, Worker* worker)>;
+
+		/**
+		 * Definition of a sink function consuming an input element.
+		 * @tparam TInput The data type of the input elements
+		 */
+		template <typename TInput>
+		using SinkFunction = std::function<void(TInput& input, Worker* worker)>;
+
+	protected:
+
+		/**
+		 * This class implements one stage of the pipeline running in an own thread.
+		 */
+		class OCEAN_BASE_EXPORT Stage : protected Thread
+		{
+			public:
+
+				/**
+				 * Definition of a function executing one step of the stage.
+				 * The function returns True if an element has been processed.
+				 */
+				using StepFunction = std::function<bool()>;
+
+			public:
+
+				/**
+				 * Creates a new stage.
+				 * @param name The name of the stage
+				 * @param stepFunction The function executing one step of the stage, must be valid
+				 * @param priorityClass The priority class of the stage's thread
+				 * @param coreAffinity The core affinity of the stage's thread
+				 */
+				Stage(std::string name, StepFunction&& stepFunction, const PriorityClass priorityClass, const CoreAffinity coreAffinity);
+
+				/**
+				 * Destructs the stage and stops the stage's thread.
+				 */
+				~Stage() override;
+
+				/**
+				 * Starts the stage's thread.
+				 * @return True, if succeeded
+				 */
+				bool start();
+
+				/**
+				 * Stops the stage's thread and waits until the thread has finished.
+				 */
+				void stop();
+
+				/**
+				 * Returns the statistic of this stage.
+				 * @return The stage's statistic
+				 */
+				StageStatistic statistic() const;
+
+			protected:
+
+				/**
+				 * The thread run function.
+				 * @see Thread::threadRun().
+				 */
+				void threadRun() override;
+
+			protected:
+
+				/// The name of the stage.
+				std::string name_;
+
+				/// The function executing one step of the stage.
+				StepFunction stepFunction_;
+
+				/// The priority class of the stage's thread.
+				PriorityClass priorityClass_ = PC_DEFAULT;
+
+				/// The core affinity of the stage's thread.
+				CoreAffinity coreAffinity_ = CA_ANY;
+
+				/// The number of processed elements.
+				uint64_t executions_ = 0ull;
+
+				/// The sum of all processing times, in seconds.
+				double sumDuration_ = 0.0;
+
+				/// The maximal processing time, in seconds.
+				double maximalDuration_ = 0.0;
+
+				/// The stage's lock.
+				mutable Lock lock_;
+		};
+
+		/**
+		 * Definition of a unique pointer holding a stage.
+		 */
+		using UniqueStage = std::unique_ptr<Stage>;
+
+		/**
+		 * Definition of a vector holding stages.
+		 */
+		using UniqueStages = std::vector<UniqueStage>;
+
+		/**
+		 * Definition of a vector holding queues.
+		 */
+		using SharedQueues = std::vector<std::shared_ptr<Queue>>;
+
+	public:
+
+		/**
+		 * Creates a new pipeline without any stage.
+		 */
+		Pipeline() = default;
+
+		/**
+		 * Destructs the pipeline and stops all stages.
+		 */
+		~Pipeline();
+
+		/**
+		 * Adds a new queue to this pipeline.
+		 * Queues can be added while the pipeline is stopped only.
+		 * @param name The name of the queue, used for the statistics
+		 * @param capacity The capacity of the queue, with range [1, infinity)
+		 * @param dropPolicy The policy applied when an element is pushed into the full queue
+		 * @param maximalAge The maximal age of an element in seconds before it is dropped when taken from the queue, 0 to keep all elements, with range [0, infinity)
+		 * @return The new queue, nullptr if the queue could not be added
+		 * @tparam T The data type of the queue's elements
+		 */
+		template <typename T>
+		SharedQueue<T> addQueue(std::string name, const size_t capacity, const DropPolicy dropPolicy = DP_BLOCK, const double maximalAge = 0.0);
+
+		/**
+		 * Adds a new stage transforming the elements of an input queue into elements of an output queue.
+		 * Stages can be added while the pipeline is stopped only.
+		 * @param name The name of the stage, used for the statistics and as thread name
+		 * @param inputQueue The queue providing the input elements, must be valid
+		 * @param outputQueue The queue receiving the output elements, must be valid
+		 * @param stageFunction The function transforming one element, must be valid
+		 * @param worker Optional worker object which is forwarded to the stage function e.g., to distribute CV kernels
+		 * @param priorityClass The priority class of the stage's thread
+		 * @param coreAffinity The core affinity of the stage's thread
+		 * @return True, if succeeded
+		 * @tparam TInput The data type of the input elements
+		 * @tparam TOutput The data type of the output elements
+		 */
+		template <typename TInput, typename TOutput>
+		bool addStage(std::string name, SharedQueue<TInput> inputQueue, SharedQueue<TOutput> outputQueue, StageFunction<TInput, TOutput> stageFunction, Worker* worker = nullptr, const Thread::PriorityClass priorityClass = Thread::PC_DEFAULT, const Thread::CoreAffinity coreAffinity = Thread::CA_ANY);
+
+		/**
+		 * Adds a new stage consuming the elements of an input queue.
+		 * Stages can be added while the pipeline is stopped only.
+		 * @param name The name of the stage, used for the statistics and as thread name
+		 * @param inputQueue The queue providing the input elements, must be valid
+		 * @param sinkFunction The function consuming one element, must be valid
+		 * @param worker Optional worker object which is forwarded to the sink function
+		 * @param priorityClass The priority class of the stage's thread
+		 * @param coreAffinity The core affinity of the stage's thread
+		 * @return True, if succeeded
+		 * @tparam TInput The data type of the input elements
+		 */
+		template <typename TInput>
+		bool addSink(std::string name, SharedQueue<TInput> inputQueue, SinkFunction<TInput> sinkFunction, Worker* worker = nullptr, const Thread::PriorityClass priorityClass = Thread::PC_DEFAULT, const Thread::CoreAffinity coreAffinity = Thread::CA_ANY);
+
+		/**
+		 * Starts all stages of this pipeline.
+		 * @return True, if succeeded
+		 */
+		bool start();
+
+		/**
+		 * Stops all stages of this pipeline.
+		 * All queues are closed so that blocked producers return, the elements remaining in the queues are kept.
+		 */
+		void stop();
+
+		/**
+		 * Returns whether this pipeline is running.
+		 * @return True, if so
+		 */
+		bool isRunning() const;
+
+		/**
+		 * Returns the statistics of all queues of this pipeline.
+		 * @return The queues' statistics, in the order the queues have been added
+		 */
+		QueueStatistics queueStatistics() const;
+
+		/**
+		 * Returns the statistics of all stages of this pipeline.
+		 * @return The stages' statistics, in the order the stages have been added
+		 */
+		StageStatistics stageStatistics() const;
+
+		/**
+		 * Returns a readable report of the statistics of all queues and stages.
+		 * @return The report, one line for each queue and stage
+		 */
+		std::string report() const;
+
+	protected:
+
+		/**
+		 * Adds a new stage.
+		 * @param name The name of the stage
+		 * @param stepFunction The function executing one step of the stage, must be valid
+		 * @param priorityClass The priority class of the stage's thread
+		 * @param coreAffinity The core affinity of the stage's thread
+		 * @return True, if succeeded
+		 */
+		bool addStage(std::string name, Stage::StepFunction&& stepFunction, const Thread::PriorityClass priorityClass, const Thread::CoreAffinity coreAffinity);
+
+		/**
+		 * Adds a new queue.
+		 * @param queue The queue to add, must be valid
+		 * @return True, if succeeded
+		 */
+		bool addQueue(std::shared_ptr<Queue> queue);
+
+	protected:
+
+		/// The interval in which waiting stages check whether they need to stop, in milliseconds.
+		static constexpr unsigned int waitInterval_ = 10u;
+
+		/// The queues of this pipeline.
+		SharedQueues queues_;
+
+		/// The stages of this pipeline.
+		UniqueStages stages_;
+
+		/// True, if the pipeline is running.
+		bool isRunning_ = false;
+
+		/// The pipeline's lock.
+		mutable Lock lock_;
+};
+
+inline const std::string& Pipeline::Queue::name() const
+{
+	return name_;
+}
+
+inline bool Pipeline::Queue::isClosed() const
+{
+	return closed_.load();
+}
+
+template <typename T>
+inline Pipeline::QueueT<T>::QueueT(std::string name, const size_t capacity, const DropPolicy dropPolicy, const double maximalAge) :
+	Queue(std::move(name), capacity, dropPolicy, maximalAge)
+{
+	// nothing to do here
+}
+
+template <typename T>
+bool Pipeline::QueueT<T>::push(T&& element)
+{
+	TemporaryScopedLock scopedLock(lock_);
+
+	while (elements_.size() >= capacity_)
+	{
+		if (closed_)
+		{
+			return false;
+		}
+
+		switch (dropPolicy_)
+		{
+			case DP_BLOCK:
+			{
+				scopedLock.release();
+
+				poppedSignal_.wait(waitInterval_);
+
+				scopedLock.relock(lock_);
+				break;
+			}
+
+			case DP_DROP_OLDEST:
+				elements_.pop_front();
+				++dropped_;
+				break;
+
+			case DP_DROP_NEWEST:
+				++dropped_;
+				return false;
+		}
+	}
+
+	if (closed_)
+	{
+		return false;
+	}
+
+	elements_.emplace_back(std::move(element), Timestamp(true));
+	++pushed_;
+
+	scopedLock.release();
+
+	pushedSignal_.pulse();
+
+	return true;
+}
+
+template <typename T>
+bool Pipeline::QueueT<T>::pop(T& element, const unsigned int timeout)
+{
+	for (unsigned int iteration = 0u; iteration < 2u; ++iteration)
+	{
+		TemporaryScopedLock scopedLock(lock_);
+
+		const Timestamp currentTimestamp(true);
+
+		while (!elements_.empty())
+		{
+			const double latency = double(currentTimestamp - elements_.front().second);
+
+			if (maximalAge_ > 0.0 && latency > maximalAge_)
+			{
+				elements_.pop_front();
+				++droppedStale_;
+
+				continue;
+			}
+
+			element = std::move(elements_.front().first);
+			elements_.pop_front();
+
+			registerLatency(latency);
+
+			scopedLock.release();
+
+			poppedSignal_.pulse();
+
+			return true;
+		}
+
+		scopedLock.release();
+
+		if (iteration != 0u || timeout == 0u || closed_)
+		{
+			break;
+		}
+
+		pushedSignal_.wait(timeout);
+	}
+
+	return false;
+}
+
+template <typename T>
+size_t Pipeline::QueueT<T>::size() const
+{
+	const ScopedLock scopedLock(lock_);
+
+	return elements_.size();
+}
+
+template <typename T>
+Pipeline::SharedQueue<T> Pipeline::addQueue(std::string name, const size_t capacity, const DropPolicy dropPolicy, const double maximalAge)
+{
+	ocean_assert(capacity >= 1);
+	ocean_assert(maximalAge >= 0.0);
+
+	if (capacity == 0 || maximalAge < 0.0)
+	{
+		return nullptr;
+	}
+
+	SharedQueue<T> queue(new QueueT<T>(std::move(name), capacity, dropPolicy, maximalAge));
+
+	if (!addQueue(queue))
+	{
+		return nullptr;
+	}
+
+	return queue;
+}
+
+template <typename TInput, typename TOutput>
+bool Pipeline::addStage(std::string name, SharedQueue<TInput> inputQueue, SharedQueue<TOutput> outputQueue, StageFunction<TInput, TOutput> stageFunction, Worker* worker, const Thread::PriorityClass priorityClass, const Thread::CoreAffinity coreAffinity)
+{
+	ocean_assert(inputQueue && outputQueue && stageFunction);
+
+	if (!inputQueue || !outputQueue || !stageFunction)
+	{
+		return false;
+	}
+
+	Stage::StepFunction stepFunction = [inputQueue = std::move(inputQueue), outputQueue = std::move(outputQueue), stageFunction = std::move(stageFunction), worker]()
+	{
+		TInput input;
+
+		if (!inputQueue->pop(input, waitInterval_))
+		{
+			return false;
+		}
+
+		TOutput output;
+
+		if (stageFunction(input, output, worker))
+		{
+			outputQueue->push(std::move(output));
+		}
+
+		return true;
+	};
+
+	return addStage(std::move(name), std::move(stepFunction), priorityClass, coreAffinity);
+}
+
+template <typename TInput>
+bool Pipeline::addSink(std::string name, SharedQueue<TInput> inputQueue, SinkFunction<TInput> sinkFunction, Worker* worker, const Thread::PriorityClass priorityClass, const Thread::CoreAffinity coreAffinity)
+{
+	ocean_assert(inputQueue && sinkFunction);
+
+	if (!inputQueue || !sinkFunction)
+	{
+		return false;
+	}
+
+	Stage::StepFunction stepFunction = [inputQueue = std::move(inputQueue), sinkFunction = std::move(sinkFunction), worker]()
+	{
+		TInput input;
+
+		if (!inputQueue->pop(input, waitInterval_))
+		{
+			return false;
+		}
+
+		sinkFunction(input, worker);
+
+		return true;
+	};
+
+	return addStage(std::move(name), std::move(stepFunction), priorityClass, coreAffinity);
+}
+
+}
+
+#endif // META_OCEAN_BASE_PIPELINE_H
@@ -6,7 +6,11 @@
  */
 
 #include "ocean/base/PluginManager.h"
+#include "ocean/base/HighPerformanceTimer.h"
 #include "ocean/base/Messenger.h"
+#include "ocean/base/String.h"
+
+#include <algorithm>
 
 #ifndef _WINDOWS
 	#include <dirent.h>
@@ -16,7 +20,7 @@
 namespace Ocean
 {
 
-PluginManager::Plugin::Plugin(const std::string& filename, const std::string& name, const std::string& description, const PluginType type, const PluginPriority priority, const PluginTypeSet& dependencySet, const std::string& thirdpartyDependences, const std::string& thirdpartyDescription) :
+PluginManager::Plugin::Plugin(const std::string& filename, const std::string& name, const std::string& description, const PluginType type, const PluginPriority priority, const PluginTypeSet& dependencySet, const std::string& thirdpartyDependences, const std::string& thirdpartyDescription, const Strings& capabilities) :
 	filename_(filename),
 	name_(name),
 	description_(description),
@@ -24,10 +28,52 @@ PluginManager::Plugin::Plugin(const std::string& filename, const std::string& na
 	dependencySet_(dependencySet),
 	priority_(priority),
 	thirdpartyDependences_(thirdpartyDependences),
-	thirdpartyDescription_(thirdpartyDescription)
+	thirdpartyDescription_(thirdpartyDescription),
+	capabilities_(capabilities)
 {
 	ocean_assert(filename_.empty() == false);
 	ocean_assert(name_.empty() == false);
+
+	for (std::string& capability : capabilities_)
+	{
+		capability = String::toLower(capability);
+	}
+}
+
+bool PluginManager::Plugin::hasCapability(const std::string& capability) const
+{
+	if (capability.empty() || capabilities_.empty())
+	{
+		return false;
+	}
+
+	const std::string lowerCapability(String::toLower(capability));
+
+	for (const std::string& pluginCapability : capabilities_)
+	{
+		if (pluginCapability == lowerCapability)
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+bool PluginManager::Plugin::timedLoad() const
+{
+	const HighPerformanceTimer timer;
+
+	const bool result = load();
+
+	loadDuration_ = timer.seconds();
+
+	if (result)
+	{
+		Log::debug() << "The plugin \"" << name_ << "\" needed " << String::toAString(loadDuration_ * 1000.0, 2u) << "ms to load.";
+	}
+
+	return result;
 }
 
 bool PluginManager::Plugin::load() const
@@ -378,7 +424,7 @@ bool PluginManager::loadPlugin(const std::string& name)
 	{
 		if (i->name() == name)
 		{
-			if (i->load())
+			if (i->timedLoad())
 			{
 				loadedPlugins_.push_back(*i);
 				collectedPlugins_.erase(i);
@@ -392,7 +438,7 @@ bool PluginManager::loadPlugin(const std::string& name)
 	return false;
 }
 
-bool PluginManager::loadPlugins(const Names& names)
+bool PluginManager::loadPlugins(const Names& names, Worker* worker)
 {
 	const ScopedLock scopedLock(lock_);
 	PluginSet pluginsToLoad;
@@ -408,22 +454,10 @@ bool PluginManager::loadPlugins(const Names& names)
 		}
 	}
 
-	bool loaded = false;
-	for (PluginSet::const_iterator i = pluginsToLoad.begin(); i != pluginsToLoad.end(); ++i)
-	{
-		const Plugin& plugin = *i;
-
-		if (plugin.load())
-		{
-			loadedPlugins_.push_back(*i);
-			loaded = true;
-		}
-	}
-
-	return loaded;
+	return loadPluginSet(pluginsToLoad, worker, false);
 }
 
-bool PluginManager::loadPlugins(const PluginType type)
+bool PluginManager::loadPlugins(const PluginType type, Worker* worker)
 {
 	const ScopedLock scopedLock(lock_);
 	PluginSet pluginsToLoad;
@@ -436,22 +470,10 @@ bool PluginManager::loadPlugins(const PluginType type)
 		}
 	}
 
-	bool loaded = false;
-	for (PluginSet::const_iterator i = pluginsToLoad.begin(); i != pluginsToLoad.end(); ++i)
-	{
-		const Plugin& plugin = *i;
-
-		if (plugin.load())
-		{
-			loadedPlugins_.push_back(*i);
-			loaded = true;
-		}
-	}
-
-	return loaded;
+	return loadPluginSet(pluginsToLoad, worker, false);
 }
 
-bool PluginManager::loadAllPlugins()
+bool PluginManager::loadAllPlugins(Worker* worker)
 {
 	const ScopedLock scopedLock(lock_);
 	PluginSet pluginsToLoad;
@@ -461,23 +483,67 @@ bool PluginManager::loadAllPlugins()
 		pluginsToLoad.insert(*iP);
 	}
 
-	bool loaded = false;
-	for (PluginSet::const_iterator i = pluginsToLoad.begin(); i != pluginsToLoad.end(); ++i)
+	return loadPluginSet(pluginsToLoad, worker, true);
+}
+
+bool PluginManager::loadPluginForCapability(const std::string& capability, const PluginType type)
+{
+	if (capability.empty())
 	{
-		const Plugin& plugin = *i;
+		return false;
+	}
+
+	const ScopedLock scopedLock(lock_);
 
-		if (plugin.load())
+	PluginSet pluginsToLoad;
+
+	for (const Plugin& plugin : collectedPlugins_)
+	{
+		if ((plugin.type() & type) && plugin.hasCapability(capability))
 		{
-			loadedPlugins_.push_back(*i);
-			loaded = true;
+			pluginsToLoad.insert(plugin);
 		}
-		else
+	}
+
+	// the plugin with the highest priority is loaded first, further plugins are loaded only if the previous plugin fails
+
+	for (const Plugin& plugin : pluginsToLoad)
+	{
+		if (plugin.timedLoad())
 		{
-			Log::error() << "Could not loaded the \"" << i->name() << "\" plugin.";
+			Log::debug() << "Loaded the \"" << plugin.name() << "\" plugin on demand for \"" << capability << "\".";
+
+			loadedPlugins_.push_back(plugin);
+
+			for (Plugins::iterator i = collectedPlugins_.begin(); i != collectedPlugins_.end(); ++i)
+			{
+				if (i->filename() == plugin.filename())
+				{
+					collectedPlugins_.erase(i);
+					break;
+				}
+			}
+
+			return true;
 		}
 	}
 
-	return loaded;
+	return false;
+}
+
+PluginManager::LoadDurations PluginManager::loadDurations() const
+{
+	const ScopedLock scopedLock(lock_);
+
+	LoadDurations result;
+	result.reserve(loadedPlugins_.size());
+
+	for (const Plugin& plugin : loadedPlugins_)
+	{
+		result.emplace_back(plugin.name(), plugin.loadDuration());
+	}
+
+	return result;
 }
 
 bool PluginManager::unloadAllPlugins()
@@ -559,6 +625,135 @@ void PluginManager::release()
 	unloadAllPlugins();
 }
 
+bool PluginManager::loadPluginSet(const PluginSet& pluginsToLoad, Worker* worker, const bool logFailures)
+{
+	const ScopedLock scopedLock(lock_);
+
+	// the plugins are sorted by their dependency order, consecutive plugins which do not depend on each other form a stage and can be loaded concurrently
+
+	const Plugins sortedPlugins(pluginsToLoad.cbegin(), pluginsToLoad.cend());
+
+	std::vector<uint8_t> results(sortedPlugins.size(), 0u);
+
+	const HighPerformanceTimer timer;
+
+	size_t stageBegin = 0;
+
+	while (stageBegin < sortedPlugins.size())
+	{
+		size_t stageEnd = stageBegin + 1;
+
+		while (worker != nullptr && stageEnd < sortedPlugins.size())
+		{
+			bool independent = true;
+
+			for (size_t n = stageBegin; independent && n < stageEnd; ++n)
+			{
+				independent = !sortedPlugins[stageEnd].dependsOn(sortedPlugins[n].type()) && !sortedPlugins[n].dependsOn(sortedPlugins[stageEnd].type());
+			}
+
+			if (!independent)
+			{
+				break;
+			}
+
+			++stageEnd;
+		}
+
+		const unsigned int stageSize = (unsigned int)(stageEnd - stageBegin);
+
+		if (worker != nullptr && stageSize > 1u)
+		{
+			worker->executeFunction(Worker::Function::createStatic(&PluginManager::loadPluginsSubset, sortedPlugins.data() + stageBegin, results.data() + stageBegin, 0u, 0u), 0u, stageSize, 2u, 3u, 1u);
+		}
+		else
+		{
+			loadPluginsSubset(sortedPlugins.data() + stageBegin, results.data() + stageBegin, 0u, stageSize);
+		}
+
+		stageBegin = stageEnd;
+	}
+
+	size_t loadedPlugins = 0;
+
+	for (size_t n = 0; n < sortedPlugins.size(); ++n)
+	{
+		if (results[n] != 0u)
+		{
+			loadedPlugins_.push_back(sortedPlugins[n]);
+			++loadedPlugins;
+
+			for (Plugins::iterator i = collectedPlugins_.begin(); i != collectedPlugins_.end(); ++i)
+			{
+				if (i->filename() == sortedPlugins[n].filename())
+				{
+					collectedPlugins_.erase(i);
+					break;
+				}
+			}
+		}
+		else if (logFailures)
+		{
+			Log::error() << "Could not loaded the \"" << sortedPlugins[n].name() << "\" plugin.";
+		}
+	}
+
+	if (!sortedPlugins.empty())
+	{
+		Log::debug() << "Loaded " << loadedPlugins << " of " << sortedPlugins.size() << " plugins in " << String::toAString(timer.mseconds(), 2u) << "ms.";
+	}
+
+	return loadedPlugins != 0;
+}
+
+void PluginManager::loadPluginsSubset(const Plugin* plugins, uint8_t* results, const unsigned int firstPlugin, const unsigned int numberPlugins)
+{
+	ocean_assert(plugins != nullptr && results != nullptr);
+
+	for (unsigned int n = firstPlugin; n < firstPlugin + numberPlugins; ++n)
+	{
+		results[n] = plugins[n].timedLoad() ? 1u : 0u;
+	}
+}
+
+Strings PluginManager::translateCapabilities(const std::string& capabilities)
+{
+	Strings result;
+
+	std::string::size_type start = 0;
+
+	while (start < capabilities.size())
+	{
+		std::string::size_type end = capabilities.find(';', start);
+
+		if (end == std::string::npos)
+		{
+			end = capabilities.size();
+		}
+
+		// capabilities are separated by semicolons only, surrounding whitespace is ignored
+
+		const std::string::size_type first = capabilities.find_first_not_of(" \t\r\n", start);
+
+		if (first != std::string::npos && first < end)
+		{
+			const std::string::size_type last = capabilities.find_last_not_of(" \t\r\n", end - 1);
+			ocean_assert(last != std::string::npos && last >= first);
+
+			const std::string capability(String::toLower(capabilities.substr(first, last - first + 1)));
+
+			if (std::find(result.cbegin(), result.cend(), capability) == result.cend())
+			{
+				result.push_back(capability);
+			}
+		}
+
+		start = end + 1;
+	}
+
+	return result;
+}
+
 bool PluginManager::determinePlugin(const std::string& filename, Plugin& plugin)
 {
 	bool isValid = false;
@@ -581,6 +776,7 @@ bool PluginManager::determinePlugin(const std::string& filename, Plugin& plugin)
 			std::wstring description;
 			std::wstring thirdpartyDependences;
 			std::wstring thirdpartyDescription;
+			std::wstring capabilities;
 
 			PluginType type = TYPE_UNKNOWN;
 			PluginPriority priority = PRIORITY_UNDEFINED;
@@ -657,10 +853,15 @@ bool PluginManager::determinePlugin(const std::string& filename, Plugin& plugin)
 					}
 				}
 
+				if (VerQueryValue(data.data(), L"\\OceanPlugin\\Capabilities", &value, &valueLength) && valueLength > 0)
+				{
+					capabilities = std::wstring((wchar_t*)value, valueLength - 1);
+				}
+
 				if (name.empty() == false && type != TYPE_UNKNOWN)
 				{
 					plugin = Plugin(filename, String::toAString(name), String::toAString(description), type, priority, dependences,
-							String::toAString(thirdpartyDependences), String::toAString(thirdpartyDescription));
+							String::toAString(thirdpartyDependences), String::toAString(thirdpartyDescription), translateCapabilities(String::toAString(capabilities)));
 				}
 				else
 				{
@@ -11,6 +11,7 @@
 #include "ocean/base/Base.h"
 #include "ocean/base/ObjectRef.h"
 #include "ocean/base/Singleton.h"
+#include "ocean/base/Worker.h"
 
 #include <set>
 #include <vector>
@@ -18,6 +19,9 @@
 namespace Ocean
 {
 
+// Forward declaration for test library.
+namespace Test { namespace TestBase { class TestPluginManager; } }
+
 /**
  * This class implements a manager for all plugins available for the Ocean framework.
  * @ingroup base
@@ -25,6 +29,7 @@ namespace Ocean
 class OCEAN_BASE_EXPORT PluginManager : public Singleton<PluginManager>
 {
 	friend class Singleton<PluginManager>;
+	friend class Test::TestBase::TestPluginManager;
 
 	public:
 
@@ -79,6 +84,16 @@ class OCEAN_BASE_EXPORT PluginManager : public Singleton<PluginManager>
 		 */
 		using Names = Strings;
 
+		/**
+		 * Definition of a pair combining a plugin name with the duration the plugin needed to load, in seconds.
+		 */
+		using LoadDurationPair = std::pair<std::string, double>;
+
+		/**
+		 * Definition of a vector holding load durations of plugins.
+		 */
+		using LoadDurations = std::vector<LoadDurationPair>;
+
 	private:
 
 		/**
@@ -120,8 +135,9 @@ class OCEAN_BASE_EXPORT PluginManager : public Singleton<PluginManager>
 				 * @param dependencySet Set of ocean plugin types this plugin depends on.
 				 * @param thirdpartyDependences 3rd party dependences
 				 * @param thirdpartyDescription 3rd party description
+				 * @param capabilities The capabilities the plugin declares, e.g., file extensions or device names, will be compared case-insensitively
 				 */
-				Plugin(const std::string& filename, const std::string& name, const std::string& description, const PluginType type, const PluginPriority priority, const PluginTypeSet& dependencySet, const std::string& thirdpartyDependences, const std::string& thirdpartyDescription);
+				Plugin(const std::string& filename, const std::string& name, const std::string& description, const PluginType type, const PluginPriority priority, const PluginTypeSet& dependencySet, const std::string& thirdpartyDependences, const std::string& thirdpartyDescription, const Strings& capabilities = Strings());
 
 				/**
 				 * Returns the filename of the plugin.
@@ -165,6 +181,33 @@ class OCEAN_BASE_EXPORT PluginManager : public Singleton<PluginManager>
 				 */
 				inline const std::string& thirdpartyDescription() const;
 
+				/**
+				 * Returns whether this plugin depends on a specific plugin type.
+				 * @param type The plugin type to check
+				 * @return True, if so
+				 */
+				inline bool dependsOn(const PluginType type) const;
+
+				/**
+				 * Returns whether this plugin declares a specific capability.
+				 * @param capability The capability to check, e.g., a file extension or a device name, will be compared case-insensitively
+				 * @return True, if so
+				 */
+				bool hasCapability(const std::string& capability) const;
+
+				/**
+				 * Returns the duration the plugin needed to load.
+				 * @return The load duration in seconds, with range [0, infinity), 0 if the plugin has not been loaded
+				 */
+				inline double loadDuration() const;
+
+				/**
+				 * Loads the plugin and measures the duration of the load.
+				 * @return True, if succeeded
+				 * @see loadDuration().
+				 */
+				bool timedLoad() const;
+
 				/**
 				 * Loads the plugin.
 				 * @return True, if succeeded
@@ -246,6 +289,12 @@ class OCEAN_BASE_EXPORT PluginManager : public Singleton<PluginManager>
 				/// 3rd party description.
 				std::string thirdpartyDescription_;
 
+				/// The capabilities the plugin declares, in lower case.
+				Strings capabilities_;
+
+				/// The duration the plugin needed to load, in seconds.
+				mutable double loadDuration_ = 0.0;
+
 				/// Plugin load function.
 				mutable PluginLoadFunction loadFunction_ = nullptr;
 
@@ -295,23 +344,45 @@ class OCEAN_BASE_EXPORT PluginManager : public Singleton<PluginManager>
 
 		/**
 		 * Loads several plugins and uses the internal dependency order.
+		 * Plugins which do not depend on each other can be loaded concurrently.
 		 * @param names Names of the plugins to load
+		 * @param worker Optional worker object to load independent plugins in parallel
 		 * @return True, if at least one plugin has been loaded
 		 */
-		bool loadPlugins(const Names& names);
+		bool loadPlugins(const Names& names, Worker* worker = nullptr);
 
 		/**
 		 * Loads all plugins with a specified type.
+		 * Plugins which do not depend on each other can be loaded concurrently.
 		 * @param type Plugin type to load, can be a combination of all defined plugin types
+		 * @param worker Optional worker object to load independent plugins in parallel
 		 * @return True, if at least one plugin has been loaded
 		 */
-		bool loadPlugins(const PluginType type);
+		bool loadPlugins(const PluginType type, Worker* worker = nullptr);
 
 		/**
 		 * Loads all available plugins.
+		 * Plugins which do not depend on each other can be loaded concurrently.
+		 * @param worker Optional worker object to load independent plugins in parallel
 		 * @return True, if at least one plugin has been loaded
 		 */
-		bool loadAllPlugins();
+		bool loadAllPlugins(Worker* worker = nullptr);
+
+		/**
+		 * Loads the collected plugin which declares a specific capability, e.g., a file extension or a device name.
+		 * This function allows to load plugins lazily on first use instead of loading all plugins at startup, e.g., Media::Manager loads a plugin for a file extension no registered library can handle.<br>
+		 * Plugins declare their capabilities in their plugin information, as a list separated by semicolons.
+		 * @param capability The capability for which a plugin will be loaded, will be compared case-insensitively
+		 * @param type The type of the plugin to load, can be a combination of all defined plugin types
+		 * @return True, if a plugin has been loaded; False, if no collected plugin declares the capability or if the plugin could not be loaded
+		 */
+		bool loadPluginForCapability(const std::string& capability, const PluginType type = TYPE_ANY);
+
+		/**
+		 * Returns the durations all loaded plugins needed to load, e.g., to analyze the startup time of an application.
+		 * @return The load durations of all loaded plugins, in the order in which the plugins have been loaded
+		 */
+		LoadDurations loadDurations() const;
 
 		/**
 		 * Unloads all loaded plugins.
@@ -375,6 +446,33 @@ class OCEAN_BASE_EXPORT PluginManager : public Singleton<PluginManager>
 
 	#endif // defined(__APPLE__)
 
+		/**
+		 * Loads plugins sorted by their dependency order, independent plugins are loaded in parallel.
+		 * The loaded plugins are added to the loaded plugins of this manager.
+		 * @param pluginsToLoad The plugins to load
+		 * @param worker Optional worker object to load independent plugins in parallel
+		 * @param logFailures True, to log an error for each plugin which could not be loaded
+		 * @return True, if at least one plugin has been loaded
+		 */
+		bool loadPluginSet(const PluginSet& pluginsToLoad, Worker* worker, const bool logFailures);
+
+		/**
+		 * Loads a subset of plugins.
+		 * @param plugins The plugins to load, must be valid
+		 * @param results The resulting load states, one for each plugin, must be valid
+		 * @param firstPlugin The first plugin to be handled
+		 * @param numberPlugins The number of plugins to be handled
+		 */
+		static void loadPluginsSubset(const Plugin* plugins, uint8_t* results, const unsigned int firstPlugin, const unsigned int numberPlugins);
+
+		/**
+		 * Translates a list of capabilities separated by semicolons to individual capabilities.
+		 * Whitespace around each capability is removed, empty capabilities and duplicates (compared case-insensitively) are skipped.
+		 * @param capabilities The capabilities to translate, e.g., "jpg; png;JPEG", can be empty
+		 * @return The individual capabilities, in lower case, in the order of their first occurrence
+		 */
+		static Strings translateCapabilities(const std::string& capabilities);
+
 		/**
 		 * Translates a plugin type string to a plugin type id.
 		 * @param type Plugin type string to translate
@@ -432,6 +530,16 @@ inline const std::string& PluginManager::Plugin::thirdpartyDescription() const
 	return thirdpartyDescription_;
 }
 
+inline bool PluginManager::Plugin::dependsOn(const PluginType type) const
+{
+	return dependencySet_.find(type) != dependencySet_.cend();
+}
+
+inline double PluginManager::Plugin::loadDuration() const
+{
+	return loadDuration_;
+}
+
 inline const std::string& PluginManager::fileExtension() const
 {
 	return pluginFileExtension_;
@@ -134,6 +134,7 @@ bool PluginManager::determinePluginApple(const std::string& filename, Plugin& pl
 	const std::string description(StringApple::toUTF8([nsDirectory objectForKey:@"OceanPluginDescription"]));
 	const std::string thirdpartyDependences(StringApple::toUTF8([nsDirectory objectForKey:@"OceanPluginThirdpartydependences"]));
 	const std::string thirdpartyDescription(StringApple::toUTF8([nsDirectory objectForKey:@"OceanPluginThirdpartydescription"]));
+	const std::string capabilities(StringApple::toUTF8([nsDirectory objectForKey:@"OceanPluginCapabilities"]));
 
 	const PluginType type = translateType(StringApple::toUTF8([nsDirectory objectForKey:@"OceanPluginType"]));
 
@@ -171,7 +172,7 @@ bool PluginManager::determinePluginApple(const std::string& filename, Plugin& pl
 
 	if (name.empty() == false && type != TYPE_UNKNOWN)
 	{
-		plugin = Plugin(filename, String::toAString(name), String::toAString(description), type, priority, dependences, String::toAString(thirdpartyDependences), String::toAString(thirdpartyDescription));
+		plugin = Plugin(filename, String::toAString(name), String::toAString(description), type, priority, dependences, String::toAString(thirdpartyDependences), String::toAString(thirdpartyDescription), translateCapabilities(capabilities));
 	}
 	else
 	{
@@ -437,57 +437,96 @@ ProcessorInstructions Processor::realInstructions()
 	{
 		std::string line;
 		const std::string flagsKey = "flags";
+		const std::string featuresKey = "Features";
+
+		bool hasAVX512F = false;
+		bool hasAVX512BW = false;
 
 		while (std::getline(stream, line))
 		{
-			if (line.compare(0, flagsKey.length(), flagsKey) != 0)
+			if (line.compare(0, flagsKey.length(), flagsKey) == 0)
 			{
-				continue;
-			}
+				std::stringstream buffer(line);
+				std::string flag;
 
-			std::stringstream buffer(line);
-			std::string flag;
-
-			while (buffer >> flag)
-			{
-				if (flag == "sse")
-				{
-					instructions = ProcessorInstructions(instructions | PI_SSE);
-				}
-				else if (flag == "sse2")
-				{
-					instructions = ProcessorInstructions(instructions | PI_SSE_2);
-				}
-				else if (flag == "sse3")
-				{
-					instructions = ProcessorInstructions(instructions | PI_SSE_3);
-				}
-				else if (flag == "ssse3")
-				{
-					instructions = ProcessorInstructions(instructions | PI_SSSE_3);
-				}
-				else if (flag == "sse4_1")
-				{
-					instructions = ProcessorInstructions(instructions | PI_SSE_4_1);
-				}
-				else if (flag == "sse4_2")
-				{
-					instructions = ProcessorInstructions(instructions | PI_SSE_4_2);
-				}
-				else if (flag == "avx")
+				while (buffer >> flag)
 				{
-					instructions = ProcessorInstructions(instructions | PI_AVX);
+					if (flag == "sse")
+					{
+						instructions = ProcessorInstructions(instructions | PI_SSE);
+					}
+					else if (flag == "sse2")
+					{
+						instructions = ProcessorInstructions(instructions | PI_SSE_2);
+					}
+					else if (flag == "sse3")
+					{
+						instructions = ProcessorInstructions(instructions | PI_SSE_3);
+					}
+					else if (flag == "ssse3")
+					{
+						instructions = ProcessorInstructions(instructions | PI_SSSE_3);
+					}
+					else if (flag == "sse4_1")
+					{
+						instructions = ProcessorInstructions(instructions | PI_SSE_4_1);
+					}
+					else if (flag == "sse4_2")
+					{
+						instructions = ProcessorInstructions(instructions | PI_SSE_4_2);
+					}
+					else if (flag == "avx")
+					{
+						instructions = ProcessorInstructions(instructions | PI_AVX);
+					}
+					else if (flag == "avx2")
+					{
+						instructions = ProcessorInstructions(instructions | PI_AVX_2);
+					}
+					else if (flag == "avx512f")
+					{
+						hasAVX512F = true;
+					}
+					else if (flag == "avx512bw")
+					{
+						hasAVX512BW = true;
+					}
+					else if (flag == "aes")
+					{
+						instructions = ProcessorInstructions(instructions | PI_AES);
+					}
 				}
-				else if (flag == "avx2")
-				{
-					instructions = ProcessorInstructions(instructions | PI_AVX_2);
-				}
-				else if (flag == "aes")
+			}
+			else if (line.compare(0, featuresKey.length(), featuresKey) == 0)
+			{
+				// ARM processors list their features in a separate line
+
+				std::stringstream buffer(line);
+				std::string feature;
+
+				while (buffer >> feature)
 				{
-					instructions = ProcessorInstructions(instructions | PI_AES);
+					if (feature == "asimd" || feature == "neon")
+					{
+						instructions = ProcessorInstructions(instructions | PI_NEON);
+					}
+					else if (feature == "sve")
+					{
+						instructions = ProcessorInstructions(instructions | PI_SVE);
+					}
+					else if (feature == "aes")
+					{
+						instructions = ProcessorInstructions(instructions | PI_AES);
+					}
 				}
 			}
 		}
+
+		if (hasAVX512F && hasAVX512BW)
+		{
+			// the 8 bit and 16 bit integer instructions are needed for image processing
+			instructions = ProcessorInstructions(instructions | PI_AVX_512);
+		}
 	}
 
 #elif defined(OCEAN_PLATFORM_BUILD_ANDROID)
@@ -506,6 +545,11 @@ ProcessorInstructions Processor::realInstructions()
 			const std::string line(buffer.data());
 
 #ifdef __aarch64__
+			if (line.find("Features") == 0 && line.find(" sve") != std::string::npos)
+			{
+				instructions = ProcessorInstructions(instructions | PI_SVE);
+			}
+
 			if (line.find("Features") == 0 && line.find("asimd") != std::string::npos)
 #else
 			if (line.find("Features") == 0 && line.find("neon") != std::string::npos)
@@ -604,6 +648,11 @@ std::string Processor::translateInstructions(const ProcessorInstructions instruc
 		}
 	}
 
+	if (instructions & PI_SVE)
+	{
+		result += "SVE, ";
+	}
+
 	if (instructions & PI_AES)
 	{
 		result += "AES, ";
@@ -54,6 +54,9 @@ enum ProcessorInstructions : uint32_t
 	/// AES instructions.
 	PI_AES = 1 << 10u,
 
+	/// SVE instructions.
+	PI_SVE = 1u << 11u,
+
 	/// All SSE instructions between (including) SSE and SSE2.
 	PI_GROUP_SSE_2 = PI_SSE | PI_SSE_2,
 	/// All SSE instructions between (including) SSE and SSE4.1.
@@ -0,0 +1,472 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "ocean/base/RandomXoshiro.h"
+
+#if defined(OCEAN_HARDWARE_SSE_VERSION) && OCEAN_HARDWARE_SSE_VERSION >= 20
+	#include <emmintrin.h>
+#elif defined(OCEAN_HARDWARE_NEON_VERSION) && OCEAN_HARDWARE_NEON_VERSION >= 10
+	#if defined(__ARM_NEON__) || defined(__ARM_NEON)
+		#include <arm_neon.h>
+	#endif // __ARM_NEON__
+#endif // OCEAN_HARDWARE_SSE_VERSION, OCEAN_HARDWARE_NEON_VERSION
+
+namespace Ocean
+{
+
+namespace
+{
+
+/**
+ * Returns the next value of a SplitMix64 generator which is used to expand a seed value to the states of the engines.
+ * @param state The state of the SplitMix64 generator, will be advanced
+ * @return The next value
+ */
+inline uint64_t splitMix64(uint64_t& state)
+{
+	state += 0x9E3779B97F4A7C15ull;
+
+	uint64_t value = state;
+	value = (value ^ (value >> 30u)) * 0xBF58476D1CE4E5B9ull;
+	value = (value ^ (value >> 27u)) * 0x94D049BB133111EBull;
+
+	return value ^ (value >> 31u);
+}
+
+#if defined(OCEAN_HARDWARE_SSE_VERSION) && OCEAN_HARDWARE_SSE_VERSION >= 20
+
+/**
+ * Rotates the four 32 bit values of a register to the left.
+ * @param value The values to rotate
+ * @return The rotated values
+ * @tparam tBits The number of bits to rotate, with range [1, 31]
+ */
+template <int tBits>
+inline __m128i rotateLeft(const __m128i& value)
+{
+	static_assert(tBits >= 1 && tBits <= 31, "Invalid bits!");
+
+	return _mm_or_si128(_mm_slli_epi32(value, tBits), _mm_srli_epi32(value, 32 - tBits));
+}
+
+/**
+ * Advances four xoshiro128++ engines several times.
+ * @param states The states of the engines, stored word by word, must be valid
+ * @param blocks The number of times the engines are advanced, with range [1, infinity)
+ * @param function The function receiving the four random numbers of each block, with signature 'void(const __m128i& values, const size_t block)'
+ * @tparam TFunction The data type of the function
+ */
+template <typename TFunction>
+inline void advanceEngines(uint32_t* states, const size_t blocks, const TFunction& function)
+{
+	ocean_assert(states != nullptr);
+
+	__m128i state0_u_32x4 = _mm_load_si128((const __m128i*)(states + 0));
+	__m128i state1_u_32x4 = _mm_load_si128((const __m128i*)(states + 4));
+	__m128i state2_u_32x4 = _mm_load_si128((const __m128i*)(states + 8));
+	__m128i state3_u_32x4 = _mm_load_si128((const __m128i*)(states + 12));
+
+	for (size_t n = 0; n < blocks; ++n)
+	{
+		const __m128i result_u_32x4 = _mm_add_epi32(rotateLeft<7>(_mm_add_epi32(state0_u_32x4, state3_u_32x4)), state0_u_32x4);
+
+		const __m128i shifted_u_32x4 = _mm_slli_epi32(state1_u_32x4, 9);
+
+		state2_u_32x4 = _mm_xor_si128(state2_u_32x4, state0_u_32x4);
+		state3_u_32x4 = _mm_xor_si128(state3_u_32x4, state1_u_32x4);
+		state1_u_32x4 = _mm_xor_si128(state1_u_32x4, state2_u_32x4);
+		state0_u_32x4 = _mm_xor_si128(state0_u_32x4, state3_u_32x4);
+		state2_u_32x4 = _mm_xor_si128(state2_u_32x4, shifted_u_32x4);
+		state3_u_32x4 = rotateLeft<11>(state3_u_32x4);
+
+		function(result_u_32x4, n);
+	}
+
+	_mm_store_si128((__m128i*)(states + 0), state0_u_32x4);
+	_mm_store_si128((__m128i*)(states + 4), state1_u_32x4);
+	_mm_store_si128((__m128i*)(states + 8), state2_u_32x4);
+	_mm_store_si128((__m128i*)(states + 12), state3_u_32x4);
+}
+
+#elif defined(OCEAN_HARDWARE_NEON_VERSION) && OCEAN_HARDWARE_NEON_VERSION >= 10
+
+/**
+ * Rotates the four 32 bit values of a register to the left.
+ * @param value The values to rotate
+ * @return The rotated values
+ * @tparam tBits The number of bits to rotate, with range [1, 31]
+ */
+template <int tBits>
+inline uint32x4_t rotateLeft(const uint32x4_t& value)
+{
+	static_assert(tBits >= 1 && tBits <= 31, "Invalid bits!");
+
+	return vsriq_n_u32(vshlq_n_u32(value, tBits), value, 32 - tBits);
+}
+
+/**
+ * Advances four xoshiro128++ engines several times.
+ * @param states The states of the engines, stored word by word, must be valid
+ * @param blocks The number of times the engines are advanced, with range [1, infinity)
+ * @param function The function receiving the four random numbers of each block, with signature 'void(const uint32x4_t& values, const size_t block)'
+ * @tparam TFunction The data type of the function
+ */
+template <typename TFunction>
+inline void advanceEngines(uint32_t* states, const size_t blocks, const TFunction& function)
+{
+	ocean_assert(states != nullptr);
+
+	uint32x4_t state0_u_32x4 = vld1q_u32(states + 0);
+	uint32x4_t state1_u_32x4 = vld1q_u32(states + 4);
+	uint32x4_t state2_u_32x4 = vld1q_u32(states + 8);
+	uint32x4_t state3_u_32x4 = vld1q_u32(states + 12);
+
+	for (size_t n = 0; n < blocks; ++n)
+	{
+		const uint32x4_t result_u_32x4 = vaddq_u32(rotateLeft<7>(vaddq_u32(state0_u_32x4, state3_u_32x4)), state0_u_32x4);
+
+		const uint32x4_t shifted_u_32x4 = vshlq_n_u32(state1_u_32x4, 9);
+
+		state2_u_32x4 = veorq_u32(state2_u_32x4, state0_u_32x4);
+		state3_u_32x4 = veorq_u32(state3_u_32x4, state1_u_32x4);
+		state1_u_32x4 = veorq_u32(state1_u_32x4, state2_u_32x4);
+		state0_u_32x4 = veorq_u32(state0_u_32x4, state3_u_32x4);
+		state2_u_32x4 = veorq_u32(state2_u_32x4, shifted_u_32x4);
+		state3_u_32x4 = rotateLeft<11>(state3_u_32x4);
+
+		function(result_u_32x4, n);
+	}
+
+	vst1q_u32(states + 0, state0_u_32x4);
+	vst1q_u32(states + 4, state1_u_32x4);
+	vst1q_u32(states + 8, state2_u_32x4);
+	vst1q_u32(states + 12, state3_u_32x4);
+}
+
+#else
+
+/**
+ * Rotates a 32 bit value to the left.
+ * @param value The value to rotate
+ * @return The rotated value
+ * @tparam tBits The number of bits to rotate, with range [1, 31]
+ */
+template <unsigned int tBits>
+inline uint32_t rotateLeft(const uint32_t value)
+{
+	static_assert(tBits >= 1u && tBits <= 31u, "Invalid bits!");
+
+	return (value << tBits) | (value >> (32u - tBits));
+}
+
+/**
+ * Advances four xoshiro128++ engines several times.
+ * @param states The states of the engines, stored word by word, must be valid
+ * @param blocks The number of times the engines are advanced, with range [1, infinity)
+ * @param function The function receiving the four random numbers of each block, with signature 'void(const uint32_t* values, const size_t block)'
+ * @tparam TFunction The data type of the function
+ */
+template <typename TFunction>
+inline void advanceEngines(uint32_t* states, const size_t blocks, const TFunction& function)
+{
+	ocean_assert(states != nullptr);
+
+	uint32_t results[4];
+
+	for (size_t n = 0; n < blocks; ++n)
+	{
+		for (unsigned int lane = 0u; lane < 4u; ++lane)
+		{
+			uint32_t& state0 = states[lane + 0u];
+			uint32_t& state1 = states[lane + 4u];
+			uint32_t& state2 = states[lane + 8u];
+			uint32_t& state3 = states[lane + 12u];
+
+			results[lane] = rotateLeft<7u>(state0 + state3) + state0;
+
+			const uint32_t shifted = state1 << 9u;
+
+			state2 ^= state0;
+			state3 ^= state1;
+			state1 ^= state2;
+			state0 ^= state3;
+			state2 ^= shifted;
+			state3 = rotateLeft<11u>(state3);
+		}
+
+		function(results, n);
+	}
+}
+
+#endif // OCEAN_HARDWARE_SSE_VERSION, OCEAN_HARDWARE_NEON_VERSION
+
+}
+
+RandomXoshiro::RandomXoshiro(const uint64_t seed, const uint64_t stream)
+{
+	static_assert(lanes_ == 4u, "The engines are advanced with 4x32 bit registers");
+
+	uint64_t seedState = seed;
+	uint64_t streamState = stream;
+
+	uint64_t state = splitMix64(seedState) ^ splitMix64(streamState);
+
+	for (unsigned int lane = 0u; lane < lanes_; ++lane)
+	{
+		for (unsigned int word = 0u; word < 4u; word += 2u)
+		{
+			const uint64_t value = splitMix64(state);
+
+			states_[word + 0u][lane] = uint32_t(value & 0xFFFFFFFFull);
+			states_[word + 1u][lane] = uint32_t(value >> 32ull);
+		}
+
+		if (states_[0][lane] == 0u && states_[1][lane] == 0u && states_[2][lane] == 0u && states_[3][lane] == 0u)
+		{
+			// an engine must not have an empty state
+			states_[0][lane] = 1u;
+		}
+	}
+
+	for (unsigned int n = 0u; n < lanes_; ++n)
+	{
+		buffer_[n] = 0u;
+	}
+}
+
+RandomXoshiro::RandomXoshiro(RandomGenerator& generator) :
+	RandomXoshiro(seedValue(generator))
+{
+	// nothing to do here
+}
+
+void RandomXoshiro::fill(uint32_t* values, const size_t size)
+{
+	ocean_assert(values != nullptr || size == 0);
+
+	size_t n = 0;
+
+	while (n < size && bufferPosition_ < lanes_)
+	{
+		values[n++] = buffer_[bufferPosition_++];
+	}
+
+	const size_t blocks = (size - n) / size_t(lanes_);
+
+	if (blocks != 0)
+	{
+		fillBlocks(values + n, blocks);
+		n += blocks * size_t(lanes_);
+	}
+
+	while (n < size)
+	{
+		values[n++] = rand();
+	}
+}
+
+void RandomXoshiro::fillIndices(Index32* indices, const size_t size, const uint32_t maxValue)
+{
+	ocean_assert(indices != nullptr || size == 0);
+
+	const uint64_t range = uint64_t(maxValue) + 1ull;
+
+	if (range > uint64_t(0xFFFFFFFFu))
+	{
+		// all random numbers are valid indices
+		fill(indices, size);
+		return;
+	}
+
+	size_t n = 0;
+
+	while (n < size && bufferPosition_ < lanes_)
+	{
+		indices[n++] = mapIndex(buffer_[bufferPosition_++], range);
+	}
+
+	const size_t blocks = (size - n) / size_t(lanes_);
+
+	if (blocks != 0)
+	{
+		fillIndexBlocks(indices + n, blocks, uint32_t(range));
+		n += blocks * size_t(lanes_);
+	}
+
+	while (n < size)
+	{
+		indices[n++] = mapIndex(rand(), range);
+	}
+}
+
+void RandomXoshiro::fillFloats(float* values, const size_t size, const float lower, const float upper)
+{
+	ocean_assert(values != nullptr || size == 0);
+	ocean_assert(lower < upper);
+
+	const float delta = upper - lower;
+
+	size_t n = 0;
+
+	while (n < size && bufferPosition_ < lanes_)
+	{
+		values[n++] = lower + mapFloat(buffer_[bufferPosition_++]) * delta;
+	}
+
+	const size_t blocks = (size - n) / size_t(lanes_);
+
+	if (blocks != 0)
+	{
+		fillFloatBlocks(values + n, blocks, lower, delta);
+		n += blocks * size_t(lanes_);
+	}
+
+	while (n < size)
+	{
+		values[n++] = lower + mapFloat(rand()) * delta;
+	}
+}
+
+void RandomXoshiro::refillBuffer()
+{
+	ocean_assert(bufferPosition_ == lanes_);
+
+	fillBlocks(buffer_, 1);
+
+	bufferPosition_ = 0u;
+}
+
+void RandomXoshiro::fillBlocks(uint32_t* values, const size_t blocks)
+{
+	ocean_assert(values != nullptr && blocks >= 1);
+
+#if defined(OCEAN_HARDWARE_SSE_VERSION) && OCEAN_HARDWARE_SSE_VERSION >= 20
+
+	advanceEngines(states_[0], blocks, [values](const __m128i& values_u_32x4, const size_t block)
+	{
+		_mm_storeu_si128((__m128i*)(values + block * 4), values_u_32x4);
+	});
+
+#elif defined(OCEAN_HARDWARE_NEON_VERSION) && OCEAN_HARDWARE_NEON_VERSION >= 10
+
+	advanceEngines(states_[0], blocks, [values](const uint32x4_t& values_u_32x4, const size_t block)
+	{
+		vst1q_u32(values + block * 4, values_u_32x4);
+	});
+
+#else
+
+	advanceEngines(states_[0], blocks, [values](const uint32_t* blockValues, const size_t block)
+	{
+		for (unsigned int n = 0u; n < 4u; ++n)
+		{
+			values[block * 4 + n] = blockValues[n];
+		}
+	});
+
+#endif // OCEAN_HARDWARE_SSE_VERSION, OCEAN_HARDWARE_NEON_VERSION
+}
+
+void RandomXoshiro::fillIndexBlocks(Index32* indices, const size_t blocks, const uint32_t range)
+{
+	ocean_assert(indices != nullptr && blocks >= 1);
+	ocean_assert(range >= 1u);
+
+#if defined(OCEAN_HARDWARE_SSE_VERSION) && OCEAN_HARDWARE_SSE_VERSION >= 20
+
+	const __m128i range_u_32x4 = _mm_set1_epi32(int(range));
+	const __m128i maskOdd_u_32x4 = _mm_set_epi32(-1, 0, -1, 0);
+
+	advanceEngines(states_[0], blocks, [indices, &range_u_32x4, &maskOdd_u_32x4](const __m128i& values_u_32x4, const size_t block)
+	{
+		// (value * range) >> 32, the even lanes hold the upper 32 bits in the lower half of the 64 bit products, the odd lanes in the upper half
+
+		const __m128i even_u_32x4 = _mm_srli_epi64(_mm_mul_epu32(values_u_32x4, range_u_32x4), 32);
+		const __m128i odd_u_32x4 = _mm_mul_epu32(_mm_srli_epi64(values_u_32x4, 32), range_u_32x4);
+
+		_mm_storeu_si128((__m128i*)(indices + block * 4), _mm_or_si128(even_u_32x4, _mm_and_si128(odd_u_32x4, maskOdd_u_32x4)));
+	});
+
+#elif defined(OCEAN_HARDWARE_NEON_VERSION) && OCEAN_HARDWARE_NEON_VERSION >= 10
+
+	const uint32x2_t range_u_32x2 = vdup_n_u32(range);
+
+	advanceEngines(states_[0], blocks, [indices, &range_u_32x2](const uint32x4_t& values_u_32x4, const size_t block)
+	{
+		// (value * range) >> 32
+
+		const uint64x2_t productsLow_u_64x2 = vmull_u32(vget_low_u32(values_u_32x4), range_u_32x2);
+		const uint64x2_t productsHigh_u_64x2 = vmull_u32(vget_high_u32(values_u_32x4), range_u_32x2);
+
+		vst1q_u32(indices + block * 4, vcombine_u32(vshrn_n_u64(productsLow_u_64x2, 32), vshrn_n_u64(productsHigh_u_64x2, 32)));
+	});
+
+#else
+
+	advanceEngines(states_[0], blocks, [indices, range](const uint32_t* blockValues, const size_t block)
+	{
+		for (unsigned int n = 0u; n < 4u; ++n)
+		{
+			indices[block * 4 + n] = mapIndex(blockValues[n], uint64_t(range));
+		}
+	});
+
+#endif // OCEAN_HARDWARE_SSE_VERSION, OCEAN_HARDWARE_NEON_VERSION
+}
+
+void RandomXoshiro::fillFloatBlocks(float* values, const size_t blocks, const float lower, const float delta)
+{
+	ocean_assert(values != nullptr && blocks >= 1);
+
+#if defined(OCEAN_HARDWARE_SSE_VERSION) && OCEAN_HARDWARE_SSE_VERSION >= 20
+
+	const __m128 lower_f_32x4 = _mm_set1_ps(lower);
+	const __m128 factor_f_32x4 = _mm_set1_ps(delta * (1.0f / 16777216.0f));
+
+	advanceEngines(states_[0], blocks, [values, &lower_f_32x4, &factor_f_32x4](const __m128i& values_u_32x4, const size_t block)
+	{
+		// the upper 24 bits can be converted to float without rounding
+		const __m128 floats_f_32x4 = _mm_cvtepi32_ps(_mm_srli_epi32(values_u_32x4, 8));
+
+		_mm_storeu_ps(values + block * 4, _mm_add_ps(lower_f_32x4, _mm_mul_ps(floats_f_32x4, factor_f_32x4)));
+	});
+
+#elif defined(OCEAN_HARDWARE_NEON_VERSION) && OCEAN_HARDWARE_NEON_VERSION >= 10
+
+	const float32x4_t lower_f_32x4 = vdupq_n_f32(lower);
+	const float factor = delta * (1.0f / 16777216.0f);
+
+	advanceEngines(states_[0], blocks, [values, &lower_f_32x4, factor](const uint32x4_t& values_u_32x4, const size_t block)
+	{
+		// the upper 24 bits can be converted to float without rounding
+		const float32x4_t floats_f_32x4 = vcvtq_f32_u32(vshrq_n_u32(values_u_32x4, 8));
+
+		vst1q_f32(values + block * 4, vaddq_f32(lower_f_32x4, vmulq_n_f32(floats_f_32x4, factor)));
+	});
+
+#else
+
+	advanceEngines(states_[0], blocks, [values, lower, delta](const uint32_t* blockValues, const size_t block)
+	{
+		for (unsigned int n = 0u; n < 4u; ++n)
+		{
+			values[block * 4 + n] = lower + mapFloat(blockValues[n]) * delta;
+		}
+	});
+
+#endif // OCEAN_HARDWARE_SSE_VERSION, OCEAN_HARDWARE_NEON_VERSION
+}
+
+uint64_t RandomXoshiro::seedValue(RandomGenerator& generator)
+{
+	const uint64_t high = uint64_t(generator.lockedRand());
+	const uint64_t low = uint64_t(generator.lockedRand());
+
+	return (high << 32ull) | low;
+}
+
+}
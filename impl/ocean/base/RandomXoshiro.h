@@ -0,0 +1,224 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#ifndef META_OCEAN_BASE_RANDOM_XOSHIRO_H
+#define META_OCEAN_BASE_RANDOM_XOSHIRO_H
+
+#include "ocean/base/Base.h"
+#include "ocean/base/RandomGenerator.h"
+
+namespace Ocean
+{
+
+/**
+ * This class implements a fast random number generator based on four interleaved xoshiro128++ engines.
+ * In contrast to RandomGenerator, the generator provides bulk functions filling entire buffers with random numbers, random indices, or random floats.<br>
+ * The four engines are advanced at once with SSE or NEON instructions, the resulting random numbers and indices are identical on all platforms.<br>
+ * The sequence of random numbers is determined by the seed only, it does not depend on whether the numbers are created one by one or in bulk.
+ *
+ * The generator is not thread-safe, each thread should use an own generator.<br>
+ * Generators of individual threads can be created from a shared RandomGenerator (as known from RandomGenerator), or from a seed and a stream index (e.g., the index of the thread or of the subset), similar to the seed scheme of Worker:
+ * @code
+ * void multiCoreFunction(const uint64_t seed, Index32* data, unsigned int firstObject, unsigned int numberObjects)
+ * {
+ *     // the result does not depend on the number of threads, as each subset has a own stream
+ *     RandomXoshiro localGenerator(seed, firstObject);
+ *
+ *     localGenerator.fillIndices(data + firstObject, numberObjects, 99u);
+ * }
+ * @endcode
+ * @see RandomGenerator, RandomI.
+ * @ingroup base
+ */
+class OCEAN_BASE_EXPORT RandomXoshiro
+{
+	public:
+
+		/**
+		 * The number of engines which are advanced at once.
+		 */
+		static constexpr unsigned int lanes_ = 4u;
+
+	public:
+
+		/**
+		 * Creates a new generator for a seed value and a stream.
+		 * Generators with the same seed but different streams create independent sequences of random numbers.
+		 * @param seed The seed value, with range [0, infinity)
+		 * @param stream The index of the stream, e.g., the index of a thread, with range [0, infinity)
+		 */
+		explicit RandomXoshiro(const uint64_t seed, const uint64_t stream = 0ull);
+
+		/**
+		 * Creates a new generator and initializes the seed with random values provided by the locked random function of the given generator.
+		 * @param generator The random number generator used for initialization, the generator's seed will be changed during the initialization
+		 */
+		explicit RandomXoshiro(RandomGenerator& generator);
+
+		/**
+		 * Returns the next random number.
+		 * @return Random number with range [0, 2^32-1]
+		 */
+		inline uint32_t rand();
+
+		/**
+		 * Returns a random number within the range [0, maxValue].
+		 * @param maxValue The maximal random number, with range [0, infinity)
+		 * @return The random number
+		 */
+		inline uint32_t random(const uint32_t maxValue);
+
+		/**
+		 * Returns a random number within the range [lower, upper].
+		 * @param lower The lower border, with range [0, infinity)
+		 * @param upper The upper border, with range [lower, infinity)
+		 * @return The random number
+		 */
+		inline uint32_t random(const uint32_t lower, const uint32_t upper);
+
+		/**
+		 * Returns a random float within the range [0, 1).
+		 * @return The random float
+		 */
+		inline float randomFloat();
+
+		/**
+		 * Fills a buffer with random numbers.
+		 * @param values The buffer receiving the random numbers, with range [0, 2^32-1], must be valid if 'size > 0'
+		 * @param size The number of random numbers, with range [0, infinity)
+		 */
+		void fill(uint32_t* values, const size_t size);
+
+		/**
+		 * Fills a buffer with random indices within the range [0, maxValue].
+		 * The random numbers are mapped to the range with a multiplication instead of a division.
+		 * @param indices The buffer receiving the random indices, must be valid if 'size > 0'
+		 * @param size The number of random indices, with range [0, infinity)
+		 * @param maxValue The maximal index, with range [0, infinity)
+		 */
+		void fillIndices(Index32* indices, const size_t size, const uint32_t maxValue);
+
+		/**
+		 * Fills a buffer with random floats within the range [lower, upper].
+		 * The random floats have a resolution of 24 bits, the upper border is reached due to rounding only.
+		 * @param values The buffer receiving the random floats, must be valid if 'size > 0'
+		 * @param size The number of random floats, with range [0, infinity)
+		 * @param lower The lower border
+		 * @param upper The upper border, with range (lower, infinity)
+		 */
+		void fillFloats(float* values, const size_t size, const float lower = 0.0f, const float upper = 1.0f);
+
+	protected:
+
+		/**
+		 * Advances all engines and stores the next random numbers in the buffer.
+		 */
+		void refillBuffer();
+
+		/**
+		 * Advances all engines several times and writes the resulting random numbers to a buffer.
+		 * @param values The buffer receiving the random numbers, must be valid
+		 * @param blocks The number of times the engines are advanced, 'lanes_' random numbers each time, with range [1, infinity)
+		 */
+		void fillBlocks(uint32_t* values, const size_t blocks);
+
+		/**
+		 * Advances all engines several times and writes the resulting random indices to a buffer.
+		 * @param indices The buffer receiving the random indices, must be valid
+		 * @param blocks The number of times the engines are advanced, 'lanes_' random indices each time, with range [1, infinity)
+		 * @param range The number of possible indices, with range [1, 2^32-1]
+		 */
+		void fillIndexBlocks(Index32* indices, const size_t blocks, const uint32_t range);
+
+		/**
+		 * Advances all engines several times and writes the resulting random floats to a buffer.
+		 * @param values The buffer receiving the random floats, must be valid
+		 * @param blocks The number of times the engines are advanced, 'lanes_' random floats each time, with range [1, infinity)
+		 * @param lower The lower border
+		 * @param delta The size of the range, with range (0, infinity)
+		 */
+		void fillFloatBlocks(float* values, const size_t blocks, const float lower, const float delta);
+
+		/**
+		 * Returns a seed value based on two random numbers of a random generator.
+		 * @param generator The random number generator providing the random numbers
+		 * @return The seed value
+		 */
+		static uint64_t seedValue(RandomGenerator& generator);
+
+		/**
+		 * Maps a random number to a random index.
+		 * @param value The random number to map, with range [0, 2^32-1]
+		 * @param range The number of possible indices, with range [1, 2^32]
+		 * @return The random index, with range [0, range - 1]
+		 */
+		static inline uint32_t mapIndex(const uint32_t value, const uint64_t range);
+
+		/**
+		 * Maps a random number to a random float within the range [0, 1).
+		 * @param value The random number to map, with range [0, 2^32-1]
+		 * @return The random float
+		 */
+		static inline float mapFloat(const uint32_t value);
+
+	protected:
+
+		/// The states of the engines, four words for each engine, stored word by word so that all engines can be advanced at once.
+		alignas(16) uint32_t states_[4][lanes_];
+
+		/// The buffer with random numbers which have been created but not yet returned.
+		alignas(16) uint32_t buffer_[lanes_];
+
+		/// The position of the next random number in the buffer, 'lanes_' if the buffer is empty.
+		unsigned int bufferPosition_ = lanes_;
+};
+
+inline uint32_t RandomXoshiro::rand()
+{
+	if (bufferPosition_ == lanes_)
+	{
+		refillBuffer();
+	}
+
+	ocean_assert(bufferPosition_ < lanes_);
+
+	return buffer_[bufferPosition_++];
+}
+
+inline uint32_t RandomXoshiro::random(const uint32_t maxValue)
+{
+	return mapIndex(rand(), uint64_t(maxValue) + 1ull);
+}
+
+inline uint32_t RandomXoshiro::random(const uint32_t lower, const uint32_t upper)
+{
+	ocean_assert(lower <= upper);
+
+	return lower + random(upper - lower);
+}
+
+inline float RandomXoshiro::randomFloat()
+{
+	return mapFloat(rand());
+}
+
+inline uint32_t RandomXoshiro::mapIndex(const uint32_t value, const uint64_t range)
+{
+	ocean_assert(range >= 1ull && range <= (1ull << 32ull));
+
+	return uint32_t((uint64_t(value) * range) >> 32ull);
+}
+
+inline float RandomXoshiro::mapFloat(const uint32_t value)
+{
+	// the upper 24 bits can be represented exactly
+	return float(value >> 8u) * (1.0f / 16777216.0f);
+}
+
+}
+
+#endif // META_OCEAN_BASE_RANDOM_XOSHIRO_H
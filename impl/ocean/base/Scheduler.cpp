@@ -7,6 +7,9 @@
 
 #include "ocean/base/Scheduler.h"
 
+#include <algorithm>
+#include <cmath>
+
 namespace Ocean
 {
 
@@ -19,6 +22,10 @@ Scheduler::Scheduler() :
 Scheduler::~Scheduler()
 {
 	ocean_assert(callbacks.isEmpty());
+	ocean_assert(timerMap_.empty());
+
+	stopThread();
+	wakeUpSignal_.pulse();
 
 	stopThreadExplicitly();
 }
@@ -29,10 +36,11 @@ void Scheduler::registerFunction(const Callback& callback)
 
 	callbacks.addCallback(callback);
 
-	if (!isThreadInvokedToStart())
-	{
-		startThread();
-	}
+	startThreadIfNecessary();
+
+	// the thread may sleep until the next timer is due, so we need to ensure that the thread starts polling
+
+	wakeUpSignal_.pulse();
 }
 
 void Scheduler::unregisterFunction(const Callback& callback)
@@ -42,12 +50,194 @@ void Scheduler::unregisterFunction(const Callback& callback)
 	callbacks.removeCallback(callback);
 }
 
+Scheduler::TimerId Scheduler::registerTimer(const Callback& callback, const double interval, const double delay)
+{
+	ocean_assert(callback);
+	ocean_assert(interval == 0.0 || interval >= 0.001);
+	ocean_assert(delay >= 0.0 || delay == -1.0);
+
+	if (!callback || interval < 0.0 || (interval == 0.0 && delay < 0.0))
+	{
+		return invalidTimerId();
+	}
+
+	const TimerWheel::Tick intervalTicks = interval == 0.0 ? 0ull : std::max(TimerWheel::Tick(1), TimerWheel::Tick(std::round(interval * 1000.0)));
+	const TimerWheel::Tick delayTicks = delay >= 0.0 ? TimerWheel::Tick(std::round(delay * 1000.0)) : intervalTicks;
+
+	TimerId timerId = invalidTimerId();
+
+	{
+		const ScopedLock scopedLock(timerLock_);
+
+		do
+		{
+			timerId = timerIdCounter_++;
+		}
+		while (timerId == invalidTimerId() || timerMap_.find(timerId) != timerMap_.cend());
+
+		const TimerWheel::Tick dueTick = currentTick() + delayTicks;
+
+		timerMap_.emplace(timerId, Timer(callback, intervalTicks, dueTick));
+		timerWheel_.insert(timerId, dueTick);
+	}
+
+	startThreadIfNecessary();
+
+	// the thread may sleep until a later timer is due
+
+	wakeUpSignal_.pulse();
+
+	return timerId;
+}
+
+bool Scheduler::unregisterTimer(const TimerId timerId)
+{
+	// the lock is held while timers are invoked, so that the timer is not invoked anymore once the lock is acquired
+
+	const ScopedLock scopedLock(timerLock_);
+
+	if (timerMap_.erase(timerId) == 0)
+	{
+		return false;
+	}
+
+	timerWheel_.remove(timerId);
+
+	return true;
+}
+
+bool Scheduler::wakeUpTimer(const TimerId timerId)
+{
+	{
+		const ScopedLock scopedLock(timerLock_);
+
+		const TimerMap::iterator iTimer = timerMap_.find(timerId);
+
+		if (iTimer == timerMap_.end())
+		{
+			return false;
+		}
+
+		iTimer->second.dueTick_ = currentTick();
+		timerWheel_.insert(timerId, iTimer->second.dueTick_);
+	}
+
+	wakeUpSignal_.pulse();
+
+	return true;
+}
+
 void Scheduler::threadRun()
 {
 	while (!shouldThreadStop())
 	{
-		callbacks();
-		sleep(1);
+		if (!callbacks.isEmpty())
+		{
+			callbacks();
+		}
+
+		unsigned int sleepTime = invokeTimers();
+
+		if (!callbacks.isEmpty())
+		{
+			// the round robin functions are polled with the same frequency as before timers have been supported
+
+			sleepTime = std::min(sleepTime, 1u);
+		}
+
+		if (sleepTime != 0u)
+		{
+			wakeUpSignal_.wait(sleepTime);
+		}
+	}
+}
+
+unsigned int Scheduler::invokeTimers()
+{
+	const ScopedLock scopedLock(timerLock_);
+
+	if (timerWheel_.isEmpty())
+	{
+		return maximalSleepTime_;
+	}
+
+	const TimerWheel::Tick tick = currentTick();
+
+	ocean_assert(dueTimerIds_.empty());
+	timerWheel_.advance(tick, dueTimerIds_);
+
+	for (const TimerId timerId : dueTimerIds_)
+	{
+		TimerMap::iterator iTimer = timerMap_.find(timerId);
+
+		if (iTimer == timerMap_.end())
+		{
+			// the timer has been unregistered by a previous timer
+			continue;
+		}
+
+		// the callback may register or unregister timers, so that we must not use the iterator afterwards
+
+		const Callback callback(iTimer->second.callback_);
+		callback();
+
+		iTimer = timerMap_.find(timerId);
+
+		if (iTimer == timerMap_.end() || timerWheel_.contains(timerId))
+		{
+			// the timer has been unregistered or woken up by the callback
+			continue;
+		}
+
+		Timer& timer = iTimer->second;
+
+		if (timer.intervalTicks_ == 0ull)
+		{
+			timerMap_.erase(iTimer);
+			continue;
+		}
+
+		// the next deadline is based on the previous deadline, missed deadlines are skipped
+
+		TimerWheel::Tick nextDueTick = timer.dueTick_ + timer.intervalTicks_;
+
+		if (nextDueTick <= tick)
+		{
+			nextDueTick += ((tick - nextDueTick) / timer.intervalTicks_ + 1ull) * timer.intervalTicks_;
+		}
+
+		ocean_assert(nextDueTick > tick);
+
+		timer.dueTick_ = nextDueTick;
+		timerWheel_.insert(timerId, nextDueTick);
+	}
+
+	dueTimerIds_.clear();
+
+	const TimerWheel::Tick nextDueTick = timerWheel_.nextDueTick();
+
+	if (nextDueTick == TimerWheel::invalidTick())
+	{
+		return maximalSleepTime_;
+	}
+
+	const TimerWheel::Tick nowTick = currentTick();
+
+	if (nextDueTick <= nowTick)
+	{
+		return 0u;
+	}
+
+	return (unsigned int)(std::min(nextDueTick - nowTick, TimerWheel::Tick(maximalSleepTime_)));
+}
+
+void Scheduler::startThreadIfNecessary()
+{
+	const ScopedLock scopedLock(threadLock_);
+
+	if (!isThreadInvokedToStart())
+	{
+		startThread();
 	}
 }
 
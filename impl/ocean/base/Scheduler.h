@@ -10,20 +10,27 @@
 
 #include "ocean/base/Base.h"
 #include "ocean/base/Callback.h"
+#include "ocean/base/HighPerformanceTimer.h"
+#include "ocean/base/Lock.h"
+#include "ocean/base/Signal.h"
 #include "ocean/base/Singleton.h"
 #include "ocean/base/Thread.h"
+#include "ocean/base/TimerWheel.h"
 
 #include <map>
+#include <unordered_map>
 
 namespace Ocean
 {
 
 /**
- * This class represents a round robin scheduler.
- * The scheduler is based on one single thread and executes all registered functions in a round robin manner.<br>
- * The registered functions are called with high frequency (e.g., each 10-50 ms).<br>
+ * This class represents a scheduler executing registered functions in one single thread.
+ * The scheduler supports two kinds of functions:<br>
+ * Timers are registered with an interval (or as one-shot timers) and are invoked once they are due, the timers are managed in a hierarchical timer wheel with a resolution of one millisecond.<br>
+ * Functions registered with registerFunction() are called in a round robin manner with high frequency (about each millisecond), as long as such a function is registered the scheduler thread is polling.<br>
+ * Without any registered round robin function, the scheduler thread sleeps until the next timer is due or until the scheduler is woken up explicitly.<br>
  * A registered function should return immediately so that a high call frequency for all registered function can be ensured.
- * @see ThreadPool, TaskQueue.
+ * @see TimerWheel, ThreadPool, TaskQueue.
  * @ingroup base
  */
 class OCEAN_BASE_EXPORT Scheduler :
@@ -39,6 +46,11 @@ class OCEAN_BASE_EXPORT Scheduler :
 		 */
 		using Callback = Ocean::Callback<void>;
 
+		/**
+		 * Definition of a timer id.
+		 */
+		using TimerId = TimerWheel::TimerId;
+
 	private:
 
 		/**
@@ -46,6 +58,41 @@ class OCEAN_BASE_EXPORT Scheduler :
 		 */
 		using Callbacks = ConcurrentCallbacks<Callback>;
 
+		/**
+		 * This class holds a registered timer.
+		 */
+		class Timer
+		{
+			public:
+
+				/**
+				 * Creates a new timer.
+				 * @param callback The callback function of the timer
+				 * @param intervalTicks The interval of the timer in ticks, 0 for a one-shot timer
+				 * @param dueTick The tick at which the timer is due
+				 */
+				inline Timer(const Callback& callback, const TimerWheel::Tick intervalTicks, const TimerWheel::Tick dueTick);
+
+			public:
+
+				/// The callback function of the timer.
+				Callback callback_;
+
+				/// The interval of the timer in ticks, 0 for a one-shot timer.
+				TimerWheel::Tick intervalTicks_ = 0ull;
+
+				/// The tick at which the timer is due.
+				TimerWheel::Tick dueTick_ = 0ull;
+		};
+
+		/**
+		 * Definition of an unordered map mapping timer ids to timers.
+		 */
+		using TimerMap = std::unordered_map<TimerId, Timer>;
+
+		/// The maximal time the scheduler thread sleeps without any due timer, in milliseconds.
+		static constexpr unsigned int maximalSleepTime_ = 1000u;
+
 	public:
 
 		/**
@@ -64,6 +111,41 @@ class OCEAN_BASE_EXPORT Scheduler :
 		 */
 		void unregisterFunction(const Callback& callback);
 
+		/**
+		 * Registers a timer which will be invoked periodically or once.
+		 * Periodic timers are invoked based on their deadlines, missed deadlines (e.g., due to a long running function) are skipped and not invoked several times.<br>
+		 * Each registered timer must be unregistered by the caller if the timer is not needed anymore, one-shot timers are unregistered automatically once they have been invoked.
+		 * @param callback The callback function of the timer, must be valid
+		 * @param interval The interval of the timer in seconds, with range [0.001, infinity), 0 to create a one-shot timer
+		 * @param delay The delay until the timer is invoked the first time, in seconds, with range [0, infinity), -1 to use the interval as delay
+		 * @return The id of the new timer, invalidTimerId() if the timer could not be registered
+		 * @see unregisterTimer(), wakeUpTimer().
+		 */
+		TimerId registerTimer(const Callback& callback, const double interval, const double delay = -1.0);
+
+		/**
+		 * Unregisters a timer.
+		 * This function may be called from a registered scheduler function, if called from any other thread the function returns once the timer is not invoked anymore.
+		 * @param timerId The id of the timer to unregister
+		 * @return True, if the timer existed
+		 * @see registerTimer().
+		 */
+		bool unregisterTimer(const TimerId timerId);
+
+		/**
+		 * Explicitly wakes up a timer so that the timer is invoked as soon as possible, the next invocations of a periodic timer are based on the new invocation.
+		 * @param timerId The id of the timer to wake up
+		 * @return True, if the timer exists
+		 * @see registerTimer().
+		 */
+		bool wakeUpTimer(const TimerId timerId);
+
+		/**
+		 * Returns an invalid timer id.
+		 * @return The invalid timer id
+		 */
+		static constexpr TimerId invalidTimerId();
+
 	protected:
 
 		/**
@@ -81,12 +163,71 @@ class OCEAN_BASE_EXPORT Scheduler :
 		 */
 		virtual void threadRun();
 
+		/**
+		 * Invokes all due timers and returns the time until the next timer is due.
+		 * @return The time until the next timer is due in milliseconds, with range [0, maximalSleepTime_]
+		 */
+		unsigned int invokeTimers();
+
+		/**
+		 * Returns the current tick of the scheduler.
+		 * @return The number of milliseconds since the scheduler has been created
+		 */
+		inline TimerWheel::Tick currentTick() const;
+
+		/**
+		 * Starts the scheduler thread, if not yet started.
+		 */
+		void startThreadIfNecessary();
+
 	protected:
 
 		/// Scheduler callbacks.
 		Callbacks callbacks;
+
+		/// The registered timers.
+		TimerMap timerMap_;
+
+		/// The wheel holding the due ticks of all registered timers.
+		TimerWheel timerWheel_;
+
+		/// The counter for unique timer ids.
+		TimerId timerIdCounter_ = 0u;
+
+		/// The ids of the timers which are due, used as intermediate object.
+		TimerWheel::TimerIds dueTimerIds_;
+
+		/// The timer providing the ticks of the scheduler.
+		HighPerformanceTimer timer_;
+
+		/// The signal waking up the scheduler thread.
+		Signal wakeUpSignal_;
+
+		/// The lock of the timers, locked while timers are invoked.
+		Lock timerLock_;
+
+		/// The lock for starting the thread.
+		Lock threadLock_;
 };
 
+inline Scheduler::Timer::Timer(const Callback& callback, const TimerWheel::Tick intervalTicks, const TimerWheel::Tick dueTick) :
+	callback_(callback),
+	intervalTicks_(intervalTicks),
+	dueTick_(dueTick)
+{
+	// nothing to do here
+}
+
+constexpr Scheduler::TimerId Scheduler::invalidTimerId()
+{
+	return TimerWheel::invalidTimerId();
+}
+
+inline TimerWheel::Tick Scheduler::currentTick() const
+{
+	return TimerWheel::Tick(timer_.mseconds());
+}
+
 }
 
 #endif // META_OCEAN_BASE_SCHEDULER_H
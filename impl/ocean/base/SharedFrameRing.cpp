@@ -0,0 +1,535 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "ocean/base/SharedFrameRing.h"
+#include "ocean/base/Messenger.h"
+#include "ocean/base/Thread.h"
+
+#include <climits>
+
+#if defined(__linux__)
+	#include <linux/futex.h>
+	#include <sys/syscall.h>
+	#include <unistd.h>
+	#include <ctime>
+#endif
+
+namespace Ocean
+{
+
+SharedFrameRing::SharedFrameRing(SharedFrameRing&& sharedFrameRing) noexcept
+{
+	*this = std::move(sharedFrameRing);
+}
+
+SharedFrameRing::SharedFrameRing(const std::wstring& name, const unsigned int numberSlots, const size_t slotCapacity)
+{
+	ocean_assert(!name.empty());
+	ocean_assert(numberSlots >= 2u && numberSlots <= maximalSlots_);
+	ocean_assert(slotCapacity != 0);
+
+	if (name.empty() || numberSlots < 2u || numberSlots > maximalSlots_ || slotCapacity == 0)
+	{
+		return;
+	}
+
+	const size_t alignedSlotCapacity = alignedSize(slotCapacity);
+	const size_t size = memorySize(numberSlots, alignedSlotCapacity);
+
+	sharedMemory_ = SharedMemory(name, size);
+
+	if (!sharedMemory_ || sharedMemory_.size() < size)
+	{
+		Log::error() << "Failed to create the shared frame ring";
+
+		sharedMemory_.release();
+		return;
+	}
+
+	// the producer (re-)initializes the entire ring, consumers accept the ring once the magic number is set
+
+	Header* ringHeader = header();
+
+	ringHeader->magicNumber_.store(0u, std::memory_order_relaxed);
+
+	ringHeader->layoutVersion_ = layoutVersion_;
+	ringHeader->numberSlots_ = uint32_t(numberSlots);
+	ringHeader->slotCapacity_ = uint64_t(alignedSlotCapacity);
+	ringHeader->size_ = uint64_t(size);
+	ringHeader->latest_.store(0ull, std::memory_order_relaxed);
+	ringHeader->signal_.store(0u, std::memory_order_relaxed);
+	ringHeader->producerAlive_.store(1u, std::memory_order_relaxed);
+
+	for (SlotIndex slotIndex = 0u; slotIndex < SlotIndex(numberSlots); ++slotIndex)
+	{
+		SlotHeader& slot = slotHeader(slotIndex);
+
+		slot.references_.store(0u, std::memory_order_relaxed);
+		slot.sequence_.store(0ull, std::memory_order_relaxed);
+	}
+
+	ringHeader->magicNumber_.store(magicNumber_, std::memory_order_release);
+
+	isProducer_ = true;
+}
+
+SharedFrameRing::SharedFrameRing(const std::wstring& name) :
+	sharedMemory_(name)
+{
+	if (!sharedMemory_ || sharedMemory_.size() < sizeof(Header))
+	{
+		sharedMemory_.release();
+		return;
+	}
+
+	const Header* ringHeader = header();
+
+	if (ringHeader->magicNumber_.load(std::memory_order_acquire) != magicNumber_ || ringHeader->layoutVersion_ != layoutVersion_
+			|| ringHeader->numberSlots_ < 2u || ringHeader->numberSlots_ > maximalSlots_ || ringHeader->size_ > uint64_t(sharedMemory_.size())
+			|| uint64_t(memorySize(ringHeader->numberSlots_, size_t(ringHeader->slotCapacity_))) != ringHeader->size_)
+	{
+		Log::error() << "The shared memory does not hold a valid frame ring";
+
+		sharedMemory_.release();
+		return;
+	}
+
+	consumerReferences_.resize(ringHeader->numberSlots_, 0u);
+}
+
+SharedFrameRing::~SharedFrameRing()
+{
+	release();
+}
+
+unsigned int SharedFrameRing::numberSlots() const
+{
+	const Header* ringHeader = header();
+
+	return ringHeader != nullptr ? (unsigned int)(ringHeader->numberSlots_) : 0u;
+}
+
+size_t SharedFrameRing::slotCapacity() const
+{
+	const Header* ringHeader = header();
+
+	return ringHeader != nullptr ? size_t(ringHeader->slotCapacity_) : 0;
+}
+
+Frame SharedFrameRing::beginFrame(const FrameType& frameType, SlotIndex& slotIndex)
+{
+	ocean_assert(isProducer_ && isValid());
+	ocean_assert(frameType.isValid());
+	ocean_assert(writingSlotIndex_ == invalidSlotIndex_ && "The previous frame has not been published");
+
+	slotIndex = invalidSlotIndex_;
+
+	if (!isProducer_ || !isValid() || !frameType.isValid() || writingSlotIndex_ != invalidSlotIndex_)
+	{
+		return Frame();
+	}
+
+	Header& ringHeader = *header();
+
+	if (slotSize(frameType) > size_t(ringHeader.slotCapacity_))
+	{
+		return Frame();
+	}
+
+	const uint64_t latest = ringHeader.latest_.load();
+	const SlotIndex latestSlotIndex = latest != 0ull ? SlotIndex(latest & 0xFFFFull) : invalidSlotIndex_;
+
+	// we determine all slots which are not referenced by any consumer, sorted from the oldest to the most recent frame
+
+	std::vector<std::pair<uint64_t, SlotIndex>> candidates;
+	candidates.reserve(ringHeader.numberSlots_);
+
+	for (SlotIndex n = 0u; n < SlotIndex(ringHeader.numberSlots_); ++n)
+	{
+		if (n != latestSlotIndex && slotHeader(n).references_.load() == 0u)
+		{
+			candidates.emplace_back(slotHeader(n).sequence_.load(), n);
+		}
+	}
+
+	std::sort(candidates.begin(), candidates.end());
+
+	for (const std::pair<uint64_t, SlotIndex>& candidate : candidates)
+	{
+		SlotHeader& slot = slotHeader(candidate.second);
+
+		// the odd sequence number marks the slot as being written, consumers referencing the slot afterwards will release the slot again
+
+		slot.sequence_ = nextPublication_ * 2ull - 1ull;
+
+		if (slot.references_.load() != 0u)
+		{
+			// a consumer has referenced the slot before the slot was marked
+
+			slot.sequence_ = candidate.first;
+			continue;
+		}
+
+		slot.width_ = frameType.width();
+		slot.height_ = frameType.height();
+		slot.pixelFormat_ = uint64_t(frameType.pixelFormat());
+		slot.pixelOrigin_ = uint32_t(frameType.pixelOrigin());
+
+		slotIndex = candidate.second;
+		writingSlotIndex_ = slotIndex;
+
+		return wrapMemory(frameType, slotMemory(slotIndex), true /*writable*/, Timestamp(false));
+	}
+
+	// all slots are referenced by consumers
+
+	return Frame();
+}
+
+bool SharedFrameRing::publishFrame(const SlotIndex slotIndex, const Timestamp& timestamp, const Timestamp& relativeTimestamp)
+{
+	ocean_assert(isProducer_ && isValid());
+	ocean_assert(slotIndex == writingSlotIndex_);
+
+	if (!isProducer_ || !isValid() || slotIndex == invalidSlotIndex_ || slotIndex != writingSlotIndex_)
+	{
+		return false;
+	}
+
+	Header& ringHeader = *header();
+	SlotHeader& slot = slotHeader(slotIndex);
+
+	slot.timestamp_ = double(timestamp);
+	slot.relativeTimestamp_ = double(relativeTimestamp);
+
+	const uint64_t publication = nextPublication_++;
+
+	slot.sequence_ = publication * 2ull;
+	ringHeader.latest_ = (publication << 16ull) | uint64_t(slotIndex);
+
+	writingSlotIndex_ = invalidSlotIndex_;
+
+	ringHeader.signal_.fetch_add(1u);
+	wakeConsumers();
+
+	return true;
+}
+
+bool SharedFrameRing::cancelFrame(const SlotIndex slotIndex)
+{
+	ocean_assert(isProducer_ && isValid());
+	ocean_assert(slotIndex == writingSlotIndex_);
+
+	if (!isProducer_ || !isValid() || slotIndex == invalidSlotIndex_ || slotIndex != writingSlotIndex_)
+	{
+		return false;
+	}
+
+	// the previous content of the slot may have been overwritten, therefore the slot is reset
+
+	slotHeader(slotIndex).sequence_ = 0ull;
+
+	writingSlotIndex_ = invalidSlotIndex_;
+
+	return true;
+}
+
+bool SharedFrameRing::publishFrame(const Frame& frame)
+{
+	ocean_assert(frame.isValid());
+
+	SlotIndex slotIndex = invalidSlotIndex_;
+	Frame slotFrame = beginFrame(frame.frameType(), slotIndex);
+
+	if (!slotFrame.isValid())
+	{
+		return false;
+	}
+
+	if (!slotFrame.copy(0, 0, frame))
+	{
+		ocean_assert(false && "This should never happen!");
+
+		cancelFrame(slotIndex);
+		return false;
+	}
+
+	return publishFrame(slotIndex, frame.timestamp(), frame.relativeTimestamp());
+}
+
+bool SharedFrameRing::acquireLatestFrame(Frame& frame, SlotIndex& slotIndex, uint64_t& publication, const double timeout)
+{
+	ocean_assert(!isProducer_ && isValid());
+	ocean_assert(timeout >= 0.0);
+
+	slotIndex = invalidSlotIndex_;
+
+	if (isProducer_ || !isValid())
+	{
+		return false;
+	}
+
+	const Header& ringHeader = *header();
+
+	const Timestamp startTimestamp(true);
+
+	while (true)
+	{
+		// the signal is read before the latest publication, so that a publication afterwards changes the signal and cannot be missed
+		const uint32_t signal = ringHeader.signal_.load();
+
+		const uint64_t latest = ringHeader.latest_.load();
+		const uint64_t latestPublication = latest >> 16ull;
+
+		if (latest != 0ull && latestPublication > publication)
+		{
+			const SlotIndex latestSlotIndex = SlotIndex(latest & 0xFFFFull);
+
+			if (latestSlotIndex < SlotIndex(ringHeader.numberSlots_))
+			{
+				SlotHeader& slot = slotHeader(latestSlotIndex);
+
+				// first, we reference the slot, afterwards we check whether the slot still holds the expected frame;
+				// the producer marks a slot before checking whether the slot is referenced, so that either the producer or the consumer will back off
+
+				slot.references_.fetch_add(1u);
+
+				if (slot.sequence_.load() == latestPublication * 2ull)
+				{
+					const FrameType frameType(slot.width_, slot.height_, FrameType::PixelFormat(slot.pixelFormat_), FrameType::PixelOrigin(slot.pixelOrigin_));
+
+					if (frameType.isValid() && slotSize(frameType) <= size_t(ringHeader.slotCapacity_))
+					{
+						frame = wrapMemory(frameType, slotMemory(latestSlotIndex), false /*writable*/, Timestamp(slot.timestamp_));
+						frame.setRelativeTimestamp(Timestamp(slot.relativeTimestamp_));
+
+						++consumerReferences_[latestSlotIndex];
+
+						slotIndex = latestSlotIndex;
+						publication = latestPublication;
+
+						return true;
+					}
+
+					ocean_assert(false && "Invalid frame type!");
+				}
+
+				slot.references_.fetch_sub(1u);
+
+				// the producer has started to overwrite the slot, we try again immediately
+				continue;
+			}
+		}
+
+		const double remaining = timeout - double(Timestamp(true) - startTimestamp);
+
+		if (remaining <= 0.0 || ringHeader.producerAlive_.load() == 0u)
+		{
+			return false;
+		}
+
+		waitForSignal(signal, remaining);
+	}
+}
+
+bool SharedFrameRing::releaseFrame(const SlotIndex slotIndex)
+{
+	ocean_assert(!isProducer_ && isValid());
+
+	if (isProducer_ || !isValid() || slotIndex >= SlotIndex(consumerReferences_.size()) || consumerReferences_[slotIndex] == 0u)
+	{
+		ocean_assert(false && "The frame has not been acquired!");
+		return false;
+	}
+
+	--consumerReferences_[slotIndex];
+
+	slotHeader(slotIndex).references_.fetch_sub(1u);
+
+	return true;
+}
+
+bool SharedFrameRing::isProducerAlive() const
+{
+	const Header* ringHeader = header();
+
+	return ringHeader != nullptr && ringHeader->producerAlive_.load() != 0u;
+}
+
+bool SharedFrameRing::isValid() const
+{
+	return bool(sharedMemory_);
+}
+
+SharedFrameRing& SharedFrameRing::operator=(SharedFrameRing&& sharedFrameRing) noexcept
+{
+	if (this != &sharedFrameRing)
+	{
+		release();
+
+		sharedMemory_ = std::move(sharedFrameRing.sharedMemory_);
+		isProducer_ = sharedFrameRing.isProducer_;
+		consumerReferences_ = std::move(sharedFrameRing.consumerReferences_);
+		writingSlotIndex_ = sharedFrameRing.writingSlotIndex_;
+		nextPublication_ = sharedFrameRing.nextPublication_;
+
+		sharedFrameRing.isProducer_ = false;
+		sharedFrameRing.writingSlotIndex_ = invalidSlotIndex_;
+		sharedFrameRing.nextPublication_ = 1ull;
+	}
+
+	return *this;
+}
+
+size_t SharedFrameRing::slotSize(const FrameType& frameType)
+{
+	ocean_assert(frameType.isValid());
+
+	size_t size = 0;
+
+	for (unsigned int planeIndex = 0u; planeIndex < frameType.numberPlanes(); ++planeIndex)
+	{
+		unsigned int planeWidth = 0u;
+		unsigned int planeHeight = 0u;
+		unsigned int planeChannels = 0u;
+
+		if (!FrameType::planeLayout(frameType, planeIndex, planeWidth, planeHeight, planeChannels))
+		{
+			ocean_assert(false && "Invalid frame type!");
+			return size_t(-1);
+		}
+
+		size += alignedSize(size_t(planeWidth) * size_t(planeChannels) * size_t(planeHeight) * size_t(frameType.bytesPerDataType()));
+	}
+
+	return size;
+}
+
+void SharedFrameRing::release()
+{
+	Header* ringHeader = header();
+
+	if (ringHeader != nullptr)
+	{
+		if (isProducer_)
+		{
+			if (writingSlotIndex_ != invalidSlotIndex_)
+			{
+				cancelFrame(writingSlotIndex_);
+			}
+
+			ringHeader->producerAlive_.store(0u);
+			ringHeader->signal_.fetch_add(1u);
+
+			wakeConsumers();
+		}
+		else
+		{
+			for (SlotIndex slotIndex = 0u; slotIndex < SlotIndex(consumerReferences_.size()); ++slotIndex)
+			{
+				if (consumerReferences_[slotIndex] != 0u)
+				{
+					slotHeader(slotIndex).references_.fetch_sub(consumerReferences_[slotIndex]);
+				}
+			}
+		}
+	}
+
+	sharedMemory_.release();
+
+	isProducer_ = false;
+	consumerReferences_.clear();
+	writingSlotIndex_ = invalidSlotIndex_;
+	nextPublication_ = 1ull;
+}
+
+Frame SharedFrameRing::wrapMemory(const FrameType& frameType, uint8_t* memory, const bool writable, const Timestamp& timestamp)
+{
+	ocean_assert(frameType.isValid() && memory != nullptr);
+
+	Frame::PlaneInitializers<void> planeInitializers;
+	planeInitializers.reserve(frameType.numberPlanes());
+
+	size_t memoryOffset = 0;
+
+	for (unsigned int planeIndex = 0u; planeIndex < frameType.numberPlanes(); ++planeIndex)
+	{
+		unsigned int planeWidth = 0u;
+		unsigned int planeHeight = 0u;
+		unsigned int planeChannels = 0u;
+
+		if (!FrameType::planeLayout(frameType, planeIndex, planeWidth, planeHeight, planeChannels))
+		{
+			ocean_assert(false && "Invalid frame type!");
+			return Frame();
+		}
+
+		constexpr unsigned int planePaddingElements = 0u;
+
+		if (writable)
+		{
+			planeInitializers.emplace_back((void*)(memory + memoryOffset), Frame::CM_USE_KEEP_LAYOUT, planePaddingElements);
+		}
+		else
+		{
+			planeInitializers.emplace_back((const void*)(memory + memoryOffset), Frame::CM_USE_KEEP_LAYOUT, planePaddingElements);
+		}
+
+		memoryOffset += alignedSize(size_t(planeWidth) * size_t(planeChannels) * size_t(planeHeight) * size_t(frameType.bytesPerDataType()));
+	}
+
+	return Frame(frameType, planeInitializers, timestamp);
+}
+
+void SharedFrameRing::waitForSignal(const uint32_t signal, const double timeout) const
+{
+	ocean_assert(isValid());
+
+	const Header& ringHeader = *header();
+
+#if defined(__linux__)
+
+	const double waitTimeout = std::min(timeout, 1.0);
+
+	timespec waitTime;
+	waitTime.tv_sec = time_t(waitTimeout);
+	waitTime.tv_nsec = long((waitTimeout - double(waitTime.tv_sec)) * 1000000000.0);
+
+	// the futex is not private, as the memory is shared between processes
+	syscall(SYS_futex, (uint32_t*)(&ringHeader.signal_), FUTEX_WAIT, signal, &waitTime, nullptr, 0);
+
+#else
+
+	// without futex, we poll the signal
+
+	const Timestamp startTimestamp(true);
+
+	while (ringHeader.signal_.load() == signal && double(Timestamp(true) - startTimestamp) < timeout)
+	{
+		Thread::sleep(1u);
+	}
+
+#endif
+}
+
+void SharedFrameRing::wakeConsumers()
+{
+#if defined(__linux__)
+
+	ocean_assert(isValid());
+
+	syscall(SYS_futex, (uint32_t*)(&header()->signal_), FUTEX_WAKE, INT_MAX, nullptr, nullptr, 0);
+
+#endif
+}
+
+size_t SharedFrameRing::memorySize(const unsigned int numberSlots, const size_t slotCapacity)
+{
+	return sizeof(Header) + sizeof(SlotHeader) * size_t(numberSlots) + slotCapacity * size_t(numberSlots);
+}
+
+}
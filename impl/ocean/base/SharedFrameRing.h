@@ -0,0 +1,402 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#ifndef META_OCEAN_BASE_SHARED_FRAME_RING_H
+#define META_OCEAN_BASE_SHARED_FRAME_RING_H
+
+#include "ocean/base/Base.h"
+#include "ocean/base/Frame.h"
+#include "ocean/base/SharedMemory.h"
+#include "ocean/base/Timestamp.h"
+
+#include <atomic>
+
+namespace Ocean
+{
+
+/**
+ * This class implements a ring of frames in shared memory allowing to exchange frames between processes without copying the frame data.
+ * The ring is created by one producer process and can be opened by several consumer processes.<br>
+ * The shared memory holds a fixed number of slots with a fixed capacity, each slot stores the frame type and the timestamp of the frame together with the frame's pixel data.<br>
+ * The producer writes a frame directly into a slot and publishes the slot afterwards, consumers wait for new frames and access the frame data directly in the shared memory.<br>
+ * Each slot has a reference counter in the shared memory, the producer never overwrites a slot which is referenced by a consumer.<br>
+ * Consumers are woken via a futex on Linux, on other platforms consumers poll the ring.
+ *
+ * The producer side:
+ * <pre>
+ * SharedFrameRing ring(L"camera", 8u, frameType.frameTypeSize());
+ *
+ * SharedFrameRing::SlotIndex slotIndex;
+ * Frame frame = ring.beginFrame(frameType, slotIndex);
+ * // ... write the image content into frame
+ * ring.publishFrame(slotIndex, timestamp);
+ * </pre>
+ * The consumer side:
+ * <pre>
+ * SharedFrameRing ring(L"camera");
+ *
+ * uint64_t publication = 0ull;
+ * SharedFrameRing::SlotIndex slotIndex;
+ * Frame frame;
+ * if (ring.acquireLatestFrame(frame, slotIndex, publication, 0.1))
+ * {
+ *     // ... read the frame
+ *     ring.releaseFrame(slotIndex);
+ * }
+ * </pre>
+ * Beware: A consumer process which terminates without releasing its frames keeps the corresponding slots referenced.
+ * @see SharedMemory.
+ * @ingroup base
+ */
+class OCEAN_BASE_EXPORT SharedFrameRing
+{
+	public:
+
+		/**
+		 * Definition of the index of a slot.
+		 */
+		using SlotIndex = uint32_t;
+
+		/**
+		 * Definition of an invalid slot index.
+		 */
+		static constexpr SlotIndex invalidSlotIndex_ = SlotIndex(-1);
+
+	protected:
+
+		/// The magic number identifying a shared frame ring.
+		static constexpr uint32_t magicNumber_ = 0x4F534652u;
+
+		/// The version of the memory layout.
+		static constexpr uint32_t layoutVersion_ = 1u;
+
+		/// The alignment of all slots and planes in bytes.
+		static constexpr size_t alignment_ = 64;
+
+		/// The maximal number of slots.
+		static constexpr unsigned int maximalSlots_ = 64u;
+
+		/**
+		 * This class defines the header of the ring in the shared memory.
+		 */
+		class alignas(alignment_) Header
+		{
+			public:
+
+				/// The magic number, written after the ring has been initialized.
+				std::atomic<uint32_t> magicNumber_;
+
+				/// The version of the memory layout.
+				uint32_t layoutVersion_;
+
+				/// The number of slots.
+				uint32_t numberSlots_;
+
+				/// The capacity of each slot in bytes.
+				uint64_t slotCapacity_;
+
+				/// The overall size of the ring in bytes.
+				uint64_t size_;
+
+				/// The most recent publication, composed of the publication number (upper bits) and the slot index (lower 16 bits), 0 if no frame has been published.
+				std::atomic<uint64_t> latest_;
+
+				/// The signal counter which is increased with each publication, used to wait for new frames.
+				std::atomic<uint32_t> signal_;
+
+				/// True, while the producer exists.
+				std::atomic<uint32_t> producerAlive_;
+		};
+
+		/**
+		 * This class defines the header of one slot in the shared memory.
+		 */
+		class alignas(alignment_) SlotHeader
+		{
+			public:
+
+				/// The number of consumers referencing the slot.
+				std::atomic<uint32_t> references_;
+
+				/// The sequence number of the slot, twice the publication number of the stored frame, odd while the slot is written, 0 if the slot has never been written.
+				std::atomic<uint64_t> sequence_;
+
+				/// The width of the frame in pixel.
+				uint32_t width_;
+
+				/// The height of the frame in pixel.
+				uint32_t height_;
+
+				/// The pixel format of the frame.
+				uint64_t pixelFormat_;
+
+				/// The pixel origin of the frame.
+				uint32_t pixelOrigin_;
+
+				/// The timestamp of the frame.
+				double timestamp_;
+
+				/// The relative timestamp of the frame.
+				double relativeTimestamp_;
+		};
+
+		static_assert(std::atomic<uint32_t>::is_always_lock_free && std::atomic<uint64_t>::is_always_lock_free, "The atomics must be lock-free to be used across processes");
+
+	public:
+
+		/**
+		 * Creates an invalid ring.
+		 */
+		SharedFrameRing() = default;
+
+		/**
+		 * Move constructor.
+		 * @param sharedFrameRing The ring to be moved
+		 */
+		SharedFrameRing(SharedFrameRing&& sharedFrameRing) noexcept;
+
+		/**
+		 * Creates a new ring as producer.
+		 * @param name The system wide unique name of the ring, must be valid
+		 * @param numberSlots The number of slots, consumers can hold at most numberSlots - 1 frames at the same time, with range [2, 64]
+		 * @param slotCapacity The capacity of each slot in bytes, the largest frame which can be exchanged, with range [1, infinity)
+		 */
+		SharedFrameRing(const std::wstring& name, const unsigned int numberSlots, const size_t slotCapacity);
+
+		/**
+		 * Opens an existing ring as consumer.
+		 * @param name The system wide unique name of the ring, must be valid
+		 */
+		explicit SharedFrameRing(const std::wstring& name);
+
+		/**
+		 * Destructs the ring, a consumer releases all frames which have not been released explicitly.
+		 */
+		~SharedFrameRing();
+
+		/**
+		 * Returns whether this ring is the producer side of the ring.
+		 * @return True, if so
+		 */
+		inline bool isProducer() const;
+
+		/**
+		 * Returns the number of slots of this ring.
+		 * @return The ring's number of slots, 0 if invalid
+		 */
+		unsigned int numberSlots() const;
+
+		/**
+		 * Returns the capacity of each slot in bytes.
+		 * @return The slot capacity, 0 if invalid
+		 */
+		size_t slotCapacity() const;
+
+		/**
+		 * Starts writing a new frame, the producer writes the frame directly into the shared memory.
+		 * The function chooses the slot with the oldest frame which is not referenced by any consumer.
+		 * @param frameType The frame type of the new frame, must be valid
+		 * @param slotIndex The resulting index of the slot, must be published or canceled afterwards
+		 * @return The writable frame wrapping the slot memory, invalid if the frame does not fit into a slot or if all slots are referenced by consumers
+		 * @see publishFrame(), cancelFrame().
+		 */
+		Frame beginFrame(const FrameType& frameType, SlotIndex& slotIndex);
+
+		/**
+		 * Publishes a frame which has been written after calling beginFrame() and wakes all waiting consumers.
+		 * @param slotIndex The index of the slot to publish, as provided by beginFrame()
+		 * @param timestamp The timestamp of the frame
+		 * @param relativeTimestamp The relative timestamp of the frame
+		 * @return True, if succeeded
+		 */
+		bool publishFrame(const SlotIndex slotIndex, const Timestamp& timestamp, const Timestamp& relativeTimestamp = Timestamp(false));
+
+		/**
+		 * Cancels writing a frame which has been started with beginFrame().
+		 * @param slotIndex The index of the slot to cancel, as provided by beginFrame()
+		 * @return True, if succeeded
+		 */
+		bool cancelFrame(const SlotIndex slotIndex);
+
+		/**
+		 * Copies a frame into the ring and publishes the frame, this is the only copy of the frame's data.
+		 * @param frame The frame to publish, must be valid
+		 * @return True, if succeeded; False, if the frame does not fit into a slot or if all slots are referenced by consumers
+		 */
+		bool publishFrame(const Frame& frame);
+
+		/**
+		 * Acquires the most recent frame of the ring, the frame wraps the shared memory without copying the frame data.
+		 * The slot of the frame is referenced until the frame is released with releaseFrame(), the frame must not be accessed afterwards.
+		 * @param frame The resulting read-only frame
+		 * @param slotIndex The resulting index of the slot of the frame
+		 * @param publication The publication number of the most recently acquired frame, only frames with newer publication will be acquired, 0 to acquire any frame; will be updated
+		 * @param timeout The time to wait for a new frame, in seconds, with range [0, infinity)
+		 * @return True, if a new frame could be acquired
+		 * @see releaseFrame().
+		 */
+		bool acquireLatestFrame(Frame& frame, SlotIndex& slotIndex, uint64_t& publication, const double timeout = 0.0);
+
+		/**
+		 * Releases a frame which has been acquired with acquireLatestFrame().
+		 * @param slotIndex The index of the slot of the frame to release
+		 * @return True, if succeeded
+		 */
+		bool releaseFrame(const SlotIndex slotIndex);
+
+		/**
+		 * Returns whether the producer of this ring still exists.
+		 * @return True, if so
+		 */
+		bool isProducerAlive() const;
+
+		/**
+		 * Returns whether this ring is valid.
+		 * @return True, if so
+		 */
+		bool isValid() const;
+
+		/**
+		 * Move operator.
+		 * @param sharedFrameRing The ring to be moved
+		 * @return Reference to this object
+		 */
+		SharedFrameRing& operator=(SharedFrameRing&& sharedFrameRing) noexcept;
+
+		/**
+		 * Returns the number of bytes a frame with specific frame type needs in a slot.
+		 * @param frameType The frame type to check, must be valid
+		 * @return The number of bytes, including the alignment of each plane
+		 */
+		static size_t slotSize(const FrameType& frameType);
+
+	protected:
+
+		/**
+		 * Disabled copy constructor.
+		 */
+		SharedFrameRing(const SharedFrameRing&) = delete;
+
+		/**
+		 * Disabled copy operator.
+		 * @return Reference to this object
+		 */
+		SharedFrameRing& operator=(const SharedFrameRing&) = delete;
+
+		/**
+		 * Releases the ring.
+		 */
+		void release();
+
+		/**
+		 * Returns the header of the ring.
+		 * @return The ring's header, nullptr if invalid
+		 */
+		inline Header* header() const;
+
+		/**
+		 * Returns the header of a slot.
+		 * @param slotIndex The index of the slot, with range [0, numberSlots())
+		 * @return The slot's header
+		 */
+		inline SlotHeader& slotHeader(const SlotIndex slotIndex) const;
+
+		/**
+		 * Returns the memory of a slot.
+		 * @param slotIndex The index of the slot, with range [0, numberSlots())
+		 * @return The slot's memory
+		 */
+		inline uint8_t* slotMemory(const SlotIndex slotIndex) const;
+
+		/**
+		 * Creates a frame wrapping the memory of a slot.
+		 * @param frameType The frame type of the frame, must be valid
+		 * @param memory The memory of the slot, must be valid
+		 * @param writable True, to create a writable frame; False, to create a read-only frame
+		 * @param timestamp The timestamp of the frame
+		 * @return The resulting frame
+		 */
+		static Frame wrapMemory(const FrameType& frameType, uint8_t* memory, const bool writable, const Timestamp& timestamp);
+
+		/**
+		 * Waits until the signal counter of the ring differs from a given value.
+		 * @param signal The signal counter value to wait for a change
+		 * @param timeout The time to wait, in seconds, with range [0, infinity)
+		 */
+		void waitForSignal(const uint32_t signal, const double timeout) const;
+
+		/**
+		 * Wakes all consumers waiting for a signal.
+		 */
+		void wakeConsumers();
+
+		/**
+		 * Returns the size of the ring's memory.
+		 * @param numberSlots The number of slots
+		 * @param slotCapacity The capacity of each slot in bytes
+		 * @return The overall size in bytes
+		 */
+		static size_t memorySize(const unsigned int numberSlots, const size_t slotCapacity);
+
+		/**
+		 * Returns the given size aligned to the ring's alignment.
+		 * @param size The size to align
+		 * @return The aligned size
+		 */
+		static constexpr size_t alignedSize(const size_t size);
+
+	protected:
+
+		/// The shared memory of the ring.
+		SharedMemory sharedMemory_;
+
+		/// True, if this ring is the producer side.
+		bool isProducer_ = false;
+
+		/// The number of references this consumer holds for each slot.
+		std::vector<unsigned int> consumerReferences_;
+
+		/// The index of the slot which is currently written by the producer, invalid if no frame is written.
+		SlotIndex writingSlotIndex_ = invalidSlotIndex_;
+
+		/// The next publication number of the producer.
+		uint64_t nextPublication_ = 1ull;
+};
+
+inline bool SharedFrameRing::isProducer() const
+{
+	return isProducer_;
+}
+
+inline SharedFrameRing::Header* SharedFrameRing::header() const
+{
+	return (Header*)(sharedMemory_.constdata());
+}
+
+inline SharedFrameRing::SlotHeader& SharedFrameRing::slotHeader(const SlotIndex slotIndex) const
+{
+	ocean_assert(header() != nullptr && slotIndex < header()->numberSlots_);
+
+	return ((SlotHeader*)((uint8_t*)(header()) + sizeof(Header)))[slotIndex];
+}
+
+inline uint8_t* SharedFrameRing::slotMemory(const SlotIndex slotIndex) const
+{
+	const Header* ringHeader = header();
+	ocean_assert(ringHeader != nullptr && slotIndex < ringHeader->numberSlots_);
+
+	return (uint8_t*)(ringHeader) + sizeof(Header) + sizeof(SlotHeader) * ringHeader->numberSlots_ + size_t(ringHeader->slotCapacity_) * size_t(slotIndex);
+}
+
+constexpr size_t SharedFrameRing::alignedSize(const size_t size)
+{
+	return (size + alignment_ - 1) / alignment_ * alignment_;
+}
+
+}
+
+#endif // META_OCEAN_BASE_SHARED_FRAME_RING_H
@@ -22,8 +22,11 @@ SharedMemory::SharedMemory(const std::wstring& name, const size_t size) :
 
 	if (!name_.empty() && size_ > 0)
 	{
-		requestSharedMemory(name_, size_, handle_, data_);
+		bool existedAlready = false;
+		requestSharedMemory(name_, size_, handle_, data_, &existedAlready);
 		ocean_assert(data_);
+
+		isCreator_ = data_ != nullptr && !existedAlready;
 	}
 	else
 	{
@@ -31,6 +34,19 @@ SharedMemory::SharedMemory(const std::wstring& name, const size_t size) :
 	}
 }
 
+SharedMemory::SharedMemory(const std::wstring& name) :
+	name_(name)
+{
+	ocean_assert(!name_.empty());
+
+	if (!name_.empty() && !openSharedMemory(name_, size_, handle_, data_))
+	{
+		size_ = 0;
+		handle_ = nullptr;
+		data_ = nullptr;
+	}
+}
+
 SharedMemory::SharedMemory(SharedMemory&& sharedMemory) noexcept :
 	SharedMemory()
 {
@@ -58,8 +74,11 @@ bool SharedMemory::resize(const size_t newSize)
 	{
 		size_ = newSize;
 
-		requestSharedMemory(name_, size_, handle_, data_);
+		bool existedAlready = false;
+		requestSharedMemory(name_, size_, handle_, data_, &existedAlready);
 		ocean_assert(data_);
+
+		isCreator_ = data_ != nullptr && !existedAlready;
 	}
 
 	return true;
@@ -107,10 +126,10 @@ void SharedMemory::release()
 		data_ = nullptr;
 	}
 
-	if (handle_)
+	if (handle_ && isCreator_)
 	{
+		// only the creator removes the memory, so that other processes can still open the memory while the creator exists
 		shmctl(int(size_t(handle_)), IPC_RMID, nullptr);
-		handle_ = nullptr;
 	}
 
 #else
@@ -122,6 +141,7 @@ void SharedMemory::release()
 	data_ = nullptr;
 	handle_ = nullptr;
 	size_ = 0;
+	isCreator_ = false;
 }
 
 SharedMemory& SharedMemory::operator=(SharedMemory&& sharedMemory) noexcept
@@ -134,10 +154,12 @@ SharedMemory& SharedMemory::operator=(SharedMemory&& sharedMemory) noexcept
 		name_ = std::move(sharedMemory.name_);
 		handle_ = sharedMemory.handle_;
 		data_ = sharedMemory.data_;
+		isCreator_ = sharedMemory.isCreator_;
 
 		sharedMemory.size_ = 0;
 		sharedMemory.handle_ = nullptr;
 		sharedMemory.data_ = nullptr;
+		sharedMemory.isCreator_ = false;
 	}
 
 	return *this;
@@ -251,4 +273,80 @@ bool SharedMemory::requestSharedMemory(const std::wstring& name, size_t& size, v
 
 }
 
+bool SharedMemory::openSharedMemory(const std::wstring& name, size_t& size, void*& handle, void*& data)
+{
+	ocean_assert_and_suppress_unused(!name.empty(), name);
+
+	size = 0;
+	handle = nullptr;
+	data = nullptr;
+
+#if defined(_WINDOWS)
+
+	const HANDLE mappingHandle = OpenFileMapping(FILE_MAP_WRITE, FALSE, (std::wstring(L"Local\\") + name).c_str());
+
+	if (mappingHandle == nullptr)
+	{
+		return false;
+	}
+
+	void* mappingData = MapViewOfFile(mappingHandle, FILE_MAP_WRITE, 0, 0, 0);
+
+	if (mappingData == nullptr)
+	{
+		CloseHandle(mappingHandle);
+		return false;
+	}
+
+	MEMORY_BASIC_INFORMATION memoryInformation;
+	if (VirtualQuery(mappingData, &memoryInformation, sizeof(memoryInformation)) == 0)
+	{
+		UnmapViewOfFile(mappingData);
+		CloseHandle(mappingHandle);
+		return false;
+	}
+
+	size = size_t(memoryInformation.RegionSize);
+	handle = mappingHandle;
+	data = mappingData;
+	return true;
+
+#elif defined(__APPLE__) || (defined(__linux__) && !defined(_ANDROID))
+
+	const key_t uniqueKey = key_t(std::hash<std::wstring>()(name));
+
+	const int memoryId = shmget(uniqueKey, 0, 0666);
+
+	if (memoryId == -1)
+	{
+		return false;
+	}
+
+	shmid_ds memoryInformation;
+	if (shmctl(memoryId, IPC_STAT, &memoryInformation) != 0)
+	{
+		return false;
+	}
+
+	void* memoryData = shmat(memoryId, nullptr, 0);
+
+	if (memoryData == nullptr || memoryData == (void*)(-1))
+	{
+		return false;
+	}
+
+	size = size_t(memoryInformation.shm_segsz);
+	handle = (void*)size_t(memoryId);
+	data = memoryData;
+	return true;
+
+#else
+
+	OCEAN_WARNING_MISSING_IMPLEMENTATION;
+
+	return false;
+
+#endif
+}
+
 }
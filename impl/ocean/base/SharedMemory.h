@@ -35,6 +35,13 @@ class OCEAN_BASE_EXPORT SharedMemory
 		 */
 		SharedMemory(const std::wstring& name, const size_t size);
 
+		/**
+		 * Opens an existing shared memory object, the memory will not be created if it does not exist.
+		 * The size of the shared memory is determined by the existing memory.
+		 * @param name System wide unique name of the shared memory
+		 */
+		explicit SharedMemory(const std::wstring& name);
+
 		/**
 		 * Disabled copy constructor for a shared memory object.
 		 * @param sharedMemory Shared memory object to be copied
@@ -126,6 +133,16 @@ class OCEAN_BASE_EXPORT SharedMemory
 		 */
 		static bool requestSharedMemory(const std::wstring& name, size_t& size, void*& handle, void*& data, bool* existedAlready = nullptr);
 
+		/**
+		 * Opens an existing shared memory buffer.
+		 * @param name Unique system wide memory name
+		 * @param size The resulting size of the existing memory
+		 * @param handle Resulting memory handle
+		 * @param data Resulting buffer pointer
+		 * @return True, if succeeded; False, if the memory does not exist
+		 */
+		static bool openSharedMemory(const std::wstring& name, size_t& size, void*& handle, void*& data);
+
 	private:
 
 		/// System wide unique memory name.
@@ -139,6 +156,9 @@ class OCEAN_BASE_EXPORT SharedMemory
 
 		/// Shared memory handle.
 		void* handle_ = nullptr;
+
+		/// True, if this object created the shared memory; only the creator removes the memory from the system.
+		bool isCreator_ = false;
 };
 
 inline const std::wstring& SharedMemory::name() const
@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "ocean/base/Task.h"
+#include "ocean/base/Processor.h"
+
+namespace Ocean
+{
+
+bool TaskPromiseBase::registerWaiting(const std::coroutine_handle<> continuation, Signal* signal)
+{
+	ocean_assert((continuation != nullptr) != (signal != nullptr));
+
+	if (state_.load(std::memory_order_acquire) == S_FINISHED)
+	{
+		return false;
+	}
+
+	// the waiting coroutine or thread is stored before the state is changed, so that the finishing coroutine sees a consistent state
+
+	continuation_ = continuation;
+	signal_ = signal;
+
+	uint32_t expectedState = S_PENDING;
+
+	if (state_.compare_exchange_strong(expectedState, S_WAITING, std::memory_order_acq_rel))
+	{
+		return true;
+	}
+
+	ocean_assert(expectedState == S_FINISHED && "Only one coroutine or thread can wait for a task");
+
+	continuation_ = nullptr;
+	signal_ = nullptr;
+
+	return false;
+}
+
+std::coroutine_handle<> TaskPromiseBase::finish() noexcept
+{
+	const uint32_t previousState = state_.exchange(S_FINISHED, std::memory_order_acq_rel);
+
+	if (previousState == S_WAITING)
+	{
+		if (continuation_)
+		{
+			return continuation_;
+		}
+
+		// the waiting thread may destroy the coroutine as soon as the signal is pulsed, so the promise must not be accessed afterwards
+
+		Signal* signal = signal_;
+		ocean_assert(signal != nullptr);
+
+		signal->pulse();
+	}
+
+	return std::noop_coroutine();
+}
+
+void TaskPromiseBase::rethrowException() const
+{
+	if (exception_)
+	{
+		std::rethrow_exception(exception_);
+	}
+}
+
+void TaskExecutor::ScheduleAwaitable::await_suspend(std::coroutine_handle<> handle) const
+{
+	if (!threadPool_.invoke([handle]() { handle.resume(); }))
+	{
+		ocean_assert(false && "This should never happen!");
+
+		// the coroutine must not be lost, so it continues in the calling thread
+
+		handle.resume();
+	}
+}
+
+TaskExecutor::TaskExecutor()
+{
+	threadPool_.setCapacity(std::max(2u, Processor::get().cores()));
+}
+
+bool TaskExecutor::setCapacity(const size_t capacity)
+{
+	return threadPool_.setCapacity(capacity);
+}
+
+size_t TaskExecutor::capacity() const
+{
+	return threadPool_.capacity();
+}
+
+}
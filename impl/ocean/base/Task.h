@@ -0,0 +1,781 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#ifndef META_OCEAN_BASE_TASK_H
+#define META_OCEAN_BASE_TASK_H
+
+#include "ocean/base/Base.h"
+#include "ocean/base/Signal.h"
+#include "ocean/base/Singleton.h"
+#include "ocean/base/ThreadPool.h"
+
+#include <atomic>
+#include <coroutine>
+#include <exception>
+#include <optional>
+#include <type_traits>
+
+namespace Ocean
+{
+
+// Forward declaration.
+template <typename T>
+class Task;
+
+/**
+ * This class implements the type independent part of the promise of a Task coroutine.
+ * The promise synchronizes the completion of the coroutine with the coroutine or thread waiting for the result.
+ * @see Task.
+ * @ingroup base
+ */
+class OCEAN_BASE_EXPORT TaskPromiseBase
+{
+	public:
+
+		/**
+		 * This class implements the awaitable which is used when the coroutine finishes.
+		 * The awaitable resumes the waiting coroutine or wakes up the waiting thread.
+		 */
+		class FinalAwaitable
+		{
+			public:
+
+				/**
+				 * Returns whether the coroutine does not need to be suspended.
+				 * @return Always False
+				 */
+				constexpr bool await_ready() const noexcept;
+
+				/**
+				 * Suspends the finished coroutine and determines the coroutine to resume.
+				 * @param handle The handle of the finished coroutine
+				 * @return The waiting coroutine, a no-op coroutine if no coroutine is waiting
+				 * @tparam TPromise The data type of the coroutine's promise
+				 */
+				template <typename TPromise>
+				std::coroutine_handle<> await_suspend(std::coroutine_handle<TPromise> handle) noexcept;
+
+				/**
+				 * Does nothing, the finished coroutine is never resumed.
+				 */
+				constexpr void await_resume() const noexcept;
+		};
+
+	protected:
+
+		/**
+		 * Definition of the individual states of the promise.
+		 */
+		enum State : uint32_t
+		{
+			/// The coroutine has not finished and nobody is waiting.
+			S_PENDING = 0u,
+			/// The coroutine has not finished and a coroutine or thread is waiting.
+			S_WAITING,
+			/// The coroutine has finished.
+			S_FINISHED
+		};
+
+	public:
+
+		/**
+		 * Suspends the coroutine when it is created, all tasks are started lazily.
+		 * @return The awaitable suspending the coroutine
+		 */
+		inline std::suspend_always initial_suspend() const noexcept;
+
+		/**
+		 * Returns the awaitable which is used when the coroutine finishes.
+		 * @return The final awaitable
+		 */
+		inline FinalAwaitable final_suspend() const noexcept;
+
+		/**
+		 * Stores an exception which has been thrown in the coroutine, the exception is thrown again when the result is accessed.
+		 */
+		inline void unhandled_exception() noexcept;
+
+		/**
+		 * Registers a coroutine or a thread which waits for the result.
+		 * Either a coroutine or a signal must be provided.
+		 * @param continuation The coroutine which will be resumed once the coroutine has finished, nullptr to use the signal instead
+		 * @param signal The signal which will be pulsed once the coroutine has finished, nullptr to use the continuation instead
+		 * @return True, if the waiting coroutine or thread has been registered; False, if the coroutine has finished already
+		 */
+		bool registerWaiting(const std::coroutine_handle<> continuation, Signal* signal);
+
+		/**
+		 * Returns whether the coroutine has finished.
+		 * @return True, if so
+		 */
+		inline bool isFinished() const;
+
+	protected:
+
+		/**
+		 * Marks the coroutine as finished and determines the coroutine to resume.
+		 * @return The waiting coroutine, a no-op coroutine if no coroutine is waiting
+		 */
+		std::coroutine_handle<> finish() noexcept;
+
+		/**
+		 * Throws the exception which has been thrown in the coroutine, if any.
+		 */
+		void rethrowException() const;
+
+	protected:
+
+		/// The coroutine waiting for the result, if any.
+		std::coroutine_handle<> continuation_;
+
+		/// The signal of the thread waiting for the result, if any.
+		Signal* signal_ = nullptr;
+
+		/// The state of the promise.
+		std::atomic<uint32_t> state_ = S_PENDING;
+
+		/// The exception thrown in the coroutine, if any.
+		std::exception_ptr exception_;
+};
+
+/**
+ * This class implements the promise of a Task coroutine providing a result.
+ * @tparam T The data type of the result
+ * @see Task.
+ * @ingroup base
+ */
+template <typename T>
+class TaskPromise : public TaskPromiseBase
+{
+	public:
+
+		/**
+		 * Returns the task object of the coroutine.
+		 * @return The task
+		 */
+		inline Task<T> get_return_object() noexcept;
+
+		/**
+		 * Stores the result of the coroutine.
+		 * @param value The result
+		 * @tparam TValue The data type of the value, must be convertible to T
+		 */
+		template <typename TValue>
+		inline void return_value(TValue&& value);
+
+		/**
+		 * Returns the result of the finished coroutine.
+		 * In case the coroutine has thrown an exception, the exception is thrown again.
+		 * @return The result, moved out of the promise
+		 */
+		inline T result();
+
+	protected:
+
+		/// The result of the coroutine.
+		std::optional<T> value_;
+};
+
+/**
+ * Specialization of the TaskPromise class for coroutines without result.
+ * @ingroup base
+ */
+template <>
+class TaskPromise<void> : public TaskPromiseBase
+{
+	public:
+
+		/**
+		 * Returns the task object of the coroutine.
+		 * @return The task
+		 */
+		inline Task<void> get_return_object() noexcept;
+
+		/**
+		 * Notifies that the coroutine has finished without result.
+		 */
+		inline void return_void() const noexcept;
+
+		/**
+		 * Checks the result of the finished coroutine.
+		 * In case the coroutine has thrown an exception, the exception is thrown again.
+		 */
+		inline void result();
+};
+
+/**
+ * This class implements a C++20 coroutine task providing a result of a specific data type.
+ * A task is started lazily, either when the task is awaited in another coroutine, when start() is called, or when get() is called.<br>
+ * Blocking operations (e.g., reading files, loading media, or network requests) are executed in the thread pool of the TaskExecutor,
+ * so that many operations can be pending concurrently without needing one thread for each operation.
+ *
+ * Here is a tutorial how to use this class:
+ * @code
+ * Task<size_t> loadSize(std::string filename)
+ * {
+ *     const IO::Utilities::ReadFileResult result = co_await IO::Utilities::readFileTask(std::move(filename));
+ *
+ *     co_return result.second.size();
+ * }
+ *
+ * Task<size_t> loadSizes()
+ * {
+ *     std::vector<Task<size_t>> tasks;
+ *     tasks.emplace_back(loadSize("first.bin"));
+ *     tasks.emplace_back(loadSize("second.bin"));
+ *
+ *     // both files are loaded concurrently
+ *     const std::vector<size_t> sizes = co_await TaskExecutor::whenAll(std::move(tasks));
+ *
+ *     co_return sizes[0] + sizes[1];
+ * }
+ *
+ * // a non-coroutine function can wait for the result
+ * const size_t sizes = loadSizes().get();
+ * @endcode
+ * @tparam T The data type of the result, void for tasks without result
+ * @see TaskExecutor.
+ * @ingroup base
+ */
+template <typename T>
+class Task
+{
+	public:
+
+		/**
+		 * Definition of the promise type of the coroutine.
+		 */
+		using promise_type = TaskPromise<T>;
+
+		/**
+		 * Definition of the handle of the coroutine.
+		 */
+		using Handle = std::coroutine_handle<promise_type>;
+
+		/**
+		 * This class implements the awaitable which is used when the task is awaited in another coroutine.
+		 */
+		class Awaitable
+		{
+			public:
+
+				/**
+				 * Creates a new awaitable.
+				 * @param task The task to await
+				 */
+				explicit inline Awaitable(Task<T>& task);
+
+				/**
+				 * Returns whether the task has finished already.
+				 * @return True, if so
+				 */
+				inline bool await_ready() const;
+
+				/**
+				 * Suspends the awaiting coroutine and starts the task if necessary.
+				 * @param continuation The awaiting coroutine
+				 * @return The coroutine to resume
+				 */
+				std::coroutine_handle<> await_suspend(std::coroutine_handle<> continuation);
+
+				/**
+				 * Returns the result of the task.
+				 * @return The task's result
+				 */
+				inline T await_resume();
+
+			protected:
+
+				/// The task to await.
+				Task<T>& task_;
+		};
+
+	public:
+
+		/**
+		 * Creates an invalid task.
+		 */
+		Task() = default;
+
+		/**
+		 * Move constructor.
+		 * @param task The task to move
+		 */
+		inline Task(Task<T>&& task) noexcept;
+
+		/**
+		 * Creates a new task for a coroutine.
+		 * @param handle The handle of the coroutine, must be valid
+		 */
+		explicit inline Task(const Handle handle) noexcept;
+
+		/**
+		 * Destructs the task.
+		 * In case the task has been started but has not finished yet, the destructor waits until the task has finished.
+		 */
+		~Task();
+
+		/**
+		 * Starts the task without waiting for the result.
+		 * The task runs in the calling thread until the task is suspended the first time, e.g., when switching to the thread pool.
+		 */
+		void start();
+
+		/**
+		 * Starts the task if necessary and waits until the task has finished.
+		 * This function must not be called within a coroutine of the TaskExecutor, use co_await instead.
+		 * @return The task's result
+		 */
+		T get();
+
+		/**
+		 * Returns whether the task has finished.
+		 * @return True, if so
+		 */
+		inline bool isReady() const;
+
+		/**
+		 * Returns whether this task holds a coroutine.
+		 * @return True, if so
+		 */
+		inline bool isValid() const;
+
+		/**
+		 * Move operator.
+		 * @param task The task to move
+		 * @return Reference to this object
+		 */
+		Task<T>& operator=(Task<T>&& task) noexcept;
+
+		/**
+		 * Returns the awaitable allowing to co_await this task.
+		 * @return The awaitable
+		 */
+		inline Awaitable operator co_await();
+
+	protected:
+
+		/**
+		 * Disabled copy constructor.
+		 */
+		Task(const Task<T>&) = delete;
+
+		/**
+		 * Disabled copy operator.
+		 * @return Reference to this object
+		 */
+		Task<T>& operator=(const Task<T>&) = delete;
+
+		/**
+		 * Waits until the started task has finished and releases the coroutine.
+		 */
+		void release();
+
+	protected:
+
+		/// The handle of the coroutine.
+		Handle handle_ = nullptr;
+
+		/// True, if the coroutine has been started.
+		bool started_ = false;
+};
+
+/**
+ * This class implements the executor for coroutine tasks.
+ * The executor is backed by a thread pool, blocking operations are executed in the pool while the awaiting coroutines are suspended.
+ * @see Task.
+ * @ingroup base
+ */
+class OCEAN_BASE_EXPORT TaskExecutor : public Singleton<TaskExecutor>
+{
+	friend class Singleton<TaskExecutor>;
+
+	public:
+
+		/**
+		 * This class implements an awaitable which continues the awaiting coroutine in a thread pool, e.g., the thread pool of the executor.
+		 */
+		class OCEAN_BASE_EXPORT ScheduleAwaitable
+		{
+			public:
+
+				/**
+				 * Creates a new awaitable.
+				 * @param threadPool The thread pool in which the coroutine will be continued
+				 */
+				explicit inline ScheduleAwaitable(ThreadPool& threadPool);
+
+				/**
+				 * Returns whether the coroutine does not need to be suspended.
+				 * @return Always False
+				 */
+				constexpr bool await_ready() const noexcept;
+
+				/**
+				 * Suspends the coroutine and continues the coroutine in the thread pool.
+				 * @param handle The handle of the coroutine
+				 */
+				void await_suspend(std::coroutine_handle<> handle) const;
+
+				/**
+				 * Does nothing.
+				 */
+				constexpr void await_resume() const noexcept;
+
+			protected:
+
+				/// The thread pool in which the coroutine will be continued.
+				ThreadPool& threadPool_;
+		};
+
+	public:
+
+		/**
+		 * Returns an awaitable which continues the awaiting coroutine in the thread pool of the executor.
+		 * @return The awaitable
+		 */
+		inline ScheduleAwaitable schedule();
+
+		/**
+		 * Defines the maximal number of threads executing tasks concurrently.
+		 * @param capacity The number of threads, with range (1, infinity)
+		 * @return True, if succeeded
+		 */
+		bool setCapacity(const size_t capacity);
+
+		/**
+		 * Returns the maximal number of threads executing tasks concurrently.
+		 * @return The number of threads
+		 */
+		size_t capacity() const;
+
+		/**
+		 * Executes a (blocking) function in the thread pool of the executor.
+		 * @param function The function to execute, must be valid
+		 * @return The task providing the function's result
+		 * @tparam TFunction The data type of the function
+		 */
+		template <typename TFunction>
+		static Task<std::invoke_result_t<TFunction&>> run(TFunction function);
+
+		/**
+		 * Starts several tasks concurrently and waits until all tasks have finished.
+		 * @param tasks The tasks to execute
+		 * @return The task providing the results of all tasks, in the same order as the tasks
+		 * @tparam T The data type of the results
+		 */
+		template <typename T>
+		static Task<std::vector<T>> whenAll(std::vector<Task<T>> tasks);
+
+	protected:
+
+		/**
+		 * Creates the executor, the capacity is defined by the number of cores.
+		 */
+		TaskExecutor();
+
+	protected:
+
+		/// The thread pool of the executor.
+		ThreadPool threadPool_;
+};
+
+constexpr bool TaskPromiseBase::FinalAwaitable::await_ready() const noexcept
+{
+	return false;
+}
+
+template <typename TPromise>
+std::coroutine_handle<> TaskPromiseBase::FinalAwaitable::await_suspend(std::coroutine_handle<TPromise> handle) noexcept
+{
+	TaskPromiseBase& promise = handle.promise();
+
+	return promise.finish();
+}
+
+constexpr void TaskPromiseBase::FinalAwaitable::await_resume() const noexcept
+{
+	// nothing to do here
+}
+
+inline std::suspend_always TaskPromiseBase::initial_suspend() const noexcept
+{
+	return std::suspend_always();
+}
+
+inline TaskPromiseBase::FinalAwaitable TaskPromiseBase::final_suspend() const noexcept
+{
+	return FinalAwaitable();
+}
+
+inline void TaskPromiseBase::unhandled_exception() noexcept
+{
+	exception_ = std::current_exception();
+}
+
+inline bool TaskPromiseBase::isFinished() const
+{
+	return state_.load(std::memory_order_acquire) == S_FINISHED;
+}
+
+template <typename T>
+inline Task<T> TaskPromise<T>::get_return_object() noexcept
+{
+	return Task<T>(Task<T>::Handle::from_promise(*this));
+}
+
+template <typename T>
+template <typename TValue>
+inline void TaskPromise<T>::return_value(TValue&& value)
+{
+	value_.emplace(std::forward<TValue>(value));
+}
+
+template <typename T>
+inline T TaskPromise<T>::result()
+{
+	rethrowException();
+
+	ocean_assert(value_.has_value());
+
+	return std::move(*value_);
+}
+
+inline Task<void> TaskPromise<void>::get_return_object() noexcept
+{
+	return Task<void>(Task<void>::Handle::from_promise(*this));
+}
+
+inline void TaskPromise<void>::return_void() const noexcept
+{
+	// nothing to do here
+}
+
+inline void TaskPromise<void>::result()
+{
+	rethrowException();
+}
+
+template <typename T>
+inline Task<T>::Awaitable::Awaitable(Task<T>& task) :
+	task_(task)
+{
+	// nothing to do here
+}
+
+template <typename T>
+inline bool Task<T>::Awaitable::await_ready() const
+{
+	ocean_assert(task_.isValid());
+
+	return task_.isReady();
+}
+
+template <typename T>
+std::coroutine_handle<> Task<T>::Awaitable::await_suspend(std::coroutine_handle<> continuation)
+{
+	ocean_assert(task_.isValid());
+
+	const bool registered = task_.handle_.promise().registerWaiting(continuation, nullptr);
+
+	if (!task_.started_)
+	{
+		ocean_assert(registered);
+
+		// the task is started via symmetric transfer, the task resumes the awaiting coroutine once it has finished
+
+		task_.started_ = true;
+
+		return task_.handle_;
+	}
+
+	if (registered)
+	{
+		return std::noop_coroutine();
+	}
+
+	// the task has finished in the meantime, so that the awaiting coroutine can continue immediately
+
+	return continuation;
+}
+
+template <typename T>
+inline T Task<T>::Awaitable::await_resume()
+{
+	return task_.handle_.promise().result();
+}
+
+template <typename T>
+inline Task<T>::Task(Task<T>&& task) noexcept
+{
+	*this = std::move(task);
+}
+
+template <typename T>
+inline Task<T>::Task(const Handle handle) noexcept :
+	handle_(handle)
+{
+	ocean_assert(handle_);
+}
+
+template <typename T>
+Task<T>::~Task()
+{
+	release();
+}
+
+template <typename T>
+void Task<T>::start()
+{
+	ocean_assert(isValid());
+
+	if (handle_ && !started_)
+	{
+		started_ = true;
+
+		handle_.resume();
+	}
+}
+
+template <typename T>
+T Task<T>::get()
+{
+	ocean_assert(isValid());
+
+	Signal signal;
+
+	if (handle_.promise().registerWaiting(nullptr, &signal))
+	{
+		start();
+
+		signal.wait();
+	}
+
+	ocean_assert(isReady());
+
+	return handle_.promise().result();
+}
+
+template <typename T>
+inline bool Task<T>::isReady() const
+{
+	return handle_ && handle_.promise().isFinished();
+}
+
+template <typename T>
+inline bool Task<T>::isValid() const
+{
+	return bool(handle_);
+}
+
+template <typename T>
+Task<T>& Task<T>::operator=(Task<T>&& task) noexcept
+{
+	if (this != &task)
+	{
+		release();
+
+		handle_ = task.handle_;
+		started_ = task.started_;
+
+		task.handle_ = nullptr;
+		task.started_ = false;
+	}
+
+	return *this;
+}
+
+template <typename T>
+inline typename Task<T>::Awaitable Task<T>::operator co_await()
+{
+	return Awaitable(*this);
+}
+
+template <typename T>
+void Task<T>::release()
+{
+	if (handle_)
+	{
+		if (started_ && !isReady())
+		{
+			// the coroutine frame must not be destroyed while the coroutine is running
+
+			Signal signal;
+
+			if (handle_.promise().registerWaiting(nullptr, &signal))
+			{
+				signal.wait();
+			}
+		}
+
+		handle_.destroy();
+
+		handle_ = nullptr;
+		started_ = false;
+	}
+}
+
+inline TaskExecutor::ScheduleAwaitable::ScheduleAwaitable(ThreadPool& threadPool) :
+	threadPool_(threadPool)
+{
+	// nothing to do here
+}
+
+constexpr bool TaskExecutor::ScheduleAwaitable::await_ready() const noexcept
+{
+	return false;
+}
+
+constexpr void TaskExecutor::ScheduleAwaitable::await_resume() const noexcept
+{
+	// nothing to do here
+}
+
+inline TaskExecutor::ScheduleAwaitable TaskExecutor::schedule()
+{
+	return ScheduleAwaitable(threadPool_);
+}
+
+template <typename TFunction>
+Task<std::invoke_result_t<TFunction&>> TaskExecutor::run(TFunction function)
+{
+	co_await get().schedule();
+
+	if constexpr (std::is_void_v<std::invoke_result_t<TFunction&>>)
+	{
+		function();
+	}
+	else
+	{
+		co_return function();
+	}
+}
+
+template <typename T>
+Task<std::vector<T>> TaskExecutor::whenAll(std::vector<Task<T>> tasks)
+{
+	// all tasks are started first so that they can run concurrently
+
+	for (Task<T>& task : tasks)
+	{
+		task.start();
+	}
+
+	std::vector<T> results;
+	results.reserve(tasks.size());
+
+	for (Task<T>& task : tasks)
+	{
+		results.emplace_back(co_await task);
+	}
+
+	co_return results;
+}
+
+}
+
+#endif // META_OCEAN_BASE_TASK_H
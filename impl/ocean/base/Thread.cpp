@@ -17,9 +17,16 @@
 #endif
 
 #ifdef __linux__
+	#include <cerrno>
+
+	#include <sys/resource.h>
 	#include <sys/syscall.h>
+
+	#include <sched.h>
 #endif
 
+#include <fstream>
+
 namespace Ocean
 {
 
@@ -290,6 +297,45 @@ Thread::ThreadPriority Thread::threadPriority()
 	ocean_assert(false && "Unknown priority value.");
 	return PRIORTY_NORMAL;
 
+#elif defined(__linux__) && !defined(__EMSCRIPTEN__)
+
+	// on Linux and Android, the nice value is defined for individual threads, 0 addresses the calling thread
+
+	errno = 0;
+	const int niceValue = getpriority(PRIO_PROCESS, 0);
+
+	if (niceValue == -1 && errno != 0)
+	{
+		return PRIORTY_NORMAL;
+	}
+
+	if (niceValue >= 19)
+	{
+		return PRIORITY_IDLE;
+	}
+
+	if (niceValue > 0)
+	{
+		return PRIORTY_BELOW_NORMAL;
+	}
+
+	if (niceValue == 0)
+	{
+		return PRIORTY_NORMAL;
+	}
+
+	if (niceValue >= -4)
+	{
+		return PRIORTY_ABOVE_NORMAL;
+	}
+
+	if (niceValue >= -8)
+	{
+		return PRIORTY_HIGH;
+	}
+
+	return PRIORTY_REALTIME;
+
 #else
 
 	return PRIORTY_NORMAL;
@@ -334,6 +380,42 @@ bool Thread::setThreadPriority(const ThreadPriority priority)
 	ocean_assert(false && "Unknown priority value.");
 	return false;
 
+#elif defined(__linux__) && !defined(__EMSCRIPTEN__)
+
+	// the nice values follow the thread priorities of Android, e.g., THREAD_PRIORITY_BACKGROUND, THREAD_PRIORITY_DISPLAY, THREAD_PRIORITY_URGENT_DISPLAY
+	// negative nice values may need additional permissions on desktop platforms
+
+	int niceValue = 0;
+
+	switch (priority)
+	{
+		case PRIORITY_IDLE:
+			niceValue = 19;
+			break;
+
+		case PRIORTY_BELOW_NORMAL:
+			niceValue = 10;
+			break;
+
+		case PRIORTY_NORMAL:
+			niceValue = 0;
+			break;
+
+		case PRIORTY_ABOVE_NORMAL:
+			niceValue = -4;
+			break;
+
+		case PRIORTY_HIGH:
+			niceValue = -8;
+			break;
+
+		case PRIORTY_REALTIME:
+			niceValue = -16;
+			break;
+	}
+
+	return setpriority(PRIO_PROCESS, 0, niceValue) == 0;
+
 #else
 
 	OCEAN_SUPPRESS_UNUSED_WARNING(priority);
@@ -345,6 +427,154 @@ bool Thread::setThreadPriority(const ThreadPriority priority)
 
 #endif // defined(__APPLE__)
 
+bool Thread::setThreadPriorityClass(const PriorityClass priorityClass, const CoreAffinity coreAffinity)
+{
+	ocean_assert(priorityClass < PC_END);
+
+	bool result = true;
+
+	if (priorityClass != PC_DEFAULT)
+	{
+		result = setThreadPriority(translatePriorityClass(priorityClass));
+	}
+
+	if (coreAffinity != CA_ANY)
+	{
+		result = setThreadCoreAffinity(coreAffinity) && result;
+	}
+
+	return result;
+}
+
+bool Thread::setThreadCoreAffinity(const CoreAffinity coreAffinity)
+{
+
+#if defined(__linux__) && !defined(__EMSCRIPTEN__)
+
+	const Indices32 coreIndices = cores(coreAffinity);
+
+	if (coreIndices.empty())
+	{
+		// the platform does not provide core classes, so that the hint is ignored
+		return true;
+	}
+
+	cpu_set_t cpuSet;
+	CPU_ZERO(&cpuSet);
+
+	for (const Index32 coreIndex : coreIndices)
+	{
+		CPU_SET(coreIndex, &cpuSet);
+	}
+
+	return sched_setaffinity(0, sizeof(cpuSet), &cpuSet) == 0;
+
+#else
+
+	OCEAN_SUPPRESS_UNUSED_WARNING(coreAffinity);
+	return true;
+
+#endif
+
+}
+
+Indices32 Thread::cores(const CoreAffinity coreAffinity)
+{
+
+#if defined(__linux__) && !defined(__EMSCRIPTEN__)
+
+	// the maximal frequency of each core does not change, so that we determine it once
+
+	static const std::vector<uint64_t> maximalFrequencies = []()
+	{
+		std::vector<uint64_t> frequencies;
+
+		for (unsigned int coreIndex = 0u; coreIndex < CPU_SETSIZE; ++coreIndex)
+		{
+			std::ifstream stream("/sys/devices/system/cpu/cpu" + std::to_string(coreIndex) + "/cpufreq/cpuinfo_max_freq");
+
+			uint64_t frequency = 0ull;
+			if (!stream.is_open() || !(stream >> frequency))
+			{
+				break;
+			}
+
+			frequencies.emplace_back(frequency);
+		}
+
+		return frequencies;
+	}();
+
+	if (maximalFrequencies.empty())
+	{
+		return Indices32();
+	}
+
+	const uint64_t lowestFrequency = *std::min_element(maximalFrequencies.cbegin(), maximalFrequencies.cend());
+	const uint64_t highestFrequency = *std::max_element(maximalFrequencies.cbegin(), maximalFrequencies.cend());
+
+	Indices32 coreIndices;
+	coreIndices.reserve(maximalFrequencies.size());
+
+	for (size_t n = 0; n < maximalFrequencies.size(); ++n)
+	{
+		switch (coreAffinity)
+		{
+			case CA_ANY:
+				coreIndices.emplace_back(Index32(n));
+				break;
+
+			case CA_PERFORMANCE_CORES:
+				if (maximalFrequencies[n] == highestFrequency)
+				{
+					coreIndices.emplace_back(Index32(n));
+				}
+				break;
+
+			case CA_EFFICIENCY_CORES:
+				if (maximalFrequencies[n] == lowestFrequency)
+				{
+					coreIndices.emplace_back(Index32(n));
+				}
+				break;
+		}
+	}
+
+	return coreIndices;
+
+#else
+
+	OCEAN_SUPPRESS_UNUSED_WARNING(coreAffinity);
+	return Indices32();
+
+#endif
+
+}
+
+Thread::ThreadPriority Thread::translatePriorityClass(const PriorityClass priorityClass)
+{
+	switch (priorityClass)
+	{
+		case PC_DEFAULT:
+			return PRIORTY_NORMAL;
+
+		case PC_REALTIME_TRACKING:
+			return PRIORTY_HIGH;
+
+		case PC_INTERACTIVE:
+			return PRIORTY_ABOVE_NORMAL;
+
+		case PC_BACKGROUND:
+			return PRIORTY_BELOW_NORMAL;
+
+		case PC_END:
+			break;
+	}
+
+	ocean_assert(false && "Invalid priority class!");
+	return PRIORTY_NORMAL;
+}
+
 #ifdef __APPLE__
 
 int Thread::pthread_timedjoin_np(pthread_t thread, void** retval, const struct timespec* abstime)
@@ -202,6 +202,38 @@ class OCEAN_BASE_EXPORT Thread
 			PRIORTY_REALTIME
 		};
 
+		/**
+		 * Definition of priority classes for threads.
+		 * A priority class describes the purpose of a thread and is mapped to a platform specific thread priority.
+		 */
+		enum PriorityClass : uint32_t
+		{
+			/// The thread keeps the default priority of the platform.
+			PC_DEFAULT = 0u,
+			/// The thread executes latency-critical tracking or rendering work which must not be time-sliced with bulk work.
+			PC_REALTIME_TRACKING,
+			/// The thread executes work the user is waiting for, e.g., interactive processing.
+			PC_INTERACTIVE,
+			/// The thread executes bulk work without latency requirements, e.g., mapping or loading.
+			PC_BACKGROUND,
+			/// The number of priority classes.
+			PC_END
+		};
+
+		/**
+		 * Definition of core affinity hints for threads.
+		 * On platforms with heterogeneous cores (e.g., big/little cores on Android) a thread can be restricted to one class of cores.
+		 */
+		enum CoreAffinity : uint32_t
+		{
+			/// The thread can run on any core.
+			CA_ANY = 0u,
+			/// The thread runs on the performance (big) cores only.
+			CA_PERFORMANCE_CORES,
+			/// The thread runs on the efficiency (little) cores only.
+			CA_EFFICIENCY_CORES
+		};
+
 	protected:
 
 #if defined(_WINDOWS)
@@ -313,6 +345,38 @@ class OCEAN_BASE_EXPORT Thread
 		 */
 		static bool setThreadPriority(const ThreadPriority priority);
 
+		/**
+		 * Sets the priority class of the current thread.
+		 * The priority class is translated to a thread priority and optionally to a core affinity of the current thread.
+		 * @param priorityClass The priority class to set, must be valid
+		 * @param coreAffinity The core affinity to set in addition, CA_ANY to allow all cores
+		 * @return True, if succeeded; False, if the priority or the core affinity could not be applied (e.g., due to missing permissions)
+		 */
+		static bool setThreadPriorityClass(const PriorityClass priorityClass, const CoreAffinity coreAffinity = CA_ANY);
+
+		/**
+		 * Restricts the current thread to one class of cores.
+		 * On platforms without heterogeneous cores or without affinity support, the hint is ignored.
+		 * @param coreAffinity The core affinity to set
+		 * @return True, if succeeded or if the platform does not distinguish between core classes
+		 */
+		static bool setThreadCoreAffinity(const CoreAffinity coreAffinity);
+
+		/**
+		 * Returns the indices of the cores belonging to a specific class of cores.
+		 * The core classes are determined based on the maximal frequency of each core.
+		 * @param coreAffinity The class of cores for which the indices will be returned
+		 * @return The indices of the cores, empty if the platform does not provide the information
+		 */
+		static Indices32 cores(const CoreAffinity coreAffinity);
+
+		/**
+		 * Translates a priority class to a thread priority.
+		 * @param priorityClass The priority class to translate, must be valid
+		 * @return The corresponding thread priority
+		 */
+		static ThreadPriority translatePriorityClass(const PriorityClass priorityClass);
+
 		/**
 		 * Waits until an object/variable has an expected value.
 		 * @param object Reference to the object/variable whose value is to be checked
@@ -6,14 +6,17 @@
  */
 
 #include "ocean/base/ThreadPool.h"
+#include "ocean/base/Messenger.h"
 #include "ocean/base/RandomI.h"
 #include "ocean/base/String.h"
 
 namespace Ocean
 {
 
-ThreadPool::PoolThread::PoolThread(const std::string& name) :
-	Thread(name)
+ThreadPool::PoolThread::PoolThread(const std::string& name, const PriorityClass priorityClass, const CoreAffinity coreAffinity) :
+	Thread(name),
+	priorityClass_(priorityClass),
+	coreAffinity_(coreAffinity)
 {
 	startThread();
 }
@@ -45,6 +48,14 @@ void ThreadPool::PoolThread::invoke(Function&& function)
 
 void ThreadPool::PoolThread::threadRun()
 {
+	if (priorityClass_ != PC_DEFAULT || coreAffinity_ != CA_ANY)
+	{
+		if (!setThreadPriorityClass(priorityClass_, coreAffinity_))
+		{
+			Log::debug() << "Failed to apply the priority class " << int(priorityClass_) << " to a pool thread";
+		}
+	}
+
 	while (shouldThreadStop() == false)
 	{
 		signal_.wait();
@@ -90,6 +101,23 @@ bool ThreadPool::setCapacity(const size_t capacity)
 	return true;
 }
 
+bool ThreadPool::setPriorityClass(const PriorityClass priorityClass, const CoreAffinity coreAffinity)
+{
+	ocean_assert(priorityClass < PC_END);
+
+	const ScopedLock scopedLock(lock_);
+
+	if (poolThreadIdCounter_ != 0)
+	{
+		return false;
+	}
+
+	priorityClass_ = priorityClass;
+	coreAffinity_ = coreAffinity;
+
+	return true;
+}
+
 bool ThreadPool::invoke(Function&& function)
 {
 	ocean_assert(function);
@@ -136,7 +164,7 @@ bool ThreadPool::invoke(Function&& function)
 			startThread();
 		}
 
-		UniquePoolThread poolThread = std::make_unique<PoolThread>("Pool Thread" + String::toAString(poolThreadIdCounter_++));
+		UniquePoolThread poolThread = std::make_unique<PoolThread>("Pool Thread" + String::toAString(poolThreadIdCounter_++), priorityClass_, coreAffinity_);
 
 		poolThread->invoke(std::move(function));
 
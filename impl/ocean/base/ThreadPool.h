@@ -47,8 +47,10 @@ class OCEAN_BASE_EXPORT ThreadPool : protected Thread
 				/**
 				 * Creates a new thread object.
 				 * @param name The thread name
+				 * @param priorityClass The priority class of the thread, PC_DEFAULT to keep the platform's default priority
+				 * @param coreAffinity The core affinity of the thread, CA_ANY to allow all cores
 				 */
-				explicit PoolThread(const std::string& name);
+				explicit PoolThread(const std::string& name, const PriorityClass priorityClass = PC_DEFAULT, const CoreAffinity coreAffinity = CA_ANY);
 
 				/**
 				 * Destructs a thread object.
@@ -82,6 +84,12 @@ class OCEAN_BASE_EXPORT ThreadPool : protected Thread
 				/// The function that is invoked in this thread.
 				Function function_;
 
+				/// The priority class of this thread.
+				PriorityClass priorityClass_ = PC_DEFAULT;
+
+				/// The core affinity of this thread.
+				CoreAffinity coreAffinity_ = CA_ANY;
+
 				/// Thread lock.
 				mutable Lock lock_;
 		};
@@ -132,6 +140,15 @@ class OCEAN_BASE_EXPORT ThreadPool : protected Thread
 		 */
 		bool setCapacity(const size_t capacity);
 
+		/**
+		 * Defines the priority class and core affinity of all threads of this pool.
+		 * The priority class must be defined before the first function is invoked, e.g., a pool for mapping work can use PC_BACKGROUND so that the work does not preempt tracking or rendering threads.
+		 * @param priorityClass The priority class of all pool threads, must be valid
+		 * @param coreAffinity The core affinity of all pool threads, CA_ANY to allow all cores
+		 * @return True, if succeeded; False, if the pool has created threads already
+		 */
+		bool setPriorityClass(const PriorityClass priorityClass, const CoreAffinity coreAffinity = CA_ANY);
+
 		/**
 		 * Invokes a function on one of the free threads of this pool.
 		 * @param function The function that will be invoked by a free thread
@@ -175,6 +192,12 @@ class OCEAN_BASE_EXPORT ThreadPool : protected Thread
 		/// The counter for pool thread ids.
 		size_t poolThreadIdCounter_ = 0;
 
+		/// The priority class of all pool threads.
+		PriorityClass priorityClass_ = PC_DEFAULT;
+
+		/// The core affinity of all pool threads.
+		CoreAffinity coreAffinity_ = CA_ANY;
+
 		/// Pool lock.
 		mutable Lock lock_;
 };
@@ -0,0 +1,232 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "ocean/base/TimerWheel.h"
+
+#include <algorithm>
+
+namespace Ocean
+{
+
+TimerWheel::TimerWheel(const Tick currentTick) :
+	currentTick_(currentTick)
+{
+	// nothing to do here
+}
+
+void TimerWheel::insert(const TimerId timerId, const Tick dueTick)
+{
+	ocean_assert(timerId != invalidTimerId());
+	ocean_assert(dueTick != invalidTick());
+
+	const Tick validDueTick = std::max(dueTick, currentTick_ + Tick(1));
+
+	// an existing entry of the timer becomes invalid as the due tick changes, or is simply found twice and handled once
+
+	dueTickMap_[timerId] = validDueTick;
+
+	place(Entry(timerId, validDueTick));
+}
+
+bool TimerWheel::remove(const TimerId timerId)
+{
+	// the entry stays in its slot and is skipped once the slot is reached
+
+	return dueTickMap_.erase(timerId) != 0;
+}
+
+void TimerWheel::advance(const Tick tick, TimerIds& dueTimerIds)
+{
+	while (currentTick_ < tick)
+	{
+		if (dueTickMap_.empty())
+		{
+			// the slots may still contain entries of removed timers
+
+			for (unsigned int level = 0u; level < numberLevels_; ++level)
+			{
+				if (levelSizes_[level] != 0)
+				{
+					for (Entries& entries : levels_[level])
+					{
+						entries.clear();
+					}
+
+					levelSizes_[level] = 0;
+				}
+			}
+
+			overflowEntries_.clear();
+
+			currentTick_ = tick;
+			break;
+		}
+
+		if (levelSizes_[0] == 0)
+		{
+			// no timer can be due before the next slot of the second level is reached, so we can skip all remaining ticks of the lowest level
+
+			const Tick lastTickInLowestLevel = currentTick_ | Tick(numberSlots_ - 1u);
+
+			if (lastTickInLowestLevel > currentTick_)
+			{
+				currentTick_ = std::min(lastTickInLowestLevel, tick);
+				continue;
+			}
+		}
+
+		++currentTick_;
+
+		if (slotIndex(0u, currentTick_) == 0u)
+		{
+			// the boundary of the next slot of (at least) the second level has been reached, the boundary of higher levels may be reached as well
+
+			unsigned int highestLevel = 1u;
+
+			while (highestLevel < numberLevels_ && slotIndex(highestLevel, currentTick_) == 0u)
+			{
+				++highestLevel;
+			}
+
+			if (highestLevel == numberLevels_)
+			{
+				Entries overflowEntries;
+				std::swap(overflowEntries, overflowEntries_);
+
+				for (const Entry& entry : overflowEntries)
+				{
+					if (isValid(entry))
+					{
+						place(entry);
+					}
+				}
+
+				--highestLevel;
+			}
+
+			for (unsigned int level = highestLevel; level >= 1u; --level)
+			{
+				cascade(level, slotIndex(level, currentTick_));
+			}
+		}
+
+		Entries& entries = levels_[0][slotIndex(0u, currentTick_)];
+
+		if (!entries.empty())
+		{
+			ocean_assert(levelSizes_[0] >= entries.size());
+			levelSizes_[0] -= entries.size();
+
+			for (const Entry& entry : entries)
+			{
+				if (isValid(entry))
+				{
+					ocean_assert(entry.dueTick_ == currentTick_);
+
+					dueTimerIds.emplace_back(entry.timerId_);
+					dueTickMap_.erase(entry.timerId_);
+				}
+			}
+
+			entries.clear();
+		}
+	}
+}
+
+TimerWheel::Tick TimerWheel::nextDueTick() const
+{
+	if (dueTickMap_.empty())
+	{
+		return invalidTick();
+	}
+
+	// the entries of each level are due after the entries of all lower levels, so the first slot with a valid entry holds the next due timer
+
+	for (unsigned int level = 0u; level < numberLevels_; ++level)
+	{
+		if (levelSizes_[level] == 0)
+		{
+			continue;
+		}
+
+		for (unsigned int slot = slotIndex(level, currentTick_) + 1u; slot < numberSlots_; ++slot)
+		{
+			Tick nextTick = invalidTick();
+
+			for (const Entry& entry : levels_[level][slot])
+			{
+				if (entry.dueTick_ < nextTick && isValid(entry))
+				{
+					nextTick = entry.dueTick_;
+				}
+			}
+
+			if (nextTick != invalidTick())
+			{
+				return nextTick;
+			}
+		}
+	}
+
+	Tick nextTick = invalidTick();
+
+	for (const Entry& entry : overflowEntries_)
+	{
+		if (entry.dueTick_ < nextTick && isValid(entry))
+		{
+			nextTick = entry.dueTick_;
+		}
+	}
+
+	ocean_assert(nextTick != invalidTick());
+
+	return nextTick;
+}
+
+void TimerWheel::place(const Entry& entry)
+{
+	ocean_assert(entry.dueTick_ >= currentTick_);
+
+	// the entry is placed in the lowest level in which the due tick and the current tick share the same range of the next higher level
+
+	for (unsigned int level = 0u; level < numberLevels_; ++level)
+	{
+		const Tick shift = Tick((level + 1u) * slotBits_);
+
+		if ((entry.dueTick_ >> shift) == (currentTick_ >> shift))
+		{
+			levels_[level][slotIndex(level, entry.dueTick_)].emplace_back(entry);
+			++levelSizes_[level];
+
+			return;
+		}
+	}
+
+	overflowEntries_.emplace_back(entry);
+}
+
+void TimerWheel::cascade(const unsigned int level, const unsigned int slot)
+{
+	ocean_assert(level >= 1u && level < numberLevels_);
+	ocean_assert(slot < numberSlots_);
+
+	Entries entries;
+	std::swap(entries, levels_[level][slot]);
+
+	ocean_assert(levelSizes_[level] >= entries.size());
+	levelSizes_[level] -= entries.size();
+
+	for (const Entry& entry : entries)
+	{
+		if (isValid(entry))
+		{
+			place(entry);
+		}
+	}
+}
+
+}
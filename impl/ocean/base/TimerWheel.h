@@ -0,0 +1,270 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#ifndef META_OCEAN_BASE_TIMER_WHEEL_H
+#define META_OCEAN_BASE_TIMER_WHEEL_H
+
+#include "ocean/base/Base.h"
+
+#include <array>
+#include <limits>
+#include <unordered_map>
+#include <vector>
+
+namespace Ocean
+{
+
+/**
+ * This class implements a hierarchical timer wheel holding timers with individual due ticks.
+ * The wheel is composed of several levels with 64 slots each, each slot of the lowest level covers one tick, each slot of the next level covers 64 ticks, and so on.<br>
+ * Inserting and removing a timer has constant costs, timers in a higher level are moved to a lower level once their slot is reached (cascading).<br>
+ * Timers with a due tick beyond the range of the highest level are stored in an overflow list.<br>
+ * The wheel does not contain any time measurement and is not thread-safe, the owner defines the duration of one tick and advances the wheel.
+ * @see Scheduler.
+ * @ingroup base
+ */
+class OCEAN_BASE_EXPORT TimerWheel
+{
+	public:
+
+		/**
+		 * Definition of a tick.
+		 */
+		using Tick = uint64_t;
+
+		/**
+		 * Definition of a timer id.
+		 */
+		using TimerId = uint32_t;
+
+		/**
+		 * Definition of a vector holding timer ids.
+		 */
+		using TimerIds = std::vector<TimerId>;
+
+		/// The number of levels of the wheel.
+		static constexpr unsigned int numberLevels_ = 4u;
+
+		/// The number of bits defining the slots of one level.
+		static constexpr unsigned int slotBits_ = 6u;
+
+		/// The number of slots of one level.
+		static constexpr unsigned int numberSlots_ = 1u << slotBits_;
+
+	protected:
+
+		/**
+		 * This class holds a timer stored in a slot of the wheel.
+		 */
+		class Entry
+		{
+			public:
+
+				/**
+				 * Creates a new entry.
+				 * @param timerId The id of the timer
+				 * @param dueTick The tick at which the timer is due
+				 */
+				inline Entry(const TimerId timerId, const Tick dueTick);
+
+			public:
+
+				/// The id of the timer.
+				TimerId timerId_;
+
+				/// The tick at which the timer is due.
+				Tick dueTick_;
+		};
+
+		/**
+		 * Definition of a vector holding entries.
+		 */
+		using Entries = std::vector<Entry>;
+
+		/**
+		 * Definition of the slots of one level.
+		 */
+		using Slots = std::array<Entries, numberSlots_>;
+
+		/**
+		 * Definition of an unordered map mapping timer ids to their due ticks.
+		 */
+		using DueTickMap = std::unordered_map<TimerId, Tick>;
+
+	public:
+
+		/**
+		 * Creates a new empty timer wheel.
+		 * @param currentTick The current tick of the wheel, timers must be due after this tick
+		 */
+		explicit TimerWheel(const Tick currentTick = 0ull);
+
+		/**
+		 * Inserts a new timer or re-schedules an existing timer.
+		 * @param timerId The id of the timer, must be valid
+		 * @param dueTick The tick at which the timer is due, a tick not after the current tick will be due with the next tick
+		 */
+		void insert(const TimerId timerId, const Tick dueTick);
+
+		/**
+		 * Removes a timer.
+		 * @param timerId The id of the timer to remove
+		 * @return True, if the timer existed
+		 */
+		bool remove(const TimerId timerId);
+
+		/**
+		 * Returns whether a timer exists in this wheel.
+		 * @param timerId The id of the timer
+		 * @return True, if so
+		 */
+		inline bool contains(const TimerId timerId) const;
+
+		/**
+		 * Advances the wheel to a new tick and returns all timers which are due until (including) the new tick.
+		 * The returned timers are removed from the wheel, timers with an earlier due tick are returned first.
+		 * @param tick The new tick, nothing happens if the tick is not after the current tick
+		 * @param dueTimerIds The resulting ids of the due timers, will be appended
+		 */
+		void advance(const Tick tick, TimerIds& dueTimerIds);
+
+		/**
+		 * Returns the tick of the timer which is due next.
+		 * @return The next due tick, invalidTick() if the wheel is empty
+		 */
+		Tick nextDueTick() const;
+
+		/**
+		 * Returns the current tick of this wheel.
+		 * @return The tick to which the wheel has been advanced
+		 */
+		inline Tick currentTick() const;
+
+		/**
+		 * Returns the number of timers in this wheel.
+		 * @return The wheel's number of timers
+		 */
+		inline size_t size() const;
+
+		/**
+		 * Returns whether this wheel does not contain any timer.
+		 * @return True, if so
+		 */
+		inline bool isEmpty() const;
+
+		/**
+		 * Returns an invalid tick.
+		 * @return The invalid tick
+		 */
+		static constexpr Tick invalidTick();
+
+		/**
+		 * Returns an invalid timer id.
+		 * @return The invalid timer id
+		 */
+		static constexpr TimerId invalidTimerId();
+
+	protected:
+
+		/**
+		 * Places an entry in the slot corresponding to the due tick of the entry.
+		 * @param entry The entry to place, with due tick not before the current tick
+		 */
+		void place(const Entry& entry);
+
+		/**
+		 * Moves all entries of a slot to the slots corresponding to their due ticks.
+		 * @param level The level of the slot, with range [1, numberLevels_ - 1]
+		 * @param slot The index of the slot, with range [0, numberSlots_ - 1]
+		 */
+		void cascade(const unsigned int level, const unsigned int slot);
+
+		/**
+		 * Returns whether an entry is still valid (i.e., whether the timer has neither been removed nor re-scheduled in the meantime).
+		 * @param entry The entry to check
+		 * @return True, if so
+		 */
+		inline bool isValid(const Entry& entry) const;
+
+		/**
+		 * Returns the index of the slot of a tick within a level.
+		 * @param level The level, with range [0, numberLevels_ - 1]
+		 * @param tick The tick
+		 * @return The slot index, with range [0, numberSlots_ - 1]
+		 */
+		static constexpr unsigned int slotIndex(const unsigned int level, const Tick tick);
+
+	protected:
+
+		/// The slots of all levels.
+		std::array<Slots, numberLevels_> levels_;
+
+		/// The number of entries in each level, including entries of removed timers.
+		std::array<size_t, numberLevels_> levelSizes_ = {};
+
+		/// The entries with due ticks beyond the range of the highest level.
+		Entries overflowEntries_;
+
+		/// The due ticks of all timers in this wheel.
+		DueTickMap dueTickMap_;
+
+		/// The current tick of this wheel.
+		Tick currentTick_ = 0ull;
+};
+
+inline TimerWheel::Entry::Entry(const TimerId timerId, const Tick dueTick) :
+	timerId_(timerId),
+	dueTick_(dueTick)
+{
+	// nothing to do here
+}
+
+inline bool TimerWheel::contains(const TimerId timerId) const
+{
+	return dueTickMap_.find(timerId) != dueTickMap_.cend();
+}
+
+inline TimerWheel::Tick TimerWheel::currentTick() const
+{
+	return currentTick_;
+}
+
+inline size_t TimerWheel::size() const
+{
+	return dueTickMap_.size();
+}
+
+inline bool TimerWheel::isEmpty() const
+{
+	return dueTickMap_.empty();
+}
+
+constexpr TimerWheel::Tick TimerWheel::invalidTick()
+{
+	return std::numeric_limits<Tick>::max();
+}
+
+constexpr TimerWheel::TimerId TimerWheel::invalidTimerId()
+{
+	return std::numeric_limits<TimerId>::max();
+}
+
+inline bool TimerWheel::isValid(const Entry& entry) const
+{
+	const DueTickMap::const_iterator iTimer = dueTickMap_.find(entry.timerId_);
+
+	return iTimer != dueTickMap_.cend() && iTimer->second == entry.dueTick_;
+}
+
+constexpr unsigned int TimerWheel::slotIndex(const unsigned int level, const Tick tick)
+{
+	return (unsigned int)((tick >> Tick(level * slotBits_)) & Tick(numberSlots_ - 1u));
+}
+
+}
+
+#endif // META_OCEAN_BASE_TIMER_WHEEL_H
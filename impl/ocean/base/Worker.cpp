@@ -11,14 +11,62 @@
 #include "ocean/base/RandomI.h"
 #include "ocean/base/String.h"
 #include "ocean/base/Timestamp.h"
+#include "ocean/base/Utilities.h"
 
 #include <ctime>
 
 namespace Ocean
 {
 
-Worker::WorkerThread::WorkerThread(const unsigned int workerSeedValue, const unsigned int workerThreadId) :
+namespace
+{
+
+/// The worker owning the current thread, nullptr if the thread is not a worker thread.
+thread_local Worker* threadLocalWorker = nullptr;
+
+/// The index of the current thread within the owning worker.
+thread_local unsigned int threadLocalWorkerIndex = (unsigned int)(-1);
+
+}
+
+Worker::ScopedCores::ScopedCores(const unsigned int cores, const bool useCoreBudget) :
+	useCoreBudget_(useCoreBudget)
+{
+	if (!useCoreBudget_)
+	{
+		// the worker does not take part in the core budget, it can use all requested cores
+
+		cores_ = cores;
+		return;
+	}
+
+	std::atomic<unsigned int>& idleCores = idleCoreCounter();
+
+	unsigned int available = idleCores.load();
+
+	while (cores != 0u && available != 0u)
+	{
+		const unsigned int reserved = min(cores, available);
+
+		if (idleCores.compare_exchange_weak(available, available - reserved))
+		{
+			cores_ = reserved;
+			break;
+		}
+	}
+}
+
+Worker::ScopedCores::~ScopedCores()
+{
+	if (useCoreBudget_ && cores_ != 0u)
+	{
+		idleCoreCounter() += cores_;
+	}
+}
+
+Worker::WorkerThread::WorkerThread(const unsigned int workerSeedValue, const unsigned int workerThreadId, Worker& owner) :
 	Thread(workerSeedValue + workerThreadId, std::string("Worker thread ") + String::toAString(workerThreadId)),
+	owner_(owner),
 	id_(workerThreadId)
 {
 	// nothing to do here
@@ -49,6 +97,17 @@ void Worker::WorkerThread::threadRun()
 {
 	ocean_assert(externalSignal_ != nullptr);
 
+	threadLocalWorker = &owner_;
+	threadLocalWorkerIndex = id_;
+
+	if (owner_.priorityClass_ != PC_DEFAULT || owner_.coreAffinity_ != CA_ANY)
+	{
+		if (!setThreadPriorityClass(owner_.priorityClass_, owner_.coreAffinity_))
+		{
+			Log::debug() << "Failed to apply the priority class " << int(owner_.priorityClass_) << " to a worker thread";
+		}
+	}
+
 	while (shouldThreadStop() == false)
 	{
 		internalSignal_.wait();
@@ -136,12 +195,28 @@ void Worker::WorkerThread::threadRun()
 	}
 }
 
-Worker::Worker(const LoadType loadType, const unsigned int maximalNumberCores)
+Worker::Worker(const LoadType loadType, const unsigned int maximalNumberCores, const Thread::PriorityClass priorityClass, const Thread::CoreAffinity coreAffinity) :
+	priorityClass_(priorityClass),
+	coreAffinity_(coreAffinity),
+	loadType_(loadType)
 {
 	ocean_assert(loadType != TYPE_CUSTOM);
 	ocean_assert(maximalNumberCores >= 1u);
+	ocean_assert(priorityClass < Thread::PC_END);
 
 	unsigned int processors = max(1u, Processor::get().cores());
+
+	if (coreAffinity != Thread::CA_ANY)
+	{
+		// the threads of this worker will run on one class of cores only
+
+		const Indices32 affinityCores = Thread::cores(coreAffinity);
+
+		if (!affinityCores.empty())
+		{
+			processors = min(processors, (unsigned int)(affinityCores.size()));
+		}
+	}
 	unsigned int cores = 1u;
 
 	switch (loadType)
@@ -158,6 +233,7 @@ Worker::Worker(const LoadType loadType, const unsigned int maximalNumberCores)
 			break;
 
 		case TYPE_ALL_CORES:
+		case TYPE_ADAPTIVE:
 			cores = max(1u, processors);
 			break;
 
@@ -178,6 +254,7 @@ Worker::Worker(const LoadType loadType, const unsigned int maximalNumberCores)
 	if (cores > 1u)
 	{
 		signals_.setSize(cores);
+		nestedJobsSignals_.setSize(cores);
 
 		// we determine one global seed value for all threads in one worker
 		// however, each worker thread will receive an own seed value based on the global seed value and the index of the thread
@@ -186,7 +263,7 @@ Worker::Worker(const LoadType loadType, const unsigned int maximalNumberCores)
 
 		for (unsigned int n = 0u; n < cores; ++n)
 		{
-			WorkerThread* newWorkerThread = new WorkerThread(workerSeedValue, n);
+			WorkerThread* newWorkerThread = new WorkerThread(workerSeedValue, n, *this);
 
 			ocean_assert(newWorkerThread != nullptr);
 
@@ -197,9 +274,13 @@ Worker::Worker(const LoadType loadType, const unsigned int maximalNumberCores)
 	}
 }
 
-Worker::Worker(const unsigned int numberCores, const LoadType loadType)
+Worker::Worker(const unsigned int numberCores, const LoadType loadType, const Thread::PriorityClass priorityClass, const Thread::CoreAffinity coreAffinity) :
+	priorityClass_(priorityClass),
+	coreAffinity_(coreAffinity),
+	loadType_(TYPE_CUSTOM)
 {
 	ocean_assert(numberCores >= 1u);
+	ocean_assert(priorityClass < Thread::PC_END);
 	ocean_assert_and_suppress_unused(loadType == TYPE_CUSTOM, loadType);
 
 	workerThreads_.reserve(numberCores);
@@ -207,6 +288,7 @@ Worker::Worker(const unsigned int numberCores, const LoadType loadType)
 	if (numberCores > 1u)
 	{
 		signals_.setSize(numberCores);
+		nestedJobsSignals_.setSize(numberCores);
 
 		// we determine one global seed value for all threads in one worker
 		// however, each worker thread will receive an own seed value based on the global seed value and the index of the thread
@@ -215,7 +297,7 @@ Worker::Worker(const unsigned int numberCores, const LoadType loadType)
 
 		for (unsigned int n = 0u; n < numberCores; ++n)
 		{
-			WorkerThread* newWorkerThread = new WorkerThread(workerSeedValue, n);
+			WorkerThread* newWorkerThread = new WorkerThread(workerSeedValue, n, *this);
 
 			ocean_assert(newWorkerThread != nullptr);
 
@@ -243,8 +325,6 @@ bool Worker::executeFunction(const Function& function, const unsigned int first,
 {
 	ocean_assert(minimalIterations > 0);
 
-	const ScopedLock scopedLock(lock_);
-
 	if (size == 0u)
 	{
 		return false;
@@ -255,6 +335,16 @@ bool Worker::executeFunction(const Function& function, const unsigned int first,
 
 	ocean_assert(internalFirstIndex != internalSizeIndex);
 
+	if (threadLocalWorker == this)
+	{
+		// the function has been invoked from inside one of our own threads, the threads are busy with the outer function
+
+		executeNestedFunction(function, first, size, internalFirstIndex, internalSizeIndex, minimalIterations, threadIndex);
+		return true;
+	}
+
+	const ScopedLock scopedLock(lock_);
+
 	if (size <= minimalIterations + (minimalIterations / 2u) || signals_.size() == 0u)
 	{
 		Function specializedFunction(function);
@@ -273,10 +363,38 @@ bool Worker::executeFunction(const Function& function, const unsigned int first,
 		return true;
 	}
 
+	// the worker threads of all workers share the cores of the device, we use only cores which are not busy with other workers
+
+	const ScopedCores scopedCores(min(activeWorkerThreads(), size / minimalIterations), useCoreBudget_);
+
+	if (scopedCores.cores() <= 1u)
+	{
+		Function specializedFunction(function);
+		ocean_assert(internalFirstIndex < specializedFunction.parameters());
+		ocean_assert(internalSizeIndex < specializedFunction.parameters());
+
+		specializedFunction.setParameter(internalFirstIndex, first);
+		specializedFunction.setParameter(internalSizeIndex, size);
+
+		if (threadIndex != (unsigned int)(-1))
+		{
+			specializedFunction.setParameter(threadIndex, 0u);
+		}
+
+		specializedFunction();
+		return true;
+	}
+
+	if (executionMode_ == EM_WORK_STEALING)
+	{
+		executeFunctionWorkStealing(function, first, size, internalFirstIndex, internalSizeIndex, minimalIterations, threadIndex, scopedCores.cores());
+		return true;
+	}
+
 	unsigned int firstElement = first;
 	unsigned int pendingElements = size;
 	unsigned int usedWorkers = 0u;
-	unsigned int availableWorkers = min(signals_.size(), pendingElements / minimalIterations);
+	unsigned int availableWorkers = scopedCores.cores();
 
 	while (availableWorkers != 0u && pendingElements != 0u)
 	{
@@ -322,6 +440,335 @@ bool Worker::executeFunction(const Function& function, const unsigned int first,
 	return true;
 }
 
+void Worker::setExecutionMode(const ExecutionMode executionMode, const unsigned int chunksPerThread)
+{
+	ocean_assert(chunksPerThread >= 1u);
+
+	const ScopedLock scopedLock(lock_);
+
+	executionMode_ = executionMode;
+	chunksPerThread_ = max(1u, chunksPerThread);
+}
+
+Worker::ExecutionMode Worker::executionMode() const
+{
+	return executionMode_;
+}
+
+void Worker::setUseCoreBudget(const bool useCoreBudget)
+{
+	useCoreBudget_ = useCoreBudget;
+}
+
+bool Worker::usesCoreBudget() const
+{
+	return useCoreBudget_;
+}
+
+Worker* Worker::currentWorker()
+{
+	return threadLocalWorker;
+}
+
+void Worker::setAdaptiveLoad(const float loadFactor)
+{
+	ocean_assert(loadFactor > 0.0f && loadFactor <= 1.0f);
+
+	adaptiveLoadFactor() = minmax(0.01f, loadFactor, 1.0f);
+}
+
+float Worker::adaptiveLoad()
+{
+	return adaptiveLoadFactor();
+}
+
+unsigned int Worker::activeWorkerThreads() const
+{
+	const unsigned int workerThreads = signals_.size();
+
+	if (loadType_ != TYPE_ADAPTIVE || workerThreads <= 1u)
+	{
+		return workerThreads;
+	}
+
+	const float loadFactor = adaptiveLoadFactor();
+
+	if (loadFactor >= 1.0f)
+	{
+		return workerThreads;
+	}
+
+	return minmax(1u, (unsigned int)(float(workerThreads) * loadFactor + 0.5f), workerThreads);
+}
+
+std::atomic<float>& Worker::adaptiveLoadFactor()
+{
+	static std::atomic<float> loadFactor(1.0f);
+
+	return loadFactor;
+}
+
+unsigned int Worker::idleCores()
+{
+	return idleCoreCounter();
+}
+
+std::atomic<unsigned int>& Worker::idleCoreCounter()
+{
+	static std::atomic<unsigned int> idleCores(max(1u, Processor::get().cores()));
+
+	return idleCores;
+}
+
+void Worker::executeFunctionWorkStealing(const Function& function, const unsigned int first, const unsigned int size, const unsigned int firstIndex, const unsigned int sizeIndex, const unsigned int minimalIterations, const unsigned int threadIndex, const unsigned int workers)
+{
+	ocean_assert(size != 0u && minimalIterations != 0u);
+	ocean_assert(signals_.size() >= 2u);
+	ocean_assert(workers >= 2u && workers <= signals_.size());
+
+	// the caller holds the worker lock and the cores for the workers
+
+	const unsigned int usedWorkers = min(workers, max(1u, size / minimalIterations));
+	const unsigned int chunks = max(usedWorkers, min(usedWorkers * chunksPerThread_, size / minimalIterations));
+
+	StealingJob job;
+	job.function_ = &function;
+	job.first_ = first;
+	job.size_ = size;
+	job.chunks_ = chunks;
+	job.firstIndex_ = firstIndex;
+	job.sizeIndex_ = sizeIndex;
+	job.threadIndex_ = threadIndex;
+	job.queues_ = StealingQueues(usedWorkers);
+	job.pendingChunks_ = chunks;
+
+	// each thread starts with a contiguous set of chunks to keep the memory access local
+
+	for (unsigned int n = 0u; n < usedWorkers; ++n)
+	{
+		job.queues_[n].front_ = (unsigned int)((uint64_t(chunks) * uint64_t(n)) / uint64_t(usedWorkers));
+		job.queues_[n].back_ = (unsigned int)((uint64_t(chunks) * uint64_t(n + 1u)) / uint64_t(usedWorkers));
+	}
+
+	for (unsigned int n = 0u; n < usedWorkers; ++n)
+	{
+		ocean_assert(workerThreads_[n]);
+		workerThreads_[n]->setThreadFunction(Function::create(*this, &Worker::processStealingJob, &job, n));
+	}
+
+	signals_.waitSubset(usedWorkers);
+}
+
+void Worker::executeNestedFunction(const Function& function, const unsigned int first, const unsigned int size, const unsigned int firstIndex, const unsigned int sizeIndex, const unsigned int minimalIterations, const unsigned int threadIndex)
+{
+	ocean_assert(threadLocalWorker == this);
+	ocean_assert(size != 0u && minimalIterations != 0u);
+
+	const unsigned int workerIndex = threadLocalWorkerIndex;
+
+	const unsigned int numberThreads = max(1u, signals_.size());
+	const unsigned int chunks = max(1u, min(numberThreads * chunksPerThread_, size / minimalIterations));
+
+	StealingJob job;
+	job.function_ = &function;
+	job.first_ = first;
+	job.size_ = size;
+	job.chunks_ = chunks;
+	job.firstIndex_ = firstIndex;
+	job.sizeIndex_ = sizeIndex;
+	job.threadIndex_ = threadIndex;
+	job.queues_ = StealingQueues(1);
+	job.queues_.front().back_ = chunks;
+	job.pendingChunks_ = chunks;
+
+	if (chunks > 1u)
+	{
+		const ScopedLock scopedLock(nestedJobsLock_);
+
+		nestedJobs_.emplace_back(&job);
+
+		// threads waiting for their own jobs can help with the new job
+
+		nestedJobsSignals_.pulse();
+	}
+
+	unsigned int chunk = (unsigned int)(-1);
+
+	while (job.queues_.front().popFront(chunk))
+	{
+		executeChunk(job, chunk, workerIndex);
+	}
+
+	if (chunks > 1u)
+	{
+		TemporaryScopedLock scopedLock(nestedJobsLock_);
+
+			for (size_t n = 0; n < nestedJobs_.size(); ++n)
+			{
+				if (nestedJobs_[n] == &job)
+				{
+					nestedJobs_[n] = nestedJobs_.back();
+					nestedJobs_.pop_back();
+					break;
+				}
+			}
+
+		scopedLock.release();
+
+		// chunks stolen by other threads may still be executed, the job must stay alive until all of them have been finished
+
+		waitForJob(job, workerIndex);
+	}
+
+	ocean_assert(job.pendingChunks_ == 0u);
+}
+
+void Worker::processStealingJob(StealingJob* job, const unsigned int workerIndex)
+{
+	ocean_assert(job != nullptr && job->function_ != nullptr);
+	ocean_assert(workerIndex < job->queues_.size());
+
+	const unsigned int numberQueues = (unsigned int)(job->queues_.size());
+
+	unsigned int chunk = (unsigned int)(-1);
+
+	while (true)
+	{
+		bool foundChunk = job->queues_[workerIndex].popFront(chunk);
+
+		for (unsigned int n = 1u; !foundChunk && n < numberQueues; ++n)
+		{
+			// we steal from the back of the next queues so that the owner and the thief do not interfere with each other
+
+			foundChunk = job->queues_[(workerIndex + n) % numberQueues].popBack(chunk);
+		}
+
+		if (!foundChunk)
+		{
+			break;
+		}
+
+		executeChunk(*job, chunk, workerIndex);
+	}
+
+	// while other threads are still busy, this thread helps with nested functions which may have been invoked by the busy threads
+
+	waitForJob(*job, workerIndex);
+}
+
+bool Worker::helpNestedJobs(const unsigned int workerIndex)
+{
+	StealingJob* job = nullptr;
+	unsigned int chunk = (unsigned int)(-1);
+
+	TemporaryScopedLock scopedLock(nestedJobsLock_);
+
+		for (StealingJob* nestedJob : nestedJobs_)
+		{
+			if (nestedJob->queues_.front().popBack(chunk))
+			{
+				job = nestedJob;
+				break;
+			}
+		}
+
+	scopedLock.release();
+
+	if (job == nullptr)
+	{
+		return false;
+	}
+
+	// the job stays alive as long as the stolen chunk is pending
+
+	executeChunk(*job, chunk, workerIndex);
+
+	return true;
+}
+
+void Worker::waitForJob(const StealingJob& job, const unsigned int workerIndex)
+{
+	while (job.pendingChunks_.load() != 0u)
+	{
+		if (helpNestedJobs(workerIndex))
+		{
+			continue;
+		}
+
+		// there is nothing to help with, so we sleep until a new nested job arrives or until the last chunk of a job has been finished
+		// the signal is reset before the state is checked, so that a pulse between the check and the wait is not lost
+
+		ocean_assert(workerIndex < nestedJobsSignals_.size());
+		Signal& signal = nestedJobsSignals_[workerIndex];
+
+		signal.reset();
+
+		TemporaryScopedLock scopedLock(nestedJobsLock_);
+
+			const bool keepWaiting = job.pendingChunks_.load() != 0u && !hasPendingNestedChunks();
+
+		scopedLock.release();
+
+		if (keepWaiting)
+		{
+			signal.wait();
+		}
+	}
+}
+
+bool Worker::hasPendingNestedChunks() const
+{
+	// the caller holds the nested jobs lock
+
+	for (StealingJob* nestedJob : nestedJobs_)
+	{
+		StealingQueue& queue = nestedJob->queues_.front();
+
+		const ScopedLock scopedLock(queue.lock_);
+
+		if (queue.front_ < queue.back_)
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void Worker::executeChunk(StealingJob& job, const unsigned int chunk, const unsigned int workerIndex)
+{
+	ocean_assert(chunk < job.chunks_);
+
+	const unsigned int chunkFirst = job.chunkStart(chunk);
+	const unsigned int chunkSize = job.chunkStart(chunk + 1u) - chunkFirst;
+	ocean_assert(chunkSize != 0u);
+
+	Function specializedFunction(*job.function_);
+	ocean_assert(job.firstIndex_ < specializedFunction.parameters());
+	ocean_assert(job.sizeIndex_ < specializedFunction.parameters());
+
+	specializedFunction.setParameter(job.firstIndex_, chunkFirst);
+	specializedFunction.setParameter(job.sizeIndex_, chunkSize);
+
+	if (job.threadIndex_ != (unsigned int)(-1))
+	{
+		specializedFunction.setParameter(job.threadIndex_, workerIndex);
+	}
+
+	specializedFunction();
+
+	// the job must not be accessed after the chunk has been marked as finished
+
+	ocean_assert(job.pendingChunks_.load() != 0u);
+
+	if (--job.pendingChunks_ == 0u)
+	{
+		// all threads waiting for a job are woken up, threads waiting for another job go back to sleep
+
+		nestedJobsSignals_.pulse();
+	}
+}
+
 Worker::StartIndices Worker::separation(const unsigned int first, const unsigned int size, const unsigned int minimalIterations)
 {
 	ocean_assert(minimalIterations > 0u);
@@ -341,7 +788,7 @@ Worker::StartIndices Worker::separation(const unsigned int first, const unsigned
 	unsigned int firstElement = first;
 	unsigned int pendingElements = size;
 	unsigned int usedWorkers = 0u;
-	unsigned int availableWorkers = min(signals_.size(), pendingElements / minimalIterations);
+	unsigned int availableWorkers = min(activeWorkerThreads(), pendingElements / minimalIterations);
 
 	while (availableWorkers != 0u && pendingElements != 0u)
 	{
@@ -376,9 +823,13 @@ Worker::StartIndices Worker::separation(const unsigned int first, const unsigned
 
 bool Worker::executeAbortableFunction(const AbortableFunction& abortableFunction, const unsigned int abortIndex, const unsigned int maximalExecutions)
 {
-	const ScopedLock scopedLock(lock_);
+	// nested calls from inside our own threads are executed by the calling thread
+
+	const bool isNested = threadLocalWorker == this;
 
-	if (maximalExecutions == 1u || signals_.size() == 0u)
+	const OptionalScopedLock scopedLock(lock_, !isNested);
+
+	if (maximalExecutions == 1u || signals_.size() == 0u || isNested)
 	{
 		AbortableFunction functionCopy(abortableFunction);
 		*functionCopy.parameter<bool*>(abortIndex) = false;
@@ -386,15 +837,24 @@ bool Worker::executeAbortableFunction(const AbortableFunction& abortableFunction
 		return functionCopy();
 	}
 
-	unsigned int usedWorkers = signals_.size();
-	if (maximalExecutions > 0u && maximalExecutions < signals_.size())
+	unsigned int usedWorkers = activeWorkerThreads();
+	if (maximalExecutions > 0u && maximalExecutions < usedWorkers)
 	{
 		usedWorkers = maximalExecutions;
 	}
 
+	const ScopedCores scopedCores(usedWorkers, useCoreBudget_);
+
 	AbortableFunction functionCopy(abortableFunction);
 	*functionCopy.parameter<bool*>(abortIndex) = false;
 
+	if (scopedCores.cores() <= 1u)
+	{
+		return functionCopy();
+	}
+
+	usedWorkers = scopedCores.cores();
+
 	for (unsigned int n = 0u; n < usedWorkers; ++n)
 	{
 		ocean_assert(workerThreads_[n]);
@@ -423,14 +883,18 @@ bool Worker::executeSeparableAndAbortableFunction(const AbortableFunction& abort
 {
 	ocean_assert(minimalIterations > 0u);
 
-	const ScopedLock scopedLock(lock_);
+	// nested calls from inside our own threads are executed by the calling thread
+
+	const bool isNested = threadLocalWorker == this;
+
+	const OptionalScopedLock scopedLock(lock_, !isNested);
 
 	if (size == 0u)
 	{
 		return false;
 	}
 
-	if (size <= minimalIterations || signals_.size() == 0u)
+	if (size <= minimalIterations || signals_.size() == 0u || isNested)
 	{
 		AbortableFunction specializedFunction(abortableFunction);
 		ocean_assert(firstIndex < specializedFunction.parameters());
@@ -442,7 +906,21 @@ bool Worker::executeSeparableAndAbortableFunction(const AbortableFunction& abort
 		return specializedFunction();
 	}
 
-	unsigned int availableWorkers = signals_.size();
+	const ScopedCores scopedCores(activeWorkerThreads(), useCoreBudget_);
+
+	if (scopedCores.cores() <= 1u)
+	{
+		AbortableFunction specializedFunction(abortableFunction);
+		ocean_assert(firstIndex < specializedFunction.parameters());
+		ocean_assert(sizeIndex < specializedFunction.parameters());
+
+		specializedFunction.setParameter(firstIndex, first);
+		specializedFunction.setParameter(sizeIndex, size);
+
+		return specializedFunction();
+	}
+
+	unsigned int availableWorkers = scopedCores.cores();
 	unsigned int firstElement = first;
 	unsigned int pendingElements = size;
 	unsigned int usedWorkers = 0u;
@@ -503,14 +981,20 @@ bool Worker::executeSeparableAndAbortableFunction(const AbortableFunction& abort
 
 bool Worker::executeFunctions(const Functions& functions)
 {
-	const ScopedLock scopedLock(lock_);
+	// nested calls from inside our own threads are executed by the calling thread
+
+	const bool isNested = threadLocalWorker == this;
+
+	const OptionalScopedLock scopedLock(lock_, !isNested);
 
 	if (functions.empty())
 	{
 		return false;
 	}
 
-	if (signals_.size() == 0u)
+	const ScopedCores scopedCores(isNested ? 0u : min(activeWorkerThreads(), (unsigned int)(functions.size())), useCoreBudget_);
+
+	if (signals_.size() == 0u || scopedCores.cores() <= 1u)
 	{
 		for (Functions::const_iterator i = functions.begin(); i != functions.end(); ++i)
 		{
@@ -524,7 +1008,7 @@ bool Worker::executeFunctions(const Functions& functions)
 
 	while (i != functions.end())
 	{
-		unsigned int availableWorkers = signals_.size();
+		unsigned int availableWorkers = scopedCores.cores();
 		unsigned int usedWorkers = 0u;
 
 		while (availableWorkers != 0u && i != functions.end())
@@ -13,6 +13,7 @@
 #include "ocean/base/Signal.h"
 #include "ocean/base/Thread.h"
 
+#include <atomic>
 #include <vector>
 
 namespace Ocean
@@ -24,6 +25,11 @@ namespace Ocean
  * The worker provides several modes to distribute the computational load of a complex operation.<br>
  * Function call my be made faster by using subsets of the entire data by individual CPU cores only.<br>
  * Further, this worker supports abortable functions executing the same function several times and stops all other threads if the first function receives a valid result.<br>
+ * Functions executed by the worker may invoke the same worker again (nested parallelism), nested calls never create additional threads and never dead-lock.<br>
+ * In work-stealing mode, threads being idle within the outer function help executing the nested function, threads without work block until new work arrives.<br>
+ * Workers can take part in one process-wide budget of cores (e.g., the workers of the WorkerPool), see setUseCoreBudget().<br>
+ * Such workers distribute a function to at most as many threads as cores are currently not used by other participating workers, when less than two cores are left, the function is executed by the calling thread.<br>
+ * All other workers (the default) always use all their threads and do not touch the budget.<br>
  * For more details several code examples are provided:
  * @see executeFunction(), executeFunctions().
  * @see WorkerPool.
@@ -65,7 +71,20 @@ class OCEAN_BASE_EXPORT Worker
 			/// For each CPU core two thread are used.
 			TYPE_DOUBLE_CORES,
 			/// A custom amount of CPU cores is used.
-			TYPE_CUSTOM
+			TYPE_CUSTOM,
+			/// All CPU cores are used as long as the process-wide adaptive load allows it, the number of active threads follows setAdaptiveLoad() at runtime.
+			TYPE_ADAPTIVE
+		};
+
+		/**
+		 * Definition of individual execution modes for separable functions.
+		 */
+		enum ExecutionMode : uint32_t
+		{
+			/// The range is split into one contiguous block per worker thread, the default mode.
+			EM_STATIC_BLOCKS,
+			/// The range is split into several smaller chunks held in per-thread queues, idle threads steal chunks from the queues of busy threads.
+			EM_WORK_STEALING
 		};
 
 		/**
@@ -75,6 +94,142 @@ class OCEAN_BASE_EXPORT Worker
 
 	protected:
 
+		/**
+		 * This class implements a queue of chunks owned by one worker thread within a work-stealing execution.
+		 * The queue holds a contiguous range of chunk indices, the owner takes chunks from the front while other threads steal chunks from the back.
+		 */
+		class StealingQueue
+		{
+			public:
+
+				/**
+				 * Pops the next chunk from the front of this queue, used by the owning thread.
+				 * @param chunk The resulting chunk index
+				 * @return True, if a chunk was available
+				 */
+				inline bool popFront(unsigned int& chunk);
+
+				/**
+				 * Steals a chunk from the back of this queue, used by all other threads.
+				 * @param chunk The resulting chunk index
+				 * @return True, if a chunk was available
+				 */
+				inline bool popBack(unsigned int& chunk);
+
+			public:
+
+				/// The index of the first pending chunk.
+				unsigned int front_ = 0u;
+
+				/// The index of the chunk after the last pending chunk.
+				unsigned int back_ = 0u;
+
+				/// The lock of this queue.
+				Lock lock_;
+		};
+
+		/**
+		 * Definition of a vector holding stealing queues.
+		 */
+		using StealingQueues = std::vector<StealingQueue>;
+
+		/**
+		 * This class holds the state of one function execution in work-stealing mode.
+		 */
+		class StealingJob
+		{
+			public:
+
+				/**
+				 * Returns the first element of a chunk.
+				 * @param chunk The index of the chunk, with range [0, chunks_]
+				 * @return The first element of the chunk
+				 */
+				inline unsigned int chunkStart(const unsigned int chunk) const;
+
+			public:
+
+				/// The separable function to be executed for each chunk.
+				const Function* function_ = nullptr;
+
+				/// The first element of the entire range.
+				unsigned int first_ = 0u;
+
+				/// The number of elements of the entire range.
+				unsigned int size_ = 0u;
+
+				/// The number of chunks the range is split into.
+				unsigned int chunks_ = 0u;
+
+				/// The index of the function parameter receiving the start value.
+				unsigned int firstIndex_ = (unsigned int)(-1);
+
+				/// The index of the function parameter receiving the number value.
+				unsigned int sizeIndex_ = (unsigned int)(-1);
+
+				/// The optional index of the function parameter receiving the thread index.
+				unsigned int threadIndex_ = (unsigned int)(-1);
+
+				/// The queues of all worker threads, one for each thread.
+				StealingQueues queues_;
+
+				/// The number of chunks which have not yet been finished.
+				std::atomic<unsigned int> pendingChunks_ = 0u;
+		};
+
+		/**
+		 * Definition of a vector holding pointers to stealing jobs.
+		 */
+		using StealingJobs = std::vector<StealingJob*>;
+
+		/**
+		 * This class reserves cores of the process-wide core budget for the lifetime of the object.
+		 * The reservation never blocks, the object receives as many cores as currently available (up to the requested number).
+		 */
+		class ScopedCores
+		{
+			public:
+
+				/**
+				 * Reserves cores of the process-wide core budget.
+				 * @param cores The number of cores to reserve, with range [0, infinity)
+				 * @param useCoreBudget True, to reserve the cores from the budget; False, to receive all requested cores without touching the budget
+				 */
+				ScopedCores(const unsigned int cores, const bool useCoreBudget);
+
+				/**
+				 * Releases the reserved cores.
+				 */
+				~ScopedCores();
+
+				/**
+				 * Returns the number of reserved cores.
+				 * @return The number of cores which have been reserved, with range [0, requested cores]
+				 */
+				inline unsigned int cores() const;
+
+			protected:
+
+				/**
+				 * Disabled copy constructor.
+				 */
+				ScopedCores(const ScopedCores&) = delete;
+
+				/**
+				 * Disabled copy operator.
+				 * @return Reference to this object
+				 */
+				ScopedCores& operator=(const ScopedCores&) = delete;
+
+			protected:
+
+				/// The number of reserved cores.
+				unsigned int cores_ = 0u;
+
+				/// True, if the cores have been reserved from the budget.
+				bool useCoreBudget_ = false;
+		};
+
 		/**
 		 * This class implements a thread with an explicit external thread function.<br>
 		 */
@@ -101,8 +256,9 @@ class OCEAN_BASE_EXPORT Worker
 				 * Creates a new worker thread object.
 				 * @param workerSeedValue Worker specific seed value e.g., for random number generators, each thread will work with an own seed value: threadSeedValue = workerSeedValue + workerThreadId
 				 * @param workerThreadId Id of the worker thread to distinguish between all threads owned by one worker
+				 * @param owner The worker owning this thread
 				 */
-				explicit WorkerThread(const unsigned int workerSeedValue, const unsigned int workerThreadId);
+				WorkerThread(const unsigned int workerSeedValue, const unsigned int workerThreadId, Worker& owner);
 
 				/**
 				 * Destructs a worker thread object.
@@ -176,6 +332,9 @@ class OCEAN_BASE_EXPORT Worker
 				/// External signal determining the termination of the thread function.
 				Signal* externalSignal_ = nullptr;
 
+				/// The worker owning this thread.
+				Worker& owner_;
+
 				/// Id of the worker thread.
 				unsigned int id_ = (unsigned int)(-1);
 
@@ -195,18 +354,23 @@ class OCEAN_BASE_EXPORT Worker
 
 		/**
 		 * Creates a new worker object.
-		 * The load type defines the number of cores to be used, however the worker will not address more than 'maximalNumberCores'.
+		 * The load type defines the number of cores to be used, however the worker will not address more than 'maximalNumberCores'.<br>
+		 * In case the worker is restricted to one class of cores, the load type is applied to the cores of this class.
 		 * @param loadType Load type used for this worker, must not be TYPE_CUSTOM
 		 * @param maximalNumberCores The maximal number of cores to be used, with range [1, infinity)
+		 * @param priorityClass The priority class of all worker threads, PC_DEFAULT to keep the platform's default priority
+		 * @param coreAffinity The core affinity of all worker threads, CA_ANY to allow all cores
 		 */
-		explicit Worker(const LoadType loadType = TYPE_ALL_CORES, const unsigned int maximalNumberCores = 16u);
+		explicit Worker(const LoadType loadType = TYPE_ALL_CORES, const unsigned int maximalNumberCores = 16u, const Thread::PriorityClass priorityClass = Thread::PC_DEFAULT, const Thread::CoreAffinity coreAffinity = Thread::CA_ANY);
 
 		/**
 		 * Creates a new worker object with a custom amount of worker threads.
 		 * @param numberCores The number of threads to use, with range [1, infinity)
 		 * @param loadType Must be TYPE_CUSTOM
+		 * @param priorityClass The priority class of all worker threads, PC_DEFAULT to keep the platform's default priority
+		 * @param coreAffinity The core affinity of all worker threads, CA_ANY to allow all cores
 		 */
-		Worker(const unsigned int numberCores, const LoadType loadType);
+		Worker(const unsigned int numberCores, const LoadType loadType, const Thread::PriorityClass priorityClass = Thread::PC_DEFAULT, const Thread::CoreAffinity coreAffinity = Thread::CA_ANY);
 
 		/**
 		 * Destructs a worker object.
@@ -219,6 +383,12 @@ class OCEAN_BASE_EXPORT Worker
 		 */
 		unsigned int threads() const;
 
+		/**
+		 * Returns the priority class of the threads of this worker.
+		 * @return The worker's priority class
+		 */
+		inline Thread::PriorityClass priorityClass() const;
+
 		/**
 		 * Executes a callback function separable by two function parameters.
 		 * The first separable function parameter defines the start point.<br>
@@ -276,6 +446,7 @@ class OCEAN_BASE_EXPORT Worker
 		 * @param minimalIterations Minimal number of iterations assigned to one internal thread
 		 * @param threadIndex Optional index of the worker function parameter receiving the index of the individual thread
 		 * @return True, if succeeded
+		 * @see setUseCoreBudget().
 		 */
 		bool executeFunction(const Function& function, const unsigned int first, const unsigned int size, const unsigned int firstIndex = (unsigned int)(-1), const unsigned int sizeIndex = (unsigned int)(-1), const unsigned int minimalIterations = 1u, const unsigned int threadIndex = (unsigned int)(-1));
 
@@ -364,6 +535,70 @@ class OCEAN_BASE_EXPORT Worker
 		 */
 		StartIndices separation(const unsigned int first, const unsigned int size, const unsigned int minimalIterations = 1u);
 
+		/**
+		 * Sets the execution mode this worker applies when distributing separable functions via executeFunction().
+		 * In work-stealing mode, the range is split into several chunks per thread (while each chunk still covers at least 'minimalIterations' elements).<br>
+		 * Each thread starts with a contiguous set of chunks and idle threads steal chunks from the remaining threads, so that slow cores (e.g., on big.LITTLE architectures) do not determine the wall time.<br>
+		 * Existing functions do not need to be adjusted, however the optional thread index parameter will receive the index of the thread executing the individual chunk.
+		 * @param executionMode The execution mode to be used
+		 * @param chunksPerThread The number of chunks per thread in work-stealing mode, with range [1, infinity)
+		 * @see executionMode().
+		 */
+		void setExecutionMode(const ExecutionMode executionMode, const unsigned int chunksPerThread = 4u);
+
+		/**
+		 * Returns the execution mode of this worker.
+		 * @return The worker's execution mode
+		 * @see setExecutionMode().
+		 */
+		ExecutionMode executionMode() const;
+
+		/**
+		 * Sets whether this worker takes part in the process-wide budget of cores.
+		 * A participating worker distributes a function (via executeFunction(), executeFunctions(), executeAbortableFunction(), or executeSeparableAndAbortableFunction()) to at most as many threads as cores are currently not used by other participating workers.<br>
+		 * When less than two cores are left, the function is executed serially by the calling thread, so that concurrently used workers do not oversubscribe the device.<br>
+		 * A worker which does not participate (the default) always uses all its threads.<br>
+		 * The workers of the WorkerPool take part in the budget.
+		 * @param useCoreBudget True, to take part in the core budget
+		 * @see usesCoreBudget(), idleCores().
+		 */
+		void setUseCoreBudget(const bool useCoreBudget);
+
+		/**
+		 * Returns whether this worker takes part in the process-wide budget of cores.
+		 * @return True, if so
+		 * @see setUseCoreBudget().
+		 */
+		bool usesCoreBudget() const;
+
+		/**
+		 * Returns the worker owning the calling thread.
+		 * Functions executed by a worker can use this function to determine whether they are running inside a parallel region.
+		 * @return The worker owning the calling thread, nullptr if the calling thread is not a worker thread
+		 */
+		static Worker* currentWorker();
+
+		/**
+		 * Sets the process-wide load factor of all workers with load type TYPE_ADAPTIVE.
+		 * The factor defines the fraction of the threads of an adaptive worker which are used to distribute a function, e.g., to reduce the load when the device throttles due to thermal pressure.<br>
+		 * The factor can be changed at any time, it is applied to the next function execution.
+		 * @param loadFactor The load factor to set, with range (0, 1], 1 to use all threads
+		 * @see System::Performance.
+		 */
+		static void setAdaptiveLoad(const float loadFactor);
+
+		/**
+		 * Returns the process-wide load factor of all workers with load type TYPE_ADAPTIVE.
+		 * @return The current load factor, with range (0, 1]
+		 */
+		static float adaptiveLoad();
+
+		/**
+		 * Returns the number of cores of the process-wide core budget which are currently not used by any participating worker.
+		 * @return The number of idle cores, with range [0, Processor::cores()]
+		 */
+		static unsigned int idleCores();
+
 		/**
 		 * Returns whether this worker uses more than one thread to distribute a function.
 		 * @return True, if so
@@ -378,6 +613,89 @@ class OCEAN_BASE_EXPORT Worker
 
 	protected:
 
+		/**
+		 * Returns the number of worker threads which are currently used to distribute a function.
+		 * @return The number of active worker threads, with range [1, signals_.size()], 0 if the worker does not have any worker thread
+		 */
+		unsigned int activeWorkerThreads() const;
+
+		/**
+		 * Returns the process-wide load factor of adaptive workers.
+		 * @return The load factor
+		 */
+		static std::atomic<float>& adaptiveLoadFactor();
+
+		/**
+		 * Returns the number of idle cores of the process-wide core budget shared by all workers.
+		 * @return The number of idle cores, initialized with the number of cores of the device
+		 */
+		static std::atomic<unsigned int>& idleCoreCounter();
+
+		/**
+		 * Executes a separable function in work-stealing mode.
+		 * @param function Separable function to be execute
+		 * @param first First function parameter
+		 * @param size Size function parameter, with range [1, infinity)
+		 * @param firstIndex Index of the worker function parameter receiving the start value
+		 * @param sizeIndex Index of the worker function parameter receiving the number value
+		 * @param minimalIterations Minimal number of iterations assigned to one chunk, with range [1, infinity)
+		 * @param threadIndex Optional index of the worker function parameter receiving the index of the individual thread
+		 * @param workers The number of worker threads which can be used, with range [2, signals_.size()]
+		 */
+		void executeFunctionWorkStealing(const Function& function, const unsigned int first, const unsigned int size, const unsigned int firstIndex, const unsigned int sizeIndex, const unsigned int minimalIterations, const unsigned int threadIndex, const unsigned int workers);
+
+		/**
+		 * Executes a separable function which has been invoked from inside one of this worker's threads.
+		 * The calling thread processes the chunks of the function while idle threads of this worker may help.
+		 * @param function Separable function to be execute
+		 * @param first First function parameter
+		 * @param size Size function parameter, with range [1, infinity)
+		 * @param firstIndex Index of the worker function parameter receiving the start value
+		 * @param sizeIndex Index of the worker function parameter receiving the number value
+		 * @param minimalIterations Minimal number of iterations assigned to one chunk, with range [1, infinity)
+		 * @param threadIndex Optional index of the worker function parameter receiving the index of the individual thread
+		 */
+		void executeNestedFunction(const Function& function, const unsigned int first, const unsigned int size, const unsigned int firstIndex, const unsigned int sizeIndex, const unsigned int minimalIterations, const unsigned int threadIndex);
+
+		/**
+		 * Processes chunks of a work-stealing job until no chunk is left, this function is executed by each worker thread.
+		 * Afterwards, the thread helps executing nested jobs until all chunks of the job have been finished.
+		 * @param job The job to be processed, must be valid
+		 * @param workerIndex The index of the worker thread executing this function, with range [0, job->queues_.size())
+		 */
+		void processStealingJob(StealingJob* job, const unsigned int workerIndex);
+
+		/**
+		 * Executes one chunk of a nested job, if any nested job with pending chunks exists.
+		 * @param workerIndex The index of the worker thread executing this function
+		 * @return True, if a chunk has been executed
+		 */
+		bool helpNestedJobs(const unsigned int workerIndex);
+
+		/**
+		 * Waits until all chunks of a job have been finished, meanwhile the calling thread helps executing nested jobs.
+		 * The calling thread blocks while no nested job has pending chunks, it does not spin.
+		 * @param job The job to wait for
+		 * @param workerIndex The index of the worker thread executing this function
+		 */
+		void waitForJob(const StealingJob& job, const unsigned int workerIndex);
+
+		/**
+		 * Returns whether at least one nested job has a chunk which has not been started yet.
+		 * The nested jobs lock must be locked when calling this function.
+		 * @return True, if so
+		 */
+		bool hasPendingNestedChunks() const;
+
+		/**
+		 * Executes one chunk of a job.
+		 * Waiting threads are woken up when the last chunk of the job has been finished.
+		 * @param job The job to which the chunk belongs, must be valid
+		 * @param chunk The index of the chunk, with range [0, job->chunks_)
+		 * @param workerIndex The index of the worker thread executing the chunk
+		 */
+		void executeChunk(StealingJob& job, const unsigned int chunk, const unsigned int workerIndex);
+
 		/**
 		 * Disabled copy constructor.
 		 * @param worker Object which would be copied
@@ -393,6 +711,15 @@ class OCEAN_BASE_EXPORT Worker
 
 	protected:
 
+		/// The priority class of all worker threads.
+		Thread::PriorityClass priorityClass_ = Thread::PC_DEFAULT;
+
+		/// The core affinity of all worker threads.
+		Thread::CoreAffinity coreAffinity_ = Thread::CA_ANY;
+
+		/// The load type of this worker.
+		LoadType loadType_ = TYPE_ALL_CORES;
+
 		/// Worker threads.
 		WorkerThreads workerThreads_;
 
@@ -401,8 +728,67 @@ class OCEAN_BASE_EXPORT Worker
 
 		/// Worker lock.
 		Lock lock_;
+
+		/// The execution mode of this worker.
+		ExecutionMode executionMode_ = EM_STATIC_BLOCKS;
+
+		/// The number of chunks per thread in work-stealing mode, with range [1, infinity)
+		unsigned int chunksPerThread_ = 4u;
+
+		/// True, if this worker takes part in the process-wide budget of cores.
+		std::atomic<bool> useCoreBudget_ = false;
+
+		/// The nested jobs which have been invoked from inside worker threads.
+		StealingJobs nestedJobs_;
+
+		/// The lock for the nested jobs.
+		Lock nestedJobsLock_;
+
+		/// The signals of threads waiting for jobs, one for each worker thread, pulsed whenever a nested job has been added or the last chunk of a job has been finished.
+		Signals nestedJobsSignals_;
 };
 
+inline bool Worker::StealingQueue::popFront(unsigned int& chunk)
+{
+	const ScopedLock scopedLock(lock_);
+
+	if (front_ >= back_)
+	{
+		return false;
+	}
+
+	chunk = front_++;
+
+	return true;
+}
+
+inline bool Worker::StealingQueue::popBack(unsigned int& chunk)
+{
+	const ScopedLock scopedLock(lock_);
+
+	if (front_ >= back_)
+	{
+		return false;
+	}
+
+	chunk = --back_;
+
+	return true;
+}
+
+inline unsigned int Worker::ScopedCores::cores() const
+{
+	return cores_;
+}
+
+inline unsigned int Worker::StealingJob::chunkStart(const unsigned int chunk) const
+{
+	ocean_assert(chunk <= chunks_);
+	ocean_assert(chunks_ != 0u);
+
+	return first_ + (unsigned int)((uint64_t(size_) * uint64_t(chunk)) / uint64_t(chunks_));
+}
+
 inline unsigned int Worker::WorkerThread::id()
 {
 	return id_;
@@ -463,6 +849,11 @@ inline Worker::WorkerThread::WorkerState Worker::WorkerThread::state() const
 	return workerState_;
 }
 
+inline Thread::PriorityClass Worker::priorityClass() const
+{
+	return priorityClass_;
+}
+
 inline Worker::operator bool() const
 {
 	return threads() > 1;
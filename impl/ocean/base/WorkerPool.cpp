@@ -11,19 +11,34 @@
 namespace Ocean
 {
 
+WorkerPool::WorkerPool()
+{
+	// latency-critical work runs on the performance cores, bulk work on the efficiency cores
+
+	workerGroups_[Thread::PC_REALTIME_TRACKING].coreAffinity_ = Thread::CA_PERFORMANCE_CORES;
+	workerGroups_[Thread::PC_BACKGROUND].coreAffinity_ = Thread::CA_EFFICIENCY_CORES;
+}
+
 WorkerPool::~WorkerPool()
 {
-	freeWorkers_.clear();
-	usedWorkers_.clear();
+	for (WorkerGroup& workerGroup : workerGroups_)
+	{
+		workerGroup.freeWorkers_.clear();
+		workerGroup.usedWorkers_.clear();
+	}
 }
 
-bool WorkerPool::setCapacity(const size_t workers)
+bool WorkerPool::setCapacity(const size_t workers, const Thread::PriorityClass priorityClass)
 {
+	ocean_assert(priorityClass < Thread::PC_END);
+
 	const ScopedLock scopedLock(lock_);
 
-	if (workers >= capacity_)
+	WorkerGroup& workerGroup = workerGroups_[priorityClass];
+
+	if (workers >= workerGroup.capacity_ && workers <= workerGroup.usedWorkers_.capacity())
 	{
-		capacity_ = workers;
+		workerGroup.capacity_ = workers;
 
 		return true;
 	}
@@ -31,16 +46,38 @@ bool WorkerPool::setCapacity(const size_t workers)
 	return false;
 }
 
-WorkerPool::ScopedWorker WorkerPool::scopedWorker()
+void WorkerPool::setCoreAffinity(const Thread::PriorityClass priorityClass, const Thread::CoreAffinity coreAffinity)
+{
+	ocean_assert(priorityClass < Thread::PC_END);
+
+	const ScopedLock scopedLock(lock_);
+
+	workerGroups_[priorityClass].coreAffinity_ = coreAffinity;
+}
+
+WorkerPool::ScopedWorker WorkerPool::scopedWorker(const Thread::PriorityClass priorityClass)
 {
-	return ScopedWorker(lock());
+	return ScopedWorker(lock(priorityClass));
 }
 
-Worker* WorkerPool::lock()
+Worker* WorkerPool::lock(const Thread::PriorityClass priorityClass)
 {
+	ocean_assert(priorityClass < Thread::PC_END);
+
+	Worker* currentWorker = Worker::currentWorker();
+
+	if (currentWorker != nullptr)
+	{
+		// we are inside a parallel region already, nested regions are executed by the same worker so that the number of threads does not grow
+
+		return currentWorker;
+	}
+
 	const ScopedLock scopedLock(lock_);
 
-	if (freeWorkers_.empty() && usedWorkers_.empty())
+	WorkerGroup& workerGroup = workerGroups_[priorityClass];
+
+	if (workerGroup.freeWorkers_.empty() && workerGroup.usedWorkers_.empty())
 	{
 		const unsigned int cores = Processor::get().cores();
 
@@ -51,28 +88,34 @@ Worker* WorkerPool::lock()
 	}
 
 	// try to find an unused worker
-	if (!freeWorkers_.empty())
+	if (!workerGroup.freeWorkers_.empty())
 	{
-		UniqueWorker worker = std::move(freeWorkers_.back());
-		freeWorkers_.popBack();
+		UniqueWorker worker = std::move(workerGroup.freeWorkers_.back());
+		workerGroup.freeWorkers_.popBack();
 
-		ocean_assert(usedWorkers_.size() < usedWorkers_.capacity());
-		usedWorkers_.pushBack(std::move(worker));
+		ocean_assert(workerGroup.usedWorkers_.size() < workerGroup.usedWorkers_.capacity());
+		workerGroup.usedWorkers_.pushBack(std::move(worker));
 
-		return usedWorkers_.back().get();
+		return workerGroup.usedWorkers_.back().get();
 	}
 
 	// if all workers are in use, but there is still capacity for a new worker
-	if (freeWorkers_.size() + usedWorkers_.size() < capacity_)
+	if (workerGroup.freeWorkers_.size() + workerGroup.usedWorkers_.size() < workerGroup.capacity_)
 	{
-		UniqueWorker worker = std::make_unique<Worker>();
+		// real-time tracking workers always use all their threads, all other workers adapt their load to the thermal status of the device
+		const Worker::LoadType loadType = priorityClass == Thread::PC_REALTIME_TRACKING ? Worker::TYPE_ALL_CORES : Worker::TYPE_ADAPTIVE;
 
-		ocean_assert(usedWorkers_.size() < usedWorkers_.capacity());
-		usedWorkers_.pushBack(std::move(worker));
+		UniqueWorker worker = std::make_unique<Worker>(loadType, 16u, priorityClass, workerGroup.coreAffinity_);
 
-		ocean_assert(freeWorkers_.empty());
+		// all workers of the pool share the cores of the device
+		worker->setUseCoreBudget(true);
 
-		return usedWorkers_.back().get();
+		ocean_assert(workerGroup.usedWorkers_.size() < workerGroup.usedWorkers_.capacity());
+		workerGroup.usedWorkers_.pushBack(std::move(worker));
+
+		ocean_assert(workerGroup.freeWorkers_.empty());
+
+		return workerGroup.usedWorkers_.back().get();
 	}
 
 	return nullptr;
@@ -82,18 +125,27 @@ void WorkerPool::unlock(Worker* worker)
 {
 	if (worker != nullptr)
 	{
+		if (worker == Worker::currentWorker())
+		{
+			// the worker has been handed out for a nested parallel region, it stays in use by the outer region
+
+			return;
+		}
+
 		const ScopedLock scopedLock(lock_);
 
-		for (size_t n = 0; n < min(usedWorkers_.size(), size_t(20)); ++n)
+		WorkerGroup& workerGroup = workerGroups_[worker->priorityClass()];
+
+		for (size_t n = 0; n < workerGroup.usedWorkers_.size(); ++n)
 		{
-			if (usedWorkers_[n].get() == worker)
+			if (workerGroup.usedWorkers_[n].get() == worker)
 			{
-				UniqueWorker usedWorker = std::move(usedWorkers_[n]);
-				usedWorkers_[n] = std::move(usedWorkers_.back());
-				usedWorkers_.popBack();
+				UniqueWorker usedWorker = std::move(workerGroup.usedWorkers_[n]);
+				workerGroup.usedWorkers_[n] = std::move(workerGroup.usedWorkers_.back());
+				workerGroup.usedWorkers_.popBack();
 
-				ocean_assert(freeWorkers_.size() < freeWorkers_.capacity());
-				freeWorkers_.pushBack(std::move(usedWorker));
+				ocean_assert(workerGroup.freeWorkers_.size() < workerGroup.freeWorkers_.capacity());
+				workerGroup.freeWorkers_.pushBack(std::move(usedWorker));
 
 				return;
 			}
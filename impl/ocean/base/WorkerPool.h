@@ -19,6 +19,7 @@ namespace Ocean
 
 /**
  * This class implements a pool holding worker objects for individual use.
+ * All workers of the pool take part in the process-wide budget of cores, so that concurrently used workers do not oversubscribe the device.
  * @see Worker.
  * @ingroup base
  */
@@ -39,6 +40,26 @@ class OCEAN_BASE_EXPORT WorkerPool : public Singleton<WorkerPool>
 		 */
 		using Workers = StaticVector<UniqueWorker, 10>;
 
+		/**
+		 * This class holds the worker objects of one priority class.
+		 */
+		class WorkerGroup
+		{
+			public:
+
+				/// Vector holding the currently not-used worker objects.
+				Workers freeWorkers_;
+
+				/// Vector holding the currently used worker objects.
+				Workers usedWorkers_;
+
+				/// Maximal capacity of the group, with range [1, 10]
+				size_t capacity_ = 2;
+
+				/// The core affinity of all workers of this group.
+				Thread::CoreAffinity coreAffinity_ = Thread::CA_ANY;
+		};
+
 	public:
 
 		/**
@@ -129,30 +150,50 @@ class OCEAN_BASE_EXPORT WorkerPool : public Singleton<WorkerPool>
 	public:
 
 		/**
-		 * Returns the maximal number of worker objects allowed inside this pool.
+		 * Returns the maximal number of worker objects allowed inside this pool for one priority class.
+		 * @param priorityClass The priority class for which the capacity will be returned, must be valid
 		 * @return Maximal worker capacity, with range [1, 10], 2 by default
 		 */
-		inline size_t capacity();
+		inline size_t capacity(const Thread::PriorityClass priorityClass = Thread::PC_DEFAULT);
 
 		/**
 		 * Returns the number of currently existing worker objects in this pool.
-		 * @return Worker count, with range [0, capacity()]
+		 * @return Worker count, with range [0, infinity)
 		 */
 		inline size_t size();
 
 		/**
-		 * Defines the maximal number of worker objects existing concurrently.
+		 * Defines the maximal number of worker objects existing concurrently for one priority class.
 		 * @param workers Maximal number of worker objects to be allowed inside this pool, with range [capacity(), 10]
+		 * @param priorityClass The priority class for which the capacity will be set, must be valid
 		 * @return True, if succeeded
 		 */
-		bool setCapacity(const size_t workers);
+		bool setCapacity(const size_t workers, const Thread::PriorityClass priorityClass = Thread::PC_DEFAULT);
+
+		/**
+		 * Defines the core affinity hint of all workers of one priority class.
+		 * The hint is applied to workers which will be created after this call, therefore the hint should be set before the first worker of the priority class is requested.<br>
+		 * By default, workers with priority class PC_REALTIME_TRACKING run on performance cores, workers with priority class PC_BACKGROUND run on efficiency cores.
+		 * @param priorityClass The priority class for which the core affinity will be set, must be valid
+		 * @param coreAffinity The core affinity to set
+		 */
+		void setCoreAffinity(const Thread::PriorityClass priorityClass, const Thread::CoreAffinity coreAffinity);
 
 		/**
 		 * Returns a scoped object holding the real worker if available.
 		 * The scoped object guarantees the existence of the real worker (if available in the moment this function is called) as long as the scoped object exists.
 		 * @return Object holding the worker if available, otherwise the object will be empty
 		 */
-		ScopedWorker scopedWorker();
+		inline ScopedWorker scopedWorker();
+
+		/**
+		 * Returns a scoped object holding a real worker of a specific priority class if available.
+		 * Workers of different priority classes never share threads, so that e.g., latency-critical work is not time-sliced with bulk jobs.<br>
+		 * The scoped object guarantees the existence of the real worker (if available in the moment this function is called) as long as the scoped object exists.
+		 * @param priorityClass The priority class of the worker, must be valid
+		 * @return Object holding the worker if available, otherwise the object will be empty
+		 */
+		ScopedWorker scopedWorker(const Thread::PriorityClass priorityClass);
 
 		/**
 		 * Returns a scoped object holding the real worker if a given condition is 'True' and if a worker is available.
@@ -171,9 +212,9 @@ class OCEAN_BASE_EXPORT WorkerPool : public Singleton<WorkerPool>
 	private:
 
 		/**
-		 * Creates a new worker pool and initializes the maximal worker capacity to 2.
+		 * Creates a new worker pool and initializes the maximal worker capacity of each priority class to 2.
 		 */
-		WorkerPool() = default;
+		WorkerPool();
 
 		/**
 		 * Destructs a worker pool.
@@ -182,11 +223,13 @@ class OCEAN_BASE_EXPORT WorkerPool : public Singleton<WorkerPool>
 
 		/**
 		 * Tries to lock a worker to be used for individual worker.
+		 * When invoked from inside a worker thread (nested parallelism), the worker owning the calling thread is returned so that nested parallel regions do not create additional threads.<br>
 		 * Beware: This worker object must be unlocked after usage.
+		 * @param priorityClass The priority class of the worker, must be valid
 		 * @return Worker object if available, otherwise nullptr
 		 * @see unlock().
 		 */
-		Worker* lock();
+		Worker* lock(const Thread::PriorityClass priorityClass);
 
 		/**
 		 * Unlocks a previously locked worker object to make it available for other users.
@@ -197,14 +240,8 @@ class OCEAN_BASE_EXPORT WorkerPool : public Singleton<WorkerPool>
 
 	private:
 
-		/// Vector holding the currently not-used worker objects.
-		Workers freeWorkers_;
-
-		/// Vector holding the currently used worker objects.
-		Workers usedWorkers_;
-
-		/// Maximal pool capacity, with range [1, infinity)
-		size_t capacity_ = 2;
+		/// The worker groups, one for each priority class.
+		WorkerGroup workerGroups_[Thread::PC_END];
 
 		/// Lock for the entire pool.
 		Lock lock_;
@@ -263,18 +300,32 @@ inline WorkerPool::ScopedWorker::operator bool() const
 	return worker_ != nullptr;
 }
 
-inline size_t WorkerPool::capacity()
+inline size_t WorkerPool::capacity(const Thread::PriorityClass priorityClass)
 {
+	ocean_assert(priorityClass < Thread::PC_END);
+
 	const ScopedLock scopedLock(lock_);
 
-	return capacity_;
+	return workerGroups_[priorityClass].capacity_;
 }
 
 inline size_t WorkerPool::size()
 {
 	const ScopedLock scopedLock(lock_);
 
-	return usedWorkers_.size() + freeWorkers_.size();
+	size_t workers = 0;
+
+	for (const WorkerGroup& workerGroup : workerGroups_)
+	{
+		workers += workerGroup.usedWorkers_.size() + workerGroup.freeWorkers_.size();
+	}
+
+	return workers;
+}
+
+inline WorkerPool::ScopedWorker WorkerPool::scopedWorker()
+{
+	return scopedWorker(Thread::PC_DEFAULT);
 }
 
 inline WorkerPool::ScopedWorker WorkerPool::conditionalScopedWorker(const bool condition)
@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "ocean/cv/CPUDispatch.h"
+
+#include "ocean/base/Processor.h"
+
+namespace Ocean
+{
+
+namespace CV
+{
+
+std::atomic<uint32_t> CPUDispatch::level_(CPUDispatch::invalidLevel_);
+
+CPUDispatch::ISALevel CPUDispatch::supportedLevel()
+{
+	ISALevel result = IL_NONE;
+
+#if defined(OCEAN_HARDWARE_SSE_VERSION) && OCEAN_HARDWARE_SSE_VERSION >= 41
+	result = IL_SSE_4_1;
+#elif defined(OCEAN_HARDWARE_NEON_VERSION) && OCEAN_HARDWARE_NEON_VERSION >= 10
+	result = IL_NEON;
+#endif
+
+	const ProcessorInstructions instructions = Processor::get().instructions();
+
+#if defined(OCEAN_CV_DISPATCH_X86)
+	if ((instructions & PI_AVX_2) == PI_AVX_2)
+	{
+		result = IL_AVX_2;
+
+		if ((instructions & PI_AVX_512) == PI_AVX_512)
+		{
+			result = IL_AVX_512;
+		}
+	}
+#endif
+
+#if defined(OCEAN_HARDWARE_NEON_VERSION) && OCEAN_HARDWARE_NEON_VERSION >= 10
+	// the level is reported, so far the CV library does not contain any SVE kernel
+	if ((instructions & PI_SVE) == PI_SVE)
+	{
+		result = IL_SVE;
+	}
+#endif
+
+	OCEAN_SUPPRESS_UNUSED_WARNING(instructions);
+
+	return result;
+}
+
+bool CPUDispatch::forceLevel(const ISALevel isaLevel)
+{
+	const ISALevel supported = supportedLevel();
+
+	if (isaLevel != IL_NONE && (isARMLevel(supported) != isARMLevel(isaLevel) || isaLevel > supported))
+	{
+		return false;
+	}
+
+	level_.store(uint32_t(isaLevel), std::memory_order_relaxed);
+
+	return true;
+}
+
+void CPUDispatch::resetLevel()
+{
+	level_.store(invalidLevel_, std::memory_order_relaxed);
+}
+
+std::string CPUDispatch::translateLevel(const ISALevel isaLevel)
+{
+	switch (isaLevel)
+	{
+		case IL_NONE:
+			return std::string("none");
+
+		case IL_SSE_4_1:
+			return std::string("sse4.1");
+
+		case IL_AVX_2:
+			return std::string("avx2");
+
+		case IL_AVX_512:
+			return std::string("avx512");
+
+		case IL_NEON:
+			return std::string("neon");
+
+		case IL_SVE:
+			return std::string("sve");
+	}
+
+	ocean_assert(false && "Invalid level!");
+	return std::string("invalid");
+}
+
+bool CPUDispatch::translateLevel(const std::string& isaLevel, ISALevel& level)
+{
+	for (const ISALevel candidate : {IL_NONE, IL_SSE_4_1, IL_AVX_2, IL_AVX_512, IL_NEON, IL_SVE})
+	{
+		if (isaLevel == translateLevel(candidate))
+		{
+			level = candidate;
+			return true;
+		}
+	}
+
+	return false;
+}
+
+CPUDispatch::ISALevel CPUDispatch::initializeLevel()
+{
+	const ISALevel supported = supportedLevel();
+
+	uint32_t expected = invalidLevel_;
+
+	// a level which has been forced in the meantime is not overwritten
+	if (!level_.compare_exchange_strong(expected, uint32_t(supported), std::memory_order_relaxed))
+	{
+		return ISALevel(expected);
+	}
+
+	return supported;
+}
+
+}
+
+}
@@ -0,0 +1,181 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#ifndef META_OCEAN_CV_CPU_DISPATCH_H
+#define META_OCEAN_CV_CPU_DISPATCH_H
+
+#include "ocean/cv/CV.h"
+
+#include <atomic>
+
+// Defines OCEAN_CV_DISPATCH_X86 if the CV library contains AVX2 and AVX-512 kernels which are selected at runtime.
+#if !defined(OCEAN_CV_DISPATCH_X86) && defined(OCEAN_HARDWARE_SSE_VERSION) && OCEAN_HARDWARE_SSE_VERSION >= 41 && (defined(__x86_64__) || defined(_M_X64)) && !defined(OCEAN_CV_DISPATCH_DISABLED)
+	#define OCEAN_CV_DISPATCH_X86
+#endif
+
+// Defines OCEAN_CV_TARGET_AVX2 and OCEAN_CV_TARGET_AVX512 allowing to compile individual functions for a higher instruction set than the remaining binary.
+#if defined(OCEAN_CV_DISPATCH_X86) && (defined(__GNUC__) || defined(__clang__))
+	#define OCEAN_CV_TARGET_AVX2 __attribute__((target("avx2")))
+	#define OCEAN_CV_TARGET_AVX512 __attribute__((target("avx2,avx512f,avx512bw")))
+#else
+	// MSVC allows to use all intrinsics independent of the compiler flags
+	#define OCEAN_CV_TARGET_AVX2
+	#define OCEAN_CV_TARGET_AVX512
+#endif
+
+// Defines OCEAN_CV_NEON_FP16 if the CV library contains NEON kernels applying 16-bit float vector arithmetic, which is the case if the binary is compiled for ARMv8.2-A FP16.
+#if !defined(OCEAN_CV_NEON_FP16) && defined(OCEAN_HARDWARE_NEON_VERSION) && OCEAN_HARDWARE_NEON_VERSION >= 10 && defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC)
+	#define OCEAN_CV_NEON_FP16
+#endif
+
+namespace Ocean
+{
+
+namespace CV
+{
+
+/**
+ * This class implements the runtime selection of SIMD kernels.
+ * The compile-time flags OCEAN_HARDWARE_SSE_VERSION and OCEAN_HARDWARE_NEON_VERSION define the baseline instruction set of the binary.<br>
+ * Kernels for higher instruction sets (e.g., AVX2 or AVX-512) are compiled into the same library and are selected at runtime based on the features of the processor.<br>
+ * The processor features are determined once, the selected level can be forced to a lower level e.g., to benchmark individual kernels on the same machine.
+ * @ingroup cv
+ */
+class OCEAN_CV_EXPORT CPUDispatch
+{
+	public:
+
+		/**
+		 * Definition of individual instruction set levels.
+		 * Levels of the same family are ordered, a higher level implies all lower levels of the same family.
+		 */
+		enum ISALevel : uint32_t
+		{
+			/// No SIMD instructions, the plain C++ implementation is used.
+			IL_NONE = 0u,
+			/// SSE 4.1 instructions.
+			IL_SSE_4_1,
+			/// AVX2 instructions.
+			IL_AVX_2,
+			/// AVX-512 instructions (AVX-512F and AVX-512BW).
+			IL_AVX_512,
+			/// NEON instructions.
+			IL_NEON,
+			/// SVE instructions.
+			IL_SVE
+		};
+
+	public:
+
+		/**
+		 * Returns the instruction set level which is currently used to select kernels.
+		 * The level is determined once (unless forced), the function is thread-safe.
+		 * @return The current instruction set level
+		 * @see forceLevel().
+		 */
+		static inline ISALevel level();
+
+		/**
+		 * Returns whether kernels of a specified instruction set level can be used.
+		 * @param isaLevel The instruction set level to check
+		 * @return True, if the current level is of the same family and at least as high as the specified level; always true for IL_NONE
+		 */
+		static inline bool hasLevel(const ISALevel isaLevel);
+
+		/**
+		 * Returns the highest instruction set level this binary supports on the current processor.
+		 * The level takes the compile-time baseline and the runtime processor features (including forced processor instructions) into account.
+		 * @return The supported instruction set level
+		 */
+		static ISALevel supportedLevel();
+
+		/**
+		 * Forces a specific instruction set level e.g., for benchmarking or testing.
+		 * @param isaLevel The instruction set level to force, must be supported
+		 * @return True, if the level is supported and could be forced
+		 * @see resetLevel().
+		 */
+		static bool forceLevel(const ISALevel isaLevel);
+
+		/**
+		 * Removes a previously forced instruction set level so that the supported level is used again.
+		 */
+		static void resetLevel();
+
+		/**
+		 * Translates an instruction set level to a readable string.
+		 * @param isaLevel The level to translate
+		 * @return The readable string, e.g., "avx2"
+		 */
+		static std::string translateLevel(const ISALevel isaLevel);
+
+		/**
+		 * Translates a readable string to an instruction set level.
+		 * @param isaLevel The readable string, e.g., "avx2"
+		 * @param level The resulting level
+		 * @return True, if succeeded
+		 */
+		static bool translateLevel(const std::string& isaLevel, ISALevel& level);
+
+	protected:
+
+		/**
+		 * Determines the instruction set level and stores it as current level.
+		 * @return The current instruction set level
+		 */
+		static ISALevel initializeLevel();
+
+		/**
+		 * Returns whether an instruction set level belongs to the ARM family.
+		 * @param isaLevel The level to check
+		 * @return True, if so
+		 */
+		static constexpr bool isARMLevel(const ISALevel isaLevel);
+
+	protected:
+
+		/// The invalid level value, used before the level has been determined.
+		static constexpr uint32_t invalidLevel_ = uint32_t(-1);
+
+		/// The current instruction set level.
+		static std::atomic<uint32_t> level_;
+};
+
+inline CPUDispatch::ISALevel CPUDispatch::level()
+{
+	const uint32_t value = level_.load(std::memory_order_relaxed);
+
+	if (value != invalidLevel_)
+	{
+		return ISALevel(value);
+	}
+
+	return initializeLevel();
+}
+
+inline bool CPUDispatch::hasLevel(const ISALevel isaLevel)
+{
+	if (isaLevel == IL_NONE)
+	{
+		return true;
+	}
+
+	const ISALevel currentLevel = level();
+
+	return isARMLevel(currentLevel) == isARMLevel(isaLevel) && currentLevel >= isaLevel;
+}
+
+constexpr bool CPUDispatch::isARMLevel(const ISALevel isaLevel)
+{
+	return isaLevel == IL_NEON || isaLevel == IL_SVE;
+}
+
+}
+
+}
+
+#endif // META_OCEAN_CV_CPU_DISPATCH_H
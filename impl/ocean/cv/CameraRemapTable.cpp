@@ -0,0 +1,206 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "ocean/cv/CameraRemapTable.h"
+
+#include "ocean/base/Memory.h"
+
+namespace Ocean
+{
+
+namespace CV
+{
+
+CameraRemapTable::CameraRemapTable(const AnyCamera& sourceCamera, const SquareMatrix3& source_R_target, const AnyCamera& targetCamera, Worker* worker, const unsigned int binSizeInPixel)
+{
+	update(sourceCamera, source_R_target, targetCamera, worker, binSizeInPixel);
+}
+
+bool CameraRemapTable::update(const AnyCamera& sourceCamera, const SquareMatrix3& source_R_target, const AnyCamera& targetCamera, Worker* worker, const unsigned int binSizeInPixel)
+{
+	ocean_assert(sourceCamera.isValid() && targetCamera.isValid());
+	ocean_assert(source_R_target.isOrthonormal());
+	ocean_assert(binSizeInPixel >= 1u);
+
+	if (isValidFor(sourceCamera, source_R_target, targetCamera, binSizeInPixel))
+	{
+		return true;
+	}
+
+	release();
+
+	if (!sourceCamera.isValid() || !targetCamera.isValid() || binSizeInPixel == 0u)
+	{
+		return false;
+	}
+
+	if (sourceCamera.width() < 2u || sourceCamera.height() < 2u || sourceCamera.width() >= (unsigned int)(invalidLocation_) || sourceCamera.height() >= (unsigned int)(invalidLocation_))
+	{
+		ocean_assert(false && "Invalid source resolution!");
+		return false;
+	}
+
+	const FrameInterpolatorBilinear::LookupTable source_OLT_target = FrameInterpolatorBilinear::resampleCameraImageLookupTable(sourceCamera, source_R_target, targetCamera, binSizeInPixel);
+
+	entries_.resize(size_t(targetCamera.width()) * size_t(targetCamera.height()));
+
+	if (worker)
+	{
+		worker->executeFunction(Worker::Function::createStatic(&CameraRemapTable::createEntriesSubset, &source_OLT_target, sourceCamera.width(), sourceCamera.height(), entries_.data(), 0u, 0u), 0u, targetCamera.height(), 4u, 5u, 20u);
+	}
+	else
+	{
+		createEntriesSubset(&source_OLT_target, sourceCamera.width(), sourceCamera.height(), entries_.data(), 0u, targetCamera.height());
+	}
+
+	sourceCamera_ = SharedAnyCamera(sourceCamera.clone());
+	targetCamera_ = SharedAnyCamera(targetCamera.clone());
+	source_R_target_ = source_R_target;
+	binSizeInPixel_ = binSizeInPixel;
+
+	return true;
+}
+
+bool CameraRemapTable::isValidFor(const AnyCamera& sourceCamera, const SquareMatrix3& source_R_target, const AnyCamera& targetCamera, const unsigned int binSizeInPixel) const
+{
+	if (!isValid())
+	{
+		return false;
+	}
+
+	ocean_assert(sourceCamera_ && targetCamera_);
+
+	return binSizeInPixel_ == binSizeInPixel && source_R_target_.isEqual(source_R_target, Numeric::eps()) && sourceCamera_->isEqual(sourceCamera) && targetCamera_->isEqual(targetCamera);
+}
+
+bool CameraRemapTable::remap(const Frame& sourceFrame, Frame& targetFrame, Worker* worker, const uint8_t* borderColor) const
+{
+	ocean_assert(isValid());
+	ocean_assert(sourceFrame.isValid());
+
+	if (!isValid() || sourceFrame.width() != sourceWidth() || sourceFrame.height() != sourceHeight())
+	{
+		ocean_assert(false && "Invalid remap table or source frame!");
+		return false;
+	}
+
+	if (sourceFrame.numberPlanes() != 1u || sourceFrame.dataType() != FrameType::DT_UNSIGNED_INTEGER_8 || sourceFrame.pixelOrigin() != FrameType::ORIGIN_UPPER_LEFT)
+	{
+		ocean_assert(false && "Invalid frame type!");
+		return false;
+	}
+
+	if (!targetFrame.set(FrameType(sourceFrame.frameType(), targetWidth(), targetHeight()), false /*forceOwner*/, true /*forceWritable*/))
+	{
+		return false;
+	}
+
+	switch (sourceFrame.channels())
+	{
+		case 1u:
+			remap8BitPerChannel<1u>(sourceFrame.constdata<uint8_t>(), targetFrame.data<uint8_t>(), sourceFrame.paddingElements(), targetFrame.paddingElements(), worker, borderColor);
+			return true;
+
+		case 2u:
+			remap8BitPerChannel<2u>(sourceFrame.constdata<uint8_t>(), targetFrame.data<uint8_t>(), sourceFrame.paddingElements(), targetFrame.paddingElements(), worker, borderColor);
+			return true;
+
+		case 3u:
+			remap8BitPerChannel<3u>(sourceFrame.constdata<uint8_t>(), targetFrame.data<uint8_t>(), sourceFrame.paddingElements(), targetFrame.paddingElements(), worker, borderColor);
+			return true;
+
+		case 4u:
+			remap8BitPerChannel<4u>(sourceFrame.constdata<uint8_t>(), targetFrame.data<uint8_t>(), sourceFrame.paddingElements(), targetFrame.paddingElements(), worker, borderColor);
+			return true;
+	}
+
+	ocean_assert(false && "Invalid channel number!");
+	return false;
+}
+
+void CameraRemapTable::release()
+{
+	sourceCamera_ = nullptr;
+	targetCamera_ = nullptr;
+	source_R_target_ = SquareMatrix3(false);
+	binSizeInPixel_ = 0u;
+	entries_.clear();
+}
+
+void CameraRemapTable::createEntriesSubset(const FrameInterpolatorBilinear::LookupTable* source_OLT_target, const unsigned int sourceWidth, const unsigned int sourceHeight, Entry* entries, const unsigned int firstTargetRow, const unsigned int numberTargetRows)
+{
+	ocean_assert(source_OLT_target != nullptr && entries != nullptr);
+	ocean_assert(sourceWidth >= 2u && sourceWidth < (unsigned int)(invalidLocation_));
+	ocean_assert(sourceHeight >= 2u && sourceHeight < (unsigned int)(invalidLocation_));
+	ocean_assert(firstTargetRow + numberTargetRows <= source_OLT_target->sizeY());
+
+	const unsigned int targetWidth = (unsigned int)(source_OLT_target->sizeX());
+
+	const Scalar sourceWidth1 = Scalar(sourceWidth - 1u);
+	const Scalar sourceHeight1 = Scalar(sourceHeight - 1u);
+
+	Memory rowLookupMemory = Memory::create<Vector2>(targetWidth);
+	Vector2* const rowLookupData = rowLookupMemory.data<Vector2>();
+
+	for (unsigned int y = firstTargetRow; y < firstTargetRow + numberTargetRows; ++y)
+	{
+		source_OLT_target->bilinearValues(y, rowLookupData);
+
+		Entry* rowEntries = entries + y * targetWidth;
+
+		for (unsigned int x = 0u; x < targetWidth; ++x)
+		{
+			// the determination of the fixed-point parameters follows FrameInterpolatorBilinear::interpolatePixel8BitPerChannel() so that both results are identical
+
+			const Vector2 sourcePosition(Scalar(x) + rowLookupData[x].x(), Scalar(y) + rowLookupData[x].y());
+
+			Entry& entry = rowEntries[x];
+
+			if (sourcePosition.x() >= Scalar(0) && sourcePosition.y() >= Scalar(0) && sourcePosition.x() <= sourceWidth1 && sourcePosition.y() <= sourceHeight1)
+			{
+				unsigned int left = (unsigned int)(sourcePosition.x());
+				unsigned int top = (unsigned int)(sourcePosition.y());
+				ocean_assert(left < sourceWidth && top < sourceHeight);
+
+				unsigned int factorRight = (unsigned int)((sourcePosition.x() - Scalar(left)) * Scalar(128) + Scalar(0.5));
+				unsigned int factorBottom = (unsigned int)((sourcePosition.y() - Scalar(top)) * Scalar(128) + Scalar(0.5));
+				ocean_assert(factorRight <= 128u && factorBottom <= 128u);
+
+				// positions on the last column (or row) are shifted to the previous column (or row) so that the 2x2 neighborhood always lies inside the source image
+
+				if (left + 1u == sourceWidth)
+				{
+					ocean_assert(factorRight == 0u);
+
+					--left;
+					factorRight = 128u;
+				}
+
+				if (top + 1u == sourceHeight)
+				{
+					ocean_assert(factorBottom == 0u);
+
+					--top;
+					factorBottom = 128u;
+				}
+
+				entry.left_ = uint16_t(left);
+				entry.top_ = uint16_t(top);
+				entry.factorRight_ = uint8_t(factorRight);
+				entry.factorBottom_ = uint8_t(factorBottom);
+			}
+			else
+			{
+				entry = Entry();
+			}
+		}
+	}
+}
+
+}
+
+}
@@ -0,0 +1,543 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#ifndef META_OCEAN_CV_CAMERA_REMAP_TABLE_H
+#define META_OCEAN_CV_CAMERA_REMAP_TABLE_H
+
+#include "ocean/cv/CV.h"
+#include "ocean/cv/FrameInterpolatorBilinear.h"
+#include "ocean/cv/NEON.h"
+#include "ocean/cv/SSE.h"
+
+#include "ocean/base/DataType.h"
+#include "ocean/base/Frame.h"
+#include "ocean/base/Worker.h"
+
+#include "ocean/math/AnyCamera.h"
+#include "ocean/math/SquareMatrix3.h"
+
+namespace Ocean
+{
+
+namespace CV
+{
+
+/**
+ * This class implements a persistent remap table allowing to re-sample camera images captured with one camera profile as if they had been captured with a second camera profile.
+ * The table stores the bilinear interpolation parameters of each target pixel in fixed-point precision (the integer location of the top-left source pixel and two 7 bit interpolation factors).<br>
+ * Thus, the camera mapping (un-projecting and projecting of each ray) is determined once while the re-sampling of each individual frame is a pure gather and interpolate operation.<br>
+ * The table is keyed by the source camera, the target camera (including their resolutions), the rotation between both cameras, and the size of the approximation bins.<br>
+ * The re-sampled images are identical to the images created with FrameInterpolatorBilinear::Comfort::resampleCameraImage() for 8 bit frames.<br>
+ * Please note that this class is not thread-safe, an object must not be updated while it is used to re-sample images.
+ * @see FrameInterpolatorBilinear::Comfort::resampleCameraImage().
+ * @ingroup cv
+ */
+class OCEAN_CV_EXPORT CameraRemapTable
+{
+	public:
+
+		/**
+		 * Definition of the location value for target pixels without corresponding source pixel.
+		 */
+		static constexpr uint16_t invalidLocation_ = uint16_t(0xFFFFu);
+
+		/**
+		 * Definition of the fixed-point interpolation parameters for one target pixel.
+		 */
+		class Entry
+		{
+			public:
+
+				/// The horizontal location of the top-left source pixel, with range [0, sourceWidth - 2], invalidLocation_ if the target pixel does not have a corresponding source pixel.
+				uint16_t left_ = invalidLocation_;
+
+				/// The vertical location of the top-left source pixel, with range [0, sourceHeight - 2].
+				uint16_t top_ = invalidLocation_;
+
+				/// The horizontal interpolation factor of the right source pixels, with range [0, 128].
+				uint8_t factorRight_ = 0u;
+
+				/// The vertical interpolation factor of the bottom source pixels, with range [0, 128].
+				uint8_t factorBottom_ = 0u;
+		};
+
+		/**
+		 * Definition of a vector holding entries.
+		 */
+		using Entries = std::vector<Entry>;
+
+	public:
+
+		/**
+		 * Creates an invalid remap table.
+		 */
+		CameraRemapTable() = default;
+
+		/**
+		 * Creates a new remap table for a pair of camera profiles.
+		 * @param sourceCamera The source camera profile which will be used to capture the source images, with resolution [2, 65535] x [2, 65535], must be valid
+		 * @param source_R_target The rotation transforming 3D points defined in the coordinate system of the target camera to 3D points defined in the coordinate system of the source camera, must be valid
+		 * @param targetCamera The camera profile of the target images, must be valid
+		 * @param worker Optional worker object to distribute the computation
+		 * @param binSizeInPixel The size in pixel of the interpolation bins used to approximate the camera mapping, with range [1, infinity)
+		 * @see update().
+		 */
+		CameraRemapTable(const AnyCamera& sourceCamera, const SquareMatrix3& source_R_target, const AnyCamera& targetCamera, Worker* worker = nullptr, const unsigned int binSizeInPixel = 8u);
+
+		/**
+		 * Updates the remap table for a pair of camera profiles.
+		 * The table is determined only if the given key (cameras, rotation, bin size) differs from the key of the current table, otherwise the function returns immediately.
+		 * @param sourceCamera The source camera profile which will be used to capture the source images, with resolution [2, 65535] x [2, 65535], must be valid
+		 * @param source_R_target The rotation transforming 3D points defined in the coordinate system of the target camera to 3D points defined in the coordinate system of the source camera, must be valid
+		 * @param targetCamera The camera profile of the target images, must be valid
+		 * @param worker Optional worker object to distribute the computation
+		 * @param binSizeInPixel The size in pixel of the interpolation bins used to approximate the camera mapping, with range [1, infinity)
+		 * @return True, if succeeded
+		 */
+		bool update(const AnyCamera& sourceCamera, const SquareMatrix3& source_R_target, const AnyCamera& targetCamera, Worker* worker = nullptr, const unsigned int binSizeInPixel = 8u);
+
+		/**
+		 * Returns whether this remap table has been determined for a specific key.
+		 * @param sourceCamera The source camera profile to check
+		 * @param source_R_target The rotation between target and source camera to check
+		 * @param targetCamera The target camera profile to check
+		 * @param binSizeInPixel The size in pixel of the interpolation bins to check
+		 * @return True, if so
+		 */
+		bool isValidFor(const AnyCamera& sourceCamera, const SquareMatrix3& source_R_target, const AnyCamera& targetCamera, const unsigned int binSizeInPixel = 8u) const;
+
+		/**
+		 * Re-samples a camera image with this remap table.
+		 * @param sourceFrame The source image captured with the source camera profile, with pixel format DT_UNSIGNED_INTEGER_8 with 1-4 channels and resolution sourceWidth() x sourceHeight(), must be valid
+		 * @param targetFrame The resulting target image, with resolution targetWidth() x targetHeight(), will be modified if the frame type does not match
+		 * @param worker Optional worker object to distribute the computation
+		 * @param borderColor The color of target pixels without corresponding source pixel, one value for each channel, nullptr to use 0x00 for each channel
+		 * @return True, if succeeded
+		 */
+		bool remap(const Frame& sourceFrame, Frame& targetFrame, Worker* worker = nullptr, const uint8_t* borderColor = nullptr) const;
+
+		/**
+		 * Re-samples a camera image with 8 bit per channel with this remap table.
+		 * @param source The source image captured with the source camera profile, with resolution sourceWidth() x sourceHeight(), must be valid
+		 * @param target The resulting target image, with resolution targetWidth() x targetHeight(), must be valid
+		 * @param sourcePaddingElements The number of padding elements at the end of each source row, in elements, with range [0, infinity)
+		 * @param targetPaddingElements The number of padding elements at the end of each target row, in elements, with range [0, infinity)
+		 * @param worker Optional worker object to distribute the computation
+		 * @param borderColor The color of target pixels without corresponding source pixel, tChannels values, nullptr to use 0x00 for each channel
+		 * @tparam tChannels The number of frame channels, with range [1, infinity)
+		 */
+		template <unsigned int tChannels>
+		inline void remap8BitPerChannel(const uint8_t* source, uint8_t* target, const unsigned int sourcePaddingElements, const unsigned int targetPaddingElements, Worker* worker = nullptr, const uint8_t* borderColor = nullptr) const;
+
+		/**
+		 * Returns the width of the source images this table expects.
+		 * @return The source width in pixel, 0 if invalid
+		 */
+		inline unsigned int sourceWidth() const;
+
+		/**
+		 * Returns the height of the source images this table expects.
+		 * @return The source height in pixel, 0 if invalid
+		 */
+		inline unsigned int sourceHeight() const;
+
+		/**
+		 * Returns the width of the target images this table creates.
+		 * @return The target width in pixel, 0 if invalid
+		 */
+		inline unsigned int targetWidth() const;
+
+		/**
+		 * Returns the height of the target images this table creates.
+		 * @return The target height in pixel, 0 if invalid
+		 */
+		inline unsigned int targetHeight() const;
+
+		/**
+		 * Returns the fixed-point entries of this table, one entry for each target pixel in row-major order.
+		 * @return The table's entries
+		 */
+		inline const Entries& entries() const;
+
+		/**
+		 * Releases this remap table.
+		 */
+		void release();
+
+		/**
+		 * Returns whether this remap table is valid.
+		 * @return True, if so
+		 */
+		inline bool isValid() const;
+
+		/**
+		 * Returns whether this remap table is valid.
+		 * @return True, if so
+		 */
+		explicit inline operator bool() const;
+
+	protected:
+
+		/**
+		 * Converts a subset of an offset lookup table to fixed-point entries.
+		 * @param source_OLT_target The offset lookup table between target and source image points, must be valid
+		 * @param sourceWidth The width of the source images in pixel, with range [2, 65535]
+		 * @param sourceHeight The height of the source images in pixel, with range [2, 65535]
+		 * @param entries The resulting entries, one for each target pixel, must be valid
+		 * @param firstTargetRow The first target row to be handled, with range [0, source_OLT_target->sizeY() - 1]
+		 * @param numberTargetRows The number of target rows to be handled, with range [1, source_OLT_target->sizeY() - firstTargetRow]
+		 */
+		static void createEntriesSubset(const FrameInterpolatorBilinear::LookupTable* source_OLT_target, const unsigned int sourceWidth, const unsigned int sourceHeight, Entry* entries, const unsigned int firstTargetRow, const unsigned int numberTargetRows);
+
+		/**
+		 * Re-samples a subset of a camera image with 8 bit per channel.
+		 * @param entries The fixed-point entries of the remap table, one for each target pixel, must be valid
+		 * @param source The source image, must be valid
+		 * @param target The target image, must be valid
+		 * @param sourceWidth The width of the source image in pixel, with range [2, 65535]
+		 * @param targetWidth The width of the target image in pixel, with range [1, infinity)
+		 * @param sourcePaddingElements The number of padding elements at the end of each source row, in elements, with range [0, infinity)
+		 * @param targetPaddingElements The number of padding elements at the end of each target row, in elements, with range [0, infinity)
+		 * @param borderColor The color of target pixels without corresponding source pixel, tChannels values, must be valid
+		 * @param firstTargetRow The first target row to be handled, with range [0, targetHeight - 1]
+		 * @param numberTargetRows The number of target rows to be handled, with range [1, targetHeight - firstTargetRow]
+		 * @tparam tChannels The number of frame channels, with range [1, infinity)
+		 */
+		template <unsigned int tChannels>
+		static void remap8BitPerChannelSubset(const Entry* entries, const uint8_t* source, uint8_t* target, const unsigned int sourceWidth, const unsigned int targetWidth, const unsigned int sourcePaddingElements, const unsigned int targetPaddingElements, const uint8_t* borderColor, const unsigned int firstTargetRow, const unsigned int numberTargetRows);
+
+		/**
+		 * Interpolates one target pixel with 8 bit per channel.
+		 * @param entry The fixed-point entry of the target pixel, must be valid
+		 * @param source The source image, must be valid
+		 * @param sourceStrideElements The number of elements between two source rows, in elements, with range [tChannels * sourceWidth, infinity)
+		 * @param targetPixel The resulting target pixel, must be valid
+		 * @tparam tChannels The number of frame channels, with range [1, infinity)
+		 */
+		template <unsigned int tChannels>
+		static OCEAN_FORCE_INLINE void interpolatePixel8BitPerChannel(const Entry& entry, const uint8_t* source, const unsigned int sourceStrideElements, uint8_t* targetPixel);
+
+#if (defined(OCEAN_HARDWARE_SSE_VERSION) && OCEAN_HARDWARE_SSE_VERSION >= 41) || (defined(OCEAN_HARDWARE_NEON_VERSION) && OCEAN_HARDWARE_NEON_VERSION >= 10)
+
+		/**
+		 * Interpolates four consecutive target pixels of a 1-channel 8 bit image.
+		 * All four entries must be valid.
+		 * @param entries The four fixed-point entries of the target pixels, must be valid
+		 * @param source The source image, must be valid
+		 * @param sourceStrideElements The number of elements between two source rows, in elements, with range [sourceWidth, infinity)
+		 * @param targetPixels The resulting four target pixels, must be valid
+		 */
+		static OCEAN_FORCE_INLINE void interpolate4Pixels1Channel8Bit(const Entry* entries, const uint8_t* source, const unsigned int sourceStrideElements, uint8_t* targetPixels);
+
+#endif
+
+	protected:
+
+		/// The source camera profile of this table, nullptr if invalid.
+		SharedAnyCamera sourceCamera_;
+
+		/// The target camera profile of this table, nullptr if invalid.
+		SharedAnyCamera targetCamera_;
+
+		/// The rotation between target and source camera.
+		SquareMatrix3 source_R_target_ = SquareMatrix3(false);
+
+		/// The size of the interpolation bins which have been used to create the table, 0 if invalid.
+		unsigned int binSizeInPixel_ = 0u;
+
+		/// The fixed-point entries, one for each target pixel.
+		Entries entries_;
+};
+
+template <unsigned int tChannels>
+inline void CameraRemapTable::remap8BitPerChannel(const uint8_t* source, uint8_t* target, const unsigned int sourcePaddingElements, const unsigned int targetPaddingElements, Worker* worker, const uint8_t* borderColor) const
+{
+	static_assert(tChannels >= 1u, "Invalid channel number!");
+
+	ocean_assert(isValid());
+	ocean_assert(source != nullptr && target != nullptr);
+
+	const uint8_t zeroColor[tChannels] = {0u};
+
+	if (borderColor == nullptr)
+	{
+		borderColor = zeroColor;
+	}
+
+	if (worker)
+	{
+		worker->executeFunction(Worker::Function::createStatic(&CameraRemapTable::remap8BitPerChannelSubset<tChannels>, entries_.data(), source, target, sourceWidth(), targetWidth(), sourcePaddingElements, targetPaddingElements, borderColor, 0u, 0u), 0u, targetHeight(), 8u, 9u, 20u);
+	}
+	else
+	{
+		remap8BitPerChannelSubset<tChannels>(entries_.data(), source, target, sourceWidth(), targetWidth(), sourcePaddingElements, targetPaddingElements, borderColor, 0u, targetHeight());
+	}
+}
+
+inline unsigned int CameraRemapTable::sourceWidth() const
+{
+	return sourceCamera_ ? sourceCamera_->width() : 0u;
+}
+
+inline unsigned int CameraRemapTable::sourceHeight() const
+{
+	return sourceCamera_ ? sourceCamera_->height() : 0u;
+}
+
+inline unsigned int CameraRemapTable::targetWidth() const
+{
+	return targetCamera_ ? targetCamera_->width() : 0u;
+}
+
+inline unsigned int CameraRemapTable::targetHeight() const
+{
+	return targetCamera_ ? targetCamera_->height() : 0u;
+}
+
+inline const CameraRemapTable::Entries& CameraRemapTable::entries() const
+{
+	return entries_;
+}
+
+inline bool CameraRemapTable::isValid() const
+{
+	return !entries_.empty();
+}
+
+inline CameraRemapTable::operator bool() const
+{
+	return isValid();
+}
+
+template <unsigned int tChannels>
+void CameraRemapTable::remap8BitPerChannelSubset(const Entry* entries, const uint8_t* source, uint8_t* target, const unsigned int sourceWidth, const unsigned int targetWidth, const unsigned int sourcePaddingElements, const unsigned int targetPaddingElements, const uint8_t* borderColor, const unsigned int firstTargetRow, const unsigned int numberTargetRows)
+{
+	static_assert(tChannels >= 1u, "Invalid channel number!");
+
+	ocean_assert(entries != nullptr && source != nullptr && target != nullptr);
+	ocean_assert(sourceWidth >= 2u && targetWidth >= 1u);
+	ocean_assert(borderColor != nullptr);
+
+	const unsigned int sourceStrideElements = sourceWidth * tChannels + sourcePaddingElements;
+	const unsigned int targetStrideElements = targetWidth * tChannels + targetPaddingElements;
+
+	for (unsigned int y = firstTargetRow; y < firstTargetRow + numberTargetRows; ++y)
+	{
+		const Entry* rowEntries = entries + y * targetWidth;
+		uint8_t* targetRow = target + y * targetStrideElements;
+
+		unsigned int x = 0u;
+
+#if (defined(OCEAN_HARDWARE_SSE_VERSION) && OCEAN_HARDWARE_SSE_VERSION >= 41) || (defined(OCEAN_HARDWARE_NEON_VERSION) && OCEAN_HARDWARE_NEON_VERSION >= 10)
+
+		if constexpr (tChannels == 1u)
+		{
+			while (x + 4u <= targetWidth)
+			{
+				if (rowEntries[x + 0u].left_ != invalidLocation_ && rowEntries[x + 1u].left_ != invalidLocation_ && rowEntries[x + 2u].left_ != invalidLocation_ && rowEntries[x + 3u].left_ != invalidLocation_)
+				{
+					interpolate4Pixels1Channel8Bit(rowEntries + x, source, sourceStrideElements, targetRow + x);
+					x += 4u;
+				}
+				else
+				{
+					// at least one of the four pixels is a border pixel, we handle one pixel individually
+
+					if (rowEntries[x].left_ != invalidLocation_)
+					{
+						interpolatePixel8BitPerChannel<1u>(rowEntries[x], source, sourceStrideElements, targetRow + x);
+					}
+					else
+					{
+						targetRow[x] = borderColor[0];
+					}
+
+					++x;
+				}
+			}
+		}
+
+#endif // OCEAN_HARDWARE_SSE_VERSION >= 41 || OCEAN_HARDWARE_NEON_VERSION >= 10
+
+		for (; x < targetWidth; ++x)
+		{
+			uint8_t* const targetPixel = targetRow + x * tChannels;
+
+			if (rowEntries[x].left_ != invalidLocation_)
+			{
+				interpolatePixel8BitPerChannel<tChannels>(rowEntries[x], source, sourceStrideElements, targetPixel);
+			}
+			else
+			{
+				for (unsigned int n = 0u; n < tChannels; ++n)
+				{
+					targetPixel[n] = borderColor[n];
+				}
+			}
+		}
+	}
+}
+
+template <unsigned int tChannels>
+OCEAN_FORCE_INLINE void CameraRemapTable::interpolatePixel8BitPerChannel(const Entry& entry, const uint8_t* source, const unsigned int sourceStrideElements, uint8_t* targetPixel)
+{
+	static_assert(tChannels >= 1u, "Invalid channel number!");
+
+	ocean_assert(entry.left_ != invalidLocation_);
+	ocean_assert(entry.factorRight_ <= 128u && entry.factorBottom_ <= 128u);
+
+	const unsigned int factorRight = entry.factorRight_;
+	const unsigned int factorLeft = 128u - factorRight;
+
+	const unsigned int factorBottom = entry.factorBottom_;
+	const unsigned int factorTop = 128u - factorBottom;
+
+	const unsigned int factorTopLeft = factorLeft * factorTop;
+	const unsigned int factorTopRight = factorRight * factorTop;
+	const unsigned int factorBottomLeft = factorLeft * factorBottom;
+	const unsigned int factorBottomRight = factorRight * factorBottom;
+
+	const uint8_t* const sourceTop = source + entry.top_ * sourceStrideElements + entry.left_ * tChannels;
+	const uint8_t* const sourceBottom = sourceTop + sourceStrideElements;
+
+	for (unsigned int n = 0u; n < tChannels; ++n)
+	{
+		targetPixel[n] = uint8_t((sourceTop[n] * factorTopLeft + sourceTop[tChannels + n] * factorTopRight + sourceBottom[n] * factorBottomLeft + sourceBottom[tChannels + n] * factorBottomRight + 8192u) >> 14u);
+	}
+}
+
+#if defined(OCEAN_HARDWARE_SSE_VERSION) && OCEAN_HARDWARE_SSE_VERSION >= 41
+
+OCEAN_FORCE_INLINE void CameraRemapTable::interpolate4Pixels1Channel8Bit(const Entry* entries, const uint8_t* source, const unsigned int sourceStrideElements, uint8_t* targetPixels)
+{
+	ocean_assert(entries != nullptr && source != nullptr && targetPixels != nullptr);
+
+	// we gather the 2x2 source pixels of each target pixel as four consecutive bytes: top-left, top-right, bottom-left, bottom-right
+	// and the corresponding four 16 bit interpolation factors
+
+	uint32_t pixels[4];
+	int16_t factors[16];
+
+	for (unsigned int n = 0u; n < 4u; ++n)
+	{
+		const Entry& entry = entries[n];
+		ocean_assert(entry.left_ != invalidLocation_);
+
+		const uint8_t* const sourceTop = source + entry.top_ * sourceStrideElements + entry.left_;
+
+		uint16_t topPixels;
+		uint16_t bottomPixels;
+		memcpy(&topPixels, sourceTop, sizeof(uint16_t));
+		memcpy(&bottomPixels, sourceTop + sourceStrideElements, sizeof(uint16_t));
+
+		pixels[n] = uint32_t(topPixels) | (uint32_t(bottomPixels) << 16u);
+
+		const int16_t factorRight = int16_t(entry.factorRight_);
+		const int16_t factorLeft = int16_t(128 - factorRight);
+
+		const int16_t factorBottom = int16_t(entry.factorBottom_);
+		const int16_t factorTop = int16_t(128 - factorBottom);
+
+		factors[n * 4u + 0u] = int16_t(factorLeft * factorTop);
+		factors[n * 4u + 1u] = int16_t(factorRight * factorTop);
+		factors[n * 4u + 2u] = int16_t(factorLeft * factorBottom);
+		factors[n * 4u + 3u] = int16_t(factorRight * factorBottom);
+	}
+
+	const __m128i pixels_u_8x16 = _mm_loadu_si128((const __m128i*)(pixels));
+
+	const __m128i pixels01_s_16x8 = _mm_unpacklo_epi8(pixels_u_8x16, _mm_setzero_si128());
+	const __m128i pixels23_s_16x8 = _mm_unpackhi_epi8(pixels_u_8x16, _mm_setzero_si128());
+
+	// the factors are in range [0, 16384], each product is in range [0, 255 * 16384]
+
+	const __m128i products01_s_32x4 = _mm_madd_epi16(pixels01_s_16x8, _mm_loadu_si128((const __m128i*)(factors + 0)));
+	const __m128i products23_s_32x4 = _mm_madd_epi16(pixels23_s_16x8, _mm_loadu_si128((const __m128i*)(factors + 8)));
+
+	const __m128i sums_s_32x4 = _mm_hadd_epi32(products01_s_32x4, products23_s_32x4);
+
+	const __m128i results_s_32x4 = _mm_srli_epi32(_mm_add_epi32(sums_s_32x4, _mm_set1_epi32(8192)), 14);
+
+	const __m128i results_u_8x16 = _mm_packus_epi16(_mm_packs_epi32(results_s_32x4, results_s_32x4), _mm_setzero_si128());
+
+	const uint32_t results = uint32_t(_mm_cvtsi128_si32(results_u_8x16));
+	memcpy(targetPixels, &results, sizeof(uint32_t));
+}
+
+#elif defined(OCEAN_HARDWARE_NEON_VERSION) && OCEAN_HARDWARE_NEON_VERSION >= 10
+
+OCEAN_FORCE_INLINE void CameraRemapTable::interpolate4Pixels1Channel8Bit(const Entry* entries, const uint8_t* source, const unsigned int sourceStrideElements, uint8_t* targetPixels)
+{
+	ocean_assert(entries != nullptr && source != nullptr && targetPixels != nullptr);
+
+	// we gather the 2x2 source pixels of each target pixel as four consecutive bytes: top-left, top-right, bottom-left, bottom-right
+	// and the corresponding four 16 bit interpolation factors
+
+	uint32_t pixels[4];
+	uint16_t factors[16];
+
+	for (unsigned int n = 0u; n < 4u; ++n)
+	{
+		const Entry& entry = entries[n];
+		ocean_assert(entry.left_ != invalidLocation_);
+
+		const uint8_t* const sourceTop = source + entry.top_ * sourceStrideElements + entry.left_;
+
+		uint16_t topPixels;
+		uint16_t bottomPixels;
+		memcpy(&topPixels, sourceTop, sizeof(uint16_t));
+		memcpy(&bottomPixels, sourceTop + sourceStrideElements, sizeof(uint16_t));
+
+		pixels[n] = uint32_t(topPixels) | (uint32_t(bottomPixels) << 16u);
+
+		const uint16_t factorRight = uint16_t(entry.factorRight_);
+		const uint16_t factorLeft = uint16_t(128u - factorRight);
+
+		const uint16_t factorBottom = uint16_t(entry.factorBottom_);
+		const uint16_t factorTop = uint16_t(128u - factorBottom);
+
+		factors[n * 4u + 0u] = uint16_t(factorLeft * factorTop);
+		factors[n * 4u + 1u] = uint16_t(factorRight * factorTop);
+		factors[n * 4u + 2u] = uint16_t(factorLeft * factorBottom);
+		factors[n * 4u + 3u] = uint16_t(factorRight * factorBottom);
+	}
+
+	const uint8x16_t pixels_u_8x16 = vld1q_u8((const uint8_t*)(pixels));
+
+	const uint16x8_t pixels01_u_16x8 = vmovl_u8(vget_low_u8(pixels_u_8x16));
+	const uint16x8_t pixels23_u_16x8 = vmovl_u8(vget_high_u8(pixels_u_8x16));
+
+	const uint16x8_t factors01_u_16x8 = vld1q_u16(factors + 0);
+	const uint16x8_t factors23_u_16x8 = vld1q_u16(factors + 8);
+
+	// each product is in range [0, 255 * 16384]
+
+	const uint32x4_t products0_u_32x4 = vmull_u16(vget_low_u16(pixels01_u_16x8), vget_low_u16(factors01_u_16x8));
+	const uint32x4_t products1_u_32x4 = vmull_u16(vget_high_u16(pixels01_u_16x8), vget_high_u16(factors01_u_16x8));
+	const uint32x4_t products2_u_32x4 = vmull_u16(vget_low_u16(pixels23_u_16x8), vget_low_u16(factors23_u_16x8));
+	const uint32x4_t products3_u_32x4 = vmull_u16(vget_high_u16(pixels23_u_16x8), vget_high_u16(factors23_u_16x8));
+
+	const uint32x2_t sums01_u_32x2 = vpadd_u32(vpadd_u32(vget_low_u32(products0_u_32x4), vget_high_u32(products0_u_32x4)), vpadd_u32(vget_low_u32(products1_u_32x4), vget_high_u32(products1_u_32x4)));
+	const uint32x2_t sums23_u_32x2 = vpadd_u32(vpadd_u32(vget_low_u32(products2_u_32x4), vget_high_u32(products2_u_32x4)), vpadd_u32(vget_low_u32(products3_u_32x4), vget_high_u32(products3_u_32x4)));
+
+	// (sum + 8192) / 16384
+
+	const uint16x4_t results_u_16x4 = vrshrn_n_u32(vcombine_u32(sums01_u_32x2, sums23_u_32x2), 14);
+
+	const uint8x8_t results_u_8x8 = vmovn_u16(vcombine_u16(results_u_16x4, results_u_16x4));
+
+	const uint32_t results = vget_lane_u32(vreinterpret_u32_u8(results_u_8x8), 0);
+	memcpy(targetPixels, &results, sizeof(uint32_t));
+}
+
+#endif // OCEAN_HARDWARE_NEON_VERSION >= 10
+
+}
+
+}
+
+#endif // META_OCEAN_CV_CAMERA_REMAP_TABLE_H
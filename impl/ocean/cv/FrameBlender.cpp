@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "ocean/cv/FrameBlender.h"
+
+namespace Ocean
+{
+
+namespace CV
+{
+
+bool FrameBlender::blendPremultiplied(const Frame& sourceWithAlpha, Frame& target, Worker* worker)
+{
+	if (!sourceWithAlpha.isValid() || !target.isValid() || sourceWithAlpha.width() != target.width() || sourceWithAlpha.height() != target.height()
+		|| sourceWithAlpha.pixelOrigin() != target.pixelOrigin()
+		|| (sourceWithAlpha.pixelFormat() != target.pixelFormat() && FrameType::formatRemoveAlphaChannel(sourceWithAlpha.pixelFormat()) != target.pixelFormat()))
+	{
+		ocean_assert(false && "Invalid pixel format!");
+		return false;
+	}
+
+	bool alphaIsLastChannel = false;
+
+	if (sourceWithAlpha.numberPlanes() != 1u || sourceWithAlpha.dataType() != FrameType::DT_UNSIGNED_INTEGER_8 || !FrameType::formatHasAlphaChannel(sourceWithAlpha.pixelFormat(), &alphaIsLastChannel))
+	{
+		ocean_assert(false && "Invalid pixel format!");
+		return false;
+	}
+
+	const bool targetHasAlpha = sourceWithAlpha.pixelFormat() == target.pixelFormat();
+
+	const uint8_t* const source = sourceWithAlpha.constdata<uint8_t>();
+	uint8_t* const targetData = target.data<uint8_t>();
+
+	const unsigned int width = sourceWithAlpha.width();
+	const unsigned int height = sourceWithAlpha.height();
+
+	const unsigned int sourcePaddingElements = sourceWithAlpha.paddingElements();
+	const unsigned int targetPaddingElements = target.paddingElements();
+
+	switch (sourceWithAlpha.channels())
+	{
+		case 2u:
+		{
+			if (alphaIsLastChannel)
+			{
+				if (targetHasAlpha)
+				{
+					blendPremultiplied8BitPerChannel<2u, false, true>(source, targetData, width, height, sourcePaddingElements, targetPaddingElements, worker);
+				}
+				else
+				{
+					blendPremultiplied8BitPerChannel<2u, false, false>(source, targetData, width, height, sourcePaddingElements, targetPaddingElements, worker);
+				}
+			}
+			else
+			{
+				if (targetHasAlpha)
+				{
+					blendPremultiplied8BitPerChannel<2u, true, true>(source, targetData, width, height, sourcePaddingElements, targetPaddingElements, worker);
+				}
+				else
+				{
+					blendPremultiplied8BitPerChannel<2u, true, false>(source, targetData, width, height, sourcePaddingElements, targetPaddingElements, worker);
+				}
+			}
+
+			return true;
+		}
+
+		case 3u:
+		{
+			if (alphaIsLastChannel)
+			{
+				if (targetHasAlpha)
+				{
+					blendPremultiplied8BitPerChannel<3u, false, true>(source, targetData, width, height, sourcePaddingElements, targetPaddingElements, worker);
+				}
+				else
+				{
+					blendPremultiplied8BitPerChannel<3u, false, false>(source, targetData, width, height, sourcePaddingElements, targetPaddingElements, worker);
+				}
+			}
+			else
+			{
+				if (targetHasAlpha)
+				{
+					blendPremultiplied8BitPerChannel<3u, true, true>(source, targetData, width, height, sourcePaddingElements, targetPaddingElements, worker);
+				}
+				else
+				{
+					blendPremultiplied8BitPerChannel<3u, true, false>(source, targetData, width, height, sourcePaddingElements, targetPaddingElements, worker);
+				}
+			}
+
+			return true;
+		}
+
+		case 4u:
+		{
+			if (alphaIsLastChannel)
+			{
+				if (targetHasAlpha)
+				{
+					blendPremultiplied8BitPerChannel<4u, false, true>(source, targetData, width, height, sourcePaddingElements, targetPaddingElements, worker);
+				}
+				else
+				{
+					blendPremultiplied8BitPerChannel<4u, false, false>(source, targetData, width, height, sourcePaddingElements, targetPaddingElements, worker);
+				}
+			}
+			else
+			{
+				if (targetHasAlpha)
+				{
+					blendPremultiplied8BitPerChannel<4u, true, true>(source, targetData, width, height, sourcePaddingElements, targetPaddingElements, worker);
+				}
+				else
+				{
+					blendPremultiplied8BitPerChannel<4u, true, false>(source, targetData, width, height, sourcePaddingElements, targetPaddingElements, worker);
+				}
+			}
+
+			return true;
+		}
+	}
+
+	ocean_assert(false && "Invalid pixel format!");
+	return false;
+}
+
+}
+
+}
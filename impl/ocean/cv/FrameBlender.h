@@ -16,6 +16,14 @@
 #include "ocean/base/Utilities.h"
 #include "ocean/base/Worker.h"
 
+#if defined(OCEAN_HARDWARE_SSE_VERSION) && OCEAN_HARDWARE_SSE_VERSION >= 41
+	#include "ocean/cv/SSE.h"
+#endif
+
+#if defined(OCEAN_HARDWARE_NEON_VERSION) && OCEAN_HARDWARE_NEON_VERSION >= 10
+	#include "ocean/cv/NEON.h"
+#endif
+
 namespace Ocean
 {
 
@@ -203,6 +211,22 @@ class OCEAN_CV_EXPORT FrameBlender
 		template <bool tTransparentIs0xFF, FrameBlender::AlphaTargetModulation tAlphaTargetModulation>
 		static bool blend(const Frame& sourceWithAlpha, Frame& target, const unsigned int sourceLeft, const unsigned int sourceTop, const unsigned int targetLeft, const unsigned int targetTop, const unsigned int width, const unsigned int height, Worker* worker = nullptr);
 
+		/**
+		 * Blends an entire source frame holding a premultiplied alpha channel with a target frame.
+		 * The data channels of the source frame are expected to be multiplied with the source alpha value already, 0x00 is interpreted as fully transparent.<br>
+		 * The blend function is defined as follows:
+		 * <pre>
+		 * targetPixel = sourcePixel + targetPixel * (0xFF - sourceAlpha)
+		 * </pre>
+		 * If the target frame holds an alpha channel, the target alpha value is blended in the same way.<br>
+		 * Both frames must have the same frame dimension and pixel origin, valid combinations of pixel formats are e.g. (FORMAT_RGBA32, FORMAT_RGBA32) or (FORMAT_RGBA32, FORMAT_RGB24).
+		 * @param sourceWithAlpha Source frame with premultiplied alpha channel, must be valid
+		 * @param target The target frame with or without alpha channel, must be valid
+		 * @param worker Optional worker object to distribute the computation
+		 * @return True, if succeeded
+		 */
+		static bool blendPremultiplied(const Frame& sourceWithAlpha, Frame& target, Worker* worker = nullptr);
+
 		/**
 		 * Blends two 8 bit per channel frames with same frame type by application of one unique blending factor for all pixels.
 		 * The blend function is defined as follows:
@@ -263,6 +287,23 @@ class OCEAN_CV_EXPORT FrameBlender
 		template <unsigned int tChannelsWithAlpha, bool tAlphaAtFront, bool tTargetHasAlpha, bool tTransparentIs0xFF, AlphaTargetModulation tAlphaTargetModulation>
 		static inline void blend8BitPerChannel(const uint8_t* sourceWithAlpha, uint8_t* target, const unsigned int width, const unsigned int height, const unsigned int sourceWithAlphaPaddingElements, const unsigned int targetPaddingElements, Worker* worker = nullptr);
 
+		/**
+		 * Blends an entire source frame holding a premultiplied alpha channel with a target frame while the alpha channel is in front of the data channels or behind the data channels.
+		 * @param sourceWithAlpha Source frame with premultiplied alpha channel, 0x00 is interpreted as fully transparent, must be valid
+		 * @param target The target frame which may also hold an alpha channel depending on tTargetHasAlpha, must be valid
+		 * @param width The width of both frames in pixel, with range [1, infinity)
+		 * @param height The height of both frames in pixel, with range [1, infinity)
+		 * @param sourceWithAlphaPaddingElements The number of padding elements at the end of each source row, in elements, with range [0, infinity)
+		 * @param targetPaddingElements The number of padding elements at the end of each target row, in elements, with range [0, infinity)
+		 * @param worker Optional worker object to distribute the computation
+		 * @tparam tChannelsWithAlpha Number of channels in the source frame (including the alpha channel), with range [2, infinity)
+		 * @tparam tAlphaAtFront True, if the alpha channel is in the front of the data channels
+		 * @tparam tTargetHasAlpha True, if the target frame holds an alpha channel as well which will be blended like the data channels
+		 * @see blendPremultiplied().
+		 */
+		template <unsigned int tChannelsWithAlpha, bool tAlphaAtFront, bool tTargetHasAlpha>
+		static inline void blendPremultiplied8BitPerChannel(const uint8_t* sourceWithAlpha, uint8_t* target, const unsigned int width, const unsigned int height, const unsigned int sourceWithAlphaPaddingElements, const unsigned int targetPaddingElements, Worker* worker = nullptr);
+
 		/**
 		 * Blends a target frame with a specified constant value for all pixels, while each pixel might have a different blending factor.
 		 * @param alpha The alpha frame defining the value blending factor that is applied for each pixel, must be valid
@@ -434,6 +475,59 @@ class OCEAN_CV_EXPORT FrameBlender
 		template <unsigned int tChannelsWithAlpha, bool tAlphaAtFront, bool tTargetHasAlpha, bool tTransparentIs0xFF, AlphaTargetModulation tAlphaTargetModulation>
 		static void blend8BitPerChannelSubset(const uint8_t* sourceWithAlpha, uint8_t* target, const unsigned int width, const unsigned int height, const unsigned int sourceWithAlphaPaddingElements, const unsigned int targetPaddingElements, const unsigned int firstRow, const unsigned int numberRows);
 
+		/**
+		 * Blends a subset of a source frame holding a premultiplied alpha channel with a target frame.
+		 * @param sourceWithAlpha Source frame with premultiplied alpha channel, must be valid
+		 * @param target The target frame which may also hold an alpha channel depending on tTargetHasAlpha, must be valid
+		 * @param width The width of both frames in pixel, with range [1, infinity)
+		 * @param height The height of both frames in pixel, with range [1, infinity)
+		 * @param sourceWithAlphaPaddingElements The number of padding elements at the end of each source row, in elements, with range [0, infinity)
+		 * @param targetPaddingElements The number of padding elements at the end of each target row, in elements, with range [0, infinity)
+		 * @param firstRow First row to be handled, with range [0, height - 1]
+		 * @param numberRows Number of rows to be handled, with range [1, height - firstRow]
+		 * @tparam tChannelsWithAlpha Number of channels in the source frame (including the alpha channel), with range [2, infinity)
+		 * @tparam tAlphaAtFront True, if the alpha channel is in the front of the data channels
+		 * @tparam tTargetHasAlpha True, if the target frame holds an alpha channel as well
+		 */
+		template <unsigned int tChannelsWithAlpha, bool tAlphaAtFront, bool tTargetHasAlpha>
+		static void blendPremultiplied8BitPerChannelSubset(const uint8_t* sourceWithAlpha, uint8_t* target, const unsigned int width, const unsigned int height, const unsigned int sourceWithAlphaPaddingElements, const unsigned int targetPaddingElements, const unsigned int firstRow, const unsigned int numberRows);
+
+#if defined(OCEAN_HARDWARE_SSE_VERSION) && OCEAN_HARDWARE_SSE_VERSION >= 41
+
+		/**
+		 * Blends the pixels of one row of a source frame with four channels (including an alpha channel) with a target frame with three channels.
+		 * The function handles blocks of four pixels with 16 bit fixed-point precision and produces the same results as the corresponding scalar implementation.
+		 * @param sourceWithAlpha The row of the source frame with alpha channel, must be valid
+		 * @param target The row of the target frame without alpha channel, must be valid
+		 * @param width The width of both rows in pixel, with range [1, infinity)
+		 * @return The number of pixels which have been handled, all remaining pixels need to be handled by the caller, with range [0, width]
+		 * @tparam tAlphaAtFront True, if the alpha channel is in the front of the data channels
+		 * @tparam tTransparentIs0xFF True, if 0xFF is interpreted as fully transparent, ignored if tPremultiplied is True
+		 * @tparam tPremultiplied True, if the data channels of the source frame are premultiplied with the alpha value
+		 */
+		template <bool tAlphaAtFront, bool tTransparentIs0xFF, bool tPremultiplied>
+		static inline unsigned int blend4ChannelsTo3Channels8BitSSE(const uint8_t* sourceWithAlpha, uint8_t* target, const unsigned int width);
+
+#endif // OCEAN_HARDWARE_SSE_VERSION >= 41
+
+#if defined(OCEAN_HARDWARE_NEON_VERSION) && OCEAN_HARDWARE_NEON_VERSION >= 10
+
+		/**
+		 * Blends the pixels of one row of a source frame with four channels (including an alpha channel) with a target frame with three channels.
+		 * The function handles blocks of 16 pixels with 16 bit fixed-point precision and produces the same results as the corresponding scalar implementation.
+		 * @param sourceWithAlpha The row of the source frame with alpha channel, must be valid
+		 * @param target The row of the target frame without alpha channel, must be valid
+		 * @param width The width of both rows in pixel, with range [1, infinity)
+		 * @return The number of pixels which have been handled, all remaining pixels need to be handled by the caller, with range [0, width]
+		 * @tparam tAlphaAtFront True, if the alpha channel is in the front of the data channels
+		 * @tparam tTransparentIs0xFF True, if 0xFF is interpreted as fully transparent, ignored if tPremultiplied is True
+		 * @tparam tPremultiplied True, if the data channels of the source frame are premultiplied with the alpha value
+		 */
+		template <bool tAlphaAtFront, bool tTransparentIs0xFF, bool tPremultiplied>
+		static inline unsigned int blend4ChannelsTo3Channels8BitNEON(const uint8_t* sourceWithAlpha, uint8_t* target, const unsigned int width);
+
+#endif // OCEAN_HARDWARE_NEON_VERSION >= 10
+
 		/**
 		 * Blends a subset of a target frame with a specified constant value for all pixels, while each pixel might have a different blending factor.
 		 * @param alpha The alpha frame defining the value blending factor that is applied for each pixel
@@ -822,6 +916,22 @@ inline void FrameBlender::blend8BitPerChannel(const uint8_t* sourceWithAlpha, ui
 	}
 }
 
+template <unsigned int tChannelsWithAlpha, bool tAlphaAtFront, bool tTargetHasAlpha>
+inline void FrameBlender::blendPremultiplied8BitPerChannel(const uint8_t* sourceWithAlpha, uint8_t* target, const unsigned int width, const unsigned int height, const unsigned int sourceWithAlphaPaddingElements, const unsigned int targetPaddingElements, Worker* worker)
+{
+	static_assert(tChannelsWithAlpha > 1u, "Invalid channel number!");
+	ocean_assert(sourceWithAlpha != nullptr && target != nullptr);
+
+	if (worker)
+	{
+		worker->executeFunction(Worker::Function::createStatic(&blendPremultiplied8BitPerChannelSubset<tChannelsWithAlpha, tAlphaAtFront, tTargetHasAlpha>, sourceWithAlpha, target, width, height, sourceWithAlphaPaddingElements, targetPaddingElements, 0u, 0u), 0u, height, 6u, 7u, 20u);
+	}
+	else
+	{
+		blendPremultiplied8BitPerChannelSubset<tChannelsWithAlpha, tAlphaAtFront, tTargetHasAlpha>(sourceWithAlpha, target, width, height, sourceWithAlphaPaddingElements, targetPaddingElements, 0u, height);
+	}
+}
+
 template <unsigned int tChannels, bool tTransparentIs0xFF>
 inline void FrameBlender::blend8BitPerChannel(const uint8_t* alpha, uint8_t* target, const unsigned int width, const unsigned int height, const uint8_t* value, const unsigned int alphaPaddingElements, const unsigned int targetPaddingElements, Worker* worker)
 {
@@ -1032,7 +1142,21 @@ void FrameBlender::blend8BitPerChannelSubset(const uint8_t* sourceWithAlpha, uin
 		const uint8_t* sourceWithAlphaData = sourceWithAlpha + y * sourceWithAlphaStrideElements;
 		uint8_t* targetData = target + y * targetStrideElements;
 
-		for (unsigned int x = 0u; x < width; ++x)
+		unsigned int x = 0u;
+
+		if constexpr (tChannelsWithAlpha == 4u && !tTargetHasAlpha)
+		{
+#if defined(OCEAN_HARDWARE_SSE_VERSION) && OCEAN_HARDWARE_SSE_VERSION >= 41
+			x = blend4ChannelsTo3Channels8BitSSE<tAlphaAtFront, tTransparentIs0xFF, false>(sourceWithAlphaData, targetData, width);
+#elif defined(OCEAN_HARDWARE_NEON_VERSION) && OCEAN_HARDWARE_NEON_VERSION >= 10
+			x = blend4ChannelsTo3Channels8BitNEON<tAlphaAtFront, tTransparentIs0xFF, false>(sourceWithAlphaData, targetData, width);
+#endif
+
+			sourceWithAlphaData += x * tChannelsWithAlpha;
+			targetData += x * TargetOffset<tTargetHasAlpha>::template channels<tChannelsWithAlpha>();
+		}
+
+		for (; x < width; ++x)
 		{
 			const uint8_t sourceFactor = sourceBlendFactor<tTransparentIs0xFF>(sourceWithAlphaData[SourceOffset<tAlphaAtFront>::template alpha<tChannelsWithAlpha>()]);
 			const uint8_t targetFactor = targetBlendFactor<tTransparentIs0xFF>(sourceWithAlphaData[SourceOffset<tAlphaAtFront>::template alpha<tChannelsWithAlpha>()]);
@@ -1066,6 +1190,226 @@ void FrameBlender::blend8BitPerChannelSubset(const uint8_t* sourceWithAlpha, uin
 	}
 }
 
+template <unsigned int tChannelsWithAlpha, bool tAlphaAtFront, bool tTargetHasAlpha>
+void FrameBlender::blendPremultiplied8BitPerChannelSubset(const uint8_t* sourceWithAlpha, uint8_t* target, const unsigned int width, const unsigned int height, const unsigned int sourceWithAlphaPaddingElements, const unsigned int targetPaddingElements, const unsigned int firstRow, const unsigned int numberRows)
+{
+	static_assert(tChannelsWithAlpha > 1u, "Invalid channel number!");
+	ocean_assert(sourceWithAlpha != nullptr && target != nullptr);
+
+	ocean_assert_and_suppress_unused(firstRow + numberRows <= height, height);
+
+	constexpr unsigned int tTargetChannels = TargetOffset<tTargetHasAlpha>::template channels<tChannelsWithAlpha>();
+
+	constexpr unsigned int sourceAlphaIndex = SourceOffset<tAlphaAtFront>::template alpha<tChannelsWithAlpha>();
+
+	const unsigned int sourceWithAlphaStrideElements = width * tChannelsWithAlpha + sourceWithAlphaPaddingElements;
+	const unsigned int targetStrideElements = width * tTargetChannels + targetPaddingElements;
+
+	for (unsigned int y = firstRow; y < firstRow + numberRows; ++y)
+	{
+		const uint8_t* sourceWithAlphaData = sourceWithAlpha + y * sourceWithAlphaStrideElements;
+		uint8_t* targetData = target + y * targetStrideElements;
+
+		unsigned int x = 0u;
+
+		if constexpr (tChannelsWithAlpha == 4u && !tTargetHasAlpha)
+		{
+#if defined(OCEAN_HARDWARE_SSE_VERSION) && OCEAN_HARDWARE_SSE_VERSION >= 41
+			x = blend4ChannelsTo3Channels8BitSSE<tAlphaAtFront, false, true>(sourceWithAlphaData, targetData, width);
+#elif defined(OCEAN_HARDWARE_NEON_VERSION) && OCEAN_HARDWARE_NEON_VERSION >= 10
+			x = blend4ChannelsTo3Channels8BitNEON<tAlphaAtFront, false, true>(sourceWithAlphaData, targetData, width);
+#endif
+
+			sourceWithAlphaData += x * tChannelsWithAlpha;
+			targetData += x * tTargetChannels;
+		}
+
+		for (; x < width; ++x)
+		{
+			// targetPixel = sourcePixel + targetPixel * (255 - sourceAlpha) / 255, while invalid premultiplied source pixels are clamped
+
+			const unsigned int targetFactor = 0xFFu - sourceWithAlphaData[sourceAlphaIndex];
+
+			for (unsigned int n = 0u; n < tChannelsWithAlpha - 1u; ++n)
+			{
+				uint8_t& targetValue = targetData[n + TargetOffset<tTargetHasAlpha>::template data<tAlphaAtFront>()];
+
+				targetValue = uint8_t(std::min(0xFFu, (unsigned int)(sourceWithAlphaData[n + SourceOffset<tAlphaAtFront>::data()]) + Ocean::Utilities::divideBy255(targetValue * targetFactor + 127u)));
+			}
+
+			if constexpr (tTargetHasAlpha)
+			{
+				uint8_t& targetAlpha = targetData[sourceAlphaIndex];
+
+				targetAlpha = uint8_t(std::min(0xFFu, (unsigned int)(sourceWithAlphaData[sourceAlphaIndex]) + Ocean::Utilities::divideBy255(targetAlpha * targetFactor + 127u)));
+			}
+
+			sourceWithAlphaData += tChannelsWithAlpha;
+			targetData += tTargetChannels;
+		}
+	}
+}
+
+#if defined(OCEAN_HARDWARE_SSE_VERSION) && OCEAN_HARDWARE_SSE_VERSION >= 41
+
+template <bool tAlphaAtFront, bool tTransparentIs0xFF, bool tPremultiplied>
+inline unsigned int FrameBlender::blend4ChannelsTo3Channels8BitSSE(const uint8_t* sourceWithAlpha, uint8_t* target, const unsigned int width)
+{
+	ocean_assert(sourceWithAlpha != nullptr && target != nullptr);
+
+	// we handle blocks of 4 pixels while loading 16 bytes from the target row, so that we need at least 6 pixels to stay inside the row
+
+	if (width < 6u)
+	{
+		return 0u;
+	}
+
+	// the shuffle masks place the three data channels (or the alpha value) of each pixel into the first three bytes of a 4 byte block, the fourth byte is zero
+
+	const __m128i sourceDataMask_u_8x16 = tAlphaAtFront ? SSE::set128i(0x800F0E0D800B0A09ull, 0x8007060580030201ull) : SSE::set128i(0x800E0D0C800A0908ull, 0x8006050480020100ull);
+	const __m128i sourceAlphaMask_u_8x16 = tAlphaAtFront ? SSE::set128i(0x800C0C0C80080808ull, 0x8004040480000000ull) : SSE::set128i(0x800F0F0F800B0B0Bull, 0x8007070780030303ull);
+	const __m128i targetDataMask_u_8x16 = SSE::set128i(0x800B0A0980080706ull, 0x8005040380020100ull);
+
+	// the masks to reorder the 4 byte blocks back into 3 byte pixels, and to keep the last 4 bytes of the target which do not belong to the 4 pixels
+	const __m128i resultMask_u_8x16 = SSE::set128i(0x808080800E0D0C0Aull, 0x0908060504020100ull);
+	const __m128i targetRemainingMask_u_8x16 = SSE::set128i(0x0F0E0D0C80808080ull, 0x8080808080808080ull);
+
+	const __m128i constant_255_u_16x8 = _mm_set1_epi16(255);
+	const __m128i constant_127_u_16x8 = _mm_set1_epi16(127);
+	const __m128i constant_1_u_16x8 = _mm_set1_epi16(1);
+
+	unsigned int x = 0u;
+
+	while (x + 6u <= width)
+	{
+		const __m128i source_u_8x16 = _mm_loadu_si128((const __m128i*)(sourceWithAlpha + x * 4u));
+		const __m128i target_u_8x16 = _mm_loadu_si128((const __m128i*)(target + x * 3u));
+
+		const __m128i sourceData_u_8x16 = _mm_shuffle_epi8(source_u_8x16, sourceDataMask_u_8x16);
+		const __m128i sourceAlpha_u_8x16 = _mm_shuffle_epi8(source_u_8x16, sourceAlphaMask_u_8x16);
+		const __m128i targetData_u_8x16 = _mm_shuffle_epi8(target_u_8x16, targetDataMask_u_8x16);
+
+		const __m128i sourceDataLow_u_16x8 = _mm_cvtepu8_epi16(sourceData_u_8x16);
+		const __m128i sourceDataHigh_u_16x8 = _mm_unpackhi_epi8(sourceData_u_8x16, _mm_setzero_si128());
+
+		const __m128i sourceAlphaLow_u_16x8 = _mm_cvtepu8_epi16(sourceAlpha_u_8x16);
+		const __m128i sourceAlphaHigh_u_16x8 = _mm_unpackhi_epi8(sourceAlpha_u_8x16, _mm_setzero_si128());
+
+		const __m128i targetDataLow_u_16x8 = _mm_cvtepu8_epi16(targetData_u_8x16);
+		const __m128i targetDataHigh_u_16x8 = _mm_unpackhi_epi8(targetData_u_8x16, _mm_setzero_si128());
+
+		__m128i valueLow_u_16x8;
+		__m128i valueHigh_u_16x8;
+
+		if constexpr (tPremultiplied)
+		{
+			// target * (255 - alpha) + 127
+
+			valueLow_u_16x8 = _mm_add_epi16(_mm_mullo_epi16(targetDataLow_u_16x8, _mm_sub_epi16(constant_255_u_16x8, sourceAlphaLow_u_16x8)), constant_127_u_16x8);
+			valueHigh_u_16x8 = _mm_add_epi16(_mm_mullo_epi16(targetDataHigh_u_16x8, _mm_sub_epi16(constant_255_u_16x8, sourceAlphaHigh_u_16x8)), constant_127_u_16x8);
+		}
+		else
+		{
+			const __m128i sourceFactorLow_u_16x8 = tTransparentIs0xFF ? _mm_sub_epi16(constant_255_u_16x8, sourceAlphaLow_u_16x8) : sourceAlphaLow_u_16x8;
+			const __m128i sourceFactorHigh_u_16x8 = tTransparentIs0xFF ? _mm_sub_epi16(constant_255_u_16x8, sourceAlphaHigh_u_16x8) : sourceAlphaHigh_u_16x8;
+
+			// target * (255 - sourceFactor) + source * sourceFactor + 127, with range [0, 65152]
+
+			valueLow_u_16x8 = _mm_add_epi16(_mm_add_epi16(_mm_mullo_epi16(targetDataLow_u_16x8, _mm_sub_epi16(constant_255_u_16x8, sourceFactorLow_u_16x8)), _mm_mullo_epi16(sourceDataLow_u_16x8, sourceFactorLow_u_16x8)), constant_127_u_16x8);
+			valueHigh_u_16x8 = _mm_add_epi16(_mm_add_epi16(_mm_mullo_epi16(targetDataHigh_u_16x8, _mm_sub_epi16(constant_255_u_16x8, sourceFactorHigh_u_16x8)), _mm_mullo_epi16(sourceDataHigh_u_16x8, sourceFactorHigh_u_16x8)), constant_127_u_16x8);
+		}
+
+		// value / 255 = (value + 1 + (value >> 8)) >> 8, see Utilities::divideBy255()
+
+		valueLow_u_16x8 = _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(valueLow_u_16x8, constant_1_u_16x8), _mm_srli_epi16(valueLow_u_16x8, 8)), 8);
+		valueHigh_u_16x8 = _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(valueHigh_u_16x8, constant_1_u_16x8), _mm_srli_epi16(valueHigh_u_16x8, 8)), 8);
+
+		__m128i result_u_8x16 = _mm_packus_epi16(valueLow_u_16x8, valueHigh_u_16x8);
+
+		if constexpr (tPremultiplied)
+		{
+			result_u_8x16 = _mm_adds_epu8(result_u_8x16, sourceData_u_8x16);
+		}
+
+		result_u_8x16 = _mm_or_si128(_mm_shuffle_epi8(result_u_8x16, resultMask_u_8x16), _mm_shuffle_epi8(target_u_8x16, targetRemainingMask_u_8x16));
+
+		_mm_storeu_si128((__m128i*)(target + x * 3u), result_u_8x16);
+
+		x += 4u;
+	}
+
+	return x;
+}
+
+#endif // OCEAN_HARDWARE_SSE_VERSION >= 41
+
+#if defined(OCEAN_HARDWARE_NEON_VERSION) && OCEAN_HARDWARE_NEON_VERSION >= 10
+
+template <bool tAlphaAtFront, bool tTransparentIs0xFF, bool tPremultiplied>
+inline unsigned int FrameBlender::blend4ChannelsTo3Channels8BitNEON(const uint8_t* sourceWithAlpha, uint8_t* target, const unsigned int width)
+{
+	ocean_assert(sourceWithAlpha != nullptr && target != nullptr);
+
+	constexpr unsigned int alphaIndex = tAlphaAtFront ? 0u : 3u;
+	constexpr unsigned int dataOffset = tAlphaAtFront ? 1u : 0u;
+
+	const uint16x8_t constant_127_u_16x8 = vdupq_n_u16(127u);
+	const uint16x8_t constant_1_u_16x8 = vdupq_n_u16(1u);
+
+	unsigned int x = 0u;
+
+	while (x + 16u <= width)
+	{
+		const uint8x16x4_t source_u_8x16x4 = vld4q_u8(sourceWithAlpha + x * 4u);
+		uint8x16x3_t target_u_8x16x3 = vld3q_u8(target + x * 3u);
+
+		const uint8x16_t sourceAlpha_u_8x16 = source_u_8x16x4.val[alphaIndex];
+
+		// for premultiplied source pixels, only the target is weighted
+		const uint8x16_t sourceFactor_u_8x16 = (tTransparentIs0xFF && !tPremultiplied) ? vmvnq_u8(sourceAlpha_u_8x16) : sourceAlpha_u_8x16;
+		const uint8x16_t targetFactor_u_8x16 = vmvnq_u8(sourceFactor_u_8x16); // 255 - sourceFactor
+
+		for (unsigned int n = 0u; n < 3u; ++n)
+		{
+			const uint8x16_t sourceData_u_8x16 = source_u_8x16x4.val[n + dataOffset];
+
+			uint16x8_t valueLow_u_16x8 = vmull_u8(vget_low_u8(target_u_8x16x3.val[n]), vget_low_u8(targetFactor_u_8x16));
+			uint16x8_t valueHigh_u_16x8 = vmull_u8(vget_high_u8(target_u_8x16x3.val[n]), vget_high_u8(targetFactor_u_8x16));
+
+			if constexpr (!tPremultiplied)
+			{
+				valueLow_u_16x8 = vmlal_u8(valueLow_u_16x8, vget_low_u8(sourceData_u_8x16), vget_low_u8(sourceFactor_u_8x16));
+				valueHigh_u_16x8 = vmlal_u8(valueHigh_u_16x8, vget_high_u8(sourceData_u_8x16), vget_high_u8(sourceFactor_u_8x16));
+			}
+
+			valueLow_u_16x8 = vaddq_u16(valueLow_u_16x8, constant_127_u_16x8);
+			valueHigh_u_16x8 = vaddq_u16(valueHigh_u_16x8, constant_127_u_16x8);
+
+			// value / 255 = (value + 1 + (value >> 8)) >> 8, see Utilities::divideBy255()
+
+			const uint8x8_t resultLow_u_8x8 = vshrn_n_u16(vaddq_u16(vaddq_u16(valueLow_u_16x8, constant_1_u_16x8), vshrq_n_u16(valueLow_u_16x8, 8)), 8);
+			const uint8x8_t resultHigh_u_8x8 = vshrn_n_u16(vaddq_u16(vaddq_u16(valueHigh_u_16x8, constant_1_u_16x8), vshrq_n_u16(valueHigh_u_16x8, 8)), 8);
+
+			if constexpr (tPremultiplied)
+			{
+				target_u_8x16x3.val[n] = vqaddq_u8(vcombine_u8(resultLow_u_8x8, resultHigh_u_8x8), sourceData_u_8x16);
+			}
+			else
+			{
+				target_u_8x16x3.val[n] = vcombine_u8(resultLow_u_8x8, resultHigh_u_8x8);
+			}
+		}
+
+		vst3q_u8(target + x * 3u, target_u_8x16x3);
+
+		x += 16u;
+	}
+
+	return x;
+}
+
+#endif // OCEAN_HARDWARE_NEON_VERSION >= 10
+
 template <unsigned int tChannels, bool tTransparentIs0xFF>
 void FrameBlender::blend8BitPerChannelSubset(const uint8_t* alpha, uint8_t* target, const unsigned int width, const unsigned int height, const uint8_t* value, const unsigned int alphaPaddingElements, const unsigned int targetPaddingElements, const unsigned int firstRow, const unsigned int numberRows)
 {
@@ -1356,6 +1356,22 @@ class OCEAN_CV_EXPORT FrameChannels : public FrameConverter
 
 #endif // OCEAN_HARDWARE_SSE_VERSION >= 41
 
+#if defined(OCEAN_HARDWARE_SSE_VERSION) && OCEAN_HARDWARE_SSE_VERSION >= 41 && defined(OCEAN_HARDWARE_AVX_VERSION) && OCEAN_HARDWARE_AVX_VERSION >= 20
+
+		/**
+		 * Converts 32 pixels with 3 channels per pixel to 32 pixels with one channel per pixel by a linear combination of the three channels.
+		 * This function is the AVX2 version of convert3ChannelsTo1Channel16Pixels8BitPerChannel7BitPrecisionSSE(), the results are identical.
+		 * @param source The pointer to the 32 source pixels (with 3 channels = 96 bytes) to convert, must be valid
+		 * @param target The pointer to the 32 target pixels (with 1 channel = 32 bytes) receiving the converted pixel data, must be valid
+		 * @param multiplicationFactors0_128_u_16x16 The multiplication factor for the first channel (16 identical 16 bit values), with ranges [0, 128], while the sum of all three factors must be 128
+		 * @param multiplicationFactors1_128_u_16x16 The multiplication factor for the second channel (16 identical 16 bit values), with ranges [0, 128], while the sum of all three factors must be 128
+		 * @param multiplicationFactors2_128_u_16x16 The multiplication factor for the third channel (16 identical 16 bit values), with ranges [0, 128], while the sum of all three factors must be 128
+		 * @see convert3ChannelsTo1Channel16Pixels8BitPerChannel7BitPrecisionSSE().
+		 */
+		static OCEAN_FORCE_INLINE void convert3ChannelsTo1Channel32Pixels8BitPerChannel7BitPrecisionAVX2(const uint8_t* const source, uint8_t* const target, const __m256i& multiplicationFactors0_128_u_16x16, const __m256i& multiplicationFactors1_128_u_16x16, const __m256i& multiplicationFactors2_128_u_16x16);
+
+#endif // OCEAN_HARDWARE_SSE_VERSION >= 41 && OCEAN_HARDWARE_AVX_VERSION >= 20
+
 #if defined(OCEAN_HARDWARE_NEON_VERSION) && OCEAN_HARDWARE_NEON_VERSION >= 10
 
 		/**
@@ -3119,6 +3135,88 @@ void FrameChannels::reverseRowPixelOrder(const T* source, T* target, const size_
 
 #endif // OCEAN_HARDWARE_NEON_VERSION
 
+#if defined(OCEAN_HARDWARE_SSE_VERSION) && OCEAN_HARDWARE_SSE_VERSION >= 41
+
+	constexpr size_t bytesPerPixel = sizeof(T) * size_t(tChannels);
+
+	if constexpr (bytesPerPixel == 1 || bytesPerPixel == 2 || bytesPerPixel == 4)
+	{
+		// pixels with 1, 2, or 4 bytes are reversed with one shuffle per 16 bytes, independent of the actual element type
+
+		constexpr size_t pixelsPerBlock = size_t(16) / bytesPerPixel;
+
+		__m128i reverseShuffleMask_u_8x16;
+
+		if constexpr (bytesPerPixel == 1)
+		{
+			reverseShuffleMask_u_8x16 = _mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+		}
+		else if constexpr (bytesPerPixel == 2)
+		{
+			reverseShuffleMask_u_8x16 = _mm_set_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14);
+		}
+		else
+		{
+			reverseShuffleMask_u_8x16 = _mm_set_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+		}
+
+		const size_t blocks = size / pixelsPerBlock;
+
+		for (size_t n = 0; n < blocks; ++n)
+		{
+			target -= pixelsPerBlock * tChannels;
+
+			ocean_assert(source >= debugSourceStart && source + pixelsPerBlock * tChannels <= debugSourceEnd);
+			ocean_assert(target >= debugTargetStart && target + pixelsPerBlock * tChannels <= debugTargetEnd);
+
+			const __m128i source_u_8x16 = _mm_loadu_si128((const __m128i*)(source));
+
+			_mm_storeu_si128((__m128i*)(target), _mm_shuffle_epi8(source_u_8x16, reverseShuffleMask_u_8x16));
+
+			source += pixelsPerBlock * tChannels;
+		}
+	}
+	else if constexpr (std::is_same<typename TypeMapper<T>::Type, uint8_t>::value && tChannels == 3u)
+	{
+		// 16 pixels with 3 channels are reversed at once, each of the three resulting registers is composed of (up to) three shuffled source registers
+
+		const __m128i shuffleMaskA_B_u_8x16 = _mm_set_epi8(14, char(0x80), char(0x80), char(0x80), char(0x80), char(0x80), char(0x80), char(0x80), char(0x80), char(0x80), char(0x80), char(0x80), char(0x80), char(0x80), char(0x80), char(0x80));
+		const __m128i shuffleMaskA_C_u_8x16 = _mm_set_epi8(char(0x80), 3, 2, 1, 6, 5, 4, 9, 8, 7, 12, 11, 10, 15, 14, 13);
+
+		const __m128i shuffleMaskB_A_u_8x16 = _mm_set_epi8(char(0x80), 15, char(0x80), char(0x80), char(0x80), char(0x80), char(0x80), char(0x80), char(0x80), char(0x80), char(0x80), char(0x80), char(0x80), char(0x80), char(0x80), char(0x80));
+		const __m128i shuffleMaskB_B_u_8x16 = _mm_set_epi8(0, char(0x80), 4, 3, 2, 7, 6, 5, 10, 9, 8, 13, 12, 11, char(0x80), 15);
+		const __m128i shuffleMaskB_C_u_8x16 = _mm_set_epi8(char(0x80), char(0x80), char(0x80), char(0x80), char(0x80), char(0x80), char(0x80), char(0x80), char(0x80), char(0x80), char(0x80), char(0x80), char(0x80), char(0x80), 0, char(0x80));
+
+		const __m128i shuffleMaskC_A_u_8x16 = _mm_set_epi8(2, 1, 0, 5, 4, 3, 8, 7, 6, 11, 10, 9, 14, 13, 12, char(0x80));
+		const __m128i shuffleMaskC_B_u_8x16 = _mm_set_epi8(char(0x80), char(0x80), char(0x80), char(0x80), char(0x80), char(0x80), char(0x80), char(0x80), char(0x80), char(0x80), char(0x80), char(0x80), char(0x80), char(0x80), char(0x80), 1);
+
+		const size_t blocks16 = size / size_t(16);
+
+		for (size_t n = 0; n < blocks16; ++n)
+		{
+			target -= 16u * tChannels;
+
+			ocean_assert(source >= debugSourceStart && source + 16u * tChannels <= debugSourceEnd);
+			ocean_assert(target >= debugTargetStart && target + 16u * tChannels <= debugTargetEnd);
+
+			const __m128i sourceA_u_8x16 = _mm_loadu_si128((const __m128i*)(source) + 0);
+			const __m128i sourceB_u_8x16 = _mm_loadu_si128((const __m128i*)(source) + 1);
+			const __m128i sourceC_u_8x16 = _mm_loadu_si128((const __m128i*)(source) + 2);
+
+			const __m128i targetA_u_8x16 = _mm_or_si128(_mm_shuffle_epi8(sourceB_u_8x16, shuffleMaskA_B_u_8x16), _mm_shuffle_epi8(sourceC_u_8x16, shuffleMaskA_C_u_8x16));
+			const __m128i targetB_u_8x16 = _mm_or_si128(_mm_or_si128(_mm_shuffle_epi8(sourceA_u_8x16, shuffleMaskB_A_u_8x16), _mm_shuffle_epi8(sourceB_u_8x16, shuffleMaskB_B_u_8x16)), _mm_shuffle_epi8(sourceC_u_8x16, shuffleMaskB_C_u_8x16));
+			const __m128i targetC_u_8x16 = _mm_or_si128(_mm_shuffle_epi8(sourceA_u_8x16, shuffleMaskC_A_u_8x16), _mm_shuffle_epi8(sourceB_u_8x16, shuffleMaskC_B_u_8x16));
+
+			_mm_storeu_si128((__m128i*)(target) + 0, targetA_u_8x16);
+			_mm_storeu_si128((__m128i*)(target) + 1, targetB_u_8x16);
+			_mm_storeu_si128((__m128i*)(target) + 2, targetC_u_8x16);
+
+			source += 16u * tChannels;
+		}
+	}
+
+#endif // OCEAN_HARDWARE_SSE_VERSION >= 41
+
 	while (source != sourceEnd)
 	{
 		ocean_assert(source < sourceEnd);
@@ -5028,8 +5126,35 @@ void FrameChannels::convertRow3ChannelsTo1Channel8BitPerChannel7BitPrecision(con
 
 #if defined(OCEAN_HARDWARE_SSE_VERSION) && OCEAN_HARDWARE_SSE_VERSION >= 41
 
+#if defined(OCEAN_HARDWARE_AVX_VERSION) && OCEAN_HARDWARE_AVX_VERSION >= 20
+
+	constexpr size_t blockSizeAVX = 32;
+	const size_t blocksAVX = size / blockSizeAVX;
+
+	const __m256i multiplicationFactors0_128_u_16x16 = _mm256_set1_epi16(int16_t(factorChannel0_128));
+	const __m256i multiplicationFactors1_128_u_16x16 = _mm256_set1_epi16(int16_t(factorChannel1_128));
+	const __m256i multiplicationFactors2_128_u_16x16 = _mm256_set1_epi16(int16_t(factorChannel2_128));
+
+	for (size_t n = 0; n < blocksAVX; ++n)
+	{
+		convert3ChannelsTo1Channel32Pixels8BitPerChannel7BitPrecisionAVX2(source, target, multiplicationFactors0_128_u_16x16, multiplicationFactors1_128_u_16x16, multiplicationFactors2_128_u_16x16);
+
+		source += blockSizeAVX * size_t(3);
+		target += blockSizeAVX;
+	}
+
+	// the remaining pixels are handled with SSE instructions
+
+	const size_t remainingSize = size - blocksAVX * blockSizeAVX;
+
+#else
+
+	const size_t remainingSize = size;
+
+#endif // OCEAN_HARDWARE_AVX_VERSION >= 20
+
 	constexpr size_t blockSize = 16;
-	const size_t blocks = size / blockSize;
+	const size_t blocks = remainingSize / blockSize;
 
 	const __m128i multiplicationFactors0_128_u_16x8 = _mm_set1_epi16(int16_t(factorChannel0_128));
 	const __m128i multiplicationFactors1_128_u_16x8 = _mm_set1_epi16(int16_t(factorChannel1_128));
@@ -6092,6 +6217,56 @@ void FrameChannels::convert4ChannelsTo2Channels16Pixels8BitPerChannel7BitPrecisi
 
 #endif // OCEAN_HARDWARE_SSE_VERSION
 
+#if defined(OCEAN_HARDWARE_SSE_VERSION) && OCEAN_HARDWARE_SSE_VERSION >= 41 && defined(OCEAN_HARDWARE_AVX_VERSION) && OCEAN_HARDWARE_AVX_VERSION >= 20
+
+OCEAN_FORCE_INLINE void FrameChannels::convert3ChannelsTo1Channel32Pixels8BitPerChannel7BitPrecisionAVX2(const uint8_t* const source, uint8_t* const target, const __m256i& multiplicationFactors0_128_u_16x16, const __m256i& multiplicationFactors1_128_u_16x16, const __m256i& multiplicationFactors2_128_u_16x16)
+{
+	ocean_assert(source != nullptr && target != nullptr);
+
+	// the de-interleaving is applied with SSE instructions (as the 3-channel pattern would need lane-crossing shuffles),
+	// while the multiplications are applied for 16 pixels at once
+
+	__m128i channel0A_u_8x16;
+	__m128i channel1A_u_8x16;
+	__m128i channel2A_u_8x16;
+	SSE::deInterleave3Channel8Bit48Elements(source + 0, channel0A_u_8x16, channel1A_u_8x16, channel2A_u_8x16);
+
+	__m128i channel0B_u_8x16;
+	__m128i channel1B_u_8x16;
+	__m128i channel2B_u_8x16;
+	SSE::deInterleave3Channel8Bit48Elements(source + 48, channel0B_u_8x16, channel1B_u_8x16, channel2B_u_8x16);
+
+	// we need 16 bit values instead of 8 bit values
+
+	const __m256i channel0A_u_16x16 = _mm256_cvtepu8_epi16(channel0A_u_8x16);
+	const __m256i channel1A_u_16x16 = _mm256_cvtepu8_epi16(channel1A_u_8x16);
+	const __m256i channel2A_u_16x16 = _mm256_cvtepu8_epi16(channel2A_u_8x16);
+
+	const __m256i channel0B_u_16x16 = _mm256_cvtepu8_epi16(channel0B_u_8x16);
+	const __m256i channel1B_u_16x16 = _mm256_cvtepu8_epi16(channel1B_u_8x16);
+	const __m256i channel2B_u_16x16 = _mm256_cvtepu8_epi16(channel2B_u_8x16);
+
+	// we store sixteen 16 bit values holding 64 for rounding purpose:
+	const __m256i constant64_u_16x16 = _mm256_set1_epi16(64);
+
+	// we multiply each channel with the corresponding multiplication factors, we sum up all results and add 64 for rounding purpose
+
+	const __m256i resultA128_u_16x16 = _mm256_adds_epu16(_mm256_adds_epu16(_mm256_mullo_epi16(channel0A_u_16x16, multiplicationFactors0_128_u_16x16), _mm256_mullo_epi16(channel1A_u_16x16, multiplicationFactors1_128_u_16x16)), _mm256_adds_epu16(_mm256_mullo_epi16(channel2A_u_16x16, multiplicationFactors2_128_u_16x16), constant64_u_16x16));
+	const __m256i resultB128_u_16x16 = _mm256_adds_epu16(_mm256_adds_epu16(_mm256_mullo_epi16(channel0B_u_16x16, multiplicationFactors0_128_u_16x16), _mm256_mullo_epi16(channel1B_u_16x16, multiplicationFactors1_128_u_16x16)), _mm256_adds_epu16(_mm256_mullo_epi16(channel2B_u_16x16, multiplicationFactors2_128_u_16x16), constant64_u_16x16));
+
+	// we shift the multiplication results by 7 bits (= 128)
+	const __m256i resultA_u_16x16 = _mm256_srli_epi16(resultA128_u_16x16, 7);
+	const __m256i resultB_u_16x16 = _mm256_srli_epi16(resultB128_u_16x16, 7);
+
+	// the pack instruction is applied per 128 bit lane, so that we need to reorder the 64 bit blocks afterwards
+	const __m256i result_u_8x32 = _mm256_permute4x64_epi64(_mm256_packus_epi16(resultA_u_16x16, resultB_u_16x16), 0xD8);
+
+	// and we can store the result
+	_mm256_storeu_si256((__m256i*)target, result_u_8x32);
+}
+
+#endif // OCEAN_HARDWARE_SSE_VERSION >= 41 && OCEAN_HARDWARE_AVX_VERSION >= 20
+
 #if defined(OCEAN_HARDWARE_NEON_VERSION) && OCEAN_HARDWARE_NEON_VERSION >= 10
 
 template <bool tUseFactorChannel0, bool tUseFactorChannel1, bool tUseFactorChannel2>
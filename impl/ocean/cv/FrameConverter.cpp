@@ -39,6 +39,7 @@
 #include "ocean/cv/SSE.h"
 
 #include "ocean/base/DataType.h"
+#include "ocean/base/ThreadPool.h"
 
 namespace Ocean
 {
@@ -582,6 +583,68 @@ bool FrameConverter::Comfort::convertAndCopy(const Frame& source, Frame& target,
 	return convert(source, target.pixelFormat(), target.pixelOrigin(), target, true, worker, options);
 }
 
+bool FrameConverter::Comfort::warmUp(const PixelFormatPairs& pixelFormatPairs, const Options& options, const bool background)
+{
+	if (background)
+	{
+		return ThreadPoolSingleton::get().invoke([pixelFormatPairs, options]()
+		{
+			warmUp(pixelFormatPairs, options, false /*background*/);
+		});
+	}
+
+	// creating the table of conversion functions
+
+	ConversionFunctionMap::get();
+
+	bool allSucceeded = true;
+
+	for (const PixelFormatPair& pixelFormatPair : pixelFormatPairs)
+	{
+		const FrameType::PixelFormat sourcePixelFormat = pixelFormatPair.first;
+		const FrameType::PixelFormat targetPixelFormat = pixelFormatPair.second;
+
+		ocean_assert(sourcePixelFormat != FrameType::FORMAT_UNDEFINED && targetPixelFormat != FrameType::FORMAT_UNDEFINED);
+
+		// the smallest frame with at least 16x16 pixels matching the conditions of both pixel formats
+
+		const unsigned int widthMultiple = std::max(FrameType::widthMultiple(sourcePixelFormat), FrameType::widthMultiple(targetPixelFormat));
+		const unsigned int heightMultiple = std::max(FrameType::heightMultiple(sourcePixelFormat), FrameType::heightMultiple(targetPixelFormat));
+
+		const unsigned int width = (16u + widthMultiple - 1u) / widthMultiple * widthMultiple;
+		const unsigned int height = (16u + heightMultiple - 1u) / heightMultiple * heightMultiple;
+
+		const FrameType sourceFrameType(width, height, sourcePixelFormat, FrameType::ORIGIN_UPPER_LEFT);
+
+		if (!sourceFrameType.isValid() || !isSupported(sourceFrameType, targetPixelFormat, FrameType::ORIGIN_UPPER_LEFT, options))
+		{
+			allSucceeded = false;
+			continue;
+		}
+
+		Frame sourceFrame(sourceFrameType);
+
+		if (!sourceFrame.isValid())
+		{
+			allSucceeded = false;
+			continue;
+		}
+
+		for (unsigned int planeIndex = 0u; planeIndex < sourceFrame.numberPlanes(); ++planeIndex)
+		{
+			sourceFrame.setValue(0x00u, planeIndex);
+		}
+
+		Frame targetFrame;
+		if (!convert(sourceFrame, targetPixelFormat, FrameType::ORIGIN_UPPER_LEFT, targetFrame, CP_ALWAYS_COPY, nullptr, options))
+		{
+			allSucceeded = false;
+		}
+	}
+
+	return allSucceeded;
+}
+
 bool FrameConverter::Comfort::convertCompatibleFormats(const Frame& source, const FrameType& targetType, Frame& target, const bool forceCopy)
 {
 	ocean_assert(source.isValid());
@@ -2191,6 +2254,109 @@ void FrameConverter::convertTwoRows_1Plane1ChannelAnd1Plane2ChannelsDownsampled2
 
 #endif // OCEAN_HARDWARE_NEON_VERSION >= 10
 
+#if defined(OCEAN_HARDWARE_SSE_VERSION) && OCEAN_HARDWARE_SSE_VERSION >= 41 && defined(OCEAN_HARDWARE_AVX_VERSION) && OCEAN_HARDWARE_AVX_VERSION >= 20
+
+	constexpr unsigned int blockSize = 32u;
+	const unsigned int blocks = width / blockSize;
+
+	if (blocks >= 1u)
+	{
+		const __m256i factorChannel00_64_s_16x16 = _mm256_set1_epi16(int16_t(factorChannel00_64));
+		const __m256i factorChannel10_64_s_16x16 = _mm256_set1_epi16(int16_t(factorChannel10_64));
+		const __m256i factorChannel20_64_s_16x16 = _mm256_set1_epi16(int16_t(factorChannel20_64));
+
+		const __m256i factorChannel01_64_s_16x16 = _mm256_set1_epi16(int16_t(factorChannel01_64));
+		const __m256i factorChannel11_64_s_16x16 = _mm256_set1_epi16(int16_t(factorChannel11_64));
+		const __m256i factorChannel21_64_s_16x16 = _mm256_set1_epi16(int16_t(factorChannel21_64));
+
+		const __m256i factorChannel02_64_s_16x16 = _mm256_set1_epi16(int16_t(factorChannel02_64));
+		const __m256i factorChannel12_64_s_16x16 = _mm256_set1_epi16(int16_t(factorChannel12_64));
+		const __m256i factorChannel22_64_s_16x16 = _mm256_set1_epi16(int16_t(factorChannel22_64));
+
+		const __m256i biasChannel0_s_16x16 = _mm256_set1_epi16(int16_t(bias0));
+		const __m256i biasChannel1_s_16x16 = _mm256_set1_epi16(int16_t(bias1));
+		const __m256i biasChannel2_s_16x16 = _mm256_set1_epi16(int16_t(bias2));
+
+		const __m256i maskLow_u_16x16 = _mm256_set1_epi16(0x00FF);
+
+		for (unsigned int n = 0u; n < blocks; ++n)
+		{
+			// 16 interleaved uv pairs for 32 pixels (in two rows)
+
+			const __m256i sourcePlane1_u_8x32 = _mm256_loadu_si256((const __m256i*)sourcePlane1);
+
+			// U' = U - bias1, V' = V - bias2
+			const __m256i source1_s_16x16 = _mm256_sub_epi16(_mm256_and_si256(sourcePlane1_u_8x32, maskLow_u_16x16), biasChannel1_s_16x16);
+			const __m256i source2_s_16x16 = _mm256_sub_epi16(_mm256_srli_epi16(sourcePlane1_u_8x32, 8), biasChannel2_s_16x16);
+
+			// first we apply the 3x3 matrix multiplication for the second and third channel
+
+			const __m256i intermediateResults0_s_16x16 = _mm256_adds_epi16(_mm256_mullo_epi16(source1_s_16x16, factorChannel01_64_s_16x16), _mm256_mullo_epi16(source2_s_16x16, factorChannel02_64_s_16x16));
+			const __m256i intermediateResults1_s_16x16 = _mm256_adds_epi16(_mm256_mullo_epi16(source1_s_16x16, factorChannel11_64_s_16x16), _mm256_mullo_epi16(source2_s_16x16, factorChannel12_64_s_16x16));
+			const __m256i intermediateResults2_s_16x16 = _mm256_adds_epi16(_mm256_mullo_epi16(source1_s_16x16, factorChannel21_64_s_16x16), _mm256_mullo_epi16(source2_s_16x16, factorChannel22_64_s_16x16));
+
+			// we up-sample the results for the second and third channel, the unpack instructions are applied per 128 bit lane so that we need to reorder both lanes afterwards
+
+			__m256i intermediateResults_s_16x16[3][2];
+
+			const __m256i* const intermediateResults[3] = {&intermediateResults0_s_16x16, &intermediateResults1_s_16x16, &intermediateResults2_s_16x16};
+
+			for (unsigned int c = 0u; c < 3u; ++c)
+			{
+				const __m256i low_s_16x16 = _mm256_unpacklo_epi16(*intermediateResults[c], *intermediateResults[c]);
+				const __m256i high_s_16x16 = _mm256_unpackhi_epi16(*intermediateResults[c], *intermediateResults[c]);
+
+				intermediateResults_s_16x16[c][0] = _mm256_permute2x128_si256(low_s_16x16, high_s_16x16, 0x20); // pixels [0, 15]
+				intermediateResults_s_16x16[c][1] = _mm256_permute2x128_si256(low_s_16x16, high_s_16x16, 0x31); // pixels [16, 31]
+			}
+
+			const uint8_t* const sourcePlane0Rows[2] = {sourcePlane0Upper, sourcePlane0Upper + sourcePlane0StrideElements};
+			uint8_t* const targetPlaneRows[2] = {targetPlaneUpper, targetPlaneLower};
+
+			for (unsigned int nRow = 0u; nRow < 2u; ++nRow)
+			{
+				for (unsigned int nHalf = 0u; nHalf < 2u; ++nHalf)
+				{
+					// Y' = Y - bias0
+					const __m256i source0_s_16x16 = _mm256_sub_epi16(_mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i*)(sourcePlane0Rows[nRow] + nHalf * 16u))), biasChannel0_s_16x16);
+
+					// now we apply the 3x3 matrix multiplication, and we normalize the results by 2^6
+
+					const __m256i results0_s_16x16 = _mm256_srai_epi16(_mm256_adds_epi16(intermediateResults_s_16x16[0][nHalf], _mm256_mullo_epi16(source0_s_16x16, factorChannel00_64_s_16x16)), 6);
+					const __m256i results1_s_16x16 = _mm256_srai_epi16(_mm256_adds_epi16(intermediateResults_s_16x16[1][nHalf], _mm256_mullo_epi16(source0_s_16x16, factorChannel10_64_s_16x16)), 6);
+					const __m256i results2_s_16x16 = _mm256_srai_epi16(_mm256_adds_epi16(intermediateResults_s_16x16[2][nHalf], _mm256_mullo_epi16(source0_s_16x16, factorChannel20_64_s_16x16)), 6);
+
+					// saturated narrow signed to unsigned
+
+					const __m128i results0_u_8x16 = _mm_packus_epi16(_mm256_castsi256_si128(results0_s_16x16), _mm256_extracti128_si256(results0_s_16x16, 1));
+					const __m128i results1_u_8x16 = _mm_packus_epi16(_mm256_castsi256_si128(results1_s_16x16), _mm256_extracti128_si256(results1_s_16x16, 1));
+					const __m128i results2_u_8x16 = _mm_packus_epi16(_mm256_castsi256_si128(results2_s_16x16), _mm256_extracti128_si256(results2_s_16x16, 1));
+
+					__m128i interleavedA_u_8x16;
+					__m128i interleavedB_u_8x16;
+					__m128i interleavedC_u_8x16;
+					SSE::interleave3Channel8Bit48Elements(results0_u_8x16, results1_u_8x16, results2_u_8x16, interleavedA_u_8x16, interleavedB_u_8x16, interleavedC_u_8x16);
+
+					// and we can store the result
+
+					uint8_t* const target = targetPlaneRows[nRow] + nHalf * 16u * 3u;
+
+					_mm_storeu_si128((__m128i*)target + 0, interleavedA_u_8x16);
+					_mm_storeu_si128((__m128i*)target + 1, interleavedB_u_8x16);
+					_mm_storeu_si128((__m128i*)target + 2, interleavedC_u_8x16);
+				}
+			}
+
+			sourcePlane0Upper += blockSize;
+			sourcePlane1 += blockSize; // 2x2 downsampled, but two channels
+
+			targetPlaneUpper += blockSize * 3u;
+			targetPlaneLower += blockSize * 3u;
+		}
+	}
+
+#endif // OCEAN_HARDWARE_SSE_VERSION >= 41 && OCEAN_HARDWARE_AVX_VERSION >= 20
+
 	while (sourcePlane0Upper != sPlaneUpperEnd)
 	{
 		ocean_assert(sourcePlane0Upper < sPlaneUpperEnd);
@@ -88,6 +88,16 @@ class OCEAN_CV_EXPORT FrameConverter
 		 */
 		using ConversionFlags = std::vector<ConversionFlag>;
 
+		/**
+		 * Definition of a pair combining a source pixel format (first) with a target pixel format (second).
+		 */
+		using PixelFormatPair = std::pair<FrameType::PixelFormat, FrameType::PixelFormat>;
+
+		/**
+		 * Definition of a vector holding pairs of source and target pixel formats.
+		 */
+		using PixelFormatPairs = std::vector<PixelFormatPair>;
+
 		/**
 		 * Definition of a boolean enum for copy preferences (to improve code readability).
 		 */
@@ -775,6 +785,18 @@ class OCEAN_CV_EXPORT FrameConverter
 				 */
 				static bool convertAndCopy(const Frame& source, Frame& target, Worker* worker = nullptr, const Options& options = Options());
 
+				/**
+				 * Prebuilds all tables which are necessary for frame conversions between specific pixel formats.
+				 * The table of conversion functions and lookup tables (e.g., for gamma correction) are created lazily with the first conversion,<br>
+				 * this function allows to create the tables before the first frame arrives, e.g., while an application is starting.<br>
+				 * Each conversion is executed once with a small frame, so that all tables the conversion depends on are created.
+				 * @param pixelFormatPairs The pairs of source and target pixel formats which will be used, can be empty to create the table of conversion functions only
+				 * @param options The options which will be used for the conversions
+				 * @param background True, to prebuild the tables asynchronously with a thread of the thread pool; False, to prebuild the tables before this function returns
+				 * @return True, if all conversions are supported (or if the tables are prebuilt in the background)
+				 */
+				static bool warmUp(const PixelFormatPairs& pixelFormatPairs, const Options& options = Options(), const bool background = false);
+
 				/**
 				 * Converts / changes a frame with arbitrary dimension, pixel format and pixel origin into a frame with the same dimension but different pixel format or pixel origin.
 				 * @param frame The frame to convert, must be valid
@@ -1374,6 +1396,17 @@ class OCEAN_CV_EXPORT FrameConverter
 		template <typename TSource, typename TTarget>
 		static inline void cast16Elements(const TSource* const source, TTarget* const target);
 
+		/**
+		 * Casts one element from one data type to another data type.
+		 * The 16-bit float data type is casted via 32-bit float values.
+		 * @param value The source element to be casted
+		 * @return The casted element
+		 * @tparam TSource The data type of the source element, e.g., 'uint8_t', 'int', 'float', 'Float16', ...
+		 * @tparam TTarget The data type of the target element, e.g., 'uint8_t', 'int', 'float', 'Float16', ...
+		 */
+		template <typename TSource, typename TTarget>
+		static inline TTarget castElement(const TSource& value);
+
 		/**
 		 * Converts a frame with generic pixel format (e.g., RGBA32, BGR24, YUV24, ...) to a frame with generic pixel format (e.g., RGB24, Y8).
 		 * This function needs a function pointer that is able to convert one row, and to reverse the order of pixels in one row in the target frame.
@@ -3049,7 +3082,7 @@ void FrameConverter::cast(const TSource* __restrict source, TTarget* __restrict
 	{
 		if (std::is_same<TSource, TTarget>::value)
 		{
-			memcpy(target, source, size_t(width * height * channels) * sizeof(TSource));
+			memcpy((void*)(target), source, size_t(width * height * channels) * sizeof(TSource));
 		}
 		else
 		{
@@ -3068,7 +3101,7 @@ void FrameConverter::cast(const TSource* __restrict source, TTarget* __restrict
 
 			for (unsigned int i = 0u; i < remainingElementsPerFrame; ++i)
 			{
-				target[i] = TTarget(source[i]);
+				target[i] = castElement<TSource, TTarget>(source[i]);
 			}
 		}
 	}
@@ -3083,7 +3116,7 @@ void FrameConverter::cast(const TSource* __restrict source, TTarget* __restrict
 
 			for (unsigned int y = 0u; y < height; ++y)
 			{
-				memcpy(target, source, bytesPerRowToCopy);
+				memcpy((void*)(target), source, bytesPerRowToCopy);
 
 				source += sourceStrideElements;
 				target += targetStrideElements;
@@ -3108,7 +3141,7 @@ void FrameConverter::cast(const TSource* __restrict source, TTarget* __restrict
 
 				for (unsigned int i = 0u; i < remainingElementsPerRow; ++i)
 				{
-					target[i] = TTarget(source[i]);
+					target[i] = castElement<TSource, TTarget>(source[i]);
 				}
 
 				source += remainingElementsPerRow + sourcePaddingElements;
@@ -3291,6 +3324,78 @@ OCEAN_FORCE_INLINE void FrameConverter::cast16Elements<float, uint8_t>(const flo
 	vst1q_u8(target, target_8x16);
 }
 
+#ifdef __aarch64__
+
+template <>
+OCEAN_FORCE_INLINE void FrameConverter::cast16Elements<float, Float16>(const float* const source, Float16* const target)
+{
+	static_assert(sizeof(Float16) == sizeof(uint16_t), "Invalid data type!");
+
+	// the hardware conversion rounds to nearest (ties to even), identical to Float16(float)
+
+	const float16x8_t target_16x8_0 = vcombine_f16(vcvt_f16_f32(vld1q_f32(source +  0)), vcvt_f16_f32(vld1q_f32(source +  4)));
+	const float16x8_t target_16x8_1 = vcombine_f16(vcvt_f16_f32(vld1q_f32(source +  8)), vcvt_f16_f32(vld1q_f32(source + 12)));
+
+	vst1q_u16((uint16_t*)(target) + 0, vreinterpretq_u16_f16(target_16x8_0));
+	vst1q_u16((uint16_t*)(target) + 8, vreinterpretq_u16_f16(target_16x8_1));
+}
+
+template <>
+OCEAN_FORCE_INLINE void FrameConverter::cast16Elements<Float16, float>(const Float16* const source, float* const target)
+{
+	static_assert(sizeof(Float16) == sizeof(uint16_t), "Invalid data type!");
+
+	const float16x8_t source_16x8_0 = vreinterpretq_f16_u16(vld1q_u16((const uint16_t*)(source) + 0));
+	const float16x8_t source_16x8_1 = vreinterpretq_f16_u16(vld1q_u16((const uint16_t*)(source) + 8));
+
+	vst1q_f32(target +  0, vcvt_f32_f16(vget_low_f16(source_16x8_0)));
+	vst1q_f32(target +  4, vcvt_f32_f16(vget_high_f16(source_16x8_0)));
+	vst1q_f32(target +  8, vcvt_f32_f16(vget_low_f16(source_16x8_1)));
+	vst1q_f32(target + 12, vcvt_f32_f16(vget_high_f16(source_16x8_1)));
+}
+
+template <>
+OCEAN_FORCE_INLINE void FrameConverter::cast16Elements<uint8_t, Float16>(const uint8_t* const source, Float16* const target)
+{
+	static_assert(sizeof(Float16) == sizeof(uint16_t), "Invalid data type!");
+
+	// all 8 bit values can be represented exactly by 16-bit floats
+
+	const uint8x16_t source_8x16 = vld1q_u8(source);
+
+	const uint16x8_t source_16x8_0 = vmovl_u8(vget_low_u8(source_8x16));
+	const uint16x8_t source_16x8_1 = vmovl_u8(vget_high_u8(source_8x16));
+
+	const float16x8_t target_16x8_0 = vcombine_f16(vcvt_f16_f32(vcvtq_f32_u32(vmovl_u16(vget_low_u16(source_16x8_0)))), vcvt_f16_f32(vcvtq_f32_u32(vmovl_u16(vget_high_u16(source_16x8_0)))));
+	const float16x8_t target_16x8_1 = vcombine_f16(vcvt_f16_f32(vcvtq_f32_u32(vmovl_u16(vget_low_u16(source_16x8_1)))), vcvt_f16_f32(vcvtq_f32_u32(vmovl_u16(vget_high_u16(source_16x8_1)))));
+
+	vst1q_u16((uint16_t*)(target) + 0, vreinterpretq_u16_f16(target_16x8_0));
+	vst1q_u16((uint16_t*)(target) + 8, vreinterpretq_u16_f16(target_16x8_1));
+}
+
+template <>
+OCEAN_FORCE_INLINE void FrameConverter::cast16Elements<Float16, uint8_t>(const Float16* const source, uint8_t* const target)
+{
+	static_assert(sizeof(Float16) == sizeof(uint16_t), "Invalid data type!");
+
+	const float16x8_t source_16x8_0 = vreinterpretq_f16_u16(vld1q_u16((const uint16_t*)(source) + 0));
+	const float16x8_t source_16x8_1 = vreinterpretq_f16_u16(vld1q_u16((const uint16_t*)(source) + 8));
+
+	// truncation towards zero, identical to uint8_t(float(value))
+
+	const uint32x4_t target_32x4_0 = vcvtq_u32_f32(vcvt_f32_f16(vget_low_f16(source_16x8_0)));
+	const uint32x4_t target_32x4_1 = vcvtq_u32_f32(vcvt_f32_f16(vget_high_f16(source_16x8_0)));
+	const uint32x4_t target_32x4_2 = vcvtq_u32_f32(vcvt_f32_f16(vget_low_f16(source_16x8_1)));
+	const uint32x4_t target_32x4_3 = vcvtq_u32_f32(vcvt_f32_f16(vget_high_f16(source_16x8_1)));
+
+	const uint16x8_t target_16x8_0 = vcombine_u16(vmovn_u32(target_32x4_0), vmovn_u32(target_32x4_1));
+	const uint16x8_t target_16x8_1 = vcombine_u16(vmovn_u32(target_32x4_2), vmovn_u32(target_32x4_3));
+
+	vst1q_u8(target, vcombine_u8(vmovn_u16(target_16x8_0), vmovn_u16(target_16x8_1)));
+}
+
+#endif // __aarch64__
+
 #endif // #if defined(OCEAN_HARDWARE_NEON_VERSION) && OCEAN_HARDWARE_NEON_VERSION >= 10
 
 template <typename TSource, typename TTarget>
@@ -3298,7 +3403,24 @@ OCEAN_FORCE_INLINE void FrameConverter::cast16Elements(const TSource* const sour
 {
 	for (unsigned int i = 0u; i < 16u; ++i)
 	{
-		target[i] = TTarget(source[i]);
+		target[i] = castElement<TSource, TTarget>(source[i]);
+	}
+}
+
+template <typename TSource, typename TTarget>
+OCEAN_FORCE_INLINE TTarget FrameConverter::castElement(const TSource& value)
+{
+	if constexpr (std::is_same<TSource, Float16>::value && !std::is_same<TTarget, Float16>::value)
+	{
+		return TTarget(float(value));
+	}
+	else if constexpr (std::is_same<TTarget, Float16>::value && !std::is_same<TSource, Float16>::value)
+	{
+		return Float16(float(value));
+	}
+	else
+	{
+		return TTarget(value);
 	}
 }
 
@@ -0,0 +1,620 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "ocean/cv/FrameConverterY_UV12.h"
+
+#include "ocean/base/Memory.h"
+
+#if defined(OCEAN_HARDWARE_SSE_VERSION) && OCEAN_HARDWARE_SSE_VERSION >= 41
+	#include "ocean/cv/SSE.h"
+#endif
+
+#if defined(OCEAN_HARDWARE_NEON_VERSION) && OCEAN_HARDWARE_NEON_VERSION >= 10
+	#include "ocean/cv/NEON.h"
+#endif
+
+namespace Ocean
+{
+
+namespace CV
+{
+
+void FrameConverterY_UV12::convertY_UV12LimitedRangeToRGB24FullRangeResized(const uint8_t* ySource, const uint8_t* uvSource, uint8_t* target, const unsigned int sourceWidth, const unsigned int sourceHeight, const unsigned int targetWidth, const unsigned int targetHeight, const unsigned int ySourcePaddingElements, const unsigned int uvSourcePaddingElements, const unsigned int targetPaddingElements, Worker* worker)
+{
+	// Approximation with 6 bit precision, identical to convertY_UV12LimitedRangeToRGB24FullRange():
+	//      | R |     | 75    0     102 |   | Y -  16 |
+	// 64 * | G |  =  | 75   -25   -52  | * | U - 128 |
+	//      | B |     | 75   128     0  |   | V - 128 |
+
+	const int options[12] =
+	{
+		// multiplication parameters
+		75, 75, 75, 0, -25, 128, 102, -52, 0,
+
+		// bias/translation parameters
+		16, 128, 128
+	};
+
+	convertY_UV12ToRGBResized<3u>(ySource, uvSource, target, sourceWidth, sourceHeight, targetWidth, targetHeight, ySourcePaddingElements, uvSourcePaddingElements, targetPaddingElements, options, 0xFFu, worker);
+}
+
+void FrameConverterY_UV12::convertY_UV12FullRangeToRGB24FullRangeResized(const uint8_t* ySource, const uint8_t* uvSource, uint8_t* target, const unsigned int sourceWidth, const unsigned int sourceHeight, const unsigned int targetWidth, const unsigned int targetHeight, const unsigned int ySourcePaddingElements, const unsigned int uvSourcePaddingElements, const unsigned int targetPaddingElements, Worker* worker)
+{
+	// Approximation with 6 bit precision, identical to convertY_UV12FullRangeToRGB24FullRange():
+	//      | R |     | 64    0     90 |   |    Y    |
+	// 64 * | G |  =  | 64   -22   -46 | * | U - 128 |
+	//      | B |     | 64   113     0 |   | V - 128 |
+
+	const int options[12] =
+	{
+		// multiplication parameters
+		64, 64, 64, 0, -22, 113, 90, -46, 0,
+
+		// bias/translation parameters
+		0, 128, 128
+	};
+
+	convertY_UV12ToRGBResized<3u>(ySource, uvSource, target, sourceWidth, sourceHeight, targetWidth, targetHeight, ySourcePaddingElements, uvSourcePaddingElements, targetPaddingElements, options, 0xFFu, worker);
+}
+
+void FrameConverterY_UV12::convertY_UV12LimitedRangeToRGBA32FullRangeResized(const uint8_t* ySource, const uint8_t* uvSource, uint8_t* target, const unsigned int sourceWidth, const unsigned int sourceHeight, const unsigned int targetWidth, const unsigned int targetHeight, const unsigned int ySourcePaddingElements, const unsigned int uvSourcePaddingElements, const unsigned int targetPaddingElements, const uint8_t alphaValue, Worker* worker)
+{
+	const int options[12] =
+	{
+		// multiplication parameters
+		75, 75, 75, 0, -25, 128, 102, -52, 0,
+
+		// bias/translation parameters
+		16, 128, 128
+	};
+
+	convertY_UV12ToRGBResized<4u>(ySource, uvSource, target, sourceWidth, sourceHeight, targetWidth, targetHeight, ySourcePaddingElements, uvSourcePaddingElements, targetPaddingElements, options, alphaValue, worker);
+}
+
+void FrameConverterY_UV12::convertY_UV12FullRangeToRGBA32FullRangeResized(const uint8_t* ySource, const uint8_t* uvSource, uint8_t* target, const unsigned int sourceWidth, const unsigned int sourceHeight, const unsigned int targetWidth, const unsigned int targetHeight, const unsigned int ySourcePaddingElements, const unsigned int uvSourcePaddingElements, const unsigned int targetPaddingElements, const uint8_t alphaValue, Worker* worker)
+{
+	const int options[12] =
+	{
+		// multiplication parameters
+		64, 64, 64, 0, -22, 113, 90, -46, 0,
+
+		// bias/translation parameters
+		0, 128, 128
+	};
+
+	convertY_UV12ToRGBResized<4u>(ySource, uvSource, target, sourceWidth, sourceHeight, targetWidth, targetHeight, ySourcePaddingElements, uvSourcePaddingElements, targetPaddingElements, options, alphaValue, worker);
+}
+
+template <unsigned int tTargetChannels>
+void FrameConverterY_UV12::convertY_UV12ToRGBResized(const uint8_t* ySource, const uint8_t* uvSource, uint8_t* target, const unsigned int sourceWidth, const unsigned int sourceHeight, const unsigned int targetWidth, const unsigned int targetHeight, const unsigned int ySourcePaddingElements, const unsigned int uvSourcePaddingElements, const unsigned int targetPaddingElements, const int* options, const uint8_t alphaValue, Worker* worker)
+{
+	static_assert(tTargetChannels == 3u || tTargetChannels == 4u, "Invalid channel number!");
+
+	ocean_assert(ySource != nullptr && uvSource != nullptr && target != nullptr);
+	ocean_assert(options != nullptr);
+
+	ocean_assert(sourceWidth >= 2u && sourceWidth % 2u == 0u);
+	ocean_assert(sourceHeight >= 2u && sourceHeight % 2u == 0u);
+	ocean_assert(targetWidth >= 1u && targetHeight >= 1u);
+
+	if (sourceWidth < 2u || sourceHeight < 2u || sourceWidth % 2u != 0u || sourceHeight % 2u != 0u || targetWidth == 0u || targetHeight == 0u)
+	{
+		return;
+	}
+
+	if (sourceWidth == targetWidth * 2u && sourceHeight == targetHeight * 2u)
+	{
+		// the target pixels and the uv pairs have the same resolution, so that we can avoid any interpolation
+
+		if (worker != nullptr)
+		{
+			worker->executeFunction(Worker::Function::createStatic(&convertY_UV12ToRGBHalfSizeSubset<tTargetChannels>, ySource, uvSource, target, targetWidth, targetHeight, ySourcePaddingElements, uvSourcePaddingElements, targetPaddingElements, options, alphaValue, 0u, 0u), 0u, targetHeight);
+		}
+		else
+		{
+			convertY_UV12ToRGBHalfSizeSubset<tTargetChannels>(ySource, uvSource, target, targetWidth, targetHeight, ySourcePaddingElements, uvSourcePaddingElements, targetPaddingElements, options, alphaValue, 0u, targetHeight);
+		}
+	}
+	else
+	{
+		if (worker != nullptr)
+		{
+			worker->executeFunction(Worker::Function::createStatic(&convertY_UV12ToRGBResizedSubset<tTargetChannels>, ySource, uvSource, target, sourceWidth, sourceHeight, targetWidth, targetHeight, ySourcePaddingElements, uvSourcePaddingElements, targetPaddingElements, options, alphaValue, 0u, 0u), 0u, targetHeight);
+		}
+		else
+		{
+			convertY_UV12ToRGBResizedSubset<tTargetChannels>(ySource, uvSource, target, sourceWidth, sourceHeight, targetWidth, targetHeight, ySourcePaddingElements, uvSourcePaddingElements, targetPaddingElements, options, alphaValue, 0u, targetHeight);
+		}
+	}
+}
+
+template <unsigned int tTargetChannels>
+void FrameConverterY_UV12::convertY_UV12ToRGBResizedSubset(const uint8_t* ySource, const uint8_t* uvSource, uint8_t* target, const unsigned int sourceWidth, const unsigned int sourceHeight, const unsigned int targetWidth, const unsigned int targetHeight, const unsigned int ySourcePaddingElements, const unsigned int uvSourcePaddingElements, const unsigned int targetPaddingElements, const int* options, const uint8_t alphaValue, const unsigned int firstTargetRow, const unsigned int numberTargetRows)
+{
+	ocean_assert(ySource != nullptr && uvSource != nullptr && target != nullptr);
+	ocean_assert(sourceWidth >= 2u && sourceWidth % 2u == 0u);
+	ocean_assert(sourceHeight >= 2u && sourceHeight % 2u == 0u);
+	ocean_assert(targetWidth >= 1u && targetHeight >= 1u);
+	ocean_assert(firstTargetRow + numberTargetRows <= targetHeight);
+
+	/*
+	 * The y plane and the uv plane are sampled individually with the same sub-pixel mapping as used in FrameInterpolatorBilinear::scale8BitPerChannelSubset():
+	 * sourceX = (targetX + 0.5) * sourceX_s_targetX - 0.5
+	 *
+	 * The uv plane has half the resolution of the y plane, so that the chroma samples are located at the centers of the 2x2 y blocks.
+	 * For each target row, we first interpolate the two involved source rows vertically (SIMD, 7 bit precision),
+	 * then we sample the intermediate rows horizontally (7 bit precision), and finally we convert the sampled YUV row to RGB.
+	 */
+
+	const unsigned int uvSourceWidth = sourceWidth / 2u;
+	const unsigned int uvSourceHeight = sourceHeight / 2u;
+
+	const unsigned int ySourceStrideElements = sourceWidth + ySourcePaddingElements;
+	const unsigned int uvSourceStrideElements = sourceWidth + uvSourcePaddingElements; // 2x2 downsampling but 2 channels
+	const unsigned int targetStrideElements = targetWidth * tTargetChannels + targetPaddingElements;
+
+	const double sourceX_s_targetX = double(sourceWidth) / double(targetWidth);
+	const double sourceY_s_targetY = double(sourceHeight) / double(targetHeight);
+
+	const double uvSourceX_s_targetX = double(uvSourceWidth) / double(targetWidth);
+	const double uvSourceY_s_targetY = double(uvSourceHeight) / double(targetHeight);
+
+	// the horizontal lookup tables: left source pixel, right source pixel, and factor for the right source pixel (for y and for uv)
+
+	Memory lookupMemory = Memory::create<unsigned int>(targetWidth * 6u);
+	unsigned int* const yLefts = lookupMemory.data<unsigned int>();
+	unsigned int* const yRights = yLefts + targetWidth;
+	unsigned int* const yFactorsRight = yRights + targetWidth;
+	unsigned int* const uvLefts = yFactorsRight + targetWidth;
+	unsigned int* const uvRights = uvLefts + targetWidth;
+	unsigned int* const uvFactorsRight = uvRights + targetWidth;
+
+	for (unsigned int x = 0u; x < targetWidth; ++x)
+	{
+		const double sx = minmax(0.0, (double(x) + 0.5) * sourceX_s_targetX - 0.5, double(sourceWidth - 1u));
+		const double uvSx = minmax(0.0, (double(x) + 0.5) * uvSourceX_s_targetX - 0.5, double(uvSourceWidth - 1u));
+
+		yLefts[x] = (unsigned int)(sx);
+		yRights[x] = std::min(yLefts[x] + 1u, sourceWidth - 1u);
+		yFactorsRight[x] = (unsigned int)((sx - double(yLefts[x])) * 128.0 + 0.5);
+
+		uvLefts[x] = (unsigned int)(uvSx);
+		uvRights[x] = std::min(uvLefts[x] + 1u, uvSourceWidth - 1u);
+		uvFactorsRight[x] = (unsigned int)((uvSx - double(uvLefts[x])) * 128.0 + 0.5);
+
+		ocean_assert(yFactorsRight[x] <= 128u && uvFactorsRight[x] <= 128u);
+	}
+
+	// the vertically interpolated source rows (y and uv have the same number of elements), and the sampled target row
+
+	Memory intermediateMemory = Memory::create<uint16_t>(sourceWidth * 2u);
+	uint16_t* const intermediateRows[2] =
+	{
+		intermediateMemory.data<uint16_t>(),
+		intermediateMemory.data<uint16_t>() + sourceWidth
+	};
+
+	Memory sampledMemory = Memory::create<uint8_t>(targetWidth * 3u);
+	uint8_t* const yRow = sampledMemory.data<uint8_t>();
+	uint8_t* const uvRow = yRow + targetWidth;
+
+	for (unsigned int y = firstTargetRow; y < firstTargetRow + numberTargetRows; ++y)
+	{
+		const double sy = minmax(0.0, (double(y) + 0.5) * sourceY_s_targetY - 0.5, double(sourceHeight - 1u));
+		const double uvSy = minmax(0.0, (double(y) + 0.5) * uvSourceY_s_targetY - 0.5, double(uvSourceHeight - 1u));
+
+		const unsigned int yTop = (unsigned int)(sy);
+		const unsigned int uvTop = (unsigned int)(uvSy);
+
+		const unsigned int factorsBottom[2] =
+		{
+			(unsigned int)((sy - double(yTop)) * 128.0 + 0.5),
+			(unsigned int)((uvSy - double(uvTop)) * 128.0 + 0.5)
+		};
+
+		ocean_assert(factorsBottom[0] <= 128u && factorsBottom[1] <= 128u);
+
+		const uint8_t* const sourceTops[2] =
+		{
+			ySource + yTop * ySourceStrideElements,
+			uvSource + uvTop * uvSourceStrideElements
+		};
+
+		const uint8_t* const sourceBottoms[2] =
+		{
+			ySource + std::min(yTop + 1u, sourceHeight - 1u) * ySourceStrideElements,
+			uvSource + std::min(uvTop + 1u, uvSourceHeight - 1u) * uvSourceStrideElements
+		};
+
+		for (unsigned int plane = 0u; plane < 2u; ++plane)
+		{
+			const uint8_t* sourceTop = sourceTops[plane];
+			const uint8_t* sourceBottom = sourceBottoms[plane];
+			uint16_t* intermediateRow = intermediateRows[plane];
+
+			const unsigned int factorBottom = factorsBottom[plane];
+			const unsigned int factorTop = 128u - factorBottom;
+
+			unsigned int x = 0u;
+
+#if defined(OCEAN_HARDWARE_SSE_VERSION) && OCEAN_HARDWARE_SSE_VERSION >= 41
+
+			const __m128i factorTop_u_16x8 = _mm_set1_epi16(short(factorTop));
+			const __m128i factorBottom_u_16x8 = _mm_set1_epi16(short(factorBottom));
+			const __m128i zero_u_8x16 = _mm_setzero_si128();
+
+			for (; x + 16u <= sourceWidth; x += 16u)
+			{
+				const __m128i top_u_8x16 = _mm_lddqu_si128((const __m128i*)(sourceTop + x));
+				const __m128i bottom_u_8x16 = _mm_lddqu_si128((const __m128i*)(sourceBottom + x));
+
+				// top * factorTop + bottom * factorBottom, with range [0, 255 * 128]
+
+				const __m128i resultLow_u_16x8 = _mm_add_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(top_u_8x16, zero_u_8x16), factorTop_u_16x8), _mm_mullo_epi16(_mm_unpacklo_epi8(bottom_u_8x16, zero_u_8x16), factorBottom_u_16x8));
+				const __m128i resultHigh_u_16x8 = _mm_add_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(top_u_8x16, zero_u_8x16), factorTop_u_16x8), _mm_mullo_epi16(_mm_unpackhi_epi8(bottom_u_8x16, zero_u_8x16), factorBottom_u_16x8));
+
+				_mm_storeu_si128((__m128i*)(intermediateRow + x + 0u), resultLow_u_16x8);
+				_mm_storeu_si128((__m128i*)(intermediateRow + x + 8u), resultHigh_u_16x8);
+			}
+
+#elif defined(OCEAN_HARDWARE_NEON_VERSION) && OCEAN_HARDWARE_NEON_VERSION >= 10
+
+			const uint8x8_t factorTop_u_8x8 = vdup_n_u8(uint8_t(factorTop)); // factorTop == 128 fits into uint8_t
+			const uint8x8_t factorBottom_u_8x8 = vdup_n_u8(uint8_t(factorBottom));
+
+			for (; x + 16u <= sourceWidth; x += 16u)
+			{
+				const uint8x16_t top_u_8x16 = vld1q_u8(sourceTop + x);
+				const uint8x16_t bottom_u_8x16 = vld1q_u8(sourceBottom + x);
+
+				// top * factorTop + bottom * factorBottom, with range [0, 255 * 128]
+
+				vst1q_u16(intermediateRow + x + 0u, vmlal_u8(vmull_u8(vget_low_u8(top_u_8x16), factorTop_u_8x8), vget_low_u8(bottom_u_8x16), factorBottom_u_8x8));
+				vst1q_u16(intermediateRow + x + 8u, vmlal_u8(vmull_u8(vget_high_u8(top_u_8x16), factorTop_u_8x8), vget_high_u8(bottom_u_8x16), factorBottom_u_8x8));
+			}
+
+#endif
+
+			for (; x < sourceWidth; ++x)
+			{
+				intermediateRow[x] = uint16_t(sourceTop[x] * factorTop + sourceBottom[x] * factorBottom);
+			}
+		}
+
+		const uint16_t* const yIntermediateRow = intermediateRows[0];
+		const uint16_t* const uvIntermediateRow = intermediateRows[1];
+
+		for (unsigned int x = 0u; x < targetWidth; ++x)
+		{
+			const unsigned int yFactorRight = yFactorsRight[x];
+			const unsigned int yFactorLeft = 128u - yFactorRight;
+
+			yRow[x] = uint8_t((yIntermediateRow[yLefts[x]] * yFactorLeft + yIntermediateRow[yRights[x]] * yFactorRight + 8192u) >> 14u);
+
+			const unsigned int uvFactorRight = uvFactorsRight[x];
+			const unsigned int uvFactorLeft = 128u - uvFactorRight;
+
+			const uint16_t* const uvLeft = uvIntermediateRow + uvLefts[x] * 2u;
+			const uint16_t* const uvRight = uvIntermediateRow + uvRights[x] * 2u;
+
+			uvRow[x * 2u + 0u] = uint8_t((uvLeft[0] * uvFactorLeft + uvRight[0] * uvFactorRight + 8192u) >> 14u);
+			uvRow[x * 2u + 1u] = uint8_t((uvLeft[1] * uvFactorLeft + uvRight[1] * uvFactorRight + 8192u) >> 14u);
+		}
+
+		convertRowYUVToRGBPrecision6Bit<tTargetChannels>(yRow, uvRow, target + y * targetStrideElements, targetWidth, options, alphaValue);
+	}
+}
+
+template <unsigned int tTargetChannels>
+void FrameConverterY_UV12::convertY_UV12ToRGBHalfSizeSubset(const uint8_t* ySource, const uint8_t* uvSource, uint8_t* target, const unsigned int targetWidth, const unsigned int targetHeight, const unsigned int ySourcePaddingElements, const unsigned int uvSourcePaddingElements, const unsigned int targetPaddingElements, const int* options, const uint8_t alphaValue, const unsigned int firstTargetRow, const unsigned int numberTargetRows)
+{
+	ocean_assert(ySource != nullptr && uvSource != nullptr && target != nullptr);
+	ocean_assert(targetWidth >= 1u && targetHeight >= 1u);
+	ocean_assert_and_suppress_unused(firstTargetRow + numberTargetRows <= targetHeight, targetHeight);
+
+	const unsigned int sourceWidth = targetWidth * 2u;
+
+	const unsigned int ySourceStrideElements = sourceWidth + ySourcePaddingElements;
+	const unsigned int uvSourceStrideElements = sourceWidth + uvSourcePaddingElements; // 2x2 downsampling but 2 channels
+	const unsigned int targetStrideElements = targetWidth * tTargetChannels + targetPaddingElements;
+
+	Memory yRowMemory = Memory::create<uint8_t>(targetWidth);
+	uint8_t* const yRow = yRowMemory.data<uint8_t>();
+
+	for (unsigned int y = firstTargetRow; y < firstTargetRow + numberTargetRows; ++y)
+	{
+		const uint8_t* const ySourceTop = ySource + y * 2u * ySourceStrideElements;
+		const uint8_t* const ySourceBottom = ySourceTop + ySourceStrideElements;
+
+		// each target pixel covers a 2x2 block of y values and exactly one uv pair
+
+		unsigned int x = 0u;
+
+#if defined(OCEAN_HARDWARE_SSE_VERSION) && OCEAN_HARDWARE_SSE_VERSION >= 41
+
+		const __m128i ones_u_8x16 = _mm_set1_epi8(1);
+		const __m128i constant2_u_16x8 = _mm_set1_epi16(2);
+
+		for (; x + 16u <= targetWidth; x += 16u)
+		{
+			const __m128i topA_u_8x16 = _mm_lddqu_si128((const __m128i*)(ySourceTop + x * 2u + 0u));
+			const __m128i topB_u_8x16 = _mm_lddqu_si128((const __m128i*)(ySourceTop + x * 2u + 16u));
+			const __m128i bottomA_u_8x16 = _mm_lddqu_si128((const __m128i*)(ySourceBottom + x * 2u + 0u));
+			const __m128i bottomB_u_8x16 = _mm_lddqu_si128((const __m128i*)(ySourceBottom + x * 2u + 16u));
+
+			// (top0 + top1 + bottom0 + bottom1 + 2) / 4
+
+			const __m128i sumA_u_16x8 = _mm_add_epi16(_mm_maddubs_epi16(topA_u_8x16, ones_u_8x16), _mm_maddubs_epi16(bottomA_u_8x16, ones_u_8x16));
+			const __m128i sumB_u_16x8 = _mm_add_epi16(_mm_maddubs_epi16(topB_u_8x16, ones_u_8x16), _mm_maddubs_epi16(bottomB_u_8x16, ones_u_8x16));
+
+			const __m128i averageA_u_16x8 = _mm_srli_epi16(_mm_add_epi16(sumA_u_16x8, constant2_u_16x8), 2);
+			const __m128i averageB_u_16x8 = _mm_srli_epi16(_mm_add_epi16(sumB_u_16x8, constant2_u_16x8), 2);
+
+			_mm_storeu_si128((__m128i*)(yRow + x), _mm_packus_epi16(averageA_u_16x8, averageB_u_16x8));
+		}
+
+#elif defined(OCEAN_HARDWARE_NEON_VERSION) && OCEAN_HARDWARE_NEON_VERSION >= 10
+
+		for (; x + 16u <= targetWidth; x += 16u)
+		{
+			// (top0 + top1 + bottom0 + bottom1 + 2) / 4
+
+			const uint16x8_t sumA_u_16x8 = vpadalq_u8(vpaddlq_u8(vld1q_u8(ySourceTop + x * 2u + 0u)), vld1q_u8(ySourceBottom + x * 2u + 0u));
+			const uint16x8_t sumB_u_16x8 = vpadalq_u8(vpaddlq_u8(vld1q_u8(ySourceTop + x * 2u + 16u)), vld1q_u8(ySourceBottom + x * 2u + 16u));
+
+			vst1q_u8(yRow + x, vcombine_u8(vrshrn_n_u16(sumA_u_16x8, 2), vrshrn_n_u16(sumB_u_16x8, 2)));
+		}
+
+#endif
+
+		for (; x < targetWidth; ++x)
+		{
+			yRow[x] = uint8_t((ySourceTop[x * 2u] + ySourceTop[x * 2u + 1u] + ySourceBottom[x * 2u] + ySourceBottom[x * 2u + 1u] + 2u) / 4u);
+		}
+
+		convertRowYUVToRGBPrecision6Bit<tTargetChannels>(yRow, uvSource + y * uvSourceStrideElements, target + y * targetStrideElements, targetWidth, options, alphaValue);
+	}
+}
+
+template <unsigned int tTargetChannels>
+void FrameConverterY_UV12::convertRowYUVToRGBPrecision6Bit(const uint8_t* yRow, const uint8_t* uvRow, uint8_t* targetRow, const unsigned int width, const int* options, const uint8_t alphaValue)
+{
+	static_assert(tTargetChannels == 3u || tTargetChannels == 4u, "Invalid channel number!");
+
+	ocean_assert(yRow != nullptr && uvRow != nullptr && targetRow != nullptr);
+	ocean_assert(width >= 1u);
+	ocean_assert(options != nullptr);
+
+	// t0 = clamp(0, (f00 * (y - b0) + f01 * (u - b1) + f02 * (v - b2)) / 64, 255)
+	// t1 = clamp(0, (f10 * (y - b0) + f11 * (u - b1) + f12 * (v - b2)) / 64, 255)
+	// t2 = clamp(0, (f20 * (y - b0) + f21 * (u - b1) + f22 * (v - b2)) / 64, 255)
+
+	const int factorChannel00_64 = options[0];
+	const int factorChannel10_64 = options[1];
+	const int factorChannel20_64 = options[2];
+
+	const int factorChannel01_64 = options[3];
+	const int factorChannel11_64 = options[4];
+	const int factorChannel21_64 = options[5];
+
+	const int factorChannel02_64 = options[6];
+	const int factorChannel12_64 = options[7];
+	const int factorChannel22_64 = options[8];
+
+	ocean_assert(std::abs(factorChannel00_64 + factorChannel01_64 + factorChannel02_64) < 64 * 4);
+	ocean_assert(std::abs(factorChannel10_64 + factorChannel11_64 + factorChannel12_64) < 64 * 4);
+	ocean_assert(std::abs(factorChannel20_64 + factorChannel21_64 + factorChannel22_64) < 64 * 4);
+
+	const int bias0 = options[9];
+	const int bias1 = options[10];
+	const int bias2 = options[11];
+
+	ocean_assert(bias0 >= 0 && bias0 <= 128);
+	ocean_assert(bias1 >= 0 && bias1 <= 128);
+	ocean_assert(bias2 >= 0 && bias2 <= 128);
+
+	unsigned int x = 0u;
+
+#if defined(OCEAN_HARDWARE_SSE_VERSION) && OCEAN_HARDWARE_SSE_VERSION >= 41
+
+	const __m128i factorChannel00_64_s_16x8 = _mm_set1_epi16(short(factorChannel00_64));
+	const __m128i factorChannel10_64_s_16x8 = _mm_set1_epi16(short(factorChannel10_64));
+	const __m128i factorChannel20_64_s_16x8 = _mm_set1_epi16(short(factorChannel20_64));
+
+	const __m128i factorChannel01_64_s_16x8 = _mm_set1_epi16(short(factorChannel01_64));
+	const __m128i factorChannel11_64_s_16x8 = _mm_set1_epi16(short(factorChannel11_64));
+	const __m128i factorChannel21_64_s_16x8 = _mm_set1_epi16(short(factorChannel21_64));
+
+	const __m128i factorChannel02_64_s_16x8 = _mm_set1_epi16(short(factorChannel02_64));
+	const __m128i factorChannel12_64_s_16x8 = _mm_set1_epi16(short(factorChannel12_64));
+	const __m128i factorChannel22_64_s_16x8 = _mm_set1_epi16(short(factorChannel22_64));
+
+	const __m128i bias0_s_16x8 = _mm_set1_epi16(short(bias0));
+	const __m128i bias1_s_16x8 = _mm_set1_epi16(short(bias1));
+	const __m128i bias2_s_16x8 = _mm_set1_epi16(short(bias2));
+
+	const __m128i constant32_s_16x8 = _mm_set1_epi16(32);
+	const __m128i mask00FF_u_16x8 = _mm_set1_epi16(0x00FF);
+	const __m128i zero_u_8x16 = _mm_setzero_si128();
+
+	const __m128i alpha_u_8x16 = _mm_set1_epi8(char(alphaValue));
+
+	for (; x + 16u <= width; x += 16u)
+	{
+		const __m128i y_u_8x16 = _mm_lddqu_si128((const __m128i*)(yRow + x));
+
+		const __m128i uvA_u_8x16 = _mm_lddqu_si128((const __m128i*)(uvRow + x * 2u + 0u));
+		const __m128i uvB_u_8x16 = _mm_lddqu_si128((const __m128i*)(uvRow + x * 2u + 16u));
+
+		__m128i results_u_8x16[3];
+
+		for (unsigned int n = 0u; n < 2u; ++n)
+		{
+			const __m128i& uv_u_8x16 = n == 0u ? uvA_u_8x16 : uvB_u_8x16;
+
+			// Y' = Y - bias0, U' = U - bias1, V' = V - bias2
+			const __m128i y_s_16x8 = _mm_sub_epi16(n == 0u ? _mm_unpacklo_epi8(y_u_8x16, zero_u_8x16) : _mm_unpackhi_epi8(y_u_8x16, zero_u_8x16), bias0_s_16x8);
+			const __m128i u_s_16x8 = _mm_sub_epi16(_mm_and_si128(uv_u_8x16, mask00FF_u_16x8), bias1_s_16x8);
+			const __m128i v_s_16x8 = _mm_sub_epi16(_mm_srli_epi16(uv_u_8x16, 8), bias2_s_16x8);
+
+			// first we apply the matrix multiplication for the second and third channel, then we add the first channel (saturated)
+
+			__m128i intermediateResults0_s_16x8 = _mm_adds_epi16(_mm_mullo_epi16(u_s_16x8, factorChannel01_64_s_16x8), _mm_mullo_epi16(v_s_16x8, factorChannel02_64_s_16x8));
+			__m128i intermediateResults1_s_16x8 = _mm_adds_epi16(_mm_mullo_epi16(u_s_16x8, factorChannel11_64_s_16x8), _mm_mullo_epi16(v_s_16x8, factorChannel12_64_s_16x8));
+			__m128i intermediateResults2_s_16x8 = _mm_adds_epi16(_mm_mullo_epi16(u_s_16x8, factorChannel21_64_s_16x8), _mm_mullo_epi16(v_s_16x8, factorChannel22_64_s_16x8));
+
+			intermediateResults0_s_16x8 = _mm_adds_epi16(intermediateResults0_s_16x8, _mm_mullo_epi16(y_s_16x8, factorChannel00_64_s_16x8));
+			intermediateResults1_s_16x8 = _mm_adds_epi16(intermediateResults1_s_16x8, _mm_mullo_epi16(y_s_16x8, factorChannel10_64_s_16x8));
+			intermediateResults2_s_16x8 = _mm_adds_epi16(intermediateResults2_s_16x8, _mm_mullo_epi16(y_s_16x8, factorChannel20_64_s_16x8));
+
+			// rounded normalization by 2^6
+
+			intermediateResults0_s_16x8 = _mm_srai_epi16(_mm_adds_epi16(intermediateResults0_s_16x8, constant32_s_16x8), 6);
+			intermediateResults1_s_16x8 = _mm_srai_epi16(_mm_adds_epi16(intermediateResults1_s_16x8, constant32_s_16x8), 6);
+			intermediateResults2_s_16x8 = _mm_srai_epi16(_mm_adds_epi16(intermediateResults2_s_16x8, constant32_s_16x8), 6);
+
+			if (n == 0u)
+			{
+				results_u_8x16[0] = intermediateResults0_s_16x8;
+				results_u_8x16[1] = intermediateResults1_s_16x8;
+				results_u_8x16[2] = intermediateResults2_s_16x8;
+			}
+			else
+			{
+				// saturated narrow signed to unsigned
+
+				results_u_8x16[0] = _mm_packus_epi16(results_u_8x16[0], intermediateResults0_s_16x8);
+				results_u_8x16[1] = _mm_packus_epi16(results_u_8x16[1], intermediateResults1_s_16x8);
+				results_u_8x16[2] = _mm_packus_epi16(results_u_8x16[2], intermediateResults2_s_16x8);
+			}
+		}
+
+		uint8_t* const target = targetRow + x * tTargetChannels;
+
+		if constexpr (tTargetChannels == 3u)
+		{
+			__m128i interleavedA_u_8x16;
+			__m128i interleavedB_u_8x16;
+			__m128i interleavedC_u_8x16;
+			SSE::interleave3Channel8Bit48Elements(results_u_8x16[0], results_u_8x16[1], results_u_8x16[2], interleavedA_u_8x16, interleavedB_u_8x16, interleavedC_u_8x16);
+
+			_mm_storeu_si128((__m128i*)(target + 0), interleavedA_u_8x16);
+			_mm_storeu_si128((__m128i*)(target + 16), interleavedB_u_8x16);
+			_mm_storeu_si128((__m128i*)(target + 32), interleavedC_u_8x16);
+		}
+		else
+		{
+			const __m128i channels01Low_u_8x16 = _mm_unpacklo_epi8(results_u_8x16[0], results_u_8x16[1]);
+			const __m128i channels01High_u_8x16 = _mm_unpackhi_epi8(results_u_8x16[0], results_u_8x16[1]);
+			const __m128i channels23Low_u_8x16 = _mm_unpacklo_epi8(results_u_8x16[2], alpha_u_8x16);
+			const __m128i channels23High_u_8x16 = _mm_unpackhi_epi8(results_u_8x16[2], alpha_u_8x16);
+
+			_mm_storeu_si128((__m128i*)(target + 0), _mm_unpacklo_epi16(channels01Low_u_8x16, channels23Low_u_8x16));
+			_mm_storeu_si128((__m128i*)(target + 16), _mm_unpackhi_epi16(channels01Low_u_8x16, channels23Low_u_8x16));
+			_mm_storeu_si128((__m128i*)(target + 32), _mm_unpacklo_epi16(channels01High_u_8x16, channels23High_u_8x16));
+			_mm_storeu_si128((__m128i*)(target + 48), _mm_unpackhi_epi16(channels01High_u_8x16, channels23High_u_8x16));
+		}
+	}
+
+#elif defined(OCEAN_HARDWARE_NEON_VERSION) && OCEAN_HARDWARE_NEON_VERSION >= 10
+
+	const int16x8_t factorChannel00_64_s_16x8 = vdupq_n_s16(int16_t(factorChannel00_64));
+	const int16x8_t factorChannel10_64_s_16x8 = vdupq_n_s16(int16_t(factorChannel10_64));
+	const int16x8_t factorChannel20_64_s_16x8 = vdupq_n_s16(int16_t(factorChannel20_64));
+
+	const int16x8_t factorChannel01_64_s_16x8 = vdupq_n_s16(int16_t(factorChannel01_64));
+	const int16x8_t factorChannel11_64_s_16x8 = vdupq_n_s16(int16_t(factorChannel11_64));
+	const int16x8_t factorChannel21_64_s_16x8 = vdupq_n_s16(int16_t(factorChannel21_64));
+
+	const int16x8_t factorChannel02_64_s_16x8 = vdupq_n_s16(int16_t(factorChannel02_64));
+	const int16x8_t factorChannel12_64_s_16x8 = vdupq_n_s16(int16_t(factorChannel12_64));
+	const int16x8_t factorChannel22_64_s_16x8 = vdupq_n_s16(int16_t(factorChannel22_64));
+
+	const uint8x8_t bias0_u_8x8 = vdup_n_u8(uint8_t(bias0));
+	const uint8x8_t bias1_u_8x8 = vdup_n_u8(uint8_t(bias1));
+	const uint8x8_t bias2_u_8x8 = vdup_n_u8(uint8_t(bias2));
+
+	const uint8x16_t alpha_u_8x16 = vdupq_n_u8(alphaValue);
+
+	for (; x + 16u <= width; x += 16u)
+	{
+		const uint8x16_t y_u_8x16 = vld1q_u8(yRow + x);
+		const uint8x16x2_t uv_u_8x16x2 = vld2q_u8(uvRow + x * 2u);
+
+		uint8x8_t results_u_8x8[2][3];
+
+		for (unsigned int n = 0u; n < 2u; ++n)
+		{
+			// Y' = Y - bias0, U' = U - bias1, V' = V - bias2
+			const int16x8_t y_s_16x8 = vreinterpretq_s16_u16(vsubl_u8(n == 0u ? vget_low_u8(y_u_8x16) : vget_high_u8(y_u_8x16), bias0_u_8x8));
+			const int16x8_t u_s_16x8 = vreinterpretq_s16_u16(vsubl_u8(n == 0u ? vget_low_u8(uv_u_8x16x2.val[0]) : vget_high_u8(uv_u_8x16x2.val[0]), bias1_u_8x8));
+			const int16x8_t v_s_16x8 = vreinterpretq_s16_u16(vsubl_u8(n == 0u ? vget_low_u8(uv_u_8x16x2.val[1]) : vget_high_u8(uv_u_8x16x2.val[1]), bias2_u_8x8));
+
+			// first we apply the matrix multiplication for the second and third channel, then we add the first channel (saturated)
+
+			int16x8_t intermediateResults0_s_16x8 = vqaddq_s16(vmulq_s16(u_s_16x8, factorChannel01_64_s_16x8), vmulq_s16(v_s_16x8, factorChannel02_64_s_16x8));
+			int16x8_t intermediateResults1_s_16x8 = vqaddq_s16(vmulq_s16(u_s_16x8, factorChannel11_64_s_16x8), vmulq_s16(v_s_16x8, factorChannel12_64_s_16x8));
+			int16x8_t intermediateResults2_s_16x8 = vqaddq_s16(vmulq_s16(u_s_16x8, factorChannel21_64_s_16x8), vmulq_s16(v_s_16x8, factorChannel22_64_s_16x8));
+
+			intermediateResults0_s_16x8 = vqaddq_s16(intermediateResults0_s_16x8, vmulq_s16(y_s_16x8, factorChannel00_64_s_16x8));
+			intermediateResults1_s_16x8 = vqaddq_s16(intermediateResults1_s_16x8, vmulq_s16(y_s_16x8, factorChannel10_64_s_16x8));
+			intermediateResults2_s_16x8 = vqaddq_s16(intermediateResults2_s_16x8, vmulq_s16(y_s_16x8, factorChannel20_64_s_16x8));
+
+			// saturated narrow signed to unsigned, normalized by 2^6
+
+			results_u_8x8[n][0] = vqrshrun_n_s16(intermediateResults0_s_16x8, 6);
+			results_u_8x8[n][1] = vqrshrun_n_s16(intermediateResults1_s_16x8, 6);
+			results_u_8x8[n][2] = vqrshrun_n_s16(intermediateResults2_s_16x8, 6);
+		}
+
+		uint8_t* const target = targetRow + x * tTargetChannels;
+
+		if constexpr (tTargetChannels == 3u)
+		{
+			uint8x16x3_t results_u_8x16x3;
+			results_u_8x16x3.val[0] = vcombine_u8(results_u_8x8[0][0], results_u_8x8[1][0]);
+			results_u_8x16x3.val[1] = vcombine_u8(results_u_8x8[0][1], results_u_8x8[1][1]);
+			results_u_8x16x3.val[2] = vcombine_u8(results_u_8x8[0][2], results_u_8x8[1][2]);
+
+			vst3q_u8(target, results_u_8x16x3);
+		}
+		else
+		{
+			uint8x16x4_t results_u_8x16x4;
+			results_u_8x16x4.val[0] = vcombine_u8(results_u_8x8[0][0], results_u_8x8[1][0]);
+			results_u_8x16x4.val[1] = vcombine_u8(results_u_8x8[0][1], results_u_8x8[1][1]);
+			results_u_8x16x4.val[2] = vcombine_u8(results_u_8x8[0][2], results_u_8x8[1][2]);
+			results_u_8x16x4.val[3] = alpha_u_8x16;
+
+			vst4q_u8(target, results_u_8x16x4);
+		}
+	}
+
+#endif
+
+	for (; x < width; ++x)
+	{
+		const int y = int(yRow[x]) - bias0;
+		const int u = int(uvRow[x * 2u + 0u]) - bias1;
+		const int v = int(uvRow[x * 2u + 1u]) - bias2;
+
+		uint8_t* const target = targetRow + x * tTargetChannels;
+
+		target[0] = uint8_t(minmax<int>(0, (y * factorChannel00_64 + u * factorChannel01_64 + v * factorChannel02_64 + 32) >> 6, 255));
+		target[1] = uint8_t(minmax<int>(0, (y * factorChannel10_64 + u * factorChannel11_64 + v * factorChannel12_64 + 32) >> 6, 255));
+		target[2] = uint8_t(minmax<int>(0, (y * factorChannel20_64 + u * factorChannel21_64 + v * factorChannel22_64 + 32) >> 6, 255));
+
+		if constexpr (tTargetChannels == 4u)
+		{
+			target[3] = alphaValue;
+		}
+	}
+}
+
+}
+
+}
@@ -211,6 +211,174 @@ class OCEAN_CV_EXPORT FrameConverterY_UV12 : public FrameConverter
 		 * @param worker Optional worker object to distribute the computational to several CPU cores
 		 */
 		static inline void convertY_UV12ToY_U_V12(const uint8_t* ySource, const uint8_t* uvSource, uint8_t* yTarget, uint8_t* uTarget, uint8_t* vTarget, const unsigned int width, const unsigned int height, const ConversionFlag flag, const unsigned int ySourcePaddingElements, const unsigned int uvSourcePaddingElements, const unsigned int yTargetPaddingElements, const unsigned int uTargetPaddingElements, const unsigned int vTargetPaddingElements, Worker* worker = nullptr);
+
+		/**
+		 * Converts a Y_UV12_LIMITED_RANGE frame to a RGB24 frame with individual resolution into a second image buffer.
+		 * The conversion is fused with a bilinear resize; the y and uv planes are sampled directly at the target resolution so that no full-resolution intermediate frame is necessary.<br>
+		 * A source frame with twice the resolution of the target frame is handled by a dedicated 2x2 averaging kernel.
+		 * <pre>
+		 * YUV input value range:  [16, 235]x[16, 240]x[16, 240]
+		 * RGB output value range: [ 0, 255]x[ 0, 255]x[ 0, 255]
+		 * </pre>
+		 * @param ySource The y source frame buffer, with (sourceWidth + yPaddingElements) * sourceHeight elements, must be valid
+		 * @param uvSource The uv source frame buffer, with (2 * sourceWidth/2 + uvPaddingElements) * sourceHeight/2 elements, must be valid
+		 * @param target The target frame buffer, with (3 * targetWidth + targetPaddingElements) * targetHeight elements, must be valid
+		 * @param sourceWidth The width of the source frame in pixel, with range [2, infinity), must be a multiple of 2
+		 * @param sourceHeight The height of the source frame in pixel, with range [2, infinity), must be a multiple of 2
+		 * @param targetWidth The width of the target frame in pixel, with range [1, infinity)
+		 * @param targetHeight The height of the target frame in pixel, with range [1, infinity)
+		 * @param ySourcePaddingElements The number of padding elements at the end of each y-source row, in (uint8_t) elements, with range [0, infinity)
+		 * @param uvSourcePaddingElements The number of padding elements at the end of each uv-source row, in (uint8_t) elements, with range [0, infinity)
+		 * @param targetPaddingElements The number of padding elements at the end of each target row, in (uint8_t) elements, with range [0, infinity)
+		 * @param worker Optional worker object to distribute the computational to several CPU cores
+		 */
+		static void convertY_UV12LimitedRangeToRGB24FullRangeResized(const uint8_t* ySource, const uint8_t* uvSource, uint8_t* target, const unsigned int sourceWidth, const unsigned int sourceHeight, const unsigned int targetWidth, const unsigned int targetHeight, const unsigned int ySourcePaddingElements, const unsigned int uvSourcePaddingElements, const unsigned int targetPaddingElements, Worker* worker = nullptr);
+
+		/**
+		 * Converts a Y_UV12_FULL_RANGE frame to a RGB24 frame with individual resolution into a second image buffer.
+		 * The conversion is fused with a bilinear resize, see convertY_UV12LimitedRangeToRGB24FullRangeResized().
+		 * <pre>
+		 * YUV input value range:  [0, 255]x[0, 255]x[0, 255]
+		 * RGB output value range: [0, 255]x[0, 255]x[0, 255]
+		 * </pre>
+		 * @param ySource The y source frame buffer, with (sourceWidth + yPaddingElements) * sourceHeight elements, must be valid
+		 * @param uvSource The uv source frame buffer, with (2 * sourceWidth/2 + uvPaddingElements) * sourceHeight/2 elements, must be valid
+		 * @param target The target frame buffer, with (3 * targetWidth + targetPaddingElements) * targetHeight elements, must be valid
+		 * @param sourceWidth The width of the source frame in pixel, with range [2, infinity), must be a multiple of 2
+		 * @param sourceHeight The height of the source frame in pixel, with range [2, infinity), must be a multiple of 2
+		 * @param targetWidth The width of the target frame in pixel, with range [1, infinity)
+		 * @param targetHeight The height of the target frame in pixel, with range [1, infinity)
+		 * @param ySourcePaddingElements The number of padding elements at the end of each y-source row, in (uint8_t) elements, with range [0, infinity)
+		 * @param uvSourcePaddingElements The number of padding elements at the end of each uv-source row, in (uint8_t) elements, with range [0, infinity)
+		 * @param targetPaddingElements The number of padding elements at the end of each target row, in (uint8_t) elements, with range [0, infinity)
+		 * @param worker Optional worker object to distribute the computational to several CPU cores
+		 */
+		static void convertY_UV12FullRangeToRGB24FullRangeResized(const uint8_t* ySource, const uint8_t* uvSource, uint8_t* target, const unsigned int sourceWidth, const unsigned int sourceHeight, const unsigned int targetWidth, const unsigned int targetHeight, const unsigned int ySourcePaddingElements, const unsigned int uvSourcePaddingElements, const unsigned int targetPaddingElements, Worker* worker = nullptr);
+
+		/**
+		 * Converts a Y_UV12_LIMITED_RANGE frame to a RGBA32 frame with individual resolution into a second image buffer.
+		 * The conversion is fused with a bilinear resize, see convertY_UV12LimitedRangeToRGB24FullRangeResized().
+		 * <pre>
+		 * YUV input value range:   [16, 235]x[16, 240]x[16, 240]
+		 * RGBA output value range: [ 0, 255]x[ 0, 255]x[ 0, 255]x[ 0, 255]
+		 * </pre>
+		 * @param ySource The y source frame buffer, with (sourceWidth + yPaddingElements) * sourceHeight elements, must be valid
+		 * @param uvSource The uv source frame buffer, with (2 * sourceWidth/2 + uvPaddingElements) * sourceHeight/2 elements, must be valid
+		 * @param target The target frame buffer, with (4 * targetWidth + targetPaddingElements) * targetHeight elements, must be valid
+		 * @param sourceWidth The width of the source frame in pixel, with range [2, infinity), must be a multiple of 2
+		 * @param sourceHeight The height of the source frame in pixel, with range [2, infinity), must be a multiple of 2
+		 * @param targetWidth The width of the target frame in pixel, with range [1, infinity)
+		 * @param targetHeight The height of the target frame in pixel, with range [1, infinity)
+		 * @param ySourcePaddingElements The number of padding elements at the end of each y-source row, in (uint8_t) elements, with range [0, infinity)
+		 * @param uvSourcePaddingElements The number of padding elements at the end of each uv-source row, in (uint8_t) elements, with range [0, infinity)
+		 * @param targetPaddingElements The number of padding elements at the end of each target row, in (uint8_t) elements, with range [0, infinity)
+		 * @param alphaValue The value of the alpha channel to be set, with range [0, 255]
+		 * @param worker Optional worker object to distribute the computational to several CPU cores
+		 */
+		static void convertY_UV12LimitedRangeToRGBA32FullRangeResized(const uint8_t* ySource, const uint8_t* uvSource, uint8_t* target, const unsigned int sourceWidth, const unsigned int sourceHeight, const unsigned int targetWidth, const unsigned int targetHeight, const unsigned int ySourcePaddingElements, const unsigned int uvSourcePaddingElements, const unsigned int targetPaddingElements, const uint8_t alphaValue = 0xFF, Worker* worker = nullptr);
+
+		/**
+		 * Converts a Y_UV12_FULL_RANGE frame to a RGBA32 frame with individual resolution into a second image buffer.
+		 * The conversion is fused with a bilinear resize, see convertY_UV12LimitedRangeToRGB24FullRangeResized().
+		 * <pre>
+		 * YUV input value range:   [0, 255]x[0, 255]x[0, 255]
+		 * RGBA output value range: [0, 255]x[0, 255]x[0, 255]x[0, 255]
+		 * </pre>
+		 * @param ySource The y source frame buffer, with (sourceWidth + yPaddingElements) * sourceHeight elements, must be valid
+		 * @param uvSource The uv source frame buffer, with (2 * sourceWidth/2 + uvPaddingElements) * sourceHeight/2 elements, must be valid
+		 * @param target The target frame buffer, with (4 * targetWidth + targetPaddingElements) * targetHeight elements, must be valid
+		 * @param sourceWidth The width of the source frame in pixel, with range [2, infinity), must be a multiple of 2
+		 * @param sourceHeight The height of the source frame in pixel, with range [2, infinity), must be a multiple of 2
+		 * @param targetWidth The width of the target frame in pixel, with range [1, infinity)
+		 * @param targetHeight The height of the target frame in pixel, with range [1, infinity)
+		 * @param ySourcePaddingElements The number of padding elements at the end of each y-source row, in (uint8_t) elements, with range [0, infinity)
+		 * @param uvSourcePaddingElements The number of padding elements at the end of each uv-source row, in (uint8_t) elements, with range [0, infinity)
+		 * @param targetPaddingElements The number of padding elements at the end of each target row, in (uint8_t) elements, with range [0, infinity)
+		 * @param alphaValue The value of the alpha channel to be set, with range [0, 255]
+		 * @param worker Optional worker object to distribute the computational to several CPU cores
+		 */
+		static void convertY_UV12FullRangeToRGBA32FullRangeResized(const uint8_t* ySource, const uint8_t* uvSource, uint8_t* target, const unsigned int sourceWidth, const unsigned int sourceHeight, const unsigned int targetWidth, const unsigned int targetHeight, const unsigned int ySourcePaddingElements, const unsigned int uvSourcePaddingElements, const unsigned int targetPaddingElements, const uint8_t alphaValue = 0xFF, Worker* worker = nullptr);
+
+	protected:
+
+		/**
+		 * Converts a Y_UV12 frame to a RGB24 or RGBA32 frame with individual resolution.
+		 * The layout of the options parameters is identical to FrameConverter::convertTwoRows_1Plane1ChannelAnd1Plane2ChannelsDownsampled2x2_To_1Plane3Channels_8BitPerChannel_Precision6Bit() without the padding parameters:
+		 * <pre>
+		 * options[0 - 8]  int32_t: f00, f10, f20, f01, f11, f21, f02, f12, f22, with denominator 64
+		 * options[9 - 11] int32_t: b0, b1, b2
+		 * </pre>
+		 * @param ySource The y source frame buffer, must be valid
+		 * @param uvSource The uv source frame buffer, must be valid
+		 * @param target The target frame buffer, must be valid
+		 * @param sourceWidth The width of the source frame in pixel, with range [2, infinity), must be a multiple of 2
+		 * @param sourceHeight The height of the source frame in pixel, with range [2, infinity), must be a multiple of 2
+		 * @param targetWidth The width of the target frame in pixel, with range [1, infinity)
+		 * @param targetHeight The height of the target frame in pixel, with range [1, infinity)
+		 * @param ySourcePaddingElements The number of padding elements at the end of each y-source row, in (uint8_t) elements, with range [0, infinity)
+		 * @param uvSourcePaddingElements The number of padding elements at the end of each uv-source row, in (uint8_t) elements, with range [0, infinity)
+		 * @param targetPaddingElements The number of padding elements at the end of each target row, in (uint8_t) elements, with range [0, infinity)
+		 * @param options The 12 color space conversion parameters, must be valid
+		 * @param alphaValue The value of the alpha channel to be set, with range [0, 255], ignored for three target channels
+		 * @param worker Optional worker object to distribute the computation
+		 * @tparam tTargetChannels The number of target channels, either 3 or 4
+		 */
+		template <unsigned int tTargetChannels>
+		static void convertY_UV12ToRGBResized(const uint8_t* ySource, const uint8_t* uvSource, uint8_t* target, const unsigned int sourceWidth, const unsigned int sourceHeight, const unsigned int targetWidth, const unsigned int targetHeight, const unsigned int ySourcePaddingElements, const unsigned int uvSourcePaddingElements, const unsigned int targetPaddingElements, const int* options, const uint8_t alphaValue, Worker* worker);
+
+		/**
+		 * Converts a subset of a Y_UV12 frame to a RGB24 or RGBA32 frame with arbitrary individual resolution by bilinear sampling the y and uv planes.
+		 * @param ySource The y source frame buffer, must be valid
+		 * @param uvSource The uv source frame buffer, must be valid
+		 * @param target The target frame buffer, must be valid
+		 * @param sourceWidth The width of the source frame in pixel, with range [2, infinity), must be a multiple of 2
+		 * @param sourceHeight The height of the source frame in pixel, with range [2, infinity), must be a multiple of 2
+		 * @param targetWidth The width of the target frame in pixel, with range [1, infinity)
+		 * @param targetHeight The height of the target frame in pixel, with range [1, infinity)
+		 * @param ySourcePaddingElements The number of padding elements at the end of each y-source row, in (uint8_t) elements, with range [0, infinity)
+		 * @param uvSourcePaddingElements The number of padding elements at the end of each uv-source row, in (uint8_t) elements, with range [0, infinity)
+		 * @param targetPaddingElements The number of padding elements at the end of each target row, in (uint8_t) elements, with range [0, infinity)
+		 * @param options The 12 color space conversion parameters, must be valid
+		 * @param alphaValue The value of the alpha channel to be set, with range [0, 255], ignored for three target channels
+		 * @param firstTargetRow The first target row to be handled, with range [0, targetHeight - 1]
+		 * @param numberTargetRows The number of target rows to be handled, with range [1, targetHeight - firstTargetRow]
+		 * @tparam tTargetChannels The number of target channels, either 3 or 4
+		 */
+		template <unsigned int tTargetChannels>
+		static void convertY_UV12ToRGBResizedSubset(const uint8_t* ySource, const uint8_t* uvSource, uint8_t* target, const unsigned int sourceWidth, const unsigned int sourceHeight, const unsigned int targetWidth, const unsigned int targetHeight, const unsigned int ySourcePaddingElements, const unsigned int uvSourcePaddingElements, const unsigned int targetPaddingElements, const int* options, const uint8_t alphaValue, const unsigned int firstTargetRow, const unsigned int numberTargetRows);
+
+		/**
+		 * Converts a subset of a Y_UV12 frame to a RGB24 or RGBA32 frame with half the source resolution.
+		 * Each target pixel is determined by the average of a 2x2 block of y values and the corresponding uv pair.
+		 * @param ySource The y source frame buffer, must be valid
+		 * @param uvSource The uv source frame buffer, must be valid
+		 * @param target The target frame buffer, must be valid
+		 * @param targetWidth The width of the target frame in pixel (half the source width), with range [1, infinity)
+		 * @param targetHeight The height of the target frame in pixel (half the source height), with range [1, infinity)
+		 * @param ySourcePaddingElements The number of padding elements at the end of each y-source row, in (uint8_t) elements, with range [0, infinity)
+		 * @param uvSourcePaddingElements The number of padding elements at the end of each uv-source row, in (uint8_t) elements, with range [0, infinity)
+		 * @param targetPaddingElements The number of padding elements at the end of each target row, in (uint8_t) elements, with range [0, infinity)
+		 * @param options The 12 color space conversion parameters, must be valid
+		 * @param alphaValue The value of the alpha channel to be set, with range [0, 255], ignored for three target channels
+		 * @param firstTargetRow The first target row to be handled, with range [0, targetHeight - 1]
+		 * @param numberTargetRows The number of target rows to be handled, with range [1, targetHeight - firstTargetRow]
+		 * @tparam tTargetChannels The number of target channels, either 3 or 4
+		 */
+		template <unsigned int tTargetChannels>
+		static void convertY_UV12ToRGBHalfSizeSubset(const uint8_t* ySource, const uint8_t* uvSource, uint8_t* target, const unsigned int targetWidth, const unsigned int targetHeight, const unsigned int ySourcePaddingElements, const unsigned int uvSourcePaddingElements, const unsigned int targetPaddingElements, const int* options, const uint8_t alphaValue, const unsigned int firstTargetRow, const unsigned int numberTargetRows);
+
+		/**
+		 * Converts one row of y values and interleaved uv values (one uv pair for each pixel) to one row of RGB24 or RGBA32 pixels.
+		 * @param yRow The row with y values, with width elements, must be valid
+		 * @param uvRow The row with interleaved uv values, with 2 * width elements, must be valid
+		 * @param targetRow The target row, with tTargetChannels * width elements, must be valid
+		 * @param width The number of pixels in the row, with range [1, infinity)
+		 * @param options The 12 color space conversion parameters, must be valid
+		 * @param alphaValue The value of the alpha channel to be set, with range [0, 255], ignored for three target channels
+		 * @tparam tTargetChannels The number of target channels, either 3 or 4
+		 */
+		template <unsigned int tTargetChannels>
+		static void convertRowYUVToRGBPrecision6Bit(const uint8_t* yRow, const uint8_t* uvRow, uint8_t* targetRow, const unsigned int width, const int* options, const uint8_t alphaValue);
 };
 
 inline void FrameConverterY_UV12::convertY_UV12LimitedRangeToY8LimitedRange(const uint8_t* ySource, const uint8_t* /* uvSource */, uint8_t* target, const unsigned int width, const unsigned int height, const ConversionFlag flag, const unsigned int ySourcePaddingElements, const unsigned int /* uvSourcePaddingElements */, const unsigned int targetPaddingElements, Worker* worker)
@@ -10,8 +10,8 @@
 #include "ocean/base/Frame.h"
 #include "ocean/base/Memory.h"
 
-#include "ocean/cv/FrameFilterScharr.h"
-#include "ocean/cv/FrameFilterSobel.h"
+#include "ocean/cv/NEON.h"
+#include "ocean/cv/SSE.h"
 
 namespace Ocean
 {
@@ -53,280 +53,521 @@ void FrameFilterCanny::filterCanny(const uint8_t* const source, uint8_t* const t
 
 	static_assert(tEdgeFilter == EF_SOBEL || tEdgeFilter == EF_SCHARR, "The edge filter must be either Sobel or Scharr");
 
-	Memory filterResponses(sizeof(TFilterOutputElementType) * width * height * /* number of filter directions */ 4u);
+	const unsigned int targetStrideElements = width + targetPaddingElements;
 
-	if constexpr (tEdgeFilter == EF_SOBEL)
-	{
-		constexpr unsigned int filterResponsesPaddingElements = 0u;
+	// Edges will not be detected in border pixels by design, so, set the first and the last rows to zero (left- and right-most columns are set inside the subset function below)
+	memset(target, 0, width);
+	memset(target + (height - 1u) * targetStrideElements, 0, width);
+
+	// Map to store edge type of pixels (no edge, weak edge, strong edge)
+	Memory edgeCandidates(sizeof(uint8_t) * width * height);
+	uint8_t* const edgeCandidatesData = edgeCandidates.data<uint8_t>();
+
+	memset(edgeCandidatesData, 0, width);
+	memset(edgeCandidatesData + (height - 1u) * width, 0, width);
+
+	// the inner rows are separated into blocks, each block determines the gradients of its rows, applies the non-maximum suppression and traces the edges inside the block
 
-		FrameFilterSobel::filter8BitPerChannel<TFilterOutputElementType, 1u>(source, (TFilterOutputElementType*)filterResponses.data(), width, height, sourcePaddingElements, filterResponsesPaddingElements, worker);
+	const unsigned int blocks = worker ? std::max(1u, std::min(height - 2u, worker->threads())) : 1u;
+
+	std::vector<CV::PixelPositions> strongEdgeLocations(blocks);
+	std::vector<CV::PixelPositions> foreignEdgeLocations(blocks);
+
+	if (worker && blocks > 1u)
+	{
+		worker->executeFunction(Worker::Function::createStatic(&FrameFilterCanny::filterCannyBlocksSubset<TFilterOutputElementType, tEdgeFilter>, source, target, edgeCandidatesData, width, height, sourcePaddingElements, targetPaddingElements, lowThreshold, highThreshold, blocks, strongEdgeLocations.data(), 0u, 0u), 0u, blocks, 11u, 12u, 1u);
 	}
 	else
 	{
-		constexpr unsigned int filterResponsesPaddingElements = 0u;
-
-		FrameFilterScharr::filter8BitPerChannel<TFilterOutputElementType, 1u>(source, filterResponses.data<TFilterOutputElementType>(), width, height, sourcePaddingElements, filterResponsesPaddingElements, worker);
+		filterCannyBlocksSubset<TFilterOutputElementType, tEdgeFilter>(source, target, edgeCandidatesData, width, height, sourcePaddingElements, targetPaddingElements, lowThreshold, highThreshold, blocks, strongEdgeLocations.data(), 0u, blocks);
 	}
 
-	Memory gradientDirections(sizeof(uint8_t) * width * height);
-	Memory gradientMagnitudes(sizeof(TFilterOutputElementType) * height * width);
+	// In the map of edge candidates find all weak edges (128) that are connected to strong edge (255)
+	// the edges are traced inside each block concurrently, neighbors located in other blocks are handed over to the corresponding block and the tracing is repeated until no new strong edge exists
+
+	while (true)
+	{
+		bool hasStrongEdgeLocations = false;
 
-	extractGradientDirectionsAndMagnitudes((TFilterOutputElementType*)filterResponses.data(), (uint8_t*)gradientDirections.data(), (TFilterOutputElementType*)gradientMagnitudes.data(), TFilterOutputElementType(lowThreshold), width, height, worker);
+		for (const CV::PixelPositions& locations : strongEdgeLocations)
+		{
+			if (!locations.empty())
+			{
+				hasStrongEdgeLocations = true;
+				break;
+			}
+		}
+
+		if (!hasStrongEdgeLocations)
+		{
+			break;
+		}
 
-	extractEdgePixels((uint8_t*)gradientDirections.data(), (TFilterOutputElementType*)gradientMagnitudes.data(), target, width, height, targetPaddingElements, lowThreshold, highThreshold, worker);
+		if (worker && blocks > 1u)
+		{
+			worker->executeFunction(Worker::Function::createStatic(&FrameFilterCanny::hysteresisBlocksSubset, target, edgeCandidatesData, width, height, targetPaddingElements, blocks, strongEdgeLocations.data(), foreignEdgeLocations.data(), 0u, 0u), 0u, blocks, 8u, 9u, 1u);
+		}
+		else
+		{
+			hysteresisBlocksSubset(target, edgeCandidatesData, width, height, targetPaddingElements, blocks, strongEdgeLocations.data(), foreignEdgeLocations.data(), 0u, blocks);
+		}
+
+		for (CV::PixelPositions& locations : foreignEdgeLocations)
+		{
+			for (const CV::PixelPosition& location : locations)
+			{
+				ocean_assert(location.x() != 0u && location.x() < (width - 1u) && location.y() != 0u && location.y() < (height - 1u));
+
+				uint8_t& edgeCandidate = edgeCandidatesData[location.y() * width + location.x()];
+
+				if (edgeCandidate == 128u)
+				{
+					edgeCandidate = 255u;
+					target[location.y() * targetStrideElements + location.x()] = 255u;
+
+					strongEdgeLocations[blockIndex(location.y(), blocks, height)].push_back(location);
+				}
+			}
+
+			locations.clear();
+		}
+	}
 }
 
-template <typename T>
-void FrameFilterCanny::extractGradientDirectionsAndMagnitudesSubset(const T* egdeFilterResults, uint8_t* direction, T* magnitude, const T lowThreshold, const unsigned int width, const unsigned int height, const unsigned int firstRow, const unsigned int numberRows)
+template<typename TFilterOutputElementType, FrameFilterCanny::EdgeFilter tEdgeFilter>
+void FrameFilterCanny::filterCannyBlocksSubset(const uint8_t* source, uint8_t* target, uint8_t* edgeCandidateMap, const unsigned int width, const unsigned int height, const unsigned int sourcePaddingElements, const unsigned int targetPaddingElements, const TFilterOutputElementType lowThreshold, const TFilterOutputElementType highThreshold, const unsigned int blocks, CV::PixelPositions* strongEdgeLocations, const unsigned int firstBlock, const unsigned int numberBlocks)
 {
-	ocean_assert(egdeFilterResults && direction && magnitude);
+	ocean_assert(source != nullptr && target != nullptr && edgeCandidateMap != nullptr);
 	ocean_assert(width >= 3u && height >= 3u);
-	ocean_assert_and_suppress_unused(firstRow + numberRows <= height, height);
+	ocean_assert(strongEdgeLocations != nullptr);
+	ocean_assert(firstBlock + numberBlocks <= blocks);
 
-	const unsigned int sourceWidth = width * 4u;
+	const unsigned int sourceStrideElements = width + sourcePaddingElements;
+	const unsigned int targetStrideElements = width + targetPaddingElements;
 
-	const T* source0 = egdeFilterResults + firstRow * sourceWidth - 1; // minus 1, because of ++
-	const T* const source0End = source0 + numberRows * sourceWidth;
+	// ring buffer with gradient directions and magnitudes of three consecutive rows, row y is stored in slot y % 3
 
-	direction += (firstRow * width);
-	magnitude += (firstRow * width);
+	Memory directionsMemory = Memory::create<uint8_t>(width * 3u);
+	Memory magnitudesMemory = Memory::create<TFilterOutputElementType>(width * 3u);
 
-#ifdef OCEAN_DEBUG
-	const T* const debugMagnitudeEnd = magnitude + numberRows * width;
-	const uint8_t* const debugDirectionEnd = direction + numberRows * width;
-#endif
+	uint8_t* const directions = directionsMemory.data<uint8_t>();
+	TFilterOutputElementType* const magnitudes = magnitudesMemory.data<TFilterOutputElementType>();
 
-	while (source0 != source0End)
+	for (unsigned int block = firstBlock; block < firstBlock + numberBlocks; ++block)
 	{
-		ocean_assert(source0 < source0End);
-		ocean_assert(magnitude < debugMagnitudeEnd);
-		ocean_assert(direction < debugDirectionEnd);
+		const unsigned int blockStartRow = blockFirstRow(block, blocks, height);
+		const unsigned int blockEndRow = blockFirstRow(block + 1u, blocks, height);
+		ocean_assert(blockStartRow >= 1u && blockStartRow < blockEndRow && blockEndRow <= height - 1u);
 
-		// Finding the intensity gradient of the image and absolute magnitudes
-		const T edge0 = T(abs(*++source0));
-		const T edge90 = T(abs(*++source0));
-		const T edge45 = T(abs(*++source0));
-		const T edge135 = T(abs(*++source0));
+		CV::PixelPositions& blockStrongEdgeLocations = strongEdgeLocations[block];
 
-		if (edge0 > edge45 && edge0 > edge90 && edge0 > edge135 && edge0 > lowThreshold)
+		for (unsigned int y = blockStartRow - 1u; y <= blockStartRow; ++y)
 		{
-			*direction = ED_VERTICAL;
-			*magnitude = edge0;
+			gradientDirectionsAndMagnitudesRow<TFilterOutputElementType, tEdgeFilter>(source, width, height, sourceStrideElements, y, lowThreshold, directions + (y % 3u) * width, magnitudes + (y % 3u) * width);
 		}
-		else if (edge45 > edge0 && edge45 > edge90 && edge45 > edge135 && edge45 > lowThreshold)
+
+		for (unsigned int y = blockStartRow; y < blockEndRow; ++y)
 		{
-			*direction = ED_DIAGONAL_45;
-			*magnitude = edge45;
+			gradientDirectionsAndMagnitudesRow<TFilterOutputElementType, tEdgeFilter>(source, width, height, sourceStrideElements, y + 1u, lowThreshold, directions + ((y + 1u) % 3u) * width, magnitudes + ((y + 1u) % 3u) * width);
+
+			nonMaximumSuppressionRow<TFilterOutputElementType>(directions + (y % 3u) * width, magnitudes + ((y - 1u) % 3u) * width, magnitudes + (y % 3u) * width, magnitudes + ((y + 1u) % 3u) * width, target + y * targetStrideElements, edgeCandidateMap + y * width, width, y, lowThreshold, highThreshold, blockStrongEdgeLocations);
 		}
-		else if (edge90 > edge0 && edge90 > edge45 && edge90 > edge135 && edge90 > lowThreshold)
+	}
+}
+
+template<typename TFilterOutputElementType, FrameFilterCanny::EdgeFilter tEdgeFilter>
+void FrameFilterCanny::gradientDirectionsAndMagnitudesRow(const uint8_t* source, const unsigned int width, const unsigned int height, const unsigned int sourceStrideElements, const unsigned int y, const TFilterOutputElementType lowThreshold, uint8_t* directionRow, TFilterOutputElementType* magnitudeRow)
+{
+	static_assert(std::is_same<TFilterOutputElementType, int8_t>::value || std::is_same<TFilterOutputElementType, int16_t>::value, "TFilterType must be an 8 or 16 bit signed type");
+	static_assert(tEdgeFilter == EF_SOBEL || tEdgeFilter == EF_SCHARR, "The edge filter must be either Sobel or Scharr");
+
+	ocean_assert(source != nullptr && directionRow != nullptr && magnitudeRow != nullptr);
+	ocean_assert(width >= 3u && height >= 3u && y < height);
+
+	if (y == 0u || y == height - 1u)
+	{
+		// the first and last row do not have any edge
+
+		memset(directionRow, ED_NO_EDGE, width);
+		memset(magnitudeRow, 0, width * sizeof(TFilterOutputElementType));
+
+		return;
+	}
+
+	// all four filter responses have the form: outerFactor * (...) + innerFactor * (...)
+	//
+	// | a b c |
+	// | d e f |   e <=> current pixel
+	// | g h i |
+	//
+	//   0 degree: outer * (c - a + i - g) + inner * (f - d)
+	//  90 degree: outer * (g + i - a - c) + inner * (h - b)
+	//  45 degree: outer * (f + h - b - d) + inner * (i - a)
+	// 135 degree: outer * (d + h - b - f) + inner * (g - c)
+
+	constexpr int outerFactor = tEdgeFilter == EF_SOBEL ? 1 : 3;
+	constexpr int innerFactor = tEdgeFilter == EF_SOBEL ? 2 : 10;
+
+	// normalized responses are divided by 8 (Sobel) or 32 (Scharr), the absolute value of a truncated division is identical to the shifted absolute value
+	constexpr int normalizationShift = std::is_same<TFilterOutputElementType, int8_t>::value ? (tEdgeFilter == EF_SOBEL ? 3 : 5) : 0;
+
+	const uint8_t* const sourceTop = source + (y - 1u) * sourceStrideElements;
+	const uint8_t* const sourceCenter = sourceTop + sourceStrideElements;
+	const uint8_t* const sourceBottom = sourceCenter + sourceStrideElements;
+
+	directionRow[0] = ED_NO_EDGE;
+	magnitudeRow[0] = TFilterOutputElementType(0);
+
+	unsigned int x = 1u;
+
+#if defined(OCEAN_HARDWARE_SSE_VERSION) && OCEAN_HARDWARE_SSE_VERSION >= 41
+
+	const __m128i zero_128 = _mm_setzero_si128();
+
+	const __m128i outerFactor_s_16x8 = _mm_set1_epi16(short(outerFactor));
+	const __m128i innerFactor_s_16x8 = _mm_set1_epi16(short(innerFactor));
+
+	const __m128i lowThreshold_s_16x8 = _mm_set1_epi16(short(lowThreshold));
+
+	const __m128i directionVertical_s_16x8 = _mm_set1_epi16(short(ED_VERTICAL));
+	const __m128i directionHorizontal_s_16x8 = _mm_set1_epi16(short(ED_HORIZONTAL));
+	const __m128i direction45_s_16x8 = _mm_set1_epi16(short(ED_DIAGONAL_45));
+	const __m128i direction135_s_16x8 = _mm_set1_epi16(short(ED_DIAGONAL_135));
+	const __m128i directionNoEdge_s_16x8 = _mm_set1_epi16(short(ED_NO_EDGE));
+
+	for (; x + 9u <= width; x += 8u)
+	{
+		const __m128i a_s_16x8 = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i*)(sourceTop + x - 1u)), zero_128);
+		const __m128i b_s_16x8 = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i*)(sourceTop + x)), zero_128);
+		const __m128i c_s_16x8 = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i*)(sourceTop + x + 1u)), zero_128);
+
+		const __m128i d_s_16x8 = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i*)(sourceCenter + x - 1u)), zero_128);
+		const __m128i f_s_16x8 = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i*)(sourceCenter + x + 1u)), zero_128);
+
+		const __m128i g_s_16x8 = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i*)(sourceBottom + x - 1u)), zero_128);
+		const __m128i h_s_16x8 = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i*)(sourceBottom + x)), zero_128);
+		const __m128i i_s_16x8 = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i*)(sourceBottom + x + 1u)), zero_128);
+
+		const __m128i response0_s_16x8 = _mm_add_epi16(_mm_mullo_epi16(_mm_add_epi16(_mm_sub_epi16(c_s_16x8, a_s_16x8), _mm_sub_epi16(i_s_16x8, g_s_16x8)), outerFactor_s_16x8), _mm_mullo_epi16(_mm_sub_epi16(f_s_16x8, d_s_16x8), innerFactor_s_16x8));
+		const __m128i response90_s_16x8 = _mm_add_epi16(_mm_mullo_epi16(_mm_sub_epi16(_mm_add_epi16(g_s_16x8, i_s_16x8), _mm_add_epi16(a_s_16x8, c_s_16x8)), outerFactor_s_16x8), _mm_mullo_epi16(_mm_sub_epi16(h_s_16x8, b_s_16x8), innerFactor_s_16x8));
+		const __m128i response45_s_16x8 = _mm_add_epi16(_mm_mullo_epi16(_mm_sub_epi16(_mm_add_epi16(f_s_16x8, h_s_16x8), _mm_add_epi16(b_s_16x8, d_s_16x8)), outerFactor_s_16x8), _mm_mullo_epi16(_mm_sub_epi16(i_s_16x8, a_s_16x8), innerFactor_s_16x8));
+		const __m128i response135_s_16x8 = _mm_add_epi16(_mm_mullo_epi16(_mm_sub_epi16(_mm_add_epi16(d_s_16x8, h_s_16x8), _mm_add_epi16(b_s_16x8, f_s_16x8)), outerFactor_s_16x8), _mm_mullo_epi16(_mm_sub_epi16(g_s_16x8, c_s_16x8), innerFactor_s_16x8));
+
+		__m128i edge0_s_16x8 = _mm_abs_epi16(response0_s_16x8);
+		__m128i edge90_s_16x8 = _mm_abs_epi16(response90_s_16x8);
+		__m128i edge45_s_16x8 = _mm_abs_epi16(response45_s_16x8);
+		__m128i edge135_s_16x8 = _mm_abs_epi16(response135_s_16x8);
+
+		if constexpr (normalizationShift != 0)
 		{
-			*direction = ED_HORIZONTAL;
-			*magnitude = edge90;
+			edge0_s_16x8 = _mm_srli_epi16(edge0_s_16x8, normalizationShift);
+			edge90_s_16x8 = _mm_srli_epi16(edge90_s_16x8, normalizationShift);
+			edge45_s_16x8 = _mm_srli_epi16(edge45_s_16x8, normalizationShift);
+			edge135_s_16x8 = _mm_srli_epi16(edge135_s_16x8, normalizationShift);
 		}
-		else if (edge135 > edge0 && edge135 > edge90 && edge135 > edge45 && edge135 > lowThreshold)
+
+		// the dominant direction must be strictly larger than all other directions and larger than the low threshold
+
+		const __m128i isEdge0_s_16x8 = _mm_and_si128(_mm_and_si128(_mm_cmpgt_epi16(edge0_s_16x8, edge45_s_16x8), _mm_cmpgt_epi16(edge0_s_16x8, edge90_s_16x8)), _mm_and_si128(_mm_cmpgt_epi16(edge0_s_16x8, edge135_s_16x8), _mm_cmpgt_epi16(edge0_s_16x8, lowThreshold_s_16x8)));
+		const __m128i isEdge45_s_16x8 = _mm_and_si128(_mm_and_si128(_mm_cmpgt_epi16(edge45_s_16x8, edge0_s_16x8), _mm_cmpgt_epi16(edge45_s_16x8, edge90_s_16x8)), _mm_and_si128(_mm_cmpgt_epi16(edge45_s_16x8, edge135_s_16x8), _mm_cmpgt_epi16(edge45_s_16x8, lowThreshold_s_16x8)));
+		const __m128i isEdge90_s_16x8 = _mm_and_si128(_mm_and_si128(_mm_cmpgt_epi16(edge90_s_16x8, edge0_s_16x8), _mm_cmpgt_epi16(edge90_s_16x8, edge45_s_16x8)), _mm_and_si128(_mm_cmpgt_epi16(edge90_s_16x8, edge135_s_16x8), _mm_cmpgt_epi16(edge90_s_16x8, lowThreshold_s_16x8)));
+		const __m128i isEdge135_s_16x8 = _mm_and_si128(_mm_and_si128(_mm_cmpgt_epi16(edge135_s_16x8, edge0_s_16x8), _mm_cmpgt_epi16(edge135_s_16x8, edge90_s_16x8)), _mm_and_si128(_mm_cmpgt_epi16(edge135_s_16x8, edge45_s_16x8), _mm_cmpgt_epi16(edge135_s_16x8, lowThreshold_s_16x8)));
+
+		const __m128i isAnyEdge_s_16x8 = _mm_or_si128(_mm_or_si128(isEdge0_s_16x8, isEdge45_s_16x8), _mm_or_si128(isEdge90_s_16x8, isEdge135_s_16x8));
+
+		const __m128i magnitude_s_16x8 = _mm_or_si128(_mm_or_si128(_mm_and_si128(isEdge0_s_16x8, edge0_s_16x8), _mm_and_si128(isEdge45_s_16x8, edge45_s_16x8)), _mm_or_si128(_mm_and_si128(isEdge90_s_16x8, edge90_s_16x8), _mm_and_si128(isEdge135_s_16x8, edge135_s_16x8)));
+
+		const __m128i direction_s_16x8 = _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_and_si128(isEdge0_s_16x8, directionVertical_s_16x8), _mm_and_si128(isEdge45_s_16x8, direction45_s_16x8)), _mm_or_si128(_mm_and_si128(isEdge90_s_16x8, directionHorizontal_s_16x8), _mm_and_si128(isEdge135_s_16x8, direction135_s_16x8))), _mm_andnot_si128(isAnyEdge_s_16x8, directionNoEdge_s_16x8));
+
+		_mm_storel_epi64((__m128i*)(directionRow + x), _mm_packus_epi16(direction_s_16x8, zero_128));
+
+		if constexpr (std::is_same<TFilterOutputElementType, int8_t>::value)
 		{
-			*direction = ED_DIAGONAL_135;
-			*magnitude = edge135;
+			_mm_storel_epi64((__m128i*)(magnitudeRow + x), _mm_packs_epi16(magnitude_s_16x8, zero_128));
 		}
 		else
 		{
-			// no edge because magnitude < lowThreshold
-			*direction = ED_NO_EDGE;
-			*magnitude = 0;
+			_mm_storeu_si128((__m128i*)(magnitudeRow + x), magnitude_s_16x8);
 		}
+	}
 
-		ocean_assert(*direction != ED_NO_EDGE || *magnitude <= lowThreshold);
+#elif defined(OCEAN_HARDWARE_NEON_VERSION) && OCEAN_HARDWARE_NEON_VERSION >= 10
 
-		magnitude++;
-		direction++;
-	}
-}
+	const int16x8_t lowThreshold_s_16x8 = vdupq_n_s16(int16_t(lowThreshold));
 
-template<typename TFilterOutputElementType>
-inline void FrameFilterCanny::extractEdgePixels(const uint8_t* const gradientDirections, const TFilterOutputElementType* const gradientMagnitudes, uint8_t* const target, const unsigned int width, const unsigned int height, const unsigned int targetPaddingElements, const TFilterOutputElementType lowThreshold, const TFilterOutputElementType highThreshold, Worker* worker)
-{
-	ocean_assert(gradientDirections != nullptr);
-	ocean_assert(gradientMagnitudes != nullptr);
-	ocean_assert(target != nullptr);
-	ocean_assert(width >= 3u && height >= 3u);
+	const uint16x8_t directionVertical_u_16x8 = vdupq_n_u16(uint16_t(ED_VERTICAL));
+	const uint16x8_t directionHorizontal_u_16x8 = vdupq_n_u16(uint16_t(ED_HORIZONTAL));
+	const uint16x8_t direction45_u_16x8 = vdupq_n_u16(uint16_t(ED_DIAGONAL_45));
+	const uint16x8_t direction135_u_16x8 = vdupq_n_u16(uint16_t(ED_DIAGONAL_135));
+	const uint16x8_t directionNoEdge_u_16x8 = vdupq_n_u16(uint16_t(ED_NO_EDGE));
 
-	const unsigned int targetStrideElements = width + targetPaddingElements;
+	for (; x + 9u <= width; x += 8u)
+	{
+		const int16x8_t a_s_16x8 = vreinterpretq_s16_u16(vmovl_u8(vld1_u8(sourceTop + x - 1u)));
+		const int16x8_t b_s_16x8 = vreinterpretq_s16_u16(vmovl_u8(vld1_u8(sourceTop + x)));
+		const int16x8_t c_s_16x8 = vreinterpretq_s16_u16(vmovl_u8(vld1_u8(sourceTop + x + 1u)));
 
-	// Edges will not be detected in border pixels by design, so, set the first and the last rows to zero (left- and right-most columns are set inside the subset function below)
-	memset(target, 0, width);
-	memset(target + (height - 1u) * targetStrideElements, 0, width);
+		const int16x8_t d_s_16x8 = vreinterpretq_s16_u16(vmovl_u8(vld1_u8(sourceCenter + x - 1u)));
+		const int16x8_t f_s_16x8 = vreinterpretq_s16_u16(vmovl_u8(vld1_u8(sourceCenter + x + 1u)));
 
-	// Map to store edge type of pixels (no edge, weak edge, strong edge), stack to store indices of strong edge pixels which are used to find connected weak edge pixels
-	Memory edgeCandidates(sizeof(uint8_t) * width * height);
-	CV::PixelPositions strongEdgeLocations;
-	Lock strongEdgeLock;
+		const int16x8_t g_s_16x8 = vreinterpretq_s16_u16(vmovl_u8(vld1_u8(sourceBottom + x - 1u)));
+		const int16x8_t h_s_16x8 = vreinterpretq_s16_u16(vmovl_u8(vld1_u8(sourceBottom + x)));
+		const int16x8_t i_s_16x8 = vreinterpretq_s16_u16(vmovl_u8(vld1_u8(sourceBottom + x + 1u)));
 
-	memset(edgeCandidates.data(), 0, width);
-	memset((uint8_t*)edgeCandidates.data() + (height - 1u) * width, 0, width);
+		const int16x8_t response0_s_16x8 = vmlaq_n_s16(vmulq_n_s16(vaddq_s16(vsubq_s16(c_s_16x8, a_s_16x8), vsubq_s16(i_s_16x8, g_s_16x8)), int16_t(outerFactor)), vsubq_s16(f_s_16x8, d_s_16x8), int16_t(innerFactor));
+		const int16x8_t response90_s_16x8 = vmlaq_n_s16(vmulq_n_s16(vsubq_s16(vaddq_s16(g_s_16x8, i_s_16x8), vaddq_s16(a_s_16x8, c_s_16x8)), int16_t(outerFactor)), vsubq_s16(h_s_16x8, b_s_16x8), int16_t(innerFactor));
+		const int16x8_t response45_s_16x8 = vmlaq_n_s16(vmulq_n_s16(vsubq_s16(vaddq_s16(f_s_16x8, h_s_16x8), vaddq_s16(b_s_16x8, d_s_16x8)), int16_t(outerFactor)), vsubq_s16(i_s_16x8, a_s_16x8), int16_t(innerFactor));
+		const int16x8_t response135_s_16x8 = vmlaq_n_s16(vmulq_n_s16(vsubq_s16(vaddq_s16(d_s_16x8, h_s_16x8), vaddq_s16(b_s_16x8, f_s_16x8)), int16_t(outerFactor)), vsubq_s16(g_s_16x8, c_s_16x8), int16_t(innerFactor));
 
-	// Extract edge but skip the first and last row
-	if (worker)
-	{
-		worker->executeFunction(Worker::Function::createStatic(&extractEdgePixelsSubset, gradientDirections, gradientMagnitudes, target, (uint8_t*)edgeCandidates.data(), &strongEdgeLocations, &strongEdgeLock, width, height, targetPaddingElements, lowThreshold, highThreshold, 0u, 0u), 1u, height - 2u, 11u, 12u, 20u);
-	}
-	else
-	{
-		extractEdgePixelsSubset(gradientDirections, gradientMagnitudes, target, (uint8_t*)edgeCandidates.data(), &strongEdgeLocations, nullptr, width, height, targetPaddingElements, lowThreshold, highThreshold, 1u, height - 2u);
+		int16x8_t edge0_s_16x8 = vabsq_s16(response0_s_16x8);
+		int16x8_t edge90_s_16x8 = vabsq_s16(response90_s_16x8);
+		int16x8_t edge45_s_16x8 = vabsq_s16(response45_s_16x8);
+		int16x8_t edge135_s_16x8 = vabsq_s16(response135_s_16x8);
+
+		if constexpr (normalizationShift != 0)
+		{
+			edge0_s_16x8 = vshrq_n_s16(edge0_s_16x8, normalizationShift);
+			edge90_s_16x8 = vshrq_n_s16(edge90_s_16x8, normalizationShift);
+			edge45_s_16x8 = vshrq_n_s16(edge45_s_16x8, normalizationShift);
+			edge135_s_16x8 = vshrq_n_s16(edge135_s_16x8, normalizationShift);
+		}
+
+		// the dominant direction must be strictly larger than all other directions and larger than the low threshold
+
+		const uint16x8_t isEdge0_u_16x8 = vandq_u16(vandq_u16(vcgtq_s16(edge0_s_16x8, edge45_s_16x8), vcgtq_s16(edge0_s_16x8, edge90_s_16x8)), vandq_u16(vcgtq_s16(edge0_s_16x8, edge135_s_16x8), vcgtq_s16(edge0_s_16x8, lowThreshold_s_16x8)));
+		const uint16x8_t isEdge45_u_16x8 = vandq_u16(vandq_u16(vcgtq_s16(edge45_s_16x8, edge0_s_16x8), vcgtq_s16(edge45_s_16x8, edge90_s_16x8)), vandq_u16(vcgtq_s16(edge45_s_16x8, edge135_s_16x8), vcgtq_s16(edge45_s_16x8, lowThreshold_s_16x8)));
+		const uint16x8_t isEdge90_u_16x8 = vandq_u16(vandq_u16(vcgtq_s16(edge90_s_16x8, edge0_s_16x8), vcgtq_s16(edge90_s_16x8, edge45_s_16x8)), vandq_u16(vcgtq_s16(edge90_s_16x8, edge135_s_16x8), vcgtq_s16(edge90_s_16x8, lowThreshold_s_16x8)));
+		const uint16x8_t isEdge135_u_16x8 = vandq_u16(vandq_u16(vcgtq_s16(edge135_s_16x8, edge0_s_16x8), vcgtq_s16(edge135_s_16x8, edge90_s_16x8)), vandq_u16(vcgtq_s16(edge135_s_16x8, edge45_s_16x8), vcgtq_s16(edge135_s_16x8, lowThreshold_s_16x8)));
+
+		const uint16x8_t isAnyEdge_u_16x8 = vorrq_u16(vorrq_u16(isEdge0_u_16x8, isEdge45_u_16x8), vorrq_u16(isEdge90_u_16x8, isEdge135_u_16x8));
+
+		const uint16x8_t magnitude_u_16x8 = vorrq_u16(vorrq_u16(vandq_u16(isEdge0_u_16x8, vreinterpretq_u16_s16(edge0_s_16x8)), vandq_u16(isEdge45_u_16x8, vreinterpretq_u16_s16(edge45_s_16x8))), vorrq_u16(vandq_u16(isEdge90_u_16x8, vreinterpretq_u16_s16(edge90_s_16x8)), vandq_u16(isEdge135_u_16x8, vreinterpretq_u16_s16(edge135_s_16x8))));
+
+		const uint16x8_t direction_u_16x8 = vorrq_u16(vorrq_u16(vorrq_u16(vandq_u16(isEdge0_u_16x8, directionVertical_u_16x8), vandq_u16(isEdge45_u_16x8, direction45_u_16x8)), vorrq_u16(vandq_u16(isEdge90_u_16x8, directionHorizontal_u_16x8), vandq_u16(isEdge135_u_16x8, direction135_u_16x8))), vbicq_u16(directionNoEdge_u_16x8, isAnyEdge_u_16x8));
+
+		vst1_u8(directionRow + x, vmovn_u16(direction_u_16x8));
+
+		if constexpr (std::is_same<TFilterOutputElementType, int8_t>::value)
+		{
+			vst1_s8(magnitudeRow + x, vmovn_s16(vreinterpretq_s16_u16(magnitude_u_16x8)));
+		}
+		else
+		{
+			vst1q_s16(magnitudeRow + x, vreinterpretq_s16_u16(magnitude_u_16x8));
+		}
 	}
 
-	// In the map of edge candidates find all weak edges (128) that are connected to strong edge (255)
-	while (!strongEdgeLocations.empty())
+#endif // OCEAN_HARDWARE_SSE_VERSION >= 41 || OCEAN_HARDWARE_NEON_VERSION >= 10
+
+	for (; x < width - 1u; ++x)
 	{
-		const CV::PixelPosition strongEdgeLocation = strongEdgeLocations.back();
-		ocean_assert(strongEdgeLocation.x() != 0u && strongEdgeLocation.x() < (width - 1u) && strongEdgeLocation.y() != 0u && strongEdgeLocation.y() < (height - 1u));
+		const int a = int(sourceTop[x - 1u]);
+		const int b = int(sourceTop[x]);
+		const int c = int(sourceTop[x + 1u]);
+
+		const int d = int(sourceCenter[x - 1u]);
+		const int f = int(sourceCenter[x + 1u]);
+
+		const int g = int(sourceBottom[x - 1u]);
+		const int h = int(sourceBottom[x]);
+		const int i = int(sourceBottom[x + 1u]);
 
-		strongEdgeLocations.pop_back();
+		// Finding the intensity gradient of the image and absolute magnitudes
+		const TFilterOutputElementType edge0 = TFilterOutputElementType(std::abs(outerFactor * (c - a + i - g) + innerFactor * (f - d)) >> normalizationShift);
+		const TFilterOutputElementType edge90 = TFilterOutputElementType(std::abs(outerFactor * (g + i - a - c) + innerFactor * (h - b)) >> normalizationShift);
+		const TFilterOutputElementType edge45 = TFilterOutputElementType(std::abs(outerFactor * (f + h - b - d) + innerFactor * (i - a)) >> normalizationShift);
+		const TFilterOutputElementType edge135 = TFilterOutputElementType(std::abs(outerFactor * (d + h - b - f) + innerFactor * (g - c)) >> normalizationShift);
 
-		// Weak edge locations (128u) in the 8-neighborhood of the current strong edge (255u) are upgraded to a strong edge as well.
-		const CV::PixelPosition neighbors[8] =
+		if (edge0 > edge45 && edge0 > edge90 && edge0 > edge135 && edge0 > lowThreshold)
+		{
+			directionRow[x] = ED_VERTICAL;
+			magnitudeRow[x] = edge0;
+		}
+		else if (edge45 > edge0 && edge45 > edge90 && edge45 > edge135 && edge45 > lowThreshold)
+		{
+			directionRow[x] = ED_DIAGONAL_45;
+			magnitudeRow[x] = edge45;
+		}
+		else if (edge90 > edge0 && edge90 > edge45 && edge90 > edge135 && edge90 > lowThreshold)
+		{
+			directionRow[x] = ED_HORIZONTAL;
+			magnitudeRow[x] = edge90;
+		}
+		else if (edge135 > edge0 && edge135 > edge90 && edge135 > edge45 && edge135 > lowThreshold)
 		{
-			strongEdgeLocation.northWest(),
-			strongEdgeLocation.north(),
-			strongEdgeLocation.northEast(),
+			directionRow[x] = ED_DIAGONAL_135;
+			magnitudeRow[x] = edge135;
+		}
+		else
+		{
+			// no edge because magnitude < lowThreshold
+			directionRow[x] = ED_NO_EDGE;
+			magnitudeRow[x] = 0;
+		}
+
+		ocean_assert(directionRow[x] != ED_NO_EDGE || magnitudeRow[x] <= lowThreshold);
+	}
+
+	directionRow[width - 1u] = ED_NO_EDGE;
+	magnitudeRow[width - 1u] = TFilterOutputElementType(0);
+}
+
+template<typename TFilterOutputElementType>
+void FrameFilterCanny::nonMaximumSuppressionRow(const uint8_t* directionRow, const TFilterOutputElementType* magnitudeRowTop, const TFilterOutputElementType* magnitudeRow, const TFilterOutputElementType* magnitudeRowBottom, uint8_t* targetRow, uint8_t* edgeCandidateMapRow, const unsigned int width, const unsigned int y, const TFilterOutputElementType lowThreshold, const TFilterOutputElementType highThreshold, CV::PixelPositions& strongEdgeLocations)
+{
+	ocean_assert(directionRow != nullptr && magnitudeRowTop != nullptr && magnitudeRow != nullptr && magnitudeRowBottom != nullptr);
+	ocean_assert(targetRow != nullptr && edgeCandidateMapRow != nullptr);
+	ocean_assert(width >= 3u && y >= 1u);
+	ocean_assert(lowThreshold < highThreshold);
 
-			strongEdgeLocation.west(),
-			strongEdgeLocation.east(),
+	// The left-most and the right-most pixels of the current row, like all border pixels, are zero by definition (first and last row have been set to zero in calling function already)
+	targetRow[0] = 0u;
+	edgeCandidateMapRow[0] = 0u;
 
-			strongEdgeLocation.southWest(),
-			strongEdgeLocation.south(),
-			strongEdgeLocation.southEast(),
-		};
+	targetRow[width - 1u] = 0u;
+	edgeCandidateMapRow[width - 1u] = 0u;
 
-		uint8_t* edgeCandidatesData = edgeCandidates.data<uint8_t>();
+	for (unsigned int x = 1u; x < (width - 1u); ++x)
+	{
+		ocean_assert(magnitudeRow[x] >= 0);
 
-		for (unsigned int i = 0u; i < 8u; ++i)
+		if (magnitudeRow[x] > lowThreshold)
 		{
-			const unsigned int targetPixelIndex = neighbors[i].y() * targetStrideElements + neighbors[i].x();
-			const unsigned int edgePixelIndex = neighbors[i].y() * width + neighbors[i].x();
+			// Apply non-maximum suppression using the neighbors perpendicular to direction of current gradient direction
+			//
+			// Local 8-neighborhood:
+			//
+			// 0 1 2
+			// 3 4 5   directionRow[x] <=> 4
+			// 6 7 8
+
+			TFilterOutputElementType gradientMagnitudeNeighbor1 = 0;
+			TFilterOutputElementType gradientMagnitudeNeighbor2 = 0;
+
+			switch (directionRow[x])
+			{
+				case ED_HORIZONTAL:
+					gradientMagnitudeNeighbor1 = magnitudeRowTop[x]; // 1
+					gradientMagnitudeNeighbor2 = magnitudeRowBottom[x]; // 7
+					break;
+
+				case ED_VERTICAL:
+					gradientMagnitudeNeighbor1 = magnitudeRow[x - 1u]; // 3
+					gradientMagnitudeNeighbor2 = magnitudeRow[x + 1u]; // 5
+					break;
+
+				case ED_DIAGONAL_45:
+					gradientMagnitudeNeighbor1 = magnitudeRowTop[x - 1u]; // 0
+					gradientMagnitudeNeighbor2 = magnitudeRowBottom[x + 1u]; // 8
+					break;
+
+				case ED_DIAGONAL_135:
+					gradientMagnitudeNeighbor1 = magnitudeRowTop[x + 1u]; // 2
+					gradientMagnitudeNeighbor2 = magnitudeRowBottom[x - 1u]; // 6
+					break;
+
+				default:
+					ocean_assert(false && "Never be here");
+					break;
+			}
+
+			ocean_assert(gradientMagnitudeNeighbor1 >= 0 && gradientMagnitudeNeighbor2 >= 0);
 
-			if (edgeCandidatesData[edgePixelIndex] == 128u)
+			if (magnitudeRow[x] > gradientMagnitudeNeighbor1 && magnitudeRow[x] >= gradientMagnitudeNeighbor2)
 			{
-				ocean_assert(neighbors[i].x() != 0u && neighbors[i].x() < (width - 1u) && neighbors[i].y() != 0u && neighbors[i].y() < (height - 1u));
+				if (magnitudeRow[x] > highThreshold)
+				{
+					// Value of current pixel exceeds the high threshold, so mark it as a strong edge
+					edgeCandidateMapRow[x] = 255u;
+					targetRow[x] = 255u;
 
-				target[targetPixelIndex] = 255u;
-				edgeCandidatesData[edgePixelIndex] = 255u;
+					// Store indices of pixels which are strong part of an edge (used as seed points for edge tracing)
+					strongEdgeLocations.emplace_back(x, y);
+				}
+				else
+				{
+					// Value of current pixel is in range between the low and high threshold, so mark it as a weak edge. It will be revisited later during edge tracing and target pixel will be changed to 255, if applicable
+					edgeCandidateMapRow[x] = 128u;
+					targetRow[x] = 0u;
+				}
 
-				strongEdgeLocations.push_back(neighbors[i]);
+				continue;
 			}
 		}
+
+		edgeCandidateMapRow[x] = 0u;
+		targetRow[x] = 0u;
 	}
 }
 
-template<typename TFilterOutputElementType>
-inline void FrameFilterCanny::extractEdgePixelsSubset(const uint8_t* const gradientDirections, const TFilterOutputElementType* const gradientMagnitudes, uint8_t* const target, uint8_t* const edgeCandidateMap, CV::PixelPositions* edgeCandidates, Lock* edgeCandidateLock, const unsigned int width, const unsigned int height, const unsigned int targetPaddingElements, const TFilterOutputElementType lowThreshold, const TFilterOutputElementType highThreshold, const unsigned int firstRow, const unsigned numberRows)
+void FrameFilterCanny::hysteresisBlocksSubset(uint8_t* target, uint8_t* edgeCandidateMap, const unsigned int width, const unsigned int height, const unsigned int targetPaddingElements, const unsigned int blocks, CV::PixelPositions* strongEdgeLocations, CV::PixelPositions* foreignEdgeLocations, const unsigned int firstBlock, const unsigned int numberBlocks)
 {
-	ocean_assert(gradientDirections != nullptr && gradientMagnitudes != nullptr);
-	ocean_assert(target != nullptr);
-	ocean_assert(edgeCandidateMap != nullptr);
-	ocean_assert(edgeCandidates != nullptr);
+	ocean_assert(target != nullptr && edgeCandidateMap != nullptr);
 	ocean_assert(width >= 3u && height >= 3u);
-	ocean_assert(lowThreshold < highThreshold);
-	ocean_assert_and_suppress_unused(firstRow != 0 && firstRow + numberRows <= (height - 1u) && "The first and the last image row must be skipped!", height);
-
-	CV::PixelPositions localEdgeCandidates;
+	ocean_assert(strongEdgeLocations != nullptr && foreignEdgeLocations != nullptr);
+	ocean_assert(firstBlock + numberBlocks <= blocks);
 
 	const unsigned int targetStrideElements = width + targetPaddingElements;
 
-	for (unsigned int y = firstRow; y < firstRow + numberRows; ++y)
+	for (unsigned int block = firstBlock; block < firstBlock + numberBlocks; ++block)
 	{
-		ocean_assert(y != 0u && y < (height - 1u));
+		const unsigned int blockStartRow = blockFirstRow(block, blocks, height);
+		const unsigned int blockEndRow = blockFirstRow(block + 1u, blocks, height);
 
-		const uint8_t* gradientDirectionsRow = gradientDirections + y * width;
-		const TFilterOutputElementType* gradientMagnitudesRow = gradientMagnitudes + y * width;
+		CV::PixelPositions& blockStrongEdgeLocations = strongEdgeLocations[block];
+		CV::PixelPositions& blockForeignEdgeLocations = foreignEdgeLocations[block];
 
-		uint8_t* targetRow = target + y * targetStrideElements;
-		uint8_t* edgeCandidateMapRow = edgeCandidateMap + y * width;
+		while (!blockStrongEdgeLocations.empty())
+		{
+			const CV::PixelPosition strongEdgeLocation = blockStrongEdgeLocations.back();
+			ocean_assert(strongEdgeLocation.x() != 0u && strongEdgeLocation.x() < (width - 1u) && strongEdgeLocation.y() >= blockStartRow && strongEdgeLocation.y() < blockEndRow);
 
-		// The left-most and the right-most pixels of the current row, like all border pixels, are zero by definition (first and last row have been set to zero in calling function already)
-		targetRow[0] = 0u;
-		edgeCandidateMapRow[0] = 0u;
+			blockStrongEdgeLocations.pop_back();
 
-		targetRow[width - 1u] = 0u;
-		edgeCandidateMapRow[width - 1u] = 0u;
+			// Weak edge locations (128u) in the 8-neighborhood of the current strong edge (255u) are upgraded to a strong edge as well.
+			const CV::PixelPosition neighbors[8] =
+			{
+				strongEdgeLocation.northWest(),
+				strongEdgeLocation.north(),
+				strongEdgeLocation.northEast(),
 
-		for (unsigned int x = 1u; x < (width - 1u); ++x)
-		{
-			ocean_assert(gradientMagnitudesRow[x] >= 0);
+				strongEdgeLocation.west(),
+				strongEdgeLocation.east(),
 
-			if (gradientMagnitudesRow[x] > lowThreshold)
-			{
-				// Apply non-maximum suppression using the neighbors perpendicular to direction of current gradient direction
-				//
-				// Local 8-neighborhood:
-				//
-				// 0 1 2
-				// 3 4 5   gradientDirectionsRow[x] <=> 4
-				// 6 7 8
-
-				TFilterOutputElementType gradientMagnitudeNeighbor1 = 0;
-				TFilterOutputElementType gradientMagnitudeNeighbor2 = 0;
-
-				switch (gradientDirectionsRow[x])
-				{
-					case ED_HORIZONTAL:
-						gradientMagnitudeNeighbor1 = *(gradientMagnitudesRow + x - width); // 1
-						gradientMagnitudeNeighbor2 = *(gradientMagnitudesRow + x + width); // 7
-						break;
-
-					case ED_VERTICAL:
-						gradientMagnitudeNeighbor1 = *(gradientMagnitudesRow + x - 1u); // 3
-						gradientMagnitudeNeighbor2 = *(gradientMagnitudesRow + x + 1u); // 5
-						break;
-
-					case ED_DIAGONAL_45:
-						gradientMagnitudeNeighbor1 = *(gradientMagnitudesRow + x - width - 1u); // 0
-						gradientMagnitudeNeighbor2 = *(gradientMagnitudesRow + x + width + 1u); // 8
-						break;
-
-					case ED_DIAGONAL_135:
-						gradientMagnitudeNeighbor1 = *(gradientMagnitudesRow + x - width + 1u); // 2
-						gradientMagnitudeNeighbor2 = *(gradientMagnitudesRow + x + width - 1u); // 7
-						break;
-
-					default:
-						ocean_assert(false && "Never be here");
-						break;
-				}
+				strongEdgeLocation.southWest(),
+				strongEdgeLocation.south(),
+				strongEdgeLocation.southEast(),
+			};
 
-				ocean_assert(gradientMagnitudeNeighbor1 >= 0 && gradientMagnitudeNeighbor2 >= 0);
+			for (unsigned int i = 0u; i < 8u; ++i)
+			{
+				const CV::PixelPosition& neighbor = neighbors[i];
 
-				if (gradientMagnitudesRow[x] > gradientMagnitudeNeighbor1 && gradientMagnitudesRow[x] >= gradientMagnitudeNeighbor2)
+				if (neighbor.y() < blockStartRow || neighbor.y() >= blockEndRow)
 				{
-					if (gradientMagnitudesRow[x] > highThreshold)
-					{
-						// Value of current pixel exceeds the high threshold, so mark it as a strong edge
-						edgeCandidateMapRow[x] = 255u;
-						targetRow[x] = 255u;
+					// the neighbor belongs to another block (or to the first/last row which never contains an edge), the neighbor must not be accessed concurrently
 
-						// Store indices of pixels which are strong part of an edge (used as seed points for edge tracing)
-						ocean_assert(targetRow + x >= target && targetRow + x < target + y * targetStrideElements + width);
-						localEdgeCandidates.emplace_back(x, y);
-					}
-					else
+					if (neighbor.y() != 0u && neighbor.y() != height - 1u && neighbor.x() != 0u && neighbor.x() != width - 1u)
 					{
-						// Value of current pixel is in range between the low and high threshold, so mark it as a weak edge. It will be revisited later during edge tracing and target pixel will be changed to 255, if applicable
-						edgeCandidateMapRow[x] = 128u;
-						targetRow[x] = 0u;
+						blockForeignEdgeLocations.push_back(neighbor);
 					}
 
 					continue;
 				}
-			}
 
-			edgeCandidateMapRow[x] = 0u;
-			targetRow[x] = 0u;
-		}
-	}
+				const unsigned int edgePixelIndex = neighbor.y() * width + neighbor.x();
 
-	if (!localEdgeCandidates.empty())
-	{
-		const OptionalScopedLock scopedLock(edgeCandidateLock);
-		edgeCandidates->insert(edgeCandidates->end(), localEdgeCandidates.begin(), localEdgeCandidates.end());
+				if (edgeCandidateMap[edgePixelIndex] == 128u)
+				{
+					ocean_assert(neighbor.x() != 0u && neighbor.x() < (width - 1u) && neighbor.y() != 0u && neighbor.y() < (height - 1u));
+
+					target[neighbor.y() * targetStrideElements + neighbor.x()] = 255u;
+					edgeCandidateMap[edgePixelIndex] = 255u;
+
+					blockStrongEdgeLocations.push_back(neighbor);
+				}
+			}
+		}
 	}
 }
 
@@ -145,80 +145,127 @@ class OCEAN_CV_EXPORT FrameFilterCanny
 		static void filterCanny(const uint8_t* source, uint8_t* target, const unsigned int width, const unsigned int height, const unsigned int sourcePaddingElements, const unsigned int targetPaddingElements, const TFilterOutputElementType lowThreshold, const TFilterOutputElementType highThreshold, Worker* worker = nullptr);
 
 		/**
-		 * Calculates edge directions (quantized to 0, 90, 45, and 135 degrees) and their corresponding magnitues (based on Sobel or Scharr filter responses).
-		 * @param egdeFilterResults Source: filter response of scharr filter (zipped frame for each degree)
-		 * @param direction The target receiving the quantized edge directions.
-		 * @param magnitude The target receiving the edge magnitudes.
-		 * @param lowThreshold The threshold for not being edges
+		 * Applies the fused gradient, non-maximum suppression and double thresholding to a subset of row blocks.
+		 * Each block determines the gradients of its rows (and of the two neighboring rows) in a small ring buffer so that the gradient frame does not need to be stored.
+		 * @param source The source frame, must be valid
+		 * @param target The target frame receiving the strong edges, must be valid
+		 * @param edgeCandidateMap The resulting map of edge candidates (0: no edge, 128: weak edge, 255: strong edge), with resolution width x height, must be valid
 		 * @param width The width of the frame in pixel, with range [3, infinity)
 		 * @param height The height of the frame in pixel, with range [3, infinity)
-		 * @param worker An optional worker object to distribute the computational load
-		 * @tparam T The data type of the edge operator responses
+		 * @param sourcePaddingElements The number of padding elements at the end of each source row, in elements, with range [0, infinity)
+		 * @param targetPaddingElements The number of padding elements at the end of each target row, in elements, with range [0, infinity)
+		 * @param lowThreshold The threshold for not being edges
+		 * @param highThreshold The threshold for surely being edges, with range (lowThreshold, infinity)
+		 * @param blocks The number of row blocks in which the frame is separated, with range [1, height - 2]
+		 * @param strongEdgeLocations The resulting locations of strong edges, one vector for each block, must be valid
+		 * @param firstBlock The first block to be handled, with range [0, blocks - 1]
+		 * @param numberBlocks The number of blocks to be handled, with range [1, blocks - firstBlock]
+		 * @tparam TFilterOutputElementType The element type of the filter output, e.g., `int8_t` or `int16_t`
+		 * @tparam tEdgeFilter The edge filter to be applied
 		 */
-		template <typename T>
-		static inline void extractGradientDirectionsAndMagnitudes(const T* egdeFilterResults, uint8_t* direction, T* magnitude, const T lowThreshold, const unsigned int width, const unsigned int height, Worker* worker = nullptr);
+		template <typename TFilterOutputElementType, EdgeFilter tEdgeFilter>
+		static void filterCannyBlocksSubset(const uint8_t* source, uint8_t* target, uint8_t* edgeCandidateMap, const unsigned int width, const unsigned int height, const unsigned int sourcePaddingElements, const unsigned int targetPaddingElements, const TFilterOutputElementType lowThreshold, const TFilterOutputElementType highThreshold, const unsigned int blocks, CV::PixelPositions* strongEdgeLocations, const unsigned int firstBlock, const unsigned int numberBlocks);
 
 		/**
-		 * Calculates a subset of edge directions (quantized to 0, 90, 45, and 135 degrees) and their corresponding magnitues (based on Sobel or Scharr filter responses).
-		 * @param egdeFilterResults Source: filter response of scharr filter (zipped frame for each degree)
-		 * @param direction The target receiving the quantized edge directions.
-		 * @param magnitude The target receiving the edge magnitudes.
-		 * @param lowThreshold The threshold for not being edges
+		 * Determines the quantized edge directions (0, 90, 45, and 135 degrees) and the corresponding magnitudes of one row directly from the source frame.
+		 * The first and last pixel of each row, and the first and last row of the frame do not have edges.
+		 * @param source The source frame, must be valid
 		 * @param width The width of the frame in pixel, with range [3, infinity)
 		 * @param height The height of the frame in pixel, with range [3, infinity)
-		 * @param firstRow First row to be filtered
-		 * @param numberRows Number of rows to be filtered
-		 * @tparam T The data type of the edge operator responses
+		 * @param sourceStrideElements The number of elements between two consecutive source rows, with range [width, infinity)
+		 * @param y The index of the row to be handled, with range [0, height - 1]
+		 * @param lowThreshold The threshold for not being edges
+		 * @param directionRow The resulting edge directions of the row, must be valid
+		 * @param magnitudeRow The resulting edge magnitudes of the row, must be valid
+		 * @tparam TFilterOutputElementType The element type of the filter output, e.g., `int8_t` or `int16_t`
+		 * @tparam tEdgeFilter The edge filter to be applied
 		 */
-		template <typename T>
-		static void extractGradientDirectionsAndMagnitudesSubset(const T* egdeFilterResults, uint8_t* direction, T* magnitude, const T lowThreshold, const unsigned int width, const unsigned int height, const unsigned int firstRow, const unsigned int numberRows);
+		template <typename TFilterOutputElementType, EdgeFilter tEdgeFilter>
+		static void gradientDirectionsAndMagnitudesRow(const uint8_t* source, const unsigned int width, const unsigned int height, const unsigned int sourceStrideElements, const unsigned int y, const TFilterOutputElementType lowThreshold, uint8_t* directionRow, TFilterOutputElementType* magnitudeRow);
 
 		/**
-		 * Extract edges from the gradient magnitudes and directions
-		 * @param gradientDirections The frame containing the binned directions of the gradient (0, 90, 45, 135), must be valid
-		 * @param gradientMagnitudes The frame containing the absolute gradient magnitudes, must be valid
-		 * @param target The frame that will contain extracted Canny edges, must be valid (8-bit, 1 channel image, size: width x height)
-		 * @param width The width of the frames in pixels, range: [3, infinity)
-		 * @param height The height of the frames in pixels, range: [3, infinity)
-		 * @param targetPaddingElements The number of padding elements at the end of each target row, in elements, with range [0, infinity)
-		 * @param lowThreshold After filtering the source image (cf. `tEdgeFilter`), pixels with an absolute filter response below this threshold will be immediately rejected as edges, range: 8-bit Sobel/Scharr: [0, 126], 16-bit Sobel [0, 1019], 16-bit Scharr: [0, 4079]
-		 * @param highThreshold After filtering the source image (cf. `tEdgeFilter`), pixels with an absolute filter response below this threshold will be immediately accepted as edges if they are local maxima (non-maximum suppression), range: 8-bit Sobel/Scharr: [lowThreshold, 127], 16-bit Sobel [0, 1020], 16-bit Scharr: [0, 4080]
-		 * @param worker An optional worker object for parallelization
+		 * Applies the non-maximum suppression and the double thresholding to one row.
+		 * @param directionRow The edge directions of the row, must be valid
+		 * @param magnitudeRowTop The edge magnitudes of the previous row, must be valid
+		 * @param magnitudeRow The edge magnitudes of the row, must be valid
+		 * @param magnitudeRowBottom The edge magnitudes of the next row, must be valid
+		 * @param targetRow The target row receiving the strong edges, must be valid
+		 * @param edgeCandidateMapRow The row of the edge candidate map, must be valid
+		 * @param width The width of the frame in pixel, with range [3, infinity)
+		 * @param y The index of the row, with range [1, height - 2]
+		 * @param lowThreshold The threshold for not being edges
+		 * @param highThreshold The threshold for surely being edges, with range (lowThreshold, infinity)
+		 * @param strongEdgeLocations The locations of strong edges to which new locations will be added
+		 * @tparam TFilterOutputElementType The element type of the filter output, e.g., `int8_t` or `int16_t`
 		 */
 		template <typename TFilterOutputElementType>
-		static void extractEdgePixels(const uint8_t* const gradientDirections, const TFilterOutputElementType* const gradientMagnitudes, uint8_t* const target, const unsigned int width, const unsigned int height, const unsigned int targetPaddingElements, const TFilterOutputElementType lowThreshold, const TFilterOutputElementType highThreshold, Worker* worker = nullptr);
+		static void nonMaximumSuppressionRow(const uint8_t* directionRow, const TFilterOutputElementType* magnitudeRowTop, const TFilterOutputElementType* magnitudeRow, const TFilterOutputElementType* magnitudeRowBottom, uint8_t* targetRow, uint8_t* edgeCandidateMapRow, const unsigned int width, const unsigned int y, const TFilterOutputElementType lowThreshold, const TFilterOutputElementType highThreshold, CV::PixelPositions& strongEdgeLocations);
 
 		/**
-		 * Helper function to extract edges from the gradient magnitudes and directions
-		 * @param gradientDirections The frame containing the binned directions of the gradient (0, 90, 45, 135), must be valid
-		 * @param gradientMagnitudes The frame containing the absolute gradient magnitudes, must be valid
-		 * @param target The frame that will contain extracted Canny edges, must be valid (8-bit, 1 channel image, size: width x height)
-		 * @param edgeCandidateMap The map of edge candidates
-		 * @param edgeCandidateStack The resulting edge candidates, must be valid
-		 * @param edgeCandidateStackLock The lock for the stack of edge candidates
-		 * @param width The width of the frames in pixels, range: [3, infinity)
-		 * @param height The height of the frames in pixels, range: [3, infinity)
+		 * Applies the hysteresis to a subset of row blocks; weak edges connected to strong edges are upgraded to strong edges.
+		 * The edge tracing does not leave the rows of a block, neighbors in other blocks are forwarded to the caller.
+		 * @param target The target frame receiving the strong edges, must be valid
+		 * @param edgeCandidateMap The map of edge candidates (0: no edge, 128: weak edge, 255: strong edge), must be valid
+		 * @param width The width of the frame in pixel, with range [3, infinity)
+		 * @param height The height of the frame in pixel, with range [3, infinity)
 		 * @param targetPaddingElements The number of padding elements at the end of each target row, in elements, with range [0, infinity)
-		 * @param lowThreshold After filtering the source image (cf. `tEdgeFilter`), pixels with an absolute filter response below this threshold will be immediately rejected as edges, range: 8-bit Sobel/Scharr: [0, 126], 16-bit Sobel [0, 1019], 16-bit Scharr: [0, 4079]
-		 * @param highThreshold After filtering the source image (cf. `tEdgeFilter`), pixels with an absolute filter response below this threshold will be immediately accepted as edges if they are local maxima (non-maximum suppression), range: 8-bit Sobel/Scharr: [lowThreshold, 127], 16-bit Sobel [0, 1020], 16-bit Scharr: [0, 4080]
-		 * @param firstRow The first row to be handled, with range [0, height - 1]
-		 * @param numberRows The number of rows to be handled, with range [1, height - firstRow]
+		 * @param blocks The number of row blocks in which the frame is separated, with range [1, height - 2]
+		 * @param strongEdgeLocations The locations of strong edges to be traced, one vector for each block, will be empty afterwards, must be valid
+		 * @param foreignEdgeLocations The resulting locations of neighbors of strong edges which are located in other blocks, one vector for each block, must be valid
+		 * @param firstBlock The first block to be handled, with range [0, blocks - 1]
+		 * @param numberBlocks The number of blocks to be handled, with range [1, blocks - firstBlock]
 		 */
-		template <typename TFilterOutputElementType>
-		static void extractEdgePixelsSubset(const uint8_t* const gradientDirections, const TFilterOutputElementType* const gradientMagnitudes, uint8_t* const target, uint8_t* const edgeCandidateMap, CV::PixelPositions* edgeCandidateStack, Lock* edgeCandidateStackLock, const unsigned int width, const unsigned int height, const unsigned int targetPaddingElements, const TFilterOutputElementType lowThreshold, const TFilterOutputElementType highThreshold, const unsigned int firstRow, const unsigned numberRows);
+		static void hysteresisBlocksSubset(uint8_t* target, uint8_t* edgeCandidateMap, const unsigned int width, const unsigned int height, const unsigned int targetPaddingElements, const unsigned int blocks, CV::PixelPositions* strongEdgeLocations, CV::PixelPositions* foreignEdgeLocations, const unsigned int firstBlock, const unsigned int numberBlocks);
+
+		/**
+		 * Returns the first row of a row block.
+		 * The blocks cover the rows [1, height - 2], the first and last row of the frame never contain edges.
+		 * @param block The index of the block, with range [0, blocks]
+		 * @param blocks The number of blocks, with range [1, height - 2]
+		 * @param height The height of the frame in pixel, with range [3, infinity)
+		 * @return The first row of the block, the end row of the last block if `block == blocks`
+		 */
+		static inline unsigned int blockFirstRow(const unsigned int block, const unsigned int blocks, const unsigned int height);
+
+		/**
+		 * Returns the index of the row block which contains a specific row.
+		 * @param y The index of the row, with range [1, height - 2]
+		 * @param blocks The number of blocks, with range [1, height - 2]
+		 * @param height The height of the frame in pixel, with range [3, infinity)
+		 * @return The index of the block, with range [0, blocks - 1]
+		 */
+		static inline unsigned int blockIndex(const unsigned int y, const unsigned int blocks, const unsigned int height);
 };
 
-template <typename T>
-inline void FrameFilterCanny::extractGradientDirectionsAndMagnitudes(const T* egdeFilterResults, uint8_t* direction, T* magnitude, const T lowThreshold, const unsigned int width, const unsigned int height, Worker* worker)
+inline unsigned int FrameFilterCanny::blockFirstRow(const unsigned int block, const unsigned int blocks, const unsigned int height)
+{
+	ocean_assert(blocks >= 1u && height >= 3u && block <= blocks);
+	ocean_assert(blocks <= height - 2u);
+
+	return 1u + (unsigned int)((uint64_t(block) * uint64_t(height - 2u)) / uint64_t(blocks));
+}
+
+inline unsigned int FrameFilterCanny::blockIndex(const unsigned int y, const unsigned int blocks, const unsigned int height)
 {
-	if (worker)
+	ocean_assert(y >= 1u && y < height - 1u);
+
+	unsigned int block = (unsigned int)((uint64_t(y - 1u) * uint64_t(blocks)) / uint64_t(height - 2u));
+
+	while (block + 1u < blocks && blockFirstRow(block + 1u, blocks, height) <= y)
 	{
-		worker->executeFunction(Worker::Function::createStatic(&extractGradientDirectionsAndMagnitudesSubset, egdeFilterResults, direction, magnitude, lowThreshold, width, height, 0u, 0u), 0, height, 6u, 7u, 20u);
+		++block;
 	}
-	else
+
+	while (blockFirstRow(block, blocks, height) > y)
 	{
-		extractGradientDirectionsAndMagnitudesSubset(egdeFilterResults, direction, magnitude, lowThreshold, width, height, 0u, height);
+		ocean_assert(block != 0u);
+		--block;
 	}
+
+	ocean_assert(block < blocks);
+	ocean_assert(blockFirstRow(block, blocks, height) <= y && y < blockFirstRow(block + 1u, blocks, height));
+
+	return block;
 }
 
 } // namespace CV
@@ -45,6 +45,22 @@ class OCEAN_CV_EXPORT FrameFilterDilation : public FrameFilterMorphology
 		template <MorphologyFilter tDilationFilter>
 		static void filter1Channel8Bit(uint8_t* mask, const unsigned int width, const unsigned int height, const unsigned int iterations, const uint8_t maskValue = 0x00, const unsigned int maskPaddingElements = 0u, Worker* worker = nullptr);
 
+		/**
+		 * Applies one dilation filter with arbitrary square kernel for an 8 bit mask image.
+		 * The computational cost per pixel is independent of the kernel size, the result is identical to iterated 3x3 filters with the same overall size.<br>
+		 * The value of a mask pixel (to be dilated) can be defined, every other pixel value is interpreted as a non-mask pixels.
+		 * @param mask The mask frame to be filtered, must be valid
+		 * @param target The target frame receiving the filter response, may be identical to 'mask', must be valid
+		 * @param width The width of the mask frame in pixel, with range [1, infinity)
+		 * @param height The height of the mask frame in pixel, with range [1, infinity)
+		 * @param filterSize The size of the square kernel edge in pixel, must be odd, with range [1, infinity)
+		 * @param maskValue The value of a mask pixel to be dilated, with range [0, 255]
+		 * @param maskPaddingElements Optional number of padding elements at the end of each mask row, in elements, with range [0, infinity)
+		 * @param targetPaddingElements Optional number of padding elements at the end of each target row, in elements, with range [0, infinity)
+		 * @param worker Optional worker object to distribute the computation
+		 */
+		static inline void filter1Channel8BitSquare(const uint8_t* mask, uint8_t* target, const unsigned int width, const unsigned int height, const unsigned int filterSize, const uint8_t maskValue = 0x00, const unsigned int maskPaddingElements = 0u, const unsigned int targetPaddingElements = 0u, Worker* worker = nullptr);
+
 		/**
 		 * Applies one dilation filter iteration for an 8 bit mask image using a 4-neighborhood.
 		 * The value of a mask pixel (to be dilated) can be defined, every other pixel value is interpreted as a non-mask pixels.
@@ -149,6 +165,19 @@ void FrameFilterDilation::filter1Channel8Bit(uint8_t* mask, const unsigned int w
 	ocean_assert(width >= 2u && height >= 2u);
 	ocean_assert(iterations >= 1u);
 
+	if constexpr (tDilationFilter == MF_SQUARE_3 || tDilationFilter == MF_SQUARE_5)
+	{
+		// several iterations of a square filter are identical to one iteration with a larger square filter
+
+		const unsigned int filterSize = (tDilationFilter == MF_SQUARE_3 ? 2u : 4u) * iterations + 1u;
+
+		if (filterSize >= squareMinimalFilterSize_)
+		{
+			FrameFilterMorphology::filter1Channel8BitSquare<false>(mask, mask, width, height, filterSize, maskValue, maskPaddingElements, maskPaddingElements, worker);
+			return;
+		}
+	}
+
 	Frame intermediateTarget(FrameType(width, height, FrameType::FORMAT_Y8, FrameType::ORIGIN_UPPER_LEFT));
 
 	switch (tDilationFilter)
@@ -256,6 +285,15 @@ inline void FrameFilterDilation::filter1Channel8Bit24Neighbor(const uint8_t* mas
 	}
 }
 
+inline void FrameFilterDilation::filter1Channel8BitSquare(const uint8_t* mask, uint8_t* target, const unsigned int width, const unsigned int height, const unsigned int filterSize, const uint8_t maskValue, const unsigned int maskPaddingElements, const unsigned int targetPaddingElements, Worker* worker)
+{
+	ocean_assert(mask != nullptr && target != nullptr);
+	ocean_assert(width >= 1u && height >= 1u);
+	ocean_assert(filterSize >= 1u && filterSize % 2u == 1u);
+
+	FrameFilterMorphology::filter1Channel8BitSquare<false>(mask, target, width, height, filterSize, maskValue, maskPaddingElements, targetPaddingElements, worker);
+}
+
 template <>
 OCEAN_FORCE_INLINE bool FrameFilterDilation::eachPixelNotEqual<3u>(const uint8_t* const maskPixels, const uint8_t maskValue)
 {
@@ -149,6 +149,22 @@ class OCEAN_CV_EXPORT FrameFilterErosion : public FrameFilterMorphology
 		template <MorphologyFilter tErosionFilter>
 		static void filter1Channel8Bit(uint8_t* mask, const unsigned int width, const unsigned int height, const unsigned int iterations, const uint8_t maskValue = 0x00, const unsigned int maskPaddingElements = 0u, Worker* worker = nullptr);
 
+		/**
+		 * Applies one erosion filter with arbitrary square kernel for an 8 bit mask image.
+		 * The computational cost per pixel is independent of the kernel size, the result is identical to iterated 3x3 filters with the same overall size.<br>
+		 * The value of a mask pixel (to be eroded) can be defined, every other pixel value is interpreted as a non-mask pixels.
+		 * @param mask The mask frame to be filtered, must be valid
+		 * @param target The target frame receiving the filter response, may be identical to 'mask', must be valid
+		 * @param width The width of the mask frame in pixel, with range [1, infinity)
+		 * @param height The height of the mask frame in pixel, with range [1, infinity)
+		 * @param filterSize The size of the square kernel edge in pixel, must be odd, with range [1, infinity)
+		 * @param maskValue The value of a mask pixel to be eroded, with range [0, 255]
+		 * @param maskPaddingElements Optional number of padding elements at the end of each mask row, in elements, with range [0, infinity)
+		 * @param targetPaddingElements Optional number of padding elements at the end of each target row, in elements, with range [0, infinity)
+		 * @param worker Optional worker object to distribute the computation
+		 */
+		static inline void filter1Channel8BitSquare(const uint8_t* mask, uint8_t* target, const unsigned int width, const unsigned int height, const unsigned int filterSize, const uint8_t maskValue = 0x00, const unsigned int maskPaddingElements = 0u, const unsigned int targetPaddingElements = 0u, Worker* worker = nullptr);
+
 		/**
 		 * Applies one erosion filter iteration in an 8 bit mask image using a 4-neighborhood.
 		 * The value of a mask pixel (to be eroded) can be defined, every other pixel value is interpreted as a non-mask pixels.
@@ -1347,6 +1363,19 @@ void FrameFilterErosion::filter1Channel8Bit(uint8_t* mask, const unsigned int wi
 	ocean_assert(width >= 4u && height >= 4u);
 	ocean_assert(iterations >= 1u);
 
+	if constexpr (tErosionFilter == MF_SQUARE_3 || tErosionFilter == MF_SQUARE_5)
+	{
+		// several iterations of a square filter are identical to one iteration with a larger square filter
+
+		const unsigned int filterSize = (tErosionFilter == MF_SQUARE_3 ? 2u : 4u) * iterations + 1u;
+
+		if (filterSize >= squareMinimalFilterSize_)
+		{
+			FrameFilterMorphology::filter1Channel8BitSquare<true>(mask, mask, width, height, filterSize, maskValue, maskPaddingElements, maskPaddingElements, worker);
+			return;
+		}
+	}
+
 	Frame intermediateTarget(FrameType(width, height, FrameType::FORMAT_Y8, FrameType::ORIGIN_UPPER_LEFT));
 
 	switch (tErosionFilter)
@@ -1454,6 +1483,15 @@ inline void FrameFilterErosion::filter1Channel8Bit24Neighbor(const uint8_t* mask
 	}
 }
 
+inline void FrameFilterErosion::filter1Channel8BitSquare(const uint8_t* mask, uint8_t* target, const unsigned int width, const unsigned int height, const unsigned int filterSize, const uint8_t maskValue, const unsigned int maskPaddingElements, const unsigned int targetPaddingElements, Worker* worker)
+{
+	ocean_assert(mask != nullptr && target != nullptr);
+	ocean_assert(width >= 1u && height >= 1u);
+	ocean_assert(filterSize >= 1u && filterSize % 2u == 1u);
+
+	FrameFilterMorphology::filter1Channel8BitSquare<true>(mask, target, width, height, filterSize, maskValue, maskPaddingElements, targetPaddingElements, worker);
+}
+
 template <>
 OCEAN_FORCE_INLINE bool FrameFilterErosion::onePixelNotEqual<3u>(const uint8_t* const maskPixels, const uint8_t maskValue)
 {
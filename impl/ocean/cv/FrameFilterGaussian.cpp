@@ -6,8 +6,11 @@
  */
 
 #include "ocean/cv/FrameFilterGaussian.h"
+#include "ocean/cv/CVUtilities.h"
+#include "ocean/cv/FrameConverter.h"
 
 #include "ocean/base/Frame.h"
+#include "ocean/base/Memory.h"
 
 namespace Ocean
 {
@@ -53,6 +56,17 @@ bool FrameFilterGaussian::filter(const Frame& source, Frame& target, const unsig
 		return filter<float, float>(source.constdata<float>(), target.data<float>(), source.width(), source.height(), source.channels(), source.paddingElements(), target.paddingElements(), filterSize, filterSize, -1.0f, worker, reusableMemory, Processor::get().instructions());
 	}
 
+	if (source.dataType() == FrameType::DT_SIGNED_FLOAT_16)
+	{
+		if (!target.set(source.frameType(), false /*forceOwner*/, true /*forceWritable*/))
+		{
+			ocean_assert(false && "This should never happen!");
+			return false;
+		}
+
+		return filterFloat16(source.constdata<Float16>(), target.data<Float16>(), source.width(), source.height(), source.channels(), source.paddingElements(), target.paddingElements(), filterSize, filterSize, -1.0f, worker);
+	}
+
 	ocean_assert(false && "Unexpected pixel format!");
 	return false;
 }
@@ -104,10 +118,608 @@ bool FrameFilterGaussian::filter(Frame& frame, const unsigned int filterSize, Wo
 		return filter<float, float>(frame.constdata<float>(), frame.data<float>(), frame.width(), frame.height(), frame.channels(), frame.paddingElements(), frame.paddingElements(), filterSize, filterSize, -1.0f, worker, reusableMemory, Processor::get().instructions());
 	}
 
+	if (frame.dataType() == FrameType::DT_SIGNED_FLOAT_16)
+	{
+		ocean_assert(frame.constdata<Float16>() != nullptr && frame.data<Float16>() != nullptr);
+
+		return filterFloat16(frame.constdata<Float16>(), frame.data<Float16>(), frame.width(), frame.height(), frame.channels(), frame.paddingElements(), frame.paddingElements(), filterSize, filterSize, -1.0f, worker);
+	}
+
 	ocean_assert(false && "Unexpected pixel format!");
 	return false;
 }
 
+bool FrameFilterGaussian::filter(const Frame& source, Frame& target, const float sigma, const FilterImplementation implementation, Worker* worker, ReusableMemory* reusableMemory)
+{
+	ocean_assert(source.isValid());
+	ocean_assert(sigma >= 0.5f);
+
+	if (!source.isValid() || sigma < 0.5f)
+	{
+		return false;
+	}
+
+	ocean_assert(source.numberPlanes() == 1u);
+	if (source.numberPlanes() != 1u || (source.dataType() != FrameType::DT_UNSIGNED_INTEGER_8 && source.dataType() != FrameType::DT_SIGNED_FLOAT_32))
+	{
+		ocean_assert(false && "Unexpected pixel format!");
+		return false;
+	}
+
+	if (implementation == FI_KERNEL)
+	{
+		const unsigned int filterSize = sigma2filterSize(sigma);
+
+		if (source.width() < filterSize || source.height() < filterSize)
+		{
+			return false;
+		}
+
+		if (!target.set(source.frameType(), false /*forceOwner*/, true /*forceWritable*/))
+		{
+			ocean_assert(false && "This should never happen!");
+			return false;
+		}
+
+		if (source.dataType() == FrameType::DT_UNSIGNED_INTEGER_8)
+		{
+			return filter<uint8_t, uint32_t>(source.constdata<uint8_t>(), target.data<uint8_t>(), source.width(), source.height(), source.channels(), source.paddingElements(), target.paddingElements(), filterSize, filterSize, sigma, worker, reusableMemory, Processor::get().instructions());
+		}
+
+		return filter<float, float>(source.constdata<float>(), target.data<float>(), source.width(), source.height(), source.channels(), source.paddingElements(), target.paddingElements(), filterSize, filterSize, sigma, worker, reusableMemory, Processor::get().instructions());
+	}
+
+	ocean_assert(implementation == FI_RECURSIVE);
+
+	if (!target.set(source.frameType(), false /*forceOwner*/, true /*forceWritable*/))
+	{
+		ocean_assert(false && "This should never happen!");
+		return false;
+	}
+
+	if (source.dataType() == FrameType::DT_UNSIGNED_INTEGER_8)
+	{
+		return filterRecursive<uint8_t>(source.constdata<uint8_t>(), target.data<uint8_t>(), source.width(), source.height(), source.channels(), source.paddingElements(), target.paddingElements(), sigma, worker, reusableMemory);
+	}
+
+	return filterRecursive<float>(source.constdata<float>(), target.data<float>(), source.width(), source.height(), source.channels(), source.paddingElements(), target.paddingElements(), sigma, worker, reusableMemory);
+}
+
+template <typename T>
+bool FrameFilterGaussian::filterRecursive(const T* source, T* target, const unsigned int width, const unsigned int height, const unsigned int channels, const unsigned int sourcePaddingElements, const unsigned int targetPaddingElements, const float sigma, Worker* worker, ReusableMemory* reusableMemory)
+{
+	static_assert(std::is_same<T, uint8_t>::value || std::is_same<T, float>::value, "Invalid data type!");
+
+	ocean_assert(source != nullptr && target != nullptr);
+	ocean_assert(width >= 1u && height >= 1u && channels >= 1u);
+	ocean_assert(sigma >= 0.5f);
+
+	if (source == nullptr || target == nullptr || width == 0u || height == 0u || channels == 0u || sigma < 0.5f)
+	{
+		return false;
+	}
+
+	const RecursiveCoefficients coefficients(sigma);
+
+	// floating point frames are filtered directly in the target frame, otherwise we need an intermediate floating point frame
+
+	Memory localIntermediateMemory;
+
+	float* intermediate = nullptr;
+	unsigned int intermediatePaddingElements = 0u;
+
+	if constexpr (std::is_same<T, float>::value)
+	{
+		intermediate = target;
+		intermediatePaddingElements = targetPaddingElements;
+	}
+	else
+	{
+		const size_t intermediateElements = size_t(width) * size_t(height) * size_t(channels);
+
+		Memory& intermediateMemory = reusableMemory != nullptr ? reusableMemory->recursiveIntermediateMemory_ : localIntermediateMemory;
+
+		if (intermediateMemory.size() < intermediateElements * sizeof(float))
+		{
+			intermediateMemory = Memory::create<float>(intermediateElements);
+		}
+
+		intermediate = intermediateMemory.data<float>();
+	}
+
+	ocean_assert(intermediate != nullptr);
+
+	if (worker != nullptr)
+	{
+		worker->executeFunction(Worker::Function::createStatic(&FrameFilterGaussian::filterRecursiveHorizontalSubset<T>, source, intermediate, width, channels, sourcePaddingElements, intermediatePaddingElements, (const RecursiveCoefficients*)(&coefficients), 0u, 0u), 0u, height, 7u, 8u, 8u);
+		worker->executeFunction(Worker::Function::createStatic(&FrameFilterGaussian::filterRecursiveVerticalSubset<T>, intermediate, target, width, height, channels, intermediatePaddingElements, targetPaddingElements, (const RecursiveCoefficients*)(&coefficients), 0u, 0u), 0u, width * channels, 8u, 9u, 64u);
+	}
+	else
+	{
+		filterRecursiveHorizontalSubset<T>(source, intermediate, width, channels, sourcePaddingElements, intermediatePaddingElements, &coefficients, 0u, height);
+		filterRecursiveVerticalSubset<T>(intermediate, target, width, height, channels, intermediatePaddingElements, targetPaddingElements, &coefficients, 0u, width * channels);
+	}
+
+	return true;
+}
+
+template bool OCEAN_CV_EXPORT FrameFilterGaussian::filterRecursive<uint8_t>(const uint8_t*, uint8_t*, const unsigned int, const unsigned int, const unsigned int, const unsigned int, const unsigned int, const float, Worker*, ReusableMemory*);
+template bool OCEAN_CV_EXPORT FrameFilterGaussian::filterRecursive<float>(const float*, float*, const unsigned int, const unsigned int, const unsigned int, const unsigned int, const unsigned int, const float, Worker*, ReusableMemory*);
+
+bool FrameFilterGaussian::filterFloat16(const Float16* source, Float16* target, const unsigned int width, const unsigned int height, const unsigned int channels, const unsigned int sourcePaddingElements, const unsigned int targetPaddingElements, const unsigned int horizontalFilterSize, const unsigned int verticalFilterSize, const float sigma, Worker* worker)
+{
+	static_assert(sizeof(Float16) == sizeof(uint16_t), "Invalid data type!");
+
+	ocean_assert(source != nullptr && target != nullptr);
+	ocean_assert(width >= horizontalFilterSize && height >= verticalFilterSize);
+	ocean_assert(channels >= 1u);
+
+	ocean_assert(horizontalFilterSize >= 1u && horizontalFilterSize % 2u == 1u);
+	ocean_assert(verticalFilterSize >= 1u && verticalFilterSize % 2u == 1u);
+	if (horizontalFilterSize == 0u || horizontalFilterSize % 2u != 1u || verticalFilterSize == 0u || verticalFilterSize % 2u != 1u)
+	{
+		return false;
+	}
+
+#if defined(OCEAN_CV_NEON_FP16)
+
+	if (CPUDispatch::hasLevel(CPUDispatch::IL_NEON))
+	{
+		std::vector<float> filterFactors(std::max(horizontalFilterSize, verticalFilterSize));
+
+		std::vector<Float16> horizontalFilter(horizontalFilterSize);
+		std::vector<Float16> verticalFilter(verticalFilterSize);
+
+		for (const bool horizontal : {true, false})
+		{
+			const unsigned int filterSize = horizontal ? horizontalFilterSize : verticalFilterSize;
+			Float16* const filter = horizontal ? horizontalFilter.data() : verticalFilter.data();
+
+			if (sigma <= 0.0f)
+			{
+				determineFilterFactors(filterSize, filterFactors.data());
+			}
+			else
+			{
+				determineFilterFactorsWithExplicitSigma(filterSize, sigma, filterFactors.data());
+			}
+
+			for (unsigned int n = 0u; n < filterSize; ++n)
+			{
+				filter[n] = Float16(filterFactors[n]);
+			}
+		}
+
+		// the intermediate frame is necessary as the vertical filter needs the horizontal results of neighboring rows, this also allows source == target
+
+		Memory intermediate = Memory::create<Float16>(size_t(width * channels) * size_t(height));
+
+		if (worker != nullptr)
+		{
+			worker->executeFunction(Worker::Function::createStatic(&filterFloat16HorizontalNEONSubset, source, intermediate.data<Float16>(), width, channels, sourcePaddingElements, (const Float16*)(horizontalFilter.data()), horizontalFilterSize, 0u, 0u), 0u, height);
+			worker->executeFunction(Worker::Function::createStatic(&filterFloat16VerticalNEONSubset, intermediate.constdata<Float16>(), target, width, height, channels, targetPaddingElements, (const Float16*)(verticalFilter.data()), verticalFilterSize, 0u, 0u), 0u, height);
+		}
+		else
+		{
+			filterFloat16HorizontalNEONSubset(source, intermediate.data<Float16>(), width, channels, sourcePaddingElements, horizontalFilter.data(), horizontalFilterSize, 0u, height);
+			filterFloat16VerticalNEONSubset(intermediate.constdata<Float16>(), target, width, height, channels, targetPaddingElements, verticalFilter.data(), verticalFilterSize, 0u, height);
+		}
+
+		return true;
+	}
+
+#endif // OCEAN_CV_NEON_FP16
+
+	// the processor does not support FP16 arithmetic, so we filter with 32-bit float precision
+
+	Memory floatFrame = Memory::create<float>(size_t(width * channels) * size_t(height));
+
+	FrameConverter::cast<Float16, float>(source, floatFrame.data<float>(), width, height, channels, sourcePaddingElements, 0u);
+
+	if (!filter<float, float>(floatFrame.data<float>(), width, height, channels, 0u, horizontalFilterSize, verticalFilterSize, sigma, worker))
+	{
+		return false;
+	}
+
+	FrameConverter::cast<float, Float16>(floatFrame.constdata<float>(), target, width, height, channels, 0u, targetPaddingElements);
+
+	return true;
+}
+
+FrameFilterGaussian::RecursiveCoefficients::RecursiveCoefficients(const float sigma)
+{
+	ocean_assert(sigma >= 0.5f);
+
+	// I.T. Young, L.J. van Vliet, M. van Ginkel: "Recursive Gabor filtering", 2002
+
+	const double sigmaD = double(std::max(sigma, 0.5f));
+
+	const double q = sigmaD >= 2.5 ? 0.98711 * sigmaD - 0.96330 : 3.97156 - 4.14554 * NumericD::sqrt(1.0 - 0.26891 * sigmaD);
+	ocean_assert(q > 0.0);
+
+	const double q2 = q * q;
+	const double q3 = q2 * q;
+
+	const double b0 = 1.57825 + 2.44413 * q + 1.4281 * q2 + 0.422205 * q3;
+	const double b1 = 2.44413 * q + 2.85619 * q2 + 1.26661 * q3;
+	const double b2 = -(1.4281 * q2 + 1.26661 * q3);
+	const double b3 = 0.422205 * q3;
+
+	const double feedback[3] = {b1 / b0, b2 / b0, b3 / b0};
+	const double normalization = 1.0 - (feedback[0] + feedback[1] + feedback[2]);
+
+	normalization_ = float(normalization);
+
+	for (unsigned int n = 0u; n < 3u; ++n)
+	{
+		feedback_[n] = float(feedback[n]);
+	}
+
+	/*
+	 * The backward filter needs the filter results beyond the end of the signal.
+	 * For replicated samples u beyond the end, the deviations y[N + k] - u depend linearly on the deviations w[N - 1 - i] - u of the forward filter (Triggs and Sdika).
+	 * We determine this linear mapping by filtering the impulse responses of all three forward states until they have decayed.
+	 */
+
+	const size_t decaySamples = size_t(NumericD::ceil(q * 30.0)) + 100;
+
+	std::vector<double> forwardResponse(decaySamples);
+
+	for (unsigned int i = 0u; i < 3u; ++i)
+	{
+		// the state of the forward filter: w[N - 1], w[N - 2], w[N - 3]
+		double state[3] = {0.0, 0.0, 0.0};
+		state[i] = 1.0;
+
+		for (size_t n = 0; n < decaySamples; ++n)
+		{
+			const double value = feedback[0] * state[0] + feedback[1] * state[1] + feedback[2] * state[2];
+
+			state[2] = state[1];
+			state[1] = state[0];
+			state[0] = value;
+
+			forwardResponse[n] = value;
+		}
+
+		double backward[3] = {0.0, 0.0, 0.0};
+
+		for (size_t n = decaySamples - 1; n < decaySamples; --n)
+		{
+			const double value = normalization * forwardResponse[n] + feedback[0] * backward[0] + feedback[1] * backward[1] + feedback[2] * backward[2];
+
+			backward[2] = backward[1];
+			backward[1] = backward[0];
+			backward[0] = value;
+		}
+
+		// backward[k] holds y[N + k]
+
+		for (unsigned int k = 0u; k < 3u; ++k)
+		{
+			boundary_[k * 3u + i] = float(backward[k]);
+		}
+	}
+}
+
+template <typename T>
+void FrameFilterGaussian::filterRecursiveHorizontalSubset(const T* source, float* intermediate, const unsigned int width, const unsigned int channels, const unsigned int sourcePaddingElements, const unsigned int intermediatePaddingElements, const RecursiveCoefficients* coefficients, const unsigned int firstRow, const unsigned int numberRows)
+{
+	ocean_assert(source != nullptr && intermediate != nullptr && coefficients != nullptr);
+	ocean_assert(width >= 1u && channels >= 1u && numberRows >= 1u);
+
+	// we filter several rows concurrently, the pixels of the rows are interleaved so that each row channel is one lane of the recursive filter
+
+	constexpr unsigned int maximalConcurrentRows = 8u;
+
+	const unsigned int sourceStrideElements = width * channels + sourcePaddingElements;
+	const unsigned int intermediateStrideElements = width * channels + intermediatePaddingElements;
+
+	const unsigned int maximalLanes = maximalConcurrentRows * channels;
+
+	Memory interleavedMemory = Memory::create<float>(size_t(width) * size_t(maximalLanes));
+	Memory bufferMemory = Memory::create<float>(maximalLanes * 4u);
+
+	float* const interleaved = interleavedMemory.data<float>();
+	float* const buffer = bufferMemory.data<float>();
+
+	for (unsigned int y = firstRow; y < firstRow + numberRows; y += maximalConcurrentRows)
+	{
+		const unsigned int concurrentRows = std::min(maximalConcurrentRows, firstRow + numberRows - y);
+		const unsigned int lanes = concurrentRows * channels;
+
+		for (unsigned int r = 0u; r < concurrentRows; ++r)
+		{
+			const T* sourceRow = source + (y + r) * sourceStrideElements;
+			float* interleavedPixel = interleaved + r * channels;
+
+			for (unsigned int x = 0u; x < width; ++x)
+			{
+				for (unsigned int c = 0u; c < channels; ++c)
+				{
+					interleavedPixel[c] = float(sourceRow[c]);
+				}
+
+				sourceRow += channels;
+				interleavedPixel += lanes;
+			}
+		}
+
+		filterRecursiveLanes(interleaved, width, lanes, lanes, *coefficients, buffer);
+
+		for (unsigned int r = 0u; r < concurrentRows; ++r)
+		{
+			float* intermediateRow = intermediate + (y + r) * intermediateStrideElements;
+			const float* interleavedPixel = interleaved + r * channels;
+
+			for (unsigned int x = 0u; x < width; ++x)
+			{
+				for (unsigned int c = 0u; c < channels; ++c)
+				{
+					intermediateRow[c] = interleavedPixel[c];
+				}
+
+				intermediateRow += channels;
+				interleavedPixel += lanes;
+			}
+		}
+	}
+}
+
+template <typename T>
+void FrameFilterGaussian::filterRecursiveVerticalSubset(float* intermediate, T* target, const unsigned int width, const unsigned int height, const unsigned int channels, const unsigned int intermediatePaddingElements, const unsigned int targetPaddingElements, const RecursiveCoefficients* coefficients, const unsigned int firstElement, const unsigned int numberElements)
+{
+	ocean_assert(intermediate != nullptr && target != nullptr && coefficients != nullptr);
+	ocean_assert(width >= 1u && height >= 1u && channels >= 1u);
+	ocean_assert(firstElement + numberElements <= width * channels);
+
+	const unsigned int intermediateStrideElements = width * channels + intermediatePaddingElements;
+
+	Memory bufferMemory = Memory::create<float>(numberElements * 4u);
+
+	// each row element is one lane of the recursive filter, successive samples are located in successive rows
+
+	filterRecursiveLanes(intermediate + firstElement, height, numberElements, intermediateStrideElements, *coefficients, bufferMemory.data<float>());
+
+	if constexpr (std::is_same<T, uint8_t>::value)
+	{
+		const unsigned int targetStrideElements = width * channels + targetPaddingElements;
+
+		for (unsigned int y = 0u; y < height; ++y)
+		{
+			const float* intermediateRow = intermediate + y * intermediateStrideElements + firstElement;
+			uint8_t* targetRow = target + y * targetStrideElements + firstElement;
+
+			for (unsigned int n = 0u; n < numberElements; ++n)
+			{
+				ocean_assert(intermediateRow[n] >= -0.5f && intermediateRow[n] < 256.0f);
+
+				targetRow[n] = uint8_t(minmax<int>(0, int(intermediateRow[n] + 0.5f), 255));
+			}
+		}
+	}
+	else
+	{
+		ocean_assert((void*)(intermediate) == (void*)(target));
+		ocean_assert_and_suppress_unused(intermediatePaddingElements == targetPaddingElements, targetPaddingElements);
+	}
+}
+
+void FrameFilterGaussian::filterRecursiveLanes(float* data, const unsigned int samples, const unsigned int lanes, const unsigned int sampleStrideElements, const RecursiveCoefficients& coefficients, float* buffer)
+{
+	ocean_assert(data != nullptr && buffer != nullptr);
+	ocean_assert(samples >= 1u && lanes >= 1u && lanes <= sampleStrideElements);
+
+	const auto sample = [data, sampleStrideElements](const int index) -> float*
+	{
+		// samples before the signal are replicated
+		return data + size_t(std::max(0, index)) * size_t(sampleStrideElements);
+	};
+
+	// the last (unfiltered) samples are replicated beyond the end of the signal, we need them for the initialization of the backward filter
+
+	float* const lastSamples = buffer;
+	memcpy(lastSamples, sample(int(samples) - 1), sizeof(float) * lanes);
+
+	// forward (causal) filter, the state before the signal is the steady state of the replicated first sample, so that w[0] == x[0]
+
+	for (int n = 1; n < int(samples); ++n)
+	{
+		filterRecursiveStep(sample(n), sample(n - 1), sample(n - 2), sample(n - 3), lanes, coefficients);
+	}
+
+	// initial state of the backward (anti-causal) filter: y[N + k] = u + sum_i M[k][i] * (w[N - 1 - i] - u)
+
+	float* const backwardState[3] = {buffer + lanes, buffer + lanes * 2u, buffer + lanes * 3u};
+
+	const float* const forwardLast[3] = {sample(int(samples) - 1), sample(int(samples) - 2), sample(int(samples) - 3)};
+
+	for (unsigned int l = 0u; l < lanes; ++l)
+	{
+		const float replicated = lastSamples[l];
+
+		const float delta0 = forwardLast[0][l] - replicated;
+		const float delta1 = forwardLast[1][l] - replicated;
+		const float delta2 = forwardLast[2][l] - replicated;
+
+		for (unsigned int k = 0u; k < 3u; ++k)
+		{
+			backwardState[k][l] = replicated + coefficients.boundary_[k * 3u + 0u] * delta0 + coefficients.boundary_[k * 3u + 1u] * delta1 + coefficients.boundary_[k * 3u + 2u] * delta2;
+		}
+	}
+
+	// backward (anti-causal) filter
+
+	for (int n = int(samples) - 1; n >= 0; --n)
+	{
+		const float* next0 = n + 1 < int(samples) ? sample(n + 1) : backwardState[n + 1 - int(samples)];
+		const float* next1 = n + 2 < int(samples) ? sample(n + 2) : backwardState[n + 2 - int(samples)];
+		const float* next2 = n + 3 < int(samples) ? sample(n + 3) : backwardState[n + 3 - int(samples)];
+
+		filterRecursiveStep(sample(n), next0, next1, next2, lanes, coefficients);
+	}
+}
+
+inline void FrameFilterGaussian::filterRecursiveStep(float* data, const float* previous0, const float* previous1, const float* previous2, const unsigned int lanes, const RecursiveCoefficients& coefficients)
+{
+	ocean_assert(data != nullptr && previous0 != nullptr && previous1 != nullptr && previous2 != nullptr);
+
+	unsigned int l = 0u;
+
+#if defined(OCEAN_HARDWARE_SSE_VERSION) && OCEAN_HARDWARE_SSE_VERSION >= 41
+
+	const __m128 normalization_32x4 = _mm_set1_ps(coefficients.normalization_);
+	const __m128 feedback0_32x4 = _mm_set1_ps(coefficients.feedback_[0]);
+	const __m128 feedback1_32x4 = _mm_set1_ps(coefficients.feedback_[1]);
+	const __m128 feedback2_32x4 = _mm_set1_ps(coefficients.feedback_[2]);
+
+	for (; l + 4u <= lanes; l += 4u)
+	{
+		// same order of operations as the scalar implementation, so that the result does not depend on the lane
+
+		__m128 result_32x4 = _mm_mul_ps(normalization_32x4, _mm_loadu_ps(data + l));
+
+		result_32x4 = _mm_add_ps(result_32x4, _mm_mul_ps(feedback0_32x4, _mm_loadu_ps(previous0 + l)));
+		result_32x4 = _mm_add_ps(result_32x4, _mm_mul_ps(feedback1_32x4, _mm_loadu_ps(previous1 + l)));
+		result_32x4 = _mm_add_ps(result_32x4, _mm_mul_ps(feedback2_32x4, _mm_loadu_ps(previous2 + l)));
+
+		_mm_storeu_ps(data + l, result_32x4);
+	}
+
+#elif defined(OCEAN_HARDWARE_NEON_VERSION) && OCEAN_HARDWARE_NEON_VERSION >= 10
+
+	const float32x4_t normalization_32x4 = vdupq_n_f32(coefficients.normalization_);
+
+	for (; l + 4u <= lanes; l += 4u)
+	{
+		float32x4_t result_32x4 = vmulq_f32(normalization_32x4, vld1q_f32(data + l));
+
+		result_32x4 = vmlaq_n_f32(result_32x4, vld1q_f32(previous0 + l), coefficients.feedback_[0]);
+		result_32x4 = vmlaq_n_f32(result_32x4, vld1q_f32(previous1 + l), coefficients.feedback_[1]);
+		result_32x4 = vmlaq_n_f32(result_32x4, vld1q_f32(previous2 + l), coefficients.feedback_[2]);
+
+		vst1q_f32(data + l, result_32x4);
+	}
+
+#endif
+
+	for (; l < lanes; ++l)
+	{
+		data[l] = coefficients.normalization_ * data[l] + coefficients.feedback_[0] * previous0[l] + coefficients.feedback_[1] * previous1[l] + coefficients.feedback_[2] * previous2[l];
+	}
+}
+
+#if defined(OCEAN_CV_NEON_FP16)
+
+void FrameFilterGaussian::filterFloat16HorizontalNEONSubset(const Float16* source, Float16* intermediate, const unsigned int width, const unsigned int channels, const unsigned int sourcePaddingElements, const Float16* filter, const unsigned int filterSize, const unsigned int firstRow, const unsigned int numberRows)
+{
+	ocean_assert(source != nullptr && intermediate != nullptr && filter != nullptr);
+	ocean_assert(width >= filterSize && filterSize % 2u == 1u);
+
+	const unsigned int filterSize_2 = filterSize / 2u;
+
+	const unsigned int rowElements = width * channels;
+	const unsigned int sourceStrideElements = rowElements + sourcePaddingElements;
+
+	// the extended row has filterSize_2 mirrored pixels at the left and at the right border
+
+	Memory extendedRowMemory = Memory::create<Float16>((width + filterSize_2 * 2u) * channels);
+	Float16* const extendedRow = extendedRowMemory.data<Float16>();
+
+	std::vector<const Float16*> taps(filterSize);
+
+	for (unsigned int n = 0u; n < filterSize; ++n)
+	{
+		taps[n] = extendedRow + n * channels;
+	}
+
+	for (unsigned int y = firstRow; y < firstRow + numberRows; ++y)
+	{
+		const Float16* const sourceRow = source + y * sourceStrideElements;
+
+		memcpy(extendedRow + filterSize_2 * channels, sourceRow, rowElements * sizeof(Float16));
+
+		for (unsigned int n = 1u; n <= filterSize_2; ++n)
+		{
+			memcpy(extendedRow + (filterSize_2 - n) * channels, sourceRow + CVUtilities::mirrorIndex(-int(n), width) * channels, channels * sizeof(Float16));
+			memcpy(extendedRow + (filterSize_2 + width + n - 1u) * channels, sourceRow + CVUtilities::mirrorIndex(int(width + n - 1u), width) * channels, channels * sizeof(Float16));
+		}
+
+		filterFloat16ElementsNEON(taps.data(), filter, filterSize, intermediate + y * rowElements, rowElements);
+	}
+}
+
+void FrameFilterGaussian::filterFloat16VerticalNEONSubset(const Float16* intermediate, Float16* target, const unsigned int width, const unsigned int height, const unsigned int channels, const unsigned int targetPaddingElements, const Float16* filter, const unsigned int filterSize, const unsigned int firstRow, const unsigned int numberRows)
+{
+	ocean_assert(intermediate != nullptr && target != nullptr && filter != nullptr);
+	ocean_assert(height >= filterSize && filterSize % 2u == 1u);
+
+	const int filterSize_2 = int(filterSize / 2u);
+
+	const unsigned int rowElements = width * channels;
+	const unsigned int targetStrideElements = rowElements + targetPaddingElements;
+
+	std::vector<const Float16*> taps(filterSize);
+
+	for (unsigned int y = firstRow; y < firstRow + numberRows; ++y)
+	{
+		for (unsigned int n = 0u; n < filterSize; ++n)
+		{
+			taps[n] = intermediate + CVUtilities::mirrorIndex(int(y + n) - filterSize_2, height) * rowElements;
+		}
+
+		filterFloat16ElementsNEON(taps.data(), filter, filterSize, target + y * targetStrideElements, rowElements);
+	}
+}
+
+void FrameFilterGaussian::filterFloat16ElementsNEON(const Float16* const* taps, const Float16* filter, const unsigned int filterSize, Float16* target, const unsigned int elements)
+{
+	ocean_assert(taps != nullptr && filter != nullptr && target != nullptr);
+	ocean_assert(filterSize >= 1u && elements >= 1u);
+
+	if (elements < 8u)
+	{
+		for (unsigned int n = 0u; n < elements; ++n)
+		{
+			float result = 0.0f;
+
+			for (unsigned int i = 0u; i < filterSize; ++i)
+			{
+				result += float(filter[i]) * float(taps[i][n]);
+			}
+
+			target[n] = Float16(result);
+		}
+
+		return;
+	}
+
+	for (unsigned int n = 0u; n < elements; n += 8u)
+	{
+		if (n + 8u > elements)
+		{
+			// the last iteration does not fit into the row, so we shift the block to the left and determine some elements again
+
+			ocean_assert(n >= 8u && elements > 8u);
+			n = elements - 8u;
+
+			// the for loop will stop after this iteration
+			ocean_assert(!(n + 8u < elements));
+		}
+
+		float16x8_t result_16x8 = vmulq_f16(vreinterpretq_f16_u16(vld1q_u16((const uint16_t*)(taps[0] + n))), vreinterpretq_f16_u16(vdupq_n_u16(filter[0].binary())));
+
+		for (unsigned int i = 1u; i < filterSize; ++i)
+		{
+			result_16x8 = vfmaq_f16(result_16x8, vreinterpretq_f16_u16(vld1q_u16((const uint16_t*)(taps[i] + n))), vreinterpretq_f16_u16(vdupq_n_u16(filter[i].binary())));
+		}
+
+		vst1q_u16((uint16_t*)(target + n), vreinterpretq_u16_f16(result_16x8));
+	}
+}
+
+#endif // OCEAN_CV_NEON_FP16
+
 }
 
 }
@@ -9,8 +9,10 @@
 #define META_OCEAN_CV_FRAME_FILTER_GAUSSIAN_H
 
 #include "ocean/cv/CV.h"
+#include "ocean/cv/CPUDispatch.h"
 #include "ocean/cv/FrameFilterSeparable.h"
 
+#include "ocean/base/DataType.h"
 #include "ocean/base/Frame.h"
 #include "ocean/base/Memory.h"
 #include "ocean/base/ScopedValue.h"
@@ -56,6 +58,52 @@ class OCEAN_CV_EXPORT FrameFilterGaussian
 
 				/// The reusable memory for several response rows.
 				Memory responseRowsMemory_;
+
+				/// The reusable memory for the intermediate floating point frame of the recursive filter.
+				Memory recursiveIntermediateMemory_;
+		};
+
+		/**
+		 * Definition of individual implementations of the Gaussian filter.
+		 */
+		enum FilterImplementation : uint32_t
+		{
+			/// The filter is applied with explicit (FIR) filter kernels, accurate but the cost grows linearly with the filter size.
+			FI_KERNEL = 0u,
+			/// The filter is applied recursively (IIR) based on Young and van Vliet, an approximation with constant cost per pixel, recommended for large sigmas.
+			FI_RECURSIVE
+		};
+
+	protected:
+
+		/**
+		 * This class holds the coefficients of a recursive (third order) Gaussian filter based on Young and van Vliet.
+		 * The filter is applied in forward and backward direction with:
+		 * <pre>
+		 * w[n] = normalization * x[n] + feedback[0] * w[n - 1] + feedback[1] * w[n - 2] + feedback[2] * w[n - 3]
+		 * y[n] = normalization * w[n] + feedback[0] * y[n + 1] + feedback[1] * y[n + 2] + feedback[2] * y[n + 3]
+		 * </pre>
+		 */
+		class OCEAN_CV_EXPORT RecursiveCoefficients
+		{
+			public:
+
+				/**
+				 * Creates the coefficients for a specified sigma.
+				 * @param sigma The sigma of the Gaussian, with range [0.5, infinity)
+				 */
+				explicit RecursiveCoefficients(const float sigma);
+
+			public:
+
+				/// The normalization factor applied to the input samples.
+				float normalization_ = 0.0f;
+
+				/// The three feedback coefficients applied to the previous output samples.
+				float feedback_[3] = {0.0f, 0.0f, 0.0f};
+
+				/// The 3x3 matrix (row major) determining the initial state of the backward filter for replicated samples at the end of the signal (Triggs and Sdika).
+				float boundary_[9] = {0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f};
 		};
 
 	public:
@@ -130,6 +178,42 @@ class OCEAN_CV_EXPORT FrameFilterGaussian
 		 */
 		static bool filter(Frame& frame, const unsigned int filterSize, Worker* worker = nullptr, ReusableMemory* reusableMemory = nullptr);
 
+		/**
+		 * Applies a Gaussian blur filter with explicit sigma to a given source image and copies the resulting filter results to a given output frame.
+		 * The caller can decide whether the filter is applied with explicit filter kernels (accurate) or recursively (with constant cost for any sigma).
+		 * If the target frame type does not match the source frame type the target frame type will be adjusted.
+		 * @param source The source frame to which the blur filter will be applied, must be valid
+		 * @param target The target frame receiving the blurred image content, will be set to the correct frame type if invalid or not matching
+		 * @param sigma The sigma of the Gaussian in pixel, with range [0.5, infinity), the kernel-based filter needs a kernel fitting into the frame, see sigma2filterSize()
+		 * @param implementation The implementation to be used
+		 * @param worker Optional worker object to distribute the computational load
+		 * @param reusableMemory An optional object holding reusable memory which can be used during filtering, nullptr otherwise
+		 * @return True, if succeeded
+		 * @see filterRecursive().
+		 */
+		static bool filter(const Frame& source, Frame& target, const float sigma, const FilterImplementation implementation, Worker* worker = nullptr, ReusableMemory* reusableMemory = nullptr);
+
+		/**
+		 * Applies a recursive (IIR) Gaussian blur filter to a given frame.
+		 * The filter applies the third order recursive approximation of Young and van Vliet in horizontal and vertical direction, the cost per pixel is independent of sigma.<br>
+		 * The frame border is handled by replicating the border pixels.<br>
+		 * The filter is an approximation of the Gaussian, for sigmas below 2 the deviation from the kernel-based filter is noticeable, for large sigmas the recursive filter is significantly faster.
+		 * @param source The source frame to be filtered, must be valid
+		 * @param target The target frame receiving the filtered results, can be the same memory pointer as 'source', must be valid
+		 * @param width The width of the source (and target) frame in pixel, with range [1, infinity)
+		 * @param height The height of the source (and target) frame in pixel, with range [1, infinity)
+		 * @param channels The number of channels the source frame (and target frame) has, with range [1, infinity)
+		 * @param sourcePaddingElements The number of padding elements at the end of each source row, in elements, with range [0, infinity)
+		 * @param targetPaddingElements The number of padding elements at the end of each target row, in elements, with range [0, infinity)
+		 * @param sigma The sigma of the Gaussian in pixel, with range [0.5, infinity)
+		 * @param worker Optional worker object to distribute the computation
+		 * @param reusableMemory An optional object holding reusable memory which can be used during filtering, nullptr otherwise
+		 * @return True, if succeeded
+		 * @tparam T The data type of each pixel channel of the source frame (and target frame), either 'uint8_t' or 'float'
+		 */
+		template <typename T>
+		static bool filterRecursive(const T* source, T* target, const unsigned int width, const unsigned int height, const unsigned int channels, const unsigned int sourcePaddingElements, const unsigned int targetPaddingElements, const float sigma, Worker* worker = nullptr, ReusableMemory* reusableMemory = nullptr);
+
 		/**
 		 * Applies a Gaussian blur filter to a given frame.
 		 * @param source The source frame to be filtered, must be valid
@@ -172,8 +256,72 @@ class OCEAN_CV_EXPORT FrameFilterGaussian
 		template <typename T, typename TFilter>
 		static inline bool filter(T* frame, const unsigned int width, const unsigned int height, const unsigned int channels, const unsigned int framePaddingElements, const unsigned int horizontalFilterSize, const unsigned int verticalFilterSize, const float sigma = -1.0f, Worker* worker = nullptr, ReusableMemory* reusableMemory = nullptr, const ProcessorInstructions processorInstructions = Processor::get().instructions());
 
+		/**
+		 * Applies a Gaussian blur filter to a given frame with 16-bit float elements.
+		 * On ARM processors supporting FP16 vector arithmetic (ARMv8.2-A) the filter is applied with NEON instructions handling eight elements at once, the filter results are accumulated with 16-bit float precision.<br>
+		 * Otherwise, the frame is converted to 32-bit float elements, filtered, and converted back.
+		 * @param source The source frame to be filtered, must be valid
+		 * @param target The target frame receiving the filtered results, can be the same memory pointer as 'source', must be valid
+		 * @param width The width of the source (and target) frame in pixel, with range [horizontalFilterSize, infinity)
+		 * @param height The height of the source (and target) frame in pixel, with range [verticalFilterSize, infinity)
+		 * @param channels The number of channels the source frame (and target frame) has, with range [1, infinity)
+		 * @param sourcePaddingElements The number of padding elements at the end of each source row, in elements, with range [0, infinity)
+		 * @param targetPaddingElements The number of padding elements at the end of each target row, in elements, with range [0, infinity)
+		 * @param horizontalFilterSize The number of elements the horizontal filter has, with range [1, width], must be odd
+		 * @param verticalFilterSize The number of elements the vertical filter has, with range [1, height], must be odd
+		 * @param sigma The Optional sigma that is applied explicitly, with range (0, infinity), -1 to calculate the sigma automatically based on the filter sizes
+		 * @param worker Optional worker object to distribute the computation
+		 * @return True, if succeeded
+		 */
+		static bool filterFloat16(const Float16* source, Float16* target, const unsigned int width, const unsigned int height, const unsigned int channels, const unsigned int sourcePaddingElements, const unsigned int targetPaddingElements, const unsigned int horizontalFilterSize, const unsigned int verticalFilterSize, const float sigma = -1.0f, Worker* worker = nullptr);
+
 	protected:
 
+#if defined(OCEAN_CV_NEON_FP16)
+
+		/**
+		 * Applies the horizontal filter to a subset of the rows of a frame with 16-bit float elements.
+		 * The frame border is handled by mirroring the border pixels.
+		 * @param source The source frame to be filtered, must be valid
+		 * @param intermediate The intermediate frame receiving the horizontal filter results, without padding elements, must be valid
+		 * @param width The width of the frame in pixel, with range [filterSize, infinity)
+		 * @param channels The number of frame channels, with range [1, infinity)
+		 * @param sourcePaddingElements The number of padding elements at the end of each source row, in elements, with range [0, infinity)
+		 * @param filter The normalized filter factors, must be valid
+		 * @param filterSize The number of filter factors, with range [1, width], must be odd
+		 * @param firstRow The first row to be handled, with range [0, height - 1]
+		 * @param numberRows The number of rows to be handled, with range [1, height - firstRow]
+		 */
+		static void filterFloat16HorizontalNEONSubset(const Float16* source, Float16* intermediate, const unsigned int width, const unsigned int channels, const unsigned int sourcePaddingElements, const Float16* filter, const unsigned int filterSize, const unsigned int firstRow, const unsigned int numberRows);
+
+		/**
+		 * Applies the vertical filter to a subset of the rows of a frame with 16-bit float elements.
+		 * The frame border is handled by mirroring the border pixels.
+		 * @param intermediate The intermediate frame holding the horizontal filter results, without padding elements, must be valid
+		 * @param target The target frame receiving the filter results, must be valid
+		 * @param width The width of the frame in pixel, with range [1, infinity)
+		 * @param height The height of the frame in pixel, with range [filterSize, infinity)
+		 * @param channels The number of frame channels, with range [1, infinity)
+		 * @param targetPaddingElements The number of padding elements at the end of each target row, in elements, with range [0, infinity)
+		 * @param filter The normalized filter factors, must be valid
+		 * @param filterSize The number of filter factors, with range [1, height], must be odd
+		 * @param firstRow The first row to be handled, with range [0, height - 1]
+		 * @param numberRows The number of rows to be handled, with range [1, height - firstRow]
+		 */
+		static void filterFloat16VerticalNEONSubset(const Float16* intermediate, Float16* target, const unsigned int width, const unsigned int height, const unsigned int channels, const unsigned int targetPaddingElements, const Float16* filter, const unsigned int filterSize, const unsigned int firstRow, const unsigned int numberRows);
+
+		/**
+		 * Applies a 1D filter to a row of 16-bit float elements, element i of the result is the weighted sum of element i of all filter taps.
+		 * @param taps The filter taps, one row for each filter factor, each with 'elements' elements, must be valid
+		 * @param filter The filter factors, must be valid
+		 * @param filterSize The number of filter factors, with range [1, infinity)
+		 * @param target The target row receiving the filter results, must not overlap with any tap, must be valid
+		 * @param elements The number of elements to be filtered, with range [1, infinity)
+		 */
+		static void filterFloat16ElementsNEON(const Float16* const* taps, const Float16* filter, const unsigned int filterSize, Float16* target, const unsigned int elements);
+
+#endif // OCEAN_CV_NEON_FP16
+
 #if defined(OCEAN_HARDWARE_NEON_VERSION) && OCEAN_HARDWARE_NEON_VERSION >= 10
 
 		/**
@@ -211,6 +359,63 @@ class OCEAN_CV_EXPORT FrameFilterGaussian
 		static inline void filter1Channel8Bit121SSE(const uint8_t* source, uint8_t* target, const unsigned int width, const unsigned int height, const unsigned int sourcePaddingElements, const unsigned int targetPaddingElements, ReusableMemory* reusableMemory);
 
 #endif // OCEAN_HARDWARE_SSE_VERSION >= 41
+
+		/**
+		 * Applies the horizontal recursive filter to a subset of the frame rows, several rows are filtered concurrently.
+		 * @param source The source frame to be filtered, must be valid
+		 * @param intermediate The intermediate frame receiving the horizontal filter results, can be the source frame if 'T' is 'float', must be valid
+		 * @param width The width of the frame in pixel, with range [1, infinity)
+		 * @param channels The number of frame channels, with range [1, infinity)
+		 * @param sourcePaddingElements The number of padding elements at the end of each source row, in elements, with range [0, infinity)
+		 * @param intermediatePaddingElements The number of padding elements at the end of each intermediate row, in elements, with range [0, infinity)
+		 * @param coefficients The coefficients of the recursive filter, must be valid
+		 * @param firstRow The first row to be handled, with range [0, height - 1]
+		 * @param numberRows The number of rows to be handled, with range [1, height - firstRow]
+		 * @tparam T The data type of each pixel channel of the source frame, either 'uint8_t' or 'float'
+		 */
+		template <typename T>
+		static void filterRecursiveHorizontalSubset(const T* source, float* intermediate, const unsigned int width, const unsigned int channels, const unsigned int sourcePaddingElements, const unsigned int intermediatePaddingElements, const RecursiveCoefficients* coefficients, const unsigned int firstRow, const unsigned int numberRows);
+
+		/**
+		 * Applies the vertical recursive filter (in place) to a subset of the frame columns and writes the final result into the target frame.
+		 * All columns of the subset are filtered concurrently.
+		 * @param intermediate The intermediate frame holding the horizontal filter results, will be modified, must be valid
+		 * @param target The target frame receiving the filter results, can be the intermediate frame if 'T' is 'float', must be valid
+		 * @param width The width of the frame in pixel, with range [1, infinity)
+		 * @param height The height of the frame in pixel, with range [1, infinity)
+		 * @param channels The number of frame channels, with range [1, infinity)
+		 * @param intermediatePaddingElements The number of padding elements at the end of each intermediate row, in elements, with range [0, infinity)
+		 * @param targetPaddingElements The number of padding elements at the end of each target row, in elements, with range [0, infinity)
+		 * @param coefficients The coefficients of the recursive filter, must be valid
+		 * @param firstElement The first row element (the column multiplied by the number of channels, plus the channel) to be handled, with range [0, width * channels - 1]
+		 * @param numberElements The number of row elements to be handled, with range [1, width * channels - firstElement]
+		 * @tparam T The data type of each pixel channel of the target frame, either 'uint8_t' or 'float'
+		 */
+		template <typename T>
+		static void filterRecursiveVerticalSubset(float* intermediate, T* target, const unsigned int width, const unsigned int height, const unsigned int channels, const unsigned int intermediatePaddingElements, const unsigned int targetPaddingElements, const RecursiveCoefficients* coefficients, const unsigned int firstElement, const unsigned int numberElements);
+
+		/**
+		 * Applies the recursive filter in forward and backward direction (in place) to several interleaved signals.
+		 * Sample n of signal l is located at data[n * sampleStrideElements + l].
+		 * @param data The interleaved signals to be filtered, must be valid
+		 * @param samples The number of samples of each signal, with range [1, infinity)
+		 * @param lanes The number of signals, with range [1, sampleStrideElements]
+		 * @param sampleStrideElements The number of elements between two successive samples of one signal, with range [lanes, infinity)
+		 * @param coefficients The coefficients of the recursive filter
+		 * @param buffer The buffer with (lanes * 4) elements which can be used during filtering, must be valid
+		 */
+		static void filterRecursiveLanes(float* data, const unsigned int samples, const unsigned int lanes, const unsigned int sampleStrideElements, const RecursiveCoefficients& coefficients, float* buffer);
+
+		/**
+		 * Applies one step of the recursive filter (in place) to several signals: data = normalization * data + feedback[0] * previous0 + feedback[1] * previous1 + feedback[2] * previous2.
+		 * @param data The current samples of the signals, will receive the filter results, must be valid
+		 * @param previous0 The previous filter results (the neighbor in filter direction), must be valid
+		 * @param previous1 The second previous filter results, must be valid
+		 * @param previous2 The third previous filter results, must be valid
+		 * @param lanes The number of signals, with range [1, infinity)
+		 * @param coefficients The coefficients of the recursive filter
+		 */
+		static inline void filterRecursiveStep(float* data, const float* previous0, const float* previous1, const float* previous2, const unsigned int lanes, const RecursiveCoefficients& coefficients);
 };
 
 template <typename T>
@@ -10,6 +10,8 @@
 
 #include "ocean/cv/CV.h"
 #include "ocean/cv/FrameFilterSorted.h"
+#include "ocean/cv/NEON.h"
+#include "ocean/cv/SSE.h"
 
 #include "ocean/base/Frame.h"
 #include "ocean/base/Median.h"
@@ -63,8 +65,15 @@ class OCEAN_CV_EXPORT FrameFilterMedian : protected FrameFilterSorted
 
 	public:
 
+		/**
+		 * The minimal filter size for which 8 bit frames are filtered with the constant-time median filter, smaller filters use the sliding histogram.
+		 * @see filterConstantTime().
+		 */
+		static constexpr unsigned int constantTimeMinimalFilterSize_ = 5u;
+
 		/**
 		 * Filters a frame with a median filter with arbitrary size (a square patch).
+		 * 8 bit frames with up to 4 channels and filter sizes of at least constantTimeMinimalFilterSize_ are filtered with filterConstantTime().
 		 * @param source The source image to be filtered, must be valid
 		 * @param target The target frame with same size and pixel format receiving the filtered result, must be valid
 		 * @param width The width of the input frame in pixel, with range [filterSize / 2, infinity)
@@ -93,8 +102,74 @@ class OCEAN_CV_EXPORT FrameFilterMedian : protected FrameFilterSorted
 		template <typename T, unsigned int tChannels>
 		static void filter(T* frame, const unsigned int width, const unsigned int height, const unsigned int framePaddingElements, const unsigned int filterSize, Worker* worker = nullptr);
 
+		/**
+		 * Filters an 8 bit frame with a median filter with arbitrary size (a square patch) with constant computational cost per pixel independent of the filter size.
+		 * The implementation follows Perreault and Hebert, "Median Filtering in Constant Time": one histogram is maintained for each column, and the kernel histogram is moved along the row by adding and subtracting entire column histograms.<br>
+		 * Each histogram is composed of 16 coarse bins and 256 fine bins so that the median is determined with two short scans.<br>
+		 * Pixels outside the frame are not used (the filter window is clamped at the frame border), the result is identical to filter().
+		 * @param source The source image to be filtered, must be valid
+		 * @param target The target frame with same size and pixel format receiving the filtered result, must be valid
+		 * @param width The width of the input frame in pixel, with range [filterSize / 2, infinity)
+		 * @param height The height of the input frame in pixel, with range [filterSize / 2, infinity)
+		 * @param sourcePaddingElements The number of padding elements at the end of each source row, in elements, with range [0, infinity)
+		 * @param targetPaddingElements The number of padding elements at the end of each target row, in elements, with range [0, infinity)
+		 * @param filterSize Size of the filter edge in pixel, must be odd with range [3, 255]
+		 * @param worker Optional worker object to distribute the computation
+		 * @tparam tChannels Number of data channels, with range [1, 4]
+		 */
+		template <unsigned int tChannels>
+		static void filterConstantTime(const uint8_t* source, uint8_t* target, const unsigned int width, const unsigned int height, const unsigned int sourcePaddingElements, const unsigned int targetPaddingElements, const unsigned int filterSize, Worker* worker = nullptr);
+
 	protected:
 
+		/**
+		 * Filters a subset of an 8 bit frame with the constant-time median filter.
+		 * @param source The source image to be filtered, must be valid
+		 * @param target The target frame with same size and pixel format receiving the filtered result, must be valid
+		 * @param width The width of the input frame in pixel, with range [filterSize / 2, infinity)
+		 * @param height The height of the input frame in pixel, with range [filterSize / 2, infinity)
+		 * @param sourcePaddingElements The number of padding elements at the end of each source row, in elements, with range [0, infinity)
+		 * @param targetPaddingElements The number of padding elements at the end of each target row, in elements, with range [0, infinity)
+		 * @param filterSize Size of the filter edge in pixel, must be odd with range [3, 255]
+		 * @param firstRow First row to be handled, with range [0, height - 1]
+		 * @param numberRows Number of rows to be handled, with range [1, height - firstRow]
+		 * @tparam tChannels Number of data channels, with range [1, 4]
+		 * @see filterConstantTime().
+		 */
+		template <unsigned int tChannels>
+		static void filterConstantTimeSubset(const uint8_t* source, uint8_t* target, const unsigned int width, const unsigned int height, const unsigned int sourcePaddingElements, const unsigned int targetPaddingElements, const unsigned int filterSize, const unsigned int firstRow, const unsigned int numberRows);
+
+		/**
+		 * Adds one row of a frame to the column histograms or removes the row from the column histograms.
+		 * @param sourceRow The row of the frame, must be valid
+		 * @param columnHistograms The column histograms, one for each column and channel, each with 16 coarse bins followed by 256 fine bins, must be valid
+		 * @param width The width of the frame in pixel, with range [1, infinity)
+		 * @tparam tChannels Number of data channels, with range [1, 4]
+		 * @tparam tAdd True, to add the row; False, to remove the row
+		 */
+		template <unsigned int tChannels, bool tAdd>
+		static inline void updateColumnHistograms(const uint8_t* sourceRow, uint16_t* columnHistograms, const unsigned int width);
+
+		/**
+		 * Adds one column histogram to and/or subtracts one column histogram from a kernel histogram and applies SIMD instructions.
+		 * @param addHistogram The histogram to be added, must be valid if 'tAdd == true'
+		 * @param subtractHistogram The histogram to be subtracted, must be valid if 'tSubtract == true'
+		 * @param kernelHistogram The kernel histogram to be updated, must be valid
+		 * @param elements The number of bins of all histograms, with range [8, infinity), must be a multiple of 8
+		 * @tparam tAdd True, to add 'addHistogram'
+		 * @tparam tSubtract True, to subtract 'subtractHistogram'
+		 */
+		template <bool tAdd, bool tSubtract>
+		static inline void updateKernelHistogram(const uint16_t* addHistogram, const uint16_t* subtractHistogram, uint16_t* kernelHistogram, const unsigned int elements);
+
+		/**
+		 * Returns the median value of a histogram with 16 coarse bins followed by 256 fine bins.
+		 * @param histogram The histogram, must be valid
+		 * @param medianIndex The index of the median value within the sorted histogram values, with range [0, values - 1]
+		 * @return The median value
+		 */
+		static inline uint8_t constantTimeMedianValue(const uint16_t* histogram, unsigned int medianIndex);
+
 		/**
 		 * Filters a subset of an integer frame with a median filter with arbitrary size.
 		 * @param source The source image to be filtered, must be valid
@@ -158,6 +233,15 @@ void FrameFilterMedian::filter(const T* source, T* target, const unsigned int wi
 		ocean_assert(sizeof(T) != sizeof(uint8_t) || histogramElements == 256);
 		ocean_assert(sizeof(T) != sizeof(uint16_t) || histogramElements == 65536);
 
+		if constexpr (std::is_same<T, uint8_t>::value && tChannels <= 4u)
+		{
+			if (filterSize >= constantTimeMinimalFilterSize_ && filterSize <= 255u)
+			{
+				filterConstantTime<tChannels>(source, target, width, height, sourcePaddingElements, targetPaddingElements, filterSize, worker);
+				return;
+			}
+		}
+
 		using Histogram = HistogramInteger<T, uint16_t, histogramElements>;
 
 		if (worker)
@@ -202,6 +286,26 @@ void FrameFilterMedian::filter(T* frame, const unsigned int width, const unsigne
 	}
 }
 
+template <unsigned int tChannels>
+void FrameFilterMedian::filterConstantTime(const uint8_t* source, uint8_t* target, const unsigned int width, const unsigned int height, const unsigned int sourcePaddingElements, const unsigned int targetPaddingElements, const unsigned int filterSize, Worker* worker)
+{
+	static_assert(tChannels >= 1u && tChannels <= 4u, "Invalid channel number!");
+
+	ocean_assert(source != nullptr && target != nullptr && source != target);
+	ocean_assert(filterSize >= 3u && filterSize <= 255u && filterSize % 2u == 1u);
+	ocean_assert(filterSize / 2u <= width && filterSize / 2u <= height);
+
+	if (worker)
+	{
+		// each subset needs to initialize the column histograms with filterSize rows, so that the subsets should not be too small
+		worker->executeFunction(Worker::Function::createStatic(&filterConstantTimeSubset<tChannels>, source, target, width, height, sourcePaddingElements, targetPaddingElements, filterSize, 0u, 0u), 0u, height, 7u, 8u, std::max(20u, filterSize * 2u));
+	}
+	else
+	{
+		filterConstantTimeSubset<tChannels>(source, target, width, height, sourcePaddingElements, targetPaddingElements, filterSize, 0u, height);
+	}
+}
+
 template <typename T, unsigned int tChannels, typename THistogram>
 void FrameFilterMedian::filterIntegerSubset(const T* source, T* target, const unsigned int width, const unsigned int height, const unsigned int sourcePaddingElements, const unsigned int targetPaddingElements, const unsigned int filterSize, const unsigned int firstRow, const unsigned int numberRows)
 {
@@ -347,6 +451,231 @@ void FrameFilterMedian::filterIntegerSubset(const T* source, T* target, const un
 	}
 }
 
+template <unsigned int tChannels>
+void FrameFilterMedian::filterConstantTimeSubset(const uint8_t* source, uint8_t* target, const unsigned int width, const unsigned int height, const unsigned int sourcePaddingElements, const unsigned int targetPaddingElements, const unsigned int filterSize, const unsigned int firstRow, const unsigned int numberRows)
+{
+	static_assert(tChannels >= 1u && tChannels <= 4u, "Invalid channel number!");
+
+	ocean_assert(source != nullptr && target != nullptr);
+	ocean_assert(filterSize >= 3u && filterSize <= 255u && filterSize % 2u == 1u);
+
+	const unsigned int filterSize_2 = filterSize / 2u;
+	ocean_assert(filterSize_2 <= width && filterSize_2 <= height);
+
+	ocean_assert(firstRow + numberRows <= height);
+	const unsigned int endRow = firstRow + numberRows;
+
+	const unsigned int sourceStrideElements = width * tChannels + sourcePaddingElements;
+	const unsigned int targetStrideElements = width * tChannels + targetPaddingElements;
+
+	// each histogram is composed of 16 coarse bins followed by 256 fine bins
+	constexpr unsigned int histogramBins = 16u + 256u;
+	constexpr unsigned int pixelHistogramBins = histogramBins * tChannels;
+
+	Memory columnHistogramsMemory = Memory::create<uint16_t>(size_t(width) * size_t(pixelHistogramBins));
+	uint16_t* const columnHistograms = columnHistogramsMemory.data<uint16_t>();
+	memset(columnHistograms, 0, size_t(width) * size_t(pixelHistogramBins) * sizeof(uint16_t));
+
+	alignas(16) uint16_t kernelHistogram[pixelHistogramBins];
+
+	// the column histograms of the first row of this subset
+
+	for (unsigned int y = firstRow - std::min(firstRow, filterSize_2); y <= std::min(firstRow + filterSize_2, height - 1u); ++y)
+	{
+		updateColumnHistograms<tChannels, true>(source + y * sourceStrideElements, columnHistograms, width);
+	}
+
+	for (unsigned int y = firstRow; y < endRow; ++y)
+	{
+		if (y != firstRow)
+		{
+			// vertical update of the column histograms
+
+			if (y > filterSize_2)
+			{
+				updateColumnHistograms<tChannels, false>(source + (y - filterSize_2 - 1u) * sourceStrideElements, columnHistograms, width);
+			}
+
+			if (y + filterSize_2 < height)
+			{
+				updateColumnHistograms<tChannels, true>(source + (y + filterSize_2) * sourceStrideElements, columnHistograms, width);
+			}
+		}
+
+		const unsigned int windowRows = std::min(y + filterSize_2, height - 1u) - (y - std::min(y, filterSize_2)) + 1u;
+
+		memset(kernelHistogram, 0, sizeof(kernelHistogram));
+
+		for (unsigned int x = 0u; x <= std::min(filterSize_2, width - 1u); ++x)
+		{
+			updateKernelHistogram<true, false>(columnHistograms + x * pixelHistogramBins, nullptr, kernelHistogram, pixelHistogramBins);
+		}
+
+		uint8_t* targetRow = target + y * targetStrideElements;
+
+		for (unsigned int x = 0u; x < width; ++x)
+		{
+			const unsigned int windowColumns = std::min(x + filterSize_2, width - 1u) - (x - std::min(x, filterSize_2)) + 1u;
+
+			// -1 in case the window holds an even number of elements (at the frame border)
+			const unsigned int medianIndex = (windowRows * windowColumns - 1u) / 2u;
+
+			for (unsigned int n = 0u; n < tChannels; ++n)
+			{
+				*targetRow++ = constantTimeMedianValue(kernelHistogram + n * histogramBins, medianIndex);
+			}
+
+			if (x + 1u < width)
+			{
+				// horizontal update of the kernel histogram
+
+				const bool subtractLeft = x >= filterSize_2;
+				const bool addRight = x + filterSize_2 + 1u < width;
+
+				if (subtractLeft && addRight)
+				{
+					updateKernelHistogram<true, true>(columnHistograms + (x + filterSize_2 + 1u) * pixelHistogramBins, columnHistograms + (x - filterSize_2) * pixelHistogramBins, kernelHistogram, pixelHistogramBins);
+				}
+				else if (subtractLeft)
+				{
+					updateKernelHistogram<false, true>(nullptr, columnHistograms + (x - filterSize_2) * pixelHistogramBins, kernelHistogram, pixelHistogramBins);
+				}
+				else if (addRight)
+				{
+					updateKernelHistogram<true, false>(columnHistograms + (x + filterSize_2 + 1u) * pixelHistogramBins, nullptr, kernelHistogram, pixelHistogramBins);
+				}
+			}
+		}
+	}
+}
+
+template <unsigned int tChannels, bool tAdd>
+inline void FrameFilterMedian::updateColumnHistograms(const uint8_t* sourceRow, uint16_t* columnHistograms, const unsigned int width)
+{
+	static_assert(tChannels >= 1u && tChannels <= 4u, "Invalid channel number!");
+
+	ocean_assert(sourceRow != nullptr && columnHistograms != nullptr);
+
+	constexpr unsigned int histogramBins = 16u + 256u;
+
+	for (unsigned int x = 0u; x < width * tChannels; ++x)
+	{
+		const uint8_t value = sourceRow[x];
+
+		uint16_t* const histogram = columnHistograms + x * histogramBins;
+
+		if constexpr (tAdd)
+		{
+			++histogram[value >> 4u];
+			++histogram[16u + value];
+		}
+		else
+		{
+			ocean_assert(histogram[value >> 4u] != 0u && histogram[16u + value] != 0u);
+
+			--histogram[value >> 4u];
+			--histogram[16u + value];
+		}
+	}
+}
+
+template <bool tAdd, bool tSubtract>
+inline void FrameFilterMedian::updateKernelHistogram(const uint16_t* addHistogram, const uint16_t* subtractHistogram, uint16_t* kernelHistogram, const unsigned int elements)
+{
+	static_assert(tAdd || tSubtract, "Invalid update!");
+
+	ocean_assert(!tAdd || addHistogram != nullptr);
+	ocean_assert(!tSubtract || subtractHistogram != nullptr);
+	ocean_assert(kernelHistogram != nullptr);
+	ocean_assert(elements >= 8u && elements % 8u == 0u);
+
+#if defined(OCEAN_HARDWARE_SSE_VERSION) && OCEAN_HARDWARE_SSE_VERSION >= 20
+
+	for (unsigned int n = 0u; n < elements; n += 8u)
+	{
+		__m128i kernel_u_16x8 = _mm_loadu_si128((const __m128i*)(kernelHistogram + n));
+
+		if constexpr (tAdd)
+		{
+			kernel_u_16x8 = _mm_add_epi16(kernel_u_16x8, _mm_loadu_si128((const __m128i*)(addHistogram + n)));
+		}
+
+		if constexpr (tSubtract)
+		{
+			kernel_u_16x8 = _mm_sub_epi16(kernel_u_16x8, _mm_loadu_si128((const __m128i*)(subtractHistogram + n)));
+		}
+
+		_mm_storeu_si128((__m128i*)(kernelHistogram + n), kernel_u_16x8);
+	}
+
+#elif defined(OCEAN_HARDWARE_NEON_VERSION) && OCEAN_HARDWARE_NEON_VERSION >= 10
+
+	for (unsigned int n = 0u; n < elements; n += 8u)
+	{
+		uint16x8_t kernel_u_16x8 = vld1q_u16(kernelHistogram + n);
+
+		if constexpr (tAdd)
+		{
+			kernel_u_16x8 = vaddq_u16(kernel_u_16x8, vld1q_u16(addHistogram + n));
+		}
+
+		if constexpr (tSubtract)
+		{
+			kernel_u_16x8 = vsubq_u16(kernel_u_16x8, vld1q_u16(subtractHistogram + n));
+		}
+
+		vst1q_u16(kernelHistogram + n, kernel_u_16x8);
+	}
+
+#else
+
+	for (unsigned int n = 0u; n < elements; ++n)
+	{
+		if constexpr (tAdd)
+		{
+			kernelHistogram[n] = uint16_t(kernelHistogram[n] + addHistogram[n]);
+		}
+
+		if constexpr (tSubtract)
+		{
+			kernelHistogram[n] = uint16_t(kernelHistogram[n] - subtractHistogram[n]);
+		}
+	}
+
+#endif
+}
+
+inline uint8_t FrameFilterMedian::constantTimeMedianValue(const uint16_t* histogram, unsigned int medianIndex)
+{
+	ocean_assert(histogram != nullptr);
+
+	const uint16_t* const coarseBins = histogram;
+
+	unsigned int coarseBin = 0u;
+
+	while (coarseBins[coarseBin] <= medianIndex)
+	{
+		medianIndex -= coarseBins[coarseBin];
+
+		++coarseBin;
+		ocean_assert(coarseBin < 16u);
+	}
+
+	const uint16_t* const fineBins = histogram + 16u + coarseBin * 16u;
+
+	unsigned int fineBin = 0u;
+
+	while (fineBins[fineBin] <= medianIndex)
+	{
+		medianIndex -= fineBins[fineBin];
+
+		++fineBin;
+		ocean_assert(fineBin < 16u);
+	}
+
+	return uint8_t(coarseBin * 16u + fineBin);
+}
+
 #if 0 // keeping code for demonstration purpose
 
 template <typename T, unsigned int tChannels>
@@ -8,6 +8,8 @@
 #include "ocean/cv/FrameFilterMorphology.h"
 #include "ocean/cv/FrameFilterErosion.h"
 #include "ocean/cv/FrameFilterDilation.h"
+#include "ocean/cv/FrameFilterMax.h"
+#include "ocean/cv/FrameFilterMin.h"
 
 #include "ocean/base/Frame.h"
 
@@ -67,6 +69,81 @@ void FrameFilterMorphology::closeMask(uint8_t* mask, const unsigned int width, c
 template OCEAN_CV_EXPORT void FrameFilterMorphology::closeMask<FrameFilterMorphology::MF_SQUARE_3>(uint8_t*, const unsigned int, const unsigned int, const unsigned int maskPaddingElements, const uint8_t maskValue, Worker* worker);
 template OCEAN_CV_EXPORT void FrameFilterMorphology::closeMask<FrameFilterMorphology::MF_SQUARE_5>(uint8_t*, const unsigned int, const unsigned int, const unsigned int maskPaddingElements, const uint8_t maskValue, Worker* worker);
 
+
+void FrameFilterMorphology::openMask(uint8_t* mask, const unsigned int width, const unsigned int height, const unsigned int maskPaddingElements, const uint8_t maskValue, const unsigned int filterSize, Worker* worker)
+{
+	ocean_assert(mask != nullptr && width >= 1u && height >= 1u);
+	ocean_assert(filterSize >= 1u && filterSize % 2u == 1u);
+
+	Frame intermediateFrame(FrameType(width, height, FrameType::FORMAT_Y8, FrameType::ORIGIN_UPPER_LEFT));
+
+	filter1Channel8BitSquare<true>(mask, intermediateFrame.data<uint8_t>(), width, height, filterSize, maskValue, maskPaddingElements, intermediateFrame.paddingElements(), worker);
+	filter1Channel8BitSquare<false>(intermediateFrame.constdata<uint8_t>(), mask, width, height, filterSize, maskValue, intermediateFrame.paddingElements(), maskPaddingElements, worker);
+}
+
+void FrameFilterMorphology::closeMask(uint8_t* mask, const unsigned int width, const unsigned int height, const unsigned int maskPaddingElements, const uint8_t maskValue, const unsigned int filterSize, Worker* worker)
+{
+	ocean_assert(mask != nullptr && width >= 1u && height >= 1u);
+	ocean_assert(filterSize >= 1u && filterSize % 2u == 1u);
+
+	Frame intermediateFrame(FrameType(width, height, FrameType::FORMAT_Y8, FrameType::ORIGIN_UPPER_LEFT));
+
+	filter1Channel8BitSquare<false>(mask, intermediateFrame.data<uint8_t>(), width, height, filterSize, maskValue, maskPaddingElements, intermediateFrame.paddingElements(), worker);
+	filter1Channel8BitSquare<true>(intermediateFrame.constdata<uint8_t>(), mask, width, height, filterSize, maskValue, intermediateFrame.paddingElements(), maskPaddingElements, worker);
+}
+
+template <bool tErosion>
+void FrameFilterMorphology::filter1Channel8BitSquare(const uint8_t* mask, uint8_t* target, const unsigned int width, const unsigned int height, const unsigned int filterSize, const uint8_t maskValue, const unsigned int maskPaddingElements, const unsigned int targetPaddingElements, Worker* worker)
+{
+	ocean_assert(mask != nullptr && target != nullptr);
+	ocean_assert(width >= 1u && height >= 1u);
+	ocean_assert(filterSize >= 1u && filterSize % 2u == 1u);
+
+	// the mask is converted to a binary frame with 0xFF for mask pixels and 0x00 for non-mask pixels,
+	// so that an erosion is a min filter and a dilation is a max filter
+
+	Frame binaryFrame(FrameType(width, height, FrameType::FORMAT_Y8, FrameType::ORIGIN_UPPER_LEFT));
+
+	const unsigned int maskStrideElements = width + maskPaddingElements;
+	const unsigned int targetStrideElements = width + targetPaddingElements;
+
+	for (unsigned int y = 0u; y < height; ++y)
+	{
+		const uint8_t* const maskRow = mask + y * maskStrideElements;
+		uint8_t* const binaryRow = binaryFrame.row<uint8_t>(y);
+
+		for (unsigned int x = 0u; x < width; ++x)
+		{
+			binaryRow[x] = maskRow[x] == maskValue ? 0xFFu : 0x00u;
+		}
+	}
+
+	if constexpr (tErosion)
+	{
+		FrameFilterMin::filter<uint8_t, 1u>(binaryFrame.constdata<uint8_t>(), target, width, height, binaryFrame.paddingElements(), targetPaddingElements, filterSize, worker);
+	}
+	else
+	{
+		FrameFilterMax::filter<uint8_t, 1u>(binaryFrame.constdata<uint8_t>(), target, width, height, binaryFrame.paddingElements(), targetPaddingElements, filterSize, worker);
+	}
+
+	const uint8_t nonMaskValue = 0xFFu - maskValue;
+
+	for (unsigned int y = 0u; y < height; ++y)
+	{
+		uint8_t* const targetRow = target + y * targetStrideElements;
+
+		for (unsigned int x = 0u; x < width; ++x)
+		{
+			targetRow[x] = targetRow[x] != 0x00u ? maskValue : nonMaskValue;
+		}
+	}
+}
+
+// We force the compilation of the following template-based functions to ensure that they exist when needed/linked
+template OCEAN_CV_EXPORT void FrameFilterMorphology::filter1Channel8BitSquare<true>(const uint8_t*, uint8_t*, const unsigned int, const unsigned int, const unsigned int, const uint8_t, const unsigned int, const unsigned int, Worker*);
+template OCEAN_CV_EXPORT void FrameFilterMorphology::filter1Channel8BitSquare<false>(const uint8_t*, uint8_t*, const unsigned int, const unsigned int, const unsigned int, const uint8_t, const unsigned int, const unsigned int, Worker*);
+
 }
 
 }
@@ -68,6 +68,57 @@ class OCEAN_CV_EXPORT FrameFilterMorphology
 		 */
 		template <MorphologyFilter tFilter>
 		static void closeMask(uint8_t* mask, const unsigned int width, const unsigned int height, const unsigned int maskPaddingElements, const uint8_t maskValue, Worker* worker = nullptr);
+
+		/**
+		 * Applies an erosion and dilation filter with arbitrary square kernel to the given mask to remove small mask elements.
+		 * The computational cost per pixel is independent of the kernel size.
+		 * @param mask 8 bit binary Mask to be opened by erosion and dilation, must be valid
+		 * @param width The width of the mask in pixel, with range [1, infinity)
+		 * @param height The height of the mask in pixel, with range [1, infinity)
+		 * @param maskPaddingElements The number of padding elements at the end of each mask row, in elements, with range [0, infinity)
+		 * @param maskValue The value of a mask pixel, with range [0, 255]
+		 * @param filterSize The size of the square kernel edge in pixel, must be odd, with range [1, infinity)
+		 * @param worker Optional worker object to distribute the computation
+		 */
+		static void openMask(uint8_t* mask, const unsigned int width, const unsigned int height, const unsigned int maskPaddingElements, const uint8_t maskValue, const unsigned int filterSize, Worker* worker = nullptr);
+
+		/**
+		 * Applies a dilation and erosion filter with arbitrary square kernel to the given mask to close small gaps between mask pixels.
+		 * The computational cost per pixel is independent of the kernel size.
+		 * @param mask 8 bit binary Mask to be closed by dilation and erosion, must be valid
+		 * @param width The width of the mask in pixel, with range [1, infinity)
+		 * @param height The height of the mask in pixel, with range [1, infinity)
+		 * @param maskPaddingElements The number of padding elements at the end of each mask row, in elements, with range [0, infinity)
+		 * @param maskValue The value of a mask pixel, with range [0, 255]
+		 * @param filterSize The size of the square kernel edge in pixel, must be odd, with range [1, infinity)
+		 * @param worker Optional worker object to distribute the computation
+		 */
+		static void closeMask(uint8_t* mask, const unsigned int width, const unsigned int height, const unsigned int maskPaddingElements, const uint8_t maskValue, const unsigned int filterSize, Worker* worker = nullptr);
+
+	protected:
+
+		/**
+		 * The minimal size of a square kernel for which iterated square filters are replaced by one filter with arbitrary square kernel.
+		 */
+		static constexpr unsigned int squareMinimalFilterSize_ = 9u;
+
+		/**
+		 * Applies one erosion or dilation filter with arbitrary square kernel to an 8 bit mask image.
+		 * The mask is converted to a binary image which is filtered with a separable min or max filter (van Herk/Gil-Werman) needing about three comparisons per pixel and direction independent of the kernel size.<br>
+		 * Pixels outside the frame are not used, the filter response is identical to iterated 3x3 or 5x5 filters with the corresponding overall size.
+		 * @param mask The mask frame to be filtered, must be valid
+		 * @param target The target frame receiving the filter response, may be identical to 'mask', must be valid
+		 * @param width The width of the mask frame in pixel, with range [1, infinity)
+		 * @param height The height of the mask frame in pixel, with range [1, infinity)
+		 * @param filterSize The size of the square kernel edge in pixel, must be odd, with range [1, infinity)
+		 * @param maskValue The value of a mask pixel, the target receives 'maskValue' or '255 - maskValue', with range [0, 255]
+		 * @param maskPaddingElements The number of padding elements at the end of each mask row, in elements, with range [0, infinity)
+		 * @param targetPaddingElements The number of padding elements at the end of each target row, in elements, with range [0, infinity)
+		 * @param worker Optional worker object to distribute the computation
+		 * @tparam tErosion True, to apply an erosion filter; False, to apply a dilation filter
+		 */
+		template <bool tErosion>
+		static void filter1Channel8BitSquare(const uint8_t* mask, uint8_t* target, const unsigned int width, const unsigned int height, const unsigned int filterSize, const uint8_t maskValue, const unsigned int maskPaddingElements, const unsigned int targetPaddingElements, Worker* worker);
 };
 
 }
@@ -62,6 +62,25 @@ class OCEAN_CV_EXPORT FrameFilterSeparable
 				std::vector<float> normalizedVerticalFilter_;
 		};
 
+		/**
+		 * Definition of individual execution modes of the separable filter.
+		 */
+		enum ExecutionMode : uint32_t
+		{
+			/// The execution mode is selected automatically based on the size of the intermediate filter responses.
+			EM_AUTOMATIC = 0u,
+			/// The entire frame is filtered horizontally into an intermediate frame before the vertical filter is applied.
+			EM_FULL_FRAME,
+			/// The frame is filtered in bands of rows, each band applies the horizontal and vertical filter via a small window of intermediate rows fitting into the L2 cache.
+			EM_TILED
+		};
+
+		/// The number of bytes of the window of intermediate rows which is used during tiled execution, chosen to fit into a typical L2 cache.
+		static constexpr unsigned int tiledWindowBytes_ = 256u * 1024u;
+
+		/// The minimal number of bytes of the intermediate filter responses for which EM_AUTOMATIC selects tiled execution.
+		static constexpr size_t tiledMinimalIntermediateBytes_ = 2u * 1024u * 1024u;
+
 	protected:
 
 		/**
@@ -95,6 +114,33 @@ class OCEAN_CV_EXPORT FrameFilterSeparable
 		template <typename T>
 		static T sumFilterValues(const T* filterValues, const size_t size);
 
+		/**
+		 * Returns the number of intermediate rows of the window which is used during tiled execution.
+		 * The window covers tiledWindowBytes_ but has at least twice as many rows as the vertical filter.
+		 * @param width The width of the frame in pixel, with range [1, infinity)
+		 * @param channels The number of intermediate channels per pixel, with range [1, infinity)
+		 * @param verticalFilterSize The number of elements the vertical filter has, with range [1, infinity), must be odd
+		 * @return The number of rows of the window, with range [verticalFilterSize * 2, infinity)
+		 * @tparam TIntermediate The data type of each intermediate filter response, e.g., 'unsigned int', or 'float'
+		 */
+		template <typename TIntermediate>
+		static inline unsigned int tiledWindowRows(const unsigned int width, const unsigned int channels, const unsigned int verticalFilterSize);
+
+		/**
+		 * Returns whether tiled execution will be applied for a given execution mode and frame.
+		 * Tiled execution is never applied for in-place filtering, as neighboring bands would read rows which have been filtered already.
+		 * @param executionMode The requested execution mode
+		 * @param source The source frame to be filtered, must be valid
+		 * @param target The target frame receiving the filtered results, must be valid
+		 * @param width The width of the frame in pixel, with range [1, infinity)
+		 * @param height The height of the frame in pixel, with range [1, infinity)
+		 * @param channels The number of intermediate channels per pixel, with range [1, infinity)
+		 * @return True, if tiled execution will be applied
+		 * @tparam TIntermediate The data type of each intermediate filter response, e.g., 'unsigned int', or 'float'
+		 */
+		template <typename TIntermediate>
+		static inline bool useTiledExecution(const ExecutionMode executionMode, const void* source, const void* target, const unsigned int width, const unsigned int height, const unsigned int channels);
+
 		/**
 		 * Applies a horizontal and vertical filtering with a (separable) 2D filter kernel separated into a horizontal 1D filter and a vertical 1D filter for frames with zipped pixel format.
 		 * The filter result is stored in a target frame with zipped pixel format.
@@ -159,12 +205,13 @@ class OCEAN_CV_EXPORT FrameFilterSeparable
 		 * @param worker Optional worker object to distribute the computation
 		 * @param reusableMemory An optional object holding reusable memory which can be used during filtering, nullptr otherwise
 		 * @param processorInstructions The set of available instructions, may be any combination of instructions
+		 * @param executionMode The execution mode to be used, tiled execution avoids the intermediate frame and is not applied for in-place filtering
 		 * @tparam T The data type of each pixel channel of the source frame (and target frame) e.g., 'uint8_t', or 'float'
 		 * @tparam TFilter The data type of each filter elements e.g., 'unsigned int', or 'float'
 		 * @see filterUniversal<T>()
 		 */
 		template <typename T, typename TFilter>
-		static bool filter(const T* source, T* target, const unsigned int width, const unsigned int height, const unsigned int channels, const unsigned int sourcePaddingElements, const unsigned int targetPaddingElements, const TFilter* horizontalFilter, const unsigned int horizontalFilterSize, const TFilter* verticalFilter, const unsigned int verticalFilterSize, Worker* worker = nullptr, ReusableMemory* reusableMemory = nullptr, const ProcessorInstructions processorInstructions = Processor::get().instructions());
+		static bool filter(const T* source, T* target, const unsigned int width, const unsigned int height, const unsigned int channels, const unsigned int sourcePaddingElements, const unsigned int targetPaddingElements, const TFilter* horizontalFilter, const unsigned int horizontalFilterSize, const TFilter* verticalFilter, const unsigned int verticalFilterSize, Worker* worker = nullptr, ReusableMemory* reusableMemory = nullptr, const ProcessorInstructions processorInstructions = Processor::get().instructions(), const ExecutionMode executionMode = EM_AUTOMATIC);
 
 		/**
 		 * Applies a horizontal and vertical filtering with a (separable) 2D filter kernel separated into a horizontal 1D filter and a vertical 1D filter for frames with almost arbitrary pixel format.
@@ -241,13 +288,40 @@ class OCEAN_CV_EXPORT FrameFilterSeparable
 		 * @param verticalFilterSize The number of elements the vertical filter has, with range [1, height], must be odd
 		 * @param reusableMemory An optional object holding reusable memory which can be used during filtering, nullptr otherwise
 		 * @param worker Optional worker object to distribute the computation
+		 * @param executionMode The execution mode to be used
 		 * @tparam T The data type of each pixel channel of the source frame (and target frame) e.g., 'uint8_t', or 'float'
 		 * @tparam TFilter The data type of each filter elements e.g., 'unsigned int', or 'float'
 		 * @tparam tProcessorInstructions The processor instructions that can be used
 		 * @see filterUniversal<T>()
 		 */
 		template <typename T, typename TFilter, ProcessorInstructions tProcessorInstructions>
-		static void filter(const T* source, T* target, const unsigned int width, const unsigned int height, const unsigned int channels, const unsigned int sourcePaddingElements, const unsigned int targetPaddingElements, const TFilter* horizontalFilter, const unsigned int horizontalFilterSize, const TFilter* verticalFilter, const unsigned int verticalFilterSize, ReusableMemory* reusableMemory = nullptr, Worker* worker = nullptr);
+		static void filter(const T* source, T* target, const unsigned int width, const unsigned int height, const unsigned int channels, const unsigned int sourcePaddingElements, const unsigned int targetPaddingElements, const TFilter* horizontalFilter, const unsigned int horizontalFilterSize, const TFilter* verticalFilter, const unsigned int verticalFilterSize, ReusableMemory* reusableMemory = nullptr, Worker* worker = nullptr, const ExecutionMode executionMode = EM_AUTOMATIC);
+
+		/**
+		 * Applies the horizontal and the vertical filtering for a band of rows while holding only a small window of horizontally filtered rows.
+		 * The window is filled with the horizontal responses of the rows which are needed by the next block of target rows, rows outside of the frame are mirrored at the frame border.<br>
+		 * The last rows of a block are moved to the beginning of the window as they are needed by the next block again.
+		 * @param source The source frame to be filtered, must be valid
+		 * @param target The target frame receiving the filtered results, must not be identical with 'source', must be valid
+		 * @param width The width of the source (and target) frame in pixel, with range [max(horizontalFilterSize + 1, 16 / channels), infinity)
+		 * @param height The height of the source (and target) frame in pixel, with range [verticalFilterSize, infinity)
+		 * @param channels The number of channels the source frame (and target frame) has, with range [1, 8]
+		 * @param sourcePaddingElements The number of padding elements at the end of each source row, in elements, with range [0, infinity)
+		 * @param targetPaddingElements The number of padding elements at the end of each target row, in elements, with range [0, infinity)
+		 * @param horizontalFilter The elements of the horizontal filter, must be valid
+		 * @param horizontalFilterSize The number of elements the horizontal filter has, with range [1, width - 1], must be odd
+		 * @param verticalFilter The normalized floating point elements of the vertical filter, must be valid
+		 * @param verticalFilterSize The number of elements the vertical filter has, with range [1, height], must be odd
+		 * @param windowRows The number of intermediate rows the window can hold, with range [verticalFilterSize, infinity)
+		 * @param firstRow The first row to be handled, with range [0, height)
+		 * @param numberRows The number of rows to be handled, with range [1, height - firstRow]
+		 * @tparam T The data type of each pixel channel of the source frame (and target frame) e.g., 'uint8_t', or 'float'
+		 * @tparam TFilter The data type of each horizontal filter element e.g., 'unsigned int', or 'float'
+		 * @tparam tProcessorInstructions The processor instructions that can be used
+		 * @see tiledWindowRows().
+		 */
+		template <typename T, typename TFilter, ProcessorInstructions tProcessorInstructions>
+		static void filterTiledSubset(const T* source, T* target, const unsigned int width, const unsigned int height, const unsigned int channels, const unsigned int sourcePaddingElements, const unsigned int targetPaddingElements, const TFilter* horizontalFilter, const unsigned int horizontalFilterSize, const float* verticalFilter, const unsigned int verticalFilterSize, const unsigned int windowRows, const unsigned int firstRow, const unsigned int numberRows);
 
 		/**
 		 * Sets a given SIMD value to zero.
@@ -718,6 +792,35 @@ T FrameFilterSeparable::sumFilterValues(const T* filterValues, const size_t size
 	return sum;
 }
 
+template <typename TIntermediate>
+inline unsigned int FrameFilterSeparable::tiledWindowRows(const unsigned int width, const unsigned int channels, const unsigned int verticalFilterSize)
+{
+	ocean_assert(width >= 1u && channels >= 1u);
+	ocean_assert(verticalFilterSize >= 1u && verticalFilterSize % 2u == 1u);
+
+	const unsigned int rowBytes = width * channels * (unsigned int)(sizeof(TIntermediate));
+
+	return std::max(tiledWindowBytes_ / rowBytes, verticalFilterSize * 2u);
+}
+
+template <typename TIntermediate>
+inline bool FrameFilterSeparable::useTiledExecution(const ExecutionMode executionMode, const void* source, const void* target, const unsigned int width, const unsigned int height, const unsigned int channels)
+{
+	if (source == target || executionMode == EM_FULL_FRAME)
+	{
+		return false;
+	}
+
+	if (executionMode == EM_TILED)
+	{
+		return true;
+	}
+
+	ocean_assert(executionMode == EM_AUTOMATIC);
+
+	return size_t(width) * size_t(height) * size_t(channels) * sizeof(TIntermediate) >= tiledMinimalIntermediateBytes_;
+}
+
 #if defined(OCEAN_HARDWARE_SSE_VERSION) && OCEAN_HARDWARE_SSE_VERSION >= 20
 
 template <>
@@ -3448,31 +3551,104 @@ void FrameFilterSeparable::filterVerticalSubset(const TSource* source, TTarget*
 }
 
 template <typename T, typename TFilter, ProcessorInstructions tProcessorInstructions>
-inline void FrameFilterSeparable::filter(const T* source, T* target, const unsigned int width, const unsigned int height, const unsigned int channels, const unsigned int sourcePaddingElements, const unsigned int targetPaddingElements, const TFilter* horizontalFilter, const unsigned int horizontalFilterSize, const TFilter* verticalFilter, const unsigned int verticalFilterSize, ReusableMemory* reusableMemory, Worker* worker)
+void FrameFilterSeparable::filterTiledSubset(const T* source, T* target, const unsigned int width, const unsigned int height, const unsigned int channels, const unsigned int sourcePaddingElements, const unsigned int targetPaddingElements, const TFilter* horizontalFilter, const unsigned int horizontalFilterSize, const float* verticalFilter, const unsigned int verticalFilterSize, const unsigned int windowRows, const unsigned int firstRow, const unsigned int numberRows)
 {
-	Frame localIntermediateFrame;
-	Frame* intermediateFrame = &localIntermediateFrame;
+	ocean_assert(source != nullptr && target != nullptr);
+	ocean_assert((const void*)(source) != (const void*)(target));
+	ocean_assert(horizontalFilter != nullptr && verticalFilter != nullptr);
 
-	if (reusableMemory != nullptr)
-	{
-		intermediateFrame = &reusableMemory->intermediateFrame_;
-	}
+	ocean_assert(verticalFilterSize >= 1u && (verticalFilterSize % 2u) == 1u);
+	ocean_assert(height >= verticalFilterSize);
+	ocean_assert(firstRow + numberRows <= height);
 
-	intermediateFrame->set(FrameType(width, height, FrameType::genericPixelFormat<TFilter>(channels), FrameType::ORIGIN_UPPER_LEFT), false /*forceOwner*/, true /*forceWritable*/);
+	const unsigned int filterSize_2 = verticalFilterSize / 2u;
+	ocean_assert(windowRows > filterSize_2 * 2u);
 
-	// first we apply the horizontal filtering
+	const unsigned int rowElements = width * channels;
 
-	if (worker)
-	{
-		worker->executeFunction(Worker::Function::createStatic(&filterHorizontalSubset<T, TFilter, tProcessorInstructions>, source, intermediateFrame->data<TFilter>(), width, height, channels, horizontalFilter, horizontalFilterSize, sourcePaddingElements, intermediateFrame->paddingElements(), 0u, 0u), 0u, height);
-	}
-	else
+	const unsigned int sourceStrideElements = rowElements + sourcePaddingElements;
+	const unsigned int targetStrideElements = rowElements + targetPaddingElements;
+
+	const bool isSymmetric = isFilterSymmetric(verticalFilter, verticalFilterSize);
+
+	// the window holds the horizontal responses of consecutive (virtual) rows without padding, 'windowFirstRow' is the row located at the beginning of the window
+	// virtual rows outside the frame are mirrored at the frame border, so that all target rows can be determined with the core filter
+
+	Memory windowMemory = Memory::create<TFilter>(size_t(windowRows) * size_t(rowElements));
+	TFilter* const window = windowMemory.data<TFilter>();
+	ocean_assert(window != nullptr);
+
+	int windowFirstRow = int(firstRow) - int(filterSize_2);
+	int windowEndRow = windowFirstRow;
+
+	target += firstRow * targetStrideElements;
+
+	unsigned int row = firstRow;
+
+	while (row < firstRow + numberRows)
 	{
-		filterHorizontalSubset<T, TFilter, tProcessorInstructions>(source, intermediateFrame->data<TFilter>(), width, height, channels, horizontalFilter, horizontalFilterSize, sourcePaddingElements, intermediateFrame->paddingElements(), 0u, height);
+		const unsigned int blockRows = std::min(windowRows - filterSize_2 * 2u, firstRow + numberRows - row);
+
+		// the block of target rows needs the horizontal responses of the virtual rows [row - filterSize_2, row + blockRows + filterSize_2)
+
+		const int neededFirstRow = int(row) - int(filterSize_2);
+		const int neededEndRow = int(row + blockRows + filterSize_2);
+
+		ocean_assert(neededFirstRow >= windowFirstRow);
+		const unsigned int keptRows = (unsigned int)(std::max(0, windowEndRow - neededFirstRow));
+
+		if (keptRows != 0u && neededFirstRow != windowFirstRow)
+		{
+			// the last rows of the previous block are needed again, so we move them to the beginning of the window
+			memmove(window, window + size_t(neededFirstRow - windowFirstRow) * size_t(rowElements), size_t(keptRows) * size_t(rowElements) * sizeof(TFilter));
+		}
+
+		windowFirstRow = neededFirstRow;
+
+		int virtualRow = neededFirstRow + int(keptRows);
+
+		while (virtualRow < neededEndRow)
+		{
+			TFilter* const windowRow = window + size_t(virtualRow - windowFirstRow) * size_t(rowElements);
+
+			if (virtualRow >= 0 && virtualRow < int(height))
+			{
+				// all consecutive rows inside the frame are filtered at once
+
+				const unsigned int rows = (unsigned int)(std::min(neededEndRow, int(height)) - virtualRow);
+
+				filterHorizontalSubset<T, TFilter, tProcessorInstructions>(source + size_t(virtualRow) * size_t(sourceStrideElements), windowRow, width, rows, channels, horizontalFilter, horizontalFilterSize, sourcePaddingElements, 0u /*targetPaddingElements*/, 0u, rows);
+
+				virtualRow += int(rows);
+			}
+			else
+			{
+				const unsigned int mirroredRow = virtualRow < 0 ? mirroredBorderLocationLeft(virtualRow) : mirroredBorderLocationRight((unsigned int)(virtualRow), height);
+				ocean_assert(mirroredRow < height);
+
+				filterHorizontalSubset<T, TFilter, tProcessorInstructions>(source + size_t(mirroredRow) * size_t(sourceStrideElements), windowRow, width, 1u, channels, horizontalFilter, horizontalFilterSize, sourcePaddingElements, 0u /*targetPaddingElements*/, 0u, 1u);
+
+				++virtualRow;
+			}
+		}
+
+		windowEndRow = neededEndRow;
+
+		for (unsigned int n = 0u; n < blockRows; ++n)
+		{
+			filterVerticalCoreRow32BitPerChannelFloat<TFilter, T, tProcessorInstructions>(window + size_t(n + filterSize_2) * size_t(rowElements), target, width, channels, verticalFilter, verticalFilterSize, isSymmetric, 0u /*sourcePaddingElements*/);
+
+			target += targetStrideElements;
+		}
+
+		row += blockRows;
 	}
+}
 
-	// now we apply the vertical filtering
-	// therefore, we first need to calculate the floating point filter functions (in case we use integer factors)
+template <typename T, typename TFilter, ProcessorInstructions tProcessorInstructions>
+inline void FrameFilterSeparable::filter(const T* source, T* target, const unsigned int width, const unsigned int height, const unsigned int channels, const unsigned int sourcePaddingElements, const unsigned int targetPaddingElements, const TFilter* horizontalFilter, const unsigned int horizontalFilterSize, const TFilter* verticalFilter, const unsigned int verticalFilterSize, ReusableMemory* reusableMemory, Worker* worker, const ExecutionMode executionMode)
+{
+	// the vertical filtering is applied with floating point filter factors (which are normalized in case we use integer factors)
 
 	std::vector<float> localFloatFilters;
 	const float* verticalFloatFilter = nullptr;
@@ -3505,6 +3681,47 @@ inline void FrameFilterSeparable::filter(const T* source, T* target, const unsig
 		verticalFloatFilter = floatFilterBufferToUse.data();
 	}
 
+	if (useTiledExecution<TFilter>(executionMode, source, target, width, height, channels))
+	{
+		// each band of rows is filtered horizontally and vertically while only a small window of intermediate rows needs to be held in the cache
+
+		const unsigned int windowRows = tiledWindowRows<TFilter>(width, channels, verticalFilterSize);
+
+		if (worker)
+		{
+			worker->executeFunction(Worker::Function::createStatic(&filterTiledSubset<T, TFilter, tProcessorInstructions>, source, target, width, height, channels, sourcePaddingElements, targetPaddingElements, horizontalFilter, horizontalFilterSize, verticalFloatFilter, verticalFilterSize, windowRows, 0u, 0u), 0u, height, 12u, 13u, windowRows);
+		}
+		else
+		{
+			filterTiledSubset<T, TFilter, tProcessorInstructions>(source, target, width, height, channels, sourcePaddingElements, targetPaddingElements, horizontalFilter, horizontalFilterSize, verticalFloatFilter, verticalFilterSize, windowRows, 0u, height);
+		}
+
+		return;
+	}
+
+	Frame localIntermediateFrame;
+	Frame* intermediateFrame = &localIntermediateFrame;
+
+	if (reusableMemory != nullptr)
+	{
+		intermediateFrame = &reusableMemory->intermediateFrame_;
+	}
+
+	intermediateFrame->set(FrameType(width, height, FrameType::genericPixelFormat<TFilter>(channels), FrameType::ORIGIN_UPPER_LEFT), false /*forceOwner*/, true /*forceWritable*/);
+
+	// first we apply the horizontal filtering
+
+	if (worker)
+	{
+		worker->executeFunction(Worker::Function::createStatic(&filterHorizontalSubset<T, TFilter, tProcessorInstructions>, source, intermediateFrame->data<TFilter>(), width, height, channels, horizontalFilter, horizontalFilterSize, sourcePaddingElements, intermediateFrame->paddingElements(), 0u, 0u), 0u, height);
+	}
+	else
+	{
+		filterHorizontalSubset<T, TFilter, tProcessorInstructions>(source, intermediateFrame->data<TFilter>(), width, height, channels, horizontalFilter, horizontalFilterSize, sourcePaddingElements, intermediateFrame->paddingElements(), 0u, height);
+	}
+
+	// now we apply the vertical filtering
+
 	if (worker)
 	{
 		worker->executeFunction(Worker::Function::createStatic(&filterVerticalSubset<TFilter, T, tProcessorInstructions>, intermediateFrame->constdata<TFilter>(), target, width, height, channels, (const float*)(verticalFloatFilter), verticalFilterSize, intermediateFrame->paddingElements(), targetPaddingElements, 0u, 0u), 0u, height);
@@ -3516,7 +3733,7 @@ inline void FrameFilterSeparable::filter(const T* source, T* target, const unsig
 }
 
 template <typename T, typename TFilter>
-bool FrameFilterSeparable::filter(const T* source, T* target, const unsigned int width, const unsigned int height, const unsigned int channels, const unsigned int sourcePaddingElements, const unsigned int targetPaddingElements, const TFilter* horizontalFilter, const unsigned int horizontalFilterSize, const TFilter* verticalFilter, const unsigned int verticalFilterSize, Worker* worker, ReusableMemory* reusableMemory, const ProcessorInstructions processorInstructions)
+bool FrameFilterSeparable::filter(const T* source, T* target, const unsigned int width, const unsigned int height, const unsigned int channels, const unsigned int sourcePaddingElements, const unsigned int targetPaddingElements, const TFilter* horizontalFilter, const unsigned int horizontalFilterSize, const TFilter* verticalFilter, const unsigned int verticalFilterSize, Worker* worker, ReusableMemory* reusableMemory, const ProcessorInstructions processorInstructions, const ExecutionMode executionMode)
 {
 	ocean_assert(source != nullptr && target != nullptr);
 	ocean_assert(width >= horizontalFilterSize && height >= verticalFilterSize);
@@ -3528,6 +3745,7 @@ bool FrameFilterSeparable::filter(const T* source, T* target, const unsigned int
 	}
 
 	OCEAN_SUPPRESS_UNUSED_WARNING(reusableMemory);
+	OCEAN_SUPPRESS_UNUSED_WARNING(executionMode);
 
 	if (width * channels >= 16u && width >= horizontalFilterSize + 1u)
 	{
@@ -3545,11 +3763,11 @@ bool FrameFilterSeparable::filter(const T* source, T* target, const unsigned int
 			case PI_GROUP_SSE_4_1:
 			case PI_GROUP_AVX_2_SSE_2:
 			case PI_GROUP_SSE_2:
-				OCEAN_APPLY_IF_SSE((filter<T, TFilter, PI_SSE_2>(source, target, width, height, channels, sourcePaddingElements, targetPaddingElements, horizontalFilter, horizontalFilterSize, verticalFilter, verticalFilterSize, reusableMemory, worker)));
+				OCEAN_APPLY_IF_SSE((filter<T, TFilter, PI_SSE_2>(source, target, width, height, channels, sourcePaddingElements, targetPaddingElements, horizontalFilter, horizontalFilterSize, verticalFilter, verticalFilterSize, reusableMemory, worker, executionMode)));
 				return true;
 
 			case PI_GROUP_NEON:
-				OCEAN_APPLY_IF_NEON((filter<T, TFilter, PI_GROUP_NEON>(source, target, width, height, channels, sourcePaddingElements, targetPaddingElements, horizontalFilter, horizontalFilterSize, verticalFilter, verticalFilterSize, reusableMemory, worker)));
+				OCEAN_APPLY_IF_NEON((filter<T, TFilter, PI_GROUP_NEON>(source, target, width, height, channels, sourcePaddingElements, targetPaddingElements, horizontalFilter, horizontalFilterSize, verticalFilter, verticalFilterSize, reusableMemory, worker, executionMode)));
 				return true;
 
 			case PI_NONE:
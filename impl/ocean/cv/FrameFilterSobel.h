@@ -233,8 +233,6 @@ class OCEAN_CV_EXPORT FrameFilterSobel : public FrameFilter
 		 */
 		static void filterHorizontalVertical3Squared1Channel8BitRow(const uint8_t* row, const unsigned int width, const unsigned int elements, const unsigned int paddingElements, int16_t* responsesXX, int16_t* responsesYY, int16_t* responsesXY);
 
-	private:
-
 		/**
 		 * Applies the horizontal and vertical Sobel filter to one row of a source frame.
 		 * @param sourceRow The row of the source frame, must be valid
@@ -252,6 +250,8 @@ class OCEAN_CV_EXPORT FrameFilterSobel : public FrameFilter
 		template <typename TSource, typename TTarget, unsigned int tSourceChannels, unsigned int tTargetChannels>
 		static void filterHorizontalVerticalRow(const TSource* sourceRow, TTarget* targetRow, const unsigned int width, const unsigned int height, unsigned int rowIndex, const unsigned int sourceStrideElements, const unsigned int targetStrideElements);
 
+	private:
+
 		/**
 		 * Applies the diagonal (45 and 135 degree) Sobel filter to one row of a source frame.
 		 * @param sourceRow The row of the source frame, must be valid
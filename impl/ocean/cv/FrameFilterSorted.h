@@ -9,6 +9,8 @@
 #define META_OCEAN_CV_FRAME_FILTER_SORTED_H
 
 #include "ocean/cv/CV.h"
+#include "ocean/cv/NEON.h"
+#include "ocean/cv/SSE.h"
 
 #include "ocean/base/Frame.h"
 #include "ocean/base/Median.h"
@@ -195,6 +197,82 @@ class OCEAN_CV_EXPORT FrameFilterSorted
 		 * @return The clamped offset: min(index + upperOffset, size - 1)
 		 */
 		static inline unsigned int clampUpper(const unsigned int index, const unsigned int upperOffset, const unsigned int size);
+
+		/**
+		 * Filters a frame with a min or max filter with arbitrary size (a square patch) based on the algorithm of van Herk and Gil-Werman.
+		 * The separable filter needs about three comparisons per pixel and direction independent of the filter size.<br>
+		 * The frame is processed in blocks of 'filterSize' rows (and columns): for each block, suffix extrema are determined from the block's center towards the block's start, and prefix extrema from the block's center towards the block's end.<br>
+		 * Pixels outside the frame are not used (the filter window is clamped at the frame border).
+		 * @param source The source frame to be filtered, must be valid
+		 * @param target The target frame with same size and pixel format receiving the filtered result, must be valid
+		 * @param width The width of the frame in pixel, with range [1, infinity)
+		 * @param height The height of the frame in pixel, with range [1, infinity)
+		 * @param sourcePaddingElements The number of padding elements at the end of each source row, in elements, with range [0, infinity)
+		 * @param targetPaddingElements The number of padding elements at the end of each target row, in elements, with range [0, infinity)
+		 * @param filterSize Size of the filter edge in pixel, must be odd with range [1, infinity)
+		 * @param worker Optional worker object to distribute the computation
+		 * @tparam T Data type of the data elements
+		 * @tparam tChannels Number of data channels, with range [1, infinity)
+		 * @tparam tMinimum True, to apply a min filter; False, to apply a max filter
+		 */
+		template <typename T, unsigned int tChannels, bool tMinimum>
+		static void filterVanHerkGilWerman(const T* source, T* target, const unsigned int width, const unsigned int height, const unsigned int sourcePaddingElements, const unsigned int targetPaddingElements, const unsigned int filterSize, Worker* worker);
+
+		/**
+		 * Filters a subset of a frame with a min or max filter based on the algorithm of van Herk and Gil-Werman.
+		 * @param source The source frame to be filtered, must be valid
+		 * @param target The target frame with same size and pixel format receiving the filtered result, must be valid
+		 * @param width The width of the frame in pixel, with range [1, infinity)
+		 * @param height The height of the frame in pixel, with range [1, infinity)
+		 * @param sourcePaddingElements The number of padding elements at the end of each source row, in elements, with range [0, infinity)
+		 * @param targetPaddingElements The number of padding elements at the end of each target row, in elements, with range [0, infinity)
+		 * @param filterSize Size of the filter edge in pixel, must be odd with range [1, infinity)
+		 * @param firstRow First row to be handled, with range [0, height - 1]
+		 * @param numberRows Number of rows to be handled, with range [1, height - firstRow]
+		 * @tparam T Data type of the data elements
+		 * @tparam tChannels Number of data channels, with range [1, infinity)
+		 * @tparam tMinimum True, to apply a min filter; False, to apply a max filter
+		 * @see filterVanHerkGilWerman().
+		 */
+		template <typename T, unsigned int tChannels, bool tMinimum>
+		static void filterVanHerkGilWermanSubset(const T* source, T* target, const unsigned int width, const unsigned int height, const unsigned int sourcePaddingElements, const unsigned int targetPaddingElements, const unsigned int filterSize, const unsigned int firstRow, const unsigned int numberRows);
+
+		/**
+		 * Applies the horizontal van Herk/Gil-Werman min or max filter to one row.
+		 * @param sourceRow The source row to be filtered, must be valid
+		 * @param targetRow The target row receiving the filtered row, must be valid
+		 * @param width The width of the row in pixel, with range [1, infinity)
+		 * @param filterSize Size of the filter in pixel, must be odd with range [1, infinity)
+		 * @param suffixBuffer The buffer receiving the suffix extrema of one block, with 'filterSize * tChannels' elements, must be valid
+		 * @tparam T Data type of the data elements
+		 * @tparam tChannels Number of data channels, with range [1, infinity)
+		 * @tparam tMinimum True, to apply a min filter; False, to apply a max filter
+		 */
+		template <typename T, unsigned int tChannels, bool tMinimum>
+		static void filterVanHerkGilWermanRow(const T* sourceRow, T* targetRow, const unsigned int width, const unsigned int filterSize, T* suffixBuffer);
+
+		/**
+		 * Determines the element-wise minimum or maximum of two arrays and applies SIMD instructions for 8 bit integer and 32 bit floating point elements.
+		 * @param first The first array, must be valid
+		 * @param second The second array, must be valid
+		 * @param target The target array receiving the element-wise extrema, may be identical to 'first' or 'second', must be valid
+		 * @param elements The number of elements in each array, with range [1, infinity)
+		 * @tparam T Data type of the data elements
+		 * @tparam tMinimum True, to determine the minimum; False, to determine the maximum
+		 */
+		template <typename T, bool tMinimum>
+		static inline void extremaElements(const T* first, const T* second, T* target, const unsigned int elements);
+
+		/**
+		 * Returns the minimum or maximum of two values.
+		 * @param first The first value
+		 * @param second The second value
+		 * @return The extremum of both values
+		 * @tparam T Data type of the values
+		 * @tparam tMinimum True, to return the minimum; False, to return the maximum
+		 */
+		template <typename T, bool tMinimum>
+		static OCEAN_FORCE_INLINE T extremum(const T& first, const T& second);
 };
 
 template <typename T, typename TBin, unsigned int tSize>
@@ -437,6 +515,270 @@ inline unsigned int FrameFilterSorted::clampUpper(const unsigned int index, cons
 	return std::min(index + upperOffset, size - 1u);
 }
 
+template <typename T, unsigned int tChannels, bool tMinimum>
+void FrameFilterSorted::filterVanHerkGilWerman(const T* source, T* target, const unsigned int width, const unsigned int height, const unsigned int sourcePaddingElements, const unsigned int targetPaddingElements, const unsigned int filterSize, Worker* worker)
+{
+	static_assert(tChannels != 0u, "Invalid channel number!");
+
+	ocean_assert(source != nullptr && target != nullptr && source != target);
+	ocean_assert(width >= 1u && height >= 1u);
+	ocean_assert(filterSize >= 1u && filterSize % 2u == 1u);
+
+	if (worker)
+	{
+		// each subset starts with a partial block of rows, so that the subsets should not be smaller than the filter
+		worker->executeFunction(Worker::Function::createStatic(&filterVanHerkGilWermanSubset<T, tChannels, tMinimum>, source, target, width, height, sourcePaddingElements, targetPaddingElements, filterSize, 0u, 0u), 0u, height, 7u, 8u, std::max(20u, filterSize));
+	}
+	else
+	{
+		filterVanHerkGilWermanSubset<T, tChannels, tMinimum>(source, target, width, height, sourcePaddingElements, targetPaddingElements, filterSize, 0u, height);
+	}
+}
+
+template <typename T, unsigned int tChannels, bool tMinimum>
+void FrameFilterSorted::filterVanHerkGilWermanSubset(const T* source, T* target, const unsigned int width, const unsigned int height, const unsigned int sourcePaddingElements, const unsigned int targetPaddingElements, const unsigned int filterSize, const unsigned int firstRow, const unsigned int numberRows)
+{
+	static_assert(tChannels != 0u, "Invalid channel number!");
+
+	ocean_assert(source != nullptr && target != nullptr);
+	ocean_assert(filterSize >= 1u && filterSize % 2u == 1u);
+	ocean_assert(firstRow + numberRows <= height);
+
+	const unsigned int filterSize_2 = filterSize / 2u;
+
+	const unsigned int rowElements = width * tChannels;
+
+	const unsigned int sourceStrideElements = rowElements + sourcePaddingElements;
+	const unsigned int targetStrideElements = rowElements + targetPaddingElements;
+
+	// the suffix extrema of one block of rows, the running prefix extrema, and the suffix extrema of one block of pixels within a row
+	Memory suffixRowsMemory = Memory::create<T>(size_t(filterSize) * size_t(rowElements));
+	Memory prefixRowMemory = Memory::create<T>(rowElements);
+	Memory verticalRowMemory = Memory::create<T>(rowElements);
+	Memory suffixPixelsMemory = Memory::create<T>(size_t(filterSize) * size_t(tChannels));
+
+	T* const suffixRows = suffixRowsMemory.data<T>();
+	T* const prefixRow = prefixRowMemory.data<T>();
+	T* const verticalRow = verticalRowMemory.data<T>();
+	T* const suffixPixels = suffixPixelsMemory.data<T>();
+
+	const unsigned int endRow = firstRow + numberRows;
+
+	// the blocks are aligned with the frame (not with the subset) so that all subsets apply the identical partitioning
+
+	for (unsigned int blockStart = firstRow - firstRow % filterSize; blockStart < endRow; blockStart += filterSize)
+	{
+		const unsigned int blockFirstRow = std::max(blockStart, firstRow);
+		const unsigned int blockEndRow = std::min(blockStart + filterSize, endRow);
+
+		// all filter windows of this block contain the center row
+		const unsigned int centerRow = clampUpper(blockStart, filterSize_2, height);
+		const unsigned int suffixFirstRow = clampLower(blockFirstRow, filterSize_2);
+
+		ocean_assert(suffixFirstRow <= centerRow && centerRow - suffixFirstRow < filterSize);
+
+		memcpy(suffixRows + (centerRow - suffixFirstRow) * rowElements, source + centerRow * sourceStrideElements, rowElements * sizeof(T));
+
+		for (unsigned int y = centerRow; y > suffixFirstRow; --y)
+		{
+			extremaElements<T, tMinimum>(source + (y - 1u) * sourceStrideElements, suffixRows + (y - suffixFirstRow) * rowElements, suffixRows + (y - 1u - suffixFirstRow) * rowElements, rowElements);
+		}
+
+		unsigned int prefixLastRow = centerRow;
+
+		for (unsigned int y = blockFirstRow; y < blockEndRow; ++y)
+		{
+			const unsigned int windowTop = clampLower(y, filterSize_2);
+			const unsigned int windowBottom = clampUpper(y, filterSize_2, height);
+
+			ocean_assert(windowTop >= suffixFirstRow && windowTop <= centerRow);
+			const T* const suffixRow = suffixRows + (windowTop - suffixFirstRow) * rowElements;
+
+			const T* filteredRow = suffixRow;
+
+			if (windowBottom > centerRow)
+			{
+				// the window (inside the frame) is composed of the suffix [windowTop, centerRow] and the prefix [centerRow + 1, windowBottom]
+
+				while (prefixLastRow < windowBottom)
+				{
+					++prefixLastRow;
+
+					if (prefixLastRow == centerRow + 1u)
+					{
+						memcpy(prefixRow, source + prefixLastRow * sourceStrideElements, rowElements * sizeof(T));
+					}
+					else
+					{
+						extremaElements<T, tMinimum>(prefixRow, source + prefixLastRow * sourceStrideElements, prefixRow, rowElements);
+					}
+				}
+
+				extremaElements<T, tMinimum>(suffixRow, prefixRow, verticalRow, rowElements);
+				filteredRow = verticalRow;
+			}
+
+			filterVanHerkGilWermanRow<T, tChannels, tMinimum>(filteredRow, target + y * targetStrideElements, width, filterSize, suffixPixels);
+		}
+	}
+}
+
+template <typename T, unsigned int tChannels, bool tMinimum>
+void FrameFilterSorted::filterVanHerkGilWermanRow(const T* sourceRow, T* targetRow, const unsigned int width, const unsigned int filterSize, T* suffixBuffer)
+{
+	static_assert(tChannels != 0u, "Invalid channel number!");
+
+	ocean_assert(sourceRow != nullptr && targetRow != nullptr && suffixBuffer != nullptr);
+	ocean_assert(sourceRow != targetRow);
+	ocean_assert(filterSize >= 1u && filterSize % 2u == 1u);
+
+	const unsigned int filterSize_2 = filterSize / 2u;
+
+	T prefix[tChannels];
+
+	for (unsigned int blockStart = 0u; blockStart < width; blockStart += filterSize)
+	{
+		const unsigned int blockEnd = std::min(blockStart + filterSize, width);
+
+		const unsigned int centerX = clampUpper(blockStart, filterSize_2, width);
+		const unsigned int suffixFirstX = clampLower(blockStart, filterSize_2);
+
+		ocean_assert(suffixFirstX <= centerX && centerX - suffixFirstX < filterSize);
+
+		for (unsigned int n = 0u; n < tChannels; ++n)
+		{
+			suffixBuffer[(centerX - suffixFirstX) * tChannels + n] = sourceRow[centerX * tChannels + n];
+		}
+
+		for (unsigned int x = centerX; x > suffixFirstX; --x)
+		{
+			const T* const sourcePixel = sourceRow + (x - 1u) * tChannels;
+			const T* const previousSuffix = suffixBuffer + (x - suffixFirstX) * tChannels;
+			T* const suffix = suffixBuffer + (x - 1u - suffixFirstX) * tChannels;
+
+			for (unsigned int n = 0u; n < tChannels; ++n)
+			{
+				suffix[n] = extremum<T, tMinimum>(sourcePixel[n], previousSuffix[n]);
+			}
+		}
+
+		unsigned int prefixLastX = centerX;
+
+		for (unsigned int x = blockStart; x < blockEnd; ++x)
+		{
+			const unsigned int windowLeft = clampLower(x, filterSize_2);
+			const unsigned int windowRight = clampUpper(x, filterSize_2, width);
+
+			ocean_assert(windowLeft >= suffixFirstX && windowLeft <= centerX);
+			const T* const suffix = suffixBuffer + (windowLeft - suffixFirstX) * tChannels;
+
+			T* const targetPixel = targetRow + x * tChannels;
+
+			if (windowRight > centerX)
+			{
+				while (prefixLastX < windowRight)
+				{
+					++prefixLastX;
+
+					const T* const sourcePixel = sourceRow + prefixLastX * tChannels;
+
+					for (unsigned int n = 0u; n < tChannels; ++n)
+					{
+						prefix[n] = prefixLastX == centerX + 1u ? sourcePixel[n] : extremum<T, tMinimum>(prefix[n], sourcePixel[n]);
+					}
+				}
+
+				for (unsigned int n = 0u; n < tChannels; ++n)
+				{
+					targetPixel[n] = extremum<T, tMinimum>(suffix[n], prefix[n]);
+				}
+			}
+			else
+			{
+				for (unsigned int n = 0u; n < tChannels; ++n)
+				{
+					targetPixel[n] = suffix[n];
+				}
+			}
+		}
+	}
+}
+
+template <typename T, bool tMinimum>
+inline void FrameFilterSorted::extremaElements(const T* first, const T* second, T* target, const unsigned int elements)
+{
+	ocean_assert(first != nullptr && second != nullptr && target != nullptr);
+	ocean_assert(elements >= 1u);
+
+	unsigned int n = 0u;
+
+#if defined(OCEAN_HARDWARE_SSE_VERSION) && OCEAN_HARDWARE_SSE_VERSION >= 41
+
+	if constexpr (std::is_same<T, uint8_t>::value)
+	{
+		for (; n + 16u <= elements; n += 16u)
+		{
+			const __m128i first_u_8x16 = _mm_loadu_si128((const __m128i*)(first + n));
+			const __m128i second_u_8x16 = _mm_loadu_si128((const __m128i*)(second + n));
+
+			_mm_storeu_si128((__m128i*)(target + n), tMinimum ? _mm_min_epu8(first_u_8x16, second_u_8x16) : _mm_max_epu8(first_u_8x16, second_u_8x16));
+		}
+	}
+	else if constexpr (std::is_same<T, float>::value)
+	{
+		for (; n + 4u <= elements; n += 4u)
+		{
+			const __m128 first_32x4 = _mm_loadu_ps(first + n);
+			const __m128 second_32x4 = _mm_loadu_ps(second + n);
+
+			_mm_storeu_ps(target + n, tMinimum ? _mm_min_ps(first_32x4, second_32x4) : _mm_max_ps(first_32x4, second_32x4));
+		}
+	}
+
+#elif defined(OCEAN_HARDWARE_NEON_VERSION) && OCEAN_HARDWARE_NEON_VERSION >= 10
+
+	if constexpr (std::is_same<T, uint8_t>::value)
+	{
+		for (; n + 16u <= elements; n += 16u)
+		{
+			const uint8x16_t first_u_8x16 = vld1q_u8(first + n);
+			const uint8x16_t second_u_8x16 = vld1q_u8(second + n);
+
+			vst1q_u8(target + n, tMinimum ? vminq_u8(first_u_8x16, second_u_8x16) : vmaxq_u8(first_u_8x16, second_u_8x16));
+		}
+	}
+	else if constexpr (std::is_same<T, float>::value)
+	{
+		for (; n + 4u <= elements; n += 4u)
+		{
+			const float32x4_t first_32x4 = vld1q_f32(first + n);
+			const float32x4_t second_32x4 = vld1q_f32(second + n);
+
+			vst1q_f32(target + n, tMinimum ? vminq_f32(first_32x4, second_32x4) : vmaxq_f32(first_32x4, second_32x4));
+		}
+	}
+
+#endif // OCEAN_HARDWARE_SSE_VERSION, OCEAN_HARDWARE_NEON_VERSION
+
+	for (; n < elements; ++n)
+	{
+		target[n] = extremum<T, tMinimum>(first[n], second[n]);
+	}
+}
+
+template <typename T, bool tMinimum>
+OCEAN_FORCE_INLINE T FrameFilterSorted::extremum(const T& first, const T& second)
+{
+	if constexpr (tMinimum)
+	{
+		return second < first ? second : first;
+	}
+	else
+	{
+		return first < second ? second : first;
+	}
+}
+
 }
 
 }
@@ -138,6 +138,13 @@ bool FrameInterpolatorBilinear::Comfort::resize(const Frame& source, Frame& targ
 					return true;
 			}
 		}
+		else if (dataType == FrameType::DT_SIGNED_FLOAT_16)
+		{
+			if (source.channels() <= 4u)
+			{
+				return FrameInterpolatorBilinear::resizeFloat16(source.constdata<Float16>(), target.data<Float16>(), source.width(), source.height(), target.width(), target.height(), source.channels(), source.paddingElements(), target.paddingElements(), worker);
+			}
+		}
 	}
 
 	ocean_assert(false && "Not supported pixel format!");
@@ -1435,6 +1442,115 @@ Scalar FrameInterpolatorBilinear::patchIntensitySum1Channel(const uint32_t* line
 	return factorTopLeft * Scalar(intensityTopLeft) + factorTopRight * Scalar(intensityTopRight) + factorBottomLeft * Scalar(intensityBottomLeft) + factorBottomRight * Scalar(intensityBottomRight);
 }
 
+FrameInterpolatorBilinear::LookupTable FrameInterpolatorBilinear::resampleCameraImageLookupTable(const AnyCamera& sourceCamera, const SquareMatrix3& source_R_target, const AnyCamera& targetCamera, const unsigned int binSizeInPixel)
+{
+	ocean_assert(sourceCamera.isValid());
+	ocean_assert(source_R_target.isOrthonormal());
+	ocean_assert(targetCamera.isValid());
+	ocean_assert(binSizeInPixel >= 1u);
+
+	const size_t binsX = std::max(1u, targetCamera.width() / std::max(1u, binSizeInPixel));
+	const size_t binsY = std::max(1u, targetCamera.height() / std::max(1u, binSizeInPixel));
+	LookupTable lookupTable(targetCamera.width(), targetCamera.height(), binsX, binsY);
+
+	for (size_t yBin = 0; yBin <= lookupTable.binsY(); ++yBin)
+	{
+		for (size_t xBin = 0; xBin <= lookupTable.binsX(); ++xBin)
+		{
+			const Vector2 cornerPosition = lookupTable.binTopLeftCornerPosition(xBin, yBin);
+
+			constexpr bool makeUnitVector = false; // we don't need a unit/normalized vector as we project the vector into the camera again
+
+			const Vector3 rayI = source_R_target * targetCamera.vector(cornerPosition, makeUnitVector);
+			const Vector3 rayIF = Vector3(rayI.x(), -rayI.y(), -rayI.z());
+
+			if (rayIF.z() > Numeric::eps())
+			{
+				const Vector2 projectedPoint = sourceCamera.projectToImageIF(rayIF);
+
+				lookupTable.setBinTopLeftCornerValue(xBin, yBin, projectedPoint - cornerPosition);
+			}
+			else
+			{
+				// simply a coordinate far outside the input
+				lookupTable.setBinTopLeftCornerValue(xBin, yBin, Vector2(Scalar(sourceCamera.width() * 10u), Scalar(sourceCamera.height() * 10u)));
+			}
+		}
+	}
+
+	return lookupTable;
+}
+
+bool FrameInterpolatorBilinear::resizeFloat16(const Float16* source, Float16* target, const unsigned int sourceWidth, const unsigned int sourceHeight, const unsigned int targetWidth, const unsigned int targetHeight, const unsigned int channels, const unsigned int sourcePaddingElements, const unsigned int targetPaddingElements, Worker* worker)
+{
+	static_assert(sizeof(Float16) == sizeof(uint16_t), "Invalid data type!");
+
+	ocean_assert(source != nullptr && target != nullptr);
+	ocean_assert(sourceWidth >= 1u && sourceHeight >= 1u);
+	ocean_assert(targetWidth >= 1u && targetHeight >= 1u);
+
+	ocean_assert(channels >= 1u && channels <= 4u);
+	if (channels == 0u || channels > 4u)
+	{
+		return false;
+	}
+
+	if (sourceWidth == targetWidth && sourceHeight == targetHeight)
+	{
+		FrameConverter::cast<Float16, Float16>(source, target, sourceWidth, sourceHeight, channels, sourcePaddingElements, targetPaddingElements);
+		return true;
+	}
+
+#if defined(OCEAN_CV_NEON_FP16)
+
+	if (CPUDispatch::hasLevel(CPUDispatch::IL_NEON))
+	{
+		if (worker != nullptr)
+		{
+			worker->executeFunction(Worker::Function::createStatic(&FrameInterpolatorBilinear::resizeFloat16NEONSubset, source, target, sourceWidth, sourceHeight, targetWidth, targetHeight, channels, sourcePaddingElements, targetPaddingElements, 0u, 0u), 0u, targetHeight);
+		}
+		else
+		{
+			resizeFloat16NEONSubset(source, target, sourceWidth, sourceHeight, targetWidth, targetHeight, channels, sourcePaddingElements, targetPaddingElements, 0u, targetHeight);
+		}
+
+		return true;
+	}
+
+#endif // OCEAN_CV_NEON_FP16
+
+	// the processor does not support FP16 arithmetic, so we resize with 32-bit float precision
+
+	Memory sourceFloat = Memory::create<float>(size_t(sourceWidth * channels) * size_t(sourceHeight));
+	Memory targetFloat = Memory::create<float>(size_t(targetWidth * channels) * size_t(targetHeight));
+
+	FrameConverter::cast<Float16, float>(source, sourceFloat.data<float>(), sourceWidth, sourceHeight, channels, sourcePaddingElements, 0u);
+
+	switch (channels)
+	{
+		case 1u:
+			resize<float, 1u>(sourceFloat.constdata<float>(), targetFloat.data<float>(), sourceWidth, sourceHeight, targetWidth, targetHeight, 0u, 0u, worker);
+			break;
+
+		case 2u:
+			resize<float, 2u>(sourceFloat.constdata<float>(), targetFloat.data<float>(), sourceWidth, sourceHeight, targetWidth, targetHeight, 0u, 0u, worker);
+			break;
+
+		case 3u:
+			resize<float, 3u>(sourceFloat.constdata<float>(), targetFloat.data<float>(), sourceWidth, sourceHeight, targetWidth, targetHeight, 0u, 0u, worker);
+			break;
+
+		default:
+			ocean_assert(channels == 4u);
+			resize<float, 4u>(sourceFloat.constdata<float>(), targetFloat.data<float>(), sourceWidth, sourceHeight, targetWidth, targetHeight, 0u, 0u, worker);
+			break;
+	}
+
+	FrameConverter::cast<float, Float16>(targetFloat.constdata<float>(), target, targetWidth, targetHeight, channels, 0u, targetPaddingElements);
+
+	return true;
+}
+
 bool FrameInterpolatorBilinear::coversHomographyInputFrame(const unsigned int inputWidth, const unsigned int inputHeight, const unsigned int outputWidth, const unsigned int outputHeight, const SquareMatrix3& input_H_output, const int outputOriginX, const int outputOriginY)
 {
 	ocean_assert(inputWidth >= 1u && inputHeight >= 1u);
@@ -2225,6 +2341,154 @@ void FrameInterpolatorBilinear::scale8BitPerChannelSubset7BitPrecisionNEON(const
 
 #endif // OCEAN_HARDWARE_NEON_VERSION >= 10
 
+#if defined(OCEAN_CV_NEON_FP16)
+
+void FrameInterpolatorBilinear::resizeFloat16NEONSubset(const Float16* source, Float16* target, const unsigned int sourceWidth, const unsigned int sourceHeight, const unsigned int targetWidth, const unsigned int targetHeight, const unsigned int channels, const unsigned int sourcePaddingElements, const unsigned int targetPaddingElements, const unsigned int firstTargetRow, const unsigned int numberTargetRows)
+{
+	ocean_assert(source != nullptr && target != nullptr);
+	ocean_assert(sourceWidth >= 1u && sourceHeight >= 1u);
+	ocean_assert(targetWidth >= 1u && targetHeight >= 1u);
+	ocean_assert(channels >= 1u);
+
+	const unsigned int sourceRowElements = sourceWidth * channels;
+	const unsigned int targetRowElements = targetWidth * channels;
+
+	const unsigned int sourceStrideElements = sourceRowElements + sourcePaddingElements;
+	const unsigned int targetStrideElements = targetRowElements + targetPaddingElements;
+
+	// we use the same source locations as scaleSubset(), see there for a detailed documentation
+
+	const float sourceX_T_targetX = float(double(sourceWidth) / double(targetWidth));
+	const float sourceY_T_targetY = float(double(sourceHeight) / double(targetHeight));
+
+	const float targetOffsetX = sourceX_T_targetX * 0.5f - 0.5f;
+	const float targetOffsetY = sourceY_T_targetY * 0.5f - 0.5f;
+
+	// we pre-calculate the left and right source elements and the interpolation factors for each target element
+
+	Memory memoryLeftLocations = Memory::create<unsigned int>(targetRowElements);
+	Memory memoryRightLocations = Memory::create<unsigned int>(targetRowElements);
+	Memory memoryFactorsRight = Memory::create<Float16>(targetRowElements);
+
+	unsigned int* const leftLocations = memoryLeftLocations.data<unsigned int>();
+	unsigned int* const rightLocations = memoryRightLocations.data<unsigned int>();
+	Float16* const factorsRight = memoryFactorsRight.data<Float16>();
+
+	for (unsigned int x = 0u; x < targetWidth; ++x)
+	{
+		const float sourceX = minmax<float>(0.0f, targetOffsetX + sourceX_T_targetX * float(x), float(sourceWidth) - 1.0f);
+
+		const unsigned int left = (unsigned int)(sourceX); // we must not round here
+		const unsigned int right = min(left + 1u, sourceWidth - 1u);
+
+		const Float16 factorRight(sourceX - float(left));
+
+		for (unsigned int c = 0u; c < channels; ++c)
+		{
+			leftLocations[x * channels + c] = left * channels + c;
+			rightLocations[x * channels + c] = right * channels + c;
+			factorsRight[x * channels + c] = factorRight;
+		}
+	}
+
+	Memory memoryIntermediateRow = Memory::create<Float16>(sourceRowElements);
+	Memory memoryLeftRow = Memory::create<Float16>(targetRowElements);
+	Memory memoryRightRow = Memory::create<Float16>(targetRowElements);
+
+	Float16* const intermediateRow = memoryIntermediateRow.data<Float16>();
+	Float16* const leftRow = memoryLeftRow.data<Float16>();
+	Float16* const rightRow = memoryRightRow.data<Float16>();
+
+	for (unsigned int y = firstTargetRow; y < firstTargetRow + numberTargetRows; ++y)
+	{
+		const float sourceY = minmax<float>(0.0f, targetOffsetY + sourceY_T_targetY * float(y), float(sourceHeight) - 1.0f);
+
+		const unsigned int sourceRowTop = (unsigned int)(sourceY); // we must not round here
+		const unsigned int sourceRowBottom = min(sourceRowTop + 1u, sourceHeight - 1u);
+
+		const Float16 factorBottom(sourceY - float(sourceRowTop));
+
+		const Float16* const sourceTopRow = source + sourceRowTop * sourceStrideElements;
+		const Float16* const sourceBottomRow = source + sourceRowBottom * sourceStrideElements;
+
+		// vertical interpolation: intermediate = top + factorBottom * (bottom - top)
+
+		if (sourceRowElements >= 8u)
+		{
+			const float16x8_t factorBottom_16x8 = vreinterpretq_f16_u16(vdupq_n_u16(factorBottom.binary()));
+
+			for (unsigned int n = 0u; n < sourceRowElements; n += 8u)
+			{
+				if (n + 8u > sourceRowElements)
+				{
+					// the last iteration does not fit into the row, so we shift the block to the left and determine some elements again
+
+					ocean_assert(n >= 8u && sourceRowElements > 8u);
+					n = sourceRowElements - 8u;
+
+					// the for loop will stop after this iteration
+					ocean_assert(!(n + 8u < sourceRowElements));
+				}
+
+				const float16x8_t top_16x8 = vreinterpretq_f16_u16(vld1q_u16((const uint16_t*)(sourceTopRow + n)));
+				const float16x8_t bottom_16x8 = vreinterpretq_f16_u16(vld1q_u16((const uint16_t*)(sourceBottomRow + n)));
+
+				vst1q_u16((uint16_t*)(intermediateRow + n), vreinterpretq_u16_f16(vfmaq_f16(top_16x8, vsubq_f16(bottom_16x8, top_16x8), factorBottom_16x8)));
+			}
+		}
+		else
+		{
+			for (unsigned int n = 0u; n < sourceRowElements; ++n)
+			{
+				const float top = float(sourceTopRow[n]);
+
+				intermediateRow[n] = Float16(top + float(factorBottom) * (float(sourceBottomRow[n]) - top));
+			}
+		}
+
+		// horizontal interpolation: target = left + factorRight * (right - left)
+
+		for (unsigned int n = 0u; n < targetRowElements; ++n)
+		{
+			leftRow[n] = intermediateRow[leftLocations[n]];
+			rightRow[n] = intermediateRow[rightLocations[n]];
+		}
+
+		Float16* const targetRow = target + y * targetStrideElements;
+
+		if (targetRowElements >= 8u)
+		{
+			for (unsigned int n = 0u; n < targetRowElements; n += 8u)
+			{
+				if (n + 8u > targetRowElements)
+				{
+					ocean_assert(n >= 8u && targetRowElements > 8u);
+					n = targetRowElements - 8u;
+
+					ocean_assert(!(n + 8u < targetRowElements));
+				}
+
+				const float16x8_t left_16x8 = vreinterpretq_f16_u16(vld1q_u16((const uint16_t*)(leftRow + n)));
+				const float16x8_t right_16x8 = vreinterpretq_f16_u16(vld1q_u16((const uint16_t*)(rightRow + n)));
+				const float16x8_t factorsRight_16x8 = vreinterpretq_f16_u16(vld1q_u16((const uint16_t*)(factorsRight + n)));
+
+				vst1q_u16((uint16_t*)(targetRow + n), vreinterpretq_u16_f16(vfmaq_f16(left_16x8, vsubq_f16(right_16x8, left_16x8), factorsRight_16x8)));
+			}
+		}
+		else
+		{
+			for (unsigned int n = 0u; n < targetRowElements; ++n)
+			{
+				const float left = float(leftRow[n]);
+
+				targetRow[n] = Float16(left + float(factorsRight[n]) * (float(rightRow[n]) - left));
+			}
+		}
+	}
+}
+
+#endif // OCEAN_CV_NEON_FP16
+
 }
 
 }
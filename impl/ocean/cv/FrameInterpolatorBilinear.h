@@ -9,6 +9,7 @@
 #define META_OCEAN_CV_FRAME_INTERPOLATOR_BILINEAR_H
 
 #include "ocean/cv/CV.h"
+#include "ocean/cv/CPUDispatch.h"
 #include "ocean/cv/FrameBlender.h"
 #include "ocean/cv/NEON.h"
 #include "ocean/cv/PixelPosition.h"
@@ -388,6 +389,25 @@ class OCEAN_CV_EXPORT FrameInterpolatorBilinear
 		template <typename T, unsigned int tChannels>
 		static inline void resize(const T* source, T* target, const unsigned int sourceWidth, const unsigned int sourceHeight, const unsigned int targetWidth, const unsigned int targetHeight, const unsigned int sourcePaddingElements, const unsigned int targetPaddingElements, Worker* worker = nullptr);
 
+		/**
+		 * Resizes a given frame with 16-bit float elements by using a bilinear interpolation.
+		 * On ARM processors supporting FP16 vector arithmetic (ARMv8.2-A) the interpolation is applied with NEON instructions handling eight elements at once.<br>
+		 * Otherwise, the frame is converted to 32-bit float elements, resized, and converted back.
+		 * @param source The source frame buffer providing the image information to be resized, must be valid
+		 * @param target The target frame buffer receiving the resized image information, must be valid
+		 * @param sourceWidth Width of the source frame in pixel, with range [1, infinity)
+		 * @param sourceHeight Height of the source frame in pixel, with range [1, infinity)
+		 * @param targetWidth Width of the target frame in pixel, with range [1, infinity)
+		 * @param targetHeight Height of the target frame in pixel, with range [1, infinity)
+		 * @param channels The number of channels of the frame, with range [1, 4]
+		 * @param sourcePaddingElements The number of padding elements at the end of each source row, in elements, with range [0, infinity)
+		 * @param targetPaddingElements The number of padding elements at the end of each target row, in elements, with range [0, infinity)
+		 * @param worker Optional worker object to distribute the computation to several CPU cores
+		 * @return True, if succeeded
+		 * @see resize<T, tChannels>().
+		 */
+		static bool resizeFloat16(const Float16* source, Float16* target, const unsigned int sourceWidth, const unsigned int sourceHeight, const unsigned int targetWidth, const unsigned int targetHeight, const unsigned int channels, const unsigned int sourcePaddingElements, const unsigned int targetPaddingElements, Worker* worker = nullptr);
+
 		/**
 		 * Rescales a given frame with arbitrary data type (e.g., float, double, int) by using a bilinear interpolation with user-defined scaling factors.
 		 * Beware: This function is not optimized for performance but supports arbitrary data types.<br>
@@ -666,6 +686,17 @@ class OCEAN_CV_EXPORT FrameInterpolatorBilinear
 		template <typename T, unsigned int tChannels>
 		static void resampleCameraImage(const T* sourceFrame, const AnyCamera& sourceCamera, const SquareMatrix3& source_R_target, const AnyCamera& targetCamera, T* targetFrame, const unsigned int sourceFramePaddingElements, const unsigned int targetFramePaddingElements, LookupCorner2<Vector2>* source_OLT_target = nullptr, Worker* worker = nullptr, const unsigned int binSizeInPixel = 8u, const T* borderColor = nullptr);
 
+		/**
+		 * Creates the offset lookup table which is used to re-sample a camera image captured with a camera profile as if the image would have been captured with a second camera profile.
+		 * @param sourceCamera The source camera profile which has been used to capture the source image, must be valid
+		 * @param source_R_target The rotation transforming 3D points defined in the coordinate system of the target camera image to 3D points defined in the coordinate system of the source camera image, must be valid
+		 * @param targetCamera The camera profile of the target frame, must be valid
+		 * @param binSizeInPixel The size in pixel of the interpolation bins used for building the lookup table, with range [1, infinity)
+		 * @return The resulting offset lookup table between target image points and source image points, with resolution targetCamera.width() x targetCamera.height()
+		 * @see resampleCameraImage().
+		 */
+		static LookupTable resampleCameraImageLookupTable(const AnyCamera& sourceCamera, const SquareMatrix3& source_R_target, const AnyCamera& targetCamera, const unsigned int binSizeInPixel = 8u);
+
 		/**
 		 * Determines the interpolated pixel values for a given pixel position in an 8 bit per channel frame.
 		 * This function uses an integer interpolation with a precision of 1/128.
@@ -958,6 +989,27 @@ class OCEAN_CV_EXPORT FrameInterpolatorBilinear
 		template <typename T, typename TScale, unsigned int tChannels>
 		static void scaleSubset(const T* source, T* target, const unsigned int sourceWidth, const unsigned int sourceHeight, const unsigned int targetWidth, const unsigned int targetHeight, const double sourceX_s_targetX, const double sourceY_s_targetY, const unsigned int sourcePaddingElements, const unsigned int targetPaddingElements, const unsigned int firstTargetRow, const unsigned int numberTargetRows);
 
+#if defined(OCEAN_CV_NEON_FP16)
+
+		/**
+		 * Resizes a subset of a given frame with 16-bit float elements by a bilinear interpolation.
+		 * This function applies NEON FP16 instructions, the interpolation is applied with 16-bit float precision.
+		 * @param source The image data of the source frame to be resized, must be valid
+		 * @param target The target frame buffer receiving the interpolated (resized) source frame, must be valid
+		 * @param sourceWidth Width of the source frame in pixel, with range [1, infinity)
+		 * @param sourceHeight Height of the source frame in pixel, with range [1, infinity)
+		 * @param targetWidth Width of the target frame in pixel, with range [1, infinity)
+		 * @param targetHeight Height of the target frame in pixel, with range [1, infinity)
+		 * @param channels The number of channels of the frame, with range [1, infinity)
+		 * @param sourcePaddingElements The number of padding elements at the end of each source row, in elements, with range [0, infinity)
+		 * @param targetPaddingElements The number of padding elements at the end of each target row, in elements, with range [0, infinity)
+		 * @param firstTargetRow The first target row to be handled, with range [0, targetHeight)
+		 * @param numberTargetRows The number of target row to be handled, with range [1, targetHeight - firstTargetRow]
+		 */
+		static void resizeFloat16NEONSubset(const Float16* source, Float16* target, const unsigned int sourceWidth, const unsigned int sourceHeight, const unsigned int targetWidth, const unsigned int targetHeight, const unsigned int channels, const unsigned int sourcePaddingElements, const unsigned int targetPaddingElements, const unsigned int firstTargetRow, const unsigned int numberTargetRows);
+
+#endif // OCEAN_CV_NEON_FP16
+
 		/**
 		 * Rotates a subset of a given frame by a bilinear interpolation.
 		 * @param source The source frame to be rotated, must be valid
@@ -1139,6 +1191,19 @@ class OCEAN_CV_EXPORT FrameInterpolatorBilinear
 		template <unsigned int tChannels>
 		static OCEAN_FORCE_INLINE __m128i interpolate4Pixels8BitPerChannelSSE(const __m128i& m128_sourcesTopLeft, const __m128i& m128_sourcesTopRight, const __m128i& m128_sourcesBottomLeft, const __m128i& m128_sourcesBottomRight, const __m128i& m128_factorsTopLeft, const __m128i& m128_factorsTopRight, const __m128i& m128_factorsBottomLeft, const __m128i& m128_factorsBottomRight);
 
+		/**
+		 * Interpolates 16 independent 8 bit elements concurrently, each element has individual interpolation factors.
+		 * The result is identical to the (rounded) integer interpolation of interpolatePixel8BitPerChannel().
+		 * @param m128_topLeft The 16 top left elements
+		 * @param m128_topRight The 16 top right elements
+		 * @param m128_bottomLeft The 16 bottom left elements
+		 * @param m128_bottomRight The 16 bottom right elements
+		 * @param m128_factorsRight The 16 horizontal interpolation factors for the right elements, with range [0, 128], one 8 bit factor for each element
+		 * @param m128_factorsBottom The 16 vertical interpolation factors for the bottom elements, with range [0, 128], one 8 bit factor for each element
+		 * @return The 16 interpolated elements
+		 */
+		static OCEAN_FORCE_INLINE __m128i interpolate16Elements8BitSSE(const __m128i& m128_topLeft, const __m128i& m128_topRight, const __m128i& m128_bottomLeft, const __m128i& m128_bottomRight, const __m128i& m128_factorsRight, const __m128i& m128_factorsBottom);
+
 #endif // OCEAN_HARDWARE_SSE_VERSION
 
 #if defined(OCEAN_HARDWARE_NEON_VERSION) && OCEAN_HARDWARE_NEON_VERSION >= 10
@@ -1240,8 +1305,60 @@ class OCEAN_CV_EXPORT FrameInterpolatorBilinear
 		 */
 		static OCEAN_FORCE_INLINE void interpolate4Pixels4Channel8BitPerChannelNEON(const uint8x16_t& topLeftPixels_u8x16, const uint8x16_t& topRightPixels_u8x16, const uint8x16_t& bottomLeftPixels_u8x16, const uint8x16_t& bottomRightPixels_u8x16, const uint32x4_t& m128_factorsRight, const uint32x4_t& m128_factorsBottom, typename DataType<uint8_t, 4u>::Type* targetPositionPixels, const bool useOptimizedNEONFactorReplication = false);
 
+		/**
+		 * Interpolates 16 independent 8 bit elements concurrently, each element has individual interpolation factors.
+		 * The result is identical to the (rounded) integer interpolation of interpolatePixel8BitPerChannel().
+		 * @param topLeft_u_8x16 The 16 top left elements
+		 * @param topRight_u_8x16 The 16 top right elements
+		 * @param bottomLeft_u_8x16 The 16 bottom left elements
+		 * @param bottomRight_u_8x16 The 16 bottom right elements
+		 * @param factorsRight_u_8x16 The 16 horizontal interpolation factors for the right elements, with range [0, 128], one factor for each element
+		 * @param factorsBottom_u_8x16 The 16 vertical interpolation factors for the bottom elements, with range [0, 128], one factor for each element
+		 * @return The 16 interpolated elements
+		 */
+		static OCEAN_FORCE_INLINE uint8x16_t interpolate16Elements8BitNEON(const uint8x16_t& topLeft_u_8x16, const uint8x16_t& topRight_u_8x16, const uint8x16_t& bottomLeft_u_8x16, const uint8x16_t& bottomRight_u_8x16, const uint8x16_t& factorsRight_u_8x16, const uint8x16_t& factorsBottom_u_8x16);
+
 #endif // OCEAN_HARDWARE_SSE_VERSION
 
+#if (defined(OCEAN_HARDWARE_SSE_VERSION) && OCEAN_HARDWARE_SSE_VERSION >= 41) || (defined(OCEAN_HARDWARE_NEON_VERSION) && OCEAN_HARDWARE_NEON_VERSION >= 10)
+
+		/**
+		 * Interpolates 4 successive output pixels of a 1-4 channel frame concurrently (using SSE or NEON) and updates the corresponding mask pixels.
+		 * Output pixels with a location outside the input frame are left untouched and receive (0xFF - maskValue) in the mask.<br>
+		 * The interpolation result is identical to interpolatePixel8BitPerChannel<tChannels, PC_TOP_LEFT>().
+		 * @param input The input frame, must be valid
+		 * @param inputWidth The width of the input frame in pixel, with range [1, infinity)
+		 * @param inputHeight The height of the input frame in pixel, with range [1, infinity)
+		 * @param inputPaddingElements The number of padding elements at the end of each input row, in elements, with range [0, infinity)
+		 * @param inputPositions The four locations in the input frame, one for each output pixel, must be valid
+		 * @param output The first of the four output pixels, must be valid
+		 * @param outputMask The first of the four mask pixels, must be valid
+		 * @param maskValue The mask value for output pixels with a location inside the input frame
+		 * @tparam tChannels The number of frame channels, with range [1, 4]
+		 */
+		template <unsigned int tChannels>
+		static OCEAN_FORCE_INLINE void interpolate4PixelsMask8BitPerChannel(const uint8_t* input, const unsigned int inputWidth, const unsigned int inputHeight, const unsigned int inputPaddingElements, const Vector2* inputPositions, uint8_t* output, uint8_t* outputMask, const uint8_t maskValue);
+
+#endif // (defined(OCEAN_HARDWARE_SSE_VERSION) && OCEAN_HARDWARE_SSE_VERSION >= 41) || (defined(OCEAN_HARDWARE_NEON_VERSION) && OCEAN_HARDWARE_NEON_VERSION >= 10)
+
+		/**
+		 * Interpolates one row of output pixels for given locations in the input frame and updates the corresponding mask pixels.
+		 * Output pixels with a location outside the input frame are left untouched and receive (0xFF - maskValue) in the mask, all other output pixels receive `maskValue`.<br>
+		 * Frames with 1-4 channels are interpolated in blocks of four pixels with SSE or NEON instructions (if available), the result is identical to interpolatePixel8BitPerChannel<tChannels, PC_TOP_LEFT>().
+		 * @param input The input frame, must be valid
+		 * @param inputWidth The width of the input frame in pixel, with range [1, infinity)
+		 * @param inputHeight The height of the input frame in pixel, with range [1, infinity)
+		 * @param inputPaddingElements The number of padding elements at the end of each input row, in elements, with range [0, infinity)
+		 * @param inputPositions The locations in the input frame, one for each output pixel, must be valid
+		 * @param size The number of output pixels in the row, with range [1, infinity)
+		 * @param output The first pixel of the output row, must be valid
+		 * @param outputMask The first pixel of the mask row, must be valid
+		 * @param maskValue The mask value for output pixels with a location inside the input frame
+		 * @tparam tChannels The number of frame channels, with range [1, infinity)
+		 */
+		template <unsigned int tChannels>
+		static inline void interpolateRowMask8BitPerChannel(const uint8_t* input, const unsigned int inputWidth, const unsigned int inputHeight, const unsigned int inputPaddingElements, const Vector2* inputPositions, const unsigned int size, uint8_t* output, uint8_t* outputMask, const uint8_t maskValue);
+
 		/**
 		 * Transforms an 8 bit per channel frame using the given homographies.
 		 * @param input The input frame that will be transformed
@@ -1937,34 +2054,7 @@ void FrameInterpolatorBilinear::resampleCameraImage(const T* sourceFrame, const
 	ocean_assert(targetFrame != nullptr);
 	ocean_assert(binSizeInPixel >= 1u);
 
-	const size_t binsX = std::max(1u, targetCamera.width() / binSizeInPixel);
-	const size_t binsY = std::max(1u, targetCamera.height() / binSizeInPixel);
-	CV::FrameInterpolatorBilinear::LookupTable lookupTable(targetCamera.width(), targetCamera.height(), binsX, binsY);
-
-	for (size_t yBin = 0; yBin <= lookupTable.binsY(); ++yBin)
-	{
-		for (size_t xBin = 0; xBin <= lookupTable.binsX(); ++xBin)
-		{
-			const Vector2 cornerPosition = lookupTable.binTopLeftCornerPosition(xBin, yBin);
-
-			constexpr bool makeUnitVector = false; // we don't need a unit/normalized vector as we project the vector into the camera again
-
-			const Vector3 rayI = source_R_target * targetCamera.vector(cornerPosition, makeUnitVector);
-			const Vector3 rayIF = Vector3(rayI.x(), -rayI.y(), -rayI.z());
-
-			if (rayIF.z() > Numeric::eps())
-			{
-				const Vector2 projectedPoint = sourceCamera.projectToImageIF(rayIF);
-
-				lookupTable.setBinTopLeftCornerValue(xBin, yBin, projectedPoint - cornerPosition);
-			}
-			else
-			{
-				// simply a coordinate far outside the input
-				lookupTable.setBinTopLeftCornerValue(xBin, yBin, Vector2(Scalar(sourceCamera.width() * 10u), Scalar(sourceCamera.height() * 10u)));
-			}
-		}
-	}
+	LookupTable lookupTable = resampleCameraImageLookupTable(sourceCamera, source_R_target, targetCamera, binSizeInPixel);
 
 	lookup<T, tChannels>(sourceFrame, sourceCamera.width(), sourceCamera.height(), lookupTable, true /*offset*/, borderColor, targetFrame, sourceFramePaddingElements, targetFramePaddingElements, worker);
 
@@ -3355,6 +3445,47 @@ OCEAN_FORCE_INLINE void FrameInterpolatorBilinear::interpolate4Pixels8BitPerChan
 	}
 }
 
+OCEAN_FORCE_INLINE __m128i FrameInterpolatorBilinear::interpolate16Elements8BitSSE(const __m128i& m128_topLeft, const __m128i& m128_topRight, const __m128i& m128_bottomLeft, const __m128i& m128_bottomRight, const __m128i& m128_factorsRight, const __m128i& m128_factorsBottom)
+{
+	const __m128i m128_zero = _mm_setzero_si128();
+	const __m128i m128_128 = _mm_set1_epi16(128);
+
+	// we extend the 8 bit factors to 16 bit, and we determine the left and top factors: factorLeft = 128 - factorRight
+
+	const __m128i m128_factorsRightLow = _mm_unpacklo_epi8(m128_factorsRight, m128_zero);
+	const __m128i m128_factorsRightHigh = _mm_unpackhi_epi8(m128_factorsRight, m128_zero);
+	const __m128i m128_factorsBottomLow = _mm_unpacklo_epi8(m128_factorsBottom, m128_zero);
+	const __m128i m128_factorsBottomHigh = _mm_unpackhi_epi8(m128_factorsBottom, m128_zero);
+
+	const __m128i m128_factorsLeftLow = _mm_sub_epi16(m128_128, m128_factorsRightLow);
+	const __m128i m128_factorsLeftHigh = _mm_sub_epi16(m128_128, m128_factorsRightHigh);
+	const __m128i m128_factorsTopLow = _mm_sub_epi16(m128_128, m128_factorsBottomLow);
+	const __m128i m128_factorsTopHigh = _mm_sub_epi16(m128_128, m128_factorsBottomHigh);
+
+	// horizontal interpolation without rounding: top = topLeft * factorLeft + topRight * factorRight, with range [0, 255 * 128], fitting into 16 bit
+
+	const __m128i m128_topLow = _mm_add_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(m128_topLeft, m128_zero), m128_factorsLeftLow), _mm_mullo_epi16(_mm_unpacklo_epi8(m128_topRight, m128_zero), m128_factorsRightLow));
+	const __m128i m128_topHigh = _mm_add_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(m128_topLeft, m128_zero), m128_factorsLeftHigh), _mm_mullo_epi16(_mm_unpackhi_epi8(m128_topRight, m128_zero), m128_factorsRightHigh));
+	const __m128i m128_bottomLow = _mm_add_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(m128_bottomLeft, m128_zero), m128_factorsLeftLow), _mm_mullo_epi16(_mm_unpacklo_epi8(m128_bottomRight, m128_zero), m128_factorsRightLow));
+	const __m128i m128_bottomHigh = _mm_add_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(m128_bottomLeft, m128_zero), m128_factorsLeftHigh), _mm_mullo_epi16(_mm_unpackhi_epi8(m128_bottomRight, m128_zero), m128_factorsRightHigh));
+
+	// vertical interpolation: top * factorTop + bottom * factorBottom, we interleave top and bottom values so that we can use one 32 bit multiply-add
+
+	const __m128i m128_result0 = _mm_madd_epi16(_mm_unpacklo_epi16(m128_topLow, m128_bottomLow), _mm_unpacklo_epi16(m128_factorsTopLow, m128_factorsBottomLow));
+	const __m128i m128_result1 = _mm_madd_epi16(_mm_unpackhi_epi16(m128_topLow, m128_bottomLow), _mm_unpackhi_epi16(m128_factorsTopLow, m128_factorsBottomLow));
+	const __m128i m128_result2 = _mm_madd_epi16(_mm_unpacklo_epi16(m128_topHigh, m128_bottomHigh), _mm_unpacklo_epi16(m128_factorsTopHigh, m128_factorsBottomHigh));
+	const __m128i m128_result3 = _mm_madd_epi16(_mm_unpackhi_epi16(m128_topHigh, m128_bottomHigh), _mm_unpackhi_epi16(m128_factorsTopHigh, m128_factorsBottomHigh));
+
+	// we add 8192 for rounding and shift the result by 14 bits (division by 128*128)
+
+	const __m128i m128_8192 = _mm_set1_epi32(8192);
+
+	const __m128i m128_resultLow = _mm_packs_epi32(_mm_srli_epi32(_mm_add_epi32(m128_result0, m128_8192), 14), _mm_srli_epi32(_mm_add_epi32(m128_result1, m128_8192), 14));
+	const __m128i m128_resultHigh = _mm_packs_epi32(_mm_srli_epi32(_mm_add_epi32(m128_result2, m128_8192), 14), _mm_srli_epi32(_mm_add_epi32(m128_result3, m128_8192), 14));
+
+	return _mm_packus_epi16(m128_resultLow, m128_resultHigh);
+}
+
 #endif // OCEAN_HARDWARE_SSE_VERSION
 
 #if defined(OCEAN_HARDWARE_NEON_VERSION) && OCEAN_HARDWARE_NEON_VERSION >= 10
@@ -4492,6 +4623,43 @@ OCEAN_FORCE_INLINE void FrameInterpolatorBilinear::interpolate4Pixels8BitPerChan
 	}
 }
 
+OCEAN_FORCE_INLINE uint8x16_t FrameInterpolatorBilinear::interpolate16Elements8BitNEON(const uint8x16_t& topLeft_u_8x16, const uint8x16_t& topRight_u_8x16, const uint8x16_t& bottomLeft_u_8x16, const uint8x16_t& bottomRight_u_8x16, const uint8x16_t& factorsRight_u_8x16, const uint8x16_t& factorsBottom_u_8x16)
+{
+	// factorLeft = 128 - factorRight
+	// factorTop = 128 - factorBottom
+
+	const uint8x16_t constant_128_u_8x16 = vdupq_n_u8(128u);
+
+	const uint8x16_t factorsLeft_u_8x16 = vsubq_u8(constant_128_u_8x16, factorsRight_u_8x16);
+	const uint8x16_t factorsTop_u_8x16 = vsubq_u8(constant_128_u_8x16, factorsBottom_u_8x16);
+
+	// horizontal interpolation without rounding: top = topLeft * factorLeft + topRight * factorRight, with range [0, 255 * 128], fitting into 16 bit
+
+	const uint16x8_t topLow_u_16x8 = vmlal_u8(vmull_u8(vget_low_u8(topLeft_u_8x16), vget_low_u8(factorsLeft_u_8x16)), vget_low_u8(topRight_u_8x16), vget_low_u8(factorsRight_u_8x16));
+	const uint16x8_t topHigh_u_16x8 = vmlal_u8(vmull_u8(vget_high_u8(topLeft_u_8x16), vget_high_u8(factorsLeft_u_8x16)), vget_high_u8(topRight_u_8x16), vget_high_u8(factorsRight_u_8x16));
+	const uint16x8_t bottomLow_u_16x8 = vmlal_u8(vmull_u8(vget_low_u8(bottomLeft_u_8x16), vget_low_u8(factorsLeft_u_8x16)), vget_low_u8(bottomRight_u_8x16), vget_low_u8(factorsRight_u_8x16));
+	const uint16x8_t bottomHigh_u_16x8 = vmlal_u8(vmull_u8(vget_high_u8(bottomLeft_u_8x16), vget_high_u8(factorsLeft_u_8x16)), vget_high_u8(bottomRight_u_8x16), vget_high_u8(factorsRight_u_8x16));
+
+	const uint16x8_t factorsTopLow_u_16x8 = vmovl_u8(vget_low_u8(factorsTop_u_8x16));
+	const uint16x8_t factorsTopHigh_u_16x8 = vmovl_u8(vget_high_u8(factorsTop_u_8x16));
+	const uint16x8_t factorsBottomLow_u_16x8 = vmovl_u8(vget_low_u8(factorsBottom_u_8x16));
+	const uint16x8_t factorsBottomHigh_u_16x8 = vmovl_u8(vget_high_u8(factorsBottom_u_8x16));
+
+	// vertical interpolation: top * factorTop + bottom * factorBottom, with range [0, 255 * 128 * 128], fitting into 32 bit
+
+	const uint32x4_t result0_u_32x4 = vmlal_u16(vmull_u16(vget_low_u16(topLow_u_16x8), vget_low_u16(factorsTopLow_u_16x8)), vget_low_u16(bottomLow_u_16x8), vget_low_u16(factorsBottomLow_u_16x8));
+	const uint32x4_t result1_u_32x4 = vmlal_u16(vmull_u16(vget_high_u16(topLow_u_16x8), vget_high_u16(factorsTopLow_u_16x8)), vget_high_u16(bottomLow_u_16x8), vget_high_u16(factorsBottomLow_u_16x8));
+	const uint32x4_t result2_u_32x4 = vmlal_u16(vmull_u16(vget_low_u16(topHigh_u_16x8), vget_low_u16(factorsTopHigh_u_16x8)), vget_low_u16(bottomHigh_u_16x8), vget_low_u16(factorsBottomHigh_u_16x8));
+	const uint32x4_t result3_u_32x4 = vmlal_u16(vmull_u16(vget_high_u16(topHigh_u_16x8), vget_high_u16(factorsTopHigh_u_16x8)), vget_high_u16(bottomHigh_u_16x8), vget_high_u16(factorsBottomHigh_u_16x8));
+
+	// rounded shift by 14 bits (division by 128*128): (result + 8192) / 16384
+
+	const uint16x8_t resultLow_u_16x8 = vcombine_u16(vrshrn_n_u32(result0_u_32x4, 14), vrshrn_n_u32(result1_u_32x4, 14));
+	const uint16x8_t resultHigh_u_16x8 = vcombine_u16(vrshrn_n_u32(result2_u_32x4, 14), vrshrn_n_u32(result3_u_32x4, 14));
+
+	return vcombine_u8(vmovn_u16(resultLow_u_16x8), vmovn_u16(resultHigh_u_16x8));
+}
+
 #endif // OCEAN_HARDWARE_NEON_VERSION
 
 template <unsigned int tChannels>
@@ -4575,6 +4743,163 @@ inline void FrameInterpolatorBilinear::homographies8BitPerChannelSubset(const ui
 	}
 }
 
+#if (defined(OCEAN_HARDWARE_SSE_VERSION) && OCEAN_HARDWARE_SSE_VERSION >= 41) || (defined(OCEAN_HARDWARE_NEON_VERSION) && OCEAN_HARDWARE_NEON_VERSION >= 10)
+
+template <unsigned int tChannels>
+OCEAN_FORCE_INLINE void FrameInterpolatorBilinear::interpolate4PixelsMask8BitPerChannel(const uint8_t* input, const unsigned int inputWidth, const unsigned int inputHeight, const unsigned int inputPaddingElements, const Vector2* inputPositions, uint8_t* output, uint8_t* outputMask, const uint8_t maskValue)
+{
+	static_assert(tChannels >= 1u && tChannels <= 4u, "Invalid channel number!");
+
+	ocean_assert(input != nullptr && inputPositions != nullptr);
+	ocean_assert(output != nullptr && outputMask != nullptr);
+	ocean_assert(inputWidth != 0u && inputHeight != 0u);
+
+	const unsigned int inputStrideElements = inputWidth * tChannels + inputPaddingElements;
+
+	const Scalar inputWidth_1 = Scalar(inputWidth - 1u);
+	const Scalar inputHeight_1 = Scalar(inputHeight - 1u);
+
+	// each of the four pixels is stored in an individual 32 bit slot, unused channels are zero
+
+	OCEAN_ALIGN_DATA(16) uint32_t topLeftPixels[4] = {0u, 0u, 0u, 0u};
+	OCEAN_ALIGN_DATA(16) uint32_t topRightPixels[4] = {0u, 0u, 0u, 0u};
+	OCEAN_ALIGN_DATA(16) uint32_t bottomLeftPixels[4] = {0u, 0u, 0u, 0u};
+	OCEAN_ALIGN_DATA(16) uint32_t bottomRightPixels[4] = {0u, 0u, 0u, 0u};
+
+	// the interpolation factors are replicated for each element of a slot
+
+	OCEAN_ALIGN_DATA(16) uint8_t factorsRight[16] = {0u};
+	OCEAN_ALIGN_DATA(16) uint8_t factorsBottom[16] = {0u};
+
+	bool validPixels[4];
+	unsigned int numberValidPixels = 0u;
+
+	for (unsigned int n = 0u; n < 4u; ++n)
+	{
+		const Vector2& inputPosition = inputPositions[n];
+
+		validPixels[n] = inputPosition.x() >= Scalar(0) && inputPosition.y() >= Scalar(0) && inputPosition.x() <= inputWidth_1 && inputPosition.y() <= inputHeight_1;
+
+		if (validPixels[n])
+		{
+			const unsigned int left = (unsigned int)(inputPosition.x());
+			const unsigned int top = (unsigned int)(inputPosition.y());
+			ocean_assert(left < inputWidth && top < inputHeight);
+
+			// same factors as in interpolatePixel8BitPerChannel()
+
+			const unsigned int txi = (unsigned int)((inputPosition.x() - Scalar(left)) * Scalar(128) + Scalar(0.5));
+			const unsigned int tyi = (unsigned int)((inputPosition.y() - Scalar(top)) * Scalar(128) + Scalar(0.5));
+			ocean_assert(txi <= 128u && tyi <= 128u);
+
+			const unsigned int rightOffset = left + 1u < inputWidth ? tChannels : 0u;
+			const unsigned int bottomOffset = top + 1u < inputHeight ? inputStrideElements : 0u;
+
+			const uint8_t* const topLeft = input + top * inputStrideElements + left * tChannels;
+
+			memcpy(topLeftPixels + n, topLeft, tChannels);
+			memcpy(topRightPixels + n, topLeft + rightOffset, tChannels);
+			memcpy(bottomLeftPixels + n, topLeft + bottomOffset, tChannels);
+			memcpy(bottomRightPixels + n, topLeft + bottomOffset + rightOffset, tChannels);
+
+			memset(factorsRight + n * 4u, int(txi), 4);
+			memset(factorsBottom + n * 4u, int(tyi), 4);
+
+			++numberValidPixels;
+		}
+	}
+
+	if (numberValidPixels == 0u)
+	{
+		memset(outputMask, 0xFF - maskValue, 4);
+		return;
+	}
+
+	OCEAN_ALIGN_DATA(16) uint8_t interpolatedPixels[16];
+
+#if defined(OCEAN_HARDWARE_SSE_VERSION) && OCEAN_HARDWARE_SSE_VERSION >= 41
+
+	_mm_store_si128((__m128i*)interpolatedPixels, interpolate16Elements8BitSSE(_mm_load_si128((const __m128i*)topLeftPixels), _mm_load_si128((const __m128i*)topRightPixels), _mm_load_si128((const __m128i*)bottomLeftPixels), _mm_load_si128((const __m128i*)bottomRightPixels), _mm_load_si128((const __m128i*)factorsRight), _mm_load_si128((const __m128i*)factorsBottom)));
+
+#else
+
+	vst1q_u8(interpolatedPixels, interpolate16Elements8BitNEON(vld1q_u8((const uint8_t*)topLeftPixels), vld1q_u8((const uint8_t*)topRightPixels), vld1q_u8((const uint8_t*)bottomLeftPixels), vld1q_u8((const uint8_t*)bottomRightPixels), vld1q_u8(factorsRight), vld1q_u8(factorsBottom)));
+
+#endif
+
+	if constexpr (tChannels == 4u)
+	{
+		if (numberValidPixels == 4u)
+		{
+			memcpy(output, interpolatedPixels, 16);
+			memset(outputMask, maskValue, 4);
+
+			return;
+		}
+	}
+
+	for (unsigned int n = 0u; n < 4u; ++n)
+	{
+		if (validPixels[n])
+		{
+			memcpy(output + n * tChannels, interpolatedPixels + n * 4u, tChannels);
+			outputMask[n] = maskValue;
+		}
+		else
+		{
+			outputMask[n] = 0xFF - maskValue;
+		}
+	}
+}
+
+#endif // (defined(OCEAN_HARDWARE_SSE_VERSION) && OCEAN_HARDWARE_SSE_VERSION >= 41) || (defined(OCEAN_HARDWARE_NEON_VERSION) && OCEAN_HARDWARE_NEON_VERSION >= 10)
+
+template <unsigned int tChannels>
+inline void FrameInterpolatorBilinear::interpolateRowMask8BitPerChannel(const uint8_t* input, const unsigned int inputWidth, const unsigned int inputHeight, const unsigned int inputPaddingElements, const Vector2* inputPositions, const unsigned int size, uint8_t* output, uint8_t* outputMask, const uint8_t maskValue)
+{
+	static_assert(tChannels >= 1u, "Invalid channel number!");
+
+	ocean_assert(input != nullptr && inputPositions != nullptr);
+	ocean_assert(output != nullptr && outputMask != nullptr);
+	ocean_assert(inputWidth != 0u && inputHeight != 0u);
+
+	unsigned int x = 0u;
+
+#if (defined(OCEAN_HARDWARE_SSE_VERSION) && OCEAN_HARDWARE_SSE_VERSION >= 41) || (defined(OCEAN_HARDWARE_NEON_VERSION) && OCEAN_HARDWARE_NEON_VERSION >= 10)
+
+	if constexpr (tChannels <= 4u)
+	{
+		while (x + 4u <= size)
+		{
+			interpolate4PixelsMask8BitPerChannel<tChannels>(input, inputWidth, inputHeight, inputPaddingElements, inputPositions + x, output + x * tChannels, outputMask + x, maskValue);
+
+			x += 4u;
+		}
+	}
+
+#endif // (defined(OCEAN_HARDWARE_SSE_VERSION) && OCEAN_HARDWARE_SSE_VERSION >= 41) || (defined(OCEAN_HARDWARE_NEON_VERSION) && OCEAN_HARDWARE_NEON_VERSION >= 10)
+
+	const Scalar inputWidth_1 = Scalar(inputWidth - 1u);
+	const Scalar inputHeight_1 = Scalar(inputHeight - 1u);
+
+	while (x < size)
+	{
+		const Vector2& inputPosition = inputPositions[x];
+
+		if (inputPosition.x() >= Scalar(0) && inputPosition.y() >= Scalar(0) && inputPosition.x() <= inputWidth_1 && inputPosition.y() <= inputHeight_1)
+		{
+			interpolatePixel8BitPerChannel<tChannels, PC_TOP_LEFT>(input, inputWidth, inputHeight, inputPaddingElements, inputPosition, output + x * tChannels);
+			outputMask[x] = maskValue;
+		}
+		else
+		{
+			outputMask[x] = 0xFF - maskValue;
+		}
+
+		++x;
+	}
+}
+
 template <unsigned int tChannels>
 void FrameInterpolatorBilinear::homographyMask8BitPerChannelSubset(const uint8_t* input, const unsigned int inputWidth, const unsigned int inputHeight, const SquareMatrix3* input_H_output, uint8_t* output, uint8_t* outputMask, const uint8_t maskValue, const unsigned int outputWidth, const unsigned int outputHeight, const unsigned int inputPaddingElements, const unsigned int outputPaddingElements, const unsigned int outputMaskPaddingElements, unsigned int firstOutputRow, const unsigned int numberOutputRows)
 {
@@ -4590,15 +4915,13 @@ void FrameInterpolatorBilinear::homographyMask8BitPerChannelSubset(const uint8_t
 	const unsigned int outputStrideElements = outputWidth * tChannels + outputPaddingElements;
 	const unsigned int outputMaskStrideElements = outputWidth + outputMaskPaddingElements;
 
-	const Scalar scalarInputWidth_1 = Scalar(inputWidth - 1u);
-	const Scalar scalarInputHeight_1 = Scalar(inputHeight - 1u);
-
-	using PixelType = typename DataType<uint8_t, tChannels>::Type;
+	Memory rowPositionsMemory = Memory::create<Vector2>(outputWidth);
+	Vector2* const rowPositions = rowPositionsMemory.data<Vector2>();
 
 	for (unsigned int y = firstOutputRow; y < firstOutputRow + numberOutputRows; ++y)
 	{
-		PixelType* outputData = (PixelType*)(output + y * outputStrideElements);
-		uint8_t* outputMaskData = outputMask + y * outputMaskStrideElements;
+		uint8_t* const outputData = output + y * outputStrideElements;
+		uint8_t* const outputMaskData = outputMask + y * outputMaskStrideElements;
 
 		/*
 		 * We can slightly optimize the 3x3 matrix multiplication:
@@ -4627,26 +4950,15 @@ void FrameInterpolatorBilinear::homographyMask8BitPerChannelSubset(const uint8_t
 
 		for (unsigned int x = 0; x < outputWidth; ++x)
 		{
-			const Vector2 inputPosition((X * Scalar(x) + c) / (X2 * Scalar(x) + constValue2));
+			rowPositions[x] = (X * Scalar(x) + c) / (X2 * Scalar(x) + constValue2);
 
 #ifdef OCEAN_DEBUG
 			const Vector2 debugInputPosition(*input_H_output * Vector2(Scalar(x), Scalar(y)));
-			ocean_assert(inputPosition.isEqual(debugInputPosition, Scalar(0.01)));
+			ocean_assert(rowPositions[x].isEqual(debugInputPosition, Scalar(0.01)));
 #endif
-
-			if (inputPosition.x() < Scalar(0) || inputPosition.x() > scalarInputWidth_1 || inputPosition.y() < Scalar(0) || inputPosition.y() > scalarInputHeight_1)
-			{
-				*outputMaskData = 0xFF - maskValue;
-			}
-			else
-			{
-				interpolatePixel8BitPerChannel<tChannels, PC_TOP_LEFT>(input, inputWidth, inputHeight, inputPaddingElements, inputPosition, (uint8_t*)(outputData));
-				*outputMaskData = maskValue;
-			}
-
-			outputData++;
-			outputMaskData++;
 		}
+
+		interpolateRowMask8BitPerChannel<tChannels>(input, inputWidth, inputHeight, inputPaddingElements, rowPositions, outputWidth, outputData, outputMaskData, maskValue);
 	}
 }
 
@@ -4789,13 +5101,10 @@ void FrameInterpolatorBilinear::homographyWithCameraMask8BitPerChannelSubset(con
 	const unsigned int outputStrideElements = outputCamera->width() * tChannels + outputPaddingElements;
 	const unsigned int outputMaskStrideElements = outputCamera->width() + outputMaskPaddingElements;
 
-	const Scalar scalarInputWidth_1 = Scalar(inputCamera->width() - 1u);
-	const Scalar scalarInputHeight_1 = Scalar(inputCamera->height() - 1u);
-
 	const SquareMatrix3 combinedMatrix(*normalizedHomography * outputCamera->invertedIntrinsic());
 
-	uint8_t* outputData = output + firstRow * outputStrideElements;
-	outputMask += firstRow * outputMaskStrideElements;
+	Memory rowPositionsMemory = Memory::create<Vector2>(outputCamera->width());
+	Vector2* const rowPositions = rowPositionsMemory.data<Vector2>();
 
 	constexpr bool useDistortionParameters = true;
 
@@ -4803,24 +5112,10 @@ void FrameInterpolatorBilinear::homographyWithCameraMask8BitPerChannelSubset(con
 	{
 		for (unsigned int x = 0; x < outputCamera->width(); ++x)
 		{
-			const Vector2 inputPosition(inputCamera->normalizedImagePoint2imagePoint<true>(combinedMatrix * outputCameraDistortionLookup->undistortedImagePoint(Vector2(Scalar(x), Scalar(y))), useDistortionParameters));
-
-			if (inputPosition.x() < Scalar(0) || inputPosition.x() > scalarInputWidth_1 || inputPosition.y() < Scalar(0) || inputPosition.y() > scalarInputHeight_1)
-			{
-				*outputMask = 0xFF - maskValue;
-			}
-			else
-			{
-				interpolatePixel8BitPerChannel<tChannels, PC_TOP_LEFT>(input, inputCamera->width(), inputCamera->height(), inputPaddingElements, inputPosition, outputData);
-				*outputMask = maskValue;
-			}
-
-			outputData += tChannels;
-			++outputMask;
+			rowPositions[x] = inputCamera->normalizedImagePoint2imagePoint<true>(combinedMatrix * outputCameraDistortionLookup->undistortedImagePoint(Vector2(Scalar(x), Scalar(y))), useDistortionParameters);
 		}
 
-		outputData += outputPaddingElements;
-		outputMask += outputMaskPaddingElements;
+		interpolateRowMask8BitPerChannel<tChannels>(input, inputCamera->width(), inputCamera->height(), inputPaddingElements, rowPositions, outputCamera->width(), output + y * outputStrideElements, outputMask + y * outputMaskStrideElements, maskValue);
 	}
 }
 
@@ -5362,8 +5657,6 @@ void FrameInterpolatorBilinear::lookupMask8BitPerChannelSubset(const uint8_t* in
 	ocean_assert(inputWidth != 0u && inputHeight != 0u);
 	ocean_assert(firstRow + numberRows <= input_LT_output->sizeY());
 
-	using PixelType = typename DataType<uint8_t, tChannels>::Type;
-
 	const unsigned int columns = (unsigned int)(input_LT_output->sizeX());
 
 	const unsigned int outputStrideElements = tChannels * columns + outputPaddingElements;
@@ -5371,9 +5664,6 @@ void FrameInterpolatorBilinear::lookupMask8BitPerChannelSubset(const uint8_t* in
 
 	static_assert(std::is_same<Vector2, LookupTable::Type>::value, "Invalid data type!");
 
-	const Scalar inputWidth1 = Scalar(inputWidth - 1u);
-	const Scalar inputHeight1 = Scalar(inputHeight - 1u);
-
 	Memory rowLookupMemory = Memory::create<Vector2>(columns);
 	Vector2* const rowLookupData = rowLookupMemory.data<Vector2>();
 
@@ -5381,28 +5671,15 @@ void FrameInterpolatorBilinear::lookupMask8BitPerChannelSubset(const uint8_t* in
 	{
 		input_LT_output->bilinearValues(y, rowLookupData);
 
-		PixelType* outputData = (PixelType*)(output + y * outputStrideElements);
-		uint8_t* outputMaskData = outputMask + y * outputMaskStrideElements;
-
-		for (unsigned int x = 0u; x < columns; ++x)
+		if (offset)
 		{
-			const Vector2& lookupValue = rowLookupData[x];
-
-			const Vector2 inputPosition = offset ? Vector2(Scalar(x) + lookupValue.x(), Scalar(y) + lookupValue.y()) : lookupValue;
-
-			if (inputPosition.x() >= 0 && inputPosition.y() >= 0 && inputPosition.x() <= inputWidth1 && inputPosition.y() <= inputHeight1)
+			for (unsigned int x = 0u; x < columns; ++x)
 			{
-				interpolatePixel8BitPerChannel<tChannels, PC_TOP_LEFT>(input, inputWidth, inputHeight, inputPaddingElements, inputPosition, (uint8_t*)(outputData));
-				*outputMaskData = maskValue;
-			}
-			else
-			{
-				*outputMaskData = 0xFFu - maskValue;
+				rowLookupData[x] += Vector2(Scalar(x), Scalar(y));
 			}
-
-			outputData++;
-			outputMaskData++;
 		}
+
+		interpolateRowMask8BitPerChannel<tChannels>(input, inputWidth, inputHeight, inputPaddingElements, rowLookupData, columns, output + y * outputStrideElements, outputMask + y * outputMaskStrideElements, maskValue);
 	}
 }
 
@@ -132,6 +132,7 @@ bool FramePyramid::replace(const FrameType& frameType, const bool reserveFirstLa
 	if (bytes > memory_.size())
 	{
 		memory_ = Memory(bytes, memoryAlignmentBytes_);
+		trackedMemory_.setBytes(memory_.size());
 	}
 
 	if (bytes != 0 && !memory_)
@@ -373,6 +374,7 @@ bool FramePyramid::replace8BitPerChannel11(const uint8_t* frame, const unsigned
 	if (bytes > memory_.size())
 	{
 		memory_ = Memory(bytes, memoryAlignmentBytes_);
+		trackedMemory_.setBytes(memory_.size());
 	}
 
 	if (bytes != 0 && !memory_)
@@ -455,6 +457,169 @@ bool FramePyramid::replace8BitPerChannel11(const uint8_t* frame, const unsigned
 	return true;
 }
 
+bool FramePyramid::replaceY8(const Frame& frame, const unsigned int layers, Worker* worker, const FrameConverter::Options& options)
+{
+	ocean_assert(frame.isValid());
+	ocean_assert(layers >= 1u);
+
+	if (!frame.isValid() || layers == 0u)
+	{
+		clear();
+
+		return false;
+	}
+
+	if (frame.pixelFormat() == FrameType::FORMAT_Y8)
+	{
+		return replace8BitPerChannel11(frame, layers, true /*copyFirstLayer*/, worker);
+	}
+
+	if (!FrameConverter::Comfort::isSupported(frame.frameType(), FrameType::FORMAT_Y8, frame.pixelOrigin(), options))
+	{
+		clear();
+
+		return false;
+	}
+
+	if (!replace(FrameType(frame.frameType(), FrameType::FORMAT_Y8), true /*reserveFirstLayerMemory*/, true /*forceOwner*/, layers))
+	{
+		clear();
+
+		return false;
+	}
+
+	ocean_assert(!layers_.empty());
+
+	if (layers_.size() == 1)
+	{
+		if (!FrameConverter::Comfort::convert(frame, FrameType::FORMAT_Y8, frame.pixelOrigin(), layers_.front(), true /*forceCopy*/, worker, options))
+		{
+			clear();
+
+			return false;
+		}
+
+		layers_.front().setTimestamp(frame.timestamp());
+
+		return true;
+	}
+
+	// the conversion and the second layer are determined in bands of rows, each band is downsampled while it is still in the cache
+
+	if (worker != nullptr)
+	{
+		worker->executeFunction(Worker::Function::createStatic(&FramePyramid::replaceY8Subset, &frame, &layers_[0], &layers_[1], &options, 0u, 0u), 0u, layers_[1].height(), 4u, 5u, 8u);
+	}
+	else
+	{
+		replaceY8Subset(&frame, &layers_[0], &layers_[1], &options, 0u, layers_[1].height());
+	}
+
+	for (size_t n = 2; n < layers_.size(); ++n)
+	{
+		const Frame& finerLayer = layers_[n - 1];
+		Frame& coarserLayer = layers_[n];
+
+		FrameShrinker::downsampleByTwo8BitPerChannel11(finerLayer.constdata<uint8_t>(), coarserLayer.data<uint8_t>(), finerLayer.width(), finerLayer.height(), 1u, finerLayer.paddingElements(), coarserLayer.paddingElements(), worker);
+	}
+
+	for (Frame& layer : layers_)
+	{
+		layer.setTimestamp(frame.timestamp());
+	}
+
+	return true;
+}
+
+bool FramePyramid::updateRegion(const PixelBoundingBox& boundingBox, const DownsamplingMode downsamplingMode, Worker* worker)
+{
+	ocean_assert(isValid());
+	ocean_assert(boundingBox.isValid());
+
+	if (!isValid() || !boundingBox.isValid())
+	{
+		return false;
+	}
+
+	const DownsamplingFunction function = downsamplingFunction(downsamplingMode, finestLayer().pixelFormat());
+
+	if (!function)
+	{
+		return false;
+	}
+
+	// the number of additional finer pixels (on each side of the two corresponding finer pixels) which are involved when determining one coarser pixel
+	const unsigned int filterMargin = downsamplingMode == DM_FILTER_14641 ? 2u : 0u;
+
+	PixelBoundingBox finerBoundingBox = boundingBox && PixelBoundingBox(0u, 0u, finestLayer().width() - 1u, finestLayer().height() - 1u);
+
+	if (!finerBoundingBox.isValid())
+	{
+		return false;
+	}
+
+	for (size_t layerIndex = 1; layerIndex < layers_.size(); ++layerIndex)
+	{
+		const Frame& finerLayer = layers_[layerIndex - 1];
+		Frame& coarserLayer = layers_[layerIndex];
+
+		ocean_assert(coarserLayer.isValid() && !coarserLayer.isReadOnly());
+		if (coarserLayer.isReadOnly())
+		{
+			return false;
+		}
+
+		// determining the coarser pixels which are affected by the changed finer pixels, the last finer column/row of a finer layer with odd size belongs to the last coarser column/row
+
+		const unsigned int coarserLeft = std::min(finerBoundingBox.left() >= filterMargin ? (finerBoundingBox.left() - filterMargin) / 2u : 0u, coarserLayer.width() - 1u);
+		const unsigned int coarserTop = std::min(finerBoundingBox.top() >= filterMargin ? (finerBoundingBox.top() - filterMargin) / 2u : 0u, coarserLayer.height() - 1u);
+
+		const unsigned int coarserRight = std::min((finerBoundingBox.right() + filterMargin) / 2u, coarserLayer.width() - 1u);
+		const unsigned int coarserBottom = std::min((finerBoundingBox.bottom() + filterMargin) / 2u, coarserLayer.height() - 1u);
+
+		// determining the finer window which is needed to determine the affected coarser pixels,
+		// the window starts at an even location, and ends at the finer layer's border whenever it reaches the border so that the border handling is identical
+
+		const unsigned int windowLeft = coarserLeft * 2u >= filterMargin ? coarserLeft * 2u - filterMargin : 0u;
+		const unsigned int windowTop = coarserTop * 2u >= filterMargin ? coarserTop * 2u - filterMargin : 0u;
+		ocean_assert(windowLeft % 2u == 0u && windowTop % 2u == 0u);
+
+		const bool windowReachesRightBorder = coarserRight + 1u == coarserLayer.width() || coarserRight * 2u + 1u + filterMargin >= finerLayer.width() - 1u;
+		const bool windowReachesBottomBorder = coarserBottom + 1u == coarserLayer.height() || coarserBottom * 2u + 1u + filterMargin >= finerLayer.height() - 1u;
+
+		const unsigned int windowRightEnd = windowReachesRightBorder ? finerLayer.width() : coarserRight * 2u + 2u + filterMargin;
+		const unsigned int windowBottomEnd = windowReachesBottomBorder ? finerLayer.height() : coarserBottom * 2u + 2u + filterMargin;
+
+		const unsigned int coarserWindowWidth = windowReachesRightBorder ? coarserLayer.width() - windowLeft / 2u : (windowRightEnd - windowLeft) / 2u;
+		const unsigned int coarserWindowHeight = windowReachesBottomBorder ? coarserLayer.height() - windowTop / 2u : (windowBottomEnd - windowTop) / 2u;
+
+		const Frame finerWindow = finerLayer.subFrame(windowLeft, windowTop, windowRightEnd - windowLeft, windowBottomEnd - windowTop);
+		ocean_assert(finerWindow.isValid());
+
+		Frame coarserWindow(FrameType(coarserLayer, coarserWindowWidth, coarserWindowHeight));
+
+		if (!function(finerWindow, coarserWindow, worker))
+		{
+			return false;
+		}
+
+		ocean_assert(coarserWindow.width() == coarserWindowWidth && coarserWindow.height() == coarserWindowHeight);
+
+		const unsigned int coarserWidth = coarserRight - coarserLeft + 1u;
+		const unsigned int coarserHeight = coarserBottom - coarserTop + 1u;
+
+		if (!coarserLayer.copy(int(coarserLeft), int(coarserTop), coarserWindow.subFrame(coarserLeft - windowLeft / 2u, coarserTop - windowTop / 2u, coarserWidth, coarserHeight), false /*copyTimestamp*/))
+		{
+			ocean_assert(false && "This should never happen!");
+			return false;
+		}
+
+		finerBoundingBox = PixelBoundingBox(coarserLeft, coarserTop, coarserRight, coarserBottom);
+	}
+
+	return true;
+}
+
 void FramePyramid::reduceLayers(const size_t layers)
 {
 	ocean_assert(layers <= layers_.size());
@@ -830,11 +995,19 @@ FramePyramid& FramePyramid::operator=(FramePyramid&& right) noexcept
 
 		layers_ = std::move(right.layers_);
 		memory_ = std::move(right.memory_);
+		trackedMemory_ = std::move(right.trackedMemory_);
 	}
 
 	return *this;
 }
 
+MemoryTracker::CategoryId FramePyramid::memoryCategoryId()
+{
+	static const MemoryTracker::CategoryId categoryId = MemoryTracker::registerCategory("FramePyramid");
+
+	return categoryId;
+}
+
 size_t FramePyramid::calculateMemorySize(const unsigned int width, const unsigned int height, const FrameType::PixelFormat pixelFormat, const unsigned int layers, const bool includeFirstLayer, unsigned int* totalLayers)
 {
 	ocean_assert(width <= 65535u && height <= 65535u);
@@ -917,6 +1090,49 @@ bool FramePyramid::downsampleByTwo14641(const Frame& finerLayer, Frame& coarserL
 	return CV::FrameShrinker::downsampleByTwo14641(finerLayer, coarserLayer, worker);
 }
 
+void FramePyramid::replaceY8Subset(const Frame* frame, Frame* finestLayer, Frame* secondLayer, const FrameConverter::Options* options, const unsigned int firstSecondLayerRow, const unsigned int numberSecondLayerRows)
+{
+	ocean_assert(frame != nullptr && frame->isValid());
+	ocean_assert(finestLayer != nullptr && finestLayer->isValid() && finestLayer->pixelFormat() == FrameType::FORMAT_Y8);
+	ocean_assert(secondLayer != nullptr && secondLayer->isValid() && secondLayer->pixelFormat() == FrameType::FORMAT_Y8);
+	ocean_assert(options != nullptr);
+
+	ocean_assert(finestLayer->width() / 2u == secondLayer->width() && finestLayer->height() / 2u == secondLayer->height());
+	ocean_assert(firstSecondLayerRow + numberSecondLayerRows <= secondLayer->height());
+
+	// the number of rows of the second layer handled in one band, small enough so that the converted rows of the finest layer are still in the cache when downsampling them
+	constexpr unsigned int bandRows = 8u;
+
+	const unsigned int width = finestLayer->width();
+	const unsigned int height = finestLayer->height();
+
+	const unsigned int endSecondLayerRow = firstSecondLayerRow + numberSecondLayerRows;
+
+	for (unsigned int bandFirstRow = firstSecondLayerRow; bandFirstRow < endSecondLayerRow; bandFirstRow += bandRows)
+	{
+		const unsigned int bandNumberRows = std::min(bandRows, endSecondLayerRow - bandFirstRow);
+
+		const unsigned int finestFirstRow = bandFirstRow * 2u;
+		unsigned int finestNumberRows = bandNumberRows * 2u;
+
+		if (bandFirstRow + bandNumberRows == secondLayer->height())
+		{
+			// the last band covers all remaining rows of the finest layer, e.g., the additional row of a finest layer with odd height
+			finestNumberRows = height - finestFirstRow;
+		}
+
+		const Frame sourceBand = frame->subFrame(0u, finestFirstRow, width, finestNumberRows);
+		ocean_assert(sourceBand.isValid());
+
+		Frame targetBand(FrameType(sourceBand.frameType(), FrameType::FORMAT_Y8), finestLayer->row<uint8_t>(finestFirstRow), Frame::CM_USE_KEEP_LAYOUT, finestLayer->paddingElements());
+
+		const bool result = FrameConverter::Comfort::convert(sourceBand, FrameType::FORMAT_Y8, frame->pixelOrigin(), targetBand, true /*forceCopy*/, nullptr, *options);
+		ocean_assert_and_suppress_unused(result && targetBand.constdata<uint8_t>() == finestLayer->constrow<uint8_t>(finestFirstRow), result);
+
+		FrameShrinker::downsampleByTwo8BitPerChannel11(targetBand.constdata<uint8_t>(), secondLayer->row<uint8_t>(bandFirstRow), width, finestNumberRows, 1u, targetBand.paddingElements(), secondLayer->paddingElements(), nullptr);
+	}
+}
+
 FramePyramid::DownsamplingFunction FramePyramid::downsamplingFunction(const CV::FramePyramid::DownsamplingMode downsamplingMode, const FrameType::PixelFormat pixelFormat)
 {
 	ocean_assert(FrameType::dataType(pixelFormat) == FrameType::DT_UNSIGNED_INTEGER_8);
@@ -12,8 +12,11 @@
 
 #include "ocean/base/Frame.h"
 #include "ocean/base/Memory.h"
+#include "ocean/base/MemoryTracker.h"
 #include "ocean/base/Worker.h"
 
+#include "ocean/cv/FrameConverter.h"
+#include "ocean/cv/PixelBoundingBox.h"
 #include "ocean/cv/FrameShrinker.h"
 #include "ocean/cv/FrameShrinkerAlpha.h"
 
@@ -445,6 +448,21 @@ class OCEAN_CV_EXPORT FramePyramid
 		 */
 		inline bool replace8BitPerChannel11(const Frame& frame, const unsigned int layers, const bool copyFirstLayer, Worker* worker);
 
+		/**
+		 * Replaces this frame pyramid by a Y8 pyramid created from a frame with arbitrary pixel format (e.g., a camera frame with pixel format FORMAT_Y_UV12, FORMAT_Y_VU12, FORMAT_YUYV16, or FORMAT_RGB24) applying a 1-1 downsampling.
+		 * The conversion to Y8 and the creation of the second pyramid layer are fused: the frame is converted in bands of rows, and each band is downsampled while it is still in the cache.<br>
+		 * Thus, the finest layer does not need to be read from memory again, which is the case when converting the frame first and creating the pyramid afterwards.<br>
+		 * The resulting pyramid is identical to a pyramid created with replace8BitPerChannel11() from the converted Y8 frame.<br>
+		 * The function will re-use the existing pyramid's memory if possible.
+		 * @param frame The frame for which the pyramid will be created, must be valid and convertible to FORMAT_Y8
+		 * @param layers The number of pyramid layers to be created, with range [1, infinity), AS_MANY_LAYERS_AS_POSSIBLE to create as many layers as possible
+		 * @param worker Optional worker object to distribute the computation
+		 * @param options The options which will be used for the conversion to Y8
+		 * @return True, if the frame pyramid was replaced
+		 * @see replace8BitPerChannel11(), FrameConverter::Comfort::convert().
+		 */
+		bool replaceY8(const Frame& frame, const unsigned int layers, Worker* worker, const FrameConverter::Options& options = FrameConverter::Options());
+
 		/**
 		 * Replaces this frame pyramid with a new pyramid defined by the frame type of the finest layer.
 		 * The image content of the replaced frame pyramid will be uninitialized.
@@ -455,6 +473,19 @@ class OCEAN_CV_EXPORT FramePyramid
 		 */
 		inline bool replace(const FrameType& frameType, const bool forceOwner, const unsigned int layers);
 
+		/**
+		 * Updates the coarser pyramid layers after the image content of the finest layer has changed within a sub-region.
+		 * Instead of re-creating the entire pyramid, only the footprint of the changed sub-region is determined in each coarser layer.<br>
+		 * The resulting pyramid is identical to a pyramid which is entirely re-created with the same downsampling mode.<br>
+		 * The pyramid must have been created with the given downsampling mode, and the coarser pyramid layers must be writable.
+		 * @param boundingBox The bounding box of the changed sub-region in the finest layer, will be clamped to the finest layer, must be valid
+		 * @param downsamplingMode The downsampling mode which has been used to create the pyramid
+		 * @param worker Optional worker object to distribute the computation
+		 * @return True, if succeeded
+		 * @see replace().
+		 */
+		bool updateRegion(const PixelBoundingBox& boundingBox, const DownsamplingMode downsamplingMode, Worker* worker = nullptr);
+
 		/**
 		 * Reduces the number of pyramid layers.
 		 * @param layers The number of pyramid layers, with range [0, layers()]
@@ -647,6 +678,14 @@ class OCEAN_CV_EXPORT FramePyramid
 		 */
 		static size_t calculateMemorySize(const unsigned int width, const unsigned int height, const FrameType::PixelFormat pixelFormat, const unsigned int layers, const bool includeFirstLayer, unsigned int* totalLayers = nullptr);
 
+		/**
+		 * Returns the id of the memory category to which the memory of all pyramids is reported.
+		 * Layers which own their memory individually are reported as Frame memory.
+		 * @return The id of the category
+		 * @see MemoryTracker.
+		 */
+		static MemoryTracker::CategoryId memoryCategoryId();
+
 		/**
 		 * Deleted function to prevent confusion between Frame and FrameType.
 		 * @param frame The potential frame to be used
@@ -690,6 +729,17 @@ class OCEAN_CV_EXPORT FramePyramid
 		 */
 		static bool downsampleByTwo14641(const Frame& finerLayer, Frame& coarserLayer, Worker* worker);
 
+		/**
+		 * Converts a subset of a frame to Y8 and downsamples the converted rows with 1-1 filter directly afterwards.
+		 * @param frame The frame to be converted, must be valid
+		 * @param finestLayer The finest pyramid layer receiving the converted rows, with pixel format FORMAT_Y8, must be valid
+		 * @param secondLayer The second pyramid layer receiving the downsampled rows, with pixel format FORMAT_Y8, must be valid
+		 * @param options The options to be used for the conversion, must be valid
+		 * @param firstSecondLayerRow The first row of the second layer to be handled, with range [0, secondLayer->height() - 1]
+		 * @param numberSecondLayerRows The number of rows of the second layer to be handled, with range [1, secondLayer->height() - firstSecondLayerRow]
+		 */
+		static void replaceY8Subset(const Frame* frame, Frame* finestLayer, Frame* secondLayer, const FrameConverter::Options* options, const unsigned int firstSecondLayerRow, const unsigned int numberSecondLayerRows);
+
 		/**
 		 * Returns the downsampling function for a specified downsampling mode.
 		 * @param downsamplingMode The downsampling mode for which the function will be returned
@@ -715,6 +765,9 @@ class OCEAN_CV_EXPORT FramePyramid
 
 		/// Optional memory which may be used by at least one pyramid layer.
 		Memory memory_;
+
+		/// The accounting of the pyramid's memory.
+		MemoryTracker::TrackedBytes trackedMemory_ = MemoryTracker::TrackedBytes(memoryCategoryId());
 };
 
 inline FramePyramid::FramePyramid()
@@ -896,6 +949,7 @@ inline void FramePyramid::clear()
 {
 	layers_.clear();
 	memory_.free();
+	trackedMemory_.setBytes(0);
 }
 
 inline const Frame& FramePyramid::operator[](const unsigned int layer) const
@@ -0,0 +1,191 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "ocean/cv/FramePyramidCache.h"
+#include "ocean/cv/FrameConverter.h"
+
+namespace Ocean
+{
+
+namespace CV
+{
+
+FramePyramidCache::FramePyramidCache(const size_t capacity) :
+	capacity_(std::max(capacity, size_t(1)))
+{
+	ocean_assert(capacity >= 1);
+
+	entries_.reserve(capacity_);
+}
+
+FramePyramidCache::SharedFramePyramid FramePyramidCache::pyramid(const Frame& frame, const unsigned int layers, Worker* worker)
+{
+	ocean_assert(frame.isValid());
+	ocean_assert(layers >= 1u);
+
+	if (!frame.isValid() || layers == 0u)
+	{
+		return nullptr;
+	}
+
+	if (!frame.timestamp().isValid())
+	{
+		return createPyramid(frame, layers, worker);
+	}
+
+	// the pyramid is created outside of the lock, concurrent requests for the same frame wait for the future of the pyramid instead of creating an own pyramid
+
+	std::promise<SharedFramePyramid> framePyramidPromise;
+	SharedFramePyramidFuture framePyramidFuture;
+
+	uint64_t createdEntryId = 0ull;
+	unsigned int createdLayers = 0u;
+
+	TemporaryScopedLock temporaryScopedLock(lock_);
+
+		preferredLayers_ = std::max(preferredLayers_, layers);
+
+		Entry* existingEntry = nullptr;
+
+		for (Entry& entry : entries_)
+		{
+			if (entry.isFrame(frame.timestamp(), frame.width(), frame.height()))
+			{
+				existingEntry = &entry;
+				break;
+			}
+		}
+
+		if (existingEntry != nullptr && existingEntry->requestedLayers_ >= layers)
+		{
+			framePyramidFuture = existingEntry->framePyramidFuture_;
+		}
+		else
+		{
+			framePyramidFuture = framePyramidPromise.get_future().share();
+
+			createdEntryId = nextEntryId_++;
+			createdLayers = preferredLayers_;
+
+			if (existingEntry != nullptr)
+			{
+				// another tracker needs more layers, the pyramid is replaced so that trackers using the old pyramid are not affected
+
+				existingEntry->id_ = createdEntryId;
+				existingEntry->requestedLayers_ = createdLayers;
+				existingEntry->framePyramidFuture_ = framePyramidFuture;
+			}
+			else
+			{
+				if (entries_.size() >= capacity_)
+				{
+					entries_.erase(entries_.begin());
+				}
+
+				Entry entry;
+				entry.id_ = createdEntryId;
+				entry.timestamp_ = frame.timestamp();
+				entry.width_ = frame.width();
+				entry.height_ = frame.height();
+				entry.requestedLayers_ = createdLayers;
+				entry.framePyramidFuture_ = framePyramidFuture;
+
+				entries_.emplace_back(std::move(entry));
+			}
+		}
+
+	temporaryScopedLock.release();
+
+	if (createdEntryId == 0ull)
+	{
+		// the pyramid has been created (or is currently created) by another request
+
+		return framePyramidFuture.get();
+	}
+
+	SharedFramePyramid framePyramid = createPyramid(frame, createdLayers, worker);
+
+	framePyramidPromise.set_value(framePyramid);
+
+	if (!framePyramid)
+	{
+		removeEntry(createdEntryId);
+	}
+
+	return framePyramid;
+}
+
+FramePyramidCache::SharedFramePyramid FramePyramidCache::existingPyramid(const Timestamp& timestamp, const unsigned int layers) const
+{
+	ocean_assert(timestamp.isValid());
+
+	const ScopedLock scopedLock(lock_);
+
+	for (const Entry& entry : entries_)
+	{
+		if (entry.timestamp_ == timestamp && entry.requestedLayers_ >= layers)
+		{
+			if (entry.framePyramidFuture_.wait_for(std::chrono::seconds(0)) == std::future_status::ready)
+			{
+				return entry.framePyramidFuture_.get();
+			}
+		}
+	}
+
+	return nullptr;
+}
+
+void FramePyramidCache::clear()
+{
+	const ScopedLock scopedLock(lock_);
+
+	entries_.clear();
+	preferredLayers_ = 0u;
+}
+
+void FramePyramidCache::removeEntry(const uint64_t id)
+{
+	const ScopedLock scopedLock(lock_);
+
+	for (Entries::iterator iEntry = entries_.begin(); iEntry != entries_.end(); ++iEntry)
+	{
+		if (iEntry->id_ == id)
+		{
+			entries_.erase(iEntry);
+			return;
+		}
+	}
+}
+
+FramePyramidCache::SharedFramePyramid FramePyramidCache::createPyramid(const Frame& frame, const unsigned int layers, Worker* worker)
+{
+	ocean_assert(frame.isValid() && layers >= 1u);
+
+	// the pyramid owns the finest layer, as the pyramid may live longer than the given frame
+
+	Frame yFrame;
+	if (!FrameConverter::Comfort::convert(frame, FrameType::FORMAT_Y8, FrameType::ORIGIN_UPPER_LEFT, yFrame, FrameConverter::CP_ALWAYS_COPY, worker))
+	{
+		ocean_assert(false && "Pixel format not supported!");
+		return nullptr;
+	}
+
+	yFrame.setTimestamp(frame.timestamp());
+
+	std::shared_ptr<FramePyramid> framePyramid = std::make_shared<FramePyramid>(FramePyramid::DM_FILTER_11, std::move(yFrame), layers, worker);
+
+	if (!framePyramid->isValid())
+	{
+		return nullptr;
+	}
+
+	return framePyramid;
+}
+
+}
+
+}
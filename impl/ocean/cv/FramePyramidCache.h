@@ -0,0 +1,241 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#ifndef META_OCEAN_CV_FRAME_PYRAMID_CACHE_H
+#define META_OCEAN_CV_FRAME_PYRAMID_CACHE_H
+
+#include "ocean/cv/CV.h"
+#include "ocean/cv/FramePyramid.h"
+
+#include "ocean/base/Frame.h"
+#include "ocean/base/Lock.h"
+#include "ocean/base/Timestamp.h"
+#include "ocean/base/Worker.h"
+
+#include <future>
+#include <memory>
+
+namespace Ocean
+{
+
+namespace CV
+{
+
+// Forward declaration.
+class FramePyramidCache;
+
+/**
+ * Definition of a shared pointer holding a frame pyramid cache.
+ * @see FramePyramidCache.
+ * @ingroup cv
+ */
+using SharedFramePyramidCache = std::shared_ptr<FramePyramidCache>;
+
+/**
+ * This class implements a cache for Y8 frame pyramids which can be shared by several trackers processing the same camera stream.
+ * Trackers running on the same camera frame request the pyramid of the frame from the cache instead of converting the frame and creating an own pyramid.<br>
+ * The first request for a frame converts the frame to FORMAT_Y8 and creates the pyramid, all further requests for the same frame (identified by the frame's timestamp) receive the same pyramid.<br>
+ * The cache remembers the largest number of layers which has been requested so far, so that the deepest pyramid is created only once per frame after the first frame.
+ *
+ * Pyramids are handed out as shared pointers to constant pyramids, a pyramid stays valid as long as a tracker holds the pointer, even if the cache has dropped the pyramid already.<br>
+ * Pyramids are identified by the timestamp and the resolution of the frame, so that trackers processing a downsampled version of the frame do not collide with trackers processing the original frame.<br>
+ * One cache should be used for each camera stream, as frames of different cameras can have identical timestamps.<br>
+ * The cache is thread-safe, pyramids are created outside of the cache's lock.<br>
+ * Concurrent requests for a frame whose pyramid is currently created wait for the pyramid, requests for other frames are not blocked.
+ *
+ * Here is a tutorial how to use this class:
+ * @code
+ * // the cache of one camera, shared by all trackers of this camera
+ * FramePyramidCache framePyramidCache;
+ *
+ * // within a tracker
+ * const FramePyramidCache::SharedFramePyramid yFramePyramid = framePyramidCache.pyramid(cameraFrame, 5u, worker);
+ *
+ * if (yFramePyramid)
+ * {
+ *     // the pyramid has at least 5 layers (if the frame resolution allows)
+ *     const Frame& yFrame = yFramePyramid->finestLayer();
+ *     ...
+ * }
+ * @endcode
+ * @see FramePyramid.
+ * @ingroup cv
+ */
+class OCEAN_CV_EXPORT FramePyramidCache
+{
+	public:
+
+		/**
+		 * Definition of a shared pointer holding a constant frame pyramid.
+		 */
+		using SharedFramePyramid = std::shared_ptr<const FramePyramid>;
+
+	protected:
+
+		/**
+		 * Definition of a future of a pyramid which is created by the first request of a frame.
+		 */
+		using SharedFramePyramidFuture = std::shared_future<SharedFramePyramid>;
+
+		/**
+		 * This class holds one cached pyramid.
+		 */
+		class Entry
+		{
+			public:
+
+				/**
+				 * Returns whether this entry holds the pyramid of a specific frame.
+				 * @param timestamp The timestamp of the frame
+				 * @param width The width of the frame, in pixel
+				 * @param height The height of the frame, in pixel
+				 * @return True, if so
+				 */
+				inline bool isFrame(const Timestamp& timestamp, const unsigned int width, const unsigned int height) const;
+
+			public:
+
+				/// The unique id of the entry, changes whenever the pyramid of the entry is replaced.
+				uint64_t id_ = 0ull;
+
+				/// The timestamp of the frame of the pyramid.
+				Timestamp timestamp_ = Timestamp(false);
+
+				/// The width of the frame of the pyramid, in pixel.
+				unsigned int width_ = 0u;
+
+				/// The height of the frame of the pyramid, in pixel.
+				unsigned int height_ = 0u;
+
+				/// The number of layers which have been requested when the pyramid was created, the pyramid can have less layers if the frame resolution does not allow more layers.
+				unsigned int requestedLayers_ = 0u;
+
+				/// The future of the pyramid, the pyramid is available once the creating request has finished.
+				SharedFramePyramidFuture framePyramidFuture_;
+		};
+
+		/**
+		 * Definition of a vector holding entries, the most recent entry is the last entry.
+		 */
+		using Entries = std::vector<Entry>;
+
+	public:
+
+		/**
+		 * Creates a new cache.
+		 * @param capacity The number of frames for which pyramids are cached, with range [1, infinity)
+		 */
+		explicit FramePyramidCache(const size_t capacity = 2);
+
+		/**
+		 * Returns the pyramid of a frame, the pyramid is created if the cache does not yet contain a pyramid with enough layers for the frame.
+		 * The pyramid is created with a 1-1 downsampling, as FramePyramid::replace8BitPerChannel11() does.<br>
+		 * Frames without valid timestamp are not cached, a new pyramid is created for each request.
+		 * @param frame The frame for which the pyramid will be returned, can have any pixel format which can be converted to FORMAT_Y8, must be valid
+		 * @param layers The minimal number of pyramid layers, with range [1, infinity), AS_MANY_LAYERS_AS_POSSIBLE to create as many layers as possible
+		 * @param worker Optional worker to distribute the computation
+		 * @return The frame's pyramid with pixel format FORMAT_Y8 and pixel origin ORIGIN_UPPER_LEFT, nullptr if the pyramid could not be created
+		 */
+		SharedFramePyramid pyramid(const Frame& frame, const unsigned int layers, Worker* worker = nullptr);
+
+		/**
+		 * Returns the cached pyramid of a frame with specific timestamp.
+		 * This function does not wait for pyramids which are currently created.
+		 * @param timestamp The timestamp of the frame, must be valid
+		 * @param layers The minimal number of pyramid layers the pyramid must have been created with, with range [1, infinity)
+		 * @return The cached pyramid, nullptr if the cache does not contain a finished pyramid for the timestamp with enough layers
+		 */
+		SharedFramePyramid existingPyramid(const Timestamp& timestamp, const unsigned int layers = 1u) const;
+
+		/**
+		 * Returns the largest number of layers which has been requested so far.
+		 * @return The number of layers which will be created for the next frame
+		 */
+		inline unsigned int preferredLayers() const;
+
+		/**
+		 * Returns the number of pyramids the cache currently holds.
+		 * @return The number of cached pyramids, with range [0, capacity]
+		 */
+		inline size_t size() const;
+
+		/**
+		 * Removes all cached pyramids and resets the preferred number of layers.
+		 * Pyramids which are still used by trackers stay valid.
+		 */
+		void clear();
+
+	protected:
+
+		/**
+		 * Disabled copy constructor.
+		 */
+		FramePyramidCache(const FramePyramidCache&) = delete;
+
+		/**
+		 * Disabled copy operator.
+		 * @return Reference to this object
+		 */
+		FramePyramidCache& operator=(const FramePyramidCache&) = delete;
+
+		/**
+		 * Removes an entry from the cache, if the entry has not been replaced in the meantime.
+		 * @param id The id of the entry to remove
+		 */
+		void removeEntry(const uint64_t id);
+
+		/**
+		 * Creates a new pyramid for a frame.
+		 * @param frame The frame for which the pyramid will be created, must be valid
+		 * @param layers The number of pyramid layers, with range [1, infinity)
+		 * @param worker Optional worker to distribute the computation
+		 * @return The new pyramid, nullptr if the pyramid could not be created
+		 */
+		static SharedFramePyramid createPyramid(const Frame& frame, const unsigned int layers, Worker* worker);
+
+	protected:
+
+		/// The cached pyramids, the most recent pyramid is the last entry.
+		Entries entries_;
+
+		/// The number of frames for which pyramids are cached.
+		size_t capacity_ = 0;
+
+		/// The largest number of layers which has been requested so far.
+		unsigned int preferredLayers_ = 0u;
+
+		/// The id of the next entry.
+		uint64_t nextEntryId_ = 1ull;
+
+		/// The lock of the cache.
+		mutable Lock lock_;
+};
+
+inline bool FramePyramidCache::Entry::isFrame(const Timestamp& timestamp, const unsigned int width, const unsigned int height) const
+{
+	return timestamp_ == timestamp && width_ == width && height_ == height;
+}
+
+inline unsigned int FramePyramidCache::preferredLayers() const
+{
+	const ScopedLock scopedLock(lock_);
+
+	return preferredLayers_;
+}
+
+inline size_t FramePyramidCache::size() const
+{
+	const ScopedLock scopedLock(lock_);
+
+	return entries_.size();
+}
+
+}
+
+}
+
+#endif // META_OCEAN_CV_FRAME_PYRAMID_CACHE_H
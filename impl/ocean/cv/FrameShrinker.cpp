@@ -13,12 +13,62 @@
 
 #include "ocean/math/Numeric.h"
 
+#if defined(OCEAN_CV_DISPATCH_X86)
+	#include <immintrin.h>
+#endif
+
 namespace Ocean
 {
 
 namespace CV
 {
 
+FrameShrinker::AreaWeights::AreaWeights(const unsigned int sourceSize, const unsigned int targetSize)
+{
+	ocean_assert(sourceSize >= 1u);
+	ocean_assert(targetSize >= 1u && targetSize <= sourceSize);
+
+	firstSourceIndices_.reserve(targetSize);
+	weightOffsets_.reserve(targetSize + 1u);
+	weights_.reserve(sourceSize + targetSize);
+
+	// all locations are defined in units of 1/targetSize source pixels:
+	// target pixel t covers [t * sourceSize, (t + 1) * sourceSize), source pixel s covers [s * targetSize, (s + 1) * targetSize)
+
+	for (unsigned int targetIndex = 0u; targetIndex < targetSize; ++targetIndex)
+	{
+		const uint64_t targetStart = uint64_t(targetIndex) * uint64_t(sourceSize);
+		const uint64_t targetEnd = targetStart + uint64_t(sourceSize);
+
+		const unsigned int firstSourceIndex = (unsigned int)(targetStart / uint64_t(targetSize));
+		const unsigned int endSourceIndex = (unsigned int)((targetEnd + uint64_t(targetSize) - 1ull) / uint64_t(targetSize));
+		ocean_assert(firstSourceIndex < endSourceIndex && endSourceIndex <= sourceSize);
+
+		firstSourceIndices_.emplace_back(firstSourceIndex);
+		weightOffsets_.emplace_back(Index32(weights_.size()));
+
+		// we round the accumulated overlap (instead of the individual overlaps) so that the weights sum up to 2^areaWeightBits_ exactly
+
+		unsigned int previousAccumulatedWeight = 0u;
+
+		for (unsigned int sourceIndex = firstSourceIndex; sourceIndex < endSourceIndex; ++sourceIndex)
+		{
+			const uint64_t overlapEnd = std::min(uint64_t(sourceIndex + 1u) * uint64_t(targetSize), targetEnd) - targetStart;
+
+			const unsigned int accumulatedWeight = (unsigned int)(((overlapEnd << areaWeightBits_) + uint64_t(sourceSize / 2u)) / uint64_t(sourceSize));
+			ocean_assert(accumulatedWeight >= previousAccumulatedWeight);
+
+			weights_.emplace_back(uint16_t(accumulatedWeight - previousAccumulatedWeight));
+
+			previousAccumulatedWeight = accumulatedWeight;
+		}
+
+		ocean_assert(previousAccumulatedWeight == 1u << areaWeightBits_);
+	}
+
+	weightOffsets_.emplace_back(Index32(weights_.size()));
+}
+
 bool FrameShrinker::downsampleByTwo11(const Frame& source, Frame& target, Worker* worker)
 {
 	ocean_assert(source.isValid() && &source != &target);
@@ -135,6 +185,70 @@ bool FrameShrinker::downsampleByTwo14641(const Frame& source, Frame& target, Wor
 	return false;
 }
 
+bool FrameShrinker::downsampleByArea(const Frame& source, Frame& target, const unsigned int targetWidth, const unsigned int targetHeight, Worker* worker)
+{
+	ocean_assert(source.isValid() && &source != &target);
+
+	if (!source.isValid() || targetWidth == 0u || targetHeight == 0u || targetWidth > source.width() || targetHeight > source.height())
+	{
+		return false;
+	}
+
+	if (source.dataType() == FrameType::DT_UNSIGNED_INTEGER_8)
+	{
+		const unsigned int widthMultiple = FrameType::widthMultiple(source.pixelFormat());
+		const unsigned int heightMultiple = FrameType::heightMultiple(source.pixelFormat());
+
+		if (targetWidth % widthMultiple == 0u && targetHeight % heightMultiple == 0u)
+		{
+			if (!target.set(FrameType(source, targetWidth, targetHeight), false /*forceOwner*/, true /*forceWritable*/))
+			{
+				ocean_assert(false && "This should never happen!");
+				return false;
+			}
+
+			for (unsigned int planeIndex = 0u; planeIndex < source.numberPlanes(); ++planeIndex)
+			{
+				downsampleByArea8BitPerChannel(source.constdata<uint8_t>(planeIndex), target.data<uint8_t>(planeIndex), source.planeWidth(planeIndex), source.planeHeight(planeIndex), target.planeWidth(planeIndex), target.planeHeight(planeIndex), source.planeChannels(planeIndex), source.paddingElements(planeIndex), target.paddingElements(planeIndex), worker);
+			}
+
+			target.setTimestamp(source.timestamp());
+			target.setRelativeTimestamp(source.relativeTimestamp());
+
+			return true;
+		}
+	}
+
+	ocean_assert(false && "FrameShrinker: Invalid frame!");
+	return false;
+}
+
+void FrameShrinker::downsampleByArea8BitPerChannel(const uint8_t* const source, uint8_t* const target, const unsigned int sourceWidth, const unsigned int sourceHeight, const unsigned int targetWidth, const unsigned int targetHeight, const unsigned int channels, const unsigned int sourcePaddingElements, const unsigned int targetPaddingElements, Worker* worker)
+{
+	ocean_assert(source != nullptr && target != nullptr);
+	ocean_assert(sourceWidth >= 1u && sourceHeight >= 1u);
+	ocean_assert(targetWidth >= 1u && targetWidth <= sourceWidth);
+	ocean_assert(targetHeight >= 1u && targetHeight <= sourceHeight);
+	ocean_assert(channels != 0u);
+
+	// the weights are identical for all target rows (and all target columns), so that we determine them once
+
+	const AreaWeights columnWeights(sourceWidth, targetWidth);
+	const AreaWeights rowWeights(sourceHeight, targetHeight);
+
+	const unsigned int sourceStrideElements = sourceWidth * channels + sourcePaddingElements;
+	const unsigned int targetStrideElements = targetWidth * channels + targetPaddingElements;
+
+	if (worker)
+	{
+		worker->executeFunction(Worker::Function::createStatic(&downsampleByArea8BitPerChannelSubset, source, target, sourceWidth, targetWidth, channels, sourceStrideElements, targetStrideElements, &columnWeights, &rowWeights, 0u, 0u), 0u, targetHeight);
+	}
+	else
+	{
+		downsampleByArea8BitPerChannelSubset(source, target, sourceWidth, targetWidth, channels, sourceStrideElements, targetStrideElements, &columnWeights, &rowWeights, 0u, targetHeight);
+	}
+}
+
 bool FrameShrinker::pyramidByTwo11(const Frame& source, uint8_t* const pyramidTarget, const size_t pyramidTargetSize, const unsigned int layers, const bool copyFirstLayer, Worker* worker)
 {
 	ocean_assert(source.isValid());
@@ -580,8 +694,34 @@ void FrameShrinker::determineFunctionDownsampleBlockByTwo8Bit11(const unsigned i
 	downsampleBlockFunction = nullptr;
 	sourceElementsPerBlock = 0u;
 
+#if defined(OCEAN_CV_DISPATCH_X86)
+
+	if (channels == 1u)
+	{
+		if (sourceWidth >= 128u && CPUDispatch::hasLevel(CPUDispatch::IL_AVX_512))
+		{
+			downsampleBlockFunction = average128Elements1Channel8Bit2x2AVX512;
+			sourceElementsPerBlock = 128u;
+			return;
+		}
+
+		if (sourceWidth >= 64u && CPUDispatch::hasLevel(CPUDispatch::IL_AVX_2))
+		{
+			downsampleBlockFunction = average64Elements1Channel8Bit2x2AVX2;
+			sourceElementsPerBlock = 64u;
+			return;
+		}
+	}
+
+#endif // OCEAN_CV_DISPATCH_X86
+
 #if defined(OCEAN_HARDWARE_SSE_VERSION) && OCEAN_HARDWARE_SSE_VERSION >= 41
 
+	if (!CPUDispatch::hasLevel(CPUDispatch::IL_SSE_4_1))
+	{
+		return;
+	}
+
 	const unsigned int sourceElements = sourceWidth * channels;
 
 	switch (channels)
@@ -646,6 +786,11 @@ void FrameShrinker::determineFunctionDownsampleBlockByTwo8Bit11(const unsigned i
 
 #elif defined(OCEAN_HARDWARE_NEON_VERSION) && OCEAN_HARDWARE_NEON_VERSION >= 10
 
+	if (!CPUDispatch::hasLevel(CPUDispatch::IL_NEON))
+	{
+		return;
+	}
+
 	const unsigned int sourceElements = sourceWidth * channels;
 
 	switch (channels)
@@ -1094,6 +1239,184 @@ void FrameShrinker::downsampleByTwoRowVertical8BitPerChannel14641SSE(const uint8
 
 #endif // OCEAN_HARDWARE_SSE_VERSION >= 41
 
+#if defined(OCEAN_CV_DISPATCH_X86)
+
+OCEAN_CV_TARGET_AVX2 void FrameShrinker::average64Elements1Channel8Bit2x2AVX2(const uint8_t* const sourceRow0, const uint8_t* const sourceRow1, uint8_t* const target)
+{
+	ocean_assert(sourceRow0 != nullptr && sourceRow1 != nullptr && target != nullptr);
+
+	const __m256i ones_u_8x32 = _mm256_set1_epi8(1);
+	const __m256i rounding_u_16x16 = _mm256_set1_epi16(2);
+
+	const __m256i firstRow0_u_8x32 = _mm256_loadu_si256((const __m256i*)(sourceRow0 + 0));
+	const __m256i firstRow1_u_8x32 = _mm256_loadu_si256((const __m256i*)(sourceRow1 + 0));
+	const __m256i secondRow0_u_8x32 = _mm256_loadu_si256((const __m256i*)(sourceRow0 + 32));
+	const __m256i secondRow1_u_8x32 = _mm256_loadu_si256((const __m256i*)(sourceRow1 + 32));
+
+	// the sums of horizontally neighboring elements: (row[0] + row[1]), (row[2] + row[3]), ...
+	const __m256i firstSum_u_16x16 = _mm256_add_epi16(_mm256_maddubs_epi16(firstRow0_u_8x32, ones_u_8x32), _mm256_maddubs_epi16(firstRow1_u_8x32, ones_u_8x32));
+	const __m256i secondSum_u_16x16 = _mm256_add_epi16(_mm256_maddubs_epi16(secondRow0_u_8x32, ones_u_8x32), _mm256_maddubs_epi16(secondRow1_u_8x32, ones_u_8x32));
+
+	// (sum + 2) / 4
+	const __m256i firstAverage_u_16x16 = _mm256_srli_epi16(_mm256_add_epi16(firstSum_u_16x16, rounding_u_16x16), 2);
+	const __m256i secondAverage_u_16x16 = _mm256_srli_epi16(_mm256_add_epi16(secondSum_u_16x16, rounding_u_16x16), 2);
+
+	// packing operates within 128 bit lanes, so that the 64 bit blocks need to be re-ordered afterwards
+	const __m256i average_u_8x32 = _mm256_permute4x64_epi64(_mm256_packus_epi16(firstAverage_u_16x16, secondAverage_u_16x16), 0xD8);
+
+	_mm256_storeu_si256((__m256i*)target, average_u_8x32);
+}
+
+OCEAN_CV_TARGET_AVX512 void FrameShrinker::average128Elements1Channel8Bit2x2AVX512(const uint8_t* const sourceRow0, const uint8_t* const sourceRow1, uint8_t* const target)
+{
+	ocean_assert(sourceRow0 != nullptr && sourceRow1 != nullptr && target != nullptr);
+
+	const __m512i ones_u_8x64 = _mm512_set1_epi8(1);
+	const __m512i rounding_u_16x32 = _mm512_set1_epi16(2);
+
+	const __m512i firstRow0_u_8x64 = _mm512_loadu_si512((const void*)(sourceRow0 + 0));
+	const __m512i firstRow1_u_8x64 = _mm512_loadu_si512((const void*)(sourceRow1 + 0));
+	const __m512i secondRow0_u_8x64 = _mm512_loadu_si512((const void*)(sourceRow0 + 64));
+	const __m512i secondRow1_u_8x64 = _mm512_loadu_si512((const void*)(sourceRow1 + 64));
+
+	const __m512i firstSum_u_16x32 = _mm512_add_epi16(_mm512_maddubs_epi16(firstRow0_u_8x64, ones_u_8x64), _mm512_maddubs_epi16(firstRow1_u_8x64, ones_u_8x64));
+	const __m512i secondSum_u_16x32 = _mm512_add_epi16(_mm512_maddubs_epi16(secondRow0_u_8x64, ones_u_8x64), _mm512_maddubs_epi16(secondRow1_u_8x64, ones_u_8x64));
+
+	const __m512i firstAverage_u_16x32 = _mm512_srli_epi16(_mm512_add_epi16(firstSum_u_16x32, rounding_u_16x32), 2);
+	const __m512i secondAverage_u_16x32 = _mm512_srli_epi16(_mm512_add_epi16(secondSum_u_16x32, rounding_u_16x32), 2);
+
+	// packing operates within 128 bit lanes, so that the 64 bit blocks need to be re-ordered afterwards
+	const __m512i average_u_8x64 = _mm512_permutexvar_epi64(_mm512_setr_epi64(0, 2, 4, 6, 1, 3, 5, 7), _mm512_packus_epi16(firstAverage_u_16x32, secondAverage_u_16x32));
+
+	_mm512_storeu_si512((void*)target, average_u_8x64);
+}
+
+OCEAN_CV_TARGET_AVX2 void FrameShrinker::downsampleByTwoRowVertical8BitPerChannel14641AVX2(const uint8_t* const source, uint16_t* targetRow, const unsigned int sourceElements, const unsigned int sourceHeight, const unsigned int sourceStride, const unsigned int ySource)
+{
+	ocean_assert(source != nullptr);
+	ocean_assert(targetRow != nullptr);
+	ocean_assert(sourceElements >= 16u && sourceStride >= sourceElements && sourceHeight >= 2u);
+
+	// the same strategy as in the SSE implementation, while 16 filter responses are determined within one iteration
+
+	const uint8_t* source0 = source + sourceStride * mirroredBorderLocationLeft(int(ySource) - 2);
+	const uint8_t* source1 = source + sourceStride * mirroredBorderLocationLeft(int(ySource) - 1);
+	const uint8_t* source2 = source + sourceStride * ySource;
+	const uint8_t* source3 = source + sourceStride * mirroredBorderLocationRight(ySource + 1u, sourceHeight);
+	const uint8_t* source4 = source + sourceStride * mirroredBorderLocationRight(ySource + 2u, sourceHeight);
+
+	for (unsigned int x = 0u; x < sourceElements; x += 16u)
+	{
+		if (x + 16u > sourceElements)
+		{
+			// the last iteration does not fit,
+			// so we simply shift x left by some pixels (at most 15) and we will calculate some pixels again
+
+			ocean_assert(x >= 16u && sourceElements > 16u);
+			const unsigned int newX = sourceElements - 16u;
+
+			ocean_assert(x > newX);
+			const unsigned int offset = x - newX;
+
+			source0 -= offset;
+			source1 -= offset;
+			source2 -= offset;
+			source3 -= offset;
+			source4 -= offset;
+			targetRow -= offset;
+
+			x = newX;
+
+			// the for loop will stop after this iteration
+			ocean_assert(!(x + 16u < sourceElements));
+		}
+
+		const __m256i source_a_16x16 = _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i*)source0)); // * 1
+		const __m256i source_b_16x16 = _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i*)source1)); // * 4
+		const __m256i source_c_16x16 = _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i*)source2)); // * 6
+		const __m256i source_d_16x16 = _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i*)source3)); // * 4
+		const __m256i source_e_16x16 = _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i*)source4)); // * 1
+
+		// (source_a + source_e) + (source_c * 2) + (source_b + source_c + source_d) * 4
+		const __m256i source_ae_c2_16x16 = _mm256_add_epi16(_mm256_add_epi16(source_a_16x16, source_e_16x16), _mm256_slli_epi16(source_c_16x16, 1));
+		const __m256i source_bcd4_16x16 = _mm256_slli_epi16(_mm256_add_epi16(_mm256_add_epi16(source_c_16x16, source_d_16x16), source_b_16x16), 2);
+
+		_mm256_storeu_si256((__m256i*)targetRow, _mm256_add_epi16(source_ae_c2_16x16, source_bcd4_16x16));
+
+		source0 += 16;
+		source1 += 16;
+		source2 += 16;
+		source3 += 16;
+		source4 += 16;
+
+		targetRow += 16;
+	}
+}
+
+OCEAN_CV_TARGET_AVX512 void FrameShrinker::downsampleByTwoRowVertical8BitPerChannel14641AVX512(const uint8_t* const source, uint16_t* targetRow, const unsigned int sourceElements, const unsigned int sourceHeight, const unsigned int sourceStride, const unsigned int ySource)
+{
+	ocean_assert(source != nullptr);
+	ocean_assert(targetRow != nullptr);
+	ocean_assert(sourceElements >= 32u && sourceStride >= sourceElements && sourceHeight >= 2u);
+
+	// the same strategy as in the SSE implementation, while 32 filter responses are determined within one iteration
+
+	const uint8_t* source0 = source + sourceStride * mirroredBorderLocationLeft(int(ySource) - 2);
+	const uint8_t* source1 = source + sourceStride * mirroredBorderLocationLeft(int(ySource) - 1);
+	const uint8_t* source2 = source + sourceStride * ySource;
+	const uint8_t* source3 = source + sourceStride * mirroredBorderLocationRight(ySource + 1u, sourceHeight);
+	const uint8_t* source4 = source + sourceStride * mirroredBorderLocationRight(ySource + 2u, sourceHeight);
+
+	for (unsigned int x = 0u; x < sourceElements; x += 32u)
+	{
+		if (x + 32u > sourceElements)
+		{
+			// the last iteration does not fit,
+			// so we simply shift x left by some pixels (at most 31) and we will calculate some pixels again
+
+			ocean_assert(x >= 32u && sourceElements > 32u);
+			const unsigned int newX = sourceElements - 32u;
+
+			ocean_assert(x > newX);
+			const unsigned int offset = x - newX;
+
+			source0 -= offset;
+			source1 -= offset;
+			source2 -= offset;
+			source3 -= offset;
+			source4 -= offset;
+			targetRow -= offset;
+
+			x = newX;
+
+			// the for loop will stop after this iteration
+			ocean_assert(!(x + 32u < sourceElements));
+		}
+
+		const __m512i source_a_16x32 = _mm512_cvtepu8_epi16(_mm256_loadu_si256((const __m256i*)source0)); // * 1
+		const __m512i source_b_16x32 = _mm512_cvtepu8_epi16(_mm256_loadu_si256((const __m256i*)source1)); // * 4
+		const __m512i source_c_16x32 = _mm512_cvtepu8_epi16(_mm256_loadu_si256((const __m256i*)source2)); // * 6
+		const __m512i source_d_16x32 = _mm512_cvtepu8_epi16(_mm256_loadu_si256((const __m256i*)source3)); // * 4
+		const __m512i source_e_16x32 = _mm512_cvtepu8_epi16(_mm256_loadu_si256((const __m256i*)source4)); // * 1
+
+		// (source_a + source_e) + (source_c * 2) + (source_b + source_c + source_d) * 4
+		const __m512i source_ae_c2_16x32 = _mm512_add_epi16(_mm512_add_epi16(source_a_16x32, source_e_16x32), _mm512_slli_epi16(source_c_16x32, 1));
+		const __m512i source_bcd4_16x32 = _mm512_slli_epi16(_mm512_add_epi16(_mm512_add_epi16(source_c_16x32, source_d_16x32), source_b_16x32), 2);
+
+		_mm512_storeu_si512((void*)targetRow, _mm512_add_epi16(source_ae_c2_16x32, source_bcd4_16x32));
+
+		source0 += 32;
+		source1 += 32;
+		source2 += 32;
+		source3 += 32;
+		source4 += 32;
+
+		targetRow += 32;
+	}
+}
+
+#endif // OCEAN_CV_DISPATCH_X86
+
 #if defined(OCEAN_HARDWARE_NEON_VERSION) && OCEAN_HARDWARE_NEON_VERSION >= 10
 
 void FrameShrinker::downsampleByTwoRowVertical8BitPerChannel14641NEON(const uint8_t* const source, uint16_t* targetRow, const unsigned int sourceElements, const unsigned int sourceHeight, const unsigned int sourceStride, const unsigned int ySource)
@@ -1712,35 +2035,51 @@ void FrameShrinker::downsampleByTwo8BitPerChannel14641Subset(const uint8_t* sour
 
 #if defined(OCEAN_HARDWARE_SSE_VERSION) && OCEAN_HARDWARE_SSE_VERSION >= 41
 
-	if (targetWidth * channels >= 8u)
+	if (targetWidth * channels >= 8u && CPUDispatch::hasLevel(CPUDispatch::IL_SSE_4_1))
 	{
 		downsampleByTwoRowVerticalFunction = downsampleByTwoRowVertical8BitPerChannel14641SSE;
 	}
 
 #endif // OCEAN_HARDWARE_SSE_VERSION
 
-#if defined(OCEAN_HARDWARE_NEON_VERSION) && OCEAN_HARDWARE_NEON_VERSION >= 10
-
-	if (targetWidth * channels >= 16u)
-	{
-		downsampleByTwoRowVerticalFunction = downsampleByTwoRowVertical8BitPerChannel14641NEON;
-	}
+#if defined(OCEAN_CV_DISPATCH_X86)
 
-	if (channels == 1u && targetWidth >= 8u)
+	if (sourceWidth * channels >= 32u && CPUDispatch::hasLevel(CPUDispatch::IL_AVX_512))
 	{
-		downsampleByTwoRowHorizontalFunction = downsampleByTwoRowHorizontal8BitPerChannel14641NEON<1u>;
+		downsampleByTwoRowVerticalFunction = downsampleByTwoRowVertical8BitPerChannel14641AVX512;
 	}
-	else if (channels == 2u && targetWidth >= 4u)
+	else if (sourceWidth * channels >= 16u && CPUDispatch::hasLevel(CPUDispatch::IL_AVX_2))
 	{
-		downsampleByTwoRowHorizontalFunction = downsampleByTwoRowHorizontal8BitPerChannel14641NEON<2u>;
+		downsampleByTwoRowVerticalFunction = downsampleByTwoRowVertical8BitPerChannel14641AVX2;
 	}
-	else if (channels == 3u && targetWidth >= 8u)
-	{
-		downsampleByTwoRowHorizontalFunction = downsampleByTwoRowHorizontal8BitPerChannel14641NEON<3u>;
-	}
-	else if (channels == 4u && targetWidth >= 2u)
+
+#endif // OCEAN_CV_DISPATCH_X86
+
+#if defined(OCEAN_HARDWARE_NEON_VERSION) && OCEAN_HARDWARE_NEON_VERSION >= 10
+
+	if (CPUDispatch::hasLevel(CPUDispatch::IL_NEON))
 	{
-		downsampleByTwoRowHorizontalFunction = downsampleByTwoRowHorizontal8BitPerChannel14641NEON<4u>;
+		if (targetWidth * channels >= 16u)
+		{
+			downsampleByTwoRowVerticalFunction = downsampleByTwoRowVertical8BitPerChannel14641NEON;
+		}
+
+		if (channels == 1u && targetWidth >= 8u)
+		{
+			downsampleByTwoRowHorizontalFunction = downsampleByTwoRowHorizontal8BitPerChannel14641NEON<1u>;
+		}
+		else if (channels == 2u && targetWidth >= 4u)
+		{
+			downsampleByTwoRowHorizontalFunction = downsampleByTwoRowHorizontal8BitPerChannel14641NEON<2u>;
+		}
+		else if (channels == 3u && targetWidth >= 8u)
+		{
+			downsampleByTwoRowHorizontalFunction = downsampleByTwoRowHorizontal8BitPerChannel14641NEON<3u>;
+		}
+		else if (channels == 4u && targetWidth >= 2u)
+		{
+			downsampleByTwoRowHorizontalFunction = downsampleByTwoRowHorizontal8BitPerChannel14641NEON<4u>;
+		}
 	}
 
 #endif // OCEAN_HARDWARE_NEON_VERSION >= 10
@@ -1778,6 +2117,217 @@ void FrameShrinker::downsampleByTwo8BitPerChannel14641Subset(const uint8_t* sour
 	}
 }
 
+void FrameShrinker::downsampleByAreaRowVertical8BitPerChannel(const uint8_t* sourceRow, uint16_t* intermediateRow, const unsigned int elements, const unsigned int sourceStrideElements, const uint16_t* weights, const unsigned int rows)
+{
+	ocean_assert(sourceRow != nullptr && intermediateRow != nullptr);
+	ocean_assert(elements >= 1u && sourceStrideElements >= elements);
+	ocean_assert(weights != nullptr && rows >= 1u);
+
+	constexpr unsigned int shift = areaWeightBits_ - areaIntermediateBits_;
+	constexpr uint32_t roundingValue = 1u << (shift - 1u);
+
+	for (unsigned int n = 0u; n < elements; ++n)
+	{
+		const uint8_t* source = sourceRow + n;
+
+		uint32_t sum = 0u;
+
+		for (unsigned int rowIndex = 0u; rowIndex < rows; ++rowIndex)
+		{
+			sum += uint32_t(*source) * uint32_t(weights[rowIndex]);
+			source += sourceStrideElements;
+		}
+
+		intermediateRow[n] = uint16_t((sum + roundingValue) >> shift);
+	}
+}
+
+#if defined(OCEAN_HARDWARE_SSE_VERSION) && OCEAN_HARDWARE_SSE_VERSION >= 41
+
+void FrameShrinker::downsampleByAreaRowVertical8BitPerChannelSSE(const uint8_t* sourceRow, uint16_t* intermediateRow, const unsigned int elements, const unsigned int sourceStrideElements, const uint16_t* weights, const unsigned int rows)
+{
+	ocean_assert(sourceRow != nullptr && intermediateRow != nullptr);
+	ocean_assert(elements >= 16u && sourceStrideElements >= elements);
+	ocean_assert(weights != nullptr && rows >= 1u);
+
+	constexpr unsigned int shift = areaWeightBits_ - areaIntermediateBits_;
+
+	const __m128i roundingValue_u_32x4 = _mm_set1_epi32(1 << (shift - 1u));
+
+	for (unsigned int n = 0u; n < elements; n += 16u)
+	{
+		if (n + 16u > elements)
+		{
+			// the last iteration does not fit,
+			// so we simply shift n left by some elements (at most 15) and we will calculate some elements again
+
+			ocean_assert(n >= 16u && elements > 16u);
+			n = elements - 16u;
+		}
+
+		const uint8_t* source = sourceRow + n;
+
+		__m128i sumA_u_32x4 = _mm_setzero_si128();
+		__m128i sumB_u_32x4 = _mm_setzero_si128();
+		__m128i sumC_u_32x4 = _mm_setzero_si128();
+		__m128i sumD_u_32x4 = _mm_setzero_si128();
+
+		for (unsigned int rowIndex = 0u; rowIndex < rows; ++rowIndex)
+		{
+			const __m128i source_u_8x16 = _mm_loadu_si128((const __m128i*)source);
+			const __m128i weight_u_32x4 = _mm_set1_epi32(int(weights[rowIndex]));
+
+			// the products are below 2^23, so that we can use the signed multiplication
+
+			sumA_u_32x4 = _mm_add_epi32(sumA_u_32x4, _mm_mullo_epi32(_mm_cvtepu8_epi32(source_u_8x16), weight_u_32x4));
+			sumB_u_32x4 = _mm_add_epi32(sumB_u_32x4, _mm_mullo_epi32(_mm_cvtepu8_epi32(_mm_srli_si128(source_u_8x16, 4)), weight_u_32x4));
+			sumC_u_32x4 = _mm_add_epi32(sumC_u_32x4, _mm_mullo_epi32(_mm_cvtepu8_epi32(_mm_srli_si128(source_u_8x16, 8)), weight_u_32x4));
+			sumD_u_32x4 = _mm_add_epi32(sumD_u_32x4, _mm_mullo_epi32(_mm_cvtepu8_epi32(_mm_srli_si128(source_u_8x16, 12)), weight_u_32x4));
+
+			source += sourceStrideElements;
+		}
+
+		sumA_u_32x4 = _mm_srli_epi32(_mm_add_epi32(sumA_u_32x4, roundingValue_u_32x4), shift);
+		sumB_u_32x4 = _mm_srli_epi32(_mm_add_epi32(sumB_u_32x4, roundingValue_u_32x4), shift);
+		sumC_u_32x4 = _mm_srli_epi32(_mm_add_epi32(sumC_u_32x4, roundingValue_u_32x4), shift);
+		sumD_u_32x4 = _mm_srli_epi32(_mm_add_epi32(sumD_u_32x4, roundingValue_u_32x4), shift);
+
+		_mm_storeu_si128((__m128i*)(intermediateRow + n + 0u), _mm_packus_epi32(sumA_u_32x4, sumB_u_32x4));
+		_mm_storeu_si128((__m128i*)(intermediateRow + n + 8u), _mm_packus_epi32(sumC_u_32x4, sumD_u_32x4));
+	}
+}
+
+#endif // OCEAN_HARDWARE_SSE_VERSION >= 41
+
+#if defined(OCEAN_HARDWARE_NEON_VERSION) && OCEAN_HARDWARE_NEON_VERSION >= 10
+
+void FrameShrinker::downsampleByAreaRowVertical8BitPerChannelNEON(const uint8_t* sourceRow, uint16_t* intermediateRow, const unsigned int elements, const unsigned int sourceStrideElements, const uint16_t* weights, const unsigned int rows)
+{
+	ocean_assert(sourceRow != nullptr && intermediateRow != nullptr);
+	ocean_assert(elements >= 8u && sourceStrideElements >= elements);
+	ocean_assert(weights != nullptr && rows >= 1u);
+
+	constexpr unsigned int shift = areaWeightBits_ - areaIntermediateBits_;
+
+	for (unsigned int n = 0u; n < elements; n += 8u)
+	{
+		if (n + 8u > elements)
+		{
+			// the last iteration does not fit,
+			// so we simply shift n left by some elements (at most 7) and we will calculate some elements again
+
+			ocean_assert(n >= 8u && elements > 8u);
+			n = elements - 8u;
+		}
+
+		const uint8_t* source = sourceRow + n;
+
+		uint32x4_t sumLow_u_32x4 = vdupq_n_u32(0u);
+		uint32x4_t sumHigh_u_32x4 = vdupq_n_u32(0u);
+
+		for (unsigned int rowIndex = 0u; rowIndex < rows; ++rowIndex)
+		{
+			const uint16x8_t source_u_16x8 = vmovl_u8(vld1_u8(source));
+
+			sumLow_u_32x4 = vmlal_n_u16(sumLow_u_32x4, vget_low_u16(source_u_16x8), weights[rowIndex]);
+			sumHigh_u_32x4 = vmlal_n_u16(sumHigh_u_32x4, vget_high_u16(source_u_16x8), weights[rowIndex]);
+
+			source += sourceStrideElements;
+		}
+
+		// rounded narrowing shift: (sum + 2^(shift - 1)) / 2^shift
+
+		vst1q_u16(intermediateRow + n, vcombine_u16(vrshrn_n_u32(sumLow_u_32x4, shift), vrshrn_n_u32(sumHigh_u_32x4, shift)));
+	}
+}
+
+#endif // OCEAN_HARDWARE_NEON_VERSION >= 10
+
+void FrameShrinker::downsampleByAreaRowHorizontal8BitPerChannel(const uint16_t* intermediateRow, uint8_t* targetRow, const unsigned int targetWidth, const unsigned int channels, const AreaWeights* columnWeights)
+{
+	ocean_assert(intermediateRow != nullptr && targetRow != nullptr);
+	ocean_assert(targetWidth >= 1u && channels >= 1u);
+	ocean_assert(columnWeights != nullptr);
+
+	constexpr unsigned int shift = areaWeightBits_ + areaIntermediateBits_;
+	constexpr uint32_t roundingValue = 1u << (shift - 1u);
+
+	for (unsigned int x = 0u; x < targetWidth; ++x)
+	{
+		const uint16_t* intermediate = intermediateRow + columnWeights->firstSourceIndex(x) * channels;
+
+		const uint16_t* weights = columnWeights->weights(x);
+		const unsigned int sourcePixels = columnWeights->sourcePixels(x);
+
+		for (unsigned int channelIndex = 0u; channelIndex < channels; ++channelIndex)
+		{
+			// the intermediate values are below 2^16 and the weights sum up to 2^15, so that the sum fits into 32 bit
+
+			uint32_t sum = 0u;
+
+			for (unsigned int n = 0u; n < sourcePixels; ++n)
+			{
+				sum += uint32_t(intermediate[n * channels + channelIndex]) * uint32_t(weights[n]);
+			}
+
+			ocean_assert(((sum + roundingValue) >> shift) <= 255u);
+
+			*targetRow++ = uint8_t((sum + roundingValue) >> shift);
+		}
+	}
+}
+
+void FrameShrinker::downsampleByArea8BitPerChannelSubset(const uint8_t* source, uint8_t* target, const unsigned int sourceWidth, const unsigned int targetWidth, const unsigned int channels, const unsigned int sourceStrideElements, const unsigned int targetStrideElements, const AreaWeights* columnWeights, const AreaWeights* rowWeights, const unsigned int firstTargetRow, const unsigned int numberTargetRows)
+{
+	ocean_assert(source != nullptr && target != nullptr);
+	ocean_assert(sourceWidth >= 1u && targetWidth >= 1u && targetWidth <= sourceWidth);
+	ocean_assert(channels != 0u);
+	ocean_assert(columnWeights != nullptr && rowWeights != nullptr);
+
+	const unsigned int sourceElements = sourceWidth * channels;
+
+	using DownsampleByAreaRowVertical8BitPerChannelFunction = void (*)(const uint8_t*, uint16_t*, const unsigned int, const unsigned int, const uint16_t*, const unsigned int);
+
+	DownsampleByAreaRowVertical8BitPerChannelFunction downsampleByAreaRowVerticalFunction = downsampleByAreaRowVertical8BitPerChannel;
+
+#if defined(OCEAN_HARDWARE_SSE_VERSION) && OCEAN_HARDWARE_SSE_VERSION >= 41
+
+	if (sourceElements >= 16u && CPUDispatch::hasLevel(CPUDispatch::IL_SSE_4_1))
+	{
+		downsampleByAreaRowVerticalFunction = downsampleByAreaRowVertical8BitPerChannelSSE;
+	}
+
+#endif // OCEAN_HARDWARE_SSE_VERSION >= 41
+
+#if defined(OCEAN_HARDWARE_NEON_VERSION) && OCEAN_HARDWARE_NEON_VERSION >= 10
+
+	if (sourceElements >= 8u && CPUDispatch::hasLevel(CPUDispatch::IL_NEON))
+	{
+		downsampleByAreaRowVerticalFunction = downsampleByAreaRowVertical8BitPerChannelNEON;
+	}
+
+#endif // OCEAN_HARDWARE_NEON_VERSION >= 10
+
+	// the intermediate row holds the vertically averaged source row, with 8 fractional bits
+	Memory intermediateRowMemory = Memory::create<uint16_t>(sourceElements);
+	uint16_t* intermediateRow = intermediateRowMemory.data<uint16_t>();
+
+	target += firstTargetRow * targetStrideElements;
+
+	for (unsigned int yTarget = firstTargetRow; yTarget < firstTargetRow + numberTargetRows; ++yTarget)
+	{
+		const uint8_t* sourceRow = source + rowWeights->firstSourceIndex(yTarget) * sourceStrideElements;
+
+		// first we average the covered source rows, then we average the covered columns of the resulting intermediate row
+
+		downsampleByAreaRowVerticalFunction(sourceRow, intermediateRow, sourceElements, sourceStrideElements, rowWeights->weights(yTarget), rowWeights->sourcePixels(yTarget));
+
+		downsampleByAreaRowHorizontal8BitPerChannel(intermediateRow, target, targetWidth, channels, columnWeights);
+
+		target += targetStrideElements;
+	}
+}
+
 }
 
 }
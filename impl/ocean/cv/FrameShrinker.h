@@ -9,6 +9,7 @@
 #define META_OCEAN_CV_FRAME_SHRINKER_H
 
 #include "ocean/cv/CV.h"
+#include "ocean/cv/CPUDispatch.h"
 #include "ocean/cv/NEON.h"
 #include "ocean/cv/SSE.h"
 
@@ -48,6 +49,61 @@ class OCEAN_CV_EXPORT FrameShrinker
 		 */
 		using DownsampleBlockByTwoBinary8BitPerChannelFunction = void (*)(const uint8_t* const sourceRow0, const uint8_t* const sourceRow1, uint8_t* const target, const uint16_t threshold);
 
+		/**
+		 * This class holds the precomputed weights of an area-averaging downsampling along one dimension (either the columns or the rows of a frame).
+		 * Each target pixel covers a consecutive range of source pixels, each source pixel contributes with the size of its overlap with the target pixel.<br>
+		 * The weights of one target pixel are stored in fixed point with precision 2^areaWeightBits_ and sum up to 2^areaWeightBits_.
+		 */
+		class AreaWeights
+		{
+			public:
+
+				/**
+				 * Creates the weights for a given source and target size.
+				 * @param sourceSize The number of source pixels, with range [1, infinity)
+				 * @param targetSize The number of target pixels, with range [1, sourceSize]
+				 */
+				AreaWeights(const unsigned int sourceSize, const unsigned int targetSize);
+
+				/**
+				 * Returns the index of the first source pixel covered by a target pixel.
+				 * @param targetIndex The index of the target pixel, with range [0, targetSize - 1]
+				 * @return The index of the first source pixel
+				 */
+				inline unsigned int firstSourceIndex(const unsigned int targetIndex) const;
+
+				/**
+				 * Returns the number of source pixels covered by a target pixel.
+				 * @param targetIndex The index of the target pixel, with range [0, targetSize - 1]
+				 * @return The number of source pixels, with range [1, infinity)
+				 */
+				inline unsigned int sourcePixels(const unsigned int targetIndex) const;
+
+				/**
+				 * Returns the weights of the source pixels covered by a target pixel.
+				 * @param targetIndex The index of the target pixel, with range [0, targetSize - 1]
+				 * @return The sourcePixels(targetIndex) weights
+				 */
+				inline const uint16_t* weights(const unsigned int targetIndex) const;
+
+			protected:
+
+				/// The index of the first source pixel for each target pixel.
+				Indices32 firstSourceIndices_;
+
+				/// The offsets of the weights for each target pixel, with one additional offset at the end.
+				Indices32 weightOffsets_;
+
+				/// The weights of all target pixels.
+				std::vector<uint16_t> weights_;
+		};
+
+		/// The number of fractional bits of the weights of the area-averaging downsampling.
+		static constexpr unsigned int areaWeightBits_ = 15u;
+
+		/// The number of fractional bits of the intermediate rows of the area-averaging downsampling.
+		static constexpr unsigned int areaIntermediateBits_ = 8u;
+
 	public:
 
 		/**
@@ -103,6 +159,20 @@ class OCEAN_CV_EXPORT FrameShrinker
 		 */
 		static bool downsampleByTwo14641(const Frame& source, Frame& target, Worker* worker = nullptr);
 
+		/**
+		 * Reduces the resolution of a given frame by an arbitrary factor, applying an area-averaging (box) downsampling.
+		 * Each target pixel is the average of all source pixels it covers, source pixels covered partially contribute with the size of the covered area.<br>
+		 * The function supports arbitrary (non-integer) downsampling factors e.g., 1920x1080 -> 1280x720 or 4032x3024 -> 640x480, and avoids the aliasing of a bilinear interpolation.<br>
+		 * Frames with several planes are downsampled plane by plane.
+		 * @param source The source frame to resize, with data type DT_UNSIGNED_INTEGER_8, must be valid
+		 * @param target The target frame receiving the down sampled frame data, can be invalid
+		 * @param targetWidth The width of the target frame in pixel, with range [1, source.width()], must be a multiple of the width multiple of the pixel format
+		 * @param targetHeight The height of the target frame in pixel, with range [1, source.height()], must be a multiple of the height multiple of the pixel format
+		 * @param worker Optional worker object to distribute the computational load to several CPU cores
+		 * @return True, if succeeded
+		 */
+		static bool downsampleByArea(const Frame& source, Frame& target, const unsigned int targetWidth, const unsigned int targetHeight, Worker* worker = nullptr);
+
 		/**
 		 * Reduces the resolution of a given frame by two, taking four pixel values into account.
 		 * If the given source image has an odd frame dimension the last pixel row or the last pixel column is filtered together with the two valid rows or columns respectively.<br>
@@ -139,6 +209,17 @@ class OCEAN_CV_EXPORT FrameShrinker
 		 */
 		static inline bool downsampleByTwo14641(Frame& frame, Worker* worker = nullptr);
 
+		/**
+		 * Reduces the resolution of a given frame by an arbitrary factor, applying an area-averaging (box) downsampling.
+		 * @param frame The frame to down sample, with data type DT_UNSIGNED_INTEGER_8, must be valid
+		 * @param targetWidth The width of the resulting frame in pixel, with range [1, frame.width()]
+		 * @param targetHeight The height of the resulting frame in pixel, with range [1, frame.height()]
+		 * @param worker Optional worker object to distribute the computational load to several CPU cores
+		 * @return True, if succeeded
+		 * @see downsampleByArea().
+		 */
+		static inline bool downsampleByArea(Frame& frame, const unsigned int targetWidth, const unsigned int targetHeight, Worker* worker = nullptr);
+
 		/**
 		 * Fills the buffer of a pyramid frame for frames with 1 plane and data type DT_UNSIGNED_INTEGER_8.
 		 * @param source The source frame buffer to be used, must be valid
@@ -226,6 +307,22 @@ class OCEAN_CV_EXPORT FrameShrinker
 		 */
 		static inline void downsampleByTwo8BitPerChannel14641(const uint8_t* const source, uint8_t* const target, const unsigned int sourceWidth, const unsigned int sourceHeight, const unsigned int targetWidth, const unsigned int targetHeight, const unsigned int channels, const unsigned int sourcePaddingElements, const unsigned int targetPaddingElements, Worker* worker = nullptr);
 
+		/**
+		 * Reduces the resolution of a given frame with 8 bit per channel by an arbitrary factor, applying an area-averaging (box) downsampling.
+		 * The weights of the source rows and columns are determined once, the rows are averaged with SIMD instructions before the columns are averaged.
+		 * @param source The source frame to resize, must be valid
+		 * @param target The target frame receiving the down sampled frame data, must be valid
+		 * @param sourceWidth The width of the source frame in pixel, with range [1, infinity)
+		 * @param sourceHeight The height of the source frame in pixel, with range [1, infinity)
+		 * @param targetWidth The width of the target frame in pixel, with range [1, sourceWidth]
+		 * @param targetHeight The height of the target frame in pixel, with range [1, sourceHeight]
+		 * @param channels The number of frame channels, with range [1, infinity)
+		 * @param sourcePaddingElements Optional padding at the end of each source row in elements, with range [0, infinity)
+		 * @param targetPaddingElements Optional padding at the end of each target row in elements, with range [0, infinity)
+		 * @param worker Optional worker object to distribute the computational load to several CPU cores
+		 */
+		static void downsampleByArea8BitPerChannel(const uint8_t* const source, uint8_t* const target, const unsigned int sourceWidth, const unsigned int sourceHeight, const unsigned int targetWidth, const unsigned int targetHeight, const unsigned int channels, const unsigned int sourcePaddingElements, const unsigned int targetPaddingElements, Worker* worker = nullptr);
+
 	protected:
 
 		/**
@@ -365,6 +462,54 @@ class OCEAN_CV_EXPORT FrameShrinker
 
 #endif // OCEAN_HARDWARE_SSE_VERSION >= 41
 
+#if defined(OCEAN_CV_DISPATCH_X86)
+
+		/**
+		 * Averages 64 elements of 2x2 blocks for 1 channel 8 bit frames using AVX2 instructions.
+		 * The function is compiled for AVX2 and must be used only if CPUDispatch::hasLevel(CPUDispatch::IL_AVX_2) is true.
+		 * @param sourceRow0 The first source row holding 64 elements, must be valid
+		 * @param sourceRow1 The second source row holding 64 elements, must be valid
+		 * @param target The target receiving 32 elements, must be valid
+		 */
+		OCEAN_CV_TARGET_AVX2 static void average64Elements1Channel8Bit2x2AVX2(const uint8_t* const sourceRow0, const uint8_t* const sourceRow1, uint8_t* const target);
+
+		/**
+		 * Averages 128 elements of 2x2 blocks for 1 channel 8 bit frames using AVX-512 instructions.
+		 * The function is compiled for AVX-512 and must be used only if CPUDispatch::hasLevel(CPUDispatch::IL_AVX_512) is true.
+		 * @param sourceRow0 The first source row holding 128 elements, must be valid
+		 * @param sourceRow1 The second source row holding 128 elements, must be valid
+		 * @param target The target receiving 64 elements, must be valid
+		 */
+		OCEAN_CV_TARGET_AVX512 static void average128Elements1Channel8Bit2x2AVX512(const uint8_t* const sourceRow0, const uint8_t* const sourceRow1, uint8_t* const target);
+
+		/**
+		 * Applies a vertical 14641 filter to each pixel in a given row using AVX2 instructions.
+		 * The function is compiled for AVX2 and must be used only if CPUDispatch::hasLevel(CPUDispatch::IL_AVX_2) is true.
+		 * @param source The entire source frame holding the row to which the filter is applied, must be valid
+		 * @param targetRow The target row receiving the filter results which are not normalized, must be valid
+		 * @param sourceElements The number of elements in each row (pixels * channels), with range [16, infinity)
+		 * @param sourceHeight The height of the source frame in pixel, with range [2, infinity)
+		 * @param sourceStrideElements The stride of the source frame (the number of elements in each row - may including padding at the end of each row), with range [sourceElements, infinity)
+		 * @param ySource The row within the source frame to which the filter will be applied, with range [0, sourceHeight)
+		 * @see downsampleByTwoRowVertical8BitPerChannel14641SSE().
+		 */
+		OCEAN_CV_TARGET_AVX2 static void downsampleByTwoRowVertical8BitPerChannel14641AVX2(const uint8_t* const source, uint16_t* targetRow, const unsigned int sourceElements, const unsigned int sourceHeight, const unsigned int sourceStrideElements, const unsigned int ySource);
+
+		/**
+		 * Applies a vertical 14641 filter to each pixel in a given row using AVX-512 instructions.
+		 * The function is compiled for AVX-512 and must be used only if CPUDispatch::hasLevel(CPUDispatch::IL_AVX_512) is true.
+		 * @param source The entire source frame holding the row to which the filter is applied, must be valid
+		 * @param targetRow The target row receiving the filter results which are not normalized, must be valid
+		 * @param sourceElements The number of elements in each row (pixels * channels), with range [32, infinity)
+		 * @param sourceHeight The height of the source frame in pixel, with range [2, infinity)
+		 * @param sourceStrideElements The stride of the source frame (the number of elements in each row - may including padding at the end of each row), with range [sourceElements, infinity)
+		 * @param ySource The row within the source frame to which the filter will be applied, with range [0, sourceHeight)
+		 * @see downsampleByTwoRowVertical8BitPerChannel14641SSE().
+		 */
+		OCEAN_CV_TARGET_AVX512 static void downsampleByTwoRowVertical8BitPerChannel14641AVX512(const uint8_t* const source, uint16_t* targetRow, const unsigned int sourceElements, const unsigned int sourceHeight, const unsigned int sourceStrideElements, const unsigned int ySource);
+
+#endif // OCEAN_CV_DISPATCH_X86
+
 #if defined(OCEAN_HARDWARE_NEON_VERSION) && OCEAN_HARDWARE_NEON_VERSION >= 10
 
 		/**
@@ -412,6 +557,73 @@ class OCEAN_CV_EXPORT FrameShrinker
 		 */
 		static void downsampleByTwo8BitPerChannel14641Subset(const uint8_t* source, uint8_t* target, const unsigned int sourceWidth, const unsigned int sourceHeight, const unsigned int targetWidth, const unsigned int channels, const unsigned int sourceStrideElements, const unsigned int targetStrideElements, const unsigned int firstTargetRow, const unsigned int numberTargetRows);
 
+		/**
+		 * Averages several weighted source rows with 8 bit per channel to one intermediate row.
+		 * @param sourceRow The first source row to be averaged, must be valid
+		 * @param intermediateRow The resulting intermediate row with precision 2^areaIntermediateBits_, must be valid
+		 * @param elements The number of elements in each row, with range [1, infinity)
+		 * @param sourceStrideElements The stride of the source frame in elements, with range [elements, infinity)
+		 * @param weights The weights of the source rows with precision 2^areaWeightBits_, must be valid
+		 * @param rows The number of source rows to be averaged, with range [1, infinity)
+		 */
+		static void downsampleByAreaRowVertical8BitPerChannel(const uint8_t* sourceRow, uint16_t* intermediateRow, const unsigned int elements, const unsigned int sourceStrideElements, const uint16_t* weights, const unsigned int rows);
+
+#if defined(OCEAN_HARDWARE_SSE_VERSION) && OCEAN_HARDWARE_SSE_VERSION >= 41
+
+		/**
+		 * Averages several weighted source rows with 8 bit per channel to one intermediate row, using SSE 4.1 instructions.
+		 * @param sourceRow The first source row to be averaged, must be valid
+		 * @param intermediateRow The resulting intermediate row with precision 2^areaIntermediateBits_, must be valid
+		 * @param elements The number of elements in each row, with range [16, infinity)
+		 * @param sourceStrideElements The stride of the source frame in elements, with range [elements, infinity)
+		 * @param weights The weights of the source rows with precision 2^areaWeightBits_, must be valid
+		 * @param rows The number of source rows to be averaged, with range [1, infinity)
+		 */
+		static void downsampleByAreaRowVertical8BitPerChannelSSE(const uint8_t* sourceRow, uint16_t* intermediateRow, const unsigned int elements, const unsigned int sourceStrideElements, const uint16_t* weights, const unsigned int rows);
+
+#endif // OCEAN_HARDWARE_SSE_VERSION >= 41
+
+#if defined(OCEAN_HARDWARE_NEON_VERSION) && OCEAN_HARDWARE_NEON_VERSION >= 10
+
+		/**
+		 * Averages several weighted source rows with 8 bit per channel to one intermediate row, using NEON instructions.
+		 * @param sourceRow The first source row to be averaged, must be valid
+		 * @param intermediateRow The resulting intermediate row with precision 2^areaIntermediateBits_, must be valid
+		 * @param elements The number of elements in each row, with range [8, infinity)
+		 * @param sourceStrideElements The stride of the source frame in elements, with range [elements, infinity)
+		 * @param weights The weights of the source rows with precision 2^areaWeightBits_, must be valid
+		 * @param rows The number of source rows to be averaged, with range [1, infinity)
+		 */
+		static void downsampleByAreaRowVertical8BitPerChannelNEON(const uint8_t* sourceRow, uint16_t* intermediateRow, const unsigned int elements, const unsigned int sourceStrideElements, const uint16_t* weights, const unsigned int rows);
+
+#endif // OCEAN_HARDWARE_NEON_VERSION >= 10
+
+		/**
+		 * Averages the weighted columns of an intermediate row to one target row with 8 bit per channel.
+		 * @param intermediateRow The intermediate row with precision 2^areaIntermediateBits_, must be valid
+		 * @param targetRow The resulting target row, must be valid
+		 * @param targetWidth The width of the target frame in pixel, with range [1, infinity)
+		 * @param channels The number of frame channels, with range [1, infinity)
+		 * @param columnWeights The weights of the source columns, must be valid
+		 */
+		static void downsampleByAreaRowHorizontal8BitPerChannel(const uint16_t* intermediateRow, uint8_t* targetRow, const unsigned int targetWidth, const unsigned int channels, const AreaWeights* columnWeights);
+
+		/**
+		 * Reduces the resolution of a subset of a given frame with 8 bit per channel by an arbitrary factor, applying an area-averaging (box) downsampling.
+		 * @param source The source frame to resize, must be valid
+		 * @param target The target frame receiving the down sampled frame data, must be valid
+		 * @param sourceWidth The width of the source frame in pixel, with range [1, infinity)
+		 * @param targetWidth The width of the target frame in pixel, with range [1, sourceWidth]
+		 * @param channels The number of frame channels, with range [1, infinity)
+		 * @param sourceStrideElements The stride of the source frame in elements (sourceWidth * channels + optional padding), with range [sourceWidth * channels, infinity)
+		 * @param targetStrideElements The stride of the target frame in elements (targetWidth * channels + optional padding), with range [targetWidth * channels, infinity)
+		 * @param columnWeights The weights of the source columns, must be valid
+		 * @param rowWeights The weights of the source rows, must be valid
+		 * @param firstTargetRow The first target row to be handled, with range [0, targetHeight)
+		 * @param numberTargetRows The number of target rows to be handled, with range [1, targetHeight - firstTargetRow]
+		 */
+		static void downsampleByArea8BitPerChannelSubset(const uint8_t* source, uint8_t* target, const unsigned int sourceWidth, const unsigned int targetWidth, const unsigned int channels, const unsigned int sourceStrideElements, const unsigned int targetStrideElements, const AreaWeights* columnWeights, const AreaWeights* rowWeights, const unsigned int firstTargetRow, const unsigned int numberTargetRows);
+
 		/**
 		 * Mirrors a given value at the left border if necessary.
 		 * The function provides a result as below:<br>
@@ -441,6 +653,28 @@ class OCEAN_CV_EXPORT FrameShrinker
 		static inline unsigned int mirroredBorderLocationRight(const unsigned int value, const unsigned int size);
 };
 
+inline unsigned int FrameShrinker::AreaWeights::firstSourceIndex(const unsigned int targetIndex) const
+{
+	ocean_assert(targetIndex < firstSourceIndices_.size());
+
+	return firstSourceIndices_[targetIndex];
+}
+
+inline unsigned int FrameShrinker::AreaWeights::sourcePixels(const unsigned int targetIndex) const
+{
+	ocean_assert(targetIndex + 1 < weightOffsets_.size());
+
+	return weightOffsets_[targetIndex + 1u] - weightOffsets_[targetIndex];
+}
+
+inline const uint16_t* FrameShrinker::AreaWeights::weights(const unsigned int targetIndex) const
+{
+	ocean_assert(targetIndex < weightOffsets_.size());
+	ocean_assert(weightOffsets_[targetIndex] < weights_.size());
+
+	return weights_.data() + weightOffsets_[targetIndex];
+}
+
 inline bool FrameShrinker::downsampleByTwo11(Frame& frame, Worker* worker)
 {
 	Frame tmpFrame;
@@ -486,6 +720,21 @@ inline bool FrameShrinker::downsampleByTwo14641(Frame& frame, Worker* worker)
 	return true;
 }
 
+inline bool FrameShrinker::downsampleByArea(Frame& frame, const unsigned int targetWidth, const unsigned int targetHeight, Worker* worker)
+{
+	Frame tmpFrame;
+	if (!downsampleByArea(frame, tmpFrame, targetWidth, targetHeight, worker))
+	{
+		return false;
+	}
+
+	ocean_assert(frame.timestamp() == tmpFrame.timestamp());
+	ocean_assert(frame.relativeTimestamp() == tmpFrame.relativeTimestamp());
+
+	frame = std::move(tmpFrame);
+	return true;
+}
+
 inline void FrameShrinker::downsampleBinayMaskByTwo8BitPerChannel11(const uint8_t* source, uint8_t* target, const unsigned int sourceWidth, const unsigned int sourceHeight, const unsigned int sourcePaddingElements, const unsigned int targetPaddingElements, const unsigned int threshold, Worker* worker)
 {
 	ocean_assert(source != nullptr && target != nullptr);
@@ -0,0 +1,407 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "ocean/cv/FrameStatistics.h"
+
+#if defined(OCEAN_HARDWARE_SSE_VERSION) && OCEAN_HARDWARE_SSE_VERSION >= 41
+	#include "ocean/cv/SSE.h"
+#endif
+
+#if defined(OCEAN_HARDWARE_NEON_VERSION) && OCEAN_HARDWARE_NEON_VERSION >= 10
+	#include "ocean/cv/NEON.h"
+#endif
+
+namespace Ocean
+{
+
+namespace CV
+{
+
+#if defined(OCEAN_HARDWARE_SSE_VERSION) && OCEAN_HARDWARE_SSE_VERSION >= 41
+
+void FrameStatistics::accumulateRow1Channel8BitSSE(const uint8_t* row, const unsigned int width, const unsigned int rowStrideElements, const bool laplaceRow, Statistics8BitPerChannel<1u>& statistics)
+{
+	ocean_assert(row != nullptr);
+	ocean_assert(width >= 1u && rowStrideElements >= width);
+
+	const StatisticType statisticTypes = statistics.statisticTypes_;
+
+	const bool determineVariance = (statisticTypes & ST_VARIANCE) == ST_VARIANCE;
+	const bool determineMinMax = (statisticTypes & ST_MIN_MAX) == ST_MIN_MAX;
+	const bool determineHistogram = (statisticTypes & ST_HISTOGRAM) == ST_HISTOGRAM;
+
+	const uint8_t* const rowTop = row - rowStrideElements;
+	const uint8_t* const rowBottom = row + rowStrideElements;
+
+	// the squared values and the Laplace responses are accumulated in 32 bit lanes, each lane receives four values per block of 16 pixels,
+	// a squared value is at most 255^2, a squared Laplace response at most (4 * 255)^2, so that 1024 blocks can be accumulated before the lanes need to be flushed
+
+	constexpr unsigned int maximalBlocksPerChunk = 1024u;
+
+	const unsigned int blocks16 = width / 16u;
+
+	// the Laplace responses are determined for the inner pixels [1, width - 2] only
+	const unsigned int laplaceBlocks16 = laplaceRow ? (width - 2u) / 16u : 0u;
+	ocean_assert(laplaceBlocks16 <= blocks16);
+
+	const __m128i zero_128 = _mm_setzero_si128();
+	const __m128i ones_s_16x8 = _mm_set1_epi16(1);
+
+	__m128i sum_u_64x2 = _mm_setzero_si128();
+	__m128i squaredSum_u_64x2 = _mm_setzero_si128();
+
+	__m128i min_u_8x16 = _mm_set1_epi8(char(0xFF));
+	__m128i max_u_8x16 = _mm_setzero_si128();
+
+	__m128i laplaceSum_s_64x2 = _mm_setzero_si128();
+	__m128i laplaceSquaredSum_u_64x2 = _mm_setzero_si128();
+
+	for (unsigned int blockStart = 0u; blockStart < blocks16; blockStart += maximalBlocksPerChunk)
+	{
+		const unsigned int blockEnd = std::min(blockStart + maximalBlocksPerChunk, blocks16);
+
+		__m128i squaredSum_u_32x4 = _mm_setzero_si128();
+
+		__m128i laplaceSum_s_32x4 = _mm_setzero_si128();
+		__m128i laplaceSquaredSum_u_32x4 = _mm_setzero_si128();
+
+		for (unsigned int nBlock = blockStart; nBlock < blockEnd; ++nBlock)
+		{
+			const unsigned int x = nBlock * 16u;
+
+			const __m128i pixels_u_8x16 = _mm_lddqu_si128((const __m128i*)(row + x));
+
+			sum_u_64x2 = _mm_add_epi64(sum_u_64x2, _mm_sad_epu8(pixels_u_8x16, zero_128));
+
+			if (determineVariance)
+			{
+				const __m128i pixelsLow_s_16x8 = _mm_cvtepu8_epi16(pixels_u_8x16);
+				const __m128i pixelsHigh_s_16x8 = _mm_unpackhi_epi8(pixels_u_8x16, zero_128);
+
+				squaredSum_u_32x4 = _mm_add_epi32(squaredSum_u_32x4, _mm_add_epi32(_mm_madd_epi16(pixelsLow_s_16x8, pixelsLow_s_16x8), _mm_madd_epi16(pixelsHigh_s_16x8, pixelsHigh_s_16x8)));
+			}
+
+			if (determineMinMax)
+			{
+				min_u_8x16 = _mm_min_epu8(min_u_8x16, pixels_u_8x16);
+				max_u_8x16 = _mm_max_epu8(max_u_8x16, pixels_u_8x16);
+			}
+
+			if (determineHistogram)
+			{
+				for (unsigned int n = 0u; n < 16u; ++n)
+				{
+					statistics.histogram_.incrementBin(0u, row[x + n]);
+				}
+			}
+
+			if (nBlock < laplaceBlocks16)
+			{
+				// response = 4 * center - top - left - right - bottom, for the pixels [x + 1, x + 16]
+
+				const __m128i top_u_8x16 = _mm_lddqu_si128((const __m128i*)(rowTop + x + 1u));
+				const __m128i left_u_8x16 = pixels_u_8x16;
+				const __m128i center_u_8x16 = _mm_lddqu_si128((const __m128i*)(row + x + 1u));
+				const __m128i right_u_8x16 = _mm_lddqu_si128((const __m128i*)(row + x + 2u));
+				const __m128i bottom_u_8x16 = _mm_lddqu_si128((const __m128i*)(rowBottom + x + 1u));
+
+				const __m128i neighborsLow_s_16x8 = _mm_add_epi16(_mm_add_epi16(_mm_cvtepu8_epi16(top_u_8x16), _mm_cvtepu8_epi16(bottom_u_8x16)), _mm_add_epi16(_mm_cvtepu8_epi16(left_u_8x16), _mm_cvtepu8_epi16(right_u_8x16)));
+				const __m128i neighborsHigh_s_16x8 = _mm_add_epi16(_mm_add_epi16(_mm_unpackhi_epi8(top_u_8x16, zero_128), _mm_unpackhi_epi8(bottom_u_8x16, zero_128)), _mm_add_epi16(_mm_unpackhi_epi8(left_u_8x16, zero_128), _mm_unpackhi_epi8(right_u_8x16, zero_128)));
+
+				const __m128i responseLow_s_16x8 = _mm_sub_epi16(_mm_slli_epi16(_mm_cvtepu8_epi16(center_u_8x16), 2), neighborsLow_s_16x8);
+				const __m128i responseHigh_s_16x8 = _mm_sub_epi16(_mm_slli_epi16(_mm_unpackhi_epi8(center_u_8x16, zero_128), 2), neighborsHigh_s_16x8);
+
+				laplaceSum_s_32x4 = _mm_add_epi32(laplaceSum_s_32x4, _mm_add_epi32(_mm_madd_epi16(responseLow_s_16x8, ones_s_16x8), _mm_madd_epi16(responseHigh_s_16x8, ones_s_16x8)));
+				laplaceSquaredSum_u_32x4 = _mm_add_epi32(laplaceSquaredSum_u_32x4, _mm_add_epi32(_mm_madd_epi16(responseLow_s_16x8, responseLow_s_16x8), _mm_madd_epi16(responseHigh_s_16x8, responseHigh_s_16x8)));
+			}
+		}
+
+		squaredSum_u_64x2 = _mm_add_epi64(squaredSum_u_64x2, _mm_add_epi64(_mm_unpacklo_epi32(squaredSum_u_32x4, zero_128), _mm_unpackhi_epi32(squaredSum_u_32x4, zero_128)));
+
+		laplaceSum_s_64x2 = _mm_add_epi64(laplaceSum_s_64x2, _mm_add_epi64(_mm_cvtepi32_epi64(laplaceSum_s_32x4), _mm_cvtepi32_epi64(_mm_srli_si128(laplaceSum_s_32x4, 8))));
+		laplaceSquaredSum_u_64x2 = _mm_add_epi64(laplaceSquaredSum_u_64x2, _mm_add_epi64(_mm_unpacklo_epi32(laplaceSquaredSum_u_32x4, zero_128), _mm_unpackhi_epi32(laplaceSquaredSum_u_32x4, zero_128)));
+	}
+
+	OCEAN_ALIGN_DATA(16) uint64_t sums[2];
+	_mm_store_si128((__m128i*)sums, sum_u_64x2);
+
+	OCEAN_ALIGN_DATA(16) uint64_t squaredSums[2];
+	_mm_store_si128((__m128i*)squaredSums, squaredSum_u_64x2);
+
+	uint64_t sum = sums[0] + sums[1];
+	uint64_t squaredSum = squaredSums[0] + squaredSums[1];
+
+	uint8_t minValue = statistics.minValues_[0];
+	uint8_t maxValue = statistics.maxValues_[0];
+
+	if (determineMinMax && blocks16 != 0u)
+	{
+		min_u_8x16 = _mm_min_epu8(min_u_8x16, _mm_srli_si128(min_u_8x16, 8));
+		min_u_8x16 = _mm_min_epu8(min_u_8x16, _mm_srli_si128(min_u_8x16, 4));
+		min_u_8x16 = _mm_min_epu8(min_u_8x16, _mm_srli_si128(min_u_8x16, 2));
+		min_u_8x16 = _mm_min_epu8(min_u_8x16, _mm_srli_si128(min_u_8x16, 1));
+
+		max_u_8x16 = _mm_max_epu8(max_u_8x16, _mm_srli_si128(max_u_8x16, 8));
+		max_u_8x16 = _mm_max_epu8(max_u_8x16, _mm_srli_si128(max_u_8x16, 4));
+		max_u_8x16 = _mm_max_epu8(max_u_8x16, _mm_srli_si128(max_u_8x16, 2));
+		max_u_8x16 = _mm_max_epu8(max_u_8x16, _mm_srli_si128(max_u_8x16, 1));
+
+		minValue = std::min(minValue, uint8_t(_mm_extract_epi8(min_u_8x16, 0)));
+		maxValue = std::max(maxValue, uint8_t(_mm_extract_epi8(max_u_8x16, 0)));
+	}
+
+	// the remaining pixels
+
+	for (unsigned int x = blocks16 * 16u; x < width; ++x)
+	{
+		const uint32_t value = uint32_t(row[x]);
+
+		sum += value;
+		squaredSum += value * value;
+
+		minValue = std::min(minValue, row[x]);
+		maxValue = std::max(maxValue, row[x]);
+
+		if (determineHistogram)
+		{
+			statistics.histogram_.incrementBin(0u, row[x]);
+		}
+	}
+
+	statistics.pixels_ += width;
+	statistics.sums_[0] += sum;
+
+	if (determineVariance)
+	{
+		statistics.squaredSums_[0] += squaredSum;
+	}
+
+	if (determineMinMax)
+	{
+		statistics.minValues_[0] = minValue;
+		statistics.maxValues_[0] = maxValue;
+	}
+
+	if (laplaceRow)
+	{
+		ocean_assert(width >= 3u);
+
+		OCEAN_ALIGN_DATA(16) int64_t laplaceSums[2];
+		_mm_store_si128((__m128i*)laplaceSums, laplaceSum_s_64x2);
+
+		OCEAN_ALIGN_DATA(16) uint64_t laplaceSquaredSums[2];
+		_mm_store_si128((__m128i*)laplaceSquaredSums, laplaceSquaredSum_u_64x2);
+
+		int64_t laplaceSum = laplaceSums[0] + laplaceSums[1];
+		uint64_t laplaceSquaredSum = laplaceSquaredSums[0] + laplaceSquaredSums[1];
+
+		for (unsigned int x = laplaceBlocks16 * 16u + 1u; x < width - 1u; ++x)
+		{
+			const int32_t response = int32_t(row[x]) * 4 - int32_t(rowTop[x]) - int32_t(row[x - 1u]) - int32_t(row[x + 1u]) - int32_t(rowBottom[x]);
+
+			laplaceSum += response;
+			laplaceSquaredSum += uint64_t(response * response);
+		}
+
+		statistics.laplaceSums_[0] += laplaceSum;
+		statistics.laplaceSquaredSums_[0] += laplaceSquaredSum;
+		statistics.laplacePixels_ += width - 2u;
+	}
+}
+
+#endif // OCEAN_HARDWARE_SSE_VERSION >= 41
+
+#if defined(OCEAN_HARDWARE_NEON_VERSION) && OCEAN_HARDWARE_NEON_VERSION >= 10
+
+void FrameStatistics::accumulateRow1Channel8BitNEON(const uint8_t* row, const unsigned int width, const unsigned int rowStrideElements, const bool laplaceRow, Statistics8BitPerChannel<1u>& statistics)
+{
+	ocean_assert(row != nullptr);
+	ocean_assert(width >= 1u && rowStrideElements >= width);
+
+	const StatisticType statisticTypes = statistics.statisticTypes_;
+
+	const bool determineVariance = (statisticTypes & ST_VARIANCE) == ST_VARIANCE;
+	const bool determineMinMax = (statisticTypes & ST_MIN_MAX) == ST_MIN_MAX;
+	const bool determineHistogram = (statisticTypes & ST_HISTOGRAM) == ST_HISTOGRAM;
+
+	const uint8_t* const rowTop = row - rowStrideElements;
+	const uint8_t* const rowBottom = row + rowStrideElements;
+
+	// the values, squared values, and Laplace responses are accumulated in 32 bit lanes, each lane receives at most four values per block of 16 pixels,
+	// a squared value is at most 255^2, a squared Laplace response at most (4 * 255)^2, so that 1024 blocks can be accumulated before the lanes need to be flushed
+
+	constexpr unsigned int maximalBlocksPerChunk = 1024u;
+
+	const unsigned int blocks16 = width / 16u;
+
+	// the Laplace responses are determined for the inner pixels [1, width - 2] only
+	const unsigned int laplaceBlocks16 = laplaceRow ? (width - 2u) / 16u : 0u;
+	ocean_assert(laplaceBlocks16 <= blocks16);
+
+	uint64x2_t sum_u_64x2 = vdupq_n_u64(0ull);
+	uint64x2_t squaredSum_u_64x2 = vdupq_n_u64(0ull);
+
+	uint8x16_t min_u_8x16 = vdupq_n_u8(0xFFu);
+	uint8x16_t max_u_8x16 = vdupq_n_u8(0u);
+
+	int64x2_t laplaceSum_s_64x2 = vdupq_n_s64(0ll);
+	uint64x2_t laplaceSquaredSum_u_64x2 = vdupq_n_u64(0ull);
+
+	for (unsigned int blockStart = 0u; blockStart < blocks16; blockStart += maximalBlocksPerChunk)
+	{
+		const unsigned int blockEnd = std::min(blockStart + maximalBlocksPerChunk, blocks16);
+
+		uint32x4_t sum_u_32x4 = vdupq_n_u32(0u);
+		uint32x4_t squaredSum_u_32x4 = vdupq_n_u32(0u);
+
+		int32x4_t laplaceSum_s_32x4 = vdupq_n_s32(0);
+		uint32x4_t laplaceSquaredSum_u_32x4 = vdupq_n_u32(0u);
+
+		for (unsigned int nBlock = blockStart; nBlock < blockEnd; ++nBlock)
+		{
+			const unsigned int x = nBlock * 16u;
+
+			const uint8x16_t pixels_u_8x16 = vld1q_u8(row + x);
+
+			sum_u_32x4 = vpadalq_u16(sum_u_32x4, vpaddlq_u8(pixels_u_8x16));
+
+			if (determineVariance)
+			{
+				squaredSum_u_32x4 = vpadalq_u16(squaredSum_u_32x4, vmull_u8(vget_low_u8(pixels_u_8x16), vget_low_u8(pixels_u_8x16)));
+				squaredSum_u_32x4 = vpadalq_u16(squaredSum_u_32x4, vmull_u8(vget_high_u8(pixels_u_8x16), vget_high_u8(pixels_u_8x16)));
+			}
+
+			if (determineMinMax)
+			{
+				min_u_8x16 = vminq_u8(min_u_8x16, pixels_u_8x16);
+				max_u_8x16 = vmaxq_u8(max_u_8x16, pixels_u_8x16);
+			}
+
+			if (determineHistogram)
+			{
+				for (unsigned int n = 0u; n < 16u; ++n)
+				{
+					statistics.histogram_.incrementBin(0u, row[x + n]);
+				}
+			}
+
+			if (nBlock < laplaceBlocks16)
+			{
+				// response = 4 * center - top - left - right - bottom, for the pixels [x + 1, x + 16]
+
+				const uint8x16_t top_u_8x16 = vld1q_u8(rowTop + x + 1u);
+				const uint8x16_t left_u_8x16 = pixels_u_8x16;
+				const uint8x16_t center_u_8x16 = vld1q_u8(row + x + 1u);
+				const uint8x16_t right_u_8x16 = vld1q_u8(row + x + 2u);
+				const uint8x16_t bottom_u_8x16 = vld1q_u8(rowBottom + x + 1u);
+
+				const uint16x8_t neighborsLow_u_16x8 = vaddq_u16(vaddl_u8(vget_low_u8(top_u_8x16), vget_low_u8(bottom_u_8x16)), vaddl_u8(vget_low_u8(left_u_8x16), vget_low_u8(right_u_8x16)));
+				const uint16x8_t neighborsHigh_u_16x8 = vaddq_u16(vaddl_u8(vget_high_u8(top_u_8x16), vget_high_u8(bottom_u_8x16)), vaddl_u8(vget_high_u8(left_u_8x16), vget_high_u8(right_u_8x16)));
+
+				const int16x8_t responseLow_s_16x8 = vsubq_s16(vreinterpretq_s16_u16(vshll_n_u8(vget_low_u8(center_u_8x16), 2)), vreinterpretq_s16_u16(neighborsLow_u_16x8));
+				const int16x8_t responseHigh_s_16x8 = vsubq_s16(vreinterpretq_s16_u16(vshll_n_u8(vget_high_u8(center_u_8x16), 2)), vreinterpretq_s16_u16(neighborsHigh_u_16x8));
+
+				laplaceSum_s_32x4 = vpadalq_s16(laplaceSum_s_32x4, responseLow_s_16x8);
+				laplaceSum_s_32x4 = vpadalq_s16(laplaceSum_s_32x4, responseHigh_s_16x8);
+
+				const uint16x8_t absResponseLow_u_16x8 = vreinterpretq_u16_s16(vabsq_s16(responseLow_s_16x8));
+				const uint16x8_t absResponseHigh_u_16x8 = vreinterpretq_u16_s16(vabsq_s16(responseHigh_s_16x8));
+
+				laplaceSquaredSum_u_32x4 = vmlal_u16(laplaceSquaredSum_u_32x4, vget_low_u16(absResponseLow_u_16x8), vget_low_u16(absResponseLow_u_16x8));
+				laplaceSquaredSum_u_32x4 = vmlal_u16(laplaceSquaredSum_u_32x4, vget_high_u16(absResponseLow_u_16x8), vget_high_u16(absResponseLow_u_16x8));
+				laplaceSquaredSum_u_32x4 = vmlal_u16(laplaceSquaredSum_u_32x4, vget_low_u16(absResponseHigh_u_16x8), vget_low_u16(absResponseHigh_u_16x8));
+				laplaceSquaredSum_u_32x4 = vmlal_u16(laplaceSquaredSum_u_32x4, vget_high_u16(absResponseHigh_u_16x8), vget_high_u16(absResponseHigh_u_16x8));
+			}
+		}
+
+		sum_u_64x2 = vpadalq_u32(sum_u_64x2, sum_u_32x4);
+		squaredSum_u_64x2 = vpadalq_u32(squaredSum_u_64x2, squaredSum_u_32x4);
+
+		laplaceSum_s_64x2 = vpadalq_s32(laplaceSum_s_64x2, laplaceSum_s_32x4);
+		laplaceSquaredSum_u_64x2 = vpadalq_u32(laplaceSquaredSum_u_64x2, laplaceSquaredSum_u_32x4);
+	}
+
+	uint64_t sum = vgetq_lane_u64(sum_u_64x2, 0) + vgetq_lane_u64(sum_u_64x2, 1);
+	uint64_t squaredSum = vgetq_lane_u64(squaredSum_u_64x2, 0) + vgetq_lane_u64(squaredSum_u_64x2, 1);
+
+	uint8_t minValue = statistics.minValues_[0];
+	uint8_t maxValue = statistics.maxValues_[0];
+
+	if (determineMinMax && blocks16 != 0u)
+	{
+		uint8x8_t min_u_8x8 = vmin_u8(vget_low_u8(min_u_8x16), vget_high_u8(min_u_8x16));
+		min_u_8x8 = vpmin_u8(min_u_8x8, min_u_8x8);
+		min_u_8x8 = vpmin_u8(min_u_8x8, min_u_8x8);
+		min_u_8x8 = vpmin_u8(min_u_8x8, min_u_8x8);
+
+		uint8x8_t max_u_8x8 = vmax_u8(vget_low_u8(max_u_8x16), vget_high_u8(max_u_8x16));
+		max_u_8x8 = vpmax_u8(max_u_8x8, max_u_8x8);
+		max_u_8x8 = vpmax_u8(max_u_8x8, max_u_8x8);
+		max_u_8x8 = vpmax_u8(max_u_8x8, max_u_8x8);
+
+		minValue = std::min(minValue, vget_lane_u8(min_u_8x8, 0));
+		maxValue = std::max(maxValue, vget_lane_u8(max_u_8x8, 0));
+	}
+
+	// the remaining pixels
+
+	for (unsigned int x = blocks16 * 16u; x < width; ++x)
+	{
+		const uint32_t value = uint32_t(row[x]);
+
+		sum += value;
+		squaredSum += value * value;
+
+		minValue = std::min(minValue, row[x]);
+		maxValue = std::max(maxValue, row[x]);
+
+		if (determineHistogram)
+		{
+			statistics.histogram_.incrementBin(0u, row[x]);
+		}
+	}
+
+	statistics.pixels_ += width;
+	statistics.sums_[0] += sum;
+
+	if (determineVariance)
+	{
+		statistics.squaredSums_[0] += squaredSum;
+	}
+
+	if (determineMinMax)
+	{
+		statistics.minValues_[0] = minValue;
+		statistics.maxValues_[0] = maxValue;
+	}
+
+	if (laplaceRow)
+	{
+		ocean_assert(width >= 3u);
+
+		int64_t laplaceSum = vgetq_lane_s64(laplaceSum_s_64x2, 0) + vgetq_lane_s64(laplaceSum_s_64x2, 1);
+		uint64_t laplaceSquaredSum = vgetq_lane_u64(laplaceSquaredSum_u_64x2, 0) + vgetq_lane_u64(laplaceSquaredSum_u_64x2, 1);
+
+		for (unsigned int x = laplaceBlocks16 * 16u + 1u; x < width - 1u; ++x)
+		{
+			const int32_t response = int32_t(row[x]) * 4 - int32_t(rowTop[x]) - int32_t(row[x - 1u]) - int32_t(row[x + 1u]) - int32_t(rowBottom[x]);
+
+			laplaceSum += response;
+			laplaceSquaredSum += uint64_t(response * response);
+		}
+
+		statistics.laplaceSums_[0] += laplaceSum;
+		statistics.laplaceSquaredSums_[0] += laplaceSquaredSum;
+		statistics.laplacePixels_ += width - 2u;
+	}
+}
+
+#endif // OCEAN_HARDWARE_NEON_VERSION >= 10
+
+}
+
+}
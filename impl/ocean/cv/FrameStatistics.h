@@ -0,0 +1,545 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#ifndef META_OCEAN_CV_FRAME_STATISTICS_H
+#define META_OCEAN_CV_FRAME_STATISTICS_H
+
+#include "ocean/cv/CV.h"
+#include "ocean/cv/Histogram.h"
+
+#include "ocean/base/Lock.h"
+#include "ocean/base/Worker.h"
+
+#include "ocean/math/Numeric.h"
+
+namespace Ocean
+{
+
+namespace CV
+{
+
+/**
+ * This class implements functions determining several image statistics within one pass over the frame.
+ * The statistics correspond to the results of FrameMean, FrameVariance, FrameMinMax, Histogram, and FrameFilterLaplace::variance1Channel8Bit().<br>
+ * Instead of visiting the frame once for each statistic, any subset of the statistics can be determined while each pixel is read only once.
+ * @ingroup cv
+ */
+class OCEAN_CV_EXPORT FrameStatistics
+{
+	public:
+
+		/**
+		 * Definition of individual statistics which can be combined.
+		 */
+		enum StatisticType : uint32_t
+		{
+			/// No statistic.
+			ST_NONE = 0u,
+			/// The mean value of each channel.
+			ST_MEAN = 1u << 0u,
+			/// The variance (and standard deviation) of each channel, includes the mean value.
+			ST_VARIANCE = (1u << 1u) | ST_MEAN,
+			/// The minimal and maximal value of each channel.
+			ST_MIN_MAX = 1u << 2u,
+			/// The histogram of each channel.
+			ST_HISTOGRAM = 1u << 3u,
+			/// The sharpness of each channel, defined as the variance of the Laplace responses of all inner pixels.
+			ST_SHARPNESS = 1u << 4u,
+			/// All statistics.
+			ST_ALL = ST_MEAN | ST_VARIANCE | ST_MIN_MAX | ST_HISTOGRAM | ST_SHARPNESS
+		};
+
+		/**
+		 * This class holds the statistics of a frame with 8 bit per channel.
+		 * The object stores the accumulated sums so that statistics of individual frame areas can be merged.
+		 * @tparam tChannels The number of frame channels, with range [1, infinity)
+		 */
+		template <unsigned int tChannels>
+		class Statistics8BitPerChannel
+		{
+			friend class FrameStatistics;
+
+			public:
+
+				/**
+				 * Creates a new statistics object with empty accumulators.
+				 * @param statisticTypes The statistics which will be determined
+				 */
+				explicit inline Statistics8BitPerChannel(const StatisticType statisticTypes = ST_NONE);
+
+				/**
+				 * Returns the statistics this object holds.
+				 * @return The statistic types
+				 */
+				inline StatisticType statisticTypes() const;
+
+				/**
+				 * Returns the number of pixels which have been accumulated.
+				 * @return The number of pixels, with range [0, infinity)
+				 */
+				inline uint64_t pixels() const;
+
+				/**
+				 * Returns the mean value of one channel.
+				 * The statistic must contain ST_MEAN.
+				 * @param channel The index of the channel, with range [0, tChannels - 1]
+				 * @return The mean value, with range [0, 255]
+				 */
+				inline double mean(const unsigned int channel = 0u) const;
+
+				/**
+				 * Returns the variance of one channel.
+				 * The statistic must contain ST_VARIANCE.
+				 * @param channel The index of the channel, with range [0, tChannels - 1]
+				 * @return The variance, with range [0, infinity)
+				 */
+				inline double variance(const unsigned int channel = 0u) const;
+
+				/**
+				 * Returns the standard deviation of one channel.
+				 * The statistic must contain ST_VARIANCE.
+				 * @param channel The index of the channel, with range [0, tChannels - 1]
+				 * @return The standard deviation, with range [0, infinity)
+				 */
+				inline double standardDeviation(const unsigned int channel = 0u) const;
+
+				/**
+				 * Returns the minimal value of one channel.
+				 * The statistic must contain ST_MIN_MAX.
+				 * @param channel The index of the channel, with range [0, tChannels - 1]
+				 * @return The minimal value
+				 */
+				inline uint8_t minValue(const unsigned int channel = 0u) const;
+
+				/**
+				 * Returns the maximal value of one channel.
+				 * The statistic must contain ST_MIN_MAX.
+				 * @param channel The index of the channel, with range [0, tChannels - 1]
+				 * @return The maximal value
+				 */
+				inline uint8_t maxValue(const unsigned int channel = 0u) const;
+
+				/**
+				 * Returns the histogram of all channels.
+				 * The statistic must contain ST_HISTOGRAM.
+				 * @return The histogram
+				 */
+				inline const Histogram::Histogram8BitPerChannel<tChannels>& histogram() const;
+
+				/**
+				 * Returns the sharpness of one channel, the variance of the responses of a 3x3 Laplace filter (with 4-neighborhood) for all pixels not located at the frame border.
+				 * The statistic must contain ST_SHARPNESS, the value is identical to the result of FrameFilterLaplace::variance1Channel8Bit().
+				 * @param channel The index of the channel, with range [0, tChannels - 1]
+				 * @return The sharpness, with range [0, infinity), 0 if the frame is smaller than 3x3
+				 */
+				inline double sharpness(const unsigned int channel = 0u) const;
+
+				/**
+				 * Adds the accumulators of a second statistics object determined for a different area of the frame.
+				 * @param statistics The statistics to add, must have the same statistic types
+				 * @return Reference to this object
+				 */
+				Statistics8BitPerChannel<tChannels>& operator+=(const Statistics8BitPerChannel<tChannels>& statistics);
+
+				/**
+				 * Returns whether this object holds statistics of at least one pixel.
+				 * @return True, if so
+				 */
+				explicit inline operator bool() const;
+
+			protected:
+
+				/// The statistics this object holds.
+				StatisticType statisticTypes_ = ST_NONE;
+
+				/// The number of accumulated pixels.
+				uint64_t pixels_ = 0ull;
+
+				/// The sums of all pixel values, one for each channel.
+				uint64_t sums_[tChannels] = {};
+
+				/// The sums of all squared pixel values, one for each channel.
+				uint64_t squaredSums_[tChannels] = {};
+
+				/// The minimal values, one for each channel.
+				uint8_t minValues_[tChannels];
+
+				/// The maximal values, one for each channel.
+				uint8_t maxValues_[tChannels];
+
+				/// The histogram of all channels.
+				Histogram::Histogram8BitPerChannel<tChannels> histogram_;
+
+				/// The number of accumulated Laplace responses.
+				uint64_t laplacePixels_ = 0ull;
+
+				/// The sums of all Laplace responses, one for each channel.
+				int64_t laplaceSums_[tChannels] = {};
+
+				/// The sums of all squared Laplace responses, one for each channel.
+				uint64_t laplaceSquaredSums_[tChannels] = {};
+		};
+
+	public:
+
+		/**
+		 * Determines several statistics of a frame with 8 bit per channel within one pass.
+		 * @param frame The frame for which the statistics will be determined, must be valid
+		 * @param width The width of the frame in pixel, with range [1, infinity)
+		 * @param height The height of the frame in pixel, with range [1, infinity)
+		 * @param framePaddingElements The number of padding elements at the end of each frame row, in elements, with range [0, infinity)
+		 * @param statisticTypes The statistics to determine, must not be ST_NONE
+		 * @param worker Optional worker object to distribute the computation, each thread accumulates the statistics of a band of rows which are merged at the end
+		 * @return The resulting statistics
+		 * @tparam tChannels The number of frame channels, with range [1, infinity)
+		 */
+		template <unsigned int tChannels>
+		static Statistics8BitPerChannel<tChannels> determineStatistics8BitPerChannel(const uint8_t* frame, const unsigned int width, const unsigned int height, const unsigned int framePaddingElements, const StatisticType statisticTypes, Worker* worker = nullptr);
+
+	protected:
+
+		/**
+		 * Determines the statistics of a subset of rows of a frame with 8 bit per channel.
+		 * @param frame The frame for which the statistics will be determined, must be valid
+		 * @param width The width of the frame in pixel, with range [1, infinity)
+		 * @param height The height of the frame in pixel, with range [1, infinity)
+		 * @param framePaddingElements The number of padding elements at the end of each frame row, in elements, with range [0, infinity)
+		 * @param statistics The statistics to which the statistics of the subset will be added, must be valid
+		 * @param lock Optional lock if this function is executed distributed within several threads
+		 * @param firstRow The first row to be handled, with range [0, height - 1]
+		 * @param numberRows The number of rows to be handled, with range [1, height - firstRow]
+		 * @tparam tChannels The number of frame channels, with range [1, infinity)
+		 */
+		template <unsigned int tChannels>
+		static void determineStatistics8BitPerChannelSubset(const uint8_t* frame, const unsigned int width, const unsigned int height, const unsigned int framePaddingElements, Statistics8BitPerChannel<tChannels>* statistics, Lock* lock, const unsigned int firstRow, const unsigned int numberRows);
+
+		/**
+		 * Accumulates the statistics of one frame row with 8 bit per channel.
+		 * @param row The frame row, must be valid
+		 * @param width The width of the frame in pixel, with range [1, infinity)
+		 * @param rowStrideElements The number of elements between the start of two consecutive rows, in elements, with range [width * tChannels, infinity)
+		 * @param laplaceRow True, if the row has a row above and a row below so that Laplace responses are determined; False, otherwise
+		 * @param statistics The statistics to which the row will be added
+		 * @tparam tChannels The number of frame channels, with range [1, infinity)
+		 */
+		template <unsigned int tChannels>
+		static void accumulateRow8BitPerChannel(const uint8_t* row, const unsigned int width, const unsigned int rowStrideElements, const bool laplaceRow, Statistics8BitPerChannel<tChannels>& statistics);
+
+#if defined(OCEAN_HARDWARE_SSE_VERSION) && OCEAN_HARDWARE_SSE_VERSION >= 41
+
+		/**
+		 * Accumulates the statistics of one frame row with 1 channel and 8 bit per channel using SSE.
+		 * @param row The frame row, must be valid
+		 * @param width The width of the frame in pixel, with range [1, infinity)
+		 * @param rowStrideElements The number of elements between the start of two consecutive rows, in elements, with range [width, infinity)
+		 * @param laplaceRow True, if the row has a row above and a row below so that Laplace responses are determined; False, otherwise
+		 * @param statistics The statistics to which the row will be added
+		 */
+		static void accumulateRow1Channel8BitSSE(const uint8_t* row, const unsigned int width, const unsigned int rowStrideElements, const bool laplaceRow, Statistics8BitPerChannel<1u>& statistics);
+
+#endif // OCEAN_HARDWARE_SSE_VERSION >= 41
+
+#if defined(OCEAN_HARDWARE_NEON_VERSION) && OCEAN_HARDWARE_NEON_VERSION >= 10
+
+		/**
+		 * Accumulates the statistics of one frame row with 1 channel and 8 bit per channel using NEON.
+		 * @param row The frame row, must be valid
+		 * @param width The width of the frame in pixel, with range [1, infinity)
+		 * @param rowStrideElements The number of elements between the start of two consecutive rows, in elements, with range [width, infinity)
+		 * @param laplaceRow True, if the row has a row above and a row below so that Laplace responses are determined; False, otherwise
+		 * @param statistics The statistics to which the row will be added
+		 */
+		static void accumulateRow1Channel8BitNEON(const uint8_t* row, const unsigned int width, const unsigned int rowStrideElements, const bool laplaceRow, Statistics8BitPerChannel<1u>& statistics);
+
+#endif // OCEAN_HARDWARE_NEON_VERSION >= 10
+};
+
+template <unsigned int tChannels>
+inline FrameStatistics::Statistics8BitPerChannel<tChannels>::Statistics8BitPerChannel(const StatisticType statisticTypes) :
+	statisticTypes_(statisticTypes)
+{
+	static_assert(tChannels >= 1u, "Invalid channel number!");
+
+	for (unsigned int n = 0u; n < tChannels; ++n)
+	{
+		minValues_[n] = 255u;
+		maxValues_[n] = 0u;
+	}
+}
+
+template <unsigned int tChannels>
+inline FrameStatistics::StatisticType FrameStatistics::Statistics8BitPerChannel<tChannels>::statisticTypes() const
+{
+	return statisticTypes_;
+}
+
+template <unsigned int tChannels>
+inline uint64_t FrameStatistics::Statistics8BitPerChannel<tChannels>::pixels() const
+{
+	return pixels_;
+}
+
+template <unsigned int tChannels>
+inline double FrameStatistics::Statistics8BitPerChannel<tChannels>::mean(const unsigned int channel) const
+{
+	ocean_assert(channel < tChannels);
+	ocean_assert((statisticTypes_ & ST_MEAN) == ST_MEAN);
+	ocean_assert(pixels_ != 0ull);
+
+	return double(sums_[channel]) / double(pixels_);
+}
+
+template <unsigned int tChannels>
+inline double FrameStatistics::Statistics8BitPerChannel<tChannels>::variance(const unsigned int channel) const
+{
+	ocean_assert(channel < tChannels);
+	ocean_assert((statisticTypes_ & ST_VARIANCE) == ST_VARIANCE);
+	ocean_assert(pixels_ != 0ull);
+
+	const double normalizer = 1.0 / double(pixels_);
+	const double meanValue = double(sums_[channel]) * normalizer;
+
+	return std::max(0.0, double(squaredSums_[channel]) * normalizer - meanValue * meanValue);
+}
+
+template <unsigned int tChannels>
+inline double FrameStatistics::Statistics8BitPerChannel<tChannels>::standardDeviation(const unsigned int channel) const
+{
+	return NumericD::sqrt(variance(channel));
+}
+
+template <unsigned int tChannels>
+inline uint8_t FrameStatistics::Statistics8BitPerChannel<tChannels>::minValue(const unsigned int channel) const
+{
+	ocean_assert(channel < tChannels);
+	ocean_assert((statisticTypes_ & ST_MIN_MAX) == ST_MIN_MAX);
+
+	return minValues_[channel];
+}
+
+template <unsigned int tChannels>
+inline uint8_t FrameStatistics::Statistics8BitPerChannel<tChannels>::maxValue(const unsigned int channel) const
+{
+	ocean_assert(channel < tChannels);
+	ocean_assert((statisticTypes_ & ST_MIN_MAX) == ST_MIN_MAX);
+
+	return maxValues_[channel];
+}
+
+template <unsigned int tChannels>
+inline const Histogram::Histogram8BitPerChannel<tChannels>& FrameStatistics::Statistics8BitPerChannel<tChannels>::histogram() const
+{
+	ocean_assert((statisticTypes_ & ST_HISTOGRAM) == ST_HISTOGRAM);
+
+	return histogram_;
+}
+
+template <unsigned int tChannels>
+inline double FrameStatistics::Statistics8BitPerChannel<tChannels>::sharpness(const unsigned int channel) const
+{
+	ocean_assert(channel < tChannels);
+	ocean_assert((statisticTypes_ & ST_SHARPNESS) == ST_SHARPNESS);
+
+	if (laplacePixels_ == 0ull)
+	{
+		return 0.0;
+	}
+
+	const double normalizer = 1.0 / double(laplacePixels_);
+	const double meanResponse = double(laplaceSums_[channel]) * normalizer;
+
+	return std::max(0.0, double(laplaceSquaredSums_[channel]) * normalizer - meanResponse * meanResponse);
+}
+
+template <unsigned int tChannels>
+FrameStatistics::Statistics8BitPerChannel<tChannels>& FrameStatistics::Statistics8BitPerChannel<tChannels>::operator+=(const Statistics8BitPerChannel<tChannels>& statistics)
+{
+	ocean_assert(statisticTypes_ == statistics.statisticTypes_);
+
+	pixels_ += statistics.pixels_;
+	laplacePixels_ += statistics.laplacePixels_;
+
+	for (unsigned int n = 0u; n < tChannels; ++n)
+	{
+		sums_[n] += statistics.sums_[n];
+		squaredSums_[n] += statistics.squaredSums_[n];
+
+		minValues_[n] = std::min(minValues_[n], statistics.minValues_[n]);
+		maxValues_[n] = std::max(maxValues_[n], statistics.maxValues_[n]);
+
+		laplaceSums_[n] += statistics.laplaceSums_[n];
+		laplaceSquaredSums_[n] += statistics.laplaceSquaredSums_[n];
+	}
+
+	if (statisticTypes_ & ST_HISTOGRAM)
+	{
+		histogram_ += statistics.histogram_;
+	}
+
+	return *this;
+}
+
+template <unsigned int tChannels>
+inline FrameStatistics::Statistics8BitPerChannel<tChannels>::operator bool() const
+{
+	return pixels_ != 0ull;
+}
+
+template <unsigned int tChannels>
+FrameStatistics::Statistics8BitPerChannel<tChannels> FrameStatistics::determineStatistics8BitPerChannel(const uint8_t* frame, const unsigned int width, const unsigned int height, const unsigned int framePaddingElements, const StatisticType statisticTypes, Worker* worker)
+{
+	static_assert(tChannels >= 1u, "Invalid channel number!");
+
+	ocean_assert(frame != nullptr);
+	ocean_assert(width >= 1u && height >= 1u);
+	ocean_assert(statisticTypes != ST_NONE);
+
+	Statistics8BitPerChannel<tChannels> statistics(statisticTypes);
+
+	if (worker)
+	{
+		Lock lock;
+		worker->executeFunction(Worker::Function::createStatic(&FrameStatistics::determineStatistics8BitPerChannelSubset<tChannels>, frame, width, height, framePaddingElements, &statistics, &lock, 0u, 0u), 0u, height, 6u, 7u, 20u);
+	}
+	else
+	{
+		determineStatistics8BitPerChannelSubset<tChannels>(frame, width, height, framePaddingElements, &statistics, nullptr, 0u, height);
+	}
+
+	return statistics;
+}
+
+template <unsigned int tChannels>
+void FrameStatistics::determineStatistics8BitPerChannelSubset(const uint8_t* frame, const unsigned int width, const unsigned int height, const unsigned int framePaddingElements, Statistics8BitPerChannel<tChannels>* statistics, Lock* lock, const unsigned int firstRow, const unsigned int numberRows)
+{
+	static_assert(tChannels >= 1u, "Invalid channel number!");
+
+	ocean_assert(frame != nullptr && statistics != nullptr);
+	ocean_assert(width >= 1u && height >= 1u);
+	ocean_assert(firstRow + numberRows <= height);
+
+	const unsigned int frameStrideElements = width * tChannels + framePaddingElements;
+
+	// each band accumulates its own partial statistics, which are merged once the band is done
+
+	Statistics8BitPerChannel<tChannels> localStatistics(statistics->statisticTypes_);
+
+	const bool determineSharpness = (statistics->statisticTypes_ & ST_SHARPNESS) == ST_SHARPNESS && width >= 3u && height >= 3u;
+
+	for (unsigned int y = firstRow; y < firstRow + numberRows; ++y)
+	{
+		const bool laplaceRow = determineSharpness && y >= 1u && y + 1u < height;
+
+		const uint8_t* const row = frame + y * frameStrideElements;
+
+#if defined(OCEAN_HARDWARE_SSE_VERSION) && OCEAN_HARDWARE_SSE_VERSION >= 41
+
+		if constexpr (tChannels == 1u)
+		{
+			accumulateRow1Channel8BitSSE(row, width, frameStrideElements, laplaceRow, localStatistics);
+			continue;
+		}
+
+#elif defined(OCEAN_HARDWARE_NEON_VERSION) && OCEAN_HARDWARE_NEON_VERSION >= 10
+
+		if constexpr (tChannels == 1u)
+		{
+			accumulateRow1Channel8BitNEON(row, width, frameStrideElements, laplaceRow, localStatistics);
+			continue;
+		}
+
+#endif
+
+		accumulateRow8BitPerChannel<tChannels>(row, width, frameStrideElements, laplaceRow, localStatistics);
+	}
+
+	const OptionalScopedLock scopedLock(lock);
+
+	*statistics += localStatistics;
+}
+
+template <unsigned int tChannels>
+void FrameStatistics::accumulateRow8BitPerChannel(const uint8_t* row, const unsigned int width, const unsigned int rowStrideElements, const bool laplaceRow, Statistics8BitPerChannel<tChannels>& statistics)
+{
+	static_assert(tChannels >= 1u, "Invalid channel number!");
+
+	ocean_assert(row != nullptr);
+	ocean_assert(width >= 1u);
+	ocean_assert(rowStrideElements >= width * tChannels);
+
+	const StatisticType statisticTypes = statistics.statisticTypes_;
+
+	const bool determineVariance = (statisticTypes & ST_VARIANCE) == ST_VARIANCE;
+	const bool determineMinMax = (statisticTypes & ST_MIN_MAX) == ST_MIN_MAX;
+	const bool determineHistogram = (statisticTypes & ST_HISTOGRAM) == ST_HISTOGRAM;
+
+	uint64_t sums[tChannels] = {};
+	uint64_t squaredSums[tChannels] = {};
+
+	for (unsigned int x = 0u; x < width; ++x)
+	{
+		const uint8_t* const pixel = row + x * tChannels;
+
+		for (unsigned int n = 0u; n < tChannels; ++n)
+		{
+			const uint32_t value = uint32_t(pixel[n]);
+
+			sums[n] += value;
+
+			if (determineVariance)
+			{
+				squaredSums[n] += value * value;
+			}
+
+			if (determineMinMax)
+			{
+				statistics.minValues_[n] = std::min(statistics.minValues_[n], pixel[n]);
+				statistics.maxValues_[n] = std::max(statistics.maxValues_[n], pixel[n]);
+			}
+		}
+
+		if (determineHistogram)
+		{
+			statistics.histogram_.increment(pixel);
+		}
+	}
+
+	for (unsigned int n = 0u; n < tChannels; ++n)
+	{
+		statistics.sums_[n] += sums[n];
+		statistics.squaredSums_[n] += squaredSums[n];
+	}
+
+	statistics.pixels_ += width;
+
+	if (laplaceRow)
+	{
+		ocean_assert(width >= 3u);
+
+		const uint8_t* const rowTop = row - rowStrideElements;
+		const uint8_t* const rowBottom = row + rowStrideElements;
+
+		for (unsigned int x = tChannels; x < (width - 1u) * tChannels; x += tChannels)
+		{
+			for (unsigned int n = 0u; n < tChannels; ++n)
+			{
+				const int32_t response = int32_t(row[x + n]) * 4 - int32_t(rowTop[x + n]) - int32_t(row[x + n - tChannels]) - int32_t(row[x + n + tChannels]) - int32_t(rowBottom[x + n]);
+
+				statistics.laplaceSums_[n] += response;
+				statistics.laplaceSquaredSums_[n] += uint64_t(response * response);
+			}
+		}
+
+		statistics.laplacePixels_ += width - 2u;
+	}
+}
+
+}
+
+}
+
+#endif // META_OCEAN_CV_FRAME_STATISTICS_H
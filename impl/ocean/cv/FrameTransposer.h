@@ -149,6 +149,22 @@ class OCEAN_CV_EXPORT FrameTransposer
 				template <FlipDirection tFlipDirection>
 				static OCEAN_FORCE_INLINE void transposeBlock(const T* sourceBlock, T* targetBlock, const unsigned int blockWidth, const unsigned int blockHeight, const unsigned int sourceStrideElements, const unsigned int targetStrideElements);
 
+#if defined(OCEAN_HARDWARE_SSE_VERSION) && OCEAN_HARDWARE_SSE_VERSION >= 41
+
+				/**
+				 * Transposes a block of 4x4 pixels.
+				 * @param sourceBlock The pointer to the start location of the source block, must be valid
+				 * @param targetBlock The pointer to the start location of the target block, must be valid
+				 * @param sourceStrideElements The number of elements between two successive rows, in elements, with range [4 * tChannels, infinity)
+				 * @param targetStrideElements The number of elements between two successive rows, in elements, with range [4 * tChannels, infinity)
+				 * @tparam tFlipDirection The flip direction to be applied after transposing the block
+				 * @see transposeBlock().
+				 */
+				template <FlipDirection tFlipDirection>
+				static OCEAN_FORCE_INLINE void transposeBlock4x4SSE(const T* sourceBlock, T* targetBlock, const unsigned int sourceStrideElements, const unsigned int targetStrideElements);
+
+#endif // OCEAN_HARDWARE_SSE_VERSION >= 41
+
 #if defined(OCEAN_HARDWARE_NEON_VERSION) && OCEAN_HARDWARE_NEON_VERSION >= 10
 
 				/**
@@ -270,6 +286,23 @@ class OCEAN_CV_EXPORT FrameTransposer
 		template <typename T, unsigned int tChannels, FlipDirection tFlipDirection>
 		static void transposeSubset(const T* source, T* target, const unsigned int sourceWidth, const unsigned int sourceHeight, const unsigned int sourcePaddingElements, const unsigned int targetPaddingElements, const unsigned int firstSourceRow, const unsigned int numberSourceRows);
 
+		/**
+		 * Rotates a given frame either clockwise or counter-clockwise by 90 degree by transposing and flipping blocks of 8x8 pixels.
+		 * @param source The source frame which will be rotated, must be valid
+		 * @param target The resulting rotated target frame, must be valid and must have the same buffer size as the source frame
+		 * @param sourceWidth The width of the source frame in pixel, with range [1, infinity)
+		 * @param sourceHeight The height of the source frame in pixel, with range [1, infinity)
+		 * @param clockwise True, to rotate the frame clockwise; False, to rotate the frame counter-clockwise
+		 * @param sourcePaddingElements Number of padding elements in the source frame, range: [0, infinity)
+		 * @param targetPaddingElements Number of padding elements in the target frame, range: [0, infinity)
+		 * @param worker Optional worker object to distribute the computation
+		 * @tparam T The data type of each channel
+		 * @tparam tChannels The number of frame channels, with range [1, infinity)
+		 * @see transposeSubset().
+		 */
+		template <typename T, unsigned int tChannels>
+		static void rotate90Blocks(const T* source, T* target, const unsigned int sourceWidth, const unsigned int sourceHeight, const bool clockwise, const unsigned int sourcePaddingElements, const unsigned int targetPaddingElements, Worker* worker);
+
 		/**
 		 * Rotates a subset of a given frame either clockwise or counter-clockwise by 90 degree.
 		 * @param source The source frame which will be rotated, must be valid
@@ -404,22 +437,49 @@ void FrameTransposer::rotate90(const T* source, T* target, const unsigned int so
 
 #if defined(OCEAN_HARDWARE_SSE_VERSION) && OCEAN_HARDWARE_SSE_VERSION > 0
 
-	// on x86 CPUs, the SIMD implementation is slower than the non-SIMD implementation
-	// therefore, using a function without explicit SIMD instructions
+#if OCEAN_HARDWARE_SSE_VERSION >= 41
+	// on x86 CPUs, the block-based SIMD implementation is only faster for pixel formats with a dedicated SSE block transposer (1, 2, 3, or 4 bytes per pixel)
+	constexpr bool useBlockTransposer = (std::is_same<MappedType, uint8_t>::value && tChannels <= 4u) || (std::is_same<MappedType, uint32_t>::value && tChannels == 1u);
+#else
+	constexpr bool useBlockTransposer = false;
+#endif
 
-	if (worker)
+	if constexpr (useBlockTransposer)
 	{
-		worker->executeFunction(Worker::Function::createStatic(rotate90Subset<MappedType, tChannels>, (const MappedType*)(source), (MappedType*)(target), sourceWidth, sourceHeight, clockwise, sourcePaddingElements, targetPaddingElements, 0u, 0u), 0u, sourceWidth, 7u, 8u, 20u);
+		rotate90Blocks<MappedType, tChannels>((const MappedType*)(source), (MappedType*)(target), sourceWidth, sourceHeight, clockwise, sourcePaddingElements, targetPaddingElements, worker);
 	}
 	else
 	{
-		rotate90Subset<MappedType, tChannels>((const MappedType*)(source), (MappedType*)(target), sourceWidth, sourceHeight, clockwise, sourcePaddingElements, targetPaddingElements, 0u, sourceWidth);
+		// for all other pixel formats, using a function without explicit SIMD instructions
+
+		if (worker)
+		{
+			worker->executeFunction(Worker::Function::createStatic(rotate90Subset<MappedType, tChannels>, (const MappedType*)(source), (MappedType*)(target), sourceWidth, sourceHeight, clockwise, sourcePaddingElements, targetPaddingElements, 0u, 0u), 0u, sourceWidth, 7u, 8u, 20u);
+		}
+		else
+		{
+			rotate90Subset<MappedType, tChannels>((const MappedType*)(source), (MappedType*)(target), sourceWidth, sourceHeight, clockwise, sourcePaddingElements, targetPaddingElements, 0u, sourceWidth);
+		}
 	}
 
 #else
 
 	// on non-x86 CPUs (e.g., ARM), the SIMD implementation is significantly faster
 
+	rotate90Blocks<MappedType, tChannels>((const MappedType*)(source), (MappedType*)(target), sourceWidth, sourceHeight, clockwise, sourcePaddingElements, targetPaddingElements, worker);
+
+#endif
+}
+
+template <typename T, unsigned int tChannels>
+void FrameTransposer::rotate90Blocks(const T* source, T* target, const unsigned int sourceWidth, const unsigned int sourceHeight, const bool clockwise, const unsigned int sourcePaddingElements, const unsigned int targetPaddingElements, Worker* worker)
+{
+	static_assert(tChannels != 0u, "Invalid channel number!");
+
+	ocean_assert(source && target);
+	ocean_assert(source != target);
+	ocean_assert(sourceWidth != 0u && sourceHeight != 0u);
+
 	const unsigned int xBlocks8 = (sourceWidth + 7u) / 8u;
 	const unsigned int yBlocks8 = (sourceHeight + 7u) / 8u;
 
@@ -429,26 +489,24 @@ void FrameTransposer::rotate90(const T* source, T* target, const unsigned int so
 	{
 		if (clockwise)
 		{
-			worker->executeFunction(Worker::Function::createStatic(&transposeSubset<MappedType, tChannels, FD_LEFT_RIGHT>, (const MappedType*)(source), (MappedType*)(target), sourceWidth, sourceHeight, sourcePaddingElements, targetPaddingElements, 0u, 0u), 0u, blocks8);
+			worker->executeFunction(Worker::Function::createStatic(&transposeSubset<T, tChannels, FD_LEFT_RIGHT>, source, target, sourceWidth, sourceHeight, sourcePaddingElements, targetPaddingElements, 0u, 0u), 0u, blocks8);
 		}
 		else
 		{
-			worker->executeFunction(Worker::Function::createStatic(&transposeSubset<MappedType, tChannels, FD_TOP_BOTTOM>, (const MappedType*)(source), (MappedType*)(target), sourceWidth, sourceHeight, sourcePaddingElements, targetPaddingElements, 0u, 0u), 0u, blocks8);
+			worker->executeFunction(Worker::Function::createStatic(&transposeSubset<T, tChannels, FD_TOP_BOTTOM>, source, target, sourceWidth, sourceHeight, sourcePaddingElements, targetPaddingElements, 0u, 0u), 0u, blocks8);
 		}
 	}
 	else
 	{
 		if (clockwise)
 		{
-			transposeSubset<MappedType, tChannels, FD_LEFT_RIGHT>((const MappedType*)(source), (MappedType*)(target), sourceWidth, sourceHeight, sourcePaddingElements, targetPaddingElements, 0u, blocks8);
+			transposeSubset<T, tChannels, FD_LEFT_RIGHT>(source, target, sourceWidth, sourceHeight, sourcePaddingElements, targetPaddingElements, 0u, blocks8);
 		}
 		else
 		{
-			transposeSubset<MappedType, tChannels, FD_TOP_BOTTOM>((const MappedType*)(source), (MappedType*)(target), sourceWidth, sourceHeight, sourcePaddingElements, targetPaddingElements, 0u, blocks8);
+			transposeSubset<T, tChannels, FD_TOP_BOTTOM>(source, target, sourceWidth, sourceHeight, sourcePaddingElements, targetPaddingElements, 0u, blocks8);
 		}
 	}
-
-#endif
 }
 
 template <typename T, unsigned int tChannels>
@@ -795,6 +853,200 @@ OCEAN_FORCE_INLINE void FrameTransposer::BlockTransposer<uint8_t, 2u>::transpose
 	}
 }
 
+template <>
+template <FrameTransposer::FlipDirection tFlipDirection>
+OCEAN_FORCE_INLINE void FrameTransposer::BlockTransposer<uint8_t, 3u>::transposeBlock8x8(const uint8_t* sourceBlock, uint8_t* targetBlock, const unsigned int sourceStrideElements, const unsigned int targetStrideElements)
+{
+	ocean_assert(sourceBlock && targetBlock);
+	ocean_assert(sourceStrideElements >= 8u * 3u && targetStrideElements >= 8u * 3u);
+
+	// the 3-channel pixels are expanded to 32 bit values, transposed as four blocks of 4x4 pixels, and compressed again
+
+	// RGB RGB RGB RGB RGB ... -> RGB0 RGB0 RGB0 RGB0
+	const __m128i expandShuffleMask_u_8x16 = _mm_set_epi8(char(0x80), 11, 10, 9, char(0x80), 8, 7, 6, char(0x80), 5, 4, 3, char(0x80), 2, 1, 0);
+
+	// RGB0 RGB0 RGB0 RGB0 -> RGB RGB RGB RGB 0000
+	const __m128i compressShuffleMask_u_8x16 = _mm_set_epi8(char(0x80), char(0x80), char(0x80), char(0x80), 14, 13, 12, 10, 9, 8, 6, 5, 4, 2, 1, 0);
+
+	__m128i lines_u_32x4[8][2];
+
+	for (unsigned int y = 0u; y < 8u; ++y)
+	{
+		const uint8_t* const sourceRow = sourceBlock + sourceStrideElements * y;
+
+		const __m128i pixels0_u_8x16 = _mm_loadu_si128((const __m128i*)(sourceRow)); // pixel 0 - 4, and the first channel of pixel 5
+		const __m128i pixels1_u_8x16 = _mm_loadl_epi64((const __m128i*)(sourceRow + 16)); // remaining channels of pixel 5, pixel 6 - 7
+
+		lines_u_32x4[y][0] = _mm_shuffle_epi8(pixels0_u_8x16, expandShuffleMask_u_8x16);
+		lines_u_32x4[y][1] = _mm_shuffle_epi8(_mm_alignr_epi8(pixels1_u_8x16, pixels0_u_8x16, 12), expandShuffleMask_u_8x16);
+	}
+
+	// transposed_u_32x4[x][n] holds the pixels of the source column x, from the source rows [n * 4, n * 4 + 3]
+	__m128i transposed_u_32x4[8][2];
+
+	for (unsigned int yBlock = 0u; yBlock < 2u; ++yBlock)
+	{
+		for (unsigned int xBlock = 0u; xBlock < 2u; ++xBlock)
+		{
+			const __m128i line01_A_u_32x4 = _mm_unpacklo_epi32(lines_u_32x4[yBlock * 4u + 0u][xBlock], lines_u_32x4[yBlock * 4u + 1u][xBlock]);
+			const __m128i line01_B_u_32x4 = _mm_unpackhi_epi32(lines_u_32x4[yBlock * 4u + 0u][xBlock], lines_u_32x4[yBlock * 4u + 1u][xBlock]);
+			const __m128i line23_A_u_32x4 = _mm_unpacklo_epi32(lines_u_32x4[yBlock * 4u + 2u][xBlock], lines_u_32x4[yBlock * 4u + 3u][xBlock]);
+			const __m128i line23_B_u_32x4 = _mm_unpackhi_epi32(lines_u_32x4[yBlock * 4u + 2u][xBlock], lines_u_32x4[yBlock * 4u + 3u][xBlock]);
+
+			transposed_u_32x4[xBlock * 4u + 0u][yBlock] = _mm_unpacklo_epi64(line01_A_u_32x4, line23_A_u_32x4);
+			transposed_u_32x4[xBlock * 4u + 1u][yBlock] = _mm_unpackhi_epi64(line01_A_u_32x4, line23_A_u_32x4);
+			transposed_u_32x4[xBlock * 4u + 2u][yBlock] = _mm_unpacklo_epi64(line01_B_u_32x4, line23_B_u_32x4);
+			transposed_u_32x4[xBlock * 4u + 3u][yBlock] = _mm_unpackhi_epi64(line01_B_u_32x4, line23_B_u_32x4);
+		}
+	}
+
+	for (unsigned int x = 0u; x < 8u; ++x)
+	{
+		__m128i pixels0_u_32x4 = transposed_u_32x4[x][0];
+		__m128i pixels1_u_32x4 = transposed_u_32x4[x][1];
+
+		unsigned int targetRowIndex = x;
+
+		switch (tFlipDirection)
+		{
+			case FD_NONE:
+				break;
+
+			case FD_LEFT_RIGHT:
+			{
+				pixels0_u_32x4 = _mm_shuffle_epi32(transposed_u_32x4[x][1], _MM_SHUFFLE(0, 1, 2, 3));
+				pixels1_u_32x4 = _mm_shuffle_epi32(transposed_u_32x4[x][0], _MM_SHUFFLE(0, 1, 2, 3));
+				break;
+			}
+
+			case FD_TOP_BOTTOM:
+			{
+				targetRowIndex = 7u - x;
+				break;
+			}
+
+			default:
+				ocean_assert(false && "Invalid flip direction!");
+		}
+
+		const __m128i compressed0_u_8x16 = _mm_shuffle_epi8(pixels0_u_32x4, compressShuffleMask_u_8x16); // 12 bytes of pixel 0 - 3
+		const __m128i compressed1_u_8x16 = _mm_shuffle_epi8(pixels1_u_32x4, compressShuffleMask_u_8x16); // 12 bytes of pixel 4 - 7
+
+		uint8_t* const targetRow = targetBlock + targetStrideElements * targetRowIndex;
+
+		_mm_storeu_si128((__m128i*)(targetRow), _mm_or_si128(compressed0_u_8x16, _mm_slli_si128(compressed1_u_8x16, 12)));
+		_mm_storel_epi64((__m128i*)(targetRow + 16), _mm_srli_si128(compressed1_u_8x16, 4));
+	}
+}
+
+template <>
+template <FrameTransposer::FlipDirection tFlipDirection>
+OCEAN_FORCE_INLINE void FrameTransposer::BlockTransposer<uint8_t, 4u>::transposeBlock4x4SSE(const uint8_t* sourceBlock, uint8_t* targetBlock, const unsigned int sourceStrideElements, const unsigned int targetStrideElements)
+{
+	ocean_assert(sourceBlock && targetBlock);
+	ocean_assert(sourceStrideElements >= 4u * 4u && targetStrideElements >= 4u * 4u);
+
+	// each pixel is handled as one 32 bit value
+
+	const __m128i line0_u_32x4 = _mm_loadu_si128((const __m128i*)(sourceBlock + sourceStrideElements * 0u)); // A B C D
+	const __m128i line1_u_32x4 = _mm_loadu_si128((const __m128i*)(sourceBlock + sourceStrideElements * 1u)); // a b c d
+	const __m128i line2_u_32x4 = _mm_loadu_si128((const __m128i*)(sourceBlock + sourceStrideElements * 2u)); // 0 1 2 3
+	const __m128i line3_u_32x4 = _mm_loadu_si128((const __m128i*)(sourceBlock + sourceStrideElements * 3u)); // ! @ # $
+
+	const __m128i line01_A_u_32x4 = _mm_unpacklo_epi32(line0_u_32x4, line1_u_32x4); // A a B b
+	const __m128i line01_B_u_32x4 = _mm_unpackhi_epi32(line0_u_32x4, line1_u_32x4); // C c D d
+	const __m128i line23_A_u_32x4 = _mm_unpacklo_epi32(line2_u_32x4, line3_u_32x4); // 0 ! 1 @
+	const __m128i line23_B_u_32x4 = _mm_unpackhi_epi32(line2_u_32x4, line3_u_32x4); // 2 # 3 $
+
+	__m128i transposed0 = _mm_unpacklo_epi64(line01_A_u_32x4, line23_A_u_32x4); // A a 0 !
+	__m128i transposed1 = _mm_unpackhi_epi64(line01_A_u_32x4, line23_A_u_32x4); // B b 1 @
+	__m128i transposed2 = _mm_unpacklo_epi64(line01_B_u_32x4, line23_B_u_32x4); // C c 2 #
+	__m128i transposed3 = _mm_unpackhi_epi64(line01_B_u_32x4, line23_B_u_32x4); // D d 3 $
+
+	switch (tFlipDirection)
+	{
+		case FD_LEFT_RIGHT:
+		{
+			transposed0 = _mm_shuffle_epi32(transposed0, _MM_SHUFFLE(0, 1, 2, 3));
+			transposed1 = _mm_shuffle_epi32(transposed1, _MM_SHUFFLE(0, 1, 2, 3));
+			transposed2 = _mm_shuffle_epi32(transposed2, _MM_SHUFFLE(0, 1, 2, 3));
+			transposed3 = _mm_shuffle_epi32(transposed3, _MM_SHUFFLE(0, 1, 2, 3));
+
+			// no break, as we use the store function from FD_NONE
+			[[fallthrough]];
+		}
+
+		case FD_NONE:
+		{
+			_mm_storeu_si128((__m128i*)(targetBlock + targetStrideElements * 0u), transposed0);
+			_mm_storeu_si128((__m128i*)(targetBlock + targetStrideElements * 1u), transposed1);
+			_mm_storeu_si128((__m128i*)(targetBlock + targetStrideElements * 2u), transposed2);
+			_mm_storeu_si128((__m128i*)(targetBlock + targetStrideElements * 3u), transposed3);
+
+			break;
+		}
+
+		case FD_TOP_BOTTOM:
+		{
+			_mm_storeu_si128((__m128i*)(targetBlock + targetStrideElements * 0u), transposed3);
+			_mm_storeu_si128((__m128i*)(targetBlock + targetStrideElements * 1u), transposed2);
+			_mm_storeu_si128((__m128i*)(targetBlock + targetStrideElements * 2u), transposed1);
+			_mm_storeu_si128((__m128i*)(targetBlock + targetStrideElements * 3u), transposed0);
+
+			break;
+		}
+
+		default:
+			ocean_assert(false && "Invalid flip direction!");
+	}
+}
+
+template <>
+template <FrameTransposer::FlipDirection tFlipDirection>
+OCEAN_FORCE_INLINE void FrameTransposer::BlockTransposer<uint8_t, 4u>::transposeBlock8x8(const uint8_t* sourceBlock, uint8_t* targetBlock, const unsigned int sourceStrideElements, const unsigned int targetStrideElements)
+{
+	ocean_assert(sourceBlock && targetBlock);
+	ocean_assert(sourceStrideElements >= 8u * 4u && targetStrideElements >= 8u * 4u);
+
+	// we simply tranpose four blocks of 4x4 pixels
+
+	switch (tFlipDirection)
+	{
+		case FD_NONE:
+		{
+			transposeBlock4x4SSE<tFlipDirection>(sourceBlock, targetBlock, sourceStrideElements, targetStrideElements);
+			transposeBlock4x4SSE<tFlipDirection>(sourceBlock + 16, targetBlock + 4 * targetStrideElements, sourceStrideElements, targetStrideElements);
+			transposeBlock4x4SSE<tFlipDirection>(sourceBlock + 4 * sourceStrideElements, targetBlock + 16, sourceStrideElements, targetStrideElements);
+			transposeBlock4x4SSE<tFlipDirection>(sourceBlock + 4 * sourceStrideElements + 16, targetBlock + 4 * targetStrideElements + 16, sourceStrideElements, targetStrideElements);
+
+			break;
+		}
+
+		case FD_LEFT_RIGHT:
+		{
+			transposeBlock4x4SSE<tFlipDirection>(sourceBlock, targetBlock + 16, sourceStrideElements, targetStrideElements);
+			transposeBlock4x4SSE<tFlipDirection>(sourceBlock + 16, targetBlock + 4 * targetStrideElements + 16, sourceStrideElements, targetStrideElements);
+			transposeBlock4x4SSE<tFlipDirection>(sourceBlock + 4 * sourceStrideElements, targetBlock, sourceStrideElements, targetStrideElements);
+			transposeBlock4x4SSE<tFlipDirection>(sourceBlock + 4 * sourceStrideElements + 16, targetBlock + 4 * targetStrideElements, sourceStrideElements, targetStrideElements);
+
+			break;
+		}
+
+		case FD_TOP_BOTTOM:
+		{
+			transposeBlock4x4SSE<tFlipDirection>(sourceBlock, targetBlock + 4 * targetStrideElements, sourceStrideElements, targetStrideElements);
+			transposeBlock4x4SSE<tFlipDirection>(sourceBlock + 16, targetBlock, sourceStrideElements, targetStrideElements);
+			transposeBlock4x4SSE<tFlipDirection>(sourceBlock + 4 * sourceStrideElements, targetBlock + 4 * targetStrideElements + 16, sourceStrideElements, targetStrideElements);
+			transposeBlock4x4SSE<tFlipDirection>(sourceBlock + 4 * sourceStrideElements + 16, targetBlock + 16, sourceStrideElements, targetStrideElements);
+
+			break;
+		}
+
+		default:
+			ocean_assert(false && "Invalid flip direction!");
+	}
+}
+
 #endif // defined(OCEAN_HARDWARE_SSE_VERSION) && OCEAN_HARDWARE_SEE_VERSION >= 41
 
 #if defined(OCEAN_HARDWARE_NEON_VERSION) && OCEAN_HARDWARE_NEON_VERSION >= 10
@@ -1391,6 +1643,22 @@ OCEAN_FORCE_INLINE void FrameTransposer::BlockTransposer<uint8_t, 4u>::transpose
 
 #endif // OCEAN_HARDWARE_NEON_VERSION >= 10
 
+#if (defined(OCEAN_HARDWARE_SSE_VERSION) && OCEAN_HARDWARE_SSE_VERSION >= 41) || (defined(OCEAN_HARDWARE_NEON_VERSION) && OCEAN_HARDWARE_NEON_VERSION >= 10)
+
+template <>
+template <FrameTransposer::FlipDirection tFlipDirection>
+OCEAN_FORCE_INLINE void FrameTransposer::BlockTransposer<uint32_t, 1u>::transposeBlock8x8(const uint32_t* sourceBlock, uint32_t* targetBlock, const unsigned int sourceStrideElements, const unsigned int targetStrideElements)
+{
+	ocean_assert(sourceBlock && targetBlock);
+	ocean_assert(sourceStrideElements >= 8u && targetStrideElements >= 8u);
+
+	// 32 bit elements (e.g., float) have the same memory layout as pixels with four 8 bit channels
+
+	BlockTransposer<uint8_t, 4u>::transposeBlock8x8<tFlipDirection>((const uint8_t*)(sourceBlock), (uint8_t*)(targetBlock), sourceStrideElements * 4u, targetStrideElements * 4u);
+}
+
+#endif // OCEAN_HARDWARE_SSE_VERSION >= 41 || OCEAN_HARDWARE_NEON_VERSION >= 10
+
 template <typename T, unsigned int tChannels>
 template <FrameTransposer::FlipDirection tFlipDirection>
 OCEAN_FORCE_INLINE void FrameTransposer::BlockTransposer<T, tChannels>::transposeBlock8x8(const T* sourceBlock, T* targetBlock, const unsigned int sourceStrideElements, const unsigned int targetStrideElements)
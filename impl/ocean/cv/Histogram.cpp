@@ -7,6 +7,7 @@
 
 #include "ocean/cv/Histogram.h"
 #include "ocean/cv/FrameConverter.h"
+#include "ocean/cv/SSE.h"
 
 #include "ocean/base/Memory.h"
 
@@ -369,7 +370,7 @@ void ContrastLimitedAdaptiveHistogram::bilinearInterpolation(const uint8_t* cons
 
 	const unsigned int horizontalBins = (unsigned int)lookupCenter2.binsX();
 	const unsigned int verticalBins = (unsigned int)lookupCenter2.binsY();
-	const unsigned int tilesCount = horizontalBins * verticalBins;
+	const unsigned int interpolationTilesCount = (horizontalBins - 1u) * (verticalBins - 1u);
 
 	const bool useNeon = width / horizontalBins >= 8u;
 #endif
@@ -379,19 +380,35 @@ void ContrastLimitedAdaptiveHistogram::bilinearInterpolation(const uint8_t* cons
 #if defined(OCEAN_HARDWARE_NEON_VERSION) && OCEAN_HARDWARE_NEON_VERSION >= 10
 		if (useNeon)
 		{
-			worker->executeFunction(Worker::Function::createStatic(&bilinearInterpolationNEON7BitPrecisionSubset, source, &lookupCenter2, target, tileLookupTables.data(), (const Index32* const)leftBins.data<Index32>(), (const uint8_t* const)leftFactors_fixed7.data<uint8_t>(), (const Index32* const)topBins.data<Index32>(), (const uint8_t* const)topFactors_fixed7.data<uint8_t>(), sourcePaddingElements, targetPaddingElements, 0u, 0u), 0u, tilesCount);
+			worker->executeFunction(Worker::Function::createStatic(&bilinearInterpolationNEON7BitPrecisionSubset, source, &lookupCenter2, target, tileLookupTables.data(), (const Index32*)leftBins.data<Index32>(), (const uint8_t*)leftFactors_fixed7.data<uint8_t>(), (const Index32*)topBins.data<Index32>(), (const uint8_t*)topFactors_fixed7.data<uint8_t>(), sourcePaddingElements, targetPaddingElements, 0u, 0u), 0u, interpolationTilesCount);
 			return;
 		}
 #endif
 
-		worker->executeFunction(Worker::Function::createStatic(&bilinearInterpolation7BitPrecisionSubset, source, &lookupCenter2, target, tileLookupTables.data(), (const Index32* const)leftBins.data(), (const uint8_t* const)leftFactors_fixed7.data(), sourcePaddingElements, targetPaddingElements, 0u, 0u), 0u, height);
+#if defined(OCEAN_HARDWARE_SSE_VERSION) && OCEAN_HARDWARE_SSE_VERSION >= 41
+		if (width >= 8u)
+		{
+			worker->executeFunction(Worker::Function::createStatic(&bilinearInterpolationSSE7BitPrecisionSubset, source, &lookupCenter2, target, tileLookupTables.data(), (const Index32*)leftBins.data<Index32>(), (const uint8_t*)leftFactors_fixed7.data<uint8_t>(), sourcePaddingElements, targetPaddingElements, 0u, 0u), 0u, height);
+			return;
+		}
+#endif
+
+		worker->executeFunction(Worker::Function::createStatic(&bilinearInterpolation7BitPrecisionSubset, source, &lookupCenter2, target, tileLookupTables.data(), (const Index32*)leftBins.data(), (const uint8_t*)leftFactors_fixed7.data(), sourcePaddingElements, targetPaddingElements, 0u, 0u), 0u, height);
 	}
 	else
 	{
 #if defined(OCEAN_HARDWARE_NEON_VERSION) && OCEAN_HARDWARE_NEON_VERSION >= 10
 		if (useNeon)
 		{
-			bilinearInterpolationNEON7BitPrecisionSubset(source, &lookupCenter2, target, tileLookupTables.data(), leftBins.data<Index32>(), leftFactors_fixed7.data<uint8_t>(), topBins.data<Index32>(), topFactors_fixed7.data<uint8_t>(), sourcePaddingElements, targetPaddingElements, 0u, tilesCount);
+			bilinearInterpolationNEON7BitPrecisionSubset(source, &lookupCenter2, target, tileLookupTables.data(), leftBins.data<Index32>(), leftFactors_fixed7.data<uint8_t>(), topBins.data<Index32>(), topFactors_fixed7.data<uint8_t>(), sourcePaddingElements, targetPaddingElements, 0u, interpolationTilesCount);
+			return;
+		}
+#endif
+
+#if defined(OCEAN_HARDWARE_SSE_VERSION) && OCEAN_HARDWARE_SSE_VERSION >= 41
+		if (width >= 8u)
+		{
+			bilinearInterpolationSSE7BitPrecisionSubset(source, &lookupCenter2, target, tileLookupTables.data(), leftBins.data<Index32>(), leftFactors_fixed7.data<uint8_t>(), sourcePaddingElements, targetPaddingElements, 0u, height);
 			return;
 		}
 #endif
@@ -503,6 +520,123 @@ void ContrastLimitedAdaptiveHistogram::bilinearInterpolation7BitPrecisionSubset(
 	}
 }
 
+#if defined(OCEAN_HARDWARE_SSE_VERSION) && OCEAN_HARDWARE_SSE_VERSION >= 41
+
+void ContrastLimitedAdaptiveHistogram::bilinearInterpolationSSE7BitPrecisionSubset(const uint8_t* const source, const TileLookupCenter2* lookupCenter2, uint8_t* const target, const uint8_t* const tileLookupTables, const Index32* const leftBins, const uint8_t* const leftFactors_fixed7, const unsigned int sourcePaddingElements, const unsigned int targetPaddingElements, const unsigned int rowStart, const unsigned int rowCount)
+{
+	ocean_assert(source != nullptr && target != nullptr);
+	ocean_assert(lookupCenter2 != nullptr);
+	ocean_assert(lookupCenter2->sizeX() >= 8u && lookupCenter2->sizeY() != 0u);
+	ocean_assert(lookupCenter2->binsX() != 0u && lookupCenter2->binsY() != 0u);
+	ocean_assert(tileLookupTables != nullptr);
+	ocean_assert(leftBins != nullptr && leftFactors_fixed7 != nullptr);
+
+	const unsigned int width = (unsigned int)lookupCenter2->sizeX();
+	const unsigned int horizontalTiles = (unsigned int)lookupCenter2->binsX();
+
+	const unsigned int sourceStrideElements = width + sourcePaddingElements;
+	const unsigned int targetStrideElements = width + targetPaddingElements;
+	const unsigned int rowEnd = rowStart + rowCount;
+	ocean_assert(rowEnd <= lookupCenter2->sizeY());
+
+	const __m128i constant_128_u_16x8 = _mm_set1_epi16(128);
+	const __m128i constant_8192_u_32x4 = _mm_set1_epi32(8192);
+
+	for (unsigned int y = rowStart; y < rowEnd; ++y)
+	{
+		// the vertical interpolation parameters are determined as in bilinearInterpolation7BitPrecisionSubset()
+
+		const size_t yBin = lookupCenter2->binY(Scalar(y));
+		const float yBinCenter = (float)(lookupCenter2->binCenterPositionY(yBin));
+
+		const size_t topBin = (float(y) >= yBinCenter) ? yBin : max(0, int(yBin) - 1);
+		const size_t bottomBin = (float(y) < yBinCenter) ? yBin : min(topBin + 1, lookupCenter2->binsY() - 1);
+		ocean_assert(((topBin == 0 || topBin == lookupCenter2->binsY() - 1) && bottomBin == topBin) || topBin + 1 == bottomBin);
+
+		const float topCenter = (float)lookupCenter2->binCenterPositionY(topBin);
+		const float bottomCenter = (float)lookupCenter2->binCenterPositionY(bottomBin);
+		ocean_assert(topCenter <= bottomCenter);
+
+		const float topFactor = topBin != bottomBin ? (bottomCenter - (float)y) / (bottomCenter - topCenter) : 1.0f;
+		ocean_assert(topFactor >= 0.0f && topFactor <= 1.0f);
+
+		const uint8_t topFactor_fixed7 = (uint8_t)(128.0f * topFactor + 0.5f);
+		const uint8_t bottomFactor_fixed7 = 128u - topFactor_fixed7;
+
+		// [top, bottom, top, bottom, ...]
+		const __m128i topBottomFactors_fixed7_u_16x8 = _mm_set1_epi32(int32_t(topFactor_fixed7) | (int32_t(bottomFactor_fixed7) << 16));
+
+		const uint8_t* const topLookupTables = tileLookupTables + topBin * horizontalTiles * histogramSize;
+		const size_t bottomOffset = (bottomBin - topBin) * horizontalTiles * histogramSize;
+
+		const uint8_t* const sourceRow = source + y * sourceStrideElements;
+		uint8_t* const targetRow = target + y * targetStrideElements;
+
+		unsigned int x = 0u;
+
+		while (x + 8u <= width)
+		{
+			// gathering the lookup values of the four corner tiles, the right tiles are directly behind the left tiles in memory
+
+			uint16_t topLeftValues[8];
+			uint16_t topRightValues[8];
+			uint16_t bottomLeftValues[8];
+			uint16_t bottomRightValues[8];
+
+			for (unsigned int n = 0u; n < 8u; ++n)
+			{
+				const uint8_t* const topLeftLUT = topLookupTables + leftBins[x + n] * histogramSize + sourceRow[x + n];
+				ocean_assert(leftBins[x + n] + 1u < horizontalTiles);
+
+				topLeftValues[n] = topLeftLUT[0];
+				topRightValues[n] = topLeftLUT[histogramSize];
+				bottomLeftValues[n] = topLeftLUT[bottomOffset];
+				bottomRightValues[n] = topLeftLUT[bottomOffset + histogramSize];
+			}
+
+			const __m128i leftFactors_fixed7_u_16x8 = _mm_cvtepu8_epi16(_mm_loadl_epi64((const __m128i*)(leftFactors_fixed7 + x)));
+			const __m128i rightFactors_fixed7_u_16x8 = _mm_sub_epi16(constant_128_u_16x8, leftFactors_fixed7_u_16x8);
+
+			// horizontal interpolation, the results fit into 15 bits: 255 * 128
+			const __m128i top_u_16x8 = _mm_add_epi16(_mm_mullo_epi16(_mm_loadu_si128((const __m128i*)topLeftValues), leftFactors_fixed7_u_16x8), _mm_mullo_epi16(_mm_loadu_si128((const __m128i*)topRightValues), rightFactors_fixed7_u_16x8));
+			const __m128i bottom_u_16x8 = _mm_add_epi16(_mm_mullo_epi16(_mm_loadu_si128((const __m128i*)bottomLeftValues), leftFactors_fixed7_u_16x8), _mm_mullo_epi16(_mm_loadu_si128((const __m128i*)bottomRightValues), rightFactors_fixed7_u_16x8));
+
+			// vertical interpolation with 32 bit precision: top * topFactor + bottom * bottomFactor
+			const __m128i valuesA_fixed14_u_32x4 = _mm_madd_epi16(_mm_unpacklo_epi16(top_u_16x8, bottom_u_16x8), topBottomFactors_fixed7_u_16x8);
+			const __m128i valuesB_fixed14_u_32x4 = _mm_madd_epi16(_mm_unpackhi_epi16(top_u_16x8, bottom_u_16x8), topBottomFactors_fixed7_u_16x8);
+
+			const __m128i valuesA_u_32x4 = _mm_srli_epi32(_mm_add_epi32(valuesA_fixed14_u_32x4, constant_8192_u_32x4), 14);
+			const __m128i valuesB_u_32x4 = _mm_srli_epi32(_mm_add_epi32(valuesB_fixed14_u_32x4, constant_8192_u_32x4), 14);
+
+			const __m128i values_u_16x8 = _mm_packs_epi32(valuesA_u_32x4, valuesB_u_32x4);
+
+			_mm_storel_epi64((__m128i*)(targetRow + x), _mm_packus_epi16(values_u_16x8, values_u_16x8));
+
+			x += 8u;
+		}
+
+		while (x < width)
+		{
+			const uint8_t* const topLeftLUT = topLookupTables + leftBins[x] * histogramSize;
+			const uint8_t* const topRightLUT = topLeftLUT + histogramSize;
+			const uint8_t* const bottomLeftLUT = topLeftLUT + bottomOffset;
+			const uint8_t* const bottomRightLUT = bottomLeftLUT + histogramSize;
+
+			const uint8_t leftFactor_fixed7 = leftFactors_fixed7[x];
+			const uint8_t rightFactor_fixed7 = 128u - leftFactor_fixed7;
+
+			const uint8_t sourceValue = sourceRow[x];
+			const unsigned int targetValue_fixed7 = topLeftLUT[sourceValue] * leftFactor_fixed7 * topFactor_fixed7 + topRightLUT[sourceValue] * rightFactor_fixed7 * topFactor_fixed7 + bottomLeftLUT[sourceValue] * leftFactor_fixed7 * bottomFactor_fixed7 + bottomRightLUT[sourceValue] * rightFactor_fixed7 * bottomFactor_fixed7;
+
+			targetRow[x] = (uint8_t)((targetValue_fixed7 + 8192u) >> 14u);
+
+			++x;
+		}
+	}
+}
+
+#endif // OCEAN_HARDWARE_SSE_VERSION >= 41
+
 #if defined(OCEAN_HARDWARE_NEON_VERSION) && OCEAN_HARDWARE_NEON_VERSION >= 10
 
 void ContrastLimitedAdaptiveHistogram::bilinearInterpolationNEON7BitPrecisionSubset(const uint8_t* const source, const TileLookupCenter2* lookupCenter2, uint8_t* const target, const uint8_t* const tileLookupTables, const Index32* const leftBins, const uint8_t* const leftFactors_fixed7, const Index32* const topBins, const uint8_t* const topFactors_fixed7, const unsigned int sourcePaddingElements, const unsigned int targetPaddingElements, const unsigned int tileStart, const unsigned int tileCount)
@@ -524,12 +658,11 @@ void ContrastLimitedAdaptiveHistogram::bilinearInterpolationNEON7BitPrecisionSub
 	const unsigned int sourceStrideElements = width + sourcePaddingElements;
 	const unsigned int targetStrideElements = width + targetPaddingElements;
 
+	// the right-most and bottom-most tiles are handled by their left/upper neighboring tiles, so that only (horizontalTiles - 1) * (verticalTiles - 1) tiles need to be processed
+	const unsigned int interpolationHorizontalTiles = horizontalTiles - 1u;
+
 	const unsigned int tileEnd = tileStart + tileCount;
-	ocean_assert(tileEnd <= horizontalTiles * verticalTiles);
-	const unsigned int lastHorizontalTile = horizontalTiles - 1u;
-	ocean_assert(lastHorizontalTile < horizontalTiles);
-	const unsigned int lastVerticalTile = verticalTiles - 1u;
-	ocean_assert(lastVerticalTile < verticalTiles);
+	ocean_assert(tileEnd <= interpolationHorizontalTiles * (verticalTiles - 1u));
 
 	const unsigned int secondLastHorizontalTile = (horizontalTiles >= 2u ? horizontalTiles - 2u : 0u);
 	const unsigned int secondLastVerticalTile = (verticalTiles >= 2u ? verticalTiles - 2u : 0u);
@@ -568,22 +701,14 @@ void ContrastLimitedAdaptiveHistogram::bilinearInterpolationNEON7BitPrecisionSub
 		// 14:   9   9   9   9   9| 10  10  10  10| 11  11  11  11| --> 14:   6   6   6   6   6|  6   6   7   7|  7   7   7   7|
 		//     ---------------------------------------------------- -->     ----------------------------------------------------
 
-		const unsigned int tileY = tileIndex / horizontalTiles;
-		const unsigned int tileX = tileIndex % horizontalTiles;
-		ocean_assert(tileX < horizontalTiles && tileY < verticalTiles);
-
-		// The areas of the right-most and bottom-most tiles are handled by their left/upper neighboring tile
-		if (tileX == lastHorizontalTile || tileY == lastVerticalTile)
-		{
-			// TODO Make sure to iterate only over (horizontalTiles - 1u) * (verticalTiles - 1u) tiles to improve performance of multi-core implementations
-			continue;
-		}
+		const unsigned int tileY = tileIndex / interpolationHorizontalTiles;
+		const unsigned int tileX = tileIndex % interpolationHorizontalTiles;
 
-		ocean_assert(tileY < lastVerticalTile);
+		ocean_assert(tileY < verticalTiles - 1u);
 		const unsigned int tileStartY = (tileY == 0u ? 0u : (unsigned int)(lookupCenter2->binCenterPositionY(tileY) + Scalar(0.5)));
 		const unsigned int tileEndY = (tileY == secondLastVerticalTile ? height : (unsigned int)(lookupCenter2->binCenterPositionY(tileY + 1u) + Scalar(0.5)));
 
-		ocean_assert(tileX < lastHorizontalTile);
+		ocean_assert(tileX < horizontalTiles - 1u);
 		const unsigned int tileStartX = (tileX == 0u ? 0u : (unsigned int)(lookupCenter2->binCenterPositionX(tileX) + Scalar(0.5)));
 		const unsigned int tileEndX = (tileX == secondLastHorizontalTile ? width : (unsigned int)(lookupCenter2->binCenterPositionX(tileX + 1u) + Scalar(0.5)));
 
@@ -591,9 +716,9 @@ void ContrastLimitedAdaptiveHistogram::bilinearInterpolationNEON7BitPrecisionSub
 		const unsigned tileWidth = tileEndX - tileStartX;
 
 		// Extract the LUTs of the four corners that are used for the interpolation for the current tile
-		const unsigned int tileIndexTL = tileIndex;
-		const unsigned int tileIndexTR = tileIndex + 1u;
-		const unsigned int tileIndexBL = tileIndex + horizontalTiles;
+		const unsigned int tileIndexTL = tileY * horizontalTiles + tileX;
+		const unsigned int tileIndexTR = tileIndexTL + 1u;
+		const unsigned int tileIndexBL = tileIndexTL + horizontalTiles;
 		const unsigned int tileIndexBR = tileIndexBL + 1u;
 
 		const uint8_t* const tileLookupTableTL = tileLookupTables + tileIndexTL * histogramSize;
@@ -862,6 +862,26 @@ class OCEAN_CV_EXPORT ContrastLimitedAdaptiveHistogram
 		 */
 		static void bilinearInterpolation7BitPrecisionSubset(const uint8_t* const source, const TileLookupCenter2* lookupCenter2, uint8_t* const target, const uint8_t* const tileLookupTables, const Index32* const leftBins, const uint8_t* const leftFactors_fixed7, const unsigned int sourcePaddingElements = 0u, const unsigned int targetPaddingElements = 0u, const unsigned int rowStart = 0u, const unsigned int rowCount = 0u);
 
+#if defined(OCEAN_HARDWARE_SSE_VERSION) && OCEAN_HARDWARE_SSE_VERSION >= 41
+
+		/**
+		 * Integer-based (fixed-point arithmetic) helper function for the histogram normalization by bilinearly interpolating pixels using the CLAHE per-tile lookup tables, using SSE for the interpolation of 8 pixels at once
+		 * The lookup values of the four corner tiles are gathered per pixel, the result is identical to bilinearInterpolation7BitPrecisionSubset().
+		 * @param source Pointer to the data of the source frame that will be processed, must be valid and 8-bit unsigned, 1-channel (`FrameType::FORMAT_Y8`)
+		 * @param lookupCenter2 Defines how the source frame is partitioned, image size and number of bins will be extracted from this object, must be valid, with image width >= 8
+		 * @param target Pointer to the data of the target frame, must be valid and 8-bit unsigned, 1-channel (`FrameType::FORMAT_Y8`)
+		 * @param tileLookupTables Storage location for the computed lookup tables; will be initialized internally to size N x 256, where N = the total number of bins
+		 * @param leftBins Stores the indices of the closest bins left of a horizontal pixel location, must be initialized, expected size: image width
+		 * @param leftFactors_fixed7 Stores the horizontal interpolation factors for the left bins (as fixed-point number with 7-bit precision), must be initialized, expected size: image width
+		 * @param sourcePaddingElements Number of padding elements in the source data, range: [0, infinity), default: 0
+		 * @param targetPaddingElements Number of padding elements in the target data, range: [0, infinity), default: 0
+		 * @param rowStart First image row to process, range: [0, height)
+		 * @param rowCount Number of rows to process, range: [0, height - rowStart)
+		 */
+		static void bilinearInterpolationSSE7BitPrecisionSubset(const uint8_t* const source, const TileLookupCenter2* lookupCenter2, uint8_t* const target, const uint8_t* const tileLookupTables, const Index32* const leftBins, const uint8_t* const leftFactors_fixed7, const unsigned int sourcePaddingElements = 0u, const unsigned int targetPaddingElements = 0u, const unsigned int rowStart = 0u, const unsigned int rowCount = 0u);
+
+#endif // OCEAN_HARDWARE_SSE_VERSION >= 41
+
 #if defined(OCEAN_HARDWARE_NEON_VERSION) && OCEAN_HARDWARE_NEON_VERSION >= 10
 
 		/**
@@ -876,7 +896,7 @@ class OCEAN_CV_EXPORT ContrastLimitedAdaptiveHistogram
 		 * @param topFactors_fixed7 Stores the vertical interpolation factors for the top bins (as fixed-point number with 7-bit precision), must be initialized, expected size: image height
 		 * @param sourcePaddingElements Number of padding elements in the source data, range: [0, infinity), default: 0
 		 * @param targetPaddingElements Number of padding elements in the target data, range: [0, infinity), default: 0
-		 * @param tileStart First tile to process, range: [0, N), where N = number of tiles
+		 * @param tileStart First tile to process, range: [0, N), where N = (horizontalTiles - 1) * (verticalTiles - 1), as the right-most and bottom-most tiles are handled by their neighbors
 		 * @param tileCount Number of tiles to process, range: [0, N - tileStart)
 		 */
 		static void bilinearInterpolationNEON7BitPrecisionSubset(const uint8_t* const source, const TileLookupCenter2* lookupCenter2, uint8_t* const target, const uint8_t* const tileLookupTables, const Index32* const leftBins, const uint8_t* const leftFactors_fixed7, const Index32* const topBins, const uint8_t* const topFactors_fixed7, const unsigned int sourcePaddingElements = 0u, const unsigned int targetPaddingElements = 0u, const unsigned int tileStart = 0u, const unsigned int tileCount = 0u);
@@ -895,9 +915,15 @@ inline void ContrastLimitedAdaptiveHistogram::computeLookupTable(const uint8_t*
 	const unsigned int sourceStrideElements = width + sourcePaddingElements;
 	const uint8_t* const sourceEnd = source + height * sourceStrideElements;
 
-	// Histogram computation
-	TileHistogram histogram;
-	memset(histogram.data(), 0u, histogram.size() * sizeof(TileHistogram::value_type));
+	// Histogram computation, four interleaved partial histograms avoid that consecutive increments of the same bin have to wait for each other
+	unsigned int partialHistograms[4u * histogramSize];
+	memset(partialHistograms, 0u, sizeof(partialHistograms));
+
+	unsigned int* const partialHistogram0 = partialHistograms + histogramSize * 0u;
+	unsigned int* const partialHistogram1 = partialHistograms + histogramSize * 1u;
+	unsigned int* const partialHistogram2 = partialHistograms + histogramSize * 2u;
+	unsigned int* const partialHistogram3 = partialHistograms + histogramSize * 3u;
+
 	const unsigned int widthEnd = width >= 4u ? width - 4u : 0u;
 
 	for (unsigned int y = 0u; y < height; ++y)
@@ -907,10 +933,10 @@ inline void ContrastLimitedAdaptiveHistogram::computeLookupTable(const uint8_t*
 		while (x < widthEnd)
 		{
 			ocean_assert_and_suppress_unused(source + x + 3u < sourceEnd, sourceEnd);
-			histogram[source[x + 0u]]++;
-			histogram[source[x + 1u]]++;
-			histogram[source[x + 2u]]++;
-			histogram[source[x + 3u]]++;
+			partialHistogram0[source[x + 0u]]++;
+			partialHistogram1[source[x + 1u]]++;
+			partialHistogram2[source[x + 2u]]++;
+			partialHistogram3[source[x + 3u]]++;
 
 			x += 4u;
 		}
@@ -918,7 +944,7 @@ inline void ContrastLimitedAdaptiveHistogram::computeLookupTable(const uint8_t*
 		while (x < width)
 		{
 			ocean_assert(source + x < sourceEnd);
-			histogram[source[x]]++;
+			partialHistogram0[source[x]]++;
 
 			++x;
 		}
@@ -926,6 +952,13 @@ inline void ContrastLimitedAdaptiveHistogram::computeLookupTable(const uint8_t*
 		source += sourceStrideElements;
 	}
 
+	TileHistogram histogram;
+
+	for (unsigned int i = 0u; i < histogramSize; ++i)
+	{
+		histogram[i] = partialHistogram0[i] + partialHistogram1[i] + partialHistogram2[i] + partialHistogram3[i];
+	}
+
 	// Clip histogram peaks and redistribute area exceeding the clip limit
 	ocean_assert(histogramSize != 0u);
 	const unsigned int scaledClipLimit = std::max(1u, (unsigned int)(clipLimit * float(sourceArea) / float(histogramSize)));
@@ -155,23 +155,12 @@ Frame IntegralImage::Comfort::createBorderedImage(const Frame& frame, const unsi
 
 #if defined(OCEAN_HARDWARE_SSE_VERSION) && OCEAN_HARDWARE_SSE_VERSION >= 41
 
-void IntegralImage::createLinedImage1Channel8BitSSE(const uint8_t* source, uint32_t* integral, const unsigned int width, const unsigned int height, const unsigned int sourcePaddingElements, const unsigned int integralPaddingElements)
+uint32_t IntegralImage::createLinedRow1Channel8BitSSE(const uint8_t* source, const uint32_t* integralPreviousRow, uint32_t* integral, const unsigned int pixels, uint32_t rowSum)
 {
 	ocean_assert(source != nullptr);
-	ocean_assert(integral != nullptr);
-	ocean_assert(width >= 8u && height != 0u);
-	ocean_assert(width * height <= 16777216u);
+	ocean_assert(integralPreviousRow != nullptr && integral != nullptr);
 
 	/*
-	 * This is the resulting lined integral image:
-	 *  ------------
-	 * |000000000000|
-	 * |0|----------|
-	 * |0|          |
-	 * |0| Integral |
-	 * |0|          |
-	 * |------------
-	 *
 	 * SSE-based implementation with scalar running sum optimization:
 	 *
 	 * For each block of 4 pixels we compute:
@@ -198,85 +187,134 @@ void IntegralImage::createLinedImage1Channel8BitSSE(const uint8_t* source, uint3
 
 	const __m128i constant_zero_u_128i = _mm_setzero_si128();
 
-	// entire top line will be set to zero
-	memset(integral, 0x00, sizeof(uint32_t) * (width + 1u));
+	unsigned int x = 0u;
 
-	uint32_t* integralLastRow = integral;
+	// main loop: process blockSize pixels at a time
+	while (x + blockSize <= pixels)
+	{
+		// load 8 bytes and zero-extend to 16-bit values
+		const __m128i source_8x8 = _mm_loadl_epi64((const __m128i*)(source));
+		const __m128i source_16x8 = _mm_cvtepu8_epi16(source_8x8);
+
+		// load previous row values (8 x 32-bit)
+		const __m128i lastRow_a_32x4 = _mm_loadu_si128((const __m128i*)(integralPreviousRow + 0));
+		const __m128i lastRow_b_32x4 = _mm_loadu_si128((const __m128i*)(integralPreviousRow + 4));
+
+		// widen source to 32-bit (first 4 elements)
+		const __m128i source_a_32x4 = _mm_cvtepu16_epi32(source_16x8);
+		// widen source to 32-bit (second 4 elements)
+		const __m128i source_b_32x4 = _mm_cvtepu16_epi32(_mm_srli_si128(source_16x8, 8));
+
+		// compute prefix sums for first 4 elements (parallel prefix pattern)
+		// step 1: [C0, C1, C2, C3] + [0, C0, C1, C2]
+		__m128i prefix_a_32x4 = _mm_add_epi32(source_a_32x4, _mm_alignr_epi8(source_a_32x4, constant_zero_u_128i, 12));
+		// step 2: + [0, 0, C0, C0+C1]
+		prefix_a_32x4 = _mm_add_epi32(prefix_a_32x4, _mm_alignr_epi8(prefix_a_32x4, constant_zero_u_128i, 8));
+
+		// broadcast rowSum and add previous row
+		__m128i rowSum_32x4 = _mm_set1_epi32(int(rowSum));
+		const __m128i result_a_32x4 = _mm_add_epi32(prefix_a_32x4, _mm_add_epi32(lastRow_a_32x4, rowSum_32x4));
+
+		// update rowSum with sum of first 4 pixels (extract element 3)
+		rowSum += static_cast<uint32_t>(_mm_extract_epi32(prefix_a_32x4, 3));
+
+		// compute prefix sums for second 4 elements
+		__m128i prefix_b_32x4 = _mm_add_epi32(source_b_32x4, _mm_alignr_epi8(source_b_32x4, constant_zero_u_128i, 12));
+		prefix_b_32x4 = _mm_add_epi32(prefix_b_32x4, _mm_alignr_epi8(prefix_b_32x4, constant_zero_u_128i, 8));
+
+		// broadcast updated rowSum and add previous row
+		rowSum_32x4 = _mm_set1_epi32(int(rowSum));
+		const __m128i result_b_32x4 = _mm_add_epi32(prefix_b_32x4, _mm_add_epi32(lastRow_b_32x4, rowSum_32x4));
+
+		// update rowSum with sum of second 4 pixels
+		rowSum += static_cast<uint32_t>(_mm_extract_epi32(prefix_b_32x4, 3));
+
+		// store results
+		_mm_storeu_si128((__m128i*)(integral + 0), result_a_32x4);
+		_mm_storeu_si128((__m128i*)(integral + 4), result_b_32x4);
+
+		source += blockSize;
+		integral += blockSize;
+		integralPreviousRow += blockSize;
+		x += blockSize;
+	}
 
-	integral += width + 1u + integralPaddingElements;
+	// process remaining 0-7 pixels with scalar code
 
-	for (unsigned int y = 0u; y < height; ++y)
+	while (x < pixels)
 	{
-		*integral++ = 0u;
-		integralLastRow++;
+		rowSum += *source++;
+		*integral++ = *integralPreviousRow++ + rowSum;
+		++x;
+	}
 
-		// keep running sum as scalar - avoids memory round-trip
-		uint32_t rowSum = 0u;
+	return rowSum;
+}
 
-		unsigned int x = 0u;
+void IntegralImage::createLinedAndSquaredRow1Channel8BitSSE(const uint8_t* source, const uint32_t* integralAndSquaredPreviousRow, uint32_t* integralAndSquared, const unsigned int pixels, uint32_t& rowSum, uint32_t& rowSquaredSum)
+{
+	ocean_assert(source != nullptr);
+	ocean_assert(integralAndSquaredPreviousRow != nullptr && integralAndSquared != nullptr);
 
-		// main loop: process blockSize pixels at a time
-		while (x + blockSize <= width)
-		{
-			// load 8 bytes and zero-extend to 16-bit values
-			const __m128i source_8x8 = _mm_loadl_epi64((const __m128i*)(source));
-			const __m128i source_16x8 = _mm_cvtepu8_epi16(source_8x8);
-
-			// load previous row values (8 x 32-bit)
-			const __m128i lastRow_a_32x4 = _mm_loadu_si128((const __m128i*)(integralLastRow + 0));
-			const __m128i lastRow_b_32x4 = _mm_loadu_si128((const __m128i*)(integralLastRow + 4));
-
-			// widen source to 32-bit (first 4 elements)
-			__m128i source_a_32x4 = _mm_cvtepu16_epi32(source_16x8);
-			// widen source to 32-bit (second 4 elements)
-			__m128i source_b_32x4 = _mm_cvtepu16_epi32(_mm_srli_si128(source_16x8, 8));
-
-			// compute prefix sums for first 4 elements (parallel prefix pattern)
-			// step 1: [C0, C1, C2, C3] + [0, C0, C1, C2]
-			__m128i prefix_a_32x4 = _mm_add_epi32(source_a_32x4, _mm_alignr_epi8(source_a_32x4, constant_zero_u_128i, 12));
-			// step 2: + [0, 0, C0, C0+C1]
-			prefix_a_32x4 = _mm_add_epi32(prefix_a_32x4, _mm_alignr_epi8(prefix_a_32x4, constant_zero_u_128i, 8));
-
-			// broadcast rowSum and add previous row
-			__m128i rowSum_32x4 = _mm_set1_epi32(int(rowSum));
-			__m128i result_a_32x4 = _mm_add_epi32(prefix_a_32x4, _mm_add_epi32(lastRow_a_32x4, rowSum_32x4));
-
-			// update rowSum with sum of first 4 pixels (extract element 3)
-			rowSum += static_cast<uint32_t>(_mm_extract_epi32(prefix_a_32x4, 3));
-
-			// compute prefix sums for second 4 elements
-			__m128i prefix_b_32x4 = _mm_add_epi32(source_b_32x4, _mm_alignr_epi8(source_b_32x4, constant_zero_u_128i, 12));
-			prefix_b_32x4 = _mm_add_epi32(prefix_b_32x4, _mm_alignr_epi8(prefix_b_32x4, constant_zero_u_128i, 8));
-
-			// broadcast updated rowSum and add previous row
-			rowSum_32x4 = _mm_set1_epi32(int(rowSum));
-			__m128i result_b_32x4 = _mm_add_epi32(prefix_b_32x4, _mm_add_epi32(lastRow_b_32x4, rowSum_32x4));
-
-			// update rowSum with sum of second 4 pixels
-			rowSum += static_cast<uint32_t>(_mm_extract_epi32(prefix_b_32x4, 3));
-
-			// store results
-			_mm_storeu_si128((__m128i*)(integral + 0), result_a_32x4);
-			_mm_storeu_si128((__m128i*)(integral + 4), result_b_32x4);
-
-			source += blockSize;
-			integral += blockSize;
-			integralLastRow += blockSize;
-			x += blockSize;
-		}
+	/*
+	 * Same parallel prefix pattern as in createLinedRow1Channel8BitSSE(), applied to the pixel values and the squared pixel values.
+	 * The squared values of 8 bit pixels fit into 16 bit so that both prefix sums are determined with the same instructions.
+	 * Finally, both prefix sums are interleaved:
+	 *
+	 *   [I0 I1 I2 I3], [S0 S1 S2 S3]  ->  [I0 S0 I1 S1], [I2 S2 I3 S3]
+	 */
+
+	constexpr unsigned int blockSize = 8u;
+
+	const __m128i constant_zero_u_128i = _mm_setzero_si128();
+
+	unsigned int x = 0u;
 
-		// process remaining 0-7 pixels with scalar code
+	while (x + blockSize <= pixels)
+	{
+		const __m128i source_16x8 = _mm_cvtepu8_epi16(_mm_loadl_epi64((const __m128i*)(source)));
+		const __m128i squared_16x8 = _mm_mullo_epi16(source_16x8, source_16x8);
 
-		while (x < width)
+		for (unsigned int nBlock = 0u; nBlock < 2u; ++nBlock)
 		{
-			rowSum += *source++;
-			*integral++ = *integralLastRow++ + rowSum;
-			++x;
+			const __m128i values_32x4 = _mm_cvtepu16_epi32(nBlock == 0u ? source_16x8 : _mm_srli_si128(source_16x8, 8));
+			const __m128i squared_32x4 = _mm_cvtepu16_epi32(nBlock == 0u ? squared_16x8 : _mm_srli_si128(squared_16x8, 8));
+
+			__m128i prefix_32x4 = _mm_add_epi32(values_32x4, _mm_alignr_epi8(values_32x4, constant_zero_u_128i, 12));
+			prefix_32x4 = _mm_add_epi32(prefix_32x4, _mm_alignr_epi8(prefix_32x4, constant_zero_u_128i, 8));
+
+			__m128i prefixSquared_32x4 = _mm_add_epi32(squared_32x4, _mm_alignr_epi8(squared_32x4, constant_zero_u_128i, 12));
+			prefixSquared_32x4 = _mm_add_epi32(prefixSquared_32x4, _mm_alignr_epi8(prefixSquared_32x4, constant_zero_u_128i, 8));
+
+			const __m128i integral_32x4 = _mm_add_epi32(prefix_32x4, _mm_set1_epi32(int(rowSum)));
+			const __m128i integralSquared_32x4 = _mm_add_epi32(prefixSquared_32x4, _mm_set1_epi32(int(rowSquaredSum)));
+
+			rowSum += static_cast<uint32_t>(_mm_extract_epi32(prefix_32x4, 3));
+			rowSquaredSum += static_cast<uint32_t>(_mm_extract_epi32(prefixSquared_32x4, 3));
+
+			const __m128i previous_a_32x4 = _mm_loadu_si128((const __m128i*)(integralAndSquaredPreviousRow + 0));
+			const __m128i previous_b_32x4 = _mm_loadu_si128((const __m128i*)(integralAndSquaredPreviousRow + 4));
+
+			_mm_storeu_si128((__m128i*)(integralAndSquared + 0), _mm_add_epi32(_mm_unpacklo_epi32(integral_32x4, integralSquared_32x4), previous_a_32x4));
+			_mm_storeu_si128((__m128i*)(integralAndSquared + 4), _mm_add_epi32(_mm_unpackhi_epi32(integral_32x4, integralSquared_32x4), previous_b_32x4));
+
+			integralAndSquaredPreviousRow += 8;
+			integralAndSquared += 8;
 		}
 
-		source += sourcePaddingElements;
-		integral += integralPaddingElements;
-		integralLastRow += integralPaddingElements;
+		source += blockSize;
+		x += blockSize;
+	}
+
+	while (x < pixels)
+	{
+		rowSum += *source;
+		rowSquaredSum += uint32_t(*source) * uint32_t(*source);
+		++source;
+
+		*integralAndSquared++ = *integralAndSquaredPreviousRow++ + rowSum;
+		*integralAndSquared++ = *integralAndSquaredPreviousRow++ + rowSquaredSum;
+		++x;
 	}
 }
 
@@ -288,23 +326,12 @@ void IntegralImage::createLinedImage1Channel8BitSSE(const uint8_t* source, uint3
 
 // the code within this scoped seems to be faster on ARM64 devices but slower on ARMv7 devices
 
-void IntegralImage::createLinedImage1Channel8BitNEON(const uint8_t* source, uint32_t* integral, const unsigned int width, const unsigned int height, const unsigned int sourcePaddingElements, const unsigned int integralPaddingElements)
+uint32_t IntegralImage::createLinedRow1Channel8BitNEON(const uint8_t* source, const uint32_t* integralPreviousRow, uint32_t* integral, const unsigned int pixels, uint32_t rowSum)
 {
 	ocean_assert(source != nullptr);
-	ocean_assert(integral != nullptr);
-	ocean_assert(width >= 8u && height != 0u);
-	ocean_assert(width * height <= 16777216u);
+	ocean_assert(integralPreviousRow != nullptr && integral != nullptr);
 
 	/*
-	 * This is the resulting lined integral image:
-	 *  ------------
-	 * |000000000000|
-	 * |0|----------|
-	 * |0|          |
-	 * |0| Integral |
-	 * |0|          |
-	 * |------------
-	 *
 	 * NEON-based implementation with scalar running sum optimization:
 	 *
 	 * For each block of 4 pixels we compute:
@@ -331,77 +358,124 @@ void IntegralImage::createLinedImage1Channel8BitNEON(const uint8_t* source, uint
 
 	const uint32x4_t constant_zero_u_32x4 = vdupq_n_u32(0u);
 
-	// entire top line will be set to zero
-	memset(integral, 0x00, sizeof(uint32_t) * (width + 1u));
+	unsigned int x = 0u;
 
-	uint32_t* integralLastRow = integral;
+	// main loop: process blockSize pixels at a time
+	while (x + blockSize <= pixels)
+	{
+		const uint16x8_t source_16x8 = vmovl_u8(vld1_u8(source));
 
-	integral += width + 1u + integralPaddingElements;
+		const uint32x4_t lastRow_a_32x4 = vld1q_u32(integralPreviousRow + 0);
+		const uint32x4_t lastRow_b_32x4 = vld1q_u32(integralPreviousRow + 4);
 
-	for (unsigned int y = 0u; y < height; ++y)
-	{
-		*integral++ = 0u;
-		integralLastRow++;
+		// widen source to 32-bit
+		const uint32x4_t source_a_32x4 = vmovl_u16(vget_low_u16(source_16x8));
+		const uint32x4_t source_b_32x4 = vmovl_u16(vget_high_u16(source_16x8));
 
-		// keep running sum as scalar - avoids memory round-trip
-		uint32_t rowSum = 0u;
+		// compute prefix sums for first 4 elements (parallel prefix pattern)
+		uint32x4_t prefix_a_32x4 = vaddq_u32(source_a_32x4, vextq_u32(constant_zero_u_32x4, source_a_32x4, 3));
+		prefix_a_32x4 = vaddq_u32(prefix_a_32x4, vextq_u32(constant_zero_u_32x4, prefix_a_32x4, 2));
 
-		unsigned int x = 0u;
+		// add previous row and rowSum
+		const uint32x4_t result_a_32x4 = vaddq_u32(prefix_a_32x4, vaddq_u32(lastRow_a_32x4, vdupq_n_u32(rowSum)));
 
-		// main loop: process blockSize pixels at a time
-		while (x + blockSize <= width)
-		{
-			const uint16x8_t source_16x8 = vmovl_u8(vld1_u8(source));
+		// update rowSum with sum of first 4 pixels
+		rowSum += vgetq_lane_u32(prefix_a_32x4, 3);
 
-			const uint32x4_t lastRow_a_32x4 = vld1q_u32(integralLastRow + 0);
-			const uint32x4_t lastRow_b_32x4 = vld1q_u32(integralLastRow + 4);
+		// compute prefix sums for second 4 elements
+		uint32x4_t prefix_b_32x4 = vaddq_u32(source_b_32x4, vextq_u32(constant_zero_u_32x4, source_b_32x4, 3));
+		prefix_b_32x4 = vaddq_u32(prefix_b_32x4, vextq_u32(constant_zero_u_32x4, prefix_b_32x4, 2));
 
-			// widen source to 32-bit
-			uint32x4_t source_a_32x4 = vmovl_u16(vget_low_u16(source_16x8));
-			uint32x4_t source_b_32x4 = vmovl_u16(vget_high_u16(source_16x8));
+		// add previous row and rowSum
+		const uint32x4_t result_b_32x4 = vaddq_u32(prefix_b_32x4, vaddq_u32(lastRow_b_32x4, vdupq_n_u32(rowSum)));
 
-			// compute prefix sums for first 4 elements (parallel prefix pattern)
-			uint32x4_t prefix_a_32x4 = vaddq_u32(source_a_32x4, vextq_u32(constant_zero_u_32x4, source_a_32x4, 3));
-			prefix_a_32x4 = vaddq_u32(prefix_a_32x4, vextq_u32(constant_zero_u_32x4, prefix_a_32x4, 2));
+		// update rowSum with sum of second 4 pixels
+		rowSum += vgetq_lane_u32(prefix_b_32x4, 3);
 
-			// add previous row and rowSum
-			uint32x4_t result_a_32x4 = vaddq_u32(prefix_a_32x4, vaddq_u32(lastRow_a_32x4, vdupq_n_u32(rowSum)));
+		// store results
+		vst1q_u32(integral + 0, result_a_32x4);
+		vst1q_u32(integral + 4, result_b_32x4);
 
-			// update rowSum with sum of first 4 pixels
-			rowSum += vgetq_lane_u32(prefix_a_32x4, 3);
+		source += blockSize;
+		integral += blockSize;
+		integralPreviousRow += blockSize;
+		x += blockSize;
+	}
 
-			// compute prefix sums for second 4 elements
-			uint32x4_t prefix_b_32x4 = vaddq_u32(source_b_32x4, vextq_u32(constant_zero_u_32x4, source_b_32x4, 3));
-			prefix_b_32x4 = vaddq_u32(prefix_b_32x4, vextq_u32(constant_zero_u_32x4, prefix_b_32x4, 2));
+	// process remaining 0-7 pixels with scalar code
 
-			// add previous row and rowSum
-			uint32x4_t result_b_32x4 = vaddq_u32(prefix_b_32x4, vaddq_u32(lastRow_b_32x4, vdupq_n_u32(rowSum)));
+	while (x < pixels)
+	{
+		rowSum += *source++;
+		*integral++ = *integralPreviousRow++ + rowSum;
+		++x;
+	}
 
-			// update rowSum with sum of second 4 pixels
-			rowSum += vgetq_lane_u32(prefix_b_32x4, 3);
+	return rowSum;
+}
 
-			// store results
-			vst1q_u32(integral + 0, result_a_32x4);
-			vst1q_u32(integral + 4, result_b_32x4);
+void IntegralImage::createLinedAndSquaredRow1Channel8BitNEON(const uint8_t* source, const uint32_t* integralAndSquaredPreviousRow, uint32_t* integralAndSquared, const unsigned int pixels, uint32_t& rowSum, uint32_t& rowSquaredSum)
+{
+	ocean_assert(source != nullptr);
+	ocean_assert(integralAndSquaredPreviousRow != nullptr && integralAndSquared != nullptr);
 
-			source += blockSize;
-			integral += blockSize;
-			integralLastRow += blockSize;
-			x += blockSize;
-		}
+	/*
+	 * Same parallel prefix pattern as in createLinedRow1Channel8BitNEON(), applied to the pixel values and the squared pixel values.
+	 * Finally, both prefix sums are interleaved:
+	 *
+	 *   [I0 I1 I2 I3], [S0 S1 S2 S3]  ->  [I0 S0 I1 S1], [I2 S2 I3 S3]
+	 */
+
+	constexpr unsigned int blockSize = 8u;
 
-		// process remaining 0-7 pixels with scalar code
+	const uint32x4_t constant_zero_u_32x4 = vdupq_n_u32(0u);
+
+	unsigned int x = 0u;
+
+	while (x + blockSize <= pixels)
+	{
+		const uint8x8_t source_u_8x8 = vld1_u8(source);
 
-		while (x < width)
+		const uint16x8_t source_16x8 = vmovl_u8(source_u_8x8);
+		const uint16x8_t squared_16x8 = vmull_u8(source_u_8x8, source_u_8x8);
+
+		for (unsigned int nBlock = 0u; nBlock < 2u; ++nBlock)
 		{
-			rowSum += *source++;
-			*integral++ = *integralLastRow++ + rowSum;
-			++x;
+			const uint32x4_t values_32x4 = vmovl_u16(nBlock == 0u ? vget_low_u16(source_16x8) : vget_high_u16(source_16x8));
+			const uint32x4_t squared_32x4 = vmovl_u16(nBlock == 0u ? vget_low_u16(squared_16x8) : vget_high_u16(squared_16x8));
+
+			uint32x4_t prefix_32x4 = vaddq_u32(values_32x4, vextq_u32(constant_zero_u_32x4, values_32x4, 3));
+			prefix_32x4 = vaddq_u32(prefix_32x4, vextq_u32(constant_zero_u_32x4, prefix_32x4, 2));
+
+			uint32x4_t prefixSquared_32x4 = vaddq_u32(squared_32x4, vextq_u32(constant_zero_u_32x4, squared_32x4, 3));
+			prefixSquared_32x4 = vaddq_u32(prefixSquared_32x4, vextq_u32(constant_zero_u_32x4, prefixSquared_32x4, 2));
+
+			const uint32x4_t integral_32x4 = vaddq_u32(prefix_32x4, vdupq_n_u32(rowSum));
+			const uint32x4_t integralSquared_32x4 = vaddq_u32(prefixSquared_32x4, vdupq_n_u32(rowSquaredSum));
+
+			rowSum += vgetq_lane_u32(prefix_32x4, 3);
+			rowSquaredSum += vgetq_lane_u32(prefixSquared_32x4, 3);
+
+			vst1q_u32(integralAndSquared + 0, vaddq_u32(vzip1q_u32(integral_32x4, integralSquared_32x4), vld1q_u32(integralAndSquaredPreviousRow + 0)));
+			vst1q_u32(integralAndSquared + 4, vaddq_u32(vzip2q_u32(integral_32x4, integralSquared_32x4), vld1q_u32(integralAndSquaredPreviousRow + 4)));
+
+			integralAndSquaredPreviousRow += 8;
+			integralAndSquared += 8;
 		}
 
-		source += sourcePaddingElements;
-		integral += integralPaddingElements;
-		integralLastRow += integralPaddingElements;
+		source += blockSize;
+		x += blockSize;
+	}
+
+	while (x < pixels)
+	{
+		rowSum += *source;
+		rowSquaredSum += uint32_t(*source) * uint32_t(*source);
+		++source;
+
+		*integralAndSquared++ = *integralAndSquaredPreviousRow++ + rowSum;
+		*integralAndSquared++ = *integralAndSquaredPreviousRow++ + rowSquaredSum;
+		++x;
 	}
 }
 
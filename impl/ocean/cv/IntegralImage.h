@@ -11,6 +11,7 @@
 #include "ocean/cv/CV.h"
 
 #include "ocean/base/Frame.h"
+#include "ocean/base/Worker.h"
 
 #include "ocean/math/Numeric.h"
 
@@ -167,13 +168,14 @@ class OCEAN_CV_EXPORT IntegralImage
 		 * @param height The height of the source frame in pixel, with range [0, infinity)
 		 * @param sourcePaddingElements The number of padding elements at the end of each row of the source frame, in elements, with range [0, infinity)
 		 * @param integralPaddingElements The number of padding elements at the end of each row of the integral frame, in elements, with range [0, infinity)
+		 * @param worker Optional worker object to distribute the computation, the rows are summed in parallel bands before the columns are accumulated in parallel stripes
 		 * @tparam T The data type of each pixel element of the source frame e.g., 'uint8_t' or 'float'
 		 * @tparam TIntegral The data type of each integral pixel element, e.g., 'unsigned int' or 'double'
 		 * @tparam tChannels The number of channels the source frame has, with range [1, infinity)
 		 * @see createImage(), createBorderedImage().
 		 */
 		template <typename T, typename TIntegral, unsigned int tChannels>
-		static void createLinedImage(const T* source, TIntegral* integral, const unsigned int width, const unsigned int height, const unsigned int sourcePaddingElements, const unsigned int integralPaddingElements);
+		static void createLinedImage(const T* source, TIntegral* integral, const unsigned int width, const unsigned int height, const unsigned int sourcePaddingElements, const unsigned int integralPaddingElements, Worker* worker = nullptr);
 
 		/**
 		 * Creates an integral image with squared pixel intensities from a given 1-plane image and adds an extra line (one column and one row) with zeros to the left and top image border.
@@ -230,13 +232,14 @@ class OCEAN_CV_EXPORT IntegralImage
 		 * @param height The height of the source frame in pixel, with range [1, infinity)
 		 * @param sourcePaddingElements The number of padding elements at the end of each row of the source frame, in elements, with range [0, infinity)
 		 * @param integralAndSquaredPaddingElements The number of padding elements at the end of each row of the integral frame, in elements, with range [0, infinity)
+		 * @param worker Optional worker object to distribute the computation, the rows are summed in parallel bands before the columns are accumulated in parallel stripes
 		 * @tparam T The data type of each pixel element of the source frame e.g., 'uint8_t' or 'float'
 		 * @tparam TIntegralAndSquared The data type of each integral (and squared integral) pixel element, e.g., 'unsigned int' or 'double'
 		 * @tparam tChannels The number of channels the source frame has, with range [1, infinity)
 		 * @see createLinedImage(), createLinedImageSquared().
 		 */
 		template <typename T, typename TIntegralAndSquared, unsigned int tChannels>
-		static void createLinedImageAndSquared(const T* source, TIntegralAndSquared* integralAndSquared, const unsigned int width, const unsigned int height, const unsigned int sourcePaddingElements, const unsigned int integralAndSquaredPaddingElements);
+		static void createLinedImageAndSquared(const T* source, TIntegralAndSquared* integralAndSquared, const unsigned int width, const unsigned int height, const unsigned int sourcePaddingElements, const unsigned int integralAndSquaredPaddingElements, Worker* worker = nullptr);
 
 		/**
 		 * Creates an integral image and squared integral image from a given 1-plane image and adds an extra line (one column and one row) with zeros to the left and top image border.
@@ -265,6 +268,7 @@ class OCEAN_CV_EXPORT IntegralImage
 		 * @param sourcePaddingElements The number of padding elements at the end of each row of the source frame, in elements, with range [0, infinity)
 		 * @param integralPaddingElements The number of padding elements at the end of each row of the integral frame, in elements, with range [0, infinity)
 		 * @param integralSquaredPaddingElements The number of padding elements at the end of each row of the integral squared frame, in elements, with range [0, infinity)
+		 * @param worker Optional worker object to distribute the computation, the rows are summed in parallel bands before the columns are accumulated in parallel stripes
 		 * @tparam T The data type of each pixel element of the source frame e.g., 'uint8_t' or 'float'
 		 * @tparam TIntegral The data type of each integral pixel element, e.g., 'unsigned int' or 'double'
 		 * @tparam TIntegralSquared The data type of each squared integral pixel element, e.g., 'unsigned int' or 'double'
@@ -272,7 +276,7 @@ class OCEAN_CV_EXPORT IntegralImage
 		 * @see createLinedImage(), createLinedImageSquared().
 		 */
 		template <typename T, typename TIntegral, typename TIntegralSquared, unsigned int tChannels>
-		static void createLinedImageAndSquared(const T* source, TIntegral* integral, TIntegralSquared* integralSquared, const unsigned int width, const unsigned int height, const unsigned int sourcePaddingElements, const unsigned int integralPaddingElements, const unsigned int integralSquaredPaddingElements);
+		static void createLinedImageAndSquared(const T* source, TIntegral* integral, TIntegralSquared* integralSquared, const unsigned int width, const unsigned int height, const unsigned int sourcePaddingElements, const unsigned int integralPaddingElements, const unsigned int integralSquaredPaddingElements, Worker* worker = nullptr);
 
 		/**
 		 * Creates a bordered integral image from a given 1-plane image and adds an extra border to the resulting integral image.
@@ -397,12 +401,13 @@ class OCEAN_CV_EXPORT IntegralImage
 		 * @param border The thickness of the border in pixel, with range [1, min(width, height)]
 		 * @param sourcePaddingElements The number of padding elements at the end of each row of the source frame, in elements, with range [0, infinity)
 		 * @param integralPaddingElements The number of padding elements at the end of each row of the integral frame, in elements, with range [0, infinity)
+		 * @param worker Optional worker object to distribute the computation, the rows are summed in parallel bands before the columns are accumulated in parallel stripes
 		 * @tparam T The data type of each pixel element of the source frame e.g., 'uint8_t' or 'float'
 		 * @tparam TIntegral The data type of each integral pixel element, e.g., 'unsigned int' or 'double'
 		 * @tparam tChannels The number of channels the source frame has, with range [1, infinity)
 		 */
 		template <typename T, typename TIntegral, unsigned int tChannels>
-		static void createBorderedImageMirror(const T* source, TIntegral* integral, const unsigned int width, const unsigned int height, const unsigned int border, const unsigned int sourcePaddingElements, const unsigned int integralPaddingElements);
+		static void createBorderedImageMirror(const T* source, TIntegral* integral, const unsigned int width, const unsigned int height, const unsigned int border, const unsigned int sourcePaddingElements, const unsigned int integralPaddingElements, Worker* worker = nullptr);
 
 		/**
 		 * Creates a bordered squared integral image from a given 1-plane image and adds an extra border with mirrored image content to the resulting integral image.
@@ -601,19 +606,166 @@ class OCEAN_CV_EXPORT IntegralImage
 
 	private:
 
-#if defined(OCEAN_HARDWARE_SSE_VERSION) && OCEAN_HARDWARE_SSE_VERSION >= 41
+		/**
+		 * Determines one row of a lined integral image, the row is based on the previous row of the integral image.
+		 * The first column of the resulting row is set to zero.
+		 * @param sourceRow The row of the source frame, with 'width' pixels, must be valid
+		 * @param integralPreviousRow The previous row of the integral image (starting at the zero column), with (width + 1) pixels, can be the (zero) top row of the integral image to determine the row-wise sums only, must be valid
+		 * @param integralRow The resulting row of the integral image (starting at the zero column), with (width + 1) pixels, must be valid
+		 * @param width The width of the source frame in pixel, with range [1, infinity)
+		 * @tparam T The data type of each pixel element of the source frame e.g., 'uint8_t' or 'float'
+		 * @tparam TIntegral The data type of each integral pixel element, e.g., 'unsigned int' or 'double'
+		 * @tparam tChannels The number of channels the source frame has, with range [1, infinity)
+		 */
+		template <typename T, typename TIntegral, unsigned int tChannels>
+		static inline void createLinedImageRow(const T* sourceRow, const TIntegral* integralPreviousRow, TIntegral* integralRow, const unsigned int width);
 
 		/**
-		 * Creates an integral image from 8 bit images with 1 channel and adds an extra line with zeros to the left and top image border and applies SSE instructions.
+		 * Determines one row of a joined lined integral and squared integral image, the row is based on the previous row of the integral image.
+		 * The first (double) column of the resulting row is set to zero.
+		 * @param sourceRow The row of the source frame, with 'width' pixels, must be valid
+		 * @param integralAndSquaredPreviousRow The previous row of the integral image (starting at the zero column), with (width + 1) * 2 pixels, can be the (zero) top row of the integral image to determine the row-wise sums only, must be valid
+		 * @param integralAndSquaredRow The resulting row of the integral image (starting at the zero column), with (width + 1) * 2 pixels, must be valid
+		 * @param width The width of the source frame in pixel, with range [1, infinity)
+		 * @tparam T The data type of each pixel element of the source frame e.g., 'uint8_t' or 'float'
+		 * @tparam TIntegralAndSquared The data type of each integral (and squared integral) pixel element, e.g., 'unsigned int' or 'double'
+		 * @tparam tChannels The number of channels the source frame has, with range [1, infinity)
+		 */
+		template <typename T, typename TIntegralAndSquared, unsigned int tChannels>
+		static inline void createLinedImageAndSquaredRow(const T* sourceRow, const TIntegralAndSquared* integralAndSquaredPreviousRow, TIntegralAndSquared* integralAndSquaredRow, const unsigned int width);
+
+		/**
+		 * Determines one row of a bordered integral image with mirrored border, the row is based on the previous row of the integral image.
+		 * The first column of the resulting row is set to zero.
+		 * @param sourceRow The (mirrored) row of the source frame, with 'width' pixels, must be valid
+		 * @param integralPreviousRow The previous row of the integral image (starting at the zero column), with (width + 2 * border + 1) pixels, can be the (zero) top row of the integral image to determine the row-wise sums only, must be valid
+		 * @param integralRow The resulting row of the integral image (starting at the zero column), with (width + 2 * border + 1) pixels, must be valid
+		 * @param width The width of the source frame in pixel, with range [1, infinity)
+		 * @param border The thickness of the border in pixel, with range [1, width]
+		 * @tparam T The data type of each pixel element of the source frame e.g., 'uint8_t' or 'float'
+		 * @tparam TIntegral The data type of each integral pixel element, e.g., 'unsigned int' or 'double'
+		 * @tparam tChannels The number of channels the source frame has, with range [1, infinity)
+		 */
+		template <typename T, typename TIntegral, unsigned int tChannels>
+		static inline void createBorderedImageMirrorRow(const T* sourceRow, const TIntegral* integralPreviousRow, TIntegral* integralRow, const unsigned int width, const unsigned int border);
+
+		/**
+		 * Determines the row-wise sums of a subset of rows of a lined integral image, the rows are not accumulated vertically.
+		 * The top row of the integral image must be set to zero already.
 		 * @param source The image for which the integral image will be determined, with size width x height, must be valid
 		 * @param integral The resulting integral image, with size (width + 1)x(height + 1), must be valid
-		 * @param width The width of the given image in pixel, with range [8, 4096^2]
-		 * @param height The height of the given image in pixel, with range [1, 4096^2 / width]
+		 * @param width The width of the source frame in pixel, with range [1, infinity)
+		 * @param height The height of the source frame in pixel, with range [1, infinity)
 		 * @param sourcePaddingElements The number of padding elements at the end of each row of the source frame, in elements, with range [0, infinity)
 		 * @param integralPaddingElements The number of padding elements at the end of each row of the integral frame, in elements, with range [0, infinity)
-		 * @see createLinedImage8BitPerChannel<tChannels>().
+		 * @param firstRow The first source row to be handled, with range [0, height - 1]
+		 * @param numberRows The number of source rows to be handled, with range [1, height - firstRow]
+		 * @tparam T The data type of each pixel element of the source frame e.g., 'uint8_t' or 'float'
+		 * @tparam TIntegral The data type of each integral pixel element, e.g., 'unsigned int' or 'double'
+		 * @tparam tChannels The number of channels the source frame has, with range [1, infinity)
+		 * @see accumulateRowsSubset().
+		 */
+		template <typename T, typename TIntegral, unsigned int tChannels>
+		static void createLinedImageRowsSubset(const T* source, TIntegral* integral, const unsigned int width, const unsigned int height, const unsigned int sourcePaddingElements, const unsigned int integralPaddingElements, const unsigned int firstRow, const unsigned int numberRows);
+
+		/**
+		 * Determines the row-wise sums of a subset of rows of a joined lined integral and squared integral image, the rows are not accumulated vertically.
+		 * The top row of the integral image must be set to zero already.
+		 * @param source The image for which the integral image will be determined, with size width x height, must be valid
+		 * @param integralAndSquared The resulting integral (and squared integral) image, with size ((width + 1) * 2)x(height + 1), must be valid
+		 * @param width The width of the source frame in pixel, with range [1, infinity)
+		 * @param height The height of the source frame in pixel, with range [1, infinity)
+		 * @param sourcePaddingElements The number of padding elements at the end of each row of the source frame, in elements, with range [0, infinity)
+		 * @param integralAndSquaredPaddingElements The number of padding elements at the end of each row of the integral frame, in elements, with range [0, infinity)
+		 * @param firstRow The first source row to be handled, with range [0, height - 1]
+		 * @param numberRows The number of source rows to be handled, with range [1, height - firstRow]
+		 * @tparam T The data type of each pixel element of the source frame e.g., 'uint8_t' or 'float'
+		 * @tparam TIntegralAndSquared The data type of each integral (and squared integral) pixel element, e.g., 'unsigned int' or 'double'
+		 * @tparam tChannels The number of channels the source frame has, with range [1, infinity)
+		 * @see accumulateRowsSubset().
 		 */
-		static void createLinedImage1Channel8BitSSE(const uint8_t* source, uint32_t* integral, const unsigned int width, const unsigned int height, const unsigned int sourcePaddingElements, const unsigned int integralPaddingElements);
+		template <typename T, typename TIntegralAndSquared, unsigned int tChannels>
+		static void createLinedImageAndSquaredRowsSubset(const T* source, TIntegralAndSquared* integralAndSquared, const unsigned int width, const unsigned int height, const unsigned int sourcePaddingElements, const unsigned int integralAndSquaredPaddingElements, const unsigned int firstRow, const unsigned int numberRows);
+
+		/**
+		 * Determines the row-wise sums of a subset of rows of two separate lined integral and squared integral images, the rows are not accumulated vertically.
+		 * The top rows of both integral images must be set to zero already.
+		 * @param source The image for which the integral image will be determined, with size width x height, must be valid
+		 * @param integral The resulting integral image, with size (width + 1)x(height + 1), must be valid
+		 * @param integralSquared The resulting squared integral image, with size (width + 1)x(height + 1), must be valid
+		 * @param width The width of the source frame in pixel, with range [1, infinity)
+		 * @param height The height of the source frame in pixel, with range [1, infinity)
+		 * @param sourcePaddingElements The number of padding elements at the end of each row of the source frame, in elements, with range [0, infinity)
+		 * @param integralPaddingElements The number of padding elements at the end of each row of the integral frame, in elements, with range [0, infinity)
+		 * @param integralSquaredPaddingElements The number of padding elements at the end of each row of the integral squared frame, in elements, with range [0, infinity)
+		 * @param firstRow The first source row to be handled, with range [0, height - 1]
+		 * @param numberRows The number of source rows to be handled, with range [1, height - firstRow]
+		 * @tparam T The data type of each pixel element of the source frame e.g., 'uint8_t' or 'float'
+		 * @tparam TIntegral The data type of each integral pixel element, e.g., 'unsigned int' or 'double'
+		 * @tparam TIntegralSquared The data type of each squared integral pixel element, e.g., 'unsigned int' or 'double'
+		 * @tparam tChannels The number of channels the source frame has, with range [1, infinity)
+		 * @see accumulateRowsSubset().
+		 */
+		template <typename T, typename TIntegral, typename TIntegralSquared, unsigned int tChannels>
+		static void createLinedImageAndSquaredRowsSubset(const T* source, TIntegral* integral, TIntegralSquared* integralSquared, const unsigned int width, const unsigned int height, const unsigned int sourcePaddingElements, const unsigned int integralPaddingElements, const unsigned int integralSquaredPaddingElements, const unsigned int firstRow, const unsigned int numberRows);
+
+		/**
+		 * Determines the row-wise sums of a subset of rows of a bordered integral image with mirrored border, the rows are not accumulated vertically.
+		 * The top row of the integral image must be set to zero already.
+		 * @param source The image for which the integral image will be determined, with size width x height, must be valid
+		 * @param integral The resulting integral image, with size (1 + border * 2 + width)x(1 + border * 2 + height), must be valid
+		 * @param width The width of the source frame in pixel, with range [1, infinity)
+		 * @param height The height of the source frame in pixel, with range [1, infinity)
+		 * @param border The thickness of the border in pixel, with range [1, min(width, height)]
+		 * @param sourcePaddingElements The number of padding elements at the end of each row of the source frame, in elements, with range [0, infinity)
+		 * @param integralPaddingElements The number of padding elements at the end of each row of the integral frame, in elements, with range [0, infinity)
+		 * @param firstRow The first integral row to be handled (not counting the zero top row), with range [0, height + border * 2 - 1]
+		 * @param numberRows The number of integral rows to be handled, with range [1, height + border * 2 - firstRow]
+		 * @tparam T The data type of each pixel element of the source frame e.g., 'uint8_t' or 'float'
+		 * @tparam TIntegral The data type of each integral pixel element, e.g., 'unsigned int' or 'double'
+		 * @tparam tChannels The number of channels the source frame has, with range [1, infinity)
+		 * @see accumulateRowsSubset().
+		 */
+		template <typename T, typename TIntegral, unsigned int tChannels>
+		static void createBorderedImageMirrorRowsSubset(const T* source, TIntegral* integral, const unsigned int width, const unsigned int height, const unsigned int border, const unsigned int sourcePaddingElements, const unsigned int integralPaddingElements, const unsigned int firstRow, const unsigned int numberRows);
+
+		/**
+		 * Accumulates a subset of columns of an image with row-wise sums vertically so that the image becomes an integral image.
+		 * Each thread handles a vertical stripe of the image (from top to bottom) so that the stripes can be handled concurrently.
+		 * @param integral The first row of the image to be accumulated (the first row does not change), must be valid
+		 * @param integralStrideElements The number of elements between two row starts, in elements, with range [firstElement + numberElements, infinity)
+		 * @param rows The number of rows to be accumulated, with range [1, infinity)
+		 * @param firstElement The first element within each row to be handled, with range [0, infinity)
+		 * @param numberElements The number of elements within each row to be handled, with range [1, infinity)
+		 * @tparam TIntegral The data type of each integral pixel element, e.g., 'unsigned int' or 'double'
+		 */
+		template <typename TIntegral>
+		static void accumulateRowsSubset(TIntegral* integral, const unsigned int integralStrideElements, const unsigned int rows, const unsigned int firstElement, const unsigned int numberElements);
+
+#if defined(OCEAN_HARDWARE_SSE_VERSION) && OCEAN_HARDWARE_SSE_VERSION >= 41
+
+		/**
+		 * Determines the integral values of several pixels of one row of an 8 bit image with 1 channel and applies SSE instructions.
+		 * Each resulting integral value is the sum of the corresponding integral value in the previous row, the running row sum, and all source pixels up to (including) the pixel.
+		 * @param source The source pixels, must be valid
+		 * @param integralPreviousRow The integral values of the previous row, one for each pixel, must be valid
+		 * @param integral The resulting integral values, one for each pixel, must be valid
+		 * @param pixels The number of pixels to be handled, with range [0, infinity)
+		 * @param rowSum The running row sum of all pixels left of the first pixel
+		 * @return The running row sum including all handled pixels
+		 */
+		static uint32_t createLinedRow1Channel8BitSSE(const uint8_t* source, const uint32_t* integralPreviousRow, uint32_t* integral, const unsigned int pixels, uint32_t rowSum);
+
+		/**
+		 * Determines the interleaved integral and squared integral values of several pixels of one row of an 8 bit image with 1 channel and applies SSE instructions.
+		 * @param source The source pixels, must be valid
+		 * @param integralAndSquaredPreviousRow The interleaved integral and squared integral values of the previous row, two for each pixel, must be valid
+		 * @param integralAndSquared The resulting interleaved integral and squared integral values, two for each pixel, must be valid
+		 * @param pixels The number of pixels to be handled, with range [0, infinity)
+		 * @param rowSum The running row sum of all pixels left of the first pixel, will be updated
+		 * @param rowSquaredSum The running row sum of all squared pixels left of the first pixel, will be updated
+		 */
+		static void createLinedAndSquaredRow1Channel8BitSSE(const uint8_t* source, const uint32_t* integralAndSquaredPreviousRow, uint32_t* integralAndSquared, const unsigned int pixels, uint32_t& rowSum, uint32_t& rowSquaredSum);
 
 #endif // OCEAN_HARDWARE_SSE_VERSION >= 41
 
@@ -622,16 +774,27 @@ class OCEAN_CV_EXPORT IntegralImage
 #if defined(__aarch64__)
 
 		/**
-		 * Creates an integral image from 8 bit images with 1 channel and adds an extra line with zeros to the left and top image border and applies NEON instructions.
-		 * @param source The image for which the integral image will be determined, with size width x height, must be valid
-		 * @param integral The resulting integral image, with size (width + 1)x(height + 1), must be valid
-		 * @param width The width of the given image in pixel, with range [8, 4096^2]
-		 * @param height The height of the given image in pixel, with range [1, 4096^2 / width]
-		 * @param sourcePaddingElements The number of padding elements at the end of each row of the source frame, in elements, with range [0, infinity)
-		 * @param integralPaddingElements The number of padding elements at the end of each row of the integral frame, in elements, with range [0, infinity)
-		 * @see createLinedImage8BitPerChannel<tChannels>().
+		 * Determines the integral values of several pixels of one row of an 8 bit image with 1 channel and applies NEON instructions.
+		 * Each resulting integral value is the sum of the corresponding integral value in the previous row, the running row sum, and all source pixels up to (including) the pixel.
+		 * @param source The source pixels, must be valid
+		 * @param integralPreviousRow The integral values of the previous row, one for each pixel, must be valid
+		 * @param integral The resulting integral values, one for each pixel, must be valid
+		 * @param pixels The number of pixels to be handled, with range [0, infinity)
+		 * @param rowSum The running row sum of all pixels left of the first pixel
+		 * @return The running row sum including all handled pixels
+		 */
+		static uint32_t createLinedRow1Channel8BitNEON(const uint8_t* source, const uint32_t* integralPreviousRow, uint32_t* integral, const unsigned int pixels, uint32_t rowSum);
+
+		/**
+		 * Determines the interleaved integral and squared integral values of several pixels of one row of an 8 bit image with 1 channel and applies NEON instructions.
+		 * @param source The source pixels, must be valid
+		 * @param integralAndSquaredPreviousRow The interleaved integral and squared integral values of the previous row, two for each pixel, must be valid
+		 * @param integralAndSquared The resulting interleaved integral and squared integral values, two for each pixel, must be valid
+		 * @param pixels The number of pixels to be handled, with range [0, infinity)
+		 * @param rowSum The running row sum of all pixels left of the first pixel, will be updated
+		 * @param rowSquaredSum The running row sum of all squared pixels left of the first pixel, will be updated
 		 */
-		static void createLinedImage1Channel8BitNEON(const uint8_t* source, uint32_t* integral, const unsigned int width, const unsigned int height, const unsigned int sourcePaddingElements, const unsigned int integralPaddingElements);
+		static void createLinedAndSquaredRow1Channel8BitNEON(const uint8_t* source, const uint32_t* integralAndSquaredPreviousRow, uint32_t* integralAndSquared, const unsigned int pixels, uint32_t& rowSum, uint32_t& rowSquaredSum);
 
 #endif // defined(__aarch64__)
 
@@ -720,7 +883,7 @@ void IntegralImage::createImage(const T* source, TIntegral* integral, const unsi
 }
 
 template <typename T, typename TIntegral, unsigned int tChannels>
-void IntegralImage::createLinedImage(const T* source, TIntegral* integral, const unsigned int width, const unsigned int height, const unsigned int sourcePaddingElements, const unsigned int integralPaddingElements)
+void IntegralImage::createLinedImage(const T* source, TIntegral* integral, const unsigned int width, const unsigned int height, const unsigned int sourcePaddingElements, const unsigned int integralPaddingElements, Worker* worker)
 {
 	static_assert(std::is_signed<T>::value == std::is_signed<TIntegral>::value, "The integral image must have the same sign-properties as the source image!");
 	static_assert(sizeof(T) <= sizeof(TIntegral), "Invalid integral elements!");
@@ -731,25 +894,39 @@ void IntegralImage::createLinedImage(const T* source, TIntegral* integral, const
 
 	ocean_assert((std::is_floating_point<T>::value) || (double(NumericT<T>::maxValue()) * double(width * height) <= double(NumericT<TIntegral>::maxValue())));
 
-#if defined(OCEAN_HARDWARE_SSE_VERSION) && OCEAN_HARDWARE_SSE_VERSION >= 41
+	const unsigned int integralStrideElements = (width + 1u) * tChannels + integralPaddingElements;
 
-	if (std::is_same<T, uint8_t>::value && std::is_same<TIntegral, uint32_t>::value && tChannels == 1u && width >= 8u)
+	if (worker != nullptr)
 	{
-		createLinedImage1Channel8BitSSE((const uint8_t*)source, (uint32_t*)integral, width, height, sourcePaddingElements, integralPaddingElements);
+		// entire top line will be set to zero, the line is used as previous row for the row-wise sums
+		memset(integral, 0x00, (width + 1u) * tChannels * sizeof(TIntegral));
+
+		// first pass: the row-wise sums are independent of each other, second pass: the columns are accumulated in independent stripes
+
+		worker->executeFunction(Worker::Function::createStatic(&IntegralImage::createLinedImageRowsSubset<T, TIntegral, tChannels>, source, integral, width, height, sourcePaddingElements, integralPaddingElements, 0u, 0u), 0u, height, 6u, 7u, 20u);
+		worker->executeFunction(Worker::Function::createStatic(&IntegralImage::accumulateRowsSubset<TIntegral>, integral + integralStrideElements, integralStrideElements, height, 0u, 0u), 0u, (width + 1u) * tChannels, 3u, 4u, 64u);
+
 		return;
 	}
 
-#endif // OCEAN_HARDWARE_SSE_VERSION >= 41
-
-#if defined(OCEAN_HARDWARE_NEON_VERSION) && OCEAN_HARDWARE_NEON_VERSION >= 10 && defined(__aarch64__)
+#if (defined(OCEAN_HARDWARE_SSE_VERSION) && OCEAN_HARDWARE_SSE_VERSION >= 41) || (defined(OCEAN_HARDWARE_NEON_VERSION) && OCEAN_HARDWARE_NEON_VERSION >= 10 && defined(__aarch64__))
 
-	if (std::is_same<T, uint8_t>::value && std::is_same<TIntegral, uint32_t>::value && tChannels == 1u && width >= 8u)
+	if constexpr (std::is_same<T, uint8_t>::value && std::is_same<TIntegral, uint32_t>::value && tChannels == 1u)
 	{
-		createLinedImage1Channel8BitNEON((const uint8_t*)source, (uint32_t*)integral, width, height, sourcePaddingElements, integralPaddingElements);
+		// entire top line will be set to zero
+		memset(integral, 0x00, (width + 1u) * sizeof(TIntegral));
+
+		const unsigned int sourceStrideElements = width + sourcePaddingElements;
+
+		for (unsigned int y = 0u; y < height; ++y)
+		{
+			createLinedImageRow<T, TIntegral, tChannels>(source + y * sourceStrideElements, integral + y * integralStrideElements, integral + (y + 1u) * integralStrideElements, width);
+		}
+
 		return;
 	}
 
-#endif // OCEAN_HARDWARE_NEON_VERSION >= 10 && defined(__aarch64__)
+#endif // OCEAN_HARDWARE_SSE_VERSION >= 41 || (OCEAN_HARDWARE_NEON_VERSION >= 10 && defined(__aarch64__))
 
 	/*
 	 * This is the resulting lined integral image.
@@ -942,7 +1119,7 @@ void IntegralImage::createLinedImageSquared(const T* source, TIntegral* integral
 }
 
 template <typename T, typename TIntegralAndSquared, unsigned int tChannels>
-void IntegralImage::createLinedImageAndSquared(const T* source, TIntegralAndSquared* integralAndSquared, const unsigned int width, const unsigned int height, const unsigned int sourcePaddingElements, const unsigned int integralAndSquaredPaddingElements)
+void IntegralImage::createLinedImageAndSquared(const T* source, TIntegralAndSquared* integralAndSquared, const unsigned int width, const unsigned int height, const unsigned int sourcePaddingElements, const unsigned int integralAndSquaredPaddingElements, Worker* worker)
 {
 	static_assert(sizeof(T) <= sizeof(TIntegralAndSquared), "Invalid integral elements!");
 	static_assert(tChannels >= 1u, "Invalid channel number!");
@@ -955,6 +1132,32 @@ void IntegralImage::createLinedImageAndSquared(const T* source, TIntegralAndSqua
 	// entire top line will be set to zero
 	memset(integralAndSquared, 0x00, (width + 1u) * tChannels * sizeof(TIntegralAndSquared) * 2u);
 
+	const unsigned int integralAndSquaredStrideElements = (width + 1u) * tChannels * 2u + integralAndSquaredPaddingElements;
+
+	if (worker != nullptr)
+	{
+		worker->executeFunction(Worker::Function::createStatic(&IntegralImage::createLinedImageAndSquaredRowsSubset<T, TIntegralAndSquared, tChannels>, source, integralAndSquared, width, height, sourcePaddingElements, integralAndSquaredPaddingElements, 0u, 0u), 0u, height, 6u, 7u, 20u);
+		worker->executeFunction(Worker::Function::createStatic(&IntegralImage::accumulateRowsSubset<TIntegralAndSquared>, integralAndSquared + integralAndSquaredStrideElements, integralAndSquaredStrideElements, height, 0u, 0u), 0u, (width + 1u) * tChannels * 2u, 3u, 4u, 64u);
+
+		return;
+	}
+
+#if (defined(OCEAN_HARDWARE_SSE_VERSION) && OCEAN_HARDWARE_SSE_VERSION >= 41) || (defined(OCEAN_HARDWARE_NEON_VERSION) && OCEAN_HARDWARE_NEON_VERSION >= 10 && defined(__aarch64__))
+
+	if constexpr (std::is_same<T, uint8_t>::value && std::is_same<TIntegralAndSquared, uint32_t>::value && tChannels == 1u)
+	{
+		const unsigned int sourceStrideElements = width + sourcePaddingElements;
+
+		for (unsigned int y = 0u; y < height; ++y)
+		{
+			createLinedImageAndSquaredRow<T, TIntegralAndSquared, tChannels>(source + y * sourceStrideElements, integralAndSquared + y * integralAndSquaredStrideElements, integralAndSquared + (y + 1u) * integralAndSquaredStrideElements, width);
+		}
+
+		return;
+	}
+
+#endif // OCEAN_HARDWARE_SSE_VERSION >= 41 || (OCEAN_HARDWARE_NEON_VERSION >= 10 && defined(__aarch64__))
+
 #ifdef OCEAN_DEBUG
 	for (unsigned int n = 0u; n < (width + 1u) * 2u; ++n)
 	{
@@ -1053,7 +1256,7 @@ void IntegralImage::createLinedImageAndSquared(const T* source, TIntegralAndSqua
 }
 
 template <typename T, typename TIntegral, typename TIntegralSquared, unsigned int tChannels>
-void IntegralImage::createLinedImageAndSquared(const T* source, TIntegral* integral, TIntegralSquared* integralSquared, const unsigned int width, const unsigned int height, const unsigned int sourcePaddingElements, const unsigned int integralPaddingElements, const unsigned int integralSquaredPaddingElements)
+void IntegralImage::createLinedImageAndSquared(const T* source, TIntegral* integral, TIntegralSquared* integralSquared, const unsigned int width, const unsigned int height, const unsigned int sourcePaddingElements, const unsigned int integralPaddingElements, const unsigned int integralSquaredPaddingElements, Worker* worker)
 {
 	static_assert(sizeof(T) <= sizeof(TIntegral), "Invalid integral elements!");
 	static_assert(sizeof(TIntegral) <= sizeof(TIntegralSquared), "Invalid integral elements!");
@@ -1068,6 +1271,18 @@ void IntegralImage::createLinedImageAndSquared(const T* source, TIntegral* integ
 	memset(integral, 0x00, (width + 1u) * tChannels * sizeof(TIntegral));
 	memset(integralSquared, 0x00, (width + 1u) * tChannels * sizeof(TIntegralSquared));
 
+	if (worker != nullptr)
+	{
+		const unsigned int integralStrideElements = (width + 1u) * tChannels + integralPaddingElements;
+		const unsigned int integralSquaredStrideElements = (width + 1u) * tChannels + integralSquaredPaddingElements;
+
+		worker->executeFunction(Worker::Function::createStatic(&IntegralImage::createLinedImageAndSquaredRowsSubset<T, TIntegral, TIntegralSquared, tChannels>, source, integral, integralSquared, width, height, sourcePaddingElements, integralPaddingElements, integralSquaredPaddingElements, 0u, 0u), 0u, height, 8u, 9u, 20u);
+		worker->executeFunction(Worker::Function::createStatic(&IntegralImage::accumulateRowsSubset<TIntegral>, integral + integralStrideElements, integralStrideElements, height, 0u, 0u), 0u, (width + 1u) * tChannels, 3u, 4u, 64u);
+		worker->executeFunction(Worker::Function::createStatic(&IntegralImage::accumulateRowsSubset<TIntegralSquared>, integralSquared + integralSquaredStrideElements, integralSquaredStrideElements, height, 0u, 0u), 0u, (width + 1u) * tChannels, 3u, 4u, 64u);
+
+		return;
+	}
+
 #ifdef OCEAN_DEBUG
 	for (unsigned int n = 0u; n < width + 1u; ++n)
 	{
@@ -1528,7 +1743,7 @@ void IntegralImage::createBorderedImageSquared(const T* source, TIntegral* integ
 }
 
 template <typename T, typename TIntegral, unsigned int tChannels>
-void IntegralImage::createBorderedImageMirror(const T* source, TIntegral* integral, const unsigned int width, const unsigned int height, const unsigned int border, const unsigned int sourcePaddingElements, const unsigned int integralPaddingElements)
+void IntegralImage::createBorderedImageMirror(const T* source, TIntegral* integral, const unsigned int width, const unsigned int height, const unsigned int border, const unsigned int sourcePaddingElements, const unsigned int integralPaddingElements, Worker* worker)
 {
 	static_assert(sizeof(T) <= sizeof(TIntegral), "Invalid integral elements!");
 	static_assert(tChannels >= 1u, "Invalid channel number!");
@@ -1566,6 +1781,46 @@ void IntegralImage::createBorderedImageMirror(const T* source, TIntegral* integr
 
 	// entire first row (plus the extra zero-column) will be set to zero
 	memset(integral, 0, integralWidth * sizeof(TIntegral) * tChannels);
+
+	if (worker != nullptr)
+	{
+		const unsigned int integralHeight = height + border * 2u;
+
+		worker->executeFunction(Worker::Function::createStatic(&IntegralImage::createBorderedImageMirrorRowsSubset<T, TIntegral, tChannels>, source, integral, width, height, border, sourcePaddingElements, integralPaddingElements, 0u, 0u), 0u, integralHeight, 7u, 8u, 20u);
+		worker->executeFunction(Worker::Function::createStatic(&IntegralImage::accumulateRowsSubset<TIntegral>, integral + integralStrideElements, integralStrideElements, integralHeight, 0u, 0u), 0u, integralWidth * tChannels, 3u, 4u, 64u);
+
+		return;
+	}
+
+#if (defined(OCEAN_HARDWARE_SSE_VERSION) && OCEAN_HARDWARE_SSE_VERSION >= 41) || (defined(OCEAN_HARDWARE_NEON_VERSION) && OCEAN_HARDWARE_NEON_VERSION >= 10 && defined(__aarch64__))
+
+	if constexpr (std::is_same<T, uint8_t>::value && std::is_same<TIntegral, uint32_t>::value && tChannels == 1u)
+	{
+		for (unsigned int row = 0u; row < height + border * 2u; ++row)
+		{
+			const int y = int(row) - int(border);
+
+			unsigned int sourceRow = (unsigned int)(y);
+
+			if (y < 0)
+			{
+				sourceRow = (unsigned int)(-y - 1);
+			}
+			else if (y >= int(height))
+			{
+				sourceRow = (unsigned int)(2 * int(height) - y - 1);
+			}
+
+			ocean_assert(sourceRow < height);
+
+			createBorderedImageMirrorRow<T, TIntegral, tChannels>(source + sourceRow * sourceStrideElements, integral + row * integralStrideElements, integral + (row + 1u) * integralStrideElements, width, border);
+		}
+
+		return;
+	}
+
+#endif // OCEAN_HARDWARE_SSE_VERSION >= 41 || (OCEAN_HARDWARE_NEON_VERSION >= 10 && defined(__aarch64__))
+
 	integral += integralStrideElements;
 
 	const TIntegral* integralPreviousRow = integral + tChannels;
@@ -2053,6 +2308,364 @@ inline TVariance IntegralImage::linedIntegralVariance(const TIntegral* linedInte
 	return std::max(TVariance(0), variance); // due to floating point precision, always ensure that the variance is non-negative
 }
 
+template <typename T, typename TIntegral, unsigned int tChannels>
+inline void IntegralImage::createLinedImageRow(const T* sourceRow, const TIntegral* integralPreviousRow, TIntegral* integralRow, const unsigned int width)
+{
+	static_assert(tChannels >= 1u, "Invalid channel number!");
+
+	ocean_assert(sourceRow != nullptr && integralPreviousRow != nullptr && integralRow != nullptr);
+	ocean_assert(width >= 1u);
+
+	// left pixel
+	for (unsigned int n = 0u; n < tChannels; ++n)
+	{
+		integralRow[n] = TIntegral(0);
+	}
+
+	integralPreviousRow += tChannels;
+	integralRow += tChannels;
+
+#if defined(OCEAN_HARDWARE_SSE_VERSION) && OCEAN_HARDWARE_SSE_VERSION >= 41
+
+	if constexpr (std::is_same<T, uint8_t>::value && std::is_same<TIntegral, uint32_t>::value && tChannels == 1u)
+	{
+		createLinedRow1Channel8BitSSE(sourceRow, integralPreviousRow, integralRow, width, 0u);
+		return;
+	}
+
+#elif defined(OCEAN_HARDWARE_NEON_VERSION) && OCEAN_HARDWARE_NEON_VERSION >= 10 && defined(__aarch64__)
+
+	if constexpr (std::is_same<T, uint8_t>::value && std::is_same<TIntegral, uint32_t>::value && tChannels == 1u)
+	{
+		createLinedRow1Channel8BitNEON(sourceRow, integralPreviousRow, integralRow, width, 0u);
+		return;
+	}
+
+#endif // OCEAN_HARDWARE_SSE_VERSION >= 41
+
+	TIntegral previousIntegral[tChannels] = {TIntegral(0)};
+
+	for (unsigned int x = 0u; x < width; ++x)
+	{
+		for (unsigned int n = 0u; n < tChannels; ++n)
+		{
+			previousIntegral[n] += sourceRow[n];
+		}
+
+		for (unsigned int n = 0u; n < tChannels; ++n)
+		{
+			integralRow[n] = previousIntegral[n] + integralPreviousRow[n];
+		}
+
+		sourceRow += tChannels;
+		integralPreviousRow += tChannels;
+		integralRow += tChannels;
+	}
+}
+
+template <typename T, typename TIntegralAndSquared, unsigned int tChannels>
+inline void IntegralImage::createLinedImageAndSquaredRow(const T* sourceRow, const TIntegralAndSquared* integralAndSquaredPreviousRow, TIntegralAndSquared* integralAndSquaredRow, const unsigned int width)
+{
+	static_assert(tChannels >= 1u, "Invalid channel number!");
+
+	ocean_assert(sourceRow != nullptr && integralAndSquaredPreviousRow != nullptr && integralAndSquaredRow != nullptr);
+	ocean_assert(width >= 1u);
+
+	// left pixel integral and squared integral
+	for (unsigned int n = 0u; n < tChannels * 2u; ++n)
+	{
+		integralAndSquaredRow[n] = TIntegralAndSquared(0);
+	}
+
+	integralAndSquaredPreviousRow += tChannels * 2u;
+	integralAndSquaredRow += tChannels * 2u;
+
+#if defined(OCEAN_HARDWARE_SSE_VERSION) && OCEAN_HARDWARE_SSE_VERSION >= 41
+
+	if constexpr (std::is_same<T, uint8_t>::value && std::is_same<TIntegralAndSquared, uint32_t>::value && tChannels == 1u)
+	{
+		uint32_t rowSum = 0u;
+		uint32_t rowSquaredSum = 0u;
+
+		createLinedAndSquaredRow1Channel8BitSSE(sourceRow, integralAndSquaredPreviousRow, integralAndSquaredRow, width, rowSum, rowSquaredSum);
+		return;
+	}
+
+#elif defined(OCEAN_HARDWARE_NEON_VERSION) && OCEAN_HARDWARE_NEON_VERSION >= 10 && defined(__aarch64__)
+
+	if constexpr (std::is_same<T, uint8_t>::value && std::is_same<TIntegralAndSquared, uint32_t>::value && tChannels == 1u)
+	{
+		uint32_t rowSum = 0u;
+		uint32_t rowSquaredSum = 0u;
+
+		createLinedAndSquaredRow1Channel8BitNEON(sourceRow, integralAndSquaredPreviousRow, integralAndSquaredRow, width, rowSum, rowSquaredSum);
+		return;
+	}
+
+#endif // OCEAN_HARDWARE_SSE_VERSION >= 41
+
+	TIntegralAndSquared previousIntegral[tChannels] = {TIntegralAndSquared(0)};
+	TIntegralAndSquared previousIntegralSquared[tChannels] = {TIntegralAndSquared(0)};
+
+	for (unsigned int x = 0u; x < width; ++x)
+	{
+		for (unsigned int n = 0u; n < tChannels; ++n)
+		{
+			previousIntegral[n] += sourceRow[n];
+			previousIntegralSquared[n] += sourceRow[n] * sourceRow[n];
+		}
+
+		for (unsigned int n = 0u; n < tChannels; ++n)
+		{
+			integralAndSquaredRow[n] = previousIntegral[n] + integralAndSquaredPreviousRow[n];
+		}
+
+		for (unsigned int n = 0u; n < tChannels; ++n)
+		{
+			integralAndSquaredRow[tChannels + n] = previousIntegralSquared[n] + integralAndSquaredPreviousRow[tChannels + n];
+		}
+
+		sourceRow += tChannels;
+		integralAndSquaredPreviousRow += tChannels * 2u;
+		integralAndSquaredRow += tChannels * 2u;
+	}
+}
+
+template <typename T, typename TIntegral, unsigned int tChannels>
+inline void IntegralImage::createBorderedImageMirrorRow(const T* sourceRow, const TIntegral* integralPreviousRow, TIntegral* integralRow, const unsigned int width, const unsigned int border)
+{
+	static_assert(tChannels >= 1u, "Invalid channel number!");
+
+	ocean_assert(sourceRow != nullptr && integralPreviousRow != nullptr && integralRow != nullptr);
+	ocean_assert(width >= 1u);
+	ocean_assert(border >= 1u && border <= width);
+
+	// left column
+	for (unsigned int n = 0u; n < tChannels; ++n)
+	{
+		integralRow[n] = TIntegral(0);
+	}
+
+	integralPreviousRow += tChannels;
+	integralRow += tChannels;
+
+	TIntegral previousIntegral[tChannels] = {TIntegral(0)};
+
+	// left border
+
+	for (unsigned int x = border - 1u; x != (unsigned int)(-1); --x)
+	{
+		for (unsigned int n = 0u; n < tChannels; ++n)
+		{
+			previousIntegral[n] += TIntegral(sourceRow[x * tChannels + n]);
+		}
+
+		for (unsigned int n = 0u; n < tChannels; ++n)
+		{
+			*integralRow++ = previousIntegral[n] + *integralPreviousRow++;
+		}
+	}
+
+	// center
+
+#if defined(OCEAN_HARDWARE_SSE_VERSION) && OCEAN_HARDWARE_SSE_VERSION >= 41
+
+	if constexpr (std::is_same<T, uint8_t>::value && std::is_same<TIntegral, uint32_t>::value && tChannels == 1u)
+	{
+		previousIntegral[0] = createLinedRow1Channel8BitSSE(sourceRow, integralPreviousRow, integralRow, width, previousIntegral[0]);
+
+		integralPreviousRow += width;
+		integralRow += width;
+	}
+	else
+
+#elif defined(OCEAN_HARDWARE_NEON_VERSION) && OCEAN_HARDWARE_NEON_VERSION >= 10 && defined(__aarch64__)
+
+	if constexpr (std::is_same<T, uint8_t>::value && std::is_same<TIntegral, uint32_t>::value && tChannels == 1u)
+	{
+		previousIntegral[0] = createLinedRow1Channel8BitNEON(sourceRow, integralPreviousRow, integralRow, width, previousIntegral[0]);
+
+		integralPreviousRow += width;
+		integralRow += width;
+	}
+	else
+
+#endif // OCEAN_HARDWARE_SSE_VERSION >= 41
+
+	{
+		for (unsigned int x = 0u; x < width; ++x)
+		{
+			for (unsigned int n = 0u; n < tChannels; ++n)
+			{
+				previousIntegral[n] += TIntegral(sourceRow[x * tChannels + n]);
+			}
+
+			for (unsigned int n = 0u; n < tChannels; ++n)
+			{
+				*integralRow++ = previousIntegral[n] + *integralPreviousRow++;
+			}
+		}
+	}
+
+	// right border
+
+	for (unsigned int x = 0u; x < border; ++x)
+	{
+		for (unsigned int n = 0u; n < tChannels; ++n)
+		{
+			previousIntegral[n] += TIntegral(sourceRow[(width - x - 1u) * tChannels + n]);
+		}
+
+		for (unsigned int n = 0u; n < tChannels; ++n)
+		{
+			*integralRow++ = previousIntegral[n] + *integralPreviousRow++;
+		}
+	}
+}
+
+template <typename T, typename TIntegral, unsigned int tChannels>
+void IntegralImage::createLinedImageRowsSubset(const T* source, TIntegral* integral, const unsigned int width, const unsigned int height, const unsigned int sourcePaddingElements, const unsigned int integralPaddingElements, const unsigned int firstRow, const unsigned int numberRows)
+{
+	ocean_assert(source != nullptr && integral != nullptr);
+	ocean_assert(width >= 1u && height >= 1u);
+	ocean_assert_and_suppress_unused(firstRow + numberRows <= height, height);
+
+	const unsigned int sourceStrideElements = width * tChannels + sourcePaddingElements;
+	const unsigned int integralStrideElements = (width + 1u) * tChannels + integralPaddingElements;
+
+	// the top row of the integral image contains zeros only, using this row as previous row provides the row-wise sums
+	const TIntegral* const integralZeroRow = integral;
+
+	for (unsigned int y = firstRow; y < firstRow + numberRows; ++y)
+	{
+		createLinedImageRow<T, TIntegral, tChannels>(source + y * sourceStrideElements, integralZeroRow, integral + (y + 1u) * integralStrideElements, width);
+	}
+}
+
+template <typename T, typename TIntegralAndSquared, unsigned int tChannels>
+void IntegralImage::createLinedImageAndSquaredRowsSubset(const T* source, TIntegralAndSquared* integralAndSquared, const unsigned int width, const unsigned int height, const unsigned int sourcePaddingElements, const unsigned int integralAndSquaredPaddingElements, const unsigned int firstRow, const unsigned int numberRows)
+{
+	ocean_assert(source != nullptr && integralAndSquared != nullptr);
+	ocean_assert(width >= 1u && height >= 1u);
+	ocean_assert_and_suppress_unused(firstRow + numberRows <= height, height);
+
+	const unsigned int sourceStrideElements = width * tChannels + sourcePaddingElements;
+	const unsigned int integralAndSquaredStrideElements = (width + 1u) * tChannels * 2u + integralAndSquaredPaddingElements;
+
+	// the top row of the integral image contains zeros only, using this row as previous row provides the row-wise sums
+	const TIntegralAndSquared* const integralAndSquaredZeroRow = integralAndSquared;
+
+	for (unsigned int y = firstRow; y < firstRow + numberRows; ++y)
+	{
+		createLinedImageAndSquaredRow<T, TIntegralAndSquared, tChannels>(source + y * sourceStrideElements, integralAndSquaredZeroRow, integralAndSquared + (y + 1u) * integralAndSquaredStrideElements, width);
+	}
+}
+
+template <typename T, typename TIntegral, typename TIntegralSquared, unsigned int tChannels>
+void IntegralImage::createLinedImageAndSquaredRowsSubset(const T* source, TIntegral* integral, TIntegralSquared* integralSquared, const unsigned int width, const unsigned int height, const unsigned int sourcePaddingElements, const unsigned int integralPaddingElements, const unsigned int integralSquaredPaddingElements, const unsigned int firstRow, const unsigned int numberRows)
+{
+	ocean_assert(source != nullptr && integral != nullptr && integralSquared != nullptr);
+	ocean_assert(width >= 1u && height >= 1u);
+	ocean_assert_and_suppress_unused(firstRow + numberRows <= height, height);
+
+	const unsigned int sourceStrideElements = width * tChannels + sourcePaddingElements;
+	const unsigned int integralStrideElements = (width + 1u) * tChannels + integralPaddingElements;
+	const unsigned int integralSquaredStrideElements = (width + 1u) * tChannels + integralSquaredPaddingElements;
+
+	for (unsigned int y = firstRow; y < firstRow + numberRows; ++y)
+	{
+		const T* sourceRow = source + y * sourceStrideElements;
+		TIntegral* integralRow = integral + (y + 1u) * integralStrideElements;
+		TIntegralSquared* integralSquaredRow = integralSquared + (y + 1u) * integralSquaredStrideElements;
+
+		// left pixel integral and squared integral
+		for (unsigned int n = 0u; n < tChannels; ++n)
+		{
+			*integralRow++ = TIntegral(0);
+			*integralSquaredRow++ = TIntegralSquared(0);
+		}
+
+		TIntegral previousIntegral[tChannels] = {TIntegral(0)};
+		TIntegralSquared previousIntegralSquared[tChannels] = {TIntegralSquared(0)};
+
+		for (unsigned int x = 0u; x < width; ++x)
+		{
+			for (unsigned int n = 0u; n < tChannels; ++n)
+			{
+				previousIntegral[n] += *sourceRow;
+				previousIntegralSquared[n] += *sourceRow * *sourceRow;
+				++sourceRow;
+			}
+
+			for (unsigned int n = 0u; n < tChannels; ++n)
+			{
+				*integralRow++ = previousIntegral[n];
+			}
+
+			for (unsigned int n = 0u; n < tChannels; ++n)
+			{
+				*integralSquaredRow++ = previousIntegralSquared[n];
+			}
+		}
+	}
+}
+
+template <typename T, typename TIntegral, unsigned int tChannels>
+void IntegralImage::createBorderedImageMirrorRowsSubset(const T* source, TIntegral* integral, const unsigned int width, const unsigned int height, const unsigned int border, const unsigned int sourcePaddingElements, const unsigned int integralPaddingElements, const unsigned int firstRow, const unsigned int numberRows)
+{
+	ocean_assert(source != nullptr && integral != nullptr);
+	ocean_assert(width >= 1u && height >= 1u);
+	ocean_assert(border >= 1u && border <= min(width, height));
+	ocean_assert(firstRow + numberRows <= height + border * 2u);
+
+	const unsigned int sourceStrideElements = width * tChannels + sourcePaddingElements;
+	const unsigned int integralStrideElements = (width + border * 2u + 1u) * tChannels + integralPaddingElements;
+
+	// the top row of the integral image contains zeros only, using this row as previous row provides the row-wise sums
+	const TIntegral* const integralZeroRow = integral;
+
+	for (unsigned int row = firstRow; row < firstRow + numberRows; ++row)
+	{
+		const int y = int(row) - int(border);
+
+		unsigned int sourceRow = (unsigned int)(y);
+
+		if (y < 0)
+		{
+			sourceRow = (unsigned int)(-y - 1);
+		}
+		else if (y >= int(height))
+		{
+			sourceRow = (unsigned int)(2 * int(height) - y - 1);
+		}
+
+		ocean_assert(sourceRow < height);
+
+		createBorderedImageMirrorRow<T, TIntegral, tChannels>(source + sourceRow * sourceStrideElements, integralZeroRow, integral + (row + 1u) * integralStrideElements, width, border);
+	}
+}
+
+template <typename TIntegral>
+void IntegralImage::accumulateRowsSubset(TIntegral* integral, const unsigned int integralStrideElements, const unsigned int rows, const unsigned int firstElement, const unsigned int numberElements)
+{
+	ocean_assert(integral != nullptr);
+	ocean_assert(rows >= 1u && numberElements >= 1u);
+	ocean_assert(firstElement + numberElements <= integralStrideElements);
+
+	integral += firstElement;
+
+	for (unsigned int y = 1u; y < rows; ++y)
+	{
+		const TIntegral* const integralPreviousRow = integral;
+		integral += integralStrideElements;
+
+		for (unsigned int n = 0u; n < numberElements; ++n)
+		{
+			integral[n] += integralPreviousRow[n];
+		}
+	}
+}
+
 template <typename T, typename TSquared>
 inline TSquared IntegralImage::sqr(const T& value)
 {
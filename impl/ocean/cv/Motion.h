@@ -9,6 +9,7 @@
 #define META_OCEAN_CV_MOTION_H
 
 #include "ocean/cv/CV.h"
+#include "ocean/cv/FrameEnlarger.h"
 #include "ocean/cv/FramePyramid.h"
 #include "ocean/cv/PixelPosition.h"
 #include "ocean/cv/SumAbsoluteDifferences.h"
@@ -155,12 +156,63 @@ class MotionT
 
 	protected:
 
+		/**
+		 * Determines the motion for one given point between two frames which have been extended by a mirrored border of tPatchSize/2 pixels.
+		 * Due to the border, all image patches are entirely located inside the extended frames so that all candidates can be handled by the batched metric function.<br>
+		 * The resulting positions and metric results are identical to pointMotionInFrameMirroredBorder() applied to the frames without border.
+		 * @param borderedFrame0 The first frame with mirrored border, must be valid
+		 * @param borderedFrame1 The second frame with mirrored border, must be valid
+		 * @param width0 Width of the first frame (without border) in pixel, with range [tPatchSize/2, infinity)
+		 * @param height0 Height of the first frame (without border) in pixel, with range [tPatchSize/2, infinity)
+		 * @param width1 Width of the second frame (without border) in pixel, with range [tPatchSize/2, infinity)
+		 * @param height1 Height of the second frame (without border) in pixel, with range [tPatchSize/2, infinity)
+		 * @param position0 The position in the first frame (without border), with range [0, width0 - 1]x[0, height0 - 1]
+		 * @param radiusX The search radius in horizontal direction, in pixel, with range [0, width1 - 1]
+		 * @param radiusY The search radius in vertical direction, in pixel, with range [0, height1 - 1]
+		 * @param borderedFrame0PaddingElements The number of padding elements at the end of each row of the first frame with border, in elements, with range [0, infinity)
+		 * @param borderedFrame1PaddingElements The number of padding elements at the end of each row of the second frame with border, in elements, with range [0, infinity)
+		 * @param rough1 The optional rough guess of the point in the second frame (without border), an invalid position if unknown
+		 * @param metricResult Optional resulting matching quality of the applied metric, nullptr if the result does not matter
+		 * @param metricIdentityResult Optional resulting matching quality of the applied metric between both frames at the identity location (the previous and rough position), nullptr if the result does not matter
+		 * @return Best matching position in the second frame (without border)
+		 * @tparam tChannels The number of frame channels, with range [1u, infinity)
+		 * @tparam tPatchSize The size of the square patch (the edge length) in pixel, with range [3, infinity), must be odd
+		 */
+		template <unsigned int tChannels, unsigned int tPatchSize>
+		static PixelPosition pointMotionInBorderedFrame(const uint8_t* const borderedFrame0, const uint8_t* const borderedFrame1, const unsigned int width0, const unsigned int height0, const unsigned int width1, const unsigned int height1, const PixelPosition& position0, const unsigned int radiusX, const unsigned int radiusY, const unsigned int borderedFrame0PaddingElements, const unsigned int borderedFrame1PaddingElements, const PixelPosition& rough1, uint32_t* const metricResult, uint32_t* const metricIdentityResult);
+
+		/**
+		 * Determines the motion for one given point between two frames which have been extended by a mirrored border of tPatchSize/2 pixels.
+		 * @param borderedFrame0 The first frame with mirrored border, must be valid
+		 * @param borderedFrame1 The second frame with mirrored border, must be valid
+		 * @param channels The number of frame channels, with range [1, 4]
+		 * @param width0 Width of the first frame (without border) in pixel, with range [tPatchSize/2, infinity)
+		 * @param height0 Height of the first frame (without border) in pixel, with range [tPatchSize/2, infinity)
+		 * @param width1 Width of the second frame (without border) in pixel, with range [tPatchSize/2, infinity)
+		 * @param height1 Height of the second frame (without border) in pixel, with range [tPatchSize/2, infinity)
+		 * @param position0 The position in the first frame (without border), with range [0, width0 - 1]x[0, height0 - 1]
+		 * @param radiusX The search radius in horizontal direction, in pixel, with range [0, width1 - 1]
+		 * @param radiusY The search radius in vertical direction, in pixel, with range [0, height1 - 1]
+		 * @param borderedFrame0PaddingElements The number of padding elements at the end of each row of the first frame with border, in elements, with range [0, infinity)
+		 * @param borderedFrame1PaddingElements The number of padding elements at the end of each row of the second frame with border, in elements, with range [0, infinity)
+		 * @param rough1 The optional rough guess of the point in the second frame (without border), an invalid position if unknown
+		 * @param metricResult Optional resulting matching quality of the applied metric, nullptr if the result does not matter
+		 * @param metricIdentityResult Optional resulting matching quality of the applied metric between both frames at the identity location (the previous and rough position), nullptr if the result does not matter
+		 * @return Best matching position in the second frame (without border)
+		 * @tparam tPatchSize The size of the square patch (the edge length) in pixel, with range [3, infinity), must be odd
+		 * @see pointMotionInBorderedFrame().
+		 */
+		template <unsigned int tPatchSize>
+		static inline PixelPosition pointMotionInBorderedFrame(const uint8_t* const borderedFrame0, const uint8_t* const borderedFrame1, const unsigned int channels, const unsigned int width0, const unsigned int height0, const unsigned int width1, const unsigned int height1, const PixelPosition& position0, const unsigned int radiusX, const unsigned int radiusY, const unsigned int borderedFrame0PaddingElements, const unsigned int borderedFrame1PaddingElements, const PixelPosition& rough1, uint32_t* const metricResult, uint32_t* const metricIdentityResult);
+
 		/**
 		 * Tracks a subset of given points between two frame pyramids.
 		 * The points are tracked unidirectional (from the previous frame to the current frame).<br>
 		 * If a point is near the frame border, a mirrored image patch is applied.<br>
 		 * @param previousPyramid Previous frame pyramid
 		 * @param currentPyramid Current frame pyramid, with same frame type as the previous frame
+		 * @param previousBorderedLayers The layers of the previous frame pyramid, each extended by a mirrored border of tPatchSize/2 pixels, at least numberLayers layers, must be valid
+		 * @param currentBorderedLayers The layers of the current frame pyramid, each extended by a mirrored border of tPatchSize/2 pixels, at least numberLayers layers, must be valid
 		 * @param numberLayers The number of pyramid layers that will be used for tracking, with range [1, min(pyramids->layers(), coarsest layer that match with the patch size)]
 		 * @param previousPoints A set of points that are located in the previous frame
 		 * @param roughPoints The rough points in the current frame (if known), otherwise the prevousPoints may be provided
@@ -174,7 +226,7 @@ class MotionT
 		 * @tparam tPatchSize The size of the square patch (the edge length) in pixel, with range [3, infinity), must be odd, recommended is 5, 7, 15, 31, or 63
 		 */
 		template <unsigned int tPatchSize>
-		static void trackPointsInPyramidMirroredBorderSubset(const FramePyramid* previousPyramid, const FramePyramid* currentPyramid, const unsigned int numberLayers, const PixelPositions* previousPoints, const PixelPositions* roughPoints, PixelPositions* currentPoints, const unsigned int coarsestLayerRadiusX, const unsigned int coarsestLayerRadiusY, uint32_t* metricResults, uint32_t* metricIdentityResults, const unsigned int firstPoint, const unsigned int numberPoints);
+		static void trackPointsInPyramidMirroredBorderSubset(const FramePyramid* previousPyramid, const FramePyramid* currentPyramid, const Frame* previousBorderedLayers, const Frame* currentBorderedLayers, const unsigned int numberLayers, const PixelPositions* previousPoints, const PixelPositions* roughPoints, PixelPositions* currentPoints, const unsigned int coarsestLayerRadiusX, const unsigned int coarsestLayerRadiusY, uint32_t* metricResults, uint32_t* metricIdentityResults, const unsigned int firstPoint, const unsigned int numberPoints);
 };
 
 template <typename TMetric>
@@ -234,13 +286,29 @@ bool MotionT<TMetric>::trackPointsInPyramidMirroredBorder(const FramePyramid& pr
 		metricIdentityResults->resize(previousPoints.size());
 	}
 
+	// each layer is extended by a mirrored border once, so that the patches of all points and all candidates are entirely located inside the extended layers
+
+	constexpr unsigned int borderSize = tPatchSize / 2u;
+
+	Frames previousBorderedLayers(numberLayers);
+	Frames currentBorderedLayers(numberLayers);
+
+	for (unsigned int layerIndex = 0u; layerIndex < numberLayers; ++layerIndex)
+	{
+		if (!FrameEnlarger::Comfort::addBorderMirrored(previousPyramid[layerIndex], previousBorderedLayers[layerIndex], borderSize, borderSize, borderSize, borderSize)
+				|| !FrameEnlarger::Comfort::addBorderMirrored(currentPyramid[layerIndex], currentBorderedLayers[layerIndex], borderSize, borderSize, borderSize, borderSize))
+		{
+			return false;
+		}
+	}
+
 	if (worker != nullptr)
 	{
-		worker->executeFunction(Worker::Function::createStatic(&MotionT::trackPointsInPyramidMirroredBorderSubset<tPatchSize>, &previousPyramid, &currentPyramid, numberLayers, &previousPoints, &roughPoints, &currentPoints, coarsestLayerRadiusX, coarsestLayerRadiusY, metricResults ? metricResults->data() : nullptr, metricIdentityResults ? metricIdentityResults->data() : nullptr, 0u, 0u), 0u, (unsigned int)(previousPoints.size()));
+		worker->executeFunction(Worker::Function::createStatic(&MotionT::trackPointsInPyramidMirroredBorderSubset<tPatchSize>, &previousPyramid, &currentPyramid, (const Frame*)(previousBorderedLayers.data()), (const Frame*)(currentBorderedLayers.data()), numberLayers, &previousPoints, &roughPoints, &currentPoints, coarsestLayerRadiusX, coarsestLayerRadiusY, metricResults ? metricResults->data() : nullptr, metricIdentityResults ? metricIdentityResults->data() : nullptr, 0u, 0u), 0u, (unsigned int)(previousPoints.size()));
 	}
 	else
 	{
-		trackPointsInPyramidMirroredBorderSubset<tPatchSize>(&previousPyramid, &currentPyramid, numberLayers, &previousPoints, &roughPoints, &currentPoints, coarsestLayerRadiusX, coarsestLayerRadiusY, metricResults ? metricResults->data() : nullptr, metricIdentityResults ? metricIdentityResults->data() : nullptr, 0u, (unsigned int)(previousPoints.size()));
+		trackPointsInPyramidMirroredBorderSubset<tPatchSize>(&previousPyramid, &currentPyramid, previousBorderedLayers.data(), currentBorderedLayers.data(), numberLayers, &previousPoints, &roughPoints, &currentPoints, coarsestLayerRadiusX, coarsestLayerRadiusY, metricResults ? metricResults->data() : nullptr, metricIdentityResults ? metricIdentityResults->data() : nullptr, 0u, (unsigned int)(previousPoints.size()));
 	}
 
 	return true;
@@ -375,14 +443,135 @@ inline PixelPosition MotionT<TMetric>::pointMotionInFrameMirroredBorder(const ui
 	return rough1;
 }
 
+template <typename TMetric>
+template <unsigned int tChannels, unsigned int tPatchSize>
+PixelPosition MotionT<TMetric>::pointMotionInBorderedFrame(const uint8_t* const borderedFrame0, const uint8_t* const borderedFrame1, const unsigned int width0, const unsigned int height0, const unsigned int width1, const unsigned int height1, const PixelPosition& position0, const unsigned int radiusX, const unsigned int radiusY, const unsigned int borderedFrame0PaddingElements, const unsigned int borderedFrame1PaddingElements, const PixelPosition& rough1, uint32_t* const metricResult, uint32_t* const metricIdentityResult)
+{
+	static_assert(tChannels != 0u, "Invalid number of data channels!");
+	static_assert(tPatchSize % 2u == 1u, "Invalid size of the image patch, must be odd!");
+
+	constexpr unsigned int tPatchSize_2 = tPatchSize / 2u;
+
+	ocean_assert(borderedFrame0 != nullptr && borderedFrame1 != nullptr);
+	ocean_assert(radiusX != 0u || radiusY != 0u);
+
+	ocean_assert(width0 >= tPatchSize_2 && height0 >= tPatchSize_2);
+	ocean_assert(width1 >= tPatchSize_2 && height1 >= tPatchSize_2);
+
+	ocean_assert(position0.x() < width0);
+	ocean_assert_and_suppress_unused(position0.y() < height0, height0);
+
+	const PixelPosition position1((rough1 && rough1.x() < width1 && rough1.y() < height1) ? rough1 : position0);
+	ocean_assert(position1.x() < width1);
+	ocean_assert(position1.y() < height1);
+
+	const unsigned int leftCenter1 = (unsigned int)(max(0, int(position1.x() - radiusX)));
+	const unsigned int topCenter1 = (unsigned int)(max(0, int(position1.y() - radiusY)));
+
+	const unsigned int rightCenter1 = min(position1.x() + radiusX, width1 - 1u);
+	const unsigned int bottomCenter1 = min(position1.y() + radiusY, height1 - 1u);
+
+	ocean_assert(leftCenter1 < width1 && leftCenter1 <= rightCenter1 && rightCenter1 < width1);
+	ocean_assert(topCenter1 < height1 && topCenter1 <= bottomCenter1 && bottomCenter1 < height1);
+
+	// all positions within the bordered frames are shifted by the border size
+
+	const unsigned int borderedWidth0 = width0 + tPatchSize_2 * 2u;
+	const unsigned int borderedWidth1 = width1 + tPatchSize_2 * 2u;
+
+	// the candidates are evaluated row-wise in batches, so that the reference patch is handled once for several candidates
+
+	constexpr unsigned int maximalBatchSize = 16u;
+
+	PixelPosition borderedCenters1[maximalBatchSize];
+	uint32_t metrics[maximalBatchSize];
+
+	PixelPosition bestPosition;
+	uint32_t bestMetric = uint32_t(-1);
+	uint32_t bestSqrDistance = uint32_t(-1);
+
+	for (unsigned int y1 = topCenter1; y1 <= bottomCenter1; ++y1)
+	{
+		for (unsigned int batchLeft1 = leftCenter1; batchLeft1 <= rightCenter1; batchLeft1 += maximalBatchSize)
+		{
+			const unsigned int batchSize = min(rightCenter1 - batchLeft1 + 1u, maximalBatchSize);
+
+			for (unsigned int n = 0u; n < batchSize; ++n)
+			{
+				borderedCenters1[n] = PixelPosition(batchLeft1 + n + tPatchSize_2, y1 + tPatchSize_2);
+			}
+
+			TMetric::template patchCandidates8BitPerChannel<tChannels, tPatchSize>(borderedFrame0, borderedFrame1, borderedWidth0, borderedWidth1, position0.x() + tPatchSize_2, position0.y() + tPatchSize_2, borderedCenters1, batchSize, borderedFrame0PaddingElements, borderedFrame1PaddingElements, metrics);
+
+			for (unsigned int n = 0u; n < batchSize; ++n)
+			{
+				const uint32_t metric = metrics[n];
+
+				const PixelPosition position(batchLeft1 + n, y1);
+
+				if (metric < bestMetric || (metric == bestMetric && position1.sqrDistance(position) < bestSqrDistance))
+				{
+					bestMetric = metric;
+					bestPosition = position;
+
+					bestSqrDistance = position1.sqrDistance(position);
+				}
+
+				if (metricIdentityResult && position == position1)
+				{
+					*metricIdentityResult = metric;
+				}
+			}
+		}
+	}
+
+	ocean_assert(bestMetric != uint32_t(-1) && bestPosition.isValid());
+
+	if (metricResult)
+	{
+		*metricResult = bestMetric;
+	}
+
+	ocean_assert(abs(int(bestPosition.x()) - int(position1.x())) <= int(radiusX));
+	ocean_assert(abs(int(bestPosition.y()) - int(position1.y())) <= int(radiusY));
+
+	return bestPosition;
+}
+
 template <typename TMetric>
 template <unsigned int tPatchSize>
-void MotionT<TMetric>::trackPointsInPyramidMirroredBorderSubset(const FramePyramid* previousPyramid, const FramePyramid* currentPyramid, const unsigned int numberLayers, const PixelPositions* previousPoints, const PixelPositions* roughPoints, PixelPositions* currentPoints, const unsigned int coarsestLayerRadiusX, const unsigned int coarsestLayerRadiusY, uint32_t* metricResults, uint32_t* metricIdentityResults, const unsigned int firstPoint, const unsigned int numberPoints)
+inline PixelPosition MotionT<TMetric>::pointMotionInBorderedFrame(const uint8_t* const borderedFrame0, const uint8_t* const borderedFrame1, const unsigned int channels, const unsigned int width0, const unsigned int height0, const unsigned int width1, const unsigned int height1, const PixelPosition& position0, const unsigned int radiusX, const unsigned int radiusY, const unsigned int borderedFrame0PaddingElements, const unsigned int borderedFrame1PaddingElements, const PixelPosition& rough1, uint32_t* const metricResult, uint32_t* const metricIdentityResult)
+{
+	ocean_assert(channels >= 1u);
+
+	switch (channels)
+	{
+		case 1u:
+			return pointMotionInBorderedFrame<1u, tPatchSize>(borderedFrame0, borderedFrame1, width0, height0, width1, height1, position0, radiusX, radiusY, borderedFrame0PaddingElements, borderedFrame1PaddingElements, rough1, metricResult, metricIdentityResult);
+
+		case 2u:
+			return pointMotionInBorderedFrame<2u, tPatchSize>(borderedFrame0, borderedFrame1, width0, height0, width1, height1, position0, radiusX, radiusY, borderedFrame0PaddingElements, borderedFrame1PaddingElements, rough1, metricResult, metricIdentityResult);
+
+		case 3u:
+			return pointMotionInBorderedFrame<3u, tPatchSize>(borderedFrame0, borderedFrame1, width0, height0, width1, height1, position0, radiusX, radiusY, borderedFrame0PaddingElements, borderedFrame1PaddingElements, rough1, metricResult, metricIdentityResult);
+
+		case 4u:
+			return pointMotionInBorderedFrame<4u, tPatchSize>(borderedFrame0, borderedFrame1, width0, height0, width1, height1, position0, radiusX, radiusY, borderedFrame0PaddingElements, borderedFrame1PaddingElements, rough1, metricResult, metricIdentityResult);
+	}
+
+	ocean_assert(false && "Invalid pixel format!");
+	return rough1;
+}
+
+template <typename TMetric>
+template <unsigned int tPatchSize>
+void MotionT<TMetric>::trackPointsInPyramidMirroredBorderSubset(const FramePyramid* previousPyramid, const FramePyramid* currentPyramid, const Frame* previousBorderedLayers, const Frame* currentBorderedLayers, const unsigned int numberLayers, const PixelPositions* previousPoints, const PixelPositions* roughPoints, PixelPositions* currentPoints, const unsigned int coarsestLayerRadiusX, const unsigned int coarsestLayerRadiusY, uint32_t* metricResults, uint32_t* metricIdentityResults, const unsigned int firstPoint, const unsigned int numberPoints)
 {
 	static_assert(tPatchSize % 2u == 1u, "Invalid image patch size!");
 	static_assert(tPatchSize >= 3u, "Invalid image patch size!");
 
 	ocean_assert(previousPyramid && currentPyramid);
+	ocean_assert(previousBorderedLayers != nullptr && currentBorderedLayers != nullptr);
 	ocean_assert(previousPoints && roughPoints && currentPoints);
 
 	ocean_assert(*previousPyramid && *currentPyramid);
@@ -434,6 +623,12 @@ void MotionT<TMetric>::trackPointsInPyramidMirroredBorderSubset(const FramePyram
 		const Frame& previousFrame = (*previousPyramid)[layerIndex];
 		const Frame& currentFrame = (*currentPyramid)[layerIndex];
 
+		const Frame& previousBorderedFrame = previousBorderedLayers[layerIndex];
+		const Frame& currentBorderedFrame = currentBorderedLayers[layerIndex];
+
+		ocean_assert(previousBorderedFrame.width() == previousFrame.width() + (tPatchSize / 2u) * 2u && previousBorderedFrame.height() == previousFrame.height() + (tPatchSize / 2u) * 2u);
+		ocean_assert(currentBorderedFrame.width() == currentFrame.width() + (tPatchSize / 2u) * 2u && currentBorderedFrame.height() == currentFrame.height() + (tPatchSize / 2u) * 2u);
+
 		const unsigned int previousWidth = previousFrame.width();
 		const unsigned int previousHeight = previousFrame.height();
 
@@ -456,7 +651,7 @@ void MotionT<TMetric>::trackPointsInPyramidMirroredBorderSubset(const FramePyram
 
 			if (previousPosition.x() < previousWidth && previousPosition.y() < previousHeight)
 			{
-				const PixelPosition position(pointMotionInFrameMirroredBorder<tPatchSize>(previousFrame.constdata<uint8_t>(), currentFrame.constdata<uint8_t>(), channels, previousWidth, previousHeight, currentWidth, currentHeight, previousPosition, layerRadiusX, layerRadiusY, previousFrame.paddingElements(), currentFrame.paddingElements(), intermediateRoughPoint, metricResult, metricIdentityResult));
+				const PixelPosition position(pointMotionInBorderedFrame<tPatchSize>(previousBorderedFrame.constdata<uint8_t>(), currentBorderedFrame.constdata<uint8_t>(), channels, previousWidth, previousHeight, currentWidth, currentHeight, previousPosition, layerRadiusX, layerRadiusY, previousBorderedFrame.paddingElements(), currentBorderedFrame.paddingElements(), intermediateRoughPoint, metricResult, metricIdentityResult));
 
 				ocean_assert(position.x() < currentWidth && position.y() < currentHeight);
 
@@ -10,6 +10,8 @@
 
 #include "ocean/cv/CV.h"
 #include "ocean/cv/FrameInterpolatorBilinear.h"
+#include "ocean/cv/NEON.h"
+#include "ocean/cv/SSE.h"
 
 #include "ocean/base/ShiftVector.h"
 #include "ocean/base/Worker.h"
@@ -352,6 +354,50 @@ class NonMaximumSuppressionT : public NonMaximumSuppression
 		template <typename TCoordinate, typename TStrength, bool tStrictMaximum>
 		static StrengthPositions<TCoordinate, TStrength> suppressNonMaximum(const unsigned int width, const unsigned int height, const StrengthPositions<TCoordinate, TStrength>& strengthPositions, const TCoordinate radius, Indices32* validIndices = nullptr);
 
+		/**
+		 * Applies a non-maximum-suppression search directly on a given 2D response frame in a 3x3 neighborhood (eight neighbors).
+		 * Each value with value >= minimalThreshold is a candidate, the resulting positions are identical to adding all values via addCandidates() and applying suppressNonMaximum() to the entire frame.<br>
+		 * In contrast to the candidate-based suppression, no candidate rows are stored and no lock is necessary: the frame is separated into horizontal strips, each strip gathers its maxima in an own buffer.<br>
+		 * The resulting positions are sorted row by row, independently of whether a worker is used.
+		 * @param values The response values, must be valid
+		 * @param width The width of the response frame, in pixel, with range [3, infinity)
+		 * @param height The height of the response frame, in pixel, with range [3, infinity)
+		 * @param valuesPaddingElements The number of padding elements at the end of each response row, in elements, with range [0, infinity)
+		 * @param minimalThreshold The minimal threshold so that a value counts as candidate
+		 * @param strengthPositions The resulting non maximum suppressed positions including the strength parameters, will be appended
+		 * @param worker Optional worker object to distribute the computation
+		 * @tparam TCoordinate The data type of a scalar coordinate
+		 * @tparam TStrength The data type of the strength parameter
+		 * @tparam tStrictMaximum True, to search for a strict maximum (larger than all eight neighbors); False, to allow equal values in the upper left neighborhood
+		 * @see suppressNonMaximumInFrameStrongestPerBin().
+		 */
+		template <typename TCoordinate, typename TStrength, bool tStrictMaximum = true>
+		static void suppressNonMaximumInFrame(const T* values, const unsigned int width, const unsigned int height, const unsigned int valuesPaddingElements, const T& minimalThreshold, StrengthPositions<TCoordinate, TStrength>& strengthPositions, Worker* worker = nullptr);
+
+		/**
+		 * Applies a non-maximum-suppression search directly on a given 2D response frame in a 3x3 neighborhood and keeps only the strongest maxima in each bin of a regular grid.
+		 * The maxima are distributed into the bins while they are found, so the set of all maxima is never stored.<br>
+		 * The horizontal bin of a position is x * horizontalBins / width, the vertical bin is y * verticalBins / height.<br>
+		 * Within a bin, maxima are ordered by decreasing strength, equal strength values are ordered row by row.<br>
+		 * The resulting positions are grouped by bins in row-major order.
+		 * @param values The response values, must be valid
+		 * @param width The width of the response frame, in pixel, with range [3, infinity)
+		 * @param height The height of the response frame, in pixel, with range [3, infinity)
+		 * @param valuesPaddingElements The number of padding elements at the end of each response row, in elements, with range [0, infinity)
+		 * @param minimalThreshold The minimal threshold so that a value counts as candidate
+		 * @param horizontalBins The number of horizontal bins, with range [1, width]
+		 * @param verticalBins The number of vertical bins, with range [1, height]
+		 * @param maximalPositionsPerBin The maximal number of positions in each bin, with range [1, infinity)
+		 * @param strengthPositions The resulting non maximum suppressed positions including the strength parameters, will be appended
+		 * @param worker Optional worker object to distribute the computation
+		 * @tparam TCoordinate The data type of a scalar coordinate
+		 * @tparam TStrength The data type of the strength parameter
+		 * @tparam tStrictMaximum True, to search for a strict maximum (larger than all eight neighbors); False, to allow equal values in the upper left neighborhood
+		 * @see suppressNonMaximumInFrame().
+		 */
+		template <typename TCoordinate, typename TStrength, bool tStrictMaximum = true>
+		static void suppressNonMaximumInFrameStrongestPerBin(const T* values, const unsigned int width, const unsigned int height, const unsigned int valuesPaddingElements, const T& minimalThreshold, const unsigned int horizontalBins, const unsigned int verticalBins, const unsigned int maximalPositionsPerBin, StrengthPositions<TCoordinate, TStrength>& strengthPositions, Worker* worker = nullptr);
+
 		/**
 		 * Determines the precise peak location in 1D space for three discrete neighboring measurements at location x == 0.
 		 * The precise peak is determined based on the first and second derivatives of the measurement values.
@@ -470,6 +516,82 @@ class NonMaximumSuppressionT : public NonMaximumSuppression
 		template <typename TCoordinate, typename TStrength, bool tStrictMaximum, bool tOnlyNegative = false>
 		void suppressNonMinimumSubset(StrengthPositions<TCoordinate, TStrength>* strengthPositions, const unsigned int firstColumn, const unsigned int numberColumns, Lock* lock, const PositionCallback<TCoordinate, TStrength>* positionCallback, const unsigned int firstRow, const unsigned int numberRows) const;
 
+		/**
+		 * Applies a non-maximum-suppression search on a subset of horizontal strips of a given 2D response frame.
+		 * @param values The response values, must be valid
+		 * @param width The width of the response frame, in pixel, with range [3, infinity)
+		 * @param height The height of the response frame, in pixel, with range [3, infinity)
+		 * @param valuesStrideElements The number of elements between two response rows, in elements, with range [width, infinity)
+		 * @param minimalThreshold The minimal threshold so that a value counts as candidate
+		 * @param stripHeight The number of rows in each strip, with range [1, infinity)
+		 * @param stripStrengthPositions The resulting non maximum suppressed positions, one buffer for each strip, must be valid
+		 * @param firstStrip The first strip to be handled, with range [0, infinity)
+		 * @param numberStrips The number of strips to be handled, with range [1, infinity)
+		 * @tparam TCoordinate The data type of a scalar coordinate
+		 * @tparam TStrength The data type of the strength parameter
+		 * @tparam tStrictMaximum True, to search for a strict maximum; False, to allow equal values in the upper left neighborhood
+		 */
+		template <typename TCoordinate, typename TStrength, bool tStrictMaximum>
+		static void suppressNonMaximumInFrameSubset(const T* values, const unsigned int width, const unsigned int height, const unsigned int valuesStrideElements, const T* minimalThreshold, const unsigned int stripHeight, StrengthPositions<TCoordinate, TStrength>* stripStrengthPositions, const unsigned int firstStrip, const unsigned int numberStrips);
+
+		/**
+		 * Applies a non-maximum-suppression search on a subset of bin rows of a given 2D response frame and keeps the strongest maxima in each bin.
+		 * @param values The response values, must be valid
+		 * @param width The width of the response frame, in pixel, with range [3, infinity)
+		 * @param height The height of the response frame, in pixel, with range [3, infinity)
+		 * @param valuesStrideElements The number of elements between two response rows, in elements, with range [width, infinity)
+		 * @param minimalThreshold The minimal threshold so that a value counts as candidate
+		 * @param horizontalBins The number of horizontal bins, with range [1, width]
+		 * @param verticalBins The number of vertical bins, with range [1, height]
+		 * @param maximalPositionsPerBin The maximal number of positions in each bin, with range [1, infinity)
+		 * @param binStrengthPositions The resulting strongest positions, one buffer for each bin, must be valid
+		 * @param firstBinRow The first bin row to be handled, with range [0, verticalBins - 1]
+		 * @param numberBinRows The number of bin rows to be handled, with range [1, verticalBins - firstBinRow]
+		 * @tparam TCoordinate The data type of a scalar coordinate
+		 * @tparam TStrength The data type of the strength parameter
+		 * @tparam tStrictMaximum True, to search for a strict maximum; False, to allow equal values in the upper left neighborhood
+		 */
+		template <typename TCoordinate, typename TStrength, bool tStrictMaximum>
+		static void suppressNonMaximumInFrameStrongestPerBinSubset(const T* values, const unsigned int width, const unsigned int height, const unsigned int valuesStrideElements, const T* minimalThreshold, const unsigned int horizontalBins, const unsigned int verticalBins, const unsigned int maximalPositionsPerBin, StrengthPositions<TCoordinate, TStrength>* binStrengthPositions, const unsigned int firstBinRow, const unsigned int numberBinRows);
+
+		/**
+		 * Determines the local maxima within one row of a response frame in a 3x3 neighborhood.
+		 * The first and the last column of the row are not investigated.
+		 * @param valuesTop The response values of the row above, must be valid
+		 * @param valuesCenter The response values of the row to be investigated, must be valid
+		 * @param valuesBottom The response values of the row below, must be valid
+		 * @param width The width of the rows, in elements, with range [3, infinity)
+		 * @param minimalThreshold The minimal threshold so that a value counts as candidate
+		 * @param maximumColumns The resulting columns of all local maxima, in ascending order, will be appended
+		 * @tparam tStrictMaximum True, to search for a strict maximum; False, to allow equal values in the upper left neighborhood
+		 */
+		template <bool tStrictMaximum>
+		static void determineLocalMaximaInRow(const T* valuesTop, const T* valuesCenter, const T* valuesBottom, const unsigned int width, const T minimalThreshold, Indices32& maximumColumns);
+
+		/**
+		 * Returns whether a value is a local maximum within a 3x3 neighborhood.
+		 * @param valuesTop The response values of the row above, centered at the value's column, must be valid
+		 * @param valuesCenter The response values of the row, centered at the value's column, must be valid
+		 * @param valuesBottom The response values of the row below, centered at the value's column, must be valid
+		 * @param minimalThreshold The minimal threshold so that a value counts as candidate
+		 * @return True, if so
+		 * @tparam tStrictMaximum True, to search for a strict maximum; False, to allow equal values in the upper left neighborhood
+		 */
+		template <bool tStrictMaximum>
+		static OCEAN_FORCE_INLINE bool isLocalMaximum(const T* valuesTop, const T* valuesCenter, const T* valuesBottom, const T minimalThreshold);
+
+		/**
+		 * Returns whether a first strength position is stronger than a second strength position.
+		 * Positions with equal strength are ordered row by row so that the order is strict.
+		 * @param first The first strength position
+		 * @param second The second strength position
+		 * @return True, if the first position is stronger
+		 * @tparam TCoordinate The data type of a scalar coordinate
+		 * @tparam TStrength The data type of the strength parameter
+		 */
+		template <typename TCoordinate, typename TStrength>
+		static inline bool isStronger(const StrengthPosition<TCoordinate, TStrength>& first, const StrengthPosition<TCoordinate, TStrength>& second);
+
 	private:
 
 		/// Width of this object.
@@ -1295,6 +1417,97 @@ NonMaximumSuppression::RefinementStatus NonMaximumSuppressionT<T>::determinePrec
 	return NonMaximumSuppression::RS_MAX_ITERATIONS;
 }
 
+template <typename T>
+template <typename TCoordinate, typename TStrength, bool tStrictMaximum>
+void NonMaximumSuppressionT<T>::suppressNonMaximumInFrame(const T* values, const unsigned int width, const unsigned int height, const unsigned int valuesPaddingElements, const T& minimalThreshold, StrengthPositions<TCoordinate, TStrength>& strengthPositions, Worker* worker)
+{
+	ocean_assert(values != nullptr);
+	ocean_assert(width >= 3u && height >= 3u);
+
+	if (width < 3u || height < 3u)
+	{
+		return;
+	}
+
+	const unsigned int valuesStrideElements = width + valuesPaddingElements;
+
+	// each strip gathers its maxima in an own buffer, so that the strips can be handled in parallel without any lock
+
+	constexpr unsigned int stripHeight = 32u;
+
+	const unsigned int numberStrips = (height - 2u + stripHeight - 1u) / stripHeight;
+
+	std::vector<StrengthPositions<TCoordinate, TStrength>> stripStrengthPositions(numberStrips);
+
+	if (worker != nullptr && numberStrips > 1u)
+	{
+		worker->executeFunction(Worker::Function::createStatic(&NonMaximumSuppressionT<T>::suppressNonMaximumInFrameSubset<TCoordinate, TStrength, tStrictMaximum>, values, width, height, valuesStrideElements, &minimalThreshold, stripHeight, stripStrengthPositions.data(), 0u, 0u), 0u, numberStrips, 7u, 8u, 1u);
+	}
+	else
+	{
+		suppressNonMaximumInFrameSubset<TCoordinate, TStrength, tStrictMaximum>(values, width, height, valuesStrideElements, &minimalThreshold, stripHeight, stripStrengthPositions.data(), 0u, numberStrips);
+	}
+
+	size_t numberPositions = 0;
+
+	for (const StrengthPositions<TCoordinate, TStrength>& stripPositions : stripStrengthPositions)
+	{
+		numberPositions += stripPositions.size();
+	}
+
+	strengthPositions.reserve(strengthPositions.size() + numberPositions);
+
+	for (const StrengthPositions<TCoordinate, TStrength>& stripPositions : stripStrengthPositions)
+	{
+		strengthPositions.insert(strengthPositions.end(), stripPositions.begin(), stripPositions.end());
+	}
+}
+
+template <typename T>
+template <typename TCoordinate, typename TStrength, bool tStrictMaximum>
+void NonMaximumSuppressionT<T>::suppressNonMaximumInFrameStrongestPerBin(const T* values, const unsigned int width, const unsigned int height, const unsigned int valuesPaddingElements, const T& minimalThreshold, const unsigned int horizontalBins, const unsigned int verticalBins, const unsigned int maximalPositionsPerBin, StrengthPositions<TCoordinate, TStrength>& strengthPositions, Worker* worker)
+{
+	ocean_assert(values != nullptr);
+	ocean_assert(width >= 3u && height >= 3u);
+	ocean_assert(horizontalBins >= 1u && horizontalBins <= width);
+	ocean_assert(verticalBins >= 1u && verticalBins <= height);
+	ocean_assert(maximalPositionsPerBin >= 1u);
+
+	if (width < 3u || height < 3u || horizontalBins == 0u || horizontalBins > width || verticalBins == 0u || verticalBins > height || maximalPositionsPerBin == 0u)
+	{
+		return;
+	}
+
+	const unsigned int valuesStrideElements = width + valuesPaddingElements;
+
+	// each bin is handled by exactly one thread (all bins of one bin row are handled together), so that no lock is necessary
+
+	std::vector<StrengthPositions<TCoordinate, TStrength>> binStrengthPositions(horizontalBins * verticalBins);
+
+	if (worker != nullptr && verticalBins > 1u)
+	{
+		worker->executeFunction(Worker::Function::createStatic(&NonMaximumSuppressionT<T>::suppressNonMaximumInFrameStrongestPerBinSubset<TCoordinate, TStrength, tStrictMaximum>, values, width, height, valuesStrideElements, &minimalThreshold, horizontalBins, verticalBins, maximalPositionsPerBin, binStrengthPositions.data(), 0u, 0u), 0u, verticalBins, 9u, 10u, 1u);
+	}
+	else
+	{
+		suppressNonMaximumInFrameStrongestPerBinSubset<TCoordinate, TStrength, tStrictMaximum>(values, width, height, valuesStrideElements, &minimalThreshold, horizontalBins, verticalBins, maximalPositionsPerBin, binStrengthPositions.data(), 0u, verticalBins);
+	}
+
+	size_t numberPositions = 0;
+
+	for (const StrengthPositions<TCoordinate, TStrength>& binPositions : binStrengthPositions)
+	{
+		numberPositions += binPositions.size();
+	}
+
+	strengthPositions.reserve(strengthPositions.size() + numberPositions);
+
+	for (const StrengthPositions<TCoordinate, TStrength>& binPositions : binStrengthPositions)
+	{
+		strengthPositions.insert(strengthPositions.end(), binPositions.begin(), binPositions.end());
+	}
+}
+
 template <typename T>
 void NonMaximumSuppressionT<T>::addCandidatesSubset(const T* values, const unsigned int valuesStrideElements, const unsigned int firstColumn, const unsigned int numberColumns, const T* minimalThreshold, const unsigned int firstRow, const unsigned int numberRows)
 {
@@ -1739,6 +1952,357 @@ nextMinimum:
 	strengthPositions->insert(strengthPositions->end(), localStrengthPositions.begin(), localStrengthPositions.end());
 }
 
+
+template <typename T>
+template <typename TCoordinate, typename TStrength, bool tStrictMaximum>
+void NonMaximumSuppressionT<T>::suppressNonMaximumInFrameSubset(const T* values, const unsigned int width, const unsigned int height, const unsigned int valuesStrideElements, const T* minimalThreshold, const unsigned int stripHeight, StrengthPositions<TCoordinate, TStrength>* stripStrengthPositions, const unsigned int firstStrip, const unsigned int numberStrips)
+{
+	ocean_assert(values != nullptr && minimalThreshold != nullptr && stripStrengthPositions != nullptr);
+	ocean_assert(width >= 3u && height >= 3u);
+	ocean_assert(valuesStrideElements >= width);
+	ocean_assert(stripHeight >= 1u);
+
+	const T localThreshold = *minimalThreshold;
+
+	Indices32 maximumColumns;
+	maximumColumns.reserve(128);
+
+	for (unsigned int nStrip = firstStrip; nStrip < firstStrip + numberStrips; ++nStrip)
+	{
+		StrengthPositions<TCoordinate, TStrength>& stripPositions = stripStrengthPositions[nStrip];
+
+		// the first and the last row of the frame are never a center row
+
+		const unsigned int firstCenterRow = 1u + nStrip * stripHeight;
+		const unsigned int endCenterRow = std::min(firstCenterRow + stripHeight, height - 1u);
+
+		ocean_assert(firstCenterRow < endCenterRow);
+
+		for (unsigned int y = firstCenterRow; y < endCenterRow; ++y)
+		{
+			const T* const valuesCenter = values + y * valuesStrideElements;
+
+			maximumColumns.clear();
+			determineLocalMaximaInRow<tStrictMaximum>(valuesCenter - valuesStrideElements, valuesCenter, valuesCenter + valuesStrideElements, width, localThreshold, maximumColumns);
+
+			for (const Index32& x : maximumColumns)
+			{
+				stripPositions.emplace_back(TCoordinate(x), TCoordinate(y), TStrength(valuesCenter[x]));
+			}
+		}
+	}
+}
+
+template <typename T>
+template <typename TCoordinate, typename TStrength, bool tStrictMaximum>
+void NonMaximumSuppressionT<T>::suppressNonMaximumInFrameStrongestPerBinSubset(const T* values, const unsigned int width, const unsigned int height, const unsigned int valuesStrideElements, const T* minimalThreshold, const unsigned int horizontalBins, const unsigned int verticalBins, const unsigned int maximalPositionsPerBin, StrengthPositions<TCoordinate, TStrength>* binStrengthPositions, const unsigned int firstBinRow, const unsigned int numberBinRows)
+{
+	ocean_assert(values != nullptr && minimalThreshold != nullptr && binStrengthPositions != nullptr);
+	ocean_assert(width >= 3u && height >= 3u);
+	ocean_assert(valuesStrideElements >= width);
+	ocean_assert(horizontalBins >= 1u && horizontalBins <= width);
+	ocean_assert(verticalBins >= 1u && verticalBins <= height);
+	ocean_assert(firstBinRow + numberBinRows <= verticalBins);
+	ocean_assert(maximalPositionsPerBin >= 1u);
+
+	const T localThreshold = *minimalThreshold;
+
+	Indices32 maximumColumns;
+	maximumColumns.reserve(128);
+
+	for (unsigned int yBin = firstBinRow; yBin < firstBinRow + numberBinRows; ++yBin)
+	{
+		// the rows y with y * verticalBins / height == yBin, excluding the first and the last row of the frame
+
+		const unsigned int firstBinY = (unsigned int)((uint64_t(yBin) * uint64_t(height) + uint64_t(verticalBins - 1u)) / uint64_t(verticalBins));
+		const unsigned int endBinY = (unsigned int)((uint64_t(yBin + 1u) * uint64_t(height) + uint64_t(verticalBins - 1u)) / uint64_t(verticalBins));
+
+		const unsigned int firstCenterRow = std::max(1u, firstBinY);
+		const unsigned int endCenterRow = std::min(endBinY, height - 1u);
+
+		StrengthPositions<TCoordinate, TStrength>* const binRowPositions = binStrengthPositions + yBin * horizontalBins;
+
+		for (unsigned int y = firstCenterRow; y < endCenterRow; ++y)
+		{
+			ocean_assert(y * verticalBins / height == yBin);
+
+			const T* const valuesCenter = values + y * valuesStrideElements;
+
+			maximumColumns.clear();
+			determineLocalMaximaInRow<tStrictMaximum>(valuesCenter - valuesStrideElements, valuesCenter, valuesCenter + valuesStrideElements, width, localThreshold, maximumColumns);
+
+			for (const Index32& x : maximumColumns)
+			{
+				const unsigned int xBin = (unsigned int)(uint64_t(x) * uint64_t(horizontalBins) / uint64_t(width));
+				ocean_assert(xBin < horizontalBins);
+
+				StrengthPositions<TCoordinate, TStrength>& binPositions = binRowPositions[xBin];
+
+				// each bin is a heap with the weakest position on top, as the positions arrive row by row, a new position with same strength as the weakest position is weaker
+
+				if (binPositions.size() < size_t(maximalPositionsPerBin))
+				{
+					binPositions.emplace_back(TCoordinate(x), TCoordinate(y), TStrength(valuesCenter[x]));
+					std::push_heap(binPositions.begin(), binPositions.end(), isStronger<TCoordinate, TStrength>);
+				}
+				else if (TStrength(valuesCenter[x]) > binPositions.front().strength())
+				{
+					std::pop_heap(binPositions.begin(), binPositions.end(), isStronger<TCoordinate, TStrength>);
+					binPositions.back() = StrengthPosition<TCoordinate, TStrength>(TCoordinate(x), TCoordinate(y), TStrength(valuesCenter[x]));
+					std::push_heap(binPositions.begin(), binPositions.end(), isStronger<TCoordinate, TStrength>);
+				}
+			}
+		}
+
+		// sorting the heaps in the sense of isStronger() provides the strongest position first
+
+		for (unsigned int xBin = 0u; xBin < horizontalBins; ++xBin)
+		{
+			std::sort_heap(binRowPositions[xBin].begin(), binRowPositions[xBin].end(), isStronger<TCoordinate, TStrength>);
+		}
+	}
+}
+
+template <typename T>
+template <bool tStrictMaximum>
+void NonMaximumSuppressionT<T>::determineLocalMaximaInRow(const T* valuesTop, const T* valuesCenter, const T* valuesBottom, const unsigned int width, const T minimalThreshold, Indices32& maximumColumns)
+{
+	ocean_assert(valuesTop != nullptr && valuesCenter != nullptr && valuesBottom != nullptr);
+	ocean_assert(width >= 3u);
+
+	unsigned int x = 1u;
+
+#if defined(OCEAN_HARDWARE_SSE_VERSION) && OCEAN_HARDWARE_SSE_VERSION >= 41
+
+	if constexpr (std::is_same<T, float>::value)
+	{
+		const __m128 threshold_f_32x4 = _mm_set1_ps(minimalThreshold);
+
+		for (; x + 4u < width; x += 4u)
+		{
+			const __m128 center_f_32x4 = _mm_loadu_ps(valuesCenter + x);
+
+			__m128 mask_f_32x4 = _mm_cmpge_ps(center_f_32x4, threshold_f_32x4);
+
+			if (_mm_movemask_ps(mask_f_32x4) == 0)
+			{
+				continue;
+			}
+
+			// west, north west, north, north east, and south west are allowed to be equal for non-strict maxima
+
+			if constexpr (tStrictMaximum)
+			{
+				mask_f_32x4 = _mm_and_ps(mask_f_32x4, _mm_and_ps(_mm_cmpgt_ps(center_f_32x4, _mm_loadu_ps(valuesCenter + x - 1u)), _mm_cmpgt_ps(center_f_32x4, _mm_loadu_ps(valuesTop + x - 1u))));
+				mask_f_32x4 = _mm_and_ps(mask_f_32x4, _mm_and_ps(_mm_cmpgt_ps(center_f_32x4, _mm_loadu_ps(valuesTop + x)), _mm_cmpgt_ps(center_f_32x4, _mm_loadu_ps(valuesTop + x + 1u))));
+				mask_f_32x4 = _mm_and_ps(mask_f_32x4, _mm_cmpgt_ps(center_f_32x4, _mm_loadu_ps(valuesBottom + x - 1u)));
+			}
+			else
+			{
+				mask_f_32x4 = _mm_and_ps(mask_f_32x4, _mm_and_ps(_mm_cmpge_ps(center_f_32x4, _mm_loadu_ps(valuesCenter + x - 1u)), _mm_cmpge_ps(center_f_32x4, _mm_loadu_ps(valuesTop + x - 1u))));
+				mask_f_32x4 = _mm_and_ps(mask_f_32x4, _mm_and_ps(_mm_cmpge_ps(center_f_32x4, _mm_loadu_ps(valuesTop + x)), _mm_cmpge_ps(center_f_32x4, _mm_loadu_ps(valuesTop + x + 1u))));
+				mask_f_32x4 = _mm_and_ps(mask_f_32x4, _mm_cmpge_ps(center_f_32x4, _mm_loadu_ps(valuesBottom + x - 1u)));
+			}
+
+			mask_f_32x4 = _mm_and_ps(mask_f_32x4, _mm_and_ps(_mm_cmpgt_ps(center_f_32x4, _mm_loadu_ps(valuesCenter + x + 1u)), _mm_cmpgt_ps(center_f_32x4, _mm_loadu_ps(valuesBottom + x))));
+			mask_f_32x4 = _mm_and_ps(mask_f_32x4, _mm_cmpgt_ps(center_f_32x4, _mm_loadu_ps(valuesBottom + x + 1u)));
+
+			const int mask = _mm_movemask_ps(mask_f_32x4);
+
+			for (unsigned int n = 0u; n < 4u; ++n)
+			{
+				if (mask & (1 << n))
+				{
+					maximumColumns.emplace_back(x + n);
+				}
+			}
+		}
+	}
+	else if constexpr (std::is_same<T, int32_t>::value)
+	{
+		const __m128i threshold_s_32x4 = _mm_set1_epi32(minimalThreshold);
+
+		for (; x + 4u < width; x += 4u)
+		{
+			const __m128i center_s_32x4 = _mm_loadu_si128((const __m128i*)(valuesCenter + x));
+
+			// center >= threshold, which is !(threshold > center)
+			__m128i mask_s_32x4 = _mm_andnot_si128(_mm_cmpgt_epi32(threshold_s_32x4, center_s_32x4), _mm_set1_epi32(-1));
+
+			if (_mm_movemask_ps(_mm_castsi128_ps(mask_s_32x4)) == 0)
+			{
+				continue;
+			}
+
+			const __m128i west_s_32x4 = _mm_loadu_si128((const __m128i*)(valuesCenter + x - 1u));
+			const __m128i northWest_s_32x4 = _mm_loadu_si128((const __m128i*)(valuesTop + x - 1u));
+			const __m128i north_s_32x4 = _mm_loadu_si128((const __m128i*)(valuesTop + x));
+			const __m128i northEast_s_32x4 = _mm_loadu_si128((const __m128i*)(valuesTop + x + 1u));
+			const __m128i southWest_s_32x4 = _mm_loadu_si128((const __m128i*)(valuesBottom + x - 1u));
+
+			if constexpr (tStrictMaximum)
+			{
+				mask_s_32x4 = _mm_and_si128(mask_s_32x4, _mm_and_si128(_mm_cmpgt_epi32(center_s_32x4, west_s_32x4), _mm_cmpgt_epi32(center_s_32x4, northWest_s_32x4)));
+				mask_s_32x4 = _mm_and_si128(mask_s_32x4, _mm_and_si128(_mm_cmpgt_epi32(center_s_32x4, north_s_32x4), _mm_cmpgt_epi32(center_s_32x4, northEast_s_32x4)));
+				mask_s_32x4 = _mm_and_si128(mask_s_32x4, _mm_cmpgt_epi32(center_s_32x4, southWest_s_32x4));
+			}
+			else
+			{
+				// center >= neighbor, which is !(neighbor > center)
+				mask_s_32x4 = _mm_andnot_si128(_mm_or_si128(_mm_cmpgt_epi32(west_s_32x4, center_s_32x4), _mm_cmpgt_epi32(northWest_s_32x4, center_s_32x4)), mask_s_32x4);
+				mask_s_32x4 = _mm_andnot_si128(_mm_or_si128(_mm_cmpgt_epi32(north_s_32x4, center_s_32x4), _mm_cmpgt_epi32(northEast_s_32x4, center_s_32x4)), mask_s_32x4);
+				mask_s_32x4 = _mm_andnot_si128(_mm_cmpgt_epi32(southWest_s_32x4, center_s_32x4), mask_s_32x4);
+			}
+
+			mask_s_32x4 = _mm_and_si128(mask_s_32x4, _mm_and_si128(_mm_cmpgt_epi32(center_s_32x4, _mm_loadu_si128((const __m128i*)(valuesCenter + x + 1u))), _mm_cmpgt_epi32(center_s_32x4, _mm_loadu_si128((const __m128i*)(valuesBottom + x)))));
+			mask_s_32x4 = _mm_and_si128(mask_s_32x4, _mm_cmpgt_epi32(center_s_32x4, _mm_loadu_si128((const __m128i*)(valuesBottom + x + 1u))));
+
+			const int mask = _mm_movemask_ps(_mm_castsi128_ps(mask_s_32x4));
+
+			for (unsigned int n = 0u; n < 4u; ++n)
+			{
+				if (mask & (1 << n))
+				{
+					maximumColumns.emplace_back(x + n);
+				}
+			}
+		}
+	}
+
+#elif defined(OCEAN_HARDWARE_NEON_VERSION) && OCEAN_HARDWARE_NEON_VERSION >= 10
+
+	if constexpr (std::is_same<T, float>::value || std::is_same<T, int32_t>::value)
+	{
+		for (; x + 4u < width; x += 4u)
+		{
+			uint32x4_t mask_u_32x4;
+
+			if constexpr (std::is_same<T, float>::value)
+			{
+				const float32x4_t center_f_32x4 = vld1q_f32(valuesCenter + x);
+
+				mask_u_32x4 = vcgeq_f32(center_f_32x4, vdupq_n_f32(minimalThreshold));
+
+				if constexpr (tStrictMaximum)
+				{
+					mask_u_32x4 = vandq_u32(mask_u_32x4, vandq_u32(vcgtq_f32(center_f_32x4, vld1q_f32(valuesCenter + x - 1u)), vcgtq_f32(center_f_32x4, vld1q_f32(valuesTop + x - 1u))));
+					mask_u_32x4 = vandq_u32(mask_u_32x4, vandq_u32(vcgtq_f32(center_f_32x4, vld1q_f32(valuesTop + x)), vcgtq_f32(center_f_32x4, vld1q_f32(valuesTop + x + 1u))));
+					mask_u_32x4 = vandq_u32(mask_u_32x4, vcgtq_f32(center_f_32x4, vld1q_f32(valuesBottom + x - 1u)));
+				}
+				else
+				{
+					mask_u_32x4 = vandq_u32(mask_u_32x4, vandq_u32(vcgeq_f32(center_f_32x4, vld1q_f32(valuesCenter + x - 1u)), vcgeq_f32(center_f_32x4, vld1q_f32(valuesTop + x - 1u))));
+					mask_u_32x4 = vandq_u32(mask_u_32x4, vandq_u32(vcgeq_f32(center_f_32x4, vld1q_f32(valuesTop + x)), vcgeq_f32(center_f_32x4, vld1q_f32(valuesTop + x + 1u))));
+					mask_u_32x4 = vandq_u32(mask_u_32x4, vcgeq_f32(center_f_32x4, vld1q_f32(valuesBottom + x - 1u)));
+				}
+
+				mask_u_32x4 = vandq_u32(mask_u_32x4, vandq_u32(vcgtq_f32(center_f_32x4, vld1q_f32(valuesCenter + x + 1u)), vcgtq_f32(center_f_32x4, vld1q_f32(valuesBottom + x))));
+				mask_u_32x4 = vandq_u32(mask_u_32x4, vcgtq_f32(center_f_32x4, vld1q_f32(valuesBottom + x + 1u)));
+			}
+			else
+			{
+				const int32x4_t center_s_32x4 = vld1q_s32(valuesCenter + x);
+
+				mask_u_32x4 = vcgeq_s32(center_s_32x4, vdupq_n_s32(minimalThreshold));
+
+				if constexpr (tStrictMaximum)
+				{
+					mask_u_32x4 = vandq_u32(mask_u_32x4, vandq_u32(vcgtq_s32(center_s_32x4, vld1q_s32(valuesCenter + x - 1u)), vcgtq_s32(center_s_32x4, vld1q_s32(valuesTop + x - 1u))));
+					mask_u_32x4 = vandq_u32(mask_u_32x4, vandq_u32(vcgtq_s32(center_s_32x4, vld1q_s32(valuesTop + x)), vcgtq_s32(center_s_32x4, vld1q_s32(valuesTop + x + 1u))));
+					mask_u_32x4 = vandq_u32(mask_u_32x4, vcgtq_s32(center_s_32x4, vld1q_s32(valuesBottom + x - 1u)));
+				}
+				else
+				{
+					mask_u_32x4 = vandq_u32(mask_u_32x4, vandq_u32(vcgeq_s32(center_s_32x4, vld1q_s32(valuesCenter + x - 1u)), vcgeq_s32(center_s_32x4, vld1q_s32(valuesTop + x - 1u))));
+					mask_u_32x4 = vandq_u32(mask_u_32x4, vandq_u32(vcgeq_s32(center_s_32x4, vld1q_s32(valuesTop + x)), vcgeq_s32(center_s_32x4, vld1q_s32(valuesTop + x + 1u))));
+					mask_u_32x4 = vandq_u32(mask_u_32x4, vcgeq_s32(center_s_32x4, vld1q_s32(valuesBottom + x - 1u)));
+				}
+
+				mask_u_32x4 = vandq_u32(mask_u_32x4, vandq_u32(vcgtq_s32(center_s_32x4, vld1q_s32(valuesCenter + x + 1u)), vcgtq_s32(center_s_32x4, vld1q_s32(valuesBottom + x))));
+				mask_u_32x4 = vandq_u32(mask_u_32x4, vcgtq_s32(center_s_32x4, vld1q_s32(valuesBottom + x + 1u)));
+			}
+
+			const uint32x2_t mask_u_32x2 = vorr_u32(vget_low_u32(mask_u_32x4), vget_high_u32(mask_u_32x4));
+
+			if (vget_lane_u64(vreinterpret_u64_u32(mask_u_32x2), 0) == 0ull)
+			{
+				continue;
+			}
+
+			uint32_t mask[4];
+			vst1q_u32(mask, mask_u_32x4);
+
+			for (unsigned int n = 0u; n < 4u; ++n)
+			{
+				if (mask[n] != 0u)
+				{
+					maximumColumns.emplace_back(x + n);
+				}
+			}
+		}
+	}
+
+#endif // OCEAN_HARDWARE_SSE_VERSION, OCEAN_HARDWARE_NEON_VERSION
+
+	for (; x < width - 1u; ++x)
+	{
+		if (isLocalMaximum<tStrictMaximum>(valuesTop + x, valuesCenter + x, valuesBottom + x, minimalThreshold))
+		{
+			maximumColumns.emplace_back(x);
+		}
+	}
+}
+
+template <typename T>
+template <bool tStrictMaximum>
+OCEAN_FORCE_INLINE bool NonMaximumSuppressionT<T>::isLocalMaximum(const T* valuesTop, const T* valuesCenter, const T* valuesBottom, const T minimalThreshold)
+{
+	ocean_assert(valuesTop != nullptr && valuesCenter != nullptr && valuesBottom != nullptr);
+
+	const T& center = *valuesCenter;
+
+	if (center < minimalThreshold)
+	{
+		return false;
+	}
+
+	// values below the threshold are no candidates, however they are smaller than the center value anyway
+
+	if constexpr (tStrictMaximum)
+	{
+		if (valuesCenter[-1] >= center || valuesTop[-1] >= center || valuesTop[0] >= center || valuesTop[1] >= center || valuesBottom[-1] >= center)
+		{
+			return false;
+		}
+	}
+	else
+	{
+		if (valuesCenter[-1] > center || valuesTop[-1] > center || valuesTop[0] > center || valuesTop[1] > center || valuesBottom[-1] > center)
+		{
+			return false;
+		}
+	}
+
+	return valuesCenter[1] < center && valuesBottom[0] < center && valuesBottom[1] < center;
+}
+
+template <typename T>
+template <typename TCoordinate, typename TStrength>
+inline bool NonMaximumSuppressionT<T>::isStronger(const StrengthPosition<TCoordinate, TStrength>& first, const StrengthPosition<TCoordinate, TStrength>& second)
+{
+	if (first.strength() != second.strength())
+	{
+		return first.strength() > second.strength();
+	}
+
+	if (first.y() != second.y())
+	{
+		return first.y() < second.y();
+	}
+
+	return first.x() < second.x();
+}
+
 }
 
 }
@@ -9,6 +9,7 @@
 #define META_OCEAN_CV_SUM_ABSOLUTE_DIFFERENCES_H
 
 #include "ocean/cv/CV.h"
+#include "ocean/cv/PixelPosition.h"
 #include "ocean/cv/SumAbsoluteDifferencesBase.h"
 #include "ocean/cv/SumAbsoluteDifferencesNEON.h"
 #include "ocean/cv/SumAbsoluteDifferencesSSE.h"
@@ -50,6 +51,26 @@ class SumAbsoluteDifferences : public SumAbsoluteDifferencesBase
 		template <unsigned int tChannels, unsigned int tPatchSize>
 		static inline uint32_t patch8BitPerChannel(const uint8_t* const image0, const uint8_t* const image1, const unsigned int width0, const unsigned int width1, const unsigned int centerX0, const unsigned int centerY0, const unsigned int centerX1, const unsigned int centerY1, const unsigned int image0PaddingElements, const unsigned int image1PaddingElements);
 
+		/**
+		 * Returns the sums of absolute differences between one image patch and several candidate image patches.
+		 * @param image0 The image in which the reference patch is located, must be valid
+		 * @param image1 The image in which the candidate patches are located, must be valid
+		 * @param width0 The width of the first image, in pixels, with range [tPatchSize, infinity)
+		 * @param width1 The width of the second image, in pixels, with range [tPatchSize, infinity)
+		 * @param centerX0 Horizontal center position of the (tPatchSize x tPatchSize) block in the first frame, with range [tPatchSize/2, width0 - tPatchSize/2 - 1]
+		 * @param centerY0 Vertical center position of the (tPatchSize x tPatchSize) block in the first frame, with range [tPatchSize/2, height0 - tPatchSize/2 - 1]
+		 * @param centers1 The center positions of the (tPatchSize x tPatchSize) blocks in the second frame, each with range [tPatchSize/2, width1 - tPatchSize/2 - 1]x[tPatchSize/2, height1 - tPatchSize/2 - 1], must be valid
+		 * @param numberCenters1 The number of given candidate positions, with range [1, infinity)
+		 * @param image0PaddingElements The number of padding elements at the end of each row of the first image, in elements, with range [0, infinity)
+		 * @param image1PaddingElements The number of padding elements at the end of each row of the second image, in elements, with range [0, infinity)
+		 * @param results The resulting sums of absolute differences, one for each candidate position, must be valid
+		 * @tparam tChannels The number of frame channels, with range [1, infinity)
+		 * @tparam tPatchSize The size of the square patch (the edge length) in pixel, with range [1, infinity), must be odd
+		 * @see patch8BitPerChannel().
+		 */
+		template <unsigned int tChannels, unsigned int tPatchSize>
+		static inline void patchCandidates8BitPerChannel(const uint8_t* const image0, const uint8_t* const image1, const unsigned int width0, const unsigned int width1, const unsigned int centerX0, const unsigned int centerY0, const PixelPosition* centers1, const size_t numberCenters1, const unsigned int image0PaddingElements, const unsigned int image1PaddingElements, uint32_t* results);
+
 		/**
 		 * Returns the sum of absolute differences between an image patch and a memory buffer.
 		 * @param image0 The image in which the image patch is located, must be valid
@@ -166,6 +187,20 @@ inline uint32_t SumAbsoluteDifferences::patch8BitPerChannel(const uint8_t* image
 	return SumAbsoluteDifferencesBase::patch8BitPerChannelTemplate<tChannels, tPatchSize>(patch0, patch1, image0StrideElements, image1StrideElements);
 }
 
+template <unsigned int tChannels, unsigned int tPatchSize>
+inline void SumAbsoluteDifferences::patchCandidates8BitPerChannel(const uint8_t* const image0, const uint8_t* const image1, const unsigned int width0, const unsigned int width1, const unsigned int centerX0, const unsigned int centerY0, const PixelPosition* centers1, const size_t numberCenters1, const unsigned int image0PaddingElements, const unsigned int image1PaddingElements, uint32_t* results)
+{
+	static_assert(tChannels >= 1u, "Invalid channel number!");
+	static_assert(tPatchSize % 2u == 1u, "Invalid patch size!");
+
+	ocean_assert(centers1 != nullptr && results != nullptr);
+
+	for (size_t n = 0; n < numberCenters1; ++n)
+	{
+		results[n] = patch8BitPerChannel<tChannels, tPatchSize>(image0, image1, width0, width1, centerX0, centerY0, centers1[n].x(), centers1[n].y(), image0PaddingElements, image1PaddingElements);
+	}
+}
+
 template <unsigned int tChannels, unsigned int tPatchSize>
 inline uint32_t SumAbsoluteDifferences::patchBuffer8BitPerChannel(const uint8_t* const image0, const unsigned int width0, const unsigned int centerX0, const unsigned int centerY0, const unsigned int image0PaddingElements, const uint8_t* const buffer1)
 {
@@ -51,6 +51,21 @@ class SumSquareDifferencesNEON
 		template <unsigned int tChannels, unsigned int tPatchSize>
 		static inline uint32_t patch8BitPerChannel(const uint8_t* patch0, const uint8_t* patch1, const unsigned int patch0StrideElements, const unsigned int patch1StrideElements);
 
+		/**
+		 * Returns the sums of square differences between one reference patch and several candidate patches within an image.
+		 * The candidates are handled in groups of four so that each block of the reference patch is loaded only once per group.
+		 * @param patch0 The top left start position of the reference image patch, must be valid
+		 * @param patches1 The top left start positions of the candidate image patches, must be valid
+		 * @param numberPatches1 The number of candidate patches, with range [1, infinity)
+		 * @param patch0StrideElements The number of elements between two rows for the reference patch, in elements, with range [tChannels, tPatchSize, infinity)
+		 * @param patch1StrideElements The number of elements between two rows for the candidate patches, in elements, with range [tChannels, tPatchSize, infinity)
+		 * @param results The resulting sums of square differences, one for each candidate patch, must be valid
+		 * @tparam tChannels The number of channels for the given frames, with range [1, infinity)
+		 * @tparam tPatchSize The size of the square patch (the edge length) in pixel, with range [5, infinity), must be odd
+		 */
+		template <unsigned int tChannels, unsigned int tPatchSize>
+		static inline void patchCandidates8BitPerChannel(const uint8_t* patch0, const uint8_t* const* patches1, const unsigned int numberPatches1, const unsigned int patch0StrideElements, const unsigned int patch1StrideElements, uint32_t* results);
+
 		/**
 		 * Returns the sum of square differences between an image patch and a buffer.
 		 * @param patch0 The top left start position of the image patch, must be valid
@@ -317,6 +332,154 @@ inline uint32_t SumSquareDifferencesNEON::patch8BitPerChannel(const uint8_t* pat
 	return NEON::sumHorizontal_u_32x4(sum_u_32x4) + sumIndividual;
 }
 
+template <unsigned int tChannels, unsigned int tPatchSize>
+inline void SumSquareDifferencesNEON::patchCandidates8BitPerChannel(const uint8_t* patch0, const uint8_t* const* patches1, const unsigned int numberPatches1, const unsigned int patch0StrideElements, const unsigned int patch1StrideElements, uint32_t* results)
+{
+	static_assert(tChannels >= 1u, "Invalid channel number!");
+	static_assert(tPatchSize >= 5u, "Invalid patch size!");
+
+	ocean_assert(patch0 != nullptr && patches1 != nullptr && results != nullptr);
+
+	ocean_assert(patch0StrideElements >= tChannels * tPatchSize);
+	ocean_assert(patch1StrideElements >= tChannels * tPatchSize);
+
+	constexpr unsigned int patchWidthElements = tChannels * tPatchSize;
+
+	constexpr unsigned int blocks16 = patchWidthElements / 16u;
+	constexpr unsigned int blocks8 = (patchWidthElements - blocks16 * 16u) / 8u;
+	constexpr unsigned int blocks1 = patchWidthElements - blocks16 * 16u - blocks8 * 8u;
+
+	static_assert(blocks1 <= 7u, "Invalid block size!");
+
+	const uint8x8_t maskRight_u_8x8 = vcreate_u8(uint64_t(-1) >> (8u - blocks1) * 8u);
+	const uint8x8_t maskLeft_u_8x8 = vcreate_u8(uint64_t(-1) << (8u - blocks1) * 8u);
+
+	constexpr unsigned int tCandidates = 4u;
+
+	unsigned int nPatch = 0u;
+
+	for (; nPatch + tCandidates <= numberPatches1; nPatch += tCandidates)
+	{
+		const uint8_t* row0 = patch0;
+
+		const uint8_t* rows1[tCandidates];
+
+		uint32x4_t sums_u_32x4[tCandidates];
+		uint32_t sumsIndividual[tCandidates];
+
+		for (unsigned int c = 0u; c < tCandidates; ++c)
+		{
+			ocean_assert(patches1[nPatch + c] != nullptr);
+
+			rows1[c] = patches1[nPatch + c];
+
+			sums_u_32x4[c] = vdupq_n_u32(0u);
+			sumsIndividual[c] = 0u;
+		}
+
+		for (unsigned int y = 0u; y < tPatchSize; ++y)
+		{
+			unsigned int offset = 0u;
+
+			for (unsigned int n = 0u; n < blocks16; ++n)
+			{
+				// the block of the reference patch is loaded once and compared with all candidates
+
+				const uint8x16_t buffer0_u_8x16 = vld1q_u8(row0 + offset);
+
+				for (unsigned int c = 0u; c < tCandidates; ++c)
+				{
+					// [|patch0[0] - patch1[0]|, |patch0[1] - patch1[1]|, ..]
+					const uint8x16_t absDifference_u_8x16 = vabdq_u8(buffer0_u_8x16, vld1q_u8(rows1[c] + offset));
+
+					const uint8x8_t absDifferenceA_u_8x8 = vget_low_u8(absDifference_u_8x16);
+					const uint8x8_t absDifferenceB_u_8x8 = vget_high_u8(absDifference_u_8x16);
+
+					sums_u_32x4[c] = vpadalq_u16(sums_u_32x4[c], vmull_u8(absDifferenceA_u_8x8, absDifferenceA_u_8x8));
+					sums_u_32x4[c] = vpadalq_u16(sums_u_32x4[c], vmull_u8(absDifferenceB_u_8x8, absDifferenceB_u_8x8));
+				}
+
+				offset += 16u;
+			}
+
+			for (unsigned int n = 0u; n < blocks8; ++n)
+			{
+				const uint8x8_t buffer0_u_8x8 = vld1_u8(row0 + offset);
+
+				for (unsigned int c = 0u; c < tCandidates; ++c)
+				{
+					const uint8x8_t absDifference_u_8x8 = vabd_u8(buffer0_u_8x8, vld1_u8(rows1[c] + offset));
+
+					sums_u_32x4[c] = vpadalq_u16(sums_u_32x4[c], vmull_u8(absDifference_u_8x8, absDifference_u_8x8));
+				}
+
+				offset += 8u;
+			}
+
+			if constexpr (blocks1 != 0u)
+			{
+				if (blocks1 >= 3u)
+				{
+					// we have enough elements left so that using NEON is still faster than handling each element individually
+
+					if (y < tPatchSize - 1u)
+					{
+						const uint8x8_t remaining0_u_8x8 = vand_u8(vld1_u8(row0 + offset), maskRight_u_8x8);
+
+						for (unsigned int c = 0u; c < tCandidates; ++c)
+						{
+							const uint8x8_t absDifference_u_8x8 = vabd_u8(remaining0_u_8x8, vand_u8(vld1_u8(rows1[c] + offset), maskRight_u_8x8));
+
+							sums_u_32x4[c] = vpadalq_u16(sums_u_32x4[c], vmull_u8(absDifference_u_8x8, absDifference_u_8x8));
+						}
+					}
+					else
+					{
+						constexpr unsigned int overlapElements = 8u - blocks1;
+						static_assert(overlapElements >= 1u && overlapElements < 8u, "Invalid number!");
+
+						const uint8x8_t remaining0_u_8x8 = vand_u8(vld1_u8(row0 + offset - overlapElements), maskLeft_u_8x8);
+
+						for (unsigned int c = 0u; c < tCandidates; ++c)
+						{
+							const uint8x8_t absDifference_u_8x8 = vabd_u8(remaining0_u_8x8, vand_u8(vld1_u8(rows1[c] + offset - overlapElements), maskLeft_u_8x8));
+
+							sums_u_32x4[c] = vpadalq_u16(sums_u_32x4[c], vmull_u8(absDifference_u_8x8, absDifference_u_8x8));
+						}
+					}
+				}
+				else
+				{
+					for (unsigned int n = 0u; n < blocks1; ++n)
+					{
+						for (unsigned int c = 0u; c < tCandidates; ++c)
+						{
+							sumsIndividual[c] += sqrDistance(row0[offset + n], rows1[c][offset + n]);
+						}
+					}
+				}
+			}
+
+			row0 += patch0StrideElements;
+
+			for (unsigned int c = 0u; c < tCandidates; ++c)
+			{
+				rows1[c] += patch1StrideElements;
+			}
+		}
+
+		for (unsigned int c = 0u; c < tCandidates; ++c)
+		{
+			results[nPatch + c] = NEON::sumHorizontal_u_32x4(sums_u_32x4[c]) + sumsIndividual[c];
+		}
+	}
+
+	for (; nPatch < numberPatches1; ++nPatch)
+	{
+		results[nPatch] = patch8BitPerChannel<tChannels, tPatchSize>(patch0, patches1[nPatch], patch0StrideElements, patch1StrideElements);
+	}
+}
+
 template <unsigned int tChannels, unsigned int tPatchSize>
 inline uint32_t SumSquareDifferencesNEON::patchBuffer8BitPerChannel(const uint8_t* patch0, const uint8_t* buffer1, const unsigned int patch0StrideElements)
 {
@@ -550,7 +713,10 @@ OCEAN_FORCE_INLINE uint8x8_t SumSquareDifferencesNEON::loadMirrored_u_8x8(const
 
 	constexpr unsigned int tOverlappingElements = 8u - tSize;
 
-	if (elementIndex >= 0 && elementIndex <= int(elements) - int(tSize))
+	// the vector load reads the overlapping elements as well, so that all 8 elements must be inside the row (the row may be the last row of the image)
+	constexpr int tLoadOffset = tFront ? 0 : -int(tOverlappingElements);
+
+	if (elementIndex + tLoadOffset >= 0 && elementIndex + tLoadOffset <= int(elements) - 8)
 	{
 		if constexpr (tSize == 8u)
 		{
@@ -620,7 +786,10 @@ OCEAN_FORCE_INLINE uint8x16_t SumSquareDifferencesNEON::loadMirrored_u_8x16(cons
 
 	constexpr unsigned int tOverlappingElements = 16u - tSize;
 
-	if (elementIndex >= 0 && elementIndex <= int(elements) - int(tSize))
+	// the vector load reads the overlapping elements as well, so that all 16 elements must be inside the row (the row may be the last row of the image)
+	constexpr int tLoadOffset = tFront ? 0 : -int(tOverlappingElements);
+
+	if (elementIndex + tLoadOffset >= 0 && elementIndex + tLoadOffset <= int(elements) - 16)
 	{
 		if constexpr (tSize == 16u)
 		{
@@ -53,6 +53,21 @@ class SumSquareDifferencesSSE
 		template <unsigned int tChannels, unsigned int tPatchSize>
 		static inline uint32_t patch8BitPerChannel(const uint8_t* patch0, const uint8_t* patch1, const unsigned int patch0StrideElements, const unsigned int patch1StrideElements);
 
+		/**
+		 * Returns the sums of square differences between one reference patch and several candidate patches within an image.
+		 * The candidates are handled in groups of four so that each block of the reference patch is loaded only once per group.
+		 * @param patch0 The top left start position of the reference image patch, must be valid
+		 * @param patches1 The top left start positions of the candidate image patches, must be valid
+		 * @param numberPatches1 The number of candidate patches, with range [1, infinity)
+		 * @param patch0StrideElements The number of elements between two rows for the reference patch, in elements, with range [tChannels, tPatchSize, infinity)
+		 * @param patch1StrideElements The number of elements between two rows for the candidate patches, in elements, with range [tChannels, tPatchSize, infinity)
+		 * @param results The resulting sums of square differences, one for each candidate patch, must be valid
+		 * @tparam tChannels The number of channels for the given frames, with range [1, infinity)
+		 * @tparam tPatchSize The size of the square patch (the edge length) in pixel, with range [1, infinity), must be odd
+		 */
+		template <unsigned int tChannels, unsigned int tPatchSize>
+		static inline void patchCandidates8BitPerChannel(const uint8_t* patch0, const uint8_t* const* patches1, const unsigned int numberPatches1, const unsigned int patch0StrideElements, const unsigned int patch1StrideElements, uint32_t* results);
+
 		/**
 		 * Returns the sum of square differences between an image patch and a buffer.
 		 * @param patch0 The top left start position of the image patch, must be valid
@@ -103,6 +118,17 @@ class SumSquareDifferencesSSE
 		 * @return The mirrored index, with range [0, elements)
 		 * @tparam tChannels The number of channels the elements have, with range [1, infinity)
 		 */
+		/**
+		 * Adds the square differences between two vectors with 16 uint8_t values to 32 bit sums.
+		 * @param buffer0 The first 16 uint8_t values
+		 * @param buffer1 The second 16 uint8_t values
+		 * @param sum The four 32 bit sums to which the square differences will be added
+		 * @tparam tLowerHalf True, to handle the lower 8 values
+		 * @tparam tUpperHalf True, to handle the upper 8 values
+		 */
+		template <bool tLowerHalf, bool tUpperHalf>
+		static OCEAN_FORCE_INLINE void addSquareDifferences(const __m128i& buffer0, const __m128i& buffer1, __m128i& sum);
+
 		template <unsigned int tChannels>
 		static OCEAN_FORCE_INLINE unsigned int mirrorIndex(const int elementIndex, const unsigned int elements);
 
@@ -372,6 +398,172 @@ inline uint32_t SumSquareDifferencesSSE::patch8BitPerChannel(const uint8_t* patc
 	return SSE::sum_u32_4(sum_128i) + sumIndividual;
 }
 
+template <unsigned int tChannels, unsigned int tPatchSize>
+inline void SumSquareDifferencesSSE::patchCandidates8BitPerChannel(const uint8_t* patch0, const uint8_t* const* patches1, const unsigned int numberPatches1, const unsigned int patch0StrideElements, const unsigned int patch1StrideElements, uint32_t* results)
+{
+	static_assert(tChannels >= 1u, "Invalid channel number!");
+	static_assert(tPatchSize >= 1u, "Invalid buffer size!");
+
+	ocean_assert(patch0 != nullptr && patches1 != nullptr && results != nullptr);
+
+	ocean_assert(patch0StrideElements >= tChannels * tPatchSize);
+	ocean_assert(patch1StrideElements >= tChannels * tPatchSize);
+
+	constexpr unsigned int patchWidthElements = tChannels * tPatchSize;
+
+	constexpr unsigned int blocks16 = patchWidthElements / 16u;
+	constexpr unsigned int remainingAfterBlocks16 = patchWidthElements % 16u;
+
+	constexpr bool partialBlock16 = remainingAfterBlocks16 > 8u;
+
+	constexpr bool fullBlock8 = !partialBlock16 && remainingAfterBlocks16 == 8u;
+
+	constexpr bool partialBlock8 = !partialBlock16 && !fullBlock8 && remainingAfterBlocks16 >= 3u;
+
+	constexpr unsigned int blocks1 = (!partialBlock16 && !fullBlock8 && !partialBlock8) ? remainingAfterBlocks16 : 0u;
+
+	static_assert(blocks1 <= 2u, "Invalid block size!");
+
+	constexpr unsigned int tCandidates = 4u;
+
+	unsigned int nPatch = 0u;
+
+	for (; nPatch + tCandidates <= numberPatches1; nPatch += tCandidates)
+	{
+		const uint8_t* row0 = patch0;
+
+		const uint8_t* rows1[tCandidates];
+
+		__m128i sums_128i[tCandidates];
+		uint32_t sumsIndividual[tCandidates];
+
+		for (unsigned int c = 0u; c < tCandidates; ++c)
+		{
+			ocean_assert(patches1[nPatch + c] != nullptr);
+
+			rows1[c] = patches1[nPatch + c];
+
+			sums_128i[c] = _mm_setzero_si128();
+			sumsIndividual[c] = 0u;
+		}
+
+		for (unsigned int y = 0u; y < tPatchSize; ++y)
+		{
+			unsigned int offset = 0u;
+
+			for (unsigned int n = 0u; n < blocks16; ++n)
+			{
+				// the block of the reference patch is loaded once and compared with all candidates
+
+				const __m128i buffer0_128i = _mm_lddqu_si128((const __m128i*)(row0 + offset));
+
+				for (unsigned int c = 0u; c < tCandidates; ++c)
+				{
+					addSquareDifferences<true, true>(buffer0_128i, _mm_lddqu_si128((const __m128i*)(rows1[c] + offset)), sums_128i[c]);
+				}
+
+				offset += 16u;
+			}
+
+			if constexpr (fullBlock8)
+			{
+				const __m128i buffer0_128i = _mm_loadl_epi64((const __m128i*)(row0 + offset));
+
+				for (unsigned int c = 0u; c < tCandidates; ++c)
+				{
+					addSquareDifferences<true, false>(buffer0_128i, _mm_loadl_epi64((const __m128i*)(rows1[c] + offset)), sums_128i[c]);
+				}
+
+				offset += 8u;
+			}
+
+			if constexpr (partialBlock16)
+			{
+				constexpr unsigned int overlapElements = partialBlock16 ? 16u - remainingAfterBlocks16 : 0u;
+
+				static_assert(overlapElements < 8u, "Invalid value!");
+
+				if (y < tPatchSize - 1u)
+				{
+					const __m128i buffer0_128i = _mm_slli_si128(_mm_lddqu_si128((const __m128i*)(row0 + offset)), overlapElements); // loading 16 elements, but shifting `overlapElements` zeros to the left
+
+					for (unsigned int c = 0u; c < tCandidates; ++c)
+					{
+						addSquareDifferences<true, true>(buffer0_128i, _mm_slli_si128(_mm_lddqu_si128((const __m128i*)(rows1[c] + offset)), overlapElements), sums_128i[c]);
+					}
+				}
+				else
+				{
+					const __m128i buffer0_128i = _mm_srli_si128(_mm_lddqu_si128((const __m128i*)(row0 + offset - overlapElements)), overlapElements); // loading 16 elements, but shifting `overlapElements` zeros to the right
+
+					for (unsigned int c = 0u; c < tCandidates; ++c)
+					{
+						addSquareDifferences<true, true>(buffer0_128i, _mm_srli_si128(_mm_lddqu_si128((const __m128i*)(rows1[c] + offset - overlapElements)), overlapElements), sums_128i[c]);
+					}
+				}
+
+				offset += remainingAfterBlocks16;
+			}
+
+			if constexpr (partialBlock8)
+			{
+				constexpr unsigned int overlapElements = partialBlock8 ? 8u - remainingAfterBlocks16 : 0u;
+
+				static_assert(overlapElements < 8u, "Invalid value!");
+
+				if (y < tPatchSize - 1u)
+				{
+					const __m128i buffer0_128i = _mm_slli_si128(_mm_loadl_epi64((const __m128i*)(row0 + offset)), overlapElements + 8); // loading 8 elements, but shifting `overlapElements` zeros to the left
+
+					for (unsigned int c = 0u; c < tCandidates; ++c)
+					{
+						addSquareDifferences<false, true>(buffer0_128i, _mm_slli_si128(_mm_loadl_epi64((const __m128i*)(rows1[c] + offset)), overlapElements + 8), sums_128i[c]);
+					}
+				}
+				else
+				{
+					const __m128i buffer0_128i = _mm_srli_si128(_mm_loadl_epi64((const __m128i*)(row0 + offset - overlapElements)), overlapElements); // loading 8 elements, but shifting `overlapElements` zeros to the right
+
+					for (unsigned int c = 0u; c < tCandidates; ++c)
+					{
+						addSquareDifferences<true, false>(buffer0_128i, _mm_srli_si128(_mm_loadl_epi64((const __m128i*)(rows1[c] + offset - overlapElements)), overlapElements), sums_128i[c]);
+					}
+				}
+
+				offset += remainingAfterBlocks16;
+			}
+
+			if constexpr (blocks1 != 0u)
+			{
+				for (unsigned int n = 0u; n < blocks1; ++n)
+				{
+					for (unsigned int c = 0u; c < tCandidates; ++c)
+					{
+						sumsIndividual[c] += sqrDistance(row0[offset + n], rows1[c][offset + n]);
+					}
+				}
+			}
+
+			row0 += patch0StrideElements;
+
+			for (unsigned int c = 0u; c < tCandidates; ++c)
+			{
+				rows1[c] += patch1StrideElements;
+			}
+		}
+
+		for (unsigned int c = 0u; c < tCandidates; ++c)
+		{
+			results[nPatch + c] = SSE::sum_u32_4(sums_128i[c]) + sumsIndividual[c];
+		}
+	}
+
+	for (; nPatch < numberPatches1; ++nPatch)
+	{
+		results[nPatch] = patch8BitPerChannel<tChannels, tPatchSize>(patch0, patches1[nPatch], patch0StrideElements, patch1StrideElements);
+	}
+}
+
 template <unsigned int tChannels, unsigned int tPatchSize>
 inline uint32_t SumSquareDifferencesSSE::patchBuffer8BitPerChannel(const uint8_t* patch0, const uint8_t* buffer1, const unsigned int patch0StrideElements)
 {
@@ -541,6 +733,28 @@ uint32_t SumSquareDifferencesSSE::patchMirroredBorder8BitPerChannel(const uint8_
 	return SSE::sum_u32_4(sum_128i) + sumIndividual;
 }
 
+template <bool tLowerHalf, bool tUpperHalf>
+OCEAN_FORCE_INLINE void SumSquareDifferencesSSE::addSquareDifferences(const __m128i& buffer0, const __m128i& buffer1, __m128i& sum)
+{
+	static_assert(tLowerHalf || tUpperHalf, "Invalid halves!");
+
+	const __m128i constant_signs_m128i = _mm_set1_epi16(short(0x1FF)); // -1, 1, -1, 1, -1, 1, -1, 1
+
+	if constexpr (tLowerHalf)
+	{
+		const __m128i absDifferencesLow_128i = _mm_maddubs_epi16(_mm_unpacklo_epi8(buffer0, buffer1), constant_signs_m128i);
+
+		sum = _mm_add_epi32(sum, _mm_madd_epi16(absDifferencesLow_128i, absDifferencesLow_128i));
+	}
+
+	if constexpr (tUpperHalf)
+	{
+		const __m128i absDifferencesHigh_128i = _mm_maddubs_epi16(_mm_unpackhi_epi8(buffer0, buffer1), constant_signs_m128i);
+
+		sum = _mm_add_epi32(sum, _mm_madd_epi16(absDifferencesHigh_128i, absDifferencesHigh_128i));
+	}
+}
+
 template <unsigned int tChannels>
 inline unsigned int SumSquareDifferencesSSE::mirrorIndex(const int elementIndex, const unsigned int elements)
 {
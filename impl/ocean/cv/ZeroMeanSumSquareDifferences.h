@@ -9,6 +9,7 @@
 #define META_OCEAN_CV_ZERO_MEAN_SUM_SQUARE_DIFFERENCES_H
 
 #include "ocean/cv/CV.h"
+#include "ocean/cv/PixelPosition.h"
 #include "ocean/cv/ZeroMeanSumSquareDifferencesBase.h"
 #include "ocean/cv/ZeroMeanSumSquareDifferencesNEON.h"
 #include "ocean/cv/ZeroMeanSumSquareDifferencesSSE.h"
@@ -46,6 +47,27 @@ class ZeroMeanSumSquareDifferences : public ZeroMeanSumSquareDifferencesBase
 		template <unsigned int tChannels, unsigned int tPatchSize>
 		static inline uint32_t patch8BitPerChannel(const uint8_t* const image0, const uint8_t* const image1, const unsigned int width0, const unsigned int width1, const unsigned int centerX0, const unsigned int centerY0, const unsigned int centerX1, const unsigned int centerY1, const unsigned int image0PaddingElements, const unsigned int image1PaddingElements);
 
+		/**
+		 * Returns the zero-mean sums between one image patch and several candidate image patches.
+		 * This function is intended for searches evaluating many candidate positions for the same reference patch, the reference patch is handled once for several candidates.
+		 * @param image0 The image in which the reference patch is located, must be valid
+		 * @param image1 The image in which the candidate patches are located, must be valid
+		 * @param width0 The width of the first image, in pixels, with range [tPatchSize, infinity)
+		 * @param width1 The width of the second image, in pixels, with range [tPatchSize, infinity)
+		 * @param centerX0 Horizontal center position of the (tPatchSize x tPatchSize) block in the first frame, with range [tPatchSize/2, width0 - tPatchSize/2 - 1]
+		 * @param centerY0 Vertical center position of the (tPatchSize x tPatchSize) block in the first frame, with range [tPatchSize/2, height0 - tPatchSize/2 - 1]
+		 * @param centers1 The center positions of the (tPatchSize x tPatchSize) blocks in the second frame, each with range [tPatchSize/2, width1 - tPatchSize/2 - 1]x[tPatchSize/2, height1 - tPatchSize/2 - 1], must be valid
+		 * @param numberCenters1 The number of given candidate positions, with range [1, infinity)
+		 * @param image0PaddingElements The number of padding elements at the end of each row of the first image, in elements, with range [0, infinity)
+		 * @param image1PaddingElements The number of padding elements at the end of each row of the second image, in elements, with range [0, infinity)
+		 * @param results The resulting zero-mean sums, one for each candidate position, must be valid
+		 * @tparam tChannels The number of frame channels, with range [1, infinity)
+		 * @tparam tPatchSize The size of the square patch (the edge length) in pixel, with range [1, infinity), must be odd
+		 * @see patch8BitPerChannel().
+		 */
+		template <unsigned int tChannels, unsigned int tPatchSize>
+		static inline void patchCandidates8BitPerChannel(const uint8_t* const image0, const uint8_t* const image1, const unsigned int width0, const unsigned int width1, const unsigned int centerX0, const unsigned int centerY0, const PixelPosition* centers1, const size_t numberCenters1, const unsigned int image0PaddingElements, const unsigned int image1PaddingElements, uint32_t* results);
+
 		/**
 		 * Returns the zero-mean sum of square differences between an image patch and a memory buffer.
 		 * @param image0 The image in which the image patch is located, must be valid
@@ -138,6 +160,73 @@ inline uint32_t ZeroMeanSumSquareDifferences::patch8BitPerChannel(const uint8_t*
 	return ZeroMeanSumSquareDifferencesBase::patch8BitPerChannelTemplate<tChannels, tPatchSize>(patch0, patch1, image0StrideElements, image1StrideElements);
 }
 
+template <unsigned int tChannels, unsigned int tPatchSize>
+inline void ZeroMeanSumSquareDifferences::patchCandidates8BitPerChannel(const uint8_t* const image0, const uint8_t* const image1, const unsigned int width0, const unsigned int width1, const unsigned int centerX0, const unsigned int centerY0, const PixelPosition* centers1, const size_t numberCenters1, const unsigned int image0PaddingElements, const unsigned int image1PaddingElements, uint32_t* results)
+{
+	static_assert(tChannels >= 1u, "Invalid channel number!");
+	static_assert(tPatchSize >= 1u, "Invalid patch size!");
+
+	ocean_assert(image0 != nullptr && image1 != nullptr);
+	ocean_assert(centers1 != nullptr && results != nullptr);
+
+	ocean_assert(width0 >= tPatchSize);
+	ocean_assert(width1 >= tPatchSize);
+
+	constexpr unsigned int tPatchSize_2 = tPatchSize / 2u;
+
+	ocean_assert(centerX0 >= tPatchSize_2 && centerY0 >= tPatchSize_2);
+	ocean_assert(centerX0 < width0 - tPatchSize_2);
+
+	const unsigned int image0StrideElements = width0 * tChannels + image0PaddingElements;
+	const unsigned int image1StrideElements = width1 * tChannels + image1PaddingElements;
+
+	const uint8_t* const patch0 = image0 + (centerY0 - tPatchSize_2) * image0StrideElements + (centerX0 - tPatchSize_2) * tChannels;
+
+	// the candidates are forwarded in chunks so that the patch pointers can be stored on the stack
+
+	constexpr size_t maximalChunkSize = 16;
+
+	const uint8_t* patches1[maximalChunkSize];
+
+	for (size_t nChunk = 0; nChunk < numberCenters1; nChunk += maximalChunkSize)
+	{
+		const unsigned int chunkSize = (unsigned int)(std::min(maximalChunkSize, numberCenters1 - nChunk));
+
+		for (unsigned int n = 0u; n < chunkSize; ++n)
+		{
+			const PixelPosition& center1 = centers1[nChunk + n];
+
+			ocean_assert(center1.x() >= tPatchSize_2 && center1.y() >= tPatchSize_2);
+			ocean_assert(center1.x() < width1 - tPatchSize_2);
+
+			patches1[n] = image1 + (center1.y() - tPatchSize_2) * image1StrideElements + (center1.x() - tPatchSize_2) * tChannels;
+		}
+
+#if defined(OCEAN_HARDWARE_SSE_VERSION) && OCEAN_HARDWARE_SSE_VERSION >= 41
+
+		if constexpr ((tChannels == 1u || tChannels == 3u) && tPatchSize >= 5u)
+		{
+			ZeroMeanSumSquareDifferencesSSE::patchCandidates8BitPerChannel<tChannels, tPatchSize>(patch0, patches1, chunkSize, image0StrideElements, image1StrideElements, results + nChunk);
+			continue;
+		}
+
+#elif defined(OCEAN_HARDWARE_NEON_VERSION) && OCEAN_HARDWARE_NEON_VERSION >= 10
+
+		if constexpr ((tChannels == 1u || tChannels == 3u) && tPatchSize >= 5u)
+		{
+			ZeroMeanSumSquareDifferencesNEON::patchCandidates8BitPerChannel<tChannels, tPatchSize>(patch0, patches1, chunkSize, image0StrideElements, image1StrideElements, results + nChunk);
+			continue;
+		}
+
+#endif // OCEAN_HARDWARE_SSE_VERSION, OCEAN_HARDWARE_NEON_VERSION
+
+		for (unsigned int n = 0u; n < chunkSize; ++n)
+		{
+			results[nChunk + n] = ZeroMeanSumSquareDifferencesBase::patch8BitPerChannelTemplate<tChannels, tPatchSize>(patch0, patches1[n], image0StrideElements, image1StrideElements);
+		}
+	}
+}
+
 template <unsigned int tChannels, unsigned int tPatchSize>
 inline unsigned int ZeroMeanSumSquareDifferences::patchBuffer8BitPerChannel(const uint8_t* const image0, const unsigned int width0, const unsigned int centerX0, const unsigned int centerY0, const unsigned int image0PaddingElements, const uint8_t* const buffer1)
 {
@@ -112,6 +112,21 @@ class ZeroMeanSumSquareDifferencesSSE
 		template <unsigned int tChannels, unsigned int tPatchSize>
 		static inline uint32_t patch8BitPerChannel(const uint8_t* const patch0, const uint8_t* const patch1, const unsigned int patch0StrideElements, const unsigned int patch1StrideElements);
 
+		/**
+		 * Returns the zero-mean sums of square differences between one reference patch and several candidate patches within an image.
+		 * The mean values of the reference patch are determined only once for all candidates.
+		 * @param patch0 The top left start position of the reference image patch, must be valid
+		 * @param patches1 The top left start positions of the candidate image patches, must be valid
+		 * @param numberPatches1 The number of candidate patches, with range [1, infinity)
+		 * @param patch0StrideElements The number of elements between two rows for the reference patch, in elements, with range [tChannels, tPatchSize, infinity)
+		 * @param patch1StrideElements The number of elements between two rows for the candidate patches, in elements, with range [tChannels, tPatchSize, infinity)
+		 * @param results The resulting zero-mean sums of square differences, one for each candidate patch, must be valid
+		 * @tparam tChannels Specifies the number of channels for the given frames, with range [1, infinity)
+		 * @tparam tPatchSize The size of the square patch (the edge length) in pixel, with range [5, infinity), must be odd
+		 */
+		template <unsigned int tChannels, unsigned int tPatchSize>
+		static inline void patchCandidates8BitPerChannel(const uint8_t* const patch0, const uint8_t* const* patches1, const unsigned int numberPatches1, const unsigned int patch0StrideElements, const unsigned int patch1StrideElements, uint32_t* results);
+
 		/**
 		 * Returns the zero-mean sum of square differences between an image patch and a buffer.
 		 * @param patch0 The top left start position of the image patch, must be valid
@@ -1591,6 +1606,31 @@ inline uint32_t ZeroMeanSumSquareDifferencesSSE::patch8BitPerChannel(const uint8
 	return SpecializedForChannels<tChannels>::template patch8BitPerChannel<tPatchSize>(patch0, patch1, patch0StrideElements, patch1StrideElements, meanValues0, meanValues1);
 }
 
+template <unsigned int tChannels, unsigned int tPatchSize>
+inline void ZeroMeanSumSquareDifferencesSSE::patchCandidates8BitPerChannel(const uint8_t* const patch0, const uint8_t* const* patches1, const unsigned int numberPatches1, const unsigned int patch0StrideElements, const unsigned int patch1StrideElements, uint32_t* results)
+{
+	static_assert(tChannels >= 1u, "Invalid channel number!");
+	static_assert(tPatchSize >= 5u, "Invalid patch size!");
+
+	ocean_assert(patch0 != nullptr && patches1 != nullptr && results != nullptr);
+
+	ocean_assert(patch0StrideElements >= tChannels * tPatchSize);
+	ocean_assert(patch1StrideElements >= tChannels * tPatchSize);
+
+	uint8_t meanValues0[tChannels];
+	mean8BitPerChannel<tChannels, tPatchSize>(patch0, patch0StrideElements, meanValues0);
+
+	for (unsigned int n = 0u; n < numberPatches1; ++n)
+	{
+		ocean_assert(patches1[n] != nullptr);
+
+		uint8_t meanValues1[tChannels];
+		mean8BitPerChannel<tChannels, tPatchSize>(patches1[n], patch1StrideElements, meanValues1);
+
+		results[n] = SpecializedForChannels<tChannels>::template patch8BitPerChannel<tPatchSize>(patch0, patches1[n], patch0StrideElements, patch1StrideElements, meanValues0, meanValues1);
+	}
+}
+
 template <unsigned int tChannels, unsigned int tPatchSize>
 inline uint32_t ZeroMeanSumSquareDifferencesSSE::patchBuffer8BitPerChannel(const uint8_t* const patch0, const uint8_t* const buffer1, const unsigned int patch0StrideElements)
 {
@@ -11,8 +11,11 @@
 #include "ocean/cv/advanced/Advanced.h"
 
 #include "ocean/base/Frame.h"
+#include "ocean/base/Memory.h"
 #include "ocean/base/Worker.h"
 
+#include "ocean/cv/FrameFilterSeparable.h"
+
 namespace Ocean
 {
 
@@ -105,12 +108,13 @@ class AdvancedFrameFilterSeparable
 		 * @param verticalFilterSize The number of elements the vertical filter has, with range [1, height], must be odd
 		 * @param maskValue The pixel value for an invalid mask pixel, with range [0, infinity)
 		 * @param worker Optional worker object to distribute the computation
+		 * @param executionMode The execution mode to be used, tiled execution avoids the intermediate frame and is not applied for in-place filtering
 		 * @tparam T The data type of each pixel channel of the source frame (and target frame) e.g., 'uint8_t', or 'float'
 		 * @tparam TFilter The data type of each filter elements e.g., 'unsigned int', or 'float'
 		 * @see filterUniversal<T>()
 		 */
 		template <typename T, typename TFilter>
-		static void filter(const T* source, const uint8_t* sourceMask, T* target, uint8_t* targetMask, const unsigned int width, const unsigned int height, const unsigned int channels, const unsigned int sourcePaddingElements, const unsigned int sourceMaskPaddingElements, const unsigned int targetPaddingElements, const unsigned int targetMaskPaddingElements, const TFilter* horizontalFilter, const unsigned int horizontalFilterSize, const TFilter* verticalFilter, const unsigned int verticalFilterSize, const uint8_t maskValue = 0x00u, Worker* worker = nullptr);
+		static void filter(const T* source, const uint8_t* sourceMask, T* target, uint8_t* targetMask, const unsigned int width, const unsigned int height, const unsigned int channels, const unsigned int sourcePaddingElements, const unsigned int sourceMaskPaddingElements, const unsigned int targetPaddingElements, const unsigned int targetMaskPaddingElements, const TFilter* horizontalFilter, const unsigned int horizontalFilterSize, const TFilter* verticalFilter, const unsigned int verticalFilterSize, const uint8_t maskValue = 0x00u, Worker* worker = nullptr, const FrameFilterSeparable::ExecutionMode executionMode = FrameFilterSeparable::EM_AUTOMATIC);
 
 	protected:
 
@@ -157,6 +161,34 @@ class AdvancedFrameFilterSeparable
 		 */
 		template <typename TFilter, typename TTarget>
 		static void filterVerticalSubset(const TFilter* source, TTarget* target, uint8_t* targetMask, const unsigned int width, const unsigned int height, const unsigned int channels, const unsigned int sourcePaddingElements, const unsigned int targetPaddingElements, const unsigned int targetMaskPaddingElements, const TFilter* filter, const unsigned int filterSize, const uint8_t maskValue, const unsigned int firstRow, const unsigned int numberRows);
+
+		/**
+		 * Applies the horizontal and the vertical filtering for a band of rows while holding only a small window of horizontally filtered rows.
+		 * The window holds all rows inside the frame which are needed by the next block of target rows, the last rows of a block are moved to the beginning of the window as they are needed by the next block again.
+		 * @param source The source frame to be filtered, must be valid
+		 * @param sourceMask The mask frame specifying valid and invalid source pixels, must be valid
+		 * @param target The target frame receiving the filtered results, must not be identical with 'source', must be valid
+		 * @param targetMask The mask frame specifying valid and invalid target pixels, must not be identical with 'sourceMask', must be valid
+		 * @param width The width of the source (and target) frame in pixel, with range [horizontalFilterSize/2+1, infinity)
+		 * @param height The height of the source (and target) frame in pixel, with range [verticalFilterSize/2+1, infinity)
+		 * @param channels The number of channels the source frame (and target frame) has, with range [1, infinity)
+		 * @param sourcePaddingElements The number of padding elements at the end of each source row, in elements, with range [0, infinity)
+		 * @param sourceMaskPaddingElements The number of padding elements at the end of each source mask row, in elements, with range [0, infinity)
+		 * @param targetPaddingElements The number of padding elements at the end of each target row, in elements, with range [0, infinity)
+		 * @param targetMaskPaddingElements The number of padding elements at the end of each target mask row, in elements, with range [0, infinity)
+		 * @param horizontalFilter The elements of the horizontal filter, must be valid
+		 * @param horizontalFilterSize The number of elements the horizontal filter has, with range [1, width], must be odd
+		 * @param verticalFilter The elements of the vertical filter, must be valid
+		 * @param verticalFilterSize The number of elements the vertical filter has, with range [1, height], must be odd
+		 * @param maskValue The pixel value for an invalid mask pixel, with range [0, infinity)
+		 * @param windowRows The number of intermediate rows the window can hold, with range [verticalFilterSize, infinity)
+		 * @param firstRow The first row to be handled, with range [0, height)
+		 * @param numberRows The number of rows to be handled, with range [1, height - firstRow]
+		 * @tparam T The data type of each pixel channel of the source frame (and target frame) e.g., 'uint8_t', or 'float'
+		 * @tparam TFilter The data type of each filter elements e.g., 'unsigned int', or 'float'
+		 */
+		template <typename T, typename TFilter>
+		static void filterTiledSubset(const T* source, const uint8_t* sourceMask, T* target, uint8_t* targetMask, const unsigned int width, const unsigned int height, const unsigned int channels, const unsigned int sourcePaddingElements, const unsigned int sourceMaskPaddingElements, const unsigned int targetPaddingElements, const unsigned int targetMaskPaddingElements, const TFilter* horizontalFilter, const unsigned int horizontalFilterSize, const TFilter* verticalFilter, const unsigned int verticalFilterSize, const uint8_t maskValue, const unsigned int windowRows, const unsigned int firstRow, const unsigned int numberRows);
 };
 
 template <typename T, typename TFilter>
@@ -189,7 +221,7 @@ void AdvancedFrameFilterSeparable::filter(T* frame, uint8_t* mask, const unsigne
 }
 
 template <typename T, typename TFilter>
-void AdvancedFrameFilterSeparable::filter(const T* source, const uint8_t* sourceMask, T* target, uint8_t* targetMask, const unsigned int width, const unsigned int height, const unsigned int channels, const unsigned int sourcePaddingElements, const unsigned int sourceMaskPaddingElements, const unsigned int targetPaddingElements, const unsigned int targetMaskPaddingElements, const TFilter* horizontalFilter, const unsigned int horizontalFilterSize, const TFilter* verticalFilter, const unsigned int verticalFilterSize, const uint8_t maskValue, Worker* worker)
+void AdvancedFrameFilterSeparable::filter(const T* source, const uint8_t* sourceMask, T* target, uint8_t* targetMask, const unsigned int width, const unsigned int height, const unsigned int channels, const unsigned int sourcePaddingElements, const unsigned int sourceMaskPaddingElements, const unsigned int targetPaddingElements, const unsigned int targetMaskPaddingElements, const TFilter* horizontalFilter, const unsigned int horizontalFilterSize, const TFilter* verticalFilter, const unsigned int verticalFilterSize, const uint8_t maskValue, Worker* worker, const FrameFilterSeparable::ExecutionMode executionMode)
 {
 	ocean_assert(source != nullptr && sourceMask != nullptr && target != nullptr && targetMask != nullptr);
 
@@ -201,6 +233,24 @@ void AdvancedFrameFilterSeparable::filter(const T* source, const uint8_t* source
 	ocean_assert_and_suppress_unused(width >= horizontalFilterSize_2 + 1u, horizontalFilterSize_2);
 	ocean_assert_and_suppress_unused(height >= verticalFilterSize_2 + 1u, verticalFilterSize_2);
 
+	if (FrameFilterSeparable::useTiledExecution<TFilter>(executionMode, source, target, width, height, channels + 1u) && (const void*)(sourceMask) != (const void*)(targetMask))
+	{
+		// each band of rows is filtered horizontally and vertically while only a small window of intermediate rows needs to be held in the cache
+
+		const unsigned int windowRows = FrameFilterSeparable::tiledWindowRows<TFilter>(width, channels + 1u, verticalFilterSize);
+
+		if (worker)
+		{
+			worker->executeFunction(Worker::Function::createStatic(&filterTiledSubset<T, TFilter>, source, sourceMask, target, targetMask, width, height, channels, sourcePaddingElements, sourceMaskPaddingElements, targetPaddingElements, targetMaskPaddingElements, horizontalFilter, horizontalFilterSize, verticalFilter, verticalFilterSize, maskValue, windowRows, 0u, 0u), 0u, height, 17u, 18u, windowRows);
+		}
+		else
+		{
+			filterTiledSubset<T, TFilter>(source, sourceMask, target, targetMask, width, height, channels, sourcePaddingElements, sourceMaskPaddingElements, targetPaddingElements, targetMaskPaddingElements, horizontalFilter, horizontalFilterSize, verticalFilter, verticalFilterSize, maskValue, windowRows, 0u, height);
+		}
+
+		return;
+	}
+
 	Frame intermediateFrame(FrameType(width, height, FrameType::genericPixelFormat<TFilter>(channels + 1u), FrameType::ORIGIN_UPPER_LEFT));
 
 	// first we apply the horizontal filtering
@@ -217,6 +267,72 @@ void AdvancedFrameFilterSeparable::filter(const T* source, const uint8_t* source
 	}
 }
 
+template <typename T, typename TFilter>
+void AdvancedFrameFilterSeparable::filterTiledSubset(const T* source, const uint8_t* sourceMask, T* target, uint8_t* targetMask, const unsigned int width, const unsigned int height, const unsigned int channels, const unsigned int sourcePaddingElements, const unsigned int sourceMaskPaddingElements, const unsigned int targetPaddingElements, const unsigned int targetMaskPaddingElements, const TFilter* horizontalFilter, const unsigned int horizontalFilterSize, const TFilter* verticalFilter, const unsigned int verticalFilterSize, const uint8_t maskValue, const unsigned int windowRows, const unsigned int firstRow, const unsigned int numberRows)
+{
+	ocean_assert(source != nullptr && sourceMask != nullptr && target != nullptr && targetMask != nullptr);
+	ocean_assert((const void*)(source) != (const void*)(target) && sourceMask != targetMask);
+
+	ocean_assert(verticalFilterSize >= 1u && verticalFilterSize % 2u == 1u);
+	ocean_assert(firstRow + numberRows <= height);
+
+	const unsigned int filterSize_2 = verticalFilterSize / 2u;
+	ocean_assert(windowRows > filterSize_2 * 2u);
+
+	const unsigned int windowRowElements = width * (channels + 1u);
+
+	const unsigned int sourceStrideElements = width * channels + sourcePaddingElements;
+	const unsigned int sourceMaskStrideElements = width + sourceMaskPaddingElements;
+	const unsigned int targetStrideElements = width * channels + targetPaddingElements;
+	const unsigned int targetMaskStrideElements = width + targetMaskPaddingElements;
+
+	// the window holds the horizontal responses of consecutive rows inside the frame without padding, 'windowFirstRow' is the row located at the beginning of the window
+	// as the vertical filter skips all rows outside the frame, the window can be used as a frame with 'windowEndRow - windowFirstRow' rows
+
+	Memory windowMemory = Memory::create<TFilter>(size_t(windowRows) * size_t(windowRowElements));
+	TFilter* const window = windowMemory.data<TFilter>();
+	ocean_assert(window != nullptr);
+
+	unsigned int windowFirstRow = (unsigned int)(std::max(0, int(firstRow) - int(filterSize_2)));
+	unsigned int windowEndRow = windowFirstRow;
+
+	unsigned int row = firstRow;
+
+	while (row < firstRow + numberRows)
+	{
+		const unsigned int blockRows = std::min(windowRows - filterSize_2 * 2u, firstRow + numberRows - row);
+
+		const unsigned int neededFirstRow = (unsigned int)(std::max(0, int(row) - int(filterSize_2)));
+		const unsigned int neededEndRow = std::min(row + blockRows + filterSize_2, height);
+
+		ocean_assert(neededFirstRow >= windowFirstRow);
+		const unsigned int keptRows = windowEndRow > neededFirstRow ? windowEndRow - neededFirstRow : 0u;
+
+		if (keptRows != 0u && neededFirstRow != windowFirstRow)
+		{
+			// the last rows of the previous block are needed again, so we move them to the beginning of the window
+			memmove(window, window + size_t(neededFirstRow - windowFirstRow) * size_t(windowRowElements), size_t(keptRows) * size_t(windowRowElements) * sizeof(TFilter));
+		}
+
+		windowFirstRow = neededFirstRow;
+
+		const unsigned int firstNewRow = neededFirstRow + keptRows;
+
+		if (firstNewRow < neededEndRow)
+		{
+			const unsigned int newRows = neededEndRow - firstNewRow;
+
+			filterHorizontalSubset<T, TFilter>(source + size_t(firstNewRow) * size_t(sourceStrideElements), sourceMask + size_t(firstNewRow) * size_t(sourceMaskStrideElements), window + size_t(keptRows) * size_t(windowRowElements), width, newRows, channels, sourcePaddingElements, sourceMaskPaddingElements, 0u /*targetPaddingElements*/, horizontalFilter, horizontalFilterSize, maskValue, 0u, newRows);
+		}
+
+		windowEndRow = neededEndRow;
+
+		filterVerticalSubset<TFilter, T>(window, target + size_t(windowFirstRow) * size_t(targetStrideElements), targetMask + size_t(windowFirstRow) * size_t(targetMaskStrideElements), width, windowEndRow - windowFirstRow, channels, 0u /*sourcePaddingElements*/, targetPaddingElements, targetMaskPaddingElements, verticalFilter, verticalFilterSize, maskValue, row - windowFirstRow, blockRows);
+
+		row += blockRows;
+	}
+}
+
 template <typename TSource, typename TFilter>
 void AdvancedFrameFilterSeparable::filterHorizontalSubset(const TSource* source, const uint8_t* sourceMask, TFilter* target, const unsigned int width, const unsigned int height, const unsigned int channels, const unsigned int sourcePaddingElements, const unsigned int sourceMaskPaddingElements, const unsigned int targetPaddingElements, const TFilter* filter, const unsigned int filterSize, const uint8_t maskValue, const unsigned int firstRow, const unsigned int numberRows)
 {
@@ -17,6 +17,10 @@
 
 #include "ocean/math/Vector3.h"
 
+#if defined(OCEAN_HARDWARE_NEON_VERSION) && OCEAN_HARDWARE_NEON_VERSION >= 10
+	#include "ocean/cv/NEON.h"
+#endif
+
 namespace Ocean
 {
 
@@ -101,6 +105,29 @@ class OCEAN_CV_ADVANCED_EXPORT ColorChannelMapper
 		 */
 		template <unsigned int tChannels>
 		static void applyLookup8BitsPerChannelSubset(uint8_t* frameData, const unsigned int frameWidth, const unsigned int frameHeight, const unsigned int framePaddingElements, const uint8_t* lookupData, const unsigned int firstRow, const unsigned int numberRows);
+
+#if defined(OCEAN_HARDWARE_NEON_VERSION) && OCEAN_HARDWARE_NEON_VERSION >= 10 && defined(__aarch64__)
+
+		/**
+		 * Maps the colors of one row to new values using individual lookup tables for each channel, blocks of 16 pixels are handled at once.
+		 * @param data The row of the frame to be modified, must be valid
+		 * @param width The width of the row in pixel, with range [1, infinity)
+		 * @param lookupData Pointer to data of the lookup table with interleaved channels, must be valid
+		 * @return The number of pixels which have been handled, all remaining pixels need to be handled by the caller, with range [0, width]
+		 * @tparam tChannels The number of channels the frame has, possible values are 1, 3, 4
+		 */
+		template <unsigned int tChannels>
+		static inline unsigned int applyLookup8BitsPerChannelNEON(uint8_t* data, const unsigned int width, const uint8x16x4_t (&lookupTables)[tChannels][4]);
+
+		/**
+		 * Looks up 16 values in a lookup table with 256 entries.
+		 * @param lookupTable The lookup table, composed of four blocks with 64 entries each
+		 * @param values The 16 values to look up
+		 * @return The resulting 16 values
+		 */
+		static inline uint8x16_t lookup256NEON(const uint8x16x4_t (&lookupTable)[4], const uint8x16_t& values);
+
+#endif // OCEAN_HARDWARE_NEON_VERSION >= 10 && __aarch64__
 };
 
 /**
@@ -193,11 +220,52 @@ void ColorChannelMapper::applyLookup8BitsPerChannelSubset(uint8_t* frameData, co
 
 	const unsigned int frameStrideElements = frameWidth * tChannels + framePaddingElements;
 
+#if defined(OCEAN_HARDWARE_NEON_VERSION) && OCEAN_HARDWARE_NEON_VERSION >= 10 && defined(__aarch64__)
+
+	// the table lookup instructions cover 64 entries, so that we separate the lookup table of each channel into four blocks
+
+	uint8x16x4_t lookupTables[tChannels][4];
+
+	if constexpr (tChannels == 1u || tChannels == 3u || tChannels == 4u)
+	{
+		for (unsigned int c = 0u; c < tChannels; ++c)
+		{
+			uint8_t channelLookupData[256];
+
+			for (unsigned int n = 0u; n < 256u; ++n)
+			{
+				channelLookupData[n] = lookupData[n * tChannels + c];
+			}
+
+			for (unsigned int block = 0u; block < 4u; ++block)
+			{
+				for (unsigned int i = 0u; i < 4u; ++i)
+				{
+					lookupTables[c][block].val[i] = vld1q_u8(channelLookupData + block * 64u + i * 16u);
+				}
+			}
+		}
+	}
+
+#endif // OCEAN_HARDWARE_NEON_VERSION >= 10 && __aarch64__
+
 	for (unsigned int y = firstRow; y < firstRow + numberRows; ++y)
 	{
 		uint8_t* data = frameData + y * frameStrideElements;
 
-		for (unsigned int x = 0u; x < frameWidth; ++x)
+		unsigned int x = 0u;
+
+#if defined(OCEAN_HARDWARE_NEON_VERSION) && OCEAN_HARDWARE_NEON_VERSION >= 10 && defined(__aarch64__)
+
+		if constexpr (tChannels == 1u || tChannels == 3u || tChannels == 4u)
+		{
+			x = applyLookup8BitsPerChannelNEON<tChannels>(data, frameWidth, lookupTables);
+			data += x * tChannels;
+		}
+
+#endif // OCEAN_HARDWARE_NEON_VERSION >= 10 && __aarch64__
+
+		for (; x < frameWidth; ++x)
 		{
 			for (unsigned int c = 0u; c < tChannels; c++)
 			{
@@ -208,6 +276,76 @@ void ColorChannelMapper::applyLookup8BitsPerChannelSubset(uint8_t* frameData, co
 	}
 }
 
+#if defined(OCEAN_HARDWARE_NEON_VERSION) && OCEAN_HARDWARE_NEON_VERSION >= 10 && defined(__aarch64__)
+
+template <unsigned int tChannels>
+inline unsigned int ColorChannelMapper::applyLookup8BitsPerChannelNEON(uint8_t* data, const unsigned int width, const uint8x16x4_t (&lookupTables)[tChannels][4])
+{
+	static_assert(tChannels == 1u || tChannels == 3u || tChannels == 4u, "Invalid channel number!");
+
+	ocean_assert(data != nullptr);
+
+	unsigned int x = 0u;
+
+	while (x + 16u <= width)
+	{
+		if constexpr (tChannels == 1u)
+		{
+			vst1q_u8(data, lookup256NEON(lookupTables[0], vld1q_u8(data)));
+		}
+		else if constexpr (tChannels == 3u)
+		{
+			uint8x16x3_t values_u_8x16x3 = vld3q_u8(data);
+
+			for (unsigned int c = 0u; c < 3u; ++c)
+			{
+				values_u_8x16x3.val[c] = lookup256NEON(lookupTables[c], values_u_8x16x3.val[c]);
+			}
+
+			vst3q_u8(data, values_u_8x16x3);
+		}
+		else
+		{
+			uint8x16x4_t values_u_8x16x4 = vld4q_u8(data);
+
+			for (unsigned int c = 0u; c < 4u; ++c)
+			{
+				values_u_8x16x4.val[c] = lookup256NEON(lookupTables[c], values_u_8x16x4.val[c]);
+			}
+
+			vst4q_u8(data, values_u_8x16x4);
+		}
+
+		data += 16u * tChannels;
+		x += 16u;
+	}
+
+	return x;
+}
+
+inline uint8x16_t ColorChannelMapper::lookup256NEON(const uint8x16x4_t (&lookupTable)[4], const uint8x16_t& values)
+{
+	// indices outside of [0, 63] are ignored by vqtbl4q_u8/vqtbx4q_u8, so that we shift the indices by 64 for each following block
+
+	const uint8x16_t constant_64_u_8x16 = vdupq_n_u8(64u);
+
+	uint8x16_t indices_u_8x16 = values;
+	uint8x16_t result_u_8x16 = vqtbl4q_u8(lookupTable[0], indices_u_8x16);
+
+	indices_u_8x16 = vsubq_u8(indices_u_8x16, constant_64_u_8x16);
+	result_u_8x16 = vqtbx4q_u8(result_u_8x16, lookupTable[1], indices_u_8x16);
+
+	indices_u_8x16 = vsubq_u8(indices_u_8x16, constant_64_u_8x16);
+	result_u_8x16 = vqtbx4q_u8(result_u_8x16, lookupTable[2], indices_u_8x16);
+
+	indices_u_8x16 = vsubq_u8(indices_u_8x16, constant_64_u_8x16);
+	result_u_8x16 = vqtbx4q_u8(result_u_8x16, lookupTable[3], indices_u_8x16);
+
+	return result_u_8x16;
+}
+
+#endif // OCEAN_HARDWARE_NEON_VERSION >= 10 && __aarch64__
+
 }
 
 }
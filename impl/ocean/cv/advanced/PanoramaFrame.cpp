@@ -251,24 +251,23 @@ void PanoramaFrame::panoramaFrame2cameraFrameLookupTable(const PinholeCamera& pi
 {
 	ocean_assert(!lookupTable.isEmpty());
 
-	const Vector2 frameTopLeft(Scalar(panoramaFrameTopLeft.x()), Scalar(panoramaFrameTopLeft.y()));
+	RayLookupTable cameraRays(lookupTable.sizeX(), lookupTable.sizeY(), lookupTable.binsX(), lookupTable.binsY());
+	determineCameraRays(pinholeCamera, cameraRays, fineAdjustment);
+
+	panoramaFrame2cameraFrameLookupTable(cameraRays, orientation, panoramaDimensionWidth, panoramaDimensionHeight, panoramaFrameTopLeft, lookupTable);
+}
+
+void PanoramaFrame::panoramaFrame2cameraFrameLookupTable(const RayLookupTable& cameraRays, const SquareMatrix3& orientation, const unsigned int panoramaDimensionWidth, const unsigned int panoramaDimensionHeight, const PixelPosition& /*panoramaFrameTopLeft*/, LookupTable& lookupTable)
+{
+	ocean_assert(!cameraRays.isEmpty() && !lookupTable.isEmpty());
+	ocean_assert(cameraRays.sizeX() == lookupTable.sizeX() && cameraRays.sizeY() == lookupTable.sizeY());
+	ocean_assert(cameraRays.binsX() == lookupTable.binsX() && cameraRays.binsY() == lookupTable.binsY());
 
 	for (unsigned int y = 0u; y <= lookupTable.binsY(); ++y)
 	{
-		const Scalar cameraPositionY = lookupTable.binTopLeftCornerPositionY(y);
-
 		for (unsigned int x = 0u; x <= lookupTable.binsX(); ++x)
 		{
-			const Scalar cameraPositionX = lookupTable.binTopLeftCornerPositionX(x);
-
-			Vector2 cameraPosition = Vector2(cameraPositionX, cameraPositionY);
-
-			if (fineAdjustment)
-			{
-				cameraPosition += fineAdjustment->bilinearValue(cameraPosition.x(), cameraPosition.y());
-			}
-
-			const Vector3 ray(orientation * pinholeCamera.vector(pinholeCamera.undistort<true>(cameraPosition)));
+			const Vector3 ray(orientation * cameraRays.binTopLeftCornerValue(x, y));
 
 			const Vector2 angle(ray2angleStrict(ray));
 			Vector2 panoramaPosition(angle2pixel(angle, panoramaDimensionWidth, panoramaDimensionHeight));
@@ -324,6 +323,31 @@ void PanoramaFrame::panoramaFrame2cameraFrameLookupTable(const PinholeCamera& pi
 	}
 }
 
+void PanoramaFrame::determineCameraRays(const PinholeCamera& pinholeCamera, RayLookupTable& cameraRays, const LookupTable* fineAdjustment)
+{
+	ocean_assert(pinholeCamera.isValid());
+	ocean_assert(!cameraRays.isEmpty());
+
+	for (unsigned int y = 0u; y <= cameraRays.binsY(); ++y)
+	{
+		const Scalar cameraPositionY = cameraRays.binTopLeftCornerPositionY(y);
+
+		for (unsigned int x = 0u; x <= cameraRays.binsX(); ++x)
+		{
+			const Scalar cameraPositionX = cameraRays.binTopLeftCornerPositionX(x);
+
+			Vector2 cameraPosition = Vector2(cameraPositionX, cameraPositionY);
+
+			if (fineAdjustment)
+			{
+				cameraPosition += fineAdjustment->bilinearValue(cameraPosition.x(), cameraPosition.y());
+			}
+
+			cameraRays.setBinTopLeftCornerValue(x, y, pinholeCamera.vector(pinholeCamera.undistort<true>(cameraPosition)));
+		}
+	}
+}
+
 void PanoramaFrame::cameraFrame2panoramaFrameLookupTable(const PinholeCamera& pinholeCamera, const SquareMatrix3& orientation, const unsigned int panoramaDimensionWidth, const unsigned int panoramaDimensionHeight, const PixelPositionI& panoramaFrameTopLeft, LookupTable& lookupTable, const LookupTable* fineAdjustment)
 {
 	ocean_assert(!lookupTable.isEmpty());
@@ -1261,6 +1285,70 @@ bool PanoramaFrame::panoramaFrame2cameraFrame(const PinholeCamera& pinholeCamera
 	return false;
 }
 
+bool PanoramaFrame::panoramaFrame2cameraFrame(const PinholeCamera& pinholeCamera, const RayLookupTable& cameraRays, const Frame& panoramaFrame, const Frame& panoramaMask, const unsigned int panoramaDimensionWidth, const unsigned int panoramaDimensionHeight, const PixelPosition& panoramaFrameTopLeft, const SquareMatrix3& orientation, Frame& cameraFrame, Frame& cameraMask, const uint8_t maskValue, Worker* worker)
+{
+	ocean_assert(pinholeCamera.isValid() && panoramaFrame.isValid() && panoramaMask.isValid() && !orientation.isSingular());
+	ocean_assert(!cameraRays.isEmpty() && cameraRays.sizeX() == pinholeCamera.width() && cameraRays.sizeY() == pinholeCamera.height());
+
+	ocean_assert(FrameType::formatIsGeneric(panoramaMask.pixelFormat(), FrameType::DT_UNSIGNED_INTEGER_8, 1u));
+	ocean_assert(panoramaMask.pixelOrigin() == panoramaFrame.pixelOrigin());
+
+	if (cameraRays.isEmpty() || cameraRays.sizeX() != pinholeCamera.width() || cameraRays.sizeY() != pinholeCamera.height())
+	{
+		return false;
+	}
+
+	if (!cameraFrame.set(FrameType(pinholeCamera.width(), pinholeCamera.height(), panoramaFrame.pixelFormat(), panoramaFrame.pixelOrigin()), false /*forceOwner*/, true /*forceWritable*/)
+			|| !cameraMask.set(FrameType(pinholeCamera.width(), pinholeCamera.height(), FrameType::FORMAT_Y8, panoramaFrame.pixelOrigin()), false /*forceOwner*/, true /*forceWritable*/))
+	{
+		return false;
+	}
+
+	ocean_assert(panoramaFrame.numberPlanes() == 1u && panoramaFrame.dataType() == FrameType::DT_UNSIGNED_INTEGER_8);
+
+	// the camera rays are independent of the camera orientation, so that we simply need to rotate the rays
+
+	LookupTable lookupTable(cameraRays.sizeX(), cameraRays.sizeY(), cameraRays.binsX(), cameraRays.binsY());
+	panoramaFrame2cameraFrameLookupTable(cameraRays, orientation, panoramaDimensionWidth, panoramaDimensionHeight, panoramaFrameTopLeft, lookupTable);
+
+	switch (panoramaFrame.channels())
+	{
+		case 1u:
+			panoramaFrame2cameraFrameLookup8BitPerChannel<1u>(lookupTable, panoramaFrame.constdata<uint8_t>(), panoramaMask.constdata<uint8_t>(), panoramaFrame.width(), panoramaFrame.height(), panoramaFrame.paddingElements(), panoramaMask.paddingElements(), panoramaDimensionWidth, panoramaDimensionHeight, panoramaFrameTopLeft, cameraFrame.data<uint8_t>(), cameraMask.data<uint8_t>(), cameraFrame.paddingElements(), cameraMask.paddingElements(), maskValue, worker);
+			return true;
+
+		case 2u:
+			panoramaFrame2cameraFrameLookup8BitPerChannel<2u>(lookupTable, panoramaFrame.constdata<uint8_t>(), panoramaMask.constdata<uint8_t>(), panoramaFrame.width(), panoramaFrame.height(), panoramaFrame.paddingElements(), panoramaMask.paddingElements(), panoramaDimensionWidth, panoramaDimensionHeight, panoramaFrameTopLeft, cameraFrame.data<uint8_t>(), cameraMask.data<uint8_t>(), cameraFrame.paddingElements(), cameraMask.paddingElements(), maskValue, worker);
+			return true;
+
+		case 3u:
+			panoramaFrame2cameraFrameLookup8BitPerChannel<3u>(lookupTable, panoramaFrame.constdata<uint8_t>(), panoramaMask.constdata<uint8_t>(), panoramaFrame.width(), panoramaFrame.height(), panoramaFrame.paddingElements(), panoramaMask.paddingElements(), panoramaDimensionWidth, panoramaDimensionHeight, panoramaFrameTopLeft, cameraFrame.data<uint8_t>(), cameraMask.data<uint8_t>(), cameraFrame.paddingElements(), cameraMask.paddingElements(), maskValue, worker);
+			return true;
+
+		case 4u:
+			panoramaFrame2cameraFrameLookup8BitPerChannel<4u>(lookupTable, panoramaFrame.constdata<uint8_t>(), panoramaMask.constdata<uint8_t>(), panoramaFrame.width(), panoramaFrame.height(), panoramaFrame.paddingElements(), panoramaMask.paddingElements(), panoramaDimensionWidth, panoramaDimensionHeight, panoramaFrameTopLeft, cameraFrame.data<uint8_t>(), cameraMask.data<uint8_t>(), cameraFrame.paddingElements(), cameraMask.paddingElements(), maskValue, worker);
+			return true;
+	}
+
+	ocean_assert(false && "Invalid pixel format!");
+	return false;
+}
+
+PanoramaFrame::RayLookupTable PanoramaFrame::cameraRayLookupTable(const PinholeCamera& pinholeCamera, const unsigned int approximationBinSize)
+{
+	ocean_assert(pinholeCamera.isValid());
+	ocean_assert(approximationBinSize >= 2u);
+
+	// we use the same bins as used in panoramaFrame2cameraFrame8BitPerChannel()
+	const unsigned int binsX = min(pinholeCamera.width() / approximationBinSize, pinholeCamera.width() / 4u);
+	const unsigned int binsY = min(pinholeCamera.height() / approximationBinSize, pinholeCamera.height() / 4u);
+
+	RayLookupTable cameraRays(pinholeCamera.width(), pinholeCamera.height(), binsX, binsY);
+	determineCameraRays(pinholeCamera, cameraRays, nullptr);
+
+	return cameraRays;
+}
+
 bool PanoramaFrame::cameraFrame2panoramaFrame(const PinholeCamera& pinholeCamera, const Frame& cameraFrame, const SquareMatrix3& orientation, const unsigned int panoramaDimensionWidth, const unsigned int panoramaDimensionHeight, const PixelPositionI& panoramaFrameTopLeft, Frame& panoramaFrame, Frame& panoramaMask, const uint8_t maskValue, const unsigned int approximationBinSize, Worker* worker, const LookupTable* fineAdjustment)
 {
 	ocean_assert(pinholeCamera.isValid() && !orientation.isSingular() && cameraFrame.isValid() && panoramaFrame.isValid() && panoramaMask.isValid());
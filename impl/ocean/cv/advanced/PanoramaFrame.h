@@ -71,6 +71,13 @@ class OCEAN_CV_ADVANCED_EXPORT PanoramaFrame
 		 */
 		using LookupTable = LookupCorner2<Vector2>;
 
+	public:
+
+		/**
+		 * Definition of a lookup table for 3D vectors, e.g., holding the viewing rays of a camera.
+		 */
+		using RayLookupTable = LookupCorner2<Vector3>;
+
 	public:
 
 		/**
@@ -424,6 +431,37 @@ class OCEAN_CV_ADVANCED_EXPORT PanoramaFrame
 		 */
 		static bool panoramaFrame2cameraFrame(const PinholeCamera& pinholeCamera, const Frame& panoramaFrame, const Frame& panoramaMask, const unsigned int panoramaDimensionWidth, const unsigned int panoramaDimensionHeight, const PixelPosition& panoramaFrameTopLeft, const SquareMatrix3& orientation, Frame& cameraFrame, Frame& cameraMask, const uint8_t maskValue = 0xFFu, const unsigned int approximationBinSize = 20u, Worker* worker = nullptr, const LookupTable* fineAdjustment = nullptr);
 
+		/**
+		 * Copies (interpolates) a section from the entire panorama frame to a camera frame with specified camera orientation using precomputed viewing rays of the camera.
+		 * The viewing rays depend on the camera profile only, so that they can be determined once and reused for all camera frames with identical camera profile.<br>
+		 * The result is identical to the result of the function without precomputed viewing rays (using the same approximation bin size).
+		 * @param pinholeCamera The pinhole camera profile of the resulting camera frame
+		 * @param cameraRays The viewing rays of the camera profile, as determined by cameraRayLookupTable(), must be valid
+		 * @param panoramaFrame The sub-frame of the entire (possible maximal) panorama frame from which the resulting camera frame is created
+		 * @param panoramaMask The mask frame corresponding with the given panorama frame (with same dimension)
+		 * @param panoramaDimensionWidth The maximal width of the entire maximal possible panorama frame, in pixel
+		 * @param panoramaDimensionHeight The maximal height of the entire maximal possible panorama frame, in pixel
+		 * @param panoramaFrameTopLeft The top left position of the given sub-frame of the panorama frame
+		 * @param orientation The orientation of the resulting camera frame
+		 * @param cameraFrame The resulting camera frame, will receive the frame dimension as provided by the camera profile
+		 * @param cameraMask The resulting camera mask, will receive the frame dimension as provided by the camera profile
+		 * @param maskValue The mask value defining a valid mask pixel
+		 * @param worker Optional worker object to distribute the computation
+		 * @return True, if succeeded
+		 * @see cameraRayLookupTable().
+		 */
+		static bool panoramaFrame2cameraFrame(const PinholeCamera& pinholeCamera, const RayLookupTable& cameraRays, const Frame& panoramaFrame, const Frame& panoramaMask, const unsigned int panoramaDimensionWidth, const unsigned int panoramaDimensionHeight, const PixelPosition& panoramaFrameTopLeft, const SquareMatrix3& orientation, Frame& cameraFrame, Frame& cameraMask, const uint8_t maskValue = 0xFFu, Worker* worker = nullptr);
+
+		/**
+		 * Determines the viewing rays of a camera profile for the corners of the bins of a lookup table.
+		 * The rays can be used to create the camera frames of several camera orientations without undistorting the bin corners again.
+		 * @param pinholeCamera The pinhole camera profile for which the rays will be determined, must be valid
+		 * @param approximationBinSize The width/height of a bin in the lookup table, in pixel, with range [2, infinity)
+		 * @return The lookup table with the viewing rays, defined in the (non-flipped) coordinate system of the camera
+		 * @see panoramaFrame2cameraFrame().
+		 */
+		static RayLookupTable cameraRayLookupTable(const PinholeCamera& pinholeCamera, const unsigned int approximationBinSize);
+
 		/**
 		 * Copies (interpolates) the entire area of a camera frame with specified camera orientation to a section of an entire panorama frame.
 		 * @param pinholeCamera The pinhole camera profile of the resulting camera frame
@@ -509,6 +547,29 @@ class OCEAN_CV_ADVANCED_EXPORT PanoramaFrame
 		template <unsigned int tChannels>
 		static inline void panoramaFrame2cameraFrame8BitPerChannel(const PinholeCamera& pinholeCamera, const uint8_t* panoramaFrame, const uint8_t* panoramaMask, const unsigned int panoramaFrameWidth, const unsigned int panoramaFrameHeight, const unsigned int panoramaFramePaddingElements, const unsigned int panoramaMaskPaddingElements, const unsigned int panoramaDimensionWidth, const unsigned int panoramaDimensionHeight, const PixelPosition& panoramaFrameTopLeft, const SquareMatrix3& orientation, uint8_t* cameraFrame, uint8_t* cameraMask, const unsigned int cameraFramePaddingElements, const unsigned int cameraMaskPaddingElements, const uint8_t maskValue = 0xFFu, const unsigned int approximationBinSize = 20u, Worker* worker = nullptr, const LookupTable* fineAdjustment = nullptr);
 
+		/**
+		 * Copies (interpolates) a section from the entire panorama frame with 8 bit per data channel to a camera frame by application of a lookup table.
+		 * @param lookupTable The 2D lookup table mapping positions defined in the camera frame to positions defined in the panorama frame, must be valid
+		 * @param panoramaFrame The sub-frame of the entire (possible maximal) panorama frame from which the resulting camera frame is created
+		 * @param panoramaMask The mask frame corresponding with the given panorama frame (with same dimension)
+		 * @param panoramaFrameWidth The width of the given panorama frame in pixel, with range [1, panoramaDimensionWidth]
+		 * @param panoramaFrameHeight The height of the given panorama frame in pixel, with range [1, panoramaDimensionHeight]
+		 * @param panoramaFramePaddingElements The number of padding elements at the end of each panorama frame row, in elements, with range [0, infinity)
+		 * @param panoramaMaskPaddingElements The number of padding elements at the end of each panorama mask row, in elements, with range [0, infinity)
+		 * @param panoramaDimensionWidth The maximal width of the entire maximal possible panorama frame, in pixel
+		 * @param panoramaDimensionHeight The maximal height of the entire maximal possible panorama frame, in pixel
+		 * @param panoramaFrameTopLeft The top left position of the given sub-frame of the panorama frame
+		 * @param cameraFrame The resulting camera frame with frame dimension as defined by the lookup table
+		 * @param cameraMask The resulting camera mask with frame dimension as defined by the lookup table
+		 * @param cameraFramePaddingElements The number of padding elements at the end of each camera frame row, in elements, with range [0, infinity)
+		 * @param cameraMaskPaddingElements The number of padding elements at the end of each camera mask row, in elements, with range [0, infinity)
+		 * @param maskValue The mask value defining a valid mask pixel
+		 * @param worker Optional worker object to distribute the computation
+		 * @tparam tChannels The number of frame data channels
+		 */
+		template <unsigned int tChannels>
+		static inline void panoramaFrame2cameraFrameLookup8BitPerChannel(const LookupTable& lookupTable, const uint8_t* panoramaFrame, const uint8_t* panoramaMask, const unsigned int panoramaFrameWidth, const unsigned int panoramaFrameHeight, const unsigned int panoramaFramePaddingElements, const unsigned int panoramaMaskPaddingElements, const unsigned int panoramaDimensionWidth, const unsigned int panoramaDimensionHeight, const PixelPosition& panoramaFrameTopLeft, uint8_t* cameraFrame, uint8_t* cameraMask, const unsigned int cameraFramePaddingElements, const unsigned int cameraMaskPaddingElements, const uint8_t maskValue, Worker* worker);
+
 		/**
 		 * Copies (interpolates) the entire area of an 8 bit per data channel camera frame with specified camera orientation to a section of an entire panorama frame.
 		 * @param pinholeCamera The pinhole camera profile of the resulting camera frame
@@ -642,6 +703,25 @@ class OCEAN_CV_ADVANCED_EXPORT PanoramaFrame
 		 */
 		static void panoramaFrame2cameraFrameLookupTable(const PinholeCamera& pinholeCamera, const SquareMatrix3& orientation, const unsigned int panoramaDimensionWidth, const unsigned int panoramaDimensionHeight, const PixelPosition& panoramaFrameTopLeft, LookupTable& lookupTable, const LookupTable* fineAdjustment);
 
+		/**
+		 * Creates a 2D lookup table allowing to interpolate positions defined in the camera frame to positions defined in the panorama sub-frame based on the viewing rays of the camera.
+		 * @param cameraRays The viewing rays of the camera for all bin corners of the lookup table, must be valid
+		 * @param orientation The orientation of the camera
+		 * @param panoramaDimensionWidth The maximal width of the entire maximal possible panorama frame, in pixel
+		 * @param panoramaDimensionHeight The maximal height of the entire maximal possible panorama frame, in pixel
+		 * @param panoramaFrameTopLeft The top left position of the panorama sub-frame
+		 * @param lookupTable The resulting lookup table, with same size and bins as the lookup table with viewing rays
+		 */
+		static void panoramaFrame2cameraFrameLookupTable(const RayLookupTable& cameraRays, const SquareMatrix3& orientation, const unsigned int panoramaDimensionWidth, const unsigned int panoramaDimensionHeight, const PixelPosition& panoramaFrameTopLeft, LookupTable& lookupTable);
+
+		/**
+		 * Determines the viewing rays of a camera profile for the corners of the bins of a lookup table.
+		 * @param pinholeCamera The pinhole camera profile for which the rays will be determined, must be valid
+		 * @param cameraRays The resulting viewing rays, the lookup table must be valid
+		 * @param fineAdjustment Optional transformation lookup table with relative offsets providing a fine adjustment for the camera frame
+		 */
+		static void determineCameraRays(const PinholeCamera& pinholeCamera, RayLookupTable& cameraRays, const LookupTable* fineAdjustment);
+
 		/**
 		 * Creates a 2D lookup table allowing to interpolate positions defined in the entire panorama frame to positions defined in the camera frame.
 		 * @param pinholeCamera The pinhole camera profile of the camera frame
@@ -1479,14 +1559,29 @@ inline void PanoramaFrame::panoramaFrame2cameraFrame8BitPerChannel(const Pinhole
 
 		panoramaFrame2cameraFrameLookupTable(pinholeCamera, orientation, panoramaDimensionWidth, panoramaDimensionHeight, panoramaFrameTopLeft, lookupTable, fineAdjustment);
 
-		if (worker != nullptr)
-		{
-			worker->executeFunction(Worker::Function::createStatic(&panoramaFrame2cameraFrameLookup8BitPerChannelSubset<tChannels>, (const LookupTable*)(&lookupTable), panoramaFrame, panoramaMask, panoramaFramePaddingElements, panoramaMaskPaddingElements, panoramaDimensionWidth, panoramaDimensionHeight, panoramaFrameTopLeft.x(), panoramaFrameTopLeft.y(), panoramaFrameWidth, panoramaFrameHeight, cameraFrame, cameraMask, cameraFramePaddingElements, cameraMaskPaddingElements, maskValue, 0u, 0u), 0u, pinholeCamera.height());
-		}
-		else
-		{
-			panoramaFrame2cameraFrameLookup8BitPerChannelSubset<tChannels>((const LookupTable*)(&lookupTable), panoramaFrame, panoramaMask, panoramaFramePaddingElements, panoramaMaskPaddingElements, panoramaDimensionWidth, panoramaDimensionHeight, panoramaFrameTopLeft.x(), panoramaFrameTopLeft.y(), panoramaFrameWidth, panoramaFrameHeight, cameraFrame, cameraMask, cameraFramePaddingElements, cameraMaskPaddingElements, maskValue, 0u, pinholeCamera.height());
-		}
+		panoramaFrame2cameraFrameLookup8BitPerChannel<tChannels>(lookupTable, panoramaFrame, panoramaMask, panoramaFrameWidth, panoramaFrameHeight, panoramaFramePaddingElements, panoramaMaskPaddingElements, panoramaDimensionWidth, panoramaDimensionHeight, panoramaFrameTopLeft, cameraFrame, cameraMask, cameraFramePaddingElements, cameraMaskPaddingElements, maskValue, worker);
+	}
+}
+
+template <unsigned int tChannels>
+inline void PanoramaFrame::panoramaFrame2cameraFrameLookup8BitPerChannel(const LookupTable& lookupTable, const uint8_t* panoramaFrame, const uint8_t* panoramaMask, const unsigned int panoramaFrameWidth, const unsigned int panoramaFrameHeight, const unsigned int panoramaFramePaddingElements, const unsigned int panoramaMaskPaddingElements, const unsigned int panoramaDimensionWidth, const unsigned int panoramaDimensionHeight, const PixelPosition& panoramaFrameTopLeft, uint8_t* cameraFrame, uint8_t* cameraMask, const unsigned int cameraFramePaddingElements, const unsigned int cameraMaskPaddingElements, const uint8_t maskValue, Worker* worker)
+{
+	static_assert(tChannels >= 1u, "Invalid channel number!");
+
+	ocean_assert(!lookupTable.isEmpty());
+	ocean_assert(panoramaFrame != nullptr && panoramaMask != nullptr);
+	ocean_assert(panoramaFrameWidth != 0u && panoramaFrameHeight != 0u);
+	ocean_assert(cameraFrame != nullptr && cameraMask != nullptr);
+
+	const unsigned int cameraHeight = (unsigned int)(lookupTable.sizeY());
+
+	if (worker != nullptr)
+	{
+		worker->executeFunction(Worker::Function::createStatic(&panoramaFrame2cameraFrameLookup8BitPerChannelSubset<tChannels>, &lookupTable, panoramaFrame, panoramaMask, panoramaFramePaddingElements, panoramaMaskPaddingElements, panoramaDimensionWidth, panoramaDimensionHeight, panoramaFrameTopLeft.x(), panoramaFrameTopLeft.y(), panoramaFrameWidth, panoramaFrameHeight, cameraFrame, cameraMask, cameraFramePaddingElements, cameraMaskPaddingElements, maskValue, 0u, 0u), 0u, cameraHeight);
+	}
+	else
+	{
+		panoramaFrame2cameraFrameLookup8BitPerChannelSubset<tChannels>(&lookupTable, panoramaFrame, panoramaMask, panoramaFramePaddingElements, panoramaMaskPaddingElements, panoramaDimensionWidth, panoramaDimensionHeight, panoramaFrameTopLeft.x(), panoramaFrameTopLeft.y(), panoramaFrameWidth, panoramaFrameHeight, cameraFrame, cameraMask, cameraFramePaddingElements, cameraMaskPaddingElements, maskValue, 0u, cameraHeight);
 	}
 }
 
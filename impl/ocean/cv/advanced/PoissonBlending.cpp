@@ -63,6 +63,99 @@ void PoissonBlending::poissonBlending(const Frame& source, const Frame& sourceMa
 	}
 }
 
+void PoissonBlending::poissonBlendingMultigrid(const Frame& source, const Frame& sourceMask, Frame& target, const int left, const int top, const uint8_t maskValue, Worker* worker, const unsigned int maximalCycles, const float maximalResidual)
+{
+	ocean_assert(source.isValid() && source.numberPlanes() == 1u && source.dataType() == FrameType::DT_UNSIGNED_INTEGER_8);
+	ocean_assert(sourceMask.frameType() == FrameType(source, FrameType::FORMAT_Y8));
+	ocean_assert(target.isValid() && target.pixelFormat() == source.pixelFormat());
+	ocean_assert(maximalCycles >= 1u && maximalResidual >= 0.0f);
+
+	const unsigned int sourceLeft = (unsigned int)(max(0, -left));
+	const unsigned int sourceTop = (unsigned int)(max(0, -top));
+
+	const unsigned int sourceRightEnd = (unsigned int)(minmax(0, int(target.width()) - left, int(source.width())));
+	const unsigned int sourceBottomEnd = (unsigned int)(minmax(0, int(target.height()) - top, int(source.height())));
+
+	const unsigned int targetLeft = (unsigned int)(int(sourceLeft) + left);
+	const unsigned int targetTop = (unsigned int)(int(sourceTop) + top);
+
+	if (sourceLeft >= sourceRightEnd || sourceTop >= sourceBottomEnd)
+	{
+		return;
+	}
+
+	const CV::PixelBoundingBox sourceBoundingBox(sourceLeft, sourceTop, sourceRightEnd - 1u, sourceBottomEnd - 1u);
+	ocean_assert(sourceBoundingBox.isValid());
+
+	// the coarsest layer has at least 4 pixels in each dimension
+
+	const unsigned int minimalSize = std::min(sourceBoundingBox.width(), sourceBoundingBox.height());
+
+	unsigned int layers = 1u;
+	while (layers < 12u && (minimalSize >> layers) >= 4u)
+	{
+		++layers;
+	}
+
+	// the grid is extended by a margin so that the dimensions of all layers are exact multiples and so that unknown pixels never lie at the border of any layer
+
+	const unsigned int layerFactor = 1u << (layers - 1u);
+	const unsigned int margin = layerFactor;
+
+	const unsigned int gridWidth = (sourceBoundingBox.width() + 2u * margin + layerFactor - 1u) / layerFactor * layerFactor;
+	const unsigned int gridHeight = (sourceBoundingBox.height() + 2u * margin + layerFactor - 1u) / layerFactor * layerFactor;
+
+	FramePyramid domainPyramid(layers, FrameType(gridWidth, gridHeight, FrameType::FORMAT_Y8, FrameType::ORIGIN_UPPER_LEFT));
+	FramePyramid coefficientPyramid(layers, FrameType(gridWidth, gridHeight, FrameType::genericPixelFormat<float, 2u>(), FrameType::ORIGIN_UPPER_LEFT));
+	FramePyramid rightHandSidePyramid(layers, FrameType(gridWidth, gridHeight, FrameType::FORMAT_F32, FrameType::ORIGIN_UPPER_LEFT));
+	FramePyramid solutionPyramid(layers, FrameType(gridWidth, gridHeight, FrameType::FORMAT_F32, FrameType::ORIGIN_UPPER_LEFT));
+
+	ocean_assert(domainPyramid.layers() == layers && coefficientPyramid.layers() == layers);
+	ocean_assert(rightHandSidePyramid.layers() == layers && solutionPyramid.layers() == layers);
+
+	std::vector<IndexPairs32> rowRanges;
+	if (createMultigridDomain(sourceMask, sourceBoundingBox, targetLeft, targetTop, target.width(), target.height(), maskValue, margin, domainPyramid, coefficientPyramid, rowRanges) == 0)
+	{
+		return;
+	}
+
+	const Frame& domain = domainPyramid.finestLayer();
+	const Frame& solution = solutionPyramid.finestLayer();
+
+	const unsigned int channels = target.channels();
+
+	for (unsigned int channelIndex = 0u; channelIndex < channels; ++channelIndex)
+	{
+		createMultigridRightHandSide(domain, source, target, sourceBoundingBox, targetLeft, targetTop, margin, channelIndex, rightHandSidePyramid.finestLayer(), solutionPyramid.finestLayer());
+
+		for (unsigned int nCycle = 0u; nCycle < maximalCycles; ++nCycle)
+		{
+			if (multigridVCycle(coefficientPyramid, rowRanges, rightHandSidePyramid, solutionPyramid, 0u, worker) <= maximalResidual)
+			{
+				break;
+			}
+		}
+
+		for (unsigned int y = 0u; y < sourceBoundingBox.height(); ++y)
+		{
+			const uint8_t* domainRow = domain.constrow<uint8_t>(y + margin) + margin;
+			const float* solutionRow = solution.constrow<float>(y + margin) + margin;
+
+			uint8_t* targetPixel = target.pixel<uint8_t>(targetLeft, targetTop + y) + channelIndex;
+
+			for (unsigned int x = 0u; x < sourceBoundingBox.width(); ++x)
+			{
+				if (domainRow[x] == 0x02u)
+				{
+					*targetPixel = uint8_t(minmax(0.0f, solutionRow[x] + 0.5f, 255.0f));
+				}
+
+				targetPixel += channels;
+			}
+		}
+	}
+}
+
 void PoissonBlending::poissonBlendingSubset(const Frame* indexLookup, const Frame* source, Frame* target, const SparseMatrixF* matrixA, const CV::PixelBoundingBox* sourceBoundingBox, const unsigned int targetLeft, const unsigned int targetTop, const unsigned int firstChannel, const unsigned int channelCount)
 {
 	ocean_assert(indexLookup && indexLookup->isValid());
@@ -195,7 +288,7 @@ void PoissonBlending::createSummedBorderLaplacianVector(const Frame& indexLookup
 
 	ocean_assert(vectorB.rows() > 0u && vectorB.columns() == 1u);
 
-	const unsigned int sourceStrideElements = source.width() * source.channels();
+	const unsigned int sourceStrideElements = source.strideElements();
 	const unsigned int targetStrideElements = target.strideElements();
 	const unsigned int indexLookupStrideElements = indexLookup.strideElements();
 
@@ -278,6 +371,441 @@ void PoissonBlending::createSummedBorderLaplacianVector(const Frame& indexLookup
 	ocean_assert(bData == vectorB.data() + vectorB.rows());
 }
 
+size_t PoissonBlending::createMultigridDomain(const Frame& sourceMask, const CV::PixelBoundingBox& sourceBoundingBox, const unsigned int targetLeft, const unsigned int targetTop, const unsigned int targetWidth, const unsigned int targetHeight, const uint8_t maskValue, const unsigned int margin, FramePyramid& domainPyramid, FramePyramid& coefficientPyramid, std::vector<IndexPairs32>& rowRanges)
+{
+	ocean_assert(sourceMask.pixelFormat() == FrameType::FORMAT_Y8);
+	ocean_assert(sourceBoundingBox.isValid() && sourceBoundingBox.right() < sourceMask.width() && sourceBoundingBox.bottom() < sourceMask.height());
+	ocean_assert(margin >= 1u);
+
+	ocean_assert(domainPyramid.isValid() && domainPyramid.finestLayer().pixelFormat() == FrameType::FORMAT_Y8);
+	ocean_assert(coefficientPyramid.layers() == domainPyramid.layers());
+
+	Frame& domain = domainPyramid.finestLayer();
+
+	size_t unknowns = 0;
+
+	for (unsigned int y = 0u; y < domain.height(); ++y)
+	{
+		uint8_t* const domainRow = domain.row<uint8_t>(y);
+
+		const int ySource = int(sourceBoundingBox.top() + y) - int(margin);
+		const int yTarget = int(targetTop + y) - int(margin);
+
+		for (unsigned int x = 0u; x < domain.width(); ++x)
+		{
+			const int xSource = int(sourceBoundingBox.left() + x) - int(margin);
+			const int xTarget = int(targetLeft + x) - int(margin);
+
+			uint8_t value = 0x00u;
+
+			if (xTarget >= 0 && xTarget < int(targetWidth) && yTarget >= 0 && yTarget < int(targetHeight))
+			{
+				value = 0x01u;
+
+				if (sourceBoundingBox.isInside(CV::PixelPosition((unsigned int)(xSource), (unsigned int)(ySource))) && sourceMask.constpixel<uint8_t>((unsigned int)(xSource), (unsigned int)(ySource))[0] == maskValue)
+				{
+					value = 0x02u;
+					++unknowns;
+				}
+			}
+
+			domainRow[x] = value;
+		}
+	}
+
+	for (unsigned int layerIndex = 1u; layerIndex < domainPyramid.layers(); ++layerIndex)
+	{
+		const Frame& finerDomain = domainPyramid[layerIndex - 1u];
+		Frame& coarserDomain = domainPyramid[layerIndex];
+
+		ocean_assert(coarserDomain.width() * 2u == finerDomain.width() && coarserDomain.height() * 2u == finerDomain.height());
+
+		for (unsigned int y = 0u; y < coarserDomain.height(); ++y)
+		{
+			const uint8_t* const finerRow0 = finerDomain.constrow<uint8_t>(y * 2u + 0u);
+			const uint8_t* const finerRow1 = finerDomain.constrow<uint8_t>(y * 2u + 1u);
+
+			uint8_t* const coarserRow = coarserDomain.row<uint8_t>(y);
+
+			for (unsigned int x = 0u; x < coarserDomain.width(); ++x)
+			{
+				// a coarser pixel is unknown if all child pixels inside the target frame are unknown, so that the known boundary does not move outwards on coarser layers
+
+				const uint8_t child0 = finerRow0[x * 2u + 0u];
+				const uint8_t child1 = finerRow0[x * 2u + 1u];
+				const uint8_t child2 = finerRow1[x * 2u + 0u];
+				const uint8_t child3 = finerRow1[x * 2u + 1u];
+
+				const uint8_t maximalChild = std::max(std::max(child0, child1), std::max(child2, child3));
+
+				if (maximalChild == 0x02u && child0 != 0x01u && child1 != 0x01u && child2 != 0x01u && child3 != 0x01u)
+				{
+					coarserRow[x] = 0x02u;
+				}
+				else
+				{
+					coarserRow[x] = std::min(maximalChild, uint8_t(0x01u));
+				}
+			}
+		}
+	}
+
+	rowRanges.resize(domainPyramid.layers());
+
+	for (unsigned int layerIndex = 0u; layerIndex < domainPyramid.layers(); ++layerIndex)
+	{
+		const Frame& layerDomain = domainPyramid[layerIndex];
+		Frame& coefficients = coefficientPyramid[layerIndex];
+
+		ocean_assert(coefficients.width() == layerDomain.width() && coefficients.height() == layerDomain.height());
+
+		IndexPairs32& layerRowRanges = rowRanges[layerIndex];
+		layerRowRanges.assign(layerDomain.height(), IndexPair32(0u, 0u));
+
+		coefficients.setValue(0x00u);
+
+		for (unsigned int y = 0u; y < layerDomain.height(); ++y)
+		{
+			const uint8_t* const domainRow = layerDomain.constrow<uint8_t>(y);
+			float* const coefficientRow = coefficients.row<float>(y);
+
+			IndexPair32& rowRange = layerRowRanges[y];
+
+			for (unsigned int x = 0u; x < layerDomain.width(); ++x)
+			{
+				if (domainRow[x] == 0x02u)
+				{
+					// unknown pixels never lie at the border of the layer
+					ocean_assert(x >= 1u && y >= 1u && x + 1u < layerDomain.width() && y + 1u < layerDomain.height());
+
+					const uint8_t* const domainRowTop = domainRow - layerDomain.strideElements();
+					const uint8_t* const domainRowBottom = domainRow + layerDomain.strideElements();
+
+					const unsigned int count = (domainRow[x - 1u] != 0x00u ? 1u : 0u) + (domainRow[x + 1u] != 0x00u ? 1u : 0u) + (domainRowTop[x] != 0x00u ? 1u : 0u) + (domainRowBottom[x] != 0x00u ? 1u : 0u);
+
+					if (count != 0u)
+					{
+						coefficientRow[x * 2u + 0u] = float(count);
+						coefficientRow[x * 2u + 1u] = 1.0f / float(count);
+					}
+
+					if (rowRange.first == rowRange.second)
+					{
+						rowRange.first = x;
+					}
+
+					rowRange.second = x + 1u;
+				}
+			}
+		}
+	}
+
+	return unknowns;
+}
+
+void PoissonBlending::createMultigridRightHandSide(const Frame& domain, const Frame& source, const Frame& target, const CV::PixelBoundingBox& sourceBoundingBox, const unsigned int targetLeft, const unsigned int targetTop, const unsigned int margin, const unsigned int channelIndex, Frame& rightHandSide, Frame& solution)
+{
+	ocean_assert(domain.isValid() && domain.pixelFormat() == FrameType::FORMAT_Y8);
+
+	ocean_assert(source.isValid() && source.numberPlanes() == 1u && source.dataType() == FrameType::DT_UNSIGNED_INTEGER_8);
+	ocean_assert(target.isValid() && target.pixelFormat() == source.pixelFormat());
+
+	ocean_assert(sourceBoundingBox.isValid() && sourceBoundingBox.right() < source.width() && sourceBoundingBox.bottom() < source.height());
+	ocean_assert(domain.width() >= sourceBoundingBox.width() + 2u * margin && domain.height() >= sourceBoundingBox.height() + 2u * margin);
+
+	ocean_assert(rightHandSide.isValid() && rightHandSide.frameType() == FrameType(domain, FrameType::FORMAT_F32));
+	ocean_assert(solution.isValid() && solution.frameType() == rightHandSide.frameType());
+
+	const unsigned int channels = source.channels();
+	ocean_assert(channelIndex < channels);
+
+	rightHandSide.setValue(0x00u);
+	solution.setValue(0x00u);
+
+	const unsigned int sourceStrideElements = source.strideElements();
+	const unsigned int targetStrideElements = target.strideElements();
+	const unsigned int domainStrideElements = domain.strideElements();
+
+	for (unsigned int y = 0u; y < sourceBoundingBox.height(); ++y)
+	{
+		const unsigned int ySource = y + sourceBoundingBox.top();
+
+		const uint8_t* domainPixel = domain.constpixel<uint8_t>(margin, y + margin);
+
+		const uint8_t* sourcePixel = source.constpixel<uint8_t>(sourceBoundingBox.left(), ySource) + channelIndex;
+		const uint8_t* targetPixel = target.constpixel<uint8_t>(targetLeft, y + targetTop) + channelIndex;
+
+		float* const rightHandSideRow = rightHandSide.row<float>(y + margin) + margin;
+		float* const solutionRow = solution.row<float>(y + margin) + margin;
+
+		for (unsigned int x = 0u; x < sourceBoundingBox.width(); ++x)
+		{
+			const unsigned int xSource = x + sourceBoundingBox.left();
+
+			if (*domainPixel == 0x02u)
+			{
+				float sourceValue = 0.0f;
+				float targetValue = 0.0f;
+				unsigned int count = 0u;
+
+				if (xSource > sourceBoundingBox.left())
+				{
+					sourceValue -= *(sourcePixel - channels);
+					++count;
+				}
+
+				if (xSource < sourceBoundingBox.right())
+				{
+					sourceValue -= *(sourcePixel + channels);
+					++count;
+				}
+
+				if (ySource > sourceBoundingBox.top())
+				{
+					sourceValue -= *(sourcePixel - sourceStrideElements);
+					++count;
+				}
+
+				if (ySource < sourceBoundingBox.bottom())
+				{
+					sourceValue -= *(sourcePixel + sourceStrideElements);
+					++count;
+				}
+
+				// known pixels are always inside the target frame
+
+				if (*(domainPixel - 1) == 0x01u)
+				{
+					targetValue += *(targetPixel - channels);
+				}
+
+				if (*(domainPixel + 1) == 0x01u)
+				{
+					targetValue += *(targetPixel + channels);
+				}
+
+				if (*(domainPixel - domainStrideElements) == 0x01u)
+				{
+					targetValue += *(targetPixel - targetStrideElements);
+				}
+
+				if (*(domainPixel + domainStrideElements) == 0x01u)
+				{
+					targetValue += *(targetPixel + targetStrideElements);
+				}
+
+				rightHandSideRow[x] = targetValue + float(*sourcePixel * count) + sourceValue;
+
+				// the source pixel is a good initial guess as the solution has the same gradients
+				solutionRow[x] = float(*sourcePixel);
+			}
+
+			++domainPixel;
+			sourcePixel += channels;
+			targetPixel += channels;
+		}
+	}
+}
+
+float PoissonBlending::multigridVCycle(const FramePyramid& coefficientPyramid, const std::vector<IndexPairs32>& rowRanges, FramePyramid& rightHandSidePyramid, FramePyramid& solutionPyramid, const unsigned int layerIndex, Worker* worker)
+{
+	ocean_assert(layerIndex < solutionPyramid.layers());
+	ocean_assert(coefficientPyramid.layers() == solutionPyramid.layers() && rightHandSidePyramid.layers() == solutionPyramid.layers());
+	ocean_assert(rowRanges.size() == solutionPyramid.layers());
+
+	const Frame& coefficients = coefficientPyramid[layerIndex];
+	const IndexPairs32& layerRowRanges = rowRanges[layerIndex];
+	const Frame& rightHandSide = rightHandSidePyramid[layerIndex];
+	Frame& solution = solutionPyramid[layerIndex];
+
+	const unsigned int height = solution.height();
+
+	const auto smooth = [&](const unsigned int iterations)
+	{
+		for (unsigned int n = 0u; n < iterations; ++n)
+		{
+			for (unsigned int color = 0u; color < 2u; ++color)
+			{
+				if (worker)
+				{
+					worker->executeFunction(Worker::Function::createStatic(&PoissonBlending::multigridSmoothSubset, &coefficients, &layerRowRanges, &rightHandSide, &solution, color, 0u, 0u), 0u, height, 5u, 6u, 32u);
+				}
+				else
+				{
+					multigridSmoothSubset(&coefficients, &layerRowRanges, &rightHandSide, &solution, color, 0u, height);
+				}
+			}
+		}
+	};
+
+	if (layerIndex + 1u == solutionPyramid.layers())
+	{
+		// the coarsest layer is small enough to be solved with Gauss-Seidel iterations only
+
+		smooth(32u);
+
+		return 0.0f;
+	}
+
+	smooth(2u);
+
+	Frame& coarserRightHandSide = rightHandSidePyramid[layerIndex + 1u];
+	Frame& coarserSolution = solutionPyramid[layerIndex + 1u];
+
+	coarserSolution.setValue(0x00u);
+
+	std::vector<float> maximalResiduals(coarserRightHandSide.height(), 0.0f);
+
+	if (worker)
+	{
+		worker->executeFunction(Worker::Function::createStatic(&PoissonBlending::multigridRestrictResidualSubset, &coefficients, &layerRowRanges, &rightHandSide, (const Frame*)(&solution), &coarserRightHandSide, maximalResiduals.data(), 0u, 0u), 0u, coarserRightHandSide.height(), 6u, 7u, 16u);
+	}
+	else
+	{
+		multigridRestrictResidualSubset(&coefficients, &layerRowRanges, &rightHandSide, &solution, &coarserRightHandSide, maximalResiduals.data(), 0u, coarserRightHandSide.height());
+	}
+
+	multigridVCycle(coefficientPyramid, rowRanges, rightHandSidePyramid, solutionPyramid, layerIndex + 1u, worker);
+
+	if (worker)
+	{
+		worker->executeFunction(Worker::Function::createStatic(&PoissonBlending::multigridProlongateSubset, &coefficients, &layerRowRanges, (const Frame*)(&coarserSolution), &solution, 0u, 0u), 0u, height, 4u, 5u, 32u);
+	}
+	else
+	{
+		multigridProlongateSubset(&coefficients, &layerRowRanges, &coarserSolution, &solution, 0u, height);
+	}
+
+	smooth(2u);
+
+	return *std::max_element(maximalResiduals.cbegin(), maximalResiduals.cend());
+}
+
+void PoissonBlending::multigridSmoothSubset(const Frame* coefficients, const IndexPairs32* rowRanges, const Frame* rightHandSide, Frame* solution, const unsigned int color, const unsigned int firstRow, const unsigned int numberRows)
+{
+	ocean_assert(coefficients != nullptr && rowRanges != nullptr && rightHandSide != nullptr && solution != nullptr);
+	ocean_assert(color <= 1u);
+	ocean_assert(firstRow + numberRows <= solution->height());
+
+	const unsigned int solutionStrideElements = solution->strideElements();
+
+	for (unsigned int y = firstRow; y < firstRow + numberRows; ++y)
+	{
+		const IndexPair32& rowRange = (*rowRanges)[y];
+
+		if (rowRange.first >= rowRange.second)
+		{
+			continue;
+		}
+
+		const float* const coefficientRow = coefficients->constrow<float>(y);
+		const float* const rightHandSideRow = rightHandSide->constrow<float>(y);
+		float* const solutionRow = solution->row<float>(y);
+
+		// unknown pixels never lie at the border of the layer
+		const float* const solutionRowTop = solutionRow - solutionStrideElements;
+		const float* const solutionRowBottom = solutionRow + solutionStrideElements;
+
+		// pixels which are not unknown have zero right-hand side, zero inverse diagonal and zero solution, so that they stay zero
+
+		for (unsigned int x = rowRange.first + ((rowRange.first + y + color) & 1u); x < rowRange.second; x += 2u)
+		{
+			const float neighbors = solutionRow[x - 1u] + solutionRow[x + 1u] + solutionRowTop[x] + solutionRowBottom[x];
+
+			solutionRow[x] = (rightHandSideRow[x] + neighbors) * coefficientRow[x * 2u + 1u];
+		}
+	}
+}
+
+void PoissonBlending::multigridRestrictResidualSubset(const Frame* coefficients, const IndexPairs32* rowRanges, const Frame* rightHandSide, const Frame* solution, Frame* coarserRightHandSide, float* maximalResiduals, const unsigned int firstCoarserRow, const unsigned int numberCoarserRows)
+{
+	ocean_assert(coefficients != nullptr && rowRanges != nullptr && rightHandSide != nullptr && solution != nullptr);
+	ocean_assert(coarserRightHandSide != nullptr && maximalResiduals != nullptr);
+	ocean_assert(firstCoarserRow + numberCoarserRows <= coarserRightHandSide->height());
+
+	const unsigned int solutionStrideElements = solution->strideElements();
+
+	for (unsigned int yCoarser = firstCoarserRow; yCoarser < firstCoarserRow + numberCoarserRows; ++yCoarser)
+	{
+		float* const coarserRow = coarserRightHandSide->row<float>(yCoarser);
+		memset(coarserRow, 0, coarserRightHandSide->planeWidthBytes(0u));
+
+		float maximalResidual = 0.0f;
+
+		for (unsigned int y = yCoarser * 2u; y < yCoarser * 2u + 2u; ++y)
+		{
+			const IndexPair32& rowRange = (*rowRanges)[y];
+
+			if (rowRange.first >= rowRange.second)
+			{
+				continue;
+			}
+
+			const float* const coefficientRow = coefficients->constrow<float>(y);
+			const float* const rightHandSideRow = rightHandSide->constrow<float>(y);
+			const float* const solutionRow = solution->constrow<float>(y);
+			const float* const solutionRowTop = solutionRow - solutionStrideElements;
+			const float* const solutionRowBottom = solutionRow + solutionStrideElements;
+
+			for (unsigned int x = rowRange.first; x < rowRange.second; ++x)
+			{
+				const float diagonal = coefficientRow[x * 2u + 0u];
+
+				if (diagonal != 0.0f)
+				{
+					const float neighbors = solutionRow[x - 1u] + solutionRow[x + 1u] + solutionRowTop[x] + solutionRowBottom[x];
+
+					const float residual = rightHandSideRow[x] + neighbors - diagonal * solutionRow[x];
+
+					maximalResidual = std::max(maximalResidual, NumericF::abs(residual));
+
+					// the coarser layer uses the same 5-point stencil without scaling, so that the residuals of the four child pixels are summed
+					coarserRow[x / 2u] += residual;
+				}
+			}
+		}
+
+		maximalResiduals[yCoarser] = maximalResidual;
+	}
+}
+
+void PoissonBlending::multigridProlongateSubset(const Frame* coefficients, const IndexPairs32* rowRanges, const Frame* coarserSolution, Frame* solution, const unsigned int firstRow, const unsigned int numberRows)
+{
+	ocean_assert(coefficients != nullptr && rowRanges != nullptr && coarserSolution != nullptr && solution != nullptr);
+	ocean_assert(firstRow + numberRows <= solution->height());
+
+	for (unsigned int y = firstRow; y < firstRow + numberRows; ++y)
+	{
+		const IndexPair32& rowRange = (*rowRanges)[y];
+
+		if (rowRange.first >= rowRange.second)
+		{
+			continue;
+		}
+
+		// bilinear interpolation between the parent pixel and the three closest coarser pixels, the parent of an unknown pixel never lies at the border of the coarser layer
+
+		const unsigned int yCoarser = y / 2u;
+		const unsigned int yCoarserNeighbor = (y & 1u) ? yCoarser + 1u : yCoarser - 1u;
+
+		const float* const coefficientRow = coefficients->constrow<float>(y);
+		const float* const coarserSolutionRow = coarserSolution->constrow<float>(yCoarser);
+		const float* const coarserSolutionNeighborRow = coarserSolution->constrow<float>(yCoarserNeighbor);
+		float* const solutionRow = solution->row<float>(y);
+
+		for (unsigned int x = rowRange.first; x < rowRange.second; ++x)
+		{
+			if (coefficientRow[x * 2u + 0u] != 0.0f)
+			{
+				const unsigned int xCoarser = x / 2u;
+				const unsigned int xCoarserNeighbor = (x & 1u) ? xCoarser + 1u : xCoarser - 1u;
+
+				solutionRow[x] += (coarserSolutionRow[xCoarser] * 9.0f + (coarserSolutionRow[xCoarserNeighbor] + coarserSolutionNeighborRow[xCoarser]) * 3.0f + coarserSolutionNeighborRow[xCoarserNeighbor]) * 0.0625f;
+			}
+		}
+	}
+}
+
 void PoissonBlending::insertResultDataToChannel(const Frame& indexLookup, const MatrixF& vectorX, const CV::PixelBoundingBox& sourceBoundingBox, const unsigned int targetLeft, const unsigned int targetTop, const unsigned int channelIndex, Frame& target)
 {
 	ocean_assert(indexLookup.isValid() && indexLookup.pixelFormat() == FrameType::FORMAT_Y32);
@@ -13,6 +13,7 @@
 #include "ocean/base/Frame.h"
 #include "ocean/base/Worker.h"
 
+#include "ocean/cv/FramePyramid.h"
 #include "ocean/cv/PixelBoundingBox.h"
 
 #include "ocean/math/SparseMatrix.h"
@@ -52,8 +53,114 @@ class OCEAN_CV_ADVANCED_EXPORT PoissonBlending
 		 */
 		static void poissonBlending(const Frame& source, const Frame& sourceMask, Frame& target, const int left, const int top, const uint8_t maskValue = 0xFFu, Worker* worker = nullptr);
 
+		/**
+		 * Performs Poisson Blending of the specified source frame into the specified target frame while solving the Poisson equation with a multigrid solver.
+		 * The function creates the same result as poissonBlending() (up to rounding), but the computational effort is almost linear in the number of blended pixels so that large regions can be blended significantly faster.<br>
+		 * The Poisson equation is solved with multigrid V-cycles on a pyramid of grids, applying red-black Gauss-Seidel smoothing on each pyramid layer.<br>
+		 * The source frame in must not overlap with the border of the target frame for the specified insert position.<br>
+		 * Source frame and source mask frame should have the same dimensions.<br>
+		 * Only pixels with the specified mask value are considered to be inside of the source mask.
+		 * @param source The source frame, pixel format must be 8 bit per color channel, must be valid
+		 * @param sourceMask Mask of source frame, pixel format must be Y8, must be valid
+		 * @param target The target frame into which the source frame is blended, the pixel format must be identical to the source frame, must be valid
+		 * @param left Specifies the horizontal position of the left border of the inserted source frame in pixel, with range (-infinity, infinity)
+		 * @param top Specifies the vertical position of the top border of the inserted source frame in pixel, with range (-infinity, infinity)
+		 * @param maskValue The value of mask pixels to be considered inside of the source content that will be blended
+		 * @param worker Optional worker object to distribute the computational load
+		 * @param maximalCycles The maximal number of V-cycles to be applied for each color channel, with range [1, infinity)
+		 * @param maximalResidual The maximal residual of the Poisson equation at which the solver stops before all V-cycles have been applied, with range [0, infinity)
+		 */
+		static void poissonBlendingMultigrid(const Frame& source, const Frame& sourceMask, Frame& target, const int left, const int top, const uint8_t maskValue = 0xFFu, Worker* worker = nullptr, const unsigned int maximalCycles = 20u, const float maximalResidual = 0.01f);
+
 	protected:
 
+		/**
+		 * Creates the domain of the multigrid solver for each pyramid layer.
+		 * The domain of the finest layer covers the source bounding box plus a margin of 'margin' pixels, the domain pixel (x, y) corresponds with the source pixel (sourceBoundingBox.left() + x - margin, sourceBoundingBox.top() + y - margin).<br>
+		 * Each domain pixel is 0x02 for unknown pixels (source mask pixels), 0x01 for known pixels (pixels inside the target frame), and 0x00 for pixels outside of the target frame.<br>
+		 * A pixel of a coarser layer is unknown if all corresponding finer pixels inside the target frame are unknown, it is known if any corresponding finer pixel is inside the target frame, and 0x00 otherwise.
+		 * @param sourceMask The mask of the source frame, pixel format must be Y8, must be valid
+		 * @param sourceBoundingBox The source bounding box, must be valid
+		 * @param targetLeft Left border of insert region in the target frame
+		 * @param targetTop Top border of insert region in the target frame
+		 * @param targetWidth Width of target frame in pixels
+		 * @param targetHeight Height of target frame in pixels
+		 * @param maskValue The value of mask pixels to be considered inside of the source mask
+		 * @param margin The margin around the source bounding box in the finest layer, in pixel, with range [1, infinity)
+		 * @param domainPyramid The pyramid receiving the domain, with pixel format FORMAT_Y8, must be valid
+		 * @param coefficientPyramid The resulting pyramid with the diagonal elements of the Poisson equation and their inverse for each pixel, with two channels and data type DT_SIGNED_FLOAT_32, zero for pixels which are not unknown, must be valid
+		 * @param rowRanges The resulting first and end column of the unknown pixels for each row and each pyramid layer, (0, 0) for rows without unknown pixels
+		 * @return The number of unknown pixels in the finest layer
+		 */
+		static size_t createMultigridDomain(const Frame& sourceMask, const CV::PixelBoundingBox& sourceBoundingBox, const unsigned int targetLeft, const unsigned int targetTop, const unsigned int targetWidth, const unsigned int targetHeight, const uint8_t maskValue, const unsigned int margin, FramePyramid& domainPyramid, FramePyramid& coefficientPyramid, std::vector<IndexPairs32>& rowRanges);
+
+		/**
+		 * Creates the right-hand side of the Poisson equation and the initial solution in the finest multigrid layer for one color channel.
+		 * The right-hand side is identical to the vector determined by createSummedBorderLaplacianVector().
+		 * @param domain The domain of the finest layer, must be valid
+		 * @param source The source frame, pixel format must be 8 bit per color channel, must be valid
+		 * @param target The target frame into which the source frame is blended, Pixel format must be identical to the source frame, must be valid
+		 * @param sourceBoundingBox The source bounding box, must be valid
+		 * @param targetLeft Left border of insert region in the target frame
+		 * @param targetTop Top border of insert region in the target frame
+		 * @param margin The margin around the source bounding box in the finest layer, in pixel, with range [1, infinity)
+		 * @param channelIndex The index of the color channel, with range [0, target.channels())
+		 * @param rightHandSide The resulting right-hand side, with pixel format FORMAT_F32 and same resolution as the domain, zero for pixels which are not unknown
+		 * @param solution The resulting initial solution, with pixel format FORMAT_F32 and same resolution as the domain, zero for pixels which are not unknown
+		 */
+		static void createMultigridRightHandSide(const Frame& domain, const Frame& source, const Frame& target, const CV::PixelBoundingBox& sourceBoundingBox, const unsigned int targetLeft, const unsigned int targetTop, const unsigned int margin, const unsigned int channelIndex, Frame& rightHandSide, Frame& solution);
+
+		/**
+		 * Applies one multigrid V-cycle starting at a specific pyramid layer.
+		 * @param coefficientPyramid The pyramid with the diagonal elements and their inverse, must be valid
+		 * @param rowRanges The ranges of unknown pixels for each row and each pyramid layer
+		 * @param rightHandSidePyramid The pyramid with the right-hand sides, the right-hand sides of coarser layers will be set during the V-cycle, must be valid
+		 * @param solutionPyramid The pyramid with the solutions to be improved, must be valid
+		 * @param layerIndex The index of the pyramid layer at which the V-cycle starts, with range [0, solutionPyramid.layers() - 1]
+		 * @param worker Optional worker object to distribute the computational load
+		 * @return The maximal absolute residual of the layer before the V-cycle has been applied, 0 if the layer is the coarsest layer
+		 */
+		static float multigridVCycle(const FramePyramid& coefficientPyramid, const std::vector<IndexPairs32>& rowRanges, FramePyramid& rightHandSidePyramid, FramePyramid& solutionPyramid, const unsigned int layerIndex, Worker* worker);
+
+		/**
+		 * Applies one red-black Gauss-Seidel iteration for the pixels of one color in a subset of a multigrid layer.
+		 * The pixel (x, y) has the color (x + y) % 2.
+		 * @param coefficients The diagonal elements and their inverse of the layer, must be valid
+		 * @param rowRanges The ranges of unknown pixels for each row of the layer, must be valid
+		 * @param rightHandSide The right-hand side of the layer, must be valid
+		 * @param solution The solution of the layer to be improved, must be valid
+		 * @param color The color of the pixels to be updated, with range [0, 1]
+		 * @param firstRow The first row to be handled, with range [0, solution.height() - 1]
+		 * @param numberRows The number of rows to be handled, with range [1, solution.height() - firstRow]
+		 */
+		static void multigridSmoothSubset(const Frame* coefficients, const IndexPairs32* rowRanges, const Frame* rightHandSide, Frame* solution, const unsigned int color, const unsigned int firstRow, const unsigned int numberRows);
+
+		/**
+		 * Determines the residual of a multigrid layer and restricts the residual to the right-hand side of the next coarser layer, for a subset of the coarser layer.
+		 * Each pixel of the coarser right-hand side is the sum of the residuals of the corresponding four finer pixels.
+		 * @param coefficients The diagonal elements and their inverse of the finer layer, must be valid
+		 * @param rowRanges The ranges of unknown pixels for each row of the finer layer, must be valid
+		 * @param rightHandSide The right-hand side of the finer layer, must be valid
+		 * @param solution The solution of the finer layer, must be valid
+		 * @param coarserRightHandSide The resulting right-hand side of the coarser layer, must be valid
+		 * @param maximalResiduals The resulting maximal absolute residual for each row of the coarser layer, must be valid
+		 * @param firstCoarserRow The first row of the coarser layer to be handled, with range [0, coarserRightHandSide.height() - 1]
+		 * @param numberCoarserRows The number of rows of the coarser layer to be handled, with range [1, coarserRightHandSide.height() - firstCoarserRow]
+		 */
+		static void multigridRestrictResidualSubset(const Frame* coefficients, const IndexPairs32* rowRanges, const Frame* rightHandSide, const Frame* solution, Frame* coarserRightHandSide, float* maximalResiduals, const unsigned int firstCoarserRow, const unsigned int numberCoarserRows);
+
+		/**
+		 * Adds the solution of a coarser multigrid layer to the unknown pixels of the finer layer (prolongation of the correction), for a subset of the finer layer.
+		 * The correction of each finer pixel is interpolated bilinearly from the four closest coarser pixels.
+		 * @param coefficients The diagonal elements and their inverse of the finer layer, must be valid
+		 * @param rowRanges The ranges of unknown pixels for each row of the finer layer, must be valid
+		 * @param coarserSolution The solution of the coarser layer, must be valid
+		 * @param solution The solution of the finer layer to be corrected, must be valid
+		 * @param firstRow The first row of the finer layer to be handled, with range [0, solution.height() - 1]
+		 * @param numberRows The number of rows of the finer layer to be handled, with range [1, solution.height() - firstRow]
+		 */
+		static void multigridProlongateSubset(const Frame* coefficients, const IndexPairs32* rowRanges, const Frame* coarserSolution, Frame* solution, const unsigned int firstRow, const unsigned int numberRows);
+
 		/**
 		 * Performs separate Poisson blending calculations for a range of color channels.
 		 * @param indexLookup Index lookup frame for masked source pixels
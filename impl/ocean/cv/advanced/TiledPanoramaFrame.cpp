@@ -0,0 +1,499 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "ocean/cv/advanced/TiledPanoramaFrame.h"
+
+namespace Ocean
+{
+
+namespace CV
+{
+
+namespace Advanced
+{
+
+TiledPanoramaFrame::TiledPanoramaFrame(const unsigned int width, const unsigned int height, const uint8_t maskValue, const UpdateMode updateMode, const unsigned int tileSize, const unsigned int maximalResidentTiles, const TileCallback& exportCallback) :
+	PanoramaFrame(width, height, maskValue, updateMode),
+	tileSize_(tileSize),
+	tilesHorizontal_((width + tileSize - 1u) / tileSize),
+	tilesVertical_((height + tileSize - 1u) / tileSize),
+	maximalResidentTiles_(maximalResidentTiles),
+	exportCallback_(exportCallback)
+{
+	ocean_assert(width != 0u && height != 0u);
+	ocean_assert(tileSize >= 16u);
+	ocean_assert(maximalResidentTiles == 0u || !exportCallback.isNull());
+
+	tiles_.resize(size_t(tilesHorizontal_) * size_t(tilesVertical_));
+}
+
+bool TiledPanoramaFrame::addFrame(const PinholeCamera& pinholeCamera, const SquareMatrix3& orientation, const Frame& frame, const Frame& mask, const unsigned int approximationBinSize, Worker* worker)
+{
+	ocean_assert(isValid());
+	ocean_assert(pinholeCamera.isValid() && frame.isValid() && frame.numberPlanes() == 1u);
+	ocean_assert(!mask.isValid() || FrameType(frame, FrameType::FORMAT_Y8) == mask.frameType());
+
+	if (!isValid() || !pinholeCamera.isValid() || !frame.isValid() || frame.numberPlanes() != 1u || frame.dataType() != FrameType::DT_UNSIGNED_INTEGER_8 || frame.channels() > 4u)
+	{
+		return false;
+	}
+
+	if (pinholeCamera.width() != frame.width() || pinholeCamera.height() != frame.height())
+	{
+		return false;
+	}
+
+	if (mask.isValid() && FrameType(frame, FrameType::FORMAT_Y8) != mask.frameType())
+	{
+		return false;
+	}
+
+	if (pixelFormat_ == FrameType::FORMAT_UNDEFINED)
+	{
+		pixelFormat_ = frame.pixelFormat();
+		pixelOrigin_ = frame.pixelOrigin();
+	}
+	else if (frame.pixelFormat() != pixelFormat_ || frame.pixelOrigin() != pixelOrigin_)
+	{
+		ocean_assert(false && "The pixel format must not change!");
+		return false;
+	}
+
+	const Box2 boundingBox(panoramaSubFrameBoundingBox(pinholeCamera, orientation));
+
+	const int left = int(Numeric::floor(boundingBox.left()));
+	const int right = int(Numeric::ceil(boundingBox.right()));
+
+	const unsigned int top = (unsigned int)(minmax(0, int(Numeric::floor(boundingBox.top())), int(dimensionHeight_) - 1));
+	const unsigned int bottom = (unsigned int)(minmax(0, int(Numeric::ceil(boundingBox.bottom())), int(dimensionHeight_) - 1));
+
+	ocean_assert(right >= left && top <= bottom);
+
+	// the bounding box may exceed the left or right border of the panorama, the covered columns wrap around
+
+	std::vector<uint8_t> coveredTileColumns(tilesHorizontal_, 0u);
+
+	if (right - left + 1 >= int(dimensionWidth_))
+	{
+		std::fill(coveredTileColumns.begin(), coveredTileColumns.end(), 1u);
+	}
+	else
+	{
+		int x = left;
+
+		while (x <= right)
+		{
+			const unsigned int wrappedX = (unsigned int)((x % int(dimensionWidth_) + int(dimensionWidth_)) % int(dimensionWidth_));
+			const unsigned int tileX = wrappedX / tileSize_;
+
+			coveredTileColumns[tileX] = 1u;
+
+			// the last tile column may be narrower than the tile size, so we step to the next tile border explicitly
+
+			x += int(std::min((tileX + 1u) * tileSize_, dimensionWidth_) - wrappedX);
+		}
+	}
+
+	Indices32 tileIndices;
+
+	for (unsigned int tileY = top / tileSize_; tileY <= bottom / tileSize_; ++tileY)
+	{
+		for (unsigned int tileX = 0u; tileX < tilesHorizontal_; ++tileX)
+		{
+			if (coveredTileColumns[tileX] != 0u)
+			{
+				tileIndices.emplace_back(tileY * tilesHorizontal_ + tileX);
+			}
+		}
+	}
+
+	++frameCounter_;
+
+	size_t previouslyResidentTiles = 0;
+	for (const Index32 tileIndex : tileIndices)
+	{
+		if (tiles_[tileIndex].isResident())
+		{
+			++previouslyResidentTiles;
+		}
+	}
+
+	if (worker != nullptr && tileIndices.size() > 1)
+	{
+		worker->executeFunction(Worker::Function::create(*this, &TiledPanoramaFrame::addFrameSubset, &pinholeCamera, &orientation, &frame, &mask, approximationBinSize, (const Indices32*)(&tileIndices), 0u, 0u), 0u, (unsigned int)(tileIndices.size()), 6u, 7u, 1u);
+	}
+	else
+	{
+		addFrameSubset(&pinholeCamera, &orientation, &frame, &mask, approximationBinSize, &tileIndices, 0u, (unsigned int)(tileIndices.size()));
+	}
+
+	size_t currentlyResidentTiles = 0;
+	for (const Index32 tileIndex : tileIndices)
+	{
+		if (tiles_[tileIndex].isResident())
+		{
+			++currentlyResidentTiles;
+		}
+	}
+
+	ocean_assert(currentlyResidentTiles >= previouslyResidentTiles);
+	residentTiles_ += currentlyResidentTiles - previouslyResidentTiles;
+
+	if (maximalResidentTiles_ != 0u && residentTiles_ > size_t(maximalResidentTiles_))
+	{
+		releaseLeastRecentlyUpdatedTiles();
+	}
+
+	return true;
+}
+
+size_t TiledPanoramaFrame::exportTiles(const unsigned int minimalIdleFrames, const bool releaseTiles)
+{
+	ocean_assert(!exportCallback_.isNull());
+
+	if (exportCallback_.isNull())
+	{
+		return 0;
+	}
+
+	size_t exportedTiles = 0;
+
+	for (unsigned int tileIndex = 0u; tileIndex < (unsigned int)(tiles_.size()); ++tileIndex)
+	{
+		Tile& tile = tiles_[tileIndex];
+
+		if (!tile.isResident())
+		{
+			continue;
+		}
+
+		ocean_assert(frameCounter_ >= tile.lastUpdateIndex_);
+
+		if (frameCounter_ - tile.lastUpdateIndex_ < minimalIdleFrames)
+		{
+			continue;
+		}
+
+		if (tile.isDirty_)
+		{
+			if (!exportTile(tileIndex))
+			{
+				continue;
+			}
+
+			++exportedTiles;
+		}
+
+		if (releaseTiles)
+		{
+			tile.release();
+
+			ocean_assert(residentTiles_ >= 1);
+			--residentTiles_;
+		}
+	}
+
+	return exportedTiles;
+}
+
+bool TiledPanoramaFrame::extractSubFrame(const PixelPosition& topLeft, const unsigned int width, const unsigned int height, Frame& frame, Frame& mask) const
+{
+	ocean_assert(isValid());
+	ocean_assert(topLeft.x() + width <= dimensionWidth_ && topLeft.y() + height <= dimensionHeight_);
+
+	if (pixelFormat_ == FrameType::FORMAT_UNDEFINED || width == 0u || height == 0u || topLeft.x() + width > dimensionWidth_ || topLeft.y() + height > dimensionHeight_)
+	{
+		return false;
+	}
+
+	if (!frame.set(FrameType(width, height, pixelFormat_, pixelOrigin_), false /*forceOwner*/, true /*forceWritable*/)
+			|| !mask.set(FrameType(frame, FrameType::FORMAT_Y8), false /*forceOwner*/, true /*forceWritable*/))
+	{
+		return false;
+	}
+
+	frame.setValue(0x00u);
+	mask.setValue(0xFFu - maskValue_);
+
+	const unsigned int firstTileX = topLeft.x() / tileSize_;
+	const unsigned int firstTileY = topLeft.y() / tileSize_;
+
+	const unsigned int lastTileX = (topLeft.x() + width - 1u) / tileSize_;
+	const unsigned int lastTileY = (topLeft.y() + height - 1u) / tileSize_;
+
+	for (unsigned int tileY = firstTileY; tileY <= lastTileY; ++tileY)
+	{
+		for (unsigned int tileX = firstTileX; tileX <= lastTileX; ++tileX)
+		{
+			const Tile& tile = tiles_[tileY * tilesHorizontal_ + tileX];
+
+			if (tile.isResident())
+			{
+				const int targetLeft = int(tileX * tileSize_) - int(topLeft.x());
+				const int targetTop = int(tileY * tileSize_) - int(topLeft.y());
+
+				if (!frame.copy(targetLeft, targetTop, tile.frame_) || !mask.copy(targetLeft, targetTop, tile.mask_))
+				{
+					ocean_assert(false && "This should never happen!");
+					return false;
+				}
+			}
+		}
+	}
+
+	return true;
+}
+
+void TiledPanoramaFrame::clear()
+{
+	for (Tile& tile : tiles_)
+	{
+		tile.release();
+		tile.lastUpdateIndex_ = 0u;
+	}
+
+	residentTiles_ = 0;
+	frameCounter_ = 0u;
+
+	pixelFormat_ = FrameType::FORMAT_UNDEFINED;
+	pixelOrigin_ = FrameType::ORIGIN_INVALID;
+}
+
+void TiledPanoramaFrame::addFrameSubset(const PinholeCamera* pinholeCamera, const SquareMatrix3* orientation, const Frame* frame, const Frame* mask, const unsigned int approximationBinSize, const Indices32* tileIndices, const unsigned int firstTile, const unsigned int numberTiles)
+{
+	ocean_assert(pinholeCamera != nullptr && orientation != nullptr && frame != nullptr && mask != nullptr && tileIndices != nullptr);
+	ocean_assert(firstTile + numberTiles <= tileIndices->size());
+
+	Frame tileSubFrame;
+	Frame tileSubMask;
+
+	for (unsigned int n = firstTile; n < firstTile + numberTiles; ++n)
+	{
+		const Index32 tileIndex = (*tileIndices)[n];
+
+		unsigned int tileLeft, tileTop, tileWidth, tileHeight;
+		tileArea(tileIndex, tileLeft, tileTop, tileWidth, tileHeight);
+
+		if (!tileSubFrame.set(FrameType(tileWidth, tileHeight, pixelFormat_, pixelOrigin_), false /*forceOwner*/, true /*forceWritable*/)
+				|| !tileSubMask.set(FrameType(tileSubFrame, FrameType::FORMAT_Y8), false /*forceOwner*/, true /*forceWritable*/))
+		{
+			ocean_assert(false && "This should never happen!");
+			return;
+		}
+
+		tileSubMask.setValue(0xFFu - maskValue_);
+
+		// each tile is warped individually with one thread, so that the tiles are processed in parallel
+
+		const PixelPositionI tileTopLeft = PixelPositionI(int(tileLeft), int(tileTop));
+
+		const bool result = mask->isValid()
+			? cameraFrame2panoramaFrame(*pinholeCamera, *frame, *mask, *orientation, dimensionWidth_, dimensionHeight_, tileTopLeft, tileSubFrame, tileSubMask, maskValue_, approximationBinSize, nullptr)
+			: cameraFrame2panoramaFrame(*pinholeCamera, *frame, *orientation, dimensionWidth_, dimensionHeight_, tileTopLeft, tileSubFrame, tileSubMask, maskValue_, approximationBinSize, nullptr);
+
+		if (!result)
+		{
+			ocean_assert(false && "This should never happen!");
+			continue;
+		}
+
+		// the bounding box of the camera frame is conservative, tiles which do not receive any valid pixel are not allocated
+
+		bool hasValidPixel = false;
+
+		for (unsigned int y = 0u; !hasValidPixel && y < tileSubMask.height(); ++y)
+		{
+			const uint8_t* const maskRow = tileSubMask.constrow<uint8_t>(y);
+
+			for (unsigned int x = 0u; x < tileSubMask.width(); ++x)
+			{
+				if (maskRow[x] == maskValue_)
+				{
+					hasValidPixel = true;
+					break;
+				}
+			}
+		}
+
+		if (!hasValidPixel)
+		{
+			continue;
+		}
+
+		Tile& tile = tiles_[tileIndex];
+
+		if (mergeTile(tileSubFrame, tileSubMask, tile))
+		{
+			tile.isDirty_ = true;
+			tile.lastUpdateIndex_ = frameCounter_;
+		}
+	}
+}
+
+bool TiledPanoramaFrame::mergeTile(const Frame& tileSubFrame, const Frame& tileSubMask, Tile& tile) const
+{
+	ocean_assert(tileSubFrame.isValid() && tileSubFrame.frameType() == FrameType(tileSubMask, tileSubFrame.pixelFormat()));
+
+	if (!tile.isResident())
+	{
+		if (!tile.frame_.set(tileSubFrame.frameType(), true /*forceOwner*/, true /*forceWritable*/)
+				|| !tile.mask_.set(tileSubMask.frameType(), true /*forceOwner*/, true /*forceWritable*/))
+		{
+			ocean_assert(false && "This should never happen!");
+			return false;
+		}
+
+		tile.frame_.setValue(0x00u);
+		tile.mask_.setValue(0xFFu - maskValue_);
+
+		if (updateMode_ == UM_AVERAGE_GLOBAL)
+		{
+			if (!tile.nominatorFrame_.set(FrameType(tile.frame_, FrameType::genericPixelFormat<uint32_t>(tile.frame_.channels())), true /*forceOwner*/, true /*forceWritable*/)
+					|| !tile.denominatorFrame_.set(FrameType(tile.mask_, FrameType::FORMAT_Y32), true /*forceOwner*/, true /*forceWritable*/))
+			{
+				ocean_assert(false && "This should never happen!");
+				return false;
+			}
+
+			tile.nominatorFrame_.setValue(0x00u);
+			tile.denominatorFrame_.setValue(0x00u);
+		}
+	}
+
+	ocean_assert(tile.frame_.frameType() == tileSubFrame.frameType());
+
+	switch (tile.frame_.channels())
+	{
+		case 1u:
+			mergeTile8BitPerChannel<1u>(tileSubFrame, tileSubMask, tile);
+			return true;
+
+		case 2u:
+			mergeTile8BitPerChannel<2u>(tileSubFrame, tileSubMask, tile);
+			return true;
+
+		case 3u:
+			mergeTile8BitPerChannel<3u>(tileSubFrame, tileSubMask, tile);
+			return true;
+
+		case 4u:
+			mergeTile8BitPerChannel<4u>(tileSubFrame, tileSubMask, tile);
+			return true;
+	}
+
+	ocean_assert(false && "Invalid pixel format!");
+	return false;
+}
+
+template <unsigned int tChannels>
+void TiledPanoramaFrame::mergeTile8BitPerChannel(const Frame& tileSubFrame, const Frame& tileSubMask, Tile& tile) const
+{
+	static_assert(tChannels >= 1u, "Invalid channel number!");
+
+	ocean_assert(tile.isResident() && tile.frame_.channels() == tChannels);
+
+	// the warped tile and the tile have the same position and size
+
+	const PixelPosition topLeft(0u, 0u);
+
+	switch (updateMode_)
+	{
+		case UM_SET_ALL:
+			mergeSetAll8BitPerChannel<tChannels>(tileSubFrame.constdata<uint8_t>(), tileSubMask.constdata<uint8_t>(), tileSubFrame.width(), tileSubFrame.height(), tileSubFrame.paddingElements(), tileSubMask.paddingElements(), topLeft, tile.frame_.data<uint8_t>(), tile.mask_.data<uint8_t>(), tile.frame_.width(), tile.frame_.paddingElements(), tile.mask_.paddingElements(), topLeft, maskValue_, nullptr);
+			return;
+
+		case UM_SET_NEW:
+			mergeSetNew8BitPerChannel<tChannels>(tileSubFrame.constdata<uint8_t>(), tileSubMask.constdata<uint8_t>(), tileSubFrame.width(), tileSubFrame.height(), tileSubFrame.paddingElements(), tileSubMask.paddingElements(), topLeft, tile.frame_.data<uint8_t>(), tile.mask_.data<uint8_t>(), tile.frame_.width(), tile.frame_.paddingElements(), tile.mask_.paddingElements(), topLeft, maskValue_, nullptr);
+			return;
+
+		case UM_AVERAGE_LOCAL:
+			mergeAverageLocal8BitPerChannel<tChannels>(tileSubFrame.constdata<uint8_t>(), tileSubMask.constdata<uint8_t>(), tileSubFrame.width(), tileSubFrame.height(), tileSubFrame.paddingElements(), tileSubMask.paddingElements(), topLeft, tile.frame_.data<uint8_t>(), tile.mask_.data<uint8_t>(), tile.frame_.width(), tile.frame_.paddingElements(), tile.mask_.paddingElements(), topLeft, maskValue_, nullptr);
+			return;
+
+		case UM_AVERAGE_GLOBAL:
+			ocean_assert(tile.nominatorFrame_.isValid() && tile.denominatorFrame_.isValid());
+			mergeAverageGlobal8BitPerChannel<tChannels>(tileSubFrame.constdata<uint8_t>(), tileSubMask.constdata<uint8_t>(), tileSubFrame.width(), tileSubFrame.height(), tileSubFrame.paddingElements(), tileSubMask.paddingElements(), topLeft, tile.nominatorFrame_.data<uint32_t>(), tile.denominatorFrame_.data<uint32_t>(), tile.frame_.data<uint8_t>(), tile.mask_.data<uint8_t>(), tile.frame_.width(), tile.frame_.paddingElements(), tile.mask_.paddingElements(), topLeft, maskValue_, nullptr);
+			return;
+
+		case UM_INVALID:
+			break;
+	}
+
+	ocean_assert(false && "Invalid update mode!");
+}
+
+void TiledPanoramaFrame::releaseLeastRecentlyUpdatedTiles()
+{
+	ocean_assert(maximalResidentTiles_ != 0u && !exportCallback_.isNull());
+
+	if (exportCallback_.isNull())
+	{
+		return;
+	}
+
+	IndexPairs32 candidates;
+	candidates.reserve(residentTiles_);
+
+	for (unsigned int tileIndex = 0u; tileIndex < (unsigned int)(tiles_.size()); ++tileIndex)
+	{
+		const Tile& tile = tiles_[tileIndex];
+
+		// tiles modified by the most recent camera frame are kept, the camera will likely cover them again
+
+		if (tile.isResident() && tile.lastUpdateIndex_ < frameCounter_)
+		{
+			candidates.emplace_back(tile.lastUpdateIndex_, tileIndex);
+		}
+	}
+
+	std::sort(candidates.begin(), candidates.end());
+
+	for (const IndexPair32& candidate : candidates)
+	{
+		if (residentTiles_ <= size_t(maximalResidentTiles_))
+		{
+			break;
+		}
+
+		Tile& tile = tiles_[candidate.second];
+
+		if (tile.isDirty_ && !exportTile(candidate.second))
+		{
+			Log::warning() << "Failed to export panorama tile " << candidate.second << ", the tile stays in memory";
+			continue;
+		}
+
+		tile.release();
+
+		ocean_assert(residentTiles_ >= 1);
+		--residentTiles_;
+	}
+}
+
+bool TiledPanoramaFrame::exportTile(const unsigned int tileIndex)
+{
+	ocean_assert(tileIndex < tiles_.size());
+	ocean_assert(!exportCallback_.isNull());
+
+	Tile& tile = tiles_[tileIndex];
+	ocean_assert(tile.isResident());
+
+	if (!exportCallback_(tileIndex % tilesHorizontal_, tileIndex / tilesHorizontal_, tile.frame_, tile.mask_))
+	{
+		return false;
+	}
+
+	tile.isDirty_ = false;
+
+	return true;
+}
+
+}
+
+}
+
+}
@@ -0,0 +1,386 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#ifndef META_OCEAN_CV_ADVANCED_TILED_PANORAMA_FRAME_H
+#define META_OCEAN_CV_ADVANCED_TILED_PANORAMA_FRAME_H
+
+#include "ocean/cv/advanced/Advanced.h"
+#include "ocean/cv/advanced/PanoramaFrame.h"
+
+#include "ocean/base/Callback.h"
+#include "ocean/base/Frame.h"
+#include "ocean/base/Worker.h"
+
+#include "ocean/cv/PixelPosition.h"
+
+#include "ocean/math/PinholeCamera.h"
+#include "ocean/math/SquareMatrix3.h"
+
+namespace Ocean
+{
+
+namespace CV
+{
+
+namespace Advanced
+{
+
+/**
+ * This class implements a panorama frame with spherical projection model which is stored in individual tiles.
+ * In contrast to PanoramaFrame, which holds one dense sub-frame of the panorama growing with each new camera frame, this panorama frame allocates a tile only when a camera frame covers it.<br>
+ * Each new camera frame is warped into each covered tile individually and merged with the tile using the update mode; the tiles are processed in parallel.<br>
+ * Each tile tracks whether it has been modified since its last export (dirty tiles).<br>
+ * Finished tiles, i.e., tiles not covered by recent camera frames, can therefore be streamed to disk via the export callback and released afterwards.<br>
+ * When a maximal number of resident tiles is defined, the least recently updated tiles are exported and released automatically, so that the memory stays bounded even for panoramas with e.g., 16K x 8K pixels.<br>
+ * A released tile which is covered again by a later camera frame starts empty, the export callback will receive the tile again with the new content only.<br>
+ * The pixel (x, y) of tile (tileX, tileY) corresponds with the panorama pixel (tileX * tileSize() + x, tileY * tileSize() + y), tiles in the last column and row may be smaller.
+ * @see PanoramaFrame.
+ * @ingroup cvadvanced
+ */
+class OCEAN_CV_ADVANCED_EXPORT TiledPanoramaFrame : protected PanoramaFrame
+{
+	public:
+
+		/**
+		 * Re-definition of the update modes of the panorama frame.
+		 */
+		using PanoramaFrame::UpdateMode;
+
+		/**
+		 * Definition of a callback function exporting one tile.
+		 * The first and second parameters are the horizontal and vertical index of the tile, the third and fourth parameters are the frame and mask of the tile.<br>
+		 * The callback returns True if the tile has been exported successfully, e.g., written to disk.
+		 */
+		using TileCallback = Callback<bool, const unsigned int, const unsigned int, const Frame&, const Frame&>;
+
+	protected:
+
+		/**
+		 * This class holds the data of one tile.
+		 */
+		class Tile
+		{
+			public:
+
+				/**
+				 * Returns whether this tile is resident in memory.
+				 * @return True, if so
+				 */
+				inline bool isResident() const;
+
+				/**
+				 * Releases the memory of this tile.
+				 */
+				inline void release();
+
+			public:
+
+				/// The frame of the tile, invalid if the tile is not resident.
+				Frame frame_;
+
+				/// The mask of the tile.
+				Frame mask_;
+
+				/// The optional nominator frame of the tile, necessary if UM_AVERAGE_GLOBAL is set as update mode.
+				Frame nominatorFrame_;
+
+				/// The optional denominator frame of the tile, necessary if UM_AVERAGE_GLOBAL is set as update mode.
+				Frame denominatorFrame_;
+
+				/// True, if the tile has been modified since it has been exported the last time.
+				bool isDirty_ = false;
+
+				/// The index of the camera frame which modified the tile the last time, 0 if the tile has never been modified.
+				unsigned int lastUpdateIndex_ = 0u;
+		};
+
+		/**
+		 * Definition of a vector holding tiles.
+		 */
+		using Tiles = std::vector<Tile>;
+
+	public:
+
+		/**
+		 * Creates an invalid panorama frame instance.
+		 */
+		TiledPanoramaFrame() = default;
+
+		/**
+		 * Creates a new tiled panorama frame instance.
+		 * @param width The width of the entire panorama frame representing horizontal 360 degrees, in pixel with range [1, infinity)
+		 * @param height The height of the entire panorama frame representing vertical 180 degrees, in pixel with range [1, infinity)
+		 * @param maskValue The mask value defining the 8 bit pixel value of valid pixels
+		 * @param updateMode The update mode of this panorama frame, must be valid
+		 * @param tileSize The width and height of each tile, in pixel, with range [16, infinity)
+		 * @param maximalResidentTiles The maximal number of tiles resident in memory before the least recently updated tiles are exported and released, with range [1, infinity), 0 to keep all tiles in memory
+		 * @param exportCallback The callback function exporting tiles, must be valid if 'maximalResidentTiles' is not 0
+		 */
+		TiledPanoramaFrame(const unsigned int width, const unsigned int height, const uint8_t maskValue, const UpdateMode updateMode, const unsigned int tileSize = 512u, const unsigned int maximalResidentTiles = 0u, const TileCallback& exportCallback = TileCallback());
+
+		/**
+		 * Adds a new camera frame to the panorama frame for which the orientation is known.
+		 * The frame is warped into each covered tile individually, tiles are allocated on demand.
+		 * @param pinholeCamera The pinhole camera profile of the given frame, must be valid
+		 * @param orientation The orientation of the given frame
+		 * @param frame The frame to be added, with same pixel format as all previous frames, must be valid
+		 * @param mask Optional mask frame defining valid and invalid pixels in the given frame
+		 * @param approximationBinSize Optional width of a bin in a lookup table to speedup the in interpolation in pixel, 0u to avoid the application of a lookup table
+		 * @param worker Optional worker object to distribute the computation, the tiles are processed in parallel
+		 * @return True, if succeeded
+		 */
+		bool addFrame(const PinholeCamera& pinholeCamera, const SquareMatrix3& orientation, const Frame& frame, const Frame& mask, const unsigned int approximationBinSize = 20u, Worker* worker = nullptr);
+
+		/**
+		 * Exports all dirty tiles which have not been modified by the most recent camera frames.
+		 * Each exported tile is passed to the export callback, tiles for which the callback fails stay dirty and resident.
+		 * @param minimalIdleFrames The minimal number of camera frames which have been added since a tile has been modified the last time so that the tile is exported, with range [0, infinity), 0 to export all dirty tiles
+		 * @param releaseTiles True, to release the memory of the exported tiles (and of all other idle tiles which are not dirty)
+		 * @return The number of exported tiles
+		 */
+		size_t exportTiles(const unsigned int minimalIdleFrames = 0u, const bool releaseTiles = true);
+
+		/**
+		 * Extracts a sub-frame of the panorama frame composed of all resident tiles.
+		 * Pixels of tiles which are not resident are invalid in the resulting mask.
+		 * @param topLeft The top left position of the sub-frame, with range [0, dimensionWidth())x[0, dimensionHeight())
+		 * @param width The width of the sub-frame in pixel, with range [1, dimensionWidth() - topLeft.x()]
+		 * @param height The height of the sub-frame in pixel, with range [1, dimensionHeight() - topLeft.y()]
+		 * @param frame The resulting sub-frame
+		 * @param mask The resulting mask of the sub-frame
+		 * @return True, if succeeded
+		 */
+		bool extractSubFrame(const PixelPosition& topLeft, const unsigned int width, const unsigned int height, Frame& frame, Frame& mask) const;
+
+		/**
+		 * Returns the frame of a tile.
+		 * @param tileX The horizontal index of the tile, with range [0, tilesHorizontal())
+		 * @param tileY The vertical index of the tile, with range [0, tilesVertical())
+		 * @return The frame of the tile, invalid if the tile is not resident
+		 */
+		inline const Frame& tileFrame(const unsigned int tileX, const unsigned int tileY) const;
+
+		/**
+		 * Returns the mask of a tile.
+		 * @param tileX The horizontal index of the tile, with range [0, tilesHorizontal())
+		 * @param tileY The vertical index of the tile, with range [0, tilesVertical())
+		 * @return The mask of the tile, invalid if the tile is not resident
+		 */
+		inline const Frame& tileMask(const unsigned int tileX, const unsigned int tileY) const;
+
+		/**
+		 * Returns whether a tile has been modified since it has been exported the last time.
+		 * @param tileX The horizontal index of the tile, with range [0, tilesHorizontal())
+		 * @param tileY The vertical index of the tile, with range [0, tilesVertical())
+		 * @return True, if so
+		 */
+		inline bool isTileDirty(const unsigned int tileX, const unsigned int tileY) const;
+
+		/**
+		 * Returns the width and height of each tile.
+		 * @return The size of the tiles in pixel
+		 */
+		inline unsigned int tileSize() const;
+
+		/**
+		 * Returns the number of tiles in horizontal direction.
+		 * @return The number of horizontal tiles
+		 */
+		inline unsigned int tilesHorizontal() const;
+
+		/**
+		 * Returns the number of tiles in vertical direction.
+		 * @return The number of vertical tiles
+		 */
+		inline unsigned int tilesVertical() const;
+
+		/**
+		 * Returns the number of tiles which are currently resident in memory.
+		 * @return The number of resident tiles
+		 */
+		inline size_t residentTiles() const;
+
+		/**
+		 * Clears the panorama frame and releases all tiles without exporting them.
+		 */
+		void clear() override;
+
+		using PanoramaFrame::maskValue;
+		using PanoramaFrame::updateMode;
+		using PanoramaFrame::dimensionWidth;
+		using PanoramaFrame::dimensionHeight;
+		using PanoramaFrame::isValid;
+		using PanoramaFrame::operator bool;
+
+	protected:
+
+		/**
+		 * Warps a camera frame into a subset of tiles and merges the result with the tiles.
+		 * @param pinholeCamera The pinhole camera profile of the camera frame, must be valid
+		 * @param orientation The orientation of the camera frame, must be valid
+		 * @param frame The camera frame, must be valid
+		 * @param mask Optional mask of the camera frame, an invalid frame to define all pixels as valid
+		 * @param approximationBinSize Optional width of a bin in a lookup table to speedup the in interpolation in pixel, 0u to avoid the application of a lookup table
+		 * @param tileIndices The indices of all tiles covered by the camera frame, must be valid
+		 * @param firstTile The first tile to be handled, with range [0, tileIndices.size())
+		 * @param numberTiles The number of tiles to be handled, with range [1, tileIndices.size() - firstTile]
+		 */
+		void addFrameSubset(const PinholeCamera* pinholeCamera, const SquareMatrix3* orientation, const Frame* frame, const Frame* mask, const unsigned int approximationBinSize, const Indices32* tileIndices, const unsigned int firstTile, const unsigned int numberTiles);
+
+		/**
+		 * Merges a warped tile with a tile by application of the update mode of this panorama frame.
+		 * The tile is allocated if it is not resident.
+		 * @param tileSubFrame The camera frame warped into the tile, with the resolution of the tile, must be valid
+		 * @param tileSubMask The mask of the warped camera frame, must be valid
+		 * @param tile The tile which will receive the warped camera frame
+		 * @return True, if succeeded
+		 */
+		bool mergeTile(const Frame& tileSubFrame, const Frame& tileSubMask, Tile& tile) const;
+
+		/**
+		 * Merges a warped tile with a resident tile by application of the update mode of this panorama frame.
+		 * @param tileSubFrame The camera frame warped into the tile, with the resolution of the tile, must be valid
+		 * @param tileSubMask The mask of the warped camera frame, must be valid
+		 * @param tile The resident tile which will receive the warped camera frame
+		 * @tparam tChannels The number of frame channels, with range [1, infinity)
+		 */
+		template <unsigned int tChannels>
+		void mergeTile8BitPerChannel(const Frame& tileSubFrame, const Frame& tileSubMask, Tile& tile) const;
+
+		/**
+		 * Exports and releases the least recently updated tiles until the number of resident tiles does not exceed the maximal number of resident tiles.
+		 * Tiles modified by the most recent camera frame are never released.
+		 */
+		void releaseLeastRecentlyUpdatedTiles();
+
+		/**
+		 * Exports one tile via the export callback.
+		 * @param tileIndex The index of the tile to be exported, with range [0, tiles_.size())
+		 * @return True, if succeeded
+		 */
+		bool exportTile(const unsigned int tileIndex);
+
+		/**
+		 * Returns the top left position and the size of a tile.
+		 * @param tileIndex The index of the tile, with range [0, tiles_.size())
+		 * @param tileLeft The resulting horizontal position of the tile within the panorama frame, in pixel
+		 * @param tileTop The resulting vertical position of the tile within the panorama frame, in pixel
+		 * @param tileWidth The resulting width of the tile, in pixel
+		 * @param tileHeight The resulting height of the tile, in pixel
+		 */
+		inline void tileArea(const unsigned int tileIndex, unsigned int& tileLeft, unsigned int& tileTop, unsigned int& tileWidth, unsigned int& tileHeight) const;
+
+	protected:
+
+		/// The tiles of the panorama frame, row by row.
+		Tiles tiles_;
+
+		/// The width and height of each tile, in pixel.
+		unsigned int tileSize_ = 0u;
+
+		/// The number of tiles in horizontal direction.
+		unsigned int tilesHorizontal_ = 0u;
+
+		/// The number of tiles in vertical direction.
+		unsigned int tilesVertical_ = 0u;
+
+		/// The number of tiles currently resident in memory.
+		size_t residentTiles_ = 0;
+
+		/// The maximal number of resident tiles, 0 for an unlimited number.
+		unsigned int maximalResidentTiles_ = 0u;
+
+		/// The callback function exporting tiles.
+		TileCallback exportCallback_;
+
+		/// The pixel format of all camera frames, defined by the first camera frame.
+		FrameType::PixelFormat pixelFormat_ = FrameType::FORMAT_UNDEFINED;
+
+		/// The pixel origin of all camera frames, defined by the first camera frame.
+		FrameType::PixelOrigin pixelOrigin_ = FrameType::ORIGIN_INVALID;
+
+		/// The number of camera frames which have been added so far.
+		unsigned int frameCounter_ = 0u;
+};
+
+inline bool TiledPanoramaFrame::Tile::isResident() const
+{
+	return frame_.isValid();
+}
+
+inline void TiledPanoramaFrame::Tile::release()
+{
+	frame_.release();
+	mask_.release();
+
+	nominatorFrame_.release();
+	denominatorFrame_.release();
+
+	isDirty_ = false;
+}
+
+inline const Frame& TiledPanoramaFrame::tileFrame(const unsigned int tileX, const unsigned int tileY) const
+{
+	ocean_assert(tileX < tilesHorizontal_ && tileY < tilesVertical_);
+
+	return tiles_[tileY * tilesHorizontal_ + tileX].frame_;
+}
+
+inline const Frame& TiledPanoramaFrame::tileMask(const unsigned int tileX, const unsigned int tileY) const
+{
+	ocean_assert(tileX < tilesHorizontal_ && tileY < tilesVertical_);
+
+	return tiles_[tileY * tilesHorizontal_ + tileX].mask_;
+}
+
+inline bool TiledPanoramaFrame::isTileDirty(const unsigned int tileX, const unsigned int tileY) const
+{
+	ocean_assert(tileX < tilesHorizontal_ && tileY < tilesVertical_);
+
+	return tiles_[tileY * tilesHorizontal_ + tileX].isDirty_;
+}
+
+inline unsigned int TiledPanoramaFrame::tileSize() const
+{
+	return tileSize_;
+}
+
+inline unsigned int TiledPanoramaFrame::tilesHorizontal() const
+{
+	return tilesHorizontal_;
+}
+
+inline unsigned int TiledPanoramaFrame::tilesVertical() const
+{
+	return tilesVertical_;
+}
+
+inline size_t TiledPanoramaFrame::residentTiles() const
+{
+	return residentTiles_;
+}
+
+inline void TiledPanoramaFrame::tileArea(const unsigned int tileIndex, unsigned int& tileLeft, unsigned int& tileTop, unsigned int& tileWidth, unsigned int& tileHeight) const
+{
+	ocean_assert(tileIndex < tiles_.size());
+
+	tileLeft = (tileIndex % tilesHorizontal_) * tileSize_;
+	tileTop = (tileIndex / tilesHorizontal_) * tileSize_;
+
+	ocean_assert(tileLeft < dimensionWidth_ && tileTop < dimensionHeight_);
+
+	tileWidth = std::min(tileSize_, dimensionWidth_ - tileLeft);
+	tileHeight = std::min(tileSize_, dimensionHeight_ - tileTop);
+}
+
+}
+
+}
+
+}
+
+#endif // META_OCEAN_CV_ADVANCED_TILED_PANORAMA_FRAME_H
@@ -343,7 +343,63 @@ CameraCalibrator::ImageResult CameraCalibrator::handleImage(const size_t imageId
 	return IR_BOARD_WAS_DETECTED;
 }
 
-bool CameraCalibrator::finalize(bool& needAdditionalIteration)
+CameraCalibrator::ImageResults CameraCalibrator::handleImages(const size_t* imageIds, const Frame* frames, const size_t numberImages, Worker* worker)
+{
+	ocean_assert(imageIds != nullptr && frames != nullptr);
+	ocean_assert(numberImages >= 1);
+
+	ocean_assert(calibrationStage_ != CS_UNKNOWN);
+	if (calibrationStage_ == CS_UNKNOWN)
+	{
+		return ImageResults(numberImages, IR_ERROR);
+	}
+
+	if (worker == nullptr || numberImages == 1)
+	{
+		ImageResults imageResults;
+		imageResults.reserve(numberImages);
+
+		for (size_t nImage = 0; nImage < numberImages; ++nImage)
+		{
+			imageResults.emplace_back(handleImage(imageIds[nImage], frames[nImage], worker));
+		}
+
+		return imageResults;
+	}
+
+	ImageResults imageResults(numberImages, IR_ERROR);
+	CalibrationBoardObservations imageObservations(numberImages);
+
+	worker->executeFunction(Worker::Function::create(*this, &CameraCalibrator::handleImagesSubset, imageIds, frames, imageResults.data(), imageObservations.data(), 0u, 0u), 0u, (unsigned int)(numberImages));
+
+	for (size_t nImage = 0; nImage < numberImages; ++nImage)
+	{
+		if (imageResults[nImage] != IR_BOARD_WAS_DETECTED)
+		{
+			continue;
+		}
+
+		for (const CalibrationBoardObservation& existingObservation : observations_)
+		{
+			if (existingObservation.imageId() == imageIds[nImage])
+			{
+				ocean_assert(false && "This should never happen!");
+				imageResults[nImage] = IR_ERROR;
+
+				break;
+			}
+		}
+
+		if (imageResults[nImage] == IR_BOARD_WAS_DETECTED)
+		{
+			observations_.emplace_back(std::move(imageObservations[nImage]));
+		}
+	}
+
+	return imageResults;
+}
+
+bool CameraCalibrator::finalize(bool& needAdditionalIteration, Worker* worker)
 {
 	needAdditionalIteration = false;
 
@@ -369,7 +425,7 @@ bool CameraCalibrator::finalize(bool& needAdditionalIteration)
 		Scalar initialError = Numeric::maxValue();
 		Scalar finalError = Numeric::maxValue();
 
-		camera_ = CameraCalibrator::determinePreciseCamera(observations_.data(), observations_.size(), optimizationStrategy, &board_T_optimizedCameras, Geometry::Estimator::ET_SQUARE, startWithFocalLength, distortionRestrictionFactor, &initialError, &finalError);
+		camera_ = CameraCalibrator::determinePreciseCamera(observations_.data(), observations_.size(), optimizationStrategy, &board_T_optimizedCameras, Geometry::Estimator::ET_SQUARE, startWithFocalLength, distortionRestrictionFactor, &initialError, &finalError, worker);
 
 		if (!camera_)
 		{
@@ -434,6 +490,33 @@ size_t CameraCalibrator::numberCorrespondences() const
 	return result;
 }
 
+void CameraCalibrator::handleImagesSubset(const size_t* imageIds, const Frame* frames, ImageResult* imageResults, CalibrationBoardObservation* imageObservations, const unsigned int firstImage, const unsigned int numberImages) const
+{
+	ocean_assert(imageIds != nullptr && frames != nullptr);
+	ocean_assert(imageResults != nullptr && imageObservations != nullptr);
+
+	// the detection state (frame, point detector, marker candidates) must not be shared between threads, therefore each subset uses an own calibrator
+
+	CameraCalibrator subsetCalibrator(metricCalibrationBoard_, initialCameraProperties_);
+
+	subsetCalibrator.calibrationStage_ = calibrationStage_;
+	subsetCalibrator.camera_ = camera_;
+	subsetCalibrator.randomGenerator_ = RandomGenerator(randomGenerator_);
+
+	for (unsigned int nImage = firstImage; nImage < firstImage + numberImages; ++nImage)
+	{
+		imageResults[nImage] = subsetCalibrator.handleImage(imageIds[nImage], frames[nImage], nullptr);
+
+		if (imageResults[nImage] == IR_BOARD_WAS_DETECTED)
+		{
+			ocean_assert(subsetCalibrator.observations_.size() == 1);
+
+			imageObservations[nImage] = std::move(subsetCalibrator.observations_.back());
+			subsetCalibrator.observations_.clear();
+		}
+	}
+}
+
 bool CameraCalibrator::determineInitialPoseWithValidMarkerCandidates(const AnyCamera& camera, const Points& points, HomogenousMatrix4& board_T_camera, Indices32& usedMarkerCandidateIndices) const
 {
 	ocean_assert(camera.isValid());
@@ -907,7 +990,7 @@ SharedAnyCamera CameraCalibrator::determineInitialCameraFieldOfView(const unsign
 	return nullptr;
 }
 
-SharedAnyCamera CameraCalibrator::determinePreciseCamera(const CalibrationBoardObservation* observations, const size_t numberObservations, const Geometry::NonLinearOptimizationCamera::OptimizationStrategy optimizationStrategy, HomogenousMatrices4* board_T_optimizedCameras, const Geometry::Estimator::EstimatorType estimatorType, const bool startWithFocalLength, const Scalar distortionRestrictionFactor, Scalar* initialError, Scalar* finalError)
+SharedAnyCamera CameraCalibrator::determinePreciseCamera(const CalibrationBoardObservation* observations, const size_t numberObservations, const Geometry::NonLinearOptimizationCamera::OptimizationStrategy optimizationStrategy, HomogenousMatrices4* board_T_optimizedCameras, const Geometry::Estimator::EstimatorType estimatorType, const bool startWithFocalLength, const Scalar distortionRestrictionFactor, Scalar* initialError, Scalar* finalError, Worker* worker)
 {
 	ocean_assert(observations != nullptr && numberObservations >= 1);
 	ocean_assert(optimizationStrategy != Geometry::NonLinearOptimizationCamera::OS_INVALID);
@@ -915,58 +998,56 @@ SharedAnyCamera CameraCalibrator::determinePreciseCamera(const CalibrationBoardO
 	RandomGenerator randomGenerator;
 
 	SharedAnyCamera camera;
-	HomogenousMatrices4 world_T_cameras;
-
-	std::vector<Vectors3> objectPointGroups;
-	std::vector<Vectors2> imagePointGroups;
 
-	objectPointGroups.reserve(numberObservations);
-	imagePointGroups.reserve(numberObservations);
+	const CalibrationBoardObservation& firstObservation = observations[0];
 
-	for (size_t nObservation = 0; nObservation < numberObservations; ++nObservation)
+	if (startWithFocalLength)
 	{
-		const CalibrationBoardObservation& observation = observations[nObservation];
-
-		if (!camera)
+		if (firstObservation.camera()->name() == AnyCameraFisheye::WrappedCamera::name())
 		{
-			if (startWithFocalLength)
-			{
-				if (observation.camera()->name() == AnyCameraFisheye::WrappedCamera::name())
-				{
-					const AnyCameraFisheye& anyCameraFisheye = (const AnyCameraFisheye&)(*observation.camera());
-					const FisheyeCamera& fisheyeCamera = anyCameraFisheye.actualCamera();
-
-					camera = std::make_shared<AnyCameraFisheye>(FisheyeCamera(fisheyeCamera.width(), fisheyeCamera.height(), fisheyeCamera.fovX()));
-				}
-				else
-				{
-					ocean_assert(observation.camera()->name() == AnyCameraPinhole::WrappedCamera::name());
-
-					const AnyCameraPinhole& anyCameraPinhole = (const AnyCameraPinhole&)(*observation.camera());
-					const PinholeCamera& pinholeCamera = anyCameraPinhole.actualCamera();
-
-					camera = std::make_shared<AnyCameraPinhole>(PinholeCamera(pinholeCamera.width(), pinholeCamera.height(), pinholeCamera.fovX()));
-				}
-			}
-			else
-			{
-				camera = observation.camera();
-			}
-		}
+			const AnyCameraFisheye& anyCameraFisheye = (const AnyCameraFisheye&)(*firstObservation.camera());
+			const FisheyeCamera& fisheyeCamera = anyCameraFisheye.actualCamera();
 
-		HomogenousMatrix4 world_T_camera;
-		if (Geometry::RANSAC::p3p(*camera, ConstArrayAccessor<Vector3>(observation.objectPoints()), ConstArrayAccessor<Vector2>(observation.imagePoints()), randomGenerator, world_T_camera))
-		{
-			world_T_cameras.push_back(world_T_camera);
+			camera = std::make_shared<AnyCameraFisheye>(FisheyeCamera(fisheyeCamera.width(), fisheyeCamera.height(), fisheyeCamera.fovX()));
 		}
 		else
 		{
-			ocean_assert(false && "This should never happen!");
-			world_T_cameras.push_back(observation.board_T_camera());
+			ocean_assert(firstObservation.camera()->name() == AnyCameraPinhole::WrappedCamera::name());
+
+			const AnyCameraPinhole& anyCameraPinhole = (const AnyCameraPinhole&)(*firstObservation.camera());
+			const PinholeCamera& pinholeCamera = anyCameraPinhole.actualCamera();
+
+			camera = std::make_shared<AnyCameraPinhole>(PinholeCamera(pinholeCamera.width(), pinholeCamera.height(), pinholeCamera.fovX()));
 		}
+	}
+	else
+	{
+		camera = firstObservation.camera();
+	}
 
-		objectPointGroups.push_back(observation.objectPoints());
-		imagePointGroups.push_back(observation.imagePoints());
+	// the initial poses of the individual observations are independent of each other
+
+	HomogenousMatrices4 world_T_cameras(numberObservations);
+
+	if (worker != nullptr && numberObservations > 1)
+	{
+		worker->executeFunction(Worker::Function::createStatic(&CameraCalibrator::determineInitialCameraPosesSubset, (const AnyCamera*)(camera.get()), observations, &randomGenerator, world_T_cameras.data(), 0u, 0u), 0u, (unsigned int)(numberObservations));
+	}
+	else
+	{
+		determineInitialCameraPosesSubset(camera.get(), observations, &randomGenerator, world_T_cameras.data(), 0u, (unsigned int)(numberObservations));
+	}
+
+	std::vector<Vectors3> objectPointGroups;
+	std::vector<Vectors2> imagePointGroups;
+
+	objectPointGroups.reserve(numberObservations);
+	imagePointGroups.reserve(numberObservations);
+
+	for (size_t nObservation = 0; nObservation < numberObservations; ++nObservation)
+	{
+		objectPointGroups.push_back(observations[nObservation].objectPoints());
+		imagePointGroups.push_back(observations[nObservation].imagePoints());
 	}
 
 	SharedAnyCamera optimizedCamera;
@@ -993,6 +1074,25 @@ SharedAnyCamera CameraCalibrator::determinePreciseCamera(const CalibrationBoardO
 	return optimizedCamera;
 }
 
+void CameraCalibrator::determineInitialCameraPosesSubset(const AnyCamera* camera, const CalibrationBoardObservation* observations, RandomGenerator* randomGenerator, HomogenousMatrix4* world_T_cameras, const unsigned int firstObservation, const unsigned int numberObservations)
+{
+	ocean_assert(camera != nullptr && camera->isValid());
+	ocean_assert(observations != nullptr && randomGenerator != nullptr && world_T_cameras != nullptr);
+
+	RandomGenerator localRandomGenerator(*randomGenerator);
+
+	for (unsigned int nObservation = firstObservation; nObservation < firstObservation + numberObservations; ++nObservation)
+	{
+		const CalibrationBoardObservation& observation = observations[nObservation];
+
+		if (!Geometry::RANSAC::p3p(*camera, ConstArrayAccessor<Vector3>(observation.objectPoints()), ConstArrayAccessor<Vector2>(observation.imagePoints()), localRandomGenerator, world_T_cameras[nObservation]))
+		{
+			ocean_assert(false && "This should never happen!");
+			world_T_cameras[nObservation] = observation.board_T_camera();
+		}
+	}
+}
+
 }
 
 }
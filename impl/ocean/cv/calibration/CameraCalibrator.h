@@ -120,6 +120,11 @@ class OCEAN_CV_CALIBRATION_EXPORT CameraCalibrator
 			IR_BOARD_WAS_DETECTED
 		};
 
+		/**
+		 * Definition of a vector holding image results.
+		 */
+		using ImageResults = std::vector<ImageResult>;
+
 		/**
 		 * Alias for the camera's optimization strategy.
 		 */
@@ -148,14 +153,28 @@ class OCEAN_CV_CALIBRATION_EXPORT CameraCalibrator
 		 */
 		ImageResult handleImage(const size_t imageId, const Frame& frame, Worker* worker = nullptr);
 
+		/**
+		 * Handles several images concurrently.
+		 * Each image is handled exactly like in handleImage(), the images are distributed across the threads of the worker while each thread uses an individual detection state.<br>
+		 * The resulting observations are added in the order of the given images, so that the result does not depend on the number of threads.<br>
+		 * Debug elements (if enabled) may show the state of any of the concurrently handled images.
+		 * @param imageIds The unique ids of the images, one for each frame, must be valid
+		 * @param frames The frames to handle, must be valid
+		 * @param numberImages The number of images, with range [1, infinity)
+		 * @param worker Optional worker object to distribute the computation
+		 * @return The results of the image handling, one for each image
+		 */
+		ImageResults handleImages(const size_t* imageIds, const Frame* frames, const size_t numberImages, Worker* worker = nullptr);
+
 		/**
 		 * Finalizes the calibration and determines the precise camera profile.
 		 * This function should be called after all images have been handled.
 		 * If the calibration stage transitions from CS_DETERMINE_INITIAL_CAMERA_FOV to CS_CALIBRATE_CAMERA, the observations will be cleared and an additional iteration is required.
 		 * @param needAdditionalIteration True, if the calibration requires an additional iteration (all images need to be processed again); False, if the calibration is complete
+		 * @param worker Optional worker object to distribute the computation
 		 * @return True, if succeeded
 		 */
-		bool finalize(bool& needAdditionalIteration);
+		bool finalize(bool& needAdditionalIteration, Worker* worker = nullptr);
 
 		/**
 		 * Returns the current calibration stage.
@@ -202,6 +221,17 @@ class OCEAN_CV_CALIBRATION_EXPORT CameraCalibrator
 
 	protected:
 
+		/**
+		 * Handles a subset of several images, each subset uses an individual calibrator holding the detection state.
+		 * @param imageIds The unique ids of all images, must be valid
+		 * @param frames All frames to handle, must be valid
+		 * @param imageResults The resulting image results, one for each image, must be valid
+		 * @param imageObservations The resulting observations, one for each image, valid if the calibration board was detected, must be valid
+		 * @param firstImage The first image to be handled
+		 * @param numberImages The number of images to be handled
+		 */
+		void handleImagesSubset(const size_t* imageIds, const Frame* frames, ImageResult* imageResults, CalibrationBoardObservation* imageObservations, const unsigned int firstImage, const unsigned int numberImages) const;
+
 		/**
 		 * Determines the initial camera pose based on marker candidates with known marker coordinate.
 		 * @param camera The camera profile defining the projection, must be valid
@@ -280,9 +310,21 @@ class OCEAN_CV_CALIBRATION_EXPORT CameraCalibrator
 		 * @param distortionRestrictionFactor The factor used to constrain higher-order distortion parameters based on lower-order ones during optimization, with range [0, infinity); 0 to disable restriction
 		 * @param initialError Optional resulting initial projection error, with range [0, infinity)
 		 * @param finalError Optional resulting final projection error, with range [0, infinity)
+		 * @param worker Optional worker object to distribute the computation of the initial camera poses
 		 * @return The resulting precise camera profile, nullptr if the camera profile could not be determined
 		 */
-		static SharedAnyCamera determinePreciseCamera(const CalibrationBoardObservation* observations, const size_t numberObservations, const OptimizationStrategy optimizationStrategy, HomogenousMatrices4* board_T_optimizedCameras = nullptr, const Geometry::Estimator::EstimatorType estimatorType = Geometry::Estimator::ET_SQUARE, const bool startWithFocalLength = true, const Scalar distortionRestrictionFactor = Scalar(2), Scalar* initialError = nullptr, Scalar* finalError = nullptr);
+		static SharedAnyCamera determinePreciseCamera(const CalibrationBoardObservation* observations, const size_t numberObservations, const OptimizationStrategy optimizationStrategy, HomogenousMatrices4* board_T_optimizedCameras = nullptr, const Geometry::Estimator::EstimatorType estimatorType = Geometry::Estimator::ET_SQUARE, const bool startWithFocalLength = true, const Scalar distortionRestrictionFactor = Scalar(2), Scalar* initialError = nullptr, Scalar* finalError = nullptr, Worker* worker = nullptr);
+
+		/**
+		 * Determines the initial camera poses for a subset of observations.
+		 * @param camera The camera profile to be used, must be valid
+		 * @param observations The observations of the calibration board, must be valid
+		 * @param randomGenerator The random generator to be used
+		 * @param world_T_cameras The resulting camera poses, one for each observation, must be valid
+		 * @param firstObservation The first observation to be handled
+		 * @param numberObservations The number of observations to be handled
+		 */
+		static void determineInitialCameraPosesSubset(const AnyCamera* camera, const CalibrationBoardObservation* observations, RandomGenerator* randomGenerator, HomogenousMatrix4* world_T_cameras, const unsigned int firstObservation, const unsigned int numberObservations);
 
 	protected:
 
@@ -0,0 +1,597 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "ocean/cv/depth/SemiGlobalMatching.h"
+
+#include "ocean/cv/FrameConverter.h"
+
+#include "ocean/math/Numeric.h"
+
+#include <bit>
+
+#if defined(OCEAN_HARDWARE_SSE_VERSION) && OCEAN_HARDWARE_SSE_VERSION >= 41
+	#include <smmintrin.h>
+#endif
+
+#if defined(OCEAN_HARDWARE_NEON_VERSION) && OCEAN_HARDWARE_NEON_VERSION >= 10
+	#include <arm_neon.h>
+#endif
+
+namespace Ocean
+{
+
+namespace CV
+{
+
+namespace Depth
+{
+
+bool SemiGlobalMatching::computeDisparityMap(const Frame& rectifiedFrameA, const Frame& rectifiedFrameB, const unsigned int minimalDisparity, const unsigned int maximalDisparity, Frame& disparityMap, const uint8_t penalty1, const uint8_t penalty2, const float maximalConsistencyError, Worker* worker)
+{
+	return computeDisparityMap(rectifiedFrameA, rectifiedFrameB, minimalDisparity, maximalDisparity, nullptr, 0u, disparityMap, penalty1, penalty2, maximalConsistencyError, worker);
+}
+
+bool SemiGlobalMatching::computeDisparityMap(const Frame& rectifiedFrameA, const Frame& rectifiedFrameB, const unsigned int minimalDisparity, const unsigned int maximalDisparity, const Frame& previousDisparityMap, const unsigned int searchRadius, Frame& disparityMap, const uint8_t penalty1, const uint8_t penalty2, const float maximalConsistencyError, Worker* worker)
+{
+	return computeDisparityMap(rectifiedFrameA, rectifiedFrameB, minimalDisparity, maximalDisparity, &previousDisparityMap, searchRadius, disparityMap, penalty1, penalty2, maximalConsistencyError, worker);
+}
+
+bool SemiGlobalMatching::computeDisparityMap(const Frame& rectifiedFrameA, const Frame& rectifiedFrameB, const unsigned int minimalDisparity, const unsigned int maximalDisparity, const Frame* previousDisparityMap, const unsigned int searchRadius, Frame& disparityMap, const uint8_t penalty1, const uint8_t penalty2, const float maximalConsistencyError, Worker* worker)
+{
+	ocean_assert(rectifiedFrameA.isValid() && rectifiedFrameB.isValid());
+	ocean_assert(minimalDisparity <= maximalDisparity && maximalDisparity - minimalDisparity < maximalNumberDisparities_);
+	ocean_assert(penalty1 <= penalty2 && penalty2 <= 230u);
+
+	if (!rectifiedFrameA.isValid() || rectifiedFrameA.width() != rectifiedFrameB.width() || rectifiedFrameA.height() != rectifiedFrameB.height() || rectifiedFrameA.pixelOrigin() != rectifiedFrameB.pixelOrigin())
+	{
+		return false;
+	}
+
+	if (minimalDisparity > maximalDisparity || maximalDisparity - minimalDisparity >= maximalNumberDisparities_ || penalty1 > penalty2 || penalty2 > 230u)
+	{
+		return false;
+	}
+
+	const unsigned int width = rectifiedFrameA.width();
+	const unsigned int height = rectifiedFrameA.height();
+
+	unsigned int rangeMinimalDisparity = minimalDisparity;
+	unsigned int rangeMaximalDisparity = maximalDisparity;
+
+	const float* previousDisparities = nullptr;
+	unsigned int previousDisparitiesPaddingElements = 0u;
+
+	if (previousDisparityMap != nullptr)
+	{
+		ocean_assert(previousDisparityMap != &disparityMap);
+
+		if (previousDisparityMap == &disparityMap || previousDisparityMap->pixelFormat() != FrameType::FORMAT_F32 || previousDisparityMap->width() != width || previousDisparityMap->height() != height || previousDisparityMap->pixelOrigin() != rectifiedFrameA.pixelOrigin())
+		{
+			return false;
+		}
+
+		previousDisparities = previousDisparityMap->constdata<float>();
+		previousDisparitiesPaddingElements = previousDisparityMap->paddingElements();
+
+		// we determine the disparity range covered by all valid previous disparities
+
+		float lowestDisparity = NumericF::maxValue();
+		float highestDisparity = NumericF::minValue();
+
+		for (unsigned int y = 0u; y < height; ++y)
+		{
+			const float* previousRow = previousDisparityMap->constrow<float>(y);
+
+			for (unsigned int x = 0u; x < width; ++x)
+			{
+				if (!NumericF::isNan(previousRow[x]) && !NumericF::isInf(previousRow[x]))
+				{
+					lowestDisparity = std::min(lowestDisparity, previousRow[x]);
+					highestDisparity = std::max(highestDisparity, previousRow[x]);
+				}
+			}
+		}
+
+		if (lowestDisparity <= highestDisparity)
+		{
+			const int lowest = int(NumericF::floor(std::max(lowestDisparity, 0.0f))) - int(searchRadius);
+			const int highest = int(NumericF::ceil(std::min(highestDisparity, float(maximalDisparity)))) + int(searchRadius);
+
+			const unsigned int clampedLowest = (unsigned int)(std::max(lowest, int(minimalDisparity)));
+			const unsigned int clampedHighest = (unsigned int)(std::min(highest, int(maximalDisparity)));
+
+			if (clampedLowest <= clampedHighest)
+			{
+				rangeMinimalDisparity = clampedLowest;
+				rangeMaximalDisparity = clampedHighest;
+			}
+		}
+	}
+
+	Frame yFrameA;
+	Frame yFrameB;
+	if (!FrameConverter::Comfort::convert(rectifiedFrameA, FrameType::FORMAT_Y8, yFrameA, FrameConverter::CP_AVOID_COPY_IF_POSSIBLE, worker)
+			|| !FrameConverter::Comfort::convert(rectifiedFrameB, FrameType::FORMAT_Y8, yFrameB, FrameConverter::CP_AVOID_COPY_IF_POSSIBLE, worker))
+	{
+		return false;
+	}
+
+	std::vector<uint32_t> censusA(size_t(width) * size_t(height));
+	std::vector<uint32_t> censusB(censusA.size());
+
+	if (worker != nullptr)
+	{
+		worker->executeFunction(Worker::Function::createStatic(&SemiGlobalMatching::censusTransformSubset, yFrameA.constdata<uint8_t>(), width, height, yFrameA.paddingElements(), censusA.data(), 0u, 0u), 0u, height, 5u, 6u, 20u);
+		worker->executeFunction(Worker::Function::createStatic(&SemiGlobalMatching::censusTransformSubset, yFrameB.constdata<uint8_t>(), width, height, yFrameB.paddingElements(), censusB.data(), 0u, 0u), 0u, height, 5u, 6u, 20u);
+	}
+	else
+	{
+		censusTransformSubset(yFrameA.constdata<uint8_t>(), width, height, yFrameA.paddingElements(), censusA.data(), 0u, height);
+		censusTransformSubset(yFrameB.constdata<uint8_t>(), width, height, yFrameB.paddingElements(), censusB.data(), 0u, height);
+	}
+
+	if (!disparityMap.set(FrameType(rectifiedFrameA.frameType(), FrameType::FORMAT_F32), true /*forceOwner*/, true /*forceWritable*/))
+	{
+		return false;
+	}
+
+	const unsigned int numberDisparities = rangeMaximalDisparity - rangeMinimalDisparity + 1u;
+
+	// the bands do not depend on the worker, so that the result is identical with and without worker
+
+	const unsigned int bands = numberBands(height);
+
+	if (worker != nullptr)
+	{
+		worker->executeFunction(Worker::Function::createStatic(&SemiGlobalMatching::computeDisparityMapBands, (const uint32_t*)(censusA.data()), (const uint32_t*)(censusB.data()), width, height, rangeMinimalDisparity, numberDisparities, previousDisparities, previousDisparitiesPaddingElements, searchRadius, penalty1, penalty2, maximalConsistencyError, disparityMap.data<float>(), disparityMap.paddingElements(), bands, 0u, 0u), 0u, bands, 15u, 16u, 1u);
+	}
+	else
+	{
+		computeDisparityMapBands(censusA.data(), censusB.data(), width, height, rangeMinimalDisparity, numberDisparities, previousDisparities, previousDisparitiesPaddingElements, searchRadius, penalty1, penalty2, maximalConsistencyError, disparityMap.data<float>(), disparityMap.paddingElements(), bands, 0u, bands);
+	}
+
+	return true;
+}
+
+void SemiGlobalMatching::censusTransformSubset(const uint8_t* frame, const unsigned int width, const unsigned int height, const unsigned int framePaddingElements, uint32_t* census, const unsigned int firstRow, const unsigned int numberRows)
+{
+	ocean_assert(frame != nullptr && census != nullptr);
+	ocean_assert(width >= 1u && height >= 1u);
+	ocean_assert(firstRow + numberRows <= height);
+
+	const unsigned int frameStrideElements = width + framePaddingElements;
+
+	for (unsigned int y = firstRow; y < firstRow + numberRows; ++y)
+	{
+		const uint8_t* rows[5];
+
+		for (int yOffset = -2; yOffset <= 2; ++yOffset)
+		{
+			const unsigned int yClamped = (unsigned int)(minmax<int>(0, int(y) + yOffset, int(height) - 1));
+
+			rows[yOffset + 2] = frame + yClamped * frameStrideElements;
+		}
+
+		uint32_t* censusRow = census + y * width;
+
+		for (unsigned int x = 0u; x < width; ++x)
+		{
+			const uint8_t center = rows[2][x];
+
+			unsigned int columns[5];
+
+			for (int xOffset = -2; xOffset <= 2; ++xOffset)
+			{
+				columns[xOffset + 2] = (unsigned int)(minmax<int>(0, int(x) + xOffset, int(width) - 1));
+			}
+
+			uint32_t value = 0u;
+
+			for (unsigned int yy = 0u; yy < 5u; ++yy)
+			{
+				for (unsigned int xx = 0u; xx < 5u; ++xx)
+				{
+					if (yy != 2u || xx != 2u)
+					{
+						value = (value << 1u) | uint32_t(rows[yy][columns[xx]] > center);
+					}
+				}
+			}
+
+			censusRow[x] = value;
+		}
+	}
+}
+
+void SemiGlobalMatching::computeDisparityMapBands(const uint32_t* censusA, const uint32_t* censusB, const unsigned int width, const unsigned int height, const unsigned int minimalDisparity, const unsigned int numberDisparities, const float* previousDisparities, const unsigned int previousDisparitiesPaddingElements, const unsigned int searchRadius, const uint8_t penalty1, const uint8_t penalty2, const float maximalConsistencyError, float* disparities, const unsigned int disparitiesPaddingElements, const unsigned int bands, const unsigned int firstBand, const unsigned int numberBandsToHandle)
+{
+	ocean_assert(bands == numberBands(height));
+	ocean_assert(firstBand + numberBandsToHandle <= bands);
+
+	for (unsigned int band = firstBand; band < firstBand + numberBandsToHandle; ++band)
+	{
+		const unsigned int firstRow = bandFirstRow(band, bands, height);
+		const unsigned int endRow = bandFirstRow(band + 1u, bands, height);
+		ocean_assert(firstRow < endRow);
+
+		computeDisparityMapSubset(censusA, censusB, width, height, minimalDisparity, numberDisparities, previousDisparities, previousDisparitiesPaddingElements, searchRadius, penalty1, penalty2, maximalConsistencyError, disparities, disparitiesPaddingElements, firstRow, endRow - firstRow);
+	}
+}
+
+void SemiGlobalMatching::computeDisparityMapSubset(const uint32_t* censusA, const uint32_t* censusB, const unsigned int width, const unsigned int height, const unsigned int minimalDisparity, const unsigned int numberDisparities, const float* previousDisparities, const unsigned int previousDisparitiesPaddingElements, const unsigned int searchRadius, const uint8_t penalty1, const uint8_t penalty2, const float maximalConsistencyError, float* disparities, const unsigned int disparitiesPaddingElements, const unsigned int firstRow, const unsigned int numberRows)
+{
+	ocean_assert(censusA != nullptr && censusB != nullptr && disparities != nullptr);
+	ocean_assert(numberDisparities >= 1u && numberDisparities <= maximalNumberDisparities_);
+	ocean_assert(firstRow + numberRows <= height);
+
+	// each pixel has at least one padding disparity with invalid cost, so that neighboring pixels are separated in memory
+
+	const unsigned int alignedDisparities = (numberDisparities + 1u + 15u) / 16u * 16u;
+
+	const unsigned int bandFirstRow = firstRow > bandMarginRows_ ? firstRow - bandMarginRows_ : 0u;
+	const unsigned int bandEndRow = std::min(firstRow + numberRows + bandMarginRows_, height);
+	const unsigned int bandRows = bandEndRow - bandFirstRow;
+
+	const size_t rowElements = size_t(width) * size_t(alignedDisparities);
+
+	std::vector<uint8_t> costs(size_t(bandRows) * rowElements, invalidCost_);
+	std::vector<uint16_t> sumCosts(costs.size(), 0u);
+
+	// matching costs, the Hamming distance between the census values
+
+	for (unsigned int y = 0u; y < bandRows; ++y)
+	{
+		const unsigned int row = bandFirstRow + y;
+
+		const uint32_t* censusRowA = censusA + row * width;
+		const uint32_t* censusRowB = censusB + row * width;
+
+		const float* previousRow = previousDisparities != nullptr ? previousDisparities + row * (width + previousDisparitiesPaddingElements) : nullptr;
+
+		uint8_t* costRow = costs.data() + y * rowElements;
+
+		for (unsigned int x = minimalDisparity; x < width; ++x)
+		{
+			unsigned int disparityStart = 0u;
+			unsigned int disparityEnd = std::min(numberDisparities, x - minimalDisparity + 1u);
+
+			if (previousRow != nullptr && !NumericF::isNan(previousRow[x]) && !NumericF::isInf(previousRow[x]))
+			{
+				const int center = int(NumericF::round32(previousRow[x])) - int(minimalDisparity);
+
+				const unsigned int restrictedStart = (unsigned int)(std::max(0, center - int(searchRadius)));
+				const unsigned int restrictedEnd = (unsigned int)(std::max(0, std::min(int(disparityEnd), center + int(searchRadius) + 1)));
+
+				if (restrictedStart < restrictedEnd)
+				{
+					disparityStart = restrictedStart;
+					disparityEnd = restrictedEnd;
+				}
+			}
+
+			uint8_t* costPixel = costRow + x * alignedDisparities;
+
+			const uint32_t valueA = censusRowA[x];
+			const uint32_t* valueB = censusRowB + x - minimalDisparity;
+
+			for (unsigned int d = disparityStart; d < disparityEnd; ++d)
+			{
+				costPixel[d] = uint8_t(std::popcount(valueA ^ *(valueB - d)));
+			}
+		}
+	}
+
+	// path aggregation, the first pass handles the paths from left, top-left, top, and top-right, the second pass the mirrored paths
+
+	constexpr size_t bufferPaddingElements = 16;
+
+	const size_t bufferElements = rowElements + bufferPaddingElements * 2;
+
+	std::vector<uint8_t> pathMemory(bufferElements * 7, invalidCost_);
+	std::vector<uint8_t> zeroPathMemory(alignedDisparities + bufferPaddingElements * 2, 0u);
+
+	uint8_t* const horizontalPath = pathMemory.data() + bufferPaddingElements;
+	const uint8_t* const zeroPath = zeroPathMemory.data() + bufferPaddingElements;
+
+	uint8_t* previousPaths[3];
+	uint8_t* currentPaths[3];
+
+	for (unsigned int n = 0u; n < 3u; ++n)
+	{
+		previousPaths[n] = pathMemory.data() + bufferElements * (1 + n) + bufferPaddingElements;
+		currentPaths[n] = pathMemory.data() + bufferElements * (4 + n) + bufferPaddingElements;
+	}
+
+	std::vector<uint8_t> minimaMemory(size_t(width) * 6, 0u);
+
+	uint8_t* previousMinima[3];
+	uint8_t* currentMinima[3];
+
+	for (unsigned int n = 0u; n < 3u; ++n)
+	{
+		previousMinima[n] = minimaMemory.data() + width * n;
+		currentMinima[n] = minimaMemory.data() + width * (3u + n);
+	}
+
+	for (unsigned int pass = 0u; pass < 2u; ++pass)
+	{
+		const bool forward = pass == 0u;
+
+		for (unsigned int yStep = 0u; yStep < bandRows; ++yStep)
+		{
+			const unsigned int y = forward ? yStep : bandRows - yStep - 1u;
+
+			uint8_t horizontalMinimum = 0u;
+
+			for (unsigned int xStep = 0u; xStep < width; ++xStep)
+			{
+				const unsigned int x = forward ? xStep : width - xStep - 1u;
+
+				const size_t pixelOffset = y * rowElements + x * alignedDisparities;
+
+				const uint8_t* pixelCosts = costs.data() + pixelOffset;
+				uint16_t* pixelSumCosts = sumCosts.data() + pixelOffset;
+
+				// the horizontal path along the row
+
+				const uint8_t* previousHorizontalPath = zeroPath;
+
+				if (xStep != 0u)
+				{
+					const unsigned int previousX = forward ? x - 1u : x + 1u;
+
+					previousHorizontalPath = horizontalPath + previousX * alignedDisparities;
+				}
+
+				horizontalMinimum = aggregatePixel(pixelCosts, previousHorizontalPath, xStep != 0u ? horizontalMinimum : 0u, horizontalPath + x * alignedDisparities, pixelSumCosts, alignedDisparities, penalty1, penalty2);
+
+				// the diagonal and vertical paths from the previous row
+
+				for (unsigned int n = 0u; n < 3u; ++n)
+				{
+					const int previousX = int(x) + int(n) - 1;
+
+					const uint8_t* previousPath = zeroPath;
+					uint8_t previousMinimum = 0u;
+
+					if (yStep != 0u && previousX >= 0 && previousX < int(width))
+					{
+						previousPath = previousPaths[n] + previousX * alignedDisparities;
+						previousMinimum = previousMinima[n][previousX];
+					}
+
+					currentMinima[n][x] = aggregatePixel(pixelCosts, previousPath, previousMinimum, currentPaths[n] + x * alignedDisparities, pixelSumCosts, alignedDisparities, penalty1, penalty2);
+				}
+			}
+
+			for (unsigned int n = 0u; n < 3u; ++n)
+			{
+				std::swap(previousPaths[n], currentPaths[n]);
+				std::swap(previousMinima[n], currentMinima[n]);
+			}
+		}
+	}
+
+	// winner-takes-all with sub-pixel refinement, and left-right consistency check
+
+	const unsigned int disparitiesStrideElements = width + disparitiesPaddingElements;
+
+	Indices32 bestDisparitiesA(width);
+	Indices32 bestDisparitiesB(width);
+
+	for (unsigned int y = firstRow - bandFirstRow; y < firstRow - bandFirstRow + numberRows; ++y)
+	{
+		const uint8_t* costRow = costs.data() + y * rowElements;
+		const uint16_t* sumCostRow = sumCosts.data() + y * rowElements;
+
+		for (unsigned int x = 0u; x < width; ++x)
+		{
+			const uint8_t* pixelCosts = costRow + x * alignedDisparities;
+			const uint16_t* pixelSumCosts = sumCostRow + x * alignedDisparities;
+
+			unsigned int bestDisparity = (unsigned int)(-1);
+			uint16_t bestSumCost = uint16_t(-1);
+
+			for (unsigned int d = 0u; d < numberDisparities; ++d)
+			{
+				if (pixelCosts[d] != invalidCost_ && pixelSumCosts[d] < bestSumCost)
+				{
+					bestSumCost = pixelSumCosts[d];
+					bestDisparity = d;
+				}
+			}
+
+			bestDisparitiesA[x] = bestDisparity;
+		}
+
+		if (maximalConsistencyError >= 0.0f)
+		{
+			for (unsigned int xB = 0u; xB < width; ++xB)
+			{
+				unsigned int bestDisparity = (unsigned int)(-1);
+				uint16_t bestSumCost = uint16_t(-1);
+
+				for (unsigned int d = 0u; d < numberDisparities && xB + minimalDisparity + d < width; ++d)
+				{
+					const size_t elementOffset = (xB + minimalDisparity + d) * alignedDisparities + d;
+
+					if (costRow[elementOffset] != invalidCost_ && sumCostRow[elementOffset] < bestSumCost)
+					{
+						bestSumCost = sumCostRow[elementOffset];
+						bestDisparity = d;
+					}
+				}
+
+				bestDisparitiesB[xB] = bestDisparity;
+			}
+		}
+
+		float* disparityRow = disparities + (bandFirstRow + y) * disparitiesStrideElements;
+
+		for (unsigned int x = 0u; x < width; ++x)
+		{
+			const unsigned int bestDisparity = bestDisparitiesA[x];
+
+			if (bestDisparity == (unsigned int)(-1))
+			{
+				disparityRow[x] = NumericF::nan();
+				continue;
+			}
+
+			if (maximalConsistencyError >= 0.0f)
+			{
+				const unsigned int xB = x - minimalDisparity - bestDisparity;
+				ocean_assert(xB < width);
+
+				if (bestDisparitiesB[xB] == (unsigned int)(-1) || float(std::abs(int(bestDisparitiesB[xB]) - int(bestDisparity))) > maximalConsistencyError)
+				{
+					disparityRow[x] = NumericF::nan();
+					continue;
+				}
+			}
+
+			const uint8_t* pixelCosts = costRow + x * alignedDisparities;
+			const uint16_t* pixelSumCosts = sumCostRow + x * alignedDisparities;
+
+			float subPixelOffset = 0.0f;
+
+			if (bestDisparity >= 1u && bestDisparity + 1u < numberDisparities && pixelCosts[bestDisparity - 1u] != invalidCost_ && pixelCosts[bestDisparity + 1u] != invalidCost_)
+			{
+				const int costMinus = int(pixelSumCosts[bestDisparity - 1u]);
+				const int cost = int(pixelSumCosts[bestDisparity]);
+				const int costPlus = int(pixelSumCosts[bestDisparity + 1u]);
+
+				const int denominator = costMinus - 2 * cost + costPlus;
+
+				if (denominator > 0)
+				{
+					subPixelOffset = float(costMinus - costPlus) / float(2 * denominator);
+					ocean_assert(subPixelOffset >= -0.5f && subPixelOffset <= 0.5f);
+				}
+			}
+
+			disparityRow[x] = float(minimalDisparity + bestDisparity) + subPixelOffset;
+		}
+	}
+}
+
+inline uint8_t SemiGlobalMatching::aggregatePixel(const uint8_t* costs, const uint8_t* previousPathCosts, const uint8_t previousMinimalPathCost, uint8_t* pathCosts, uint16_t* sumCosts, const unsigned int alignedDisparities, const uint8_t penalty1, const uint8_t penalty2)
+{
+	ocean_assert(costs != nullptr && previousPathCosts != nullptr && pathCosts != nullptr && sumCosts != nullptr);
+	ocean_assert(alignedDisparities >= 16u && alignedDisparities % 16u == 0u);
+
+	const uint8_t previousMinimalPathCostPenalty2 = uint8_t(std::min(int(previousMinimalPathCost) + int(penalty2), 0xFF));
+
+#if defined(OCEAN_HARDWARE_SSE_VERSION) && OCEAN_HARDWARE_SSE_VERSION >= 41
+
+	const __m128i penalty1_u_8x16 = _mm_set1_epi8(char(penalty1));
+	const __m128i previousMinimum_u_8x16 = _mm_set1_epi8(char(previousMinimalPathCost));
+	const __m128i previousMinimumPenalty2_u_8x16 = _mm_set1_epi8(char(previousMinimalPathCostPenalty2));
+	const __m128i zero_u_8x16 = _mm_setzero_si128();
+
+	__m128i minimum_u_8x16 = _mm_set1_epi8(char(0xFF));
+
+	for (unsigned int d = 0u; d < alignedDisparities; d += 16u)
+	{
+		const __m128i previous_u_8x16 = _mm_loadu_si128((const __m128i*)(previousPathCosts + d));
+		const __m128i previousLower_u_8x16 = _mm_loadu_si128((const __m128i*)(previousPathCosts + d - 1));
+		const __m128i previousHigher_u_8x16 = _mm_loadu_si128((const __m128i*)(previousPathCosts + d + 1));
+
+		__m128i transition_u_8x16 = _mm_min_epu8(previous_u_8x16, _mm_adds_epu8(previousLower_u_8x16, penalty1_u_8x16));
+		transition_u_8x16 = _mm_min_epu8(transition_u_8x16, _mm_adds_epu8(previousHigher_u_8x16, penalty1_u_8x16));
+		transition_u_8x16 = _mm_min_epu8(transition_u_8x16, previousMinimumPenalty2_u_8x16);
+
+		const __m128i pathCost_u_8x16 = _mm_adds_epu8(_mm_loadu_si128((const __m128i*)(costs + d)), _mm_subs_epu8(transition_u_8x16, previousMinimum_u_8x16));
+
+		_mm_storeu_si128((__m128i*)(pathCosts + d), pathCost_u_8x16);
+
+		minimum_u_8x16 = _mm_min_epu8(minimum_u_8x16, pathCost_u_8x16);
+
+		__m128i sumLow_u_16x8 = _mm_loadu_si128((const __m128i*)(sumCosts + d));
+		__m128i sumHigh_u_16x8 = _mm_loadu_si128((const __m128i*)(sumCosts + d + 8u));
+
+		sumLow_u_16x8 = _mm_add_epi16(sumLow_u_16x8, _mm_unpacklo_epi8(pathCost_u_8x16, zero_u_8x16));
+		sumHigh_u_16x8 = _mm_add_epi16(sumHigh_u_16x8, _mm_unpackhi_epi8(pathCost_u_8x16, zero_u_8x16));
+
+		_mm_storeu_si128((__m128i*)(sumCosts + d), sumLow_u_16x8);
+		_mm_storeu_si128((__m128i*)(sumCosts + d + 8u), sumHigh_u_16x8);
+	}
+
+	minimum_u_8x16 = _mm_min_epu8(minimum_u_8x16, _mm_srli_si128(minimum_u_8x16, 8));
+	minimum_u_8x16 = _mm_min_epu8(minimum_u_8x16, _mm_srli_si128(minimum_u_8x16, 4));
+	minimum_u_8x16 = _mm_min_epu8(minimum_u_8x16, _mm_srli_si128(minimum_u_8x16, 2));
+	minimum_u_8x16 = _mm_min_epu8(minimum_u_8x16, _mm_srli_si128(minimum_u_8x16, 1));
+
+	return uint8_t(_mm_cvtsi128_si32(minimum_u_8x16) & 0xFF);
+
+#elif defined(OCEAN_HARDWARE_NEON_VERSION) && OCEAN_HARDWARE_NEON_VERSION >= 10
+
+	const uint8x16_t penalty1_u_8x16 = vdupq_n_u8(penalty1);
+	const uint8x16_t previousMinimum_u_8x16 = vdupq_n_u8(previousMinimalPathCost);
+	const uint8x16_t previousMinimumPenalty2_u_8x16 = vdupq_n_u8(previousMinimalPathCostPenalty2);
+
+	uint8x16_t minimum_u_8x16 = vdupq_n_u8(0xFFu);
+
+	for (unsigned int d = 0u; d < alignedDisparities; d += 16u)
+	{
+		const uint8x16_t previous_u_8x16 = vld1q_u8(previousPathCosts + d);
+		const uint8x16_t previousLower_u_8x16 = vld1q_u8(previousPathCosts + d - 1);
+		const uint8x16_t previousHigher_u_8x16 = vld1q_u8(previousPathCosts + d + 1);
+
+		uint8x16_t transition_u_8x16 = vminq_u8(previous_u_8x16, vqaddq_u8(previousLower_u_8x16, penalty1_u_8x16));
+		transition_u_8x16 = vminq_u8(transition_u_8x16, vqaddq_u8(previousHigher_u_8x16, penalty1_u_8x16));
+		transition_u_8x16 = vminq_u8(transition_u_8x16, previousMinimumPenalty2_u_8x16);
+
+		const uint8x16_t pathCost_u_8x16 = vqaddq_u8(vld1q_u8(costs + d), vqsubq_u8(transition_u_8x16, previousMinimum_u_8x16));
+
+		vst1q_u8(pathCosts + d, pathCost_u_8x16);
+
+		minimum_u_8x16 = vminq_u8(minimum_u_8x16, pathCost_u_8x16);
+
+		vst1q_u16(sumCosts + d, vaddw_u8(vld1q_u16(sumCosts + d), vget_low_u8(pathCost_u_8x16)));
+		vst1q_u16(sumCosts + d + 8u, vaddw_u8(vld1q_u16(sumCosts + d + 8u), vget_high_u8(pathCost_u_8x16)));
+	}
+
+	#ifdef __aarch64__
+		return vminvq_u8(minimum_u_8x16);
+	#else
+		uint8x8_t minimum_u_8x8 = vpmin_u8(vget_low_u8(minimum_u_8x16), vget_high_u8(minimum_u_8x16));
+		minimum_u_8x8 = vpmin_u8(minimum_u_8x8, minimum_u_8x8);
+		minimum_u_8x8 = vpmin_u8(minimum_u_8x8, minimum_u_8x8);
+		minimum_u_8x8 = vpmin_u8(minimum_u_8x8, minimum_u_8x8);
+
+		return vget_lane_u8(minimum_u_8x8, 0);
+	#endif
+
+#else
+
+	uint8_t minimum = 0xFFu;
+
+	for (unsigned int d = 0u; d < alignedDisparities; ++d)
+	{
+		int transition = std::min(int(previousPathCosts[d]), int(previousMinimalPathCostPenalty2));
+		transition = std::min(transition, std::min(int(previousPathCosts[int(d) - 1]) + int(penalty1), 0xFF));
+		transition = std::min(transition, std::min(int(previousPathCosts[d + 1u]) + int(penalty1), 0xFF));
+
+		const uint8_t pathCost = uint8_t(std::min(int(costs[d]) + transition - int(previousMinimalPathCost), 0xFF));
+
+		pathCosts[d] = pathCost;
+		sumCosts[d] = uint16_t(sumCosts[d] + pathCost);
+
+		minimum = std::min(minimum, pathCost);
+	}
+
+	return minimum;
+
+#endif
+}
+
+}
+
+}
+
+}
@@ -0,0 +1,206 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#ifndef META_OCEAN_CV_DEPTH_SEMI_GLOBAL_MATCHING_H
+#define META_OCEAN_CV_DEPTH_SEMI_GLOBAL_MATCHING_H
+
+#include "ocean/cv/depth/Depth.h"
+
+#include "ocean/base/Frame.h"
+#include "ocean/base/Worker.h"
+
+namespace Ocean
+{
+
+namespace CV
+{
+
+namespace Depth
+{
+
+/**
+ * This class implements a dense stereo matcher based on Semi-Global Matching.
+ * The matcher determines a disparity map for two rectified images, e.g., images created with Rectifier::rectify().<br>
+ * The matching cost is the Hamming distance between 5x5 census transforms, the costs are aggregated along 8 paths with 8 bit precision, the sum of all paths is stored with 16 bit precision.<br>
+ * A pixel (x, y) in the first image corresponds with the pixel (x - disparity, y) in the second image, the images need to be exchanged if the rectified cameras are arranged the other way around.<br>
+ * The resulting disparity map has pixel format FORMAT_F32 and holds NaN for pixels without valid disparity, so that the map can be post-processed with Disparity::fillHolesDisparityMap().<br>
+ * The image is separated into horizontal bands, the paths in vertical and diagonal directions start in an overlapping margin of each band.<br>
+ * The bands depend on the image height only, so that the resulting disparity map is identical with and without worker, a worker processes the bands in parallel.
+ * @ingroup cvdepth
+ */
+class OCEAN_CV_DEPTH_EXPORT SemiGlobalMatching
+{
+	public:
+
+		/// The maximal number of disparities which can be tested, (maximalDisparity - minimalDisparity + 1).
+		static constexpr unsigned int maximalNumberDisparities_ = 240u;
+
+	protected:
+
+		/// The number of rows each band is extended at the top and bottom when separating the image into bands.
+		static constexpr unsigned int bandMarginRows_ = 24u;
+
+		/// The approximate number of rows of each band, significantly larger than the overlapping margin.
+		static constexpr unsigned int bandRows_ = bandMarginRows_ * 8u;
+
+		/// The cost value of disparities which are not tested, e.g., because the corresponding pixel is outside of the second image.
+		static constexpr uint8_t invalidCost_ = 0xFFu;
+
+	public:
+
+		/**
+		 * Determines the disparity map for two rectified images.
+		 * @param rectifiedFrameA The first rectified image, will be converted to FORMAT_Y8 if necessary, must be valid
+		 * @param rectifiedFrameB The second rectified image, with same resolution as the first image, will be converted to FORMAT_Y8 if necessary, must be valid
+		 * @param minimalDisparity The minimal disparity to be tested, in pixel, with range [0, maximalDisparity]
+		 * @param maximalDisparity The maximal disparity to be tested, in pixel, with range [minimalDisparity, minimalDisparity + maximalNumberDisparities_ - 1]
+		 * @param disparityMap The resulting disparity map with pixel format FORMAT_F32 and resolution of the first image, NaN for invalid pixels
+		 * @param penalty1 The penalty for disparity changes of one pixel between neighboring pixels, with range [0, penalty2]
+		 * @param penalty2 The penalty for disparity changes of more than one pixel between neighboring pixels, with range [penalty1, 230]
+		 * @param maximalConsistencyError The maximal difference between the disparities of both images (left-right consistency check) in pixel, with range [0, infinity), a negative value to skip the check
+		 * @param worker Optional worker object to distribute the computation
+		 * @return True, if succeeded
+		 */
+		static bool computeDisparityMap(const Frame& rectifiedFrameA, const Frame& rectifiedFrameB, const unsigned int minimalDisparity, const unsigned int maximalDisparity, Frame& disparityMap, const uint8_t penalty1 = 8u, const uint8_t penalty2 = 48u, const float maximalConsistencyError = 1.0f, Worker* worker = nullptr);
+
+		/**
+		 * Determines the disparity map for two rectified images while using the disparity map of the previous frame to restrict the disparity range (coarse-to-fine mode).
+		 * Each pixel with valid previous disparity is tested within [previousDisparity - searchRadius, previousDisparity + searchRadius] only.<br>
+		 * Pixels without valid previous disparity are tested within the range covered by all valid previous disparities, the entire range is tested if the previous map does not have any valid disparity.<br>
+		 * As the matcher only processes the range covered by the previous disparities, the matching is significantly faster than testing the entire range for scenes with limited depth range.
+		 * @param rectifiedFrameA The first rectified image, will be converted to FORMAT_Y8 if necessary, must be valid
+		 * @param rectifiedFrameB The second rectified image, with same resolution as the first image, will be converted to FORMAT_Y8 if necessary, must be valid
+		 * @param minimalDisparity The minimal disparity to be tested, in pixel, with range [0, maximalDisparity]
+		 * @param maximalDisparity The maximal disparity to be tested, in pixel, with range [minimalDisparity, minimalDisparity + maximalNumberDisparities_ - 1]
+		 * @param previousDisparityMap The disparity map of the previous frame with pixel format FORMAT_F32 and resolution of the first image, must be valid
+		 * @param searchRadius The radius around the previous disparities to be tested, in pixel, with range [0, infinity)
+		 * @param disparityMap The resulting disparity map with pixel format FORMAT_F32 and resolution of the first image, NaN for invalid pixels, must not be the previous disparity map
+		 * @param penalty1 The penalty for disparity changes of one pixel between neighboring pixels, with range [0, penalty2]
+		 * @param penalty2 The penalty for disparity changes of more than one pixel between neighboring pixels, with range [penalty1, 230]
+		 * @param maximalConsistencyError The maximal difference between the disparities of both images (left-right consistency check) in pixel, with range [0, infinity), a negative value to skip the check
+		 * @param worker Optional worker object to distribute the computation
+		 * @return True, if succeeded
+		 */
+		static bool computeDisparityMap(const Frame& rectifiedFrameA, const Frame& rectifiedFrameB, const unsigned int minimalDisparity, const unsigned int maximalDisparity, const Frame& previousDisparityMap, const unsigned int searchRadius, Frame& disparityMap, const uint8_t penalty1 = 8u, const uint8_t penalty2 = 48u, const float maximalConsistencyError = 1.0f, Worker* worker = nullptr);
+
+	protected:
+
+		/**
+		 * Determines the disparity map for two rectified images with optional previous disparity map.
+		 * @see computeDisparityMap().
+		 */
+		static bool computeDisparityMap(const Frame& rectifiedFrameA, const Frame& rectifiedFrameB, const unsigned int minimalDisparity, const unsigned int maximalDisparity, const Frame* previousDisparityMap, const unsigned int searchRadius, Frame& disparityMap, const uint8_t penalty1, const uint8_t penalty2, const float maximalConsistencyError, Worker* worker);
+
+		/**
+		 * Applies the 5x5 census transform for a subset of a grayscale image.
+		 * Each census value holds 24 bits, one bit for each neighbor pixel which is brighter than the center pixel, pixels outside of the image are clamped to the border.
+		 * @param frame The grayscale image, must be valid
+		 * @param width The width of the image in pixel, with range [1, infinity)
+		 * @param height The height of the image in pixel, with range [1, infinity)
+		 * @param framePaddingElements The number of padding elements at the end of each image row, in elements, with range [0, infinity)
+		 * @param census The resulting census values, one for each pixel without padding, must be valid
+		 * @param firstRow The first row to be handled, with range [0, height - 1]
+		 * @param numberRows The number of rows to be handled, with range [1, height - firstRow]
+		 */
+		static void censusTransformSubset(const uint8_t* frame, const unsigned int width, const unsigned int height, const unsigned int framePaddingElements, uint32_t* census, const unsigned int firstRow, const unsigned int numberRows);
+
+		/**
+		 * Returns the number of bands into which an image is separated.
+		 * @param height The height of the image in pixel, with range [1, infinity)
+		 * @return The number of bands, with range [1, height]
+		 */
+		static inline unsigned int numberBands(const unsigned int height);
+
+		/**
+		 * Returns the first row of a band.
+		 * @param band The index of the band, with range [0, bands]
+		 * @param bands The number of bands, see numberBands()
+		 * @param height The height of the image in pixel, with range [1, infinity)
+		 * @return The first row of the band, the image height for band == bands
+		 */
+		static inline unsigned int bandFirstRow(const unsigned int band, const unsigned int bands, const unsigned int height);
+
+		/**
+		 * Determines the disparities for a subset of bands.
+		 * @param censusA The census values of the first image, must be valid
+		 * @param censusB The census values of the second image, must be valid
+		 * @param width The width of both images in pixel, with range [1, infinity)
+		 * @param height The height of both images in pixel, with range [1, infinity)
+		 * @param minimalDisparity The minimal disparity to be tested, with range [0, infinity)
+		 * @param numberDisparities The number of disparities to be tested, with range [1, maximalNumberDisparities_]
+		 * @param previousDisparities The disparities of the previous frame, nullptr to test all disparities for each pixel
+		 * @param previousDisparitiesPaddingElements The number of padding elements at the end of each row of the previous disparities, in elements, with range [0, infinity)
+		 * @param searchRadius The radius around the previous disparities to be tested, with range [0, infinity)
+		 * @param penalty1 The penalty for disparity changes of one pixel, with range [0, penalty2]
+		 * @param penalty2 The penalty for disparity changes of more than one pixel, with range [penalty1, 230]
+		 * @param maximalConsistencyError The maximal difference between the disparities of both images, a negative value to skip the check
+		 * @param disparities The resulting disparities, must be valid
+		 * @param disparitiesPaddingElements The number of padding elements at the end of each row of the resulting disparities, in elements, with range [0, infinity)
+		 * @param bands The number of bands of the entire image, see numberBands()
+		 * @param firstBand The first band to be handled, with range [0, bands - 1]
+		 * @param numberBandsToHandle The number of bands to be handled, with range [1, bands - firstBand]
+		 */
+		static void computeDisparityMapBands(const uint32_t* censusA, const uint32_t* censusB, const unsigned int width, const unsigned int height, const unsigned int minimalDisparity, const unsigned int numberDisparities, const float* previousDisparities, const unsigned int previousDisparitiesPaddingElements, const unsigned int searchRadius, const uint8_t penalty1, const uint8_t penalty2, const float maximalConsistencyError, float* disparities, const unsigned int disparitiesPaddingElements, const unsigned int bands, const unsigned int firstBand, const unsigned int numberBandsToHandle);
+
+		/**
+		 * Determines the disparities for a subset of rows (one band of the image).
+		 * @param censusA The census values of the first image, must be valid
+		 * @param censusB The census values of the second image, must be valid
+		 * @param width The width of both images in pixel, with range [1, infinity)
+		 * @param height The height of both images in pixel, with range [1, infinity)
+		 * @param minimalDisparity The minimal disparity to be tested, with range [0, infinity)
+		 * @param numberDisparities The number of disparities to be tested, with range [1, maximalNumberDisparities_]
+		 * @param previousDisparities The disparities of the previous frame, nullptr to test all disparities for each pixel
+		 * @param previousDisparitiesPaddingElements The number of padding elements at the end of each row of the previous disparities, in elements, with range [0, infinity)
+		 * @param searchRadius The radius around the previous disparities to be tested, with range [0, infinity)
+		 * @param penalty1 The penalty for disparity changes of one pixel, with range [0, penalty2]
+		 * @param penalty2 The penalty for disparity changes of more than one pixel, with range [penalty1, 230]
+		 * @param maximalConsistencyError The maximal difference between the disparities of both images, a negative value to skip the check
+		 * @param disparities The resulting disparities, must be valid
+		 * @param disparitiesPaddingElements The number of padding elements at the end of each row of the resulting disparities, in elements, with range [0, infinity)
+		 * @param firstRow The first row to be handled, with range [0, height - 1]
+		 * @param numberRows The number of rows to be handled, with range [1, height - firstRow]
+		 */
+		static void computeDisparityMapSubset(const uint32_t* censusA, const uint32_t* censusB, const unsigned int width, const unsigned int height, const unsigned int minimalDisparity, const unsigned int numberDisparities, const float* previousDisparities, const unsigned int previousDisparitiesPaddingElements, const unsigned int searchRadius, const uint8_t penalty1, const uint8_t penalty2, const float maximalConsistencyError, float* disparities, const unsigned int disparitiesPaddingElements, const unsigned int firstRow, const unsigned int numberRows);
+
+		/**
+		 * Aggregates the costs of one pixel along one path and adds the path costs to the sum of all paths.
+		 * The path costs are determined by L(d) = C(d) + min(L'(d), L'(d - 1) + P1, L'(d + 1) + P1, min(L') + P2) - min(L'), with L' the path costs of the previous pixel along the path.
+		 * @param costs The matching costs of the pixel, 'alignedDisparities' elements, must be valid
+		 * @param previousPathCosts The path costs of the previous pixel along the path, one additional readable element before and after the 'alignedDisparities' elements, must be valid
+		 * @param previousMinimalPathCost The minimal path cost of the previous pixel
+		 * @param pathCosts The resulting path costs of the pixel, 'alignedDisparities' elements, must be valid
+		 * @param sumCosts The sum of all paths to which the path costs will be added, 'alignedDisparities' elements, must be valid
+		 * @param alignedDisparities The number of disparities including padding, with range [16, infinity), must be a multiple of 16
+		 * @param penalty1 The penalty for disparity changes of one pixel
+		 * @param penalty2 The penalty for disparity changes of more than one pixel
+		 * @return The minimal path cost of the pixel
+		 */
+		static inline uint8_t aggregatePixel(const uint8_t* costs, const uint8_t* previousPathCosts, const uint8_t previousMinimalPathCost, uint8_t* pathCosts, uint16_t* sumCosts, const unsigned int alignedDisparities, const uint8_t penalty1, const uint8_t penalty2);
+};
+
+inline unsigned int SemiGlobalMatching::numberBands(const unsigned int height)
+{
+	ocean_assert(height >= 1u);
+
+	return std::max(1u, (height + bandRows_ / 2u) / bandRows_);
+}
+
+inline unsigned int SemiGlobalMatching::bandFirstRow(const unsigned int band, const unsigned int bands, const unsigned int height)
+{
+	ocean_assert(bands >= 1u && band <= bands);
+
+	return (unsigned int)((uint64_t(height) * uint64_t(band)) / uint64_t(bands));
+}
+
+}
+
+}
+
+}
+
+#endif // META_OCEAN_CV_DEPTH_SEMI_GLOBAL_MATCHING_H
@@ -10,6 +10,8 @@
 
 #include "ocean/cv/detector/Detector.h"
 
+#include "ocean/base/Worker.h"
+
 #include "ocean/cv/NEON.h"
 #include "ocean/cv/SSE.h"
 
@@ -47,8 +49,71 @@ class OCEAN_CV_DETECTOR_EXPORT Descriptor
 		template <unsigned int tBits>
 		static OCEAN_FORCE_INLINE unsigned int calculateHammingDistance(const void* descriptorA, const void* descriptorB);
 
+		/**
+		 * Determines the best and the second best matching reference descriptor for each query descriptor by applying a brute-force search.
+		 * The descriptors are compared in tiles so that a block of reference descriptors stays in the cache while it is compared with a block of query descriptors.<br>
+		 * Reference descriptors can be grouped (e.g., several levels or views of the same feature), the second best distance is the best distance of any group different from the best matching group.
+		 * @param queryDescriptors The query descriptors, tBits / 8 bytes for each descriptor, must be valid
+		 * @param numberQueryDescriptors The number of query descriptors, with range [1, infinity)
+		 * @param referenceDescriptors The reference descriptors, tBits / 8 bytes for each descriptor, must be valid
+		 * @param numberReferenceDescriptors The number of reference descriptors, with range [1, infinity)
+		 * @param referenceGroups Optional group indices, one for each reference descriptor, nullptr to use the index of each reference descriptor as group index
+		 * @param bestGroups The resulting group indices of the best matching reference descriptors, one for each query descriptor, must be valid
+		 * @param bestDistances The resulting distances to the best matching reference descriptors, one for each query descriptor, must be valid
+		 * @param secondBestDistances The resulting distances to the best matching reference descriptors of any other group, (unsigned int)(-1) if no other group exists, one for each query descriptor, must be valid
+		 * @param worker Optional worker object to distribute the computation
+		 * @tparam tBits The number of bits both descriptors have, with range [128, infinity), must be a multiple of 128
+		 * @see determineMatches().
+		 */
+		template <unsigned int tBits>
+		static void determineBestMatches(const void* queryDescriptors, const size_t numberQueryDescriptors, const void* referenceDescriptors, const size_t numberReferenceDescriptors, const Index32* referenceGroups, Index32* bestGroups, unsigned int* bestDistances, unsigned int* secondBestDistances, Worker* worker = nullptr);
+
+		/**
+		 * Determines the matching reference descriptor for each query descriptor by applying a brute-force search, a maximal distance and a ratio test.
+		 * @param queryDescriptors The query descriptors, tBits / 8 bytes for each descriptor, must be valid
+		 * @param numberQueryDescriptors The number of query descriptors, with range [1, infinity)
+		 * @param referenceDescriptors The reference descriptors, tBits / 8 bytes for each descriptor, must be valid
+		 * @param numberReferenceDescriptors The number of reference descriptors, with range [1, infinity)
+		 * @param referenceGroups Optional group indices, one for each reference descriptor, nullptr to use the index of each reference descriptor as group index
+		 * @param maximalDistance The maximal distance between two matching descriptors, with range [0, tBits]
+		 * @param maximalRatio The maximal ratio between the best and the second best distance, with range (0, 1], 1 to skip the ratio test
+		 * @param matchedGroups The resulting group indices of the matching reference descriptors, Index32(-1) if a query descriptor could not be matched, one for each query descriptor, must be valid
+		 * @param distances Optional resulting distances to the matching reference descriptors, one for each query descriptor, nullptr if not of interest
+		 * @param worker Optional worker object to distribute the computation
+		 * @tparam tBits The number of bits both descriptors have, with range [128, infinity), must be a multiple of 128
+		 * @see determineBestMatches().
+		 */
+		template <unsigned int tBits>
+		static void determineMatches(const void* queryDescriptors, const size_t numberQueryDescriptors, const void* referenceDescriptors, const size_t numberReferenceDescriptors, const Index32* referenceGroups, const unsigned int maximalDistance, const float maximalRatio, Index32* matchedGroups, unsigned int* distances = nullptr, Worker* worker = nullptr);
+
+		/**
+		 * Returns whether a best and a second best distance pass a maximal distance and a ratio test.
+		 * @param bestDistance The best distance, with range [0, infinity)
+		 * @param secondBestDistance The second best distance, (unsigned int)(-1) if no second best distance exists, with range [bestDistance, infinity)
+		 * @param maximalDistance The maximal distance of a valid match, with range [0, infinity)
+		 * @param maximalRatio The maximal ratio between the best and the second best distance, with range (0, 1], 1 to skip the ratio test
+		 * @return True, if the match is valid
+		 */
+		static inline bool isValidMatch(const unsigned int bestDistance, const unsigned int secondBestDistance, const unsigned int maximalDistance, const float maximalRatio);
+
 	protected:
 
+		/**
+		 * Determines the best and the second best matching reference descriptor for a subset of the query descriptors.
+		 * @param queryDescriptors The query descriptors, tBits / 8 bytes for each descriptor, must be valid
+		 * @param referenceDescriptors The reference descriptors, tBits / 8 bytes for each descriptor, must be valid
+		 * @param numberReferenceDescriptors The number of reference descriptors, with range [1, infinity)
+		 * @param referenceGroups Optional group indices, one for each reference descriptor, nullptr to use the index of each reference descriptor as group index
+		 * @param bestGroups The resulting group indices of the best matching reference descriptors, one for each query descriptor, must be valid
+		 * @param bestDistances The resulting distances to the best matching reference descriptors, one for each query descriptor, must be valid
+		 * @param secondBestDistances The resulting distances to the best matching reference descriptors of any other group, one for each query descriptor, must be valid
+		 * @param firstQueryDescriptor The first query descriptor to be handled
+		 * @param numberQueryDescriptors The number of query descriptors to be handled, with range [1, infinity)
+		 * @tparam tBits The number of bits both descriptors have, with range [128, infinity), must be a multiple of 128
+		 */
+		template <unsigned int tBits>
+		static void determineBestMatchesSubset(const uint8_t* queryDescriptors, const uint8_t* referenceDescriptors, const size_t numberReferenceDescriptors, const Index32* referenceGroups, Index32* bestGroups, unsigned int* bestDistances, unsigned int* secondBestDistances, const unsigned int firstQueryDescriptor, const unsigned int numberQueryDescriptors);
+
 #if defined(OCEAN_HARDWARE_SSE_VERSION) && OCEAN_HARDWARE_SSE_VERSION >= 30
 
 		/**
@@ -76,6 +141,28 @@ class OCEAN_CV_DETECTOR_EXPORT Descriptor
 		 */
 		static OCEAN_FORCE_INLINE unsigned int popcount128(const __m128i value);
 
+#endif
+
+#if defined(OCEAN_HARDWARE_AVX_VERSION) && OCEAN_HARDWARE_AVX_VERSION >= 20
+
+		/**
+		 * Calculates a pop count of an m256i register in 64 bit groups.
+		 * The function uses the native 64 bit pop count instruction if AVX-512 VPOPCNTDQ is available.
+		 * @param value Bit string to calculate pop count from
+		 * @return Pop count, one for each 64 bit group
+		 */
+		static OCEAN_FORCE_INLINE __m256i popcount64(const __m256i value);
+
+		/**
+		 * Calculates the Hamming distance between two binary descriptors with a multiple of 256 bits.
+		 * @param descriptorA The first descriptor, must be valid
+		 * @param descriptorB The second descriptor, must be valid
+		 * @return The hamming distance between both descriptors, with range [0, tBits]
+		 * @tparam tBits The number of bits both descriptors have, with range [256, infinity), must be a multiple of 256
+		 */
+		template <unsigned int tBits>
+		static OCEAN_FORCE_INLINE unsigned int calculateHammingDistanceAVX2(const void* descriptorA, const void* descriptorB);
+
 #endif
 };
 
@@ -159,7 +246,11 @@ OCEAN_FORCE_INLINE unsigned int Descriptor::calculateHammingDistance<128u>(const
 template <>
 OCEAN_FORCE_INLINE unsigned int Descriptor::calculateHammingDistance<256u>(const void* descriptorA, const void* descriptorB)
 {
-#if defined(OCEAN_HARDWARE_SSE_VERSION) && OCEAN_HARDWARE_SSE_VERSION >= 42
+#if defined(OCEAN_HARDWARE_AVX_VERSION) && OCEAN_HARDWARE_AVX_VERSION >= 20
+
+	return calculateHammingDistanceAVX2<256u>(descriptorA, descriptorB);
+
+#elif defined(OCEAN_HARDWARE_SSE_VERSION) && OCEAN_HARDWARE_SSE_VERSION >= 42
 
 	// the following code uses the following SSE instructions, and needs SSE4.2 or higher
 
@@ -251,6 +342,15 @@ OCEAN_FORCE_INLINE unsigned int Descriptor::calculateHammingDistance(const void*
 {
 	static_assert(tBits >= 128u && tBits % 128u == 0u, "Invalid bit number!");
 
+#if defined(OCEAN_HARDWARE_AVX_VERSION) && OCEAN_HARDWARE_AVX_VERSION >= 20
+
+	if constexpr (tBits % 256u == 0u)
+	{
+		return calculateHammingDistanceAVX2<tBits>(descriptorA, descriptorB);
+	}
+
+#endif
+
 #if defined(OCEAN_HARDWARE_SSE_VERSION) && OCEAN_HARDWARE_SSE_VERSION >= 42
 
 	// the following code uses the following SSE instructions, and needs SSE4.2 or higher
@@ -341,6 +441,134 @@ OCEAN_FORCE_INLINE unsigned int Descriptor::calculateHammingDistance(const void*
 #endif
 }
 
+template <unsigned int tBits>
+void Descriptor::determineBestMatches(const void* queryDescriptors, const size_t numberQueryDescriptors, const void* referenceDescriptors, const size_t numberReferenceDescriptors, const Index32* referenceGroups, Index32* bestGroups, unsigned int* bestDistances, unsigned int* secondBestDistances, Worker* worker)
+{
+	static_assert(tBits >= 128u && tBits % 128u == 0u, "Invalid bit number!");
+
+	ocean_assert(queryDescriptors != nullptr && numberQueryDescriptors != 0);
+	ocean_assert(referenceDescriptors != nullptr && numberReferenceDescriptors != 0);
+	ocean_assert(bestGroups != nullptr && bestDistances != nullptr && secondBestDistances != nullptr);
+
+	if (worker != nullptr)
+	{
+		worker->executeFunction(Worker::Function::createStatic(&Descriptor::determineBestMatchesSubset<tBits>, (const uint8_t*)(queryDescriptors), (const uint8_t*)(referenceDescriptors), numberReferenceDescriptors, referenceGroups, bestGroups, bestDistances, secondBestDistances, 0u, 0u), 0u, (unsigned int)(numberQueryDescriptors));
+	}
+	else
+	{
+		determineBestMatchesSubset<tBits>((const uint8_t*)(queryDescriptors), (const uint8_t*)(referenceDescriptors), numberReferenceDescriptors, referenceGroups, bestGroups, bestDistances, secondBestDistances, 0u, (unsigned int)(numberQueryDescriptors));
+	}
+}
+
+template <unsigned int tBits>
+void Descriptor::determineMatches(const void* queryDescriptors, const size_t numberQueryDescriptors, const void* referenceDescriptors, const size_t numberReferenceDescriptors, const Index32* referenceGroups, const unsigned int maximalDistance, const float maximalRatio, Index32* matchedGroups, unsigned int* distances, Worker* worker)
+{
+	ocean_assert(maximalRatio > 0.0f && maximalRatio <= 1.0f);
+	ocean_assert(matchedGroups != nullptr);
+
+	Indices32 bestDistances(numberQueryDescriptors);
+	Indices32 secondBestDistances(numberQueryDescriptors);
+
+	determineBestMatches<tBits>(queryDescriptors, numberQueryDescriptors, referenceDescriptors, numberReferenceDescriptors, referenceGroups, matchedGroups, bestDistances.data(), secondBestDistances.data(), worker);
+
+	for (size_t n = 0; n < numberQueryDescriptors; ++n)
+	{
+		if (!isValidMatch(bestDistances[n], secondBestDistances[n], maximalDistance, maximalRatio))
+		{
+			matchedGroups[n] = Index32(-1);
+		}
+
+		if (distances != nullptr)
+		{
+			distances[n] = bestDistances[n];
+		}
+	}
+}
+
+inline bool Descriptor::isValidMatch(const unsigned int bestDistance, const unsigned int secondBestDistance, const unsigned int maximalDistance, const float maximalRatio)
+{
+	ocean_assert(bestDistance <= secondBestDistance);
+	ocean_assert(maximalRatio > 0.0f && maximalRatio <= 1.0f);
+
+	if (bestDistance > maximalDistance)
+	{
+		return false;
+	}
+
+	return secondBestDistance == (unsigned int)(-1) || float(bestDistance) <= float(secondBestDistance) * maximalRatio;
+}
+
+template <unsigned int tBits>
+void Descriptor::determineBestMatchesSubset(const uint8_t* queryDescriptors, const uint8_t* referenceDescriptors, const size_t numberReferenceDescriptors, const Index32* referenceGroups, Index32* bestGroups, unsigned int* bestDistances, unsigned int* secondBestDistances, const unsigned int firstQueryDescriptor, const unsigned int numberQueryDescriptors)
+{
+	ocean_assert(queryDescriptors != nullptr && referenceDescriptors != nullptr);
+	ocean_assert(bestGroups != nullptr && bestDistances != nullptr && secondBestDistances != nullptr);
+
+	constexpr size_t descriptorBytes = size_t(tBits / 8u);
+
+	// a tile of reference descriptors covers 32KB so that the tile stays in the L1/L2 cache while all query descriptors of a tile are compared with it
+
+	constexpr size_t queryTileSize = 8;
+	constexpr size_t referenceTileSize = std::max(size_t(1), size_t(32768) / descriptorBytes);
+
+	for (size_t queryTileStart = size_t(firstQueryDescriptor); queryTileStart < size_t(firstQueryDescriptor + numberQueryDescriptors); queryTileStart += queryTileSize)
+	{
+		const size_t queryTileEnd = std::min(queryTileStart + queryTileSize, size_t(firstQueryDescriptor + numberQueryDescriptors));
+
+		for (size_t nQuery = queryTileStart; nQuery < queryTileEnd; ++nQuery)
+		{
+			bestGroups[nQuery] = Index32(-1);
+			bestDistances[nQuery] = (unsigned int)(-1);
+			secondBestDistances[nQuery] = (unsigned int)(-1);
+		}
+
+		for (size_t referenceTileStart = 0; referenceTileStart < numberReferenceDescriptors; referenceTileStart += referenceTileSize)
+		{
+			const size_t referenceTileEnd = std::min(referenceTileStart + referenceTileSize, numberReferenceDescriptors);
+
+			for (size_t nQuery = queryTileStart; nQuery < queryTileEnd; ++nQuery)
+			{
+				const uint8_t* const queryDescriptor = queryDescriptors + nQuery * descriptorBytes;
+
+				Index32 bestGroup = bestGroups[nQuery];
+				unsigned int bestDistance = bestDistances[nQuery];
+				unsigned int secondBestDistance = secondBestDistances[nQuery];
+
+				for (size_t nReference = referenceTileStart; nReference < referenceTileEnd; ++nReference)
+				{
+					const unsigned int distance = calculateHammingDistance<tBits>(queryDescriptor, referenceDescriptors + nReference * descriptorBytes);
+
+					// the second best distance is always an upper bound for any improvement
+
+					if (distance < secondBestDistance)
+					{
+						const Index32 group = referenceGroups != nullptr ? referenceGroups[nReference] : Index32(nReference);
+
+						if (distance < bestDistance)
+						{
+							if (group != bestGroup)
+							{
+								secondBestDistance = bestDistance;
+								bestGroup = group;
+							}
+
+							bestDistance = distance;
+						}
+						else if (group != bestGroup)
+						{
+							secondBestDistance = distance;
+						}
+					}
+				}
+
+				bestGroups[nQuery] = bestGroup;
+				bestDistances[nQuery] = bestDistance;
+				secondBestDistances[nQuery] = secondBestDistance;
+			}
+		}
+	}
+}
+
 #if defined(OCEAN_HARDWARE_SSE_VERSION) && OCEAN_HARDWARE_SSE_VERSION >= 30
 
 OCEAN_FORCE_INLINE __m128i Descriptor::popcount8(const __m128i value)
@@ -406,6 +634,73 @@ OCEAN_FORCE_INLINE unsigned int Descriptor::popcount128(const __m128i value)
 
 #endif
 
+
+#if defined(OCEAN_HARDWARE_AVX_VERSION) && OCEAN_HARDWARE_AVX_VERSION >= 20
+
+OCEAN_FORCE_INLINE __m256i Descriptor::popcount64(const __m256i value)
+{
+#if defined(__AVX512VPOPCNTDQ__) && defined(__AVX512VL__)
+
+	// AVX-512 VPOPCNTDQ + VL:
+	// _mm256_popcnt_epi64
+
+	return _mm256_popcnt_epi64(value);
+
+#else
+
+	// the following code uses the following AVX2 instructions
+
+	// _mm256_set1_epi8
+	// _mm256_setr_epi8
+	// _mm256_and_si256
+	// _mm256_srli_epi16
+	// _mm256_shuffle_epi8
+	// _mm256_add_epi8
+	// _mm256_sad_epu8
+
+	const __m256i popcount_mask = _mm256_set1_epi8(0x0F);
+	const __m256i popcount_table = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4, 0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+
+	const __m256i pcnt0 = _mm256_shuffle_epi8(popcount_table, _mm256_and_si256(value, popcount_mask));
+	const __m256i pcnt1 = _mm256_shuffle_epi8(popcount_table, _mm256_and_si256(_mm256_srli_epi16(value, 4), popcount_mask));
+
+	return _mm256_sad_epu8(_mm256_add_epi8(pcnt0, pcnt1), _mm256_setzero_si256());
+
+#endif
+}
+
+template <unsigned int tBits>
+OCEAN_FORCE_INLINE unsigned int Descriptor::calculateHammingDistanceAVX2(const void* descriptorA, const void* descriptorB)
+{
+	static_assert(tBits >= 256u && tBits % 256u == 0u, "Invalid bit number!");
+
+	// the following code uses the following AVX2 instructions
+
+	// _mm256_loadu_si256
+	// _mm256_xor_si256
+	// _mm256_add_epi64
+	// _mm256_extracti128_si256
+
+	// see also popcount64()
+
+	__m256i count_m256_64 = _mm256_setzero_si256();
+
+	for (unsigned int n = 0u; n < tBits / 256u; ++n)
+	{
+		const __m256i descriptorA_m256 = _mm256_loadu_si256(((const __m256i*)descriptorA) + n);
+		const __m256i descriptorB_m256 = _mm256_loadu_si256(((const __m256i*)descriptorB) + n);
+
+		count_m256_64 = _mm256_add_epi64(count_m256_64, popcount64(_mm256_xor_si256(descriptorA_m256, descriptorB_m256)));
+	}
+
+	const __m128i count_m128_64 = _mm_add_epi64(_mm256_castsi256_si128(count_m256_64), _mm256_extracti128_si256(count_m256_64, 1));
+	const __m128i count_m128 = _mm_add_epi64(count_m128_64, _mm_unpackhi_epi64(count_m128_64, count_m128_64));
+
+	return (unsigned int)(_mm_cvtsi128_si32(count_m128));
+}
+
+#endif
+
 }
 
 }
@@ -111,6 +111,135 @@ bool FASTFeatureDetector::Comfort::detectFeatures(const Frame& frame, const unsi
 	return true;
 }
 
+#if defined(OCEAN_HARDWARE_SSE_VERSION) && OCEAN_HARDWARE_SSE_VERSION >= 41
+
+OCEAN_FORCE_INLINE unsigned int FASTFeatureDetector::determineCandidates16PixelsSSE(const uint8_t* topMiddle, const uint8_t* middleLeft, const uint8_t* bottomMiddle, const __m128i& threshold_u_8x16)
+{
+	ocean_assert(topMiddle != nullptr && middleLeft != nullptr && bottomMiddle != nullptr);
+
+	const __m128i center_u_8x16 = _mm_lddqu_si128((const __m128i*)(middleLeft + 3));
+
+	// the saturated thresholds result in the same comparison results as the scalar implementation with integer precision
+	const __m128i centerHigh_u_8x16 = _mm_adds_epu8(center_u_8x16, threshold_u_8x16);
+	const __m128i centerLow_u_8x16 = _mm_subs_epu8(center_u_8x16, threshold_u_8x16);
+
+	const __m128i pixel00_u_8x16 = _mm_lddqu_si128((const __m128i*)topMiddle);
+	const __m128i pixel04_u_8x16 = _mm_lddqu_si128((const __m128i*)(middleLeft + 6));
+	const __m128i pixel08_u_8x16 = _mm_lddqu_si128((const __m128i*)bottomMiddle);
+	const __m128i pixel12_u_8x16 = _mm_lddqu_si128((const __m128i*)middleLeft);
+
+	const __m128i zero_u_8x16 = _mm_setzero_si128();
+
+	// pixel > centerHigh <=> (pixel -sat centerHigh) != 0, we count the pixels which are not brighter (0xFF == -1 for each pixel)
+
+	__m128i notBrighter_s_8x16 = _mm_cmpeq_epi8(_mm_subs_epu8(pixel00_u_8x16, centerHigh_u_8x16), zero_u_8x16);
+	notBrighter_s_8x16 = _mm_add_epi8(notBrighter_s_8x16, _mm_cmpeq_epi8(_mm_subs_epu8(pixel04_u_8x16, centerHigh_u_8x16), zero_u_8x16));
+	notBrighter_s_8x16 = _mm_add_epi8(notBrighter_s_8x16, _mm_cmpeq_epi8(_mm_subs_epu8(pixel08_u_8x16, centerHigh_u_8x16), zero_u_8x16));
+	notBrighter_s_8x16 = _mm_add_epi8(notBrighter_s_8x16, _mm_cmpeq_epi8(_mm_subs_epu8(pixel12_u_8x16, centerHigh_u_8x16), zero_u_8x16));
+
+	// pixel < centerLow <=> (centerLow -sat pixel) != 0
+
+	__m128i notDarker_s_8x16 = _mm_cmpeq_epi8(_mm_subs_epu8(centerLow_u_8x16, pixel00_u_8x16), zero_u_8x16);
+	notDarker_s_8x16 = _mm_add_epi8(notDarker_s_8x16, _mm_cmpeq_epi8(_mm_subs_epu8(centerLow_u_8x16, pixel04_u_8x16), zero_u_8x16));
+	notDarker_s_8x16 = _mm_add_epi8(notDarker_s_8x16, _mm_cmpeq_epi8(_mm_subs_epu8(centerLow_u_8x16, pixel08_u_8x16), zero_u_8x16));
+	notDarker_s_8x16 = _mm_add_epi8(notDarker_s_8x16, _mm_cmpeq_epi8(_mm_subs_epu8(centerLow_u_8x16, pixel12_u_8x16), zero_u_8x16));
+
+	// at most one pixel is allowed to be not brighter (not darker), so that the negative counter must be larger than -2
+
+	const __m128i minusTwo_s_8x16 = _mm_set1_epi8(char(-2));
+
+	const __m128i candidates_u_8x16 = _mm_or_si128(_mm_cmpgt_epi8(notBrighter_s_8x16, minusTwo_s_8x16), _mm_cmpgt_epi8(notDarker_s_8x16, minusTwo_s_8x16));
+
+	return (unsigned int)(_mm_movemask_epi8(candidates_u_8x16));
+}
+
+#endif // OCEAN_HARDWARE_SSE_VERSION >= 41
+
+#if defined(OCEAN_HARDWARE_AVX_VERSION) && OCEAN_HARDWARE_AVX_VERSION >= 20
+
+OCEAN_FORCE_INLINE unsigned int FASTFeatureDetector::determineCandidates32PixelsAVX2(const uint8_t* topMiddle, const uint8_t* middleLeft, const uint8_t* bottomMiddle, const __m256i& threshold_u_8x32)
+{
+	ocean_assert(topMiddle != nullptr && middleLeft != nullptr && bottomMiddle != nullptr);
+
+	const __m256i center_u_8x32 = _mm256_loadu_si256((const __m256i*)(middleLeft + 3));
+
+	const __m256i centerHigh_u_8x32 = _mm256_adds_epu8(center_u_8x32, threshold_u_8x32);
+	const __m256i centerLow_u_8x32 = _mm256_subs_epu8(center_u_8x32, threshold_u_8x32);
+
+	const __m256i pixel00_u_8x32 = _mm256_loadu_si256((const __m256i*)topMiddle);
+	const __m256i pixel04_u_8x32 = _mm256_loadu_si256((const __m256i*)(middleLeft + 6));
+	const __m256i pixel08_u_8x32 = _mm256_loadu_si256((const __m256i*)bottomMiddle);
+	const __m256i pixel12_u_8x32 = _mm256_loadu_si256((const __m256i*)middleLeft);
+
+	const __m256i zero_u_8x32 = _mm256_setzero_si256();
+
+	__m256i notBrighter_s_8x32 = _mm256_cmpeq_epi8(_mm256_subs_epu8(pixel00_u_8x32, centerHigh_u_8x32), zero_u_8x32);
+	notBrighter_s_8x32 = _mm256_add_epi8(notBrighter_s_8x32, _mm256_cmpeq_epi8(_mm256_subs_epu8(pixel04_u_8x32, centerHigh_u_8x32), zero_u_8x32));
+	notBrighter_s_8x32 = _mm256_add_epi8(notBrighter_s_8x32, _mm256_cmpeq_epi8(_mm256_subs_epu8(pixel08_u_8x32, centerHigh_u_8x32), zero_u_8x32));
+	notBrighter_s_8x32 = _mm256_add_epi8(notBrighter_s_8x32, _mm256_cmpeq_epi8(_mm256_subs_epu8(pixel12_u_8x32, centerHigh_u_8x32), zero_u_8x32));
+
+	__m256i notDarker_s_8x32 = _mm256_cmpeq_epi8(_mm256_subs_epu8(centerLow_u_8x32, pixel00_u_8x32), zero_u_8x32);
+	notDarker_s_8x32 = _mm256_add_epi8(notDarker_s_8x32, _mm256_cmpeq_epi8(_mm256_subs_epu8(centerLow_u_8x32, pixel04_u_8x32), zero_u_8x32));
+	notDarker_s_8x32 = _mm256_add_epi8(notDarker_s_8x32, _mm256_cmpeq_epi8(_mm256_subs_epu8(centerLow_u_8x32, pixel08_u_8x32), zero_u_8x32));
+	notDarker_s_8x32 = _mm256_add_epi8(notDarker_s_8x32, _mm256_cmpeq_epi8(_mm256_subs_epu8(centerLow_u_8x32, pixel12_u_8x32), zero_u_8x32));
+
+	const __m256i minusTwo_s_8x32 = _mm256_set1_epi8(char(-2));
+
+	const __m256i candidates_u_8x32 = _mm256_or_si256(_mm256_cmpgt_epi8(notBrighter_s_8x32, minusTwo_s_8x32), _mm256_cmpgt_epi8(notDarker_s_8x32, minusTwo_s_8x32));
+
+	return (unsigned int)(_mm256_movemask_epi8(candidates_u_8x32));
+}
+
+#endif // OCEAN_HARDWARE_AVX_VERSION >= 20
+
+#if defined(OCEAN_HARDWARE_NEON_VERSION) && OCEAN_HARDWARE_NEON_VERSION >= 10
+
+OCEAN_FORCE_INLINE unsigned int FASTFeatureDetector::determineCandidates16PixelsNEON(const uint8_t* topMiddle, const uint8_t* middleLeft, const uint8_t* bottomMiddle, const uint8x16_t& threshold_u_8x16)
+{
+	ocean_assert(topMiddle != nullptr && middleLeft != nullptr && bottomMiddle != nullptr);
+
+	const uint8x16_t center_u_8x16 = vld1q_u8(middleLeft + 3);
+
+	// the saturated thresholds result in the same comparison results as the scalar implementation with integer precision
+	const uint8x16_t centerHigh_u_8x16 = vqaddq_u8(center_u_8x16, threshold_u_8x16);
+	const uint8x16_t centerLow_u_8x16 = vqsubq_u8(center_u_8x16, threshold_u_8x16);
+
+	const uint8x16_t pixel00_u_8x16 = vld1q_u8(topMiddle);
+	const uint8x16_t pixel04_u_8x16 = vld1q_u8(middleLeft + 6);
+	const uint8x16_t pixel08_u_8x16 = vld1q_u8(bottomMiddle);
+	const uint8x16_t pixel12_u_8x16 = vld1q_u8(middleLeft);
+
+	// counting the brighter and darker pixels, each comparison result is 0x00 or 0xFF, shifted to 0 or 1
+
+	uint8x16_t brighter_u_8x16 = vshrq_n_u8(vcgtq_u8(pixel00_u_8x16, centerHigh_u_8x16), 7);
+	brighter_u_8x16 = vsraq_n_u8(brighter_u_8x16, vcgtq_u8(pixel04_u_8x16, centerHigh_u_8x16), 7);
+	brighter_u_8x16 = vsraq_n_u8(brighter_u_8x16, vcgtq_u8(pixel08_u_8x16, centerHigh_u_8x16), 7);
+	brighter_u_8x16 = vsraq_n_u8(brighter_u_8x16, vcgtq_u8(pixel12_u_8x16, centerHigh_u_8x16), 7);
+
+	uint8x16_t darker_u_8x16 = vshrq_n_u8(vcltq_u8(pixel00_u_8x16, centerLow_u_8x16), 7);
+	darker_u_8x16 = vsraq_n_u8(darker_u_8x16, vcltq_u8(pixel04_u_8x16, centerLow_u_8x16), 7);
+	darker_u_8x16 = vsraq_n_u8(darker_u_8x16, vcltq_u8(pixel08_u_8x16, centerLow_u_8x16), 7);
+	darker_u_8x16 = vsraq_n_u8(darker_u_8x16, vcltq_u8(pixel12_u_8x16, centerLow_u_8x16), 7);
+
+	const uint8x16_t constant_3_u_8x16 = vdupq_n_u8(3u);
+
+	const uint8x16_t candidates_u_8x16 = vorrq_u8(vcgeq_u8(brighter_u_8x16, constant_3_u_8x16), vcgeq_u8(darker_u_8x16, constant_3_u_8x16));
+
+	// determining the bit mask, each lane receives an individual bit before all lanes of each half are summed up
+
+	constexpr uint8_t bits[16] = {1u, 2u, 4u, 8u, 16u, 32u, 64u, 128u, 1u, 2u, 4u, 8u, 16u, 32u, 64u, 128u};
+
+	const uint8x16_t maskedBits_u_8x16 = vandq_u8(candidates_u_8x16, vld1q_u8(bits));
+
+	uint8x8_t sum_u_8x8 = vpadd_u8(vget_low_u8(maskedBits_u_8x16), vget_high_u8(maskedBits_u_8x16));
+	sum_u_8x8 = vpadd_u8(sum_u_8x8, sum_u_8x8);
+	sum_u_8x8 = vpadd_u8(sum_u_8x8, sum_u_8x8);
+
+	return (unsigned int)(vget_lane_u8(sum_u_8x8, 0)) | ((unsigned int)(vget_lane_u8(sum_u_8x8, 1)) << 8u);
+}
+
+#endif // OCEAN_HARDWARE_NEON_VERSION >= 10
+
 void FASTFeatureDetector::detectFeatureCandidatesSubset(const uint8_t* yFrame, const unsigned int width, const unsigned int height, const unsigned int threshold, NonMaximumSuppressionVote* nonMaximumSuppression, const unsigned int firstColumn, const unsigned int numberColumns, const unsigned int framePaddingElements, const unsigned int firstRow, const unsigned int numberRows)
 {
 	/**
@@ -177,6 +306,22 @@ void FASTFeatureDetector::detectFeatureCandidatesSubset(const uint8_t* yFrame, c
 
 	const unsigned int correctionValue = 16u * 255u * threshold;
 
+#if defined(OCEAN_HARDWARE_AVX_VERSION) && OCEAN_HARDWARE_AVX_VERSION >= 20
+	const __m256i threshold_u_8x32 = _mm256_set1_epi8(char(min(threshold, 255u)));
+#endif
+
+#if defined(OCEAN_HARDWARE_SSE_VERSION) && OCEAN_HARDWARE_SSE_VERSION >= 41
+	const __m128i threshold_u_8x16 = _mm_set1_epi8(char(min(threshold, 255u)));
+#elif defined(OCEAN_HARDWARE_NEON_VERSION) && OCEAN_HARDWARE_NEON_VERSION >= 10
+	const uint8x16_t threshold_u_8x16 = vdupq_n_u8(uint8_t(min(threshold, 255u)));
+#endif
+
+#if (defined(OCEAN_HARDWARE_SSE_VERSION) && OCEAN_HARDWARE_SSE_VERSION >= 41) || (defined(OCEAN_HARDWARE_NEON_VERSION) && OCEAN_HARDWARE_NEON_VERSION >= 10)
+	// the candidate mask of the next pixels which have been checked with the SIMD rejection test, and the number of these pixels
+	unsigned int candidates = 0u;
+	unsigned int candidatePixels = 0u;
+#endif
+
 	while (topMiddle != topMiddleEnd)
 	{
 		ocean_assert(topMiddle <= topMiddleEnd);
@@ -191,6 +336,66 @@ void FASTFeatureDetector::detectFeatureCandidatesSubset(const uint8_t* yFrame, c
 		{
 			ocean_assert(topMiddle <= topMiddleRowEnd);
 
+#if (defined(OCEAN_HARDWARE_SSE_VERSION) && OCEAN_HARDWARE_SSE_VERSION >= 41) || (defined(OCEAN_HARDWARE_NEON_VERSION) && OCEAN_HARDWARE_NEON_VERSION >= 10)
+
+			if (candidatePixels == 0u)
+			{
+				// the next center pixel will be located at middleLeft + 4
+
+#if defined(OCEAN_HARDWARE_AVX_VERSION) && OCEAN_HARDWARE_AVX_VERSION >= 20
+				if (topMiddleRowEnd - topMiddle >= 32)
+				{
+					candidates = determineCandidates32PixelsAVX2(topMiddle + 1, middleLeft + 1, bottomMiddle + 1, threshold_u_8x32);
+					candidatePixels = 32u;
+				}
+				else
+#endif
+				if (topMiddleRowEnd - topMiddle >= 16)
+				{
+#if defined(OCEAN_HARDWARE_SSE_VERSION) && OCEAN_HARDWARE_SSE_VERSION >= 41
+					candidates = determineCandidates16PixelsSSE(topMiddle + 1, middleLeft + 1, bottomMiddle + 1, threshold_u_8x16);
+#else
+					candidates = determineCandidates16PixelsNEON(topMiddle + 1, middleLeft + 1, bottomMiddle + 1, threshold_u_8x16);
+#endif
+					candidatePixels = 16u;
+				}
+			}
+
+			if (candidatePixels != 0u)
+			{
+				if (candidates == 0u)
+				{
+					// none of the remaining pixels can be a feature
+
+					topMiddle += candidatePixels;
+					middleLeft += candidatePixels;
+					bottomMiddle += candidatePixels;
+
+					x += candidatePixels;
+
+					candidatePixels = 0u;
+					continue;
+				}
+
+				const bool isCandidate = (candidates & 1u) != 0u;
+
+				candidates >>= 1u;
+				--candidatePixels;
+
+				if (!isCandidate)
+				{
+					++topMiddle;
+					++middleLeft;
+					++bottomMiddle;
+
+					++x;
+
+					continue;
+				}
+			}
+
+#endif // OCEAN_HARDWARE_SSE_VERSION >= 41 || OCEAN_HARDWARE_NEON_VERSION >= 10
+
 			++topMiddle;
 			++middleLeft;
 			++bottomMiddle;
@@ -14,7 +14,9 @@
 #include "ocean/base/Frame.h"
 #include "ocean/base/Worker.h"
 
+#include "ocean/cv/NEON.h"
 #include "ocean/cv/NonMaximumSuppression.h"
+#include "ocean/cv/SSE.h"
 
 namespace Ocean
 {
@@ -189,6 +191,53 @@ class OCEAN_CV_DETECTOR_EXPORT FASTFeatureDetector
 		 * @param framePaddingElements The number of padding elements at the end of each frame row, in elements, with range [0, infinity)
 		 */
 		static void scoreFeaturePrecise(const uint8_t* yFrame, const unsigned int width, const unsigned int height, const unsigned int threshold, FASTFeature& feature, const unsigned int framePaddingElements);
+
+	protected:
+
+#if defined(OCEAN_HARDWARE_SSE_VERSION) && OCEAN_HARDWARE_SSE_VERSION >= 41
+
+		/**
+		 * Determines which of 16 consecutive pixels can be FAST feature candidates by applying a quick rejection test using SSE instructions.
+		 * A pixel can be a candidate only if at least three of the four pixels 00, 04, 08, and 12 are brighter (or at least three are darker) than the center pixel, as each valid arc of 12 contiguous pixels covers three of them.
+		 * @param topMiddle The pointer to pixel 00 of the first of the 16 center pixels, must be valid
+		 * @param middleLeft The pointer to pixel 12 of the first of the 16 center pixels, must be valid
+		 * @param bottomMiddle The pointer to pixel 08 of the first of the 16 center pixels, must be valid
+		 * @param threshold_u_8x16 The detection threshold, with range [0, 255] for each element
+		 * @return The candidate mask, bit i is set if the i-th pixel may be a feature
+		 */
+		static OCEAN_FORCE_INLINE unsigned int determineCandidates16PixelsSSE(const uint8_t* topMiddle, const uint8_t* middleLeft, const uint8_t* bottomMiddle, const __m128i& threshold_u_8x16);
+
+#endif // OCEAN_HARDWARE_SSE_VERSION >= 41
+
+#if defined(OCEAN_HARDWARE_AVX_VERSION) && OCEAN_HARDWARE_AVX_VERSION >= 20
+
+		/**
+		 * Determines which of 32 consecutive pixels can be FAST feature candidates by applying a quick rejection test using AVX2 instructions.
+		 * @param topMiddle The pointer to pixel 00 of the first of the 32 center pixels, must be valid
+		 * @param middleLeft The pointer to pixel 12 of the first of the 32 center pixels, must be valid
+		 * @param bottomMiddle The pointer to pixel 08 of the first of the 32 center pixels, must be valid
+		 * @param threshold_u_8x32 The detection threshold, with range [0, 255] for each element
+		 * @return The candidate mask, bit i is set if the i-th pixel may be a feature
+		 * @see determineCandidates16PixelsSSE().
+		 */
+		static OCEAN_FORCE_INLINE unsigned int determineCandidates32PixelsAVX2(const uint8_t* topMiddle, const uint8_t* middleLeft, const uint8_t* bottomMiddle, const __m256i& threshold_u_8x32);
+
+#endif // OCEAN_HARDWARE_AVX_VERSION >= 20
+
+#if defined(OCEAN_HARDWARE_NEON_VERSION) && OCEAN_HARDWARE_NEON_VERSION >= 10
+
+		/**
+		 * Determines which of 16 consecutive pixels can be FAST feature candidates by applying a quick rejection test using NEON instructions.
+		 * @param topMiddle The pointer to pixel 00 of the first of the 16 center pixels, must be valid
+		 * @param middleLeft The pointer to pixel 12 of the first of the 16 center pixels, must be valid
+		 * @param bottomMiddle The pointer to pixel 08 of the first of the 16 center pixels, must be valid
+		 * @param threshold_u_8x16 The detection threshold, with range [0, 255] for each element
+		 * @return The candidate mask, bit i is set if the i-th pixel may be a feature
+		 * @see determineCandidates16PixelsSSE().
+		 */
+		static OCEAN_FORCE_INLINE unsigned int determineCandidates16PixelsNEON(const uint8_t* topMiddle, const uint8_t* middleLeft, const uint8_t* bottomMiddle, const uint8x16_t& threshold_u_8x16);
+
+#endif // OCEAN_HARDWARE_NEON_VERSION >= 10
 };
 
 inline bool FASTFeatureDetector::Comfort::detectFeatures(const Frame& frame, const unsigned int threshold, const bool frameIsUndistorted, const bool preciseScoring, FASTFeatures& features, Worker* worker)
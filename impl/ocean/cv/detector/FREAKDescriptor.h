@@ -535,6 +535,59 @@ class FREAKDescriptorT : public FREAKDescriptor
 		/// The pre-defined vertical coordinates of the circular kernel with radius 7
 		static const int kernelRadius7Y[kernelRadius7Elements];
 
+		/// The number of points which are processed together in one batch when computing descriptors for several points.
+		static constexpr size_t numberOfBatchPoints = 16;
+
+		/**
+		 * The linear memory offsets of the cell kernels, relative to the center of a cell.
+		 * The offsets depend on the stride of the pyramid layers only, so that they can be shared by all points located in the same pyramid level.
+		 */
+		struct KernelOffsets
+		{
+			/// The offsets of the kernel with radius 1 in the layer of the points
+			int radius1[kernelRadius1Elements];
+
+			/// The offsets of the kernel with radius 2 in the layer of the points
+			int radius2[kernelRadius2Elements];
+
+			/// The offsets of the kernel with radius 3 in the layer of the points
+			int radius3[kernelRadius3Elements];
+
+			/// The offsets of the kernel with radius 3 in the next coarser layer
+			int nextLayerRadius3[kernelRadius3Elements];
+		};
+
+		/**
+		 * Determines the linear memory offsets of the cell kernels for two pyramid layers.
+		 * @param strideElements The number of elements between two rows in the layer of the points, in elements, with range [1, infinity)
+		 * @param nextLayerStrideElements The number of elements between two rows in the next coarser layer, in elements, with range [1, infinity)
+		 * @param kernelOffsets The resulting kernel offsets
+		 */
+		static void determineKernelOffsets(const unsigned int strideElements, const unsigned int nextLayerStrideElements, KernelOffsets& kernelOffsets);
+
+		/**
+		 * Computes FREAK descriptors for a batch of points located in the same pyramid level.
+		 * The points are processed together in a structure-of-arrays layout, the resulting descriptors are identical to the descriptors of computeDescriptor().
+		 * @param framePyramid Frame pyramid in which the points have been defined, must be valid
+		 * @param points The 2D image points which are defined at level 'pointsPyramidLevel' in 'framePyramid', must be valid
+		 * @param size The number of points in the batch, with range [1, numberOfBatchPoints]
+		 * @param pointsPyramidLevel Level of the frame pyramid at which the input points are located, range: [0, framePyramid.layers() - 1)
+		 * @param kernelOffsets The kernel offsets for the layer of the points and the next coarser layer, as determined by determineKernelOffsets()
+		 * @param cameraDerivativeFunctor The functor returning the camera derivative data for each point
+		 * @param freakDescriptors The resulting FREAK descriptors, one for each point, must be valid
+		 */
+		static void computeDescriptorsBatch(const FramePyramid& framePyramid, const Eigen::Vector2f* points, const size_t size, const unsigned int pointsPyramidLevel, const KernelOffsets& kernelOffsets, const CameraDerivativeFunctor& cameraDerivativeFunctor, FREAKDescriptorT<tSize>* freakDescriptors);
+
+		/**
+		 * Computes the average intensity of a cell which is entirely located inside the frame based on linear kernel offsets.
+		 * @param cellCenter The pointer to the center pixel of the cell, must be valid
+		 * @param kernelOffsets The linear offsets of the kernel elements relative to the center pixel, must be valid and have 'tKernelElements' elements
+		 * @return The average intensity of the cell
+		 * @tparam tKernelElements The number of elements in the kernel, with range [1, infinity)
+		 */
+		template <size_t tKernelElements>
+		static OCEAN_FORCE_INLINE PixelType computeAverageCellIntensity(const PixelType* cellCenter, const int* kernelOffsets);
+
 	protected:
 
 		/// The orientation of this descriptor in radian, range: [-pi, pi]
@@ -1109,21 +1162,298 @@ void FREAKDescriptorT<tSize>::computeDescriptorsSubset(const FramePyramid* frame
 	ocean_assert(cameraDerivativeFunctor != nullptr);
 	ocean_assert_and_suppress_unused(firstPoint + numberOfPoints <= pointsSize && numberOfPoints != 0u, pointsSize);
 
-	for (unsigned int i = firstPoint; i < firstPoint + numberOfPoints; ++i)
+	// No descriptors can be computed for points in the coarsest layer of the frame pyramid
+
+	if (pointsPyramidLevel + 1u >= framePyramid->layers())
+	{
+		return;
+	}
+
+	// The kernel offsets depend on the layers' strides only and are shared by all points
+
+	KernelOffsets kernelOffsets;
+	determineKernelOffsets(framePyramid->layer(pointsPyramidLevel).strideElements(), framePyramid->layer(pointsPyramidLevel + 1u).strideElements(), kernelOffsets);
+
+	Eigen::Vector2f batchPoints[numberOfBatchPoints];
+
+	for (unsigned int batchStart = firstPoint; batchStart < firstPoint + numberOfPoints; batchStart += (unsigned int)(numberOfBatchPoints))
 	{
-		ocean_assert(i < pointsSize);
+		const size_t batchSize = std::min(numberOfBatchPoints, size_t(firstPoint + numberOfPoints - batchStart));
+
+		for (size_t n = 0; n < batchSize; ++n)
+		{
+			ocean_assert(batchStart + n < pointsSize);
+
+			const TImagePoint& point = points[batchStart + n];
 
-		const TImagePoint& point = points[i];
+			batchPoints[n] = Eigen::Vector2f(float(point.x()), float(point.y()));
+		}
+
+		computeDescriptorsBatch(*framePyramid, batchPoints, batchSize, pointsPyramidLevel, kernelOffsets, *cameraDerivativeFunctor, freakDescriptor + batchStart);
+	}
+}
+
+template <size_t tSize>
+void FREAKDescriptorT<tSize>::determineKernelOffsets(const unsigned int strideElements, const unsigned int nextLayerStrideElements, KernelOffsets& kernelOffsets)
+{
+	ocean_assert(strideElements != 0u && nextLayerStrideElements != 0u);
 
-		const Eigen::Vector2f eigenPoint(float(point.x()), float(point.y()));
+	for (size_t i = 0; i < kernelRadius1Elements; ++i)
+	{
+		kernelOffsets.radius1[i] = kernelRadius1Y[i] * int(strideElements) + kernelRadius1X[i];
+	}
+
+	for (size_t i = 0; i < kernelRadius2Elements; ++i)
+	{
+		kernelOffsets.radius2[i] = kernelRadius2Y[i] * int(strideElements) + kernelRadius2X[i];
+	}
+
+	for (size_t i = 0; i < kernelRadius3Elements; ++i)
+	{
+		kernelOffsets.radius3[i] = kernelRadius3Y[i] * int(strideElements) + kernelRadius3X[i];
+		kernelOffsets.nextLayerRadius3[i] = kernelRadius3Y[i] * int(nextLayerStrideElements) + kernelRadius3X[i];
+	}
+}
+
+template <size_t tSize>
+void FREAKDescriptorT<tSize>::computeDescriptorsBatch(const FramePyramid& pyramid, const Eigen::Vector2f* points, const size_t size, const unsigned int pointsPyramidLevel, const KernelOffsets& kernelOffsets, const CameraDerivativeFunctor& cameraDerivativeFunctor, FREAKDescriptorT<tSize>* freakDescriptors)
+{
+	ocean_assert(points != nullptr && freakDescriptors != nullptr);
+	ocean_assert(size >= 1 && size <= numberOfBatchPoints);
+	ocean_assert(pointsPyramidLevel + 1u < pyramid.layers());
+
+	// Compute the deformation matrices of all points, the points with valid deformation matrix are stored in a structure-of-arrays layout
+
+	size_t batchIndices[numberOfBatchPoints];
+	float pointsX[numberOfBatchPoints];
+	float pointsY[numberOfBatchPoints];
+	float deformations00[numberOfBatchPoints];
+	float deformations01[numberOfBatchPoints];
+	float deformations10[numberOfBatchPoints];
+	float deformations11[numberOfBatchPoints];
+
+	size_t validPoints = 0;
+
+	for (size_t n = 0; n < size; ++n)
+	{
+		FREAKDescriptorT<tSize>& freakDescriptor = freakDescriptors[n];
+
+		freakDescriptor.dataLevels_ = 0u;
+		ocean_assert(freakDescriptor.isValid() == false);
 
 		float inverseFocalLength;
-		const CameraDerivativeData data = cameraDerivativeFunctor->computeCameraDerivativeData(eigenPoint, pointsPyramidLevel, inverseFocalLength);
+		const CameraDerivativeData data = cameraDerivativeFunctor.computeCameraDerivativeData(points[n], pointsPyramidLevel, inverseFocalLength);
+
+		ocean_assert(inverseFocalLength > 0.0f);
+
+		Eigen::Matrix<float, 2, 2> cellDeformationMatrix;
+		if (computeLocalDeformationMatrixAndOrientation(pyramid, points[n], pointsPyramidLevel, data.unprojectRayIF, inverseFocalLength, data.pointJacobianMatrixIF, cellDeformationMatrix, freakDescriptor.orientation_))
+		{
+			batchIndices[validPoints] = n;
+			pointsX[validPoints] = points[n][0];
+			pointsY[validPoints] = points[n][1];
+			deformations00[validPoints] = cellDeformationMatrix(0, 0);
+			deformations01[validPoints] = cellDeformationMatrix(0, 1);
+			deformations10[validPoints] = cellDeformationMatrix(1, 0);
+			deformations11[validPoints] = cellDeformationMatrix(1, 1);
+
+			++validPoints;
+		}
+	}
+
+	if (validPoints == 0)
+	{
+		return;
+	}
+
+	// Apply the deformation matrices to the locations of all cells
+
+	float warpedCellsX[numberOfCells][numberOfBatchPoints];
+	float warpedCellsY[numberOfCells][numberOfBatchPoints];
+
+	for (size_t cellId = 0; cellId < numberOfCells; ++cellId)
+	{
+		const float cellX = cellsX[cellId];
+		const float cellY = cellsY[cellId];
+
+		for (size_t n = 0; n < validPoints; ++n)
+		{
+			warpedCellsX[cellId][n] = deformations00[n] * cellX + deformations01[n] * cellY;
+			warpedCellsY[cellId][n] = deformations10[n] * cellX + deformations11[n] * cellY;
+		}
+	}
+
+	const Frame& currentFramePyramidLayer = pyramid.layer(pointsPyramidLevel);
+	const Frame& nextFramePyramidLayer = pyramid.layer(pointsPyramidLevel + 1u);
+
+	const PixelType* const currentLayerData = currentFramePyramidLayer.constdata<PixelType>();
+	const unsigned int currentLayerStrideElements = currentFramePyramidLayer.strideElements();
+
+	const PixelType* const nextLayerData = nextFramePyramidLayer.constdata<PixelType>();
+	const unsigned int nextLayerStrideElements = nextFramePyramidLayer.strideElements();
+
+	const int nextLayerWidth = int(nextFramePyramidLayer.width());
+	const int nextLayerHeight = int(nextFramePyramidLayer.height());
+
+	// Points are removed from the batch as soon as a scale level cannot be computed, the remaining scale levels are skipped for such points
+
+	bool activePoints[numberOfBatchPoints];
+	for (size_t n = 0; n < validPoints; ++n)
+	{
+		activePoints[n] = true;
+	}
 
-		computeDescriptor(*framePyramid, eigenPoint, pointsPyramidLevel, freakDescriptor[i], data.unprojectRayIF, inverseFocalLength, data.pointJacobianMatrixIF);
+	// The same intra-level scale factors as in computeDescriptor()
+
+	const float scaleFactors[3] = { 1.0f, 1.2599f, 1.5874f };
+	for (size_t scaleLevel = 0; scaleLevel < 3; ++scaleLevel)
+	{
+		const float scaleFactor = scaleFactors[scaleLevel];
+
+		// Compute the pixel-accurate cell locations for all points, the first 12 cells are located in the next coarser pyramid layer
+
+		int cellsXi[numberOfCells][numberOfBatchPoints];
+		int cellsYi[numberOfCells][numberOfBatchPoints];
+
+		for (size_t cellId = 0; cellId < 12; ++cellId)
+		{
+			for (size_t n = 0; n < validPoints; ++n)
+			{
+				const float cellX = pointsX[n] + scaleFactor * warpedCellsX[cellId][n];
+				const float cellY = pointsY[n] + scaleFactor * warpedCellsY[cellId][n];
+
+				cellsXi[cellId][n] = NumericF::round32(((cellX + 0.5f) * 0.5f) - 0.5f);
+				cellsYi[cellId][n] = NumericF::round32(((cellY + 0.5f) * 0.5f) - 0.5f);
+			}
+		}
+
+		for (size_t cellId = 12; cellId < numberOfCells; ++cellId)
+		{
+			for (size_t n = 0; n < validPoints; ++n)
+			{
+				cellsXi[cellId][n] = NumericF::round32(pointsX[n] + scaleFactor * warpedCellsX[cellId][n]);
+				cellsYi[cellId][n] = NumericF::round32(pointsY[n] + scaleFactor * warpedCellsY[cellId][n]);
+			}
+		}
+
+		bool anyActivePoint = false;
+
+		for (size_t n = 0; n < validPoints; ++n)
+		{
+			if (!activePoints[n])
+			{
+				continue;
+			}
+
+			PixelType cellIntensities[numberOfCells];
+
+			// Cells 0 - 11: radius 3 in the next coarser layer, the (half-)radius must fit into the layer
+
+			for (size_t cellId = 0; cellId < 12; ++cellId)
+			{
+				const int cellXi = cellsXi[cellId][n];
+				const int cellYi = cellsYi[cellId][n];
+
+				if (cellXi - 1 < 0 || cellXi + 1 >= nextLayerWidth || cellYi - 1 < 0 || cellYi + 1 >= nextLayerHeight)
+				{
+					activePoints[n] = false;
+					break;
+				}
+
+				if (cellXi - 3 >= 0 && cellXi + 3 < nextLayerWidth && cellYi - 3 >= 0 && cellYi + 3 < nextLayerHeight)
+				{
+					cellIntensities[cellId] = computeAverageCellIntensity<kernelRadius3Elements>(nextLayerData + (unsigned int)(cellYi) * nextLayerStrideElements + (unsigned int)(cellXi), kernelOffsets.nextLayerRadius3);
+				}
+				else
+				{
+					computeAverageCellIntensity<true>(nextFramePyramidLayer, cellXi, cellYi, kernelRadius3X, kernelRadius3Y, kernelRadius3Elements, cellIntensities[cellId]);
+				}
+			}
+
+			if (!activePoints[n])
+			{
+				continue;
+			}
+
+			// Cells 12 - 23: radius 3, cells 24 - 29: radius 2, cells 30 - 42: radius 1, all in the layer of the points
+
+			for (size_t cellId = 12; cellId < numberOfCells; ++cellId)
+			{
+				const int cellXi = cellsXi[cellId][n];
+				const int cellYi = cellsYi[cellId][n];
+
+				ocean_assert(cellXi >= 0 && cellXi < int(currentFramePyramidLayer.width()) && cellYi >= 0 && cellYi < int(currentFramePyramidLayer.height()));
+
+				const PixelType* const cellCenter = currentLayerData + (unsigned int)(cellYi) * currentLayerStrideElements + (unsigned int)(cellXi);
+
+				if (cellId < 24)
+				{
+					cellIntensities[cellId] = computeAverageCellIntensity<kernelRadius3Elements>(cellCenter, kernelOffsets.radius3);
+				}
+				else if (cellId < 30)
+				{
+					cellIntensities[cellId] = computeAverageCellIntensity<kernelRadius2Elements>(cellCenter, kernelOffsets.radius2);
+				}
+				else
+				{
+					cellIntensities[cellId] = computeAverageCellIntensity<kernelRadius1Elements>(cellCenter, kernelOffsets.radius1);
+				}
+			}
+
+			// Compute the binary descriptor for the current scale level
+
+			FREAKDescriptorT<tSize>& freakDescriptor = freakDescriptors[batchIndices[n]];
+
+			for (size_t i = 0; i < tSize; ++i)
+			{
+				uint8_t partialDescriptor = 0u;
+
+				for (size_t j = 0; j < 8; ++j)
+				{
+					partialDescriptor = uint8_t(partialDescriptor << 1u);
+
+					const size_t pair = i * 8 + j;
+					ocean_assert(pair < FREAKDescriptorT<tSize>::numberOfCellPairs);
+
+					if (cellIntensities[FREAKDescriptorT<tSize>::cellPairs[pair][0]] > cellIntensities[FREAKDescriptorT<tSize>::cellPairs[pair][1]])
+					{
+						partialDescriptor = partialDescriptor | 1u;
+					}
+				}
+
+				freakDescriptor.data_[scaleLevel][i] = partialDescriptor;
+			}
+
+			freakDescriptor.dataLevels_ = (unsigned int)(scaleLevel + 1);
+
+			anyActivePoint = true;
+		}
+
+		if (!anyActivePoint)
+		{
+			break;
+		}
 	}
 }
 
+template <size_t tSize>
+template <size_t tKernelElements>
+OCEAN_FORCE_INLINE typename FREAKDescriptorT<tSize>::PixelType FREAKDescriptorT<tSize>::computeAverageCellIntensity(const PixelType* cellCenter, const int* kernelOffsets)
+{
+	ocean_assert(cellCenter != nullptr && kernelOffsets != nullptr);
+
+	unsigned int sum = 0u;
+
+	for (size_t i = 0; i < tKernelElements; ++i)
+	{
+		sum += cellCenter[kernelOffsets[i]];
+	}
+
+	ocean_assert(float(sum) / float(tKernelElements) <= 255.0f);
+
+	return PixelType(float(sum) / float(tKernelElements));
+}
+
 template <size_t tSize>
 bool FREAKDescriptorT<tSize>::computeLocalDeformationMatrixAndOrientation(const FramePyramid& pyramid, const Eigen::Vector2f& point, const unsigned int pointPyramidLevel, const Eigen::Vector3f& unprojectRayIF, const float inverseFocalLength, const PointJacobianMatrix2x3& projectionJacobianMatrix, Eigen::Matrix<float, 2, 2> & deformationMatrix, float& orientation)
 {
@@ -79,6 +79,22 @@ void FrameChangeDetector::addGyroSample(const Vector3& rotationRate, const Times
 }
 
 FrameChangeDetector::FrameChangeResult FrameChangeDetector::detectFrameChange(const Frame& yFrame, const Quaternion& world_R_camera, Worker* worker)
+{
+	return processFrame(yFrame, nullptr, world_R_camera, worker);
+}
+
+FrameChangeDetector::FrameChangeResult FrameChangeDetector::detectFrameChange(const Frame& yFrame, const AnyCamera& camera, const Quaternion& world_R_camera, Worker* worker)
+{
+	if (!camera.isValid() || camera.width() != yFrame.width() || camera.height() != yFrame.height())
+	{
+		ocean_assert(false && "Invalid camera profile!");
+		return FrameChangeResult::INVALID_INPUT;
+	}
+
+	return processFrame(yFrame, &camera, world_R_camera, worker);
+}
+
+FrameChangeDetector::FrameChangeResult FrameChangeDetector::processFrame(const Frame& yFrame, const AnyCamera* camera, const Quaternion& world_R_camera, Worker* worker)
 {
 	if (!isValid() || !yFrame || yFrame.width() < options_.targetFrameWidth || yFrame.height() < options_.targetFrameHeight || !FrameType::formatIsGeneric(yFrame.pixelFormat(), FrameType::DT_UNSIGNED_INTEGER_8, 1u))
 	{
@@ -137,19 +153,30 @@ FrameChangeDetector::FrameChangeResult FrameChangeDetector::detectFrameChange(co
 	// If the desired frame size for processing is smaller than the input frame size, directly resize to that smaller frame size.
 	// It's most efficient to simply perform nearest-neighbor sampling; since we don't need a high-quality resampling, we'll go with this.
 
-	// Resample to the desired size and create a frame with 4-byte-aligned data.
-	Frame yFrameResized(yFrame, Frame::ACM_USE_KEEP_LAYOUT);
+	// Resample to the desired size and create a frame with 4-byte-aligned data, the memory of the resampled frame is reused for all frames.
+	const Frame* yFrameResized = &yFrame;
 	const unsigned int paddingElements = (4u - options_.targetFrameWidth % 4u) % 4u;
 
-	if (yFrameResized.width() != options_.targetFrameWidth || yFrameResized.height() != options_.targetFrameHeight || paddingElements != 0u)
+	if (yFrame.width() != options_.targetFrameWidth || yFrame.height() != options_.targetFrameHeight || yFrame.paddingElements() != paddingElements)
 	{
-		Frame yFrameResampled(FrameType(yFrameResized, options_.targetFrameWidth, options_.targetFrameHeight), paddingElements);
-		CV::FrameInterpolatorNearestPixel::resize<uint8_t, 1u>(yFrameResized.constdata<uint8_t>(), yFrameResampled.data<uint8_t>(), yFrameResized.width(), yFrameResized.height(), yFrameResampled.width(), yFrameResampled.height(), yFrameResized.paddingElements(), yFrameResampled.paddingElements(), worker);
-		std::swap(yFrameResized, yFrameResampled);
+		const FrameType resizedFrameType(yFrame, options_.targetFrameWidth, options_.targetFrameHeight);
+
+		if (resizedFrame_.frameType() != resizedFrameType)
+		{
+			resizedFrame_ = Frame(resizedFrameType, paddingElements);
+		}
+
+		CV::FrameInterpolatorNearestPixel::resize<uint8_t, 1u>(yFrame.constdata<uint8_t>(), resizedFrame_.data<uint8_t>(), yFrame.width(), yFrame.height(), resizedFrame_.width(), resizedFrame_.height(), yFrame.paddingElements(), resizedFrame_.paddingElements(), worker);
+
+		yFrameResized = &resizedFrame_;
 	}
 
+	// The device rotation since the keyframe can only be compensated if both orientations are known.
+	const bool compensateRotation = camera != nullptr && world_R_camera.isValid() && world_R_keyframe_.isValid() && keyframeFrame_.isValid() && keyframeFrame_.timestamp() == keyframeTimestamp_;
+	const Quaternion keyframe_R_camera = compensateRotation ? world_R_keyframe_.inverted() * world_R_camera : Quaternion(false);
+
 	// Actually compute histograms for the tiles.
-	computeTileHistograms(yFrameResized, !setAsKeyframe, worker);
+	computeTileHistograms(*yFrameResized, !setAsKeyframe, compensateRotation ? camera : nullptr, keyframe_R_camera, worker);
 
 	// Score the current frame difference and update the keyframe if a relevant change in visual content has occurred.
 	// The "difference score" between frames is computed as
@@ -198,27 +225,48 @@ FrameChangeDetector::FrameChangeResult FrameChangeDetector::detectFrameChange(co
 
 		world_R_keyframe_ = world_R_camera.isValid() ? world_R_camera : Quaternion(false);
 
+		// The keyframe image is needed for rotation compensation only, so it is only stored if a camera profile is known.
+		if (camera != nullptr && world_R_keyframe_.isValid())
+		{
+			if (yFrameResized == &resizedFrame_)
+			{
+				std::swap(keyframeFrame_, resizedFrame_);
+			}
+			else
+			{
+				if (keyframeFrame_.frameType() != yFrameResized->frameType())
+				{
+					keyframeFrame_ = Frame(yFrameResized->frameType(), paddingElements);
+				}
+
+				keyframeFrame_.copy(0, 0, *yFrameResized);
+			}
+
+			keyframeFrame_.setTimestamp(keyframeTimestamp_);
+		}
+
 		return FrameChangeResult::CHANGE_DETECTED;
 	}
 
 	return FrameChangeResult::NO_CHANGE_DETECTED;
 }
 
-void FrameChangeDetector::computeTileHistograms(const Frame& yFrame, bool shouldComputeHistogramDistance, Worker* worker)
+void FrameChangeDetector::computeTileHistograms(const Frame& yFrame, bool shouldComputeHistogramDistance, const AnyCamera* camera, const Quaternion& keyframe_R_camera, Worker* worker)
 {
 	ocean_assert(isValid());
+	ocean_assert(camera == nullptr || keyframe_R_camera.isValid());
 
 	if (worker)
 	{
-		worker->executeFunction(Worker::Function::create(*this, &FrameChangeDetector::computeTileHistogramsSubset, yFrame.constdata<uint8_t>(), yFrame.strideBytes(), shouldComputeHistogramDistance, 0u, 0u), 0u, (unsigned int)(tileHistograms_.size()));
+		worker->executeFunction(Worker::Function::create(*this, &FrameChangeDetector::computeTileHistogramsSubset, yFrame.constdata<uint8_t>(), yFrame.strideBytes(), shouldComputeHistogramDistance, camera, &keyframe_R_camera, 0u, 0u), 0u, (unsigned int)(tileHistograms_.size()), 5u, 6u, 4u);
 	}
 	else
 	{
-		computeTileHistogramsSubset(yFrame.constdata<uint8_t>(), yFrame.strideBytes(), shouldComputeHistogramDistance, 0u, (unsigned int)(tileHistograms_.size()));
+		computeTileHistogramsSubset(yFrame.constdata<uint8_t>(), yFrame.strideBytes(), shouldComputeHistogramDistance, camera, &keyframe_R_camera, 0u, (unsigned int)(tileHistograms_.size()));
 	}
 }
 
-void FrameChangeDetector::computeTileHistogramsSubset(const uint8_t* yFrame, const unsigned int yFrameStride, bool shouldComputeHistogramDistance, unsigned int tileIndexStart, unsigned int numTilesToProcess)
+void FrameChangeDetector::computeTileHistogramsSubset(const uint8_t* yFrame, const unsigned int yFrameStride, bool shouldComputeHistogramDistance, const AnyCamera* camera, const Quaternion* keyframe_R_camera, unsigned int tileIndexStart, unsigned int numTilesToProcess)
 {
 	static_assert(kNumberIntensityBins != 0u, "Number of histogram bins is set to zero!");
 
@@ -239,7 +287,6 @@ void FrameChangeDetector::computeTileHistogramsSubset(const uint8_t* yFrame, con
 	for (unsigned int tileIndex = tileIndexStart; tileIndex < tileIndexEnd; ++tileIndex)
 	{
 		TileHistogram& tileHistogram = tileHistograms_[tileIndex];
-		tileHistogram.fill(0u);
 
 		ocean_assert(tileColumns_ != 0u);
 		const unsigned int tileRow = tileIndex / tileColumns_;
@@ -251,33 +298,102 @@ void FrameChangeDetector::computeTileHistogramsSubset(const uint8_t* yFrame, con
 		const unsigned int startColumn = std::min(tileColumn * options_.spatialBinSize, options_.targetFrameWidth);
 		const unsigned int endColumn = std::min((tileColumn + 1u) * options_.spatialBinSize, options_.targetFrameWidth);
 
-		for (unsigned int r = startRow; r < endRow; ++r)
-		{
-			const uint8_t* framePtr = yFrame + r * yFrameStride + startColumn;
-
-			// Encourage vectorized computation by processing 4 pixels at a time.
-			for (unsigned int c = startColumn; c + 4u <= endColumn; c += 4u, framePtr += 4u)
-			{
-				++tileHistogram[uint32_t(framePtr[0]) / kIntensityBinWidth];
-				++tileHistogram[uint32_t(framePtr[1]) / kIntensityBinWidth];
-				++tileHistogram[uint32_t(framePtr[2]) / kIntensityBinWidth];
-				++tileHistogram[uint32_t(framePtr[3]) / kIntensityBinWidth];
-			}
-		}
+		computeHistogram(yFrame, yFrameStride, startColumn, endColumn, startRow, endRow, tileHistogram);
 
 		// Compute the histogram difference versus the keyframe, if applicable.
 		Scalar histogramDistance = Scalar(0.0);
 		if (shouldComputeHistogramDistance)
 		{
-			const TileHistogram& keyframeTileHistogram = keyframeTileHistograms_[tileIndex];
+			if (camera != nullptr)
+			{
+				// We compare with the keyframe content observing the same viewing direction, tiles showing new content receive the maximal distance.
+				ocean_assert(keyframe_R_camera != nullptr);
+
+				TileHistogram keyframeTileHistogram;
+				if (determineKeyframeTileHistogram(startColumn, endColumn, startRow, endRow, *camera, *keyframe_R_camera, keyframeTileHistogram))
+				{
+					histogramDistance = computeHistogramDistance(tileHistogram, keyframeTileHistogram);
+				}
+				else
+				{
+					histogramDistance = options_.histogramDistanceThreshold;
+				}
+			}
+			else
+			{
+				const TileHistogram& keyframeTileHistogram = keyframeTileHistograms_[tileIndex];
 
-			histogramDistance = computeHistogramDistance(tileHistogram, keyframeTileHistogram);
+				histogramDistance = computeHistogramDistance(tileHistogram, keyframeTileHistogram);
+			}
 		}
 
 		histogramDistances_(tileRow, tileColumn) = histogramDistance;
 	}
 }
 
+bool FrameChangeDetector::determineKeyframeTileHistogram(const unsigned int startColumn, const unsigned int endColumn, const unsigned int startRow, const unsigned int endRow, const AnyCamera& camera, const Quaternion& keyframe_R_camera, TileHistogram& keyframeTileHistogram) const
+{
+	ocean_assert(camera.isValid() && keyframe_R_camera.isValid());
+	ocean_assert(startColumn < endColumn && endColumn <= options_.targetFrameWidth);
+	ocean_assert(startRow < endRow && endRow <= options_.targetFrameHeight);
+	ocean_assert(keyframeFrame_.width() == options_.targetFrameWidth && keyframeFrame_.height() == options_.targetFrameHeight);
+
+	// The tiles are defined in the domain of the resized frame, while the camera profile is defined in the domain of the input frame.
+	const Scalar cameraScaleX = Scalar(camera.width()) / Scalar(options_.targetFrameWidth);
+	const Scalar cameraScaleY = Scalar(camera.height()) / Scalar(options_.targetFrameHeight);
+
+	const Vector2 tileCenter(Scalar(startColumn + endColumn) * Scalar(0.5), Scalar(startRow + endRow) * Scalar(0.5));
+
+	const Vector3 keyframeRay = keyframe_R_camera * camera.vector(Vector2(tileCenter.x() * cameraScaleX, tileCenter.y() * cameraScaleY));
+
+	// The camera is looking towards the negative z-axis.
+	if (keyframeRay.z() >= -Numeric::eps())
+	{
+		return false;
+	}
+
+	const Vector2 cameraKeyframePoint = camera.projectToImage(keyframeRay);
+	const Vector2 keyframePoint(cameraKeyframePoint.x() / cameraScaleX, cameraKeyframePoint.y() / cameraScaleY);
+
+	if (keyframePoint.x() < Scalar(0) || keyframePoint.y() < Scalar(0) || keyframePoint.x() >= Scalar(options_.targetFrameWidth) || keyframePoint.y() >= Scalar(options_.targetFrameHeight))
+	{
+		return false;
+	}
+
+	// We determine the histogram of the keyframe area with tile size centered at the corresponding location, the area is shifted into the frame if necessary.
+	const unsigned int tileWidth = endColumn - startColumn;
+	const unsigned int tileHeight = endRow - startRow;
+
+	const unsigned int keyframeStartColumn = (unsigned int)(minmax<int>(0, Numeric::round32(keyframePoint.x() - Scalar(tileWidth) * Scalar(0.5)), int(options_.targetFrameWidth - tileWidth)));
+	const unsigned int keyframeStartRow = (unsigned int)(minmax<int>(0, Numeric::round32(keyframePoint.y() - Scalar(tileHeight) * Scalar(0.5)), int(options_.targetFrameHeight - tileHeight)));
+
+	computeHistogram(keyframeFrame_.constdata<uint8_t>(), keyframeFrame_.strideBytes(), keyframeStartColumn, keyframeStartColumn + tileWidth, keyframeStartRow, keyframeStartRow + tileHeight, keyframeTileHistogram);
+
+	return true;
+}
+
+void FrameChangeDetector::computeHistogram(const uint8_t* yFrame, const unsigned int yFrameStride, const unsigned int startColumn, const unsigned int endColumn, const unsigned int startRow, const unsigned int endRow, TileHistogram& tileHistogram)
+{
+	ocean_assert(yFrame != nullptr);
+	ocean_assert(startColumn <= endColumn && startRow <= endRow);
+
+	tileHistogram.fill(0u);
+
+	for (unsigned int r = startRow; r < endRow; ++r)
+	{
+		const uint8_t* framePtr = yFrame + r * yFrameStride + startColumn;
+
+		// Encourage vectorized computation by processing 4 pixels at a time.
+		for (unsigned int c = startColumn; c + 4u <= endColumn; c += 4u, framePtr += 4u)
+		{
+			++tileHistogram[uint32_t(framePtr[0]) / kIntensityBinWidth];
+			++tileHistogram[uint32_t(framePtr[1]) / kIntensityBinWidth];
+			++tileHistogram[uint32_t(framePtr[2]) / kIntensityBinWidth];
+			++tileHistogram[uint32_t(framePtr[3]) / kIntensityBinWidth];
+		}
+	}
+}
+
 Scalar FrameChangeDetector::computeHistogramDistance(const FrameChangeDetector::TileHistogram& histogram1, const FrameChangeDetector::TileHistogram& histogram2)
 {
 	static_assert(kNumberIntensityBins != 0u, "Number of histogram bins is set to zero!");
@@ -13,6 +13,7 @@
 #include "ocean/base/Frame.h"
 #include "ocean/base/Worker.h"
 
+#include "ocean/math/AnyCamera.h"
 #include "ocean/math/Matrix.h"
 #include "ocean/math/Quaternion.h"
 
@@ -31,7 +32,8 @@ namespace Detector
 /**
  * This class implements a simple detection algorithm to compute whether a camera's image content has significantly changed between a given frame and a registered keyframe.
  * The implementation uses intensity histogram comparison over local image tiles and scores the overall difference across all tiles in the image space.
- * The class also allows for accelerometer and gyroscope readings to be fed to the detector, to avoid keyframe selection when the image is blurry.
+ * The class also allows for accelerometer and gyroscope readings to be fed to the detector, to avoid keyframe selection when the image is blurry.<br>
+ * If the camera profile and the device orientation are known, the tiles of the current frame are compared with the keyframe areas observing the same viewing directions, so that pure device rotations do not result in false changes.
  * @ingroup cvdetector
  */
 class OCEAN_CV_DETECTOR_EXPORT FrameChangeDetector
@@ -162,6 +164,19 @@ class OCEAN_CV_DETECTOR_EXPORT FrameChangeDetector
 		 */
 		FrameChangeResult detectFrameChange(const Frame& yFrame, const Quaternion& world_R_camera, Worker* worker = nullptr);
 
+		/**
+		 * Handles one frame of input and determines whether a significant change in visual content has occurred, the device rotation since the keyframe is compensated.
+		 * Each tile of the current frame is compared with the histogram of the keyframe area (with tile size) which is centered at the location observing the same viewing direction in the keyframe.<br>
+		 * Tiles without a corresponding location in the keyframe show new content and are scored with the maximal distance, options().histogramDistanceThreshold.<br>
+		 * Without a valid orientation for the current frame or the keyframe, this function behaves like detectFrameChange() without camera.
+		 * @param yFrame Input frame; must be valid with 8-bit grayscale format; the frame size must not be smaller than (options().targetFrameWidth)x(options().targetFrameHeight).
+		 * @param camera The camera profile of the input frame, must be valid with the same resolution as the input frame
+		 * @param world_R_camera Optional prior on the device's 3DOF orientation as provided by the device's internal sensor fusion algorithm, may be invalid
+		 * @param worker Optional worker to distribute the computation
+		 * @return Indicator of whether a frame change occurred, or an error value if invalid input was provided
+		 */
+		FrameChangeResult detectFrameChange(const Frame& yFrame, const AnyCamera& camera, const Quaternion& world_R_camera, Worker* worker = nullptr);
+
 		/**
 		 * Returns the set of options that were specified when this detector was created.
 		 * @return Options for the detector
@@ -201,23 +216,62 @@ class OCEAN_CV_DETECTOR_EXPORT FrameChangeDetector
 
 	private:
 
+		/**
+		 * Handles one frame of input and determines whether a significant change in visual content has occurred.
+		 * @param yFrame Input frame; must be valid with 8-bit grayscale format
+		 * @param camera Optional camera profile of the input frame to compensate the device rotation since the keyframe, nullptr to compare tiles at identical locations
+		 * @param world_R_camera Optional prior on the device's 3DOF orientation, may be invalid
+		 * @param worker Optional worker to distribute the computation
+		 * @return Indicator of whether a frame change occurred, or an error value if invalid input was provided
+		 */
+		FrameChangeResult processFrame(const Frame& yFrame, const AnyCamera* camera, const Quaternion& world_R_camera, Worker* worker);
+
 		/**
 		 * Computes the local intensity histograms for all tiles in the image.
 		 * @param yFrame Uint8 grayscale image to process
 		 * @param shouldComputeHistogramDistances If true, the histogram difference with the keyframe will be additionally computed for each tile; if false, this step is skipped
+		 * @param camera Optional camera profile of the original input frame, nullptr to compare tiles at identical locations
+		 * @param keyframe_R_camera The rotation between the current frame and the keyframe, must be valid if 'camera' is defined
 		 * @param worker Optional worker to distribute the computation
 		 */
-		void computeTileHistograms(const Frame& yFrame, bool shouldComputeHistogramDistances, Worker* worker);
+		void computeTileHistograms(const Frame& yFrame, bool shouldComputeHistogramDistances, const AnyCamera* camera, const Quaternion& keyframe_R_camera, Worker* worker);
 
 		/**
 		 * Computes the local intensity histograms for a subset of image tiles.
 		 * @param yFrame Pointer to uint8 grayscale image data
 		 * @param yFrameStride Stride of the yFrame rows in bytes (i.e., 4-byte-aligned)
 		 * @param shouldComputeHistogramDistances If true, the histogram difference with the keyframe will be additionally computed for each tile; if false, this step is skipped
+		 * @param camera Optional camera profile of the original input frame, nullptr to compare tiles at identical locations
+		 * @param keyframe_R_camera The rotation between the current frame and the keyframe, must be valid if 'camera' is defined
 		 * @param tileIndexStart Row-major linear index for the first tile to process
 		 * @param numTilesToProcess Number of tiles that will be sequentially processed starting with tileIndex
 		 */
-		void computeTileHistogramsSubset(const uint8_t* yFrame, const unsigned int yFrameStride, bool shouldComputeHistogramDistances, unsigned int tileIndexStart, unsigned int numTilesToProcess);
+		void computeTileHistogramsSubset(const uint8_t* yFrame, const unsigned int yFrameStride, bool shouldComputeHistogramDistances, const AnyCamera* camera, const Quaternion* keyframe_R_camera, unsigned int tileIndexStart, unsigned int numTilesToProcess);
+
+		/**
+		 * Determines the histogram of the keyframe area observing the same viewing direction as a tile of the current frame.
+		 * @param startColumn The first column of the tile in the current frame, with range [0, options().targetFrameWidth)
+		 * @param endColumn The (exclusive) end column of the tile in the current frame, with range (startColumn, options().targetFrameWidth]
+		 * @param startRow The first row of the tile in the current frame, with range [0, options().targetFrameHeight)
+		 * @param endRow The (exclusive) end row of the tile in the current frame, with range (startRow, options().targetFrameHeight]
+		 * @param camera The camera profile of the original input frame, must be valid
+		 * @param keyframe_R_camera The rotation between the current frame and the keyframe, must be valid
+		 * @param keyframeTileHistogram The resulting histogram of the keyframe area with the same size as the tile
+		 * @return True, if the viewing direction is visible in the keyframe; False, if the tile shows new content
+		 */
+		bool determineKeyframeTileHistogram(const unsigned int startColumn, const unsigned int endColumn, const unsigned int startRow, const unsigned int endRow, const AnyCamera& camera, const Quaternion& keyframe_R_camera, TileHistogram& keyframeTileHistogram) const;
+
+		/**
+		 * Computes the local intensity histogram of an image area.
+		 * @param yFrame Pointer to uint8 grayscale image data
+		 * @param yFrameStride Stride of the yFrame rows in bytes
+		 * @param startColumn The first column of the area
+		 * @param endColumn The (exclusive) end column of the area, with range [startColumn, infinity)
+		 * @param startRow The first row of the area
+		 * @param endRow The (exclusive) end row of the area, with range [startRow, infinity)
+		 * @param tileHistogram The resulting histogram
+		 */
+		static void computeHistogram(const uint8_t* yFrame, const unsigned int yFrameStride, const unsigned int startColumn, const unsigned int endColumn, const unsigned int startRow, const unsigned int endRow, TileHistogram& tileHistogram);
 
 		/**
 		 * Computes a distance score between two histograms.
@@ -261,6 +315,12 @@ class OCEAN_CV_DETECTOR_EXPORT FrameChangeDetector
 
 		/// 3DOF rotation of the last keyframe relative to a world coordinate frame. If rotations are not available or if no frames have been processed, this will be set to invalid.
 		Quaternion world_R_keyframe_;
+
+		/// The input frame resized to the target frame size, the memory is reused for all frames.
+		Frame resizedFrame_;
+
+		/// The current keyframe with target frame size, only available if the keyframe has been processed with a camera profile; the memory is reused for all keyframes.
+		Frame keyframeFrame_;
 };
 
 inline bool FrameChangeDetector::Options::isValid() const
@@ -291,7 +351,9 @@ inline FrameChangeDetector::FrameChangeDetector(FrameChangeDetector&& other) noe
 	keyframeTimestamp_(other.keyframeTimestamp_),
 	lastLargeMotionTimestamp_(other.lastLargeMotionTimestamp_),
 	histogramDistances_(std::move(other.histogramDistances_)),
-	world_R_keyframe_(std::move(other.world_R_keyframe_))
+	world_R_keyframe_(std::move(other.world_R_keyframe_)),
+	resizedFrame_(std::move(other.resizedFrame_)),
+	keyframeFrame_(std::move(other.keyframeFrame_))
 {
 	// nothing to do, here
 }
@@ -336,6 +398,8 @@ inline FrameChangeDetector& FrameChangeDetector::operator=(FrameChangeDetector&&
 		lastLargeMotionTimestamp_ = other.lastLargeMotionTimestamp_;
 		histogramDistances_ = std::move(other.histogramDistances_);
 		world_R_keyframe_ = std::move(other.world_R_keyframe_);
+		resizedFrame_ = std::move(other.resizedFrame_);
+		keyframeFrame_ = std::move(other.keyframeFrame_);
 	}
 
 	return *this;
@@ -205,7 +205,7 @@ bool HarrisCornerDetector::detectCorners(const uint8_t* yFrame, const unsigned i
 	return true;
 }
 
-void HarrisCornerDetector::harrisVotesFrame(const uint8_t* yFrame, const unsigned int width, const unsigned int height, const unsigned int yFramePaddingElements, int32_t* votes, const unsigned int votesPaddingElements, Worker* worker, const bool setBorderPixels)
+void HarrisCornerDetector::harrisVotesFrame(const uint8_t* yFrame, const unsigned int width, const unsigned int height, const unsigned int yFramePaddingElements, int32_t* votes, const unsigned int votesPaddingElements, Worker* worker, const bool setBorderPixels, int8_t* sobelResponses, const unsigned int sobelResponsesPaddingElements)
 {
 	ocean_assert(yFrame != nullptr && votes != nullptr);
 
@@ -215,10 +215,40 @@ void HarrisCornerDetector::harrisVotesFrame(const uint8_t* yFrame, const unsigne
 		return;
 	}
 
-	Frame filterResponse(FrameType(width, height, FrameType::genericPixelFormat<int8_t, 2u>(), FrameType::ORIGIN_UPPER_LEFT));
-	CV::FrameFilterSobel::filterHorizontalVertical8BitPerChannel<int8_t, 1u>(yFrame, filterResponse.data<int8_t>(), width, height, yFramePaddingElements, filterResponse.paddingElements(), worker);
+	if (worker)
+	{
+		worker->executeFunction(Worker::Function::createStatic(&harrisVotesFrameSubset, yFrame, width, height, yFramePaddingElements, votes, votesPaddingElements, sobelResponses, sobelResponsesPaddingElements, 0u, 0u), 0u, height, 8u, 9u, 40u);
+	}
+	else
+	{
+		harrisVotesFrameSubset(yFrame, width, height, yFramePaddingElements, votes, votesPaddingElements, sobelResponses, sobelResponsesPaddingElements, 0u, height);
+	}
+
+	if (setBorderPixels)
+	{
+		constexpr int32_t neutralResponse = 0;
+
+		const unsigned int votesStrideElements = width + votesPaddingElements;
+
+		// top 2 rows
+		memset(votes, neutralResponse, sizeof(int32_t) * width);
+		memset(votes + votesStrideElements, neutralResponse, sizeof(int32_t) * width);
+
+		for (unsigned int y = 2u; y < height - 2u; ++y)
+		{
+			int32_t* const votesRow = votes + y * votesStrideElements;
+
+			votesRow[0] = neutralResponse;
+			votesRow[1] = neutralResponse;
 
-	harrisVotesFrameSobelResponse(filterResponse.constdata<int8_t>(), width, height, filterResponse.paddingElements(), votes, votesPaddingElements, worker, setBorderPixels);
+			votesRow[width - 2u] = neutralResponse;
+			votesRow[width - 1u] = neutralResponse;
+		}
+
+		// bottom 2 rows
+		memset(votes + votesStrideElements * (height - 2u), neutralResponse, sizeof(int32_t) * width);
+		memset(votes + votesStrideElements * (height - 1u), neutralResponse, sizeof(int32_t) * width);
+	}
 }
 
 void HarrisCornerDetector::harrisVotesFrameSobelResponse(const int8_t* sobelResponse, const unsigned int width, const unsigned int height, const unsigned int sobelResponsePaddingElements, int32_t* votes, const unsigned int votesPaddingElements, Worker* worker, const bool setBorderPixels)
@@ -377,6 +407,101 @@ void HarrisCornerDetector::harrisVotesByResponseSubset(const int8_t* response, c
 	}
 }
 
+void HarrisCornerDetector::harrisVotesFrameSubset(const uint8_t* yFrame, const unsigned int width, const unsigned int height, const unsigned int yFramePaddingElements, int32_t* votes, const unsigned int votesPaddingElements, int8_t* sobelResponses, const unsigned int sobelResponsesPaddingElements, const unsigned int firstRow, const unsigned int numberRows)
+{
+	ocean_assert(yFrame != nullptr && votes != nullptr);
+	ocean_assert(width >= 10u && height >= 7u);
+	ocean_assert(firstRow + numberRows <= height);
+
+	const unsigned int yFrameStrideElements = width + yFramePaddingElements;
+	const unsigned int votesStrideElements = width + votesPaddingElements;
+	const unsigned int sobelResponsesStrideElements = width * 2u + sobelResponsesPaddingElements;
+
+	const unsigned int endRow = firstRow + numberRows;
+
+	// the votes of row y need the sobel responses of the rows y - 1, y, and y + 1, the three most recent sobel rows are kept in a ring buffer
+
+	const unsigned int firstVoteRow = std::max(firstRow, 2u);
+	const unsigned int endVoteRow = std::min(endRow, height - 2u);
+
+	const unsigned int firstResponseRow = std::min(firstRow, firstVoteRow - 1u);
+	const unsigned int endResponseRow = std::max(endRow, endVoteRow + 1u);
+
+	Memory responseRowsMemory = Memory::create<int8_t>(size_t(width) * 2u * 3u);
+	Memory columnTensorsMemory = Memory::create<int32_t>(size_t(width) * 3u);
+
+	int8_t* const responseRows = responseRowsMemory.data<int8_t>();
+	int32_t* const columnTensors = columnTensorsMemory.data<int32_t>();
+
+	for (unsigned int y = firstResponseRow; y < endResponseRow; ++y)
+	{
+		int8_t* const responseRow = responseRows + (y % 3u) * width * 2u;
+
+		CV::FrameFilterSobel::filterHorizontalVerticalRow<uint8_t, int8_t, 1u, 2u>(yFrame + y * yFrameStrideElements, responseRow, width, height, y, yFrameStrideElements, width * 2u);
+
+		if (sobelResponses != nullptr && y >= firstRow && y < endRow)
+		{
+			memcpy(sobelResponses + y * sobelResponsesStrideElements, responseRow, sizeof(int8_t) * width * 2u);
+		}
+
+		// the response row y completes the neighborhood of the vote row y - 1
+
+		if (y >= firstVoteRow + 1u && y <= endVoteRow)
+		{
+			const unsigned int voteRow = y - 1u;
+
+			const int8_t* const response0 = responseRows + ((voteRow - 1u) % 3u) * width * 2u;
+			const int8_t* const response1 = responseRows + (voteRow % 3u) * width * 2u;
+
+			harrisVotesRow(response0, response1, responseRow, width, columnTensors, votes + voteRow * votesStrideElements);
+		}
+	}
+}
+
+void HarrisCornerDetector::harrisVotesRow(const int8_t* response0, const int8_t* response1, const int8_t* response2, const unsigned int width, int32_t* columnTensors, int32_t* votesRow)
+{
+	ocean_assert(response0 != nullptr && response1 != nullptr && response2 != nullptr);
+	ocean_assert(columnTensors != nullptr && votesRow != nullptr);
+	ocean_assert(width >= 10u);
+
+	// the column-wise structure tensor (Ixx, Iyy, Ixy) of the three rows, for the columns [1, width - 2], the sums are exact integers
+
+	int32_t* const columnXX = columnTensors;
+	int32_t* const columnYY = columnTensors + width;
+	int32_t* const columnXY = columnTensors + width * 2u;
+
+	for (unsigned int x = 1u; x < width - 1u; ++x)
+	{
+		const int32_t x0 = response0[x * 2u + 0u];
+		const int32_t y0 = response0[x * 2u + 1u];
+		const int32_t x1 = response1[x * 2u + 0u];
+		const int32_t y1 = response1[x * 2u + 1u];
+		const int32_t x2 = response2[x * 2u + 0u];
+		const int32_t y2 = response2[x * 2u + 1u];
+
+		columnXX[x] = x0 * x0 + x1 * x1 + x2 * x2;
+		columnYY[x] = y0 * y0 + y1 * y1 + y2 * y2;
+		columnXY[x] = x0 * y0 + x1 * y1 + x2 * y2;
+	}
+
+	for (unsigned int x = 2u; x < width - 2u; ++x)
+	{
+		// identical to harrisVotesByResponseSubset()
+
+		const uint32_t Ixx = uint32_t(columnXX[x - 1u] + columnXX[x] + columnXX[x + 1u]);
+		const uint32_t Iyy = uint32_t(columnYY[x - 1u] + columnYY[x] + columnYY[x + 1u]);
+		const int32_t Ixy = columnXY[x - 1u] + columnXY[x] + columnXY[x + 1u];
+
+		const int32_t determinant = int32_t((Ixx / 8u) * (Iyy / 8u)) - int32_t(sqr(Ixy / 8));
+		const uint32_t sqrTrace = sqr((Ixx + Iyy) / 8u);
+
+		ocean_assert(NumericT<int32_t>::isInsideValueRange(int64_t(sqrTrace) * 3ll));
+		ocean_assert(NumericT<int32_t>::isInsideValueRange(int64_t(determinant) - int64_t(sqrTrace) * 3ll / 64ll));
+
+		votesRow[x] = determinant - int32_t((sqrTrace * 3u) / 64u);
+	}
+}
+
 void HarrisCornerDetector::harrisVotesSubPixelSubset(const uint8_t* yFrame, const unsigned int width, const unsigned int yFramePaddingElements, const Vector2* positions, int32_t* votes, const unsigned int firstPosition, const unsigned int numberPositions)
 {
 	ocean_assert(yFrame != nullptr && width >= 7u);
@@ -179,6 +179,7 @@ class OCEAN_CV_DETECTOR_EXPORT HarrisCornerDetector
 
 		/**
 		 * Creates the Harris corner votes for an entire frame (and therefore for each pixel) without applying a maximum suppression.
+		 * The sobel responses, the structure tensor and the votes are determined in one pass, row by row, so that the frame is read only once and no intermediate response frame is necessary.<br>
 		 * The resulting votes may have an invalid 2 pixel wide frame border (depending on 'setBorderPixels').
 		 * @param yFrame The 8 bit (grayscale) frame to be used for Harris application, with minimal size 7x7
 		 * @param width The width of the given frame in pixel, with range [10, infinity)
@@ -188,8 +189,11 @@ class OCEAN_CV_DETECTOR_EXPORT HarrisCornerDetector
 		 * @param votesPaddingElements The number of padding elements at the end of each votes row, in elements, with range [0, infinity)
 		 * @param worker Optional worker object to distribute the computational load to several CPU cores
 		 * @param setBorderPixels True, to set the border pixels to a neutral value; False, to keep random memory values
+		 * @param sobelResponses Optional resulting 16 bit sobel filter responses (8 bit for the horizontal response and 8 bit for the vertical response) determined while creating the votes, nullptr if not of interest
+		 * @param sobelResponsesPaddingElements The number of padding elements at the end of each sobel response row, in elements, with range [0, infinity)
+		 * @see harrisVotesFrameSobelResponse().
 		 */
-		static void harrisVotesFrame(const uint8_t* yFrame, const unsigned int width, const unsigned int height, const unsigned int yFramePaddingElements, int32_t* votes, const unsigned int votesPaddingElements, Worker* worker = nullptr, const bool setBorderPixels = false);
+		static void harrisVotesFrame(const uint8_t* yFrame, const unsigned int width, const unsigned int height, const unsigned int yFramePaddingElements, int32_t* votes, const unsigned int votesPaddingElements, Worker* worker = nullptr, const bool setBorderPixels = false, int8_t* sobelResponses = nullptr, const unsigned int sobelResponsesPaddingElements = 0u);
 
 		/**
 		 * Creates the Harris corner votes for the horizontal and vertical sobel responses for an entire frame (and therefore for each pixel of the original frame) without applying a maximum suppression.
@@ -322,6 +326,34 @@ class OCEAN_CV_DETECTOR_EXPORT HarrisCornerDetector
 		 */
 		static void harrisVotesByResponseSubset(const int8_t* response, const unsigned int width, const unsigned int height, const unsigned int responsePaddingElements, int32_t* votes, const unsigned int votesPaddingElements, const unsigned int firstRow, const unsigned int numberRows);
 
+		/**
+		 * Determines the sobel responses and the Harris votes for a subset of rows of a given 8 bit grayscale frame in one pass.
+		 * The subset keeps the sobel responses of three successive rows in a ring buffer, the frame memory is read only once.
+		 * @param yFrame The 8 bit grayscale frame, must be valid
+		 * @param width The width of the frame in pixel, with range [10, infinity)
+		 * @param height The height of the frame in pixel, with range [7, infinity)
+		 * @param yFramePaddingElements The number of padding elements at the end of each frame row, in elements, with range [0, infinity)
+		 * @param votes Buffer receiving the resulting corner votes, the votes of the 2 pixel wide frame border will not be set, must be valid
+		 * @param votesPaddingElements The number of padding elements at the end of each votes row, in elements, with range [0, infinity)
+		 * @param sobelResponses Optional buffer receiving the sobel responses of the rows of the subset, nullptr if not of interest
+		 * @param sobelResponsesPaddingElements The number of padding elements at the end of each sobel response row, in elements, with range [0, infinity)
+		 * @param firstRow First row to be handled, with range [0, height - 1]
+		 * @param numberRows Number of rows to be handled, with range [1u, height - firstRow]
+		 */
+		static void harrisVotesFrameSubset(const uint8_t* yFrame, const unsigned int width, const unsigned int height, const unsigned int yFramePaddingElements, int32_t* votes, const unsigned int votesPaddingElements, int8_t* sobelResponses, const unsigned int sobelResponsesPaddingElements, const unsigned int firstRow, const unsigned int numberRows);
+
+		/**
+		 * Determines the Harris votes for one row based on the sobel responses of the row and its two neighboring rows.
+		 * The structure tensor is accumulated per column first, so that each squared response is computed only once.
+		 * @param response0 The sobel responses of the row above, must be valid
+		 * @param response1 The sobel responses of the row for which the votes will be determined, must be valid
+		 * @param response2 The sobel responses of the row below, must be valid
+		 * @param width The width of the frame in pixel, with range [10, infinity)
+		 * @param columnTensors Buffer holding (width * 3) elements which can be used to store the column-wise structure tensors, must be valid
+		 * @param votesRow The row receiving the votes for the pixels [2, width - 3], must be valid
+		 */
+		static void harrisVotesRow(const int8_t* response0, const int8_t* response1, const int8_t* response2, const unsigned int width, int32_t* columnTensors, int32_t* votesRow);
+
 		/**
 		 * Creates the Harris corner votes for a subset of specified sub-pixel positions from an 8 bit grayscale frame.
 		 * @param yFrame The 8 bit grayscale frame that is used to determine the vote
@@ -39,6 +39,15 @@ HemiCube::HemiCube(const unsigned int bins, const unsigned int imageWidth, const
 	ocean_assert(numberBins_ != 0u);
 	ocean_assert(imageWidth_ != 0u && imageHeight_ != 0u);
 	ocean_assert(focalLength_ > Scalar(0.0));
+
+	// The spatial grid has approx. 32 cells along the larger image dimension, each cell covers at least 8 pixels
+	const unsigned int cellSize = std::max(8u, (std::max(imageWidth_, imageHeight_) + 31u) / 32u);
+
+	gridCellSize_ = Scalar(cellSize);
+	gridCellsX_ = (imageWidth_ + cellSize - 1u) / cellSize;
+	gridCellsY_ = (imageHeight_ + cellSize - 1u) / cellSize;
+
+	gridCells_.resize(gridCellsX_ * gridCellsY_);
 }
 
 FiniteLines2 HemiCube::mergeGreedyBruteForce(const FiniteLines2& lines, const Scalar maxLineDistance, const Scalar maxLineGap, Indices32* mapping, const Scalar cosAngle)
@@ -121,83 +130,127 @@ void HemiCube::merge(const FiniteLines2& lines, const Scalar maxLineDistance, co
 	if (mapping)
 	{
 		mapping->resize(lines.size());
-		std::fill(mapping->begin(), mapping->end(), (Index32)-1);
 	}
 
-	const Scalar searchRadius = Scalar(1.5); // Covers the 8-neighborhood since > sqrt(2)
-	const Scalar maxSquareLineGap = maxLineGap * maxLineGap;
+	linesInMap_.reserve(linesInMap_.size() + lines.size());
+	mapIndicesOfLines_.reserve(mapIndicesOfLines_.size() + lines.size());
 
 	for (unsigned int lineIndex = 0u; lineIndex < lines.size(); ++lineIndex)
 	{
-		const FiniteLine2& line = lines[lineIndex];
-		ocean_assert(line.isValid());
+		const Index32 mergedLineIndex = merge(lines[lineIndex], maxLineDistance, maxLineGap, cosAngle);
 
-		Scalar bestMatchValue = Numeric::maxValue();
-		Index32 bestMatchLineIndex = (Index32)-1;
-		bool foundMatch = false;
+		if (mapping)
+		{
+			ocean_assert(lineIndex < mapping->size());
+			(*mapping)[lineIndex] = mergedLineIndex;
+		}
+	}
+}
 
-		const IndexSet32 similarLineIndices = find(line, searchRadius);
+Index32 HemiCube::merge(const FiniteLine2& line, const Scalar maxLineDistance, const Scalar maxLineGap, const Scalar cosAngle)
+{
+	ocean_assert(isValid());
+	ocean_assert(line.isValid());
+	ocean_assert(maxLineDistance >= Scalar(0));
+	ocean_assert(maxLineGap >= Scalar(0));
 
-		for (const Index32& similarLineIndex : similarLineIndices)
-		{
-			ocean_assert(similarLineIndex < (Index32)linesInMap_.size());
-			const FiniteLine2& similarLine = linesInMap_[similarLineIndex];
+	const Scalar maxSquareLineGap = maxLineGap * maxLineGap;
 
-			if (!line.isCollinear(similarLine, maxLineDistance, cosAngle))
-			{
-				continue;
-			}
+	Indices32 similarLineIndices;
+	determineCandidates(line, maxLineGap, similarLineIndices);
 
-			const Scalar squareLineGap0 = line.nearestPoint(similarLine.point0()).sqrDistance(similarLine.point0());
-			const Scalar squareLineGap1 = line.nearestPoint(similarLine.point1()).sqrDistance(similarLine.point1());
+	Scalar bestMatchValue = Numeric::maxValue();
+	Index32 bestMatchLineIndex = (Index32)(-1);
 
-			if (std::min(squareLineGap0, squareLineGap1) >= maxSquareLineGap)
-			{
-				continue;
-			}
+	for (const Index32& similarLineIndex : similarLineIndices)
+	{
+		ocean_assert(similarLineIndex < (Index32)linesInMap_.size());
 
-			// Check if the current line is the best match so far.
-			// A good match is supposed to have a small distance of the endpoints from the line segments (maxDistance*, the smaller, the better) and
-			// the segments should be as parallel as possible, i.e. scalar product of the line normals should be as close to 1 as possible (worst case: orthogonal lines, scalar product 0)
-			// The match value if ratio of the max. distance and the inverse of the scalar product, best possible match value: 0, worst match: infinity
-			const Scalar maxDistanceLineToSimilarLine = std::max(line.normal() * (similarLine.point0() - line.point0()), line.normal() * (similarLine.point1() - line.point0()));
-			const Scalar maxDistanceSimilarLineToLine = std::max(similarLine.normal() * (line.point0() - similarLine.point0()), similarLine.normal() * (line.point1() - similarLine.point0()));
-			const Scalar normalAlignment = std::max(Numeric::abs(line.normal() * similarLine.normal()), Numeric::weakEps());
-			ocean_assert(Numeric::isInsideRange(Numeric::weakEps(), normalAlignment, Scalar(1)));
-			const Scalar matchValue = std::max(maxDistanceLineToSimilarLine, maxDistanceSimilarLineToLine) / normalAlignment;
-
-			if (matchValue < bestMatchValue)
-			{
-				bestMatchValue = matchValue;
-				bestMatchLineIndex = similarLineIndex;
-				foundMatch = true;
-			}
+		Scalar matchValue;
+		if (isMergeable(line, linesInMap_[similarLineIndex], maxLineDistance, maxSquareLineGap, cosAngle, matchValue) && matchValue < bestMatchValue)
+		{
+			bestMatchValue = matchValue;
+			bestMatchLineIndex = similarLineIndex;
 		}
+	}
 
-		if (foundMatch == true)
-		{
-			ocean_assert(bestMatchLineIndex < (Index32)linesInMap_.size());
-			const FiniteLine2& mergedLine = fuse(line, linesInMap_[bestMatchLineIndex]);
-			updateLine(bestMatchLineIndex, mergedLine);
+	if (bestMatchLineIndex != (Index32)(-1))
+	{
+		ocean_assert(bestMatchLineIndex < (Index32)linesInMap_.size());
+		const FiniteLine2 mergedLine = fuse(line, linesInMap_[bestMatchLineIndex]);
+		updateLine(bestMatchLineIndex, mergedLine);
 
-			if (mapping)
-			{
-				ocean_assert(lineIndex < mapping->size());
-				(*mapping)[lineIndex] = bestMatchLineIndex;
-			}
-		}
-		else
-		{
-			insert(line);
+		return bestMatchLineIndex;
+	}
 
-			if (mapping)
-			{
-				ocean_assert(lineIndex < mapping->size());
-				ocean_assert(linesInMap_.size() != 0);
-				(*mapping)[lineIndex] = (Index32)(linesInMap_.size() - 1);
-			}
+	insert(line);
+
+	ocean_assert(linesInMap_.size() != 0);
+	return (Index32)(linesInMap_.size() - 1);
+}
+
+Indices32 HemiCube::findMergeCandidates(const FiniteLine2& line, const Scalar maxLineDistance, const Scalar maxLineGap, const Scalar cosAngle) const
+{
+	ocean_assert(isValid());
+	ocean_assert(line.isValid());
+	ocean_assert(maxLineDistance >= Scalar(0));
+	ocean_assert(maxLineGap >= Scalar(0));
+
+	const Scalar maxSquareLineGap = maxLineGap * maxLineGap;
+
+	Indices32 similarLineIndices;
+	determineCandidates(line, maxLineGap, similarLineIndices);
+
+	std::vector<std::pair<Scalar, Index32>> matches;
+	matches.reserve(similarLineIndices.size());
+
+	for (const Index32& similarLineIndex : similarLineIndices)
+	{
+		ocean_assert(similarLineIndex < (Index32)linesInMap_.size());
+
+		Scalar matchValue;
+		if (isMergeable(line, linesInMap_[similarLineIndex], maxLineDistance, maxSquareLineGap, cosAngle, matchValue))
+		{
+			matches.emplace_back(matchValue, similarLineIndex);
 		}
 	}
+
+	// the candidates are sorted by their match values, candidates with identical match values keep their ascending order (as in merge())
+	std::stable_sort(matches.begin(), matches.end(), [](const std::pair<Scalar, Index32>& a, const std::pair<Scalar, Index32>& b) { return a.first < b.first; });
+
+	Indices32 candidates;
+	candidates.reserve(matches.size());
+
+	for (const std::pair<Scalar, Index32>& match : matches)
+	{
+		candidates.emplace_back(match.second);
+	}
+
+	return candidates;
+}
+
+void HemiCube::findMergeCandidates(const FiniteLines2& lines, const Scalar maxLineDistance, const Scalar maxLineGap, IndexGroups32& candidateGroups, const Scalar cosAngle, Worker* worker) const
+{
+	ocean_assert(isValid());
+	ocean_assert(maxLineDistance >= Scalar(0));
+	ocean_assert(maxLineGap >= Scalar(0));
+
+	candidateGroups.clear();
+	candidateGroups.resize(lines.size());
+
+	if (lines.empty())
+	{
+		return;
+	}
+
+	if (worker && lines.size() >= 200)
+	{
+		worker->executeFunction(Worker::Function::create(*this, &HemiCube::findMergeCandidatesSubset, lines.data(), maxLineDistance, maxLineGap, cosAngle, candidateGroups.data(), 0u, 0u), 0u, (unsigned int)(lines.size()), 5u, 6u, 50u);
+	}
+	else
+	{
+		findMergeCandidatesSubset(lines.data(), maxLineDistance, maxLineGap, cosAngle, candidateGroups.data(), 0u, (unsigned int)(lines.size()));
+	}
 }
 
 FiniteLine2 HemiCube::fuse(const FiniteLine2& line0, const FiniteLine2& line1)
@@ -281,9 +334,9 @@ IndexSet32 HemiCube::find(const FiniteLine2& line, const Scalar radius) const
 
 	const unsigned int radiusCeil = (unsigned int)Numeric::ceil(radius);
 	const unsigned int yStart = (mapIndex.y() >= radiusCeil ? mapIndex.y() - radiusCeil : 0u);
-	const unsigned int yEnd = std::min(mapIndex.y() + radiusCeil, numberBins_);
+	const unsigned int yEnd = std::min(mapIndex.y() + radiusCeil + 1u, numberBins_);
 	const unsigned int xStart = (mapIndex.x() >= radiusCeil ? mapIndex.x() - radiusCeil : 0u);
-	const unsigned int xEnd = std::min(mapIndex.x() + radiusCeil, numberBins_);
+	const unsigned int xEnd = std::min(mapIndex.x() + radiusCeil + 1u, numberBins_);
 
 	for (unsigned int y = yStart; y < yEnd; ++y)
 	{
@@ -309,6 +362,234 @@ IndexSet32 HemiCube::find(const FiniteLine2& line, const Scalar radius) const
 	return similarLineIndices;
 }
 
+void HemiCube::determineCandidates(const FiniteLine2& line, const Scalar maxLineGap, Indices32& candidates) const
+{
+	ocean_assert(isValid());
+	ocean_assert(line.isValid());
+	ocean_assert(maxLineGap >= Scalar(0));
+
+	candidates.clear();
+
+	const MapIndex mapIndex = mapIndexFrom(line);
+
+	// First, we determine the lines in the neighborhood of the line's bin in the cube map (lines with similar direction and similar distance to the principal point)
+
+	const unsigned int radiusCeil = (unsigned int)(Numeric::ceil(mergeSearchRadius_));
+	const unsigned int binYStart = (mapIndex.y() >= radiusCeil ? mapIndex.y() - radiusCeil : 0u);
+	const unsigned int binYEnd = std::min(mapIndex.y() + radiusCeil + 1u, numberBins_);
+	const unsigned int binXStart = (mapIndex.x() >= radiusCeil ? mapIndex.x() - radiusCeil : 0u);
+	const unsigned int binXEnd = std::min(mapIndex.x() + radiusCeil + 1u, numberBins_);
+
+	const IndexSet32* bins[25];
+	unsigned int numberBins = 0u;
+	size_t binLines = 0;
+
+	for (unsigned int y = binYStart; y < binYEnd; ++y)
+	{
+		for (unsigned int x = binXStart; x < binXEnd; ++x)
+		{
+			const MapIndex currentMapIndex(x, y, mapIndex.z());
+
+			if (!areNeighbors(mapIndex, currentMapIndex, mergeSearchRadius_))
+			{
+				continue;
+			}
+
+			const Map::const_iterator binIter = map_.find(currentMapIndex);
+
+			if (binIter != map_.cend() && !binIter->second.empty())
+			{
+				ocean_assert(numberBins < 25u);
+				bins[numberBins++] = &binIter->second;
+				binLines += binIter->second.size();
+			}
+		}
+	}
+
+	if (binLines == 0)
+	{
+		return;
+	}
+
+	// Second, we determine the cells of the spatial grid which may contain end points with distance <= maxLineGap to the line.
+	// For each row of cells, the line is clipped to the (extended) vertical range of the row, the horizontal range of the clipped line (extended by maxLineGap) covers the relevant cells.
+
+	Vector2 point0 = line.point0();
+	Vector2 point1 = line.point1();
+
+	if (point0.y() > point1.y())
+	{
+		std::swap(point0, point1);
+	}
+
+	const Scalar lineHeight = point1.y() - point0.y();
+
+	const unsigned int cellYStart = gridCoordinate(point0.y() - maxLineGap, gridCellsY_);
+	const unsigned int cellYEnd = gridCoordinate(point1.y() + maxLineGap, gridCellsY_) + 1u;
+
+	// the grid has at most 32 rows, see constructor
+	unsigned int cellXRanges[2u * 32u];
+	ocean_assert(cellYEnd - cellYStart <= 32u);
+
+	size_t cellLines = 0;
+
+	for (unsigned int yCell = cellYStart; yCell < cellYEnd; ++yCell)
+	{
+		// the border rows contain all points outside the image
+		const Scalar rowTop = yCell == 0u ? Numeric::minValue() : Scalar(yCell) * gridCellSize_ - maxLineGap;
+		const Scalar rowBottom = yCell + 1u == gridCellsY_ ? Numeric::maxValue() : Scalar(yCell + 1u) * gridCellSize_ + maxLineGap;
+
+		Scalar left = std::min(point0.x(), point1.x());
+		Scalar right = std::max(point0.x(), point1.x());
+
+		if (lineHeight > Numeric::eps())
+		{
+			const Scalar factorTop = std::max(Scalar(0), (rowTop - point0.y()) / lineHeight);
+			const Scalar factorBottom = std::min(Scalar(1), (rowBottom - point0.y()) / lineHeight);
+
+			const Scalar xTop = point0.x() + (point1.x() - point0.x()) * factorTop;
+			const Scalar xBottom = point0.x() + (point1.x() - point0.x()) * factorBottom;
+
+			left = std::min(xTop, xBottom);
+			right = std::max(xTop, xBottom);
+		}
+
+		const unsigned int cellXStart = gridCoordinate(left - maxLineGap, gridCellsX_);
+		const unsigned int cellXEnd = gridCoordinate(right + maxLineGap, gridCellsX_) + 1u;
+
+		cellXRanges[2u * (yCell - cellYStart) + 0u] = cellXStart;
+		cellXRanges[2u * (yCell - cellYStart) + 1u] = cellXEnd;
+
+		for (unsigned int xCell = cellXStart; xCell < cellXEnd; ++xCell)
+		{
+			cellLines += gridCells_[yCell * gridCellsX_ + xCell].size();
+		}
+	}
+
+	// Finally, we use the index providing fewer lines, and filter the lines with the other index
+
+	if (binLines <= cellLines)
+	{
+		candidates.reserve(binLines);
+
+		for (unsigned int n = 0u; n < numberBins; ++n)
+		{
+			candidates.insert(candidates.cend(), bins[n]->cbegin(), bins[n]->cend());
+		}
+
+		// each line is located in exactly one bin
+		std::sort(candidates.begin(), candidates.end());
+	}
+	else
+	{
+		candidates.reserve(cellLines);
+
+		for (unsigned int yCell = cellYStart; yCell < cellYEnd; ++yCell)
+		{
+			const unsigned int cellXStart = cellXRanges[2u * (yCell - cellYStart) + 0u];
+			const unsigned int cellXEnd = cellXRanges[2u * (yCell - cellYStart) + 1u];
+
+			for (unsigned int xCell = cellXStart; xCell < cellXEnd; ++xCell)
+			{
+				for (const Index32& lineIndex : gridCells_[yCell * gridCellsX_ + xCell])
+				{
+					ocean_assert(lineIndex < mapIndicesOfLines_.size());
+
+					if (areNeighbors(mapIndex, mapIndicesOfLines_[lineIndex], mergeSearchRadius_))
+					{
+						candidates.emplace_back(lineIndex);
+					}
+				}
+			}
+		}
+
+		// both end points of a line can be located in the relevant cells
+		std::sort(candidates.begin(), candidates.end());
+		candidates.erase(std::unique(candidates.begin(), candidates.end()), candidates.end());
+	}
+}
+
+bool HemiCube::isMergeable(const FiniteLine2& line, const FiniteLine2& similarLine, const Scalar maxLineDistance, const Scalar maxSquareLineGap, const Scalar cosAngle, Scalar& matchValue)
+{
+	ocean_assert(line.isValid() && similarLine.isValid());
+
+	if (!line.isCollinear(similarLine, maxLineDistance, cosAngle))
+	{
+		return false;
+	}
+
+	const Scalar squareLineGap0 = line.nearestPoint(similarLine.point0()).sqrDistance(similarLine.point0());
+	const Scalar squareLineGap1 = line.nearestPoint(similarLine.point1()).sqrDistance(similarLine.point1());
+
+	if (std::min(squareLineGap0, squareLineGap1) >= maxSquareLineGap)
+	{
+		return false;
+	}
+
+	// A good match is supposed to have a small distance of the endpoints from the line segments (maxDistance*, the smaller, the better) and
+	// the segments should be as parallel as possible, i.e. scalar product of the line normals should be as close to 1 as possible (worst case: orthogonal lines, scalar product 0)
+	// The match value if ratio of the max. distance and the inverse of the scalar product, best possible match value: 0, worst match: infinity
+	const Scalar maxDistanceLineToSimilarLine = std::max(line.normal() * (similarLine.point0() - line.point0()), line.normal() * (similarLine.point1() - line.point0()));
+	const Scalar maxDistanceSimilarLineToLine = std::max(similarLine.normal() * (line.point0() - similarLine.point0()), similarLine.normal() * (line.point1() - similarLine.point0()));
+	const Scalar normalAlignment = std::max(Numeric::abs(line.normal() * similarLine.normal()), Numeric::weakEps());
+	ocean_assert(Numeric::isInsideRange(Numeric::weakEps(), normalAlignment, Scalar(1)));
+
+	matchValue = std::max(maxDistanceLineToSimilarLine, maxDistanceSimilarLineToLine) / normalAlignment;
+
+	return true;
+}
+
+void HemiCube::findMergeCandidatesSubset(const FiniteLine2* lines, const Scalar maxLineDistance, const Scalar maxLineGap, const Scalar cosAngle, Indices32* candidateGroups, const unsigned int firstLine, const unsigned int numberLines) const
+{
+	ocean_assert(lines != nullptr && candidateGroups != nullptr);
+
+	for (unsigned int lineIndex = firstLine; lineIndex < firstLine + numberLines; ++lineIndex)
+	{
+		candidateGroups[lineIndex] = findMergeCandidates(lines[lineIndex], maxLineDistance, maxLineGap, cosAngle);
+	}
+}
+
+void HemiCube::addToGrid(const FiniteLine2& line, const Index32 index)
+{
+	ocean_assert(line.isValid());
+	ocean_assert(!gridCells_.empty());
+
+	const unsigned int cell0 = gridCell(line.point0());
+	const unsigned int cell1 = gridCell(line.point1());
+
+	gridCells_[cell0].emplace_back(index);
+
+	if (cell1 != cell0)
+	{
+		gridCells_[cell1].emplace_back(index);
+	}
+}
+
+void HemiCube::removeFromGrid(const FiniteLine2& line, const Index32 index)
+{
+	ocean_assert(line.isValid());
+	ocean_assert(!gridCells_.empty());
+
+	const unsigned int cell0 = gridCell(line.point0());
+	const unsigned int cell1 = gridCell(line.point1());
+
+	for (const unsigned int cell : {cell0, cell1})
+	{
+		Indices32& cellLines = gridCells_[cell];
+
+		// a line with both end points in the same cell is stored once only
+		const Indices32::iterator iLine = std::find(cellLines.begin(), cellLines.end(), index);
+		ocean_assert(iLine != cellLines.end() || cell0 == cell1);
+
+		if (iLine != cellLines.end())
+		{
+			// the order of the lines within a cell does not matter
+			*iLine = cellLines.back();
+			cellLines.pop_back();
+		}
+	}
+}
+
 HemiCube::MapIndex HemiCube::mapIndexFrom(const FiniteLine2& line) const
 {
 	ocean_assert(isValid());
@@ -343,7 +624,9 @@ void HemiCube::updateLine(unsigned int index, const FiniteLine2& updatedLine)
 
 	// Remove the selected line from the map
 	ocean_assert(index < linesInMap_.size());
-	const MapIndex mapIndex = mapIndexFrom(linesInMap_[index]);
+	ocean_assert(mapIndicesOfLines_.size() == linesInMap_.size());
+	const MapIndex& mapIndex = mapIndicesOfLines_[index];
+	ocean_assert(mapIndex == mapIndexFrom(linesInMap_[index]));
 
 	Map::iterator bin = map_.find(mapIndex);
 	ocean_assert(bin != map_.end());
@@ -357,7 +640,11 @@ void HemiCube::updateLine(unsigned int index, const FiniteLine2& updatedLine)
 	const MapIndex updatedMapIndex = mapIndexFrom(updatedLine);
 	map_[updatedMapIndex].insert(index);
 
+	removeFromGrid(linesInMap_[index], index);
+	addToGrid(updatedLine, index);
+
 	linesInMap_[index] = updatedLine;
+	mapIndicesOfLines_[index] = updatedMapIndex;
 }
 
 }
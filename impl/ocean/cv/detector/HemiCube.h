@@ -11,6 +11,7 @@
 #include "ocean/cv/detector/Detector.h"
 
 #include "ocean/base/Frame.h"
+#include "ocean/base/Worker.h"
 
 #include "ocean/cv/PixelPosition.h"
 
@@ -29,6 +30,8 @@ namespace Detector
 /**
  * Data structure used for efficient grouping to 2D line segments
  * This data structure is inspired by and derived from the HemiCube of Rick Szeliski and Daniel Scharstein.
+ * Besides the cube map (binning the lines by their direction and distance to the principal point), the end points of all lines are indexed in a coarse spatial grid in image space.<br>
+ * Merge candidates are determined from whichever of both indices provides fewer lines, so that merging stays fast for thousands of line segments with many parallel lines.
  * @ingroup cvdetector
  */
 class OCEAN_CV_DETECTOR_EXPORT HemiCube
@@ -54,6 +57,9 @@ class OCEAN_CV_DETECTOR_EXPORT HemiCube
 		/// The actual cube map: maps a line to a bin (set of line indices)
 		using Map = std::unordered_map<MapIndex, IndexSet32, MapIndexHash>;
 
+		/// Definition of a vector holding map indices.
+		using MapIndices = std::vector<MapIndex>;
+
 	public:
 
 		/**
@@ -116,6 +122,41 @@ class OCEAN_CV_DETECTOR_EXPORT HemiCube
 		 */
 		void merge(const FiniteLines2& lines, const Scalar maxLineDistance, const Scalar maxLineGap, Indices32* mapping = nullptr, const Scalar cosAngle = Numeric::cos(Numeric::weakEps()));
 
+		/**
+		 * Merges one line with the similar lines in the Hemi cube, or adds the line as-is if no similar line exists.
+		 * This function allows to fill the Hemi cube incrementally e.g., with the lines of individual image regions or individual frames.
+		 * @param line The line to be merged, must be valid
+		 * @param maxLineDistance Maximum allowed distance of the end-points of one line segment to infinite line of another line segment in order to be considered as collinear, range: [0, infinity)
+		 * @param maxLineGap Maximum allowed distance between a pair of collinear line segments in order to be considered mergeable, range: [0, infinity)
+		 * @param cosAngle Cosine of the maximum angle that is allowed in order for the two line segments to be considered parallel; default: cos(weakEps()), i.e., approx. one, range: [0, 1]
+		 * @return The index of the line in the Hemi cube into which the given line has been merged, or the index of the added line
+		 */
+		Index32 merge(const FiniteLine2& line, const Scalar maxLineDistance, const Scalar maxLineGap, const Scalar cosAngle = Numeric::cos(Numeric::weakEps()));
+
+		/**
+		 * Determines the lines in the Hemi cube with which a given line can be merged.
+		 * The Hemi cube is not modified.
+		 * @param line The line for which the merge candidates are determined, must be valid
+		 * @param maxLineDistance Maximum allowed distance of the end-points of one line segment to infinite line of another line segment in order to be considered as collinear, range: [0, infinity)
+		 * @param maxLineGap Maximum allowed distance between a pair of collinear line segments in order to be considered mergeable, range: [0, infinity)
+		 * @param cosAngle Cosine of the maximum angle that is allowed in order for the two line segments to be considered parallel; default: cos(weakEps()), i.e., approx. one, range: [0, 1]
+		 * @return The indices of the lines in the Hemi cube which can be merged with the given line, the best candidate first
+		 * @see merge().
+		 */
+		Indices32 findMergeCandidates(const FiniteLine2& line, const Scalar maxLineDistance, const Scalar maxLineGap, const Scalar cosAngle = Numeric::cos(Numeric::weakEps())) const;
+
+		/**
+		 * Determines the lines in the Hemi cube with which several given lines can be merged.
+		 * The Hemi cube is not modified, so that the candidates of all lines are determined independently of each other.
+		 * @param lines The lines for which the merge candidates are determined, must be valid
+		 * @param maxLineDistance Maximum allowed distance of the end-points of one line segment to infinite line of another line segment in order to be considered as collinear, range: [0, infinity)
+		 * @param maxLineGap Maximum allowed distance between a pair of collinear line segments in order to be considered mergeable, range: [0, infinity)
+		 * @param candidateGroups The resulting indices of the merge candidates, one group for each given line, the best candidate first
+		 * @param cosAngle Cosine of the maximum angle that is allowed in order for the two line segments to be considered parallel; default: cos(weakEps()), i.e., approx. one, range: [0, 1]
+		 * @param worker Optional worker object to distribute the computation
+		 */
+		void findMergeCandidates(const FiniteLines2& lines, const Scalar maxLineDistance, const Scalar maxLineGap, IndexGroups32& candidateGroups, const Scalar cosAngle = Numeric::cos(Numeric::weakEps()), Worker* worker = nullptr) const;
+
 		/**
 		 * Compute line segment that minimizes the distances to the endpoints of the input line segments
 		 * Computes the infinite line that minimizes the weighted distances to the endpoints of the input line segments, `line0` and `line1`.
@@ -150,6 +191,7 @@ class OCEAN_CV_DETECTOR_EXPORT HemiCube
 
 		/**
 		 * Clear this Hemi cube
+		 * The memory of the spatial index is kept, so that the Hemi cube can be re-filled efficiently e.g., for each new frame.
 		 */
 		inline void clear();
 
@@ -217,6 +259,80 @@ class OCEAN_CV_DETECTOR_EXPORT HemiCube
 		 */
 		inline Vector3 rayFrom(const Vector2& point) const;
 
+		/**
+		 * Determines the preliminary merge candidates of a line, the lines in the neighborhood of the line's bin in the cube map which have an end point close to the line.
+		 * The candidates are determined from whichever index (cube map or spatial grid) provides fewer lines.
+		 * @param line The line for which the candidates are determined, must be valid
+		 * @param maxLineGap Maximum allowed distance between the line and an end point of a candidate, range: [0, infinity)
+		 * @param candidates The resulting indices of the candidates, in ascending order
+		 */
+		void determineCandidates(const FiniteLine2& line, const Scalar maxLineGap, Indices32& candidates) const;
+
+		/**
+		 * Returns whether a line in the Hemi cube can be merged with a given line.
+		 * @param line The line to be merged, must be valid
+		 * @param similarLine The line in the Hemi cube, must be valid
+		 * @param maxLineDistance Maximum allowed distance of the end-points of one line segment to infinite line of another line segment in order to be considered as collinear, range: [0, infinity)
+		 * @param maxSquareLineGap Maximum allowed square distance between a pair of collinear line segments, range: [0, infinity)
+		 * @param cosAngle Cosine of the maximum angle that is allowed in order for the two line segments to be considered parallel, range: [0, 1]
+		 * @param matchValue The resulting match value if both lines can be merged, 0 is the best possible match, with range [0, infinity)
+		 * @return True, if both lines can be merged
+		 */
+		static bool isMergeable(const FiniteLine2& line, const FiniteLine2& similarLine, const Scalar maxLineDistance, const Scalar maxSquareLineGap, const Scalar cosAngle, Scalar& matchValue);
+
+		/**
+		 * Determines the merge candidates for a subset of lines.
+		 * @param lines The lines for which the merge candidates are determined, must be valid
+		 * @param maxLineDistance Maximum allowed distance of the end-points of one line segment to infinite line of another line segment in order to be considered as collinear, range: [0, infinity)
+		 * @param maxLineGap Maximum allowed distance between a pair of collinear line segments in order to be considered mergeable, range: [0, infinity)
+		 * @param cosAngle Cosine of the maximum angle that is allowed in order for the two line segments to be considered parallel, range: [0, 1]
+		 * @param candidateGroups The resulting indices of the merge candidates, one group for each line, must be valid
+		 * @param firstLine The first line to be handled
+		 * @param numberLines The number of lines to be handled
+		 */
+		void findMergeCandidatesSubset(const FiniteLine2* lines, const Scalar maxLineDistance, const Scalar maxLineGap, const Scalar cosAngle, Indices32* candidateGroups, const unsigned int firstLine, const unsigned int numberLines) const;
+
+		/**
+		 * Returns whether two map indices are neighbors in the cube map.
+		 * @param mapIndex The map index of the query line
+		 * @param candidateMapIndex The map index of the candidate line
+		 * @param radius Search radius in the Hemi cube, range: [0, infinity)
+		 * @return True, if both map indices are located on the same face and within the search radius
+		 * @see find().
+		 */
+		inline bool areNeighbors(const MapIndex& mapIndex, const MapIndex& candidateMapIndex, const Scalar radius) const;
+
+		/**
+		 * Returns the index of the cell in the spatial grid in which a point is located.
+		 * Points outside the image are assigned to the nearest border cell.
+		 * @param point The point for which the cell is determined
+		 * @return The index of the cell, with range [0, gridCellsX_ * gridCellsY_)
+		 */
+		inline unsigned int gridCell(const Vector2& point) const;
+
+		/**
+		 * Returns the horizontal or vertical cell coordinate of a location in the spatial grid.
+		 * Locations outside the image are clamped to the border cells.
+		 * @param value The horizontal or vertical location, in pixel
+		 * @param cells The number of cells in the corresponding direction, with range [1, infinity)
+		 * @return The cell coordinate, with range [0, cells - 1]
+		 */
+		inline unsigned int gridCoordinate(const Scalar value, const unsigned int cells) const;
+
+		/**
+		 * Adds the end points of a line to the spatial grid.
+		 * @param line The line to be added, must be valid
+		 * @param index The index of the line in the Hemi cube
+		 */
+		void addToGrid(const FiniteLine2& line, const Index32 index);
+
+		/**
+		 * Removes the end points of a line from the spatial grid.
+		 * @param line The line to be removed, must be valid
+		 * @param index The index of the line in the Hemi cube
+		 */
+		void removeFromGrid(const FiniteLine2& line, const Index32 index);
+
 		/**
 		 * Update a line segment stored in the Hemi cube
 		 * Updates the line segment at index `index` and its map index in the Hemi cube.
@@ -247,6 +363,24 @@ class OCEAN_CV_DETECTOR_EXPORT HemiCube
 
 		/// Number of bins along one dimension (cube)
 		unsigned int numberBins_ = 0u;
+
+		/// The map indices of all lines, one for each line in `linesInMap_`.
+		MapIndices mapIndicesOfLines_;
+
+		/// The cells of the spatial grid, each cell holds the indices of the lines with at least one end point inside the cell.
+		IndexGroups32 gridCells_;
+
+		/// The size of one cell of the spatial grid, in pixel.
+		Scalar gridCellSize_ = Scalar(0);
+
+		/// The number of horizontal cells of the spatial grid.
+		unsigned int gridCellsX_ = 0u;
+
+		/// The number of vertical cells of the spatial grid.
+		unsigned int gridCellsY_ = 0u;
+
+		/// The search radius in the cube map to determine merge candidates, covers the 8-neighborhood since > sqrt(2).
+		static constexpr Scalar mergeSearchRadius_ = Scalar(1.5);
 };
 
 inline bool HemiCube::isValid() const
@@ -259,14 +393,19 @@ inline void HemiCube::insert(const FiniteLine2& newLine)
 	ocean_assert(isValid());
 	ocean_assert(newLine.isValid());
 
+	const MapIndex mapIndex = mapIndexFrom(newLine);
+
 	// Find or create the bin into which the new line will be placed
-	IndexSet32& bin = map_[mapIndexFrom(newLine)];
+	IndexSet32& bin = map_[mapIndex];
 
 	const unsigned int newLineIndex = (unsigned int)linesInMap_.size();
 	ocean_assert(bin.find(newLineIndex) == bin.end());
 
 	bin.insert(newLineIndex);
 	linesInMap_.emplace_back(newLine);
+	mapIndicesOfLines_.emplace_back(mapIndex);
+
+	addToGrid(newLine, newLineIndex);
 }
 
 inline void HemiCube::insert(const FiniteLines2& lines)
@@ -291,6 +430,12 @@ inline void HemiCube::clear()
 {
 	linesInMap_.clear();
 	map_.clear();
+	mapIndicesOfLines_.clear();
+
+	for (Indices32& cellLines : gridCells_)
+	{
+		cellLines.clear();
+	}
 }
 
 inline const FiniteLines2& HemiCube::lines() const
@@ -322,6 +467,45 @@ inline CV::PixelPosition HemiCube::hemiCubeCoordinatesFrom(const MapIndex& mapIn
 	return CV::PixelPosition(mapIndex[2] * numberBins_ + mapIndex[0], mapIndex[1]);
 }
 
+inline bool HemiCube::areNeighbors(const MapIndex& mapIndex, const MapIndex& candidateMapIndex, const Scalar radius) const
+{
+	if (mapIndex.z() != candidateMapIndex.z())
+	{
+		return false;
+	}
+
+	const Scalar dx = Scalar(int(candidateMapIndex.x()) - int(mapIndex.x()));
+	const Scalar dy = Scalar(int(candidateMapIndex.y()) - int(mapIndex.y()));
+
+	return dx * dx + dy * dy <= radius * radius;
+}
+
+inline unsigned int HemiCube::gridCell(const Vector2& point) const
+{
+	ocean_assert(gridCellsX_ != 0u && gridCellsY_ != 0u);
+
+	return gridCoordinate(point.y(), gridCellsY_) * gridCellsX_ + gridCoordinate(point.x(), gridCellsX_);
+}
+
+inline unsigned int HemiCube::gridCoordinate(const Scalar value, const unsigned int cells) const
+{
+	ocean_assert(gridCellSize_ > Scalar(0) && cells != 0u);
+
+	const Scalar coordinate = value / gridCellSize_;
+
+	if (coordinate <= Scalar(0))
+	{
+		return 0u;
+	}
+
+	if (coordinate >= Scalar(cells - 1u))
+	{
+		return cells - 1u;
+	}
+
+	return (unsigned int)(coordinate);
+}
+
 template <bool tScale>
 Vector3 HemiCube::lineEquationFrom(const FiniteLine2& line) const
 {
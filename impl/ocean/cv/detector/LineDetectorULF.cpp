@@ -355,6 +355,79 @@ void LineDetectorULF::EdgeDetector::determineRowSums(const uint8_t* row, const u
 
 #else
 
+#if defined(OCEAN_HARDWARE_SSE_VERSION) && OCEAN_HARDWARE_SSE_VERSION >= 41
+
+	if (sumElements >= 16u)
+	{
+		const __m128i zero_u_8x16 = _mm_setzero_si128();
+
+		for (unsigned int x = 0u; x < sumElements; x += 16u)
+		{
+			if (x + 16u > sumElements)
+			{
+				// the last iteration will not fit into the data,
+				// so we simply shift x left by some pixels (at most 15) and we will calculate some pixels again
+
+				ocean_assert(x >= 16u && sumElements > 16u);
+				const unsigned int newX = sumElements - 16u;
+
+				ocean_assert(x > newX);
+				const unsigned int offset = x - newX;
+
+				row -= offset;
+				windowSums -= offset;
+				windowSqrSums -= offset;
+
+				// the for loop will stop after this iteration
+				ocean_assert(!(x + 16u < sumElements));
+			}
+
+			__m128i sumsA_u_16x8 = zero_u_8x16;
+			__m128i sumsB_u_16x8 = zero_u_8x16;
+
+			__m128i sqrSumsA_u_32x4 = zero_u_8x16;
+			__m128i sqrSumsB_u_32x4 = zero_u_8x16;
+			__m128i sqrSumsC_u_32x4 = zero_u_8x16;
+			__m128i sqrSumsD_u_32x4 = zero_u_8x16;
+
+			for (unsigned int n = 0u; n < window; ++n)
+			{
+				const __m128i values_u_8x16 = _mm_loadu_si128((const __m128i*)(row + n));
+
+				const __m128i valuesA_u_16x8 = _mm_unpacklo_epi8(values_u_8x16, zero_u_8x16);
+				const __m128i valuesB_u_16x8 = _mm_unpackhi_epi8(values_u_8x16, zero_u_8x16);
+
+				sumsA_u_16x8 = _mm_add_epi16(sumsA_u_16x8, valuesA_u_16x8);
+				sumsB_u_16x8 = _mm_add_epi16(sumsB_u_16x8, valuesB_u_16x8);
+
+				// value^2 <= 255^2 fits into 16 bit
+				const __m128i sqrValuesA_u_16x8 = _mm_mullo_epi16(valuesA_u_16x8, valuesA_u_16x8);
+				const __m128i sqrValuesB_u_16x8 = _mm_mullo_epi16(valuesB_u_16x8, valuesB_u_16x8);
+
+				sqrSumsA_u_32x4 = _mm_add_epi32(sqrSumsA_u_32x4, _mm_unpacklo_epi16(sqrValuesA_u_16x8, zero_u_8x16));
+				sqrSumsB_u_32x4 = _mm_add_epi32(sqrSumsB_u_32x4, _mm_unpackhi_epi16(sqrValuesA_u_16x8, zero_u_8x16));
+				sqrSumsC_u_32x4 = _mm_add_epi32(sqrSumsC_u_32x4, _mm_unpacklo_epi16(sqrValuesB_u_16x8, zero_u_8x16));
+				sqrSumsD_u_32x4 = _mm_add_epi32(sqrSumsD_u_32x4, _mm_unpackhi_epi16(sqrValuesB_u_16x8, zero_u_8x16));
+			}
+
+			_mm_storeu_si128((__m128i*)(windowSums + 0), sumsA_u_16x8);
+			_mm_storeu_si128((__m128i*)(windowSums + 8), sumsB_u_16x8);
+
+			_mm_storeu_si128((__m128i*)(windowSqrSums + 0), sqrSumsA_u_32x4);
+			_mm_storeu_si128((__m128i*)(windowSqrSums + 4), sqrSumsB_u_32x4);
+			_mm_storeu_si128((__m128i*)(windowSqrSums + 8), sqrSumsC_u_32x4);
+			_mm_storeu_si128((__m128i*)(windowSqrSums + 12), sqrSumsD_u_32x4);
+
+			row += 16;
+			windowSums += 16;
+			windowSqrSums += 16;
+		}
+
+		return;
+	}
+
+#endif // OCEAN_HARDWARE_SSE_VERSION >= 41
+
 	uint16_t sum = 0u;
 	uint32_t sqrSum = 0u;
 
@@ -1374,6 +1447,106 @@ void LineDetectorULF::RMSBarEdgeDetectorI::invokeRowVertical(const uint8_t* cons
 
 	const int16_t* const responsesEnd = sqrResponses + elements;
 
+#if defined(OCEAN_HARDWARE_SSE_VERSION) && OCEAN_HARDWARE_SSE_VERSION >= 41
+
+	// we handle 16 pixels in each iteration, the remaining pixels are handled by the scalar implementation below
+	// the SSE-based implementation provides the identical responses as the scalar implementation
+
+	const __m128i zero_u_8x16 = _mm_setzero_si128();
+	const __m128i one_s_16x8 = _mm_set1_epi16(1);
+
+	const __m128i window_u_16x8 = _mm_set1_epi16(short(window));
+	const __m128i area_u_16x8 = _mm_set1_epi16(short(area));
+	const __m128i minimalDeltaArea2_s_16x8 = _mm_set1_epi16(short(minimalDeltaArea2));
+
+	const __m128i area_u_32x4 = _mm_set1_epi32(int(area));
+	const __m128i sqrArea_u_32x4 = _mm_set1_epi32(int(area * area));
+
+	for (unsigned int n = 0u; n < elements / 16u; ++n)
+	{
+		const __m128i valuesMinus_u_8x16 = _mm_loadu_si128((const __m128i*)(value + 0));
+		const __m128i valuesCenter_u_8x16 = _mm_loadu_si128((const __m128i*)(value + 1));
+		const __m128i valuesPlus_u_8x16 = _mm_loadu_si128((const __m128i*)(value + 2));
+
+		for (unsigned int nBlock = 0u; nBlock < 16u; nBlock += 8u)
+		{
+			const __m128i valueMinus_u_16x8 = nBlock == 0u ? _mm_cvtepu8_epi16(valuesMinus_u_8x16) : _mm_unpackhi_epi8(valuesMinus_u_8x16, zero_u_8x16);
+			const __m128i valueCenter_u_16x8 = nBlock == 0u ? _mm_cvtepu8_epi16(valuesCenter_u_8x16) : _mm_unpackhi_epi8(valuesCenter_u_8x16, zero_u_8x16);
+			const __m128i valuePlus_u_16x8 = nBlock == 0u ? _mm_cvtepu8_epi16(valuesPlus_u_8x16) : _mm_unpackhi_epi8(valuesPlus_u_8x16, zero_u_8x16);
+
+			const __m128i windowSumsL_u_16x8 = _mm_loadu_si128((const __m128i*)(windowSumsL + nBlock));
+			const __m128i windowSumsR_u_16x8 = _mm_loadu_si128((const __m128i*)(windowSumsR + nBlock));
+
+			// the center value must be a peak value (positive or negative): (value_window < sumL && value_window < sumR) || (value_window > sumL && value_window > sumR)
+			const __m128i valueWindow_u_16x8 = _mm_mullo_epi16(valueCenter_u_16x8, window_u_16x8);
+
+			const __m128i isPeak_u_16x8 = _mm_or_si128(_mm_and_si128(_mm_cmplt_epi16(valueWindow_u_16x8, windowSumsL_u_16x8), _mm_cmplt_epi16(valueWindow_u_16x8, windowSumsR_u_16x8)), _mm_and_si128(_mm_cmpgt_epi16(valueWindow_u_16x8, windowSumsL_u_16x8), _mm_cmpgt_epi16(valueWindow_u_16x8, windowSumsR_u_16x8)));
+
+			const __m128i sum_u_16x8 = _mm_add_epi16(windowSumsL_u_16x8, windowSumsR_u_16x8);
+
+			// zero mean values (multiplied by area)
+			__m128i valueMinus_s_16x8 = _mm_sub_epi16(_mm_mullo_epi16(valueMinus_u_16x8, area_u_16x8), sum_u_16x8);
+			__m128i valueCenter_s_16x8 = _mm_sub_epi16(_mm_mullo_epi16(valueCenter_u_16x8, area_u_16x8), sum_u_16x8);
+			__m128i valuePlus_s_16x8 = _mm_sub_epi16(_mm_mullo_epi16(valuePlus_u_16x8, area_u_16x8), sum_u_16x8);
+
+			// sign = valueCenter < 0 ? -1 : 1, dark edges are mirrored so that dark and bright edges can be handled identically
+			const __m128i sign_s_16x8 = _mm_or_si128(_mm_cmplt_epi16(valueCenter_s_16x8, zero_u_8x16), one_s_16x8);
+
+			valueMinus_s_16x8 = _mm_sign_epi16(valueMinus_s_16x8, sign_s_16x8);
+			valueCenter_s_16x8 = _mm_sign_epi16(valueCenter_s_16x8, sign_s_16x8);
+			valuePlus_s_16x8 = _mm_sign_epi16(valuePlus_s_16x8, sign_s_16x8);
+
+			// peakValue = valueCenter + max(valueMinus, valuePlus)
+			const __m128i peakValue_s_16x8 = _mm_add_epi16(valueCenter_s_16x8, _mm_max_epi16(valueMinus_s_16x8, valuePlus_s_16x8));
+
+			// isPeak && valueMinus <= valueCenter && valuePlus < valueCenter && abs(peakValue) >= minimalDeltaArea2
+			const __m128i validResponse_u_16x8 = _mm_andnot_si128(_mm_or_si128(_mm_cmpgt_epi16(valueMinus_s_16x8, valueCenter_s_16x8), _mm_cmpgt_epi16(minimalDeltaArea2_s_16x8, _mm_abs_epi16(peakValue_s_16x8))), _mm_and_si128(isPeak_u_16x8, _mm_cmplt_epi16(valuePlus_s_16x8, valueCenter_s_16x8)));
+
+			// normalizedSqrResidual = max(area * area, area * sqrSum - sum * sum)
+
+			const __m128i sumA_u_32x4 = _mm_cvtepu16_epi32(sum_u_16x8);
+			const __m128i sumB_u_32x4 = _mm_unpackhi_epi16(sum_u_16x8, zero_u_8x16);
+
+			const __m128i sqrSumA_u_32x4 = _mm_add_epi32(_mm_loadu_si128((const __m128i*)(windowSqrSumsL + nBlock + 0u)), _mm_loadu_si128((const __m128i*)(windowSqrSumsR + nBlock + 0u)));
+			const __m128i sqrSumB_u_32x4 = _mm_add_epi32(_mm_loadu_si128((const __m128i*)(windowSqrSumsL + nBlock + 4u)), _mm_loadu_si128((const __m128i*)(windowSqrSumsR + nBlock + 4u)));
+
+			const __m128i normalizedSqrResidualA_u_32x4 = _mm_max_epu32(sqrArea_u_32x4, _mm_sub_epi32(_mm_mullo_epi32(area_u_32x4, sqrSumA_u_32x4), _mm_mullo_epi32(sumA_u_32x4, sumA_u_32x4)));
+			const __m128i normalizedSqrResidualB_u_32x4 = _mm_max_epu32(sqrArea_u_32x4, _mm_sub_epi32(_mm_mullo_epi32(area_u_32x4, sqrSumB_u_32x4), _mm_mullo_epi32(sumB_u_32x4, sumB_u_32x4)));
+
+			// peakValue^2, as 32 bit values
+			const __m128i sqrPeakValueLow_s_16x8 = _mm_mullo_epi16(peakValue_s_16x8, peakValue_s_16x8);
+			const __m128i sqrPeakValueHigh_s_16x8 = _mm_mulhi_epi16(peakValue_s_16x8, peakValue_s_16x8);
+
+			const __m128i sqrPeakValueA_u_32x4 = _mm_unpacklo_epi16(sqrPeakValueLow_s_16x8, sqrPeakValueHigh_s_16x8);
+			const __m128i sqrPeakValueB_u_32x4 = _mm_unpackhi_epi16(sqrPeakValueLow_s_16x8, sqrPeakValueHigh_s_16x8);
+
+			// (peakValue^2 * 64 + normalizedSqrResidual / 2) / normalizedSqrResidual
+			const __m128i responseA_u_32x4 = divideUnsigned32BitSSE(_mm_add_epi32(_mm_slli_epi32(sqrPeakValueA_u_32x4, 6), _mm_srli_epi32(normalizedSqrResidualA_u_32x4, 1)), normalizedSqrResidualA_u_32x4);
+			const __m128i responseB_u_32x4 = divideUnsigned32BitSSE(_mm_add_epi32(_mm_slli_epi32(sqrPeakValueB_u_32x4, 6), _mm_srli_epi32(normalizedSqrResidualB_u_32x4, 1)), normalizedSqrResidualB_u_32x4);
+
+			// negative responses for dark edges
+			const __m128i signedResponseA_s_32x4 = _mm_sign_epi32(responseA_u_32x4, _mm_cvtepi16_epi32(sign_s_16x8));
+			const __m128i signedResponseB_s_32x4 = _mm_sign_epi32(responseB_u_32x4, _mm_cvtepi16_epi32(_mm_srli_si128(sign_s_16x8, 8)));
+
+			// saturated cast to int16_t
+			const __m128i response_s_16x8 = _mm_packs_epi32(signedResponseA_s_32x4, signedResponseB_s_32x4);
+
+			_mm_storeu_si128((__m128i*)(sqrResponses + nBlock), _mm_and_si128(response_s_16x8, validResponse_u_16x8));
+		}
+
+		value += 16;
+
+		windowSumsL += 16;
+		windowSumsR += 16;
+
+		windowSqrSumsL += 16;
+		windowSqrSumsR += 16;
+
+		sqrResponses += 16;
+	}
+
+#endif // OCEAN_HARDWARE_SSE_VERSION >= 41
+
 	while (sqrResponses != responsesEnd)
 	{
 		ocean_assert(sqrResponses < responsesEnd);
@@ -2290,6 +2463,69 @@ void LineDetectorULF::RMSStepEdgeDetectorI::invokeRowVertical(const uint8_t* con
 
 	const int16_t* const responsesEnd = sqrResponses + elements;
 
+#if defined(OCEAN_HARDWARE_SSE_VERSION) && OCEAN_HARDWARE_SSE_VERSION >= 41
+
+	// we handle 16 pixels in each iteration, the remaining pixels are handled by the scalar implementation below
+	// the SSE-based implementation provides the identical responses as the scalar implementation
+
+	const __m128i window_u_32x4 = _mm_set1_epi32(int(window));
+	const __m128i sqrWindow2_u_32x4 = _mm_set1_epi32(int(sqrWindow2));
+
+	for (unsigned int n = 0u; n < elements / 16u; ++n)
+	{
+		for (unsigned int nBlock = 0u; nBlock < 16u; nBlock += 8u)
+		{
+			const __m128i windowSumsL_u_16x8 = _mm_loadu_si128((const __m128i*)(windowSumsL + nBlock));
+			const __m128i windowSumsR_u_16x8 = _mm_loadu_si128((const __m128i*)(windowSumsR + nBlock));
+
+			// normalizedSqrResidual = max(sqrWindow2, (window * sqrSumL - sumL^2) + (window * sqrSumR - sumR^2))
+
+			const __m128i windowSumsLA_u_32x4 = _mm_cvtepu16_epi32(windowSumsL_u_16x8);
+			const __m128i windowSumsLB_u_32x4 = _mm_cvtepu16_epi32(_mm_srli_si128(windowSumsL_u_16x8, 8));
+			const __m128i windowSumsRA_u_32x4 = _mm_cvtepu16_epi32(windowSumsR_u_16x8);
+			const __m128i windowSumsRB_u_32x4 = _mm_cvtepu16_epi32(_mm_srli_si128(windowSumsR_u_16x8, 8));
+
+			const __m128i normalizedSqrResidualLA_u_32x4 = _mm_sub_epi32(_mm_mullo_epi32(window_u_32x4, _mm_loadu_si128((const __m128i*)(windowSqrSumsL + nBlock + 0u))), _mm_mullo_epi32(windowSumsLA_u_32x4, windowSumsLA_u_32x4));
+			const __m128i normalizedSqrResidualLB_u_32x4 = _mm_sub_epi32(_mm_mullo_epi32(window_u_32x4, _mm_loadu_si128((const __m128i*)(windowSqrSumsL + nBlock + 4u))), _mm_mullo_epi32(windowSumsLB_u_32x4, windowSumsLB_u_32x4));
+			const __m128i normalizedSqrResidualRA_u_32x4 = _mm_sub_epi32(_mm_mullo_epi32(window_u_32x4, _mm_loadu_si128((const __m128i*)(windowSqrSumsR + nBlock + 0u))), _mm_mullo_epi32(windowSumsRA_u_32x4, windowSumsRA_u_32x4));
+			const __m128i normalizedSqrResidualRB_u_32x4 = _mm_sub_epi32(_mm_mullo_epi32(window_u_32x4, _mm_loadu_si128((const __m128i*)(windowSqrSumsR + nBlock + 4u))), _mm_mullo_epi32(windowSumsRB_u_32x4, windowSumsRB_u_32x4));
+
+			const __m128i normalizedSqrResidualA_u_32x4 = _mm_max_epu32(sqrWindow2_u_32x4, _mm_add_epi32(normalizedSqrResidualLA_u_32x4, normalizedSqrResidualRA_u_32x4));
+			const __m128i normalizedSqrResidualB_u_32x4 = _mm_max_epu32(sqrWindow2_u_32x4, _mm_add_epi32(normalizedSqrResidualLB_u_32x4, normalizedSqrResidualRB_u_32x4));
+
+			// normalizedDelta = sumL - sumR, with range [-window * 255, window * 255]
+			const __m128i normalizedDelta_s_16x8 = _mm_sub_epi16(windowSumsL_u_16x8, windowSumsR_u_16x8);
+
+			// normalizedDelta^2, as 32 bit values
+			const __m128i sqrNormalizedDeltaLow_s_16x8 = _mm_mullo_epi16(normalizedDelta_s_16x8, normalizedDelta_s_16x8);
+			const __m128i sqrNormalizedDeltaHigh_s_16x8 = _mm_mulhi_epi16(normalizedDelta_s_16x8, normalizedDelta_s_16x8);
+
+			const __m128i sqrNormalizedDeltaA_u_32x4 = _mm_unpacklo_epi16(sqrNormalizedDeltaLow_s_16x8, sqrNormalizedDeltaHigh_s_16x8);
+			const __m128i sqrNormalizedDeltaB_u_32x4 = _mm_unpackhi_epi16(sqrNormalizedDeltaLow_s_16x8, sqrNormalizedDeltaHigh_s_16x8);
+
+			// (normalizedDelta^2 * 32 + normalizedSqrResidual / 2) / normalizedSqrResidual
+			const __m128i responseA_u_32x4 = divideUnsigned32BitSSE(_mm_add_epi32(_mm_slli_epi32(sqrNormalizedDeltaA_u_32x4, 5), _mm_srli_epi32(normalizedSqrResidualA_u_32x4, 1)), normalizedSqrResidualA_u_32x4);
+			const __m128i responseB_u_32x4 = divideUnsigned32BitSSE(_mm_add_epi32(_mm_slli_epi32(sqrNormalizedDeltaB_u_32x4, 5), _mm_srli_epi32(normalizedSqrResidualB_u_32x4, 1)), normalizedSqrResidualB_u_32x4);
+
+			// sign(normalizedDelta) * response
+			const __m128i signedResponseA_s_32x4 = _mm_sign_epi32(responseA_u_32x4, _mm_cvtepi16_epi32(normalizedDelta_s_16x8));
+			const __m128i signedResponseB_s_32x4 = _mm_sign_epi32(responseB_u_32x4, _mm_cvtepi16_epi32(_mm_srli_si128(normalizedDelta_s_16x8, 8)));
+
+			// saturated cast to int16_t
+			_mm_storeu_si128((__m128i*)(sqrResponses + nBlock), _mm_packs_epi32(signedResponseA_s_32x4, signedResponseB_s_32x4));
+		}
+
+		sqrResponses += 16;
+
+		windowSumsL += 16;
+		windowSumsR += 16;
+
+		windowSqrSumsL += 16;
+		windowSqrSumsR += 16;
+	}
+
+#endif // OCEAN_HARDWARE_SSE_VERSION >= 41
+
 	while (sqrResponses != responsesEnd)
 	{
 		ocean_assert(sqrResponses < responsesEnd);
@@ -2347,16 +2583,63 @@ void LineDetectorULF::RMSStepEdgeDetectorI::invokeRowVertical(const uint8_t* con
 
 	sqrResponses -= elements + window + stepSize_2;
 
-	// separate pass for non-max suppression -- slow, how to speed up?
+	// separate pass for non-max suppression
 
 	// the non maximum suppression must not set a response immediately, as this result can have an impact on the following/neighboring suppression iteration
 	// therefore, we store an intermediate response value which we will update one iteration later
 	int16_t newPreviousSqrResponsesValue = 0;
 	ocean_assert(sqrResponses[window + stepSize_2 - 1] == 0);
 
-	for (unsigned int x = window + stepSize_2; x < width - window - stepSize_2; ++x)
+	unsigned int x = window + stepSize_2;
+	const unsigned int endX = width - window - stepSize_2;
+
+	// the (not yet suppressed) response of the previous pixel
+	int16_t previousSqrResponse = sqrResponses[x - 1u];
+
+#if defined(OCEAN_HARDWARE_SSE_VERSION) && OCEAN_HARDWARE_SSE_VERSION >= 41
+
+	if (x + 8u <= endX)
 	{
-		const int16_t left = sqrResponses[x - 1];
+		// the result of each block is written after the next block has been loaded, as the next block needs the last (not suppressed) response of the current block
+
+		const __m128i zero_s_16x8 = _mm_setzero_si128();
+
+		__m128i intermediateResponses_s_16x8 = zero_s_16x8;
+		bool hasIntermediateResponses = false;
+
+		for (; x + 8u <= endX; x += 8u)
+		{
+			const __m128i left_s_16x8 = _mm_loadu_si128((const __m128i*)(sqrResponses + x - 1u));
+			const __m128i center_s_16x8 = _mm_loadu_si128((const __m128i*)(sqrResponses + x));
+			const __m128i right_s_16x8 = _mm_loadu_si128((const __m128i*)(sqrResponses + x + 1u));
+
+			// positive responses: center > left && center >= right
+			const __m128i keepPositive_u_16x8 = _mm_and_si128(_mm_cmpgt_epi16(center_s_16x8, zero_s_16x8), _mm_andnot_si128(_mm_cmplt_epi16(center_s_16x8, right_s_16x8), _mm_cmpgt_epi16(center_s_16x8, left_s_16x8)));
+
+			// negative responses: center < left && center <= right
+			const __m128i keepNegative_u_16x8 = _mm_and_si128(_mm_cmplt_epi16(center_s_16x8, zero_s_16x8), _mm_andnot_si128(_mm_cmpgt_epi16(center_s_16x8, right_s_16x8), _mm_cmplt_epi16(center_s_16x8, left_s_16x8)));
+
+			if (hasIntermediateResponses)
+			{
+				_mm_storeu_si128((__m128i*)(sqrResponses + x - 8u), intermediateResponses_s_16x8);
+			}
+
+			intermediateResponses_s_16x8 = _mm_and_si128(center_s_16x8, _mm_or_si128(keepPositive_u_16x8, keepNegative_u_16x8));
+			hasIntermediateResponses = true;
+		}
+
+		previousSqrResponse = sqrResponses[x - 1u];
+
+		_mm_storeu_si128((__m128i*)(sqrResponses + x - 8u), intermediateResponses_s_16x8);
+
+		newPreviousSqrResponsesValue = sqrResponses[x - 1u];
+	}
+
+#endif // OCEAN_HARDWARE_SSE_VERSION >= 41
+
+	for (; x < endX; ++x)
+	{
+		const int16_t left = previousSqrResponse;
 		const int16_t center = sqrResponses[x];
 		const int16_t right = sqrResponses[x + 1];
 
@@ -2368,11 +2651,13 @@ void LineDetectorULF::RMSStepEdgeDetectorI::invokeRowVertical(const uint8_t* con
 		}
 		else
 		{
-			newPreviousSqrResponsesValue = sqrResponses[x];
+			newPreviousSqrResponsesValue = center;
 		}
+
+		previousSqrResponse = center;
 	}
 
-	sqrResponses[width - window - stepSize_2 - 1u] = newPreviousSqrResponsesValue;
+	sqrResponses[endX - 1u] = newPreviousSqrResponsesValue;
 
 #endif // OCEAN_HARDWARE_NEON_VERSION >= 10
 
@@ -3478,7 +3763,7 @@ void LineDetectorULF::SDStepEdgeDetectorI::invokeRowVertical(const uint8_t* cons
 #endif
 }
 
-FiniteLines2 LineDetectorULF::detectLines(const uint8_t* yFrame, const unsigned int width, const unsigned int height, const unsigned int framePaddingElements, const EdgeDetectors& edgeDetectors, const unsigned int threshold, const unsigned int minimalLength, const float maximalStraightLineDistance, EdgeTypes* types, const ScanDirection scaneDirection)
+FiniteLines2 LineDetectorULF::detectLines(const uint8_t* yFrame, const unsigned int width, const unsigned int height, const unsigned int framePaddingElements, const EdgeDetectors& edgeDetectors, const unsigned int threshold, const unsigned int minimalLength, const float maximalStraightLineDistance, EdgeTypes* types, const ScanDirection scaneDirection, Worker* worker)
 {
 	ocean_assert(!edgeDetectors.empty());
 
@@ -3510,7 +3795,7 @@ FiniteLines2 LineDetectorULF::detectLines(const uint8_t* yFrame, const unsigned
 
 		if (edgeDetector)
 		{
-			detectLines(yFrame, yFrameTransposedMemory, width, height, framePaddingElements, yFrameTransposedMemoryPaddingElements, *edgeDetector, detectedLines, scaneDirection, threshold, reusableResponseBuffer.data<int16_t>(), minimalLength, maximalStraightLineDistance, types);
+			detectLines(yFrame, yFrameTransposedMemory, width, height, framePaddingElements, yFrameTransposedMemoryPaddingElements, *edgeDetector, detectedLines, scaneDirection, threshold, reusableResponseBuffer.data<int16_t>(), minimalLength, maximalStraightLineDistance, types, worker);
 		}
 	}
 
@@ -3629,7 +3914,7 @@ void LineDetectorULF::separateStraightLines(const unsigned int* pixelPositionsMa
 	}
 }
 
-bool LineDetectorULF::detectLines(const uint8_t* yFrame, Memory& yFrameTransposedMemory, const unsigned int width, const unsigned int height, const unsigned int yFramePaddingElements, unsigned int& yFrameTransposedMemoryPaddingElements, const EdgeDetector& edgeDetector, FiniteLines2& detectedLines, const ScanDirection scanDirection, const unsigned int threshold, int16_t* reusableResponseBuffer, const unsigned int minimalLength, const float maximalStraightLineDistance, EdgeTypes* types)
+bool LineDetectorULF::detectLines(const uint8_t* yFrame, Memory& yFrameTransposedMemory, const unsigned int width, const unsigned int height, const unsigned int yFramePaddingElements, unsigned int& yFrameTransposedMemoryPaddingElements, const EdgeDetector& edgeDetector, FiniteLines2& detectedLines, const ScanDirection scanDirection, const unsigned int threshold, int16_t* reusableResponseBuffer, const unsigned int minimalLength, const float maximalStraightLineDistance, EdgeTypes* types, Worker* worker)
 {
 	ocean_assert(yFrame != nullptr);
 	ocean_assert(width != 0u && height != 0u);
@@ -3663,7 +3948,7 @@ bool LineDetectorULF::detectLines(const uint8_t* yFrame, Memory& yFrameTranspose
 	{
 		// we need to detect vertical lines, so we simply invoke the vertical edge detector (without the need of transposing anything)
 
-		edgeDetector.invokeVertical(yFrame, width, height, reusableResponseBuffer, yFramePaddingElements);
+		invokeVertical(edgeDetector, yFrame, width, height, reusableResponseBuffer, yFramePaddingElements, worker);
 		extractVerticalLines(reusableResponseBuffer, width, height, responsePaddingElements, false /* not transposed */, detectedLines, startThreshold, intermediateThreshold, minimalLength, maximalStraightLineDistance, types);
 	}
 
@@ -3687,12 +3972,12 @@ bool LineDetectorULF::detectLines(const uint8_t* yFrame, Memory& yFrameTranspose
 				yFrameTransposedMemory = Memory::create<uint8_t>(width * height);
 				yFrameTransposedMemoryPaddingElements = 0u;
 
-				FrameTransposer::transpose<uint8_t, 1u>(yFrame, yFrameTransposedMemory.data<uint8_t>(), width, height, yFramePaddingElements, yFrameTransposedMemoryPaddingElements, nullptr);
+				FrameTransposer::transpose<uint8_t, 1u>(yFrame, yFrameTransposedMemory.data<uint8_t>(), width, height, yFramePaddingElements, yFrameTransposedMemoryPaddingElements, worker);
 			}
 
 			ocean_assert(yFrameTransposedMemory);
 
-			edgeDetector.invokeVertical(yFrameTransposedMemory.data<uint8_t>(), height, width, reusableResponseBuffer, yFrameTransposedMemoryPaddingElements);
+			invokeVertical(edgeDetector, yFrameTransposedMemory.data<uint8_t>(), height, width, reusableResponseBuffer, yFrameTransposedMemoryPaddingElements, worker);
 			extractVerticalLines(reusableResponseBuffer, height, width, responsePaddingElements, true /* transposed */, detectedLines, startThreshold, intermediateThreshold, minimalLength, maximalStraightLineDistance, types);
 		}
 	}
@@ -3712,6 +3997,34 @@ bool LineDetectorULF::detectLines(const uint8_t* yFrame, Memory& yFrameTranspose
 	return true;
 }
 
+void LineDetectorULF::invokeVertical(const EdgeDetector& edgeDetector, const uint8_t* frame, const unsigned int width, const unsigned int height, int16_t* responses, const unsigned int paddingElements, Worker* worker)
+{
+	ocean_assert(frame != nullptr && responses != nullptr);
+	ocean_assert(width != 0u && height != 0u);
+
+	if (worker != nullptr)
+	{
+		worker->executeFunction(Worker::Function::createStatic(&LineDetectorULF::invokeVerticalSubset, &edgeDetector, frame, width, paddingElements, responses, 0u, 0u), 0u, height, 5u, 6u, 20u);
+	}
+	else
+	{
+		edgeDetector.invokeVertical(frame, width, height, responses, paddingElements);
+	}
+}
+
+void LineDetectorULF::invokeVerticalSubset(const EdgeDetector* edgeDetector, const uint8_t* frame, const unsigned int width, const unsigned int paddingElements, int16_t* responses, const unsigned int firstRow, const unsigned int numberRows)
+{
+	ocean_assert(edgeDetector != nullptr);
+	ocean_assert(frame != nullptr && responses != nullptr);
+	ocean_assert(width != 0u && numberRows != 0u);
+
+	const unsigned int frameStrideElements = width + paddingElements;
+
+	// the vertical edge detection handles each row individually, so that we can simply apply the detector on a block of rows
+
+	edgeDetector->invokeVertical(frame + firstRow * frameStrideElements, width, numberRows, responses + firstRow * width, paddingElements);
+}
+
 }
 
 }
@@ -11,6 +11,7 @@
 #include "ocean/cv/detector/Detector.h"
 
 #include "ocean/base/Memory.h"
+#include "ocean/base/Worker.h"
 
 #include "ocean/cv/FrameTransposer.h"
 #include "ocean/cv/PixelPosition.h"
@@ -208,6 +209,18 @@ class OCEAN_CV_DETECTOR_EXPORT LineDetectorULF
 				 */
 				inline EdgeDetector(const unsigned int window, const EdgeType edgeType);
 
+#if defined(OCEAN_HARDWARE_SSE_VERSION) && OCEAN_HARDWARE_SSE_VERSION >= 41
+
+				/**
+				 * Divides four unsigned 32 bit integer values by four 32 bit integer values, the result is identical to a scalar unsigned integer division.
+				 * @param numerators_u_32x4 The four numerators, with range [0, 2^32 - 1]
+				 * @param denominators_u_32x4 The four denominators, with range [1, 2^31 - 1]
+				 * @return The four resulting quotients, must have range [0, 2^31 - 1]
+				 */
+				static OCEAN_FORCE_INLINE __m128i divideUnsigned32BitSSE(const __m128i& numerators_u_32x4, const __m128i& denominators_u_32x4);
+
+#endif // OCEAN_HARDWARE_SSE_VERSION >= 41
+
 			protected:
 
 				/// The width of the sliding window in pixel, with range [1, infinity)
@@ -658,10 +671,11 @@ class OCEAN_CV_DETECTOR_EXPORT LineDetectorULF
 		 * @param maximalStraightLineDistance The maximal distance between the ideal line and every pixel on actual extracted line in pixel, with range [0, infinity)
 		 * @param types Optional resulting types of the individual resulting lines, one type for each line
 		 * @param scanDirection The scan direction(s) to be applied
+		 * @param worker Optional worker object to distribute the edge detection of rows and columns
 		 * @return The detected lines
 		 * @see defaultEdgeDetectors().
 		 */
-		static FiniteLines2 detectLines(const uint8_t* yFrame, const unsigned int width, const unsigned int height, const unsigned int framePaddingElements, const EdgeDetectors& edgeDetectors = defaultEdgeDetectors(), const unsigned int threshold = 50u, const unsigned int minimalLength = 20u, const float maximalStraightLineDistance = 1.6f, EdgeTypes* types = nullptr, const ScanDirection scanDirection = SD_VERTICAL_AND_HORIZONTAL);
+		static FiniteLines2 detectLines(const uint8_t* yFrame, const unsigned int width, const unsigned int height, const unsigned int framePaddingElements, const EdgeDetectors& edgeDetectors = defaultEdgeDetectors(), const unsigned int threshold = 50u, const unsigned int minimalLength = 20u, const float maximalStraightLineDistance = 1.6f, EdgeTypes* types = nullptr, const ScanDirection scanDirection = SD_VERTICAL_AND_HORIZONTAL, Worker* worker = nullptr);
 
 	protected:
 
@@ -811,9 +825,36 @@ class OCEAN_CV_DETECTOR_EXPORT LineDetectorULF
 		 * @param minimalLength The minimal length an extracted line must have in pixel, with range [2, infinity)
 		 * @param maximalStraightLineDistance The maximal distance between the ideal line and every pixel on actual extracted line in pixel, with range [0, infinity)
 		 * @param types Optional resulting types of the individual resulting lines, one type for each line
+		 * @param worker Optional worker object to distribute the edge detection of rows and columns
 		 * @return True, if succeeded
 		 */
-		static bool detectLines(const uint8_t* const yFrame, Memory& yFrameTransposedMemory, const unsigned int width, const unsigned int height, const unsigned int yFramePaddingElements, unsigned int& yFrameTransposedMemoryPaddingElements, const EdgeDetector& edgeDetector, FiniteLines2& detectedLines, const ScanDirection scanDirection, const unsigned int threshold = 50u, int16_t* reusableResponseBuffer = nullptr, const unsigned int minimalLength = 20u, const float maximalStraightLineDistance = 1.6f, EdgeTypes* types = nullptr);
+		static bool detectLines(const uint8_t* const yFrame, Memory& yFrameTransposedMemory, const unsigned int width, const unsigned int height, const unsigned int yFramePaddingElements, unsigned int& yFrameTransposedMemoryPaddingElements, const EdgeDetector& edgeDetector, FiniteLines2& detectedLines, const ScanDirection scanDirection, const unsigned int threshold = 50u, int16_t* reusableResponseBuffer = nullptr, const unsigned int minimalLength = 20u, const float maximalStraightLineDistance = 1.6f, EdgeTypes* types = nullptr, Worker* worker = nullptr);
+
+		/**
+		 * Invokes the vertical edge detection of a given edge detector, optionally distributed to several threads.
+		 * The rows of the frame are handled independently of each other, the result is identical to EdgeDetector::invokeVertical().
+		 * @param edgeDetector The edge detector to be applied
+		 * @param frame The 8bit grayscale frame on which the edge detection will be applied, must be valid
+		 * @param width The width the given frame in pixel, with range [1, infinity)
+		 * @param height The height of the given frame in pixel, with range [1, infinity)
+		 * @param responses The pointer to the resulting response values one for each pixel, must be valid
+		 * @param paddingElements The number of padding elements at the end of each frame row, in elements, with range [0, infinity)
+		 * @param worker Optional worker object to distribute the computation
+		 * @see EdgeDetector::invokeVertical().
+		 */
+		static void invokeVertical(const EdgeDetector& edgeDetector, const uint8_t* frame, const unsigned int width, const unsigned int height, int16_t* responses, const unsigned int paddingElements, Worker* worker);
+
+		/**
+		 * Invokes the vertical edge detection of a given edge detector for a subset of the frame rows.
+		 * @param edgeDetector The edge detector to be applied, must be valid
+		 * @param frame The 8bit grayscale frame on which the edge detection will be applied, must be valid
+		 * @param width The width the given frame in pixel, with range [1, infinity)
+		 * @param paddingElements The number of padding elements at the end of each frame row, in elements, with range [0, infinity)
+		 * @param responses The pointer to the resulting response values one for each pixel, must be valid
+		 * @param firstRow The first row to be handled, with range [0, height - 1]
+		 * @param numberRows The number of rows to be handled, with range [1, height - firstRow]
+		 */
+		static void invokeVerticalSubset(const EdgeDetector* edgeDetector, const uint8_t* frame, const unsigned int width, const unsigned int paddingElements, int16_t* responses, const unsigned int firstRow, const unsigned int numberRows);
 
 		/**
 		 * Returns whether a given value is larger than or equal to a given threshold (or smaller than or equal to a given threshold).
@@ -851,6 +892,32 @@ inline LineDetectorULF::EdgeType LineDetectorULF::EdgeDetector::edgeType() const
 	return edgeType_;
 }
 
+#if defined(OCEAN_HARDWARE_SSE_VERSION) && OCEAN_HARDWARE_SSE_VERSION >= 41
+
+OCEAN_FORCE_INLINE __m128i LineDetectorULF::EdgeDetector::divideUnsigned32BitSSE(const __m128i& numerators_u_32x4, const __m128i& denominators_u_32x4)
+{
+	// the division is applied with double precision, numerator and denominator are below 2^32 so that the rounded quotient never reaches the next integer
+
+	const __m128i signBit_u_32x4 = _mm_set1_epi32(int(0x80000000u));
+	const __m128d signBitOffset_64x2 = _mm_set1_pd(2147483648.0);
+
+	// unsigned to signed conversion: int(numerator - 2^31) + 2^31
+	const __m128i numerators_s_32x4 = _mm_xor_si128(numerators_u_32x4, signBit_u_32x4);
+
+	const __m128d numeratorsA_64x2 = _mm_add_pd(_mm_cvtepi32_pd(numerators_s_32x4), signBitOffset_64x2);
+	const __m128d numeratorsB_64x2 = _mm_add_pd(_mm_cvtepi32_pd(_mm_srli_si128(numerators_s_32x4, 8)), signBitOffset_64x2);
+
+	const __m128d denominatorsA_64x2 = _mm_cvtepi32_pd(denominators_u_32x4);
+	const __m128d denominatorsB_64x2 = _mm_cvtepi32_pd(_mm_srli_si128(denominators_u_32x4, 8));
+
+	const __m128i quotientsA_u_32x4 = _mm_cvttpd_epi32(_mm_div_pd(numeratorsA_64x2, denominatorsA_64x2));
+	const __m128i quotientsB_u_32x4 = _mm_cvttpd_epi32(_mm_div_pd(numeratorsB_64x2, denominatorsB_64x2));
+
+	return _mm_unpacklo_epi64(quotientsA_u_32x4, quotientsB_u_32x4);
+}
+
+#endif // OCEAN_HARDWARE_SSE_VERSION >= 41
+
 inline unsigned int LineDetectorULF::RMSBarEdgeDetectorI::staticAdjustThreshold(const unsigned int threshold)
 {
 	/**
@@ -24,6 +24,11 @@ namespace CV
 namespace Detector
 {
 
+void ORBFeatureDescriptor::warmUp()
+{
+	ORBSamplingPattern::get();
+}
+
 void ORBFeatureDescriptor::detectReferenceFeaturesAndDetermineDescriptors(const FramePyramid& framePyramid, ORBFeatures& featurePoints, const bool useHarrisFeatures, const unsigned int featureThreshold, Worker* worker)
 {
 	ocean_assert(framePyramid.isValid());
@@ -94,6 +99,8 @@ void ORBFeatureDescriptor::determineDescriptorsSubset(const uint32_t* linedInteg
 
 	constexpr unsigned int linedIntegralFramePaddingElements = 0u;
 
+	const unsigned int linedIntegralFrameStrideElements = (width + 1u) + linedIntegralFramePaddingElements;
+
 	const ORBSamplingPattern& samplingPattern = ORBSamplingPattern::get();
 
 	constexpr size_t numberDescriptorBitset = sizeof(ORBDescriptor::DescriptorBitset) * 8;
@@ -108,66 +115,158 @@ void ORBFeatureDescriptor::determineDescriptorsSubset(const uint32_t* linedInteg
 	const std::array<Scalar, 3> factors = {Scalar(1), Scalar(0.707107), Scalar(1.41421)}; // 1, 1/sqrt(2), sqrt(2)
 	const std::array<unsigned int, 3> patchSizes = {5u, 3u, 7u};
 
-	for (unsigned int subLayer = 0u; subLayer < numberLayers; ++subLayer)
+	// we handle all sub layers of one feature point at once so that the rotated sampling pattern is selected once per feature point
+
+	for (unsigned int i = firstFeaturePoint; i < firstFeaturePoint + numberFeaturePoints; ++i)
 	{
-		const Scalar factor = factors[subLayer];
-		const unsigned int patchSize = patchSizes[subLayer];
-		//const Scalar strengthThreshold = Scalar(patchSize * patchSize * 255u) * Scalar(0.05);
+		ORBFeature& feature = featurePoints[i];
+
+		const Vector2& observation = feature.observation();
+
+		const Vector2 centerPosition = observation + Vector2(Scalar(0.5), Scalar(0.5));
 
-		for (unsigned int i = firstFeaturePoint; i < firstFeaturePoint + numberFeaturePoints; ++i)
+		ocean_assert(centerPosition.x() >= border && centerPosition.y() >= border);
+		ocean_assert(centerPosition.x() <= maxWidth && centerPosition.y() <= maxHeight);
+
+		if (centerPosition.x() < border || centerPosition.y() < border || centerPosition.x() > maxWidth || centerPosition.y() > maxHeight)
 		{
-			ORBFeature& feature = featurePoints[i];
+			continue;
+		}
 
-			const Vector2& observation = feature.observation();
+		const ORBSamplingPattern::LookupTable& lookupTable = samplingPattern.samplingPatternForAngle(feature.orientation());
+		ocean_assert(lookupTable.size() == numberDescriptorBitset);
 
-			const Vector2 centerPosition = observation + Vector2(Scalar(0.5), Scalar(0.5));
+		for (unsigned int subLayer = 0u; subLayer < numberLayers; ++subLayer)
+		{
+			const Scalar factor = factors[subLayer];
+			const unsigned int patchSize = patchSizes[subLayer];
 
-			ocean_assert(centerPosition.x() >= border && centerPosition.y() >= border);
-			ocean_assert(centerPosition.x() <= maxWidth && centerPosition.y() <= maxHeight);
+			ORBDescriptor descriptor;
 
-			if (centerPosition.x() >= border && centerPosition.y() >= border && centerPosition.x() <= maxWidth && centerPosition.y() <= maxHeight)
+			for (size_t j = 0u; j < numberDescriptorBitset; ++j)
 			{
-				const ORBSamplingPattern::LookupTable& lookupTable = samplingPattern.samplingPatternForAngle(feature.orientation());
+				const Vector2 layerOffset0 = lookupTable[j].point0() * factor;
+				const Vector2 layerOffset1 = lookupTable[j].point1() * factor;
 
-				ORBDescriptor descriptor;
-				//unsigned int strengthCounter = 0u;
+				ocean_assert(layerOffset0.x() > Scalar(-29.5) && layerOffset0.x() < Scalar(29.5));
+				ocean_assert(layerOffset0.y() > Scalar(-29.5) && layerOffset0.y() < Scalar(29.5));
 
-				for (size_t j = 0u; j < numberDescriptorBitset; ++j)
+				const Scalar intensity0 = patchIntensitySum(linedIntegralFrame, linedIntegralFrameStrideElements, centerPosition + layerOffset0, patchSize);
+				const Scalar intensity1 = patchIntensitySum(linedIntegralFrame, linedIntegralFrameStrideElements, centerPosition + layerOffset1, patchSize);
+
+				ocean_assert(intensity0 == CV::FrameInterpolatorBilinear::patchIntensitySum1Channel(linedIntegralFrame, width, height, linedIntegralFramePaddingElements, centerPosition + layerOffset0, CV::PC_CENTER, patchSize, patchSize));
+
+				if (intensity0 < intensity1)
 				{
-					const Vector2& offset0 = lookupTable[j].point0();
-					const Vector2& offset1 = lookupTable[j].point1();
+					descriptor[j] = 1;
+				}
+			}
 
-					const Vector2 layerOffset0 = offset0 * factor;
-					const Vector2 layerOffset1 = offset1 * factor;
+			feature.setDescriptorType(ORBFeature::FDT_ORIENTED);
+			feature.addDescriptor(descriptor);
+		}
+	}
+}
 
-					ocean_assert(layerOffset0.x() > Scalar(-29.5) && layerOffset0.x() < Scalar(29.5));
-					ocean_assert(layerOffset0.y() > Scalar(-29.5) && layerOffset0.y() < Scalar(29.5));
+OCEAN_FORCE_INLINE Scalar ORBFeatureDescriptor::patchIntensitySum(const uint32_t* linedIntegralFrame, const unsigned int linedIntegralFrameStrideElements, const Vector2& center, const unsigned int patchSize)
+{
+	ocean_assert(linedIntegralFrame != nullptr);
+	ocean_assert(patchSize >= 1u);
 
-					const Vector2 lookupPosition0 = centerPosition + layerOffset0;
-					const Vector2 lookupPosition1 = centerPosition + layerOffset1;
+	const Scalar patchLeft = center.x() - Scalar(patchSize) * Scalar(0.5);
+	const Scalar patchTop = center.y() - Scalar(patchSize) * Scalar(0.5);
+	ocean_assert(patchLeft >= Scalar(0) && patchLeft + Scalar(patchSize) < Scalar(linedIntegralFrameStrideElements - 1u));
+	ocean_assert(patchTop >= Scalar(0));
 
-					const Scalar intensity1 = CV::FrameInterpolatorBilinear::patchIntensitySum1Channel(linedIntegralFrame, width, height, linedIntegralFramePaddingElements, lookupPosition0, CV::PC_CENTER, patchSize, patchSize);
-					const Scalar intensity2 = CV::FrameInterpolatorBilinear::patchIntensitySum1Channel(linedIntegralFrame, width, height, linedIntegralFramePaddingElements, lookupPosition1, CV::PC_CENTER, patchSize, patchSize);
+	const unsigned int pixelPatchLeft = (unsigned int)(patchLeft);
+	const unsigned int pixelPatchTop = (unsigned int)(patchTop);
 
-					if (intensity1 < intensity2)
-					{
-						descriptor[j] = 1;
-					}
+	const Scalar factorRight = patchLeft - Scalar(pixelPatchLeft);
+	const Scalar factorBottom = patchTop - Scalar(pixelPatchTop);
 
-					/*if (Numeric::abs(intensity1 - intensity2) > strengthThreshold)
-					{
-						++strengthCounter;
-					}*/
-				}
+	const Scalar factorLeft = Scalar(1) - factorRight;
+	const Scalar factorTop = Scalar(1) - factorBottom;
 
-				feature.setDescriptorType(ORBFeature::FDT_ORIENTED);
-				feature.addDescriptor(descriptor);
+	const Scalar factorTopLeft = factorTop * factorLeft;
 
-				// feature strength is currently not used
-				//feature.setStrength(Scalar(strengthCounter) * Scalar(0.00390625)); // / 256
-			}
-		}
+	// the four patches with top left corners (left, top), (left + 1, top), (left, top + 1), and (left + 1, top + 1) are defined by four rows and four columns of the integral image:
+	// rows: top, top + 1, top + size, top + size + 1
+	// columns: left, left + 1, left + size, left + size + 1
+
+	const uint32_t* const integralTop = linedIntegralFrame + pixelPatchTop * linedIntegralFrameStrideElements + pixelPatchLeft;
+	const uint32_t* const integralBottom = integralTop + patchSize * linedIntegralFrameStrideElements;
+
+	OCEAN_ALIGN_DATA(16) uint32_t intensities[4];
+
+#if defined(OCEAN_HARDWARE_SSE_VERSION) && OCEAN_HARDWARE_SSE_VERSION >= 41
+
+	// each row: [I(left), I(left + 1), I(left + size), I(left + size + 1)]
+
+	const __m128i top0_u_32x4 = _mm_unpacklo_epi64(_mm_loadl_epi64((const __m128i*)(integralTop)), _mm_loadl_epi64((const __m128i*)(integralTop + patchSize)));
+	const __m128i top1_u_32x4 = _mm_unpacklo_epi64(_mm_loadl_epi64((const __m128i*)(integralTop + linedIntegralFrameStrideElements)), _mm_loadl_epi64((const __m128i*)(integralTop + linedIntegralFrameStrideElements + patchSize)));
+	const __m128i bottom0_u_32x4 = _mm_unpacklo_epi64(_mm_loadl_epi64((const __m128i*)(integralBottom)), _mm_loadl_epi64((const __m128i*)(integralBottom + patchSize)));
+	const __m128i bottom1_u_32x4 = _mm_unpacklo_epi64(_mm_loadl_epi64((const __m128i*)(integralBottom + linedIntegralFrameStrideElements)), _mm_loadl_epi64((const __m128i*)(integralBottom + linedIntegralFrameStrideElements + patchSize)));
+
+	// [I(bottom, left) - I(top, left), ..., I(bottom, left + size + 1) - I(top, left + size + 1)]
+	const __m128i verticalTop_u_32x4 = _mm_sub_epi32(bottom0_u_32x4, top0_u_32x4);
+	const __m128i verticalBottom_u_32x4 = _mm_sub_epi32(bottom1_u_32x4, top1_u_32x4);
+
+	// [top left, top right, bottom left, bottom right]
+	const __m128i vertical_u_32x4 = _mm_unpacklo_epi64(verticalTop_u_32x4, verticalBottom_u_32x4);
+	const __m128i verticalShifted_u_32x4 = _mm_unpackhi_epi64(verticalTop_u_32x4, verticalBottom_u_32x4);
+
+	_mm_store_si128((__m128i*)(intensities), _mm_sub_epi32(verticalShifted_u_32x4, vertical_u_32x4));
+
+#elif defined(OCEAN_HARDWARE_NEON_VERSION) && OCEAN_HARDWARE_NEON_VERSION >= 10
+
+	// each row: [I(left), I(left + 1), I(left + size), I(left + size + 1)]
+
+	const uint32x4_t top0_u_32x4 = vcombine_u32(vld1_u32(integralTop), vld1_u32(integralTop + patchSize));
+	const uint32x4_t top1_u_32x4 = vcombine_u32(vld1_u32(integralTop + linedIntegralFrameStrideElements), vld1_u32(integralTop + linedIntegralFrameStrideElements + patchSize));
+	const uint32x4_t bottom0_u_32x4 = vcombine_u32(vld1_u32(integralBottom), vld1_u32(integralBottom + patchSize));
+	const uint32x4_t bottom1_u_32x4 = vcombine_u32(vld1_u32(integralBottom + linedIntegralFrameStrideElements), vld1_u32(integralBottom + linedIntegralFrameStrideElements + patchSize));
+
+	const uint32x4_t verticalTop_u_32x4 = vsubq_u32(bottom0_u_32x4, top0_u_32x4);
+	const uint32x4_t verticalBottom_u_32x4 = vsubq_u32(bottom1_u_32x4, top1_u_32x4);
+
+	// [top left, top right, bottom left, bottom right]
+	const uint32x4_t vertical_u_32x4 = vcombine_u32(vget_low_u32(verticalTop_u_32x4), vget_low_u32(verticalBottom_u_32x4));
+	const uint32x4_t verticalShifted_u_32x4 = vcombine_u32(vget_high_u32(verticalTop_u_32x4), vget_high_u32(verticalBottom_u_32x4));
+
+	vst1q_u32(intensities, vsubq_u32(verticalShifted_u_32x4, vertical_u_32x4));
+
+#else
+
+	for (unsigned int n = 0u; n < 2u; ++n)
+	{
+		const uint32_t* const top = integralTop + n * linedIntegralFrameStrideElements;
+		const uint32_t* const bottom = integralBottom + n * linedIntegralFrameStrideElements;
+
+		intensities[n * 2u + 0u] = bottom[patchSize] - top[patchSize] - bottom[0] + top[0];
+		intensities[n * 2u + 1u] = bottom[patchSize + 1u] - top[patchSize + 1u] - bottom[1] + top[1];
+	}
+
+#endif
+
+	ocean_assert(intensities[0] == CV::IntegralImage::linedIntegralSum<uint32_t>(linedIntegralFrame, linedIntegralFrameStrideElements, pixelPatchLeft, pixelPatchTop, patchSize, patchSize));
+	ocean_assert(intensities[3] == CV::IntegralImage::linedIntegralSum<uint32_t>(linedIntegralFrame, linedIntegralFrameStrideElements, pixelPatchLeft + 1u, pixelPatchTop + 1u, patchSize, patchSize));
+
+	if (Numeric::isEqual(factorTopLeft, Scalar(1)))
+	{
+		return Scalar(intensities[0]);
 	}
+
+	const Scalar factorTopRight = factorTop * factorRight;
+	const Scalar factorBottomLeft = factorBottom * factorLeft;
+	const Scalar factorBottomRight = factorBottom * factorRight;
+
+	// we apply the identical interpolation as FrameInterpolatorBilinear::patchIntensitySum1Channel() to receive bit-identical descriptors
+
+	const uint32_t intensityTopRight = Numeric::isEqual(factorTopRight, Scalar(0)) ? 0u : intensities[1];
+	const uint32_t intensityBottomLeft = Numeric::isEqual(factorBottomLeft, Scalar(0)) ? 0u : intensities[2];
+	const uint32_t intensityBottomRight = Numeric::isEqual(factorBottomRight, Scalar(0)) ? 0u : intensities[3];
+
+	return factorTopLeft * Scalar(intensities[0]) + factorTopRight * Scalar(intensityTopRight) + factorBottomLeft * Scalar(intensityBottomLeft) + factorBottomRight * Scalar(intensityBottomRight);
 }
 
 void ORBFeatureDescriptor::determineNonBijectiveCorrespondencesSubset(const ORBFeature* forwardFeatures, const size_t numberForwardFeatures, const ORBFeature* backwardFeatures, const size_t numberBackwardFeatures, const float threshold, IndexPairs32* correspondences, Lock* lock, const unsigned int firstIndex, const unsigned int numberIndices)
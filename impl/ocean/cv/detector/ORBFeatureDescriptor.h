@@ -43,6 +43,12 @@ class OCEAN_CV_DETECTOR_EXPORT ORBFeatureDescriptor
 {
 	public:
 
+		/**
+		 * Prebuilds the sampling pattern lookup tables which are necessary for the calculation of ORB descriptors.
+		 * The tables are created lazily with the first descriptor calculation, this function allows to create the tables before the first frame arrives.
+		 */
+		static void warmUp();
+
 		/**
 		 * Calculate the ORB descriptor for all given feature points.
 		 * If sub layers are used, three descriptors are determined per feature. One for the unmodified frame size, one for a resizing factor of sqrt(2) and one for a resizing factor of 1/sqrt(2).
@@ -112,6 +118,18 @@ class OCEAN_CV_DETECTOR_EXPORT ORBFeatureDescriptor
 		 */
 		static void determineDescriptorsSubset(const uint32_t* linedIntegralFrame, const unsigned int width, const unsigned int height, ORBFeature* featurePoints, const bool useMultiLayers, const unsigned int firstFeaturePoint, const unsigned int numberFeaturePoints);
 
+		/**
+		 * Determines the bilinear interpolated intensity sum of a square image patch based on a lined integral image.
+		 * The result is identical to FrameInterpolatorBilinear::patchIntensitySum1Channel() with pixel center PC_CENTER.<br>
+		 * However, the integral values of the four neighboring integer patches are gathered at once (with SIMD instructions if available) as all four patches share the same rows and columns of the integral image.
+		 * @param linedIntegralFrame Pointer to the (lined) integral frame, must be valid
+		 * @param linedIntegralFrameStrideElements The number of elements between two integral rows, with range [width + 1, infinity)
+		 * @param center The center position of the patch, with pixel center PC_CENTER, the patch must be located entirely inside the frame
+		 * @param patchSize The width and height of the square patch in pixel, with range [1, infinity)
+		 * @return The interpolated intensity sum of the patch
+		 */
+		static OCEAN_FORCE_INLINE Scalar patchIntensitySum(const uint32_t* linedIntegralFrame, const unsigned int linedIntegralFrameStrideElements, const Vector2& center, const unsigned int patchSize);
+
 		/**
 		 * Determines feature correspondences for a subset of forward feature points - one backward feature point for each given forward feature point.
 		 * @param forwardFeatures The forward feature points for which corresponding backward features will be determined, must be valid
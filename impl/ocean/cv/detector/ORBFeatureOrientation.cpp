@@ -52,74 +52,88 @@ Scalar ORBFeatureOrientation::determineFeatureOrientation31(const unsigned int*
 	ocean_assert(linedIntegralFrame);
 	ocean_assert(width >= 31u && height >= 31u);
 
-	ocean_assert(position.x() > Scalar(0) && position.x() < Scalar(width) - Scalar(15));
-	ocean_assert(position.y() > Scalar(0) && position.y() < Scalar(height) - Scalar(15));
+	ocean_assert(position.x() > Scalar(15) && position.x() < Scalar(width) - Scalar(15));
+	ocean_assert(position.y() > Scalar(15) && position.y() < Scalar(height) - Scalar(15));
 
 	constexpr unsigned int linedIntegralFramePaddingElements = 0u;
 
-	const Scalar m_10 =	FrameInterpolatorBilinear::patchIntensitySum1Channel(linedIntegralFrame, width, height, linedIntegralFramePaddingElements, position + Vector2(1, 0), CV::PC_CENTER, 1, 29)
-		+ 2 * FrameInterpolatorBilinear::patchIntensitySum1Channel(linedIntegralFrame, width, height, linedIntegralFramePaddingElements, position + Vector2(2, 0), CV::PC_CENTER, 1, 29)
-		+ 3 * FrameInterpolatorBilinear::patchIntensitySum1Channel(linedIntegralFrame, width, height, linedIntegralFramePaddingElements, position + Vector2(3, 0), CV::PC_CENTER, 1, 29)
-		+ 4 * FrameInterpolatorBilinear::patchIntensitySum1Channel(linedIntegralFrame, width, height, linedIntegralFramePaddingElements, position + Vector2(4, 0), CV::PC_CENTER, 1, 29)
-		+ 5 * FrameInterpolatorBilinear::patchIntensitySum1Channel(linedIntegralFrame, width, height, linedIntegralFramePaddingElements, position + Vector2(5, 0), CV::PC_CENTER, 1, 29)
-		+ 6 * FrameInterpolatorBilinear::patchIntensitySum1Channel(linedIntegralFrame, width, height, linedIntegralFramePaddingElements, position + Vector2(6, 0), CV::PC_CENTER, 1, 27)
-		+ 7 * FrameInterpolatorBilinear::patchIntensitySum1Channel(linedIntegralFrame, width, height, linedIntegralFramePaddingElements, position + Vector2(7, 0), CV::PC_CENTER, 1, 27)
-		+ 8 * FrameInterpolatorBilinear::patchIntensitySum1Channel(linedIntegralFrame, width, height, linedIntegralFramePaddingElements, position + Vector2(8, 0), CV::PC_CENTER, 1, 25)
-		+ 9 * FrameInterpolatorBilinear::patchIntensitySum1Channel(linedIntegralFrame, width, height, linedIntegralFramePaddingElements, position + Vector2(9, 0), CV::PC_CENTER, 1, 25)
-		+ 10 * FrameInterpolatorBilinear::patchIntensitySum1Channel(linedIntegralFrame, width, height, linedIntegralFramePaddingElements, position + Vector2(10, 0), CV::PC_CENTER, 1, 23)
-		+ 11 * FrameInterpolatorBilinear::patchIntensitySum1Channel(linedIntegralFrame, width, height, linedIntegralFramePaddingElements, position + Vector2(11, 0), CV::PC_CENTER, 1, 21)
-		+ 12 * FrameInterpolatorBilinear::patchIntensitySum1Channel(linedIntegralFrame, width, height, linedIntegralFramePaddingElements, position + Vector2(12, 0), CV::PC_CENTER, 1, 19)
-		+ 13 * FrameInterpolatorBilinear::patchIntensitySum1Channel(linedIntegralFrame, width, height, linedIntegralFramePaddingElements, position + Vector2(13, 0), CV::PC_CENTER, 1, 15)
-		+ 14 * FrameInterpolatorBilinear::patchIntensitySum1Channel(linedIntegralFrame, width, height, linedIntegralFramePaddingElements, position + Vector2(14, 0), CV::PC_CENTER, 1, 11)
-		+ 15 * FrameInterpolatorBilinear::patchIntensitySum1Channel(linedIntegralFrame, width, height, linedIntegralFramePaddingElements, position + Vector2(15, 0), CV::PC_CENTER, 1, 1)
-		- FrameInterpolatorBilinear::patchIntensitySum1Channel(linedIntegralFrame, width, height, linedIntegralFramePaddingElements, position + Vector2(-1, 0), CV::PC_CENTER, 1, 29)
-		- 2 * FrameInterpolatorBilinear::patchIntensitySum1Channel(linedIntegralFrame, width, height, linedIntegralFramePaddingElements, position + Vector2(-2, 0), CV::PC_CENTER, 1, 29)
-		- 3 * FrameInterpolatorBilinear::patchIntensitySum1Channel(linedIntegralFrame, width, height, linedIntegralFramePaddingElements, position + Vector2(-3, 0), CV::PC_CENTER, 1, 29)
-		- 4 * FrameInterpolatorBilinear::patchIntensitySum1Channel(linedIntegralFrame, width, height, linedIntegralFramePaddingElements, position + Vector2(-4, 0), CV::PC_CENTER, 1, 29)
-		- 5 * FrameInterpolatorBilinear::patchIntensitySum1Channel(linedIntegralFrame, width, height, linedIntegralFramePaddingElements, position + Vector2(-5, 0), CV::PC_CENTER, 1, 29)
-		- 6 * FrameInterpolatorBilinear::patchIntensitySum1Channel(linedIntegralFrame, width, height, linedIntegralFramePaddingElements, position + Vector2(-6, 0), CV::PC_CENTER, 1, 27)
-		- 7 * FrameInterpolatorBilinear::patchIntensitySum1Channel(linedIntegralFrame, width, height, linedIntegralFramePaddingElements, position + Vector2(-7, 0), CV::PC_CENTER, 1, 27)
-		- 8 * FrameInterpolatorBilinear::patchIntensitySum1Channel(linedIntegralFrame, width, height, linedIntegralFramePaddingElements, position + Vector2(-8, 0), CV::PC_CENTER, 1, 25)
-		- 9 * FrameInterpolatorBilinear::patchIntensitySum1Channel(linedIntegralFrame, width, height, linedIntegralFramePaddingElements, position + Vector2(-9, 0), CV::PC_CENTER, 1, 25)
-		- 10 * FrameInterpolatorBilinear::patchIntensitySum1Channel(linedIntegralFrame, width, height, linedIntegralFramePaddingElements, position + Vector2(-10, 0), CV::PC_CENTER, 1, 23)
-		- 11 * FrameInterpolatorBilinear::patchIntensitySum1Channel(linedIntegralFrame, width, height, linedIntegralFramePaddingElements, position + Vector2(-11, 0), CV::PC_CENTER, 1, 21)
-		- 12 * FrameInterpolatorBilinear::patchIntensitySum1Channel(linedIntegralFrame, width, height, linedIntegralFramePaddingElements, position + Vector2(-12, 0), CV::PC_CENTER, 1, 19)
-		- 13 * FrameInterpolatorBilinear::patchIntensitySum1Channel(linedIntegralFrame, width, height, linedIntegralFramePaddingElements, position + Vector2(-13, 0), CV::PC_CENTER, 1, 15)
-		- 14 * FrameInterpolatorBilinear::patchIntensitySum1Channel(linedIntegralFrame, width, height, linedIntegralFramePaddingElements, position + Vector2(-14, 0), CV::PC_CENTER, 1, 11)
-		- 15 * FrameInterpolatorBilinear::patchIntensitySum1Channel(linedIntegralFrame, width, height, linedIntegralFramePaddingElements, position + Vector2(-15, 0), CV::PC_CENTER, 1, 1);
-
-	const Scalar m_01 =	FrameInterpolatorBilinear::patchIntensitySum1Channel(linedIntegralFrame, width, height, linedIntegralFramePaddingElements, position + Vector2(0, 1), CV::PC_CENTER, 29, 1)
-		+ 2 * FrameInterpolatorBilinear::patchIntensitySum1Channel(linedIntegralFrame, width, height, linedIntegralFramePaddingElements, position + Vector2(0, 2), CV::PC_CENTER, 29, 1)
-		+ 3 * FrameInterpolatorBilinear::patchIntensitySum1Channel(linedIntegralFrame, width, height, linedIntegralFramePaddingElements, position + Vector2(0, 3), CV::PC_CENTER, 29, 1)
-		+ 4 * FrameInterpolatorBilinear::patchIntensitySum1Channel(linedIntegralFrame, width, height, linedIntegralFramePaddingElements, position + Vector2(0, 4), CV::PC_CENTER, 29, 1)
-		+ 5 * FrameInterpolatorBilinear::patchIntensitySum1Channel(linedIntegralFrame, width, height, linedIntegralFramePaddingElements, position + Vector2(0, 5), CV::PC_CENTER, 29, 1)
-		+ 6 * FrameInterpolatorBilinear::patchIntensitySum1Channel(linedIntegralFrame, width, height, linedIntegralFramePaddingElements, position + Vector2(0, 6), CV::PC_CENTER, 27, 1)
-		+ 7 * FrameInterpolatorBilinear::patchIntensitySum1Channel(linedIntegralFrame, width, height, linedIntegralFramePaddingElements, position + Vector2(0, 7), CV::PC_CENTER, 27, 1)
-		+ 8 * FrameInterpolatorBilinear::patchIntensitySum1Channel(linedIntegralFrame, width, height, linedIntegralFramePaddingElements, position + Vector2(0, 8), CV::PC_CENTER, 25, 1)
-		+ 9 * FrameInterpolatorBilinear::patchIntensitySum1Channel(linedIntegralFrame, width, height, linedIntegralFramePaddingElements, position + Vector2(0, 9), CV::PC_CENTER, 25, 1)
-		+ 10 * FrameInterpolatorBilinear::patchIntensitySum1Channel(linedIntegralFrame, width, height, linedIntegralFramePaddingElements, position + Vector2(0, 10), CV::PC_CENTER, 23, 1)
-		+ 11 * FrameInterpolatorBilinear::patchIntensitySum1Channel(linedIntegralFrame, width, height, linedIntegralFramePaddingElements, position + Vector2(0, 11), CV::PC_CENTER, 21, 1)
-		+ 12 * FrameInterpolatorBilinear::patchIntensitySum1Channel(linedIntegralFrame, width, height, linedIntegralFramePaddingElements, position + Vector2(0, 12), CV::PC_CENTER, 19, 1)
-		+ 13 * FrameInterpolatorBilinear::patchIntensitySum1Channel(linedIntegralFrame, width, height, linedIntegralFramePaddingElements, position + Vector2(0, 13), CV::PC_CENTER, 15, 1)
-		+ 14 * FrameInterpolatorBilinear::patchIntensitySum1Channel(linedIntegralFrame, width, height, linedIntegralFramePaddingElements, position + Vector2(0, 14), CV::PC_CENTER, 11, 1)
-		+ 15 * FrameInterpolatorBilinear::patchIntensitySum1Channel(linedIntegralFrame, width, height, linedIntegralFramePaddingElements, position + Vector2(0, 15), CV::PC_CENTER, 1, 1)
-		- FrameInterpolatorBilinear::patchIntensitySum1Channel(linedIntegralFrame, width, height, linedIntegralFramePaddingElements, position + Vector2(0, -1), CV::PC_CENTER, 29, 1)
-		- 2 * FrameInterpolatorBilinear::patchIntensitySum1Channel(linedIntegralFrame, width, height, linedIntegralFramePaddingElements, position + Vector2(0, -2), CV::PC_CENTER, 29, 1)
-		- 3 * FrameInterpolatorBilinear::patchIntensitySum1Channel(linedIntegralFrame, width, height, linedIntegralFramePaddingElements, position + Vector2(0, -3), CV::PC_CENTER, 29, 1)
-		- 4 * FrameInterpolatorBilinear::patchIntensitySum1Channel(linedIntegralFrame, width, height, linedIntegralFramePaddingElements, position + Vector2(0, -4), CV::PC_CENTER, 29, 1)
-		- 5 * FrameInterpolatorBilinear::patchIntensitySum1Channel(linedIntegralFrame, width, height, linedIntegralFramePaddingElements, position + Vector2(0, -5), CV::PC_CENTER, 29, 1)
-		- 6 * FrameInterpolatorBilinear::patchIntensitySum1Channel(linedIntegralFrame, width, height, linedIntegralFramePaddingElements, position + Vector2(0, -6), CV::PC_CENTER, 27, 1)
-		- 7 * FrameInterpolatorBilinear::patchIntensitySum1Channel(linedIntegralFrame, width, height, linedIntegralFramePaddingElements, position + Vector2(0, -7), CV::PC_CENTER, 27, 1)
-		- 8 * FrameInterpolatorBilinear::patchIntensitySum1Channel(linedIntegralFrame, width, height, linedIntegralFramePaddingElements, position + Vector2(0, -8), CV::PC_CENTER, 25, 1)
-		- 9 * FrameInterpolatorBilinear::patchIntensitySum1Channel(linedIntegralFrame, width, height, linedIntegralFramePaddingElements, position + Vector2(0, -9), CV::PC_CENTER, 25, 1)
-		- 10 * FrameInterpolatorBilinear::patchIntensitySum1Channel(linedIntegralFrame, width, height, linedIntegralFramePaddingElements, position + Vector2(0, -10), CV::PC_CENTER, 23, 1)
-		- 11 * FrameInterpolatorBilinear::patchIntensitySum1Channel(linedIntegralFrame, width, height, linedIntegralFramePaddingElements, position + Vector2(0, -11), CV::PC_CENTER, 21, 1)
-		- 12 * FrameInterpolatorBilinear::patchIntensitySum1Channel(linedIntegralFrame, width, height, linedIntegralFramePaddingElements, position + Vector2(0, -12), CV::PC_CENTER, 19, 1)
-		- 13 * FrameInterpolatorBilinear::patchIntensitySum1Channel(linedIntegralFrame, width, height, linedIntegralFramePaddingElements, position + Vector2(0, -13), CV::PC_CENTER, 15, 1)
-		- 14 * FrameInterpolatorBilinear::patchIntensitySum1Channel(linedIntegralFrame, width, height, linedIntegralFramePaddingElements, position + Vector2(0, -14), CV::PC_CENTER, 11, 1)
-		- 15 * FrameInterpolatorBilinear::patchIntensitySum1Channel(linedIntegralFrame, width, height, linedIntegralFramePaddingElements, position + Vector2(0, -15), CV::PC_CENTER, 1, 1);
-
-	const Scalar angle = Ocean::Numeric::atan2(Scalar(m_01), Scalar(m_10));
+	const unsigned int linedIntegralFrameStrideElements = (width + 1u) + linedIntegralFramePaddingElements;
+
+	// the patch is composed of 1-pixel wide strips with odd lengths, the half lengths of the strips with distance [1, 15] to the center
+	constexpr std::array<unsigned int, 16> halfStripLengths = {0u, 14u, 14u, 14u, 14u, 14u, 13u, 13u, 12u, 12u, 11u, 10u, 9u, 7u, 5u, 0u};
+
+	// all strips have odd sizes and integer offsets to the center, so that all strips share the same sub-pixel location (and bilinear interpolation factors)
+	// therefore, we determine the integer moments for the four neighboring pixel-aligned patch locations and interpolate the final moments once
+
+	const Scalar left = position.x() - Scalar(0.5);
+	const Scalar top = position.y() - Scalar(0.5);
+
+	const unsigned int pixelLeft = (unsigned int)(left);
+	const unsigned int pixelTop = (unsigned int)(top);
+
+	const Scalar factorRight = left - Scalar(pixelLeft);
+	const Scalar factorBottom = top - Scalar(pixelTop);
+	ocean_assert(factorRight >= Scalar(0) && factorRight < Scalar(1));
+	ocean_assert(factorBottom >= Scalar(0) && factorBottom < Scalar(1));
+
+	const Scalar factorLeft = Scalar(1) - factorRight;
+	const Scalar factorTop = Scalar(1) - factorBottom;
+
+	// moments for the four pixel-aligned patch locations: top left, top right, bottom left, bottom right
+	int32_t moments10[4] = {0, 0, 0, 0};
+	int32_t moments01[4] = {0, 0, 0, 0};
+
+	for (unsigned int distance = 1u; distance <= 15u; ++distance)
+	{
+		const unsigned int halfLength = halfStripLengths[distance];
+		const unsigned int length = halfLength * 2u + 1u;
+
+		for (unsigned int anchorY = 0u; anchorY < 2u; ++anchorY)
+		{
+			// vertical strips with horizontal distance to the center, covering three integral columns to handle both horizontal anchors at once
+
+			const uint32_t* const verticalStripTop = linedIntegralFrame + (pixelTop + anchorY - halfLength) * linedIntegralFrameStrideElements;
+			const uint32_t* const verticalStripBottom = verticalStripTop + length * linedIntegralFrameStrideElements;
+
+			for (const int32_t sign : {1, -1})
+			{
+				const unsigned int column = pixelLeft + (unsigned int)(sign * int32_t(distance));
+
+				const uint32_t column0 = verticalStripBottom[column] - verticalStripTop[column];
+				const uint32_t column1 = verticalStripBottom[column + 1u] - verticalStripTop[column + 1u];
+				const uint32_t column2 = verticalStripBottom[column + 2u] - verticalStripTop[column + 2u];
+
+				moments10[anchorY * 2u + 0u] += sign * int32_t(distance * (column1 - column0));
+				moments10[anchorY * 2u + 1u] += sign * int32_t(distance * (column2 - column1));
+			}
+
+			// horizontal strips with vertical distance to the center
+
+			for (const int32_t sign : {1, -1})
+			{
+				const uint32_t* const horizontalStripTop = linedIntegralFrame + (pixelTop + anchorY + (unsigned int)(sign * int32_t(distance))) * linedIntegralFrameStrideElements + pixelLeft - halfLength;
+				const uint32_t* const horizontalStripBottom = horizontalStripTop + linedIntegralFrameStrideElements;
+
+				const uint32_t left0 = horizontalStripBottom[0] - horizontalStripTop[0];
+				const uint32_t left1 = horizontalStripBottom[1] - horizontalStripTop[1];
+				const uint32_t right0 = horizontalStripBottom[length] - horizontalStripTop[length];
+				const uint32_t right1 = horizontalStripBottom[length + 1u] - horizontalStripTop[length + 1u];
+
+				moments01[anchorY * 2u + 0u] += sign * int32_t(distance * (right0 - left0));
+				moments01[anchorY * 2u + 1u] += sign * int32_t(distance * (right1 - left1));
+			}
+		}
+	}
+
+	const Scalar factorTopLeft = factorTop * factorLeft;
+	const Scalar factorTopRight = factorTop * factorRight;
+	const Scalar factorBottomLeft = factorBottom * factorLeft;
+	const Scalar factorBottomRight = factorBottom * factorRight;
+
+	const Scalar m_10 = factorTopLeft * Scalar(moments10[0]) + factorTopRight * Scalar(moments10[1]) + factorBottomLeft * Scalar(moments10[2]) + factorBottomRight * Scalar(moments10[3]);
+	const Scalar m_01 = factorTopLeft * Scalar(moments01[0]) + factorTopRight * Scalar(moments01[1]) + factorBottomLeft * Scalar(moments01[2]) + factorBottomRight * Scalar(moments01[3]);
+
+	const Scalar angle = Ocean::Numeric::atan2(m_01, m_10);
 
 	return Numeric::angleAdjustPositive(angle);
 }
@@ -55,7 +55,9 @@ ORBSamplingPattern::LookupTables ORBSamplingPattern::createLookupTables(const un
 	//         (3) Step 2 was repeated until we had 256 comparison tests; the threshold was increased if we did not have 256 final test after iterating through the full sorted list
 	// These pattern is different to the pattern from openCV but provides the same quality results
 
-	const int bit_pattern_31[256 * 4] =
+	// the pattern is a compile-time table, so that it is neither initialized nor copied when the lookup tables are created
+
+	static constexpr int bit_pattern_31[256 * 4] =
 	{
 		-2, -12, 10, 13,
 		4, -3, -9, 1,
@@ -315,6 +317,28 @@ ORBSamplingPattern::LookupTables ORBSamplingPattern::createLookupTables(const un
 		-7, -10, 6, -7
 	};
 
+	static_assert([]() constexpr
+	{
+		for (size_t n = 0; n < 256; ++n)
+		{
+			for (size_t i = 0; i < 4; ++i)
+			{
+				// all locations are within the 31x31 patch around the feature point
+				if (bit_pattern_31[4 * n + i] < -15 || bit_pattern_31[4 * n + i] > 15)
+				{
+					return false;
+				}
+			}
+
+			if (bit_pattern_31[4 * n + 0] == bit_pattern_31[4 * n + 2] && bit_pattern_31[4 * n + 1] == bit_pattern_31[4 * n + 3])
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}(), "Invalid sampling pattern!");
+
 	const Scalar anglePerIncrement = Numeric::pi2() / Scalar(angleIncrements);
 
 	LookupTables lookupTables(angleIncrements);
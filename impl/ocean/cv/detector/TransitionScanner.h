@@ -0,0 +1,226 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#ifndef META_OCEAN_CV_DETECTOR_TRANSITION_SCANNER_H
+#define META_OCEAN_CV_DETECTOR_TRANSITION_SCANNER_H
+
+#include "ocean/cv/detector/Detector.h"
+
+#include "ocean/cv/NEON.h"
+#include "ocean/cv/SSE.h"
+
+#if defined(OCEAN_HARDWARE_AVX_VERSION) && OCEAN_HARDWARE_AVX_VERSION >= 20
+	#include <immintrin.h>
+#endif
+
+#include <bit>
+
+namespace Ocean
+{
+
+namespace CV
+{
+
+namespace Detector
+{
+
+/**
+ * This class implements a vectorized scanner for intensity transitions in image rows.
+ * Detectors for fiducial markers (e.g., bullseyes or the finder patterns of QR codes) scan image rows pixel by pixel and apply a transition test with a small history of intensity differences to each pixel.<br>
+ * Most pixels are located in homogeneous image regions and cannot be transitions, the scanner skips these pixels with 16 (SSE, NEON) or 32 (AVX2) pixels per iteration.<br>
+ * The scanner applies a necessary condition only, each returned candidate still needs to be verified with the detector's own transition test.
+ * @ingroup cvdetector
+ */
+class OCEAN_CV_DETECTOR_EXPORT TransitionScanner
+{
+	public:
+
+		/**
+		 * Returns the first pixel in a row which may be a transition, all pixels between the start location and the returned location are ensured not to be transitions.
+		 * A pixel `x` may be a transition to dark if `row[x - k] - row[x] > minimalDelta` for at least one `k` in [1, tWindow], and a transition to bright if `row[x] - row[x - k] > minimalDelta`.
+		 * @param row The image row to scan, must be valid
+		 * @param x The horizontal location at which the scan starts, with range [tWindow, infinity)
+		 * @param width The width of the row, in pixels, with range [1, infinity)
+		 * @param minimalDelta The minimal intensity difference a transition must exceed, with range [0, 254]
+		 * @return The location of the first candidate, with range [x, width], `width` if the row does not contain any candidate
+		 * @tparam tTransitionToDark True, to scan for transitions from bright to dark pixels; False, to scan for transitions from dark to bright pixels
+		 * @tparam tWindow The number of preceding pixels which are compared with each pixel, with range [1, 8]
+		 */
+		template <bool tTransitionToDark, unsigned int tWindow>
+		static inline unsigned int findCandidate(const uint8_t* const row, unsigned int x, const unsigned int width, const uint8_t minimalDelta);
+
+	protected:
+
+		/**
+		 * Returns whether a single pixel may be a transition.
+		 * @param pixel The pixel to check, with `tWindow` valid preceding pixels, must be valid
+		 * @param minimalDelta The minimal intensity difference a transition must exceed, with range [0, 254]
+		 * @return True, if so
+		 * @tparam tTransitionToDark True, to check for a transition from a bright to a dark pixel; False, to check for a transition from a dark to a bright pixel
+		 * @tparam tWindow The number of preceding pixels which are compared with the pixel, with range [1, 8]
+		 */
+		template <bool tTransitionToDark, unsigned int tWindow>
+		static inline bool isCandidate(const uint8_t* const pixel, const uint8_t minimalDelta);
+};
+
+template <bool tTransitionToDark, unsigned int tWindow>
+inline unsigned int TransitionScanner::findCandidate(const uint8_t* const row, unsigned int x, const unsigned int width, const uint8_t minimalDelta)
+{
+	static_assert(tWindow >= 1u && tWindow <= 8u, "Invalid window size!");
+
+	ocean_assert(row != nullptr);
+	ocean_assert(x >= tWindow);
+	ocean_assert(minimalDelta <= 254u);
+
+#if defined(OCEAN_HARDWARE_AVX_VERSION) && OCEAN_HARDWARE_AVX_VERSION >= 20
+
+	const __m256i minimalDelta_u_8x32 = _mm256_set1_epi8(char(minimalDelta));
+
+	while (x + 32u <= width)
+	{
+		const __m256i pixels_u_8x32 = _mm256_lddqu_si256((const __m256i*)(row + x));
+
+		// the extreme intensity of all preceding pixels within the window (the maximum for transitions to dark, the minimum for transitions to bright)
+
+		__m256i extremes_u_8x32 = _mm256_lddqu_si256((const __m256i*)(row + x - 1u));
+
+		for (unsigned int k = 2u; k <= tWindow; ++k)
+		{
+			const __m256i preceding_u_8x32 = _mm256_lddqu_si256((const __m256i*)(row + x - k));
+
+			extremes_u_8x32 = tTransitionToDark ? _mm256_max_epu8(extremes_u_8x32, preceding_u_8x32) : _mm256_min_epu8(extremes_u_8x32, preceding_u_8x32);
+		}
+
+		const __m256i differences_u_8x32 = tTransitionToDark ? _mm256_subs_epu8(extremes_u_8x32, pixels_u_8x32) : _mm256_subs_epu8(pixels_u_8x32, extremes_u_8x32);
+
+		// differences > minimalDelta <=> (differences -sat minimalDelta) != 0
+
+		const __m256i notCandidates_u_8x32 = _mm256_cmpeq_epi8(_mm256_subs_epu8(differences_u_8x32, minimalDelta_u_8x32), _mm256_setzero_si256());
+
+		const uint32_t candidateMask = ~uint32_t(_mm256_movemask_epi8(notCandidates_u_8x32));
+
+		if (candidateMask != 0u)
+		{
+			return x + (unsigned int)(std::countr_zero(candidateMask));
+		}
+
+		x += 32u;
+	}
+
+#endif // OCEAN_HARDWARE_AVX_VERSION >= 20
+
+#if defined(OCEAN_HARDWARE_SSE_VERSION) && OCEAN_HARDWARE_SSE_VERSION >= 41
+
+	const __m128i minimalDelta_u_8x16 = _mm_set1_epi8(char(minimalDelta));
+
+	while (x + 16u <= width)
+	{
+		const __m128i pixels_u_8x16 = _mm_lddqu_si128((const __m128i*)(row + x));
+
+		__m128i extremes_u_8x16 = _mm_lddqu_si128((const __m128i*)(row + x - 1u));
+
+		for (unsigned int k = 2u; k <= tWindow; ++k)
+		{
+			const __m128i preceding_u_8x16 = _mm_lddqu_si128((const __m128i*)(row + x - k));
+
+			extremes_u_8x16 = tTransitionToDark ? _mm_max_epu8(extremes_u_8x16, preceding_u_8x16) : _mm_min_epu8(extremes_u_8x16, preceding_u_8x16);
+		}
+
+		const __m128i differences_u_8x16 = tTransitionToDark ? _mm_subs_epu8(extremes_u_8x16, pixels_u_8x16) : _mm_subs_epu8(pixels_u_8x16, extremes_u_8x16);
+
+		const __m128i notCandidates_u_8x16 = _mm_cmpeq_epi8(_mm_subs_epu8(differences_u_8x16, minimalDelta_u_8x16), _mm_setzero_si128());
+
+		const uint32_t candidateMask = ~uint32_t(_mm_movemask_epi8(notCandidates_u_8x16)) & 0xFFFFu;
+
+		if (candidateMask != 0u)
+		{
+			return x + (unsigned int)(std::countr_zero(candidateMask));
+		}
+
+		x += 16u;
+	}
+
+#elif defined(OCEAN_HARDWARE_NEON_VERSION) && OCEAN_HARDWARE_NEON_VERSION >= 10
+
+	const uint8x16_t minimalDelta_u_8x16 = vdupq_n_u8(minimalDelta);
+
+	while (x + 16u <= width)
+	{
+		const uint8x16_t pixels_u_8x16 = vld1q_u8(row + x);
+
+		uint8x16_t extremes_u_8x16 = vld1q_u8(row + x - 1u);
+
+		for (unsigned int k = 2u; k <= tWindow; ++k)
+		{
+			const uint8x16_t preceding_u_8x16 = vld1q_u8(row + x - k);
+
+			extremes_u_8x16 = tTransitionToDark ? vmaxq_u8(extremes_u_8x16, preceding_u_8x16) : vminq_u8(extremes_u_8x16, preceding_u_8x16);
+		}
+
+		const uint8x16_t differences_u_8x16 = tTransitionToDark ? vqsubq_u8(extremes_u_8x16, pixels_u_8x16) : vqsubq_u8(pixels_u_8x16, extremes_u_8x16);
+
+		// 0xFF for each candidate, 0x00 otherwise
+
+		const uint64x2_t candidates_u_64x2 = vreinterpretq_u64_u8(vcgtq_u8(differences_u_8x16, minimalDelta_u_8x16));
+
+		const uint64_t lowCandidates = vgetq_lane_u64(candidates_u_64x2, 0);
+
+		if (lowCandidates != 0ull)
+		{
+			return x + (unsigned int)(std::countr_zero(lowCandidates)) / 8u;
+		}
+
+		const uint64_t highCandidates = vgetq_lane_u64(candidates_u_64x2, 1);
+
+		if (highCandidates != 0ull)
+		{
+			return x + 8u + (unsigned int)(std::countr_zero(highCandidates)) / 8u;
+		}
+
+		x += 16u;
+	}
+
+#endif // OCEAN_HARDWARE_NEON_VERSION >= 10
+
+	while (x < width)
+	{
+		if (isCandidate<tTransitionToDark, tWindow>(row + x, minimalDelta))
+		{
+			return x;
+		}
+
+		++x;
+	}
+
+	return width;
+}
+
+template <bool tTransitionToDark, unsigned int tWindow>
+inline bool TransitionScanner::isCandidate(const uint8_t* const pixel, const uint8_t minimalDelta)
+{
+	ocean_assert(pixel != nullptr);
+
+	for (unsigned int k = 1u; k <= tWindow; ++k)
+	{
+		const int difference = tTransitionToDark ? int(*(pixel - k)) - int(*pixel) : int(*pixel) - int(*(pixel - k));
+
+		if (difference > int(minimalDelta))
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+}
+
+}
+
+}
+
+#endif // META_OCEAN_CV_DETECTOR_TRANSITION_SCANNER_H
@@ -229,10 +229,7 @@ void BullseyeDetectorMono::detectBullseyesInRow(const Frame& yFrame, const unsig
 	// start segment 1: we search for the start of the first black segment (with white pixel to the left)
 
 	TransitionHistory history;
-	while (x < width && !TransitionHistory::isTransitionToBlack(yRow + x, history))
-	{
-		++x;
-	}
+	x = TransitionHistory::findTransitionToBlack(yRow, x, width, history);
 
 	if (x == width)
 	{
@@ -248,10 +245,7 @@ void BullseyeDetectorMono::detectBullseyesInRow(const Frame& yFrame, const unsig
 		if (segment_2_start_white == (unsigned int)(-1))
 		{
 			history.reset();
-			while (x < width && !TransitionHistory::isTransitionToWhite(yRow + x, history))
-			{
-				++x;
-			}
+			x = TransitionHistory::findTransitionToWhite(yRow, x, width, history);
 
 			if (x == width)
 			{
@@ -271,10 +265,7 @@ void BullseyeDetectorMono::detectBullseyesInRow(const Frame& yFrame, const unsig
 		// start segment 3: we search for the start of the second black segment (the center dot)
 
 		history.reset();
-		while (x < width && !TransitionHistory::isTransitionToBlack(yRow + x, history))
-		{
-			++x;
-		}
+		x = TransitionHistory::findTransitionToBlack(yRow, x, width, history);
 
 		if (x == width)
 		{
@@ -310,10 +301,7 @@ void BullseyeDetectorMono::detectBullseyesInRow(const Frame& yFrame, const unsig
 		// start segment 4: we search for the start of the second white segment
 
 		history.reset();
-		while (x < width && !TransitionHistory::isTransitionToWhite(yRow + x, history))
-		{
-			++x;
-		}
+		x = TransitionHistory::findTransitionToWhite(yRow, x, width, history);
 
 		if (x == width)
 		{
@@ -352,10 +340,7 @@ void BullseyeDetectorMono::detectBullseyesInRow(const Frame& yFrame, const unsig
 		// start segment 5: we search for the start of the last black segment
 
 		history.reset();
-		while (x < width && !TransitionHistory::isTransitionToBlack(yRow + x, history))
-		{
-			++x;
-		}
+		x = TransitionHistory::findTransitionToBlack(yRow, x, width, history);
 
 		if (x == width)
 		{
@@ -400,10 +385,7 @@ void BullseyeDetectorMono::detectBullseyesInRow(const Frame& yFrame, const unsig
 		// start 'segment 6': we search for the start of the next white segment (the end of the last black segment + 1 pixel)
 
 		history.reset();
-		while (x < width && !TransitionHistory::isTransitionToWhite(yRow + x, history))
-		{
-			++x;
-		}
+		x = TransitionHistory::findTransitionToWhite(yRow, x, width, history);
 
 		if (x == width)
 		{
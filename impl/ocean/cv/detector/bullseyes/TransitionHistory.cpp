@@ -7,6 +7,8 @@
 
 #include "ocean/cv/detector/bullseyes/TransitionHistory.h"
 
+#include "ocean/cv/detector/TransitionScanner.h"
+
 namespace Ocean
 {
 
@@ -96,6 +98,79 @@ bool TransitionHistory::isTransitionToWhite(const uint8_t* pixel, TransitionHist
 	return result;
 }
 
+unsigned int TransitionHistory::findTransitionToBlack(const uint8_t* row, unsigned int x, const unsigned int width, TransitionHistory& history, const int deltaThreshold)
+{
+	return findTransition<true>(row, x, width, history, deltaThreshold);
+}
+
+unsigned int TransitionHistory::findTransitionToWhite(const uint8_t* row, unsigned int x, const unsigned int width, TransitionHistory& history, const int deltaThreshold)
+{
+	return findTransition<false>(row, x, width, history, deltaThreshold);
+}
+
+void TransitionHistory::setFromPixels(const uint8_t* pixel)
+{
+	ocean_assert(pixel != nullptr);
+
+	deltaMinus1 = int(*(pixel - 1) - *(pixel - 2));
+	deltaMinus2 = int(*(pixel - 2) - *(pixel - 3));
+	deltaMinus3 = int(*(pixel - 3) - *(pixel - 4));
+}
+
+template <bool tTransitionToBlack>
+unsigned int TransitionHistory::findTransition(const uint8_t* row, unsigned int x, const unsigned int width, TransitionHistory& history, const int deltaThreshold)
+{
+	ocean_assert(row != nullptr);
+	ocean_assert(x >= 1u);
+	ocean_assert(deltaThreshold >= 0);
+
+	// the first three pixels after a reset are tested with an incomplete history, so that they are checked pixel by pixel
+
+	const unsigned int xIncompleteHistoryEnd = std::min(x + 3u, width);
+
+	while (x < xIncompleteHistoryEnd)
+	{
+		if (tTransitionToBlack ? isTransitionToBlack(row + x, history, deltaThreshold) : isTransitionToWhite(row + x, history, deltaThreshold))
+		{
+			return x;
+		}
+
+		++x;
+	}
+
+	// all thresholds are at least 'deltaThreshold' and the accumulated history telescopes to the intensity difference to one of the four preceding pixels,
+	// so that a pixel can only be a transition if the intensity difference to one of these pixels exceeds 'deltaThreshold'
+
+	const uint8_t minimalDelta = uint8_t(std::min(deltaThreshold, 254));
+
+	while (x < width)
+	{
+		const unsigned int xCandidate = TransitionScanner::findCandidate<tTransitionToBlack, 4u>(row, x, width, minimalDelta);
+
+		if (xCandidate >= width)
+		{
+			return width;
+		}
+
+		if (xCandidate != x)
+		{
+			// the skipped pixels would have been pushed to the history
+			history.setFromPixels(row + xCandidate);
+
+			x = xCandidate;
+		}
+
+		if (tTransitionToBlack ? isTransitionToBlack(row + x, history, deltaThreshold) : isTransitionToWhite(row + x, history, deltaThreshold))
+		{
+			return x;
+		}
+
+		++x;
+	}
+
+	return width;
+}
+
 } // namespace Bullseyes
 
 } // namespace Detector
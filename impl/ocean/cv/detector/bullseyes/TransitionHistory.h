@@ -85,6 +85,32 @@ class OCEAN_CV_DETECTOR_BULLSEYES_EXPORT TransitionHistory
 		 */
 		static bool isTransitionToWhite(const uint8_t* pixel, TransitionHistory& history, const int deltaThreshold = defaultDeltaThreshold());
 
+		/**
+		 * Finds the next transition-to-black pixel in a row, starting at a given location.
+		 * The function provides the same result as calling isTransitionToBlack() for each pixel but skips homogeneous pixels with SIMD instructions.<br>
+		 * The history must have been reset before the scan starts, once a transition has been found the history is identical to the history of the pixel-by-pixel scan.
+		 * @param row The image row to scan, must be valid
+		 * @param x The horizontal location at which the scan starts, with range [1, width)
+		 * @param width The width of the row, in pixels, with range [1, infinity)
+		 * @param history The history object, reset before the scan starts
+		 * @param deltaThreshold The intensity difference threshold between successive pixels to count as a transition, with range [0, 255]
+		 * @return The location of the transition, with range [x, width), `width` if the row does not contain a transition
+		 */
+		static unsigned int findTransitionToBlack(const uint8_t* row, unsigned int x, const unsigned int width, TransitionHistory& history, const int deltaThreshold = defaultDeltaThreshold());
+
+		/**
+		 * Finds the next transition-to-white pixel in a row, starting at a given location.
+		 * The function provides the same result as calling isTransitionToWhite() for each pixel but skips homogeneous pixels with SIMD instructions.<br>
+		 * The history must have been reset before the scan starts, once a transition has been found the history is identical to the history of the pixel-by-pixel scan.
+		 * @param row The image row to scan, must be valid
+		 * @param x The horizontal location at which the scan starts, with range [1, width)
+		 * @param width The width of the row, in pixels, with range [1, infinity)
+		 * @param history The history object, reset before the scan starts
+		 * @param deltaThreshold The intensity difference threshold between successive pixels to count as a transition, with range [0, 255]
+		 * @return The location of the transition, with range [x, width), `width` if the row does not contain a transition
+		 */
+		static unsigned int findTransitionToWhite(const uint8_t* row, unsigned int x, const unsigned int width, TransitionHistory& history, const int deltaThreshold = defaultDeltaThreshold());
+
 		/**
 		 * Returns the default intensity threshold between two successive pixels to count as a transition from black to white (or vice versa).
 		 * The delta (intensity difference) is computed as the absolute difference between adjacent pixel intensities.
@@ -94,6 +120,25 @@ class OCEAN_CV_DETECTOR_BULLSEYES_EXPORT TransitionHistory
 
 	protected:
 
+		/**
+		 * Sets the history to the intensity differences of the three pixels preceding a given pixel.
+		 * @param pixel The pixel for which the history will be set, with at least four valid preceding pixels, must be valid
+		 */
+		void setFromPixels(const uint8_t* pixel);
+
+		/**
+		 * Finds the next transition pixel in a row.
+		 * @param row The image row to scan, must be valid
+		 * @param x The horizontal location at which the scan starts, with range [1, width)
+		 * @param width The width of the row, in pixels, with range [1, infinity)
+		 * @param history The history object, reset before the scan starts
+		 * @param deltaThreshold The intensity difference threshold between successive pixels to count as a transition, with range [0, 255]
+		 * @return The location of the transition, with range [x, width), `width` if the row does not contain a transition
+		 * @tparam tTransitionToBlack True, to find a transition-to-black pixel; False, to find a transition-to-white pixel
+		 */
+		template <bool tTransitionToBlack>
+		static unsigned int findTransition(const uint8_t* row, unsigned int x, const unsigned int width, TransitionHistory& history, const int deltaThreshold);
+
 		/// The previous intensity difference (delta) between adjacent pixels, with range [-255, 255]
 		int deltaMinus1 = 0;
 
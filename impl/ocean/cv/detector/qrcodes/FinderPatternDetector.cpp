@@ -7,6 +7,8 @@
 
 #include "ocean/cv/detector/qrcodes/FinderPatternDetector.h"
 
+#include "ocean/cv/FrameShrinker.h"
+
 namespace Ocean
 {
 
@@ -32,10 +34,14 @@ FinderPatterns FinderPatternDetector::detectFinderPatterns(const uint8_t* const
 	FinderPatterns finderPatterns;
 	finderPatterns.reserve(15);
 
-	if (worker && height >= 600u)
+	// each thread needs to scan a reasonable number of rows to compensate the overhead of merging the results
+
+	constexpr unsigned int minimalRowsPerThread = 40u;
+
+	if (worker && height - 14u >= minimalRowsPerThread * 2u)
 	{
 		Lock multiThreadLock;
-		worker->executeFunction(Worker::Function::createStatic(&detectFinderPatternsSubset, yFrame, width, height, &finderPatterns, &multiThreadLock, paddingElements, 0u, 0u), 7u, height - 14u, 6u, 7u);
+		worker->executeFunction(Worker::Function::createStatic(&detectFinderPatternsSubset, yFrame, width, height, &finderPatterns, &multiThreadLock, paddingElements, 0u, 0u), 7u, height - 14u, 6u, 7u, minimalRowsPerThread);
 	}
 	else
 	{
@@ -80,6 +86,134 @@ FinderPatterns FinderPatternDetector::detectFinderPatterns(const uint8_t* const
 	return finderPatterns;
 }
 
+FinderPatterns FinderPatternDetector::detectFinderPatternsInSubRegion(const uint8_t* const yFrame, const unsigned int width, const unsigned int height, const CV::PixelBoundingBox& subRegion, const unsigned int minimumDistance, const unsigned int paddingElements, Worker* worker)
+{
+	ocean_assert(yFrame != nullptr);
+	ocean_assert(subRegion.isValid());
+
+	if (width < 15u || height < 15u || !subRegion.isValid())
+	{
+		return FinderPatterns();
+	}
+
+	const CV::PixelBoundingBox clippedSubRegion = subRegion && CV::PixelBoundingBox(0u, 0u, width - 1u, height - 1u);
+
+	if (!clippedSubRegion.isValid() || clippedSubRegion.width() < 15u || clippedSubRegion.height() < 15u)
+	{
+		return FinderPatterns();
+	}
+
+	const unsigned int yFrameStrideElements = width + paddingElements;
+
+	// the sub-region is handled as an individual image with (larger) padding
+
+	const uint8_t* const ySubFrame = yFrame + clippedSubRegion.top() * yFrameStrideElements + clippedSubRegion.left();
+	const unsigned int subFramePaddingElements = yFrameStrideElements - clippedSubRegion.width();
+
+	FinderPatterns finderPatterns = detectFinderPatterns(ySubFrame, clippedSubRegion.width(), clippedSubRegion.height(), minimumDistance, subFramePaddingElements, worker);
+
+	const Vector2 offset(Scalar(clippedSubRegion.left()), Scalar(clippedSubRegion.top()));
+
+	for (FinderPattern& finderPattern : finderPatterns)
+	{
+		finderPattern.translate(offset);
+	}
+
+	return finderPatterns;
+}
+
+FinderPatterns FinderPatternDetector::detectFinderPatternsCoarseToFine(const uint8_t* const yFrame, const unsigned int width, const unsigned int height, const unsigned int minimumDistance, const unsigned int paddingElements, Worker* worker)
+{
+	ocean_assert(yFrame != nullptr);
+
+	if (width < 30u || height < 30u)
+	{
+		// the down-sampled image would be too small, so that we scan the image directly
+		return detectFinderPatterns(yFrame, width, height, minimumDistance, paddingElements, worker);
+	}
+
+	Frame yCoarseFrame(FrameType(width / 2u, height / 2u, FrameType::FORMAT_Y8, FrameType::ORIGIN_UPPER_LEFT));
+	CV::FrameShrinker::downsampleByTwo8BitPerChannel11(yFrame, yCoarseFrame.data<uint8_t>(), width, height, 1u, paddingElements, yCoarseFrame.paddingElements(), worker);
+
+	const FinderPatterns coarseFinderPatterns = detectFinderPatterns(yCoarseFrame.constdata<uint8_t>(), yCoarseFrame.width(), yCoarseFrame.height(), std::max(1u, minimumDistance / 2u), yCoarseFrame.paddingElements(), worker);
+
+	if (coarseFinderPatterns.size() < 3)
+	{
+		// the down-sampled image does not contain enough finder patterns for one code, the code may be too small for the down-sampled image
+		return detectFinderPatterns(yFrame, width, height, minimumDistance, paddingElements, worker);
+	}
+
+	FinderPatterns finderPatterns;
+	finderPatterns.reserve(coarseFinderPatterns.size());
+
+	for (const FinderPattern& coarseFinderPattern : coarseFinderPatterns)
+	{
+		// the sub-region must contain the entire finder pattern including a quiet zone of some pixels in each direction
+
+		const Vector2 position = coarseFinderPattern.position() * Scalar(2);
+		const Scalar radius = coarseFinderPattern.length() * Scalar(2) + Scalar(10);
+
+		const int left = Numeric::round32(position.x() - radius);
+		const int top = Numeric::round32(position.y() - radius);
+		const int right = Numeric::round32(position.x() + radius);
+		const int bottom = Numeric::round32(position.y() + radius);
+
+		if (right < 0 || bottom < 0 || left >= int(width) || top >= int(height))
+		{
+			continue;
+		}
+
+		const CV::PixelBoundingBox subRegion((unsigned int)(std::max(0, left)), (unsigned int)(std::max(0, top)), (unsigned int)(std::min(right, int(width) - 1)), (unsigned int)(std::min(bottom, int(height) - 1)));
+
+		// the sub-regions are small, so that we do not use the worker for them
+
+		FinderPatterns subRegionFinderPatterns = detectFinderPatternsInSubRegion(yFrame, width, height, subRegion, minimumDistance, paddingElements, nullptr);
+
+		finderPatterns.insert(finderPatterns.end(), subRegionFinderPatterns.begin(), subRegionFinderPatterns.end());
+	}
+
+	// the sub-regions of neighboring finder patterns may overlap
+
+	removeCloseFinderPatterns(finderPatterns, minimumDistance);
+
+	return finderPatterns;
+}
+
+void FinderPatternDetector::removeCloseFinderPatterns(FinderPatterns& finderPatterns, const unsigned int minimumDistance)
+{
+	std::sort(finderPatterns.begin(), finderPatterns.end(), FinderPattern::comesBefore);
+
+	const Scalar sqrMinimumDistance = Numeric::sqr(Scalar(minimumDistance));
+
+	FinderPatterns filteredFinderPatterns;
+	filteredFinderPatterns.reserve(finderPatterns.size());
+
+	for (const FinderPattern& finderPattern : finderPatterns)
+	{
+		bool foundClosePosition = false;
+
+		for (size_t n = 0; !foundClosePosition && n < filteredFinderPatterns.size(); ++n)
+		{
+			if (finderPattern.position().sqrDistance(filteredFinderPatterns[n].position()) < sqrMinimumDistance)
+			{
+				if (finderPattern.symmetryScore() < filteredFinderPatterns[n].symmetryScore())
+				{
+					filteredFinderPatterns[n] = finderPattern;
+				}
+
+				foundClosePosition = true;
+			}
+		}
+
+		if (!foundClosePosition)
+		{
+			filteredFinderPatterns.push_back(finderPattern);
+		}
+	}
+
+	finderPatterns = std::move(filteredFinderPatterns);
+}
+
 void FinderPatternDetector::detectFinderPatternsSubset(const uint8_t* const yFrame, const unsigned int width, const unsigned int height, FinderPatterns* finderPatterns, Lock* multiThreadLock, const unsigned int paddingElements, const unsigned int firstRow, const unsigned int numberRows)
 {
 	ocean_assert(yFrame != nullptr);
@@ -131,10 +265,7 @@ void FinderPatternDetector::detectFinderPatternInRow(const uint8_t* const yFrame
 	// Start segment 1: find the first pixel of the first black segment
 
 	TransitionHistory history;
-	while (x < width && isTransitionToBlack(yRow + x, history) == false)
-	{
-		++x;
-	}
+	x = findTransition<true>(yRow, x, width, history);
 
 	if (x >= width)
 	{
@@ -150,10 +281,7 @@ void FinderPatternDetector::detectFinderPatternInRow(const uint8_t* const yFrame
 		if (segment_2_start_white == invalidSegmentStart)
 		{
 			history.reset();
-			while (x < width && isTransitionToWhite(yRow + x, history) == false)
-			{
-				++x;
-			}
+			x = findTransition<false>(yRow, x, width, history);
 
 			if (x >= width)
 			{
@@ -173,10 +301,7 @@ void FinderPatternDetector::detectFinderPatternInRow(const uint8_t* const yFrame
 		// Start segment 3: find the first pixel of the second black segment (the big black square in the middle)
 
 		history.reset();
-		while (x < width && isTransitionToBlack(yRow + x, history) == false)
-		{
-			++x;
-		}
+		x = findTransition<true>(yRow, x, width, history);
 
 		if (x >= width)
 		{
@@ -212,10 +337,7 @@ void FinderPatternDetector::detectFinderPatternInRow(const uint8_t* const yFrame
 		// Start segment 4: find the first pixel of the second white segment
 
 		history.reset();
-		while (x < width && isTransitionToWhite(yRow + x, history) == false)
-		{
-			++x;
-		}
+		x = findTransition<false>(yRow, x, width, history);
 
 		if (x >= width)
 		{
@@ -254,10 +376,7 @@ void FinderPatternDetector::detectFinderPatternInRow(const uint8_t* const yFrame
 		// Start segment 5: find the first pixel of the third black segment
 
 		history.reset();
-		while (x < width && isTransitionToBlack(yRow + x, history) == false)
-		{
-			++x;
-		}
+		x = findTransition<true>(yRow, x, width, history);
 
 		if (x == width)
 		{
@@ -304,10 +423,7 @@ void FinderPatternDetector::detectFinderPatternInRow(const uint8_t* const yFrame
 		// Start "segment 6": find the beginning of next white segment
 
 		history.reset();
-		while (x < width && isTransitionToWhite(yRow + x, history) == false)
-		{
-			++x;
-		}
+		x = findTransition<false>(yRow, x, width, history);
 
 		if (x == width)
 		{
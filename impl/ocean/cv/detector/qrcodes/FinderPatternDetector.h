@@ -12,10 +12,13 @@
 #include "ocean/cv/detector/qrcodes/QRCodeEncoder.h"
 #include "ocean/cv/detector/qrcodes/TransitionDetector.h"
 
+#include "ocean/cv/detector/TransitionScanner.h"
+
 #include "ocean/base/Frame.h"
 #include "ocean/base/Memory.h"
 
 #include "ocean/cv/Bresenham.h"
+#include "ocean/cv/PixelBoundingBox.h"
 
 #include "ocean/geometry/Homography.h"
 
@@ -146,6 +149,12 @@ class FinderPattern
 		 */
 		inline bool isNormalReflectance() const;
 
+		/**
+		 * Translates the location of this finder pattern (center and corners), e.g., to convert a finder pattern from a sub-image to the entire image.
+		 * @param offset The offset to be added to the location, in pixels
+		 */
+		inline void translate(const Vector2& offset);
+
 		/**
 		 * Comparator to sort finder patterns based on their location in an image
 		 * Pattern `a` comes before pattern `b` if (pseudo-code) `a.y * imageWidth + a.x < b.y * imageWidth + b.x`
@@ -262,6 +271,12 @@ class OCEAN_CV_DETECTOR_QRCODES_EXPORT FinderPatternDetector
 				*/
 				inline void reset();
 
+				/**
+				* Sets the history to the deltas of the five pixels preceding a given pixel, as if all preceding pixels had been pushed.
+				* @param pixel The pixel for which the history will be set, with at least six valid preceding pixels, must be valid
+				*/
+				inline void setFromPixels(const uint8_t* pixel);
+
 			protected:
 
 				/// The most recent deltas.
@@ -282,6 +297,43 @@ class OCEAN_CV_DETECTOR_QRCODES_EXPORT FinderPatternDetector
 		 */
 		static FinderPatterns detectFinderPatterns(const uint8_t* const yFrame, const unsigned int width, const unsigned int height, const unsigned int minimumDistance = 10u, const unsigned int paddingElements = 0u, Worker* worker = nullptr);
 
+		/**
+		 * Detects finder patterns of a QR code in a sub-region of a 8 bit grayscale image.
+		 * The sub-region is scanned the same way as an entire image, the resulting finder patterns are provided in the coordinate system of the entire image.
+		 * @param yFrame The 8 bit grayscale frame in which the finder patterns will be detected, must be valid
+		 * @param width The width of the given grayscale frame in pixel, with range [15, infinity)
+		 * @param height The height of the given grayscale frame in pixel, with range [15, infinity)
+		 * @param subRegion The sub-region in which the finder patterns will be detected, will be clipped to the frame, must be valid
+		 * @param minimumDistance The minimum distance in pixels that is enforced between any pair of finder patterns, range: [0, infinity), default: 10
+		 * @param paddingElements Optional number of padding elements at the end of each image row, in elements, with range [0, infinity), default: 0
+		 * @param worker Optional worker to distribute the computation
+		 * @return The detected finder patterns, empty if the clipped sub-region is smaller than 15 x 15 pixels
+		 */
+		static FinderPatterns detectFinderPatternsInSubRegion(const uint8_t* const yFrame, const unsigned int width, const unsigned int height, const CV::PixelBoundingBox& subRegion, const unsigned int minimumDistance = 10u, const unsigned int paddingElements = 0u, Worker* worker = nullptr);
+
+		/**
+		 * Detects finder patterns of a QR code in a 8 bit grayscale image with a coarse-to-fine strategy.
+		 * The finder patterns are detected in a down-sampled (by two) version of the image first, each coarse finder pattern is then re-detected in a small sub-region of the full-resolution image.<br>
+		 * This is significantly faster than detectFinderPatterns() for large images, however, finder patterns with modules smaller than approx. five pixels (in the full-resolution image) may be missed.<br>
+		 * In case less than three finder patterns are found in the down-sampled image (not enough for one QR code), the full-resolution image is scanned instead.
+		 * @param yFrame The 8 bit grayscale frame in which the finder patterns will be detected, must be valid
+		 * @param width The width of the given grayscale frame in pixel, with range [15, infinity)
+		 * @param height The height of the given grayscale frame in pixel, with range [15, infinity)
+		 * @param minimumDistance The minimum distance in pixels that is enforced between any pair of finder patterns, range: [0, infinity), default: 10
+		 * @param paddingElements Optional number of padding elements at the end of each image row, in elements, with range [0, infinity), default: 0
+		 * @param worker Optional worker to distribute the computation
+		 * @return The detected finder patterns
+		 * @see detectFinderPatterns().
+		 */
+		static FinderPatterns detectFinderPatternsCoarseToFine(const uint8_t* const yFrame, const unsigned int width, const unsigned int height, const unsigned int minimumDistance = 10u, const unsigned int paddingElements = 0u, Worker* worker = nullptr);
+
+		/**
+		 * Removes finder patterns which are too close to each other, from each group of close finder patterns the one with the best symmetry score is kept.
+		 * @param finderPatterns The finder patterns to filter, will be sorted with FinderPattern::comesBefore()
+		 * @param minimumDistance The minimum distance in pixels that is enforced between any pair of finder patterns, range: [0, infinity)
+		 */
+		static void removeCloseFinderPatterns(FinderPatterns& finderPatterns, const unsigned int minimumDistance);
+
 		/**
 		 * Extract 3-tuples of finder patterns that form good (plausible) candidates for QR code symbols
 		 * @param finderPatterns The list finder patterns in which 3-tuples forming potential QR code symbols are sought, must be valid, minimum size: 3
@@ -405,6 +457,19 @@ class OCEAN_CV_DETECTOR_QRCODES_EXPORT FinderPatternDetector
 		 */
 		static inline bool isTransitionToWhite(const uint8_t* pixel, TransitionHistory& history);
 
+		/**
+		 * Finds the next transition pixel in a row, with the same result as calling isTransitionToBlack() or isTransitionToWhite() for each pixel.
+		 * Homogeneous pixels are skipped with SIMD instructions, the history must have been reset before the scan starts.
+		 * @param row The image row to scan, must be valid
+		 * @param x The horizontal location at which the scan starts, with range [1, width)
+		 * @param width The width of the row, in pixels, with range [1, infinity)
+		 * @param history The history object, reset before the scan starts
+		 * @return The location of the transition, with range [x, width), `width` if the row does not contain a transition
+		 * @tparam tTransitionToBlack True, to find a transition-to-black pixel; False, to find a transition-to-white pixel
+		 */
+		template <bool tTransitionToBlack>
+		static inline unsigned int findTransition(const uint8_t* row, unsigned int x, const unsigned int width, TransitionHistory& history);
+
 		/**
 		 * Determines the gray threshold separating bright pixels form dark pixels.
 		 * The threshold is based on already actual pixel values for which the association is known already.<br>
@@ -550,6 +615,19 @@ inline bool FinderPattern::isNormalReflectance() const
 	return TransitionDetector::isBlack(centerIntensity_, grayThreshold_);
 }
 
+inline void FinderPattern::translate(const Vector2& offset)
+{
+	position_ += offset;
+
+	if (cornersKnown_)
+	{
+		for (Vector2& corner : corners_)
+		{
+			corner += offset;
+		}
+	}
+}
+
 inline bool FinderPattern::comesBefore(const FinderPattern& first, const FinderPattern& second)
 {
 	return first.position().y() > second.position().y() || (first.position().y() == second.position().y() && first.position().x() > second.position().x());
@@ -604,6 +682,16 @@ inline void FinderPatternDetector::TransitionHistory::reset()
 	deltas_[4] = 0;
 }
 
+inline void FinderPatternDetector::TransitionHistory::setFromPixels(const uint8_t* pixel)
+{
+	ocean_assert(pixel != nullptr);
+
+	for (unsigned int n = 0u; n < 5u; ++n)
+	{
+		deltas_[n] = int(*(pixel - n - 1u) - *(pixel - n - 2u));
+	}
+}
+
 inline bool FinderPatternDetector::isTransitionToBlack(const uint8_t* pixel, TransitionHistory& history)
 {
 	const int currentDelta = int(*(pixel + 0) - *(pixel - 1));
@@ -652,6 +740,57 @@ inline bool FinderPatternDetector::isTransitionToWhite(const uint8_t* pixel, Tra
 	return result;
 }
 
+template <bool tTransitionToBlack>
+inline unsigned int FinderPatternDetector::findTransition(const uint8_t* row, unsigned int x, const unsigned int width, TransitionHistory& history)
+{
+	ocean_assert(row != nullptr);
+	ocean_assert(x >= 1u);
+
+	// the first five pixels after a reset are tested with an incomplete history, so that they are checked pixel by pixel
+
+	const unsigned int xIncompleteHistoryEnd = std::min(x + 5u, width);
+
+	while (x < xIncompleteHistoryEnd)
+	{
+		if (tTransitionToBlack ? isTransitionToBlack(row + x, history) : isTransitionToWhite(row + x, history))
+		{
+			return x;
+		}
+
+		++x;
+	}
+
+	// the accumulated history telescopes to the intensity difference to one of the six preceding pixels and all thresholds are at least 'deltaThreshold',
+	// so that a pixel can only be a transition if the intensity difference to one of these pixels exceeds 'deltaThreshold'
+
+	while (x < width)
+	{
+		const unsigned int xCandidate = TransitionScanner::findCandidate<tTransitionToBlack, 6u>(row, x, width, uint8_t(deltaThreshold));
+
+		if (xCandidate >= width)
+		{
+			return width;
+		}
+
+		if (xCandidate != x)
+		{
+			// the skipped pixels would have been pushed to the history
+			history.setFromPixels(row + xCandidate);
+
+			x = xCandidate;
+		}
+
+		if (tTransitionToBlack ? isTransitionToBlack(row + x, history) : isTransitionToWhite(row + x, history))
+		{
+			return x;
+		}
+
+		++x;
+	}
+
+	return width;
+}
+
 inline unsigned int FinderPatternDetector::determineThreshold(const uint8_t* yPosition, const unsigned int segmentSize1, const unsigned int segmentSize2, const unsigned int segmentSize3, const unsigned int segmentSize4, const unsigned int segmentSize5)
 {
 	unsigned int sumBlack = 0u;
@@ -69,27 +69,142 @@ bool QRCodeDetector3D::detectQRCodes(const SharedAnyCameras& sharedAnyCameras, c
 	world_T_codes.clear();
 	codeSizes.clear();
 
-	std::vector<FinderPatterns> finderPatterns(yFrames.size());
-	std::vector<IndexTriplets> indexTriplets(yFrames.size());
+	std::vector<FinderPatterns> finderPatternGroups(yFrames.size());
 
 	for (size_t iCamera = 0; iCamera < yFrames.size(); ++iCamera)
 	{
 		const Frame& yFrame = yFrames[iCamera];
 
-		finderPatterns[iCamera] = FinderPatternDetector::detectFinderPatterns(yFrame.constdata<uint8_t>(), yFrame.width(), yFrame.height(), /* minimumDistance */ 10u, yFrame.paddingElements(), worker);
+		finderPatternGroups[iCamera] = FinderPatternDetector::detectFinderPatterns(yFrame.constdata<uint8_t>(), yFrame.width(), yFrame.height(), /* minimumDistance */ 10u, yFrame.paddingElements(), worker);
+	}
+
+	detectQRCodesStereo(sharedAnyCameras, yFrames, world_T_device, device_T_cameras, finderPatternGroups, codes, world_T_codes, codeSizes);
+
+	ocean_assert(codes.size() == world_T_codes.size());
+	ocean_assert(codes.size() == codeSizes.size());
+
+	if (codes.empty() && allow2DCodes)
+	{
+		for (const size_t iCamera : {0, 1})
+		{
+			const AnyCamera& camera = *sharedAnyCameras[iCamera];
+			const Frame& yFrame = yFrames[iCamera];
+
+			QRCodes codes2D = QRCodeDetector2D::detectQRCodes(camera, yFrame, /* observations */ nullptr, worker);
+
+			// TODO Use the observations to see if it's possible to estimate a rough size and pose of the current code (e.g. using the other camera image)
+
+			for (QRCode& code2D : codes2D)
+			{
+				if (!Utilities::containsCode(codes, code2D))
+				{
+					codes.emplace_back(std::move(code2D));
+					world_T_codes.emplace_back(getInvalidWorld_T_code());
+					codeSizes.emplace_back(getInvalidCodeSize());
+				}
+			}
+		}
+	}
+
+	ocean_assert(codes.size() == world_T_codes.size());
+	ocean_assert(codes.size() == codeSizes.size());
+
+#if defined(OCEAN_DEBUG)
+	for (size_t codeIndex = 0; codeIndex < codes.size(); ++codeIndex)
+	{
+		ocean_assert(codes[codeIndex].isValid());
+
+		if (allow2DCodes)
+		{
+			ocean_assert((codeSizes[codeIndex] > Scalar(0) && world_T_codes[codeIndex].isValid())
+				|| (codeSizes[codeIndex] <= Scalar(0) && !world_T_codes[codeIndex].isValid()));
+		}
+		else
+		{
+			ocean_assert(codeSizes[codeIndex] > Scalar(0) && world_T_codes[codeIndex].isValid());
+		}
+	}
+#endif // OCEAN_DEBUG
+
+	return true;
+}
+
+bool QRCodeDetector3D::detectQRCodesInRegions(const SharedAnyCameras& sharedAnyCameras, const Frames& yFrames, const HomogenousMatrix4& world_T_device, const HomogenousMatrices4& device_T_cameras, const std::vector<CV::PixelBoundingBoxes>& detectionRegionGroups, QRCodes& codes, HomogenousMatrices4& world_T_codes, Scalars& codeSizes, Worker* worker)
+{
+	ocean_assert(sharedAnyCameras.size() == yFrames.size());
+	ocean_assert(device_T_cameras.size() == yFrames.size());
+	ocean_assert(detectionRegionGroups.size() == yFrames.size());
+	ocean_assert(world_T_device.isValid());
+
+	if (yFrames.size() != 2 || yFrames.size() != sharedAnyCameras.size() || yFrames.size() != detectionRegionGroups.size())
+	{
+		ocean_assert(false && "TODO Currently this detector only supports cases with exactly two cameras, not the more general case of N > 2.");
+		return false;
+	}
+
+	codes.clear();
+	world_T_codes.clear();
+	codeSizes.clear();
+
+	std::vector<FinderPatterns> finderPatternGroups(yFrames.size());
+
+	for (size_t iCamera = 0; iCamera < yFrames.size(); ++iCamera)
+	{
+		const Frame& yFrame = yFrames[iCamera];
+		ocean_assert(yFrame.isValid() && FrameType::arePixelFormatsCompatible(yFrame.pixelFormat(), FrameType::FORMAT_Y8));
+
+		if (detectionRegionGroups[iCamera].empty())
+		{
+			// without finder patterns in one camera, there cannot be any stereo detection
+			return false;
+		}
+
+		FinderPatterns& finderPatterns = finderPatternGroups[iCamera];
+
+		for (const CV::PixelBoundingBox& detectionRegion : detectionRegionGroups[iCamera])
+		{
+			const FinderPatterns regionFinderPatterns = FinderPatternDetector::detectFinderPatternsInSubRegion(yFrame.constdata<uint8_t>(), yFrame.width(), yFrame.height(), detectionRegion, /* minimumDistance */ 10u, yFrame.paddingElements(), worker);
+
+			finderPatterns.insert(finderPatterns.end(), regionFinderPatterns.cbegin(), regionFinderPatterns.cend());
+		}
 
+		if (detectionRegionGroups[iCamera].size() >= 2)
+		{
+			// the regions may overlap, so that finder patterns may have been detected twice
+			FinderPatternDetector::removeCloseFinderPatterns(finderPatterns, /* minimumDistance */ 10u);
+		}
+	}
+
+	detectQRCodesStereo(sharedAnyCameras, yFrames, world_T_device, device_T_cameras, finderPatternGroups, codes, world_T_codes, codeSizes);
+
+	ocean_assert(codes.size() == world_T_codes.size());
+	ocean_assert(codes.size() == codeSizes.size());
+
+	return !codes.empty();
+}
+
+void QRCodeDetector3D::detectQRCodesStereo(const SharedAnyCameras& sharedAnyCameras, const Frames& yFrames, const HomogenousMatrix4& world_T_device, const HomogenousMatrices4& device_T_cameras, const std::vector<FinderPatterns>& finderPatternGroups, QRCodes& codes, HomogenousMatrices4& world_T_codes, Scalars& codeSizes)
+{
+	ocean_assert(sharedAnyCameras.size() == yFrames.size());
+	ocean_assert(device_T_cameras.size() == yFrames.size());
+	ocean_assert(finderPatternGroups.size() == yFrames.size());
+
+	std::vector<IndexTriplets> indexTriplets(yFrames.size());
+
+	for (size_t iCamera = 0; iCamera < yFrames.size(); ++iCamera)
+	{
 		constexpr size_t maximumNumberOfDetectableCodes = 5;
 		constexpr size_t maximumNumberOfFinderPatterns = 3 * maximumNumberOfDetectableCodes;
 
-		if (finderPatterns[iCamera].size() >= 3 && finderPatterns[iCamera].size() <= maximumNumberOfFinderPatterns)
+		if (finderPatternGroups[iCamera].size() >= 3 && finderPatternGroups[iCamera].size() <= maximumNumberOfFinderPatterns)
 		{
-			indexTriplets[iCamera] = FinderPatternDetector::extractIndexTriplets(finderPatterns[iCamera]);
+			indexTriplets[iCamera] = FinderPatternDetector::extractIndexTriplets(finderPatternGroups[iCamera]);
 		}
 	}
 
 	for (size_t iCameraA = 0; iCameraA < indexTriplets.size() - 1; ++iCameraA)
 	{
-		const FinderPatterns& finderPatternsA = finderPatterns[iCameraA];
+		const FinderPatterns& finderPatternsA = finderPatternGroups[iCameraA];
 
 		const Frame& yFrameA = yFrames[iCameraA];
 		const SharedAnyCamera& sharedAnyCameraA = sharedAnyCameras[iCameraA];
@@ -119,7 +234,7 @@ bool QRCodeDetector3D::detectQRCodes(const SharedAnyCameras& sharedAnyCameras, c
 
 			for (size_t iCameraB = iCameraA + 1; iCameraB < indexTriplets.size(); ++iCameraB)
 			{
-				const FinderPatterns& finderPatternsB = finderPatterns[iCameraB];
+				const FinderPatterns& finderPatternsB = finderPatternGroups[iCameraB];
 
 				const Frame& yFrameB = yFrames[iCameraB];
 				const SharedAnyCamera& sharedAnyCameraB = sharedAnyCameras[iCameraB];
@@ -175,54 +290,6 @@ bool QRCodeDetector3D::detectQRCodes(const SharedAnyCameras& sharedAnyCameras, c
 			}
 		}
 	}
-
-	ocean_assert(codes.size() == world_T_codes.size());
-	ocean_assert(codes.size() == codeSizes.size());
-
-	if (codes.empty() && allow2DCodes)
-	{
-		for (const size_t iCamera : {0, 1})
-		{
-			const AnyCamera& camera = *sharedAnyCameras[iCamera];
-			const Frame& yFrame = yFrames[iCamera];
-
-			QRCodes codes2D = QRCodeDetector2D::detectQRCodes(camera, yFrame, /* observations */ nullptr, worker);
-
-			// TODO Use the observations to see if it's possible to estimate a rough size and pose of the current code (e.g. using the other camera image)
-
-			for (QRCode& code2D : codes2D)
-			{
-				if (!Utilities::containsCode(codes, code2D))
-				{
-					codes.emplace_back(std::move(code2D));
-					world_T_codes.emplace_back(getInvalidWorld_T_code());
-					codeSizes.emplace_back(getInvalidCodeSize());
-				}
-			}
-		}
-	}
-
-	ocean_assert(codes.size() == world_T_codes.size());
-	ocean_assert(codes.size() == codeSizes.size());
-
-#if defined(OCEAN_DEBUG)
-	for (size_t codeIndex = 0; codeIndex < codes.size(); ++codeIndex)
-	{
-		ocean_assert(codes[codeIndex].isValid());
-
-		if (allow2DCodes)
-		{
-			ocean_assert((codeSizes[codeIndex] > Scalar(0) && world_T_codes[codeIndex].isValid())
-				|| (codeSizes[codeIndex] <= Scalar(0) && !world_T_codes[codeIndex].isValid()));
-		}
-		else
-		{
-			ocean_assert(codeSizes[codeIndex] > Scalar(0) && world_T_codes[codeIndex].isValid());
-		}
-	}
-#endif // OCEAN_DEBUG
-
-	return true;
 }
 
 bool QRCodeDetector3D::detectQRCodesWithPyramids(const SharedAnyCameras& sharedAnyCameras, const Frames& yFrames, const HomogenousMatrix4& world_T_device, const HomogenousMatrices4& device_T_cameras, QRCodes& codes, HomogenousMatrices4& world_T_codes, Scalars& codeSizes, Worker* worker, const bool allow2DCodes)
@@ -18,6 +18,8 @@
 
 #include "ocean/base/Frame.h"
 
+#include "ocean/cv/PixelBoundingBox.h"
+
 #include "ocean/math/AnyCamera.h"
 #include "ocean/math/Vector2.h"
 
@@ -71,6 +73,22 @@ class OCEAN_CV_DETECTOR_QRCODES_EXPORT QRCodeDetector3D : public QRCodeDetector
 		 */
 		static bool detectQRCodesWithPyramids(const SharedAnyCameras& sharedAnyCameras, const Frames& yFrames, const HomogenousMatrix4& world_T_device, const HomogenousMatrices4& device_T_cameras, QRCodes& codes, HomogenousMatrices4& world_T_codes, Scalars& codeSizes, Worker* worker = nullptr, const bool allow2DCodes = false);
 
+		/**
+		 * Detects QR codes and their 6-DOF poses in sub-regions of two synchronized 8-bit grayscale images, e.g., in the regions in which codes have been observed before.
+		 * The finder patterns are detected in the specified regions only, so that this function is significantly faster than detectQRCodes() for small regions.
+		 * @param sharedAnyCameras The cameras that produced the input images, must have 2 elements, all elements must be valid
+		 * @param yFrames The frames in which QR codes will be detected, must be valid, must have 2 elements, origin must be in the upper left corner, and have a pixel format that is compatible with Y8, minimum size is 29 x 29 pixels
+		 * @param world_T_device The transformation that maps points in the device coordinate system points to world points, must be valid
+		 * @param device_T_cameras The transformation that converts points in the camera coordinate systems to device coordinates, `devicePoint = device_T_cameras[i] * cameraPoint`, must have the same number of elements as `yFrames`, all elements must be valid
+		 * @param detectionRegionGroups The groups of regions in which the codes will be detected, one group for each frame, a group can be empty
+		 * @param codes The resulting list of detected QR codes
+		 * @param world_T_codes The resulting 6-DOF poses the detected QR codes, number of elements will be identical to `codes`
+		 * @param codeSizes The resulting edge lengths of the detected QR codes in meters, number of elements will be identical to `codes`
+		 * @param worker Optional worker instance for parallelization
+		 * @return True if one or more QR code has been detected, otherwise false
+		 */
+		static bool detectQRCodesInRegions(const SharedAnyCameras& sharedAnyCameras, const Frames& yFrames, const HomogenousMatrix4& world_T_device, const HomogenousMatrices4& device_T_cameras, const std::vector<CV::PixelBoundingBoxes>& detectionRegionGroups, QRCodes& codes, HomogenousMatrices4& world_T_codes, Scalars& codeSizes, Worker* worker = nullptr);
+
 		/**
 		 * Returns an invalid size for QR codes
 		 * @return The invalid size value
@@ -85,6 +103,19 @@ class OCEAN_CV_DETECTOR_QRCODES_EXPORT QRCodeDetector3D : public QRCodeDetector
 
 	protected:
 
+		/**
+		 * Detects QR codes and their 6-DOF poses based on finder patterns which have been detected in two synchronized 8-bit grayscale images.
+		 * @param sharedAnyCameras The cameras that produced the input images, must have 2 elements, all elements must be valid
+		 * @param yFrames The frames in which the finder patterns have been detected, must have 2 elements
+		 * @param world_T_device The transformation that maps points in the device coordinate system points to world points, must be valid
+		 * @param device_T_cameras The transformation that converts points in the camera coordinate systems to device coordinates, must have the same number of elements as `yFrames`, all elements must be valid
+		 * @param finderPatternGroups The finder patterns detected in each frame, one group for each frame
+		 * @param codes The resulting detected QR codes will be appended
+		 * @param world_T_codes The resulting 6-DOF poses the detected QR codes will be appended
+		 * @param codeSizes The resulting edge lengths of the detected QR codes will be appended
+		 */
+		static void detectQRCodesStereo(const SharedAnyCameras& sharedAnyCameras, const Frames& yFrames, const HomogenousMatrix4& world_T_device, const HomogenousMatrices4& device_T_cameras, const std::vector<FinderPatterns>& finderPatternGroups, QRCodes& codes, HomogenousMatrices4& world_T_codes, Scalars& codeSizes);
+
 		/**
 		 * Triangulates the centers of corresponding observations of finder patterns from two different views
 		 * @param sharedAnyCameraA The camera that produced the observation of the first finder pattern, must be valid
@@ -0,0 +1,308 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "ocean/cv/gles/ComputeFrameFilter.h"
+
+namespace Ocean
+{
+
+namespace CV
+{
+
+namespace GLES
+{
+
+const char* ComputeFrameFilter::sourceAccessCode_ = R"SHADER(
+uniform highp sampler2D sourceTexture;
+
+// 255 for normalized 8 bit textures, 1 for float textures
+uniform highp float sourceValueScale;
+
+uniform highp ivec2 sourceSize;
+
+int sourceValue(ivec2 position)
+{
+	return int(texelFetch(sourceTexture, position, 0).r * sourceValueScale + 0.5);
+}
+
+int mirroredSourceValue(ivec2 position)
+{
+	// mirroring as CVUtilities::mirrorIndex(), e.g., -1 -> 0
+	position = mix(position, -position - 1, lessThan(position, ivec2(0)));
+	position = mix(position, 2 * sourceSize - position - 1, greaterThanEqual(position, sourceSize));
+
+	return sourceValue(position);
+}
+)SHADER";
+
+bool ComputeFrameFilter::initialize(std::string* errorMessage)
+{
+	const std::string downsampleCode = std::string(sourceAccessCode_) + R"SHADER(
+layout(r32f, binding = 0) writeonly uniform highp image2D targetImage;
+
+void main()
+{
+	ivec2 targetPosition = ivec2(gl_GlobalInvocationID.xy);
+	ivec2 targetSize = sourceSize / 2;
+
+	if (any(greaterThanEqual(targetPosition, targetSize)))
+	{
+		return;
+	}
+
+	// the last column/row of a frame with odd dimension is filtered together with the two previous columns/rows with a 1-2-1 filter
+	bvec2 isThreeTap = bvec2((sourceSize.x & 1) == 1 && targetPosition.x == targetSize.x - 1, (sourceSize.y & 1) == 1 && targetPosition.y == targetSize.y - 1);
+
+	ivec3 weightsX = isThreeTap.x ? ivec3(1, 2, 1) : ivec3(1, 1, 0);
+	ivec3 weightsY = isThreeTap.y ? ivec3(1, 2, 1) : ivec3(1, 1, 0);
+
+	ivec2 sourcePosition = targetPosition * 2;
+
+	int sum = 0;
+
+	for (int y = 0; y < 3; ++y)
+	{
+		for (int x = 0; x < 3; ++x)
+		{
+			int weight = weightsX[x] * weightsY[y];
+
+			if (weight != 0)
+			{
+				sum += weight * sourceValue(sourcePosition + ivec2(x, y));
+			}
+		}
+	}
+
+	int normalization = (weightsX.x + weightsX.y + weightsX.z) * (weightsY.x + weightsY.y + weightsY.z);
+
+	imageStore(targetImage, targetPosition, vec4(float((sum + normalization / 2) / normalization)));
+}
+)SHADER";
+
+	const std::string gaussianCode = std::string(sourceAccessCode_) + R"SHADER(
+layout(r32f, binding = 0) writeonly uniform highp image2D targetImage;
+
+void main()
+{
+	ivec2 position = ivec2(gl_GlobalInvocationID.xy);
+
+	if (any(greaterThanEqual(position, sourceSize)))
+	{
+		return;
+	}
+
+	const ivec3 weights = ivec3(1, 2, 1);
+
+	int sum = 0;
+
+	for (int y = -1; y <= 1; ++y)
+	{
+		for (int x = -1; x <= 1; ++x)
+		{
+			sum += weights[x + 1] * weights[y + 1] * mirroredSourceValue(position + ivec2(x, y));
+		}
+	}
+
+	imageStore(targetImage, position, vec4(float((sum + 8) / 16)));
+}
+)SHADER";
+
+	const std::string sobelCode = std::string(sourceAccessCode_) + R"SHADER(
+layout(rgba16i, binding = 0) writeonly uniform highp iimage2D targetImage;
+
+int divideBy8(int value)
+{
+	// integer division rounding towards zero, as in C++
+	return value >= 0 ? value / 8 : -((-value) / 8);
+}
+
+void main()
+{
+	ivec2 position = ivec2(gl_GlobalInvocationID.xy);
+
+	if (any(greaterThanEqual(position, sourceSize)))
+	{
+		return;
+	}
+
+	if (any(lessThan(position, ivec2(1))) || any(greaterThanEqual(position, sourceSize - 1)))
+	{
+		imageStore(targetImage, position, ivec4(0));
+		return;
+	}
+
+	int v00 = sourceValue(position + ivec2(-1, -1));
+	int v10 = sourceValue(position + ivec2(0, -1));
+	int v20 = sourceValue(position + ivec2(1, -1));
+	int v01 = sourceValue(position + ivec2(-1, 0));
+	int v21 = sourceValue(position + ivec2(1, 0));
+	int v02 = sourceValue(position + ivec2(-1, 1));
+	int v12 = sourceValue(position + ivec2(0, 1));
+	int v22 = sourceValue(position + ivec2(1, 1));
+
+	int horizontal = (v20 - v00) + 2 * (v21 - v01) + (v22 - v02);
+	int vertical = (v02 - v00) + 2 * (v12 - v10) + (v22 - v20);
+
+	imageStore(targetImage, position, ivec4(divideBy8(horizontal), divideBy8(vertical), 0, 0));
+}
+)SHADER";
+
+	if (!downsampleProgram_.compile(downsampleCode, errorMessage) || !gaussianProgram_.compile(gaussianCode, errorMessage) || !sobelProgram_.compile(sobelCode, errorMessage))
+	{
+		release();
+		return false;
+	}
+
+	return true;
+}
+
+bool ComputeFrameFilter::downsampleByTwo11(const ComputeTexture& source, ComputeTexture& target)
+{
+	ocean_assert(isValid());
+	ocean_assert(source.width() >= 2u && source.height() >= 2u);
+
+	if (source.width() < 2u || source.height() < 2u)
+	{
+		return false;
+	}
+
+	const unsigned int targetWidth = source.width() / 2u;
+	const unsigned int targetHeight = source.height() / 2u;
+
+	if (!bindProgramAndSource(downsampleProgram_, source) || !bindTarget(target, targetWidth, targetHeight, ComputeTexture::TF_R32F))
+	{
+		return false;
+	}
+
+	dispatchAndSynchronize(targetWidth, targetHeight);
+
+	return true;
+}
+
+bool ComputeFrameFilter::gaussian3x3(const ComputeTexture& source, ComputeTexture& target)
+{
+	ocean_assert(isValid());
+
+	if (!bindProgramAndSource(gaussianProgram_, source) || !bindTarget(target, source.width(), source.height(), ComputeTexture::TF_R32F))
+	{
+		return false;
+	}
+
+	dispatchAndSynchronize(source.width(), source.height());
+
+	return true;
+}
+
+bool ComputeFrameFilter::sobel(const ComputeTexture& source, ComputeTexture& target)
+{
+	ocean_assert(isValid());
+
+	if (!bindProgramAndSource(sobelProgram_, source) || !bindTarget(target, source.width(), source.height(), ComputeTexture::TF_RGBA16I))
+	{
+		return false;
+	}
+
+	dispatchAndSynchronize(source.width(), source.height());
+
+	return true;
+}
+
+bool ComputeFrameFilter::createPyramid(const ComputeTexture& source, const unsigned int layers, ComputeTextures& pyramid)
+{
+	ocean_assert(isValid());
+	ocean_assert(source.isValid() && layers >= 1u);
+
+	if (!source.isValid() || layers == 0u)
+	{
+		return false;
+	}
+
+	unsigned int pyramidLayers = 1u;
+
+	for (unsigned int width = source.width(), height = source.height(); pyramidLayers < layers && width >= 4u && height >= 4u; ++pyramidLayers)
+	{
+		width /= 2u;
+		height /= 2u;
+	}
+
+	// existing textures of coarser layers are reused if their resolution still matches
+
+	pyramid.resize(pyramidLayers);
+	pyramid.front() = ComputeTexture::wrap(source.id(), source.width(), source.height(), source.textureFormat());
+
+	for (unsigned int layerIndex = 1u; layerIndex < pyramidLayers; ++layerIndex)
+	{
+		if (!downsampleByTwo11(pyramid[layerIndex - 1u], pyramid[layerIndex]))
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+void ComputeFrameFilter::release()
+{
+	downsampleProgram_.release();
+	gaussianProgram_.release();
+	sobelProgram_.release();
+}
+
+bool ComputeFrameFilter::bindProgramAndSource(const ComputeProgram& program, const ComputeTexture& source)
+{
+	ocean_assert(program.isValid());
+
+	if (!source.isValid() || (source.textureFormat() != ComputeTexture::TF_R8 && source.textureFormat() != ComputeTexture::TF_R32F))
+	{
+		ocean_assert(false && "Invalid source texture!");
+		return false;
+	}
+
+	glUseProgram(program.id());
+	ocean_assert(GL_NO_ERROR == glGetError());
+
+	glActiveTexture(GL_TEXTURE0);
+	glBindTexture(GL_TEXTURE_2D, source.id());
+	ocean_assert(GL_NO_ERROR == glGetError());
+
+	glUniform1i(program.uniformLocation("sourceTexture"), 0);
+	glUniform1f(program.uniformLocation("sourceValueScale"), source.textureFormat() == ComputeTexture::TF_R8 ? 255.0f : 1.0f);
+	glUniform2i(program.uniformLocation("sourceSize"), GLint(source.width()), GLint(source.height()));
+
+	return glGetError() == GL_NO_ERROR;
+}
+
+bool ComputeFrameFilter::bindTarget(ComputeTexture& target, const unsigned int width, const unsigned int height, const ComputeTexture::TextureFormat textureFormat)
+{
+	ocean_assert(textureFormat == ComputeTexture::TF_R32F || textureFormat == ComputeTexture::TF_RGBA16I);
+
+	if (!target.isValid() || target.width() != width || target.height() != height || target.textureFormat() != textureFormat)
+	{
+		if (!target.create(width, height, textureFormat))
+		{
+			return false;
+		}
+	}
+
+	glBindImageTexture(0u, target.id(), 0, GL_FALSE, 0, GL_WRITE_ONLY, ComputeTexture::internalFormat(textureFormat));
+
+	return glGetError() == GL_NO_ERROR;
+}
+
+void ComputeFrameFilter::dispatchAndSynchronize(const unsigned int width, const unsigned int height)
+{
+	ComputeProgram::dispatch(width, height);
+
+	glMemoryBarrier(GL_TEXTURE_FETCH_BARRIER_BIT | GL_FRAMEBUFFER_BARRIER_BIT | GL_TEXTURE_UPDATE_BARRIER_BIT);
+	ocean_assert(GL_NO_ERROR == glGetError());
+}
+
+}
+
+}
+
+}
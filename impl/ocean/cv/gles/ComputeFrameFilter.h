@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#ifndef META_OCEAN_CV_GLES_COMPUTE_FRAME_FILTER_H
+#define META_OCEAN_CV_GLES_COMPUTE_FRAME_FILTER_H
+
+#include "ocean/cv/gles/GLES.h"
+#include "ocean/cv/gles/ComputeProgram.h"
+#include "ocean/cv/gles/ComputeTexture.h"
+
+namespace Ocean
+{
+
+namespace CV
+{
+
+namespace GLES
+{
+
+/**
+ * This class implements image filters and the creation of image pyramids with compute shaders.
+ * Source textures must have the format TF_R8 (e.g., an uploaded Y8 camera frame) or TF_R32F (e.g., the result of a previous filter), TF_R32F textures hold integer values with range [0, 255].<br>
+ * The filters follow the CPU implementations: the downsampling applies the 1-1 filter of FrameShrinker (a 1-2-1 filter for the last column/row of frames with odd dimension), the Sobel filter returns responses divided by 8 with zero border pixels, as used by the HarrisCornerDetector.
+ *
+ * Target textures are (re-)created if they do not match the expected resolution or format, so that they can be reused for consecutive frames without any further allocation.<br>
+ * All functions must be called from the thread with the OpenGL ES context in which the object has been initialized.
+ * @see FramePyramid, FrameShrinker, FrameFilterSobel.
+ * @ingroup cvgles
+ */
+class OCEAN_CV_GLES_EXPORT ComputeFrameFilter
+{
+	public:
+
+		/**
+		 * Compiles all compute shaders of this filter.
+		 * @param errorMessage Optional resulting error message in case of a failure
+		 * @return True, if succeeded
+		 */
+		bool initialize(std::string* errorMessage = nullptr);
+
+		/**
+		 * Downsamples a texture by two, applying a 1-1 filter.
+		 * @param source The source texture, with format TF_R8 or TF_R32F and resolution [2, infinity)x[2, infinity)
+		 * @param target The resulting texture with format TF_R32F and resolution (source.width() / 2)x(source.height() / 2)
+		 * @return True, if succeeded
+		 */
+		bool downsampleByTwo11(const ComputeTexture& source, ComputeTexture& target);
+
+		/**
+		 * Applies a 3x3 Gaussian filter (with 1-2-1 kernels) to a texture, the border pixels are mirrored.
+		 * @param source The source texture, with format TF_R8 or TF_R32F
+		 * @param target The resulting texture with format TF_R32F and the resolution of the source texture
+		 * @return True, if succeeded
+		 */
+		bool gaussian3x3(const ComputeTexture& source, ComputeTexture& target);
+
+		/**
+		 * Applies a horizontal and vertical 3x3 Sobel filter to a texture, the responses are divided by 8 (truncated) and the border pixels are set to zero.
+		 * @param source The source texture, with format TF_R8 or TF_R32F
+		 * @param target The resulting texture with format TF_RGBA16I and the resolution of the source texture, with horizontal responses in the first and vertical responses in the second channel
+		 * @return True, if succeeded
+		 */
+		bool sobel(const ComputeTexture& source, ComputeTexture& target);
+
+		/**
+		 * Creates an image pyramid for a texture.
+		 * The first layer of the pyramid wraps the source texture, all coarser layers have format TF_R32F.<br>
+		 * The pyramid stops before a layer would have a width or height below two pixels.
+		 * @param source The source texture, with format TF_R8 or TF_R32F, must be valid as long as the pyramid is used
+		 * @param layers The maximal number of pyramid layers, with range [1, infinity)
+		 * @param pyramid The resulting pyramid layers, existing layers are reused if possible
+		 * @return True, if succeeded
+		 */
+		bool createPyramid(const ComputeTexture& source, const unsigned int layers, ComputeTextures& pyramid);
+
+		/**
+		 * Releases all compute shaders of this filter.
+		 */
+		void release();
+
+		/**
+		 * Returns whether this filter has been initialized successfully.
+		 * @return True, if so
+		 */
+		inline bool isValid() const;
+
+	protected:
+
+		/**
+		 * Binds a program and a source texture, and sets the uniforms which are common for all filters.
+		 * @param program The program to bind, must be valid
+		 * @param source The source texture to bind to the first texture unit, with format TF_R8 or TF_R32F
+		 * @return True, if succeeded
+		 */
+		static bool bindProgramAndSource(const ComputeProgram& program, const ComputeTexture& source);
+
+		/**
+		 * Ensures that a target texture has a specific resolution and format and binds the texture as image to the first image unit.
+		 * @param target The target texture to bind
+		 * @param width The width of the target texture in pixel, with range [1, infinity)
+		 * @param height The height of the target texture in pixel, with range [1, infinity)
+		 * @param textureFormat The format of the target texture, either TF_R32F or TF_RGBA16I
+		 * @return True, if succeeded
+		 */
+		static bool bindTarget(ComputeTexture& target, const unsigned int width, const unsigned int height, const ComputeTexture::TextureFormat textureFormat);
+
+		/**
+		 * Dispatches the bound program and makes the written target visible for subsequent shaders and read backs.
+		 * @param width The width of the target texture in pixel, with range [1, infinity)
+		 * @param height The height of the target texture in pixel, with range [1, infinity)
+		 */
+		static void dispatchAndSynchronize(const unsigned int width, const unsigned int height);
+
+	protected:
+
+		/// The program downsampling a texture by two.
+		ComputeProgram downsampleProgram_;
+
+		/// The program applying a 3x3 Gaussian filter.
+		ComputeProgram gaussianProgram_;
+
+		/// The program applying a 3x3 Sobel filter.
+		ComputeProgram sobelProgram_;
+
+		/// The common code of all filter shaders, providing access to the source texture.
+		static const char* sourceAccessCode_;
+};
+
+inline bool ComputeFrameFilter::isValid() const
+{
+	return downsampleProgram_.isValid() && gaussianProgram_.isValid() && sobelProgram_.isValid();
+}
+
+}
+
+}
+
+}
+
+#endif // META_OCEAN_CV_GLES_COMPUTE_FRAME_FILTER_H
@@ -0,0 +1,318 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "ocean/cv/gles/ComputeHarrisCornerDetector.h"
+
+#include "ocean/cv/detector/HarrisCornerDetector.h"
+
+namespace Ocean
+{
+
+namespace CV
+{
+
+namespace GLES
+{
+
+ComputeHarrisCornerDetector::~ComputeHarrisCornerDetector()
+{
+	release();
+}
+
+bool ComputeHarrisCornerDetector::initialize(std::string* errorMessage)
+{
+	const char* voteCode = R"SHADER(
+uniform highp isampler2D sobelTexture;
+
+layout(r32i, binding = 0) writeonly uniform highp iimage2D voteImage;
+
+int divideBy8(int value)
+{
+	// integer division rounding towards zero, as in C++
+	return value >= 0 ? value / 8 : -((-value) / 8);
+}
+
+void main()
+{
+	ivec2 position = ivec2(gl_GlobalInvocationID.xy);
+	ivec2 size = textureSize(sobelTexture, 0);
+
+	if (any(greaterThanEqual(position, size)))
+	{
+		return;
+	}
+
+	// the Sobel responses at the frame border are zero, so that votes are determined for the core pixels only
+	if (any(lessThan(position, ivec2(2))) || any(greaterThanEqual(position, size - 2)))
+	{
+		imageStore(voteImage, position, ivec4(0));
+		return;
+	}
+
+	uint Ixx = 0u;
+	uint Iyy = 0u;
+	int Ixy = 0;
+
+	for (int y = -1; y <= 1; ++y)
+	{
+		for (int x = -1; x <= 1; ++x)
+		{
+			ivec2 response = texelFetch(sobelTexture, position + ivec2(x, y), 0).xy;
+
+			Ixx += uint(response.x * response.x);
+			Iyy += uint(response.y * response.y);
+			Ixy += response.x * response.y;
+		}
+	}
+
+	// same integer arithmetic as in HarrisCornerDetector::harrisVotePixel()
+
+	uint sqrIxy = uint(divideBy8(Ixy) * divideBy8(Ixy));
+
+	int determinant = int((Ixx / 8u) * (Iyy / 8u)) - int(sqrIxy);
+	uint sqrTrace = ((Ixx + Iyy) / 8u) * ((Ixx + Iyy) / 8u);
+
+	imageStore(voteImage, position, ivec4(determinant - int((sqrTrace * 3u) / 64u)));
+}
+)SHADER";
+
+	const char* extractionCode = R"SHADER(
+uniform highp isampler2D voteTexture;
+
+uniform highp int internalThreshold;
+uniform highp uint maximalCorners;
+
+layout(std430, binding = 0) buffer CornerBuffer
+{
+	uint numberCorners;
+	uint reserved0;
+	uint reserved1;
+	uint reserved2;
+
+	// x, y, vote, unused
+	ivec4 corners[];
+};
+
+void main()
+{
+	ivec2 position = ivec2(gl_GlobalInvocationID.xy);
+	ivec2 size = textureSize(voteTexture, 0);
+
+	// the non-maximum suppression needs valid votes for the entire 3x3 neighborhood
+	if (any(lessThan(position, ivec2(3))) || any(greaterThanEqual(position, size - 3)))
+	{
+		return;
+	}
+
+	int vote = texelFetch(voteTexture, position, 0).x;
+
+	if (vote < internalThreshold)
+	{
+		return;
+	}
+
+	for (int y = -1; y <= 1; ++y)
+	{
+		for (int x = -1; x <= 1; ++x)
+		{
+			int neighborVote = texelFetch(voteTexture, position + ivec2(x, y), 0).x;
+
+			// identical votes are resolved in favor of the top left pixel, so that exactly one pixel of a plateau survives
+			bool isBefore = y < 0 || (y == 0 && x < 0);
+
+			if (neighborVote > vote || (isBefore && neighborVote == vote))
+			{
+				return;
+			}
+		}
+	}
+
+	uint index = atomicAdd(numberCorners, 1u);
+
+	if (index < maximalCorners)
+	{
+		corners[index] = ivec4(position, vote, 0);
+	}
+}
+)SHADER";
+
+	if (!voteProgram_.compile(voteCode, errorMessage) || !extractionProgram_.compile(extractionCode, errorMessage))
+	{
+		release();
+		return false;
+	}
+
+	return true;
+}
+
+bool ComputeHarrisCornerDetector::determineVotes(ComputeFrameFilter& frameFilter, const ComputeTexture& yTexture, ComputeTexture& votes)
+{
+	ocean_assert(isValid() && frameFilter.isValid());
+	ocean_assert(yTexture.width() >= 5u && yTexture.height() >= 5u);
+
+	if (yTexture.width() < 5u || yTexture.height() < 5u)
+	{
+		return false;
+	}
+
+	if (!frameFilter.sobel(yTexture, sobelResponses_))
+	{
+		return false;
+	}
+
+	if (!votes.isValid() || votes.width() != yTexture.width() || votes.height() != yTexture.height() || votes.textureFormat() != ComputeTexture::TF_R32I)
+	{
+		if (!votes.create(yTexture.width(), yTexture.height(), ComputeTexture::TF_R32I))
+		{
+			return false;
+		}
+	}
+
+	glUseProgram(voteProgram_.id());
+
+	glActiveTexture(GL_TEXTURE0);
+	glBindTexture(GL_TEXTURE_2D, sobelResponses_.id());
+	glUniform1i(voteProgram_.uniformLocation("sobelTexture"), 0);
+
+	glBindImageTexture(0u, votes.id(), 0, GL_FALSE, 0, GL_WRITE_ONLY, GL_R32I);
+	ocean_assert(GL_NO_ERROR == glGetError());
+
+	ComputeProgram::dispatch(votes.width(), votes.height());
+
+	glMemoryBarrier(GL_TEXTURE_FETCH_BARRIER_BIT | GL_FRAMEBUFFER_BARRIER_BIT | GL_TEXTURE_UPDATE_BARRIER_BIT);
+
+	return glGetError() == GL_NO_ERROR;
+}
+
+bool ComputeHarrisCornerDetector::detectCorners(ComputeFrameFilter& frameFilter, const ComputeTexture& yTexture, const unsigned int threshold, Detector::HarrisCorners& corners, const unsigned int maximalCorners)
+{
+	ocean_assert(isValid() && frameFilter.isValid());
+	ocean_assert(threshold <= 512u && maximalCorners >= 1u);
+
+	if (yTexture.width() < 7u || yTexture.height() < 7u || threshold > 512u || maximalCorners == 0u)
+	{
+		return false;
+	}
+
+	if (!determineVotes(frameFilter, yTexture, votes_))
+	{
+		return false;
+	}
+
+	// the buffer starts with the corner counter (padded to 16 bytes) followed by the corners, each corner with four 32 bit integers
+	constexpr size_t headerSize = sizeof(uint32_t) * 4;
+	constexpr size_t cornerSize = sizeof(int32_t) * 4;
+
+	if (cornerBufferId_ == 0u)
+	{
+		glGenBuffers(1, &cornerBufferId_);
+	}
+
+	glBindBuffer(GL_SHADER_STORAGE_BUFFER, cornerBufferId_);
+
+	if (cornerBufferCapacity_ < maximalCorners)
+	{
+		glBufferData(GL_SHADER_STORAGE_BUFFER, GLsizeiptr(headerSize + cornerSize * size_t(maximalCorners)), nullptr, GL_DYNAMIC_READ);
+		cornerBufferCapacity_ = maximalCorners;
+	}
+
+	const uint32_t zeroCorners = 0u;
+	glBufferSubData(GL_SHADER_STORAGE_BUFFER, 0, GLsizeiptr(sizeof(zeroCorners)), &zeroCorners);
+
+	glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 0u, cornerBufferId_);
+	ocean_assert(GL_NO_ERROR == glGetError());
+
+	glUseProgram(extractionProgram_.id());
+
+	glActiveTexture(GL_TEXTURE0);
+	glBindTexture(GL_TEXTURE_2D, votes_.id());
+	glUniform1i(extractionProgram_.uniformLocation("voteTexture"), 0);
+	glUniform1i(extractionProgram_.uniformLocation("internalThreshold"), GLint(Detector::HarrisCornerDetector::determineInternalThreshold(threshold)));
+	glUniform1ui(extractionProgram_.uniformLocation("maximalCorners"), GLuint(maximalCorners));
+	ocean_assert(GL_NO_ERROR == glGetError());
+
+	ComputeProgram::dispatch(votes_.width(), votes_.height());
+
+	glMemoryBarrier(GL_BUFFER_UPDATE_BARRIER_BIT);
+
+	// reading back the number of corners first, so that only the used part of the buffer needs to be mapped
+
+	uint32_t numberCorners = 0u;
+
+	if (const void* header = glMapBufferRange(GL_SHADER_STORAGE_BUFFER, 0, GLsizeiptr(headerSize), GL_MAP_READ_BIT))
+	{
+		memcpy(&numberCorners, header, sizeof(numberCorners));
+		glUnmapBuffer(GL_SHADER_STORAGE_BUFFER);
+	}
+	else
+	{
+		glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+		return false;
+	}
+
+	numberCorners = std::min(numberCorners, uint32_t(maximalCorners));
+
+	corners.clear();
+
+	bool result = true;
+
+	if (numberCorners != 0u)
+	{
+		const int32_t* cornerData = (const int32_t*)(glMapBufferRange(GL_SHADER_STORAGE_BUFFER, GLintptr(headerSize), GLsizeiptr(cornerSize * size_t(numberCorners)), GL_MAP_READ_BIT));
+
+		if (cornerData != nullptr)
+		{
+			corners.reserve(numberCorners);
+
+			for (uint32_t n = 0u; n < numberCorners; ++n)
+			{
+				const int32_t* corner = cornerData + n * 4u;
+
+				corners.emplace_back(Vector2(Scalar(corner[0]), Scalar(corner[1])), Detector::PointFeature::DS_UNKNOWN, Scalar(corner[2]));
+			}
+
+			glUnmapBuffer(GL_SHADER_STORAGE_BUFFER);
+		}
+		else
+		{
+			result = false;
+		}
+	}
+
+	glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+	ocean_assert(GL_NO_ERROR == glGetError());
+
+	// the corners are appended in arbitrary order by the individual invocations
+	std::sort(corners.begin(), corners.end());
+
+	return result;
+}
+
+void ComputeHarrisCornerDetector::release()
+{
+	voteProgram_.release();
+	extractionProgram_.release();
+
+	sobelResponses_.release();
+	votes_.release();
+
+	if (cornerBufferId_ != 0u)
+	{
+		glDeleteBuffers(1, &cornerBufferId_);
+		ocean_assert(GL_NO_ERROR == glGetError());
+
+		cornerBufferId_ = 0u;
+	}
+
+	cornerBufferCapacity_ = 0u;
+}
+
+}
+
+}
+
+}
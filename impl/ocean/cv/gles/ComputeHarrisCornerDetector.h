@@ -0,0 +1,147 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#ifndef META_OCEAN_CV_GLES_COMPUTE_HARRIS_CORNER_DETECTOR_H
+#define META_OCEAN_CV_GLES_COMPUTE_HARRIS_CORNER_DETECTOR_H
+
+#include "ocean/cv/gles/GLES.h"
+#include "ocean/cv/gles/ComputeFrameFilter.h"
+#include "ocean/cv/gles/ComputeProgram.h"
+#include "ocean/cv/gles/ComputeTexture.h"
+
+#include "ocean/cv/detector/HarrisCorner.h"
+
+namespace Ocean
+{
+
+namespace CV
+{
+
+namespace GLES
+{
+
+/**
+ * This class implements a Harris corner detector with compute shaders.
+ * The detector determines the Sobel responses, the Harris votes, and a 3x3 non-maximum suppression entirely on the GPU, only the list of detected corners is read back.<br>
+ * The Harris votes are calculated with the integer arithmetic of CV::Detector::HarrisCornerDetector, so that the same threshold can be used.<br>
+ * In contrast to the CPU detector, the corners are located with pixel accuracy.
+ *
+ * Here is a tutorial how to use this class:
+ * @code
+ * // once, in the thread with the OpenGL ES context
+ * frameFilter.initialize();
+ * cornerDetector.initialize();
+ *
+ * // for each camera frame
+ * yTexture.upload(yFrame);
+ *
+ * HarrisCorners corners;
+ * cornerDetector.detectCorners(frameFilter, yTexture, 20u, corners);
+ * @endcode
+ * @see CV::Detector::HarrisCornerDetector.
+ * @ingroup cvgles
+ */
+class OCEAN_CV_GLES_EXPORT ComputeHarrisCornerDetector
+{
+	public:
+
+		/**
+		 * Creates a new detector, the detector needs to be initialized before it can be used.
+		 */
+		ComputeHarrisCornerDetector() = default;
+
+		/**
+		 * Destructs the detector.
+		 */
+		~ComputeHarrisCornerDetector();
+
+		/**
+		 * Compiles all compute shaders of this detector.
+		 * @param errorMessage Optional resulting error message in case of a failure
+		 * @return True, if succeeded
+		 */
+		bool initialize(std::string* errorMessage = nullptr);
+
+		/**
+		 * Determines the Harris votes for all pixels of a texture.
+		 * Pixels without valid vote (two pixels at the frame border) receive the vote 0.
+		 * @param frameFilter The initialized filter providing the Sobel filter
+		 * @param yTexture The texture in which the votes will be determined, with format TF_R8 or TF_R32F and resolution [5, infinity)x[5, infinity)
+		 * @param votes The resulting texture with format TF_R32I
+		 * @return True, if succeeded
+		 */
+		bool determineVotes(ComputeFrameFilter& frameFilter, const ComputeTexture& yTexture, ComputeTexture& votes);
+
+		/**
+		 * Detects Harris corners in a texture.
+		 * In case more corners than 'maximalCorners' are detected, an arbitrary subset of the corners is returned.
+		 * @param frameFilter The initialized filter providing the Sobel filter
+		 * @param yTexture The texture in which the corners will be detected, with format TF_R8 or TF_R32F and resolution [7, infinity)x[7, infinity)
+		 * @param threshold Minimal strength value all detected corners must exceed to count as corner, with range [0, 512]
+		 * @param corners The resulting corners, sorted by strength (strongest first), with distortion state DS_UNKNOWN
+		 * @param maximalCorners The maximal number of corners to be read back, with range [1, infinity)
+		 * @return True, if succeeded
+		 */
+		bool detectCorners(ComputeFrameFilter& frameFilter, const ComputeTexture& yTexture, const unsigned int threshold, Detector::HarrisCorners& corners, const unsigned int maximalCorners = 4096u);
+
+		/**
+		 * Releases all resources of this detector.
+		 */
+		void release();
+
+		/**
+		 * Returns whether this detector has been initialized successfully.
+		 * @return True, if so
+		 */
+		inline bool isValid() const;
+
+	protected:
+
+		/**
+		 * Disabled copy constructor.
+		 */
+		ComputeHarrisCornerDetector(const ComputeHarrisCornerDetector&) = delete;
+
+		/**
+		 * Disabled copy operator.
+		 * @return Reference to this object
+		 */
+		ComputeHarrisCornerDetector& operator=(const ComputeHarrisCornerDetector&) = delete;
+
+	protected:
+
+		/// The program determining the Harris votes from Sobel responses.
+		ComputeProgram voteProgram_;
+
+		/// The program extracting the corners from the Harris votes.
+		ComputeProgram extractionProgram_;
+
+		/// The intermediate texture holding the Sobel responses.
+		ComputeTexture sobelResponses_;
+
+		/// The intermediate texture holding the Harris votes.
+		ComputeTexture votes_;
+
+		/// The shader storage buffer receiving the detected corners, 0 if not yet created.
+		GLuint cornerBufferId_ = 0u;
+
+		/// The number of corners the shader storage buffer can hold.
+		unsigned int cornerBufferCapacity_ = 0u;
+};
+
+inline bool ComputeHarrisCornerDetector::isValid() const
+{
+	return voteProgram_.isValid() && extractionProgram_.isValid();
+}
+
+}
+
+}
+
+}
+
+#endif // META_OCEAN_CV_GLES_COMPUTE_HARRIS_CORNER_DETECTOR_H
@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "ocean/cv/gles/ComputeProgram.h"
+
+#include "ocean/base/String.h"
+
+namespace Ocean
+{
+
+namespace CV
+{
+
+namespace GLES
+{
+
+ComputeProgram::~ComputeProgram()
+{
+	release();
+}
+
+bool ComputeProgram::compile(const std::string& code, std::string* errorMessage)
+{
+	ocean_assert(!code.empty());
+
+	release();
+
+	const std::string header = "#version 310 es\nlayout(local_size_x = " + String::toAString(workGroupSize_) + ", local_size_y = " + String::toAString(workGroupSize_) + ") in;\n";
+
+	const GLchar* codes[2] = {header.c_str(), code.c_str()};
+
+	const GLuint shaderId = glCreateShader(GL_COMPUTE_SHADER);
+	ocean_assert(GL_NO_ERROR == glGetError());
+
+	if (shaderId == 0u)
+	{
+		return false;
+	}
+
+	glShaderSource(shaderId, 2, codes, nullptr);
+	glCompileShader(shaderId);
+	ocean_assert(GL_NO_ERROR == glGetError());
+
+	GLint status = 0;
+	glGetShaderiv(shaderId, GL_COMPILE_STATUS, &status);
+
+	if (status == 0)
+	{
+		if (errorMessage != nullptr)
+		{
+			GLint infoLength = 0;
+			glGetShaderiv(shaderId, GL_INFO_LOG_LENGTH, &infoLength);
+
+			if (infoLength > 1 && infoLength <= 4096)
+			{
+				errorMessage->resize(size_t(infoLength));
+				glGetShaderInfoLog(shaderId, infoLength, nullptr, &(*errorMessage)[0]);
+				errorMessage->resize(size_t(infoLength - 1));
+			}
+		}
+
+		glDeleteShader(shaderId);
+		ocean_assert(GL_NO_ERROR == glGetError());
+
+		return false;
+	}
+
+	id_ = glCreateProgram();
+	ocean_assert(GL_NO_ERROR == glGetError());
+
+	glAttachShader(id_, shaderId);
+	glLinkProgram(id_);
+
+	// the shader is released together with the program
+	glDeleteShader(shaderId);
+	ocean_assert(GL_NO_ERROR == glGetError());
+
+	glGetProgramiv(id_, GL_LINK_STATUS, &status);
+
+	if (status == 0)
+	{
+		if (errorMessage != nullptr)
+		{
+			GLint infoLength = 0;
+			glGetProgramiv(id_, GL_INFO_LOG_LENGTH, &infoLength);
+
+			if (infoLength > 1 && infoLength <= 4096)
+			{
+				errorMessage->resize(size_t(infoLength));
+				glGetProgramInfoLog(id_, infoLength, nullptr, &(*errorMessage)[0]);
+				errorMessage->resize(size_t(infoLength - 1));
+			}
+		}
+
+		release();
+		return false;
+	}
+
+	return true;
+}
+
+GLint ComputeProgram::uniformLocation(const char* name) const
+{
+	ocean_assert(isValid() && name != nullptr);
+
+	return glGetUniformLocation(id_, name);
+}
+
+void ComputeProgram::dispatch(const unsigned int width, const unsigned int height)
+{
+	ocean_assert(width != 0u && height != 0u);
+
+	glDispatchCompute(GLuint((width + workGroupSize_ - 1u) / workGroupSize_), GLuint((height + workGroupSize_ - 1u) / workGroupSize_), 1u);
+	ocean_assert(GL_NO_ERROR == glGetError());
+}
+
+void ComputeProgram::release()
+{
+	if (id_ != 0u)
+	{
+		glDeleteProgram(id_);
+		ocean_assert(GL_NO_ERROR == glGetError());
+
+		id_ = 0u;
+	}
+}
+
+}
+
+}
+
+}
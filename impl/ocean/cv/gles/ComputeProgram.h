@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#ifndef META_OCEAN_CV_GLES_COMPUTE_PROGRAM_H
+#define META_OCEAN_CV_GLES_COMPUTE_PROGRAM_H
+
+#include "ocean/cv/gles/GLES.h"
+
+namespace Ocean
+{
+
+namespace CV
+{
+
+namespace GLES
+{
+
+/**
+ * This class wraps a program with one compute shader.
+ * All compute shaders of this library use a local work group size of 16x16 invocations, each invocation handles one pixel.
+ * @ingroup cvgles
+ */
+class OCEAN_CV_GLES_EXPORT ComputeProgram
+{
+	public:
+
+		/// The size of a work group in horizontal and vertical direction, in pixel.
+		static constexpr unsigned int workGroupSize_ = 16u;
+
+	public:
+
+		/**
+		 * Creates an invalid program.
+		 */
+		ComputeProgram() = default;
+
+		/**
+		 * Destructs the program.
+		 */
+		~ComputeProgram();
+
+		/**
+		 * Compiles and links a compute shader, an existing program is released before.
+		 * The shader's version directive and the declaration of the local work group size are added automatically.
+		 * @param code The code of the compute shader, without version directive, must not be empty
+		 * @param errorMessage Optional resulting error message in case of a failure
+		 * @return True, if succeeded
+		 */
+		bool compile(const std::string& code, std::string* errorMessage = nullptr);
+
+		/**
+		 * Returns the location of a uniform of this program.
+		 * @param name The name of the uniform, must be valid
+		 * @return The uniform's location, -1 if the program does not use the uniform
+		 */
+		GLint uniformLocation(const char* name) const;
+
+		/**
+		 * Dispatches the program for an area of pixels, the program must be bound.
+		 * Invocations outside of the area need to be skipped by the shader.
+		 * @param width The width of the area in pixel, with range [1, infinity)
+		 * @param height The height of the area in pixel, with range [1, infinity)
+		 */
+		static void dispatch(const unsigned int width, const unsigned int height);
+
+		/**
+		 * Releases the program.
+		 */
+		void release();
+
+		/**
+		 * Returns the id of the program.
+		 * @return The program's id, 0 if invalid
+		 */
+		inline GLuint id() const;
+
+		/**
+		 * Returns whether this program is valid.
+		 * @return True, if so
+		 */
+		inline bool isValid() const;
+
+	protected:
+
+		/**
+		 * Disabled copy constructor.
+		 */
+		ComputeProgram(const ComputeProgram&) = delete;
+
+		/**
+		 * Disabled copy operator.
+		 * @return Reference to this object
+		 */
+		ComputeProgram& operator=(const ComputeProgram&) = delete;
+
+	protected:
+
+		/// The id of the program, 0 if invalid.
+		GLuint id_ = 0u;
+};
+
+inline GLuint ComputeProgram::id() const
+{
+	return id_;
+}
+
+inline bool ComputeProgram::isValid() const
+{
+	return id_ != 0u;
+}
+
+}
+
+}
+
+}
+
+#endif // META_OCEAN_CV_GLES_COMPUTE_PROGRAM_H
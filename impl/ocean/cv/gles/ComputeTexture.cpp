@@ -0,0 +1,334 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "ocean/cv/gles/ComputeTexture.h"
+
+#include "ocean/base/Messenger.h"
+
+namespace Ocean
+{
+
+namespace CV
+{
+
+namespace GLES
+{
+
+ComputeTexture::ComputeTexture(ComputeTexture&& texture) noexcept
+{
+	*this = std::move(texture);
+}
+
+ComputeTexture::~ComputeTexture()
+{
+	release();
+}
+
+bool ComputeTexture::create(const unsigned int width, const unsigned int height, const TextureFormat textureFormat)
+{
+	ocean_assert(width != 0u && height != 0u);
+	ocean_assert(textureFormat != TF_INVALID);
+
+	release();
+
+	const GLenum glInternalFormat = internalFormat(textureFormat);
+
+	if (width == 0u || height == 0u || glInternalFormat == GL_NONE)
+	{
+		return false;
+	}
+
+	glGenTextures(1, &id_);
+	ocean_assert(GL_NO_ERROR == glGetError());
+
+	glBindTexture(GL_TEXTURE_2D, id_);
+	ocean_assert(GL_NO_ERROR == glGetError());
+
+	glTexStorage2D(GL_TEXTURE_2D, 1, glInternalFormat, GLsizei(width), GLsizei(height));
+
+	// integer and 32 bit float textures are not filterable, nearest sampling keeps the texture complete
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+
+	glBindTexture(GL_TEXTURE_2D, 0);
+
+	const GLenum error = glGetError();
+
+	if (error != GL_NO_ERROR)
+	{
+		Log::error() << "Failed to create compute texture with resolution " << width << "x" << height << ", error: " << int(error);
+
+		glDeleteTextures(1, &id_);
+		id_ = 0u;
+
+		return false;
+	}
+
+	width_ = width;
+	height_ = height;
+	textureFormat_ = textureFormat;
+	isOwner_ = true;
+
+	return true;
+}
+
+bool ComputeTexture::upload(const Frame& yFrame)
+{
+	ocean_assert(yFrame.isValid());
+
+	if (!yFrame.isPixelFormatCompatible(FrameType::FORMAT_Y8) || yFrame.pixelOrigin() != FrameType::ORIGIN_UPPER_LEFT)
+	{
+		ocean_assert(false && "Invalid frame!");
+		return false;
+	}
+
+	if (!isValid() || width_ != yFrame.width() || height_ != yFrame.height() || textureFormat_ != TF_R8)
+	{
+		if (!create(yFrame.width(), yFrame.height(), TF_R8))
+		{
+			return false;
+		}
+	}
+
+	glBindTexture(GL_TEXTURE_2D, id_);
+	ocean_assert(GL_NO_ERROR == glGetError());
+
+	glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+	glPixelStorei(GL_UNPACK_ROW_LENGTH, GLint(yFrame.strideElements()));
+	ocean_assert(GL_NO_ERROR == glGetError());
+
+	glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, GLsizei(width_), GLsizei(height_), GL_RED, GL_UNSIGNED_BYTE, yFrame.constdata<uint8_t>());
+
+	const GLenum error = glGetError();
+
+	glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+	glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+	glBindTexture(GL_TEXTURE_2D, 0);
+
+	if (error != GL_NO_ERROR)
+	{
+		Log::error() << "Failed to upload frame to compute texture, error: " << int(error);
+		return false;
+	}
+
+	return true;
+}
+
+bool ComputeTexture::download(Frame& frame) const
+{
+	if (!isValid())
+	{
+		return false;
+	}
+
+	GLuint framebufferId = 0u;
+	glGenFramebuffers(1, &framebufferId);
+	ocean_assert(GL_NO_ERROR == glGetError());
+
+	glBindFramebuffer(GL_READ_FRAMEBUFFER, framebufferId);
+	glFramebufferTexture2D(GL_READ_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, id_, 0);
+	ocean_assert(GL_NO_ERROR == glGetError());
+
+	bool result = glCheckFramebufferStatus(GL_READ_FRAMEBUFFER) == GL_FRAMEBUFFER_COMPLETE;
+
+	if (result)
+	{
+		glPixelStorei(GL_PACK_ALIGNMENT, 4);
+
+		// OpenGL ES guarantees RGBA reads only, so we read four channels and extract the channels of the texture afterwards
+
+		const size_t pixels = size_t(width_) * size_t(height_);
+
+		switch (textureFormat_)
+		{
+			case TF_R8:
+			{
+				std::vector<uint8_t> buffer(pixels * 4);
+				glReadPixels(0, 0, GLsizei(width_), GLsizei(height_), GL_RGBA, GL_UNSIGNED_BYTE, buffer.data());
+
+				result = frame.set(FrameType(width_, height_, FrameType::FORMAT_Y8, FrameType::ORIGIN_UPPER_LEFT), false, true);
+
+				for (unsigned int y = 0u; result && y < height_; ++y)
+				{
+					const uint8_t* const bufferRow = buffer.data() + size_t(y) * size_t(width_) * 4;
+					uint8_t* const frameRow = frame.row<uint8_t>(y);
+
+					for (unsigned int x = 0u; x < width_; ++x)
+					{
+						frameRow[x] = bufferRow[x * 4u];
+					}
+				}
+
+				break;
+			}
+
+			case TF_R32F:
+			{
+				std::vector<float> buffer(pixels * 4);
+				glReadPixels(0, 0, GLsizei(width_), GLsizei(height_), GL_RGBA, GL_FLOAT, buffer.data());
+
+				result = frame.set(FrameType(width_, height_, FrameType::FORMAT_F32, FrameType::ORIGIN_UPPER_LEFT), false, true);
+
+				for (unsigned int y = 0u; result && y < height_; ++y)
+				{
+					const float* const bufferRow = buffer.data() + size_t(y) * size_t(width_) * 4;
+					float* const frameRow = frame.row<float>(y);
+
+					for (unsigned int x = 0u; x < width_; ++x)
+					{
+						frameRow[x] = bufferRow[x * 4u];
+					}
+				}
+
+				break;
+			}
+
+			case TF_R32I:
+			case TF_RGBA16I:
+			{
+				std::vector<int32_t> buffer(pixels * 4);
+				glReadPixels(0, 0, GLsizei(width_), GLsizei(height_), GL_RGBA_INTEGER, GL_INT, buffer.data());
+
+				if (textureFormat_ == TF_R32I)
+				{
+					result = frame.set(FrameType(width_, height_, FrameType::genericPixelFormat<int32_t, 1u>(), FrameType::ORIGIN_UPPER_LEFT), false, true);
+
+					for (unsigned int y = 0u; result && y < height_; ++y)
+					{
+						const int32_t* const bufferRow = buffer.data() + size_t(y) * size_t(width_) * 4;
+						int32_t* const frameRow = frame.row<int32_t>(y);
+
+						for (unsigned int x = 0u; x < width_; ++x)
+						{
+							frameRow[x] = bufferRow[x * 4u];
+						}
+					}
+				}
+				else
+				{
+					result = frame.set(FrameType(width_, height_, FrameType::genericPixelFormat<int16_t, 2u>(), FrameType::ORIGIN_UPPER_LEFT), false, true);
+
+					for (unsigned int y = 0u; result && y < height_; ++y)
+					{
+						const int32_t* const bufferRow = buffer.data() + size_t(y) * size_t(width_) * 4;
+						int16_t* const frameRow = frame.row<int16_t>(y);
+
+						for (unsigned int x = 0u; x < width_; ++x)
+						{
+							frameRow[x * 2u + 0u] = int16_t(bufferRow[x * 4u + 0u]);
+							frameRow[x * 2u + 1u] = int16_t(bufferRow[x * 4u + 1u]);
+						}
+					}
+				}
+
+				break;
+			}
+
+			case TF_INVALID:
+				ocean_assert(false && "Invalid texture format!");
+				result = false;
+				break;
+		}
+
+		if (glGetError() != GL_NO_ERROR)
+		{
+			result = false;
+		}
+	}
+
+	glBindFramebuffer(GL_READ_FRAMEBUFFER, 0);
+	glDeleteFramebuffers(1, &framebufferId);
+	ocean_assert(GL_NO_ERROR == glGetError());
+
+	return result;
+}
+
+void ComputeTexture::release()
+{
+	if (id_ != 0u && isOwner_)
+	{
+		glDeleteTextures(1, &id_);
+		ocean_assert(GL_NO_ERROR == glGetError());
+	}
+
+	id_ = 0u;
+	width_ = 0u;
+	height_ = 0u;
+	textureFormat_ = TF_INVALID;
+	isOwner_ = false;
+}
+
+ComputeTexture& ComputeTexture::operator=(ComputeTexture&& texture) noexcept
+{
+	if (this != &texture)
+	{
+		release();
+
+		id_ = texture.id_;
+		width_ = texture.width_;
+		height_ = texture.height_;
+		textureFormat_ = texture.textureFormat_;
+		isOwner_ = texture.isOwner_;
+
+		texture.id_ = 0u;
+		texture.width_ = 0u;
+		texture.height_ = 0u;
+		texture.textureFormat_ = TF_INVALID;
+		texture.isOwner_ = false;
+	}
+
+	return *this;
+}
+
+ComputeTexture ComputeTexture::wrap(const GLuint textureId, const unsigned int width, const unsigned int height, const TextureFormat textureFormat)
+{
+	ocean_assert(textureId != 0u);
+	ocean_assert(width != 0u && height != 0u);
+	ocean_assert(textureFormat != TF_INVALID);
+
+	ComputeTexture texture;
+
+	texture.id_ = textureId;
+	texture.width_ = width;
+	texture.height_ = height;
+	texture.textureFormat_ = textureFormat;
+	texture.isOwner_ = false;
+
+	return texture;
+}
+
+GLenum ComputeTexture::internalFormat(const TextureFormat textureFormat)
+{
+	switch (textureFormat)
+	{
+		case TF_R8:
+			return GL_R8;
+
+		case TF_R32F:
+			return GL_R32F;
+
+		case TF_R32I:
+			return GL_R32I;
+
+		case TF_RGBA16I:
+			return GL_RGBA16I;
+
+		case TF_INVALID:
+			break;
+	}
+
+	ocean_assert(false && "Invalid texture format!");
+	return GL_NONE;
+}
+
+}
+
+}
+
+}
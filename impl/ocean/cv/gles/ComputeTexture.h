@@ -0,0 +1,225 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#ifndef META_OCEAN_CV_GLES_COMPUTE_TEXTURE_H
+#define META_OCEAN_CV_GLES_COMPUTE_TEXTURE_H
+
+#include "ocean/cv/gles/GLES.h"
+
+#include "ocean/base/Frame.h"
+
+namespace Ocean
+{
+
+namespace CV
+{
+
+namespace GLES
+{
+
+// Forward declaration.
+class ComputeTexture;
+
+/**
+ * Definition of a vector holding compute textures.
+ * @ingroup cvgles
+ */
+using ComputeTextures = std::vector<ComputeTexture>;
+
+/**
+ * This class wraps a 2D texture which is used as input or output of compute shaders.
+ * A texture either owns the underlying OpenGL ES texture object, or wraps an existing texture (e.g., the texture of a camera stream) without taking over the ownership.<br>
+ * The texture uses immutable storage and nearest sampling so that the texture is complete for all supported formats.
+ * @ingroup cvgles
+ */
+class OCEAN_CV_GLES_EXPORT ComputeTexture
+{
+	public:
+
+		/**
+		 * Definition of individual texture formats.
+		 */
+		enum TextureFormat : uint32_t
+		{
+			/// Invalid texture format.
+			TF_INVALID = 0u,
+			/// Normalized 8 bit unsigned integer with one channel, e.g., a Y8 camera image, can be read by compute shaders but not written.
+			TF_R8,
+			/// 32 bit float with one channel, e.g., filtered or downsampled image content.
+			TF_R32F,
+			/// 32 bit signed integer with one channel, e.g., Harris votes.
+			TF_R32I,
+			/// 16 bit signed integer with four channels, e.g., horizontal and vertical Sobel responses.
+			TF_RGBA16I
+		};
+
+	public:
+
+		/**
+		 * Creates an invalid texture.
+		 */
+		ComputeTexture() = default;
+
+		/**
+		 * Move constructor.
+		 * @param texture The texture to be moved
+		 */
+		ComputeTexture(ComputeTexture&& texture) noexcept;
+
+		/**
+		 * Destructs the texture and releases the texture object if owned.
+		 */
+		~ComputeTexture();
+
+		/**
+		 * Creates the storage of the texture, an existing texture is released before.
+		 * @param width The width of the texture in pixel, with range [1, infinity)
+		 * @param height The height of the texture in pixel, with range [1, infinity)
+		 * @param textureFormat The format of the texture, must be valid
+		 * @return True, if succeeded
+		 */
+		bool create(const unsigned int width, const unsigned int height, const TextureFormat textureFormat);
+
+		/**
+		 * Uploads a frame with pixel format FORMAT_Y8 to this texture.
+		 * The storage of the texture is (re-)created with format TF_R8 if the texture does not match the frame.
+		 * @param yFrame The frame to upload, with pixel format FORMAT_Y8 and pixel origin ORIGIN_UPPER_LEFT, must be valid
+		 * @return True, if succeeded
+		 */
+		bool upload(const Frame& yFrame);
+
+		/**
+		 * Reads the content of this texture back to memory.
+		 * The resulting frame has pixel format FORMAT_Y8 (TF_R8), FORMAT_F32 (TF_R32F), int32_t with one channel (TF_R32I), or int16_t with two channels (TF_RGBA16I, the first two channels only).<br>
+		 * Reading back entire textures is expensive, this function is intended for debugging and validation.
+		 * @param frame The resulting frame
+		 * @return True, if succeeded
+		 */
+		bool download(Frame& frame) const;
+
+		/**
+		 * Releases the texture object if owned and resets this texture.
+		 */
+		void release();
+
+		/**
+		 * Returns the id of the texture object.
+		 * @return The texture's id, 0 if invalid
+		 */
+		inline GLuint id() const;
+
+		/**
+		 * Returns the width of this texture.
+		 * @return The texture's width in pixel
+		 */
+		inline unsigned int width() const;
+
+		/**
+		 * Returns the height of this texture.
+		 * @return The texture's height in pixel
+		 */
+		inline unsigned int height() const;
+
+		/**
+		 * Returns the format of this texture.
+		 * @return The texture's format
+		 */
+		inline TextureFormat textureFormat() const;
+
+		/**
+		 * Returns whether this texture is valid.
+		 * @return True, if so
+		 */
+		inline bool isValid() const;
+
+		/**
+		 * Move operator.
+		 * @param texture The texture to be moved
+		 * @return Reference to this object
+		 */
+		ComputeTexture& operator=(ComputeTexture&& texture) noexcept;
+
+		/**
+		 * Creates a texture wrapping an existing 2D texture object, the texture object will not be released by the resulting texture.
+		 * @param textureId The id of the existing texture object, must be valid
+		 * @param width The width of the texture in pixel, with range [1, infinity)
+		 * @param height The height of the texture in pixel, with range [1, infinity)
+		 * @param textureFormat The format of the texture, must be valid
+		 * @return The resulting texture
+		 */
+		static ComputeTexture wrap(const GLuint textureId, const unsigned int width, const unsigned int height, const TextureFormat textureFormat);
+
+		/**
+		 * Returns the internal OpenGL ES format of a texture format.
+		 * @param textureFormat The texture format to translate
+		 * @return The internal format, GL_NONE if invalid
+		 */
+		static GLenum internalFormat(const TextureFormat textureFormat);
+
+	protected:
+
+		/**
+		 * Disabled copy constructor.
+		 */
+		ComputeTexture(const ComputeTexture&) = delete;
+
+		/**
+		 * Disabled copy operator.
+		 * @return Reference to this object
+		 */
+		ComputeTexture& operator=(const ComputeTexture&) = delete;
+
+	protected:
+
+		/// The id of the texture object, 0 if invalid.
+		GLuint id_ = 0u;
+
+		/// The width of the texture in pixel.
+		unsigned int width_ = 0u;
+
+		/// The height of the texture in pixel.
+		unsigned int height_ = 0u;
+
+		/// The format of the texture.
+		TextureFormat textureFormat_ = TF_INVALID;
+
+		/// True, if this object owns the texture object.
+		bool isOwner_ = false;
+};
+
+inline GLuint ComputeTexture::id() const
+{
+	return id_;
+}
+
+inline unsigned int ComputeTexture::width() const
+{
+	return width_;
+}
+
+inline unsigned int ComputeTexture::height() const
+{
+	return height_;
+}
+
+inline ComputeTexture::TextureFormat ComputeTexture::textureFormat() const
+{
+	return textureFormat_;
+}
+
+inline bool ComputeTexture::isValid() const
+{
+	return id_ != 0u;
+}
+
+}
+
+}
+
+}
+
+#endif // META_OCEAN_CV_GLES_COMPUTE_TEXTURE_H
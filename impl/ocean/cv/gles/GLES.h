@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#ifndef META_OCEAN_CV_GLES_GLES_H
+#define META_OCEAN_CV_GLES_GLES_H
+
+#include "ocean/cv/CV.h"
+
+#ifdef OCEAN_PLATFORM_BUILD_ANDROID
+	#include <GLES3/gl31.h>
+#else
+	#error The library needs OpenGL ES 3.1 compute shaders.
+#endif
+
+namespace Ocean
+{
+
+namespace CV
+{
+
+namespace GLES
+{
+
+/**
+ * @ingroup cv
+ * @defgroup cvgles Ocean CV GLES Library
+ * @{
+ * The Ocean CV GLES Library provides computer vision functionalities executed with OpenGL ES 3.1 compute shaders.
+ * Images stay in GPU textures between the individual processing steps, only compact results (e.g., lists of feature points) are read back to the CPU.<br>
+ * All functions must be called from a thread with a current OpenGL ES 3.1 context.
+ * The library is available on Android platforms only.
+ * @}
+ */
+
+/**
+ * @namespace Ocean::CV::GLES Namespace of the CV GLES library.<p>
+ * The Namespace Ocean::CV::GLES is used in the entire Ocean CV GLES Library.
+ */
+
+// Defines OCEAN_CV_GLES_EXPORT for dll export and import.
+#if defined(_WINDOWS) && defined(OCEAN_RUNTIME_SHARED)
+	#ifdef USE_OCEAN_CV_GLES_EXPORT
+		#define OCEAN_CV_GLES_EXPORT __declspec(dllexport)
+	#else
+		#define OCEAN_CV_GLES_EXPORT __declspec(dllimport)
+	#endif
+#else
+	#define OCEAN_CV_GLES_EXPORT
+#endif
+
+}
+
+}
+
+}
+
+#endif // META_OCEAN_CV_GLES_GLES_H
@@ -182,7 +182,7 @@ PixelContour ContourFinder::similarityContour8BitPerChannel(const uint8_t* frame
 	for (unsigned int n = 0; n < iterations; ++n)
 	{
 		landmarks.clear();
-		findBorderLandmarks8BitPerChannel<tChannels>(meanFrame.constdata<uint8_t>(), fineMask.constdata<uint8_t>(), width, height, meanFrame.paddingElements(), fineMask.paddingElements(), denseContour, extraOffset, landmarks);
+		findBorderLandmarks8BitPerChannel<tChannels>(meanFrame.constdata<uint8_t>(), fineMask.constdata<uint8_t>(), width, height, meanFrame.paddingElements(), fineMask.paddingElements(), denseContour, extraOffset, landmarks, worker);
 
 		adjustedContourSubpixels.clear();
 		adjustContourWithLandmarks(PixelPosition::pixelPositions2vectors(denseContour.pixels()), landmarks, adjustedContourSubpixels, n < iterations - 1u);
@@ -214,7 +214,7 @@ PixelContour ContourFinder::similarityContour8BitPerChannel(const uint8_t* frame
 	return denseContour;
 }
 
-bool ContourFinder::findBorderLandmarks(const Frame& frame, const Frame& roughMask, const PixelContour& roughContour, const unsigned int extraOffset, Vectors2& landmarks)
+bool ContourFinder::findBorderLandmarks(const Frame& frame, const Frame& roughMask, const PixelContour& roughContour, const unsigned int extraOffset, Vectors2& landmarks, Worker* worker)
 {
 	ocean_assert(frame.isValid() && roughMask.isValid());
 	ocean_assert(frame.dataType() == FrameType::DT_UNSIGNED_INTEGER_8 && frame.numberPlanes() == 1u);
@@ -227,7 +227,7 @@ bool ContourFinder::findBorderLandmarks(const Frame& frame, const Frame& roughMa
 	switch (frame.channels())
 	{
 		case 3u:
-			return findBorderLandmarks8BitPerChannel<3u>(frame.constdata<uint8_t>(), roughMask.constdata<uint8_t>(), frame.width(), frame.height(), frame.paddingElements(), roughMask.paddingElements(), roughContour, extraOffset, landmarks);
+			return findBorderLandmarks8BitPerChannel<3u>(frame.constdata<uint8_t>(), roughMask.constdata<uint8_t>(), frame.width(), frame.height(), frame.paddingElements(), roughMask.paddingElements(), roughContour, extraOffset, landmarks, worker);
 	}
 
 	ocean_assert(false && "Invalid frame type!");
@@ -235,7 +235,7 @@ bool ContourFinder::findBorderLandmarks(const Frame& frame, const Frame& roughMa
 }
 
 template <unsigned int tChannels>
-bool ContourFinder::findBorderLandmarks8BitPerChannel(const uint8_t* frame, const uint8_t* roughMask, const unsigned int width, const unsigned int height, const unsigned int framePaddingElements, const unsigned int roughMaskPaddingElements, const PixelContour& roughContour, const unsigned int extraOffset, Vectors2& landmarks)
+bool ContourFinder::findBorderLandmarks8BitPerChannel(const uint8_t* frame, const uint8_t* roughMask, const unsigned int width, const unsigned int height, const unsigned int framePaddingElements, const unsigned int roughMaskPaddingElements, const PixelContour& roughContour, const unsigned int extraOffset, Vectors2& landmarks, Worker* worker)
 {
 	static_assert(tChannels != 0u, "Invalid channel number!");
 
@@ -300,98 +300,32 @@ bool ContourFinder::findBorderLandmarks8BitPerChannel(const uint8_t* frame, cons
 	}
 
 	ocean_assert(landmarks.empty());
-	landmarks.reserve(roughContour.size() / 10);
 
 	const unsigned int randomOffset = RandomI::random(9u);
 
-	// find the fine adjusted position for each 10th position
-	for (unsigned int n = 0; n < ribs.size(); n += 10u)
-	{
-		const unsigned int index = modulo(int(n + randomOffset), int(ribs.size()));
-		const Vector2& positionOut(ribs[index].first);
-		const Vector2& positionDirection(ribs[index].second);
+	// we determine the fine adjusted position for each 10th rib, each landmark is independent of all other landmarks
 
-		// determine the variance for the fingerprints in the direct neighborhood
-		VarianceT<unsigned int> varianceObject[tChannels];
+	const unsigned int numberLandmarks = (unsigned int)((ribs.size() + 9) / 10);
 
-		for (int f = -20; f <= 20; ++f)
-		{
-			// take each fourth fingerprint in the direct neighborhood
-			const unsigned int fpIndex = modulo(int(index) + f * 4, int(ribs.size()));
+	Vectors2 landmarkCandidates(numberLandmarks);
+	std::vector<uint8_t> validLandmarks(numberLandmarks, 0u);
 
-			const Fingerprint<tChannels>& fingerprint = fingerprints[fpIndex];
-
-			for (unsigned int i = 0u; i < tChannels; ++i)
-			{
-				ocean_assert(fingerprint[i] == frame[(unsigned int)(ribs[fpIndex].first.y() + Scalar(0.5)) * frameStrideElements + ((unsigned int)(ribs[fpIndex].first.x() + Scalar(0.5))) * tChannels + i]);
+	if (worker != nullptr && numberLandmarks >= 16u)
+	{
+		worker->executeFunction(Worker::Function::createStatic(&ContourFinder::findBorderLandmarks8BitPerChannelSubset<tChannels>, frame, width, height, frameStrideElements, (const std::pair<Vector2, Vector2>*)(ribs.data()), (const Fingerprint<tChannels>*)(fingerprints.data()), (unsigned int)(ribs.size()), randomOffset, extraOffset, landmarkCandidates.data(), validLandmarks.data(), 0u, 0u), 0u, numberLandmarks, 11u, 12u, 4u);
+	}
+	else
+	{
+		findBorderLandmarks8BitPerChannelSubset<tChannels>(frame, width, height, frameStrideElements, ribs.data(), fingerprints.data(), (unsigned int)(ribs.size()), randomOffset, extraOffset, landmarkCandidates.data(), validLandmarks.data(), 0u, numberLandmarks);
+	}
 
-				varianceObject[i].add(fingerprint[i]);
-			}
-		}
+	landmarks.reserve(numberLandmarks);
 
-		unsigned int variances[tChannels];
-		for (unsigned int i = 0u; i < tChannels; ++i)
+	for (unsigned int n = 0u; n < numberLandmarks; ++n)
+	{
+		if (validLandmarks[n] != 0u)
 		{
-			variances[i] = max(10u * 10u, varianceObject[i].variance() * 2u);
-		}
-
-
-		// find the object's border by starting for outside and going inwards along the perpendicular contour direction
-
-		PixelPosition lastTestPosition;
-		unsigned int validIterations = 0u;
-
-		for (Scalar t = 0; t < 50; ++t)
-		{
-			const Vector2 testPosition(positionOut + positionDirection * t);
-
-			const unsigned int x = (unsigned int)(testPosition.x() + Scalar(0.5));
-			const unsigned int y = (unsigned int)(testPosition.y() + Scalar(0.5));
-
-			// avoid testing of the same position due to rounding inaccuracies
-			if (lastTestPosition == PixelPosition(x, y))
-			{
-				continue;
-			}
-
-			lastTestPosition = PixelPosition(x, y);
-
-			const uint8_t* const testFingerprint = frame + y * frameStrideElements + x * tChannels;
-
-			unsigned int dissimilarityCounter = 0u;
-			for (int f = -20; f <= 20; ++f)
-			{
-				const unsigned int fpIndex = modulo(int(index) + f * 4, int(ribs.size()));
-
-				const Fingerprint<tChannels>& fingerprint = fingerprints[fpIndex];
-
-				for (unsigned int i = 0u; i < tChannels; ++i)
-				{
-					ocean_assert(fingerprint[i] == frame[(unsigned int)(ribs[fpIndex].first.y() + Scalar(0.5)) * frameStrideElements + ((unsigned int)(ribs[fpIndex].first.x() + Scalar(0.5))) * tChannels + i]);
-				}
-
-				if (!fingerprint.isSimilar(testFingerprint, variances))
-				{
-					++dissimilarityCounter;
-				}
-			}
-
-			if (dissimilarityCounter >= 38u) // **TODO** why 38?
-			{
-				++validIterations;
-
-				// only if the this is the third successive iteration we accept this point
-				if (validIterations >= 3u)
-				{
-					landmarks.push_back(positionOut + positionDirection * (t - 3 - Scalar(extraOffset)));
-					break;
-				}
-			}
-			else
-			{
-				// reset the number of valid iterations
-				validIterations = 0u;
-			}
+			landmarks.emplace_back(landmarkCandidates[n]);
 		}
 	}
 
@@ -804,6 +738,126 @@ void ContourFinder::finetuneSimilarityMask8BitPerChannelSubset(const uint8_t* fr
 	}
 }
 
+template <unsigned int tChannels>
+void ContourFinder::findBorderLandmarks8BitPerChannelSubset(const uint8_t* frame, const unsigned int width, const unsigned int height, const unsigned int frameStrideElements, const std::pair<Vector2, Vector2>* ribs, const Fingerprint<tChannels>* fingerprints, const unsigned int numberRibs, const unsigned int randomOffset, const unsigned int extraOffset, Vector2* landmarks, uint8_t* validLandmarks, const unsigned int firstLandmark, const unsigned int numberLandmarks)
+{
+	static_assert(tChannels != 0u, "Invalid channel number!");
+
+	ocean_assert(frame != nullptr && width != 0u && height != 0u);
+	ocean_assert(ribs != nullptr && fingerprints != nullptr && numberRibs != 0u);
+	ocean_assert(randomOffset <= 9u);
+	ocean_assert(landmarks != nullptr && validLandmarks != nullptr);
+	ocean_assert(firstLandmark + numberLandmarks <= (numberRibs + 9u) / 10u);
+
+	// the profile of a landmark holds each fourth fingerprint in the direct neighborhood of the landmark's rib, channel after channel
+
+	uint8_t profile[tChannels * profileChannelElements_] = {};
+	uint8_t thresholds[tChannels];
+
+	for (unsigned int landmarkIndex = firstLandmark; landmarkIndex < firstLandmark + numberLandmarks; ++landmarkIndex)
+	{
+		ocean_assert(validLandmarks[landmarkIndex] == 0u);
+
+		const unsigned int index = modulo(int(landmarkIndex * 10u + randomOffset), int(numberRibs));
+		const Vector2& positionOut(ribs[index].first);
+		const Vector2& positionDirection(ribs[index].second);
+
+		// determine the variance for the fingerprints in the direct neighborhood
+		VarianceT<unsigned int> varianceObject[tChannels];
+
+		for (int f = -20; f <= 20; ++f)
+		{
+			// take each fourth fingerprint in the direct neighborhood
+			const unsigned int fpIndex = modulo(int(index) + f * 4, int(numberRibs));
+
+			const Fingerprint<tChannels>& fingerprint = fingerprints[fpIndex];
+
+			for (unsigned int i = 0u; i < tChannels; ++i)
+			{
+				ocean_assert(fingerprint[i] == frame[(unsigned int)(ribs[fpIndex].first.y() + Scalar(0.5)) * frameStrideElements + ((unsigned int)(ribs[fpIndex].first.x() + Scalar(0.5))) * tChannels + i]);
+
+				varianceObject[i].add(fingerprint[i]);
+
+				profile[i * profileChannelElements_ + (unsigned int)(f + 20)] = fingerprint[i];
+			}
+		}
+
+		for (unsigned int i = 0u; i < tChannels; ++i)
+		{
+			const unsigned int variance = max(10u * 10u, varianceObject[i].variance() * 2u);
+
+			// sqr(difference) > variance is identical to difference > floor(sqrt(variance)) for integer differences
+
+			unsigned int threshold = (unsigned int)(NumericD::sqrt(double(variance)));
+
+			while (threshold * threshold > variance)
+			{
+				--threshold;
+			}
+
+			while ((threshold + 1u) * (threshold + 1u) <= variance)
+			{
+				++threshold;
+			}
+
+			thresholds[i] = uint8_t(min(threshold, 255u));
+		}
+
+		// find the object's border by starting for outside and going inwards along the perpendicular contour direction
+
+		PixelPosition lastTestPosition;
+		unsigned int validIterations = 0u;
+
+		for (Scalar t = 0; t < 50; ++t)
+		{
+			const Vector2 testPosition(positionOut + positionDirection * t);
+
+			if (testPosition.x() < Scalar(0) || testPosition.y() < Scalar(0))
+			{
+				break;
+			}
+
+			const unsigned int x = (unsigned int)(testPosition.x() + Scalar(0.5));
+			const unsigned int y = (unsigned int)(testPosition.y() + Scalar(0.5));
+
+			if (x >= width || y >= height)
+			{
+				break;
+			}
+
+			// avoid testing of the same position due to rounding inaccuracies
+			if (lastTestPosition == PixelPosition(x, y))
+			{
+				continue;
+			}
+
+			lastTestPosition = PixelPosition(x, y);
+
+			const uint8_t* const testFingerprint = frame + y * frameStrideElements + x * tChannels;
+
+			const unsigned int dissimilarityCounter = countDissimilarFingerprints<tChannels>(profile, testFingerprint, thresholds);
+
+			if (dissimilarityCounter >= 38u) // **TODO** why 38?
+			{
+				++validIterations;
+
+				// only if the this is the third successive iteration we accept this point
+				if (validIterations >= 3u)
+				{
+					landmarks[landmarkIndex] = positionOut + positionDirection * (t - 3 - Scalar(extraOffset));
+					validLandmarks[landmarkIndex] = 1u;
+					break;
+				}
+			}
+			else
+			{
+				// reset the number of valid iterations
+				validIterations = 0u;
+			}
+		}
+	}
+}
+
 }
 
 }
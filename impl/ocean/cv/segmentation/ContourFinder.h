@@ -15,6 +15,13 @@
 #include "ocean/base/RandomGenerator.h"
 #include "ocean/base/Worker.h"
 
+#if defined(OCEAN_HARDWARE_SSE_VERSION) && OCEAN_HARDWARE_SSE_VERSION >= 41
+	#include "ocean/cv/SSE.h"
+#elif defined(OCEAN_HARDWARE_NEON_VERSION) && OCEAN_HARDWARE_NEON_VERSION >= 10
+	#include "ocean/cv/NEON.h"
+#endif
+
+#include <bitset>
 #include <vector>
 
 namespace Ocean
@@ -105,6 +112,12 @@ class OCEAN_CV_SEGMENTATION_EXPORT ContourFinder
 				Type data_;
 		};
 
+		/// The number of fingerprints in the profile of a landmark.
+		static constexpr unsigned int profileFingerprints_ = 41u;
+
+		/// The number of elements of each channel in the profile of a landmark, the fingerprints padded to a multiple of 16.
+		static constexpr unsigned int profileChannelElements_ = 48u;
+
 	public:
 
 		/**
@@ -147,14 +160,16 @@ class OCEAN_CV_SEGMENTATION_EXPORT ContourFinder
 		 * @param roughContour The rough contour around the object, with ranges [0, frame.width())x[0, frame.height())
 		 * @param extraOffset The explicit additional offset between the actual object and the final resulting contour in pixel, with range [0, infinity)
 		 * @param landmarks The resulting locations of the landmarks
+		 * @param worker Optional worker object to distribute the computation
 		 * @return True, if succeeded
 		 * @see findBorderLandmarks8BitPerChannel().
 		 */
-		static bool findBorderLandmarks(const Frame& frame, const Frame& roughMask, const PixelContour& roughContour, const unsigned int extraOffset, Vectors2& landmarks);
+		static bool findBorderLandmarks(const Frame& frame, const Frame& roughMask, const PixelContour& roughContour, const unsigned int extraOffset, Vectors2& landmarks, Worker* worker = nullptr);
 
 		/**
 		 * Determines fixed landmark locations around the border of an object within a frame and within a rough contour.
-		 * This function uses fingerprints around a specified rough contour to identify the landmarks.
+		 * This function uses fingerprints around a specified rough contour to identify the landmarks.<br>
+		 * The landmarks are independent of each other so that they can be determined in parallel, the resulting landmarks are identical with and without worker.
 		 * @param frame The frame in which the object is visible and for which the landmarks will be determined, must be valid
 		 * @param roughMask The rough 8 bit mask covering the object, with same frame dimension and pixel origin as the provided frame, must be valid
 		 * @param width The width of the given frame (and mask) in pixel, with range [1, infinity)
@@ -164,12 +179,13 @@ class OCEAN_CV_SEGMENTATION_EXPORT ContourFinder
 		 * @param roughContour The rough contour around the object, with ranges [0, width)x[0, height)
 		 * @param extraOffset The explicit additional offset between the actual object and the final resulting contour in pixel, with range [0, infinity)
 		 * @param landmarks The resulting locations of the landmarks
+		 * @param worker Optional worker object to distribute the computation
 		 * @return True, if succeeded
 		 * @tparam tChannels The number of channels the provided frame has, with range [1, infinity)
 		 * @see findBorderLandmarks().
 		 */
 		template <unsigned int tChannels>
-		static bool findBorderLandmarks8BitPerChannel(const uint8_t* frame, const uint8_t* roughMask, const unsigned int width, const unsigned int height, const unsigned int framePaddingElements, const unsigned int roughMaskPaddingElements, const PixelContour& roughContour, const unsigned int extraOffset, Vectors2& landmarks);
+		static bool findBorderLandmarks8BitPerChannel(const uint8_t* frame, const uint8_t* roughMask, const unsigned int width, const unsigned int height, const unsigned int framePaddingElements, const unsigned int roughMaskPaddingElements, const PixelContour& roughContour, const unsigned int extraOffset, Vectors2& landmarks, Worker* worker = nullptr);
 
 		/**
 		 * Adjusts the location and shape of a given contour to a set of given landmark locations.
@@ -274,6 +290,39 @@ class OCEAN_CV_SEGMENTATION_EXPORT ContourFinder
 		 */
 		template <unsigned int tChannels>
 		static void finetuneSimilarityMask8BitPerChannelSubset(const uint8_t* frame, uint8_t* mask, const unsigned int frameStrideElements, const unsigned int maskStrideElements, const Fingerprint<tChannels>* fingerprints, const size_t numberFingerprints, const unsigned int variances[tChannels], const CV::PixelPosition* positions, const unsigned int firstPosition, const unsigned int numberPositions);
+
+		/**
+		 * Determines a subset of the landmarks around the border of an object.
+		 * Each landmark is determined by walking along the rib of every 10th contour location from outside towards the object until the visual information is dissimilar to the profile of the 41 neighboring fingerprints.
+		 * @param frame The frame in which the object is visible, must be valid
+		 * @param width The width of the given frame in pixel, with range [1, infinity)
+		 * @param height The height of the given frame in pixel, with range [1, infinity)
+		 * @param frameStrideElements The number of elements between two frame rows, in elements, with range [width * tChannels, infinity)
+		 * @param ribs The ribs of the contour, pairs of start locations outside of the object and (normalized) directions pointing inwards, must be valid
+		 * @param fingerprints The fingerprints at the start locations of the ribs, one for each rib, must be valid
+		 * @param numberRibs The number of given ribs, with range [1, infinity)
+		 * @param randomOffset The random offset of the rib of the first landmark, with range [0, 9]
+		 * @param extraOffset The explicit additional offset between the actual object and the final resulting contour in pixel, with range [0, infinity)
+		 * @param landmarks The resulting landmarks, one for each landmark candidate, must be valid
+		 * @param validLandmarks The resulting validity of the landmarks, 1 for a landmark which could be determined, one for each landmark candidate, must be valid
+		 * @param firstLandmark The first landmark candidate to be handled, with range [0, (numberRibs + 9) / 10)
+		 * @param numberLandmarks The number of landmark candidates to be handled, with range [1, (numberRibs + 9) / 10 - firstLandmark]
+		 * @tparam tChannels The number of channels the provided frame has, with range [1, infinity)
+		 */
+		template <unsigned int tChannels>
+		static void findBorderLandmarks8BitPerChannelSubset(const uint8_t* frame, const unsigned int width, const unsigned int height, const unsigned int frameStrideElements, const std::pair<Vector2, Vector2>* ribs, const Fingerprint<tChannels>* fingerprints, const unsigned int numberRibs, const unsigned int randomOffset, const unsigned int extraOffset, Vector2* landmarks, uint8_t* validLandmarks, const unsigned int firstLandmark, const unsigned int numberLandmarks);
+
+		/**
+		 * Counts the fingerprints of a landmark profile which are dissimilar to a pixel.
+		 * A fingerprint is dissimilar if the absolute difference of at least one channel exceeds the channel's threshold.
+		 * @param profile The landmark profile with 48 elements for each channel (channel after channel), the first 41 elements of each channel are fingerprint values, must be valid
+		 * @param pixel The pixel to be compared with the profile, with 'tChannels' channels, must be valid
+		 * @param thresholds The maximal absolute differences between pixel and fingerprints, one for each channel, must be valid
+		 * @return The number of dissimilar fingerprints, with range [0, 41]
+		 * @tparam tChannels The number of channels the profile and pixel have, with range [1, infinity)
+		 */
+		template <unsigned int tChannels>
+		static inline unsigned int countDissimilarFingerprints(const uint8_t* profile, const uint8_t* pixel, const uint8_t* thresholds);
 };
 
 template <unsigned int tChannels>
@@ -341,6 +390,100 @@ inline uint8_t ContourFinder::Fingerprint<tChannels>::operator[](const unsigned
 	return ((const uint8_t*)(&data_))[index];
 }
 
+template <unsigned int tChannels>
+inline unsigned int ContourFinder::countDissimilarFingerprints(const uint8_t* profile, const uint8_t* pixel, const uint8_t* thresholds)
+{
+	static_assert(tChannels != 0u, "Invalid channel number!");
+	static_assert(profileFingerprints_ > 32u && profileChannelElements_ == 48u, "Invalid profile layout!");
+
+	ocean_assert(profile != nullptr && pixel != nullptr && thresholds != nullptr);
+
+#if defined(OCEAN_HARDWARE_SSE_VERSION) && OCEAN_HARDWARE_SSE_VERSION >= 41
+
+	// a fingerprint is dissimilar if the saturated difference between absolute difference and threshold is not zero for any channel
+
+	__m128i dissimilarA_u_8x16 = _mm_setzero_si128();
+	__m128i dissimilarB_u_8x16 = _mm_setzero_si128();
+	__m128i dissimilarC_u_8x16 = _mm_setzero_si128();
+
+	for (unsigned int n = 0u; n < tChannels; ++n)
+	{
+		const __m128i pixel_u_8x16 = _mm_set1_epi8(char(pixel[n]));
+		const __m128i threshold_u_8x16 = _mm_set1_epi8(char(thresholds[n]));
+
+		const uint8_t* const profileChannel = profile + n * profileChannelElements_;
+
+		const __m128i profileA_u_8x16 = _mm_lddqu_si128((const __m128i*)(profileChannel + 0));
+		const __m128i profileB_u_8x16 = _mm_lddqu_si128((const __m128i*)(profileChannel + 16));
+		const __m128i profileC_u_8x16 = _mm_lddqu_si128((const __m128i*)(profileChannel + 32));
+
+		dissimilarA_u_8x16 = _mm_or_si128(dissimilarA_u_8x16, _mm_subs_epu8(_mm_or_si128(_mm_subs_epu8(profileA_u_8x16, pixel_u_8x16), _mm_subs_epu8(pixel_u_8x16, profileA_u_8x16)), threshold_u_8x16));
+		dissimilarB_u_8x16 = _mm_or_si128(dissimilarB_u_8x16, _mm_subs_epu8(_mm_or_si128(_mm_subs_epu8(profileB_u_8x16, pixel_u_8x16), _mm_subs_epu8(pixel_u_8x16, profileB_u_8x16)), threshold_u_8x16));
+		dissimilarC_u_8x16 = _mm_or_si128(dissimilarC_u_8x16, _mm_subs_epu8(_mm_or_si128(_mm_subs_epu8(profileC_u_8x16, pixel_u_8x16), _mm_subs_epu8(pixel_u_8x16, profileC_u_8x16)), threshold_u_8x16));
+	}
+
+	const unsigned int similarMaskA = (unsigned int)(_mm_movemask_epi8(_mm_cmpeq_epi8(dissimilarA_u_8x16, _mm_setzero_si128())));
+	const unsigned int similarMaskB = (unsigned int)(_mm_movemask_epi8(_mm_cmpeq_epi8(dissimilarB_u_8x16, _mm_setzero_si128())));
+	const unsigned int similarMaskC = (unsigned int)(_mm_movemask_epi8(_mm_cmpeq_epi8(dissimilarC_u_8x16, _mm_setzero_si128())));
+
+	// the padding elements of the last block are not part of the profile
+
+	constexpr unsigned int validMaskC = (1u << (profileFingerprints_ - 32u)) - 1u;
+
+	return profileFingerprints_ - (unsigned int)(std::bitset<16>(similarMaskA).count() + std::bitset<16>(similarMaskB).count() + std::bitset<16>(similarMaskC & validMaskC).count());
+
+#elif defined(OCEAN_HARDWARE_NEON_VERSION) && OCEAN_HARDWARE_NEON_VERSION >= 10
+
+	uint8x16_t dissimilarA_u_8x16 = vdupq_n_u8(0u);
+	uint8x16_t dissimilarB_u_8x16 = vdupq_n_u8(0u);
+	uint8x16_t dissimilarC_u_8x16 = vdupq_n_u8(0u);
+
+	for (unsigned int n = 0u; n < tChannels; ++n)
+	{
+		const uint8x16_t pixel_u_8x16 = vdupq_n_u8(pixel[n]);
+		const uint8x16_t threshold_u_8x16 = vdupq_n_u8(thresholds[n]);
+
+		const uint8_t* const profileChannel = profile + n * profileChannelElements_;
+
+		// 0xFF for each fingerprint with absolute difference above the threshold
+
+		dissimilarA_u_8x16 = vorrq_u8(dissimilarA_u_8x16, vcgtq_u8(vabdq_u8(vld1q_u8(profileChannel + 0), pixel_u_8x16), threshold_u_8x16));
+		dissimilarB_u_8x16 = vorrq_u8(dissimilarB_u_8x16, vcgtq_u8(vabdq_u8(vld1q_u8(profileChannel + 16), pixel_u_8x16), threshold_u_8x16));
+		dissimilarC_u_8x16 = vorrq_u8(dissimilarC_u_8x16, vcgtq_u8(vabdq_u8(vld1q_u8(profileChannel + 32), pixel_u_8x16), threshold_u_8x16));
+	}
+
+	// the padding elements of the last block are not part of the profile
+
+	constexpr uint8_t validC[16] = {1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u};
+	static_assert(profileFingerprints_ == 41u, "Invalid profile layout!");
+
+	const uint8x16_t count_u_8x16 = vaddq_u8(vaddq_u8(vshrq_n_u8(dissimilarA_u_8x16, 7), vshrq_n_u8(dissimilarB_u_8x16, 7)), vandq_u8(vshrq_n_u8(dissimilarC_u_8x16, 7), vld1q_u8(validC)));
+
+	const uint64x2_t count_u_64x2 = vpaddlq_u32(vpaddlq_u16(vpaddlq_u8(count_u_8x16)));
+
+	return (unsigned int)(vgetq_lane_u64(count_u_64x2, 0) + vgetq_lane_u64(count_u_64x2, 1));
+
+#else
+
+	unsigned int dissimilarFingerprints = 0u;
+
+	for (unsigned int f = 0u; f < profileFingerprints_; ++f)
+	{
+		for (unsigned int n = 0u; n < tChannels; ++n)
+		{
+			if ((unsigned int)(abs(int(profile[n * profileChannelElements_ + f]) - int(pixel[n]))) > (unsigned int)(thresholds[n]))
+			{
+				++dissimilarFingerprints;
+				break;
+			}
+		}
+	}
+
+	return dissimilarFingerprints;
+
+#endif
+}
+
 }
 
 }
@@ -108,9 +108,6 @@ bool ContourTracker::trackObject(const Frame& frame, RandomGenerator& randomGene
 		return false;
 	}
 
-	Frame meanFrame;
-	FrameFilterMean::filter(frame, meanFrame, 21u, worker);
-
 	Indices32 usedIndices;
 	Vectors2 currentContourStrongest;
 	SquareMatrix3 currentHomography;
@@ -198,15 +195,62 @@ bool ContourTracker::trackObject(const Frame& frame, RandomGenerator& randomGene
 
 	MaskCreator::contour2inclusiveMaskByTriangulation(intermediateRoughMask_.data<uint8_t>(), intermediateRoughMask_.width(), intermediateRoughMask_.height(), intermediateRoughMask_.paddingElements(), denseContour.simplified(), 0x00, worker);
 
+	// the landmarks are determined close to the contour only, so that the mean filter is applied around the contour only
+
+	constexpr unsigned int meanWindow = 21u;
+
+	if (!meanFrame_.set(frame.frameType(), false /*forceOwner*/, true /*forceWritable*/))
+	{
+		return false;
+	}
+
+	PixelBoundingBox meanBoundingBox(0u, 0u, frame.width() - 1u, frame.height() - 1u);
+
+	const PixelBoundingBox& contourBoundingBox = denseContour.boundingBox();
+
+	if (contourBoundingBox.isValid() && contourBoundingBox.left() < frame.width() && contourBoundingBox.top() < frame.height())
+	{
+		// the landmarks access the frame up to 20 pixels outside of the contour, the mean filter needs half of the window as additional border
+
+		constexpr unsigned int margin = 20u + 1u + meanWindow / 2u + 8u;
+
+		meanBoundingBox = PixelBoundingBox((unsigned int)(max(0, int(contourBoundingBox.left()) - int(margin))), (unsigned int)(max(0, int(contourBoundingBox.top()) - int(margin))), min(contourBoundingBox.right() + margin, frame.width() - 1u), min(contourBoundingBox.bottom() + margin, frame.height() - 1u));
+	}
+
+	Frame meanSubFrame(meanFrame_.subFrame(meanBoundingBox.left(), meanBoundingBox.top(), meanBoundingBox.width(), meanBoundingBox.height(), Frame::CM_USE_KEEP_LAYOUT));
+
+	if (!FrameFilterMean::filter(frame.subFrame(meanBoundingBox.left(), meanBoundingBox.top(), meanBoundingBox.width(), meanBoundingBox.height(), Frame::CM_USE_KEEP_LAYOUT), meanSubFrame, meanWindow, worker))
+	{
+		return false;
+	}
+
+	ocean_assert(meanSubFrame.constdata<void>() == meanFrame_.constpixel<uint8_t>(meanBoundingBox.left(), meanBoundingBox.top()));
+
 	Vectors2 landmarks;
 	landmarks.reserve(denseContour.size());
-	const bool landmarkResult = ContourFinder::findBorderLandmarks(meanFrame, intermediateRoughMask_, denseContour, extraContourOffset, landmarks);
-	ocean_assert_and_suppress_unused(landmarkResult, landmarkResult);
+	ContourFinder::findBorderLandmarks(meanFrame_, intermediateRoughMask_, denseContour, extraContourOffset, landmarks, worker);
+
+	// if not enough landmarks could be determined (e.g., due to motion blur), we reuse the landmarks of the previous frame
+
+	if (landmarks.size() < 2 && previousLandmarks_.size() >= 2)
+	{
+		landmarks.clear();
+
+		for (const Vector2& previousLandmark : previousLandmarks_)
+		{
+			landmarks.emplace_back(currentHomography * previousLandmark);
+		}
+	}
 
 	Vectors2 currentAdjustedContour;
 	currentAdjustedContour.reserve(currentContour.size());
-	const bool adjustmentResult = ContourFinder::adjustContourWithLandmarks(currentContour, landmarks, currentAdjustedContour);
-	ocean_assert_and_suppress_unused(adjustmentResult, adjustmentResult);
+
+	if (!ContourFinder::adjustContourWithLandmarks(currentContour, landmarks, currentAdjustedContour))
+	{
+		currentAdjustedContour = currentContour;
+	}
+
+	previousLandmarks_ = std::move(landmarks);
 
 	previousDenseContourSubPixel_ = ContourAnalyzer::equalizeContourDensity(currentAdjustedContour);
 
@@ -243,6 +287,9 @@ void ContourTracker::clear()
 	previousHomography_.toIdentity();
 
 	intermediateRoughMask_.release();
+	meanFrame_.release();
+
+	previousLandmarks_.clear();
 
 	usePlanarTracking_ = false;
 }
@@ -113,6 +113,12 @@ class OCEAN_CV_SEGMENTATION_EXPORT ContourTracker
 		/// An intermediate rough mask frame.
 		Frame intermediateRoughMask_;
 
+		/// The mean filtered frame, which is filtered around the tracked contour only and reused between tracking iterations.
+		Frame meanFrame_;
+
+		/// The border landmarks of the previous frame, used if not enough landmarks can be determined in the current frame.
+		Vectors2 previousLandmarks_;
+
 		/// True, if the tracker should try to invoke a planar tracker; False, if the tracker should use a more generous approach.
 		bool usePlanarTracking_ = false;
 };
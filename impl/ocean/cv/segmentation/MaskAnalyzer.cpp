@@ -10,7 +10,16 @@
 #include "ocean/base/Frame.h"
 #include "ocean/base/Utilities.h"
 
+#if defined(OCEAN_HARDWARE_SSE_VERSION) && OCEAN_HARDWARE_SSE_VERSION >= 41
+	#include "ocean/cv/SSE.h"
+#endif
+
+#if defined(OCEAN_HARDWARE_NEON_VERSION) && OCEAN_HARDWARE_NEON_VERSION >= 10
+	#include "ocean/cv/NEON.h"
+#endif
+
 #include <algorithm>
+#include <bit>
 
 namespace Ocean
 {
@@ -2046,6 +2055,436 @@ PixelBoundingBoxes MaskAnalyzer::detectBoundingBoxes(const uint8_t* const mask,
 	return result;
 }
 
+MaskAnalyzer::MaskComponents MaskAnalyzer::detectMaskComponents(const uint8_t* const mask, const unsigned int width, const unsigned int height, const unsigned int maskPaddingElements, const uint8_t maskValue, const bool useNeighborhood4, const bool determineContours, uint32_t* labels, const unsigned int labelsPaddingElements, Worker* worker)
+{
+	ocean_assert(mask != nullptr);
+	ocean_assert(width >= 1u && height >= 1u);
+
+	// each band should cover a reasonable number of rows, as the bands need to be merged afterwards
+
+	constexpr unsigned int minimalRowsPerBand = 16u;
+
+	const unsigned int numberBands = worker != nullptr ? std::max(1u, std::min(worker->threads(), height / minimalRowsPerBand)) : 1u;
+
+	MaskRunBands bands(numberBands);
+
+	if (numberBands > 1u)
+	{
+		ocean_assert(worker != nullptr);
+		worker->executeFunction(Worker::Function::createStatic(&MaskAnalyzer::detectMaskRunsSubset, mask, width, height, maskPaddingElements, maskValue, useNeighborhood4, bands.data(), numberBands, 0u, 0u), 0u, numberBands, 8u, 9u, 1u);
+	}
+	else
+	{
+		detectMaskRunsSubset(mask, width, height, maskPaddingElements, maskValue, useNeighborhood4, bands.data(), numberBands, 0u, numberBands);
+	}
+
+	// merging the runs of all bands
+
+	size_t numberRuns = 0;
+
+	for (const MaskRunBand& band : bands)
+	{
+		numberRuns += band.runs_.size();
+	}
+
+	MaskRuns runs;
+	runs.reserve(numberRuns);
+
+	Indices32 parents;
+	parents.reserve(numberRuns);
+
+	Indices32 rowRunOffsets;
+	rowRunOffsets.reserve(height + 1u);
+
+	for (unsigned int bandIndex = 0u; bandIndex < numberBands; ++bandIndex)
+	{
+		const MaskRunBand& band = bands[bandIndex];
+
+		const Index32 runOffset = Index32(runs.size());
+
+		runs.insert(runs.cend(), band.runs_.cbegin(), band.runs_.cend());
+
+		for (const Index32 parent : band.parents_)
+		{
+			parents.emplace_back(parent + runOffset);
+		}
+
+		ocean_assert(!band.rowRunOffsets_.empty());
+
+		for (size_t n = 0; n < band.rowRunOffsets_.size() - 1; ++n)
+		{
+			rowRunOffsets.emplace_back(band.rowRunOffsets_[n] + runOffset);
+		}
+	}
+
+	ocean_assert(runs.size() == numberRuns);
+	ocean_assert(rowRunOffsets.size() == size_t(height));
+
+	rowRunOffsets.emplace_back(Index32(numberRuns));
+
+	for (unsigned int bandIndex = 1u; bandIndex < numberBands; ++bandIndex)
+	{
+		// joining the last row of the previous band with the first row of the current band
+
+		const unsigned int bandFirstRow = height * bandIndex / numberBands;
+		ocean_assert(bandFirstRow >= 1u);
+
+		joinRowRuns(runs.data(), parents.data(), rowRunOffsets[bandFirstRow - 1u], rowRunOffsets[bandFirstRow], rowRunOffsets[bandFirstRow], rowRunOffsets[bandFirstRow + 1u], useNeighborhood4);
+	}
+
+	// the root of each tree is the first run of the component in raster order, so that components are created in raster order of their seed positions
+
+	MaskComponents components;
+
+	Indices32 runLabels(numberRuns);
+
+	for (size_t runIndex = 0; runIndex < numberRuns; ++runIndex)
+	{
+		const MaskRun& run = runs[runIndex];
+
+		const Index32 rootIndex = findRoot(parents.data(), Index32(runIndex));
+
+		if (rootIndex == Index32(runIndex))
+		{
+			components.emplace_back((unsigned int)(components.size()) + 1u, PixelPosition(run.start_, run.y_));
+			runLabels[runIndex] = Index32(components.size());
+		}
+		else
+		{
+			ocean_assert(rootIndex < Index32(runIndex));
+			runLabels[runIndex] = runLabels[rootIndex];
+		}
+
+		components[runLabels[runIndex] - 1u].addRun(run.y_, run.start_, run.end_, width, height);
+	}
+
+	if (labels == nullptr && !determineContours)
+	{
+		return components;
+	}
+
+	Memory labelsMemory;
+	unsigned int internalLabelsPaddingElements = labelsPaddingElements;
+
+	if (labels == nullptr)
+	{
+		labelsMemory = Memory::create<uint32_t>(size_t(width) * size_t(height));
+		labels = labelsMemory.data<uint32_t>();
+
+		internalLabelsPaddingElements = 0u;
+	}
+
+	if (worker != nullptr)
+	{
+		worker->executeFunction(Worker::Function::createStatic(&MaskAnalyzer::writeLabelsSubset, (const MaskRun*)(runs.data()), (const uint32_t*)(runLabels.data()), (const Index32*)(rowRunOffsets.data()), width, labels, internalLabelsPaddingElements, 0u, 0u), 0u, height, 6u, 7u, 20u);
+	}
+	else
+	{
+		writeLabelsSubset(runs.data(), runLabels.data(), rowRunOffsets.data(), width, labels, internalLabelsPaddingElements, 0u, height);
+	}
+
+	if (determineContours)
+	{
+		for (MaskComponent& component : components)
+		{
+			component.contour_ = PixelContour(traceOuterContour(labels, width, height, internalLabelsPaddingElements, component.seedPosition()));
+		}
+	}
+
+	return components;
+}
+
+void MaskAnalyzer::detectMaskRunsSubset(const uint8_t* const mask, const unsigned int width, const unsigned int height, const unsigned int maskPaddingElements, const uint8_t maskValue, const bool useNeighborhood4, MaskRunBand* bands, const unsigned int numberAllBands, const unsigned int firstBand, const unsigned int numberBands)
+{
+	ocean_assert(mask != nullptr && bands != nullptr);
+	ocean_assert(width >= 1u && height >= 1u);
+	ocean_assert(numberAllBands >= 1u && numberAllBands <= height);
+	ocean_assert(firstBand + numberBands <= numberAllBands);
+
+	const unsigned int maskStrideElements = width + maskPaddingElements;
+
+	for (unsigned int bandIndex = firstBand; bandIndex < firstBand + numberBands; ++bandIndex)
+	{
+		const unsigned int bandFirstRow = height * bandIndex / numberAllBands;
+		const unsigned int bandEndRow = height * (bandIndex + 1u) / numberAllBands;
+		ocean_assert(bandFirstRow < bandEndRow);
+
+		MaskRunBand& band = bands[bandIndex];
+
+		band.runs_.clear();
+		band.parents_.clear();
+
+		band.rowRunOffsets_.clear();
+		band.rowRunOffsets_.reserve(bandEndRow - bandFirstRow + 1u);
+
+		for (unsigned int y = bandFirstRow; y < bandEndRow; ++y)
+		{
+			const uint8_t* const row = mask + y * maskStrideElements;
+
+			const Index32 rowRunOffset = Index32(band.runs_.size());
+			band.rowRunOffsets_.emplace_back(rowRunOffset);
+
+			unsigned int x = findRunEnd<false>(row, 0u, width, maskValue);
+
+			while (x < width)
+			{
+				const unsigned int runEnd = findRunEnd<true>(row, x + 1u, width, maskValue);
+
+				band.parents_.emplace_back(Index32(band.runs_.size()));
+				band.runs_.emplace_back(y, x, runEnd);
+
+				x = runEnd < width ? findRunEnd<false>(row, runEnd + 1u, width, maskValue) : width;
+			}
+
+			if (y != bandFirstRow)
+			{
+				joinRowRuns(band.runs_.data(), band.parents_.data(), band.rowRunOffsets_[y - bandFirstRow - 1u], rowRunOffset, rowRunOffset, Index32(band.runs_.size()), useNeighborhood4);
+			}
+		}
+
+		band.rowRunOffsets_.emplace_back(Index32(band.runs_.size()));
+	}
+}
+
+void MaskAnalyzer::writeLabelsSubset(const MaskRun* runs, const uint32_t* runLabels, const Index32* rowRunOffsets, const unsigned int width, uint32_t* labels, const unsigned int labelsPaddingElements, const unsigned int firstRow, const unsigned int numberRows)
+{
+	ocean_assert(runs != nullptr || rowRunOffsets[firstRow + numberRows] == 0u);
+	ocean_assert(runLabels != nullptr && rowRunOffsets != nullptr && labels != nullptr);
+
+	const unsigned int labelsStrideElements = width + labelsPaddingElements;
+
+	for (unsigned int y = firstRow; y < firstRow + numberRows; ++y)
+	{
+		uint32_t* const labelsRow = labels + y * labelsStrideElements;
+
+		unsigned int x = 0u;
+
+		for (Index32 runIndex = rowRunOffsets[y]; runIndex < rowRunOffsets[y + 1u]; ++runIndex)
+		{
+			const MaskRun& run = runs[runIndex];
+			ocean_assert(run.y_ == y && x <= run.start_);
+
+			std::fill(labelsRow + x, labelsRow + run.start_, 0u);
+			std::fill(labelsRow + run.start_, labelsRow + run.end_, runLabels[runIndex]);
+
+			x = run.end_;
+		}
+
+		std::fill(labelsRow + x, labelsRow + width, 0u);
+	}
+}
+
+PixelPositions MaskAnalyzer::traceOuterContour(const uint32_t* const labels, const unsigned int width, const unsigned int height, const unsigned int labelsPaddingElements, const PixelPosition& seedPosition)
+{
+	ocean_assert(labels != nullptr);
+	ocean_assert(seedPosition.x() < width && seedPosition.y() < height);
+
+	const unsigned int labelsStrideElements = width + labelsPaddingElements;
+
+	const uint32_t label = labels[seedPosition.y() * labelsStrideElements + seedPosition.x()];
+	ocean_assert(label != 0u);
+
+	// the eight neighbor directions in clockwise order (with y-axis pointing down), starting with east
+
+	constexpr int directionOffsetsX[8] = {1, 1, 0, -1, -1, -1, 0, 1};
+	constexpr int directionOffsetsY[8] = {0, 1, 1, 1, 0, -1, -1, -1};
+
+	const auto findNextDirection = [&](const unsigned int x, const unsigned int y, const unsigned int startDirection) -> unsigned int
+	{
+		for (unsigned int n = 0u; n < 8u; ++n)
+		{
+			const unsigned int direction = (startDirection + n) % 8u;
+
+			const unsigned int neighborX = x + (unsigned int)(directionOffsetsX[direction]);
+			const unsigned int neighborY = y + (unsigned int)(directionOffsetsY[direction]);
+
+			// negative coordinates wrap around and are therefore outside the frame as well
+
+			if (neighborX < width && neighborY < height && labels[neighborY * labelsStrideElements + neighborX] == label)
+			{
+				return direction;
+			}
+		}
+
+		return (unsigned int)(-1);
+	};
+
+	PixelPositions contour(1, seedPosition);
+
+	// the seed is the first pixel in raster order, so its western neighbor does not belong to the component
+
+	const unsigned int firstDirection = findNextDirection(seedPosition.x(), seedPosition.y(), 4u);
+
+	if (firstDirection == (unsigned int)(-1))
+	{
+		// the component is a single pixel
+		return contour;
+	}
+
+	unsigned int x = seedPosition.x() + (unsigned int)(directionOffsetsX[firstDirection]);
+	unsigned int y = seedPosition.y() + (unsigned int)(directionOffsetsY[firstDirection]);
+	unsigned int direction = firstDirection;
+
+	while (true)
+	{
+		// the search starts at the last non-component neighbor which has been visited before entering the current pixel
+
+		const unsigned int startDirection = (direction + 6u - (direction & 1u)) % 8u;
+
+		const unsigned int nextDirection = findNextDirection(x, y, startDirection);
+		ocean_assert(nextDirection < 8u);
+
+		if (x == seedPosition.x() && y == seedPosition.y() && nextDirection == firstDirection)
+		{
+			// Jacob's stopping criterion: we entered the seed again and would continue with the same move as at the beginning
+			break;
+		}
+
+		contour.emplace_back(x, y);
+
+		x += (unsigned int)(directionOffsetsX[nextDirection]);
+		y += (unsigned int)(directionOffsetsY[nextDirection]);
+		direction = nextDirection;
+	}
+
+	return contour;
+}
+
+template <bool tMaskRun>
+inline unsigned int MaskAnalyzer::findRunEnd(const uint8_t* const row, unsigned int x, const unsigned int width, const uint8_t maskValue)
+{
+	ocean_assert(row != nullptr);
+	ocean_assert(x <= width);
+
+#if defined(OCEAN_HARDWARE_SSE_VERSION) && OCEAN_HARDWARE_SSE_VERSION >= 41
+
+	const __m128i maskValue_u_8x16 = _mm_set1_epi8(char(maskValue));
+
+	while (x + 16u <= width)
+	{
+		const __m128i equal_u_8x16 = _mm_cmpeq_epi8(_mm_loadu_si128((const __m128i*)(row + x)), maskValue_u_8x16);
+
+		unsigned int candidateMask = (unsigned int)(_mm_movemask_epi8(equal_u_8x16));
+
+		if constexpr (tMaskRun)
+		{
+			candidateMask = ~candidateMask & 0xFFFFu;
+		}
+
+		if (candidateMask != 0u)
+		{
+			return x + (unsigned int)(std::countr_zero(candidateMask));
+		}
+
+		x += 16u;
+	}
+
+#elif defined(OCEAN_HARDWARE_NEON_VERSION) && OCEAN_HARDWARE_NEON_VERSION >= 10
+
+	const uint8x16_t maskValue_u_8x16 = vdupq_n_u8(maskValue);
+
+	while (x + 16u <= width)
+	{
+		uint8x16_t candidates_u_8x16 = vceqq_u8(vld1q_u8(row + x), maskValue_u_8x16);
+
+		if constexpr (tMaskRun)
+		{
+			candidates_u_8x16 = vmvnq_u8(candidates_u_8x16);
+		}
+
+		const uint64x2_t candidates_u_64x2 = vreinterpretq_u64_u8(candidates_u_8x16);
+
+		const uint64_t lowCandidates = vgetq_lane_u64(candidates_u_64x2, 0);
+
+		if (lowCandidates != 0ull)
+		{
+			return x + (unsigned int)(std::countr_zero(lowCandidates)) / 8u;
+		}
+
+		const uint64_t highCandidates = vgetq_lane_u64(candidates_u_64x2, 1);
+
+		if (highCandidates != 0ull)
+		{
+			return x + 8u + (unsigned int)(std::countr_zero(highCandidates)) / 8u;
+		}
+
+		x += 16u;
+	}
+
+#endif
+
+	while (x < width && (row[x] == maskValue) == tMaskRun)
+	{
+		++x;
+	}
+
+	return x;
+}
+
+inline Index32 MaskAnalyzer::findRoot(Index32* parents, Index32 index)
+{
+	ocean_assert(parents != nullptr);
+
+	while (parents[index] != index)
+	{
+		// path halving
+
+		parents[index] = parents[parents[index]];
+		index = parents[index];
+	}
+
+	return index;
+}
+
+inline void MaskAnalyzer::joinRuns(Index32* parents, const Index32 indexA, const Index32 indexB)
+{
+	const Index32 rootA = findRoot(parents, indexA);
+	const Index32 rootB = findRoot(parents, indexB);
+
+	if (rootA < rootB)
+	{
+		parents[rootB] = rootA;
+	}
+	else if (rootB < rootA)
+	{
+		parents[rootA] = rootB;
+	}
+}
+
+inline void MaskAnalyzer::joinRowRuns(const MaskRun* runs, Index32* parents, Index32 previousBegin, const Index32 previousEnd, Index32 currentBegin, const Index32 currentEnd, const bool useNeighborhood4)
+{
+	ocean_assert(previousBegin <= previousEnd && previousEnd <= currentBegin && currentBegin <= currentEnd);
+
+	while (previousBegin < previousEnd && currentBegin < currentEnd)
+	{
+		const MaskRun& previousRun = runs[previousBegin];
+		const MaskRun& currentRun = runs[currentBegin];
+
+		const bool connected = useNeighborhood4 ? (previousRun.start_ < currentRun.end_ && currentRun.start_ < previousRun.end_) : (previousRun.start_ <= currentRun.end_ && currentRun.start_ <= previousRun.end_);
+
+		if (connected)
+		{
+			joinRuns(parents, previousBegin, currentBegin);
+		}
+
+		// the run ending first cannot be connected with any further run of the other row
+
+		if (previousRun.end_ < currentRun.end_)
+		{
+			++previousBegin;
+		}
+		else if (currentRun.end_ < previousRun.end_)
+		{
+			++currentBegin;
+		}
+		else
+		{
+			++previousBegin;
+			++currentBegin;
+		}
+	}
+}
+
 } // namespace Segmentation
 
 } // namespace CV
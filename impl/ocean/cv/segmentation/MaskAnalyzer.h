@@ -18,6 +18,8 @@
 
 #include "ocean/cv/segmentation/PixelContour.h"
 
+#include "ocean/math/Vector2.h"
+
 #include <map>
 #include <set>
 #include <vector>
@@ -111,6 +113,121 @@ class OCEAN_CV_SEGMENTATION_EXPORT MaskAnalyzer
 		 */
 		using MaskBlocks = std::vector<MaskBlock>;
 
+		/**
+		 * This class holds the information of one connected component of mask pixels.
+		 * The component is described by statistics which are determined while the mask is labeled, and optionally by its outer contour.
+		 */
+		class OCEAN_CV_SEGMENTATION_EXPORT MaskComponent
+		{
+			friend class MaskAnalyzer;
+
+			public:
+
+				/**
+				 * Creates an invalid component object.
+				 */
+				inline MaskComponent() = default;
+
+				/**
+				 * Creates a new component object without any pixel.
+				 * @param id The id of the component, with range [1, infinity)
+				 * @param seedPosition The first pixel of the component in raster order
+				 */
+				inline MaskComponent(const unsigned int id, const PixelPosition& seedPosition);
+
+				/**
+				 * Returns the id of this component, which is the label of the component's pixels in a label frame.
+				 * @return The component's id, with range [1, infinity)
+				 */
+				inline unsigned int id() const;
+
+				/**
+				 * Returns the first pixel of this component in raster order (the top-most pixel, and the left-most pixel within the top row).
+				 * @return The component's seed position
+				 */
+				inline const PixelPosition& seedPosition() const;
+
+				/**
+				 * Returns the number of pixels of this component.
+				 * @return The component's size, in pixel, with range [1, infinity)
+				 */
+				inline unsigned int size() const;
+
+				/**
+				 * Returns the bounding box of this component.
+				 * @return The component's bounding box
+				 */
+				inline const PixelBoundingBox& boundingBox() const;
+
+				/**
+				 * Returns the center of mass of this component.
+				 * @return The component's center of mass, in pixel
+				 */
+				inline Vector2 centerOfMass() const;
+
+				/**
+				 * Returns whether this component touches the image border.
+				 * @return True, if so
+				 */
+				inline bool border() const;
+
+				/**
+				 * Returns the outer contour of this component, if determined.
+				 * The contour is dense (8-connected), starts at the seed position and is traced in clockwise order (y-axis pointing down).
+				 * @return The component's outer contour, empty if the contour has not been determined
+				 */
+				inline const PixelContour& contour() const;
+
+				/**
+				 * Returns whether this object holds a valid component.
+				 * @return True, if so
+				 */
+				inline bool isValid() const;
+
+			protected:
+
+				/**
+				 * Adds a horizontal run of mask pixels to this component.
+				 * @param y The row of the run, with range [0, height - 1]
+				 * @param start The horizontal start location of the run (inclusive), with range [0, width - 1]
+				 * @param end The horizontal end location of the run (exclusive), with range [start + 1, width]
+				 * @param width The width of the mask frame, in pixel, with range [1, infinity)
+				 * @param height The height of the mask frame, in pixel, with range [1, infinity)
+				 */
+				inline void addRun(const unsigned int y, const unsigned int start, const unsigned int end, const unsigned int width, const unsigned int height);
+
+			protected:
+
+				/// The id of the component.
+				unsigned int id_ = 0u;
+
+				/// The first pixel of the component in raster order.
+				PixelPosition seedPosition_;
+
+				/// The number of pixels of the component.
+				unsigned int size_ = 0u;
+
+				/// The bounding box of the component.
+				PixelBoundingBox boundingBox_;
+
+				/// The sum of all horizontal pixel coordinates.
+				uint64_t sumX_ = 0ull;
+
+				/// The sum of all vertical pixel coordinates.
+				uint64_t sumY_ = 0ull;
+
+				/// True, if the component touches the image border.
+				bool border_ = false;
+
+				/// The outer contour of the component, if determined.
+				PixelContour contour_;
+		};
+
+		/**
+		 * Definition of a vector holding mask component objects.
+		 */
+		using MaskComponents = std::vector<MaskComponent>;
+
 	protected:
 
 		/**
@@ -245,6 +362,60 @@ class OCEAN_CV_SEGMENTATION_EXPORT MaskAnalyzer
 		 */
 		using SweepMaskIslands = std::vector<SweepMaskIsland>;
 
+		/**
+		 * This class implements a horizontal run of mask pixels within one row.
+		 */
+		class MaskRun
+		{
+			public:
+
+				/**
+				 * Creates a new run object.
+				 * @param y The row of the run, with range [0, infinity)
+				 * @param start The horizontal start location of the run (inclusive), with range [0, infinity)
+				 * @param end The horizontal end location of the run (exclusive), with range [start + 1, infinity)
+				 */
+				inline MaskRun(const unsigned int y, const unsigned int start, const unsigned int end);
+
+			public:
+
+				/// The row of the run.
+				unsigned int y_ = 0u;
+
+				/// The horizontal start location of the run (inclusive).
+				unsigned int start_ = 0u;
+
+				/// The horizontal end location of the run (exclusive).
+				unsigned int end_ = 0u;
+		};
+
+		/**
+		 * Definition of a vector holding runs.
+		 */
+		using MaskRuns = std::vector<MaskRun>;
+
+		/**
+		 * This class holds the runs of a horizontal band of mask rows together with the band-local union-find forest of the runs.
+		 */
+		class MaskRunBand
+		{
+			public:
+
+				/// The runs of the band, in raster order.
+				MaskRuns runs_;
+
+				/// The index of the first run of each row of the band, followed by the overall number of runs.
+				Indices32 rowRunOffsets_;
+
+				/// The parent index of each run, band-local.
+				Indices32 parents_;
+		};
+
+		/**
+		 * Definition of a vector holding run bands.
+		 */
+		using MaskRunBands = std::vector<MaskRunBand>;
+
 	public:
 
 		/**
@@ -603,8 +774,108 @@ class OCEAN_CV_SEGMENTATION_EXPORT MaskAnalyzer
 		 */
 		static PixelBoundingBoxes detectBoundingBoxes(const uint8_t* const mask, const unsigned int width, const unsigned int height, const unsigned int maskPaddingElements, const uint8_t maskValue, const bool useNeighborhood4 = true);
 
+		/**
+		 * Determines all connected components of mask pixels in a binary (but 8-bit) mask frame within one labeling pass.
+		 * The function extracts horizontal runs of mask pixels and connects the runs of neighboring rows with a union-find structure.<br>
+		 * The rows are distributed in horizontal bands which are handled in parallel; the bands are merged afterwards.<br>
+		 * The statistics of each component (size, bounding box, center of mass, border) are accumulated per run so that no per-pixel pass is necessary.<br>
+		 * The components are ordered in raster order of their seed positions, the id of a component is its index + 1.
+		 * @param mask The binary mask in which the components are located, must be valid
+		 * @param width The width of the mask frame, in pixel, with range [1, infinity)
+		 * @param height The height of the mask frame, in pixel, with range [1, infinity)
+		 * @param maskPaddingElements The number of padding elements at the end of each mask row, in elements, with range [0, infinity)
+		 * @param maskValue The value of a mask pixel, with range [0, 255]
+		 * @param useNeighborhood4 True, to use a 4-connected neighborhood when determining the components; False, to use a 8-connected neighborhood
+		 * @param determineContours True, to determine the outer contour of each component
+		 * @param labels Optional resulting label frame receiving the component id of each mask pixel and 0 for each non-mask pixel, with same frame dimension as the mask, nullptr if not of interest
+		 * @param labelsPaddingElements The number of padding elements at the end of each label row, in elements, with range [0, infinity)
+		 * @param worker Optional worker object to distribute the computation
+		 * @return The resulting components
+		 * @see detectBoundingBoxes(), analyzeMaskSeparation8Bit().
+		 */
+		static MaskComponents detectMaskComponents(const uint8_t* const mask, const unsigned int width, const unsigned int height, const unsigned int maskPaddingElements, const uint8_t maskValue, const bool useNeighborhood4 = true, const bool determineContours = false, uint32_t* labels = nullptr, const unsigned int labelsPaddingElements = 0u, Worker* worker = nullptr);
+
 	protected:
 
+		/**
+		 * Extracts the runs of mask pixels of a subset of horizontal bands and connects the runs within each band.
+		 * @param mask The binary mask in which the components are located, must be valid
+		 * @param width The width of the mask frame, in pixel, with range [1, infinity)
+		 * @param height The height of the mask frame, in pixel, with range [1, infinity)
+		 * @param maskPaddingElements The number of padding elements at the end of each mask row, in elements, with range [0, infinity)
+		 * @param maskValue The value of a mask pixel, with range [0, 255]
+		 * @param useNeighborhood4 True, to use a 4-connected neighborhood; False, to use a 8-connected neighborhood
+		 * @param bands The bands receiving the runs, must be valid
+		 * @param numberAllBands The overall number of bands, with range [1, height]
+		 * @param firstBand The first band to be handled, with range [0, numberAllBands - 1]
+		 * @param numberBands The number of bands to be handled, with range [1, numberAllBands - firstBand]
+		 */
+		static void detectMaskRunsSubset(const uint8_t* const mask, const unsigned int width, const unsigned int height, const unsigned int maskPaddingElements, const uint8_t maskValue, const bool useNeighborhood4, MaskRunBand* bands, const unsigned int numberAllBands, const unsigned int firstBand, const unsigned int numberBands);
+
+		/**
+		 * Writes the labels of a subset of runs into a label frame.
+		 * @param runs The runs of all bands, in raster order, must be valid
+		 * @param runLabels The label of each run, one for each run, must be valid
+		 * @param rowRunOffsets The index of the first run of each row, followed by the overall number of runs, height + 1 elements, must be valid
+		 * @param width The width of the label frame, in pixel, with range [1, infinity)
+		 * @param labels The label frame receiving the labels, must be valid
+		 * @param labelsPaddingElements The number of padding elements at the end of each label row, in elements, with range [0, infinity)
+		 * @param firstRow The first row to be handled, with range [0, height - 1]
+		 * @param numberRows The number of rows to be handled, with range [1, height - firstRow]
+		 */
+		static void writeLabelsSubset(const MaskRun* runs, const uint32_t* runLabels, const Index32* rowRunOffsets, const unsigned int width, uint32_t* labels, const unsigned int labelsPaddingElements, const unsigned int firstRow, const unsigned int numberRows);
+
+		/**
+		 * Determines the outer contour of a component in a label frame by Moore-neighbor tracing.
+		 * @param labels The label frame, must be valid
+		 * @param width The width of the label frame, in pixel, with range [1, infinity)
+		 * @param height The height of the label frame, in pixel, with range [1, infinity)
+		 * @param labelsPaddingElements The number of padding elements at the end of each label row, in elements, with range [0, infinity)
+		 * @param seedPosition The first pixel of the component in raster order, must be valid
+		 * @return The resulting contour, starting at the seed position, in clockwise order
+		 */
+		static PixelPositions traceOuterContour(const uint32_t* const labels, const unsigned int width, const unsigned int height, const unsigned int labelsPaddingElements, const PixelPosition& seedPosition);
+
+		/**
+		 * Returns the first location within a row at which a run of mask pixels (or non-mask pixels) ends.
+		 * @param row The row to scan, must be valid
+		 * @param x The horizontal location at which the scan starts, with range [0, width]
+		 * @param width The width of the row, in pixel, with range [1, infinity)
+		 * @param maskValue The value of a mask pixel, with range [0, 255]
+		 * @return The first location in [x, width) at which the pixel does not match the run type, width if the run reaches the end of the row
+		 * @tparam tMaskRun True, to find the end of a run of mask pixels; False, to find the end of a run of non-mask pixels
+		 */
+		template <bool tMaskRun>
+		static inline unsigned int findRunEnd(const uint8_t* const row, unsigned int x, const unsigned int width, const uint8_t maskValue);
+
+		/**
+		 * Returns the root of a run in a union-find forest, the path of the run is compressed.
+		 * @param parents The parent index of each run, must be valid
+		 * @param index The index of the run, with range [0, parents.size() - 1]
+		 * @return The index of the root run
+		 */
+		static inline Index32 findRoot(Index32* parents, Index32 index);
+
+		/**
+		 * Joins the trees of two runs in a union-find forest, the root with smaller index becomes the root of the joined tree.
+		 * @param parents The parent index of each run, must be valid
+		 * @param indexA The index of the first run
+		 * @param indexB The index of the second run
+		 */
+		static inline void joinRuns(Index32* parents, const Index32 indexA, const Index32 indexB);
+
+		/**
+		 * Joins the runs of two neighboring rows which are connected.
+		 * @param runs The runs, must be valid
+		 * @param parents The parent index of each run, must be valid
+		 * @param previousBegin The index of the first run in the previous row
+		 * @param previousEnd The index of the end run in the previous row (exclusive)
+		 * @param currentBegin The index of the first run in the current row
+		 * @param currentEnd The index of the end run in the current row (exclusive)
+		 * @param useNeighborhood4 True, to use a 4-connected neighborhood; False, to use a 8-connected neighborhood
+		 */
+		static inline void joinRowRuns(const MaskRun* runs, Index32* parents, Index32 previousBegin, const Index32 previousEnd, Index32 currentBegin, const Index32 currentEnd, const bool useNeighborhood4);
+
 		/**
 		 * Determines the border pixels in a subset of a 8 bit mask frame for a 4-neighborhood.
 		 * @param mask Given binary 8 bit mask frame, pixel values not equal `nonMaskValue` count as mask pixels
@@ -728,6 +999,71 @@ inline bool MaskAnalyzer::MaskBlock::operator<(const MaskBlock& block) const
 	return blockSize < block.blockSize;
 }
 
+inline MaskAnalyzer::MaskComponent::MaskComponent(const unsigned int id, const PixelPosition& seedPosition) :
+	id_(id),
+	seedPosition_(seedPosition)
+{
+	ocean_assert(id_ != 0u);
+}
+
+inline unsigned int MaskAnalyzer::MaskComponent::id() const
+{
+	return id_;
+}
+
+inline const PixelPosition& MaskAnalyzer::MaskComponent::seedPosition() const
+{
+	return seedPosition_;
+}
+
+inline unsigned int MaskAnalyzer::MaskComponent::size() const
+{
+	return size_;
+}
+
+inline const PixelBoundingBox& MaskAnalyzer::MaskComponent::boundingBox() const
+{
+	return boundingBox_;
+}
+
+inline Vector2 MaskAnalyzer::MaskComponent::centerOfMass() const
+{
+	ocean_assert(size_ != 0u);
+
+	return Vector2(Scalar(double(sumX_) / double(size_)), Scalar(double(sumY_) / double(size_)));
+}
+
+inline bool MaskAnalyzer::MaskComponent::border() const
+{
+	return border_;
+}
+
+inline const PixelContour& MaskAnalyzer::MaskComponent::contour() const
+{
+	return contour_;
+}
+
+inline bool MaskAnalyzer::MaskComponent::isValid() const
+{
+	return id_ != 0u && size_ != 0u;
+}
+
+inline void MaskAnalyzer::MaskComponent::addRun(const unsigned int y, const unsigned int start, const unsigned int end, const unsigned int width, const unsigned int height)
+{
+	ocean_assert(start < end && end <= width && y < height);
+
+	const unsigned int pixels = end - start;
+
+	size_ += pixels;
+
+	sumX_ += uint64_t(start + end - 1u) * uint64_t(pixels) / 2ull;
+	sumY_ += uint64_t(y) * uint64_t(pixels);
+
+	boundingBox_ = boundingBox_ || PixelBoundingBox(start, y, end - 1u, y);
+
+	border_ = border_ || start == 0u || end == width || y == 0u || y + 1u == height;
+}
+
 inline MaskAnalyzer::SweepMaskIsland::SweepMaskIsland(const unsigned int currentRow, const unsigned int start, const unsigned int end)
 {
 	ocean_assert(start < end);
@@ -786,6 +1122,14 @@ inline const PixelBoundingBox& MaskAnalyzer::SweepMaskIsland::boundingBox() cons
 	return boundingBox_;
 }
 
+inline MaskAnalyzer::MaskRun::MaskRun(const unsigned int y, const unsigned int start, const unsigned int end) :
+	y_(y),
+	start_(start),
+	end_(end)
+{
+	ocean_assert(start_ < end_);
+}
+
 template <bool tMaskValueIsEqual, typename T>
 inline bool MaskAnalyzer::hasMaskNeighbor4(const T* mask, const unsigned int width, const unsigned int height, const unsigned int maskPaddingElements, const PixelPosition& position, const T testValue)
 {
@@ -98,6 +98,328 @@ unsigned int SeedSegmentation::Comfort::iterativeSeedSegmentation(const Frame& f
 	return 0u;
 }
 
+
+unsigned int SeedSegmentation::determineRegion(const uint8_t* connectivity, const uint8_t* seedDistances, const unsigned int width, const unsigned int height, const PixelPosition& seed, const uint8_t globalThreshold, uint8_t* mask, const unsigned int maskPaddingElements, PixelBoundingBox& boundingBox, Indices32& parents, PixelPositions& runs, Worker* worker)
+{
+	ocean_assert(connectivity != nullptr && seedDistances != nullptr && mask != nullptr);
+	ocean_assert(seed.x() < width && seed.y() < height);
+
+	if (worker != nullptr && worker->threads() > 1u && height >= minimalBandRows_ * 2u)
+	{
+		parents.resize(width * height);
+
+		return labelRegion(connectivity, seedDistances, width, height, seed, globalThreshold, mask, maskPaddingElements, boundingBox, parents, *worker);
+	}
+
+	return scanlineRegion(connectivity, seedDistances, width, height, seed, globalThreshold, mask, maskPaddingElements, boundingBox, runs);
+}
+
+unsigned int SeedSegmentation::scanlineRegion(const uint8_t* connectivity, const uint8_t* seedDistances, const unsigned int width, const unsigned int height, const PixelPosition& seed, const uint8_t globalThreshold, uint8_t* mask, const unsigned int maskPaddingElements, PixelBoundingBox& boundingBox, PixelPositions& runs)
+{
+	ocean_assert(connectivity != nullptr && seedDistances != nullptr && mask != nullptr);
+	ocean_assert(seed.x() < width && seed.y() < height);
+	ocean_assert(seedDistances[seed.y() * width + seed.x()] == 0u);
+
+	const unsigned int maskStrideElements = width + maskPaddingElements;
+
+	// setting all mask values to unvisited
+
+	Frame(FrameType(width, height, FrameType::FORMAT_Y8, FrameType::ORIGIN_UPPER_LEFT), mask, Frame::CM_USE_KEEP_LAYOUT, maskPaddingElements).setValue(unvisitedMaskValue_);
+
+	boundingBox = PixelBoundingBox();
+
+	unsigned int counter = 0u;
+
+	// each stack entry is the start pixel of a run which will be extended to the left and to the right
+
+	runs.clear();
+	runs.emplace_back(seed);
+
+	while (!runs.empty())
+	{
+		const PixelPosition pixel = runs.back();
+		runs.pop_back();
+
+		const unsigned int y = pixel.y();
+
+		uint8_t* const maskRow = mask + y * maskStrideElements;
+
+		if (maskRow[pixel.x()] == visitedMaskValue_)
+		{
+			// the pixel has been covered by the run of another candidate already
+			continue;
+		}
+
+		const uint8_t* const connectivityRow = connectivity + y * width;
+		const uint8_t* const seedDistancesRow = seedDistances + y * width;
+
+		unsigned int left = pixel.x();
+		while (left > 0u && (connectivityRow[left - 1u] & connectedRight_) != 0u && seedDistancesRow[left - 1u] <= globalThreshold && maskRow[left - 1u] == unvisitedMaskValue_)
+		{
+			--left;
+		}
+
+		unsigned int right = pixel.x();
+		while (right + 1u < width && (connectivityRow[right] & connectedRight_) != 0u && seedDistancesRow[right + 1u] <= globalThreshold && maskRow[right + 1u] == unvisitedMaskValue_)
+		{
+			++right;
+		}
+
+		memset(maskRow + left, visitedMaskValue_, right - left + 1u);
+
+		counter += right - left + 1u;
+
+		boundingBox += PixelPosition(left, y);
+		boundingBox += PixelPosition(right, y);
+
+		// adding one candidate for each sequence of connected candidates in the row above and the row below
+
+		for (unsigned int n = 0u; n < 2u; ++n)
+		{
+			if ((n == 0u && y == 0u) || (n == 1u && y + 1u >= height))
+			{
+				continue;
+			}
+
+			const unsigned int neighborY = n == 0u ? y - 1u : y + 1u;
+
+			// the vertical connectivity is stored in the upper pixel of both pixels
+			const uint8_t* const verticalConnectivityRow = connectivity + min(y, neighborY) * width;
+
+			const uint8_t* const neighborConnectivityRow = connectivity + neighborY * width;
+			const uint8_t* const neighborSeedDistancesRow = seedDistances + neighborY * width;
+			const uint8_t* const neighborMaskRow = mask + neighborY * maskStrideElements;
+
+			bool previousCandidate = false;
+
+			for (unsigned int x = left; x <= right; ++x)
+			{
+				if ((verticalConnectivityRow[x] & connectedBottom_) != 0u && neighborSeedDistancesRow[x] <= globalThreshold && neighborMaskRow[x] == unvisitedMaskValue_)
+				{
+					// a candidate connected with the previous candidate will be covered by the same run
+					if (!previousCandidate || (neighborConnectivityRow[x - 1u] & connectedRight_) == 0u)
+					{
+						runs.emplace_back(x, neighborY);
+					}
+
+					previousCandidate = true;
+				}
+				else
+				{
+					previousCandidate = false;
+				}
+			}
+		}
+	}
+
+	return counter;
+}
+
+unsigned int SeedSegmentation::labelRegion(const uint8_t* connectivity, const uint8_t* seedDistances, const unsigned int width, const unsigned int height, const PixelPosition& seed, const uint8_t globalThreshold, uint8_t* mask, const unsigned int maskPaddingElements, PixelBoundingBox& boundingBox, Indices32& parents, Worker& worker)
+{
+	ocean_assert(connectivity != nullptr && seedDistances != nullptr && mask != nullptr);
+	ocean_assert(seed.x() < width && seed.y() < height);
+	ocean_assert(parents.size() == width * height);
+
+	const unsigned int threads = max(1u, worker.threads());
+
+	const unsigned int bandRows = max(minimalBandRows_, (height + threads - 1u) / threads);
+	const unsigned int numberBands = (height + bandRows - 1u) / bandRows;
+
+	Index32* const labels = parents.data();
+
+	worker.executeFunction(Worker::Function::createStatic(&SeedSegmentation::labelBandsSubset, connectivity, seedDistances, width, height, globalThreshold, bandRows, labels, 0u, 0u), 0u, numberBands, 7u, 8u, 1u);
+
+	// merging the labels of connected pixels along the borders between two bands
+
+	for (unsigned int band = 1u; band < numberBands; ++band)
+	{
+		const unsigned int y = band * bandRows;
+
+		for (unsigned int x = 0u; x < width; ++x)
+		{
+			const Index32 index = y * width + x;
+			const Index32 topIndex = index - width;
+
+			if (labels[index] != invalidLabel_ && labels[topIndex] != invalidLabel_ && (connectivity[topIndex] & connectedBottom_) != 0u)
+			{
+				const Index32 root = findRoot(labels, index);
+				const Index32 topRoot = findRoot(labels, topIndex);
+
+				if (root < topRoot)
+				{
+					labels[topRoot] = root;
+				}
+				else if (topRoot < root)
+				{
+					labels[root] = topRoot;
+				}
+			}
+		}
+	}
+
+	const Index32 seedLabel = findRoot(labels, seed.y() * width + seed.x());
+
+	std::vector<unsigned int> bandPixels(numberBands, 0u);
+	std::vector<PixelBoundingBox> bandBoundingBoxes(numberBands);
+
+	worker.executeFunction(Worker::Function::createStatic(&SeedSegmentation::maskBandsSubset, width, height, bandRows, (const Index32*)(labels), seedLabel, mask, maskPaddingElements, bandPixels.data(), bandBoundingBoxes.data(), 0u, 0u), 0u, numberBands, 9u, 10u, 1u);
+
+	boundingBox = PixelBoundingBox();
+
+	unsigned int counter = 0u;
+
+	for (unsigned int band = 0u; band < numberBands; ++band)
+	{
+		counter += bandPixels[band];
+		boundingBox = boundingBox || bandBoundingBoxes[band];
+	}
+
+	return counter;
+}
+
+void SeedSegmentation::labelBandsSubset(const uint8_t* connectivity, const uint8_t* seedDistances, const unsigned int width, const unsigned int height, const uint8_t globalThreshold, const unsigned int bandRows, Index32* parents, const unsigned int firstBand, const unsigned int numberBands)
+{
+	ocean_assert(connectivity != nullptr && seedDistances != nullptr && parents != nullptr);
+	ocean_assert(bandRows >= 1u);
+
+	for (unsigned int band = firstBand; band < firstBand + numberBands; ++band)
+	{
+		const unsigned int bandFirstRow = band * bandRows;
+		const unsigned int bandEndRow = min(bandFirstRow + bandRows, height);
+
+		ocean_assert(bandFirstRow < height);
+
+		for (unsigned int y = bandFirstRow; y < bandEndRow; ++y)
+		{
+			for (unsigned int x = 0u; x < width; ++x)
+			{
+				const Index32 index = y * width + x;
+
+				if (seedDistances[index] > globalThreshold)
+				{
+					parents[index] = invalidLabel_;
+					continue;
+				}
+
+				parents[index] = index;
+
+				if (x != 0u && parents[index - 1u] != invalidLabel_ && (connectivity[index - 1u] & connectedRight_) != 0u)
+				{
+					parents[index] = findRoot(parents, index - 1u);
+				}
+
+				if (y != bandFirstRow && parents[index - width] != invalidLabel_ && (connectivity[index - width] & connectedBottom_) != 0u)
+				{
+					const Index32 root = findRoot(parents, index);
+					const Index32 topRoot = findRoot(parents, index - width);
+
+					// the root with larger index is linked to the root with smaller index, so that each parent has a smaller index than the child
+
+					if (root < topRoot)
+					{
+						parents[topRoot] = root;
+					}
+					else if (topRoot < root)
+					{
+						parents[root] = topRoot;
+					}
+				}
+			}
+		}
+
+		// flattening all labels of the band, as each parent has a smaller index the parents are final already when visiting the child
+
+		for (Index32 index = bandFirstRow * width; index < bandEndRow * width; ++index)
+		{
+			if (parents[index] != invalidLabel_)
+			{
+				parents[index] = parents[parents[index]];
+			}
+		}
+	}
+}
+
+void SeedSegmentation::maskBandsSubset(const unsigned int width, const unsigned int height, const unsigned int bandRows, const Index32* parents, const Index32 seedLabel, uint8_t* mask, const unsigned int maskPaddingElements, unsigned int* bandPixels, PixelBoundingBox* bandBoundingBoxes, const unsigned int firstBand, const unsigned int numberBands)
+{
+	ocean_assert(parents != nullptr && mask != nullptr);
+	ocean_assert(bandPixels != nullptr && bandBoundingBoxes != nullptr);
+
+	const unsigned int maskStrideElements = width + maskPaddingElements;
+
+	for (unsigned int band = firstBand; band < firstBand + numberBands; ++band)
+	{
+		const unsigned int bandFirstRow = band * bandRows;
+		const unsigned int bandEndRow = min(bandFirstRow + bandRows, height);
+
+		unsigned int counter = 0u;
+		PixelBoundingBox boundingBox;
+
+		// after merging, a band-local root may have a parent in a previous band, so that the last resolved label is cached
+
+		Index32 previousLabel = invalidLabel_;
+		bool previousInRegion = false;
+
+		for (unsigned int y = bandFirstRow; y < bandEndRow; ++y)
+		{
+			const Index32* const parentsRow = parents + y * width;
+			uint8_t* const maskRow = mask + y * maskStrideElements;
+
+			unsigned int rowLeft = width;
+			unsigned int rowRight = 0u;
+
+			for (unsigned int x = 0u; x < width; ++x)
+			{
+				const Index32 label = parentsRow[x];
+
+				if (label != previousLabel)
+				{
+					previousLabel = label;
+
+					if (label == invalidLabel_)
+					{
+						previousInRegion = false;
+					}
+					else
+					{
+						Index32 root = label;
+
+						while (parents[root] != root)
+						{
+							root = parents[root];
+						}
+
+						previousInRegion = root == seedLabel;
+					}
+				}
+
+				if (previousInRegion)
+				{
+					maskRow[x] = visitedMaskValue_;
+
+					rowLeft = min(rowLeft, x);
+					rowRight = x;
+
+					++counter;
+				}
+				else
+				{
+					maskRow[x] = unvisitedMaskValue_;
+				}
+			}
+
+			if (rowLeft <= rowRight)
+			{
+				boundingBox += PixelPosition(rowLeft, y);
+				boundingBox += PixelPosition(rowRight, y);
+			}
+		}
+
+		bandPixels[band] = counter;
+		bandBoundingBoxes[band] = boundingBox;
+	}
+}
+
 }
 
 }
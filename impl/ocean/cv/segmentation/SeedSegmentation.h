@@ -19,6 +19,12 @@
 
 #include "ocean/cv/segmentation/MaskAnalyzer.h"
 
+#if defined(OCEAN_HARDWARE_SSE_VERSION) && OCEAN_HARDWARE_SSE_VERSION >= 41
+	#include "ocean/cv/SSE.h"
+#elif defined(OCEAN_HARDWARE_NEON_VERSION) && OCEAN_HARDWARE_NEON_VERSION >= 10
+	#include "ocean/cv/NEON.h"
+#endif
+
 namespace Ocean
 {
 
@@ -124,6 +130,18 @@ class OCEAN_CV_SEGMENTATION_EXPORT SeedSegmentation
 		/// Mask value for visited mask pixels.
 		static constexpr uint8_t visitedMaskValue_ = 0x00u;
 
+		/// Connectivity flag for pixels which are similar to their right neighbor.
+		static constexpr uint8_t connectedRight_ = 0x01u;
+
+		/// Connectivity flag for pixels which are similar to their bottom neighbor.
+		static constexpr uint8_t connectedBottom_ = 0x02u;
+
+		/// The minimal number of rows of one band when labeling the frame in parallel.
+		static constexpr unsigned int minimalBandRows_ = 32u;
+
+		/// The label of pixels which cannot be part of the region.
+		static constexpr Index32 invalidLabel_ = Index32(-1);
+
 	public:
 
 		/**
@@ -197,8 +215,151 @@ class OCEAN_CV_SEGMENTATION_EXPORT SeedSegmentation
 		template <unsigned int tChannels>
 		static unsigned int seedSegmentationArea8BitPerChannel(const uint32_t* borderedIntegral, const unsigned int width, const unsigned int height, const unsigned int integralBorder, const unsigned int areaSize, const unsigned int maskPaddingElements, const PixelPosition& seed, const unsigned char localThreshold, const unsigned char globalThreshold, uint8_t* mask, PixelBoundingBox* boundingBox = nullptr);
 
+		/**
+		 * Determines the seed segmentation in a frame with 8 bit per channel by growing the region in horizontal runs instead of single pixels.<br>
+		 * The resulting mask is identical to the mask of seedSegmentation(), however the similarity tests between neighboring pixels are determined for entire rows in advance with SIMD instructions.<br>
+		 * When using a worker, the frame is separated into horizontal bands which are labeled in parallel, the labels are merged at the band borders afterwards.<br>
+		 * The thresholds will be applied to each color channel separately.
+		 * @param frame The frame holding the frame data in which the seed segmentation is determined, must be valid
+		 * @param mask Resulting 8 bit binary mask defining the segmentation, a value of 0x00 defines a mask pixel, 0xFF defines a non-mask pixel
+		 * @param width The width of the frame in pixel, with range [1, infinity)
+		 * @param height The height of the frame in pixel, with range [1, infinity)
+		 * @param framePaddingElements The number of padding elements at the end of each frame row, in elements, with range [0, infinity)
+		 * @param maskPaddingElements The number of padding elements at the end of each mask row, in elements, with range [0, infinity)
+		 * @param seed The seed position in the frame, with range ([0, width)x[0, height))
+		 * @param localThreshold The local threshold for neighboring pixels, with range [0, 255]
+		 * @param globalThreshold Optional global threshold for the seed pixel and any candidate pixel, with range [0, 255], 0 to disable the global threshold
+		 * @param boundingBox Optional resulting bounding box covering the entire mask area
+		 * @param worker Optional worker object to distribute the computation
+		 * @return Number of selected mask pixels defining the segmentation, with range [1, width * height]
+		 * @tparam tChannels The number of data channels of the given frame, with range [1, infinity)
+		 */
+		template <unsigned int tChannels>
+		static unsigned int scanlineSeedSegmentation8BitPerChannel(const uint8_t* frame, uint8_t* mask, const unsigned int width, const unsigned int height, const unsigned int framePaddingElements, const unsigned int maskPaddingElements, const PixelPosition& seed, const uint8_t localThreshold, const uint8_t globalThreshold = 0u, PixelBoundingBox* boundingBox = nullptr, Worker* worker = nullptr);
+
+		/**
+		 * Determines the seed segmentation in a frame with 8 bit per channel within several iterations by growing the region in horizontal runs instead of single pixels.<br>
+		 * The first mask is determined with the minimal global threshold, the global threshold is then increased by one in each iteration until the maximal global threshold is reached.<br>
+		 * The mask determination stops in the moment the number of mask pixels (the size of the mask) exceed the previous number of mask pixel by a specified factor.<br>
+		 * The similarity tests between neighboring pixels are determined once for all iterations, each iteration is a scanline flood fill, or a parallel labeling of horizontal bands when using a worker.
+		 * @param frame The frame holding the frame data in which the seed segmentation is determined, must be valid
+		 * @param mask Resulting 8 bit binary mask defining the segmentation, a value of 0x00 defines a mask pixel, 0xFF defines a non-mask pixel
+		 * @param width The width of the frame in pixel, with range [1, infinity)
+		 * @param height The height of the frame in pixel, with range [1, infinity)
+		 * @param framePaddingElements The number of padding elements at the end of each frame row, in elements, with range [0, infinity)
+		 * @param maskPaddingElements The number of padding elements at the end of each mask row, in elements, with range [0, infinity)
+		 * @param seed The seed position in the frame, with range ([0, width)x[0, height))
+		 * @param localThreshold The local threshold for neighboring pixels, with range [0, 255]
+		 * @param minimalGlobalThreshold The initial global threshold for the seed pixel and any candidate pixel, with range [1, maximalGlobalThreshold]
+		 * @param maximalGlobalThreshold The maximal global threshold for the seed pixel and any candidate pixel, with range [minimalGlobalThreshold, 255]
+		 * @param maximalIncreaseFactor The maximal increase factor between the size of two successive mask so that the iterative process goes on
+		 * @param boundingBox Optional resulting bounding box covering the entire mask area
+		 * @param worker Optional worker object to distribute the computation
+		 * @return Number of selected mask pixels defining the segmentation, with range [1, width * height]
+		 * @tparam tChannels The number of data channels of the given frame, with range [1, infinity)
+		 */
+		template <unsigned int tChannels>
+		static unsigned int iterativeScanlineSeedSegmentation8BitPerChannel(const uint8_t* frame, uint8_t* mask, const unsigned int width, const unsigned int height, const unsigned int framePaddingElements, const unsigned int maskPaddingElements, const PixelPosition& seed, const uint8_t localThreshold, const uint8_t minimalGlobalThreshold, const uint8_t maximalGlobalThreshold, const unsigned int maximalIncreaseFactor, PixelBoundingBox* boundingBox = nullptr, Worker* worker = nullptr);
+
 	private:
 
+		/**
+		 * Determines the connectivity flags and the distances to the seed pixel for a subset of rows of a frame with 8 bit per channel.
+		 * A pixel receives the flag connectedRight_ (connectedBottom_) if no channel of the pixel differs by more than the local threshold from the right (bottom) neighbor.<br>
+		 * The distance to the seed pixel is the maximal absolute channel difference between the pixel and the seed pixel.
+		 * @param frame The frame for which the connectivity will be determined, must be valid
+		 * @param width The width of the frame in pixel, with range [1, infinity)
+		 * @param height The height of the frame in pixel, with range [1, infinity)
+		 * @param framePaddingElements The number of padding elements at the end of each frame row, in elements, with range [0, infinity)
+		 * @param seedPixel The channel values of the seed pixel, must be valid
+		 * @param localThreshold The local threshold for neighboring pixels, with range [0, 255]
+		 * @param connectivity The resulting connectivity flags, one for each pixel without padding, must be valid
+		 * @param seedDistances The resulting distances to the seed pixel, one for each pixel without padding, must be valid
+		 * @param firstRow The first row to be handled, with range [0, height - 1]
+		 * @param numberRows The number of rows to be handled, with range [1, height - firstRow]
+		 * @tparam tChannels The number of data channels of the given frame, with range [1, infinity)
+		 */
+		template <unsigned int tChannels>
+		static void determineConnectivity8BitPerChannelSubset(const uint8_t* frame, const unsigned int width, const unsigned int height, const unsigned int framePaddingElements, const uint8_t* seedPixel, const uint8_t localThreshold, uint8_t* connectivity, uint8_t* seedDistances, const unsigned int firstRow, const unsigned int numberRows);
+
+		/**
+		 * Determines the element-wise absolute differences between two buffers with 8 bit elements.
+		 * @param values0 The first buffer, must be valid
+		 * @param values1 The second buffer, must be valid
+		 * @param differences The resulting absolute differences, must be valid
+		 * @param elements The number of elements in each buffer, with range [0, infinity)
+		 */
+		static inline void absoluteDifferences8Bit(const uint8_t* values0, const uint8_t* values1, uint8_t* differences, const unsigned int elements);
+
+		/**
+		 * Determines the region connected with the seed pixel based on precomputed connectivity flags and seed distances.
+		 * Without worker (or for small frames), the region is determined with a scanline flood fill, otherwise with a parallel labeling of horizontal bands.
+		 * @param connectivity The connectivity flags of all pixels, must be valid
+		 * @param seedDistances The distances of all pixels to the seed pixel, must be valid
+		 * @param width The width of the frame in pixel, with range [1, infinity)
+		 * @param height The height of the frame in pixel, with range [1, infinity)
+		 * @param seed The seed position, with range ([0, width)x[0, height))
+		 * @param globalThreshold The maximal distance to the seed pixel a region pixel can have, with range [0, 255]
+		 * @param mask The resulting mask, 0x00 for region pixels, 0xFF for all other pixels, must be valid
+		 * @param maskPaddingElements The number of padding elements at the end of each mask row, in elements, with range [0, infinity)
+		 * @param boundingBox The resulting bounding box of the region
+		 * @param parents Reusable memory for the labels of the parallel labeling
+		 * @param runs Reusable memory for the stack of the scanline flood fill
+		 * @param worker Optional worker object to distribute the computation
+		 * @return The number of region pixels, with range [1, width * height]
+		 */
+		static unsigned int determineRegion(const uint8_t* connectivity, const uint8_t* seedDistances, const unsigned int width, const unsigned int height, const PixelPosition& seed, const uint8_t globalThreshold, uint8_t* mask, const unsigned int maskPaddingElements, PixelBoundingBox& boundingBox, Indices32& parents, PixelPositions& runs, Worker* worker);
+
+		/**
+		 * Determines the region connected with the seed pixel with a scanline flood fill handling entire runs of connected pixels at once.
+		 * @see determineRegion().
+		 */
+		static unsigned int scanlineRegion(const uint8_t* connectivity, const uint8_t* seedDistances, const unsigned int width, const unsigned int height, const PixelPosition& seed, const uint8_t globalThreshold, uint8_t* mask, const unsigned int maskPaddingElements, PixelBoundingBox& boundingBox, PixelPositions& runs);
+
+		/**
+		 * Determines the region connected with the seed pixel by labeling horizontal bands in parallel and merging the labels at the band borders.
+		 * @see determineRegion().
+		 */
+		static unsigned int labelRegion(const uint8_t* connectivity, const uint8_t* seedDistances, const unsigned int width, const unsigned int height, const PixelPosition& seed, const uint8_t globalThreshold, uint8_t* mask, const unsigned int maskPaddingElements, PixelBoundingBox& boundingBox, Indices32& parents, Worker& worker);
+
+		/**
+		 * Labels a subset of horizontal bands with a union-find, each label is the smallest pixel index of the connected component within the band.
+		 * @param connectivity The connectivity flags of all pixels, must be valid
+		 * @param seedDistances The distances of all pixels to the seed pixel, must be valid
+		 * @param width The width of the frame in pixel, with range [1, infinity)
+		 * @param height The height of the frame in pixel, with range [1, infinity)
+		 * @param globalThreshold The maximal distance to the seed pixel a region pixel can have, with range [0, 255]
+		 * @param bandRows The number of rows of each band, with range [1, height]
+		 * @param parents The resulting parent index of each pixel, invalid for pixels exceeding the global threshold, must be valid
+		 * @param firstBand The first band to be handled
+		 * @param numberBands The number of bands to be handled
+		 */
+		static void labelBandsSubset(const uint8_t* connectivity, const uint8_t* seedDistances, const unsigned int width, const unsigned int height, const uint8_t globalThreshold, const unsigned int bandRows, Index32* parents, const unsigned int firstBand, const unsigned int numberBands);
+
+		/**
+		 * Writes the mask of the region with a given label for a subset of horizontal bands.
+		 * @param width The width of the frame in pixel, with range [1, infinity)
+		 * @param height The height of the frame in pixel, with range [1, infinity)
+		 * @param bandRows The number of rows of each band, with range [1, height]
+		 * @param parents The merged parent indices of all pixels, must be valid
+		 * @param seedLabel The label of the region connected with the seed pixel
+		 * @param mask The resulting mask, must be valid
+		 * @param maskPaddingElements The number of padding elements at the end of each mask row, in elements, with range [0, infinity)
+		 * @param bandPixels The resulting number of region pixels in each band, must be valid
+		 * @param bandBoundingBoxes The resulting bounding boxes of the region pixels in each band, must be valid
+		 * @param firstBand The first band to be handled
+		 * @param numberBands The number of bands to be handled
+		 */
+		static void maskBandsSubset(const unsigned int width, const unsigned int height, const unsigned int bandRows, const Index32* parents, const Index32 seedLabel, uint8_t* mask, const unsigned int maskPaddingElements, unsigned int* bandPixels, PixelBoundingBox* bandBoundingBoxes, const unsigned int firstBand, const unsigned int numberBands);
+
+		/**
+		 * Returns the root label of a pixel and halves the path to the root.
+		 * @param parents The parent indices of all pixels, must be valid
+		 * @param index The index of the pixel, must not be invalid
+		 * @return The root label
+		 */
+		static inline Index32 findRoot(Index32* parents, Index32 index);
+
 		/**
 		 * Tests whether all channel-wise SSD values between two pixels are below a given threshold.
 		 * Each channel is tested separately, this function fails if one channel exceeds the threshold.
@@ -578,6 +739,230 @@ unsigned int SeedSegmentation::seedSegmentationArea8BitPerChannel(const uint32_t
 	return counter;
 }
 
+template <unsigned int tChannels>
+unsigned int SeedSegmentation::scanlineSeedSegmentation8BitPerChannel(const uint8_t* frame, uint8_t* mask, const unsigned int width, const unsigned int height, const unsigned int framePaddingElements, const unsigned int maskPaddingElements, const PixelPosition& seed, const uint8_t localThreshold, const uint8_t globalThreshold, PixelBoundingBox* boundingBox, Worker* worker)
+{
+	static_assert(tChannels != 0u, "Invalid channel number!");
+
+	ocean_assert(frame != nullptr && mask != nullptr);
+
+	if (seed.x() >= width || seed.y() >= height)
+	{
+		return 0u;
+	}
+
+	const unsigned int frameStrideElements = width * tChannels + framePaddingElements;
+
+	std::vector<uint8_t> connectivity(width * height);
+	std::vector<uint8_t> seedDistances(width * height);
+
+	const uint8_t* const seedPixel = frame + seed.y() * frameStrideElements + seed.x() * tChannels;
+
+	if (worker != nullptr)
+	{
+		worker->executeFunction(Worker::Function::createStatic(&SeedSegmentation::determineConnectivity8BitPerChannelSubset<tChannels>, frame, width, height, framePaddingElements, seedPixel, localThreshold, connectivity.data(), seedDistances.data(), 0u, 0u), 0u, height);
+	}
+	else
+	{
+		determineConnectivity8BitPerChannelSubset<tChannels>(frame, width, height, framePaddingElements, seedPixel, localThreshold, connectivity.data(), seedDistances.data(), 0u, height);
+	}
+
+	PixelBoundingBox regionBoundingBox;
+
+	Indices32 parents;
+	PixelPositions runs;
+
+	const unsigned int maskPixelCounter = determineRegion(connectivity.data(), seedDistances.data(), width, height, seed, globalThreshold == 0u ? 0xFFu : globalThreshold, mask, maskPaddingElements, regionBoundingBox, parents, runs, worker);
+
+	if (boundingBox != nullptr)
+	{
+		*boundingBox = regionBoundingBox;
+	}
+
+	return maskPixelCounter;
+}
+
+template <unsigned int tChannels>
+unsigned int SeedSegmentation::iterativeScanlineSeedSegmentation8BitPerChannel(const uint8_t* frame, uint8_t* mask, const unsigned int width, const unsigned int height, const unsigned int framePaddingElements, const unsigned int maskPaddingElements, const PixelPosition& seed, const uint8_t localThreshold, const uint8_t minimalGlobalThreshold, const uint8_t maximalGlobalThreshold, const unsigned int maximalIncreaseFactor, PixelBoundingBox* boundingBox, Worker* worker)
+{
+	static_assert(tChannels != 0u, "Invalid channel number!");
+
+	ocean_assert(frame != nullptr && mask != nullptr);
+	ocean_assert(width >= 1u && height >= 1u);
+	ocean_assert(seed.x() < width && seed.y() < height);
+
+	ocean_assert(minimalGlobalThreshold != 0u);
+	ocean_assert(minimalGlobalThreshold <= maximalGlobalThreshold);
+
+	if (seed.x() >= width || seed.y() >= height || minimalGlobalThreshold > maximalGlobalThreshold)
+	{
+		return 0u;
+	}
+
+	const unsigned int frameStrideElements = width * tChannels + framePaddingElements;
+
+	// the similarity tests do not depend on the global threshold, so that they are determined once for all iterations
+
+	std::vector<uint8_t> connectivity(width * height);
+	std::vector<uint8_t> seedDistances(width * height);
+
+	const uint8_t* const seedPixel = frame + seed.y() * frameStrideElements + seed.x() * tChannels;
+
+	if (worker != nullptr)
+	{
+		worker->executeFunction(Worker::Function::createStatic(&SeedSegmentation::determineConnectivity8BitPerChannelSubset<tChannels>, frame, width, height, framePaddingElements, seedPixel, localThreshold, connectivity.data(), seedDistances.data(), 0u, 0u), 0u, height);
+	}
+	else
+	{
+		determineConnectivity8BitPerChannelSubset<tChannels>(frame, width, height, framePaddingElements, seedPixel, localThreshold, connectivity.data(), seedDistances.data(), 0u, height);
+	}
+
+	Frame maskFrame(FrameType(width, height, FrameType::FORMAT_Y8, FrameType::ORIGIN_UPPER_LEFT), mask, Frame::CM_USE_KEEP_LAYOUT, maskPaddingElements);
+	Frame secondMaskFrame(maskFrame.frameType());
+
+	// the masks of the accepted iteration and of the current iteration are exchanged instead of copied
+
+	Frame* resultMaskFrame = &maskFrame;
+	Frame* iterationMaskFrame = &secondMaskFrame;
+
+	PixelBoundingBox resultBoundingBox;
+
+	Indices32 parents;
+	PixelPositions runs;
+
+	// first iteration with the minimal global threshold
+
+	unsigned int maskPixelCounter = determineRegion(connectivity.data(), seedDistances.data(), width, height, seed, minimalGlobalThreshold, resultMaskFrame->data<uint8_t>(), resultMaskFrame->paddingElements(), resultBoundingBox, parents, runs, worker);
+
+	// in the following iterations we increase the global threshold and stop if the number of mask pixels increase too much between two iterations
+
+	unsigned int maximalIterationMaskPixelCounter = (unsigned int)(-1);
+
+	for (unsigned int globalThreshold = (unsigned int)(minimalGlobalThreshold) + 1u; globalThreshold <= (unsigned int)(maximalGlobalThreshold); ++globalThreshold)
+	{
+		PixelBoundingBox iterationBoundingBox;
+		const unsigned int iterationMaskPixelCounter = determineRegion(connectivity.data(), seedDistances.data(), width, height, seed, uint8_t(globalThreshold), iterationMaskFrame->data<uint8_t>(), iterationMaskFrame->paddingElements(), iterationBoundingBox, parents, runs, worker);
+
+		if (iterationMaskPixelCounter <= maximalIterationMaskPixelCounter)
+		{
+			ocean_assert(iterationMaskPixelCounter >= maskPixelCounter);
+			maximalIterationMaskPixelCounter = max(iterationMaskPixelCounter + maximalIncreaseFactor * (iterationMaskPixelCounter - maskPixelCounter), iterationMaskPixelCounter * 105u / 100u);
+
+			maskPixelCounter = iterationMaskPixelCounter;
+			resultBoundingBox = iterationBoundingBox;
+
+			std::swap(resultMaskFrame, iterationMaskFrame);
+		}
+		else
+		{
+			break;
+		}
+	}
+
+	if (resultMaskFrame != &maskFrame)
+	{
+		maskFrame.copy(0, 0, *resultMaskFrame);
+	}
+
+	if (boundingBox != nullptr)
+	{
+		*boundingBox = resultBoundingBox;
+	}
+
+	return maskPixelCounter;
+}
+
+template <unsigned int tChannels>
+void SeedSegmentation::determineConnectivity8BitPerChannelSubset(const uint8_t* frame, const unsigned int width, const unsigned int height, const unsigned int framePaddingElements, const uint8_t* seedPixel, const uint8_t localThreshold, uint8_t* connectivity, uint8_t* seedDistances, const unsigned int firstRow, const unsigned int numberRows)
+{
+	static_assert(tChannels != 0u, "Invalid channel number!");
+
+	ocean_assert(frame != nullptr && seedPixel != nullptr);
+	ocean_assert(connectivity != nullptr && seedDistances != nullptr);
+	ocean_assert(firstRow + numberRows <= height);
+
+	const unsigned int rowElements = width * tChannels;
+	const unsigned int frameStrideElements = rowElements + framePaddingElements;
+
+	// the seed row holds the seed pixel for each pixel so that all differences of a row can be determined with the same (SIMD) loop
+
+	std::vector<uint8_t> buffer(rowElements * 4u);
+
+	uint8_t* const seedRow = buffer.data();
+	uint8_t* const rightDifferences = seedRow + rowElements;
+	uint8_t* const bottomDifferences = rightDifferences + rowElements;
+	uint8_t* const seedDifferences = bottomDifferences + rowElements;
+
+	for (unsigned int x = 0u; x < width; ++x)
+	{
+		for (unsigned int n = 0u; n < tChannels; ++n)
+		{
+			seedRow[x * tChannels + n] = seedPixel[n];
+		}
+	}
+
+	for (unsigned int y = firstRow; y < firstRow + numberRows; ++y)
+	{
+		const uint8_t* const frameRow = frame + y * frameStrideElements;
+
+		const bool hasBottomRow = y + 1u < height;
+
+		absoluteDifferences8Bit(frameRow, frameRow + tChannels, rightDifferences, rowElements - tChannels);
+		absoluteDifferences8Bit(frameRow, seedRow, seedDifferences, rowElements);
+
+		if (hasBottomRow)
+		{
+			absoluteDifferences8Bit(frameRow, frameRow + frameStrideElements, bottomDifferences, rowElements);
+		}
+
+		uint8_t* const connectivityRow = connectivity + y * width;
+		uint8_t* const seedDistancesRow = seedDistances + y * width;
+
+		for (unsigned int x = 0u; x < width; ++x)
+		{
+			uint8_t rightDifference = 0u;
+			uint8_t bottomDifference = 0u;
+			uint8_t seedDifference = 0u;
+
+			for (unsigned int n = 0u; n < tChannels; ++n)
+			{
+				seedDifference = max(seedDifference, seedDifferences[x * tChannels + n]);
+			}
+
+			if (x + 1u < width)
+			{
+				for (unsigned int n = 0u; n < tChannels; ++n)
+				{
+					rightDifference = max(rightDifference, rightDifferences[x * tChannels + n]);
+				}
+			}
+
+			if (hasBottomRow)
+			{
+				for (unsigned int n = 0u; n < tChannels; ++n)
+				{
+					bottomDifference = max(bottomDifference, bottomDifferences[x * tChannels + n]);
+				}
+			}
+
+			uint8_t flags = 0u;
+
+			if (x + 1u < width && rightDifference <= localThreshold)
+			{
+				flags |= connectedRight_;
+			}
+
+			if (hasBottomRow && bottomDifference <= localThreshold)
+			{
+				flags |= connectedBottom_;
+			}
+
+			connectivityRow[x] = flags;
+			seedDistancesRow[x] = seedDifference;
+		}
+	}
+}
+
 template <typename T, unsigned int tChannels>
 inline bool SeedSegmentation::ssdBelowThreshold(const T* image0, const T* image1, const typename SquareValueTyper<T>::Type sqrThreshold)
 {
@@ -629,6 +1014,53 @@ inline bool SeedSegmentation::ssdBelowThreshold8BitPerChannel(const unsigned int
 	return true;
 }
 
+inline void SeedSegmentation::absoluteDifferences8Bit(const uint8_t* values0, const uint8_t* values1, uint8_t* differences, const unsigned int elements)
+{
+	ocean_assert(values0 != nullptr && values1 != nullptr && differences != nullptr);
+
+	unsigned int n = 0u;
+
+#if defined(OCEAN_HARDWARE_SSE_VERSION) && OCEAN_HARDWARE_SSE_VERSION >= 41
+
+	for (; n + 16u <= elements; n += 16u)
+	{
+		const __m128i values0_u_8x16 = _mm_loadu_si128((const __m128i*)(values0 + n));
+		const __m128i values1_u_8x16 = _mm_loadu_si128((const __m128i*)(values1 + n));
+
+		// |a - b| = (a -sat b) | (b -sat a)
+		_mm_storeu_si128((__m128i*)(differences + n), _mm_or_si128(_mm_subs_epu8(values0_u_8x16, values1_u_8x16), _mm_subs_epu8(values1_u_8x16, values0_u_8x16)));
+	}
+
+#elif defined(OCEAN_HARDWARE_NEON_VERSION) && OCEAN_HARDWARE_NEON_VERSION >= 10
+
+	for (; n + 16u <= elements; n += 16u)
+	{
+		vst1q_u8(differences + n, vabdq_u8(vld1q_u8(values0 + n), vld1q_u8(values1 + n)));
+	}
+
+#endif
+
+	for (; n < elements; ++n)
+	{
+		differences[n] = uint8_t(std::abs(int(values0[n]) - int(values1[n])));
+	}
+}
+
+inline Index32 SeedSegmentation::findRoot(Index32* parents, Index32 index)
+{
+	ocean_assert(parents != nullptr);
+	ocean_assert(parents[index] != invalidLabel_);
+
+	while (parents[index] != index)
+	{
+		// path halving, each parent has a smaller index than the child
+		parents[index] = parents[parents[index]];
+		index = parents[index];
+	}
+
+	return index;
+}
+
 }
 
 }
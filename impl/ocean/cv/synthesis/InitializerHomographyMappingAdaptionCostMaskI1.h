@@ -0,0 +1,394 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#ifndef META_OCEAN_CV_SYNTHESIS_INITIALIZER_HOMOGRAPHY_MAPPING_ADAPTION_COST_MASK_I_1_H
+#define META_OCEAN_CV_SYNTHESIS_INITIALIZER_HOMOGRAPHY_MAPPING_ADAPTION_COST_MASK_I_1_H
+
+#include "ocean/cv/synthesis/Synthesis.h"
+#include "ocean/cv/synthesis/InitializerI.h"
+#include "ocean/cv/synthesis/InitializerRandomized.h"
+#include "ocean/cv/synthesis/InitializerSubset.h"
+#include "ocean/cv/synthesis/Initializer1.h"
+#include "ocean/cv/synthesis/LayerI1.h"
+
+#include "ocean/math/SquareMatrix3.h"
+
+namespace Ocean
+{
+
+namespace CV
+{
+
+namespace Synthesis
+{
+
+/**
+ * This initializer creates an initial mapping by the adaption of the mapping of a previous video frame with corresponding homography and further creates a cost mask holding the mask pixels which do not need to be optimized anymore.
+ * The initializer supports mappings with integer accuracy and is intended for temporally coherent video inpainting.<br>
+ * Each mask pixel of the current layer is transformed into the previous layer, the previous source position of this pixel is transformed back into the current layer and used as new source position.<br>
+ * Mask pixels without valid previous mapping (e.g., pixels which have not been part of the previous mask) are adapted from an optional coarser layer, or are initialized randomly.<br>
+ * Once the mapping is initialized, the mapping is applied to the frame of the layer and the appearance cost of each adapted mapping is compared with the appearance cost the mapping had in the previous layer.<br>
+ * Adapted mappings whose cost did not get worse (within a tolerance) are set to 0xFF in the resulting cost mask so that an optimizer like Optimizer4NeighborhoodHighPerformanceSkippingByCostMaskI1 can skip them.
+ * @tparam tBorderFactor Weight factor of border pixels used when comparing the appearance costs, with range [1, infinity)
+ * @see InitializerHomographyMappingAdaptionF1, InitializerCoarserMappingAdaptionSpatialCostMaskI1.
+ * @ingroup cvsynthesis
+ */
+template <unsigned int tBorderFactor>
+class InitializerHomographyMappingAdaptionCostMaskI1 :
+	virtual public InitializerI,
+	virtual public InitializerRandomized,
+	virtual public InitializerSubset,
+	virtual public Initializer1
+{
+	public:
+
+		/**
+		 * Creates a new initializer object.
+		 * @param layer The layer for that the initial mapping has to be provided
+		 * @param randomGenerator Random number generator
+		 * @param previousLayer The synthesis layer of the previous frame with same dimension and pixel format as the initializer layer, holding the final mapping and synthesized frame
+		 * @param homography The homography transforming points defined in the current layer to points defined in the previous layer
+		 * @param costMask Resulting cost mask for the layer, mask pixels with value 0xFF can be skipped during optimization
+		 * @param coarserLayer Optional coarser synthesis layer of the current frame with half dimension of the initializer layer, used for mask pixels without valid previous mapping, nullptr to use random mappings instead
+		 * @param costTolerance The tolerance in percent an adapted mapping's appearance cost may exceed the previous appearance cost and still count as unchanged, with range [0, infinity)
+		 */
+		inline InitializerHomographyMappingAdaptionCostMaskI1(LayerI1& layer, RandomGenerator& randomGenerator, const LayerI1& previousLayer, const SquareMatrix3& homography, Frame& costMask, const LayerI1* coarserLayer = nullptr, const unsigned int costTolerance = 25u);
+
+		/**
+		 * Invokes the initialization process.
+		 * Beware: Additionally, the resulting mapping is applied to the frame of the layer.
+		 * @see Initializer::invoke().
+		 */
+		bool invoke(Worker* worker = nullptr) const override;
+
+	private:
+
+		/**
+		 * Initializes a subset of the entire mapping area.
+		 * Adapted mask pixels are set to 0x01 in the cost mask, all other mask pixels to 0x00.
+		 * @see InitializerSubset::initializeSubset().
+		 */
+		void initializeSubset(const unsigned int firstColumn, const unsigned int numberColumns, const unsigned int firstRow, const unsigned int numberRows) const override;
+
+		/**
+		 * Determines the cost mask for a subset of the entire mapping area by comparing the appearance costs of the adapted mappings with the previous appearance costs.
+		 * @param firstColumn First column of the mapping area to be handled
+		 * @param numberColumns Number of columns of the mapping area to be handled
+		 * @param firstRow First row of the mapping area to be handled
+		 * @param numberRows Number of rows of the mapping area to be handled
+		 * @tparam tChannels The number of channels of the layer's frame, with range [1, 4]
+		 */
+		template <unsigned int tChannels>
+		void determineCostMaskSubset(const unsigned int firstColumn, const unsigned int numberColumns, const unsigned int firstRow, const unsigned int numberRows) const;
+
+		/**
+		 * Transforms a position of the current layer into the previous layer.
+		 * @param x The horizontal position in the current layer
+		 * @param y The vertical position in the current layer
+		 * @param previousX The resulting horizontal position in the previous layer, with range [0, width - 1]
+		 * @param previousY The resulting vertical position in the previous layer, with range [0, height - 1]
+		 * @return True, if the transformed position lies inside the previous layer
+		 */
+		inline bool previousPosition(const unsigned int x, const unsigned int y, unsigned int& previousX, unsigned int& previousY) const;
+
+	private:
+
+		/// The synthesis layer of the current frame.
+		LayerI1& layerI1_;
+
+		/// The synthesis layer of the previous frame.
+		const LayerI1& previousLayerI_;
+
+		/// The homography transforming points defined in the current layer to points defined in the previous layer.
+		const SquareMatrix3 homography_;
+
+		/// The inverted homography transforming points defined in the previous layer to points defined in the current layer.
+		SquareMatrix3 invertedHomography_;
+
+		/// Resulting cost mask for the layer.
+		Frame& costMask_;
+
+		/// Optional coarser synthesis layer of the current frame.
+		const LayerI1* coarserLayerI_;
+
+		/// The tolerance in percent an adapted mapping's appearance cost may exceed the previous appearance cost.
+		const unsigned int costTolerance_;
+};
+
+template <unsigned int tBorderFactor>
+inline InitializerHomographyMappingAdaptionCostMaskI1<tBorderFactor>::InitializerHomographyMappingAdaptionCostMaskI1(LayerI1& layer, RandomGenerator& randomGenerator, const LayerI1& previousLayer, const SquareMatrix3& homography, Frame& costMask, const LayerI1* coarserLayer, const unsigned int costTolerance) :
+	Initializer(layer),
+	InitializerI(layer),
+	InitializerRandomized(layer, randomGenerator),
+	InitializerSubset(layer),
+	Initializer1(layer),
+	layerI1_(layer),
+	previousLayerI_(previousLayer),
+	homography_(homography),
+	invertedHomography_(false),
+	costMask_(costMask),
+	coarserLayerI_(coarserLayer),
+	costTolerance_(costTolerance)
+{
+	static_assert(tBorderFactor != 0u, "Invalid border factor!");
+
+	if (!homography_.invert(invertedHomography_))
+	{
+		invertedHomography_.toNull();
+	}
+}
+
+template <unsigned int tBorderFactor>
+bool InitializerHomographyMappingAdaptionCostMaskI1<tBorderFactor>::invoke(Worker* worker) const
+{
+	ocean_assert(layerI_.width() == previousLayerI_.width() && layerI_.height() == previousLayerI_.height());
+	ocean_assert(layerI_.frame().frameType() == previousLayerI_.frame().frameType());
+	ocean_assert(coarserLayerI_ == nullptr || (coarserLayerI_->width() == layerI_.width() / 2u && coarserLayerI_->height() == layerI_.height() / 2u));
+
+	if (layerI_.width() != previousLayerI_.width() || layerI_.height() != previousLayerI_.height() || layerI_.frame().frameType() != previousLayerI_.frame().frameType())
+	{
+		return false;
+	}
+
+	if (invertedHomography_.isNull() || layerI_.frame().numberPlanes() != 1u || layerI_.frame().channels() == 0u || layerI_.frame().channels() > 4u)
+	{
+		return false;
+	}
+
+	costMask_ = Frame(layer_.mask(), Frame::ACM_COPY_REMOVE_PADDING_LAYOUT);
+
+	if (!InitializerSubset::invoke(worker))
+	{
+		return false;
+	}
+
+	const PixelBoundingBox& layerBoundingBox = layer_.boundingBox();
+
+	const unsigned int firstColumn = layerBoundingBox ? layerBoundingBox.left() : 0u;
+	const unsigned int numberColumns = layerBoundingBox ? layerBoundingBox.width() : layer_.width();
+
+	const unsigned int firstRow = layerBoundingBox ? layerBoundingBox.top() : 0u;
+	const unsigned int numberRows = layerBoundingBox ? layerBoundingBox.height() : layer_.height();
+
+	// the appearance costs of the adapted mappings can be determined only after the mapping has been applied
+
+	layerI_.mapping().applyMapping(layerI_.frame(), layerI_.mask(), firstColumn, numberColumns, firstRow, numberRows, worker);
+
+	using DetermineCostMaskSubsetFunction = void (InitializerHomographyMappingAdaptionCostMaskI1<tBorderFactor>::*)(const unsigned int, const unsigned int, const unsigned int, const unsigned int) const;
+
+	DetermineCostMaskSubsetFunction function = nullptr;
+
+	switch (layerI_.frame().channels())
+	{
+		case 1u:
+			function = &InitializerHomographyMappingAdaptionCostMaskI1<tBorderFactor>::template determineCostMaskSubset<1u>;
+			break;
+
+		case 2u:
+			function = &InitializerHomographyMappingAdaptionCostMaskI1<tBorderFactor>::template determineCostMaskSubset<2u>;
+			break;
+
+		case 3u:
+			function = &InitializerHomographyMappingAdaptionCostMaskI1<tBorderFactor>::template determineCostMaskSubset<3u>;
+			break;
+
+		case 4u:
+			function = &InitializerHomographyMappingAdaptionCostMaskI1<tBorderFactor>::template determineCostMaskSubset<4u>;
+			break;
+
+		default:
+			ocean_assert(false && "Invalid frame type.");
+			return false;
+	}
+
+	if (worker)
+	{
+		worker->executeFunction(Worker::Function::create(*this, function, firstColumn, numberColumns, 0u, 0u), firstRow, numberRows, 2u, 3u);
+	}
+	else
+	{
+		(this->*function)(firstColumn, numberColumns, firstRow, numberRows);
+	}
+
+	return true;
+}
+
+template <unsigned int tBorderFactor>
+void InitializerHomographyMappingAdaptionCostMaskI1<tBorderFactor>::initializeSubset(const unsigned int firstColumn, const unsigned int numberColumns, const unsigned int firstRow, const unsigned int numberRows) const
+{
+	const unsigned int width = layerI_.width();
+	const unsigned int height = layerI_.height();
+
+	ocean_assert(firstColumn + numberColumns <= width);
+	ocean_assert(firstRow + numberRows <= height);
+
+	MappingI& mapping = layerI_.mapping();
+	const MappingI& previousMapping = previousLayerI_.mapping();
+
+	RandomGenerator randomGenerator(randomGenerator_);
+
+	const uint8_t* const mask = layerI_.mask().template constdata<uint8_t>();
+	const uint8_t* const previousMask = previousLayerI_.mask().template constdata<uint8_t>();
+	uint8_t* const costMask = costMask_.data<uint8_t>();
+
+	const unsigned int maskStrideElements = layerI_.mask().strideElements();
+	const unsigned int previousMaskStrideElements = previousLayerI_.mask().strideElements();
+	const unsigned int costMaskStrideElements = costMask_.strideElements();
+
+	for (unsigned int y = firstRow; y < firstRow + numberRows; ++y)
+	{
+		const uint8_t* maskRow = mask + y * maskStrideElements;
+		uint8_t* costMaskRow = costMask + y * costMaskStrideElements;
+		PixelPosition* positionRow = mapping.row(y);
+
+		for (unsigned int x = firstColumn; x < firstColumn + numberColumns; ++x)
+		{
+			if (maskRow[x] == 0xFFu)
+			{
+				continue;
+			}
+
+			costMaskRow[x] = 0x00u;
+
+			unsigned int previousX, previousY;
+			if (previousPosition(x, y, previousX, previousY) && previousMask[previousY * previousMaskStrideElements + previousX] != 0xFFu)
+			{
+				const PixelPosition& previousSource = previousMapping.position(previousX, previousY);
+				ocean_assert(previousSource.isValid());
+
+				const Vector2 source(invertedHomography_ * Vector2(Scalar(previousSource.x()), Scalar(previousSource.y())));
+
+				const int candidateX = Numeric::round32(source.x());
+				const int candidateY = Numeric::round32(source.y());
+
+				if ((unsigned int)(candidateX) < width && (unsigned int)(candidateY) < height && mask[(unsigned int)(candidateY) * maskStrideElements + (unsigned int)(candidateX)] == 0xFFu)
+				{
+					positionRow[x] = CV::PixelPosition((unsigned int)(candidateX), (unsigned int)(candidateY));
+					costMaskRow[x] = 0x01u;
+
+					continue;
+				}
+			}
+
+			if (coarserLayerI_ != nullptr)
+			{
+				const unsigned int xCoarser = min(x / 2u, coarserLayerI_->width() - 1u);
+				const unsigned int yCoarser = min(y / 2u, coarserLayerI_->height() - 1u);
+
+				if (coarserLayerI_->mask().template constpixel<uint8_t>(xCoarser, yCoarser)[0] != 0xFFu)
+				{
+					const PixelPosition& coarserPosition = coarserLayerI_->mapping().position(xCoarser, yCoarser);
+
+					const unsigned int candidateX = (unsigned int)(int(x) + (int(coarserPosition.x()) - int(xCoarser)) * 2);
+					const unsigned int candidateY = (unsigned int)(int(y) + (int(coarserPosition.y()) - int(yCoarser)) * 2);
+
+					if (candidateX < width && candidateY < height && mask[candidateY * maskStrideElements + candidateX] == 0xFFu)
+					{
+						positionRow[x] = CV::PixelPosition(candidateX, candidateY);
+						continue;
+					}
+				}
+			}
+
+			unsigned int candidateX, candidateY;
+			do
+			{
+				candidateX = RandomI::random(randomGenerator, width - 1u);
+				candidateY = RandomI::random(randomGenerator, height - 1u);
+			}
+			while (mask[candidateY * maskStrideElements + candidateX] != 0xFFu);
+
+			positionRow[x] = CV::PixelPosition(candidateX, candidateY);
+		}
+	}
+}
+
+template <unsigned int tBorderFactor>
+template <unsigned int tChannels>
+void InitializerHomographyMappingAdaptionCostMaskI1<tBorderFactor>::determineCostMaskSubset(const unsigned int firstColumn, const unsigned int numberColumns, const unsigned int firstRow, const unsigned int numberRows) const
+{
+	static_assert(tChannels >= 1u && tChannels <= 4u, "Invalid channel number!");
+
+	ocean_assert(firstColumn + numberColumns <= layerI_.width());
+	ocean_assert(firstRow + numberRows <= layerI_.height());
+
+	const MappingI1& mapping = layerI1_.mappingI1();
+	const MappingI1& previousMapping = previousLayerI_.mappingI1();
+
+	const Frame& frame = layerI1_.frame();
+	const Frame& mask = layerI1_.mask();
+	const Frame& previousFrame = previousLayerI_.frame();
+	const Frame& previousMask = previousLayerI_.mask();
+
+	const uint64_t currentFactor = 100ull;
+	const uint64_t previousFactor = 100ull + uint64_t(costTolerance_);
+
+	for (unsigned int y = firstRow; y < firstRow + numberRows; ++y)
+	{
+		uint8_t* const costMaskRow = costMask_.row<uint8_t>(y);
+
+		for (unsigned int x = firstColumn; x < firstColumn + numberColumns; ++x)
+		{
+			if (costMaskRow[x] != 0x01u)
+			{
+				if (costMaskRow[x] != 0xFFu)
+				{
+					costMaskRow[x] = 0x00u;
+				}
+
+				continue;
+			}
+
+			costMaskRow[x] = 0x00u;
+
+			unsigned int previousX, previousY;
+			if (!previousPosition(x, y, previousX, previousY))
+			{
+				ocean_assert(false && "This should never happen!");
+				continue;
+			}
+
+			const PixelPosition& source = mapping.position(x, y);
+			const PixelPosition& previousSource = previousMapping.position(previousX, previousY);
+
+			const unsigned int cost = mapping.appearanceCost5x5<tChannels, tBorderFactor>(x, y, source.x(), source.y(), frame.constdata<uint8_t>(), mask.constdata<uint8_t>(), frame.paddingElements(), mask.paddingElements());
+			const unsigned int previousCost = previousMapping.appearanceCost5x5<tChannels, tBorderFactor>(previousX, previousY, previousSource.x(), previousSource.y(), previousFrame.constdata<uint8_t>(), previousMask.constdata<uint8_t>(), previousFrame.paddingElements(), previousMask.paddingElements());
+
+			if (uint64_t(cost) * currentFactor <= uint64_t(previousCost) * previousFactor)
+			{
+				costMaskRow[x] = 0xFFu;
+			}
+		}
+	}
+}
+
+template <unsigned int tBorderFactor>
+inline bool InitializerHomographyMappingAdaptionCostMaskI1<tBorderFactor>::previousPosition(const unsigned int x, const unsigned int y, unsigned int& previousX, unsigned int& previousY) const
+{
+	const Vector2 position(homography_ * Vector2(Scalar(x), Scalar(y)));
+
+	const int roundedX = Numeric::round32(position.x());
+	const int roundedY = Numeric::round32(position.y());
+
+	if ((unsigned int)(roundedX) >= previousLayerI_.width() || (unsigned int)(roundedY) >= previousLayerI_.height())
+	{
+		return false;
+	}
+
+	previousX = (unsigned int)(roundedX);
+	previousY = (unsigned int)(roundedY);
+
+	return true;
+}
+
+}
+
+}
+
+}
+
+#endif // META_OCEAN_CV_SYNTHESIS_INITIALIZER_HOMOGRAPHY_MAPPING_ADAPTION_COST_MASK_I_1_H
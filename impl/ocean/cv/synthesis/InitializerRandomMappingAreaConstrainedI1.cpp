@@ -7,7 +7,7 @@
 
 #include "ocean/cv/synthesis/InitializerRandomMappingAreaConstrainedI1.h"
 
-#include "ocean/base/RandomI.h"
+#include "ocean/base/RandomXoshiro.h"
 
 namespace Ocean
 {
@@ -26,7 +26,14 @@ void InitializerRandomMappingAreaConstrainedI1::initializeSubset(const unsigned
 	ocean_assert(firstRow + numberRows <= layerHeight);
 	ocean_assert(firstColumn + numberColumns <= layerWidth);
 
-	RandomGenerator generator(randomGenerator_);
+	RandomXoshiro generator(randomGenerator_);
+
+	// the random positions are drawn in blocks, positions not used for one pixel are used for the next pixels
+	constexpr unsigned int blockSize = 64u;
+
+	Index32 randomXs[blockSize];
+	Index32 randomYs[blockSize];
+	unsigned int blockPosition = blockSize;
 
 	const uint8_t* const maskData = layerI_.mask().constdata<uint8_t>();
 	const unsigned int maskStrideElements = layerI_.mask().strideElements();
@@ -48,8 +55,18 @@ void InitializerRandomMappingAreaConstrainedI1::initializeSubset(const unsigned
 			{
 				do
 				{
-					randomX = RandomI::random(generator, layerWidth - 1u);
-					randomY = RandomI::random(generator, layerHeight - 1u);
+					if (blockPosition == blockSize)
+					{
+						generator.fillIndices(randomXs, blockSize, layerWidth - 1u);
+						generator.fillIndices(randomYs, blockSize, layerHeight - 1u);
+
+						blockPosition = 0u;
+					}
+
+					randomX = randomXs[blockPosition];
+					randomY = randomYs[blockPosition];
+
+					++blockPosition;
 				}
 				while (maskData[randomY * maskStrideElements + randomX] != 0xFF || filter[randomY * filterStrideElements + randomX] != 0xFF);
 
@@ -7,7 +7,7 @@
 
 #include "ocean/cv/synthesis/InitializerRandomMappingI1.h"
 
-#include "ocean/base/RandomI.h"
+#include "ocean/base/RandomXoshiro.h"
 
 namespace Ocean
 {
@@ -30,7 +30,14 @@ void InitializerRandomMappingI1::initializeSubset(const unsigned int firstColumn
 
 	const unsigned int maskStrideElements = layerI_.mask().strideElements();
 
-	RandomGenerator generator(randomGenerator_);
+	RandomXoshiro generator(randomGenerator_);
+
+	// the random positions are drawn in blocks, positions not used for one pixel are used for the next pixels
+	constexpr unsigned int blockSize = 64u;
+
+	Index32 randomXs[blockSize];
+	Index32 randomYs[blockSize];
+	unsigned int blockPosition = blockSize;
 
 	for (unsigned int y = firstRow; y < firstRow + numberRows; ++y)
 	{
@@ -46,8 +53,18 @@ void InitializerRandomMappingI1::initializeSubset(const unsigned int firstColumn
 			{
 				do
 				{
-					randomX = RandomI::random(generator, layerWidth - 1u);
-					randomY = RandomI::random(generator, layerHeight - 1u);
+					if (blockPosition == blockSize)
+					{
+						generator.fillIndices(randomXs, blockSize, layerWidth - 1u);
+						generator.fillIndices(randomYs, blockSize, layerHeight - 1u);
+
+						blockPosition = 0u;
+					}
+
+					randomX = randomXs[blockPosition];
+					randomY = randomYs[blockPosition];
+
+					++blockPosition;
 				}
 				while (maskData[randomY * maskStrideElements + randomX] != 0xFFu);
 
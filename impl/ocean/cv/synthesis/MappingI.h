@@ -13,7 +13,14 @@
 
 #include "ocean/cv/PixelPosition.h"
 
+#if defined(OCEAN_HARDWARE_SSE_VERSION) && OCEAN_HARDWARE_SSE_VERSION >= 41
+	#include "ocean/cv/SSE.h"
+#elif defined(OCEAN_HARDWARE_NEON_VERSION) && OCEAN_HARDWARE_NEON_VERSION >= 10
+	#include "ocean/cv/NEON.h"
+#endif
+
 #include <algorithm>
+#include <array>
 #include <memory>
 
 namespace Ocean
@@ -154,6 +161,55 @@ class OCEAN_CV_SYNTHESIS_EXPORT MappingI : public Mapping
 		template <unsigned int tChannels, unsigned int tBorderFactor>
 		static inline unsigned int ssd5x5MaskNoCenter(const uint8_t* frame0, const uint8_t* frame1, const uint8_t* mask0, const unsigned int width0, const unsigned int width1, const unsigned int frame0PaddingElements, const unsigned int frame1PaddingElements, const unsigned int mask0PaddingElements);
 
+#if defined(OCEAN_HARDWARE_SSE_VERSION) && OCEAN_HARDWARE_SSE_VERSION >= 41
+
+		/**
+		 * Calculates the sum of square differences between two 5x5 frame regions in two frames with explicit weighted mask pixels using SSE instructions.
+		 * @param frame0 Pointer to the top left position in the 5x5 region in the first frame
+		 * @param frame1 Pointer to the top left position in the 5x5 region in the second frame
+		 * @param mask0 Pointer to the top left position in the 5x5 region in the mask frame, with 0xFF defining a non-mask pixel
+		 * @param frame0StrideElements The number of elements between two rows of the first frame, in elements, with range [5 * tChannels, infinity)
+		 * @param frame1StrideElements The number of elements between two rows of the second frame, in elements, with range [5 * tChannels, infinity)
+		 * @param mask0StrideElements The number of elements between two mask rows, in elements, with range [5, infinity)
+		 * @return Resulting sum of squared differences
+		 * @tparam tChannels Number of frame channels, with range [1, 4]
+		 * @tparam tBorderFactor Multiplication factor for squared differences of border pixels, with range [1, 128]
+		 * @see ssd5x5MaskNoCenter().
+		 */
+		template <unsigned int tChannels, unsigned int tBorderFactor>
+		static inline unsigned int ssd5x5MaskNoCenterSSE(const uint8_t* frame0, const uint8_t* frame1, const uint8_t* mask0, const unsigned int frame0StrideElements, const unsigned int frame1StrideElements, const unsigned int mask0StrideElements);
+
+#endif // OCEAN_HARDWARE_SSE_VERSION >= 41
+
+#if defined(OCEAN_HARDWARE_NEON_VERSION) && OCEAN_HARDWARE_NEON_VERSION >= 10
+
+		/**
+		 * Calculates the sum of square differences between two 5x5 frame regions in two frames with explicit weighted mask pixels using NEON instructions.
+		 * @param frame0 Pointer to the top left position in the 5x5 region in the first frame
+		 * @param frame1 Pointer to the top left position in the 5x5 region in the second frame
+		 * @param mask0 Pointer to the top left position in the 5x5 region in the mask frame, with 0xFF defining a non-mask pixel
+		 * @param frame0StrideElements The number of elements between two rows of the first frame, in elements, with range [5 * tChannels, infinity)
+		 * @param frame1StrideElements The number of elements between two rows of the second frame, in elements, with range [5 * tChannels, infinity)
+		 * @param mask0StrideElements The number of elements between two mask rows, in elements, with range [5, infinity)
+		 * @return Resulting sum of squared differences
+		 * @tparam tChannels Number of frame channels, with range [1, 4]
+		 * @tparam tBorderFactor Multiplication factor for squared differences of border pixels, with range [1, 255]
+		 * @see ssd5x5MaskNoCenter().
+		 */
+		template <unsigned int tChannels, unsigned int tBorderFactor>
+		static inline unsigned int ssd5x5MaskNoCenterNEON(const uint8_t* frame0, const uint8_t* frame1, const uint8_t* mask0, const unsigned int frame0StrideElements, const unsigned int frame1StrideElements, const unsigned int mask0StrideElements);
+
+#endif // OCEAN_HARDWARE_NEON_VERSION >= 10
+
+		/**
+		 * Returns the indices distributing the weights of the five pixels of one patch row to the individual channels of the pixels.
+		 * The indices of elements not belonging to the patch row are 0x80.
+		 * @return The 32 indices, one for each element of two 16-byte blocks
+		 * @tparam tChannels Number of frame channels, with range [1, 4]
+		 */
+		template <unsigned int tChannels>
+		static constexpr std::array<uint8_t, 32> ssd5x5WeightIndices();
+
 		/**
 		 * Assign operator.
 		 * @param pixelMapping Mapping object to be copied
@@ -285,6 +341,22 @@ inline unsigned int MappingI::ssd5x5MaskNoCenter(const uint8_t* frame0, const ui
 	const unsigned int frame1StrideElements = width1 * tChannels + frame1PaddingElements;
 	const unsigned int mask0StrideElements = width0 + mask0PaddingElements;
 
+#if defined(OCEAN_HARDWARE_SSE_VERSION) && OCEAN_HARDWARE_SSE_VERSION >= 41
+
+	if constexpr (tChannels <= 4u && tBorderFactor <= 128u)
+	{
+		return ssd5x5MaskNoCenterSSE<tChannels, tBorderFactor>(frame0, frame1, mask0, frame0StrideElements, frame1StrideElements, mask0StrideElements);
+	}
+
+#elif defined(OCEAN_HARDWARE_NEON_VERSION) && OCEAN_HARDWARE_NEON_VERSION >= 10
+
+	if constexpr (tChannels <= 4u && tBorderFactor <= 255u)
+	{
+		return ssd5x5MaskNoCenterNEON<tChannels, tBorderFactor>(frame0, frame1, mask0, frame0StrideElements, frame1StrideElements, mask0StrideElements);
+	}
+
+#endif // OCEAN_HARDWARE_SSE_VERSION, OCEAN_HARDWARE_NEON_VERSION
+
 	unsigned int ssd = 0u;
 
 	for (unsigned int y = 0u; y < 5u; ++y)
@@ -321,6 +393,172 @@ inline unsigned int MappingI::ssd5x5MaskNoCenter(const uint8_t* frame0, const ui
 	return ssd;
 }
 
+#if defined(OCEAN_HARDWARE_SSE_VERSION) && OCEAN_HARDWARE_SSE_VERSION >= 41
+
+template <unsigned int tChannels, unsigned int tBorderFactor>
+inline unsigned int MappingI::ssd5x5MaskNoCenterSSE(const uint8_t* frame0, const uint8_t* frame1, const uint8_t* mask0, const unsigned int frame0StrideElements, const unsigned int frame1StrideElements, const unsigned int mask0StrideElements)
+{
+	static_assert(tChannels >= 1u && tChannels <= 4u, "Invalid channel number!");
+	static_assert(tBorderFactor >= 1u && tBorderFactor <= 128u, "Invalid border factor!");
+
+	ocean_assert(frame0 != nullptr && frame1 != nullptr && mask0 != nullptr);
+
+	constexpr unsigned int rowElements = 5u * tChannels;
+	constexpr unsigned int blocks = (rowElements + 15u) / 16u;
+
+	alignas(16) static constexpr std::array<uint8_t, 32> weightIndices = ssd5x5WeightIndices<tChannels>();
+
+	// the patch rows are copied into zero-initialized buffers so that we never read outside of the frames
+
+	alignas(16) uint8_t buffer0[32] = {};
+	alignas(16) uint8_t buffer1[32] = {};
+	alignas(16) uint8_t maskBuffer[16] = {};
+
+	const __m128i constant_signs_s_16x8 = _mm_set1_epi16(short(0x1FF)); // -1, 1, -1, 1, -1, 1, -1, 1
+	const __m128i constant_one_u_8x16 = _mm_set1_epi8(1);
+	const __m128i constant_borderFactor_u_8x16 = _mm_set1_epi8(char(tBorderFactor));
+	const __m128i constant_0xFF_u_8x16 = _mm_set1_epi8(char(0xFF));
+	const __m128i constant_noCenter_u_8x16 = _mm_set_epi8(char(0xFF), char(0xFF), char(0xFF), char(0xFF), char(0xFF), char(0xFF), char(0xFF), char(0xFF), char(0xFF), char(0xFF), char(0xFF), char(0xFF), char(0xFF), 0, char(0xFF), char(0xFF));
+
+	__m128i sum_u_32x4 = _mm_setzero_si128();
+
+	for (unsigned int y = 0u; y < 5u; ++y)
+	{
+		memcpy(buffer0, frame0, rowElements);
+		memcpy(buffer1, frame1, rowElements);
+		memcpy(maskBuffer, mask0, 5);
+
+		// weight 1 for mask pixels, tBorderFactor for non-mask pixels, and 0 for the center pixel
+
+		const __m128i mask_u_8x16 = _mm_load_si128((const __m128i*)maskBuffer);
+
+		__m128i weights_u_8x16 = _mm_blendv_epi8(constant_one_u_8x16, constant_borderFactor_u_8x16, _mm_cmpeq_epi8(mask_u_8x16, constant_0xFF_u_8x16));
+
+		if (y == 2u)
+		{
+			weights_u_8x16 = _mm_and_si128(weights_u_8x16, constant_noCenter_u_8x16);
+		}
+
+		for (unsigned int n = 0u; n < blocks; ++n)
+		{
+			const __m128i elementWeights_u_8x16 = _mm_shuffle_epi8(weights_u_8x16, _mm_load_si128((const __m128i*)(weightIndices.data() + n * 16u)));
+
+			const __m128i value0_u_8x16 = _mm_load_si128((const __m128i*)(buffer0 + n * 16u));
+			const __m128i value1_u_8x16 = _mm_load_si128((const __m128i*)(buffer1 + n * 16u));
+
+			const __m128i differencesLow_s_16x8 = _mm_maddubs_epi16(_mm_unpacklo_epi8(value0_u_8x16, value1_u_8x16), constant_signs_s_16x8);
+			const __m128i differencesHigh_s_16x8 = _mm_maddubs_epi16(_mm_unpackhi_epi8(value0_u_8x16, value1_u_8x16), constant_signs_s_16x8);
+
+			const __m128i weightsLow_s_16x8 = _mm_unpacklo_epi8(elementWeights_u_8x16, _mm_setzero_si128());
+			const __m128i weightsHigh_s_16x8 = _mm_unpackhi_epi8(elementWeights_u_8x16, _mm_setzero_si128());
+
+			// (difference * weight) * difference, with |difference * weight| <= 255 * 128
+
+			sum_u_32x4 = _mm_add_epi32(sum_u_32x4, _mm_madd_epi16(_mm_mullo_epi16(differencesLow_s_16x8, weightsLow_s_16x8), differencesLow_s_16x8));
+			sum_u_32x4 = _mm_add_epi32(sum_u_32x4, _mm_madd_epi16(_mm_mullo_epi16(differencesHigh_s_16x8, weightsHigh_s_16x8), differencesHigh_s_16x8));
+		}
+
+		frame0 += frame0StrideElements;
+		frame1 += frame1StrideElements;
+		mask0 += mask0StrideElements;
+	}
+
+	return SSE::sum_u32_4(sum_u_32x4);
+}
+
+#endif // OCEAN_HARDWARE_SSE_VERSION >= 41
+
+#if defined(OCEAN_HARDWARE_NEON_VERSION) && OCEAN_HARDWARE_NEON_VERSION >= 10
+
+template <unsigned int tChannels, unsigned int tBorderFactor>
+inline unsigned int MappingI::ssd5x5MaskNoCenterNEON(const uint8_t* frame0, const uint8_t* frame1, const uint8_t* mask0, const unsigned int frame0StrideElements, const unsigned int frame1StrideElements, const unsigned int mask0StrideElements)
+{
+	static_assert(tChannels >= 1u && tChannels <= 4u, "Invalid channel number!");
+	static_assert(tBorderFactor >= 1u && tBorderFactor <= 255u, "Invalid border factor!");
+
+	ocean_assert(frame0 != nullptr && frame1 != nullptr && mask0 != nullptr);
+
+	constexpr unsigned int rowElements = 5u * tChannels;
+	constexpr unsigned int blocks = (rowElements + 15u) / 16u;
+
+	alignas(16) static constexpr std::array<uint8_t, 32> weightIndices = ssd5x5WeightIndices<tChannels>();
+
+	// the patch rows are copied into zero-initialized buffers so that we never read outside of the frames
+
+	alignas(16) uint8_t buffer0[32] = {};
+	alignas(16) uint8_t buffer1[32] = {};
+	alignas(8) uint8_t weights[8] = {};
+
+	uint32x4_t sum_u_32x4 = vdupq_n_u32(0u);
+
+	for (unsigned int y = 0u; y < 5u; ++y)
+	{
+		memcpy(buffer0, frame0, rowElements);
+		memcpy(buffer1, frame1, rowElements);
+
+		// weight 1 for mask pixels, tBorderFactor for non-mask pixels, and 0 for the center pixel
+
+		for (unsigned int x = 0u; x < 5u; ++x)
+		{
+			weights[x] = mask0[x] == 0xFFu ? uint8_t(tBorderFactor) : uint8_t(1u);
+		}
+
+		if (y == 2u)
+		{
+			weights[2] = 0u;
+		}
+
+		const uint8x8_t weights_u_8x8 = vld1_u8(weights);
+
+		for (unsigned int n = 0u; n < blocks; ++n)
+		{
+			// indices out of range (0x80) result in zero weights
+			const uint8x8_t elementWeightsLow_u_8x8 = vtbl1_u8(weights_u_8x8, vld1_u8(weightIndices.data() + n * 16u));
+			const uint8x8_t elementWeightsHigh_u_8x8 = vtbl1_u8(weights_u_8x8, vld1_u8(weightIndices.data() + n * 16u + 8u));
+
+			const uint8x16_t differences_u_8x16 = vabdq_u8(vld1q_u8(buffer0 + n * 16u), vld1q_u8(buffer1 + n * 16u));
+
+			const uint16x8_t differencesLow_u_16x8 = vmovl_u8(vget_low_u8(differences_u_8x16));
+			const uint16x8_t differencesHigh_u_16x8 = vmovl_u8(vget_high_u8(differences_u_8x16));
+
+			// (difference * weight) * difference, with difference * weight <= 255 * 255
+
+			const uint16x8_t weightedLow_u_16x8 = vmull_u8(vget_low_u8(differences_u_8x16), elementWeightsLow_u_8x8);
+			const uint16x8_t weightedHigh_u_16x8 = vmull_u8(vget_high_u8(differences_u_8x16), elementWeightsHigh_u_8x8);
+
+			sum_u_32x4 = vmlal_u16(sum_u_32x4, vget_low_u16(weightedLow_u_16x8), vget_low_u16(differencesLow_u_16x8));
+			sum_u_32x4 = vmlal_u16(sum_u_32x4, vget_high_u16(weightedLow_u_16x8), vget_high_u16(differencesLow_u_16x8));
+			sum_u_32x4 = vmlal_u16(sum_u_32x4, vget_low_u16(weightedHigh_u_16x8), vget_low_u16(differencesHigh_u_16x8));
+			sum_u_32x4 = vmlal_u16(sum_u_32x4, vget_high_u16(weightedHigh_u_16x8), vget_high_u16(differencesHigh_u_16x8));
+		}
+
+		frame0 += frame0StrideElements;
+		frame1 += frame1StrideElements;
+		mask0 += mask0StrideElements;
+	}
+
+	const uint32x2_t sum_u_32x2 = vadd_u32(vget_low_u32(sum_u_32x4), vget_high_u32(sum_u_32x4));
+
+	return vget_lane_u32(sum_u_32x2, 0) + vget_lane_u32(sum_u_32x2, 1);
+}
+
+#endif // OCEAN_HARDWARE_NEON_VERSION >= 10
+
+template <unsigned int tChannels>
+constexpr std::array<uint8_t, 32> MappingI::ssd5x5WeightIndices()
+{
+	static_assert(tChannels >= 1u && tChannels <= 4u, "Invalid channel number!");
+
+	std::array<uint8_t, 32> indices = {};
+
+	for (unsigned int n = 0u; n < 32u; ++n)
+	{
+		indices[n] = n < 5u * tChannels ? uint8_t(n / tChannels) : uint8_t(0x80u);
+	}
+
+	return indices;
+}
+
 inline MappingI& MappingI::operator=(const MappingI& pixelMapping)
 {
 	if (this != &pixelMapping)
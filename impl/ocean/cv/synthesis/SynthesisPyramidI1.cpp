@@ -15,6 +15,7 @@
 #include "ocean/cv/synthesis/InitializerCoarserMappingAdaptionSpatialCostMaskI1.h"
 #include "ocean/cv/synthesis/InitializerCoarserMappingAdaptionI1.h"
 #include "ocean/cv/synthesis/InitializerContourMappingI1.h"
+#include "ocean/cv/synthesis/InitializerHomographyMappingAdaptionCostMaskI1.h"
 #include "ocean/cv/synthesis/InitializerRandomMappingAreaConstrainedI1.h"
 #include "ocean/cv/synthesis/InitializerRandomMappingI1.h"
 #include "ocean/cv/synthesis/InitializerShrinkingErosionI1.h"
@@ -354,6 +355,97 @@ bool SynthesisPyramidI1::applyInpainting(const Constraints& constraints, RandomG
 	return true;
 }
 
+bool SynthesisPyramidI1::applyInpainting(const SynthesisPyramidI1& previousPyramid, const SquareMatrix3& homography, RandomGenerator& randomGenerator, const unsigned int weightFactor, const unsigned int borderFactor, const unsigned int maxSpatialCost, const unsigned int optimizationIterations, Worker* worker)
+{
+#ifdef OCEAN_DEBUG
+	ocean_assert(synthesisHasBeenArranged_);
+#endif
+
+	ocean_assert(&previousPyramid != this);
+	ocean_assert(!homography.isSingular());
+
+	ocean_assert(synthesisFramePyramid_.layers() == synthesisMaskPyramid_.layers());
+	ocean_assert(synthesisBoundingBoxes_.size() >= synthesisFramePyramid_.layers());
+
+	ocean_assert(optimizationIterations >= 1u);
+
+	ocean_assert(weightFactor == 5u && borderFactor == 25u && "Currently we do not support other parameters as we need those parameters as template parameters, a solution can be a template and non-template implementation");
+
+	if (&previousPyramid == this || homography.isSingular())
+	{
+		return false;
+	}
+
+	const unsigned int layers = (unsigned int)synthesisFramePyramid_.layers();
+	const size_t previousLayers = previousPyramid.layersReversedOrder_.size();
+
+	bool previousLayersMatch = layers >= 2u && previousLayers >= 2u && !synthesisFilterPyramid_.isValid();
+
+	for (unsigned int layerIndex = 0u; previousLayersMatch && layerIndex < 2u; ++layerIndex)
+	{
+		const LayerI1& previousLayer = previousPyramid.layersReversedOrder_[previousLayers - layerIndex - 1];
+
+		previousLayersMatch = previousLayer.frame().frameType() == synthesisFramePyramid_[layerIndex].frameType();
+	}
+
+	if (!previousLayersMatch)
+	{
+		// e.g., the first frame of a sequence, or the resolution of the sequence has changed
+
+		return applyInpainting(IT_APPEARANCE, randomGenerator, weightFactor, borderFactor, maxSpatialCost, optimizationIterations, 0u, 0u, worker);
+	}
+
+	// the layer vector must not be reallocated as the finest layer is initialized with the second finest layer
+	layersReversedOrder_.clear();
+	layersReversedOrder_.reserve(2);
+
+	for (unsigned int layerIndex = 1u; layerIndex != (unsigned int)(-1); --layerIndex)
+	{
+		const unsigned int maxSpatialCostLayer = maxSpatialCost == (unsigned int)(-1) ? (unsigned int)(-1) : max(1u, maxSpatialCost >> (layerIndex * 2u));
+
+		Frame& frame = synthesisFramePyramid_[layerIndex];
+		const Frame& mask = synthesisMaskPyramid_[layerIndex];
+
+		ocean_assert(frame.isValid() && mask.isValid() && FrameType(frame, mask.pixelFormat()) == mask.frameType());
+
+		const PixelBoundingBox& boundingBox = synthesisBoundingBoxes_[layerIndex];
+
+		const LayerI1* coarserLayer = layersReversedOrder_.empty() ? nullptr : &layersReversedOrder_.back();
+
+		layersReversedOrder_.emplace_back(frame, mask, boundingBox);
+		LayerI1& layer = layersReversedOrder_.back();
+
+		const LayerI1& previousLayer = previousPyramid.layersReversedOrder_[previousLayers - layerIndex - 1];
+
+		/**
+		 * the homography is defined for the finest layer, for coarser layers we have:
+		 * H_layer = diag(1/s, 1/s, 1) * H * diag(s, s, 1), with s = 2^layerIndex
+		 */
+		SquareMatrix3 layerHomography(homography);
+
+		if (layerIndex != 0u)
+		{
+			const Scalar factor = Scalar(1u << layerIndex);
+
+			layerHomography(0, 2) /= factor;
+			layerHomography(1, 2) /= factor;
+			layerHomography(2, 0) *= factor;
+			layerHomography(2, 1) *= factor;
+		}
+
+		Frame costMask;
+		if (!InitializerHomographyMappingAdaptionCostMaskI1<25u>(layer, randomGenerator, previousLayer, layerHomography, costMask, coarserLayer).invoke(worker))
+		{
+			return false;
+		}
+
+		// the initializer has applied the adapted mapping already
+		Optimizer4NeighborhoodHighPerformanceSkippingByCostMaskI1<5u, 25u, true>(layer, randomGenerator, costMask).invoke(5u, optimizationIterations, maxSpatialCostLayer, worker, false);
+	}
+
+	return true;
+}
+
 bool SynthesisPyramidI1::createInpaintingResult(Frame& frame, Worker* worker) const
 {
 	ocean_assert(!layersReversedOrder_.empty());
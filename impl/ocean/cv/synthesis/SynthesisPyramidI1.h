@@ -15,6 +15,8 @@
 
 #include "ocean/base/RandomGenerator.h"
 
+#include "ocean/math/SquareMatrix3.h"
+
 namespace Ocean
 {
 
@@ -84,6 +86,35 @@ class OCEAN_CV_SYNTHESIS_EXPORT SynthesisPyramidI1 : public SynthesisPyramid
 		 */
 		bool applyInpainting(const Constraints& constraints, RandomGenerator& randomGenerator, const unsigned int weightFactor = 5u, const unsigned int borderFactor = 26u, const unsigned int maxSpatialCost = (unsigned int)(-1), const unsigned int optimizationIterations = 4u, const unsigned int skippingConstraintLayers = 2u, Worker* worker = nullptr);
 
+		/**
+		 * Applies the inpainting for a frame of a video sequence by adapting the synthesis result of the previous frame, for temporally coherent video inpainting.
+		 * The mappings of the two finest layers of the previous pyramid are transformed by the homography, only the two finest layers of this pyramid are optimized.<br>
+		 * The optimization is restricted to mask pixels without valid previous mapping and to mask pixels whose adapted mapping has a worse appearance cost than in the previous frame.<br>
+		 * The entire pyramid is inpainted (with appearance initialization) if the previous pyramid does not hold a synthesis result with matching layers, e.g., for the first frame of a sequence.<br>
+		 * After the adaption, this pyramid holds the two finest layers only, the layers of the previous pyramid must not be released before this function returns.<br>
+		 * Video inpainting alternates between two pyramid objects, each pyramid must be arranged with the new frame before this function is invoked:
+		 * <pre>
+		 * SynthesisPyramidI1 pyramids[2];
+		 * for (size_t n = 0; n < frames.size(); ++n)
+		 * {
+		 *     SynthesisPyramidI1& pyramid = pyramids[n % 2];
+		 *     pyramid.arrange(frames[n], masks[n], worker);
+		 *     pyramid.applyInpainting(pyramids[(n + 1) % 2], homographies[n], randomGenerator, 5u, 25u, (unsigned int)(-1), 2u, worker);
+		 *     pyramid.createInpaintingResult(frames[n], worker);
+		 * }
+		 * </pre>
+		 * @param previousPyramid The synthesis pyramid of the previous frame, must not be this pyramid
+		 * @param homography The homography transforming points defined in the current frame to points defined in the previous frame, must be invertible
+		 * @param randomGenerator The random number generator to be used
+		 * @param weightFactor Spatial weight impact, with range [0, infinity)
+		 * @param borderFactor Weight factor of border pixels, with range [1, infinity)
+		 * @param maxSpatialCost Maximal spatial cost, with range [0, 0xFFFFFFFF]
+		 * @param optimizationIterations The number of optimization iterations on each of the two finest pyramid layers, with range [1, infinity)
+		 * @param worker Optional worker object to distribute the computation
+		 * @return True, if succeeded
+		 */
+		bool applyInpainting(const SynthesisPyramidI1& previousPyramid, const SquareMatrix3& homography, RandomGenerator& randomGenerator, const unsigned int weightFactor = 5u, const unsigned int borderFactor = 25u, const unsigned int maxSpatialCost = (unsigned int)(-1), const unsigned int optimizationIterations = 2u, Worker* worker = nullptr);
+
 		/**
 		 * Creates the final inpainting result for the finest pyramid layer.
 		 * @see SynthesisPyramid::createInpaintingResult().
@@ -23,6 +23,16 @@ Media::FrameMediumRefs DevicePlayer::frameMediums()
 	return Media::FrameMediumRefs();
 }
 
+bool DevicePlayer::frameConsumed()
+{
+	return false;
+}
+
+DevicePlayer::PlaybackStatistics DevicePlayer::playbackStatistics() const
+{
+	return PlaybackStatistics();
+}
+
 bool DevicePlayer::isValid() const
 {
 	const ScopedLock scopedLock(lock_);
@@ -46,6 +46,14 @@ class OCEAN_DEVICES_EXPORT DevicePlayer
 		 */
 		static constexpr float SPEED_USE_STOP_MOTION = 0.0f;
 
+		/**
+		 * Definition of a speed value for the consumer-paced replay mode.
+		 * The player plays the recording frame by frame (as in the stop-motion mode) in its own thread, as fast as the consumer can handle the frames.<br>
+		 * The next frame is played as soon as the consumer has signaled that it is done with the previous frame, the replay does not depend on the wall clock.
+		 * @see frameConsumed().
+		 */
+		static constexpr float SPEED_USE_CONSUMER_PACED = -1.0f;
+
 		/**
 		 * Definition of individual transformation results.
 		 */
@@ -59,6 +67,41 @@ class OCEAN_DEVICES_EXPORT DevicePlayer
 			TR_PRECISE
 		};
 
+		/**
+		 * This class holds the timing statistics of a replay, e.g., to use the replay as throughput benchmark.
+		 * All times are accumulated over the entire replay, in seconds.
+		 */
+		class PlaybackStatistics
+		{
+			public:
+
+				/**
+				 * Returns the average number of frames which have been played per second.
+				 * @return The replay's throughput in frames per second, 0 if no frame has been played
+				 */
+				inline double framesPerSecond() const;
+
+			public:
+
+				/// The number of frames which have been played.
+				size_t frames_ = 0;
+
+				/// The number of samples which have been played, including the frames.
+				size_t samples_ = 0;
+
+				/// The time the player spent reading samples from the recording.
+				double readTime_ = 0.0;
+
+				/// The time the player spent processing the samples (e.g., decoding frames and forwarding them to the devices and media objects).
+				double processTime_ = 0.0;
+
+				/// The time the player spent waiting for the consumer, relevant for the consumer-paced mode only.
+				double consumerTime_ = 0.0;
+
+				/// The overall time of the replay.
+				double totalTime_ = 0.0;
+		};
+
 	public:
 
 		/**
@@ -82,7 +125,7 @@ class OCEAN_DEVICES_EXPORT DevicePlayer
 		 * Starts the replay.
 		 * The recording can be played with individual speed, e.g., real-time, slower than real-time, faster than real-time.<br>
 		 * Further, the player supports a stop-motion mode in which the player will play frame by frame.
-		 * @param speed The speed at which the recording will be played, e.g., 2 means two times faster than normal, with range (0, infinity) for normal playback, or 'SPEED_USE_STOP_MOTION' to play the recording in a stop-motion (frame by frame) mode
+		 * @param speed The speed at which the recording will be played, e.g., 2 means two times faster than normal, with range (0, infinity) for normal playback, 'SPEED_USE_STOP_MOTION' to play the recording in a stop-motion (frame by frame) mode, or 'SPEED_USE_CONSUMER_PACED' to play the recording as fast as the consumer can handle the frames
 		 * @return True, if succeeded
 		 * @see duration(), playNextFrame();
 		 */
@@ -104,6 +147,21 @@ class OCEAN_DEVICES_EXPORT DevicePlayer
 		 */
 		virtual Timestamp playNextFrame() = 0;
 
+		/**
+		 * Signals that the consumer is done with the most recent frame, the player must be started with consumer-paced mode ('SPEED_USE_CONSUMER_PACED').
+		 * The player will play the next frame afterwards.<br>
+		 * The function can be called from any thread.
+		 * @return True, if succeeded
+		 * @see start().
+		 */
+		virtual bool frameConsumed();
+
+		/**
+		 * Returns the timing statistics of the current (or most recent) replay.
+		 * @return The player's statistics, default statistics if the player does not support statistics
+		 */
+		virtual PlaybackStatistics playbackStatistics() const;
+
 		/**
 		 * Returns the duration of the content when played with default speed.
 		 * @return The recording's default duration, in seconds, with range [0, infinity)
@@ -147,6 +205,16 @@ class OCEAN_DEVICES_EXPORT DevicePlayer
 		mutable Lock lock_;
 };
 
+inline double DevicePlayer::PlaybackStatistics::framesPerSecond() const
+{
+	if (frames_ == 0 || totalTime_ <= 0.0)
+	{
+		return 0.0;
+	}
+
+	return double(frames_) / totalTime_;
+}
+
 } // namespace Devices
 
 } // namespace Ocean
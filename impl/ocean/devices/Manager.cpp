@@ -7,6 +7,8 @@
 
 #include "ocean/devices/Manager.h"
 
+#include "ocean/base/PluginManager.h"
+
 namespace Ocean
 {
 
@@ -31,7 +33,7 @@ Manager::~Manager()
 
 DeviceRef Manager::device(const std::string& name, const bool useExclusive)
 {
-	const ScopedLock scopedLock(lock_);
+	TemporaryScopedLock scopedLock(lock_);
 
 	for (std::unique_ptr<Factory>& factory : factories_)
 	{
@@ -43,6 +45,15 @@ DeviceRef Manager::device(const std::string& name, const bool useExclusive)
 		}
 	}
 
+	// the manager must not be locked while a plugin is loaded, as the plugin registers its factory
+
+	scopedLock.release();
+
+	if (PluginManager::get().loadPluginForCapability(name, PluginManager::TYPE_DEVICE))
+	{
+		return device(name, useExclusive);
+	}
+
 	return DeviceRef();
 }
 
@@ -74,6 +74,7 @@ class OCEAN_DEVICES_EXPORT Manager : public Singleton<Manager>
 
 		/**
 		 * Returns a specific device.
+		 * If no registered factory provides the device, a collected device plugin declaring the device name is loaded on demand, see PluginManager::loadPluginForCapability().
 		 * @param name The name of the device to return, must be valid
 		 * @param useExclusive True, if the caller would like to use this device exclusively; False, if the device can be shared
 		 * @return The requested device, if available
@@ -10,6 +10,8 @@
 
 #include "ocean/math/Interpolation.h"
 
+#include <algorithm>
+
 namespace Ocean
 {
 
@@ -77,146 +79,474 @@ Measurement::SampleEventSubscription& Measurement::SampleEventSubscription::oper
 	return *this;
 }
 
-Measurement::Measurement(const std::string& name, const DeviceType type) :
-	Device(name, type)
+Measurement::SampleHistory::SampleHistory(const size_t capacity) :
+	slots_(new std::atomic<const SampleRef*>[capacity]),
+	capacity_(capacity)
 {
-	ocean_assert((type.majorType() & DEVICE_MEASUREMENT) == DEVICE_MEASUREMENT);
+	ocean_assert(capacity >= 1);
+
+	for (size_t n = 0; n < capacity_; ++n)
+	{
+		slots_[n].store(nullptr, std::memory_order_relaxed);
+	}
 }
 
-Measurement::~Measurement()
+Measurement::SampleHistory::~SampleHistory()
 {
-	ocean_assert(sampleSubscriptionMap_.empty());
+	for (size_t n = 0; n < capacity_; ++n)
+	{
+		delete slots_[n].load(std::memory_order_relaxed);
+	}
 }
 
-bool Measurement::setSampleCapacity(const size_t capacity)
+bool Measurement::SampleHistory::insert(const SampleRef* sample, SampleRefPointers& removedSamples)
 {
-	const ScopedLock scopedLock(samplesLock_);
+	ocean_assert(sample != nullptr && *sample);
 
-	if (capacity < 2)
+	const Timestamp& timestamp = (*sample)->timestamp();
+
+	// only the writing thread modifies the history, so that relaxed loads are sufficient
+
+	size_t firstIndex = firstIndex_.load(std::memory_order_relaxed);
+	size_t size = size_.load(std::memory_order_relaxed);
+
+	// the position of the new sample, samples are posted in chronological order in almost all cases
+
+	size_t position = size;
+
+	if (size != 0 && timestamp <= (*slot(firstIndex, size - 1))->timestamp())
 	{
-		return false;
+		size_t lowerPosition = 0;
+		size_t upperPosition = size - 1;
+
+		while (lowerPosition < upperPosition)
+		{
+			const size_t middlePosition = (lowerPosition + upperPosition) / 2;
+
+			if ((*slot(firstIndex, middlePosition))->timestamp() < timestamp)
+			{
+				lowerPosition = middlePosition + 1;
+			}
+			else
+			{
+				upperPosition = middlePosition;
+			}
+		}
+
+		if ((*slot(firstIndex, lowerPosition))->timestamp() == timestamp)
+		{
+			// the history holds a sample with same timestamp already, we keep the existing sample
+			return false;
+		}
+
+		position = lowerPosition;
 	}
 
-	while (sampleMap_.size() > capacity)
-	{
-		ocean_assert(sampleMap_.size() < 2 || sampleMap_.begin()->first < sampleMap_.rbegin()->first);
+	const unsigned int sequence = sequence_.load(std::memory_order_relaxed);
+	ocean_assert(sequence % 2u == 0u);
+
+	sequence_.store(sequence + 1u, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_release);
 
+	if (size == capacity_)
+	{
 		// removing the oldest sample
-		sampleMap_.erase(sampleMap_.begin());
+
+		removedSamples.emplace_back(slot(firstIndex, 0).load(std::memory_order_relaxed));
+		slot(firstIndex, 0).store(nullptr, std::memory_order_release);
+
+		firstIndex = (firstIndex + 1) % capacity_;
+		--size;
+
+		if (position != 0)
+		{
+			--position;
+		}
 	}
 
-	sampleCapacity_ = capacity;
+	for (size_t n = size; n > position; --n)
+	{
+		slot(firstIndex, n).store(slot(firstIndex, n - 1).load(std::memory_order_relaxed), std::memory_order_release);
+	}
+
+	slot(firstIndex, position).store(sample, std::memory_order_release);
+
+	firstIndex_.store(firstIndex, std::memory_order_relaxed);
+	size_.store(size + 1, std::memory_order_relaxed);
+
+	sequence_.store(sequence + 2u, std::memory_order_release);
+
 	return true;
 }
 
-Measurement::SampleRef Measurement::sample() const
+void Measurement::SampleHistory::copyMostRecentSamples(SampleHistory& history) const
 {
-	const ScopedLock scopedLock(samplesLock_);
+	ocean_assert(history.size_.load(std::memory_order_relaxed) == 0);
+
+	const size_t firstIndex = firstIndex_.load(std::memory_order_relaxed);
+	const size_t size = size_.load(std::memory_order_relaxed);
 
-	// looking for the most recent sample
-	const SampleMap::const_reverse_iterator i = sampleMap_.crbegin();
+	const size_t numberSamples = std::min(size, history.capacity_);
 
-	if (i == sampleMap_.crend())
+	for (size_t n = 0; n < numberSamples; ++n)
 	{
-		return SampleRef();
+		const SampleRef* sample = slot(firstIndex, size - numberSamples + n).load(std::memory_order_relaxed);
+		ocean_assert(sample != nullptr);
+
+		history.slots_[n].store(new SampleRef(*sample), std::memory_order_relaxed);
 	}
 
-	return i->second;
+	history.size_.store(numberSamples, std::memory_order_relaxed);
 }
 
-Measurement::SampleRef Measurement::sample(const Timestamp timestamp) const
+Measurement::SampleRef Measurement::SampleHistory::mostRecentSample() const
 {
-	const ScopedLock scopedLock(samplesLock_);
+	while (true)
+	{
+		const unsigned int sequence = sequence_.load(std::memory_order_acquire);
+
+		if (sequence % 2u == 0u)
+		{
+			const size_t size = size_.load(std::memory_order_relaxed);
+			const SampleRef* sample = size == 0 ? nullptr : slot(firstIndex_.load(std::memory_order_relaxed), size - 1).load(std::memory_order_acquire);
+
+			std::atomic_thread_fence(std::memory_order_acquire);
+
+			if (sequence_.load(std::memory_order_relaxed) == sequence)
+			{
+				return sample != nullptr ? *sample : SampleRef();
+			}
+		}
+
+		// the writer is modifying the history, which takes a few instructions only
 
-	const SampleMap::const_iterator i = sampleMap_.find(timestamp);
+		Thread::giveUp();
+	}
+}
 
-	if (i == sampleMap_.cend())
+bool Measurement::SampleHistory::mostRecentSamples(SampleRef& previousSample, SampleRef& latestSample) const
+{
+	while (true)
 	{
-		if (sampleMap_.empty())
+		const unsigned int sequence = sequence_.load(std::memory_order_acquire);
+
+		if (sequence % 2u == 0u)
 		{
-			return SampleRef();
+			const size_t firstIndex = firstIndex_.load(std::memory_order_relaxed);
+			const size_t size = std::min(size_.load(std::memory_order_relaxed), capacity_);
+
+			const SampleRef* previous = size >= 2 ? slot(firstIndex, size - 2).load(std::memory_order_acquire) : nullptr;
+			const SampleRef* latest = size >= 1 ? slot(firstIndex, size - 1).load(std::memory_order_acquire) : nullptr;
+
+			std::atomic_thread_fence(std::memory_order_acquire);
+
+			if (sequence_.load(std::memory_order_relaxed) == sequence && (size < 2 || previous != nullptr) && (size < 1 || latest != nullptr))
+			{
+				previousSample = previous != nullptr ? *previous : SampleRef();
+				latestSample = latest != nullptr ? *latest : SampleRef();
+
+				return size != 0;
+			}
 		}
 
-		ocean_assert(sampleMap_.rbegin() != sampleMap_.rend());
-		return sampleMap_.rbegin()->second;
+		Thread::giveUp();
 	}
+}
 
-	return i->second;
+bool Measurement::SampleHistory::enclosingSamples(const Timestamp& timestamp, SampleRef& lowerSample, SampleRef& upperSample) const
+{
+	while (true)
+	{
+		const unsigned int sequence = sequence_.load(std::memory_order_acquire);
+
+		if (sequence % 2u == 0u)
+		{
+			const size_t firstIndex = firstIndex_.load(std::memory_order_relaxed);
+			const size_t size = std::min(size_.load(std::memory_order_relaxed), capacity_);
+
+			// the samples are not released while the reader exists, so that the pointers stay valid even if the writer modifies the history concurrently
+
+			bool isConsistent = true;
+
+			size_t lowerPosition = 0;
+			size_t upperPosition = size;
+
+			// we determine the position of the first sample with timestamp after the given timestamp
+
+			while (lowerPosition < upperPosition)
+			{
+				const size_t middlePosition = (lowerPosition + upperPosition) / 2;
+
+				const SampleRef* sample = slot(firstIndex, middlePosition).load(std::memory_order_acquire);
+
+				if (sample == nullptr)
+				{
+					isConsistent = false;
+					break;
+				}
+
+				if ((*sample)->timestamp() <= timestamp)
+				{
+					lowerPosition = middlePosition + 1;
+				}
+				else
+				{
+					upperPosition = middlePosition;
+				}
+			}
+
+			const SampleRef* lower = isConsistent && lowerPosition != 0 ? slot(firstIndex, lowerPosition - 1).load(std::memory_order_acquire) : nullptr;
+			const SampleRef* upper = isConsistent && lowerPosition < size ? slot(firstIndex, lowerPosition).load(std::memory_order_acquire) : nullptr;
+
+			std::atomic_thread_fence(std::memory_order_acquire);
+
+			if (isConsistent && sequence_.load(std::memory_order_relaxed) == sequence)
+			{
+				ocean_assert(size != 0 || (lower == nullptr && upper == nullptr));
+
+				lowerSample = lower != nullptr ? *lower : SampleRef();
+				upperSample = upper != nullptr ? *upper : SampleRef();
+
+				return size != 0;
+			}
+		}
+
+		Thread::giveUp();
+	}
 }
 
-Measurement::SampleRef Measurement::sample(const Timestamp& timestamp, const InterpolationStrategy interpolationStrategy) const
+Measurement::ScopedSampleReader::ScopedSampleReader(const Measurement& measurement) :
+	measurement_(measurement)
+{
+	// the reader is registered for the epoch which is still current after the registration, so that the writer cannot have missed the registration
+
+	while (true)
+	{
+		epoch_ = measurement_.sampleEpoch_.load();
+
+		measurement_.sampleEpochReaders_[epoch_ & 1u].fetch_add(1u);
+
+		if (measurement_.sampleEpoch_.load() == epoch_)
+		{
+			break;
+		}
+
+		measurement_.sampleEpochReaders_[epoch_ & 1u].fetch_sub(1u);
+	}
+
+	history_ = measurement_.sampleHistory_.load(std::memory_order_acquire);
+	ocean_assert(history_ != nullptr);
+}
+
+Measurement::SampleEventDispatcher::SampleEventDispatcher(Measurement& measurement, const size_t capacity) :
+	Thread("Sample event dispatcher"),
+	measurement_(measurement),
+	samples_(capacity)
+{
+	ocean_assert(capacity >= 1);
+
+	startThread();
+}
+
+Measurement::SampleEventDispatcher::~SampleEventDispatcher()
+{
+	stopThread();
+	signal_.pulse();
+
+	stopThreadExplicitly();
+}
+
+bool Measurement::SampleEventDispatcher::post(const SampleRef& sample)
+{
+	ocean_assert(sample);
+	ocean_assert(!samples_.empty());
+
+	const size_t numberPostedSamples = numberPostedSamples_.load(std::memory_order_relaxed);
+
+	if (numberPostedSamples - numberDispatchedSamples_.load(std::memory_order_acquire) >= samples_.size())
+	{
+		return false;
+	}
+
+	samples_[numberPostedSamples % samples_.size()] = sample;
+
+	numberPostedSamples_.store(numberPostedSamples + 1, std::memory_order_release);
+
+	signal_.pulse();
+
+	return true;
+}
+
+void Measurement::SampleEventDispatcher::dispatchSamples()
+{
+	size_t numberDispatchedSamples = numberDispatchedSamples_.load(std::memory_order_relaxed);
+
+	while (numberDispatchedSamples != numberPostedSamples_.load(std::memory_order_acquire))
+	{
+		const SampleRef sample(std::move(samples_[numberDispatchedSamples % samples_.size()]));
+
+		numberDispatchedSamples_.store(++numberDispatchedSamples, std::memory_order_release);
+
+		measurement_.invokeSampleEvents(sample);
+	}
+}
+
+void Measurement::SampleEventDispatcher::threadRun()
+{
+	while (!shouldThreadStop())
+	{
+		signal_.wait(waitTime_);
+
+		dispatchSamples();
+	}
+
+	// samples which have been posted before the thread stopped are dispatched as well
+
+	dispatchSamples();
+}
+
+Measurement::Measurement(const std::string& name, const DeviceType type) :
+	Device(name, type),
+	sampleHistory_(new SampleHistory(sampleCapacity_))
+{
+	ocean_assert((type.majorType() & DEVICE_MEASUREMENT) == DEVICE_MEASUREMENT);
+}
+
+Measurement::~Measurement()
+{
+	ocean_assert(sampleSubscriptionMap_.empty());
+
+	sampleEventDispatcher_.reset();
+
+	ocean_assert(sampleEpochReaders_[0] == 0u && sampleEpochReaders_[1] == 0u);
+
+	for (SampleRefPointers& retiredSamples : retiredSamples_)
+	{
+		for (const SampleRef* retiredSample : retiredSamples)
+		{
+			delete retiredSample;
+		}
+	}
+
+	delete sampleHistory_.load();
+}
+
+bool Measurement::setSampleCapacity(const size_t capacity)
 {
 	const ScopedLock scopedLock(samplesLock_);
 
-	if (sampleMap_.empty())
+	if (capacity < 2)
 	{
-		return SampleRef();
+		return false;
+	}
+
+	if (capacity != sampleCapacity_)
+	{
+		// the history is replaced, as readers may access the current history concurrently
+
+		SampleHistory* history = sampleHistory_.load(std::memory_order_relaxed);
+
+		SampleHistory* newHistory = new SampleHistory(capacity);
+		history->copyMostRecentSamples(*newHistory);
+
+		sampleHistory_.store(newHistory, std::memory_order_release);
+
+		SampleRefPointers removedSamples;
+		retireSamples(removedSamples, history);
 	}
 
-	if (sampleMap_.size() == 1)
+	sampleCapacity_ = capacity;
+	return true;
+}
+
+Measurement::SampleRef Measurement::sample() const
+{
+	const ScopedSampleReader sampleReader(*this);
+
+	return sampleReader.history().mostRecentSample();
+}
+
+Measurement::SampleRef Measurement::sample(const Timestamp timestamp) const
+{
+	const ScopedSampleReader sampleReader(*this);
+
+	SampleRef lowerSample;
+	SampleRef upperSample;
+
+	if (!sampleReader.history().enclosingSamples(timestamp, lowerSample, upperSample))
 	{
-		// we just have one sample, so we return this one without any further handling
+		return SampleRef();
+	}
 
-		ocean_assert(sampleMap_.rbegin() != sampleMap_.rend());
-		return sampleMap_.rbegin()->second;
+	if (lowerSample && lowerSample->timestamp() == timestamp)
+	{
+		return lowerSample;
 	}
 
-	// let's find the sample with timestamp bigger (younger) than the specified timestamp
-	const SampleMap::const_iterator iUpper = sampleMap_.upper_bound(timestamp);
+	// no sample exists with the given timestamp, so that we return the most recent sample
+
+	return sampleReader.history().mostRecentSample();
+}
+
+Measurement::SampleRef Measurement::sample(const Timestamp& timestamp, const InterpolationStrategy interpolationStrategy) const
+{
+	SampleRef lowerSample;
+	SampleRef upperSample;
 
-	if (iUpper == sampleMap_.end())
 	{
-		// our timestamp is too new so that we simply return the sample of the most recent timestamp
+		const ScopedSampleReader sampleReader(*this);
 
-		ocean_assert(sampleMap_.rbegin() != sampleMap_.rend());
-		return sampleMap_.rbegin()->second;
+		if (!sampleReader.history().enclosingSamples(timestamp, lowerSample, upperSample))
+		{
+			return SampleRef();
+		}
 	}
 
-	ocean_assert(iUpper->first > timestamp);
+	ocean_assert(lowerSample || upperSample);
 
-	if (iUpper == sampleMap_.begin())
+	if (!upperSample)
 	{
-		// our timestamp is too old so that we simply return the oldest sample we have
+		// our timestamp is too new so that we simply return the sample of the most recent timestamp (this is also the case if we have just one sample)
 
-		ocean_assert(sampleMap_.begin() != sampleMap_.end());
-		return sampleMap_.begin()->second;
+		return lowerSample;
 	}
 
-	SampleMap::const_iterator iLower(iUpper);
+	ocean_assert(upperSample->timestamp() > timestamp);
 
-	ocean_assert(iLower != sampleMap_.begin());
-	iLower--;
+	if (!lowerSample)
+	{
+		// our timestamp is too old so that we simply return the oldest sample we have
 
-	ocean_assert(iLower->first == iLower->second->timestamp());
-	ocean_assert(iUpper->first == iUpper->second->timestamp());
+		return upperSample;
+	}
 
-	ocean_assert(iLower->first <= timestamp);
+	ocean_assert(lowerSample->timestamp() <= timestamp);
 
-	const double lowerDelta = double(timestamp - iLower->first);
-	const double upperDelta = double(iUpper->first - timestamp);
+	const double lowerDelta = double(timestamp - lowerSample->timestamp());
+	const double upperDelta = double(upperSample->timestamp() - timestamp);
 	ocean_assert(lowerDelta >= 0.0 && upperDelta >= 0.0);
 
 	if (interpolationStrategy == IS_TIMESTAMP_INTERPOLATE)
 	{
 		const double delta = lowerDelta + upperDelta;
-		ocean_assert(NumericD::isEqual(delta, double(iUpper->first - iLower->first)));
+		ocean_assert(NumericD::isEqual(delta, double(upperSample->timestamp() - lowerSample->timestamp())));
 
 		if (NumericD::isEqualEps(delta))
 		{
 			// both samples are almost identical, so that we return the sample from the past (not from the future)
-			return iLower->second;
+			return lowerSample;
 		}
 
-		ocean_assert(iLower->second->objectIds() == iUpper->second->objectIds()); // this is a restriction that will not hold in any case, we need to handle it if necessary
+		ocean_assert(lowerSample->objectIds() == upperSample->objectIds()); // this is a restriction that will not hold in any case, we need to handle it if necessary
 
 		const double interpolationFactor = lowerDelta / delta;
 		ocean_assert(interpolationFactor >= 0.0 && interpolationFactor <= 1.0);
 
-		const Timestamp interpolatedTimestamp = Timestamp(Interpolation::linear(double(iLower->second->timestamp()), double(iUpper->second->timestamp()), double(interpolationFactor)));
-		ocean_assert(iLower->second->timestamp() <= interpolatedTimestamp && interpolatedTimestamp <= iUpper->second->timestamp());
+		const Timestamp interpolatedTimestamp = Timestamp(Interpolation::linear(double(lowerSample->timestamp()), double(upperSample->timestamp()), double(interpolationFactor)));
+		ocean_assert(lowerSample->timestamp() <= interpolatedTimestamp && interpolatedTimestamp <= upperSample->timestamp());
 		ocean_assert(NumericD::isEqual(double(interpolatedTimestamp), double(timestamp), NumericD::weakEps()));
 
-		return interpolateSamples(iLower->second, iUpper->second, interpolationFactor, interpolatedTimestamp);
+		return interpolateSamples(lowerSample, upperSample, interpolationFactor, interpolatedTimestamp);
 	}
 
 	ocean_assert(interpolationStrategy == IS_TIMESTAMP_NEAREST);
@@ -225,12 +555,46 @@ Measurement::SampleRef Measurement::sample(const Timestamp& timestamp, const Int
 
 	if (lowerDelta < upperDelta)
 	{
-		return iLower->second;
+		return lowerSample;
 	}
 	else
 	{
-		return iUpper->second;
+		return upperSample;
+	}
+}
+
+bool Measurement::setAsynchronousSampleEvents(const bool state, const size_t queueCapacity)
+{
+	ocean_assert(queueCapacity >= 1);
+
+	if (state && queueCapacity == 0)
+	{
+		return false;
+	}
+
+	std::unique_ptr<SampleEventDispatcher> sampleEventDispatcher;
+
+	{
+		const ScopedLock scopedLock(samplesLock_);
+
+		if (state)
+		{
+			if (!sampleEventDispatcher_)
+			{
+				sampleEventDispatcher_ = std::make_unique<SampleEventDispatcher>(*this, queueCapacity);
+			}
+
+			return true;
+		}
+
+		sampleEventDispatcher = std::move(sampleEventDispatcher_);
 	}
+
+	// the dispatcher is released outside of the lock, as the dispatch thread invokes the remaining events before it stops
+
+	sampleEventDispatcher.reset();
+
+	return true;
 }
 
 Measurement::SampleEventSubscription Measurement::subscribeSampleEvent(SampleCallback&& callback)
@@ -303,23 +667,29 @@ void Measurement::postNewSample(const SampleRef& newSample)
 	{
 		const ScopedLock scopedLock(samplesLock_);
 
-		if (sampleMap_.size() >= sampleCapacity_)
-		{
-			const SampleMap::iterator i = sampleMap_.begin();
-			ocean_assert(i != sampleMap_.end());
+		const SampleRef* sample = new SampleRef(newSample);
 
-			sampleMap_.erase(i);
+		SampleRefPointers removedSamples;
+
+		if (!sampleHistory_.load(std::memory_order_relaxed)->insert(sample, removedSamples))
+		{
+			delete sample;
 		}
 
-		sampleMap_.emplace(newSample->timestamp(), newSample);
-	}
+		retireSamples(removedSamples);
 
-	const ScopedLock scopedLock(subscriptionLock_);
+		if (sampleEventDispatcher_)
+		{
+			if (!sampleEventDispatcher_->post(newSample))
+			{
+				droppedSampleEvents_.fetch_add(1u, std::memory_order_relaxed);
+			}
 
-	for (SampleSubscriptionMap::const_iterator i = sampleSubscriptionMap_.cbegin(); i != sampleSubscriptionMap_.cend(); ++i)
-	{
-		i->second(this, newSample);
+			return;
+		}
 	}
+
+	invokeSampleEvents(newSample);
 }
 
 Measurement::ObjectId Measurement::addUniqueObjectId(const std::string& description)
@@ -356,6 +726,55 @@ void Measurement::unsubscribeSampleEvent(const SubscriptionId subscriptionId)
 	}
 }
 
+void Measurement::invokeSampleEvents(const SampleRef& sample)
+{
+	ocean_assert(sample);
+
+	const ScopedLock scopedLock(subscriptionLock_);
+
+	for (SampleSubscriptionMap::const_iterator i = sampleSubscriptionMap_.cbegin(); i != sampleSubscriptionMap_.cend(); ++i)
+	{
+		i->second(this, sample);
+	}
+}
+
+void Measurement::retireSamples(SampleRefPointers& removedSamples, SampleHistory* removedHistory)
+{
+	// only the writing thread changes the epoch
+
+	const unsigned int epoch = sampleEpoch_.load(std::memory_order_relaxed);
+
+	SampleRefPointers& retiredSamples = retiredSamples_[epoch & 1u];
+	retiredSamples.insert(retiredSamples.end(), removedSamples.cbegin(), removedSamples.cend());
+	removedSamples.clear();
+
+	if (removedHistory != nullptr)
+	{
+		retiredSampleHistories_[epoch & 1u].emplace_back(removedHistory);
+	}
+
+	// readers of the previous epoch may still access objects retired during the previous epoch, readers of the current epoch may access objects retired during both epochs
+
+	const unsigned int previousParity = (epoch + 1u) & 1u;
+
+	if (sampleEpochReaders_[previousParity].load() != 0u)
+	{
+		return;
+	}
+
+	for (const SampleRef* retiredSample : retiredSamples_[previousParity])
+	{
+		delete retiredSample;
+	}
+
+	retiredSamples_[previousParity].clear();
+	retiredSampleHistories_[previousParity].clear();
+
+	// new readers enter the next epoch, objects retired from now on are kept until all readers of the current epoch have left
+
+	sampleEpoch_.store(epoch + 1u);
+}
+
 Measurement::SampleRef Measurement::interpolateSamples(const SampleRef& lowerSample, const SampleRef& upperSample, const double /*interpolationFactor*/, const Timestamp& /*interpolatedTimestamp*/) const
 {
 	ocean_assert(lowerSample);
@@ -366,6 +785,12 @@ Measurement::SampleRef Measurement::interpolateSamples(const SampleRef& lowerSam
 	return lowerSample;
 }
 
+bool Measurement::mostRecentSamples(SampleRef& previousSample, SampleRef& latestSample) const
+{
+	const ScopedSampleReader sampleReader(*this);
+
+	return sampleReader.history().mostRecentSamples(previousSample, latestSample);
+}
 
 }
 
@@ -12,9 +12,14 @@
 #include "ocean/devices/DeviceRef.h"
 
 #include "ocean/base/Callback.h"
+#include "ocean/base/Signal.h"
 #include "ocean/base/StackHeapVector.h"
+#include "ocean/base/Thread.h"
 #include "ocean/base/Value.h"
 
+#include <atomic>
+#include <memory>
+
 namespace Ocean
 {
 
@@ -35,6 +40,8 @@ using MeasurementRef = SmartDeviceRef<Measurement>;
  * This class implements the base class for all devices providing measurement samples.
  * Each measurement holds a container holding several most recent samples provided by the device.<br>
  * Thus, depending on the number of stored samples a specific sample can be requested.<br>
+ * Samples can be requested from any thread without blocking the thread posting new samples.<br>
+ * Sample events are invoked by the posting thread by default, or by a dedicated dispatch thread, see setAsynchronousSampleEvents().
  * @ingroup devices
  */
 class OCEAN_DEVICES_EXPORT Measurement : virtual public Device
@@ -242,9 +249,214 @@ class OCEAN_DEVICES_EXPORT Measurement : virtual public Device
 	protected:
 
 		/**
-		 * Definition of a map holding the most recent samples
+		 * Definition of a vector holding pointers to sample references.
+		 */
+		using SampleRefPointers = std::vector<const SampleRef*>;
+
+		/**
+		 * This class implements the history of the most recent samples, sorted by their timestamps.
+		 * The history is a ring buffer of pointers to sample references, and has one writing thread at a time and arbitrary reading threads.<br>
+		 * Readers detect concurrent modifications with a sequence counter (seqlock) and repeat the lookup, so that readers never block the writer.<br>
+		 * Sample references removed from the history are not released by the history, they must be kept until no reader can access them anymore.
+		 */
+		class SampleHistory
+		{
+			public:
+
+				/**
+				 * Creates a new empty history.
+				 * @param capacity The maximal number of samples the history can hold, with range [1, infinity)
+				 */
+				explicit SampleHistory(const size_t capacity);
+
+				/**
+				 * Destructs the history and releases all samples which are still part of the history.
+				 */
+				~SampleHistory();
+
+				/**
+				 * Inserts a new sample, the oldest sample is removed if the history is full.
+				 * This function must be called by the writing thread only.
+				 * @param sample The sample to insert, must be valid, the history takes over the ownership if the sample is inserted
+				 * @param removedSamples The samples which have been removed from the history, will be appended
+				 * @return True, if succeeded; False, if the history holds a sample with same timestamp already
+				 */
+				bool insert(const SampleRef* sample, SampleRefPointers& removedSamples);
+
+				/**
+				 * Copies the most recent samples of this history to another (empty) history which has not been published to readers yet.
+				 * This function must be called by the writing thread only.
+				 * @param history The history receiving the samples
+				 */
+				void copyMostRecentSamples(SampleHistory& history) const;
+
+				/**
+				 * Returns the most recent sample.
+				 * The caller must ensure that removed samples are not released during the call, see ScopedSampleReader.
+				 * @return The most recent sample, invalid if the history is empty
+				 */
+				SampleRef mostRecentSample() const;
+
+				/**
+				 * Returns the two most recent samples.
+				 * The caller must ensure that removed samples are not released during the call, see ScopedSampleReader.
+				 * @param previousSample The resulting sample before the most recent sample, invalid if the history holds less than two samples
+				 * @param latestSample The resulting most recent sample, invalid if the history is empty
+				 * @return True, if the history holds at least one sample
+				 */
+				bool mostRecentSamples(SampleRef& previousSample, SampleRef& latestSample) const;
+
+				/**
+				 * Determines the two samples enclosing a timestamp.
+				 * The caller must ensure that removed samples are not released during the call, see ScopedSampleReader.
+				 * @param timestamp The timestamp for which the samples will be determined
+				 * @param lowerSample The resulting most recent sample with timestamp not after the given timestamp, invalid if no such sample exists
+				 * @param upperSample The resulting oldest sample with timestamp after the given timestamp, invalid if no such sample exists
+				 * @return True, if the history holds at least one sample
+				 */
+				bool enclosingSamples(const Timestamp& timestamp, SampleRef& lowerSample, SampleRef& upperSample) const;
+
+				/**
+				 * Returns the capacity of this history.
+				 * @return The maximal number of samples, with range [1, infinity)
+				 */
+				inline size_t capacity() const;
+
+			protected:
+
+				/**
+				 * Returns the slot of a sample.
+				 * @param firstIndex The index of the slot holding the oldest sample
+				 * @param index The index of the sample, with 0 for the oldest sample
+				 * @return The slot of the sample
+				 */
+				inline std::atomic<const SampleRef*>& slot(const size_t firstIndex, const size_t index) const;
+
+				/**
+				 * Disabled copy constructor.
+				 */
+				SampleHistory(const SampleHistory&) = delete;
+
+				/**
+				 * Disabled copy operator.
+				 * @return Reference to this object
+				 */
+				SampleHistory& operator=(const SampleHistory&) = delete;
+
+			protected:
+
+				/// The slots of this history, each slot holds a pointer to a sample reference or nullptr.
+				std::unique_ptr<std::atomic<const SampleRef*>[]> slots_;
+
+				/// The capacity of this history.
+				size_t capacity_ = 0;
+
+				/// The index of the slot holding the oldest sample.
+				std::atomic<size_t> firstIndex_ = 0;
+
+				/// The number of samples in this history.
+				std::atomic<size_t> size_ = 0;
+
+				/// The sequence counter of this history, odd while the writer modifies the history.
+				std::atomic<unsigned int> sequence_ = 0u;
+		};
+
+		/**
+		 * This class allows to read the sample history of a measurement, removed samples are not released during the lifetime of the reader (epoch-based reclamation).
 		 */
-		using SampleMap = std::map<Timestamp, SampleRef>;
+		class ScopedSampleReader
+		{
+			public:
+
+				/**
+				 * Creates a new reader and enters the current epoch of the measurement.
+				 * @param measurement The measurement whose history will be read
+				 */
+				explicit ScopedSampleReader(const Measurement& measurement);
+
+				/**
+				 * Destructs the reader and leaves the epoch.
+				 */
+				inline ~ScopedSampleReader();
+
+				/**
+				 * Returns the sample history of the measurement.
+				 * @return The measurement's history
+				 */
+				inline const SampleHistory& history() const;
+
+			protected:
+
+				/// The measurement whose history is read.
+				const Measurement& measurement_;
+
+				/// The epoch the reader has entered.
+				unsigned int epoch_ = 0u;
+
+				/// The history of the measurement.
+				const SampleHistory* history_ = nullptr;
+		};
+
+		/**
+		 * This class implements the thread invoking sample events asynchronously.
+		 * The thread posting samples adds the samples to a ring buffer without any lock.
+		 */
+		class SampleEventDispatcher : public Thread
+		{
+			public:
+
+				/**
+				 * Creates a new dispatcher and starts the dispatch thread.
+				 * @param measurement The measurement owning the dispatcher
+				 * @param capacity The maximal number of samples which can wait for the dispatch, with range [1, infinity)
+				 */
+				SampleEventDispatcher(Measurement& measurement, const size_t capacity);
+
+				/**
+				 * Destructs the dispatcher, all waiting samples are dispatched before the thread stops.
+				 */
+				~SampleEventDispatcher() override;
+
+				/**
+				 * Adds a new sample to be dispatched.
+				 * This function must be called by one posting thread at a time only.
+				 * @param sample The sample to dispatch, must be valid
+				 * @return True, if succeeded; False, if too many samples are waiting already
+				 */
+				bool post(const SampleRef& sample);
+
+			protected:
+
+				/**
+				 * Invokes the event callbacks for all waiting samples.
+				 */
+				void dispatchSamples();
+
+				/**
+				 * The thread's run function.
+				 */
+				void threadRun() override;
+
+			protected:
+
+				/// The measurement owning the dispatcher.
+				Measurement& measurement_;
+
+				/// The samples of this dispatcher.
+				std::vector<SampleRef> samples_;
+
+				/// The overall number of samples which have been posted.
+				std::atomic<size_t> numberPostedSamples_ = 0;
+
+				/// The overall number of samples which have been dispatched.
+				std::atomic<size_t> numberDispatchedSamples_ = 0;
+
+				/// The signal waking up the dispatch thread.
+				Signal signal_;
+
+				/// The maximal time in milliseconds the dispatch thread waits for a new sample.
+				static constexpr unsigned int waitTime_ = 100u;
+		};
 
 		/**
 		 * This class implements a helper class to simplify the mapping between internal object ids (of the actual tracking implementation) and extern object ids (of the device system).
@@ -396,6 +608,24 @@ class OCEAN_DEVICES_EXPORT Measurement : virtual public Device
 		 */
 		virtual SampleRef sample(const Timestamp& timestamp, const InterpolationStrategy interpolationStrategy) const;
 
+		/**
+		 * Enables or disables the asynchronous invocation of sample events.
+		 * While enabled, the thread posting a sample does not invoke the event callbacks but hands the sample over to a dedicated dispatch thread without any lock.<br>
+		 * Samples which cannot be handed over because too many samples are waiting already are not dispatched, see droppedSampleEvents().<br>
+		 * Do not call this function from inside an event callback.
+		 * @param state True, to invoke sample events asynchronously; False, to invoke sample events by the posting thread
+		 * @param queueCapacity The maximal number of samples waiting for the dispatch, with range [1, infinity)
+		 * @return True, if succeeded
+		 */
+		bool setAsynchronousSampleEvents(const bool state, const size_t queueCapacity = 64);
+
+		/**
+		 * Returns the number of samples whose events have not been dispatched because too many samples were waiting.
+		 * @return The overall number of dropped sample events
+		 * @see setAsynchronousSampleEvents().
+		 */
+		inline uint64_t droppedSampleEvents() const;
+
 		/**
 		 * Subscribes a callback event function for new measurement sample events.
 		 * Do not subscribe or unsubscribe from inside an event thread.
@@ -465,6 +695,20 @@ class OCEAN_DEVICES_EXPORT Measurement : virtual public Device
 		 */
 		void unsubscribeSampleEvent(const SubscriptionId subscriptionId);
 
+		/**
+		 * Invokes all sample event callbacks for a sample.
+		 * @param sample The sample for which the events will be invoked, must be valid
+		 */
+		void invokeSampleEvents(const SampleRef& sample);
+
+		/**
+		 * Keeps samples and histories which have been removed and releases all objects which cannot be accessed by readers anymore.
+		 * The samples lock must be locked.
+		 * @param removedSamples The samples which have been removed from the history, will be moved
+		 * @param removedHistory The history which has been replaced, nullptr if no history has been replaced
+		 */
+		void retireSamples(SampleRefPointers& removedSamples, SampleHistory* removedHistory = nullptr);
+
 		/**
 		 * Interpolates between two samples.
 		 * This function can be overridden by derived classes to provide type-specific interpolation.
@@ -477,9 +721,17 @@ class OCEAN_DEVICES_EXPORT Measurement : virtual public Device
 		 */
 		virtual SampleRef interpolateSamples(const SampleRef& lowerSample, const SampleRef& upperSample, const double interpolationFactor, const Timestamp& interpolatedTimestamp) const;
 
+		/**
+		 * Returns the two most recent samples of this measurement, e.g., to extrapolate the measurement.
+		 * @param previousSample The resulting sample before the most recent sample, invalid if the measurement holds less than two samples
+		 * @param latestSample The resulting most recent sample, invalid if the measurement does not hold any sample
+		 * @return True, if the measurement holds at least one sample
+		 */
+		bool mostRecentSamples(SampleRef& previousSample, SampleRef& latestSample) const;
+
 	protected:
 
-		/// Sample lock.
+		/// Sample lock, serializing threads which modify the sample history, threads reading samples do not use the lock.
 		mutable Lock samplesLock_;
 
 		/// Subscription lock.
@@ -487,12 +739,30 @@ class OCEAN_DEVICES_EXPORT Measurement : virtual public Device
 
 	private:
 
-		/// The most recent measurement samples.
-		SampleMap sampleMap_;
-
 		/// The maximal number of samples this measurement object can hold.
 		size_t sampleCapacity_ = 200;
 
+		/// The history holding the most recent measurement samples.
+		std::atomic<SampleHistory*> sampleHistory_;
+
+		/// The current epoch of the sample history, increased whenever all readers have left the previous epoch.
+		mutable std::atomic<unsigned int> sampleEpoch_ = 0u;
+
+		/// The number of readers in even and odd epochs.
+		mutable std::atomic<unsigned int> sampleEpochReaders_[2] = {0u, 0u};
+
+		/// The samples which have been removed from the history during even and odd epochs.
+		SampleRefPointers retiredSamples_[2];
+
+		/// The histories which have been replaced during even and odd epochs.
+		std::vector<std::unique_ptr<SampleHistory>> retiredSampleHistories_[2];
+
+		/// The dispatcher invoking sample events asynchronously, nullptr if sample events are invoked by the posting thread.
+		std::unique_ptr<SampleEventDispatcher> sampleEventDispatcher_;
+
+		/// The overall number of sample events which have been dropped by the dispatcher.
+		std::atomic<uint64_t> droppedSampleEvents_ = 0u;
+
 		/// Map holding all sample event subscriptions.
 		SampleSubscriptionMap sampleSubscriptionMap_;
 
@@ -621,6 +891,29 @@ inline Measurement::SampleEventSubscription::operator bool() const
 	return weakMeasurement_ != nullptr;
 }
 
+inline size_t Measurement::SampleHistory::capacity() const
+{
+	return capacity_;
+}
+
+inline std::atomic<const Measurement::SampleRef*>& Measurement::SampleHistory::slot(const size_t firstIndex, const size_t index) const
+{
+	ocean_assert(capacity_ != 0);
+
+	return slots_[(firstIndex + index) % capacity_];
+}
+
+inline Measurement::ScopedSampleReader::~ScopedSampleReader()
+{
+	measurement_.sampleEpochReaders_[epoch_ & 1u].fetch_sub(1u, std::memory_order_release);
+}
+
+inline const Measurement::SampleHistory& Measurement::ScopedSampleReader::history() const
+{
+	ocean_assert(history_ != nullptr);
+	return *history_;
+}
+
 inline size_t Measurement::sampleCapacity() const
 {
 	const ScopedLock scopedLock(samplesLock_);
@@ -628,6 +921,11 @@ inline size_t Measurement::sampleCapacity() const
 	return sampleCapacity_;
 }
 
+inline uint64_t Measurement::droppedSampleEvents() const
+{
+	return droppedSampleEvents_.load(std::memory_order_relaxed);
+}
+
 constexpr Measurement::ObjectId Measurement::invalidObjectId()
 {
 	return ObjectId(-1);
@@ -210,6 +210,158 @@ SceneTracker6DOF::SceneElementRoom::VolumetricRoomObject::VolumetricType SceneTr
 	return VT_UNKNOWN;
 }
 
+bool SceneTracker6DOF::SceneElementDepth::convertDepth(const Frame& depth, const float depthFactor, Frame& floatDepth, Frames* depthLayers, const unsigned int layers)
+{
+	ocean_assert(depth.isValid());
+	ocean_assert(depthFactor > 0.0f);
+
+	const bool isY16 = depth.isPixelFormatCompatible(FrameType::FORMAT_Y16);
+
+	if (!isY16 && !depth.isPixelFormatCompatible(FrameType::FORMAT_F32))
+	{
+		ocean_assert(false && "Invalid pixel format!");
+		return false;
+	}
+
+	ocean_assert(&depth != &floatDepth);
+
+	if (!floatDepth.set(FrameType(depth, FrameType::FORMAT_F32), false /*forceOwner*/, true /*forceWritable*/))
+	{
+		return false;
+	}
+
+	Frame firstLayer;
+
+	if (depthLayers != nullptr)
+	{
+		depthLayers->clear();
+
+		if (layers >= 1u && depth.width() >= 2u && depth.height() >= 2u)
+		{
+			firstLayer = Frame(FrameType(depth.width() / 2u, depth.height() / 2u, FrameType::FORMAT_F32, depth.pixelOrigin()));
+		}
+	}
+
+	for (unsigned int y = 0u; y < depth.height(); ++y)
+	{
+		float* const targetRow = floatDepth.row<float>(y);
+
+		if (isY16)
+		{
+			const uint16_t* const sourceRow = depth.constrow<uint16_t>(y);
+
+			for (unsigned int x = 0u; x < depth.width(); ++x)
+			{
+				targetRow[x] = float(sourceRow[x]) * depthFactor;
+			}
+		}
+		else
+		{
+			const float* const sourceRow = depth.constrow<float>(y);
+
+			for (unsigned int x = 0u; x < depth.width(); ++x)
+			{
+				targetRow[x] = sourceRow[x] * depthFactor;
+			}
+		}
+
+		// the coarser row is determined while both converted rows are still in the cache
+
+		if (firstLayer.isValid() && (y % 2u) == 1u && y / 2u < firstLayer.height())
+		{
+			downsampleDepthRow(floatDepth.constrow<float>(y - 1u), targetRow, firstLayer.row<float>(y / 2u), firstLayer.width());
+		}
+	}
+
+	floatDepth.setTimestamp(depth.timestamp());
+
+	if (firstLayer.isValid())
+	{
+		ocean_assert(depthLayers != nullptr);
+
+		firstLayer.setTimestamp(depth.timestamp());
+
+		Frames coarserLayers;
+		if (layers >= 2u && !createDepthLayers(firstLayer, layers - 1u, coarserLayers))
+		{
+			return false;
+		}
+
+		depthLayers->reserve(coarserLayers.size() + 1);
+		depthLayers->emplace_back(std::move(firstLayer));
+
+		for (Frame& coarserLayer : coarserLayers)
+		{
+			depthLayers->emplace_back(std::move(coarserLayer));
+		}
+	}
+
+	return true;
+}
+
+bool SceneTracker6DOF::SceneElementDepth::createDepthLayers(const Frame& floatDepth, const unsigned int layers, Frames& depthLayers)
+{
+	ocean_assert(floatDepth.isValid() && layers >= 1u);
+
+	if (!floatDepth.isPixelFormatCompatible(FrameType::FORMAT_F32))
+	{
+		ocean_assert(false && "Invalid pixel format!");
+		return false;
+	}
+
+	depthLayers.clear();
+	depthLayers.reserve(layers);
+
+	const Frame* sourceLayer = &floatDepth;
+
+	for (unsigned int n = 0u; n < layers; ++n)
+	{
+		if (sourceLayer->width() < 2u || sourceLayer->height() < 2u)
+		{
+			break;
+		}
+
+		Frame targetLayer(FrameType(sourceLayer->width() / 2u, sourceLayer->height() / 2u, FrameType::FORMAT_F32, sourceLayer->pixelOrigin()));
+
+		for (unsigned int y = 0u; y < targetLayer.height(); ++y)
+		{
+			downsampleDepthRow(sourceLayer->constrow<float>(y * 2u + 0u), sourceLayer->constrow<float>(y * 2u + 1u), targetLayer.row<float>(y), targetLayer.width());
+		}
+
+		targetLayer.setTimestamp(floatDepth.timestamp());
+
+		depthLayers.emplace_back(std::move(targetLayer));
+		sourceLayer = &depthLayers.back();
+	}
+
+	return true;
+}
+
+void SceneTracker6DOF::SceneElementDepth::downsampleDepthRow(const float* sourceRow0, const float* sourceRow1, float* targetRow, const unsigned int targetWidth)
+{
+	ocean_assert(sourceRow0 != nullptr && sourceRow1 != nullptr && targetRow != nullptr);
+	ocean_assert(targetWidth >= 1u);
+
+	for (unsigned int x = 0u; x < targetWidth; ++x)
+	{
+		const float values[4] = {sourceRow0[x * 2u + 0u], sourceRow0[x * 2u + 1u], sourceRow1[x * 2u + 0u], sourceRow1[x * 2u + 1u]};
+
+		// the closest valid depth is used (conservative for occlusion handling), invalid depth values (zero) are ignored
+
+		float minDepth = NumericF::maxValue();
+
+		for (const float value : values)
+		{
+			if (value > 0.0f && value < minDepth)
+			{
+				minDepth = value;
+			}
+		}
+
+		targetRow[x] = minDepth != NumericF::maxValue() ? minDepth : 0.0f;
+	}
+}
+
 SceneTracker6DOF::SceneTracker6DOFSample::SceneTracker6DOFSample(const Timestamp& timestamp, const ReferenceSystem referenceSystem, const ObjectIds& objectIds, const Orientations& orientations, const Positions& positions, const SharedSceneElements& sceneElements, const Metadata& metadata) :
 	Sample(timestamp, objectIds, metadata),
 	TrackerSample(timestamp, referenceSystem, objectIds, metadata),
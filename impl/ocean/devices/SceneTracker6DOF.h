@@ -486,8 +486,10 @@ class OCEAN_DEVICES_EXPORT SceneTracker6DOF : virtual public Tracker6DOF
 
 		/**
 		 * This class implements a scene element holding depth information.
+		 * The depth image can be an own copy or can wrap the memory of the platform's depth buffer directly, in the latter case the platform buffer is kept alive as long as the depth image exists.<br>
+		 * Optionally, the scene element holds coarser layers of the depth image so that consumers do not need to downsample the depth on their own.
 		 */
-		class SceneElementDepth : public SceneElement
+		class OCEAN_DEVICES_EXPORT SceneElementDepth : public SceneElement
 		{
 			public:
 
@@ -497,8 +499,9 @@ class OCEAN_DEVICES_EXPORT SceneTracker6DOF : virtual public Tracker6DOF
 				 * @param device_T_depth The transformation between depth image and device, must be valid
 				 * @param depth The depth image, must be valid
 				 * @param confidence The confidence map, one entry for each pixel in the depth image, nullptr if unknown
+				 * @param depthLayers The optional coarser layers of the depth image, each layer with half the resolution of the previous layer, the first layer with half the resolution of the depth image
 				 */
-				inline SceneElementDepth(SharedAnyCamera camera, const HomogenousMatrix4& device_T_depth, std::shared_ptr<Frame> depth, std::shared_ptr<Frame> confidence = nullptr);
+				inline SceneElementDepth(SharedAnyCamera camera, const HomogenousMatrix4& device_T_depth, std::shared_ptr<Frame> depth, std::shared_ptr<Frame> confidence = nullptr, Frames depthLayers = Frames());
 
 				/**
 				 * Returns the camera profile of the depth image.
@@ -519,6 +522,45 @@ class OCEAN_DEVICES_EXPORT SceneTracker6DOF : virtual public Tracker6DOF
 				 */
 				inline std::shared_ptr<Frame> depth(std::shared_ptr<Frame>* confidence = nullptr) const;
 
+				/**
+				 * Returns the coarser layers of the depth image, each with pixel format FORMAT_F32 and depth in meter.
+				 * The first layer has half the resolution of the depth image, each further layer has half the resolution of the previous layer.
+				 * @return The depth layers, empty if the tracker has not been configured to provide depth layers
+				 */
+				inline const Frames& depthLayers() const;
+
+				/**
+				 * Converts a depth image to a float depth image in meter and creates coarser depth layers in the same pass.
+				 * The coarser layers are determined while the rows of the float depth image are still in the cache, a coarser depth value is the minimal valid (positive) depth value of the corresponding 2x2 block.
+				 * @param depth The depth image to convert, with pixel format FORMAT_Y16 (e.g., depth in millimeter) or FORMAT_F32, must be valid
+				 * @param depthFactor The factor converting the depth values to meter, e.g., 0.001 for depth in millimeter, with range (0, infinity)
+				 * @param floatDepth The resulting float depth image with pixel format FORMAT_F32
+				 * @param depthLayers Optional resulting coarser depth layers, nullptr if not of interest
+				 * @param layers The number of coarser layers to create, the number of resulting layers may be lower if the depth image is too small, with range [0, infinity)
+				 * @return True, if succeeded
+				 */
+				static bool convertDepth(const Frame& depth, const float depthFactor, Frame& floatDepth, Frames* depthLayers = nullptr, const unsigned int layers = 0u);
+
+				/**
+				 * Creates coarser layers of a float depth image.
+				 * @param floatDepth The float depth image with pixel format FORMAT_F32, must be valid
+				 * @param layers The number of coarser layers to create, the number of resulting layers may be lower if the depth image is too small, with range [1, infinity)
+				 * @param depthLayers The resulting coarser depth layers
+				 * @return True, if succeeded
+				 */
+				static bool createDepthLayers(const Frame& floatDepth, const unsigned int layers, Frames& depthLayers);
+
+			protected:
+
+				/**
+				 * Downsamples one row pair of a float depth image by a factor of two, using the minimal valid depth value of each 2x2 block.
+				 * @param sourceRow0 The upper source row, must be valid
+				 * @param sourceRow1 The lower source row, must be valid
+				 * @param targetRow The target row receiving the coarser depth values, must be valid
+				 * @param targetWidth The width of the target row, with range [1, infinity)
+				 */
+				static void downsampleDepthRow(const float* sourceRow0, const float* sourceRow1, float* targetRow, const unsigned int targetWidth);
+
 			protected:
 
 				/// The camera profile defining the projection of the depth image.
@@ -532,6 +574,9 @@ class OCEAN_DEVICES_EXPORT SceneTracker6DOF : virtual public Tracker6DOF
 
 				/// The scene element's confidence map, one entry for each pixel in the depth image, if known.
 				std::shared_ptr<Frame> confidence_;
+
+				/// The coarser layers of the depth image, if any.
+				Frames depthLayers_;
 		};
 
 		/**
@@ -1302,12 +1347,13 @@ inline const SceneTracker6DOF::SceneElementRoom::RoomObjectIdentifierSet& SceneT
 	return updatedRoomObjects_;
 }
 
-inline SceneTracker6DOF::SceneElementDepth::SceneElementDepth(SharedAnyCamera camera, const HomogenousMatrix4& device_T_depth, std::shared_ptr<Frame> depth, std::shared_ptr<Frame> confidence) :
+inline SceneTracker6DOF::SceneElementDepth::SceneElementDepth(SharedAnyCamera camera, const HomogenousMatrix4& device_T_depth, std::shared_ptr<Frame> depth, std::shared_ptr<Frame> confidence, Frames depthLayers) :
 	SceneElement(SET_DEPTH),
 	camera_(std::move(camera)),
 	device_T_depth_(device_T_depth),
 	depth_(std::move(depth)),
-	confidence_(std::move(confidence))
+	confidence_(std::move(confidence)),
+	depthLayers_(std::move(depthLayers))
 {
 	ocean_assert(camera_ && depth_ && device_T_depth_.isValid());
 }
@@ -1335,6 +1381,11 @@ inline std::shared_ptr<Frame> SceneTracker6DOF::SceneElementDepth::depth(std::sh
 	return depth_;
 }
 
+inline const Frames& SceneTracker6DOF::SceneElementDepth::depthLayers() const
+{
+	return depthLayers_;
+}
+
 inline const SceneTracker6DOF::SharedSceneElements& SceneTracker6DOF::SceneTracker6DOFSample::sceneElements() const
 {
 	return sceneElements_;
@@ -8,6 +8,9 @@
 #include "ocean/devices/Tracker6DOF.h"
 
 #include "ocean/math/Interpolation.h"
+#include "ocean/math/Rotation.h"
+
+#include <algorithm>
 
 namespace Ocean
 {
@@ -48,6 +51,115 @@ Tracker6DOF::~Tracker6DOF()
 	// nothing to do here
 }
 
+Measurement::SampleRef Tracker6DOF::predictedSample(const Timestamp& timestamp, const GyroSensor3DOFRef& gyroSensor, const double maximalPredictionInterval) const
+{
+	ocean_assert(timestamp.isValid());
+	ocean_assert(maximalPredictionInterval >= 0.0);
+
+	SampleRef previousSample;
+	SampleRef latestSample;
+
+	if (!mostRecentSamples(previousSample, latestSample))
+	{
+		return SampleRef();
+	}
+
+	ocean_assert(latestSample);
+
+	if (timestamp <= latestSample->timestamp())
+	{
+		return sample(timestamp, IS_TIMESTAMP_INTERPOLATE);
+	}
+
+	const Tracker6DOFSampleRef latest6DOFSample(latestSample);
+	const Tracker6DOFSampleRef previous6DOFSample(previousSample);
+
+	ocean_assert(latest6DOFSample);
+	ocean_assert(latest6DOFSample->orientations().size() == latest6DOFSample->positions().size());
+
+	const double predictionInterval = std::min(double(timestamp - latest6DOFSample->timestamp()), std::max(0.0, maximalPredictionInterval));
+
+	// the velocities can be determined from the previous sample only if both samples measure the same objects
+
+	double sampleInterval = 0.0;
+
+	if (previous6DOFSample && previous6DOFSample->referenceSystem() == latest6DOFSample->referenceSystem() && previous6DOFSample->objectIds().size() == latest6DOFSample->objectIds().size() && previous6DOFSample->positions().size() == latest6DOFSample->positions().size() && previous6DOFSample->orientations().size() == latest6DOFSample->orientations().size())
+	{
+		sampleInterval = double(latest6DOFSample->timestamp() - previous6DOFSample->timestamp());
+
+		for (size_t n = 0; sampleInterval > 0.0 && n < latest6DOFSample->objectIds().size(); ++n)
+		{
+			if (previous6DOFSample->objectIds()[n] != latest6DOFSample->objectIds()[n])
+			{
+				sampleInterval = 0.0;
+			}
+		}
+	}
+
+	const bool hasVelocity = sampleInterval > NumericD::eps();
+	const Scalar velocityFactor = hasVelocity ? Scalar(predictionInterval / sampleInterval) : Scalar(0);
+
+	// the gyro sensor measures the rotation of the device in the coordinate system of the device, stale measurements are not used
+
+	Quaternion device_Q_predictedDevice(false);
+
+	if (gyroSensor)
+	{
+		const GyroSensor3DOF::Gyro3DOFSampleRef gyroSample(gyroSensor->sample());
+
+		if (gyroSample && !gyroSample->measurements().isEmpty() && NumericD::abs(double(latest6DOFSample->timestamp() - gyroSample->timestamp())) <= std::max(maximalPredictionInterval, sampleInterval))
+		{
+			const Vector3& angularVelocity = gyroSample->measurements().front();
+			const Scalar angularSpeed = angularVelocity.length();
+
+			if (Numeric::isNotEqualEps(angularSpeed))
+			{
+				device_Q_predictedDevice = Quaternion(angularVelocity / angularSpeed, angularSpeed * Scalar(predictionInterval));
+			}
+			else
+			{
+				device_Q_predictedDevice = Quaternion(true);
+			}
+		}
+	}
+
+	const bool deviceInObject = latest6DOFSample->referenceSystem() == RS_DEVICE_IN_OBJECT;
+
+	Tracker6DOFSample::Orientations predictedOrientations(latest6DOFSample->orientations().size());
+	Tracker6DOFSample::Positions predictedPositions(latest6DOFSample->positions().size());
+
+	for (size_t n = 0; n < latest6DOFSample->orientations().size(); ++n)
+	{
+		const Quaternion& latestOrientation = latest6DOFSample->orientations()[n];
+		const Vector3& latestPosition = latest6DOFSample->positions()[n];
+
+		predictedPositions[n] = hasVelocity ? latestPosition + (latestPosition - previous6DOFSample->positions()[n]) * velocityFactor : latestPosition;
+
+		Quaternion latestDevice_Q_predictedDevice(true);
+
+		if (device_Q_predictedDevice.isValid())
+		{
+			latestDevice_Q_predictedDevice = device_Q_predictedDevice;
+		}
+		else if (hasVelocity)
+		{
+			const Quaternion& previousOrientation = previous6DOFSample->orientations()[n];
+
+			// the rotation of the device between both samples, in the coordinate system of the device
+
+			const Quaternion previousDevice_Q_latestDevice = deviceInObject ? previousOrientation.inverted() * latestOrientation : previousOrientation * latestOrientation.inverted();
+
+			latestDevice_Q_predictedDevice = scaledRotation(previousDevice_Q_latestDevice, velocityFactor);
+		}
+
+		// object_Q_predictedDevice = object_Q_latestDevice * latestDevice_Q_predictedDevice, or predictedDevice_Q_object = predictedDevice_Q_latestDevice * latestDevice_Q_object
+
+		predictedOrientations[n] = deviceInObject ? (latestOrientation * latestDevice_Q_predictedDevice).normalized() : (latestDevice_Q_predictedDevice.inverted() * latestOrientation).normalized();
+	}
+
+	return Tracker6DOFSampleRef(new Tracker6DOFSample(timestamp, latest6DOFSample->referenceSystem(), latest6DOFSample->objectIds(), predictedOrientations, predictedPositions));
+}
+
 Measurement::SampleRef Tracker6DOF::interpolateSamples(const SampleRef& lowerSample, const SampleRef& upperSample, const double interpolationFactor, const Timestamp& interpolatedTimestamp) const
 {
 	ocean_assert(lowerSample && upperSample);
@@ -74,6 +186,24 @@ Measurement::SampleRef Tracker6DOF::interpolateSamples(const SampleRef& lowerSam
 	return Tracker6DOFSampleRef(new Tracker6DOFSample(interpolatedTimestamp, lower6DOFSample->referenceSystem(), lower6DOFSample->objectIds(), interpolatedOrientations, interpolatedPositions));
 }
 
+Quaternion Tracker6DOF::scaledRotation(const Quaternion& rotation, const Scalar factor)
+{
+	ocean_assert(rotation.isValid());
+
+	const Rotation axisAngle(rotation);
+
+	// the rotation angle is in the range [0, 2PI), the shorter arc has the opposite direction for angles larger than PI
+
+	Scalar angle = axisAngle.angle();
+
+	if (angle > Numeric::pi())
+	{
+		angle -= Numeric::pi2();
+	}
+
+	return Quaternion(axisAngle.axis(), angle * factor);
+}
+
 }
 
 }
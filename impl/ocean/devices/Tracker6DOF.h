@@ -10,6 +10,7 @@
 
 #include "ocean/devices/Devices.h"
 #include "ocean/devices/DeviceRef.h"
+#include "ocean/devices/GyroSensor3DOF.h"
 #include "ocean/devices/OrientationTracker3DOF.h"
 #include "ocean/devices/PositionTracker3DOF.h"
 
@@ -78,6 +79,19 @@ class OCEAN_DEVICES_EXPORT Tracker6DOF :
 
 	public:
 
+		/**
+		 * Returns a sample predicted for a timestamp after the most recent sample, e.g., for the expected display time of a frame which is about to be rendered.
+		 * The positions and orientations are extrapolated from the two most recent samples with constant linear and angular velocity.<br>
+		 * The angular velocity can be taken from a gyro sensor instead, the gyro sensor must measure the rotation of the tracked device in the coordinate system of the device.<br>
+		 * Timestamps which are not after the most recent sample do not need a prediction, the interpolated sample is returned instead.
+		 * @param timestamp The timestamp for which the sample will be predicted, must be valid
+		 * @param gyroSensor Optional gyro sensor attached to the tracked device, invalid to use the angular velocity of the samples only
+		 * @param maximalPredictionInterval The maximal interval for which the samples are extrapolated, in seconds, timestamps further in the future are predicted for this interval, with range [0, infinity)
+		 * @return The predicted sample with the given timestamp, invalid if the tracker does not hold any sample
+		 * @see sample().
+		 */
+		SampleRef predictedSample(const Timestamp& timestamp, const GyroSensor3DOFRef& gyroSensor = GyroSensor3DOFRef(), const double maximalPredictionInterval = 0.1) const;
+
 		/**
 		 * Definition of this device type.
 		 */
@@ -101,6 +115,14 @@ class OCEAN_DEVICES_EXPORT Tracker6DOF :
 		 * @see Measurement::interpolateSamples().
 		 */
 		SampleRef interpolateSamples(const SampleRef& lowerSample, const SampleRef& upperSample, const double interpolationFactor, const Timestamp& interpolatedTimestamp) const override;
+
+		/**
+		 * Returns a fraction of a rotation around the same axis.
+		 * @param rotation The rotation for which the fraction will be determined, must be valid
+		 * @param factor The fraction of the rotation's angle, with range (-infinity, infinity)
+		 * @return The resulting rotation, rotating along the shorter arc of the given rotation
+		 */
+		static Quaternion scaledRotation(const Quaternion& rotation, const Scalar factor);
 };
 
 inline Tracker6DOF::DeviceType Tracker6DOF::deviceTypeTracker6DOF()
@@ -49,11 +49,57 @@ ACDepthTracker6DOF::~ACDepthTracker6DOF()
 	}
 }
 
-void ACDepthTracker6DOF::onNewSample(const HomogenousMatrix4& world_T_camera, Frame&& depth, SharedAnyCamera&& depthCamera, const HomogenousMatrix4& device_T_depth, const Timestamp& timestamp)
+bool ACDepthTracker6DOF::setParameter(const std::string& parameter, const Value& value)
+{
+	const ScopedLock scopedLock(deviceLock);
+
+	if (parameter == "zeroCopyDepth" && value.isBool())
+	{
+		zeroCopyDepth_ = value.boolValue();
+		return true;
+	}
+
+	if (parameter == "depthLayers" && value.isInt() && value.intValue() >= 0)
+	{
+		depthLayers_ = (unsigned int)(value.intValue());
+		return true;
+	}
+
+	return ACDevice::setParameter(parameter, value);
+}
+
+bool ACDepthTracker6DOF::parameter(const std::string& parameter, Value& value)
+{
+	const ScopedLock scopedLock(deviceLock);
+
+	if (parameter == "zeroCopyDepth")
+	{
+		value = Value(zeroCopyDepth_);
+		return true;
+	}
+
+	if (parameter == "depthLayers")
+	{
+		value = Value(int(depthLayers_));
+		return true;
+	}
+
+	return ACDevice::parameter(parameter, value);
+}
+
+void ACDepthTracker6DOF::depthDelivery(bool& zeroCopyDepth, unsigned int& depthLayers) const
+{
+	const ScopedLock scopedLock(deviceLock);
+
+	zeroCopyDepth = zeroCopyDepth_;
+	depthLayers = depthLayers_;
+}
+
+void ACDepthTracker6DOF::onNewSample(const HomogenousMatrix4& world_T_camera, std::shared_ptr<Frame>&& depth, Frames&& depthLayers, SharedAnyCamera&& depthCamera, const HomogenousMatrix4& device_T_depth, const Timestamp& timestamp)
 {
 	ocean_assert(world_T_camera.isValid());
-	ocean_assert(depth && depthCamera);
-	ocean_assert(depth.width() == depthCamera->width() && depth.height() == depthCamera->height());
+	ocean_assert(depth && depth->isValid() && depthCamera);
+	ocean_assert(depth->width() == depthCamera->width() && depth->height() == depthCamera->height());
 	ocean_assert(device_T_depth.isValid());
 	ocean_assert(timestamp.isValid());
 
@@ -79,7 +125,7 @@ void ACDepthTracker6DOF::onNewSample(const HomogenousMatrix4& world_T_camera, Fr
 
 		SharedSceneElements sceneElements =
 		{
-			std::make_shared<SceneElementDepth>(std::move(depthCamera), device_T_depth, std::make_shared<Frame>(std::move(depth)))
+			std::make_shared<SceneElementDepth>(std::move(depthCamera), device_T_depth, std::move(depth), nullptr, std::move(depthLayers))
 		};
 
 		postFoundTrackerObjects(foundObjectIds, timestamp);
@@ -24,6 +24,12 @@ namespace ARCore
 
 /*
  * This class implements the 6DOF depth tracker.
+ * By default, the tracker provides a copy of the depth image with pixel format FORMAT_F32 and depth in meter.<br>
+ * The tracker supports the following parameters:
+ * <pre>
+ * "zeroCopyDepth" (bool): True, to provide the depth image of ARCore without copying (FORMAT_Y16, depth in millimeter), the ARCore image is released together with the sample
+ * "depthLayers" (int): The number of coarser depth layers each sample will provide, determined together with the float conversion, 0 by default
+ * </pre>
  * @ingroup devicesarcore
  */
 class OCEAN_DEVICES_ARCORE_EXPORT ACDepthTracker6DOF final :
@@ -47,6 +53,18 @@ class OCEAN_DEVICES_ARCORE_EXPORT ACDepthTracker6DOF final :
 		 */
 		static inline DeviceType deviceTypeACDepthTracker6DOF();
 
+		/**
+		 * Sets an abstract parameter of this device.
+		 * @see Device::setParameter().
+		 */
+		bool setParameter(const std::string& parameter, const Value& value) override;
+
+		/**
+		 * Returns an abstract parameter of this device.
+		 * @see Device::parameter().
+		 */
+		bool parameter(const std::string& parameter, Value& value) override;
+
 	protected:
 
 		/**
@@ -63,11 +81,27 @@ class OCEAN_DEVICES_ARCORE_EXPORT ACDepthTracker6DOF final :
 		 * Event function for new 6DOF transformations.
 		 * @param world_T_camera The transformation between camera and world, invalid if unknown/lost
 		 * @param depth The depth frame, must be valid
+		 * @param depthLayers The coarser layers of the depth frame, empty if not requested
 		 * @param depthCamera The depth camera defining the projection of the depth frame, must be valid
 		 * @param device_T_depth The transformation between depth image and device, must be valid
 		 * @param timestamp The timestamp of the new transformation
 		 */
-		void onNewSample(const HomogenousMatrix4& world_T_camera, Frame&& depth, SharedAnyCamera&& depthCamera, const HomogenousMatrix4& device_T_depth, const Timestamp& timestamp);
+		void onNewSample(const HomogenousMatrix4& world_T_camera, std::shared_ptr<Frame>&& depth, Frames&& depthLayers, SharedAnyCamera&& depthCamera, const HomogenousMatrix4& device_T_depth, const Timestamp& timestamp);
+
+		/**
+		 * Returns the configuration of the depth delivery.
+		 * @param zeroCopyDepth True, if the depth image of ARCore is provided without copying
+		 * @param depthLayers The number of coarser depth layers to provide, with range [0, infinity)
+		 */
+		void depthDelivery(bool& zeroCopyDepth, unsigned int& depthLayers) const;
+
+	protected:
+
+		/// True, to provide the depth image of ARCore without copying.
+		bool zeroCopyDepth_ = false;
+
+		/// The number of coarser depth layers to provide.
+		unsigned int depthLayers_ = 0u;
 };
 
 inline std::string ACDepthTracker6DOF::deviceNameACDepthTracker6DOF()
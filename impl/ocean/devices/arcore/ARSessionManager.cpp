@@ -507,20 +507,30 @@ void ARSessionManager::Session::update(unsigned int textureId)
 				}
 				else if (tracker->name() == ACDepthTracker6DOF::deviceNameACDepthTracker6DOF())
 				{
-					Frame depth = extractDepth(arSession_, arFrame);
+					ACDepthTracker6DOF* depthTracker = dynamic_cast<ACDepthTracker6DOF*>(tracker);
+					ocean_assert(depthTracker != nullptr);
 
-					if (depth.isValid())
+					bool zeroCopyDepth = false;
+					unsigned int depthLayers = 0u;
+					depthTracker->depthDelivery(zeroCopyDepth, depthLayers);
+
+					Frames coarserDepthLayers;
+					std::shared_ptr<Frame> depth = extractDepth(arSession_, arFrame, zeroCopyDepth, depthLayers, coarserDepthLayers);
+
+					if (depth)
 					{
-						depth.setTimestamp(frameUnixTimestamp);
+						depth->setTimestamp(frameUnixTimestamp);
 
-						SharedAnyCamera depthCamera = anyCamera->clone(depth.width(), depth.height());
+						for (Frame& coarserDepthLayer : coarserDepthLayers)
+						{
+							coarserDepthLayer.setTimestamp(frameUnixTimestamp);
+						}
+
+						SharedAnyCamera depthCamera = anyCamera->clone(depth->width(), depth->height());
 
 						if (depthCamera)
 						{
-							ACDepthTracker6DOF* depthTracker = dynamic_cast<ACDepthTracker6DOF*>(tracker);
-							ocean_assert(depthTracker != nullptr);
-
-							depthTracker->onNewSample(world_T_camera, std::move(depth), std::move(depthCamera), HomogenousMatrix4(frameMedium_->device_T_camera()), frameUnixTimestamp);
+							depthTracker->onNewSample(world_T_camera, std::move(depth), std::move(coarserDepthLayers), std::move(depthCamera), HomogenousMatrix4(frameMedium_->device_T_camera()), frameUnixTimestamp);
 						}
 						else
 						{
@@ -1076,21 +1086,23 @@ Frame ARSessionManager::extractImage(ArSession* arSession, ArFrame* arFrame, Med
 	return frame;
 }
 
-Frame ARSessionManager::extractDepth(const ArSession* arSession, const ArFrame* arFrame)
+std::shared_ptr<Frame> ARSessionManager::extractDepth(const ArSession* arSession, const ArFrame* arFrame, const bool zeroCopy, const unsigned int layers, Frames& depthLayers)
 {
 	ocean_assert(arSession != nullptr);
 	ocean_assert(arFrame != nullptr);
 
+	depthLayers.clear();
+
 	ScopedARImage arImage;
 	if (ArFrame_acquireDepthImage(arSession, arFrame, arImage.ingest()) != AR_SUCCESS)
 	{
-		return Frame();
+		return nullptr;
 	}
 
 	ArImageFormat arImageFormat = AR_IMAGE_FORMAT_INVALID;
 	ArImage_getFormat(arSession, arImage, &arImageFormat);
 
-	Frame depthFrame;
+	std::shared_ptr<Frame> depthFrame;
 
 	if (arImageFormat == AR_IMAGE_FORMAT_DEPTH16)
 	{
@@ -1117,47 +1129,66 @@ Frame ARSessionManager::extractDepth(const ArSession* arSession, const ArFrame*
 			if (planePixelStride != 2)
 			{
 				ocean_assert(false && "Invalid pixel stride");
-				return Frame();
+				return nullptr;
 			}
 
 			unsigned int paddingElements = 0u;
 			if (!Frame::strideBytes2paddingElements(FrameType::FORMAT_Y16, (unsigned int)(width), (unsigned int)(planeDataRowStride), paddingElements))
 			{
 				ocean_assert(false && "Invalid stride");
-				return Frame();
+				return nullptr;
 			}
 
 			if (size_t(data) % 2 != 0)
 			{
 				ocean_assert(false && "Invalid data alignment");
-				return Frame();
+				return nullptr;
 			}
 
-			const uint16_t* yDepth = (const uint16_t*)(data);
+			int64_t timestampNs = NumericT<int64_t>::minValue();
+			ArImage_getTimestamp(arSession, arImage, &timestampNs);
 
-			const Frame yDepthFrame(FrameType((unsigned int)(width), (unsigned int)(height), FrameType::FORMAT_Y16, FrameType::ORIGIN_UPPER_LEFT), yDepth, Frame::CM_USE_KEEP_LAYOUT, paddingElements);
+			const Timestamp timestamp(double(timestampNs) * 0.000000001);
 
-			// now, converting the depth information from integer with millimeter precision to float (in meter precision)
+			const uint16_t* yDepth = (const uint16_t*)(data);
 
-			depthFrame = Frame(FrameType(yDepthFrame, FrameType::FORMAT_F32));
+			const FrameType yDepthFrameType((unsigned int)(width), (unsigned int)(height), FrameType::FORMAT_Y16, FrameType::ORIGIN_UPPER_LEFT);
 
-			for (unsigned int y = 0u; y < yDepthFrame.height(); ++y)
+			if (zeroCopy)
 			{
-				const uint16_t* const sourceRow = yDepthFrame.constrow<uint16_t>(y);
-				float* const targetRow = depthFrame.row<float>(y);
+				// the frame wraps the memory of the ARCore image, the image is released once the last owner of the frame is gone
+
+				std::shared_ptr<ScopedARImage> sharedARImage = std::make_shared<ScopedARImage>(std::move(arImage));
 
-				for (unsigned int x = 0u; x < yDepthFrame.width(); ++x)
+				depthFrame = std::shared_ptr<Frame>(new Frame(yDepthFrameType, yDepth, Frame::CM_USE_KEEP_LAYOUT, paddingElements, timestamp), [sharedARImage](Frame* frame)
 				{
-					targetRow[x] = float(sourceRow[x]) * float(0.001f);
+					delete frame;
+				});
+
+				if (layers != 0u)
+				{
+					// the coarser layers are float layers and need a float version of the depth image
+
+					Frame floatDepthFrame;
+					if (!SceneTracker6DOF::SceneElementDepth::convertDepth(*depthFrame, 0.001f, floatDepthFrame, &depthLayers, layers))
+					{
+						return nullptr;
+					}
 				}
 			}
+			else
+			{
+				const Frame yDepthFrame(yDepthFrameType, yDepth, Frame::CM_USE_KEEP_LAYOUT, paddingElements, timestamp);
 
-			int64_t timestampNs = NumericT<int64_t>::minValue();
-			ArImage_getTimestamp(arSession, arImage, &timestampNs);
+				// converting the depth information from integer with millimeter precision to float (in meter precision), the coarser layers are determined in the same pass
 
-			const Timestamp timestamp(double(timestampNs) * 0.000000001);
+				depthFrame = std::make_shared<Frame>();
 
-			depthFrame.setTimestamp(timestamp);
+				if (!SceneTracker6DOF::SceneElementDepth::convertDepth(yDepthFrame, 0.001f, *depthFrame, &depthLayers, layers))
+				{
+					return nullptr;
+				}
+			}
 		}
 	}
 	else
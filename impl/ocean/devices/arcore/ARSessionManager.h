@@ -250,9 +250,12 @@ class OCEAN_DEVICES_ARCORE_EXPORT ARSessionManager : public Singleton<ARSessionM
 		 * Extracts the depth from an ArFrame.
 		 * @param arSession The AR session to which the AR frame belongs, must be valid
 		 * @param arFrame The AR frame from which the depth will be extracted, must be valid
-		 * @return The extracted depth, invalid in case of a failure
+		 * @param zeroCopy True, to wrap the memory of the ARCore depth image (FORMAT_Y16, depth in millimeter) which is released together with the resulting frame; False, to convert the depth to a float image in meter
+		 * @param layers The number of coarser depth layers to create, with range [0, infinity)
+		 * @param depthLayers The resulting coarser depth layers, empty if no layers were requested
+		 * @return The extracted depth, nullptr in case of a failure
 		 */
-		static Frame extractDepth(const ArSession* arSession, const ArFrame* arFrame);
+		static std::shared_ptr<Frame> extractDepth(const ArSession* arSession, const ArFrame* arFrame, const bool zeroCopy, const unsigned int layers, Frames& depthLayers);
 
 		/**
 		 * Extracts the camera pose and camera profile from an ArFrame.
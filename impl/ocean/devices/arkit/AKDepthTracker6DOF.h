@@ -25,6 +25,12 @@ namespace ARKit
 
 /**
  * This class implements the 6DOF tracker also delivering depth images.
+ * By default, the tracker provides a copy of the depth image and the confidence map.<br>
+ * The tracker supports the following parameters in addition to the parameters of AKDevice:
+ * <pre>
+ * "zeroCopyDepth" (bool): True, to provide the depth image and confidence map of ARKit without copying, the pixel buffers are released together with the sample
+ * "depthLayers" (int): The number of coarser depth layers each sample will provide, determined together with the copy of the depth image, 0 by default
+ * </pre>
  * @ingroup devicesarkit
  */
 class OCEAN_DEVICES_ARKIT_EXPORT AKDepthTracker6DOF :
@@ -66,6 +72,18 @@ class OCEAN_DEVICES_ARKIT_EXPORT AKDepthTracker6DOF :
 		 */
 		bool isObjectTracked(const ObjectId& objectId) const override;
 
+		/**
+		 * Sets an abstract parameter of this device.
+		 * @see AKDevice::setParameter().
+		 */
+		bool setParameter(const std::string& parameter, const Value& value) override;
+
+		/**
+		 * Returns an abstract parameter of this device.
+		 * @see AKDevice::parameter().
+		 */
+		bool parameter(const std::string& parameter, Value& value) override;
+
 		/**
 		 * Event function for a new 6DOF pose.
 		 * @param world_T_camera The transformation between camera and world, invalid if unknown/lost
@@ -101,6 +119,14 @@ class OCEAN_DEVICES_ARKIT_EXPORT AKDepthTracker6DOF :
 		 */
 		~AKDepthTracker6DOF() override;
 
+		/**
+		 * Wraps the memory of a pixel buffer with a frame without copying the memory.
+		 * The pixel buffer is retained and locked as long as the resulting frame exists.
+		 * @param pixelBuffer The pixel buffer to wrap, must be valid
+		 * @return The resulting frame, nullptr if the pixel buffer could not be accessed
+		 */
+		static std::shared_ptr<Frame> wrapPixelBuffer(CVPixelBufferRef pixelBuffer);
+
 	protected:
 
 		/// The unique id for the world object.
@@ -111,6 +137,12 @@ class OCEAN_DEVICES_ARKIT_EXPORT AKDepthTracker6DOF :
 
 		/// True, if the world object is currently tracked.
 		bool worldIsTracked_ = false;
+
+		/// True, to provide the depth image and confidence map of ARKit without copying.
+		bool zeroCopyDepth_ = false;
+
+		/// The number of coarser depth layers to provide.
+		unsigned int depthLayers_ = 0u;
 };
 
 inline std::string AKDepthTracker6DOF::deviceNameAKDepthTracker6DOF()
@@ -146,6 +146,44 @@ void AKDepthTracker6DOF::setInput(Media::FrameMediumRefs&& frameMediums)
 	ocean_assert(false && "Invalid frameMedium!");
 }
 
+bool AKDepthTracker6DOF::setParameter(const std::string& parameter, const Value& value)
+{
+	const ScopedLock scopedLock(deviceLock);
+
+	if (parameter == "zeroCopyDepth" && value.isBool())
+	{
+		zeroCopyDepth_ = value.boolValue();
+		return true;
+	}
+
+	if (parameter == "depthLayers" && value.isInt() && value.intValue() >= 0)
+	{
+		depthLayers_ = (unsigned int)(value.intValue());
+		return true;
+	}
+
+	return AKDevice::setParameter(parameter, value);
+}
+
+bool AKDepthTracker6DOF::parameter(const std::string& parameter, Value& value)
+{
+	const ScopedLock scopedLock(deviceLock);
+
+	if (parameter == "zeroCopyDepth")
+	{
+		value = Value(zeroCopyDepth_);
+		return true;
+	}
+
+	if (parameter == "depthLayers")
+	{
+		value = Value(int(depthLayers_));
+		return true;
+	}
+
+	return AKDevice::parameter(parameter, value);
+}
+
 void AKDepthTracker6DOF::onNewSample(const HomogenousMatrix4& world_T_camera, const Timestamp& timestamp, const SharedAnyCamera& camera, const HomogenousMatrix4& device_T_depth, ARFrame* arFrame)
 {
 	ocean_assert(camera);
@@ -154,46 +192,93 @@ void AKDepthTracker6DOF::onNewSample(const HomogenousMatrix4& world_T_camera, co
 	SharedSceneElements sceneElements;
 	sceneElements.reserve(2);
 
+	TemporaryScopedLock scopedLock(deviceLock);
+
+	const bool zeroCopyDepth = zeroCopyDepth_;
+	const unsigned int depthLayers = depthLayers_;
+
+	scopedLock.release();
+
 	if (@available(iOS 14.0, *))
 	{
 		if (arFrame.sceneDepth != nullptr)
 		{
-			const Media::AVFoundation::PixelBufferAccessor depthPixelBufferAccessor(arFrame.sceneDepth.depthMap, true /*readonly*/);
+			std::shared_ptr<Frame> depth;
+			std::shared_ptr<Frame> confidence;
+			Frames coarserDepthLayers;
 
-			if (depthPixelBufferAccessor)
+			if (zeroCopyDepth)
 			{
-				const Frame& depthFrame = depthPixelBufferAccessor.frame();
+				depth = wrapPixelBuffer(arFrame.sceneDepth.depthMap);
 
-				std::shared_ptr<Frame> depth = std::make_shared<Frame>(depthFrame, Frame::ACM_COPY_REMOVE_PADDING_LAYOUT);
-				depth->setTimestamp(timestamp);
+				if (depth)
+				{
+					if (depthLayers != 0u && !SceneElementDepth::createDepthLayers(*depth, depthLayers, coarserDepthLayers))
+					{
+						Log::warning() << "Failed to create the depth layers";
+					}
 
-				SharedAnyCamera depthCamera = camera;
+					if (arFrame.sceneDepth.confidenceMap != nullptr)
+					{
+						confidence = wrapPixelBuffer(arFrame.sceneDepth.confidenceMap);
+					}
+				}
+			}
+			else
+			{
+				const Media::AVFoundation::PixelBufferAccessor depthPixelBufferAccessor(arFrame.sceneDepth.depthMap, true /*readonly*/);
 
-				if (depthCamera->width() != depthFrame.width() || depthCamera->height() != depthFrame.height())
+				if (depthPixelBufferAccessor)
 				{
-					depthCamera = depthCamera->clone(depthFrame.width(), depthFrame.height());
-					if (!depthCamera)
+					// the depth image is copied and the coarser layers are determined in the same pass
+
+					depth = std::make_shared<Frame>();
+
+					if (!SceneElementDepth::convertDepth(depthPixelBufferAccessor.frame(), 1.0f, *depth, &coarserDepthLayers, depthLayers))
 					{
-						Log::warning() << "Depth image has wrong image resolution!";
+						depth = nullptr;
 					}
 				}
 
-				std::shared_ptr<Frame> confidence;
-
-				if (arFrame.sceneDepth.confidenceMap != nullptr)
+				if (depth && arFrame.sceneDepth.confidenceMap != nullptr)
 				{
 					const Media::AVFoundation::PixelBufferAccessor confidencePixelBufferAccessor(arFrame.sceneDepth.confidenceMap, true /*readonly*/);
 
 					if (confidencePixelBufferAccessor)
 					{
 						confidence = std::make_shared<Frame>(confidencePixelBufferAccessor.frame(), Frame::ACM_COPY_REMOVE_PADDING_LAYOUT);
-						confidence->setTimestamp(timestamp);
+					}
+				}
+			}
+
+			if (depth)
+			{
+				depth->setTimestamp(timestamp);
+
+				if (confidence)
+				{
+					confidence->setTimestamp(timestamp);
+				}
+
+				for (Frame& coarserDepthLayer : coarserDepthLayers)
+				{
+					coarserDepthLayer.setTimestamp(timestamp);
+				}
+
+				SharedAnyCamera depthCamera = camera;
+
+				if (depthCamera->width() != depth->width() || depthCamera->height() != depth->height())
+				{
+					depthCamera = depthCamera->clone(depth->width(), depth->height());
+					if (!depthCamera)
+					{
+						Log::warning() << "Depth image has wrong image resolution!";
 					}
 				}
 
 				if (depthCamera != nullptr)
 				{
-					sceneElements.emplace_back(std::make_shared<SceneElementDepth>(std::move(depthCamera), device_T_depth, std::move(depth), std::move(confidence)));
+					sceneElements.emplace_back(std::make_shared<SceneElementDepth>(std::move(depthCamera), device_T_depth, std::move(depth), std::move(confidence), std::move(coarserDepthLayers)));
 				}
 			}
 		}
@@ -204,7 +289,7 @@ void AKDepthTracker6DOF::onNewSample(const HomogenousMatrix4& world_T_camera, co
 		sceneElements.emplace_back(nullptr); // adding a pure 6-DOF pose scene element
 	}
 
-	TemporaryScopedLock scopedLock(deviceLock);
+	scopedLock.relock(deviceLock);
 
 	if (world_T_camera.isValid())
 	{
@@ -244,6 +329,30 @@ void AKDepthTracker6DOF::onNewSample(const HomogenousMatrix4& world_T_camera, co
 	}
 }
 
+std::shared_ptr<Frame> AKDepthTracker6DOF::wrapPixelBuffer(CVPixelBufferRef pixelBuffer)
+{
+	ocean_assert(pixelBuffer != nullptr);
+
+	std::shared_ptr<Media::AVFoundation::PixelBufferAccessor> pixelBufferAccessor = std::make_shared<Media::AVFoundation::PixelBufferAccessor>(pixelBuffer, true /*readOnly*/);
+
+	if (!*pixelBufferAccessor)
+	{
+		return nullptr;
+	}
+
+	// the pixel buffer is retained and stays locked until the last owner of the frame is gone
+
+	CVPixelBufferRetain(pixelBuffer);
+
+	return std::shared_ptr<Frame>(new Frame(pixelBufferAccessor->frame(), Frame::ACM_USE_KEEP_LAYOUT), [pixelBufferAccessor, pixelBuffer](Frame* frame)
+	{
+		delete frame;
+
+		pixelBufferAccessor->release();
+		CVPixelBufferRelease(pixelBuffer);
+	});
+}
+
 }
 
 }
@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#ifndef META_OCEAN_DEVICES_MAPBUILDING_FRAME_BUDGET_H
+#define META_OCEAN_DEVICES_MAPBUILDING_FRAME_BUDGET_H
+
+#include "ocean/devices/mapbuilding/MapBuilding.h"
+
+namespace Ocean
+{
+
+namespace Devices
+{
+
+namespace MapBuilding
+{
+
+/**
+ * This class implements a token bucket distributing a CPU budget over a sequence of frames.
+ * Each frame adds its budget to the balance, the balance is capped so that a sequence of cheap frames cannot be followed by a burst of expensive frames.<br>
+ * A frame is processed only if the balance is positive, the processing time is subtracted afterwards so that an expensive frame is paid back by skipping the following frames.<br>
+ * Without a budget, all frames are processed.
+ * @ingroup devicesmapbuilding
+ */
+class FrameBudget
+{
+	public:
+
+		/**
+		 * Creates a new frame budget.
+		 * @param budgetPerFrame The budget for each frame, in seconds, with range [0, infinity), 0 for an unbounded budget
+		 * @param maximalAccumulatedBudgets The maximal number of frame budgets which can be accumulated while frames are cheaper than their budget, with range [1, infinity)
+		 */
+		inline explicit FrameBudget(const double budgetPerFrame = 0.0, const double maximalAccumulatedBudgets = 3.0);
+
+		/**
+		 * Adds the budget of a new frame to the balance and returns whether the frame can be processed.
+		 * @return True, if the frame can be processed; False, if the frame must be skipped as previous frames have exceeded their budget
+		 */
+		inline bool startFrame();
+
+		/**
+		 * Subtracts the processing time of a processed frame from the balance.
+		 * @param processingDuration The processing time of the frame, in seconds, with range [0, infinity)
+		 */
+		inline void finishFrame(const double processingDuration);
+
+		/**
+		 * Returns the current balance.
+		 * @return The balance in seconds, negative if previous frames have exceeded their budget
+		 */
+		inline double balance() const;
+
+		/**
+		 * Returns the budget for each frame.
+		 * @return The budget in seconds, 0 for an unbounded budget
+		 */
+		inline double budgetPerFrame() const;
+
+		/**
+		 * Returns whether this object holds a budget.
+		 * @return True, if so
+		 */
+		inline bool isBudgeted() const;
+
+	protected:
+
+		/// The budget for each frame, in seconds, 0 for an unbounded budget.
+		double budgetPerFrame_ = 0.0;
+
+		/// The maximal balance, in seconds.
+		double maximalBalance_ = 0.0;
+
+		/// The current balance, in seconds.
+		double balance_ = 0.0;
+};
+
+inline FrameBudget::FrameBudget(const double budgetPerFrame, const double maximalAccumulatedBudgets) :
+	budgetPerFrame_(budgetPerFrame),
+	maximalBalance_(budgetPerFrame * maximalAccumulatedBudgets)
+{
+	ocean_assert(budgetPerFrame >= 0.0);
+	ocean_assert(maximalAccumulatedBudgets >= 1.0);
+}
+
+inline bool FrameBudget::startFrame()
+{
+	if (!isBudgeted())
+	{
+		return true;
+	}
+
+	balance_ = std::min(balance_ + budgetPerFrame_, maximalBalance_);
+
+	return balance_ > 0.0;
+}
+
+inline void FrameBudget::finishFrame(const double processingDuration)
+{
+	ocean_assert(processingDuration >= 0.0);
+
+	if (isBudgeted())
+	{
+		balance_ -= processingDuration;
+	}
+}
+
+inline double FrameBudget::balance() const
+{
+	return balance_;
+}
+
+inline double FrameBudget::budgetPerFrame() const
+{
+	return budgetPerFrame_;
+}
+
+inline bool FrameBudget::isBudgeted() const
+{
+	return budgetPerFrame_ > 0.0;
+}
+
+}
+
+}
+
+}
+
+#endif // META_OCEAN_DEVICES_MAPBUILDING_FRAME_BUDGET_H
@@ -6,6 +6,7 @@
  */
 
 #include "ocean/devices/mapbuilding/OnDeviceMapCreatorTracker6DOF.h"
+#include "ocean/devices/mapbuilding/FrameBudget.h"
 
 #include "ocean/base/HighPerformanceTimer.h"
 #include "ocean/base/ScopedValue.h"
@@ -125,6 +126,10 @@ bool OnDeviceMapCreatorTracker6DOF::start()
 
 	worldTracker_->start();
 
+	TemporaryScopedLock temporaryBudgetLock(budgetLock_);
+		budgetStatistics_ = BudgetStatistics();
+	temporaryBudgetLock.release();
+
 	startThread();
 
 	Log::info() << "6DOF On-Device Relocalizer tracker started.";
@@ -143,6 +148,53 @@ bool OnDeviceMapCreatorTracker6DOF::stop()
 	return true;
 }
 
+bool OnDeviceMapCreatorTracker6DOF::setParameter(const std::string& parameter, const Value& value)
+{
+	if (parameter != "cpuBudgetPerFrame" || !value.isFloat64(true /*allowIntAndFloat*/))
+	{
+		return false;
+	}
+
+	const double cpuBudgetPerFrame = value.float64Value(true /*allowIntAndFloat*/);
+
+	if (cpuBudgetPerFrame < 0.0)
+	{
+		return false;
+	}
+
+	const ScopedLock scopedLock(deviceLock);
+
+	if (isThreadActive())
+	{
+		Log::warning() << "OnDeviceMapCreatorTracker6DOF: The CPU budget cannot be changed while the tracker is running";
+		return false;
+	}
+
+	cpuBudgetPerFrame_ = cpuBudgetPerFrame * 0.001;
+
+	return true;
+}
+
+bool OnDeviceMapCreatorTracker6DOF::parameter(const std::string& parameter, Value& value)
+{
+	if (parameter == "cpuBudgetPerFrame")
+	{
+		const ScopedLock scopedLock(deviceLock);
+
+		value = Value(cpuBudgetPerFrame_ * 1000.0);
+		return true;
+	}
+
+	return false;
+}
+
+OnDeviceMapCreatorTracker6DOF::BudgetStatistics OnDeviceMapCreatorTracker6DOF::budgetStatistics() const
+{
+	const ScopedLock scopedLock(budgetLock_);
+
+	return budgetStatistics_;
+}
+
 bool OnDeviceMapCreatorTracker6DOF::isObjectTracked(const ObjectId& objectId) const
 {
 	const ScopedLock scopedLock(deviceLock);
@@ -251,11 +303,29 @@ void OnDeviceMapCreatorTracker6DOF::threadRun()
 		}
 
 		const Media::FrameMediumRef frameMedium = frameMediums_.front();
+
+		const double cpuBudgetPerFrame = cpuBudgetPerFrame_;
 	temporaryScopedLock.release();
 
 	ocean_assert(mapObjectId_ != invalidObjectId());
 	ocean_assert(isMapTracked_ == false);
 
+	const bool isBudgeted = cpuBudgetPerFrame > 0.0;
+
+	if (isBudgeted)
+	{
+		// the map is built with background priority on efficiency cores, so that neither rendering nor tracking threads are preempted by the map building
+
+		if (!setThreadPriorityClass(PC_BACKGROUND, CA_EFFICIENCY_CORES))
+		{
+			Log::debug() << "OnDeviceMapCreatorTracker6DOF: Failed to apply the background priority class";
+		}
+	}
+
+	FrameBudget frameBudget(cpuBudgetPerFrame, maximalAccumulatedBudgets_);
+
+	HighPerformanceTimer budgetTimer;
+
 	Tracking::MapBuilding::PatchTracker patchTracker(std::make_shared<Tracking::MapBuilding::UnifiedDescriptorExtractorFreakMultiDescriptor256>(), Tracking::MapBuilding::PatchTracker::Options::realtimeOptions());
 
 	HighPerformanceStatistic performance;
@@ -308,12 +378,36 @@ void OnDeviceMapCreatorTracker6DOF::threadRun()
 
 			const ScopedValueT<Index32> scopedLastProcessedFrameIndex(lastProcessedFrameIndex, frameIndex);
 
+			if (!frameBudget.startFrame())
+			{
+				// the previous frames have exceeded their budget, the frame is skipped until the budget is paid back
+
+				const ScopedLock scopedLock(budgetLock_);
+
+				++budgetStatistics_.skippedFrames_;
+				budgetStatistics_.budgetDuration_ += cpuBudgetPerFrame;
+
+				continue;
+			}
+
 			if (performance.measurements() >= 100u)
 			{
-				Log::info() << "Performance: " << performance.averageMseconds() << "ms";
+				if (isBudgeted)
+				{
+					const BudgetStatistics statistics = budgetStatistics();
+
+					Log::info() << "Performance: " << performance.averageMseconds() << "ms, budget usage: " << String::toAString(statistics.budgetUsage() * 100.0, 1u) << "%, skipped frames: " << statistics.skippedFrames_ << " of " << statistics.processedFrames_ + statistics.skippedFrames_;
+				}
+				else
+				{
+					Log::info() << "Performance: " << performance.averageMseconds() << "ms";
+				}
+
 				performance.reset();
 			}
 
+			budgetTimer.start();
+
 			HomogenousMatrix4 world_T_camera(sample->positions().front(), sample->orientations().front());
 
 			if (sample->referenceSystem() == Devices::Tracker6DOF::RS_OBJECT_IN_DEVICE)
@@ -321,8 +415,10 @@ void OnDeviceMapCreatorTracker6DOF::threadRun()
 				world_T_camera.invert();
 			}
 
+			const WorkerPool::ScopedWorker scopedWorker(isBudgeted ? WorkerPool::get().scopedWorker(PC_BACKGROUND) : WorkerPool::get().scopedWorker());
+
 			Frame yFrame;
-			if (!CV::FrameConverter::Comfort::convert(*frame, FrameType::FORMAT_Y8, yFrame, CV::FrameConverter::CP_AVOID_COPY_IF_POSSIBLE, WorkerPool::get().scopedWorker()()))
+			if (!CV::FrameConverter::Comfort::convert(*frame, FrameType::FORMAT_Y8, yFrame, CV::FrameConverter::CP_AVOID_COPY_IF_POSSIBLE, scopedWorker()))
 			{
 				ocean_assert(false && "This should never happen!");
 				break;
@@ -351,11 +447,11 @@ void OnDeviceMapCreatorTracker6DOF::threadRun()
 				yCurrentFramePyramid = std::make_shared<CV::FramePyramid>();
 			}
 
-			yCurrentFramePyramid->replace8BitPerChannel11(yFrame.constdata<uint8_t>(), yFrame.width(), yFrame.height(), yFrame.channels(), yFrame.pixelOrigin(), pyramidLayers, yFrame.paddingElements(), true /*copyFirstLayer*/, WorkerPool::get().scopedWorker()(), yFrame.pixelFormat(), yFrame.timestamp());
+			yCurrentFramePyramid->replace8BitPerChannel11(yFrame.constdata<uint8_t>(), yFrame.width(), yFrame.height(), yFrame.channels(), yFrame.pixelOrigin(), pyramidLayers, yFrame.paddingElements(), true /*copyFirstLayer*/, scopedWorker(), yFrame.pixelFormat(), yFrame.timestamp());
 
 			const HighPerformanceStatistic::ScopedStatistic scopedPerformance(performance);
 
-			patchTracker.trackFrame(frameIndex, *anyCamera, world_T_camera, yCurrentFramePyramid, yFrame.timestamp(), WorkerPool::get().scopedWorker()());
+			patchTracker.trackFrame(frameIndex, *anyCamera, world_T_camera, yCurrentFramePyramid, yFrame.timestamp(), scopedWorker());
 
 			lastAnyCamera = std::move(anyCamera);
 
@@ -369,6 +465,16 @@ void OnDeviceMapCreatorTracker6DOF::threadRun()
 				yCurrentFramePyramid = nullptr;
 			}
 
+			const double processingDuration = budgetTimer.seconds();
+
+			TemporaryScopedLock temporaryBudgetLock(budgetLock_);
+				++budgetStatistics_.processedFrames_;
+				budgetStatistics_.processingDuration_ += processingDuration;
+				budgetStatistics_.budgetDuration_ += cpuBudgetPerFrame;
+			temporaryBudgetLock.release();
+
+			frameBudget.finishFrame(processingDuration);
+
 			constexpr double sceneElementInterval = 0.5;
 
 			if (frame->timestamp() >= lastSceneElementTimestamp + sceneElementInterval)
@@ -33,6 +33,10 @@ namespace MapBuilding
 
 /**
  * This class implements an On-Device map creator.
+ * The map is built in a background thread processing the frames of the input medium.<br>
+ * By default, each frame is processed with the default thread priority, which may compete with rendering or other latency-critical threads.<br>
+ * Optionally, a CPU budget per frame can be defined via the parameter 'cpuBudgetPerFrame' (in milliseconds).<br>
+ * With a budget, the map is built with background priority on efficiency cores, and frames are skipped as long as the processing of previous frames has exceeded the budget.
  * @ingroup devicesmapbuilding
  */
 class OCEAN_DEVICES_MAPBUILDING_EXPORT OnDeviceMapCreatorTracker6DOF :
@@ -43,6 +47,36 @@ class OCEAN_DEVICES_MAPBUILDING_EXPORT OnDeviceMapCreatorTracker6DOF :
 {
 	friend class MapBuildingFactory;
 
+	public:
+
+		/**
+		 * This class holds the statistics of the budgeted map building.
+		 */
+		class BudgetStatistics
+		{
+			public:
+
+				/**
+				 * Returns the ratio between the used processing time and the available budget.
+				 * @return The budget usage, with range [0, infinity), 0 if no budget has been available
+				 */
+				inline double budgetUsage() const;
+
+			public:
+
+				/// The number of frames which have been processed.
+				unsigned int processedFrames_ = 0u;
+
+				/// The number of frames which have been skipped as the budget was exhausted.
+				unsigned int skippedFrames_ = 0u;
+
+				/// The processing time of all processed frames, in seconds.
+				double processingDuration_ = 0.0;
+
+				/// The budget of all processed and skipped frames, in seconds, 0 if no budget was defined.
+				double budgetDuration_ = 0.0;
+		};
+
 	public:
 
 		/**
@@ -63,6 +97,25 @@ class OCEAN_DEVICES_MAPBUILDING_EXPORT OnDeviceMapCreatorTracker6DOF :
 		 */
 		bool stop() override;
 
+		/**
+		 * Sets an abstract parameter of this device.
+		 * Supported parameters: 'cpuBudgetPerFrame' (the CPU budget for each frame in milliseconds, with range [0, infinity), 0 for an unbounded budget)
+		 * @see Device::setParameter().
+		 */
+		bool setParameter(const std::string& parameter, const Value& value) override;
+
+		/**
+		 * Returns an abstract parameter of this device.
+		 * @see Device::parameter().
+		 */
+		bool parameter(const std::string& parameter, Value& value) override;
+
+		/**
+		 * Returns the statistics of the budgeted map building since the tracker has been started.
+		 * @return The budget statistics
+		 */
+		BudgetStatistics budgetStatistics() const;
+
 		/**
 		 * Returns whether a specific object is currently actively tracked by this tracker.
 		 * @see Tracker::isObjectTracked().
@@ -116,6 +169,9 @@ class OCEAN_DEVICES_MAPBUILDING_EXPORT OnDeviceMapCreatorTracker6DOF :
 
 	private:
 
+		/// The maximal number of frame budgets which can be accumulated while frames are cheaper than their budget.
+		static constexpr double maximalAccumulatedBudgets_ = 3.0;
+
 		/// The object tracking id of the map.
 		ObjectId mapObjectId_ = invalidObjectId();
 
@@ -145,8 +201,29 @@ class OCEAN_DEVICES_MAPBUILDING_EXPORT OnDeviceMapCreatorTracker6DOF :
 
 		/// The lock for the recent points.
 		Lock pointLock_;
+
+		/// The CPU budget for each frame, in seconds, 0 for an unbounded budget.
+		double cpuBudgetPerFrame_ = 0.0;
+
+		/// The statistics of the budgeted map building.
+		BudgetStatistics budgetStatistics_;
+
+		/// The lock for the budget and the budget statistics.
+		mutable Lock budgetLock_;
 };
 
+inline double OnDeviceMapCreatorTracker6DOF::BudgetStatistics::budgetUsage() const
+{
+	ocean_assert(processingDuration_ >= 0.0 && budgetDuration_ >= 0.0);
+
+	if (budgetDuration_ <= 0.0)
+	{
+		return 0.0;
+	}
+
+	return processingDuration_ / budgetDuration_;
+}
+
 inline std::string OnDeviceMapCreatorTracker6DOF::deviceNameOnDeviceMapCreatorTracker6DOF()
 {
 	return std::string("On-Device Map Creator 6DOF Tracker");
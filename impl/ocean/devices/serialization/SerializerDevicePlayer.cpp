@@ -137,6 +137,12 @@ bool SerializerDevicePlayer::initialize(const std::string& filename)
 
 bool SerializerDevicePlayer::start(const float speed)
 {
+	if (speed < 0.0f && speed != SPEED_USE_CONSUMER_PACED)
+	{
+		ocean_assert(false && "Invalid speed!");
+		return false;
+	}
+
 	const ScopedLock scopedLock(lock_);
 
 	if (isStarted_)
@@ -157,7 +163,22 @@ bool SerializerDevicePlayer::start(const float speed)
 	isStarted_ = true;
 	speed_ = speed;
 
-	if (speed > 0.0f)
+	{
+		const ScopedLock statisticsScopedLock(statisticsLock_);
+
+		playbackStatistics_ = PlaybackStatistics();
+		playbackTimer_.start();
+	}
+
+	if (speed_ == SPEED_USE_CONSUMER_PACED)
+	{
+		// the first frame does not need to wait for the consumer
+
+		const std::lock_guard<std::mutex> lockGuard(consumerMutex_);
+		consumerReady_ = true;
+	}
+
+	if (speed_ != SPEED_USE_STOP_MOTION)
 	{
 		startThread();
 	}
@@ -181,6 +202,11 @@ bool SerializerDevicePlayer::stop()
 		inputSerializer_->stop();
 	}
 
+	if (isStarted_)
+	{
+		finishPlaybackStatistics();
+	}
+
 	isStarted_ = false;
 
 	return true;
@@ -190,12 +216,63 @@ Timestamp SerializerDevicePlayer::playNextFrame()
 {
 	const ScopedLock scopedLock(lock_);
 
-	if (!isStarted_ || speed_ > 0.0f || !inputSerializer_)
+	if (!isStarted_ || speed_ != SPEED_USE_STOP_MOTION || !inputSerializer_)
 	{
 		ocean_assert(false && "The player is not configured for stop-motion mode!");
 		return Timestamp(false);
 	}
 
+	const Timestamp frameTimestamp = playNextFrameInternal();
+
+	if (frameTimestamp.isInvalid() && isStarted_)
+	{
+		finishPlaybackStatistics();
+
+		isStarted_ = false;
+	}
+
+	return frameTimestamp;
+}
+
+bool SerializerDevicePlayer::frameConsumed()
+{
+	{
+		const ScopedLock scopedLock(lock_);
+
+		if (!isStarted_ || speed_ != SPEED_USE_CONSUMER_PACED)
+		{
+			return false;
+		}
+	}
+
+	{
+		const std::lock_guard<std::mutex> lockGuard(consumerMutex_);
+		consumerReady_ = true;
+	}
+
+	consumerCondition_.notify_one();
+
+	return true;
+}
+
+DevicePlayer::PlaybackStatistics SerializerDevicePlayer::playbackStatistics() const
+{
+	const ScopedLock scopedLock(statisticsLock_);
+
+	PlaybackStatistics playbackStatistics(playbackStatistics_);
+
+	if (isStarted_)
+	{
+		playbackStatistics.totalTime_ = playbackTimer_.seconds();
+	}
+
+	return playbackStatistics;
+}
+
+Timestamp SerializerDevicePlayer::playNextFrameInternal()
+{
+	ocean_assert(inputSerializer_);
+
 	if (firstMediaFrameChannelId_ == IO::Serialization::DataSerializer::invalidChannelId())
 	{
 		ocean_assert(false && "The player does not contain any media channel!");
@@ -219,21 +296,13 @@ Timestamp SerializerDevicePlayer::playNextFrame()
 		}
 		else
 		{
-			samplePair.second = inputSerializer_->sample(samplePair.first, 0.0 /*speed*/);
+			samplePair.second = nextSample(samplePair.first);
 		}
 
 		if (!samplePair.second)
 		{
-			if (inputSerializer_->hasFinished())
-			{
-				// we have reached the end of the serializer data
-				break;
-			}
-			else
-			{
-				Thread::sleep(1u);
-				continue;
-			}
+			// we have reached the end of the serializer data
+			break;
 		}
 
 		ocean_assert(samplePair.first != IO::Serialization::DataSerializer::invalidChannelId());
@@ -266,17 +335,46 @@ Timestamp SerializerDevicePlayer::playNextFrame()
 
 			processSample(samplePair.first, std::move(samplePair.second));
 
+			{
+				const ScopedLock statisticsScopedLock(statisticsLock_);
+				++playbackStatistics_.frames_;
+			}
+
 			return Timestamp(dataTimestamp.forceDouble());
 		}
 
 		processSample(samplePair.first, std::move(samplePair.second));
 	}
 
-	isStarted_ = false;
-
 	return Timestamp(false);
 }
 
+IO::Serialization::UniqueDataSample SerializerDevicePlayer::nextSample(IO::Serialization::DataSerializer::ChannelId& channelId)
+{
+	ocean_assert(inputSerializer_);
+
+	const HighPerformanceTimer timer;
+
+	IO::Serialization::UniqueDataSample sample;
+
+	while (true)
+	{
+		sample = inputSerializer_->sample(channelId, 0.0 /*speed*/);
+
+		if (sample || inputSerializer_->hasFinished())
+		{
+			break;
+		}
+
+		Thread::sleep(1u);
+	}
+
+	const ScopedLock statisticsScopedLock(statisticsLock_);
+	playbackStatistics_.readTime_ += timer.seconds();
+
+	return sample;
+}
+
 DevicePlayer::TransformationResult SerializerDevicePlayer::transformation(const std::string& /*name*/, const Timestamp& /*timestamp*/, HomogenousMatrixD4& /*matrix*/)
 {
 	const ScopedLock scopedLock(lock_);
@@ -832,6 +930,8 @@ void SerializerDevicePlayer::processSample(const IO::Serialization::DataSerializ
 {
 	ocean_assert(sample);
 
+	const HighPerformanceTimer timer;
+
 	const ChannelProcessorMap::const_iterator iChannelProcessor = channelProcessorMap_.find(channelId);
 
 	if (iChannelProcessor != channelProcessorMap_.cend())
@@ -851,6 +951,11 @@ void SerializerDevicePlayer::processSample(const IO::Serialization::DataSerializ
 			(this->*(iSampleProcessor->second))(channelId, std::move(sample));
 		}
 	}
+
+	const ScopedLock statisticsScopedLock(statisticsLock_);
+
+	playbackStatistics_.processTime_ += timer.seconds();
+	++playbackStatistics_.samples_;
 }
 
 void SerializerDevicePlayer::processLookaheadSamples(const IO::Serialization::DataTimestamp& dataTimestamp, const double maxPlaybackTimestamp)
@@ -896,20 +1001,12 @@ void SerializerDevicePlayer::processLookaheadSamples(const IO::Serialization::Da
 	while (true)
 	{
 		SamplePair samplePair;
-		samplePair.second = inputSerializer_->sample(samplePair.first, 0.0 /*speed*/);
+		samplePair.second = nextSample(samplePair.first);
 
 		if (!samplePair.second)
 		{
-			if (inputSerializer_->hasFinished())
-			{
-				// we have reached the end of the serializer data
-				return;
-			}
-			else
-			{
-				Thread::sleep(1u);
-				continue;
-			}
+			// we have reached the end of the serializer data
+			return;
 		}
 
 		if (samplePair.first != firstMediaFrameChannelId_)
@@ -1044,17 +1141,34 @@ SerializerDevicePlayer::DeviceRef SerializerDevicePlayer::ensureDevice(const IO:
 void SerializerDevicePlayer::threadRun()
 {
 	ocean_assert(inputSerializer_);
-	ocean_assert(speed_ > 0.0f);
+	ocean_assert(speed_ > 0.0f || speed_ == SPEED_USE_CONSUMER_PACED);
 
 	ocean_assert(isStarted_);
 
+	if (speed_ == SPEED_USE_CONSUMER_PACED)
+	{
+		threadRunConsumerPaced();
+
+		finishPlaybackStatistics();
+		isStarted_ = false;
+
+		return;
+	}
+
 	double lastPlaybackTimestamp = NumericD::minValue();
 
 	while (!shouldThreadStop())
 	{
 		IO::Serialization::DataSerializer::ChannelId channelId = IO::Serialization::DataSerializer::invalidChannelId();
+
+		const HighPerformanceTimer readTimer;
 		IO::Serialization::UniqueDataSample sample = inputSerializer_->sample(channelId, double(speed_));
 
+		{
+			const ScopedLock statisticsScopedLock(statisticsLock_);
+			playbackStatistics_.readTime_ += readTimer.seconds();
+		}
+
 		if (!sample)
 		{
 			if (inputSerializer_->hasFinished())
@@ -1075,12 +1189,66 @@ void SerializerDevicePlayer::threadRun()
 
 		lastPlaybackTimestamp = sample->playbackTimestamp();
 
+		const bool isFrame = channelId == firstMediaFrameChannelId_;
+
 		processSample(channelId, std::move(sample));
+
+		if (isFrame)
+		{
+			const ScopedLock statisticsScopedLock(statisticsLock_);
+			++playbackStatistics_.frames_;
+		}
 	}
 
+	finishPlaybackStatistics();
 	isStarted_ = false;
 }
 
+void SerializerDevicePlayer::threadRunConsumerPaced()
+{
+	ocean_assert(speed_ == SPEED_USE_CONSUMER_PACED);
+
+	while (!shouldThreadStop())
+	{
+		{
+			// we wait until the consumer is done with the previous frame
+
+			const HighPerformanceTimer consumerTimer;
+
+			std::unique_lock<std::mutex> uniqueLock(consumerMutex_);
+
+			while (!consumerReady_ && !shouldThreadStop())
+			{
+				consumerCondition_.wait_for(uniqueLock, std::chrono::milliseconds(1));
+			}
+
+			if (!consumerReady_)
+			{
+				// the player has been stopped
+				break;
+			}
+
+			consumerReady_ = false;
+
+			const ScopedLock statisticsScopedLock(statisticsLock_);
+			playbackStatistics_.consumerTime_ += consumerTimer.seconds();
+		}
+
+		if (playNextFrameInternal().isInvalid())
+		{
+			// we have reached the end of the recording
+			break;
+		}
+	}
+}
+
+void SerializerDevicePlayer::finishPlaybackStatistics()
+{
+	const ScopedLock statisticsScopedLock(statisticsLock_);
+
+	playbackStatistics_.totalTime_ = playbackTimer_.seconds();
+}
+
 Device* SerializerDevicePlayer::createOrientationTracker3DOF(const std::string& name, const Device::DeviceType& deviceType)
 {
 	ocean_assert_and_suppress_unused(deviceType == SerializationOrientationTracker3DOF::deviceTypeSerializationOrientationTracker3DOF(), deviceType);
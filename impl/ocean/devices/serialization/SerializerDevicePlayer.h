@@ -10,6 +10,7 @@
 
 #include "ocean/devices/serialization/Serialization.h"
 
+#include "ocean/base/HighPerformanceTimer.h"
 #include "ocean/base/Singleton.h"
 #include "ocean/base/Thread.h"
 
@@ -22,7 +23,9 @@
 
 #include "ocean/media/PixelImage.h"
 
+#include <condition_variable>
 #include <deque>
+#include <mutex>
 
 namespace Ocean
 {
@@ -178,8 +181,8 @@ class OCEAN_DEVICES_SERIALIZATION_EXPORT SerializerDevicePlayer :
 		/**
 		 * Starts the replay.
 		 * The recording can be played with individual speed, e.g., real-time, slower than real-time, faster than real-time.<br>
-		 * Further, the player supports a stop-motion mode in which the player will play one frame by another.
-		 * @param speed The speed at which the recording will be played, e.g., 2 means two times faster than normal, with range (0, infinity), 0 to play the recording in a stop-motion (frame by frame) mode
+		 * Further, the player supports a stop-motion mode in which the player will play one frame by another, and a consumer-paced mode in which the player plays one frame by another as soon as the consumer is done with the previous frame.
+		 * @param speed The speed at which the recording will be played, e.g., 2 means two times faster than normal, with range (0, infinity), 0 to play the recording in a stop-motion (frame by frame) mode, 'SPEED_USE_CONSUMER_PACED' to play the recording as fast as the consumer can handle the frames
 		 * @return True, if succeeded
 		 * @see duration(), playNextFrame();
 		 */
@@ -201,6 +204,18 @@ class OCEAN_DEVICES_SERIALIZATION_EXPORT SerializerDevicePlayer :
 		 */
 		Timestamp playNextFrame() override;
 
+		/**
+		 * Signals that the consumer is done with the most recent frame, the player must be started with consumer-paced mode.
+		 * @see DevicePlayer::frameConsumed().
+		 */
+		bool frameConsumed() override;
+
+		/**
+		 * Returns the timing statistics of the current (or most recent) replay.
+		 * @see DevicePlayer::playbackStatistics().
+		 */
+		PlaybackStatistics playbackStatistics() const override;
+
 		/**
 		 * Returns the duration of the content when played with default speed.
 		 * @return The recording's default duration, in seconds, with range [0, infinity)
@@ -265,6 +280,20 @@ class OCEAN_DEVICES_SERIALIZATION_EXPORT SerializerDevicePlayer :
 		 */
 		bool initializeDeviceFactories();
 
+		/**
+		 * Plays the next frame of the recording for the frame-by-frame modes (stop-motion and consumer-paced).
+		 * @return The timestamp of the frame which has been played, invalid if no additional frame exists
+		 * @see playNextFrame().
+		 */
+		Timestamp playNextFrameInternal();
+
+		/**
+		 * Returns the next sample from the input serializer for the frame-by-frame modes, waits until a sample is available.
+		 * @param channelId The resulting channel id of the sample
+		 * @return The next sample, nullptr if the end of the recording has been reached
+		 */
+		IO::Serialization::UniqueDataSample nextSample(IO::Serialization::DataSerializer::ChannelId& channelId);
+
 		/**
 		 * Processes a sample and forwards it to the appropriate device.
 		 * @param channelId The channel id of the sample
@@ -351,6 +380,17 @@ class OCEAN_DEVICES_SERIALIZATION_EXPORT SerializerDevicePlayer :
 		 */
 		void threadRun() override;
 
+		/**
+		 * The thread's run function for the consumer-paced mode.
+		 * @see threadRun().
+		 */
+		void threadRunConsumerPaced();
+
+		/**
+		 * Stores the final replay time in the statistics, once the replay has ended.
+		 */
+		void finishPlaybackStatistics();
+
 		/**
 		 * Factory function for creating SerializationOrientationTracker3DOF devices.
 		 * @param name The name of the new device, must be valid
@@ -441,6 +481,24 @@ class OCEAN_DEVICES_SERIALIZATION_EXPORT SerializerDevicePlayer :
 
 		/// The tolerance for stop-motion playback defining a time window beyond the current frame's timestamp for sample processing.
 		IO::Serialization::DataTimestamp stopMotionTolerance_;
+
+		/// True, if the consumer is done with the most recent frame so that the next frame can be played; relevant for the consumer-paced mode only.
+		bool consumerReady_ = false;
+
+		/// The mutex protecting the consumer state.
+		std::mutex consumerMutex_;
+
+		/// The condition variable notified whenever the consumer is done with a frame.
+		std::condition_variable consumerCondition_;
+
+		/// The timing statistics of the current replay.
+		PlaybackStatistics playbackStatistics_;
+
+		/// The timer measuring the overall time of the current replay.
+		HighPerformanceTimer playbackTimer_;
+
+		/// The lock for the statistics.
+		mutable Lock statisticsLock_;
 };
 
 inline SerializerDevicePlayer::FrameMediumData::FrameMediumData(const Media::PixelImageRef& pixelImage) :
@@ -143,6 +143,592 @@ Delaunay::IndexTriangles Delaunay::triangulation(const Vectors2& points)
 	return result;
 }
 
+Delaunay::IncrementalTriangulation::IncrementalTriangulation(const Box2& boundingBox) :
+	boundingBox_(boundingBox)
+{
+	ocean_assert(boundingBox_.isValid());
+
+	// the super triangle is an equilateral triangle with an incircle much larger than the bounding box
+
+	const Vector2 center = boundingBox_.center();
+	const Scalar radius = std::max(Scalar(1), std::max(boundingBox_.width(), boundingBox_.height())) * Scalar(16);
+
+	superPoints_[0] = center + Vector2(0, radius * Scalar(2));
+	superPoints_[1] = center + Vector2(-radius * Scalar(1.7320508075688772935), -radius); // sqrt(3)
+	superPoints_[2] = center + Vector2(radius * Scalar(1.7320508075688772935), -radius);
+
+	ocean_assert(orientation(superPoints_[0], superPoints_[1], superPoints_[2]) > 0.0);
+
+	const Index32 superTriangle = createTriangle(superTriangleIndex_, superTriangleIndex_ + 1u, superTriangleIndex_ + 2u);
+
+	for (unsigned int n = 0u; n < 3u; ++n)
+	{
+		superVertexTriangles_[n] = superTriangle;
+	}
+
+	gridVertices_.resize(size_t(gridBins_) * size_t(gridBins_), invalidIndex);
+}
+
+Index32 Delaunay::IncrementalTriangulation::addPoint(const Vector2& point)
+{
+	if (!boundingBox_.isInside(point))
+	{
+		return invalidIndex;
+	}
+
+	const Index32 containingTriangle = locateTriangle(point);
+	ocean_assert(triangleNodes_[containingTriangle].isValid());
+
+	for (const Index32 vertex : triangleNodes_[containingTriangle].vertices_)
+	{
+		if (vertexPoint(vertex).sqrDistance(point) <= Numeric::sqr(Numeric::eps()))
+		{
+			// the point exists already
+			return invalidIndex;
+		}
+	}
+
+	const Index32 pointIndex = Index32(points_.size());
+	ocean_assert(pointIndex < superTriangleIndex_);
+
+	points_.emplace_back(point);
+	vertexTriangles_.emplace_back(invalidIndex);
+
+	// we determine the cavity, all connected triangles whose circumcircles contain the new point
+
+	if (++stamp_ == 0u)
+	{
+		std::fill(triangleStamps_.begin(), triangleStamps_.end(), 0u);
+		stamp_ = 1u;
+	}
+
+	Indices32& cavityTriangles = reusableTriangles_;
+	IndexPairs32& boundaryEdges = reusableEdges_;
+	std::vector<EdgeNeighbor>& boundaryNeighbors = reusableEdgeNeighbors_;
+
+	cavityTriangles.clear();
+	boundaryEdges.clear();
+	boundaryNeighbors.clear();
+
+	cavityTriangles.emplace_back(containingTriangle);
+	triangleStamps_[containingTriangle] = stamp_;
+
+	for (size_t nCavity = 0; nCavity < cavityTriangles.size(); ++nCavity)
+	{
+		const Index32 triangle = cavityTriangles[nCavity];
+		const TriangleNode& node = triangleNodes_[triangle];
+
+		for (unsigned int slot = 0u; slot < 3u; ++slot)
+		{
+			const Index32 neighbor = node.neighbors_[slot];
+
+			if (neighbor != invalidIndex)
+			{
+				if (triangleStamps_[neighbor] == stamp_)
+				{
+					continue;
+				}
+
+				const TriangleNode& neighborNode = triangleNodes_[neighbor];
+
+				if (isInsideCircumCircle(vertexPoint(neighborNode.vertices_[0]), vertexPoint(neighborNode.vertices_[1]), vertexPoint(neighborNode.vertices_[2]), point))
+				{
+					triangleStamps_[neighbor] = stamp_;
+					cavityTriangles.emplace_back(neighbor);
+
+					continue;
+				}
+			}
+
+			// the edge is part of the boundary of the cavity
+
+			boundaryEdges.emplace_back(node.vertices_[(slot + 1u) % 3u], node.vertices_[(slot + 2u) % 3u]);
+			boundaryNeighbors.emplace_back(neighbor, neighbor != invalidIndex ? triangleNodes_[neighbor].neighborSlot(triangle) : 0u);
+
+			ocean_assert(orientation(vertexPoint(boundaryEdges.back().first), vertexPoint(boundaryEdges.back().second), point) > 0.0);
+		}
+	}
+
+	for (const Index32 triangle : cavityTriangles)
+	{
+		removeTriangle(triangle);
+	}
+
+	// the cavity is re-triangulated with one triangle for each boundary edge, all triangles have the new point as third corner
+
+	const size_t firstNewTriangle = cavityTriangles.size();
+
+	for (size_t nEdge = 0; nEdge < boundaryEdges.size(); ++nEdge)
+	{
+		const Index32 triangle = createTriangle(boundaryEdges[nEdge].first, boundaryEdges[nEdge].second, pointIndex);
+
+		connect(triangle, 2u, boundaryNeighbors[nEdge]);
+
+		cavityTriangles.emplace_back(triangle);
+	}
+
+	for (size_t nEdge = 0; nEdge < boundaryEdges.size(); ++nEdge)
+	{
+		const Index32 triangle = cavityTriangles[firstNewTriangle + nEdge];
+
+		for (size_t nOtherEdge = 0; nOtherEdge < boundaryEdges.size(); ++nOtherEdge)
+		{
+			if (boundaryEdges[nOtherEdge].first == boundaryEdges[nEdge].second)
+			{
+				// the edge between the second corner and the new point is shared with the triangle starting at the second corner
+
+				connect(triangle, 0u, EdgeNeighbor(cavityTriangles[firstNewTriangle + nOtherEdge], 1u));
+				break;
+			}
+		}
+	}
+
+	++size_;
+
+	addToGrid(pointIndex);
+
+	if (size_ > size_t(gridBins_) * size_t(gridBins_) * 2)
+	{
+		increaseGridResolution();
+	}
+
+	return pointIndex;
+}
+
+bool Delaunay::IncrementalTriangulation::removePoint(const Index32 pointIndex)
+{
+	if (!hasPoint(pointIndex))
+	{
+		return false;
+	}
+
+	// we gather the polygon around the point (in counter clockwise order) and the triangles on the other side of the polygon's edges
+
+	Indices32& starTriangles = reusableTriangles_;
+	std::vector<EdgeNeighbor>& polygonNeighbors = reusableEdgeNeighbors_;
+
+	starTriangles.clear();
+	polygonNeighbors.clear();
+
+	Indices32 polygon;
+
+	const Index32 firstTriangle = vertexTriangles_[pointIndex];
+	Index32 triangle = firstTriangle;
+
+	do
+	{
+		const TriangleNode& node = triangleNodes_[triangle];
+
+		const unsigned int slot = node.vertexSlot(pointIndex);
+		ocean_assert(slot < 3u);
+
+		const Index32 neighbor = node.neighbors_[slot];
+
+		polygon.emplace_back(node.vertices_[(slot + 1u) % 3u]);
+		polygonNeighbors.emplace_back(neighbor, neighbor != invalidIndex ? triangleNodes_[neighbor].neighborSlot(triangle) : 0u);
+		starTriangles.emplace_back(triangle);
+
+		triangle = node.neighbors_[(slot + 1u) % 3u];
+
+		ocean_assert(triangle != invalidIndex);
+		ocean_assert(starTriangles.size() <= triangleNodes_.size());
+	}
+	while (triangle != firstTriangle);
+
+	ocean_assert(polygon.size() >= 3);
+
+	for (const Index32 starTriangle : starTriangles)
+	{
+		removeTriangle(starTriangle);
+	}
+
+	vertexTriangles_[pointIndex] = invalidIndex;
+
+	const size_t bin = gridBin(points_[pointIndex]);
+
+	if (gridVertices_[bin] == pointIndex)
+	{
+		gridVertices_[bin] = invalidIndex;
+	}
+
+	--size_;
+
+	// the polygon is star-shaped, we apply ear clipping and prefer ears whose circumcircle does not contain any other corner of the polygon
+
+	Indices32 newTriangles;
+	newTriangles.reserve(polygon.size());
+
+	while (polygon.size() > 3)
+	{
+		const size_t polygonSize = polygon.size();
+
+		size_t earIndex = polygonSize;
+		bool earIsDelaunay = false;
+
+		for (size_t nPrevious = 0; nPrevious < polygonSize && !earIsDelaunay; ++nPrevious)
+		{
+			const Vector2& point0 = vertexPoint(polygon[nPrevious]);
+			const Vector2& point1 = vertexPoint(polygon[(nPrevious + 1) % polygonSize]);
+			const Vector2& point2 = vertexPoint(polygon[(nPrevious + 2) % polygonSize]);
+
+			if (orientation(point0, point1, point2) <= 0.0)
+			{
+				continue;
+			}
+
+			bool isEar = true;
+			bool isDelaunay = true;
+
+			for (size_t nOther = 3; nOther < polygonSize; ++nOther)
+			{
+				const Vector2& otherPoint = vertexPoint(polygon[(nPrevious + nOther) % polygonSize]);
+
+				if (orientation(point0, point1, otherPoint) >= 0.0 && orientation(point1, point2, otherPoint) >= 0.0 && orientation(point2, point0, otherPoint) >= 0.0)
+				{
+					isEar = false;
+					break;
+				}
+
+				if (isDelaunay && isInsideCircumCircle(point0, point1, point2, otherPoint))
+				{
+					isDelaunay = false;
+				}
+			}
+
+			if (isEar && (earIndex == polygonSize || isDelaunay))
+			{
+				earIndex = nPrevious;
+				earIsDelaunay = isDelaunay;
+			}
+		}
+
+		if (earIndex == polygonSize)
+		{
+			// due to rounding errors no ear could be found, we take the first corner
+			earIndex = 0;
+		}
+
+		const size_t nPrevious = earIndex;
+		const size_t nCurrent = (earIndex + 1) % polygonSize;
+		const size_t nNext = (earIndex + 2) % polygonSize;
+
+		const Index32 earTriangle = createTriangle(polygon[nPrevious], polygon[nCurrent], polygon[nNext]);
+
+		connect(earTriangle, 2u, polygonNeighbors[nPrevious]);
+		connect(earTriangle, 0u, polygonNeighbors[nCurrent]);
+
+		newTriangles.emplace_back(earTriangle);
+
+		// the new diagonal replaces the two edges of the ear
+
+		polygonNeighbors[nPrevious] = EdgeNeighbor(earTriangle, 1u);
+
+		polygon.erase(polygon.begin() + std::ptrdiff_t(nCurrent));
+		polygonNeighbors.erase(polygonNeighbors.begin() + std::ptrdiff_t(nCurrent));
+	}
+
+	const Index32 lastTriangle = createTriangle(polygon[0], polygon[1], polygon[2]);
+
+	connect(lastTriangle, 2u, polygonNeighbors[0]);
+	connect(lastTriangle, 0u, polygonNeighbors[1]);
+	connect(lastTriangle, 1u, polygonNeighbors[2]);
+
+	newTriangles.emplace_back(lastTriangle);
+
+	legalizeEdges(newTriangles);
+
+	return true;
+}
+
+Delaunay::IndexTriangles Delaunay::IncrementalTriangulation::triangles() const
+{
+	IndexTriangles result;
+	result.reserve(size_ * 2);
+
+	for (const TriangleNode& node : triangleNodes_)
+	{
+		if (node.isValid() && node.vertices_[0] < superTriangleIndex_ && node.vertices_[1] < superTriangleIndex_ && node.vertices_[2] < superTriangleIndex_)
+		{
+			result.emplace_back(node.vertices_[0], node.vertices_[1], node.vertices_[2]);
+		}
+	}
+
+	return result;
+}
+
+bool Delaunay::IncrementalTriangulation::checkTriangulation(const Scalar epsilon) const
+{
+	ocean_assert(epsilon >= 0);
+
+	for (size_t nPoint = 0; nPoint < vertexTriangles_.size(); ++nPoint)
+	{
+		const Index32 triangle = vertexTriangles_[nPoint];
+
+		if (triangle != invalidIndex && (size_t(triangle) >= triangleNodes_.size() || triangleNodes_[triangle].vertexSlot(Index32(nPoint)) == 3u))
+		{
+			return false;
+		}
+	}
+
+	for (size_t nTriangle = 0; nTriangle < triangleNodes_.size(); ++nTriangle)
+	{
+		const TriangleNode& node = triangleNodes_[nTriangle];
+
+		if (!node.isValid())
+		{
+			continue;
+		}
+
+		const Vector2& point0 = vertexPoint(node.vertices_[0]);
+		const Vector2& point1 = vertexPoint(node.vertices_[1]);
+		const Vector2& point2 = vertexPoint(node.vertices_[2]);
+
+		if (orientation(point0, point1, point2) <= 0.0)
+		{
+			return false;
+		}
+
+		const bool hasSuperCorner = node.vertices_[0] >= superTriangleIndex_ || node.vertices_[1] >= superTriangleIndex_ || node.vertices_[2] >= superTriangleIndex_;
+
+		for (unsigned int slot = 0u; slot < 3u; ++slot)
+		{
+			const Index32 neighbor = node.neighbors_[slot];
+
+			if (neighbor == invalidIndex)
+			{
+				continue;
+			}
+
+			if (size_t(neighbor) >= triangleNodes_.size() || !triangleNodes_[neighbor].isValid())
+			{
+				return false;
+			}
+
+			const TriangleNode& neighborNode = triangleNodes_[neighbor];
+			const unsigned int neighborSlot = neighborNode.neighborSlot(Index32(nTriangle));
+
+			if (neighborSlot == 3u)
+			{
+				return false;
+			}
+
+			// both triangles must share the same edge, with opposite directions
+
+			if (node.vertices_[(slot + 1u) % 3u] != neighborNode.vertices_[(neighborSlot + 2u) % 3u] || node.vertices_[(slot + 2u) % 3u] != neighborNode.vertices_[(neighborSlot + 1u) % 3u])
+			{
+				return false;
+			}
+
+			// triangles with a corner of the super triangle have huge circumcircles and are not part of the resulting triangulation
+
+			if (!hasSuperCorner)
+			{
+				const Vector2 circumcenter = Triangle2(point0, point1, point2).cartesianCircumcenter();
+				const Scalar circumcircleRadius = circumcenter.distance(point0);
+
+				if (circumcenter.sqrDistance(vertexPoint(neighborNode.vertices_[neighborSlot])) + Numeric::sqr(epsilon) < Numeric::sqr(circumcircleRadius))
+				{
+					return false;
+				}
+			}
+		}
+	}
+
+	return true;
+}
+
+Index32 Delaunay::IncrementalTriangulation::locateTriangle(const Vector2& point) const
+{
+	// jump: the starting triangle is a triangle of a point in the same bin of the grid hash
+
+	Index32 triangle = recentTriangle_;
+
+	const Index32 gridVertex = gridVertices_[gridBin(point)];
+
+	if (gridVertex != invalidIndex)
+	{
+		ocean_assert(vertexTriangles_[gridVertex] != invalidIndex);
+		triangle = vertexTriangles_[gridVertex];
+	}
+
+	ocean_assert(size_t(triangle) < triangleNodes_.size() && triangleNodes_[triangle].isValid());
+
+	// walk: we move to the neighbor on the other side of an edge separating the triangle and the point, the first tested edge changes with each step to avoid cycles
+
+	const size_t maximalSteps = triangleNodes_.size() + 16;
+
+	for (size_t nStep = 0; nStep < maximalSteps; ++nStep)
+	{
+		const TriangleNode& node = triangleNodes_[triangle];
+
+		Index32 nextTriangle = invalidIndex;
+
+		for (unsigned int n = 0u; n < 3u; ++n)
+		{
+			const unsigned int slot = (unsigned int)((nStep + n) % 3);
+
+			if (node.neighbors_[slot] != invalidIndex && orientation(vertexPoint(node.vertices_[(slot + 1u) % 3u]), vertexPoint(node.vertices_[(slot + 2u) % 3u]), point) < 0.0)
+			{
+				nextTriangle = node.neighbors_[slot];
+				break;
+			}
+		}
+
+		if (nextTriangle == invalidIndex)
+		{
+			return triangle;
+		}
+
+		triangle = nextTriangle;
+	}
+
+	// the walk did not converge due to rounding errors, we apply an exhaustive search
+
+	ocean_assert(false && "The walk did not converge!");
+
+	for (size_t nTriangle = 0; nTriangle < triangleNodes_.size(); ++nTriangle)
+	{
+		const TriangleNode& node = triangleNodes_[nTriangle];
+
+		if (node.isValid() && orientation(vertexPoint(node.vertices_[0]), vertexPoint(node.vertices_[1]), point) >= 0.0 && orientation(vertexPoint(node.vertices_[1]), vertexPoint(node.vertices_[2]), point) >= 0.0 && orientation(vertexPoint(node.vertices_[2]), vertexPoint(node.vertices_[0]), point) >= 0.0)
+		{
+			return Index32(nTriangle);
+		}
+	}
+
+	return triangle;
+}
+
+Index32 Delaunay::IncrementalTriangulation::createTriangle(const Index32 vertex0, const Index32 vertex1, const Index32 vertex2)
+{
+	ocean_assert(orientation(vertexPoint(vertex0), vertexPoint(vertex1), vertexPoint(vertex2)) > 0.0);
+
+	Index32 triangle = invalidIndex;
+
+	if (freeTriangles_.empty())
+	{
+		triangle = Index32(triangleNodes_.size());
+
+		triangleNodes_.emplace_back(vertex0, vertex1, vertex2);
+		triangleStamps_.emplace_back(0u);
+	}
+	else
+	{
+		triangle = freeTriangles_.back();
+		freeTriangles_.pop_back();
+
+		triangleNodes_[triangle] = TriangleNode(vertex0, vertex1, vertex2);
+	}
+
+	vertexTriangle(vertex0) = triangle;
+	vertexTriangle(vertex1) = triangle;
+	vertexTriangle(vertex2) = triangle;
+
+	recentTriangle_ = triangle;
+
+	return triangle;
+}
+
+void Delaunay::IncrementalTriangulation::legalizeEdges(Indices32& triangles)
+{
+	// each flip is counted to ensure termination even in case of rounding errors
+
+	size_t remainingFlips = triangles.size() * 64 + 64;
+
+	while (!triangles.empty() && remainingFlips != 0)
+	{
+		const Index32 triangle = triangles.back();
+		triangles.pop_back();
+
+		if (!triangleNodes_[triangle].isValid())
+		{
+			continue;
+		}
+
+		for (unsigned int slot = 0u; slot < 3u; ++slot)
+		{
+			TriangleNode& node = triangleNodes_[triangle];
+
+			const Index32 neighbor = node.neighbors_[slot];
+
+			if (neighbor == invalidIndex)
+			{
+				continue;
+			}
+
+			TriangleNode& neighborNode = triangleNodes_[neighbor];
+			const unsigned int neighborSlot = neighborNode.neighborSlot(triangle);
+			ocean_assert(neighborSlot < 3u);
+
+			const Index32 vertexP = node.vertices_[slot];
+			const Index32 vertexA = node.vertices_[(slot + 1u) % 3u];
+			const Index32 vertexB = node.vertices_[(slot + 2u) % 3u];
+			const Index32 vertexQ = neighborNode.vertices_[neighborSlot];
+
+			ocean_assert(neighborNode.vertices_[(neighborSlot + 1u) % 3u] == vertexB);
+			ocean_assert(neighborNode.vertices_[(neighborSlot + 2u) % 3u] == vertexA);
+
+			const Vector2& pointP = vertexPoint(vertexP);
+			const Vector2& pointA = vertexPoint(vertexA);
+			const Vector2& pointB = vertexPoint(vertexB);
+			const Vector2& pointQ = vertexPoint(vertexQ);
+
+			if (!isInsideCircumCircle(pointP, pointA, pointB, pointQ) || orientation(pointP, pointA, pointQ) <= 0.0 || orientation(pointQ, pointB, pointP) <= 0.0)
+			{
+				continue;
+			}
+
+			// we flip the edge A-B to the edge P-Q, the triangle becomes (P, A, Q), the neighbor becomes (Q, B, P)
+
+			const EdgeNeighbor neighborA(node.neighbors_[(slot + 1u) % 3u], 0u); // the edge B-P
+			const Index32 neighborB = node.neighbors_[(slot + 2u) % 3u]; // the edge P-A
+			const Index32 neighborNeighborB = neighborNode.neighbors_[(neighborSlot + 1u) % 3u]; // the edge A-Q
+			const Index32 neighborNeighborA = neighborNode.neighbors_[(neighborSlot + 2u) % 3u]; // the edge Q-B
+
+			const unsigned int slotNeighborA = neighborA.triangle_ != invalidIndex ? triangleNodes_[neighborA.triangle_].neighborSlot(triangle) : 0u;
+			const unsigned int slotNeighborNeighborB = neighborNeighborB != invalidIndex ? triangleNodes_[neighborNeighborB].neighborSlot(neighbor) : 0u;
+
+			node = TriangleNode(vertexP, vertexA, vertexQ);
+			neighborNode = TriangleNode(vertexQ, vertexB, vertexP);
+
+			node.neighbors_[1] = neighbor;
+			neighborNode.neighbors_[1] = triangle;
+
+			node.neighbors_[2] = neighborB;
+			neighborNode.neighbors_[2] = neighborNeighborA;
+
+			connect(triangle, 0u, EdgeNeighbor(neighborNeighborB, slotNeighborNeighborB));
+			connect(neighbor, 0u, EdgeNeighbor(neighborA.triangle_, slotNeighborA));
+
+			vertexTriangle(vertexP) = triangle;
+			vertexTriangle(vertexA) = triangle;
+			vertexTriangle(vertexQ) = triangle;
+			vertexTriangle(vertexB) = neighbor;
+
+			triangles.emplace_back(triangle);
+			triangles.emplace_back(neighbor);
+
+			--remainingFlips;
+			break;
+		}
+	}
+}
+
+void Delaunay::IncrementalTriangulation::increaseGridResolution()
+{
+	gridBins_ *= 2u;
+
+	gridVertices_.assign(size_t(gridBins_) * size_t(gridBins_), invalidIndex);
+
+	for (size_t nPoint = 0; nPoint < vertexTriangles_.size(); ++nPoint)
+	{
+		if (vertexTriangles_[nPoint] != invalidIndex)
+		{
+			addToGrid(Index32(nPoint));
+		}
+	}
+}
+
 bool Delaunay::checkTriangulation(const IndexTriangles& triangles, const Vectors2& points, const Scalar epsilon)
 {
 	CircumCricleIndexTriangles circumCircleTriangles;
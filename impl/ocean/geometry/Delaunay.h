@@ -10,6 +10,7 @@
 
 #include "ocean/geometry/Geometry.h"
 
+#include "ocean/math/Box2.h"
 #include "ocean/math/Triangle2.h"
 #include "ocean/math/Triangle3.h"
 #include "ocean/math/Line2.h"
@@ -113,6 +114,311 @@ class OCEAN_GEOMETRY_EXPORT Delaunay
 		 */
 		using IndexTriangles = std::vector<IndexTriangle>;
 
+		/**
+		 * This class implements an incremental Delaunay triangulation allowing to add and to remove individual points.
+		 * The implementation is based on the Bowyer-Watson algorithm, a new point is located with a jump-and-walk approach while a grid hash provides the starting triangle of the walk.<br>
+		 * Removed points are re-triangulated locally (ear clipping followed by edge flips), so that adding or removing a point has a roughly constant amortized cost for well distributed points.<br>
+		 * The triangulation lives inside a super triangle which is determined by a bounding box, all points must be located inside this bounding box.<br>
+		 * The indices of the resulting triangles are the indices of the points as returned by addPoint(), the indices of removed points are not reused.
+		 * @code
+		 * Delaunay::IncrementalTriangulation triangulation(Box2(0, 0, Scalar(width), Scalar(height)));
+		 *
+		 * for (const Vector2& point : points)
+		 * {
+		 *     triangulation.addPoint(point);
+		 * }
+		 *
+		 * const Delaunay::IndexTriangles triangles = triangulation.triangles();
+		 * @endcode
+		 */
+		class OCEAN_GEOMETRY_EXPORT IncrementalTriangulation
+		{
+			public:
+
+				/**
+				 * Definition of an invalid index.
+				 */
+				static constexpr Index32 invalidIndex = Index32(-1);
+
+			protected:
+
+				/**
+				 * The index of the first corner of the super triangle, the corners of the super triangle have the indices [superTriangleIndex_, superTriangleIndex_ + 2].
+				 */
+				static constexpr Index32 superTriangleIndex_ = Index32(-4);
+
+				/**
+				 * This class implements a node of the triangulation, a triangle with counter clockwise corners and the three neighboring triangles.
+				 */
+				class TriangleNode
+				{
+					public:
+
+						/**
+						 * Creates an invalid triangle node.
+						 */
+						TriangleNode() = default;
+
+						/**
+						 * Creates a new triangle node without neighbors.
+						 * @param vertex0 The index of the first corner
+						 * @param vertex1 The index of the second corner, counter clockwise to the first corner
+						 * @param vertex2 The index of the third corner, counter clockwise to the second corner
+						 */
+						inline TriangleNode(const Index32 vertex0, const Index32 vertex1, const Index32 vertex2);
+
+						/**
+						 * Returns the location of a corner in this triangle.
+						 * @param vertex The index of the corner
+						 * @return The location of the corner, with range [0, 2], 3 if the vertex is not a corner of this triangle
+						 */
+						inline unsigned int vertexSlot(const Index32 vertex) const;
+
+						/**
+						 * Returns the location of a neighbor of this triangle.
+						 * @param neighbor The index of the neighboring triangle
+						 * @return The location of the neighbor, with range [0, 2], 3 if the triangle is not a neighbor of this triangle
+						 */
+						inline unsigned int neighborSlot(const Index32 neighbor) const;
+
+						/**
+						 * Returns whether this triangle node is part of the triangulation.
+						 * @return True, if so
+						 */
+						inline bool isValid() const;
+
+					public:
+
+						/// The indices of the three corners, in counter clockwise order.
+						Index32 vertices_[3] = {invalidIndex, invalidIndex, invalidIndex};
+
+						/// The indices of the three neighboring triangles, the neighbor with index n is located opposite to the corner with index n, invalidIndex for the border of the super triangle.
+						Index32 neighbors_[3] = {invalidIndex, invalidIndex, invalidIndex};
+				};
+
+				/**
+				 * Definition of a vector holding triangle nodes.
+				 */
+				using TriangleNodes = std::vector<TriangleNode>;
+
+				/**
+				 * This class stores the triangle on the other side of an edge, together with the location of the edge in this triangle.
+				 */
+				class EdgeNeighbor
+				{
+					public:
+
+						/**
+						 * Creates a new object.
+						 * @param triangle The index of the triangle on the other side of the edge, invalidIndex for the border of the super triangle
+						 * @param slot The location of the edge within the triangle, with range [0, 2]
+						 */
+						inline EdgeNeighbor(const Index32 triangle, const unsigned int slot);
+
+					public:
+
+						/// The index of the triangle on the other side of the edge.
+						Index32 triangle_ = invalidIndex;
+
+						/// The location of the edge within the triangle.
+						unsigned int slot_ = 0u;
+				};
+
+			public:
+
+				/**
+				 * Creates a new triangulation for points located inside a bounding box.
+				 * @param boundingBox The bounding box in which all points of the triangulation will be located, must be valid
+				 */
+				explicit IncrementalTriangulation(const Box2& boundingBox);
+
+				/**
+				 * Adds a new point to the triangulation.
+				 * @param point The point to be added, must be located inside the bounding box of this triangulation
+				 * @return The index of the new point, invalidIndex if the point is outside of the bounding box or if the point is identical to an existing point
+				 */
+				Index32 addPoint(const Vector2& point);
+
+				/**
+				 * Removes a point from the triangulation.
+				 * @param pointIndex The index of the point to be removed, as returned by addPoint()
+				 * @return True, if succeeded; False, if the point does not exist
+				 */
+				bool removePoint(const Index32 pointIndex);
+
+				/**
+				 * Returns the triangles of this triangulation, triangles with a corner of the super triangle are not part of the result.
+				 * @return The resulting triangles with counter clockwise corners, the indices are point indices as returned by addPoint()
+				 */
+				IndexTriangles triangles() const;
+
+				/**
+				 * Returns all points which have been added to this triangulation, including removed points.
+				 * @return The points of this triangulation, with one point for each index returned by addPoint()
+				 */
+				inline const Vectors2& points() const;
+
+				/**
+				 * Returns whether a point is part of this triangulation.
+				 * @param pointIndex The index of the point to check
+				 * @return True, if the point has been added and has not been removed
+				 */
+				inline bool hasPoint(const Index32 pointIndex) const;
+
+				/**
+				 * Returns the number of points which are part of this triangulation.
+				 * @return The number of points, removed points are not counted
+				 */
+				inline size_t size() const;
+
+				/**
+				 * Checks this triangulation for integrity: all edges must be locally Delaunay and all neighborhood relations must be consistent.
+				 * In contrast to Delaunay::checkTriangulation(), this check has linear complexity.
+				 * @param epsilon The epsilon value used for a slightly more generous comparison, with range [0, infinity)
+				 * @return True, if the triangulation is a valid Delaunay triangulation
+				 */
+				bool checkTriangulation(const Scalar epsilon = Numeric::eps()) const;
+
+			protected:
+
+				/**
+				 * Returns the location of a vertex.
+				 * @param vertex The index of the vertex, either the index of a point or the index of a corner of the super triangle
+				 * @return The vertex' location
+				 */
+				inline const Vector2& vertexPoint(const Index32 vertex) const;
+
+				/**
+				 * Returns the index of one triangle which has a specific vertex as corner.
+				 * @param vertex The index of the vertex, either the index of a point or the index of a corner of the super triangle
+				 * @return The index of the triangle, invalidIndex if the vertex is not part of the triangulation
+				 */
+				inline Index32& vertexTriangle(const Index32 vertex);
+
+				/**
+				 * Determines the triangle containing a point.
+				 * @param point The point to locate, must be inside the super triangle
+				 * @return The index of the triangle containing the point
+				 */
+				Index32 locateTriangle(const Vector2& point) const;
+
+				/**
+				 * Creates a new triangle node, a free node is reused if possible.
+				 * @param vertex0 The index of the first corner
+				 * @param vertex1 The index of the second corner, counter clockwise to the first corner
+				 * @param vertex2 The index of the third corner, counter clockwise to the second corner
+				 * @return The index of the new triangle node
+				 */
+				Index32 createTriangle(const Index32 vertex0, const Index32 vertex1, const Index32 vertex2);
+
+				/**
+				 * Removes a triangle node, the node will be reused later.
+				 * @param triangle The index of the triangle node to remove
+				 */
+				inline void removeTriangle(const Index32 triangle);
+
+				/**
+				 * Connects a triangle with the triangle on the other side of an edge.
+				 * @param triangle The index of the triangle to connect
+				 * @param slot The location of the edge within the triangle, with range [0, 2]
+				 * @param edgeNeighbor The triangle on the other side of the edge
+				 */
+				inline void connect(const Index32 triangle, const unsigned int slot, const EdgeNeighbor& edgeNeighbor);
+
+				/**
+				 * Flips edges until all edges of the given triangles (and of all triangles created by flips) are locally Delaunay.
+				 * @param triangles The indices of the triangles to check, will be modified
+				 */
+				void legalizeEdges(Indices32& triangles);
+
+				/**
+				 * Adds a vertex to the grid hash.
+				 * @param vertex The index of the point to add
+				 */
+				inline void addToGrid(const Index32 vertex);
+
+				/**
+				 * Returns the bin of the grid hash for a point.
+				 * @param point The point for which the bin will be returned
+				 * @return The index of the bin
+				 */
+				inline size_t gridBin(const Vector2& point) const;
+
+				/**
+				 * Re-creates the grid hash with a higher resolution.
+				 */
+				void increaseGridResolution();
+
+				/**
+				 * Returns whether a point is located inside the circumcircle of a triangle.
+				 * @param point0 The first corner of the triangle, counter clockwise
+				 * @param point1 The second corner of the triangle
+				 * @param point2 The third corner of the triangle
+				 * @param point The point to check
+				 * @return True, if the point is strictly inside the circumcircle
+				 */
+				static inline bool isInsideCircumCircle(const Vector2& point0, const Vector2& point1, const Vector2& point2, const Vector2& point);
+
+				/**
+				 * Returns the orientation of three points.
+				 * @param point0 The first point
+				 * @param point1 The second point
+				 * @param point2 The third point
+				 * @return A positive value if the points are counter clockwise, a negative value if the points are clockwise, zero if the points are collinear
+				 */
+				static inline double orientation(const Vector2& point0, const Vector2& point1, const Vector2& point2);
+
+			protected:
+
+				/// The bounding box in which all points are located.
+				Box2 boundingBox_;
+
+				/// The three corners of the super triangle.
+				Vector2 superPoints_[3];
+
+				/// The indices of triangles having the corners of the super triangle as corners.
+				Index32 superVertexTriangles_[3] = {invalidIndex, invalidIndex, invalidIndex};
+
+				/// All points which have been added.
+				Vectors2 points_;
+
+				/// One triangle for each point having the point as corner, invalidIndex for removed points.
+				Indices32 vertexTriangles_;
+
+				/// The number of points which have not been removed.
+				size_t size_ = 0;
+
+				/// All triangle nodes, including free nodes.
+				TriangleNodes triangleNodes_;
+
+				/// The indices of all free triangle nodes.
+				Indices32 freeTriangles_;
+
+				/// The index of the most recently created triangle, used as fallback starting triangle.
+				Index32 recentTriangle_ = invalidIndex;
+
+				/// The grid hash holding one vertex for each bin, invalidIndex for empty bins.
+				Indices32 gridVertices_;
+
+				/// The number of horizontal bins of the grid hash (and vertical bins).
+				unsigned int gridBins_ = 8u;
+
+				/// Reusable stamps for all triangle nodes.
+				Indices32 triangleStamps_;
+
+				/// The current stamp.
+				Index32 stamp_ = 0u;
+
+				/// Reusable indices of triangles.
+				Indices32 reusableTriangles_;
+
+				/// Reusable pairs of vertices of edges.
+				IndexPairs32 reusableEdges_;
+
+				/// Reusable triangles on the other side of edges, one for each edge.
+				std::vector<EdgeNeighbor> reusableEdgeNeighbors_;
+		};
+
 	protected:
 
 		/**
@@ -374,6 +680,155 @@ inline Triangle3 Delaunay::IndexTriangle::triangle3(const Vector3* points) const
 	return Triangle3(points[indices_[0]], points[indices_[1]], points[indices_[2]]);
 }
 
+inline Delaunay::IncrementalTriangulation::TriangleNode::TriangleNode(const Index32 vertex0, const Index32 vertex1, const Index32 vertex2)
+{
+	vertices_[0] = vertex0;
+	vertices_[1] = vertex1;
+	vertices_[2] = vertex2;
+
+	ocean_assert(isValid());
+}
+
+inline unsigned int Delaunay::IncrementalTriangulation::TriangleNode::vertexSlot(const Index32 vertex) const
+{
+	for (unsigned int n = 0u; n < 3u; ++n)
+	{
+		if (vertices_[n] == vertex)
+		{
+			return n;
+		}
+	}
+
+	return 3u;
+}
+
+inline unsigned int Delaunay::IncrementalTriangulation::TriangleNode::neighborSlot(const Index32 neighbor) const
+{
+	for (unsigned int n = 0u; n < 3u; ++n)
+	{
+		if (neighbors_[n] == neighbor)
+		{
+			return n;
+		}
+	}
+
+	return 3u;
+}
+
+inline bool Delaunay::IncrementalTriangulation::TriangleNode::isValid() const
+{
+	return vertices_[0] != invalidIndex;
+}
+
+inline Delaunay::IncrementalTriangulation::EdgeNeighbor::EdgeNeighbor(const Index32 triangle, const unsigned int slot) :
+	triangle_(triangle),
+	slot_(slot)
+{
+	ocean_assert(slot_ < 3u);
+}
+
+inline const Vectors2& Delaunay::IncrementalTriangulation::points() const
+{
+	return points_;
+}
+
+inline bool Delaunay::IncrementalTriangulation::hasPoint(const Index32 pointIndex) const
+{
+	return size_t(pointIndex) < vertexTriangles_.size() && vertexTriangles_[pointIndex] != invalidIndex;
+}
+
+inline size_t Delaunay::IncrementalTriangulation::size() const
+{
+	return size_;
+}
+
+inline const Vector2& Delaunay::IncrementalTriangulation::vertexPoint(const Index32 vertex) const
+{
+	if (vertex >= superTriangleIndex_)
+	{
+		ocean_assert(vertex - superTriangleIndex_ < 3u);
+		return superPoints_[vertex - superTriangleIndex_];
+	}
+
+	ocean_assert(size_t(vertex) < points_.size());
+	return points_[vertex];
+}
+
+inline Index32& Delaunay::IncrementalTriangulation::vertexTriangle(const Index32 vertex)
+{
+	if (vertex >= superTriangleIndex_)
+	{
+		ocean_assert(vertex - superTriangleIndex_ < 3u);
+		return superVertexTriangles_[vertex - superTriangleIndex_];
+	}
+
+	ocean_assert(size_t(vertex) < vertexTriangles_.size());
+	return vertexTriangles_[vertex];
+}
+
+inline void Delaunay::IncrementalTriangulation::removeTriangle(const Index32 triangle)
+{
+	ocean_assert(size_t(triangle) < triangleNodes_.size());
+	ocean_assert(triangleNodes_[triangle].isValid());
+
+	triangleNodes_[triangle] = TriangleNode();
+	freeTriangles_.emplace_back(triangle);
+}
+
+inline void Delaunay::IncrementalTriangulation::connect(const Index32 triangle, const unsigned int slot, const EdgeNeighbor& edgeNeighbor)
+{
+	ocean_assert(size_t(triangle) < triangleNodes_.size() && slot < 3u);
+
+	triangleNodes_[triangle].neighbors_[slot] = edgeNeighbor.triangle_;
+
+	if (edgeNeighbor.triangle_ != invalidIndex)
+	{
+		ocean_assert(size_t(edgeNeighbor.triangle_) < triangleNodes_.size());
+		triangleNodes_[edgeNeighbor.triangle_].neighbors_[edgeNeighbor.slot_] = triangle;
+	}
+}
+
+inline void Delaunay::IncrementalTriangulation::addToGrid(const Index32 vertex)
+{
+	ocean_assert(size_t(vertex) < points_.size());
+
+	gridVertices_[gridBin(points_[vertex])] = vertex;
+}
+
+inline size_t Delaunay::IncrementalTriangulation::gridBin(const Vector2& point) const
+{
+	ocean_assert(boundingBox_.isValid());
+
+	const Scalar normalizedX = (point.x() - boundingBox_.left()) / std::max(boundingBox_.width(), Numeric::eps());
+	const Scalar normalizedY = (point.y() - boundingBox_.top()) / std::max(boundingBox_.height(), Numeric::eps());
+
+	const unsigned int binX = (unsigned int)(minmax<int>(0, int(normalizedX * Scalar(gridBins_)), int(gridBins_) - 1));
+	const unsigned int binY = (unsigned int)(minmax<int>(0, int(normalizedY * Scalar(gridBins_)), int(gridBins_) - 1));
+
+	return size_t(binY) * size_t(gridBins_) + size_t(binX);
+}
+
+inline bool Delaunay::IncrementalTriangulation::isInsideCircumCircle(const Vector2& point0, const Vector2& point1, const Vector2& point2, const Vector2& point)
+{
+	// the determinant is computed with double precision, even if Scalar is float
+
+	const double x0 = double(point0.x()) - double(point.x());
+	const double y0 = double(point0.y()) - double(point.y());
+	const double x1 = double(point1.x()) - double(point.x());
+	const double y1 = double(point1.y()) - double(point.y());
+	const double x2 = double(point2.x()) - double(point.x());
+	const double y2 = double(point2.y()) - double(point.y());
+
+	const double determinant = (x0 * x0 + y0 * y0) * (x1 * y2 - x2 * y1) - (x1 * x1 + y1 * y1) * (x0 * y2 - x2 * y0) + (x2 * x2 + y2 * y2) * (x0 * y1 - x1 * y0);
+
+	return determinant > 0.0;
+}
+
+inline double Delaunay::IncrementalTriangulation::orientation(const Vector2& point0, const Vector2& point1, const Vector2& point2)
+{
+	return (double(point1.x()) - double(point0.x())) * (double(point2.y()) - double(point0.y())) - (double(point1.y()) - double(point0.y())) * (double(point2.x()) - double(point0.x()));
+}
+
 inline Delaunay::CircumCricleIndexTriangle::CircumCricleIndexTriangle(const unsigned int index0, const unsigned int index1, const unsigned int index2, const Vector2* points) :
 	IndexTriangle(index0, index1, index2),
 	circumcenter_(0, 0),
@@ -56,6 +56,92 @@ void Error::determineInvalidParameters(const Scalar* parameters, const size_t nu
 	}
 }
 
+Scalar Error::determinePoseErrorSumIF(const HomogenousMatrix4& flippedCamera_T_world, const AnyCamera& anyCamera, const Vector3* objectPoints, const Vector2* imagePoints, const size_t correspondences, const Scalar maximalSqrErrorSum, Scalar* sqrErrors)
+{
+	ocean_assert(flippedCamera_T_world.isValid() && anyCamera.isValid());
+	ocean_assert(correspondences == 0 || (objectPoints != nullptr && imagePoints != nullptr));
+	ocean_assert(maximalSqrErrorSum >= 0);
+
+	Vector2 projectedImagePoints[correspondenceBlockSize_];
+
+	Scalar sqrErrorSum = 0;
+
+	for (size_t blockStart = 0; blockStart < correspondences; blockStart += correspondenceBlockSize_)
+	{
+		const size_t blockCorrespondences = std::min(correspondenceBlockSize_, correspondences - blockStart);
+
+		// the contiguous object points are projected directly, with one (virtual) function call per block
+
+		anyCamera.projectToImageIF(flippedCamera_T_world, objectPoints + blockStart, blockCorrespondences, projectedImagePoints);
+
+		const Vector2* const blockImagePoints = imagePoints + blockStart;
+
+		for (size_t n = 0; n < blockCorrespondences; ++n)
+		{
+			const Scalar sqrError = blockImagePoints[n].sqrDistance(projectedImagePoints[n]);
+
+			if (sqrErrors != nullptr)
+			{
+				sqrErrors[blockStart + n] = sqrError;
+			}
+
+			sqrErrorSum += sqrError;
+		}
+
+		if (sqrErrorSum > maximalSqrErrorSum)
+		{
+			break;
+		}
+	}
+
+	return sqrErrorSum;
+}
+
+size_t Error::determineValidCorrespondencesIF(const HomogenousMatrix4& flippedCamera_T_world, const AnyCamera& anyCamera, const Vector3* objectPoints, const Vector2* imagePoints, const size_t correspondences, const Scalar maximalSqrError, Indices32* validIndices, Scalar* sqrErrorSum)
+{
+	ocean_assert(flippedCamera_T_world.isValid() && anyCamera.isValid());
+	ocean_assert(correspondences == 0 || (objectPoints != nullptr && imagePoints != nullptr));
+	ocean_assert(maximalSqrError >= 0);
+	ocean_assert(NumericT<Index32>::isInsideValueRange(correspondences));
+
+	Vector2 projectedImagePoints[correspondenceBlockSize_];
+
+	size_t validCorrespondences = 0;
+	Scalar validSqrErrorSum = 0;
+
+	for (size_t blockStart = 0; blockStart < correspondences; blockStart += correspondenceBlockSize_)
+	{
+		const size_t blockCorrespondences = std::min(correspondenceBlockSize_, correspondences - blockStart);
+
+		anyCamera.projectToImageIF(flippedCamera_T_world, objectPoints + blockStart, blockCorrespondences, projectedImagePoints);
+
+		const Vector2* const blockImagePoints = imagePoints + blockStart;
+
+		for (size_t n = 0; n < blockCorrespondences; ++n)
+		{
+			const Scalar sqrError = blockImagePoints[n].sqrDistance(projectedImagePoints[n]);
+
+			if (sqrError <= maximalSqrError)
+			{
+				++validCorrespondences;
+				validSqrErrorSum += sqrError;
+
+				if (validIndices != nullptr)
+				{
+					validIndices->emplace_back(Index32(blockStart + n));
+				}
+			}
+		}
+	}
+
+	if (sqrErrorSum != nullptr)
+	{
+		*sqrErrorSum = validSqrErrorSum;
+	}
+
+	return validCorrespondences;
+}
+
 Scalar Error::determineAverageError(const Vectors2& firstPoints, const Vectors2& secondPoints, Vector2* errors, Scalar* sqrErrors)
 {
 	ocean_assert(!firstPoints.empty());
@@ -497,6 +497,71 @@ class OCEAN_GEOMETRY_EXPORT Error
 		template <typename TAccessorObjectPoints, typename TAccessorImagePoints, bool tUseBorderDistortionIfOutside>
 		static void determinePoseErrorIF(const HomogenousMatrix4& flippedCamera_T_world, const PinholeCamera& pinholeCamera, const TAccessorObjectPoints& objectPointAccessor, const TAccessorImagePoints& imagePointAccessor, const bool useDistortionParameters, Scalar& sqrAveragePixelError, Scalar& sqrMinimalPixelError, Scalar& sqrMaximalPixelError, const Scalar zoom = Scalar(1));
 
+		/**
+		 * Determines the sum of square pixel errors between projected 3D object points and 2D image points for contiguous arrays of correspondences.
+		 * Transformation, projection, distortion and error determination are fused into one loop, the accumulated error is checked after each block of correspondences.<br>
+		 * The determination stops as soon as the accumulated error exceeds the given threshold, e.g., the error of the best RANSAC hypothesis so far.
+		 * @param flippedCamera_T_world The inverted and flipped camera pose, transforming world to flipped camera, must be valid
+		 * @param pinholeCamera The pinhole camera defining the projection, must be valid
+		 * @param objectPoints The 3D object points defined in world, must be valid if correspondences != 0
+		 * @param imagePoints The 2D image points, one for each object point, must be valid if correspondences != 0
+		 * @param correspondences The number of given correspondences, with range [0, infinity)
+		 * @param useDistortionParameters True, to respect the distortion parameters of the given camera during object point projection
+		 * @param maximalSqrErrorSum The threshold for the accumulated square pixel error, with range [0, infinity)
+		 * @param sqrErrors Optional resulting square pixel errors, one for each correspondence, the errors after an early exit are not determined
+		 * @return The sum of all square pixel errors; a value larger than 'maximalSqrErrorSum' if the determination stopped early
+		 * @tparam tUseBorderDistortionIfOutside True, to apply the camera distortion from the nearest point lying on the frame border if the point lies outside the visible camera area; False, to apply the distortion from the given position
+		 */
+		template <bool tUseBorderDistortionIfOutside>
+		static Scalar determinePoseErrorSumIF(const HomogenousMatrix4& flippedCamera_T_world, const PinholeCamera& pinholeCamera, const Vector3* objectPoints, const Vector2* imagePoints, const size_t correspondences, const bool useDistortionParameters, const Scalar maximalSqrErrorSum = Numeric::maxValue(), Scalar* sqrErrors = nullptr);
+
+		/**
+		 * Determines the sum of square pixel errors between projected 3D object points and 2D image points for contiguous arrays of correspondences.
+		 * The object points are projected in blocks with one (virtual) function call per block, the accumulated error is checked after each block.<br>
+		 * The determination stops as soon as the accumulated error exceeds the given threshold, e.g., the error of the best RANSAC hypothesis so far.
+		 * @param flippedCamera_T_world The inverted and flipped camera pose, transforming world to flipped camera, must be valid
+		 * @param anyCamera The camera profile defining the projection, must be valid
+		 * @param objectPoints The 3D object points defined in world, must be valid if correspondences != 0
+		 * @param imagePoints The 2D image points, one for each object point, must be valid if correspondences != 0
+		 * @param correspondences The number of given correspondences, with range [0, infinity)
+		 * @param maximalSqrErrorSum The threshold for the accumulated square pixel error, with range [0, infinity)
+		 * @param sqrErrors Optional resulting square pixel errors, one for each correspondence, the errors after an early exit are not determined
+		 * @return The sum of all square pixel errors; a value larger than 'maximalSqrErrorSum' if the determination stopped early
+		 */
+		static Scalar determinePoseErrorSumIF(const HomogenousMatrix4& flippedCamera_T_world, const AnyCamera& anyCamera, const Vector3* objectPoints, const Vector2* imagePoints, const size_t correspondences, const Scalar maximalSqrErrorSum = Numeric::maxValue(), Scalar* sqrErrors = nullptr);
+
+		/**
+		 * Determines the correspondences with a square pixel error not larger than a given threshold for contiguous arrays of correspondences.
+		 * Transformation, projection, distortion and error determination are fused into one loop.
+		 * @param flippedCamera_T_world The inverted and flipped camera pose, transforming world to flipped camera, must be valid
+		 * @param pinholeCamera The pinhole camera defining the projection, must be valid
+		 * @param objectPoints The 3D object points defined in world, must be valid if correspondences != 0
+		 * @param imagePoints The 2D image points, one for each object point, must be valid if correspondences != 0
+		 * @param correspondences The number of given correspondences, with range [0, infinity)
+		 * @param useDistortionParameters True, to respect the distortion parameters of the given camera during object point projection
+		 * @param maximalSqrError The maximal square pixel error of a valid correspondence, with range [0, infinity)
+		 * @param validIndices Optional resulting indices of the valid correspondences, the indices will be appended
+		 * @param sqrErrorSum Optional resulting sum of square pixel errors of all valid correspondences
+		 * @return The number of valid correspondences
+		 * @tparam tUseBorderDistortionIfOutside True, to apply the camera distortion from the nearest point lying on the frame border if the point lies outside the visible camera area; False, to apply the distortion from the given position
+		 */
+		template <bool tUseBorderDistortionIfOutside>
+		static size_t determineValidCorrespondencesIF(const HomogenousMatrix4& flippedCamera_T_world, const PinholeCamera& pinholeCamera, const Vector3* objectPoints, const Vector2* imagePoints, const size_t correspondences, const bool useDistortionParameters, const Scalar maximalSqrError, Indices32* validIndices = nullptr, Scalar* sqrErrorSum = nullptr);
+
+		/**
+		 * Determines the correspondences with a square pixel error not larger than a given threshold for contiguous arrays of correspondences.
+		 * @param flippedCamera_T_world The inverted and flipped camera pose, transforming world to flipped camera, must be valid
+		 * @param anyCamera The camera profile defining the projection, must be valid
+		 * @param objectPoints The 3D object points defined in world, must be valid if correspondences != 0
+		 * @param imagePoints The 2D image points, one for each object point, must be valid if correspondences != 0
+		 * @param correspondences The number of given correspondences, with range [0, infinity)
+		 * @param maximalSqrError The maximal square pixel error of a valid correspondence, with range [0, infinity)
+		 * @param validIndices Optional resulting indices of the valid correspondences, the indices will be appended
+		 * @param sqrErrorSum Optional resulting sum of square pixel errors of all valid correspondences
+		 * @return The number of valid correspondences
+		 */
+		static size_t determineValidCorrespondencesIF(const HomogenousMatrix4& flippedCamera_T_world, const AnyCamera& anyCamera, const Vector3* objectPoints, const Vector2* imagePoints, const size_t correspondences, const Scalar maximalSqrError, Indices32* validIndices = nullptr, Scalar* sqrErrorSum = nullptr);
+
 		/**
 		 * Determines the unique robust minimal average square error between two 2D points clouds.
 		 * This function calls uniqueAveragedRobustErrorInPointCloud() or ambiguousAveragedRobustErrorInPointCloud() depending on the uniqueCorrespondences parameter.<br>
@@ -622,6 +687,44 @@ class OCEAN_GEOMETRY_EXPORT Error
 		 * @return Averaged robust error
 		 */
 		static inline Scalar averagedRobustError(const Scalar* sqrErrors, const unsigned int* indices, const size_t numberIndices, const Estimator::EstimatorType estimator, const Scalar* explicitWeights = nullptr);
+
+	protected:
+
+		/// The number of correspondences which are processed in one block by the fast paths for contiguous arrays.
+		static constexpr size_t correspondenceBlockSize_ = 64;
+
+		/**
+		 * Determines the square pixel errors for a block of contiguous correspondences, transformation, projection, distortion and error determination are fused into one loop.
+		 * @param flippedCamera_T_world The inverted and flipped camera pose, transforming world to flipped camera, must be valid
+		 * @param pinholeCamera The pinhole camera defining the projection, must be valid
+		 * @param objectPoints The 3D object points defined in world, must be valid
+		 * @param imagePoints The 2D image points, one for each object point, must be valid
+		 * @param number The number of correspondences in the block, with range [1, correspondenceBlockSize_]
+		 * @param sqrErrors The resulting square pixel errors, one for each correspondence, must be valid
+		 * @return The sum of the square pixel errors of the block
+		 * @tparam tDistortImagePoints True, to apply the distortion parameters of the camera
+		 * @tparam tUseBorderDistortionIfOutside True, to apply the camera distortion from the nearest point lying on the frame border if the point lies outside the visible camera area
+		 */
+		template <bool tDistortImagePoints, bool tUseBorderDistortionIfOutside>
+		static inline Scalar determinePoseSqrErrorsBlockIF(const HomogenousMatrix4& flippedCamera_T_world, const PinholeCamera& pinholeCamera, const Vector3* objectPoints, const Vector2* imagePoints, const size_t number, Scalar* sqrErrors);
+
+		/**
+		 * Determines the sum of square pixel errors for contiguous arrays of correspondences with early exit.
+		 * @see determinePoseErrorSumIF().
+		 * @tparam tDistortImagePoints True, to apply the distortion parameters of the camera
+		 * @tparam tUseBorderDistortionIfOutside True, to apply the camera distortion from the nearest point lying on the frame border if the point lies outside the visible camera area
+		 */
+		template <bool tDistortImagePoints, bool tUseBorderDistortionIfOutside>
+		static Scalar determinePoseErrorSumIF(const HomogenousMatrix4& flippedCamera_T_world, const PinholeCamera& pinholeCamera, const Vector3* objectPoints, const Vector2* imagePoints, const size_t correspondences, const Scalar maximalSqrErrorSum, Scalar* sqrErrors);
+
+		/**
+		 * Determines the valid correspondences for contiguous arrays of correspondences.
+		 * @see determineValidCorrespondencesIF().
+		 * @tparam tDistortImagePoints True, to apply the distortion parameters of the camera
+		 * @tparam tUseBorderDistortionIfOutside True, to apply the camera distortion from the nearest point lying on the frame border if the point lies outside the visible camera area
+		 */
+		template <bool tDistortImagePoints, bool tUseBorderDistortionIfOutside>
+		static size_t determineValidCorrespondencesIF(const HomogenousMatrix4& flippedCamera_T_world, const PinholeCamera& pinholeCamera, const Vector3* objectPoints, const Vector2* imagePoints, const size_t correspondences, const Scalar maximalSqrError, Indices32* validIndices, Scalar* sqrErrorSum);
 };
 
 inline Error::ErrorElement::ErrorElement(const unsigned int imageIndex, const unsigned int candidateIndex, const Scalar error) :
@@ -886,25 +989,42 @@ Scalar Error::determinePoseErrorIF(const HomogenousMatrix4& flippedCamera_T_worl
 
 	Scalar sqrAveragePixelError = 0;
 
-	for (size_t n = 0; n < objectPointAccessor.size(); ++n)
-	{
-		const Vector2 imagePoint = anyCamera.projectToImageIF(flippedCamera_T_world, objectPointAccessor[n]);
+	// the object points are projected in small blocks with one (virtual) function call per block, allowing the camera model to project several points at once
 
-		const Vector2& measuredImagePoint = imagePointAccessor[n];
+	constexpr size_t blockSize = 64;
 
-		const Vector2 difference(imagePoint - measuredImagePoint);
-		const Scalar sqrPixelError = difference.sqr();
+	Vector3 objectPoints[blockSize];
+	Vector2 imagePoints[blockSize];
 
-		sqrAveragePixelError += sqrPixelError;
+	for (size_t blockStart = 0; blockStart < objectPointAccessor.size(); blockStart += blockSize)
+	{
+		const size_t blockPoints = std::min(blockSize, objectPointAccessor.size() - blockStart);
 
-		if constexpr (tResultingErrors)
+		for (size_t n = 0; n < blockPoints; ++n)
 		{
-			errors[n] = difference;
+			objectPoints[n] = objectPointAccessor[blockStart + n];
 		}
 
-		if constexpr (tResultingSqrErrors)
+		anyCamera.projectToImageIF(flippedCamera_T_world, objectPoints, blockPoints, imagePoints);
+
+		for (size_t n = 0; n < blockPoints; ++n)
 		{
-			sqrErrors[n] = sqrPixelError;
+			const Vector2& measuredImagePoint = imagePointAccessor[blockStart + n];
+
+			const Vector2 difference(imagePoints[n] - measuredImagePoint);
+			const Scalar sqrPixelError = difference.sqr();
+
+			sqrAveragePixelError += sqrPixelError;
+
+			if constexpr (tResultingErrors)
+			{
+				errors[blockStart + n] = difference;
+			}
+
+			if constexpr (tResultingSqrErrors)
+			{
+				sqrErrors[blockStart + n] = sqrPixelError;
+			}
 		}
 	}
 
@@ -1057,6 +1177,174 @@ void Error::determinePoseErrorIF(const HomogenousMatrix4& flippedCamera_T_world,
 	sqrAveragePixelError /= Scalar(objectPointAccessor.size());
 }
 
+template <bool tUseBorderDistortionIfOutside>
+Scalar Error::determinePoseErrorSumIF(const HomogenousMatrix4& flippedCamera_T_world, const PinholeCamera& pinholeCamera, const Vector3* objectPoints, const Vector2* imagePoints, const size_t correspondences, const bool useDistortionParameters, const Scalar maximalSqrErrorSum, Scalar* sqrErrors)
+{
+	if (useDistortionParameters && pinholeCamera.hasDistortionParameters())
+	{
+		return determinePoseErrorSumIF<true, tUseBorderDistortionIfOutside>(flippedCamera_T_world, pinholeCamera, objectPoints, imagePoints, correspondences, maximalSqrErrorSum, sqrErrors);
+	}
+
+	return determinePoseErrorSumIF<false, tUseBorderDistortionIfOutside>(flippedCamera_T_world, pinholeCamera, objectPoints, imagePoints, correspondences, maximalSqrErrorSum, sqrErrors);
+}
+
+template <bool tUseBorderDistortionIfOutside>
+size_t Error::determineValidCorrespondencesIF(const HomogenousMatrix4& flippedCamera_T_world, const PinholeCamera& pinholeCamera, const Vector3* objectPoints, const Vector2* imagePoints, const size_t correspondences, const bool useDistortionParameters, const Scalar maximalSqrError, Indices32* validIndices, Scalar* sqrErrorSum)
+{
+	if (useDistortionParameters && pinholeCamera.hasDistortionParameters())
+	{
+		return determineValidCorrespondencesIF<true, tUseBorderDistortionIfOutside>(flippedCamera_T_world, pinholeCamera, objectPoints, imagePoints, correspondences, maximalSqrError, validIndices, sqrErrorSum);
+	}
+
+	return determineValidCorrespondencesIF<false, tUseBorderDistortionIfOutside>(flippedCamera_T_world, pinholeCamera, objectPoints, imagePoints, correspondences, maximalSqrError, validIndices, sqrErrorSum);
+}
+
+template <bool tDistortImagePoints, bool tUseBorderDistortionIfOutside>
+Scalar Error::determinePoseErrorSumIF(const HomogenousMatrix4& flippedCamera_T_world, const PinholeCamera& pinholeCamera, const Vector3* objectPoints, const Vector2* imagePoints, const size_t correspondences, const Scalar maximalSqrErrorSum, Scalar* sqrErrors)
+{
+	ocean_assert(flippedCamera_T_world.isValid() && pinholeCamera.isValid());
+	ocean_assert(correspondences == 0 || (objectPoints != nullptr && imagePoints != nullptr));
+	ocean_assert(maximalSqrErrorSum >= 0);
+
+	Scalar blockSqrErrors[correspondenceBlockSize_];
+
+	Scalar sqrErrorSum = 0;
+
+	for (size_t blockStart = 0; blockStart < correspondences; blockStart += correspondenceBlockSize_)
+	{
+		const size_t blockCorrespondences = std::min(correspondenceBlockSize_, correspondences - blockStart);
+
+		Scalar* const targetSqrErrors = sqrErrors != nullptr ? sqrErrors + blockStart : blockSqrErrors;
+
+		sqrErrorSum += determinePoseSqrErrorsBlockIF<tDistortImagePoints, tUseBorderDistortionIfOutside>(flippedCamera_T_world, pinholeCamera, objectPoints + blockStart, imagePoints + blockStart, blockCorrespondences, targetSqrErrors);
+
+		if (sqrErrorSum > maximalSqrErrorSum)
+		{
+			break;
+		}
+	}
+
+	return sqrErrorSum;
+}
+
+template <bool tDistortImagePoints, bool tUseBorderDistortionIfOutside>
+size_t Error::determineValidCorrespondencesIF(const HomogenousMatrix4& flippedCamera_T_world, const PinholeCamera& pinholeCamera, const Vector3* objectPoints, const Vector2* imagePoints, const size_t correspondences, const Scalar maximalSqrError, Indices32* validIndices, Scalar* sqrErrorSum)
+{
+	ocean_assert(flippedCamera_T_world.isValid() && pinholeCamera.isValid());
+	ocean_assert(correspondences == 0 || (objectPoints != nullptr && imagePoints != nullptr));
+	ocean_assert(maximalSqrError >= 0);
+	ocean_assert(NumericT<Index32>::isInsideValueRange(correspondences));
+
+	Scalar blockSqrErrors[correspondenceBlockSize_];
+
+	size_t validCorrespondences = 0;
+	Scalar validSqrErrorSum = 0;
+
+	for (size_t blockStart = 0; blockStart < correspondences; blockStart += correspondenceBlockSize_)
+	{
+		const size_t blockCorrespondences = std::min(correspondenceBlockSize_, correspondences - blockStart);
+
+		determinePoseSqrErrorsBlockIF<tDistortImagePoints, tUseBorderDistortionIfOutside>(flippedCamera_T_world, pinholeCamera, objectPoints + blockStart, imagePoints + blockStart, blockCorrespondences, blockSqrErrors);
+
+		for (size_t n = 0; n < blockCorrespondences; ++n)
+		{
+			if (blockSqrErrors[n] <= maximalSqrError)
+			{
+				++validCorrespondences;
+				validSqrErrorSum += blockSqrErrors[n];
+
+				if (validIndices != nullptr)
+				{
+					validIndices->emplace_back(Index32(blockStart + n));
+				}
+			}
+		}
+	}
+
+	if (sqrErrorSum != nullptr)
+	{
+		*sqrErrorSum = validSqrErrorSum;
+	}
+
+	return validCorrespondences;
+}
+
+template <bool tDistortImagePoints, bool tUseBorderDistortionIfOutside>
+inline Scalar Error::determinePoseSqrErrorsBlockIF(const HomogenousMatrix4& flippedCamera_T_world, const PinholeCamera& pinholeCamera, const Vector3* objectPoints, const Vector2* imagePoints, const size_t number, Scalar* sqrErrors)
+{
+	ocean_assert(objectPoints != nullptr && imagePoints != nullptr && sqrErrors != nullptr);
+	ocean_assert(number >= 1 && number <= correspondenceBlockSize_);
+
+	// the loop does not contain any branches so that the compiler can vectorize the entire pipeline
+
+	const Scalar* const m = flippedCamera_T_world.data();
+
+	const Scalar focalLengthX = pinholeCamera.focalLengthX();
+	const Scalar focalLengthY = pinholeCamera.focalLengthY();
+	const Scalar principalPointX = pinholeCamera.principalPointX();
+	const Scalar principalPointY = pinholeCamera.principalPointY();
+
+	const Scalar k1 = pinholeCamera.radialDistortion().first;
+	const Scalar k2 = pinholeCamera.radialDistortion().second;
+	const Scalar p1 = pinholeCamera.tangentialDistortion().first;
+	const Scalar p2 = pinholeCamera.tangentialDistortion().second;
+
+	const Scalar minimalNormalizedX = -principalPointX * pinholeCamera.inverseFocalLengthX();
+	const Scalar maximalNormalizedX = (Scalar(pinholeCamera.width()) - principalPointX) * pinholeCamera.inverseFocalLengthX();
+	const Scalar minimalNormalizedY = -principalPointY * pinholeCamera.inverseFocalLengthY();
+	const Scalar maximalNormalizedY = (Scalar(pinholeCamera.height()) - principalPointY) * pinholeCamera.inverseFocalLengthY();
+
+	for (size_t n = 0; n < number; ++n)
+	{
+		const Vector3& objectPoint = objectPoints[n];
+
+		const Scalar x = m[0] * objectPoint.x() + m[4] * objectPoint.y() + m[8] * objectPoint.z() + m[12];
+		const Scalar y = m[1] * objectPoint.x() + m[5] * objectPoint.y() + m[9] * objectPoint.z() + m[13];
+		const Scalar z = m[2] * objectPoint.x() + m[6] * objectPoint.y() + m[10] * objectPoint.z() + m[14];
+
+		ocean_assert(Numeric::isNotEqualEps(z));
+		const Scalar invZ = Scalar(1) / z;
+
+		Scalar normalizedX = x * invZ;
+		Scalar normalizedY = y * invZ;
+
+		if constexpr (tDistortImagePoints)
+		{
+			Scalar distortionX = normalizedX;
+			Scalar distortionY = normalizedY;
+
+			if constexpr (tUseBorderDistortionIfOutside)
+			{
+				distortionX = std::min(std::max(distortionX, minimalNormalizedX), maximalNormalizedX);
+				distortionY = std::min(std::max(distortionY, minimalNormalizedY), maximalNormalizedY);
+			}
+
+			const Scalar sqr = distortionX * distortionX + distortionY * distortionY;
+			const Scalar radialDistortionFactor = Scalar(1) + k1 * sqr + k2 * sqr * sqr;
+
+			const Scalar tangentialDistortionCorrectionX = p1 * 2 * distortionX * distortionY + p2 * (sqr + 2 * distortionX * distortionX);
+			const Scalar tangentialDistortionCorrectionY = p1 * (sqr + 2 * distortionY * distortionY) + p2 * 2 * distortionX * distortionY;
+
+			normalizedX = normalizedX * radialDistortionFactor + tangentialDistortionCorrectionX;
+			normalizedY = normalizedY * radialDistortionFactor + tangentialDistortionCorrectionY;
+		}
+
+		const Scalar errorX = normalizedX * focalLengthX + principalPointX - imagePoints[n].x();
+		const Scalar errorY = normalizedY * focalLengthY + principalPointY - imagePoints[n].y();
+
+		sqrErrors[n] = errorX * errorX + errorY * errorY;
+	}
+
+	Scalar sqrErrorSum = 0;
+
+	for (size_t n = 0; n < number; ++n)
+	{
+		sqrErrorSum += sqrErrors[n];
+	}
+
+	return sqrErrorSum;
+}
+
 template <Estimator::EstimatorType tEstimator>
 Scalar Error::averagedRobustErrorInPointCloud(const Vector2* imagePoints, const size_t numberImagePoints, const size_t validImagePoints, const Vector2* candidatePoints, const size_t numberCandidatePoints, const ErrorDetermination errorDetermination, IndexPairs32* correspondences)
 {
@@ -2055,6 +2055,741 @@ SquareMatrix3 Homography::toCoarseHomography(const SquareMatrix3& finestHomograp
 	}
 }
 
+template <typename T>
+bool Homography::homographyMatrixFromFourPoints(const VectorT2<T>* leftPoints, const VectorT2<T>* rightPoints, SquareMatrixT3<T>& right_H_left)
+{
+	ocean_assert(leftPoints != nullptr && rightPoints != nullptr);
+
+	// the homography mapping the canonical projective basis (e0, e1, e2, e0 + e1 + e2) onto four points q0, q1, q2, q3 is given by
+	// B = M * diag(lambda), with M = [q0 q1 q2] and lambda = M^-1 * q3
+	//
+	// therefore, right_H_left ~ B_right * B_left^-1 ~ M_right * diag(mu_right / mu_left) * adj(M_left), with mu = adj(M) * q3
+
+	VectorT2<T> leftMean;
+	VectorT2<T> rightMean;
+	T leftScale;
+	T rightScale;
+
+	determineNormalization(leftPoints, 4, leftMean, leftScale);
+	determineNormalization(rightPoints, 4, rightMean, rightScale);
+
+	VectorT3<T> left[4];
+	VectorT3<T> right[4];
+
+	for (unsigned int n = 0u; n < 4u; ++n)
+	{
+		left[n] = VectorT3<T>((leftPoints[n] - leftMean) * leftScale, T(1));
+		right[n] = VectorT3<T>((rightPoints[n] - rightMean) * rightScale, T(1));
+	}
+
+	const VectorT3<T> leftAdjugate[3] = {left[1].cross(left[2]), left[2].cross(left[0]), left[0].cross(left[1])};
+	const VectorT3<T> rightAdjugate[3] = {right[1].cross(right[2]), right[2].cross(right[0]), right[0].cross(right[1])};
+
+	if (NumericT<T>::isEqualEps(left[0] * leftAdjugate[0]) || NumericT<T>::isEqualEps(right[0] * rightAdjugate[0]))
+	{
+		// the first three points are collinear
+		return false;
+	}
+
+	T weights[3];
+
+	for (unsigned int n = 0u; n < 3u; ++n)
+	{
+		const T leftMu = leftAdjugate[n] * left[3];
+		const T rightMu = rightAdjugate[n] * right[3];
+
+		if (NumericT<T>::isEqualEps(leftMu) || NumericT<T>::isEqualEps(rightMu))
+		{
+			// three points including the fourth point are collinear
+			return false;
+		}
+
+		weights[n] = rightMu / leftMu;
+	}
+
+	SquareMatrixT3<T> normalizedRight_H_normalizedLeft;
+
+	for (unsigned int r = 0u; r < 3u; ++r)
+	{
+		for (unsigned int c = 0u; c < 3u; ++c)
+		{
+			normalizedRight_H_normalizedLeft(r, c) = weights[0] * right[0][r] * leftAdjugate[0][c] + weights[1] * right[1][r] * leftAdjugate[1][c] + weights[2] * right[2][r] * leftAdjugate[2][c];
+		}
+	}
+
+	const SquareMatrixT3<T> normalizedLeft_T_left(VectorT3<T>(leftScale, 0, 0), VectorT3<T>(0, leftScale, 0), VectorT3<T>(-leftMean.x() * leftScale, -leftMean.y() * leftScale, 1));
+	const SquareMatrixT3<T> right_T_normalizedRight(VectorT3<T>(T(1) / rightScale, 0, 0), VectorT3<T>(0, T(1) / rightScale, 0), VectorT3<T>(rightMean.x(), rightMean.y(), 1));
+
+	right_H_left = right_T_normalizedRight * normalizedRight_H_normalizedLeft * normalizedLeft_T_left;
+
+	if (NumericT<T>::isEqualEps(right_H_left[8]))
+	{
+		return false;
+	}
+
+	Normalization::normalizeTransformation(right_H_left);
+
+	return right_H_left.isHomography();
+}
+
+template <typename T, size_t tBatchSize>
+unsigned int Homography::homographyMatricesFromFourPointsBatch(const VectorT2<T>* leftPoints, const VectorT2<T>* rightPoints, SquareMatrixT3<T>* right_H_lefts, bool* validHomographies)
+{
+	static_assert(tBatchSize >= 1, "Invalid batch size!");
+
+	ocean_assert(leftPoints != nullptr && rightPoints != nullptr);
+	ocean_assert(right_H_lefts != nullptr && validHomographies != nullptr);
+
+	// the same closed-form solution as in homographyMatrixFromFourPoints(), with each step applied to all lanes of the batch
+
+	T means[2][2][tBatchSize];
+	T scales[2][tBatchSize];
+
+	// normalized points, [left/right][point][x/y][lane]
+	T points[2][4][2][tBatchSize];
+
+	for (unsigned int side = 0u; side < 2u; ++side)
+	{
+		const VectorT2<T>* const sidePoints = side == 0u ? leftPoints : rightPoints;
+
+		for (size_t i = 0; i < tBatchSize; ++i)
+		{
+			for (unsigned int n = 0u; n < 4u; ++n)
+			{
+				points[side][n][0][i] = sidePoints[i * 4 + n].x();
+				points[side][n][1][i] = sidePoints[i * 4 + n].y();
+			}
+		}
+
+		for (size_t i = 0; i < tBatchSize; ++i)
+		{
+			means[side][0][i] = (points[side][0][0][i] + points[side][1][0][i] + points[side][2][0][i] + points[side][3][0][i]) * T(0.25);
+			means[side][1][i] = (points[side][0][1][i] + points[side][1][1][i] + points[side][2][1][i] + points[side][3][1][i]) * T(0.25);
+		}
+
+		for (size_t i = 0; i < tBatchSize; ++i)
+		{
+			T sqrDistances = T(0);
+
+			for (unsigned int n = 0u; n < 4u; ++n)
+			{
+				points[side][n][0][i] -= means[side][0][i];
+				points[side][n][1][i] -= means[side][1][i];
+
+				sqrDistances += points[side][n][0][i] * points[side][n][0][i] + points[side][n][1][i] * points[side][n][1][i];
+			}
+
+			const T invScale = NumericT<T>::sqrt(sqrDistances * T(0.125));
+
+			scales[side][i] = invScale > NumericT<T>::eps() ? T(1) / invScale : T(1);
+		}
+
+		for (size_t i = 0; i < tBatchSize; ++i)
+		{
+			for (unsigned int n = 0u; n < 4u; ++n)
+			{
+				points[side][n][0][i] *= scales[side][i];
+				points[side][n][1][i] *= scales[side][i];
+			}
+		}
+	}
+
+	// rows of the adjugate matrices of [q0 q1 q2], [left/right][row][element][lane], with q = (x, y, 1)
+
+	T adjugates[2][3][3][tBatchSize];
+
+	for (unsigned int side = 0u; side < 2u; ++side)
+	{
+		for (unsigned int n = 0u; n < 3u; ++n)
+		{
+			const T (&a)[2][tBatchSize] = points[side][(n + 1u) % 3u];
+			const T (&b)[2][tBatchSize] = points[side][(n + 2u) % 3u];
+
+			for (size_t i = 0; i < tBatchSize; ++i)
+			{
+				adjugates[side][n][0][i] = a[1][i] - b[1][i];
+				adjugates[side][n][1][i] = b[0][i] - a[0][i];
+				adjugates[side][n][2][i] = a[0][i] * b[1][i] - a[1][i] * b[0][i];
+			}
+		}
+	}
+
+	bool validSamples[tBatchSize];
+	T weights[3][tBatchSize];
+
+	for (size_t i = 0; i < tBatchSize; ++i)
+	{
+		T minAbsValue = NumericT<T>::maxValue();
+
+		for (unsigned int side = 0u; side < 2u; ++side)
+		{
+			const T determinant = points[side][0][0][i] * adjugates[side][0][0][i] + points[side][0][1][i] * adjugates[side][0][1][i] + adjugates[side][0][2][i];
+
+			minAbsValue = std::min(minAbsValue, NumericT<T>::abs(determinant));
+		}
+
+		T mus[2][3];
+
+		for (unsigned int side = 0u; side < 2u; ++side)
+		{
+			for (unsigned int n = 0u; n < 3u; ++n)
+			{
+				mus[side][n] = points[side][3][0][i] * adjugates[side][n][0][i] + points[side][3][1][i] * adjugates[side][n][1][i] + adjugates[side][n][2][i];
+
+				minAbsValue = std::min(minAbsValue, NumericT<T>::abs(mus[side][n]));
+			}
+		}
+
+		validSamples[i] = minAbsValue > NumericT<T>::eps();
+
+		for (unsigned int n = 0u; n < 3u; ++n)
+		{
+			weights[n][i] = validSamples[i] ? mus[1][n] / mus[0][n] : T(0);
+		}
+	}
+
+	T normalizedHomographies[9][tBatchSize];
+
+	for (unsigned int r = 0u; r < 3u; ++r)
+	{
+		for (unsigned int c = 0u; c < 3u; ++c)
+		{
+			for (size_t i = 0; i < tBatchSize; ++i)
+			{
+				T value = T(0);
+
+				for (unsigned int n = 0u; n < 3u; ++n)
+				{
+					const T rightValue = r < 2u ? points[1][n][r][i] : T(1);
+
+					value += weights[n][i] * rightValue * adjugates[0][n][c][i];
+				}
+
+				normalizedHomographies[r * 3u + c][i] = value;
+			}
+		}
+	}
+
+	return denormalizeHomographiesBatch<T, tBatchSize>(normalizedHomographies, means[0], scales[0], means[1], scales[1], validSamples, right_H_lefts, validHomographies);
+}
+
+template <typename T>
+bool Homography::homographyMatrixDLT(const VectorT2<T>* leftPoints, const VectorT2<T>* rightPoints, const size_t correspondences, SquareMatrixT3<T>& right_H_left)
+{
+	ocean_assert(leftPoints != nullptr && rightPoints != nullptr);
+	ocean_assert(correspondences >= 4);
+
+	if (correspondences < 4)
+	{
+		return false;
+	}
+
+	VectorT2<T> leftMean;
+	VectorT2<T> rightMean;
+	T leftScale;
+	T rightScale;
+
+	determineNormalization(leftPoints, correspondences, leftMean, leftScale);
+	determineNormalization(rightPoints, correspondences, rightMean, rightScale);
+
+	// each correspondence provides two rows of the linear system A * h = 0 (see homographyMatrixSVD()),
+	// the rows are accumulated in the upper triangular matrix R of A = Q * R so that A and R share the same right singular vectors
+
+	T triangular[9][9] = {};
+
+	for (size_t n = 0; n < correspondences; ++n)
+	{
+		const VectorT2<T> left((leftPoints[n] - leftMean) * leftScale);
+		const VectorT2<T> right((rightPoints[n] - rightMean) * rightScale);
+
+		T row0[9] = {left.x(), left.y(), T(1), T(0), T(0), T(0), -right.x() * left.x(), -right.x() * left.y(), -right.x()};
+		addGivensRow(triangular, row0);
+
+		T row1[9] = {T(0), T(0), T(0), left.x(), left.y(), T(1), -right.y() * left.x(), -right.y() * left.y(), -right.y()};
+		addGivensRow(triangular, row1);
+	}
+
+	T h[9];
+	jacobiNullVector(triangular, h);
+
+	const SquareMatrixT3<T> normalizedRight_H_normalizedLeft(h, true);
+
+	const SquareMatrixT3<T> normalizedLeft_T_left(VectorT3<T>(leftScale, 0, 0), VectorT3<T>(0, leftScale, 0), VectorT3<T>(-leftMean.x() * leftScale, -leftMean.y() * leftScale, 1));
+	const SquareMatrixT3<T> right_T_normalizedRight(VectorT3<T>(T(1) / rightScale, 0, 0), VectorT3<T>(0, T(1) / rightScale, 0), VectorT3<T>(rightMean.x(), rightMean.y(), 1));
+
+	right_H_left = right_T_normalizedRight * normalizedRight_H_normalizedLeft * normalizedLeft_T_left;
+
+	if (NumericT<T>::isEqualEps(right_H_left[8]))
+	{
+		return false;
+	}
+
+	Normalization::normalizeTransformation(right_H_left);
+
+	return right_H_left.isHomography();
+}
+
+template <typename T, size_t tBatchSize>
+unsigned int Homography::homographyMatricesDLTBatch(const VectorT2<T>* leftPoints, const VectorT2<T>* rightPoints, const size_t correspondences, SquareMatrixT3<T>* right_H_lefts, bool* validHomographies)
+{
+	static_assert(tBatchSize >= 1, "Invalid batch size!");
+
+	ocean_assert(leftPoints != nullptr && rightPoints != nullptr);
+	ocean_assert(right_H_lefts != nullptr && validHomographies != nullptr);
+	ocean_assert(correspondences >= 4);
+
+	if (correspondences < 4)
+	{
+		for (size_t i = 0; i < tBatchSize; ++i)
+		{
+			right_H_lefts[i] = SquareMatrixT3<T>(false);
+			validHomographies[i] = false;
+		}
+
+		return 0u;
+	}
+
+	T means[2][2][tBatchSize];
+	T scales[2][tBatchSize];
+
+	for (unsigned int side = 0u; side < 2u; ++side)
+	{
+		const VectorT2<T>* const sidePoints = side == 0u ? leftPoints : rightPoints;
+
+		for (size_t i = 0; i < tBatchSize; ++i)
+		{
+			VectorT2<T> mean;
+			determineNormalization(sidePoints + i * correspondences, correspondences, mean, scales[side][i]);
+
+			means[side][0][i] = mean.x();
+			means[side][1][i] = mean.y();
+		}
+	}
+
+	// the upper triangular matrices of the incremental QR decompositions, [row][column][lane]
+
+	T triangular[9][9][tBatchSize] = {};
+
+	for (size_t n = 0; n < correspondences; ++n)
+	{
+		T rows[2][9][tBatchSize];
+
+		for (size_t i = 0; i < tBatchSize; ++i)
+		{
+			const T leftX = (leftPoints[i * correspondences + n].x() - means[0][0][i]) * scales[0][i];
+			const T leftY = (leftPoints[i * correspondences + n].y() - means[0][1][i]) * scales[0][i];
+			const T rightX = (rightPoints[i * correspondences + n].x() - means[1][0][i]) * scales[1][i];
+			const T rightY = (rightPoints[i * correspondences + n].y() - means[1][1][i]) * scales[1][i];
+
+			rows[0][0][i] = leftX;
+			rows[0][1][i] = leftY;
+			rows[0][2][i] = T(1);
+			rows[0][3][i] = T(0);
+			rows[0][4][i] = T(0);
+			rows[0][5][i] = T(0);
+			rows[0][6][i] = -rightX * leftX;
+			rows[0][7][i] = -rightX * leftY;
+			rows[0][8][i] = -rightX;
+
+			rows[1][0][i] = T(0);
+			rows[1][1][i] = T(0);
+			rows[1][2][i] = T(0);
+			rows[1][3][i] = leftX;
+			rows[1][4][i] = leftY;
+			rows[1][5][i] = T(1);
+			rows[1][6][i] = -rightY * leftX;
+			rows[1][7][i] = -rightY * leftY;
+			rows[1][8][i] = -rightY;
+		}
+
+		for (unsigned int r = 0u; r < 2u; ++r)
+		{
+			// zero elements of a row result in trivial rotations, so that all elements are processed without any branch
+
+			for (unsigned int k = 0u; k < 9u; ++k)
+			{
+
+				T cosValues[tBatchSize];
+				T sinValues[tBatchSize];
+
+				for (size_t i = 0; i < tBatchSize; ++i)
+				{
+					const T radius = NumericT<T>::sqrt(triangular[k][k][i] * triangular[k][k][i] + rows[r][k][i] * rows[r][k][i]);
+					const bool rotate = radius > T(0);
+
+					const T invRadius = rotate ? T(1) / radius : T(0);
+
+					cosValues[i] = rotate ? triangular[k][k][i] * invRadius : T(1);
+					sinValues[i] = rows[r][k][i] * invRadius;
+				}
+
+				for (unsigned int j = k; j < 9u; ++j)
+				{
+					for (size_t i = 0; i < tBatchSize; ++i)
+					{
+						const T upper = triangular[k][j][i];
+
+						triangular[k][j][i] = cosValues[i] * upper + sinValues[i] * rows[r][j][i];
+						rows[r][j][i] = cosValues[i] * rows[r][j][i] - sinValues[i] * upper;
+					}
+				}
+			}
+		}
+	}
+
+	// cyclic one-sided Jacobi decomposition of all triangular matrices, lanes which have converged apply identity rotations
+
+	T vMatrices[9][9][tBatchSize];
+
+	for (unsigned int r = 0u; r < 9u; ++r)
+	{
+		for (unsigned int c = 0u; c < 9u; ++c)
+		{
+			for (size_t i = 0; i < tBatchSize; ++i)
+			{
+				vMatrices[r][c][i] = r == c ? T(1) : T(0);
+			}
+		}
+	}
+
+	T sqrFrobeniusNorms[tBatchSize] = {};
+
+	for (unsigned int r = 0u; r < 9u; ++r)
+	{
+		for (unsigned int c = 0u; c < 9u; ++c)
+		{
+			for (size_t i = 0; i < tBatchSize; ++i)
+			{
+				sqrFrobeniusNorms[i] += triangular[r][c][i] * triangular[r][c][i];
+			}
+		}
+	}
+
+	constexpr unsigned int maximalSweeps = 30u;
+
+	for (unsigned int sweep = 0u; sweep < maximalSweeps; ++sweep)
+	{
+		bool anyRotation = false;
+
+		for (unsigned int p = 0u; p < 8u; ++p)
+		{
+			for (unsigned int q = p + 1u; q < 9u; ++q)
+			{
+				T alphas[tBatchSize] = {};
+				T betas[tBatchSize] = {};
+				T gammas[tBatchSize] = {};
+
+				for (unsigned int r = 0u; r < 9u; ++r)
+				{
+					for (size_t i = 0; i < tBatchSize; ++i)
+					{
+						alphas[i] += triangular[r][p][i] * triangular[r][p][i];
+						betas[i] += triangular[r][q][i] * triangular[r][q][i];
+						gammas[i] += triangular[r][p][i] * triangular[r][q][i];
+					}
+				}
+
+				T cosValues[tBatchSize];
+				T sinValues[tBatchSize];
+
+				bool pairRotation = false;
+
+				for (size_t i = 0; i < tBatchSize; ++i)
+				{
+					const bool rotate = NumericT<T>::abs(gammas[i]) > NumericT<T>::eps() * std::max(NumericT<T>::sqrt(alphas[i] * betas[i]), sqrFrobeniusNorms[i]);
+					pairRotation = pairRotation || rotate;
+
+					const T zeta = (betas[i] - alphas[i]) / (T(2) * (rotate ? gammas[i] : T(1)));
+					const T tangent = (zeta >= T(0) ? T(1) : T(-1)) / (NumericT<T>::abs(zeta) + NumericT<T>::sqrt(T(1) + zeta * zeta));
+					const T cosValue = T(1) / NumericT<T>::sqrt(T(1) + tangent * tangent);
+
+					cosValues[i] = rotate ? cosValue : T(1);
+					sinValues[i] = rotate ? cosValue * tangent : T(0);
+				}
+
+				if (!pairRotation)
+				{
+					continue;
+				}
+
+				anyRotation = true;
+
+				for (unsigned int r = 0u; r < 9u; ++r)
+				{
+					for (size_t i = 0; i < tBatchSize; ++i)
+					{
+						const T valueP = triangular[r][p][i];
+						const T valueQ = triangular[r][q][i];
+
+						triangular[r][p][i] = cosValues[i] * valueP - sinValues[i] * valueQ;
+						triangular[r][q][i] = sinValues[i] * valueP + cosValues[i] * valueQ;
+					}
+
+					for (size_t i = 0; i < tBatchSize; ++i)
+					{
+						const T valueP = vMatrices[r][p][i];
+						const T valueQ = vMatrices[r][q][i];
+
+						vMatrices[r][p][i] = cosValues[i] * valueP - sinValues[i] * valueQ;
+						vMatrices[r][q][i] = sinValues[i] * valueP + cosValues[i] * valueQ;
+					}
+				}
+			}
+		}
+
+		if (!anyRotation)
+		{
+			break;
+		}
+	}
+
+	// the null vector is the column of V belonging to the column of the orthogonalized matrix with smallest norm
+
+	T minSqrNorms[tBatchSize];
+	unsigned int minColumns[tBatchSize];
+
+	for (size_t i = 0; i < tBatchSize; ++i)
+	{
+		minSqrNorms[i] = NumericT<T>::maxValue();
+		minColumns[i] = 0u;
+	}
+
+	for (unsigned int c = 0u; c < 9u; ++c)
+	{
+		for (size_t i = 0; i < tBatchSize; ++i)
+		{
+			T sqrNorm = T(0);
+
+			for (unsigned int r = 0u; r < 9u; ++r)
+			{
+				sqrNorm += triangular[r][c][i] * triangular[r][c][i];
+			}
+
+			const bool smaller = sqrNorm < minSqrNorms[i];
+
+			minSqrNorms[i] = smaller ? sqrNorm : minSqrNorms[i];
+			minColumns[i] = smaller ? c : minColumns[i];
+		}
+	}
+
+	T normalizedHomographies[9][tBatchSize];
+	bool validSamples[tBatchSize];
+
+	for (size_t i = 0; i < tBatchSize; ++i)
+	{
+		for (unsigned int r = 0u; r < 9u; ++r)
+		{
+			normalizedHomographies[r][i] = vMatrices[r][minColumns[i]][i];
+		}
+
+		validSamples[i] = true;
+	}
+
+	return denormalizeHomographiesBatch<T, tBatchSize>(normalizedHomographies, means[0], scales[0], means[1], scales[1], validSamples, right_H_lefts, validHomographies);
+}
+
+template <typename T>
+void Homography::jacobiNullVector(T matrix[9][9], T nullVector[9])
+{
+	ocean_assert(matrix != nullptr && nullVector != nullptr);
+
+	T vMatrix[9][9];
+
+	for (unsigned int r = 0u; r < 9u; ++r)
+	{
+		for (unsigned int c = 0u; c < 9u; ++c)
+		{
+			vMatrix[r][c] = r == c ? T(1) : T(0);
+		}
+	}
+
+	// the columns of the matrix are rotated pairwise until they are orthogonal, the accumulated rotations are the right singular vectors
+	// the convergence is also measured relative to the norm of the entire matrix, as the column of the null vector has an almost zero norm
+
+	T sqrFrobeniusNorm = T(0);
+
+	for (unsigned int r = 0u; r < 9u; ++r)
+	{
+		for (unsigned int c = 0u; c < 9u; ++c)
+		{
+			sqrFrobeniusNorm += matrix[r][c] * matrix[r][c];
+		}
+	}
+
+	constexpr unsigned int maximalSweeps = 30u;
+
+	for (unsigned int sweep = 0u; sweep < maximalSweeps; ++sweep)
+	{
+		bool rotated = false;
+
+		for (unsigned int p = 0u; p < 8u; ++p)
+		{
+			for (unsigned int q = p + 1u; q < 9u; ++q)
+			{
+				T alpha = T(0);
+				T beta = T(0);
+				T gamma = T(0);
+
+				for (unsigned int r = 0u; r < 9u; ++r)
+				{
+					alpha += matrix[r][p] * matrix[r][p];
+					beta += matrix[r][q] * matrix[r][q];
+					gamma += matrix[r][p] * matrix[r][q];
+				}
+
+				if (NumericT<T>::abs(gamma) <= NumericT<T>::eps() * std::max(NumericT<T>::sqrt(alpha * beta), sqrFrobeniusNorm))
+				{
+					continue;
+				}
+
+				rotated = true;
+
+				const T zeta = (beta - alpha) / (T(2) * gamma);
+				const T tangent = (zeta >= T(0) ? T(1) : T(-1)) / (NumericT<T>::abs(zeta) + NumericT<T>::sqrt(T(1) + zeta * zeta));
+				const T cosValue = T(1) / NumericT<T>::sqrt(T(1) + tangent * tangent);
+				const T sinValue = cosValue * tangent;
+
+				for (unsigned int r = 0u; r < 9u; ++r)
+				{
+					const T matrixP = matrix[r][p];
+					const T matrixQ = matrix[r][q];
+
+					matrix[r][p] = cosValue * matrixP - sinValue * matrixQ;
+					matrix[r][q] = sinValue * matrixP + cosValue * matrixQ;
+
+					const T vP = vMatrix[r][p];
+					const T vQ = vMatrix[r][q];
+
+					vMatrix[r][p] = cosValue * vP - sinValue * vQ;
+					vMatrix[r][q] = sinValue * vP + cosValue * vQ;
+				}
+			}
+		}
+
+		if (!rotated)
+		{
+			break;
+		}
+	}
+
+	unsigned int minColumn = 0u;
+	T minSqrNorm = NumericT<T>::maxValue();
+
+	for (unsigned int c = 0u; c < 9u; ++c)
+	{
+		T sqrNorm = T(0);
+
+		for (unsigned int r = 0u; r < 9u; ++r)
+		{
+			sqrNorm += matrix[r][c] * matrix[r][c];
+		}
+
+		if (sqrNorm < minSqrNorm)
+		{
+			minSqrNorm = sqrNorm;
+			minColumn = c;
+		}
+	}
+
+	for (unsigned int r = 0u; r < 9u; ++r)
+	{
+		nullVector[r] = vMatrix[r][minColumn];
+	}
+}
+
+template <typename T, size_t tBatchSize>
+unsigned int Homography::denormalizeHomographiesBatch(const T normalizedHomographies[9][tBatchSize], const T leftMeans[2][tBatchSize], const T leftScales[tBatchSize], const T rightMeans[2][tBatchSize], const T rightScales[tBatchSize], const bool validSamples[tBatchSize], SquareMatrixT3<T>* right_H_lefts, bool* validHomographies)
+{
+	ocean_assert(right_H_lefts != nullptr && validHomographies != nullptr);
+
+	// right_H_left = right_T_normalizedRight * normalizedRight_H_normalizedLeft * normalizedLeft_T_left
+
+	T homographies[9][tBatchSize];
+
+	for (size_t i = 0; i < tBatchSize; ++i)
+	{
+		// A = normalizedRight_H_normalizedLeft * normalizedLeft_T_left
+
+		T a[9];
+
+		for (unsigned int r = 0u; r < 3u; ++r)
+		{
+			const T h0 = normalizedHomographies[r * 3u + 0u][i];
+			const T h1 = normalizedHomographies[r * 3u + 1u][i];
+			const T h2 = normalizedHomographies[r * 3u + 2u][i];
+
+			a[r * 3u + 0u] = h0 * leftScales[i];
+			a[r * 3u + 1u] = h1 * leftScales[i];
+			a[r * 3u + 2u] = h2 - (h0 * leftMeans[0][i] + h1 * leftMeans[1][i]) * leftScales[i];
+		}
+
+		const T invRightScale = T(1) / rightScales[i];
+
+		for (unsigned int c = 0u; c < 3u; ++c)
+		{
+			homographies[0u + c][i] = a[0u + c] * invRightScale + rightMeans[0][i] * a[6u + c];
+			homographies[3u + c][i] = a[3u + c] * invRightScale + rightMeans[1][i] * a[6u + c];
+			homographies[6u + c][i] = a[6u + c];
+		}
+	}
+
+	bool validLanes[tBatchSize];
+
+	for (size_t i = 0; i < tBatchSize; ++i)
+	{
+		validLanes[i] = validSamples[i] && NumericT<T>::abs(homographies[8][i]) > NumericT<T>::eps();
+
+		const T normalization = validLanes[i] ? T(1) / homographies[8][i] : T(0);
+
+		for (unsigned int n = 0u; n < 9u; ++n)
+		{
+			homographies[n][i] *= normalization;
+		}
+	}
+
+	unsigned int validCounter = 0u;
+
+	for (size_t i = 0; i < tBatchSize; ++i)
+	{
+		T values[9];
+
+		for (unsigned int n = 0u; n < 9u; ++n)
+		{
+			values[n] = homographies[n][i];
+		}
+
+		right_H_lefts[i] = SquareMatrixT3<T>(values, true);
+		validHomographies[i] = validLanes[i] && right_H_lefts[i].isHomography();
+
+		if (validHomographies[i])
+		{
+			++validCounter;
+		}
+		else
+		{
+			right_H_lefts[i] = SquareMatrixT3<T>(false);
+		}
+	}
+
+	return validCounter;
+}
+
+template bool OCEAN_GEOMETRY_EXPORT Homography::homographyMatrixFromFourPoints<float>(const VectorT2<float>*, const VectorT2<float>*, SquareMatrixT3<float>&);
+template bool OCEAN_GEOMETRY_EXPORT Homography::homographyMatrixFromFourPoints<double>(const VectorT2<double>*, const VectorT2<double>*, SquareMatrixT3<double>&);
+
+template unsigned int OCEAN_GEOMETRY_EXPORT Homography::homographyMatricesFromFourPointsBatch<float, 4>(const VectorT2<float>*, const VectorT2<float>*, SquareMatrixT3<float>*, bool*);
+template unsigned int OCEAN_GEOMETRY_EXPORT Homography::homographyMatricesFromFourPointsBatch<float, 8>(const VectorT2<float>*, const VectorT2<float>*, SquareMatrixT3<float>*, bool*);
+template unsigned int OCEAN_GEOMETRY_EXPORT Homography::homographyMatricesFromFourPointsBatch<double, 4>(const VectorT2<double>*, const VectorT2<double>*, SquareMatrixT3<double>*, bool*);
+template unsigned int OCEAN_GEOMETRY_EXPORT Homography::homographyMatricesFromFourPointsBatch<double, 8>(const VectorT2<double>*, const VectorT2<double>*, SquareMatrixT3<double>*, bool*);
+
+template bool OCEAN_GEOMETRY_EXPORT Homography::homographyMatrixDLT<float>(const VectorT2<float>*, const VectorT2<float>*, const size_t, SquareMatrixT3<float>&);
+template bool OCEAN_GEOMETRY_EXPORT Homography::homographyMatrixDLT<double>(const VectorT2<double>*, const VectorT2<double>*, const size_t, SquareMatrixT3<double>&);
+
+template unsigned int OCEAN_GEOMETRY_EXPORT Homography::homographyMatricesDLTBatch<float, 4>(const VectorT2<float>*, const VectorT2<float>*, const size_t, SquareMatrixT3<float>*, bool*);
+template unsigned int OCEAN_GEOMETRY_EXPORT Homography::homographyMatricesDLTBatch<float, 8>(const VectorT2<float>*, const VectorT2<float>*, const size_t, SquareMatrixT3<float>*, bool*);
+template unsigned int OCEAN_GEOMETRY_EXPORT Homography::homographyMatricesDLTBatch<double, 4>(const VectorT2<double>*, const VectorT2<double>*, const size_t, SquareMatrixT3<double>*, bool*);
+template unsigned int OCEAN_GEOMETRY_EXPORT Homography::homographyMatricesDLTBatch<double, 8>(const VectorT2<double>*, const VectorT2<double>*, const size_t, SquareMatrixT3<double>*, bool*);
+
 }
 
 }
@@ -206,6 +206,69 @@ class OCEAN_GEOMETRY_EXPORT Homography
 		 */
 		static bool homographyMatrixLinearWithoutOptimations(const Vector2* leftPoints, const Vector2* rightPoints, const size_t correspondences, SquareMatrix3& right_H_left);
 
+		/**
+		 * Calculates the homography (8DOF - translation, rotation, scale, aspect ratio, shear, perspective) between two images from exactly four point correspondences.
+		 * This function applies a closed-form solution mapping both point quadruples onto the canonical projective basis, no linear system is solved and no memory is allocated.<br>
+		 * The points are normalized internally so that the solution is independent of the pixel scale of the input points.<br>
+		 * The resulting homography transforms image points defined in the left image to image points defined in the right image (rightPoint = H * leftPoint).
+		 * @param leftPoints The four image points in the left image, no three points may be collinear, must be valid
+		 * @param rightPoints The four image points in the right image, one for each point in the left image, no three points may be collinear, must be valid
+		 * @param right_H_left The resulting homography transforming left to right image points (rightPoint = right_H_left * leftPoint)
+		 * @return True, if succeeded; False, if the point configuration is degenerate
+		 * @tparam T The data type of the scalar to be used, either 'float' or 'double'
+		 * @see homographyMatricesFromFourPointsBatch(), homographyMatrixDLT().
+		 */
+		template <typename T>
+		static bool homographyMatrixFromFourPoints(const VectorT2<T>* leftPoints, const VectorT2<T>* rightPoints, SquareMatrixT3<T>& right_H_left);
+
+		/**
+		 * Calculates several homographies from independent samples with exactly four point correspondences each.
+		 * The samples are processed lane-wise in a structure-of-arrays layout without any branches so that the compiler can vectorize the individual steps.<br>
+		 * The result for each sample is identical to homographyMatrixFromFourPoints().
+		 * @param leftPoints The image points in the left images, four consecutive points for each sample, tBatchSize * 4 points in total, must be valid
+		 * @param rightPoints The image points in the right images, one for each point in the left images, tBatchSize * 4 points in total, must be valid
+		 * @param right_H_lefts The resulting homographies, one for each sample, invalid homographies are set to a zero matrix, must be valid
+		 * @param validHomographies The resulting validity flags, one for each sample, must be valid
+		 * @return The number of valid homographies, with range [0, tBatchSize]
+		 * @tparam T The data type of the scalar to be used, either 'float' or 'double'
+		 * @tparam tBatchSize The number of samples in the batch, with range [1, infinity)
+		 * @see homographyMatrixFromFourPoints().
+		 */
+		template <typename T, size_t tBatchSize>
+		static unsigned int homographyMatricesFromFourPointsBatch(const VectorT2<T>* leftPoints, const VectorT2<T>* rightPoints, SquareMatrixT3<T>* right_H_lefts, bool* validHomographies);
+
+		/**
+		 * Calculates the homography (8DOF - translation, rotation, scale, aspect ratio, shear, perspective) between two images with the normalized direct linear transformation.
+		 * In contrast to homographyMatrixSVD(), this function does not allocate any memory.<br>
+		 * The points are normalized on the fly, the linear system is reduced to a fixed-size 9x9 triangular matrix with Givens rotations (an 8x9 matrix for four correspondences), and the null space is determined with a one-sided Jacobi singular value decomposition.<br>
+		 * The resulting homography transforms image points defined in the left image to image points defined in the right image (rightPoint = H * leftPoint).
+		 * @param leftPoints The image points in the left image, must be valid
+		 * @param rightPoints The image points in the right image, one for each point in the left image, must be valid
+		 * @param correspondences The number of point correspondences, with range [4, infinity)
+		 * @param right_H_left The resulting homography transforming left to right image points (rightPoint = right_H_left * leftPoint)
+		 * @return True, if succeeded
+		 * @tparam T The data type of the scalar to be used, either 'float' or 'double'
+		 * @see homographyMatricesDLTBatch(), homographyMatrixSVD().
+		 */
+		template <typename T>
+		static bool homographyMatrixDLT(const VectorT2<T>* leftPoints, const VectorT2<T>* rightPoints, const size_t correspondences, SquareMatrixT3<T>& right_H_left);
+
+		/**
+		 * Calculates several homographies from independent samples with the normalized direct linear transformation.
+		 * The samples are processed lane-wise in a structure-of-arrays layout without any branches so that the compiler can vectorize the individual steps.
+		 * @param leftPoints The image points in the left images, 'correspondences' consecutive points for each sample, tBatchSize * correspondences points in total, must be valid
+		 * @param rightPoints The image points in the right images, one for each point in the left images, tBatchSize * correspondences points in total, must be valid
+		 * @param correspondences The number of point correspondences in each sample, with range [4, infinity)
+		 * @param right_H_lefts The resulting homographies, one for each sample, invalid homographies are set to a zero matrix, must be valid
+		 * @param validHomographies The resulting validity flags, one for each sample, must be valid
+		 * @return The number of valid homographies, with range [0, tBatchSize]
+		 * @tparam T The data type of the scalar to be used, either 'float' or 'double'
+		 * @tparam tBatchSize The number of samples in the batch, with range [1, infinity)
+		 * @see homographyMatrixDLT().
+		 */
+		template <typename T, size_t tBatchSize>
+		static unsigned int homographyMatricesDLTBatch(const VectorT2<T>* leftPoints, const VectorT2<T>* rightPoints, const size_t correspondences, SquareMatrixT3<T>* right_H_lefts, bool* validHomographies);
+
 		/**
 		 * Calculates the affine transformation (6DOF - translation, rotation, scale, aspect ratio, shear) between two sets of 2D image points.
 		 * @param leftPoints The image points in the left image, must be valid
@@ -433,6 +496,55 @@ class OCEAN_GEOMETRY_EXPORT Homography
 		 */
 		template <typename T>
 		static inline SquareMatrixT3<T> homographyForLines(const SquareMatrixT3<T>& homographyForPoints);
+
+	protected:
+
+		/**
+		 * Determines the isotropic normalization of a set of 2D points so that the normalized points have their centroid at the origin and a root mean square distance of sqrt(2) to the origin.
+		 * The points themselves are not modified, a normalized point is given by (point - mean) * scale.
+		 * @param points The points to be normalized, must be valid
+		 * @param number The number of points, with range [1, infinity)
+		 * @param mean The resulting mean point
+		 * @param scale The resulting scale factor, with range (0, infinity), 1 if the points are identical
+		 * @tparam T The data type of the scalar to be used, either 'float' or 'double'
+		 */
+		template <typename T>
+		static inline void determineNormalization(const VectorT2<T>* points, const size_t number, VectorT2<T>& mean, T& scale);
+
+		/**
+		 * Determines the right singular vector belonging to the smallest singular value of a 9x9 matrix with a cyclic one-sided Jacobi decomposition.
+		 * @param matrix The row-major 9x9 matrix, will be modified (the columns will be orthogonalized), must be valid
+		 * @param nullVector The resulting unit singular vector, must be valid
+		 * @tparam T The data type of the scalar to be used, either 'float' or 'double'
+		 */
+		template <typename T>
+		static void jacobiNullVector(T matrix[9][9], T nullVector[9]);
+
+		/**
+		 * Adds one row of a linear system to the upper triangular 9x9 matrix of an incremental QR decomposition by applying Givens rotations.
+		 * @param triangular The row-major upper triangular matrix which will be updated, must be valid
+		 * @param row The row to be added, will be modified, must be valid
+		 * @tparam T The data type of the scalar to be used, either 'float' or 'double'
+		 */
+		template <typename T>
+		static inline void addGivensRow(T triangular[9][9], T row[9]);
+
+		/**
+		 * Denormalizes homographies which have been determined for normalized points, normalizes the homographies so that the lower right element is 1, and writes the results.
+		 * @param normalizedHomographies The row-major elements of the homographies for the normalized points, one value for each sample in each element
+		 * @param leftMeans The mean points of the left points, one for each sample
+		 * @param leftScales The normalization scales of the left points, one for each sample
+		 * @param rightMeans The mean points of the right points, one for each sample
+		 * @param rightScales The normalization scales of the right points, one for each sample
+		 * @param validSamples The validity flags of the samples so far, one for each sample
+		 * @param right_H_lefts The resulting homographies, one for each sample, must be valid
+		 * @param validHomographies The resulting validity flags, one for each sample, must be valid
+		 * @return The number of valid homographies, with range [0, tBatchSize]
+		 * @tparam T The data type of the scalar to be used, either 'float' or 'double'
+		 * @tparam tBatchSize The number of samples in the batch, with range [1, infinity)
+		 */
+		template <typename T, size_t tBatchSize>
+		static unsigned int denormalizeHomographiesBatch(const T normalizedHomographies[9][tBatchSize], const T leftMeans[2][tBatchSize], const T leftScales[tBatchSize], const T rightMeans[2][tBatchSize], const T rightScales[tBatchSize], const bool validSamples[tBatchSize], SquareMatrixT3<T>* right_H_lefts, bool* validHomographies);
 };
 
 inline bool Homography::homographyMatrix(const Vector2* leftPoints, const Vector2* rightPoints, const size_t correspondences, SquareMatrix3& right_H_left, const bool useSVD)
@@ -501,6 +613,60 @@ inline SquareMatrixT3<T> Homography::scaleHomography(const SquareMatrixT3<T>& ho
 	return scaledHomography;
 }
 
+template <typename T>
+inline void Homography::determineNormalization(const VectorT2<T>* points, const size_t number, VectorT2<T>& mean, T& scale)
+{
+	ocean_assert(points != nullptr && number >= 1);
+
+	mean = VectorT2<T>(0, 0);
+	for (size_t n = 0; n < number; ++n)
+	{
+		mean += points[n];
+	}
+
+	mean /= T(number);
+
+	T sqrDistances = T(0);
+	for (size_t n = 0; n < number; ++n)
+	{
+		sqrDistances += points[n].sqrDistance(mean);
+	}
+
+	const T invScale = NumericT<T>::sqrt(sqrDistances / T(number) * T(0.5));
+
+	scale = NumericT<T>::isEqualEps(invScale) ? T(1) : T(1) / invScale;
+}
+
+template <typename T>
+inline void Homography::addGivensRow(T triangular[9][9], T row[9])
+{
+	for (unsigned int k = 0u; k < 9u; ++k)
+	{
+		if (row[k] == T(0))
+		{
+			continue;
+		}
+
+		const T radius = NumericT<T>::sqrt(NumericT<T>::sqr(triangular[k][k]) + NumericT<T>::sqr(row[k]));
+
+		if (radius == T(0))
+		{
+			continue;
+		}
+
+		const T cosValue = triangular[k][k] / radius;
+		const T sinValue = row[k] / radius;
+
+		for (unsigned int j = k; j < 9u; ++j)
+		{
+			const T upper = triangular[k][j];
+
+			triangular[k][j] = cosValue * upper + sinValue * row[j];
+			row[j] = cosValue * row[j] - sinValue * upper;
+		}
+	}
+}
+
 template <typename T>
 inline SquareMatrixT3<T> Homography::homographyForLines(const SquareMatrixT3<T>& homographyForPoints)
 {
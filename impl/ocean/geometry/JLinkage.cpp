@@ -12,12 +12,148 @@
 
 #include "ocean/base/Utilities.h"
 
+#include <bit>
+#include <queue>
+
 namespace Ocean
 {
 
 namespace Geometry
 {
 
+JLinkage::PreferenceSets::PreferenceSets(const size_t numberSets, const size_t numberPoints) :
+	numberBlocks_((numberPoints + 63) / 64),
+	bits_(numberSets * numberBlocks_, 0ull),
+	sizes_(numberSets, 0),
+	blockRanges_(numberSets, std::make_pair(numberBlocks_, size_t(0)))
+{
+	// nothing to do here
+}
+
+void JLinkage::PreferenceSets::merge(const size_t targetIndex, const size_t sourceIndex)
+{
+	ocean_assert(targetIndex < sizes_.size() && sourceIndex < sizes_.size());
+	ocean_assert(targetIndex != sourceIndex);
+
+	uint64_t* targetBits = bits_.data() + targetIndex * numberBlocks_;
+	const uint64_t* sourceBits = bits_.data() + sourceIndex * numberBlocks_;
+
+	std::pair<size_t, size_t>& targetRange = blockRanges_[targetIndex];
+	const std::pair<size_t, size_t>& sourceRange = blockRanges_[sourceIndex];
+
+	for (size_t n = sourceRange.first; n < sourceRange.second; ++n)
+	{
+		targetBits[n] |= sourceBits[n];
+	}
+
+	targetRange.first = std::min(targetRange.first, sourceRange.first);
+	targetRange.second = std::max(targetRange.second, sourceRange.second);
+
+	size_t size = 0;
+
+	for (size_t n = targetRange.first; n < targetRange.second; ++n)
+	{
+		size += size_t(std::popcount(targetBits[n]));
+	}
+
+	sizes_[targetIndex] = size;
+}
+
+Scalar JLinkage::PreferenceSets::jaccardDistance(const size_t indexA, const size_t indexB) const
+{
+	ocean_assert(indexA < sizes_.size() && indexB < sizes_.size());
+
+	const size_t sizeA = sizes_[indexA];
+	const size_t sizeB = sizes_[indexB];
+
+	if (sizeA == 0 || sizeB == 0)
+	{
+		return 0;
+	}
+
+	const size_t firstBlock = std::max(blockRanges_[indexA].first, blockRanges_[indexB].first);
+	const size_t endBlock = std::min(blockRanges_[indexA].second, blockRanges_[indexB].second);
+
+	const size_t numberIntersections = firstBlock < endBlock ? size_t(intersectionSize(bits_.data() + indexA * numberBlocks_ + firstBlock, bits_.data() + indexB * numberBlocks_ + firstBlock, endBlock - firstBlock)) : 0;
+	const size_t numberUnion = sizeA + sizeB - numberIntersections;
+
+	ocean_assert(numberUnion >= 1);
+	return (Scalar(numberUnion) - Scalar(numberIntersections)) / Scalar(numberUnion);
+}
+
+size_t JLinkage::PreferenceSets::size(const size_t setIndex) const
+{
+	ocean_assert(setIndex < sizes_.size());
+
+	return sizes_[setIndex];
+}
+
+IndexSet32 JLinkage::PreferenceSets::indices(const size_t setIndex) const
+{
+	ocean_assert(setIndex < sizes_.size());
+
+	const uint64_t* bits = bits_.data() + setIndex * numberBlocks_;
+
+	IndexSet32 result;
+
+	for (size_t n = blockRanges_[setIndex].first; n < blockRanges_[setIndex].second; ++n)
+	{
+		uint64_t block = bits[n];
+
+		while (block != 0ull)
+		{
+			result.insert(Index32(n * 64 + size_t(std::countr_zero(block))));
+			block &= block - 1ull;
+		}
+	}
+
+	ocean_assert(result.size() == sizes_[setIndex]);
+
+	return result;
+}
+
+unsigned int JLinkage::PreferenceSets::intersectionSize(const uint64_t* bitsA, const uint64_t* bitsB, const size_t numberBlocks)
+{
+	ocean_assert(bitsA != nullptr && bitsB != nullptr);
+
+	size_t n = 0;
+
+	unsigned int result = 0u;
+
+#if defined(OCEAN_HARDWARE_SSE_VERSION) && OCEAN_HARDWARE_SSE_VERSION >= 41
+
+	// we count the bits of 128 bit blocks with a lookup table for each 4 bit nibble and a horizontal sum of absolute differences
+
+	const __m128i mask_m128 = _mm_set1_epi8(0x0F);
+	const __m128i table_m128 = _mm_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+
+	__m128i sum_m128 = _mm_setzero_si128();
+
+	while (n + 2 <= numberBlocks)
+	{
+		const __m128i intersection_m128 = _mm_and_si128(_mm_loadu_si128((const __m128i*)(bitsA + n)), _mm_loadu_si128((const __m128i*)(bitsB + n)));
+
+		const __m128i lowCount_m128 = _mm_shuffle_epi8(table_m128, _mm_and_si128(intersection_m128, mask_m128));
+		const __m128i highCount_m128 = _mm_shuffle_epi8(table_m128, _mm_and_si128(_mm_srli_epi16(intersection_m128, 4), mask_m128));
+
+		sum_m128 = _mm_add_epi64(sum_m128, _mm_sad_epu8(_mm_add_epi8(lowCount_m128, highCount_m128), _mm_setzero_si128()));
+
+		n += 2;
+	}
+
+	result = (unsigned int)(_mm_cvtsi128_si32(sum_m128) + _mm_extract_epi32(sum_m128, 2));
+
+#endif // OCEAN_HARDWARE_SSE_VERSION >= 41
+
+	while (n < numberBlocks)
+	{
+		result += (unsigned int)(std::popcount(bitsA[n] & bitsB[n]));
+		++n;
+	}
+
+	return result;
+}
+
 std::vector<Indices32> JLinkage::buildingMinimalSampleSet(const Vector2* imagePoints, const size_t pointCount, const Vectors2& pointForInitialModels, const unsigned int testCandidates, const SpatialDistribution::DistributionArray* distributionImagePoints)
 {
 	ocean_assert(testCandidates > 0u);
@@ -147,7 +283,7 @@ Lines2 JLinkage::buildingMinimalSampleSetLine(const Vector2* imagePoints, const
 	return lines;
 }
 
-bool JLinkage::homographyMatrices(const Vector2* leftImagePoints, const Vector2* rightImagePoints, const size_t correspondences, const unsigned int width, const unsigned int height, SquareMatrices3& homographies, const unsigned int testCandidates, const Vectors2& leftPointForInitialModels, const Scalar squarePixelErrorAssignmentThreshold, std::vector<IndexSet32>* usedIndicesPerHomography,  bool refineHomographies, bool approximatedNeighborSearch, Ocean::RandomGenerator* randomGenerator)
+bool JLinkage::homographyMatrices(const Vector2* leftImagePoints, const Vector2* rightImagePoints, const size_t correspondences, const unsigned int width, const unsigned int height, SquareMatrices3& homographies, const unsigned int testCandidates, const Vectors2& leftPointForInitialModels, const Scalar squarePixelErrorAssignmentThreshold, std::vector<IndexSet32>* usedIndicesPerHomography, bool refineHomographies, bool approximatedNeighborSearch, Ocean::RandomGenerator* randomGenerator, Worker* worker)
 {
 	ocean_assert(squarePixelErrorAssignmentThreshold > 0);
 	ocean_assert(leftImagePoints && rightImagePoints);
@@ -171,103 +307,47 @@ bool JLinkage::homographyMatrices(const Vector2* leftImagePoints, const Vector2*
 		homographies = buildingMinimalSampleSetHomography(leftImagePoints, rightImagePoints, correspondences, leftPointForInitialModels, testCandidates);
 	}
 
-	size_t modelCounts = homographies.size();
-
-	if (modelCounts == 0u)
+	if (homographies.empty())
 	{
 		SquareMatrix3 globalHomography;
-		if (Homography::homographyMatrix(leftImagePoints, rightImagePoints, correspondences, globalHomography))
+		if (!Homography::homographyMatrix(leftImagePoints, rightImagePoints, correspondences, globalHomography))
 		{
-			homographies.push_back(globalHomography);
+			return false;
 		}
-		modelCounts = 1u;
+
+		homographies.push_back(globalHomography);
 	}
 
-	// determining consensus/ preference set matrix
-	std::vector<IndexSet32> preferenceSets(modelCounts);
+	// determining consensus/ preference sets
+	PreferenceSets packedPreferenceSets(homographies.size(), correspondences);
 
-	for (size_t p = 0; p < correspondences; p++)
+	if (worker != nullptr)
 	{
-		const Vector2& leftPoint = leftImagePoints[p];
-		const Vector2& rightPoint = rightImagePoints[p];
-
-		for (Index32 m = 0; m < Index32(modelCounts); m++)
-		{
-			const SquareMatrix3& mssHomography = homographies[m];
-			const Scalar squareError = (mssHomography * leftPoint).sqrDistance(rightPoint);
-
-			if (squareError < squarePixelErrorAssignmentThreshold)
-			{
-				preferenceSets[m].insert((unsigned int)(p));
-			}
-		}
+		worker->executeFunction(Worker::Function::createStatic(&JLinkage::determinePreferenceSetsHomographySubset, leftImagePoints, rightImagePoints, correspondences, (const SquareMatrix3*)(homographies.data()), squarePixelErrorAssignmentThreshold, &packedPreferenceSets, 0u, 0u), 0u, (unsigned int)(homographies.size()));
 	}
-
-	// perform agglomerative clustering
-	while (true)
+	else
 	{
-		// go thru all preference set and merge set with minimal jaccard distance
-
-		Scalar minJaccardDistance(1);
-		IndexPair32 minIndex(0, 0);
-		Index32 len = Index32(preferenceSets.size());
-
-		for (Index32 a = 0; a < len; a++)
-		{
-			for (Index32 b = a + 1u; b < len; b++)
-			{
-				const Scalar currentJaccardDistance(jaccardDistance(preferenceSets[a], preferenceSets[b]));
-				if (currentJaccardDistance < minJaccardDistance)
-				{
-					minJaccardDistance = currentJaccardDistance;
-					minIndex.first = a;
-					minIndex.second = b;
-				}
-			}
-		}
-
-		if (Numeric::isEqual(minJaccardDistance, Scalar(1)))
-		{
-			break;
-		}
-
-		// merge clusters/ models with minimal jaccard distance
-		for (IndexSet32::const_iterator it = preferenceSets[minIndex.second].cbegin(); it != preferenceSets[minIndex.second].cend(); ++it)
-		{
-			preferenceSets[minIndex.first].insert(*it);
-		}
-
-		preferenceSets.erase(preferenceSets.begin() + minIndex.second);
-		homographies.erase(homographies.begin() + minIndex.second);
-
-#ifdef OCEAN_DEBUG
-		MatrixT<Scalar> preferenceConsensusMatrixDebug(correspondences, preferenceSets.size()); // MatrixT_<unsigned int>
-		memset(preferenceConsensusMatrixDebug.data(), 0, preferenceConsensusMatrixDebug.elements() * sizeof(Scalar));
-
-		for (size_t i = 0; i < preferenceSets.size(); i++)
-		{
-			for (IndexSet32::const_iterator it = preferenceSets[i].cbegin(); it != preferenceSets[i].cend(); ++it)
-			{
-				++preferenceConsensusMatrixDebug[*it][i];
-			}
-		}
-#endif
+		determinePreferenceSetsHomographySubset(leftImagePoints, rightImagePoints, correspondences, homographies.data(), squarePixelErrorAssignmentThreshold, &packedPreferenceSets, 0u, (unsigned int)(homographies.size()));
 	}
 
+	// perform agglomerative clustering
+	const Indices32 linkedSets(linkPreferenceSets(packedPreferenceSets, worker));
+
 	// decline set with less then {testCandidates} members
-	for (size_t m = 0; m < preferenceSets.size();)
+	SquareMatrices3 linkedHomographies;
+	std::vector<IndexSet32> preferenceSets;
+
+	for (const Index32 setIndex : linkedSets)
 	{
-		if (preferenceSets[m].size() < testCandidates)
-		{
-			preferenceSets.erase(preferenceSets.begin() + m);
-			homographies.erase(homographies.begin() + m);
-		}
-		else
+		if (packedPreferenceSets.size(setIndex) >= testCandidates)
 		{
-			++m;
+			linkedHomographies.push_back(homographies[setIndex]);
+			preferenceSets.push_back(packedPreferenceSets.indices(setIndex));
 		}
 	}
 
+	homographies = std::move(linkedHomographies);
+
 	// **TODO** **SM** add constraints
 
 	if (preferenceSets.empty())
@@ -316,7 +396,7 @@ bool JLinkage::homographyMatrices(const Vector2* leftImagePoints, const Vector2*
 	return true;
 }
 
-bool JLinkage::fitLines(const Vector2* imagePoints, const size_t pointCount, const unsigned int width, const unsigned int height, Lines2& lines, const unsigned int testCandidates, const Vectors2& pointForInitialModels, const Scalar pixelErrorAssignmentThreshold, std::vector<IndexSet32>* usedIndicesPerHomography, bool approximatedNeighborSearch)
+bool JLinkage::fitLines(const Vector2* imagePoints, const size_t pointCount, const unsigned int width, const unsigned int height, Lines2& lines, const unsigned int testCandidates, const Vectors2& pointForInitialModels, const Scalar pixelErrorAssignmentThreshold, std::vector<IndexSet32>* usedIndicesPerHomography, bool approximatedNeighborSearch, Worker* worker)
 {
 	ocean_assert(pixelErrorAssignmentThreshold > 0);
 	ocean_assert(imagePoints);
@@ -341,112 +421,285 @@ bool JLinkage::fitLines(const Vector2* imagePoints, const size_t pointCount, con
 		lines = buildingMinimalSampleSetLine(imagePoints, pointCount, pointForInitialModels, testCandidates);
 	}
 
-	const size_t modelCounts = lines.size();
-
-	if (modelCounts == 0)
+	if (lines.empty())
 	{
 		Line2 globalLine;
-		if (Line2::fitLineLeastSquare(imagePoints, pointCount, globalLine))
+		if (!Line2::fitLineLeastSquare(imagePoints, pointCount, globalLine))
 		{
-			lines.push_back(globalLine);
+			return false;
 		}
+
+		lines.push_back(globalLine);
 	}
 
-	// determining consensus/ preference set matrix
-	std::vector<IndexSet32> preferenceSets(modelCounts);
+	// determining consensus/ preference sets
+	PreferenceSets packedPreferenceSets(lines.size(), pointCount);
 
-	for (size_t p = 0; p < pointCount; p++)
+	if (worker != nullptr)
 	{
-		const Vector2& point = imagePoints[p];
+		worker->executeFunction(Worker::Function::createStatic(&JLinkage::determinePreferenceSetsLineSubset, imagePoints, pointCount, (const Line2*)(lines.data()), pixelErrorAssignmentThreshold, &packedPreferenceSets, 0u, 0u), 0u, (unsigned int)(lines.size()));
+	}
+	else
+	{
+		determinePreferenceSetsLineSubset(imagePoints, pointCount, lines.data(), pixelErrorAssignmentThreshold, &packedPreferenceSets, 0u, (unsigned int)(lines.size()));
+	}
+
+	// perform agglomerative clustering
+	const Indices32 linkedSets(linkPreferenceSets(packedPreferenceSets, worker));
+
+	// decline set with less then {testCandidates} members
+	Lines2 linkedLines;
+	std::vector<IndexSet32> preferenceSets;
 
-		for (Index32 m = 0; m < Index32(modelCounts); m++)
+	for (const Index32 setIndex : linkedSets)
+	{
+		if (packedPreferenceSets.size(setIndex) >= testCandidates)
 		{
-			const Line2& mssLine = lines[m];
+			linkedLines.push_back(lines[setIndex]);
+			preferenceSets.push_back(packedPreferenceSets.indices(setIndex));
+		}
+	}
 
-			const Scalar error = mssLine.distance(point);
+	lines = std::move(linkedLines);
 
-			if (error < pixelErrorAssignmentThreshold)
-			{
-				preferenceSets[m].insert((unsigned int)(p));
-			}
+	if (preferenceSets.empty())
+	{
+		return false;
+	}
+
+	if (usedIndicesPerHomography)
+	{
+		*usedIndicesPerHomography = preferenceSets;
+	}
+
+	return true;
+}
+
+Indices32 JLinkage::linkPreferenceSets(PreferenceSets& preferenceSets, Worker* worker)
+{
+	const unsigned int numberSets = (unsigned int)(preferenceSets.numberSets());
+
+	// we determine all pairs of preference sets which can be linked, pairs with distance 1 will never be linked
+
+	std::vector<LinkageCandidates> candidatesPerSet(numberSets);
+
+	if (worker != nullptr)
+	{
+		worker->executeFunction(Worker::Function::createStatic(&JLinkage::determineLinkageCandidatesSubset, (const PreferenceSets*)(&preferenceSets), candidatesPerSet.data(), 0u, 0u), 0u, numberSets);
+	}
+	else
+	{
+		determineLinkageCandidatesSubset(&preferenceSets, candidatesPerSet.data(), 0u, numberSets);
+	}
+
+	// the neighbors of a set are all sets with distance below 1, as the union of two sets intersects another set only if one of both sets intersects this set,
+	// the neighbors of a merged set are the union of the neighbors of both sets
+
+	std::vector<Indices32> neighbors(numberSets);
+
+	LinkageCandidates initialCandidates;
+
+	for (LinkageCandidates& candidates : candidatesPerSet)
+	{
+		for (const LinkageCandidate& candidate : candidates)
+		{
+			neighbors[candidate.indexA_].push_back(candidate.indexB_);
+			neighbors[candidate.indexB_].push_back(candidate.indexA_);
 		}
+
+		initialCandidates.insert(initialCandidates.end(), candidates.cbegin(), candidates.cend());
+		candidates = LinkageCandidates();
 	}
 
-	// perform agglomerative clustering
+	std::priority_queue<LinkageCandidate, LinkageCandidates, std::greater<LinkageCandidate>> candidateQueue(std::greater<LinkageCandidate>(), std::move(initialCandidates));
 
-	while (true)
+	// each merge invalidates all candidates of the merged sets, outdated candidates are identified by the versions of the sets
+
+	std::vector<unsigned int> versions(numberSets, 0u);
+
+	// the index of the set into which a set has been merged, or the set's own index if the set still exists
+	Indices32 representatives(numberSets);
+
+	for (Index32 n = 0u; n < numberSets; ++n)
 	{
-		// go thru all preference set and merge set with minimal jaccard distance
-		Scalar minJaccardDistance(1);
-		IndexPair32 minIndex(0, 0);
-		Index32 len = Index32(preferenceSets.size());
+		representatives[n] = n;
+	}
+
+	Indices32 otherIndices;
+	Scalars distances;
+
+	while (!candidateQueue.empty())
+	{
+		const LinkageCandidate candidate(candidateQueue.top());
+		candidateQueue.pop();
+
+		const Index32 indexA = candidate.indexA_;
+		const Index32 indexB = candidate.indexB_;
+
+		if (representatives[indexA] != indexA || representatives[indexB] != indexB || versions[indexA] != candidate.versionA_ || versions[indexB] != candidate.versionB_)
+		{
+			continue;
+		}
+
+		if (Numeric::isEqual(candidate.distance_, Scalar(1)))
+		{
+			break;
+		}
+
+		// merge clusters/ models with minimal jaccard distance, the set with lower index receives the merged set
+
+		preferenceSets.merge(indexA, indexB);
+
+		representatives[indexB] = indexA;
+		++versions[indexA];
 
-		for (Index32 a = 0; a < len; a++)
+		otherIndices.clear();
+
+		for (const Index32 setIndex : {indexA, indexB})
 		{
-			for (Index32 b = a + 1u; b < len; b++)
+			for (Index32 neighbor : neighbors[setIndex])
 			{
-				const Scalar currentJaccardDistance(jaccardDistance(preferenceSets[a], preferenceSets[b]));
-				if (currentJaccardDistance < minJaccardDistance)
+				while (representatives[neighbor] != neighbor)
+				{
+					// path halving, keeping the chains of merged sets short
+
+					representatives[neighbor] = representatives[representatives[neighbor]];
+					neighbor = representatives[neighbor];
+				}
+
+				if (neighbor != indexA)
 				{
-					minJaccardDistance = currentJaccardDistance;
-					minIndex.first = a;
-					minIndex.second = b;
+					otherIndices.push_back(neighbor);
 				}
 			}
 		}
 
-		if (Numeric::isEqual(minJaccardDistance, Scalar(1)))
+		neighbors[indexB] = Indices32();
+
+		std::sort(otherIndices.begin(), otherIndices.end());
+		otherIndices.erase(std::unique(otherIndices.begin(), otherIndices.end()), otherIndices.end());
+
+		distances.resize(otherIndices.size());
+
+		if (worker != nullptr && otherIndices.size() >= 1000)
 		{
-			break;
+			worker->executeFunction(Worker::Function::createStatic(&JLinkage::determineJaccardDistancesSubset, (const PreferenceSets*)(&preferenceSets), indexA, (const Index32*)(otherIndices.data()), distances.data(), 0u, 0u), 0u, (unsigned int)(otherIndices.size()), 4u, 5u, 100u);
 		}
-
-		// merge clusters/ models with minimal jaccard distance
-		for (IndexSet32::const_iterator it = preferenceSets[minIndex.second].cbegin(); it != preferenceSets[minIndex.second].cend(); ++it)
+		else if (!otherIndices.empty())
 		{
-			preferenceSets[minIndex.first].insert(*it);
+			determineJaccardDistancesSubset(&preferenceSets, indexA, otherIndices.data(), distances.data(), 0u, (unsigned int)(otherIndices.size()));
 		}
-		preferenceSets.erase(preferenceSets.begin() + minIndex.second);
-		lines.erase(lines.begin() + minIndex.second);
 
-#ifdef OCEAN_DEBUG
-		MatrixT<Scalar> preferenceConsensusMatrixDebug(pointCount,  preferenceSets.size()); // MatrixT_<unsigned int>
-		memset(preferenceConsensusMatrixDebug.data(), 0, preferenceConsensusMatrixDebug.elements() * sizeof(Scalar));
+		Indices32& neighborsA = neighbors[indexA];
+		neighborsA.clear();
 
-		for (size_t i = 0; i < preferenceSets.size(); i++)
+		for (size_t n = 0; n < otherIndices.size(); ++n)
 		{
-			for (IndexSet32::const_iterator it = preferenceSets[i].cbegin(); it != preferenceSets[i].cend(); ++it)
+			if (distances[n] < Scalar(1))
 			{
-				++preferenceConsensusMatrixDebug[*it][i];
+				LinkageCandidate newCandidate;
+				newCandidate.distance_ = distances[n];
+				newCandidate.indexA_ = std::min(indexA, otherIndices[n]);
+				newCandidate.indexB_ = std::max(indexA, otherIndices[n]);
+				newCandidate.versionA_ = versions[newCandidate.indexA_];
+				newCandidate.versionB_ = versions[newCandidate.indexB_];
+
+				candidateQueue.push(newCandidate);
+
+				neighborsA.push_back(otherIndices[n]);
 			}
 		}
-#endif
 	}
 
-	// decline set with less then {testCandidates} members
-	for (size_t m = 0; m < preferenceSets.size();)
+	Indices32 result;
+
+	for (Index32 n = 0u; n < numberSets; ++n)
 	{
-		if (preferenceSets[m].size() < testCandidates)
+		if (representatives[n] == n)
 		{
-			preferenceSets.erase(preferenceSets.begin() + m);
-			lines.erase(lines.begin() + m);
+			result.push_back(n);
 		}
-		else
+	}
+
+	return result;
+}
+
+void JLinkage::determineLinkageCandidatesSubset(const PreferenceSets* preferenceSets, LinkageCandidates* candidates, const unsigned int firstSet, const unsigned int numberSets)
+{
+	ocean_assert(preferenceSets != nullptr && candidates != nullptr);
+	ocean_assert(firstSet + numberSets <= preferenceSets->numberSets());
+
+	const Index32 totalSets = Index32(preferenceSets->numberSets());
+
+	for (Index32 a = firstSet; a < firstSet + numberSets; ++a)
+	{
+		LinkageCandidates& setCandidates = candidates[a];
+
+		for (Index32 b = a + 1u; b < totalSets; ++b)
 		{
-			++m;
+			const Scalar distance = preferenceSets->jaccardDistance(a, b);
+
+			if (distance < Scalar(1))
+			{
+				LinkageCandidate candidate;
+				candidate.distance_ = distance;
+				candidate.indexA_ = a;
+				candidate.indexB_ = b;
+
+				setCandidates.push_back(candidate);
+			}
 		}
 	}
+}
 
-	if (preferenceSets.empty())
+void JLinkage::determineJaccardDistancesSubset(const PreferenceSets* preferenceSets, const Index32 setIndex, const Index32* otherIndices, Scalar* distances, const unsigned int firstOther, const unsigned int numberOthers)
+{
+	ocean_assert(preferenceSets != nullptr && otherIndices != nullptr && distances != nullptr);
+
+	for (unsigned int n = firstOther; n < firstOther + numberOthers; ++n)
 	{
-		return false;
+		distances[n] = preferenceSets->jaccardDistance(setIndex, otherIndices[n]);
 	}
+}
 
-	if (usedIndicesPerHomography)
+void JLinkage::determinePreferenceSetsHomographySubset(const Vector2* leftImagePoints, const Vector2* rightImagePoints, const size_t correspondences, const SquareMatrix3* homographies, const Scalar squarePixelErrorAssignmentThreshold, PreferenceSets* preferenceSets, const unsigned int firstModel, const unsigned int numberModels)
+{
+	ocean_assert(leftImagePoints != nullptr && rightImagePoints != nullptr && homographies != nullptr && preferenceSets != nullptr);
+	ocean_assert(firstModel + numberModels <= preferenceSets->numberSets());
+
+	for (unsigned int m = firstModel; m < firstModel + numberModels; ++m)
 	{
-		*usedIndicesPerHomography = preferenceSets;
+		const SquareMatrix3& mssHomography = homographies[m];
+
+		for (size_t p = 0; p < correspondences; ++p)
+		{
+			const Scalar squareError = (mssHomography * leftImagePoints[p]).sqrDistance(rightImagePoints[p]);
+
+			if (squareError < squarePixelErrorAssignmentThreshold)
+			{
+				preferenceSets->insert(m, Index32(p));
+			}
+		}
 	}
+}
 
-	return true;
+void JLinkage::determinePreferenceSetsLineSubset(const Vector2* imagePoints, const size_t pointCount, const Line2* lines, const Scalar pixelErrorAssignmentThreshold, PreferenceSets* preferenceSets, const unsigned int firstModel, const unsigned int numberModels)
+{
+	ocean_assert(imagePoints != nullptr && lines != nullptr && preferenceSets != nullptr);
+	ocean_assert(firstModel + numberModels <= preferenceSets->numberSets());
+
+	for (unsigned int m = firstModel; m < firstModel + numberModels; ++m)
+	{
+		const Line2& mssLine = lines[m];
+
+		for (size_t p = 0; p < pointCount; ++p)
+		{
+			if (mssLine.distance(imagePoints[p]) < pixelErrorAssignmentThreshold)
+			{
+				preferenceSets->insert(m, Index32(p));
+			}
+		}
+	}
 }
 
 bool TLinkage::homographyMatrices(const Vector2* leftImagePoints, const Vector2* rightImagePoints, const size_t correspondences, SquareMatrices3& homographies, const unsigned int testCandidates, const Vectors2& leftPointForInitialModels, const Scalar pixelAssignmentRatio, std::vector<IndexSet32>* usedIndicesPerHomography, bool refineHomographies, Ocean::RandomGenerator* randomGenerator)
@@ -13,6 +13,7 @@
 
 #include "ocean/base/RandomGenerator.h"
 #include "ocean/base/Subset.h"
+#include "ocean/base/Worker.h"
 
 #include "ocean/math/Line2.h"
 #include "ocean/math/Matrix.h"
@@ -40,6 +41,130 @@ class OCEAN_GEOMETRY_EXPORT JLinkage
 		 */
 		using DistancePair = std::pair<Scalar, Index32>;
 
+		/**
+		 * This class holds the preference sets of several models as packed bitsets, with one bit for each point.
+		 * The Jaccard distance between two sets is determined with population counts of the bitwise intersection.
+		 */
+		class PreferenceSets
+		{
+			public:
+
+				/**
+				 * Creates new empty preference sets.
+				 * @param numberSets The number of preference sets, with range [0, infinity)
+				 * @param numberPoints The number of points which can be part of a preference set, with range [0, infinity)
+				 */
+				PreferenceSets(const size_t numberSets, const size_t numberPoints);
+
+				/**
+				 * Adds a point to a preference set.
+				 * Points must not be added to the same set concurrently, while different sets can be modified concurrently.
+				 * @param setIndex The index of the preference set, with range [0, numberSets())
+				 * @param pointIndex The index of the point, with range [0, numberPoints)
+				 */
+				inline void insert(const size_t setIndex, const Index32 pointIndex);
+
+				/**
+				 * Merges a preference set into another preference set.
+				 * @param targetIndex The index of the preference set receiving the union of both sets, with range [0, numberSets())
+				 * @param sourceIndex The index of the preference set to be merged, with range [0, numberSets()), must not be 'targetIndex'
+				 */
+				void merge(const size_t targetIndex, const size_t sourceIndex);
+
+				/**
+				 * Returns the Jaccard distance between two preference sets.
+				 * The distance is zero if at least one of both sets is empty.
+				 * @param indexA The index of the first preference set, with range [0, numberSets())
+				 * @param indexB The index of the second preference set, with range [0, numberSets())
+				 * @return The Jaccard distance, with range [0, 1]
+				 * @see JLinkage::jaccardDistance().
+				 */
+				Scalar jaccardDistance(const size_t indexA, const size_t indexB) const;
+
+				/**
+				 * Returns the number of points in a preference set.
+				 * @param setIndex The index of the preference set, with range [0, numberSets())
+				 * @return The number of points
+				 */
+				size_t size(const size_t setIndex) const;
+
+				/**
+				 * Returns the indices of all points in a preference set.
+				 * @param setIndex The index of the preference set, with range [0, numberSets())
+				 * @return The point indices
+				 */
+				IndexSet32 indices(const size_t setIndex) const;
+
+				/**
+				 * Returns the number of preference sets.
+				 * @return The number of sets
+				 */
+				inline size_t numberSets() const;
+
+			protected:
+
+				/**
+				 * Returns the number of set bits in the intersection of two bitsets.
+				 * @param bitsA The first bitset, must be valid
+				 * @param bitsB The second bitset, must be valid
+				 * @param numberBlocks The number of 64 bit blocks in each bitset, with range [0, infinity)
+				 * @return The number of common bits
+				 */
+				static unsigned int intersectionSize(const uint64_t* bitsA, const uint64_t* bitsB, const size_t numberBlocks);
+
+			protected:
+
+				/// The number of 64 bit blocks for each preference set.
+				size_t numberBlocks_ = 0;
+
+				/// The bits of all preference sets, one set after another.
+				std::vector<uint64_t> bits_;
+
+				/// The number of points in each preference set, updated by merge().
+				std::vector<size_t> sizes_;
+
+				/// The range of blocks of each preference set which may contain set bits, with first block and end block (exclusive), the intersection of two sets is determined within the overlap of their ranges only.
+				std::vector<std::pair<size_t, size_t>> blockRanges_;
+		};
+
+		/**
+		 * Definition of a candidate pair of preference sets to be linked.
+		 */
+		class LinkageCandidate
+		{
+			public:
+
+				/**
+				 * Returns whether this candidate is linked after a second candidate.
+				 * Candidates are linked in ascending order of their distances, then in ascending order of their set indices.
+				 * @param candidate The second candidate
+				 * @return True, if so
+				 */
+				inline bool operator>(const LinkageCandidate& candidate) const;
+
+			public:
+
+				/// The Jaccard distance between both preference sets.
+				Scalar distance_ = Scalar(1);
+
+				/// The index of the first preference set, which would receive the merged set.
+				Index32 indexA_ = Index32(-1);
+
+				/// The index of the second preference set, with indexB_ > indexA_.
+				Index32 indexB_ = Index32(-1);
+
+				/// The version of the first preference set when the distance was determined.
+				unsigned int versionA_ = 0u;
+
+				/// The version of the second preference set when the distance was determined.
+				unsigned int versionB_ = 0u;
+		};
+
+		/**
+		 * Definition of a vector holding linkage candidates.
+		 */
+		using LinkageCandidates = std::vector<LinkageCandidate>;
+
 	public:
 
 		/**
@@ -58,9 +183,10 @@ class OCEAN_GEOMETRY_EXPORT JLinkage
 		 * @param refineHomographies Determines whether a not linear least square algorithm is used to increase the pose accuracies after J-linkage
 		 * @param approximatedNeighborSearch Defines if speeded up spatial neighbor search is used
 		 * @param randomGenerator Random number generator. If is not nullptr, RANSAC is used for homography determination within initial minimum sample set
+		 * @param worker Optional worker object to distribute the determination of the preference sets and of their distances
 		 * @return True, if successfully completed
 		 */
-		static bool homographyMatrices(const Vector2* leftImagePoints, const Vector2* rightImagePoints, const size_t correspondences, const unsigned int width, const unsigned int height, SquareMatrices3& homographies, const unsigned int testCandidates, const Vectors2& leftPointForInitialModels, const Scalar squarePixelErrorAssignmentThreshold, std::vector<IndexSet32>* usedIndicesPerHomography = nullptr, bool refineHomographies = true, bool approximatedNeighborSearch = true, Ocean::RandomGenerator* randomGenerator = nullptr);
+		static bool homographyMatrices(const Vector2* leftImagePoints, const Vector2* rightImagePoints, const size_t correspondences, const unsigned int width, const unsigned int height, SquareMatrices3& homographies, const unsigned int testCandidates, const Vectors2& leftPointForInitialModels, const Scalar squarePixelErrorAssignmentThreshold, std::vector<IndexSet32>* usedIndicesPerHomography = nullptr, bool refineHomographies = true, bool approximatedNeighborSearch = true, Ocean::RandomGenerator* randomGenerator = nullptr, Worker* worker = nullptr);
 
 		/**
 		 * Calculates multiple homographies between two images transforming the projected planar object points between the two images using J-linkage
@@ -78,9 +204,10 @@ class OCEAN_GEOMETRY_EXPORT JLinkage
 		 * @param refineHomographies Determines whether a not linear least square algorithm is used to increase the pose accuracies after J-linkage
 		 * @param approximatedNeighborSearch Defines if speeded up spatial neighbor search is used
 		 * @param randomGenerator Random number generator. If is not nullptr, RANSAC is used for homography determination within initial minimum sample set
+		 * @param worker Optional worker object to distribute the determination of the preference sets and of their distances
 		 * @return True, if successfully completed
 		 */
-		static inline bool homographyMatrices(const Vector2* leftImagePoints, const Vector2* rightImagePoints, const size_t correspondences, const unsigned int width, const unsigned int height, SquareMatrices3& homographies, const unsigned int testCandidates, const Indices32& leftPointIndicesForInitialModels, const Scalar squarePixelErrorAssignmentThreshold, std::vector<IndexSet32>* usedIndicesPerHomography = nullptr, bool refineHomographies = true, bool approximatedNeighborSearch = true, Ocean::RandomGenerator* randomGenerator = nullptr);
+		static inline bool homographyMatrices(const Vector2* leftImagePoints, const Vector2* rightImagePoints, const size_t correspondences, const unsigned int width, const unsigned int height, SquareMatrices3& homographies, const unsigned int testCandidates, const Indices32& leftPointIndicesForInitialModels, const Scalar squarePixelErrorAssignmentThreshold, std::vector<IndexSet32>* usedIndicesPerHomography = nullptr, bool refineHomographies = true, bool approximatedNeighborSearch = true, Ocean::RandomGenerator* randomGenerator = nullptr, Worker* worker = nullptr);
 
 		/**
 		 * Multiple line detector using J-linkage
@@ -94,9 +221,10 @@ class OCEAN_GEOMETRY_EXPORT JLinkage
 		 * @param pixelErrorAssignmentThreshold Maximal pixel error of a point-line corresspodance (0, infinity)
 		 * @param usedIndicesPerHomography Optional set of indices which will receive the indices of the used image correspondences per model, if defined
 		 * @param approximatedNeighborSearch Defines if speeded up spatial neighbor search is used
+		 * @param worker Optional worker object to distribute the determination of the preference sets and of their distances
 		 * @return True, if successfully completed
 		 */
-		static bool fitLines(const Vector2* imagePoints, const size_t pointCount, const unsigned int width, const unsigned int height, Lines2& lines, const unsigned int testCandidates, const Vectors2& pointForInitialModels, const Scalar pixelErrorAssignmentThreshold, std::vector<IndexSet32>* usedIndicesPerHomography = nullptr, bool approximatedNeighborSearch = true);
+		static bool fitLines(const Vector2* imagePoints, const size_t pointCount, const unsigned int width, const unsigned int height, Lines2& lines, const unsigned int testCandidates, const Vectors2& pointForInitialModels, const Scalar pixelErrorAssignmentThreshold, std::vector<IndexSet32>* usedIndicesPerHomography = nullptr, bool approximatedNeighborSearch = true, Worker* worker = nullptr);
 
 	protected:
 
@@ -135,6 +263,61 @@ class OCEAN_GEOMETRY_EXPORT JLinkage
 		 */
 		static Lines2 buildingMinimalSampleSetLine(const Vector2* imagePoints, const size_t pointCount, const Vectors2& pointForInitialModels, const unsigned int testCandidates, const SpatialDistribution::DistributionArray* distributionImagePoints = nullptr);
 
+		/**
+		 * Applies the agglomerative J-linkage clustering to preference sets.
+		 * The pair of preference sets with smallest Jaccard distance is merged until all remaining pairs have distance 1.<br>
+		 * Only pairs with distance below 1 are kept in a priority queue, after each merge only the distances to the merged set are updated.
+		 * @param preferenceSets The preference sets to be clustered, merged sets are stored in the set with lower index
+		 * @param worker Optional worker object to distribute the computation
+		 * @return The indices of the remaining preference sets, in ascending order
+		 */
+		static Indices32 linkPreferenceSets(PreferenceSets& preferenceSets, Worker* worker = nullptr);
+
+		/**
+		 * Determines the linkage candidates of a subset of preference sets with all preference sets with larger index.
+		 * @param preferenceSets The preference sets, must be valid
+		 * @param candidates The resulting candidates for each preference set, with distance below 1, must be valid
+		 * @param firstSet The first preference set to be handled
+		 * @param numberSets The number of preference sets to be handled
+		 */
+		static void determineLinkageCandidatesSubset(const PreferenceSets* preferenceSets, LinkageCandidates* candidates, const unsigned int firstSet, const unsigned int numberSets);
+
+		/**
+		 * Determines the Jaccard distances between one preference set and a subset of other preference sets.
+		 * @param preferenceSets The preference sets, must be valid
+		 * @param setIndex The index of the preference set for which the distances will be determined
+		 * @param otherIndices The indices of the other preference sets, must be valid
+		 * @param distances The resulting distances, one for each other preference set, must be valid
+		 * @param firstOther The first other preference set to be handled
+		 * @param numberOthers The number of other preference sets to be handled
+		 */
+		static void determineJaccardDistancesSubset(const PreferenceSets* preferenceSets, const Index32 setIndex, const Index32* otherIndices, Scalar* distances, const unsigned int firstOther, const unsigned int numberOthers);
+
+		/**
+		 * Determines the preference sets of a subset of homographies.
+		 * @param leftImagePoints Image points in the left camera, must be valid
+		 * @param rightImagePoints Image points in the right camera, must be valid
+		 * @param correspondences The number of point correspondences
+		 * @param homographies The homographies, must be valid
+		 * @param squarePixelErrorAssignmentThreshold Maximal square pixel error of a point belonging to a preference set, with range (0, infinity)
+		 * @param preferenceSets The preference sets receiving the points, one for each homography, must be valid
+		 * @param firstModel The first homography to be handled
+		 * @param numberModels The number of homographies to be handled
+		 */
+		static void determinePreferenceSetsHomographySubset(const Vector2* leftImagePoints, const Vector2* rightImagePoints, const size_t correspondences, const SquareMatrix3* homographies, const Scalar squarePixelErrorAssignmentThreshold, PreferenceSets* preferenceSets, const unsigned int firstModel, const unsigned int numberModels);
+
+		/**
+		 * Determines the preference sets of a subset of lines.
+		 * @param imagePoints The image points, must be valid
+		 * @param pointCount The number of image points
+		 * @param lines The lines, must be valid
+		 * @param pixelErrorAssignmentThreshold Maximal pixel error of a point belonging to a preference set, with range (0, infinity)
+		 * @param preferenceSets The preference sets receiving the points, one for each line, must be valid
+		 * @param firstModel The first line to be handled
+		 * @param numberModels The number of lines to be handled
+		 */
+		static void determinePreferenceSetsLineSubset(const Vector2* imagePoints, const size_t pointCount, const Line2* lines, const Scalar pixelErrorAssignmentThreshold, PreferenceSets* preferenceSets, const unsigned int firstModel, const unsigned int numberModels);
+
 		/**
 		 * Calculates the jaccard distance
 		 * d(A, B) = ( |union(A, B)| - |intersection(A, B)| ) / |union(A, B)|.
@@ -206,11 +389,51 @@ class OCEAN_GEOMETRY_EXPORT TLinkage : JLinkage
 		static inline Scalar tanimotoDistance(const Matrix& vectorA, const Matrix& vectorB);
 };
 
-inline bool JLinkage::homographyMatrices(const Vector2* leftImagePoints, const Vector2* rightImagePoints, const size_t correspondences, const unsigned int width, const unsigned int height, SquareMatrices3 & homographies, const unsigned int testCandidates, const Indices32& leftPointIndicesForInitialModels, const Scalar squarePixelErrorAssignmentThreshold, std::vector<IndexSet32>* usedIndicesPerHomography, bool refineHomographies, bool approximatedNeighborSearch, Ocean::RandomGenerator* randomGenerator)
+inline void JLinkage::PreferenceSets::insert(const size_t setIndex, const Index32 pointIndex)
+{
+	ocean_assert(setIndex < sizes_.size());
+	ocean_assert(size_t(pointIndex / 64u) < numberBlocks_);
+
+	uint64_t& block = bits_[setIndex * numberBlocks_ + size_t(pointIndex / 64u)];
+	const uint64_t mask = uint64_t(1) << uint64_t(pointIndex % 64u);
+
+	if ((block & mask) == 0ull)
+	{
+		block |= mask;
+		++sizes_[setIndex];
+
+		std::pair<size_t, size_t>& blockRange = blockRanges_[setIndex];
+
+		blockRange.first = std::min(blockRange.first, size_t(pointIndex / 64u));
+		blockRange.second = std::max(blockRange.second, size_t(pointIndex / 64u) + 1);
+	}
+}
+
+inline size_t JLinkage::PreferenceSets::numberSets() const
+{
+	return sizes_.size();
+}
+
+inline bool JLinkage::LinkageCandidate::operator>(const LinkageCandidate& candidate) const
+{
+	if (distance_ != candidate.distance_)
+	{
+		return distance_ > candidate.distance_;
+	}
+
+	if (indexA_ != candidate.indexA_)
+	{
+		return indexA_ > candidate.indexA_;
+	}
+
+	return indexB_ > candidate.indexB_;
+}
+
+inline bool JLinkage::homographyMatrices(const Vector2* leftImagePoints, const Vector2* rightImagePoints, const size_t correspondences, const unsigned int width, const unsigned int height, SquareMatrices3 & homographies, const unsigned int testCandidates, const Indices32& leftPointIndicesForInitialModels, const Scalar squarePixelErrorAssignmentThreshold, std::vector<IndexSet32>* usedIndicesPerHomography, bool refineHomographies, bool approximatedNeighborSearch, Ocean::RandomGenerator* randomGenerator, Worker* worker)
 {
 	const Vectors2 leftPointForInitialModels(Subset::subset(leftImagePoints, correspondences, leftPointIndicesForInitialModels));
 
-	return homographyMatrices(leftImagePoints, rightImagePoints, correspondences, width, height, homographies, testCandidates, leftPointForInitialModels, squarePixelErrorAssignmentThreshold, usedIndicesPerHomography, refineHomographies, approximatedNeighborSearch, randomGenerator);
+	return homographyMatrices(leftImagePoints, rightImagePoints, correspondences, width, height, homographies, testCandidates, leftPointForInitialModels, squarePixelErrorAssignmentThreshold, usedIndicesPerHomography, refineHomographies, approximatedNeighborSearch, randomGenerator, worker);
 }
 
 inline Scalar JLinkage::jaccardDistance(const IndexSet32& setA, const IndexSet32& setB)
@@ -13,6 +13,7 @@
 #include "ocean/base/Accessor.h"
 
 #include "ocean/math/AnyCamera.h"
+#include "ocean/math/AutomaticDifferentiationVector.h"
 #include "ocean/math/ExponentialMap.h"
 #include "ocean/math/FisheyeCamera.h"
 #include "ocean/math/Matrix.h"
@@ -301,6 +302,21 @@ class OCEAN_GEOMETRY_EXPORT Jacobian
 		template <typename T>
 		static void calculatePoseJacobianRodrigues2nx6IF(T* jacobian, const AnyCameraT<T>& camera, const PoseT<T>& flippedCamera_P_world, const VectorT3<T>* objectPoints, const size_t numberObjectPoints);
 
+		/**
+		 * Calculates all jacobian rows for a given (flexible) 6-DOF camera pose with a static camera profile and several static 3D object points and projects the object points in the same pass.
+		 * The projection and the point jacobians are determined in batches with one call of the camera model per batch, so that the camera does not need to be invoked twice per object point.<br>
+		 * The resulting jacobian rows have the same form as in calculatePoseJacobianRodrigues2nx6IF().
+		 * @param jacobian First element in the first row of the (row major aligned) jacobian matrix, with 2 * numberObjectPoints rows and 6 columns
+		 * @param imagePoints The resulting projected image points, one for each object point, must be valid
+		 * @param camera The camera profile defining the projection, must be valid
+		 * @param flippedCamera_P_world The inverted and flipped pose to determine the jacobian for, with default flipped camera pointing towards the positive z-space with y-axis downwards, must be valid
+		 * @param objectPoints The 3D object points to determine the jacobian for, must be valid
+		 * @param numberObjectPoints The number of given object points, with range [1, infinity)
+		 * @see calculatePoseJacobianRodrigues2nx6IF().
+		 */
+		template <typename T>
+		static void calculatePoseJacobianRodrigues2nx6IF(T* jacobian, VectorT2<T>* imagePoints, const AnyCameraT<T>& camera, const PoseT<T>& flippedCamera_P_world, const VectorT3<T>* objectPoints, const size_t numberObjectPoints);
+
 		/**
 		 * Deprecated.
 		 *
@@ -921,6 +937,32 @@ class OCEAN_GEOMETRY_EXPORT Jacobian
 		 */
 		template <typename T>
 		static void calculateFisheyeDistortNormalized2x2(T* jx, T* jy, const T x, const T y, const T* radialDistortion, const T* tangentialDistortion);
+
+		/**
+		 * Determines the Jacobian of an arbitrary (custom) function by application of forward automatic differentiation.
+		 * The function is evaluated once with parameters holding all tParameters derivatives, so that no hand-derived Jacobian and no numerical differentiation is necessary.<br>
+		 * The function must have the following signature:
+		 * <pre>
+		 * void function(const AutomaticDifferentiationVectorT<T, tParameters, NumericT<T>>* parameters, AutomaticDifferentiationVectorT<T, tParameters, NumericT<T>>* results);
+		 * </pre>
+		 * with 'parameters' providing the tParameters input parameters and 'results' receiving the tDimensions function values.<br>
+		 * The resulting jacobian has the following form:
+		 * <pre>
+		 * | df0 / dp0, df0 / dp1, ..., df0 / dp(tParameters - 1) |
+		 * | df1 / dp0, df1 / dp1, ..., df1 / dp(tParameters - 1) |
+		 * | ...                                                  |
+		 * </pre>
+		 * @param function The function for which the Jacobian will be determined
+		 * @param parameters The tParameters parameters at which the Jacobian will be determined, must be valid
+		 * @param jacobian The resulting row-aligned Jacobian with tDimensions rows and tParameters columns, must be valid
+		 * @param values Optional resulting tDimensions function values, nullptr if not of interest
+		 * @tparam T The data type of a scalar, 'float' or 'double'
+		 * @tparam tParameters The number of parameters of the function, with range [1, infinity)
+		 * @tparam tDimensions The number of function values, with range [1, infinity)
+		 * @tparam TFunction The data type of the function
+		 */
+		template <typename T, size_t tParameters, size_t tDimensions, typename TFunction>
+		static inline void calculateAutomaticJacobian(const TFunction& function, const T* parameters, T* jacobian, T* values = nullptr);
 };
 
 template <typename T>
@@ -940,6 +982,41 @@ inline void Jacobian::calculateObjectTransformation2x6(Scalar* jx, Scalar* jy, c
 	calculateObjectTransformation2x6(jx, jy, pinholeCamera, extrinsicIF, objectPose, objectPoint, Rwx, Rwy, Rwz);
 }
 
+template <typename T, size_t tParameters, size_t tDimensions, typename TFunction>
+inline void Jacobian::calculateAutomaticJacobian(const TFunction& function, const T* parameters, T* jacobian, T* values)
+{
+	static_assert(tParameters >= 1 && tDimensions >= 1, "Invalid dimensions!");
+
+	ocean_assert(parameters != nullptr && jacobian != nullptr);
+
+	using AutoDiff = AutomaticDifferentiationVectorT<T, tParameters, NumericT<T>>;
+
+	AutoDiff autoParameters[tParameters];
+	AutoDiff autoResults[tDimensions];
+
+	for (size_t n = 0; n < tParameters; ++n)
+	{
+		autoParameters[n] = AutoDiff(parameters[n], n);
+	}
+
+	function((const AutoDiff*)(autoParameters), (AutoDiff*)(autoResults));
+
+	for (size_t d = 0; d < tDimensions; ++d)
+	{
+		const T* const derivatives = autoResults[d].derivatives();
+
+		for (size_t n = 0; n < tParameters; ++n)
+		{
+			jacobian[d * tParameters + n] = derivatives[n];
+		}
+
+		if (values != nullptr)
+		{
+			values[d] = autoResults[d].value();
+		}
+	}
+}
+
 inline void Geometry::Jacobian::calculateSimilarityJacobian2x4(Scalar* jx, Scalar* jy, const Scalar x, const Scalar y, const SquareMatrix3& similarity)
 {
 	ocean_assert(jx != nullptr && jy != nullptr);
@@ -627,6 +627,45 @@ class OCEAN_GEOMETRY_EXPORT NonLinearOptimization
 		 * @return Resulting averaged robust error of the entire data set
 		 */
 		static inline Scalar sqrErrors2robustErrors_i(const Estimator::EstimatorType estimator, const Scalars& sqrErrors, const size_t modelParameters, const size_t dimension, Scalar* weightedErrors_i, Scalar* weightVectors_i, const Matrix* transposedInvertedCovariances_i);
+
+		/**
+		 * Invokes a dense Levenberg-Marquardt optimization with mixed precision for models with few parameters.
+		 * The provider determines the normal equations with double precision (e.g., based on TFloat Jacobians and residuals), the normal equations are solved with solveMixedPrecision().<br>
+		 * The provider must implement the following functions:
+		 * <pre>
+		 * void determineNormalEquations(double* JTJ, double* jErrors) const;   // the upper triangle of the tModelSize x tModelSize matrix J^T * diag(weights) * J and J^T * diag(weights) * errors, for the current model
+		 * void applyCorrection(const double* deltas);                         // candidate = model - deltas
+		 * double determineRobustError();                                      // the averaged robust error of the candidate model, a negative value if the candidate model is invalid, the initial candidate is the initial model
+		 * void acceptCorrection();                                            // model = candidate
+		 * </pre>
+		 * @param provider The optimization provider that is used during the optimization
+		 * @param iterations Number of optimization iterations, with range [1, infinity)
+		 * @param lambda Initial Levenberg-Marquardt damping value which may be changed after each iteration using the damping factor, with range [0, infinity)
+		 * @param lambdaFactor Levenberg-Marquardt damping factor to be applied to the damping value, with range [1, infinity)
+		 * @param initialError Optional resulting averaged robust error for the given initial parameters
+		 * @param finalError Optional resulting averaged robust error for the final optimized parameters
+		 * @return True, if at least one successful optimization iteration has been executed
+		 * @tparam TFloat The data type of the factorization, either 'float' or 'double'
+		 * @tparam tModelSize The number of model parameters, with range [1, infinity)
+		 * @tparam TProvider The data type of the optimization provider
+		 */
+		template <typename TFloat, size_t tModelSize, typename TProvider>
+		static bool mixedPrecisionDenseOptimization(TProvider& provider, const unsigned int iterations, double lambda, const double lambdaFactor, double* initialError = nullptr, double* finalError = nullptr);
+
+		/**
+		 * Solves a small symmetric positive definite linear system A * x = b with mixed precision.
+		 * The Cholesky factorization and the triangular solves are applied with TFloat precision, while the residuals b - A * x of the iterative refinement are determined with double precision.<br>
+		 * Thus, the solution reaches almost double precision as long as the system is well-conditioned w.r.t. TFloat.
+		 * @param matrix The symmetric tSize x tSize matrix A, row-major, must be valid
+		 * @param vector The right side b, with tSize elements, must be valid
+		 * @param solution The resulting solution x, with tSize elements, must be valid
+		 * @param refinementIterations The number of refinement iterations to be applied after the initial solve, with range [0, infinity)
+		 * @return True, if succeeded; False, if the matrix is not positive definite w.r.t. TFloat
+		 * @tparam TFloat The data type of the factorization, either 'float' or 'double'
+		 * @tparam tSize The size of the linear system, with range [1, infinity)
+		 */
+		template <typename TFloat, size_t tSize>
+		static bool solveMixedPrecision(const double* matrix, const double* vector, double* solution, const unsigned int refinementIterations = 2u);
 };
 
 template <typename TFirst, typename TSecond>
@@ -1909,6 +1948,252 @@ inline Scalar NonLinearOptimization::sqrErrors2robustErrors_i(const Estimator::E
 	}
 }
 
+template <typename TFloat, size_t tSize>
+bool NonLinearOptimization::solveMixedPrecision(const double* matrix, const double* vector, double* solution, const unsigned int refinementIterations)
+{
+	static_assert(std::is_floating_point<TFloat>::value, "Invalid data type!");
+	static_assert(tSize >= 1, "Invalid size!");
+
+	ocean_assert(matrix != nullptr && vector != nullptr && solution != nullptr);
+
+	// A = L * L^T, with TFloat precision
+
+	TFloat lower[tSize * tSize];
+
+	for (size_t c = 0; c < tSize; ++c)
+	{
+		TFloat diagonal = TFloat(matrix[c * tSize + c]);
+
+		for (size_t k = 0; k < c; ++k)
+		{
+			diagonal -= lower[c * tSize + k] * lower[c * tSize + k];
+		}
+
+		if (diagonal <= NumericT<TFloat>::eps())
+		{
+			return false;
+		}
+
+		diagonal = NumericT<TFloat>::sqrt(diagonal);
+		lower[c * tSize + c] = diagonal;
+
+		for (size_t r = c + 1; r < tSize; ++r)
+		{
+			TFloat value = TFloat(matrix[r * tSize + c]);
+
+			for (size_t k = 0; k < c; ++k)
+			{
+				value -= lower[r * tSize + k] * lower[c * tSize + k];
+			}
+
+			lower[r * tSize + c] = value / diagonal;
+		}
+	}
+
+	double residual[tSize];
+
+	for (size_t n = 0; n < tSize; ++n)
+	{
+		residual[n] = vector[n];
+		solution[n] = 0.0;
+	}
+
+	for (unsigned int iteration = 0u; iteration <= refinementIterations; ++iteration)
+	{
+		// L * L^T * correction = residual, with TFloat precision
+
+		TFloat correction[tSize];
+
+		for (size_t r = 0; r < tSize; ++r)
+		{
+			TFloat value = TFloat(residual[r]);
+
+			for (size_t k = 0; k < r; ++k)
+			{
+				value -= lower[r * tSize + k] * correction[k];
+			}
+
+			correction[r] = value / lower[r * tSize + r];
+		}
+
+		for (size_t r = tSize - 1; r < tSize; --r)
+		{
+			TFloat value = correction[r];
+
+			for (size_t k = r + 1; k < tSize; ++k)
+			{
+				value -= lower[k * tSize + r] * correction[k];
+			}
+
+			correction[r] = value / lower[r * tSize + r];
+		}
+
+		for (size_t n = 0; n < tSize; ++n)
+		{
+			solution[n] += double(correction[n]);
+		}
+
+		if (iteration == refinementIterations)
+		{
+			break;
+		}
+
+		// residual = b - A * x, with double precision
+
+		for (size_t r = 0; r < tSize; ++r)
+		{
+			double value = vector[r];
+
+			for (size_t c = 0; c < tSize; ++c)
+			{
+				value -= matrix[r * tSize + c] * solution[c];
+			}
+
+			residual[r] = value;
+		}
+	}
+
+	return true;
+}
+
+template <typename TFloat, size_t tModelSize, typename TProvider>
+bool NonLinearOptimization::mixedPrecisionDenseOptimization(TProvider& provider, const unsigned int iterations, double lambda, const double lambdaFactor, double* initialError, double* finalError)
+{
+	ocean_assert(iterations >= 1u);
+	ocean_assert(lambda >= 0.0 && lambdaFactor >= 1.0);
+
+	constexpr double maxLambda = 1e8;
+
+	double bestError = provider.determineRobustError();
+
+	if (initialError != nullptr)
+	{
+		*initialError = bestError;
+	}
+
+	if (bestError < 0.0)
+	{
+		return false;
+	}
+
+	// the initial candidate is identical to the initial model, accepting it stores the initial errors and weights
+	provider.acceptCorrection();
+
+	bool oneValidIteration = false;
+
+	double JTJ[tModelSize * tModelSize];
+	double dampedJTJ[tModelSize * tModelSize];
+	double jErrors[tModelSize];
+	double deltas[tModelSize];
+
+	unsigned int i = 0u;
+
+	while (i < iterations)
+	{
+		for (double& value : JTJ)
+		{
+			value = 0.0;
+		}
+
+		for (double& value : jErrors)
+		{
+			value = 0.0;
+		}
+
+		provider.determineNormalEquations(JTJ, jErrors);
+
+		for (size_t r = 1; r < tModelSize; ++r)
+		{
+			for (size_t c = 0; c < r; ++c)
+			{
+				JTJ[r * tModelSize + c] = JTJ[c * tModelSize + r];
+			}
+		}
+
+		while (i < iterations)
+		{
+			++i;
+
+			// J^T * J + lambda * diag(J^T * J)
+
+			for (size_t n = 0; n < tModelSize * tModelSize; ++n)
+			{
+				dampedJTJ[n] = JTJ[n];
+			}
+
+			if (lambda > NumericD::eps())
+			{
+				for (size_t n = 0; n < tModelSize; ++n)
+				{
+					dampedJTJ[n * tModelSize + n] *= 1.0 + lambda;
+				}
+			}
+
+			if (solveMixedPrecision<TFloat, tModelSize>(dampedJTJ, jErrors, deltas))
+			{
+				oneValidIteration = true;
+
+				double deltasNorm = 0.0;
+				for (const double delta : deltas)
+				{
+					deltasNorm += NumericD::abs(delta);
+				}
+
+				// check whether the offset has been converged
+				if (NumericD::isEqualEps(deltasNorm / double(tModelSize)))
+				{
+					i = iterations;
+				}
+
+				// we apply the deltas by: new = old - deltas
+				provider.applyCorrection(deltas);
+
+				const double iterationError = provider.determineRobustError();
+
+				if (iterationError < 0.0 || iterationError >= bestError)
+				{
+					if (lambdaFactor > NumericD::eps() && lambda > 0.0 && lambda <= maxLambda)
+					{
+						lambda *= lambdaFactor;
+					}
+					else
+					{
+						i = iterations;
+					}
+
+					continue;
+				}
+
+				bestError = iterationError;
+
+				provider.acceptCorrection();
+
+				if (NumericD::isNotEqualEps(lambdaFactor) && lambda > NumericD::eps())
+				{
+					lambda /= lambdaFactor;
+				}
+
+				break;
+			}
+			else if (lambda > NumericD::eps() && lambda <= maxLambda)
+			{
+				lambda *= lambdaFactor;
+			}
+			else
+			{
+				i = iterations;
+			}
+		}
+	}
+
+	if (finalError != nullptr)
+	{
+		*finalError = bestError;
+	}
+
+	return oneValidIteration;
+}
+
 }
 
 }
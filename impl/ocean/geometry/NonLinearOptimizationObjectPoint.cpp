@@ -3630,7 +3630,1093 @@ class NonLinearOptimizationObjectPoint::ObjectPointsPosesProvider : public NonLi
 #endif
 };
 
-bool NonLinearOptimizationObjectPoint::optimizeObjectPointsAndPoses(const ConstIndexedAccessor<const AnyCamera*>& cameras, const ConstIndexedAccessor<HomogenousMatrix4>& world_T_cameras, const ConstIndexedAccessor<Vector3>& objectPoints, const ObjectPointGroupsAccessor& correspondenceGroups, NonconstIndexedAccessor<HomogenousMatrix4>* world_T_optimizedCameras, NonconstIndexedAccessor<Vector3>* optimizedObjectPoints, const unsigned int iterations, const Geometry::Estimator::EstimatorType estimator, const Scalar lambda, const Scalar lambdaFactor, const bool onlyFrontObjectPoints, Scalar* initialError, Scalar* finalError, Scalars* intermediateErrors, const bool applyAbsolutePoseAlignment)
+/**
+ * This class implements an optimization provider allowing to optimize several 6-DOF camera poses and 3-DOF object points concurrently, for large Bundle Adjustment problems.
+ * In contrast to ObjectPointsPosesProvider, this provider stores the pose/point sub-matrices of the Hessian for the individual observations only, and holds the reduced camera system as block-sparse matrix with one 6x6 block for each pair of co-visible camera poses.<br>
+ * Thus, memory and computation time scale with the number of observations and co-visible pose pairs, and not with the number of poses times the number of object points.<br>
+ * The reduced camera system is solved either with a dense direct solver or with a conjugate gradient solver using a block-Jacobi preconditioner.<br>
+ * The Jacobians, the Schur complement, and the back substitution can be distributed with a worker.
+ * We divide the sparse Hessian matrix into four sub-matrices:
+ *     |  A  B |
+ * H = | B^T D |, with block-diagonal matrices A (6x6 blocks, one for each pose) and D (3x3 blocks, one for each object point)
+ *
+ * @tparam tEstimator The type of the estimator to be used
+ */
+template <Estimator::EstimatorType tEstimator>
+class NonLinearOptimizationObjectPoint::BlockSparseObjectPointsPosesProvider : public NonLinearOptimization::AdvancedSparseOptimizationProvider
+{
+	public:
+
+		/**
+		 * Creates a new provider object.
+		 * @param cameras The camera profiles defining the projection, one for each camera pose, must be valid
+		 * @param flippedCameras_T_world The inverted and flipped camera poses which will be optimized, with default camera pointing towards the positive z-space with y-axis downwards, at least two
+		 * @param objectPointAccessor The 3D object point locations which will be optimized
+		 * @param correspondenceGroups The accessor for the individual groups of correspondences between pose indices and image point location, one group for each object point
+		 * @param onlyFrontObjectPoints True, to ensure that all 3D object point locations will lie in front of all cameras
+		 * @param gravityConstraints Optional gravity constraints to force the optimization to create a camera pose aligned with gravity, nullptr to avoid any gravity alignment
+		 * @param schurSolver The solver to be used for the reduced camera system, either SS_BLOCK_SPARSE_DIRECT or SS_BLOCK_SPARSE_CONJUGATE_GRADIENT
+		 * @param worker Optional worker object to distribute the computation
+		 */
+		BlockSparseObjectPointsPosesProvider(const ConstIndexedAccessor<const AnyCamera*>& cameras, NonconstTemplateArrayAccessor<HomogenousMatrix4>& flippedCameras_T_world, NonconstTemplateArrayAccessor<Vector3>& objectPointAccessor, const ObjectPointGroupsAccessor& correspondenceGroups, const bool onlyFrontObjectPoints, const GravityConstraints* gravityConstraints, const SchurSolver schurSolver, Worker* worker) :
+			cameras_(cameras),
+			flippedCameras_T_world_(flippedCameras_T_world),
+			candidateFlippedCameras_T_world_(Accessor::accessor2elements(flippedCameras_T_world)),
+			objectPoints_(objectPointAccessor),
+			objectPointCandidates_(Accessor::accessor2elements(objectPointAccessor)),
+			onlyFrontObjectPoints_(onlyFrontObjectPoints),
+			gravityConstraints_(gravityConstraints),
+			schurSolver_(schurSolver),
+			worker_(worker)
+		{
+			ocean_assert(schurSolver_ == SS_BLOCK_SPARSE_DIRECT || schurSolver_ == SS_BLOCK_SPARSE_CONJUGATE_GRADIENT);
+
+			const size_t numberPoses = flippedCameras_T_world.size();
+			const size_t numberObjectPoints = correspondenceGroups.groups();
+
+			// we copy the observations once, so that the (virtual) accessor is not used during the optimization
+
+			groupOffsets_.reserve(numberObjectPoints + 1);
+			groupOffsets_.emplace_back(0u);
+
+			Index32 poseId;
+			Vector2 imagePoint;
+
+			Indices32 observationsInPoses(numberPoses, 0u);
+
+			for (size_t o = 0; o < numberObjectPoints; ++o)
+			{
+				for (size_t p = 0; p < correspondenceGroups.groupElements(o); ++p)
+				{
+					correspondenceGroups.element(o, p, poseId, imagePoint);
+					ocean_assert(poseId < numberPoses);
+
+					observationPoseIndices_.emplace_back(poseId);
+					observationObjectPointIndices_.emplace_back(Index32(o));
+					observationImagePoints_.emplace_back(imagePoint);
+
+					++observationsInPoses[poseId];
+				}
+
+				groupOffsets_.emplace_back(Index32(observationPoseIndices_.size()));
+			}
+
+			const size_t numberObservations = observationPoseIndices_.size();
+
+			// the observations of each pose, so that the individual poses can be handled in parallel
+
+			poseObservationOffsets_.resize(numberPoses + 1);
+			poseObservationOffsets_[0] = 0u;
+
+			for (size_t p = 0; p < numberPoses; ++p)
+			{
+				poseObservationOffsets_[p + 1] = poseObservationOffsets_[p] + observationsInPoses[p];
+			}
+
+			poseObservations_.resize(numberObservations);
+
+			Indices32 poseObservationPositions(poseObservationOffsets_.cbegin(), poseObservationOffsets_.cend() - 1);
+
+			for (size_t i = 0; i < numberObservations; ++i)
+			{
+				poseObservations_[poseObservationPositions[observationPoseIndices_[i]]++] = Index32(i);
+			}
+
+			// the structure of the reduced camera system, one 6x6 block for each pair of poses observing at least one common object point
+
+			reducedRowOffsets_.reserve(numberPoses + 1);
+			reducedRowOffsets_.emplace_back(0u);
+
+			Indices32 rowColumns;
+
+			for (size_t p = 0; p < numberPoses; ++p)
+			{
+				rowColumns.clear();
+				rowColumns.emplace_back(Index32(p));
+
+				for (Index32 n = poseObservationOffsets_[p]; n < poseObservationOffsets_[p + 1]; ++n)
+				{
+					const Index32 objectPointIndex = observationObjectPointIndices_[poseObservations_[n]];
+
+					for (Index32 j = groupOffsets_[objectPointIndex]; j < groupOffsets_[objectPointIndex + 1]; ++j)
+					{
+						rowColumns.emplace_back(observationPoseIndices_[j]);
+					}
+				}
+
+				std::sort(rowColumns.begin(), rowColumns.end());
+				rowColumns.erase(std::unique(rowColumns.begin(), rowColumns.end()), rowColumns.end());
+
+				reducedColumns_.insert(reducedColumns_.cend(), rowColumns.cbegin(), rowColumns.cend());
+				reducedRowOffsets_.emplace_back(Index32(reducedColumns_.size()));
+			}
+
+			reducedBlocks_.resize(reducedColumns_.size());
+
+			intermediateErrors_.resize(numberObservations);
+			intermediateSqrErrors_.resize(numberObservations);
+			intermediateWeights_.resize(numberObservations, Scalar(1));
+			poseJacobians_.resize(numberObservations * 12);
+			matricesB_.resize(numberObservations);
+
+			matricesA_.resize(numberPoses);
+			diagonalMatricesA_.resize(numberPoses * 6);
+			rotationRodriguesDerivatives_.resize(numberPoses * 3);
+
+			matricesD_.resize(numberObjectPoints);
+			invertedMatricesD_.resize(numberObjectPoints);
+			invertedMatrixDErrors_.resize(numberObjectPoints);
+
+			jacobianErrorVector_.resize(numberPoses * 6 + numberObjectPoints * 3);
+
+			if (gravityConstraints_ != nullptr)
+			{
+				constexpr Scalar fixedFactor = Scalar(1000); // fixed factor to balance projection error and gravity error, same as in ObjectPointsPosesProvider
+
+				ocean_assert(numberPoses == gravityConstraints_->numberCameras());
+
+				gravityWeights_.resize(numberPoses);
+
+				for (size_t p = 0; p < numberPoses; ++p)
+				{
+					gravityWeights_[p] = Numeric::sqrt(Scalar(observationsInPoses[p] * 2)) * fixedFactor * gravityConstraints_->weightFactor();
+				}
+			}
+		}
+
+		/**
+		 * Determines the error for the current model candidate (not the actual/actual model).
+		 * @see AdvancedSparseOptimizationProvider::determineError().
+		 */
+		Scalar determineError()
+		{
+			if (worker_ != nullptr)
+			{
+				worker_->executeFunction(Worker::Function::create(*this, &BlockSparseObjectPointsPosesProvider<tEstimator>::determineSqrErrorsSubset, 0u, 0u), 0u, (unsigned int)(groupOffsets_.size() - 1));
+			}
+			else
+			{
+				determineSqrErrorsSubset(0u, (unsigned int)(groupOffsets_.size() - 1));
+			}
+
+			const size_t numberProjectionErrors = intermediateSqrErrors_.size();
+			ocean_assert(numberProjectionErrors != 0);
+
+			Scalar averageRobustError = Numeric::maxValue();
+
+			if constexpr (Estimator::isStandardEstimator<tEstimator>())
+			{
+				Scalar sqrError = 0;
+
+				for (const Scalar& intermediateSqrError : intermediateSqrErrors_)
+				{
+					if (intermediateSqrError == Numeric::maxValue())
+					{
+						return Numeric::maxValue();
+					}
+
+					sqrError += intermediateSqrError;
+				}
+
+				averageRobustError = sqrError / Scalar(numberProjectionErrors);
+			}
+			else
+			{
+				for (const Scalar& intermediateSqrError : intermediateSqrErrors_)
+				{
+					if (intermediateSqrError == Numeric::maxValue())
+					{
+						return Numeric::maxValue();
+					}
+				}
+
+				averageRobustError = Estimator::determineRobustError<tEstimator>(intermediateSqrErrors_.data(), intermediateSqrErrors_.size(), numberModelParameters());
+			}
+
+			if (gravityConstraints_ != nullptr)
+			{
+				// averageRobustError is normalized wrt to number of correspondences, so we first have to de-normalize this error
+
+				Scalar sumRobustError = averageRobustError * Scalar(numberProjectionErrors);
+
+				for (size_t p = 0; p < candidateFlippedCameras_T_world_.size(); ++p)
+				{
+					const Vector3 gravityError = gravityConstraints_->worldGravityInFlippedCameraIF(candidateFlippedCameras_T_world_[p]) - gravityConstraints_->cameraGravityInFlippedCamera(p);
+
+					sumRobustError += Numeric::sqr(gravityError.length() * gravityWeights_[p]);
+				}
+
+				averageRobustError = sumRobustError / Scalar(numberProjectionErrors + gravityConstraints_->numberCameras());
+			}
+
+			return averageRobustError;
+		}
+
+		/**
+		 * Determines any kind of (abstract) parameters based on the current/actual model (not the model candidate) e.g., the Jacobian parameters and/or a Hessian matrix.
+		 * @see AdvancedSparseOptimizationProvider::determineParameters().
+		 */
+		bool determineParameters()
+		{
+			const unsigned int numberObjectPoints = (unsigned int)(groupOffsets_.size() - 1);
+			const unsigned int numberPoses = (unsigned int)(matricesA_.size());
+
+			// the candidate model is identical with the current model when this function is invoked
+
+			if (worker_ != nullptr)
+			{
+				worker_->executeFunction(Worker::Function::create(*this, &BlockSparseObjectPointsPosesProvider<tEstimator>::determineErrorsSubset, 0u, 0u), 0u, numberObjectPoints);
+			}
+			else
+			{
+				determineErrorsSubset(0u, numberObjectPoints);
+			}
+
+			if constexpr (!Estimator::isStandardEstimator<tEstimator>())
+			{
+				const Scalar sqrSigma = Estimator::needSigma<tEstimator>() ? Numeric::sqr(Estimator::determineSigmaSquare<tEstimator>(intermediateSqrErrors_.data(), intermediateSqrErrors_.size(), numberModelParameters())) : 0;
+
+				for (size_t n = 0; n < intermediateWeights_.size(); ++n)
+				{
+					// the weight is clamped to ensure that we still can solve the equation, same as in ObjectPointsPosesProvider
+					intermediateWeights_[n] = max(Numeric::weakEps(), Estimator::robustWeightSquare<tEstimator>(intermediateSqrErrors_[n], sqrSigma));
+				}
+			}
+
+			for (size_t p = 0; p < numberPoses; ++p)
+			{
+				const Pose pose(candidateFlippedCameras_T_world_[p]);
+				Jacobian::calculateRotationRodriguesDerivative(ExponentialMap(pose.rx(), pose.ry(), pose.rz()), rotationRodriguesDerivatives_[p * 3 + 0], rotationRodriguesDerivatives_[p * 3 + 1], rotationRodriguesDerivatives_[p * 3 + 2]);
+			}
+
+			// first, the object point blocks are determined in parallel (as each observation belongs to exactly one object point), afterwards the pose blocks
+
+			if (worker_ != nullptr)
+			{
+				worker_->executeFunction(Worker::Function::create(*this, &BlockSparseObjectPointsPosesProvider<tEstimator>::determineObjectPointBlocksSubset, 0u, 0u), 0u, numberObjectPoints);
+				worker_->executeFunction(Worker::Function::create(*this, &BlockSparseObjectPointsPosesProvider<tEstimator>::determinePoseBlocksSubset, 0u, 0u), 0u, numberPoses, 0u, 1u, 1u);
+			}
+			else
+			{
+				determineObjectPointBlocksSubset(0u, numberObjectPoints);
+				determinePoseBlocksSubset(0u, numberPoses);
+			}
+
+			return true;
+		}
+
+		/**
+		 * Creates a new model candidate by adjusting the current/actual model with delta values.
+		 * @see AdvancedSparseOptimizationProvider::applyCorrection().
+		 */
+		void applyCorrection(const Matrix& deltas)
+		{
+			for (size_t n = 0; n < flippedCameras_T_world_.size(); ++n)
+			{
+				const Pose oldPose(flippedCameras_T_world_[n]);
+
+				// p_i+1 = p_i + delta_i
+				// p_i+1 = p_i - (-delta_i)
+				const Pose deltaPose(deltas(n * 6 + 3), deltas(n * 6 + 4), deltas(n * 6 + 5), deltas(n * 6 + 0), deltas(n * 6 + 1), deltas(n * 6 + 2));
+				const Pose newPose(oldPose - deltaPose);
+
+				candidateFlippedCameras_T_world_[n] = newPose.transformation();
+			}
+
+			for (size_t n = 0; n < objectPointCandidates_.size(); ++n)
+			{
+				objectPointCandidates_[n] = objectPoints_[n] - Vector3(deltas.data() + 6 * flippedCameras_T_world_.size() + n * 3);
+			}
+		}
+
+		/**
+		 * Accepts the current model candidate a new (better) model than the previous one.
+		 * @see AdvancedSparseOptimizationProvider::acceptCorrection().
+		 */
+		void acceptCorrection()
+		{
+			ocean_assert(candidateFlippedCameras_T_world_.size() == flippedCameras_T_world_.size());
+			std::copy_n(candidateFlippedCameras_T_world_.data(), flippedCameras_T_world_.size(), flippedCameras_T_world_.data());
+
+			std::copy_n(objectPointCandidates_.data(), objectPointCandidates_.size(), objectPoints_.data());
+		}
+
+		/**
+		 * Returns whether the optimization process should stop e.g., due to an external event.
+		 * @see AdvancedSparseOptimizationProvider::shouldStop().
+		 */
+		inline bool shouldStop()
+		{
+			return false;
+		}
+
+		/**
+		 * Solves the linear equation Hessian * deltas = -jacobianError based on the internal data.
+		 * @see AdvancedSparseOptimizationProvider::solve().
+		 */
+		bool solve(Matrix& deltas, const Scalar lambda)
+		{
+			ocean_assert(lambda >= 0);
+
+			/**
+			 * We solve the equation by applying the Schur complement for the linear equation:
+			 * |  A  B | * |da| = |ra|
+			 * | B^T D | * |db| = |rb|
+			 *
+			 * We solve da by:
+			 * (A - B D^-1 B^T) da = ra - B D^-1 rb
+			 *
+			 * Then we solve db by:
+			 * db = D^-1 (rb - B^T da)
+			 */
+
+			const unsigned int numberObjectPoints = (unsigned int)(matricesD_.size());
+			const unsigned int numberPoses = (unsigned int)(matricesA_.size());
+
+			lambda_ = lambda;
+			invalidMatrixD_ = false;
+
+			deltas.resize(size_t(numberPoses) * 6 + size_t(numberObjectPoints) * 3, 1);
+
+			Scalars reducedErrorVector(size_t(numberPoses) * 6);
+
+			if (worker_ != nullptr)
+			{
+				worker_->executeFunction(Worker::Function::create(*this, &BlockSparseObjectPointsPosesProvider<tEstimator>::invertMatricesDSubset, 0u, 0u), 0u, numberObjectPoints);
+			}
+			else
+			{
+				invertMatricesDSubset(0u, numberObjectPoints);
+			}
+
+			if (invalidMatrixD_)
+			{
+				return false;
+			}
+
+			if (worker_ != nullptr)
+			{
+				worker_->executeFunction(Worker::Function::create(*this, &BlockSparseObjectPointsPosesProvider<tEstimator>::determineReducedSystemSubset, reducedErrorVector.data(), 0u, 0u), 0u, numberPoses, 1u, 2u, 1u);
+			}
+			else
+			{
+				determineReducedSystemSubset(reducedErrorVector.data(), 0u, numberPoses);
+			}
+
+			if (schurSolver_ == SS_BLOCK_SPARSE_CONJUGATE_GRADIENT)
+			{
+				if (!solveReducedSystemConjugateGradient(reducedErrorVector.data(), deltas.data()))
+				{
+					return false;
+				}
+			}
+			else
+			{
+				if (!solveReducedSystemDirect(reducedErrorVector.data(), deltas.data()))
+				{
+					return false;
+				}
+			}
+
+			if (worker_ != nullptr)
+			{
+				worker_->executeFunction(Worker::Function::create(*this, &BlockSparseObjectPointsPosesProvider<tEstimator>::determineObjectPointDeltasSubset, deltas.data(), 0u, 0u), 0u, numberObjectPoints);
+			}
+			else
+			{
+				determineObjectPointDeltasSubset(deltas.data(), 0u, numberObjectPoints);
+			}
+
+			return true;
+		}
+
+	protected:
+
+		/**
+		 * Returns the number of model parameters.
+		 * @return The number of parameters of all poses and object points
+		 */
+		inline size_t numberModelParameters() const
+		{
+			return candidateFlippedCameras_T_world_.size() * 6 + objectPointCandidates_.size() * 3;
+		}
+
+		/**
+		 * Determines the squared projection errors of the model candidate for a subset of the object points.
+		 * A squared error of Numeric::maxValue() is used for object points lying behind a camera (if not allowed).
+		 * @param firstObjectPoint The first object point to be handled
+		 * @param numberObjectPoints The number of object points to be handled
+		 */
+		void determineSqrErrorsSubset(const unsigned int firstObjectPoint, const unsigned int numberObjectPoints)
+		{
+			for (unsigned int o = firstObjectPoint; o < firstObjectPoint + numberObjectPoints; ++o)
+			{
+				const Vector3& objectPoint = objectPointCandidates_[o];
+
+				for (Index32 i = groupOffsets_[o]; i < groupOffsets_[o + 1]; ++i)
+				{
+					const Index32 poseIndex = observationPoseIndices_[i];
+					const HomogenousMatrix4& candidateFlippedCamera_T_world = candidateFlippedCameras_T_world_[poseIndex];
+
+					if (onlyFrontObjectPoints_ && !AnyCamera::isObjectPointInFrontIF(candidateFlippedCamera_T_world, objectPoint))
+					{
+						intermediateSqrErrors_[i] = Numeric::maxValue();
+					}
+					else
+					{
+						intermediateSqrErrors_[i] = Error::determinePoseErrorIF(candidateFlippedCamera_T_world, *cameras_[poseIndex], objectPoint, observationImagePoints_[i]).sqr();
+					}
+				}
+			}
+		}
+
+		/**
+		 * Determines the projection errors of the current model for a subset of the object points.
+		 * @param firstObjectPoint The first object point to be handled
+		 * @param numberObjectPoints The number of object points to be handled
+		 */
+		void determineErrorsSubset(const unsigned int firstObjectPoint, const unsigned int numberObjectPoints)
+		{
+			for (unsigned int o = firstObjectPoint; o < firstObjectPoint + numberObjectPoints; ++o)
+			{
+				const Vector3& objectPoint = objectPointCandidates_[o];
+
+				for (Index32 i = groupOffsets_[o]; i < groupOffsets_[o + 1]; ++i)
+				{
+					const Index32 poseIndex = observationPoseIndices_[i];
+
+					intermediateErrors_[i] = Error::determinePoseErrorIF(candidateFlippedCameras_T_world_[poseIndex], *cameras_[poseIndex], objectPoint, observationImagePoints_[i]);
+					intermediateSqrErrors_[i] = intermediateErrors_[i].sqr();
+				}
+			}
+		}
+
+		/**
+		 * Determines the Jacobians of all observations of a subset of the object points, and the matrices D and B, and the object point part of the error vector.
+		 * @param firstObjectPoint The first object point to be handled
+		 * @param numberObjectPoints The number of object points to be handled
+		 */
+		void determineObjectPointBlocksSubset(const unsigned int firstObjectPoint, const unsigned int numberObjectPoints)
+		{
+			const size_t pointErrorOffset = matricesA_.size() * 6;
+
+			Scalar pointJacobianX[3];
+			Scalar pointJacobianY[3];
+
+			for (unsigned int o = firstObjectPoint; o < firstObjectPoint + numberObjectPoints; ++o)
+			{
+				const Vector3& objectPoint = objectPointCandidates_[o];
+
+				SquareMatrix3& matrixD = matricesD_[o];
+				matrixD.toNull();
+
+				Scalar* pointErrorVector = jacobianErrorVector_.data() + pointErrorOffset + o * 3;
+				pointErrorVector[0] = Scalar(0);
+				pointErrorVector[1] = Scalar(0);
+				pointErrorVector[2] = Scalar(0);
+
+				for (Index32 i = groupOffsets_[o]; i < groupOffsets_[o + 1]; ++i)
+				{
+					const Index32 poseIndex = observationPoseIndices_[i];
+
+					const HomogenousMatrix4& flippedCamera_T_world = candidateFlippedCameras_T_world_[poseIndex];
+					const AnyCamera& camera = *cameras_[poseIndex];
+
+					Scalar* const poseJacobianX = poseJacobians_.data() + size_t(i) * 12;
+					Scalar* const poseJacobianY = poseJacobianX + 6;
+
+					Jacobian::calculatePoseJacobianRodrigues2x6IF(camera, flippedCamera_T_world, objectPoint, rotationRodriguesDerivatives_[poseIndex * 3 + 0], rotationRodriguesDerivatives_[poseIndex * 3 + 1], rotationRodriguesDerivatives_[poseIndex * 3 + 2], poseJacobianX, poseJacobianY);
+					Jacobian::calculatePointJacobian2x3IF(camera, flippedCamera_T_world, objectPoint, pointJacobianX, pointJacobianY);
+
+					const Scalar weight = intermediateWeights_[i];
+					const Vector2 weightedError(intermediateErrors_[i] * weight);
+
+					// we calculate the upper triangle of the symmetric matrix D
+					for (unsigned int r = 0u; r < 3u; ++r)
+					{
+						for (unsigned int c = r; c < 3u; ++c)
+						{
+							matrixD(r, c) += (pointJacobianX[r] * pointJacobianX[c] + pointJacobianY[r] * pointJacobianY[c]) * weight;
+						}
+
+						pointErrorVector[r] += pointJacobianX[r] * weightedError[0] + pointJacobianY[r] * weightedError[1];
+					}
+
+					StaticMatrix6x3& matrixB = matricesB_[i];
+
+					for (unsigned int r = 0u; r < 6u; ++r)
+					{
+						for (unsigned int c = 0u; c < 3u; ++c)
+						{
+							matrixB(r, c) = (poseJacobianX[r] * pointJacobianX[c] + poseJacobianY[r] * pointJacobianY[c]) * weight;
+						}
+					}
+				}
+
+				// we copy the lower triangle of matrix D
+				matrixD(1, 0) = matrixD(0, 1);
+				matrixD(2, 0) = matrixD(0, 2);
+				matrixD(2, 1) = matrixD(1, 2);
+
+				ocean_assert(!matrixD.isNull() && "May indicate that the 3D object points are too far away from the camera(s)");
+			}
+		}
+
+		/**
+		 * Determines the matrices A and the pose part of the error vector for a subset of the poses.
+		 * The Jacobians of all observations must have been determined before.
+		 * @param firstPose The first pose to be handled
+		 * @param numberPoses The number of poses to be handled
+		 */
+		void determinePoseBlocksSubset(const unsigned int firstPose, const unsigned int numberPoses)
+		{
+			for (unsigned int p = firstPose; p < firstPose + numberPoses; ++p)
+			{
+				StaticMatrix6x6& matrixA = matricesA_[p];
+				matrixA.toNull();
+
+				Scalar* poseErrorVector = jacobianErrorVector_.data() + p * 6;
+
+				for (unsigned int n = 0u; n < 6u; ++n)
+				{
+					poseErrorVector[n] = Scalar(0);
+				}
+
+				for (Index32 n = poseObservationOffsets_[p]; n < poseObservationOffsets_[p + 1]; ++n)
+				{
+					const Index32 i = poseObservations_[n];
+
+					const Scalar* const poseJacobianX = poseJacobians_.data() + size_t(i) * 12;
+					const Scalar* const poseJacobianY = poseJacobianX + 6;
+
+					const Scalar weight = intermediateWeights_[i];
+					const Vector2 weightedError(intermediateErrors_[i] * weight);
+
+					// we calculate the upper triangle of the symmetric matrix A
+					for (unsigned int r = 0u; r < 6u; ++r)
+					{
+						for (unsigned int c = r; c < 6u; ++c)
+						{
+							matrixA(r, c) += (poseJacobianX[r] * poseJacobianX[c] + poseJacobianY[r] * poseJacobianY[c]) * weight;
+						}
+
+						poseErrorVector[r] += poseJacobianX[r] * weightedError[0] + poseJacobianY[r] * weightedError[1];
+					}
+				}
+
+				if (gravityConstraints_ != nullptr)
+				{
+					// the gravity error Jacobian with respect to rotation is: d(R * g_world) / dwi = Rwi * g_world, same as in ObjectPointsPosesProvider
+
+					const Scalar gravityWeight = gravityWeights_[p];
+
+					const Vector3 weightedGravityError = (gravityConstraints_->worldGravityInFlippedCameraIF(candidateFlippedCameras_T_world_[p]) - gravityConstraints_->cameraGravityInFlippedCamera(p)) * gravityWeight;
+
+					const Vector3 gravityJacobians[3] =
+					{
+						rotationRodriguesDerivatives_[3 * p + 0] * gravityConstraints_->worldGravityInWorld() * gravityWeight,
+						rotationRodriguesDerivatives_[3 * p + 1] * gravityConstraints_->worldGravityInWorld() * gravityWeight,
+						rotationRodriguesDerivatives_[3 * p + 2] * gravityConstraints_->worldGravityInWorld() * gravityWeight
+					};
+
+					for (unsigned int r = 0u; r < 3u; ++r)
+					{
+						for (unsigned int c = r; c < 3u; ++c)
+						{
+							matrixA(r, c) += gravityJacobians[r] * gravityJacobians[c];
+						}
+
+						poseErrorVector[r] += gravityJacobians[r] * weightedGravityError;
+					}
+				}
+
+				// we copy the lower triangle of matrix A
+				for (unsigned int r = 1u; r < 6u; ++r)
+				{
+					for (unsigned int c = 0u; c < r; ++c)
+					{
+						matrixA(r, c) = matrixA(c, r);
+					}
+				}
+
+				// we make a copy of the diagonal elements of matrix A so that we can apply a lambda later during the solve step
+				for (unsigned int n = 0u; n < 6u; ++n)
+				{
+					diagonalMatricesA_[p * 6 + n] = matrixA(n, n);
+				}
+			}
+		}
+
+		/**
+		 * Inverts the (damped) 3x3 blocks of matrix D and determines D^-1 rb for a subset of the object points.
+		 * @param firstObjectPoint The first object point to be handled
+		 * @param numberObjectPoints The number of object points to be handled
+		 */
+		void invertMatricesDSubset(const unsigned int firstObjectPoint, const unsigned int numberObjectPoints)
+		{
+			const Scalar* pointErrorVector = jacobianErrorVector_.data() + matricesA_.size() * 6;
+
+			for (unsigned int o = firstObjectPoint; o < firstObjectPoint + numberObjectPoints; ++o)
+			{
+				SquareMatrix3& invertedMatrixD = invertedMatricesD_[o];
+				invertedMatrixD = matricesD_[o];
+
+				if (lambda_ > 0)
+				{
+					for (unsigned int n = 0u; n < 3u; ++n)
+					{
+						invertedMatrixD(n, n) *= Scalar(1) + lambda_;
+					}
+				}
+
+				if (!invertedMatrixD.invert())
+				{
+					invalidMatrixD_ = true;
+					return;
+				}
+
+				invertedMatrixDErrors_[o] = invertedMatrixD * Vector3(pointErrorVector + o * 3);
+			}
+		}
+
+		/**
+		 * Determines the block rows of the reduced camera system A - B D^-1 B^T and of the reduced error vector ra - B D^-1 rb, for a subset of the poses.
+		 * Each block row is determined by one thread only, so that no lock is necessary.
+		 * @param reducedErrorVector The resulting reduced error vector, with 6 elements for each pose
+		 * @param firstPose The first pose to be handled
+		 * @param numberPoses The number of poses to be handled
+		 */
+		void determineReducedSystemSubset(Scalar* reducedErrorVector, const unsigned int firstPose, const unsigned int numberPoses)
+		{
+			ocean_assert(reducedErrorVector != nullptr);
+
+			StaticMatrix6x3 intermediate;
+
+			for (unsigned int p = firstPose; p < firstPose + numberPoses; ++p)
+			{
+				const Index32 rowBegin = reducedRowOffsets_[p];
+				const Index32 rowEnd = reducedRowOffsets_[p + 1];
+
+				for (Index32 b = rowBegin; b < rowEnd; ++b)
+				{
+					reducedBlocks_[b].toNull();
+				}
+
+				const Indices32::const_iterator iColumnsBegin = reducedColumns_.cbegin() + rowBegin;
+				const Indices32::const_iterator iColumnsEnd = reducedColumns_.cbegin() + rowEnd;
+
+				const Index32 diagonalBlock = Index32(std::lower_bound(iColumnsBegin, iColumnsEnd, p) - reducedColumns_.cbegin());
+				ocean_assert(diagonalBlock < rowEnd && reducedColumns_[diagonalBlock] == p);
+
+				StaticMatrix6x6& diagonalMatrix = reducedBlocks_[diagonalBlock];
+				diagonalMatrix = matricesA_[p];
+
+				if (lambda_ > 0)
+				{
+					for (unsigned int n = 0u; n < 6u; ++n)
+					{
+						diagonalMatrix(n, n) = diagonalMatricesA_[p * 6 + n] * (Scalar(1) + lambda_);
+					}
+				}
+
+				Scalar* poseReducedErrorVector = reducedErrorVector + p * 6;
+
+				for (unsigned int n = 0u; n < 6u; ++n)
+				{
+					poseReducedErrorVector[n] = jacobianErrorVector_[p * 6 + n];
+				}
+
+				for (Index32 n = poseObservationOffsets_[p]; n < poseObservationOffsets_[p + 1]; ++n)
+				{
+					const Index32 i = poseObservations_[n];
+					const Index32 objectPointIndex = observationObjectPointIndices_[i];
+
+					const StaticMatrix6x3& matrixB = matricesB_[i];
+					const SquareMatrix3& invertedMatrixD = invertedMatricesD_[objectPointIndex];
+					const Vector3& invertedMatrixDError = invertedMatrixDErrors_[objectPointIndex];
+
+					// intermediate = B_i * D^-1
+
+					for (unsigned int r = 0u; r < 6u; ++r)
+					{
+						for (unsigned int c = 0u; c < 3u; ++c)
+						{
+							intermediate(r, c) = matrixB(r, 0) * invertedMatrixD(0, c) + matrixB(r, 1) * invertedMatrixD(1, c) + matrixB(r, 2) * invertedMatrixD(2, c);
+						}
+
+						poseReducedErrorVector[r] -= matrixB(r, 0) * invertedMatrixDError[0] + matrixB(r, 1) * invertedMatrixDError[1] + matrixB(r, 2) * invertedMatrixDError[2];
+					}
+
+					for (Index32 j = groupOffsets_[objectPointIndex]; j < groupOffsets_[objectPointIndex + 1]; ++j)
+					{
+						const Index32 block = Index32(std::lower_bound(iColumnsBegin, iColumnsEnd, observationPoseIndices_[j]) - reducedColumns_.cbegin());
+						ocean_assert(block < rowEnd && reducedColumns_[block] == observationPoseIndices_[j]);
+
+						StaticMatrix6x6& reducedBlock = reducedBlocks_[block];
+						const StaticMatrix6x3& matrixB2 = matricesB_[j];
+
+						// reducedBlock -= B_i * D^-1 * B_j^T
+
+						for (unsigned int r = 0u; r < 6u; ++r)
+						{
+							for (unsigned int c = 0u; c < 6u; ++c)
+							{
+								reducedBlock(r, c) -= intermediate(r, 0) * matrixB2(c, 0) + intermediate(r, 1) * matrixB2(c, 1) + intermediate(r, 2) * matrixB2(c, 2);
+							}
+						}
+					}
+				}
+			}
+		}
+
+		/**
+		 * Determines the deltas of a subset of the object points, once the deltas of the poses are known.
+		 * @param deltas The deltas of all poses followed by the deltas of all object points
+		 * @param firstObjectPoint The first object point to be handled
+		 * @param numberObjectPoints The number of object points to be handled
+		 */
+		void determineObjectPointDeltasSubset(Scalar* deltas, const unsigned int firstObjectPoint, const unsigned int numberObjectPoints)
+		{
+			ocean_assert(deltas != nullptr);
+
+			const size_t pointOffset = matricesA_.size() * 6;
+
+			for (unsigned int o = firstObjectPoint; o < firstObjectPoint + numberObjectPoints; ++o)
+			{
+				// db = D^-1 (rb - B^T da)
+
+				Vector3 intermediateError(jacobianErrorVector_.data() + pointOffset + o * 3);
+
+				for (Index32 i = groupOffsets_[o]; i < groupOffsets_[o + 1]; ++i)
+				{
+					const StaticMatrix6x3& matrixB = matricesB_[i];
+					const Scalar* poseDeltas = deltas + observationPoseIndices_[i] * 6;
+
+					for (unsigned int t = 0u; t < 6u; ++t)
+					{
+						intermediateError[0] -= matrixB(t, 0) * poseDeltas[t];
+						intermediateError[1] -= matrixB(t, 1) * poseDeltas[t];
+						intermediateError[2] -= matrixB(t, 2) * poseDeltas[t];
+					}
+				}
+
+				const Vector3 objectPointDelta(invertedMatricesD_[o] * intermediateError);
+
+				deltas[pointOffset + o * 3 + 0] = objectPointDelta[0];
+				deltas[pointOffset + o * 3 + 1] = objectPointDelta[1];
+				deltas[pointOffset + o * 3 + 2] = objectPointDelta[2];
+			}
+		}
+
+		/**
+		 * Solves the reduced camera system with a dense direct solver.
+		 * @param reducedErrorVector The reduced error vector, with 6 elements for each pose
+		 * @param poseDeltas The resulting deltas of all poses, with 6 elements for each pose
+		 * @return True, if succeeded
+		 */
+		bool solveReducedSystemDirect(const Scalar* reducedErrorVector, Scalar* poseDeltas) const
+		{
+			const size_t numberPoses = matricesA_.size();
+
+			Matrix left(numberPoses * 6, numberPoses * 6, false);
+
+			for (size_t p = 0; p < numberPoses; ++p)
+			{
+				for (Index32 b = reducedRowOffsets_[p]; b < reducedRowOffsets_[p + 1]; ++b)
+				{
+					const StaticMatrix6x6& reducedBlock = reducedBlocks_[b];
+					const size_t columnOffset = size_t(reducedColumns_[b]) * 6;
+
+					for (size_t r = 0; r < 6; ++r)
+					{
+						memcpy(left[p * 6 + r] + columnOffset, reducedBlock.row(r), sizeof(Scalar) * 6);
+					}
+				}
+			}
+
+			ocean_assert(left.isSymmetric(Numeric::weakEps()));
+
+			return left.solve<Matrix::MP_SYMMETRIC>(reducedErrorVector, poseDeltas);
+		}
+
+		/**
+		 * Solves the reduced camera system with a conjugate gradient solver using a block-Jacobi preconditioner.
+		 * @param reducedErrorVector The reduced error vector, with 6 elements for each pose
+		 * @param poseDeltas The resulting deltas of all poses, with 6 elements for each pose
+		 * @return True, if succeeded
+		 */
+		bool solveReducedSystemConjugateGradient(const Scalar* reducedErrorVector, Scalar* poseDeltas)
+		{
+			const size_t numberPoses = matricesA_.size();
+			const size_t size = numberPoses * 6;
+
+			// the preconditioner is the inverse of the 6x6 diagonal blocks of the reduced camera system
+
+			Matrices preconditioners(numberPoses);
+
+			for (size_t p = 0; p < numberPoses; ++p)
+			{
+				const Index32 diagonalBlock = Index32(std::lower_bound(reducedColumns_.cbegin() + reducedRowOffsets_[p], reducedColumns_.cbegin() + reducedRowOffsets_[p + 1], Index32(p)) - reducedColumns_.cbegin());
+				ocean_assert(reducedColumns_[diagonalBlock] == p);
+
+				preconditioners[p] = Matrix(6, 6, reducedBlocks_[diagonalBlock].data());
+
+				if (!preconditioners[p].invert())
+				{
+					return false;
+				}
+			}
+
+			Scalars residual(reducedErrorVector, reducedErrorVector + size);
+			Scalars preconditionedResidual(size);
+			Scalars direction(size);
+			Scalars reducedDirection(size);
+
+			for (size_t p = 0; p < numberPoses; ++p)
+			{
+				multiplyPreconditioner(preconditioners[p], residual.data() + p * 6, preconditionedResidual.data() + p * 6);
+			}
+
+			direction = preconditionedResidual;
+
+			memset(poseDeltas, 0x00, sizeof(Scalar) * size);
+
+			const Scalar sqrErrorNorm = dotProduct(residual.data(), residual.data(), size);
+
+			if (sqrErrorNorm == Scalar(0))
+			{
+				return true;
+			}
+
+			const Scalar relativeSqrTolerance = std::is_same<Scalar, double>::value ? Scalar(1e-16) : Scalar(1e-10);
+
+			const size_t maximalIterations = std::min(size, size_t(1000));
+
+			Scalar residualDotPreconditionedResidual = dotProduct(residual.data(), preconditionedResidual.data(), size);
+
+			for (size_t iteration = 0; iteration < maximalIterations; ++iteration)
+			{
+				if (worker_ != nullptr)
+				{
+					worker_->executeFunction(Worker::Function::create(*this, &BlockSparseObjectPointsPosesProvider<tEstimator>::multiplyReducedSystemSubset, (const Scalar*)(direction.data()), reducedDirection.data(), 0u, 0u), 0u, (unsigned int)(numberPoses), 2u, 3u, 1u);
+				}
+				else
+				{
+					multiplyReducedSystemSubset(direction.data(), reducedDirection.data(), 0u, (unsigned int)(numberPoses));
+				}
+
+				const Scalar denominator = dotProduct(direction.data(), reducedDirection.data(), size);
+
+				if (Numeric::isEqualEps(denominator))
+				{
+					break;
+				}
+
+				const Scalar alpha = residualDotPreconditionedResidual / denominator;
+
+				for (size_t n = 0; n < size; ++n)
+				{
+					poseDeltas[n] += alpha * direction[n];
+					residual[n] -= alpha * reducedDirection[n];
+				}
+
+				if (dotProduct(residual.data(), residual.data(), size) <= sqrErrorNorm * relativeSqrTolerance)
+				{
+					break;
+				}
+
+				for (size_t p = 0; p < numberPoses; ++p)
+				{
+					multiplyPreconditioner(preconditioners[p], residual.data() + p * 6, preconditionedResidual.data() + p * 6);
+				}
+
+				const Scalar newResidualDotPreconditionedResidual = dotProduct(residual.data(), preconditionedResidual.data(), size);
+
+				const Scalar beta = newResidualDotPreconditionedResidual / residualDotPreconditionedResidual;
+				residualDotPreconditionedResidual = newResidualDotPreconditionedResidual;
+
+				for (size_t n = 0; n < size; ++n)
+				{
+					direction[n] = preconditionedResidual[n] + beta * direction[n];
+				}
+			}
+
+			return true;
+		}
+
+		/**
+		 * Multiplies a subset of the block rows of the reduced camera system with a vector.
+		 * @param vector The vector to be multiplied, with 6 elements for each pose
+		 * @param result The resulting vector, with 6 elements for each pose
+		 * @param firstPose The first pose (block row) to be handled
+		 * @param numberPoses The number of poses to be handled
+		 */
+		void multiplyReducedSystemSubset(const Scalar* vector, Scalar* result, const unsigned int firstPose, const unsigned int numberPoses) const
+		{
+			for (unsigned int p = firstPose; p < firstPose + numberPoses; ++p)
+			{
+				Scalar* poseResult = result + p * 6;
+
+				for (unsigned int r = 0u; r < 6u; ++r)
+				{
+					poseResult[r] = Scalar(0);
+				}
+
+				for (Index32 b = reducedRowOffsets_[p]; b < reducedRowOffsets_[p + 1]; ++b)
+				{
+					const StaticMatrix6x6& reducedBlock = reducedBlocks_[b];
+					const Scalar* poseVector = vector + reducedColumns_[b] * 6;
+
+					for (unsigned int r = 0u; r < 6u; ++r)
+					{
+						const Scalar* blockRow = reducedBlock.row(r);
+
+						poseResult[r] += blockRow[0] * poseVector[0] + blockRow[1] * poseVector[1] + blockRow[2] * poseVector[2] + blockRow[3] * poseVector[3] + blockRow[4] * poseVector[4] + blockRow[5] * poseVector[5];
+					}
+				}
+			}
+		}
+
+		/**
+		 * Multiplies a 6x6 preconditioner block with a 6-element vector.
+		 * @param preconditioner The 6x6 preconditioner block
+		 * @param vector The vector to multiply, with 6 elements
+		 * @param result The resulting vector, with 6 elements
+		 */
+		static inline void multiplyPreconditioner(const Matrix& preconditioner, const Scalar* vector, Scalar* result)
+		{
+			ocean_assert(preconditioner.rows() == 6 && preconditioner.columns() == 6);
+
+			for (unsigned int r = 0u; r < 6u; ++r)
+			{
+				const Scalar* row = preconditioner[r];
+
+				result[r] = row[0] * vector[0] + row[1] * vector[1] + row[2] * vector[2] + row[3] * vector[3] + row[4] * vector[4] + row[5] * vector[5];
+			}
+		}
+
+		/**
+		 * Returns the dot product between two vectors.
+		 * @param vectorA The first vector
+		 * @param vectorB The second vector
+		 * @param size The number of elements of both vectors
+		 * @return The dot product
+		 */
+		static inline Scalar dotProduct(const Scalar* vectorA, const Scalar* vectorB, const size_t size)
+		{
+			Scalar result = Scalar(0);
+
+			for (size_t n = 0; n < size; ++n)
+			{
+				result += vectorA[n] * vectorB[n];
+			}
+
+			return result;
+		}
+
+	protected:
+
+		/// The camera profiles defining the projection for each individual camera pose.
+		const ConstIndexedAccessor<const AnyCamera*>& cameras_;
+
+		/// The accessor for all camera poses.
+		NonconstTemplateArrayAccessor<HomogenousMatrix4>& flippedCameras_T_world_;
+
+		/// The candidate cameras poses.
+		HomogenousMatrices4 candidateFlippedCameras_T_world_;
+
+		/// The locations of the 3D object points of the most recent succeeded optimization step.
+		NonconstTemplateArrayAccessor<Vector3>& objectPoints_;
+
+		/// The locations of the candidate object points.
+		Vectors3 objectPointCandidates_;
+
+		/// True, if all 3D object points (before and after optimization) must lie in front of all cameras.
+		const bool onlyFrontObjectPoints_;
+
+		/// The optional gravity constraints.
+		const GravityConstraints* gravityConstraints_ = nullptr;
+
+		/// In case gravity constraints are provided: The constant weight factor for the gravity constraints, one for each camera pose.
+		Scalars gravityWeights_;
+
+		/// The solver to be used for the reduced camera system.
+		const SchurSolver schurSolver_;
+
+		/// The optional worker to distribute the computation.
+		Worker* worker_ = nullptr;
+
+		/// The index of the first observation of each object point, with one additional element holding the number of observations.
+		Indices32 groupOffsets_;
+
+		/// The pose index of each observation.
+		Indices32 observationPoseIndices_;
+
+		/// The object point index of each observation.
+		Indices32 observationObjectPointIndices_;
+
+		/// The image point of each observation.
+		Vectors2 observationImagePoints_;
+
+		/// The index of the first element in 'poseObservations_' for each pose, with one additional element.
+		Indices32 poseObservationOffsets_;
+
+		/// The indices of the observations of all poses, sorted by poses.
+		Indices32 poseObservations_;
+
+		/// The index of the first block of each block row of the reduced camera system, with one additional element.
+		Indices32 reducedRowOffsets_;
+
+		/// The block column (pose index) of each block of the reduced camera system, sorted within each block row.
+		Indices32 reducedColumns_;
+
+		/// The 6x6 blocks of the reduced camera system, one for each pair of co-visible poses.
+		StaticMatrices6x6 reducedBlocks_;
+
+		/// The projection errors of all observations.
+		Vectors2 intermediateErrors_;
+
+		/// The squared projection errors of all observations.
+		Scalars intermediateSqrErrors_;
+
+		/// The robust weights of all observations.
+		Scalars intermediateWeights_;
+
+		/// The 2x6 pose Jacobians of all observations, with 12 elements for each observation.
+		Scalars poseJacobians_;
+
+		/// The 6x3 sub-matrices B of the Hessian matrix, one for each observation.
+		StaticMatrices6x3 matricesB_;
+
+		/// The 6x6 sub-matrices A of the Hessian matrix, one for each pose.
+		StaticMatrices6x6 matricesA_;
+
+		/// The copy of the diagonals of the matrices A.
+		Scalars diagonalMatricesA_;
+
+		/// The 3x3 sub-matrices D of the Hessian matrix, one for each object point.
+		SquareMatrices3 matricesD_;
+
+		/// The inverted (and damped) 3x3 sub-matrices D, one for each object point.
+		SquareMatrices3 invertedMatricesD_;
+
+		/// The products D^-1 rb, one for each object point.
+		Vectors3 invertedMatrixDErrors_;
+
+		/// The Rodrigues derivatives of the rotations of all poses, three for each pose.
+		SquareMatrices3 rotationRodriguesDerivatives_;
+
+		/// The error vector multiplied by the Jacobian matrix.
+		Scalars jacobianErrorVector_;
+
+		/// The lambda value of the current solve step.
+		Scalar lambda_ = Scalar(0);
+
+		/// True, if at least one sub-matrix D could not be inverted during the current solve step.
+		bool invalidMatrixD_ = false;
+};
+
+bool NonLinearOptimizationObjectPoint::optimizeObjectPointsAndPoses(const ConstIndexedAccessor<const AnyCamera*>& cameras, const ConstIndexedAccessor<HomogenousMatrix4>& world_T_cameras, const ConstIndexedAccessor<Vector3>& objectPoints, const ObjectPointGroupsAccessor& correspondenceGroups, NonconstIndexedAccessor<HomogenousMatrix4>* world_T_optimizedCameras, NonconstIndexedAccessor<Vector3>* optimizedObjectPoints, const unsigned int iterations, const Geometry::Estimator::EstimatorType estimator, const Scalar lambda, const Scalar lambdaFactor, const bool onlyFrontObjectPoints, Scalar* initialError, Scalar* finalError, Scalars* intermediateErrors, const bool applyAbsolutePoseAlignment, const SchurSolver schurSolver, Worker* worker)
 {
 	ocean_assert(world_T_optimizedCameras == nullptr || world_T_cameras.size() == world_T_optimizedCameras->size());
 	ocean_assert(optimizedObjectPoints == nullptr || objectPoints.size() == optimizedObjectPoints->size());
@@ -3652,7 +4738,7 @@ bool NonLinearOptimizationObjectPoint::optimizeObjectPointsAndPoses(const ConstI
 	HomogenousMatrices4 flippedOptimizedCameras_T_world;
 	NonconstArrayAccessor<HomogenousMatrix4> optimizedPosesAccessorIF(flippedOptimizedCameras_T_world, world_T_optimizedCameras != nullptr ? world_T_optimizedCameras->size() : 0);
 
-	if (!optimizeObjectPointsAndPosesIF(cameras, ConstArrayAccessor<HomogenousMatrix4>(flippedCamera_T_world), objectPoints, correspondenceGroups, optimizedPosesAccessorIF.pointer(), optimizedObjectPoints, iterations, estimator, lambda, lambdaFactor, onlyFrontObjectPoints, initialError, finalError, intermediateErrors, nullptr /*gravityConstraints*/, applyAbsolutePoseAlignment))
+	if (!optimizeObjectPointsAndPosesIF(cameras, ConstArrayAccessor<HomogenousMatrix4>(flippedCamera_T_world), objectPoints, correspondenceGroups, optimizedPosesAccessorIF.pointer(), optimizedObjectPoints, iterations, estimator, lambda, lambdaFactor, onlyFrontObjectPoints, initialError, finalError, intermediateErrors, nullptr /*gravityConstraints*/, applyAbsolutePoseAlignment, schurSolver, worker))
 	{
 		return false;
 	}
@@ -3668,7 +4754,7 @@ bool NonLinearOptimizationObjectPoint::optimizeObjectPointsAndPoses(const ConstI
 	return true;
 }
 
-bool NonLinearOptimizationObjectPoint::optimizeObjectPointsAndPosesIF(const ConstIndexedAccessor<const AnyCamera*>& cameras, const ConstIndexedAccessor<HomogenousMatrix4>& flippedCameras_T_world, const ConstIndexedAccessor<Vector3>& objectPoints, const ObjectPointGroupsAccessor& correspondenceGroups, NonconstIndexedAccessor<HomogenousMatrix4>* flippedOptimizedCameras_T_world, NonconstIndexedAccessor<Vector3>* optimizedObjectPoints, const unsigned int iterations, const Geometry::Estimator::EstimatorType estimator, const Scalar lambda, const Scalar lambdaFactor, const bool onlyFrontObjectPoints, Scalar* initialError, Scalar* finalError, Scalars* intermediateErrors, const GravityConstraints* gravityConstraints, const bool applyAbsolutePoseAlignment)
+bool NonLinearOptimizationObjectPoint::optimizeObjectPointsAndPosesIF(const ConstIndexedAccessor<const AnyCamera*>& cameras, const ConstIndexedAccessor<HomogenousMatrix4>& flippedCameras_T_world, const ConstIndexedAccessor<Vector3>& objectPoints, const ObjectPointGroupsAccessor& correspondenceGroups, NonconstIndexedAccessor<HomogenousMatrix4>* flippedOptimizedCameras_T_world, NonconstIndexedAccessor<Vector3>* optimizedObjectPoints, const unsigned int iterations, const Geometry::Estimator::EstimatorType estimator, const Scalar lambda, const Scalar lambdaFactor, const bool onlyFrontObjectPoints, Scalar* initialError, Scalar* finalError, Scalars* intermediateErrors, const GravityConstraints* gravityConstraints, const bool applyAbsolutePoseAlignment, const SchurSolver schurSolver, Worker* worker)
 {
 	ocean_assert(flippedOptimizedCameras_T_world == nullptr || flippedCameras_T_world.size() == flippedOptimizedCameras_T_world->size());
 	ocean_assert(optimizedObjectPoints == nullptr || objectPoints.size() == optimizedObjectPoints->size());
@@ -3736,36 +4822,81 @@ bool NonLinearOptimizationObjectPoint::optimizeObjectPointsAndPosesIF(const Cons
 	{
 		case Estimator::ET_LINEAR:
 		{
-			ObjectPointsPosesProvider<Estimator::ET_LINEAR> provider(cameras, accessor_flippedOptimizedCameras_T_world, objectPointsAccessor, correspondenceGroups, onlyFrontObjectPoints, gravityConstraints);
-			optimizationResult = advancedSparseOptimization(provider, iterations, lambda, lambdaFactor, initialError, finalError, intermediateErrors);
+			if (schurSolver == SS_DENSE)
+			{
+				ObjectPointsPosesProvider<Estimator::ET_LINEAR> provider(cameras, accessor_flippedOptimizedCameras_T_world, objectPointsAccessor, correspondenceGroups, onlyFrontObjectPoints, gravityConstraints);
+				optimizationResult = advancedSparseOptimization(provider, iterations, lambda, lambdaFactor, initialError, finalError, intermediateErrors);
+			}
+			else
+			{
+				BlockSparseObjectPointsPosesProvider<Estimator::ET_LINEAR> provider(cameras, accessor_flippedOptimizedCameras_T_world, objectPointsAccessor, correspondenceGroups, onlyFrontObjectPoints, gravityConstraints, schurSolver, worker);
+				optimizationResult = advancedSparseOptimization(provider, iterations, lambda, lambdaFactor, initialError, finalError, intermediateErrors);
+			}
+
 			break;
 		}
 
 		case Estimator::ET_HUBER:
 		{
-			ObjectPointsPosesProvider<Estimator::ET_HUBER> provider(cameras, accessor_flippedOptimizedCameras_T_world, objectPointsAccessor, correspondenceGroups, onlyFrontObjectPoints, gravityConstraints);
-			optimizationResult = advancedSparseOptimization(provider, iterations, lambda, lambdaFactor, initialError, finalError, intermediateErrors);
+			if (schurSolver == SS_DENSE)
+			{
+				ObjectPointsPosesProvider<Estimator::ET_HUBER> provider(cameras, accessor_flippedOptimizedCameras_T_world, objectPointsAccessor, correspondenceGroups, onlyFrontObjectPoints, gravityConstraints);
+				optimizationResult = advancedSparseOptimization(provider, iterations, lambda, lambdaFactor, initialError, finalError, intermediateErrors);
+			}
+			else
+			{
+				BlockSparseObjectPointsPosesProvider<Estimator::ET_HUBER> provider(cameras, accessor_flippedOptimizedCameras_T_world, objectPointsAccessor, correspondenceGroups, onlyFrontObjectPoints, gravityConstraints, schurSolver, worker);
+				optimizationResult = advancedSparseOptimization(provider, iterations, lambda, lambdaFactor, initialError, finalError, intermediateErrors);
+			}
+
 			break;
 		}
 
 		case Estimator::ET_TUKEY:
 		{
-			ObjectPointsPosesProvider<Estimator::ET_TUKEY> provider(cameras, accessor_flippedOptimizedCameras_T_world, objectPointsAccessor, correspondenceGroups, onlyFrontObjectPoints, gravityConstraints);
-			optimizationResult = advancedSparseOptimization(provider, iterations, lambda, lambdaFactor, initialError, finalError, intermediateErrors);
+			if (schurSolver == SS_DENSE)
+			{
+				ObjectPointsPosesProvider<Estimator::ET_TUKEY> provider(cameras, accessor_flippedOptimizedCameras_T_world, objectPointsAccessor, correspondenceGroups, onlyFrontObjectPoints, gravityConstraints);
+				optimizationResult = advancedSparseOptimization(provider, iterations, lambda, lambdaFactor, initialError, finalError, intermediateErrors);
+			}
+			else
+			{
+				BlockSparseObjectPointsPosesProvider<Estimator::ET_TUKEY> provider(cameras, accessor_flippedOptimizedCameras_T_world, objectPointsAccessor, correspondenceGroups, onlyFrontObjectPoints, gravityConstraints, schurSolver, worker);
+				optimizationResult = advancedSparseOptimization(provider, iterations, lambda, lambdaFactor, initialError, finalError, intermediateErrors);
+			}
+
 			break;
 		}
 
 		case Estimator::ET_CAUCHY:
 		{
-			ObjectPointsPosesProvider<Estimator::ET_CAUCHY> provider(cameras, accessor_flippedOptimizedCameras_T_world, objectPointsAccessor, correspondenceGroups, onlyFrontObjectPoints, gravityConstraints);
-			optimizationResult = advancedSparseOptimization(provider, iterations, lambda, lambdaFactor, initialError, finalError, intermediateErrors);
+			if (schurSolver == SS_DENSE)
+			{
+				ObjectPointsPosesProvider<Estimator::ET_CAUCHY> provider(cameras, accessor_flippedOptimizedCameras_T_world, objectPointsAccessor, correspondenceGroups, onlyFrontObjectPoints, gravityConstraints);
+				optimizationResult = advancedSparseOptimization(provider, iterations, lambda, lambdaFactor, initialError, finalError, intermediateErrors);
+			}
+			else
+			{
+				BlockSparseObjectPointsPosesProvider<Estimator::ET_CAUCHY> provider(cameras, accessor_flippedOptimizedCameras_T_world, objectPointsAccessor, correspondenceGroups, onlyFrontObjectPoints, gravityConstraints, schurSolver, worker);
+				optimizationResult = advancedSparseOptimization(provider, iterations, lambda, lambdaFactor, initialError, finalError, intermediateErrors);
+			}
+
 			break;
 		}
 
 		case Estimator::ET_SQUARE:
 		{
-			ObjectPointsPosesProvider<Estimator::ET_SQUARE> provider(cameras, accessor_flippedOptimizedCameras_T_world, objectPointsAccessor, correspondenceGroups, onlyFrontObjectPoints, gravityConstraints);
-			optimizationResult = advancedSparseOptimization(provider, iterations, lambda, lambdaFactor, initialError, finalError, intermediateErrors);
+			if (schurSolver == SS_DENSE)
+			{
+				ObjectPointsPosesProvider<Estimator::ET_SQUARE> provider(cameras, accessor_flippedOptimizedCameras_T_world, objectPointsAccessor, correspondenceGroups, onlyFrontObjectPoints, gravityConstraints);
+				optimizationResult = advancedSparseOptimization(provider, iterations, lambda, lambdaFactor, initialError, finalError, intermediateErrors);
+			}
+			else
+			{
+				BlockSparseObjectPointsPosesProvider<Estimator::ET_SQUARE> provider(cameras, accessor_flippedOptimizedCameras_T_world, objectPointsAccessor, correspondenceGroups, onlyFrontObjectPoints, gravityConstraints, schurSolver, worker);
+				optimizationResult = advancedSparseOptimization(provider, iterations, lambda, lambdaFactor, initialError, finalError, intermediateErrors);
+			}
+
 			break;
 		}
 
@@ -5622,6 +6753,202 @@ size_t NonLinearOptimizationObjectPoint::clampDistantObjectPointsIF(const Homoge
 	return clampDistantObjectPoints(cameraBoundingBox, objectPoints, numberObjectPoints, maximalDistanceFactor);
 }
 
+/**
+ * This class implements a mixed precision optimization provider for one 3D object point visible in several fixed camera poses.
+ * The projection errors and the Jacobians are determined with TFloat precision, the normal equations are accumulated with double precision.<br>
+ * The object point itself is stored with double precision and is transformed into the individual camera coordinate systems with double precision.
+ * @tparam TFloat The data type of the input and of the Jacobians
+ */
+template <typename TFloat>
+class NonLinearOptimizationObjectPoint::MixedPrecisionObjectPointProvider
+{
+	public:
+
+		/**
+		 * Creates a new optimization provider object.
+		 * @param camera The camera profile to be used, must be valid
+		 * @param flippedCameras_T_world Inverted and flipped poses in that the object point is visible, at least two
+		 * @param objectPoint The 3D object point to be optimized
+		 * @param imagePoints The 2D observation image points, one for each camera pose
+		 * @param estimator The robust estimator to be used
+		 * @param onlyFrontObjectPoints True, to avoid that the optimized 3D position lies behind any camera
+		 */
+		MixedPrecisionObjectPointProvider(const AnyCameraT<TFloat>& camera, const ConstIndexedAccessor<HomogenousMatrixT4<TFloat>>& flippedCameras_T_world, VectorD3& objectPoint, const ConstIndexedAccessor<VectorT2<TFloat>>& imagePoints, const Estimator::EstimatorType estimator, const bool onlyFrontObjectPoints) :
+			camera_(camera),
+			flippedCameras_T_world_(flippedCameras_T_world),
+			objectPoint_(objectPoint),
+			candidateObjectPoint_(objectPoint),
+			imagePoints_(imagePoints),
+			estimator_(estimator),
+			onlyFrontObjectPoints_(onlyFrontObjectPoints),
+			errors_(flippedCameras_T_world.size()),
+			candidateErrors_(flippedCameras_T_world.size()),
+			weights_(flippedCameras_T_world.size()),
+			candidateWeights_(flippedCameras_T_world.size()),
+			sqrErrors_(flippedCameras_T_world.size())
+		{
+			ocean_assert(camera_.isValid());
+			ocean_assert(flippedCameras_T_world.size() >= 2);
+			ocean_assert(flippedCameras_T_world.size() == imagePoints.size());
+
+			flippedCamerasD_T_world_.reserve(flippedCameras_T_world.size());
+
+			for (size_t n = 0; n < flippedCameras_T_world.size(); ++n)
+			{
+				flippedCamerasD_T_world_.emplace_back(flippedCameras_T_world[n]);
+			}
+		}
+
+		/**
+		 * Determines the normal equations for the current object point.
+		 * @param JTJ The resulting upper triangle of the 3x3 matrix J^T * diag(weights) * J, initialized with zero
+		 * @param jErrors The resulting 3x1 vector J^T * diag(weights) * errors, initialized with zero
+		 */
+		void determineNormalEquations(double* JTJ, double* jErrors) const
+		{
+			ocean_assert(JTJ != nullptr && jErrors != nullptr);
+
+			const VectorT3<TFloat> objectPoint(objectPoint_);
+
+			TFloat jx[3];
+			TFloat jy[3];
+
+			for (size_t n = 0; n < flippedCameras_T_world_.size(); ++n)
+			{
+				Jacobian::calculatePointJacobian2x3IF<TFloat>(camera_, flippedCameras_T_world_[n], objectPoint, jx, jy);
+
+				const double weight = weights_[n];
+
+				const double weightedErrorX = double(errors_[n].x()) * weight;
+				const double weightedErrorY = double(errors_[n].y()) * weight;
+
+				for (size_t r = 0; r < 3; ++r)
+				{
+					const double weightedJx = double(jx[r]) * weight;
+					const double weightedJy = double(jy[r]) * weight;
+
+					for (size_t c = r; c < 3; ++c)
+					{
+						JTJ[r * 3 + c] += weightedJx * double(jx[c]) + weightedJy * double(jy[c]);
+					}
+
+					jErrors[r] += double(jx[r]) * weightedErrorX + double(jy[r]) * weightedErrorY;
+				}
+			}
+		}
+
+		/**
+		 * Applies the correction and stores the new object point as candidate.
+		 * @param deltas The three correction values
+		 */
+		inline void applyCorrection(const double* deltas)
+		{
+			candidateObjectPoint_ = objectPoint_ - VectorD3(deltas[0], deltas[1], deltas[2]);
+		}
+
+		/**
+		 * Determines the averaged robust error of the candidate object point.
+		 * @return The averaged robust error, -1 if the candidate lies behind a camera while only front object points are accepted
+		 */
+		double determineRobustError()
+		{
+			const size_t size = flippedCamerasD_T_world_.size();
+
+			for (size_t n = 0; n < size; ++n)
+			{
+				const VectorD3 cameraObjectPoint(flippedCamerasD_T_world_[n] * candidateObjectPoint_);
+
+				if (onlyFrontObjectPoints_ && cameraObjectPoint.z() <= NumericD::eps())
+				{
+					return -1.0;
+				}
+
+				candidateErrors_[n] = camera_.projectToImageIF(VectorT3<TFloat>(cameraObjectPoint)) - imagePoints_[n];
+				sqrErrors_[n] = Scalar(candidateErrors_[n].sqr());
+			}
+
+			const Scalar sqrSigma = Estimator::needSigma(estimator_) ? Estimator::determineSigmaSquare(sqrErrors_.data(), size, 3, estimator_) : Scalar(0);
+
+			double robustError = 0.0;
+
+			for (size_t n = 0; n < size; ++n)
+			{
+				robustError += double(Estimator::robustErrorSquare(sqrErrors_[n], sqrSigma, estimator_));
+				candidateWeights_[n] = double(Estimator::robustWeightSquare(sqrErrors_[n], sqrSigma, estimator_));
+			}
+
+			return robustError / double(size);
+		}
+
+		/**
+		 * Accepts the current object point candidate as better model.
+		 */
+		inline void acceptCorrection()
+		{
+			objectPoint_ = candidateObjectPoint_;
+
+			std::swap(errors_, candidateErrors_);
+			std::swap(weights_, candidateWeights_);
+		}
+
+	protected:
+
+		/// The camera profile.
+		const AnyCameraT<TFloat>& camera_;
+
+		/// The inverted and flipped camera poses.
+		const ConstIndexedAccessor<HomogenousMatrixT4<TFloat>>& flippedCameras_T_world_;
+
+		/// The inverted and flipped camera poses with double precision.
+		HomogenousMatricesD4 flippedCamerasD_T_world_;
+
+		/// The object point to be optimized.
+		VectorD3& objectPoint_;
+
+		/// The candidate object point.
+		VectorD3 candidateObjectPoint_;
+
+		/// The 2D observations.
+		const ConstIndexedAccessor<VectorT2<TFloat>>& imagePoints_;
+
+		/// The robust estimator to be used.
+		const Estimator::EstimatorType estimator_;
+
+		/// True, forces the object point to stay in front of the cameras.
+		const bool onlyFrontObjectPoints_;
+
+		/// The projection errors of the current object point.
+		std::vector<VectorT2<TFloat>> errors_;
+
+		/// The projection errors of the candidate object point.
+		std::vector<VectorT2<TFloat>> candidateErrors_;
+
+		/// The robust weights of the current object point.
+		std::vector<double> weights_;
+
+		/// The robust weights of the candidate object point.
+		std::vector<double> candidateWeights_;
+
+		/// The squared projection errors of the candidate object point.
+		Scalars sqrErrors_;
+};
+
+template <typename TFloat>
+bool NonLinearOptimizationObjectPoint::optimizeObjectPointForFixedPosesMixedPrecisionIF(const AnyCameraT<TFloat>& camera, const ConstIndexedAccessor<HomogenousMatrixT4<TFloat>>& flippedCameras_T_world, const VectorT3<TFloat>& worldObjectPoint, const ConstIndexedAccessor<VectorT2<TFloat>>& imagePoints, VectorD3& optimizedWorldObjectPoint, const unsigned int iterations, const Estimator::EstimatorType estimator, double lambda, const double lambdaFactor, const bool onlyFrontObjectPoints, double* initialRobustError, double* finalRobustError)
+{
+	ocean_assert(camera.isValid());
+	ocean_assert(flippedCameras_T_world.size() >= 2);
+	ocean_assert(flippedCameras_T_world.size() == imagePoints.size());
+
+	optimizedWorldObjectPoint = VectorD3(worldObjectPoint);
+
+	MixedPrecisionObjectPointProvider<TFloat> provider(camera, flippedCameras_T_world, optimizedWorldObjectPoint, imagePoints, estimator, onlyFrontObjectPoints);
+	return mixedPrecisionDenseOptimization<TFloat, 3>(provider, iterations, lambda, lambdaFactor, initialRobustError, finalRobustError);
+}
+
+template OCEAN_GEOMETRY_EXPORT bool NonLinearOptimizationObjectPoint::optimizeObjectPointForFixedPosesMixedPrecisionIF<float>(const AnyCameraT<float>&, const ConstIndexedAccessor<HomogenousMatrixT4<float>>&, const VectorT3<float>&, const ConstIndexedAccessor<VectorT2<float>>&, VectorD3&, const unsigned int, const Estimator::EstimatorType, double, const double, const bool, double*, double*);
+template OCEAN_GEOMETRY_EXPORT bool NonLinearOptimizationObjectPoint::optimizeObjectPointForFixedPosesMixedPrecisionIF<double>(const AnyCameraT<double>&, const ConstIndexedAccessor<HomogenousMatrixT4<double>>&, const VectorT3<double>&, const ConstIndexedAccessor<VectorT2<double>>&, VectorD3&, const unsigned int, const Estimator::EstimatorType, double, const double, const bool, double*, double*);
+
 }
 
 }
@@ -12,6 +12,8 @@
 #include "ocean/geometry/GravityConstraints.h"
 #include "ocean/geometry/NonLinearOptimization.h"
 
+#include "ocean/base/Worker.h"
+
 #include "ocean/math/AnyCamera.h"
 #include "ocean/math/HomogenousMatrix4.h"
 #include "ocean/math/PinholeCamera.h"
@@ -31,6 +33,21 @@ namespace Geometry
  */
 class OCEAN_GEOMETRY_EXPORT NonLinearOptimizationObjectPoint : protected NonLinearOptimization
 {
+	public:
+
+		/**
+		 * Definition of individual solvers for the reduced camera system (the Schur complement) of a Bundle Adjustment for several camera poses and object points.
+		 */
+		enum SchurSolver : uint32_t
+		{
+			/// The reduced camera system is determined via dense pose/object point sub-matrices and solved with a dense direct solver, suitable for small problems.
+			SS_DENSE = 0u,
+			/// The reduced camera system is determined block-sparse (one 6x6 block for each pair of co-visible poses) and solved with a dense direct solver.
+			SS_BLOCK_SPARSE_DIRECT,
+			/// The reduced camera system is determined block-sparse and solved with a conjugate gradient solver using a block-Jacobi preconditioner, suitable for large problems with thousands of poses.
+			SS_BLOCK_SPARSE_CONJUGATE_GRADIENT
+		};
+
 	protected:
 
 		/**
@@ -113,6 +130,14 @@ class OCEAN_GEOMETRY_EXPORT NonLinearOptimizationObjectPoint : protected NonLine
 		template <Estimator::EstimatorType tEstimator>
 		class ObjectPointsPosesProvider;
 
+		/**
+		 * Forward declaration of a block-sparse provider object allowing to optimize several camera poses and several 3D object point locations concurrently, for large Bundle Adjustment problems.
+		 * @tparam tEstimator The robust estimator to be used as error measure
+		 * @see ObjectPointsPosesProvider.
+		 */
+		template <Estimator::EstimatorType tEstimator>
+		class BlockSparseObjectPointsPosesProvider;
+
 		/**
 		 * Forward declaration of a highly optimized provider object allowing to optimize the orientations of several camera pose and several 3D object point locations concurrently.
 		 * @tparam tEstimator The robust estimator to be used as error measure
@@ -129,6 +154,13 @@ class OCEAN_GEOMETRY_EXPORT NonLinearOptimizationObjectPoint : protected NonLine
 		 */
 		class SlowObjectPointsPosesProvider;
 
+		/**
+		 * Forward declaration of a mixed precision provider object allowing to optimize one 3D object point for fixed camera poses.
+		 * @tparam TFloat The data type of the input and of the Jacobians
+		 */
+		template <typename TFloat>
+		class MixedPrecisionObjectPointProvider;
+
 	public:
 
 		/**
@@ -172,6 +204,51 @@ class OCEAN_GEOMETRY_EXPORT NonLinearOptimizationObjectPoint : protected NonLine
 		 */
 		static bool optimizeObjectPointForFixedPosesIF(const AnyCamera& camera, const ConstIndexedAccessor<HomogenousMatrix4>& flippedCameras_T_world, const Vector3& worldObjectPoint, const ConstIndexedAccessor<Vector2>& imagePoints, Vector3& optimizedWorldObjectPoint, const unsigned int iterations = 5u, const Estimator::EstimatorType estimator = Estimator::ET_SQUARE, Scalar lambda = Scalar(0.001), const Scalar lambdaFactor = 10, const bool onlyFrontObjectPoints = true, Scalar* initialRobustError = nullptr, Scalar* finalRobustError = nullptr, Scalars* intermediateRobustErrors = nullptr);
 
+		/**
+		 * Minimizes the projection errors for one given 3D object point, visible in several individual (fixed) camera images, with mixed precision.
+		 * The projection errors and Jacobians are determined with TFloat precision, while the normal equations are accumulated with double precision and solved with a TFloat factorization and a double precision iterative refinement.<br>
+		 * The object point is updated with double precision, so that the convergence quality is almost identical to a double precision optimization even if TFloat is 'float'.
+		 * @param camera The camera profile defining the projection between 3D object points and 2D image points, must be valid
+		 * @param world_T_cameras The accessor for the 6-DOF camera poses of the camera frames, with default camera pointing towards the negative z-space with y-axis upwards, at least two
+		 * @param worldObjectPoint The 3D object point for that the projection error is minimized, defined in world
+		 * @param imagePoints The accessor for the image points that are visible in individual camera frames (with world_T_cameras.size() == imagePoints.size())
+		 * @param optimizedWorldObjectPoint Resulting optimized 3D object point, defined in world, with double precision
+		 * @param iterations Number of iterations to be applied at most, if no convergence can be reached, with range [1, infinity)
+		 * @param estimator Robust error estimator to be used
+		 * @param lambda Initial Levenberg-Marquardt damping value which may be changed after each iteration using the damping factor, with range [0, infinity)
+		 * @param lambdaFactor Levenberg-Marquardt damping factor to be applied to the damping value, with range [1, infinity)
+		 * @param onlyFrontObjectPoints True, to avoid that the optimized 3D position lies behind any camera
+		 * @param initialRobustError Optional resulting averaged robust pixel error for the given initial parameters
+		 * @param finalRobustError Optional resulting averaged robust pixel error for the final optimized parameters
+		 * @return True, if succeeded
+		 * @tparam TFloat The data type of the input and of the Jacobians, either 'float' or 'double'
+		 * @see optimizeObjectPointForFixedPosesMixedPrecisionIF().
+		 */
+		template <typename TFloat>
+		static inline bool optimizeObjectPointForFixedPosesMixedPrecision(const AnyCameraT<TFloat>& camera, const ConstIndexedAccessor<HomogenousMatrixT4<TFloat>>& world_T_cameras, const VectorT3<TFloat>& worldObjectPoint, const ConstIndexedAccessor<VectorT2<TFloat>>& imagePoints, VectorD3& optimizedWorldObjectPoint, const unsigned int iterations = 5u, const Estimator::EstimatorType estimator = Estimator::ET_SQUARE, double lambda = 0.001, const double lambdaFactor = 10.0, const bool onlyFrontObjectPoints = true, double* initialRobustError = nullptr, double* finalRobustError = nullptr);
+
+		/**
+		 * Minimizes the projection errors for one given 3D object point, visible in several individual (fixed) camera images, with mixed precision.
+		 * Beware: The given inverted and flipped 6DOF poses are not equivalent to a standard extrinsic camera matrix.<br>
+		 * @param camera The camera profile defining the projection between 3D object points and 2D image points, must be valid
+		 * @param flippedCameras_T_world The accessor for (inverted and flipped) 6-DOF camera poses of the camera frames, with default flipped camera pointing towards the positive z-space with y-axis downwards, at least two
+		 * @param worldObjectPoint The 3D object point for that the projection error is minimized, defined in world
+		 * @param imagePoints The accessor for the image points that are visible in individual camera frames (with flippedCameras_T_world.size() == imagePoints.size())
+		 * @param optimizedWorldObjectPoint Resulting optimized 3D object point, defined in world, with double precision
+		 * @param iterations Number of iterations to be applied at most, if no convergence can be reached, with range [1, infinity)
+		 * @param estimator Robust error estimator to be used
+		 * @param lambda Initial Levenberg-Marquardt damping value which may be changed after each iteration using the damping factor, with range [0, infinity)
+		 * @param lambdaFactor Levenberg-Marquardt damping factor to be applied to the damping value, with range [1, infinity)
+		 * @param onlyFrontObjectPoints True, to avoid that the optimized 3D position lies behind any camera
+		 * @param initialRobustError Optional resulting averaged robust pixel error for the given initial parameters
+		 * @param finalRobustError Optional resulting averaged robust pixel error for the final optimized parameters
+		 * @return True, if succeeded
+		 * @tparam TFloat The data type of the input and of the Jacobians, either 'float' or 'double'
+		 * @see optimizeObjectPointForFixedPosesMixedPrecision().
+		 */
+		template <typename TFloat>
+		static bool optimizeObjectPointForFixedPosesMixedPrecisionIF(const AnyCameraT<TFloat>& camera, const ConstIndexedAccessor<HomogenousMatrixT4<TFloat>>& flippedCameras_T_world, const VectorT3<TFloat>& worldObjectPoint, const ConstIndexedAccessor<VectorT2<TFloat>>& imagePoints, VectorD3& optimizedWorldObjectPoint, const unsigned int iterations = 5u, const Estimator::EstimatorType estimator = Estimator::ET_SQUARE, double lambda = 0.001, const double lambdaFactor = 10.0, const bool onlyFrontObjectPoints = true, double* initialRobustError = nullptr, double* finalRobustError = nullptr);
+
 		/**
 		 * Minimizes the projection errors for one given 3D object point, visible in several individual (fixed) camera images, by minimizing the projection error between the 3D object point and the 2D image points.
 		 * @param cameras The camera profiles defining the projection between 3D object points and 2D image points, one individual provide for each observation, must be valid
@@ -503,10 +580,12 @@ class OCEAN_GEOMETRY_EXPORT NonLinearOptimizationObjectPoint : protected NonLine
 		 * @param intermediateErrors Optional resulting intermediate (improving) errors
 		 * @param gravityConstraints Optional gravity constraints to force the optimization to create camera poses aligned with gravity, with one gravity vector for each camera pose, nullptr to avoid any gravity alignment
 		 * @param applyAbsolutePoseAlignment True, to align the optimized poses and object points with the original coordinate frame using AbsoluteTransformation; this preserves the scale, orientation, and position of the original scene as best as possible; False to return an arbitrary coordinate frame
+		 * @param schurSolver The solver to be used for the reduced camera system, SS_BLOCK_SPARSE_DIRECT or SS_BLOCK_SPARSE_CONJUGATE_GRADIENT for large problems
+		 * @param worker Optional worker object to distribute the computation, used by the block-sparse solvers only
 		 * @return True, if succeeded
 		 * @see optimizeObjectPointsAndPosesIF(), NonLinearOptimization::ObjectPointToPoseIndexImagePointCorrespondenceAccessor.
 		 */
-		static inline bool optimizeObjectPointsAndPoses(const AnyCamera& camera, const ConstIndexedAccessor<HomogenousMatrix4>& world_T_cameras, const ConstIndexedAccessor<Vector3>& objectPoints, const ObjectPointGroupsAccessor& correspondenceGroups, NonconstIndexedAccessor<HomogenousMatrix4>* world_T_optimizedCameras, NonconstIndexedAccessor<Vector3>* optimizedObjectPoints, const unsigned int iterations, const Geometry::Estimator::EstimatorType estimator = Geometry::Estimator::ET_SQUARE, const Scalar lambda = Scalar(0.001), const Scalar lambdaFactor = Scalar(5), const bool onlyFrontObjectPoints = true, Scalar* initialError = nullptr, Scalar* finalError = nullptr, Scalars* intermediateErrors = nullptr, const GravityConstraints* gravityConstraints = nullptr, const bool applyAbsolutePoseAlignment = false);
+		static inline bool optimizeObjectPointsAndPoses(const AnyCamera& camera, const ConstIndexedAccessor<HomogenousMatrix4>& world_T_cameras, const ConstIndexedAccessor<Vector3>& objectPoints, const ObjectPointGroupsAccessor& correspondenceGroups, NonconstIndexedAccessor<HomogenousMatrix4>* world_T_optimizedCameras, NonconstIndexedAccessor<Vector3>* optimizedObjectPoints, const unsigned int iterations, const Geometry::Estimator::EstimatorType estimator = Geometry::Estimator::ET_SQUARE, const Scalar lambda = Scalar(0.001), const Scalar lambdaFactor = Scalar(5), const bool onlyFrontObjectPoints = true, Scalar* initialError = nullptr, Scalar* finalError = nullptr, Scalars* intermediateErrors = nullptr, const GravityConstraints* gravityConstraints = nullptr, const bool applyAbsolutePoseAlignment = false, const SchurSolver schurSolver = SS_DENSE, Worker* worker = nullptr);
 
 		/**
 		 * Optimizes the locations of 3D object points visible in individual (inverted and flipped) camera poses by minimizing the projection error between the 3D object points and the 2D image points.
@@ -529,10 +608,12 @@ class OCEAN_GEOMETRY_EXPORT NonLinearOptimizationObjectPoint : protected NonLine
 		 * @param intermediateErrors Optional resulting intermediate (improving) errors
 		 * @param gravityConstraints Optional gravity constraints to force the optimization to create camera poses aligned with gravity, with one gravity vector for each camera pose, nullptr to avoid any gravity alignment
 		 * @param applyAbsolutePoseAlignment True, to align the optimized poses and object points with the original coordinate frame using AbsoluteTransformation; this preserves the scale, orientation, and position of the original scene as best as possible; False to return an arbitrary coordinate frame
+		 * @param schurSolver The solver to be used for the reduced camera system, SS_BLOCK_SPARSE_DIRECT or SS_BLOCK_SPARSE_CONJUGATE_GRADIENT for large problems
+		 * @param worker Optional worker object to distribute the computation, used by the block-sparse solvers only
 		 * @return True, if succeeded
 		 * @see optimizeObjectPointsAndPoses(), NonLinearOptimization::ObjectPointToPoseIndexImagePointCorrespondenceAccessor.
 		 */
-		static inline bool optimizeObjectPointsAndPosesIF(const AnyCamera& camera, const ConstIndexedAccessor<HomogenousMatrix4>& flippedCameras_T_world, const ConstIndexedAccessor<Vector3>& objectPoints, const ObjectPointGroupsAccessor& correspondenceGroups, NonconstIndexedAccessor<HomogenousMatrix4>* flippedOptimizedCameras_T_world, NonconstIndexedAccessor<Vector3>* optimizedObjectPoints, const unsigned int iterations, const Geometry::Estimator::EstimatorType estimator = Geometry::Estimator::ET_SQUARE, const Scalar lambda = Scalar(0.001), const Scalar lambdaFactor = Scalar(5), const bool onlyFrontObjectPoints = true, Scalar* initialError = nullptr, Scalar* finalError = nullptr, Scalars* intermediateErrors = nullptr, const GravityConstraints* gravityConstraints = nullptr, const bool applyAbsolutePoseAlignment = false);
+		static inline bool optimizeObjectPointsAndPosesIF(const AnyCamera& camera, const ConstIndexedAccessor<HomogenousMatrix4>& flippedCameras_T_world, const ConstIndexedAccessor<Vector3>& objectPoints, const ObjectPointGroupsAccessor& correspondenceGroups, NonconstIndexedAccessor<HomogenousMatrix4>* flippedOptimizedCameras_T_world, NonconstIndexedAccessor<Vector3>* optimizedObjectPoints, const unsigned int iterations, const Geometry::Estimator::EstimatorType estimator = Geometry::Estimator::ET_SQUARE, const Scalar lambda = Scalar(0.001), const Scalar lambdaFactor = Scalar(5), const bool onlyFrontObjectPoints = true, Scalar* initialError = nullptr, Scalar* finalError = nullptr, Scalars* intermediateErrors = nullptr, const GravityConstraints* gravityConstraints = nullptr, const bool applyAbsolutePoseAlignment = false, const SchurSolver schurSolver = SS_DENSE, Worker* worker = nullptr);
 
 		/**
 		 * Optimizes the locations of 3D object points visible in individual camera poses by minimizing the projection error between the 3D object points and the 2D image points.
@@ -554,10 +635,12 @@ class OCEAN_GEOMETRY_EXPORT NonLinearOptimizationObjectPoint : protected NonLine
 		 * @param finalError Optional resulting averaged pixel error for the final optimized parameters, in relation to the defined estimator
 		 * @param intermediateErrors Optional resulting intermediate (improving) errors
 		 * @param applyAbsolutePoseAlignment True, to align the optimized poses and object points with the original coordinate frame using AbsoluteTransformation; this preserves the scale, orientation, and position of the original scene as best as possible; False to return an arbitrary coordinate frame
+		 * @param schurSolver The solver to be used for the reduced camera system, SS_BLOCK_SPARSE_DIRECT or SS_BLOCK_SPARSE_CONJUGATE_GRADIENT for large problems
+		 * @param worker Optional worker object to distribute the computation, used by the block-sparse solvers only
 		 * @return True, if succeeded
 		 * @see optimizeObjectPointsAndPosesIF(), optimizeObjectPointsAndOrientationalPoses(), NonLinearOptimization::ObjectPointToPoseIndexImagePointCorrespondenceAccessor.
 		 */
-		static bool optimizeObjectPointsAndPoses(const ConstIndexedAccessor<const AnyCamera*>& cameras, const ConstIndexedAccessor<HomogenousMatrix4>& world_T_cameras, const ConstIndexedAccessor<Vector3>& objectPoints, const ObjectPointGroupsAccessor& correspondenceGroups, NonconstIndexedAccessor<HomogenousMatrix4>* world_T_optimizedCameras, NonconstIndexedAccessor<Vector3>* optimizedObjectPoints, const unsigned int iterations, const Geometry::Estimator::EstimatorType estimator = Geometry::Estimator::ET_SQUARE, const Scalar lambda = Scalar(0.001), const Scalar lambdaFactor = Scalar(5), const bool onlyFrontObjectPoints = true, Scalar* initialError = nullptr, Scalar* finalError = nullptr, Scalars* intermediateErrors = nullptr, const bool applyAbsolutePoseAlignment = false);
+		static bool optimizeObjectPointsAndPoses(const ConstIndexedAccessor<const AnyCamera*>& cameras, const ConstIndexedAccessor<HomogenousMatrix4>& world_T_cameras, const ConstIndexedAccessor<Vector3>& objectPoints, const ObjectPointGroupsAccessor& correspondenceGroups, NonconstIndexedAccessor<HomogenousMatrix4>* world_T_optimizedCameras, NonconstIndexedAccessor<Vector3>* optimizedObjectPoints, const unsigned int iterations, const Geometry::Estimator::EstimatorType estimator = Geometry::Estimator::ET_SQUARE, const Scalar lambda = Scalar(0.001), const Scalar lambdaFactor = Scalar(5), const bool onlyFrontObjectPoints = true, Scalar* initialError = nullptr, Scalar* finalError = nullptr, Scalars* intermediateErrors = nullptr, const bool applyAbsolutePoseAlignment = false, const SchurSolver schurSolver = SS_DENSE, Worker* worker = nullptr);
 
 		/**
 		 * Optimizes the locations of 3D object points visible in individual (inverted and flipped) camera poses by minimizing the projection error between the 3D object points and the 2D image points.
@@ -580,10 +663,12 @@ class OCEAN_GEOMETRY_EXPORT NonLinearOptimizationObjectPoint : protected NonLine
 		 * @param intermediateErrors Optional resulting intermediate (improving) errors
 		 * @param gravityConstraints Optional gravity constraints to force the optimization to create camera poses aligned with gravity, with one gravity vector for each camera pose, nullptr to avoid any gravity alignment
 		 * @param applyAbsolutePoseAlignment True, to align the optimized poses and object points with the original coordinate frame using AbsoluteTransformation; this preserves the scale, orientation, and position of the original scene as best as possible; False to return an arbitrary coordinate frame
+		 * @param schurSolver The solver to be used for the reduced camera system, SS_BLOCK_SPARSE_DIRECT or SS_BLOCK_SPARSE_CONJUGATE_GRADIENT for large problems
+		 * @param worker Optional worker object to distribute the computation, used by the block-sparse solvers only
 		 * @return True, if succeeded
 		 * @see optimizeObjectPointsAndPoses(), optimizeObjectPointsAndOrientationalPosesIF(), NonLinearOptimization::ObjectPointToPoseIndexImagePointCorrespondenceAccessor.
 		 */
-		static bool optimizeObjectPointsAndPosesIF(const ConstIndexedAccessor<const AnyCamera*>& cameras, const ConstIndexedAccessor<HomogenousMatrix4>& flippedCameras_T_world, const ConstIndexedAccessor<Vector3>& objectPoints, const ObjectPointGroupsAccessor& correspondenceGroups, NonconstIndexedAccessor<HomogenousMatrix4>* flippedOptimizedCameras_T_world, NonconstIndexedAccessor<Vector3>* optimizedObjectPoints, const unsigned int iterations, const Geometry::Estimator::EstimatorType estimator = Geometry::Estimator::ET_SQUARE, const Scalar lambda = Scalar(0.001), const Scalar lambdaFactor = Scalar(5), const bool onlyFrontObjectPoints = true, Scalar* initialError = nullptr, Scalar* finalError = nullptr, Scalars* intermediateErrors = nullptr, const GravityConstraints* gravityConstraints = nullptr, const bool applyAbsolutePoseAlignment = false);
+		static bool optimizeObjectPointsAndPosesIF(const ConstIndexedAccessor<const AnyCamera*>& cameras, const ConstIndexedAccessor<HomogenousMatrix4>& flippedCameras_T_world, const ConstIndexedAccessor<Vector3>& objectPoints, const ObjectPointGroupsAccessor& correspondenceGroups, NonconstIndexedAccessor<HomogenousMatrix4>* flippedOptimizedCameras_T_world, NonconstIndexedAccessor<Vector3>* optimizedObjectPoints, const unsigned int iterations, const Geometry::Estimator::EstimatorType estimator = Geometry::Estimator::ET_SQUARE, const Scalar lambda = Scalar(0.001), const Scalar lambdaFactor = Scalar(5), const bool onlyFrontObjectPoints = true, Scalar* initialError = nullptr, Scalar* finalError = nullptr, Scalars* intermediateErrors = nullptr, const GravityConstraints* gravityConstraints = nullptr, const bool applyAbsolutePoseAlignment = false, const SchurSolver schurSolver = SS_DENSE, Worker* worker = nullptr);
 
 		/**
 		 * Optimizes the locations of 3D object points visible in individual camera poses by minimizing the projection error between the 3D object points and the 2D image points.
@@ -820,6 +905,20 @@ inline bool NonLinearOptimizationObjectPoint::optimizeObjectPointForFixedPoses(c
 	return optimizeObjectPointForFixedPosesIF(anyCamera, ConstArrayAccessor<HomogenousMatrix4>(flippedCameras_T_world), worldObjectPoint, imagePoints, optimizedWorldObjectPoint, iterations, estimator, lambda, lambdaFactor, onlyFrontObjectPoints, initialRobustError, finalRobustError, intermediateRobustErrors);
 }
 
+template <typename TFloat>
+inline bool NonLinearOptimizationObjectPoint::optimizeObjectPointForFixedPosesMixedPrecision(const AnyCameraT<TFloat>& camera, const ConstIndexedAccessor<HomogenousMatrixT4<TFloat>>& world_T_cameras, const VectorT3<TFloat>& worldObjectPoint, const ConstIndexedAccessor<VectorT2<TFloat>>& imagePoints, VectorD3& optimizedWorldObjectPoint, const unsigned int iterations, const Estimator::EstimatorType estimator, double lambda, const double lambdaFactor, const bool onlyFrontObjectPoints, double* initialRobustError, double* finalRobustError)
+{
+	HomogenousMatricesT4<TFloat> flippedCameras_T_world;
+	flippedCameras_T_world.reserve(world_T_cameras.size());
+
+	for (size_t n = 0; n < world_T_cameras.size(); ++n)
+	{
+		flippedCameras_T_world.emplace_back(Camera::standard2InvertedFlipped(HomogenousMatrixD4(world_T_cameras[n])));
+	}
+
+	return optimizeObjectPointForFixedPosesMixedPrecisionIF<TFloat>(camera, ConstArrayAccessor<HomogenousMatrixT4<TFloat>>(flippedCameras_T_world), worldObjectPoint, imagePoints, optimizedWorldObjectPoint, iterations, estimator, lambda, lambdaFactor, onlyFrontObjectPoints, initialRobustError, finalRobustError);
+}
+
 inline bool NonLinearOptimizationObjectPoint::optimizeObjectPointForFixedPoses(const ConstIndexedAccessor<const AnyCamera*>& cameras, const ConstIndexedAccessor<HomogenousMatrix4>& world_T_cameras, const Vector3& worldObjectPoint, const ConstIndexedAccessor<Vector2>& imagePoints, Vector3& optimizedWorldObjectPoint, const unsigned int iterations, const Estimator::EstimatorType estimator, Scalar lambda, const Scalar lambdaFactor, const bool onlyFrontObjectPoints, Scalar* initialRobustError, Scalar* finalRobustError, Scalars* intermediateRobustErrors)
 {
 	const HomogenousMatrices4 flippedCameras_T_world(AnyCamera::standard2InvertedFlipped(Accessor::accessor2elements(world_T_cameras)));
@@ -908,7 +1007,7 @@ inline bool NonLinearOptimizationObjectPoint::optimizeObjectPointsAndTwoPoses(co
 	return true;
 }
 
-inline bool NonLinearOptimizationObjectPoint::optimizeObjectPointsAndPoses(const AnyCamera& camera, const ConstIndexedAccessor<HomogenousMatrix4>& world_T_cameras, const ConstIndexedAccessor<Vector3>& objectPoints, const ObjectPointGroupsAccessor& correspondenceGroups, NonconstIndexedAccessor<HomogenousMatrix4>* world_T_optimizedCameras, NonconstIndexedAccessor<Vector3>* optimizedObjectPoints, const unsigned int iterations, const Geometry::Estimator::EstimatorType estimator, const Scalar lambda, const Scalar lambdaFactor, const bool onlyFrontObjectPoints, Scalar* initialError, Scalar* finalError, Scalars* intermediateErrors, const GravityConstraints* gravityConstraints, const bool applyAbsolutePoseAlignment)
+inline bool NonLinearOptimizationObjectPoint::optimizeObjectPointsAndPoses(const AnyCamera& camera, const ConstIndexedAccessor<HomogenousMatrix4>& world_T_cameras, const ConstIndexedAccessor<Vector3>& objectPoints, const ObjectPointGroupsAccessor& correspondenceGroups, NonconstIndexedAccessor<HomogenousMatrix4>* world_T_optimizedCameras, NonconstIndexedAccessor<Vector3>* optimizedObjectPoints, const unsigned int iterations, const Geometry::Estimator::EstimatorType estimator, const Scalar lambda, const Scalar lambdaFactor, const bool onlyFrontObjectPoints, Scalar* initialError, Scalar* finalError, Scalars* intermediateErrors, const GravityConstraints* gravityConstraints, const bool applyAbsolutePoseAlignment, const SchurSolver schurSolver, Worker* worker)
 {
 #if 1
 	// creating local pointer to avoid Clang compiler bug
@@ -923,7 +1022,7 @@ inline bool NonLinearOptimizationObjectPoint::optimizeObjectPointsAndPoses(const
 	HomogenousMatrices4 flippedOptimizedCameras_T_world;
 	NonconstArrayAccessor<HomogenousMatrix4> accessor_flippedOptimizedCameras_T_world(flippedOptimizedCameras_T_world, world_T_optimizedCameras ? world_T_cameras.size() : 0);
 
-	if (!optimizeObjectPointsAndPosesIF(cameraAccessor, ConstArrayAccessor<HomogenousMatrix4>(flippedCameras_T_world), objectPoints, correspondenceGroups, accessor_flippedOptimizedCameras_T_world.pointer(), optimizedObjectPoints, iterations, estimator, lambda, lambdaFactor, onlyFrontObjectPoints, initialError, finalError, intermediateErrors, gravityConstraints, applyAbsolutePoseAlignment))
+	if (!optimizeObjectPointsAndPosesIF(cameraAccessor, ConstArrayAccessor<HomogenousMatrix4>(flippedCameras_T_world), objectPoints, correspondenceGroups, accessor_flippedOptimizedCameras_T_world.pointer(), optimizedObjectPoints, iterations, estimator, lambda, lambdaFactor, onlyFrontObjectPoints, initialError, finalError, intermediateErrors, gravityConstraints, applyAbsolutePoseAlignment, schurSolver, worker))
 	{
 		return false;
 	}
@@ -939,7 +1038,7 @@ inline bool NonLinearOptimizationObjectPoint::optimizeObjectPointsAndPoses(const
 	return true;
 }
 
-inline bool NonLinearOptimizationObjectPoint::optimizeObjectPointsAndPosesIF(const AnyCamera& camera, const ConstIndexedAccessor<HomogenousMatrix4>& flippedCameras_T_world, const ConstIndexedAccessor<Vector3>& objectPoints, const ObjectPointGroupsAccessor& correspondenceGroups, NonconstIndexedAccessor<HomogenousMatrix4>* flippedOptimizedCameras_T_world, NonconstIndexedAccessor<Vector3>* optimizedObjectPoints, const unsigned int iterations, const Geometry::Estimator::EstimatorType estimator, const Scalar lambda, const Scalar lambdaFactor, const bool onlyFrontObjectPoints, Scalar* initialError, Scalar* finalError, Scalars* intermediateErrors, const GravityConstraints* gravityConstraints, const bool applyAbsolutePoseAlignment)
+inline bool NonLinearOptimizationObjectPoint::optimizeObjectPointsAndPosesIF(const AnyCamera& camera, const ConstIndexedAccessor<HomogenousMatrix4>& flippedCameras_T_world, const ConstIndexedAccessor<Vector3>& objectPoints, const ObjectPointGroupsAccessor& correspondenceGroups, NonconstIndexedAccessor<HomogenousMatrix4>* flippedOptimizedCameras_T_world, NonconstIndexedAccessor<Vector3>* optimizedObjectPoints, const unsigned int iterations, const Geometry::Estimator::EstimatorType estimator, const Scalar lambda, const Scalar lambdaFactor, const bool onlyFrontObjectPoints, Scalar* initialError, Scalar* finalError, Scalars* intermediateErrors, const GravityConstraints* gravityConstraints, const bool applyAbsolutePoseAlignment, const SchurSolver schurSolver, Worker* worker)
 {
 #if 1
 	// creating local pointer to avoid Clang compiler bug
@@ -949,7 +1048,7 @@ inline bool NonLinearOptimizationObjectPoint::optimizeObjectPointsAndPosesIF(con
 	const ConstElementAccessor<const AnyCamera*> cameraAccessor(flippedCameras_T_world.size(), &camera);
 #endif
 
-	return optimizeObjectPointsAndPosesIF(cameraAccessor, flippedCameras_T_world, objectPoints, correspondenceGroups, flippedOptimizedCameras_T_world, optimizedObjectPoints, iterations, estimator, lambda, lambdaFactor, onlyFrontObjectPoints, initialError, finalError, intermediateErrors, gravityConstraints, applyAbsolutePoseAlignment);
+	return optimizeObjectPointsAndPosesIF(cameraAccessor, flippedCameras_T_world, objectPoints, correspondenceGroups, flippedOptimizedCameras_T_world, optimizedObjectPoints, iterations, estimator, lambda, lambdaFactor, onlyFrontObjectPoints, initialError, finalError, intermediateErrors, gravityConstraints, applyAbsolutePoseAlignment, schurSolver, worker);
 }
 
 inline bool NonLinearOptimizationObjectPoint::slowOptimizeObjectPointsAndPoses(const PinholeCamera& camera, const ConstIndexedAccessor<HomogenousMatrix4>& poses, const ConstIndexedAccessor<Vector3>& objectPoints, const ObjectPointGroupsAccessor& correspondenceGroups, const bool useDistortionParameters, NonconstIndexedAccessor<HomogenousMatrix4>* optimizedPoses, NonconstIndexedAccessor<Vector3>* optimizedObjectPoints, const unsigned int iterations, const Geometry::Estimator::EstimatorType estimator, const Scalar lambda, const Scalar lambdaFactor, const bool onlyFrontObjectPoints, Scalar* initialError, Scalar* finalError, Scalars* intermediateErrors)
@@ -1093,6 +1093,210 @@ bool NonLinearOptimizationPose::optimizePoseZoomIF(const PinholeCamera& pinholeC
 	return true;
 }
 
+/**
+ * This class implements a mixed precision optimization provider for a 6DOF pose and any camera.
+ * The projection errors and the Jacobians are determined with TFloat precision, the normal equations are accumulated with double precision.<br>
+ * The pose itself is stored with double precision and the object points are transformed into the camera coordinate system with double precision.
+ * @tparam TFloat The data type of the input and of the Jacobians
+ */
+template <typename TFloat>
+class NonLinearOptimizationPose::MixedPrecisionPoseOptimizationProvider
+{
+	public:
+
+		/**
+		 * Creates a new optimization provider object.
+		 * @param camera The camera profile to be used, must be valid
+		 * @param flippedCamera_P_world The inverted and flipped pose to be optimized
+		 * @param objectPoints The 3D object points, must be valid
+		 * @param imagePoints The 2D image points, one for each object point, must be valid
+		 * @param size The number of correspondences, with range [3, infinity)
+		 * @param estimator The robust estimator to be used
+		 */
+		MixedPrecisionPoseOptimizationProvider(const AnyCameraT<TFloat>& camera, PoseD& flippedCamera_P_world, const VectorT3<TFloat>* objectPoints, const VectorT2<TFloat>* imagePoints, const size_t size, const Estimator::EstimatorType estimator) :
+			camera_(camera),
+			flippedCamera_P_world_(flippedCamera_P_world),
+			candidateFlippedCamera_P_world_(flippedCamera_P_world),
+			objectPoints_(objectPoints),
+			imagePoints_(imagePoints),
+			size_(size),
+			estimator_(estimator),
+			errors_(size),
+			candidateErrors_(size),
+			weights_(size),
+			candidateWeights_(size),
+			sqrErrors_(size)
+		{
+			ocean_assert(camera_.isValid());
+			ocean_assert(size_ >= 3);
+		}
+
+		/**
+		 * Determines the normal equations for the current pose.
+		 * @param JTJ The resulting upper triangle of the 6x6 matrix J^T * diag(weights) * J, initialized with zero
+		 * @param jErrors The resulting 6x1 vector J^T * diag(weights) * errors, initialized with zero
+		 */
+		void determineNormalEquations(double* JTJ, double* jErrors) const
+		{
+			ocean_assert(JTJ != nullptr && jErrors != nullptr);
+
+			const HomogenousMatrixT4<TFloat> flippedCamera_T_world(flippedCamera_P_world_.transformation());
+			const ExponentialMapT<TFloat> rotation(VectorT3<TFloat>(TFloat(flippedCamera_P_world_.rx()), TFloat(flippedCamera_P_world_.ry()), TFloat(flippedCamera_P_world_.rz())));
+
+			SquareMatrixT3<TFloat> dwx, dwy, dwz;
+			Jacobian::calculateRotationRodriguesDerivative<TFloat>(rotation, dwx, dwy, dwz);
+
+			TFloat jx[6];
+			TFloat jy[6];
+
+			for (size_t n = 0; n < size_; ++n)
+			{
+				Jacobian::calculatePoseJacobianRodrigues2x6IF<TFloat>(camera_, flippedCamera_T_world, objectPoints_[n], dwx, dwy, dwz, jx, jy);
+
+				const double weight = weights_[n];
+
+				const double weightedErrorX = double(errors_[n].x()) * weight;
+				const double weightedErrorY = double(errors_[n].y()) * weight;
+
+				for (size_t r = 0; r < 6; ++r)
+				{
+					const double weightedJx = double(jx[r]) * weight;
+					const double weightedJy = double(jy[r]) * weight;
+
+					for (size_t c = r; c < 6; ++c)
+					{
+						JTJ[r * 6 + c] += weightedJx * double(jx[c]) + weightedJy * double(jy[c]);
+					}
+
+					jErrors[r] += double(jx[r]) * weightedErrorX + double(jy[r]) * weightedErrorY;
+				}
+			}
+		}
+
+		/**
+		 * Applies the pose correction and stores the new pose as candidate.
+		 * @param deltas The six correction values (wx, wy, wz, tx, ty, tz)
+		 */
+		inline void applyCorrection(const double* deltas)
+		{
+			const PoseD deltaPose(deltas[3], deltas[4], deltas[5], deltas[0], deltas[1], deltas[2]);
+			candidateFlippedCamera_P_world_ = flippedCamera_P_world_ - deltaPose;
+		}
+
+		/**
+		 * Determines the averaged robust error of the candidate pose.
+		 * @return The averaged robust error, -1 if an object point lies behind the candidate camera
+		 */
+		double determineRobustError()
+		{
+			const HomogenousMatrixD4 candidateFlippedCamera_T_world(candidateFlippedCamera_P_world_.transformation());
+
+			for (size_t n = 0; n < size_; ++n)
+			{
+				// the transformation is applied with double precision to avoid cancellation for large translations
+
+				const VectorT3<TFloat> cameraObjectPoint(candidateFlippedCamera_T_world * VectorD3(objectPoints_[n]));
+
+				if (cameraObjectPoint.z() <= NumericT<TFloat>::eps())
+				{
+					return -1.0;
+				}
+
+				candidateErrors_[n] = camera_.projectToImageIF(cameraObjectPoint) - imagePoints_[n];
+				sqrErrors_[n] = Scalar(candidateErrors_[n].sqr());
+			}
+
+			const Scalar sqrSigma = Estimator::needSigma(estimator_) ? Estimator::determineSigmaSquare(sqrErrors_.data(), size_, 6, estimator_) : Scalar(0);
+
+			double robustError = 0.0;
+
+			for (size_t n = 0; n < size_; ++n)
+			{
+				robustError += double(Estimator::robustErrorSquare(sqrErrors_[n], sqrSigma, estimator_));
+				candidateWeights_[n] = double(Estimator::robustWeightSquare(sqrErrors_[n], sqrSigma, estimator_));
+			}
+
+			return robustError / double(size_);
+		}
+
+		/**
+		 * Accepts the current pose candidate as better model.
+		 */
+		inline void acceptCorrection()
+		{
+			flippedCamera_P_world_ = candidateFlippedCamera_P_world_;
+
+			std::swap(errors_, candidateErrors_);
+			std::swap(weights_, candidateWeights_);
+		}
+
+	protected:
+
+		/// The camera profile.
+		const AnyCameraT<TFloat>& camera_;
+
+		/// The inverted and flipped pose to be optimized.
+		PoseD& flippedCamera_P_world_;
+
+		/// The inverted and flipped candidate pose.
+		PoseD candidateFlippedCamera_P_world_;
+
+		/// The 3D object points.
+		const VectorT3<TFloat>* objectPoints_;
+
+		/// The 2D image points.
+		const VectorT2<TFloat>* imagePoints_;
+
+		/// The number of correspondences.
+		const size_t size_;
+
+		/// The robust estimator to be used.
+		const Estimator::EstimatorType estimator_;
+
+		/// The projection errors of the current pose.
+		std::vector<VectorT2<TFloat>> errors_;
+
+		/// The projection errors of the candidate pose.
+		std::vector<VectorT2<TFloat>> candidateErrors_;
+
+		/// The robust weights of the current pose.
+		std::vector<double> weights_;
+
+		/// The robust weights of the candidate pose.
+		std::vector<double> candidateWeights_;
+
+		/// The squared projection errors of the candidate pose.
+		Scalars sqrErrors_;
+};
+
+template <typename TFloat>
+bool NonLinearOptimizationPose::optimizePoseMixedPrecisionIF(const AnyCameraT<TFloat>& camera, const HomogenousMatrixT4<TFloat>& flippedCamera_T_world, const ConstIndexedAccessor<VectorT3<TFloat>>& objectPoints, const ConstIndexedAccessor<VectorT2<TFloat>>& imagePoints, HomogenousMatrixD4& optimizedFlippedCamera_T_world, const unsigned int iterations, const Estimator::EstimatorType estimator, double lambda, const double lambdaFactor, double* initialError, double* finalError)
+{
+	ocean_assert(camera.isValid());
+	ocean_assert(flippedCamera_T_world.isValid());
+	ocean_assert(objectPoints.size() >= 3u);
+	ocean_assert(objectPoints.size() == imagePoints.size());
+
+	const ScopedConstMemoryAccessor<VectorT3<TFloat>> scopedObjectPointMemoryAccessor(objectPoints);
+	const ScopedConstMemoryAccessor<VectorT2<TFloat>> scopedImagePointMemoryAccessor(imagePoints);
+
+	PoseD flippedCamera_P_world((HomogenousMatrixD4(flippedCamera_T_world)));
+
+	MixedPrecisionPoseOptimizationProvider<TFloat> provider(camera, flippedCamera_P_world, scopedObjectPointMemoryAccessor.data(), scopedImagePointMemoryAccessor.data(), scopedObjectPointMemoryAccessor.size(), estimator);
+
+	if (!mixedPrecisionDenseOptimization<TFloat, 6>(provider, iterations, lambda, lambdaFactor, initialError, finalError))
+	{
+		return false;
+	}
+
+	optimizedFlippedCamera_T_world = flippedCamera_P_world.transformation();
+
+	return true;
+}
+
+template OCEAN_GEOMETRY_EXPORT bool NonLinearOptimizationPose::optimizePoseMixedPrecisionIF<float>(const AnyCameraT<float>&, const HomogenousMatrixT4<float>&, const ConstIndexedAccessor<VectorT3<float>>&, const ConstIndexedAccessor<VectorT2<float>>&, HomogenousMatrixD4&, const unsigned int, const Estimator::EstimatorType, double, const double, double*, double*);
+template OCEAN_GEOMETRY_EXPORT bool NonLinearOptimizationPose::optimizePoseMixedPrecisionIF<double>(const AnyCameraT<double>&, const HomogenousMatrixT4<double>&, const ConstIndexedAccessor<VectorT3<double>>&, const ConstIndexedAccessor<VectorT2<double>>&, HomogenousMatrixD4&, const unsigned int, const Estimator::EstimatorType, double, const double, double*, double*);
+
 }
 
 }
@@ -45,6 +45,13 @@ class OCEAN_GEOMETRY_EXPORT NonLinearOptimizationPose : protected NonLinearOptim
 		 */
 		class PoseZoomOptimizationProvider;
 
+		/**
+		 * Forward declaration of a class implementing a mixed precision provider allowing to optimize any camera pose.
+		 * @tparam TFloat The data type of the input and of the Jacobians
+		 */
+		template <typename TFloat>
+		class MixedPrecisionPoseOptimizationProvider;
+
 	public:
 
 		/**
@@ -230,6 +237,49 @@ class OCEAN_GEOMETRY_EXPORT NonLinearOptimizationPose : protected NonLinearOptim
 		 * @see optimizePose().
 		 */
 		static bool optimizePoseZoomIF(const PinholeCamera& pinholeCamera, const HomogenousMatrix4& flippedCamera_T_world, const Scalar zoom, const ConstIndexedAccessor<Vector3>& objectPoints, const ConstIndexedAccessor<Vector2>& imagePoints, const bool distortImagePoints, HomogenousMatrix4& optimizedInvertedFlippedPose, Scalar& optimizedZoom, const unsigned int iterations = 20u, const Estimator::EstimatorType estimator = Estimator::ET_SQUARE, Scalar lambda = Scalar(0.001), const Scalar lambdaFactor = 10, Scalar* initialError = nullptr, Scalar* finalError = nullptr, const Matrix* invertedCovariances = nullptr);
+
+		/**
+		 * Minimizes the projection error of a given 6DOF pose for any camera with mixed precision.
+		 * The projection errors and Jacobians are determined with TFloat precision, while the normal equations are accumulated with double precision and solved with a TFloat factorization and a double precision iterative refinement.<br>
+		 * The camera pose is updated with double precision and the object points are transformed into the camera coordinate system with double precision, so that the convergence quality is almost identical to a double precision optimization even if TFloat is 'float'.<br>
+		 * This function is independent of the Scalar type of the build, thus single precision input can be optimized in a double precision build and vice versa.
+		 * @param camera The camera profile defining the projection, must be valid
+		 * @param world_T_camera 6DOF pose to minimized the projection error for, must be valid
+		 * @param objectPoints 3D object points to be projected into the camera plane, at least three
+		 * @param imagePoints 2D image points corresponding to the object points
+		 * @param world_T_optimizedCamera Resulting optimized 6DOF pose, with double precision
+		 * @param iterations Number of iterations to be applied at most, if no convergence can be reached, with range [1, infinity)
+		 * @param estimator Robust error estimator to be used
+		 * @param lambda Initial Levenberg-Marquardt damping value which may be changed after each iteration using the damping factor, with range [0, infinity)
+		 * @param lambdaFactor Levenberg-Marquardt damping factor to be applied to the damping value, with range [1, infinity)
+		 * @param initialError Optional resulting averaged pixel error for the given initial parameters, in relation to the defined estimator
+		 * @param finalError Optional resulting averaged pixel error for the final optimized parameters, in relation to the defined estimator
+		 * @return True, if the optimization succeeded
+		 * @tparam TFloat The data type of the input and of the Jacobians, either 'float' or 'double'
+		 * @see optimizePoseMixedPrecisionIF().
+		 */
+		template <typename TFloat>
+		static inline bool optimizePoseMixedPrecision(const AnyCameraT<TFloat>& camera, const HomogenousMatrixT4<TFloat>& world_T_camera, const ConstIndexedAccessor<VectorT3<TFloat>>& objectPoints, const ConstIndexedAccessor<VectorT2<TFloat>>& imagePoints, HomogenousMatrixD4& world_T_optimizedCamera, const unsigned int iterations = 20u, const Estimator::EstimatorType estimator = Estimator::ET_SQUARE, double lambda = 0.001, const double lambdaFactor = 10.0, double* initialError = nullptr, double* finalError = nullptr);
+
+		/**
+		 * Minimizes the projection error of a given inverted and flipped 6DOF pose for any camera with mixed precision.
+		 * @param camera The camera profile defining the projection, must be valid
+		 * @param flippedCamera_T_world Inverted and flipped camera pose to minimized the projection error for, must be valid
+		 * @param objectPoints 3D object points to be projected into the camera plane, at least three
+		 * @param imagePoints 2D image points corresponding to the object points
+		 * @param optimizedFlippedCamera_T_world Resulting optimized inverted and flipped camera pose, with double precision
+		 * @param iterations Number of iterations to be applied at most, if no convergence can be reached, with range [1, infinity)
+		 * @param estimator Robust error estimator to be used
+		 * @param lambda Initial Levenberg-Marquardt damping value which may be changed after each iteration using the damping factor, with range [0, infinity)
+		 * @param lambdaFactor Levenberg-Marquardt damping factor to be applied to the damping value, with range [1, infinity)
+		 * @param initialError Optional resulting averaged pixel error for the given initial parameters, in relation to the defined estimator
+		 * @param finalError Optional resulting averaged pixel error for the final optimized parameters, in relation to the defined estimator
+		 * @return True, if the optimization succeeded
+		 * @tparam TFloat The data type of the input and of the Jacobians, either 'float' or 'double'
+		 * @see optimizePoseMixedPrecision().
+		 */
+		template <typename TFloat>
+		static bool optimizePoseMixedPrecisionIF(const AnyCameraT<TFloat>& camera, const HomogenousMatrixT4<TFloat>& flippedCamera_T_world, const ConstIndexedAccessor<VectorT3<TFloat>>& objectPoints, const ConstIndexedAccessor<VectorT2<TFloat>>& imagePoints, HomogenousMatrixD4& optimizedFlippedCamera_T_world, const unsigned int iterations = 20u, const Estimator::EstimatorType estimator = Estimator::ET_SQUARE, double lambda = 0.001, const double lambdaFactor = 10.0, double* initialError = nullptr, double* finalError = nullptr);
 };
 
 inline bool NonLinearOptimizationPose::optimizePose(const AnyCamera& anyCamera, const HomogenousMatrix4& world_T_camera, const ConstIndexedAccessor<Vector3>& objectPoints, const ConstIndexedAccessor<Vector2>& imagePoints, HomogenousMatrix4& world_T_optimizedCamera, const unsigned int iterations, const Estimator::EstimatorType estimator, Scalar lambda, const Scalar lambdaFactor, Scalar* initialError, Scalar* finalError, Scalars* intermediateRobustErrors, const GravityConstraints* gravityConstraints)
@@ -281,6 +331,26 @@ inline bool NonLinearOptimizationPose::optimizePose(const PinholeCamera& pinhole
 	return optimizePose(anyCamera, world_T_camera, objectPoints, imagePoints, world_T_optimizedCamera, iterations, estimator, lambda, lambdaFactor, initialError, finalError, intermediateRobustErrors, invertedCovariances, gravityConstraints);
 }
 
+template <typename TFloat>
+inline bool NonLinearOptimizationPose::optimizePoseMixedPrecision(const AnyCameraT<TFloat>& camera, const HomogenousMatrixT4<TFloat>& world_T_camera, const ConstIndexedAccessor<VectorT3<TFloat>>& objectPoints, const ConstIndexedAccessor<VectorT2<TFloat>>& imagePoints, HomogenousMatrixD4& world_T_optimizedCamera, const unsigned int iterations, const Estimator::EstimatorType estimator, double lambda, const double lambdaFactor, double* initialError, double* finalError)
+{
+	ocean_assert(camera.isValid());
+	ocean_assert(world_T_camera.isValid());
+	ocean_assert(objectPoints.size() >= 3);
+	ocean_assert(objectPoints.size() == imagePoints.size());
+
+	const HomogenousMatrixT4<TFloat> flippedCamera_T_world(Camera::standard2InvertedFlipped(world_T_camera));
+
+	HomogenousMatrixD4 optimizedFlippedCamera_T_world(false);
+	if (!optimizePoseMixedPrecisionIF<TFloat>(camera, flippedCamera_T_world, objectPoints, imagePoints, optimizedFlippedCamera_T_world, iterations, estimator, lambda, lambdaFactor, initialError, finalError))
+	{
+		return false;
+	}
+
+	world_T_optimizedCamera = Camera::invertedFlipped2Standard(optimizedFlippedCamera_T_world);
+	return true;
+}
+
 inline bool NonLinearOptimizationPose::optimizePoseZoom(const PinholeCamera& pinholeCamera, const HomogenousMatrix4& world_T_camera, const Scalar zoom, const ConstIndexedAccessor<Vector3>& objectPoints, const ConstIndexedAccessor<Vector2>& imagePoints, const bool distortImagePoints, HomogenousMatrix4& world_T_optimizedCamera, Scalar& optimizedZoom, const unsigned int iterations, const Estimator::EstimatorType estimator, Scalar lambda, const Scalar lambdaFactor, Scalar* initialError, Scalar* finalError, const Matrix* invertedCovariances)
 {
 	ocean_assert(world_T_camera.isValid() && zoom > Numeric::eps());
@@ -22,8 +22,8 @@ class NonLinearOptimizationTransformation::AdvancedObjectTransformationOptimizat
 {
 	public:
 
-		inline AdvancedObjectTransformationOptimizationProvider(const AnyCamera& camera, const HomogenousMatrices4& flippedCameras_P_world, Pose& world_P_object, const ObjectPointGroups& objectPointGroups, const ImagePointGroups& imagePointGroups, const Estimator::EstimatorType estimator) :
-			camera_(camera),
+		inline AdvancedObjectTransformationOptimizationProvider(const ConstIndexedAccessor<const AnyCamera*>& cameras, const HomogenousMatrices4& flippedCameras_P_world, Pose& world_P_object, const ObjectPointGroups& objectPointGroups, const ImagePointGroups& imagePointGroups, const Estimator::EstimatorType estimator) :
+			cameras_(cameras),
 			flippedCameras_P_world_(flippedCameras_P_world),
 			world_P_object_(world_P_object),
 			world_P_candidateObject_(world_P_object),
@@ -32,12 +32,13 @@ class NonLinearOptimizationTransformation::AdvancedObjectTransformationOptimizat
 			estimator_(estimator),
 			measurements_(0)
 		{
-			ocean_assert(camera_.isValid());
+			ocean_assert(cameras_.size() == flippedCameras_P_world.size());
 			ocean_assert(flippedCameras_P_world.size() == objectPointGroups.size());
 			ocean_assert(flippedCameras_P_world.size() == imagePointGroups.size());
 
 			for (size_t n = 0; n < flippedCameras_P_world_.size(); ++n)
 			{
+				ocean_assert(cameras_[n] != nullptr && cameras_[n]->isValid());
 				ocean_assert(flippedCameras_P_world_[n].isValid());
 				ocean_assert(objectPointGroups[n].size() == imagePointGroups[n].size());
 
@@ -75,7 +76,7 @@ class NonLinearOptimizationTransformation::AdvancedObjectTransformationOptimizat
 					Vector2* weightedPoseErrors = weightedErrors_.data() + measurements;
 
 					// determine the averaged square error
-					const Scalar averagePoseSqrError = Error::determinePoseErrorIF<ConstTemplateArrayAccessor<Vector3>, ConstTemplateArrayAccessor<Vector2>, true, false>(flippedCamera_T_candidateObject, camera_, ConstTemplateArrayAccessor<Vector3>(objectPointGroups_[n]), ConstTemplateArrayAccessor<Vector2>(imagePointGroups_[n]), weightedPoseErrors);
+					const Scalar averagePoseSqrError = Error::determinePoseErrorIF<ConstTemplateArrayAccessor<Vector3>, ConstTemplateArrayAccessor<Vector2>, true, false>(flippedCamera_T_candidateObject, *cameras_[n], ConstTemplateArrayAccessor<Vector3>(objectPointGroups_[n]), ConstTemplateArrayAccessor<Vector2>(imagePointGroups_[n]), weightedPoseErrors);
 
 					// we will normalize the overall error at the end, we do not sum up averaged errors for individual poses
 					sqrError += averagePoseSqrError * Scalar(objectPointGroups_[n].size());
@@ -101,7 +102,7 @@ class NonLinearOptimizationTransformation::AdvancedObjectTransformationOptimizat
 					Vector2* const weightedPoseErrors = weightedErrors_.data() + measurements;
 					Scalar* const sqrPoseErrors = sqrErrors.data() + measurements;
 
-					Error::determinePoseErrorIF<ConstTemplateArrayAccessor<Vector3>, ConstTemplateArrayAccessor<Vector2>, true, true>(flippedCamera_T_candidateObject, camera_, ConstTemplateArrayAccessor<Vector3>(objectPointGroups_[n]), ConstTemplateArrayAccessor<Vector2>(imagePointGroups_[n]), weightedPoseErrors, sqrPoseErrors);
+					Error::determinePoseErrorIF<ConstTemplateArrayAccessor<Vector3>, ConstTemplateArrayAccessor<Vector2>, true, true>(flippedCamera_T_candidateObject, *cameras_[n], ConstTemplateArrayAccessor<Vector3>(objectPointGroups_[n]), ConstTemplateArrayAccessor<Vector2>(imagePointGroups_[n]), weightedPoseErrors, sqrPoseErrors);
 
 					measurements += objectPointGroups_[n].size();
 				}
@@ -185,7 +186,7 @@ class NonLinearOptimizationTransformation::AdvancedObjectTransformationOptimizat
 					{
 						const Vector3& objectPoint = objectPoints[nObject];
 
-						camera_.pointJacobian2x3IF(flippedCamera_T_object * objectPoint, xPointJacobian, yPointJacobian);
+						cameras_[nPose]->pointJacobian2x3IF(flippedCamera_T_object * objectPoint, xPointJacobian, yPointJacobian);
 
 						const Scalar jFocalPoseXx = xPointJacobian[0] * flippedCamera_T_world[0] + xPointJacobian[1] * flippedCamera_T_world[1] + xPointJacobian[2] * flippedCamera_T_world[2];
 						const Scalar jFocalPoseXy = xPointJacobian[0] * flippedCamera_T_world[4] + xPointJacobian[1] * flippedCamera_T_world[5] + xPointJacobian[2] * flippedCamera_T_world[6];
@@ -272,7 +273,7 @@ class NonLinearOptimizationTransformation::AdvancedObjectTransformationOptimizat
 					{
 						const Vector3& objectPoint = objectPoints[nObject];
 
-						camera_.pointJacobian2x3IF(flippedCamera_T_object * objectPoint, xPointJacobian, yPointJacobian);
+						cameras_[nPose]->pointJacobian2x3IF(flippedCamera_T_object * objectPoint, xPointJacobian, yPointJacobian);
 
 						const Scalar jFocalPoseXx = xPointJacobian[0] * flippedCamera_T_world[0] + xPointJacobian[1] * flippedCamera_T_world[1] + xPointJacobian[2] * flippedCamera_T_world[2];
 						const Scalar jFocalPoseXy = xPointJacobian[0] * flippedCamera_T_world[4] + xPointJacobian[1] * flippedCamera_T_world[5] + xPointJacobian[2] * flippedCamera_T_world[6];
@@ -412,7 +413,7 @@ class NonLinearOptimizationTransformation::AdvancedObjectTransformationOptimizat
 					Vector2* const weightedPoseErrors = debugWeightedErrors.data() + measurements;
 					Scalar* const sqrPoseErrors = debugSqrErrors.data() + measurements;
 
-					Error::determinePoseErrorIF<ConstTemplateArrayAccessor<Vector3>, ConstTemplateArrayAccessor<Vector2>, true, true>(candidateIF, camera_, ConstTemplateArrayAccessor<Vector3>(objectPointGroups_[n]), ConstTemplateArrayAccessor<Vector2>(imagePointGroups_[n]), weightedPoseErrors, sqrPoseErrors);
+					Error::determinePoseErrorIF<ConstTemplateArrayAccessor<Vector3>, ConstTemplateArrayAccessor<Vector2>, true, true>(candidateIF, *cameras_[n], ConstTemplateArrayAccessor<Vector3>(objectPointGroups_[n]), ConstTemplateArrayAccessor<Vector2>(imagePointGroups_[n]), weightedPoseErrors, sqrPoseErrors);
 
 					measurements += objectPointGroups_[n].size();
 				}
@@ -442,7 +443,7 @@ class NonLinearOptimizationTransformation::AdvancedObjectTransformationOptimizat
 					{
 						const Vectors3& objectPoints = objectPointGroups_[n];
 
-						Jacobian::calculateObjectTransformation2nx6(debugJacobian[measurements * 2], camera_, flippedCameras_P_world_[n], world_P_object_, objectPoints.data(), objectPoints.size());
+						Jacobian::calculateObjectTransformation2nx6(debugJacobian[measurements * 2], *cameras_[n], flippedCameras_P_world_[n], world_P_object_, objectPoints.data(), objectPoints.size());
 
 						measurements += objectPoints.size();
 					}
@@ -513,8 +514,8 @@ class NonLinearOptimizationTransformation::AdvancedObjectTransformationOptimizat
 
 	protected:
 
-		/// The camera profile to be used.
-		const AnyCamera& camera_;
+		/// The camera profiles to be used, one for each group of image points.
+		const ConstIndexedAccessor<const AnyCamera*>& cameras_;
 
 		/// The inverted and flipped camera poses, one for each group of image points.
 		const HomogenousMatrices4& flippedCameras_P_world_;
@@ -545,11 +546,18 @@ class NonLinearOptimizationTransformation::AdvancedObjectTransformationOptimizat
 };
 
 bool NonLinearOptimizationTransformation::optimizeObjectTransformationIF(const AnyCamera& camera, const HomogenousMatrices4& flippedCameras_T_world, const HomogenousMatrix4& world_T_object, const ObjectPointGroups& objectPointGroups, const ImagePointGroups& imagePointGroups, HomogenousMatrix4& optimized_world_T_object, const unsigned int iterations, const Estimator::EstimatorType estimator, Scalar lambda, const Scalar lambdaFactor, Scalar* initialError, Scalar* finalError, Scalars* intermediateErrors)
+{
+	ocean_assert(camera.isValid());
+
+	return optimizeObjectTransformationIF(ConstElementAccessor<const AnyCamera*>(flippedCameras_T_world.size(), &camera), flippedCameras_T_world, world_T_object, objectPointGroups, imagePointGroups, optimized_world_T_object, iterations, estimator, lambda, lambdaFactor, initialError, finalError, intermediateErrors);
+}
+
+bool NonLinearOptimizationTransformation::optimizeObjectTransformationIF(const ConstIndexedAccessor<const AnyCamera*>& cameras, const HomogenousMatrices4& flippedCameras_T_world, const HomogenousMatrix4& world_T_object, const ObjectPointGroups& objectPointGroups, const ImagePointGroups& imagePointGroups, HomogenousMatrix4& optimized_world_T_object, const unsigned int iterations, const Estimator::EstimatorType estimator, Scalar lambda, const Scalar lambdaFactor, Scalar* initialError, Scalar* finalError, Scalars* intermediateErrors)
 {
 
 #ifdef OCEAN_DEBUG
 
-	ocean_assert(camera.isValid());
+	ocean_assert(cameras.size() == flippedCameras_T_world.size());
 	ocean_assert(flippedCameras_T_world.size() >= 1);
 	ocean_assert(flippedCameras_T_world.size() == objectPointGroups.size());
 	ocean_assert(flippedCameras_T_world.size() == imagePointGroups.size());
@@ -557,6 +565,7 @@ bool NonLinearOptimizationTransformation::optimizeObjectTransformationIF(const A
 
 	for (size_t n = 0; n < flippedCameras_T_world.size(); ++n)
 	{
+		ocean_assert(cameras[n] != nullptr && cameras[n]->isValid());
 		ocean_assert(flippedCameras_T_world[n].isValid());
 		ocean_assert(objectPointGroups[n].size() >= 1);
 		ocean_assert(objectPointGroups[n].size() == imagePointGroups[n].size());
@@ -564,9 +573,14 @@ bool NonLinearOptimizationTransformation::optimizeObjectTransformationIF(const A
 
 #endif
 
+	if (cameras.size() != flippedCameras_T_world.size())
+	{
+		return false;
+	}
+
 	Pose objectTransformationPose(world_T_object);
 
-	AdvancedObjectTransformationOptimizationProvider provider(camera, flippedCameras_T_world, objectTransformationPose, objectPointGroups, imagePointGroups, estimator);
+	AdvancedObjectTransformationOptimizationProvider provider(cameras, flippedCameras_T_world, objectTransformationPose, objectPointGroups, imagePointGroups, estimator);
 	if (!advancedDenseOptimization<AdvancedObjectTransformationOptimizationProvider>(provider, iterations, lambda, lambdaFactor, initialError, finalError, intermediateErrors))
 	{
 		return false;
@@ -11,6 +11,8 @@
 #include "ocean/geometry/Geometry.h"
 #include "ocean/geometry/NonLinearOptimization.h"
 
+#include "ocean/base/Accessor.h"
+
 #include "ocean/math/AnyCamera.h"
 #include "ocean/math/HomogenousMatrix4.h"
 
@@ -79,6 +81,27 @@ class OCEAN_GEOMETRY_EXPORT NonLinearOptimizationTransformation : protected NonL
 		 */
 		static bool optimizeObjectTransformationIF(const AnyCamera& camera, const HomogenousMatrices4& flippedCameras_T_world, const HomogenousMatrix4& world_T_object, const ObjectPointGroups& objectPointGroups, const ImagePointGroups& imagePointGroups, HomogenousMatrix4& optimized_world_T_object, const unsigned int iterations = 20u, const Estimator::EstimatorType estimator = Estimator::ET_SQUARE, Scalar lambda = Scalar(0.001), const Scalar lambdaFactor = Scalar(5), Scalar* initialError = nullptr, Scalar* finalError = nullptr, Scalars* intermediateErrors = nullptr);
 
+		/**
+		 * Minimizes the projection error for several 3D object points projected into several camera images via a 6-DOF object transformation (to be optimized).
+		 * This function applies the same optimization as optimizeObjectTransformationIF() while each group of image points can be connected with an individual camera profile, e.g., for rigs with several cameras.
+		 * @param cameras The camera profiles, one for each camera pose, must be valid
+		 * @param flippedCameras_T_world Several inverted and flipped 6-DOF camera poses which will not be adjusted, one pose for each group of 2D image points
+		 * @param world_T_object The 6-DOF object transformation to be optimized, with orthonormal rotation matrix, must be valid
+		 * @param objectPointGroups The groups of 3D object points to be projected into the camera images, one group for each camera pose, each group with at least one object point
+		 * @param imagePointGroups The groups of 2D image points, one group for each camera pose, each image point has a corresponding 3D object point
+		 * @param optimized_world_T_object The resulting optimized 6-DOF object point transformation
+		 * @param iterations Number of iterations to be applied at most, if no convergence can be reached, with range [1, infinity)
+		 * @param estimator The robust error estimator to be used
+		 * @param lambda Initial Levenberg-Marquardt damping value which may be changed after each iteration using the damping factor, with range [0, infinity)
+		 * @param lambdaFactor Levenberg-Marquardt damping factor to be applied to the damping value, with range [1, infinity)
+		 * @param initialError Optional resulting averaged pixel error for the given initial parameters, in relation to the defined estimator
+		 * @param finalError Optional resulting averaged pixel error for the final optimized parameters, in relation to the defined estimator
+		 * @param intermediateErrors Optional resulting averaged pixel errors for each intermediate optimization step, in relation to the defined estimator
+		 * @return True, if the optimization succeeded
+		 * @see optimizeObjectTransformationIF(), optimizeObjectTransformationStereoIF().
+		 */
+		static bool optimizeObjectTransformationIF(const ConstIndexedAccessor<const AnyCamera*>& cameras, const HomogenousMatrices4& flippedCameras_T_world, const HomogenousMatrix4& world_T_object, const ObjectPointGroups& objectPointGroups, const ImagePointGroups& imagePointGroups, HomogenousMatrix4& optimized_world_T_object, const unsigned int iterations = 20u, const Estimator::EstimatorType estimator = Estimator::ET_SQUARE, Scalar lambda = Scalar(0.001), const Scalar lambdaFactor = Scalar(5), Scalar* initialError = nullptr, Scalar* finalError = nullptr, Scalars* intermediateErrors = nullptr);
+
 		/**
 		 * Minimizes the projection error for several 3D object points projected into several stereo camera images via a 6-DOF object transformation (to be optimized).
 		 * The individual camera poses and the camera profile will not be adjusted.<br>
@@ -13,6 +13,8 @@
 
 #include "ocean/base/StaticBuffer.h"
 
+#include "ocean/math/StaticMatrix.h"
+
 namespace Ocean
 {
 
@@ -21,7 +23,9 @@ namespace Geometry
 
 /**
  * This class implements an optimization for universal dense problems with one model (optimization problem).
- * The implementation allows to optimize arbitrary (universal) problems with arbitrary dimensions.
+ * The implementation allows to optimize arbitrary (universal) problems with arbitrary dimensions.<br>
+ * Models with at most 'maximalStaticModelSize' parameters are optimized with a fixed-size Levenberg-Marquardt implementation which accumulates the normal equations element by element in static matrices and solves them with an unrolled Cholesky decomposition.<br>
+ * Thus, these models are optimized without building the entire Jacobian matrix, and without any heap allocation for the square estimator.
  * @tparam tModelSize Size of the model, the number of model parameters
  * @tparam tResultDimension Number of dimensions that result for each element (measurement) after the model has been applied
  * @tparam tExternalModelSize Size of the external model, the number of model parameters
@@ -79,8 +83,23 @@ class NonLinearUniversalOptimizationDense : protected NonLinearOptimization
 		 */
 		using ModelAdjustmentCallback = Callback<void, Model&>;
 
+		/**
+		 * The maximal size of a model which is optimized with the fixed-size implementation.
+		 */
+		static constexpr unsigned int maximalStaticModelSize = 12u;
+
 	protected:
 
+		/**
+		 * Definition of a static matrix holding the (damped) Hessian approximation J^T * J.
+		 */
+		using StaticJTJ = StaticMatrix<Scalar, tModelSize, tModelSize>;
+
+		/**
+		 * Definition of a static vector holding a model-sized vector e.g., J^T * error or the optimization deltas.
+		 */
+		using StaticVector = StaticMatrix<Scalar, tModelSize, 1>;
+
 		/**
 		 * This class implements a dense universal optimization provider for universal models and measurement/data values.
 		 */
@@ -151,6 +170,90 @@ class NonLinearUniversalOptimizationDense : protected NonLinearOptimization
 				const ModelAdjustmentCallback modelAdjustmentCallback_;
 		};
 
+		/**
+		 * This class implements a fixed-size universal optimization provider for small models.
+		 * In contrast to the UniversalOptimizationProvider, this provider does not determine the entire Jacobian matrix and error vector.<br>
+		 * Instead, the Jacobian of each individual element is determined on the stack and directly accumulated into the normal equations.
+		 */
+		class StaticUniversalOptimizationProvider
+		{
+			public:
+
+				/**
+				 * Creates a new fixed-size universal optimization object.
+				 * @param model The model to be optimized
+				 * @param numberElements Number of elements (measurements) that are used to determine the optimized model, with range [1, infinity)
+				 * @param valueCallback Callback function that is used to determine the value for an individual element (measurement) by application of the model
+				 * @param errorCallback Callback function that is used to determine the error for an individual element (measurement)
+				 * @param modelTransformationCallback Callback function allowing to transform the internal model into an extern model if intended
+				 * @param modelAdjustmentCallback Callback function allowing to adjust the internal model before it will be accepted or rejected
+				 */
+				inline StaticUniversalOptimizationProvider(Model& model, const size_t numberElements, const ValueCallback& valueCallback, const ErrorCallback& errorCallback, const ModelTransformationCallback& modelTransformationCallback, const ModelAdjustmentCallback& modelAdjustmentCallback);
+
+				/**
+				 * Determines the normal equations J^T * diag(weights) * J and J^T * diag(weights) * error for the current model.
+				 * The weights of a robust estimator are determined based on the standard deviation of the current model, which is determined in determineRobustError().
+				 * @param JTJ The resulting (upper and lower) triangle of J^T * diag(weights) * J
+				 * @param jErrors The resulting vector J^T * diag(weights) * error
+				 * @return True, if the errors of all elements could be determined
+				 * @tparam tEstimator The type of the estimator that is applied for error determination
+				 */
+				template <Estimator::EstimatorType tEstimator>
+				bool determineNormalEquations(StaticJTJ& JTJ, StaticVector& jErrors) const;
+
+				/**
+				 * Applies the model correction and stores the new model as candidate
+				 * @param deltas Optimization deltas that define the correction
+				 */
+				inline void applyCorrection(const StaticVector& deltas);
+
+				/**
+				 * Determines the robust error of the current candidate model.
+				 * @param useCandidate True, to determine the error of the candidate model; False, to determine the error of the current model
+				 * @return The resulting robust error, Numeric::maxValue() if the error of an element could not be determined
+				 * @tparam tEstimator The type of the estimator that is applied for error determination
+				 */
+				template <Estimator::EstimatorType tEstimator>
+				Scalar determineRobustError(const bool useCandidate);
+
+				/**
+				 * Accepts the current model candidate as better model.
+				 */
+				inline void acceptCorrection();
+
+			protected:
+
+				/// Universal model that will be optimized.
+				Model& model_;
+
+				/// Universal model that stores the most recent optimization result as candidate.
+				Model candidateModel_;
+
+				/// The number of measurement elements that are used to optimize the model.
+				const size_t numberElements_;
+
+				/// The value calculation callback function.
+				const ValueCallback& valueCallback_;
+
+				/// The error calculation callback function.
+				const ErrorCallback& errorCallback_;
+
+				/// The Callback function allowing to transform the model into an external model before the value and error callback functions are invoked.
+				const ModelTransformationCallback& modelTransformationCallback_;
+
+				/// The optional callback function allowing to adjust a model before it is accepted or rejected
+				const ModelAdjustmentCallback& modelAdjustmentCallback_;
+
+				/// The squared standard deviation of the errors of the current model, used by robust estimators only.
+				Scalar sqrSigma_ = 0;
+
+				/// The squared standard deviation of the errors of the candidate model, used by robust estimators only.
+				Scalar candidateSqrSigma_ = 0;
+
+				/// The reusable squared errors of the individual elements, used by estimators needing a standard deviation only.
+				Scalars sqrErrors_;
+		};
+
 	public:
 
 		/**
@@ -172,6 +275,41 @@ class NonLinearUniversalOptimizationDense : protected NonLinearOptimization
 		 * @return True, if the model could be optimized
 		 */
 		static bool optimizeUniversalModel(const Model& model, const size_t numberElements, const ValueCallback& valueCallback, const ErrorCallback& errorCallback, const ModelTransformationCallback& modelTransformationCallback, const ModelAdjustmentCallback& modelAdjustmentCallback, Model& optimizedModel, const unsigned int iterations = 5u, const Estimator::EstimatorType estimator = Estimator::ET_SQUARE, Scalar lambda = Scalar(0.001), const Scalar lambdaFactor = Scalar(5), Scalar* initialError = nullptr, Scalar* finalError = nullptr, Scalars* intermediateErrors = nullptr);
+
+		/**
+		 * Optimizes a universal model by minimizing the error the model produces, always with the dynamic implementation based on Matrix objects.
+		 * In contrast to optimizeUniversalModel(), this function does not use the fixed-size implementation for small models, e.g., to validate the fixed-size implementation.
+		 * @see optimizeUniversalModel().
+		 */
+		static bool optimizeUniversalModelDynamic(const Model& model, const size_t numberElements, const ValueCallback& valueCallback, const ErrorCallback& errorCallback, const ModelTransformationCallback& modelTransformationCallback, const ModelAdjustmentCallback& modelAdjustmentCallback, Model& optimizedModel, const unsigned int iterations = 5u, const Estimator::EstimatorType estimator = Estimator::ET_SQUARE, Scalar lambda = Scalar(0.001), const Scalar lambdaFactor = Scalar(5), Scalar* initialError = nullptr, Scalar* finalError = nullptr, Scalars* intermediateErrors = nullptr);
+
+	protected:
+
+		/**
+		 * Optimizes a universal model with the fixed-size Levenberg-Marquardt implementation.
+		 * The optimization applies the same damping strategy as NonLinearOptimization::denseOptimization().
+		 * @param provider The fixed-size optimization provider
+		 * @param iterations Number of iterations to be applied at most, if no convergence can be reached
+		 * @param lambda Initial Levenberg-Marquardt damping value which may be changed after each iteration using the damping factor, with range [0, infinity)
+		 * @param lambdaFactor Levenberg-Marquardt damping factor to be applied to the damping value, with range [1, infinity)
+		 * @param initialError Optional resulting averaged pixel error for the given initial parameters, in relation to the defined estimator
+		 * @param finalError Optional resulting averaged pixel error for the final optimized parameters, in relation to the defined estimator
+		 * @param intermediateErrors Optional resulting intermediate (improving) errors
+		 * @return True, if the model could be optimized
+		 * @tparam tEstimator The type of the estimator that is applied for error determination
+		 */
+		template <Estimator::EstimatorType tEstimator>
+		static bool staticOptimization(StaticUniversalOptimizationProvider& provider, const unsigned int iterations, Scalar lambda, const Scalar lambdaFactor, Scalar* initialError, Scalar* finalError, Scalars* intermediateErrors);
+
+		/**
+		 * Solves the linear system JTJ * x = b for a symmetric positive definite matrix with an in-place Cholesky decomposition.
+		 * Only the upper triangle of the matrix is used.
+		 * @param JTJ The symmetric positive definite matrix
+		 * @param b The right-hand side of the system
+		 * @param x The resulting solution
+		 * @return True, if the matrix is positive definite and the system could be solved
+		 */
+		static bool solveCholesky(const StaticJTJ& JTJ, const StaticVector& b, StaticVector& x);
 };
 
 template <unsigned int tModelSize, unsigned int tResultDimension, unsigned int tExternalModelSize>
@@ -322,8 +460,247 @@ inline void NonLinearUniversalOptimizationDense<tModelSize, tResultDimension, tE
 	model_ = candidateModel_;
 }
 
+template <unsigned int tModelSize, unsigned int tResultDimension, unsigned int tExternalModelSize>
+inline NonLinearUniversalOptimizationDense<tModelSize, tResultDimension, tExternalModelSize>::StaticUniversalOptimizationProvider::StaticUniversalOptimizationProvider(Model& model, const size_t numberElements, const ValueCallback& valueCallback, const ErrorCallback& errorCallback, const ModelTransformationCallback& modelTransformationCallback, const ModelAdjustmentCallback& modelAdjustmentCallback) :
+	model_(model),
+	candidateModel_(model),
+	numberElements_(numberElements),
+	valueCallback_(valueCallback),
+	errorCallback_(errorCallback),
+	modelTransformationCallback_(modelTransformationCallback),
+	modelAdjustmentCallback_(modelAdjustmentCallback)
+{
+	ocean_assert(numberElements_ != 0);
+
+	ocean_assert(valueCallback_);
+	ocean_assert(errorCallback_);
+	ocean_assert(modelTransformationCallback_);
+}
+
+template <unsigned int tModelSize, unsigned int tResultDimension, unsigned int tExternalModelSize>
+template <Estimator::EstimatorType tEstimator>
+bool NonLinearUniversalOptimizationDense<tModelSize, tResultDimension, tExternalModelSize>::StaticUniversalOptimizationProvider::determineNormalEquations(StaticJTJ& JTJ, StaticVector& jErrors) const
+{
+	ocean_assert(valueCallback_);
+	ocean_assert(errorCallback_);
+	ocean_assert(modelTransformationCallback_);
+
+	const Scalar eps = Numeric::weakEps();
+	const Scalar invEps = Scalar(1) / eps;
+
+	// transform the internal to the external model
+	ExternalModel externalModel;
+	modelTransformationCallback_(model_, externalModel);
+
+	// stores individual models, each model with one individual epsilon offset
+	StaticBuffer<ExternalModel, tModelSize> externalEpsModels;
+	for (size_t a = 0; a < tModelSize; ++a)
+	{
+		Model internalModel = model_;
+		internalModel[a] += eps;
+
+		modelTransformationCallback_(internalModel, externalEpsModels[a]);
+	}
+
+	JTJ.toNull();
+	jErrors.toNull();
+
+	// the Jacobian of one element, row-major
+	Scalar jacobian[tResultDimension][tModelSize];
+
+	Result result, epsResult, error;
+	for (size_t n = 0; n < numberElements_; ++n)
+	{
+		// calculate the value for the current model
+		valueCallback_(externalModel, n, result);
+
+		for (size_t m = 0; m < tModelSize; ++m)
+		{
+			// calculate the value for the epsilon model
+			valueCallback_(externalEpsModels[m], n, epsResult);
+
+			for (size_t d = 0; d < tResultDimension; ++d)
+			{
+				jacobian[d][m] = (epsResult[d] - result[d]) * invEps;
+			}
+		}
+
+		// the errors of the current model are determined again instead of storing the error vector for all elements
+
+		if (!errorCallback_(externalModel, n, error))
+		{
+			return false;
+		}
+
+		Scalar weight = Scalar(1);
+
+		if constexpr (!Estimator::isStandardEstimator<tEstimator>())
+		{
+			// the same weight as applied in NonLinearOptimization::sqrErrors2robustErrors()
+			weight = max(Numeric::weakEps(), Estimator::robustWeightSquare<tEstimator>(Numeric::summedSqr(error.data(), tResultDimension), sqrSigma_));
+		}
+
+		for (size_t d = 0; d < tResultDimension; ++d)
+		{
+			const Scalar* const jacobianRow = jacobian[d];
+			const Scalar weightedError = error[d] * weight;
+
+			for (size_t r = 0; r < tModelSize; ++r)
+			{
+				const Scalar weightedJacobian = jacobianRow[r] * weight;
+
+				jErrors(r, 0) += jacobianRow[r] * weightedError;
+
+				// we accumulate the upper triangle only
+				for (size_t c = r; c < tModelSize; ++c)
+				{
+					JTJ(r, c) += weightedJacobian * jacobianRow[c];
+				}
+			}
+		}
+	}
+
+	for (size_t r = 1; r < tModelSize; ++r)
+	{
+		for (size_t c = 0; c < r; ++c)
+		{
+			JTJ(r, c) = JTJ(c, r);
+		}
+	}
+
+	return true;
+}
+
+template <unsigned int tModelSize, unsigned int tResultDimension, unsigned int tExternalModelSize>
+inline void NonLinearUniversalOptimizationDense<tModelSize, tResultDimension, tExternalModelSize>::StaticUniversalOptimizationProvider::applyCorrection(const StaticVector& deltas)
+{
+	for (size_t n = 0; n < tModelSize; ++n)
+	{
+		candidateModel_[n] = model_[n] - deltas(n, 0);
+	}
+
+	if (modelAdjustmentCallback_)
+	{
+		modelAdjustmentCallback_(candidateModel_);
+	}
+}
+
+template <unsigned int tModelSize, unsigned int tResultDimension, unsigned int tExternalModelSize>
+template <Estimator::EstimatorType tEstimator>
+Scalar NonLinearUniversalOptimizationDense<tModelSize, tResultDimension, tExternalModelSize>::StaticUniversalOptimizationProvider::determineRobustError(const bool useCandidate)
+{
+	ocean_assert(errorCallback_);
+	ocean_assert(modelTransformationCallback_);
+
+	ExternalModel externalModel;
+	modelTransformationCallback_(useCandidate ? candidateModel_ : model_, externalModel);
+
+	if constexpr (Estimator::needSigma<tEstimator>())
+	{
+		// the vector is reused for all iterations of one optimization
+		sqrErrors_.clear();
+		sqrErrors_.reserve(numberElements_);
+	}
+
+	Scalar sqrError = 0;
+
+	Result error;
+	for (size_t n = 0; n < numberElements_; ++n)
+	{
+		if (!errorCallback_(externalModel, n, error))
+		{
+			return Numeric::maxValue();
+		}
+
+		const Scalar elementSqrError = Numeric::summedSqr(error.data(), tResultDimension);
+
+		if constexpr (Estimator::needSigma<tEstimator>())
+		{
+			sqrErrors_.emplace_back(elementSqrError);
+		}
+		else
+		{
+			if constexpr (Estimator::isStandardEstimator<tEstimator>())
+			{
+				sqrError += elementSqrError;
+			}
+			else
+			{
+				sqrError += elementSqrError * max(Numeric::weakEps(), Estimator::robustWeightSquare<tEstimator>(elementSqrError, Scalar(0)));
+			}
+		}
+	}
+
+	if constexpr (Estimator::needSigma<tEstimator>())
+	{
+		ocean_assert(sqrErrors_.size() == numberElements_);
+
+		const Scalar sqrSigma = Numeric::sqr(Estimator::determineSigmaSquare<tEstimator>(sqrErrors_.data(), sqrErrors_.size(), tModelSize));
+
+		for (const Scalar& elementSqrError : sqrErrors_)
+		{
+			sqrError += elementSqrError * max(Numeric::weakEps(), Estimator::robustWeightSquare<tEstimator>(elementSqrError, sqrSigma));
+		}
+
+		if (useCandidate)
+		{
+			candidateSqrSigma_ = sqrSigma;
+		}
+		else
+		{
+			sqrSigma_ = sqrSigma;
+		}
+	}
+
+	return sqrError / Scalar(numberElements_);
+}
+
+template <unsigned int tModelSize, unsigned int tResultDimension, unsigned int tExternalModelSize>
+inline void NonLinearUniversalOptimizationDense<tModelSize, tResultDimension, tExternalModelSize>::StaticUniversalOptimizationProvider::acceptCorrection()
+{
+	model_ = candidateModel_;
+	sqrSigma_ = candidateSqrSigma_;
+}
+
 template <unsigned int tModelSize, unsigned int tResultDimension, unsigned int tExternalModelSize>
 bool NonLinearUniversalOptimizationDense<tModelSize, tResultDimension, tExternalModelSize>::optimizeUniversalModel(const Model& model, const size_t numberElements, const ValueCallback& valueCallback, const ErrorCallback& errorCallback, const ModelTransformationCallback& modelTransformationCallback, const ModelAdjustmentCallback& modelAdjustmentCallback, Model& optimizedModel, const unsigned int iterations, const Estimator::EstimatorType estimator, Scalar lambda, const Scalar lambdaFactor, Scalar* initialError, Scalar* finalError, Scalars* intermediateErrors)
+{
+	ocean_assert(&model != &optimizedModel);
+
+	if constexpr (tModelSize <= maximalStaticModelSize)
+	{
+		optimizedModel = model;
+
+		StaticUniversalOptimizationProvider provider(optimizedModel, numberElements, valueCallback, errorCallback, modelTransformationCallback, modelAdjustmentCallback);
+
+		switch (estimator)
+		{
+			case Estimator::ET_SQUARE:
+				return staticOptimization<Estimator::ET_SQUARE>(provider, iterations, lambda, lambdaFactor, initialError, finalError, intermediateErrors);
+
+			case Estimator::ET_LINEAR:
+				return staticOptimization<Estimator::ET_LINEAR>(provider, iterations, lambda, lambdaFactor, initialError, finalError, intermediateErrors);
+
+			case Estimator::ET_HUBER:
+				return staticOptimization<Estimator::ET_HUBER>(provider, iterations, lambda, lambdaFactor, initialError, finalError, intermediateErrors);
+
+			case Estimator::ET_TUKEY:
+				return staticOptimization<Estimator::ET_TUKEY>(provider, iterations, lambda, lambdaFactor, initialError, finalError, intermediateErrors);
+
+			case Estimator::ET_CAUCHY:
+				return staticOptimization<Estimator::ET_CAUCHY>(provider, iterations, lambda, lambdaFactor, initialError, finalError, intermediateErrors);
+
+			default:
+				ocean_assert(false && "Invalid estimator!");
+				return false;
+		}
+	}
+
+	return optimizeUniversalModelDynamic(model, numberElements, valueCallback, errorCallback, modelTransformationCallback, modelAdjustmentCallback, optimizedModel, iterations, estimator, lambda, lambdaFactor, initialError, finalError, intermediateErrors);
+}
+
+template <unsigned int tModelSize, unsigned int tResultDimension, unsigned int tExternalModelSize>
+bool NonLinearUniversalOptimizationDense<tModelSize, tResultDimension, tExternalModelSize>::optimizeUniversalModelDynamic(const Model& model, const size_t numberElements, const ValueCallback& valueCallback, const ErrorCallback& errorCallback, const ModelTransformationCallback& modelTransformationCallback, const ModelAdjustmentCallback& modelAdjustmentCallback, Model& optimizedModel, const unsigned int iterations, const Estimator::EstimatorType estimator, Scalar lambda, const Scalar lambdaFactor, Scalar* initialError, Scalar* finalError, Scalars* intermediateErrors)
 {
 	ocean_assert(&model != &optimizedModel);
 	optimizedModel = model;
@@ -332,6 +709,220 @@ bool NonLinearUniversalOptimizationDense<tModelSize, tResultDimension, tExternal
 	return NonLinearOptimization::denseOptimization<UniversalOptimizationProvider>(provider, iterations, estimator, lambda, lambdaFactor, initialError, finalError, nullptr, intermediateErrors);
 }
 
+template <unsigned int tModelSize, unsigned int tResultDimension, unsigned int tExternalModelSize>
+template <Estimator::EstimatorType tEstimator>
+bool NonLinearUniversalOptimizationDense<tModelSize, tResultDimension, tExternalModelSize>::staticOptimization(StaticUniversalOptimizationProvider& provider, const unsigned int iterations, Scalar lambda, const Scalar lambdaFactor, Scalar* initialError, Scalar* finalError, Scalars* intermediateErrors)
+{
+	constexpr Scalar maxLambda = Scalar(1e8);
+
+	ocean_assert(lambda >= Numeric::eps() && lambda <= maxLambda);
+
+	StaticJTJ JTJ(false);
+	StaticVector jErrors(false);
+	StaticVector deltas(false);
+
+	Scalar bestError = provider.template determineRobustError<tEstimator>(false /*useCandidate*/);
+
+	if (bestError == Numeric::maxValue())
+	{
+		ocean_assert(false && "The initial model was invalid and thus the optimization cannot be applied!");
+		return false;
+	}
+
+	if (initialError != nullptr)
+	{
+		*initialError = bestError;
+	}
+
+	if (intermediateErrors != nullptr)
+	{
+		ocean_assert(intermediateErrors->empty());
+		intermediateErrors->push_back(bestError);
+	}
+
+	bool oneValidIteration = false;
+
+	unsigned int i = 0u;
+	while (i < iterations)
+	{
+		if (!provider.template determineNormalEquations<tEstimator>(JTJ, jErrors))
+		{
+			ocean_assert(false && "The accepted model must provide valid errors!");
+			break;
+		}
+
+		Scalar JTJdiagonal[tModelSize];
+		for (size_t n = 0; n < tModelSize; ++n)
+		{
+			JTJdiagonal[n] = JTJ(n, n);
+		}
+
+		while (i < iterations)
+		{
+			++i;
+
+			// J^T * J = J^T * J + lambda * diag(J^T * J)
+			if (lambda > Numeric::eps())
+			{
+				for (size_t n = 0; n < tModelSize; ++n)
+				{
+					JTJ(n, n) = JTJdiagonal[n] * (Scalar(1) + lambda);
+				}
+			}
+
+			// JTJ * deltas = J^T * error, thus we receive negative deltas which are subtracted from the current model
+
+			if (solveCholesky(JTJ, jErrors, deltas))
+			{
+				oneValidIteration = true;
+
+				// check whether the offset has been converged, the norm is the sum of absolute values as in Matrix::norm()
+				Scalar deltasNorm = 0;
+				for (size_t n = 0; n < tModelSize; ++n)
+				{
+					deltasNorm += Numeric::abs(deltas(n, 0));
+				}
+
+				if (Numeric::isEqualEps(deltasNorm / Scalar(tModelSize)))
+				{
+					i = iterations;
+				}
+
+				provider.applyCorrection(deltas);
+
+				const Scalar iterationError = provider.template determineRobustError<tEstimator>(true /*useCandidate*/);
+
+				// check whether the new error is not better than the best one
+				if (iterationError >= bestError)
+				{
+					// modify the lambda parameter and start a new optimization, as long as the lambda is not zero already or too large
+					if (lambdaFactor > Numeric::eps() && lambda > 0 && lambda <= maxLambda)
+					{
+						lambda *= lambdaFactor;
+					}
+					else
+					{
+						ocean_assert(oneValidIteration && "At this moment we should have at least one valid iteration!");
+
+						// no further improvement can be applied
+						i = iterations;
+					}
+
+					continue;
+				}
+
+				// we have an improvement
+				bestError = iterationError;
+
+				if (intermediateErrors != nullptr)
+				{
+					intermediateErrors->push_back(bestError);
+				}
+
+				provider.acceptCorrection();
+
+				if (Numeric::isNotEqualEps(lambdaFactor))
+				{
+					// we do not decrease lambda if lambda is already near to zero so that we simply should stop optimization if we fail to reduce the error
+					if (lambda > Numeric::eps())
+					{
+						lambda /= lambdaFactor;
+					}
+				}
+
+				//  skip this inner loop here as new normal equations have to be calculated
+				break;
+			}
+			else if (lambda > Numeric::eps() && lambda <= maxLambda)
+			{
+				lambda *= lambdaFactor;
+			}
+			else
+			{
+				ocean_assert(oneValidIteration && "At this moment we should have at least one valid iteration!");
+
+				// no further improvement can be applied
+				i = iterations;
+			}
+		}
+	}
+
+	if (finalError != nullptr)
+	{
+		*finalError = bestError;
+	}
+
+	return oneValidIteration;
+}
+
+template <unsigned int tModelSize, unsigned int tResultDimension, unsigned int tExternalModelSize>
+bool NonLinearUniversalOptimizationDense<tModelSize, tResultDimension, tExternalModelSize>::solveCholesky(const StaticJTJ& JTJ, const StaticVector& b, StaticVector& x)
+{
+	// the lower triangular matrix L with JTJ = L * L^T, the inverted diagonal elements are stored separately
+	Scalar lower[tModelSize][tModelSize];
+	Scalar invDiagonal[tModelSize];
+
+	for (size_t i = 0; i < tModelSize; ++i)
+	{
+		for (size_t j = 0; j <= i; ++j)
+		{
+			Scalar value = JTJ(j, i);
+
+			for (size_t k = 0; k < j; ++k)
+			{
+				value -= lower[i][k] * lower[j][k];
+			}
+
+			if (i == j)
+			{
+				if (value <= Numeric::eps())
+				{
+					return false;
+				}
+
+				const Scalar diagonal = Numeric::sqrt(value);
+
+				lower[i][i] = diagonal;
+				invDiagonal[i] = Scalar(1) / diagonal;
+			}
+			else
+			{
+				lower[i][j] = value * invDiagonal[j];
+			}
+		}
+	}
+
+	// forward substitution: L * y = b
+
+	for (size_t i = 0; i < tModelSize; ++i)
+	{
+		Scalar value = b(i, 0);
+
+		for (size_t k = 0; k < i; ++k)
+		{
+			value -= lower[i][k] * x(k, 0);
+		}
+
+		x(i, 0) = value * invDiagonal[i];
+	}
+
+	// backward substitution: L^T * x = y
+
+	for (size_t i = tModelSize; i-- > 0;)
+	{
+		Scalar value = x(i, 0);
+
+		for (size_t k = i + 1; k < tModelSize; ++k)
+		{
+			value -= lower[k][i] * x(k, 0);
+		}
+
+		x(i, 0) = value * invDiagonal[i];
+	}
+
+	return true;
+}
+
 }
 
 }
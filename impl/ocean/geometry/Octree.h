@@ -10,6 +10,8 @@
 
 #include "ocean/geometry/Geometry.h"
 
+#include "ocean/base/Worker.h"
+
 #include "ocean/math/BoundingBox.h"
 #include "ocean/math/Line3.h"
 #include "ocean/math/Vector3.h"
@@ -47,7 +49,9 @@ using OctreeF = OctreeT<float>;
 
 /**
  * This class implements an Octree allowing to manage 3D points.
- * Each node in the Octree has exactly eight child nodes (unless it is a leaf node).
+ * Each node in the Octree has exactly eight child nodes (unless it is a leaf node).<br>
+ * The eight child nodes of a node are ordered like the octants of a Morton (Z-order) code, so that the leaf nodes follow the spatial order of the tree's points.<br>
+ * Applications issuing many queries should store the tree points in Morton order (see mortonOrder()) and should use the batched closestPoints() function.
  * @ingroup geometry
  */
 template <typename T>
@@ -124,6 +128,48 @@ class OctreeT
 				mutable std::vector<const OctreeT<T>*> internalData_;
 		};
 
+	protected:
+
+		/**
+		 * This class stores the information of a node whose construction has been deferred so that several nodes can be constructed in parallel.
+		 */
+		class DeferredNode
+		{
+			public:
+
+				/**
+				 * Creates a new object.
+				 * @param node The node to be constructed, must be valid
+				 * @param reusablePointIndicesInput The indices of the points for which the node will be created, must be valid
+				 * @param reusablePointIndicesOutput Memory block of indices with same size as 'reusableIndicesInput' which can be re-used internally, must be valid
+				 * @param numberPointIndices The number of given indices in 'reusablePointIndicesInput', with range [0, infinity)
+				 * @param boundingBox The bounding box of the node
+				 */
+				inline DeferredNode(OctreeT<T>* node, Index32* reusablePointIndicesInput, Index32* reusablePointIndicesOutput, const size_t numberPointIndices, const BoundingBox& boundingBox);
+
+			public:
+
+				/// The node to be constructed.
+				OctreeT<T>* node_ = nullptr;
+
+				/// The indices of the points for which the node will be created.
+				Index32* reusablePointIndicesInput_ = nullptr;
+
+				/// Memory block of indices which can be re-used internally.
+				Index32* reusablePointIndicesOutput_ = nullptr;
+
+				/// The number of point indices.
+				size_t numberPointIndices_ = 0;
+
+				/// The bounding box of the node.
+				BoundingBox boundingBox_;
+		};
+
+		/**
+		 * Definition of a vector holding deferred nodes.
+		 */
+		using DeferredNodes = std::vector<DeferredNode>;
+
 	public:
 
 		/**
@@ -149,8 +195,9 @@ class OctreeT
 		 * @param treePoints The points for which the tree will be created, can be 'nullptr' if 'numberTreePoints == 0'
 		 * @param numberTreePoints The number given tree points, with range [0, infinity)
 		 * @param parameters The parameters to used to construct the tree, must be valid
+		 * @param worker Optional worker to distribute the construction of the tree's sub-trees, nullptr to construct the tree with one thread
 		 */
-		OctreeT(const VectorT3<T>* treePoints, const size_t numberTreePoints, const Parameters& parameters = Parameters());
+		OctreeT(const VectorT3<T>* treePoints, const size_t numberTreePoints, const Parameters& parameters = Parameters(), Worker* worker = nullptr);
 
 		/**
 		 * Destructs this tree node.
@@ -213,6 +260,18 @@ class OctreeT
 		 */
 		void closestPoints(const VectorT3<T>* treePoints, const VectorT3<T>& queryPoint, const T maximalDistance, Indices32& pointIndices, VectorsT3<T>* points = nullptr, const ReusableData& reusableData = ReusableData()) const;
 
+		/**
+		 * Returns the closest tree points for several query points.
+		 * The query points are processed in Morton order, consecutive query points located close to each other share the traversal of the tree.
+		 * @param treePoints The tree points from which the closest points will be determined (must be the same points for which the tree has been created), must be valid
+		 * @param queryPoints The query points for which the closest points will be returned, must be valid
+		 * @param numberQueryPoints The number of query points, with range [1, infinity)
+		 * @param maximalDistance The maximal distance between a query point and any potential tree point, with range [0, infinity)
+		 * @param pointIndicesGroups The resulting groups of indices of tree points, one group for each query point with all tree points having a maximal distance of 'maximalDistance' to the query point, the indices within a group are in arbitrary order
+		 * @param worker Optional worker to distribute the computation
+		 */
+		void closestPoints(const VectorT3<T>* treePoints, const VectorT3<T>* queryPoints, const size_t numberQueryPoints, const T maximalDistance, std::vector<Indices32>& pointIndicesGroups, Worker* worker = nullptr) const;
+
 		/**
 		 * Returns whether this node is valid (if this node has a valid bounding box)
 		 * @return True, if so
@@ -233,6 +292,24 @@ class OctreeT
 		 */
 		OctreeT& operator=(const OctreeT& octree) = delete;
 
+		/**
+		 * Returns the Morton (Z-order) code of a 3D point within a bounding box.
+		 * Each coordinate is quantized with 21 bits, the bits of the x-coordinate are the most significant bits of each triple (matching the order of the child nodes).
+		 * @param point The point for which the code will be returned
+		 * @param boundingBox The bounding box defining the quantization, points outside of the box are clamped, must be valid
+		 * @return The resulting Morton code
+		 */
+		static inline uint64_t mortonCode(const VectorT3<T>& point, const BoundingBox& boundingBox);
+
+		/**
+		 * Returns the Morton (Z-order) of several 3D points.
+		 * Storing the tree points in this order before creating the tree improves the memory locality of all queries.
+		 * @param points The points for which the order will be determined, must be valid if 'numberPoints != 0'
+		 * @param numberPoints The number of given points, with range [0, infinity)
+		 * @return The indices of the points, sorted by their Morton codes within the bounding box of all points
+		 */
+		static Indices32 mortonOrder(const VectorT3<T>* points, const size_t numberPoints);
+
 	protected:
 
 		/**
@@ -243,8 +320,61 @@ class OctreeT
 		 * @param reusablePointIndicesOutput Memory block of indices with same size as 'reusableIndicesInput' which can be re-used internally, must be valid
 		 * @param numberPointIndices The number of given indices in 'reusablePointIndicesInput', with range [0, infinity)
 		 * @param boundingBox The bounding box of the new child node; will be ignored if `parameters.useTightBoundingBoxes_ == true`
+		 * @param deferredNodes Optional resulting nodes whose construction has been deferred, nullptr to construct all child nodes immediately
+		 * @param maximalDeferredPoints The maximal number of points a child node can have so that its construction is deferred, with range [0, infinity), ignored if `deferredNodes == nullptr`
+		 */
+		OctreeT(const Parameters& parameters, const VectorT3<T>* treePoints, Index32* reusablePointIndicesInput, Index32* reusablePointIndicesOutput, const size_t numberPointIndices, const BoundingBox& boundingBox, DeferredNodes* deferredNodes = nullptr, const size_t maximalDeferredPoints = 0);
+
+		/**
+		 * Creates a new child node, or defers the construction of the child node.
+		 * @param parameters The parameters to be used, must be valid
+		 * @param treePoints The points for which the tree will be created, must be valid
+		 * @param reusablePointIndicesInput The indices of the points for which the new node will be created, must be valid
+		 * @param reusablePointIndicesOutput Memory block of indices with same size as 'reusableIndicesInput' which can be re-used internally, must be valid
+		 * @param numberPointIndices The number of given indices in 'reusablePointIndicesInput', with range [0, infinity)
+		 * @param boundingBox The bounding box of the new child node; will be ignored if `parameters.useTightBoundingBoxes_ == true`
+		 * @param deferredNodes Optional resulting nodes whose construction has been deferred, nullptr to construct the child node immediately
+		 * @param maximalDeferredPoints The maximal number of points a child node can have so that its construction is deferred, with range [0, infinity), ignored if `deferredNodes == nullptr`
+		 * @return The new child node
+		 */
+		static OctreeT<T>* createChildNode(const Parameters& parameters, const VectorT3<T>* treePoints, Index32* reusablePointIndicesInput, Index32* reusablePointIndicesOutput, const size_t numberPointIndices, const BoundingBox& boundingBox, DeferredNodes* deferredNodes, const size_t maximalDeferredPoints);
+
+		/**
+		 * Constructs a subset of deferred nodes.
+		 * @param parameters The parameters to be used, must be valid
+		 * @param treePoints The points for which the tree will be created, must be valid
+		 * @param deferredNodes The deferred nodes to be constructed, must be valid
+		 * @param firstDeferredNode The first deferred node to be handled
+		 * @param numberDeferredNodes The number of deferred nodes to be handled
+		 */
+		static void constructDeferredNodesSubset(const Parameters* parameters, const VectorT3<T>* treePoints, const DeferredNode* deferredNodes, const unsigned int firstDeferredNode, const unsigned int numberDeferredNodes);
+
+		/**
+		 * Returns the closest tree points for a subset of several query points.
+		 * @param treePoints The tree points from which the closest points will be determined, must be valid
+		 * @param queryPoints The query points, must be valid
+		 * @param queryOrder The indices of the query points in Morton order, must be valid
+		 * @param maximalDistance The maximal distance between a query point and any potential tree point, with range [0, infinity)
+		 * @param pointIndicesGroups The resulting groups of indices of tree points, one group for each query point, must be valid
+		 * @param firstQuery The first query to be handled (in Morton order)
+		 * @param numberQueries The number of queries to be handled
+		 */
+		void closestPointsSubset(const VectorT3<T>* treePoints, const VectorT3<T>* queryPoints, const Index32* queryOrder, const T maximalDistance, Indices32* pointIndicesGroups, const unsigned int firstQuery, const unsigned int numberQueries) const;
+
+		/**
+		 * Returns whether two bounding boxes intersect each other.
+		 * @param boxA The first bounding box, must be valid
+		 * @param boxB The second bounding box, must be valid
+		 * @return True, if so
+		 */
+		static inline bool hasIntersection(const BoundingBox& boxA, const BoundingBox& boxB);
+
+		/**
+		 * Spreads the lower 21 bits of a value so that two zero bits are located between two successive bits.
+		 * @param value The value to spread, with range [0, 2^21)
+		 * @return The spread value
 		 */
-		OctreeT(const Parameters& parameters, const VectorT3<T>* treePoints, Index32* reusablePointIndicesInput, Index32* reusablePointIndicesOutput, const size_t numberPointIndices, const BoundingBox& boundingBox);
+		static inline uint64_t spreadBits(const uint64_t value);
 
 	protected:
 
@@ -272,6 +402,17 @@ inline bool OctreeT<T>::Parameters::isValid() const
 	return maximalPointsPerLeaf_ >= 1u;
 }
 
+template <typename T>
+inline OctreeT<T>::DeferredNode::DeferredNode(OctreeT<T>* node, Index32* reusablePointIndicesInput, Index32* reusablePointIndicesOutput, const size_t numberPointIndices, const BoundingBox& boundingBox) :
+	node_(node),
+	reusablePointIndicesInput_(reusablePointIndicesInput),
+	reusablePointIndicesOutput_(reusablePointIndicesOutput),
+	numberPointIndices_(numberPointIndices),
+	boundingBox_(boundingBox)
+{
+	ocean_assert(node_ != nullptr);
+}
+
 template <typename T>
 OctreeT<T>::OctreeT(OctreeT&& octree)
 {
@@ -279,7 +420,7 @@ OctreeT<T>::OctreeT(OctreeT&& octree)
 }
 
 template <typename T>
-OctreeT<T>::OctreeT(const VectorT3<T>* treePoints, const size_t numberTreePoints, const Parameters& parameters)
+OctreeT<T>::OctreeT(const VectorT3<T>* treePoints, const size_t numberTreePoints, const Parameters& parameters, Worker* worker)
 {
 	ocean_assert(parameters.isValid());
 
@@ -303,11 +444,28 @@ OctreeT<T>::OctreeT(const VectorT3<T>* treePoints, const size_t numberTreePoints
 		}
 	}
 
-	*this = Octree(parameters, treePoints, reusablePointIndicesInput.data(), reusablePointIndicesOutput.data(), numberTreePoints, boundingBox);
+	if (worker != nullptr && worker->threads() > 1u && numberTreePoints >= size_t(parameters.maximalPointsPerLeaf_) * 64)
+	{
+		// the upper levels of the tree are constructed with one thread, all sub-trees with a small number of points are constructed in parallel afterwards
+
+		const size_t maximalDeferredPoints = std::max(size_t(parameters.maximalPointsPerLeaf_), numberTreePoints / (size_t(worker->threads()) * 8));
+
+		DeferredNodes deferredNodes;
+		*this = OctreeT<T>(parameters, treePoints, reusablePointIndicesInput.data(), reusablePointIndicesOutput.data(), numberTreePoints, boundingBox, &deferredNodes, maximalDeferredPoints);
+
+		if (!deferredNodes.empty())
+		{
+			worker->executeFunction(Worker::Function::createStatic(&OctreeT<T>::constructDeferredNodesSubset, &parameters, treePoints, (const DeferredNode*)(deferredNodes.data()), 0u, 0u), 0u, (unsigned int)(deferredNodes.size()));
+		}
+	}
+	else
+	{
+		*this = OctreeT<T>(parameters, treePoints, reusablePointIndicesInput.data(), reusablePointIndicesOutput.data(), numberTreePoints, boundingBox);
+	}
 }
 
 template <typename T>
-OctreeT<T>::OctreeT(const Parameters& parameters, const VectorT3<T>* treePoints, Index32* reusablePointIndicesInput, Index32* reusablePointIndicesOutput, const size_t numberPointIndices, const BoundingBox& boundingBox)
+OctreeT<T>::OctreeT(const Parameters& parameters, const VectorT3<T>* treePoints, Index32* reusablePointIndicesInput, Index32* reusablePointIndicesOutput, const size_t numberPointIndices, const BoundingBox& boundingBox, DeferredNodes* deferredNodes, const size_t maximalDeferredPoints)
 {
 	ocean_assert(parameters.isValid());
 	ocean_assert(treePoints != nullptr);
@@ -325,7 +483,7 @@ OctreeT<T>::OctreeT(const Parameters& parameters, const VectorT3<T>* treePoints,
 	{
 		// let's ensure that not all points are identical, in this case we have a leaf node as well
 
-		const Vector3& firstPoint = treePoints[reusablePointIndicesInput[0]];
+		const VectorT3<T>& firstPoint = treePoints[reusablePointIndicesInput[0]];
 
 		bool allPointsIdentical = true;
 
@@ -558,15 +716,15 @@ OctreeT<T>::OctreeT(const Parameters& parameters, const VectorT3<T>* treePoints,
 
 	if (parameters.useTightBoundingBoxes_)
 	{
-		childNodes_[0] = new OctreeT<T>(parameters, treePoints, reusablePointIndicesOutput, reusablePointIndicesInput, lowLowLow, BoundingBox()); // with swapped reusableIndicesOutput and reusableIndicesInput
-		childNodes_[1] = new OctreeT<T>(parameters, treePoints, reusablePointIndicesOutput += lowLowLow, reusablePointIndicesInput += lowLowLow, lowLowHigh, BoundingBox());
-		childNodes_[2] = new OctreeT<T>(parameters, treePoints, reusablePointIndicesOutput += lowLowHigh, reusablePointIndicesInput += lowLowHigh, lowHighLow, BoundingBox());
-		childNodes_[3] = new OctreeT<T>(parameters, treePoints, reusablePointIndicesOutput += lowHighLow, reusablePointIndicesInput += lowHighLow, lowHighHigh, BoundingBox());
-
-		childNodes_[4] = new OctreeT<T>(parameters, treePoints, reusablePointIndicesOutput += lowHighHigh, reusablePointIndicesInput += lowHighHigh, highLowLow, BoundingBox());
-		childNodes_[5] = new OctreeT<T>(parameters, treePoints, reusablePointIndicesOutput += highLowLow, reusablePointIndicesInput += highLowLow, highLowHigh, BoundingBox());
-		childNodes_[6] = new OctreeT<T>(parameters, treePoints, reusablePointIndicesOutput += highLowHigh, reusablePointIndicesInput += highLowHigh, highHighLow, BoundingBox());
-		childNodes_[7] = new OctreeT<T>(parameters, treePoints, reusablePointIndicesOutput += highHighLow, reusablePointIndicesInput += highHighLow, highHighHigh, BoundingBox());
+		childNodes_[0] = createChildNode(parameters, treePoints, reusablePointIndicesOutput, reusablePointIndicesInput, lowLowLow, BoundingBox(), deferredNodes, maximalDeferredPoints); // with swapped reusableIndicesOutput and reusableIndicesInput
+		childNodes_[1] = createChildNode(parameters, treePoints, reusablePointIndicesOutput += lowLowLow, reusablePointIndicesInput += lowLowLow, lowLowHigh, BoundingBox(), deferredNodes, maximalDeferredPoints);
+		childNodes_[2] = createChildNode(parameters, treePoints, reusablePointIndicesOutput += lowLowHigh, reusablePointIndicesInput += lowLowHigh, lowHighLow, BoundingBox(), deferredNodes, maximalDeferredPoints);
+		childNodes_[3] = createChildNode(parameters, treePoints, reusablePointIndicesOutput += lowHighLow, reusablePointIndicesInput += lowHighLow, lowHighHigh, BoundingBox(), deferredNodes, maximalDeferredPoints);
+
+		childNodes_[4] = createChildNode(parameters, treePoints, reusablePointIndicesOutput += lowHighHigh, reusablePointIndicesInput += lowHighHigh, highLowLow, BoundingBox(), deferredNodes, maximalDeferredPoints);
+		childNodes_[5] = createChildNode(parameters, treePoints, reusablePointIndicesOutput += highLowLow, reusablePointIndicesInput += highLowLow, highLowHigh, BoundingBox(), deferredNodes, maximalDeferredPoints);
+		childNodes_[6] = createChildNode(parameters, treePoints, reusablePointIndicesOutput += highLowHigh, reusablePointIndicesInput += highLowHigh, highHighLow, BoundingBox(), deferredNodes, maximalDeferredPoints);
+		childNodes_[7] = createChildNode(parameters, treePoints, reusablePointIndicesOutput += highHighLow, reusablePointIndicesInput += highHighLow, highHighHigh, BoundingBox(), deferredNodes, maximalDeferredPoints);
 	}
 	else
 	{
@@ -580,15 +738,15 @@ OctreeT<T>::OctreeT(const Parameters& parameters, const VectorT3<T>* treePoints,
 		const BoundingBox boxHighHighLow(Vector3(center.x(), center.y(), boundingBox_.lower().z()), Vector3(boundingBox_.higher().x(), boundingBox_.higher().y(), center.z()));
 		const BoundingBox boxHighHighHigh(Vector3(center.x(), center.y(), center.z()), Vector3(boundingBox_.higher().x(), boundingBox_.higher().y(), boundingBox_.higher().z()));
 
-		childNodes_[0] = new OctreeT<T>(parameters, treePoints, reusablePointIndicesOutput, reusablePointIndicesInput, lowLowLow, boxLowLowLow); // with swapped reusableIndicesOutput and reusableIndicesInput
-		childNodes_[1] = new OctreeT<T>(parameters, treePoints, reusablePointIndicesOutput += lowLowLow, reusablePointIndicesInput += lowLowLow, lowLowHigh, boxLowLowHigh);
-		childNodes_[2] = new OctreeT<T>(parameters, treePoints, reusablePointIndicesOutput += lowLowHigh, reusablePointIndicesInput += lowLowHigh, lowHighLow, boxLowHighLow);
-		childNodes_[3] = new OctreeT<T>(parameters, treePoints, reusablePointIndicesOutput += lowHighLow, reusablePointIndicesInput += lowHighLow, lowHighHigh, boxLowHighHigh);
+		childNodes_[0] = createChildNode(parameters, treePoints, reusablePointIndicesOutput, reusablePointIndicesInput, lowLowLow, boxLowLowLow, deferredNodes, maximalDeferredPoints); // with swapped reusableIndicesOutput and reusableIndicesInput
+		childNodes_[1] = createChildNode(parameters, treePoints, reusablePointIndicesOutput += lowLowLow, reusablePointIndicesInput += lowLowLow, lowLowHigh, boxLowLowHigh, deferredNodes, maximalDeferredPoints);
+		childNodes_[2] = createChildNode(parameters, treePoints, reusablePointIndicesOutput += lowLowHigh, reusablePointIndicesInput += lowLowHigh, lowHighLow, boxLowHighLow, deferredNodes, maximalDeferredPoints);
+		childNodes_[3] = createChildNode(parameters, treePoints, reusablePointIndicesOutput += lowHighLow, reusablePointIndicesInput += lowHighLow, lowHighHigh, boxLowHighHigh, deferredNodes, maximalDeferredPoints);
 
-		childNodes_[4] = new OctreeT<T>(parameters, treePoints, reusablePointIndicesOutput += lowHighHigh, reusablePointIndicesInput += lowHighHigh, highLowLow, boxHighLowLow);
-		childNodes_[5] = new OctreeT<T>(parameters, treePoints, reusablePointIndicesOutput += highLowLow, reusablePointIndicesInput += highLowLow, highLowHigh, boxHighLowHigh);
-		childNodes_[6] = new OctreeT<T>(parameters, treePoints, reusablePointIndicesOutput += highLowHigh, reusablePointIndicesInput += highLowHigh, highHighLow, boxHighHighLow);
-		childNodes_[7] = new OctreeT<T>(parameters, treePoints, reusablePointIndicesOutput += highHighLow, reusablePointIndicesInput += highHighLow, highHighHigh, boxHighHighHigh);
+		childNodes_[4] = createChildNode(parameters, treePoints, reusablePointIndicesOutput += lowHighHigh, reusablePointIndicesInput += lowHighHigh, highLowLow, boxHighLowLow, deferredNodes, maximalDeferredPoints);
+		childNodes_[5] = createChildNode(parameters, treePoints, reusablePointIndicesOutput += highLowLow, reusablePointIndicesInput += highLowLow, highLowHigh, boxHighLowHigh, deferredNodes, maximalDeferredPoints);
+		childNodes_[6] = createChildNode(parameters, treePoints, reusablePointIndicesOutput += highLowHigh, reusablePointIndicesInput += highLowHigh, highHighLow, boxHighHighLow, deferredNodes, maximalDeferredPoints);
+		childNodes_[7] = createChildNode(parameters, treePoints, reusablePointIndicesOutput += highHighLow, reusablePointIndicesInput += highHighLow, highHighHigh, boxHighHighHigh, deferredNodes, maximalDeferredPoints);
 	}
 }
 
@@ -844,12 +1002,287 @@ void OctreeT<T>::closestPoints(const VectorT3<T>* treePoints, const VectorT3<T>&
 	}
 }
 
+template <typename T>
+void OctreeT<T>::closestPoints(const VectorT3<T>* treePoints, const VectorT3<T>* queryPoints, const size_t numberQueryPoints, const T maximalDistance, std::vector<Indices32>& pointIndicesGroups, Worker* worker) const
+{
+	ocean_assert(treePoints != nullptr && queryPoints != nullptr);
+	ocean_assert(numberQueryPoints >= 1);
+	ocean_assert(maximalDistance >= T(0));
+
+	pointIndicesGroups.resize(numberQueryPoints);
+
+	for (Indices32& pointIndices : pointIndicesGroups)
+	{
+		pointIndices.clear();
+	}
+
+	if (!isValid())
+	{
+		return;
+	}
+
+	const Indices32 queryOrder = mortonOrder(queryPoints, numberQueryPoints);
+
+	if (worker != nullptr && numberQueryPoints >= 256)
+	{
+		worker->executeFunction(Worker::Function::create(*this, &OctreeT<T>::closestPointsSubset, treePoints, queryPoints, queryOrder.data(), maximalDistance, pointIndicesGroups.data(), 0u, 0u), 0u, (unsigned int)(numberQueryPoints), 5u, 6u, 64u);
+	}
+	else
+	{
+		closestPointsSubset(treePoints, queryPoints, queryOrder.data(), maximalDistance, pointIndicesGroups.data(), 0u, (unsigned int)(numberQueryPoints));
+	}
+}
+
 template <typename T>
 inline bool OctreeT<T>::isValid() const
 {
 	return boundingBox_.isValid();
 }
 
+template <typename T>
+inline uint64_t OctreeT<T>::mortonCode(const VectorT3<T>& point, const BoundingBox& boundingBox)
+{
+	ocean_assert(boundingBox.isValid());
+
+	constexpr Scalar maximalBin = Scalar((1u << 21u) - 1u);
+
+	uint64_t code = 0ull;
+
+	for (unsigned int n = 0u; n < 3u; ++n)
+	{
+		const Scalar extent = boundingBox.higher()[n] - boundingBox.lower()[n];
+
+		Scalar bin = 0;
+
+		if (extent > Numeric::eps())
+		{
+			bin = minmax(Scalar(0), (Scalar(point[n]) - boundingBox.lower()[n]) * maximalBin / extent, maximalBin);
+		}
+
+		code = (code << 1u) | spreadBits(uint64_t(bin));
+	}
+
+	return code;
+}
+
+template <typename T>
+Indices32 OctreeT<T>::mortonOrder(const VectorT3<T>* points, const size_t numberPoints)
+{
+	ocean_assert(points != nullptr || numberPoints == 0);
+
+	if (numberPoints == 0)
+	{
+		return Indices32();
+	}
+
+	BoundingBox boundingBox;
+
+	for (size_t n = 0; n < numberPoints; ++n)
+	{
+		boundingBox += Vector3(points[n]);
+	}
+
+	std::vector<std::pair<uint64_t, Index32>> codes;
+	codes.reserve(numberPoints);
+
+	for (size_t n = 0; n < numberPoints; ++n)
+	{
+		codes.emplace_back(mortonCode(points[n], boundingBox), Index32(n));
+	}
+
+	std::sort(codes.begin(), codes.end());
+
+	Indices32 order;
+	order.reserve(numberPoints);
+
+	for (const std::pair<uint64_t, Index32>& code : codes)
+	{
+		order.emplace_back(code.second);
+	}
+
+	return order;
+}
+
+template <typename T>
+OctreeT<T>* OctreeT<T>::createChildNode(const Parameters& parameters, const VectorT3<T>* treePoints, Index32* reusablePointIndicesInput, Index32* reusablePointIndicesOutput, const size_t numberPointIndices, const BoundingBox& boundingBox, DeferredNodes* deferredNodes, const size_t maximalDeferredPoints)
+{
+	if (deferredNodes != nullptr && numberPointIndices <= maximalDeferredPoints)
+	{
+		// the child node covers a disjoint subset of the indices, so that it can be constructed independently of all other nodes
+
+		OctreeT<T>* childNode = new OctreeT<T>();
+
+		if (numberPointIndices != 0)
+		{
+			deferredNodes->emplace_back(childNode, reusablePointIndicesInput, reusablePointIndicesOutput, numberPointIndices, boundingBox);
+		}
+
+		return childNode;
+	}
+
+	return new OctreeT<T>(parameters, treePoints, reusablePointIndicesInput, reusablePointIndicesOutput, numberPointIndices, boundingBox, deferredNodes, maximalDeferredPoints);
+}
+
+template <typename T>
+void OctreeT<T>::constructDeferredNodesSubset(const Parameters* parameters, const VectorT3<T>* treePoints, const DeferredNode* deferredNodes, const unsigned int firstDeferredNode, const unsigned int numberDeferredNodes)
+{
+	ocean_assert(parameters != nullptr && treePoints != nullptr && deferredNodes != nullptr);
+
+	for (unsigned int n = firstDeferredNode; n < firstDeferredNode + numberDeferredNodes; ++n)
+	{
+		const DeferredNode& deferredNode = deferredNodes[n];
+
+		*deferredNode.node_ = OctreeT<T>(*parameters, treePoints, deferredNode.reusablePointIndicesInput_, deferredNode.reusablePointIndicesOutput_, deferredNode.numberPointIndices_, deferredNode.boundingBox_);
+	}
+}
+
+template <typename T>
+void OctreeT<T>::closestPointsSubset(const VectorT3<T>* treePoints, const VectorT3<T>* queryPoints, const Index32* queryOrder, const T maximalDistance, Indices32* pointIndicesGroups, const unsigned int firstQuery, const unsigned int numberQueries) const
+{
+	ocean_assert(treePoints != nullptr && queryPoints != nullptr && queryOrder != nullptr && pointIndicesGroups != nullptr);
+
+	constexpr unsigned int maximalGroupSize = 32u;
+
+	const Scalar scalarMaximalDistance = Scalar(maximalDistance);
+	const T maximalSqrDistance = maximalDistance * maximalDistance;
+
+	const ReusableData reusableData;
+
+	std::vector<const OctreeT<T>*>& nodes = reusableData.internalData_;
+	std::vector<const OctreeT<T>*> leafNodes;
+
+	unsigned int groupBegin = firstQuery;
+
+	while (groupBegin < firstQuery + numberQueries)
+	{
+		// consecutive query points (in Morton order) are combined to one group as long as the group stays compact
+
+		BoundingBox groupBoundingBox(Vector3(queryPoints[queryOrder[groupBegin]]), Vector3(queryPoints[queryOrder[groupBegin]]));
+
+		unsigned int groupEnd = groupBegin + 1u;
+
+		while (groupEnd < firstQuery + numberQueries && groupEnd - groupBegin < maximalGroupSize)
+		{
+			BoundingBox extendedBoundingBox(groupBoundingBox);
+			extendedBoundingBox += Vector3(queryPoints[queryOrder[groupEnd]]);
+
+			if (extendedBoundingBox.diagonal() > scalarMaximalDistance * Scalar(2))
+			{
+				break;
+			}
+
+			groupBoundingBox = extendedBoundingBox;
+			++groupEnd;
+		}
+
+		if (groupEnd == groupBegin + 1u)
+		{
+			const Index32 queryIndex = queryOrder[groupBegin];
+
+			closestPoints(treePoints, queryPoints[queryIndex], maximalDistance, pointIndicesGroups[queryIndex], nullptr, reusableData);
+
+			groupBegin = groupEnd;
+			continue;
+		}
+
+		// all leaf nodes which may contain points close to any query point of the group are determined with one traversal
+
+		const Vector3 offset(scalarMaximalDistance, scalarMaximalDistance, scalarMaximalDistance);
+		const BoundingBox searchBoundingBox(groupBoundingBox.lower() - offset, groupBoundingBox.higher() + offset);
+
+		leafNodes.clear();
+
+		if (hasIntersection(boundingBox_, searchBoundingBox))
+		{
+			nodes.emplace_back(this);
+
+			while (!nodes.empty())
+			{
+				const OctreeT<T>* node = nodes.back();
+				nodes.pop_back();
+
+				ocean_assert(node != nullptr);
+
+				if (node->childNodes_[0] != nullptr)
+				{
+					for (unsigned int n = 0u; n < 8u; ++n)
+					{
+						const OctreeT<T>& childNode = *node->childNodes_[n];
+
+						if (childNode.isValid() && hasIntersection(childNode.boundingBox_, searchBoundingBox))
+						{
+							nodes.emplace_back(&childNode);
+						}
+					}
+				}
+				else if (!node->pointIndices_.empty())
+				{
+					leafNodes.emplace_back(node);
+				}
+			}
+		}
+
+		for (unsigned int nQuery = groupBegin; nQuery < groupEnd; ++nQuery)
+		{
+			const Index32 queryIndex = queryOrder[nQuery];
+			const VectorT3<T>& queryPoint = queryPoints[queryIndex];
+			const Vector3 scalarQueryPoint(queryPoint);
+
+			Indices32& pointIndices = pointIndicesGroups[queryIndex];
+
+			for (const OctreeT<T>* leafNode : leafNodes)
+			{
+				if (!leafNode->boundingBox_.isInside(scalarQueryPoint, scalarMaximalDistance))
+				{
+					continue;
+				}
+
+				for (const Index32& pointIndex : leafNode->pointIndices_)
+				{
+					if (treePoints[pointIndex].sqrDistance(queryPoint) <= maximalSqrDistance)
+					{
+						pointIndices.emplace_back(pointIndex);
+					}
+				}
+			}
+		}
+
+		groupBegin = groupEnd;
+	}
+}
+
+template <typename T>
+inline bool OctreeT<T>::hasIntersection(const BoundingBox& boxA, const BoundingBox& boxB)
+{
+	ocean_assert(boxA.isValid() && boxB.isValid());
+
+	for (unsigned int n = 0u; n < 3u; ++n)
+	{
+		if (boxA.higher()[n] < boxB.lower()[n] || boxB.higher()[n] < boxA.lower()[n])
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+template <typename T>
+inline uint64_t OctreeT<T>::spreadBits(const uint64_t value)
+{
+	ocean_assert(value < (1ull << 21ull));
+
+	uint64_t result = value & 0x1FFFFFull;
+
+	result = (result | (result << 32ull)) & 0x1F00000000FFFFull;
+	result = (result | (result << 16ull)) & 0x1F0000FF0000FFull;
+	result = (result | (result << 8ull)) & 0x100F00F00F00F00Full;
+	result = (result | (result << 4ull)) & 0x10C30C30C30C30C3ull;
+	result = (result | (result << 2ull)) & 0x1249249249249249ull;
+
+	return result;
+}
+
 template <typename T>
 OctreeT<T>& OctreeT<T>::operator=(OctreeT<T>&& octree)
 {
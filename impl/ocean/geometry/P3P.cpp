@@ -409,6 +409,348 @@ unsigned int P3P::poses(const VectorT3<T>* objectPoints, const VectorT3<T>* imag
 template unsigned int OCEAN_GEOMETRY_EXPORT P3P::poses<float>(const VectorT3<float>*, const VectorT3<float>*, HomogenousMatrixT4<float>*);
 template unsigned int OCEAN_GEOMETRY_EXPORT P3P::poses<double>(const VectorT3<double>*, const VectorT3<double>*, HomogenousMatrixT4<double>*);
 
+
+template <typename T, size_t tBatchSize>
+unsigned int P3P::posesBatch(const VectorT3<T>* objectPoints, const VectorT3<T>* imageRays, HomogenousMatrixT4<T>* world_T_cameras, unsigned int* numberPoses)
+{
+	static_assert(tBatchSize >= 1, "Invalid batch size!");
+
+	ocean_assert(objectPoints != nullptr && imageRays != nullptr && world_T_cameras != nullptr && numberPoses != nullptr);
+
+	// all lane-wise loops below are free of branches, invalid lanes are processed with placeholder values and are masked out at the end
+
+	T ab[tBatchSize];
+	T ac[tBatchSize];
+	T bc[tBatchSize];
+
+	T cos_ab[tBatchSize];
+	T cos_ac[tBatchSize];
+	T cos_bc[tBatchSize];
+
+	bool validLanes[tBatchSize];
+
+	for (size_t lane = 0; lane < tBatchSize; ++lane)
+	{
+		const VectorT3<T>* laneObjectPoints = objectPoints + lane * 3;
+		const VectorT3<T>* laneImageRays = imageRays + lane * 3;
+
+		ocean_assert(laneImageRays[0].isUnit() && laneImageRays[1].isUnit() && laneImageRays[2].isUnit());
+
+		ab[lane] = (laneObjectPoints[0] - laneObjectPoints[1]).length();
+		ac[lane] = (laneObjectPoints[0] - laneObjectPoints[2]).length();
+		bc[lane] = (laneObjectPoints[1] - laneObjectPoints[2]).length();
+
+		cos_ab[lane] = laneImageRays[0] * laneImageRays[1];
+		cos_ac[lane] = laneImageRays[0] * laneImageRays[2];
+		cos_bc[lane] = laneImageRays[1] * laneImageRays[2];
+
+		validLanes[lane] = ab[lane] > NumericT<T>::eps() && ac[lane] > NumericT<T>::eps() && bc[lane] > NumericT<T>::eps()
+							&& laneImageRays[0] != laneImageRays[1] && laneImageRays[0] != laneImageRays[2] && laneImageRays[1] != laneImageRays[2];
+	}
+
+	// the coefficients of the quartic polynomial, see poses() for details
+
+	T g0[tBatchSize];
+	T g1[tBatchSize];
+	T g2[tBatchSize];
+	T g3[tBatchSize];
+	T g4[tBatchSize];
+
+	for (size_t lane = 0; lane < tBatchSize; ++lane)
+	{
+		const T safeAB = validLanes[lane] ? ab[lane] : T(1);
+		const T safeAC = validLanes[lane] ? ac[lane] : T(1);
+
+		const T k1 = sqr(bc[lane] / safeAC);
+		const T k2 = sqr(bc[lane] / safeAB);
+
+		g0[lane] = sqr(k1 * k2 + k1 - k2) - 4 * sqr(k1) * k2 * sqr(cos_ac[lane]);
+		g1[lane] = 4 * (k1 * k2 + k1 - k2) * k2 * (1 - k1) * cos_ab[lane] + 4 * k1 * ((k1 * k2 - k1 + k2) * cos_ac[lane] * cos_bc[lane] + 2 * k1 * k2 * cos_ab[lane] * sqr(cos_ac[lane]));
+		g2[lane] = sqr(2 * k2 * (1 - k1) * cos_ab[lane]) + 2 * (k1 * k2 + k1 - k2) * (k1 * k2 - k1 - k2) + 4 * k1 * ((k1 - k2) * sqr(cos_bc[lane]) + (1 - k2) * k1 * sqr(cos_ac[lane]) - 2 * k2 * (1 + k1) * cos_ab[lane] * cos_ac[lane] * cos_bc[lane]);
+		g3[lane] = 4 * (k1 * k2 - k1 - k2) * k2 * (1 - k1) * cos_ab[lane] + 4 * k1 * cos_bc[lane] * ((k1 * k2 + k2 - k1) * cos_ac[lane] + 2 * k2 * cos_ab[lane] * cos_bc[lane]);
+		g4[lane] = sqr(k1 * k2 - k1 - k2) - 4 * k1 * k2 * sqr(cos_bc[lane]);
+
+		validLanes[lane] = validLanes[lane] && NumericT<T>::isNotEqualEps(g4[lane]);
+
+		g4[lane] = validLanes[lane] ? g4[lane] : T(1);
+	}
+
+	T xSolutions[4][tBatchSize];
+	bool validSolutions[4][tBatchSize];
+
+	solveQuarticsBatch<T, tBatchSize>(g4, g3, g2, g1, g0, xSolutions, validSolutions);
+
+	// the local coordinate system of each object triangle, with origin in the first object point, x-axis towards the second object point, and z-axis pointing towards the center of projection
+
+	VectorT3<T> xAxes[tBatchSize];
+	VectorT3<T> yAxes[tBatchSize];
+	VectorT3<T> zAxes[tBatchSize];
+
+	T thirdPointX[tBatchSize];
+	T thirdPointY[tBatchSize];
+
+	for (size_t lane = 0; lane < tBatchSize; ++lane)
+	{
+		const VectorT3<T>* laneObjectPoints = objectPoints + lane * 3;
+		const VectorT3<T>* laneImageRays = imageRays + lane * 3;
+
+		const T safeAB = validLanes[lane] ? ab[lane] : T(1);
+
+		xAxes[lane] = (laneObjectPoints[1] - laneObjectPoints[0]) / safeAB;
+
+		const VectorT3<T> direction02 = laneObjectPoints[2] - laneObjectPoints[0];
+
+		thirdPointX[lane] = xAxes[lane] * direction02;
+
+		const VectorT3<T> yDirection = direction02 - xAxes[lane] * thirdPointX[lane];
+
+		thirdPointY[lane] = yDirection.length();
+
+		validLanes[lane] = validLanes[lane] && thirdPointY[lane] > NumericT<T>::eps();
+
+		yAxes[lane] = yDirection / (validLanes[lane] ? thirdPointY[lane] : T(1));
+
+		// we identify the direction of the plane's normal by checking whether the (normalized) image points are ccw or cw
+
+		const T safeZ0 = laneImageRays[0].z() < -NumericT<T>::eps() ? laneImageRays[0].z() : T(-1);
+		const T safeZ1 = laneImageRays[1].z() < -NumericT<T>::eps() ? laneImageRays[1].z() : T(-1);
+		const T safeZ2 = laneImageRays[2].z() < -NumericT<T>::eps() ? laneImageRays[2].z() : T(-1);
+
+		const VectorT2<T> normalizedImagePoint0 = laneImageRays[0].xy() / safeZ0;
+		const VectorT2<T> normalizedImagePoint1 = laneImageRays[1].xy() / safeZ1;
+		const VectorT2<T> normalizedImagePoint2 = laneImageRays[2].xy() / safeZ2;
+		const T normalSign = NumericT<T>::copySign(T(1), (normalizedImagePoint1 - normalizedImagePoint0).cross(normalizedImagePoint2 - normalizedImagePoint0));
+
+		zAxes[lane] = xAxes[lane].cross(yAxes[lane]) * normalSign;
+	}
+
+	// the back-substitution for all four roots of all lanes, determining the center of projection and the three distances
+
+	VectorT3<T> centers[4][tBatchSize];
+	T distances[4][3][tBatchSize];
+	bool validCandidates[4][tBatchSize];
+
+	for (size_t r = 0; r < 4; ++r)
+	{
+		for (size_t lane = 0; lane < tBatchSize; ++lane)
+		{
+			const T x = xSolutions[r][lane];
+
+			bool valid = validLanes[lane] && validSolutions[r][lane] && x >= T(0);
+
+			// b = x * a, and ab^2 = a^2 + b^2 - 2 a b cos_ab
+
+			const T denominator = NumericT<T>::sqrt(std::max(T(0), x * x - 2 * x * cos_ab[lane] + 1));
+			valid = valid && denominator > NumericT<T>::eps();
+
+			const T a = ab[lane] / (valid ? denominator : T(1));
+			const T b = a * x;
+			valid = valid && a > NumericT<T>::eps() && b > NumericT<T>::eps();
+
+			const T safeA = valid ? a : T(1);
+
+			const T sqrValue = sqr(cos_ac[lane]) + sqr(ac[lane] / safeA) - 1;
+			valid = valid && sqrValue >= T(0);
+
+			const T sqrtValue = NumericT<T>::sqrt(std::max(T(0), sqrValue));
+
+			const T y1 = cos_ac[lane] + sqrtValue;
+			const T y2 = cos_ac[lane] - sqrtValue;
+
+			const T bc2_1 = sqr(b) + sqr(y1 * a) - 2 * b * y1 * a * cos_bc[lane];
+			const T bc2_2 = sqr(b) + sqr(y2 * a) - 2 * b * y2 * a * cos_bc[lane];
+
+			const T c = NumericT<T>::abs(bc[lane] * bc[lane] - bc2_1) < NumericT<T>::abs(bc[lane] * bc[lane] - bc2_2) ? y1 * a : y2 * a;
+			valid = valid && c > NumericT<T>::eps();
+
+			// trilateration of the center of projection in the local coordinate system of the object triangle
+
+			const T localX = (sqr(a) - sqr(b) + sqr(ab[lane])) / (2 * ab[lane]);
+			const T localY = (sqr(a) - sqr(c) + sqr(thirdPointX[lane]) + sqr(thirdPointY[lane])) / (2 * (validLanes[lane] ? thirdPointY[lane] : T(1))) - thirdPointX[lane] / (validLanes[lane] ? thirdPointY[lane] : T(1)) * localX;
+			const T sqrLocalZ = sqr(a) - sqr(localX) - sqr(localY);
+			valid = valid && sqrLocalZ >= NumericT<T>::eps();
+
+			const T localZ = NumericT<T>::sqrt(std::max(T(0), sqrLocalZ));
+
+			centers[r][lane] = objectPoints[lane * 3] + xAxes[lane] * localX + yAxes[lane] * localY + zAxes[lane] * localZ;
+
+			distances[r][0][lane] = a;
+			distances[r][1][lane] = b;
+			distances[r][2][lane] = c;
+
+			validCandidates[r][lane] = valid;
+		}
+	}
+
+	// finally, we determine the orientations for all valid candidates, [foot0 | foot1 | foot2] = R * [imageRay0 | imageRay1 | imageRay2]
+
+	unsigned int overallPoses = 0u;
+
+	for (size_t lane = 0; lane < tBatchSize; ++lane)
+	{
+		numberPoses[lane] = 0u;
+
+		const VectorT3<T>* laneObjectPoints = objectPoints + lane * 3;
+		const VectorT3<T>* laneImageRays = imageRays + lane * 3;
+
+		SquareMatrixT3<T> invImageRayMatrix;
+		if (!validLanes[lane] || !SquareMatrixT3<T>(laneImageRays[0], laneImageRays[1], laneImageRays[2]).invert(invImageRayMatrix))
+		{
+			continue;
+		}
+
+		HomogenousMatrixT4<T>* laneWorld_T_cameras = world_T_cameras + lane * 4;
+
+		for (size_t r = 0; r < 4; ++r)
+		{
+			if (validCandidates[r][lane])
+			{
+				const VectorT3<T>& CP = centers[r][lane];
+
+				const VectorT3<T> foot0 = (laneObjectPoints[0] - CP) / distances[r][0][lane];
+				const VectorT3<T> foot1 = (laneObjectPoints[1] - CP) / distances[r][1][lane];
+				const VectorT3<T> foot2 = (laneObjectPoints[2] - CP) / distances[r][2][lane];
+
+				const SquareMatrixT3<T> overallRotation((SquareMatrixT3<T>(foot0, foot1, foot2) * invImageRayMatrix).orthonormalMatrix());
+
+				laneWorld_T_cameras[numberPoses[lane]++] = HomogenousMatrixT4<T>(CP, overallRotation);
+			}
+		}
+
+		overallPoses += numberPoses[lane];
+	}
+
+	return overallPoses;
+}
+
+template unsigned int OCEAN_GEOMETRY_EXPORT P3P::posesBatch<float, 4>(const VectorT3<float>*, const VectorT3<float>*, HomogenousMatrixT4<float>*, unsigned int*);
+template unsigned int OCEAN_GEOMETRY_EXPORT P3P::posesBatch<float, 8>(const VectorT3<float>*, const VectorT3<float>*, HomogenousMatrixT4<float>*, unsigned int*);
+template unsigned int OCEAN_GEOMETRY_EXPORT P3P::posesBatch<double, 4>(const VectorT3<double>*, const VectorT3<double>*, HomogenousMatrixT4<double>*, unsigned int*);
+template unsigned int OCEAN_GEOMETRY_EXPORT P3P::posesBatch<double, 8>(const VectorT3<double>*, const VectorT3<double>*, HomogenousMatrixT4<double>*, unsigned int*);
+
+template <typename T, size_t tBatchSize>
+void P3P::solveQuarticsBatch(const T* a, const T* b, const T* c, const T* d, const T* e, T roots[4][tBatchSize], bool validRoots[4][tBatchSize])
+{
+	ocean_assert(a != nullptr && b != nullptr && c != nullptr && d != nullptr && e != nullptr);
+
+	for (size_t lane = 0; lane < tBatchSize; ++lane)
+	{
+		ocean_assert(NumericT<T>::isNotEqualEps(a[lane]));
+
+		const T invA = T(1) / a[lane];
+
+		const T B = b[lane] * invA;
+		const T C = c[lane] * invA;
+		const T D = d[lane] * invA;
+		const T E = e[lane] * invA;
+
+		// depressed quartic with x = y - B / 4:
+		// y^4 + p y^2 + q y + r = 0
+
+		const T B2 = B * B;
+
+		const T p = C - T(0.375) * B2;
+		const T q = D - T(0.5) * B * C + T(0.125) * B2 * B;
+		const T r = E - T(0.25) * B * D + T(0.0625) * B2 * C - T(0.01171875) * B2 * B2;
+
+		// resolvent cubic m^3 + p m^2 + (p^2 / 4 - r) m - q^2 / 8 = 0, we need the largest real root which is positive for q != 0
+
+		const T cubicA = p;
+		const T cubicB = T(0.25) * p * p - r;
+		const T cubicC = T(-0.125) * q * q;
+
+		// depressed cubic with m = t - cubicA / 3:
+		// t^3 + P t + Q = 0
+
+		const T P = cubicB - cubicA * cubicA / T(3);
+		const T Q = T(2) * cubicA * cubicA * cubicA / T(27) - cubicA * cubicB / T(3) + cubicC;
+
+		const T discriminant = T(0.25) * Q * Q + P * P * P / T(27);
+
+		// one real root (Cardano)
+
+		const T sqrtDiscriminant = NumericT<T>::sqrt(std::max(T(0), discriminant));
+		const T tCardano = std::cbrt(T(-0.5) * Q + sqrtDiscriminant) + std::cbrt(T(-0.5) * Q - sqrtDiscriminant);
+
+		// three real roots (trigonometric solution), the largest root
+
+		const T safeP = std::min(P, -NumericT<T>::eps());
+		const T cosArgument = minmax(T(-1), T(1.5) * Q / safeP * NumericT<T>::sqrt(T(-3) / safeP), T(1));
+		const T tTrigonometric = T(2) * NumericT<T>::sqrt(-safeP / T(3)) * NumericT<T>::cos(NumericT<T>::acos(cosArgument) / T(3));
+
+		T m = (discriminant > T(0) || P >= -NumericT<T>::eps()) ? tCardano : tTrigonometric;
+		m -= cubicA / T(3);
+
+		// we polish the root of the resolvent cubic with two Newton iterations
+
+		for (unsigned int iteration = 0u; iteration < 2u; ++iteration)
+		{
+			const T value = ((m + cubicA) * m + cubicB) * m + cubicC;
+			const T derivative = (T(3) * m + T(2) * cubicA) * m + cubicB;
+
+			m -= NumericT<T>::isNotEqualEps(derivative) ? value / derivative : T(0);
+		}
+
+		// biquadratic case for q == 0: y^2 = (-p +/- sqrt(p^2 - 4 r)) / 2
+
+		const bool biquadratic = NumericT<T>::isEqualEps(q) || m <= NumericT<T>::eps();
+
+		T ys[4];
+		bool validYs[4];
+
+		// both cases are determined for all lanes, the results are selected afterwards
+
+		const T biDiscriminant = p * p - T(4) * r;
+		const T sqrtBiDiscriminant = NumericT<T>::sqrt(std::max(T(0), biDiscriminant));
+
+		const T ySqr0 = T(0.5) * (-p + sqrtBiDiscriminant);
+		const T ySqr1 = T(0.5) * (-p - sqrtBiDiscriminant);
+
+		// (y^2 + p / 2 + m)^2 = 2m (y - q / (4m))^2, resulting in two quadratic equations:
+		// y^2 - s y + (p / 2 + m + q / (2s)) = 0
+		// y^2 + s y + (p / 2 + m - q / (2s)) = 0, with s = sqrt(2m)
+
+		const T s = NumericT<T>::sqrt(std::max(T(2) * m, NumericT<T>::eps()));
+		const T q_2s = q / (T(2) * s);
+
+		const T discriminant0 = s * s - T(4) * (T(0.5) * p + m + q_2s);
+		const T discriminant1 = s * s - T(4) * (T(0.5) * p + m - q_2s);
+
+		const T sqrtDiscriminant0 = NumericT<T>::sqrt(std::max(T(0), discriminant0));
+		const T sqrtDiscriminant1 = NumericT<T>::sqrt(std::max(T(0), discriminant1));
+
+		ys[0] = biquadratic ? NumericT<T>::sqrt(std::max(T(0), ySqr0)) : T(0.5) * (s + sqrtDiscriminant0);
+		ys[1] = biquadratic ? -NumericT<T>::sqrt(std::max(T(0), ySqr0)) : T(0.5) * (s - sqrtDiscriminant0);
+		ys[2] = biquadratic ? NumericT<T>::sqrt(std::max(T(0), ySqr1)) : T(0.5) * (-s + sqrtDiscriminant1);
+		ys[3] = biquadratic ? -NumericT<T>::sqrt(std::max(T(0), ySqr1)) : T(0.5) * (-s - sqrtDiscriminant1);
+
+		const T tolerance = NumericT<T>::weakEps();
+
+		validYs[0] = biquadratic ? (biDiscriminant >= -tolerance && ySqr0 >= -tolerance) : discriminant0 >= -tolerance;
+		validYs[1] = validYs[0];
+		validYs[2] = biquadratic ? (biDiscriminant >= -tolerance && ySqr1 >= -tolerance) : discriminant1 >= -tolerance;
+		validYs[3] = validYs[2];
+
+		for (size_t n = 0; n < 4; ++n)
+		{
+			T x = ys[n] - T(0.25) * B;
+
+			// we polish each root with two Newton iterations on the original polynomial
+
+			for (unsigned int iteration = 0u; iteration < 2u; ++iteration)
+			{
+				const T value = (((x + B) * x + C) * x + D) * x + E;
+				const T derivative = ((T(4) * x + T(3) * B) * x + T(2) * C) * x + D;
+
+				x -= NumericT<T>::isNotEqualEps(derivative) ? value / derivative : T(0);
+			}
+
+			roots[n][lane] = x;
+			validRoots[n][lane] = validYs[n] && !NumericT<T>::isNan(x) && !NumericT<T>::isInf(x);
+		}
+	}
+}
+
 }
 
 }
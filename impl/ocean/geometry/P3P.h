@@ -64,8 +64,41 @@ class OCEAN_GEOMETRY_EXPORT P3P : public PerspectivePose
 		template <typename T>
 		static unsigned int poses(const VectorT3<T>* objectPoints, const VectorT3<T>* imageRays, HomogenousMatrixT4<T>* cameraPoses);
 
+		/**
+		 * Calculates the possible camera poses for several independent minimal samples at once, each sample with three correspondences between 3D object points and 3D rays.
+		 * This function provides the same results as poses() for each individual sample, however all samples are processed in lanes (a structure-of-arrays layout without branches within the lanes) so that the compiler can map the lanes to SIMD registers.<br>
+		 * The quartic polynomials of all samples are solved in parallel with a real-valued Ferrari approach, the back-substitution is realized by a trilateration of the center of projection.<br>
+		 * A batch size of 4 or 8 matches the SIMD register width for 'float' and 'double' on most platforms.
+		 * @param objectPoints The 3D object points of all samples, three consecutive points for each sample, tBatchSize * 3 points, the points of each sample must not be collinear
+		 * @param imageRays The 3D rays with unit length of all samples, three consecutive rays for each sample, tBatchSize * 3 rays, defined in the coordinate system of the camera, with negative z-component
+		 * @param world_T_cameras The resulting transformation matrices receiving the poses, four consecutive matrices for each sample, the valid poses of each sample are stored first, tBatchSize * 4 matrices
+		 * @param numberPoses The resulting number of poses for each sample, tBatchSize values each with range [0, 4]
+		 * @return The overall number of poses of all samples, with range [0, tBatchSize * 4]
+		 * @tparam T Data type of e.g., the vector elements to be used, either 'float' or 'double'
+		 * @tparam tBatchSize The number of samples to be processed at once, with range [1, infinity)
+		 * @see poses().
+		 */
+		template <typename T, size_t tBatchSize>
+		static unsigned int posesBatch(const VectorT3<T>* objectPoints, const VectorT3<T>* imageRays, HomogenousMatrixT4<T>* world_T_cameras, unsigned int* numberPoses);
+
 	protected:
 
+		/**
+		 * Determines the real roots of several quartic polynomials a * x^4 + b * x^3 + c * x^2 + d * x + e = 0 at once.
+		 * The function does not contain any branches within the lanes, invalid lanes can be provided with arbitrary coefficients.
+		 * @param a The coefficients 'a' of all polynomials, tBatchSize values, with range (-infinity, infinity) \ {0} for valid lanes
+		 * @param b The coefficients 'b' of all polynomials, tBatchSize values
+		 * @param c The coefficients 'c' of all polynomials, tBatchSize values
+		 * @param d The coefficients 'd' of all polynomials, tBatchSize values
+		 * @param e The coefficients 'e' of all polynomials, tBatchSize values
+		 * @param roots The resulting four roots of all polynomials, roots[r][lane]
+		 * @param validRoots The resulting flags whether the individual roots are real, validRoots[r][lane]
+		 * @tparam T Data type of the coefficients, either 'float' or 'double'
+		 * @tparam tBatchSize The number of polynomials, with range [1, infinity)
+		 */
+		template <typename T, size_t tBatchSize>
+		static void solveQuarticsBatch(const T* a, const T* b, const T* c, const T* d, const T* e, T roots[4][tBatchSize], bool validRoots[4][tBatchSize]);
+
 		/**
 		 * Constructs the closest point on the line between two object points and the camera's projection center.
 		 * @param objectPoint0 First object point intersecting the line
@@ -33,6 +33,178 @@ namespace Ocean
 namespace Geometry
 {
 
+RANSAC::ProgressiveSampler::ProgressiveSampler(const unsigned int correspondences, const unsigned int sampleSize, const unsigned int maximalIterations, const bool progressive) :
+	correspondences_(correspondences),
+	sampleSize_(sampleSize),
+	progressive_(progressive),
+	subsetSize_(sampleSize),
+	subsetIteration_(1u)
+{
+	ocean_assert(sampleSize_ >= 1u && sampleSize_ <= 8u);
+	ocean_assert(correspondences_ >= sampleSize_);
+	ocean_assert(maximalIterations >= 1u);
+
+	// T_n = T_N * prod_{i=0}^{m-1} (n - i) / (N - i), with n = m
+
+	subsetSamples_ = Scalar(maximalIterations);
+
+	for (unsigned int i = 0u; i < sampleSize_; ++i)
+	{
+		subsetSamples_ *= Scalar(sampleSize_ - i) / Scalar(correspondences_ - i);
+	}
+}
+
+void RANSAC::ProgressiveSampler::sample(RandomXoshiro& randomGenerator, Index32* indices)
+{
+	ocean_assert(indices != nullptr);
+
+	// draws unique random indices from the range [0, range)
+	const auto drawIndices = [&randomGenerator, indices](const unsigned int number, const unsigned int range)
+	{
+		ocean_assert(number <= range);
+
+		for (unsigned int n = 0u; n < number; /* noop */)
+		{
+			const Index32 index = randomGenerator.random(range - 1u);
+
+			if (std::find(indices, indices + n, index) == indices + n)
+			{
+				indices[n++] = index;
+			}
+		}
+	};
+
+	if (!progressive_)
+	{
+		drawIndices(sampleSize_, correspondences_);
+		return;
+	}
+
+	++iteration_;
+
+	if (iteration_ > subsetIteration_ && subsetSize_ < correspondences_)
+	{
+		// T_{n+1} = T_n * (n + 1) / (n + 1 - m),  T'_{n+1} = T'_n + ceil(T_{n+1} - T_n)
+
+		const Scalar nextSubsetSamples = subsetSamples_ * Scalar(subsetSize_ + 1u) / Scalar(subsetSize_ + 1u - sampleSize_);
+
+		subsetIteration_ += (unsigned int)(Numeric::ceil(nextSubsetSamples - subsetSamples_));
+		subsetSamples_ = nextSubsetSamples;
+
+		++subsetSize_;
+	}
+
+	if (subsetIteration_ < iteration_)
+	{
+		drawIndices(sampleSize_, subsetSize_);
+	}
+	else
+	{
+		// the sample contains the worst correspondence of the current subset and further correspondences from the better correspondences
+
+		drawIndices(sampleSize_ - 1u, subsetSize_ - 1u);
+		indices[sampleSize_ - 1u] = subsetSize_ - 1u;
+	}
+}
+
+RANSAC::SequentialProbabilityRatioTest::SequentialProbabilityRatioTest(const Scalar modelEstimationCost, const Scalar modelsPerSample, const Scalar inlierRate) :
+	modelEstimationCost_(modelEstimationCost),
+	modelsPerSample_(modelsPerSample),
+	inlierRate_(minmax(Numeric::eps(), inlierRate, Scalar(0.99)))
+{
+	ocean_assert(modelEstimationCost_ > 0);
+	ocean_assert(modelsPerSample_ > 0);
+
+	update();
+}
+
+void RANSAC::SequentialProbabilityRatioTest::updateInlierRate(const Scalar inlierRate)
+{
+	ocean_assert(inlierRate > 0 && inlierRate <= 1);
+
+	inlierRate_ = minmax(Numeric::eps(), inlierRate, Scalar(0.99));
+
+	update();
+}
+
+void RANSAC::SequentialProbabilityRatioTest::addRejectedModel(const unsigned int testedCorrespondences, const unsigned int consistentCorrespondences)
+{
+	ocean_assert(testedCorrespondences >= 1u);
+	ocean_assert(consistentCorrespondences <= testedCorrespondences);
+
+	if (testedCorrespondences == 0u)
+	{
+		return;
+	}
+
+	sumRejectedInlierRates_ += Scalar(consistentCorrespondences) / Scalar(testedCorrespondences);
+	++rejectedModels_;
+
+	const Scalar badModelInlierRate = minmax(Scalar(0.01), sumRejectedInlierRates_ / Scalar(rejectedModels_), Scalar(0.99));
+
+	// we update the test only if the probability has changed significantly
+	if (Numeric::abs(badModelInlierRate - badModelInlierRate_) > badModelInlierRate_ * Scalar(0.05))
+	{
+		badModelInlierRate_ = badModelInlierRate;
+
+		update();
+	}
+}
+
+unsigned int RANSAC::SequentialProbabilityRatioTest::iterations(const unsigned int sampleSize, const unsigned int maximalIterations, const Scalar successProbability) const
+{
+	ocean_assert(sampleSize >= 1u);
+	ocean_assert(maximalIterations >= 1u);
+
+	Scalar inlierRate = inlierRate_;
+
+	if (threshold_ != Numeric::maxValue())
+	{
+		// a good model is accepted by the test with probability 1 - 1/A, so that the effective probability of a good sample is epsilon^m * (1 - 1/A)
+
+		ocean_assert(threshold_ > 1);
+		inlierRate *= Numeric::pow(Scalar(1) - Scalar(1) / threshold_, Scalar(1) / Scalar(sampleSize));
+	}
+
+	return RANSAC::iterations(sampleSize, successProbability, Scalar(1) - inlierRate, maximalIterations);
+}
+
+void RANSAC::SequentialProbabilityRatioTest::update()
+{
+	consistentFactor_ = Scalar(1);
+	inconsistentFactor_ = Scalar(1);
+	threshold_ = Numeric::maxValue();
+
+	// the test cannot distinguish between good and bad models if a good model does not have a higher probability for consistent correspondences
+	if (inlierRate_ <= badModelInlierRate_)
+	{
+		return;
+	}
+
+	const Scalar delta = badModelInlierRate_;
+	const Scalar epsilon = inlierRate_;
+
+	consistentFactor_ = delta / epsilon;
+	inconsistentFactor_ = (Scalar(1) - delta) / (Scalar(1) - epsilon);
+
+	// C = (1 - delta) * log((1 - delta) / (1 - epsilon)) + delta * log(delta / epsilon)
+	const Scalar c = (Scalar(1) - delta) * Numeric::log(inconsistentFactor_) + delta * Numeric::log(consistentFactor_);
+	ocean_assert(c > 0);
+
+	// A is the solution of A = A0 + log(A), with A0 = tM * C / mS + 1, which is determined iteratively
+
+	const Scalar a0 = modelEstimationCost_ * c / modelsPerSample_ + Scalar(1);
+
+	Scalar a = a0;
+
+	for (unsigned int n = 0u; n < 10u; ++n)
+	{
+		a = a0 + Numeric::log(a);
+	}
+
+	threshold_ = a;
+}
+
 unsigned int RANSAC::iterations(const unsigned int model, const Scalar successProbability, const Scalar faultyRate, const unsigned int maximalIterations)
 {
 	ocean_assert(model > 0u);
@@ -120,16 +292,23 @@ bool RANSAC::p3p(const AnyCamera& anyCamera, const ConstIndexedAccessor<Vector3>
 
 	const unsigned int correspondences = (unsigned int)(objectPoints.size());
 
-	Indices32 indices;
-	indices.reserve(correspondences);
-
 	Indices32 bestIndices;
 	bestIndices.reserve(correspondences);
 
-	Vector3 permutationObjectPoints[3];
-	Vector3 permutationImageRays[3];
+	// the minimal samples are solved in batches, the hypotheses of one batch are scored together
+
+	constexpr size_t batchSize = 4;
+
+	Vector3 sampleObjectPoints[batchSize * 3];
+	Vector3 sampleImageRays[batchSize * 3];
+
+	HomogenousMatrix4 world_T_candidateCameras[batchSize * 4];
+	unsigned int numberCandidateCameras[batchSize];
+
+	HomogenousMatrix4 flippedCandidateCameras_T_world[batchSize * 4];
+	unsigned int candidateValidCorrespondences[batchSize * 4];
+	Scalar candidateSqrErrors[batchSize * 4];
 
-	HomogenousMatrix4 world_T_candidateCameras[4];
 	HomogenousMatrix4 world_T_bestCamera(false);
 
 	Scalar bestSqrErrors = Numeric::maxValue();
@@ -139,78 +318,110 @@ bool RANSAC::p3p(const AnyCamera& anyCamera, const ConstIndexedAccessor<Vector3>
 
 	unsigned int adaptiveIterations = iterations;
 
-	for (unsigned int i = 0u; i < adaptiveIterations; ++i)
+	for (unsigned int i = 0u; i < adaptiveIterations; i += (unsigned int)(batchSize))
 	{
-		unsigned int index0, index1, index2;
-		Random::random(randomGenerator, correspondences - 1u, index0, index1, index2);
+		const size_t validSamples = std::min(batchSize, size_t(adaptiveIterations - i));
 
-		ocean_assert(index0 < correspondences);
-		ocean_assert(index1 < correspondences);
-		ocean_assert(index2 < correspondences);
+		for (size_t sample = 0; sample < batchSize; ++sample)
+		{
+			Vector3* objectPointsSample = sampleObjectPoints + sample * 3;
+			Vector3* imageRaysSample = sampleImageRays + sample * 3;
 
-		ocean_assert(index0 != index1 && index1 != index2);
+			if (sample >= validSamples)
+			{
+				// unused lanes of the last batch are filled with the first sample, their poses are ignored
 
-		permutationObjectPoints[0] = objectPoints[index0];
-		permutationObjectPoints[1] = objectPoints[index1];
-		permutationObjectPoints[2] = objectPoints[index2];
+				for (unsigned int n = 0u; n < 3u; ++n)
+				{
+					objectPointsSample[n] = sampleObjectPoints[n];
+					imageRaysSample[n] = sampleImageRays[n];
+				}
+
+				continue;
+			}
 
-		permutationImageRays[0] = anyCamera.vector(imagePoints[index0]);
-		permutationImageRays[1] = anyCamera.vector(imagePoints[index1]);
-		permutationImageRays[2] = anyCamera.vector(imagePoints[index2]);
+			unsigned int index0, index1, index2;
+			Random::random(randomGenerator, correspondences - 1u, index0, index1, index2);
 
-		const unsigned int numberPoses = P3P::poses(permutationObjectPoints, permutationImageRays, world_T_candidateCameras);
-		ocean_assert(numberPoses <= 4u);
+			ocean_assert(index0 < correspondences);
+			ocean_assert(index1 < correspondences);
+			ocean_assert(index2 < correspondences);
 
-		// test which of the (at most four) poses is valid for most remaining point correspondences
-		for (unsigned int n = 0u; n < numberPoses; ++n)
+			ocean_assert(index0 != index1 && index1 != index2);
+
+			objectPointsSample[0] = objectPoints[index0];
+			objectPointsSample[1] = objectPoints[index1];
+			objectPointsSample[2] = objectPoints[index2];
+
+			imageRaysSample[0] = anyCamera.vector(imagePoints[index0]);
+			imageRaysSample[1] = anyCamera.vector(imagePoints[index1]);
+			imageRaysSample[2] = anyCamera.vector(imagePoints[index2]);
+		}
+
+		P3P::posesBatch<Scalar, batchSize>(sampleObjectPoints, sampleImageRays, world_T_candidateCameras, numberCandidateCameras);
+
+		size_t numberCandidates = 0;
+
+		for (size_t sample = 0; sample < validSamples; ++sample)
 		{
-			const HomogenousMatrix4& world_T_candidateCamera = world_T_candidateCameras[n];
+			ocean_assert(numberCandidateCameras[sample] <= 4u);
 
-			if (gravityConstraints != nullptr)
+			for (unsigned int n = 0u; n < numberCandidateCameras[sample]; ++n)
 			{
-				if (!gravityConstraints->isCameraAlignedWithGravity(world_T_candidateCamera))
+				const HomogenousMatrix4& world_T_candidateCamera = world_T_candidateCameras[sample * 4 + n];
+
+				if (gravityConstraints != nullptr)
 				{
-					continue;
+					if (!gravityConstraints->isCameraAlignedWithGravity(world_T_candidateCamera))
+					{
+						continue;
+					}
 				}
+
+				flippedCandidateCameras_T_world[numberCandidates++] = Camera::standard2InvertedFlipped(world_T_candidateCamera);
 			}
+		}
 
-			indices.clear();
+		if (numberCandidates == 0)
+		{
+			continue;
+		}
 
-			Scalar sqrErrors = 0;
+		// we can stop scoring a pose as soon as it cannot reach a better configuration than we have already
 
-			const HomogenousMatrix4 flippedCandidateCamera_T_world(Camera::standard2InvertedFlipped(world_T_candidateCamera));
+		const size_t minimalCandidateCorrespondences = std::max(size_t(minimalValidCorrespondences), bestIndices.size());
 
-			ocean_assert(Camera::isObjectPointInFrontIF(flippedCandidateCamera_T_world, objectPoints[index0]));
-			ocean_assert(Camera::isObjectPointInFrontIF(flippedCandidateCamera_T_world, objectPoints[index1]));
-			ocean_assert(Camera::isObjectPointInFrontIF(flippedCandidateCamera_T_world, objectPoints[index2]));
+		scorePosesIF(anyCamera, flippedCandidateCameras_T_world, numberCandidates, objectPoints.data(), imagePoints.data(), correspondences, sqrPixelErrorThreshold, minimalCandidateCorrespondences, candidateValidCorrespondences, candidateSqrErrors);
 
-			// now we test each 2D/3D point correspondences and check whether the accuracy of the pose is good enough, we can stop if we cannot reach a better configuration than we have already
-			for (unsigned int c = 0u; indices.size() + (correspondences - c) >= bestIndices.size() && c < correspondences; ++c)
+		for (size_t n = 0; n < numberCandidates; ++n)
+		{
+			const size_t validCandidateCorrespondences = size_t(candidateValidCorrespondences[n]);
+
+			if (validCandidateCorrespondences >= minimalValidCorrespondences)
 			{
-				// we accept only object points lying in front of the camera
-				if (Camera::isObjectPointInFrontIF(flippedCandidateCamera_T_world, objectPoints[c]))
+				if (validCandidateCorrespondences > bestIndices.size() || (validCandidateCorrespondences == bestIndices.size() && candidateSqrErrors[n] < bestSqrErrors))
 				{
-					const Vector2 projectedImagePoint(anyCamera.projectToImageIF(flippedCandidateCamera_T_world, objectPoints[c]));
-					const Vector2& imagePoint = imagePoints[c];
+					const HomogenousMatrix4& flippedCandidateCamera_T_world = flippedCandidateCameras_T_world[n];
 
-					const Scalar sqrError = imagePoint.sqrDistance(projectedImagePoint);
+					bestSqrErrors = candidateSqrErrors[n];
 
-					if (sqrError <= sqrPixelErrorThreshold)
+					world_T_bestCamera = Camera::invertedFlipped2Standard(flippedCandidateCamera_T_world);
+
+					bestIndices.clear();
+
+					for (unsigned int c = 0u; c < correspondences; ++c)
 					{
-						indices.push_back(c);
-						sqrErrors += sqrError;
+						// we accept only object points lying in front of the camera
+						if (Camera::isObjectPointInFrontIF(flippedCandidateCamera_T_world, objectPoints[c]))
+						{
+							if (imagePoints[c].sqrDistance(anyCamera.projectToImageIF(flippedCandidateCamera_T_world, objectPoints[c])) <= sqrPixelErrorThreshold)
+							{
+								bestIndices.push_back(c);
+							}
+						}
 					}
-				}
-			}
 
-			if (indices.size() >= minimalValidCorrespondences)
-			{
-				if (indices.size() > bestIndices.size() || (indices.size() == bestIndices.size() && sqrErrors < bestSqrErrors))
-				{
-					bestSqrErrors = sqrErrors;
-
-					world_T_bestCamera = world_T_candidateCamera;
-					std::swap(bestIndices, indices);
+					ocean_assert(bestIndices.size() == validCandidateCorrespondences);
 
 					constexpr Scalar successProbability = Scalar(0.99);
 					const Scalar faultyRate =  Scalar(1) - Scalar(bestIndices.size()) / Scalar(correspondences);
@@ -290,6 +501,198 @@ bool RANSAC::p3p(const AnyCamera& anyCamera, const ConstIndexedAccessor<Vector3>
 	return true;
 }
 
+void RANSAC::scorePosesIF(const AnyCamera& anyCamera, const HomogenousMatrix4* flippedCameras_T_world, const size_t numberPoses, const Vector3* objectPoints, const Vector2* imagePoints, const size_t correspondences, const Scalar sqrPixelErrorThreshold, const size_t minimalValidCorrespondences, unsigned int* validCorrespondences, Scalar* sqrErrors)
+{
+	ocean_assert(anyCamera.isValid());
+	ocean_assert(flippedCameras_T_world != nullptr && numberPoses >= 1);
+	ocean_assert(objectPoints != nullptr && imagePoints != nullptr && correspondences >= 1);
+	ocean_assert(validCorrespondences != nullptr && sqrErrors != nullptr);
+
+	// the correspondences are processed in blocks, so that each block is projected with one camera call per pose
+
+	constexpr size_t blockSize = 64;
+
+	Vector2 projectedImagePoints[blockSize];
+	Scalar depths[blockSize];
+
+	for (size_t n = 0; n < numberPoses; ++n)
+	{
+		validCorrespondences[n] = 0u;
+		sqrErrors[n] = Scalar(0);
+	}
+
+	for (size_t blockStart = 0; blockStart < correspondences; blockStart += blockSize)
+	{
+		const size_t blockCorrespondences = std::min(blockSize, correspondences - blockStart);
+
+		const Vector3* blockObjectPoints = objectPoints + blockStart;
+		const Vector2* blockImagePoints = imagePoints + blockStart;
+
+		for (size_t n = 0; n < numberPoses; ++n)
+		{
+			// the pose cannot reach the minimal number of valid correspondences anymore
+
+			if (size_t(validCorrespondences[n]) + (correspondences - blockStart) < minimalValidCorrespondences)
+			{
+				continue;
+			}
+
+			const HomogenousMatrix4& flippedCamera_T_world = flippedCameras_T_world[n];
+
+			for (size_t c = 0; c < blockCorrespondences; ++c)
+			{
+				depths[c] = flippedCamera_T_world(2, 0) * blockObjectPoints[c].x() + flippedCamera_T_world(2, 1) * blockObjectPoints[c].y() + flippedCamera_T_world(2, 2) * blockObjectPoints[c].z() + flippedCamera_T_world(2, 3);
+			}
+
+			anyCamera.projectToImageIF(flippedCamera_T_world, blockObjectPoints, blockCorrespondences, projectedImagePoints);
+
+			unsigned int blockValidCorrespondences = 0u;
+			Scalar blockSqrErrors = Scalar(0);
+
+			for (size_t c = 0; c < blockCorrespondences; ++c)
+			{
+				// we accept only object points lying in front of the camera
+
+				const Scalar sqrError = blockImagePoints[c].sqrDistance(projectedImagePoints[c]);
+				const bool valid = depths[c] > Numeric::eps() && sqrError <= sqrPixelErrorThreshold;
+
+				blockValidCorrespondences += valid ? 1u : 0u;
+				blockSqrErrors += valid ? sqrError : Scalar(0);
+			}
+
+			validCorrespondences[n] += blockValidCorrespondences;
+			sqrErrors[n] += blockSqrErrors;
+		}
+	}
+}
+
+bool RANSAC::p3pPreemptive(const AnyCamera& anyCamera, const ConstIndexedAccessor<Vector3>& objectPointAccessor, const ConstIndexedAccessor<Vector2>& imagePointAccessor, RandomGenerator& randomGenerator, HomogenousMatrix4& world_T_camera, const unsigned int minimalValidCorrespondences, const bool refine, const unsigned int maximalIterations, const Scalar sqrPixelErrorThreshold, const bool progressiveSampling, Indices32* usedIndices, Scalar* sqrAccuracy, const GravityConstraints* gravityConstraints, Worker* worker)
+{
+	ocean_assert(anyCamera.isValid());
+	ocean_assert(minimalValidCorrespondences >= 4u);
+	ocean_assert(objectPointAccessor.size() >= 4);
+	ocean_assert(objectPointAccessor.size() == imagePointAccessor.size());
+	ocean_assert(objectPointAccessor.size() >= minimalValidCorrespondences);
+	ocean_assert(maximalIterations >= 1u);
+	ocean_assert(gravityConstraints == nullptr || (gravityConstraints->isValid() && gravityConstraints->numberCameras() == 1));
+
+	if (objectPointAccessor.size() < 4 || objectPointAccessor.size() != imagePointAccessor.size() || objectPointAccessor.size() < minimalValidCorrespondences)
+	{
+		return false;
+	}
+
+	const ScopedConstMemoryAccessor<Vector3> objectPoints(objectPointAccessor);
+	const ScopedConstMemoryAccessor<Vector2> imagePoints(imagePointAccessor);
+
+	const unsigned int correspondences = (unsigned int)(objectPoints.size());
+
+	// the models are the flipped and inverted camera poses, at most four for each sample
+	const auto hypothesesFunction = [&anyCamera, &objectPoints, &imagePoints, gravityConstraints](const Index32* sampleIndices, HomogenousMatrix4* flippedCandidateCameras_T_world) -> unsigned int
+	{
+		const Vector3 sampleObjectPoints[3] = {objectPoints[sampleIndices[0]], objectPoints[sampleIndices[1]], objectPoints[sampleIndices[2]]};
+		const Vector3 sampleImageRays[3] = {anyCamera.vector(imagePoints[sampleIndices[0]]), anyCamera.vector(imagePoints[sampleIndices[1]]), anyCamera.vector(imagePoints[sampleIndices[2]])};
+
+		HomogenousMatrix4 world_T_candidateCameras[4];
+
+		const unsigned int numberPoses = P3P::poses(sampleObjectPoints, sampleImageRays, world_T_candidateCameras);
+		ocean_assert(numberPoses <= 4u);
+
+		unsigned int numberModels = 0u;
+
+		for (unsigned int n = 0u; n < numberPoses; ++n)
+		{
+			if (gravityConstraints != nullptr && !gravityConstraints->isCameraAlignedWithGravity(world_T_candidateCameras[n]))
+			{
+				continue;
+			}
+
+			flippedCandidateCameras_T_world[numberModels++] = Camera::standard2InvertedFlipped(world_T_candidateCameras[n]);
+		}
+
+		return numberModels;
+	};
+
+	const auto sqrErrorFunction = [&anyCamera, &objectPoints, &imagePoints](const HomogenousMatrix4& flippedCandidateCamera_T_world, const Index32 index) -> Scalar
+	{
+		// we accept only object points lying in front of the camera
+		if (!Camera::isObjectPointInFrontIF(flippedCandidateCamera_T_world, objectPoints[index]))
+		{
+			return Numeric::maxValue();
+		}
+
+		return imagePoints[index].sqrDistance(anyCamera.projectToImageIF(flippedCandidateCamera_T_world, objectPoints[index]));
+	};
+
+	// the estimation of the P3P poses is roughly as expensive as the verification of 200 correspondences
+	constexpr Scalar modelEstimationCost = Scalar(200);
+
+	HomogenousMatrix4 flippedBestCamera_T_world(false);
+	Indices32 bestIndices;
+	Scalar bestSqrErrors = Numeric::maxValue();
+
+	if (!preemptive<HomogenousMatrix4, 3u, 4u>(correspondences, hypothesesFunction, sqrErrorFunction, randomGenerator, minimalValidCorrespondences, maximalIterations, sqrPixelErrorThreshold, progressiveSampling, modelEstimationCost, flippedBestCamera_T_world, bestIndices, bestSqrErrors, worker))
+	{
+		return false;
+	}
+
+	HomogenousMatrix4 world_T_bestCamera(Camera::invertedFlipped2Standard(flippedBestCamera_T_world));
+
+	world_T_camera = world_T_bestCamera;
+
+	if (sqrAccuracy != nullptr)
+	{
+		*sqrAccuracy = bestSqrErrors / Scalar(bestIndices.size());
+	}
+
+	// non linear least square refinement step
+	if (refine)
+	{
+		const size_t bestIndicesUsedForOptimization = bestIndices.size();
+
+		if (!NonLinearOptimizationPose::optimizePose(anyCamera, world_T_bestCamera, ConstArraySubsetAccessor<Vector3, unsigned int>(objectPoints.data(), bestIndices), ConstArraySubsetAccessor<Vector2, unsigned int>(imagePoints.data(), bestIndices), world_T_camera, 20u, Estimator::ET_SQUARE, Scalar(0.001), Scalar(5), nullptr, sqrAccuracy, nullptr, gravityConstraints))
+		{
+			return false;
+		}
+
+		// check whether we need to determine the indices for the optimized pose followed by another final optimization step
+		if (usedIndices != nullptr && bestIndices.size() != correspondences)
+		{
+			const HomogenousMatrix4 flippedCamera_T_world(Camera::standard2InvertedFlipped(world_T_camera));
+
+			bestIndices.clear();
+			for (unsigned int c = 0u; c < correspondences; ++c)
+			{
+				if (sqrErrorFunction(flippedCamera_T_world, c) <= sqrPixelErrorThreshold)
+				{
+					bestIndices.push_back(c);
+				}
+			}
+
+			if (bestIndices.size() < minimalValidCorrespondences)
+			{
+				return false;
+			}
+
+			if (bestIndices.size() != bestIndicesUsedForOptimization)
+			{
+				world_T_bestCamera = world_T_camera;
+
+				if (!NonLinearOptimizationPose::optimizePose(anyCamera, world_T_bestCamera, ConstArraySubsetAccessor<Vector3, unsigned int>(objectPoints.data(), bestIndices), ConstArraySubsetAccessor<Vector2, unsigned int>(imagePoints.data(), bestIndices), world_T_camera, 20u, Estimator::ET_SQUARE, Scalar(0.001), Scalar(5), nullptr, sqrAccuracy, nullptr, gravityConstraints))
+				{
+					return false;
+				}
+			}
+		}
+	}
+
+	if (usedIndices != nullptr)
+	{
+		*usedIndices = std::move(bestIndices);
+	}
+
+	return true;
+}
+
 bool RANSAC::objectPoint(const ConstIndexedAccessor<const AnyCamera*>& cameras, const ConstIndexedAccessor<HomogenousMatrix4>& world_T_cameras, const ConstIndexedAccessor<Vector2>& imagePoints, RandomGenerator& randomGenerator, Vector3& objectPoint, const unsigned int iterations, const Scalar maximalSqrError, const unsigned int minValidCorrespondences, const bool onlyFrontObjectPoint, const Estimator::EstimatorType refinementEstimator, Scalar* finalRobustError, Indices32* usedIndices)
 {
 	ocean_assert(cameras.size() == world_T_cameras.size() && world_T_cameras.size() == imagePoints.size() && world_T_cameras.size() >= 2 && maximalSqrError >= 0);
@@ -393,6 +796,63 @@ bool RANSAC::objectPoint(const ConstIndexedAccessor<const AnyCamera*>& cameras,
 	return true;
 }
 
+size_t RANSAC::objectPoints(const AnyCamera& camera, const ConstIndexedAccessor<HomogenousMatrix4>& world_T_cameras, const NonLinearOptimization::ObjectPointGroupsAccessor& correspondenceGroups, RandomGenerator& randomGenerator, Vector3* objectPoints, uint8_t* validObjectPoints, const unsigned int iterations, const Scalar maximalSqrError, const unsigned int minValidCorrespondences, const bool onlyFrontObjectPoint, const Estimator::EstimatorType refinementEstimator, Worker* worker)
+{
+	ocean_assert(camera.isValid());
+	ocean_assert(world_T_cameras.size() >= 2 && maximalSqrError >= 0);
+	ocean_assert(objectPoints != nullptr && validObjectPoints != nullptr);
+	ocean_assert(iterations >= 1u && minValidCorrespondences >= 2u);
+
+	const size_t numberObjectPoints = correspondenceGroups.groups();
+
+	if (numberObjectPoints == 0)
+	{
+		return 0;
+	}
+
+	if (world_T_cameras.size() <= 1)
+	{
+		memset(validObjectPoints, 0, sizeof(uint8_t) * numberObjectPoints);
+		return 0;
+	}
+
+	const ScopedConstMemoryAccessor<HomogenousMatrix4> scopedWorld_T_cameras(world_T_cameras);
+
+	// the poses are shared by all object points, so that they are inverted and flipped only once
+
+	const HomogenousMatrices4 flippedCameras_T_world(Camera::standard2InvertedFlipped(scopedWorld_T_cameras.data(), scopedWorld_T_cameras.size()));
+
+	// each object point receives an own seed, so that the results do not depend on the distribution of the object points
+
+	Indices32 seeds(numberObjectPoints);
+
+	for (unsigned int& seed : seeds)
+	{
+		seed = RandomI::random32(randomGenerator);
+	}
+
+	if (worker != nullptr)
+	{
+		worker->executeFunction(Worker::Function::createStatic(&RANSAC::objectPointsSubset, &camera, scopedWorld_T_cameras.data(), flippedCameras_T_world.data(), &correspondenceGroups, (const unsigned int*)(seeds.data()), objectPoints, validObjectPoints, iterations, maximalSqrError, minValidCorrespondences, onlyFrontObjectPoint, refinementEstimator, 0u, 0u), 0u, (unsigned int)(numberObjectPoints), 12u, 13u, 20u);
+	}
+	else
+	{
+		objectPointsSubset(&camera, scopedWorld_T_cameras.data(), flippedCameras_T_world.data(), &correspondenceGroups, seeds.data(), objectPoints, validObjectPoints, iterations, maximalSqrError, minValidCorrespondences, onlyFrontObjectPoint, refinementEstimator, 0u, (unsigned int)(numberObjectPoints));
+	}
+
+	size_t validNumber = 0;
+
+	for (size_t n = 0; n < numberObjectPoints; ++n)
+	{
+		if (validObjectPoints[n] != 0u)
+		{
+			++validNumber;
+		}
+	}
+
+	return validNumber;
+}
+
 bool RANSAC::objectPoint(const AnyCamera& camera, const ConstIndexedAccessor<SquareMatrix3>& world_R_cameras, const ConstIndexedAccessor<Vector2>& imagePoints, RandomGenerator& randomGenerator, Vector3& objectPoint, const Scalar objectPointDistance, const unsigned int iterations, const Scalar maximalError, const unsigned int minValidCorrespondences, const bool onlyFrontObjectPoint, const Estimator::EstimatorType refinementEstimator, Scalar* finalError, Indices32* usedIndices)
 {
 	ocean_assert(camera.isValid());
@@ -1267,9 +1727,11 @@ bool RANSAC::fundamentalMatrix(const Vector2* leftImagePoints, const Vector2* ri
 	size_t bestCorrespondences = 0;
 	SquareMatrix3 bestFundamental(false);
 
+	RandomXoshiro samplingGenerator(randomGenerator);
+
 	for (unsigned int nIteration = 0u; nIteration < iterations; ++nIteration)
 	{
-		subsetIndices(indices, testCandidates, randomGenerator);
+		subsetIndices(indices, testCandidates, samplingGenerator);
 
 		for (size_t n = 0; n < testCandidates; ++n)
 		{
@@ -1342,6 +1804,59 @@ bool RANSAC::fundamentalMatrix(const Vector2* leftImagePoints, const Vector2* ri
 	return true;
 }
 
+bool RANSAC::fundamentalMatrixPreemptive(const Vector2* leftImagePoints, const Vector2* rightImagePoints, const size_t correspondences, RandomGenerator& randomGenerator, SquareMatrix3& right_F_left, const unsigned int maximalIterations, const Scalar maxScalarProduct, const bool progressiveSampling, Indices32* usedIndices, Worker* worker)
+{
+	ocean_assert(leftImagePoints != nullptr && rightImagePoints != nullptr);
+	ocean_assert(correspondences >= 8);
+	ocean_assert(maxScalarProduct >= 0);
+
+	if (correspondences < 8)
+	{
+		return false;
+	}
+
+	const auto hypothesesFunction = [leftImagePoints, rightImagePoints](const Index32* sampleIndices, SquareMatrix3* candidateFundamentals) -> unsigned int
+	{
+		Vector2 sampleLeftPoints[8];
+		Vector2 sampleRightPoints[8];
+
+		for (unsigned int n = 0u; n < 8u; ++n)
+		{
+			sampleLeftPoints[n] = leftImagePoints[sampleIndices[n]];
+			sampleRightPoints[n] = rightImagePoints[sampleIndices[n]];
+		}
+
+		return EpipolarGeometry::fundamentalMatrix(sampleLeftPoints, sampleRightPoints, 8, candidateFundamentals[0]) ? 1u : 0u;
+	};
+
+	// the square of the scalar product is used as error
+	const auto sqrErrorFunction = [leftImagePoints, rightImagePoints](const SquareMatrix3& candidateFundamental, const Index32 index) -> Scalar
+	{
+		return Numeric::sqr((candidateFundamental * Vector3(leftImagePoints[index], 1)) * Vector3(rightImagePoints[index], 1));
+	};
+
+	// the estimation of the fundamental matrix is roughly as expensive as the verification of 500 correspondences
+	constexpr Scalar modelEstimationCost = Scalar(500);
+
+	SquareMatrix3 bestFundamental(false);
+	Indices32 bestIndices;
+	Scalar bestSqrErrors = Numeric::maxValue();
+
+	if (!preemptive<SquareMatrix3, 8u, 1u>((unsigned int)(correspondences), hypothesesFunction, sqrErrorFunction, randomGenerator, 8u, maximalIterations, Numeric::sqr(maxScalarProduct), progressiveSampling, modelEstimationCost, bestFundamental, bestIndices, bestSqrErrors, worker))
+	{
+		return false;
+	}
+
+	right_F_left = bestFundamental;
+
+	if (usedIndices != nullptr)
+	{
+		*usedIndices = std::move(bestIndices);
+	}
+
+	return true;
+}
+
 bool RANSAC::extrinsicMatrix(const PinholeCamera& leftCamera, const PinholeCamera& rightCamera, const Vector2* leftImagePoints, const Vector2* rightImagePoints, const size_t correspondences, HomogenousMatrix4& leftCamera_T_rightCamera, const unsigned int testCandidates, const unsigned int iterations, const Scalar squarePixelErrorThreshold, const Box3& maxTranslation, const Scalar maxRotation, Indices32* usedIndices)
 {
 	ocean_assert(squarePixelErrorThreshold > 0);
@@ -1497,11 +2012,11 @@ bool RANSAC::homographyMatrices(const Vector2* leftImagePoints, const Vector2* r
 	if (worker != nullptr)
 	{
 		Lock lock;
-		worker->executeFunction(Worker::Function::createStatic(&geometricTransformSubset, Homography::homographyMatrixSVD, leftImagePoints, rightImagePoints, correspondences, &randomGenerator, &commonHomography, testCandidates, squarePixelErrorThreshold, indices, &maxValidCorrespondences, &minSquareErrors, (Lock*)&lock, 0u, 0u), 0u, iterations, 12u, 13u, 5u);
+		worker->executeFunction(Worker::Function::createStatic(&geometricTransformSubset, homographyMatrixForSample, leftImagePoints, rightImagePoints, correspondences, &randomGenerator, &commonHomography, testCandidates, squarePixelErrorThreshold, indices, &maxValidCorrespondences, &minSquareErrors, (Lock*)&lock, 0u, 0u), 0u, iterations, 12u, 13u, 5u);
 	}
 	else
 	{
-		geometricTransformSubset(Homography::homographyMatrixSVD, leftImagePoints, rightImagePoints, correspondences, &randomGenerator, &commonHomography, testCandidates, squarePixelErrorThreshold, indices, &maxValidCorrespondences, &minSquareErrors, nullptr, 0u, iterations);
+		geometricTransformSubset(homographyMatrixForSample, leftImagePoints, rightImagePoints, correspondences, &randomGenerator, &commonHomography, testCandidates, squarePixelErrorThreshold, indices, &maxValidCorrespondences, &minSquareErrors, nullptr, 0u, iterations);
 	}
 
 	if (maxValidCorrespondences < testCandidates)
@@ -1560,6 +2075,90 @@ bool RANSAC::homographyMatrices(const Vector2* leftImagePoints, const Vector2* r
 	return true;
 }
 
+bool RANSAC::homographyMatrixPreemptive(const Vector2* leftImagePoints, const Vector2* rightImagePoints, const size_t correspondences, RandomGenerator& randomGenerator, SquareMatrix3& right_H_left, const bool refine, const unsigned int maximalIterations, const Scalar squarePixelErrorThreshold, const bool progressiveSampling, Indices32* usedIndices, Worker* worker)
+{
+	ocean_assert(leftImagePoints != nullptr && rightImagePoints != nullptr);
+	ocean_assert(correspondences >= 4);
+	ocean_assert(squarePixelErrorThreshold > 0);
+
+	if (correspondences < 4)
+	{
+		return false;
+	}
+
+	const auto hypothesesFunction = [leftImagePoints, rightImagePoints](const Index32* sampleIndices, SquareMatrix3* candidateHomographies) -> unsigned int
+	{
+		const Vector2 sampleLeftPoints[4] = {leftImagePoints[sampleIndices[0]], leftImagePoints[sampleIndices[1]], leftImagePoints[sampleIndices[2]], leftImagePoints[sampleIndices[3]]};
+		const Vector2 sampleRightPoints[4] = {rightImagePoints[sampleIndices[0]], rightImagePoints[sampleIndices[1]], rightImagePoints[sampleIndices[2]], rightImagePoints[sampleIndices[3]]};
+
+		if (!Homography::homographyMatrixFromFourPoints(sampleLeftPoints, sampleRightPoints, candidateHomographies[0]))
+		{
+			return 0u;
+		}
+
+		return 1u;
+	};
+
+	const auto sqrErrorFunction = [leftImagePoints, rightImagePoints](const SquareMatrix3& candidateHomography, const Index32 index) -> Scalar
+	{
+		Vector2 transformedLeftPoint;
+		if (!candidateHomography.multiply(leftImagePoints[index], transformedLeftPoint))
+		{
+			return Numeric::maxValue();
+		}
+
+		return rightImagePoints[index].sqrDistance(transformedLeftPoint);
+	};
+
+	// the linear estimation of the homography is roughly as expensive as the verification of 100 correspondences
+	constexpr Scalar modelEstimationCost = Scalar(100);
+
+	SquareMatrix3 homography(false);
+	Indices32 validIndices;
+	Scalar sqrErrors = Numeric::maxValue();
+
+	if (!preemptive<SquareMatrix3, 4u, 1u>((unsigned int)(correspondences), hypothesesFunction, sqrErrorFunction, randomGenerator, 4u, maximalIterations, squarePixelErrorThreshold, progressiveSampling, modelEstimationCost, homography, validIndices, sqrErrors, worker))
+	{
+		return false;
+	}
+
+	Homography::normalizeHomography(homography);
+
+	if (refine)
+	{
+		const Vectors2 validLeftImagePoints(Subset::subset(leftImagePoints, correspondences, validIndices));
+		const Vectors2 validRightImagePoints(Subset::subset(rightImagePoints, correspondences, validIndices));
+
+		SquareMatrix3 optimizedHomography;
+		if (NonLinearOptimizationHomography::optimizeHomography<Estimator::ET_SQUARE>(homography, validLeftImagePoints.data(), validRightImagePoints.data(), validLeftImagePoints.size(), 9u, optimizedHomography, 20u))
+		{
+			homography = optimizedHomography;
+
+			if (usedIndices != nullptr)
+			{
+				validIndices.clear();
+
+				for (size_t n = 0; n < correspondences; ++n)
+				{
+					if (sqrErrorFunction(homography, Index32(n)) <= squarePixelErrorThreshold)
+					{
+						validIndices.emplace_back(Index32(n));
+					}
+				}
+			}
+		}
+	}
+
+	right_H_left = homography;
+
+	if (usedIndices != nullptr)
+	{
+		*usedIndices = std::move(validIndices);
+	}
+
+	return true;
+}
+
 bool RANSAC::projectiveReconstructionFrom6PointsIF(const ConstIndexedAccessor<Vectors2>& imagePointsPerPose, NonconstIndexedAccessor<HomogenousMatrix4>* flippedCameras_T_world, const unsigned int iterations, const Scalar squarePixelErrorThreshold, NonconstArrayAccessor<Vector3>* objectPointsIF, Indices32* usedIndices, Worker* worker)
 {
 	ocean_assert(squarePixelErrorThreshold > 0);
@@ -2616,6 +3215,19 @@ bool RANSAC::geometricTransformForNonBijectiveCorrespondences(const GeometricTra
 	return true;
 }
 
+bool RANSAC::homographyMatrixForSample(const Vector2* leftPoints, const Vector2* rightPoints, const size_t correspondences, SquareMatrix3& right_H_left)
+{
+	ocean_assert(leftPoints != nullptr && rightPoints != nullptr);
+	ocean_assert(correspondences >= 4);
+
+	if (correspondences == 4)
+	{
+		return Homography::homographyMatrixFromFourPoints(leftPoints, rightPoints, right_H_left);
+	}
+
+	return Homography::homographyMatrixDLT(leftPoints, rightPoints, correspondences, right_H_left);
+}
+
 void RANSAC::geometricTransformSubset(const GeometricTransformFunction geometricTransformFunction, const Vector2* leftImagePoints, const Vector2* rightImagePoints, const size_t correspondences, RandomGenerator* randomGenerator, SquareMatrix3* transformMatrix, const unsigned int testCandidates, const Scalar squarePixelErrorThreshold, Indices32* usedIndices, unsigned int* maxValidCandidates, Scalar* minSquareErrors, Lock* lock, const unsigned int /*firstIteration*/, const unsigned int numberIterations)
 {
 	ocean_assert(geometricTransformFunction != nullptr);
@@ -2946,6 +3558,113 @@ void RANSAC::projectiveReconstructionFrom6PointsIFSubset(const ConstIndexedAcces
 	}
 }
 
+void RANSAC::objectPointsSubset(const AnyCamera* camera, const HomogenousMatrix4* world_T_cameras, const HomogenousMatrix4* flippedCameras_T_world, const NonLinearOptimization::ObjectPointGroupsAccessor* correspondenceGroups, const unsigned int* seeds, Vector3* objectPoints, uint8_t* validObjectPoints, const unsigned int iterations, const Scalar maximalSqrError, const unsigned int minValidCorrespondences, const bool onlyFrontObjectPoint, const Estimator::EstimatorType refinementEstimator, const unsigned int firstObjectPoint, const unsigned int numberObjectPoints)
+{
+	ocean_assert(camera != nullptr && world_T_cameras != nullptr && flippedCameras_T_world != nullptr && correspondenceGroups != nullptr && seeds != nullptr);
+	ocean_assert(objectPoints != nullptr && validObjectPoints != nullptr);
+
+	Lines3 rays;
+	Indices32 poseIndices;
+	Vectors2 imagePoints;
+
+	Indices32 indices;
+	Indices32 bestIndices;
+	Indices32 bestPoseIndices;
+
+	for (unsigned int objectPointIndex = firstObjectPoint; objectPointIndex < firstObjectPoint + numberObjectPoints; ++objectPointIndex)
+	{
+		validObjectPoints[objectPointIndex] = 0u;
+
+		const size_t observations = correspondenceGroups->groupElements(objectPointIndex);
+
+		if (observations <= 1)
+		{
+			continue;
+		}
+
+		rays.resize(observations);
+		poseIndices.resize(observations);
+		imagePoints.resize(observations);
+
+		for (size_t n = 0; n < observations; ++n)
+		{
+			correspondenceGroups->element(objectPointIndex, n, poseIndices[n], imagePoints[n]);
+
+			rays[n] = camera->ray(imagePoints[n], world_T_cameras[poseIndices[n]]);
+		}
+
+		RandomGenerator randomGenerator(seeds[objectPointIndex]);
+
+		Vector3& objectPoint = objectPoints[objectPointIndex];
+
+		Scalar bestSqrError = Numeric::maxValue();
+		size_t bestNumber = min(size_t(minValidCorrespondences), observations);
+
+		bestIndices.clear();
+
+		for (unsigned int i = 0u; i < iterations; ++i)
+		{
+			unsigned int index0;
+			unsigned int index1;
+			RandomI::random(randomGenerator, (unsigned int)(observations) - 1u, index0, index1);
+
+			Vector3 candidate;
+			if (rays[index0].nearestPoint(rays[index1], candidate))
+			{
+				Scalar sqrError = 0;
+				indices.clear();
+
+				for (size_t n = 0; n < observations; ++n)
+				{
+					const HomogenousMatrix4& flippedCamera_T_world = flippedCameras_T_world[poseIndices[n]];
+
+					if (!onlyFrontObjectPoint || Camera::isObjectPointInFrontIF(flippedCamera_T_world, candidate))
+					{
+						const Scalar localSqrError = imagePoints[n].sqrDistance(camera->projectToImageIF(flippedCamera_T_world, candidate));
+
+						if (localSqrError <= maximalSqrError)
+						{
+							sqrError += localSqrError;
+							indices.emplace_back(Index32(n));
+						}
+					}
+				}
+
+				if (indices.size() > bestNumber || (indices.size() == bestNumber && sqrError < bestSqrError))
+				{
+					objectPoint = candidate;
+					bestNumber = indices.size();
+					bestSqrError = sqrError;
+					std::swap(bestIndices, indices);
+				}
+			}
+		}
+
+		if (bestSqrError == Numeric::maxValue())
+		{
+			continue;
+		}
+
+		if (refinementEstimator != Estimator::ET_INVALID)
+		{
+			bestPoseIndices.resize(bestIndices.size());
+
+			for (size_t n = 0; n < bestIndices.size(); ++n)
+			{
+				bestPoseIndices[n] = poseIndices[bestIndices[n]];
+			}
+
+			Vector3 optimizedObjectPoint;
+			if (NonLinearOptimizationObjectPoint::optimizeObjectPointForFixedPosesIF(*camera, ConstArraySubsetAccessor<HomogenousMatrix4, Index32>(flippedCameras_T_world, bestPoseIndices), objectPoint, ConstArraySubsetAccessor<Vector2, Index32>(imagePoints.data(), bestIndices), optimizedObjectPoint, 10u, refinementEstimator, Scalar(0.001), Scalar(5), onlyFrontObjectPoint))
+			{
+				objectPoint = optimizedObjectPoint;
+			}
+		}
+
+		validObjectPoints[objectPointIndex] = 1u;
+	}
+}
+
 void RANSAC::subsetIndices(Indices32& indices, const size_t subset, RandomGenerator& randomGenerator)
 {
 	ocean_assert(subset <= indices.size());
@@ -2958,6 +3677,18 @@ void RANSAC::subsetIndices(Indices32& indices, const size_t subset, RandomGenera
 	}
 }
 
+void RANSAC::subsetIndices(Indices32& indices, const size_t subset, RandomXoshiro& randomGenerator)
+{
+	ocean_assert(subset <= indices.size());
+
+	for (size_t n = 0; n < subset; ++n)
+	{
+		const size_t index = randomGenerator.random((unsigned int)(n), (unsigned int)(indices.size()) - 1u);
+
+		std::swap(indices[n], indices[index]);
+	}
+}
+
 }
 
 }
@@ -13,12 +13,16 @@
 #include "ocean/geometry/Error.h"
 #include "ocean/geometry/GravityConstraints.h"
 #include "ocean/geometry/Homography.h"
+#include "ocean/geometry/NonLinearOptimization.h"
 #include "ocean/geometry/NonLinearOptimizationHomography.h"
 
 #include "ocean/base/Accessor.h"
 #include "ocean/base/Lock.h"
 #include "ocean/base/RandomGenerator.h"
+#include "ocean/base/RandomI.h"
+#include "ocean/base/RandomXoshiro.h"
 #include "ocean/base/Subset.h"
+#include "ocean/base/Utilities.h"
 #include "ocean/base/Worker.h"
 
 #include "ocean/math/Box3.h"
@@ -51,6 +55,174 @@ class OCEAN_GEOMETRY_EXPORT RANSAC
 		 */
 		using GeometricTransformFunction = bool(*)(const Vector2*, const Vector2*, const size_t, SquareMatrix3&);
 
+		/**
+		 * This class implements the progressive sampling of PROSAC for correspondences sorted by quality (best correspondences first).
+		 * The first samples are drawn from the best correspondences only, the number of correspondences from which samples are drawn grows with each iteration until all correspondences are used.<br>
+		 * The sampler can also be used to draw uniform samples from all correspondences.
+		 */
+		class ProgressiveSampler
+		{
+			public:
+
+				/**
+				 * Creates a new sampler.
+				 * @param correspondences The number of correspondences, with range [sampleSize, infinity)
+				 * @param sampleSize The number of correspondences in each sample, with range [1, 8]
+				 * @param maximalIterations The number of iterations after which the samples are drawn from all correspondences, with range [1, infinity)
+				 * @param progressive True, to draw progressive samples; False, to draw uniform samples
+				 */
+				ProgressiveSampler(const unsigned int correspondences, const unsigned int sampleSize, const unsigned int maximalIterations, const bool progressive);
+
+				/**
+				 * Draws the next sample.
+				 * @param randomGenerator The random generator to be used
+				 * @param indices The resulting unique indices of the sample, at least 'sampleSize' elements, must be valid
+				 */
+				void sample(RandomXoshiro& randomGenerator, Index32* indices);
+
+			protected:
+
+				/// The number of correspondences.
+				unsigned int correspondences_ = 0u;
+
+				/// The number of correspondences in each sample.
+				unsigned int sampleSize_ = 0u;
+
+				/// True, to draw progressive samples.
+				bool progressive_ = false;
+
+				/// The number of samples drawn so far.
+				unsigned int iteration_ = 0u;
+
+				/// The number of best correspondences from which the current samples are drawn, with range [sampleSize, correspondences].
+				unsigned int subsetSize_ = 0u;
+
+				/// The expected number of samples drawn from the current subset in standard RANSAC, T_n in PROSAC.
+				Scalar subsetSamples_ = Scalar(0);
+
+				/// The iteration at which the subset grows, T'_n in PROSAC.
+				unsigned int subsetIteration_ = 0u;
+		};
+
+		/**
+		 * This class implements the Sequential Probability Ratio Test (SPRT) of randomized RANSAC.
+		 * The test verifies the correspondences of a model one after another and rejects the model as soon as the likelihood ratio between a bad and a good model exceeds a threshold.<br>
+		 * The threshold is determined by the ratio of the model estimation cost and the verification cost, the probabilities of the test are updated with each found model.
+		 */
+		class SequentialProbabilityRatioTest
+		{
+			public:
+
+				/**
+				 * Creates a new test object.
+				 * @param modelEstimationCost The cost for creating the models from one sample, in relation to the verification of one correspondence, with range (0, infinity)
+				 * @param modelsPerSample The average number of models created from one sample, with range (0, infinity)
+				 * @param inlierRate The initial probability that a correspondence is consistent with a good model, with range (0, 1)
+				 */
+				SequentialProbabilityRatioTest(const Scalar modelEstimationCost, const Scalar modelsPerSample, const Scalar inlierRate);
+
+				/**
+				 * Returns the factor the likelihood ratio is multiplied with for a consistent correspondence.
+				 * @return The factor, with range (0, 1]
+				 */
+				inline Scalar consistentFactor() const;
+
+				/**
+				 * Returns the factor the likelihood ratio is multiplied with for an inconsistent correspondence.
+				 * @return The factor, with range [1, infinity)
+				 */
+				inline Scalar inconsistentFactor() const;
+
+				/**
+				 * Returns the threshold for the likelihood ratio above which a model is rejected.
+				 * @return The threshold, Numeric::maxValue() if the test is disabled
+				 */
+				inline Scalar threshold() const;
+
+				/**
+				 * Updates the probability that a correspondence is consistent with a good model, e.g., after a better model has been found.
+				 * @param inlierRate The new probability, with range (0, 1]
+				 */
+				void updateInlierRate(const Scalar inlierRate);
+
+				/**
+				 * Updates the probability that a correspondence is consistent with a bad model, based on a rejected model.
+				 * @param testedCorrespondences The number of correspondences which have been tested before the model was rejected, with range [1, infinity)
+				 * @param consistentCorrespondences The number of consistent correspondences of the rejected model, with range [0, testedCorrespondences]
+				 */
+				void addRejectedModel(const unsigned int testedCorrespondences, const unsigned int consistentCorrespondences);
+
+				/**
+				 * Returns the number of iterations which are necessary to find a good model with a given probability, taking into account that a good model may be rejected by the test.
+				 * @param sampleSize The number of correspondences in each sample, with range [1, infinity)
+				 * @param maximalIterations The maximal number of iterations, with range [1, infinity)
+				 * @param successProbability The probability to find a good model, with range (0, 1)
+				 * @return The number of iterations, with range [1, maximalIterations]
+				 */
+				unsigned int iterations(const unsigned int sampleSize, const unsigned int maximalIterations, const Scalar successProbability = Scalar(0.99)) const;
+
+			protected:
+
+				/**
+				 * Updates the threshold and the factors of the likelihood ratio based on the current probabilities.
+				 */
+				void update();
+
+			protected:
+
+				/// The cost for creating the models from one sample, in relation to the verification of one correspondence.
+				Scalar modelEstimationCost_ = Scalar(0);
+
+				/// The average number of models created from one sample.
+				Scalar modelsPerSample_ = Scalar(1);
+
+				/// The probability that a correspondence is consistent with a good model (epsilon).
+				Scalar inlierRate_ = Scalar(0);
+
+				/// The probability that a correspondence is consistent with a bad model (delta).
+				Scalar badModelInlierRate_ = Scalar(0.05);
+
+				/// The sum of the consistency rates of all rejected models.
+				Scalar sumRejectedInlierRates_ = Scalar(0);
+
+				/// The number of rejected models.
+				unsigned int rejectedModels_ = 0u;
+
+				/// The factor for consistent correspondences, delta / epsilon.
+				Scalar consistentFactor_ = Scalar(1);
+
+				/// The factor for inconsistent correspondences, (1 - delta) / (1 - epsilon).
+				Scalar inconsistentFactor_ = Scalar(1);
+
+				/// The threshold for the likelihood ratio, Numeric::maxValue() if the test is disabled.
+				Scalar threshold_ = Numeric::maxValue();
+		};
+
+		/**
+		 * This class holds the best model verified by one thread within one batch of a preemptive RANSAC, and the statistics of the rejected models.
+		 * @tparam TModel The data type of the model
+		 */
+		template <typename TModel>
+		class PreemptiveHypothesis
+		{
+			public:
+
+				/// The best model.
+				TModel model_;
+
+				/// The indices of the valid correspondences of the best model.
+				Indices32 validIndices_;
+
+				/// The sum of square errors of all valid correspondences of the best model.
+				Scalar sqrErrors_ = Numeric::maxValue();
+
+				/// The number of correspondences which have been tested for each rejected model.
+				Indices32 rejectedTestedCorrespondences_;
+
+				/// The number of consistent correspondences for each rejected model.
+				Indices32 rejectedConsistentCorrespondences_;
+		};
+
 	public:
 
 		/**
@@ -82,6 +254,48 @@ class OCEAN_GEOMETRY_EXPORT RANSAC
 		 */
 		static bool p3p(const AnyCamera& anyCamera, const ConstIndexedAccessor<Vector3>& objectPointAccessor, const ConstIndexedAccessor<Vector2>& imagePointAccessor, RandomGenerator& randomGenerator, HomogenousMatrix4& world_T_camera, const unsigned int minimalValidCorrespondences = 5u, const bool refine = true, const unsigned int iterations = 20u, const Scalar sqrPixelErrorThreshold = Scalar(5 * 5), Indices32* usedIndices = nullptr, Scalar* sqrAccuracy = nullptr, const GravityConstraints* gravityConstraints = nullptr);
 
+		/**
+		 * Determines the number of valid correspondences and the sum of their square pixel errors for several camera poses at once.
+		 * The correspondences are processed in blocks so that each block is projected with one batched camera call per pose (instead of one call per correspondence).<br>
+		 * Poses which cannot reach the minimal number of valid correspondences anymore are not scored any further.
+		 * @param anyCamera The camera profile to be used, must be valid
+		 * @param flippedCameras_T_world The inverted and flipped camera poses to be scored, must be valid
+		 * @param numberPoses The number of given camera poses, with range [1, infinity)
+		 * @param objectPoints The 3D object points, must be valid
+		 * @param imagePoints The 2D image points, one for each object point, must be valid
+		 * @param correspondences The number of point correspondences, with range [1, infinity)
+		 * @param sqrPixelErrorThreshold The maximal square pixel error of a valid correspondence, with range [0, infinity)
+		 * @param minimalValidCorrespondences The minimal number of valid correspondences a pose needs to be scored entirely, with range [0, correspondences]
+		 * @param validCorrespondences The resulting numbers of valid correspondences, one for each pose, a pose not scored entirely receives a value below minimalValidCorrespondences
+		 * @param sqrErrors The resulting sums of square pixel errors of all valid correspondences, one for each pose
+		 * @see p3p().
+		 */
+		static void scorePosesIF(const AnyCamera& anyCamera, const HomogenousMatrix4* flippedCameras_T_world, const size_t numberPoses, const Vector3* objectPoints, const Vector2* imagePoints, const size_t correspondences, const Scalar sqrPixelErrorThreshold, const size_t minimalValidCorrespondences, unsigned int* validCorrespondences, Scalar* sqrErrors);
+
+		/**
+		 * Calculates a pose using the perspective pose problem with three point correspondences using any camera, with a preemptive RANSAC.
+		 * In contrast to p3p(), each pose candidate is verified with a Sequential Probability Ratio Test so that bad candidates are rejected after a few correspondences already.<br>
+		 * The number of iterations adapts to the inlier rate of the best pose, so that usually significantly fewer iterations than 'maximalIterations' are applied.<br>
+		 * If the correspondences are sorted by quality (e.g., by descriptor distance, best first), progressive sampling (PROSAC) creates the first candidates from the best correspondences.
+		 * @param anyCamera The camera object specifying the projection, must be valid
+		 * @param objectPointAccessor The accessor providing the 3D object points, at least 4
+		 * @param imagePointAccessor The accessor providing the 2D image points, one image point for each object point
+		 * @param randomGenerator A random generator to be used
+		 * @param world_T_camera The resulting pose transforming camera points to world points
+		 * @param minimalValidCorrespondences Minimal number of valid correspondences, with range [4, objectPointAccessor.size()]
+		 * @param refine Determines whether a not linear least square algorithm is used to increase the pose accuracy after the RANSAC step
+		 * @param maximalIterations Number of maximal RANSAC iterations, with range [1, infinity)
+		 * @param sqrPixelErrorThreshold Square pixel error threshold for valid RANSAC candidates, with range (0, infinity)
+		 * @param progressiveSampling True, if the correspondences are sorted by quality (best first) so that progressive sampling can be applied; False, to sample all correspondences uniformly
+		 * @param usedIndices Optional vector receiving the indices of all valid correspondences
+		 * @param sqrAccuracy Optional resulting average square pixel error
+		 * @param gravityConstraints Optional gravity constraints to guide the pose estimation, nullptr otherwise
+		 * @param worker Optional worker object to create and verify several pose candidates concurrently
+		 * @return True, if succeeded
+		 * @see p3p().
+		 */
+		static bool p3pPreemptive(const AnyCamera& anyCamera, const ConstIndexedAccessor<Vector3>& objectPointAccessor, const ConstIndexedAccessor<Vector2>& imagePointAccessor, RandomGenerator& randomGenerator, HomogenousMatrix4& world_T_camera, const unsigned int minimalValidCorrespondences = 5u, const bool refine = true, const unsigned int maximalIterations = 200u, const Scalar sqrPixelErrorThreshold = Scalar(5 * 5), const bool progressiveSampling = false, Indices32* usedIndices = nullptr, Scalar* sqrAccuracy = nullptr, const GravityConstraints* gravityConstraints = nullptr, Worker* worker = nullptr);
+
 		/**
 		 * Deprecated.
 		 *
@@ -301,6 +515,28 @@ class OCEAN_GEOMETRY_EXPORT RANSAC
 		 */
 		static bool objectPoint(const ConstIndexedAccessor<const AnyCamera*>& cameras, const ConstIndexedAccessor<HomogenousMatrix4>& world_T_cameras, const ConstIndexedAccessor<Vector2>& imagePoints, RandomGenerator& randomGenerator, Vector3& objectPoint, const unsigned int iterations = 20u, const Scalar maximalSqrError = Scalar(3 * 3), const unsigned int minValidCorrespondences = 2u, const bool onlyFrontObjectPoint = true, const Estimator::EstimatorType refinementEstimator = Estimator::ET_SQUARE, Scalar* finalRobustError = nullptr, Indices32* usedIndices = nullptr);
 
+		/**
+		 * Determines the 3D object points for several groups of image points, each group observing one object point under individual camera poses (with rotational and translational camera motion).
+		 * All object points share the same set of camera poses, each object point is observed in an arbitrary subset of these poses.<br>
+		 * The result for each object point is identical to the result of objectPoint(), however the shared camera poses are inverted and flipped only once, and the object points are distributed over the worker.<br>
+		 * Each object point uses an individual random generator seeded by the given random generator, so that the results do not depend on the given worker.
+		 * @param camera The camera profile for all camera frames and poses, must be valid
+		 * @param world_T_cameras The camera poses shared by all object points, with default camera pointing towards the negative z-space with y-axis upwards, at least two
+		 * @param correspondenceGroups The groups of correspondences between pose indices and image points, one group for each object point
+		 * @param randomGenerator Random generator object to be used for creating random numbers
+		 * @param objectPoints The resulting 3D object points, one for each group, defined in world, must be valid
+		 * @param validObjectPoints The resulting states whether the individual object points could be determined (1) or not (0), one for each group, must be valid
+		 * @param iterations Number of RANSAC iterations for each object point, with range [1, infinity)
+		 * @param maximalSqrError The maximal square pixel error between a projected object point and an image point, with range [0, infinity)
+		 * @param minValidCorrespondences The minimal number of image points that have a projected pixel error smaller than 'maximalError', with range [2, infinity)
+		 * @param onlyFrontObjectPoint True, if the resulting object points must lie in front of the cameras
+		 * @param refinementEstimator An robust estimator to invoke an optimization step to increase the accuracy of the resulting positions, ET_INVALID to avoid the refinement
+		 * @param worker Optional worker object to distribute the computation
+		 * @return The number of object points which could be determined
+		 * @see objectPoint().
+		 */
+		static size_t objectPoints(const AnyCamera& camera, const ConstIndexedAccessor<HomogenousMatrix4>& world_T_cameras, const NonLinearOptimization::ObjectPointGroupsAccessor& correspondenceGroups, RandomGenerator& randomGenerator, Vector3* objectPoints, uint8_t* validObjectPoints, const unsigned int iterations = 20u, const Scalar maximalSqrError = Scalar(3 * 3), const unsigned int minValidCorrespondences = 2u, const bool onlyFrontObjectPoint = true, const Estimator::EstimatorType refinementEstimator = Estimator::ET_SQUARE, Worker* worker = nullptr);
+
 		/**
 		 * Determines the 3D object point for a set of image points observing the same object point under individual camera poses (with rotational camera motion only).
 		 * The center position of each camera is located at the origin of the coordinate system.
@@ -369,6 +605,24 @@ class OCEAN_GEOMETRY_EXPORT RANSAC
 		 */
 		static bool fundamentalMatrix(const Vector2* leftImagePoints, const Vector2* rightImagePoints, const size_t correspondences, RandomGenerator& randomGenerator, SquareMatrix3& right_F_left, const size_t testCandidates = 8, const unsigned int iterations = 20u, const Scalar maxScalarProduct = Scalar(0.001), Indices32* usedIndices = nullptr);
 
+		/**
+		 * Determines the fundamental matrix for given image point correspondences for two stereo images, with a preemptive RANSAC.
+		 * In contrast to fundamentalMatrix(), each candidate is verified with a Sequential Probability Ratio Test so that bad candidates are rejected early, and the number of iterations adapts to the inlier rate of the best candidate.
+		 * @param leftImagePoints The left image points, at least 8, must be valid
+		 * @param rightImagePoints The right image points, one for each left image point, must be valid
+		 * @param correspondences The number of point correspondences, with range [8, infinity)
+		 * @param randomGenerator Random generator object to be used for creating random numbers
+		 * @param right_F_left The resulting fundamental matrix
+		 * @param maximalIterations The maximal number of RANSAC iterations, with range [1, infinity)
+		 * @param maxScalarProduct The maximal scalar product for valid point correspondences, with range [0, infinity)
+		 * @param progressiveSampling True, if the correspondences are sorted by quality (best first) so that progressive sampling can be applied; False, to sample all correspondences uniformly
+		 * @param usedIndices Optional resulting indices of the used point correspondences, nullptr if not of interest
+		 * @param worker Optional worker object to create and verify several candidates concurrently
+		 * @return True, if succeeded
+		 * @see fundamentalMatrix().
+		 */
+		static bool fundamentalMatrixPreemptive(const Vector2* leftImagePoints, const Vector2* rightImagePoints, const size_t correspondences, RandomGenerator& randomGenerator, SquareMatrix3& right_F_left, const unsigned int maximalIterations = 200u, const Scalar maxScalarProduct = Scalar(0.001), const bool progressiveSampling = false, Indices32* usedIndices = nullptr, Worker* worker = nullptr);
+
 		/**
 		 * Calculates the transformation between left and right camera by given point correspondences for two stereo images.
 		 * The transformation can be determined up to a scale factor for the translation vector.<br>
@@ -407,7 +661,7 @@ class OCEAN_GEOMETRY_EXPORT RANSAC
 		 * @param squarePixelErrorThreshold Maximal square pixel error between a right point and a transformed left point so that a point correspondence counts as valid, with range (0, infinity)
 		 * @param usedIndices Optional vector which will receive the indices of the used image correspondences, if defined
 		 * @param worker Optional worker object to distribute the computation
-		 * @param useSVD True, to use the slower SVD approach (i.e., Homography::homographyMatrixSVD); False, to use the two-step approach (i.e., Homography::homographyMatrixLinearWithOptimizations)
+		 * @param useSVD True, to use the slower SVD approach (i.e., the normalized direct linear transformation as in Homography::homographyMatrixSVD); False, to use the two-step approach (i.e., Homography::homographyMatrixLinearWithOptimizations)
 		 * @return True, if succeeded
 		 * @see homographyMatrix<tRefine, tUseSVD>(), Geometry::Homography::homographyMatrix(), homographyMatrixForNonBijectiveCorrespondences().
 		 */
@@ -432,7 +686,7 @@ class OCEAN_GEOMETRY_EXPORT RANSAC
 		 * @param squarePixelErrorThreshold Maximal square pixel error between a right point and a transformed left point so that a point correspondence counts as valid, with range (0, infinity)
 		 * @param usedIndices Optional vector which will receive the indices of the used image correspondences, if defined
 		 * @param worker Optional worker object to distribute the computation
-		 * @param useSVD True, to use the slower SVD approach (i.e., Homography::homographyMatrixSVD); False, to use the two-step approach (i.e., Homography::homographyMatrixLinearWithOptimizations)
+		 * @param useSVD True, to use the slower SVD approach (i.e., the normalized direct linear transformation as in Homography::homographyMatrixSVD); False, to use the two-step approach (i.e., Homography::homographyMatrixLinearWithOptimizations)
 		 * @return True, if succeeded
 		 * @see homographyMatrixForNonBijectiveCorrespondences<tRefine, tUseSVD>(), homographyMatrix().
 		 */
@@ -455,7 +709,7 @@ class OCEAN_GEOMETRY_EXPORT RANSAC
 		 * @param worker Optional worker object to distribute the computation
 		 * @return True, if succeeded
 		 * @tparam tRefine True, to apply a non-linear least square optimization to increase the transformation accuracy after the RANSAC step
-		 * @tparam tUseSVD True, to use the slower SVD approach (i.e., Homography::homographyMatrixSVD); False, to use the two-step approach (i.e., Homography::homographyMatrixLinearWithOptimizations)
+		 * @tparam tUseSVD True, to use the slower SVD approach (i.e., the normalized direct linear transformation as in Homography::homographyMatrixSVD); False, to use the two-step approach (i.e., Homography::homographyMatrixLinearWithOptimizations)
 		 * @see homographyMatrix(), Geometry::Homography::homographyMatrix().
 		 */
 		template <bool tRefine, bool tUseSVD>
@@ -481,12 +735,32 @@ class OCEAN_GEOMETRY_EXPORT RANSAC
 		 * @param worker Optional worker object to distribute the computation
 		 * @return True, if succeeded
 		 * @tparam tRefine True, to apply a non-linear least square optimization to increase the transformation accuracy after the RANSAC step
-		 * @tparam tUseSVD True, to use the slower SVD approach (i.e., Homography::homographyMatrixSVD); False, to use the two-step approach (i.e., Homography::homographyMatrixLinearWithOptimizations)
+		 * @tparam tUseSVD True, to use the slower SVD approach (i.e., the normalized direct linear transformation as in Homography::homographyMatrixSVD); False, to use the two-step approach (i.e., Homography::homographyMatrixLinearWithOptimizations)
 		 * @see homographyMatrixForNonBijectiveCorrespondences().
 		 */
 		template <bool tRefine, bool tUseSVD>
 		static bool homographyMatrixForNonBijectiveCorrespondences(const Vector2* leftImagePoints, const size_t numberLeftImagePoints, const Vector2* rightImagePoints, const size_t numberRightImagePoints, const IndexPair32* correspondences, const size_t numberCorrespondences, RandomGenerator& randomGenerator, SquareMatrix3& right_H_left, const unsigned int testCandidates = 8u, const unsigned int iterations = 20u, const Scalar squarePixelErrorThreshold = Scalar(9), Indices32* usedIndices = nullptr, Worker* worker = nullptr);
 
+		/**
+		 * Calculates the homography between two images transforming the given image points between two images, with a preemptive RANSAC.
+		 * In contrast to homographyMatrix(), the candidates are determined from minimal samples with four correspondences, each candidate is verified with a Sequential Probability Ratio Test so that bad candidates are rejected early, and the number of iterations adapts to the inlier rate of the best candidate.<br>
+		 * This function needs bijective correspondences, the resulting homography transforms left image points to right image points (rightPoint = H * leftPoint).
+		 * @param leftImagePoints Image points in the left camera, each point corresponds to one point in the right image, must be valid
+		 * @param rightImagePoints Image points in the right camera, one for each point in the left frame, must be valid
+		 * @param correspondences Number of points correspondences, with range [4, infinity)
+		 * @param randomGenerator Random generator object to be used for creating random numbers
+		 * @param right_H_left Resulting homography for the given image points
+		 * @param refine True, to apply a non-linear least square optimization to increase the transformation accuracy after the RANSAC step
+		 * @param maximalIterations The maximal number of RANSAC iterations, with range [1, infinity)
+		 * @param squarePixelErrorThreshold Maximal square pixel error between a right point and a transformed left point so that a point correspondence counts as valid, with range (0, infinity)
+		 * @param progressiveSampling True, if the correspondences are sorted by quality (best first) so that progressive sampling can be applied; False, to sample all correspondences uniformly
+		 * @param usedIndices Optional vector which will receive the indices of the used image correspondences, if defined
+		 * @param worker Optional worker object to create and verify several candidates concurrently
+		 * @return True, if succeeded
+		 * @see homographyMatrix().
+		 */
+		static bool homographyMatrixPreemptive(const Vector2* leftImagePoints, const Vector2* rightImagePoints, const size_t correspondences, RandomGenerator& randomGenerator, SquareMatrix3& right_H_left, const bool refine = true, const unsigned int maximalIterations = 200u, const Scalar squarePixelErrorThreshold = Scalar(9), const bool progressiveSampling = false, Indices32* usedIndices = nullptr, Worker* worker = nullptr);
+
 		/**
 		 * Calculates four homographies between two images transforming the given image points between two images.
 		 * The resulting homographies transforms image points defined in the left image to image points defined in the right image (rightPoint = H[i] * leftPoint).<br>
@@ -706,6 +980,18 @@ class OCEAN_GEOMETRY_EXPORT RANSAC
 		 */
 		static bool geometricTransformForNonBijectiveCorrespondences(const GeometricTransformFunction geometricTransformFunction, const Vector2* leftImagePoints, const size_t numberLeftImagePoints, const Vector2* rightImagePoints, const size_t numberRightImagePoints, const IndexPair32* correspondences, const size_t numberCorrespondences, RandomGenerator& randomGenerator, SquareMatrix3& transformMatrix, const unsigned int testCandidates, const unsigned int iterations, const Scalar squarePixelErrorThreshold, Indices32* usedIndices, Worker* worker);
 
+		/**
+		 * Determines the homography for a sample of point correspondences without allocating memory.
+		 * Samples with four correspondences are solved with the closed-form solution, larger samples with the normalized direct linear transformation.
+		 * @param leftPoints The image points in the left image, must be valid
+		 * @param rightPoints The image points in the right image, one for each point in the left image, must be valid
+		 * @param correspondences The number of point correspondences, with range [4, infinity)
+		 * @param right_H_left The resulting homography transforming left to right image points
+		 * @return True, if succeeded
+		 * @see Homography::homographyMatrixFromFourPoints(), Homography::homographyMatrixDLT().
+		 */
+		static bool homographyMatrixForSample(const Vector2* leftPoints, const Vector2* rightPoints, const size_t correspondences, SquareMatrix3& right_H_left);
+
 		/**
 		 * Internal function to calculate the geometry transformation between two images transforming the projected planar object points between the two images.
 		 * The resulting homography transforms image points defined in the left image to image points defined in the right image (rightPoint = M * leftPoint).
@@ -766,6 +1052,75 @@ class OCEAN_GEOMETRY_EXPORT RANSAC
 		 */
 		static void projectiveReconstructionFrom6PointsIFSubset(const ConstIndexedAccessor<Vectors2>* imagePointsPerPose, const size_t views, RandomGenerator* randomGenerator, NonconstIndexedAccessor<HomogenousMatrix4>* flippedCameras_T_world, const Scalar squarePixelErrorThreshold, NonconstArrayAccessor<Vector3>* objectPointsIF, Indices32* usedIndices, Scalar* minSquareErrors, Lock* lock, const unsigned int firstIteration, const unsigned int numberIterations);
 
+		/**
+		 * Determines the 3D object points for a subset of groups of image points.
+		 * @param camera The camera profile for all camera frames and poses, must be valid
+		 * @param world_T_cameras The camera poses shared by all object points, must be valid
+		 * @param flippedCameras_T_world The inverted and flipped camera poses, one for each camera pose, must be valid
+		 * @param correspondenceGroups The groups of correspondences between pose indices and image points, one group for each object point, must be valid
+		 * @param seeds The seeds of the random generators, one for each object point, must be valid
+		 * @param objectPoints The resulting 3D object points, must be valid
+		 * @param validObjectPoints The resulting states whether the individual object points could be determined, must be valid
+		 * @param iterations Number of RANSAC iterations for each object point, with range [1, infinity)
+		 * @param maximalSqrError The maximal square pixel error between a projected object point and an image point, with range [0, infinity)
+		 * @param minValidCorrespondences The minimal number of image points that have a projected pixel error smaller than 'maximalError', with range [2, infinity)
+		 * @param onlyFrontObjectPoint True, if the resulting object points must lie in front of the cameras
+		 * @param refinementEstimator An robust estimator to invoke an optimization step, ET_INVALID to avoid the refinement
+		 * @param firstObjectPoint The first object point to be handled
+		 * @param numberObjectPoints The number of object points to be handled
+		 * @see objectPoints().
+		 */
+		static void objectPointsSubset(const AnyCamera* camera, const HomogenousMatrix4* world_T_cameras, const HomogenousMatrix4* flippedCameras_T_world, const NonLinearOptimization::ObjectPointGroupsAccessor* correspondenceGroups, const unsigned int* seeds, Vector3* objectPoints, uint8_t* validObjectPoints, const unsigned int iterations, const Scalar maximalSqrError, const unsigned int minValidCorrespondences, const bool onlyFrontObjectPoint, const Estimator::EstimatorType refinementEstimator, const unsigned int firstObjectPoint, const unsigned int numberObjectPoints);
+
+		/**
+		 * Determines the best model for a set of correspondences with a preemptive RANSAC.
+		 * The models are created from (progressive) samples, verified in random order with a Sequential Probability Ratio Test, and the number of iterations adapts to the best model.<br>
+		 * With a worker, the samples are processed in batches and the models of one batch are created and verified concurrently.
+		 * @param correspondences The number of correspondences, with range [tSampleSize, infinity)
+		 * @param hypothesesFunction The function creating models from one sample, with signature 'unsigned int (const Index32* sampleIndices, TModel* models)' returning the number of models, with range [0, tMaximalModels]
+		 * @param sqrErrorFunction The function determining the square error of one correspondence for a model, with signature 'Scalar (const TModel& model, const Index32 index)', Numeric::maxValue() for invalid correspondences
+		 * @param randomGenerator The random generator to be used
+		 * @param minimalValidCorrespondences The minimal number of valid correspondences of the resulting model, with range [tSampleSize, correspondences]
+		 * @param maximalIterations The maximal number of iterations, with range [1, infinity)
+		 * @param sqrErrorThreshold The maximal square error of valid correspondences, with range [0, infinity)
+		 * @param progressiveSampling True, to apply progressive sampling for correspondences sorted by quality; False, to apply uniform sampling
+		 * @param modelEstimationCost The cost for creating the models from one sample, in relation to the verification of one correspondence, with range (0, infinity)
+		 * @param model The resulting best model
+		 * @param validIndices The resulting indices of the valid correspondences of the best model
+		 * @param sqrErrors The resulting sum of square errors of the valid correspondences of the best model
+		 * @param worker Optional worker object to distribute the computation
+		 * @return True, if a model with enough valid correspondences could be found
+		 * @tparam TModel The data type of the model
+		 * @tparam tSampleSize The number of correspondences in each sample, with range [1, 8]
+		 * @tparam tMaximalModels The maximal number of models for one sample, with range [1, infinity)
+		 * @tparam THypothesesFunction The data type of the function creating models
+		 * @tparam TSqrErrorFunction The data type of the function determining square errors
+		 */
+		template <typename TModel, unsigned int tSampleSize, unsigned int tMaximalModels, typename THypothesesFunction, typename TSqrErrorFunction>
+		static bool preemptive(const unsigned int correspondences, const THypothesesFunction& hypothesesFunction, const TSqrErrorFunction& sqrErrorFunction, RandomGenerator& randomGenerator, const unsigned int minimalValidCorrespondences, const unsigned int maximalIterations, const Scalar sqrErrorThreshold, const bool progressiveSampling, const Scalar modelEstimationCost, TModel& model, Indices32& validIndices, Scalar& sqrErrors, Worker* worker);
+
+		/**
+		 * Creates and verifies the models of a subset of samples of one batch of a preemptive RANSAC.
+		 * @param hypothesesFunction The function creating models from one sample, must be valid
+		 * @param sqrErrorFunction The function determining the square error of one correspondence for a model, must be valid
+		 * @param sequentialProbabilityRatioTest The test to be used to reject bad models, must be valid
+		 * @param verificationOrder The random order in which the correspondences are verified, one for each correspondence, must be valid
+		 * @param correspondences The number of correspondences, with range [tSampleSize, infinity)
+		 * @param samples The indices of all samples of the batch, 'tSampleSize' indices for each sample, must be valid
+		 * @param sqrErrorThreshold The maximal square error of valid correspondences, with range [0, infinity)
+		 * @param bestValidCorrespondences The number of valid correspondences of the best model found before the batch
+		 * @param hypotheses The resulting hypotheses, one for each sample of the batch, must be valid
+		 * @param firstSample The first sample to be handled
+		 * @param numberSamples The number of samples to be handled
+		 * @tparam TModel The data type of the model
+		 * @tparam tSampleSize The number of correspondences in each sample, with range [1, 8]
+		 * @tparam tMaximalModels The maximal number of models for one sample, with range [1, infinity)
+		 * @tparam THypothesesFunction The data type of the function creating models
+		 * @tparam TSqrErrorFunction The data type of the function determining square errors
+		 */
+		template <typename TModel, unsigned int tSampleSize, unsigned int tMaximalModels, typename THypothesesFunction, typename TSqrErrorFunction>
+		static void preemptiveSubset(const THypothesesFunction* hypothesesFunction, const TSqrErrorFunction* sqrErrorFunction, const SequentialProbabilityRatioTest* sequentialProbabilityRatioTest, const Index32* verificationOrder, const unsigned int correspondences, const Index32* samples, const Scalar sqrErrorThreshold, const unsigned int bestValidCorrespondences, PreemptiveHypothesis<TModel>* hypotheses, const unsigned int firstSample, const unsigned int numberSamples);
+
 		/**
 		 * Selects random indices from a given vector of indices.
 		 * The selected indicies will be placed at the beginning of the vector.<br>
@@ -775,8 +1130,231 @@ class OCEAN_GEOMETRY_EXPORT RANSAC
 		 * @param randomGenerator The random generator to be used
 		 */
 		static void subsetIndices(Indices32& indices, const size_t subset, RandomGenerator& randomGenerator);
+
+		/**
+		 * Selects random indices from a given vector of indices by application of a fast random generator.
+		 * The selected indicies will be placed at the beginning of the vector.<br>
+		 * The index vector does not loose any index, and can be reused.
+		 * @param indices The vector of indices from which random indices will be selected, the selected indices will be placed at the beginning of the vector
+		 * @param subset The number of random indices to be selected, with range [1, indices.size()]
+		 * @param randomGenerator The random generator to be used
+		 */
+		static void subsetIndices(Indices32& indices, const size_t subset, RandomXoshiro& randomGenerator);
 };
 
+inline Scalar RANSAC::SequentialProbabilityRatioTest::consistentFactor() const
+{
+	return consistentFactor_;
+}
+
+inline Scalar RANSAC::SequentialProbabilityRatioTest::inconsistentFactor() const
+{
+	return inconsistentFactor_;
+}
+
+inline Scalar RANSAC::SequentialProbabilityRatioTest::threshold() const
+{
+	return threshold_;
+}
+
+template <typename TModel, unsigned int tSampleSize, unsigned int tMaximalModels, typename THypothesesFunction, typename TSqrErrorFunction>
+bool RANSAC::preemptive(const unsigned int correspondences, const THypothesesFunction& hypothesesFunction, const TSqrErrorFunction& sqrErrorFunction, RandomGenerator& randomGenerator, const unsigned int minimalValidCorrespondences, const unsigned int maximalIterations, const Scalar sqrErrorThreshold, const bool progressiveSampling, const Scalar modelEstimationCost, TModel& model, Indices32& validIndices, Scalar& sqrErrors, Worker* worker)
+{
+	static_assert(tSampleSize >= 1u && tSampleSize <= 8u, "Invalid sample size!");
+	static_assert(tMaximalModels >= 1u, "Invalid number of models!");
+
+	ocean_assert(correspondences >= tSampleSize);
+	ocean_assert(minimalValidCorrespondences >= tSampleSize && minimalValidCorrespondences <= correspondences);
+	ocean_assert(maximalIterations >= 1u);
+	ocean_assert(sqrErrorThreshold >= 0);
+	ocean_assert(modelEstimationCost > 0);
+
+	if (correspondences < tSampleSize || correspondences < minimalValidCorrespondences || maximalIterations == 0u)
+	{
+		return false;
+	}
+
+	// all random numbers are drawn from one fast generator, seeded by the given random generator
+	RandomXoshiro samplingGenerator(randomGenerator);
+
+	// the correspondences are verified in a random order so that the early rejection of a model does not depend on the order of the correspondences (e.g., sorted by quality)
+	Indices32 verificationOrder = createIndices(correspondences, 0u);
+
+	for (unsigned int n = correspondences - 1u; n >= 1u; --n)
+	{
+		std::swap(verificationOrder[n], verificationOrder[samplingGenerator.random(n)]);
+	}
+
+	ProgressiveSampler progressiveSampler(correspondences, tSampleSize, maximalIterations, progressiveSampling);
+
+	// the test is disabled until a model with more valid correspondences than expected for a bad model has been found
+	SequentialProbabilityRatioTest sequentialProbabilityRatioTest(modelEstimationCost, Scalar(tMaximalModels + 1u) * Scalar(0.5), Scalar(minimalValidCorrespondences) / Scalar(correspondences));
+
+	const unsigned int batchSize = worker != nullptr ? std::max(1u, worker->threads() * 2u) : 1u;
+
+	Indices32 samples(batchSize * tSampleSize);
+	std::vector<PreemptiveHypothesis<TModel>> hypotheses(batchSize);
+
+	validIndices.clear();
+	sqrErrors = Numeric::maxValue();
+
+	unsigned int adaptiveIterations = maximalIterations;
+
+	for (unsigned int iteration = 0u; iteration < adaptiveIterations; /* noop */)
+	{
+		const unsigned int batchSamples = std::min(batchSize, adaptiveIterations - iteration);
+
+		// the samples are drawn sequentially so that the result does not depend on the number of threads
+		for (unsigned int n = 0u; n < batchSamples; ++n)
+		{
+			progressiveSampler.sample(samplingGenerator, samples.data() + n * tSampleSize);
+
+			hypotheses[n].validIndices_.clear();
+			hypotheses[n].sqrErrors_ = Numeric::maxValue();
+			hypotheses[n].rejectedTestedCorrespondences_.clear();
+			hypotheses[n].rejectedConsistentCorrespondences_.clear();
+		}
+
+		const unsigned int bestValidCorrespondences = (unsigned int)(validIndices.size());
+
+		if (worker != nullptr && batchSamples > 1u)
+		{
+			worker->executeFunction(Worker::Function::createStatic(&RANSAC::preemptiveSubset<TModel, tSampleSize, tMaximalModels, THypothesesFunction, TSqrErrorFunction>, &hypothesesFunction, &sqrErrorFunction, (const SequentialProbabilityRatioTest*)(&sequentialProbabilityRatioTest), (const Index32*)(verificationOrder.data()), correspondences, (const Index32*)(samples.data()), sqrErrorThreshold, bestValidCorrespondences, hypotheses.data(), 0u, 0u), 0u, batchSamples);
+		}
+		else
+		{
+			preemptiveSubset<TModel, tSampleSize, tMaximalModels, THypothesesFunction, TSqrErrorFunction>(&hypothesesFunction, &sqrErrorFunction, &sequentialProbabilityRatioTest, verificationOrder.data(), correspondences, samples.data(), sqrErrorThreshold, bestValidCorrespondences, hypotheses.data(), 0u, batchSamples);
+		}
+
+		iteration += batchSamples;
+
+		bool improved = false;
+
+		for (unsigned int n = 0u; n < batchSamples; ++n)
+		{
+			PreemptiveHypothesis<TModel>& hypothesis = hypotheses[n];
+
+			ocean_assert(hypothesis.rejectedTestedCorrespondences_.size() == hypothesis.rejectedConsistentCorrespondences_.size());
+			for (size_t r = 0; r < hypothesis.rejectedTestedCorrespondences_.size(); ++r)
+			{
+				sequentialProbabilityRatioTest.addRejectedModel(hypothesis.rejectedTestedCorrespondences_[r], hypothesis.rejectedConsistentCorrespondences_[r]);
+			}
+
+			if (hypothesis.validIndices_.size() >= minimalValidCorrespondences)
+			{
+				if (hypothesis.validIndices_.size() > validIndices.size() || (hypothesis.validIndices_.size() == validIndices.size() && hypothesis.sqrErrors_ < sqrErrors))
+				{
+					model = hypothesis.model_;
+					std::swap(validIndices, hypothesis.validIndices_);
+					sqrErrors = hypothesis.sqrErrors_;
+
+					improved = true;
+				}
+			}
+		}
+
+		if (improved)
+		{
+			sequentialProbabilityRatioTest.updateInlierRate(Scalar(validIndices.size()) / Scalar(correspondences));
+		}
+
+		if (!validIndices.empty())
+		{
+			// due to numerical stability, we ensure that we always apply at least 4 iterations
+			adaptiveIterations = std::max(std::min(4u, maximalIterations), sequentialProbabilityRatioTest.iterations(tSampleSize, maximalIterations));
+		}
+	}
+
+	if (validIndices.size() < minimalValidCorrespondences)
+	{
+		return false;
+	}
+
+	std::sort(validIndices.begin(), validIndices.end());
+
+	return true;
+}
+
+template <typename TModel, unsigned int tSampleSize, unsigned int tMaximalModels, typename THypothesesFunction, typename TSqrErrorFunction>
+void RANSAC::preemptiveSubset(const THypothesesFunction* hypothesesFunction, const TSqrErrorFunction* sqrErrorFunction, const SequentialProbabilityRatioTest* sequentialProbabilityRatioTest, const Index32* verificationOrder, const unsigned int correspondences, const Index32* samples, const Scalar sqrErrorThreshold, const unsigned int bestValidCorrespondences, PreemptiveHypothesis<TModel>* hypotheses, const unsigned int firstSample, const unsigned int numberSamples)
+{
+	ocean_assert(hypothesesFunction != nullptr && sqrErrorFunction != nullptr && sequentialProbabilityRatioTest != nullptr);
+	ocean_assert(verificationOrder != nullptr && samples != nullptr && hypotheses != nullptr);
+
+	const Scalar consistentFactor = sequentialProbabilityRatioTest->consistentFactor();
+	const Scalar inconsistentFactor = sequentialProbabilityRatioTest->inconsistentFactor();
+	const Scalar threshold = sequentialProbabilityRatioTest->threshold();
+
+	TModel models[tMaximalModels];
+
+	Indices32 candidateIndices;
+	candidateIndices.reserve(correspondences);
+
+	for (unsigned int sampleIndex = firstSample; sampleIndex < firstSample + numberSamples; ++sampleIndex)
+	{
+		PreemptiveHypothesis<TModel>& hypothesis = hypotheses[sampleIndex];
+
+		const unsigned int numberModels = (*hypothesesFunction)(samples + sampleIndex * tSampleSize, models);
+		ocean_assert(numberModels <= tMaximalModels);
+
+		for (unsigned int m = 0u; m < numberModels; ++m)
+		{
+			const TModel& candidateModel = models[m];
+
+			const size_t bestCorrespondences = std::max(size_t(bestValidCorrespondences), hypothesis.validIndices_.size());
+
+			candidateIndices.clear();
+			Scalar candidateSqrErrors = 0;
+
+			Scalar likelihoodRatio = 1;
+			bool rejected = false;
+
+			unsigned int n = 0u;
+
+			// we can stop as soon as the model is rejected by the test, or if the model cannot be better than the best model anymore
+			while (n < correspondences && candidateIndices.size() + (correspondences - n) >= bestCorrespondences)
+			{
+				const Index32 index = verificationOrder[n++];
+
+				const Scalar sqrError = (*sqrErrorFunction)(candidateModel, index);
+
+				if (sqrError <= sqrErrorThreshold)
+				{
+					candidateIndices.push_back(index);
+					candidateSqrErrors += sqrError;
+
+					likelihoodRatio *= consistentFactor;
+				}
+				else
+				{
+					likelihoodRatio *= inconsistentFactor;
+				}
+
+				if (likelihoodRatio > threshold)
+				{
+					rejected = true;
+					break;
+				}
+			}
+
+			if (rejected)
+			{
+				hypothesis.rejectedTestedCorrespondences_.push_back(n);
+				hypothesis.rejectedConsistentCorrespondences_.push_back((unsigned int)(candidateIndices.size()));
+
+				continue;
+			}
+
+			if (n == correspondences && (candidateIndices.size() > hypothesis.validIndices_.size() || (candidateIndices.size() == hypothesis.validIndices_.size() && candidateSqrErrors < hypothesis.sqrErrors_)))
+			{
+				hypothesis.model_ = candidateModel;
+				std::swap(hypothesis.validIndices_, candidateIndices);
+				hypothesis.sqrErrors_ = candidateSqrErrors;
+			}
+		}
+	}
+}
+
 inline bool RANSAC::homographyMatrix(const Vector2* leftImagePoints, const Vector2* rightImagePoints, const size_t correspondences, RandomGenerator& randomGenerator, SquareMatrix3& homography, const unsigned int testCandidates, const bool refine, const unsigned int iterations, const Scalar squarePixelErrorThreshold, Indices32* usedIndices, Worker* worker, const bool useSVD)
 {
 	ocean_assert(leftImagePoints != nullptr && rightImagePoints != nullptr);
@@ -860,29 +1438,17 @@ bool RANSAC::homographyMatrix(const Vector2* leftImagePoints, const Vector2* rig
 	unsigned int maxValidCorrespondences = testCandidates - 1u;
 	Scalar minSquareErrors = Numeric::maxValue();
 
+	// minimal samples are always determined with the closed-form solution
+	const GeometricTransformFunction homographyFunction = (tUseSVD || testCandidates == 4u) ? homographyMatrixForSample : Homography::homographyMatrixLinearWithoutOptimations;
+
 	if (worker != nullptr)
 	{
 		Lock lock;
-
-		if constexpr (tUseSVD)
-		{
-			worker->executeFunction(Worker::Function::createStatic(&geometricTransformSubset, Homography::homographyMatrixSVD, leftImagePoints, rightImagePoints, correspondences, &randomGenerator, &homography, testCandidates, squarePixelErrorThreshold, indices, &maxValidCorrespondences, &minSquareErrors, (Lock*)(&lock), 0u, 0u), 0u, iterations, 12u, 13u, 5u);
-		}
-		else
-		{
-			worker->executeFunction(Worker::Function::createStatic(&geometricTransformSubset, Homography::homographyMatrixLinearWithoutOptimations, leftImagePoints, rightImagePoints, correspondences, &randomGenerator, &homography, testCandidates, squarePixelErrorThreshold, indices, &maxValidCorrespondences, &minSquareErrors, (Lock*)(&lock), 0u, 0u), 0u, iterations, 12u, 13u, 5u);
-		}
+		worker->executeFunction(Worker::Function::createStatic(&geometricTransformSubset, homographyFunction, leftImagePoints, rightImagePoints, correspondences, &randomGenerator, &homography, testCandidates, squarePixelErrorThreshold, indices, &maxValidCorrespondences, &minSquareErrors, (Lock*)(&lock), 0u, 0u), 0u, iterations, 12u, 13u, 5u);
 	}
 	else
 	{
-		if constexpr (tUseSVD)
-		{
-			geometricTransformSubset(Homography::homographyMatrixSVD, leftImagePoints, rightImagePoints, correspondences, &randomGenerator, &homography, testCandidates, squarePixelErrorThreshold, indices, &maxValidCorrespondences, &minSquareErrors, nullptr, 0u, iterations);
-		}
-		else
-		{
-			geometricTransformSubset(Homography::homographyMatrixLinearWithoutOptimations, leftImagePoints, rightImagePoints, correspondences, &randomGenerator, &homography, testCandidates, squarePixelErrorThreshold, indices, &maxValidCorrespondences, &minSquareErrors, nullptr, 0u, iterations);
-		}
+		geometricTransformSubset(homographyFunction, leftImagePoints, rightImagePoints, correspondences, &randomGenerator, &homography, testCandidates, squarePixelErrorThreshold, indices, &maxValidCorrespondences, &minSquareErrors, nullptr, 0u, iterations);
 	}
 
 	if (maxValidCorrespondences < testCandidates || homography.isSingular())
@@ -946,29 +1512,17 @@ bool RANSAC::homographyMatrixForNonBijectiveCorrespondences(const Vector2* leftI
 	unsigned int maxValidCorrespondences = testCandidates - 1u;
 	Scalar minSquareErrors = Numeric::maxValue();
 
+	// minimal samples are always determined with the closed-form solution
+	const GeometricTransformFunction homographyFunction = (tUseSVD || testCandidates == 4u) ? homographyMatrixForSample : Homography::homographyMatrixLinearWithoutOptimations;
+
 	if (worker != nullptr)
 	{
 		Lock lock;
-
-		if constexpr (tUseSVD)
-		{
-			worker->executeFunction(Worker::Function::createStatic(&geometricTransformForNonBijectiveCorrespondencesSubset, Homography::homographyMatrixSVD, leftImagePoints, numberLeftImagePoints, rightImagePoints, numberRightImagePoints, correspondences, numberCorrespondences, &randomGenerator, &right_H_left, testCandidates, squarePixelErrorThreshold, indices, &maxValidCorrespondences, &minSquareErrors, (Lock*)&lock, 0u, 0u), 0u, iterations, 15u, 16u, 5u);
-		}
-		else
-		{
-			worker->executeFunction(Worker::Function::createStatic(&geometricTransformForNonBijectiveCorrespondencesSubset, Homography::homographyMatrixLinearWithoutOptimations, leftImagePoints, numberLeftImagePoints, rightImagePoints, numberRightImagePoints, correspondences, numberCorrespondences, &randomGenerator, &right_H_left, testCandidates, squarePixelErrorThreshold, indices, &maxValidCorrespondences, &minSquareErrors, (Lock*)&lock, 0u, 0u), 0u, iterations, 15u, 16u, 5u);
-		}
+		worker->executeFunction(Worker::Function::createStatic(&geometricTransformForNonBijectiveCorrespondencesSubset, homographyFunction, leftImagePoints, numberLeftImagePoints, rightImagePoints, numberRightImagePoints, correspondences, numberCorrespondences, &randomGenerator, &right_H_left, testCandidates, squarePixelErrorThreshold, indices, &maxValidCorrespondences, &minSquareErrors, (Lock*)&lock, 0u, 0u), 0u, iterations, 15u, 16u, 5u);
 	}
 	else
 	{
-		if constexpr (tUseSVD)
-		{
-			geometricTransformForNonBijectiveCorrespondencesSubset(Homography::homographyMatrixSVD, leftImagePoints, numberLeftImagePoints, rightImagePoints, numberRightImagePoints, correspondences, numberCorrespondences, &randomGenerator, &right_H_left, testCandidates, squarePixelErrorThreshold, indices, &maxValidCorrespondences, &minSquareErrors, nullptr, 0u, iterations);
-		}
-		else
-		{
-			geometricTransformForNonBijectiveCorrespondencesSubset(Homography::homographyMatrixLinearWithoutOptimations, leftImagePoints, numberLeftImagePoints, rightImagePoints, numberRightImagePoints, correspondences, numberCorrespondences, &randomGenerator, &right_H_left, testCandidates, squarePixelErrorThreshold, indices, &maxValidCorrespondences, &minSquareErrors, nullptr, 0u, iterations);
-		}
+		geometricTransformForNonBijectiveCorrespondencesSubset(homographyFunction, leftImagePoints, numberLeftImagePoints, rightImagePoints, numberRightImagePoints, correspondences, numberCorrespondences, &randomGenerator, &right_H_left, testCandidates, squarePixelErrorThreshold, indices, &maxValidCorrespondences, &minSquareErrors, nullptr, 0u, iterations);
 	}
 
 	if (maxValidCorrespondences < testCandidates || right_H_left.isSingular())
@@ -15,6 +15,80 @@ namespace Ocean
 namespace Geometry
 {
 
+void SpatialDistribution::Array::binIndices(const Vector2* positions, const size_t number, unsigned int* binIndices) const
+{
+	ocean_assert(positions != nullptr && binIndices != nullptr);
+	ocean_assert(isValid());
+
+	size_t n = 0;
+
+#if defined(OCEAN_HARDWARE_SSE_VERSION) && OCEAN_HARDWARE_SSE_VERSION >= 41
+
+	// we determine the bins of four positions at once, invalid bins are set to 0xFFFFFFFF
+
+	const __m128i horizontalBins_m128i = _mm_set1_epi32(int(horizontalBins_));
+	const __m128i verticalBins_m128i = _mm_set1_epi32(int(verticalBins_));
+	const __m128i minusOne_m128i = _mm_set1_epi32(-1);
+
+	for (; n + 4 <= number; n += 4)
+	{
+		__m128i horizontal_m128i;
+		__m128i vertical_m128i;
+
+		if constexpr (std::is_same<Scalar, float>::value)
+		{
+			const __m128 leftTop_m128 = _mm_setr_ps(float(areaLeft_), float(areaTop_), float(areaLeft_), float(areaTop_));
+			const __m128 point2Bin_m128 = _mm_setr_ps(float(horizontalPoint2Bin_), float(verticalPoint2Bin_), float(horizontalPoint2Bin_), float(verticalPoint2Bin_));
+
+			const __m128 positionsA_m128 = _mm_floor_ps(_mm_mul_ps(_mm_sub_ps(_mm_loadu_ps((const float*)(positions + n + 0)), leftTop_m128), point2Bin_m128));
+			const __m128 positionsB_m128 = _mm_floor_ps(_mm_mul_ps(_mm_sub_ps(_mm_loadu_ps((const float*)(positions + n + 2)), leftTop_m128), point2Bin_m128));
+
+			horizontal_m128i = _mm_cvttps_epi32(_mm_shuffle_ps(positionsA_m128, positionsB_m128, _MM_SHUFFLE(2, 0, 2, 0)));
+			vertical_m128i = _mm_cvttps_epi32(_mm_shuffle_ps(positionsA_m128, positionsB_m128, _MM_SHUFFLE(3, 1, 3, 1)));
+		}
+		else
+		{
+			const __m128d leftTop_m128d = _mm_setr_pd(double(areaLeft_), double(areaTop_));
+			const __m128d point2Bin_m128d = _mm_setr_pd(double(horizontalPoint2Bin_), double(verticalPoint2Bin_));
+
+			const __m128d position0_m128d = _mm_floor_pd(_mm_mul_pd(_mm_sub_pd(_mm_loadu_pd((const double*)(positions + n + 0)), leftTop_m128d), point2Bin_m128d));
+			const __m128d position1_m128d = _mm_floor_pd(_mm_mul_pd(_mm_sub_pd(_mm_loadu_pd((const double*)(positions + n + 1)), leftTop_m128d), point2Bin_m128d));
+			const __m128d position2_m128d = _mm_floor_pd(_mm_mul_pd(_mm_sub_pd(_mm_loadu_pd((const double*)(positions + n + 2)), leftTop_m128d), point2Bin_m128d));
+			const __m128d position3_m128d = _mm_floor_pd(_mm_mul_pd(_mm_sub_pd(_mm_loadu_pd((const double*)(positions + n + 3)), leftTop_m128d), point2Bin_m128d));
+
+			horizontal_m128i = _mm_unpacklo_epi64(_mm_cvttpd_epi32(_mm_unpacklo_pd(position0_m128d, position1_m128d)), _mm_cvttpd_epi32(_mm_unpacklo_pd(position2_m128d, position3_m128d)));
+			vertical_m128i = _mm_unpacklo_epi64(_mm_cvttpd_epi32(_mm_unpackhi_pd(position0_m128d, position1_m128d)), _mm_cvttpd_epi32(_mm_unpackhi_pd(position2_m128d, position3_m128d)));
+		}
+
+		// 0 <= bin < bins, out-of-range conversions result in 0x80000000 which is negative
+
+		const __m128i validHorizontal_m128i = _mm_and_si128(_mm_cmpgt_epi32(horizontal_m128i, minusOne_m128i), _mm_cmplt_epi32(horizontal_m128i, horizontalBins_m128i));
+		const __m128i validVertical_m128i = _mm_and_si128(_mm_cmpgt_epi32(vertical_m128i, minusOne_m128i), _mm_cmplt_epi32(vertical_m128i, verticalBins_m128i));
+		const __m128i valid_m128i = _mm_and_si128(validHorizontal_m128i, validVertical_m128i);
+
+		const __m128i indices_m128i = _mm_add_epi32(_mm_mullo_epi32(vertical_m128i, horizontalBins_m128i), horizontal_m128i);
+
+		_mm_storeu_si128((__m128i*)(binIndices + n), _mm_or_si128(_mm_and_si128(valid_m128i, indices_m128i), _mm_xor_si128(valid_m128i, minusOne_m128i)));
+	}
+
+#endif // OCEAN_HARDWARE_SSE_VERSION >= 41
+
+	for (; n < number; ++n)
+	{
+		const unsigned int horizontal = (unsigned int)(horizontalBin(positions[n].x()));
+		const unsigned int vertical = (unsigned int)(verticalBin(positions[n].y()));
+
+		if (horizontal < horizontalBins_ && vertical < verticalBins_)
+		{
+			binIndices[n] = vertical * horizontalBins_ + horizontal;
+		}
+		else
+		{
+			binIndices[n] = (unsigned int)(-1);
+		}
+	}
+}
+
 SpatialDistribution::DistributionArray::DistributionArray(const DistributionArray& distributionArray, const bool copyNeighborhood8) :
 	Array(distributionArray),
 	indexGroups_(distributionArray.indexGroups_),
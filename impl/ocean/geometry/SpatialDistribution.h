@@ -15,6 +15,7 @@
 #include "ocean/math/Box2.h"
 
 #include <algorithm>
+#include <functional>
 
 namespace Ocean
 {
@@ -168,6 +169,15 @@ class OCEAN_GEOMETRY_EXPORT SpatialDistribution
 				template <unsigned int tRadius>
 				inline unsigned int endBinVertical(const unsigned int centerBinY) const;
 
+				/**
+				 * Determines the bin indices of several positions at once.
+				 * The indices are determined with SIMD instructions (if available), identical to index(horizontalBin(x), verticalBin(y)) for positions inside the array.
+				 * @param positions The positions for which the bin indices will be determined, must be valid
+				 * @param number The number of given positions, with range [1, infinity)
+				 * @param binIndices The resulting bin indices, one for each position, (unsigned int)(-1) for positions outside the array, must be valid
+				 */
+				void binIndices(const Vector2* positions, const size_t number, unsigned int* binIndices) const;
+
 				/**
 				 * Returns whether this object holds a valid distribution.
 				 * @return True, if so
@@ -621,6 +631,134 @@ class OCEAN_GEOMETRY_EXPORT SpatialDistribution
 				Indices32 occupancy_;
 		};
 
+		/**
+		 * This class implements a distribution array keeping the best elements of each bin, with a fixed capacity for each bin.
+		 * Elements can be added in a streaming manner (e.g., directly when they are detected), elements not belonging to the best elements of their bin are rejected immediately.<br>
+		 * The memory of the array is reused whenever the array is reset with an identical or smaller number of bins and capacity, so that the same array can be used for every frame without any memory allocation.<br>
+		 * As the layout of the bins is defined by an Array object, the array can also share the layout of e.g., an existing occupancy array.
+		 * @tparam T The data type of the elements
+		 * @tparam tFunction The function pointer that returns the 2D position of each element
+		 * @tparam TCompare The comparison functor returning true if the first element is better than the second element, e.g., std::less<HarrisCorner> to prefer strong corners
+		 */
+		template <typename T, Vector2 (*tFunction)(const T&), typename TCompare = std::less<T>>
+		class BestElementsArray : public Array
+		{
+			public:
+
+				/**
+				 * Creates an empty array object.
+				 */
+				BestElementsArray() = default;
+
+				/**
+				 * Creates a new array object.
+				 * @param left The left area position, with range (-infinity, infinity)
+				 * @param top The top area position, with range (-infinity, infinity)
+				 * @param width The width of the distribution area, with range (0, infinity)
+				 * @param height The height of the distribution area, with range (0, infinity)
+				 * @param horizontalBins Number of horizontal distribution bins, with range [1, infinity)
+				 * @param verticalBins Number of vertical distribution bins, with range [1, infinity)
+				 * @param capacityPerBin The maximal number of elements each bin keeps, with range [1, infinity)
+				 */
+				inline BestElementsArray(const Scalar left, const Scalar top, const Scalar width, const Scalar height, const unsigned int horizontalBins, const unsigned int verticalBins, const unsigned int capacityPerBin);
+
+				/**
+				 * Resets this array with a new layout and removes all elements.
+				 * Memory is allocated only if the new layout needs more memory than any previous layout.
+				 * @param left The left area position, with range (-infinity, infinity)
+				 * @param top The top area position, with range (-infinity, infinity)
+				 * @param width The width of the distribution area, with range (0, infinity)
+				 * @param height The height of the distribution area, with range (0, infinity)
+				 * @param horizontalBins Number of horizontal distribution bins, with range [1, infinity)
+				 * @param verticalBins Number of vertical distribution bins, with range [1, infinity)
+				 * @param capacityPerBin The maximal number of elements each bin keeps, with range [1, infinity)
+				 */
+				inline void reset(const Scalar left, const Scalar top, const Scalar width, const Scalar height, const unsigned int horizontalBins, const unsigned int verticalBins, const unsigned int capacityPerBin);
+
+				/**
+				 * Resets this array with the layout of another array and removes all elements.
+				 * Memory is allocated only if the new layout needs more memory than any previous layout.
+				 * @param layout The array defining the layout of the bins, e.g., an occupancy array, must be valid
+				 * @param capacityPerBin The maximal number of elements each bin keeps, with range [1, infinity)
+				 */
+				inline void reset(const Array& layout, const unsigned int capacityPerBin);
+
+				/**
+				 * Removes all elements from this array while keeping the layout.
+				 */
+				inline void clear();
+
+				/**
+				 * Adds an element to this array.
+				 * The element is kept if its bin is not full or if the element is better than the worst element of its bin, which is removed in this case.
+				 * @param element The element to be added
+				 * @return True, if the element is kept; False, if the element is rejected or outside the array
+				 */
+				inline bool addElement(const T& element);
+
+				/**
+				 * Adds several elements to this array.
+				 * The bins of the elements are determined in blocks with SIMD instructions.
+				 * @param elements The elements to be added, may be nullptr if number == 0
+				 * @param number The number of elements, with range [0, infinity)
+				 * @see addElement().
+				 */
+				void addElements(const T* elements, const size_t number);
+
+				/**
+				 * Extracts the kept elements, appends them to a given vector, and removes all elements from this array.
+				 * First, the best element of each bin is extracted, then the second best element of each bin, and so on; the elements of each round are sorted from best to worst.<br>
+				 * No memory is allocated if the given vector has enough capacity.
+				 * @param elements The vector to which the elements will be appended
+				 * @param maximalElements The maximal number of elements to be extracted, with range [0, infinity)
+				 * @return The number of appended elements
+				 */
+				size_t extractElements(std::vector<T>& elements, const size_t maximalElements = size_t(-1));
+
+				/**
+				 * Returns the maximal number of elements each bin keeps.
+				 * @return The capacity of each bin
+				 */
+				inline unsigned int capacityPerBin() const;
+
+				/**
+				 * Returns the number of elements in a bin.
+				 * @param binIndex The index of the bin, with range [0, bins())
+				 * @return The number of elements, with range [0, capacityPerBin()]
+				 */
+				inline unsigned int binSize(const unsigned int binIndex) const;
+
+				/**
+				 * Returns the number of elements in all bins.
+				 * @return The number of kept elements
+				 */
+				inline size_t size() const;
+
+			protected:
+
+				/**
+				 * Adds an element to a specific bin.
+				 * @param element The element to be added
+				 * @param binIndex The index of the bin, with range [0, bins())
+				 * @return True, if the element is kept
+				 */
+				inline bool addElementToBin(const T& element, const unsigned int binIndex);
+
+			protected:
+
+				/// The elements of all bins, each bin holds a heap with the worst element in front.
+				std::vector<T> elements_;
+
+				/// The number of elements in each bin.
+				Indices32 binSizes_;
+
+				/// The maximal number of elements each bin keeps.
+				unsigned int capacityPerBin_ = 0u;
+
+				/// The number of elements in all bins.
+				size_t size_ = 0;
+		};
+
 		/**
 		 * Definition of a class holding an index and a distance.
 		 */
@@ -1678,6 +1816,205 @@ inline bool SpatialDistribution::OccupancyArray::operator!=(const OccupancyArray
 	return !(*this == occupancyArray);
 }
 
+template <typename T, Vector2 (*tFunction)(const T&), typename TCompare>
+inline SpatialDistribution::BestElementsArray<T, tFunction, TCompare>::BestElementsArray(const Scalar left, const Scalar top, const Scalar width, const Scalar height, const unsigned int horizontalBins, const unsigned int verticalBins, const unsigned int capacityPerBin)
+{
+	reset(left, top, width, height, horizontalBins, verticalBins, capacityPerBin);
+}
+
+template <typename T, Vector2 (*tFunction)(const T&), typename TCompare>
+inline void SpatialDistribution::BestElementsArray<T, tFunction, TCompare>::reset(const Scalar left, const Scalar top, const Scalar width, const Scalar height, const unsigned int horizontalBins, const unsigned int verticalBins, const unsigned int capacityPerBin)
+{
+	// the constructor of Array is protected, so that we need a derived class to create the new layout
+
+	class Layout : public Array
+	{
+		public:
+
+			inline Layout(const Scalar left, const Scalar top, const Scalar width, const Scalar height, const unsigned int horizontalBins, const unsigned int verticalBins) :
+				Array(left, top, width, height, horizontalBins, verticalBins)
+			{
+				// nothing to do here
+			}
+	};
+
+	reset(Layout(left, top, width, height, horizontalBins, verticalBins), capacityPerBin);
+}
+
+template <typename T, Vector2 (*tFunction)(const T&), typename TCompare>
+inline void SpatialDistribution::BestElementsArray<T, tFunction, TCompare>::reset(const Array& layout, const unsigned int capacityPerBin)
+{
+	ocean_assert(layout.isValid());
+	ocean_assert(capacityPerBin >= 1u);
+
+	Array::operator=(layout);
+
+	capacityPerBin_ = capacityPerBin;
+
+	// resize() and assign() keep the capacity of the vectors, so that memory is allocated only if the array grows
+
+	elements_.resize(size_t(bins()) * size_t(capacityPerBin_));
+	binSizes_.assign(bins(), 0u);
+
+	size_ = 0;
+}
+
+template <typename T, Vector2 (*tFunction)(const T&), typename TCompare>
+inline void SpatialDistribution::BestElementsArray<T, tFunction, TCompare>::clear()
+{
+	std::fill(binSizes_.begin(), binSizes_.end(), 0u);
+
+	size_ = 0;
+}
+
+template <typename T, Vector2 (*tFunction)(const T&), typename TCompare>
+inline bool SpatialDistribution::BestElementsArray<T, tFunction, TCompare>::addElement(const T& element)
+{
+	const Vector2 position(tFunction(element));
+
+	const unsigned int horizontal = (unsigned int)(horizontalBin(position.x()));
+	const unsigned int vertical = (unsigned int)(verticalBin(position.y()));
+
+	if (horizontal < horizontalBins_ && vertical < verticalBins_)
+	{
+		return addElementToBin(element, vertical * horizontalBins_ + horizontal);
+	}
+
+	return false;
+}
+
+template <typename T, Vector2 (*tFunction)(const T&), typename TCompare>
+void SpatialDistribution::BestElementsArray<T, tFunction, TCompare>::addElements(const T* elements, const size_t number)
+{
+	ocean_assert(elements != nullptr || number == 0);
+	ocean_assert(isValid());
+
+	constexpr size_t blockSize = 64;
+
+	Vector2 positions[blockSize];
+	unsigned int blockBinIndices[blockSize];
+
+	for (size_t blockStart = 0; blockStart < number; blockStart += blockSize)
+	{
+		const size_t blockElements = std::min(blockSize, number - blockStart);
+
+		for (size_t n = 0; n < blockElements; ++n)
+		{
+			positions[n] = tFunction(elements[blockStart + n]);
+		}
+
+		binIndices(positions, blockElements, blockBinIndices);
+
+		for (size_t n = 0; n < blockElements; ++n)
+		{
+			if (blockBinIndices[n] != (unsigned int)(-1))
+			{
+				addElementToBin(elements[blockStart + n], blockBinIndices[n]);
+			}
+		}
+	}
+}
+
+template <typename T, Vector2 (*tFunction)(const T&), typename TCompare>
+size_t SpatialDistribution::BestElementsArray<T, tFunction, TCompare>::extractElements(std::vector<T>& elements, const size_t maximalElements)
+{
+	const TCompare compare;
+
+	const size_t initialSize = elements.size();
+
+	unsigned int maximalBinSize = 0u;
+
+	for (unsigned int binIndex = 0u; binIndex < (unsigned int)(binSizes_.size()); ++binIndex)
+	{
+		// sorting the heap of each bin, the best element will be the first element
+
+		T* binElements = elements_.data() + size_t(binIndex) * size_t(capacityPerBin_);
+		std::sort_heap(binElements, binElements + binSizes_[binIndex], compare);
+
+		maximalBinSize = std::max(maximalBinSize, binSizes_[binIndex]);
+	}
+
+	for (unsigned int round = 0u; round < maximalBinSize && elements.size() - initialSize < maximalElements; ++round)
+	{
+		const size_t roundStart = elements.size();
+
+		for (unsigned int binIndex = 0u; binIndex < (unsigned int)(binSizes_.size()); ++binIndex)
+		{
+			if (round < binSizes_[binIndex])
+			{
+				elements.push_back(elements_[size_t(binIndex) * size_t(capacityPerBin_) + size_t(round)]);
+			}
+		}
+
+		// the best elements of the last round are kept if the round is truncated
+		std::sort(elements.begin() + roundStart, elements.end(), compare);
+
+		if (elements.size() - initialSize > maximalElements)
+		{
+			elements.resize(initialSize + maximalElements);
+		}
+	}
+
+	clear();
+
+	return elements.size() - initialSize;
+}
+
+template <typename T, Vector2 (*tFunction)(const T&), typename TCompare>
+inline unsigned int SpatialDistribution::BestElementsArray<T, tFunction, TCompare>::capacityPerBin() const
+{
+	return capacityPerBin_;
+}
+
+template <typename T, Vector2 (*tFunction)(const T&), typename TCompare>
+inline unsigned int SpatialDistribution::BestElementsArray<T, tFunction, TCompare>::binSize(const unsigned int binIndex) const
+{
+	ocean_assert(binIndex < binSizes_.size());
+
+	return binSizes_[binIndex];
+}
+
+template <typename T, Vector2 (*tFunction)(const T&), typename TCompare>
+inline size_t SpatialDistribution::BestElementsArray<T, tFunction, TCompare>::size() const
+{
+	return size_;
+}
+
+template <typename T, Vector2 (*tFunction)(const T&), typename TCompare>
+inline bool SpatialDistribution::BestElementsArray<T, tFunction, TCompare>::addElementToBin(const T& element, const unsigned int binIndex)
+{
+	ocean_assert(binIndex < binSizes_.size());
+	ocean_assert(capacityPerBin_ >= 1u);
+
+	const TCompare compare;
+
+	T* binElements = elements_.data() + size_t(binIndex) * size_t(capacityPerBin_);
+	unsigned int& binSize = binSizes_[binIndex];
+
+	if (binSize < capacityPerBin_)
+	{
+		binElements[binSize++] = element;
+		std::push_heap(binElements, binElements + binSize, compare);
+
+		++size_;
+
+		return true;
+	}
+
+	// the bin is full, the front element of the heap is the worst element
+
+	if (!compare(element, binElements[0]))
+	{
+		return false;
+	}
+
+	std::pop_heap(binElements, binElements + binSize, compare);
+	binElements[binSize - 1u] = element;
+	std::push_heap(binElements, binElements + binSize, compare);
+
+	return true;
+}
+
 inline SpatialDistribution::DistanceElement::DistanceElement(const unsigned int index, const unsigned int candidateIndex, const Scalar distance) :
 	index_(index),
 	candidateIndex_(candidateIndex),
@@ -427,6 +427,80 @@ bool StereoscopicGeometry::cameraPose(const AnyCamera& camera, const ConstIndexe
 	return true;
 }
 
+size_t StereoscopicGeometry::cameraPoses(const AnyCamera& camera, CameraPosePairs& cameraPosePairs, RandomGenerator& randomGenerator, Worker* worker, const Scalar maxRotationalSqrError, const Scalar maxArbitrarySqrError, const unsigned int iterations, const Scalar rotationalMotionMinimalValidCorrespondencesPercent, const Scalar baselineDistance)
+{
+	ocean_assert(camera.isValid());
+	ocean_assert(rotationalMotionMinimalValidCorrespondencesPercent >= Scalar(0) && rotationalMotionMinimalValidCorrespondencesPercent <= Scalar(1));
+
+	if (!camera.isValid() || cameraPosePairs.empty())
+	{
+		return 0;
+	}
+
+	// each pair receives an own seed, so that the results do not depend on the distribution of the pairs
+
+	Indices32 seeds(cameraPosePairs.size());
+
+	for (unsigned int& seed : seeds)
+	{
+		seed = RandomI::random32(randomGenerator);
+	}
+
+	if (worker != nullptr && cameraPosePairs.size() > 1)
+	{
+		worker->executeFunction(Worker::Function::createStatic(&StereoscopicGeometry::cameraPosesSubset, &camera, cameraPosePairs.data(), (const unsigned int*)(seeds.data()), maxRotationalSqrError, maxArbitrarySqrError, iterations, rotationalMotionMinimalValidCorrespondencesPercent, baselineDistance, 0u, 0u), 0u, (unsigned int)(cameraPosePairs.size()), 8u, 9u, 1u);
+	}
+	else
+	{
+		cameraPosesSubset(&camera, cameraPosePairs.data(), seeds.data(), maxRotationalSqrError, maxArbitrarySqrError, iterations, rotationalMotionMinimalValidCorrespondencesPercent, baselineDistance, 0u, (unsigned int)(cameraPosePairs.size()));
+	}
+
+	size_t succeededPairs = 0;
+
+	for (const CameraPosePair& cameraPosePair : cameraPosePairs)
+	{
+		if (cameraPosePair.succeeded())
+		{
+			++succeededPairs;
+		}
+	}
+
+	return succeededPairs;
+}
+
+void StereoscopicGeometry::cameraPosesSubset(const AnyCamera* camera, CameraPosePair* cameraPosePairs, const unsigned int* seeds, const Scalar maxRotationalSqrError, const Scalar maxArbitrarySqrError, const unsigned int iterations, const Scalar rotationalMotionMinimalValidCorrespondencesPercent, const Scalar baselineDistance, const unsigned int firstPair, const unsigned int numberPairs)
+{
+	ocean_assert(camera != nullptr && cameraPosePairs != nullptr && seeds != nullptr);
+
+	for (unsigned int n = firstPair; n < firstPair + numberPairs; ++n)
+	{
+		CameraPosePair& cameraPosePair = cameraPosePairs[n];
+
+		cameraPosePair.world_T_camera1_ = HomogenousMatrix4(false);
+		cameraPosePair.objectPoints_.clear();
+		cameraPosePair.validIndices_.clear();
+
+		if (cameraPosePair.imagePoints0_.size() < 5 || cameraPosePair.imagePoints0_.size() != cameraPosePair.imagePoints1_.size())
+		{
+			continue;
+		}
+
+		RandomGenerator randomGenerator(seeds[n]);
+
+		HomogenousMatrix4 world_T_camera1(false);
+
+		if (cameraPose(*camera, ConstArrayAccessor<Vector2>(cameraPosePair.imagePoints0_), ConstArrayAccessor<Vector2>(cameraPosePair.imagePoints1_), randomGenerator, world_T_camera1, &cameraPosePair.objectPoints_, &cameraPosePair.validIndices_, maxRotationalSqrError, maxArbitrarySqrError, iterations, rotationalMotionMinimalValidCorrespondencesPercent, baselineDistance))
+		{
+			cameraPosePair.world_T_camera1_ = world_T_camera1;
+		}
+		else
+		{
+			cameraPosePair.objectPoints_.clear();
+			cameraPosePair.validIndices_.clear();
+		}
+	}
+}
+
 }
 
 }
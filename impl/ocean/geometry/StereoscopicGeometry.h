@@ -13,6 +13,7 @@
 
 #include "ocean/base/Accessor.h"
 #include "ocean/base/RandomGenerator.h"
+#include "ocean/base/Worker.h"
 
 #include "ocean/math/AnyCamera.h"
 #include "ocean/math/HomogenousMatrix4.h"
@@ -29,6 +30,58 @@ namespace Geometry
  */
 class OCEAN_GEOMETRY_EXPORT StereoscopicGeometry
 {
+	public:
+
+		/**
+		 * This class holds the point correspondences between two camera frames and the resulting camera pose of the second frame.
+		 * Several frame pairs can be evaluated concurrently, e.g., to find the best frame pair for an initialization.
+		 * @see cameraPoses().
+		 */
+		class CameraPosePair
+		{
+			public:
+
+				/**
+				 * Creates a new pair without correspondences.
+				 */
+				CameraPosePair() = default;
+
+				/**
+				 * Creates a new pair with given correspondences.
+				 * @param imagePoints0 The image points located in the first frame, at least 5
+				 * @param imagePoints1 The image points located in the second frame, one for each image point in the first frame
+				 */
+				inline CameraPosePair(Vectors2&& imagePoints0, Vectors2&& imagePoints1);
+
+				/**
+				 * Returns whether the camera pose of the second frame has been determined.
+				 * @return True, if so
+				 */
+				inline bool succeeded() const;
+
+			public:
+
+				/// The image points located in the first frame.
+				Vectors2 imagePoints0_;
+
+				/// The image points located in the second frame, one for each image point in the first frame.
+				Vectors2 imagePoints1_;
+
+				/// The resulting camera pose of the second camera, the first camera is the identity camera pose; invalid if the pose could not be determined.
+				HomogenousMatrix4 world_T_camera1_ = HomogenousMatrix4(false);
+
+				/// The resulting 3D object points which are visible in both camera frames.
+				Vectors3 objectPoints_;
+
+				/// The resulting indices of the valid correspondences, one for each object point.
+				Indices32 validIndices_;
+		};
+
+		/**
+		 * Definition of a vector holding camera pose pairs.
+		 */
+		using CameraPosePairs = std::vector<CameraPosePair>;
+
 	public:
 
 		/**
@@ -76,6 +129,24 @@ class OCEAN_GEOMETRY_EXPORT StereoscopicGeometry
 		 */
 		static bool cameraPose(const AnyCamera& camera, const ConstIndexedAccessor<Vector2>& imagePoints0, const ConstIndexedAccessor<Vector2>& imagePoints1, RandomGenerator& randomGenerator, HomogenousMatrix4& world_T_camera0, HomogenousMatrix4& world_T_camera1, const GravityConstraints* gravityConstraints = nullptr, Vectors3* objectPoints = nullptr, Indices32* validIndices = nullptr, const Scalar maxRotationalSqrError = Scalar(1.5 * 1.5), const Scalar maxArbitrarySqrError = Scalar(3.5 * 3.5), const unsigned int iterations = 100u, const Scalar rotationalMotionMinimalValidCorrespondencesPercent = Scalar(0.9), const Scalar baselineDistance = Scalar(-1));
 
+		/**
+		 * Determines the pose transformations of several frame pairs concurrently.
+		 * Each frame pair is handled as in cameraPose(), the first camera pose of each pair is the identity camera pose.<br>
+		 * Each frame pair uses an individual random generator seeded by the given random generator, so that the results do not depend on the given worker.
+		 * @param camera The camera profile defining the projection for all frame pairs, must be valid
+		 * @param cameraPosePairs The frame pairs for which the camera poses will be determined, receiving the resulting poses, object points, and valid indices
+		 * @param randomGenerator Random generator object
+		 * @param worker Optional worker object to distribute the frame pairs
+		 * @param maxRotationalSqrError The maximal squared pixel error between a projected object point and a corresponding image point so that the pair counts as valid for rotational camera motion
+		 * @param maxArbitrarySqrError The maximal squared pixel error between a projected object point and a corresponding image point so that the pair counts as valid for arbitrary camera motion
+		 * @param iterations The number of iterations that will be applied finding a better pose result
+		 * @param rotationalMotionMinimalValidCorrespondencesPercent The minimal number of valid correspondences (defined as percent of the entire number of correspondences) that are necessary so that the camera motion is accepted to be pure rotational, with range [0, 1]
+		 * @param baselineDistance Optional fixed baseline distance between both cameras, with range (0, infinity), -1 to disable
+		 * @return The number of frame pairs for which a camera pose could be determined
+		 * @see cameraPose().
+		 */
+		static size_t cameraPoses(const AnyCamera& camera, CameraPosePairs& cameraPosePairs, RandomGenerator& randomGenerator, Worker* worker = nullptr, const Scalar maxRotationalSqrError = Scalar(1.5 * 1.5), const Scalar maxArbitrarySqrError = Scalar(3.5 * 3.5), const unsigned int iterations = 100u, const Scalar rotationalMotionMinimalValidCorrespondencesPercent = Scalar(0.9), const Scalar baselineDistance = Scalar(-1));
+
 		/**
 		 * Determines valid correspondences between 2D image points and 3D camera points for two individual camera frames concurrently.
 		 * Beware: The given camera matrices are not equal to a extrinsic matrix.<br>
@@ -98,8 +169,38 @@ class OCEAN_GEOMETRY_EXPORT StereoscopicGeometry
 		 */
 		template <typename TAccessorObjectPoints, typename TAccessorImagePoints0, typename TAccessorImagePoints1>
 		static bool determineValidCorrespondencesIF(const AnyCamera& camera, const HomogenousMatrix4& flippedCamera0_T_world, const HomogenousMatrix4& flippedCamera1_T_world, const TAccessorObjectPoints& objectPoints, const TAccessorImagePoints0& imagePoints0, const TAccessorImagePoints1& imagePoints1, Indices32& validIndices, const Scalar maxSqrError = Scalar(3.5 * 3.5), const bool onlyFrontObjectPoints = true, Scalar* totalSqrError = nullptr, const size_t minimalValidCorrespondences = 0);
+
+	protected:
+
+		/**
+		 * Determines the pose transformations of a subset of frame pairs.
+		 * @param camera The camera profile defining the projection, must be valid
+		 * @param cameraPosePairs The frame pairs, must be valid
+		 * @param seeds The seeds of the random generators, one for each frame pair, must be valid
+		 * @param maxRotationalSqrError The maximal squared pixel error for rotational camera motion
+		 * @param maxArbitrarySqrError The maximal squared pixel error for arbitrary camera motion
+		 * @param iterations The number of iterations that will be applied finding a better pose result
+		 * @param rotationalMotionMinimalValidCorrespondencesPercent The minimal number of valid correspondences for rotational camera motion, with range [0, 1]
+		 * @param baselineDistance Optional fixed baseline distance between both cameras, -1 to disable
+		 * @param firstPair The first frame pair to be handled
+		 * @param numberPairs The number of frame pairs to be handled
+		 * @see cameraPoses().
+		 */
+		static void cameraPosesSubset(const AnyCamera* camera, CameraPosePair* cameraPosePairs, const unsigned int* seeds, const Scalar maxRotationalSqrError, const Scalar maxArbitrarySqrError, const unsigned int iterations, const Scalar rotationalMotionMinimalValidCorrespondencesPercent, const Scalar baselineDistance, const unsigned int firstPair, const unsigned int numberPairs);
 };
 
+inline StereoscopicGeometry::CameraPosePair::CameraPosePair(Vectors2&& imagePoints0, Vectors2&& imagePoints1) :
+	imagePoints0_(std::move(imagePoints0)),
+	imagePoints1_(std::move(imagePoints1))
+{
+	ocean_assert(imagePoints0_.size() == imagePoints1_.size());
+}
+
+inline bool StereoscopicGeometry::CameraPosePair::succeeded() const
+{
+	return world_T_camera1_.isValid();
+}
+
 inline bool StereoscopicGeometry::cameraPose(const AnyCamera& camera, const ConstIndexedAccessor<Vector2>& accessorImagePoints0, const ConstIndexedAccessor<Vector2>& accessorImagePoints1, RandomGenerator& randomGenerator, HomogenousMatrix4& world_T_camera1, Vectors3* objectPoints, Indices32* validIndices, const Scalar maxRotationalSqrError, const Scalar maxArbitrarySqrError, const unsigned int iterations, const Scalar rotationalMotionMinimalValidCorrespondencesPercent, const Scalar baselineDistance)
 {
 	HomogenousMatrix4 world_T_camera0(false);
@@ -136,19 +237,38 @@ bool StereoscopicGeometry::determineValidCorrespondencesIF(const AnyCamera& came
 			return false;
 		}
 
-		if (onlyFrontObjectPoints)
+		// each object point is transformed only once per camera, the transformed point is used for the cheirality check and for the projection
+
+		const Vector3 objectPoint = objectPoints[n];
+
+		const Vector3 cameraObjectPoint0 = flippedCamera0_T_world * objectPoint;
+
+		if (onlyFrontObjectPoints && cameraObjectPoint0.z() <= Numeric::eps())
 		{
 			// we do not count this object point if it is located behind at least one camera
-			if (AnyCamera::isObjectPointInFrontIF(flippedCamera0_T_world, objectPoints[n]) == false || AnyCamera::isObjectPointInFrontIF(flippedCamera1_T_world, objectPoints[n]) == false)
-			{
-				continue;
-			}
+			continue;
+		}
+
+		const Vector3 cameraObjectPoint1 = flippedCamera1_T_world * objectPoint;
+
+		if (onlyFrontObjectPoints && cameraObjectPoint1.z() <= Numeric::eps())
+		{
+			continue;
+		}
+
+		ocean_assert(!onlyFrontObjectPoints || (AnyCamera::isObjectPointInFrontIF(flippedCamera0_T_world, objectPoint) && AnyCamera::isObjectPointInFrontIF(flippedCamera1_T_world, objectPoint)));
+
+		const Scalar sqrDistance0 = camera.projectToImageIF(cameraObjectPoint0).sqrDistance(imagePoints0[n]);
+
+		if (sqrDistance0 >= maxSqrError)
+		{
+			// the second projection can be skipped
+			continue;
 		}
 
-		const Scalar sqrDistance0 = camera.projectToImageIF(flippedCamera0_T_world, objectPoints[n]).sqrDistance(imagePoints0[n]);
-		const Scalar sqrDistance1 = camera.projectToImageIF(flippedCamera1_T_world, objectPoints[n]).sqrDistance(imagePoints1[n]);
+		const Scalar sqrDistance1 = camera.projectToImageIF(cameraObjectPoint1).sqrDistance(imagePoints1[n]);
 
-		if (sqrDistance0 < maxSqrError && sqrDistance1 < maxSqrError)
+		if (sqrDistance1 < maxSqrError)
 		{
 			validIndices.push_back(Index32(n));
 
@@ -42,6 +42,138 @@ std::string JSBase::toAString(v8::MaybeLocal<v8::String> value)
 	return toAString(value.ToLocalChecked());
 }
 
+bool JSBase::hasTypedArray(const v8::FunctionCallbackInfo<v8::Value>& info, const unsigned int index, std::vector<double>& values)
+{
+	if (info.Length() < int(index + 1u))
+	{
+		return false;
+	}
+
+	const v8::Local<v8::Value> value(info[index]);
+
+	if (value->IsFloat64Array())
+	{
+		const v8::Local<v8::Float64Array> typedArray(value.As<v8::Float64Array>());
+
+		values.resize(typedArray->Length());
+
+		if (!values.empty())
+		{
+			typedArray->CopyContents(values.data(), values.size() * sizeof(double));
+		}
+
+		return true;
+	}
+
+	if (value->IsFloat32Array())
+	{
+		const v8::Local<v8::Float32Array> typedArray(value.As<v8::Float32Array>());
+
+		std::vector<float> floatValues(typedArray->Length());
+
+		if (!floatValues.empty())
+		{
+			typedArray->CopyContents(floatValues.data(), floatValues.size() * sizeof(float));
+		}
+
+		values.assign(floatValues.cbegin(), floatValues.cend());
+
+		return true;
+	}
+
+	return false;
+}
+
+bool JSBase::hasTypedArray(const v8::FunctionCallbackInfo<v8::Value>& info, const unsigned int index, double* values, const size_t size)
+{
+	ocean_assert(values != nullptr && size >= 1);
+
+	if (info.Length() < int(index + 1u))
+	{
+		return false;
+	}
+
+	const v8::Local<v8::Value> value(info[index]);
+
+	if (value->IsFloat64Array())
+	{
+		const v8::Local<v8::Float64Array> typedArray(value.As<v8::Float64Array>());
+
+		if (typedArray->Length() != size)
+		{
+			return false;
+		}
+
+		typedArray->CopyContents(values, size * sizeof(double));
+
+		return true;
+	}
+
+	if (value->IsFloat32Array())
+	{
+		const v8::Local<v8::Float32Array> typedArray(value.As<v8::Float32Array>());
+
+		if (typedArray->Length() != size)
+		{
+			return false;
+		}
+
+		const float* floatValues = (const float*)((const uint8_t*)(typedArray->Buffer()->GetBackingStore()->Data()) + typedArray->ByteOffset());
+
+		for (size_t n = 0; n < size; ++n)
+		{
+			values[n] = double(floatValues[n]);
+		}
+
+		return true;
+	}
+
+	return false;
+}
+
+bool JSBase::writeTypedArray(const v8::Local<v8::Value>& value, const double* values, const size_t size)
+{
+	ocean_assert(values != nullptr && size >= 1);
+
+	if (value->IsFloat64Array())
+	{
+		const v8::Local<v8::Float64Array> typedArray(value.As<v8::Float64Array>());
+
+		if (typedArray->Length() < size)
+		{
+			return false;
+		}
+
+		double* targetValues = (double*)((uint8_t*)(typedArray->Buffer()->GetBackingStore()->Data()) + typedArray->ByteOffset());
+
+		memcpy(targetValues, values, size * sizeof(double));
+
+		return true;
+	}
+
+	if (value->IsFloat32Array())
+	{
+		const v8::Local<v8::Float32Array> typedArray(value.As<v8::Float32Array>());
+
+		if (typedArray->Length() < size)
+		{
+			return false;
+		}
+
+		float* targetValues = (float*)((uint8_t*)(typedArray->Buffer()->GetBackingStore()->Data()) + typedArray->ByteOffset());
+
+		for (size_t n = 0; n < size; ++n)
+		{
+			targetValues[n] = float(values[n]);
+		}
+
+		return true;
+	}
+
+	return false;
+}
+
+
 }
 
 }
@@ -139,6 +139,35 @@ class OCEAN_INTERACTION_JS_EXPORT JSBase
 		template <typename TNative>
 		static bool hasValue(const v8::FunctionCallbackInfo<v8::Value>& info, const unsigned int index, std::vector<TNative>& value);
 
+		/**
+		 * Returns whether a JavaScript function call holds a typed array with floating point elements (a Float32Array or a Float64Array) as parameter.
+		 * The elements are copied as one block, no JavaScript value is accessed per element.
+		 * @param info The function callback info
+		 * @param index The index of the function parameter, with range [0, infinity)
+		 * @param values The resulting elements of the typed array
+		 * @return True, if the function has at least `index + 1` parameters and if the parameter is a Float32Array or a Float64Array
+		 */
+		static bool hasTypedArray(const v8::FunctionCallbackInfo<v8::Value>& info, const unsigned int index, std::vector<double>& values);
+
+		/**
+		 * Returns whether a JavaScript function call holds a typed array with floating point elements and with a specific number of elements as parameter.
+		 * @param info The function callback info
+		 * @param index The index of the function parameter, with range [0, infinity)
+		 * @param values The memory receiving the elements of the typed array, must be valid
+		 * @param size The expected number of elements, with range [1, infinity)
+		 * @return True, if the function has at least `index + 1` parameters and if the parameter is a Float32Array or a Float64Array with `size` elements
+		 */
+		static bool hasTypedArray(const v8::FunctionCallbackInfo<v8::Value>& info, const unsigned int index, double* values, const size_t size);
+
+		/**
+		 * Writes values into an existing Float64Array or Float32Array, e.g., a typed array which is re-used by a script in every frame.
+		 * @param value The JavaScript value holding the typed array
+		 * @param values The values to write, must be valid
+		 * @param size The number of values to write, with range [1, infinity)
+		 * @return True, if the value is a Float32Array or a Float64Array with at least `size` elements
+		 */
+		static bool writeTypedArray(const v8::Local<v8::Value>& value, const double* values, const size_t size);
+
 		/**
 		 * Returns whether a JavaScript function call holds a sequence of specific native type as parameters.
 		 * @param info The function callback info
@@ -597,6 +626,35 @@ inline bool JSBase::hasValue(const v8::FunctionCallbackInfo<v8::Value>& info, co
 	return false;
 }
 
+template <>
+inline bool JSBase::hasValue(const v8::FunctionCallbackInfo<v8::Value>& info, const unsigned int index, HomogenousMatrix4& value)
+{
+	if (info.Length() >= int(index + 1u))
+	{
+		JSExternal* externalParameter = JSExternal::external(info[index]);
+
+		if (externalParameter != nullptr && externalParameter->type() == JSExternal::type<HomogenousMatrix4>())
+		{
+			value = externalParameter->value<HomogenousMatrix4>();
+
+			return true;
+		}
+
+		// a typed array with 16 elements (column aligned) can be used instead of a HomogenousMatrix4 object
+
+		double elements[16];
+
+		if (hasTypedArray(info, index, elements, 16))
+		{
+			value = HomogenousMatrix4(elements);
+
+			return value.isValid();
+		}
+	}
+
+	return false;
+}
+
 template <>
 inline bool JSBase::hasValue(const v8::FunctionCallbackInfo<v8::Value>& info, const unsigned int index, std::vector<bool>& value)
 {
@@ -616,7 +674,7 @@ inline bool JSBase::hasValue(const v8::FunctionCallbackInfo<v8::Value>& info, co
 			{
 				v8::MaybeLocal<v8::Value> element = arrayValue->Get(currentContext, n);
 
-				if (!element.IsEmpty() || !element.ToLocalChecked()->IsBoolean())
+				if (element.IsEmpty() || !element.ToLocalChecked()->IsBoolean())
 				{
 					return false;
 				}
@@ -649,7 +707,7 @@ inline bool JSBase::hasValue(const v8::FunctionCallbackInfo<v8::Value>& info, co
 			{
 				v8::MaybeLocal<v8::Value> element = arrayValue->Get(currentContext, n);
 
-				if (!element.IsEmpty() || !element.ToLocalChecked()->IsInt32())
+				if (element.IsEmpty() || !element.ToLocalChecked()->IsInt32())
 				{
 					return false;
 				}
@@ -682,7 +740,7 @@ inline bool JSBase::hasValue(const v8::FunctionCallbackInfo<v8::Value>& info, co
 			{
 				v8::MaybeLocal<v8::Value> element = arrayValue->Get(currentContext, n);
 
-				if (!element.IsEmpty() || !element.ToLocalChecked()->IsNumber())
+				if (element.IsEmpty() || !element.ToLocalChecked()->IsNumber())
 				{
 					return false;
 				}
@@ -715,7 +773,7 @@ inline bool JSBase::hasValue(const v8::FunctionCallbackInfo<v8::Value>& info, co
 			{
 				v8::MaybeLocal<v8::Value> element = arrayValue->Get(currentContext, n);
 
-				if (!element.IsEmpty() || !element.ToLocalChecked()->IsNumber())
+				if (element.IsEmpty() || !element.ToLocalChecked()->IsNumber())
 				{
 					return false;
 				}
@@ -748,7 +806,7 @@ inline bool JSBase::hasValue(const v8::FunctionCallbackInfo<v8::Value>& info, co
 			{
 				v8::MaybeLocal<v8::Value> element = arrayValue->Get(currentContext, n);
 
-				if (!element.IsEmpty() || !element.ToLocalChecked()->IsNumber())
+				if (element.IsEmpty() || !element.ToLocalChecked()->IsNumber())
 				{
 					return false;
 				}
@@ -781,7 +839,7 @@ inline bool JSBase::hasValue(const v8::FunctionCallbackInfo<v8::Value>& info, co
 			{
 				v8::MaybeLocal<v8::Value> element = arrayValue->Get(currentContext, n);
 
-				if (!element.IsEmpty() || !element.ToLocalChecked()->IsString())
+				if (element.IsEmpty() || !element.ToLocalChecked()->IsString())
 				{
 					return false;
 				}
@@ -814,7 +872,7 @@ inline bool JSBase::hasValue(const v8::FunctionCallbackInfo<v8::Value>& info, co
 			{
 				v8::MaybeLocal<v8::Value> element = arrayValue->Get(currentContext, n);
 
-				if (!element.IsEmpty() || !element.ToLocalChecked()->IsObject())
+				if (element.IsEmpty() || !element.ToLocalChecked()->IsObject())
 				{
 					return false;
 				}
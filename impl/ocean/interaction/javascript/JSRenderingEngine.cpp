@@ -39,6 +39,8 @@ void JSRenderingEngine::createFunctionTemplate()
 	objectTemplate->Set(newString("findObject", isolate), v8::FunctionTemplate::New(isolate, function<NativeType, FI_FIND_OBJECT>));
 	objectTemplate->Set(newString("findObjects", isolate), v8::FunctionTemplate::New(isolate, function<NativeType, FI_FIND_OBJECTS>));
 	objectTemplate->Set(newString("view", isolate), v8::FunctionTemplate::New(isolate, function<NativeType, FI_VIEW>));
+	objectTemplate->Set(newString("setTransformations", isolate), v8::FunctionTemplate::New(isolate, function<NativeType, FI_SET_TRANSFORMATIONS>));
+	objectTemplate->Set(newString("transformations", isolate), v8::FunctionTemplate::New(isolate, function<NativeType, FI_TRANSFORMATIONS>));
 
 	functionTemplate_.Reset(isolate, functionTemplate);
 	objectTemplate_.Reset(isolate, objectTemplate);
@@ -271,6 +273,100 @@ void JSBase::function<Rendering::EngineRef, JSRenderingEngine::FI_VIEW>(Renderin
 	}
 }
 
+template <>
+void JSBase::function<Rendering::EngineRef, JSRenderingEngine::FI_SET_TRANSFORMATIONS>(Rendering::EngineRef& thisValue, const v8::FunctionCallbackInfo<v8::Value>& info)
+{
+	if (thisValue.isNull())
+	{
+		Log::warning() << "The rendering engine does not hold any valid reference.";
+		return;
+	}
+
+	std::vector<Rendering::ObjectRef> objects;
+	std::vector<double> elements;
+
+	if (!hasValue(info, 0u, objects) || !hasTypedArray(info, 1u, elements))
+	{
+		Log::error() << "RenderingEngine::setTransformations() needs an Array of RenderingObjects and a Float64Array or Float32Array as parameters.";
+		info.GetReturnValue().Set(false);
+		return;
+	}
+
+	if (elements.size() != objects.size() * 16)
+	{
+		Log::error() << "RenderingEngine::setTransformations() needs 16 array elements for each RenderingObject.";
+		info.GetReturnValue().Set(false);
+		return;
+	}
+
+	bool allSucceeded = true;
+
+	for (size_t n = 0; n < objects.size(); ++n)
+	{
+		const HomogenousMatrix4 transformation(elements.data() + n * 16);
+
+		const Rendering::TransformRef transform(objects[n]);
+
+		if (transform && transformation.isValid())
+		{
+			transform->setTransformation(transformation);
+		}
+		else
+		{
+			allSucceeded = false;
+		}
+	}
+
+	info.GetReturnValue().Set(allSucceeded);
+}
+
+template <>
+void JSBase::function<Rendering::EngineRef, JSRenderingEngine::FI_TRANSFORMATIONS>(Rendering::EngineRef& thisValue, const v8::FunctionCallbackInfo<v8::Value>& info)
+{
+	if (thisValue.isNull())
+	{
+		Log::warning() << "The rendering engine does not hold any valid reference.";
+		return;
+	}
+
+	std::vector<Rendering::ObjectRef> objects;
+
+	if (!hasValue(info, 0u, objects))
+	{
+		Log::error() << "RenderingEngine::transformations() needs an Array of RenderingObjects as parameter.";
+		return;
+	}
+
+	std::vector<double> elements(objects.size() * 16, 0.0);
+
+	for (size_t n = 0; n < objects.size(); ++n)
+	{
+		const Rendering::TransformRef transform(objects[n]);
+
+		const HomogenousMatrix4 transformation(transform ? transform->transformation() : HomogenousMatrix4(false));
+
+		transformation.copyElements(elements.data() + n * 16);
+	}
+
+	if (info.Length() >= 2 && !elements.empty() && writeTypedArray(info[1], elements.data(), elements.size()))
+	{
+		info.GetReturnValue().Set(info[1]);
+		return;
+	}
+
+	v8::Isolate* isolate = v8::Isolate::GetCurrent();
+
+	const v8::Local<v8::ArrayBuffer> arrayBuffer(v8::ArrayBuffer::New(isolate, elements.size() * sizeof(double)));
+
+	if (!elements.empty())
+	{
+		memcpy(arrayBuffer->GetBackingStore()->Data(), elements.data(), elements.size() * sizeof(double));
+	}
+
+	info.GetReturnValue().Set(v8::Float64Array::New(arrayBuffer, 0, elements.size()));
+}
+
+
 }
 
 }
@@ -99,7 +99,27 @@ class OCEAN_INTERACTION_JS_EXPORT JSRenderingEngine : public JSObject<JSRenderin
 			 * RenderingObject = RenderingEngine.view()
 			 * </pre>
 			 */
-			FI_VIEW
+			FI_VIEW,
+
+			/**
+			 * Sets the transformations of several rendering objects at once.
+			 * The transformations are provided as one typed array with 16 elements (column aligned) for each object, so that no HomogenousMatrix4 object needs to be created.
+			 * <pre>
+			 * Boolean = RenderingEngine.setTransformations(Array<RenderingObject>, Float64Array)
+			 * Boolean = RenderingEngine.setTransformations(Array<RenderingObject>, Float32Array)
+			 * </pre>
+			 */
+			FI_SET_TRANSFORMATIONS,
+
+			/**
+			 * Returns the transformations of several rendering objects at once, 16 elements (column aligned) for each object.
+			 * An existing typed array can be provided which receives the transformations, e.g., an array which is re-used in every frame.
+			 * <pre>
+			 * Float64Array = RenderingEngine.transformations(Array<RenderingObject>)
+			 * Float64Array = RenderingEngine.transformations(Array<RenderingObject>, Float64Array)
+			 * </pre>
+			 */
+			FI_TRANSFORMATIONS
 		};
 
 	public:
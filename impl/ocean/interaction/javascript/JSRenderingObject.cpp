@@ -1919,24 +1919,42 @@ void JSBase::function<Rendering::ObjectRef, JSRenderingObject::FI_TRANSFORMATION
 {
 	try
 	{
+		HomogenousMatrix4 transformation(false);
+
 		const Rendering::TransformRef transform(thisValue);
+		const Rendering::TextureRef texture(transform ? Rendering::TextureRef() : Rendering::TextureRef(thisValue));
+		const Rendering::ViewRef view(transform || texture ? Rendering::ViewRef() : Rendering::ViewRef(thisValue));
+
 		if (transform)
 		{
-			info.GetReturnValue().Set(createObject<JSHomogenousMatrix4>(transform->transformation(), JSContext::currentContext()));
-			return;
+			transformation = transform->transformation();
 		}
-
-		const Rendering::TextureRef texture(thisValue);
-		if (texture)
+		else if (texture)
 		{
-			info.GetReturnValue().Set(createObject<JSHomogenousMatrix4>(texture->transformation(), JSContext::currentContext()));
-			return;
+			transformation = texture->transformation();
+		}
+		else if (view)
+		{
+			transformation = view->transformation();
 		}
 
-		const Rendering::ViewRef view(thisValue);
-		if (view)
+		if (transform || texture || view)
 		{
-			info.GetReturnValue().Set(createObject<JSHomogenousMatrix4>(view->transformation(), JSContext::currentContext()));
+			// an existing Float64Array or Float32Array with 16 elements can receive the transformation, so that no HomogenousMatrix4 object needs to be created
+
+			if (info.Length() >= 1)
+			{
+				double elements[16];
+				transformation.copyElements(elements);
+
+				if (writeTypedArray(info[0], elements, 16))
+				{
+					info.GetReturnValue().Set(info[0]);
+					return;
+				}
+			}
+
+			info.GetReturnValue().Set(createObject<JSHomogenousMatrix4>(transformation, JSContext::currentContext()));
 			return;
 		}
 	}
@@ -3913,7 +3931,7 @@ void JSBase::function<Rendering::ObjectRef, JSRenderingObject::FI_SET_TRANSFORMA
 		HomogenousMatrix4 transformation;
 		if (!hasValue(info, 0u, transformation))
 		{
-			Log::warning() << "RenderingObject::setTransformation() needs a HomogenousMatrix4 as first parameter.";
+			Log::warning() << "RenderingObject::setTransformation() needs a HomogenousMatrix4 or a typed array with 16 elements as first parameter.";
 			info.GetReturnValue().Set(false);
 			return;
 		}
@@ -44,8 +44,7 @@ bool InputBitstream::read(T& value)
 {
 	if (inputStream_.good())
 	{
-		inputStream_.read((char*)&value, sizeof(T));
-		return inputStream_.good();
+		return readFromStreamBuffer(&value, sizeof(T));
 	}
 
 	return false;
@@ -63,9 +62,7 @@ bool OCEAN_IO_EXPORT InputBitstream::read(wchar_t& value)
 	{
 		int value32;
 
-		inputStream_.read((char*)(&value32), sizeof(int));
-
-		if (inputStream_.good())
+		if (readFromStreamBuffer(&value32, sizeof(int)))
 		{
 			value = wchar_t(value32);
 			return true;
@@ -154,8 +151,7 @@ bool InputBitstream::read(void* data, const size_t size)
 
 	if (inputStream_.good())
 	{
-		inputStream_.read((char*)(data), size);
-		return inputStream_.good();
+		return readFromStreamBuffer(data, size);
 	}
 
 	return false;
@@ -267,6 +263,29 @@ bool InputBitstream::reset()
 	return false;
 }
 
+bool InputBitstream::readFromStreamBuffer(void* data, const size_t size)
+{
+	ocean_assert(data != nullptr && size != 0);
+	ocean_assert(inputStream_.good());
+
+	std::streambuf* streamBuffer = inputStream_.rdbuf();
+
+	if (streamBuffer == nullptr)
+	{
+		inputStream_.setstate(std::ios_base::badbit);
+		return false;
+	}
+
+	if (streamBuffer->sgetn((char*)(data), std::streamsize(size)) != std::streamsize(size))
+	{
+		// same behavior as std::istream::read()
+		inputStream_.setstate(std::ios_base::eofbit | std::ios_base::failbit);
+		return false;
+	}
+
+	return true;
+}
+
 OutputBitstream::OutputBitstream(std::ostream& stream) :
 	outputStream_(stream)
 {
@@ -278,8 +297,7 @@ bool OutputBitstream::write(const T& value)
 {
 	if (outputStream_.good())
 	{
-		outputStream_.write((const char*)(&value), sizeof(T));
-		return outputStream_.good();
+		return writeToStreamBuffer(&value, sizeof(T));
 	}
 
 	return false;
@@ -297,8 +315,7 @@ bool OCEAN_IO_EXPORT OutputBitstream::write(const wchar_t& value)
 	{
 		const int value32 = int(value);
 
-		outputStream_.write((const char*)(&value32), sizeof(int));
-		return outputStream_.good();
+		return writeToStreamBuffer(&value32, sizeof(int));
 	}
 
 	return false;
@@ -359,8 +376,7 @@ bool OutputBitstream::write(const void* data, const size_t size)
 
 	if (outputStream_.good())
 	{
-		outputStream_.write((const char*)(data), size);
-		return outputStream_.good();
+		return writeToStreamBuffer(data, size);
 	}
 
 	return false;
@@ -377,6 +393,23 @@ uint64_t OutputBitstream::size() const
 	return uint64_t(-1);
 }
 
+bool OutputBitstream::writeToStreamBuffer(const void* data, const size_t size)
+{
+	ocean_assert(data != nullptr && size != 0);
+	ocean_assert(outputStream_.good());
+
+	std::streambuf* streamBuffer = outputStream_.rdbuf();
+
+	if (streamBuffer == nullptr || streamBuffer->sputn((const char*)(data), std::streamsize(size)) != std::streamsize(size))
+	{
+		// same behavior as std::ostream::write()
+		outputStream_.setstate(std::ios_base::badbit);
+		return false;
+	}
+
+	return true;
+}
+
 template bool OCEAN_IO_EXPORT InputBitstream::read<bool>(bool&);
 template bool OCEAN_IO_EXPORT InputBitstream::read<char>(char&);
 template bool OCEAN_IO_EXPORT InputBitstream::read<signed char>(signed char&);
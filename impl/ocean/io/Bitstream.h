@@ -45,6 +45,9 @@ namespace IO
  * Data type:          Description:
  * size_t              size_t has 4 bytes on 32 bit platforms and 8 bytes on 64 bit platforms
  * </pre>
+ * Arrays of values can be read with one call of readArray(), which is significantly faster than reading each value individually, the memory layout is identical.<br>
+ * The bitstream accesses the stream buffer of the input stream directly, for data which is available in memory already, combine the bitstream with a MemoryInputStream.
+ * @see MemoryInputStream.
  * @ingroup io
  */
 class OCEAN_IO_EXPORT InputBitstream
@@ -91,6 +94,18 @@ class OCEAN_IO_EXPORT InputBitstream
 		 */
 		bool read(void* data, const size_t size);
 
+		/**
+		 * Reads an array of values from the bitstream with one call and moves the internal position inside the bitstream accordingly.
+		 * The array has the same memory layout as if each value had been read individually with read<T>(), values written with writeArray() or with individual write<T>() calls can be read.<br>
+		 * If the read process fails, the new position of the bitstream may be arbitrary.
+		 * @param values The buffer receiving the values, must be valid if number is not 0
+		 * @param number The number of values to read, with range [0, infinity)
+		 * @return True, if succeeded
+		 * @tparam T The data type of each value, must be an arithmetic data type with platform-independent size (e.g., not wchar_t)
+		 */
+		template <typename T>
+		inline bool readArray(T* values, const size_t number);
+
 		/**
 		 * Reads a value from the bitstream but does not move the internal position inside the bitstream.
 		 * Beware: It's recommended to provide the template argument explicitly to avoid type ambiguities.<br>
@@ -148,6 +163,17 @@ class OCEAN_IO_EXPORT InputBitstream
 		 */
 		explicit inline operator bool() const;
 
+	protected:
+
+		/**
+		 * Reads a memory block directly from the stream buffer of the input stream.
+		 * In contrast to std::istream::read(), this function does not construct a sentry object, which is significant when reading many small values.
+		 * @param data The buffer that will receive the memory block, must be valid
+		 * @param size The number of bytes to read, with range [1, infinity)
+		 * @return True, if succeeded; False, if the stream does not hold enough bytes, the stream's state is updated accordingly
+		 */
+		bool readFromStreamBuffer(void* data, const size_t size);
+
 	protected:
 
 		/// The internal input stream object that this object encapsulates.
@@ -241,6 +267,18 @@ class OCEAN_IO_EXPORT OutputBitstream
 		 */
 		bool write(const void* data, const size_t size);
 
+		/**
+		 * Writes an array of values to the stream with one call and moves the internal position inside the bitstream accordingly.
+		 * The array has the same memory layout as if each value had been written individually with write<T>().<br>
+		 * If the write process fails, the new position of the bitstream may be arbitrary.
+		 * @param values The values to write, must be valid if number is not 0
+		 * @param number The number of values to write, with range [0, infinity)
+		 * @return True, if succeeded
+		 * @tparam T The data type of each value, must be an arithmetic data type with platform-independent size (e.g., not wchar_t)
+		 */
+		template <typename T>
+		inline bool writeArray(const T* values, const size_t number);
+
 		/**
 		 * Returns the current size of the bitstream, in bytes.
 		 * @return The current stream size in bytes, -1 if the current size cannot be determined
@@ -253,6 +291,17 @@ class OCEAN_IO_EXPORT OutputBitstream
 		 */
 		explicit inline operator bool() const;
 
+	protected:
+
+		/**
+		 * Writes a memory block directly into the stream buffer of the output stream.
+		 * In contrast to std::ostream::write(), this function does not construct a sentry object, which is significant when writing many small values.
+		 * @param data The memory block to write, must be valid
+		 * @param size The number of bytes to write, with range [1, infinity)
+		 * @return True, if succeeded; False, if the stream could not take all bytes, the stream's state is updated accordingly
+		 */
+		bool writeToStreamBuffer(const void* data, const size_t size);
+
 	protected:
 
 		/// The internal output stream object that this object encapsulates.
@@ -410,11 +459,43 @@ inline ScopedInputBitstream::~ScopedInputBitstream()
 	}
 }
 
+template <typename T>
+inline bool InputBitstream::readArray(T* values, const size_t number)
+{
+	static_assert(std::is_arithmetic<T>::value, "Invalid data type!");
+	static_assert(!std::is_same<T, wchar_t>::value, "wchar_t has a platform-dependent size and is not supported!");
+
+	ocean_assert(values != nullptr || number == 0);
+
+	if (number > size_t(-1) / sizeof(T))
+	{
+		return false;
+	}
+
+	return read((void*)(values), number * sizeof(T));
+}
+
 inline InputBitstream::operator bool() const
 {
 	return inputStream_.good();
 }
 
+template <typename T>
+inline bool OutputBitstream::writeArray(const T* values, const size_t number)
+{
+	static_assert(std::is_arithmetic<T>::value, "Invalid data type!");
+	static_assert(!std::is_same<T, wchar_t>::value, "wchar_t has a platform-dependent size and is not supported!");
+
+	ocean_assert(values != nullptr || number == 0);
+
+	if (number > size_t(-1) / sizeof(T))
+	{
+		return false;
+	}
+
+	return write((const void*)(values), number * sizeof(T));
+}
+
 inline OutputBitstream::operator bool() const
 {
 	return outputStream_.good();
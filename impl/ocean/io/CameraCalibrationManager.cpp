@@ -6,6 +6,8 @@
  */
 
 #include "ocean/io/CameraCalibrationManager.h"
+#include "ocean/io/JSONDocument.h"
+#include "ocean/io/Utilities.h"
 
 #include "ocean/math/Numeric.h"
 #include "ocean/math/PinholeCamera.h"
@@ -272,16 +274,25 @@ bool CameraCalibrationManager::registerCalibrations(const std::string& url)
 		return false;
 	}
 
+	Utilities::Buffer buffer;
+	if (!Utilities::readFile(url, buffer))
+	{
+		Log::error() << "Failed to read camera calibration file '" << url << "'";
+		return false;
+	}
+
+	// the document indexes the file with SIMD instructions and references the buffer without copying strings
+
 	std::string errorMessage;
-	const JSONParser::JSONValue jsonValue = JSONParser::parse(url, std::string(), false, &errorMessage);
+	const JSONDocument document(std::string_view((const char*)(buffer.data()), buffer.size()), false, &errorMessage);
 
-	if (!jsonValue.isValid())
+	if (!document.isValid())
 	{
 		Log::error() << "Failed to parse camera calibration file '" << url << "': " << errorMessage;
 		return false;
 	}
 
-	return registerCalibrations(jsonValue);
+	return registerCalibrations(document.root().toJSONValue());
 }
 
 bool CameraCalibrationManager::registerCalibrations(const void* buffer, const size_t size)
@@ -291,18 +302,16 @@ bool CameraCalibrationManager::registerCalibrations(const void* buffer, const si
 		return false;
 	}
 
-	const std::string bufferString((const char*)(buffer), size);
-
 	std::string errorMessage;
-	const JSONParser::JSONValue jsonValue = JSONParser::parse(std::string(), bufferString, false, &errorMessage);
+	const JSONDocument document(std::string_view((const char*)(buffer), size), false, &errorMessage);
 
-	if (!jsonValue.isValid())
+	if (!document.isValid())
 	{
 		Log::error() << "Failed to parse camera calibration buffer: " << errorMessage;
 		return false;
 	}
 
-	return registerCalibrations(jsonValue);
+	return registerCalibrations(document.root().toJSONValue());
 }
 
 bool CameraCalibrationManager::registerCalibrations(const JSONParser::JSONValue& jsonValue)
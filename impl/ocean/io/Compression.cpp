@@ -15,21 +15,355 @@ namespace Ocean
 namespace IO
 {
 
-bool Compression::gzipCompress(const void* buffer, const size_t bufferSize, Buffer& compressedBuffer)
+Compression::GzipStreamCompressor::GzipStreamCompressor(const CompressionLevel compressionLevel)
+{
+	stream_ = new z_stream();
+	stream_->zalloc = Z_NULL;
+	stream_->zfree = Z_NULL;
+	stream_->opaque = Z_NULL;
+
+	if (deflateInit2(stream_, translateCompressionLevel(compressionLevel), Z_DEFLATED, (16 + MAX_WBITS), 8, Z_DEFAULT_STRATEGY) != Z_OK)
+	{
+		delete stream_;
+		stream_ = nullptr;
+	}
+}
+
+Compression::GzipStreamCompressor::~GzipStreamCompressor()
+{
+	if (stream_ != nullptr)
+	{
+		deflateEnd(stream_);
+		delete stream_;
+	}
+}
+
+bool Compression::GzipStreamCompressor::compress(const void* buffer, const size_t bufferSize, Buffer& compressedBuffer)
+{
+	ocean_assert(isValid());
+	ocean_assert(buffer != nullptr || bufferSize == 0);
+
+	if (stream_ == nullptr)
+	{
+		return false;
+	}
+
+	if (bufferSize == 0)
+	{
+		return true;
+	}
+
+	const uint8_t* data = (const uint8_t*)(buffer);
+	size_t remainingSize = bufferSize;
+
+	while (remainingSize != 0)
+	{
+		// zlib handles chunks with up to 2^32 - 1 bytes
+
+		const size_t chunkSize = std::min(remainingSize, size_t(0xFFFFFFF0ull));
+
+		stream_->next_in = (Bytef*)(data);
+		stream_->avail_in = (unsigned int)(chunkSize);
+
+		if (!deflateData(Z_NO_FLUSH, compressedBuffer))
+		{
+			return false;
+		}
+
+		data += chunkSize;
+		remainingSize -= chunkSize;
+	}
+
+	return true;
+}
+
+bool Compression::GzipStreamCompressor::finish(Buffer& compressedBuffer)
+{
+	ocean_assert(isValid());
+
+	if (stream_ == nullptr)
+	{
+		return false;
+	}
+
+	stream_->next_in = Z_NULL;
+	stream_->avail_in = 0u;
+
+	const bool result = deflateData(Z_FINISH, compressedBuffer);
+
+	// the compressor can be used for the next stream
+
+	deflateReset(stream_);
+
+	return result;
+}
+
+bool Compression::GzipStreamCompressor::isValid() const
+{
+	return stream_ != nullptr;
+}
+
+bool Compression::GzipStreamCompressor::deflateData(const int flush, Buffer& compressedBuffer)
+{
+	ocean_assert(stream_ != nullptr);
+
+	while (true)
+	{
+		const size_t previousSize = compressedBuffer.size();
+		const size_t chunkSize = std::max(size_t(16384), size_t(deflateBound(stream_, stream_->avail_in)));
+
+		compressedBuffer.resize(previousSize + chunkSize);
+
+		stream_->next_out = (Bytef*)(compressedBuffer.data() + previousSize);
+		stream_->avail_out = (unsigned int)(chunkSize);
+
+		const int error = deflate(stream_, flush);
+
+		compressedBuffer.resize(previousSize + chunkSize - size_t(stream_->avail_out));
+
+		if (error == Z_STREAM_END)
+		{
+			ocean_assert(flush == Z_FINISH);
+			return true;
+		}
+
+		if (error != Z_OK && error != Z_BUF_ERROR)
+		{
+			return false;
+		}
+
+		if (stream_->avail_out != 0u && stream_->avail_in == 0u && flush != Z_FINISH)
+		{
+			// all input data has been consumed, the remaining data will be provided with the next chunk or when finishing
+			return true;
+		}
+	}
+}
+
+Compression::GzipStreamDecompressor::GzipStreamDecompressor()
+{
+	stream_ = new z_stream();
+	stream_->zalloc = Z_NULL;
+	stream_->zfree = Z_NULL;
+	stream_->opaque = Z_NULL;
+	stream_->next_in = Z_NULL;
+	stream_->avail_in = 0u;
+
+	if (inflateInit2(stream_, (16 + MAX_WBITS)) != Z_OK)
+	{
+		delete stream_;
+		stream_ = nullptr;
+	}
+}
+
+Compression::GzipStreamDecompressor::~GzipStreamDecompressor()
+{
+	if (stream_ != nullptr)
+	{
+		inflateEnd(stream_);
+		delete stream_;
+	}
+}
+
+bool Compression::GzipStreamDecompressor::decompress(const void* compressedBuffer, const size_t compressedBufferSize, Buffer& uncompressedBuffer)
+{
+	ocean_assert(isValid());
+	ocean_assert(compressedBuffer != nullptr || compressedBufferSize == 0);
+
+	if (stream_ == nullptr || compressedBufferSize > size_t(0xFFFFFFF0ull))
+	{
+		return false;
+	}
+
+	if (compressedBufferSize == 0)
+	{
+		return true;
+	}
+
+	stream_->next_in = (Bytef*)(compressedBuffer);
+	stream_->avail_in = (unsigned int)(compressedBufferSize);
+
+	while (true)
+	{
+		const size_t previousSize = uncompressedBuffer.size();
+		const size_t chunkSize = std::max(size_t(16384), compressedBufferSize * 2);
+
+		uncompressedBuffer.resize(previousSize + chunkSize);
+
+		stream_->next_out = (Bytef*)(uncompressedBuffer.data() + previousSize);
+		stream_->avail_out = (unsigned int)(chunkSize);
+
+		const int error = inflate(stream_, Z_NO_FLUSH);
+
+		uncompressedBuffer.resize(previousSize + chunkSize - size_t(stream_->avail_out));
+
+		if (error == Z_STREAM_END)
+		{
+			isFinished_ = true;
+
+			if (stream_->avail_in == 0u)
+			{
+				return true;
+			}
+
+			// the buffer contains the next gzip member
+
+			if (inflateReset(stream_) != Z_OK)
+			{
+				return false;
+			}
+
+			isFinished_ = false;
+			continue;
+		}
+
+		if (error == Z_BUF_ERROR && stream_->avail_in == 0u)
+		{
+			// the decompressor needs the next chunk
+			return true;
+		}
+
+		if (error != Z_OK)
+		{
+			return false;
+		}
+
+		if (stream_->avail_in == 0u && stream_->avail_out != 0u)
+		{
+			return true;
+		}
+	}
+}
+
+bool Compression::GzipStreamDecompressor::isFinished() const
+{
+	return isFinished_;
+}
+
+bool Compression::GzipStreamDecompressor::isValid() const
+{
+	return stream_ != nullptr;
+}
+
+bool Compression::gzipCompress(const void* buffer, const size_t bufferSize, Buffer& compressedBuffer, const CompressionLevel compressionLevel, Worker* worker, const size_t blockSize)
 {
 	ocean_assert(compressedBuffer.empty());
 	compressedBuffer.clear();
 
+	ocean_assert(blockSize >= 1);
+
 	if (bufferSize == 0)
 	{
 		return true;
 	}
 
+	if (worker != nullptr && blockSize != 0 && bufferSize > blockSize)
+	{
+		// each block is compressed as individual gzip member, the concatenation of all members is a valid gzip stream
+
+		const size_t numberBlocks = (bufferSize + blockSize - 1) / blockSize;
+
+		if (numberBlocks > size_t(std::numeric_limits<unsigned int>::max()))
+		{
+			return false;
+		}
+
+		std::vector<Buffer> compressedBlocks(numberBlocks);
+		std::atomic<unsigned int> failedBlocks(0u);
+
+		worker->executeFunction(Worker::Function::createStatic(&Compression::gzipCompressBlocksSubset, (const uint8_t*)(buffer), bufferSize, blockSize, compressionLevel, compressedBlocks.data(), &failedBlocks, 0u, 0u), 0u, (unsigned int)(numberBlocks));
+
+		if (failedBlocks != 0u)
+		{
+			return false;
+		}
+
+		size_t compressedSize = 0;
+		for (const Buffer& compressedBlock : compressedBlocks)
+		{
+			compressedSize += compressedBlock.size();
+		}
+
+		compressedBuffer.reserve(compressedSize);
+
+		for (const Buffer& compressedBlock : compressedBlocks)
+		{
+			compressedBuffer.insert(compressedBuffer.end(), compressedBlock.cbegin(), compressedBlock.cend());
+		}
+
+		return true;
+	}
+
 	if (bufferSize > size_t(0xFFFFFFF0ull))
 	{
 		return false;
 	}
 
+	return deflateBuffer(buffer, bufferSize, compressedBuffer, (16 + MAX_WBITS), compressionLevel);
+}
+
+bool Compression::gzipDecompress(const void* compressedBuffer, const size_t compressedBufferSize, Buffer& uncompressedBuffer)
+{
+	ocean_assert(uncompressedBuffer.empty());
+	uncompressedBuffer.clear();
+
+	if (compressedBufferSize == 0)
+	{
+		return true;
+	}
+
+	if (compressedBufferSize > 0xFFFFFFF0ull)
+	{
+		return false;
+	}
+
+	return inflateBuffer(compressedBuffer, compressedBufferSize, uncompressedBuffer, (16 + MAX_WBITS));
+}
+
+bool Compression::zlibCompress(const void* buffer, const size_t bufferSize, Buffer& compressedBuffer, const void* dictionary, const size_t dictionarySize, const CompressionLevel compressionLevel)
+{
+	ocean_assert(compressedBuffer.empty());
+	compressedBuffer.clear();
+
+	ocean_assert(dictionary != nullptr || dictionarySize == 0);
+
+	if (bufferSize == 0)
+	{
+		return true;
+	}
+
+	if (bufferSize > size_t(0xFFFFFFF0ull) || dictionarySize > size_t(0xFFFFFFF0ull))
+	{
+		return false;
+	}
+
+	return deflateBuffer(buffer, bufferSize, compressedBuffer, MAX_WBITS, compressionLevel, dictionary, dictionarySize);
+}
+
+bool Compression::zlibDecompress(const void* compressedBuffer, const size_t compressedBufferSize, Buffer& uncompressedBuffer, const void* dictionary, const size_t dictionarySize)
+{
+	ocean_assert(uncompressedBuffer.empty());
+	uncompressedBuffer.clear();
+
+	ocean_assert(dictionary != nullptr || dictionarySize == 0);
+
+	if (compressedBufferSize == 0)
+	{
+		return true;
+	}
+
+	if (compressedBufferSize > size_t(0xFFFFFFF0ull) || dictionarySize > size_t(0xFFFFFFF0ull))
+	{
+		return false;
+	}
+
+	return inflateBuffer(compressedBuffer, compressedBufferSize, uncompressedBuffer, MAX_WBITS, dictionary, dictionarySize);
+}
+
+bool Compression::deflateBuffer(const void* buffer, const size_t bufferSize, Buffer& compressedBuffer, const int windowBits, const CompressionLevel compressionLevel, const void* dictionary, const size_t dictionarySize)
+{
+	ocean_assert(buffer != nullptr && bufferSize != 0 && bufferSize <= size_t(0xFFFFFFF0ull));
+
 	z_stream stream;
 	stream.zalloc = Z_NULL;
 	stream.zfree = Z_NULL;
@@ -38,11 +372,20 @@ bool Compression::gzipCompress(const void* buffer, const size_t bufferSize, Buff
 	stream.next_in = (Bytef*)(buffer);
 	stream.avail_in = (unsigned int)(bufferSize);
 
-	if (deflateInit2(&stream, Z_DEFAULT_COMPRESSION, Z_DEFLATED, (16 + MAX_WBITS), 8, Z_DEFAULT_STRATEGY) != Z_OK)
+	if (deflateInit2(&stream, translateCompressionLevel(compressionLevel), Z_DEFLATED, windowBits, 8, Z_DEFAULT_STRATEGY) != Z_OK)
 	{
 		return false;
 	}
 
+	if (dictionary != nullptr && dictionarySize != 0)
+	{
+		if (deflateSetDictionary(&stream, (const Bytef*)(dictionary), (unsigned int)(dictionarySize)) != Z_OK)
+		{
+			deflateEnd(&stream);
+			return false;
+		}
+	}
+
 	bool succeeded = true;
 	compressedBuffer.resize(16384);
 
@@ -82,20 +425,9 @@ bool Compression::gzipCompress(const void* buffer, const size_t bufferSize, Buff
 	return true;
 }
 
-bool Compression::gzipDecompress(const void* compressedBuffer, const size_t compressedBufferSize, Buffer& uncompressedBuffer)
+bool Compression::inflateBuffer(const void* compressedBuffer, const size_t compressedBufferSize, Buffer& uncompressedBuffer, const int windowBits, const void* dictionary, const size_t dictionarySize)
 {
-	ocean_assert(uncompressedBuffer.empty());
-	uncompressedBuffer.clear();
-
-	if (compressedBufferSize == 0)
-	{
-		return true;
-	}
-
-	if (compressedBufferSize > 0xFFFFFFF0ull)
-	{
-		return false;
-	}
+	ocean_assert(compressedBuffer != nullptr && compressedBufferSize != 0 && compressedBufferSize <= size_t(0xFFFFFFF0ull));
 
 	const size_t fullLength = compressedBufferSize;
 	const size_t halfLength = compressedBufferSize / 2;
@@ -108,8 +440,9 @@ bool Compression::gzipDecompress(const void* compressedBuffer, const size_t comp
 	stream.total_out = 0;
 	stream.zalloc = Z_NULL;
 	stream.zfree = Z_NULL;
+	stream.opaque = Z_NULL;
 
-	if (inflateInit2(&stream, (16 + MAX_WBITS)) != Z_OK)
+	if (inflateInit2(&stream, windowBits) != Z_OK)
 	{
 		return false;
 	}
@@ -117,16 +450,22 @@ bool Compression::gzipDecompress(const void* compressedBuffer, const size_t comp
 	bool succeeded = true;
 	uncompressedBuffer.resize(uncompressedLength);
 
+	// the number of bytes of all previous gzip members, as inflateReset() resets the total number of output bytes
+
+	size_t previousMembersSize = 0;
+
 	while (true)
 	{
-		// check whether the output buffer is too small
-		if (stream.total_out >= (unsigned int)uncompressedBuffer.size())
+		const size_t totalOut = previousMembersSize + size_t(stream.total_out);
+
+		// check whether the output buffer is too small, the buffer grows geometrically as well compressed data can be much larger than the compressed buffer
+		if (totalOut >= uncompressedBuffer.size())
 		{
-			uncompressedBuffer.resize(uncompressedBuffer.size() + halfLength);
+			uncompressedBuffer.resize(uncompressedBuffer.size() + std::max(std::max(halfLength, uncompressedBuffer.size()), size_t(16384)));
 		}
 
-		stream.next_out = (Bytef*)(uncompressedBuffer.data() + stream.total_out);
-		stream.avail_out = (unsigned int)uncompressedBuffer.size() - (unsigned int)stream.total_out;
+		stream.next_out = (Bytef*)(uncompressedBuffer.data() + totalOut);
+		stream.avail_out = (unsigned int)(std::min(uncompressedBuffer.size() - totalOut, size_t(0xFFFFFFF0ull)));
 
 		// inflate the next chunk
 
@@ -134,8 +473,31 @@ bool Compression::gzipDecompress(const void* compressedBuffer, const size_t comp
 
 		if (error == Z_STREAM_END)
 		{
+			if (stream.avail_in != 0u && windowBits > MAX_WBITS)
+			{
+				// the buffer contains a further gzip member
+
+				previousMembersSize += size_t(stream.total_out);
+
+				if (inflateReset(&stream) != Z_OK)
+				{
+					succeeded = false;
+					break;
+				}
+
+				continue;
+			}
+
 			break;
 		}
+		else if (error == Z_NEED_DICT)
+		{
+			if (dictionary == nullptr || dictionarySize == 0 || inflateSetDictionary(&stream, (const Bytef*)(dictionary), (unsigned int)(dictionarySize)) != Z_OK)
+			{
+				succeeded = false;
+				break;
+			}
+		}
 		else if (error != Z_OK)
 		{
 			succeeded = false;
@@ -143,16 +505,55 @@ bool Compression::gzipDecompress(const void* compressedBuffer, const size_t comp
 		}
 	}
 
+	const size_t totalOut = previousMembersSize + size_t(stream.total_out);
+
 	if (inflateEnd(&stream) != Z_OK || !succeeded)
 	{
 		uncompressedBuffer.clear();
 		return false;
 	}
 
-	uncompressedBuffer.resize(stream.total_out);
+	uncompressedBuffer.resize(totalOut);
 	return true;
 }
 
+void Compression::gzipCompressBlocksSubset(const uint8_t* buffer, const size_t bufferSize, const size_t blockSize, const CompressionLevel compressionLevel, Buffer* compressedBlocks, std::atomic<unsigned int>* failedBlocks, const unsigned int firstBlock, const unsigned int numberBlocks)
+{
+	ocean_assert(buffer != nullptr && bufferSize != 0 && blockSize != 0);
+	ocean_assert(compressedBlocks != nullptr && failedBlocks != nullptr);
+
+	for (unsigned int blockIndex = firstBlock; blockIndex < firstBlock + numberBlocks; ++blockIndex)
+	{
+		const size_t blockStart = size_t(blockIndex) * blockSize;
+		ocean_assert(blockStart < bufferSize);
+
+		const size_t size = std::min(blockSize, bufferSize - blockStart);
+
+		if (size > size_t(0xFFFFFFF0ull) || !deflateBuffer(buffer + blockStart, size, compressedBlocks[blockIndex], (16 + MAX_WBITS), compressionLevel))
+		{
+			++(*failedBlocks);
+		}
+	}
+}
+
+int Compression::translateCompressionLevel(const CompressionLevel compressionLevel)
+{
+	switch (compressionLevel)
+	{
+		case CL_FASTEST:
+			return Z_BEST_SPEED;
+
+		case CL_DEFAULT:
+			return Z_DEFAULT_COMPRESSION;
+
+		case CL_SMALLEST:
+			return Z_BEST_COMPRESSION;
+	}
+
+	ocean_assert(false && "Invalid compression level!");
+	return Z_DEFAULT_COMPRESSION;
+}
+
 }
 
 }
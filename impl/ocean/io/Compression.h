@@ -10,8 +10,14 @@
 
 #include "ocean/io/IO.h"
 
+#include "ocean/base/Worker.h"
+
+#include <atomic>
 #include <vector>
 
+// Forward declaration.
+struct z_stream_s;
+
 namespace Ocean
 {
 
@@ -31,25 +37,244 @@ class OCEAN_IO_EXPORT Compression
 		 */
 		using Buffer = std::vector<uint8_t>;
 
+		/**
+		 * Definition of individual compression levels.
+		 */
+		enum CompressionLevel : uint32_t
+		{
+			/// The fastest compression, e.g., for live recordings.
+			CL_FASTEST = 0u,
+			/// The default compression, a compromise between speed and size.
+			CL_DEFAULT,
+			/// The smallest result, the slowest compression.
+			CL_SMALLEST
+		};
+
+		/**
+		 * This class implements a gzip compressor for data which is provided in several chunks.
+		 * The resulting stream is identical to a stream compressed with gzipCompress() and can be decompressed with gzipDecompress() or with GzipStreamDecompressor.
+		 */
+		class OCEAN_IO_EXPORT GzipStreamCompressor
+		{
+			public:
+
+				/**
+				 * Creates a new stream compressor.
+				 * @param compressionLevel The compression level to be used
+				 */
+				explicit GzipStreamCompressor(const CompressionLevel compressionLevel = CL_FASTEST);
+
+				/**
+				 * Destructs the stream compressor.
+				 */
+				~GzipStreamCompressor();
+
+				/**
+				 * Compresses the next chunk of data.
+				 * @param buffer The chunk to compress, can be nullptr if 'bufferSize == 0'
+				 * @param bufferSize The size of the chunk, in bytes, with range [0, infinity)
+				 * @param compressedBuffer The buffer to which the compressed data will be appended, the compressor may buffer data internally and may not append anything
+				 * @return True, if succeeded
+				 */
+				bool compress(const void* buffer, const size_t bufferSize, Buffer& compressedBuffer);
+
+				/**
+				 * Finishes the stream and appends all remaining compressed data.
+				 * Afterwards, the compressor can be used for a new stream.
+				 * @param compressedBuffer The buffer to which the remaining compressed data will be appended
+				 * @return True, if succeeded
+				 */
+				bool finish(Buffer& compressedBuffer);
+
+				/**
+				 * Returns whether this compressor is valid.
+				 * @return True, if so
+				 */
+				bool isValid() const;
+
+			protected:
+
+				/**
+				 * Disabled copy constructor.
+				 */
+				GzipStreamCompressor(const GzipStreamCompressor&) = delete;
+
+				/**
+				 * Disabled copy operator.
+				 * @return Reference to this object
+				 */
+				GzipStreamCompressor& operator=(const GzipStreamCompressor&) = delete;
+
+				/**
+				 * Deflates the pending input data and appends the result.
+				 * @param flush The zlib flush mode
+				 * @param compressedBuffer The buffer to which the compressed data will be appended
+				 * @return True, if succeeded
+				 */
+				bool deflateData(const int flush, Buffer& compressedBuffer);
+
+			protected:
+
+				/// The zlib stream, nullptr if invalid.
+				z_stream_s* stream_ = nullptr;
+		};
+
+		/**
+		 * This class implements a gzip decompressor for compressed data which is provided in several chunks.
+		 */
+		class OCEAN_IO_EXPORT GzipStreamDecompressor
+		{
+			public:
+
+				/**
+				 * Creates a new stream decompressor.
+				 */
+				GzipStreamDecompressor();
+
+				/**
+				 * Destructs the stream decompressor.
+				 */
+				~GzipStreamDecompressor();
+
+				/**
+				 * Decompresses the next chunk of compressed data.
+				 * @param compressedBuffer The chunk to decompress, can be nullptr if 'compressedBufferSize == 0'
+				 * @param compressedBufferSize The size of the chunk, in bytes, with range [0, infinity)
+				 * @param uncompressedBuffer The buffer to which the uncompressed data will be appended
+				 * @return True, if succeeded; False, if the data is corrupted
+				 */
+				bool decompress(const void* compressedBuffer, const size_t compressedBufferSize, Buffer& uncompressedBuffer);
+
+				/**
+				 * Returns whether the end of a gzip stream has been reached.
+				 * @return True, if so
+				 */
+				bool isFinished() const;
+
+				/**
+				 * Returns whether this decompressor is valid.
+				 * @return True, if so
+				 */
+				bool isValid() const;
+
+			protected:
+
+				/**
+				 * Disabled copy constructor.
+				 */
+				GzipStreamDecompressor(const GzipStreamDecompressor&) = delete;
+
+				/**
+				 * Disabled copy operator.
+				 * @return Reference to this object
+				 */
+				GzipStreamDecompressor& operator=(const GzipStreamDecompressor&) = delete;
+
+			protected:
+
+				/// The zlib stream, nullptr if invalid.
+				z_stream_s* stream_ = nullptr;
+
+				/// True, if the end of the stream has been reached.
+				bool isFinished_ = false;
+		};
+
 	public:
 
 		/**
 		 * Compresses a buffer with gzip
+		 * In case a worker is provided, buffers larger than the block size are split into blocks which are compressed concurrently, each block is stored as an individual gzip member.
 		 * @param buffer The buffer to compress
 		 * @param bufferSize The size of the buffer, in bytes
 		 * @param compressedBuffer The compressed buffer
+		 * @param compressionLevel The compression level to be used
+		 * @param worker Optional worker to compress the blocks in parallel, nullptr to compress the buffer as one block
+		 * @param blockSize The size of each block when using a worker, in bytes, with range [1, infinity)
 		 * @return True, if succeeded
 		 */
-		static bool gzipCompress(const void* buffer, const size_t bufferSize, Buffer& compressedBuffer);
+		static bool gzipCompress(const void* buffer, const size_t bufferSize, Buffer& compressedBuffer, const CompressionLevel compressionLevel = CL_DEFAULT, Worker* worker = nullptr, const size_t blockSize = 1024 * 1024);
 
 		/**
 		 * Decompresses a buffer which has been compressed with gzip
+		 * The buffer may contain several consecutive gzip members, e.g., when compressed with a worker.
 		 * @param compressedBuffer The compressed buffer
 		 * @param compressedBufferSize The size of the uncompressed buffer, in bytes
 		 * @param uncompressedBuffer The uncompressed buffer
 		 * @return True, if succeeded
 		 */
 		static bool gzipDecompress(const void* compressedBuffer, const size_t compressedBufferSize, Buffer& uncompressedBuffer);
+
+		/**
+		 * Compresses a buffer with zlib and an optional preset dictionary.
+		 * A dictionary containing data typical for the buffer improves the compression ratio of small buffers significantly.
+		 * @param buffer The buffer to compress
+		 * @param bufferSize The size of the buffer, in bytes
+		 * @param compressedBuffer The compressed buffer
+		 * @param dictionary The optional dictionary, nullptr to compress without dictionary
+		 * @param dictionarySize The size of the dictionary, in bytes, with range [0, infinity)
+		 * @param compressionLevel The compression level to be used
+		 * @return True, if succeeded
+		 * @see zlibDecompress().
+		 */
+		static bool zlibCompress(const void* buffer, const size_t bufferSize, Buffer& compressedBuffer, const void* dictionary = nullptr, const size_t dictionarySize = 0, const CompressionLevel compressionLevel = CL_DEFAULT);
+
+		/**
+		 * Decompresses a buffer which has been compressed with zlibCompress().
+		 * @param compressedBuffer The compressed buffer
+		 * @param compressedBufferSize The size of the compressed buffer, in bytes
+		 * @param uncompressedBuffer The uncompressed buffer
+		 * @param dictionary The dictionary which has been used for compression, nullptr if no dictionary has been used
+		 * @param dictionarySize The size of the dictionary, in bytes, with range [0, infinity)
+		 * @return True, if succeeded
+		 */
+		static bool zlibDecompress(const void* compressedBuffer, const size_t compressedBufferSize, Buffer& uncompressedBuffer, const void* dictionary = nullptr, const size_t dictionarySize = 0);
+
+	protected:
+
+		/**
+		 * Compresses a buffer as one zlib or gzip stream.
+		 * @param buffer The buffer to compress
+		 * @param bufferSize The size of the buffer, in bytes, with range [1, 0xFFFFFFF0]
+		 * @param compressedBuffer The compressed buffer
+		 * @param windowBits The zlib window bits, defining the stream format
+		 * @param compressionLevel The compression level to be used
+		 * @param dictionary The optional dictionary, nullptr to compress without dictionary
+		 * @param dictionarySize The size of the dictionary, in bytes
+		 * @return True, if succeeded
+		 */
+		static bool deflateBuffer(const void* buffer, const size_t bufferSize, Buffer& compressedBuffer, const int windowBits, const CompressionLevel compressionLevel, const void* dictionary = nullptr, const size_t dictionarySize = 0);
+
+		/**
+		 * Decompresses a buffer holding zlib or gzip streams, gzip buffers may contain several consecutive streams.
+		 * @param compressedBuffer The compressed buffer
+		 * @param compressedBufferSize The size of the compressed buffer, in bytes, with range [1, 0xFFFFFFF0]
+		 * @param uncompressedBuffer The uncompressed buffer
+		 * @param windowBits The zlib window bits, defining the stream format
+		 * @param dictionary The optional dictionary, nullptr to decompress without dictionary
+		 * @param dictionarySize The size of the dictionary, in bytes
+		 * @return True, if succeeded
+		 */
+		static bool inflateBuffer(const void* compressedBuffer, const size_t compressedBufferSize, Buffer& uncompressedBuffer, const int windowBits, const void* dictionary = nullptr, const size_t dictionarySize = 0);
+
+		/**
+		 * Compresses a subset of blocks of a buffer with gzip.
+		 * @param buffer The buffer to compress, must be valid
+		 * @param bufferSize The size of the buffer, in bytes, with range [1, infinity)
+		 * @param blockSize The size of each block, in bytes, with range [1, infinity)
+		 * @param compressionLevel The compression level to be used
+		 * @param compressedBlocks The resulting compressed blocks, one for each block
+		 * @param failedBlocks The resulting number of blocks which could not be compressed
+		 * @param firstBlock The first block to be handled
+		 * @param numberBlocks The number of blocks to be handled
+		 */
+		static void gzipCompressBlocksSubset(const uint8_t* buffer, const size_t bufferSize, const size_t blockSize, const CompressionLevel compressionLevel, Buffer* compressedBlocks, std::atomic<unsigned int>* failedBlocks, const unsigned int firstBlock, const unsigned int numberBlocks);
+
+		/**
+		 * Translates a compression level to a zlib compression level.
+		 * @param compressionLevel The compression level to translate
+		 * @return The zlib compression level
+		 */
+		static int translateCompressionLevel(const CompressionLevel compressionLevel);
 };
 
 }
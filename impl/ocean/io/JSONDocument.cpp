@@ -0,0 +1,1054 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "ocean/io/JSONDocument.h"
+
+#include "ocean/base/String.h"
+
+#include <bit>
+#include <cstring>
+
+#if defined(OCEAN_HARDWARE_SSE_VERSION) && OCEAN_HARDWARE_SSE_VERSION >= 20
+	#include <emmintrin.h>
+#elif defined(OCEAN_HARDWARE_NEON_VERSION) && OCEAN_HARDWARE_NEON_VERSION >= 10 && defined(__aarch64__)
+	#include <arm_neon.h>
+#endif // OCEAN_HARDWARE_SSE_VERSION, OCEAN_HARDWARE_NEON_VERSION
+
+namespace Ocean
+{
+
+namespace IO
+{
+
+JSONDocument::Iterator::Iterator(const JSONDocument* document, const uint32_t index, const uint32_t closeIndex, const bool isObject) :
+	document_(document),
+	index_(index),
+	closeIndex_(closeIndex),
+	isObject_(isObject)
+{
+	ocean_assert(document_ != nullptr);
+	ocean_assert(index_ <= closeIndex_);
+
+	if (index_ != closeIndex_ && document_->skipWhitespace(document_->structurals_[index_] + 1u) == document_->structurals_[closeIndex_])
+	{
+		// an empty array or object
+		index_ = closeIndex_;
+	}
+
+	if (index_ != closeIndex_)
+	{
+		update();
+	}
+}
+
+JSONDocument::Iterator& JSONDocument::Iterator::operator++()
+{
+	ocean_assert(document_ != nullptr);
+	ocean_assert(index_ != closeIndex_);
+
+	if (index_ == closeIndex_)
+	{
+		return *this;
+	}
+
+	const uint32_t nextIndex = value_.nextIndex();
+	ocean_assert(nextIndex <= closeIndex_);
+
+	if (nextIndex == closeIndex_ || document_->skipWhitespace(document_->structurals_[nextIndex] + 1u) == document_->structurals_[closeIndex_])
+	{
+		// either the closing character, or a trailing comma followed by the closing character (lenient mode)
+
+		index_ = closeIndex_;
+
+		value_ = Value();
+		key_ = std::string_view();
+	}
+	else
+	{
+		ocean_assert(document_->buffer_[document_->structurals_[nextIndex]] == ',');
+
+		index_ = nextIndex;
+
+		update();
+	}
+
+	return *this;
+}
+
+void JSONDocument::Iterator::update()
+{
+	ocean_assert(document_ != nullptr);
+	ocean_assert(index_ < closeIndex_);
+
+	const Indices& structurals = document_->structurals_;
+
+	if (isObject_)
+	{
+		// { or , followed by "key" : value
+
+		ocean_assert(index_ + 4u < structurals.size());
+		ocean_assert(document_->buffer_[structurals[index_ + 1u]] == '\"' && document_->buffer_[structurals[index_ + 3u]] == ':');
+
+		const uint32_t keyPosition = structurals[index_ + 1u] + 1u;
+		key_ = document_->buffer_.substr(keyPosition, structurals[index_ + 2u] - keyPosition);
+
+		value_ = document_->createValue(index_ + 4u, document_->skipWhitespace(structurals[index_ + 3u] + 1u));
+	}
+	else
+	{
+		// [ or , followed by value
+
+		value_ = document_->createValue(index_ + 1u, document_->skipWhitespace(structurals[index_] + 1u));
+	}
+}
+
+bool JSONDocument::Value::boolean() const
+{
+	if (type_ != JSONParser::JSONValue::TYPE_BOOLEAN)
+	{
+		return false;
+	}
+
+	ocean_assert(document_ != nullptr);
+
+	return document_->buffer_[position_] == 't';
+}
+
+double JSONDocument::Value::number() const
+{
+	if (type_ != JSONParser::JSONValue::TYPE_NUMBER)
+	{
+		return 0.0;
+	}
+
+	ocean_assert(document_ != nullptr);
+
+	double value = 0.0;
+
+	if (!String::isNumber(std::string(document_->scalar(index_, position_)), true /*acceptInteger*/, &value))
+	{
+		ocean_assert(false && "The number has been validated already!");
+		return 0.0;
+	}
+
+	return value;
+}
+
+std::string_view JSONDocument::Value::stringView() const
+{
+	if (type_ != JSONParser::JSONValue::TYPE_STRING)
+	{
+		return std::string_view();
+	}
+
+	ocean_assert(document_ != nullptr);
+	ocean_assert(index_ + 1u < document_->structurals_.size());
+
+	return document_->buffer_.substr(position_ + 1u, document_->structurals_[index_ + 1u] - position_ - 1u);
+}
+
+std::string JSONDocument::Value::string() const
+{
+	const std::string_view view = stringView();
+
+	std::string result;
+	result.reserve(view.size());
+
+	size_t n = 0;
+
+	while (n < view.size())
+	{
+		const char c = view[n++];
+
+		if (c != '\\' || n == view.size())
+		{
+			result.push_back(c);
+			continue;
+		}
+
+		const char escaped = view[n++];
+
+		switch (escaped)
+		{
+			case '\"':
+			case '\\':
+			case '/':
+				result.push_back(escaped);
+				break;
+
+			case 'b':
+				result.push_back('\b');
+				break;
+
+			case 'f':
+				result.push_back('\f');
+				break;
+
+			case 'n':
+				result.push_back('\n');
+				break;
+
+			case 'r':
+				result.push_back('\r');
+				break;
+
+			case 't':
+				result.push_back('\t');
+				break;
+
+			case 'u':
+			{
+				const auto readHex = [&view](const size_t position, uint32_t& value) -> bool
+				{
+					if (position + 4 > view.size())
+					{
+						return false;
+					}
+
+					value = 0u;
+
+					for (size_t i = position; i < position + 4; ++i)
+					{
+						const char h = view[i];
+
+						value <<= 4u;
+
+						if (h >= '0' && h <= '9')
+						{
+							value |= uint32_t(h - '0');
+						}
+						else if (h >= 'a' && h <= 'f')
+						{
+							value |= uint32_t(h - 'a' + 10);
+						}
+						else if (h >= 'A' && h <= 'F')
+						{
+							value |= uint32_t(h - 'A' + 10);
+						}
+						else
+						{
+							return false;
+						}
+					}
+
+					return true;
+				};
+
+				uint32_t codePoint = 0u;
+
+				if (!readHex(n, codePoint))
+				{
+					// invalid escape sequence, we keep the characters as they are
+
+					result.push_back('\\');
+					result.push_back('u');
+					break;
+				}
+
+				n += 4;
+
+				uint32_t lowSurrogate = 0u;
+
+				if (codePoint >= 0xD800u && codePoint <= 0xDBFFu && n + 6 <= view.size() && view[n] == '\\' && view[n + 1] == 'u' && readHex(n + 2, lowSurrogate) && lowSurrogate >= 0xDC00u && lowSurrogate <= 0xDFFFu)
+				{
+					codePoint = 0x10000u + ((codePoint - 0xD800u) << 10u) + (lowSurrogate - 0xDC00u);
+					n += 6;
+				}
+
+				if (codePoint < 0x80u)
+				{
+					result.push_back(char(codePoint));
+				}
+				else if (codePoint < 0x800u)
+				{
+					result.push_back(char(0xC0u | (codePoint >> 6u)));
+					result.push_back(char(0x80u | (codePoint & 0x3Fu)));
+				}
+				else if (codePoint < 0x10000u)
+				{
+					result.push_back(char(0xE0u | (codePoint >> 12u)));
+					result.push_back(char(0x80u | ((codePoint >> 6u) & 0x3Fu)));
+					result.push_back(char(0x80u | (codePoint & 0x3Fu)));
+				}
+				else
+				{
+					result.push_back(char(0xF0u | (codePoint >> 18u)));
+					result.push_back(char(0x80u | ((codePoint >> 12u) & 0x3Fu)));
+					result.push_back(char(0x80u | ((codePoint >> 6u) & 0x3Fu)));
+					result.push_back(char(0x80u | (codePoint & 0x3Fu)));
+				}
+
+				break;
+			}
+
+			default:
+				// unknown escape sequence, we keep the characters as they are
+				result.push_back('\\');
+				result.push_back(escaped);
+				break;
+		}
+	}
+
+	return result;
+}
+
+size_t JSONDocument::Value::size() const
+{
+	if (type_ != JSONParser::JSONValue::TYPE_ARRAY && type_ != JSONParser::JSONValue::TYPE_OBJECT)
+	{
+		return 0;
+	}
+
+	size_t result = 0;
+
+	for (Iterator iterator = begin(); iterator != end(); ++iterator)
+	{
+		++result;
+	}
+
+	return result;
+}
+
+JSONDocument::Value JSONDocument::Value::valueFromObject(const std::string_view& key) const
+{
+	if (type_ != JSONParser::JSONValue::TYPE_OBJECT)
+	{
+		return Value();
+	}
+
+	Value result;
+
+	for (Iterator iterator = begin(); iterator != end(); ++iterator)
+	{
+		if (iterator.key() == key)
+		{
+			result = *iterator;
+		}
+	}
+
+	return result;
+}
+
+JSONDocument::Value JSONDocument::Value::valueFromArray(const size_t index) const
+{
+	if (type_ != JSONParser::JSONValue::TYPE_ARRAY)
+	{
+		return Value();
+	}
+
+	size_t n = 0;
+
+	for (Iterator iterator = begin(); iterator != end(); ++iterator)
+	{
+		if (n++ == index)
+		{
+			return *iterator;
+		}
+	}
+
+	return Value();
+}
+
+JSONDocument::Iterator JSONDocument::Value::begin() const
+{
+	if (type_ != JSONParser::JSONValue::TYPE_ARRAY && type_ != JSONParser::JSONValue::TYPE_OBJECT)
+	{
+		return Iterator();
+	}
+
+	ocean_assert(document_ != nullptr);
+
+	return Iterator(document_, index_, document_->closeIndices_[index_], type_ == JSONParser::JSONValue::TYPE_OBJECT);
+}
+
+JSONDocument::Iterator JSONDocument::Value::end() const
+{
+	if (type_ != JSONParser::JSONValue::TYPE_ARRAY && type_ != JSONParser::JSONValue::TYPE_OBJECT)
+	{
+		return Iterator();
+	}
+
+	ocean_assert(document_ != nullptr);
+
+	const uint32_t closeIndex = document_->closeIndices_[index_];
+
+	return Iterator(document_, closeIndex, closeIndex, type_ == JSONParser::JSONValue::TYPE_OBJECT);
+}
+
+JSONParser::JSONValue JSONDocument::Value::toJSONValue() const
+{
+	switch (type_)
+	{
+		case JSONParser::JSONValue::TYPE_INVALID:
+			return JSONParser::JSONValue();
+
+		case JSONParser::JSONValue::TYPE_NULL:
+			return JSONParser::JSONValue(nullptr);
+
+		case JSONParser::JSONValue::TYPE_BOOLEAN:
+			return JSONParser::JSONValue(boolean());
+
+		case JSONParser::JSONValue::TYPE_NUMBER:
+			return JSONParser::JSONValue(number());
+
+		case JSONParser::JSONValue::TYPE_STRING:
+			return JSONParser::JSONValue(std::string(stringView()));
+
+		case JSONParser::JSONValue::TYPE_ARRAY:
+		{
+			JSONParser::JSONValue::Array array;
+
+			for (Iterator iterator = begin(); iterator != end(); ++iterator)
+			{
+				array.emplace_back(iterator->toJSONValue());
+			}
+
+			return JSONParser::JSONValue(std::move(array));
+		}
+
+		case JSONParser::JSONValue::TYPE_OBJECT:
+		{
+			JSONParser::JSONValue::ObjectMap objectMap;
+
+			for (Iterator iterator = begin(); iterator != end(); ++iterator)
+			{
+				objectMap[std::string(iterator.key())] = iterator->toJSONValue();
+			}
+
+			return JSONParser::JSONValue(std::move(objectMap));
+		}
+	}
+
+	ocean_assert(false && "Invalid type!");
+	return JSONParser::JSONValue();
+}
+
+uint32_t JSONDocument::Value::nextIndex() const
+{
+	ocean_assert(document_ != nullptr);
+
+	switch (type_)
+	{
+		case JSONParser::JSONValue::TYPE_ARRAY:
+		case JSONParser::JSONValue::TYPE_OBJECT:
+			return document_->closeIndices_[index_] + 1u;
+
+		case JSONParser::JSONValue::TYPE_STRING:
+			return index_ + 2u;
+
+		default:
+			break;
+	}
+
+	// scalars do not have any structural character
+	return index_;
+}
+
+JSONDocument::JSONDocument(std::string&& buffer, const bool strict, std::string* errorMessage) :
+	ownedBuffer_(std::move(buffer))
+{
+	buffer_ = std::string_view(ownedBuffer_);
+
+	isValid_ = parse(strict, errorMessage);
+}
+
+JSONDocument::JSONDocument(const std::string_view& buffer, const bool strict, std::string* errorMessage) :
+	buffer_(buffer)
+{
+	isValid_ = parse(strict, errorMessage);
+}
+
+JSONDocument::Value JSONDocument::root() const
+{
+	if (!isValid_)
+	{
+		return Value();
+	}
+
+	return createValue(0u, skipWhitespace(0u));
+}
+
+bool JSONDocument::determineStructurals(const std::string_view& buffer, Indices& structurals)
+{
+	ocean_assert(buffer.size() < size_t(uint32_t(-1)));
+
+	structurals.clear();
+	structurals.reserve(buffer.size() / 8 + 16);
+
+	// true, if the previous block ended with an unescaped backslash
+	bool escapeCarry = false;
+
+	// true, if the previous block ended inside a string
+	bool stringCarry = false;
+
+	char paddedBlock[64];
+
+	for (size_t blockStart = 0; blockStart < buffer.size(); blockStart += 64)
+	{
+		const char* block = buffer.data() + blockStart;
+
+		if (blockStart + 64 > buffer.size())
+		{
+			// the last block is padded with spaces, which are never structural
+
+			memset(paddedBlock, ' ', sizeof(paddedBlock));
+			memcpy(paddedBlock, block, buffer.size() - blockStart);
+
+			block = paddedBlock;
+		}
+
+		uint64_t quotes;
+		uint64_t backslashes;
+		uint64_t structuralCharacters;
+		determineMasks(block, quotes, backslashes, structuralCharacters);
+
+		// determining all escaped characters, backslashes are rare so that we simply check one after another
+
+		uint64_t escaped = 0ull;
+
+		if (backslashes != 0ull || escapeCarry)
+		{
+			for (unsigned int n = 0u; n < 64u; ++n)
+			{
+				const uint64_t bit = uint64_t(1) << n;
+
+				if (escapeCarry)
+				{
+					escaped |= bit;
+					escapeCarry = false;
+				}
+				else if (backslashes & bit)
+				{
+					escapeCarry = true;
+				}
+			}
+		}
+
+		quotes &= ~escaped;
+
+		// each bit within a string is set, including the opening quote and excluding the closing quote
+
+		uint64_t insideString = prefixXor(quotes);
+
+		if (stringCarry)
+		{
+			insideString = ~insideString;
+		}
+
+		stringCarry = (insideString >> 63u) != 0ull;
+
+		uint64_t structuralMask = (structuralCharacters & ~insideString) | quotes;
+
+		while (structuralMask != 0ull)
+		{
+			structurals.emplace_back(uint32_t(blockStart) + uint32_t(std::countr_zero(structuralMask)));
+
+			structuralMask &= structuralMask - 1ull;
+		}
+	}
+
+	return !stringCarry;
+}
+
+bool JSONDocument::parse(const bool strict, std::string* errorMessage)
+{
+	if (buffer_.size() >= size_t(uint32_t(-1)))
+	{
+		if (errorMessage != nullptr)
+		{
+			*errorMessage = "JSON parsing error: The buffer is too large";
+		}
+
+		return false;
+	}
+
+	if (!determineStructurals(buffer_, structurals_))
+	{
+		if (errorMessage != nullptr)
+		{
+			*errorMessage = createErrorMessage(structurals_.empty() ? 0u : structurals_.back(), "Unterminated string");
+		}
+
+		return false;
+	}
+
+	// the buffer size is used as terminating entry, so that each scalar value is followed by a structural entry
+	structurals_.emplace_back(uint32_t(buffer_.size()));
+
+	closeIndices_.resize(structurals_.size());
+
+	return validate(strict, errorMessage);
+}
+
+bool JSONDocument::validate(const bool strict, std::string* errorMessage)
+{
+	/**
+	 * Definition of the states of the validation.
+	 */
+	enum State : uint32_t
+	{
+		/// A value is expected.
+		STATE_VALUE,
+		/// The first member of an object or the end of the object is expected.
+		STATE_FIRST_MEMBER,
+		/// A member of an object is expected after a comma.
+		STATE_MEMBER,
+		/// The first element of an array or the end of the array is expected.
+		STATE_FIRST_ELEMENT,
+		/// An element of an array is expected after a comma.
+		STATE_ELEMENT,
+		/// A comma or the end of an array or object is expected after a value.
+		STATE_AFTER_VALUE
+	};
+
+	const auto setError = [this, errorMessage](const uint32_t position, const std::string& message)
+	{
+		if (errorMessage != nullptr)
+		{
+			*errorMessage = createErrorMessage(position, message);
+		}
+
+		return false;
+	};
+
+	const uint32_t size = uint32_t(buffer_.size());
+	const uint32_t endIndex = uint32_t(structurals_.size() - 1);
+
+	// the indices of the currently open arrays and objects
+	Indices openIndices;
+	openIndices.reserve(32);
+
+	uint32_t index = 0u;
+	uint32_t position = skipWhitespace(0u);
+
+	State state = STATE_VALUE;
+
+	while (true)
+	{
+		ocean_assert(index <= endIndex);
+
+		const bool isStructural = structurals_[index] == position && index != endIndex;
+		const char character = position < size ? buffer_[position] : '\0';
+
+		switch (state)
+		{
+			case STATE_FIRST_MEMBER:
+			case STATE_MEMBER:
+			{
+				if (isStructural && character == '}')
+				{
+					if (state == STATE_MEMBER && strict)
+					{
+						return setError(position, "Trailing comma in object");
+					}
+
+					state = STATE_AFTER_VALUE;
+					break;
+				}
+
+				if (!isStructural || character != '\"')
+				{
+					return setError(position, position < size ? "Expected string key in object" : "Unexpected end of file");
+				}
+
+				ocean_assert(index + 1u < endIndex);
+
+				index += 2u;
+				position = skipWhitespace(structurals_[index - 1u] + 1u);
+
+				if (structurals_[index] != position || index == endIndex || buffer_[position] != ':')
+				{
+					return setError(position, "Expected ':' after object key");
+				}
+
+				++index;
+				position = skipWhitespace(position + 1u);
+
+				state = STATE_VALUE;
+				continue;
+			}
+
+			case STATE_FIRST_ELEMENT:
+			case STATE_ELEMENT:
+			{
+				if (isStructural && character == ']')
+				{
+					if (state == STATE_ELEMENT && strict)
+					{
+						return setError(position, "Trailing comma in array");
+					}
+
+					state = STATE_AFTER_VALUE;
+					break;
+				}
+
+				state = STATE_VALUE;
+				continue;
+			}
+
+			case STATE_VALUE:
+			{
+				if (position >= size)
+				{
+					return setError(position, "Unexpected end of file");
+				}
+
+				if (isStructural)
+				{
+					if (character == '{' || character == '[')
+					{
+						openIndices.emplace_back(index);
+
+						++index;
+						position = skipWhitespace(position + 1u);
+
+						state = character == '{' ? STATE_FIRST_MEMBER : STATE_FIRST_ELEMENT;
+						continue;
+					}
+
+					if (character == '\"')
+					{
+						// an opening quote is always followed by the closing quote in the index
+						ocean_assert(index + 1u < endIndex && buffer_[structurals_[index + 1u]] == '\"');
+
+						index += 2u;
+						position = skipWhitespace(structurals_[index - 1u] + 1u);
+
+						state = STATE_AFTER_VALUE;
+						continue;
+					}
+
+					return setError(position, std::string("Unexpected token: '") + character + "'");
+				}
+
+				const std::string_view value = scalar(index, position);
+
+				if (value != "true" && value != "false" && value != "null" && !isNumber(value))
+				{
+					return setError(position, "Unexpected token: '" + std::string(value) + "'");
+				}
+
+				position = skipWhitespace(position + uint32_t(value.size()));
+
+				state = STATE_AFTER_VALUE;
+				continue;
+			}
+
+			case STATE_AFTER_VALUE:
+				break;
+		}
+
+		ocean_assert(state == STATE_AFTER_VALUE);
+
+		if (character == '}' || character == ']')
+		{
+			// closing the current array or object, the character is a structural character at 'index'
+
+			ocean_assert(isStructural || (structurals_[index] == position && index != endIndex));
+
+			if (openIndices.empty() || buffer_[structurals_[openIndices.back()]] != (character == '}' ? '{' : '['))
+			{
+				return setError(position, std::string("Unexpected token: '") + character + "'");
+			}
+
+			closeIndices_[openIndices.back()] = index;
+			openIndices.pop_back();
+
+			++index;
+			position = skipWhitespace(position + 1u);
+
+			continue;
+		}
+
+		if (openIndices.empty())
+		{
+			// the root value is complete
+
+			if (position < size && strict)
+			{
+				return setError(position, "Unexpected data after the root value");
+			}
+
+			return true;
+		}
+
+		const bool isObject = buffer_[structurals_[openIndices.back()]] == '{';
+
+		if (!isStructural || character != ',')
+		{
+			if (position >= size)
+			{
+				return setError(position, "Unexpected end of file");
+			}
+
+			return setError(position, isObject ? "Expected ',' or '}' in object" : "Expected ',' or ']' in array");
+		}
+
+		++index;
+		position = skipWhitespace(position + 1u);
+
+		state = isObject ? STATE_MEMBER : STATE_ELEMENT;
+	}
+}
+
+JSONDocument::Value JSONDocument::createValue(const uint32_t index, const uint32_t position) const
+{
+	ocean_assert(index < structurals_.size());
+	ocean_assert(position < uint32_t(buffer_.size()));
+
+	const char character = buffer_[position];
+
+	if (structurals_[index] == position)
+	{
+		switch (character)
+		{
+			case '{':
+				return Value(this, index, position, JSONParser::JSONValue::TYPE_OBJECT);
+
+			case '[':
+				return Value(this, index, position, JSONParser::JSONValue::TYPE_ARRAY);
+
+			case '\"':
+				return Value(this, index, position, JSONParser::JSONValue::TYPE_STRING);
+
+			default:
+				ocean_assert(false && "The document has been validated already!");
+				return Value();
+		}
+	}
+
+	switch (character)
+	{
+		case 't':
+		case 'f':
+			return Value(this, index, position, JSONParser::JSONValue::TYPE_BOOLEAN);
+
+		case 'n':
+			return Value(this, index, position, JSONParser::JSONValue::TYPE_NULL);
+
+		default:
+			break;
+	}
+
+	return Value(this, index, position, JSONParser::JSONValue::TYPE_NUMBER);
+}
+
+std::string JSONDocument::createErrorMessage(const uint32_t position, const std::string& message) const
+{
+	size_t line = 1;
+	size_t column = 1;
+
+	for (size_t n = 0; n < std::min(size_t(position), buffer_.size()); ++n)
+	{
+		if (buffer_[n] == '\n')
+		{
+			++line;
+			column = 1;
+		}
+		else
+		{
+			++column;
+		}
+	}
+
+	return "JSON parsing error at line " + String::toAString(line) + ", column " + String::toAString(column) + ": " + message;
+}
+
+bool JSONDocument::isNumber(const std::string_view& value)
+{
+	// -?(0|[1-9][0-9]*)(\.[0-9]+)?([eE][+-]?[0-9]+)?
+
+	size_t n = 0;
+
+	if (n < value.size() && value[n] == '-')
+	{
+		++n;
+	}
+
+	if (n >= value.size() || value[n] < '0' || value[n] > '9')
+	{
+		return false;
+	}
+
+	if (value[n] == '0')
+	{
+		++n;
+	}
+	else
+	{
+		while (n < value.size() && value[n] >= '0' && value[n] <= '9')
+		{
+			++n;
+		}
+	}
+
+	if (n < value.size() && value[n] == '.')
+	{
+		++n;
+
+		const size_t firstDigit = n;
+
+		while (n < value.size() && value[n] >= '0' && value[n] <= '9')
+		{
+			++n;
+		}
+
+		if (n == firstDigit)
+		{
+			return false;
+		}
+	}
+
+	if (n < value.size() && (value[n] == 'e' || value[n] == 'E'))
+	{
+		++n;
+
+		if (n < value.size() && (value[n] == '+' || value[n] == '-'))
+		{
+			++n;
+		}
+
+		const size_t firstDigit = n;
+
+		while (n < value.size() && value[n] >= '0' && value[n] <= '9')
+		{
+			++n;
+		}
+
+		if (n == firstDigit)
+		{
+			return false;
+		}
+	}
+
+	return n == value.size();
+}
+
+void JSONDocument::determineMasks(const char* block, uint64_t& quotes, uint64_t& backslashes, uint64_t& structurals)
+{
+	ocean_assert(block != nullptr);
+
+#if defined(OCEAN_HARDWARE_SSE_VERSION) && OCEAN_HARDWARE_SSE_VERSION >= 20
+
+	quotes = 0ull;
+	backslashes = 0ull;
+	structurals = 0ull;
+
+	const __m128i quote_u_8x16 = _mm_set1_epi8('\"');
+	const __m128i backslash_u_8x16 = _mm_set1_epi8('\\');
+	const __m128i comma_u_8x16 = _mm_set1_epi8(',');
+	const __m128i colon_u_8x16 = _mm_set1_epi8(':');
+
+	// '[' and '{' (as well as ']' and '}') differ in bit 5 only, both can be compared at once after setting bit 5
+	const __m128i bit5_u_8x16 = _mm_set1_epi8(0x20);
+	const __m128i leftBrace_u_8x16 = _mm_set1_epi8('{');
+	const __m128i rightBrace_u_8x16 = _mm_set1_epi8('}');
+
+	for (unsigned int n = 0u; n < 4u; ++n)
+	{
+		const __m128i characters_u_8x16 = _mm_loadu_si128((const __m128i*)(block + n * 16u));
+
+		const __m128i lowerCharacters_u_8x16 = _mm_or_si128(characters_u_8x16, bit5_u_8x16);
+
+		const __m128i structurals_u_8x16 = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(characters_u_8x16, comma_u_8x16), _mm_cmpeq_epi8(characters_u_8x16, colon_u_8x16)),
+											_mm_or_si128(_mm_cmpeq_epi8(lowerCharacters_u_8x16, leftBrace_u_8x16), _mm_cmpeq_epi8(lowerCharacters_u_8x16, rightBrace_u_8x16)));
+
+		quotes |= uint64_t(uint16_t(_mm_movemask_epi8(_mm_cmpeq_epi8(characters_u_8x16, quote_u_8x16)))) << (n * 16u);
+		backslashes |= uint64_t(uint16_t(_mm_movemask_epi8(_mm_cmpeq_epi8(characters_u_8x16, backslash_u_8x16)))) << (n * 16u);
+		structurals |= uint64_t(uint16_t(_mm_movemask_epi8(structurals_u_8x16))) << (n * 16u);
+	}
+
+#elif defined(OCEAN_HARDWARE_NEON_VERSION) && OCEAN_HARDWARE_NEON_VERSION >= 10 && defined(__aarch64__)
+
+	const uint8x16_t bitWeights_u_8x16 = {0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80, 0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80};
+
+	const auto toMask = [&bitWeights_u_8x16](const uint8x16_t mask0_u_8x16, const uint8x16_t mask1_u_8x16, const uint8x16_t mask2_u_8x16, const uint8x16_t mask3_u_8x16) -> uint64_t
+	{
+		const uint8x16_t sum01_u_8x16 = vpaddq_u8(vandq_u8(mask0_u_8x16, bitWeights_u_8x16), vandq_u8(mask1_u_8x16, bitWeights_u_8x16));
+		const uint8x16_t sum23_u_8x16 = vpaddq_u8(vandq_u8(mask2_u_8x16, bitWeights_u_8x16), vandq_u8(mask3_u_8x16, bitWeights_u_8x16));
+
+		uint8x16_t sum_u_8x16 = vpaddq_u8(sum01_u_8x16, sum23_u_8x16);
+		sum_u_8x16 = vpaddq_u8(sum_u_8x16, sum_u_8x16);
+
+		return vgetq_lane_u64(vreinterpretq_u64_u8(sum_u_8x16), 0);
+	};
+
+	const uint8x16_t bit5_u_8x16 = vdupq_n_u8(0x20u);
+
+	uint8x16_t quotes_u_8x16[4];
+	uint8x16_t backslashes_u_8x16[4];
+	uint8x16_t structurals_u_8x16[4];
+
+	for (unsigned int n = 0u; n < 4u; ++n)
+	{
+		const uint8x16_t characters_u_8x16 = vld1q_u8((const uint8_t*)(block + n * 16u));
+
+		// '[' and '{' (as well as ']' and '}') differ in bit 5 only, both can be compared at once after setting bit 5
+		const uint8x16_t lowerCharacters_u_8x16 = vorrq_u8(characters_u_8x16, bit5_u_8x16);
+
+		quotes_u_8x16[n] = vceqq_u8(characters_u_8x16, vdupq_n_u8(uint8_t('\"')));
+		backslashes_u_8x16[n] = vceqq_u8(characters_u_8x16, vdupq_n_u8(uint8_t('\\')));
+		structurals_u_8x16[n] = vorrq_u8(vorrq_u8(vceqq_u8(characters_u_8x16, vdupq_n_u8(uint8_t(','))), vceqq_u8(characters_u_8x16, vdupq_n_u8(uint8_t(':')))),
+									vorrq_u8(vceqq_u8(lowerCharacters_u_8x16, vdupq_n_u8(uint8_t('{'))), vceqq_u8(lowerCharacters_u_8x16, vdupq_n_u8(uint8_t('}')))));
+	}
+
+	quotes = toMask(quotes_u_8x16[0], quotes_u_8x16[1], quotes_u_8x16[2], quotes_u_8x16[3]);
+	backslashes = toMask(backslashes_u_8x16[0], backslashes_u_8x16[1], backslashes_u_8x16[2], backslashes_u_8x16[3]);
+	structurals = toMask(structurals_u_8x16[0], structurals_u_8x16[1], structurals_u_8x16[2], structurals_u_8x16[3]);
+
+#else
+
+	quotes = 0ull;
+	backslashes = 0ull;
+	structurals = 0ull;
+
+	for (unsigned int n = 0u; n < 64u; ++n)
+	{
+		const uint64_t bit = uint64_t(1) << n;
+
+		switch (block[n])
+		{
+			case '\"':
+				quotes |= bit;
+				break;
+
+			case '\\':
+				backslashes |= bit;
+				break;
+
+			case '{':
+			case '}':
+			case '[':
+			case ']':
+			case ':':
+			case ',':
+				structurals |= bit;
+				break;
+
+			default:
+				break;
+		}
+	}
+
+#endif // OCEAN_HARDWARE_SSE_VERSION, OCEAN_HARDWARE_NEON_VERSION
+}
+
+uint64_t JSONDocument::prefixXor(uint64_t mask)
+{
+	mask ^= mask << 1u;
+	mask ^= mask << 2u;
+	mask ^= mask << 4u;
+	mask ^= mask << 8u;
+	mask ^= mask << 16u;
+	mask ^= mask << 32u;
+
+	return mask;
+}
+
+}
+
+}
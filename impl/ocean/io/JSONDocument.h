@@ -0,0 +1,588 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#ifndef META_OCEAN_IO_JSON_DOCUMENT_H
+#define META_OCEAN_IO_JSON_DOCUMENT_H
+
+#include "ocean/io/IO.h"
+#include "ocean/io/JSONParser.h"
+
+#include <string_view>
+
+namespace Ocean
+{
+
+namespace IO
+{
+
+/**
+ * This class implements a parsed JSON document providing lazy, zero-copy access to the values of a JSON buffer.
+ * In contrast to the JSONParser, the document does not create a tree of values with copied strings.<br>
+ * Instead, the document is parsed in two stages:<br>
+ * The first stage determines the positions of all structural characters ('{', '}', '[', ']', ':', ',' and all unescaped quotes outside of strings) with SIMD instructions (SSE or NEON, with a scalar fallback), 64 bytes at a time.<br>
+ * The second stage validates the grammar on the resulting structural index and stores the matching closing character for each object and array, so that nested values can be skipped in constant time.<br>
+ * Values are then accessed on demand, strings are provided as views into the source buffer and numbers are converted when they are accessed.
+ *
+ * The document accepts the same input as the lenient or strict JSONParser, strings are provided with escape sequences as they appear in the buffer (e.g., stringView(), toJSONValue()) unless they are explicitly decoded with string().<br>
+ * A document must not be moved or copied, all values are bound to the document which created them.
+ * @see JSONParser.
+ * @ingroup io
+ */
+class OCEAN_IO_EXPORT JSONDocument
+{
+	public:
+
+		/**
+		 * Definition of the value types, identical to the types of the JSONParser.
+		 */
+		using Type = JSONParser::JSONValue::Type;
+
+		/**
+		 * Definition of a vector holding indices.
+		 */
+		using Indices = std::vector<uint32_t>;
+
+		// Forward declaration.
+		class Iterator;
+
+		/**
+		 * This class implements a lightweight view of one JSON value inside a document.
+		 * A value is valid as long as the document which created the value exists.
+		 */
+		class OCEAN_IO_EXPORT Value
+		{
+			friend class JSONDocument;
+			friend class Iterator;
+
+			public:
+
+				/**
+				 * Default constructor creating an invalid value.
+				 */
+				Value() = default;
+
+				/**
+				 * Returns the type of this value.
+				 * @return The value's type
+				 */
+				inline Type type() const;
+
+				/**
+				 * Returns whether this value is null.
+				 * @return True, if so
+				 */
+				inline bool isNull() const;
+
+				/**
+				 * Returns whether this value is a boolean.
+				 * @return True, if so
+				 */
+				inline bool isBoolean() const;
+
+				/**
+				 * Returns whether this value is a number.
+				 * @return True, if so
+				 */
+				inline bool isNumber() const;
+
+				/**
+				 * Returns whether this value is a string.
+				 * @return True, if so
+				 */
+				inline bool isString() const;
+
+				/**
+				 * Returns whether this value is an array.
+				 * @return True, if so
+				 */
+				inline bool isArray() const;
+
+				/**
+				 * Returns whether this value is an object.
+				 * @return True, if so
+				 */
+				inline bool isObject() const;
+
+				/**
+				 * Returns the boolean of this value.
+				 * @return The boolean, false if this value is not a boolean
+				 */
+				bool boolean() const;
+
+				/**
+				 * Returns the number of this value, the number is converted with each call.
+				 * @return The number, 0 if this value is not a number
+				 */
+				double number() const;
+
+				/**
+				 * Returns the string of this value as it appears in the buffer, without the surrounding quotes and without resolving escape sequences.
+				 * @return The view into the document's buffer, empty if this value is not a string
+				 */
+				std::string_view stringView() const;
+
+				/**
+				 * Returns the string of this value with resolved escape sequences.
+				 * Supported are the escape sequences of the JSON standard, '\\u' sequences are converted to UTF-8.
+				 * @return The decoded string, empty if this value is not a string
+				 */
+				std::string string() const;
+
+				/**
+				 * Returns the number of elements of an array or the number of members of an object.
+				 * The elements are counted with each call by skipping over the nested values.
+				 * @return The number of elements or members, 0 for any other value
+				 */
+				size_t size() const;
+
+				/**
+				 * Returns the value of an object member with a specific key.
+				 * Keys are compared as they appear in the buffer without any copy (like the JSONParser does), in case an object contains the same key several times the last member is returned.
+				 * @param key The key of the member
+				 * @return The member's value, an invalid value if this value is not an object or if the object does not contain the key
+				 */
+				Value valueFromObject(const std::string_view& key) const;
+
+				/**
+				 * Returns the element of an array with a specific index.
+				 * @param index The index of the element, with range [0, size())
+				 * @return The element, an invalid value if this value is not an array or if the index is out of range
+				 */
+				Value valueFromArray(const size_t index) const;
+
+				/**
+				 * Returns an iterator pointing to the first element of an array or the first member of an object.
+				 * @return The iterator, identical to end() if this value is neither an array nor an object, or if it is empty
+				 */
+				Iterator begin() const;
+
+				/**
+				 * Returns an iterator pointing behind the last element of an array or behind the last member of an object.
+				 * @return The iterator
+				 */
+				Iterator end() const;
+
+				/**
+				 * Converts this value (and all nested values) to a value of the JSONParser.
+				 * Strings are converted as they appear in the buffer (identical to the JSONParser).
+				 * @return The resulting value, an invalid value if this value is invalid
+				 */
+				JSONParser::JSONValue toJSONValue() const;
+
+				/**
+				 * Returns whether this value is valid.
+				 * @return True, if so
+				 */
+				inline bool isValid() const;
+
+				/**
+				 * Returns whether this value is valid.
+				 * @return True, if so
+				 */
+				explicit inline operator bool() const;
+
+			protected:
+
+				/**
+				 * Creates a new value.
+				 * @param document The document to which the value belongs, must be valid
+				 * @param index The index of the first structural character at or after the value's first character
+				 * @param position The position of the value's first character within the buffer
+				 * @param type The type of the value
+				 */
+				inline Value(const JSONDocument* document, const uint32_t index, const uint32_t position, const Type type);
+
+				/**
+				 * Returns the index of the first structural character after this value.
+				 * @return The index of the structural character
+				 */
+				uint32_t nextIndex() const;
+
+			protected:
+
+				/// The document to which this value belongs.
+				const JSONDocument* document_ = nullptr;
+
+				/// The index of the first structural character at or after the value's first character, for strings, arrays and objects the index of the opening character.
+				uint32_t index_ = 0u;
+
+				/// The position of the value's first character within the buffer.
+				uint32_t position_ = 0u;
+
+				/// The type of the value.
+				Type type_ = JSONParser::JSONValue::TYPE_INVALID;
+		};
+
+		/**
+		 * This class implements a forward iterator for the elements of an array or the members of an object.
+		 */
+		class OCEAN_IO_EXPORT Iterator
+		{
+			friend class Value;
+
+			public:
+
+				/**
+				 * Default constructor creating an invalid iterator.
+				 */
+				Iterator() = default;
+
+				/**
+				 * Returns the current array element or the value of the current object member.
+				 * @return The current value
+				 */
+				inline const Value& operator*() const;
+
+				/**
+				 * Returns the current array element or the value of the current object member.
+				 * @return The current value
+				 */
+				inline const Value* operator->() const;
+
+				/**
+				 * Returns the key of the current object member as it appears in the buffer.
+				 * @return The key of the member, empty if the iterator belongs to an array
+				 */
+				inline const std::string_view& key() const;
+
+				/**
+				 * Moves the iterator to the next element or member.
+				 * @return Reference to this iterator
+				 */
+				Iterator& operator++();
+
+				/**
+				 * Returns whether two iterators point to the same element.
+				 * @param right The second iterator
+				 * @return True, if so
+				 */
+				inline bool operator==(const Iterator& right) const;
+
+				/**
+				 * Returns whether two iterators point to different elements.
+				 * @param right The second iterator
+				 * @return True, if so
+				 */
+				inline bool operator!=(const Iterator& right) const;
+
+			protected:
+
+				/**
+				 * Creates a new iterator.
+				 * @param document The document to which the iterator belongs, must be valid
+				 * @param index The index of the structural character preceding the first element or member, the index of the opening character
+				 * @param closeIndex The index of the structural character closing the array or object
+				 * @param isObject True, if the iterator belongs to an object; False, if the iterator belongs to an array
+				 */
+				Iterator(const JSONDocument* document, const uint32_t index, const uint32_t closeIndex, const bool isObject);
+
+				/**
+				 * Updates the current value (and key) based on the current index.
+				 */
+				void update();
+
+			protected:
+
+				/// The document to which the iterator belongs.
+				const JSONDocument* document_ = nullptr;
+
+				/// The index of the structural character preceding the current element or member (the opening character or a comma), the index of the closing character for the end iterator.
+				uint32_t index_ = 0u;
+
+				/// The index of the structural character closing the array or object.
+				uint32_t closeIndex_ = 0u;
+
+				/// True, if the iterator belongs to an object.
+				bool isObject_ = false;
+
+				/// The current value.
+				Value value_;
+
+				/// The key of the current member, empty for arrays.
+				std::string_view key_;
+		};
+
+
+		/**
+		 * Parses a JSON document from a buffer, the document takes ownership of the buffer.
+		 * @param buffer The buffer holding the JSON data, with at most 2^32 - 1 bytes
+		 * @param strict True, to reject trailing commas and trailing data; False, to accept them like the lenient JSONParser
+		 * @param errorMessage Optional resulting error message in case the document could not be parsed
+		 */
+		explicit JSONDocument(std::string&& buffer, const bool strict = false, std::string* errorMessage = nullptr);
+
+		/**
+		 * Parses a JSON document from an external memory block, the memory must stay valid as long as the document exists.
+		 * @param buffer The memory block holding the JSON data, with at most 2^32 - 1 bytes
+		 * @param strict True, to reject trailing commas and trailing data; False, to accept them like the lenient JSONParser
+		 * @param errorMessage Optional resulting error message in case the document could not be parsed
+		 */
+		explicit JSONDocument(const std::string_view& buffer, const bool strict = false, std::string* errorMessage = nullptr);
+
+		/**
+		 * Disabled copy constructor.
+		 */
+		JSONDocument(const JSONDocument&) = delete;
+
+		/**
+		 * Returns the root value of this document.
+		 * @return The root value, an invalid value if the document could not be parsed
+		 */
+		Value root() const;
+
+		/**
+		 * Returns the number of structural characters of the document's index.
+		 * @return The number of structural characters, without the terminating entry
+		 */
+		inline size_t structurals() const;
+
+		/**
+		 * Returns whether the document has been parsed successfully.
+		 * @return True, if so
+		 */
+		inline bool isValid() const;
+
+		/**
+		 * Disabled copy operator.
+		 * @return Reference to this object
+		 */
+		JSONDocument& operator=(const JSONDocument&) = delete;
+
+		/**
+		 * Determines the positions of all structural characters in a buffer, this is the first stage of the parser.
+		 * The resulting index contains the positions of '{', '}', '[', ']', ':' and ',' outside of strings, and the positions of all unescaped quotes.
+		 * @param buffer The buffer to index
+		 * @param structurals The resulting positions of the structural characters, in ascending order
+		 * @return True, if succeeded; False, if the buffer ends within a string
+		 */
+		static bool determineStructurals(const std::string_view& buffer, Indices& structurals);
+
+	protected:
+
+		/**
+		 * Parses the document's buffer.
+		 * @param strict True, to parse in strict mode
+		 * @param errorMessage Optional resulting error message
+		 * @return True, if succeeded
+		 */
+		bool parse(const bool strict, std::string* errorMessage);
+
+		/**
+		 * Validates the grammar of the document and determines the closing characters of all arrays and objects, this is the second stage of the parser.
+		 * @param strict True, to parse in strict mode
+		 * @param errorMessage Optional resulting error message
+		 * @return True, if succeeded
+		 */
+		bool validate(const bool strict, std::string* errorMessage);
+
+		/**
+		 * Creates the value which starts after a specific structural character.
+		 * @param index The index of the structural character at or after the value's first character
+		 * @param position The position of the value's first character within the buffer
+		 * @return The resulting value
+		 */
+		Value createValue(const uint32_t index, const uint32_t position) const;
+
+		/**
+		 * Returns the position of the first character which is not a whitespace.
+		 * @param position The position at which the search starts, with range [0, buffer size]
+		 * @return The position of the first non-whitespace character, the buffer size if no such character exists
+		 */
+		inline uint32_t skipWhitespace(uint32_t position) const;
+
+		/**
+		 * Returns the characters of a scalar value (number, boolean or null) without trailing whitespace.
+		 * @param index The index of the first structural character after the scalar value
+		 * @param position The position of the scalar's first character
+		 * @return The scalar's characters
+		 */
+		inline std::string_view scalar(const uint32_t index, const uint32_t position) const;
+
+		/**
+		 * Creates an error message for a specific position in the buffer.
+		 * @param position The position of the error
+		 * @param message The message describing the error
+		 * @return The resulting error message
+		 */
+		std::string createErrorMessage(const uint32_t position, const std::string& message) const;
+
+		/**
+		 * Returns whether a scalar is a valid JSON number.
+		 * @param value The characters of the scalar
+		 * @return True, if so
+		 */
+		static bool isNumber(const std::string_view& value);
+
+		/**
+		 * Determines the bit masks of quotes, backslashes and structural characters for a block of 64 bytes.
+		 * @param block The block of 64 bytes, must be valid
+		 * @param quotes The resulting mask with one bit for each quote
+		 * @param backslashes The resulting mask with one bit for each backslash
+		 * @param structurals The resulting mask with one bit for each '{', '}', '[', ']', ':' and ','
+		 */
+		static void determineMasks(const char* block, uint64_t& quotes, uint64_t& backslashes, uint64_t& structurals);
+
+		/**
+		 * Returns the prefix xor of a bit mask, each resulting bit is the xor of the input bit and all lower input bits.
+		 * @param mask The mask for which the prefix xor will be determined
+		 * @return The prefix xor
+		 */
+		static uint64_t prefixXor(uint64_t mask);
+
+	protected:
+
+		/// The buffer owned by the document, empty if the document references external memory.
+		std::string ownedBuffer_;
+
+		/// The buffer of the document.
+		std::string_view buffer_;
+
+		/// The positions of all structural characters within the buffer, followed by the buffer size as terminating entry.
+		Indices structurals_;
+
+		/// The index of the matching closing character for each opening '{' or '[', with same size as structurals_, undefined for all other characters.
+		Indices closeIndices_;
+
+		/// True, if the document has been parsed successfully.
+		bool isValid_ = false;
+};
+
+inline const JSONDocument::Value& JSONDocument::Iterator::operator*() const
+{
+	return value_;
+}
+
+inline const JSONDocument::Value* JSONDocument::Iterator::operator->() const
+{
+	return &value_;
+}
+
+inline const std::string_view& JSONDocument::Iterator::key() const
+{
+	return key_;
+}
+
+inline bool JSONDocument::Iterator::operator==(const Iterator& right) const
+{
+	return document_ == right.document_ && index_ == right.index_;
+}
+
+inline bool JSONDocument::Iterator::operator!=(const Iterator& right) const
+{
+	return !(*this == right);
+}
+
+inline JSONDocument::Value::Value(const JSONDocument* document, const uint32_t index, const uint32_t position, const Type type) :
+	document_(document),
+	index_(index),
+	position_(position),
+	type_(type)
+{
+	// nothing to do here
+}
+
+inline JSONDocument::Type JSONDocument::Value::type() const
+{
+	return type_;
+}
+
+inline bool JSONDocument::Value::isNull() const
+{
+	return type_ == JSONParser::JSONValue::TYPE_NULL;
+}
+
+inline bool JSONDocument::Value::isBoolean() const
+{
+	return type_ == JSONParser::JSONValue::TYPE_BOOLEAN;
+}
+
+inline bool JSONDocument::Value::isNumber() const
+{
+	return type_ == JSONParser::JSONValue::TYPE_NUMBER;
+}
+
+inline bool JSONDocument::Value::isString() const
+{
+	return type_ == JSONParser::JSONValue::TYPE_STRING;
+}
+
+inline bool JSONDocument::Value::isArray() const
+{
+	return type_ == JSONParser::JSONValue::TYPE_ARRAY;
+}
+
+inline bool JSONDocument::Value::isObject() const
+{
+	return type_ == JSONParser::JSONValue::TYPE_OBJECT;
+}
+
+inline bool JSONDocument::Value::isValid() const
+{
+	return type_ != JSONParser::JSONValue::TYPE_INVALID;
+}
+
+inline JSONDocument::Value::operator bool() const
+{
+	return isValid();
+}
+
+inline size_t JSONDocument::structurals() const
+{
+	ocean_assert(!structurals_.empty() || !isValid_);
+
+	return structurals_.empty() ? 0 : structurals_.size() - 1;
+}
+
+inline bool JSONDocument::isValid() const
+{
+	return isValid_;
+}
+
+inline uint32_t JSONDocument::skipWhitespace(uint32_t position) const
+{
+	while (position < uint32_t(buffer_.size()))
+	{
+		const char c = buffer_[position];
+
+		if (c != ' ' && c != '\t' && c != '\n' && c != '\r')
+		{
+			break;
+		}
+
+		++position;
+	}
+
+	return position;
+}
+
+inline std::string_view JSONDocument::scalar(const uint32_t index, const uint32_t position) const
+{
+	ocean_assert(index < structurals_.size());
+	ocean_assert(position <= structurals_[index]);
+
+	uint32_t endPosition = structurals_[index];
+
+	while (endPosition > position)
+	{
+		const char c = buffer_[endPosition - 1u];
+
+		if (c != ' ' && c != '\t' && c != '\n' && c != '\r')
+		{
+			break;
+		}
+
+		--endPosition;
+	}
+
+	return buffer_.substr(position, endPosition - position);
+}
+
+}
+
+}
+
+#endif // META_OCEAN_IO_JSON_DOCUMENT_H
@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "ocean/io/MemoryInputStream.h"
+
+namespace Ocean
+{
+
+namespace IO
+{
+
+MemoryInputStream::MemoryStreamBuffer::MemoryStreamBuffer(const void* data, const size_t size)
+{
+	ocean_assert(data != nullptr || size == 0);
+
+	// the get area covers the entire memory block, the stream buffer never modifies the memory
+
+	char* const begin = (char*)(data);
+
+	setg(begin, begin, begin + size);
+}
+
+std::streamsize MemoryInputStream::MemoryStreamBuffer::xsgetn(char* data, std::streamsize size)
+{
+	if (size <= 0)
+	{
+		return 0;
+	}
+
+	const std::streamsize remainingSize = std::streamsize(egptr() - gptr());
+	const std::streamsize readSize = std::min(size, remainingSize);
+
+	if (readSize > 0)
+	{
+		memcpy(data, gptr(), size_t(readSize));
+
+		setg(eback(), gptr() + readSize, egptr());
+	}
+
+	return readSize;
+}
+
+MemoryInputStream::MemoryStreamBuffer::pos_type MemoryInputStream::MemoryStreamBuffer::seekoff(off_type offset, std::ios_base::seekdir direction, std::ios_base::openmode mode)
+{
+	if ((mode & std::ios_base::in) == 0)
+	{
+		return pos_type(off_type(-1));
+	}
+
+	off_type newPosition = 0;
+
+	switch (direction)
+	{
+		case std::ios_base::beg:
+			newPosition = offset;
+			break;
+
+		case std::ios_base::cur:
+			newPosition = off_type(gptr() - eback()) + offset;
+			break;
+
+		case std::ios_base::end:
+			newPosition = off_type(egptr() - eback()) + offset;
+			break;
+
+		default:
+			return pos_type(off_type(-1));
+	}
+
+	if (newPosition < 0 || newPosition > off_type(egptr() - eback()))
+	{
+		return pos_type(off_type(-1));
+	}
+
+	setg(eback(), eback() + newPosition, egptr());
+
+	return pos_type(newPosition);
+}
+
+MemoryInputStream::MemoryStreamBuffer::pos_type MemoryInputStream::MemoryStreamBuffer::seekpos(pos_type position, std::ios_base::openmode mode)
+{
+	return seekoff(off_type(position), std::ios_base::beg, mode);
+}
+
+std::streamsize MemoryInputStream::MemoryStreamBuffer::showmanyc()
+{
+	const std::streamsize remainingSize = std::streamsize(egptr() - gptr());
+
+	return remainingSize > 0 ? remainingSize : std::streamsize(-1);
+}
+
+MemoryInputStream::MemoryInputStream(const void* data, const size_t size) :
+	std::istream(&streamBuffer_),
+	data_(data),
+	size_(size),
+	streamBuffer_(data, size)
+{
+	// nothing to do here
+}
+
+}
+
+}
@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#ifndef META_OCEAN_IO_MEMORY_INPUT_STREAM_H
+#define META_OCEAN_IO_MEMORY_INPUT_STREAM_H
+
+#include "ocean/io/IO.h"
+
+#include <istream>
+#include <streambuf>
+
+namespace Ocean
+{
+
+namespace IO
+{
+
+/**
+ * This class implements an input stream reading from an existing memory block, e.g., a loaded file or a memory mapped file.
+ * The memory block is not copied, so it must stay valid as long as the stream is used.<br>
+ * Combined with an InputBitstream, this stream avoids any file access or copy while deserializing data which is available in memory already:
+ * <pre>
+ * const MemoryMappedFile memoryMappedFile(filename);
+ * MemoryInputStream memoryInputStream(memoryMappedFile.constdata(), memoryMappedFile.size());
+ * InputBitstream inputBitstream(memoryInputStream);
+ * </pre>
+ * @see MemoryMappedFile, InputBitstream.
+ * @ingroup io
+ */
+class OCEAN_IO_EXPORT MemoryInputStream : public std::istream
+{
+	public:
+
+		/**
+		 * This class implements a stream buffer providing read access to an existing memory block.
+		 */
+		class OCEAN_IO_EXPORT MemoryStreamBuffer : public std::streambuf
+		{
+			public:
+
+				/**
+				 * Creates a new stream buffer for a given memory block.
+				 * @param data The memory block, must be valid if size is not 0
+				 * @param size The size of the memory block, in bytes, with range [0, infinity)
+				 */
+				MemoryStreamBuffer(const void* data, const size_t size);
+
+			protected:
+
+				/**
+				 * Reads a sequence of characters from the memory block.
+				 * @param data The buffer receiving the data, must be valid
+				 * @param size The number of bytes to read, with range [0, infinity)
+				 * @return The number of bytes actually read
+				 */
+				std::streamsize xsgetn(char* data, std::streamsize size) override;
+
+				/**
+				 * Sets the position relative to the beginning, the current position, or the end of the memory block.
+				 * @param offset The offset to apply, in bytes
+				 * @param direction The reference position for the offset
+				 * @param mode The open mode, must contain std::ios_base::in
+				 * @return The new position, or -1 on failure
+				 */
+				pos_type seekoff(off_type offset, std::ios_base::seekdir direction, std::ios_base::openmode mode = std::ios_base::in) override;
+
+				/**
+				 * Sets the absolute position within the memory block.
+				 * @param position The new position, in bytes, with range [0, size]
+				 * @param mode The open mode, must contain std::ios_base::in
+				 * @return The new position, or -1 on failure
+				 */
+				pos_type seekpos(pos_type position, std::ios_base::openmode mode = std::ios_base::in) override;
+
+				/**
+				 * Returns the number of bytes which can be read.
+				 * @return The number of remaining bytes, -1 if the end of the memory block has been reached
+				 */
+				std::streamsize showmanyc() override;
+		};
+
+	public:
+
+		/**
+		 * Creates a new input stream for a given memory block.
+		 * @param data The memory block, must be valid if size is not 0, must stay valid while the stream exists
+		 * @param size The size of the memory block, in bytes, with range [0, infinity)
+		 */
+		MemoryInputStream(const void* data, const size_t size);
+
+		/**
+		 * Returns the memory block of this stream.
+		 * @return The memory block
+		 */
+		inline const void* data() const;
+
+		/**
+		 * Returns the size of the memory block of this stream.
+		 * @return The size, in bytes
+		 */
+		inline size_t size() const;
+
+	protected:
+
+		/**
+		 * Disabled copy constructor.
+		 */
+		MemoryInputStream(const MemoryInputStream&) = delete;
+
+		/**
+		 * Disabled copy operator.
+		 * @return Reference to this object
+		 */
+		MemoryInputStream& operator=(const MemoryInputStream&) = delete;
+
+	protected:
+
+		/// The memory block of this stream.
+		const void* data_ = nullptr;
+
+		/// The size of the memory block, in bytes.
+		size_t size_ = 0;
+
+		/// The stream buffer providing access to the memory block.
+		MemoryStreamBuffer streamBuffer_;
+};
+
+inline const void* MemoryInputStream::data() const
+{
+	return data_;
+}
+
+inline size_t MemoryInputStream::size() const
+{
+	return size_;
+}
+
+}
+
+}
+
+#endif // META_OCEAN_IO_MEMORY_INPUT_STREAM_H
@@ -0,0 +1,166 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "ocean/io/MemoryMappedFile.h"
+
+#include "ocean/base/String.h"
+
+#ifdef _WINDOWS
+	#include <winsock2.h>
+	#include <windows.h>
+#else
+	#include <fcntl.h>
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+	#include <unistd.h>
+#endif
+
+namespace Ocean
+{
+
+namespace IO
+{
+
+MemoryMappedFile::MemoryMappedFile(const std::string& filename) :
+	filename_(filename)
+{
+	ocean_assert(!filename_.empty());
+
+	if (filename_.empty())
+	{
+		return;
+	}
+
+#ifdef _WINDOWS
+
+	const HANDLE fileHandle = CreateFileW(String::toWString(filename_).c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+
+	if (fileHandle == INVALID_HANDLE_VALUE)
+	{
+		return;
+	}
+
+	LARGE_INTEGER fileSize;
+	if (GetFileSizeEx(fileHandle, &fileSize) == FALSE || fileSize.QuadPart <= 0)
+	{
+		CloseHandle(fileHandle);
+		return;
+	}
+
+	const HANDLE mappingHandle = CreateFileMappingW(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+
+	// the mapping keeps the file open, so the file handle is not needed anymore
+	CloseHandle(fileHandle);
+
+	if (mappingHandle == nullptr)
+	{
+		return;
+	}
+
+	const void* data = MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0);
+
+	if (data == nullptr)
+	{
+		CloseHandle(mappingHandle);
+		return;
+	}
+
+	data_ = data;
+	size_ = size_t(fileSize.QuadPart);
+	mappingHandle_ = mappingHandle;
+
+#else
+
+	const int fileDescriptor = open(filename_.c_str(), O_RDONLY);
+
+	if (fileDescriptor == -1)
+	{
+		return;
+	}
+
+	struct stat fileStatus;
+	if (fstat(fileDescriptor, &fileStatus) != 0 || fileStatus.st_size <= 0)
+	{
+		close(fileDescriptor);
+		return;
+	}
+
+	void* data = mmap(nullptr, size_t(fileStatus.st_size), PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+
+	// the mapping keeps a reference to the file, so the file descriptor is not needed anymore
+	close(fileDescriptor);
+
+	if (data == MAP_FAILED)
+	{
+		return;
+	}
+
+	data_ = data;
+	size_ = size_t(fileStatus.st_size);
+
+#endif
+}
+
+MemoryMappedFile::MemoryMappedFile(MemoryMappedFile&& memoryMappedFile) noexcept
+{
+	*this = std::move(memoryMappedFile);
+}
+
+MemoryMappedFile::~MemoryMappedFile()
+{
+	release();
+}
+
+void MemoryMappedFile::release()
+{
+	if (data_ != nullptr)
+	{
+
+#ifdef _WINDOWS
+
+		const BOOL unmapResult = UnmapViewOfFile(data_);
+		ocean_assert_and_suppress_unused(unmapResult == TRUE, unmapResult);
+
+		const BOOL closeResult = CloseHandle(mappingHandle_);
+		ocean_assert_and_suppress_unused(closeResult == TRUE, closeResult);
+
+#else
+
+		const int result = munmap(const_cast<void*>(data_), size_);
+		ocean_assert_and_suppress_unused(result == 0, result);
+
+#endif
+
+	}
+
+	data_ = nullptr;
+	size_ = 0;
+	mappingHandle_ = nullptr;
+}
+
+MemoryMappedFile& MemoryMappedFile::operator=(MemoryMappedFile&& memoryMappedFile) noexcept
+{
+	if (this != &memoryMappedFile)
+	{
+		release();
+
+		filename_ = std::move(memoryMappedFile.filename_);
+		data_ = memoryMappedFile.data_;
+		size_ = memoryMappedFile.size_;
+		mappingHandle_ = memoryMappedFile.mappingHandle_;
+
+		memoryMappedFile.data_ = nullptr;
+		memoryMappedFile.size_ = 0;
+		memoryMappedFile.mappingHandle_ = nullptr;
+	}
+
+	return *this;
+}
+
+}
+
+}
@@ -0,0 +1,168 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#ifndef META_OCEAN_IO_MEMORY_MAPPED_FILE_H
+#define META_OCEAN_IO_MEMORY_MAPPED_FILE_H
+
+#include "ocean/io/IO.h"
+
+namespace Ocean
+{
+
+namespace IO
+{
+
+/**
+ * This class implements a read-only memory mapping of an entire file.
+ * The content of the file is not loaded when the object is created, the operating system pages in the content on demand and can page out unused regions at any time.<br>
+ * Thus, large files (e.g., feature maps) can be accessed without deserialization and without occupying heap memory.<br>
+ * The mapping is private and read-only, the file must not be modified while it is mapped.
+ * @ingroup io
+ */
+class OCEAN_IO_EXPORT MemoryMappedFile
+{
+	public:
+
+		/**
+		 * Creates an invalid object without mapping.
+		 */
+		MemoryMappedFile() = default;
+
+		/**
+		 * Creates a new memory mapping for a given file.
+		 * @param filename The name of the file to be mapped, must exist and must not be empty
+		 */
+		explicit MemoryMappedFile(const std::string& filename);
+
+		/**
+		 * Move constructor.
+		 * @param memoryMappedFile The object to be moved
+		 */
+		MemoryMappedFile(MemoryMappedFile&& memoryMappedFile) noexcept;
+
+		/**
+		 * Disabled copy constructor.
+		 */
+		MemoryMappedFile(const MemoryMappedFile&) = delete;
+
+		/**
+		 * Destructs the object and releases the mapping.
+		 */
+		~MemoryMappedFile();
+
+		/**
+		 * Returns the pointer to the read-only memory of the mapped file.
+		 * @return The mapped memory, nullptr if the object is invalid
+		 */
+		inline const void* constdata() const;
+
+		/**
+		 * Returns the pointer to the read-only memory of the mapped file at a specific byte offset.
+		 * @param offset The offset in bytes, with range [0, size() - sizeof(T)]
+		 * @return The mapped memory at the specified offset
+		 * @tparam T The data type of the resulting pointer
+		 */
+		template <typename T>
+		inline const T* constdata(const size_t offset = 0) const;
+
+		/**
+		 * Returns the size of the mapped file, in bytes.
+		 * @return The file's size
+		 */
+		inline size_t size() const;
+
+		/**
+		 * Returns the name of the mapped file.
+		 * @return The filename
+		 */
+		inline const std::string& filename() const;
+
+		/**
+		 * Releases the mapping.
+		 */
+		void release();
+
+		/**
+		 * Returns whether this object holds a valid mapping.
+		 * @return True, if so
+		 */
+		inline bool isValid() const;
+
+		/**
+		 * Returns whether this object holds a valid mapping.
+		 * @return True, if so
+		 */
+		explicit inline operator bool() const;
+
+		/**
+		 * Move operator.
+		 * @param memoryMappedFile The object to be moved
+		 * @return Reference to this object
+		 */
+		MemoryMappedFile& operator=(MemoryMappedFile&& memoryMappedFile) noexcept;
+
+		/**
+		 * Disabled copy operator.
+		 * @return Reference to this object
+		 */
+		MemoryMappedFile& operator=(const MemoryMappedFile&) = delete;
+
+	protected:
+
+		/// The name of the mapped file.
+		std::string filename_;
+
+		/// The mapped memory, nullptr if not mapped.
+		const void* data_ = nullptr;
+
+		/// The size of the mapped memory, in bytes.
+		size_t size_ = 0;
+
+		/// The handle of the file mapping, used on Windows platforms only.
+		void* mappingHandle_ = nullptr;
+};
+
+inline const void* MemoryMappedFile::constdata() const
+{
+	return data_;
+}
+
+template <typename T>
+inline const T* MemoryMappedFile::constdata(const size_t offset) const
+{
+	ocean_assert(data_ != nullptr);
+	ocean_assert(offset + sizeof(T) <= size_);
+	ocean_assert((size_t((const uint8_t*)(data_) + offset) % alignof(T)) == 0);
+
+	return (const T*)((const uint8_t*)(data_) + offset);
+}
+
+inline size_t MemoryMappedFile::size() const
+{
+	return size_;
+}
+
+inline const std::string& MemoryMappedFile::filename() const
+{
+	return filename_;
+}
+
+inline bool MemoryMappedFile::isValid() const
+{
+	return data_ != nullptr;
+}
+
+inline MemoryMappedFile::operator bool() const
+{
+	return isValid();
+}
+
+}
+
+}
+
+#endif // META_OCEAN_IO_MEMORY_MAPPED_FILE_H
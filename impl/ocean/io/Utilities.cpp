@@ -64,6 +64,18 @@ bool Utilities::readFile(const std::string& filename, Buffer& buffer)
 	return true;
 }
 
+Task<Utilities::ReadFileResult> Utilities::readFileTask(std::string filename)
+{
+	ocean_assert(!filename.empty());
+
+	co_await TaskExecutor::get().schedule();
+
+	ReadFileResult result;
+	result.first = readFile(filename, result.second);
+
+	co_return result;
+}
+
 void Utilities::encodeHomogenousMatrix4(const HomogenousMatrix4& matrix, Buffer& buffer)
 {
 	static_assert(sizeof(HomogenousMatrixD4) == 8 * 16, "Invalid data type!");
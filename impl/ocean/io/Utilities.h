@@ -10,6 +10,8 @@
 
 #include "ocean/io/IO.h"
 
+#include "ocean/base/Task.h"
+
 #include "ocean/math/HomogenousMatrix4.h"
 #include "ocean/math/Vector2.h"
 #include "ocean/math/Vector3.h"
@@ -36,6 +38,11 @@ class OCEAN_IO_EXPORT Utilities
 		 */
 		using Buffer = std::vector<uint8_t>;
 
+		/**
+		 * Definition of a pair combining the success state of a file read with the file's data.
+		 */
+		using ReadFileResult = std::pair<bool, Buffer>;
+
 	public:
 
 		/**
@@ -47,6 +54,15 @@ class OCEAN_IO_EXPORT Utilities
 		 */
 		static bool readFile(const std::string& filename, Buffer& buffer);
 
+		/**
+		 * Reads a file within a coroutine.
+		 * The file is read in a thread of the TaskExecutor, the awaiting coroutine is suspended meanwhile and continues in that thread.
+		 * @param filename The name of the file from which the data will be read, must be valid
+		 * @return The task providing the success state and the file's data
+		 * @see readFile(), Task.
+		 */
+		static Task<ReadFileResult> readFileTask(std::string filename);
+
 		/**
 		 * Encodes a 4x4 homogeneous matrix.
 		 * The matrix will be stored with 64 bit precision.
@@ -50,6 +50,33 @@ Frame decodeImage(const void* buffer, const size_t size, const std::string& imag
 	return frame;
 }
 
+Frame decodeImage(const void* buffer, const size_t size, const unsigned int minimalWidth, const unsigned int minimalHeight, const std::string& imageBufferTypeIn, std::string* imageBufferTypeOut)
+{
+	if (buffer == nullptr || size == 0)
+	{
+		ocean_assert(false && "Invalid input!");
+		return Frame();
+	}
+
+#if defined(__APPLE__) || defined(_WINDOWS)
+	// the platform decoders do not support a reduced resolution
+
+	OCEAN_SUPPRESS_UNUSED_WARNING(minimalWidth);
+	OCEAN_SUPPRESS_UNUSED_WARNING(minimalHeight);
+
+	return decodeImage(buffer, size, imageBufferTypeIn, imageBufferTypeOut);
+#else
+	Frame frame = Media::OpenImageLibraries::Image::decodeImage(buffer, size, minimalWidth, minimalHeight, imageBufferTypeIn, imageBufferTypeOut);
+
+	if (!frame.isValid())
+	{
+		frame = Media::Special::Image::decodeImage(buffer, size, imageBufferTypeIn, imageBufferTypeOut);
+	}
+
+	return frame;
+#endif
+}
+
 bool encodeImage(const Frame& frame, const std::string& imageType, std::vector<uint8_t>& buffer, const Properties& properties)
 {
 	OCEAN_SUPPRESS_UNUSED_WARNING(properties);
@@ -100,6 +127,33 @@ Frame readImage(const std::string& filename)
 	return frame;
 }
 
+Frame readImage(const std::string& filename, const unsigned int minimalWidth, const unsigned int minimalHeight)
+{
+	if (filename.empty())
+	{
+		ocean_assert(false && "Invalid input!");
+		return Frame();
+	}
+
+#if defined(__APPLE__) || defined(_WINDOWS)
+	// the platform decoders do not support a reduced resolution
+
+	OCEAN_SUPPRESS_UNUSED_WARNING(minimalWidth);
+	OCEAN_SUPPRESS_UNUSED_WARNING(minimalHeight);
+
+	return readImage(filename);
+#else
+	Frame frame = Media::OpenImageLibraries::Image::readImage(filename, minimalWidth, minimalHeight);
+
+	if (!frame.isValid())
+	{
+		frame = Media::Special::Image::readImage(filename);
+	}
+
+	return frame;
+#endif
+}
+
 bool writeImage(const Frame& frame, const std::string& filename, const Properties& properties)
 {
 	OCEAN_SUPPRESS_UNUSED_WARNING(properties);
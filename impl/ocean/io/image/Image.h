@@ -65,6 +65,22 @@ using Properties = Media::Image::Properties;
  */
 OCEAN_IO_IMAGE_EXPORT Frame decodeImage(const void* buffer, const size_t size, const std::string& imageBufferTypeIn = std::string(), std::string* imageBufferTypeOut = nullptr);
 
+/**
+ * Decodes (reads/loads) an image from a given binary buffer with a reduced resolution if supported by the image codec.
+ * The resolution is reduced while decoding (e.g., by 1/2, 1/4, or 1/8 for JPEG images) so that the resulting image is still at least as large as the specified minimal size.<br>
+ * The minimal size is a hint only, image types or platforms not supporting a reduced-resolution decoding return the image with full resolution.
+ * @param buffer The buffer from which the image will be loaded, must be valid
+ * @param size The size of the given buffer in bytes, with range [1, infinity)
+ * @param minimalWidth The minimal width of the resulting image in pixel, 0 to avoid any reduction independent of the image width
+ * @param minimalHeight The minimal height of the resulting image in pixel, 0 to avoid any reduction independent of the image height
+ * @param imageBufferTypeIn Type of the given image that is stored in the buffer, should be specified if known (e.g. the file extension of a corresponding image file)
+ * @param imageBufferTypeOut Optional type of the given image that is stored in the buffer, as determined by the decoder (if possible)
+ * @return The frame containing the image information, an invalid frame if the image could not be loaded
+ * @see encodeImage(), readImage().
+ * @ingroup ioimage
+ */
+OCEAN_IO_IMAGE_EXPORT Frame decodeImage(const void* buffer, const size_t size, const unsigned int minimalWidth, const unsigned int minimalHeight, const std::string& imageBufferTypeIn = std::string(), std::string* imageBufferTypeOut = nullptr);
+
 /**
  * Encodes (writes) a given frame as image (with specified image type) to a resulting buffer.
  * In case, the pixel format of the given frame is not supported by the destination, the function will fail.<br>
@@ -89,6 +105,17 @@ OCEAN_IO_IMAGE_EXPORT bool encodeImage(const Frame& frame, const std::string& im
  */
 OCEAN_IO_IMAGE_EXPORT Frame readImage(const std::string& filename);
 
+/**
+ * Reads/loads an image from a specified file with a reduced resolution if supported by the image codec.
+ * @param filename The name of the file from which the image will be loaded, must be valid
+ * @param minimalWidth The minimal width of the resulting image in pixel, 0 to avoid any reduction independent of the image width
+ * @param minimalHeight The minimal height of the resulting image in pixel, 0 to avoid any reduction independent of the image height
+ * @return The frame containing the image information, an invalid frame if the image could not be loaded
+ * @see decodeImage().
+ * @ingroup ioimage
+ */
+OCEAN_IO_IMAGE_EXPORT Frame readImage(const std::string& filename, const unsigned int minimalWidth, const unsigned int minimalHeight);
+
 /**
  * Writes a given frame to a specified file.
  * In case, the pixel format of the given frame is not supported by the destination, the function will fail.<br>
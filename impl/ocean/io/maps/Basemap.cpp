@@ -728,6 +728,13 @@ Basemap::SharedTile Basemap::newTileFromPBFData(const unsigned int level, const
 	return std::make_shared<Tile>(std::move(newTile));
 }
 
+Task<Basemap::SharedTile> Basemap::newTileFromPBFDataTask(const unsigned int level, const TileIndexPair tileIndexPair, std::vector<uint8_t> data)
+{
+	co_await TaskExecutor::get().schedule();
+
+	co_return newTileFromPBFData(level, tileIndexPair, data.data(), data.size());
+}
+
 Basemap::SharedObject Basemap::parseBuilding(vtzero::feature& vtzeroFeature, PixelPositionGroupsI&& outerPolygons, PixelPositionGroupsI&& innerPolygons, PixelPositionGroupsI&& lineStrings, const unsigned int layerExtent)
 {
 	if (outerPolygons.empty() && innerPolygons.empty() && lineStrings.empty())
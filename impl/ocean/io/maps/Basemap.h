@@ -10,6 +10,8 @@
 
 #include "ocean/io/maps/Maps.h"
 
+#include "ocean/base/Task.h"
+
 #include "ocean/cv/PixelBoundingBox.h"
 #include "ocean/cv/PixelPosition.h"
 
@@ -1091,6 +1093,17 @@ class OCEAN_IO_MAPS_EXPORT Basemap
 		 */
 		static SharedTile newTileFromPBFData(const unsigned int level, const TileIndexPair& tileIndexPair, const void* data, const size_t size);
 
+		/**
+		 * Creates a new tile based on given PBF data within a coroutine.
+		 * The data is parsed in a thread of the TaskExecutor, the awaiting coroutine is suspended meanwhile and continues in that thread.
+		 * @param level The detail level, with range [1, 22]
+		 * @param tileIndexPair The tile index pair defining the location of the tile, with range [0, numberTiles(level) - 1]x[0, numberTiles(level) - 1]
+		 * @param data The PBF data, e.g., the result of IO::Utilities::readFileTask(), must not be empty
+		 * @return The task providing the resulting tile, invalid if the given PBF data could not be parsed
+		 * @see newTileFromPBFData(), Task.
+		 */
+		static Task<SharedTile> newTileFromPBFDataTask(const unsigned int level, const TileIndexPair tileIndexPair, std::vector<uint8_t> data);
+
 		/**
 		 * Returns the url for downloading the map style data
 		 * @return The url for downloading the map style data
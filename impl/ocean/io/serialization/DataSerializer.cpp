@@ -52,6 +52,198 @@ bool DataSerializer::hasStopped() const
 	return true;
 }
 
+bool DataSerializer::writeChunkIndex(OutputBitstream& outputBitstream, const ChunkInformations& chunkInformations, const Channels& channels, const ChannelChunkInformationMap& channelChunkInformationMap)
+{
+	ocean_assert(outputBitstream);
+
+	if (!NumericT<uint32_t>::isInsideValueRange(chunkInformations.size()) || !NumericT<uint32_t>::isInsideValueRange(channels.size()))
+	{
+		return false;
+	}
+
+	const uint64_t indexOffset = outputBitstream.size();
+
+	if (!outputBitstream.write<uint32_t>(uint32_t(chunkInformations.size())))
+	{
+		return false;
+	}
+
+	for (const ChunkInformation& chunkInformation : chunkInformations)
+	{
+		if (!outputBitstream.write<uint64_t>(chunkInformation.offset_)
+				|| !outputBitstream.write<uint32_t>(chunkInformation.compressedSize_)
+				|| !outputBitstream.write<uint32_t>(chunkInformation.uncompressedSize_))
+		{
+			return false;
+		}
+	}
+
+	if (!outputBitstream.write<uint32_t>(uint32_t(channels.size())))
+	{
+		return false;
+	}
+
+	for (const Channel& channel : channels)
+	{
+		ocean_assert(channel.isValid());
+
+		if (!outputBitstream.write<uint32_t>(channel.channelId())
+				|| !outputBitstream.write<std::string>(channel.sampleType())
+				|| !outputBitstream.write<std::string>(channel.name())
+				|| !outputBitstream.write<std::string>(channel.contentType()))
+		{
+			return false;
+		}
+
+		const ChannelChunkInformationMap::const_iterator iChannel = channelChunkInformationMap.find(channel.channelId());
+
+		const uint32_t numberChannelChunks = iChannel != channelChunkInformationMap.cend() ? uint32_t(iChannel->second.size()) : 0u;
+
+		if (!outputBitstream.write<uint32_t>(numberChannelChunks))
+		{
+			return false;
+		}
+
+		if (numberChannelChunks != 0u)
+		{
+			for (const ChannelChunkInformation& channelChunkInformation : iChannel->second)
+			{
+				if (!outputBitstream.write<uint32_t>(channelChunkInformation.chunkIndex_)
+						|| !outputBitstream.write<double>(channelChunkInformation.firstPlaybackTimestamp_)
+						|| !outputBitstream.write<double>(channelChunkInformation.lastPlaybackTimestamp_))
+				{
+					return false;
+				}
+			}
+		}
+	}
+
+	return outputBitstream.write<uint64_t>(indexOffset) && outputBitstream.write("OCEANIDX", 8u);
+}
+
+bool DataSerializer::readChunkIndex(InputBitstream& inputBitstream, ChunkInformations& chunkInformations, Channels& channels, ChannelChunkInformationMap& channelChunkInformationMap)
+{
+	ocean_assert(inputBitstream);
+
+	chunkInformations.clear();
+	channels.clear();
+	channelChunkInformationMap.clear();
+
+	const uint64_t streamSize = inputBitstream.size();
+
+	if (streamSize == uint64_t(-1) || streamSize < chunkIndexFooterSize_ || !inputBitstream.setPosition(streamSize - chunkIndexFooterSize_))
+	{
+		return false;
+	}
+
+	uint64_t indexOffset = uint64_t(-1);
+	std::array<char, 8> tag = {};
+
+	if (!inputBitstream.read<uint64_t>(indexOffset) || !inputBitstream.read(tag.data(), tag.size()))
+	{
+		return false;
+	}
+
+	if (memcmp(tag.data(), "OCEANIDX", 8) != 0 || indexOffset >= streamSize - chunkIndexFooterSize_ || !inputBitstream.setPosition(indexOffset))
+	{
+		return false;
+	}
+
+	// the index cannot hold more elements than bytes left in the stream, which protects us against corrupted sizes
+
+	const uint64_t indexSize = streamSize - chunkIndexFooterSize_ - indexOffset;
+
+	uint32_t numberChunks = 0u;
+	if (!inputBitstream.read<uint32_t>(numberChunks) || uint64_t(numberChunks) > indexSize)
+	{
+		return false;
+	}
+
+	ChunkInformations localChunkInformations(numberChunks);
+
+	for (ChunkInformation& chunkInformation : localChunkInformations)
+	{
+		if (!inputBitstream.read<uint64_t>(chunkInformation.offset_)
+				|| !inputBitstream.read<uint32_t>(chunkInformation.compressedSize_)
+				|| !inputBitstream.read<uint32_t>(chunkInformation.uncompressedSize_))
+		{
+			return false;
+		}
+
+		if (chunkInformation.offset_ >= indexOffset || uint64_t(chunkInformation.compressedSize_) > indexOffset - chunkInformation.offset_)
+		{
+			return false;
+		}
+	}
+
+	uint32_t numberChannels = 0u;
+	if (!inputBitstream.read<uint32_t>(numberChannels) || uint64_t(numberChannels) > indexSize)
+	{
+		return false;
+	}
+
+	Channels localChannels;
+	localChannels.reserve(numberChannels);
+
+	ChannelChunkInformationMap localChannelChunkInformationMap;
+	localChannelChunkInformationMap.reserve(numberChannels);
+
+	for (uint32_t nChannel = 0u; nChannel < numberChannels; ++nChannel)
+	{
+		uint32_t channelId = invalidChannelId();
+		std::string sampleType;
+		std::string name;
+		std::string contentType;
+
+		if (!inputBitstream.read<uint32_t>(channelId)
+				|| !inputBitstream.read<std::string>(sampleType)
+				|| !inputBitstream.read<std::string>(name)
+				|| !inputBitstream.read<std::string>(contentType))
+		{
+			return false;
+		}
+
+		const Channel channel(ChannelConfiguration(sampleType, name, contentType), channelId);
+
+		if (!channel.isValid() || isConfigurationChannelId(channelId) || localChannelChunkInformationMap.contains(channelId))
+		{
+			return false;
+		}
+
+		uint32_t numberChannelChunks = 0u;
+		if (!inputBitstream.read<uint32_t>(numberChannelChunks) || uint64_t(numberChannelChunks) > indexSize)
+		{
+			return false;
+		}
+
+		ChannelChunkInformations channelChunkInformations(numberChannelChunks);
+
+		for (ChannelChunkInformation& channelChunkInformation : channelChunkInformations)
+		{
+			if (!inputBitstream.read<uint32_t>(channelChunkInformation.chunkIndex_)
+					|| !inputBitstream.read<double>(channelChunkInformation.firstPlaybackTimestamp_)
+					|| !inputBitstream.read<double>(channelChunkInformation.lastPlaybackTimestamp_))
+			{
+				return false;
+			}
+
+			if (channelChunkInformation.chunkIndex_ >= numberChunks)
+			{
+				return false;
+			}
+		}
+
+		localChannels.emplace_back(channel);
+		localChannelChunkInformationMap.emplace(channelId, std::move(channelChunkInformations));
+	}
+
+	chunkInformations = std::move(localChunkInformations);
+	channels = std::move(localChannels);
+	channelChunkInformationMap = std::move(localChannelChunkInformationMap);
+
+	return true;
+}
+
 }
 
 }
@@ -268,6 +268,50 @@ class OCEAN_IO_SERIALIZATION_EXPORT DataSerializer : protected Thread
 				inline const std::string& type() const override;
 		};
 
+		/**
+		 * This class holds the location of one chunk within a stream with chunked layout.
+		 * Each chunk is a gzip compressed block of regular sample records and can be decompressed independently of all other chunks.
+		 */
+		class ChunkInformation
+		{
+			public:
+
+				/// The position of the chunk's header within the stream, in bytes.
+				uint64_t offset_ = uint64_t(-1);
+
+				/// The size of the compressed chunk payload, in bytes.
+				uint32_t compressedSize_ = 0u;
+
+				/// The size of the uncompressed chunk payload, in bytes.
+				uint32_t uncompressedSize_ = 0u;
+		};
+
+		/// Definition of a vector holding chunk information objects.
+		using ChunkInformations = std::vector<ChunkInformation>;
+
+		/**
+		 * This class holds the time range of the samples of one channel within one chunk.
+		 */
+		class ChannelChunkInformation
+		{
+			public:
+
+				/// The index of the chunk, with range [0, infinity)
+				uint32_t chunkIndex_ = uint32_t(-1);
+
+				/// The smallest playback timestamp of all samples of the channel within the chunk, in seconds.
+				double firstPlaybackTimestamp_ = NumericD::maxValue();
+
+				/// The largest playback timestamp of all samples of the channel within the chunk, in seconds.
+				double lastPlaybackTimestamp_ = NumericD::minValue();
+		};
+
+		/// Definition of a vector holding channel chunk information objects, sorted by chunk index.
+		using ChannelChunkInformations = std::vector<ChannelChunkInformation>;
+
+		/// Definition of a map mapping channel ids to the chunk information objects of the channels.
+		using ChannelChunkInformationMap = std::unordered_map<ChannelId, ChannelChunkInformations>;
+
 	public:
 
 		/**
@@ -340,8 +384,42 @@ class OCEAN_IO_SERIALIZATION_EXPORT DataSerializer : protected Thread
 		 */
 		[[nodiscard]] static constexpr ChannelId extractChannelId(const uint32_t channelValue);
 
+		/**
+		 * Writes the trailing index of a stream with chunked layout.
+		 * The index is followed by a footer holding the position of the index and the tag 'OCEANIDX', so that readers can locate the index from the end of the stream.
+		 * @param outputBitstream The output bitstream to which the index will be written
+		 * @param chunkInformations The information of all chunks in the stream, in stream order
+		 * @param channels The channels which are stored in the stream
+		 * @param channelChunkInformationMap The time ranges of all channels within the individual chunks
+		 * @return True, if succeeded
+		 */
+		static bool writeChunkIndex(OutputBitstream& outputBitstream, const ChunkInformations& chunkInformations, const Channels& channels, const ChannelChunkInformationMap& channelChunkInformationMap);
+
+		/**
+		 * Reads the trailing index of a stream with chunked layout.
+		 * The position of the input bitstream is undefined after this function returns.
+		 * @param inputBitstream The input bitstream from which the index will be read
+		 * @param chunkInformations The resulting information of all chunks in the stream, in stream order
+		 * @param channels The resulting channels which are stored in the stream
+		 * @param channelChunkInformationMap The resulting time ranges of all channels within the individual chunks
+		 * @return True, if the stream contained a valid index
+		 */
+		static bool readChunkIndex(InputBitstream& inputBitstream, ChunkInformations& chunkInformations, Channels& channels, ChannelChunkInformationMap& channelChunkInformationMap);
+
 	protected:
 
+		/// The version of streams in which all records are stored sequentially and uncompressed.
+		static constexpr uint32_t plainLayoutVersion_ = 0u;
+
+		/// The version of streams in which all records are stored in independently compressed chunks, followed by a trailing index.
+		static constexpr uint32_t chunkedLayoutVersion_ = 1u;
+
+		/// The size of the header of each chunk in a stream with chunked layout (compressed size and uncompressed size), in bytes.
+		static constexpr uint64_t chunkHeaderSize_ = 8ull;
+
+		/// The size of the footer of a stream with chunked layout (index position and tag), in bytes.
+		static constexpr uint64_t chunkIndexFooterSize_ = 16ull;
+
 		/// The timestamp when the serializer was started.
 		Timestamp startTimestamp_;
 
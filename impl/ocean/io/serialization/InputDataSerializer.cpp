@@ -7,6 +7,8 @@
 
 #include "ocean/io/serialization/InputDataSerializer.h"
 
+#include "ocean/io/MemoryInputStream.h"
+
 namespace Ocean
 {
 
@@ -68,7 +70,15 @@ bool InputDataSerializer::initialize(Channels* preparsedChannels, bool* isStream
 
 	bool correctEndOfStreamIndication = false;
 
-	if (preparsedChannels != nullptr)
+	if (version_ == chunkedLayoutVersion_)
+	{
+		if (!initializeChunks(inputBitstream, preparsedChannels, correctEndOfStreamIndication))
+		{
+			stream_ = nullptr;
+			return false;
+		}
+	}
+	else if (preparsedChannels != nullptr)
 	{
 		// we pre-parse the channels to ensure that we can register the channels before the first sample arrives
 
@@ -308,11 +318,13 @@ UniqueDataSample InputDataSerializer::sample(ChannelId& channelId, const double
 	if (speed > 0.0)
 	{
 		ocean_assert(startTimestamp_.isValid());
-		const double playbackTimestamp = double(currentTimestamp - startTimestamp_);
+
+		const double firstPlaybackTimestamp = seekPlaybackTimestamp_ != NumericD::minValue() ? seekPlaybackTimestamp_ : 0.0;
+		const double playbackTimestamp = firstPlaybackTimestamp + double(currentTimestamp - startTimestamp_) * speed;
 
 		const double samplePlaybackTimestamp = sampleQueue_.top().second->playbackTimestamp();
 
-		if (samplePlaybackTimestamp > playbackTimestamp * speed)
+		if (samplePlaybackTimestamp > playbackTimestamp)
 		{
 			return nullptr;
 		}
@@ -353,6 +365,50 @@ DataSerializer::Channels InputDataSerializer::channels() const
 	return result;
 }
 
+bool InputDataSerializer::seek(const double playbackTimestamp)
+{
+	ocean_assert(playbackTimestamp >= 0.0);
+
+	if (playbackTimestamp < 0.0)
+	{
+		return false;
+	}
+
+	const ScopedLock scopedLock(lock_);
+
+	if (state_ >= S_STARTED)
+	{
+		ocean_assert(false && "The serializer has been started already!");
+		return false;
+	}
+
+	seekPlaybackTimestamp_ = playbackTimestamp;
+
+	return true;
+}
+
+bool InputDataSerializer::setSubscribedChannels(const UnorderedIndexSet32& channelIds)
+{
+	const ScopedLock scopedLock(lock_);
+
+	if (state_ >= S_STARTED)
+	{
+		ocean_assert(false && "The serializer has been started already!");
+		return false;
+	}
+
+	subscribedChannelIds_ = channelIds;
+
+	return true;
+}
+
+bool InputDataSerializer::hasChunkIndex() const
+{
+	const ScopedLock scopedLock(lock_);
+
+	return hasChunkIndex_;
+}
+
 bool InputDataSerializer::readHeader(InputBitstream& inputBitstream)
 {
 	ocean_assert(inputBitstream);
@@ -378,12 +434,14 @@ bool InputDataSerializer::readHeader(InputBitstream& inputBitstream)
 		return false;
 	}
 
-	if (version != 0u)
+	if (version != plainLayoutVersion_ && version != chunkedLayoutVersion_)
 	{
 		ocean_assert(false && "Invalid version!");
 		return false;
 	}
 
+	version_ = version;
+
 	return true;
 }
 
@@ -394,176 +452,458 @@ void InputDataSerializer::threadRun()
 	ExtendedChannelMap extendedChannelMap; // local channel map for performance (no lock needed), will be synchronized with member extendedChannelMap_ under lock (whenever updated)
 	extendedChannelMap.reserve(32);
 
+	UnorderedIndexSet32 parsedChannelIds;
+
 	InputBitstream& inputBitstream = stream_->inputBitstream();
 
-	while (!shouldThreadStop())
+	if (version_ == chunkedLayoutVersion_)
 	{
-		TemporaryScopedLock scopedTemporaryLock(lock_);
-
-			if (state_ >= S_STOPPING)
+		if (!readChunks(inputBitstream, extendedChannelMap, parsedChannelIds))
+		{
+			succeeded_ = false;
+		}
+	}
+	else
+	{
+		while (!shouldThreadStop())
+		{
+			if (!waitForSampleQueue())
 			{
 				break;
 			}
 
-			if (sampleQueue_.size() > maxPendingSampleQueueSize_)
+			uint32_t channelValue = 0u;
+			if (!inputBitstream.read<uint32_t>(channelValue))
 			{
-				scopedTemporaryLock.release();
+				if (inputBitstream.isEndOfFile())
+				{
+					Log::debug() << "InputDataSerializer: The input seems to be corrupted, end of stream indication is missing";
+					break;
+				}
 
-				Thread::sleep(1u);
-				continue;
+				succeeded_ = false;
+				break;
 			}
 
-		scopedTemporaryLock.release();
+			if (channelValue == invalidChannelId())
+			{
+				// we have reached the end of the stream, indicated by an invalid channel id
 
-		uint32_t channelValue = 0u;
-		if (!inputBitstream.read<uint32_t>(channelValue))
-		{
-			if (inputBitstream.isEndOfFile())
+				uint8_t lastReadAttempt;
+				if (inputBitstream.read<uint8_t>(lastReadAttempt) || !inputBitstream.isEndOfFile())
+				{
+					Log::debug() << "InputDataSerializer: The input seems to be corrupted, we read and end of stream indication without being at the end of the stream";
+					succeeded_ = false;
+				}
+
+				break;
+			}
+
+			uint32_t payloadSize = 0u;
+			if (!inputBitstream.read<uint32_t>(payloadSize))
 			{
-				Log::debug() << "InputDataSerializer: The input seems to be corrupted, end of stream indication is missing";
+				succeeded_ = false;
 				break;
 			}
 
-			succeeded_ = false;
-			break;
+			if (!processRecord(inputBitstream, channelValue, payloadSize, extendedChannelMap, parsedChannelIds))
+			{
+				succeeded_ = false;
+				break;
+			}
 		}
+	}
 
-		if (channelValue == invalidChannelId())
+	const ScopedLock scopedLock(lock_);
+
+	stream_ = nullptr;
+	state_ = S_STOPPED;
+}
+
+bool InputDataSerializer::initializeChunks(InputBitstream& inputBitstream, Channels* preparsedChannels, bool& correctEndOfStreamIndication)
+{
+	ocean_assert(version_ == chunkedLayoutVersion_);
+
+	correctEndOfStreamIndication = false;
+
+	hasChunkIndex_ = readChunkIndex(inputBitstream, chunkInformations_, indexedChannels_, channelChunkInformationMap_);
+
+	if (hasChunkIndex_)
+	{
+		// the index is written after all chunks, so the stream has been finished correctly
+
+		correctEndOfStreamIndication = true;
+
+		if (preparsedChannels != nullptr)
 		{
-			// we have reached the end of the stream, indicated by an invalid channel id
+			*preparsedChannels = indexedChannels_;
+		}
 
-			uint8_t lastReadAttempt;
-			if (inputBitstream.read<uint8_t>(lastReadAttempt) || !inputBitstream.isEndOfFile())
-			{
-				Log::debug() << "InputDataSerializer: The input seems to be corrupted, we read and end of stream indication without being at the end of the stream";
-				succeeded_ = false;
-			}
+		return true;
+	}
+
+	Log::debug() << "InputDataSerializer: The chunk index is missing, the chunks are scanned sequentially";
+
+	// the stream has not been finished correctly (e.g., the recording was interrupted), so we locate the chunks which have been written
 
+	inputBitstream.reset();
+	ocean_assert(inputBitstream);
+
+	if (!readHeader(inputBitstream))
+	{
+		return false;
+	}
+
+	while (true)
+	{
+		ChunkInformation chunkInformation;
+		chunkInformation.offset_ = inputBitstream.position();
+
+		if (!inputBitstream.read<uint32_t>(chunkInformation.compressedSize_) || !inputBitstream.read<uint32_t>(chunkInformation.uncompressedSize_))
+		{
 			break;
 		}
 
-		uint32_t payloadSize = 0u;
-		if (!inputBitstream.read<uint32_t>(payloadSize))
+		if (chunkInformation.compressedSize_ == 0u)
 		{
-			succeeded_ = false;
+			// the empty chunk indicates the end of all chunks
 			break;
 		}
 
-		if (isConfigurationChannelId(channelValue))
+		if (!inputBitstream.skip(uint64_t(chunkInformation.compressedSize_)))
 		{
-			const ChannelId channelId = extractChannelId(channelValue);
+			// the last chunk is incomplete
+			break;
+		}
 
-			if (extendedChannelMap.contains(channelId))
-			{
-				ocean_assert(false && "The channel has already been registered!");
+		chunkInformations_.emplace_back(chunkInformation);
+	}
 
-				succeeded_ = false;
-				break;
-			}
+	inputBitstream.reset();
+	ocean_assert(inputBitstream);
 
-#ifdef OCEAN_DEBUG
-			const uint64_t debugStartPosition = inputBitstream.position();
-#endif
+	if (preparsedChannels != nullptr)
+	{
+		Channels channels;
+		channels.reserve(16);
 
-			DataSampleChannelConfiguration dataSampleChannelConfiguration;
-			if (!dataSampleChannelConfiguration.readSample(inputBitstream) || !dataSampleChannelConfiguration.isValid())
+		UnorderedIndexSet32 channelIdSet;
+
+		Compression::Buffer compressedChunk;
+		Compression::Buffer chunk;
+
+		for (const ChunkInformation& chunkInformation : chunkInformations_)
+		{
+			if (!readChunk(inputBitstream, chunkInformation, compressedChunk, chunk))
 			{
-				succeeded_ = false;
-				break;
+				return false;
 			}
 
-#ifdef OCEAN_DEBUG
-			const uint64_t debugBytesRead = inputBitstream.position() - debugStartPosition;
+			MemoryInputStream chunkStream(chunk.data(), chunk.size());
+			InputBitstream chunkBitstream(chunkStream);
 
-			if (debugBytesRead != uint64_t(payloadSize))
+			for (uint64_t position = 0ull; position < uint64_t(chunk.size()); position = chunkBitstream.position())
 			{
-				ocean_assert(false && "Payload size mismatch!");
-				succeeded_ = false;
-				break;
+				uint32_t channelValue = 0u;
+				uint32_t payloadSize = 0u;
+
+				if (!chunkBitstream.read<uint32_t>(channelValue) || !chunkBitstream.read<uint32_t>(payloadSize))
+				{
+					return false;
+				}
+
+				if (isConfigurationChannelId(channelValue))
+				{
+					const ChannelId channelId = extractChannelId(channelValue);
+
+					DataSampleChannelConfiguration dataSampleChannelConfiguration;
+					if (!channelIdSet.emplace(channelId).second || !dataSampleChannelConfiguration.readSample(chunkBitstream) || !dataSampleChannelConfiguration.isValid())
+					{
+						return false;
+					}
+
+					channels.emplace_back(dataSampleChannelConfiguration, channelId);
+				}
+				else if (!chunkBitstream.skip(uint64_t(payloadSize)))
+				{
+					return false;
+				}
 			}
-#endif // OCEAN_DEBUG
+		}
 
-			ChannelEventFunction channelEventFunction;
+		*preparsedChannels = std::move(channels);
+	}
 
-			const Channel channel(dataSampleChannelConfiguration, channelId);
+	return true;
+}
 
-			TemporaryScopedLock temporaryScopedLock(lock_);
+bool InputDataSerializer::readChunks(InputBitstream& inputBitstream, ExtendedChannelMap& extendedChannelMap, UnorderedIndexSet32& parsedChannelIds)
+{
+	ocean_assert(version_ == chunkedLayoutVersion_);
 
-				FactoryFunctionMap::const_iterator iFactoryFunction = factoryFunctionMap_.find(dataSampleChannelConfiguration.sampleType());
+	Indices32 chunkIndices;
 
-				if (iFactoryFunction != factoryFunctionMap_.cend())
-				{
-					const ExtendedChannel extendedChannel(channel, iFactoryFunction->second);
+	if (hasChunkIndex_)
+	{
+		// the channels are known from the index, so that chunks can be read in any order
 
-					extendedChannelMap.emplace(channelId, extendedChannel); // local channel map for lock-free lookup
+		for (const Channel& channel : indexedChannels_)
+		{
+			parsedChannelIds.emplace(channel.channelId());
 
-					extendedChannelMap_.emplace(channelId, extendedChannel); // global channel map for lock-based lookup
+			registerChannel(channel, extendedChannelMap);
+		}
 
-				}
-				else
+		// we read only chunks which hold samples of subscribed channels (with factory function) at or after the seek position
+
+		std::vector<uint8_t> relevantChunks(chunkInformations_.size(), 0u);
+
+		for (const ChannelChunkInformationMap::value_type& channelPair : channelChunkInformationMap_)
+		{
+			if (!extendedChannelMap.contains(channelPair.first) || (!subscribedChannelIds_.empty() && !subscribedChannelIds_.contains(channelPair.first)))
+			{
+				continue;
+			}
+
+			for (const ChannelChunkInformation& channelChunkInformation : channelPair.second)
+			{
+				ocean_assert(channelChunkInformation.chunkIndex_ < relevantChunks.size());
+
+				if (channelChunkInformation.lastPlaybackTimestamp_ >= seekPlaybackTimestamp_)
 				{
-					Log::debug() << "FileInputDataSerializer: The sample type '" << dataSampleChannelConfiguration.sampleType() << "' is not registered, skipping";
+					relevantChunks[channelChunkInformation.chunkIndex_] = 1u;
 				}
+			}
+		}
+
+		for (size_t nChunk = 0; nChunk < relevantChunks.size(); ++nChunk)
+		{
+			if (relevantChunks[nChunk] != 0u)
+			{
+				chunkIndices.emplace_back(Index32(nChunk));
+			}
+		}
+	}
+	else
+	{
+		// without index, all chunks are read in stream order so that the channel configurations are parsed before the channels' samples
+
+		chunkIndices.reserve(chunkInformations_.size());
+
+		for (size_t nChunk = 0; nChunk < chunkInformations_.size(); ++nChunk)
+		{
+			chunkIndices.emplace_back(Index32(nChunk));
+		}
+	}
+
+	Compression::Buffer compressedChunk;
+	Compression::Buffer chunk;
+
+	for (const Index32 chunkIndex : chunkIndices)
+	{
+		if (shouldThreadStop() || !waitForSampleQueue())
+		{
+			return true;
+		}
+
+		ocean_assert(chunkIndex < chunkInformations_.size());
+
+		if (!readChunk(inputBitstream, chunkInformations_[chunkIndex], compressedChunk, chunk))
+		{
+			return false;
+		}
+
+		MemoryInputStream chunkStream(chunk.data(), chunk.size());
+		InputBitstream chunkBitstream(chunkStream);
+
+		for (uint64_t position = 0ull; position < uint64_t(chunk.size()); position = chunkBitstream.position())
+		{
+			if (shouldThreadStop() || !waitForSampleQueue())
+			{
+				return true;
+			}
 
-				channelEventFunction = channelEventFunction_;
+			uint32_t channelValue = 0u;
+			uint32_t payloadSize = 0u;
 
-			temporaryScopedLock.release();
+			if (!chunkBitstream.read<uint32_t>(channelValue) || !chunkBitstream.read<uint32_t>(payloadSize))
+			{
+				return false;
+			}
 
-			if (channelEventFunction)
+			if (!processRecord(chunkBitstream, channelValue, payloadSize, extendedChannelMap, parsedChannelIds))
 			{
-				channelEventFunction(channel);
+				return false;
 			}
 		}
-		else
-		{
-			const ChannelId channelId = extractChannelId(channelValue);
+	}
 
-			const ExtendedChannelMap::const_iterator iExtendedChannel = extendedChannelMap.find(channelId);
+	return true;
+}
 
-			if (iExtendedChannel != extendedChannelMap.cend())
+bool InputDataSerializer::processRecord(InputBitstream& inputBitstream, const uint32_t channelValue, const uint32_t payloadSize, ExtendedChannelMap& extendedChannelMap, UnorderedIndexSet32& parsedChannelIds)
+{
+	const ChannelId channelId = extractChannelId(channelValue);
+
+	if (isConfigurationChannelId(channelValue))
+	{
+		if (parsedChannelIds.contains(channelId))
+		{
+			if (hasChunkIndex_)
 			{
-				const ExtendedChannel& channel = iExtendedChannel->second;
+				// the channel is known from the chunk index already
+				return inputBitstream.skip(uint64_t(payloadSize));
+			}
 
-				const FactoryFunction& factoryFunction = channel.factoryFunction_;
-				ocean_assert(factoryFunction);
+			ocean_assert(false && "The channel has already been registered!");
+			return false;
+		}
 
-				UniqueDataSample sample = factoryFunction(channel.sampleType());
+#ifdef OCEAN_DEBUG
+		const uint64_t debugStartPosition = inputBitstream.position();
+#endif
 
-				ocean_assert(sample);
-				if (!sample)
-				{
-					succeeded_ = false;
-					break;
-				}
+		DataSampleChannelConfiguration dataSampleChannelConfiguration;
+		if (!dataSampleChannelConfiguration.readSample(inputBitstream) || !dataSampleChannelConfiguration.isValid())
+		{
+			return false;
+		}
 
-				if (sample->readSample(inputBitstream))
-				{
-					const ScopedLock scopedLock(lock_);
+#ifdef OCEAN_DEBUG
+		const uint64_t debugBytesRead = inputBitstream.position() - debugStartPosition;
 
-					sampleQueue_.emplace(channelId, std::move(sample));
-				}
-				else
-				{
-					ocean_assert(false && "Failed to read the sample!");
-					succeeded_ = false;
-					break;
-				}
+		if (debugBytesRead != uint64_t(payloadSize))
+		{
+			ocean_assert(false && "Payload size mismatch!");
+			return false;
+		}
+#endif // OCEAN_DEBUG
+
+		parsedChannelIds.emplace(channelId);
+
+		registerChannel(Channel(dataSampleChannelConfiguration, channelId), extendedChannelMap);
+
+		return true;
+	}
+
+	const ExtendedChannelMap::const_iterator iExtendedChannel = extendedChannelMap.find(channelId);
+
+	if (iExtendedChannel == extendedChannelMap.cend() || (!subscribedChannelIds_.empty() && !subscribedChannelIds_.contains(channelId)))
+	{
+		return inputBitstream.skip(uint64_t(payloadSize));
+	}
+
+	const ExtendedChannel& channel = iExtendedChannel->second;
+
+	const FactoryFunction& factoryFunction = channel.factoryFunction_;
+	ocean_assert(factoryFunction);
+
+	UniqueDataSample sample = factoryFunction(channel.sampleType());
+
+	ocean_assert(sample);
+	if (!sample)
+	{
+		return false;
+	}
+
+	if (!sample->readSample(inputBitstream))
+	{
+		ocean_assert(false && "Failed to read the sample!");
+		return false;
+	}
+
+	if (sample->playbackTimestamp() < seekPlaybackTimestamp_)
+	{
+		// the sample is located before the seek position
+		return true;
+	}
+
+	const ScopedLock scopedLock(lock_);
+
+	sampleQueue_.emplace(channelId, std::move(sample));
+
+	return true;
+}
+
+void InputDataSerializer::registerChannel(const Channel& channel, ExtendedChannelMap& extendedChannelMap)
+{
+	ocean_assert(channel.isValid());
+
+	ChannelEventFunction channelEventFunction;
+
+	TemporaryScopedLock temporaryScopedLock(lock_);
+
+		FactoryFunctionMap::const_iterator iFactoryFunction = factoryFunctionMap_.find(channel.sampleType());
+
+		if (iFactoryFunction != factoryFunctionMap_.cend())
+		{
+			const ExtendedChannel extendedChannel(channel, iFactoryFunction->second);
+
+			extendedChannelMap.emplace(channel.channelId(), extendedChannel); // local channel map for lock-free lookup
+
+			extendedChannelMap_.emplace(channel.channelId(), extendedChannel); // global channel map for lock-based lookup
+		}
+		else
+		{
+			Log::debug() << "FileInputDataSerializer: The sample type '" << channel.sampleType() << "' is not registered, skipping";
+		}
+
+		channelEventFunction = channelEventFunction_;
+
+	temporaryScopedLock.release();
+
+	if (channelEventFunction)
+	{
+		channelEventFunction(channel);
+	}
+}
+
+bool InputDataSerializer::waitForSampleQueue()
+{
+	while (true)
+	{
+		TemporaryScopedLock scopedTemporaryLock(lock_);
+
+			if (state_ >= S_STOPPING)
+			{
+				return false;
 			}
-			else
+
+			if (sampleQueue_.size() <= maxPendingSampleQueueSize_)
 			{
-				if (!inputBitstream.skip(uint64_t(payloadSize)))
-				{
-					succeeded_ = false;
-					break;
-				}
+				return true;
 			}
+
+		scopedTemporaryLock.release();
+
+		if (shouldThreadStop())
+		{
+			return false;
 		}
+
+		Thread::sleep(1u);
 	}
+}
 
-	const ScopedLock scopedLock(lock_);
+bool InputDataSerializer::readChunk(InputBitstream& inputBitstream, const ChunkInformation& chunkInformation, Compression::Buffer& compressedChunk, Compression::Buffer& chunk)
+{
+	ocean_assert(chunkInformation.compressedSize_ != 0u);
 
-	stream_ = nullptr;
-	state_ = S_STOPPED;
+	compressedChunk.resize(chunkInformation.compressedSize_);
+
+	if (!inputBitstream.setPosition(chunkInformation.offset_ + chunkHeaderSize_) || !inputBitstream.read(compressedChunk.data(), compressedChunk.size()))
+	{
+		return false;
+	}
+
+	chunk.clear();
+
+	if (!Compression::gzipDecompress(compressedChunk.data(), compressedChunk.size(), chunk))
+	{
+		return false;
+	}
+
+	return chunk.size() == size_t(chunkInformation.uncompressedSize_);
 }
 
 bool FileInputDataSerializer::setFilename(const std::string& filename)
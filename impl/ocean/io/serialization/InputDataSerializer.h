@@ -11,6 +11,8 @@
 #include "ocean/io/serialization/Serialization.h"
 #include "ocean/io/serialization/DataSerializer.h"
 
+#include "ocean/io/Compression.h"
+
 #include <functional>
 
 namespace Ocean
@@ -28,7 +30,9 @@ namespace Serialization
  * Before starting playback, factory functions must be registered for each expected sample type so that the serializer can construct the appropriate sample objects when reading from the stream.<br>
  * Samples for which no factory function is registered are simply skipped during playback.<br>
  * Samples are returned through the sample() function in playback order, with optional speed control for real-time or accelerated playback.<br>
- * The class uses a background thread to continuously read and buffer samples, ensuring smooth playback without blocking.
+ * The class uses a background thread to continuously read and buffer samples, ensuring smooth playback without blocking.<br>
+ * Playback can start at an arbitrary playback timestamp (see seek()) and can be restricted to a subset of channels (see setSubscribedChannels()).
+ * For streams with chunked layout (see OutputDataSerializer::setChunkedLayout()), the trailing index is used to read only chunks holding relevant samples, all other chunks are not decompressed.
  * @ingroup ioserialization
  */
 class OCEAN_IO_SERIALIZATION_EXPORT InputDataSerializer : public DataSerializer
@@ -226,6 +230,33 @@ class OCEAN_IO_SERIALIZATION_EXPORT InputDataSerializer : public DataSerializer
 		 */
 		[[nodiscard]] Channels channels() const;
 
+		/**
+		 * Sets the playback timestamp at which the playback will start.
+		 * All samples with a smaller playback timestamp will be skipped, and the playback speed of sample() is applied relative to this timestamp.<br>
+		 * For streams with chunked layout and index, chunks holding only samples before the playback timestamp are not read at all; for all other streams the samples are skipped while reading.<br>
+		 * This function must be called before the serializer is started.
+		 * @param playbackTimestamp The playback timestamp at which the playback will start, in seconds, with range [0, infinity)
+		 * @return True, if succeeded
+		 */
+		bool seek(const double playbackTimestamp);
+
+		/**
+		 * Sets the channels which will be read, samples of all other channels will be skipped.
+		 * For streams with chunked layout and index, chunks holding no samples of the subscribed channels are not read at all.<br>
+		 * The ids of the channels are available e.g., via the preparsed channels of initialize().<br>
+		 * This function must be called before the serializer is started.
+		 * @param channelIds The ids of the channels to read, an empty set to read all channels
+		 * @return True, if succeeded
+		 */
+		bool setSubscribedChannels(const UnorderedIndexSet32& channelIds);
+
+		/**
+		 * Returns whether the stream has a chunked layout with a valid trailing index.
+		 * The function returns a valid result after the serializer has been initialized.
+		 * @return True, if so
+		 */
+		[[nodiscard]] bool hasChunkIndex() const;
+
 	protected:
 
 		/**
@@ -247,6 +278,58 @@ class OCEAN_IO_SERIALIZATION_EXPORT InputDataSerializer : public DataSerializer
 		 */
 		void threadRun() override;
 
+		/**
+		 * Initializes the chunks of a stream with chunked layout, either from the trailing index or by scanning the stream if the index is missing.
+		 * @param inputBitstream The input bitstream of the stream, the position of the bitstream is undefined afterwards
+		 * @param preparsedChannels Optional resulting channels stored in the stream, nullptr if not of interest
+		 * @param correctEndOfStreamIndication The resulting flag whether the stream has been finished correctly
+		 * @return True, if succeeded
+		 */
+		bool initializeChunks(InputBitstream& inputBitstream, Channels* preparsedChannels, bool& correctEndOfStreamIndication);
+
+		/**
+		 * Reads all relevant chunks of a stream with chunked layout and queues their samples.
+		 * @param inputBitstream The input bitstream of the stream
+		 * @param extendedChannelMap The local map of channels with factory function, will be extended by all parsed channels
+		 * @param parsedChannelIds The ids of all channels which have been parsed so far, will be extended by all parsed channels
+		 * @return True, if succeeded
+		 */
+		bool readChunks(InputBitstream& inputBitstream, ExtendedChannelMap& extendedChannelMap, UnorderedIndexSet32& parsedChannelIds);
+
+		/**
+		 * Processes one record (a channel configuration or a sample) of the stream.
+		 * @param inputBitstream The input bitstream positioned at the payload of the record
+		 * @param channelValue The channel value of the record, either a channel id or a configuration channel id
+		 * @param payloadSize The size of the record's payload, in bytes
+		 * @param extendedChannelMap The local map of channels with factory function, will be extended if the record holds a new channel configuration
+		 * @param parsedChannelIds The ids of all channels which have been parsed so far, will be extended if the record holds a new channel configuration
+		 * @return True, if succeeded
+		 */
+		bool processRecord(InputBitstream& inputBitstream, const uint32_t channelValue, const uint32_t payloadSize, ExtendedChannelMap& extendedChannelMap, UnorderedIndexSet32& parsedChannelIds);
+
+		/**
+		 * Registers a parsed channel, looks up the channel's factory function, and invokes the channel event function.
+		 * @param channel The channel to register, must be valid
+		 * @param extendedChannelMap The local map of channels with factory function, will be extended if a factory function exists for the channel
+		 */
+		void registerChannel(const Channel& channel, ExtendedChannelMap& extendedChannelMap);
+
+		/**
+		 * Waits until the sample queue can take further samples.
+		 * @return True, if further samples can be queued; False, if the serializer is stopping
+		 */
+		bool waitForSampleQueue();
+
+		/**
+		 * Reads and decompresses one chunk of a stream with chunked layout.
+		 * @param inputBitstream The input bitstream of the stream
+		 * @param chunkInformation The information of the chunk to read
+		 * @param compressedChunk Intermediate buffer for the compressed chunk
+		 * @param chunk The resulting uncompressed records of the chunk
+		 * @return True, if succeeded
+		 */
+		static bool readChunk(InputBitstream& inputBitstream, const ChunkInformation& chunkInformation, Compression::Buffer& compressedChunk, Compression::Buffer& chunk);
+
 	protected:
 
 		/// The input stream.
@@ -264,6 +347,27 @@ class OCEAN_IO_SERIALIZATION_EXPORT InputDataSerializer : public DataSerializer
 		/// The priority queue holding samples which are pending to be retrieved, ordered by playback timestamp (smallest first).
 		SampleQueue sampleQueue_;
 
+		/// The version of the stream's layout.
+		uint32_t version_ = plainLayoutVersion_;
+
+		/// True, if the stream has a chunked layout with a valid trailing index.
+		bool hasChunkIndex_ = false;
+
+		/// The information of all chunks of a stream with chunked layout.
+		ChunkInformations chunkInformations_;
+
+		/// The channels stored in the trailing index of a stream with chunked layout.
+		Channels indexedChannels_;
+
+		/// The time ranges of all channels within the individual chunks, stored in the trailing index of a stream with chunked layout.
+		ChannelChunkInformationMap channelChunkInformationMap_;
+
+		/// The playback timestamp at which the playback starts, NumericD::minValue() to start at the beginning of the stream.
+		double seekPlaybackTimestamp_ = NumericD::minValue();
+
+		/// The ids of the channels to read, an empty set to read all channels.
+		UnorderedIndexSet32 subscribedChannelIds_;
+
 		/// The maximum number of pending samples in the queue.
 		static constexpr size_t maxPendingSampleQueueSize_ = 100;
 };
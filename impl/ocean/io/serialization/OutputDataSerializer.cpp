@@ -147,6 +147,29 @@ bool OutputDataSerializer::addSample(const ChannelId channelId, UniqueDataSample
 	return true;
 }
 
+bool OutputDataSerializer::setChunkedLayout(const size_t chunkSize, const unsigned int compressionThreads)
+{
+	ocean_assert(chunkSize < size_t(1u << 31u));
+
+	if (chunkSize >= size_t(1u << 31u))
+	{
+		return false;
+	}
+
+	const ScopedLock scopedLock(lock_);
+
+	if (state_ >= S_STARTED || stream_)
+	{
+		ocean_assert(false && "The serializer has been started already!");
+		return false;
+	}
+
+	chunkSize_ = chunkSize;
+	compressionThreads_ = compressionThreads;
+
+	return true;
+}
+
 bool OutputDataSerializer::writeHeader(OutputBitstream& outputBitstream)
 {
 	ocean_assert(outputBitstream);
@@ -157,7 +180,7 @@ bool OutputDataSerializer::writeHeader(OutputBitstream& outputBitstream)
 		return false;
 	}
 
-	constexpr uint32_t version = 0u;
+	const uint32_t version = chunkSize_ != 0 ? chunkedLayoutVersion_ : plainLayoutVersion_;
 	if (!outputBitstream.write<uint32_t>(version))
 	{
 		return false;
@@ -187,6 +210,35 @@ void OutputDataSerializer::threadRun()
 
 	UnorderedIndexSet32 activeChannelIds;
 
+	// with chunked layout, all records are written into the current chunk instead of directly into the output stream
+
+	const bool chunkedLayout = chunkSize_ != 0;
+
+	VectorOutputStream chunkStream(chunkedLayout ? chunkSize_ + chunkSize_ / 4 : 0);
+	OutputBitstream chunkBitstream(chunkStream);
+
+	OutputBitstream& recordBitstream = chunkedLayout ? chunkBitstream : outputBitstream;
+
+	ThreadPool compressionPool;
+
+	if (chunkedLayout && compressionThreads_ != 0u)
+	{
+		compressionPool.setCapacity(compressionThreads_);
+	}
+
+	ThreadPool* threadPool = chunkedLayout && compressionThreads_ != 0u ? &compressionPool : nullptr;
+
+	// we keep twice as many chunks in flight as we have compression threads, so that the threads are busy while chunks are written
+
+	const uint64_t maximalPendingChunks = std::max(uint64_t(1), uint64_t(compressionThreads_) * uint64_t(2));
+
+	uint64_t nextDispatchIndex = 0ull;
+	uint64_t nextWriteIndex = 0ull;
+
+	CurrentChunkChannelMap currentChunkChannelMap;
+	ChannelChunkInformationMap channelChunkInformationMap;
+	ChunkInformations chunkInformations;
+
 	while (!shouldThreadStop())
 	{
 		TemporaryScopedLock temporaryScopedLock(lock_);
@@ -260,9 +312,9 @@ void OutputDataSerializer::threadRun()
 
 			const uint32_t channelValue = makeConfigurationChannelId(channelId);
 
-			if (!outputBitstream.write<uint32_t>(channelValue)
-				|| !outputBitstream.write<uint32_t>(uint32_t(payloadSize))
-				|| !outputBitstream.write(sampleStream.data(), payloadSize))
+			if (!recordBitstream.write<uint32_t>(channelValue)
+				|| !recordBitstream.write<uint32_t>(uint32_t(payloadSize))
+				|| !recordBitstream.write(sampleStream.data(), payloadSize))
 			{
 				succeeded_ = false;
 				break;
@@ -285,22 +337,89 @@ void OutputDataSerializer::threadRun()
 			break;
 		}
 
-		if (!outputBitstream.write<uint32_t>(uint32_t(channelId))
-				|| !outputBitstream.write<uint32_t>(uint32_t(payloadSize))
-				|| !outputBitstream.write(sampleStream.data(), payloadSize))
+		if (!recordBitstream.write<uint32_t>(uint32_t(channelId))
+				|| !recordBitstream.write<uint32_t>(uint32_t(payloadSize))
+				|| !recordBitstream.write(sampleStream.data(), payloadSize))
 		{
 			succeeded_ = false;
 			break;
 		}
 
 		sampleStream.clear();
+
+		if (chunkedLayout)
+		{
+			ChannelChunkInformation& channelChunkInformation = currentChunkChannelMap[channelId];
+
+			channelChunkInformation.firstPlaybackTimestamp_ = std::min(channelChunkInformation.firstPlaybackTimestamp_, sample->playbackTimestamp());
+			channelChunkInformation.lastPlaybackTimestamp_ = std::max(channelChunkInformation.lastPlaybackTimestamp_, sample->playbackTimestamp());
+
+			if (chunkStream.size() >= chunkSize_)
+			{
+				if (!writeCompressedChunks(outputBitstream, nextDispatchIndex, nextWriteIndex, chunkInformations, maximalPendingChunks - 1ull)
+						|| !dispatchChunk(chunkStream, nextDispatchIndex++, currentChunkChannelMap, channelChunkInformationMap, threadPool))
+				{
+					succeeded_ = false;
+					break;
+				}
+			}
+		}
 	}
 
-	// let's write a final invalid channel id to indicate the end of the stream
+	if (chunkedLayout)
+	{
+		// the remaining records are written as last chunk, followed by an empty chunk header indicating the end of the chunks, and the index
+
+		if (chunkStream.size() != 0 && !dispatchChunk(chunkStream, nextDispatchIndex++, currentChunkChannelMap, channelChunkInformationMap, threadPool))
+		{
+			succeeded_ = false;
+		}
+
+		if (!writeCompressedChunks(outputBitstream, nextDispatchIndex, nextWriteIndex, chunkInformations, 0ull))
+		{
+			succeeded_ = false;
+		}
+
+		Channels channels;
+		channels.reserve(activeChannelIds.size());
+
+		TemporaryScopedLock temporaryScopedLock(lock_);
+
+			for (const ChannelConfigurationMap::value_type& channelConfigurationPair : channelConfigurationMap_)
+			{
+				if (activeChannelIds.contains(channelConfigurationPair.second))
+				{
+					channels.emplace_back(channelConfigurationPair.first, channelConfigurationPair.second);
+				}
+			}
+
+		temporaryScopedLock.release();
+
+		if (!outputBitstream.write<uint32_t>(0u) || !outputBitstream.write<uint32_t>(0u)
+				|| !writeChunkIndex(outputBitstream, chunkInformations, channels, channelChunkInformationMap))
+		{
+			succeeded_ = false;
+		}
+
+		// in case of an error, chunks may still be compressed
+
+		while (!compressionPool.isEmpty())
+		{
+			sleep(1u);
+		}
+
+		const ScopedLock scopedLock(compressedChunkLock_);
 
-	if (!outputBitstream.write<uint32_t>(invalidChannelId()))
+		compressedChunkMap_.clear();
+	}
+	else
 	{
-		succeeded_ = false;
+		// let's write a final invalid channel id to indicate the end of the stream
+
+		if (!outputBitstream.write<uint32_t>(invalidChannelId()))
+		{
+			succeeded_ = false;
+		}
 	}
 
 	const ScopedLock scopedLock(lock_);
@@ -309,6 +428,114 @@ void OutputDataSerializer::threadRun()
 	state_ = S_STOPPED;
 }
 
+bool OutputDataSerializer::dispatchChunk(VectorOutputStream& chunkStream, const uint64_t chunkIndex, CurrentChunkChannelMap& currentChunkChannelMap, ChannelChunkInformationMap& channelChunkInformationMap, ThreadPool* threadPool)
+{
+	ocean_assert(chunkStream.size() != 0);
+
+	if (!NumericT<uint32_t>::isInsideValueRange(chunkIndex))
+	{
+		return false;
+	}
+
+	for (CurrentChunkChannelMap::value_type& currentChunkChannelPair : currentChunkChannelMap)
+	{
+		ChannelChunkInformation channelChunkInformation = currentChunkChannelPair.second;
+		channelChunkInformation.chunkIndex_ = uint32_t(chunkIndex);
+
+		channelChunkInformationMap[currentChunkChannelPair.first].emplace_back(channelChunkInformation);
+	}
+
+	currentChunkChannelMap.clear();
+
+	const uint8_t* const chunkData = (const uint8_t*)(chunkStream.data());
+	Compression::Buffer chunk(chunkData, chunkData + chunkStream.size());
+
+	chunkStream.clear();
+
+	if (threadPool != nullptr)
+	{
+		return threadPool->invoke(std::bind(&OutputDataSerializer::compressChunk, this, chunkIndex, std::move(chunk)));
+	}
+
+	compressChunk(chunkIndex, chunk);
+
+	return true;
+}
+
+bool OutputDataSerializer::writeCompressedChunks(OutputBitstream& outputBitstream, const uint64_t nextDispatchIndex, uint64_t& nextWriteIndex, ChunkInformations& chunkInformations, const uint64_t maximalPendingChunks)
+{
+	ocean_assert(nextWriteIndex <= nextDispatchIndex);
+
+	while (nextWriteIndex < nextDispatchIndex)
+	{
+		CompressedChunk compressedChunk;
+
+		TemporaryScopedLock scopedLock(compressedChunkLock_);
+
+			const CompressedChunkMap::iterator iCompressedChunk = compressedChunkMap_.find(nextWriteIndex);
+
+			if (iCompressedChunk == compressedChunkMap_.end())
+			{
+				scopedLock.release();
+
+				// the next chunk is still being compressed
+
+				if (nextDispatchIndex - nextWriteIndex <= maximalPendingChunks)
+				{
+					break;
+				}
+
+				sleep(1u);
+				continue;
+			}
+
+			compressedChunk = std::move(iCompressedChunk->second);
+			compressedChunkMap_.erase(iCompressedChunk);
+
+		scopedLock.release();
+
+		++nextWriteIndex;
+
+		if (compressedChunk.second.empty() || !NumericT<uint32_t>::isInsideValueRange(compressedChunk.second.size()))
+		{
+			return false;
+		}
+
+		ChunkInformation chunkInformation;
+		chunkInformation.offset_ = outputBitstream.size();
+		chunkInformation.compressedSize_ = uint32_t(compressedChunk.second.size());
+		chunkInformation.uncompressedSize_ = compressedChunk.first;
+
+		if (!outputBitstream.write<uint32_t>(chunkInformation.compressedSize_)
+				|| !outputBitstream.write<uint32_t>(chunkInformation.uncompressedSize_)
+				|| !outputBitstream.write(compressedChunk.second.data(), compressedChunk.second.size()))
+		{
+			return false;
+		}
+
+		chunkInformations.emplace_back(chunkInformation);
+	}
+
+	return true;
+}
+
+void OutputDataSerializer::compressChunk(const uint64_t chunkIndex, const Compression::Buffer& chunk)
+{
+	ocean_assert(!chunk.empty());
+
+	CompressedChunk compressedChunk(uint32_t(chunk.size()), Compression::Buffer());
+
+	if (!Compression::gzipCompress(chunk.data(), chunk.size(), compressedChunk.second, Compression::CL_FASTEST))
+	{
+		compressedChunk.second.clear();
+	}
+
+	const ScopedLock scopedLock(compressedChunkLock_);
+
+	ocean_assert(!compressedChunkMap_.contains(chunkIndex));
+	compressedChunkMap_.emplace(chunkIndex, std::move(compressedChunk));
+}
+
 bool FileOutputDataSerializer::setFilename(const std::string& filename)
 {
 	if (filename.empty())
@@ -10,6 +10,11 @@
 
 #include "ocean/io/serialization/Serialization.h"
 #include "ocean/io/serialization/DataSerializer.h"
+#include "ocean/io/serialization/VectorOutputStream.h"
+
+#include "ocean/base/ThreadPool.h"
+
+#include "ocean/io/Compression.h"
 
 namespace Ocean
 {
@@ -25,7 +30,9 @@ namespace Serialization
  * The output data serializer serializes data samples to a stream (e.g., file or network) for recording purposes.<br>
  * Before adding samples, channels must be created using addChannel() which assigns a unique channel id for each distinct sample type, name, and content type combination.<br>
  * Samples are added via addSample() and are written to the stream asynchronously by a background thread, allowing the caller to continue without blocking.<br>
- * When stopping, all queued samples are written before the serializer terminates, ensuring no data is lost.
+ * When stopping, all queued samples are written before the serializer terminates, ensuring no data is lost.<br>
+ * Optionally, the serializer can write a chunked layout (see setChunkedLayout()): the records are grouped into chunks which are compressed independently on several threads,
+ * and a trailing index stores the location of each chunk and the time range of each channel within each chunk. The index allows readers to seek and to skip chunks of channels they are not interested in.
  * @ingroup ioserialization
  */
 class OCEAN_IO_SERIALIZATION_EXPORT OutputDataSerializer : public DataSerializer
@@ -63,6 +70,15 @@ class OCEAN_IO_SERIALIZATION_EXPORT OutputDataSerializer : public DataSerializer
 		/// Definition of a FIFO queue holding sample pairs.
 		using SampleQueue = std::queue<SamplePair>;
 
+		/// Definition of a pair combining the uncompressed size of a chunk with the compressed chunk, an empty compressed chunk indicates a compression failure.
+		using CompressedChunk = std::pair<uint32_t, Compression::Buffer>;
+
+		/// Definition of a map mapping chunk indices to compressed chunks.
+		using CompressedChunkMap = std::unordered_map<uint64_t, CompressedChunk>;
+
+		/// Definition of a map mapping channel ids to the time ranges of the channels within the current chunk.
+		using CurrentChunkChannelMap = std::unordered_map<ChannelId, ChannelChunkInformation>;
+
 	public:
 
 		/**
@@ -83,6 +99,17 @@ class OCEAN_IO_SERIALIZATION_EXPORT OutputDataSerializer : public DataSerializer
 		 */
 		bool addSample(const DataSerializer::ChannelId channelId, UniqueDataSample&& sample);
 
+		/**
+		 * Enables or disables the chunked layout of the output stream.
+		 * With chunked layout, the records are collected in chunks of the given size, each chunk is gzip compressed independently and a trailing index is written when the serializer stops.<br>
+		 * Streams with chunked layout can be randomly accessed by InputDataSerializer::seek() and InputDataSerializer::setSubscribedChannels().<br>
+		 * This function must be called before the serializer is started.
+		 * @param chunkSize The minimal size of the uncompressed records in each chunk, in bytes, 0 to write the plain (uncompressed and sequential) layout, with range [0, 2^31)
+		 * @param compressionThreads The number of threads compressing chunks concurrently, 0 to compress the chunks with the serializer's own thread, with range [0, infinity)
+		 * @return True, if succeeded
+		 */
+		bool setChunkedLayout(const size_t chunkSize, const unsigned int compressionThreads = 2u);
+
 		/**
 		 * Starts the serializer.
 		 * @return True, if succeeded
@@ -135,11 +162,53 @@ class OCEAN_IO_SERIALIZATION_EXPORT OutputDataSerializer : public DataSerializer
 		 */
 		void threadRun() override;
 
+		/**
+		 * Hands the records of the current chunk over for compression and registers the channels' time ranges within the chunk.
+		 * @param chunkStream The stream holding the records of the current chunk, will be cleared
+		 * @param chunkIndex The index of the chunk, with range [0, infinity)
+		 * @param currentChunkChannelMap The time ranges of the channels within the current chunk, will be cleared
+		 * @param channelChunkInformationMap The time ranges of all channels within all chunks, the ranges of the current chunk will be added
+		 * @param threadPool The thread pool compressing the chunk, nullptr to compress the chunk with the calling thread
+		 * @return True, if succeeded
+		 */
+		bool dispatchChunk(VectorOutputStream& chunkStream, const uint64_t chunkIndex, CurrentChunkChannelMap& currentChunkChannelMap, ChannelChunkInformationMap& channelChunkInformationMap, ThreadPool* threadPool);
+
+		/**
+		 * Writes compressed chunks in the order in which they have been dispatched.
+		 * All chunks which have been compressed already are written, the function waits for further chunks while more than 'maximalPendingChunks' chunks are pending.
+		 * @param outputBitstream The output bitstream to which the chunks will be written
+		 * @param nextDispatchIndex The index of the next chunk which will be dispatched, with range [0, infinity)
+		 * @param nextWriteIndex The index of the next chunk to be written, will be increased for each written chunk, with range [0, nextDispatchIndex]
+		 * @param chunkInformations The information of all written chunks, the information of each written chunk will be added
+		 * @param maximalPendingChunks The maximal number of dispatched chunks which may still be pending when the function returns, 0 to wait until all dispatched chunks have been written
+		 * @return True, if succeeded
+		 */
+		bool writeCompressedChunks(OutputBitstream& outputBitstream, const uint64_t nextDispatchIndex, uint64_t& nextWriteIndex, ChunkInformations& chunkInformations, const uint64_t maximalPendingChunks);
+
+		/**
+		 * Compresses one chunk, this function is executed by the compression threads.
+		 * @param chunkIndex The index of the chunk, with range [0, infinity)
+		 * @param chunk The uncompressed records of the chunk, must not be empty
+		 */
+		void compressChunk(const uint64_t chunkIndex, const Compression::Buffer& chunk);
+
 	protected:
 
 		/// The output stream.
 		UniqueStream stream_;
 
+		/// The minimal size of the uncompressed records in each chunk, in bytes, 0 to write the plain layout.
+		size_t chunkSize_ = 0;
+
+		/// The number of threads compressing chunks concurrently, 0 to compress chunks with the serializer's thread.
+		unsigned int compressionThreads_ = 0u;
+
+		/// The compressed chunks which have not yet been written.
+		CompressedChunkMap compressedChunkMap_;
+
+		/// The lock for the compressed chunks.
+		Lock compressedChunkLock_;
+
 		/// The next channel id to be assigned.
 		ChannelId nextChannelId_ = ChannelId(0);
 
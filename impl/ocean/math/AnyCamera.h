@@ -326,6 +326,19 @@ class AnyCameraT : public CameraT<T>
 		 */
 		virtual void projectToImageIF(const HomogenousMatrixT4<T>& flippedCamera_T_world, const VectorT3<T>* objectPoints, const size_t size, VectorT2<T>* imagePoints) const = 0;
 
+		/**
+		 * Projects several 3D object points into the camera frame at once and determines the 2x3 Jacobian matrices of the projections in the same pass.
+		 * The Jacobian matrices are determined for the object points defined in the flipped camera coordinate system, see pointJacobian2nx3IF().<br>
+		 * Using this function is faster than projecting the object points and determining the Jacobians individually, as the object points are transformed once only.
+		 * @param flippedCamera_T_world The inverted and flipped camera pose, the default flipped camera is looking into the positive z-space with y-axis down, transforming world to flipped camera, must be valid
+		 * @param objectPoints The 3D object points to project, defined in world, must be valid
+		 * @param size The number of object points, with range [1, infinity)
+		 * @param imagePoints The resulting 2D image points, must be valid
+		 * @param pointJacobians The resulting 2n x 3 Jacobian matrix, with 2 * size * 3 elements, must be valid
+		 * @see pointJacobian2nx3IF().
+		 */
+		virtual void projectToImageIF(const HomogenousMatrixT4<T>& flippedCamera_T_world, const VectorT3<T>* objectPoints, const size_t size, VectorT2<T>* imagePoints, T* pointJacobians) const = 0;
+
 		/**
 		 * Returns a vector starting at the camera's center and intersecting a given 2D point in the image.
 		 * The vector is determined for a default camera looking into the negative z-space with y-axis up.
@@ -846,6 +859,16 @@ class AnyCameraWrappingT final :
 		 */
 		void projectToImageIF(const HomogenousMatrixT4<T>& flippedCamera_T_world, const VectorT3<T>* objectPoints, const size_t size, VectorT2<T>* imagePoints) const override;
 
+		/**
+		 * Projects several 3D object points into the camera frame at once and determines the 2x3 Jacobian matrices of the projections in the same pass.
+		 * @param flippedCamera_T_world The inverted and flipped camera pose, the default flipped camera is looking into the positive z-space with y-axis down, transforming world to flipped camera, must be valid
+		 * @param objectPoints The 3D object points to project, defined in world, must be valid
+		 * @param size The number of object points, with range [1, infinity)
+		 * @param imagePoints The resulting 2D image points, must be valid
+		 * @param pointJacobians The resulting 2n x 3 Jacobian matrix, with 2 * size * 3 elements, must be valid
+		 */
+		void projectToImageIF(const HomogenousMatrixT4<T>& flippedCamera_T_world, const VectorT3<T>* objectPoints, const size_t size, VectorT2<T>* imagePoints, T* pointJacobians) const override;
+
 		/**
 		 * Returns a vector starting at the camera's center and intersecting a given 2D point in the image.
 		 * The vector is determined for the default camera looking into the negative z-space with y-axis up.
@@ -1065,6 +1088,15 @@ class CameraWrapperT : public TCameraWrapperBase
 		 * @see AnyCameraT::pointJacobian2nx3IF().
 		 */
 		inline void pointJacobian2nx3IF(const VectorT3<T>* flippedCameraObjectPoints, const size_t numberObjectPoints, T* jacobians) const;
+
+		/**
+		 * Projects several 3D object points into the camera frame at once and determines the 2x3 Jacobian matrices of the projections in the same pass.
+		 * @see AnyCameraT::projectToImageIF().
+		 */
+		inline void projectToImageIF(const HomogenousMatrixT4<T>& flippedCamera_T_world, const VectorT3<T>* objectPoints, const size_t size, VectorT2<T>* imagePoints, T* pointJacobians) const;
+
+		// the remaining projection functions are provided by the base class
+		using TCameraWrapperBase::projectToImageIF;
 };
 
 /**
@@ -2282,6 +2314,12 @@ void AnyCameraWrappingT<T, TCameraWrapper>::projectToImageIF(const HomogenousMat
 	return TCameraWrapper::projectToImageIF(flippedCamera_T_world, objectPoints, size, imagePoints);
 }
 
+template <typename T, typename TCameraWrapper>
+void AnyCameraWrappingT<T, TCameraWrapper>::projectToImageIF(const HomogenousMatrixT4<T>& flippedCamera_T_world, const VectorT3<T>* objectPoints, const size_t size, VectorT2<T>* imagePoints, T* pointJacobians) const
+{
+	return TCameraWrapper::projectToImageIF(flippedCamera_T_world, objectPoints, size, imagePoints, pointJacobians);
+}
+
 template <typename T, typename TCameraWrapper>
 VectorT3<T> AnyCameraWrappingT<T, TCameraWrapper>::vector(const VectorT2<T>& distortedImagePoint, const bool makeUnitVector) const
 {
@@ -2535,6 +2573,24 @@ inline void CameraWrapperT<T, TCameraWrapperBase>::pointJacobian2nx3IF(const Vec
 	}
 }
 
+template <typename T, typename TCameraWrapperBase>
+inline void CameraWrapperT<T, TCameraWrapperBase>::projectToImageIF(const HomogenousMatrixT4<T>& flippedCamera_T_world, const VectorT3<T>* objectPoints, const size_t size, VectorT2<T>* imagePoints, T* pointJacobians) const
+{
+	ocean_assert(flippedCamera_T_world.isValid());
+	ocean_assert(objectPoints != nullptr && size >= 1);
+	ocean_assert(imagePoints != nullptr && pointJacobians != nullptr);
+
+	for (size_t n = 0; n < size; ++n)
+	{
+		const VectorT3<T> flippedCameraObjectPoint(flippedCamera_T_world * objectPoints[n]);
+
+		imagePoints[n] = TCameraWrapperBase::projectToImageIF(flippedCameraObjectPoint);
+		TCameraWrapperBase::pointJacobian2x3IF(flippedCameraObjectPoint, pointJacobians + 0, pointJacobians + 3);
+
+		pointJacobians += 6;
+	}
+}
+
 template <typename T>
 CameraWrapperBasePinholeT<T>::CameraWrapperBasePinholeT(ActualCamera&& actualCamera) :
 	actualCamera_(std::move(actualCamera))
@@ -2606,7 +2662,10 @@ inline T CameraWrapperBasePinholeT<T>::inverseFocalLengthY() const
 template <typename T>
 inline VectorT2<T> CameraWrapperBasePinholeT<T>::projectToImageIF(const VectorT3<T>& objectPoint) const
 {
-	return VectorT2<T>(actualCamera_.template projectToImageIF<true>(HomogenousMatrixT4<T>(true), objectPoint, true));
+	ocean_assert(NumericT<T>::isNotEqualEps(objectPoint.z()));
+	const T invZ = T(1) / objectPoint.z();
+
+	return VectorT2<T>(actualCamera_.template projectToImageIF<true>(VectorT2<T>(objectPoint.x() * invZ, objectPoint.y() * invZ), true));
 }
 
 template <typename T>
@@ -2621,10 +2680,7 @@ inline void CameraWrapperBasePinholeT<T>::projectToImageIF(const VectorT3<T>* ob
 	ocean_assert(size == 0 || objectPoints != nullptr);
 	ocean_assert(size == 0 || imagePoints != nullptr);
 
-	for (size_t n = 0; n < size; ++n)
-	{
-		imagePoints[n] = projectToImageIF(objectPoints[n]);
-	}
+	actualCamera_.template projectToImageIF<true>(HomogenousMatrixT4<T>(true), objectPoints, size, true, imagePoints);
 }
 
 template <typename T>
@@ -2633,10 +2689,7 @@ inline void CameraWrapperBasePinholeT<T>::projectToImageIF(const HomogenousMatri
 	ocean_assert(size == 0 || objectPoints != nullptr);
 	ocean_assert(size == 0 || imagePoints != nullptr);
 
-	for (size_t n = 0; n < size; ++n)
-	{
-		imagePoints[n] = projectToImageIF(flippedCamera_T_world, objectPoints[n]);
-	}
+	actualCamera_.template projectToImageIF<true>(flippedCamera_T_world, objectPoints, size, true, imagePoints);
 }
 
 template <typename T>
@@ -0,0 +1,809 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#ifndef META_OCEAN_MATH_AUTOMATIC_DIFFERENTIATION_VECTOR_H
+#define META_OCEAN_MATH_AUTOMATIC_DIFFERENTIATION_VECTOR_H
+
+#include "ocean/math/Math.h"
+#include "ocean/math/Numeric.h"
+
+namespace Ocean
+{
+
+// Forward declaration.
+template <typename T, size_t tSize, typename TNumeric> class AutomaticDifferentiationVectorT;
+
+/**
+ * Definition of a differentiation object with several derivatives using the data type of Scalar as parameter.
+ * @tparam tSize The number of derivatives (the number of variables), with range [1, infinity)
+ * @see AutomaticDifferentiationVectorT
+ * @ingroup math
+ */
+template <size_t tSize>
+using AutomaticDifferentiationVector = AutomaticDifferentiationVectorT<Scalar, tSize, Numeric>;
+
+/**
+ * Definition of a differentiation object with several derivatives using double as data type.
+ * @tparam tSize The number of derivatives (the number of variables), with range [1, infinity)
+ * @see AutomaticDifferentiationVectorT
+ * @ingroup math
+ */
+template <size_t tSize>
+using AutomaticDifferentiationVectorD = AutomaticDifferentiationVectorT<double, tSize, NumericD>;
+
+/**
+ * Definition of a differentiation object with several derivatives using float as data type.
+ * @tparam tSize The number of derivatives (the number of variables), with range [1, infinity)
+ * @see AutomaticDifferentiationVectorT
+ * @ingroup math
+ */
+template <size_t tSize>
+using AutomaticDifferentiationVectorF = AutomaticDifferentiationVectorT<float, tSize, NumericF>;
+
+/**
+ * This class implements an automatic differentiation functionality for functions with several variables.
+ * In contrast to AutomaticDifferentiationT, each object holds the value of a function and all partial derivatives of the function at this location, using the forward mode.<br>
+ * Therefore, the entire gradient (or one row of a Jacobian matrix) is determined with one evaluation of the function, instead of one evaluation for each variable.<br>
+ * The derivatives are stored in an aligned array with compile-time size, all operations are applied to the entire array so that the compiler can keep the derivatives in SIMD registers.<br>
+ * The following code snippet shows how the 1x2 Jacobian matrix for f(x, y) = x^2 + 3y + 5 can be determined:
+ * @code
+ * // the Jacobian will have the following layout:
+ * // | df/dx   df/dy |
+ *
+ * const AutomaticDifferentiationVector<2> x(3, 0); // any value for x, x is the first variable
+ * const AutomaticDifferentiationVector<2> y(7, 1); // any value for y, y is the second variable
+ *
+ * const AutomaticDifferentiationVector<2> d = x * x + y * 3 + 5;
+ *
+ * const Scalar dfdx = d.derivative(0);
+ * const Scalar dfdy = d.derivative(1);
+ * @endcode
+ * @tparam T The data type of the scalar
+ * @tparam tSize The number of derivatives (the number of variables), with range [1, infinity)
+ * @tparam TNumeric The numeric class providing access to standard mathematical functions like sin, cos, sqrt, etc.
+ * @see AutomaticDifferentiationT.
+ * @ingroup math
+ */
+template <typename T, size_t tSize, typename TNumeric = NumericT<T>>
+class AutomaticDifferentiationVectorT
+{
+	static_assert(tSize >= 1, "Invalid number of derivatives!");
+
+	template <typename T1, size_t tSize1, typename TNumeric1, typename T2> friend AutomaticDifferentiationVectorT<T1, tSize1, TNumeric1> operator+(const T2& left, const AutomaticDifferentiationVectorT<T1, tSize1, TNumeric1>& right);
+	template <typename T1, size_t tSize1, typename TNumeric1, typename T2> friend AutomaticDifferentiationVectorT<T1, tSize1, TNumeric1> operator-(const T2& left, const AutomaticDifferentiationVectorT<T1, tSize1, TNumeric1>& right);
+	template <typename T1, size_t tSize1, typename TNumeric1, typename T2> friend AutomaticDifferentiationVectorT<T1, tSize1, TNumeric1> operator*(const T2& left, const AutomaticDifferentiationVectorT<T1, tSize1, TNumeric1>& right);
+	template <typename T1, size_t tSize1, typename TNumeric1, typename T2> friend AutomaticDifferentiationVectorT<T1, tSize1, TNumeric1> operator/(const T2& left, const AutomaticDifferentiationVectorT<T1, tSize1, TNumeric1>& right);
+
+	public:
+
+		/**
+		 * The number of derivatives of this object.
+		 */
+		static constexpr size_t size = tSize;
+
+	public:
+
+		/**
+		 * Creates a new differentiation object with value zero and zero derivatives.
+		 */
+		AutomaticDifferentiationVectorT() = default;
+
+		/**
+		 * Creates a new differentiation object for a constant value.
+		 * All derivatives of the constant will be set to 0.
+		 * @param value The constant value defining the object
+		 */
+		explicit inline AutomaticDifferentiationVectorT(const T& value);
+
+		/**
+		 * Creates a new differentiation object for a variable.
+		 * The derivative with respect to the variable itself will be set to 1, all other derivatives will be set to 0.
+		 * @param value The value of the variable
+		 * @param variableIndex The index of the variable, with range [0, tSize - 1]
+		 */
+		inline AutomaticDifferentiationVectorT(const T& value, const size_t variableIndex);
+
+		/**
+		 * Creates a new differentiation object by a given scalar and it's known derivatives of the function at the specified location 'value'.
+		 * @param value The scalar value defining the object
+		 * @param derivatives The tSize derivatives of the function at location 'value'
+		 */
+		inline AutomaticDifferentiationVectorT(const T& value, const T (&derivatives)[tSize]);
+
+		/**
+		 * Returns one derivative of this object.
+		 * @param index The index of the variable for which the derivative will be returned, with range [0, tSize - 1]
+		 * @return The object's derivative
+		 */
+		inline const T& derivative(const size_t index) const;
+
+		/**
+		 * Returns all derivatives of this object.
+		 * @return The object's tSize derivatives
+		 */
+		inline const T* derivatives() const;
+
+		/**
+		 * Returns the value of this object.
+		 * @return The object's value
+		 */
+		inline const T& value() const;
+
+		/**
+		 * Returns one derivative of this object.
+		 * @param index The index of the variable for which the derivative will be returned, with range [0, tSize - 1]
+		 * @return The object's derivative
+		 */
+		inline const T& operator[](const size_t index) const;
+
+		/**
+		 * Adds a scalar value to this differentiation object.
+		 * @param right The scalar value
+		 * @return The differentiation object with added scalar
+		 */
+		inline AutomaticDifferentiationVectorT<T, tSize, TNumeric> operator+(const T& right) const;
+
+		/**
+		 * Adds a scalar value to this differentiation object.
+		 * @param right The scalar value
+		 * @return The reference to this object
+		 */
+		inline AutomaticDifferentiationVectorT<T, tSize, TNumeric>& operator+=(const T& right);
+
+		/**
+		 * Adds two differentiation objects and determines the sum derivatives.
+		 * @param right The right differentiation object
+		 * @return The sum derivatives
+		 */
+		inline AutomaticDifferentiationVectorT<T, tSize, TNumeric> operator+(const AutomaticDifferentiationVectorT<T, tSize, TNumeric>& right) const;
+
+		/**
+		 * Adds two differentiation objects and determines the sum derivatives.
+		 * @param right The right differentiation object
+		 * @return The reference to this object
+		 */
+		inline AutomaticDifferentiationVectorT<T, tSize, TNumeric>& operator+=(const AutomaticDifferentiationVectorT<T, tSize, TNumeric>& right);
+
+		/**
+		 * Subtracts a scalar value from this differentiation object.
+		 * @param right The scalar value
+		 * @return The differentiation object with subtracted scalar
+		 */
+		inline AutomaticDifferentiationVectorT<T, tSize, TNumeric> operator-(const T& right) const;
+
+		/**
+		 * Subtracts a scalar value from this differentiation object.
+		 * @param right The scalar value
+		 * @return The reference to this object
+		 */
+		inline AutomaticDifferentiationVectorT<T, tSize, TNumeric>& operator-=(const T& right);
+
+		/**
+		 * Subtracts two differentiation objects and determines the resulting derivatives.
+		 * @param right The right differentiation object
+		 * @return The resulting derivatives
+		 */
+		inline AutomaticDifferentiationVectorT<T, tSize, TNumeric> operator-(const AutomaticDifferentiationVectorT<T, tSize, TNumeric>& right) const;
+
+		/**
+		 * Unary negation operator returns the negative of this differentiation object.
+		 * @return The negative differentiation object
+		 */
+		inline AutomaticDifferentiationVectorT<T, tSize, TNumeric> operator-() const;
+
+		/**
+		 * Subtracts two differentiation objects and determines the resulting derivatives.
+		 * @param right The right differentiation object
+		 * @return The reference to this object
+		 */
+		inline AutomaticDifferentiationVectorT<T, tSize, TNumeric>& operator-=(const AutomaticDifferentiationVectorT<T, tSize, TNumeric>& right);
+
+		/**
+		 * Multiplies two differentiation objects and determines the product derivatives.
+		 * @param right The right differentiation object
+		 * @return The product derivatives
+		 */
+		inline AutomaticDifferentiationVectorT<T, tSize, TNumeric> operator*(const AutomaticDifferentiationVectorT<T, tSize, TNumeric>& right) const;
+
+		/**
+		 * Multiplies two differentiation objects and determines the product derivatives.
+		 * @param right The right differentiation object
+		 * @return The reference to this object
+		 */
+		inline AutomaticDifferentiationVectorT<T, tSize, TNumeric>& operator*=(const AutomaticDifferentiationVectorT<T, tSize, TNumeric>& right);
+
+		/**
+		 * Multiplies this differentiation object with a scalar.
+		 * @param right The scalar value
+		 * @return The product derivatives
+		 */
+		inline AutomaticDifferentiationVectorT<T, tSize, TNumeric> operator*(const T& right) const;
+
+		/**
+		 * Multiplies this differentiation object with a scalar.
+		 * @param right The scalar value
+		 * @return The reference to this object
+		 */
+		inline AutomaticDifferentiationVectorT<T, tSize, TNumeric>& operator*=(const T& right);
+
+		/**
+		 * Divides two differentiation objects and determines the quotient derivatives.
+		 * @param right The right differentiation object
+		 * @return The quotient derivatives
+		 */
+		inline AutomaticDifferentiationVectorT<T, tSize, TNumeric> operator/(const AutomaticDifferentiationVectorT<T, tSize, TNumeric>& right) const;
+
+		/**
+		 * Divides two differentiation objects and determines the quotient derivatives.
+		 * @param right The right differentiation object
+		 * @return The reference to this object
+		 */
+		inline AutomaticDifferentiationVectorT<T, tSize, TNumeric>& operator/=(const AutomaticDifferentiationVectorT<T, tSize, TNumeric>& right);
+
+		/**
+		 * Divides this differentiation object by a scalar.
+		 * @param right The scalar value, must not be zero
+		 * @return The quotient derivatives
+		 */
+		inline AutomaticDifferentiationVectorT<T, tSize, TNumeric> operator/(const T& right) const;
+
+		/**
+		 * Divides this differentiation object by a scalar.
+		 * @param right The scalar value, must not be zero
+		 * @return The reference to this object
+		 */
+		inline AutomaticDifferentiationVectorT<T, tSize, TNumeric>& operator/=(const T& right);
+
+		/**
+		 * Determines the derivatives of the sine function.
+		 * @param value The value for which the derivatives will be determined, in radian
+		 * @return The resulting derivatives
+		 */
+		static inline AutomaticDifferentiationVectorT<T, tSize, TNumeric> sin(const AutomaticDifferentiationVectorT<T, tSize, TNumeric>& value);
+
+		/**
+		 * Determines the derivatives of the cosine function.
+		 * @param value The value for which the derivatives will be determined, in radian
+		 * @return The resulting derivatives
+		 */
+		static inline AutomaticDifferentiationVectorT<T, tSize, TNumeric> cos(const AutomaticDifferentiationVectorT<T, tSize, TNumeric>& value);
+
+		/**
+		 * Determines the derivatives of the tangent function.
+		 * @param value The value for which the derivatives will be determined, in radian
+		 * @return The resulting derivatives
+		 */
+		static inline AutomaticDifferentiationVectorT<T, tSize, TNumeric> tan(const AutomaticDifferentiationVectorT<T, tSize, TNumeric>& value);
+
+		/**
+		 * Determines the derivatives of the square root function.
+		 * @param value The value for which the derivatives will be determined, with range (0, infinity)
+		 * @return The resulting derivatives
+		 */
+		static inline AutomaticDifferentiationVectorT<T, tSize, TNumeric> sqrt(const AutomaticDifferentiationVectorT<T, tSize, TNumeric>& value);
+
+		/**
+		 * Determines the derivatives of the square function.
+		 * @param value The value for which the derivatives will be determined
+		 * @return The resulting derivatives
+		 */
+		static inline AutomaticDifferentiationVectorT<T, tSize, TNumeric> sqr(const AutomaticDifferentiationVectorT<T, tSize, TNumeric>& value);
+
+		/**
+		 * Determines the derivatives of the exponential function.
+		 * @param value The value for which the derivatives will be determined
+		 * @return The resulting derivatives
+		 */
+		static inline AutomaticDifferentiationVectorT<T, tSize, TNumeric> exp(const AutomaticDifferentiationVectorT<T, tSize, TNumeric>& value);
+
+		/**
+		 * Determines the derivatives of the natural logarithm.
+		 * @param value The value for which the derivatives will be determined, with range (0, infinity)
+		 * @return The resulting derivatives
+		 */
+		static inline AutomaticDifferentiationVectorT<T, tSize, TNumeric> log(const AutomaticDifferentiationVectorT<T, tSize, TNumeric>& value);
+
+		/**
+		 * Determines the derivatives of the logarithm to the base 2.
+		 * @param value The value for which the derivatives will be determined, with range (0, infinity)
+		 * @return The resulting derivatives
+		 */
+		static inline AutomaticDifferentiationVectorT<T, tSize, TNumeric> log2(const AutomaticDifferentiationVectorT<T, tSize, TNumeric>& value);
+
+		/**
+		 * Determines the derivatives of the logarithm to the base 10.
+		 * @param value The value for which the derivatives will be determined, with range (0, infinity)
+		 * @return The resulting derivatives
+		 */
+		static inline AutomaticDifferentiationVectorT<T, tSize, TNumeric> log10(const AutomaticDifferentiationVectorT<T, tSize, TNumeric>& value);
+
+		/**
+		 * Determines the derivatives of the power function.
+		 * @param x The value for which the derivatives will be determined, with range [0, infinity)
+		 * @param y The exponent
+		 * @return The resulting derivatives
+		 */
+		static inline AutomaticDifferentiationVectorT<T, tSize, TNumeric> pow(const AutomaticDifferentiationVectorT<T, tSize, TNumeric>& x, const T& y);
+
+		/**
+		 * Determines the derivatives of the absolute function.
+		 * @param value The value for which the derivatives will be determined
+		 * @return The resulting derivatives
+		 */
+		static inline AutomaticDifferentiationVectorT<T, tSize, TNumeric> abs(const AutomaticDifferentiationVectorT<T, tSize, TNumeric>& value);
+
+		/**
+		 * Determines the derivatives of the min function.
+		 * @param value The value for which the derivatives will be determined
+		 * @param second The second scalar value that will be used for minimum comparison
+		 * @return The resulting derivatives
+		 */
+		static inline AutomaticDifferentiationVectorT<T, tSize, TNumeric> min(const AutomaticDifferentiationVectorT<T, tSize, TNumeric>& value, const T& second);
+
+		/**
+		 * Determines the derivatives of the max function.
+		 * @param value The value for which the derivatives will be determined
+		 * @param second The second scalar value that will be used for maximum comparison
+		 * @return The resulting derivatives
+		 */
+		static inline AutomaticDifferentiationVectorT<T, tSize, TNumeric> max(const AutomaticDifferentiationVectorT<T, tSize, TNumeric>& value, const T& second);
+
+	protected:
+
+		/**
+		 * Creates a new differentiation object with given value while the derivatives are determined by a scaled derivative vector.
+		 * @param value The scalar value defining the object
+		 * @param factor The factor which is applied to the derivatives
+		 * @param derivatives The tSize derivatives to be scaled, must be valid
+		 */
+		inline AutomaticDifferentiationVectorT(const T& value, const T& factor, const T* derivatives);
+
+		/**
+		 * Creates a new differentiation object with given value while the derivatives are determined by a linear combination of two derivative vectors.
+		 * @param value The scalar value defining the object
+		 * @param firstFactor The factor which is applied to the first derivatives
+		 * @param firstDerivatives The first tSize derivatives, must be valid
+		 * @param secondFactor The factor which is applied to the second derivatives
+		 * @param secondDerivatives The second tSize derivatives, must be valid
+		 */
+		inline AutomaticDifferentiationVectorT(const T& value, const T& firstFactor, const T* firstDerivatives, const T& secondFactor, const T* secondDerivatives);
+
+	protected:
+
+		/// The scalar value of this object.
+		T value_ = T(0);
+
+		/// The derivatives of this object, one for each variable.
+		alignas(16) T derivatives_[tSize] = {};
+};
+
+template <typename T, size_t tSize, typename TNumeric>
+inline AutomaticDifferentiationVectorT<T, tSize, TNumeric>::AutomaticDifferentiationVectorT(const T& value) :
+	value_(value)
+{
+	// c' = 0
+}
+
+template <typename T, size_t tSize, typename TNumeric>
+inline AutomaticDifferentiationVectorT<T, tSize, TNumeric>::AutomaticDifferentiationVectorT(const T& value, const size_t variableIndex) :
+	value_(value)
+{
+	ocean_assert(variableIndex < tSize);
+
+	// dx / dx = 1
+	derivatives_[variableIndex] = T(1);
+}
+
+template <typename T, size_t tSize, typename TNumeric>
+inline AutomaticDifferentiationVectorT<T, tSize, TNumeric>::AutomaticDifferentiationVectorT(const T& value, const T (&derivatives)[tSize]) :
+	value_(value)
+{
+	for (size_t n = 0; n < tSize; ++n)
+	{
+		derivatives_[n] = derivatives[n];
+	}
+}
+
+template <typename T, size_t tSize, typename TNumeric>
+inline AutomaticDifferentiationVectorT<T, tSize, TNumeric>::AutomaticDifferentiationVectorT(const T& value, const T& factor, const T* derivatives) :
+	value_(value)
+{
+	for (size_t n = 0; n < tSize; ++n)
+	{
+		derivatives_[n] = factor * derivatives[n];
+	}
+}
+
+template <typename T, size_t tSize, typename TNumeric>
+inline AutomaticDifferentiationVectorT<T, tSize, TNumeric>::AutomaticDifferentiationVectorT(const T& value, const T& firstFactor, const T* firstDerivatives, const T& secondFactor, const T* secondDerivatives) :
+	value_(value)
+{
+	for (size_t n = 0; n < tSize; ++n)
+	{
+		derivatives_[n] = firstFactor * firstDerivatives[n] + secondFactor * secondDerivatives[n];
+	}
+}
+
+template <typename T, size_t tSize, typename TNumeric>
+inline const T& AutomaticDifferentiationVectorT<T, tSize, TNumeric>::derivative(const size_t index) const
+{
+	ocean_assert(index < tSize);
+
+	return derivatives_[index];
+}
+
+template <typename T, size_t tSize, typename TNumeric>
+inline const T* AutomaticDifferentiationVectorT<T, tSize, TNumeric>::derivatives() const
+{
+	return derivatives_;
+}
+
+template <typename T, size_t tSize, typename TNumeric>
+inline const T& AutomaticDifferentiationVectorT<T, tSize, TNumeric>::value() const
+{
+	return value_;
+}
+
+template <typename T, size_t tSize, typename TNumeric>
+inline const T& AutomaticDifferentiationVectorT<T, tSize, TNumeric>::operator[](const size_t index) const
+{
+	ocean_assert(index < tSize);
+
+	return derivatives_[index];
+}
+
+template <typename T, size_t tSize, typename TNumeric>
+inline AutomaticDifferentiationVectorT<T, tSize, TNumeric> AutomaticDifferentiationVectorT<T, tSize, TNumeric>::operator+(const T& right) const
+{
+	// f(x) = x + c
+	// f'(x) = x'
+
+	return AutomaticDifferentiationVectorT<T, tSize, TNumeric>(value_ + right, derivatives_);
+}
+
+template <typename T, size_t tSize, typename TNumeric>
+inline AutomaticDifferentiationVectorT<T, tSize, TNumeric>& AutomaticDifferentiationVectorT<T, tSize, TNumeric>::operator+=(const T& right)
+{
+	value_ += right;
+	return *this;
+}
+
+template <typename T1, size_t tSize1, typename TNumeric1, typename T2>
+inline AutomaticDifferentiationVectorT<T1, tSize1, TNumeric1> operator+(const T2& left, const AutomaticDifferentiationVectorT<T1, tSize1, TNumeric1>& right)
+{
+	// f(x) = c + x
+	// f'(x) = x'
+
+	return AutomaticDifferentiationVectorT<T1, tSize1, TNumeric1>(T1(left) + right.value_, right.derivatives_);
+}
+
+template <typename T, size_t tSize, typename TNumeric>
+inline AutomaticDifferentiationVectorT<T, tSize, TNumeric> AutomaticDifferentiationVectorT<T, tSize, TNumeric>::operator+(const AutomaticDifferentiationVectorT<T, tSize, TNumeric>& right) const
+{
+	// (u + v)' = u' + v'
+
+	return AutomaticDifferentiationVectorT<T, tSize, TNumeric>(value_ + right.value_, T(1), derivatives_, T(1), right.derivatives_);
+}
+
+template <typename T, size_t tSize, typename TNumeric>
+inline AutomaticDifferentiationVectorT<T, tSize, TNumeric>& AutomaticDifferentiationVectorT<T, tSize, TNumeric>::operator+=(const AutomaticDifferentiationVectorT<T, tSize, TNumeric>& right)
+{
+	value_ += right.value_;
+
+	for (size_t n = 0; n < tSize; ++n)
+	{
+		derivatives_[n] += right.derivatives_[n];
+	}
+
+	return *this;
+}
+
+template <typename T, size_t tSize, typename TNumeric>
+inline AutomaticDifferentiationVectorT<T, tSize, TNumeric> AutomaticDifferentiationVectorT<T, tSize, TNumeric>::operator-(const T& right) const
+{
+	// f(x) = x - c
+	// f'(x) = x'
+
+	return AutomaticDifferentiationVectorT<T, tSize, TNumeric>(value_ - right, derivatives_);
+}
+
+template <typename T, size_t tSize, typename TNumeric>
+inline AutomaticDifferentiationVectorT<T, tSize, TNumeric>& AutomaticDifferentiationVectorT<T, tSize, TNumeric>::operator-=(const T& right)
+{
+	value_ -= right;
+	return *this;
+}
+
+template <typename T1, size_t tSize1, typename TNumeric1, typename T2>
+inline AutomaticDifferentiationVectorT<T1, tSize1, TNumeric1> operator-(const T2& left, const AutomaticDifferentiationVectorT<T1, tSize1, TNumeric1>& right)
+{
+	// f(x) = c - x
+	// f'(x) = -x'
+
+	return AutomaticDifferentiationVectorT<T1, tSize1, TNumeric1>(T1(left) - right.value_, T1(-1), right.derivatives_);
+}
+
+template <typename T, size_t tSize, typename TNumeric>
+inline AutomaticDifferentiationVectorT<T, tSize, TNumeric> AutomaticDifferentiationVectorT<T, tSize, TNumeric>::operator-(const AutomaticDifferentiationVectorT<T, tSize, TNumeric>& right) const
+{
+	// (u - v)' = u' - v'
+
+	return AutomaticDifferentiationVectorT<T, tSize, TNumeric>(value_ - right.value_, T(1), derivatives_, T(-1), right.derivatives_);
+}
+
+template <typename T, size_t tSize, typename TNumeric>
+inline AutomaticDifferentiationVectorT<T, tSize, TNumeric> AutomaticDifferentiationVectorT<T, tSize, TNumeric>::operator-() const
+{
+	// f(x) = -x
+	// f'(x) = -x'
+
+	return AutomaticDifferentiationVectorT<T, tSize, TNumeric>(-value_, T(-1), derivatives_);
+}
+
+template <typename T, size_t tSize, typename TNumeric>
+inline AutomaticDifferentiationVectorT<T, tSize, TNumeric>& AutomaticDifferentiationVectorT<T, tSize, TNumeric>::operator-=(const AutomaticDifferentiationVectorT<T, tSize, TNumeric>& right)
+{
+	value_ -= right.value_;
+
+	for (size_t n = 0; n < tSize; ++n)
+	{
+		derivatives_[n] -= right.derivatives_[n];
+	}
+
+	return *this;
+}
+
+template <typename T, size_t tSize, typename TNumeric>
+inline AutomaticDifferentiationVectorT<T, tSize, TNumeric> AutomaticDifferentiationVectorT<T, tSize, TNumeric>::operator*(const AutomaticDifferentiationVectorT<T, tSize, TNumeric>& right) const
+{
+	// (u * v)' = u' * v + u * v'
+
+	return AutomaticDifferentiationVectorT<T, tSize, TNumeric>(value_ * right.value_, right.value_, derivatives_, value_, right.derivatives_);
+}
+
+template <typename T, size_t tSize, typename TNumeric>
+inline AutomaticDifferentiationVectorT<T, tSize, TNumeric>& AutomaticDifferentiationVectorT<T, tSize, TNumeric>::operator*=(const AutomaticDifferentiationVectorT<T, tSize, TNumeric>& right)
+{
+	*this = *this * right;
+	return *this;
+}
+
+template <typename T, size_t tSize, typename TNumeric>
+inline AutomaticDifferentiationVectorT<T, tSize, TNumeric> AutomaticDifferentiationVectorT<T, tSize, TNumeric>::operator*(const T& right) const
+{
+	// f(x) = x * c
+	// f'(x) = x' * c
+
+	return AutomaticDifferentiationVectorT<T, tSize, TNumeric>(value_ * right, right, derivatives_);
+}
+
+template <typename T, size_t tSize, typename TNumeric>
+inline AutomaticDifferentiationVectorT<T, tSize, TNumeric>& AutomaticDifferentiationVectorT<T, tSize, TNumeric>::operator*=(const T& right)
+{
+	value_ *= right;
+
+	for (size_t n = 0; n < tSize; ++n)
+	{
+		derivatives_[n] *= right;
+	}
+
+	return *this;
+}
+
+template <typename T1, size_t tSize1, typename TNumeric1, typename T2>
+inline AutomaticDifferentiationVectorT<T1, tSize1, TNumeric1> operator*(const T2& left, const AutomaticDifferentiationVectorT<T1, tSize1, TNumeric1>& right)
+{
+	// f(x) = c * x
+	// f'(x) = c * x'
+
+	return AutomaticDifferentiationVectorT<T1, tSize1, TNumeric1>(T1(left) * right.value_, T1(left), right.derivatives_);
+}
+
+template <typename T, size_t tSize, typename TNumeric>
+inline AutomaticDifferentiationVectorT<T, tSize, TNumeric> AutomaticDifferentiationVectorT<T, tSize, TNumeric>::operator/(const AutomaticDifferentiationVectorT<T, tSize, TNumeric>& right) const
+{
+	// (u / v)' = (u' * v - u * v') / v^2
+	//          = u' / v - (u / v^2) * v'
+
+	ocean_assert((std::is_same<T, float>::value) || TNumeric::isNotEqualEps(right.value_));
+
+	const T invRight = T(1) / right.value_;
+	const T value = value_ * invRight;
+
+	return AutomaticDifferentiationVectorT<T, tSize, TNumeric>(value, invRight, derivatives_, -value * invRight, right.derivatives_);
+}
+
+template <typename T, size_t tSize, typename TNumeric>
+inline AutomaticDifferentiationVectorT<T, tSize, TNumeric>& AutomaticDifferentiationVectorT<T, tSize, TNumeric>::operator/=(const AutomaticDifferentiationVectorT<T, tSize, TNumeric>& right)
+{
+	*this = *this / right;
+	return *this;
+}
+
+template <typename T, size_t tSize, typename TNumeric>
+inline AutomaticDifferentiationVectorT<T, tSize, TNumeric> AutomaticDifferentiationVectorT<T, tSize, TNumeric>::operator/(const T& right) const
+{
+	// f(x) = x / c
+	// f'(x) = x' / c
+
+	ocean_assert((std::is_same<T, float>::value) || TNumeric::isNotEqualEps(right));
+
+	const T invRight = T(1) / right;
+
+	return AutomaticDifferentiationVectorT<T, tSize, TNumeric>(value_ * invRight, invRight, derivatives_);
+}
+
+template <typename T, size_t tSize, typename TNumeric>
+inline AutomaticDifferentiationVectorT<T, tSize, TNumeric>& AutomaticDifferentiationVectorT<T, tSize, TNumeric>::operator/=(const T& right)
+{
+	*this = *this / right;
+	return *this;
+}
+
+template <typename T1, size_t tSize1, typename TNumeric1, typename T2>
+inline AutomaticDifferentiationVectorT<T1, tSize1, TNumeric1> operator/(const T2& left, const AutomaticDifferentiationVectorT<T1, tSize1, TNumeric1>& right)
+{
+	// f(x) = c / x = c * x^-1
+	// f'(x) = -c / x^2
+
+	ocean_assert((std::is_same<T1, float>::value) || (std::is_same<T2, float>::value) || NumericT<T1>::isNotEqualEps(right.value_));
+
+	const T1 value = T1(left) / right.value_;
+
+	return AutomaticDifferentiationVectorT<T1, tSize1, TNumeric1>(value, -value / right.value_, right.derivatives_);
+}
+
+template <typename T, size_t tSize, typename TNumeric>
+inline AutomaticDifferentiationVectorT<T, tSize, TNumeric> AutomaticDifferentiationVectorT<T, tSize, TNumeric>::sin(const AutomaticDifferentiationVectorT<T, tSize, TNumeric>& value)
+{
+	// f(x) = sin(x)
+	// f'(x) = cos(x) * x'
+
+	return AutomaticDifferentiationVectorT<T, tSize, TNumeric>(TNumeric::sin(value.value_), TNumeric::cos(value.value_), value.derivatives_);
+}
+
+template <typename T, size_t tSize, typename TNumeric>
+inline AutomaticDifferentiationVectorT<T, tSize, TNumeric> AutomaticDifferentiationVectorT<T, tSize, TNumeric>::cos(const AutomaticDifferentiationVectorT<T, tSize, TNumeric>& value)
+{
+	// f(x) = cos(x)
+	// f'(x) = -sin(x) * x'
+
+	return AutomaticDifferentiationVectorT<T, tSize, TNumeric>(TNumeric::cos(value.value_), -TNumeric::sin(value.value_), value.derivatives_);
+}
+
+template <typename T, size_t tSize, typename TNumeric>
+inline AutomaticDifferentiationVectorT<T, tSize, TNumeric> AutomaticDifferentiationVectorT<T, tSize, TNumeric>::tan(const AutomaticDifferentiationVectorT<T, tSize, TNumeric>& value)
+{
+	// f(x) = tan(x)
+	// f'(x) = 1 / (cos(x) * cos(x)) * x'
+
+	return AutomaticDifferentiationVectorT<T, tSize, TNumeric>(TNumeric::tan(value.value_), T(1) / TNumeric::sqr(TNumeric::cos(value.value_)), value.derivatives_);
+}
+
+template <typename T, size_t tSize, typename TNumeric>
+inline AutomaticDifferentiationVectorT<T, tSize, TNumeric> AutomaticDifferentiationVectorT<T, tSize, TNumeric>::sqrt(const AutomaticDifferentiationVectorT<T, tSize, TNumeric>& value)
+{
+	// f(x) = sqrt(x)
+	// f'(x) = 1 / (2 * sqrt(x)) * x'
+
+	ocean_assert(value.value_ >= T(0));
+
+	const T sqrtValue = TNumeric::sqrt(value.value_);
+
+	return AutomaticDifferentiationVectorT<T, tSize, TNumeric>(sqrtValue, T(0.5) / sqrtValue, value.derivatives_);
+}
+
+template <typename T, size_t tSize, typename TNumeric>
+inline AutomaticDifferentiationVectorT<T, tSize, TNumeric> AutomaticDifferentiationVectorT<T, tSize, TNumeric>::sqr(const AutomaticDifferentiationVectorT<T, tSize, TNumeric>& value)
+{
+	// f(x) = x^2
+	// f'(x) = 2x * x'
+
+	return AutomaticDifferentiationVectorT<T, tSize, TNumeric>(value.value_ * value.value_, T(2) * value.value_, value.derivatives_);
+}
+
+template <typename T, size_t tSize, typename TNumeric>
+inline AutomaticDifferentiationVectorT<T, tSize, TNumeric> AutomaticDifferentiationVectorT<T, tSize, TNumeric>::exp(const AutomaticDifferentiationVectorT<T, tSize, TNumeric>& value)
+{
+	// f(x) = exp(x) = e^x
+	// f'(x) = e^x * x'
+
+	const T expValue = TNumeric::exp(value.value_);
+
+	return AutomaticDifferentiationVectorT<T, tSize, TNumeric>(expValue, expValue, value.derivatives_);
+}
+
+template <typename T, size_t tSize, typename TNumeric>
+inline AutomaticDifferentiationVectorT<T, tSize, TNumeric> AutomaticDifferentiationVectorT<T, tSize, TNumeric>::log(const AutomaticDifferentiationVectorT<T, tSize, TNumeric>& value)
+{
+	// f(x) = log(x)
+	// f'(x) = x' / x
+
+	ocean_assert((std::is_same<T, float>::value) || TNumeric::isNotEqualEps(value.value_));
+
+	return AutomaticDifferentiationVectorT<T, tSize, TNumeric>(TNumeric::log(value.value_), T(1) / value.value_, value.derivatives_);
+}
+
+template <typename T, size_t tSize, typename TNumeric>
+inline AutomaticDifferentiationVectorT<T, tSize, TNumeric> AutomaticDifferentiationVectorT<T, tSize, TNumeric>::log2(const AutomaticDifferentiationVectorT<T, tSize, TNumeric>& value)
+{
+	// f(x) = log_2(x)
+	// f'(x) = x' / (x * log(2))
+
+	ocean_assert((std::is_same<T, float>::value) || TNumeric::isNotEqualEps(value.value_));
+
+	return AutomaticDifferentiationVectorT<T, tSize, TNumeric>(TNumeric::log2(value.value_), T(1) / (value.value_ * T(0.69314718055994530941723212145818)), value.derivatives_);
+}
+
+template <typename T, size_t tSize, typename TNumeric>
+inline AutomaticDifferentiationVectorT<T, tSize, TNumeric> AutomaticDifferentiationVectorT<T, tSize, TNumeric>::log10(const AutomaticDifferentiationVectorT<T, tSize, TNumeric>& value)
+{
+	// f(x) = log_10(x)
+	// f'(x) = x' / (x * log(10))
+
+	ocean_assert((std::is_same<T, float>::value) || TNumeric::isNotEqualEps(value.value_));
+
+	return AutomaticDifferentiationVectorT<T, tSize, TNumeric>(TNumeric::log10(value.value_), T(1) / (value.value_ * T(2.3025850929940456840179914546844)), value.derivatives_);
+}
+
+template <typename T, size_t tSize, typename TNumeric>
+inline AutomaticDifferentiationVectorT<T, tSize, TNumeric> AutomaticDifferentiationVectorT<T, tSize, TNumeric>::pow(const AutomaticDifferentiationVectorT<T, tSize, TNumeric>& x, const T& y)
+{
+	// f(x, y) = x^y
+	// f'(x) = y * x^(y - 1) * x'
+
+	ocean_assert(x.value_ >= T(0));
+
+	return AutomaticDifferentiationVectorT<T, tSize, TNumeric>(TNumeric::pow(x.value_, y), y * TNumeric::pow(x.value_, y - T(1)), x.derivatives_);
+}
+
+template <typename T, size_t tSize, typename TNumeric>
+inline AutomaticDifferentiationVectorT<T, tSize, TNumeric> AutomaticDifferentiationVectorT<T, tSize, TNumeric>::abs(const AutomaticDifferentiationVectorT<T, tSize, TNumeric>& value)
+{
+	// f(x) = |x|
+	// f'(x) = sign(x) * x'
+
+	return AutomaticDifferentiationVectorT<T, tSize, TNumeric>(TNumeric::abs(value.value_), value.value_ >= T(0) ? T(1) : T(-1), value.derivatives_);
+}
+
+template <typename T, size_t tSize, typename TNumeric>
+inline AutomaticDifferentiationVectorT<T, tSize, TNumeric> AutomaticDifferentiationVectorT<T, tSize, TNumeric>::min(const AutomaticDifferentiationVectorT<T, tSize, TNumeric>& value, const T& second)
+{
+	// f(x) = min(x, c)
+	//         | x', x < c
+	// f'(x) = | 0, x >= c
+
+	if (value.value_ < second)
+	{
+		return value;
+	}
+	else
+	{
+		return AutomaticDifferentiationVectorT<T, tSize, TNumeric>(second);
+	}
+}
+
+template <typename T, size_t tSize, typename TNumeric>
+inline AutomaticDifferentiationVectorT<T, tSize, TNumeric> AutomaticDifferentiationVectorT<T, tSize, TNumeric>::max(const AutomaticDifferentiationVectorT<T, tSize, TNumeric>& value, const T& second)
+{
+	// f(x) = max(x, c)
+	//         | x', x > c
+	// f'(x) = | 0, x <= c
+
+	if (value.value_ > second)
+	{
+		return value;
+	}
+	else
+	{
+		return AutomaticDifferentiationVectorT<T, tSize, TNumeric>(second);
+	}
+}
+
+}
+
+#endif // META_OCEAN_MATH_AUTOMATIC_DIFFERENTIATION_VECTOR_H
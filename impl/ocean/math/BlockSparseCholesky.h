@@ -0,0 +1,735 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#ifndef META_OCEAN_MATH_BLOCK_SPARSE_CHOLESKY_H
+#define META_OCEAN_MATH_BLOCK_SPARSE_CHOLESKY_H
+
+#include "ocean/math/Math.h"
+#include "ocean/math/BlockSparseMatrix.h"
+#include "ocean/math/Numeric.h"
+
+#include <algorithm>
+#include <queue>
+#include <vector>
+
+namespace Ocean
+{
+
+// Forward declaration.
+template <typename T, size_t tBlockSize> class BlockSparseCholeskyT;
+
+/**
+ * Definition of a sparse Cholesky decomposition for matrices with 6x6 blocks, using either a single or double precision float data type depending on the Scalar type.
+ * @see BlockSparseCholeskyT
+ * @ingroup math
+ */
+using BlockSparseCholesky6 = BlockSparseCholeskyT<Scalar, 6>;
+
+/**
+ * Definition of a sparse Cholesky decomposition for matrices with 3x3 blocks, using either a single or double precision float data type depending on the Scalar type.
+ * @see BlockSparseCholeskyT
+ * @ingroup math
+ */
+using BlockSparseCholesky3 = BlockSparseCholeskyT<Scalar, 3>;
+
+/**
+ * This class implements a sparse Cholesky decomposition A = P^T * L * L^T * P for symmetric positive definite block sparse matrices.
+ * The decomposition is separated into a symbolic analysis and a numeric factorization.<br>
+ * The symbolic analysis determines a fill-reducing ordering (minimum degree on the graph of blocks), the elimination tree, and the block sparsity pattern of L.<br>
+ * The numeric factorization is left-looking and operates on entire blocks, so that each block column of L is treated as a dense supernode of tBlockSize columns.<br>
+ * Once analyzed, matrices with identical block sparsity pattern (e.g., the normal equations of individual Levenberg-Marquardt iterations) can be factorized without repeating the analysis.
+ * @tparam T The data type of each matrix element, e.g., 'float' or 'double'
+ * @tparam tBlockSize The number of rows (and columns) of each block, with range [1, infinity)
+ * @see BlockSparseMatrixT.
+ * @ingroup math
+ */
+template <typename T, size_t tBlockSize>
+class BlockSparseCholeskyT
+{
+	public:
+
+		/**
+		 * Definition of the block sparse matrix type which can be decomposed.
+		 */
+		using BlockSparseMatrix = BlockSparseMatrixT<T, tBlockSize>;
+
+		/**
+		 * The number of elements in each block.
+		 */
+		static constexpr size_t blockElements_ = tBlockSize * tBlockSize;
+
+	public:
+
+		/**
+		 * Determines the fill-reducing ordering and the block sparsity pattern of the decomposition.
+		 * @param matrix The symmetric block sparse matrix to analyze, with both triangles stored, must be square
+		 * @param reorder True, to apply a minimum degree ordering; False, to keep the original ordering of the block rows
+		 * @return True, if succeeded
+		 */
+		bool analyze(const BlockSparseMatrix& matrix, const bool reorder = true);
+
+		/**
+		 * Determines the numeric decomposition of a matrix.
+		 * The matrix must have the same block sparsity pattern as the matrix used during the analysis.
+		 * @param matrix The symmetric positive definite block sparse matrix to decompose, with both triangles stored
+		 * @return True, if succeeded; False, if the matrix is not positive definite or has not been analyzed
+		 */
+		bool factorize(const BlockSparseMatrix& matrix);
+
+		/**
+		 * Solves the linear system A * x = b based on the current decomposition.
+		 * @param b The right side of the system, with size() elements, must be valid
+		 * @param x The resulting solution, with size() elements, must be valid, may be identical to 'b'
+		 * @return True, if succeeded
+		 */
+		bool solve(const T* b, T* x) const;
+
+		/**
+		 * Returns the fill-reducing permutation, mapping each new block index to the original block index.
+		 * @return The permutation, empty if the decomposition has not been analyzed
+		 */
+		inline const Indices32& permutation() const;
+
+		/**
+		 * Returns the number of non-zero blocks in the lower triangular matrix L (including the diagonal blocks).
+		 * @return The number of non-zero blocks
+		 */
+		inline size_t nonZeroBlocks() const;
+
+		/**
+		 * Returns the number of (element) rows of the decomposed matrix.
+		 * @return The matrix's rows
+		 */
+		inline size_t size() const;
+
+		/**
+		 * Returns whether the decomposition has been analyzed.
+		 * @return True, if so
+		 */
+		inline bool isAnalyzed() const;
+
+		/**
+		 * Returns whether the decomposition holds a valid numeric factorization.
+		 * @return True, if so
+		 */
+		inline bool isFactorized() const;
+
+		/**
+		 * Determines a minimum degree ordering for the graph of blocks of a symmetric block sparse matrix.
+		 * The ordering uses exact external degrees and explicit cliques (without the approximate degrees and element absorption of AMD), which is sufficient for the block graphs of e.g., bundle adjustment problems.
+		 * @param matrix The symmetric block sparse matrix, must be square
+		 * @return The permutation mapping each new block index to the original block index
+		 */
+		static Indices32 minimumDegreeOrdering(const BlockSparseMatrix& matrix);
+
+	protected:
+
+		/**
+		 * Determines the Cholesky decomposition of a dense symmetric positive definite block in place.
+		 * @param block The block to decompose, the lower triangle receives the lower triangular factor, the upper triangle will be set to zero
+		 * @return True, if the block is positive definite
+		 */
+		static inline bool factorizeBlock(T* block);
+
+		/**
+		 * Subtracts the product of a block with the transposed of a second block: target = target - left * right^T.
+		 * @param left The left block, must be valid
+		 * @param right The right block, must be valid
+		 * @param target The target block, must be valid
+		 */
+		static inline void subtractMultipliedTransposed(const T* left, const T* right, T* target);
+
+		/**
+		 * Solves X * L^T = W for X in place, with L a lower triangular block.
+		 * @param lowerBlock The lower triangular block L, must be valid
+		 * @param block The block W, receiving X, must be valid
+		 */
+		static inline void solveTransposedRight(const T* lowerBlock, T* block);
+
+	protected:
+
+		/// The number of block rows (and block columns) of the decomposed matrix.
+		size_t blockSize_ = 0;
+
+		/// The permutation mapping each new block index to the original block index.
+		Indices32 permutation_;
+
+		/// The inverse permutation mapping each original block index to the new block index.
+		Indices32 inversePermutation_;
+
+		/// The offsets of the individual block columns of L, with blockSize_ + 1 elements.
+		Indices32 columnOffsets_;
+
+		/// The block row indices of all blocks of L, ascending within each block column, the diagonal block first.
+		Indices32 blockRowIndices_;
+
+		/// The elements of all blocks of L, each block row-major.
+		std::vector<T> values_;
+
+		/// True, if values_ holds a valid numeric factorization.
+		bool isFactorized_ = false;
+};
+
+template <typename T, size_t tBlockSize>
+bool BlockSparseCholeskyT<T, tBlockSize>::analyze(const BlockSparseMatrix& matrix, const bool reorder)
+{
+	blockSize_ = 0;
+	isFactorized_ = false;
+
+	if (!matrix.isValid() || matrix.blockRows() != matrix.blockColumns())
+	{
+		ocean_assert(false && "Invalid matrix!");
+		return false;
+	}
+
+	const size_t n = matrix.blockRows();
+
+	if (reorder)
+	{
+		permutation_ = minimumDegreeOrdering(matrix);
+	}
+	else
+	{
+		permutation_.resize(n);
+
+		for (size_t i = 0; i < n; ++i)
+		{
+			permutation_[i] = (unsigned int)(i);
+		}
+	}
+
+	ocean_assert(permutation_.size() == n);
+
+	inversePermutation_.resize(n);
+	for (size_t i = 0; i < n; ++i)
+	{
+		inversePermutation_[permutation_[i]] = (unsigned int)(i);
+	}
+
+	// we determine the structure of each column of L (without the diagonal), as the union of the column's entries in A and the structures of all children in the elimination tree
+
+	std::vector<Indices32> columnStructures(n);
+	std::vector<Indices32> children(n);
+
+	Indices32 marker(n, (unsigned int)(-1));
+
+	const Indices32& rowOffsets = matrix.rowOffsets();
+	const Indices32& blockColumnIndices = matrix.blockColumnIndices();
+
+	for (size_t j = 0; j < n; ++j)
+	{
+		Indices32& structure = columnStructures[j];
+
+		marker[j] = (unsigned int)(j);
+
+		// A is symmetric, so the column j of A (in the new order) is the row permutation_[j]
+
+		const size_t originalRow = size_t(permutation_[j]);
+
+		for (size_t i = size_t(rowOffsets[originalRow]); i < size_t(rowOffsets[originalRow + 1]); ++i)
+		{
+			const unsigned int row = inversePermutation_[blockColumnIndices[i]];
+
+			if (size_t(row) > j && marker[row] != (unsigned int)(j))
+			{
+				marker[row] = (unsigned int)(j);
+				structure.push_back(row);
+			}
+		}
+
+		for (const unsigned int child : children[j])
+		{
+			for (const unsigned int row : columnStructures[child])
+			{
+				if (size_t(row) > j && marker[row] != (unsigned int)(j))
+				{
+					marker[row] = (unsigned int)(j);
+					structure.push_back(row);
+				}
+			}
+		}
+
+		std::sort(structure.begin(), structure.end());
+
+		if (!structure.empty())
+		{
+			// the parent of j in the elimination tree is the first off-diagonal row
+
+			children[structure.front()].push_back((unsigned int)(j));
+		}
+	}
+
+	columnOffsets_.resize(n + 1);
+	columnOffsets_[0] = 0u;
+
+	for (size_t j = 0; j < n; ++j)
+	{
+		columnOffsets_[j + 1] = columnOffsets_[j] + 1u + (unsigned int)(columnStructures[j].size());
+	}
+
+	blockRowIndices_.clear();
+	blockRowIndices_.reserve(columnOffsets_.back());
+
+	for (size_t j = 0; j < n; ++j)
+	{
+		blockRowIndices_.push_back((unsigned int)(j));
+		blockRowIndices_.insert(blockRowIndices_.end(), columnStructures[j].cbegin(), columnStructures[j].cend());
+	}
+
+	values_.clear();
+	blockSize_ = n;
+
+	return true;
+}
+
+template <typename T, size_t tBlockSize>
+bool BlockSparseCholeskyT<T, tBlockSize>::factorize(const BlockSparseMatrix& matrix)
+{
+	isFactorized_ = false;
+
+	if (!isAnalyzed() || matrix.blockRows() != blockSize_ || matrix.blockColumns() != blockSize_)
+	{
+		ocean_assert(false && "Invalid matrix or not analyzed!");
+		return false;
+	}
+
+	const size_t n = blockSize_;
+
+	values_.resize(size_t(columnOffsets_.back()) * blockElements_);
+
+	// the position of each row within the current column of L
+	Indices32 rowPositions(n, (unsigned int)(-1));
+
+	// the linked lists of all columns k < j with L(j, k) != 0 which still need to be applied to a column j
+	Indices32 listHeads(n, (unsigned int)(-1));
+	Indices32 listNext(n, (unsigned int)(-1));
+
+	// the position of the next block in each column k which has not yet been applied
+	Indices32 nextPositions(n, (unsigned int)(-1));
+
+	const Indices32& rowOffsets = matrix.rowOffsets();
+	const Indices32& blockColumnIndices = matrix.blockColumnIndices();
+
+	for (size_t j = 0; j < n; ++j)
+	{
+		const size_t columnBegin = size_t(columnOffsets_[j]);
+		const size_t columnEnd = size_t(columnOffsets_[j + 1]);
+
+		T* const columnValues = values_.data() + columnBegin * blockElements_;
+
+		std::fill(columnValues, columnValues + (columnEnd - columnBegin) * blockElements_, T(0));
+
+		for (size_t p = columnBegin; p < columnEnd; ++p)
+		{
+			rowPositions[blockRowIndices_[p]] = (unsigned int)(p);
+		}
+
+		// scatter the lower part of column j of A: A(i, j) = A(j, i)^T, with A(j, i) stored in the original row permutation_[j]
+
+		const size_t originalRow = size_t(permutation_[j]);
+
+		for (size_t i = size_t(rowOffsets[originalRow]); i < size_t(rowOffsets[originalRow + 1]); ++i)
+		{
+			const size_t row = size_t(inversePermutation_[blockColumnIndices[i]]);
+
+			if (row < j)
+			{
+				continue;
+			}
+
+			ocean_assert(rowPositions[row] != (unsigned int)(-1));
+			T* const target = values_.data() + size_t(rowPositions[row]) * blockElements_;
+			const T* const source = matrix.blockData(i);
+
+			for (size_t r = 0; r < tBlockSize; ++r)
+			{
+				for (size_t c = 0; c < tBlockSize; ++c)
+				{
+					target[r * tBlockSize + c] += source[c * tBlockSize + r];
+				}
+			}
+		}
+
+		// apply all columns k < j with L(j, k) != 0: L(i, j) -= L(i, k) * L(j, k)^T, for all i >= j
+
+		unsigned int k = listHeads[j];
+
+		while (k != (unsigned int)(-1))
+		{
+			const unsigned int nextK = listNext[k];
+
+			const size_t position = size_t(nextPositions[k]);
+			const size_t kEnd = size_t(columnOffsets_[k + 1]);
+
+			ocean_assert(size_t(blockRowIndices_[position]) == j);
+
+			const T* const ljk = values_.data() + position * blockElements_;
+
+			for (size_t q = position; q < kEnd; ++q)
+			{
+				const size_t row = size_t(blockRowIndices_[q]);
+				ocean_assert(rowPositions[row] != (unsigned int)(-1) && size_t(rowPositions[row]) >= columnBegin && size_t(rowPositions[row]) < columnEnd);
+
+				subtractMultipliedTransposed(values_.data() + q * blockElements_, ljk, values_.data() + size_t(rowPositions[row]) * blockElements_);
+			}
+
+			if (position + 1 < kEnd)
+			{
+				const unsigned int nextRow = blockRowIndices_[position + 1];
+
+				nextPositions[k] = (unsigned int)(position + 1);
+				listNext[k] = listHeads[nextRow];
+				listHeads[nextRow] = k;
+			}
+
+			k = nextK;
+		}
+
+		listHeads[j] = (unsigned int)(-1);
+
+		if (!factorizeBlock(columnValues))
+		{
+			return false;
+		}
+
+		for (size_t p = columnBegin + 1; p < columnEnd; ++p)
+		{
+			solveTransposedRight(columnValues, values_.data() + p * blockElements_);
+		}
+
+		for (size_t p = columnBegin; p < columnEnd; ++p)
+		{
+			rowPositions[blockRowIndices_[p]] = (unsigned int)(-1);
+		}
+
+		if (columnBegin + 1 < columnEnd)
+		{
+			const unsigned int nextRow = blockRowIndices_[columnBegin + 1];
+
+			nextPositions[j] = (unsigned int)(columnBegin + 1);
+			listNext[j] = listHeads[nextRow];
+			listHeads[nextRow] = (unsigned int)(j);
+		}
+	}
+
+	isFactorized_ = true;
+
+	return true;
+}
+
+template <typename T, size_t tBlockSize>
+bool BlockSparseCholeskyT<T, tBlockSize>::solve(const T* b, T* x) const
+{
+	ocean_assert(b != nullptr && x != nullptr);
+
+	if (!isFactorized_)
+	{
+		ocean_assert(false && "Not factorized!");
+		return false;
+	}
+
+	const size_t n = blockSize_;
+
+	std::vector<T> y(n * tBlockSize);
+
+	for (size_t j = 0; j < n; ++j)
+	{
+		for (size_t i = 0; i < tBlockSize; ++i)
+		{
+			y[j * tBlockSize + i] = b[size_t(permutation_[j]) * tBlockSize + i];
+		}
+	}
+
+	// forward substitution: L * z = y
+
+	for (size_t j = 0; j < n; ++j)
+	{
+		const T* const diagonal = values_.data() + size_t(columnOffsets_[j]) * blockElements_;
+		T* const yj = y.data() + j * tBlockSize;
+
+		for (size_t r = 0; r < tBlockSize; ++r)
+		{
+			T value = yj[r];
+
+			for (size_t c = 0; c < r; ++c)
+			{
+				value -= diagonal[r * tBlockSize + c] * yj[c];
+			}
+
+			yj[r] = value / diagonal[r * tBlockSize + r];
+		}
+
+		for (size_t p = size_t(columnOffsets_[j]) + 1; p < size_t(columnOffsets_[j + 1]); ++p)
+		{
+			const T* const lij = values_.data() + p * blockElements_;
+			T* const yi = y.data() + size_t(blockRowIndices_[p]) * tBlockSize;
+
+			for (size_t r = 0; r < tBlockSize; ++r)
+			{
+				for (size_t c = 0; c < tBlockSize; ++c)
+				{
+					yi[r] -= lij[r * tBlockSize + c] * yj[c];
+				}
+			}
+		}
+	}
+
+	// backward substitution: L^T * w = z
+
+	for (size_t j = n - 1; j < n; --j)
+	{
+		T* const yj = y.data() + j * tBlockSize;
+
+		for (size_t p = size_t(columnOffsets_[j]) + 1; p < size_t(columnOffsets_[j + 1]); ++p)
+		{
+			const T* const lij = values_.data() + p * blockElements_;
+			const T* const yi = y.data() + size_t(blockRowIndices_[p]) * tBlockSize;
+
+			for (size_t r = 0; r < tBlockSize; ++r)
+			{
+				for (size_t c = 0; c < tBlockSize; ++c)
+				{
+					yj[c] -= lij[r * tBlockSize + c] * yi[r];
+				}
+			}
+		}
+
+		const T* const diagonal = values_.data() + size_t(columnOffsets_[j]) * blockElements_;
+
+		for (size_t r = tBlockSize - 1; r < tBlockSize; --r)
+		{
+			T value = yj[r];
+
+			for (size_t c = r + 1; c < tBlockSize; ++c)
+			{
+				value -= diagonal[c * tBlockSize + r] * yj[c];
+			}
+
+			yj[r] = value / diagonal[r * tBlockSize + r];
+		}
+	}
+
+	for (size_t j = 0; j < n; ++j)
+	{
+		for (size_t i = 0; i < tBlockSize; ++i)
+		{
+			x[size_t(permutation_[j]) * tBlockSize + i] = y[j * tBlockSize + i];
+		}
+	}
+
+	return true;
+}
+
+template <typename T, size_t tBlockSize>
+inline const Indices32& BlockSparseCholeskyT<T, tBlockSize>::permutation() const
+{
+	return permutation_;
+}
+
+template <typename T, size_t tBlockSize>
+inline size_t BlockSparseCholeskyT<T, tBlockSize>::nonZeroBlocks() const
+{
+	return blockRowIndices_.size();
+}
+
+template <typename T, size_t tBlockSize>
+inline size_t BlockSparseCholeskyT<T, tBlockSize>::size() const
+{
+	return blockSize_ * tBlockSize;
+}
+
+template <typename T, size_t tBlockSize>
+inline bool BlockSparseCholeskyT<T, tBlockSize>::isAnalyzed() const
+{
+	return blockSize_ != 0;
+}
+
+template <typename T, size_t tBlockSize>
+inline bool BlockSparseCholeskyT<T, tBlockSize>::isFactorized() const
+{
+	return isFactorized_;
+}
+
+template <typename T, size_t tBlockSize>
+Indices32 BlockSparseCholeskyT<T, tBlockSize>::minimumDegreeOrdering(const BlockSparseMatrix& matrix)
+{
+	ocean_assert(matrix.isValid() && matrix.blockRows() == matrix.blockColumns());
+
+	const size_t n = matrix.blockRows();
+
+	const Indices32& rowOffsets = matrix.rowOffsets();
+	const Indices32& blockColumnIndices = matrix.blockColumnIndices();
+
+	// the adjacency of each (not yet eliminated) node, sorted, without the node itself
+
+	std::vector<Indices32> adjacency(n);
+
+	for (size_t r = 0; r < n; ++r)
+	{
+		for (size_t i = size_t(rowOffsets[r]); i < size_t(rowOffsets[r + 1]); ++i)
+		{
+			if (size_t(blockColumnIndices[i]) != r)
+			{
+				adjacency[r].push_back(blockColumnIndices[i]);
+			}
+		}
+
+		ocean_assert(std::is_sorted(adjacency[r].cbegin(), adjacency[r].cend()));
+	}
+
+	using DegreePair = std::pair<size_t, unsigned int>;
+	std::priority_queue<DegreePair, std::vector<DegreePair>, std::greater<DegreePair>> queue;
+
+	for (size_t r = 0; r < n; ++r)
+	{
+		queue.emplace(adjacency[r].size(), (unsigned int)(r));
+	}
+
+	std::vector<unsigned char> eliminated(n, 0u);
+
+	Indices32 ordering;
+	ordering.reserve(n);
+
+	Indices32 merged;
+
+	while (!queue.empty())
+	{
+		const DegreePair pair = queue.top();
+		queue.pop();
+
+		const unsigned int node = pair.second;
+
+		if (eliminated[node] != 0u || adjacency[node].size() != pair.first)
+		{
+			// outdated queue entry
+			continue;
+		}
+
+		eliminated[node] = 1u;
+		ordering.push_back(node);
+
+		const Indices32 neighbors = std::move(adjacency[node]);
+		adjacency[node].clear();
+
+		// the neighbors of the eliminated node form a clique
+
+		for (const unsigned int neighbor : neighbors)
+		{
+			Indices32& neighborAdjacency = adjacency[neighbor];
+
+			merged.clear();
+			merged.reserve(neighborAdjacency.size() + neighbors.size());
+
+			std::set_union(neighborAdjacency.cbegin(), neighborAdjacency.cend(), neighbors.cbegin(), neighbors.cend(), std::back_inserter(merged));
+
+			neighborAdjacency.clear();
+
+			for (const unsigned int index : merged)
+			{
+				if (index != neighbor && index != node)
+				{
+					neighborAdjacency.push_back(index);
+				}
+			}
+
+			queue.emplace(neighborAdjacency.size(), neighbor);
+		}
+	}
+
+	ocean_assert(ordering.size() == n);
+
+	return ordering;
+}
+
+template <typename T, size_t tBlockSize>
+inline bool BlockSparseCholeskyT<T, tBlockSize>::factorizeBlock(T* block)
+{
+	ocean_assert(block != nullptr);
+
+	for (size_t c = 0; c < tBlockSize; ++c)
+	{
+		T diagonal = block[c * tBlockSize + c];
+
+		for (size_t k = 0; k < c; ++k)
+		{
+			diagonal -= NumericT<T>::sqr(block[c * tBlockSize + k]);
+		}
+
+		if (diagonal <= NumericT<T>::eps())
+		{
+			return false;
+		}
+
+		diagonal = NumericT<T>::sqrt(diagonal);
+		block[c * tBlockSize + c] = diagonal;
+
+		const T invDiagonal = T(1) / diagonal;
+
+		for (size_t r = c + 1; r < tBlockSize; ++r)
+		{
+			T value = block[r * tBlockSize + c];
+
+			for (size_t k = 0; k < c; ++k)
+			{
+				value -= block[r * tBlockSize + k] * block[c * tBlockSize + k];
+			}
+
+			block[r * tBlockSize + c] = value * invDiagonal;
+			block[c * tBlockSize + r] = T(0);
+		}
+	}
+
+	return true;
+}
+
+template <typename T, size_t tBlockSize>
+inline void BlockSparseCholeskyT<T, tBlockSize>::subtractMultipliedTransposed(const T* left, const T* right, T* target)
+{
+	ocean_assert(left != nullptr && right != nullptr && target != nullptr);
+
+	for (size_t r = 0; r < tBlockSize; ++r)
+	{
+		for (size_t c = 0; c < tBlockSize; ++c)
+		{
+			T value = T(0);
+
+			for (size_t k = 0; k < tBlockSize; ++k)
+			{
+				value += left[r * tBlockSize + k] * right[c * tBlockSize + k];
+			}
+
+			target[r * tBlockSize + c] -= value;
+		}
+	}
+}
+
+template <typename T, size_t tBlockSize>
+inline void BlockSparseCholeskyT<T, tBlockSize>::solveTransposedRight(const T* lowerBlock, T* block)
+{
+	ocean_assert(lowerBlock != nullptr && block != nullptr);
+
+	for (size_t r = 0; r < tBlockSize; ++r)
+	{
+		T* const row = block + r * tBlockSize;
+
+		for (size_t c = 0; c < tBlockSize; ++c)
+		{
+			T value = row[c];
+
+			for (size_t k = 0; k < c; ++k)
+			{
+				value -= row[k] * lowerBlock[c * tBlockSize + k];
+			}
+
+			row[c] = value / lowerBlock[c * tBlockSize + c];
+		}
+	}
+}
+
+}
+
+#endif // META_OCEAN_MATH_BLOCK_SPARSE_CHOLESKY_H
@@ -0,0 +1,622 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#ifndef META_OCEAN_MATH_BLOCK_SPARSE_MATRIX_H
+#define META_OCEAN_MATH_BLOCK_SPARSE_MATRIX_H
+
+#include "ocean/math/Math.h"
+#include "ocean/math/Matrix.h"
+#include "ocean/math/Numeric.h"
+
+#include "ocean/base/Worker.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace Ocean
+{
+
+// Forward declaration.
+template <typename T, size_t tBlockSize> class BlockSparseMatrixT;
+
+/**
+ * Definition of a block sparse matrix with 6x6 blocks, using either a single or double precision float data type depending on the Scalar type.
+ * @see BlockSparseMatrixT
+ * @ingroup math
+ */
+using BlockSparseMatrix6 = BlockSparseMatrixT<Scalar, 6>;
+
+/**
+ * Definition of a block sparse matrix with 3x3 blocks, using either a single or double precision float data type depending on the Scalar type.
+ * @see BlockSparseMatrixT
+ * @ingroup math
+ */
+using BlockSparseMatrix3 = BlockSparseMatrixT<Scalar, 3>;
+
+/**
+ * This class implements a sparse matrix composed of dense square blocks, stored in the compressed sparse row format (BSR).
+ * The matrix is composed of blockRows() x blockColumns() blocks, each block has tBlockSize x tBlockSize elements.<br>
+ * Only non-zero blocks are stored, all blocks of one block row are stored consecutively with ascending block column index.<br>
+ * The elements of each block are stored in a row-major order.<br>
+ * In contrast to SparseMatrixT, the storage of this matrix is explicit and does not depend on a third-party library, so that the matrix can be used directly in e.g., bundle adjustment problems in which the Jacobian and the normal equations have a natural block structure (e.g., 6x6 camera blocks and 3x3 point blocks).
+ * @tparam T The data type of each matrix element, e.g., 'float' or 'double'
+ * @tparam tBlockSize The number of rows (and columns) of each block, with range [1, infinity)
+ * @see BlockSparseCholeskyT, SparseMatrixT.
+ * @ingroup math
+ */
+template <typename T, size_t tBlockSize>
+class BlockSparseMatrixT
+{
+	static_assert(tBlockSize >= 1, "Invalid block size");
+
+	public:
+
+		/**
+		 * The number of elements in each block.
+		 */
+		static constexpr size_t blockElements_ = tBlockSize * tBlockSize;
+
+		/**
+		 * This class implements a single (non-zero) block of a block sparse matrix.
+		 */
+		class BlockEntry
+		{
+			public:
+
+				/**
+				 * Creates a new invalid entry.
+				 */
+				BlockEntry() = default;
+
+				/**
+				 * Creates a new entry.
+				 * @param blockRow The index of the block row, with range [0, infinity)
+				 * @param blockColumn The index of the block column, with range [0, infinity)
+				 * @param values The tBlockSize x tBlockSize elements of the block, stored in a row-major order, must be valid
+				 */
+				inline BlockEntry(const size_t blockRow, const size_t blockColumn, const T* values);
+
+				/**
+				 * Returns the index of the block row of this entry.
+				 * @return The block row index
+				 */
+				inline size_t blockRow() const;
+
+				/**
+				 * Returns the index of the block column of this entry.
+				 * @return The block column index
+				 */
+				inline size_t blockColumn() const;
+
+				/**
+				 * Returns the elements of this block, stored in a row-major order.
+				 * @return The block's elements
+				 */
+				inline const T* values() const;
+
+				/**
+				 * Returns whether this entry is valid.
+				 * @return True, if so
+				 */
+				inline bool isValid() const;
+
+				/**
+				 * Returns whether this entry is located before a second entry (in a row-major order).
+				 * @param right The second entry to compare
+				 * @return True, if so
+				 */
+				inline bool operator<(const BlockEntry& right) const;
+
+			protected:
+
+				/// The index of the block row.
+				size_t blockRow_ = size_t(-1);
+
+				/// The index of the block column.
+				size_t blockColumn_ = size_t(-1);
+
+				/// The elements of the block, row-major.
+				T values_[blockElements_] = {};
+		};
+
+		/**
+		 * Definition of a vector holding block entries.
+		 */
+		using BlockEntries = std::vector<BlockEntry>;
+
+	public:
+
+		/**
+		 * Creates an empty matrix.
+		 */
+		BlockSparseMatrixT() = default;
+
+		/**
+		 * Creates a new matrix from a set of block entries.
+		 * The entries can be provided in an arbitrary order, entries with identical block positions will be summed.
+		 * @param blockRows The number of block rows of the matrix, with range [1, infinity)
+		 * @param blockColumns The number of block columns of the matrix, with range [1, infinity)
+		 * @param entries The non-zero blocks of the matrix, each block must lie inside the matrix
+		 */
+		BlockSparseMatrixT(const size_t blockRows, const size_t blockColumns, BlockEntries entries);
+
+		/**
+		 * Returns the number of (element) rows of this matrix.
+		 * @return The matrix's rows, which is blockRows() * tBlockSize
+		 */
+		inline size_t rows() const;
+
+		/**
+		 * Returns the number of (element) columns of this matrix.
+		 * @return The matrix's columns, which is blockColumns() * tBlockSize
+		 */
+		inline size_t columns() const;
+
+		/**
+		 * Returns the number of block rows of this matrix.
+		 * @return The matrix's block rows
+		 */
+		inline size_t blockRows() const;
+
+		/**
+		 * Returns the number of block columns of this matrix.
+		 * @return The matrix's block columns
+		 */
+		inline size_t blockColumns() const;
+
+		/**
+		 * Returns the number of stored (non-zero) blocks of this matrix.
+		 * @return The number of non-zero blocks
+		 */
+		inline size_t nonZeroBlocks() const;
+
+		/**
+		 * Returns the offsets of all block rows into the block column indices and blocks of this matrix.
+		 * The blocks of block row r are located in the range [rowOffsets()[r], rowOffsets()[r + 1]).
+		 * @return The blockRows() + 1 row offsets
+		 */
+		inline const Indices32& rowOffsets() const;
+
+		/**
+		 * Returns the block column indices of all stored blocks.
+		 * @return The nonZeroBlocks() block column indices, ascending within each block row
+		 */
+		inline const Indices32& blockColumnIndices() const;
+
+		/**
+		 * Returns the elements of a stored block.
+		 * @param blockIndex The index of the stored block, with range [0, nonZeroBlocks() - 1]
+		 * @return The block's tBlockSize x tBlockSize elements, row-major
+		 */
+		inline const T* blockData(const size_t blockIndex) const;
+
+		/**
+		 * Returns the elements of a specific block.
+		 * @param blockRow The index of the block row, with range [0, blockRows() - 1]
+		 * @param blockColumn The index of the block column, with range [0, blockColumns() - 1]
+		 * @return The block's elements (row-major), nullptr if the block is not stored
+		 */
+		const T* block(const size_t blockRow, const size_t blockColumn) const;
+
+		/**
+		 * Multiplies this matrix with a vector.
+		 * @param vector The vector to multiply, with columns() elements, must be valid
+		 * @param result The resulting vector, with rows() elements, must be valid and must not overlap with 'vector'
+		 * @param worker Optional worker object to distribute the computation
+		 */
+		void multiply(const T* vector, T* result, Worker* worker = nullptr) const;
+
+		/**
+		 * Multiplies this matrix with a dense matrix.
+		 * @param matrix The dense matrix to multiply, with columns() rows
+		 * @param result The resulting dense matrix, with rows() rows and matrix.columns() columns
+		 * @param worker Optional worker object to distribute the computation
+		 * @return True, if succeeded
+		 */
+		bool multiply(const MatrixT<T>& matrix, MatrixT<T>& result, Worker* worker = nullptr) const;
+
+		/**
+		 * Returns whether this matrix is symmetric, with both triangles stored explicitly.
+		 * @param epsilon The epsilon to be used when comparing elements, with range [0, infinity)
+		 * @return True, if so
+		 */
+		bool isSymmetric(const T epsilon = NumericT<T>::weakEps()) const;
+
+		/**
+		 * Returns a dense copy of this matrix.
+		 * @return The dense matrix
+		 */
+		MatrixT<T> denseMatrix() const;
+
+		/**
+		 * Returns whether this matrix holds at least one block row and one block column.
+		 * @return True, if so
+		 */
+		inline bool isValid() const;
+
+	protected:
+
+		/**
+		 * Multiplies a subset of block rows of this matrix with a vector.
+		 * @param vector The vector to multiply, must be valid
+		 * @param result The resulting vector, must be valid
+		 * @param firstBlockRow The first block row to be handled, with range [0, blockRows() - 1]
+		 * @param numberBlockRows The number of block rows to be handled, with range [1, blockRows() - firstBlockRow]
+		 */
+		void multiplySubset(const T* vector, T* result, const unsigned int firstBlockRow, const unsigned int numberBlockRows) const;
+
+		/**
+		 * Multiplies a subset of block rows of this matrix with a dense matrix.
+		 * @param matrix The dense matrix to multiply, must be valid
+		 * @param result The resulting dense matrix, must be valid
+		 * @param firstBlockRow The first block row to be handled, with range [0, blockRows() - 1]
+		 * @param numberBlockRows The number of block rows to be handled, with range [1, blockRows() - firstBlockRow]
+		 */
+		void multiplyMatrixSubset(const MatrixT<T>* matrix, MatrixT<T>* result, const unsigned int firstBlockRow, const unsigned int numberBlockRows) const;
+
+	protected:
+
+		/// The number of block rows.
+		size_t blockRows_ = 0;
+
+		/// The number of block columns.
+		size_t blockColumns_ = 0;
+
+		/// The offsets of the individual block rows, with blockRows_ + 1 elements.
+		Indices32 rowOffsets_;
+
+		/// The block column indices of all stored blocks.
+		Indices32 blockColumnIndices_;
+
+		/// The elements of all stored blocks, each block row-major.
+		std::vector<T> values_;
+};
+
+template <typename T, size_t tBlockSize>
+inline BlockSparseMatrixT<T, tBlockSize>::BlockEntry::BlockEntry(const size_t blockRow, const size_t blockColumn, const T* values) :
+	blockRow_(blockRow),
+	blockColumn_(blockColumn)
+{
+	ocean_assert(values != nullptr);
+
+	for (size_t n = 0; n < blockElements_; ++n)
+	{
+		values_[n] = values[n];
+	}
+}
+
+template <typename T, size_t tBlockSize>
+inline size_t BlockSparseMatrixT<T, tBlockSize>::BlockEntry::blockRow() const
+{
+	return blockRow_;
+}
+
+template <typename T, size_t tBlockSize>
+inline size_t BlockSparseMatrixT<T, tBlockSize>::BlockEntry::blockColumn() const
+{
+	return blockColumn_;
+}
+
+template <typename T, size_t tBlockSize>
+inline const T* BlockSparseMatrixT<T, tBlockSize>::BlockEntry::values() const
+{
+	return values_;
+}
+
+template <typename T, size_t tBlockSize>
+inline bool BlockSparseMatrixT<T, tBlockSize>::BlockEntry::isValid() const
+{
+	return blockRow_ != size_t(-1) && blockColumn_ != size_t(-1);
+}
+
+template <typename T, size_t tBlockSize>
+inline bool BlockSparseMatrixT<T, tBlockSize>::BlockEntry::operator<(const BlockEntry& right) const
+{
+	return blockRow_ < right.blockRow_ || (blockRow_ == right.blockRow_ && blockColumn_ < right.blockColumn_);
+}
+
+template <typename T, size_t tBlockSize>
+BlockSparseMatrixT<T, tBlockSize>::BlockSparseMatrixT(const size_t blockRows, const size_t blockColumns, BlockEntries entries) :
+	blockRows_(blockRows),
+	blockColumns_(blockColumns),
+	rowOffsets_(blockRows + 1, 0u)
+{
+	ocean_assert(blockRows_ >= 1 && blockColumns_ >= 1);
+	ocean_assert(blockColumns_ < size_t(NumericT<unsigned int>::maxValue()));
+
+	std::sort(entries.begin(), entries.end());
+
+	blockColumnIndices_.reserve(entries.size());
+	values_.reserve(entries.size() * blockElements_);
+
+	for (size_t n = 0; n < entries.size(); ++n)
+	{
+		const BlockEntry& entry = entries[n];
+
+		ocean_assert(entry.isValid());
+		ocean_assert(entry.blockRow() < blockRows_ && entry.blockColumn() < blockColumns_);
+
+		if (n != 0 && entries[n - 1].blockRow() == entry.blockRow() && entries[n - 1].blockColumn() == entry.blockColumn())
+		{
+			// we sum duplicated entries
+
+			T* const target = values_.data() + values_.size() - blockElements_;
+
+			for (size_t i = 0; i < blockElements_; ++i)
+			{
+				target[i] += entry.values()[i];
+			}
+
+			continue;
+		}
+
+		blockColumnIndices_.push_back((unsigned int)(entry.blockColumn()));
+		values_.insert(values_.end(), entry.values(), entry.values() + blockElements_);
+
+		++rowOffsets_[entry.blockRow() + 1];
+	}
+
+	for (size_t r = 0; r < blockRows_; ++r)
+	{
+		rowOffsets_[r + 1] += rowOffsets_[r];
+	}
+
+	ocean_assert(size_t(rowOffsets_.back()) == blockColumnIndices_.size());
+}
+
+template <typename T, size_t tBlockSize>
+inline size_t BlockSparseMatrixT<T, tBlockSize>::rows() const
+{
+	return blockRows_ * tBlockSize;
+}
+
+template <typename T, size_t tBlockSize>
+inline size_t BlockSparseMatrixT<T, tBlockSize>::columns() const
+{
+	return blockColumns_ * tBlockSize;
+}
+
+template <typename T, size_t tBlockSize>
+inline size_t BlockSparseMatrixT<T, tBlockSize>::blockRows() const
+{
+	return blockRows_;
+}
+
+template <typename T, size_t tBlockSize>
+inline size_t BlockSparseMatrixT<T, tBlockSize>::blockColumns() const
+{
+	return blockColumns_;
+}
+
+template <typename T, size_t tBlockSize>
+inline size_t BlockSparseMatrixT<T, tBlockSize>::nonZeroBlocks() const
+{
+	return blockColumnIndices_.size();
+}
+
+template <typename T, size_t tBlockSize>
+inline const Indices32& BlockSparseMatrixT<T, tBlockSize>::rowOffsets() const
+{
+	return rowOffsets_;
+}
+
+template <typename T, size_t tBlockSize>
+inline const Indices32& BlockSparseMatrixT<T, tBlockSize>::blockColumnIndices() const
+{
+	return blockColumnIndices_;
+}
+
+template <typename T, size_t tBlockSize>
+inline const T* BlockSparseMatrixT<T, tBlockSize>::blockData(const size_t blockIndex) const
+{
+	ocean_assert(blockIndex < nonZeroBlocks());
+
+	return values_.data() + blockIndex * blockElements_;
+}
+
+template <typename T, size_t tBlockSize>
+const T* BlockSparseMatrixT<T, tBlockSize>::block(const size_t blockRow, const size_t blockColumn) const
+{
+	ocean_assert(blockRow < blockRows_ && blockColumn < blockColumns_);
+
+	const Indices32::const_iterator rowBegin = blockColumnIndices_.cbegin() + rowOffsets_[blockRow];
+	const Indices32::const_iterator rowEnd = blockColumnIndices_.cbegin() + rowOffsets_[blockRow + 1];
+
+	const Indices32::const_iterator i = std::lower_bound(rowBegin, rowEnd, (unsigned int)(blockColumn));
+
+	if (i == rowEnd || *i != (unsigned int)(blockColumn))
+	{
+		return nullptr;
+	}
+
+	return blockData(size_t(i - blockColumnIndices_.cbegin()));
+}
+
+template <typename T, size_t tBlockSize>
+void BlockSparseMatrixT<T, tBlockSize>::multiply(const T* vector, T* result, Worker* worker) const
+{
+	ocean_assert(isValid());
+	ocean_assert(vector != nullptr && result != nullptr);
+	ocean_assert(vector != result);
+
+	if (worker != nullptr && blockRows_ >= 64)
+	{
+		worker->executeFunction(Worker::Function::create(*this, &BlockSparseMatrixT<T, tBlockSize>::multiplySubset, vector, result, 0u, 0u), 0u, (unsigned int)(blockRows_), 2u, 3u, 16u);
+	}
+	else
+	{
+		multiplySubset(vector, result, 0u, (unsigned int)(blockRows_));
+	}
+}
+
+template <typename T, size_t tBlockSize>
+bool BlockSparseMatrixT<T, tBlockSize>::multiply(const MatrixT<T>& matrix, MatrixT<T>& result, Worker* worker) const
+{
+	ocean_assert(isValid());
+
+	if (matrix.rows() != columns() || matrix.columns() == 0)
+	{
+		ocean_assert(false && "Invalid matrix!");
+		return false;
+	}
+
+	ocean_assert(&matrix != &result);
+
+	result = MatrixT<T>(rows(), matrix.columns(), false);
+
+	if (worker != nullptr && blockRows_ >= 16)
+	{
+		worker->executeFunction(Worker::Function::create(*this, &BlockSparseMatrixT<T, tBlockSize>::multiplyMatrixSubset, &matrix, &result, 0u, 0u), 0u, (unsigned int)(blockRows_), 2u, 3u, 4u);
+	}
+	else
+	{
+		multiplyMatrixSubset(&matrix, &result, 0u, (unsigned int)(blockRows_));
+	}
+
+	return true;
+}
+
+template <typename T, size_t tBlockSize>
+bool BlockSparseMatrixT<T, tBlockSize>::isSymmetric(const T epsilon) const
+{
+	ocean_assert(epsilon >= T(0));
+
+	if (blockRows_ != blockColumns_)
+	{
+		return false;
+	}
+
+	for (size_t blockRow = 0; blockRow < blockRows_; ++blockRow)
+	{
+		for (size_t n = size_t(rowOffsets_[blockRow]); n < size_t(rowOffsets_[blockRow + 1]); ++n)
+		{
+			const T* const transposedBlock = block(size_t(blockColumnIndices_[n]), blockRow);
+
+			if (transposedBlock == nullptr)
+			{
+				return false;
+			}
+
+			const T* const values = blockData(n);
+
+			for (size_t r = 0; r < tBlockSize; ++r)
+			{
+				for (size_t c = 0; c < tBlockSize; ++c)
+				{
+					if (NumericT<T>::isNotEqual(values[r * tBlockSize + c], transposedBlock[c * tBlockSize + r], epsilon))
+					{
+						return false;
+					}
+				}
+			}
+		}
+	}
+
+	return true;
+}
+
+template <typename T, size_t tBlockSize>
+MatrixT<T> BlockSparseMatrixT<T, tBlockSize>::denseMatrix() const
+{
+	MatrixT<T> result(rows(), columns(), false);
+
+	for (size_t blockRow = 0; blockRow < blockRows_; ++blockRow)
+	{
+		for (size_t n = size_t(rowOffsets_[blockRow]); n < size_t(rowOffsets_[blockRow + 1]); ++n)
+		{
+			const size_t blockColumn = size_t(blockColumnIndices_[n]);
+			const T* const values = blockData(n);
+
+			for (size_t r = 0; r < tBlockSize; ++r)
+			{
+				for (size_t c = 0; c < tBlockSize; ++c)
+				{
+					result(blockRow * tBlockSize + r, blockColumn * tBlockSize + c) = values[r * tBlockSize + c];
+				}
+			}
+		}
+	}
+
+	return result;
+}
+
+template <typename T, size_t tBlockSize>
+inline bool BlockSparseMatrixT<T, tBlockSize>::isValid() const
+{
+	return blockRows_ != 0 && blockColumns_ != 0 && rowOffsets_.size() == blockRows_ + 1;
+}
+
+template <typename T, size_t tBlockSize>
+void BlockSparseMatrixT<T, tBlockSize>::multiplySubset(const T* vector, T* result, const unsigned int firstBlockRow, const unsigned int numberBlockRows) const
+{
+	ocean_assert(vector != nullptr && result != nullptr);
+	ocean_assert(size_t(firstBlockRow + numberBlockRows) <= blockRows_);
+
+	for (size_t blockRow = size_t(firstBlockRow); blockRow < size_t(firstBlockRow + numberBlockRows); ++blockRow)
+	{
+		T sums[tBlockSize] = {};
+
+		for (size_t n = size_t(rowOffsets_[blockRow]); n < size_t(rowOffsets_[blockRow + 1]); ++n)
+		{
+			const T* const values = blockData(n);
+			const T* const subVector = vector + size_t(blockColumnIndices_[n]) * tBlockSize;
+
+			for (size_t r = 0; r < tBlockSize; ++r)
+			{
+				for (size_t c = 0; c < tBlockSize; ++c)
+				{
+					sums[r] += values[r * tBlockSize + c] * subVector[c];
+				}
+			}
+		}
+
+		T* const subResult = result + blockRow * tBlockSize;
+
+		for (size_t r = 0; r < tBlockSize; ++r)
+		{
+			subResult[r] = sums[r];
+		}
+	}
+}
+
+template <typename T, size_t tBlockSize>
+void BlockSparseMatrixT<T, tBlockSize>::multiplyMatrixSubset(const MatrixT<T>* matrix, MatrixT<T>* result, const unsigned int firstBlockRow, const unsigned int numberBlockRows) const
+{
+	ocean_assert(matrix != nullptr && result != nullptr);
+	ocean_assert(size_t(firstBlockRow + numberBlockRows) <= blockRows_);
+
+	const size_t resultColumns = matrix->columns();
+
+	for (size_t blockRow = size_t(firstBlockRow); blockRow < size_t(firstBlockRow + numberBlockRows); ++blockRow)
+	{
+		for (size_t n = size_t(rowOffsets_[blockRow]); n < size_t(rowOffsets_[blockRow + 1]); ++n)
+		{
+			const T* const values = blockData(n);
+			const size_t blockColumn = size_t(blockColumnIndices_[n]);
+
+			for (size_t r = 0; r < tBlockSize; ++r)
+			{
+				T* const resultRow = (*result)[blockRow * tBlockSize + r];
+
+				for (size_t c = 0; c < tBlockSize; ++c)
+				{
+					const T value = values[r * tBlockSize + c];
+					const T* const matrixRow = (*matrix)[blockColumn * tBlockSize + c];
+
+					for (size_t i = 0; i < resultColumns; ++i)
+					{
+						resultRow[i] += value * matrixRow[i];
+					}
+				}
+			}
+		}
+	}
+}
+
+}
+
+#endif // META_OCEAN_MATH_BLOCK_SPARSE_MATRIX_H
@@ -9,6 +9,7 @@
 #define META_OCEAN_MATH_CLUSTERING_K_MEANS_H
 
 #include "ocean/math/Math.h"
+#include "ocean/math/Random.h"
 
 #include "ocean/base/RandomI.h"
 #include "ocean/base/StaticBuffer.h"
@@ -278,7 +279,9 @@ class ClusteringKMeans : public Clustering<tUseIndices>
 			/// The first cluster is determined by selection of the (euclidean) smallest observation, the remaining clusters are defined by observations with largest distance to the already existing clusters.
 			IS_LARGEST_DISTANCE,
 			/// All clusters are selected randomly.
-			IS_RANDOM
+			IS_RANDOM,
+			/// The first cluster is selected randomly, the remaining clusters are selected randomly with a probability proportional to the square distance to the nearest existing cluster (k-means++ seeding).
+			IS_PLUS_PLUS
 		};
 
 		/**
@@ -471,6 +474,20 @@ class ClusteringKMeans : public Clustering<tUseIndices>
 		 */
 		void determineClustersByNumber(const size_t numberClusters, const InitializationStrategy strategy = IS_LARGEST_DISTANCE, const size_t iterations = 5, Worker* worker = nullptr);
 
+		/**
+		 * Determines the clusters for this object with mini-batch k-means, ensure that this object has been initialized with a valid set of observations.
+		 * Each iteration assigns a small random subset of the observations (a mini-batch) to the clusters and moves each cluster mean towards the assigned observations with a per-cluster learning rate of 1 / (number of observations assigned so far).<br>
+		 * Thus, the costs of one iteration depend on the size of the mini-batch only, instead of on the number of observations; the clusters converge to a slightly worse clustering than with full iterations.<br>
+		 * Finally, all observations are assigned to the resulting clusters once.
+		 * @param numberClusters The number of clusters that will be created, with range [1, numberObservations())
+		 * @param batchSize The number of observations in each mini-batch, with range [1, infinity)
+		 * @param batchIterations The number of mini-batch iterations, with range [1, infinity)
+		 * @param strategy The initialization strategy for the first clusters
+		 * @param worker Optional worker object to distribute the computation
+		 * @see clusters(), determineClustersByNumber().
+		 */
+		void determineClustersMiniBatch(const size_t numberClusters, const size_t batchSize, const size_t batchIterations, const InitializationStrategy strategy = IS_PLUS_PLUS, Worker* worker = nullptr);
+
 		/**
 		 * Determines the clusters for this object, ensure that this object has been initialized with a valid set of observations.
 		 * This function adds new clusters within several iterations until the defined maximalSqrDistance is larger than the distance within all clusters or until the defined maximal number of clusters is reached.<br>
@@ -563,6 +580,22 @@ class ClusteringKMeans : public Clustering<tUseIndices>
 		 */
 		void determineInitialClustersRandom(const size_t numberClusters);
 
+		/**
+		 * Determines the initial clusters for this object with the IS_PLUS_PLUS strategy.
+		 * The first cluster is selected randomly, each further cluster is selected randomly with a probability proportional to the square distance to the nearest existing cluster.
+		 * @param numberClusters The number of initial clusters that will be created.
+		 * @param worker Optional worker object to distribute the computation
+		 */
+		void determineInitialClustersPlusPlus(const size_t numberClusters, Worker* worker);
+
+		/**
+		 * Determines the initial clusters for this object with a specified strategy.
+		 * @param numberClusters The number of initial clusters that will be created.
+		 * @param strategy The initialization strategy to be used
+		 * @param worker Optional worker object to distribute the computation
+		 */
+		void determineInitialClusters(const size_t numberClusters, const InitializationStrategy strategy, Worker* worker);
+
 		/**
 		 * Explicitly applies one further optimization iteration for an existing set of clusters.
 		 * This functions operates on a subset of all observations.<br>
@@ -573,6 +606,24 @@ class ClusteringKMeans : public Clustering<tUseIndices>
 		 */
 		void applyOptimizationIterationSubset(Lock* lock, const unsigned int firstObservation, const unsigned int numberObservations);
 
+		/**
+		 * Updates the square distances between a subset of all observations and their nearest clusters for a new cluster.
+		 * @param cluster The index of the new cluster, with range [0, clusters_.size())
+		 * @param sqrDistances The square distances between all observations and their nearest clusters, will be updated, must be valid
+		 * @param firstObservation The first observation that will be handled
+		 * @param numberObservations The number of observations that will be handled
+		 */
+		void updateSqrDistancesSubset(const size_t cluster, TSquareDistance* sqrDistances, const unsigned int firstObservation, const unsigned int numberObservations) const;
+
+		/**
+		 * Determines the best fitting clusters for a subset of observations without changing the clusters.
+		 * @param dataIndices The data indices of the observations, must be valid
+		 * @param bestClusters The resulting indices of the best fitting clusters, one for each data index, must be valid
+		 * @param firstIndex The first data index that will be handled
+		 * @param numberIndices The number of data indices that will be handled
+		 */
+		void findClustersSubset(const DataIndex* dataIndices, size_t* bestClusters, const unsigned int firstIndex, const unsigned int numberIndices) const;
+
 		/**
 		 * Determines the smallest observation (euclidean distance to origin) from a set of observations.
 		 * @param data The observation data in which the smallest observation is determined, must be valid
@@ -985,15 +1036,7 @@ void ClusteringKMeans<T, tDimension, TSum, TSquareDistance, tUseIndices>::determ
 {
 	ocean_assert(clusters_.empty());
 
-	if (strategy == IS_LARGEST_DISTANCE)
-	{
-		determineInitialClustersLargestDistance(numberClusters);
-	}
-	else
-	{
-		ocean_assert(strategy == IS_RANDOM);
-		determineInitialClustersRandom(numberClusters);
-	}
+	determineInitialClusters(numberClusters, strategy, worker);
 
 	ocean_assert(iterations >= 1);
 	applyOptimizationIteration(worker);
@@ -1004,6 +1047,76 @@ void ClusteringKMeans<T, tDimension, TSum, TSquareDistance, tUseIndices>::determ
 	}
 }
 
+template <typename T, size_t tDimension, typename TSum, typename TSquareDistance, bool tUseIndices>
+void ClusteringKMeans<T, tDimension, TSum, TSquareDistance, tUseIndices>::determineClustersMiniBatch(const size_t numberClusters, const size_t batchSize, const size_t batchIterations, const InitializationStrategy strategy, Worker* worker)
+{
+	ocean_assert(data_);
+	ocean_assert(clusters_.empty());
+	ocean_assert(batchSize >= 1 && batchIterations >= 1);
+
+	determineInitialClusters(numberClusters, strategy, worker);
+
+	const bool random64 = data_.numberObservations() > NumericT<unsigned int>::maxValue();
+
+	// the cluster means are the running averages of all observations which have been assigned to the clusters so far,
+	// which is identical to a gradient step with learning rate 1 / count for each assigned observation
+
+	std::vector<StaticBuffer<TSum, tDimension>> sumObservations(clusters_.size(), StaticBuffer<TSum, tDimension>(tDimension, TSum()));
+	std::vector<size_t> clusterCounts(clusters_.size(), 0);
+
+	std::vector<DataIndex> batchIndices(batchSize);
+	std::vector<size_t> batchClusters(batchSize);
+
+	for (size_t nIteration = 0; nIteration < batchIterations; ++nIteration)
+	{
+		for (DataIndex& batchIndex : batchIndices)
+		{
+			batchIndex = random64 ? DataIndex(RandomI::random64() % data_.numberObservations()) : DataIndex(RandomI::random32() % (unsigned int)data_.numberObservations());
+		}
+
+		if (worker != nullptr)
+		{
+			worker->executeFunction(Worker::Function::create(*this, &ClusteringKMeans<T, tDimension, TSum, TSquareDistance, tUseIndices>::findClustersSubset, (const DataIndex*)(batchIndices.data()), batchClusters.data(), 0u, 0u), 0u, (unsigned int)batchSize, 2u, 3u);
+		}
+		else
+		{
+			findClustersSubset(batchIndices.data(), batchClusters.data(), 0u, (unsigned int)batchSize);
+		}
+
+		for (size_t n = 0; n < batchSize; ++n)
+		{
+			const size_t cluster = batchClusters[n];
+			ocean_assert(cluster < clusters_.size());
+
+			const Observation& observation = data_[batchIndices[n]];
+
+			for (size_t d = 0; d < tDimension; ++d)
+			{
+				sumObservations[cluster][d] += observation[d];
+			}
+
+			++clusterCounts[cluster];
+		}
+
+		for (size_t c = 0; c < clusters_.size(); ++c)
+		{
+			if (clusterCounts[c] != 0)
+			{
+				const TSum count = TSum(clusterCounts[c]);
+
+				for (size_t d = 0; d < tDimension; ++d)
+				{
+					clusters_[c].mean_[d] = T(sumObservations[c][d] / count);
+				}
+			}
+		}
+	}
+
+	// finally, all observations are assigned to the clusters
+
+	applyOptimizationIteration(worker);
+}
+
 template <typename T, size_t tDimension, typename TSum, typename TSquareDistance, bool tUseIndices>
 void ClusteringKMeans<T, tDimension, TSum, TSquareDistance, tUseIndices>::determineClustersByDistance(const TSquareDistance maximalSqrDistance, size_t maximalClusters, size_t iterations, Worker* worker)
 {
@@ -1285,6 +1398,100 @@ void ClusteringKMeans<T, tDimension, TSum, TSquareDistance, tUseIndices>::determ
 	}
 }
 
+template <typename T, size_t tDimension, typename TSum, typename TSquareDistance, bool tUseIndices>
+void ClusteringKMeans<T, tDimension, TSum, TSquareDistance, tUseIndices>::determineInitialClustersPlusPlus(const size_t numberClusters, Worker* worker)
+{
+	ocean_assert(data_.numberObservations() != 0);
+	ocean_assert(clusters_.empty());
+
+	const bool random64 = data_.numberObservations() > NumericT<unsigned int>::maxValue();
+
+	const size_t firstDataIndex = random64 ? size_t(RandomI::random64() % data_.numberObservations()) : size_t(RandomI::random32() % (unsigned int)data_.numberObservations());
+
+	clusters_.push_back(Cluster(*this, data_[firstDataIndex]));
+
+	// the square distance between each observation and the nearest cluster
+
+	std::vector<TSquareDistance> sqrDistances(data_.numberObservations(), NumericT<TSquareDistance>::maxValue());
+
+	while (clusters_.size() < numberClusters)
+	{
+		if (worker != nullptr)
+		{
+			worker->executeFunction(Worker::Function::create(*this, &ClusteringKMeans<T, tDimension, TSum, TSquareDistance, tUseIndices>::updateSqrDistancesSubset, clusters_.size() - 1, sqrDistances.data(), 0u, 0u), 0u, (unsigned int)data_.numberObservations(), 2u, 3u);
+		}
+		else
+		{
+			updateSqrDistancesSubset(clusters_.size() - 1, sqrDistances.data(), 0u, (unsigned int)data_.numberObservations());
+		}
+
+		double sumSqrDistances = 0.0;
+
+		for (const TSquareDistance& sqrDistance : sqrDistances)
+		{
+			sumSqrDistances += double(sqrDistance);
+		}
+
+		// check whether all observations are identical to existing clusters
+		if (sumSqrDistances <= 0.0)
+		{
+			break;
+		}
+
+		const double randomSqrDistance = RandomD::scalar(0.0, sumSqrDistances);
+
+		size_t selectedIndex = size_t(-1);
+		double accumulatedSqrDistances = 0.0;
+
+		for (size_t o = 0; o < sqrDistances.size(); ++o)
+		{
+			if (sqrDistances[o] > TSquareDistance(0))
+			{
+				selectedIndex = o;
+
+				accumulatedSqrDistances += double(sqrDistances[o]);
+
+				if (accumulatedSqrDistances >= randomSqrDistance)
+				{
+					break;
+				}
+			}
+		}
+
+		ocean_assert(selectedIndex != size_t(-1));
+
+		clusters_.push_back(Cluster(*this, data_[selectedIndex]));
+	}
+
+	ocean_assert(!clusters_.empty());
+
+	for (size_t c = 0; c < clusters_.size(); ++c)
+	{
+		ocean_assert(clusters_[c].dataIndices().empty());
+		clusters_[c].dataIndices().reserve(data_.numberObservations() * 2 / clusters_.size());
+	}
+}
+
+template <typename T, size_t tDimension, typename TSum, typename TSquareDistance, bool tUseIndices>
+void ClusteringKMeans<T, tDimension, TSum, TSquareDistance, tUseIndices>::determineInitialClusters(const size_t numberClusters, const InitializationStrategy strategy, Worker* worker)
+{
+	switch (strategy)
+	{
+		case IS_LARGEST_DISTANCE:
+			determineInitialClustersLargestDistance(numberClusters);
+			break;
+
+		case IS_RANDOM:
+			determineInitialClustersRandom(numberClusters);
+			break;
+
+		default:
+			ocean_assert(strategy == IS_PLUS_PLUS);
+			determineInitialClustersPlusPlus(numberClusters, worker);
+			break;
+	}
+}
+
 template <typename T, size_t tDimension, typename TSum, typename TSquareDistance, bool tUseIndices>
 void ClusteringKMeans<T, tDimension, TSum, TSquareDistance, tUseIndices>::applyOptimizationIteration()
 {
@@ -1394,6 +1601,50 @@ void ClusteringKMeans<T, tDimension, TSum, TSquareDistance, tUseIndices>::applyO
 	}
 }
 
+template <typename T, size_t tDimension, typename TSum, typename TSquareDistance, bool tUseIndices>
+void ClusteringKMeans<T, tDimension, TSum, TSquareDistance, tUseIndices>::updateSqrDistancesSubset(const size_t cluster, TSquareDistance* sqrDistances, const unsigned int firstObservation, const unsigned int numberObservations) const
+{
+	ocean_assert(cluster < clusters_.size());
+	ocean_assert(sqrDistances != nullptr);
+
+	const Cluster& newCluster = clusters_[cluster];
+
+	for (size_t o = firstObservation; o < firstObservation + numberObservations; ++o)
+	{
+		sqrDistances[o] = min(sqrDistances[o], newCluster.sqrDistance(data_[o]));
+	}
+}
+
+template <typename T, size_t tDimension, typename TSum, typename TSquareDistance, bool tUseIndices>
+void ClusteringKMeans<T, tDimension, TSum, TSquareDistance, tUseIndices>::findClustersSubset(const DataIndex* dataIndices, size_t* bestClusters, const unsigned int firstIndex, const unsigned int numberIndices) const
+{
+	ocean_assert(!clusters_.empty());
+	ocean_assert(dataIndices != nullptr && bestClusters != nullptr);
+
+	for (size_t n = firstIndex; n < firstIndex + numberIndices; ++n)
+	{
+		const Observation& observation = data_[dataIndices[n]];
+
+		TSquareDistance bestDistance = NumericT<TSquareDistance>::maxValue();
+		size_t bestCluster = size_t(-1);
+
+		for (size_t c = 0; c < clusters_.size(); ++c)
+		{
+			const TSquareDistance localDistance = clusters_[c].sqrDistance(observation);
+
+			if (localDistance < bestDistance)
+			{
+				bestDistance = localDistance;
+				bestCluster = c;
+			}
+		}
+
+		ocean_assert(bestCluster != size_t(-1));
+
+		bestClusters[n] = bestCluster;
+	}
+}
+
 template <typename T, size_t tDimension, typename TSum, typename TSquareDistance, bool tUseIndices>
 void ClusteringKMeans<T, tDimension, TSum, TSquareDistance, tUseIndices>::clear()
 {
@@ -29,6 +29,8 @@
  */
 
 #include "ocean/base/Frame.h"
+#include "ocean/base/Lock.h"
+#include "ocean/base/Utilities.h"
 
 #include "ocean/math/FourierTransformation.h"
 #include "ocean/math/Numeric.h"
@@ -36,6 +38,8 @@
 #include <cmath>
 #include <complex>
 #include <map>
+#include <memory>
+#include <unordered_map>
 
 namespace
 {
@@ -2356,6 +2360,576 @@ void FourierTransformation::frequencyToComplexSpatial2(const T* complexFrequency
 	dft(sourceFrame, targetFrame, DFT_SCALE | DFT_COMPLEX_OUTPUT | DFT_INVERSE, 0);
 }
 
+template <typename T>
+FourierTransformation::FastTransformationPlan<T>::FastTransformationPlan(const unsigned int size) :
+	twiddles_(size)
+{
+	ocean_assert(size >= 1u && Utilities::isPowerOfTwo(size));
+
+	for (unsigned int k = 0u; k < size; ++k)
+	{
+		// the twiddle factors are determined with double precision to avoid accumulated rounding errors for float plans
+
+		const double angle = -NumericD::pi2() * double(k) / double(size);
+
+		twiddles_[k] = std::complex<T>(T(NumericD::cos(angle)), T(NumericD::sin(angle)));
+	}
+}
+
+template <typename T>
+const FourierTransformation::FastTransformationPlan<T>& FourierTransformation::FastTransformationPlan<T>::get(const unsigned int size)
+{
+	ocean_assert(size >= 1u && Utilities::isPowerOfTwo(size));
+
+	static Lock lock;
+	static std::unordered_map<unsigned int, std::unique_ptr<FastTransformationPlan<T>>> planMap;
+
+	const ScopedLock scopedLock(lock);
+
+	std::unique_ptr<FastTransformationPlan<T>>& plan = planMap[size];
+
+	if (!plan)
+	{
+		plan = std::make_unique<FastTransformationPlan<T>>(size);
+	}
+
+	return *plan;
+}
+
+template <typename T>
+bool FourierTransformation::spatialToHalfFrequency2(const T* spatial, const unsigned int width, const unsigned int height, T* complexHalfFrequency, const unsigned int spatialPaddingElements, const unsigned int frequencyPaddingElements, Worker* worker)
+{
+	static_assert(std::is_same<T, float>::value || std::is_same<T, double>::value, "Invalid data type!");
+
+	ocean_assert(spatial != nullptr && complexHalfFrequency != nullptr);
+
+	if (width < 2u || height == 0u || !Utilities::isPowerOfTwo(width) || !Utilities::isPowerOfTwo(height))
+	{
+		return false;
+	}
+
+	const unsigned int halfWidth = width / 2u + 1u;
+
+	const unsigned int spatialStrideElements = width + spatialPaddingElements;
+	const unsigned int frequencyStrideElements = halfWidth * 2u + frequencyPaddingElements;
+
+	// creating the plans in advance so that the threads of the worker do not need to wait for each other
+
+	FastTransformationPlan<T>::get(width);
+	FastTransformationPlan<T>::get(height);
+
+	if (worker != nullptr && height >= 16u)
+	{
+		worker->executeFunction(Worker::Function::createStatic(&FourierTransformation::spatialToHalfFrequencyRowsSubset<T>, spatial, width, spatialStrideElements, complexHalfFrequency, frequencyStrideElements, 0u, 0u), 0u, height);
+	}
+	else
+	{
+		spatialToHalfFrequencyRowsSubset<T>(spatial, width, spatialStrideElements, complexHalfFrequency, frequencyStrideElements, 0u, height);
+	}
+
+	if (height >= 2u)
+	{
+		if (worker != nullptr && halfWidth >= 16u)
+		{
+			worker->executeFunction(Worker::Function::createStatic(&FourierTransformation::complexColumnsSubset<T>, complexHalfFrequency, height, frequencyStrideElements, false, 0u, 0u), 0u, halfWidth);
+		}
+		else
+		{
+			complexColumnsSubset<T>(complexHalfFrequency, height, frequencyStrideElements, false, 0u, halfWidth);
+		}
+	}
+
+	return true;
+}
+
+template <typename T>
+bool FourierTransformation::halfFrequencyToSpatial2(const T* complexHalfFrequency, const unsigned int width, const unsigned int height, T* spatial, const unsigned int frequencyPaddingElements, const unsigned int spatialPaddingElements, Worker* worker)
+{
+	static_assert(std::is_same<T, float>::value || std::is_same<T, double>::value, "Invalid data type!");
+
+	ocean_assert(complexHalfFrequency != nullptr && spatial != nullptr);
+
+	if (width < 2u || height == 0u || !Utilities::isPowerOfTwo(width) || !Utilities::isPowerOfTwo(height))
+	{
+		return false;
+	}
+
+	const unsigned int halfWidth = width / 2u + 1u;
+
+	const unsigned int spatialStrideElements = width + spatialPaddingElements;
+	const unsigned int frequencyStrideElements = halfWidth * 2u + frequencyPaddingElements;
+
+	FastTransformationPlan<T>::get(width);
+	FastTransformationPlan<T>::get(height);
+
+	// the real row signal with `width` elements is determined via a complex transformation with `width / 2` elements
+
+	const T scale = T(2) / T(width * height);
+
+	// the columns are transformed in place, so that we need an intermediate copy of the (const) frequency analysis
+
+	const unsigned int intermediateStrideElements = halfWidth * 2u;
+
+	std::vector<T> intermediate(size_t(intermediateStrideElements) * size_t(height));
+
+	for (unsigned int y = 0u; y < height; ++y)
+	{
+		memcpy(intermediate.data() + size_t(y) * size_t(intermediateStrideElements), complexHalfFrequency + size_t(y) * size_t(frequencyStrideElements), sizeof(T) * intermediateStrideElements);
+	}
+
+	if (height >= 2u)
+	{
+		if (worker != nullptr && halfWidth >= 16u)
+		{
+			worker->executeFunction(Worker::Function::createStatic(&FourierTransformation::complexColumnsSubset<T>, intermediate.data(), height, intermediateStrideElements, true, 0u, 0u), 0u, halfWidth);
+		}
+		else
+		{
+			complexColumnsSubset<T>(intermediate.data(), height, intermediateStrideElements, true, 0u, halfWidth);
+		}
+	}
+
+	if (worker != nullptr && height >= 16u)
+	{
+		worker->executeFunction(Worker::Function::createStatic(&FourierTransformation::halfFrequencyToSpatialRowsSubset<T>, (const T*)(intermediate.data()), width, intermediateStrideElements, spatial, spatialStrideElements, scale, 0u, 0u), 0u, height);
+	}
+	else
+	{
+		halfFrequencyToSpatialRowsSubset<T>(intermediate.data(), width, intermediateStrideElements, spatial, spatialStrideElements, scale, 0u, height);
+	}
+
+	return true;
+}
+
+template <typename T>
+void FourierTransformation::fastTransformation(std::complex<T>* data, std::complex<T>* buffer, const unsigned int size, const std::complex<T>* twiddles, const unsigned int twiddleStride, const unsigned int signals)
+{
+	ocean_assert(data != nullptr && buffer != nullptr && twiddles != nullptr);
+	ocean_assert(size >= 1u && Utilities::isPowerOfTwo(size));
+	ocean_assert(twiddleStride >= 1u && signals >= 1u);
+
+	// Stockham auto-sort algorithm with radix-4 stages, and one final radix-2 stage for odd powers of two
+	// each stage reads from 'source' and writes to 'target', interleaved signals are handled as if they were already separated by previous stages
+
+	std::complex<T>* source = data;
+	std::complex<T>* target = buffer;
+
+	unsigned int n = size;
+	unsigned int s = signals;
+
+	while (n >= 4u)
+	{
+		const unsigned int n1 = n / 4u;
+		const unsigned int n2 = n / 2u;
+		const unsigned int n3 = n1 + n2;
+
+		const unsigned int twiddleStep = (size / n) * twiddleStride;
+
+		for (unsigned int p = 0u; p < n1; ++p)
+		{
+			const std::complex<T>* const a = source + s * p;
+
+			std::complex<T>* const y = target + s * 4u * p;
+
+			butterfliesRadix4<T>(a, a + s * n1, a + s * n2, a + s * n3, y, twiddles[p * twiddleStep], twiddles[2u * p * twiddleStep], twiddles[3u * p * twiddleStep], s);
+		}
+
+		n /= 4u;
+		s *= 4u;
+
+		std::swap(source, target);
+	}
+
+	if (n == 2u)
+	{
+		butterfliesRadix2<T>(source, data, s);
+	}
+	else if (source != data)
+	{
+		ocean_assert(n == 1u);
+
+		memcpy(data, source, sizeof(std::complex<T>) * size * signals);
+	}
+}
+
+template <typename T>
+void FourierTransformation::butterfliesRadix4(const std::complex<T>* a, const std::complex<T>* b, const std::complex<T>* c, const std::complex<T>* d, std::complex<T>* y, const std::complex<T>& w1, const std::complex<T>& w2, const std::complex<T>& w3, const unsigned int elements)
+{
+	ocean_assert(a != nullptr && b != nullptr && c != nullptr && d != nullptr && y != nullptr);
+
+	unsigned int q = 0u;
+
+#if defined(OCEAN_HARDWARE_SSE_VERSION) && OCEAN_HARDWARE_SSE_VERSION >= 30
+
+	if constexpr (std::is_same<T, float>::value)
+	{
+		// two complex values in one register, [r0 i0 r1 i1]
+
+		const __m128 w1Real_32x4 = _mm_set1_ps(w1.real());
+		const __m128 w1Imag_32x4 = _mm_set1_ps(w1.imag());
+		const __m128 w2Real_32x4 = _mm_set1_ps(w2.real());
+		const __m128 w2Imag_32x4 = _mm_set1_ps(w2.imag());
+		const __m128 w3Real_32x4 = _mm_set1_ps(w3.real());
+		const __m128 w3Imag_32x4 = _mm_set1_ps(w3.imag());
+
+		const __m128 negateReal_32x4 = _mm_set_ps(0.0f, -0.0f, 0.0f, -0.0f);
+
+		for (; q + 2u <= elements; q += 2u)
+		{
+			const __m128 a_32x4 = _mm_loadu_ps((const float*)(a + q));
+			const __m128 b_32x4 = _mm_loadu_ps((const float*)(b + q));
+			const __m128 c_32x4 = _mm_loadu_ps((const float*)(c + q));
+			const __m128 d_32x4 = _mm_loadu_ps((const float*)(d + q));
+
+			const __m128 apc_32x4 = _mm_add_ps(a_32x4, c_32x4);
+			const __m128 amc_32x4 = _mm_sub_ps(a_32x4, c_32x4);
+			const __m128 bpd_32x4 = _mm_add_ps(b_32x4, d_32x4);
+			const __m128 bmd_32x4 = _mm_sub_ps(b_32x4, d_32x4);
+
+			// i * (b - d) = [-imag, real]
+			const __m128 jbmd_32x4 = _mm_xor_ps(_mm_shuffle_ps(bmd_32x4, bmd_32x4, _MM_SHUFFLE(2, 3, 0, 1)), negateReal_32x4);
+
+			const __m128 t1_32x4 = _mm_sub_ps(amc_32x4, jbmd_32x4);
+			const __m128 t2_32x4 = _mm_sub_ps(apc_32x4, bpd_32x4);
+			const __m128 t3_32x4 = _mm_add_ps(amc_32x4, jbmd_32x4);
+
+			// (r + i * m) * (wr + i * wi) = [r * wr - m * wi, m * wr + r * wi]
+			const __m128 y1_32x4 = _mm_addsub_ps(_mm_mul_ps(t1_32x4, w1Real_32x4), _mm_mul_ps(_mm_shuffle_ps(t1_32x4, t1_32x4, _MM_SHUFFLE(2, 3, 0, 1)), w1Imag_32x4));
+			const __m128 y2_32x4 = _mm_addsub_ps(_mm_mul_ps(t2_32x4, w2Real_32x4), _mm_mul_ps(_mm_shuffle_ps(t2_32x4, t2_32x4, _MM_SHUFFLE(2, 3, 0, 1)), w2Imag_32x4));
+			const __m128 y3_32x4 = _mm_addsub_ps(_mm_mul_ps(t3_32x4, w3Real_32x4), _mm_mul_ps(_mm_shuffle_ps(t3_32x4, t3_32x4, _MM_SHUFFLE(2, 3, 0, 1)), w3Imag_32x4));
+
+			_mm_storeu_ps((float*)(y + q), _mm_add_ps(apc_32x4, bpd_32x4));
+			_mm_storeu_ps((float*)(y + elements + q), y1_32x4);
+			_mm_storeu_ps((float*)(y + elements * 2u + q), y2_32x4);
+			_mm_storeu_ps((float*)(y + elements * 3u + q), y3_32x4);
+		}
+	}
+	else
+	{
+		// one complex value in one register, [r i]
+
+		const __m128d w1Real_64x2 = _mm_set1_pd(w1.real());
+		const __m128d w1Imag_64x2 = _mm_set1_pd(w1.imag());
+		const __m128d w2Real_64x2 = _mm_set1_pd(w2.real());
+		const __m128d w2Imag_64x2 = _mm_set1_pd(w2.imag());
+		const __m128d w3Real_64x2 = _mm_set1_pd(w3.real());
+		const __m128d w3Imag_64x2 = _mm_set1_pd(w3.imag());
+
+		const __m128d negateReal_64x2 = _mm_set_pd(0.0, -0.0);
+
+		for (; q < elements; ++q)
+		{
+			const __m128d a_64x2 = _mm_loadu_pd((const double*)(a + q));
+			const __m128d b_64x2 = _mm_loadu_pd((const double*)(b + q));
+			const __m128d c_64x2 = _mm_loadu_pd((const double*)(c + q));
+			const __m128d d_64x2 = _mm_loadu_pd((const double*)(d + q));
+
+			const __m128d apc_64x2 = _mm_add_pd(a_64x2, c_64x2);
+			const __m128d amc_64x2 = _mm_sub_pd(a_64x2, c_64x2);
+			const __m128d bpd_64x2 = _mm_add_pd(b_64x2, d_64x2);
+			const __m128d bmd_64x2 = _mm_sub_pd(b_64x2, d_64x2);
+
+			const __m128d jbmd_64x2 = _mm_xor_pd(_mm_shuffle_pd(bmd_64x2, bmd_64x2, 1), negateReal_64x2);
+
+			const __m128d t1_64x2 = _mm_sub_pd(amc_64x2, jbmd_64x2);
+			const __m128d t2_64x2 = _mm_sub_pd(apc_64x2, bpd_64x2);
+			const __m128d t3_64x2 = _mm_add_pd(amc_64x2, jbmd_64x2);
+
+			const __m128d y1_64x2 = _mm_addsub_pd(_mm_mul_pd(t1_64x2, w1Real_64x2), _mm_mul_pd(_mm_shuffle_pd(t1_64x2, t1_64x2, 1), w1Imag_64x2));
+			const __m128d y2_64x2 = _mm_addsub_pd(_mm_mul_pd(t2_64x2, w2Real_64x2), _mm_mul_pd(_mm_shuffle_pd(t2_64x2, t2_64x2, 1), w2Imag_64x2));
+			const __m128d y3_64x2 = _mm_addsub_pd(_mm_mul_pd(t3_64x2, w3Real_64x2), _mm_mul_pd(_mm_shuffle_pd(t3_64x2, t3_64x2, 1), w3Imag_64x2));
+
+			_mm_storeu_pd((double*)(y + q), _mm_add_pd(apc_64x2, bpd_64x2));
+			_mm_storeu_pd((double*)(y + elements + q), y1_64x2);
+			_mm_storeu_pd((double*)(y + elements * 2u + q), y2_64x2);
+			_mm_storeu_pd((double*)(y + elements * 3u + q), y3_64x2);
+		}
+	}
+
+#endif // OCEAN_HARDWARE_SSE_VERSION >= 30
+
+	const T w1r = w1.real();
+	const T w1i = w1.imag();
+	const T w2r = w2.real();
+	const T w2i = w2.imag();
+	const T w3r = w3.real();
+	const T w3i = w3.imag();
+
+	for (; q < elements; ++q)
+	{
+		const T apcR = a[q].real() + c[q].real();
+		const T apcI = a[q].imag() + c[q].imag();
+		const T amcR = a[q].real() - c[q].real();
+		const T amcI = a[q].imag() - c[q].imag();
+
+		const T bpdR = b[q].real() + d[q].real();
+		const T bpdI = b[q].imag() + d[q].imag();
+
+		// i * (b - d)
+		const T jbmdR = d[q].imag() - b[q].imag();
+		const T jbmdI = b[q].real() - d[q].real();
+
+		const T t1R = amcR - jbmdR;
+		const T t1I = amcI - jbmdI;
+
+		const T t2R = apcR - bpdR;
+		const T t2I = apcI - bpdI;
+
+		const T t3R = amcR + jbmdR;
+		const T t3I = amcI + jbmdI;
+
+		y[q] = std::complex<T>(apcR + bpdR, apcI + bpdI);
+		y[elements + q] = std::complex<T>(w1r * t1R - w1i * t1I, w1r * t1I + w1i * t1R);
+		y[elements * 2u + q] = std::complex<T>(w2r * t2R - w2i * t2I, w2r * t2I + w2i * t2R);
+		y[elements * 3u + q] = std::complex<T>(w3r * t3R - w3i * t3I, w3r * t3I + w3i * t3R);
+	}
+}
+
+template <typename T>
+void FourierTransformation::butterfliesRadix2(const std::complex<T>* source, std::complex<T>* target, const unsigned int elements)
+{
+	ocean_assert(source != nullptr && target != nullptr);
+
+	unsigned int q = 0u;
+
+#if defined(OCEAN_HARDWARE_SSE_VERSION) && OCEAN_HARDWARE_SSE_VERSION >= 30
+
+	if constexpr (std::is_same<T, float>::value)
+	{
+		for (; q + 2u <= elements; q += 2u)
+		{
+			const __m128 a_32x4 = _mm_loadu_ps((const float*)(source + q));
+			const __m128 b_32x4 = _mm_loadu_ps((const float*)(source + elements + q));
+
+			_mm_storeu_ps((float*)(target + q), _mm_add_ps(a_32x4, b_32x4));
+			_mm_storeu_ps((float*)(target + elements + q), _mm_sub_ps(a_32x4, b_32x4));
+		}
+	}
+	else
+	{
+		for (; q < elements; ++q)
+		{
+			const __m128d a_64x2 = _mm_loadu_pd((const double*)(source + q));
+			const __m128d b_64x2 = _mm_loadu_pd((const double*)(source + elements + q));
+
+			_mm_storeu_pd((double*)(target + q), _mm_add_pd(a_64x2, b_64x2));
+			_mm_storeu_pd((double*)(target + elements + q), _mm_sub_pd(a_64x2, b_64x2));
+		}
+	}
+
+#endif // OCEAN_HARDWARE_SSE_VERSION >= 30
+
+	for (; q < elements; ++q)
+	{
+		const std::complex<T> a = source[q];
+		const std::complex<T> b = source[elements + q];
+
+		target[q] = std::complex<T>(a.real() + b.real(), a.imag() + b.imag());
+		target[elements + q] = std::complex<T>(a.real() - b.real(), a.imag() - b.imag());
+	}
+}
+
+template <typename T>
+void FourierTransformation::spatialToHalfFrequencyRowsSubset(const T* spatial, const unsigned int width, const unsigned int spatialStrideElements, T* complexHalfFrequency, const unsigned int frequencyStrideElements, const unsigned int firstRow, const unsigned int numberRows)
+{
+	ocean_assert(spatial != nullptr && complexHalfFrequency != nullptr);
+	ocean_assert(width >= 2u && Utilities::isPowerOfTwo(width));
+
+	// a real signal with N * 2 elements is transformed as complex signal with N elements (even elements as real part, odd elements as imaginary part),
+	// the frequencies of the even and odd elements are separated afterwards due to the conjugate symmetry
+	// blocks of rows are interleaved so that each butterfly stage operates on several consecutive values
+
+	constexpr unsigned int blockSize = std::is_same<T, float>::value ? 16u : 8u;
+
+	const unsigned int n = width / 2u;
+
+	const std::complex<T>* const twiddles = FastTransformationPlan<T>::get(width).twiddles();
+
+	std::vector<std::complex<T>> rows(size_t(n) * size_t(blockSize));
+	std::vector<std::complex<T>> buffer(size_t(n) * size_t(blockSize));
+
+	for (unsigned int blockRow = firstRow; blockRow < firstRow + numberRows; blockRow += blockSize)
+	{
+		const unsigned int blockRows = std::min(blockSize, firstRow + numberRows - blockRow);
+
+		for (unsigned int r = 0u; r < blockRows; ++r)
+		{
+			const std::complex<T>* const spatialRow = (const std::complex<T>*)(spatial + size_t(blockRow + r) * size_t(spatialStrideElements));
+
+			for (unsigned int k = 0u; k < n; ++k)
+			{
+				rows[k * blockRows + r] = spatialRow[k];
+			}
+		}
+
+		fastTransformation<T>(rows.data(), buffer.data(), n, twiddles, 2u, blockRows);
+
+		for (unsigned int r = 0u; r < blockRows; ++r)
+		{
+			std::complex<T>* const frequencyRow = (std::complex<T>*)(complexHalfFrequency + size_t(blockRow + r) * size_t(frequencyStrideElements));
+
+			const T z0R = rows[r].real();
+			const T z0I = rows[r].imag();
+
+			frequencyRow[0] = std::complex<T>(z0R + z0I, T(0));
+			frequencyRow[n] = std::complex<T>(z0R - z0I, T(0));
+
+			for (unsigned int k = 1u; k <= n / 2u; ++k)
+			{
+				const unsigned int kMirror = n - k;
+
+				const T aR = rows[k * blockRows + r].real();
+				const T aI = rows[k * blockRows + r].imag();
+				const T bR = rows[kMirror * blockRows + r].real();
+				const T bI = rows[kMirror * blockRows + r].imag();
+
+				// even = (Z[k] + conj(Z[N - k])) / 2, odd = (Z[k] - conj(Z[N - k])) * -i / 2
+
+				const T evenR = (aR + bR) * T(0.5);
+				const T evenI = (aI - bI) * T(0.5);
+				const T oddR = (aI + bI) * T(0.5);
+				const T oddI = (bR - aR) * T(0.5);
+
+				const T wR = twiddles[k].real();
+				const T wI = twiddles[k].imag();
+
+				frequencyRow[k] = std::complex<T>(evenR + wR * oddR - wI * oddI, evenI + wR * oddI + wI * oddR);
+
+				if (kMirror != k)
+				{
+					// the even and odd parts for N - k are the conjugates of the parts for k, while W^(N - k) = -conj(W^k)
+
+					frequencyRow[kMirror] = std::complex<T>(evenR - wR * oddR + wI * oddI, -evenI + wR * oddI + wI * oddR);
+				}
+			}
+		}
+	}
+}
+
+template <typename T>
+void FourierTransformation::halfFrequencyToSpatialRowsSubset(const T* complexHalfFrequency, const unsigned int width, const unsigned int frequencyStrideElements, T* spatial, const unsigned int spatialStrideElements, const T scale, const unsigned int firstRow, const unsigned int numberRows)
+{
+	ocean_assert(complexHalfFrequency != nullptr && spatial != nullptr);
+	ocean_assert(width >= 2u && Utilities::isPowerOfTwo(width));
+
+	constexpr unsigned int blockSize = std::is_same<T, float>::value ? 16u : 8u;
+
+	const unsigned int n = width / 2u;
+
+	const std::complex<T>* const twiddles = FastTransformationPlan<T>::get(width).twiddles();
+
+	std::vector<std::complex<T>> rows(size_t(n) * size_t(blockSize));
+	std::vector<std::complex<T>> buffer(size_t(n) * size_t(blockSize));
+
+	for (unsigned int blockRow = firstRow; blockRow < firstRow + numberRows; blockRow += blockSize)
+	{
+		const unsigned int blockRows = std::min(blockSize, firstRow + numberRows - blockRow);
+
+		for (unsigned int r = 0u; r < blockRows; ++r)
+		{
+			const std::complex<T>* const frequencyRow = (const std::complex<T>*)(complexHalfFrequency + size_t(blockRow + r) * size_t(frequencyStrideElements));
+
+			for (unsigned int k = 0u; k < n; ++k)
+			{
+				const T aR = frequencyRow[k].real();
+				const T aI = frequencyRow[k].imag();
+				const T bR = frequencyRow[n - k].real();
+				const T bI = frequencyRow[n - k].imag();
+
+				// even = (X[k] + conj(X[N - k])) / 2, odd = (X[k] - conj(X[N - k])) / 2 * conj(W^k)
+
+				const T evenR = (aR + bR) * T(0.5);
+				const T evenI = (aI - bI) * T(0.5);
+
+				const T tR = (aR - bR) * T(0.5);
+				const T tI = (aI + bI) * T(0.5);
+
+				const T wR = twiddles[k].real();
+				const T wI = twiddles[k].imag();
+
+				const T oddR = tR * wR + tI * wI;
+				const T oddI = tI * wR - tR * wI;
+
+				// the conjugate of Z[k] = even + i * odd, as the inverse transformation is realized by a forward transformation of the conjugated signal
+
+				rows[k * blockRows + r] = std::complex<T>(evenR - oddI, -(evenI + oddR));
+			}
+		}
+
+		fastTransformation<T>(rows.data(), buffer.data(), n, twiddles, 2u, blockRows);
+
+		for (unsigned int r = 0u; r < blockRows; ++r)
+		{
+			T* const spatialRow = spatial + size_t(blockRow + r) * size_t(spatialStrideElements);
+
+			for (unsigned int k = 0u; k < n; ++k)
+			{
+				spatialRow[2u * k + 0u] = rows[k * blockRows + r].real() * scale;
+				spatialRow[2u * k + 1u] = -rows[k * blockRows + r].imag() * scale;
+			}
+		}
+	}
+}
+
+template <typename T>
+void FourierTransformation::complexColumnsSubset(T* complexData, const unsigned int height, const unsigned int strideElements, const bool inverse, const unsigned int firstColumn, const unsigned int numberColumns)
+{
+	ocean_assert(complexData != nullptr);
+	ocean_assert(height >= 1u && Utilities::isPowerOfTwo(height));
+
+	// blocks of columns are copied row by row into an intermediate buffer and transformed as interleaved signals
+
+	constexpr unsigned int blockSize = std::is_same<T, float>::value ? 16u : 8u;
+
+	const std::complex<T>* const twiddles = FastTransformationPlan<T>::get(height).twiddles();
+
+	std::vector<std::complex<T>> columns(size_t(blockSize) * size_t(height));
+	std::vector<std::complex<T>> buffer(size_t(blockSize) * size_t(height));
+
+	for (unsigned int blockColumn = firstColumn; blockColumn < firstColumn + numberColumns; blockColumn += blockSize)
+	{
+		const unsigned int blockColumns = std::min(blockSize, firstColumn + numberColumns - blockColumn);
+
+		for (unsigned int y = 0u; y < height; ++y)
+		{
+			const std::complex<T>* const row = (const std::complex<T>*)(complexData + size_t(y) * size_t(strideElements)) + blockColumn;
+
+			memcpy(columns.data() + y * blockColumns, row, sizeof(std::complex<T>) * blockColumns);
+		}
+
+		if (inverse)
+		{
+			// the backward transformation is realized by a forward transformation of the conjugated signal
+
+			T* const values = (T*)(columns.data());
+
+			for (unsigned int n = 1u; n < blockColumns * height * 2u; n += 2u)
+			{
+				values[n] = -values[n];
+			}
+		}
+
+		fastTransformation<T>(columns.data(), buffer.data(), height, twiddles, 1u, blockColumns);
+
+		if (inverse)
+		{
+			T* const values = (T*)(columns.data());
+
+			for (unsigned int n = 1u; n < blockColumns * height * 2u; n += 2u)
+			{
+				values[n] = -values[n];
+			}
+		}
+
+		for (unsigned int y = 0u; y < height; ++y)
+		{
+			std::complex<T>* const row = (std::complex<T>*)(complexData + size_t(y) * size_t(strideElements)) + blockColumn;
+
+			memcpy(row, columns.data() + y * blockColumns, sizeof(std::complex<T>) * blockColumns);
+		}
+	}
+}
+
 template void OCEAN_MATH_EXPORT FourierTransformation::spatialToFrequency2<double>(const double*, const unsigned int, const unsigned int, double*, const unsigned int, const unsigned int);
 template void OCEAN_MATH_EXPORT FourierTransformation::spatialToFrequency2<float>(const float*, const unsigned int, const unsigned int, float*, const unsigned int, const unsigned int);
 template void OCEAN_MATH_EXPORT FourierTransformation::complexSpatialToFrequency2<double>(const double*, const unsigned int, const unsigned int, double*, const unsigned int, const unsigned int);
@@ -2366,4 +2940,9 @@ template void OCEAN_MATH_EXPORT FourierTransformation::frequencyToSpatial2<float
 template void OCEAN_MATH_EXPORT FourierTransformation::frequencyToComplexSpatial2<double>(const double*, const unsigned int, const unsigned int, double*, const unsigned int, const unsigned int);
 template void OCEAN_MATH_EXPORT FourierTransformation::frequencyToComplexSpatial2<float>(const float*, const unsigned int, const unsigned int, float*, const unsigned int, const unsigned int);
 
+template bool OCEAN_MATH_EXPORT FourierTransformation::spatialToHalfFrequency2<double>(const double*, const unsigned int, const unsigned int, double*, const unsigned int, const unsigned int, Worker*);
+template bool OCEAN_MATH_EXPORT FourierTransformation::spatialToHalfFrequency2<float>(const float*, const unsigned int, const unsigned int, float*, const unsigned int, const unsigned int, Worker*);
+template bool OCEAN_MATH_EXPORT FourierTransformation::halfFrequencyToSpatial2<double>(const double*, const unsigned int, const unsigned int, double*, const unsigned int, const unsigned int, Worker*);
+template bool OCEAN_MATH_EXPORT FourierTransformation::halfFrequencyToSpatial2<float>(const float*, const unsigned int, const unsigned int, float*, const unsigned int, const unsigned int, Worker*);
+
 }
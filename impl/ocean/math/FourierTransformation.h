@@ -204,6 +204,42 @@ class OCEAN_MATH_EXPORT FourierTransformation
 		template <typename T>
 		static void frequencyToComplexSpatial2(const T* complexFrequency, const unsigned int width, const unsigned int height, T* complexSpatial, const unsigned int frequencyPaddingElements = 0u, const unsigned int spatialPaddingElements = 0u);
 
+		/**
+		 * Applies a forward fast Fourier transformation for a given 2D (real) spatial signal and determines the non-redundant half of the complex frequency analysis.
+		 * The frequency analysis of a real signal is conjugate symmetric, therefore only the first (width / 2 + 1) complex frequencies of each row are determined.<br>
+		 * The remaining frequencies are given by F(x, y) = conj(F(width - x, (height - y) % height)).<br>
+		 * The transformation applies radix-4 butterflies (and one radix-2 stage for odd powers of two) on twiddle factors which are cached for each size, the row and column passes can be distributed across a worker.
+		 * @param spatial The real 2D spatial signal that will be transformed, must be valid
+		 * @param width The width of the 2D signal in elements, must be a power of two, with range [2, infinity)
+		 * @param height height of the 2D signal in elements, must be a power of two, with range [1, infinity)
+		 * @param complexHalfFrequency Resulting complex frequency analysis with (width / 2 + 1) complex elements in each row, must be valid
+		 * @param spatialPaddingElements The number of padding elements at the end of each row of the spatial signal, in elements with respect to `T`, with range [0, infinity)
+		 * @param frequencyPaddingElements The number of padding elements at the end of each row of the frequency analysis, in elements with respect to `T` (not `complex<T>`), with range [0, infinity)
+		 * @param worker Optional worker object to distribute the computation
+		 * @return True, if succeeded; False, if the size of the signal is not supported
+		 * @tparam T The element data type of the spatial and frequency signals, either 'float' or 'double'
+		 * @see halfFrequencyToSpatial2(), spatialToFrequency2().
+		 */
+		template <typename T>
+		static bool spatialToHalfFrequency2(const T* spatial, const unsigned int width, const unsigned int height, T* complexHalfFrequency, const unsigned int spatialPaddingElements = 0u, const unsigned int frequencyPaddingElements = 0u, Worker* worker = nullptr);
+
+		/**
+		 * Applies a backward fast Fourier transformation for a given non-redundant half of a 2D frequency analysis of a real signal.
+		 * This function is the inverse of spatialToHalfFrequency2(), the resulting spatial signal is scaled by 1 / (width * height).
+		 * @param complexHalfFrequency The complex frequency analysis with (width / 2 + 1) complex elements in each row, must be valid
+		 * @param width The width of the 2D signal in elements, must be a power of two, with range [2, infinity)
+		 * @param height height of the 2D signal in elements, must be a power of two, with range [1, infinity)
+		 * @param spatial Resulting real spatial signal, must be valid
+		 * @param frequencyPaddingElements The number of padding elements at the end of each row of the frequency analysis, in elements with respect to `T` (not `complex<T>`), with range [0, infinity)
+		 * @param spatialPaddingElements The number of padding elements at the end of each row of the spatial signal, in elements with respect to `T`, with range [0, infinity)
+		 * @param worker Optional worker object to distribute the computation
+		 * @return True, if succeeded; False, if the size of the signal is not supported
+		 * @tparam T The element data type of the spatial and frequency signals, either 'float' or 'double'
+		 * @see spatialToHalfFrequency2().
+		 */
+		template <typename T>
+		static bool halfFrequencyToSpatial2(const T* complexHalfFrequency, const unsigned int width, const unsigned int height, T* spatial, const unsigned int frequencyPaddingElements = 0u, const unsigned int spatialPaddingElements = 0u, Worker* worker = nullptr);
+
 		/**
 		 * Converts scalar values to complex values.
 		 * @param source Scalar source values
@@ -401,8 +437,135 @@ class OCEAN_MATH_EXPORT FourierTransformation
 		 */
 		template <typename T>
 		static void elementwiseDivision2(const T* complexSourceA, const T* complexSourceB, T* complexTarget, const unsigned int width, const unsigned int height, const unsigned int horizontalPaddingSourceAElements = 0u, const unsigned int horizontalPaddingSourceBElements = 0u, const unsigned int horizontalPaddingTargetElements = 0u);
+
+	protected:
+
+		/**
+		 * This class holds the twiddle factors for fast Fourier transformations of one specific size.
+		 * Plans are created once for each size and are kept until the process ends, so that the twiddle factors are not determined for each transformation.
+		 * @tparam T The data type of the twiddle factors, either 'float' or 'double'
+		 */
+		template <typename T>
+		class FastTransformationPlan
+		{
+			public:
+
+				/**
+				 * Creates a new plan for a specific size.
+				 * @param size The size of the transformation, must be a power of two, with range [1, infinity)
+				 */
+				explicit FastTransformationPlan(const unsigned int size);
+
+				/**
+				 * Returns the twiddle factors exp(-2 * pi * i * k / size), with k in [0, size).
+				 * @return The twiddle factors
+				 */
+				inline const std::complex<T>* twiddles() const;
+
+				/**
+				 * Returns the cached plan for a specific size, the plan is created if it does not exist yet.
+				 * This function is thread-safe.
+				 * @param size The size of the transformation, must be a power of two, with range [1, infinity)
+				 * @return The plan, valid until the process ends
+				 */
+				static const FastTransformationPlan<T>& get(const unsigned int size);
+
+			protected:
+
+				/// The twiddle factors of the plan.
+				std::vector<std::complex<T>> twiddles_;
+		};
+
+		/**
+		 * Applies an in-place fast Fourier transformation of complex 1D signals with a Stockham auto-sort algorithm.
+		 * Several signals can be transformed at once if they are interleaved, element i of signal j is located at data[i * signals + j].<br>
+		 * The twiddle factor of index k must be exp(-2 * pi * i * k / (size * twiddleStride)).
+		 * @param data The complex signals to be transformed, will receive the result, must be valid
+		 * @param buffer The intermediate buffer with `size * signals` elements, must be valid
+		 * @param size The size of each signal, must be a power of two, with range [1, infinity)
+		 * @param twiddles The twiddle factors, must be valid
+		 * @param twiddleStride The stride between the twiddle factors which are used, with range [1, infinity)
+		 * @param signals The number of interleaved signals, with range [1, infinity)
+		 * @tparam T The data type of the real and imaginary part of the complex numbers, either 'float' or 'double'
+		 */
+		template <typename T>
+		static void fastTransformation(std::complex<T>* data, std::complex<T>* buffer, const unsigned int size, const std::complex<T>* twiddles, const unsigned int twiddleStride, const unsigned int signals = 1u);
+
+		/**
+		 * Applies radix-4 butterflies for consecutive complex values of one Stockham stage.
+		 * @param a The first quarter of the input values, with `elements` values, must be valid
+		 * @param b The second quarter of the input values, with `elements` values, must be valid
+		 * @param c The third quarter of the input values, with `elements` values, must be valid
+		 * @param d The fourth quarter of the input values, with `elements` values, must be valid
+		 * @param y The resulting values, with `elements * 4` values, must be valid
+		 * @param w1 The twiddle factor for the second output quarter
+		 * @param w2 The twiddle factor for the third output quarter
+		 * @param w3 The twiddle factor for the fourth output quarter
+		 * @param elements The number of consecutive values in each quarter, with range [1, infinity)
+		 * @tparam T The data type of the real and imaginary part of the complex numbers, either 'float' or 'double'
+		 */
+		template <typename T>
+		static void butterfliesRadix4(const std::complex<T>* a, const std::complex<T>* b, const std::complex<T>* c, const std::complex<T>* d, std::complex<T>* y, const std::complex<T>& w1, const std::complex<T>& w2, const std::complex<T>& w3, const unsigned int elements);
+
+		/**
+		 * Applies radix-2 butterflies (without twiddle factors) for consecutive complex values of the last Stockham stage.
+		 * @param source The input values, with `elements * 2` values, must be valid
+		 * @param target The resulting values, with `elements * 2` values, may be identical to `source`, must be valid
+		 * @param elements The number of consecutive values in each half, with range [1, infinity)
+		 * @tparam T The data type of the real and imaginary part of the complex numbers, either 'float' or 'double'
+		 */
+		template <typename T>
+		static void butterfliesRadix2(const std::complex<T>* source, std::complex<T>* target, const unsigned int elements);
+
+		/**
+		 * Applies the forward transformation of a subset of the rows of a real 2D signal.
+		 * @param spatial The real 2D spatial signal, must be valid
+		 * @param width The width of the signal, with range [2, infinity)
+		 * @param spatialStrideElements The number of elements between two rows of the spatial signal, with range [width, infinity)
+		 * @param complexHalfFrequency The resulting half frequency analysis, must be valid
+		 * @param frequencyStrideElements The number of elements (with respect to `T`) between two rows of the frequency analysis, with range [width + 2, infinity)
+		 * @param firstRow The first row to be handled
+		 * @param numberRows The number of rows to be handled
+		 * @tparam T The data type of the signals, either 'float' or 'double'
+		 */
+		template <typename T>
+		static void spatialToHalfFrequencyRowsSubset(const T* spatial, const unsigned int width, const unsigned int spatialStrideElements, T* complexHalfFrequency, const unsigned int frequencyStrideElements, const unsigned int firstRow, const unsigned int numberRows);
+
+		/**
+		 * Applies the backward transformation of a subset of the rows of a half frequency analysis, the (otherwise unscaled) resulting rows are multiplied by a scale factor.
+		 * @param complexHalfFrequency The half frequency analysis, must be valid
+		 * @param width The width of the real signal, with range [2, infinity)
+		 * @param frequencyStrideElements The number of elements (with respect to `T`) between two rows of the frequency analysis, with range [width + 2, infinity)
+		 * @param spatial The resulting real 2D spatial signal, must be valid
+		 * @param spatialStrideElements The number of elements between two rows of the spatial signal, with range [width, infinity)
+		 * @param scale The additional scale factor to be applied, with range (0, infinity)
+		 * @param firstRow The first row to be handled
+		 * @param numberRows The number of rows to be handled
+		 * @tparam T The data type of the signals, either 'float' or 'double'
+		 */
+		template <typename T>
+		static void halfFrequencyToSpatialRowsSubset(const T* complexHalfFrequency, const unsigned int width, const unsigned int frequencyStrideElements, T* spatial, const unsigned int spatialStrideElements, const T scale, const unsigned int firstRow, const unsigned int numberRows);
+
+		/**
+		 * Applies the in-place forward or backward transformation of a subset of columns of a complex 2D signal, the backward transformation is not scaled.
+		 * @param complexData The complex 2D signal, must be valid
+		 * @param height The height of the signal, must be a power of two, with range [1, infinity)
+		 * @param strideElements The number of elements (with respect to `T`) between two rows of the signal
+		 * @param inverse True, to apply the backward transformation; False, to apply the forward transformation
+		 * @param firstColumn The first column to be handled
+		 * @param numberColumns The number of columns to be handled
+		 * @tparam T The data type of the signals, either 'float' or 'double'
+		 */
+		template <typename T>
+		static void complexColumnsSubset(T* complexData, const unsigned int height, const unsigned int strideElements, const bool inverse, const unsigned int firstColumn, const unsigned int numberColumns);
 };
 
+template <typename T>
+inline const std::complex<T>* FourierTransformation::FastTransformationPlan<T>::twiddles() const
+{
+	return twiddles_.data();
+}
+
 template <typename T>
 inline void FourierTransformation::NaiveImplementation::spatialToFrequency2(const std::complex<T>* spatial, const unsigned int width, const unsigned int height, std::complex<T>* frequency, Worker* worker)
 {
@@ -15,6 +15,7 @@
 #include "ocean/math/PinholeCamera.h"
 #include "ocean/math/Plane3.h"
 #include "ocean/math/Sphere3.h"
+#include "ocean/math/SquareMatrix4.h"
 
 namespace Ocean
 {
@@ -180,6 +181,13 @@ class FrustumT
 		 */
 		inline FrustumT(const HomogenousMatrixT4<T>& world_T_camera, const AnyCamera& pinholeCamera, const T nearDistance, const T farDistance);
 
+		/**
+		 * Creates a new viewing frustum from a projection matrix, pointing towards the negative z-space with y-axis up.
+		 * The projection matrix is expected to map the frustum into normalized device coordinates with range [-1, 1] in each dimension, as e.g., SquareMatrixT4::projectionMatrix() or SquareMatrixT4::frustumMatrix().
+		 * @param projectionMatrix The projection matrix for which the frustum will be created, must be valid
+		 */
+		explicit FrustumT(const SquareMatrixT4<T>& projectionMatrix);
+
 		/**
 		 * Returns the six planes of the frustum, with order as defined in PlaneIds.
 		 * @return The frustum's planes
@@ -372,6 +380,40 @@ FrustumT<T>::FrustumT(const HomogenousMatrixT4<T>& world_T_camera, const AnyCame
 	ocean_assert(pinholeCamera.anyCameraType() == AnyCameraType::PINHOLE);
 }
 
+template <typename T>
+FrustumT<T>::FrustumT(const SquareMatrixT4<T>& projectionMatrix)
+{
+	ocean_assert(!projectionMatrix.isSingular());
+
+	// each plane is a linear combination of the last row and one of the first three rows of the projection matrix, e.g., -w <= x <= w for the left and right plane
+
+	constexpr unsigned int rowIndices[PI_END] = {2u, 2u, 0u, 0u, 1u, 1u};
+	constexpr T rowSigns[PI_END] = {T(1), T(-1), T(1), T(-1), T(-1), T(1)};
+
+	for (unsigned int n = 0u; n < PI_END; ++n)
+	{
+		const unsigned int rowIndex = rowIndices[n];
+		const T rowSign = rowSigns[n];
+
+		const VectorT3<T> normal(projectionMatrix(3, 0) + rowSign * projectionMatrix(rowIndex, 0), projectionMatrix(3, 1) + rowSign * projectionMatrix(rowIndex, 1), projectionMatrix(3, 2) + rowSign * projectionMatrix(rowIndex, 2));
+		const T offset = projectionMatrix(3, 3) + rowSign * projectionMatrix(rowIndex, 3);
+
+		const T length = normal.length();
+
+		if (NumericT<T>::isEqualEps(length))
+		{
+			planes_[PI_FRONT] = PlaneT3<T>();
+
+			ocean_assert(!isValid());
+			return;
+		}
+
+		planes_[n] = PlaneT3<T>(normal / length, -offset / length);
+	}
+
+	ocean_assert(isValid());
+}
+
 template <typename T>
 inline const PlaneT3<T>* FrustumT<T>::planes() const
 {
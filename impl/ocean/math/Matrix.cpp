@@ -365,6 +365,23 @@ MatrixT<T> MatrixT<T>::selfSquareMatrix() const
 {
 	MatrixT<T> result(rows_, rows_);
 
+	if (isLargeProduct(rows_, rows_, columns_))
+	{
+		// a cache-blocked symmetric rank update for the upper triangle
+
+		using EigenMatrix = Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
+
+		Eigen::Map<const EigenMatrix> matrixEigen(data(), rows(), columns());
+		Eigen::Map<EigenMatrix> resultEigen(result.data(), result.rows(), result.columns());
+
+		resultEigen.setZero();
+		resultEigen.template selfadjointView<Eigen::Upper>().rankUpdate(matrixEigen);
+
+		copyUpperTriangle(result);
+
+		return result;
+	}
+
 	T* target = result.data();
 
 	for (size_t r = 0; r < rows_; ++r)
@@ -411,7 +428,7 @@ MatrixT<T> MatrixT<T>::selfTransposedSquareMatrix() const
 }
 
 template <typename T>
-void MatrixT<T>::selfTransposedSquareMatrix(MatrixT<T>& result) const
+void MatrixT<T>::selfTransposedSquareMatrix(MatrixT<T>& result, Worker* worker) const
 {
 	/**
 	 * Determination of matrix.transposed() * matrix:
@@ -419,6 +436,32 @@ void MatrixT<T>::selfTransposedSquareMatrix(MatrixT<T>& result) const
 	 */
 
 	result.resize(columns_, columns_);
+
+	if (isLargeProduct(columns_, columns_, rows_))
+	{
+		constexpr unsigned int blockSize = 32u;
+
+		const unsigned int blocks = (unsigned int)((columns_ + blockSize - 1) / blockSize);
+
+		if (worker != nullptr && isParallelProduct(columns_, columns_, rows_))
+		{
+			worker->executeFunction(Worker::Function::createStatic(&MatrixT<T>::selfTransposedSquareMatrixSubset, this, &result, 0u, 0u), 0u, blocks, 2u, 3u, 2u);
+		}
+		else
+		{
+			selfTransposedSquareMatrixSubset(this, &result, 0u, blocks);
+		}
+
+		copyUpperTriangle(result);
+
+#ifdef OCEAN_INTENSIVE_DEBUG
+		const MatrixT<T> debugMatrix(transposed() * *this);
+		ocean_assert(debugMatrix.isEqual(result, NumericT<T>::weakEps() * T(rows_)));
+#endif
+
+		return;
+	}
+
 	T* target = result.data();
 
 	for (size_t r = 0; r < columns_; ++r)
@@ -608,42 +651,14 @@ MatrixT<T> MatrixT<T>::transposedMultiply(const MatrixT<T>& matrix) const
 		return MatrixT<T>();
 	}
 
-	MatrixT<T> result(columns(), matrix.columns());
-	T* target = result.data();
-
-	for (size_t r = 0; r < columns_; ++r)
-	{
-		for (size_t c = 0; c < matrix.columns_; ++c)
-		{
-			T value = 0;
-
-			const T* left = values_ + r;
-			const T* right = matrix.values_ + c;
-
-			left -= columns_;
-			right -= matrix.columns_;
-
-			const T* const leftEnd = left + rows_ * columns_;
-
-			while (left != leftEnd)
-			{
-				value += *(left += columns_) * *(right += matrix.columns_);
-			}
-
-			*target++ = value;
-		}
-	}
-
-#ifdef OCEAN_INTENSIVE_DEBUG
-	const MatrixT<T> debugMatrix(transposed() * matrix);
-	ocean_assert(debugMatrix == result);
-#endif
+	MatrixT<T> result;
+	transposedMultiply(matrix, result);
 
 	return result;
 }
 
 template <typename T>
-void MatrixT<T>::transposedMultiply(const MatrixT<T>& matrix, MatrixT<T>& result) const
+void MatrixT<T>::transposedMultiply(const MatrixT<T>& matrix, MatrixT<T>& result, Worker* worker) const
 {
 	if (rows() != matrix.rows())
 	{
@@ -651,7 +666,24 @@ void MatrixT<T>::transposedMultiply(const MatrixT<T>& matrix, MatrixT<T>& result
 		return;
 	}
 
+	ocean_assert(&result != this && &result != &matrix);
+
 	result.resize(columns(), matrix.columns());
+
+	if (isLargeProduct(columns_, matrix.columns_, rows_))
+	{
+		if (worker != nullptr && isParallelProduct(columns_, matrix.columns_, rows_))
+		{
+			worker->executeFunction(Worker::Function::createStatic(&MatrixT<T>::multiplySubset, this, &matrix, &result, true, 0u, 0u), 0u, (unsigned int)(columns_), 4u, 5u, 32u);
+		}
+		else
+		{
+			multiplySubset(this, &matrix, &result, true, 0u, (unsigned int)(columns_));
+		}
+
+		return;
+	}
+
 	T* target = result.data() - 1;
 
 	for (size_t r = 0; r < columns_; ++r)
@@ -1265,6 +1297,108 @@ MatrixT<T> MatrixT<T>::operator*(const MatrixT<T>& right) const
 
 #endif
 
+template <typename T>
+bool MatrixT<T>::multiply(const MatrixT<T>& left, const MatrixT<T>& right, MatrixT<T>& result, Worker* worker)
+{
+	ocean_assert(&result != &left && &result != &right);
+
+	if (left.columns() != right.rows() || &result == &left || &result == &right)
+	{
+		return false;
+	}
+
+	result.resize(left.rows(), right.columns());
+
+	if (left.rows() == 0 || right.columns() == 0)
+	{
+		return true;
+	}
+
+	if (worker != nullptr && isParallelProduct(left.rows(), right.columns(), left.columns()))
+	{
+		worker->executeFunction(Worker::Function::createStatic(&MatrixT<T>::multiplySubset, &left, &right, &result, false, 0u, 0u), 0u, (unsigned int)(left.rows()), 4u, 5u, 32u);
+	}
+	else
+	{
+		multiplySubset(&left, &right, &result, false, 0u, (unsigned int)(left.rows()));
+	}
+
+	return true;
+}
+
+template <typename T>
+void MatrixT<T>::multiplySubset(const MatrixT<T>* left, const MatrixT<T>* right, MatrixT<T>* result, const bool transposeLeft, const unsigned int firstRow, const unsigned int numberRows)
+{
+	ocean_assert(left != nullptr && right != nullptr && result != nullptr);
+	ocean_assert(firstRow + numberRows <= result->rows());
+
+	using EigenMatrix = Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
+
+	Eigen::Map<const EigenMatrix> leftEigen(left->data(), left->rows(), left->columns());
+	Eigen::Map<const EigenMatrix> rightEigen(right->data(), right->rows(), right->columns());
+	Eigen::Map<EigenMatrix> resultEigen(result->data(), result->rows(), result->columns());
+
+	if (transposeLeft)
+	{
+		ocean_assert(left->rows() == right->rows());
+		resultEigen.middleRows(firstRow, numberRows).noalias() = leftEigen.middleCols(firstRow, numberRows).transpose() * rightEigen;
+	}
+	else
+	{
+		ocean_assert(left->columns() == right->rows());
+		resultEigen.middleRows(firstRow, numberRows).noalias() = leftEigen.middleRows(firstRow, numberRows) * rightEigen;
+	}
+}
+
+template <typename T>
+void MatrixT<T>::selfTransposedSquareMatrixSubset(const MatrixT<T>* matrix, MatrixT<T>* result, const unsigned int firstBlock, const unsigned int numberBlocks)
+{
+	ocean_assert(matrix != nullptr && result != nullptr);
+	ocean_assert(result->rows() == matrix->columns() && result->columns() == matrix->columns());
+
+	constexpr size_t blockSize = 32;
+
+	const size_t size = matrix->columns();
+	const size_t blocks = (size + blockSize - 1) / blockSize;
+
+	using EigenMatrix = Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
+
+	Eigen::Map<const EigenMatrix> matrixEigen(matrix->data(), matrix->rows(), matrix->columns());
+	Eigen::Map<EigenMatrix> resultEigen(result->data(), result->rows(), result->columns());
+
+	for (unsigned int n = firstBlock; n < firstBlock + numberBlocks; ++n)
+	{
+		ocean_assert(n < blocks);
+
+		// the rows of the upper triangle have decreasing costs, so we pair the first and the last blocks to balance the work of consecutive indices
+
+		const size_t block = (n % 2u == 0u) ? size_t(n / 2u) : blocks - 1 - size_t(n / 2u);
+
+		const size_t rowStart = block * blockSize;
+		const size_t rowsInBlock = std::min(blockSize, size - rowStart);
+
+		// the block row of the upper triangle, including the entire diagonal block
+
+		resultEigen.block(rowStart, rowStart, rowsInBlock, size - rowStart).noalias() = matrixEigen.middleCols(rowStart, rowsInBlock).transpose() * matrixEigen.rightCols(size - rowStart);
+	}
+}
+
+template <typename T>
+void MatrixT<T>::copyUpperTriangle(MatrixT<T>& matrix)
+{
+	ocean_assert(matrix.rows() == matrix.columns());
+
+	for (size_t r = 1; r < matrix.rows(); ++r)
+	{
+		T* target = matrix[r];
+
+		for (size_t c = 0; c < r; ++c)
+		{
+			target[c] = matrix(c, r);
+		}
+	}
+}
+
 template <typename T>
 MatrixT<T> MatrixT<T>::operator*(const T scalar) const
 {
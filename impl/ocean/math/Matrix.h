@@ -11,6 +11,8 @@
 #include "ocean/math/Math.h"
 #include "ocean/math/Numeric.h"
 
+#include "ocean/base/Worker.h"
+
 namespace Ocean
 {
 
@@ -233,10 +235,12 @@ class MatrixT
 		/**
 		 * Returns the matrix product of transposed matrix of this matrix and this matrix.<br>
 		 * The result will be a square matrix with size: columns() x columns().<br>
-		 * Actually, the following matrix will be returned: (*this).transposed() * (*this).
+		 * Actually, the following matrix will be returned: (*this).transposed() * (*this).<br>
+		 * Large matrices are handled with a cache-blocked symmetric rank update, distributed across the worker if defined.
 		 * @param result Resulting matrix
+		 * @param worker Optional worker object to distribute the computation for large matrices
 		 */
-		void selfTransposedSquareMatrix(MatrixT<T>& result) const;
+		void selfTransposedSquareMatrix(MatrixT<T>& result, Worker* worker = nullptr) const;
 
 		/**
 		 * Returns the matrix product of transposed matrix of this matrix and this matrix and applies a further squared diagonal weighting matrix.<br>
@@ -283,11 +287,13 @@ class MatrixT
 		/**
 		 * Multiplies this transposed matrix with a second matrix.
 		 * Actually, the following matrix will be returned: (*this).transposed() * right.<br>
-		 * The resulting matrix will have the size: columns() x right.columns().
+		 * The resulting matrix will have the size: columns() x right.columns().<br>
+		 * Large matrices are handled with a cache-blocked matrix product, distributed across the worker if defined.
 		 * @param right Matrix to multiply
 		 * @param result Resulting matrix product
+		 * @param worker Optional worker object to distribute the computation for large matrices
 		 */
-		void transposedMultiply(const MatrixT<T>& right, MatrixT<T>& result) const;
+		void transposedMultiply(const MatrixT<T>& right, MatrixT<T>& result, Worker* worker = nullptr) const;
 
 		/**
 		 * Solves the given linear system.
@@ -640,8 +646,64 @@ class MatrixT
 		 */
 		static size_t rank(const T* data, const size_t rows, const size_t columns);
 
+		/**
+		 * Multiplies two matrices, result = left * right.
+		 * Large matrices are handled with a cache-blocked matrix product, distributed across the worker if defined.
+		 * @param left The left matrix, with left.columns() == right.rows()
+		 * @param right The right matrix
+		 * @param result The resulting matrix product, with size left.rows() x right.columns(), must not be 'left' or 'right'
+		 * @param worker Optional worker object to distribute the computation for large matrices
+		 * @return True, if succeeded
+		 */
+		static bool multiply(const MatrixT<T>& left, const MatrixT<T>& right, MatrixT<T>& result, Worker* worker = nullptr);
+
 	protected:
 
+		/**
+		 * Returns whether a matrix product is large enough to be determined with the cache-blocked implementation.
+		 * @param rows The number of rows of the product, with range [0, infinity)
+		 * @param columns The number of columns of the product, with range [0, infinity)
+		 * @param inner The inner dimension of the product, with range [0, infinity)
+		 * @return True, if so
+		 */
+		static inline bool isLargeProduct(const size_t rows, const size_t columns, const size_t inner);
+
+		/**
+		 * Returns whether a matrix product is large enough to be distributed across several threads.
+		 * @param rows The number of rows of the product, with range [0, infinity)
+		 * @param columns The number of columns of the product, with range [0, infinity)
+		 * @param inner The inner dimension of the product, with range [0, infinity)
+		 * @return True, if so
+		 */
+		static inline bool isParallelProduct(const size_t rows, const size_t columns, const size_t inner);
+
+		/**
+		 * Determines a subset of rows of a matrix product, result = left * right or result = left.transposed() * right.
+		 * @param left The left matrix, must be valid
+		 * @param right The right matrix, must be valid
+		 * @param result The resulting matrix product with correct size, must be valid
+		 * @param transposeLeft True, to use the transposed left matrix
+		 * @param firstRow The first row of the product to be determined
+		 * @param numberRows The number of rows of the product to be determined
+		 */
+		static void multiplySubset(const MatrixT<T>* left, const MatrixT<T>* right, MatrixT<T>* result, const bool transposeLeft, const unsigned int firstRow, const unsigned int numberRows);
+
+		/**
+		 * Determines a subset of rows of the upper triangle of matrix.transposed() * matrix.
+		 * The rows are interleaved in blocks so that each thread receives almost the same amount of work.
+		 * @param matrix The matrix for which the product will be determined, must be valid
+		 * @param result The resulting matrix with size matrix.columns() x matrix.columns(), must be valid
+		 * @param firstBlock The first block of rows to be determined
+		 * @param numberBlocks The number of blocks of rows to be determined
+		 */
+		static void selfTransposedSquareMatrixSubset(const MatrixT<T>* matrix, MatrixT<T>* result, const unsigned int firstBlock, const unsigned int numberBlocks);
+
+		/**
+		 * Copies the upper triangle of a square matrix to the lower triangle.
+		 * @param matrix The square matrix to be made symmetric
+		 */
+		static void copyUpperTriangle(MatrixT<T>& matrix);
+
 		/**
 		 * Swaps two rows.
 		 * @param row0 The index of the first row to be swapped, with range [0, rows())
@@ -688,6 +750,20 @@ class MatrixT
 		T* values_ = nullptr;
 };
 
+template <typename T>
+inline bool MatrixT<T>::isLargeProduct(const size_t rows, const size_t columns, const size_t inner)
+{
+	// the naive implementation is faster for small matrices, the decision is based on the number of multiplications
+
+	return rows >= 8 && columns >= 8 && inner >= 8 && rows * columns * inner >= 32 * 32 * 32;
+}
+
+template <typename T>
+inline bool MatrixT<T>::isParallelProduct(const size_t rows, const size_t columns, const size_t inner)
+{
+	return rows >= 64 && rows * columns * inner >= 128 * 128 * 128;
+}
+
 template <typename T>
 inline size_t MatrixT<T>::rows() const
 {
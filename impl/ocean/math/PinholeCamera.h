@@ -1203,6 +1203,21 @@ class OCEAN_MATH_EXPORT PinholeCameraT : public CameraT<T>
 
 	private:
 
+		/**
+		 * Projects 3D object points in blocks of four points with SIMD instructions if available for the data type of this camera.
+		 * The function handles the largest multiple of four object points and leaves the remaining object points to the caller.
+		 * @param flippedCamera_T_world The inverted and flipped camera pose, transforming world to flipped camera, must be valid
+		 * @param worldObjectPoints The 3D object points to project, defined in world
+		 * @param numberObjectPoints The number of object points to project, with range [0, infinity)
+		 * @param distortImagePoints True, to apply the distortion parameters of this camera object
+		 * @param imagePoints The resulting image points, make sure that enough memory is provided
+		 * @param zoom The zoom factor of the camera, with range (0, infinity)
+		 * @return The number of projected object points, 0 if SIMD instructions are not available
+		 * @tparam tUseBorderDistortionIfOutside True, to apply the distortion from the nearest point lying on the frame border if the point lies outside the visible camera area; False to apply the distortion from the given position
+		 */
+		template <bool tUseBorderDistortionIfOutside>
+		inline size_t projectToImageIF4(const HomogenousMatrixT4<T>& flippedCamera_T_world, const VectorT3<T>* worldObjectPoints, const size_t numberObjectPoints, const bool distortImagePoints, VectorT2<T>* imagePoints, const T zoom) const;
+
 		/**
 		 * Determines the inverse of the intrinsic camera matrix.
 		 * This function must be invoked immediately after the intrinsic matrix has changed.
@@ -2137,6 +2152,286 @@ VectorT2<T> PinholeCameraT<T>::projectToImageIF(const VectorT2<T>& normalizedObj
 	}
 }
 
+template <typename T>
+template <bool tUseBorderDistortionIfOutside>
+inline size_t PinholeCameraT<T>::projectToImageIF4(const HomogenousMatrixT4<T>& flippedCamera_T_world, const VectorT3<T>* worldObjectPoints, const size_t numberObjectPoints, const bool distortImagePoints, VectorT2<T>* imagePoints, const T zoom) const
+{
+	ocean_assert(flippedCamera_T_world.isValid() && zoom > NumericT<T>::eps());
+	ocean_assert((worldObjectPoints != nullptr && imagePoints != nullptr) || numberObjectPoints == 0u);
+
+	const size_t blocks = numberObjectPoints / 4;
+
+	const bool applyDistortion = distortImagePoints && hasDistortionParameters();
+
+	// without distortion, all distortion parameters are zero and the image points are not clamped
+
+	const T k1 = applyDistortion ? radialDistortion_.first : T(0);
+	const T k2 = applyDistortion ? radialDistortion_.second : T(0);
+	const T p1 = applyDistortion ? tangentialDistortion_.first : T(0);
+	const T p2 = applyDistortion ? tangentialDistortion_.second : T(0);
+
+	const T invZoom = T(1) / zoom;
+
+	const T leftClamping = (applyDistortion && tUseBorderDistortionIfOutside) ? -principalPointX() * inverseFocalLengthX() * invZoom : NumericT<T>::minValue();
+	const T rightClamping = (applyDistortion && tUseBorderDistortionIfOutside) ? (T(width_) - principalPointX()) * inverseFocalLengthX() * invZoom : NumericT<T>::maxValue();
+	const T topClamping = (applyDistortion && tUseBorderDistortionIfOutside) ? -principalPointY() * inverseFocalLengthY() * invZoom : NumericT<T>::minValue();
+	const T bottomClamping = (applyDistortion && tUseBorderDistortionIfOutside) ? (T(height_) - principalPointY()) * inverseFocalLengthY() * invZoom : NumericT<T>::maxValue();
+
+	const T focalLengthXZoom = focalLengthX() * zoom;
+	const T focalLengthYZoom = focalLengthY() * zoom;
+
+	// column-major 4x4 matrix
+	const T* const m = flippedCamera_T_world.data();
+
+#if defined(OCEAN_HARDWARE_SSE_VERSION) && OCEAN_HARDWARE_SSE_VERSION >= 41
+
+	if constexpr (std::is_same<T, float>::value)
+	{
+		const __m128 m0_f32x4 = _mm_set1_ps(m[0]);
+		const __m128 m1_f32x4 = _mm_set1_ps(m[1]);
+		const __m128 m2_f32x4 = _mm_set1_ps(m[2]);
+		const __m128 m4_f32x4 = _mm_set1_ps(m[4]);
+		const __m128 m5_f32x4 = _mm_set1_ps(m[5]);
+		const __m128 m6_f32x4 = _mm_set1_ps(m[6]);
+		const __m128 m8_f32x4 = _mm_set1_ps(m[8]);
+		const __m128 m9_f32x4 = _mm_set1_ps(m[9]);
+		const __m128 m10_f32x4 = _mm_set1_ps(m[10]);
+		const __m128 m12_f32x4 = _mm_set1_ps(m[12]);
+		const __m128 m13_f32x4 = _mm_set1_ps(m[13]);
+		const __m128 m14_f32x4 = _mm_set1_ps(m[14]);
+
+		const __m128 k1_f32x4 = _mm_set1_ps(k1);
+		const __m128 k2_f32x4 = _mm_set1_ps(k2);
+		const __m128 p1_f32x4 = _mm_set1_ps(p1);
+		const __m128 p2_f32x4 = _mm_set1_ps(p2);
+
+		const __m128 leftClamping_f32x4 = _mm_set1_ps(leftClamping);
+		const __m128 rightClamping_f32x4 = _mm_set1_ps(rightClamping);
+		const __m128 topClamping_f32x4 = _mm_set1_ps(topClamping);
+		const __m128 bottomClamping_f32x4 = _mm_set1_ps(bottomClamping);
+
+		const __m128 fx_f32x4 = _mm_set1_ps(focalLengthXZoom);
+		const __m128 fy_f32x4 = _mm_set1_ps(focalLengthYZoom);
+		const __m128 mx_f32x4 = _mm_set1_ps(principalPointX());
+		const __m128 my_f32x4 = _mm_set1_ps(principalPointY());
+
+		const __m128 one_f32x4 = _mm_set1_ps(1.0f);
+		const __m128 two_f32x4 = _mm_set1_ps(2.0f);
+
+		for (size_t nBlock = 0; nBlock < blocks; ++nBlock)
+		{
+			const VectorT3<T>* const objectPoints = worldObjectPoints + nBlock * 4;
+
+			const __m128 worldX_f32x4 = _mm_set_ps(objectPoints[3].x(), objectPoints[2].x(), objectPoints[1].x(), objectPoints[0].x());
+			const __m128 worldY_f32x4 = _mm_set_ps(objectPoints[3].y(), objectPoints[2].y(), objectPoints[1].y(), objectPoints[0].y());
+			const __m128 worldZ_f32x4 = _mm_set_ps(objectPoints[3].z(), objectPoints[2].z(), objectPoints[1].z(), objectPoints[0].z());
+
+			const __m128 x_f32x4 = _mm_add_ps(_mm_add_ps(_mm_mul_ps(m0_f32x4, worldX_f32x4), _mm_mul_ps(m4_f32x4, worldY_f32x4)), _mm_add_ps(_mm_mul_ps(m8_f32x4, worldZ_f32x4), m12_f32x4));
+			const __m128 y_f32x4 = _mm_add_ps(_mm_add_ps(_mm_mul_ps(m1_f32x4, worldX_f32x4), _mm_mul_ps(m5_f32x4, worldY_f32x4)), _mm_add_ps(_mm_mul_ps(m9_f32x4, worldZ_f32x4), m13_f32x4));
+			const __m128 z_f32x4 = _mm_add_ps(_mm_add_ps(_mm_mul_ps(m2_f32x4, worldX_f32x4), _mm_mul_ps(m6_f32x4, worldY_f32x4)), _mm_add_ps(_mm_mul_ps(m10_f32x4, worldZ_f32x4), m14_f32x4));
+
+			const __m128 invZ_f32x4 = _mm_div_ps(one_f32x4, z_f32x4);
+
+			const __m128 u_f32x4 = _mm_mul_ps(x_f32x4, invZ_f32x4);
+			const __m128 v_f32x4 = _mm_mul_ps(y_f32x4, invZ_f32x4);
+
+			const __m128 clampedU_f32x4 = _mm_min_ps(_mm_max_ps(u_f32x4, leftClamping_f32x4), rightClamping_f32x4);
+			const __m128 clampedV_f32x4 = _mm_min_ps(_mm_max_ps(v_f32x4, topClamping_f32x4), bottomClamping_f32x4);
+
+			const __m128 sqrU_f32x4 = _mm_mul_ps(clampedU_f32x4, clampedU_f32x4);
+			const __m128 sqrV_f32x4 = _mm_mul_ps(clampedV_f32x4, clampedV_f32x4);
+			const __m128 twoUV_f32x4 = _mm_mul_ps(two_f32x4, _mm_mul_ps(clampedU_f32x4, clampedV_f32x4));
+
+			const __m128 sqr_f32x4 = _mm_add_ps(sqrU_f32x4, sqrV_f32x4);
+
+			// 1 + k1 * r^2 + k2 * r^4
+			const __m128 radial_f32x4 = _mm_add_ps(one_f32x4, _mm_mul_ps(sqr_f32x4, _mm_add_ps(k1_f32x4, _mm_mul_ps(k2_f32x4, sqr_f32x4))));
+
+			// p1 * 2 * u * v + p2 * (r^2 + 2 * u^2),  p1 * (r^2 + 2 * v^2) + p2 * 2 * u * v
+			const __m128 tangentialX_f32x4 = _mm_add_ps(_mm_mul_ps(p1_f32x4, twoUV_f32x4), _mm_mul_ps(p2_f32x4, _mm_add_ps(sqr_f32x4, _mm_mul_ps(two_f32x4, sqrU_f32x4))));
+			const __m128 tangentialY_f32x4 = _mm_add_ps(_mm_mul_ps(p1_f32x4, _mm_add_ps(sqr_f32x4, _mm_mul_ps(two_f32x4, sqrV_f32x4))), _mm_mul_ps(p2_f32x4, twoUV_f32x4));
+
+			const __m128 imageX_f32x4 = _mm_add_ps(_mm_mul_ps(_mm_add_ps(_mm_mul_ps(u_f32x4, radial_f32x4), tangentialX_f32x4), fx_f32x4), mx_f32x4);
+			const __m128 imageY_f32x4 = _mm_add_ps(_mm_mul_ps(_mm_add_ps(_mm_mul_ps(v_f32x4, radial_f32x4), tangentialY_f32x4), fy_f32x4), my_f32x4);
+
+			// interleaving the image points: x0 y0 x1 y1, x2 y2 x3 y3
+
+			float* const imagePointValues = (float*)(imagePoints + nBlock * 4);
+
+			_mm_storeu_ps(imagePointValues + 0, _mm_unpacklo_ps(imageX_f32x4, imageY_f32x4));
+			_mm_storeu_ps(imagePointValues + 4, _mm_unpackhi_ps(imageX_f32x4, imageY_f32x4));
+		}
+
+		return blocks * 4;
+	}
+
+#endif // OCEAN_HARDWARE_SSE_VERSION >= 41
+
+#if defined(OCEAN_HARDWARE_AVX_VERSION) && OCEAN_HARDWARE_AVX_VERSION >= 10
+
+	if constexpr (std::is_same<T, double>::value)
+	{
+		const __m256d m0_f64x4 = _mm256_set1_pd(m[0]);
+		const __m256d m1_f64x4 = _mm256_set1_pd(m[1]);
+		const __m256d m2_f64x4 = _mm256_set1_pd(m[2]);
+		const __m256d m4_f64x4 = _mm256_set1_pd(m[4]);
+		const __m256d m5_f64x4 = _mm256_set1_pd(m[5]);
+		const __m256d m6_f64x4 = _mm256_set1_pd(m[6]);
+		const __m256d m8_f64x4 = _mm256_set1_pd(m[8]);
+		const __m256d m9_f64x4 = _mm256_set1_pd(m[9]);
+		const __m256d m10_f64x4 = _mm256_set1_pd(m[10]);
+		const __m256d m12_f64x4 = _mm256_set1_pd(m[12]);
+		const __m256d m13_f64x4 = _mm256_set1_pd(m[13]);
+		const __m256d m14_f64x4 = _mm256_set1_pd(m[14]);
+
+		const __m256d k1_f64x4 = _mm256_set1_pd(k1);
+		const __m256d k2_f64x4 = _mm256_set1_pd(k2);
+		const __m256d p1_f64x4 = _mm256_set1_pd(p1);
+		const __m256d p2_f64x4 = _mm256_set1_pd(p2);
+
+		const __m256d leftClamping_f64x4 = _mm256_set1_pd(leftClamping);
+		const __m256d rightClamping_f64x4 = _mm256_set1_pd(rightClamping);
+		const __m256d topClamping_f64x4 = _mm256_set1_pd(topClamping);
+		const __m256d bottomClamping_f64x4 = _mm256_set1_pd(bottomClamping);
+
+		const __m256d fx_f64x4 = _mm256_set1_pd(focalLengthXZoom);
+		const __m256d fy_f64x4 = _mm256_set1_pd(focalLengthYZoom);
+		const __m256d mx_f64x4 = _mm256_set1_pd(principalPointX());
+		const __m256d my_f64x4 = _mm256_set1_pd(principalPointY());
+
+		const __m256d one_f64x4 = _mm256_set1_pd(1.0);
+		const __m256d two_f64x4 = _mm256_set1_pd(2.0);
+
+		for (size_t nBlock = 0; nBlock < blocks; ++nBlock)
+		{
+			const VectorT3<T>* const objectPoints = worldObjectPoints + nBlock * 4;
+
+			const __m256d worldX_f64x4 = _mm256_set_pd(objectPoints[3].x(), objectPoints[2].x(), objectPoints[1].x(), objectPoints[0].x());
+			const __m256d worldY_f64x4 = _mm256_set_pd(objectPoints[3].y(), objectPoints[2].y(), objectPoints[1].y(), objectPoints[0].y());
+			const __m256d worldZ_f64x4 = _mm256_set_pd(objectPoints[3].z(), objectPoints[2].z(), objectPoints[1].z(), objectPoints[0].z());
+
+			const __m256d x_f64x4 = _mm256_add_pd(_mm256_add_pd(_mm256_mul_pd(m0_f64x4, worldX_f64x4), _mm256_mul_pd(m4_f64x4, worldY_f64x4)), _mm256_add_pd(_mm256_mul_pd(m8_f64x4, worldZ_f64x4), m12_f64x4));
+			const __m256d y_f64x4 = _mm256_add_pd(_mm256_add_pd(_mm256_mul_pd(m1_f64x4, worldX_f64x4), _mm256_mul_pd(m5_f64x4, worldY_f64x4)), _mm256_add_pd(_mm256_mul_pd(m9_f64x4, worldZ_f64x4), m13_f64x4));
+			const __m256d z_f64x4 = _mm256_add_pd(_mm256_add_pd(_mm256_mul_pd(m2_f64x4, worldX_f64x4), _mm256_mul_pd(m6_f64x4, worldY_f64x4)), _mm256_add_pd(_mm256_mul_pd(m10_f64x4, worldZ_f64x4), m14_f64x4));
+
+			const __m256d invZ_f64x4 = _mm256_div_pd(one_f64x4, z_f64x4);
+
+			const __m256d u_f64x4 = _mm256_mul_pd(x_f64x4, invZ_f64x4);
+			const __m256d v_f64x4 = _mm256_mul_pd(y_f64x4, invZ_f64x4);
+
+			const __m256d clampedU_f64x4 = _mm256_min_pd(_mm256_max_pd(u_f64x4, leftClamping_f64x4), rightClamping_f64x4);
+			const __m256d clampedV_f64x4 = _mm256_min_pd(_mm256_max_pd(v_f64x4, topClamping_f64x4), bottomClamping_f64x4);
+
+			const __m256d sqrU_f64x4 = _mm256_mul_pd(clampedU_f64x4, clampedU_f64x4);
+			const __m256d sqrV_f64x4 = _mm256_mul_pd(clampedV_f64x4, clampedV_f64x4);
+			const __m256d twoUV_f64x4 = _mm256_mul_pd(two_f64x4, _mm256_mul_pd(clampedU_f64x4, clampedV_f64x4));
+
+			const __m256d sqr_f64x4 = _mm256_add_pd(sqrU_f64x4, sqrV_f64x4);
+
+			// 1 + k1 * r^2 + k2 * r^4
+			const __m256d radial_f64x4 = _mm256_add_pd(one_f64x4, _mm256_mul_pd(sqr_f64x4, _mm256_add_pd(k1_f64x4, _mm256_mul_pd(k2_f64x4, sqr_f64x4))));
+
+			// p1 * 2 * u * v + p2 * (r^2 + 2 * u^2),  p1 * (r^2 + 2 * v^2) + p2 * 2 * u * v
+			const __m256d tangentialX_f64x4 = _mm256_add_pd(_mm256_mul_pd(p1_f64x4, twoUV_f64x4), _mm256_mul_pd(p2_f64x4, _mm256_add_pd(sqr_f64x4, _mm256_mul_pd(two_f64x4, sqrU_f64x4))));
+			const __m256d tangentialY_f64x4 = _mm256_add_pd(_mm256_mul_pd(p1_f64x4, _mm256_add_pd(sqr_f64x4, _mm256_mul_pd(two_f64x4, sqrV_f64x4))), _mm256_mul_pd(p2_f64x4, twoUV_f64x4));
+
+			const __m256d imageX_f64x4 = _mm256_add_pd(_mm256_mul_pd(_mm256_add_pd(_mm256_mul_pd(u_f64x4, radial_f64x4), tangentialX_f64x4), fx_f64x4), mx_f64x4);
+			const __m256d imageY_f64x4 = _mm256_add_pd(_mm256_mul_pd(_mm256_add_pd(_mm256_mul_pd(v_f64x4, radial_f64x4), tangentialY_f64x4), fy_f64x4), my_f64x4);
+
+			// the unpack instructions work within 128 bit lanes: x0 y0 x2 y2, x1 y1 x3 y3
+			const __m256d low_f64x4 = _mm256_unpacklo_pd(imageX_f64x4, imageY_f64x4);
+			const __m256d high_f64x4 = _mm256_unpackhi_pd(imageX_f64x4, imageY_f64x4);
+
+			double* const imagePointValues = (double*)(imagePoints + nBlock * 4);
+
+			_mm256_storeu_pd(imagePointValues + 0, _mm256_permute2f128_pd(low_f64x4, high_f64x4, 0x20));
+			_mm256_storeu_pd(imagePointValues + 4, _mm256_permute2f128_pd(low_f64x4, high_f64x4, 0x31));
+		}
+
+		return blocks * 4;
+	}
+
+#endif // OCEAN_HARDWARE_AVX_VERSION >= 10
+
+#if defined(OCEAN_HARDWARE_NEON_VERSION) && OCEAN_HARDWARE_NEON_VERSION >= 10
+
+	if constexpr (std::is_same<T, float>::value)
+	{
+		const float32x4_t k1_f32x4 = vdupq_n_f32(k1);
+		const float32x4_t k2_f32x4 = vdupq_n_f32(k2);
+		const float32x4_t p1_f32x4 = vdupq_n_f32(p1);
+		const float32x4_t p2_f32x4 = vdupq_n_f32(p2);
+
+		const float32x4_t leftClamping_f32x4 = vdupq_n_f32(leftClamping);
+		const float32x4_t rightClamping_f32x4 = vdupq_n_f32(rightClamping);
+		const float32x4_t topClamping_f32x4 = vdupq_n_f32(topClamping);
+		const float32x4_t bottomClamping_f32x4 = vdupq_n_f32(bottomClamping);
+
+		const float32x4_t fx_f32x4 = vdupq_n_f32(focalLengthXZoom);
+		const float32x4_t fy_f32x4 = vdupq_n_f32(focalLengthYZoom);
+		const float32x4_t mx_f32x4 = vdupq_n_f32(principalPointX());
+		const float32x4_t my_f32x4 = vdupq_n_f32(principalPointY());
+
+		const float32x4_t one_f32x4 = vdupq_n_f32(1.0f);
+
+		for (size_t nBlock = 0; nBlock < blocks; ++nBlock)
+		{
+			// de-interleaving the object points: x0 x1 x2 x3, y0 y1 y2 y3, z0 z1 z2 z3
+			const float32x4x3_t world_f32x4x3 = vld3q_f32((const float*)(worldObjectPoints + nBlock * 4));
+
+			const float32x4_t x_f32x4 = vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vdupq_n_f32(m[12]), world_f32x4x3.val[0], m[0]), world_f32x4x3.val[1], m[4]), world_f32x4x3.val[2], m[8]);
+			const float32x4_t y_f32x4 = vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vdupq_n_f32(m[13]), world_f32x4x3.val[0], m[1]), world_f32x4x3.val[1], m[5]), world_f32x4x3.val[2], m[9]);
+			const float32x4_t z_f32x4 = vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vdupq_n_f32(m[14]), world_f32x4x3.val[0], m[2]), world_f32x4x3.val[1], m[6]), world_f32x4x3.val[2], m[10]);
+
+#ifdef __aarch64__
+			const float32x4_t invZ_f32x4 = vdivq_f32(one_f32x4, z_f32x4);
+#else
+			// reciprocal estimate with two Newton-Raphson refinement steps
+			float32x4_t invZ_f32x4 = vrecpeq_f32(z_f32x4);
+			invZ_f32x4 = vmulq_f32(vrecpsq_f32(z_f32x4, invZ_f32x4), invZ_f32x4);
+			invZ_f32x4 = vmulq_f32(vrecpsq_f32(z_f32x4, invZ_f32x4), invZ_f32x4);
+#endif
+
+			const float32x4_t u_f32x4 = vmulq_f32(x_f32x4, invZ_f32x4);
+			const float32x4_t v_f32x4 = vmulq_f32(y_f32x4, invZ_f32x4);
+
+			const float32x4_t clampedU_f32x4 = vminq_f32(vmaxq_f32(u_f32x4, leftClamping_f32x4), rightClamping_f32x4);
+			const float32x4_t clampedV_f32x4 = vminq_f32(vmaxq_f32(v_f32x4, topClamping_f32x4), bottomClamping_f32x4);
+
+			const float32x4_t sqrU_f32x4 = vmulq_f32(clampedU_f32x4, clampedU_f32x4);
+			const float32x4_t sqrV_f32x4 = vmulq_f32(clampedV_f32x4, clampedV_f32x4);
+			const float32x4_t twoUV_f32x4 = vmulq_n_f32(vmulq_f32(clampedU_f32x4, clampedV_f32x4), 2.0f);
+
+			const float32x4_t sqr_f32x4 = vaddq_f32(sqrU_f32x4, sqrV_f32x4);
+
+			// 1 + k1 * r^2 + k2 * r^4
+			const float32x4_t radial_f32x4 = vmlaq_f32(one_f32x4, sqr_f32x4, vmlaq_f32(k1_f32x4, k2_f32x4, sqr_f32x4));
+
+			// p1 * 2 * u * v + p2 * (r^2 + 2 * u^2),  p1 * (r^2 + 2 * v^2) + p2 * 2 * u * v
+			const float32x4_t tangentialX_f32x4 = vmlaq_f32(vmulq_f32(p1_f32x4, twoUV_f32x4), p2_f32x4, vmlaq_n_f32(sqr_f32x4, sqrU_f32x4, 2.0f));
+			const float32x4_t tangentialY_f32x4 = vmlaq_f32(vmulq_f32(p2_f32x4, twoUV_f32x4), p1_f32x4, vmlaq_n_f32(sqr_f32x4, sqrV_f32x4, 2.0f));
+
+			float32x4x2_t image_f32x4x2;
+			image_f32x4x2.val[0] = vmlaq_f32(mx_f32x4, vmlaq_f32(tangentialX_f32x4, u_f32x4, radial_f32x4), fx_f32x4);
+			image_f32x4x2.val[1] = vmlaq_f32(my_f32x4, vmlaq_f32(tangentialY_f32x4, v_f32x4, radial_f32x4), fy_f32x4);
+
+			// interleaving the image points: x0 y0 x1 y1 x2 y2 x3 y3
+			vst2q_f32((float*)(imagePoints + nBlock * 4), image_f32x4x2);
+		}
+
+		return blocks * 4;
+	}
+
+#endif // OCEAN_HARDWARE_NEON_VERSION >= 10
+
+	OCEAN_SUPPRESS_UNUSED_WARNING(blocks);
+	OCEAN_SUPPRESS_UNUSED_WARNING(m);
+	OCEAN_SUPPRESS_UNUSED_WARNING(focalLengthXZoom);
+	OCEAN_SUPPRESS_UNUSED_WARNING(focalLengthYZoom);
+
+	return 0;
+}
+
 template <typename T>
 template <bool tUseBorderDistortionIfOutside>
 void PinholeCameraT<T>::projectToImageIF(const HomogenousMatrixT4<T>& flippedCamera_T_world, const VectorT3<T>* worldObjectPoints, const size_t numberObjectPoints, const bool distortImagePoints, VectorT2<T>* imagePoints, const T zoom) const
@@ -2144,6 +2439,12 @@ void PinholeCameraT<T>::projectToImageIF(const HomogenousMatrixT4<T>& flippedCam
 	ocean_assert(flippedCamera_T_world.isValid() && zoom > NumericT<T>::eps());
 	ocean_assert((worldObjectPoints != nullptr && imagePoints != nullptr) || numberObjectPoints == 0u);
 
+	// the first object points are projected in blocks of four points with SIMD instructions (if available)
+	const size_t firstObjectPoint = projectToImageIF4<tUseBorderDistortionIfOutside>(flippedCamera_T_world, worldObjectPoints, numberObjectPoints, distortImagePoints, imagePoints, zoom);
+	ocean_assert(firstObjectPoint <= numberObjectPoints);
+
+	imagePoints += firstObjectPoint;
+
 	if (distortImagePoints && hasDistortionParameters())
 	{
 		const T invZoom = T(1) / zoom;
@@ -2156,7 +2457,7 @@ void PinholeCameraT<T>::projectToImageIF(const HomogenousMatrixT4<T>& flippedCam
 		// if the camera does not provide tangential distortion
 		if (tangentialDistortion_.first == 0 && tangentialDistortion_.second == 0)
 		{
-			for (size_t n = 0; n < numberObjectPoints; ++n)
+			for (size_t n = firstObjectPoint; n < numberObjectPoints; ++n)
 			{
 				const VectorT3<T> objectPoint(flippedCamera_T_world * worldObjectPoints[n]);
 
@@ -2191,7 +2492,7 @@ void PinholeCameraT<T>::projectToImageIF(const HomogenousMatrixT4<T>& flippedCam
 		{
 			ocean_assert(tangentialDistortion_.first != 0 || tangentialDistortion_.second != 0);
 
-			for (size_t n = 0; n < numberObjectPoints; ++n)
+			for (size_t n = firstObjectPoint; n < numberObjectPoints; ++n)
 			{
 				const VectorT3<T> objectPoint(flippedCamera_T_world * worldObjectPoints[n]);
 
@@ -2241,7 +2542,7 @@ void PinholeCameraT<T>::projectToImageIF(const HomogenousMatrixT4<T>& flippedCam
 		const HomogenousMatrixT4<T> transformationIF(transformationMatrixIF(flippedCamera_T_world, zoom));
 		ocean_assert(transformationIF.isValid());
 
-		for (size_t n = 0; n < numberObjectPoints; ++n)
+		for (size_t n = firstObjectPoint; n < numberObjectPoints; ++n)
 		{
 			const VectorT3<T> transformedObjectPoint(transformationIF * worldObjectPoints[n]);
 
@@ -13,10 +13,39 @@ namespace Ocean
 namespace Media
 {
 
+FrameCollection::Ring::Ring(const size_t numberSlots) :
+	slots_(std::make_unique<Slot[]>(numberSlots)),
+	numberSlots_(numberSlots)
+{
+	ocean_assert(numberSlots >= 1 && numberSlots <= 0xFFFF);
+}
+
+FrameCollection::FrameCollection() :
+	FrameCollection(1)
+{
+	// nothing to do here
+}
+
+FrameCollection::FrameCollection(FrameCollection&& frameCollection) :
+	FrameCollection(1)
+{
+	*this = std::move(frameCollection);
+}
+
+FrameCollection::FrameCollection(const FrameCollection& frameCollection) :
+	FrameCollection(frameCollection.capacity())
+{
+	copyFrames(frameCollection);
+}
+
 FrameCollection::FrameCollection(const size_t capacity) :
-	ringMap_(max(size_t(1), capacity))
+	capacity_(max(size_t(1), capacity))
 {
 	ocean_assert(capacity >= 1);
+	ocean_assert(capacity_ + spareSlots_ <= 0xFFFF);
+
+	rings_.emplace_back(std::make_unique<Ring>(capacity_ + spareSlots_));
+	ring_ = rings_.back().get();
 }
 
 FrameCollection::~FrameCollection()
@@ -26,104 +55,565 @@ FrameCollection::~FrameCollection()
 
 FrameRef FrameCollection::recent(SharedAnyCamera* anyCamera) const
 {
-	FrameCameraPair frameCameraPair;
-
-	if (ringMap_.highestElement(frameCameraPair))
+	while (true)
 	{
-#ifdef OCEAN_DEBUG
-		if (frameCameraPair.first && frameCameraPair.second)
+		const Ring* ring = ring_.load();
+		ocean_assert(ring != nullptr);
+
+		const uint64_t latest = ring->latest_.load();
+
+		if (latest == 0ull)
 		{
-			const FrameRef& localFrame = frameCameraPair.first;
-			const SharedAnyCamera& localAnyCamera = frameCameraPair.second;
+			return FrameRef();
+		}
+
+		const uint64_t publication = latest >> 16ull;
+		const size_t slotIndex = size_t(latest & 0xFFFFull);
 
-			ocean_assert(localFrame->width() == localAnyCamera->width());
-			ocean_assert(localFrame->height() == localAnyCamera->height());
+		if (!isVisible(publication, publication))
+		{
+			return FrameRef();
 		}
+
+		ocean_assert(slotIndex < ring->numberSlots_);
+
+		FrameRef frame;
+		if (referenceSlot(ring->slots_[slotIndex], publication * 2ull, frame, anyCamera))
+		{
+#ifdef OCEAN_DEBUG
+			if (anyCamera != nullptr && *anyCamera)
+			{
+				ocean_assert(frame->width() == (*anyCamera)->width());
+				ocean_assert(frame->height() == (*anyCamera)->height());
+			}
 #endif
 
-		if (anyCamera != nullptr)
+			return frame;
+		}
+
+		// the producer has published a new frame in the meantime, or the ring has been replaced
+	}
+}
+
+FrameRef FrameCollection::get(const Timestamp timestamp, SharedAnyCamera* anyCamera) const
+{
+	const Ring* ring = ring_.load();
+	ocean_assert(ring != nullptr);
+
+	const uint64_t latest = ring->latest_.load();
+
+	if (latest == 0ull)
+	{
+		return FrameRef();
+	}
+
+	const uint64_t latestPublication = latest >> 16ull;
+	const double timestampValue = double(timestamp);
+
+	for (size_t n = 0; n < ring->numberSlots_; ++n)
+	{
+		const Slot& slot = ring->slots_[n];
+
+		const uint64_t sequence = slot.sequence_.load();
+
+		if (sequence == 0ull || (sequence & 1ull) != 0ull || !isVisible(sequence / 2ull, latestPublication))
 		{
-			*anyCamera = frameCameraPair.second;
+			continue;
 		}
 
-		return frameCameraPair.first;
+		if (slot.timestamp_.load() != timestampValue)
+		{
+			continue;
+		}
+
+		FrameRef frame;
+		if (referenceSlot(slot, sequence, frame, anyCamera))
+		{
+			// the slot is referenced now and cannot be changed anymore
+
+			if (slot.timestamp_.load() == timestampValue)
+			{
+				return frame;
+			}
+		}
 	}
 
-	return FrameRef();
+	return recent(anyCamera);
 }
 
-FrameRef FrameCollection::get(const Timestamp timestamp, SharedAnyCamera* anyCamera) const
+FrameRef FrameCollection::closest(const Timestamp timestamp, const double timestampTolerance, SharedAnyCamera* anyCamera) const
 {
-	FrameCameraPair frameCameraPair;
+	ocean_assert(timestampTolerance >= 0.0);
+
+	const double timestampValue = double(timestamp);
 
-	if (ringMap_.element<RingMap::AM_MATCH_OR_HIGHEST>(timestamp, frameCameraPair))
+	while (true)
 	{
-		if (anyCamera != nullptr)
+		const Ring* ring = ring_.load();
+		ocean_assert(ring != nullptr);
+
+		const uint64_t latest = ring->latest_.load();
+
+		if (latest == 0ull)
 		{
-			*anyCamera = frameCameraPair.second;
+			return FrameRef();
+		}
 
-#ifdef OCEAN_DEBUG
-			if (*anyCamera)
+		const uint64_t latestPublication = latest >> 16ull;
+
+		size_t bestSlotIndex = size_t(-1);
+		uint64_t bestSequence = 0ull;
+		double bestDistance = timestampTolerance;
+
+		for (size_t n = 0; n < ring->numberSlots_; ++n)
+		{
+			const Slot& slot = ring->slots_[n];
+
+			const uint64_t sequence = slot.sequence_.load();
+
+			if (sequence == 0ull || (sequence & 1ull) != 0ull || !isVisible(sequence / 2ull, latestPublication))
 			{
-				ocean_assert(frameCameraPair.first->width() == (*anyCamera)->width());
-				ocean_assert(frameCameraPair.first->height() == (*anyCamera)->height());
+				continue;
+			}
+
+			const double distance = NumericD::abs(slot.timestamp_.load() - timestampValue);
+
+			if (distance <= bestDistance)
+			{
+				bestSlotIndex = n;
+				bestSequence = sequence;
+				bestDistance = distance;
 			}
-#endif
 		}
 
-		return frameCameraPair.first;
-	}
+		if (bestSlotIndex == size_t(-1))
+		{
+			return FrameRef();
+		}
 
-	return FrameRef();
+		FrameRef frame;
+		if (referenceSlot(ring->slots_[bestSlotIndex], bestSequence, frame, anyCamera))
+		{
+			return frame;
+		}
+
+		// the slot has been overwritten in the meantime
+	}
 }
 
 bool FrameCollection::has(const Timestamp timestamp) const
 {
-	return ringMap_.hasElement(timestamp);
+	const Ring* ring = ring_.load();
+	ocean_assert(ring != nullptr);
+
+	const uint64_t latest = ring->latest_.load();
+
+	if (latest == 0ull)
+	{
+		return false;
+	}
+
+	const uint64_t latestPublication = latest >> 16ull;
+	const double timestampValue = double(timestamp);
+
+	for (size_t n = 0; n < ring->numberSlots_; ++n)
+	{
+		const Slot& slot = ring->slots_[n];
+
+		const uint64_t sequence = slot.sequence_.load();
+
+		if (sequence == 0ull || (sequence & 1ull) != 0ull || !isVisible(sequence / 2ull, latestPublication))
+		{
+			continue;
+		}
+
+		const double slotTimestamp = slot.timestamp_.load();
+
+		if (slotTimestamp == timestampValue && slot.sequence_.load() == sequence)
+		{
+			return true;
+		}
+	}
+
+	return false;
 }
 
-FrameRef FrameCollection::set(const Frame& frame, SharedAnyCamera anyCamera)
+bool FrameCollection::isMemoryInUse(const void* memory) const
 {
-	ocean_assert(!anyCamera || anyCamera->width() == frame.width());
-	ocean_assert(!anyCamera || anyCamera->height() == frame.height());
+	ocean_assert(memory != nullptr);
+
+	const ScopedLock scopedLock(producerLock_);
+
+	const Ring* currentRing = ring_.load();
+	ocean_assert(currentRing != nullptr);
 
-	FrameRef frameRef(new Frame(frame, Frame::ACM_COPY_REMOVE_PADDING_LAYOUT));
+	const uint64_t latest = currentRing->latest_.load();
+	const uint64_t latestPublication = latest >> 16ull;
 
-	ringMap_.insertElement(frame.timestamp(), FrameCameraPair(frameRef, std::move(anyCamera)), true /*forceOverwrite*/);
+	for (const UniqueRing& ring : rings_)
+	{
+		for (size_t n = 0; n < ring->numberSlots_; ++n)
+		{
+			const Slot& slot = ring->slots_[n];
 
-	return frameRef;
+			if (!slot.frame_->isValid() || slot.frame_->constdata<void>(0u) != memory)
+			{
+				continue;
+			}
+
+			if (slot.isReferenced())
+			{
+				return true;
+			}
+
+			// replaced rings cannot provide frames anymore, only referenced frames are in use
+
+			if (ring.get() == currentRing)
+			{
+				const uint64_t sequence = slot.sequence_.load();
+
+				if (sequence != 0ull && (sequence & 1ull) == 0ull && latest != 0ull && isVisible(sequence / 2ull, latestPublication))
+				{
+					return true;
+				}
+			}
+		}
+	}
+
+	return false;
 }
 
-FrameRef FrameCollection::set(Frame&& frame, SharedAnyCamera anyCamera)
+FrameRef FrameCollection::set(const Frame& frame, SharedAnyCamera anyCamera)
 {
 	ocean_assert(!anyCamera || anyCamera->width() == frame.width());
 	ocean_assert(!anyCamera || anyCamera->height() == frame.height());
 
-	const Timestamp timestamp = frame.timestamp();
-
-	FrameRef frameRef(new Frame(std::move(frame)));
+	return setFrame<const Frame&>(frame, std::move(anyCamera));
+}
 
-	ringMap_.insertElement(timestamp, FrameCameraPair(frameRef, std::move(anyCamera)), true /*forceOverwrite*/);
+FrameRef FrameCollection::set(Frame&& frame, SharedAnyCamera anyCamera)
+{
+	ocean_assert(!anyCamera || anyCamera->width() == frame.width());
+	ocean_assert(!anyCamera || anyCamera->height() == frame.height());
 
-	return frameRef;
+	return setFrame<Frame&&>(std::move(frame), std::move(anyCamera));
 }
 
 bool FrameCollection::setCapacity(const size_t capacity)
 {
-	if (capacity == 0)
+	if (capacity == 0 || capacity + spareSlots_ > 0xFFFF)
 	{
 		ocean_assert(false && "Invalid capacity!");
 		return false;
 	}
 
-	ringMap_.setCapacity(capacity);
+	const ScopedLock scopedLock(producerLock_);
+
+	if (capacity == capacity_)
+	{
+		return true;
+	}
+
+	FrameRefs frames;
+	SharedAnyCameras anyCameras;
+	std::vector<uint64_t> publications;
+	referenceVisibleFrames(frames, anyCameras, &publications);
+
+	const size_t firstFrame = frames.size() > capacity ? frames.size() - capacity : 0;
+
+	UniqueRing newRing = std::make_unique<Ring>(capacity + spareSlots_);
+
+	for (size_t n = firstFrame; n < frames.size(); ++n)
+	{
+		const size_t slotIndex = n - firstFrame;
+
+		Slot& slot = newRing->slots_[slotIndex];
+
+		*slot.frame_ = Frame(*frames[n], Frame::ACM_SHARE_OR_COPY_KEEP_LAYOUT);
+		slot.anyCamera_ = std::move(anyCameras[n]);
+		slot.timestamp_ = double(frames[n]->timestamp());
+		slot.sequence_ = publications[n] * 2ull;
+
+		newRing->latest_ = (publications[n] << 16ull) | uint64_t(slotIndex);
+	}
+
+	frames.clear();
+
+	Ring* oldRing = ring_.load();
+	ocean_assert(oldRing != nullptr);
+
+	capacity_ = capacity;
+	ring_ = newRing.get();
+	rings_.emplace_back(std::move(newRing));
+
+	// consumers may still access the old ring, therefore the ring is kept but the memory of all unreferenced frames is released
+
+	for (size_t n = 0; n < oldRing->numberSlots_; ++n)
+	{
+		invalidateSlot(oldRing->slots_[n]);
+	}
 
 	return true;
 }
 
 void FrameCollection::clear()
 {
-	ringMap_.clear();
+	const ScopedLock scopedLock(producerLock_);
+
+	firstVisiblePublication_ = nextPublication_;
+
+	Ring* ring = ring_.load();
+	ocean_assert(ring != nullptr);
+
+	for (size_t n = 0; n < ring->numberSlots_; ++n)
+	{
+		invalidateSlot(ring->slots_[n]);
+	}
+}
+
+FrameCollection& FrameCollection::operator=(FrameCollection&& frameCollection)
+{
+	if (this != &frameCollection)
+	{
+		ring_ = frameCollection.ring_.load();
+		rings_ = std::move(frameCollection.rings_);
+		capacity_ = frameCollection.capacity_.load();
+		firstVisiblePublication_ = frameCollection.firstVisiblePublication_.load();
+		nextPublication_ = frameCollection.nextPublication_;
+
+		frameCollection.rings_.clear();
+		frameCollection.rings_.emplace_back(std::make_unique<Ring>(1 + spareSlots_));
+		frameCollection.ring_ = frameCollection.rings_.back().get();
+		frameCollection.capacity_ = 1;
+		frameCollection.firstVisiblePublication_ = 1ull;
+		frameCollection.nextPublication_ = 1ull;
+	}
+
+	return *this;
+}
+
+FrameCollection& FrameCollection::operator=(const FrameCollection& frameCollection)
+{
+	if (this != &frameCollection)
+	{
+		clear();
+
+		setCapacity(frameCollection.capacity());
+		copyFrames(frameCollection);
+	}
+
+	return *this;
+}
+
+template <typename TFrame>
+FrameRef FrameCollection::setFrame(TFrame&& frame, SharedAnyCamera&& anyCamera)
+{
+	const ScopedLock scopedLock(producerLock_);
+
+	Ring& ring = *ring_.load();
+
+	const uint64_t latest = ring.latest_.load();
+	const size_t latestSlotIndex = latest != 0ull ? size_t(latest & 0xFFFFull) : size_t(-1);
+
+	// we determine all slots which are not referenced by any consumer, sorted from the oldest to the most recent frame
+
+	std::vector<std::pair<uint64_t, size_t>> candidates;
+	candidates.reserve(ring.numberSlots_);
+
+	for (size_t n = 0; n < ring.numberSlots_; ++n)
+	{
+		if (n != latestSlotIndex && !ring.slots_[n].isReferenced())
+		{
+			candidates.emplace_back(ring.slots_[n].sequence_.load(), n);
+		}
+	}
+
+	std::sort(candidates.begin(), candidates.end());
+
+	const uint64_t publication = nextPublication_;
+
+	for (const std::pair<uint64_t, size_t>& candidate : candidates)
+	{
+		const uint64_t previousSequence = candidate.first;
+		const size_t slotIndex = candidate.second;
+
+		Slot& slot = ring.slots_[slotIndex];
+
+		// the odd sequence number marks the slot as being written, consumers referencing the slot afterwards will release the slot again
+
+		slot.sequence_ = publication * 2ull - 1ull;
+
+		if (slot.isReferenced())
+		{
+			// a consumer has referenced the slot before the slot was marked
+
+			slot.sequence_ = previousSequence;
+			continue;
+		}
+
+		const Timestamp timestamp = frame.timestamp();
+
+		if constexpr (std::is_same<TFrame, Frame&&>::value)
+		{
+			*slot.frame_ = std::move(frame);
+		}
+		else
+		{
+			// the slot's frame memory is re-used whenever possible
+
+			if (!slot.frame_->set(frame.frameType(), true /*forceOwner*/, true /*forceWritable*/) || !slot.frame_->copy(0, 0, frame))
+			{
+				ocean_assert(false && "This should never happen!");
+
+				*slot.frame_ = Frame();
+				slot.anyCamera_ = nullptr;
+				slot.sequence_ = 0ull;
+
+				return FrameRef();
+			}
+
+			slot.frame_->setTimestamp(timestamp);
+			slot.frame_->setRelativeTimestamp(frame.relativeTimestamp());
+		}
+
+		slot.anyCamera_ = std::move(anyCamera);
+		slot.timestamp_ = double(timestamp);
+
+		slot.sequence_ = publication * 2ull;
+		ring.latest_ = (publication << 16ull) | uint64_t(slotIndex);
+
+		++nextPublication_;
+
+		return slot.frame_;
+	}
+
+	// all slots are referenced by consumers, the frame is dropped
+
+	return FrameRef();
+}
+
+void FrameCollection::copyFrames(const FrameCollection& frameCollection)
+{
+	ocean_assert(this != &frameCollection);
+
+	FrameRefs frames;
+	SharedAnyCameras anyCameras;
+	frameCollection.referenceVisibleFrames(frames, anyCameras);
+
+	ocean_assert(frames.size() == anyCameras.size());
+
+	for (size_t n = 0; n < frames.size(); ++n)
+	{
+		set(*frames[n], std::move(anyCameras[n]));
+	}
+}
+
+void FrameCollection::referenceVisibleFrames(FrameRefs& frames, SharedAnyCameras& anyCameras, std::vector<uint64_t>* publications) const
+{
+	frames.clear();
+	anyCameras.clear();
+
+	const Ring* ring = ring_.load();
+	ocean_assert(ring != nullptr);
+
+	const uint64_t latest = ring->latest_.load();
+
+	if (latest == 0ull)
+	{
+		return;
+	}
+
+	const uint64_t latestPublication = latest >> 16ull;
+
+	std::vector<std::pair<uint64_t, size_t>> visibleSlots;
+	visibleSlots.reserve(ring->numberSlots_);
+
+	for (size_t n = 0; n < ring->numberSlots_; ++n)
+	{
+		const uint64_t sequence = ring->slots_[n].sequence_.load();
+
+		if (sequence != 0ull && (sequence & 1ull) == 0ull && isVisible(sequence / 2ull, latestPublication))
+		{
+			visibleSlots.emplace_back(sequence, n);
+		}
+	}
+
+	std::sort(visibleSlots.begin(), visibleSlots.end());
+
+	frames.reserve(visibleSlots.size());
+	anyCameras.reserve(visibleSlots.size());
+
+	if (publications != nullptr)
+	{
+		publications->clear();
+		publications->reserve(visibleSlots.size());
+	}
+
+	for (const std::pair<uint64_t, size_t>& visibleSlot : visibleSlots)
+	{
+		FrameRef frame;
+		SharedAnyCamera anyCamera;
+
+		if (referenceSlot(ring->slots_[visibleSlot.second], visibleSlot.first, frame, &anyCamera))
+		{
+			frames.emplace_back(std::move(frame));
+			anyCameras.emplace_back(std::move(anyCamera));
+
+			if (publications != nullptr)
+			{
+				publications->emplace_back(visibleSlot.first / 2ull);
+			}
+		}
+	}
+}
+
+bool FrameCollection::invalidateSlot(Slot& slot)
+{
+	const uint64_t previousSequence = slot.sequence_.load();
+
+	if (previousSequence == 0ull || slot.isReferenced())
+	{
+		return false;
+	}
+
+	slot.sequence_ = previousSequence | 1ull;
+
+	if (slot.isReferenced())
+	{
+		slot.sequence_ = previousSequence;
+		return false;
+	}
+
+	*slot.frame_ = Frame();
+	slot.anyCamera_ = nullptr;
+	slot.timestamp_ = 0.0;
+
+	slot.sequence_ = 0ull;
+
+	return true;
+}
+
+bool FrameCollection::referenceSlot(const Slot& slot, const uint64_t sequence, FrameRef& frame, SharedAnyCamera* anyCamera)
+{
+	ocean_assert(sequence != 0ull && (sequence & 1ull) == 0ull);
+
+	// first, we reference the slot's frame (increasing the atomic reference counter), afterwards we check whether the slot still holds the expected frame;
+	// the producer marks a slot before checking whether the slot is referenced, so that either the producer or the consumer will back off
+
+	frame = slot.frame_;
+
+	if (slot.sequence_.load() != sequence)
+	{
+		frame.release();
+		return false;
+	}
+
+	if (anyCamera != nullptr)
+	{
+		*anyCamera = slot.anyCamera_;
+	}
+
+	return true;
 }
 
 }
@@ -11,11 +11,13 @@
 #include "ocean/media/Media.h"
 
 #include "ocean/base/Frame.h"
-#include "ocean/base/RingMap.h"
+#include "ocean/base/Lock.h"
 #include "ocean/base/Timestamp.h"
 
 #include "ocean/math/AnyCamera.h"
 
+#include <atomic>
+
 namespace Ocean
 {
 
@@ -24,40 +26,99 @@ namespace Media
 
 /**
  * This class implements a simple buffer holding several frames combined with their timestamps and optional camera calibrations.
+ * The frames are stored in a ring of pre-allocated slots which allows a single producer (e.g., the camera thread) and multiple consumers to access the collection without locks.<br>
+ * Consumers receive a reference to the frame stored in a slot without copying the frame; the producer never writes into a slot which is still referenced by a consumer and never waits for consumers.<br>
+ * Instead, a new frame is written into the oldest slot which is not referenced anymore, the ring provides a few more slots than the capacity for this purpose.<br>
+ * In case all slots are still referenced by consumers, the new frame is dropped.<br>
+ * Several producers are serialized with a lock which is never acquired by consumers.<br>
+ * Copying, moving, or assigning frame collections is not thread-safe.
  * @ingroup media
  */
 class OCEAN_MEDIA_EXPORT FrameCollection
 {
 	protected:
 
+		/// The number of slots in addition to the capacity, allowing consumers to keep references to frames while the producer continues to write new frames.
+		static constexpr size_t spareSlots_ = 4;
+
 		/**
-		 * Definition of a pair combining a frame with a camera profile.
+		 * This class implements one slot of the ring.
+		 * The frame object of a slot is allocated once and reused, consumers reference a slot by referencing the slot's frame.
 		 */
-		using FrameCameraPair = std::pair<FrameRef, SharedAnyCamera>;
+		class Slot
+		{
+			public:
+
+				/**
+				 * Returns whether the slot is currently referenced by at least one consumer.
+				 * @return True, if so
+				 */
+				inline bool isReferenced() const;
+
+			public:
+
+				/// The frame of this slot, the reference is never changed.
+				FrameRef frame_ = FrameRef(new Frame());
+
+				/// The camera profile associated with the frame, nullptr if unknown.
+				SharedAnyCamera anyCamera_;
+
+				/// The timestamp of the frame, readable without referencing the slot.
+				std::atomic<double> timestamp_ = 0.0;
+
+				/// The sequence number of the slot, twice the publication number of the stored frame, odd while the slot is written, 0 if the slot has never been written.
+				std::atomic<uint64_t> sequence_ = 0ull;
+		};
 
 		/**
-		 * Definition of a ring map mapping timestamps to frame pairs.
+		 * This class implements the ring of slots.
 		 */
-		using RingMap = RingMapT<Timestamp, FrameCameraPair, true /*thread-safe*/, true /*ordered keys*/>;
+		class Ring
+		{
+			public:
+
+				/**
+				 * Creates a new ring.
+				 * @param numberSlots The number of slots of the ring, with range [1, 65535]
+				 */
+				explicit Ring(const size_t numberSlots);
+
+			public:
+
+				/// The slots of this ring.
+				std::unique_ptr<Slot[]> slots_;
+
+				/// The number of slots.
+				size_t numberSlots_ = 0;
+
+				/// The most recent publication, composed of the publication number (upper bits) and the slot index (lower 16 bits), 0 if no frame has been published.
+				std::atomic<uint64_t> latest_ = 0ull;
+		};
+
+		/// Definition of a unique pointer holding a ring.
+		using UniqueRing = std::unique_ptr<Ring>;
+
+		/// Definition of a vector holding rings.
+		using UniqueRings = std::vector<UniqueRing>;
 
 	public:
 
 		/**
 		 * Creates an empty frame collection able to hold one frame.
 		 */
-		FrameCollection() = default;
+		FrameCollection();
 
 		/**
 		 * Move constructor.
 		 * @param frameCollection Frame collection to move
 		 */
-		FrameCollection(FrameCollection&& frameCollection) = default;
+		FrameCollection(FrameCollection&& frameCollection);
 
 		/**
 		 * Copy constructor.
 		 * @param frameCollection Frame collection to copy
 		 */
-		FrameCollection(const FrameCollection& frameCollection) = default;
+		FrameCollection(const FrameCollection& frameCollection);
 
 		/**
 		 * Creates a new frame collection.
@@ -78,6 +139,7 @@ class OCEAN_MEDIA_EXPORT FrameCollection
 
 		/**
 		 * Returns the most recent frame.
+		 * The resulting frame is not copied, the frame's slot will not be overwritten as long as the reference exists.
 		 * @param anyCamera Optional resulting camera if known; nullptr if not of interest
 		 * @return Most recent frame
 		 */
@@ -85,13 +147,24 @@ class OCEAN_MEDIA_EXPORT FrameCollection
 
 		/**
 		 * Returns the frame with a specific timestamp.
-		 * If no frame with the given timestamp exists, the most recent frame will be returned.
+		 * If no frame with the given timestamp exists, the most recent frame will be returned.<br>
+		 * The resulting frame is not copied, the frame's slot will not be overwritten as long as the reference exists.
 		 * @param timestamp The timestamp of the frame to return
 		 * @param anyCamera Optional resulting camera if known; nullptr if not of interest
 		 * @return Frame with the specific timestamp
 		 */
 		FrameRef get(const Timestamp timestamp, SharedAnyCamera* anyCamera = nullptr) const;
 
+		/**
+		 * Returns the frame with a timestamp closest to a specific timestamp.
+		 * In contrast to get(), no frame is returned if the collection does not contain a frame close enough to the given timestamp.
+		 * @param timestamp The timestamp of the frame to return
+		 * @param timestampTolerance The maximal difference between the given timestamp and the timestamp of the frame, in seconds, with range [0, infinity)
+		 * @param anyCamera Optional resulting camera if known; nullptr if not of interest
+		 * @return The frame closest to the specific timestamp, invalid if no frame exists within the tolerance
+		 */
+		FrameRef closest(const Timestamp timestamp, const double timestampTolerance, SharedAnyCamera* anyCamera = nullptr) const;
+
 		/**
 		 * Returns whether a frame with specific timestamp is currently stored inside the frame collection.
 		 * @param timestamp The timestamp to be checked
@@ -99,6 +172,15 @@ class OCEAN_MEDIA_EXPORT FrameCollection
 		 */
 		bool has(const Timestamp timestamp) const;
 
+		/**
+		 * Returns whether a frame using specific memory can still be accessed, either because the frame is referenced or because the collection can still provide the frame.
+		 * Producers which set frames wrapping external memory (without copying the memory) can use this function to determine when the memory can be released.<br>
+		 * This function must be called by the producer of the frames.
+		 * @param memory The memory of the first plane of the frame, must be valid
+		 * @return True, if so
+		 */
+		bool isMemoryInUse(const void* memory) const;
+
 		/**
 		 * Sets a new frame and overwrites the oldest frame.
 		 * @param frame The frame to set, a copy will be created
@@ -142,36 +224,115 @@ class OCEAN_MEDIA_EXPORT FrameCollection
 		explicit inline operator bool() const;
 
 		/**
-		 * Default move operator.
+		 * Move operator.
 		 * @param frameCollection Frame collection to move
 		 */
-		FrameCollection& operator=(FrameCollection&& frameCollection) = default;
+		FrameCollection& operator=(FrameCollection&& frameCollection);
 
 		/**
-		 * Default assign operator.
+		 * Assign operator.
 		 * @param frameCollection Frame collection to assign
 		 */
-		FrameCollection& operator=(const FrameCollection& frameCollection) = default;
+		FrameCollection& operator=(const FrameCollection& frameCollection);
+
+	protected:
+
+		/**
+		 * Sets a new frame and overwrites the oldest slot which is not referenced anymore.
+		 * @param frame The frame to set
+		 * @param anyCamera Optional camera profile associated with the given frame, nullptr if unknown
+		 * @tparam TFrame The data type of the frame, either 'const Frame&' to copy the frame or 'Frame&&' to move the frame
+		 * @return Reference to the stored frame, if succeeded
+		 */
+		template <typename TFrame>
+		FrameRef setFrame(TFrame&& frame, SharedAnyCamera&& anyCamera);
+
+		/**
+		 * Copies all frames of a given collection into this collection, the given collection must not be written at the same time.
+		 * @param frameCollection The frame collection from which the frames will be copied
+		 */
+		void copyFrames(const FrameCollection& frameCollection);
+
+		/**
+		 * References all visible frames of this collection, ordered from the oldest to the most recent frame.
+		 * @param frames The resulting visible frames
+		 * @param anyCameras The resulting camera profiles, one for each frame
+		 * @param publications Optional resulting publication numbers, one for each frame; nullptr if not of interest
+		 */
+		void referenceVisibleFrames(FrameRefs& frames, SharedAnyCameras& anyCameras, std::vector<uint64_t>* publications = nullptr) const;
+
+		/**
+		 * Invalidates an unreferenced slot and releases the slot's frame memory.
+		 * The slot will not be changed if a consumer references the slot; the producer lock must be locked.
+		 * @param slot The slot to invalidate
+		 * @return True, if the slot was invalidated
+		 */
+		static bool invalidateSlot(Slot& slot);
+
+		/**
+		 * Returns whether a publication is visible, i.e., whether the publication is one of the most recent 'capacity' publications and was not cleared.
+		 * @param publication The publication number to check, with range [1, infinity)
+		 * @param latestPublication The publication number of the most recent publication known to the caller, with range [1, infinity)
+		 * @return True, if so
+		 */
+		inline bool isVisible(const uint64_t publication, const uint64_t latestPublication) const;
+
+		/**
+		 * Tries to reference the frame of a slot with a specific sequence number.
+		 * @param slot The slot to be referenced
+		 * @param sequence The expected sequence number of the slot, must be even
+		 * @param frame The resulting reference to the slot's frame, if succeeded
+		 * @param anyCamera Optional resulting camera profile of the slot, nullptr if not of interest
+		 * @return True, if the slot still holds the expected frame and the reference could be established
+		 */
+		static bool referenceSlot(const Slot& slot, const uint64_t sequence, FrameRef& frame, SharedAnyCamera* anyCamera);
 
 	protected:
 
-		/// The ring map mapping timestamps to frame/camera pairs.
-		RingMap ringMap_ = RingMap(1);
+		/// The ring of slots which is currently used, owned by 'rings_'.
+		std::atomic<Ring*> ring_ = nullptr;
+
+		/// All rings of this collection, rings which have been replaced due to a capacity change are kept until the collection is disposed as consumers may still access them.
+		UniqueRings rings_;
+
+		/// The capacity of this collection.
+		std::atomic<size_t> capacity_ = 1;
+
+		/// The first publication number which is visible, publications before have been cleared.
+		std::atomic<uint64_t> firstVisiblePublication_ = 1ull;
+
+		/// The next publication number, modified by the producer only.
+		uint64_t nextPublication_ = 1ull;
+
+		/// The lock serializing several producers and capacity changes, never acquired by consumers.
+		mutable Lock producerLock_;
 };
 
+inline bool FrameCollection::Slot::isReferenced() const
+{
+	return !frame_.isUnique();
+}
+
 inline size_t FrameCollection::capacity() const
 {
-	return ringMap_.capacity();
+	return capacity_.load();
 }
 
 inline bool FrameCollection::isNull() const
 {
-	return ringMap_.isEmpty();
+	return !recent();
 }
 
 inline FrameCollection::operator bool() const
 {
-	return !ringMap_.isEmpty();
+	return !isNull();
+}
+
+inline bool FrameCollection::isVisible(const uint64_t publication, const uint64_t latestPublication) const
+{
+	// the publication may be more recent than the given latest publication in case the producer has published a new frame in the meantime
+
+	return publication >= firstVisiblePublication_.load() && publication + capacity_.load() > latestPublication;
 }
 
 }
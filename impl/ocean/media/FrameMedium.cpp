@@ -112,7 +112,7 @@ void FrameMedium::FrameReceiver::onFrame(const Frame& frame, const SharedAnyCame
 		{
 			ocean_assert(!camera_);
 
-			frame_ = Frame(frame, Frame::ACM_COPY_REMOVE_PADDING_LAYOUT);
+			frame_ = Frame(frame, Frame::ACM_SHARE_OR_COPY_KEEP_LAYOUT);
 			camera_ = camera;
 
 			return;
@@ -134,7 +134,7 @@ bool FrameMedium::FrameReceiver::latestFrame(Frame& frame, SharedAnyCamera* came
 
 		if (frame_.isValid())
 		{
-			frame = Frame(frame_, Frame::ACM_USE_KEEP_LAYOUT);
+			frame = Frame(frame_, Frame::ACM_SHARE_OR_COPY_KEEP_LAYOUT);
 
 			if (camera != nullptr)
 			{
@@ -201,6 +201,122 @@ void FrameMedium::FrameReceiver::reset()
 	camera_ = nullptr;
 }
 
+FrameMedium::SyncedFramesReceiver::~SyncedFramesReceiver()
+{
+	release();
+}
+
+bool FrameMedium::SyncedFramesReceiver::initialize(const FrameMediumRefs& frameMediums, SyncedFramesCallbackFunction syncedFramesCallbackFunction, const double timestampTolerance)
+{
+	ocean_assert(!frameMediums.empty() && syncedFramesCallbackFunction);
+	ocean_assert(timestampTolerance >= 0.0);
+
+	if (frameMediums.empty() || !syncedFramesCallbackFunction || timestampTolerance < 0.0)
+	{
+		return false;
+	}
+
+	release();
+
+	TemporaryScopedLock scopedLock(lock_);
+
+	frames_ = Frames(frameMediums.size());
+	cameras_ = SharedAnyCameras(frameMediums.size());
+	pendingFrames_ = std::vector<bool>(frameMediums.size(), false);
+
+	syncedFramesCallbackFunction_ = std::move(syncedFramesCallbackFunction);
+	timestampTolerance_ = timestampTolerance;
+
+	scopedLock.release();
+
+	FrameCallbackScopedSubscriptions subscriptions;
+	subscriptions.reserve(frameMediums.size());
+
+	for (size_t n = 0; n < frameMediums.size(); ++n)
+	{
+		if (frameMediums[n].isNull())
+		{
+			release();
+			return false;
+		}
+
+		subscriptions.emplace_back(frameMediums[n]->addFrameCallback(std::bind(&SyncedFramesReceiver::onFrame, this, n, std::placeholders::_1, std::placeholders::_2)));
+	}
+
+	const ScopedLock lock(lock_);
+
+	subscriptions_ = std::move(subscriptions);
+
+	return true;
+}
+
+void FrameMedium::SyncedFramesReceiver::release()
+{
+	TemporaryScopedLock scopedLock(lock_);
+
+	FrameCallbackScopedSubscriptions subscriptions(std::move(subscriptions_));
+	subscriptions_.clear();
+
+	scopedLock.release();
+
+	// the subscriptions are released without holding the lock, as a medium may currently deliver a frame
+
+	subscriptions.clear();
+
+	scopedLock.relock(lock_);
+
+	frames_.clear();
+	cameras_.clear();
+	pendingFrames_.clear();
+
+	syncedFramesCallbackFunction_ = nullptr;
+}
+
+void FrameMedium::SyncedFramesReceiver::onFrame(const size_t mediumIndex, const Frame& frame, const SharedAnyCamera& camera)
+{
+	ocean_assert(frame.isValid());
+
+	const ScopedLock scopedLock(lock_);
+
+	if (mediumIndex >= frames_.size())
+	{
+		// the receiver has been released in the meantime
+		return;
+	}
+
+	// the frame memory of the previous frame is re-used whenever possible
+
+	Frame& targetFrame = frames_[mediumIndex];
+
+	if (!targetFrame.set(frame.frameType(), true /*forceOwner*/, true /*forceWritable*/) || !targetFrame.copy(0, 0, frame))
+	{
+		ocean_assert(false && "This should never happen!");
+		return;
+	}
+
+	targetFrame.setTimestamp(frame.timestamp());
+	targetFrame.setRelativeTimestamp(frame.relativeTimestamp());
+
+	cameras_[mediumIndex] = camera;
+	pendingFrames_[mediumIndex] = true;
+
+	const double timestamp = double(frame.timestamp());
+
+	for (size_t n = 0; n < frames_.size(); ++n)
+	{
+		if (!pendingFrames_[n] || NumericD::abs(double(frames_[n].timestamp()) - timestamp) > timestampTolerance_)
+		{
+			// at least one medium has not yet delivered the corresponding frame
+			return;
+		}
+	}
+
+	ocean_assert(syncedFramesCallbackFunction_);
+	syncedFramesCallbackFunction_(frames_, cameras_);
+
+	pendingFrames_.assign(pendingFrames_.size(), false);
+}
+
 FrameMedium::FrameMedium(const std::string& url) :
 	Medium(url)
 {
@@ -233,21 +349,74 @@ FrameRef FrameMedium::frameTimeout(const double timeout, SharedAnyCamera* anyCam
 		return frameRef;
 	}
 
-	const Timestamp startTimestamp(true);
+	const std::chrono::steady_clock::time_point timeoutTimestamp = std::chrono::steady_clock::now() + std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(timeout));
+
+	++numberFrameWaiters_;
+
+	std::unique_lock<std::mutex> uniqueLock(newFrameMutex_);
 
-	while (!startTimestamp.hasTimePassed(timeout))
+	while (true)
 	{
 		frameRef = frame(anyCamera);
 
-		if (frameRef)
+		if (frameRef || newFrameCondition_.wait_until(uniqueLock, timeoutTimestamp) == std::cv_status::timeout)
 		{
-			return frameRef;
+			break;
 		}
+	}
 
-		Thread::sleep(1u);
+	uniqueLock.unlock();
+
+	--numberFrameWaiters_;
+
+	if (frameRef.isNull())
+	{
+		frameRef = frame(anyCamera);
 	}
 
-	return FrameRef();
+	return frameRef;
+}
+
+FrameRef FrameMedium::waitForFrame(const Timestamp timestamp, const double timestampTolerance, const double timeout, SharedAnyCamera* anyCamera) const
+{
+	ocean_assert(timestamp.isValid());
+	ocean_assert(timestampTolerance >= 0.0 && timeout >= 0.0);
+
+	FrameRef frameRef(frameCollection_.closest(timestamp, timestampTolerance, anyCamera));
+
+	if (frameRef || timeout <= 0.0)
+	{
+		return frameRef;
+	}
+
+	const std::chrono::steady_clock::time_point timeoutTimestamp = std::chrono::steady_clock::now() + std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(timeout));
+
+	// the waiter is registered before the frame collection is checked again, so that deliverNewFrame() either sees the waiter or the frame is found here
+
+	++numberFrameWaiters_;
+
+	std::unique_lock<std::mutex> uniqueLock(newFrameMutex_);
+
+	while (true)
+	{
+		frameRef = frameCollection_.closest(timestamp, timestampTolerance, anyCamera);
+
+		if (frameRef || newFrameCondition_.wait_until(uniqueLock, timeoutTimestamp) == std::cv_status::timeout)
+		{
+			break;
+		}
+	}
+
+	uniqueLock.unlock();
+
+	--numberFrameWaiters_;
+
+	if (frameRef.isNull())
+	{
+		frameRef = frameCollection_.closest(timestamp, timestampTolerance, anyCamera);
+	}
+
+	return frameRef;
 }
 
 bool FrameMedium::hasFrame(const Timestamp timestamp) const
@@ -313,8 +482,10 @@ FrameMedium::FrameCallbackScopedSubscription FrameMedium::addFrameCallback(Frame
 	return frameCallbackHandler_.addCallback(std::move(frameCallbackFunction));
 }
 
-bool FrameMedium::syncedFrames(const FrameMediumRefs& frameMediums, const Timestamp lastTimestamp, FrameRefs& frames, SharedAnyCameras& cameras, const unsigned int waitTime, bool* timedOut, HomogenousMatricesD4* device_T_cameras)
+bool FrameMedium::syncedFrames(const FrameMediumRefs& frameMediums, const Timestamp lastTimestamp, FrameRefs& frames, SharedAnyCameras& cameras, const unsigned int waitTime, bool* timedOut, HomogenousMatricesD4* device_T_cameras, const double timestampTolerance)
 {
+	ocean_assert(timestampTolerance >= 0.0);
+
 	if (timedOut != nullptr)
 	{
 		*timedOut = false;
@@ -365,31 +536,25 @@ bool FrameMedium::syncedFrames(const FrameMediumRefs& frameMediums, const Timest
 
 	const Timestamp startTimestamp(true);
 
-	for (size_t n = 1; n < frameMediums.size(); /*noop*/)
+	for (size_t n = 1; n < frameMediums.size(); ++n)
 	{
 		ocean_assert(frameMediums[n]);
 
-		frame = frameMediums[n]->frame(timestamp, &camera);
+		const double remainingWaitTime = std::max(0.0, double(waitTime) * 0.001 - double(Timestamp(true) - startTimestamp));
 
-		if (frame.isNull() || frame->timestamp() != timestamp)
+		frame = frameMediums[n]->waitForFrame(timestamp, timestampTolerance, remainingWaitTime, &camera);
+
+		if (frame.isNull())
 		{
-			if (startTimestamp + double(waitTime) * 0.001 > Timestamp(true))
+			frames.clear();
+			cameras.clear();
+
+			if (timedOut != nullptr)
 			{
-				Thread::sleep(1u);
-				continue;
+				*timedOut = true;
 			}
-			else
-			{
-				frames.clear();
-				cameras.clear();
-
-				if (timedOut != nullptr)
-				{
-					*timedOut = true;
-				}
 
-				return false;
-			}
+			return false;
 		}
 
 		frames.emplace_back(std::move(frame));
@@ -399,8 +564,6 @@ bool FrameMedium::syncedFrames(const FrameMediumRefs& frameMediums, const Timest
 		{
 			device_T_cameras->emplace_back(frameMediums[n]->device_T_camera());
 		}
-
-		++n;
 	}
 
 	ocean_assert(frames.size() == cameras.size());
@@ -409,6 +572,22 @@ bool FrameMedium::syncedFrames(const FrameMediumRefs& frameMediums, const Timest
 	return true;
 }
 
+void FrameMedium::notifyFrameWaiters()
+{
+	if (numberFrameWaiters_.load() == 0u)
+	{
+		return;
+	}
+
+	{
+		// the mutex ensures that a waiting thread is either waiting already or will check the frame collection again
+
+		const std::lock_guard<std::mutex> lockGuard(newFrameMutex_);
+	}
+
+	newFrameCondition_.notify_all();
+}
+
 bool FrameMedium::deliverNewFrame(Frame&& frame, SharedAnyCamera&& anyCamera)
 {
 	ocean_assert(frame.isValid());
@@ -422,18 +601,20 @@ bool FrameMedium::deliverNewFrame(Frame&& frame, SharedAnyCamera&& anyCamera)
 
 	if (frameCallbackHandler_.isEmpty())
 	{
+		bool result = false;
+
 		if (frame.isOwner())
 		{
-			const FrameRef frameRef = frameCollection_.set(std::move(frame), std::move(anyCamera));
-
-			return bool(frameRef);
+			result = bool(frameCollection_.set(std::move(frame), std::move(anyCamera)));
 		}
 		else
 		{
-			const FrameRef frameRef = frameCollection_.set(frame, std::move(anyCamera));
-
-			return bool(frameRef);
+			result = bool(frameCollection_.set(frame, std::move(anyCamera)));
 		}
+
+		notifyFrameWaiters();
+
+		return result;
 	}
 
 	frameCallbackHandler_.callCallbacks(frame, anyCamera);
@@ -20,7 +20,10 @@
 #include "ocean/math/AnyCamera.h"
 #include "ocean/math/HomogenousMatrix4.h"
 
+#include <atomic>
+#include <condition_variable>
 #include <functional>
+#include <mutex>
 
 namespace Ocean
 {
@@ -289,6 +292,101 @@ class OCEAN_MEDIA_EXPORT FrameMedium : virtual public Medium
 				Lock lock_;
 		};
 
+		/**
+		 * Definition of a vector holding subscription objects for frame callback events.
+		 */
+		using FrameCallbackScopedSubscriptions = std::vector<FrameCallbackScopedSubscription>;
+
+		/**
+		 * This class implements a receiver for synchronized frames of several frame mediums, e.g., the cameras of a stereo rig.
+		 * The receiver subscribes to the frame callbacks of all mediums and invokes a callback function as soon as all mediums have delivered frames with matching timestamps.<br>
+		 * The callback function is invoked from the thread of the medium which delivered the last frame of the synchronized set.<br>
+		 * Beware: As long as the receiver is initialized, the mediums do not store their frames in their internal frame collections.
+		 * Below the code showing how to use the SyncedFramesReceiver.
+		 * @code
+		 * Media::FrameMediumRefs frameMediums = ...;
+		 *
+		 * FrameMedium::SyncedFramesReceiver syncedFramesReceiver;
+		 *
+		 * syncedFramesReceiver.initialize(frameMediums, [](const Frames& frames, const SharedAnyCameras& cameras)
+		 * {
+		 *     // all frames have (almost) identical timestamps
+		 * });
+		 * @endcode
+		 * @see syncedFrames().
+		 */
+		class OCEAN_MEDIA_EXPORT SyncedFramesReceiver final
+		{
+			public:
+
+				/**
+				 * Definition of a callback function for synchronized frames.
+				 * The frames are valid only while the callback function is executed.
+				 * @param frames The synchronized frames, one for each frame medium
+				 * @param cameras The camera profiles associated with the frames, one for each frame medium, invalid if unknown
+				 */
+				using SyncedFramesCallbackFunction = std::function<void(const Frames& frames, const SharedAnyCameras& cameras)>;
+
+			public:
+
+				/**
+				 * Default constructor.
+				 */
+				SyncedFramesReceiver() = default;
+
+				/**
+				 * Releases and destructs this object.
+				 */
+				~SyncedFramesReceiver();
+
+				/**
+				 * Initializes the receiver and subscribes to the frame callbacks of all mediums.
+				 * @param frameMediums The frame mediums providing the frames to be synchronized, at least one
+				 * @param syncedFramesCallbackFunction The callback function which will be invoked for each set of synchronized frames, must be valid
+				 * @param timestampTolerance The maximal difference between the timestamps of synchronized frames, in seconds, with range [0, infinity)
+				 * @return True, if succeeded
+				 */
+				bool initialize(const FrameMediumRefs& frameMediums, SyncedFramesCallbackFunction syncedFramesCallbackFunction, const double timestampTolerance = 0.0);
+
+				/**
+				 * Releases the receiver and unsubscribes from all mediums.
+				 */
+				void release();
+
+			protected:
+
+				/**
+				 * Event function for a new frame of one of the mediums.
+				 * @param mediumIndex The index of the medium which delivered the frame
+				 * @param frame The new frame, will be valid
+				 * @param camera The camera profile associated with the frame, invalid if unknown
+				 */
+				void onFrame(const size_t mediumIndex, const Frame& frame, const SharedAnyCamera& camera);
+
+			protected:
+
+				/// The subscriptions for the frame callbacks, one for each medium.
+				FrameCallbackScopedSubscriptions subscriptions_;
+
+				/// The most recent frames of all mediums, the memory is re-used for new frames.
+				Frames frames_;
+
+				/// The camera profiles of the most recent frames.
+				SharedAnyCameras cameras_;
+
+				/// True, for each frame which has not yet been part of a synchronized set.
+				std::vector<bool> pendingFrames_;
+
+				/// The callback function for synchronized frames.
+				SyncedFramesCallbackFunction syncedFramesCallbackFunction_;
+
+				/// The maximal difference between the timestamps of synchronized frames, in seconds.
+				double timestampTolerance_ = 0.0;
+
+				/// The object's lock.
+				Lock lock_;
+		};
+
 	protected:
 
 		/**
@@ -387,6 +485,18 @@ class OCEAN_MEDIA_EXPORT FrameMedium : virtual public Medium
 		 */
 		virtual FrameRef frameTimeout(const double timeout, SharedAnyCamera* anyCamera = nullptr) const;
 
+		/**
+		 * Waits until this medium provides a frame with a specific timestamp.
+		 * The function does not poll but wakes up as soon as the medium delivers a new frame.<br>
+		 * Frames are forwarded to frame callbacks instead of being stored while at least one frame callback is registered, in this case the function will time out.
+		 * @param timestamp The timestamp of the frame to wait for, must be valid
+		 * @param timestampTolerance The maximal difference between the given timestamp and the timestamp of the frame, in seconds, with range [0, infinity)
+		 * @param timeout Time to wait for the frame, in seconds, with range [0, infinity)
+		 * @param anyCamera Optional resulting camera profile of the frame, if known
+		 * @return The frame closest to the given timestamp, invalid if no such frame was delivered before the timeout
+		 */
+		FrameRef waitForFrame(const Timestamp timestamp, const double timestampTolerance, const double timeout, SharedAnyCamera* anyCamera = nullptr) const;
+
 		/**
 		 * Returns whether this media object currently holds a frame with specified timestamp.
 		 * Beware: There is no guarantee that the frame will be available after this call due to multi-thread issues!
@@ -511,6 +621,7 @@ class OCEAN_MEDIA_EXPORT FrameMedium : virtual public Medium
 
 		/**
 		 * Extracts most recent frames from several frame medium objects and ensures that the timestamps of all frames are identical.
+		 * The function waits for the remaining frame mediums without polling and returns as soon as the last frame medium has delivered the corresponding frame.
 		 * @param frameMediums The frame medium objects from which the frames will be extracted, at least one
 		 * @param lastTimestamp The timestamp of the last extracted frames to accept frames with newer timestamp only, an invalid timestamp to accept any frame
 		 * @param frames The resulting frames with identical timestamp, one for each frame medium object
@@ -518,9 +629,11 @@ class OCEAN_MEDIA_EXPORT FrameMedium : virtual public Medium
 		 * @param waitTime The wait time in milliseconds this function will wait until it fails if not all frame medium objects can provide the expected frame
 		 * @param timedOut Optional resulting True in case the function timed out when waiting for all synced frames; nullptr if not of interest
 		 * @param device_T_cameras Optional resulting transformations between camera and device, one for each frame medium object; nullptr if not of interest
+		 * @param timestampTolerance The maximal difference between the timestamp of the first frame and the timestamps of the remaining frames, in seconds, with range [0, infinity)
 		 * @return True, if succeeded
+		 * @see SyncedFramesReceiver.
 		 */
-		static bool syncedFrames(const FrameMediumRefs& frameMediums, const Timestamp lastTimestamp, FrameRefs& frames, SharedAnyCameras& cameras, const unsigned int waitTime = 2u, bool* timedOut = nullptr, HomogenousMatricesD4* device_T_cameras = nullptr);
+		static bool syncedFrames(const FrameMediumRefs& frameMediums, const Timestamp lastTimestamp, FrameRefs& frames, SharedAnyCameras& cameras, const unsigned int waitTime = 2u, bool* timedOut = nullptr, HomogenousMatricesD4* device_T_cameras = nullptr, const double timestampTolerance = 0.0);
 
 	protected:
 
@@ -539,6 +652,12 @@ class OCEAN_MEDIA_EXPORT FrameMedium : virtual public Medium
 		 */
 		virtual bool deliverNewFrame(Frame&& frame, SharedAnyCamera&& anyCamera = SharedAnyCamera());
 
+		/**
+		 * Wakes up all threads waiting for a new frame of this medium.
+		 * The function does not acquire any lock if no thread is waiting.
+		 */
+		void notifyFrameWaiters();
+
 	protected:
 
 		/// Frame collection storing several frames with different timestamps.
@@ -552,6 +671,15 @@ class OCEAN_MEDIA_EXPORT FrameMedium : virtual public Medium
 
 		/// Preferred frame type of the medium.
 		MediaFrameType preferredFrameType_;
+
+		/// The number of threads currently waiting for a new frame.
+		mutable std::atomic<unsigned int> numberFrameWaiters_ = 0u;
+
+		/// The mutex for the condition variable of new frames.
+		mutable std::mutex newFrameMutex_;
+
+		/// The condition variable notified whenever a new frame has been delivered while at least one thread is waiting.
+		mutable std::condition_variable newFrameCondition_;
 };
 
 inline FrameMedium::MediaFrameType::MediaFrameType(const FrameType& frameType, const FrameFrequency frequency) :
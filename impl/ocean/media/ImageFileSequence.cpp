@@ -7,6 +7,8 @@
 
 #include "ocean/media/ImageFileSequence.h"
 
+#include "ocean/base/Processor.h"
+
 #include "ocean/io/Directory.h"
 #include "ocean/io/File.h"
 
@@ -31,6 +33,8 @@ ImageFileSequence::ImageFileSequence(const std::string& url) :
 ImageFileSequence::~ImageFileSequence()
 {
 	stopThreadExplicitly();
+
+	cancelPrefetching(true /*waitForJobs*/);
 }
 
 double ImageFileSequence::duration() const
@@ -187,6 +191,8 @@ bool ImageFileSequence::stop()
 
 	nextFrame_.release();
 
+	cancelPrefetching();
+
 	return true;
 }
 
@@ -225,6 +231,13 @@ bool ImageFileSequence::setPosition(const double position)
 		return false;
 	}
 
+	if (frameIndex_ != (unsigned int)(frameIndex))
+	{
+		// a seek invalidates all prefetched images
+
+		cancelPrefetching();
+	}
+
 	frameIndex_ = (unsigned int)(frameIndex);
 	return true;
 }
@@ -264,28 +277,62 @@ bool ImageFileSequence::forceNextFrame()
 
 	// try to load the next frame
 	++frameIndex_;
-	IO::File nextFile(imageFilename(frameIndex_));
 
-	if (!nextFile.exists())
+	if (takePrefetchedImage(frameIndex_, nextFrame_))
+	{
+		nextFrame_.setTimestamp(Timestamp(true));
+	}
+	else
 	{
-		if (!loop_)
+		IO::File nextFile(imageFilename(frameIndex_));
+
+		if (!nextFile.exists())
 		{
-			startTimestamp_.toInvalid();
-			pauseTimestamp_.toInvalid();
-			stopTimestamp_.toNow();
-			return false;
+			if (!loop_)
+			{
+				startTimestamp_.toInvalid();
+				pauseTimestamp_.toInvalid();
+				stopTimestamp_.toNow();
+				return false;
+			}
+
+			frameIndex_ = frameStartIndex_;
+			nextFile = IO::File(imageFilename(frameIndex_));
 		}
 
-		frameIndex_ = frameStartIndex_;
-		nextFile = IO::File(imageFilename(frameIndex_));
+		if (!loadImage(nextFile(), Timestamp(true), &nextFrame_))
+		{
+			return false;
+		}
 	}
 
-	if (!loadImage(nextFile(), Timestamp(true), &nextFrame_))
+	schedulePrefetching(frameIndex_ + 1u);
+
+	return deliverNewFrame(std::move(nextFrame_), SharedAnyCamera(camera_));
+}
+
+bool ImageFileSequence::setPrefetching(const unsigned int numberImages, const size_t maximalMemory)
+{
+	ocean_assert(maximalMemory >= 1);
+
+	if (maximalMemory == 0)
 	{
 		return false;
 	}
 
-	return deliverNewFrame(std::move(nextFrame_), SharedAnyCamera(camera_));
+	const ScopedLock scopedLock(lock_);
+
+	cancelPrefetching(true /*waitForJobs*/);
+
+	prefetchNumberImages_ = numberImages;
+	prefetchMaximalMemory_ = maximalMemory;
+
+	if (numberImages != 0u)
+	{
+		prefetchThreadPool_.setCapacity(std::max(1u, std::min(numberImages, Processor::get().cores())));
+	}
+
+	return true;
 }
 
 bool ImageFileSequence::isFileSequence(const std::string& filename, bool* isIndividualImage)
@@ -409,12 +456,20 @@ void ImageFileSequence::threadRun()
 		++frameIndex_;
 		const IO::File nextFile(imageFilename(frameIndex_));
 
-		if (nextFile.exists())
+		if (takePrefetchedImage(frameIndex_, nextFrame_))
+		{
+			nextFrame_.setTimestamp(timestamp);
+
+			schedulePrefetching(frameIndex_ + 1u);
+		}
+		else if (nextFile.exists())
 		{
 			if (!loadImage(nextFile(), timestamp, &nextFrame_))
 			{
 				break;
 			}
+
+			schedulePrefetching(frameIndex_ + 1u);
 		}
 		else
 		{
@@ -488,6 +543,149 @@ bool ImageFileSequence::determineSequence()
 	return true;
 }
 
+void ImageFileSequence::schedulePrefetching(const unsigned int firstIndex)
+{
+	if (prefetchNumberImages_ == 0u)
+	{
+		return;
+	}
+
+	const std::unique_lock<std::mutex> uniqueLock(prefetchMutex_);
+
+	for (unsigned int n = 0u; n < prefetchNumberImages_; ++n)
+	{
+		const unsigned int index = firstIndex + n;
+
+		if (prefetchedImages_.find(index) != prefetchedImages_.cend())
+		{
+			continue;
+		}
+
+		// the memory of images still being decoded is estimated based on the most recently decoded image
+
+		if (prefetchedMemory_ + size_t(prefetchPendingImages_ + 1u) * prefetchImageMemory_ > prefetchMaximalMemory_)
+		{
+			break;
+		}
+
+		const IO::File file(imageFilename(index));
+
+		if (!file.exists())
+		{
+			// we do not prefetch beyond the end of the sequence
+			break;
+		}
+
+		prefetchedImages_.emplace(index, Frame());
+
+		++prefetchPendingImages_;
+		++prefetchActiveJobs_;
+
+		const unsigned int generation = prefetchGeneration_;
+
+		prefetchThreadPool_.invoke(std::bind(&ImageFileSequence::prefetchImage, this, index, file(), generation));
+	}
+}
+
+bool ImageFileSequence::takePrefetchedImage(const unsigned int index, Frame& frame)
+{
+	if (prefetchNumberImages_ == 0u)
+	{
+		return false;
+	}
+
+	std::unique_lock<std::mutex> uniqueLock(prefetchMutex_);
+
+	while (true)
+	{
+		const std::unordered_map<unsigned int, Frame>::iterator iImage = prefetchedImages_.find(index);
+
+		if (iImage == prefetchedImages_.end())
+		{
+			// the image has not been prefetched, or the decoding failed
+			return false;
+		}
+
+		if (iImage->second.isValid())
+		{
+			ocean_assert(prefetchedMemory_ >= iImage->second.size());
+			prefetchedMemory_ -= iImage->second.size();
+
+			frame = std::move(iImage->second);
+			prefetchedImages_.erase(iImage);
+
+			return true;
+		}
+
+		// the image is still being decoded
+
+		prefetchCondition_.wait(uniqueLock);
+	}
+}
+
+void ImageFileSequence::cancelPrefetching(const bool waitForJobs)
+{
+	std::unique_lock<std::mutex> uniqueLock(prefetchMutex_);
+
+	// running jobs of the previous generation will discard their images
+
+	++prefetchGeneration_;
+
+	prefetchedImages_.clear();
+	prefetchedMemory_ = 0;
+	prefetchPendingImages_ = 0u;
+
+	if (waitForJobs)
+	{
+		prefetchCondition_.wait(uniqueLock, [this]() { return prefetchActiveJobs_ == 0u; });
+	}
+}
+
+void ImageFileSequence::prefetchImage(const unsigned int index, const std::string& filename, const unsigned int generation)
+{
+	bool canceled = false;
+
+	{
+		const std::unique_lock<std::mutex> uniqueLock(prefetchMutex_);
+
+		canceled = generation != prefetchGeneration_;
+	}
+
+	Frame frame;
+
+	if (!canceled && !loadImage(filename, Timestamp(false), &frame))
+	{
+		frame.release();
+	}
+
+	{
+		const std::unique_lock<std::mutex> uniqueLock(prefetchMutex_);
+
+		if (generation == prefetchGeneration_)
+		{
+			ocean_assert(prefetchPendingImages_ >= 1u);
+			--prefetchPendingImages_;
+
+			if (frame.isValid())
+			{
+				prefetchImageMemory_ = frame.size();
+				prefetchedMemory_ += frame.size();
+
+				prefetchedImages_[index] = std::move(frame);
+			}
+			else
+			{
+				prefetchedImages_.erase(index);
+			}
+		}
+
+		ocean_assert(prefetchActiveJobs_ >= 1u);
+		--prefetchActiveJobs_;
+	}
+
+	prefetchCondition_.notify_all();
+}
+
 std::string ImageFileSequence::imageFilename(const unsigned int index) const
 {
 	const std::string numberString(String::toAString(index));
@@ -12,9 +12,14 @@
 #include "ocean/media/ImageSequence.h"
 
 #include "ocean/base/Thread.h"
+#include "ocean/base/ThreadPool.h"
 
 #include "ocean/math/AnyCamera.h"
 
+#include <condition_variable>
+#include <mutex>
+#include <unordered_map>
+
 namespace Ocean
 {
 
@@ -23,7 +28,8 @@ namespace Media
 
 /*
  * This class implements the base class for all image sequences based on actual files (and not on databases containing images).
- * the class is mainly an intermediate helper class to simplify the implementation of an ImageSequence based on files.
+ * the class is mainly an intermediate helper class to simplify the implementation of an ImageSequence based on files.<br>
+ * Optionally, the sequence can decode upcoming images in parallel before they are needed, see setPrefetching().
  * @ingroup media
  */
 class OCEAN_MEDIA_EXPORT ImageFileSequence :
@@ -137,6 +143,16 @@ class OCEAN_MEDIA_EXPORT ImageFileSequence :
 		 */
 		bool forceNextFrame() override;
 
+		/**
+		 * Enables or disables the prefetching of upcoming images.
+		 * When enabled, the next images of the sequence are decoded in parallel on a thread pool while the current image is delivered.<br>
+		 * The decoded images are kept in a bounded queue, setting a new position cancels all outstanding prefetching.
+		 * @param numberImages The number of upcoming images to prefetch, 0 to disable prefetching, with range [0, infinity)
+		 * @param maximalMemory The maximal memory all prefetched images (decoded or still decoding) may use, in bytes, with range [1, infinity)
+		 * @return True, if succeeded
+		 */
+		bool setPrefetching(const unsigned int numberImages, const size_t maximalMemory = 256 * 1024 * 1024);
+
 		/**
 		 * Returns whether a given filename is the start of an image file sequence.
 		 * The function checks whether the file exists, whether the filename ends with a numeric index pattern, and whether a subsequent image file exists at the next index.
@@ -178,8 +194,39 @@ class OCEAN_MEDIA_EXPORT ImageFileSequence :
 		 */
 		std::string imageFilename(const unsigned int index) const;
 
+		/**
+		 * Schedules the prefetching of the images following a specific image.
+		 * The lock of this medium must be locked.
+		 * @param firstIndex The index of the first image to prefetch
+		 */
+		void schedulePrefetching(const unsigned int firstIndex);
+
+		/**
+		 * Takes a prefetched image from the prefetch queue.
+		 * In case the image is still being decoded, the function waits until the decoding has finished.
+		 * @param index The index of the image to take
+		 * @param frame The resulting image, if succeeded
+		 * @return True, if the image had been prefetched successfully; False, if the image needs to be loaded explicitly
+		 */
+		bool takePrefetchedImage(const unsigned int index, Frame& frame);
+
+		/**
+		 * Cancels all outstanding prefetching and releases all prefetched images.
+		 * @param waitForJobs True, to wait until all decoding jobs have finished; False, to let running jobs finish in the background
+		 */
+		void cancelPrefetching(const bool waitForJobs = false);
+
+		/**
+		 * Decodes one image for the prefetch queue, this function is executed on the thread pool.
+		 * @param index The index of the image to decode
+		 * @param filename The filename of the image to decode
+		 * @param generation The generation of the prefetch queue when the job was scheduled, used to detect canceled jobs
+		 */
+		void prefetchImage(const unsigned int index, const std::string& filename, const unsigned int generation);
+
 		/**
 		 * Loads a new image specified by the filename.
+		 * The function must be thread-safe if a frame is provided, as the function is invoked for prefetched images from several threads.
 		 * @param filename The filename of the image to be loaded
 		 * @param timestamp Frame timestamp to be used
 		 * @param frame Optional frame receiving the image data, otherwise the frame will be added to the frame container
@@ -209,6 +256,39 @@ class OCEAN_MEDIA_EXPORT ImageFileSequence :
 
 		/// The camera profile for all images.
 		SharedAnyCamera camera_;
+
+		/// The number of images to prefetch, 0 if prefetching is disabled.
+		unsigned int prefetchNumberImages_ = 0u;
+
+		/// The maximal memory of all prefetched images, in bytes.
+		size_t prefetchMaximalMemory_ = 0;
+
+		/// The thread pool decoding the prefetched images.
+		ThreadPool prefetchThreadPool_;
+
+		/// The prefetched images, mapping image indices to decoded images, invalid images are still being decoded.
+		std::unordered_map<unsigned int, Frame> prefetchedImages_;
+
+		/// The memory of all decoded prefetched images, in bytes.
+		size_t prefetchedMemory_ = 0;
+
+		/// The memory of the most recently decoded image, in bytes, used to estimate the memory of images still being decoded.
+		size_t prefetchImageMemory_ = 0;
+
+		/// The number of images which are still being decoded for the current generation.
+		unsigned int prefetchPendingImages_ = 0u;
+
+		/// The generation of the prefetch queue, incremented whenever the prefetching is canceled.
+		unsigned int prefetchGeneration_ = 0u;
+
+		/// The number of decoding jobs which have been scheduled but have not yet finished, including canceled jobs.
+		unsigned int prefetchActiveJobs_ = 0u;
+
+		/// The mutex protecting the prefetch queue.
+		std::mutex prefetchMutex_;
+
+		/// The condition variable notified whenever a decoding job has finished.
+		std::condition_variable prefetchCondition_;
 };
 
 }
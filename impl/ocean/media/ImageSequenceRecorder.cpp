@@ -34,6 +34,26 @@ unsigned int ImageSequenceRecorder::startIndex() const
 
 }
 
+unsigned int ImageSequenceRecorder::encoderThreads() const
+{
+	return encoderThreads_;
+}
+
+unsigned int ImageSequenceRecorder::maximalPendingImages() const
+{
+	return maximalPendingImages_;
+}
+
+unsigned int ImageSequenceRecorder::droppedImages() const
+{
+	return droppedImages_.load();
+}
+
+unsigned int ImageSequenceRecorder::peakPendingImages() const
+{
+	return peakPendingImages_.load();
+}
+
 bool ImageSequenceRecorder::setMode(const RecorderMode mode)
 {
 	recorderMode_ = mode;
@@ -46,6 +66,25 @@ bool ImageSequenceRecorder::setStartIndex(const unsigned int index)
 	return true;
 }
 
+bool ImageSequenceRecorder::setEncoderThreads(const unsigned int threads)
+{
+	ocean_assert(threads >= 1u);
+
+	if (threads == 0u)
+	{
+		return false;
+	}
+
+	encoderThreads_ = threads;
+	return true;
+}
+
+bool ImageSequenceRecorder::setMaximalPendingImages(const unsigned int maximalPendingImages)
+{
+	maximalPendingImages_ = maximalPendingImages;
+	return true;
+}
+
 bool ImageSequenceRecorder::addImage(const Frame& frame)
 {
 	if (!frame.isValid())
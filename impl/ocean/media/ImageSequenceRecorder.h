@@ -12,6 +12,8 @@
 #include "ocean/media/FileRecorder.h"
 #include "ocean/media/FrameRecorder.h"
 
+#include <atomic>
+
 namespace Ocean
 {
 
@@ -47,7 +49,7 @@ class OCEAN_MEDIA_EXPORT ImageSequenceRecorder :
 			RM_INVALID,
 			/// Immediate mode for immediate image saving.
 			RM_IMMEDIATE,
-			/// Parallel mode for image saving in parallel
+			/// Parallel mode for image saving in parallel, images are encoded concurrently with several encoder threads but written in the order in which they have been added.
 			RM_PARALLEL,
 			/// Explicit mode for image saving due to an explicit invocation.
 			RM_EXPLICIT
@@ -76,6 +78,33 @@ class OCEAN_MEDIA_EXPORT ImageSequenceRecorder :
 		 */
 		virtual unsigned int pendingImages() const = 0;
 
+		/**
+		 * Returns the number of encoder threads which are used in RM_PARALLEL mode.
+		 * @return The number of encoder threads, with range [1, infinity), the default is 1
+		 * @see setEncoderThreads().
+		 */
+		virtual unsigned int encoderThreads() const;
+
+		/**
+		 * Returns the maximal number of images which can be pending in RM_PARALLEL mode before new images are dropped.
+		 * @return The maximal number of pending images, 0 if the number of pending images is not limited, the default is 0
+		 * @see setMaximalPendingImages().
+		 */
+		virtual unsigned int maximalPendingImages() const;
+
+		/**
+		 * Returns the number of images which have been dropped since the recorder has been started because the maximal number of pending images was reached.
+		 * @return The number of dropped images
+		 */
+		virtual unsigned int droppedImages() const;
+
+		/**
+		 * Returns the largest number of pending images since the recorder has been started.
+		 * Together with droppedImages() this allows to determine whether the encoders can keep up with the frame rate.
+		 * @return The largest number of pending images
+		 */
+		virtual unsigned int peakPendingImages() const;
+
 		/**
 		 * Sets the mode of this recorder.
 		 * @param mode Mode to be set
@@ -92,6 +121,22 @@ class OCEAN_MEDIA_EXPORT ImageSequenceRecorder :
 		 */
 		virtual bool setStartIndex(const unsigned int index);
 
+		/**
+		 * Sets the number of encoder threads which are used in RM_PARALLEL mode.
+		 * @param threads The number of encoder threads, with range [1, infinity)
+		 * @return True, if succeeded
+		 * @see encoderThreads().
+		 */
+		virtual bool setEncoderThreads(const unsigned int threads);
+
+		/**
+		 * Sets the maximal number of images which can be pending in RM_PARALLEL mode, new images are dropped as long as the limit is reached.
+		 * @param maximalPendingImages The maximal number of pending images, 0 to avoid any limit
+		 * @return True, if succeeded
+		 * @see maximalPendingImages(), droppedImages().
+		 */
+		virtual bool setMaximalPendingImages(const unsigned int maximalPendingImages);
+
 		/**
 		 * Adds a given frame explicity.
 		 * @param frame The frame to be added
@@ -125,6 +170,18 @@ class OCEAN_MEDIA_EXPORT ImageSequenceRecorder :
 
 		/// Start index of the first frame.
 		unsigned int startIndex_ = 0u;
+
+		/// The number of encoder threads in RM_PARALLEL mode.
+		unsigned int encoderThreads_ = 1u;
+
+		/// The maximal number of pending images in RM_PARALLEL mode, 0 if unlimited.
+		unsigned int maximalPendingImages_ = 0u;
+
+		/// The number of images which have been dropped since the recorder has been started.
+		std::atomic<unsigned int> droppedImages_ = 0u;
+
+		/// The largest number of pending images since the recorder has been started.
+		std::atomic<unsigned int> peakPendingImages_ = 0u;
 };
 
 }
@@ -7,7 +7,10 @@
 
 #include "ocean/media/Manager.h"
 #include "ocean/media/PixelImage.h"
+#include "ocean/media/SharedFrameRingMedium.h"
 
+#include "ocean/base/PluginManager.h"
+#include "ocean/base/Processor.h"
 #include "ocean/base/String.h"
 
 #include "ocean/io/File.h"
@@ -20,7 +23,28 @@ namespace Media
 
 Manager::Manager()
 {
-	// nothing to do here
+	asyncThreadPool_.setCapacity(std::max(2u, Processor::get().cores()));
+}
+
+bool Manager::MediumAwaitable::await_suspend(std::coroutine_handle<> handle)
+{
+	handle_ = handle;
+
+	manager_.newMediumAsync(url_, type_, useExclusive_, [this](const MediumRef& medium)
+	{
+		medium_ = medium;
+
+		if (completed_.exchange(true))
+		{
+			// the coroutine is suspended already, so we resume the coroutine in this thread
+
+			handle_.resume();
+		}
+	});
+
+	// the callback may have been invoked already, e.g., if the medium existed already
+
+	return !completed_.exchange(true);
 }
 
 Manager::~Manager()
@@ -49,7 +73,7 @@ MediumRef Manager::newMedium(const std::string& url, bool useExclusive)
 {
 	ocean_assert(url.empty() == false);
 
-	const ScopedLock scopedLock(lock_);
+	TemporaryScopedLock scopedLock(lock_);
 
 	if (useExclusive == false)
 	{
@@ -79,6 +103,15 @@ MediumRef Manager::newMedium(const std::string& url, bool useExclusive)
 		}
 	}
 
+	// the manager must not be locked while a plugin is loaded, as the plugin registers its library
+
+	scopedLock.release();
+
+	if (loadPluginForFileExtension(fileExtension))
+	{
+		return newMedium(url, useExclusive);
+	}
+
 	return MediumRef();
 }
 
@@ -86,7 +119,7 @@ MediumRef Manager::newMedium(const std::string& url, const Medium::Type type, bo
 {
 	ocean_assert(url.empty() == false);
 
-	const ScopedLock scopedLock(lock_);
+	TemporaryScopedLock scopedLock(lock_);
 
 	if (useExclusive == false)
 	{
@@ -98,42 +131,18 @@ MediumRef Manager::newMedium(const std::string& url, const Medium::Type type, bo
 		}
 	}
 
-	const IO::File file(url);
-	const std::string fileExtension(String::toLower(file.extension()));
+	const MediumRef medium(createMedium(url, type, useExclusive, libraries_));
 
-	for (Libraries::iterator i = libraries_.begin(); i != libraries_.end(); ++i)
+	if (medium)
 	{
-		ocean_assert(i->first);
-
-		if (i->first->supports(type) && i->first->notSupported(fileExtension) == false)
-		{
-			const MediumRef medium(i->first->newMedium(url, type, useExclusive));
-
-			if (medium)
-			{
-				return medium;
-			}
-		}
+		return medium;
 	}
 
-	if (type == Medium::PIXEL_IMAGE)
-	{
-		PixelImage* pixelImage = new PixelImage(url);
-		ocean_assert(pixelImage != nullptr);
+	scopedLock.release();
 
-		if (pixelImage->isValid())
-		{
-			if (useExclusive)
-			{
-				return MediumRef(pixelImage);
-			}
-
-			return MediumRefManager::get().registerMedium(pixelImage);
-		}
-		else
-		{
-			delete pixelImage;
-		}
+	if (loadPluginForFileExtension(String::toLower(IO::File(url).extension())))
+	{
+		return newMedium(url, type, useExclusive);
 	}
 
 	return MediumRef();
@@ -171,6 +180,62 @@ MediumRef Manager::newMedium(const std::string& url, const std::string& library,
 	return MediumRef();
 }
 
+std::shared_future<MediumRef> Manager::newMediumAsync(const std::string& url, const Medium::Type type, const bool useExclusive, MediumCallback callback)
+{
+	ocean_assert(url.empty() == false);
+
+	std::shared_ptr<std::promise<MediumRef>> promise = std::make_shared<std::promise<MediumRef>>();
+	std::shared_future<MediumRef> future = promise->get_future().share();
+
+	Libraries libraries;
+
+	{
+		const ScopedLock scopedLock(lock_);
+
+		if (useExclusive == false)
+		{
+			MediumRef medium(MediumRefManager::get().medium(url, type));
+
+			if (medium)
+			{
+				promise->set_value(medium);
+
+				if (callback)
+				{
+					callback(medium);
+				}
+
+				return future;
+			}
+		}
+
+		// the medium will be created without holding the manager's lock, so that several media objects can be created concurrently
+
+		libraries = libraries_;
+	}
+
+	asyncThreadPool_.invoke([url, type, useExclusive, libraries = std::move(libraries), promise = std::move(promise), callback = std::move(callback)]()
+	{
+		MediumRef medium = createMedium(url, type, useExclusive, libraries);
+
+		promise->set_value(medium);
+
+		if (callback)
+		{
+			callback(medium);
+		}
+	});
+
+	return future;
+}
+
+Task<MediumRef> Manager::newMediumTask(std::string url, const Medium::Type type, const bool useExclusive)
+{
+	ocean_assert(!url.empty());
+
+	co_return co_await MediumAwaitable(*this, std::move(url), type, useExclusive);
+}
+
 RecorderRef Manager::newRecorder(const Recorder::Type type, const std::string& library)
 {
 	const ScopedLock scopedLock(lock_);
@@ -249,6 +314,13 @@ Manager::Names Manager::libraries() const
 
 void Manager::release()
 {
+	// we wait until all media objects which are created asynchronously are available
+
+	while (!asyncThreadPool_.isEmpty())
+	{
+		Thread::sleep(1u);
+	}
+
 	const ScopedLock scopedLock(lock_);
 
 	libraries_.clear();
@@ -284,6 +356,79 @@ bool Manager::unregisterLibrary(const std::string& name)
 	return false;
 }
 
+bool Manager::loadPluginForFileExtension(const std::string& fileExtension)
+{
+	if (fileExtension.empty())
+	{
+		return false;
+	}
+
+	return PluginManager::get().loadPluginForCapability(fileExtension, PluginManager::TYPE_MEDIA);
+}
+
+MediumRef Manager::createMedium(const std::string& url, const Medium::Type type, const bool useExclusive, const Libraries& libraries)
+{
+	const IO::File file(url);
+	const std::string fileExtension(String::toLower(file.extension()));
+
+	for (Libraries::const_iterator i = libraries.cbegin(); i != libraries.cend(); ++i)
+	{
+		ocean_assert(i->first);
+
+		if (i->first->supports(type) && i->first->notSupported(fileExtension) == false)
+		{
+			const MediumRef medium(i->first->newMedium(url, type, useExclusive));
+
+			if (medium)
+			{
+				return medium;
+			}
+		}
+	}
+
+	if (type == Medium::PIXEL_IMAGE)
+	{
+		PixelImage* pixelImage = new PixelImage(url);
+		ocean_assert(pixelImage != nullptr);
+
+		if (pixelImage->isValid())
+		{
+			if (useExclusive)
+			{
+				return MediumRef(pixelImage);
+			}
+
+			return MediumRefManager::get().registerMedium(pixelImage);
+		}
+		else
+		{
+			delete pixelImage;
+		}
+	}
+
+	if (type == Medium::SHARED_FRAME_RING)
+	{
+		SharedFrameRingMedium* sharedFrameRingMedium = new SharedFrameRingMedium(url);
+		ocean_assert(sharedFrameRingMedium != nullptr);
+
+		if (sharedFrameRingMedium->isValid())
+		{
+			if (useExclusive)
+			{
+				return MediumRef(sharedFrameRingMedium);
+			}
+
+			return MediumRefManager::get().registerMedium(sharedFrameRingMedium);
+		}
+		else
+		{
+			delete sharedFrameRingMedium;
+		}
+	}
+
+	return MediumRef();
+}
+
 }
 
 }
@@ -14,7 +14,11 @@
 #include "ocean/media/Recorder.h"
 
 #include "ocean/base/Singleton.h"
+#include "ocean/base/Task.h"
+#include "ocean/base/ThreadPool.h"
 
+#include <functional>
+#include <future>
 #include <vector>
 
 namespace Ocean
@@ -42,6 +46,73 @@ class OCEAN_MEDIA_EXPORT Manager : public Singleton<Manager>
 		 */
 		using Names = Strings;
 
+		/**
+		 * Definition of a callback function which is invoked once an asynchronously created medium is available.
+		 * The callback receives the new medium, an empty reference if the medium could not be created.
+		 */
+		using MediumCallback = std::function<void(const MediumRef& medium)>;
+
+	protected:
+
+		/**
+		 * This class implements an awaitable which creates a new medium asynchronously and resumes the awaiting coroutine once the medium is available.
+		 */
+		class MediumAwaitable
+		{
+			public:
+
+				/**
+				 * Creates a new awaitable.
+				 * @param manager The manager creating the medium
+				 * @param url Url of the medium, must be valid
+				 * @param type Type of the expected medium
+				 * @param useExclusive Determines whether the caller would like to use this medium exclusively
+				 */
+				inline MediumAwaitable(Manager& manager, std::string url, const Medium::Type type, const bool useExclusive);
+
+				/**
+				 * Returns whether the coroutine does not need to be suspended.
+				 * @return Always False
+				 */
+				constexpr bool await_ready() const noexcept;
+
+				/**
+				 * Starts the creation of the medium.
+				 * @param handle The handle of the awaiting coroutine
+				 * @return True, if the coroutine is suspended; False, if the medium is available already
+				 */
+				bool await_suspend(std::coroutine_handle<> handle);
+
+				/**
+				 * Returns the new medium.
+				 * @return The medium, an empty reference if the medium could not be created
+				 */
+				inline MediumRef await_resume();
+
+			protected:
+
+				/// The manager creating the medium.
+				Manager& manager_;
+
+				/// The url of the medium.
+				std::string url_;
+
+				/// The type of the expected medium.
+				Medium::Type type_;
+
+				/// True, to use the medium exclusively.
+				bool useExclusive_;
+
+				/// The new medium.
+				MediumRef medium_;
+
+				/// The handle of the awaiting coroutine.
+				std::coroutine_handle<> handle_;
+
+				/// True, as soon as either the medium is available or the coroutine is suspended; whoever comes second resumes the coroutine.
+				std::atomic<bool> completed_ = false;
+		};
+
 	private:
 
 		/**
@@ -58,6 +129,7 @@ class OCEAN_MEDIA_EXPORT Manager : public Singleton<Manager>
 
 		/**
 		 * Creates a new medium by a given url.
+		 * If no registered library can create the medium, a collected plugin declaring the url's file extension is loaded on demand, see PluginManager::loadPluginForCapability().<br>
 		 * If no medium can be created an empty reference is returned.
 		 * @param url Url of the medium
 		 * @param useExclusive Determines whether the caller would like to use this medium exclusively
@@ -67,6 +139,7 @@ class OCEAN_MEDIA_EXPORT Manager : public Singleton<Manager>
 
 		/**
 		 * Creates a new medium by a given url and an expected type.
+		 * If no registered library can create the medium, a collected plugin declaring the url's file extension is loaded on demand, see PluginManager::loadPluginForCapability().<br>
 		 * If no medium can be created an empty reference is returned.
 		 * @param url Url of the medium
 		 * @param type Type of the expected medium
@@ -86,6 +159,30 @@ class OCEAN_MEDIA_EXPORT Manager : public Singleton<Manager>
 		 */
 		MediumRef newMedium(const std::string& url, const std::string& library, const Medium::Type type, bool useExclusive = false);
 
+		/**
+		 * Creates a new medium by a given url and an expected type asynchronously.
+		 * The medium is created (e.g., the image is decoded) in a thread pool so that several media objects can be loaded in parallel while the caller continues, e.g., to render a placeholder.<br>
+		 * In case the medium exists already (and is not requested exclusively), the medium is provided immediately and the callback is invoked in the calling thread.
+		 * @param url Url of the medium, must be valid
+		 * @param type Type of the expected medium
+		 * @param useExclusive Determines whether the caller would like to use this medium exclusively
+		 * @param callback Optional callback function which will be invoked once the medium is available (or could not be created), the callback is invoked in a thread of the thread pool
+		 * @return The future providing the new medium, an empty reference if the medium could not be created
+		 */
+		std::shared_future<MediumRef> newMediumAsync(const std::string& url, const Medium::Type type, const bool useExclusive = false, MediumCallback callback = MediumCallback());
+
+		/**
+		 * Creates a new medium by a given url and an expected type within a coroutine.
+		 * The awaiting coroutine is suspended while the medium is created and continues in a thread of the manager's thread pool.<br>
+		 * In case the medium exists already (and is not requested exclusively), the awaiting coroutine continues immediately.
+		 * @param url Url of the medium, must be valid
+		 * @param type Type of the expected medium
+		 * @param useExclusive Determines whether the caller would like to use this medium exclusively
+		 * @return The task providing the new medium, an empty reference if the medium could not be created
+		 * @see newMediumAsync(), Task.
+		 */
+		Task<MediumRef> newMediumTask(std::string url, const Medium::Type type, const bool useExclusive = false);
+
 		/**
 		 * Creates a new recorder specified by the recorder type.
 		 * @param type Type of the recorder to return
@@ -154,6 +251,25 @@ class OCEAN_MEDIA_EXPORT Manager : public Singleton<Manager>
 		 */
 		bool unregisterLibrary(const std::string& name);
 
+		/**
+		 * Creates a new medium by a given url and an expected type from a given set of libraries.
+		 * The function does not check whether the medium exists already.
+		 * @param url Url of the medium, must be valid
+		 * @param type Type of the expected medium
+		 * @param useExclusive Determines whether the caller would like to use this medium exclusively
+		 * @param libraries The libraries to be used, sorted by priority
+		 * @return Reference to the new medium
+		 */
+		static MediumRef createMedium(const std::string& url, const Medium::Type type, const bool useExclusive, const Libraries& libraries);
+
+		/**
+		 * Loads a collected media plugin declaring a file extension, e.g., a plugin which has not been loaded at startup.
+		 * The manager must not be locked when calling this function.
+		 * @param fileExtension The file extension for which a plugin will be loaded, in lower case, can be empty
+		 * @return True, if a plugin has been loaded
+		 */
+		static bool loadPluginForFileExtension(const std::string& fileExtension);
+
 	protected:
 
 		/// Registered libraries.
@@ -161,8 +277,30 @@ class OCEAN_MEDIA_EXPORT Manager : public Singleton<Manager>
 
 		/// Lock for the libraries.
 		mutable Lock lock_;
+
+		/// The thread pool in which media objects are created asynchronously.
+		ThreadPool asyncThreadPool_;
 };
 
+inline Manager::MediumAwaitable::MediumAwaitable(Manager& manager, std::string url, const Medium::Type type, const bool useExclusive) :
+	manager_(manager),
+	url_(std::move(url)),
+	type_(type),
+	useExclusive_(useExclusive)
+{
+	ocean_assert(!url_.empty());
+}
+
+constexpr bool Manager::MediumAwaitable::await_ready() const noexcept
+{
+	return false;
+}
+
+inline MediumRef Manager::MediumAwaitable::await_resume()
+{
+	return std::move(medium_);
+}
+
 template <typename T>
 bool Manager::registerLibrary(const std::string& name)
 {
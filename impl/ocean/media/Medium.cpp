@@ -77,6 +77,9 @@ std::string Medium::convertType(const Type type)
 		case MOVIE:
 			return "Movie";
 
+		case SHARED_FRAME_RING:
+			return "SharedFrameRing";
+
 		case PIXEL_IMAGE:
 		case BUFFER_IMAGE:
 		case IMAGE_SEQUENCE:
@@ -129,6 +132,10 @@ Medium::Type Medium::convertType(const std::string& type)
 	{
 		return MOVIE;
 	}
+	else if (type == "SharedFrameRing")
+	{
+		return SHARED_FRAME_RING;
+	}
 
 	return MEDIUM;
 }
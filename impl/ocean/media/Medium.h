@@ -85,6 +85,8 @@ class OCEAN_MEDIA_EXPORT Medium
 			MICROPHONE = (1u << 12u) | LIVE_MEDIUM,
 			/// Movie medium.
 			MOVIE = (1u << 13u) | FINITE_MEDIUM | FRAME_MEDIUM | SOUND_MEDIUM,
+			/// Shared frame ring medium receiving frames from another process.
+			SHARED_FRAME_RING = (1u << 14u) | FRAME_MEDIUM,
 		};
 
 	public:
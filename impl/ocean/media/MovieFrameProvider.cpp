@@ -756,7 +756,7 @@ void MovieFrameProvider::onPreviewFrame(const Frame& frame, const SharedAnyCamer
 
 	const ScopedLock scopedLock(frameLock_);
 
-	FrameRef frameRef(new Frame(frame, Frame::ACM_COPY_REMOVE_PADDING_LAYOUT));
+	FrameRef frameRef(new Frame(frame, Frame::ACM_SHARE_OR_COPY_KEEP_LAYOUT));
 	frameRef->setRelativeTimestamp(frame.relativeTimestamp());
 
 	previewFrameQueue_.push(frameRef);
@@ -795,7 +795,7 @@ void MovieFrameProvider::onFrame(const Frame& frame, const SharedAnyCamera& /*ca
 
 	const ScopedLock scopedLock(frameLock_);
 
-	FrameRef frameRef(new Frame(frame, Frame::ACM_COPY_REMOVE_PADDING_LAYOUT));
+	FrameRef frameRef(new Frame(frame, Frame::ACM_SHARE_OR_COPY_KEEP_LAYOUT));
 	frameRef->setRelativeTimestamp(frame.relativeTimestamp());
 
 	frameQueue_.push(std::move(frameRef));
@@ -24,6 +24,28 @@ MovieRecorder::~MovieRecorder()
 	// nothing to do here
 }
 
+bool MovieRecorder::setSurfaceInput(const bool enable)
+{
+	// the base implementation supports memory buffers only
+
+	return enable == false;
+}
+
+bool MovieRecorder::supportsSurfaceInput() const
+{
+	return false;
+}
+
+bool MovieRecorder::lockSurfaceToFill(void*& /*surface*/, double& /*presentationTimestamp*/)
+{
+	return false;
+}
+
+void MovieRecorder::unlockSurfaceToFill()
+{
+	ocean_assert(false && "The recorder does not support input surfaces!");
+}
+
 }
 
 }
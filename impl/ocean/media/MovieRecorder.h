@@ -38,6 +38,47 @@ class OCEAN_MEDIA_EXPORT MovieRecorder :
 	virtual public FileRecorder,
 	virtual public FrameRecorder
 {
+	public:
+
+		/**
+		 * Sets whether the recorder receives the frames via a platform-specific input surface instead of memory buffers.
+		 * With an input surface, frames can be rendered directly into the encoder (e.g., with OpenGL ES) so that no copy to CPU memory is necessary.<br>
+		 * The input mode must be set before the recording starts.
+		 * @param enable True, to use the input surface; False, to use memory buffers
+		 * @return True, if succeeded
+		 * @see lockSurfaceToFill(), supportsSurfaceInput().
+		 */
+		virtual bool setSurfaceInput(const bool enable);
+
+		/**
+		 * Returns whether this recorder receives the frames via an input surface.
+		 * @return True, if so
+		 */
+		inline bool surfaceInput() const;
+
+		/**
+		 * Returns whether this recorder supports an input surface at all.
+		 * @return True, if so
+		 */
+		virtual bool supportsSurfaceInput() const;
+
+		/**
+		 * Returns the platform-specific input surface into which the next frame can be rendered, and locks it.
+		 * On Android platforms, the surface is an ANativeWindow object which is owned by the recorder.<br>
+		 * Beware: Call unlockSurfaceToFill() once the frame has been rendered into the surface.
+		 * @param surface The resulting input surface, valid until the recording stops
+		 * @param presentationTimestamp The resulting presentation timestamp of the next frame to be rendered, in seconds, with range [0, infinity)
+		 * @return True, if the surface was successfully locked
+		 * @see setSurfaceInput().
+		 */
+		virtual bool lockSurfaceToFill(void*& surface, double& presentationTimestamp);
+
+		/**
+		 * Unlocks the input surface after the frame has been rendered into the surface.
+		 * Beware: The surface has to be locked by lockSurfaceToFill() before.
+		 */
+		virtual void unlockSurfaceToFill();
+
 	protected:
 
 		/**
@@ -49,8 +90,20 @@ class OCEAN_MEDIA_EXPORT MovieRecorder :
 		 * Destructs a movie recorder.
 		 */
 		~MovieRecorder() override;
+
+	protected:
+
+		/// True, if the recorder receives the frames via an input surface; False, if via memory buffers.
+		bool surfaceInput_ = false;
 };
 
+inline bool MovieRecorder::surfaceInput() const
+{
+	const ScopedLock scopedLock(lock_);
+
+	return surfaceInput_;
+}
+
 }
 
 }
@@ -0,0 +1,212 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "ocean/media/SharedFrameRingMedium.h"
+
+#include "ocean/base/String.h"
+
+namespace Ocean
+{
+
+namespace Media
+{
+
+SharedFrameRingMedium::SharedFrameRingMedium(const std::string& url) :
+	Medium(url),
+	FrameMedium(url),
+	Thread("SharedFrameRingMedium thread")
+{
+	type_ = Type(type_ | SHARED_FRAME_RING);
+	isValid_ = !url.empty();
+}
+
+SharedFrameRingMedium::~SharedFrameRingMedium()
+{
+	stopThreadExplicitly();
+
+	// the frames wrap the memory of the ring, so the frames are removed before the ring is released
+
+	frameCollection_.clear();
+
+	releaseUnusedFrames(false /*keepMostRecent*/);
+
+	ocean_assert(heldFrames_.empty() && "A frame of the ring is still referenced, it must not be accessed after the medium has been released");
+}
+
+bool SharedFrameRingMedium::isStarted() const
+{
+	return isThreadActive();
+}
+
+bool SharedFrameRingMedium::setCamera(SharedAnyCamera&& camera)
+{
+	const ScopedLock scopedLock(lock_);
+
+	camera_ = std::move(camera);
+
+	return true;
+}
+
+bool SharedFrameRingMedium::start()
+{
+	const ScopedLock scopedLock(lock_);
+
+	if (isThreadActive())
+	{
+		return true;
+	}
+
+	if (!startThread())
+	{
+		return false;
+	}
+
+	startTimestamp_.toNow();
+	pauseTimestamp_.toInvalid();
+	stopTimestamp_.toInvalid();
+
+	return true;
+}
+
+bool SharedFrameRingMedium::pause()
+{
+	stopThreadExplicitly();
+
+	const ScopedLock scopedLock(lock_);
+
+	startTimestamp_.toInvalid();
+	pauseTimestamp_.toNow();
+	stopTimestamp_.toInvalid();
+
+	return true;
+}
+
+bool SharedFrameRingMedium::stop()
+{
+	stopThreadExplicitly();
+
+	const ScopedLock scopedLock(lock_);
+
+	startTimestamp_.toInvalid();
+	pauseTimestamp_.toInvalid();
+	stopTimestamp_.toNow();
+
+	return true;
+}
+
+Timestamp SharedFrameRingMedium::startTimestamp() const
+{
+	const ScopedLock scopedLock(lock_);
+
+	return startTimestamp_;
+}
+
+Timestamp SharedFrameRingMedium::pauseTimestamp() const
+{
+	const ScopedLock scopedLock(lock_);
+
+	return pauseTimestamp_;
+}
+
+Timestamp SharedFrameRingMedium::stopTimestamp() const
+{
+	const ScopedLock scopedLock(lock_);
+
+	return stopTimestamp_;
+}
+
+void SharedFrameRingMedium::threadRun()
+{
+	const std::wstring ringName = String::toWString(url_);
+
+	while (!shouldThreadStop())
+	{
+		if (!ring_.isValid())
+		{
+			// the producer may not have created the ring yet
+
+			ring_ = SharedFrameRing(ringName);
+
+			if (!ring_.isValid())
+			{
+				sleep(50u);
+				continue;
+			}
+
+			publication_ = 0ull;
+		}
+
+		Frame frame;
+		SharedFrameRing::SlotIndex slotIndex = SharedFrameRing::invalidSlotIndex_;
+
+		if (!ring_.acquireLatestFrame(frame, slotIndex, publication_, 0.05))
+		{
+			releaseUnusedFrames(false /*keepMostRecent*/);
+
+			if (!ring_.isProducerAlive() && heldFrames_.empty())
+			{
+				// the producer has released the ring, we wait for a new ring
+
+				ring_ = SharedFrameRing();
+			}
+
+			continue;
+		}
+
+		heldFrames_.emplace_back(frame.constdata<void>(0u), slotIndex);
+
+		TemporaryScopedLock scopedLock(lock_);
+			SharedAnyCamera camera(camera_);
+		scopedLock.release();
+
+		if (frameCallbackHandler_.isEmpty())
+		{
+			// the frame is stored without copying the memory, the slot is released once the frame cannot be accessed anymore
+
+			frameCollection_.set(std::move(frame), std::move(camera));
+			notifyFrameWaiters();
+		}
+		else
+		{
+			deliverNewFrame(std::move(frame), std::move(camera));
+		}
+
+		releaseUnusedFrames(true /*keepMostRecent*/);
+	}
+}
+
+void SharedFrameRingMedium::releaseUnusedFrames(const bool keepMostRecent)
+{
+	const size_t numberCandidates = keepMostRecent && !heldFrames_.empty() ? heldFrames_.size() - 1 : heldFrames_.size();
+
+	size_t n = 0;
+
+	for (size_t nCandidate = 0; nCandidate < numberCandidates; ++nCandidate)
+	{
+		const HeldFrame& heldFrame = heldFrames_[nCandidate];
+
+		if (frameCollection_.isMemoryInUse(heldFrame.first))
+		{
+			heldFrames_[n++] = heldFrame;
+		}
+		else
+		{
+			ring_.releaseFrame(heldFrame.second);
+		}
+	}
+
+	for (size_t nRemaining = numberCandidates; nRemaining < heldFrames_.size(); ++nRemaining)
+	{
+		heldFrames_[n++] = heldFrames_[nRemaining];
+	}
+
+	heldFrames_.resize(n);
+}
+
+}
+
+}
@@ -0,0 +1,167 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#ifndef META_OCEAN_MEDIA_SHARED_FRAME_RING_MEDIUM_H
+#define META_OCEAN_MEDIA_SHARED_FRAME_RING_MEDIUM_H
+
+#include "ocean/media/Media.h"
+#include "ocean/media/FrameMedium.h"
+
+#include "ocean/base/SharedFrameRing.h"
+#include "ocean/base/Thread.h"
+
+namespace Ocean
+{
+
+namespace Media
+{
+
+// Forward declaration.
+class SharedFrameRingMedium;
+
+/**
+ * Definition of a smart medium reference holding a shared frame ring medium object.
+ * @see SmartMediumRef, SharedFrameRingMedium.
+ * @ingroup media
+ */
+using SharedFrameRingMediumRef = SmartMediumRef<SharedFrameRingMedium>;
+
+/**
+ * This class implements a frame medium receiving the frames of another process via a SharedFrameRing.
+ * The url of the medium is the name of the ring, the medium waits for the ring if the producer has not yet created the ring.<br>
+ * The frames of the medium wrap the shared memory of the ring without copying the frame data, the slots of the ring are referenced as long as the frames can be accessed.<br>
+ * Therefore, frames should not be kept longer than necessary, otherwise the producer runs out of slots.<br>
+ * Beware: The frames must not be accessed after the medium has been released, frames which are needed longer must be copied.
+ * <pre>
+ * Media::FrameMediumRef frameMedium = Media::Manager::get().newMedium("camera", Media::Medium::SHARED_FRAME_RING);
+ * frameMedium->start();
+ * </pre>
+ * @see SharedFrameRing.
+ * @ingroup media
+ */
+class OCEAN_MEDIA_EXPORT SharedFrameRingMedium :
+	virtual public FrameMedium,
+	protected Thread
+{
+	friend class Manager;
+
+	protected:
+
+		/**
+		 * Definition of a pair combining the memory of a frame with the index of the ring's slot holding the frame.
+		 */
+		using HeldFrame = std::pair<const void*, SharedFrameRing::SlotIndex>;
+
+		/**
+		 * Definition of a vector holding frames.
+		 */
+		using HeldFrames = std::vector<HeldFrame>;
+
+	public:
+
+		/**
+		 * Returns whether the medium is started currently.
+		 * @see Medium:isStarted().
+		 */
+		bool isStarted() const override;
+
+		/**
+		 * Sets the known camera profile of this frame medium.
+		 * @see FrameMedium::setCamera().
+		 */
+		bool setCamera(SharedAnyCamera&& camera) override;
+
+		/**
+		 * Starts the medium.
+		 * @see Medium::start().
+		 */
+		bool start() override;
+
+		/**
+		 * Pauses the medium.
+		 * @see Medium::pause().
+		 */
+		bool pause() override;
+
+		/**
+		 * Stops the medium.
+		 * @see Medium::stop().
+		 */
+		bool stop() override;
+
+		/**
+		 * Returns the start timestamp.
+		 * @see Medium::startTimestmap().
+		 */
+		Timestamp startTimestamp() const override;
+
+		/**
+		 * Returns the pause timestamp.
+		 * @see Medium::pauseTimestamp().
+		 */
+		Timestamp pauseTimestamp() const override;
+
+		/**
+		 * Returns the stop timestamp.
+		 * @see Medium::stopTimestamp().
+		 */
+		Timestamp stopTimestamp() const override;
+
+	protected:
+
+		/**
+		 * Creates a new medium by the name of a shared frame ring.
+		 * @param url The name of the shared frame ring
+		 */
+		explicit SharedFrameRingMedium(const std::string& url);
+
+		/**
+		 * Destructs the medium.
+		 */
+		~SharedFrameRingMedium() override;
+
+		/**
+		 * The thread run function receiving the frames.
+		 * @see Thread::threadRun().
+		 */
+		void threadRun() override;
+
+		/**
+		 * Releases all frames of the ring which cannot be accessed via this medium anymore.
+		 * @param keepMostRecent True, to keep the most recent frame in any case
+		 */
+		void releaseUnusedFrames(const bool keepMostRecent);
+
+	protected:
+
+		/// The ring providing the frames.
+		SharedFrameRing ring_;
+
+		/// The publication number of the most recent frame.
+		uint64_t publication_ = 0ull;
+
+		/// The frames of the ring which have been delivered and which are still referenced by this medium, the most recent frame last.
+		HeldFrames heldFrames_;
+
+		/// The camera profile of all frames, nullptr if unknown.
+		SharedAnyCamera camera_;
+
+		/// Start timestamp.
+		Timestamp startTimestamp_;
+
+		/// Pause timestamp.
+		Timestamp pauseTimestamp_;
+
+		/// Stop timestamp.
+		Timestamp stopTimestamp_;
+};
+
+}
+
+}
+
+#endif // META_OCEAN_MEDIA_SHARED_FRAME_RING_MEDIUM_H
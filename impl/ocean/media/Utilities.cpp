@@ -36,7 +36,7 @@ Frame Utilities::loadImage(const std::string& url)
 		return Frame();
 	}
 
-	return Frame(*frame, Frame::ACM_COPY_REMOVE_PADDING_LAYOUT);
+	return Frame(*frame, Frame::ACM_SHARE_OR_COPY_KEEP_LAYOUT);
 }
 
 Frame Utilities::loadImage(const void* imageBuffer, const size_t imageBufferSize, const std::string& imageBufferTypeIn, std::string* imageBufferTypeOut)
@@ -67,7 +67,7 @@ Frame Utilities::loadImage(const void* imageBuffer, const size_t imageBufferSize
 		*imageBufferTypeOut = image->getImageBufferType();
 	}
 
-	return Frame(*frame, Frame::ACM_COPY_REMOVE_PADDING_LAYOUT);
+	return Frame(*frame, Frame::ACM_SHARE_OR_COPY_KEEP_LAYOUT);
 }
 
 bool Utilities::saveImage(const Frame& frame, const std::string& url, const bool addTimeSuffix)
@@ -520,6 +520,20 @@ bool ALiveVideo::setVideoStabilization(const bool enable)
 	return true;
 }
 
+bool ALiveVideo::zeroCopyDelivery() const
+{
+	const ScopedLock scopedLock(lock_);
+
+	return zeroCopyDeliveryEnabled_;
+}
+
+void ALiveVideo::setZeroCopyDelivery(const bool enable)
+{
+	const ScopedLock scopedLock(lock_);
+
+	zeroCopyDeliveryEnabled_ = enable;
+}
+
 void ALiveVideo::feedNewFrame(Frame&& frame, SharedAnyCamera&& anyCamera, const ControlMode exposureMode, const double exposureDuration, const ControlMode isoMode, const float iso, const ControlMode focusMode, const float focusValue)
 {
 	// several parameters are unknown in case the camera is fed from an external source
@@ -1154,6 +1168,8 @@ void ALiveVideo::onCaptureCompleted(ACameraCaptureSession* session, ACaptureRequ
 
 		SharedAnyCamera camera(camera_);
 
+		const bool zeroCopyDelivery = zeroCopyDeliveryEnabled_;
+
 	scopedLock.release();
 
 	AImage* image = nullptr;
@@ -1165,7 +1181,9 @@ void ALiveVideo::onCaptureCompleted(ACameraCaptureSession* session, ACaptureRequ
 	Frame frame;
 	int64_t timestampNs;
 
-	if (frameFromImage(image, frame, timestampNs))
+	// in zero-copy mode, the frame wraps the image memory, the image is returned to the reader's queue after the frame has been delivered
+
+	if (frameFromImage(image, frame, timestampNs, zeroCopyDelivery))
 	{
 		/*
 		 * AImage_getTimestamp: For images generated by camera, the timestamp value will match ACAMERA_SENSOR_TIMESTAMP of the ACameraMetadata.
@@ -1268,7 +1286,7 @@ bool ALiveVideo::horizontalFieldOfView(const float cameraSensorPhysicalSizeX, co
 	return true;
 }
 
-bool ALiveVideo::frameFromImage(AImage* image, Frame& frame, int64_t& timestampNs)
+bool ALiveVideo::frameFromImage(AImage* image, Frame& frame, int64_t& timestampNs, const bool useImageMemory)
 {
 	ocean_assert(image != nullptr);
 
@@ -1309,6 +1327,7 @@ bool ALiveVideo::frameFromImage(AImage* image, Frame& frame, int64_t& timestampN
 			uint8_t* sources[3] = {nullptr, nullptr, nullptr};
 			unsigned int sourcePaddingElements[3] = {0u, 0u, 0u};
 			unsigned int sourcePixelStrides[3] = {0u, 0u, 0u};
+			int32_t sourceRowStrideBytes[3] = {0, 0, 0};
 
 			for (int32_t planeIndex = 0; planeIndex < 3; ++planeIndex)
 			{
@@ -1327,6 +1346,7 @@ bool ALiveVideo::frameFromImage(AImage* image, Frame& frame, int64_t& timestampN
 				}
 
 				sourcePaddingElements[planeIndex] = (unsigned int)(rowStrideBytes - planeWidth);
+				sourceRowStrideBytes[planeIndex] = rowStrideBytes;
 
 				int32_t pixelStride = 0;
 				if (NativeMediaLibrary::get().AImage_getPlanePixelStride(image, planeIndex, &pixelStride) != AMEDIA_OK)
@@ -1353,7 +1373,27 @@ bool ALiveVideo::frameFromImage(AImage* image, Frame& frame, int64_t& timestampN
 				}
 			}
 
-			if (!frame.set(FrameType((unsigned int)(width), (unsigned int)(height), FrameType::FORMAT_Y_UV12, FrameType::ORIGIN_UPPER_LEFT), false /*forceOwner*/, true /*forceWritable*/))
+			const FrameType frameType((unsigned int)(width), (unsigned int)(height), FrameType::FORMAT_Y_UV12, FrameType::ORIGIN_UPPER_LEFT);
+
+			if (useImageMemory && sourcePixelStrides[0] == 1u && sourcePixelStrides[1] == 2u && sourcePixelStrides[2] == 2u && sources[2] == sources[1] + 1 && sourceRowStrideBytes[1] == sourceRowStrideBytes[2] && sourceRowStrideBytes[1] >= width)
+			{
+				// the chroma planes are interleaved in U/V order (NV12), so that the image memory matches the memory layout of Y_UV12 and can be wrapped
+
+				const unsigned int yPaddingElements = (unsigned int)(sourceRowStrideBytes[0] - width);
+				const unsigned int uvPaddingElements = (unsigned int)(sourceRowStrideBytes[1] - width);
+
+				const Frame::PlaneInitializers<uint8_t> planeInitializers =
+				{
+					Frame::PlaneInitializer<uint8_t>(sources[0], Frame::CM_USE_KEEP_LAYOUT, yPaddingElements),
+					Frame::PlaneInitializer<uint8_t>(sources[1], Frame::CM_USE_KEEP_LAYOUT, uvPaddingElements)
+				};
+
+				frame = Frame(frameType, planeInitializers);
+
+				return frame.isValid();
+			}
+
+			if (!frame.set(frameType, false /*forceOwner*/, true /*forceWritable*/))
 			{
 				ocean_assert(false && "This should never happen!");
 				return false;
@@ -1396,7 +1436,7 @@ bool ALiveVideo::frameFromImage(AImage* image, Frame& frame, int64_t& timestampN
 				return false;
 			}
 
-			frame = Frame(frameType, (void*)(data), Frame::CM_COPY_REMOVE_PADDING_LAYOUT, dataPaddingElements);
+			frame = Frame(frameType, (void*)(data), useImageMemory ? Frame::CM_USE_KEEP_LAYOUT : Frame::CM_COPY_REMOVE_PADDING_LAYOUT, dataPaddingElements);
 
 			return true;
 		}
@@ -257,6 +257,24 @@ class OCEAN_MEDIA_A_EXPORT ALiveVideo final :
 		 */
 		bool setVideoStabilization(const bool enable) override;
 
+		/**
+		 * Returns whether camera frames are delivered without copying the image memory.
+		 * @return True, if so
+		 * @see setZeroCopyDelivery().
+		 */
+		bool zeroCopyDelivery() const;
+
+		/**
+		 * Sets whether camera frames are delivered without copying the image memory.
+		 * In zero-copy mode, the delivered frames are not owner of their memory but wrap the planes of the Android image (with the original memory layout) which is returned to the image reader's queue once the delivery has finished.<br>
+		 * Therefore, frame callbacks must not keep a reference to the delivered frame, and need to make an explicit copy if the frame is accessed after the callback has returned.<br>
+		 * Frames which are stored in the frame collection of this medium are always copied.<br>
+		 * Zero-copy delivery is supported for RGB-like pixel formats and for YUV images with interleaved chroma in U/V order, all remaining images are still copied.
+		 * @param enable True, to deliver frames without copying the image memory; False, to deliver frames owning a copy of the image memory
+		 * @see zeroCopyDelivery().
+		 */
+		void setZeroCopyDelivery(const bool enable);
+
 		/**
 		 * Explicitly feeds a new external frame this live video.
 		 * This function is intended for situations in which this live video does not receive the frame anymore from the system (e.g., when ARCore is accessing the video stream).<br>
@@ -504,9 +522,10 @@ class OCEAN_MEDIA_A_EXPORT ALiveVideo final :
 		 * @param image The Android image object from which the next frame will be extracted
 		 * @param frame The resulting frame containing the extracted image
 		 * @param timestampNs The resulting timestamp of the frame, as provided by AImage_getTimestamp(), in nanoseconds
+		 * @param useImageMemory True, to wrap the memory of the image without copying the image if possible, in this case 'image' must exist as long as 'frame' is used; False, to copy the image memory
 		 * @return True, if succeeded
 		 */
-		static bool frameFromImage(AImage* image, Frame& frame, int64_t& timestampNs);
+		static bool frameFromImage(AImage* image, Frame& frame, int64_t& timestampNs, const bool useImageMemory = false);
 
 		/**
 		 * Returns the transformation between camera and device (device_T_camera).
@@ -714,6 +733,9 @@ class OCEAN_MEDIA_A_EXPORT ALiveVideo final :
 		/// Whether video stabilization is enabled (true) or disabled (false).
 		bool videoStabilizationEnabled_ = false;
 
+		/// True, to deliver frames without copying the image memory of the camera.
+		bool zeroCopyDeliveryEnabled_ = false;
+
 		/// The stream configurations available for this camera.
 		StreamConfigurations availableStreamConfigurations_;
 
@@ -390,8 +390,13 @@ void AMovie::threadRun()
 		{
 			// now, we process the output buffer
 
+			// the frame wraps the codec's output buffer, the image content is copied only if the frame is stored in the frame collection
+
 			ocean_assert(videoMediaCodec_ != nullptr);
-			Frame frame = VideoDecoder::extractVideoFrameFromCodecOutputBuffer(videoMediaCodec_);
+			AMediaCodec* const videoMediaCodec = videoMediaCodec_;
+
+			size_t outputBufferIndex = size_t(-1);
+			Frame frame = VideoDecoder::wrapVideoFrameFromCodecOutputBuffer(videoMediaCodec, outputBufferIndex);
 
 			/*if (audioMediaCodec_ != nullptr) **TODO** not yet activated
 			{
@@ -424,6 +429,8 @@ void AMovie::threadRun()
 				frame.setRelativeTimestamp(Timestamp(normalRelativePresentationTime));
 
 				deliverNewFrame(std::move(frame));
+
+				VideoDecoder::releaseCodecOutputBuffer(videoMediaCodec, outputBufferIndex);
 			}
 		}
 
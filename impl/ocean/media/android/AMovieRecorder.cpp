@@ -14,6 +14,8 @@
 #include "ocean/media/android/NativeMediaLibrary.h"
 #include "ocean/media/android/PixelFormats.h"
 
+#include <android/native_window.h>
+
 #include <stdio.h>
 
 namespace Ocean
@@ -174,6 +176,12 @@ bool AMovieRecorder::lockBufferToFill(Frame& recorderFrame, const bool respectFr
 		return false;
 	}
 
+	if (inputSurface_ != nullptr)
+	{
+		ocean_assert(false && "The recorder receives the frames via an input surface, use lockSurfaceToFill() instead");
+		return false;
+	}
+
 	if (bufferIndex_ != -1)
 	{
 		ocean_assert(false && "Previous buffer has not been unlocked");
@@ -307,6 +315,77 @@ void AMovieRecorder::unlockBufferToFill()
 	bufferSize_ = 0;
 }
 
+bool AMovieRecorder::setSurfaceInput(const bool enable)
+{
+	const ScopedLock scopedLock(lock_);
+
+	if (mediaCodec_ != nullptr || isRecording_)
+	{
+		Log::error() << "The input mode cannot be changed after recording has started.";
+		return false;
+	}
+
+	if (enable && !supportsSurfaceInput())
+	{
+		Log::error() << "The device does not support input surfaces for movie recorders.";
+		return false;
+	}
+
+	surfaceInput_ = enable;
+
+	return true;
+}
+
+bool AMovieRecorder::supportsSurfaceInput() const
+{
+	return NativeMediaLibrary::get().isInitialized() && NativeMediaLibrary::get().supportsInputSurfaces();
+}
+
+bool AMovieRecorder::lockSurfaceToFill(void*& surface, double& presentationTimestamp)
+{
+	const ScopedLock scopedLock(lock_);
+
+	if (mediaCodec_ == nullptr || inputSurface_ == nullptr || !isRecording_)
+	{
+		return false;
+	}
+
+	if (surfaceLocked_)
+	{
+		ocean_assert(false && "Previous surface has not been unlocked");
+		return false;
+	}
+
+	surface = inputSurface_;
+	presentationTimestamp = nextFrameTimestamp_;
+
+	surfaceLocked_ = true;
+
+	return true;
+}
+
+void AMovieRecorder::unlockSurfaceToFill()
+{
+	const ScopedLock scopedLock(lock_);
+
+	ocean_assert(surfaceLocked_);
+
+	if (!surfaceLocked_ || mediaCodec_ == nullptr)
+	{
+		return;
+	}
+
+	// the frame is forwarded from the surface to the codec asynchronously, so we write all encoded frames which are available but do not wait for this frame
+
+	const bool writeWasSuccessful = readCodecOutputBufferAndWriteToMuxer(/* loopUntilEndOfStream */ false, /* onlyAvailableOutput */ true);
+	ocean_assert_and_suppress_unused(writeWasSuccessful, writeWasSuccessful);
+
+	ocean_assert(frameFrequency_ > 0.0);
+	nextFrameTimestamp_ += 1.0 / frameFrequency_;
+
+	surfaceLocked_ = false;
+}
+
 bool AMovieRecorder::createNewMediaCodec()
 {
 	if (!frameType_.isValid())
@@ -368,13 +447,18 @@ bool AMovieRecorder::createNewMediaCodec()
 	}
 
 	PixelFormats::AndroidMediaFormatColorRange colorRange = PixelFormats::COLOR_RANGE_UNKNOWN;
-	const PixelFormats::AndroidMediaCodecColorFormat colorFormat = PixelFormats::pixelFormatToAndroidMediaCodecColorFormat(frameType_.pixelFormat(), colorRange);
+	PixelFormats::AndroidMediaCodecColorFormat colorFormat = PixelFormats::COLOR_FORMAT_Surface;
 
-	if (colorFormat == PixelFormats::COLOR_FORMAT_UNKNOWN)
+	if (!surfaceInput_)
 	{
-		Log::error() << "Color format '" << FrameType::translatePixelFormat(frameType_.pixelFormat()) << "' not supported for video output!";
-		release();
-		return false;
+		colorFormat = PixelFormats::pixelFormatToAndroidMediaCodecColorFormat(frameType_.pixelFormat(), colorRange);
+
+		if (colorFormat == PixelFormats::COLOR_FORMAT_UNKNOWN)
+		{
+			Log::error() << "Color format '" << FrameType::translatePixelFormat(frameType_.pixelFormat()) << "' not supported for video output!";
+			release();
+			return false;
+		}
 	}
 
 	NativeMediaLibrary::get().AMediaFormat_setInt32(mediaFormat_, NativeMediaLibrary::AMEDIAFORMAT_KEY_WIDTH, frameType_.width());
@@ -404,6 +488,21 @@ bool AMovieRecorder::createNewMediaCodec()
 		return false;
 	}
 
+	if (surfaceInput_)
+	{
+		// the input surface must be created after the codec is configured and before the codec is started
+
+		ocean_assert(inputSurface_ == nullptr);
+		status = NativeMediaLibrary::get().AMediaCodec_createInputSurface(mediaCodec_, &inputSurface_);
+
+		if (status != AMEDIA_OK || inputSurface_ == nullptr)
+		{
+			Log::error() << "Failed to create the input surface of the media codec: " << status;
+			release();
+			return false;
+		}
+	}
+
 #ifdef OCEAN_DEBUG
 	{
 		AMediaFormat* mediaFormat = NativeMediaLibrary::get().AMediaCodec_getInputFormat(mediaCodec_);
@@ -470,23 +569,42 @@ void AMovieRecorder::release()
 		{
 			const ScopedLock scopedLock(lock_);
 
-			ssize_t bufferIndex = ssize_t(-1);
-
-			constexpr int64_t kInputTimeoutUs = int64_t(1000000); // 1 second
-			bufferIndex = NativeMediaLibrary::get().AMediaCodec_dequeueInputBuffer(mediaCodec_, kInputTimeoutUs);
-
-			if (bufferIndex < ssize_t(0))
+			if (inputSurface_ != nullptr)
 			{
-				Log::error() << "Failed to dequeue codec input buffer (" << bufferIndex << ").";
+				// with an input surface, the end-of-stream is signaled explicitly instead of via an empty buffer
+
+				const media_status_t status = NativeMediaLibrary::get().AMediaCodec_signalEndOfInputStream(mediaCodec_);
+
+				if (status == AMEDIA_OK)
+				{
+					const bool writeWasSuccessful = readCodecOutputBufferAndWriteToMuxer(/* loopUntilEndOfStream */ true);
+					ocean_assert_and_suppress_unused(writeWasSuccessful, writeWasSuccessful);
+				}
+				else
+				{
+					Log::error() << "Failed to signal the end of the input stream: " << status;
+				}
 			}
 			else
 			{
-				// Once EOS is enqueued, no further queueing will occur.
-				const long nextFrameTimestampMicroseconds = static_cast<long>(nextFrameTimestamp_ * 1000000.0);
-				NativeMediaLibrary::get().AMediaCodec_queueInputBuffer(mediaCodec_, bufferIndex, /* offset */ 0, /* size */ size_t(0), nextFrameTimestampMicroseconds, AMEDIACODEC_BUFFER_FLAG_END_OF_STREAM);
-
-				const bool writeWasSuccessful = readCodecOutputBufferAndWriteToMuxer(/* loopUntilEndOfStream */ true);
-				ocean_assert_and_suppress_unused(writeWasSuccessful, writeWasSuccessful);
+				ssize_t bufferIndex = ssize_t(-1);
+
+				constexpr int64_t kInputTimeoutUs = int64_t(1000000); // 1 second
+				bufferIndex = NativeMediaLibrary::get().AMediaCodec_dequeueInputBuffer(mediaCodec_, kInputTimeoutUs);
+
+				if (bufferIndex < ssize_t(0))
+				{
+					Log::error() << "Failed to dequeue codec input buffer (" << bufferIndex << ").";
+				}
+				else
+				{
+					// Once EOS is enqueued, no further queueing will occur.
+					const long nextFrameTimestampMicroseconds = static_cast<long>(nextFrameTimestamp_ * 1000000.0);
+					NativeMediaLibrary::get().AMediaCodec_queueInputBuffer(mediaCodec_, bufferIndex, /* offset */ 0, /* size */ size_t(0), nextFrameTimestampMicroseconds, AMEDIACODEC_BUFFER_FLAG_END_OF_STREAM);
+
+					const bool writeWasSuccessful = readCodecOutputBufferAndWriteToMuxer(/* loopUntilEndOfStream */ true);
+					ocean_assert_and_suppress_unused(writeWasSuccessful, writeWasSuccessful);
+				}
 			}
 
 			NativeMediaLibrary::get().AMediaCodec_stop(mediaCodec_);
@@ -496,6 +614,14 @@ void AMovieRecorder::release()
 		mediaCodec_ = nullptr;
 	}
 
+	if (inputSurface_ != nullptr)
+	{
+		ANativeWindow_release(inputSurface_);
+		inputSurface_ = nullptr;
+	}
+
+	surfaceLocked_ = false;
+
 	if (mediaMuxer_ != nullptr)
 	{
 		if (wasRecording)
@@ -520,7 +646,7 @@ void AMovieRecorder::release()
 	isStopped_ = true; // only do this at the very end
 }
 
-bool AMovieRecorder::readCodecOutputBufferAndWriteToMuxer(const bool loopUntilEndOfStream)
+bool AMovieRecorder::readCodecOutputBufferAndWriteToMuxer(const bool loopUntilEndOfStream, const bool onlyAvailableOutput)
 {
 	ocean_assert(mediaCodec_ != nullptr);
 	ocean_assert(mediaMuxer_ != nullptr);
@@ -538,6 +664,11 @@ bool AMovieRecorder::readCodecOutputBufferAndWriteToMuxer(const bool loopUntilEn
 
 		if (outputBufferIndex == AMEDIACODEC_INFO_TRY_AGAIN_LATER)
 		{
+			if (onlyAvailableOutput && !loopUntilEndOfStream)
+			{
+				break; // all available output has been written
+			}
+
 			continue; // timeout
 		}
 
@@ -611,7 +742,7 @@ bool AMovieRecorder::readCodecOutputBufferAndWriteToMuxer(const bool loopUntilEn
 		}
 
 		// Codec-specific data, if present, will always precede actual frame data, so it's safe to loop.
-		if (!bufferContainsCodecSpecificData && !loopUntilEndOfStream)
+		if (!bufferContainsCodecSpecificData && !loopUntilEndOfStream && !onlyAvailableOutput)
 		{
 			break;
 		}
@@ -110,6 +110,33 @@ class OCEAN_MEDIA_A_EXPORT AMovieRecorder : virtual public MovieRecorder
 		 */
 		void unlockBufferToFill() override;
 
+		/**
+		 * Sets whether the recorder receives the frames via an input surface instead of memory buffers.
+		 * Input surfaces are supported on devices with API level 26 or higher.
+		 * @see MovieRecorder::setSurfaceInput().
+		 */
+		bool setSurfaceInput(const bool enable) override;
+
+		/**
+		 * Returns whether this recorder supports an input surface.
+		 * @see MovieRecorder::supportsSurfaceInput().
+		 */
+		bool supportsSurfaceInput() const override;
+
+		/**
+		 * Returns the encoder's input surface into which the next frame can be rendered, and locks it.
+		 * The surface is an ANativeWindow object owned by the recorder, e.g., to be used with eglCreateWindowSurface().<br>
+		 * Beware: Call unlockSurfaceToFill() once the frame has been rendered (swapped) into the surface.
+		 * @see MovieRecorder::lockSurfaceToFill().
+		 */
+		bool lockSurfaceToFill(void*& surface, double& presentationTimestamp) override;
+
+		/**
+		 * Unlocks the input surface and writes all available encoded frames to the file.
+		 * @see MovieRecorder::unlockSurfaceToFill().
+		 */
+		void unlockSurfaceToFill() override;
+
 	protected:
 
 		/**
@@ -138,9 +165,10 @@ class OCEAN_MEDIA_A_EXPORT AMovieRecorder : virtual public MovieRecorder
 		/**
 		 * Reads output from the codec and writes the resulting buffer to the muxer. This function should only be called if input data was previously submitted to the codec.
 		 * @param loopUntilEndOfStream If true, continuously read from the buffer until an end-of-stream flag is presented; this should only be used when the recording is complete and a buffer with the EOS flag set has been submitted as input to the codec
+		 * @param onlyAvailableOutput True, to write all output which is currently available without waiting for a new frame (e.g., when the input is provided via a surface); False, to wait until one frame has been written
 		 * @return True if the read and write succeeded, false otherwise.
 		 */
-		bool readCodecOutputBufferAndWriteToMuxer(const bool loopUntilEndOfStream = false);
+		bool readCodecOutputBufferAndWriteToMuxer(const bool loopUntilEndOfStream = false, const bool onlyAvailableOutput = false);
 
 	protected:
 
@@ -153,6 +181,12 @@ class OCEAN_MEDIA_A_EXPORT AMovieRecorder : virtual public MovieRecorder
 		/// The underlying media muxer that will save the result to a file containing the codec output.
 		AMediaMuxer* mediaMuxer_ = nullptr;
 
+		/// The input surface of the codec, valid if the recorder receives the frames via a surface.
+		ANativeWindow* inputSurface_ = nullptr;
+
+		/// True, if the input surface is currently locked.
+		bool surfaceLocked_ = false;
+
 		/// The underlying file being written to.
 		ScopedFILE file_;
 
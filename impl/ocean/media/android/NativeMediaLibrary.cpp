@@ -164,6 +164,10 @@ NativeMediaLibrary::ScopedSubscription NativeMediaLibrary::initialize()
 	AMediaCodec_configure_ = (Function_AMediaCodec_configure*)(dlsym(libraryHandle_, "AMediaCodec_configure"));
 	ocean_assert(AMediaCodec_configure_ != nullptr);
 
+	// optional function, available since API level 26
+	ocean_assert(AMediaCodec_createInputSurface_ == nullptr);
+	AMediaCodec_createInputSurface_ = (Function_AMediaCodec_createInputSurface*)(dlsym(libraryHandle_, "AMediaCodec_createInputSurface"));
+
 	ocean_assert(AMediaCodec_delete_ == nullptr);
 	AMediaCodec_delete_ = (Function_AMediaCodec_delete*)(dlsym(libraryHandle_, "AMediaCodec_delete"));
 	ocean_assert(AMediaCodec_delete_ != nullptr);
@@ -208,6 +212,10 @@ NativeMediaLibrary::ScopedSubscription NativeMediaLibrary::initialize()
 	AMediaCodec_releaseOutputBuffer_ = (Function_AMediaCodec_releaseOutputBuffer*)(dlsym(libraryHandle_, "AMediaCodec_releaseOutputBuffer"));
 	ocean_assert(AMediaCodec_releaseOutputBuffer_ != nullptr);
 
+	// optional function, available since API level 26
+	ocean_assert(AMediaCodec_signalEndOfInputStream_ == nullptr);
+	AMediaCodec_signalEndOfInputStream_ = (Function_AMediaCodec_signalEndOfInputStream*)(dlsym(libraryHandle_, "AMediaCodec_signalEndOfInputStream"));
+
 	ocean_assert(AMediaCodec_start_ == nullptr);
 	AMediaCodec_start_ = (Function_AMediaCodec_start*)(dlsym(libraryHandle_, "AMediaCodec_start"));
 	ocean_assert(AMediaCodec_start_ != nullptr);
@@ -422,6 +430,7 @@ void NativeMediaLibrary::release()
 	AMediaCodec_createDecoderByType_ = nullptr;
 	AMediaCodec_createEncoderByType_ = nullptr;
 	AMediaCodec_configure_ = nullptr;
+	AMediaCodec_createInputSurface_ = nullptr;
 	AMediaCodec_delete_ = nullptr;
 	AMediaCodec_dequeueInputBuffer_ = nullptr;
 	AMediaCodec_dequeueOutputBuffer_ = nullptr;
@@ -433,6 +442,7 @@ void NativeMediaLibrary::release()
 	AMediaCodec_getOutputFormat_ = nullptr;
 	AMediaCodec_queueInputBuffer_ = nullptr;
 	AMediaCodec_releaseOutputBuffer_ = nullptr;
+	AMediaCodec_signalEndOfInputStream_ = nullptr;
 	AMediaCodec_start_ = nullptr;
 	AMediaCodec_stop_ = nullptr;
 
@@ -153,6 +153,7 @@ class OCEAN_MEDIA_A_EXPORT NativeMediaLibrary : public Singleton<NativeMediaLibr
 		using Function_AMediaCodec_createDecoderByType = AMediaCodec* (const char* mime_type);
 		using Function_AMediaCodec_createEncoderByType = AMediaCodec* (const char* mime_type);
 		using Function_AMediaCodec_configure = media_status_t (AMediaCodec* codec, const AMediaFormat* format, ANativeWindow* surface, AMediaCrypto* crypto, uint32_t flags);
+		using Function_AMediaCodec_createInputSurface = media_status_t (AMediaCodec* codec, ANativeWindow** surface);
 		using Function_AMediaCodec_delete = media_status_t (AMediaCodec* codec);
 		using Function_AMediaCodec_dequeueInputBuffer = ssize_t (AMediaCodec* codec, int64_t timeoutUs);
 		using Function_AMediaCodec_dequeueOutputBuffer = ssize_t (AMediaCodec* codec, AMediaCodecBufferInfo* info, int64_t timeoutUs);
@@ -164,6 +165,7 @@ class OCEAN_MEDIA_A_EXPORT NativeMediaLibrary : public Singleton<NativeMediaLibr
 		using Function_AMediaCodec_getOutputFormat = AMediaFormat* (AMediaCodec* codec);
 		using Function_AMediaCodec_queueInputBuffer = media_status_t (AMediaCodec* codec, size_t idx, unsigned int offset, size_t size, uint64_t time, uint32_t flags);
 		using Function_AMediaCodec_releaseOutputBuffer = media_status_t (AMediaCodec* codec, size_t idx, bool render);
+		using Function_AMediaCodec_signalEndOfInputStream = media_status_t (AMediaCodec* codec);
 		using Function_AMediaCodec_start = media_status_t (AMediaCodec* codec);
 		using Function_AMediaCodec_stop = media_status_t (AMediaCodec* codec);
 
@@ -225,6 +227,13 @@ class OCEAN_MEDIA_A_EXPORT NativeMediaLibrary : public Singleton<NativeMediaLibr
 		 */
 		inline bool isInitialized() const;
 
+		/**
+		 * Returns whether the library provides the functions necessary to encode frames via input surfaces.
+		 * The functions are available on devices with API level 26 or higher.
+		 * @return True, if so
+		 */
+		inline bool supportsInputSurfaces() const;
+
 #if __ANDROID_API__ >= 24
 
 		/**
@@ -263,6 +272,7 @@ class OCEAN_MEDIA_A_EXPORT NativeMediaLibrary : public Singleton<NativeMediaLibr
 		inline AMediaCodec* AMediaCodec_createDecoderByType(const char* mime_type) const;
 		inline AMediaCodec* AMediaCodec_createEncoderByType(const char* mime_type) const;
 		inline media_status_t AMediaCodec_configure(AMediaCodec* codec, const AMediaFormat* format, ANativeWindow* surface, AMediaCrypto* crypto, uint32_t flags) const;
+		inline media_status_t AMediaCodec_createInputSurface(AMediaCodec* codec, ANativeWindow** surface) const;
 		inline media_status_t AMediaCodec_delete(AMediaCodec* codec) const;
 		inline ssize_t AMediaCodec_dequeueInputBuffer(AMediaCodec* codec, int64_t timeoutUs) const;
 		inline ssize_t AMediaCodec_dequeueOutputBuffer(AMediaCodec* codec, AMediaCodecBufferInfo* info, int64_t timeoutUs) const;
@@ -274,6 +284,7 @@ class OCEAN_MEDIA_A_EXPORT NativeMediaLibrary : public Singleton<NativeMediaLibr
 		inline AMediaFormat* AMediaCodec_getOutputFormat(AMediaCodec* codec) const;
 		inline media_status_t AMediaCodec_queueInputBuffer(AMediaCodec* codec, size_t idx, unsigned int offset, size_t size, uint64_t time, uint32_t flags) const;
 		inline media_status_t AMediaCodec_releaseOutputBuffer(AMediaCodec* codec, size_t idx, bool render) const;
+		inline media_status_t AMediaCodec_signalEndOfInputStream(AMediaCodec* codec) const;
 		inline media_status_t AMediaCodec_start(AMediaCodec* codec) const;
 		inline media_status_t AMediaCodec_stop(AMediaCodec* codec) const;
 
@@ -380,6 +391,7 @@ class OCEAN_MEDIA_A_EXPORT NativeMediaLibrary : public Singleton<NativeMediaLibr
 		Function_AMediaCodec_createDecoderByType* AMediaCodec_createDecoderByType_ = nullptr;
 		Function_AMediaCodec_createEncoderByType* AMediaCodec_createEncoderByType_ = nullptr;
 		Function_AMediaCodec_configure* AMediaCodec_configure_ = nullptr;
+		Function_AMediaCodec_createInputSurface* AMediaCodec_createInputSurface_ = nullptr; // optional, available since API level 26
 		Function_AMediaCodec_delete* AMediaCodec_delete_ = nullptr;
 		Function_AMediaCodec_dequeueInputBuffer* AMediaCodec_dequeueInputBuffer_ = nullptr;
 		Function_AMediaCodec_dequeueOutputBuffer* AMediaCodec_dequeueOutputBuffer_ = nullptr;
@@ -391,6 +403,7 @@ class OCEAN_MEDIA_A_EXPORT NativeMediaLibrary : public Singleton<NativeMediaLibr
 		Function_AMediaCodec_getOutputFormat* AMediaCodec_getOutputFormat_ = nullptr;
 		Function_AMediaCodec_queueInputBuffer* AMediaCodec_queueInputBuffer_ = nullptr;
 		Function_AMediaCodec_releaseOutputBuffer* AMediaCodec_releaseOutputBuffer_ = nullptr;
+		Function_AMediaCodec_signalEndOfInputStream* AMediaCodec_signalEndOfInputStream_ = nullptr; // optional, available since API level 26
 		Function_AMediaCodec_start* AMediaCodec_start_ = nullptr;
 		Function_AMediaCodec_stop* AMediaCodec_stop_ = nullptr;
 
@@ -462,6 +475,13 @@ inline bool NativeMediaLibrary::isInitialized() const
 	return initializationCounter_ != 0u;
 }
 
+inline bool NativeMediaLibrary::supportsInputSurfaces() const
+{
+	const ScopedLock scopedLock(lock_);
+
+	return AMediaCodec_createInputSurface_ != nullptr && AMediaCodec_signalEndOfInputStream_ != nullptr;
+}
+
 #if __ANDROID_API__ >= 24
 
 inline void NativeMediaLibrary::AImage_delete(AImage* image) const
@@ -650,6 +670,18 @@ inline media_status_t NativeMediaLibrary::AMediaCodec_configure(AMediaCodec* cod
 	return AMediaCodec_configure_(codec, format, surface, crypto, flags);
 }
 
+inline media_status_t NativeMediaLibrary::AMediaCodec_createInputSurface(AMediaCodec* codec, ANativeWindow** surface) const
+{
+	ocean_assert(isInitialized());
+
+	if (AMediaCodec_createInputSurface_ == nullptr)
+	{
+		return AMEDIA_ERROR_UNSUPPORTED;
+	}
+
+	return AMediaCodec_createInputSurface_(codec, surface);
+}
+
 inline media_status_t NativeMediaLibrary::AMediaCodec_delete(AMediaCodec* codec) const
 {
 	ocean_assert(isInitialized());
@@ -738,6 +770,18 @@ inline media_status_t NativeMediaLibrary::AMediaCodec_releaseOutputBuffer(AMedia
 	return AMediaCodec_releaseOutputBuffer_(codec, idx, render);
 }
 
+inline media_status_t NativeMediaLibrary::AMediaCodec_signalEndOfInputStream(AMediaCodec* codec) const
+{
+	ocean_assert(isInitialized());
+
+	if (AMediaCodec_signalEndOfInputStream_ == nullptr)
+	{
+		return AMEDIA_ERROR_UNSUPPORTED;
+	}
+
+	return AMediaCodec_signalEndOfInputStream_(codec);
+}
+
 inline media_status_t NativeMediaLibrary::AMediaCodec_start(AMediaCodec* codec) const
 {
 	ocean_assert(isInitialized());
@@ -43,7 +43,9 @@ class PixelFormats
 			// Android identifier for YUV420 color formats, identical to FORMAT_Y_UV12_LIMITED_RANGE, deprecated use COLOR_FORMAT_YUV420Flexible if possible.
 			COLOR_FORMAT_YUV420SemiPlanar = 21,
 			/// Android identifier for YUV420 color formats, identical to FORMAT_Y_U_V12_LIMITED_RANGE
-			COLOR_FORMAT_YUV420Flexible = 0x7f420888
+			COLOR_FORMAT_YUV420Flexible = 0x7f420888,
+			/// Android identifier for frames which are provided via an input surface (e.g., rendered with OpenGL ES) and not via memory buffers.
+			COLOR_FORMAT_Surface = 0x7f000789
 		};
 
 		/**
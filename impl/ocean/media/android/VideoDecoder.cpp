@@ -248,18 +248,68 @@ Frame VideoDecoder::extractVideoFrameFromCodecOutputBuffer(AMediaCodec* const me
 {
 	ocean_assert(mediaCodec != nullptr);
 
+	size_t outputBufferIndex = size_t(-1);
+	const Frame wrappedFrame = wrapVideoFrameFromCodecOutputBuffer(mediaCodec, outputBufferIndex, presentationTime);
+
+	if (!wrappedFrame.isValid())
+	{
+		return Frame();
+	}
+
+	Frame frame(wrappedFrame, Frame::ACM_COPY_REMOVE_PADDING_LAYOUT);
+
+	releaseCodecOutputBuffer(mediaCodec, outputBufferIndex);
+
+	return frame;
+}
+
+Frame VideoDecoder::wrapVideoFrameFromCodecOutputBuffer(AMediaCodec* const mediaCodec, size_t& outputBufferIndex, int64_t* presentationTime)
+{
+	ocean_assert(mediaCodec != nullptr);
+
 	NativeMediaLibrary& nativeMediaLibrary = NativeMediaLibrary::get();
 
 	AMediaCodecBufferInfo codecBufferInfo;
-	const ssize_t outputBufferIndex = nativeMediaLibrary.AMediaCodec_dequeueOutputBuffer(mediaCodec, &codecBufferInfo, 0);
+	const ssize_t dequeuedOutputBufferIndex = nativeMediaLibrary.AMediaCodec_dequeueOutputBuffer(mediaCodec, &codecBufferInfo, 0);
 
-	if (outputBufferIndex < 0)
+	if (dequeuedOutputBufferIndex < 0)
 	{
 		// no output buffer yet
 		return Frame();
 	}
 
-	const Timestamp relativeTimestamp(Timestamp::microseconds2seconds(codecBufferInfo.presentationTimeUs));
+	if (presentationTime != nullptr)
+	{
+		*presentationTime = codecBufferInfo.presentationTimeUs;
+	}
+
+	Frame frame = createFrameFromCodecOutputBuffer(mediaCodec, size_t(dequeuedOutputBufferIndex), Timestamp(Timestamp::microseconds2seconds(codecBufferInfo.presentationTimeUs)));
+
+	if (!frame.isValid())
+	{
+		// the output buffer is not used, so that we can release it immediately
+		releaseCodecOutputBuffer(mediaCodec, size_t(dequeuedOutputBufferIndex));
+
+		return Frame();
+	}
+
+	outputBufferIndex = size_t(dequeuedOutputBufferIndex);
+
+	return frame;
+}
+
+bool VideoDecoder::releaseCodecOutputBuffer(AMediaCodec* const mediaCodec, const size_t outputBufferIndex)
+{
+	ocean_assert(mediaCodec != nullptr);
+
+	return NativeMediaLibrary::get().AMediaCodec_releaseOutputBuffer(mediaCodec, outputBufferIndex, false /*render*/) == AMEDIA_OK;
+}
+
+Frame VideoDecoder::createFrameFromCodecOutputBuffer(AMediaCodec* const mediaCodec, const size_t outputBufferIndex, const Timestamp& relativeTimestamp)
+{
+	ocean_assert(mediaCodec != nullptr);
+
+	NativeMediaLibrary& nativeMediaLibrary = NativeMediaLibrary::get();
 
 	Frame frame;
 
@@ -336,7 +386,9 @@ Frame VideoDecoder::extractVideoFrameFromCodecOutputBuffer(AMediaCodec* const me
 
 		const FrameType::PixelFormat pixelFormat = PixelFormats::androidMediaCodecColorFormatToPixelFormat(PixelFormats::AndroidMediaCodecColorFormat(colorFormat), PixelFormats::AndroidMediaFormatColorRange(colorRange));
 
-		Frame::CopyMode copyMode = applyCrop ? Frame::CM_USE_KEEP_LAYOUT : Frame::CM_COPY_REMOVE_PADDING_LAYOUT;
+		// the frame wraps the memory of the output buffer, the memory is copied only if needed
+
+		constexpr Frame::CopyMode copyMode = Frame::CM_USE_KEEP_LAYOUT;
 
 		if (pixelFormat == FrameType::FORMAT_Y_U_V12_LIMITED_RANGE || pixelFormat == FrameType::FORMAT_Y_U_V12_FULL_RANGE || pixelFormat == FrameType::FORMAT_Y_UV12_LIMITED_RANGE || pixelFormat == FrameType::FORMAT_Y_UV12_FULL_RANGE)
 		{
@@ -448,7 +500,7 @@ Frame VideoDecoder::extractVideoFrameFromCodecOutputBuffer(AMediaCodec* const me
 			const unsigned int cropWidth = (unsigned int)(cropRight - cropLeft + 1);
 			const unsigned int cropHeight = (unsigned int)(cropBottom - cropTop + 1);
 
-			frame = frame.subFrame((unsigned int)(cropLeft), (unsigned int)(cropTop), cropWidth, cropHeight, Frame::CM_COPY_REMOVE_PADDING_LAYOUT);
+			frame = frame.subFrame((unsigned int)(cropLeft), (unsigned int)(cropTop), cropWidth, cropHeight, Frame::CM_USE_KEEP_LAYOUT);
 		}
 	}
 	else
@@ -456,13 +508,6 @@ Frame VideoDecoder::extractVideoFrameFromCodecOutputBuffer(AMediaCodec* const me
 		ocean_assert(false && "This should never happen!");
 	}
 
-	nativeMediaLibrary.AMediaCodec_releaseOutputBuffer(mediaCodec, size_t(outputBufferIndex), false /*render*/);
-
-	if (presentationTime != nullptr)
-	{
-		*presentationTime = codecBufferInfo.presentationTimeUs;
-	}
-
 	return frame;
 }
 
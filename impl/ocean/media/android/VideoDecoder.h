@@ -184,6 +184,27 @@ class VideoDecoder
 		 */
 		static Frame extractVideoFrameFromCodecOutputBuffer(AMediaCodec* const mediaCodec, int64_t* presentationTime = nullptr);
 
+		/**
+		 * Extracts the video frame from an output buffer of a video codec without copying the image content.
+		 * The resulting frame wraps the memory of the output buffer, the output buffer must be released via releaseCodecOutputBuffer() once the frame is not used anymore.<br>
+		 * In case the frame could not be extracted, the output buffer is released by this function.
+		 * @param mediaCodec The media codec to which the output buffer belongs, must be valid
+		 * @param outputBufferIndex The resulting index of the output buffer which needs to be released, defined only if the resulting frame is valid
+		 * @param presentationTime Optional resulting presentation time in micro seconds, with range (-infinity, infinity)
+		 * @return The resulting frame not owning the memory, invalid if the frame could not be extracted
+		 * @see extractVideoFrameFromCodecOutputBuffer().
+		 */
+		static Frame wrapVideoFrameFromCodecOutputBuffer(AMediaCodec* const mediaCodec, size_t& outputBufferIndex, int64_t* presentationTime = nullptr);
+
+		/**
+		 * Releases an output buffer of a video codec without rendering the buffer.
+		 * @param mediaCodec The media codec to which the output buffer belongs, must be valid
+		 * @param outputBufferIndex The index of the output buffer to release
+		 * @return True, if succeeded
+		 * @see wrapVideoFrameFromCodecOutputBuffer().
+		 */
+		static bool releaseCodecOutputBuffer(AMediaCodec* const mediaCodec, const size_t outputBufferIndex);
+
 		/**
 		 * Converts AVCC/HVCC formatted H.264/H.265 data to Annex B format.
 		 * For encoded samples (isCodecConfig = false): Replaces 4-byte big-endian length prefixes with start code prefixes (00 00 00 01).
@@ -227,6 +248,15 @@ class VideoDecoder
 		 */
 		VideoDecoder& operator=(const VideoDecoder&) = delete;
 
+		/**
+		 * Creates a frame wrapping the memory of an output buffer of a video codec.
+		 * @param mediaCodec The media codec to which the output buffer belongs, must be valid
+		 * @param outputBufferIndex The index of the dequeued output buffer
+		 * @param relativeTimestamp The relative timestamp of the frame, e.g., the presentation time
+		 * @return The resulting frame not owning the memory, invalid if the frame could not be created
+		 */
+		static Frame createFrameFromCodecOutputBuffer(AMediaCodec* const mediaCodec, const size_t outputBufferIndex, const Timestamp& relativeTimestamp);
+
 	protected:
 
 		/// The subscription for the native media library.
@@ -11,6 +11,8 @@
 #include "ocean/base/RandomI.h"
 #include "ocean/base/ScopedFunction.h"
 
+#include <algorithm>
+
 extern "C" {
 #include <libavformat/avformat.h>
 #include <libavcodec/avcodec.h>
@@ -152,6 +154,45 @@ bool FFMMovie::setPosition(const double position)
 	return true;
 }
 
+bool FFMMovie::setDecoderThreads(const unsigned int threads)
+{
+	const ScopedLock scopedLock(lock_);
+
+	if (isThreadActive())
+	{
+		return false;
+	}
+
+	if (threads == decoderThreads_)
+	{
+		return true;
+	}
+
+	decoderThreads_ = threads;
+
+	if (!isValid_)
+	{
+		return false;
+	}
+
+	// the number of threads can only be set before the codec is opened
+
+	releaseVideoCodec();
+
+	if (!createAndOpenVideoCodec())
+	{
+		isValid_ = false;
+		return false;
+	}
+
+	return true;
+}
+
+void FFMMovie::setDecodedFrameCacheCapacity(const unsigned int capacity)
+{
+	decodedFrameCacheCapacity_ = capacity;
+}
+
 bool FFMMovie::internalStart()
 {
 	ocean_assert(avFormatContext_ != nullptr && avVideoStreamIndex_ >= 0);
@@ -216,25 +257,22 @@ void FFMMovie::threadRun()
 
 	int64_t frameIndex = 0ll;
 
+	// all frames before this presentation timestamp have been decoded only to reach the seek position
+
+	int64_t skipPresentationTimestamp = std::numeric_limits<int64_t>::lowest();
+
 	while (shouldThreadStop() == false)
 	{
 		const double seekPosition = seekPosition_.exchange(-1.0);
 
 		if (seekPosition >= 0.0)
 		{
-			const int64_t targetTimestamp = int64_t(seekPosition * double(avTimeBase.den) / double(avTimeBase.num) + 0.5);
-
-			const int seekResult = avformat_seek_file(avFormatContext_, avVideoStreamIndex_, 0, targetTimestamp, avFormatContext_->streams[avVideoStreamIndex_]->duration, 0);
+			seekVideoStream(seekPosition, skipPresentationTimestamp);
+		}
 
-			if (seekResult >= 0)
-			{
-				// Reset the internal codec state / flush internal buffers.
-				avcodec_flush_buffers(avVideoCodecContext_);
-			}
-			else
-			{
-				Log::error() << "FFmpeg: Failed to change position in movie '" << url() << "': " << av_err2str(seekResult);
-			}
+		if (decodedFrameCacheCapacity_.load() == 0u && !decodedFrameCache_.empty())
+		{
+			decodedFrameCache_.clear();
 		}
 
 		if (isPaused_.load())
@@ -282,9 +320,28 @@ void FFMMovie::threadRun()
 								const int64_t presentationTimestamp = iPacket->second;
 								packetTimestampMap.erase(iPacket);
 
+								const bool cacheFrame = decodedFrameCacheCapacity_.load() != 0u;
+
+								if (presentationTimestamp < skipPresentationTimestamp)
+								{
+									// the frame is located before the seek position, we do not deliver but keep it for scrubbing
+
+									if (cacheFrame)
+									{
+										addToDecodedFrameCache(presentationTimestamp, extractFrame(avFrame, avVideoCodecContext_->pix_fmt, avVideoCodecContext_->color_range));
+									}
+
+									continue;
+								}
+
 								Frame frame = extractFrame(avFrame, avVideoCodecContext_->pix_fmt, avVideoCodecContext_->color_range);
 								ocean_assert(frame.isValid());
 
+								if (cacheFrame && frame.isValid())
+								{
+									addToDecodedFrameCache(presentationTimestamp, Frame(frame, Frame::ACM_COPY_REMOVE_PADDING_LAYOUT));
+								}
+
 								const double relativePresentationTimestamp = double(presentationTimestamp) * double(avTimeBase.num) / double(avTimeBase.den);
 
 								const float speed = speed_.load();
@@ -445,6 +502,11 @@ bool FFMMovie::createAndOpenVideoCodec()
 
 	normalDuration_ = double(avFormatContext_->streams[avVideoStreamIndex_]->duration) * double(avTimeBase.num) / double(avTimeBase.den);
 
+	// we decode several frames and slices concurrently, 0 lets FFmpeg select the number of threads based on the CPU cores
+
+	avVideoCodecContext_->thread_count = int(decoderThreads_);
+	avVideoCodecContext_->thread_type = FF_THREAD_FRAME | FF_THREAD_SLICE;
+
 	const int result = avcodec_open2(avVideoCodecContext_, avCodec, nullptr /*options*/);
 
 	if (result < 0)
@@ -470,6 +532,258 @@ void FFMMovie::releaseVideoCodec()
 	normalDuration_ = -1.0;
 }
 
+bool FFMMovie::seekVideoStream(const double position, int64_t& skipPresentationTimestamp)
+{
+	ocean_assert(position >= 0.0);
+	ocean_assert(avFormatContext_ != nullptr && avVideoStream_ != nullptr);
+
+	const AVRational avTimeBase = avVideoStream_->time_base;
+
+	const int64_t targetTimestamp = int64_t(position * double(avTimeBase.den) / double(avTimeBase.num) + 0.5);
+
+	if (!frameIndex_)
+	{
+		frameIndex_ = frameIndex(url());
+
+		if (!frameIndex_)
+		{
+			frameIndex_ = createFrameIndex();
+
+			if (frameIndex_ && frameIndex_->isValid())
+			{
+				registerFrameIndex(url(), frameIndex_);
+			}
+		}
+	}
+
+	int64_t framePresentationTimestamp = targetTimestamp;
+	int64_t keyframePresentationTimestamp = targetTimestamp;
+
+	const bool frameFound = frameIndex_ && frameIndex_->findFrame(targetTimestamp, framePresentationTimestamp, keyframePresentationTimestamp);
+
+	int seekResult = -1;
+
+	if (frameFound)
+	{
+		// we seek directly to the keyframe, so that the demuxer does not need to search for it
+
+		seekResult = avformat_seek_file(avFormatContext_, avVideoStreamIndex_, std::numeric_limits<int64_t>::lowest(), keyframePresentationTimestamp, keyframePresentationTimestamp, 0);
+	}
+	else
+	{
+		seekResult = avformat_seek_file(avFormatContext_, avVideoStreamIndex_, 0, targetTimestamp, avVideoStream_->duration, 0);
+	}
+
+	if (seekResult < 0)
+	{
+		Log::error() << "FFmpeg: Failed to change position in movie '" << url() << "': " << av_err2str(seekResult);
+		return false;
+	}
+
+	// Reset the internal codec state / flush internal buffers.
+	avcodec_flush_buffers(avVideoCodecContext_);
+
+	if (!frameFound)
+	{
+		skipPresentationTimestamp = std::numeric_limits<int64_t>::lowest();
+		return true;
+	}
+
+	skipPresentationTimestamp = framePresentationTimestamp;
+
+	const DecodedFrameCache::const_iterator iCachedFrame = decodedFrameCache_.find(framePresentationTimestamp);
+
+	if (iCachedFrame != decodedFrameCache_.cend())
+	{
+		// the frame at the seek position has been decoded before, so we can deliver it immediately
+
+		Frame frame(iCachedFrame->second, Frame::ACM_COPY_REMOVE_PADDING_LAYOUT);
+
+		const double relativePresentationTimestamp = double(framePresentationTimestamp) * double(avTimeBase.num) / double(avTimeBase.den);
+
+		position_ = relativePresentationTimestamp;
+
+		frame.setTimestamp(Timestamp(true));
+		frame.setRelativeTimestamp(Timestamp(relativePresentationTimestamp));
+
+		deliverNewFrame(std::move(frame));
+
+		skipPresentationTimestamp = framePresentationTimestamp + 1ll;
+	}
+
+	return true;
+}
+
+void FFMMovie::addToDecodedFrameCache(const int64_t presentationTimestamp, Frame&& frame)
+{
+	ocean_assert(frame.isValid());
+
+	if (!frame.isValid())
+	{
+		return;
+	}
+
+	const size_t capacity = size_t(decodedFrameCacheCapacity_.load());
+
+	decodedFrameCache_[presentationTimestamp] = std::move(frame);
+
+	while (decodedFrameCache_.size() > capacity)
+	{
+		ocean_assert(!decodedFrameCache_.empty());
+
+		// we remove the frame with the largest distance to the new frame, either the first or the last frame
+
+		const int64_t distanceFirst = presentationTimestamp - decodedFrameCache_.cbegin()->first;
+		const int64_t distanceLast = decodedFrameCache_.crbegin()->first - presentationTimestamp;
+
+		if (distanceFirst >= distanceLast)
+		{
+			decodedFrameCache_.erase(decodedFrameCache_.begin());
+		}
+		else
+		{
+			decodedFrameCache_.erase(std::prev(decodedFrameCache_.end()));
+		}
+	}
+}
+
+FFMMovie::SharedFrameIndex FFMMovie::createFrameIndex()
+{
+	ocean_assert(avFormatContext_ != nullptr && avVideoStream_ != nullptr);
+
+	std::shared_ptr<FrameIndex> frameIndex = std::make_shared<FrameIndex>();
+
+	const int seekResult = avformat_seek_file(avFormatContext_, avVideoStreamIndex_, 0, 0, avVideoStream_->duration, 0);
+
+	if (seekResult < 0)
+	{
+		Log::error() << "FFmpeg: Failed to create frame index for '" << url() << "': " << av_err2str(seekResult);
+		return frameIndex;
+	}
+
+	AVPacket avPacket;
+
+	while (true)
+	{
+		if (shouldThreadStop())
+		{
+			return nullptr;
+		}
+
+		const int readFrameResult = av_read_frame(avFormatContext_, &avPacket);
+
+		if (readFrameResult != 0)
+		{
+			if (readFrameResult != AVERROR_EOF)
+			{
+				Log::error() << "FFmpeg: Failed to create frame index for '" << url() << "': " << av_err2str(readFrameResult);
+
+				frameIndex->framePresentationTimestamps_.clear();
+				frameIndex->keyframePresentationTimestamps_.clear();
+			}
+
+			break;
+		}
+
+		if (avPacket.stream_index == avVideoStreamIndex_)
+		{
+			const int64_t timestamp = packetTimestamp(avPacket);
+
+			if (timestamp != AV_NOPTS_VALUE)
+			{
+				frameIndex->framePresentationTimestamps_.emplace_back(timestamp);
+
+				if ((avPacket.flags & AV_PKT_FLAG_KEY) == AV_PKT_FLAG_KEY)
+				{
+					frameIndex->keyframePresentationTimestamps_.emplace_back(timestamp);
+				}
+			}
+		}
+
+		av_packet_unref(&avPacket);
+	}
+
+	// packets are stored in decoding order
+
+	std::sort(frameIndex->framePresentationTimestamps_.begin(), frameIndex->framePresentationTimestamps_.end());
+	std::sort(frameIndex->keyframePresentationTimestamps_.begin(), frameIndex->keyframePresentationTimestamps_.end());
+
+	Log::debug() << "FFmpeg: Created frame index for '" << url() << "' with " << frameIndex->framePresentationTimestamps_.size() << " frames and " << frameIndex->keyframePresentationTimestamps_.size() << " keyframes";
+
+	return frameIndex;
+}
+
+FFMMovie::SharedFrameIndex FFMMovie::frameIndex(const std::string& url)
+{
+	const ScopedLock scopedLock(frameIndexLock());
+
+	const FrameIndexMap& map = frameIndexMap();
+
+	const FrameIndexMap::const_iterator iFrameIndex = map.find(url);
+
+	if (iFrameIndex == map.cend())
+	{
+		return nullptr;
+	}
+
+	return iFrameIndex->second;
+}
+
+void FFMMovie::registerFrameIndex(const std::string& url, const SharedFrameIndex& frameIndex)
+{
+	ocean_assert(frameIndex && frameIndex->isValid());
+
+	const ScopedLock scopedLock(frameIndexLock());
+
+	frameIndexMap()[url] = frameIndex;
+}
+
+Lock& FFMMovie::frameIndexLock()
+{
+	static Lock lock;
+
+	return lock;
+}
+
+FFMMovie::FrameIndexMap& FFMMovie::frameIndexMap()
+{
+	static FrameIndexMap map;
+
+	return map;
+}
+
+int64_t FFMMovie::packetTimestamp(const AVPacket& avPacket)
+{
+	if (avPacket.pts != AV_NOPTS_VALUE)
+	{
+		return avPacket.pts;
+	}
+
+	return avPacket.dts;
+}
+
+bool FFMMovie::FrameIndex::findFrame(const int64_t presentationTimestamp, int64_t& framePresentationTimestamp, int64_t& keyframePresentationTimestamp) const
+{
+	if (framePresentationTimestamps_.empty() || keyframePresentationTimestamps_.empty())
+	{
+		return false;
+	}
+
+	// the frame displayed at the timestamp is the last frame not after the timestamp
+
+	const std::vector<int64_t>::const_iterator iFrame = std::upper_bound(framePresentationTimestamps_.cbegin(), framePresentationTimestamps_.cend(), presentationTimestamp);
+
+	framePresentationTimestamp = iFrame == framePresentationTimestamps_.cbegin() ? *iFrame : *(iFrame - 1);
+
+	const std::vector<int64_t>::const_iterator iKeyframe = std::upper_bound(keyframePresentationTimestamps_.cbegin(), keyframePresentationTimestamps_.cend(), framePresentationTimestamp);
+
+	keyframePresentationTimestamp = iKeyframe == keyframePresentationTimestamps_.cbegin() ? *iKeyframe : *(iKeyframe - 1);
+
+	ocean_assert(keyframePresentationTimestamp <= framePresentationTimestamp || iKeyframe == keyframePresentationTimestamps_.cbegin());
+
+	return true;
+}
+
 Frame FFMMovie::extractFrame(AVFrame* avFrame, const int avPixelFormat, const int avColorRange)
 {
 	ocean_assert(avFrame != nullptr && avPixelFormat >= 0);
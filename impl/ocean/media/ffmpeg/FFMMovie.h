@@ -15,9 +15,12 @@
 
 #include "ocean/media/Movie.h"
 
+#include <map>
+
 // Forward declaration.
 struct AVCodecContext;
 struct AVFrame;
+struct AVPacket;
 struct AVStream;
 
 namespace Ocean
@@ -47,6 +50,53 @@ class FFMMovie :
 		 */
 		using PacketTimestampMap = std::unordered_map<int64_t, int64_t>;
 
+		/**
+		 * This class holds the presentation timestamps of all video frames of a movie file.
+		 * The index is created once per file and is shared between all movies using the same file.
+		 */
+		class FrameIndex
+		{
+			public:
+
+				/**
+				 * Determines the frame which is displayed at a given presentation timestamp and the keyframe from which the decoding needs to start.
+				 * @param presentationTimestamp The presentation timestamp for which the frame will be determined, in the time base of the video stream
+				 * @param framePresentationTimestamp The resulting presentation timestamp of the frame displayed at the given timestamp
+				 * @param keyframePresentationTimestamp The resulting presentation timestamp of the latest keyframe not after the resulting frame
+				 * @return True, if succeeded
+				 */
+				bool findFrame(const int64_t presentationTimestamp, int64_t& framePresentationTimestamp, int64_t& keyframePresentationTimestamp) const;
+
+				/**
+				 * Returns whether this index holds at least one keyframe.
+				 * @return True, if so
+				 */
+				inline bool isValid() const;
+
+			public:
+
+				/// The sorted presentation timestamps of all video frames.
+				std::vector<int64_t> framePresentationTimestamps_;
+
+				/// The sorted presentation timestamps of all keyframes.
+				std::vector<int64_t> keyframePresentationTimestamps_;
+		};
+
+		/**
+		 * Definition of a shared pointer holding a frame index.
+		 */
+		using SharedFrameIndex = std::shared_ptr<const FrameIndex>;
+
+		/**
+		 * Definition of an unordered map mapping urls of movie files to frame indices.
+		 */
+		using FrameIndexMap = std::unordered_map<std::string, SharedFrameIndex>;
+
+		/**
+		 * Definition of an ordered map mapping presentation timestamps to decoded frames.
+		 */
+		using DecodedFrameCache = std::map<int64_t, Frame>;
+
 	public:
 
 		/**
@@ -121,6 +171,20 @@ class FFMMovie :
 		 */
 		bool setUseSound(const bool state) override;
 
+		/**
+		 * Sets the number of threads the video decoder is using.
+		 * The decoder uses frame-based and slice-based threading, the number of threads can only be changed while the movie is not started.
+		 * @param threads The number of decoder threads, 0 to let FFmpeg determine the number of threads based on the available CPU cores, 1 to disable threading
+		 * @return True, if succeeded
+		 */
+		bool setDecoderThreads(const unsigned int threads);
+
+		/**
+		 * Sets the number of decoded frames which are kept in memory to speed up seeking back and forth around the same position.
+		 * @param capacity The maximal number of cached frames, 0 to disable the cache
+		 */
+		void setDecodedFrameCacheCapacity(const unsigned int capacity);
+
 	protected:
 
 		/**
@@ -180,6 +244,62 @@ class FFMMovie :
 		 */
 		static FrameType::PixelFormat translatePixelFormat(const int avPixelFormat, const int avColorRange);
 
+		/**
+		 * Seeks the video stream to the keyframe before a given position, the frame index of the movie file is created if not yet available.
+		 * A frame of the decoded frame cache matching the position is delivered immediately.
+		 * @param position The new position in seconds, with range [0, infinity)
+		 * @param skipPresentationTimestamp The resulting presentation timestamp of the first frame which needs to be delivered after seeking, all decoded frames before this timestamp need to be skipped
+		 * @return True, if succeeded
+		 */
+		bool seekVideoStream(const double position, int64_t& skipPresentationTimestamp);
+
+		/**
+		 * Adds a decoded frame to the decoded frame cache, the frame with the largest distance to the new frame is removed if the cache is full.
+		 * @param presentationTimestamp The presentation timestamp of the frame
+		 * @param frame The decoded frame to be added, must be valid
+		 */
+		void addToDecodedFrameCache(const int64_t presentationTimestamp, Frame&& frame);
+
+		/**
+		 * Creates the frame index of the video stream by reading all packets of the movie file.
+		 * The read position of the format context will be undefined afterwards.
+		 * @return The resulting frame index, an invalid index if the movie file could not be read, nullptr if the creation has been interrupted because the thread is about to stop
+		 */
+		SharedFrameIndex createFrameIndex();
+
+		/**
+		 * Returns the frame index of a movie file if the index has been created before.
+		 * @param url The url of the movie file
+		 * @return The frame index, nullptr if not yet created
+		 */
+		static SharedFrameIndex frameIndex(const std::string& url);
+
+		/**
+		 * Registers the frame index of a movie file, so that other movies using the same file do not need to create the index again.
+		 * @param url The url of the movie file
+		 * @param frameIndex The frame index to register, must be valid
+		 */
+		static void registerFrameIndex(const std::string& url, const SharedFrameIndex& frameIndex);
+
+		/**
+		 * Returns the lock protecting the map of frame indices.
+		 * @return The lock
+		 */
+		static Lock& frameIndexLock();
+
+		/**
+		 * Returns the map holding the frame indices of all movie files which have been indexed so far.
+		 * @return The map, the caller must hold frameIndexLock()
+		 */
+		static FrameIndexMap& frameIndexMap();
+
+		/**
+		 * Returns the presentation timestamp of a packet, the decoding timestamp if the presentation timestamp is unknown.
+		 * @param avPacket The packet, must be valid
+		 * @return The packet's timestamp
+		 */
+		static int64_t packetTimestamp(const AVPacket& avPacket);
+
 	private:
 
 		/**
@@ -212,8 +332,25 @@ class FFMMovie :
 
 		/// True, if the movie is paused.
 		std::atomic<bool> isPaused_ = false;
+
+		/// The number of decoder threads, 0 to let FFmpeg decide.
+		unsigned int decoderThreads_ = 0u;
+
+		/// The frame index of the video stream, nullptr if not yet created; used by the movie's thread only.
+		SharedFrameIndex frameIndex_;
+
+		/// The cache of decoded frames; used by the movie's thread only.
+		DecodedFrameCache decodedFrameCache_;
+
+		/// The maximal number of frames in the decoded frame cache, 0 if the cache is disabled.
+		std::atomic<unsigned int> decodedFrameCacheCapacity_ = 0u;
 };
 
+inline bool FFMMovie::FrameIndex::isValid() const
+{
+	return !keyframePresentationTimestamps_.empty();
+}
+
 }
 
 }
@@ -28,6 +28,11 @@ namespace OpenImageLibraries
 {
 
 Frame Image::decodeImage(const void* buffer, const size_t size, const std::string& imageBufferTypeIn, std::string* imageBufferTypeOut)
+{
+	return decodeImage(buffer, size, 0u, 0u, imageBufferTypeIn, imageBufferTypeOut);
+}
+
+Frame Image::decodeImage(const void* buffer, const size_t size, const unsigned int minimalWidth, const unsigned int minimalHeight, const std::string& imageBufferTypeIn, std::string* imageBufferTypeOut)
 {
 	if (buffer == nullptr || size == 0)
 	{
@@ -41,7 +46,7 @@ Frame Image::decodeImage(const void* buffer, const size_t size, const std::strin
 #ifdef OCEAN_MEDIA_OIL_SUPPORT_JPG
 	if (!result.isValid() && (imageBufferTypeIn.empty() || imageBufferTypeIn == "jpg" || imageBufferTypeIn == "jpeg" || imageBufferTypeIn == "jpe"))
 	{
-		result = ImageJpg::decodeImage(buffer, size);
+		result = ImageJpg::decodeImage(buffer, size, minimalWidth, minimalHeight);
 
 		if (result && imageBufferTypeOut)
 		{
@@ -223,6 +228,11 @@ bool Image::encodeImage(const Frame& frame, const std::string& imageType, std::v
 }
 
 Frame Image::readImage(const std::string& filename)
+{
+	return readImage(filename, 0u, 0u);
+}
+
+Frame Image::readImage(const std::string& filename, const unsigned int minimalWidth, const unsigned int minimalHeight)
 {
 	const std::string::size_type fileExtensionPos = filename.rfind('.');
 
@@ -264,7 +274,7 @@ Frame Image::readImage(const std::string& filename)
 		return Frame();
 	}
 
-	return decodeImage(buffer.data(), buffer.size(), filename.substr(fileExtensionPos + 1));
+	return decodeImage(buffer.data(), buffer.size(), minimalWidth, minimalHeight, filename.substr(fileExtensionPos + 1));
 }
 
 bool Image::writeImage(const Frame& frame, const std::string& filename, const bool allowConversion, bool* hasBeenConverted, const Properties& properties)
@@ -77,6 +77,20 @@ class OCEAN_MEDIA_OIL_EXPORT Image
 		 */
 		static Frame decodeImage(const void* buffer, const size_t size, const std::string& imageBufferTypeIn = std::string(), std::string* imageBufferTypeOut = nullptr);
 
+		/**
+		 * Decodes (reads/loads) an image from a given binary buffer with a reduced resolution if supported by the image codec.
+		 * JPEG images are reduced by 1/2, 1/4, or 1/8 while decoding so that the resulting image is still at least as large as the specified minimal size; other image types are decoded with full resolution.
+		 * @param buffer The buffer from which the image will be loaded, must be valid
+		 * @param size The size of the given buffer in bytes, with range [1, infinity)
+		 * @param minimalWidth The minimal width of the resulting image in pixel, 0 to avoid any reduction independent of the image width
+		 * @param minimalHeight The minimal height of the resulting image in pixel, 0 to avoid any reduction independent of the image height
+		 * @param imageBufferTypeIn Type of the given image that is stored in the buffer, should be specified if known (e.g. the file extension of a corresponding image file)
+		 * @param imageBufferTypeOut Optional type of the given image that is stored in the buffer, as determined by the decoder (if possible)
+		 * @return The frame containing the image information, an invalid frame if the image could not be loaded
+		 * @see writeImage().
+		 */
+		static Frame decodeImage(const void* buffer, const size_t size, const unsigned int minimalWidth, const unsigned int minimalHeight, const std::string& imageBufferTypeIn = std::string(), std::string* imageBufferTypeOut = nullptr);
+
 		/**
 		 * Encodes (writes) a given frame as image (with specified image type) to a resulting buffer.
 		 * @param frame The frame to be written, must be valid
@@ -98,6 +112,16 @@ class OCEAN_MEDIA_OIL_EXPORT Image
 		 */
 		static Frame readImage(const std::string& filename);
 
+		/**
+		 * Reads/loads an image from a specified file with a reduced resolution if supported by the image codec.
+		 * @param filename The name of the file from which the image will be loaded, must be valid
+		 * @param minimalWidth The minimal width of the resulting image in pixel, 0 to avoid any reduction independent of the image width
+		 * @param minimalHeight The minimal height of the resulting image in pixel, 0 to avoid any reduction independent of the image height
+		 * @return The frame containing the image information, an invalid frame if the image could not be loaded
+		 * @see decodeImage().
+		 */
+		static Frame readImage(const std::string& filename, const unsigned int minimalWidth, const unsigned int minimalHeight);
+
 		/**
 		 * Writes a given frame to a specified file.
 		 * @param frame The frame to be written, must be valid
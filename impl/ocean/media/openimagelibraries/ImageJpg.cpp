@@ -51,7 +51,7 @@ void imageJpgErrorExit(j_common_ptr cinfo)
 	longjmp(myerr->setjmp_buffer, 1);
 }
 
-Frame ImageJpg::decodeImage(const void* buffer, const size_t size)
+Frame ImageJpg::decodeImage(const void* buffer, const size_t size, const unsigned int minimalWidth, const unsigned int minimalHeight)
 {
 	ocean_assert(buffer != nullptr && size > 0);
 
@@ -94,6 +94,14 @@ Frame ImageJpg::decodeImage(const void* buffer, const size_t size)
 		return Frame();
 	}
 
+	if (minimalWidth != 0u || minimalHeight != 0u)
+	{
+		// libjpeg scales the image in the DCT domain, so that the full resolution image is never created
+
+		decompressStruct.scale_num = 1u;
+		decompressStruct.scale_denom = determineScaleDenominator(decompressStruct.image_width, decompressStruct.image_height, minimalWidth, minimalHeight);
+	}
+
 	// we start the decompression
 	jpeg_start_decompress(&decompressStruct);
 
@@ -157,6 +165,32 @@ Frame ImageJpg::decodeImage(const void* buffer, const size_t size)
 	return result;
 }
 
+unsigned int ImageJpg::determineScaleDenominator(const unsigned int imageWidth, const unsigned int imageHeight, const unsigned int minimalWidth, const unsigned int minimalHeight)
+{
+	ocean_assert(imageWidth >= 1u && imageHeight >= 1u);
+
+	unsigned int scaleDenominator = 1u;
+
+	while (scaleDenominator < 8u)
+	{
+		const unsigned int nextScaleDenominator = scaleDenominator * 2u;
+
+		// libjpeg rounds the size of the scaled image up
+
+		const unsigned int scaledWidth = (imageWidth + nextScaleDenominator - 1u) / nextScaleDenominator;
+		const unsigned int scaledHeight = (imageHeight + nextScaleDenominator - 1u) / nextScaleDenominator;
+
+		if (scaledWidth < minimalWidth || scaledHeight < minimalHeight)
+		{
+			break;
+		}
+
+		scaleDenominator = nextScaleDenominator;
+	}
+
+	return scaleDenominator;
+}
+
 bool ImageJpg::encodeImage(const Frame& frame, std::vector<unsigned char>& buffer, const bool allowConversion, bool* hasBeenConverted, const int quality)
 {
 	ocean_assert(frame);
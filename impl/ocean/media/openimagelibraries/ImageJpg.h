@@ -33,11 +33,15 @@ class OCEAN_MEDIA_OIL_EXPORT ImageJpg
 
 		/**
 		 * Decode a JPEG image from a given binary buffer.
+		 * The image can be decoded with reduced resolution (1/2, 1/4, or 1/8) by scaling in the DCT domain, so that decoding time and memory are reduced significantly.<br>
+		 * The image is reduced as much as possible while the resulting image is still at least as large as the specified minimal size.
 		 * @param buffer The buffer from which the image will be loaded, must be valid
 		 * @param size The size of the given buffer in bytes, with range [1, infinity)
+		 * @param minimalWidth The minimal width of the resulting image in pixel, 0 to avoid any reduction independent of the image width
+		 * @param minimalHeight The minimal height of the resulting image in pixel, 0 to avoid any reduction independent of the image height
 		 * @return The frame containing the image information, an invalid frame if the image could not be loaded
 		 */
-		static Frame decodeImage(const void* buffer, const size_t size);
+		static Frame decodeImage(const void* buffer, const size_t size, const unsigned int minimalWidth = 0u, const unsigned int minimalHeight = 0u);
 
 		/**
 		 * Encode a given frame as JPEG image to a resulting buffer.
@@ -92,6 +96,16 @@ class OCEAN_MEDIA_OIL_EXPORT ImageJpg
 		 * @return True, if the Ocean-based pixel format has a equivalent JPEG format; False, if the pixel format cannot be represented in JPEG
 		 */
 		static bool translatePixelFormat(const FrameType::PixelFormat pixelFormat, int& jpegColorSpace, int& jpegPrecision, int& jpegNumberComponents);
+
+		/**
+		 * Determines the largest scale denominator for a reduced-resolution decoding so that the decoded image is still at least as large as a minimal size.
+		 * @param imageWidth The width of the encoded image in pixel, with range [1, infinity)
+		 * @param imageHeight The height of the encoded image in pixel, with range [1, infinity)
+		 * @param minimalWidth The minimal width of the decoded image in pixel, with range [0, infinity)
+		 * @param minimalHeight The minimal height of the decoded image in pixel, with range [0, infinity)
+		 * @return The scale denominator, either 1, 2, 4, or 8
+		 */
+		static unsigned int determineScaleDenominator(const unsigned int imageWidth, const unsigned int imageHeight, const unsigned int minimalWidth, const unsigned int minimalHeight);
 };
 
 inline bool ImageJpg::isPixelFormatSupported(const FrameType::PixelFormat pixelFormat)
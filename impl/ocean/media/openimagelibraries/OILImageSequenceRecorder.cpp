@@ -6,12 +6,15 @@
  */
 
 #include "ocean/media/openimagelibraries/OILImageSequenceRecorder.h"
+#include "ocean/media/openimagelibraries/Image.h"
 
 #include "ocean/base/DateTime.h"
 #include "ocean/base/String.h"
 
 #include "ocean/io/File.h"
 
+#include <fstream>
+
 namespace Ocean
 {
 
@@ -40,7 +43,7 @@ unsigned int OILImageSequenceRecorder::pendingImages() const
 {
 	const ScopedLock scopedLock(frameQueueLock_);
 
-	return (unsigned int)(frameQueue_.size());
+	return (unsigned int)(frameQueue_.size()) + encodingImages_;
 }
 
 OILImageSequenceRecorder::Encoders OILImageSequenceRecorder::frameEncoders() const
@@ -89,6 +92,30 @@ bool OILImageSequenceRecorder::setStartIndex(const unsigned int index)
 	return ImageSequenceRecorder::setStartIndex(index);
 }
 
+bool OILImageSequenceRecorder::setEncoderThreads(const unsigned int threads)
+{
+	const ScopedLock scopedLock(lock_);
+
+	if (isRecording_)
+	{
+		return false;
+	}
+
+	return ImageSequenceRecorder::setEncoderThreads(threads);
+}
+
+bool OILImageSequenceRecorder::setMaximalPendingImages(const unsigned int maximalPendingImages)
+{
+	const ScopedLock scopedLock(lock_);
+
+	if (isRecording_)
+	{
+		return false;
+	}
+
+	return ImageSequenceRecorder::setMaximalPendingImages(maximalPendingImages);
+}
+
 bool OILImageSequenceRecorder::addImage(const Frame& frame)
 {
 	if (!frame.isValid())
@@ -101,7 +128,7 @@ bool OILImageSequenceRecorder::addImage(const Frame& frame)
 		return false;
 	}
 
-	const FrameRef frameRef(new Frame(frame, Frame::ACM_COPY_KEEP_LAYOUT_COPY_PADDING_DATA));
+	FrameRef frameRef(new Frame(frame, Frame::ACM_COPY_KEEP_LAYOUT_COPY_PADDING_DATA));
 
 	const ScopedLock scopedLock(lock_);
 
@@ -109,10 +136,9 @@ bool OILImageSequenceRecorder::addImage(const Frame& frame)
 	{
 		imageRecorder_.saveImage(*frameRef, addOptionalSuffixToFilename(filename_, frameCounter_ + startIndex_, filenameSuffixed_));
 	}
-	else
+	else if (!enqueueFrame(std::move(frameRef)))
 	{
-		const ScopedLock scopedLockQueue(frameQueueLock_);
-		frameQueue_.push(std::make_pair(frameRef, frameCounter_));
+		return false;
 	}
 
 	frameCounter_++;
@@ -135,11 +161,19 @@ bool OILImageSequenceRecorder::start()
 	}
 
 	frameCounter_ = 0u;
+
+	TemporaryScopedLock scopedLockQueue(frameQueueLock_);
+
 	while (!frameQueue_.empty())
 	{
 		frameQueue_.pop();
 	}
 
+	scopedLockQueue.release();
+
+	droppedImages_ = 0u;
+	peakPendingImages_ = 0u;
+
 	startTimestamp_.toNow();
 
 	if (recorderMode_ == RM_PARALLEL && !isThreadInvokedToStart())
@@ -246,48 +280,176 @@ void OILImageSequenceRecorder::unlockBufferToFill()
 	if (recorderMode_ == RM_IMMEDIATE)
 	{
 		imageRecorder_.saveImage(frame_, addOptionalSuffixToFilename(filename_, frameCounter_ + startIndex_, filenameSuffixed_));
+
+		frameCounter_++;
 	}
-	else
+	else if (enqueueFrame(FrameRef(new Frame(std::move(frame_)))))
 	{
-		const ScopedLock scopedLockQueue(frameQueueLock_);
-		frameQueue_.push(std::make_pair(FrameRef(new Frame(std::move(frame_))), frameCounter_));
+		frameCounter_++;
 	}
 
-	frameCounter_++;
-
 	frame_.release();
 }
 
 void OILImageSequenceRecorder::threadRun()
 {
-	while (!shouldThreadStop())
+	ThreadPool encoderPool;
+	unsigned int encoderThreads = 0u;
+
+	// the dispatch indices define the order in which the encoded images are written
+
+	uint64_t nextDispatchIndex = 0ull;
+	uint64_t nextWriteIndex = 0ull;
+
+	while (true)
 	{
-		FrameRef frame;
-		unsigned int frameIndex = (unsigned int)(-1);
+		const bool stopping = shouldThreadStop();
+
+		if (stopping && nextWriteIndex == nextDispatchIndex)
+		{
+			// all images which have been dispatched before have been written
+			break;
+		}
 
-		TemporaryScopedLock scopedLock(frameQueueLock_);
+		bool idle = true;
 
-		if (!frameQueue_.empty())
+		if (encoderThreads != encoderThreads_)
 		{
-			frame = frameQueue_.front().first;
-			frameIndex = frameQueue_.front().second;
-			frameQueue_.pop();
+			encoderThreads = std::max(1u, encoderThreads_);
+			encoderPool.setCapacity(encoderThreads);
 		}
 
-		scopedLock.release();
+		if (!stopping)
+		{
+			// we keep twice as many images in flight as we have encoder threads, so that the encoders are busy while images are written
 
-		if (frame)
+			std::vector<std::pair<FrameRef, unsigned int>> framesToEncode;
+
+			TemporaryScopedLock scopedLock(frameQueueLock_);
+
+			while (!frameQueue_.empty() && encodingImages_ < encoderThreads * 2u)
+			{
+				framesToEncode.emplace_back(std::move(frameQueue_.front()));
+				frameQueue_.pop();
+
+				++encodingImages_;
+			}
+
+			scopedLock.release();
+
+			for (std::pair<FrameRef, unsigned int>& frameToEncode : framesToEncode)
+			{
+				const std::string filename = addOptionalSuffixToFilename(filename_, frameToEncode.second + startIndex_, filenameSuffixed_);
+
+				encoderPool.invoke(std::bind(&OILImageSequenceRecorder::encodeImage, this, nextDispatchIndex++, std::move(frameToEncode.first), filename));
+
+				idle = false;
+			}
+		}
+
+		while (nextWriteIndex < nextDispatchIndex)
 		{
-			ocean_assert(frameIndex != (unsigned int)(-1));
-			imageRecorder_.saveImage(*frame, addOptionalSuffixToFilename(filename_, frameIndex + startIndex_, filenameSuffixed_));
+			EncodedImage encodedImage;
+
+			TemporaryScopedLock scopedLock(frameQueueLock_);
+
+			const EncodedImageMap::iterator iEncodedImage = encodedImages_.find(nextWriteIndex);
+
+			if (iEncodedImage == encodedImages_.end())
+			{
+				// the next image is still being encoded
+				break;
+			}
+
+			encodedImage = std::move(iEncodedImage->second);
+			encodedImages_.erase(iEncodedImage);
+
+			scopedLock.release();
+
+			if (encodedImage.second.empty() || !writeEncodedImage(encodedImage.first, encodedImage.second))
+			{
+				Log::error() << "Failed to save image \"" << encodedImage.first << "\"";
+			}
+
+			++nextWriteIndex;
+
+			const ScopedLock scopedLockCounter(frameQueueLock_);
+
+			ocean_assert(encodingImages_ >= 1u);
+			--encodingImages_;
+
+			idle = false;
 		}
-		else
+
+		if (idle)
 		{
 			sleep(1);
 		}
 	}
 }
 
+bool OILImageSequenceRecorder::enqueueFrame(FrameRef&& frame)
+{
+	ocean_assert(frame && frame->isValid());
+
+	const ScopedLock scopedLockQueue(frameQueueLock_);
+
+	const unsigned int pendingImages = (unsigned int)(frameQueue_.size()) + encodingImages_;
+
+	if (recorderMode_ == RM_PARALLEL && maximalPendingImages_ != 0u && pendingImages >= maximalPendingImages_)
+	{
+		// the encoders cannot keep up with the frame rate, so we drop the frame
+
+		++droppedImages_;
+		return false;
+	}
+
+	frameQueue_.push(std::make_pair(std::move(frame), frameCounter_));
+
+	if (pendingImages + 1u > peakPendingImages_)
+	{
+		peakPendingImages_ = pendingImages + 1u;
+	}
+
+	return true;
+}
+
+void OILImageSequenceRecorder::encodeImage(const uint64_t dispatchIndex, const FrameRef& frame, const std::string& filename)
+{
+	ocean_assert(frame && frame->isValid());
+
+	std::vector<uint8_t> buffer;
+
+	const std::string::size_type fileExtensionPos = filename.rfind('.');
+
+	if (fileExtensionPos == std::string::npos || !Image::encodeImage(*frame, filename.substr(fileExtensionPos + 1), buffer))
+	{
+		buffer.clear();
+	}
+
+	const ScopedLock scopedLock(frameQueueLock_);
+
+	ocean_assert(encodedImages_.find(dispatchIndex) == encodedImages_.cend());
+	encodedImages_.emplace(dispatchIndex, EncodedImage(filename, std::move(buffer)));
+}
+
+bool OILImageSequenceRecorder::writeEncodedImage(const std::string& filename, const std::vector<uint8_t>& buffer)
+{
+	ocean_assert(!filename.empty() && !buffer.empty());
+
+	std::ofstream outputStream(filename.c_str(), std::ios::binary);
+
+	if (!outputStream.is_open())
+	{
+		Log::warning() << "Could not open image file \"" << filename << "\"";
+		return false;
+	}
+
+	outputStream.write((const char*)(buffer.data()), buffer.size());
+
+	return outputStream.good();
+}
+
 }
 
 }
@@ -14,8 +14,10 @@
 #include "ocean/media/ImageSequenceRecorder.h"
 
 #include "ocean/base/Thread.h"
+#include "ocean/base/ThreadPool.h"
 
 #include <queue>
+#include <unordered_map>
 
 namespace Ocean
 {
@@ -28,6 +30,7 @@ namespace OpenImageLibraries
 
 /**
  * This class implements an OpenImageLibraries image sequence recorder.
+ * In RM_PARALLEL mode, the images are encoded with a pool of encoder threads while the recorder's thread writes the encoded images in the order in which they have been added.
  * @ingroup mediaoil
  */
 class OCEAN_MEDIA_OIL_EXPORT OILImageSequenceRecorder :
@@ -43,6 +46,16 @@ class OCEAN_MEDIA_OIL_EXPORT OILImageSequenceRecorder :
 		 */
 		using FrameQueue = std::queue<std::pair<FrameRef, unsigned int>>;
 
+		/**
+		 * Definition of a pair combining the filename of an image with the encoded image data, the data is empty if the encoding failed.
+		 */
+		using EncodedImage = std::pair<std::string, std::vector<uint8_t>>;
+
+		/**
+		 * Definition of an unordered map mapping dispatch indices to encoded images.
+		 */
+		using EncodedImageMap = std::unordered_map<uint64_t, EncodedImage>;
+
 	public:
 
 		/**
@@ -75,6 +88,18 @@ class OCEAN_MEDIA_OIL_EXPORT OILImageSequenceRecorder :
 		 */
 		bool setStartIndex(const unsigned int index) override;
 
+		/**
+		 * Sets the number of encoder threads which are used in RM_PARALLEL mode.
+		 * @see ImageSequenceRecorder::setEncoderThreads().
+		 */
+		bool setEncoderThreads(const unsigned int threads) override;
+
+		/**
+		 * Sets the maximal number of images which can be pending in RM_PARALLEL mode.
+		 * @see ImageSequenceRecorder::setMaximalPendingImages().
+		 */
+		bool setMaximalPendingImages(const unsigned int maximalPendingImages) override;
+
 		/**
 		 * Adds a given frame explicity.
 		 * @see ImageSequenceRecorder::addImage().
@@ -135,6 +160,30 @@ class OCEAN_MEDIA_OIL_EXPORT OILImageSequenceRecorder :
 		 */
 		void threadRun() override;
 
+		/**
+		 * Adds a frame to the queue of frames to be saved, the frame is dropped if the maximal number of pending images is reached.
+		 * The caller must hold the recorder's lock.
+		 * @param frame The frame to be added, must be valid
+		 * @return True, if the frame has been added; False, if the frame has been dropped
+		 */
+		bool enqueueFrame(FrameRef&& frame);
+
+		/**
+		 * Encodes an image, this function is executed by the encoder threads.
+		 * @param dispatchIndex The index in which the image has been dispatched for encoding, defining the order in which the images are written
+		 * @param frame The frame to be encoded, must be valid
+		 * @param filename The filename of the image, the file extension defines the image type
+		 */
+		void encodeImage(const uint64_t dispatchIndex, const FrameRef& frame, const std::string& filename);
+
+		/**
+		 * Writes an encoded image to a file.
+		 * @param filename The name of the file to be written, must be valid
+		 * @param buffer The encoded image, must not be empty
+		 * @return True, if succeeded
+		 */
+		static bool writeEncodedImage(const std::string& filename, const std::vector<uint8_t>& buffer);
+
 	protected:
 
 		/// Recorder for single frames.
@@ -155,6 +204,12 @@ class OCEAN_MEDIA_OIL_EXPORT OILImageSequenceRecorder :
 		/// State determining whether the recorder is currently recording.
 		bool isRecording_ = false;
 
+		/// The images which have been encoded but not yet written, guarded by frameQueueLock_.
+		EncodedImageMap encodedImages_;
+
+		/// The number of images which have been dispatched for encoding but not yet written, guarded by frameQueueLock_.
+		unsigned int encodingImages_ = 0u;
+
 		/// Frame queue lock.
 		mutable Lock frameQueueLock_;
 };
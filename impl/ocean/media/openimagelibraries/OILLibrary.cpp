@@ -50,14 +50,14 @@ bool OILLibrary::unregisterLibrary()
 
 MediumRef OILLibrary::newMedium(const std::string& url, bool useExclusive)
 {
-	const ScopedLock scopedLock(lock_);
+	// the creation of a medium does not access any state of the library, so that several images can be decoded concurrently
 
 	return newImage(url, useExclusive);
 }
 
 MediumRef OILLibrary::newMedium(const std::string& url, const Medium::Type type, bool useExclusive)
 {
-	const ScopedLock scopedLock(lock_);
+	// the creation of a medium does not access any state of the library, so that several images can be decoded concurrently
 
 	if (type == Medium::BUFFER_IMAGE)
 	{
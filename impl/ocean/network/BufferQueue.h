@@ -83,7 +83,7 @@ class BufferQueue
 		Queue queue_;
 
 		/// The buffer lock.
-		mutable Lock lock_;
+		mutable Lock lock_{"Network::BufferQueue"};
 };
 
 inline void BufferQueue::push(const void* data, const size_t size)
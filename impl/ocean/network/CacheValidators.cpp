@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "ocean/network/CacheValidators.h"
+
+#include "ocean/base/String.h"
+
+namespace Ocean
+{
+
+namespace Network
+{
+
+Strings CacheValidators::requestHeaders() const
+{
+	Strings headers;
+
+	if (!entityTag_.empty())
+	{
+		headers.emplace_back("If-None-Match: " + entityTag_);
+	}
+
+	if (!lastModified_.empty())
+	{
+		headers.emplace_back("If-Modified-Since: " + lastModified_);
+	}
+
+	return headers;
+}
+
+bool CacheValidators::parseHeaderLine(const std::string& line)
+{
+	const std::string::size_type colon = line.find(':');
+
+	if (colon == std::string::npos)
+	{
+		return false;
+	}
+
+	// header field names are case-insensitive
+
+	const std::string name = String::toLower(String::trimWhitespace(line.substr(0, colon)));
+	const std::string value = String::trimWhitespace(line.substr(colon + 1));
+
+	if (name == "etag")
+	{
+		entityTag_ = value;
+		return true;
+	}
+
+	if (name == "last-modified")
+	{
+		lastModified_ = value;
+		return true;
+	}
+
+	if (name == "cache-control")
+	{
+		const std::string lowerValue = String::toLower(value);
+
+		if (lowerValue.find("no-store") != std::string::npos || lowerValue.find("no-cache") != std::string::npos)
+		{
+			// the resource must be revalidated before each use
+
+			maximalAge_ = 0.0;
+			return true;
+		}
+
+		const std::string::size_type maxAge = lowerValue.find("max-age=");
+
+		if (maxAge != std::string::npos)
+		{
+			std::string::size_type end = maxAge + 8;
+
+			while (end < lowerValue.size() && lowerValue[end] >= '0' && lowerValue[end] <= '9')
+			{
+				++end;
+			}
+
+			int32_t seconds = 0;
+			if (String::isInteger32(lowerValue.substr(maxAge + 8, end - maxAge - 8), &seconds) && seconds >= 0)
+			{
+				maximalAge_ = double(seconds);
+			}
+		}
+
+		return true;
+	}
+
+	return false;
+}
+
+}
+
+}
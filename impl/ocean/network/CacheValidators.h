@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#ifndef FACEBOOK_NETWORK_CACHE_VALIDATORS_H
+#define FACEBOOK_NETWORK_CACHE_VALIDATORS_H
+
+#include "ocean/network/Network.h"
+
+namespace Ocean
+{
+
+namespace Network
+{
+
+/**
+ * This class holds the cache validators of a HTTP(S) resource.
+ * The validators are provided by the server (ETag, Last-Modified, Cache-Control: max-age) and allow to revalidate a cached resource with a conditional request.
+ * @see ResourceCache.
+ * @ingroup network
+ */
+class OCEAN_NETWORK_EXPORT CacheValidators
+{
+	public:
+
+		/**
+		 * Creates new invalid validators.
+		 */
+		CacheValidators() = default;
+
+		/**
+		 * Creates new validators.
+		 * @param entityTag The entity tag of the resource (the value of the ETag header, including quotes), can be empty
+		 * @param lastModified The modification date of the resource (the value of the Last-Modified header), can be empty
+		 * @param maximalAge The time the resource is fresh after it has been received, in seconds, with range [0, infinity), -1 if unknown
+		 */
+		inline CacheValidators(std::string entityTag, std::string lastModified, const double maximalAge = -1.0);
+
+		/**
+		 * Returns the entity tag of the resource.
+		 * @return The entity tag, empty if unknown
+		 */
+		inline const std::string& entityTag() const;
+
+		/**
+		 * Returns the modification date of the resource.
+		 * @return The modification date as provided by the server, empty if unknown
+		 */
+		inline const std::string& lastModified() const;
+
+		/**
+		 * Returns the time the resource is fresh after it has been received.
+		 * @return The maximal age in seconds, with range [0, infinity), -1 if unknown
+		 */
+		inline double maximalAge() const;
+
+		/**
+		 * Returns the header lines of a conditional request for the resource.
+		 * @return The header lines without line endings, e.g., 'If-None-Match: "abc"', empty if the validators are invalid
+		 */
+		Strings requestHeaders() const;
+
+		/**
+		 * Parses a header line of a response and updates the validators.
+		 * @param line The header line to parse, without line ending
+		 * @return True, if the line holds a validator
+		 */
+		bool parseHeaderLine(const std::string& line);
+
+		/**
+		 * Returns whether the validators allow a conditional request.
+		 * @return True, if the entity tag or the modification date is known
+		 */
+		inline bool isValid() const;
+
+	protected:
+
+		/// The entity tag of the resource.
+		std::string entityTag_;
+
+		/// The modification date of the resource.
+		std::string lastModified_;
+
+		/// The time the resource is fresh in seconds, -1 if unknown.
+		double maximalAge_ = -1.0;
+};
+
+inline CacheValidators::CacheValidators(std::string entityTag, std::string lastModified, const double maximalAge) :
+	entityTag_(std::move(entityTag)),
+	lastModified_(std::move(lastModified)),
+	maximalAge_(maximalAge)
+{
+	// nothing to do here
+}
+
+inline const std::string& CacheValidators::entityTag() const
+{
+	return entityTag_;
+}
+
+inline const std::string& CacheValidators::lastModified() const
+{
+	return lastModified_;
+}
+
+inline double CacheValidators::maximalAge() const
+{
+	return maximalAge_;
+}
+
+inline bool CacheValidators::isValid() const
+{
+	return !entityTag_.empty() || !lastModified_.empty();
+}
+
+}
+
+}
+
+#endif // FACEBOOK_NETWORK_CACHE_VALIDATORS_H
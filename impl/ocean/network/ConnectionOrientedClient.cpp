@@ -52,6 +52,8 @@ bool ConnectionOrientedClient::connect(const Address4& address, const Port& port
 	receiverPort_ = port;
 	isConnected_ = true;
 
+	invokeSchedulerUpdate();
+
 	return true;
 }
 
@@ -62,6 +64,9 @@ bool ConnectionOrientedClient::connect(const unsigned int /*timeout*/)
 	ocean_assert(socketId_ != invalidSocketId());
 
 	isConnected_ = true;
+
+	invokeSchedulerUpdate();
+
 	return true;
 }
 
@@ -111,6 +116,8 @@ ConnectionOrientedClient::SocketResult ConnectionOrientedClient::send(const void
 
 	if (result == size)
 	{
+		statistics_.addSentMessages();
+
 		return SR_SUCCEEDED;
 	}
 
@@ -176,6 +183,9 @@ bool ConnectionOrientedClient::onScheduler()
 	{
 		ocean_assert(received <= int(socketBuffer_.size()));
 
+		receiveTicks_ = HighPerformanceTimer::ticks();
+		statistics_.addReceivedBytes(size_t(received));
+
 		onReceived(socketBuffer_.data(), size_t(received));
 		return true;
 	}
@@ -195,6 +205,16 @@ bool ConnectionOrientedClient::onScheduler()
 	return false;
 }
 
+void ConnectionOrientedClient::onSchedulerSocketIds(SocketIds& socketIds) const
+{
+	const ScopedLock scopedLock(lock_);
+
+	if (socketId_ != invalidSocketId() && isConnected_)
+	{
+		socketIds.emplace_back(socketId_);
+	}
+}
+
 size_t ConnectionOrientedClient::onSend(const void* data, const size_t size)
 {
 	ocean_assert(data != nullptr && size >= 1);
@@ -228,9 +248,14 @@ size_t ConnectionOrientedClient::onSend(const void* data, const size_t size)
 			}
 		}
 
+		// the send buffer is full, we have to try again
+		statistics_.addSendRetry();
+
 		Thread::sleep(1u);
 	}
 
+	statistics_.addSentBytes(bytesSent);
+
 	return bytesSent;
 }
 
@@ -238,8 +263,12 @@ void ConnectionOrientedClient::onReceived(const void* data, const size_t size)
 {
 	ocean_assert(data != nullptr && size >= 1);
 
+	statistics_.addReceivedMessages();
+
 	if (receiveCallback_)
 	{
+		const SocketStatistics::ScopedCallback scopedCallback(statistics_, receiveTicks_);
+
 		receiveCallback_(data, size);
 	}
 }
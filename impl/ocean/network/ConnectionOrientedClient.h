@@ -128,6 +128,12 @@ class OCEAN_NETWORK_EXPORT ConnectionOrientedClient : virtual public Client
 		 */
 		bool onScheduler() override;
 
+		/**
+		 * Returns the socket id of this client while the client is connected.
+		 * @see Socket::onSchedulerSocketIds().
+		 */
+		void onSchedulerSocketIds(SocketIds& socketIds) const override;
+
 		/**
 		 * Internal event function to send data.
 		 * @param data The data to send, must be valid
@@ -65,6 +65,8 @@ ConnectionOrientedServer::SocketResult ConnectionOrientedServer::send(const Conn
 
 	if (result == size)
 	{
+		statistics_.addSentMessages();
+
 		return SR_SUCCEEDED;
 	}
 
@@ -195,6 +197,8 @@ bool ConnectionOrientedServer::onScheduler()
 					disconnectCallback_(iConnection->first);
 				}
 
+				closesocket(iConnection->second.id());
+
 				iConnection = connectionMap_.erase(iConnection);
 				continue;
 			}
@@ -206,6 +210,9 @@ bool ConnectionOrientedServer::onScheduler()
 		{
 			ocean_assert(received <= int(buffer_.size()));
 
+			receiveTicks_ = HighPerformanceTimer::ticks();
+			statistics_.addReceivedBytes(size_t(received));
+
 			onReceived(iConnection->first, buffer_.data(), size_t(received));
 
 			busy = true;
@@ -218,6 +225,14 @@ bool ConnectionOrientedServer::onScheduler()
 				disconnectCallback_(iConnection->first);
 			}
 
+			// the socket of the connection is not used anymore and must be closed, otherwise each closed connection would leak one descriptor
+
+#ifdef _WINDOWS
+			closesocket(iConnection->second.id());
+#else
+			close(iConnection->second.id());
+#endif
+
 			iConnection = connectionMap_.erase(iConnection);
 			continue;
 		}
@@ -228,6 +243,23 @@ bool ConnectionOrientedServer::onScheduler()
 	return busy;
 }
 
+void ConnectionOrientedServer::onSchedulerSocketIds(SocketIds& socketIds) const
+{
+	const ScopedLock scopedLock(lock_);
+
+	if (!schedulerIsActive_ || socketId_ == invalidSocketId() || connectionRequestCallback_.isNull())
+	{
+		return;
+	}
+
+	socketIds.emplace_back(socketId_);
+
+	for (ConnectionMap::const_iterator iConnection = connectionMap_.cbegin(); iConnection != connectionMap_.cend(); ++iConnection)
+	{
+		socketIds.emplace_back(iConnection->second.id());
+	}
+}
+
 size_t ConnectionOrientedServer::onSend(const ConnectionId connectionId, const void* data, const size_t size)
 {
 	ConnectionMap::const_iterator iConnection = connectionMap_.find(connectionId);
@@ -264,9 +296,14 @@ size_t ConnectionOrientedServer::onSend(const ConnectionId connectionId, const v
 			}
 		}
 
+		// the send buffer is full, we have to try again
+		statistics_.addSendRetry();
+
 		Thread::sleep(1u);
 	}
 
+	statistics_.addSentBytes(bytesSent);
+
 	return bytesSent;
 }
 
@@ -274,8 +311,12 @@ void ConnectionOrientedServer::onReceived(const ConnectionId connectionId, const
 {
 	ocean_assert(data != nullptr && size >= 1);
 
+	statistics_.addReceivedMessages();
+
 	if (receiveCallback_)
 	{
+		const SocketStatistics::ScopedCallback scopedCallback(statistics_, receiveTicks_);
+
 		receiveCallback_(connectionId, data, size);
 	}
 }
@@ -193,6 +193,12 @@ class OCEAN_NETWORK_EXPORT ConnectionOrientedServer : virtual public Server
 		 */
 		bool onScheduler() override;
 
+		/**
+		 * Returns the listening socket id and the socket ids of all connections while the server is active.
+		 * @see Socket::onSchedulerSocketIds().
+		 */
+		void onSchedulerSocketIds(SocketIds& socketIds) const override;
+
 		/**
 		 * Internal event function to send data.
 		 * @param connectionId The id of the connection
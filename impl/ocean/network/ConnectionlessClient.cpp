@@ -48,12 +48,44 @@ ConnectionlessClient::SocketResult ConnectionlessClient::send(const Address4& ad
 
 	if (int(size) == sendto(socketId_, (const char*)(data), int(size), 0, (sockaddr*)&receiver, sizeof(receiver)))
 	{
+		statistics_.addSentBytes(size);
+		statistics_.addSentMessages();
+
 		return SR_SUCCEEDED;
 	}
 
 	return SR_FAILED;
 }
 
+size_t ConnectionlessClient::send(const DatagramBatch::Datagrams& datagrams)
+{
+	if (datagrams.empty())
+	{
+		return 0;
+	}
+
+	const ScopedLock scopedLock(lock_);
+
+	if (socketId_ == invalidSocketId())
+	{
+		return 0;
+	}
+
+	const size_t sentDatagrams = DatagramBatch::send(socketId_, datagrams.data(), datagrams.size());
+
+	size_t sentBytes = 0;
+
+	for (size_t n = 0; n < sentDatagrams; ++n)
+	{
+		sentBytes += datagrams[n].headerSize() + datagrams[n].size();
+	}
+
+	statistics_.addSentBytes(sentBytes);
+	statistics_.addSentMessages(sentDatagrams);
+
+	return sentDatagrams;
+}
+
 }
 
 }
@@ -11,6 +11,7 @@
 #include "ocean/network/Network.h"
 #include "ocean/network/Address4.h"
 #include "ocean/network/Client.h"
+#include "ocean/network/DatagramBatch.h"
 #include "ocean/network/Port.h"
 
 namespace Ocean
@@ -46,6 +47,16 @@ class OCEAN_NETWORK_EXPORT ConnectionlessClient : virtual public Client
 		 */
 		inline SocketResult send(const Address4& address, const Port& port, const std::string& message);
 
+		/**
+		 * Sends several datagrams, each to an individual recipient.
+		 * On Linux and Android, the datagrams are sent with as few system calls as possible, e.g., to stream one sample to many subscribers.<br>
+		 * The function stops at the first datagram which could not be sent.
+		 * @param datagrams The datagrams to send
+		 * @return The number of datagrams which have been sent, with range [0, datagrams.size()]
+		 * @see DatagramBatch::send().
+		 */
+		size_t send(const DatagramBatch::Datagrams& datagrams);
+
 	protected:
 
 		/**
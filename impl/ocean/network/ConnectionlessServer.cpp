@@ -36,22 +36,39 @@ bool ConnectionlessServer::onScheduler()
 		return false;
 	}
 
-	sockaddr_in senderAddress = {};
-#if defined(OCEAN_POSIX_AVAILABLE)
-	socklen_t senderAddressSize = sizeof(senderAddress);
-#else
-	int senderAddressSize = sizeof(senderAddress);
-#endif
+	if (!receiveBuffers_.isValid())
+	{
+		receiveBuffers_ = DatagramBatch::ReceiveBuffers(receiveBatchSize_, buffer_.size());
+	}
+
+	if (DatagramBatch::receive(socketId_, receiveBuffers_, receivedDatagrams_) == 0)
+	{
+		return false;
+	}
 
-	const int size = int(recvfrom(socketId_, (char*)(buffer_.data()), int(buffer_.size()), 0, (sockaddr*)&senderAddress, &senderAddressSize));
+	receiveTicks_ = HighPerformanceTimer::ticks();
 
-	if (size > 0)
+	for (const DatagramBatch::Datagram& datagram : receivedDatagrams_)
 	{
-		receiveCallback_(Address4(senderAddress.sin_addr.s_addr), Port(senderAddress.sin_port), buffer_.data(), size_t(size));
-		return true;
+		statistics_.addReceivedBytes(datagram.size());
+		statistics_.addReceivedMessages();
+
+		const SocketStatistics::ScopedCallback scopedCallback(statistics_, receiveTicks_);
+
+		receiveCallback_(datagram.address(), datagram.port(), datagram.data(), datagram.size());
 	}
 
-	return false;
+	return true;
+}
+
+void ConnectionlessServer::onSchedulerSocketIds(SocketIds& socketIds) const
+{
+	const ScopedLock scopedLock(lock_);
+
+	if (receiveCallback_ && schedulerIsActive_ && socketId_ != invalidSocketId())
+	{
+		socketIds.emplace_back(socketId_);
+	}
 }
 
 }
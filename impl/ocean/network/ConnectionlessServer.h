@@ -10,6 +10,7 @@
 
 #include "ocean/network/Network.h"
 #include "ocean/network/ConnectionlessClient.h"
+#include "ocean/network/DatagramBatch.h"
 #include "ocean/network/Server.h"
 
 #include "ocean/base/Callback.h"
@@ -65,10 +66,25 @@ class OCEAN_NETWORK_EXPORT ConnectionlessServer :
 		 */
 		bool onScheduler() override;
 
+		/**
+		 * Returns the socket id of this server while the server is active.
+		 * @see Socket::onSchedulerSocketIds().
+		 */
+		void onSchedulerSocketIds(SocketIds& socketIds) const override;
+
 	protected:
 
 		/// Data callback function called on new message arrivals.
 		ReceiveCallback receiveCallback_;
+
+		/// The pool of buffers receiving a batch of datagrams with one system call.
+		DatagramBatch::ReceiveBuffers receiveBuffers_;
+
+		/// The datagrams of the most recent batch, pointing into the pool.
+		DatagramBatch::Datagrams receivedDatagrams_;
+
+		/// The number of datagrams which are received with one system call.
+		static constexpr size_t receiveBatchSize_ = 8;
 };
 
 inline void ConnectionlessServer::setReceiveCallback(const ReceiveCallback& callback)
@@ -0,0 +1,267 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "ocean/network/DatagramBatch.h"
+
+#include "ocean/math/Numeric.h"
+
+#ifndef _WINDOWS
+	#include <sys/socket.h>
+	#include <sys/uio.h>
+#endif
+
+namespace Ocean
+{
+
+namespace Network
+{
+
+DatagramBatch::ReceiveBuffers::ReceiveBuffers(const size_t numberBuffers, const size_t bufferSize) :
+	memory_(numberBuffers * bufferSize),
+	numberBuffers_(numberBuffers),
+	bufferSize_(bufferSize)
+{
+	ocean_assert(numberBuffers_ >= 1 && numberBuffers_ <= maximalBatchSize_);
+	ocean_assert(bufferSize_ >= 1);
+}
+
+size_t DatagramBatch::send(const Socket::SocketId socketId, const Datagram* datagrams, const size_t size)
+{
+	ocean_assert(socketId != Socket::invalidSocketId());
+	ocean_assert(datagrams != nullptr || size == 0);
+
+	if (socketId == Socket::invalidSocketId())
+	{
+		return 0;
+	}
+
+	size_t sent = 0;
+
+#if defined(__linux__)
+
+	sockaddr_in receivers[maximalBatchSize_];
+	iovec ioVectors[maximalBatchSize_ * 2];
+	mmsghdr messages[maximalBatchSize_];
+
+	while (sent < size)
+	{
+		const size_t batchSize = min(size - sent, maximalBatchSize_);
+
+		for (size_t n = 0; n < batchSize; ++n)
+		{
+			const Datagram& datagram = datagrams[sent + n];
+			ocean_assert(datagram.data() != nullptr && datagram.size() >= 1);
+
+			receivers[n] = sockaddr_in();
+			receivers[n].sin_family = AF_INET;
+			receivers[n].sin_addr.s_addr = datagram.address();
+			receivers[n].sin_port = datagram.port();
+
+			iovec* const datagramIoVectors = ioVectors + n * 2;
+			size_t numberIoVectors = 0;
+
+			if (datagram.headerSize() != 0)
+			{
+				datagramIoVectors[numberIoVectors].iov_base = const_cast<void*>(datagram.header());
+				datagramIoVectors[numberIoVectors].iov_len = datagram.headerSize();
+				++numberIoVectors;
+			}
+
+			datagramIoVectors[numberIoVectors].iov_base = const_cast<void*>(datagram.data());
+			datagramIoVectors[numberIoVectors].iov_len = datagram.size();
+			++numberIoVectors;
+
+			messages[n] = mmsghdr();
+			messages[n].msg_hdr.msg_name = &receivers[n];
+			messages[n].msg_hdr.msg_namelen = sizeof(sockaddr_in);
+			messages[n].msg_hdr.msg_iov = datagramIoVectors;
+			messages[n].msg_hdr.msg_iovlen = numberIoVectors;
+		}
+
+		const int result = sendmmsg(socketId, messages, (unsigned int)(batchSize), 0);
+
+		if (result <= 0)
+		{
+			break;
+		}
+
+		ocean_assert(size_t(result) <= batchSize);
+
+		for (int n = 0; n < result; ++n)
+		{
+			const Datagram& datagram = datagrams[sent + size_t(n)];
+
+			if (messages[n].msg_len != (unsigned int)(datagram.headerSize() + datagram.size()))
+			{
+				// a datagram is sent entirely or not at all, we never should get here
+
+				ocean_assert(false && "Invalid datagram size!");
+				return sent + size_t(n);
+			}
+		}
+
+		sent += size_t(result);
+
+		if (size_t(result) != batchSize)
+		{
+			// the remaining datagrams failed, e.g., because the socket's send buffer is full
+			break;
+		}
+	}
+
+#else
+
+	while (sent < size)
+	{
+		const Datagram& datagram = datagrams[sent];
+		ocean_assert(datagram.data() != nullptr && datagram.size() >= 1);
+		ocean_assert(datagram.headerSize() + datagram.size() < size_t(NumericT<int>::maxValue()));
+
+		sockaddr_in receiver = {};
+		receiver.sin_family = AF_INET;
+		receiver.sin_addr.s_addr = datagram.address();
+		receiver.sin_port = datagram.port();
+
+		if (datagram.headerSize() == 0)
+		{
+			if (int(datagram.size()) != int(sendto(socketId, (const char*)(datagram.data()), int(datagram.size()), 0, (sockaddr*)&receiver, sizeof(receiver))))
+			{
+				break;
+			}
+		}
+		else
+		{
+
+	#ifdef _WINDOWS
+
+			WSABUF buffers[2];
+			buffers[0].buf = (CHAR*)(datagram.header());
+			buffers[0].len = ULONG(datagram.headerSize());
+			buffers[1].buf = (CHAR*)(datagram.data());
+			buffers[1].len = ULONG(datagram.size());
+
+			DWORD bytesSent = 0;
+
+			if (WSASendTo(socketId, buffers, 2, &bytesSent, 0, (sockaddr*)&receiver, sizeof(receiver), nullptr, nullptr) != 0 || size_t(bytesSent) != datagram.headerSize() + datagram.size())
+			{
+				break;
+			}
+
+	#else
+
+			iovec ioVectors[2];
+			ioVectors[0].iov_base = const_cast<void*>(datagram.header());
+			ioVectors[0].iov_len = datagram.headerSize();
+			ioVectors[1].iov_base = const_cast<void*>(datagram.data());
+			ioVectors[1].iov_len = datagram.size();
+
+			msghdr message = {};
+			message.msg_name = &receiver;
+			message.msg_namelen = sizeof(receiver);
+			message.msg_iov = ioVectors;
+			message.msg_iovlen = 2;
+
+			if (size_t(sendmsg(socketId, &message, 0)) != datagram.headerSize() + datagram.size())
+			{
+				break;
+			}
+
+	#endif // _WINDOWS
+
+		}
+
+		++sent;
+	}
+
+#endif // __linux__
+
+	return sent;
+}
+
+size_t DatagramBatch::receive(const Socket::SocketId socketId, ReceiveBuffers& receiveBuffers, Datagrams& datagrams)
+{
+	ocean_assert(socketId != Socket::invalidSocketId());
+	ocean_assert(receiveBuffers.isValid());
+
+	datagrams.clear();
+
+	if (socketId == Socket::invalidSocketId() || !receiveBuffers.isValid())
+	{
+		return 0;
+	}
+
+	const size_t batchSize = min(receiveBuffers.numberBuffers(), maximalBatchSize_);
+
+#if defined(__linux__)
+
+	sockaddr_in senders[maximalBatchSize_];
+	iovec ioVectors[maximalBatchSize_];
+	mmsghdr messages[maximalBatchSize_];
+
+	for (size_t n = 0; n < batchSize; ++n)
+	{
+		senders[n] = sockaddr_in();
+
+		ioVectors[n].iov_base = receiveBuffers.buffer(n);
+		ioVectors[n].iov_len = receiveBuffers.bufferSize();
+
+		messages[n] = mmsghdr();
+		messages[n].msg_hdr.msg_name = &senders[n];
+		messages[n].msg_hdr.msg_namelen = sizeof(sockaddr_in);
+		messages[n].msg_hdr.msg_iov = &ioVectors[n];
+		messages[n].msg_hdr.msg_iovlen = 1;
+	}
+
+	const int result = recvmmsg(socketId, messages, (unsigned int)(batchSize), MSG_DONTWAIT, nullptr);
+
+	if (result <= 0)
+	{
+		return 0;
+	}
+
+	ocean_assert(size_t(result) <= batchSize);
+
+	for (int n = 0; n < result; ++n)
+	{
+		if (messages[n].msg_len != 0u)
+		{
+			datagrams.emplace_back(Address4(senders[n].sin_addr.s_addr), Port(senders[n].sin_port), receiveBuffers.buffer(size_t(n)), size_t(messages[n].msg_len));
+		}
+	}
+
+#else
+
+	for (size_t n = 0; n < batchSize; ++n)
+	{
+		sockaddr_in sender = {};
+
+	#if defined(OCEAN_POSIX_AVAILABLE)
+		socklen_t senderSize = sizeof(sender);
+	#else
+		int senderSize = sizeof(sender);
+	#endif
+
+		uint8_t* const buffer = receiveBuffers.buffer(n);
+
+		const int size = int(recvfrom(socketId, (char*)(buffer), int(receiveBuffers.bufferSize()), 0, (sockaddr*)&sender, &senderSize));
+
+		if (size <= 0)
+		{
+			break;
+		}
+
+		datagrams.emplace_back(Address4(sender.sin_addr.s_addr), Port(sender.sin_port), buffer, size_t(size));
+	}
+
+#endif // __linux__
+
+	return datagrams.size();
+}
+
+}
+
+}
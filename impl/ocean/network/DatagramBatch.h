@@ -0,0 +1,303 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#ifndef FACEBOOK_NETWORK_DATAGRAM_BATCH_H
+#define FACEBOOK_NETWORK_DATAGRAM_BATCH_H
+
+#include "ocean/network/Network.h"
+#include "ocean/network/Address4.h"
+#include "ocean/network/Port.h"
+#include "ocean/network/Socket.h"
+
+namespace Ocean
+{
+
+namespace Network
+{
+
+/**
+ * This class implements functions sending and receiving several datagrams with as few system calls as possible.
+ * On Linux and Android, the functions use sendmmsg() and recvmmsg() so that an entire batch is handled with one system call.<br>
+ * On all other platforms, the functions fall back to individual sendto() and recvfrom() calls.
+ * @ingroup network
+ */
+class OCEAN_NETWORK_EXPORT DatagramBatch
+{
+	public:
+
+		/**
+		 * This class holds the address, port and payload of one datagram.
+		 * An outgoing datagram can be composed of a header and a payload which are sent with scatter-gather I/O, so that the payload does not need to be copied behind the header.<br>
+		 * The object does not own the header or the payload.
+		 */
+		class Datagram
+		{
+			public:
+
+				/**
+				 * Creates an invalid datagram.
+				 */
+				Datagram() = default;
+
+				/**
+				 * Creates a new datagram.
+				 * @param address The address of the recipient or sender
+				 * @param port The port of the recipient or sender
+				 * @param data The payload of the datagram, must be valid
+				 * @param size The size of the payload in bytes, with range [1, infinity)
+				 */
+				inline Datagram(const Address4& address, const Port& port, const void* data, const size_t size);
+
+				/**
+				 * Creates a new outgoing datagram composed of a header and a payload.
+				 * @param address The address of the recipient
+				 * @param port The port of the recipient
+				 * @param header The header of the datagram, which will be sent in front of the payload, must be valid
+				 * @param headerSize The size of the header in bytes, with range [1, infinity)
+				 * @param data The payload of the datagram, must be valid
+				 * @param size The size of the payload in bytes, with range [1, infinity)
+				 */
+				inline Datagram(const Address4& address, const Port& port, const void* header, const size_t headerSize, const void* data, const size_t size);
+
+				/**
+				 * Returns the address of the recipient or sender.
+				 * @return The datagram's address
+				 */
+				inline const Address4& address() const;
+
+				/**
+				 * Returns the port of the recipient or sender.
+				 * @return The datagram's port
+				 */
+				inline const Port& port() const;
+
+				/**
+				 * Returns the payload of this datagram.
+				 * @return The datagram's payload
+				 */
+				inline const void* data() const;
+
+				/**
+				 * Returns the size of the payload.
+				 * @return The payload's size in bytes
+				 */
+				inline size_t size() const;
+
+				/**
+				 * Returns the header of this datagram.
+				 * @return The datagram's header, nullptr if the datagram does not have a header
+				 */
+				inline const void* header() const;
+
+				/**
+				 * Returns the size of the header.
+				 * @return The header's size in bytes, 0 if the datagram does not have a header
+				 */
+				inline size_t headerSize() const;
+
+			protected:
+
+				/// The address of the recipient or sender.
+				Address4 address_;
+
+				/// The port of the recipient or sender.
+				Port port_;
+
+				/// The payload of the datagram, not owned.
+				const void* data_ = nullptr;
+
+				/// The size of the payload in bytes.
+				size_t size_ = 0;
+
+				/// The optional header of the datagram, not owned.
+				const void* header_ = nullptr;
+
+				/// The size of the header in bytes.
+				size_t headerSize_ = 0;
+		};
+
+		/**
+		 * Definition of a vector holding datagrams.
+		 */
+		using Datagrams = std::vector<Datagram>;
+
+		/**
+		 * This class implements a pool of equally sized buffers receiving one batch of datagrams.
+		 * The pool is allocated once and re-used for all batches.
+		 */
+		class OCEAN_NETWORK_EXPORT ReceiveBuffers
+		{
+			public:
+
+				/**
+				 * Creates an empty pool.
+				 */
+				ReceiveBuffers() = default;
+
+				/**
+				 * Creates a new pool.
+				 * @param numberBuffers The number of buffers, which is the maximal number of datagrams received with one call, with range [1, maximalBatchSize_]
+				 * @param bufferSize The size of each buffer in bytes, larger datagrams will be truncated, with range [1, infinity)
+				 */
+				ReceiveBuffers(const size_t numberBuffers, const size_t bufferSize);
+
+				/**
+				 * Returns the number of buffers of this pool.
+				 * @return The pool's number of buffers
+				 */
+				inline size_t numberBuffers() const;
+
+				/**
+				 * Returns the size of each buffer.
+				 * @return The size of each buffer in bytes
+				 */
+				inline size_t bufferSize() const;
+
+				/**
+				 * Returns one buffer of this pool.
+				 * @param index The index of the buffer, with range [0, numberBuffers() - 1]
+				 * @return The requested buffer
+				 */
+				inline uint8_t* buffer(const size_t index);
+
+				/**
+				 * Returns whether this pool holds at least one buffer.
+				 * @return True, if so
+				 */
+				inline bool isValid() const;
+
+			protected:
+
+				/// The memory of all buffers.
+				Socket::Buffer memory_;
+
+				/// The number of buffers.
+				size_t numberBuffers_ = 0;
+
+				/// The size of each buffer in bytes.
+				size_t bufferSize_ = 0;
+		};
+
+		/// The maximal number of datagrams which are sent or received with one system call.
+		static constexpr size_t maximalBatchSize_ = 64;
+
+	public:
+
+		/**
+		 * Sends several datagrams via a connectionless socket.
+		 * Datagrams with header are sent with scatter-gather I/O, header and payload are not copied.<br>
+		 * The function stops at the first datagram which could not be sent, the error state of the socket (errno) is the state of the failing call.
+		 * @param socketId The id of the socket to be used, must be valid
+		 * @param datagrams The datagrams to send, must be valid if 'size >= 1'
+		 * @param size The number of datagrams, with range [0, infinity)
+		 * @return The number of datagrams which have been sent, with range [0, size]
+		 */
+		static size_t send(const Socket::SocketId socketId, const Datagram* datagrams, const size_t size);
+
+		/**
+		 * Receives all pending datagrams of a non-blocking connectionless socket, up to the number of buffers of the pool.
+		 * @param socketId The id of the socket to be used, must be valid
+		 * @param receiveBuffers The pool receiving the payloads, must be valid
+		 * @param datagrams The resulting datagrams, the payloads point into the pool and are valid until the pool is used again
+		 * @return The number of received datagrams, with range [0, receiveBuffers.numberBuffers()]
+		 */
+		static size_t receive(const Socket::SocketId socketId, ReceiveBuffers& receiveBuffers, Datagrams& datagrams);
+
+		/**
+		 * Returns whether this platform sends and receives an entire batch with one system call.
+		 * @return True, if so
+		 */
+		static constexpr bool nativeBatching();
+};
+
+inline DatagramBatch::Datagram::Datagram(const Address4& address, const Port& port, const void* data, const size_t size) :
+	address_(address),
+	port_(port),
+	data_(data),
+	size_(size)
+{
+	ocean_assert(data_ != nullptr && size_ >= 1);
+}
+
+inline DatagramBatch::Datagram::Datagram(const Address4& address, const Port& port, const void* header, const size_t headerSize, const void* data, const size_t size) :
+	address_(address),
+	port_(port),
+	data_(data),
+	size_(size),
+	header_(header),
+	headerSize_(headerSize)
+{
+	ocean_assert(header_ != nullptr && headerSize_ >= 1);
+	ocean_assert(data_ != nullptr && size_ >= 1);
+}
+
+inline const Address4& DatagramBatch::Datagram::address() const
+{
+	return address_;
+}
+
+inline const Port& DatagramBatch::Datagram::port() const
+{
+	return port_;
+}
+
+inline const void* DatagramBatch::Datagram::data() const
+{
+	return data_;
+}
+
+inline size_t DatagramBatch::Datagram::size() const
+{
+	return size_;
+}
+
+inline const void* DatagramBatch::Datagram::header() const
+{
+	return header_;
+}
+
+inline size_t DatagramBatch::Datagram::headerSize() const
+{
+	return headerSize_;
+}
+
+inline size_t DatagramBatch::ReceiveBuffers::numberBuffers() const
+{
+	return numberBuffers_;
+}
+
+inline size_t DatagramBatch::ReceiveBuffers::bufferSize() const
+{
+	return bufferSize_;
+}
+
+inline uint8_t* DatagramBatch::ReceiveBuffers::buffer(const size_t index)
+{
+	ocean_assert(index < numberBuffers_);
+
+	return memory_.data() + index * bufferSize_;
+}
+
+inline bool DatagramBatch::ReceiveBuffers::isValid() const
+{
+	return numberBuffers_ != 0;
+}
+
+constexpr bool DatagramBatch::nativeBatching()
+{
+#if defined(__linux__)
+	return true;
+#else
+	return false;
+#endif
+}
+
+}
+
+}
+
+#endif // FACEBOOK_NETWORK_DATAGRAM_BATCH_H
@@ -0,0 +1,349 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "ocean/network/FrameCodec.h"
+#include "ocean/network/Data.h"
+
+#include "ocean/io/Compression.h"
+
+namespace Ocean
+{
+
+namespace Network
+{
+
+FrameCodec::Encoder::Encoder(const unsigned int tileSize, const unsigned int keyFrameInterval) :
+	tileSize_(tileSize),
+	keyFrameInterval_(keyFrameInterval)
+{
+	ocean_assert(tileSize_ >= 8u && tileSize_ <= 256u);
+	ocean_assert(keyFrameInterval_ >= 1u);
+}
+
+bool FrameCodec::Encoder::encode(const Frame& frame, Buffer& packet)
+{
+	ocean_assert(frame.isValid());
+
+	if (!frame.isValid() || !isSupported(frame.frameType()))
+	{
+		return false;
+	}
+
+	const bool keyFrame = keyFrameRequested_ || framesSinceKeyFrame_ + 1u >= keyFrameInterval_ || referenceFrame_.frameType() != frame.frameType();
+
+	const unsigned int width = frame.width();
+	const unsigned int height = frame.height();
+	const unsigned int pixelBytes = bytesPerPixel(frame.frameType());
+
+	const unsigned int horizontalTiles = (width + tileSize_ - 1u) / tileSize_;
+	const unsigned int verticalTiles = (height + tileSize_ - 1u) / tileSize_;
+
+	const size_t maskSize = (size_t(horizontalTiles) * size_t(verticalTiles) + 7) / 8;
+
+	payloadBuffer_.clear();
+	payloadBuffer_.resize(maskSize, 0u);
+
+	if (keyFrame)
+	{
+		// the reference is a continuous copy of the frame, receivers start with the same reference
+
+		referenceFrame_ = Frame(frame, Frame::ACM_COPY_REMOVE_PADDING_LAYOUT);
+
+		payloadBuffer_.reserve(maskSize + size_t(frame.planeWidthBytes(0u)) * size_t(height));
+	}
+
+	for (unsigned int yTile = 0u; yTile < verticalTiles; ++yTile)
+	{
+		const unsigned int yStart = yTile * tileSize_;
+		const unsigned int tileHeight = std::min(tileSize_, height - yStart);
+
+		for (unsigned int xTile = 0u; xTile < horizontalTiles; ++xTile)
+		{
+			const unsigned int xStart = xTile * tileSize_;
+			const size_t tileRowBytes = size_t(std::min(tileSize_, width - xStart)) * size_t(pixelBytes);
+			const size_t xStartBytes = size_t(xStart) * size_t(pixelBytes);
+
+			bool tileChanged = keyFrame;
+
+			if (!keyFrame)
+			{
+				for (unsigned int y = yStart; !tileChanged && y < yStart + tileHeight; ++y)
+				{
+					tileChanged = memcmp(frame.constrow<uint8_t>(y) + xStartBytes, referenceFrame_.constrow<uint8_t>(y) + xStartBytes, tileRowBytes) != 0;
+				}
+			}
+
+			if (!tileChanged)
+			{
+				continue;
+			}
+
+			const size_t tileIndex = size_t(yTile) * size_t(horizontalTiles) + size_t(xTile);
+			payloadBuffer_[tileIndex / 8] |= uint8_t(1u << (tileIndex % 8));
+
+			const size_t tileOffset = payloadBuffer_.size();
+			payloadBuffer_.resize(tileOffset + tileRowBytes * size_t(tileHeight));
+
+			uint8_t* tileData = payloadBuffer_.data() + tileOffset;
+
+			for (unsigned int y = yStart; y < yStart + tileHeight; ++y)
+			{
+				const uint8_t* const frameRow = frame.constrow<uint8_t>(y) + xStartBytes;
+
+				if (keyFrame)
+				{
+					memcpy(tileData, frameRow, tileRowBytes);
+				}
+				else
+				{
+					// the difference to the reference is mostly zero for tiles with small changes, which compresses well
+
+					uint8_t* const referenceRow = referenceFrame_.row<uint8_t>(y) + xStartBytes;
+
+					for (size_t n = 0; n < tileRowBytes; ++n)
+					{
+						tileData[n] = frameRow[n] ^ referenceRow[n];
+					}
+
+					memcpy(referenceRow, frameRow, tileRowBytes);
+				}
+
+				tileData += tileRowBytes;
+			}
+		}
+	}
+
+	if (payloadBuffer_.size() > size_t(0xFFFFFFF0u))
+	{
+		return false;
+	}
+
+	IO::Compression::Buffer compressedPayload;
+	if (!IO::Compression::zlibCompress(payloadBuffer_.data(), payloadBuffer_.size(), compressedPayload, nullptr, 0, IO::Compression::CL_FASTEST))
+	{
+		return false;
+	}
+
+	const uint64_t pixelFormat = uint64_t(frame.pixelFormat());
+
+	const uint32_t headerValues[headerValues_] =
+	{
+		Data::toBigEndian(packetMagic_),
+		Data::toBigEndian(sequence_),
+		Data::toBigEndian(uint32_t(keyFrame ? PF_KEY_FRAME : 0u)),
+		Data::toBigEndian(uint32_t(width)),
+		Data::toBigEndian(uint32_t(height)),
+		Data::toBigEndian(uint32_t(pixelFormat & 0xFFFFFFFFull)),
+		Data::toBigEndian(uint32_t(pixelFormat >> 32ull)),
+		Data::toBigEndian(uint32_t(frame.pixelOrigin())),
+		Data::toBigEndian(uint32_t(tileSize_)),
+		Data::toBigEndian(uint32_t(payloadBuffer_.size()))
+	};
+
+	packet.resize(sizeof(headerValues) + compressedPayload.size());
+	memcpy(packet.data(), headerValues, sizeof(headerValues));
+	memcpy(packet.data() + sizeof(headerValues), compressedPayload.data(), compressedPayload.size());
+
+	++sequence_;
+
+	if (keyFrame)
+	{
+		keyFrameRequested_ = false;
+		framesSinceKeyFrame_ = 0u;
+	}
+	else
+	{
+		++framesSinceKeyFrame_;
+	}
+
+	return true;
+}
+
+bool FrameCodec::Decoder::decode(const void* packet, const size_t size)
+{
+	ocean_assert(packet != nullptr && size != 0);
+
+	uint32_t headerValues[headerValues_];
+
+	if (packet == nullptr || size <= sizeof(headerValues))
+	{
+		return false;
+	}
+
+	memcpy(headerValues, packet, sizeof(headerValues));
+
+	for (uint32_t& headerValue : headerValues)
+	{
+		headerValue = Data::fromBigEndian(headerValue);
+	}
+
+	if (headerValues[0] != packetMagic_)
+	{
+		return false;
+	}
+
+	const uint32_t sequence = headerValues[1];
+	const bool keyFrame = (headerValues[2] & PF_KEY_FRAME) == PF_KEY_FRAME;
+	const unsigned int width = headerValues[3];
+	const unsigned int height = headerValues[4];
+	const FrameType::PixelFormat pixelFormat = FrameType::PixelFormat(uint64_t(headerValues[5]) | (uint64_t(headerValues[6]) << 32ull));
+	const FrameType::PixelOrigin pixelOrigin = FrameType::PixelOrigin(headerValues[7]);
+	const unsigned int tileSize = headerValues[8];
+	const size_t payloadSize = size_t(headerValues[9]);
+
+	constexpr unsigned int maximalDimension = 16384u;
+
+	if (width == 0u || height == 0u || width > maximalDimension || height > maximalDimension || tileSize < 8u || tileSize > 256u)
+	{
+		return false;
+	}
+
+	if (pixelOrigin != FrameType::ORIGIN_UPPER_LEFT && pixelOrigin != FrameType::ORIGIN_LOWER_LEFT)
+	{
+		return false;
+	}
+
+	if (!FrameType::formatIsGeneric(pixelFormat) || FrameType::numberPlanes(pixelFormat) != 1u)
+	{
+		return false;
+	}
+
+	const FrameType frameType(width, height, pixelFormat, pixelOrigin);
+
+	if (!isSupported(frameType))
+	{
+		return false;
+	}
+
+	if (!keyFrame && (!hasReference_ || sequence != sequence_ + 1u || frame_.frameType() != frameType))
+	{
+		// a previous packet has been lost, we have to wait for the next key frame
+
+		hasReference_ = false;
+		return false;
+	}
+
+	payloadBuffer_.clear();
+
+	if (!IO::Compression::zlibDecompress((const uint8_t*)(packet) + sizeof(headerValues), size - sizeof(headerValues), payloadBuffer_) || payloadBuffer_.size() != payloadSize)
+	{
+		hasReference_ = false;
+		return false;
+	}
+
+	const unsigned int pixelBytes = bytesPerPixel(frameType);
+
+	const unsigned int horizontalTiles = (width + tileSize - 1u) / tileSize;
+	const unsigned int verticalTiles = (height + tileSize - 1u) / tileSize;
+
+	const size_t maskSize = (size_t(horizontalTiles) * size_t(verticalTiles) + 7) / 8;
+
+	if (payloadSize < maskSize)
+	{
+		hasReference_ = false;
+		return false;
+	}
+
+	if (keyFrame && !frame_.set(frameType, true /*forceOwner*/, true /*forceWritable*/))
+	{
+		hasReference_ = false;
+		return false;
+	}
+
+	const uint8_t* const mask = payloadBuffer_.data();
+	const uint8_t* tileData = payloadBuffer_.data() + maskSize;
+	const uint8_t* const payloadEnd = payloadBuffer_.data() + payloadBuffer_.size();
+
+	for (unsigned int yTile = 0u; yTile < verticalTiles; ++yTile)
+	{
+		const unsigned int yStart = yTile * tileSize;
+		const unsigned int tileHeight = std::min(tileSize, height - yStart);
+
+		for (unsigned int xTile = 0u; xTile < horizontalTiles; ++xTile)
+		{
+			const size_t tileIndex = size_t(yTile) * size_t(horizontalTiles) + size_t(xTile);
+
+			const bool tileChanged = (mask[tileIndex / 8] & uint8_t(1u << (tileIndex % 8))) != 0u;
+
+			if (!tileChanged)
+			{
+				if (keyFrame)
+				{
+					// key frames contain all tiles
+					hasReference_ = false;
+					return false;
+				}
+
+				continue;
+			}
+
+			const unsigned int xStart = xTile * tileSize;
+			const size_t tileRowBytes = size_t(std::min(tileSize, width - xStart)) * size_t(pixelBytes);
+			const size_t xStartBytes = size_t(xStart) * size_t(pixelBytes);
+
+			if (size_t(payloadEnd - tileData) < tileRowBytes * size_t(tileHeight))
+			{
+				hasReference_ = false;
+				return false;
+			}
+
+			for (unsigned int y = yStart; y < yStart + tileHeight; ++y)
+			{
+				uint8_t* const frameRow = frame_.row<uint8_t>(y) + xStartBytes;
+
+				if (keyFrame)
+				{
+					memcpy(frameRow, tileData, tileRowBytes);
+				}
+				else
+				{
+					for (size_t n = 0; n < tileRowBytes; ++n)
+					{
+						frameRow[n] ^= tileData[n];
+					}
+				}
+
+				tileData += tileRowBytes;
+			}
+		}
+	}
+
+	if (tileData != payloadEnd)
+	{
+		hasReference_ = false;
+		return false;
+	}
+
+	sequence_ = sequence;
+	hasReference_ = true;
+
+	return true;
+}
+
+void FrameCodec::Decoder::reset()
+{
+	frame_.release();
+
+	sequence_ = 0u;
+	hasReference_ = false;
+}
+
+bool FrameCodec::isSupported(const FrameType& frameType)
+{
+	return frameType.isValid() && frameType.numberPlanes() == 1u && FrameType::formatIsGeneric(frameType.pixelFormat());
+}
+
+unsigned int FrameCodec::bytesPerPixel(const FrameType& frameType)
+{
+	ocean_assert(isSupported(frameType));
+
+	return frameType.channels() * frameType.bytesPerDataType();
+}
+
+}
+
+}
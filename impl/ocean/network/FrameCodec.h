@@ -0,0 +1,198 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#ifndef FACEBOOK_NETWORK_FRAME_CODEC_H
+#define FACEBOOK_NETWORK_FRAME_CODEC_H
+
+#include "ocean/network/Network.h"
+
+#include "ocean/base/Frame.h"
+
+namespace Ocean
+{
+
+namespace Network
+{
+
+/**
+ * This class implements a lossless codec for streaming frames, e.g., debug visualizations or camera frames.
+ * The frame is separated into tiles, only tiles which have changed since the previous frame are transmitted as difference to the previous frame.<br>
+ * The resulting packet is compressed with a fast compression, static content (as common for debug visualizations) costs almost no bandwidth.<br>
+ * Key frames (containing all tiles) are sent regularly so that receivers can join a stream or recover from a lost packet.<br>
+ * The codec supports frames with generic pixel formats with one plane, e.g., FORMAT_Y8, FORMAT_RGB24, or FORMAT_RGBA32.
+ * @ingroup network
+ */
+class OCEAN_NETWORK_EXPORT FrameCodec
+{
+	public:
+
+		/**
+		 * Definition of a vector holding bytes.
+		 */
+		using Buffer = std::vector<uint8_t>;
+
+		/**
+		 * This class implements the encoder of the codec.
+		 */
+		class OCEAN_NETWORK_EXPORT Encoder
+		{
+			public:
+
+				/**
+				 * Creates a new encoder.
+				 * @param tileSize The size of the tiles in pixels, with range [8, 256]
+				 * @param keyFrameInterval The number of frames after which a key frame is created, with range [1, infinity)
+				 */
+				explicit Encoder(const unsigned int tileSize = 32u, const unsigned int keyFrameInterval = 30u);
+
+				/**
+				 * Encodes a frame.
+				 * @param frame The frame to encode, must be valid, must be supported
+				 * @param packet The resulting packet
+				 * @return True, if succeeded
+				 * @see FrameCodec::isSupported().
+				 */
+				bool encode(const Frame& frame, Buffer& packet);
+
+				/**
+				 * Requests that the next encoded frame is a key frame, e.g., because a new receiver has joined the stream.
+				 */
+				inline void requestKeyFrame();
+
+			protected:
+
+				/// The size of the tiles in pixels.
+				unsigned int tileSize_ = 32u;
+
+				/// The number of frames after which a key frame is created.
+				unsigned int keyFrameInterval_ = 30u;
+
+				/// The number of frames which have been encoded since the last key frame.
+				unsigned int framesSinceKeyFrame_ = 0u;
+
+				/// True, if the next frame must be a key frame.
+				bool keyFrameRequested_ = true;
+
+				/// The sequence number of the next packet.
+				uint32_t sequence_ = 0u;
+
+				/// The frame which the receivers know, as reference for the next frame.
+				Frame referenceFrame_;
+
+				/// The buffer holding the uncompressed payload.
+				Buffer payloadBuffer_;
+		};
+
+		/**
+		 * This class implements the decoder of the codec.
+		 */
+		class OCEAN_NETWORK_EXPORT Decoder
+		{
+			public:
+
+				/**
+				 * Creates a new decoder.
+				 */
+				Decoder() = default;
+
+				/**
+				 * Decodes a packet.
+				 * A packet based on the previous frame can only be decoded if all previous packets since the last key frame have been decoded.
+				 * @param packet The packet to decode, must be valid
+				 * @param size The size of the packet in bytes, with range [1, infinity)
+				 * @return True, if succeeded; False, if the packet is invalid or if the decoder waits for the next key frame
+				 */
+				bool decode(const void* packet, const size_t size);
+
+				/**
+				 * Returns the most recent decoded frame.
+				 * @return The decoded frame, invalid if no frame has been decoded
+				 */
+				inline const Frame& frame() const;
+
+				/**
+				 * Resets the decoder, the next decoded packet must be a key frame.
+				 */
+				void reset();
+
+			protected:
+
+				/// The most recent decoded frame.
+				Frame frame_;
+
+				/// The sequence number of the most recent decoded packet.
+				uint32_t sequence_ = 0u;
+
+				/// True, if the decoder holds a frame which can be used for the next packet.
+				bool hasReference_ = false;
+
+				/// The buffer holding the uncompressed payload.
+				Buffer payloadBuffer_;
+		};
+
+	protected:
+
+		/**
+		 * Definition of individual packet flags.
+		 */
+		enum PacketFlags : uint32_t
+		{
+			/// The packet holds a key frame.
+			PF_KEY_FRAME = 1u << 0u
+		};
+
+		/// The identifier of each packet, "OFDC".
+		static constexpr uint32_t packetMagic_ = 0x4F464443u;
+
+		/// The number of 32 bit values in the header of each packet.
+		static constexpr size_t headerValues_ = 10;
+
+	public:
+
+		/**
+		 * Returns the data type of streaming channels providing packets of this codec.
+		 * @return The channel data type
+		 */
+		static inline const char* dataType();
+
+		/**
+		 * Returns whether a frame type is supported by this codec.
+		 * @param frameType The frame type to check
+		 * @return True, if so
+		 */
+		static bool isSupported(const FrameType& frameType);
+
+	protected:
+
+		/**
+		 * Returns the number of bytes of one pixel of a supported frame type.
+		 * @param frameType The frame type, must be supported
+		 * @return The number of bytes, with range [1, infinity)
+		 */
+		static unsigned int bytesPerPixel(const FrameType& frameType);
+};
+
+inline void FrameCodec::Encoder::requestKeyFrame()
+{
+	keyFrameRequested_ = true;
+}
+
+inline const Frame& FrameCodec::Decoder::frame() const
+{
+	return frame_;
+}
+
+inline const char* FrameCodec::dataType()
+{
+	return "ocean/frame-delta";
+}
+
+}
+
+}
+
+#endif // FACEBOOK_NETWORK_FRAME_CODEC_H
@@ -7,6 +7,7 @@
 
 #include "ocean/network/HTTPClient.h"
 #include "ocean/network/Resolver.h"
+#include "ocean/network/SocketScheduler.h"
 
 #include "ocean/base/String.h"
 #include "ocean/base/Thread.h"
@@ -116,9 +117,152 @@ bool HTTPClient::HTTPHeader::parseHeaderLine(const std::string& line, HTTPHeader
 		return true;
 	}
 
+	// header field names are case-insensitive, e.g., 'connection: keep-alive'
+	const std::string lowerLine = String::toLower(line);
+
+	// Connection: close
+	if (lowerLine.find("connection:") == 0)
+	{
+		header.setConnectionClose(lowerLine.find("close", 11) != std::string::npos);
+	}
+	// Accept-Ranges: bytes
+	else if (lowerLine.find("accept-ranges:") == 0)
+	{
+		header.setAcceptRanges(lowerLine.find("bytes", 14) != std::string::npos);
+	}
+	else
+	{
+		header.validators_.parseHeaderLine(line);
+	}
+
 	return true;
 }
 
+HTTPClient::ConnectionPool::ConnectionPool()
+{
+	// the pool holds sockets, so the scheduler must exist before the pool so that the scheduler is released after the pool
+	SocketScheduler::get();
+
+	threadPool_.setCapacity(8);
+}
+
+HTTPClient::ConnectionPool::~ConnectionPool()
+{
+	// we wait until all asynchronous requests are handled
+
+	while (!threadPool_.isEmpty())
+	{
+		Thread::sleep(1u);
+	}
+
+	clear();
+}
+
+HTTPClient::UniqueHTTPClient HTTPClient::ConnectionPool::acquire(const std::string& host, const Port& port, bool* reused)
+{
+	ocean_assert(!host.empty() && port.isValid());
+
+	if (reused != nullptr)
+	{
+		*reused = false;
+	}
+
+	{
+		const ScopedLock scopedLock(lock_);
+
+		const IdleClientMap::iterator iClients = idleClientMap_.find(key(host, port));
+
+		if (iClients != idleClientMap_.cend())
+		{
+			IdleClients& idleClients = iClients->second;
+
+			while (!idleClients.empty())
+			{
+				IdleClient idleClient = std::move(idleClients.back());
+				idleClients.pop_back();
+
+				ocean_assert(idleClient.second);
+
+				// the most recently used connection is used first, connections which have been idle for too long are likely closed by the server
+
+				if (!idleClient.first.hasTimePassed(idleTimeout_) && idleClient.second->isReusable())
+				{
+					if (reused != nullptr)
+					{
+						*reused = true;
+					}
+
+					return std::move(idleClient.second);
+				}
+			}
+		}
+	}
+
+	UniqueHTTPClient client = std::make_unique<HTTPClient>(host, port);
+
+	if (!client->connect())
+	{
+		return nullptr;
+	}
+
+	return client;
+}
+
+void HTTPClient::ConnectionPool::release(UniqueHTTPClient&& client)
+{
+	if (!client || !client->isReusable())
+	{
+		return;
+	}
+
+	const ScopedLock scopedLock(lock_);
+
+	IdleClients& idleClients = idleClientMap_[key(client->host_, client->port_)];
+
+	// we remove the connections which have been idle for too long
+
+	for (size_t n = 0; n < idleClients.size(); /* noop */)
+	{
+		if (idleClients[n].first.hasTimePassed(idleTimeout_))
+		{
+			idleClients.erase(idleClients.begin() + n);
+		}
+		else
+		{
+			++n;
+		}
+	}
+
+	if (idleClients.size() < maximalIdleClientsPerHost_)
+	{
+		idleClients.emplace_back(Timestamp(true), std::move(client));
+	}
+}
+
+void HTTPClient::ConnectionPool::clear()
+{
+	const ScopedLock scopedLock(lock_);
+
+	idleClientMap_.clear();
+}
+
+TaskExecutor::ScheduleAwaitable HTTPClient::ConnectionPool::schedule()
+{
+	return TaskExecutor::ScheduleAwaitable(threadPool_);
+}
+
+void HTTPClient::ConnectionPool::invoke(ThreadPool::Function&& function)
+{
+	ocean_assert(function);
+
+	threadPool_.invoke(std::move(function));
+}
+
+std::string HTTPClient::ConnectionPool::key(const std::string& host, const Port& port)
+{
+	return String::toLower(host) + std::string(":") + String::toAString(port.readable());
+}
+
 HTTPClient::HTTPClient(const std::string& host, const Port& port) :
 	host_(host),
 	port_(port)
@@ -189,6 +333,7 @@ bool HTTPClient::invokeHeadRequest(const std::string& uri, HTTPHeader& header, c
 		{
 			if (!parseHeader((char*)buffer.data(), buffer.size(), header))
 			{
+				connectionClose_ = true;
 				return false;
 			}
 
@@ -196,6 +341,8 @@ bool HTTPClient::invokeHeadRequest(const std::string& uri, HTTPHeader& header, c
 			{
 				ocean_assert(responseQueue_.isEmpty());
 
+				connectionClose_ = header.connectionClose() || header.version_ == "HTTP/1.0";
+
 				// the header could be parsed and due the HEAD method we do not expect more information to be delivered
 				break;
 			}
@@ -205,6 +352,13 @@ bool HTTPClient::invokeHeadRequest(const std::string& uri, HTTPHeader& header, c
 	}
 	while (startTimestamp + timeout > Timestamp(true));
 
+	if (!header.isValid())
+	{
+		// the connection is in an unknown state and cannot be reused
+
+		connectionClose_ = true;
+	}
+
 	return header.isValid();
 }
 
@@ -221,9 +375,410 @@ bool HTTPClient::invokeGetRequest(const std::string& uri, Buffer& data, const do
 		return false;
 	}
 
+	return receiveGetResponse(HTTPHeader::RC_OK, data, timeout, uriRedirection, replyCode, abort, progressCallback);
+}
+
+bool HTTPClient::invokeGetRangeRequest(const std::string& uri, const size_t rangeStart, const size_t rangeSize, Buffer& data, const double timeout, bool* abort)
+{
+	ocean_assert(!uri.empty());
+	ocean_assert(rangeSize >= 1);
+	ocean_assert(timeout > 0);
+
+	data.clear();
+
+	if (rangeSize == 0)
+	{
+		return false;
+	}
+
+	const std::string rangeHeaderLine = std::string("Range: bytes=") + String::toAString(rangeStart) + std::string("-") + String::toAString(rangeStart + rangeSize - 1) + std::string("\r\n");
+
+	if (!sendRequest(uri, "GET", rangeHeaderLine))
+	{
+		return false;
+	}
+
+	if (!receiveGetResponse(HTTPHeader::RC_PARTIAL_CONTENT, data, timeout, nullptr, nullptr, abort, ProgressCallback()))
+	{
+		return false;
+	}
+
+	if (data.size() != rangeSize)
+	{
+		data.clear();
+		return false;
+	}
+
+	return true;
+}
+
+bool HTTPClient::invokeConditionalGetRequest(const std::string& uri, const CacheValidators& validators, Buffer& data, bool& notModified, CacheValidators& responseValidators, const double timeout)
+{
+	ocean_assert(!uri.empty());
+	ocean_assert(timeout > 0);
+
+	data.clear();
+	notModified = false;
+
+	std::string conditionalHeaderLines;
+
+	for (const std::string& requestHeader : validators.requestHeaders())
+	{
+		conditionalHeaderLines += requestHeader + std::string("\r\n");
+	}
+
+	if (!sendRequest(uri, "GET", conditionalHeaderLines))
+	{
+		return false;
+	}
+
+	HTTPHeader responseHeader;
+	if (!receiveGetResponse(HTTPHeader::RC_OK, data, timeout, nullptr, nullptr, nullptr, ProgressCallback(), &responseHeader, validators.isValid()))
+	{
+		return false;
+	}
+
+	notModified = responseHeader.code() == HTTPHeader::RC_NOT_MODIFIED;
+	responseValidators = responseHeader.validators();
+
+	return true;
+}
+
+bool HTTPClient::isReusable() const
+{
+	const ScopedLock scopedLock(lock_);
+
+	return !connectionClose_ && tcpClient_.isConnected();
+}
+
+bool HTTPClient::httpGetRequest(const std::string& url, Buffer& data, const Port& port, const double timeout, bool allowRedirect, std::string* redirectedURI, HTTPHeader::ReplyCode* replyCode, bool* abort, const ProgressCallback& progressCallback)
+{
+	std::string protocol, hostString, uri;
+	if (!url2uri(url, protocol, hostString, uri))
+	{
+		return false;
+	}
+
+	std::string urlRedirection;
+
+	if (replyCode)
+	{
+		*replyCode = HTTPHeader::RC_INVALID;
+	}
+
+	if (pooledGetRequest(hostString, port, uri, data, timeout, &urlRedirection, replyCode, abort, progressCallback))
+	{
+		return true;
+	}
+
+	if (!allowRedirect || urlRedirection.empty())
+	{
+		return false;
+	}
+
+	if (redirectedURI)
+	{
+		std::string dummyProtocol, dummyHostString;
+		if (!url2uri(urlRedirection, dummyProtocol, dummyHostString, *redirectedURI))
+		{
+			return false;
+		}
+	}
+
+	return httpGetRequest(urlRedirection, data, port, timeout, false, nullptr, replyCode);
+}
+
+bool HTTPClient::httpConditionalGetRequest(const std::string& url, const CacheValidators& validators, Buffer& data, bool& notModified, CacheValidators& responseValidators, const Port& port, const double timeout)
+{
+	std::string protocol, hostString, uri;
+	if (!url2uri(url, protocol, hostString, uri))
+	{
+		return false;
+	}
+
+	for (unsigned int nAttempt = 0u; nAttempt < 2u; ++nAttempt)
+	{
+		bool reused = false;
+		UniqueHTTPClient client = ConnectionPool::get().acquire(hostString, port, &reused);
+
+		if (!client)
+		{
+			return false;
+		}
+
+		const bool result = client->invokeConditionalGetRequest(uri, validators, data, notModified, responseValidators, timeout);
+
+		ConnectionPool::get().release(std::move(client));
+
+		if (result)
+		{
+			return true;
+		}
+
+		if (!reused)
+		{
+			return false;
+		}
+
+		// the reused connection has likely been closed by the server in the meantime, so we try again with a new connection
+	}
+
+	return false;
+}
+
+bool HTTPClient::httpGetRequestParallel(const std::string& url, Buffer& data, const Port& port, const unsigned int numberConnections, const double timeout, bool* abort)
+{
+	ocean_assert(numberConnections >= 1u);
+	ocean_assert(timeout > 0.0);
+
+	std::string protocol, hostString, uri;
+	if (!url2uri(url, protocol, hostString, uri))
+	{
+		return false;
+	}
+
+	// we determine the size of the resource and whether the server supports range requests
+
+	HTTPHeader header;
+	bool headSucceeded = false;
+
+	if (numberConnections >= 2u)
+	{
+		UniqueHTTPClient client = ConnectionPool::get().acquire(hostString, port);
+
+		if (client)
+		{
+			headSucceeded = client->invokeHeadRequest(uri, header, timeout);
+
+			ConnectionPool::get().release(std::move(client));
+		}
+	}
+
+	const size_t contentLength = header.contentLength();
+
+	if (!headSucceeded || header.code() != HTTPHeader::RC_OK || !header.acceptRanges() || header.encodingType() != HTTPHeader::ET_STANDARD || contentLength < minimalParallelSize_)
+	{
+		return httpGetRequest(url, data, port, timeout, true, nullptr, nullptr, abort);
+	}
+
+	const size_t numberRanges = std::min(size_t(numberConnections), contentLength / (minimalParallelSize_ / 4));
+	ocean_assert(numberRanges >= 2);
+
+	const size_t rangeSize = (contentLength + numberRanges - 1) / numberRanges;
+
+	data.resize(contentLength);
+
+	std::vector<std::future<bool>> futures;
+	futures.reserve(numberRanges - 1);
+
+	for (size_t nRange = 1; nRange < numberRanges; ++nRange)
+	{
+		const size_t rangeStart = nRange * rangeSize;
+
+		if (rangeStart >= contentLength)
+		{
+			break;
+		}
+
+		const size_t size = std::min(rangeSize, contentLength - rangeStart);
+
+		std::shared_ptr<std::promise<bool>> promise = std::make_shared<std::promise<bool>>();
+		futures.emplace_back(promise->get_future());
+
+		uint8_t* const target = data.data() + rangeStart;
+
+		ConnectionPool::get().invoke([hostString, port, uri, rangeStart, size, target, timeout, abort, promise]()
+		{
+			promise->set_value(pooledGetRangeRequest(hostString, port, uri, rangeStart, size, target, timeout, abort));
+		});
+	}
+
+	// the calling thread downloads the first range
+
+	bool succeeded = pooledGetRangeRequest(hostString, port, uri, 0, std::min(rangeSize, contentLength), data.data(), timeout, abort);
+
+	// we need to wait for all ranges, as all ranges are written into the same buffer
+
+	for (std::future<bool>& future : futures)
+	{
+		succeeded = future.get() && succeeded;
+	}
+
+	if (!succeeded)
+	{
+		data.clear();
+	}
+
+	return succeeded;
+}
+
+std::future<HTTPClient::Response> HTTPClient::httpGetRequestAsync(const std::string& url, const Port& port, const double timeout)
+{
+	ocean_assert(timeout > 0.0);
+
+	std::shared_ptr<std::promise<Response>> promise = std::make_shared<std::promise<Response>>();
+	std::future<Response> future = promise->get_future();
+
+	ConnectionPool::get().invoke([url, port, timeout, promise]()
+	{
+		Response response;
+		response.first = httpGetRequest(url, response.second, port, timeout);
+
+		promise->set_value(std::move(response));
+	});
+
+	return future;
+}
+
+Task<HTTPClient::Response> HTTPClient::httpGetRequestTask(std::string url, const Port port, const double timeout)
+{
+	ocean_assert(timeout > 0.0);
+
+	co_await ConnectionPool::get().schedule();
+
+	Response response;
+	response.first = httpGetRequest(url, response.second, port, timeout);
+
+	co_return response;
+}
+
+bool HTTPClient::httpGetRequests(const Strings& urls, Responses& responses, const Port& port, const double timeout)
+{
+	ocean_assert(timeout > 0.0);
+
+	std::vector<std::future<Response>> futures;
+	futures.reserve(urls.size());
+
+	for (const std::string& url : urls)
+	{
+		futures.emplace_back(httpGetRequestAsync(url, port, timeout));
+	}
+
+	responses.clear();
+	responses.reserve(futures.size());
+
+	bool allSucceeded = true;
+
+	for (std::future<Response>& future : futures)
+	{
+		responses.emplace_back(future.get());
+
+		allSucceeded = allSucceeded && responses.back().first;
+	}
+
+	return allSucceeded;
+}
+
+bool HTTPClient::pooledGetRequest(const std::string& host, const Port& port, const std::string& uri, Buffer& data, const double timeout, std::string* urlRedirection, HTTPHeader::ReplyCode* replyCode, bool* abort, const ProgressCallback& progressCallback)
+{
+	for (unsigned int nAttempt = 0u; nAttempt < 2u; ++nAttempt)
+	{
+		bool reused = false;
+		UniqueHTTPClient client = ConnectionPool::get().acquire(host, port, &reused);
+
+		if (!client)
+		{
+			return false;
+		}
+
+		HTTPHeader::ReplyCode localReplyCode = HTTPHeader::RC_INVALID;
+		const bool result = client->invokeGetRequest(uri, data, timeout, urlRedirection, &localReplyCode, abort, progressCallback);
+
+		if (replyCode != nullptr)
+		{
+			*replyCode = localReplyCode;
+		}
+
+		ConnectionPool::get().release(std::move(client));
+
+		if (result)
+		{
+			return true;
+		}
+
+		if (!reused || localReplyCode != HTTPHeader::RC_INVALID || (abort != nullptr && *abort))
+		{
+			return false;
+		}
+
+		// the reused connection has not provided a response, it has likely been closed by the server in the meantime, so we try again with a new connection
+
+		data.clear();
+	}
+
+	return false;
+}
+
+bool HTTPClient::pooledGetRangeRequest(const std::string& host, const Port& port, const std::string& uri, const size_t rangeStart, const size_t rangeSize, uint8_t* target, const double timeout, bool* abort)
+{
+	ocean_assert(target != nullptr && rangeSize >= 1);
+
+	for (unsigned int nAttempt = 0u; nAttempt < 2u; ++nAttempt)
+	{
+		bool reused = false;
+		UniqueHTTPClient client = ConnectionPool::get().acquire(host, port, &reused);
+
+		if (!client)
+		{
+			return false;
+		}
+
+		Buffer rangeData;
+		const bool result = client->invokeGetRangeRequest(uri, rangeStart, rangeSize, rangeData, timeout, abort);
+
+		ConnectionPool::get().release(std::move(client));
+
+		if (result)
+		{
+			ocean_assert(rangeData.size() == rangeSize);
+			memcpy(target, rangeData.data(), rangeSize);
+
+			return true;
+		}
+
+		if (!reused || (abort != nullptr && *abort))
+		{
+			return false;
+		}
+	}
+
+	return false;
+}
+
+bool HTTPClient::sendRequest(const std::string& uri, const std::string& requestMethod, const std::string& additionalHeaderLines)
+{
+	ocean_assert(!uri.empty() && !requestMethod.empty());
+
+	responseQueue_.clear();
+
+	const ScopedLock scopedLock(lock_);
+
+	if (!tcpClient_.isConnected())
+	{
+		return false;
+	}
+
+	connectionClose_ = false;
+
+	const std::string command = requestMethod + std::string(" /") + uri + std::string(" ") + httpVersionString(version_) + std::string("\r\nHost: ") + host_ + std::string("\r\n") + additionalHeaderLines + std::string("\r\n");
+
+	// the request is sent without the terminating null character, otherwise the character would precede the next request of a persistent connection
+
+	return tcpClient_.send(command.c_str(), command.length()) == Socket::SR_SUCCEEDED;
+}
+
+bool HTTPClient::receiveGetResponse(const HTTPHeader::ReplyCode expectedCode, Buffer& data, const double timeout, std::string* uriRedirection, HTTPHeader::ReplyCode* replyCode, bool* abort, const ProgressCallback& progressCallback, HTTPHeader* header, const bool acceptNotModified)
+{
+	ocean_assert(expectedCode == HTTPHeader::RC_OK || expectedCode == HTTPHeader::RC_PARTIAL_CONTENT);
+	ocean_assert(timeout > 0);
+
 	// now we wait for the response
 
+	// in case the response is not received entirely, the connection is in an unknown state and cannot be reused for further requests
+	connectionClose_ = true;
+
 	HTTPHeader responseHeader;
+	bool responseComplete = false;
 	Timestamp startTimestamp(true);
 
 	Buffer responseBuffer;
@@ -250,7 +805,10 @@ bool HTTPClient::invokeGetRequest(const std::string& uri, Buffer& data, const do
 			if (!buffer.empty())
 			{
 				if (appendData(responseHeader, responseBuffer, responseBufferPosition, (char*)buffer.data(), buffer.size(), responsePendingChunkSize))
+				{
+					responseComplete = true;
 					break;
+				}
 
 				startTimestamp.toNow();
 			}
@@ -261,7 +819,17 @@ bool HTTPClient::invokeGetRequest(const std::string& uri, Buffer& data, const do
 
 			if (!buffer.empty())
 			{
-				if (!parseHeader((char*)buffer.data(), buffer.size(), responseHeader) || responseHeader.code() != HTTPHeader::RC_OK)
+				const bool headerParsed = parseHeader((char*)buffer.data(), buffer.size(), responseHeader);
+
+				if (headerParsed && acceptNotModified && responseHeader.code() == HTTPHeader::RC_NOT_MODIFIED)
+				{
+					// a not-modified response never has a payload
+
+					responseComplete = true;
+					break;
+				}
+
+				if (!headerParsed || responseHeader.code() != expectedCode)
 				{
 					if (responseHeader.code() == HTTPHeader::RC_MOVED_PERMANENTLY && uriRedirection)
 					{
@@ -279,8 +847,9 @@ bool HTTPClient::invokeGetRequest(const std::string& uri, Buffer& data, const do
 				ocean_assert(responseHeader.length() != 0);
 
 				// if the response does not provide any (payload) content we can break here
-				if (responseHeader.contentLength() == 0)
+				if (responseHeader.contentLength() == 0 && !responseHeader.transferEncodingChunked())
 				{
+					responseComplete = true;
 					break;
 				}
 
@@ -288,6 +857,7 @@ bool HTTPClient::invokeGetRequest(const std::string& uri, Buffer& data, const do
 				{
 					if (appendData(responseHeader, responseBuffer, responseBufferPosition, (char*)buffer.data() + responseHeader.length(), buffer.size() - responseHeader.length(), responsePendingChunkSize))
 					{
+						responseComplete = true;
 						break;
 					}
 				}
@@ -305,6 +875,16 @@ bool HTTPClient::invokeGetRequest(const std::string& uri, Buffer& data, const do
 	}
 	while (!startTimestamp.hasTimePassed(timeout));
 
+	if (responseComplete)
+	{
+		connectionClose_ = responseHeader.connectionClose() || responseHeader.version_ == "HTTP/1.0";
+	}
+
+	if (header != nullptr)
+	{
+		*header = responseHeader;
+	}
+
 	if (responseHeader.encodingType() == HTTPHeader::ET_GZIP)
 	{
 		if (!IO::Compression::gzipDecompress(responseBuffer.data(), responseBuffer.size(), data))
@@ -327,70 +907,6 @@ bool HTTPClient::invokeGetRequest(const std::string& uri, Buffer& data, const do
 	return true;
 }
 
-bool HTTPClient::httpGetRequest(const std::string& url, Buffer& data, const Port& port, const double timeout, bool allowRedirect, std::string* redirectedURI, HTTPHeader::ReplyCode* replyCode, bool* abort, const ProgressCallback& progressCallback)
-{
-	std::string protocol, hostString, uri;
-	if (!url2uri(url, protocol, hostString, uri))
-	{
-		return false;
-	}
-
-	std::string urlRedirection;
-
-	if (replyCode)
-	{
-		*replyCode = HTTPHeader::RC_INVALID;
-	}
-
-	{
-		HTTPClient httpClient(hostString, port);
-
-		if (!httpClient.connect())
-		{
-			return false;
-		}
-
-		if (httpClient.invokeGetRequest(uri, data, timeout, &urlRedirection, replyCode, abort, progressCallback))
-		{
-			return true;
-		}
-	}
-
-	if (!allowRedirect || urlRedirection.empty())
-	{
-		return false;
-	}
-
-	if (redirectedURI)
-	{
-		std::string dummyProtocol, dummyHostString;
-		if (!url2uri(urlRedirection, dummyProtocol, dummyHostString, *redirectedURI))
-		{
-			return false;
-		}
-	}
-
-	return httpGetRequest(urlRedirection, data, port, timeout, false, nullptr, replyCode);
-}
-
-bool HTTPClient::sendRequest(const std::string& uri, const std::string& requestMethod)
-{
-	ocean_assert(!uri.empty() && !requestMethod.empty());
-
-	responseQueue_.clear();
-
-	const ScopedLock scopedLock(lock_);
-
-	if (!tcpClient_.isConnected())
-	{
-		return false;
-	}
-
-	const std::string command = requestMethod + std::string(" /") + uri + std::string(" ") + httpVersionString(version_) + std::string("\r\nHost: ") + host_  + std::string("\r\n\r\n");
-
-	return tcpClient_.send(command) == Socket::SR_SUCCEEDED;
-}
-
 void HTTPClient::onResponse(const void* data, const size_t size)
 {
 	ocean_assert(data != nullptr || size == 0);
@@ -500,7 +1016,7 @@ bool HTTPClient::parseHeader(const char* data, const size_t size, HTTPHeader& he
 bool HTTPClient::appendData(const HTTPHeader& header, Buffer& buffer, size_t& bufferPosition, const char* payload, size_t payloadSize, size_t& pendingChunkSize)
 {
 	ocean_assert(header.isValid());
-	ocean_assert(header.code() == HTTPHeader::RC_OK);
+	ocean_assert(header.code() == HTTPHeader::RC_OK || header.code() == HTTPHeader::RC_PARTIAL_CONTENT);
 	ocean_assert(header.length() != 0);
 	ocean_assert(payloadSize != 0);
 
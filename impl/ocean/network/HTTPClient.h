@@ -10,8 +10,18 @@
 
 #include "ocean/network/Network.h"
 #include "ocean/network/BufferQueue.h"
+#include "ocean/network/CacheValidators.h"
 #include "ocean/network/TCPClient.h"
 
+#include "ocean/base/Singleton.h"
+#include "ocean/base/Task.h"
+#include "ocean/base/ThreadPool.h"
+#include "ocean/base/Timestamp.h"
+
+#include <future>
+#include <memory>
+#include <unordered_map>
+
 namespace Ocean
 {
 
@@ -20,6 +30,8 @@ namespace Network
 
 /**
  * This class implements a basic http client.
+ * The client keeps the connection to the server alive between several requests (HTTP/1.1 persistent connections).<br>
+ * The static request functions use connections from the HTTPClient::ConnectionPool, so that consecutive requests to the same host do not need a new TCP handshake.
  * @ingroup network
  */
 class OCEAN_NETWORK_EXPORT HTTPClient
@@ -61,8 +73,12 @@ class OCEAN_NETWORK_EXPORT HTTPClient
 					RC_CREATED = 201,
 					/// Accepted reply code.
 					RC_ACCEPTED = 202,
+					/// Partial content reply code, the response to a range request.
+					RC_PARTIAL_CONTENT = 206,
 					/// This and all future requests should be directed to the given URI
 					RC_MOVED_PERMANENTLY = 301,
+					/// Not modified reply code, the response to a conditional request of an unchanged resource.
+					RC_NOT_MODIFIED = 304,
 					/// Bad request reply code.
 					RC_BAD_REQUEST = 400,
 					/// Unauthorized reply code.
@@ -126,6 +142,24 @@ class OCEAN_NETWORK_EXPORT HTTPClient
 				 */
 				inline bool transferEncodingChunked() const;
 
+				/**
+				 * Returns whether the server will close the connection after the response.
+				 * @return True, if the header contains 'Connection: close'
+				 */
+				inline bool connectionClose() const;
+
+				/**
+				 * Returns whether the server supports range requests.
+				 * @return True, if the header contains 'Accept-Ranges: bytes'
+				 */
+				inline bool acceptRanges() const;
+
+				/**
+				 * Returns the cache validators of the resource.
+				 * @return The validators provided by the server
+				 */
+				inline const CacheValidators& validators() const;
+
 				/**
 				 * Returns the content encoding type.
 				 * @return The content encoding type
@@ -174,6 +208,18 @@ class OCEAN_NETWORK_EXPORT HTTPClient
 				 */
 				inline void setTransferEncodingChunked(const bool state);
 
+				/**
+				 * Sets whether the server will close the connection after the response.
+				 * @param state True, if the connection will be closed
+				 */
+				inline void setConnectionClose(const bool state);
+
+				/**
+				 * Sets whether the server supports range requests.
+				 * @param state True, if the server supports byte ranges
+				 */
+				inline void setAcceptRanges(const bool state);
+
 				/**
 				 * Sets the content encoding type.
 				 * @param type The content encoding type
@@ -225,6 +271,15 @@ class OCEAN_NETWORK_EXPORT HTTPClient
 				/// True, if the transfer-encoding is chunked
 				bool transferEncodingChunked_ = false;
 
+				/// True, if the server will close the connection after the response.
+				bool connectionClose_ = false;
+
+				/// True, if the server supports byte range requests.
+				bool acceptRanges_ = false;
+
+				/// The cache validators of the resource.
+				CacheValidators validators_;
+
 				/// The content encoding type.
 				EncodingType encodingType_ = ET_STANDARD;
 
@@ -247,6 +302,120 @@ class OCEAN_NETWORK_EXPORT HTTPClient
 		 */
 		using ProgressCallback = Callback<void, size_t, size_t>;
 
+		/**
+		 * Definition of a pair combining the success state of a request with the response data.
+		 */
+		using Response = std::pair<bool, Buffer>;
+
+		/**
+		 * Definition of a vector holding responses.
+		 */
+		using Responses = std::vector<Response>;
+
+		/**
+		 * Definition of a unique pointer holding a HTTP client.
+		 */
+		using UniqueHTTPClient = std::unique_ptr<HTTPClient>;
+
+		/**
+		 * This class implements a pool of persistent (keep-alive) connections to HTTP servers.
+		 * Connections are reused per host and port, idle connections are closed after a while.<br>
+		 * The pool also provides the threads executing asynchronous and parallel requests.
+		 */
+		class OCEAN_NETWORK_EXPORT ConnectionPool : public Singleton<ConnectionPool>
+		{
+			friend class Singleton<ConnectionPool>;
+
+			protected:
+
+				/**
+				 * Definition of a pair combining the timestamp at which a connection became idle with the client.
+				 */
+				using IdleClient = std::pair<Timestamp, UniqueHTTPClient>;
+
+				/**
+				 * Definition of a vector holding idle clients.
+				 */
+				using IdleClients = std::vector<IdleClient>;
+
+				/**
+				 * Definition of a map mapping hosts (with port) to idle clients.
+				 */
+				using IdleClientMap = std::unordered_map<std::string, IdleClients>;
+
+			public:
+
+				/**
+				 * Returns a connected client for a specified host, an idle connection is reused if possible.
+				 * @param host The host of the HTTP server, must be valid
+				 * @param port The port of the HTTP server, must be valid
+				 * @param reused Optional resulting flag, true if an existing connection is reused; false, if a new connection has been established
+				 * @return The connected client, nullptr if the connection could not be established
+				 */
+				UniqueHTTPClient acquire(const std::string& host, const Port& port, bool* reused = nullptr);
+
+				/**
+				 * Returns a client to the pool after a request has been handled so that the connection can be reused.
+				 * Clients with closed connections are released.
+				 * @param client The client to return, can be nullptr
+				 */
+				void release(UniqueHTTPClient&& client);
+
+				/**
+				 * Closes all idle connections.
+				 */
+				void clear();
+
+				/**
+				 * Invokes a function asynchronously in one of the pool's threads.
+				 * @param function The function to invoke, must be valid
+				 */
+				void invoke(ThreadPool::Function&& function);
+
+				/**
+				 * Returns an awaitable which continues the awaiting coroutine in one of the pool's threads.
+				 * @return The awaitable
+				 */
+				TaskExecutor::ScheduleAwaitable schedule();
+
+			protected:
+
+				/**
+				 * Creates a new pool.
+				 */
+				ConnectionPool();
+
+				/**
+				 * Destructs the pool and closes all connections.
+				 */
+				~ConnectionPool();
+
+				/**
+				 * Returns the key of a host/port pair.
+				 * @param host The host
+				 * @param port The port
+				 * @return The resulting key
+				 */
+				static std::string key(const std::string& host, const Port& port);
+
+			protected:
+
+				/// The idle clients, per host and port.
+				IdleClientMap idleClientMap_;
+
+				/// The thread pool executing asynchronous requests.
+				ThreadPool threadPool_;
+
+				/// The lock of the pool.
+				Lock lock_;
+
+				/// The maximal number of idle connections per host.
+				static constexpr size_t maximalIdleClientsPerHost_ = 8;
+
+				/// The time after which idle connections are closed, in seconds; servers close idle connections after a few seconds as well.
+				static constexpr double idleTimeout_ = 10.0;
+		};
+
 	public:
 
 		/**
@@ -297,6 +466,37 @@ class OCEAN_NETWORK_EXPORT HTTPClient
 		 */
 		bool invokeGetRequest(const std::string& uri, Buffer& data, const double timeout = 5.0, std::string* urlRedirection = nullptr, HTTPHeader::ReplyCode* replyCode = nullptr, bool* abort = nullptr, const ProgressCallback& progressCallback = ProgressCallback());
 
+		/**
+		 * Invokes a GET request for a byte range of a resource.
+		 * The server must support range requests, see HTTPHeader::acceptRanges().
+		 * @param uri The universal resource identifier for the GET request (not including the first '/' between host and URI)
+		 * @param rangeStart The index of the first byte to request, with range [0, infinity)
+		 * @param rangeSize The number of bytes to request, with range [1, infinity)
+		 * @param data The resulting range data, with 'rangeSize' bytes
+		 * @param timeout The timeout this function waits for the server's response, with range (0, infinity)
+		 * @param abort Optional flag that may be set to true by another thread to abort the request
+		 * @return True, if succeeded
+		 */
+		bool invokeGetRangeRequest(const std::string& uri, const size_t rangeStart, const size_t rangeSize, Buffer& data, const double timeout = 5.0, bool* abort = nullptr);
+
+		/**
+		 * Invokes a conditional GET request for a resource which has been received before.
+		 * @param uri The universal resource identifier for the GET request (not including the first '/' between host and URI)
+		 * @param validators The validators of the known resource, invalid validators to request the resource unconditionally
+		 * @param data The resulting response data, empty if the resource has not been modified
+		 * @param notModified The resulting flag, true if the server confirmed that the known resource is still valid
+		 * @param responseValidators The resulting validators of the response
+		 * @param timeout The timeout this function waits for the server's response, with range (0, infinity)
+		 * @return True, if succeeded
+		 */
+		bool invokeConditionalGetRequest(const std::string& uri, const CacheValidators& validators, Buffer& data, bool& notModified, CacheValidators& responseValidators, const double timeout = 5.0);
+
+		/**
+		 * Returns whether the connection of this client can be used for a further request.
+		 * @return True, if the client is connected and the server did not request to close the connection
+		 */
+		bool isReusable() const;
+
 		/**
 		 * Helper function to executes an HTTP site/file request.
 		 * @param url The URL of the HTTP site which is requested, beginning with "HTTP://"
@@ -312,9 +512,118 @@ class OCEAN_NETWORK_EXPORT HTTPClient
 		 */
 		static bool httpGetRequest(const std::string& url, Buffer& data, const Port& port = Port(80, Port::TYPE_READABLE), const double timeout = 5.0, bool allowRedirect = true, std::string* redirectedURL = nullptr, HTTPHeader::ReplyCode* replyCode = nullptr, bool* abort = nullptr, const ProgressCallback& progressCallback = ProgressCallback());
 
+		/**
+		 * Helper function to execute a conditional HTTP request for a resource which has been received before.
+		 * @param url The URL of the HTTP file which is requested, beginning with "HTTP://"
+		 * @param validators The validators of the known resource, invalid validators to request the resource unconditionally
+		 * @param data The resulting response data, empty if the resource has not been modified
+		 * @param notModified The resulting flag, true if the server confirmed that the known resource is still valid
+		 * @param responseValidators The resulting validators of the response
+		 * @param port The port of the HTTP server
+		 * @param timeout The timeout this function waits for the server's response, with range (0, infinity)
+		 * @return True, if succeeded
+		 */
+		static bool httpConditionalGetRequest(const std::string& url, const CacheValidators& validators, Buffer& data, bool& notModified, CacheValidators& responseValidators, const Port& port = Port(80, Port::TYPE_READABLE), const double timeout = 5.0);
+
+		/**
+		 * Helper function to execute an HTTP file request with several parallel connections.
+		 * Large resources are split into byte ranges which are downloaded concurrently; in case the server does not support range requests, or in case the resource is small, a standard request is executed.
+		 * @param url The URL of the HTTP file which is requested, beginning with "HTTP://"
+		 * @param data The resulting request data
+		 * @param port The port of the HTTP server
+		 * @param numberConnections The maximal number of parallel connections, with range [1, infinity)
+		 * @param timeout The timeout each request waits for the server's response, with range (0, infinity)
+		 * @param abort Optional flag that may be set to true by another thread to abort the request
+		 * @return True, if succeeded
+		 */
+		static bool httpGetRequestParallel(const std::string& url, Buffer& data, const Port& port = Port(80, Port::TYPE_READABLE), const unsigned int numberConnections = 4u, const double timeout = 5.0, bool* abort = nullptr);
+
+		/**
+		 * Executes an HTTP file request asynchronously.
+		 * @param url The URL of the HTTP file which is requested, beginning with "HTTP://"
+		 * @param port The port of the HTTP server
+		 * @param timeout The timeout this function waits for the server's response, with range (0, infinity)
+		 * @return The future providing the response
+		 */
+		static std::future<Response> httpGetRequestAsync(const std::string& url, const Port& port = Port(80, Port::TYPE_READABLE), const double timeout = 5.0);
+
+		/**
+		 * Executes an HTTP file request within a coroutine.
+		 * The request is executed in a thread of the connection pool, the awaiting coroutine is suspended meanwhile and continues in that thread.
+		 * @param url The URL of the HTTP file which is requested, beginning with "HTTP://"
+		 * @param port The port of the HTTP server
+		 * @param timeout The timeout this function waits for the server's response, with range (0, infinity)
+		 * @return The task providing the response
+		 * @see httpGetRequestAsync(), Task.
+		 */
+		static Task<Response> httpGetRequestTask(std::string url, const Port port = Port(80, Port::TYPE_READABLE), const double timeout = 5.0);
+
+		/**
+		 * Executes several HTTP file requests concurrently.
+		 * The function returns when all requests are handled.
+		 * @param urls The URLs of the HTTP files which are requested, each beginning with "HTTP://"
+		 * @param responses The resulting responses, one for each URL
+		 * @param port The port of the HTTP servers
+		 * @param timeout The timeout each request waits for the server's response, with range (0, infinity)
+		 * @return True, if all requests succeeded
+		 */
+		static bool httpGetRequests(const Strings& urls, Responses& responses, const Port& port = Port(80, Port::TYPE_READABLE), const double timeout = 5.0);
+
 	protected:
 
-		bool sendRequest(const std::string& uri, const std::string& requestMethod);
+		/**
+		 * Sends a request to the server.
+		 * @param uri The universal resource identifier of the request (not including the first '/' between host and URI)
+		 * @param requestMethod The method of the request, e.g., "GET"
+		 * @param additionalHeaderLines Optional additional header lines, each ending with '\r\n'
+		 * @return True, if succeeded
+		 */
+		bool sendRequest(const std::string& uri, const std::string& requestMethod, const std::string& additionalHeaderLines = std::string());
+
+		/**
+		 * Receives the response of a GET request.
+		 * @param expectedCode The expected reply code, either RC_OK or RC_PARTIAL_CONTENT
+		 * @param data The resulting response data
+		 * @param timeout The timeout this function waits for the server's response, with range (0, infinity)
+		 * @param urlRedirection Optional resulting URL if the request has to be redirected
+		 * @param replyCode Optional reply code of the GET request
+		 * @param abort Optional flag that may be set to true by another thread to abort the request
+		 * @param progressCallback Optional callback for receiving progress information
+		 * @param responseHeader Optional resulting header of the response
+		 * @param acceptNotModified True, to accept RC_NOT_MODIFIED as response of a conditional request
+		 * @return True, if succeeded
+		 */
+		bool receiveGetResponse(const HTTPHeader::ReplyCode expectedCode, Buffer& data, const double timeout, std::string* urlRedirection, HTTPHeader::ReplyCode* replyCode, bool* abort, const ProgressCallback& progressCallback, HTTPHeader* responseHeader = nullptr, const bool acceptNotModified = false);
+
+		/**
+		 * Executes a GET request with a client from the connection pool.
+		 * In case a reused connection has been closed by the server in the meantime, the request is repeated with a new connection.
+		 * @param host The host of the HTTP server
+		 * @param port The port of the HTTP server
+		 * @param uri The universal resource identifier of the request
+		 * @param data The resulting response data
+		 * @param timeout The timeout this function waits for the server's response, with range (0, infinity)
+		 * @param urlRedirection Optional resulting URL if the request has to be redirected
+		 * @param replyCode Optional reply code of the GET request
+		 * @param abort Optional flag that may be set to true by another thread to abort the request
+		 * @param progressCallback Optional callback for receiving progress information
+		 * @return True, if succeeded
+		 */
+		static bool pooledGetRequest(const std::string& host, const Port& port, const std::string& uri, Buffer& data, const double timeout, std::string* urlRedirection, HTTPHeader::ReplyCode* replyCode, bool* abort, const ProgressCallback& progressCallback);
+
+		/**
+		 * Executes a range GET request with a client from the connection pool.
+		 * @param host The host of the HTTP server
+		 * @param port The port of the HTTP server
+		 * @param uri The universal resource identifier of the request
+		 * @param rangeStart The index of the first byte to request, with range [0, infinity)
+		 * @param rangeSize The number of bytes to request, with range [1, infinity)
+		 * @param target The target memory receiving the range, must be valid
+		 * @param timeout The timeout this function waits for the server's response, with range (0, infinity)
+		 * @param abort Optional flag that may be set to true by another thread to abort the request
+		 * @return True, if succeeded
+		 */
+		static bool pooledGetRangeRequest(const std::string& host, const Port& port, const std::string& uri, const size_t rangeStart, const size_t rangeSize, uint8_t* target, const double timeout, bool* abort);
 
 		/**
 		 * The response event function.
@@ -395,8 +704,14 @@ class OCEAN_NETWORK_EXPORT HTTPClient
 		/// The response data queue.
 		BufferQueue responseQueue_;
 
+		/// True, if the last response requested to close the connection.
+		bool connectionClose_ = false;
+
 		/// The lock of the client.
-		Lock lock_;
+		mutable Lock lock_;
+
+		/// The minimal size of a resource so that it is downloaded with several parallel connections, in bytes.
+		static constexpr size_t minimalParallelSize_ = 1024 * 1024;
 };
 
 inline HTTPClient::HTTPHeader::ReplyCode HTTPClient::HTTPHeader::code() const
@@ -419,6 +734,21 @@ inline bool HTTPClient::HTTPHeader::transferEncodingChunked() const
 	return transferEncodingChunked_;
 }
 
+inline bool HTTPClient::HTTPHeader::connectionClose() const
+{
+	return connectionClose_;
+}
+
+inline bool HTTPClient::HTTPHeader::acceptRanges() const
+{
+	return acceptRanges_;
+}
+
+inline const CacheValidators& HTTPClient::HTTPHeader::validators() const
+{
+	return validators_;
+}
+
 inline HTTPClient::HTTPHeader::EncodingType HTTPClient::HTTPHeader::encodingType() const
 {
 	return encodingType_;
@@ -459,6 +789,16 @@ inline void HTTPClient::HTTPHeader::setTransferEncodingChunked(const bool state)
 	transferEncodingChunked_ = state;
 }
 
+inline void HTTPClient::HTTPHeader::setConnectionClose(const bool state)
+{
+	connectionClose_ = state;
+}
+
+inline void HTTPClient::HTTPHeader::setAcceptRanges(const bool state)
+{
+	acceptRanges_ = state;
+}
+
 inline void HTTPClient::HTTPHeader::setContentEncodingType(const EncodingType type)
 {
 	encodingType_ = type;
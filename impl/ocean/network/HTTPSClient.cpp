@@ -8,6 +8,7 @@
 #include "ocean/network/HTTPSClient.h"
 
 #include "ocean/base/ScopedObject.h"
+#include "ocean/base/Singleton.h"
 
 #include "ocean/math/Numeric.h"
 
@@ -74,6 +75,16 @@ class HTTPSClient::CurlSessionData
 		 */
 		static int onProgress(void* clientp, curl_off_t dltotal, curl_off_t dlnow, curl_off_t ultotal, curl_off_t ulnow);
 
+		/**
+		 * Curl event function for a new header line, parses the cache validators.
+		 * @param buffer The header line, not null-terminated
+		 * @param size Always 1
+		 * @param nitems The size of the header line, in bytes, with range [0, infinity)
+		 * @param userdata The validators receiving the parsed information, must be valid
+		 * @return The number of bytes handled
+		 */
+		static size_t onHeaderLine(char* buffer, size_t size, size_t nitems, void* userdata);
+
 		/**
 		 * The Curl debug callback function.
 		 * @param handle The handle of the curl session
@@ -96,6 +107,114 @@ class HTTPSClient::CurlSessionData
 		ProgressCallback progressCallback_;
 };
 
+/**
+ * This class implements a pool of curl handles.
+ * A reused handle keeps its connection cache, so that consecutive requests to the same host reuse the established (TLS) connection instead of executing a new handshake.
+ */
+class HTTPSClient::CurlHandlePool : public Singleton<CurlHandlePool>
+{
+	friend class Singleton<CurlHandlePool>;
+
+	protected:
+
+		/**
+		 * Definition of a vector holding curl handles.
+		 */
+		using Handles = std::vector<CURL*>;
+
+	public:
+
+		/**
+		 * Returns a curl handle, an idle handle is reused if possible.
+		 * @return The curl handle, nullptr if the handle could not be created
+		 */
+		CURL* acquire();
+
+		/**
+		 * Returns a curl handle to the pool.
+		 * @param handle The handle to return, must be valid
+		 */
+		void release(CURL* handle);
+
+		/**
+		 * Returns a curl handle to the pool, can be used as release function of a scoped object.
+		 * @param handle The handle to return, must be valid
+		 */
+		static void releaseHandle(CURL* handle);
+
+	protected:
+
+		/**
+		 * Creates a new pool.
+		 */
+		CurlHandlePool() = default;
+
+		/**
+		 * Destructs the pool and releases all handles.
+		 */
+		~CurlHandlePool();
+
+	protected:
+
+		/// The idle handles.
+		Handles handles_;
+
+		/// The lock of the pool.
+		Lock lock_;
+
+		/// The maximal number of idle handles.
+		static constexpr size_t maximalIdleHandles_ = 8;
+};
+
+CURL* HTTPSClient::CurlHandlePool::acquire()
+{
+	{
+		const ScopedLock scopedLock(lock_);
+
+		if (!handles_.empty())
+		{
+			CURL* handle = handles_.back();
+			handles_.pop_back();
+
+			return handle;
+		}
+	}
+
+	return curl_easy_init();
+}
+
+void HTTPSClient::CurlHandlePool::release(CURL* handle)
+{
+	ocean_assert(handle != nullptr);
+
+	// the options are reset, while the connection cache, the DNS cache, and the TLS session ids are kept
+	curl_easy_reset(handle);
+
+	const ScopedLock scopedLock(lock_);
+
+	if (handles_.size() < maximalIdleHandles_)
+	{
+		handles_.emplace_back(handle);
+	}
+	else
+	{
+		curl_easy_cleanup(handle);
+	}
+}
+
+void HTTPSClient::CurlHandlePool::releaseHandle(CURL* handle)
+{
+	get().release(handle);
+}
+
+HTTPSClient::CurlHandlePool::~CurlHandlePool()
+{
+	for (CURL* handle : handles_)
+	{
+		curl_easy_cleanup(handle);
+	}
+}
+
 HTTPSClient::CurlSessionData::CurlSessionData(bool* abort, ProgressCallback progressCallback) :
 	abort_(abort),
 	progressCallback_(std::move(progressCallback))
@@ -168,6 +287,23 @@ int HTTPSClient::CurlSessionData::onProgress(void* clientp, curl_off_t dltotal,
 	return 0;
 }
 
+size_t HTTPSClient::CurlSessionData::onHeaderLine(char* buffer, size_t size, size_t nitems, void* userdata)
+{
+	ocean_assert_and_suppress_unused(size == 1, size);
+	ocean_assert(userdata != nullptr);
+
+	if (nitems != 0)
+	{
+		ocean_assert(buffer != nullptr);
+
+		CacheValidators* validators = (CacheValidators*)(userdata);
+
+		validators->parseHeaderLine(std::string(buffer, nitems));
+	}
+
+	return nitems;
+}
+
 int HTTPSClient::CurlSessionData::curlDebugCallback(CURL* /*handle*/, curl_infotype type, char* data, size_t /*size*/, void* /*clientp*/)
 {
 	if (data != nullptr && type == CURLINFO_TEXT)
@@ -295,9 +431,9 @@ bool HTTPSClient::httpsGetRequest(const std::string& url, Buffer& data, const Po
 
 #elif defined(OCEAN_PLATFORM_BUILD_LINUX) || defined(OCEAN_PLATFORM_BUILD_ANDROID)
 
-	using ScopedCurlHandle = ScopedObjectCompileTimeVoidT<CURL*, curl_easy_cleanup>;
+	using ScopedCurlHandle = ScopedObjectCompileTimeVoidT<CURL*, CurlHandlePool::releaseHandle>;
 
-	ScopedCurlHandle curlHandle(curl_easy_init());
+	ScopedCurlHandle curlHandle(CurlHandlePool::get().acquire());
 
 	if (!curlHandle.isValid())
 	{
@@ -367,6 +503,251 @@ bool HTTPSClient::httpsGetRequest(const std::string& url, Buffer& data, const Po
 #endif
 }
 
+bool HTTPSClient::httpsConditionalGetRequest(const std::string& url, const CacheValidators& validators, Buffer& data, bool& notModified, CacheValidators& responseValidators, const Port& port, const double timeout, const std::string& caCertificates)
+{
+	ocean_assert(timeout > 0.0);
+
+	data.clear();
+	notModified = false;
+	responseValidators = CacheValidators();
+
+#if defined(OCEAN_PLATFORM_BUILD_LINUX) || defined(OCEAN_PLATFORM_BUILD_ANDROID)
+
+	using ScopedCurlHandle = ScopedObjectCompileTimeVoidT<CURL*, CurlHandlePool::releaseHandle>;
+	using ScopedCurlList = ScopedObjectCompileTimeVoidT<struct curl_slist*, curl_slist_free_all>;
+
+	ScopedCurlHandle curlHandle(CurlHandlePool::get().acquire());
+
+	if (!curlHandle.isValid())
+	{
+		return false;
+	}
+
+	const long timeoutMilliseconds = long(timeout * 1000.0);
+
+	if (timeoutMilliseconds <= 0)
+	{
+		ocean_assert(false && "Invalid timeout!");
+		return false;
+	}
+
+	if (!caCertificates.empty())
+	{
+		curl_easy_setopt(*curlHandle, CURLOPT_CAINFO, caCertificates.c_str());
+	}
+
+	curl_easy_setopt(*curlHandle, CURLOPT_URL, url.c_str());
+	curl_easy_setopt(*curlHandle, CURLOPT_PORT, long(port.readable()));
+
+	CurlSessionData curlSessionData(nullptr, ProgressCallback());
+
+	curl_easy_setopt(*curlHandle, CURLOPT_WRITEFUNCTION, CurlSessionData::onNewData);
+	curl_easy_setopt(*curlHandle, CURLOPT_WRITEDATA, &curlSessionData);
+
+	curl_easy_setopt(*curlHandle, CURLOPT_HEADERFUNCTION, CurlSessionData::onHeaderLine);
+	curl_easy_setopt(*curlHandle, CURLOPT_HEADERDATA, &responseValidators);
+
+	curl_easy_setopt(*curlHandle, CURLOPT_CONNECTTIMEOUT_MS, timeoutMilliseconds);
+
+	ScopedCurlList headerList;
+
+	if (validators.isValid())
+	{
+		struct curl_slist* list = nullptr;
+
+		for (const std::string& requestHeader : validators.requestHeaders())
+		{
+			list = curl_slist_append(list, requestHeader.c_str());
+		}
+
+		headerList = ScopedCurlList(list);
+
+		curl_easy_setopt(*curlHandle, CURLOPT_HTTPHEADER, *headerList);
+	}
+
+	const CURLcode result = curl_easy_perform(*curlHandle);
+
+	long responseCode = 0;
+	curl_easy_getinfo(*curlHandle, CURLINFO_RESPONSE_CODE, &responseCode);
+
+	if (result != CURLE_OK)
+	{
+		Log::error() << "HTTPS conditional get request failed with error '" << curl_easy_strerror(result) << "' (" << result << ") and response code " << responseCode;
+
+		return false;
+	}
+
+	if (responseCode == 304 && validators.isValid())
+	{
+		notModified = true;
+		return true;
+	}
+
+	if (responseCode != 200)
+	{
+		return false;
+	}
+
+	data = curlSessionData.data();
+
+	return true;
+
+#else
+
+	OCEAN_SUPPRESS_UNUSED_WARNING(validators);
+
+	return httpsGetRequest(url, data, port, timeout, nullptr, ProgressCallback(), caCertificates);
+
+#endif
+}
+
+bool HTTPSClient::httpsGetRequests(const Strings& urls, Responses& responses, const Port& port, const double timeout, const std::string& caCertificates)
+{
+	ocean_assert(timeout > 0.0);
+
+	responses.clear();
+	responses.resize(urls.size());
+
+#if defined(OCEAN_PLATFORM_BUILD_LINUX) || defined(OCEAN_PLATFORM_BUILD_ANDROID)
+
+	using ScopedCurlMultiHandle = ScopedObjectCompileTimeT<CURLM*, CURLM*, CURLMcode, curl_multi_cleanup, CURLM_OK>;
+
+	const long timeoutMilliseconds = long(timeout * 1000.0);
+
+	if (timeoutMilliseconds <= 0)
+	{
+		ocean_assert(false && "Invalid timeout!");
+		return false;
+	}
+
+	ScopedCurlMultiHandle multiHandle(curl_multi_init());
+
+	if (!multiHandle.isValid())
+	{
+		return false;
+	}
+
+	// the transfers to the same host share the connections of the multi handle's connection cache, HTTP/2 connections are multiplexed
+
+	curl_multi_setopt(*multiHandle, CURLMOPT_MAX_HOST_CONNECTIONS, 6l);
+	curl_multi_setopt(*multiHandle, CURLMOPT_PIPELINING, long(CURLPIPE_MULTIPLEX));
+
+	using ScopedCurlHandle = ScopedObjectCompileTimeVoidT<CURL*, CurlHandlePool::releaseHandle>;
+
+	std::vector<ScopedCurlHandle> curlHandles;
+	curlHandles.reserve(urls.size());
+
+	std::vector<std::unique_ptr<CurlSessionData>> curlSessionDatas;
+	curlSessionDatas.reserve(urls.size());
+
+	bool allAdded = true;
+
+	for (size_t n = 0; n < urls.size(); ++n)
+	{
+		ScopedCurlHandle curlHandle(CurlHandlePool::get().acquire());
+
+		if (!curlHandle.isValid())
+		{
+			allAdded = false;
+			break;
+		}
+
+		curlSessionDatas.emplace_back(std::make_unique<CurlSessionData>(nullptr, ProgressCallback()));
+
+		if (!caCertificates.empty())
+		{
+			curl_easy_setopt(*curlHandle, CURLOPT_CAINFO, caCertificates.c_str());
+		}
+
+		curl_easy_setopt(*curlHandle, CURLOPT_URL, urls[n].c_str());
+		curl_easy_setopt(*curlHandle, CURLOPT_PORT, long(port.readable()));
+
+		curl_easy_setopt(*curlHandle, CURLOPT_WRITEFUNCTION, CurlSessionData::onNewData);
+		curl_easy_setopt(*curlHandle, CURLOPT_WRITEDATA, curlSessionDatas.back().get());
+
+		curl_easy_setopt(*curlHandle, CURLOPT_CONNECTTIMEOUT_MS, timeoutMilliseconds);
+
+		// the index of the request is stored in the handle's private pointer
+		curl_easy_setopt(*curlHandle, CURLOPT_PRIVATE, (void*)(n));
+
+		if (curl_multi_add_handle(*multiHandle, *curlHandle) != CURLM_OK)
+		{
+			allAdded = false;
+			break;
+		}
+
+		curlHandles.emplace_back(std::move(curlHandle));
+	}
+
+	int runningTransfers = allAdded ? int(curlHandles.size()) : 0;
+
+	while (runningTransfers > 0)
+	{
+		if (curl_multi_perform(*multiHandle, &runningTransfers) != CURLM_OK)
+		{
+			break;
+		}
+
+		int pendingMessages = 0;
+		while (CURLMsg* message = curl_multi_info_read(*multiHandle, &pendingMessages))
+		{
+			if (message->msg != CURLMSG_DONE)
+			{
+				continue;
+			}
+
+			void* privatePointer = nullptr;
+			curl_easy_getinfo(message->easy_handle, CURLINFO_PRIVATE, &privatePointer);
+
+			const size_t index = size_t(privatePointer);
+			ocean_assert(index < responses.size());
+
+			if (message->data.result == CURLE_OK)
+			{
+				responses[index].first = true;
+				responses[index].second = curlSessionDatas[index]->data();
+			}
+			else
+			{
+				Log::error() << "HTTPS get request failed with error '" << curl_easy_strerror(message->data.result) << "' (" << message->data.result << ")";
+			}
+		}
+
+		if (runningTransfers > 0 && curl_multi_wait(*multiHandle, nullptr, 0u, 100, nullptr) != CURLM_OK)
+		{
+			break;
+		}
+	}
+
+	// the handles must be removed from the multi handle before they are returned to the pool
+
+	for (ScopedCurlHandle& curlHandle : curlHandles)
+	{
+		curl_multi_remove_handle(*multiHandle, *curlHandle);
+	}
+
+	curlHandles.clear();
+
+#else
+
+	for (size_t n = 0; n < urls.size(); ++n)
+	{
+		responses[n].first = httpsGetRequest(urls[n], responses[n].second, port, timeout, nullptr, ProgressCallback(), caCertificates);
+	}
+
+#endif
+
+	for (const Response& response : responses)
+	{
+		if (!response.first)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
 bool HTTPSClient::httpsPostRequest(const std::string& url, const uint8_t* requestData, const size_t requestDataSize, Buffer& data, const Port& port, const double timeout, const Strings& additionalHeaders, const std::string& caCertificates)
 {
 	ocean_assert(timeout > 0.0);
@@ -471,10 +852,11 @@ bool HTTPSClient::httpsPostRequest(const std::string& url, const uint8_t* reques
 
 #elif defined(OCEAN_PLATFORM_BUILD_LINUX) || defined(OCEAN_PLATFORM_BUILD_ANDROID)
 
-	using ScopedCurlHandle = ScopedObjectCompileTimeVoidT<CURL*, curl_easy_cleanup>;
 	using ScopedCurlList = ScopedObjectCompileTimeVoidT<struct curl_slist*, curl_slist_free_all>;
 
-	ScopedCurlHandle curlHandle(curl_easy_init());
+	using ScopedCurlHandle = ScopedObjectCompileTimeVoidT<CURL*, CurlHandlePool::releaseHandle>;
+
+	ScopedCurlHandle curlHandle(CurlHandlePool::get().acquire());
 
 	if (!curlHandle.isValid())
 	{
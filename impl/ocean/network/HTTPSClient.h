@@ -9,6 +9,7 @@
 #define FACEBOOK_NETWORK_HTTPS_CLIENT_H
 
 #include "ocean/network/Network.h"
+#include "ocean/network/CacheValidators.h"
 #include "ocean/network/Port.h"
 
 #include "ocean/base/Callback.h"
@@ -39,6 +40,16 @@ class OCEAN_NETWORK_EXPORT HTTPSClient
 		 */
 		using ProgressCallback = Callback<void, size_t, size_t>;
 
+		/**
+		 * Definition of a pair combining the success state of a request with the response data.
+		 */
+		using Response = std::pair<bool, Buffer>;
+
+		/**
+		 * Definition of a vector holding responses.
+		 */
+		using Responses = std::vector<Response>;
+
 	protected:
 
 		/**
@@ -46,6 +57,11 @@ class OCEAN_NETWORK_EXPORT HTTPSClient
 		 */
 		class CurlSessionData;
 
+		/**
+		 * Forward declaration.
+		 */
+		class CurlHandlePool;
+
 	public:
 
 		/**
@@ -61,6 +77,34 @@ class OCEAN_NETWORK_EXPORT HTTPSClient
 		 */
 		static bool httpsGetRequest(const std::string& url, Buffer& data, const Port& port = Port(443, Port::TYPE_READABLE), const double timeout = 5.0, bool* abort = nullptr, const ProgressCallback& progressCallback = ProgressCallback(), const std::string& caCertificates = std::string());
 
+		/**
+		 * Function to execute a conditional HTTPS GET request for a resource which has been received before.
+		 * On platforms without support for conditional requests, the resource is requested unconditionally.
+		 * @param url The URL of the HTTPS site which is requested, beginning with "HTTPS://"
+		 * @param validators The validators of the known resource, invalid validators to request the resource unconditionally
+		 * @param data The resulting response data, empty if the resource has not been modified
+		 * @param notModified The resulting flag, true if the server confirmed that the known resource is still valid
+		 * @param responseValidators The resulting validators of the response
+		 * @param port The port of the HTTPS server
+		 * @param timeout The timeout this function waits for the server's response, with range (0, infinity)
+		 * @param caCertificates Optional path to a file containing a list of trusted CA certificates, in PEM format; otherwise, the default trusted CA certificates will be used
+		 * @return True, if succeeded
+		 */
+		static bool httpsConditionalGetRequest(const std::string& url, const CacheValidators& validators, Buffer& data, bool& notModified, CacheValidators& responseValidators, const Port& port = Port(443, Port::TYPE_READABLE), const double timeout = 5.0, const std::string& caCertificates = std::string());
+
+		/**
+		 * Function to execute several HTTPS GET requests concurrently.
+		 * The requests share persistent connections per host, the function returns when all requests are handled.<br>
+		 * On platforms without concurrent implementation, the requests are executed one after another.
+		 * @param urls The URLs of the HTTPS sites which are requested, each beginning with "HTTPS://"
+		 * @param responses The resulting responses, one for each URL
+		 * @param port The port of the HTTPS servers
+		 * @param timeout The timeout each request waits for the server's response, with range (0, infinity)
+		 * @param caCertificates Optional path to a file containing a list of trusted CA certificates, in PEM format; otherwise, the default trusted CA certificates will be used
+		 * @return True, if all requests succeeded
+		 */
+		static bool httpsGetRequests(const Strings& urls, Responses& responses, const Port& port = Port(443, Port::TYPE_READABLE), const double timeout = 5.0, const std::string& caCertificates = std::string());
+
 		/**
 		 * Function to executes a HTTPS POST (site/file upload) request.
 		 * @param url The URL of the HTTPS site which is requested, beginning with "HTTPS://"
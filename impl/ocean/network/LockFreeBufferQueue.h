@@ -0,0 +1,372 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#ifndef FACEBOOK_NETWORK_LOCK_FREE_BUFFER_QUEUE_H
+#define FACEBOOK_NETWORK_LOCK_FREE_BUFFER_QUEUE_H
+
+#include "ocean/network/Network.h"
+
+#include "ocean/base/Signal.h"
+#include "ocean/base/Timestamp.h"
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+namespace Ocean
+{
+
+namespace Network
+{
+
+/**
+ * This class implements a bounded lock-free buffer queue for several producers and one consumer.
+ * The queue is a ring of slots, each slot owns a buffer which is recycled for all following messages, so that the queue does not allocate memory once the buffers have reached the size of the largest message.<br>
+ * Producers never block, push() fails if the queue is full.<br>
+ * The consumer can wait for new buffers, the waiting consumer is woken up by the producers via a signal and does not poll.<br>
+ * Any thread can push, while only one thread at a time is allowed to pop.
+ * @see BufferQueue.
+ * @ingroup network
+ */
+class LockFreeBufferQueue
+{
+	public:
+
+		/**
+		 * Definition of a vector holding bytes.
+		 */
+		using Buffer = std::vector<uint8_t>;
+
+	protected:
+
+		/**
+		 * This class implements one slot of the ring.
+		 */
+		class alignas(64) Slot
+		{
+			public:
+
+				/// The sequence number of this slot, determining whether the slot can be written or read.
+				std::atomic<size_t> sequence_ = 0;
+
+				/// The buffer of this slot, recycled for all messages.
+				Buffer buffer_;
+		};
+
+	public:
+
+		/**
+		 * Creates a new queue.
+		 * @param capacity The maximal number of buffers in the queue, will be rounded up to a power of two, with range [2, infinity)
+		 */
+		explicit inline LockFreeBufferQueue(const size_t capacity = 1024);
+
+		/**
+		 * Pushes a new buffer to the queue, the data is copied into the recycled buffer of the next slot.
+		 * This function can be called from any thread.
+		 * @param data The data to push, can be nullptr if 'size == 0'
+		 * @param size The number of bytes to copy, with range [0, infinity)
+		 * @return True, if succeeded; False, if the queue is full
+		 */
+		inline bool push(const void* data, const size_t size);
+
+		/**
+		 * Pushes a new buffer to the queue, the buffer is swapped with the recycled buffer of the next slot.
+		 * This function can be called from any thread.
+		 * @param buffer The buffer to push, must not be empty, receives the recycled buffer if succeeded
+		 * @return True, if succeeded; False, if the queue is full
+		 */
+		inline bool push(Buffer&& buffer);
+
+		/**
+		 * Pops a buffer from the queue without waiting.
+		 * The buffer of the caller is swapped with the buffer of the slot, providing the memory of the caller's buffer to following messages.<br>
+		 * This function must be called from the consumer thread only.
+		 * @param buffer The resulting buffer
+		 * @return True, if a buffer was available
+		 */
+		inline bool pop(Buffer& buffer);
+
+		/**
+		 * Pops a buffer from the queue and waits for a new buffer if the queue is empty.
+		 * This function must be called from the consumer thread only.
+		 * @param buffer The resulting buffer
+		 * @param timeout The maximal time to wait for a new buffer, in seconds, with range [0, infinity)
+		 * @return True, if a buffer was available within the specified time
+		 */
+		inline bool pop(Buffer& buffer, const double timeout);
+
+		/**
+		 * Returns the number of buffers in this queue.
+		 * The number is a snapshot only if producers or the consumer are active concurrently.
+		 * @return The number of buffers
+		 */
+		inline size_t size() const;
+
+		/**
+		 * Returns whether this queue holds no buffers.
+		 * @return True, if so
+		 */
+		inline bool isEmpty() const;
+
+		/**
+		 * Returns the capacity of this queue.
+		 * @return The maximal number of buffers
+		 */
+		inline size_t capacity() const;
+
+	protected:
+
+		/**
+		 * Claims the next free slot for a producer.
+		 * @param position The resulting position of the slot
+		 * @return The claimed slot, nullptr if the queue is full
+		 */
+		inline Slot* claimSlot(size_t& position);
+
+		/**
+		 * Publishes a claimed slot and wakes up a waiting consumer.
+		 * @param slot The slot to publish
+		 * @param position The position of the slot
+		 */
+		inline void publishSlot(Slot& slot, const size_t position);
+
+		/**
+		 * Disabled copy constructor.
+		 */
+		LockFreeBufferQueue(const LockFreeBufferQueue&) = delete;
+
+		/**
+		 * Disabled copy operator.
+		 * @return Reference to this object
+		 */
+		LockFreeBufferQueue& operator=(const LockFreeBufferQueue&) = delete;
+
+	protected:
+
+		/// The slots of the ring.
+		std::unique_ptr<Slot[]> slots_;
+
+		/// The bit mask translating positions into slot indices.
+		size_t mask_ = 0;
+
+		/// The position of the next slot to be written by a producer.
+		alignas(64) std::atomic<size_t> enqueuePosition_ = 0;
+
+		/// The position of the next slot to be read by the consumer.
+		alignas(64) std::atomic<size_t> dequeuePosition_ = 0;
+
+		/// True, if the consumer is waiting for a new buffer.
+		std::atomic<bool> consumerWaiting_ = false;
+
+		/// The signal waking up the consumer.
+		Signal signal_;
+};
+
+inline LockFreeBufferQueue::LockFreeBufferQueue(const size_t capacity)
+{
+	ocean_assert(capacity >= 2);
+
+	size_t ringSize = 2;
+	while (ringSize < capacity)
+	{
+		ringSize *= 2;
+	}
+
+	slots_ = std::make_unique<Slot[]>(ringSize);
+	mask_ = ringSize - 1;
+
+	for (size_t n = 0; n < ringSize; ++n)
+	{
+		slots_[n].sequence_.store(n, std::memory_order_relaxed);
+	}
+}
+
+inline bool LockFreeBufferQueue::push(const void* data, const size_t size)
+{
+	if (size == 0)
+	{
+		return true;
+	}
+
+	ocean_assert(data != nullptr);
+
+	size_t position = 0;
+	Slot* slot = claimSlot(position);
+
+	if (slot == nullptr)
+	{
+		return false;
+	}
+
+	// resizing the recycled buffer does not allocate memory as long as the buffer has been large enough before
+	slot->buffer_.resize(size);
+	memcpy(slot->buffer_.data(), data, size);
+
+	publishSlot(*slot, position);
+
+	return true;
+}
+
+inline bool LockFreeBufferQueue::push(Buffer&& buffer)
+{
+	ocean_assert(!buffer.empty());
+	if (buffer.empty())
+	{
+		return true;
+	}
+
+	size_t position = 0;
+	Slot* slot = claimSlot(position);
+
+	if (slot == nullptr)
+	{
+		return false;
+	}
+
+	std::swap(slot->buffer_, buffer);
+
+	publishSlot(*slot, position);
+
+	return true;
+}
+
+inline bool LockFreeBufferQueue::pop(Buffer& buffer)
+{
+	const size_t position = dequeuePosition_.load(std::memory_order_relaxed);
+
+	Slot& slot = slots_[position & mask_];
+
+	if (slot.sequence_.load(std::memory_order_acquire) != position + 1)
+	{
+		// the slot has not yet been published
+		return false;
+	}
+
+	std::swap(buffer, slot.buffer_);
+
+	// the slot can be written again once the producers have wrapped around the ring
+	slot.sequence_.store(position + mask_ + 1, std::memory_order_release);
+
+	dequeuePosition_.store(position + 1, std::memory_order_relaxed);
+
+	return true;
+}
+
+inline bool LockFreeBufferQueue::pop(Buffer& buffer, const double timeout)
+{
+	ocean_assert(timeout >= 0.0);
+
+	if (pop(buffer))
+	{
+		return true;
+	}
+
+	const Timestamp startTimestamp(true);
+
+	while (true)
+	{
+		consumerWaiting_.store(true, std::memory_order_relaxed);
+
+		// the fence pairs with the fence in publishSlot(), so that either the producer sees the waiting consumer, or the consumer sees the new buffer
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+
+		if (pop(buffer))
+		{
+			consumerWaiting_.store(false, std::memory_order_relaxed);
+			return true;
+		}
+
+		const double remainingTime = timeout - double(Timestamp(true) - startTimestamp);
+
+		if (remainingTime <= 0.0)
+		{
+			consumerWaiting_.store(false, std::memory_order_relaxed);
+			return false;
+		}
+
+		// the signal may have been pulsed for a buffer which has been popped already, so that we check the queue again after waking up
+
+		signal_.wait((unsigned int)(remainingTime * 1000.0 + 0.5) + 1u);
+
+		consumerWaiting_.store(false, std::memory_order_relaxed);
+
+		if (pop(buffer))
+		{
+			return true;
+		}
+	}
+}
+
+inline size_t LockFreeBufferQueue::size() const
+{
+	const size_t dequeuePosition = dequeuePosition_.load(std::memory_order_relaxed);
+	const size_t enqueuePosition = enqueuePosition_.load(std::memory_order_relaxed);
+
+	return enqueuePosition > dequeuePosition ? enqueuePosition - dequeuePosition : 0;
+}
+
+inline bool LockFreeBufferQueue::isEmpty() const
+{
+	return size() == 0;
+}
+
+inline size_t LockFreeBufferQueue::capacity() const
+{
+	return mask_ + 1;
+}
+
+inline LockFreeBufferQueue::Slot* LockFreeBufferQueue::claimSlot(size_t& position)
+{
+	position = enqueuePosition_.load(std::memory_order_relaxed);
+
+	while (true)
+	{
+		Slot& slot = slots_[position & mask_];
+
+		const size_t sequence = slot.sequence_.load(std::memory_order_acquire);
+
+		if (sequence == position)
+		{
+			// the slot is free, we try to claim it
+
+			if (enqueuePosition_.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+			{
+				return &slot;
+			}
+
+			// another producer was faster, 'position' has been updated
+		}
+		else if (sequence < position)
+		{
+			// the slot still holds a buffer which has not been popped, the queue is full
+			return nullptr;
+		}
+		else
+		{
+			position = enqueuePosition_.load(std::memory_order_relaxed);
+		}
+	}
+}
+
+inline void LockFreeBufferQueue::publishSlot(Slot& slot, const size_t position)
+{
+	slot.sequence_.store(position + 1, std::memory_order_release);
+
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+
+	if (consumerWaiting_.load(std::memory_order_relaxed))
+	{
+		signal_.pulse();
+	}
+}
+
+}
+
+}
+
+#endif // FACEBOOK_NETWORK_LOCK_FREE_BUFFER_QUEUE_H
@@ -7,9 +7,6 @@
 
 #include "ocean/network/MessageQueue.h"
 
-#include "ocean/base/Thread.h"
-#include "ocean/base/Timestamp.h"
-
 namespace Ocean
 {
 
@@ -58,6 +55,10 @@ bool MessageQueue::push(const Id id, const std::string& message, const std::stri
 	ocean_assert(iMessage != messageMap_.end());
 
 	iMessage->second.emplace(message, value);
+
+	// the waiting threads may wait for different message ids
+	messageCondition_.notify_all();
+
 	return true;
 }
 
@@ -85,37 +86,25 @@ bool MessageQueue::front(const Id id, std::string& message, std::string& value,
 
 bool MessageQueue::front(const Id id, const double timeout, std::string& message, std::string& value, const bool popMessage)
 {
-	TemporaryScopedLock temporaryScopedLock(lock_);
-
-	MessageMap::iterator iMessage = messageMap_.find(id);
-
-	if (iMessage == messageMap_.end() || iMessage->second.empty())
-	{
-		temporaryScopedLock.release();
+	ocean_assert(timeout >= 0.0);
 
-		const Timestamp startTimestamp(true);
+	const ScopedLock scopedLock(lock_);
 
-		while (true)
-		{
-			if (startTimestamp.hasTimePassed(timeout))
-			{
-				Log::warning() << "Timeout in message queue.";
-				return false;
-			}
+	MessageMap::iterator iMessage = messageMap_.end();
 
-			temporaryScopedLock.relock(lock_);
+	const auto hasMessage = [this, id, &iMessage]()
+	{
+		iMessage = messageMap_.find(id);
 
-			iMessage = messageMap_.find(id);
-			if (iMessage != messageMap_.end() && iMessage->second.empty() == false)
-			{
-				break;
-			}
+		return iMessage != messageMap_.end() && !iMessage->second.empty();
+	};
 
-			// we have to give other thread the chance to insert a message
-			temporaryScopedLock.release();
+	// the condition releases the lock while waiting, and acquires the lock again before checking for the message
 
-			Thread::sleep(1);
-		}
+	if (!hasMessage() && !messageCondition_.wait_for(lock_, std::chrono::duration<double>(max(0.0, timeout)), hasMessage))
+	{
+		Log::warning() << "Timeout in message queue.";
+		return false;
 	}
 
 	ocean_assert(iMessage != messageMap_.end() && iMessage->second.empty() == false);
@@ -12,6 +12,7 @@
 
 #include "ocean/base/Lock.h"
 
+#include <condition_variable>
 #include <queue>
 
 namespace Ocean
@@ -179,6 +180,9 @@ class OCEAN_NETWORK_EXPORT MessageQueue
 
 		/// Map lock.
 		Lock lock_;
+
+		/// The condition notifying waiting threads about new messages.
+		std::condition_variable_any messageCondition_;
 };
 
 constexpr MessageQueue::Id MessageQueue::invalidId()
@@ -37,12 +37,21 @@ PackagedConnectionlessClient::~PackagedConnectionlessClient()
 
 PackagedConnectionlessClient::SocketResult PackagedConnectionlessClient::send(const Address4& address, const Port& port, const void* data, const size_t size)
 {
+	const Recipient recipient(address, port);
+
+	return send(&recipient, 1, data, size);
+}
+
+PackagedConnectionlessClient::SocketResult PackagedConnectionlessClient::send(const Recipient* recipients, const size_t numberRecipients, const void* data, const size_t size)
+{
+	ocean_assert(recipients != nullptr && numberRecipients >= 1);
+
 	if (size == 0)
 	{
 		return SR_SUCCEEDED;
 	}
 
-	if (data == nullptr)
+	if (data == nullptr || recipients == nullptr || numberRecipients == 0)
 	{
 		ocean_assert(false && "Invalid input!");
 		return SR_FAILED;
@@ -58,9 +67,9 @@ PackagedConnectionlessClient::SocketResult PackagedConnectionlessClient::send(co
 	ocean_assert(maximalPackageSize_ != 0);
 	ocean_assert(packageManagmentHeaderSize() < maximalPackageSize_);
 
-	if (clientPackageBuffer_.size() != maximalPackageSize_)
+	if (clientPackageBuffer_.size() != packageManagmentHeaderSize() * sendBatchSize_)
 	{
-		clientPackageBuffer_.resize(maximalPackageSize_);
+		clientPackageBuffer_.resize(packageManagmentHeaderSize() * sendBatchSize_);
 	}
 
 	if (clientPackageBuffer_.empty() || socketId_ == invalidSocketId())
@@ -70,11 +79,6 @@ PackagedConnectionlessClient::SocketResult PackagedConnectionlessClient::send(co
 
 	const size_t maximalPayloadSize = maximalPackageSize_ - packageManagmentHeaderSize();
 
-	sockaddr_in receiver = {};
-	receiver.sin_family = AF_INET;
-	receiver.sin_addr.s_addr = address;
-	receiver.sin_port = port;
-
 	const MessageId messageId =  ++messageCounter_;
 
 	unsigned int packageIndex = 0u;
@@ -87,64 +91,88 @@ PackagedConnectionlessClient::SocketResult PackagedConnectionlessClient::send(co
 
 	while (pendingBytes != 0)
 	{
-		ocean_assert(packageIndex < totalPackages);
+		// we prepare a batch of packages, each package is sent to all recipients
 
-		const unsigned int headerValues[5] =
+		clientDatagrams_.clear();
+
+		for (size_t nPackage = 0; nPackage < sendBatchSize_ && pendingBytes != 0; ++nPackage)
 		{
-			Data::toBigEndian((unsigned int)(messageId)),
-			Data::toBigEndian((unsigned int)(size)),
-			Data::toBigEndian((unsigned int)(dataStartPosition)),
-			Data::toBigEndian((unsigned int)(packageIndex)),
-			Data::toBigEndian((unsigned int)(totalPackages))
-		};
+			ocean_assert(packageIndex < totalPackages);
+
+			const unsigned int headerValues[5] =
+			{
+				Data::toBigEndian((unsigned int)(messageId)),
+				Data::toBigEndian((unsigned int)(size)),
+				Data::toBigEndian((unsigned int)(dataStartPosition)),
+				Data::toBigEndian((unsigned int)(packageIndex)),
+				Data::toBigEndian((unsigned int)(totalPackages))
+			};
+
+			// only the header is written into the package buffer, the payload is sent directly from the caller's memory
+
+			uint8_t* const header = clientPackageBuffer_.data() + nPackage * packageManagmentHeaderSize();
+
+			static_assert(sizeof(headerValues) == packageManagmentHeaderSize(), "Header size mismatch");
+			memcpy(header, headerValues, sizeof(headerValues));
 
-		static_assert(sizeof(headerValues) == packageManagmentHeaderSize(), "Header size mismatch");
-		memcpy(clientPackageBuffer_.data(), headerValues, sizeof(headerValues));
+			const size_t packageDataSize = min(maximalPayloadSize, pendingBytes);
 
-		const size_t packageDataSize = min(maximalPayloadSize, pendingBytes);
-		memcpy(clientPackageBuffer_.data() + packageManagmentHeaderSize(), data8, packageDataSize);
+			for (size_t nRecipient = 0; nRecipient < numberRecipients; ++nRecipient)
+			{
+				clientDatagrams_.emplace_back(recipients[nRecipient].first, recipients[nRecipient].second, header, packageManagmentHeaderSize(), data8, packageDataSize);
+			}
+
+			packageIndex++;
 
-		const int sendSize = int(packageDataSize + packageManagmentHeaderSize());
+			ocean_assert(pendingBytes >= packageDataSize);
+			pendingBytes -= packageDataSize;
+			data8 += packageDataSize;
+			dataStartPosition += packageDataSize;
+		}
 
 		// Retry on EAGAIN/EWOULDBLOCK (send buffer full on non-blocking socket)
 		constexpr unsigned int maxRetries = 100u;
 
-		bool sendSucceeded = false;
+		unsigned int retry = 0u;
+		size_t sentDatagrams = 0;
 
-		for (unsigned int retry = 0u; retry < maxRetries; ++retry)
+		while (sentDatagrams < clientDatagrams_.size())
 		{
-			const int result = sendto(socketId_, (const char*)(clientPackageBuffer_.data()), sendSize, 0, (sockaddr*)&receiver, sizeof(receiver));
+			const size_t sent = DatagramBatch::send(socketId_, clientDatagrams_.data() + sentDatagrams, clientDatagrams_.size() - sentDatagrams);
 
-			if (result == sendSize)
+			if (sent != 0)
 			{
-				sendSucceeded = true;
-				break;
+				sentDatagrams += sent;
+				retry = 0u;
+
+				continue;
 			}
 
-			if (errno == EAGAIN || errno == EWOULDBLOCK)
+			if ((errno == EAGAIN || errno == EWOULDBLOCK) && ++retry < maxRetries)
 			{
 				// Send buffer is full, wait briefly and retry
+				statistics_.addSendRetry();
+
 				Thread::sleep(1u);
 				continue;
 			}
 
-			break;
+			Log::debug() << "PackagedConnectionlessClient: Failed to send packages of message " << messageId << " with " << totalPackages << " packages, errno: " << errno;
+			return SR_FAILED;
 		}
 
-		if (!sendSucceeded)
+		size_t sentBytes = 0;
+
+		for (const DatagramBatch::Datagram& datagram : clientDatagrams_)
 		{
-			Log::debug() << "PackagedConnectionlessClient: Failed to send package " << packageIndex << "/" << totalPackages << ", size: " << sendSize << " bytes, errno: " << errno;
-			return SR_FAILED;
+			sentBytes += datagram.headerSize() + datagram.size();
 		}
 
-		packageIndex++;
-
-		ocean_assert(pendingBytes >= packageDataSize);
-		pendingBytes -= packageDataSize;
-		data8 += packageDataSize;
-		dataStartPosition += packageDataSize;
+		statistics_.addSentBytes(sentBytes);
 	}
 
+	statistics_.addSentMessages(numberRecipients);
+
 	return SR_SUCCEEDED;
 }
 
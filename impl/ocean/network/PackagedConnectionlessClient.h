@@ -11,6 +11,7 @@
 #include "ocean/network/Network.h"
 #include "ocean/network/Address4.h"
 #include "ocean/network/Client.h"
+#include "ocean/network/DatagramBatch.h"
 #include "ocean/network/PackagedSocket.h"
 #include "ocean/network/Port.h"
 
@@ -29,6 +30,18 @@ class OCEAN_NETWORK_EXPORT PackagedConnectionlessClient :
 	virtual public Client,
 	virtual public PackagedSocket
 {
+	public:
+
+		/**
+		 * Definition of a pair combining the address and port of a recipient.
+		 */
+		using Recipient = std::pair<Address4, Port>;
+
+		/**
+		 * Definition of a vector holding recipients.
+		 */
+		using Recipients = std::vector<Recipient>;
+
 	public:
 
 		/**
@@ -50,6 +63,16 @@ class OCEAN_NETWORK_EXPORT PackagedConnectionlessClient :
 		 */
 		inline SocketResult send(const Address4& address, const Port& port, const std::string& message);
 
+		/**
+		 * Sends the same data to several recipients.
+		 * The packages of the message are sent in batches, one batch for all recipients, so that e.g., a sample can be streamed to many subscribers with few system calls.
+		 * @param recipients The recipients of the data, at least one
+		 * @param data The data to send, can be nullptr if 'size == 0'
+		 * @param size The size of the data to send in bytes, with range [0, infinity)
+		 * @return SR_SUCCEEDED, if succeeded
+		 */
+		inline SocketResult send(const Recipients& recipients, const void* data, const size_t size);
+
 		/**
 		 * Returns the maximal size of a single package for this client.
 		 * @return Maximal package size in bytes.
@@ -68,6 +91,16 @@ class OCEAN_NETWORK_EXPORT PackagedConnectionlessClient :
 		 */
 		~PackagedConnectionlessClient() override;
 
+		/**
+		 * Sends the same data to several recipients.
+		 * @param recipients The recipients of the data, must be valid
+		 * @param numberRecipients The number of recipients, with range [1, infinity)
+		 * @param data The data to send, can be nullptr if 'size == 0'
+		 * @param size The size of the data to send in bytes, with range [0, infinity)
+		 * @return SR_SUCCEEDED, if succeeded
+		 */
+		SocketResult send(const Recipient* recipients, const size_t numberRecipients, const void* data, const size_t size);
+
 	protected:
 
 		/// Client message counter.
@@ -76,8 +109,14 @@ class OCEAN_NETWORK_EXPORT PackagedConnectionlessClient :
 		/// Maximal package size of this connectionless socket (including the header).
 		size_t maximalPackageSize_ = 0;
 
-		/// Intermediate buffer storing individual parts of a large message.
+		/// Intermediate buffer storing the headers of a batch of individual packages of a large message, the payload is not copied.
 		Buffer clientPackageBuffer_;
+
+		/// The datagrams of the current batch, pointing into the header buffer and into the payload of the message.
+		DatagramBatch::Datagrams clientDatagrams_;
+
+		/// The number of packages which are prepared and sent as one batch.
+		static constexpr size_t sendBatchSize_ = 32;
 };
 
 inline PackagedConnectionlessClient::SocketResult PackagedConnectionlessClient::send(const Address4& address, const Port& port, const std::string& message)
@@ -86,6 +125,16 @@ inline PackagedConnectionlessClient::SocketResult PackagedConnectionlessClient::
 	return send(address, port, message.c_str(), message.length() + 1);
 }
 
+inline PackagedConnectionlessClient::SocketResult PackagedConnectionlessClient::send(const Recipients& recipients, const void* data, const size_t size)
+{
+	if (recipients.empty())
+	{
+		return SR_FAILED;
+	}
+
+	return send(recipients.data(), recipients.size(), data, size);
+}
+
 inline size_t PackagedConnectionlessClient::maximalPackageSize() const
 {
 	return maximalPackageSize_;
@@ -32,43 +32,41 @@ bool PackagedConnectionlessServer::onScheduler()
 	ocean_assert(maximalPackageSize_ != 0);
 	ocean_assert(packageManagmentHeaderSize() < maximalPackageSize_);
 
-	if (packageBuffer_.size() != maximalPackageSize_)
+	if (receiveBuffers_.bufferSize() != maximalPackageSize_)
 	{
-		packageBuffer_.resize(maximalPackageSize_);
+		receiveBuffers_ = DatagramBatch::ReceiveBuffers(receiveBatchSize_, maximalPackageSize_);
 	}
 
-	if (packageBuffer_.empty() || !receiveCallback_ || !schedulerIsActive_ || socketId_ == invalidSocketId())
+	if (!receiveBuffers_.isValid() || !receiveCallback_ || !schedulerIsActive_ || socketId_ == invalidSocketId())
 	{
 		return false;
 	}
 
-	sockaddr_in senderAddress = {};
-#if defined(OCEAN_POSIX_AVAILABLE)
-	socklen_t senderAddressSize = sizeof(senderAddress);
-#else
-	int senderAddressSize = sizeof(senderAddress);
-#endif
-
 	bool busy = false;
 
-	while (true)
+	while (DatagramBatch::receive(socketId_, receiveBuffers_, receivedDatagrams_) != 0)
 	{
-		int size = int(recvfrom(socketId_, (char*)(packageBuffer_.data()), (int)(packageBuffer_.size()), 0, (sockaddr*)&senderAddress, &senderAddressSize));
-
-		if (size <= 0)
-		{
-			break;
-		}
-
 		busy = true;
 
 		const Timestamp currentTimestamp(true);
 
-		if ((unsigned int)(size) > packageManagmentHeaderSize())
+		receiveTicks_ = HighPerformanceTimer::ticks();
+
+		for (const DatagramBatch::Datagram& datagram : receivedDatagrams_)
 		{
+			statistics_.addReceivedBytes(datagram.size());
+
+			if (datagram.size() <= packageManagmentHeaderSize())
+			{
+				statistics_.addDroppedMessage();
+				continue;
+			}
+
+			const uint8_t* const package = (const uint8_t*)(datagram.data());
+
 			unsigned int headerValues[5];
 			static_assert(sizeof(headerValues) == packageManagmentHeaderSize(), "Header size mismatch");
-			memcpy(headerValues, packageBuffer_.data(), sizeof(headerValues));
+			memcpy(headerValues, package, sizeof(headerValues));
 
 			const MessageId messageId = Data::fromBigEndian(headerValues[0]);
 			const unsigned int messageSize = Data::fromBigEndian(headerValues[1]);
@@ -78,7 +76,7 @@ bool PackagedConnectionlessServer::onScheduler()
 
 			OCEAN_SUPPRESS_UNUSED_WARNING(packageIndex);
 
-			const Triple messageTriple(Address4(senderAddress.sin_addr.s_addr), Port(senderAddress.sin_port), messageId);
+			const Triple messageTriple(datagram.address(), datagram.port(), messageId);
 
 			MessageMap::iterator i = connectionlessServerMessageMap.find(messageTriple);
 			if (i == connectionlessServerMessageMap.end())
@@ -86,13 +84,15 @@ bool PackagedConnectionlessServer::onScheduler()
 				i = connectionlessServerMessageMap.insert(std::make_pair(messageTriple, MessageData(Timestamp(false), size_t(messageSize), totalPackages))).first;
 			}
 
-			const size_t payloadSize = size - packageManagmentHeaderSize();
-			ocean_assert(payloadSize < packageBuffer_.size());
+			const size_t payloadSize = datagram.size() - packageManagmentHeaderSize();
+			ocean_assert(payloadSize < receiveBuffers_.bufferSize());
 
 			if (dataStartPosition + payloadSize > i->second.size())
 			{
 				connectionlessServerMessageMap.erase(i);
 
+				statistics_.addDroppedMessage();
+
 				if (receiveCallback_)
 				{
 					receiveCallback_(messageTriple.address(), messageTriple.port(), nullptr, 0, messageTriple.messageId());
@@ -100,7 +100,7 @@ bool PackagedConnectionlessServer::onScheduler()
 			}
 			else
 			{
-				memcpy(i->second.buffer() + dataStartPosition, packageBuffer_.data() + packageManagmentHeaderSize(), payloadSize);
+				memcpy(i->second.buffer() + dataStartPosition, package + packageManagmentHeaderSize(), payloadSize);
 				i->second.setRetireTimestamp(Timestamp(currentTimestamp + maximalMessageTime_));
 
 				ocean_assert(i->second.remainingPackages() >= 1u);
@@ -108,7 +108,14 @@ bool PackagedConnectionlessServer::onScheduler()
 
 				if (i->second.remainingPackages() == 0u)
 				{
-					receiveCallback_(i->first.address(), i->first.port(), i->second.buffer(), i->second.size(), i->first.messageId());
+					statistics_.addReceivedMessages();
+
+					{
+						const SocketStatistics::ScopedCallback scopedCallback(statistics_, receiveTicks_);
+
+						receiveCallback_(i->first.address(), i->first.port(), i->second.buffer(), i->second.size(), i->first.messageId());
+					}
+
 					connectionlessServerMessageMap.erase(i);
 				}
 			}
@@ -118,6 +125,9 @@ bool PackagedConnectionlessServer::onScheduler()
 		{
 			if (i->second.retireTimestamp() < currentTimestamp)
 			{
+				// the message is incomplete, at least one package has been lost
+				statistics_.addDroppedMessage();
+
 				i = connectionlessServerMessageMap.erase(i);
 			}
 			else
@@ -130,6 +140,16 @@ bool PackagedConnectionlessServer::onScheduler()
 	return busy;
 }
 
+void PackagedConnectionlessServer::onSchedulerSocketIds(SocketIds& socketIds) const
+{
+	const ScopedLock scopedLock(lock_);
+
+	if (receiveCallback_ && schedulerIsActive_ && socketId_ != invalidSocketId())
+	{
+		socketIds.emplace_back(socketId_);
+	}
+}
+
 }
 
 }
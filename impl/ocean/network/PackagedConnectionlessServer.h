@@ -226,6 +226,12 @@ class OCEAN_NETWORK_EXPORT PackagedConnectionlessServer :
 		 */
 		bool onScheduler() override;
 
+		/**
+		 * Returns the socket id of this server while the server is active.
+		 * @see Socket::onSchedulerSocketIds().
+		 */
+		void onSchedulerSocketIds(SocketIds& socketIds) const override;
+
 	protected:
 
 		/// Data callback function called on new message arrivals.
@@ -234,8 +240,14 @@ class OCEAN_NETWORK_EXPORT PackagedConnectionlessServer :
 		/// The time between the first package of a large message and the decision to retire the message if still packages are missing, in seconds.
 		double maximalMessageTime_ = 5.0;
 
-		/// Intermediate buffer storing individual parts of a large message.
-		Buffer packageBuffer_;
+		/// The pool of buffers receiving a batch of packages with one system call, each buffer has the maximal package size.
+		DatagramBatch::ReceiveBuffers receiveBuffers_;
+
+		/// The packages of the most recent batch, pointing into the pool.
+		DatagramBatch::Datagrams receivedDatagrams_;
+
+		/// The number of packages which are received with one system call.
+		static constexpr size_t receiveBatchSize_ = 32;
 
 		/// The map holding all partially received message.
 		MessageMap connectionlessServerMessageMap;
@@ -43,6 +43,117 @@ void PackagedSocket::MemoryBlock::resize(const size_t size)
 	}
 }
 
+PackagedSocket::ChunkReceiver::ChunkReceiver(const size_t maximalChunkSize) :
+	maximalChunkSize_(maximalChunkSize)
+{
+	ocean_assert(maximalChunkSize_ >= 1);
+}
+
+size_t PackagedSocket::ChunkReceiver::receive(const void* data, const size_t size, const ChunkFunction& chunkFunction, size_t& completedMessages)
+{
+	ocean_assert(data != nullptr && size >= 1);
+	ocean_assert(chunkFunction);
+
+	completedMessages = 0;
+
+	size_t invalidHeaders = 0;
+
+	const uint8_t* data8 = (const uint8_t*)(data);
+	size_t remainingBytes = size;
+
+	while (remainingBytes != 0)
+	{
+		if (messageSize_ == 0)
+		{
+			// we are receiving the header of the next message
+
+			if (headerMemory_.size() == 0)
+			{
+				headerMemory_.resize(sizeof(PackageHeader));
+			}
+
+			const size_t headerBytes = std::min(remainingBytes, headerMemory_.remainingBytes());
+
+			memcpy(headerMemory_.offsetData(), data8, headerBytes);
+			headerMemory_.moveOffset(headerBytes);
+
+			data8 += headerBytes;
+			remainingBytes -= headerBytes;
+
+			if (headerMemory_.remainingBytes() != 0)
+			{
+				break;
+			}
+
+			PackageHeader packageHeader;
+			memcpy(&packageHeader, headerMemory_.data(), sizeof(PackageHeader));
+
+			headerMemory_.resize(0);
+
+			if (packageHeader.isValid() && packageHeader.size() <= maximalPackagedMessageSize())
+			{
+				messageSize_ = packageHeader.size();
+				messageOffset_ = 0;
+
+				chunkBuffer_.clear();
+				chunkBuffer_.reserve(std::min(maximalChunkSize_, messageSize_));
+			}
+			else
+			{
+				++invalidHeaders;
+			}
+
+			continue;
+		}
+
+		ocean_assert(messageOffset_ < messageSize_);
+
+		const size_t chunkSize = std::min(maximalChunkSize_, messageSize_ - messageOffset_);
+		ocean_assert(chunkBuffer_.size() < chunkSize);
+
+		if (chunkBuffer_.empty() && remainingBytes >= chunkSize)
+		{
+			// the received data contains the entire chunk, no need to copy the data
+
+			chunkFunction(data8, chunkSize, messageOffset_, messageSize_);
+
+			data8 += chunkSize;
+			remainingBytes -= chunkSize;
+		}
+		else
+		{
+			const size_t chunkBytes = std::min(remainingBytes, chunkSize - chunkBuffer_.size());
+
+			chunkBuffer_.insert(chunkBuffer_.end(), data8, data8 + chunkBytes);
+
+			data8 += chunkBytes;
+			remainingBytes -= chunkBytes;
+
+			if (chunkBuffer_.size() != chunkSize)
+			{
+				ocean_assert(remainingBytes == 0);
+				break;
+			}
+
+			chunkFunction(chunkBuffer_.data(), chunkSize, messageOffset_, messageSize_);
+
+			chunkBuffer_.clear();
+		}
+
+		messageOffset_ += chunkSize;
+
+		if (messageOffset_ == messageSize_)
+		{
+			messageSize_ = 0;
+			messageOffset_ = 0;
+
+			++completedMessages;
+		}
+	}
+
+	return invalidHeaders;
+}
+
 PackagedSocket::PackagedSocket() :
 	Socket()
 {
@@ -15,6 +15,8 @@
 
 #include "ocean/io/Bitstream.h"
 
+#include <functional>
+#include <memory>
 #include <queue>
 
 namespace Ocean
@@ -184,6 +186,64 @@ class OCEAN_NETWORK_EXPORT PackagedSocket : virtual public Socket
 
 		static_assert(sizeof(PackageHeader) == sizeof(uint64_t) * 3, "Invalid header!");
 
+		/**
+		 * This class implements the reception of packaged messages which are delivered in chunks instead of being reassembled.
+		 * The chunks of a message are delivered in order, the memory used for a message is bounded by the maximal chunk size regardless of the size of the message.<br>
+		 * Received data which is large enough for an entire chunk is delivered without copying.
+		 */
+		class OCEAN_NETWORK_EXPORT ChunkReceiver
+		{
+			public:
+
+				/**
+				 * Definition of a function receiving the chunks of messages.
+				 * Parameters are: data of the chunk, size of the chunk in bytes, byte offset of the chunk within the message, size of the entire message in bytes.
+				 * The chunk is the last chunk of the message if 'offset + size == messageSize'.
+				 */
+				using ChunkFunction = std::function<void(const void*, const size_t, const size_t, const size_t)>;
+
+			public:
+
+				/**
+				 * Creates a new chunk receiver.
+				 * @param maximalChunkSize The maximal size of a chunk in bytes, with range [1, infinity)
+				 */
+				explicit ChunkReceiver(const size_t maximalChunkSize);
+
+				/**
+				 * Processes received data and delivers all chunks which are complete.
+				 * A chunk is complete once it has the maximal chunk size, or once the end of the message has been received.
+				 * @param data The received data, must be valid
+				 * @param size The size of the received data in bytes, with range [1, infinity)
+				 * @param chunkFunction The function receiving the chunks
+				 * @param completedMessages The resulting number of messages which have been received entirely
+				 * @return The number of invalid package headers which have been skipped
+				 */
+				size_t receive(const void* data, const size_t size, const ChunkFunction& chunkFunction, size_t& completedMessages);
+
+			protected:
+
+				/// The maximal size of a chunk in bytes.
+				size_t maximalChunkSize_ = 0;
+
+				/// The memory block for the package header.
+				MemoryBlock headerMemory_;
+
+				/// The buffer of the current chunk, used only if the received data is not large enough for an entire chunk.
+				std::vector<uint8_t> chunkBuffer_;
+
+				/// The size of the current message in bytes, 0 while the header is received.
+				size_t messageSize_ = 0;
+
+				/// The number of bytes of the current message which have been delivered.
+				size_t messageOffset_ = 0;
+		};
+
+		/**
+		 * Definition of a unique pointer holding a chunk receiver.
+		 */
+		using UniqueChunkReceiver = std::unique_ptr<ChunkReceiver>;
+
 	public:
 
 		/**
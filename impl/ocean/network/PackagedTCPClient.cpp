@@ -32,8 +32,54 @@ size_t PackagedTCPClient::onSend(const void* data, const size_t size)
 	return TCPClient::onSend(data, size);
 }
 
+void PackagedTCPClient::setChunkReceiveCallback(const ChunkReceiveCallback& callback, const size_t maximalChunkSize)
+{
+	ocean_assert(maximalChunkSize >= 1);
+
+	const ScopedLock scopedLock(lock_);
+
+	chunkReceiveCallback_ = callback;
+
+	if (chunkReceiveCallback_ && maximalChunkSize >= 1)
+	{
+		chunkReceiver_ = std::make_unique<ChunkReceiver>(maximalChunkSize);
+	}
+	else
+	{
+		chunkReceiver_ = nullptr;
+	}
+
+	memoryQueue_ = MemoryBlockQueue();
+	currentMemory_.resize(0);
+	currentPackageHeaderMemory_.resize(0);
+}
+
 void PackagedTCPClient::onReceived(const void* data, const size_t size)
 {
+	if (chunkReceiver_)
+	{
+		const ChunkReceiver::ChunkFunction chunkFunction = [this](const void* chunkData, const size_t chunkSize, const size_t messageOffset, const size_t messageSize)
+		{
+			const SocketStatistics::ScopedCallback scopedCallback(statistics_, receiveTicks_);
+
+			chunkReceiveCallback_(chunkData, chunkSize, messageOffset, messageSize);
+		};
+
+		size_t completedMessages = 0;
+		const size_t invalidHeaders = chunkReceiver_->receive(data, size, chunkFunction, completedMessages);
+
+		for (size_t n = 0; n < invalidHeaders; ++n)
+		{
+			Log::warning() << "Invalid TCP package";
+
+			statistics_.addDroppedMessage();
+		}
+
+		statistics_.addReceivedMessages(completedMessages);
+
+		return;
+	}
+
 	memoryQueue_.emplace(data, size);
 
 	while (!memoryQueue_.empty())
@@ -59,6 +105,8 @@ void PackagedTCPClient::onReceived(const void* data, const size_t size)
 				{
 					Log::warning() << "Invalid TCP package";
 
+					statistics_.addDroppedMessage();
+
 					currentPackageHeaderMemory_.resize(0);
 				}
 			}
@@ -68,8 +116,12 @@ void PackagedTCPClient::onReceived(const void* data, const size_t size)
 		{
 			if (extractNextPackage(memoryQueue_, currentMemory_))
 			{
+				statistics_.addReceivedMessages();
+
 				if (receiveCallback_)
 				{
+					const SocketStatistics::ScopedCallback scopedCallback(statistics_, receiveTicks_);
+
 					receiveCallback_(currentMemory_.data(), currentMemory_.size());
 				}
 
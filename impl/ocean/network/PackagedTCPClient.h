@@ -26,6 +26,14 @@ class OCEAN_NETWORK_EXPORT PackagedTCPClient :
 	virtual public TCPClient,
 	virtual protected PackagedSocket
 {
+	public:
+
+		/**
+		 * Definition of a callback function for the chunks of received messages.
+		 * Parameters are: data of the chunk, size of the chunk in bytes, byte offset of the chunk within the message, size of the entire message in bytes.
+		 */
+		using ChunkReceiveCallback = Callback<void, const void*, const size_t, const size_t, const size_t>;
+
 	public:
 
 		/**
@@ -38,6 +46,16 @@ class OCEAN_NETWORK_EXPORT PackagedTCPClient :
 		 */
 		~PackagedTCPClient() override = default;
 
+		/**
+		 * Sets the callback function for the streamed reception of messages.
+		 * Instead of reassembling an entire message before the receive callback is invoked, the message is delivered in chunks as soon as the data arrives, the receive callback is not invoked anymore.<br>
+		 * The memory needed for the reception is bounded by the maximal chunk size, so that e.g., large maps can be parsed while the transfer is still running.<br>
+		 * The callback should be set before the client is connected, an invalid callback switches back to the reassembly of entire messages.
+		 * @param callback The callback function receiving the chunks of all messages
+		 * @param maximalChunkSize The maximal size of a chunk in bytes, smaller chunks are delivered only for the end of a message, with range [1, infinity)
+		 */
+		void setChunkReceiveCallback(const ChunkReceiveCallback& callback, const size_t maximalChunkSize = 64 * 1024);
+
 	protected:
 
 		/**
@@ -62,6 +80,12 @@ class OCEAN_NETWORK_EXPORT PackagedTCPClient :
 
 		/// The memory block for the package header.
 		MemoryBlock currentPackageHeaderMemory_;
+
+		/// The callback function for the chunks of received messages.
+		ChunkReceiveCallback chunkReceiveCallback_;
+
+		/// The receiver for the streamed reception, nullptr if messages are reassembled.
+		UniqueChunkReceiver chunkReceiver_;
 };
 
 }
@@ -32,10 +32,51 @@ size_t PackagedTCPServer::onSend(const ConnectionId connectionId, const void* da
 	return TCPServer::onSend(connectionId, data, size);
 }
 
+void PackagedTCPServer::setChunkReceiveCallback(const ChunkReceiveCallback& callback, const size_t maximalChunkSize)
+{
+	ocean_assert(maximalChunkSize >= 1);
+
+	const ScopedLock scopedLock(lock_);
+
+	chunkReceiveCallback_ = callback;
+	maximalChunkSize_ = chunkReceiveCallback_ ? maximalChunkSize : 0;
+
+	connectionMemoryMap_.clear();
+}
+
 void PackagedTCPServer::onReceived(const ConnectionId connectionId, const void* data, const size_t size)
 {
 	ConnectionMemory& connectionMemory = connectionMemoryMap_[connectionId];
 
+	if (maximalChunkSize_ != 0)
+	{
+		if (!connectionMemory.chunkReceiver_)
+		{
+			connectionMemory.chunkReceiver_ = std::make_unique<ChunkReceiver>(maximalChunkSize_);
+		}
+
+		const ChunkReceiver::ChunkFunction chunkFunction = [this, connectionId](const void* chunkData, const size_t chunkSize, const size_t messageOffset, const size_t messageSize)
+		{
+			const SocketStatistics::ScopedCallback scopedCallback(statistics_, receiveTicks_);
+
+			chunkReceiveCallback_(connectionId, chunkData, chunkSize, messageOffset, messageSize);
+		};
+
+		size_t completedMessages = 0;
+		const size_t invalidHeaders = connectionMemory.chunkReceiver_->receive(data, size, chunkFunction, completedMessages);
+
+		for (size_t n = 0; n < invalidHeaders; ++n)
+		{
+			Log::warning() << "Invalid TCP package";
+
+			statistics_.addDroppedMessage();
+		}
+
+		statistics_.addReceivedMessages(completedMessages);
+
+		return;
+	}
+
 	MemoryBlockQueue& memoryQueue = connectionMemory.memoryQueue_;
 	MemoryBlock& currentMemory = connectionMemory.currentMemory_;
 	MemoryBlock& currentPackageHeaderMemory = connectionMemory.currentPackageHeaderMemory_;
@@ -65,6 +106,8 @@ void PackagedTCPServer::onReceived(const ConnectionId connectionId, const void*
 				{
 					Log::warning() << "Invalid TCP package";
 
+					statistics_.addDroppedMessage();
+
 					currentPackageHeaderMemory.resize(0);
 				}
 			}
@@ -78,8 +121,12 @@ void PackagedTCPServer::onReceived(const ConnectionId connectionId, const void*
 		{
 			if (extractNextPackage(memoryQueue, currentMemory))
 			{
+				statistics_.addReceivedMessages();
+
 				if (receiveCallback_)
 				{
+					const SocketStatistics::ScopedCallback scopedCallback(statistics_, receiveTicks_);
+
 					receiveCallback_(connectionId, currentMemory.data(), currentMemory.size());
 				}
 
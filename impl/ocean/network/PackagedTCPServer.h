@@ -43,6 +43,9 @@ class OCEAN_NETWORK_EXPORT PackagedTCPServer :
 
 				/// The memory block for the package header.
 				MemoryBlock currentPackageHeaderMemory_;
+
+				/// The receiver for the streamed reception, nullptr if messages are reassembled.
+				UniqueChunkReceiver chunkReceiver_;
 		};
 
 		/**
@@ -50,6 +53,14 @@ class OCEAN_NETWORK_EXPORT PackagedTCPServer :
 		 */
 		using ConnectionMemoryMap = std::unordered_map<ConnectionId, ConnectionMemory>;
 
+	public:
+
+		/**
+		 * Definition of a callback function for the chunks of received messages.
+		 * Parameters are: id of the connection, data of the chunk, size of the chunk in bytes, byte offset of the chunk within the message, size of the entire message in bytes.
+		 */
+		using ChunkReceiveCallback = Callback<void, const ConnectionId, const void*, const size_t, const size_t, const size_t>;
+
 	public:
 
 		/**
@@ -62,6 +73,16 @@ class OCEAN_NETWORK_EXPORT PackagedTCPServer :
 		 */
 		~PackagedTCPServer() override = default;
 
+		/**
+		 * Sets the callback function for the streamed reception of messages.
+		 * Instead of reassembling an entire message before the receive callback is invoked, the message is delivered in chunks as soon as the data arrives, the receive callback is not invoked anymore.<br>
+		 * The memory needed for the reception is bounded by the maximal chunk size for each connection.<br>
+		 * The callback should be set before the server is started, an invalid callback switches back to the reassembly of entire messages.
+		 * @param callback The callback function receiving the chunks of all messages
+		 * @param maximalChunkSize The maximal size of a chunk in bytes, smaller chunks are delivered only for the end of a message, with range [1, infinity)
+		 */
+		void setChunkReceiveCallback(const ChunkReceiveCallback& callback, const size_t maximalChunkSize = 64 * 1024);
+
 	protected:
 
 		/**
@@ -80,6 +101,12 @@ class OCEAN_NETWORK_EXPORT PackagedTCPServer :
 
 		/// The map mapping connection ids to ConnectionMemory objects.
 		ConnectionMemoryMap connectionMemoryMap_;
+
+		/// The callback function for the chunks of received messages.
+		ChunkReceiveCallback chunkReceiveCallback_;
+
+		/// The maximal size of a chunk in bytes, 0 if messages are reassembled.
+		size_t maximalChunkSize_ = 0;
 };
 
 }
@@ -0,0 +1,568 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "ocean/network/ResourceCache.h"
+#include "ocean/network/HTTPClient.h"
+#include "ocean/network/HTTPSClient.h"
+
+#include "ocean/base/String.h"
+#include "ocean/base/Timestamp.h"
+
+#include "ocean/io/Directory.h"
+#include "ocean/io/File.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+
+namespace Ocean
+{
+
+namespace Network
+{
+
+/// The name of the index file inside the cache directory.
+static constexpr const char* resourceCacheIndexName = "index.txt";
+
+/// The first line of the index file, identifying the format version.
+static constexpr const char* resourceCacheIndexVersion = "OceanResourceCache 1";
+
+/// The file extension of payload files.
+static constexpr const char* resourceCacheBlobExtension = "blob";
+
+/// The number of stored or removed resources after which the index is written.
+static constexpr unsigned int resourceCacheIndexWriteInterval = 32u;
+
+ResourceCache::ResourceCache(const std::string& directory, const uint64_t maximalSize, const double defaultMaximalAge) :
+	maximalSize_(maximalSize),
+	defaultMaximalAge_(defaultMaximalAge)
+{
+	ocean_assert(!directory.empty());
+	ocean_assert(maximalSize_ >= 1ull);
+	ocean_assert(defaultMaximalAge_ >= 0.0);
+
+	const IO::Directory cacheDirectory(directory);
+
+	if (!cacheDirectory.isValid())
+	{
+		return;
+	}
+
+	if (!cacheDirectory.exists() && !cacheDirectory.create())
+	{
+		Log::warning() << "ResourceCache: Failed to create the cache directory '" << cacheDirectory() << "'";
+		return;
+	}
+
+	directory_ = cacheDirectory();
+	isValid_ = true;
+
+	readIndex();
+}
+
+ResourceCache::~ResourceCache()
+{
+	flush();
+}
+
+bool ResourceCache::request(const std::string& url, Resource& resource, const double timeout)
+{
+	ocean_assert(!url.empty() && timeout > 0.0);
+
+	resource = Resource();
+
+	if (lookup(url, resource) && resource.isFresh())
+	{
+		return true;
+	}
+
+	const std::string lowerUrl(String::toLower(url.substr(0, 8)));
+
+	HTTPClient::Buffer data;
+	bool notModified = false;
+	CacheValidators responseValidators;
+
+	bool succeeded = false;
+
+	if (lowerUrl.find("https://") == 0)
+	{
+		succeeded = HTTPSClient::httpsConditionalGetRequest(url, resource.validators(), data, notModified, responseValidators, Port(443, Port::TYPE_READABLE), timeout);
+	}
+	else if (lowerUrl.find("http://") == 0)
+	{
+		succeeded = HTTPClient::httpConditionalGetRequest(url, resource.validators(), data, notModified, responseValidators, Port(80, Port::TYPE_READABLE), timeout);
+	}
+	else
+	{
+		ocean_assert(false && "Invalid URL!");
+		return false;
+	}
+
+	if (!succeeded)
+	{
+		// a stale resource is better than no resource, e.g., when the device is offline
+		return resource.isValid();
+	}
+
+	if (notModified)
+	{
+		if (resource.isValid() && refresh(url, responseValidators))
+		{
+			return lookup(url, resource);
+		}
+
+		return false;
+	}
+
+	if (data.empty())
+	{
+		return false;
+	}
+
+	if (!store(url, data.data(), data.size(), responseValidators))
+	{
+		return false;
+	}
+
+	return lookup(url, resource);
+}
+
+bool ResourceCache::lookup(const std::string& url, Resource& resource)
+{
+	const ScopedLock scopedLock(lock_);
+
+	const EntryMap::iterator iEntry = entryMap_.find(url);
+
+	if (iEntry == entryMap_.cend())
+	{
+		return false;
+	}
+
+	Entry& entry = iEntry->second;
+
+	std::shared_ptr<IO::MemoryMappedFile> mappedFile = std::make_shared<IO::MemoryMappedFile>(blobFilename(entry.blob_));
+
+	if (!mappedFile->isValid() || mappedFile->size() != entry.size_)
+	{
+		// the payload file has been removed or modified outside of the cache
+
+		removeEntry(iEntry);
+		return false;
+	}
+
+	const double now = double(Timestamp(true));
+
+	entry.lastAccess_ = now;
+	indexModified_ = true;
+
+	resource.mappedFile_ = std::move(mappedFile);
+	resource.validators_ = entry.validators_;
+	resource.isFresh_ = now < entry.expiration_;
+
+	return true;
+}
+
+bool ResourceCache::store(const std::string& url, const void* data, const size_t size, const CacheValidators& validators)
+{
+	ocean_assert(!url.empty());
+	ocean_assert(data != nullptr && size != 0);
+
+	if (url.empty() || data == nullptr || size == 0 || uint64_t(size) > maximalSize_ || !isValid_)
+	{
+		return false;
+	}
+
+	// URLs and validators are stored in a tab-separated index
+	if (url.find_first_of("\t\r\n") != std::string::npos || validators.entityTag().find_first_of("\t\r\n") != std::string::npos || validators.lastModified().find_first_of("\t\r\n") != std::string::npos)
+	{
+		return false;
+	}
+
+	const std::string blob = blobName(data, size);
+
+	const ScopedLock scopedLock(lock_);
+
+	const EntryMap::iterator iExistingEntry = entryMap_.find(url);
+
+	if (iExistingEntry != entryMap_.cend() && iExistingEntry->second.blob_ != blob)
+	{
+		removeEntry(iExistingEntry);
+	}
+
+	if (blobReferenceMap_.find(blob) == blobReferenceMap_.cend())
+	{
+		if (size_ + uint64_t(size) > maximalSize_)
+		{
+			// we evict a little more than necessary (the cache is filled to 90% afterwards) to avoid an eviction for each new resource
+
+			const uint64_t targetSize = maximalSize_ / uint64_t(10) * uint64_t(9);
+
+			evict(targetSize > uint64_t(size) ? targetSize - uint64_t(size) : uint64_t(0));
+		}
+
+		const std::string filename = blobFilename(blob);
+		const std::string temporaryFilename = filename + ".tmp";
+
+		{
+			std::ofstream stream(temporaryFilename.c_str(), std::ios::binary | std::ios::trunc);
+			stream.write((const char*)(data), std::streamsize(size));
+
+			if (!stream.good())
+			{
+				stream.close();
+				std::remove(temporaryFilename.c_str());
+
+				return false;
+			}
+		}
+
+		// the payload is moved into place only once it is complete, so that an interrupted write does not leave a corrupt resource
+
+		std::remove(filename.c_str());
+
+		if (std::rename(temporaryFilename.c_str(), filename.c_str()) != 0)
+		{
+			std::remove(temporaryFilename.c_str());
+			return false;
+		}
+
+		blobReferenceMap_[blob] = 0u;
+		size_ += uint64_t(size);
+	}
+
+	Entry& entry = entryMap_[url];
+
+	if (entry.blob_ != blob)
+	{
+		ocean_assert(entry.blob_.empty());
+
+		entry.blob_ = blob;
+		entry.size_ = uint64_t(size);
+
+		++blobReferenceMap_[blob];
+	}
+
+	const double now = double(Timestamp(true));
+
+	entry.lastAccess_ = now;
+	entry.expiration_ = now + (validators.maximalAge() >= 0.0 ? validators.maximalAge() : defaultMaximalAge_);
+	entry.validators_ = validators;
+
+	indexModified_ = true;
+
+	if (++modificationsSinceWrite_ >= resourceCacheIndexWriteInterval)
+	{
+		writeIndex();
+	}
+
+	return true;
+}
+
+bool ResourceCache::refresh(const std::string& url, const CacheValidators& validators)
+{
+	const ScopedLock scopedLock(lock_);
+
+	const EntryMap::iterator iEntry = entryMap_.find(url);
+
+	if (iEntry == entryMap_.cend())
+	{
+		return false;
+	}
+
+	Entry& entry = iEntry->second;
+
+	// a 304 response may contain a subset of the headers only, since the payload is unchanged, known validators are kept
+
+	const std::string& entityTag = validators.entityTag().empty() ? entry.validators_.entityTag() : validators.entityTag();
+	const std::string& lastModified = validators.lastModified().empty() ? entry.validators_.lastModified() : validators.lastModified();
+	const double maximalAge = validators.maximalAge() >= 0.0 ? validators.maximalAge() : entry.validators_.maximalAge();
+
+	entry.validators_ = CacheValidators(entityTag, lastModified, maximalAge);
+
+	const double now = double(Timestamp(true));
+
+	entry.lastAccess_ = now;
+	entry.expiration_ = now + (maximalAge >= 0.0 ? maximalAge : defaultMaximalAge_);
+
+	indexModified_ = true;
+
+	return true;
+}
+
+bool ResourceCache::remove(const std::string& url)
+{
+	const ScopedLock scopedLock(lock_);
+
+	const EntryMap::iterator iEntry = entryMap_.find(url);
+
+	if (iEntry == entryMap_.cend())
+	{
+		return false;
+	}
+
+	removeEntry(iEntry);
+
+	return true;
+}
+
+void ResourceCache::clear()
+{
+	const ScopedLock scopedLock(lock_);
+
+	while (!entryMap_.empty())
+	{
+		removeEntry(entryMap_.begin());
+	}
+
+	ocean_assert(blobReferenceMap_.empty());
+	ocean_assert(size_ == 0ull);
+
+	writeIndex();
+}
+
+bool ResourceCache::flush()
+{
+	const ScopedLock scopedLock(lock_);
+
+	if (!indexModified_)
+	{
+		return true;
+	}
+
+	return writeIndex();
+}
+
+bool ResourceCache::readIndex()
+{
+	ocean_assert(isValid_);
+
+	const ScopedLock scopedLock(lock_);
+
+	std::ifstream stream((directory_ + resourceCacheIndexName).c_str(), std::ios::binary);
+
+	std::string line;
+
+	if (stream.good() && std::getline(stream, line) && line == resourceCacheIndexVersion)
+	{
+		while (std::getline(stream, line))
+		{
+			// url, blob, size, last access, expiration, entity tag, last modified
+
+			std::vector<std::string> fields;
+			fields.reserve(7);
+
+			size_t start = 0;
+
+			while (true)
+			{
+				const size_t end = line.find('\t', start);
+
+				fields.emplace_back(line.substr(start, end == std::string::npos ? std::string::npos : end - start));
+
+				if (end == std::string::npos)
+				{
+					break;
+				}
+
+				start = end + 1;
+			}
+
+			if (fields.size() != 7 || fields[0].empty() || fields[1].empty())
+			{
+				continue;
+			}
+
+			char* endPointer = nullptr;
+
+			const uint64_t size = strtoull(fields[2].c_str(), &endPointer, 10);
+
+			if (endPointer == fields[2].c_str() || size == 0ull)
+			{
+				continue;
+			}
+
+			Entry entry;
+			entry.blob_ = fields[1];
+			entry.size_ = size;
+			entry.lastAccess_ = strtod(fields[3].c_str(), nullptr);
+			entry.expiration_ = strtod(fields[4].c_str(), nullptr);
+			entry.validators_ = CacheValidators(std::move(fields[5]), std::move(fields[6]));
+
+			if (!IO::File(blobFilename(entry.blob_)).exists())
+			{
+				continue;
+			}
+
+			const BlobReferenceMap::iterator iBlob = blobReferenceMap_.find(entry.blob_);
+
+			if (iBlob == blobReferenceMap_.cend())
+			{
+				blobReferenceMap_.emplace(entry.blob_, 1u);
+				size_ += entry.size_;
+			}
+			else
+			{
+				++iBlob->second;
+			}
+
+			entryMap_[fields[0]] = std::move(entry);
+		}
+	}
+
+	// payload files without index entry remain from a crash, or from resources which could not be removed while in use
+
+	const IO::Files blobFiles = IO::Directory(directory_).findFiles(resourceCacheBlobExtension);
+
+	for (const IO::File& blobFile : blobFiles)
+	{
+		if (blobReferenceMap_.find(blobFile.name()) == blobReferenceMap_.cend())
+		{
+			blobFile.remove();
+		}
+	}
+
+	if (size_ > maximalSize_)
+	{
+		evict(maximalSize_ / uint64_t(10) * uint64_t(9));
+	}
+
+	return true;
+}
+
+bool ResourceCache::writeIndex()
+{
+	if (!isValid_)
+	{
+		return false;
+	}
+
+	const std::string filename = directory_ + resourceCacheIndexName;
+	const std::string temporaryFilename = filename + ".tmp";
+
+	{
+		std::ofstream stream(temporaryFilename.c_str(), std::ios::binary | std::ios::trunc);
+
+		stream << resourceCacheIndexVersion << '\n';
+		stream << std::fixed << std::setprecision(3);
+
+		for (const EntryMap::value_type& entryPair : entryMap_)
+		{
+			const Entry& entry = entryPair.second;
+
+			stream << entryPair.first << '\t' << entry.blob_ << '\t' << entry.size_ << '\t' << entry.lastAccess_ << '\t' << entry.expiration_ << '\t' << entry.validators_.entityTag() << '\t' << entry.validators_.lastModified() << '\n';
+		}
+
+		if (!stream.good())
+		{
+			stream.close();
+			std::remove(temporaryFilename.c_str());
+
+			return false;
+		}
+	}
+
+	std::remove(filename.c_str());
+
+	if (std::rename(temporaryFilename.c_str(), filename.c_str()) != 0)
+	{
+		std::remove(temporaryFilename.c_str());
+		return false;
+	}
+
+	indexModified_ = false;
+	modificationsSinceWrite_ = 0u;
+
+	return true;
+}
+
+void ResourceCache::removeEntry(const EntryMap::iterator& iEntry)
+{
+	ocean_assert(iEntry != entryMap_.cend());
+
+	const BlobReferenceMap::iterator iBlob = blobReferenceMap_.find(iEntry->second.blob_);
+	ocean_assert(iBlob != blobReferenceMap_.cend() && iBlob->second >= 1u);
+
+	if (iBlob != blobReferenceMap_.cend() && --iBlob->second == 0u)
+	{
+		ocean_assert(size_ >= iEntry->second.size_);
+		size_ -= iEntry->second.size_;
+
+		// on some platforms the file cannot be removed while it is mapped, the file will be removed when the cache is loaded the next time
+		std::remove(blobFilename(iBlob->first).c_str());
+
+		blobReferenceMap_.erase(iBlob);
+	}
+
+	entryMap_.erase(iEntry);
+
+	indexModified_ = true;
+	++modificationsSinceWrite_;
+}
+
+void ResourceCache::evict(const uint64_t targetSize)
+{
+	if (size_ <= targetSize)
+	{
+		return;
+	}
+
+	std::vector<std::pair<double, std::string>> accessedUrls;
+	accessedUrls.reserve(entryMap_.size());
+
+	for (const EntryMap::value_type& entryPair : entryMap_)
+	{
+		accessedUrls.emplace_back(entryPair.second.lastAccess_, entryPair.first);
+	}
+
+	std::sort(accessedUrls.begin(), accessedUrls.end());
+
+	for (const std::pair<double, std::string>& accessedUrl : accessedUrls)
+	{
+		if (size_ <= targetSize)
+		{
+			break;
+		}
+
+		const EntryMap::iterator iEntry = entryMap_.find(accessedUrl.second);
+		ocean_assert(iEntry != entryMap_.cend());
+
+		removeEntry(iEntry);
+	}
+}
+
+std::string ResourceCache::blobFilename(const std::string& blob) const
+{
+	return directory_ + blob;
+}
+
+std::string ResourceCache::blobName(const void* data, const size_t size)
+{
+	ocean_assert(data != nullptr && size != 0);
+
+	// FNV-1a, the size is part of the name to make collisions even more unlikely
+
+	uint64_t hash = 14695981039346656037ull;
+
+	const uint8_t* const data8 = (const uint8_t*)(data);
+
+	for (size_t n = 0; n < size; ++n)
+	{
+		hash ^= uint64_t(data8[n]);
+		hash *= 1099511628211ull;
+	}
+
+	char name[64];
+	snprintf(name, sizeof(name), "%016llx_%llx.%s", (unsigned long long)(hash), (unsigned long long)(size), resourceCacheBlobExtension);
+
+	return std::string(name);
+}
+
+}
+
+}
@@ -0,0 +1,349 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#ifndef FACEBOOK_NETWORK_RESOURCE_CACHE_H
+#define FACEBOOK_NETWORK_RESOURCE_CACHE_H
+
+#include "ocean/network/Network.h"
+#include "ocean/network/CacheValidators.h"
+
+#include "ocean/base/Lock.h"
+
+#include "ocean/io/MemoryMappedFile.h"
+
+#include <memory>
+#include <unordered_map>
+
+namespace Ocean
+{
+
+namespace Network
+{
+
+/**
+ * This class implements a persistent disk cache for resources downloaded via HTTP or HTTPS, e.g., map tiles or scene assets.
+ * The payloads are stored content-addressed (identical payloads of several URLs are stored once), the cache has a size cap and evicts the least recently used resources.<br>
+ * A resource is used without network round-trip as long as it is fresh (Cache-Control: max-age, or the cache's default age); afterwards the resource is revalidated with a conditional request (ETag/If-Modified-Since).<br>
+ * Cached resources are read via memory-mapped files.<br>
+ * The index of the cache is written to disk with flush() and when the cache is disposed.
+ * @ingroup network
+ */
+class OCEAN_NETWORK_EXPORT ResourceCache
+{
+	public:
+
+		/**
+		 * This class holds a cached resource, the payload is memory-mapped from the cache directory.
+		 */
+		class Resource
+		{
+			friend class ResourceCache;
+
+			public:
+
+				/**
+				 * Creates an invalid resource.
+				 */
+				Resource() = default;
+
+				/**
+				 * Returns the payload of this resource.
+				 * @return The resource's payload, nullptr if invalid
+				 */
+				inline const void* data() const;
+
+				/**
+				 * Returns the size of the payload.
+				 * @return The size in bytes
+				 */
+				inline size_t size() const;
+
+				/**
+				 * Returns the validators of this resource.
+				 * @return The validators as provided by the server
+				 */
+				inline const CacheValidators& validators() const;
+
+				/**
+				 * Returns whether the resource was fresh when it was looked up, so that the resource can be used without revalidation.
+				 * @return True, if so
+				 */
+				inline bool isFresh() const;
+
+				/**
+				 * Returns whether this resource is valid.
+				 * @return True, if so
+				 */
+				inline bool isValid() const;
+
+			protected:
+
+				/// The memory-mapped payload of the resource.
+				std::shared_ptr<IO::MemoryMappedFile> mappedFile_;
+
+				/// The validators of the resource.
+				CacheValidators validators_;
+
+				/// True, if the resource was fresh.
+				bool isFresh_ = false;
+		};
+
+	protected:
+
+		/**
+		 * This class holds the information of one cached URL.
+		 */
+		class Entry
+		{
+			public:
+
+				/// The name of the content-addressed file holding the payload.
+				std::string blob_;
+
+				/// The size of the payload in bytes.
+				uint64_t size_ = 0ull;
+
+				/// The unix timestamp of the last access, in seconds.
+				double lastAccess_ = 0.0;
+
+				/// The unix timestamp until which the resource is fresh, in seconds.
+				double expiration_ = 0.0;
+
+				/// The validators of the resource.
+				CacheValidators validators_;
+		};
+
+		/**
+		 * Definition of a map mapping URLs to entries.
+		 */
+		using EntryMap = std::unordered_map<std::string, Entry>;
+
+		/**
+		 * Definition of a map mapping blob names to the number of entries using the blob.
+		 */
+		using BlobReferenceMap = std::unordered_map<std::string, unsigned int>;
+
+	public:
+
+		/**
+		 * Creates a new cache object and loads the index of an existing cache.
+		 * @param directory The directory of the cache, will be created if it does not exist, must be valid
+		 * @param maximalSize The maximal size of all cached payloads in bytes, with range [1, infinity)
+		 * @param defaultMaximalAge The time a resource is fresh if the server does not specify the age, in seconds, with range [0, infinity)
+		 */
+		explicit ResourceCache(const std::string& directory, const uint64_t maximalSize = 256ull * 1024ull * 1024ull, const double defaultMaximalAge = 24.0 * 3600.0);
+
+		/**
+		 * Destructs the cache object and writes the index.
+		 */
+		~ResourceCache();
+
+		/**
+		 * Returns a resource, either from the cache or from the network.
+		 * Fresh resources are provided without network access, stale resources are revalidated with a conditional request.<br>
+		 * In case the network request fails, a stale resource is provided nevertheless.
+		 * @param url The URL of the resource, beginning with "HTTP://" or "HTTPS://"
+		 * @param resource The resulting resource
+		 * @param timeout The timeout network requests wait for the server's response, with range (0, infinity)
+		 * @return True, if succeeded
+		 */
+		bool request(const std::string& url, Resource& resource, const double timeout = 5.0);
+
+		/**
+		 * Looks up a resource in the cache.
+		 * @param url The URL of the resource
+		 * @param resource The resulting resource
+		 * @return True, if the resource is cached
+		 */
+		bool lookup(const std::string& url, Resource& resource);
+
+		/**
+		 * Stores a resource in the cache, least recently used resources are evicted if necessary.
+		 * @param url The URL of the resource, must be valid
+		 * @param data The payload of the resource, must be valid
+		 * @param size The size of the payload in bytes, with range [1, maximalSize()]
+		 * @param validators The validators of the resource
+		 * @return True, if succeeded
+		 */
+		bool store(const std::string& url, const void* data, const size_t size, const CacheValidators& validators);
+
+		/**
+		 * Marks a cached resource as fresh again after the server confirmed that the resource has not been modified.
+		 * @param url The URL of the resource
+		 * @param validators The validators of the server's response, empty validators keep the known validators
+		 * @return True, if the resource is cached
+		 */
+		bool refresh(const std::string& url, const CacheValidators& validators);
+
+		/**
+		 * Removes a resource from the cache.
+		 * @param url The URL of the resource
+		 * @return True, if the resource was cached
+		 */
+		bool remove(const std::string& url);
+
+		/**
+		 * Removes all resources from the cache.
+		 */
+		void clear();
+
+		/**
+		 * Writes the index of the cache to disk.
+		 * @return True, if succeeded
+		 */
+		bool flush();
+
+		/**
+		 * Returns the size of all cached payloads.
+		 * @return The size in bytes
+		 */
+		inline uint64_t size() const;
+
+		/**
+		 * Returns the maximal size of all cached payloads.
+		 * @return The size in bytes
+		 */
+		inline uint64_t maximalSize() const;
+
+		/**
+		 * Returns whether the cache is valid (whether the cache directory exists).
+		 * @return True, if so
+		 */
+		inline bool isValid() const;
+
+	protected:
+
+		/**
+		 * Disabled copy constructor.
+		 */
+		ResourceCache(const ResourceCache&) = delete;
+
+		/**
+		 * Disabled copy operator.
+		 * @return Reference to this object
+		 */
+		ResourceCache& operator=(const ResourceCache&) = delete;
+
+		/**
+		 * Reads the index of the cache and removes payload files which are not referenced.
+		 * @return True, if succeeded
+		 */
+		bool readIndex();
+
+		/**
+		 * Writes the index of the cache, the lock must be acquired.
+		 * @return True, if succeeded
+		 */
+		bool writeIndex();
+
+		/**
+		 * Removes an entry, the lock must be acquired.
+		 * @param iEntry The entry to remove, must be valid
+		 */
+		void removeEntry(const EntryMap::iterator& iEntry);
+
+		/**
+		 * Evicts least recently used entries until the cache does not exceed a specified size, the lock must be acquired.
+		 * @param targetSize The maximal size of the cache afterwards, in bytes
+		 */
+		void evict(const uint64_t targetSize);
+
+		/**
+		 * Returns the filename of a payload file.
+		 * @param blob The name of the payload file
+		 * @return The filename including the cache directory
+		 */
+		std::string blobFilename(const std::string& blob) const;
+
+		/**
+		 * Returns the content-addressed name of a payload.
+		 * @param data The payload, must be valid
+		 * @param size The size of the payload in bytes, with range [1, infinity)
+		 * @return The name of the payload file
+		 */
+		static std::string blobName(const void* data, const size_t size);
+
+	protected:
+
+		/// The directory of the cache, with ending separator.
+		std::string directory_;
+
+		/// The maximal size of all payloads in bytes.
+		uint64_t maximalSize_ = 0ull;
+
+		/// The time a resource is fresh if the server does not specify the age, in seconds.
+		double defaultMaximalAge_ = 0.0;
+
+		/// The entries of the cache.
+		EntryMap entryMap_;
+
+		/// The number of entries using a payload file.
+		BlobReferenceMap blobReferenceMap_;
+
+		/// The size of all payload files in bytes.
+		uint64_t size_ = 0ull;
+
+		/// True, if the index has been modified since it has been written.
+		bool indexModified_ = false;
+
+		/// The number of stored or removed resources since the index has been written.
+		unsigned int modificationsSinceWrite_ = 0u;
+
+		/// True, if the cache directory exists.
+		bool isValid_ = false;
+
+		/// The lock of the cache.
+		mutable Lock lock_;
+};
+
+inline const void* ResourceCache::Resource::data() const
+{
+	return mappedFile_ ? mappedFile_->constdata() : nullptr;
+}
+
+inline size_t ResourceCache::Resource::size() const
+{
+	return mappedFile_ ? mappedFile_->size() : 0;
+}
+
+inline const CacheValidators& ResourceCache::Resource::validators() const
+{
+	return validators_;
+}
+
+inline bool ResourceCache::Resource::isFresh() const
+{
+	return isFresh_;
+}
+
+inline bool ResourceCache::Resource::isValid() const
+{
+	return mappedFile_ != nullptr;
+}
+
+inline uint64_t ResourceCache::size() const
+{
+	const ScopedLock scopedLock(lock_);
+
+	return size_;
+}
+
+inline uint64_t ResourceCache::maximalSize() const
+{
+	return maximalSize_;
+}
+
+inline bool ResourceCache::isValid() const
+{
+	return isValid_;
+}
+
+}
+
+}
+
+#endif // FACEBOOK_NETWORK_RESOURCE_CACHE_H
@@ -39,6 +39,8 @@ bool Server::start()
 
 	schedulerIsActive_ = true;
 
+	invokeSchedulerUpdate();
+
 	return true;
 }
 
@@ -14,6 +14,11 @@
 #ifndef _WINDOWS
 	#include <fcntl.h>
 	#include <unistd.h>
+	#include <sys/ioctl.h>
+#endif
+
+#if defined(__linux__)
+	#include <linux/sockios.h>
 #endif
 
 namespace Ocean
@@ -143,6 +148,52 @@ bool Socket::setPort(const Port& port)
 	return true;
 }
 
+SocketStatistics::Snapshot Socket::statistics() const
+{
+	SocketStatistics::Snapshot snapshot = statistics_.snapshot();
+
+	const ScopedLock scopedLock(lock_);
+
+	if (socketId_ != invalidSocketId())
+	{
+		snapshot.sendQueueBytes_ = sendQueueBytes(socketId_);
+	}
+
+	return snapshot;
+}
+
+int64_t Socket::sendQueueBytes(const SocketId socketId)
+{
+	ocean_assert(socketId != invalidSocketId());
+
+#if defined(__linux__)
+
+	int bytes = 0;
+
+	if (ioctl(socketId, SIOCOUTQ, &bytes) == 0)
+	{
+		return int64_t(bytes);
+	}
+
+#elif defined(__APPLE__)
+
+	int bytes = 0;
+	socklen_t length = sizeof(bytes);
+
+	if (getsockopt(socketId, SOL_SOCKET, SO_NWRITE, &bytes, &length) == 0)
+	{
+		return int64_t(bytes);
+	}
+
+#else
+
+	OCEAN_SUPPRESS_UNUSED_WARNING(socketId);
+
+#endif
+
+	return -1ll;
+}
+
 bool Socket::setBlockingMode(const SocketId socketId, const bool blocking)
 {
 	ocean_assert(socketId != invalidSocketId());
@@ -238,6 +289,16 @@ bool Socket::onScheduler()
 	return false;
 }
 
+void Socket::onSchedulerSocketIds(SocketIds& /*socketIds*/) const
+{
+	// nothing to do here
+}
+
+void Socket::invokeSchedulerUpdate()
+{
+	SocketScheduler::get().wakeUp();
+}
+
 }
 
 }
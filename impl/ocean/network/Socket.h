@@ -12,6 +12,7 @@
 #include "ocean/network/Address4.h"
 #include "ocean/network/NetworkResource.h"
 #include "ocean/network/Port.h"
+#include "ocean/network/SocketStatistics.h"
 
 #include "ocean/base/Lock.h"
 
@@ -49,6 +50,11 @@ class OCEAN_NETWORK_EXPORT Socket
 
 #endif
 
+		/**
+		 * Definition of a vector holding socket ids.
+		 */
+		using SocketIds = std::vector<SocketId>;
+
 		/**
 		 * Returns an invalid socket id.
 		 * @return Invalid socket id
@@ -123,6 +129,27 @@ class OCEAN_NETWORK_EXPORT Socket
 		 */
 		explicit inline operator bool() const;
 
+		/**
+		 * Returns a snapshot of the statistics of this socket, including the number of bytes currently waiting in the send queue of the operating system.
+		 * Sockets handling several connections (e.g., servers) aggregate the statistics of all connections.
+		 * @return The snapshot of the statistics
+		 * @see resetStatistics().
+		 */
+		SocketStatistics::Snapshot statistics() const;
+
+		/**
+		 * Resets the statistics of this socket.
+		 * @see statistics().
+		 */
+		inline void resetStatistics();
+
+		/**
+		 * Returns the number of bytes waiting in the send queue of the operating system for a socket.
+		 * @param socketId The id of the socket, must be valid
+		 * @return The number of bytes which have not yet been sent (or acknowledged), -1 if unknown or not supported on this platform
+		 */
+		static int64_t sendQueueBytes(const SocketId socketId);
+
 		/**
 		 * Sets the blocking mode of a socket.
 		 * @param socketId The id of the socket for which the mode will be set, must be valid
@@ -171,6 +198,20 @@ class OCEAN_NETWORK_EXPORT Socket
 		 */
 		virtual bool onScheduler();
 
+		/**
+		 * Returns the ids of all sockets for which the scheduler needs to invoke onScheduler() once they are readable.
+		 * The scheduler blocks until at least one of the provided sockets is readable (or has been closed by the peer), so that a socket only needs to provide ids while onScheduler() would handle them.<br>
+		 * The default implementation does not provide any id.
+		 * @param socketIds The vector to which the ids will be appended
+		 */
+		virtual void onSchedulerSocketIds(SocketIds& socketIds) const;
+
+		/**
+		 * Informs the scheduler that the ids reported by onSchedulerSocketIds() have changed.
+		 * Otherwise, the scheduler would pick up the changes after its idle timeout only.
+		 */
+		static void invokeSchedulerUpdate();
+
 		/**
 		 * Disabled copy operator.
 		 * @param object The object which would be copied
@@ -188,6 +229,12 @@ class OCEAN_NETWORK_EXPORT Socket
 
 		/// The network resource object.
 		NetworkResource networkResource_;
+
+		/// The statistics of this socket.
+		SocketStatistics statistics_;
+
+		/// The ticks when data has been received most recently, used to measure the latency until the data is delivered.
+		HighPerformanceTimer::Ticks receiveTicks_ = 0;
 };
 
 constexpr Socket::SocketId Socket::invalidSocketId()
@@ -209,6 +256,11 @@ inline Socket::operator bool() const
 	return socketId_ != invalidSocketId();
 }
 
+inline void Socket::resetStatistics()
+{
+	statistics_.reset();
+}
+
 }
 
 }
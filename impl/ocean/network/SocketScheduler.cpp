@@ -10,6 +10,10 @@
 
 #include "ocean/base/Timestamp.h"
 
+#ifndef _WINDOWS
+	#include <unistd.h>
+#endif
+
 namespace Ocean
 {
 
@@ -19,12 +23,18 @@ namespace Network
 SocketScheduler::SocketScheduler() :
 	Thread("SocketScheduler thread")
 {
+	if (!createWakeUpSocket())
+	{
+		Log::warning() << "SocketScheduler: Failed to create the wake up socket, the scheduler will poll the sockets periodically";
+	}
+
 	startThread();
 }
 
 SocketScheduler::~SocketScheduler()
 {
 	stopThread();
+	wakeUp();
 
 	ocean_assert(activeSockets_.empty());
 	ocean_assert(unregisterSockets_.empty());
@@ -36,17 +46,26 @@ SocketScheduler::~SocketScheduler()
 	}
 
 	ocean_assert(!isThreadActive());
+
+	if (wakeUpSocketId_ != Socket::invalidSocketId())
+	{
+		closeSocket(wakeUpSocketId_);
+		wakeUpSocketId_ = Socket::invalidSocketId();
+	}
 }
 
 void SocketScheduler::registerSocket(Socket& socket)
 {
-	const ScopedLock scopedLock(lock_);
-	registerSockets_.insert(&socket);
+	TemporaryScopedLock scopedLock(lock_);
+		registerSockets_.insert(&socket);
+	scopedLock.release();
+
+	wakeUp();
 }
 
 void SocketScheduler::unregisterSocket(Socket& socket)
 {
-	const ScopedLock scopedLock(lock_);
+	TemporaryScopedLock scopedLock(lock_);
 
 	// as the thread starts immediately in the constructor we can expect all sockets to be unregistered if the thread is not active anymore
 	if (!isThreadInvokedToStart() && !isThreadActive())
@@ -64,6 +83,11 @@ void SocketScheduler::unregisterSocket(Socket& socket)
 					|| (registerSockets_.find(&socket) != registerSockets_.end() && activeSockets_.find(&socket) == activeSockets_.end()));
 
 	unregisterSockets_.insert(&socket);
+
+	scopedLock.release();
+
+	// the caller is waiting until the socket has been unregistered, so the scheduler must not wait for the idle timeout
+	wakeUp();
 }
 
 bool SocketScheduler::isSocketUnregistered(Socket& socket) const
@@ -87,22 +111,35 @@ bool SocketScheduler::isSocketUnregistered(Socket& socket) const
 	return unregisterSockets_.find(&socket) == unregisterSockets_.end();
 }
 
-void SocketScheduler::threadRun()
+void SocketScheduler::wakeUp()
 {
-	while (!shouldThreadStop())
+	if (wakeUpSocketId_ == Socket::invalidSocketId())
 	{
-		TemporaryScopedLock firstTemporaryLock(lock_);
-			const SocketSet activeSockets(activeSockets_);
-		firstTemporaryLock.release();
+		return;
+	}
 
-		bool busy = false;
+	// if the socket's buffer is full, the scheduler will wake up anyway
 
-		for (SocketSet::const_iterator i = activeSockets.begin(); i != activeSockets.end(); ++i)
-		{
-			busy = (*i)->onScheduler() || busy;
-		}
+	const uint8_t value = 1u;
+	::send(wakeUpSocketId_, (const char*)(&value), 1, 0);
+}
 
-		TemporaryScopedLock secondTemporaryLock(lock_);
+void SocketScheduler::threadRun()
+{
+	Sockets sockets;
+	Socket::SocketIds socketIds;
+
+	PollDescriptors pollDescriptors;
+
+	// the socket to which each poll descriptor belongs, nullptr for the wake up socket
+	Sockets pollDescriptorSockets;
+
+	// without wake up socket, register requests and stop requests would not be noticed while waiting, so that we wait 1ms only
+	const int timeout = wakeUpSocketId_ != Socket::invalidSocketId() ? idleTimeout_ : 1;
+
+	while (!shouldThreadStop())
+	{
+		TemporaryScopedLock temporaryLock(lock_);
 
 			for (SocketSet::const_iterator i = registerSockets_.begin(); i != registerSockets_.end(); ++i)
 			{
@@ -118,14 +155,171 @@ void SocketScheduler::threadRun()
 			}
 			unregisterSockets_.clear();
 
-		secondTemporaryLock.release();
+			sockets.assign(activeSockets_.cbegin(), activeSockets_.cend());
+
+		temporaryLock.release();
+
+		pollDescriptors.clear();
+		pollDescriptorSockets.clear();
 
-		// we sleep the thread only if we are not busy
-		if (!busy)
+		if (wakeUpSocketId_ != Socket::invalidSocketId())
 		{
-			sleep(1);
+			PollDescriptor pollDescriptor = {};
+			pollDescriptor.fd = wakeUpSocketId_;
+			pollDescriptor.events = POLLIN;
+
+			pollDescriptors.emplace_back(pollDescriptor);
+			pollDescriptorSockets.emplace_back(nullptr);
 		}
+
+		for (Socket* socket : sockets)
+		{
+			ocean_assert(socket != nullptr);
+
+			socketIds.clear();
+			socket->onSchedulerSocketIds(socketIds);
+
+			for (const Socket::SocketId socketId : socketIds)
+			{
+				ocean_assert(socketId != Socket::invalidSocketId());
+
+				PollDescriptor pollDescriptor = {};
+				pollDescriptor.fd = socketId;
+				pollDescriptor.events = POLLIN;
+
+				pollDescriptors.emplace_back(pollDescriptor);
+				pollDescriptorSockets.emplace_back(socket);
+			}
+		}
+
+		ocean_assert(pollDescriptors.size() == pollDescriptorSockets.size());
+
+		if (pollDescriptors.empty())
+		{
+			sleep((unsigned int)(timeout));
+			continue;
+		}
+
+#ifdef _WINDOWS
+		const int result = WSAPoll(pollDescriptors.data(), ULONG(pollDescriptors.size()), timeout);
+#else
+		const int result = poll(pollDescriptors.data(), nfds_t(pollDescriptors.size()), timeout);
+#endif
+
+		if (result <= 0)
+		{
+			if (result < 0)
+			{
+				// e.g., an interrupted call, or (on Windows) a socket which has been closed in the meantime, the socket ids will be determined again
+
+				sleep(1u);
+			}
+
+			continue;
+		}
+
+		const HighPerformanceTimer::Ticks pollTicks = HighPerformanceTimer::ticks();
+
+		bool hasEvents = false;
+		bool busy = false;
+
+		Socket* previousSocket = nullptr;
+
+		for (size_t n = 0; n < pollDescriptors.size(); ++n)
+		{
+			if (pollDescriptors[n].revents == 0)
+			{
+				continue;
+			}
+
+			Socket* socket = pollDescriptorSockets[n];
+
+			if (socket == nullptr)
+			{
+				drainWakeUpSocket();
+				continue;
+			}
+
+			// the ids of a socket are consecutive, so that each socket is invoked once, regardless of the number of ready ids
+			if (socket != previousSocket)
+			{
+				// the delay between the socket becoming readable and the socket being handled, e.g., due to other sockets handled before
+				socket->statistics_.addSchedulerDelay(HighPerformanceTimer::ticks2seconds(HighPerformanceTimer::ticks() - pollTicks));
+
+				busy = socket->onScheduler() || busy;
+
+				previousSocket = socket;
+				hasEvents = true;
+			}
+		}
+
+		// sockets with events which have not been handled (e.g., errors or sockets which are about to be closed) would be reported again immediately
+		if (hasEvents && !busy)
+		{
+			sleep(1u);
+		}
+	}
+}
+
+bool SocketScheduler::createWakeUpSocket()
+{
+	ocean_assert(wakeUpSocketId_ == Socket::invalidSocketId());
+
+	const Socket::SocketId socketId = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+
+	if (socketId == Socket::invalidSocketId())
+	{
+		return false;
 	}
+
+	sockaddr_in address = {};
+	address.sin_family = AF_INET;
+	address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+	address.sin_port = 0;
+
+#if defined(OCEAN_POSIX_AVAILABLE)
+	socklen_t length = sizeof(address);
+#else
+	int length = sizeof(address);
+#endif
+
+	// the socket is bound to an arbitrary loopback port and connected to itself
+
+	if (bind(socketId, (const sockaddr*)(&address), sizeof(address)) != 0
+			|| getsockname(socketId, (sockaddr*)(&address), &length) != 0
+			|| connect(socketId, (const sockaddr*)(&address), sizeof(address)) != 0
+			|| !Socket::setBlockingMode(socketId, false))
+	{
+		closeSocket(socketId);
+		return false;
+	}
+
+	wakeUpSocketId_ = socketId;
+
+	return true;
+}
+
+void SocketScheduler::drainWakeUpSocket()
+{
+	ocean_assert(wakeUpSocketId_ != Socket::invalidSocketId());
+
+	uint8_t buffer[64];
+
+	while (::recv(wakeUpSocketId_, (char*)(buffer), int(sizeof(buffer)), 0) > 0)
+	{
+		// nothing to do here
+	}
+}
+
+void SocketScheduler::closeSocket(const Socket::SocketId socketId)
+{
+	ocean_assert(socketId != Socket::invalidSocketId());
+
+#ifdef _WINDOWS
+	closesocket(socketId);
+#else
+	close(socketId);
+#endif
 }
 
 }
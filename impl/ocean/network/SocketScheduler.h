@@ -9,21 +9,29 @@
 #define FACEBOOK_NETWORK_SOCKET_SCHEDULER_H
 
 #include "ocean/network/Network.h"
+#include "ocean/network/NetworkResource.h"
+#include "ocean/network/Socket.h"
 
 #include "ocean/base/Singleton.h"
 #include "ocean/base/Thread.h"
 
+#ifdef _WINDOWS
+	#include <winsock2.h>
+#else
+	#include <poll.h>
+#endif
+
 namespace Ocean
 {
 
 namespace Network
 {
 
-// Forward declaration.
-class Socket;
-
 /**
  * This class implements a high performance scheduler for socket events.
+ * The scheduler is readiness-based: the thread blocks in poll() (WSAPoll() on Windows) until at least one of the sockets reported by Socket::onSchedulerSocketIds() is readable.<br>
+ * Only sockets with pending data are serviced via Socket::onScheduler(), an idle scheduler does not use any CPU time.<br>
+ * Sockets are watched for readability only, as sending is done synchronously by the individual sockets.
  * @ingroup network
  */
 class OCEAN_NETWORK_EXPORT SocketScheduler :
@@ -40,6 +48,38 @@ class OCEAN_NETWORK_EXPORT SocketScheduler :
 		 */
 		using SocketSet = std::unordered_set<Socket*>;
 
+		/**
+		 * Definition of a vector holding socket pointers.
+		 */
+		using Sockets = std::vector<Socket*>;
+
+#ifdef _WINDOWS
+
+		/**
+		 * Definition of a poll descriptor.
+		 */
+		using PollDescriptor = WSAPOLLFD;
+
+#else
+
+		/**
+		 * Definition of a poll descriptor.
+		 */
+		using PollDescriptor = pollfd;
+
+#endif
+
+		/**
+		 * Definition of a vector holding poll descriptors.
+		 */
+		using PollDescriptors = std::vector<PollDescriptor>;
+
+		/**
+		 * The maximal time the scheduler blocks without any socket event, in milliseconds.
+		 * The timeout ensures that changed socket ids are picked up even if a socket did not invoke Socket::invokeSchedulerUpdate().
+		 */
+		static constexpr int idleTimeout_ = 50;
+
 	protected:
 
 		/**
@@ -72,13 +112,39 @@ class OCEAN_NETWORK_EXPORT SocketScheduler :
 		 */
 		bool isSocketUnregistered(Socket& socket) const;
 
+		/**
+		 * Wakes up the scheduler thread if the thread is currently waiting for socket events.
+		 * This function can be called from any thread.
+		 */
+		void wakeUp();
+
 		/**
 		 * The internal run function.
 		 */
 		void threadRun() override;
 
+		/**
+		 * Creates the loopback socket which is used to wake up the scheduler thread.
+		 * @return True, if succeeded
+		 */
+		bool createWakeUpSocket();
+
+		/**
+		 * Reads all pending data from the wake up socket.
+		 */
+		void drainWakeUpSocket();
+
+		/**
+		 * Closes a socket.
+		 * @param socketId The id of the socket to close
+		 */
+		static void closeSocket(const Socket::SocketId socketId);
+
 	protected:
 
+		/// The network resource object, ensuring that the wake up socket can be used.
+		NetworkResource networkResource_;
+
 		/// The active sockets of this scheduler.
 		SocketSet activeSockets_;
 
@@ -88,6 +154,9 @@ class OCEAN_NETWORK_EXPORT SocketScheduler :
 		/// The set of sockets which are requested to be unregistered.
 		SocketSet unregisterSockets_;
 
+		/// The UDP socket connected to itself which is used to wake up the scheduler thread, invalid if the socket could not be created.
+		Socket::SocketId wakeUpSocketId_ = Socket::invalidSocketId();
+
 		/// The lock of this scheduler.
 		mutable Lock lock_;
 };
@@ -0,0 +1,230 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "ocean/network/SocketStatistics.h"
+
+#include <cmath>
+
+namespace Ocean
+{
+
+namespace Network
+{
+
+double SocketStatistics::Snapshot::sentBytesPerSecond(const Snapshot& previous) const
+{
+	ocean_assert(timestamp_.isValid() && previous.timestamp_.isValid());
+
+	const double duration = double(timestamp_ - previous.timestamp_);
+
+	if (duration <= 0.0 || sentBytes_ < previous.sentBytes_)
+	{
+		return 0.0;
+	}
+
+	return double(sentBytes_ - previous.sentBytes_) / duration;
+}
+
+double SocketStatistics::Snapshot::receivedBytesPerSecond(const Snapshot& previous) const
+{
+	ocean_assert(timestamp_.isValid() && previous.timestamp_.isValid());
+
+	const double duration = double(timestamp_ - previous.timestamp_);
+
+	if (duration <= 0.0 || receivedBytes_ < previous.receivedBytes_)
+	{
+		return 0.0;
+	}
+
+	return double(receivedBytes_ - previous.receivedBytes_) / duration;
+}
+
+void SocketStatistics::Snapshot::exportToTrace(const std::string& name, const Snapshot* previous) const
+{
+	ocean_assert(!name.empty());
+
+	HighPerformanceBenchmark& benchmark = HighPerformanceBenchmark::get();
+
+	if (!benchmark.isTracing())
+	{
+		return;
+	}
+
+	benchmark.addTraceCounter(name + "::sentBytes", double(sentBytes_));
+	benchmark.addTraceCounter(name + "::receivedBytes", double(receivedBytes_));
+	benchmark.addTraceCounter(name + "::sendRetries", double(sendRetries_));
+	benchmark.addTraceCounter(name + "::droppedMessages", double(droppedMessages_));
+
+	if (sendQueueBytes_ >= 0ll)
+	{
+		benchmark.addTraceCounter(name + "::sendQueueBytes", double(sendQueueBytes_));
+	}
+
+	if (previous != nullptr)
+	{
+		benchmark.addTraceCounter(name + "::sentBytesPerSecond", sentBytesPerSecond(*previous));
+		benchmark.addTraceCounter(name + "::receivedBytesPerSecond", receivedBytesPerSecond(*previous));
+	}
+
+	// the median latencies in milliseconds
+
+	if (latencyMeasurements(schedulerDelayBins_) != 0ull)
+	{
+		benchmark.addTraceCounter(name + "::schedulerDelayMs", latencyPercentile(schedulerDelayBins_, 0.5) * 1000.0);
+	}
+
+	if (latencyMeasurements(deliveryLatencyBins_) != 0ull)
+	{
+		benchmark.addTraceCounter(name + "::deliveryLatencyMs", latencyPercentile(deliveryLatencyBins_, 0.5) * 1000.0);
+	}
+
+	if (latencyMeasurements(callbackDurationBins_) != 0ull)
+	{
+		benchmark.addTraceCounter(name + "::callbackDurationMs", latencyPercentile(callbackDurationBins_, 0.5) * 1000.0);
+	}
+}
+
+double SocketStatistics::Snapshot::latencyPercentile(const LatencyBins& latencyBins, const double percentile)
+{
+	ocean_assert(percentile >= 0.0 && percentile <= 1.0);
+
+	const uint64_t measurements = latencyMeasurements(latencyBins);
+
+	if (measurements == 0ull)
+	{
+		return 0.0;
+	}
+
+	const uint64_t threshold = std::max(uint64_t(1), uint64_t(std::ceil(double(measurements) * std::clamp(percentile, 0.0, 1.0))));
+
+	uint64_t sum = 0ull;
+
+	for (size_t n = 0; n < latencyBins.size(); ++n)
+	{
+		sum += latencyBins[n];
+
+		if (sum >= threshold)
+		{
+			// the upper bound of bin n is 2^n microseconds
+			return double(uint64_t(1) << n) * 0.000001;
+		}
+	}
+
+	ocean_assert(false && "This should never happen!");
+	return double(uint64_t(1) << (latencyBins.size() - 1)) * 0.000001;
+}
+
+uint64_t SocketStatistics::Snapshot::latencyMeasurements(const LatencyBins& latencyBins)
+{
+	uint64_t measurements = 0ull;
+
+	for (const uint64_t value : latencyBins)
+	{
+		measurements += value;
+	}
+
+	return measurements;
+}
+
+SocketStatistics::SocketStatistics() :
+	sentBytes_(0ull),
+	receivedBytes_(0ull),
+	sentMessages_(0ull),
+	receivedMessages_(0ull),
+	sendRetries_(0ull),
+	droppedMessages_(0ull)
+{
+	for (size_t n = 0; n < numberLatencyBins_; ++n)
+	{
+		schedulerDelayBins_[n].store(0ull, std::memory_order_relaxed);
+		deliveryLatencyBins_[n].store(0ull, std::memory_order_relaxed);
+		callbackDurationBins_[n].store(0ull, std::memory_order_relaxed);
+	}
+}
+
+SocketStatistics::Snapshot SocketStatistics::snapshot() const
+{
+	Snapshot snapshot;
+
+	snapshot.timestamp_.toNow();
+
+	snapshot.sentBytes_ = sentBytes_.load(std::memory_order_relaxed);
+	snapshot.receivedBytes_ = receivedBytes_.load(std::memory_order_relaxed);
+	snapshot.sentMessages_ = sentMessages_.load(std::memory_order_relaxed);
+	snapshot.receivedMessages_ = receivedMessages_.load(std::memory_order_relaxed);
+	snapshot.sendRetries_ = sendRetries_.load(std::memory_order_relaxed);
+	snapshot.droppedMessages_ = droppedMessages_.load(std::memory_order_relaxed);
+
+	snapshot.schedulerDelayBins_ = copyBins(schedulerDelayBins_);
+	snapshot.deliveryLatencyBins_ = copyBins(deliveryLatencyBins_);
+	snapshot.callbackDurationBins_ = copyBins(callbackDurationBins_);
+
+	return snapshot;
+}
+
+void SocketStatistics::reset()
+{
+	sentBytes_.store(0ull, std::memory_order_relaxed);
+	receivedBytes_.store(0ull, std::memory_order_relaxed);
+	sentMessages_.store(0ull, std::memory_order_relaxed);
+	receivedMessages_.store(0ull, std::memory_order_relaxed);
+	sendRetries_.store(0ull, std::memory_order_relaxed);
+	droppedMessages_.store(0ull, std::memory_order_relaxed);
+
+	for (size_t n = 0; n < numberLatencyBins_; ++n)
+	{
+		schedulerDelayBins_[n].store(0ull, std::memory_order_relaxed);
+		deliveryLatencyBins_[n].store(0ull, std::memory_order_relaxed);
+		callbackDurationBins_[n].store(0ull, std::memory_order_relaxed);
+	}
+}
+
+unsigned int SocketStatistics::latencyBin(const double seconds)
+{
+	const double microseconds = seconds * 1000000.0;
+
+	if (microseconds < 1.0)
+	{
+		return 0u;
+	}
+
+	if (microseconds >= double(uint64_t(1) << (numberLatencyBins_ - 2)))
+	{
+		return (unsigned int)(numberLatencyBins_ - 1);
+	}
+
+	// bin i holds [2^(i-1), 2^i)
+
+	uint64_t value = uint64_t(microseconds);
+	unsigned int bin = 0u;
+
+	while (value != 0ull)
+	{
+		value >>= 1ull;
+		++bin;
+	}
+
+	ocean_assert(bin >= 1u && bin < (unsigned int)(numberLatencyBins_));
+
+	return bin;
+}
+
+SocketStatistics::LatencyBins SocketStatistics::copyBins(const AtomicLatencyBins& latencyBins)
+{
+	LatencyBins result;
+
+	for (size_t n = 0; n < numberLatencyBins_; ++n)
+	{
+		result[n] = latencyBins[n].load(std::memory_order_relaxed);
+	}
+
+	return result;
+}
+
+}
+
+}
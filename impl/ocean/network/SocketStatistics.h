@@ -0,0 +1,379 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#ifndef FACEBOOK_NETWORK_SOCKET_STATISTICS_H
+#define FACEBOOK_NETWORK_SOCKET_STATISTICS_H
+
+#include "ocean/network/Network.h"
+
+#include "ocean/base/HighPerformanceTimer.h"
+#include "ocean/base/Timestamp.h"
+
+#include <array>
+#include <atomic>
+#include <vector>
+
+namespace Ocean
+{
+
+namespace Network
+{
+
+/**
+ * This class implements lightweight counters and latency histograms of a socket.
+ * All counters can be updated and read concurrently without any lock, updating a counter costs one relaxed atomic operation.<br>
+ * The latencies help to determine which part of the pipeline is responsible for a delay:
+ * <pre>
+ * socket readable --[scheduler delay]--> data received --[delivery latency]--> callback invoked --[callback duration]--> callback returned
+ * </pre>
+ * The scheduler delay is the time the socket scheduler needs until it handles a readable socket, the delivery latency is the time between receiving the data and invoking the callback (e.g., while reassembling a packaged message),
+ * and the callback duration is the time the consumer spends in the callback.
+ * @see Socket::statistics().
+ * @ingroup network
+ */
+class OCEAN_NETWORK_EXPORT SocketStatistics
+{
+	public:
+
+		/**
+		 * The number of bins of each latency histogram.
+		 * Bin 0 holds latencies below 1 microsecond, bin i holds latencies in [2^(i-1), 2^i) microseconds, the last bin holds all larger latencies (above ~0.5 seconds).
+		 */
+		static constexpr size_t numberLatencyBins_ = 21;
+
+		/**
+		 * Definition of the bins of a latency histogram.
+		 */
+		using LatencyBins = std::array<uint64_t, numberLatencyBins_>;
+
+		/**
+		 * This class holds a snapshot of all statistic values.
+		 */
+		class OCEAN_NETWORK_EXPORT Snapshot
+		{
+			public:
+
+				/**
+				 * Returns the number of bytes per second which have been sent between a previous snapshot and this snapshot.
+				 * @param previous The previous snapshot of the same statistics
+				 * @return The number of sent bytes per second, with range [0, infinity)
+				 */
+				double sentBytesPerSecond(const Snapshot& previous) const;
+
+				/**
+				 * Returns the number of bytes per second which have been received between a previous snapshot and this snapshot.
+				 * @param previous The previous snapshot of the same statistics
+				 * @return The number of received bytes per second, with range [0, infinity)
+				 */
+				double receivedBytesPerSecond(const Snapshot& previous) const;
+
+				/**
+				 * Exports the values of this snapshot as counters to the trace of HighPerformanceBenchmark, if tracing is active.
+				 * @param name The name of the socket, used as prefix for all counters, must be valid
+				 * @param previous Optional previous snapshot of the same statistics to export the data rates as well, nullptr otherwise
+				 * @see HighPerformanceBenchmark::addTraceCounter().
+				 */
+				void exportToTrace(const std::string& name, const Snapshot* previous = nullptr) const;
+
+				/**
+				 * Returns an approximated percentile of a latency histogram.
+				 * @param latencyBins The bins of the histogram
+				 * @param percentile The percentile to determine, with range [0, 1]
+				 * @return The upper bound of the bin containing the percentile, in seconds, 0 if the histogram is empty
+				 */
+				static double latencyPercentile(const LatencyBins& latencyBins, const double percentile);
+
+				/**
+				 * Returns the number of measurements in a latency histogram.
+				 * @param latencyBins The bins of the histogram
+				 * @return The number of measurements
+				 */
+				static uint64_t latencyMeasurements(const LatencyBins& latencyBins);
+
+			public:
+
+				/// The timestamp when the snapshot has been taken.
+				Timestamp timestamp_ = Timestamp(false);
+
+				/// The number of bytes which have been sent.
+				uint64_t sentBytes_ = 0ull;
+
+				/// The number of bytes which have been received.
+				uint64_t receivedBytes_ = 0ull;
+
+				/// The number of messages (or datagrams) which have been sent.
+				uint64_t sentMessages_ = 0ull;
+
+				/// The number of messages (or datagrams) which have been received and delivered.
+				uint64_t receivedMessages_ = 0ull;
+
+				/// The number of send attempts which had to be repeated because the data could not be sent at once (e.g., due to a full send buffer).
+				uint64_t sendRetries_ = 0ull;
+
+				/// The number of received messages which have been dropped (e.g., incomplete or corrupted packaged messages).
+				uint64_t droppedMessages_ = 0ull;
+
+				/// The number of bytes waiting in the send queue of the operating system, -1 if unknown.
+				int64_t sendQueueBytes_ = -1ll;
+
+				/// The histogram of the scheduler delays.
+				LatencyBins schedulerDelayBins_ = {};
+
+				/// The histogram of the delivery latencies.
+				LatencyBins deliveryLatencyBins_ = {};
+
+				/// The histogram of the callback durations.
+				LatencyBins callbackDurationBins_ = {};
+		};
+
+		/**
+		 * Definition of a vector holding snapshots.
+		 */
+		using Snapshots = std::vector<Snapshot>;
+
+		/**
+		 * This class measures the delivery latency and the duration of a callback invocation.
+		 */
+		class ScopedCallback
+		{
+			public:
+
+				/**
+				 * Creates a new object and measures the delivery latency.
+				 * @param statistics The statistics to which the measurements will be added
+				 * @param receiveTicks The ticks when the delivered data has been received, 0 if unknown
+				 */
+				inline ScopedCallback(SocketStatistics& statistics, const HighPerformanceTimer::Ticks receiveTicks);
+
+				/**
+				 * Destructs this object and measures the duration of the callback.
+				 */
+				inline ~ScopedCallback();
+
+			protected:
+
+				/**
+				 * Disabled copy constructor.
+				 */
+				ScopedCallback(const ScopedCallback&) = delete;
+
+				/**
+				 * Disabled copy operator.
+				 * @return Reference to this object
+				 */
+				ScopedCallback& operator=(const ScopedCallback&) = delete;
+
+			protected:
+
+				/// The statistics to which the measurements will be added.
+				SocketStatistics& statistics_;
+
+				/// The ticks when the callback has been invoked.
+				HighPerformanceTimer::Ticks startTicks_ = 0;
+		};
+
+	protected:
+
+		/**
+		 * Definition of an atomic latency histogram.
+		 */
+		using AtomicLatencyBins = std::array<std::atomic<uint64_t>, numberLatencyBins_>;
+
+	public:
+
+		/**
+		 * Creates new statistics with all values set to zero.
+		 */
+		SocketStatistics();
+
+		/**
+		 * Adds sent bytes.
+		 * @param bytes The number of bytes which have been sent
+		 */
+		inline void addSentBytes(const size_t bytes);
+
+		/**
+		 * Adds the number of messages which have been sent.
+		 * @param messages The number of messages
+		 */
+		inline void addSentMessages(const size_t messages = 1);
+
+		/**
+		 * Adds received bytes.
+		 * @param bytes The number of bytes which have been received
+		 */
+		inline void addReceivedBytes(const size_t bytes);
+
+		/**
+		 * Adds the number of messages which have been received and delivered.
+		 * @param messages The number of messages
+		 */
+		inline void addReceivedMessages(const size_t messages = 1);
+
+		/**
+		 * Adds a send attempt which had to be repeated.
+		 */
+		inline void addSendRetry();
+
+		/**
+		 * Adds a received message which has been dropped.
+		 */
+		inline void addDroppedMessage();
+
+		/**
+		 * Adds the delay between the socket becoming readable and the scheduler handling the socket.
+		 * @param seconds The delay in seconds, with range [0, infinity)
+		 */
+		inline void addSchedulerDelay(const double seconds);
+
+		/**
+		 * Adds the latency between receiving data and invoking the callback.
+		 * @param seconds The latency in seconds, with range [0, infinity)
+		 */
+		inline void addDeliveryLatency(const double seconds);
+
+		/**
+		 * Adds the duration of a callback.
+		 * @param seconds The duration in seconds, with range [0, infinity)
+		 */
+		inline void addCallbackDuration(const double seconds);
+
+		/**
+		 * Returns a snapshot of all values.
+		 * The send queue of the snapshot is unknown, use Socket::statistics() to receive the send queue as well.
+		 * @return The snapshot
+		 */
+		Snapshot snapshot() const;
+
+		/**
+		 * Resets all values to zero.
+		 */
+		void reset();
+
+		/**
+		 * Returns the index of the histogram bin for a latency.
+		 * @param seconds The latency in seconds, with range [0, infinity)
+		 * @return The bin index, with range [0, numberLatencyBins_ - 1]
+		 */
+		static unsigned int latencyBin(const double seconds);
+
+	protected:
+
+		/**
+		 * Adds a latency to a histogram.
+		 * @param latencyBins The histogram to which the latency will be added
+		 * @param seconds The latency in seconds, with range [0, infinity)
+		 */
+		static inline void addLatency(AtomicLatencyBins& latencyBins, const double seconds);
+
+		/**
+		 * Copies an atomic histogram.
+		 * @param latencyBins The histogram to copy
+		 * @return The copied histogram
+		 */
+		static LatencyBins copyBins(const AtomicLatencyBins& latencyBins);
+
+	protected:
+
+		/// The number of bytes which have been sent.
+		std::atomic<uint64_t> sentBytes_;
+
+		/// The number of bytes which have been received.
+		std::atomic<uint64_t> receivedBytes_;
+
+		/// The number of messages which have been sent.
+		std::atomic<uint64_t> sentMessages_;
+
+		/// The number of messages which have been received.
+		std::atomic<uint64_t> receivedMessages_;
+
+		/// The number of repeated send attempts.
+		std::atomic<uint64_t> sendRetries_;
+
+		/// The number of dropped messages.
+		std::atomic<uint64_t> droppedMessages_;
+
+		/// The histogram of the scheduler delays.
+		AtomicLatencyBins schedulerDelayBins_;
+
+		/// The histogram of the delivery latencies.
+		AtomicLatencyBins deliveryLatencyBins_;
+
+		/// The histogram of the callback durations.
+		AtomicLatencyBins callbackDurationBins_;
+};
+
+inline SocketStatistics::ScopedCallback::ScopedCallback(SocketStatistics& statistics, const HighPerformanceTimer::Ticks receiveTicks) :
+	statistics_(statistics),
+	startTicks_(HighPerformanceTimer::ticks())
+{
+	if (receiveTicks != 0 && receiveTicks <= startTicks_)
+	{
+		statistics_.addDeliveryLatency(HighPerformanceTimer::ticks2seconds(startTicks_ - receiveTicks));
+	}
+}
+
+inline SocketStatistics::ScopedCallback::~ScopedCallback()
+{
+	statistics_.addCallbackDuration(HighPerformanceTimer::ticks2seconds(HighPerformanceTimer::ticks() - startTicks_));
+}
+
+inline void SocketStatistics::addSentBytes(const size_t bytes)
+{
+	sentBytes_.fetch_add(uint64_t(bytes), std::memory_order_relaxed);
+}
+
+inline void SocketStatistics::addSentMessages(const size_t messages)
+{
+	sentMessages_.fetch_add(uint64_t(messages), std::memory_order_relaxed);
+}
+
+inline void SocketStatistics::addReceivedBytes(const size_t bytes)
+{
+	receivedBytes_.fetch_add(uint64_t(bytes), std::memory_order_relaxed);
+}
+
+inline void SocketStatistics::addReceivedMessages(const size_t messages)
+{
+	receivedMessages_.fetch_add(uint64_t(messages), std::memory_order_relaxed);
+}
+
+inline void SocketStatistics::addSendRetry()
+{
+	sendRetries_.fetch_add(1ull, std::memory_order_relaxed);
+}
+
+inline void SocketStatistics::addDroppedMessage()
+{
+	droppedMessages_.fetch_add(1ull, std::memory_order_relaxed);
+}
+
+inline void SocketStatistics::addSchedulerDelay(const double seconds)
+{
+	addLatency(schedulerDelayBins_, seconds);
+}
+
+inline void SocketStatistics::addDeliveryLatency(const double seconds)
+{
+	addLatency(deliveryLatencyBins_, seconds);
+}
+
+inline void SocketStatistics::addCallbackDuration(const double seconds)
+{
+	addLatency(callbackDurationBins_, seconds);
+}
+
+inline void SocketStatistics::addLatency(AtomicLatencyBins& latencyBins, const double seconds)
+{
+	latencyBins[latencyBin(seconds)].fetch_add(1ull, std::memory_order_relaxed);
+}
+
+}
+
+}
+
+#endif // FACEBOOK_NETWORK_SOCKET_STATISTICS_H
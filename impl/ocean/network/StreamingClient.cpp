@@ -588,6 +588,14 @@ bool StreamingClient::stop()
 	return true;
 }
 
+void StreamingClient::setFrameCallback(const FrameCallback& callback)
+{
+	const ScopedLock scopedLock(frameLock_);
+
+	frameCallback_ = callback;
+	frameDecoder_.reset();
+}
+
 void StreamingClient::onCommand(const std::string& command, const std::string& value, const SessionId sessionId)
 {
 	const ScopedLock scopedLock(lock_);
@@ -768,6 +776,13 @@ void StreamingClient::onUDPReceiveData(const Address4&, const Port&, const void*
 	{
 		receiveCallback_(data, size);
 	}
+
+	const ScopedLock scopedLock(frameLock_);
+
+	if (frameCallback_ && frameDecoder_.decode(data, size))
+	{
+		frameCallback_(frameDecoder_.frame());
+	}
 }
 
 }
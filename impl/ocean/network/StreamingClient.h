@@ -10,6 +10,7 @@
 
 #include "ocean/network/Network.h"
 #include "ocean/network/Address4.h"
+#include "ocean/network/FrameCodec.h"
 #include "ocean/network/Port.h"
 #include "ocean/network/Streaming.h"
 #include "ocean/network/TCPClient.h"
@@ -55,6 +56,12 @@ class OCEAN_NETWORK_EXPORT StreamingClient : public Streaming
 		 */
 		using ReceiveCallback = Callback<void, const void*, const size_t>;
 
+		/**
+		 * Definition of a callback function for frames received from a channel with data type FrameCodec::dataType().
+		 * Parameter 0 provides the decoded frame, which is valid until the callback returns
+		 */
+		using FrameCallback = Callback<void, const Frame&>;
+
 		/**
 		 * Definition of a vector holding channels.
 		 */
@@ -192,6 +199,14 @@ class OCEAN_NETWORK_EXPORT StreamingClient : public Streaming
 		 */
 		inline void setReceiveCallback(const ReceiveCallback& callback);
 
+		/**
+		 * Sets the callback function for frames received from the streaming server.
+		 * The streaming data is decoded with FrameCodec::Decoder, the receive callback is still invoked with the encoded data.
+		 * @param callback Callback function to set, an invalid callback to stop decoding frames
+		 * @see StreamingServer::streamFrame().
+		 */
+		void setFrameCallback(const FrameCallback& callback);
+
 	protected:
 
 		/**
@@ -285,6 +300,15 @@ class OCEAN_NETWORK_EXPORT StreamingClient : public Streaming
 		/// Streaming data receive callback function.
 		ReceiveCallback receiveCallback_;
 
+		/// Frame receive callback function.
+		FrameCallback frameCallback_;
+
+		/// The decoder for received frames.
+		FrameCodec::Decoder frameDecoder_;
+
+		/// The lock for the frame decoder, separate from the client lock which is held while waiting for server responses.
+		Lock frameLock_;
+
 		/// Client lock.
 		mutable Lock lock_;
 };
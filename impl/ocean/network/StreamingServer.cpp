@@ -49,6 +49,15 @@ bool StreamingServer::Channel::Stream::stream(const void* data, const size_t siz
 	return false;
 }
 
+void StreamingServer::Channel::Stream::exportStatisticsToTrace(const std::string& name)
+{
+	const SocketStatistics::Snapshot snapshot = statistics();
+
+	snapshot.exportToTrace(name, previousTraceSnapshot_.timestamp_.isValid() ? &previousTraceSnapshot_ : nullptr);
+
+	previousTraceSnapshot_ = snapshot;
+}
+
 StreamingServer::Channel::Channel(const std::string& name, const std::string& dataType, const Buffer& extraData, const ChannelCallback& callback) :
 	name_(name),
 	dataType_(dataType),
@@ -129,6 +138,9 @@ bool StreamingServer::Channel::startStream(const StreamId streamId)
 		return false;
 	}
 
+	// the new receiver does not know the previous frame
+	frameEncoder_.requestKeyFrame();
+
 	// handle event callback function
 	++activeStreams_;
 	if (channelCallback_ && activeStreams_ == 1u)
@@ -267,6 +279,48 @@ bool StreamingServer::Channel::stream(const void* data, const size_t size)
 	return allSuccessfull;
 }
 
+bool StreamingServer::Channel::streamFrame(const Frame& frame)
+{
+	if (activeStreams_ == 0u)
+	{
+		return true;
+	}
+
+	if (!frameEncoder_.encode(frame, framePacket_))
+	{
+		return false;
+	}
+
+	if (!stream(framePacket_.data(), framePacket_.size()))
+	{
+		// receivers may have missed the frame, so the next frame must not be based on it
+		frameEncoder_.requestKeyFrame();
+
+		return false;
+	}
+
+	return true;
+}
+
+void StreamingServer::Channel::streamStatistics(SocketStatistics::Snapshots& snapshots) const
+{
+	snapshots.clear();
+	snapshots.reserve(streamMap_.size());
+
+	for (StreamMap::const_iterator i = streamMap_.cbegin(); i != streamMap_.cend(); ++i)
+	{
+		snapshots.emplace_back(i->second->statistics());
+	}
+}
+
+void StreamingServer::Channel::exportStatisticsToTrace()
+{
+	for (StreamMap::iterator i = streamMap_.begin(); i != streamMap_.end(); ++i)
+	{
+		i->second->exportStatisticsToTrace("StreamingServer::" + name_ + "::" + String::toAString(i->first));
+	}
+}
+
 StreamingServer::StreamingServer()
 {
 	tcpServer_.setConnectionRequestCallback(TCPServer::ConnectionRequestCallback(*this, &StreamingServer::onTCPConnection));
@@ -482,6 +536,58 @@ bool StreamingServer::stream(const ChannelId channelId, const void* data, const
 	return i->second.stream(data, size);
 }
 
+bool StreamingServer::streamFrame(const ChannelId channelId, const Frame& frame)
+{
+	ocean_assert(frame.isValid());
+
+	const ScopedLock scopedLock(lock_);
+
+	if (isEnabled_ == false)
+	{
+		return false;
+	}
+
+	ChannelMap::iterator i = channelMap_.find(channelId);
+	if (i == channelMap_.end())
+	{
+		return false;
+	}
+
+	return i->second.streamFrame(frame);
+}
+
+bool StreamingServer::channelStatistics(const ChannelId channelId, SocketStatistics::Snapshots& snapshots) const
+{
+	const ScopedLock scopedLock(lock_);
+
+	const ChannelMap::const_iterator i = channelMap_.find(channelId);
+	if (i == channelMap_.cend())
+	{
+		return false;
+	}
+
+	i->second.streamStatistics(snapshots);
+
+	return true;
+}
+
+void StreamingServer::exportStatisticsToTrace()
+{
+	if (!HighPerformanceBenchmark::get().isTracing())
+	{
+		return;
+	}
+
+	const ScopedLock scopedLock(lock_);
+
+	tcpServer_.statistics().exportToTrace("StreamingServer::configuration");
+
+	for (ChannelMap::iterator i = channelMap_.begin(); i != channelMap_.end(); ++i)
+	{
+		i->second.exportStatisticsToTrace();
+	}
+}
+
 std::string StreamingServer::generateUniqueChannel() const
 {
 	const ScopedLock scopedLock(lock_);
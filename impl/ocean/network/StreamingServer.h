@@ -9,6 +9,7 @@
 #define FACEBOOK_NETWORK_STREAMING_SERVER_H
 
 #include "ocean/network/Network.h"
+#include "ocean/network/FrameCodec.h"
 #include "ocean/network/Port.h"
 #include "ocean/network/Streaming.h"
 #include "ocean/network/TCPServer.h"
@@ -141,6 +142,18 @@ class OCEAN_NETWORK_EXPORT StreamingServer : public Streaming
 						 */
 						bool stream(const void* data, const size_t size);
 
+						/**
+						 * Returns a snapshot of the statistics of the UDP client sending the data of this stream.
+						 * @return The snapshot of the statistics
+						 */
+						inline SocketStatistics::Snapshot statistics() const;
+
+						/**
+						 * Exports the statistics of this stream to the trace of HighPerformanceBenchmark, including the data rate since the previous export.
+						 * @param name The name of the stream, used as prefix for all counters, must be valid
+						 */
+						void exportStatisticsToTrace(const std::string& name);
+
 					protected:
 
 						/**
@@ -172,6 +185,9 @@ class OCEAN_NETWORK_EXPORT StreamingServer : public Streaming
 
 						/// Determines whether data should be streamed.
 						bool isStreaming_ = false;
+
+						/// The statistics of the previous export to the trace, used to determine data rates.
+						SocketStatistics::Snapshot previousTraceSnapshot_;
 				};
 
 				/**
@@ -269,12 +285,33 @@ class OCEAN_NETWORK_EXPORT StreamingServer : public Streaming
 
 				/**
 				 * Streams new data using the given UDP connections.
+				 * All subscribers send directly from the given memory, the data is neither copied per subscriber nor per package.
 				 * @param data Data to stream
 				 * @param size Size of the data to stream in bytes
 				 * @return True, if succeeded
 				 */
 				bool stream(const void* data, const size_t size);
 
+				/**
+				 * Encodes and streams a new frame using the given UDP connections.
+				 * The frame is not encoded while no stream is active.
+				 * @param frame The frame to stream, must be valid
+				 * @return True, if succeeded
+				 * @see FrameCodec.
+				 */
+				bool streamFrame(const Frame& frame);
+
+				/**
+				 * Returns snapshots of the statistics of all streams of this channel.
+				 * @param snapshots The resulting snapshots, one for each stream
+				 */
+				void streamStatistics(SocketStatistics::Snapshots& snapshots) const;
+
+				/**
+				 * Exports the statistics of all streams of this channel to the trace of HighPerformanceBenchmark.
+				 */
+				void exportStatisticsToTrace();
+
 			protected:
 
 				/// Unique Channel name.
@@ -297,6 +334,12 @@ class OCEAN_NETWORK_EXPORT StreamingServer : public Streaming
 
 				/// Channel request callback function.
 				ChannelCallback channelCallback_;
+
+				/// The encoder for frames streamed via this channel.
+				FrameCodec::Encoder frameEncoder_;
+
+				/// The buffer holding the most recent encoded frame.
+				Buffer framePacket_;
 		};
 
 		/**
@@ -492,6 +535,39 @@ class OCEAN_NETWORK_EXPORT StreamingServer : public Streaming
 		 */
 		bool stream(const ChannelId channelId, const void* data, const size_t size);
 
+		/**
+		 * Sets a new frame for a specified channel, the frame is sent as delta to the previous frame.
+		 * The channel should be registered with data type FrameCodec::dataType(), streaming clients decode the frames with FrameCodec::Decoder.<br>
+		 * A key frame is sent whenever a stream (re-)starts so that new clients do not need to wait.
+		 * @param channelId SessionId of the streaming channel
+		 * @param frame The frame to stream, must be valid, must be supported by FrameCodec
+		 * @return True, if the frame was accepted
+		 * @see FrameCodec::isSupported().
+		 */
+		bool streamFrame(const ChannelId channelId, const Frame& frame);
+
+		/**
+		 * Returns snapshots of the statistics of all streams of a specified channel.
+		 * Each stream is sent with an individual UDP client, so that the statistics of each receiver are available.
+		 * @param channelId The id of the channel
+		 * @param snapshots The resulting snapshots, one for each stream of the channel
+		 * @return True, if the channel exists
+		 */
+		bool channelStatistics(const ChannelId channelId, SocketStatistics::Snapshots& snapshots) const;
+
+		/**
+		 * Returns a snapshot of the statistics of the TCP server used for the configuration of the streams.
+		 * @return The snapshot of the statistics
+		 */
+		inline SocketStatistics::Snapshot configurationStatistics() const;
+
+		/**
+		 * Exports the statistics of all streams of all channels to the trace of HighPerformanceBenchmark, if tracing is active.
+		 * Should be called periodically (e.g., once per streamed frame) to receive the data rates of the streams within the trace.
+		 * @see HighPerformanceBenchmark::startTracing().
+		 */
+		void exportStatisticsToTrace();
+
 		/**
 		 * Returns the number of registered channels.
 		 * @return Channels
@@ -676,6 +752,11 @@ inline Port StreamingServer::Channel::Stream::senderPort() const
 	return udpClient_.port();
 }
 
+inline SocketStatistics::Snapshot StreamingServer::Channel::Stream::statistics() const
+{
+	return udpClient_.statistics();
+}
+
 inline const Address4& StreamingServer::Channel::Stream::receiverAddress() const
 {
 	return address_;
@@ -765,6 +846,11 @@ inline bool StreamingServer::isEnabled() const
 	return isEnabled_;
 }
 
+inline SocketStatistics::Snapshot StreamingServer::configurationStatistics() const
+{
+	return tcpServer_.statistics();
+}
+
 inline size_t StreamingServer::channels() const
 {
 	const ScopedLock scopedLock(lock_);
@@ -56,13 +56,14 @@ GLESFramebuffer::~GLESFramebuffer()
 	release();
 }
 
-bool GLESFramebuffer::initialize(const XrSession& xrSession, const GLenum colorFormat, const unsigned int width, const unsigned int height, const unsigned int multisamples, const bool useStencilBuffer)
+bool GLESFramebuffer::initialize(const XrSession& xrSession, const GLenum colorFormat, const unsigned int width, const unsigned int height, const unsigned int multisamples, const bool useStencilBuffer, const unsigned int numberViews)
 {
 	ocean_assert(!isValid());
 	ocean_assert(xrSession != XR_NULL_HANDLE);
 	ocean_assert(colorFormat != GLenum(0) && width != 0u && height != 0u);
+	ocean_assert(numberViews >= 1u);
 
-	if (isValid() || xrSession == XR_NULL_HANDLE || colorFormat == GLenum(0) || width == 0u || height == 0u)
+	if (isValid() || xrSession == XR_NULL_HANDLE || colorFormat == GLenum(0) || width == 0u || height == 0u || numberViews == 0u)
 	{
 		return false;
 	}
@@ -72,11 +73,20 @@ bool GLESFramebuffer::initialize(const XrSession& xrSession, const GLenum colorF
 	PFNGLRENDERBUFFERSTORAGEMULTISAMPLEEXTPROC glRenderbufferStorageMultisampleEXT = (PFNGLRENDERBUFFERSTORAGEMULTISAMPLEEXTPROC)eglGetProcAddress("glRenderbufferStorageMultisampleEXT");
 	PFNGLFRAMEBUFFERTEXTURE2DMULTISAMPLEEXTPROC glFramebufferTexture2DMultisampleEXT = (PFNGLFRAMEBUFFERTEXTURE2DMULTISAMPLEEXTPROC)eglGetProcAddress("glFramebufferTexture2DMultisampleEXT");
 
-#if 0
-	// necessary when supporting multiview
-	PFNGLFRAMEBUFFERTEXTUREMULTIVIEWOVRPROC glFramebufferTextureMultiviewOVR =(PFNGLFRAMEBUFFERTEXTUREMULTIVIEWOVRPROC)eglGetProcAddress("glFramebufferTextureMultiviewOVR");
-	PFNGLFRAMEBUFFERTEXTUREMULTISAMPLEMULTIVIEWOVRPROC glFramebufferTextureMultisampleMultiviewOVR = (PFNGLFRAMEBUFFERTEXTUREMULTISAMPLEMULTIVIEWOVRPROC)eglGetProcAddress("glFramebufferTextureMultisampleMultiviewOVR");
-#endif
+	PFNGLFRAMEBUFFERTEXTUREMULTIVIEWOVRPROC glFramebufferTextureMultiviewOVR = nullptr;
+	PFNGLFRAMEBUFFERTEXTUREMULTISAMPLEMULTIVIEWOVRPROC glFramebufferTextureMultisampleMultiviewOVR = nullptr;
+
+	if (numberViews > 1u)
+	{
+		glFramebufferTextureMultiviewOVR = (PFNGLFRAMEBUFFERTEXTUREMULTIVIEWOVRPROC)eglGetProcAddress("glFramebufferTextureMultiviewOVR");
+		glFramebufferTextureMultisampleMultiviewOVR = (PFNGLFRAMEBUFFERTEXTUREMULTISAMPLEMULTIVIEWOVRPROC)eglGetProcAddress("glFramebufferTextureMultisampleMultiviewOVR");
+
+		if (glFramebufferTextureMultiviewOVR == nullptr)
+		{
+			Log::error() << "OpenXR: The platform does not support multiview framebuffers";
+			return false;
+		}
+	}
 
 	uint32_t formatCapacityInput = 0u;
 	uint32_t formatCountOutput = 0u;
@@ -174,7 +184,7 @@ bool GLESFramebuffer::initialize(const XrSession& xrSession, const GLenum colorF
 	xrSwapchainCreateInfo.width = width;
 	xrSwapchainCreateInfo.height = height;
 	xrSwapchainCreateInfo.faceCount = 1u;
-	xrSwapchainCreateInfo.arraySize = 1u;
+	xrSwapchainCreateInfo.arraySize = numberViews;
 	xrSwapchainCreateInfo.mipCount = 1u;
 
 	xrResult = xrCreateSwapchain(xrSession, &xrSwapchainCreateInfo, &xrSwapchain_);
@@ -216,7 +226,7 @@ bool GLESFramebuffer::initialize(const XrSession& xrSession, const GLenum colorF
 	{
 		// Create the color buffer texture.
 		const GLuint colorTexture = GLuint(xrSwapchainImages_[i].image);
-		const GLenum colorTextureTarget = GL_TEXTURE_2D;
+		const GLenum colorTextureTarget = numberViews == 1u ? GL_TEXTURE_2D : GL_TEXTURE_2D_ARRAY;
 
 		glBindTexture(colorTextureTarget, colorTexture);
 		ocean_assert(GL_NO_ERROR == glGetError());
@@ -241,7 +251,55 @@ bool GLESFramebuffer::initialize(const XrSession& xrSession, const GLenum colorF
 
 		GLenum renderFramebufferStatus = GLenum(0);
 
-		if (multisamples > 1u && glRenderbufferStorageMultisampleEXT != nullptr && glFramebufferTexture2DMultisampleEXT != nullptr)
+		if (numberViews > 1u)
+		{
+			// Create the depth texture array, multiview framebuffers cannot use renderbuffers.
+			glGenTextures(1, &depthBuffers_[i]);
+			ocean_assert(GL_NO_ERROR == glGetError());
+
+			glBindTexture(GL_TEXTURE_2D_ARRAY, depthBuffers_[i]);
+			ocean_assert(GL_NO_ERROR == glGetError());
+
+			glTexStorage3D(GL_TEXTURE_2D_ARRAY, 1, useStencilBuffer ? GL_DEPTH24_STENCIL8 : GL_DEPTH_COMPONENT24, width, height, numberViews);
+			ocean_assert(GL_NO_ERROR == glGetError());
+
+			glBindTexture(GL_TEXTURE_2D_ARRAY, 0);
+			ocean_assert(GL_NO_ERROR == glGetError());
+
+
+			// Create the frame buffer, each view renders into an individual layer of the texture arrays.
+			glGenFramebuffers(1, &colorBuffers_[i]);
+			ocean_assert(GL_NO_ERROR == glGetError());
+
+			glBindFramebuffer(GL_DRAW_FRAMEBUFFER, colorBuffers_[i]);
+			ocean_assert(GL_NO_ERROR == glGetError());
+
+			const GLenum depthAttachment = useStencilBuffer ? GL_DEPTH_STENCIL_ATTACHMENT : GL_DEPTH_ATTACHMENT;
+
+			if (multisamples > 1u && glFramebufferTextureMultisampleMultiviewOVR != nullptr)
+			{
+				glFramebufferTextureMultisampleMultiviewOVR(GL_DRAW_FRAMEBUFFER, depthAttachment, depthBuffers_[i], 0, multisamples, 0, numberViews);
+				ocean_assert(GL_NO_ERROR == glGetError());
+
+				glFramebufferTextureMultisampleMultiviewOVR(GL_DRAW_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, colorTexture, 0, multisamples, 0, numberViews);
+				ocean_assert(GL_NO_ERROR == glGetError());
+			}
+			else
+			{
+				glFramebufferTextureMultiviewOVR(GL_DRAW_FRAMEBUFFER, depthAttachment, depthBuffers_[i], 0, 0, numberViews);
+				ocean_assert(GL_NO_ERROR == glGetError());
+
+				glFramebufferTextureMultiviewOVR(GL_DRAW_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, colorTexture, 0, 0, numberViews);
+				ocean_assert(GL_NO_ERROR == glGetError());
+			}
+
+			renderFramebufferStatus = glCheckFramebufferStatus(GL_DRAW_FRAMEBUFFER);
+			ocean_assert(GL_NO_ERROR == glGetError());
+
+			glBindFramebuffer(GL_DRAW_FRAMEBUFFER, 0);
+			ocean_assert(GL_NO_ERROR == glGetError());
+		}
+		else if (multisamples > 1u && glRenderbufferStorageMultisampleEXT != nullptr && glFramebufferTexture2DMultisampleEXT != nullptr)
 		{
 			// Create multisampled depth buffer.
 			glGenRenderbuffers(1, &depthBuffers_[i]);
@@ -325,6 +383,7 @@ bool GLESFramebuffer::initialize(const XrSession& xrSession, const GLenum colorF
 	width_ = width;
 	height_ = height;
 	multisamples_ = multisamples;
+	numberViews_ = numberViews;
 
 	return true;
 }
@@ -448,7 +507,16 @@ void GLESFramebuffer::release()
 
 	if (!depthBuffers_.empty())
 	{
-		glDeleteRenderbuffers(depthBuffers_.size(), depthBuffers_.data());
+		if (numberViews_ > 1u)
+		{
+			// multiview framebuffers use depth textures
+			glDeleteTextures(depthBuffers_.size(), depthBuffers_.data());
+		}
+		else
+		{
+			glDeleteRenderbuffers(depthBuffers_.size(), depthBuffers_.data());
+		}
+
 		ocean_assert(GL_NO_ERROR == glGetError());
 
 		depthBuffers_.clear();
@@ -466,6 +534,7 @@ void GLESFramebuffer::release()
 	width_ = 0u;
 	height_ = 0u;
 	multisamples_ = 0u;
+	numberViews_ = 1u;
 }
 
 bool GLESFramebuffer::isValid() const
@@ -490,9 +559,11 @@ GLESFramebuffer& GLESFramebuffer::operator=(GLESFramebuffer&& framebuffer)
 		width_ = framebuffer.width_;
 		height_ = framebuffer.height_;
 		multisamples_ = framebuffer.multisamples_;
+		numberViews_ = framebuffer.numberViews_;
 		framebuffer.width_ = 0u;
 		framebuffer.height_ = 0u;
 		framebuffer.multisamples_ = 0u;
+		framebuffer.numberViews_ = 1u;
 
 		xrSwapchain_ = framebuffer.xrSwapchain_;
 		xrSwapchainImages_ = std::move(framebuffer.xrSwapchainImages_);
@@ -105,6 +105,13 @@ class OCEAN_PLATFORM_META_QUEST_OPENXR_EXPORT GLESFramebuffer
 		 */
 		inline unsigned int multisamples() const;
 
+		/**
+		 * Returns the number of views the framebuffer has.
+		 * A framebuffer with more than one view is a multiview framebuffer with one layer of the swapchain's texture array for each view.
+		 * @return The number of views, with range [1, infinity)
+		 */
+		inline unsigned int numberViews() const;
+
 		/**
 		 * The VrAPI's swap chain for the framebuffer.
 		 * @return The framebuffer's swap chain
@@ -125,10 +132,11 @@ class OCEAN_PLATFORM_META_QUEST_OPENXR_EXPORT GLESFramebuffer
 		 * @param height The height of the framebuffer in pixel, with range [1, infinity)
 		 * @param multisamples The number of multisamples the framebuffer will have, with range [0, infinity)
 		 * @param useStencilBuffer If stencil buffer should be used
+		 * @param numberViews The number of views of the framebuffer, more than one view to create a multiview framebuffer (GL_OVR_multiview) which renders all views in one pass, with range [1, infinity)
 		 * @return True, if succeeded
 		 * @see release().
 		 */
-		bool initialize(const XrSession& xrSession, const GLenum colorFormat, const unsigned int width, const unsigned int height, const unsigned int multisamples, const bool useStencilBuffer = false);
+		bool initialize(const XrSession& xrSession, const GLenum colorFormat, const unsigned int width, const unsigned int height, const unsigned int multisamples, const bool useStencilBuffer = false, const unsigned int numberViews = 1u);
 
 		/**
 		 * Binds this framebuffer.
@@ -195,6 +203,9 @@ class OCEAN_PLATFORM_META_QUEST_OPENXR_EXPORT GLESFramebuffer
 		/// The number of multisamples the framebuffer applies, with range [0, infinity)
 		unsigned int multisamples_ = 0u;
 
+		/// The number of views of the framebuffer, with range [1, infinity).
+		unsigned int numberViews_ = 1u;
+
 		/// The handle of the OpenXR swap chain.
 		XrSwapchain xrSwapchain_ = XR_NULL_HANDLE;
 
@@ -229,6 +240,11 @@ inline unsigned int GLESFramebuffer::multisamples() const
 	return multisamples_;
 }
 
+inline unsigned int GLESFramebuffer::numberViews() const
+{
+	return numberViews_;
+}
+
 inline const XrSwapchain& GLESFramebuffer::xrSwapchain() const
 {
 	ocean_assert(xrSwapchain_ != XR_NULL_HANDLE);
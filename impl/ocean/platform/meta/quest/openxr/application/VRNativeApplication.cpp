@@ -179,6 +179,7 @@ void VRNativeApplication::applicationLoop()
 
 	Rendering::Framebuffer::FramebufferConfig framebufferConfiguration;
 	framebufferConfiguration.useStencilBuffer = useStencilBuffer_;
+	framebufferConfiguration.useMultiview = useMultiview_;
 
 	framebuffer_ = engine_->createFramebuffer(Rendering::Framebuffer::FramebufferType::FRAMEBUFFER_WINDOW, framebufferConfiguration);
 	ocean_assert(framebuffer_);
@@ -374,7 +375,7 @@ void VRNativeApplication::render(const bool /*shouldRender*/, const XrTime& xrPr
 		xrSwapchainSubImage.imageRect.offset.y = 0;
 		xrSwapchainSubImage.imageRect.extent.width = questFramebuffer_->width(eyeIndex);
 		xrSwapchainSubImage.imageRect.extent.height = questFramebuffer_->height(eyeIndex);
-		xrSwapchainSubImage.imageArrayIndex = 0;
+		xrSwapchainSubImage.imageArrayIndex = questFramebuffer_->imageArrayIndex(eyeIndex);
 	}
 
 	onPreRender(xrPredictedDisplayTime, renderTimestamp);
@@ -509,7 +510,18 @@ void VRNativeApplication::onIdle()
 	ocean_assert(xrSession_.isValid());
 
 	XrTime xrPredictedDisplayTime = 0ull;
-	const bool shouldRender = xrSession_.nextFrame(xrPredictedDisplayTime);
+	XrDuration xrPredictedDisplayPeriod = 0ll;
+
+	const HighPerformanceTimer waitTimer;
+
+	const bool shouldRender = xrSession_.nextFrame(xrPredictedDisplayTime, &xrPredictedDisplayPeriod);
+
+	if (questFramebuffer_ != nullptr)
+	{
+		// the frame timing of the next rendered frame contains the time we waited for the compositor
+
+		questFramebuffer_->frameTiming().setCompositorTiming(waitTimer.seconds(), xrPredictedDisplayPeriod > 0ll ? Timestamp::nanoseconds2seconds(xrPredictedDisplayPeriod) : -1.0);
+	}
 
 	const Timestamp renderTimestamp(Timestamp::nanoseconds2seconds(xrPredictedDisplayTime));
 
@@ -279,6 +279,9 @@ class OCEAN_PLATFORM_META_QUEST_OPENXR_APPLICATION_EXPORT VRNativeApplication :
 		/// True, to use the stencil buffer.
 		bool useStencilBuffer_ = false;
 
+		/// True, to render both eyes in one pass (single-pass multiview) if supported by the device; all render callbacks must support multiview then.
+		bool useMultiview_ = false;
+
 		/// The near distance used for clipping in the projection matrix.
 		float nearDistance_ = 0.1f;
 
@@ -24,6 +24,11 @@ FrameTexture2D::~FrameTexture2D()
 	// nothing to do here
 }
 
+bool FrameTexture2D::setTextureRegions(Frame&& frame, const CV::PixelBoundingBoxes& /*dirtyRegions*/)
+{
+	return setTexture(std::move(frame));
+}
+
 FrameTexture2D::ObjectType FrameTexture2D::type() const
 {
 	return TYPE_FRAME_TEXTURE_2D;
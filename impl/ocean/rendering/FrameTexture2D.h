@@ -11,6 +11,8 @@
 #include "ocean/rendering/Rendering.h"
 #include "ocean/rendering/Texture2D.h"
 
+#include "ocean/cv/PixelBoundingBox.h"
+
 #include "ocean/media/FrameMedium.h"
 
 namespace Ocean
@@ -151,6 +153,17 @@ class OCEAN_RENDERING_EXPORT FrameTexture2D : virtual public Texture2D
 		 */
 		virtual bool setTexture(CompressedFrame&& compressedFrame) = 0;
 
+		/**
+		 * Updates individual regions of the texture with a given frame.
+		 * Only the pixels inside the dirty regions are transferred to the texture, e.g., to update a large texture atlas of which only small parts have changed.<br>
+		 * The entire texture is updated if the frame type of the frame does not match the frame type of the current texture.<br>
+		 * The default implementation updates the entire texture.
+		 * @param frame The frame containing the entire new texture information, must be valid
+		 * @param dirtyRegions The regions of the frame which have changed since the previous update, an empty set to update the entire texture
+		 * @return True, if succeeded
+		 */
+		virtual bool setTextureRegions(Frame&& frame, const CV::PixelBoundingBoxes& dirtyRegions);
+
 		/**
 		 * Returns the type of this object.
 		 * @see Object::type().
@@ -96,6 +96,9 @@ class OCEAN_RENDERING_EXPORT Framebuffer : virtual public Object
 
 				/// True, for a framebuffer using a stencil buffer.
 				bool useStencilBuffer = false;
+
+				/// True, to render all views of a stereo framebuffer in one pass (multiview), if supported by the platform; False, to render each view individually.
+				bool useMultiview = false;
 		};
 
 		/**
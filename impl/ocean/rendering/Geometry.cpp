@@ -81,6 +81,16 @@ void Geometry::removeRenderable(const RenderableRef& renderable)
 	geometryRenderables.erase(i);
 }
 
+HomogenousMatrices4 Geometry::instanceTransformations() const
+{
+	throw NotSupportedException("Geometry::instanceTransformations() is not supported.");
+}
+
+void Geometry::setInstanceTransformations(const HomogenousMatrices4& /*object_T_instances*/)
+{
+	throw NotSupportedException("Geometry::setInstanceTransformations() is not supported.");
+}
+
 Geometry::ObjectType Geometry::type() const
 {
 	return TYPE_GEOMETRY;
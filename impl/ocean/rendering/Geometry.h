@@ -84,6 +84,22 @@ class OCEAN_RENDERING_EXPORT Geometry : virtual public Node
 		 */
 		virtual void removeRenderable(const RenderableRef& renderable);
 
+		/**
+		 * Returns the transformations of the instances of this geometry.
+		 * @return The transformations between the individual instances and this geometry, empty if the geometry is rendered once
+		 * @exception NotSupportedException Is thrown if this function is not supported
+		 * @see setInstanceTransformations().
+		 */
+		virtual HomogenousMatrices4 instanceTransformations() const;
+
+		/**
+		 * Sets the transformations of instances of this geometry, all renderables of this geometry are rendered once for each instance.
+		 * Engines supporting hardware instancing render all instances of a renderable with one draw call, which is significantly faster than using one geometry (or one transform node) for each instance.
+		 * @param object_T_instances The transformations between the individual instances and this geometry, an empty vector to render the geometry once
+		 * @exception NotSupportedException Is thrown if this function is not supported
+		 */
+		virtual void setInstanceTransformations(const HomogenousMatrices4& object_T_instances);
+
 		/**
 		 * Returns the type of this object.
 		 * @see Object::type().
@@ -39,6 +39,11 @@ Scalar Points::pointSize() const
 	throw NotSupportedException();
 }
 
+unsigned int Points::chunkSize() const
+{
+	throw NotSupportedException();
+}
+
 void Points::setIndices(const VertexIndices& /*indices*/)
 {
 	throw NotSupportedException();
@@ -59,6 +64,11 @@ void Points::setPointSize(const Scalar /*size*/)
 	throw NotSupportedException();
 }
 
+void Points::setChunkSize(const unsigned int /*chunkSize*/)
+{
+	throw NotSupportedException();
+}
+
 }
 
 }
@@ -68,6 +68,14 @@ class OCEAN_RENDERING_EXPORT Points : virtual public IndependentPrimitive
 		 */
 		virtual Scalar pointSize() const;
 
+		/**
+		 * Returns the maximal number of points in each chunk of a chunked point cloud.
+		 * @return The maximal number of points per chunk, 0 if chunked rendering is disabled
+		 * @exception NotSupportedException Is thrown if this function is not supported
+		 * @see setChunkSize().
+		 */
+		virtual unsigned int chunkSize() const;
+
 		/**
 		 * Sets the indices of the used vertex points.
 		 * The indices must not extend the number of defined vertices inside the used vertex set
@@ -92,6 +100,16 @@ class OCEAN_RENDERING_EXPORT Points : virtual public IndependentPrimitive
 		 */
 		virtual void setPointSize(const Scalar size);
 
+		/**
+		 * Enables or disables chunked rendering, e.g., for point clouds with millions of points.
+		 * The points are partitioned into spatial chunks, chunks outside the view are skipped and chunks far away from the viewer are rendered with a subset of their points (level of detail).<br>
+		 * Points which are appended to the vertex set later (e.g., of a growing map) are added to the existing chunks incrementally, as long as the existing points do not change.
+		 * @param chunkSize The maximal number of points in each chunk, with range [1, infinity), 0 to disable chunked rendering
+		 * @exception NotSupportedException Is thrown if this function is not supported
+		 * @see chunkSize().
+		 */
+		virtual void setChunkSize(const unsigned int chunkSize);
+
 	protected:
 
 		/**
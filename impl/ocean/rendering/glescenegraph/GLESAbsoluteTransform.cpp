@@ -92,6 +92,15 @@ void GLESAbsoluteTransform::setTransformation(const HomogenousMatrix4& absolute_
 	absolute_T_children_ = absolute_T_children;
 }
 
+BoundingBox GLESAbsoluteTransform::parentBoundingBox(bool& bounded) const
+{
+	const BoundingBox result = cachedBoundingBox(bounded);
+
+	bounded = false;
+
+	return result;
+}
+
 void GLESAbsoluteTransform::addToTraverser(const GLESFramebuffer& framebuffer, const SquareMatrix4& projectionMatrix, const HomogenousMatrix4& camera_T_parent, const Lights& lights, GLESTraverser& traverser) const
 {
 	const ScopedLock scopedLock(objectLock);
@@ -146,6 +155,11 @@ void GLESAbsoluteTransform::addToTraverser(const GLESFramebuffer& framebuffer, c
 
 	camera_T_object *= absolute_T_children_;
 
+	if (isCulled(camera_T_object, traverser))
+	{
+		return;
+	}
+
 	if (groupLights.empty())
 	{
 		for (Nodes::const_iterator i = groupNodes.begin(); i != groupNodes.end(); ++i)
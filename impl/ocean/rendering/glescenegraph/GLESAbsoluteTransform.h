@@ -70,6 +70,12 @@ class OCEAN_RENDERING_GLES_EXPORT GLESAbsoluteTransform :
 		 */
 		void setTransformation(const HomogenousMatrix4& absolute_T_children) override;
 
+		/**
+		 * Returns the bounding box of this node, which is never bounded in the coordinate system of the parent node as the absolute transformation depends on the camera.
+		 * @see GLESNode::parentBoundingBox().
+		 */
+		BoundingBox parentBoundingBox(bool& bounded) const override;
+
 		/**
 		 * Adds this node and all child node to a traverser.
 		 * @see GLESNode::addToTraverser().
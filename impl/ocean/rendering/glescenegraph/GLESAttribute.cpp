@@ -152,6 +152,16 @@ std::string GLESAttribute::translateProgramType(const GLESAttribute::ProgramType
 		result += "PT_PENDING | ";
 	}
 
+	if ((programType & PT_INSTANCED) != 0)
+	{
+		result += "PT_INSTANCED | ";
+	}
+
+	if ((programType & PT_MULTIVIEW) != 0)
+	{
+		result += "PT_MULTIVIEW | ";
+	}
+
 	ocean_assert(result.size() >= 3);
 	if (result.size() > 3)
 	{
@@ -88,7 +88,11 @@ class OCEAN_RENDERING_GLES_EXPORT GLESAttribute :
 			/// Shader waiting for more specific information.
 			PT_PENDING = (1u << 21u),
 			/// The shader is a custom shader.
-			PT_CUSTOM = (1u << 22u)
+			PT_CUSTOM = (1u << 22u),
+			/// Shader rendering several instances with individual transformations in one draw call.
+			PT_INSTANCED = (1u << 23u),
+			/// Shader rendering both views of a stereo framebuffer in one draw call (single-pass multiview).
+			PT_MULTIVIEW = (1u << 24u)
 		};
 
 	public:
@@ -78,9 +78,24 @@ void GLESAttributeSet::bindAttributes(const GLESFramebuffer& framebuffer, const
 		shaderProgramTypeChanged_ = true;
 	}
 
-	if (shaderProgramTypeChanged_ || ((shaderProgramType_ & additionalProgramTypes) != additionalProgramTypes))
+	GLESAttribute::ProgramType programTypes = additionalProgramTypes;
+
+	if (framebuffer.multiviewProjectionMatrices() != nullptr)
 	{
-		const GLESAttribute::ProgramType newShaderType(determineShaderType(lights, additionalProgramTypes, additionalAttribute));
+		// both views of the framebuffer are rendered with one draw call
+
+		programTypes = GLESAttribute::ProgramType(programTypes | GLESAttribute::PT_MULTIVIEW);
+	}
+
+	// an instanced or multiview program cannot be used for individual renderables or individual views and vice versa
+
+	constexpr uint32_t exclusiveProgramTypes = GLESAttribute::PT_INSTANCED | GLESAttribute::PT_MULTIVIEW;
+
+	const bool exclusiveChanged = (shaderProgramType_ & exclusiveProgramTypes) != (programTypes & exclusiveProgramTypes);
+
+	if (shaderProgramTypeChanged_ || exclusiveChanged || ((shaderProgramType_ & programTypes) != programTypes))
+	{
+		const GLESAttribute::ProgramType newShaderType(determineShaderType(lights, programTypes, additionalAttribute));
 
 		if ((newShaderType & GLESAttribute::PT_CUSTOM) == GLESAttribute::PT_CUSTOM)
 		{
@@ -181,6 +196,13 @@ void GLESAttributeSet::bindAttributes(const GLESFramebuffer& framebuffer, const
 	}
 }
 
+bool GLESAttributeSet::isInstancingSupported(const Lights& lights) const
+{
+	const ScopedLock scopedLock(objectLock);
+
+	return GLESProgramManager::isInstancingSupported(determineShaderType(lights));
+}
+
 void GLESAttributeSet::unbindAttributes()
 {
 	for (Attributes::const_reverse_iterator i = setAttributes.rbegin(); i != setAttributes.rend(); ++i)
@@ -196,7 +218,7 @@ GLESAttribute::ProgramType GLESAttributeSet::determineShaderType(const Lights& l
 {
 	if (setAttributes.empty() && additionalAttribute == nullptr)
 	{
-		return GLESAttribute::PT_STATIC_COLOR;
+		return GLESAttribute::ProgramType(GLESAttribute::PT_STATIC_COLOR | (additionalProgramTypes & GLESAttribute::PT_MULTIVIEW));
 	}
 
 	GLESAttribute::ProgramType result = GLESAttribute::PT_UNKNOWN;
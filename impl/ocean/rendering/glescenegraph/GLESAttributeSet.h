@@ -84,6 +84,14 @@ class OCEAN_RENDERING_GLES_EXPORT GLESAttributeSet :
 		 */
 		void unbindAttributes();
 
+		/**
+		 * Returns whether renderables using this attribute set can be rendered as several instances with one draw call.
+		 * @param lights The lights used to render the renderables, can be empty
+		 * @return True, if so
+		 * @see GLESAttribute::PT_INSTANCED.
+		 */
+		bool isInstancingSupported(const Lights& lights) const;
+
 		/**
 		 * Returns the shader of this attribute set.
 		 * @return Shader
@@ -152,6 +152,8 @@ void GLESBox::rebuildPrimitives()
 void GLESBox::updateBoundingBox()
 {
 	boundingBox_ = BoundingBox(Box3(Vector3(0, 0, 0), size_.x(), size_.y(), size_.z()));
+
+	invalidateParentBoundingBoxes();
 }
 
 GLESBox::ObjectType GLESBox::type() const
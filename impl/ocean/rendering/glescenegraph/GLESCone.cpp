@@ -181,6 +181,8 @@ void GLESCone::updateBoundingBox()
 {
 	const Scalar diamenter = radius_ * Scalar(2);
 	boundingBox_ = BoundingBox(Box3(Vector3(0, 0, 0), diamenter, height_, diamenter));
+
+	invalidateParentBoundingBoxes();
 }
 
 GLESCone::ObjectType GLESCone::type() const
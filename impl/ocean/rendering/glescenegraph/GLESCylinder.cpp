@@ -218,6 +218,8 @@ void GLESCylinder::updateBoundingBox()
 {
 	const Scalar diamenter = radius_ * Scalar(2);
 	boundingBox_ = BoundingBox(Box3(Vector3(0, 0, 0), diamenter, height_, diamenter));
+
+	invalidateParentBoundingBoxes();
 }
 
 GLESCylinder::ObjectType GLESCylinder::type() const
@@ -20,12 +20,14 @@ namespace GLESceneGraph
 
 GLESDynamicLibrary::glActiveTextureFunction GLESDynamicLibrary::glActiveTexture_ = nullptr;
 GLESDynamicLibrary::glAttachShaderFunction GLESDynamicLibrary::glAttachShader_ = nullptr;
+GLESDynamicLibrary::glBeginQueryFunction GLESDynamicLibrary::glBeginQuery_ = nullptr;
 GLESDynamicLibrary::glBindBufferFunction GLESDynamicLibrary::glBindBuffer_ = nullptr;
 GLESDynamicLibrary::glBindFramebufferFunction GLESDynamicLibrary::glBindFramebuffer_ = nullptr;
 GLESDynamicLibrary::glBindVertexArrayFunction GLESDynamicLibrary::glBindVertexArray_ = nullptr;
 GLESDynamicLibrary::glBufferDataFunction GLESDynamicLibrary::glBufferData_ = nullptr;
 GLESDynamicLibrary::glCheckFramebufferStatusFunction GLESDynamicLibrary::glCheckFramebufferStatus_ = nullptr;
 GLESDynamicLibrary::glClearDepthfFunction GLESDynamicLibrary::glClearDepthf_ = nullptr;
+GLESDynamicLibrary::glClientWaitSyncFunction GLESDynamicLibrary::glClientWaitSync_ = nullptr;
 GLESDynamicLibrary::glCompileShaderFunction GLESDynamicLibrary::glCompileShader_ = nullptr;
 GLESDynamicLibrary::glCompressedTexImage2DFunction GLESDynamicLibrary::glCompressedTexImage2D_ = nullptr;
 GLESDynamicLibrary::glCreateProgramFunction GLESDynamicLibrary::glCreateProgram_ = nullptr;
@@ -34,28 +36,42 @@ GLESDynamicLibrary::glDebugMessageCallbackFunction GLESDynamicLibrary::glDebugMe
 GLESDynamicLibrary::glDeleteBuffersFunction GLESDynamicLibrary::glDeleteBuffers_ = nullptr;
 GLESDynamicLibrary::glDeleteFramebuffersFunction GLESDynamicLibrary::glDeleteFramebuffers_ = nullptr;
 GLESDynamicLibrary::glDeleteProgramFunction GLESDynamicLibrary::glDeleteProgram_ = nullptr;
+GLESDynamicLibrary::glDeleteQueriesFunction GLESDynamicLibrary::glDeleteQueries_ = nullptr;
 GLESDynamicLibrary::glDeleteShaderFunction GLESDynamicLibrary::glDeleteShader_ = nullptr;
+GLESDynamicLibrary::glDeleteSyncFunction GLESDynamicLibrary::glDeleteSync_ = nullptr;
 GLESDynamicLibrary::glDeleteTexturesFunction GLESDynamicLibrary::glDeleteTextures_ = nullptr;
 GLESDynamicLibrary::glDeleteVertexArraysFunction GLESDynamicLibrary::glDeleteVertexArrays_ = nullptr;
 GLESDynamicLibrary::glDetachShaderFunction GLESDynamicLibrary::glDetachShader_ = nullptr;
+GLESDynamicLibrary::glDisableVertexAttribArrayFunction GLESDynamicLibrary::glDisableVertexAttribArray_ = nullptr;
 GLESDynamicLibrary::glDrawArraysFunction GLESDynamicLibrary::glDrawArrays_ = nullptr;
+GLESDynamicLibrary::glDrawArraysInstancedFunction GLESDynamicLibrary::glDrawArraysInstanced_ = nullptr;
 GLESDynamicLibrary::glDrawElementsFunction GLESDynamicLibrary::glDrawElements_ = nullptr;
+GLESDynamicLibrary::glDrawElementsInstancedFunction GLESDynamicLibrary::glDrawElementsInstanced_ = nullptr;
 GLESDynamicLibrary::glEnableVertexAttribArrayFunction GLESDynamicLibrary::glEnableVertexAttribArray_ = nullptr;
+GLESDynamicLibrary::glEndQueryFunction GLESDynamicLibrary::glEndQuery_ = nullptr;
+GLESDynamicLibrary::glFenceSyncFunction GLESDynamicLibrary::glFenceSync_ = nullptr;
 GLESDynamicLibrary::glFramebufferTexture2DFunction GLESDynamicLibrary::glFramebufferTexture2D_ = nullptr;
 GLESDynamicLibrary::glGenBuffersFunction GLESDynamicLibrary::glGenBuffers_ = nullptr;
 GLESDynamicLibrary::glGenerateMipmapFunction GLESDynamicLibrary::glGenerateMipmap_ = nullptr;
 GLESDynamicLibrary::glGenFramebuffersFunction GLESDynamicLibrary::glGenFramebuffers_ = nullptr;
+GLESDynamicLibrary::glGenQueriesFunction GLESDynamicLibrary::glGenQueries_ = nullptr;
 GLESDynamicLibrary::glGenTexturesFunction GLESDynamicLibrary::glGenTextures_ = nullptr;
 GLESDynamicLibrary::glGenVertexArraysFunction GLESDynamicLibrary::glGenVertexArrays_ = nullptr;
 GLESDynamicLibrary::glGetAttribLocationFunction GLESDynamicLibrary::glGetAttribLocation_ = nullptr;
+GLESDynamicLibrary::glGetProgramBinaryFunction GLESDynamicLibrary::glGetProgramBinary_ = nullptr;
 GLESDynamicLibrary::glGetProgramInfoLogFunction GLESDynamicLibrary::glGetProgramInfoLog_ = nullptr;
 GLESDynamicLibrary::glGetProgramivFunction GLESDynamicLibrary::glGetProgramiv_ = nullptr;
+GLESDynamicLibrary::glGetQueryObjectui64vFunction GLESDynamicLibrary::glGetQueryObjectui64v_ = nullptr;
+GLESDynamicLibrary::glGetQueryObjectuivFunction GLESDynamicLibrary::glGetQueryObjectuiv_ = nullptr;
 GLESDynamicLibrary::glGetShaderInfoLogFunction GLESDynamicLibrary::glGetShaderInfoLog_ = nullptr;
 GLESDynamicLibrary::glGetShaderivFunction GLESDynamicLibrary::glGetShaderiv_ = nullptr;
 GLESDynamicLibrary::glGetStringiFunction GLESDynamicLibrary::glGetStringi_ = nullptr;
 GLESDynamicLibrary::glGetUniformLocationFunction GLESDynamicLibrary::glGetUniformLocation_ = nullptr;
 GLESDynamicLibrary::glIsProgramFunction GLESDynamicLibrary::glIsProgram_ = nullptr;
 GLESDynamicLibrary::glLinkProgramFunction GLESDynamicLibrary::glLinkProgram_ = nullptr;
+GLESDynamicLibrary::glMapBufferRangeFunction GLESDynamicLibrary::glMapBufferRange_ = nullptr;
+GLESDynamicLibrary::glProgramBinaryFunction GLESDynamicLibrary::glProgramBinary_ = nullptr;
+GLESDynamicLibrary::glProgramParameteriFunction GLESDynamicLibrary::glProgramParameteri_ = nullptr;
 GLESDynamicLibrary::glReleaseShaderCompilerFunction GLESDynamicLibrary::glReleaseShaderCompiler_ = nullptr;
 GLESDynamicLibrary::glShaderSourceFunction GLESDynamicLibrary::glShaderSource_ = nullptr;
 GLESDynamicLibrary::glTexImage2DMultisampleFunction GLESDynamicLibrary::glTexImage2DMultisample_ = nullptr;
@@ -71,7 +87,9 @@ GLESDynamicLibrary::glUniform4fFunction GLESDynamicLibrary::glUniform4f_ = nullp
 GLESDynamicLibrary::glUniform4fvFunction GLESDynamicLibrary::glUniform4fv_ = nullptr;
 GLESDynamicLibrary::glUniformMatrix3fvFunction GLESDynamicLibrary::glUniformMatrix3fv_ = nullptr;
 GLESDynamicLibrary::glUniformMatrix4fvFunction GLESDynamicLibrary::glUniformMatrix4fv_ = nullptr;
+GLESDynamicLibrary::glUnmapBufferFunction GLESDynamicLibrary::glUnmapBuffer_ = nullptr;
 GLESDynamicLibrary::glUseProgramFunction GLESDynamicLibrary::glUseProgram_ = nullptr;
+GLESDynamicLibrary::glVertexAttribDivisorFunction GLESDynamicLibrary::glVertexAttribDivisor_ = nullptr;
 GLESDynamicLibrary::glVertexAttribPointerFunction GLESDynamicLibrary::glVertexAttribPointer_ = nullptr;
 GLESDynamicLibrary::glVertexAttribIPointerFunction GLESDynamicLibrary::glVertexAttribIPointer_ = nullptr;
 
@@ -84,12 +102,14 @@ bool GLESDynamicLibrary::initialize()
 
 	initializeFunction(glActiveTexture_, "glActiveTexture");
 	initializeFunction(glAttachShader_, "glAttachShader");
+	initializeFunction(glBeginQuery_, "glBeginQuery");
 	initializeFunction(glBindBuffer_, "glBindBuffer");
 	initializeFunction(glBindFramebuffer_, "glBindFramebuffer");
 	initializeFunction(glBindVertexArray_, "glBindVertexArray");
 	initializeFunction(glBufferData_, "glBufferData");
 	initializeFunction(glCheckFramebufferStatus_, "glCheckFramebufferStatus");
 	initializeFunction(glClearDepthf_, "glClearDepthf");
+	initializeFunction(glClientWaitSync_, "glClientWaitSync");
 	initializeFunction(glCompileShader_, "glCompileShader");
 	initializeFunction(glCompressedTexImage2D_, "glCompressedTexImage2D");
 	initializeFunction(glCreateProgram_, "glCreateProgram");
@@ -98,28 +118,42 @@ bool GLESDynamicLibrary::initialize()
 	initializeFunction(glDeleteBuffers_, "glDeleteBuffers");
 	initializeFunction(glDeleteFramebuffers_, "glDeleteFramebuffers");
 	initializeFunction(glDeleteProgram_, "glDeleteProgram");
+	initializeFunction(glDeleteQueries_, "glDeleteQueries");
 	initializeFunction(glDeleteShader_, "glDeleteShader");
+	initializeFunction(glDeleteSync_, "glDeleteSync");
 	initializeFunction(glDeleteTextures_, "glDeleteTextures");
 	initializeFunction(glDeleteVertexArrays_, "glDeleteVertexArrays");
 	initializeFunction(glDetachShader_, "glDetachShader");
+	initializeFunction(glDisableVertexAttribArray_, "glDisableVertexAttribArray");
 	initializeFunction(glDrawArrays_, "glDrawArrays");
+	initializeFunction(glDrawArraysInstanced_, "glDrawArraysInstanced");
 	initializeFunction(glDrawElements_, "glDrawElements");
+	initializeFunction(glDrawElementsInstanced_, "glDrawElementsInstanced");
 	initializeFunction(glEnableVertexAttribArray_, "glEnableVertexAttribArray");
+	initializeFunction(glEndQuery_, "glEndQuery");
+	initializeFunction(glFenceSync_, "glFenceSync");
 	initializeFunction(glFramebufferTexture2D_, "glFramebufferTexture2D");
 	initializeFunction(glGenBuffers_, "glGenBuffers");
 	initializeFunction(glGenerateMipmap_, "glGenerateMipmap");
 	initializeFunction(glGenFramebuffers_, "glGenFramebuffers");
+	initializeFunction(glGenQueries_, "glGenQueries");
 	initializeFunction(glGenTextures_, "glGenTextures");
 	initializeFunction(glGenVertexArrays_, "glGenVertexArrays");
 	initializeFunction(glGetAttribLocation_, "glGetAttribLocation");
+	initializeFunction(glGetProgramBinary_, "glGetProgramBinary");
 	initializeFunction(glGetProgramInfoLog_, "glGetProgramInfoLog");
 	initializeFunction(glGetProgramiv_, "glGetProgramiv");
+	initializeFunction(glGetQueryObjectui64v_, "glGetQueryObjectui64v");
+	initializeFunction(glGetQueryObjectuiv_, "glGetQueryObjectuiv");
 	initializeFunction(glGetShaderInfoLog_, "glGetShaderInfoLog");
 	initializeFunction(glGetShaderiv_, "glGetShaderiv");
 	initializeFunction(glGetStringi_, "glGetStringi");
 	initializeFunction(glGetUniformLocation_, "glGetUniformLocation");
 	initializeFunction(glIsProgram_, "glIsProgram");
 	initializeFunction(glLinkProgram_, "glLinkProgram");
+	initializeFunction(glMapBufferRange_, "glMapBufferRange");
+	initializeFunction(glProgramBinary_, "glProgramBinary");
+	initializeFunction(glProgramParameteri_, "glProgramParameteri");
 	initializeFunction(glReleaseShaderCompiler_, "glReleaseShaderCompiler");
 	initializeFunction(glShaderSource_, "glShaderSource");
 	initializeFunction(glTexImage2DMultisample_ , "glTexImage2DMultisample");
@@ -135,7 +169,9 @@ bool GLESDynamicLibrary::initialize()
 	initializeFunction(glUniform4fv_, "glUniform4fv");
 	initializeFunction(glUniformMatrix3fv_, "glUniformMatrix3fv");
 	initializeFunction(glUniformMatrix4fv_, "glUniformMatrix4fv");
+	initializeFunction(glUnmapBuffer_, "glUnmapBuffer");
 	initializeFunction(glUseProgram_, "glUseProgram");
+	initializeFunction(glVertexAttribDivisor_, "glVertexAttribDivisor");
 	initializeFunction(glVertexAttribPointer_, "glVertexAttribPointer");
 	initializeFunction(glVertexAttribIPointer_, "glVertexAttribIPointer");
 
@@ -160,12 +196,14 @@ void GLESDynamicLibrary::release()
 {
 	glActiveTexture_ = nullptr;
 	glAttachShader_ = nullptr;
+	glBeginQuery_ = nullptr;
 	glBindBuffer_ = nullptr;
 	glBindFramebuffer_ = nullptr;
 	glBindVertexArray_ = nullptr;
 	glBufferData_ = nullptr;
 	glCheckFramebufferStatus_ = nullptr;
 	glClearDepthf_ = nullptr;
+	glClientWaitSync_ = nullptr;
 	glCompileShader_ = nullptr;
 	glCompressedTexImage2D_ = nullptr;
 	glCreateProgram_ = nullptr;
@@ -174,28 +212,42 @@ void GLESDynamicLibrary::release()
 	glDeleteBuffers_ = nullptr;
 	glDeleteFramebuffers_ = nullptr;
 	glDeleteProgram_ = nullptr;
+	glDeleteQueries_ = nullptr;
 	glDeleteShader_ = nullptr;
+	glDeleteSync_ = nullptr;
 	glDeleteTextures_ = nullptr;
 	glDeleteVertexArrays_ = nullptr;
 	glDetachShader_ = nullptr;
+	glDisableVertexAttribArray_ = nullptr;
 	glDrawArrays_ = nullptr;
+	glDrawArraysInstanced_ = nullptr;
 	glDrawElements_ = nullptr;
+	glDrawElementsInstanced_ = nullptr;
 	glEnableVertexAttribArray_ = nullptr;
+	glEndQuery_ = nullptr;
+	glFenceSync_ = nullptr;
 	glFramebufferTexture2D_ = nullptr;
 	glGenBuffers_ = nullptr;
 	glGenerateMipmap_ = nullptr;
 	glGenFramebuffers_ = nullptr;
+	glGenQueries_ = nullptr;
 	glGenTextures_ = nullptr;
 	glGenVertexArrays_ = nullptr;
 	glGetAttribLocation_ = nullptr;
+	glGetProgramBinary_ = nullptr;
 	glGetProgramInfoLog_ = nullptr;
 	glGetProgramiv_ = nullptr;
+	glGetQueryObjectui64v_ = nullptr;
+	glGetQueryObjectuiv_ = nullptr;
 	glGetShaderInfoLog_ = nullptr;
 	glGetShaderiv_ = nullptr;
 	glGetStringi_ = nullptr;
 	glGetUniformLocation_ = nullptr;
 	glIsProgram_ = nullptr;
 	glLinkProgram_ = nullptr;
+	glMapBufferRange_ = nullptr;
+	glProgramBinary_ = nullptr;
+	glProgramParameteri_ = nullptr;
 	glReleaseShaderCompiler_ = nullptr;
 	glShaderSource_ = nullptr;
 	glTexImage2DMultisample_ = nullptr;
@@ -211,7 +263,9 @@ void GLESDynamicLibrary::release()
 	glUniform4fv_ = nullptr;
 	glUniformMatrix3fv_ = nullptr;
 	glUniformMatrix4fv_ = nullptr;
+	glUnmapBuffer_ = nullptr;
 	glUseProgram_ = nullptr;
+	glVertexAttribDivisor_ = nullptr;
 	glVertexAttribPointer_ = nullptr;
 	glVertexAttribIPointer_ = nullptr;
 }
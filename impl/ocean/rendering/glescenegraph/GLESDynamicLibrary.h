@@ -27,12 +27,14 @@ namespace Ocean
 
 #define glActiveTexture(a)                                 Rendering::GLESceneGraph::GLESDynamicLibrary::glActiveTexture_(a)
 #define glAttachShader(a, b)                               Rendering::GLESceneGraph::GLESDynamicLibrary::glAttachShader_(a, b)
+#define glBeginQuery(a, b)                                 Rendering::GLESceneGraph::GLESDynamicLibrary::glBeginQuery_(a, b)
 #define glBindBuffer(a, b)                                 Rendering::GLESceneGraph::GLESDynamicLibrary::glBindBuffer_(a, b)
 #define glBindFramebuffer(a, b)                            Rendering::GLESceneGraph::GLESDynamicLibrary::glBindFramebuffer_(a, b)
 #define glBindVertexArray(a)                               Rendering::GLESceneGraph::GLESDynamicLibrary::glBindVertexArray_(a)
 #define glBufferData(a, b, c, d)                           Rendering::GLESceneGraph::GLESDynamicLibrary::glBufferData_(a, b, c, d)
 #define glCheckFramebufferStatus(a)                        Rendering::GLESceneGraph::GLESDynamicLibrary::glCheckFramebufferStatus_(a)
 #define glClearDepthf(a)                                   Rendering::GLESceneGraph::GLESDynamicLibrary::glClearDepthf_(a)
+#define glClientWaitSync(a, b, c)                          Rendering::GLESceneGraph::GLESDynamicLibrary::glClientWaitSync_(a, b, c)
 #define glCompileShader(a)                                 Rendering::GLESceneGraph::GLESDynamicLibrary::glCompileShader_(a)
 #define glCompressedTexImage2D(a, b, c, d, e, f, g, h)     Rendering::GLESceneGraph::GLESDynamicLibrary::glCompressedTexImage2D_(a, b, c, d, e, f, g, h)
 #define glCreateProgram()                                  Rendering::GLESceneGraph::GLESDynamicLibrary::glCreateProgram_()
@@ -41,28 +43,42 @@ namespace Ocean
 #define glDeleteBuffers(a, b)                              Rendering::GLESceneGraph::GLESDynamicLibrary::glDeleteBuffers_(a, b)
 #define glDeleteFramebuffers(a, b)                         Rendering::GLESceneGraph::GLESDynamicLibrary::glDeleteFramebuffers_(a, b)
 #define glDeleteProgram(a)                                 Rendering::GLESceneGraph::GLESDynamicLibrary::glDeleteProgram_(a)
+#define glDeleteQueries(a, b)                              Rendering::GLESceneGraph::GLESDynamicLibrary::glDeleteQueries_(a, b)
 #define glDeleteShader(a)                                  Rendering::GLESceneGraph::GLESDynamicLibrary::glDeleteShader_(a)
+#define glDeleteSync(a)                                    Rendering::GLESceneGraph::GLESDynamicLibrary::glDeleteSync_(a)
 #define glDeleteTextures(a, b)                             Rendering::GLESceneGraph::GLESDynamicLibrary::glDeleteTextures_(a, b)
 #define glDeleteVertexArrays(a, b)                         Rendering::GLESceneGraph::GLESDynamicLibrary::glDeleteVertexArrays_(a, b)
 #define glDetachShader(a, b)                               Rendering::GLESceneGraph::GLESDynamicLibrary::glDetachShader_(a, b)
+#define glDisableVertexAttribArray(a)                      Rendering::GLESceneGraph::GLESDynamicLibrary::glDisableVertexAttribArray_(a)
 #define glDrawArrays(a, b, c)                              Rendering::GLESceneGraph::GLESDynamicLibrary::glDrawArrays_(a, b, c)
+#define glDrawArraysInstanced(a, b, c, d)                  Rendering::GLESceneGraph::GLESDynamicLibrary::glDrawArraysInstanced_(a, b, c, d)
 #define glDrawElements(a, b, c, d)                         Rendering::GLESceneGraph::GLESDynamicLibrary::glDrawElements_(a, b, c, d)
+#define glDrawElementsInstanced(a, b, c, d, e)             Rendering::GLESceneGraph::GLESDynamicLibrary::glDrawElementsInstanced_(a, b, c, d, e)
 #define glEnableVertexAttribArray(a)                       Rendering::GLESceneGraph::GLESDynamicLibrary::glEnableVertexAttribArray_(a)
+#define glEndQuery(a)                                      Rendering::GLESceneGraph::GLESDynamicLibrary::glEndQuery_(a)
+#define glFenceSync(a, b)                                  Rendering::GLESceneGraph::GLESDynamicLibrary::glFenceSync_(a, b)
 #define glFramebufferTexture2D(a, b, c, d, e)              Rendering::GLESceneGraph::GLESDynamicLibrary::glFramebufferTexture2D_(a, b, c, d, e)
 #define glGenBuffers(a, b)                                 Rendering::GLESceneGraph::GLESDynamicLibrary::glGenBuffers_(a, b)
 #define glGenerateMipmap(a)                                Rendering::GLESceneGraph::GLESDynamicLibrary::glGenerateMipmap_(a)
 #define glGenFramebuffers(a, b)                            Rendering::GLESceneGraph::GLESDynamicLibrary::glGenFramebuffers_(a, b)
+#define glGenQueries(a, b)                                 Rendering::GLESceneGraph::GLESDynamicLibrary::glGenQueries_(a, b)
 #define glGenTextures(a, b)                                Rendering::GLESceneGraph::GLESDynamicLibrary::glGenTextures_(a, b)
 #define glGenVertexArrays(a, b)                            Rendering::GLESceneGraph::GLESDynamicLibrary::glGenVertexArrays_(a, b)
 #define glGetAttribLocation(a, b)                          Rendering::GLESceneGraph::GLESDynamicLibrary::glGetAttribLocation_(a, b)
+#define glGetProgramBinary(a, b, c, d, e)                  Rendering::GLESceneGraph::GLESDynamicLibrary::glGetProgramBinary_(a, b, c, d, e)
 #define glGetProgramInfoLog(a, b, c, d)                    Rendering::GLESceneGraph::GLESDynamicLibrary::glGetProgramInfoLog_(a, b, c, d)
 #define glGetProgramiv(a, b, c)                            Rendering::GLESceneGraph::GLESDynamicLibrary::glGetProgramiv_(a, b, c)
+#define glGetQueryObjectui64v(a, b, c)                     Rendering::GLESceneGraph::GLESDynamicLibrary::glGetQueryObjectui64v_(a, b, c)
+#define glGetQueryObjectuiv(a, b, c)                       Rendering::GLESceneGraph::GLESDynamicLibrary::glGetQueryObjectuiv_(a, b, c)
 #define glGetShaderInfoLog(a, b, c, d)                     Rendering::GLESceneGraph::GLESDynamicLibrary::glGetShaderInfoLog_(a, b, c, d)
 #define glGetShaderiv(a, b, c)                             Rendering::GLESceneGraph::GLESDynamicLibrary::glGetShaderiv_(a, b, c)
 #define glGetStringi(a, b)                                 Rendering::GLESceneGraph::GLESDynamicLibrary::glGetStringi_(a, b)
 #define glGetUniformLocation(a, b)                         Rendering::GLESceneGraph::GLESDynamicLibrary::glGetUniformLocation_(a, b)
 #define glIsProgram(a)                                     Rendering::GLESceneGraph::GLESDynamicLibrary::glIsProgram_(a)
 #define glLinkProgram(a)                                   Rendering::GLESceneGraph::GLESDynamicLibrary::glLinkProgram_(a)
+#define glMapBufferRange(a, b, c, d)                       Rendering::GLESceneGraph::GLESDynamicLibrary::glMapBufferRange_(a, b, c, d)
+#define glProgramBinary(a, b, c, d)                        Rendering::GLESceneGraph::GLESDynamicLibrary::glProgramBinary_(a, b, c, d)
+#define glProgramParameteri(a, b, c)                       Rendering::GLESceneGraph::GLESDynamicLibrary::glProgramParameteri_(a, b, c)
 #define glReleaseShaderCompiler()                          Rendering::GLESceneGraph::GLESDynamicLibrary::glReleaseShaderCompiler_()
 #define glShaderSource(a, b, c, d)                         Rendering::GLESceneGraph::GLESDynamicLibrary::glShaderSource_(a, b, c, d)
 #define glTexImage2DMultisample(a, b, c, d, e, f)          Rendering::GLESceneGraph::GLESDynamicLibrary::glTexImage2DMultisample_(a, b, c, d, e, f)
@@ -78,7 +94,9 @@ namespace Ocean
 #define glUniform1fv(a, b, c)                              Rendering::GLESceneGraph::GLESDynamicLibrary::glUniform1fv_(a, b, c)
 #define glUniformMatrix3fv(a, b, c, d)                     Rendering::GLESceneGraph::GLESDynamicLibrary::glUniformMatrix3fv_(a, b, c, d)
 #define glUniformMatrix4fv(a, b, c, d)                     Rendering::GLESceneGraph::GLESDynamicLibrary::glUniformMatrix4fv_(a, b, c, d)
+#define glUnmapBuffer(a)                                   Rendering::GLESceneGraph::GLESDynamicLibrary::glUnmapBuffer_(a)
 #define glUseProgram(a)                                    Rendering::GLESceneGraph::GLESDynamicLibrary::glUseProgram_(a)
+#define glVertexAttribDivisor(a, b)                        Rendering::GLESceneGraph::GLESDynamicLibrary::glVertexAttribDivisor_(a, b)
 #define glVertexAttribPointer(a, b, c, d, e, f)            Rendering::GLESceneGraph::GLESDynamicLibrary::glVertexAttribPointer_(a, b, c, d, e, f)
 #define glVertexAttribIPointer(a, b, c, d, e)              Rendering::GLESceneGraph::GLESDynamicLibrary::glVertexAttribIPointer_(a, b, c, d, e)
 
@@ -100,12 +118,14 @@ class OCEAN_RENDERING_GLES_EXPORT GLESDynamicLibrary
 
 		using glActiveTextureFunction = void (__stdcall *)(GLenum texture);
 		using glAttachShaderFunction = void (__stdcall *)(GLuint, GLuint);
+		using glBeginQueryFunction = void (__stdcall *)(GLenum target, GLuint id);
 		using glBindBufferFunction = void (__stdcall *)(GLenum, GLuint);
 		using glBindFramebufferFunction = void (__stdcall *)(GLenum target, GLuint framebuffer);
 		using glBindVertexArrayFunction = void (__stdcall *)(GLuint  array);
 		using glBufferDataFunction = void (__stdcall *)(GLenum, GLsizeiptr, const void*, GLenum);
 		using glCheckFramebufferStatusFunction = GLenum (__stdcall *)(GLenum target);
 		using glClearDepthfFunction = void (__stdcall *)(GLclampf);
+		using glClientWaitSyncFunction = GLenum (__stdcall *)(GLsync sync, GLbitfield flags, GLuint64 timeout);
 		using glCompileShaderFunction = void (__stdcall *)(GLuint);
 		using glCompressedTexImage2DFunction = void (__stdcall *)(GLenum, GLint, GLenum, GLsizei, GLsizei, GLint, GLsizei, const void*);
 		using glCreateProgramFunction = GLuint (__stdcall *)();
@@ -114,28 +134,42 @@ class OCEAN_RENDERING_GLES_EXPORT GLESDynamicLibrary
 		using glDeleteBuffersFunction = void (__stdcall *)(GLsizei, const GLuint*);
 		using glDeleteFramebuffersFunction = void (__stdcall *)(GLsizei n, const GLuint * framebuffers);
 		using glDeleteProgramFunction = void (__stdcall *)(GLuint);
+		using glDeleteQueriesFunction = void (__stdcall *)(GLsizei n, const GLuint* ids);
 		using glDeleteShaderFunction = void (__stdcall *)(GLuint);
+		using glDeleteSyncFunction = void (__stdcall *)(GLsync sync);
 		using glDeleteTexturesFunction = void (__stdcall *)(GLsizei, const GLuint*);
 		using glDeleteVertexArraysFunction = void (__stdcall *)(GLsizei, const GLuint*);
 		using glDetachShaderFunction = void (__stdcall *)(GLuint, GLuint);
+		using glDisableVertexAttribArrayFunction = void (__stdcall *)(GLuint index);
 		using glDrawArraysFunction = void (__stdcall *)(GLenum, GLint, GLsizei);
+		using glDrawArraysInstancedFunction = void (__stdcall *)(GLenum, GLint, GLsizei, GLsizei);
 		using glDrawElementsFunction = void (__stdcall *)(GLenum, GLsizei, GLenum, const void*);
+		using glDrawElementsInstancedFunction = void (__stdcall *)(GLenum, GLsizei, GLenum, const void*, GLsizei);
 		using glEnableVertexAttribArrayFunction = void (__stdcall *)(GLuint index);
+		using glEndQueryFunction = void (__stdcall *)(GLenum target);
+		using glFenceSyncFunction = GLsync (__stdcall *)(GLenum condition, GLbitfield flags);
 		using glFramebufferTexture2DFunction = void (__stdcall *)(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level);
 		using glGenBuffersFunction = void (__stdcall *)(GLsizei, GLuint*);
 		using glGenerateMipmapFunction = void (__stdcall *)(GLenum target);
 		using glGenFramebuffersFunction = void (__stdcall *)(GLsizei n, GLuint *ids);
+		using glGenQueriesFunction = void (__stdcall *)(GLsizei n, GLuint* ids);
 		using glGenTexturesFunction = void (__stdcall *)(GLsizei, GLuint*);
 		using glGenVertexArraysFunction = void (__stdcall *)(GLsizei n, GLuint *arrays);
 		using glGetAttribLocationFunction = int (__stdcall *)(GLuint, const char*);
+		using glGetProgramBinaryFunction = void (__stdcall *)(GLuint program, GLsizei bufSize, GLsizei* length, GLenum* binaryFormat, void* binary);
 		using glGetProgramInfoLogFunction = void (__stdcall *)(GLuint, GLsizei, GLsizei*, char*);
 		using glGetProgramivFunction = void (__stdcall *)(GLuint, GLenum, GLint*);
+		using glGetQueryObjectui64vFunction = void (__stdcall *)(GLuint id, GLenum pname, GLuint64* params);
+		using glGetQueryObjectuivFunction = void (__stdcall *)(GLuint id, GLenum pname, GLuint* params);
 		using glGetShaderInfoLogFunction = void (__stdcall *)(GLuint, GLsizei, GLsizei*, char*);
 		using glGetShaderivFunction = void (__stdcall *)(GLuint, GLenum, GLint*);
 		using glGetStringiFunction = GLubyte* (__stdcall *)(GLenum, GLuint);
 		using glGetUniformLocationFunction = int (__stdcall *)(GLuint, const char*);
 		using glIsProgramFunction = GLboolean (__stdcall *)(GLuint program);
 		using glLinkProgramFunction = void (__stdcall *)(GLuint);
+		using glMapBufferRangeFunction = void* (__stdcall *)(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access);
+		using glProgramBinaryFunction = void (__stdcall *)(GLuint program, GLenum binaryFormat, const void* binary, GLsizei length);
+		using glProgramParameteriFunction = void (__stdcall *)(GLuint program, GLenum pname, GLint value);
 		using glReleaseShaderCompilerFunction = void (__stdcall *)();
 		using glShaderSourceFunction = void (__stdcall *)(GLuint, GLsizei, const char**, const GLint*);
 		using glTexImage2DMultisampleFunction = void (__stdcall *)(GLenum, GLsizei, GLenum, GLsizei, GLsizei, GLboolean);
@@ -151,7 +185,9 @@ class OCEAN_RENDERING_GLES_EXPORT GLESDynamicLibrary
 		using glUniform4fvFunction = void (__stdcall *)(GLint location, GLsizei count, const GLfloat* v);
 		using glUniformMatrix3fvFunction = void (__stdcall *)(GLint, GLsizei, GLboolean, const GLfloat*);
 		using glUniformMatrix4fvFunction = void (__stdcall *)(GLint, GLsizei, GLboolean, const GLfloat*);
+		using glUnmapBufferFunction = GLboolean (__stdcall *)(GLenum target);
 		using glUseProgramFunction = void (__stdcall *)(GLuint);
+		using glVertexAttribDivisorFunction = void (__stdcall *)(GLuint, GLuint);
 		using glVertexAttribPointerFunction = void (__stdcall *)(GLuint, GLint, GLenum, GLboolean, GLsizei, const void*);
 		using glVertexAttribIPointerFunction = void (__stdcall *)(GLuint, GLint, GLenum, GLsizei, const void*);
 
@@ -184,12 +220,14 @@ class OCEAN_RENDERING_GLES_EXPORT GLESDynamicLibrary
 
 		static glActiveTextureFunction glActiveTexture_;
 		static glAttachShaderFunction glAttachShader_;
+		static glBeginQueryFunction glBeginQuery_;
 		static glBindBufferFunction glBindBuffer_;
 		static glBindFramebufferFunction glBindFramebuffer_;
 		static glBindVertexArrayFunction glBindVertexArray_;
 		static glBufferDataFunction glBufferData_;
 		static glCheckFramebufferStatusFunction glCheckFramebufferStatus_;
 		static glClearDepthfFunction glClearDepthf_;
+		static glClientWaitSyncFunction glClientWaitSync_;
 		static glCompileShaderFunction glCompileShader_;
 		static glCompressedTexImage2DFunction glCompressedTexImage2D_;
 		static glCreateProgramFunction glCreateProgram_;
@@ -198,28 +236,42 @@ class OCEAN_RENDERING_GLES_EXPORT GLESDynamicLibrary
 		static glDeleteBuffersFunction glDeleteBuffers_;
 		static glDeleteFramebuffersFunction glDeleteFramebuffers_;
 		static glDeleteProgramFunction glDeleteProgram_;
+		static glDeleteQueriesFunction glDeleteQueries_;
 		static glDeleteShaderFunction glDeleteShader_;
+		static glDeleteSyncFunction glDeleteSync_;
 		static glDeleteTexturesFunction glDeleteTextures_;
 		static glDeleteVertexArraysFunction glDeleteVertexArrays_;
 		static glDetachShaderFunction glDetachShader_;
+		static glDisableVertexAttribArrayFunction glDisableVertexAttribArray_;
 		static glDrawArraysFunction glDrawArrays_;
+		static glDrawArraysInstancedFunction glDrawArraysInstanced_;
 		static glDrawElementsFunction glDrawElements_;
+		static glDrawElementsInstancedFunction glDrawElementsInstanced_;
 		static glEnableVertexAttribArrayFunction glEnableVertexAttribArray_;
+		static glEndQueryFunction glEndQuery_;
+		static glFenceSyncFunction glFenceSync_;
 		static glFramebufferTexture2DFunction glFramebufferTexture2D_;
 		static glGenBuffersFunction glGenBuffers_;
 		static glGenerateMipmapFunction glGenerateMipmap_;
 		static glGenFramebuffersFunction glGenFramebuffers_;
+		static glGenQueriesFunction glGenQueries_;
 		static glGenTexturesFunction glGenTextures_;
 		static glGenVertexArraysFunction glGenVertexArrays_;
 		static glGetAttribLocationFunction glGetAttribLocation_;
+		static glGetProgramBinaryFunction glGetProgramBinary_;
 		static glGetProgramInfoLogFunction glGetProgramInfoLog_;
 		static glGetProgramivFunction glGetProgramiv_;
+		static glGetQueryObjectui64vFunction glGetQueryObjectui64v_;
+		static glGetQueryObjectuivFunction glGetQueryObjectuiv_;
 		static glGetShaderInfoLogFunction glGetShaderInfoLog_;
 		static glGetShaderivFunction glGetShaderiv_;
 		static glGetStringiFunction glGetStringi_;
 		static glGetUniformLocationFunction glGetUniformLocation_;
 		static glIsProgramFunction glIsProgram_;
 		static glLinkProgramFunction glLinkProgram_;
+		static glMapBufferRangeFunction glMapBufferRange_;
+		static glProgramBinaryFunction glProgramBinary_;
+		static glProgramParameteriFunction glProgramParameteri_;
 		static glReleaseShaderCompilerFunction glReleaseShaderCompiler_;
 		static glShaderSourceFunction glShaderSource_;
 		static glTexImage2DMultisampleFunction glTexImage2DMultisample_;
@@ -235,7 +287,9 @@ class OCEAN_RENDERING_GLES_EXPORT GLESDynamicLibrary
 		static glUniform4fvFunction glUniform4fv_;
 		static glUniformMatrix3fvFunction glUniformMatrix3fv_;
 		static glUniformMatrix4fvFunction glUniformMatrix4fv_;
+		static glUnmapBufferFunction glUnmapBuffer_;
 		static glUseProgramFunction glUseProgram_;
+		static glVertexAttribDivisorFunction glVertexAttribDivisor_;
 		static glVertexAttribPointerFunction glVertexAttribPointer_;
 		static glVertexAttribIPointerFunction glVertexAttribIPointer_;
 };
@@ -50,6 +50,39 @@ bool GLESFrameTexture2D::setTexture(Frame&& frame)
 	frame_ = std::move(frame);
 	compressedFrame_.release();
 
+	dirtyRegions_.clear();
+	updateNeeded_ = true;
+
+	return true;
+}
+
+bool GLESFrameTexture2D::setTextureRegions(Frame&& frame, const CV::PixelBoundingBoxes& dirtyRegions)
+{
+	ocean_assert(frame.isValid());
+	if (!frame.isValid())
+	{
+		return false;
+	}
+
+	const ScopedLock scopedLock(objectLock);
+
+	const bool entireUpdatePending = updateNeeded_ && dirtyRegions_.empty();
+
+	if (dirtyRegions.empty() || entireUpdatePending || !frame_.isValid() || frame_.frameType() != frame.frameType())
+	{
+		return setTexture(std::move(frame));
+	}
+
+	if (!updateNeeded_)
+	{
+		dirtyRegions_.clear();
+	}
+
+	// regions of a previous update which has not been applied yet are applied with the new frame
+
+	dirtyRegions_.insert(dirtyRegions_.cend(), dirtyRegions.cbegin(), dirtyRegions.cend());
+
+	frame_ = std::move(frame);
 	updateNeeded_ = true;
 
 	return true;
@@ -68,6 +101,7 @@ bool GLESFrameTexture2D::setTexture(CompressedFrame&& compressedFrame)
 	compressedFrame_ = std::move(compressedFrame);
 	frame_.release();
 
+	dirtyRegions_.clear();
 	updateNeeded_ = true;
 
 	return true;
@@ -123,7 +157,11 @@ void GLESFrameTexture2D::onDynamicUpdate(const ViewRef& /*view*/, const Timestam
 
 		if (frame_.isValid())
 		{
-			if (!GLESTexture2D::updateTexture(frame_))
+			const bool result = dirtyRegions_.empty() ? GLESTexture2D::updateTexture(frame_) : GLESTexture2D::updateTextureRegions(frame_, dirtyRegions_);
+
+			dirtyRegions_.clear();
+
+			if (!result)
 			{
 				ocean_assert(false && "Failed to update texture!");
 				return;
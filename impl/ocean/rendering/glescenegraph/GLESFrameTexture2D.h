@@ -46,6 +46,12 @@ class OCEAN_RENDERING_GLES_EXPORT GLESFrameTexture2D final :
 		 */
 		bool setTexture(CompressedFrame&& compressedFrame) override;
 
+		/**
+		 * Updates individual regions of the texture with a given frame.
+		 * @see FrameTexture2D::setTextureRegions().
+		 */
+		bool setTextureRegions(Frame&& frame, const CV::PixelBoundingBoxes& dirtyRegions) override;
+
 		/**
 		 * Returns the frame type of this 2D texture.
 		 * @see Texture2D::frameType()
@@ -115,6 +121,9 @@ class OCEAN_RENDERING_GLES_EXPORT GLESFrameTexture2D final :
 		/// The texture's compressed frame, if any.
 		CompressedFrame compressedFrame_;
 
+		/// The regions of the frame which need to be updated, an empty set to update the entire texture.
+		CV::PixelBoundingBoxes dirtyRegions_;
+
 		/// True, if the texture needs to be updated.
 		bool updateNeeded_ = false;
 };
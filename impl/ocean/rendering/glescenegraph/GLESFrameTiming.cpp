@@ -0,0 +1,398 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "ocean/rendering/glescenegraph/GLESFrameTiming.h"
+#include "ocean/rendering/glescenegraph/GLESFramebuffer.h"
+
+#ifdef OCEAN_PLATFORM_BUILD_ANDROID
+	#include <EGL/egl.h>
+#endif
+
+#if defined(OCEAN_PLATFORM_BUILD_ANDROID)
+	// OpenGL ES provides timer queries via GL_EXT_disjoint_timer_query
+	#define OCEAN_RENDERING_GLES_TIME_ELAPSED GL_TIME_ELAPSED_EXT
+#elif !defined(OCEAN_PLATFORM_BUILD_APPLE_IOS_ANY)
+	// OpenGL 3.3+ provides timer queries as core functionality
+	#define OCEAN_RENDERING_GLES_TIME_ELAPSED GL_TIME_ELAPSED
+#endif
+
+namespace Ocean
+{
+
+namespace Rendering
+{
+
+namespace GLESceneGraph
+{
+
+void GLESFrameTiming::setEnabled(const bool enabled)
+{
+	const ScopedLock scopedLock(lock_);
+
+	enabled_ = enabled;
+}
+
+void GLESFrameTiming::setCompositorTiming(const double waitDuration, const double displayPeriod)
+{
+	ocean_assert(waitDuration >= 0.0);
+
+	const ScopedLock scopedLock(lock_);
+
+	if (!enabled_)
+	{
+		return;
+	}
+
+	nextWaitDuration_ = waitDuration;
+	nextDisplayPeriod_ = displayPeriod;
+}
+
+bool GLESFrameTiming::latestRecord(FrameRecord& record) const
+{
+	const ScopedLock scopedLock(lock_);
+
+	if (historyRecords_.empty())
+	{
+		return false;
+	}
+
+	const size_t latestIndex = historyRecords_.size() < numberHistoryRecords_ ? historyRecords_.size() - 1 : (nextHistoryRecord_ + numberHistoryRecords_ - 1) % numberHistoryRecords_;
+
+	record = historyRecords_[latestIndex];
+
+	return true;
+}
+
+GLESFrameTiming::FrameRecords GLESFrameTiming::records() const
+{
+	const ScopedLock scopedLock(lock_);
+
+	if (historyRecords_.size() < numberHistoryRecords_)
+	{
+		return historyRecords_;
+	}
+
+	FrameRecords orderedRecords;
+	orderedRecords.reserve(historyRecords_.size());
+
+	for (size_t n = 0; n < historyRecords_.size(); ++n)
+	{
+		orderedRecords.emplace_back(historyRecords_[(nextHistoryRecord_ + n) % historyRecords_.size()]);
+	}
+
+	return orderedRecords;
+}
+
+void GLESFrameTiming::setRecordCallback(const RecordCallback& recordCallback)
+{
+	const ScopedLock scopedLock(lock_);
+
+	recordCallback_ = recordCallback;
+}
+
+bool GLESFrameTiming::beginFrame(const GLESFramebuffer& framebuffer, const Timestamp& renderTimestamp)
+{
+	ocean_assert(!frameActive_ && activePass_ == maximalPasses_);
+
+	TemporaryScopedLock temporaryScopedLock(lock_);
+
+		if (!enabled_)
+		{
+			temporaryScopedLock.release();
+
+			if (numberPending_ != 0)
+			{
+				// the results of the remaining frames are still forwarded
+
+				readPendingFrames(false);
+			}
+
+			return false;
+		}
+
+		if (!gpuTimingSupportDetermined_)
+		{
+#if defined(OCEAN_PLATFORM_BUILD_ANDROID)
+
+			if (framebuffer.hasExtension("GL_EXT_disjoint_timer_query"))
+			{
+				glGetQueryObjectui64vEXT_ = PFNGLGETQUERYOBJECTUI64VEXTPROC(eglGetProcAddress("glGetQueryObjectui64vEXT"));
+				ocean_assert(glGetQueryObjectui64vEXT_ != nullptr);
+
+				gpuTimingSupported_ = glGetQueryObjectui64vEXT_ != nullptr;
+			}
+
+#elif defined(OCEAN_RENDERING_GLES_TIME_ELAPSED)
+
+			OCEAN_SUPPRESS_UNUSED_WARNING(framebuffer);
+
+			gpuTimingSupported_ = true;
+
+#else
+
+			OCEAN_SUPPRESS_UNUSED_WARNING(framebuffer);
+
+			gpuTimingSupported_ = false;
+
+#endif
+
+			gpuTimingSupportDetermined_ = true;
+		}
+
+		currentRecord_ = FrameRecord();
+		currentRecord_.frameIndex_ = frameCounter_++;
+		currentRecord_.renderTimestamp_ = renderTimestamp;
+		currentRecord_.waitDuration_ = nextWaitDuration_;
+		currentRecord_.displayPeriod_ = nextDisplayPeriod_;
+
+		nextWaitDuration_ = -1.0;
+		nextDisplayPeriod_ = -1.0;
+
+		const bool gpuTimingSupported = gpuTimingSupported_;
+
+	temporaryScopedLock.release();
+
+	if (gpuTimingSupported)
+	{
+		// reading the pending frames also resets the disjoint state of the GPU, so that previous disjoint operations do not invalidate this frame
+
+		readPendingFrames(false);
+
+		if (numberPending_ == numberPendingFrames_)
+		{
+			// the GPU is more than numberPendingFrames_ frames behind, we wait for the oldest frame to reuse its queries
+
+			readPendingFrames(true);
+		}
+
+#ifdef OCEAN_RENDERING_GLES_TIME_ELAPSED
+		if (!queriesCreated_)
+		{
+			for (PendingFrame& pendingFrame : pendingFrames_)
+			{
+				glGenQueries(GLsizei(maximalPasses_), pendingFrame.queries_);
+				ocean_assert(GL_NO_ERROR == glGetError());
+			}
+
+			queriesCreated_ = true;
+		}
+#endif
+	}
+
+	frameActive_ = true;
+
+	return true;
+}
+
+void GLESFrameTiming::beginPass(const size_t pass)
+{
+	ocean_assert(pass < maximalPasses_);
+	ocean_assert(activePass_ == maximalPasses_);
+
+	if (!frameActive_ || pass >= maximalPasses_ || activePass_ != maximalPasses_)
+	{
+		return;
+	}
+
+	currentRecord_.passes_ = std::max(currentRecord_.passes_, pass + 1);
+
+#ifdef OCEAN_RENDERING_GLES_TIME_ELAPSED
+	if (queriesCreated_)
+	{
+		ocean_assert(numberPending_ < numberPendingFrames_);
+		const PendingFrame& pendingFrame = pendingFrames_[(oldestPendingFrame_ + numberPending_) % numberPendingFrames_];
+
+		glBeginQuery(OCEAN_RENDERING_GLES_TIME_ELAPSED, pendingFrame.queries_[pass]);
+		ocean_assert(GL_NO_ERROR == glGetError());
+
+		activePass_ = pass;
+	}
+#endif
+}
+
+void GLESFrameTiming::endPass()
+{
+	if (activePass_ == maximalPasses_)
+	{
+		return;
+	}
+
+#ifdef OCEAN_RENDERING_GLES_TIME_ELAPSED
+	glEndQuery(OCEAN_RENDERING_GLES_TIME_ELAPSED);
+	ocean_assert(GL_NO_ERROR == glGetError());
+#endif
+
+	activePass_ = maximalPasses_;
+}
+
+void GLESFrameTiming::endFrame()
+{
+	if (!frameActive_)
+	{
+		return;
+	}
+
+	ocean_assert(activePass_ == maximalPasses_ && "A render pass has not been ended");
+	endPass();
+
+	frameActive_ = false;
+
+	if (queriesCreated_ && currentRecord_.passes_ != 0)
+	{
+		ocean_assert(numberPending_ < numberPendingFrames_);
+
+		PendingFrame& pendingFrame = pendingFrames_[(oldestPendingFrame_ + numberPending_) % numberPendingFrames_];
+		ocean_assert(!pendingFrame.pending_);
+
+		pendingFrame.record_ = currentRecord_;
+		pendingFrame.pending_ = true;
+
+		++numberPending_;
+	}
+	else
+	{
+		finishRecord(currentRecord_);
+	}
+}
+
+void GLESFrameTiming::release()
+{
+	ocean_assert(!frameActive_);
+
+	if (numberPending_ != 0)
+	{
+		readPendingFrames(true);
+	}
+
+#ifdef OCEAN_RENDERING_GLES_TIME_ELAPSED
+	if (queriesCreated_)
+	{
+		for (PendingFrame& pendingFrame : pendingFrames_)
+		{
+			glDeleteQueries(GLsizei(maximalPasses_), pendingFrame.queries_);
+			ocean_assert(GL_NO_ERROR == glGetError());
+
+			for (GLuint& query : pendingFrame.queries_)
+			{
+				query = 0u;
+			}
+		}
+	}
+#endif
+
+	queriesCreated_ = false;
+
+	const ScopedLock scopedLock(lock_);
+
+	gpuTimingSupportDetermined_ = false;
+	gpuTimingSupported_ = false;
+}
+
+void GLESFrameTiming::readPendingFrames(const bool wait)
+{
+#ifdef OCEAN_RENDERING_GLES_TIME_ELAPSED
+
+	bool disjoint = false;
+
+	#ifdef OCEAN_PLATFORM_BUILD_ANDROID
+		// a disjoint operation invalidates the results of all queries which are currently in flight
+
+		GLint gpuDisjoint = 0;
+		glGetIntegerv(GL_GPU_DISJOINT_EXT, &gpuDisjoint);
+		ocean_assert(GL_NO_ERROR == glGetError());
+
+		disjoint = gpuDisjoint != 0;
+	#endif
+
+	while (numberPending_ != 0)
+	{
+		PendingFrame& pendingFrame = pendingFrames_[oldestPendingFrame_];
+		ocean_assert(pendingFrame.pending_);
+
+		FrameRecord& record = pendingFrame.record_;
+
+		if (disjoint)
+		{
+			record.gpuDisjoint_ = true;
+		}
+		else
+		{
+			ocean_assert(record.passes_ >= 1 && record.passes_ <= maximalPasses_);
+
+			// the queries finish in order, so that the query of the last pass is checked only
+
+			GLuint available = GL_FALSE;
+			glGetQueryObjectuiv(pendingFrame.queries_[record.passes_ - 1], GL_QUERY_RESULT_AVAILABLE, &available);
+			ocean_assert(GL_NO_ERROR == glGetError());
+
+			if (available == GL_FALSE && !wait)
+			{
+				break;
+			}
+
+			for (size_t pass = 0; pass < record.passes_; ++pass)
+			{
+				GLuint64 nanoseconds = 0ull;
+
+	#ifdef OCEAN_PLATFORM_BUILD_ANDROID
+				ocean_assert(glGetQueryObjectui64vEXT_ != nullptr);
+				glGetQueryObjectui64vEXT_(pendingFrame.queries_[pass], GL_QUERY_RESULT, &nanoseconds);
+	#else
+				glGetQueryObjectui64v(pendingFrame.queries_[pass], GL_QUERY_RESULT, &nanoseconds);
+	#endif
+				ocean_assert(GL_NO_ERROR == glGetError());
+
+				record.gpuPassDurations_[pass] = Timestamp::nanoseconds2seconds(int64_t(nanoseconds));
+			}
+		}
+
+		pendingFrame.pending_ = false;
+
+		oldestPendingFrame_ = (oldestPendingFrame_ + 1) % numberPendingFrames_;
+		--numberPending_;
+
+		finishRecord(record);
+	}
+
+#else
+
+	OCEAN_SUPPRESS_UNUSED_WARNING(wait);
+
+	ocean_assert(numberPending_ == 0);
+
+#endif // OCEAN_RENDERING_GLES_TIME_ELAPSED
+}
+
+void GLESFrameTiming::finishRecord(const FrameRecord& record)
+{
+	TemporaryScopedLock temporaryScopedLock(lock_);
+
+		if (historyRecords_.size() < numberHistoryRecords_)
+		{
+			historyRecords_.emplace_back(record);
+		}
+		else
+		{
+			historyRecords_[nextHistoryRecord_] = record;
+			nextHistoryRecord_ = (nextHistoryRecord_ + 1) % numberHistoryRecords_;
+		}
+
+		const RecordCallback recordCallback(recordCallback_);
+
+	temporaryScopedLock.release();
+
+	if (recordCallback)
+	{
+		recordCallback(record);
+	}
+}
+
+}
+
+}
+
+}
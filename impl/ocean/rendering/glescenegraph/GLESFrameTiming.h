@@ -0,0 +1,370 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#ifndef META_OCEAN_RENDERING_GLES_FRAME_TIMING_H
+#define META_OCEAN_RENDERING_GLES_FRAME_TIMING_H
+
+#include "ocean/rendering/glescenegraph/GLESceneGraph.h"
+#include "ocean/rendering/glescenegraph/GLESObject.h"
+
+#include "ocean/base/Callback.h"
+#include "ocean/base/Lock.h"
+#include "ocean/base/Timestamp.h"
+
+#include <vector>
+
+#ifdef OCEAN_PLATFORM_BUILD_ANDROID
+	#include <GLES2/gl2ext.h>
+#endif
+
+namespace Ocean
+{
+
+namespace Rendering
+{
+
+namespace GLESceneGraph
+{
+
+// Forward declaration.
+class GLESFramebuffer;
+
+/**
+ * This class records the CPU and GPU timings of the frames rendered by a framebuffer.
+ * For each frame, one record combines the CPU time of the scene traversal, the CPU time of the draw call submission, and the GPU time of each render pass.<br>
+ * Applications waiting for a compositor (e.g., OpenXR's xrWaitFrame) can add their wait time and the predicted display period to the record of the next frame.<br>
+ * This allows to determine whether a dropped frame was caused by the CPU or by the GPU.
+ *
+ * The GPU time is measured with timer queries (GL_EXT_disjoint_timer_query on OpenGL ES, core timer queries on OpenGL).<br>
+ * The results of the queries are read without stalling the pipeline, therefore a record is finished a few frames after the frame has been rendered.<br>
+ * Finished records can be polled, or can be forwarded to e.g., a tracing system via a callback function.<br>
+ * The timing is disabled by default, all functions apart from the render thread functions are thread-safe.
+ * @ingroup renderinggles
+ */
+class OCEAN_RENDERING_GLES_EXPORT GLESFrameTiming
+{
+	public:
+
+		/// The maximal number of render passes which can be measured in one frame, e.g., one for each eye.
+		static constexpr size_t maximalPasses_ = 2;
+
+		/**
+		 * This class holds the timings of one frame.
+		 */
+		class FrameRecord
+		{
+			public:
+
+				/**
+				 * Returns the GPU time of all render passes of the frame.
+				 * @return The GPU time in seconds, with range [0, infinity), -1 if the GPU time is not available
+				 */
+				inline double gpuDuration() const;
+
+				/**
+				 * Returns the CPU time of the frame, without the time the application waited for the compositor.
+				 * @return The CPU time of the traversal and the submission, in seconds, with range [0, infinity)
+				 */
+				inline double cpuDuration() const;
+
+			public:
+
+				/// The index of the frame, counted since the timing has been enabled.
+				unsigned int frameIndex_ = 0u;
+
+				/// The timestamp of the rendered frame.
+				Timestamp renderTimestamp_ = Timestamp(false);
+
+				/// The CPU time the application waited for the compositor before rendering the frame, in seconds, -1 if unknown.
+				double waitDuration_ = -1.0;
+
+				/// The display period predicted by the compositor, in seconds, -1 if unknown.
+				double displayPeriod_ = -1.0;
+
+				/// The CPU time to traverse the scenes, in seconds.
+				double traversalDuration_ = 0.0;
+
+				/// The CPU time to submit the draw calls, in seconds.
+				double submitDuration_ = 0.0;
+
+				/// The number of render passes of the frame, with range [0, maximalPasses_]
+				size_t passes_ = 0;
+
+				/// The GPU time of the individual render passes, in seconds, -1 if not available.
+				double gpuPassDurations_[maximalPasses_] = {-1.0, -1.0};
+
+				/// True, if the GPU timings of the frame have been invalidated by a disjoint operation of the GPU (e.g., a frequency change).
+				bool gpuDisjoint_ = false;
+		};
+
+		/**
+		 * Definition of a vector holding frame records.
+		 */
+		using FrameRecords = std::vector<FrameRecord>;
+
+		/**
+		 * Definition of a callback function for finished frame records.
+		 * The callback is invoked from the render thread.<br>
+		 * First parameter: The finished record
+		 */
+		using RecordCallback = Callback<void, const FrameRecord&>;
+
+	protected:
+
+		/// The number of frames which can wait for the results of their timer queries.
+		static constexpr size_t numberPendingFrames_ = 4;
+
+		/// The number of finished records which are kept.
+		static constexpr size_t numberHistoryRecords_ = 64;
+
+		/**
+		 * This class holds a frame waiting for the results of its timer queries.
+		 */
+		class PendingFrame
+		{
+			public:
+
+				/// The record of the frame.
+				FrameRecord record_;
+
+				/// The timer queries of the render passes.
+				GLuint queries_[maximalPasses_] = {0u, 0u};
+
+				/// True, if the frame is waiting for the results of its queries.
+				bool pending_ = false;
+		};
+
+	public:
+
+		/**
+		 * Enables or disables the timing.
+		 * @param enabled True, to record the timings of the upcoming frames
+		 */
+		void setEnabled(const bool enabled);
+
+		/**
+		 * Returns whether the timing is enabled.
+		 * @return True, if so
+		 */
+		inline bool isEnabled() const;
+
+		/**
+		 * Returns whether the GPU time can be measured on this platform.
+		 * The support is determined when the first frame is recorded.
+		 * @return True, if so
+		 */
+		inline bool isGPUTimingSupported() const;
+
+		/**
+		 * Sets the compositor timing of the next frame.
+		 * @param waitDuration The CPU time the application waited for the compositor, in seconds, with range [0, infinity)
+		 * @param displayPeriod The display period predicted by the compositor, in seconds, with range (0, infinity), -1 if unknown
+		 */
+		void setCompositorTiming(const double waitDuration, const double displayPeriod = -1.0);
+
+		/**
+		 * Returns the most recent finished record.
+		 * @param record The resulting record
+		 * @return True, if a finished record exists
+		 */
+		bool latestRecord(FrameRecord& record) const;
+
+		/**
+		 * Returns the most recent finished records.
+		 * @return The records, the most recent record is the last record
+		 */
+		FrameRecords records() const;
+
+		/**
+		 * Sets the callback function for finished records.
+		 * @param recordCallback The callback function, an invalid callback to remove a previously set callback
+		 */
+		void setRecordCallback(const RecordCallback& recordCallback);
+
+		/**
+		 * Begins a new frame, must be called from the render thread.
+		 * @param framebuffer The framebuffer rendering the frame, used to determine the supported extensions
+		 * @param renderTimestamp The timestamp of the frame
+		 * @return True, if the timing of the frame is recorded; False, if the timing is disabled
+		 */
+		bool beginFrame(const GLESFramebuffer& framebuffer, const Timestamp& renderTimestamp);
+
+		/**
+		 * Begins the GPU measurement of a render pass, must be called from the render thread in between beginFrame() and endFrame().
+		 * Render passes cannot be nested, and each pass must be ended before the next pass begins.
+		 * @param pass The index of the render pass, with range [0, maximalPasses_ - 1]
+		 */
+		void beginPass(const size_t pass);
+
+		/**
+		 * Ends the GPU measurement of the current render pass, must be called from the render thread.
+		 */
+		void endPass();
+
+		/**
+		 * Adds CPU time of the scene traversal to the current frame, must be called from the render thread.
+		 * @param duration The CPU time, in seconds, with range [0, infinity)
+		 */
+		inline void addTraversalDuration(const double duration);
+
+		/**
+		 * Adds CPU time of the draw call submission to the current frame, must be called from the render thread.
+		 * @param duration The CPU time, in seconds, with range [0, infinity)
+		 */
+		inline void addSubmitDuration(const double duration);
+
+		/**
+		 * Ends the current frame, must be called from the render thread.
+		 */
+		void endFrame();
+
+		/**
+		 * Releases the timer queries, must be called from the render thread while the context is still valid.
+		 */
+		void release();
+
+	protected:
+
+		/**
+		 * Reads the results of all pending frames whose timer queries have finished, must be called from the render thread.
+		 * @param wait True, to wait for the results of all pending frames; False, to read available results only
+		 */
+		void readPendingFrames(const bool wait);
+
+		/**
+		 * Finishes a record.
+		 * @param record The record to be finished
+		 */
+		void finishRecord(const FrameRecord& record);
+
+	protected:
+
+		/// The frames waiting for the results of their timer queries, used as ring buffer.
+		PendingFrame pendingFrames_[numberPendingFrames_];
+
+		/// The index of the oldest pending frame.
+		size_t oldestPendingFrame_ = 0;
+
+		/// The number of pending frames.
+		size_t numberPending_ = 0;
+
+		/// The record of the current frame, if the frame is recorded.
+		FrameRecord currentRecord_;
+
+		/// True, while a frame is recorded.
+		bool frameActive_ = false;
+
+		/// The index of the active render pass, maximalPasses_ if no pass is active.
+		size_t activePass_ = maximalPasses_;
+
+		/// True, if the timer queries have been created.
+		bool queriesCreated_ = false;
+
+		/// The counter of recorded frames.
+		unsigned int frameCounter_ = 0u;
+
+		/// The compositor wait time for the next frame, in seconds, -1 if unknown.
+		double nextWaitDuration_ = -1.0;
+
+		/// The compositor display period for the next frame, in seconds, -1 if unknown.
+		double nextDisplayPeriod_ = -1.0;
+
+		/// The finished records, used as ring buffer.
+		FrameRecords historyRecords_;
+
+		/// The index of the next history record to be replaced once the history is full.
+		size_t nextHistoryRecord_ = 0;
+
+		/// The callback function for finished records.
+		RecordCallback recordCallback_;
+
+		/// True, if the timing is enabled.
+		bool enabled_ = false;
+
+		/// True, if timer queries are supported, determined when the first frame is recorded.
+		bool gpuTimingSupported_ = false;
+
+		/// True, if the support of timer queries has been determined.
+		bool gpuTimingSupportDetermined_ = false;
+
+#ifdef OCEAN_PLATFORM_BUILD_ANDROID
+		/// The function pointer to glGetQueryObjectui64vEXT, which is not part of OpenGL ES.
+		PFNGLGETQUERYOBJECTUI64VEXTPROC glGetQueryObjectui64vEXT_ = nullptr;
+#endif
+
+		/// The lock of this object.
+		mutable Lock lock_;
+};
+
+inline double GLESFrameTiming::FrameRecord::gpuDuration() const
+{
+	if (passes_ == 0 || gpuDisjoint_)
+	{
+		return -1.0;
+	}
+
+	double duration = 0.0;
+
+	for (size_t n = 0; n < passes_; ++n)
+	{
+		if (gpuPassDurations_[n] < 0.0)
+		{
+			return -1.0;
+		}
+
+		duration += gpuPassDurations_[n];
+	}
+
+	return duration;
+}
+
+inline double GLESFrameTiming::FrameRecord::cpuDuration() const
+{
+	return traversalDuration_ + submitDuration_;
+}
+
+inline bool GLESFrameTiming::isEnabled() const
+{
+	const ScopedLock scopedLock(lock_);
+
+	return enabled_;
+}
+
+inline bool GLESFrameTiming::isGPUTimingSupported() const
+{
+	const ScopedLock scopedLock(lock_);
+
+	return gpuTimingSupported_;
+}
+
+inline void GLESFrameTiming::addTraversalDuration(const double duration)
+{
+	ocean_assert(duration >= 0.0);
+
+	if (frameActive_)
+	{
+		currentRecord_.traversalDuration_ += duration;
+	}
+}
+
+inline void GLESFrameTiming::addSubmitDuration(const double duration)
+{
+	ocean_assert(duration >= 0.0);
+
+	if (frameActive_)
+	{
+		currentRecord_.submitDuration_ += duration;
+	}
+}
+
+}
+
+}
+
+}
+
+#endif // META_OCEAN_RENDERING_GLES_FRAME_TIMING_H
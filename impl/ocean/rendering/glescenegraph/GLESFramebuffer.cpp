@@ -12,6 +12,8 @@
 #include "ocean/rendering/glescenegraph/GLESUndistortedBackground.h"
 #include "ocean/rendering/glescenegraph/GLESView.h"
 
+#include "ocean/base/HighPerformanceTimer.h"
+
 namespace Ocean
 {
 
@@ -96,6 +98,23 @@ GLESFramebuffer::StereoType GLESFramebuffer::stereoType() const
 	return stereoType_;
 }
 
+GLESTraverser::Statistics GLESFramebuffer::traverserStatistics() const
+{
+	const ScopedLock scopedLock(objectLock);
+
+	return traverser_.statistics();
+}
+
+void GLESFramebuffer::setViewCulling(const bool enabled, const Scalar minimalFeatureSize)
+{
+	ocean_assert(minimalFeatureSize >= 0);
+
+	const ScopedLock scopedLock(objectLock);
+
+	viewCulling_ = enabled;
+	minimalFeatureSize_ = std::max(Scalar(0), minimalFeatureSize);
+}
+
 void GLESFramebuffer::setViewport(const unsigned int left, const unsigned int top, const unsigned int width, const unsigned int height)
 {
 	glViewport(GLint(left), GLint(top), GLint(width), GLint(height));
@@ -251,8 +270,17 @@ void GLESFramebuffer::render()
 			lights.emplace_back(glesView->headlight(), HomogenousMatrix4(true));
 		}
 
+		const bool recordTiming = frameTiming_.beginFrame(*this, engine().timestamp());
+
+		const HighPerformanceTimer traversalTimer;
+
 		traverser_.clear();
 
+		if (viewCulling_ && viewportHeight_ != 0u)
+		{
+			traverser_.enableCulling(glesView->projectionMatrix(), viewportHeight_, minimalFeatureSize_);
+		}
+
 		const SmartObjectRef<GLESUndistortedBackground> glesUndistortedBackground(glesView->background());
 		if (glesUndistortedBackground)
 		{
@@ -275,7 +303,22 @@ void GLESFramebuffer::render()
 			ocean_assert(GL_NO_ERROR == glGetError());
 		}
 
+		if (recordTiming)
+		{
+			frameTiming_.addTraversalDuration(traversalTimer.seconds());
+			frameTiming_.beginPass(0);
+		}
+
+		const HighPerformanceTimer submitTimer;
+
 		traverser_.render(*this, glesView->projectionMatrix(), view_T_world);
+
+		if (recordTiming)
+		{
+			frameTiming_.addSubmitDuration(submitTimer.seconds());
+			frameTiming_.endPass();
+			frameTiming_.endFrame();
+		}
 	}
 }
 
@@ -558,6 +601,8 @@ void GLESFramebuffer::release()
 
 	traverser_.clear();
 
+	frameTiming_.release();
+
 	GLESText::release();
 	GLESProgramManager::get().release();
 
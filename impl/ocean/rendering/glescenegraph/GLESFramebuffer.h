@@ -9,6 +9,7 @@
 #define META_OCEAN_RENDERING_GLES_FRAMEBUFFER_H
 
 #include "ocean/rendering/glescenegraph/GLESceneGraph.h"
+#include "ocean/rendering/glescenegraph/GLESFrameTiming.h"
 #include "ocean/rendering/glescenegraph/GLESObject.h"
 #include "ocean/rendering/glescenegraph/GLESTextureFramebuffer.h"
 #include "ocean/rendering/glescenegraph/GLESTraverser.h"
@@ -105,6 +106,35 @@ class OCEAN_RENDERING_GLES_EXPORT GLESFramebuffer :
 		 */
 		virtual StereoType stereoType() const;
 
+		/**
+		 * Returns the draw call and state change statistics of the most recent render call.
+		 * @return The statistics of the framebuffer's traverser
+		 */
+		virtual GLESTraverser::Statistics traverserStatistics() const;
+
+		/**
+		 * Returns the CPU and GPU frame timing of this framebuffer.
+		 * The timing is disabled by default, use GLESFrameTiming::setEnabled() to record the timings of the upcoming frames.
+		 * @return The framebuffer's frame timing
+		 */
+		inline GLESFrameTiming& frameTiming();
+
+		/**
+		 * Sets whether nodes which are not visible from the camera are skipped while rendering, view culling is enabled by default.
+		 * @param enabled True, to skip nodes which are entirely outside of the view's frustum; False, to render all nodes
+		 * @param minimalFeatureSize The minimal projected size of a node, in pixel, smaller nodes are skipped as well, 0 to disable small feature culling, with range [0, infinity)
+		 * @see GLESTraverser::enableCulling().
+		 */
+		void setViewCulling(const bool enabled, const Scalar minimalFeatureSize = Scalar(0));
+
+		/**
+		 * Returns the projection matrices of both views while this framebuffer renders both views of a stereo framebuffer in one pass (single-pass multiview).
+		 * Each matrix transforms the camera space of the traversal, which is the space of the left view, into the clip space of the corresponding view.
+		 * @return The projection matrices of the left and the right view, nullptr if the framebuffer renders one view at a time
+		 * @see GLESAttribute::PT_MULTIVIEW.
+		 */
+		inline const SquareMatrix4* multiviewProjectionMatrices() const;
+
 		/**
 		 * Sets the viewport of this framebuffer.
 		 * @see Framebuffer::setViewport().
@@ -264,13 +294,38 @@ class OCEAN_RENDERING_GLES_EXPORT GLESFramebuffer :
 		/// The stereo framebuffer type.
 		StereoType stereoType_ = ST_MONO;
 
+		/// True, to skip nodes which are not visible from the camera.
+		bool viewCulling_ = true;
+
+		/// The minimal projected size of a node, in pixel, 0 if small feature culling is disabled.
+		Scalar minimalFeatureSize_ = Scalar(0);
+
+		/// The projection matrices of the left and the right view of a single-pass multiview rendering.
+		SquareMatrix4 multiviewProjectionMatrices_[2] = {SquareMatrix4(false), SquareMatrix4(false)};
+
+		/// True, while the framebuffer renders both views in one pass.
+		bool multiviewActive_ = false;
+
 		/// The traverser which is used for rendering.
 		GLESTraverser traverser_;
 
 		/// The texture framebuffer which is used for picking objects.
 		SmartObjectRef<GLESTextureFramebuffer> pickingTextureFramebuffer_;
+
+		/// The CPU and GPU timing of the rendered frames.
+		GLESFrameTiming frameTiming_;
 };
 
+inline GLESFrameTiming& GLESFramebuffer::frameTiming()
+{
+	return frameTiming_;
+}
+
+inline const SquareMatrix4* GLESFramebuffer::multiviewProjectionMatrices() const
+{
+	return multiviewActive_ ? multiviewProjectionMatrices_ : nullptr;
+}
+
 }
 
 }
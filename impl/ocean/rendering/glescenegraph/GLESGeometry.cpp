@@ -33,20 +33,9 @@ GLESGeometry::~GLESGeometry()
 
 BoundingBox GLESGeometry::boundingBox(const bool /*involveLocalTransformation*/) const
 {
-	BoundingBox result;
-
-	for (Renderables::const_iterator i = geometryRenderables.cbegin(); i != geometryRenderables.cend(); ++i)
-	{
-		const SmartObjectRef<GLESRenderable> renderable(i->first);
-		ocean_assert(renderable);
+	bool bounded = false;
 
-		if (renderable->boundingBox().isValid())
-		{
-			result += renderable->boundingBox();
-		}
-	}
-
-	return result;
+	return cachedBoundingBox(bounded);
 }
 
 void GLESGeometry::addRenderable(const RenderableRef& renderable, const AttributeSetRef& attributes)
@@ -56,36 +45,132 @@ void GLESGeometry::addRenderable(const RenderableRef& renderable, const Attribut
 		return;
 	}
 
-	const ScopedLock scopedLock(objectLock);
+	{
+		const ScopedLock scopedLock(objectLock);
 
-	Geometry::addRenderable(renderable, attributes);
+		Geometry::addRenderable(renderable, attributes);
+	}
+
+	invalidateBoundingBox();
 }
 
 void GLESGeometry::removeRenderable(const RenderableRef& renderable)
+{
+	{
+		const ScopedLock scopedLock(objectLock);
+
+		Geometry::removeRenderable(renderable);
+	}
+
+	invalidateBoundingBox();
+}
+
+HomogenousMatrices4 GLESGeometry::instanceTransformations() const
 {
 	const ScopedLock scopedLock(objectLock);
 
-	Geometry::removeRenderable(renderable);
+	return object_T_instances_;
+}
+
+void GLESGeometry::setInstanceTransformations(const HomogenousMatrices4& object_T_instances)
+{
+	{
+		const ScopedLock scopedLock(objectLock);
+
+		object_T_instances_ = object_T_instances;
+	}
+
+	invalidateBoundingBox();
 }
 
 void GLESGeometry::addToTraverser(const GLESFramebuffer& /*framebuffer*/, const SquareMatrix4& /*projectionMatrix*/, const HomogenousMatrix4& camera_T_object, const Lights& lights, GLESTraverser& traverser) const
 {
 	const ScopedLock scopedLock(objectLock);
 
-	if (!visible_ || geometryRenderables.empty())
+	if (!visible_ || geometryRenderables.empty() || isCulled(camera_T_object, traverser))
 	{
 		return;
 	}
 
-	const SquareMatrix3 normalMatrix(camera_T_object.rotationMatrix().inverted().transposed());
+	if (object_T_instances_.empty())
+	{
+		const SquareMatrix3 normalMatrix(camera_T_object.rotationMatrix().inverted().transposed());
+
+		for (Renderables::const_iterator i = geometryRenderables.cbegin(); i != geometryRenderables.cend(); ++i)
+		{
+			const SmartObjectRef<GLESRenderable> renderable(i->first);
+			ocean_assert(renderable);
+
+			traverser.addRenderable(i->first, i->second, camera_T_object, normalMatrix, lights);
+		}
+
+		return;
+	}
+
+	// the traverser renders neighboring instances of the same renderable with one instanced draw call
+
+	for (Renderables::const_iterator i = geometryRenderables.cbegin(); i != geometryRenderables.cend(); ++i)
+	{
+		const SmartObjectRef<GLESRenderable> renderable(i->first);
+		ocean_assert(renderable);
+
+		for (const HomogenousMatrix4& object_T_instance : object_T_instances_)
+		{
+			const HomogenousMatrix4 camera_T_instance(camera_T_object * object_T_instance);
+
+			if (!camera_T_instance.isValid() || traverser.isCulled(instanceBoundingBox_, camera_T_instance))
+			{
+				continue;
+			}
+
+			const SquareMatrix3 normalMatrix(camera_T_instance.rotationMatrix().inverted().transposed());
+
+			traverser.addRenderable(i->first, i->second, camera_T_instance, normalMatrix, lights);
+		}
+	}
+}
+
+BoundingBox GLESGeometry::determineBoundingBox(bool& bounded) const
+{
+	const ScopedLock scopedLock(objectLock);
+
+	BoundingBox result;
+	bounded = true;
 
 	for (Renderables::const_iterator i = geometryRenderables.cbegin(); i != geometryRenderables.cend(); ++i)
 	{
 		const SmartObjectRef<GLESRenderable> renderable(i->first);
 		ocean_assert(renderable);
 
-		traverser.addRenderable(i->first, i->second, camera_T_object, normalMatrix, lights);
+		if (renderable->boundingBox().isValid())
+		{
+			result += renderable->boundingBox();
+		}
+		else
+		{
+			// e.g., the renderable has not yet been built
+
+			bounded = false;
+		}
 	}
+
+	// an invalid instance bounding box avoids culling of individual instances
+
+	instanceBoundingBox_ = bounded ? result : BoundingBox();
+
+	if (!object_T_instances_.empty() && result.isValid())
+	{
+		const BoundingBox instanceBoundingBox(result);
+
+		result = BoundingBox();
+
+		for (const HomogenousMatrix4& object_T_instance : object_T_instances_)
+		{
+			result += instanceBoundingBox * object_T_instance;
+		}
+	}
+
+	return result;
 }
 
 }
@@ -52,6 +52,18 @@ class OCEAN_RENDERING_GLES_EXPORT GLESGeometry :
 		 */
 		void removeRenderable(const RenderableRef& renderable) override;
 
+		/**
+		 * Returns the transformations of the instances of this geometry.
+		 * @see Geometry::instanceTransformations().
+		 */
+		HomogenousMatrices4 instanceTransformations() const override;
+
+		/**
+		 * Sets the transformations of instances of this geometry.
+		 * @see Geometry::setInstanceTransformations().
+		 */
+		void setInstanceTransformations(const HomogenousMatrices4& object_T_instances) override;
+
 		/**
 		 * Adds this node and all child node to a traverser.
 		 * @see GLESNode::addToTraverser().
@@ -69,6 +81,20 @@ class OCEAN_RENDERING_GLES_EXPORT GLESGeometry :
 		 * Destructs a GLESceneGraph geometry object.
 		 */
 		~GLESGeometry() override;
+
+		/**
+		 * Determines the bounding box of all renderables and instances.
+		 * @see GLESNode::determineBoundingBox().
+		 */
+		BoundingBox determineBoundingBox(bool& bounded) const override;
+
+	protected:
+
+		/// The transformations between the individual instances and this geometry, empty if the geometry is rendered once.
+		HomogenousMatrices4 object_T_instances_;
+
+		/// The bounding box of all renderables of one instance, determined together with the cached bounding box.
+		mutable BoundingBox instanceBoundingBox_;
 };
 
 }
@@ -31,23 +31,9 @@ GLESGroup::~GLESGroup()
 
 BoundingBox GLESGroup::boundingBox(const bool /*involveLocalTransformation*/) const
 {
-	const ScopedLock scopedLock(objectLock);
-
-	BoundingBox result;
-
-	for (const NodeRef& groupNode : groupNodes)
-	{
-		ocean_assert(groupNode);
-
-		const BoundingBox groupBoundingBox = groupNode->boundingBox(true /*involveLocalTransformation*/);
-
-		if (groupBoundingBox.isValid())
-		{
-			result += groupBoundingBox;
-		}
-	}
+	bool bounded = false;
 
-	return result;
+	return cachedBoundingBox(bounded);
 }
 
 void GLESGroup::addChild(const NodeRef& node)
@@ -57,9 +43,13 @@ void GLESGroup::addChild(const NodeRef& node)
 		return;
 	}
 
-	const ScopedLock scopedLock(objectLock);
+	{
+		const ScopedLock scopedLock(objectLock);
+
+		Group::addChild(node);
+	}
 
-	Group::addChild(node);
+	invalidateBoundingBox();
 }
 
 void GLESGroup::registerLight(const LightSourceRef& light)
@@ -81,9 +71,13 @@ void GLESGroup::removeChild(const NodeRef& node)
 		return;
 	}
 
-	const ScopedLock scopedLock(objectLock);
+	{
+		const ScopedLock scopedLock(objectLock);
 
-	Group::removeChild(node);
+		Group::removeChild(node);
+	}
+
+	invalidateBoundingBox();
 }
 
 void GLESGroup::unregisterLight(const LightSourceRef& light)
@@ -100,16 +94,20 @@ void GLESGroup::unregisterLight(const LightSourceRef& light)
 
 void GLESGroup::clear()
 {
-	const ScopedLock scopedLock(objectLock);
+	{
+		const ScopedLock scopedLock(objectLock);
+
+		Group::clear();
+	}
 
-	Group::clear();
+	invalidateBoundingBox();
 }
 
 void GLESGroup::addToTraverser(const GLESFramebuffer& framebuffer, const SquareMatrix4& projectionMatrix, const HomogenousMatrix4& camera_T_object, const Lights& lights, GLESTraverser& traverser) const
 {
 	const ScopedLock scopedLock(objectLock);
 
-	if (!visible_ || groupNodes.empty())
+	if (!visible_ || groupNodes.empty() || isCulled(camera_T_object, traverser))
 	{
 		return;
 	}
@@ -149,6 +147,32 @@ void GLESGroup::addToTraverser(const GLESFramebuffer& framebuffer, const SquareM
 	}
 }
 
+BoundingBox GLESGroup::determineBoundingBox(bool& bounded) const
+{
+	const ScopedLock scopedLock(objectLock);
+
+	BoundingBox result;
+	bounded = true;
+
+	for (const NodeRef& groupNode : groupNodes)
+	{
+		const SmartObjectRef<GLESNode> node(groupNode);
+		ocean_assert(node);
+
+		bool childBounded = false;
+		const BoundingBox childBoundingBox = node->parentBoundingBox(childBounded);
+
+		if (childBoundingBox.isValid())
+		{
+			result += childBoundingBox;
+		}
+
+		bounded = bounded && childBounded;
+	}
+
+	return result;
+}
+
 }
 
 }
@@ -78,6 +78,12 @@ class OCEAN_RENDERING_GLES_EXPORT GLESGroup :
 
 	protected:
 
+		/**
+		 * Determines the bounding box of all child nodes.
+		 * @see GLESNode::determineBoundingBox().
+		 */
+		BoundingBox determineBoundingBox(bool& bounded) const override;
+
 		/**
 		 * Creates a new GLESceneGraph group object.
 		 */
@@ -46,7 +46,7 @@ void GLESLOD::addToTraverser(const GLESFramebuffer& framebuffer, const SquareMat
 {
 	const ScopedLock scopedLock(objectLock);
 
-	if (!visible_ || groupNodes.empty())
+	if (!visible_ || groupNodes.empty() || isCulled(camera_T_object, traverser))
 	{
 		return;
 	}
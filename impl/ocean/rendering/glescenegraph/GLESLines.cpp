@@ -237,22 +237,22 @@ void GLESLines::updateBoundingBox()
 {
 	boundingBox_ = BoundingBox();
 
-	if (primitiveVertexSet.isNull() || explicitLineIndices_.empty())
+	if (primitiveVertexSet)
 	{
-		return;
-	}
+		const SmartObjectRef<GLESVertexSet> glesVertexSet(primitiveVertexSet);
+		ocean_assert(glesVertexSet);
 
-	const SmartObjectRef<GLESVertexSet> glesVertexSet(primitiveVertexSet);
-	ocean_assert(glesVertexSet);
-
-	if (explicitLineIndices_.empty())
-	{
-		boundingBox_ = glesVertexSet->boundingBox(numberImplicitLines_);
-	}
-	else
-	{
-		boundingBox_ = glesVertexSet->boundingBox(explicitLineIndices_);
+		if (explicitLineIndices_.empty())
+		{
+			boundingBox_ = glesVertexSet->boundingBox(numberImplicitLines_);
+		}
+		else
+		{
+			boundingBox_ = glesVertexSet->boundingBox(explicitLineIndices_);
+		}
 	}
+
+	invalidateParentBoundingBoxes();
 }
 
 }
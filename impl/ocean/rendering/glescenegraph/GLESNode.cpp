@@ -43,6 +43,70 @@ void GLESNode::setVisible(const bool visible)
 	visible_ = visible;
 }
 
+BoundingBox GLESNode::parentBoundingBox(bool& bounded) const
+{
+	return cachedBoundingBox(bounded);
+}
+
+void GLESNode::invalidateBoundingBox()
+{
+	if (boundingBoxInvalid_.exchange(true))
+	{
+		// the bounding boxes of all parent nodes have been invalidated already
+
+		return;
+	}
+
+	invalidateParentBoundingBoxes(*this);
+}
+
+void GLESNode::invalidateParentBoundingBoxes(const Object& object)
+{
+	for (const ObjectRef& parent : object.parentObjects())
+	{
+		const SmartObjectRef<GLESNode> parentNode(parent);
+
+		if (parentNode)
+		{
+			parentNode->invalidateBoundingBox();
+		}
+	}
+}
+
+BoundingBox GLESNode::determineBoundingBox(bool& bounded) const
+{
+	bounded = false;
+
+	return BoundingBox();
+}
+
+BoundingBox GLESNode::cachedBoundingBox(bool& bounded) const
+{
+	const ScopedLock scopedLock(objectLock);
+
+	if (boundingBoxInvalid_.exchange(false))
+	{
+		cachedBoundingBox_ = determineBoundingBox(cachedBoundingBoxBounded_);
+	}
+
+	bounded = cachedBoundingBoxBounded_;
+
+	return cachedBoundingBox_;
+}
+
+bool GLESNode::isCulled(const HomogenousMatrix4& camera_T_object, GLESTraverser& traverser) const
+{
+	if (!traverser.isCullingEnabled())
+	{
+		return false;
+	}
+
+	bool bounded = false;
+	const BoundingBox boundingBox = cachedBoundingBox(bounded);
+
+	return bounded && traverser.isCulled(boundingBox, camera_T_object);
+}
+
 }
 
 }
@@ -18,6 +18,8 @@
 #include "ocean/math/HomogenousMatrix4.h"
 #include "ocean/math/SquareMatrix4.h"
 
+#include <atomic>
+
 namespace Ocean
 {
 
@@ -62,6 +64,25 @@ class OCEAN_RENDERING_GLES_EXPORT GLESNode :
 		 */
 		void setVisible(const bool visible) override;
 
+		/**
+		 * Returns the bounding box of this node in the coordinate system of the parent node, involving the local transformation of this node.
+		 * @param bounded Resulting flag stating whether the bounding box covers everything this node may render; False, if the extent of the node is unknown (e.g., because it depends on the camera)
+		 * @return The node's bounding box, invalid if the node does not render anything or if the extent is unknown
+		 */
+		virtual BoundingBox parentBoundingBox(bool& bounded) const;
+
+		/**
+		 * Invalidates the cached bounding box of this node and of all parent nodes.
+		 * This function needs to be called whenever the geometry of the node or of one of its child nodes changes.
+		 */
+		void invalidateBoundingBox();
+
+		/**
+		 * Invalidates the cached bounding boxes of all parent nodes of an object.
+		 * @param object The object (e.g., a node or a renderable) whose geometry has changed
+		 */
+		static void invalidateParentBoundingBoxes(const Object& object);
+
 	protected:
 
 		/**
@@ -74,10 +95,45 @@ class OCEAN_RENDERING_GLES_EXPORT GLESNode :
 		 */
 		~GLESNode() override;
 
+		/**
+		 * Determines the bounding box of this node, without the local transformation of the node.
+		 * The resulting box is cached until invalidateBoundingBox() is called.
+		 * @param bounded Resulting flag stating whether the bounding box covers everything this node may render
+		 * @return The node's bounding box, invalid if the node does not render anything or if the extent is unknown
+		 */
+		virtual BoundingBox determineBoundingBox(bool& bounded) const;
+
+		/**
+		 * Returns the cached bounding box of this node, without the local transformation of the node.
+		 * The bounding box is determined again only if the node or one of its child nodes has changed.
+		 * @param bounded Resulting flag stating whether the bounding box covers everything this node may render
+		 * @return The node's bounding box, invalid if the node does not render anything or if the extent is unknown
+		 * @see determineBoundingBox().
+		 */
+		BoundingBox cachedBoundingBox(bool& bounded) const;
+
+		/**
+		 * Returns whether this node can be skipped as it is not visible from the camera.
+		 * @param camera_T_object The transformation between the coordinate system of this node (without the local transformation) and the camera, must be valid
+		 * @param traverser The traverser to which the node would be added
+		 * @return True, if the node is culled
+		 * @see GLESTraverser::isCulled().
+		 */
+		bool isCulled(const HomogenousMatrix4& camera_T_object, GLESTraverser& traverser) const;
+
 	protected:
 
 		/// True, if the node and all child nodes are visible.
 		bool visible_;
+
+		/// The cached bounding box of this node, without the local transformation.
+		mutable BoundingBox cachedBoundingBox_;
+
+		/// True, if the cached bounding box covers everything this node may render.
+		mutable bool cachedBoundingBoxBounded_ = false;
+
+		/// True, if the cached bounding box needs to be determined again.
+		mutable std::atomic<bool> boundingBoxInvalid_ = true;
 };
 
 }
@@ -7,8 +7,13 @@
 
 #include "ocean/rendering/glescenegraph/GLESPoints.h"
 #include "ocean/rendering/glescenegraph/GLESAttributeSet.h"
+#include "ocean/rendering/glescenegraph/GLESFramebuffer.h"
 #include "ocean/rendering/glescenegraph/GLESVertexSet.h"
 
+#include "ocean/base/RandomI.h"
+
+#include "ocean/math/Frustum.h"
+
 namespace Ocean
 {
 
@@ -27,6 +32,7 @@ GLESPoints::GLESPoints() :
 
 GLESPoints::~GLESPoints()
 {
+	releaseChunks();
 	release();
 }
 
@@ -58,6 +64,13 @@ Scalar GLESPoints::pointSize() const
 	return pointSize_;
 }
 
+unsigned int GLESPoints::chunkSize() const
+{
+	const ScopedLock scopedLock(objectLock);
+
+	return chunkSize_;
+}
+
 void GLESPoints::setIndices(const VertexIndices& indices)
 {
 	const ScopedLock scopedLock(objectLock);
@@ -80,6 +93,8 @@ void GLESPoints::setIndices(const VertexIndices& indices)
 	explicitPointIndices_ = indices;
 	numberImplicitPoints_ = 0u;
 
+	chunksInvalid_ = true;
+
 	ocean_assert(GL_NO_ERROR == glGetError());
 	glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(GLuint) * explicitPointIndices_.size(), explicitPointIndices_.data(), GL_STATIC_DRAW);
 
@@ -103,6 +118,13 @@ void GLESPoints::setIndices(const unsigned int numberImplicitPoints)
 {
 	const ScopedLock scopedLock(objectLock);
 
+	// a growing number of implicit points (e.g., of a growing map) keeps the existing chunks
+
+	if (!explicitPointIndices_.empty() || numberImplicitPoints < chunkedPoints_)
+	{
+		chunksInvalid_ = true;
+	}
+
 	release();
 
 	numberImplicitPoints_ = numberImplicitPoints;
@@ -119,6 +141,17 @@ void GLESPoints::setPointSize(const Scalar pointSize)
 	pointSize_ = pointSize;
 }
 
+void GLESPoints::setChunkSize(const unsigned int chunkSize)
+{
+	const ScopedLock scopedLock(objectLock);
+
+	if (chunkSize != chunkSize_)
+	{
+		chunkSize_ = chunkSize;
+		chunksInvalid_ = true;
+	}
+}
+
 void GLESPoints::render(const GLESFramebuffer& framebuffer, const SquareMatrix4& projectionMatrix, const HomogenousMatrix4& camera_T_object, const HomogenousMatrix4& camera_T_world, const SquareMatrix3& normalMatrix, GLESAttributeSet& attributeSet, const Lights& lights)
 {
 	if (explicitPointIndices_.empty() && numberImplicitPoints_ == 0u)
@@ -150,7 +183,26 @@ void GLESPoints::render(const GLESFramebuffer& framebuffer, const SquareMatrix4&
 			setUniform(locationColor, RGBAColor(1.0f, 1.0f, 1.0f));
 		}
 
-		drawPoints();
+		if (chunkSize_ != 0u || !chunks_.empty())
+		{
+			unsigned int viewportLeft = 0u;
+			unsigned int viewportTop = 0u;
+			unsigned int viewportWidth = 0u;
+			framebuffer.viewport(viewportLeft, viewportTop, viewportWidth, viewportHeight_);
+
+			updateChunks(*glesVertexSet);
+		}
+
+		if (chunks_.empty())
+		{
+			drawPoints();
+		}
+		else
+		{
+			const SquareMatrix4* multiviewProjectionMatrices = framebuffer.multiviewProjectionMatrices();
+
+			drawChunks(projectionMatrix, camera_T_object, multiviewProjectionMatrices != nullptr ? &multiviewProjectionMatrices[1] : nullptr);
+		}
 	}
 
 	attributeSet.unbindAttributes();
@@ -181,7 +233,19 @@ void GLESPoints::render(const SquareMatrix4& projectionMatrix, const HomogenousM
 		setUniform(locationPointSize, pointSize_);
 	}
 
-	drawPoints();
+	if (chunkSize_ != 0u || !chunks_.empty())
+	{
+		updateChunks(*glesVertexSet);
+	}
+
+	if (chunks_.empty())
+	{
+		drawPoints();
+	}
+	else
+	{
+		drawChunks(projectionMatrix, camera_T_object, nullptr);
+	}
 }
 
 void GLESPoints::drawPoints()
@@ -223,6 +287,124 @@ void GLESPoints::drawPoints()
 #endif
 }
 
+void GLESPoints::drawChunks(const SquareMatrix4& projectionMatrix, const HomogenousMatrix4& camera_T_object, const SquareMatrix4* secondaryClip_T_camera)
+{
+	ocean_assert(!chunks_.empty());
+	ocean_assert(camera_T_object.isValid());
+
+#ifndef OCEAN_RENDERING_GLES_USE_ES
+	GLboolean programPointSizeWasEnabled = glIsEnabled(GL_PROGRAM_POINT_SIZE);
+	ocean_assert(GL_NO_ERROR == glGetError());
+
+	glEnable(GL_PROGRAM_POINT_SIZE);
+	ocean_assert(GL_NO_ERROR == glGetError());
+#endif
+
+	const Frustum frustum(projectionMatrix);
+	const Frustum secondaryFrustum = secondaryClip_T_camera != nullptr ? Frustum(*secondaryClip_T_camera) : Frustum();
+
+	// the projected size of a chunk with extent s at depth d is s * projectionMatrix(1, 1) * viewportHeight / (2 * d)
+
+	const Scalar pixelScale = projectionMatrix(1, 1) * Scalar(viewportHeight_) * Scalar(0.5);
+
+	unsigned int uploadedChunks = 0u;
+
+	for (PointChunk& chunk : chunks_)
+	{
+		ocean_assert(!chunk.indices_.empty());
+
+		const BoundingBox cameraBoundingBox(chunk.boundingBox_ * camera_T_object);
+
+		if (!frustum.hasIntersection(cameraBoundingBox) && (!secondaryFrustum.isValid() || !secondaryFrustum.hasIntersection(cameraBoundingBox)))
+		{
+			continue;
+		}
+
+		unsigned int numberChunkPoints = (unsigned int)(chunk.indices_.size());
+
+		const Scalar depth = -cameraBoundingBox.center().z();
+		const Scalar radius = cameraBoundingBox.diagonal() * Scalar(0.5);
+
+		// chunks close to the camera are rendered with all points
+
+		if (viewportHeight_ != 0u && depth > radius)
+		{
+			// a chunk covering n pixels cannot show more than (n / pointSize)^2 individual points
+
+			const Scalar projectedPoints = Numeric::sqr(radius * Scalar(2) * pixelScale / (depth * pointSize_));
+
+			if (projectedPoints < Scalar(numberChunkPoints))
+			{
+				numberChunkPoints = std::min(numberChunkPoints, std::max(minimalChunkPoints_, (unsigned int)(projectedPoints)));
+			}
+		}
+
+		if (chunk.vboIndices_ == 0u)
+		{
+			if (uploadedChunks >= maximalChunkUploadsPerFrame_)
+			{
+				// the chunk will be uploaded within one of the next frames
+				continue;
+			}
+
+			glGenBuffers(1, &chunk.vboIndices_);
+			ocean_assert(GL_NO_ERROR == glGetError());
+
+			glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, chunk.vboIndices_);
+			ocean_assert(GL_NO_ERROR == glGetError());
+
+			glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(GLuint) * chunk.indices_.size(), chunk.indices_.data(), GL_STATIC_DRAW);
+
+			const GLenum error = glGetError();
+
+			if (error == GL_OUT_OF_MEMORY)
+			{
+				glDeleteBuffers(1, &chunk.vboIndices_);
+				ocean_assert(GL_NO_ERROR == glGetError());
+
+				chunk.vboIndices_ = 0u;
+
+				Log::warning() << "Not enough memory on the graphic chip to create " << chunk.indices_.size() << " point indices.";
+
+				continue;
+			}
+
+			ocean_assert(GL_NO_ERROR == error);
+
+			++uploadedChunks;
+		}
+		else
+		{
+			glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, chunk.vboIndices_);
+			ocean_assert(GL_NO_ERROR == glGetError());
+		}
+
+		// the indices of each chunk are shuffled, so that the first points are an evenly distributed subset of the chunk
+
+		glDrawElements(GL_POINTS, GLsizei(numberChunkPoints), GL_UNSIGNED_INT, nullptr);
+		ocean_assert(GL_NO_ERROR == glGetError());
+	}
+
+	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0u);
+	ocean_assert(GL_NO_ERROR == glGetError());
+
+	if (explicitPointIndices_.empty() && numberImplicitPoints_ > chunkedPoints_)
+	{
+		// the pending points are rendered without level of detail until they are added to a chunk
+
+		glDrawArrays(GL_POINTS, GLint(chunkedPoints_), GLsizei(numberImplicitPoints_ - chunkedPoints_));
+		ocean_assert(GL_NO_ERROR == glGetError());
+	}
+
+#ifndef OCEAN_RENDERING_GLES_USE_ES
+	if (programPointSizeWasEnabled == GL_FALSE)
+	{
+		glDisable(GL_PROGRAM_POINT_SIZE);
+		ocean_assert(GL_NO_ERROR == glGetError());
+	}
+#endif
+}
+
 void GLESPoints::release()
 {
 	if (vboIndices_ != 0)
@@ -240,26 +422,160 @@ void GLESPoints::release()
 	boundingBox_ = BoundingBox();
 }
 
-void GLESPoints::updateBoundingBox()
+void GLESPoints::updateChunks(const GLESVertexSet& vertexSet)
 {
-	boundingBox_ = BoundingBox();
+	if (chunksInvalid_ || chunkSize_ == 0u)
+	{
+		releaseChunks();
+	}
 
-	if (primitiveVertexSet.isNull() || explicitPointIndices_.empty())
+	if (chunkSize_ == 0u)
 	{
 		return;
 	}
 
-	const SmartObjectRef<GLESVertexSet> glesVertexSet(primitiveVertexSet);
-	ocean_assert(glesVertexSet);
+	const unsigned int numberPoints = explicitPointIndices_.empty() ? numberImplicitPoints_ : (unsigned int)(explicitPointIndices_.size());
+
+	if (numberPoints < chunkedPoints_)
+	{
+		releaseChunks();
+	}
+
+	const unsigned int pendingPoints = numberPoints - chunkedPoints_;
+
+	if (pendingPoints == 0u || (!chunks_.empty() && pendingPoints < chunkSize_))
+	{
+		// we wait until enough new points exist for an entire chunk
+		return;
+	}
+
+	Vertices points;
+	const Index32* vertexIndices = nullptr;
 
 	if (explicitPointIndices_.empty())
 	{
-		boundingBox_ = glesVertexSet->boundingBox(numberImplicitPoints_);
+		if (numberPoints > vertexSet.numberVertices())
+		{
+			return;
+		}
+
+		points = vertexSet.vertices(chunkedPoints_, pendingPoints);
 	}
 	else
 	{
-		boundingBox_ = glesVertexSet->boundingBox(explicitPointIndices_);
+		const Vertices vertices(vertexSet.vertices());
+
+		points.reserve(pendingPoints);
+
+		for (unsigned int n = chunkedPoints_; n < numberPoints; ++n)
+		{
+			const VertexIndex index = explicitPointIndices_[n];
+
+			if (size_t(index) >= vertices.size())
+			{
+				return;
+			}
+
+			points.emplace_back(vertices[index]);
+		}
+
+		vertexIndices = explicitPointIndices_.data() + chunkedPoints_;
+	}
+
+	if (points.size() != size_t(pendingPoints))
+	{
+		return;
 	}
+
+	const Geometry::Octree octree(points.data(), points.size(), Geometry::Octree::Parameters(chunkSize_, true /*useTightBoundingBoxes*/));
+
+	RandomGenerator randomGenerator(chunkedPoints_);
+
+	addChunks(octree, Index32(chunkedPoints_), vertexIndices, randomGenerator, chunks_);
+
+	chunkedPoints_ = numberPoints;
+}
+
+void GLESPoints::releaseChunks()
+{
+	for (PointChunk& chunk : chunks_)
+	{
+		if (chunk.vboIndices_ != 0u)
+		{
+			ocean_assert(GL_NO_ERROR == glGetError());
+			glDeleteBuffers(1, &chunk.vboIndices_);
+			ocean_assert(GL_NO_ERROR == glGetError());
+		}
+	}
+
+	chunks_.clear();
+	chunkedPoints_ = 0u;
+	chunksInvalid_ = false;
+}
+
+void GLESPoints::addChunks(const Geometry::Octree& octree, const Index32 indexOffset, const Index32* vertexIndices, RandomGenerator& randomGenerator, PointChunks& chunks)
+{
+	const Geometry::Octree* const* childNodes = octree.childNodes();
+
+	if (childNodes != nullptr)
+	{
+		for (unsigned int n = 0u; n < 8u; ++n)
+		{
+			if (childNodes[n] != nullptr)
+			{
+				addChunks(*childNodes[n], indexOffset, vertexIndices, randomGenerator, chunks);
+			}
+		}
+
+		return;
+	}
+
+	const Indices32& pointIndices = octree.pointIndices();
+
+	if (pointIndices.empty())
+	{
+		return;
+	}
+
+	PointChunk chunk;
+	chunk.boundingBox_ = octree.boundingBox();
+	chunk.indices_.reserve(pointIndices.size());
+
+	for (const Index32 pointIndex : pointIndices)
+	{
+		chunk.indices_.emplace_back(vertexIndices != nullptr ? vertexIndices[pointIndex] : indexOffset + pointIndex);
+	}
+
+	// shuffling the points so that each prefix of the chunk is an evenly distributed subset (the level of detail)
+
+	for (size_t n = chunk.indices_.size() - 1; n > 0; --n)
+	{
+		std::swap(chunk.indices_[n], chunk.indices_[RandomI::random(randomGenerator, (unsigned int)(n))]);
+	}
+
+	chunks.emplace_back(std::move(chunk));
+}
+
+void GLESPoints::updateBoundingBox()
+{
+	boundingBox_ = BoundingBox();
+
+	if (primitiveVertexSet)
+	{
+		const SmartObjectRef<GLESVertexSet> glesVertexSet(primitiveVertexSet);
+		ocean_assert(glesVertexSet);
+
+		if (explicitPointIndices_.empty())
+		{
+			boundingBox_ = glesVertexSet->boundingBox(numberImplicitPoints_);
+		}
+		else
+		{
+			boundingBox_ = glesVertexSet->boundingBox(explicitPointIndices_);
+		}
+	}
+
+	invalidateParentBoundingBoxes();
 }
 
 }
@@ -10,9 +10,14 @@
 
 #include "ocean/rendering/glescenegraph/GLESceneGraph.h"
 #include "ocean/rendering/glescenegraph/GLESIndependentPrimitive.h"
+#include "ocean/rendering/glescenegraph/GLESVertexSet.h"
 
 #include "ocean/rendering/Points.h"
 
+#include "ocean/base/RandomGenerator.h"
+
+#include "ocean/geometry/Octree.h"
+
 namespace Ocean
 {
 
@@ -32,6 +37,36 @@ class OCEAN_RENDERING_GLES_EXPORT GLESPoints :
 {
 	friend class GLESFactory;
 
+	protected:
+
+		/**
+		 * This class holds a spatial chunk of a chunked point cloud.
+		 */
+		class PointChunk
+		{
+			public:
+
+				/// The bounding box of all points of this chunk, defined in the coordinate system of the points.
+				BoundingBox boundingBox_;
+
+				/// The indices of the points of this chunk, ordered so that each prefix is an evenly distributed subset of the chunk.
+				VertexIndices indices_;
+
+				/// The buffer object holding the indices, 0 until the chunk has been visible for the first time.
+				GLuint vboIndices_ = 0u;
+		};
+
+		/**
+		 * Definition of a vector holding point chunks.
+		 */
+		using PointChunks = std::vector<PointChunk>;
+
+		/// The maximal number of chunks which are uploaded to the GPU within one frame, further chunks are uploaded in the following frames.
+		static constexpr unsigned int maximalChunkUploadsPerFrame_ = 8u;
+
+		/// The minimal number of points which are rendered for each visible chunk.
+		static constexpr unsigned int minimalChunkPoints_ = 64u;
+
 	public:
 
 		/**
@@ -52,6 +87,12 @@ class OCEAN_RENDERING_GLES_EXPORT GLESPoints :
 		 */
 		Scalar pointSize() const override;
 
+		/**
+		 * Returns the maximal number of points in each chunk of a chunked point cloud.
+		 * @see Points::chunkSize().
+		 */
+		unsigned int chunkSize() const override;
+
 		/**
 		 * Sets the indices of the used vertex points.
 		 * @see Points::setIndices().
@@ -70,6 +111,12 @@ class OCEAN_RENDERING_GLES_EXPORT GLESPoints :
 		 */
 		void setPointSize(const Scalar size) override;
 
+		/**
+		 * Enables or disables chunked rendering.
+		 * @see Points::setChunkSize().
+		 */
+		void setChunkSize(const unsigned int chunkSize) override;
+
 		/**
 		 * Renders the points defined by the associated vertex set and the defined indices.
 		 * @see GLESRenderable::render().
@@ -87,6 +134,15 @@ class OCEAN_RENDERING_GLES_EXPORT GLESPoints :
 		 */
 		void drawPoints();
 
+		/**
+		 * Draws the visible chunks of a chunked point cloud with the currently bound shader program.
+		 * Chunks are uploaded to the GPU when they become visible for the first time.
+		 * @param projectionMatrix The projection matrix of the view, must be valid
+		 * @param camera_T_object The transformation between the points and the camera, must be valid
+		 * @param secondaryClip_T_camera Optional clip matrix of a second view rendered in the same pass (multiview), defined in relation to the camera, nullptr otherwise
+		 */
+		void drawChunks(const SquareMatrix4& projectionMatrix, const HomogenousMatrix4& camera_T_object, const SquareMatrix4* secondaryClip_T_camera);
+
 	protected:
 
 		/**
@@ -104,6 +160,28 @@ class OCEAN_RENDERING_GLES_EXPORT GLESPoints :
 		 */
 		void release();
 
+		/**
+		 * Partitions the points which are not yet part of a chunk into new chunks.
+		 * Points are collected until enough points exist for a chunk, the pending points are rendered without level of detail in the meantime.
+		 * @param vertexSet The vertex set holding the points
+		 */
+		void updateChunks(const GLESVertexSet& vertexSet);
+
+		/**
+		 * Releases all chunks including their buffer objects.
+		 */
+		void releaseChunks();
+
+		/**
+		 * Adds the leaf nodes of an octree as new chunks.
+		 * @param octree The octree node from which the leaf nodes will be added
+		 * @param indexOffset The offset which will be added to the point indices of the octree to determine the vertex indices, with range [0, infinity)
+		 * @param vertexIndices Optional explicit vertex indices to which the point indices of the octree are mapped, nullptr to use the point indices plus the offset
+		 * @param randomGenerator The random generator used to order the points of each chunk
+		 * @param chunks The chunks to which the new chunks will be added
+		 */
+		static void addChunks(const Geometry::Octree& octree, const Index32 indexOffset, const Index32* vertexIndices, RandomGenerator& randomGenerator, PointChunks& chunks);
+
 		/**
 		 * Updates the bounding box of this primitive.
 		 * @see GLESPrimitive::updateBoundingBox().
@@ -123,6 +201,21 @@ class OCEAN_RENDERING_GLES_EXPORT GLESPoints :
 
 		/// The size of all points (the diameter), in pixels, with range (0, infinity).
 		Scalar pointSize_ = Scalar(1);
+
+		/// The maximal number of points in each chunk, 0 if chunked rendering is disabled.
+		unsigned int chunkSize_ = 0u;
+
+		/// The chunks of the point cloud.
+		PointChunks chunks_;
+
+		/// The number of points which are part of a chunk, the remaining points are pending.
+		unsigned int chunkedPoints_ = 0u;
+
+		/// True, if the chunks need to be created from scratch, e.g., because the points have changed.
+		bool chunksInvalid_ = false;
+
+		/// The height of the viewport in which the points have been rendered most recently, in pixel, used to determine the level of detail.
+		unsigned int viewportHeight_ = 0u;
 };
 
 }
@@ -36,6 +36,13 @@ void GLESPrimitive::setVertexSet(const VertexSetRef& vertexSet)
 	updateBoundingBox();
 }
 
+void GLESPrimitive::onVerticesChanged()
+{
+	const ScopedLock scopedLock(objectLock);
+
+	updateBoundingBox();
+}
+
 }
 
 }
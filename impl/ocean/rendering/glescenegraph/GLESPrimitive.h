@@ -38,6 +38,11 @@ class OCEAN_RENDERING_GLES_EXPORT GLESPrimitive :
 		 */
 		void setVertexSet(const VertexSetRef& vertexSet) override;
 
+		/**
+		 * Event function for changed vertices of the primitive's vertex set, updates the bounding box of this primitive.
+		 */
+		void onVerticesChanged();
+
 	protected:
 
 		/**
@@ -7,6 +7,10 @@
 
 #include "ocean/rendering/glescenegraph/GLESProgramManager.h"
 
+#include "ocean/base/String.h"
+
+#include <fstream>
+
 namespace Ocean
 {
 
@@ -94,6 +98,46 @@ const char* GLESProgramManager::partTwoTexturesLookupY_U_V12ToRGBA32_ =
 	)SHADER";
 
 
+const char* GLESProgramManager::partDefinitionProjection_ =
+	R"SHADER(
+		// Projection matrix
+		uniform mat4 projectionMatrix;
+	)SHADER";
+
+const char* GLESProgramManager::partDefinitionMultiviewProjection_ =
+	R"SHADER(
+		#extension GL_OVR_multiview2 : require
+
+		// The vertex shader is executed once for each of both views
+		layout(num_views = 2) in;
+
+		// Projection matrices of both views, each transforming the camera space of the traversal into the clip space of the view
+		uniform mat4 projectionMatrices[2];
+
+		#define projectionMatrix projectionMatrices[gl_ViewID_OVR]
+	)SHADER";
+
+const char* GLESProgramManager::partDefinitionTransformations_ =
+	R"SHADER(
+		// Model view matrix
+		uniform mat4 modelViewMatrix;
+
+		// Normal matrix which is the inversed and transposed of the upper left 3x3 model view matrix
+		uniform mat3 normalMatrix;
+	)SHADER";
+
+const char* GLESProgramManager::partDefinitionInstancedTransformations_ =
+	R"SHADER(
+		// Model view matrix of each instance
+		in mat4 aInstanceModelViewMatrix;
+
+		// Normal matrix of each instance which is the inversed and transposed of the upper left 3x3 model view matrix
+		in mat3 aInstanceNormalMatrix;
+
+		#define modelViewMatrix aInstanceModelViewMatrix
+		#define normalMatrix aInstanceNormalMatrix
+	)SHADER";
+
 const char* GLESProgramManager::partDefinitionMaterial_ =
 	R"SHADER(
 		// Material structure
@@ -260,9 +304,6 @@ const char* GLESProgramManager::partFunctionLighting_ =
 
 const char* GLESProgramManager::programVertexShaderStaticColor_ =
 	R"SHADER(
-		// Projection matrix
-		uniform mat4 projectionMatrix;
-
 		// Model view matrix
 		uniform mat4 modelViewMatrix;
 
@@ -295,9 +336,6 @@ const char* GLESProgramManager::programVertexShaderStaticColor_ =
 
 const char* GLESProgramManager::programVertexShaderColorId_ =
 	R"SHADER(
-		// Projection matrix
-		uniform mat4 projectionMatrix;
-
 		// Model view matrix
 		uniform mat4 modelViewMatrix;
 
@@ -320,9 +358,6 @@ const char* GLESProgramManager::programVertexShaderColorId_ =
 
 const char* GLESProgramManager::programVertexShaderPoints_ =
 	R"SHADER(
-		// Projection matrix
-		uniform mat4 projectionMatrix;
-
 		// Model view matrix
 		uniform mat4 modelViewMatrix;
 
@@ -355,9 +390,6 @@ const char* GLESProgramManager::programVertexShaderPoints_ =
 
 const char* GLESProgramManager::programVertexShaderPointsMaterial_ =
 	R"SHADER(
-		// Projection matrix
-		uniform mat4 projectionMatrix;
-
 		// Model view matrix
 		uniform mat4 modelViewMatrix;
 
@@ -414,9 +446,6 @@ const char* GLESProgramManager::programVertexShaderPointsMaterial_ =
 
 const char* GLESProgramManager::programVertexShaderPointsMaterialLight_ =
 	R"SHADER(
-		// Projection matrix
-		uniform mat4 projectionMatrix;
-
 		// Model view matrix
 		uniform mat4 modelViewMatrix;
 
@@ -496,9 +525,6 @@ const char* GLESProgramManager::programVertexShaderPointsMaterialLight_ =
 
 const char* GLESProgramManager::programVertexShaderDebugGray_ =
 	R"SHADER(
-		Projection matrix
-		uniform mat4 projectionMatrix;
-
 		// Model view matrix
 		uniform mat4 modelViewMatrix;
 
@@ -523,14 +549,7 @@ const char* GLESProgramManager::programVertexShaderDebugGray_ =
 
 const char* GLESProgramManager::programVertexShaderMaterial_ =
 	R"SHADER(
-		// Projection matrix
-		uniform mat4 projectionMatrix;
-
-		// Model view matrix
-		uniform mat4 modelViewMatrix;
-
-		// Normal matrix which is the inversed and transposed of the upper left 3x3 model view matrix
-		uniform mat3 normalMatrix;
+		// Model view matrix and normal matrix are defined in a separate part, either as uniforms or as per-instance attributes
 
 		// Global material for all vertices
 		uniform Material material;
@@ -577,14 +596,7 @@ const char* GLESProgramManager::programVertexShaderMaterial_ =
 
 const char* GLESProgramManager::programVertexShaderMaterialLight_ =
 	R"SHADER(
-		// Projection matrix
-		uniform mat4 projectionMatrix;
-
-		// Model view matrix
-		uniform mat4 modelViewMatrix;
-
-		// Normal matrix which is the inversed and transposed of the upper left 3x3 model view matrix
-		uniform mat3 normalMatrix;
+		// Model view matrix and normal matrix are defined in a separate part, either as uniforms or as per-instance attributes
 
 		// Global material for all vertices
 		uniform Material material;
@@ -654,9 +666,6 @@ const char* GLESProgramManager::programVertexShaderMaterialLight_ =
 
 const char* GLESProgramManager::programVertexShaderTexture_ =
 	R"SHADER(
-		// Projection matrix
-		uniform mat4 projectionMatrix;
-
 		// Model view matrix
 		uniform mat4 modelViewMatrix;
 
@@ -686,9 +695,6 @@ const char* GLESProgramManager::programVertexShaderTexture_ =
 
 const char* GLESProgramManager::programVertexShaderMaterialLightTexture_ =
 	R"SHADER(
-		// Projection matrix
-		uniform mat4 projectionMatrix;
-
 		// Model view matrix
 		uniform mat4 modelViewMatrix;
 
@@ -788,9 +794,6 @@ const char* GLESProgramManager::programVertexShaderMaterialLightTexture_ =
 
 const char* GLESProgramManager::programVertexShaderPhantomVideoTextureCoordinatesFast_ =
 	R"SHADER(
-		// Projection matrix
-		uniform mat4 projectionMatrix;
-
 		// Model view matrix
 		uniform mat4 modelViewMatrix;
 
@@ -818,9 +821,6 @@ const char* GLESProgramManager::programVertexShaderPhantomVideoTextureCoordinate
 
 const char* GLESProgramManager::programVertexShaderOpaqueTextMaterialLight_ =
 	R"SHADER(
-		// Projection matrix
-		uniform mat4 projectionMatrix;
-
 		// Model view matrix
 		uniform mat4 modelViewMatrix;
 
@@ -912,9 +912,6 @@ const char* GLESProgramManager::programVertexShaderOpaqueTextMaterialLight_ =
 
 const char* GLESProgramManager::programVertexShaderTransparentTextMaterialLight_ =
 	R"SHADER(
-		// Projection matrix
-		uniform mat4 projectionMatrix;
-
 		// Model view matrix
 		uniform mat4 modelViewMatrix;
 
@@ -1291,14 +1288,38 @@ GLESShaderProgramRef GLESProgramManager::program(const Engine& engine, const GLE
 		return i->second;
 	}
 
-	const ShaderCodes vertexCodes = vertexShaderCodes(programType);
-	const ShaderCodes fragmentCodes = fragmentShaderCodes(programType);
+	const bool multiview = (programType & GLESAttribute::PT_MULTIVIEW) == GLESAttribute::PT_MULTIVIEW;
+	const GLESAttribute::ProgramType singleViewProgramType = GLESAttribute::ProgramType(programType & ~GLESAttribute::PT_MULTIVIEW);
+
+	ShaderCodes vertexCodes = vertexShaderCodes(singleViewProgramType);
+	const ShaderCodes fragmentCodes = fragmentShaderCodes(singleViewProgramType);
 
 	if (vertexCodes.empty() || fragmentCodes.empty())
 	{
 		return GLESShaderProgramRef();
 	}
 
+	// the projection matrix is defined separately as a multiview program has one projection matrix for each view, the definition must follow the platform part directly
+
+	ocean_assert(vertexCodes.front() == partPlatform_);
+	vertexCodes.insert(vertexCodes.begin() + 1, multiview ? partDefinitionMultiviewProjection_ : partDefinitionProjection_);
+
+	const std::string binaryFilename = programBinaryFilename(programType, vertexCodes, fragmentCodes);
+
+	if (!binaryFilename.empty())
+	{
+		GLESShaderProgramRef cachedProgram = loadProgramBinary(engine, programType, binaryFilename);
+
+		if (cachedProgram)
+		{
+			programMap_.emplace(programType, cachedProgram);
+
+			Log::debug() << "Loaded shader program from binary cache: " << GLESAttribute::translateProgramType(programType);
+
+			return cachedProgram;
+		}
+	}
+
 	GLESShaderRef vertexShader;
 
 	const ShaderMap::const_iterator iV = vertexShaders_.find(vertexCodes);
@@ -1372,9 +1393,57 @@ GLESShaderProgramRef GLESProgramManager::program(const Engine& engine, const GLE
 
 	Log::debug() << "Created shader program: " << GLESAttribute::translateProgramType(programType);
 
+	if (!binaryFilename.empty() && !storeProgramBinary(*newProgram, binaryFilename))
+	{
+		Log::warning() << "Failed to store the shader program in the binary cache: " << GLESAttribute::translateProgramType(programType);
+	}
+
 	return newProgram;
 }
 
+bool GLESProgramManager::setProgramBinaryCache(const std::string& directory)
+{
+	const ScopedLock scopedLock(lock_);
+
+	programBinaryDirectory_ = directory;
+
+	if (!programBinaryDirectory_.empty() && programBinaryDirectory_.back() != '/' && programBinaryDirectory_.back() != '\\')
+	{
+		programBinaryDirectory_ += '/';
+	}
+
+	programBinaryIndex_ = readProgramBinaryIndex();
+
+	return true;
+}
+
+size_t GLESProgramManager::precompilePrograms(const Engine& engine, const ProgramTypes& programTypes)
+{
+	ProgramTypeSet allProgramTypes(programTypes.cbegin(), programTypes.cend());
+
+	{
+		const ScopedLock scopedLock(lock_);
+
+		allProgramTypes.insert(programBinaryIndex_.cbegin(), programBinaryIndex_.cend());
+	}
+
+	size_t createdPrograms = 0;
+
+	for (const GLESAttribute::ProgramType programType : allProgramTypes)
+	{
+		if (program(engine, programType))
+		{
+			++createdPrograms;
+		}
+	}
+
+	// the programs must be complete before they can be used in any other shared context
+	glFinish();
+	ocean_assert(GL_NO_ERROR == glGetError());
+
+	return createdPrograms;
+}
+
 void GLESProgramManager::release()
 {
 	const ScopedLock scopedLock(lock_);
@@ -1388,6 +1457,199 @@ void GLESProgramManager::release()
 #endif
 }
 
+bool GLESProgramManager::isInstancingSupported(const GLESAttribute::ProgramType programType)
+{
+	switch (uint32_t(programType & ~GLESAttribute::PT_INSTANCED))
+	{
+		case GLESAttribute::PT_MATERIAL:
+		case GLESAttribute::PT_MATERIAL | GLESAttribute::PT_LIGHT:
+			return true;
+
+		default:
+			break;
+	}
+
+	return false;
+}
+
+GLESShaderProgramRef GLESProgramManager::loadProgramBinary(const Engine& engine, const GLESAttribute::ProgramType programType, const std::string& filename) const
+{
+	ocean_assert(!filename.empty());
+
+	std::ifstream stream(filename.c_str(), std::ios::binary);
+
+	if (!stream.good())
+	{
+		return GLESShaderProgramRef();
+	}
+
+	uint32_t header[4] = {0u, 0u, 0u, 0u};
+
+	if (!stream.read((char*)(header), sizeof(header)) || header[0] != programBinaryMagic_ || header[1] != uint32_t(programType) || header[3] == 0u)
+	{
+		return GLESShaderProgramRef();
+	}
+
+	std::vector<uint8_t> binary(header[3]);
+
+	if (!stream.read((char*)(binary.data()), std::streamsize(binary.size())))
+	{
+		return GLESShaderProgramRef();
+	}
+
+	GLESShaderProgramRef newProgram = engine.factory().createShaderProgram();
+	ocean_assert(newProgram);
+
+	if (!newProgram->linkBinary(programType, GLenum(header[2]), binary.data(), binary.size()))
+	{
+		// the binary is outdated, the program will be compiled and stored again
+
+		return GLESShaderProgramRef();
+	}
+
+	return newProgram;
+}
+
+bool GLESProgramManager::storeProgramBinary(const GLESShaderProgram& program, const std::string& filename)
+{
+	ocean_assert(!filename.empty());
+
+	GLenum binaryFormat = 0u;
+	std::vector<uint8_t> binary;
+
+	if (!program.programBinary(binaryFormat, binary) || binary.size() > size_t(NumericT<uint32_t>::maxValue()))
+	{
+		return false;
+	}
+
+	const uint32_t header[4] = {programBinaryMagic_, uint32_t(program.programType()), uint32_t(binaryFormat), uint32_t(binary.size())};
+
+	std::ofstream stream(filename.c_str(), std::ios::binary | std::ios::trunc);
+
+	if (!stream.good())
+	{
+		return false;
+	}
+
+	if (!stream.write((const char*)(header), sizeof(header)) || !stream.write((const char*)(binary.data()), std::streamsize(binary.size())))
+	{
+		return false;
+	}
+
+	stream.close();
+
+	if (programBinaryIndex_.emplace(program.programType()).second)
+	{
+		return writeProgramBinaryIndex();
+	}
+
+	return true;
+}
+
+std::string GLESProgramManager::programBinaryFilename(const GLESAttribute::ProgramType programType, const ShaderCodes& vertexCodes, const ShaderCodes& fragmentCodes)
+{
+	if (programBinaryDirectory_.empty())
+	{
+		return std::string();
+	}
+
+	if (driverIdentifier_.empty())
+	{
+		GLint numberBinaryFormats = 0;
+		glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &numberBinaryFormats);
+		ocean_assert(GL_NO_ERROR == glGetError());
+
+		if (numberBinaryFormats <= 0)
+		{
+			Log::info() << "The driver does not support program binaries, the program binary cache is disabled";
+
+			programBinaryDirectory_.clear();
+			return std::string();
+		}
+
+		for (const GLenum name : {GL_VENDOR, GL_RENDERER, GL_VERSION})
+		{
+			const GLubyte* value = glGetString(name);
+			ocean_assert(GL_NO_ERROR == glGetError());
+
+			if (value != nullptr)
+			{
+				driverIdentifier_ += std::string((const char*)(value));
+			}
+
+			driverIdentifier_ += '|';
+		}
+	}
+
+	// FNV-1a hash of the driver, the program type, and the shader codes
+
+	uint64_t hash = 14695981039346656037ull;
+
+	const auto hashData = [&hash](const char* data, const size_t size)
+	{
+		for (size_t n = 0; n < size; ++n)
+		{
+			hash = (hash ^ uint64_t(uint8_t(data[n]))) * 1099511628211ull;
+		}
+	};
+
+	hashData(driverIdentifier_.c_str(), driverIdentifier_.size() + 1);
+
+	const uint32_t programTypeValue = uint32_t(programType);
+	hashData((const char*)(&programTypeValue), sizeof(programTypeValue));
+
+	for (const ShaderCodes* shaderCodes : {&vertexCodes, &fragmentCodes})
+	{
+		for (const char* shaderCode : *shaderCodes)
+		{
+			ocean_assert(shaderCode != nullptr);
+			hashData(shaderCode, strlen(shaderCode) + 1);
+		}
+
+		hashData("|", 1);
+	}
+
+	return programBinaryDirectory_ + String::toAStringHex((unsigned long long)(hash)) + ".glprogram";
+}
+
+GLESProgramManager::ProgramTypeSet GLESProgramManager::readProgramBinaryIndex() const
+{
+	ProgramTypeSet programTypes;
+
+	if (programBinaryDirectory_.empty())
+	{
+		return programTypes;
+	}
+
+	std::ifstream stream((programBinaryDirectory_ + programBinaryIndexFilename_).c_str());
+
+	uint32_t programType = 0u;
+
+	while (stream >> programType)
+	{
+		if (programType != uint32_t(GLESAttribute::PT_UNKNOWN))
+		{
+			programTypes.emplace(GLESAttribute::ProgramType(programType));
+		}
+	}
+
+	return programTypes;
+}
+
+bool GLESProgramManager::writeProgramBinaryIndex() const
+{
+	ocean_assert(!programBinaryDirectory_.empty());
+
+	std::ofstream stream((programBinaryDirectory_ + programBinaryIndexFilename_).c_str(), std::ios::trunc);
+
+	for (const GLESAttribute::ProgramType programType : programBinaryIndex_)
+	{
+		stream << uint32_t(programType) << '\n';
+	}
+
+	return stream.good();
+}
+
 GLESProgramManager::ShaderCodes GLESProgramManager::vertexShaderCodes(const GLESAttribute::ProgramType programType) const
 {
 	switch (uint32_t(programType))
@@ -1417,10 +1679,16 @@ GLESProgramManager::ShaderCodes GLESProgramManager::vertexShaderCodes(const GLES
 			return {partPlatform_, programVertexShaderDebugGray_};
 
 		case GLESAttribute::PT_MATERIAL:
-			return {partPlatform_, partDefinitionMaterial_, programVertexShaderMaterial_};
+			return {partPlatform_, partDefinitionMaterial_, partDefinitionTransformations_, programVertexShaderMaterial_};
+
+		case GLESAttribute::PT_MATERIAL | GLESAttribute::PT_INSTANCED:
+			return {partPlatform_, partDefinitionMaterial_, partDefinitionInstancedTransformations_, programVertexShaderMaterial_};
 
 		case GLESAttribute::PT_MATERIAL | GLESAttribute::PT_LIGHT:
-			return {partPlatform_, partDefinitionMaterial_, partDefinitionLight_, partFunctionLighting_, programVertexShaderMaterialLight_};
+			return {partPlatform_, partDefinitionMaterial_, partDefinitionLight_, partFunctionLighting_, partDefinitionTransformations_, programVertexShaderMaterialLight_};
+
+		case GLESAttribute::PT_MATERIAL | GLESAttribute::PT_LIGHT | GLESAttribute::PT_INSTANCED:
+			return {partPlatform_, partDefinitionMaterial_, partDefinitionLight_, partFunctionLighting_, partDefinitionInstancedTransformations_, programVertexShaderMaterialLight_};
 
 		case GLESAttribute::PT_TEXTURE_LOWER_LEFT | GLESAttribute::PT_TEXTURE_Y:
 		case GLESAttribute::PT_TEXTURE_LOWER_LEFT | GLESAttribute::PT_TEXTURE_RGBA:
@@ -1511,7 +1779,9 @@ GLESProgramManager::ShaderCodes GLESProgramManager::fragmentShaderCodes(const GL
 			return {partPlatform_, programFragmentShaderOneSidedColor_};
 
 		case GLESAttribute::PT_MATERIAL:
+		case GLESAttribute::PT_MATERIAL | GLESAttribute::PT_INSTANCED:
 		case GLESAttribute::PT_MATERIAL | GLESAttribute::PT_LIGHT:
+		case GLESAttribute::PT_MATERIAL | GLESAttribute::PT_LIGHT | GLESAttribute::PT_INSTANCED:
 		case GLESAttribute::PT_POINTS | GLESAttribute::PT_MATERIAL:
 		case GLESAttribute::PT_POINTS | GLESAttribute::PT_MATERIAL | GLESAttribute::PT_LIGHT:
 			return {partPlatform_, programFragmentShaderTwoSidedColor_};
@@ -19,6 +19,7 @@
 #include "ocean/rendering/Engine.h"
 
 #include <map>
+#include <set>
 
 namespace Ocean
 {
@@ -54,6 +55,18 @@ class OCEAN_RENDERING_GLES_EXPORT GLESProgramManager : public Singleton<GLESProg
 		 */
 		using ProgramMap = std::unordered_map<GLESAttribute::ProgramType, GLESShaderProgramRef>;
 
+		/**
+		 * Definition of a set holding program types.
+		 */
+		using ProgramTypeSet = std::set<GLESAttribute::ProgramType>;
+
+	public:
+
+		/**
+		 * Definition of a vector holding program types.
+		 */
+		using ProgramTypes = std::vector<GLESAttribute::ProgramType>;
+
 	public:
 
 		/**
@@ -64,6 +77,32 @@ class OCEAN_RENDERING_GLES_EXPORT GLESProgramManager : public Singleton<GLESProg
 		 */
 		GLESShaderProgramRef program(const Engine& engine, const GLESAttribute::ProgramType programType);
 
+		/**
+		 * Returns whether a program type can be combined with PT_INSTANCED to render several instances with one draw call.
+		 * @param programType The program type to check, with or without PT_INSTANCED
+		 * @return True, if so
+		 */
+		static bool isInstancingSupported(const GLESAttribute::ProgramType programType);
+
+		/**
+		 * Sets the directory of a persistent cache for the binaries of linked programs.
+		 * Programs found in the cache are created without compiling and linking their shaders at all.<br>
+		 * The entries of the cache are identified by the shader codes and the type of the program, and by the vendor, renderer, and version of the driver, outdated entries are replaced automatically.
+		 * @param directory The existing directory in which the binaries will be stored, an empty string to disable the cache
+		 * @return True, if succeeded
+		 */
+		bool setProgramBinaryCache(const std::string& directory);
+
+		/**
+		 * Creates all programs which have been stored in the program binary cache before and all given programs, so that the programs do not need to be created when they are used for the first time.
+		 * This function needs a current GL context sharing its objects with the contexts of the framebuffers, e.g., the shared context of a thread which is running in the background during startup.
+		 * @param engine The rendering engine to be used
+		 * @param programTypes Optional program types to be created in addition to the program types known from the cache
+		 * @return The number of programs which could be created
+		 * @see setProgramBinaryCache().
+		 */
+		size_t precompilePrograms(const Engine& engine, const ProgramTypes& programTypes = ProgramTypes());
+
 		/**
 		 * Releases the shader manager.
 		 * This function should be called once before program termination.
@@ -96,6 +135,45 @@ class OCEAN_RENDERING_GLES_EXPORT GLESProgramManager : public Singleton<GLESProg
 		 */
 		ShaderCodes fragmentShaderCodes(const GLESAttribute::ProgramType programType) const;
 
+		/**
+		 * Creates a program from the program binary cache.
+		 * @param engine The rendering engine to be used
+		 * @param programType The type of the program
+		 * @param filename The filename of the cache entry of the program, must be valid
+		 * @return The program, invalid if the cache does not contain a usable binary of the program
+		 */
+		GLESShaderProgramRef loadProgramBinary(const Engine& engine, const GLESAttribute::ProgramType programType, const std::string& filename) const;
+
+		/**
+		 * Stores the binary of a linked program in the program binary cache.
+		 * @param program The linked program to store
+		 * @param filename The filename of the cache entry of the program, must be valid
+		 * @return True, if succeeded
+		 */
+		bool storeProgramBinary(const GLESShaderProgram& program, const std::string& filename);
+
+		/**
+		 * Returns the filename of the cache entry of a program.
+		 * The filename is composed of a hash of the shader codes, the program type, and the driver of the current GL context.
+		 * @param programType The type of the program
+		 * @param vertexCodes The codes of the vertex shader
+		 * @param fragmentCodes The codes of the fragment shader
+		 * @return The filename of the cache entry, empty if the cache is not enabled
+		 */
+		std::string programBinaryFilename(const GLESAttribute::ProgramType programType, const ShaderCodes& vertexCodes, const ShaderCodes& fragmentCodes);
+
+		/**
+		 * Reads the program types known from the program binary cache.
+		 * @return The program types which have been stored in the cache before
+		 */
+		ProgramTypeSet readProgramBinaryIndex() const;
+
+		/**
+		 * Writes the program types known from the program binary cache.
+		 * @return True, if succeeded
+		 */
+		bool writeProgramBinaryIndex() const;
+
 	protected:
 
 		/// Map mapping vertex shader codes to compiled shader objects.
@@ -107,6 +185,15 @@ class OCEAN_RENDERING_GLES_EXPORT GLESProgramManager : public Singleton<GLESProg
 		/// Map mapping program types to shader program objects.
 		ProgramMap programMap_;
 
+		/// The directory of the program binary cache, empty if the cache is disabled.
+		std::string programBinaryDirectory_;
+
+		/// The identifier of the driver of the GL context, used to identify the entries of the program binary cache, empty if not yet determined.
+		std::string driverIdentifier_;
+
+		/// The program types which have been stored in the program binary cache.
+		ProgramTypeSet programBinaryIndex_;
+
 		/// Lock for the program manager.
 		Lock lock_;
 
@@ -117,6 +204,12 @@ class OCEAN_RENDERING_GLES_EXPORT GLESProgramManager : public Singleton<GLESProg
 
 #endif // OCEAN_DEBUG
 
+		/// The magic number at the beginning of each entry of the program binary cache.
+		static constexpr uint32_t programBinaryMagic_ = 0x4F475042u;
+
+		/// The filename of the index of the program binary cache, holding the program types which have been stored in the cache.
+		static constexpr const char* programBinaryIndexFilename_ = "programTypes.index";
+
 		/// The code part containing platform specific information e.g., shader version.
 		static const char* partPlatform_;
 
@@ -153,6 +246,18 @@ class OCEAN_RENDERING_GLES_EXPORT GLESProgramManager : public Singleton<GLESProg
 		/// The code part defining the function to determine the light for a vertex based on up to 8 lights
 		static const char* partFunctionLighting_;
 
+		/// The code part defining the projection matrix as uniform.
+		static const char* partDefinitionProjection_;
+
+		/// The code part defining the projection matrices of a multiview program as uniforms, selecting the matrix of the current view.
+		static const char* partDefinitionMultiviewProjection_;
+
+		/// The code part defining the model view matrix and the normal matrix as uniforms.
+		static const char* partDefinitionTransformations_;
+
+		/// The code part defining the model view matrix and the normal matrix as per-instance attributes.
+		static const char* partDefinitionInstancedTransformations_;
+
 		/// Vertex shader code: PT_STATIC_COLOR.
 		static const char* programVertexShaderStaticColor_;
 
@@ -6,6 +6,7 @@
  */
 
 #include "ocean/rendering/glescenegraph/GLESRenderable.h"
+#include "ocean/rendering/glescenegraph/GLESNode.h"
 
 namespace Ocean
 {
@@ -25,7 +26,136 @@ GLESRenderable::GLESRenderable() :
 
 GLESRenderable::~GLESRenderable()
 {
-	// nothing to do here
+	if (vboInstances_ != 0u)
+	{
+		glDeleteBuffers(1, &vboInstances_);
+		ocean_assert(GL_NO_ERROR == glGetError());
+	}
+}
+
+bool GLESRenderable::renderInstanced(const GLESFramebuffer& /*framebuffer*/, const SquareMatrix4& /*projectionMatrix*/, const HomogenousMatrices4& /*camera_T_instances*/, const HomogenousMatrix4& /*camera_T_world*/, const SquareMatrices3& /*normalMatrices*/, GLESAttributeSet& /*attributeSet*/, const Lights& /*lights*/)
+{
+	return false;
+}
+
+bool GLESRenderable::bindInstances(const GLuint programId, const HomogenousMatrices4& camera_T_instances, const SquareMatrices3& normalMatrices)
+{
+	ocean_assert(programId != 0u);
+	ocean_assert(!camera_T_instances.empty() && camera_T_instances.size() == normalMatrices.size());
+
+	if (camera_T_instances.empty() || camera_T_instances.size() != normalMatrices.size())
+	{
+		return false;
+	}
+
+	const GLint locationModelViewMatrix = glGetAttribLocation(programId, "aInstanceModelViewMatrix");
+	const GLint locationNormalMatrix = glGetAttribLocation(programId, "aInstanceNormalMatrix");
+
+	if (locationModelViewMatrix == -1)
+	{
+		ocean_assert(false && "The program does not support instancing!");
+		return false;
+	}
+
+	// each instance stores the column-major 4x4 model view matrix followed by the column-major 3x3 normal matrix
+
+	constexpr size_t instanceElements = 16 + 9;
+
+	instanceValues_.resize(camera_T_instances.size() * instanceElements);
+
+	float* values = instanceValues_.data();
+
+	for (size_t nInstance = 0; nInstance < camera_T_instances.size(); ++nInstance)
+	{
+		const HomogenousMatrix4& camera_T_instance = camera_T_instances[nInstance];
+		const SquareMatrix3& normalMatrix = normalMatrices[nInstance];
+
+		for (unsigned int n = 0u; n < 16u; ++n)
+		{
+			*values++ = float(camera_T_instance[n]);
+		}
+
+		for (unsigned int n = 0u; n < 9u; ++n)
+		{
+			*values++ = float(normalMatrix[n]);
+		}
+	}
+
+	if (vboInstances_ == 0u)
+	{
+		glGenBuffers(1, &vboInstances_);
+		ocean_assert(GL_NO_ERROR == glGetError());
+	}
+
+	glBindBuffer(GL_ARRAY_BUFFER, vboInstances_);
+	ocean_assert(GL_NO_ERROR == glGetError());
+
+	glBufferData(GL_ARRAY_BUFFER, GLsizeiptr(instanceValues_.size() * sizeof(float)), instanceValues_.data(), GL_STREAM_DRAW);
+	ocean_assert(GL_NO_ERROR == glGetError());
+
+	constexpr GLsizei stride = GLsizei(instanceElements * sizeof(float));
+
+	// a mat4 attribute occupies four consecutive locations, one for each column
+
+	for (GLuint nColumn = 0u; nColumn < 4u; ++nColumn)
+	{
+		const GLuint location = GLuint(locationModelViewMatrix) + nColumn;
+
+		glEnableVertexAttribArray(location);
+		glVertexAttribPointer(location, 4, GL_FLOAT, GL_FALSE, stride, (const void*)(size_t(nColumn) * 4 * sizeof(float)));
+		glVertexAttribDivisor(location, 1u);
+	}
+
+	if (locationNormalMatrix != -1)
+	{
+		for (GLuint nColumn = 0u; nColumn < 3u; ++nColumn)
+		{
+			const GLuint location = GLuint(locationNormalMatrix) + nColumn;
+
+			glEnableVertexAttribArray(location);
+			glVertexAttribPointer(location, 3, GL_FLOAT, GL_FALSE, stride, (const void*)((16 + size_t(nColumn) * 3) * sizeof(float)));
+			glVertexAttribDivisor(location, 1u);
+		}
+	}
+
+	ocean_assert(GL_NO_ERROR == glGetError());
+
+	return true;
+}
+
+void GLESRenderable::unbindInstances(const GLuint programId)
+{
+	ocean_assert(programId != 0u);
+
+	const GLint locationModelViewMatrix = glGetAttribLocation(programId, "aInstanceModelViewMatrix");
+	const GLint locationNormalMatrix = glGetAttribLocation(programId, "aInstanceNormalMatrix");
+
+	// the vertex array of the vertex set is shared with individual renderables, so that the locations must not keep the per-instance state
+
+	if (locationModelViewMatrix != -1)
+	{
+		for (GLuint nColumn = 0u; nColumn < 4u; ++nColumn)
+		{
+			glVertexAttribDivisor(GLuint(locationModelViewMatrix) + nColumn, 0u);
+			glDisableVertexAttribArray(GLuint(locationModelViewMatrix) + nColumn);
+		}
+	}
+
+	if (locationNormalMatrix != -1)
+	{
+		for (GLuint nColumn = 0u; nColumn < 3u; ++nColumn)
+		{
+			glVertexAttribDivisor(GLuint(locationNormalMatrix) + nColumn, 0u);
+			glDisableVertexAttribArray(GLuint(locationNormalMatrix) + nColumn);
+		}
+	}
+
+	ocean_assert(GL_NO_ERROR == glGetError());
+}
+
+void GLESRenderable::invalidateParentBoundingBoxes() const
+{
+	GLESNode::invalidateParentBoundingBoxes(*this);
 }
 
 }
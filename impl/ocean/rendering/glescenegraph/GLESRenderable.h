@@ -70,6 +70,20 @@ class OCEAN_RENDERING_GLES_EXPORT GLESRenderable :
 		 */
 		virtual void render(const SquareMatrix4& projectionMatrix, const HomogenousMatrix4& camera_T_object, const HomogenousMatrix4& camera_T_world, const SquareMatrix3& normalMatrix, GLESShaderProgram& shaderProgram) = 0;
 
+		/**
+		 * Renders several instances of the renderable node with one draw call, the shader program is determined automatically.
+		 * The default implementation does not support instancing.
+		 * @param framebuffer The framebuffer in which the renderable will be rendered
+		 * @param projectionMatrix The projection matrix to be applied, must be valid
+		 * @param camera_T_instances The transformations between the individual instances and the camera, at least one
+		 * @param camera_T_world The transformation between world and camera, must be valid
+		 * @param normalMatrices The normal transformation matrices of the individual instances, one for each instance
+		 * @param attributeSet The attributes defining the appearance of all instances
+		 * @param lights The lights used the render the instances, can be empty
+		 * @return True, if the instances have been rendered; False, if the renderable or the attribute set does not support instancing so that the instances need to be rendered individually
+		 */
+		virtual bool renderInstanced(const GLESFramebuffer& framebuffer, const SquareMatrix4& projectionMatrix, const HomogenousMatrices4& camera_T_instances, const HomogenousMatrix4& camera_T_world, const SquareMatrices3& normalMatrices, GLESAttributeSet& attributeSet, const Lights& lights);
+
 	protected:
 
 		/**
@@ -82,10 +96,39 @@ class OCEAN_RENDERING_GLES_EXPORT GLESRenderable :
 		 */
 		~GLESRenderable() override;
 
+		/**
+		 * Uploads the transformations of instances and binds them as per-instance attributes of the currently bound vertex array.
+		 * @param programId The id of the instanced shader program, must be valid
+		 * @param camera_T_instances The transformations between the individual instances and the camera, at least one
+		 * @param normalMatrices The normal transformation matrices of the individual instances, one for each instance
+		 * @return True, if succeeded
+		 * @see unbindInstances().
+		 */
+		bool bindInstances(const GLuint programId, const HomogenousMatrices4& camera_T_instances, const SquareMatrices3& normalMatrices);
+
+		/**
+		 * Unbinds the per-instance attributes so that the vertex array can be used for individual renderables again.
+		 * @param programId The id of the instanced shader program which has been used in bindInstances(), must be valid
+		 */
+		void unbindInstances(const GLuint programId);
+
+		/**
+		 * Invalidates the cached bounding boxes of all nodes using this renderable.
+		 * This function needs to be called whenever the bounding box of this renderable has changed.
+		 * @see GLESNode::invalidateBoundingBox().
+		 */
+		void invalidateParentBoundingBoxes() const;
+
 	protected:
 
 		/// The renderable's bounding box.
 		BoundingBox boundingBox_;
+
+		/// The buffer object holding the per-instance transformations, 0 if not yet created.
+		GLuint vboInstances_ = 0u;
+
+		/// The memory for the per-instance transformations, kept to avoid reallocations.
+		std::vector<float> instanceValues_;
 };
 
 inline const BoundingBox& GLESRenderable::boundingBox() const
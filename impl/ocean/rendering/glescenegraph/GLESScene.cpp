@@ -60,6 +60,11 @@ void GLESScene::addToTraverser(const GLESFramebuffer& framebuffer, const SquareM
 
 	const HomogenousMatrix4 camera_T_object = transformModifier_ ? (camera_T_parent * parent_T_object_ * transformModifier_->transformation()) : (camera_T_parent * parent_T_object_);
 
+	if (isCulled(camera_T_object, traverser))
+	{
+		return;
+	}
+
 	if (groupLights.empty())
 	{
 		for (Nodes::const_iterator i = groupNodes.begin(); i != groupNodes.end(); ++i)
@@ -7,6 +7,7 @@
 
 #include "ocean/rendering/glescenegraph/GLESShaderProgram.h"
 
+#include "ocean/rendering/glescenegraph/GLESFramebuffer.h"
 #include "ocean/rendering/glescenegraph/GLESObject.h"
 #include "ocean/rendering/glescenegraph/GLESTexture.h"
 
@@ -84,6 +85,10 @@ bool GLESShaderProgram::link(const ProgramType programType, const std::vector<GL
 		ocean_assert(GL_NO_ERROR == glGetError());
 	}
 
+	// allowing to store the linked program in the binary cache of the program manager
+	glProgramParameteri(id_, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+	ocean_assert(GL_NO_ERROR == glGetError());
+
 	glLinkProgram(id_);
 	ocean_assert(GL_NO_ERROR == glGetError());
 
@@ -112,6 +117,76 @@ bool GLESShaderProgram::link(const ProgramType programType, const std::vector<GL
 	return true;
 }
 
+bool GLESShaderProgram::linkBinary(const ProgramType programType, const GLenum binaryFormat, const void* binary, const size_t size)
+{
+	ocean_assert(programType != PT_UNKNOWN);
+	ocean_assert(binary != nullptr && size != 0);
+
+	if (binary == nullptr || size == 0 || size > size_t(NumericT<GLsizei>::maxValue()))
+	{
+		return false;
+	}
+
+	release();
+
+	id_ = glCreateProgram();
+	ocean_assert(GL_NO_ERROR == glGetError());
+
+	glProgramBinary(id_, binaryFormat, binary, GLsizei(size));
+
+	// an unsupported binary format results in an error, which is expected e.g., after a driver update
+	const GLenum binaryError = glGetError();
+
+	GLint programLinked = 0;
+	glGetProgramiv(id_, GL_LINK_STATUS, &programLinked);
+	ocean_assert(GL_NO_ERROR == glGetError());
+
+	if (binaryError != GL_NO_ERROR || !programLinked)
+	{
+		release();
+		return false;
+	}
+
+	linkedBinary_ = true;
+
+	programType_ = programType;
+
+	return true;
+}
+
+bool GLESShaderProgram::programBinary(GLenum& binaryFormat, std::vector<uint8_t>& binary) const
+{
+	if (!isCompiled())
+	{
+		return false;
+	}
+
+	GLint binaryLength = 0;
+	glGetProgramiv(id_, GL_PROGRAM_BINARY_LENGTH, &binaryLength);
+	ocean_assert(GL_NO_ERROR == glGetError());
+
+	if (binaryLength <= 0)
+	{
+		return false;
+	}
+
+	binary.resize(size_t(binaryLength));
+
+	GLsizei length = 0;
+	glGetProgramBinary(id_, GLsizei(binaryLength), &length, &binaryFormat, binary.data());
+
+	if (glGetError() != GL_NO_ERROR || length <= 0)
+	{
+		binary.clear();
+		return false;
+	}
+
+	ocean_assert(length <= binaryLength);
+	binary.resize(size_t(length));
+
+	return true;
+}
+
 bool GLESShaderProgram::compileAndLink(const ProgramType programType, const std::vector<const char*>& vertexShaderCode, const std::vector<const char*>& fragmentShaderCode, std::string& message)
 {
 	const ShaderCodePairs shaderCodePairs =
@@ -175,13 +250,28 @@ void GLESShaderProgram::bind(const SquareMatrix4& projection, const HomogenousMa
 	ocean_assert(programType_ != PT_UNKNOWN);
 
 	ocean_assert(glIsProgram(id_));
-	glUseProgram(id_);
-	ocean_assert(GL_NO_ERROR == glGetError());
 
-	const GLint projectLocation = glGetUniformLocation(id_, "projectionMatrix");
-	if (projectLocation != -1)
+	GLuint& currentProgramId = GLESShaderProgram::currentProgramId();
+
+	if (currentProgramId != id_)
 	{
-		GLESObject::setUniform(projectLocation, projection);
+		glUseProgram(id_);
+		ocean_assert(GL_NO_ERROR == glGetError());
+
+		currentProgramId = id_;
+	}
+
+	// uniforms are part of the program's state, so that the matrices which are identical for all renderables of a frame need to be set only once
+
+	if (boundProjection_ != projection)
+	{
+		const GLint projectLocation = glGetUniformLocation(id_, "projectionMatrix");
+		if (projectLocation != -1)
+		{
+			GLESObject::setUniform(projectLocation, projection);
+		}
+
+		boundProjection_ = projection;
 	}
 
 	const GLint modelViewMatrixLocation = glGetUniformLocation(id_, "modelViewMatrix");
@@ -191,11 +281,16 @@ void GLESShaderProgram::bind(const SquareMatrix4& projection, const HomogenousMa
 		GLESObject::setUniform(modelViewMatrixLocation, camera_T_model);
 	}
 
-	const GLint viewMatrixLocation = glGetUniformLocation(id_, "viewMatrix");
-	if (viewMatrixLocation != -1)
+	if (boundCamera_T_world_ != camera_T_world)
 	{
-		ocean_assert(camera_T_world.isValid());
-		GLESObject::setUniform(viewMatrixLocation, camera_T_world);
+		const GLint viewMatrixLocation = glGetUniformLocation(id_, "viewMatrix");
+		if (viewMatrixLocation != -1)
+		{
+			ocean_assert(camera_T_world.isValid());
+			GLESObject::setUniform(viewMatrixLocation, camera_T_world);
+		}
+
+		boundCamera_T_world_ = camera_T_world;
 	}
 
 	const GLint normalMatrixLocation = glGetUniformLocation(id_, "normalMatrix");
@@ -220,6 +315,24 @@ void GLESShaderProgram::bind(const GLESFramebuffer& framebuffer, const SquareMat
 
 	ocean_assert(GL_NO_ERROR == glGetError());
 
+	if ((programType_ & PT_MULTIVIEW) == PT_MULTIVIEW)
+	{
+		const SquareMatrix4* multiviewProjectionMatrices = framebuffer.multiviewProjectionMatrices();
+		ocean_assert(multiviewProjectionMatrices != nullptr);
+
+		if (multiviewProjectionMatrices != nullptr && (boundMultiviewProjections_[0] != multiviewProjectionMatrices[0] || boundMultiviewProjections_[1] != multiviewProjectionMatrices[1]))
+		{
+			const GLint projectionMatricesLocation = glGetUniformLocation(id_, "projectionMatrices");
+			if (projectionMatricesLocation != -1)
+			{
+				GLESObject::setUniform(projectionMatricesLocation, SquareMatrices4(multiviewProjectionMatrices, multiviewProjectionMatrices + 2));
+			}
+
+			boundMultiviewProjections_[0] = multiviewProjectionMatrices[0];
+			boundMultiviewProjections_[1] = multiviewProjectionMatrices[1];
+		}
+	}
+
 	bindAttribute(framebuffer, *this);
 
 	ocean_assert(GL_NO_ERROR == glGetError());
@@ -573,7 +686,7 @@ bool GLESShaderProgram::setParameter(const std::string& name, const SquareMatric
 
 bool GLESShaderProgram::isCompiled() const
 {
-	return !shaders_.empty();
+	return !shaders_.empty() || linkedBinary_;
 }
 
 std::string GLESShaderProgram::translateShaderType(const GLenum shaderType)
@@ -646,11 +759,34 @@ void GLESShaderProgram::release()
 		glDeleteProgram(id_);
 		ocean_assert(GL_NO_ERROR == glGetError());
 
+		if (currentProgramId() == id_)
+		{
+			// the id may be reused for a new program
+			invalidateCurrentProgram();
+		}
+
 		id_ = 0;
 		ocean_assert(GL_NO_ERROR == glGetError());
 	}
 
+	linkedBinary_ = false;
+
 	programType_ = PT_UNKNOWN;
+
+	boundProjection_ = SquareMatrix4(false);
+	boundCamera_T_world_ = HomogenousMatrix4(false);
+
+	boundMultiviewProjections_[0] = SquareMatrix4(false);
+	boundMultiviewProjections_[1] = SquareMatrix4(false);
+}
+
+GLuint& GLESShaderProgram::currentProgramId()
+{
+	// each thread has an individual GL context
+
+	thread_local GLuint programId = 0u;
+
+	return programId;
 }
 
 }
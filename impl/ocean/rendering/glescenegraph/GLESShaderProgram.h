@@ -131,6 +131,12 @@ class OCEAN_RENDERING_GLES_EXPORT GLESShaderProgram :
 		 */
 		inline GLuint id() const;
 
+		/**
+		 * Returns the type of this shader program.
+		 * @return The program type, PT_UNKNOWN if the program is not linked
+		 */
+		inline ProgramType programType() const;
+
 		/**
 		 * Links a vertex and a fragment shader.
 		 * @param programType The type of the shader program, must be valid
@@ -150,6 +156,24 @@ class OCEAN_RENDERING_GLES_EXPORT GLESShaderProgram :
 		 */
 		bool link(const ProgramType programType, const std::vector<GLESShaderRef>& shaders, std::string& message);
 
+		/**
+		 * Links the shader program from a program binary which has been determined with programBinary() before.
+		 * @param programType The type of the shader program, must be valid
+		 * @param binaryFormat The driver specific format of the binary
+		 * @param binary The program binary, must be valid
+		 * @param size The size of the program binary, in bytes, with range [1, infinity)
+		 * @return True, if succeeded; False, if the driver rejected the binary e.g., after a driver update
+		 */
+		bool linkBinary(const ProgramType programType, const GLenum binaryFormat, const void* binary, const size_t size);
+
+		/**
+		 * Returns the binary of this linked shader program.
+		 * @param binaryFormat The resulting driver specific format of the binary
+		 * @param binary The resulting program binary
+		 * @return True, if succeeded
+		 */
+		bool programBinary(GLenum& binaryFormat, std::vector<uint8_t>& binary) const;
+
 		/**
 		 * Compiles and links a vertex and a fragment shader.
 		 * @param programType The type of the shader program, must be valid
@@ -171,6 +195,7 @@ class OCEAN_RENDERING_GLES_EXPORT GLESShaderProgram :
 
 		/**
 		 * Uses the shader and binds the given projection and model matrices as OpenGL uniforms.
+		 * The program is not used again if it is the program which has been used most recently, the projection and view matrices are not set again if the program holds them already.
 		 * @param projection The projection matrix used for this node
 		 * @param camera_T_model The transformation between model and camera (aka Modelview matrix), must be valid
 		 * @param camera_T_world The transformation between world and camera,(aka View matrix) must be valid
@@ -351,6 +376,12 @@ class OCEAN_RENDERING_GLES_EXPORT GLESShaderProgram :
 		 */
 		static std::string translateShaderType(const GLenum shaderType);
 
+		/**
+		 * Invalidates the knowledge about the program which has been used most recently in the current thread.
+		 * This function must be called whenever a program is used without bind(), e.g., after glUseProgram() has been called directly.
+		 */
+		static inline void invalidateCurrentProgram();
+
 	protected:
 
 		/**
@@ -358,6 +389,12 @@ class OCEAN_RENDERING_GLES_EXPORT GLESShaderProgram :
 		 */
 		void release();
 
+		/**
+		 * Returns the id of the program which has been used most recently in the current thread.
+		 * @return The id of the program, 0 if unknown
+		 */
+		static GLuint& currentProgramId();
+
 	protected:
 
 		/// OpenGL ES shader program id.
@@ -369,6 +406,9 @@ class OCEAN_RENDERING_GLES_EXPORT GLESShaderProgram :
 		/// The shaders.
 		std::vector<GLESShaderRef> shaders_;
 
+		/// True, if the program has been linked from a program binary without any shaders.
+		bool linkedBinary_ = false;
+
 		/// The map of texture samplers.
 		SamplerMap samplers_;
 
@@ -407,6 +447,15 @@ class OCEAN_RENDERING_GLES_EXPORT GLESShaderProgram :
 
 		/// The map of SquareMatrices3 values.
 		Parameters<SquareMatrices3> parametersSquareMatrices3_;
+
+		/// The projection matrix which has been set as uniform most recently.
+		mutable SquareMatrix4 boundProjection_ = SquareMatrix4(false);
+
+		/// The view matrix which has been set as uniform most recently.
+		mutable HomogenousMatrix4 boundCamera_T_world_ = HomogenousMatrix4(false);
+
+		/// The projection matrices of both views of a multiview program which have been set as uniforms most recently.
+		SquareMatrix4 boundMultiviewProjections_[2] = {SquareMatrix4(false), SquareMatrix4(false)};
 };
 
 template <typename T>
@@ -458,6 +507,16 @@ inline GLuint GLESShaderProgram::id() const
 	return id_;
 }
 
+inline GLESShaderProgram::ProgramType GLESShaderProgram::programType() const
+{
+	return programType_;
+}
+
+inline void GLESShaderProgram::invalidateCurrentProgram()
+{
+	currentProgramId() = 0u;
+}
+
 }
 
 }
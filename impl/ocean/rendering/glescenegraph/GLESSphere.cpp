@@ -150,6 +150,8 @@ void GLESSphere::updateBoundingBox()
 {
 	const Scalar diamenter = radius_ * Scalar(2);
 	boundingBox_ = BoundingBox(Box3(Vector3(0, 0, 0), diamenter, diamenter, diamenter));
+
+	invalidateParentBoundingBoxes();
 }
 
 GLESSphere::ObjectType GLESSphere::type() const
@@ -52,7 +52,7 @@ void GLESSwitch::addToTraverser(const GLESFramebuffer& framebuffer, const Square
 {
 	const ScopedLock scopedLock(objectLock);
 
-	if (!visible_ || groupNodes.empty())
+	if (!visible_ || groupNodes.empty() || isCulled(camera_T_parent, traverser))
 	{
 		return;
 	}
@@ -32,11 +32,15 @@ GLESText::FontManager::FontData GLESText::FontManager::fontData(Rendering::Engin
 
 	const ScopedLock scopedLock(lock_);
 
-	FontMap::const_iterator i = fontMap_.find(FontPair(fontFamily, styleName));
+	++usageCounter_;
 
-	if (i != fontMap_.cend())
+	FontMap::iterator i = fontMap_.find(FontPair(fontFamily, styleName));
+
+	if (i != fontMap_.end())
 	{
-		return i->second;
+		i->second.second = usageCounter_;
+
+		return i->second.first;
 	}
 
 	CV::Fonts::SharedFont localFont = font(fontFamily, styleName);
@@ -87,7 +91,24 @@ GLESText::FontManager::FontData GLESText::FontManager::fontData(Rendering::Engin
 
 	FontData fontData(localFont, textures, fontCharacters, textureWidth, textureHeight);
 
-	fontMap_[FontPair(fontFamily, styleName)] = fontData;
+	if (fontMap_.size() >= maximalFonts_)
+	{
+		// we release the least recently used font
+
+		FontMap::iterator iLeastRecentlyUsed = fontMap_.begin();
+
+		for (FontMap::iterator iFont = fontMap_.begin(); iFont != fontMap_.end(); ++iFont)
+		{
+			if (iFont->second.second < iLeastRecentlyUsed->second.second)
+			{
+				iLeastRecentlyUsed = iFont;
+			}
+		}
+
+		fontMap_.erase(iLeastRecentlyUsed);
+	}
+
+	fontMap_[FontPair(fontFamily, styleName)] = FontDataUsagePair(fontData, usageCounter_);
 
 	return fontData;
 }
@@ -113,6 +134,9 @@ GLESText::GLESText() :
 	backgroundMaterial_->setDiffuseColor(RGBAColor(0, 0, 0));
 
 	fontFamily_ = availableDefaultFont(&styleName_);
+
+	// the geometry of a text is re-created whenever the text changes
+	shapeVertexSet.force<GLESVertexSet>().setBufferUsage(GL_DYNAMIC_DRAW);
 }
 
 GLESText::~GLESText()
@@ -206,7 +230,7 @@ void GLESText::setText(const std::string& text)
 	if (text_ != text)
 	{
 		text_ = text;
-		needsRebuild_ = true;
+		requestRebuild();
 	}
 }
 
@@ -229,13 +253,13 @@ bool GLESText::setSize(const Scalar fixedWidth, const Scalar fixedHeight, const
 	if (fixedWidthHeight_ != Vector2(fixedWidth, fixedHeight))
 	{
 		fixedWidthHeight_ = Vector2(fixedWidth, fixedHeight);
-		needsRebuild_ = true;
+		requestRebuild();
 	}
 
 	if (fixedLineHeight_ != fixedLineHeight)
 	{
 		fixedLineHeight_ = fixedLineHeight;
-		needsRebuild_ = true;
+		requestRebuild();
 	}
 
 	return true;
@@ -249,7 +273,7 @@ void GLESText::setFont(const std::string& fontFamily, const std::string& styleNa
 	{
 		fontFamily_ = fontFamily;
 		styleName_ = styleName;
-		needsRebuild_ = true;
+		requestRebuild();
 	}
 }
 
@@ -262,7 +286,7 @@ void GLESText::setBackgroundMaterial(const MaterialRef& material)
 
 	if (oldTransparency != newTransparency)
 	{
-		needsRebuild_ = true;
+		requestRebuild();
 	}
 
 	backgroundMaterial_ = material;
@@ -275,7 +299,7 @@ void GLESText::setAlignmentMode(const AlignmentMode alignmentMode)
 	if (alignmentMode_ != alignmentMode)
 	{
 		alignmentMode_ = alignmentMode;
-		needsRebuild_ = true;
+		requestRebuild();
 	}
 }
 
@@ -286,7 +310,7 @@ void GLESText::setHorizontalAnchor(const HorizontalAnchor horizontalAnchor)
 	if (horizontalAnchor_ != horizontalAnchor)
 	{
 		horizontalAnchor_ = horizontalAnchor;
-		needsRebuild_ = true;
+		requestRebuild();
 	}
 }
 
@@ -297,7 +321,7 @@ void GLESText::setVerticalAnchor(const VerticalAnchor verticalAnchor)
 	if (verticalAnchor_ != verticalAnchor)
 	{
 		verticalAnchor_ = verticalAnchor;
-		needsRebuild_ = true;
+		requestRebuild();
 	}
 }
 
@@ -308,7 +332,7 @@ void GLESText::setGeometryLookupTable(const LookupCorner2<Vector3>& lookupTable)
 	if (lookupTable_ != lookupTable)
 	{
 		lookupTable_ = lookupTable;
-		needsRebuild_ = true;
+		requestRebuild();
 	}
 }
 
@@ -380,15 +404,19 @@ void GLESText::render(const GLESFramebuffer& framebuffer, const SquareMatrix4& p
 		{
 			// we create an unlit text
 
-			const GLint locationDiffuseColor = glGetUniformLocation(attributeSet.shaderProgram()->id(), "material.diffuseColor");
-			ocean_assert(locationDiffuseColor != -1);
+			if (uniformProgramId_ != attributeSet.shaderProgram()->id())
+			{
+				uniformProgramId_ = attributeSet.shaderProgram()->id();
 
-			setUniform(locationDiffuseColor, RGBAColor(0, 0, 0));
+				locationDiffuseColor_ = glGetUniformLocation(uniformProgramId_, "material.diffuseColor");
+				locationEmissiveColor_ = glGetUniformLocation(uniformProgramId_, "material.emissiveColor");
+			}
 
-			const GLint locationEmissiveColor = glGetUniformLocation(attributeSet.shaderProgram()->id(), "material.emissiveColor");
-			ocean_assert(locationEmissiveColor != -1);
+			ocean_assert(locationDiffuseColor_ != -1);
+			setUniform(locationDiffuseColor_, RGBAColor(0, 0, 0));
 
-			setUniform(locationEmissiveColor, RGBAColor(1, 1, 1));
+			ocean_assert(locationEmissiveColor_ != -1);
+			setUniform(locationEmissiveColor_, RGBAColor(1, 1, 1));
 		}
 
 		if (backgroundMaterial_ && !transparentText)
@@ -446,6 +474,7 @@ void GLESText::rebuildPrimitives()
 	{
 		setFaces(TriangleFaces());
 		shapeVertexSet->set(Vectors3(), Vectors3(), Vectors2(), RGBAColors());
+		numberPlanarNormals_ = 0;
 
 		return;
 	}
@@ -485,6 +514,7 @@ void GLESText::rebuildPrimitives()
 	{
 		setFaces(TriangleFaces());
 		shapeVertexSet->set(Vectors3(), Vectors3(), Vectors2(), RGBAColors());
+		numberPlanarNormals_ = 0;
 
 		return;
 	}
@@ -523,13 +553,18 @@ void GLESText::rebuildPrimitives()
 
 	const bool drawBackground = backgroundMaterial_ ? backgroundMaterial_->transparency() < 1.0f - NumericF::weakEps() : false; // drawing the background in case the valid background material is not fully transparent
 
-	Vectors3 vertices;
-	vertices.reserve(drawBackground ? text_.size() * 4 : text_.size() * 16);
+	// the buffers keep their memory, so that a changing text does not need to allocate memory
+
+	Vectors3& vertices = textVertices_;
+	vertices.clear();
+	vertices.reserve(drawBackground ? text_.size() * 16 : text_.size() * 4);
 
-	Vectors2 textureCoordinates;
+	Vectors2& textureCoordinates = textTextureCoordinates_;
+	textureCoordinates.clear();
 	textureCoordinates.reserve(vertices.capacity());
 
-	TriangleFaces triangleFaces;
+	TriangleFaces& triangleFaces = textTriangleFaces_;
+	triangleFaces.clear();
 	triangleFaces.reserve(vertices.capacity() / 2);
 
 	const unsigned int firstLineWidthPixels = linePixelBoundingBoxes.front().isValid() ? linePixelBoundingBoxes.front().width() : 0u;
@@ -803,7 +838,8 @@ void GLESText::rebuildPrimitives()
 		}
 	}
 
-	Vectors3 normals;
+	ocean_assert(vertices.size() == textureCoordinates.size());
+	ocean_assert(vertices.size() == triangleFaces.size() * 2);
 
 	if (lookupTable_)
 	{
@@ -831,26 +867,39 @@ void GLESText::rebuildPrimitives()
 			}
 		}
 
-		normals = TriangleFace::calculatePerFaceNormals(triangleFaces, vertices, true /*counterClockWise*/);
+		const Vectors3 perFaceNormals = TriangleFace::calculatePerFaceNormals(triangleFaces, vertices, true /*counterClockWise*/);
+		const Vectors3 normals = TriangleFace::calculateSmoothedPerVertexNormals(triangleFaces, vertices, perFaceNormals);
+		ocean_assert(vertices.size() == normals.size());
 
-		normals = TriangleFace::calculateSmoothedPerVertexNormals(triangleFaces, vertices, normals);
+		shapeVertexSet->setNormals(normals);
+		numberPlanarNormals_ = 0;
 	}
-	else
+	else if (numberPlanarNormals_ != vertices.size())
 	{
-		normals = Vectors3(vertices.size(), Vector3(0, 0, 1)); // all normals point into the same direction
-	}
+		// all normals point into the same direction, so that the normals need to be set only if the number of vertices changes
 
-	ocean_assert(vertices.size() == textureCoordinates.size());
-	ocean_assert(vertices.size() == normals.size());
-
-	ocean_assert(vertices.size() == triangleFaces.size() * 2);
+		shapeVertexSet->setNormals(Vectors3(vertices.size(), Vector3(0, 0, 1)));
+		numberPlanarNormals_ = vertices.size();
+	}
 
 	shapeVertexSet->setVertices(vertices);
-	shapeVertexSet->setNormals(normals);
 	shapeVertexSet->setTextureCoordinates(textureCoordinates, 0u);
 
-	setFaces(triangleFaces);
-	setVertexSet(shapeVertexSet);
+	// the text is composed of quads with identical face pattern, so that the faces need to be set only if the number of quads changes
+
+	if (explicitTriangleFaces_.size() != triangleFaces.size())
+	{
+		setFaces(triangleFaces);
+	}
+	else
+	{
+		ocean_assert(explicitTriangleFaces_ == triangleFaces);
+	}
+
+	if (vertexSet() != shapeVertexSet)
+	{
+		setVertexSet(shapeVertexSet);
+	}
 
 	resultingSize_ = Vector2(textWidth, textHeight);
 
@@ -858,6 +907,8 @@ void GLESText::rebuildPrimitives()
 	const Scalar yTextCenter = -textHeight * Scalar(0.5) + vertexAnchorOffsetY;
 
 	boundingBox_ = BoundingBox(Box3(Vector3(xTextCenter, yTextCenter, 0), textWidth, textHeight, 0));
+
+	invalidateParentBoundingBoxes();
 }
 
 void GLESText::updateBoundingBox()
@@ -865,6 +916,18 @@ void GLESText::updateBoundingBox()
 	// nothing to do here, as the bounding box will been updated in rebuildPrimitives() already.
 }
 
+void GLESText::requestRebuild()
+{
+	needsRebuild_ = true;
+
+	if (boundingBox_.isValid())
+	{
+		boundingBox_ = BoundingBox();
+
+		invalidateParentBoundingBoxes();
+	}
+}
+
 bool GLESText::calculateTextSize(const CV::Fonts::Font& font, CV::PixelBoundingBoxesI& linePixelBoundingBoxes, unsigned int& textWidthPixels, unsigned int& textHeightPixels, Scalar& textWidth, Scalar& textHeight) const
 {
 	linePixelBoundingBoxes.clear();
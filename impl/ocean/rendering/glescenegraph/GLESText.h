@@ -45,6 +45,8 @@ class OCEAN_RENDERING_GLES_EXPORT GLESText :
 
 		/**
 		 * The manager providing access to the texture containing the font's characters and some associated information.
+		 * The texture of a font is shared by all text objects using the font.<br>
+		 * The manager holds the textures of a limited number of fonts, the least recently used font is released first (text objects still using the font keep the texture alive).
 		 */
 		class FontManager : public Singleton<FontManager>
 		{
@@ -100,15 +102,23 @@ class OCEAN_RENDERING_GLES_EXPORT GLESText :
 
 			protected:
 
+				/// The maximal number of fonts for which the manager holds the textures.
+				static constexpr size_t maximalFonts_ = 8;
+
 				/**
 				 * Definition of a pair combining the font's family name and style name.
 				 */
 				using FontPair = std::pair<std::string, std::string>;
 
+				/**
+				 * Definition of a pair combining a FontData object with the usage counter of the most recent request.
+				 */
+				using FontDataUsagePair = std::pair<FontData, uint64_t>;
+
 				/**
 				 * Definition of a map mapping the font's name pair to FontData objects.
 				 */
-				using FontMap = std::map<FontPair, FontData>;
+				using FontMap = std::map<FontPair, FontDataUsagePair>;
 
 			public:
 
@@ -141,6 +151,9 @@ class OCEAN_RENDERING_GLES_EXPORT GLESText :
 				/// The map mapping font names to FontData objects.
 				FontMap fontMap_;
 
+				/// The usage counter, increased with each request.
+				uint64_t usageCounter_ = 0ull;
+
 				/// The manager's lock.
 				Lock lock_;
 		};
@@ -310,6 +323,12 @@ class OCEAN_RENDERING_GLES_EXPORT GLESText :
 		 */
 		void updateBoundingBox() override;
 
+		/**
+		 * Requests a rebuild of the primitives before the text is rendered the next time.
+		 * The bounding box of the text is unknown until the primitives have been rebuilt.
+		 */
+		void requestRebuild();
+
 		/**
 		 * Calculates the size of the reulting text block.
 		 * @param font The font to be used
@@ -362,6 +381,27 @@ class OCEAN_RENDERING_GLES_EXPORT GLESText :
 
 		/// The optional lookup table for the text geometry.
 		LookupCorner2<Vector3> lookupTable_;
+
+		/// The vertices of the text, kept to avoid memory allocations when the text changes.
+		Vectors3 textVertices_;
+
+		/// The texture coordinates of the text, kept to avoid memory allocations when the text changes.
+		Vectors2 textTextureCoordinates_;
+
+		/// The triangle faces of the text, kept to avoid memory allocations when the text changes.
+		TriangleFaces textTriangleFaces_;
+
+		/// The number of planar normals which have been set in the vertex set, 0 if the normals have been determined with the lookup table.
+		size_t numberPlanarNormals_ = 0;
+
+		/// The id of the shader program for which the uniform locations have been determined, 0 if unknown.
+		GLuint uniformProgramId_ = 0u;
+
+		/// The location of the diffuse color uniform in the shader program.
+		GLint locationDiffuseColor_ = -1;
+
+		/// The location of the emissive color uniform in the shader program.
+		GLint locationEmissiveColor_ = -1;
 };
 
 inline GLESText::FontManager::FontData::FontData(const CV::Fonts::SharedFont& font, const TexturesRef& textures, const CV::Fonts::Font::SharedCharacters& characters, const unsigned int textureWidth, const unsigned int textureHeight) :
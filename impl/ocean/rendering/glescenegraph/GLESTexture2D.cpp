@@ -43,6 +43,23 @@ GLESTexture2D::~GLESTexture2D()
 		secondaryTextureId_ = 0u;
 	}
 
+	for (size_t n = 0; n < numberPixelBuffers_; ++n)
+	{
+		if (pixelBufferFences_[n] != nullptr)
+		{
+			glDeleteSync(pixelBufferFences_[n]);
+			ocean_assert(GL_NO_ERROR == glGetError());
+			pixelBufferFences_[n] = nullptr;
+		}
+
+		if (pixelBufferIds_[n] != 0u)
+		{
+			glDeleteBuffers(1, &pixelBufferIds_[n]);
+			ocean_assert(GL_NO_ERROR == glGetError());
+			pixelBufferIds_[n] = 0u;
+		}
+	}
+
 	unregisterDynamicUpdateObject();
 }
 
@@ -808,16 +825,6 @@ bool GLESTexture2D::updateTexture(const Frame& frame)
 
 	frameTimestamp_ = frame.timestamp();
 
-	GLenum format = 0u;
-	GLenum type = 0u;
-	unsigned int width = 0u;
-	unsigned int height = 0u;
-
-	if (!determinePrimaryTextureProperties(frameType_, width, height, format, type))
-	{
-		return false;
-	}
-
 	const Frame* primaryTextureFrame = &frame;
 	bool mayNeedSecondaryTexture = true;
 
@@ -843,18 +850,66 @@ bool GLESTexture2D::updateTexture(const Frame& frame)
 		mayNeedSecondaryTexture = false;
 	}
 
+	ocean_assert(primaryTextureFrame != nullptr);
+
+	PlanePointers planePointers = {};
+
+	const bool usePixelBuffer = stagePixelBuffer(*primaryTextureFrame, planePointers);
+
+	if (!usePixelBuffer)
+	{
+		for (unsigned int planeIndex = 0u; planeIndex < std::min(primaryTextureFrame->numberPlanes(), (unsigned int)(maximalPixelBufferPlanes_)); ++planeIndex)
+		{
+			planePointers[planeIndex] = primaryTextureFrame->constdata<void>(planeIndex);
+		}
+	}
+
+	const bool result = uploadTexturePlanes(*primaryTextureFrame, mayNeedSecondaryTexture, planePointers);
+
+	if (usePixelBuffer)
+	{
+		releasePixelBuffer();
+	}
+
+	if (!result)
+	{
+		return false;
+	}
+
+	if (useMipmap_)
+	{
+		createMipmap();
+	}
+
+	return true;
+}
+
+bool GLESTexture2D::uploadTexturePlanes(const Frame& frame, const bool mayNeedSecondaryTexture, const PlanePointers& planePointers)
+{
+	ocean_assert(frame.isValid());
+	ocean_assert(frame.numberPlanes() <= (unsigned int)(maximalPixelBufferPlanes_));
+
+	GLenum format = 0u;
+	GLenum type = 0u;
+	unsigned int width = 0u;
+	unsigned int height = 0u;
+
+	if (!determinePrimaryTextureProperties(frameType_, width, height, format, type))
+	{
+		return false;
+	}
+
 	ocean_assert(primaryTextureId_ != 0u);
 	ocean_assert(GL_NO_ERROR == glGetError());
 
 	glBindTexture(GL_TEXTURE_2D, primaryTextureId_);
 	ocean_assert(GL_NO_ERROR == glGetError());
 
-	ocean_assert(primaryTextureFrame != nullptr);
-	ocean_assert(primaryTextureFrame->dataType() == FrameType::DT_UNSIGNED_INTEGER_8);
+	ocean_assert(frame.dataType() == FrameType::DT_UNSIGNED_INTEGER_8);
 
 	unsigned int rowLength = 0u;
 	unsigned int byteAlignment = 0u;
-	if (!determineAlignment(primaryTextureFrame->strideBytes(0u), rowLength, byteAlignment))
+	if (!determineAlignment(frame.strideBytes(0u), rowLength, byteAlignment))
 	{
 		return false;
 	}
@@ -862,7 +917,7 @@ bool GLESTexture2D::updateTexture(const Frame& frame)
 	glPixelStorei(GL_UNPACK_ALIGNMENT, int(byteAlignment));
 	ocean_assert(GL_NO_ERROR == glGetError());
 
-	glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, width, height, format, type, primaryTextureFrame->constdata<void>(0u));
+	glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, width, height, format, type, planePointers[0]);
 	ocean_assert(GL_NO_ERROR == glGetError());
 
 	if (mayNeedSecondaryTexture && determineSecondaryTextureProperties(frameType_, width, height, format, type))
@@ -890,7 +945,7 @@ bool GLESTexture2D::updateTexture(const Frame& frame)
 				glPixelStorei(GL_UNPACK_ALIGNMENT, int(byteAlignment));
 				ocean_assert(GL_NO_ERROR == glGetError());
 
-				glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, width, height, format, type, frame.constdata<void>(1u));
+				glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, width, height, format, type, planePointers[1]);
 				ocean_assert(GL_NO_ERROR == glGetError());
 
 				break;
@@ -921,7 +976,7 @@ bool GLESTexture2D::updateTexture(const Frame& frame)
 				glPixelStorei(GL_UNPACK_ALIGNMENT, int(byteAlignment));
 				ocean_assert(GL_NO_ERROR == glGetError());
 
-				glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, width, height_2, format, type, frame.constdata<void>(firstPlaneIndex));
+				glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, width, height_2, format, type, planePointers[firstPlaneIndex]);
 				ocean_assert(GL_NO_ERROR == glGetError());
 
 				rowLength = 0u;
@@ -936,7 +991,7 @@ bool GLESTexture2D::updateTexture(const Frame& frame)
 
 				const GLint& yOffset = GLint(height_2);
 
-				glTexSubImage2D(GL_TEXTURE_2D, 0, 0, yOffset, width, height_2, format, type, frame.constdata<void>(secondPlaneIndex));
+				glTexSubImage2D(GL_TEXTURE_2D, 0, 0, yOffset, width, height_2, format, type, planePointers[secondPlaneIndex]);
 				ocean_assert(GL_NO_ERROR == glGetError());
 
 				break;
@@ -959,6 +1014,247 @@ bool GLESTexture2D::updateTexture(const Frame& frame)
 		}
 	}
 
+	return true;
+}
+
+bool GLESTexture2D::stagePixelBuffer(const Frame& frame, PlanePointers& planePointers)
+{
+	ocean_assert(frame.isValid());
+
+	if (frame.numberPlanes() > (unsigned int)(maximalPixelBufferPlanes_))
+	{
+		return false;
+	}
+
+	// the plane offsets within the buffer are aligned to 16 bytes, matching any unpack alignment
+
+	constexpr size_t planeAlignment = 16;
+
+	size_t bufferSize = 0;
+
+	for (unsigned int planeIndex = 0u; planeIndex < frame.numberPlanes(); ++planeIndex)
+	{
+		bufferSize = (bufferSize + planeAlignment - 1) / planeAlignment * planeAlignment;
+		bufferSize += size_t(frame.size(planeIndex));
+	}
+
+	uint8_t* const bufferData = mapPixelBuffer(bufferSize);
+
+	if (bufferData == nullptr)
+	{
+		return false;
+	}
+
+	size_t offset = 0;
+
+	for (unsigned int planeIndex = 0u; planeIndex < frame.numberPlanes(); ++planeIndex)
+	{
+		offset = (offset + planeAlignment - 1) / planeAlignment * planeAlignment;
+
+		const size_t planeSize = size_t(frame.size(planeIndex));
+
+		memcpy(bufferData + offset, frame.constdata<void>(planeIndex), planeSize);
+
+		// the texture uploads read from the bound buffer, the pointer is interpreted as offset
+		planePointers[planeIndex] = (const void*)(offset);
+
+		offset += planeSize;
+	}
+
+	ocean_assert(offset == bufferSize);
+
+	return unmapPixelBuffer();
+}
+
+uint8_t* GLESTexture2D::mapPixelBuffer(const size_t bufferSize)
+{
+	ocean_assert(bufferSize != 0);
+
+	const size_t bufferIndex = pixelBufferIndex_;
+
+	if (pixelBufferFences_[bufferIndex] != nullptr)
+	{
+		const GLenum waitResult = glClientWaitSync(pixelBufferFences_[bufferIndex], 0, 0u);
+		ocean_assert(GL_NO_ERROR == glGetError());
+
+		if (waitResult != GL_ALREADY_SIGNALED && waitResult != GL_CONDITION_SATISFIED)
+		{
+			// the GPU is still reading from the buffer, mapping the buffer would stall the render thread
+
+			return nullptr;
+		}
+
+		glDeleteSync(pixelBufferFences_[bufferIndex]);
+		ocean_assert(GL_NO_ERROR == glGetError());
+		pixelBufferFences_[bufferIndex] = nullptr;
+	}
+
+	if (pixelBufferIds_[bufferIndex] == 0u)
+	{
+		glGenBuffers(1, &pixelBufferIds_[bufferIndex]);
+		ocean_assert(GL_NO_ERROR == glGetError());
+
+		if (pixelBufferIds_[bufferIndex] == 0u)
+		{
+			return nullptr;
+		}
+	}
+
+	glBindBuffer(GL_PIXEL_UNPACK_BUFFER, pixelBufferIds_[bufferIndex]);
+	ocean_assert(GL_NO_ERROR == glGetError());
+
+	if (pixelBufferSizes_[bufferIndex] != bufferSize)
+	{
+		glBufferData(GL_PIXEL_UNPACK_BUFFER, GLsizeiptr(bufferSize), nullptr, GL_STREAM_DRAW);
+		ocean_assert(GL_NO_ERROR == glGetError());
+
+		pixelBufferSizes_[bufferIndex] = bufferSize;
+	}
+
+	uint8_t* const bufferData = (uint8_t*)(glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, GLsizeiptr(bufferSize), GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT));
+	ocean_assert(GL_NO_ERROR == glGetError());
+
+	if (bufferData == nullptr)
+	{
+		glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0u);
+		ocean_assert(GL_NO_ERROR == glGetError());
+	}
+
+	return bufferData;
+}
+
+bool GLESTexture2D::unmapPixelBuffer()
+{
+	const GLboolean unmapResult = glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+	ocean_assert(GL_NO_ERROR == glGetError());
+
+	if (unmapResult == GL_FALSE)
+	{
+		// the content of the buffer has been corrupted (e.g., due to a display mode change)
+
+		glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0u);
+		ocean_assert(GL_NO_ERROR == glGetError());
+
+		return false;
+	}
+
+	return true;
+}
+
+bool GLESTexture2D::updateTextureRegions(const Frame& frame, const CV::PixelBoundingBoxes& regions)
+{
+	ocean_assert(frame.isValid());
+
+	GLenum format = 0u;
+	GLenum type = 0u;
+	unsigned int width = 0u;
+	unsigned int height = 0u;
+
+	if (frame.frameType() != frameType_ || frame.numberPlanes() != 1u || frame.dataType() != FrameType::DT_UNSIGNED_INTEGER_8
+			|| !determinePrimaryTextureProperties(frameType_, width, height, format, type) || width != frame.width() || height != frame.height())
+	{
+		// the texture does not exist yet, or the frame cannot be uploaded region-wise
+
+		return updateTexture(frame);
+	}
+
+	const unsigned int bytesPerPixel = frame.planeBytesPerPixel(0u);
+
+	if (bytesPerPixel == 0u)
+	{
+		return updateTexture(frame);
+	}
+
+	const CV::PixelBoundingBox frameBoundingBox(CV::PixelPosition(0u, 0u), frame.width(), frame.height());
+
+	CV::PixelBoundingBoxes clippedRegions;
+	clippedRegions.reserve(regions.size());
+
+	// the regions are packed row by row with 4-byte aligned rows
+
+	size_t bufferSize = 0;
+	std::vector<size_t> regionOffsets;
+	regionOffsets.reserve(regions.size());
+
+	for (const CV::PixelBoundingBox& region : regions)
+	{
+		const CV::PixelBoundingBox clippedRegion = region && frameBoundingBox;
+
+		if (!clippedRegion.isValid())
+		{
+			continue;
+		}
+
+		clippedRegions.emplace_back(clippedRegion);
+		regionOffsets.emplace_back(bufferSize);
+
+		const size_t rowBytes = (size_t(clippedRegion.width()) * size_t(bytesPerPixel) + 3) / 4 * 4;
+
+		bufferSize += rowBytes * size_t(clippedRegion.height());
+	}
+
+	if (clippedRegions.empty())
+	{
+		return true;
+	}
+
+	frameTimestamp_ = frame.timestamp();
+
+	uint8_t* targetData = mapPixelBuffer(bufferSize);
+	const bool usePixelBuffer = targetData != nullptr;
+
+	if (!usePixelBuffer)
+	{
+		regionMemory_.resize(bufferSize);
+		targetData = regionMemory_.data();
+	}
+
+	for (size_t n = 0; n < clippedRegions.size(); ++n)
+	{
+		const CV::PixelBoundingBox& region = clippedRegions[n];
+
+		const size_t regionWidthBytes = size_t(region.width()) * size_t(bytesPerPixel);
+		const size_t rowBytes = (regionWidthBytes + 3) / 4 * 4;
+
+		uint8_t* target = targetData + regionOffsets[n];
+
+		for (unsigned int y = region.top(); y < region.bottomEnd(); ++y)
+		{
+			memcpy(target, frame.constpixel<uint8_t>(region.left(), y), regionWidthBytes);
+			target += rowBytes;
+		}
+	}
+
+	if (usePixelBuffer && !unmapPixelBuffer())
+	{
+		return updateTexture(frame);
+	}
+
+	ocean_assert(primaryTextureId_ != 0u);
+	ocean_assert(GL_NO_ERROR == glGetError());
+
+	glBindTexture(GL_TEXTURE_2D, primaryTextureId_);
+	ocean_assert(GL_NO_ERROR == glGetError());
+
+	glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+	ocean_assert(GL_NO_ERROR == glGetError());
+
+	for (size_t n = 0; n < clippedRegions.size(); ++n)
+	{
+		const CV::PixelBoundingBox& region = clippedRegions[n];
+
+		// the texture uploads read from the bound buffer if a buffer is used, the pointer is interpreted as offset
+		const void* source = usePixelBuffer ? (const void*)(regionOffsets[n]) : (const void*)(targetData + regionOffsets[n]);
+
+		glTexSubImage2D(GL_TEXTURE_2D, 0, GLint(region.left()), GLint(region.top()), GLsizei(region.width()), GLsizei(region.height()), format, type, source);
+		ocean_assert(GL_NO_ERROR == glGetError());
+	}
+
+	if (usePixelBuffer)
+	{
+		releasePixelBuffer();
+	}
+
 	if (useMipmap_)
 	{
 		createMipmap();
@@ -967,6 +1263,19 @@ bool GLESTexture2D::updateTexture(const Frame& frame)
 	return true;
 }
 
+void GLESTexture2D::releasePixelBuffer()
+{
+	glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0u);
+	ocean_assert(GL_NO_ERROR == glGetError());
+
+	ocean_assert(pixelBufferFences_[pixelBufferIndex_] == nullptr);
+
+	pixelBufferFences_[pixelBufferIndex_] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+	ocean_assert(GL_NO_ERROR == glGetError());
+
+	pixelBufferIndex_ = (pixelBufferIndex_ + 1) % numberPixelBuffers_;
+}
+
 }
 
 }
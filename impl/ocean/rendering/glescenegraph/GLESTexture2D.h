@@ -14,6 +14,10 @@
 #include "ocean/rendering/Texture2D.h"
 #include "ocean/rendering/DynamicObject.h"
 
+#include "ocean/cv/PixelBoundingBox.h"
+
+#include <array>
+
 namespace Ocean
 {
 
@@ -193,15 +197,85 @@ class OCEAN_RENDERING_GLES_EXPORT GLESTexture2D :
 		 */
 		static bool secondaryTextureName(const std::string& names, std::string& name);
 
+	protected:
+
+		/**
+		 * Definition of the number of pixel unpack buffers which are used in a round-robin manner to upload frames.
+		 */
+		static constexpr size_t numberPixelBuffers_ = 3;
+
+		/**
+		 * Definition of the maximal number of planes which can be uploaded via a pixel unpack buffer.
+		 */
+		static constexpr size_t maximalPixelBufferPlanes_ = 3;
+
+		/**
+		 * Definition of an array holding the source pointers of the individual planes of a texture upload.
+		 * The pointers are either pointing to the frame's memory or are offsets within the bound pixel unpack buffer.
+		 */
+		using PlanePointers = std::array<const void*, maximalPixelBufferPlanes_>;
+
 	protected:
 
 		/**
 		 * Updates the texture based on a given frame.
+		 * The frame is copied into a pixel unpack buffer so that the actual transfer to the texture happens asynchronously, if the buffer is not available the texture is updated from the frame's memory directly.
 		 * @param frame The frame to be used to update the texture, must be valid
 		 * @return True, if succeeded
 		 */
 		bool updateTexture(const Frame& frame);
 
+		/**
+		 * Updates individual regions of the texture based on a given frame.
+		 * The pixels of all regions are packed into one pixel unpack buffer (or into a reusable memory block if the buffer is not available) and are uploaded with one sub-image update per region.<br>
+		 * The entire texture is updated if the frame does not match the current texture (e.g., if the frame needs to be converted or has several planes).
+		 * @param frame The entire frame holding the new content of the texture, must be valid
+		 * @param regions The regions of the frame to be uploaded, regions outside of the frame are clipped
+		 * @return True, if succeeded
+		 */
+		bool updateTextureRegions(const Frame& frame, const CV::PixelBoundingBoxes& regions);
+
+		/**
+		 * Uploads the planes of a frame into the primary and secondary texture.
+		 * @param frame The frame to upload, with frame type matching the internal frame type of this texture, must be valid
+		 * @param mayNeedSecondaryTexture True, if the secondary planes of the frame may be uploaded into the secondary texture; False, if the frame is a converted frame with one plane
+		 * @param planePointers The source pointers of the individual planes, one for each plane of the frame
+		 * @return True, if succeeded
+		 */
+		bool uploadTexturePlanes(const Frame& frame, const bool mayNeedSecondaryTexture, const PlanePointers& planePointers);
+
+		/**
+		 * Copies all planes of a frame into the next pixel unpack buffer and binds the buffer.
+		 * The copy is skipped if the GPU has not yet finished reading the buffer from the previous use so that the render thread never stalls.
+		 * @param frame The frame to copy, must be valid
+		 * @param planePointers The resulting offsets of the individual planes within the bound buffer, one for each plane of the frame
+		 * @return True, if succeeded; False, if the frame must be uploaded from the frame's memory directly
+		 * @see releasePixelBuffer().
+		 */
+		bool stagePixelBuffer(const Frame& frame, PlanePointers& planePointers);
+
+		/**
+		 * Binds and maps the next pixel unpack buffer for writing.
+		 * The buffer is not used if the GPU has not yet finished reading the buffer from the previous use so that the render thread never stalls.
+		 * @param bufferSize The size of the buffer to map, in bytes, with range [1, infinity)
+		 * @return The pointer to the mapped memory of the buffer, nullptr if the buffer is not available
+		 * @see unmapPixelBuffer().
+		 */
+		uint8_t* mapPixelBuffer(const size_t bufferSize);
+
+		/**
+		 * Unmaps the pixel unpack buffer which has been mapped before, the buffer stays bound.
+		 * @return True, if succeeded; False, if the content of the buffer got lost and the buffer has been unbound
+		 * @see mapPixelBuffer().
+		 */
+		bool unmapPixelBuffer();
+
+		/**
+		 * Unbinds the pixel unpack buffer which has been staged and inserts a fence after the texture uploads which are reading from the buffer.
+		 * @see stagePixelBuffer().
+		 */
+		void releasePixelBuffer();
+
 	protected:
 
 		/// The texture wrap s type.
@@ -221,6 +295,21 @@ class OCEAN_RENDERING_GLES_EXPORT GLESTexture2D :
 
 		/// Optional temp conversion frame.
 		Frame conversionFrame_;
+
+		/// The OpenGL ES ids of the pixel unpack buffers.
+		GLuint pixelBufferIds_[numberPixelBuffers_] = {0u, 0u, 0u};
+
+		/// The sizes of the pixel unpack buffers, in bytes.
+		size_t pixelBufferSizes_[numberPixelBuffers_] = {0, 0, 0};
+
+		/// The fences signaling that the GPU has finished reading the individual pixel unpack buffers, nullptr if a buffer has not been used yet.
+		GLsync pixelBufferFences_[numberPixelBuffers_] = {nullptr, nullptr, nullptr};
+
+		/// The index of the pixel unpack buffer which will be used for the next upload.
+		size_t pixelBufferIndex_ = 0;
+
+		/// The reusable memory holding the packed pixels of texture regions if no pixel unpack buffer is available.
+		std::vector<uint8_t> regionMemory_;
 };
 
 inline GLuint GLESTexture2D::primaryTextureId() const
@@ -382,6 +382,8 @@ unsigned int GLESTextureFramebuffer::bindTexture(GLESShaderProgram& shaderProgra
 	glUseProgram(shaderProgram.id());
 	ocean_assert(GL_NO_ERROR == glGetError());
 
+	GLESShaderProgram::invalidateCurrentProgram();
+
 	glActiveTexture(GLenum(GL_TEXTURE0 + id));
 	ocean_assert(GL_NO_ERROR == glGetError());
 
@@ -501,55 +503,9 @@ bool GLESTextureFramebuffer::copyColorTextureToFrame(Frame& frame, const CV::Pix
 		GLenum textureFormat = GL_RGB;
 		GLenum textureType = GL_UNSIGNED_BYTE;
 
-		switch (pixelFormat_)
+		if (!determineReadFormat(textureFormat, textureType))
 		{
-			case FrameType::FORMAT_RGB24:
-				break;
-
-			case FrameType::FORMAT_RGBA32:
-				textureFormat = GL_RGBA;
-				break;
-
-			case FrameType::FORMAT_Y8:
-				textureFormat = GL_RED;
-				break;
-
-			case FrameType::FORMAT_YA16:
-				textureFormat = GL_RG;
-				break;
-
-			case FrameType::FORMAT_Y32:
-				textureFormat = GL_RED_INTEGER;
-				textureType = GL_UNSIGNED_INT;
-				break;
-
-			case FrameType::FORMAT_F32:
-			{
-#ifdef OCEAN_RENDERING_GLES_USE_ES
-				if (majorVersion_ == 0)
-				{
-					glGetIntegerv(GL_MAJOR_VERSION, &majorVersion_);
-					ocean_assert(GL_NO_ERROR == glGetError());
-				}
-
-				if (majorVersion_ <= 2)
-				{
-					ocean_assert(false && "OpenGLES 2.0 does not support to read float framebuffers, use the Y32 workaround instead");
-					return false;
-				}
-
-				textureFormat = GL_RED;
-				textureType = GL_FLOAT;
-#else
-				textureFormat = GL_RED;
-				textureType = GL_FLOAT;
-#endif
-				break;
-			}
-
-			default:
-				ocean_assert(false && "This must never happen!");
-				break;
+			return false;
 		}
 
 #ifdef OCEAN_PLATFORM_BUILD_APPLE_IOS_ANY
@@ -891,6 +847,8 @@ bool GLESTextureFramebuffer::copyDepthTextureToFrame(Frame& frame, const CV::Pix
 	glUseProgram(shaderProgramForOneSample.id());
 	ocean_assert(GL_NO_ERROR == glGetError());
 
+	GLESShaderProgram::invalidateCurrentProgram();
+
 	// we bind the depth texture of this framebuffer as input texture
 
 	ocean_assert(depthTextureId_ != 0u);
@@ -1076,6 +1034,199 @@ bool GLESTextureFramebuffer::copyDepthTextureToFrame(Frame& frame, const CV::Pix
 
 #endif //  OCEAN_RENDERING_GLES_USE_ES
 
+bool GLESTextureFramebuffer::startColorTextureReadback(const CV::PixelBoundingBox& subRegion)
+{
+	if (framebufferObjectId_ == 0u || framebufferMultisamples_ != 1u)
+	{
+		return false;
+	}
+
+	if (numberPendingReadbacks_ >= numberReadbackBuffers_)
+	{
+		// all buffers are still pending, the caller has to finish the oldest copy first
+
+		return false;
+	}
+
+	unsigned int subRegionLeft = 0u;
+	unsigned int subRegionTop = 0u;
+	unsigned int subRegionWidth = width_;
+	unsigned int subRegionHeight = height_;
+
+	if (subRegion.isValid())
+	{
+		if (subRegion.rightEnd() > width_ || subRegion.bottomEnd() > height_)
+		{
+			ocean_assert(false && "Invalid sub-region!");
+			return false;
+		}
+
+		subRegionLeft = subRegion.left();
+		subRegionTop = subRegion.top();
+		subRegionWidth = subRegion.width();
+		subRegionHeight = subRegion.height();
+	}
+
+	const FrameType frameType(subRegionWidth, subRegionHeight, pixelFormat_, FrameType::ORIGIN_LOWER_LEFT);
+
+	if (!frameType.isValid())
+	{
+		return false;
+	}
+
+	GLenum textureFormat = GL_RGB;
+	GLenum textureType = GL_UNSIGNED_BYTE;
+
+	if (!determineReadFormat(textureFormat, textureType))
+	{
+		return false;
+	}
+
+	// glReadPixels() writes rows with the default pack alignment of 4 bytes
+
+	const size_t rowBytes = size_t(frameType.width()) * size_t(FrameType::planeBytesPerPixel(frameType.pixelFormat(), 0u));
+	const size_t alignedRowBytes = (rowBytes + 3) / 4 * 4;
+	const size_t bufferSize = alignedRowBytes * size_t(subRegionHeight);
+
+	const size_t bufferIndex = (readbackIndex_ + numberPendingReadbacks_) % numberReadbackBuffers_;
+	ocean_assert(readbackFences_[bufferIndex] == nullptr);
+
+	ocean_assert(GL_NO_ERROR == glGetError());
+
+	if (readbackBufferIds_[bufferIndex] == 0u)
+	{
+		glGenBuffers(1, &readbackBufferIds_[bufferIndex]);
+		ocean_assert(GL_NO_ERROR == glGetError());
+
+		if (readbackBufferIds_[bufferIndex] == 0u)
+		{
+			return false;
+		}
+	}
+
+	glBindBuffer(GL_PIXEL_PACK_BUFFER, readbackBufferIds_[bufferIndex]);
+	ocean_assert(GL_NO_ERROR == glGetError());
+
+	if (readbackBufferSizes_[bufferIndex] != bufferSize)
+	{
+		glBufferData(GL_PIXEL_PACK_BUFFER, GLsizeiptr(bufferSize), nullptr, GL_STREAM_READ);
+		ocean_assert(GL_NO_ERROR == glGetError());
+
+		readbackBufferSizes_[bufferIndex] = bufferSize;
+	}
+
+	glBindFramebuffer(GL_FRAMEBUFFER, framebufferObjectId_);
+	ocean_assert(GL_NO_ERROR == glGetError());
+
+	glReadBuffer(GL_COLOR_ATTACHMENT0);
+	ocean_assert(GL_NO_ERROR == glGetError());
+
+	// with a bound pixel pack buffer, the pointer is an offset within the buffer
+
+	glReadPixels(GLint(subRegionLeft), GLint(subRegionTop), subRegionWidth, subRegionHeight, textureFormat, textureType, nullptr);
+
+	const GLenum result = glGetError();
+	ocean_assert(result == GL_NO_ERROR);
+
+	glBindFramebuffer(GL_FRAMEBUFFER, 0u);
+	ocean_assert(GL_NO_ERROR == glGetError());
+
+	glBindBuffer(GL_PIXEL_PACK_BUFFER, 0u);
+	ocean_assert(GL_NO_ERROR == glGetError());
+
+	if (result != GL_NO_ERROR)
+	{
+		return false;
+	}
+
+	readbackFences_[bufferIndex] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+	ocean_assert(GL_NO_ERROR == glGetError());
+
+	if (readbackFences_[bufferIndex] == nullptr)
+	{
+		return false;
+	}
+
+	readbackFrameTypes_[bufferIndex] = frameType;
+	++numberPendingReadbacks_;
+
+	return true;
+}
+
+bool GLESTextureFramebuffer::finishColorTextureReadback(Frame& frame)
+{
+	if (numberPendingReadbacks_ == 0)
+	{
+		return false;
+	}
+
+	const size_t bufferIndex = readbackIndex_;
+	ocean_assert(readbackFences_[bufferIndex] != nullptr && readbackBufferIds_[bufferIndex] != 0u);
+
+	// we do not wait for the GPU, if the copy has not been executed yet, the caller will try again later
+
+	const GLenum waitResult = glClientWaitSync(readbackFences_[bufferIndex], GL_SYNC_FLUSH_COMMANDS_BIT, 0u);
+	ocean_assert(GL_NO_ERROR == glGetError());
+
+	if (waitResult != GL_ALREADY_SIGNALED && waitResult != GL_CONDITION_SATISFIED)
+	{
+		return false;
+	}
+
+	glDeleteSync(readbackFences_[bufferIndex]);
+	ocean_assert(GL_NO_ERROR == glGetError());
+	readbackFences_[bufferIndex] = nullptr;
+
+	readbackIndex_ = (readbackIndex_ + 1) % numberReadbackBuffers_;
+	--numberPendingReadbacks_;
+
+	const FrameType& frameType = readbackFrameTypes_[bufferIndex];
+	ocean_assert(frameType.isValid());
+
+	const size_t rowBytes = size_t(frameType.width()) * size_t(FrameType::planeBytesPerPixel(frameType.pixelFormat(), 0u));
+	const size_t alignedRowBytes = (rowBytes + 3) / 4 * 4;
+	const size_t bufferSize = alignedRowBytes * size_t(frameType.height());
+
+	ocean_assert(bufferSize <= readbackBufferSizes_[bufferIndex]);
+
+	ocean_assert((alignedRowBytes - rowBytes) % size_t(frameType.bytesPerDataType()) == 0);
+	const unsigned int paddingElements = (unsigned int)((alignedRowBytes - rowBytes) / size_t(frameType.bytesPerDataType()));
+
+	if (!frame.set(frameType, false /*forceOwner*/, true /*forceWritable*/))
+	{
+		return false;
+	}
+
+	glBindBuffer(GL_PIXEL_PACK_BUFFER, readbackBufferIds_[bufferIndex]);
+	ocean_assert(GL_NO_ERROR == glGetError());
+
+	const void* bufferData = glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, GLsizeiptr(bufferSize), GL_MAP_READ_BIT);
+	ocean_assert(GL_NO_ERROR == glGetError());
+
+	bool result = false;
+
+	if (bufferData != nullptr)
+	{
+		const Frame bufferFrame(frameType, bufferData, Frame::CM_USE_KEEP_LAYOUT, paddingElements);
+
+		result = frame.copy(0, 0, bufferFrame);
+
+		// the content of the buffer may have been corrupted (e.g., due to a display mode change)
+
+		if (glUnmapBuffer(GL_PIXEL_PACK_BUFFER) == GL_FALSE)
+		{
+			result = false;
+		}
+
+		ocean_assert(GL_NO_ERROR == glGetError());
+	}
+
+	glBindBuffer(GL_PIXEL_PACK_BUFFER, 0u);
+	ocean_assert(GL_NO_ERROR == glGetError());
+
+	return result;
+}
+
 bool GLESTextureFramebuffer::isValid() const
 {
 	return framebufferObjectId_ != 0u;
@@ -1126,6 +1277,28 @@ void GLESTextureFramebuffer::release()
 		ocean_assert(glGetError() == GL_NO_ERROR);
 	}
 
+	for (size_t n = 0; n < numberReadbackBuffers_; ++n)
+	{
+		if (readbackFences_[n] != nullptr)
+		{
+			glDeleteSync(readbackFences_[n]);
+			ocean_assert(glGetError() == GL_NO_ERROR);
+			readbackFences_[n] = nullptr;
+		}
+
+		if (readbackBufferIds_[n] != 0u)
+		{
+			glDeleteBuffers(1, &readbackBufferIds_[n]);
+			ocean_assert(glGetError() == GL_NO_ERROR);
+			readbackBufferIds_[n] = 0u;
+		}
+
+		readbackBufferSizes_[n] = 0;
+	}
+
+	readbackIndex_ = 0;
+	numberPendingReadbacks_ = 0;
+
 	if (framebufferObjectId_ != 0u)
 	{
 		ocean_assert(glGetError() == GL_NO_ERROR);
@@ -1162,6 +1335,65 @@ void GLESTextureFramebuffer::createMipmap()
 	}
 }
 
+bool GLESTextureFramebuffer::determineReadFormat(GLenum& textureFormat, GLenum& textureType)
+{
+	textureFormat = GL_RGB;
+	textureType = GL_UNSIGNED_BYTE;
+
+	switch (pixelFormat_)
+	{
+		case FrameType::FORMAT_RGB24:
+			break;
+
+		case FrameType::FORMAT_RGBA32:
+			textureFormat = GL_RGBA;
+			break;
+
+		case FrameType::FORMAT_Y8:
+			textureFormat = GL_RED;
+			break;
+
+		case FrameType::FORMAT_YA16:
+			textureFormat = GL_RG;
+			break;
+
+		case FrameType::FORMAT_Y32:
+			textureFormat = GL_RED_INTEGER;
+			textureType = GL_UNSIGNED_INT;
+			break;
+
+		case FrameType::FORMAT_F32:
+		{
+#ifdef OCEAN_RENDERING_GLES_USE_ES
+			if (majorVersion_ == 0)
+			{
+				glGetIntegerv(GL_MAJOR_VERSION, &majorVersion_);
+				ocean_assert(GL_NO_ERROR == glGetError());
+			}
+
+			if (majorVersion_ <= 2)
+			{
+				ocean_assert(false && "OpenGLES 2.0 does not support to read float framebuffers, use the Y32 workaround instead");
+				return false;
+			}
+
+			textureFormat = GL_RED;
+			textureType = GL_FLOAT;
+#else
+			textureFormat = GL_RED;
+			textureType = GL_FLOAT;
+#endif
+			break;
+		}
+
+		default:
+			ocean_assert(false && "This must never happen!");
+			return false;
+	}
+
+	return true;
+}
+
 }
 
 }
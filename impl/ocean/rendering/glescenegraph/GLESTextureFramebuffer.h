@@ -146,6 +146,43 @@ class OCEAN_RENDERING_GLES_EXPORT GLESTextureFramebuffer :
 		 */
 		bool copyDepthTextureToFrame(Frame& frame, const CV::PixelBoundingBox& subRegion = CV::PixelBoundingBox()) override;
 
+		/**
+		 * Starts an asynchronous copy of the image content of the color texture into a pixel pack buffer.
+		 * The function does not wait for the GPU, the copied image content can be accessed with finishColorTextureReadback() once the GPU has executed the copy, which is usually the case one or two frames later.<br>
+		 * Up to numberReadbackBuffers_ copies can be pending at the same time, the copies are finished in the same order in which they have been started.
+		 * @param subRegion Optional sub-region within the framebuffer to copy; an invalid bounding box to copy the entire framebuffer
+		 * @return True, if succeeded; False, if all pixel pack buffers are still pending, or if the framebuffer applies multi-samples
+		 * @see finishColorTextureReadback(), copyColorTextureToFrame().
+		 */
+		bool startColorTextureReadback(const CV::PixelBoundingBox& subRegion = CV::PixelBoundingBox());
+
+		/**
+		 * Finishes the oldest pending asynchronous copy of the color texture if the GPU has executed the copy already, the function does not wait for the GPU.
+		 * @param frame The frame receiving the copied image content, the frame will be adjusted if the frame type does not match
+		 * @return True, if the oldest copy has been finished; False, if no copy is pending, or if the GPU has not yet executed the oldest copy
+		 * @see startColorTextureReadback().
+		 */
+		bool finishColorTextureReadback(Frame& frame);
+
+		/**
+		 * Returns the number of asynchronous copies of the color texture which have been started but not yet finished.
+		 * @return The number of pending copies, with range [0, numberReadbackBuffers_]
+		 */
+		inline size_t pendingColorTextureReadbacks() const;
+
+		/**
+		 * Returns the number of multi-samples the framebuffer applies.
+		 * @return The number of multi-samples, with range [1, infinity)
+		 */
+		inline unsigned int multisamples() const;
+
+		/**
+		 * Returns the id of the framebuffer object.
+		 * The framebuffer object can be used as read framebuffer e.g., to blit the content into another framebuffer without a copy to memory.
+		 * @return The OpenGL id of the framebuffer object, 0 if not yet created
+		 */
+		inline GLuint framebufferObjectId() const;
+
 		/**
 		 * Returns the id of the color texture.
 		 * @return The OpenGL id of the color texture of this framebuffer.
@@ -164,6 +201,11 @@ class OCEAN_RENDERING_GLES_EXPORT GLESTextureFramebuffer :
 		 */
 		bool isValid() const override;
 
+	public:
+
+		/// The number of pixel pack buffers which are used in a round-robin manner for asynchronous copies of the color texture.
+		static constexpr size_t numberReadbackBuffers_ = 3;
+
 	protected:
 
 		/**
@@ -187,6 +229,14 @@ class OCEAN_RENDERING_GLES_EXPORT GLESTextureFramebuffer :
 		 */
 		void createMipmap() override;
 
+		/**
+		 * Determines the format and type to be used when reading the color texture with glReadPixels().
+		 * @param textureFormat The resulting texture format
+		 * @param textureType The resulting texture type
+		 * @return True, if the pixel format of this framebuffer can be read
+		 */
+		bool determineReadFormat(GLenum& textureFormat, GLenum& textureType);
+
 #ifdef OCEAN_PLATFORM_BUILD_APPLE_IOS_ANY
 
 		/**
@@ -246,6 +296,24 @@ class OCEAN_RENDERING_GLES_EXPORT GLESTextureFramebuffer :
 		/// The name of the texture in the shader.
 		std::string textureName_ = std::string("primaryTexture");
 
+		/// The ids of the pixel pack buffers for asynchronous copies of the color texture, 0 if a buffer has not been created yet.
+		GLuint readbackBufferIds_[numberReadbackBuffers_] = {0u, 0u, 0u};
+
+		/// The sizes of the pixel pack buffers, in bytes.
+		size_t readbackBufferSizes_[numberReadbackBuffers_] = {0, 0, 0};
+
+		/// The fences signaling that the GPU has executed the copies into the individual pixel pack buffers, nullptr if a buffer is not pending.
+		GLsync readbackFences_[numberReadbackBuffers_] = {nullptr, nullptr, nullptr};
+
+		/// The frame types of the copies in the individual pixel pack buffers.
+		FrameType readbackFrameTypes_[numberReadbackBuffers_];
+
+		/// The index of the pixel pack buffer holding the oldest pending copy, with range [0, numberReadbackBuffers_ - 1].
+		size_t readbackIndex_ = 0;
+
+		/// The number of pending copies, with range [0, numberReadbackBuffers_].
+		size_t numberPendingReadbacks_ = 0;
+
 #ifdef OCEAN_PLATFORM_BUILD_APPLE_IOS_ANY
 
 		/// The texture cache on iOS platforms, if supported.
@@ -280,6 +348,21 @@ inline unsigned int GLESTextureFramebuffer::height() const
 	return height_;
 }
 
+inline size_t GLESTextureFramebuffer::pendingColorTextureReadbacks() const
+{
+	return numberPendingReadbacks_;
+}
+
+inline unsigned int GLESTextureFramebuffer::multisamples() const
+{
+	return framebufferMultisamples_;
+}
+
+inline GLuint GLESTextureFramebuffer::framebufferObjectId() const
+{
+	return framebufferObjectId_;
+}
+
 inline GLuint GLESTextureFramebuffer::colorTextureId() const
 {
 	return colorTextureId_;
@@ -36,24 +36,33 @@ BoundingBox GLESTransform::boundingBox(const bool involveLocalTransformation) co
 {
 	const ScopedLock scopedLock(objectLock);
 
-	BoundingBox result;
+	bool bounded = false;
+	const BoundingBox result = cachedBoundingBox(bounded);
 
-	for (const NodeRef& groupNode : groupNodes)
+	if (involveLocalTransformation && result.isValid())
 	{
-		ocean_assert(groupNode);
-		const BoundingBox groupBoundingBox = groupNode->boundingBox(true /*involveLocalTransformation*/);
+		return result * parent_T_object_;
+	}
 
-		if (groupBoundingBox.isValid())
-		{
-			if (involveLocalTransformation)
-			{
-				result += groupBoundingBox * parent_T_object_;
-			}
-			else
-			{
-				result += groupBoundingBox;
-			}
-		}
+	return result;
+}
+
+BoundingBox GLESTransform::parentBoundingBox(bool& bounded) const
+{
+	const ScopedLock scopedLock(objectLock);
+
+	const BoundingBox result = cachedBoundingBox(bounded);
+
+	if (transformModifier_)
+	{
+		// the transform modifier can change the transformation with each frame
+
+		bounded = false;
+	}
+
+	if (result.isValid())
+	{
+		return result * parent_T_object_;
 	}
 
 	return result;
@@ -75,14 +84,27 @@ GLESTransform::SharedTransformModifier GLESTransform::transformModifier() const
 
 void GLESTransform::setTransformation(const HomogenousMatrix4& parent_T_transform)
 {
-	const ScopedLock scopedLock(objectLock);
+	{
+		const ScopedLock scopedLock(objectLock);
+
+		if (parent_T_object_ == parent_T_transform)
+		{
+			return;
+		}
 
-	parent_T_object_ = parent_T_transform;
+		parent_T_object_ = parent_T_transform;
+	}
+
+	// the bounding box of this node does not involve the local transformation, while the bounding boxes of all parent nodes do
+
+	invalidateParentBoundingBoxes(*this);
 }
 
 void GLESTransform::setTransformModifier(SharedTransformModifier transformModifier)
 {
 	transformModifier_ = std::move(transformModifier);
+
+	invalidateParentBoundingBoxes(*this);
 }
 
 void GLESTransform::addToTraverser(const GLESFramebuffer& framebuffer, const SquareMatrix4& projectionMatrix, const HomogenousMatrix4& camera_T_parent, const Lights& lights, GLESTraverser& traverser) const
@@ -96,6 +118,11 @@ void GLESTransform::addToTraverser(const GLESFramebuffer& framebuffer, const Squ
 
 	const HomogenousMatrix4 camera_T_object = transformModifier_ ? (camera_T_parent * parent_T_object_ * transformModifier_->transformation()) : (camera_T_parent * parent_T_object_);
 
+	if (isCulled(camera_T_object, traverser))
+	{
+		return;
+	}
+
 	if (groupLights.empty())
 	{
 		for (Nodes::const_iterator i = groupNodes.begin(); i != groupNodes.end(); ++i)
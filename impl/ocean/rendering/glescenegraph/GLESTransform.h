@@ -40,6 +40,13 @@ class OCEAN_RENDERING_GLES_EXPORT GLESTransform :
 		 */
 		BoundingBox boundingBox(const bool involveLocalTransformation) const override;
 
+		/**
+		 * Returns the bounding box of this node in the coordinate system of the parent node.
+		 * The bounding box is not bounded if the transformation is modified by a transform modifier.
+		 * @see GLESNode::parentBoundingBox().
+		 */
+		BoundingBox parentBoundingBox(bool& bounded) const override;
+
 		/**
 		 * Returns the transformation of this node relative to the parent node.
 		 * @see Transform::transformation().
@@ -8,6 +8,8 @@
 #include "ocean/rendering/glescenegraph/GLESTraverser.h"
 #include "ocean/rendering/glescenegraph/GLESAttributeSet.h"
 
+#include "ocean/rendering/Primitive.h"
+
 namespace Ocean
 {
 
@@ -19,29 +21,43 @@ namespace GLESceneGraph
 
 void GLESTraverser::render(const GLESFramebuffer& framebuffer, const SquareMatrix4& projection, const HomogenousMatrix4& camera_T_world)
 {
-	// first, we render all objects which apply a special depth handling
+	// the most recently used program may have been changed outside of the traverser
 
-	for (const TraverserObject& traverserObject : depthTraverserObjects_)
+	GLESShaderProgram::invalidateCurrentProgram();
+
+	statistics_ = Statistics();
+	previousRenderState_ = RenderState();
+
+	// the nodes have been culled while they were added to this traverser
+
+	statistics_.frustumCulledNodes_ = frustumCulledNodes_;
+	statistics_.smallFeatureCulledNodes_ = smallFeatureCulledNodes_;
+
+	for (TraverserObjects* traverserObjects : {&depthTraverserObjects_, &defaultTraverserObjects_, &blendTraverserObjects_})
 	{
-		traverserObject.render(framebuffer, projection, camera_T_world);
+		for (TraverserObject& traverserObject : *traverserObjects)
+		{
+			traverserObject.updateRenderState();
+		}
 	}
 
+	// first, we render all objects which apply a special depth handling
+
+	render(depthTraverserObjects_, framebuffer, projection, camera_T_world);
+
 	// now, we render all default objects
+	// sorting objects based on their render state, so that consecutive objects share as much state as possible
 
-	for (const TraverserObject& traverserObject : defaultTraverserObjects_)
-	{
-		traverserObject.render(framebuffer, projection, camera_T_world);
-	}
+	std::sort(defaultTraverserObjects_.begin(), defaultTraverserObjects_.end(), TraverserObject::compareRenderState);
+
+	render(defaultTraverserObjects_, framebuffer, projection, camera_T_world);
 
 	// finally, we render all transparent objects
 	// sorting objets based on their distance to camera, renderables with largest distance first
 
 	std::sort(blendTraverserObjects_.rbegin(), blendTraverserObjects_.rend(), TraverserObject::compareDistance);
 
-	for (const TraverserObject& traverserObject : blendTraverserObjects_)
-	{
-		traverserObject.render(framebuffer, projection, camera_T_world);
-	}
+	render(blendTraverserObjects_, framebuffer, projection, camera_T_world);
 }
 
 void GLESTraverser::renderColorIds(const Engine& engine, const SquareMatrix4& projection, const HomogenousMatrix4& camera_T_world)
@@ -60,6 +76,8 @@ void GLESTraverser::renderColorIds(const Engine& engine, const SquareMatrix4& pr
 	glUseProgram(shaderProgramColorId_->id());
 	ocean_assert(GL_NO_ERROR == glGetError());
 
+	GLESShaderProgram::invalidateCurrentProgram();
+
 	const GLint colorIdLocation = glGetUniformLocation(shaderProgramColorId_->id(), "colorId");
 	ocean_assert(colorIdLocation != -1);
 
@@ -161,11 +179,209 @@ RenderableRef GLESTraverser::renderableFromColorId(const uint32_t colorId) const
 	return blendTraverserObjects_[adjustedColorId].renderable();
 }
 
+void GLESTraverser::enableCulling(const SquareMatrix4& projectionMatrix, const unsigned int viewportHeight, const Scalar minimalFeatureSize)
+{
+	ocean_assert(viewportHeight >= 1u);
+	ocean_assert(minimalFeatureSize >= 0);
+
+	cullingFrustum_ = Frustum(projectionMatrix);
+
+	// the projected size of an object with extent s at depth d is s * projectionMatrix(1, 1) * viewportHeight / (2 * d)
+
+	cullingPixelScale_ = projectionMatrix(1, 1) * Scalar(viewportHeight) * Scalar(0.5);
+	minimalFeatureSize_ = minimalFeatureSize;
+
+	secondaryCullingFrustum_ = Frustum();
+}
+
+void GLESTraverser::enableCulling(const SquareMatrix4& projectionMatrix, const SquareMatrix4& secondaryClip_T_camera, const unsigned int viewportHeight, const Scalar minimalFeatureSize)
+{
+	enableCulling(projectionMatrix, viewportHeight, minimalFeatureSize);
+
+	// the planes of the secondary frustum are extracted from the combined matrix and are therefore defined in the coordinate system of the primary view
+
+	secondaryCullingFrustum_ = Frustum(secondaryClip_T_camera);
+}
+
+bool GLESTraverser::isCulled(const BoundingBox& boundingBox, const HomogenousMatrix4& camera_T_object)
+{
+	ocean_assert(camera_T_object.isValid());
+
+	if (!cullingFrustum_.isValid() || !boundingBox.isValid())
+	{
+		return false;
+	}
+
+	const BoundingBox cameraBoundingBox(boundingBox * camera_T_object);
+
+	if (!cullingFrustum_.hasIntersection(cameraBoundingBox) && (!secondaryCullingFrustum_.isValid() || !secondaryCullingFrustum_.hasIntersection(cameraBoundingBox)))
+	{
+		++frustumCulledNodes_;
+		return true;
+	}
+
+	if (minimalFeatureSize_ > 0)
+	{
+		const Scalar depth = -cameraBoundingBox.center().z();
+		const Scalar radius = cameraBoundingBox.diagonal() * Scalar(0.5);
+
+		// nodes close to the camera are never small
+
+		if (depth > radius && radius * Scalar(2) * cullingPixelScale_ < minimalFeatureSize_ * depth)
+		{
+			++smallFeatureCulledNodes_;
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void GLESTraverser::updateCamera(const HomogenousMatrix4& newCamera_T_camera, const LightSourceRef& headlight)
+{
+	ocean_assert(newCamera_T_camera.isValid());
+
+	// the normal matrix is the transposed inverse of the model view matrix, and the correction is a rigid transformation
+
+	const SquareMatrix3 newCamera_R_camera(newCamera_T_camera.rotationMatrix());
+
+	for (TraverserObjects* traverserObjects : {&depthTraverserObjects_, &defaultTraverserObjects_, &blendTraverserObjects_})
+	{
+		for (TraverserObject& traverserObject : *traverserObjects)
+		{
+			traverserObject.updateCamera(newCamera_T_camera, newCamera_R_camera, headlight);
+		}
+	}
+}
+
 void GLESTraverser::clear()
 {
 	depthTraverserObjects_.clear();
 	defaultTraverserObjects_.clear();
 	blendTraverserObjects_.clear();
+
+	cullingFrustum_ = Frustum();
+	secondaryCullingFrustum_ = Frustum();
+	frustumCulledNodes_ = 0u;
+	smallFeatureCulledNodes_ = 0u;
+}
+
+void GLESTraverser::render(const TraverserObjects& traverserObjects, const GLESFramebuffer& framebuffer, const SquareMatrix4& projection, const HomogenousMatrix4& camera_T_world)
+{
+	size_t index = 0;
+
+	while (index < traverserObjects.size())
+	{
+		const TraverserObject& traverserObject = traverserObjects[index];
+
+		size_t endIndex = index + 1;
+
+		while (endIndex < traverserObjects.size() && traverserObjects[endIndex].isInstanceOf(traverserObject))
+		{
+			++endIndex;
+		}
+
+		const RenderState& renderState = traverserObject.renderState();
+
+		if (renderState.program_ != previousRenderState_.program_)
+		{
+			++statistics_.programChanges_;
+		}
+
+		if (renderState.textures_ != previousRenderState_.textures_)
+		{
+			++statistics_.textureChanges_;
+		}
+
+		if (renderState.material_ != previousRenderState_.material_)
+		{
+			++statistics_.materialChanges_;
+		}
+
+		if (renderState.vertexSet_ != previousRenderState_.vertexSet_)
+		{
+			++statistics_.vertexSetChanges_;
+		}
+
+		previousRenderState_ = renderState;
+
+		const size_t numberInstances = endIndex - index;
+
+		if (numberInstances >= 2 && TraverserObject::renderInstanced(traverserObjects.data() + index, numberInstances, framebuffer, projection, camera_T_world, camera_T_instances_, normalMatrices_))
+		{
+			++statistics_.drawCalls_;
+			statistics_.instances_ += (unsigned int)(numberInstances);
+		}
+		else
+		{
+			// all objects share the same state, so that only the first object counts as state change
+
+			for (size_t n = index; n < endIndex; ++n)
+			{
+				traverserObjects[n].render(framebuffer, projection, camera_T_world);
+			}
+
+			statistics_.drawCalls_ += (unsigned int)(numberInstances);
+		}
+
+		index = endIndex;
+	}
+}
+
+bool GLESTraverser::TraverserObject::renderInstanced(const TraverserObject* traverserObjects, const size_t size, const GLESFramebuffer& framebuffer, const SquareMatrix4& projection, const HomogenousMatrix4& camera_T_world, HomogenousMatrices4& camera_T_instances, SquareMatrices3& normalMatrices)
+{
+	ocean_assert(traverserObjects != nullptr && size >= 1);
+	ocean_assert(!projection.isSingular());
+
+	const TraverserObject& firstObject = traverserObjects[0];
+	ocean_assert(firstObject.renderable_ && firstObject.attributeSet_);
+
+	camera_T_instances.clear();
+	normalMatrices.clear();
+
+	for (size_t n = 0; n < size; ++n)
+	{
+		ocean_assert(traverserObjects[n].isInstanceOf(firstObject));
+
+		camera_T_instances.emplace_back(traverserObjects[n].camera_T_renderable_);
+		normalMatrices.emplace_back(traverserObjects[n].normalMatrix_);
+	}
+
+	return firstObject.renderable_->renderInstanced(framebuffer, projection, camera_T_instances, camera_T_world, normalMatrices, *firstObject.attributeSet_, firstObject.lights_);
+}
+
+void GLESTraverser::TraverserObject::updateRenderState()
+{
+	ocean_assert(renderable_ && attributeSet_);
+
+	renderState_.program_ = attributeSet_->shaderProgram().pointer();
+	renderState_.textures_ = attributeSet_->attribute(Object::TYPE_TEXTURES).pointer();
+	renderState_.material_ = attributeSet_->attribute(Object::TYPE_MATERIAL).pointer();
+
+	const Primitive* primitive = dynamic_cast<const Primitive*>(renderable_.pointer());
+
+	if (primitive != nullptr && primitive->vertexSet())
+	{
+		renderState_.vertexSet_ = primitive->vertexSet().pointer();
+	}
+	else
+	{
+		renderState_.vertexSet_ = renderable_.pointer();
+	}
+}
+
+void GLESTraverser::TraverserObject::updateCamera(const HomogenousMatrix4& newCamera_T_camera, const SquareMatrix3& newCamera_R_camera, const LightSourceRef& headlight)
+{
+	camera_T_renderable_ = newCamera_T_camera * camera_T_renderable_;
+	normalMatrix_ = newCamera_R_camera * normalMatrix_;
+
+	for (LightPair& lightPair : lights_)
+	{
+		if (lightPair.first != headlight)
+		{
+			lightPair.second = newCamera_T_camera * lightPair.second;
+		}
+	}
 }
 
 }
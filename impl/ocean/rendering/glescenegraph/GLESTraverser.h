@@ -18,6 +18,8 @@
 #include "ocean/rendering/Engine.h"
 #include "ocean/rendering/Node.h"
 
+#include "ocean/math/BoundingBox.h"
+#include "ocean/math/Frustum.h"
 #include "ocean/math/HomogenousMatrix4.h"
 #include "ocean/math/SquareMatrix4.h"
 
@@ -37,8 +39,80 @@ namespace GLESceneGraph
  */
 class OCEAN_RENDERING_GLES_EXPORT GLESTraverser
 {
+	public:
+
+		/**
+		 * This class holds the statistics of the most recent render call.
+		 * A state change is counted whenever a draw call uses a different program, textures, material, or vertex set than the draw call before.
+		 */
+		class Statistics
+		{
+			public:
+
+				/**
+				 * Returns the overall number of state changes.
+				 * @return The sum of all state changes
+				 */
+				inline unsigned int stateChanges() const;
+
+			public:
+
+				/// The number of draw calls, one for each individually rendered renderable and one for each group of instances.
+				unsigned int drawCalls_ = 0u;
+
+				/// The number of renderables which have been rendered as instances within an instanced draw call.
+				unsigned int instances_ = 0u;
+
+				/// The number of shader program changes.
+				unsigned int programChanges_ = 0u;
+
+				/// The number of texture changes.
+				unsigned int textureChanges_ = 0u;
+
+				/// The number of material changes.
+				unsigned int materialChanges_ = 0u;
+
+				/// The number of vertex set changes.
+				unsigned int vertexSetChanges_ = 0u;
+
+				/// The number of nodes and instances which have been skipped because they were entirely outside of the viewing frustum.
+				unsigned int frustumCulledNodes_ = 0u;
+
+				/// The number of nodes and instances which have been skipped because their projection was smaller than the minimal feature size.
+				unsigned int smallFeatureCulledNodes_ = 0u;
+		};
+
 	protected:
 
+		/**
+		 * This class holds the render state of a renderable, the objects are used as identifiers only.
+		 */
+		class RenderState
+		{
+			public:
+
+				/**
+				 * Returns whether the left render state is smaller than the right render state, the program has the highest priority.
+				 * @param right The right render state to compare
+				 * @return True, if so
+				 */
+				inline bool operator<(const RenderState& right) const;
+
+			public:
+
+				/// The shader program of the renderable, nullptr if not yet determined.
+				const void* program_ = nullptr;
+
+				/// The textures of the renderable, nullptr if the renderable does not have textures.
+				const void* textures_ = nullptr;
+
+				/// The material of the renderable, nullptr if the renderable does not have a material.
+				const void* material_ = nullptr;
+
+				/// The vertex set of the renderable, the renderable itself if the renderable is not a primitive.
+				const void* vertexSet_ = nullptr;
+		};
+
 		/**
 		 * This class stores the data which is necessary to render one renderable.
 		 */
@@ -72,12 +146,64 @@ class OCEAN_RENDERING_GLES_EXPORT GLESTraverser
 				 */
 				inline void render(const SquareMatrix4& projection, const HomogenousMatrix4& camera_T_world, GLESShaderProgram& shaderProgram) const;
 
+				/**
+				 * Returns whether this traverser object and a second traverser object can be rendered as instances of one draw call.
+				 * Both objects need to share the renderable, the attribute set, and the lights.
+				 * @param traverserObject The second traverser object
+				 * @return True, if so
+				 */
+				inline bool isInstanceOf(const TraverserObject& traverserObject) const;
+
+				/**
+				 * Renders several traverser objects as instances with one draw call.
+				 * @param traverserObjects The traverser objects to render, all objects must be instances of the first object, must be valid
+				 * @param size The number of traverser objects, with range [1, infinity)
+				 * @param framebuffer The framebuffer in which the objects are rendered
+				 * @param projection The projection matrix to be used, must be valid
+				 * @param camera_T_world The transformation between world and camera, must be valid
+				 * @param camera_T_instances Reusable memory for the transformations of the instances
+				 * @param normalMatrices Reusable memory for the normal matrices of the instances
+				 * @return True, if the objects have been rendered; False, if the objects do not support instancing
+				 * @see isInstanceOf().
+				 */
+				static bool renderInstanced(const TraverserObject* traverserObjects, const size_t size, const GLESFramebuffer& framebuffer, const SquareMatrix4& projection, const HomogenousMatrix4& camera_T_world, HomogenousMatrices4& camera_T_instances, SquareMatrices3& normalMatrices);
+
 				/**
 				 * Returns the renderable of this traverser object.
 				 * @return The object's renderable
 				 */
 				inline const SmartObjectRef<GLESRenderable>& renderable() const;
 
+				/**
+				 * Returns the render state of this traverser object.
+				 * @return The object's render state
+				 * @see updateRenderState().
+				 */
+				inline const RenderState& renderState() const;
+
+				/**
+				 * Updates the render state of this traverser object.
+				 * The shader program of an attribute set is determined when the attribute set is bound the first time, so that the state needs to be updated right before sorting.
+				 */
+				void updateRenderState();
+
+				/**
+				 * Moves this traverser object into the coordinate system of a new camera, e.g., after the camera pose has been latched right before rendering.
+				 * @param newCamera_T_camera The transformation between the previous and the new camera, must be valid
+				 * @param newCamera_R_camera The rotation between the previous and the new camera, must be the rotation of the given transformation
+				 * @param headlight The headlight of the view which is attached to the camera and thus is not moved, can be invalid
+				 */
+				void updateCamera(const HomogenousMatrix4& newCamera_T_camera, const SquareMatrix3& newCamera_R_camera, const LightSourceRef& headlight);
+
+				/**
+				 * Returns whether the render state of the left object is smaller than the render state of the right object.
+				 * Objects with identical render state are ordered by renderable and attribute set, so that instances of the same renderable are neighbors.
+				 * @param left The left traverser object to compare
+				 * @param right The right traverser object to compare
+				 * @return True, if so
+				 */
+				static inline bool compareRenderState(const TraverserObject& left, const TraverserObject& right);
+
 				/**
 				 * Returns whether the distance of the left object is closer to the camera than the right object.
 				 * @param left The left traverser object to compare
@@ -102,6 +228,9 @@ class OCEAN_RENDERING_GLES_EXPORT GLESTraverser
 
 				/// The lights used the render this renderable.
 				Lights lights_;
+
+				/// The render state of the renderable.
+				RenderState renderState_;
 		};
 
 		/**
@@ -151,10 +280,73 @@ class OCEAN_RENDERING_GLES_EXPORT GLESTraverser
 		RenderableRef renderableFromColorId(const uint32_t colorId) const;
 
 		/**
-		 * Removes all gathered renderables from this traverser.
+		 * Enables the culling of nodes which are not visible from the camera, for all nodes which are added until the next call of clear().
+		 * Nodes are culled if their bounding box is entirely outside of the viewing frustum, or if the projected size of their bounding box is smaller than a minimal feature size.
+		 * @param projectionMatrix The projection matrix of the camera, must be valid
+		 * @param viewportHeight The height of the viewport, in pixel, with range [1, infinity)
+		 * @param minimalFeatureSize The minimal projected size of a node, in pixel, 0 to disable small feature culling, with range [0, infinity)
+		 * @see isCulled().
+		 */
+		void enableCulling(const SquareMatrix4& projectionMatrix, const unsigned int viewportHeight, const Scalar minimalFeatureSize = Scalar(0));
+
+		/**
+		 * Enables the culling of nodes which are not visible from both views of a stereo camera rendering both views in one pass, for all nodes which are added until the next call of clear().
+		 * Nodes are culled if their bounding box is entirely outside of both viewing frustums, or if the projected size of their bounding box in the primary view is smaller than a minimal feature size.
+		 * @param projectionMatrix The projection matrix of the primary view, in which the nodes are traversed, must be valid
+		 * @param secondaryClip_T_camera The transformation between the primary view and the clip space of the secondary view, which is the projection matrix of the secondary view multiplied with the transformation between the primary and the secondary view, must be valid
+		 * @param viewportHeight The height of the viewport, in pixel, with range [1, infinity)
+		 * @param minimalFeatureSize The minimal projected size of a node, in pixel, 0 to disable small feature culling, with range [0, infinity)
+		 * @see isCulled().
+		 */
+		void enableCulling(const SquareMatrix4& projectionMatrix, const SquareMatrix4& secondaryClip_T_camera, const unsigned int viewportHeight, const Scalar minimalFeatureSize = Scalar(0));
+
+		/**
+		 * Returns whether the culling of nodes is enabled.
+		 * @return True, if so
+		 * @see enableCulling().
+		 */
+		inline bool isCullingEnabled() const;
+
+		/**
+		 * Returns whether a node can be skipped as it is not visible from the camera, the statistics are updated for each culled node.
+		 * @param boundingBox The bounding box of the node, defined in the coordinate system of the node, an invalid box is never culled
+		 * @param camera_T_object The transformation between the node and the camera, must be valid
+		 * @return True, if the node is entirely outside of the viewing frustum or smaller than the minimal feature size; False, if the node needs to be added
+		 */
+		bool isCulled(const BoundingBox& boundingBox, const HomogenousMatrix4& camera_T_object);
+
+		/**
+		 * Moves all gathered renderables into the coordinate system of a new camera, without traversing the scene again.
+		 * This function allows to latch the camera pose right before rendering while the scene has been traversed with a slightly older camera pose already.<br>
+		 * The nodes are not culled again, the difference between both cameras is expected to be small.
+		 * @param newCamera_T_camera The transformation between the camera used for gathering the renderables and the new camera, must be valid
+		 * @param headlight The headlight of the view which is attached to the camera and thus is not moved, can be invalid
+		 */
+		void updateCamera(const HomogenousMatrix4& newCamera_T_camera, const LightSourceRef& headlight);
+
+		/**
+		 * Removes all gathered renderables from this traverser and disables culling.
 		 */
 		void clear();
 
+		/**
+		 * Returns the statistics of the most recent render call.
+		 * @return The traverser's statistics
+		 */
+		inline const Statistics& statistics() const;
+
+	protected:
+
+		/**
+		 * Renders traverser objects and updates the statistics.
+		 * Neighboring objects which are instances of the same renderable are rendered with one instanced draw call, if supported.
+		 * @param traverserObjects The traverser objects to render
+		 * @param framebuffer The framebuffer in which the objects are rendered
+		 * @param projection The projection matrix to be used, must be valid
+		 * @param camera_T_world The transformation between world and camera, must be valid
+		 */
+		void render(const TraverserObjects& traverserObjects, const GLESFramebuffer& framebuffer, const SquareMatrix4& projection, const HomogenousMatrix4& camera_T_world);
+
 	protected:
 
 		/// The renderable object with depth attribute.
@@ -168,8 +360,63 @@ class OCEAN_RENDERING_GLES_EXPORT GLESTraverser
 
 		/// The shader able to render objects with individual color ids.
 		GLESShaderProgramRef shaderProgramColorId_;
+
+		/// The statistics of the most recent render call.
+		Statistics statistics_;
+
+		/// The render state of the most recently rendered object, used to count state changes.
+		RenderState previousRenderState_;
+
+		/// Reusable memory for the transformations of instances.
+		HomogenousMatrices4 camera_T_instances_;
+
+		/// Reusable memory for the normal matrices of instances.
+		SquareMatrices3 normalMatrices_;
+
+		/// The viewing frustum in the coordinate system of the camera, invalid if culling is disabled.
+		Frustum cullingFrustum_;
+
+		/// The viewing frustum of the secondary view in the coordinate system of the camera, invalid if the nodes are traversed for one view only.
+		Frustum secondaryCullingFrustum_;
+
+		/// The vertical scale factor of the projection, in pixel, used to determine the projected size of nodes.
+		Scalar cullingPixelScale_ = Scalar(0);
+
+		/// The minimal projected size of nodes, in pixel, 0 if small feature culling is disabled.
+		Scalar minimalFeatureSize_ = Scalar(0);
+
+		/// The number of nodes which have been culled because they were outside of the viewing frustum since the last call of clear().
+		unsigned int frustumCulledNodes_ = 0u;
+
+		/// The number of nodes which have been culled because they were smaller than the minimal feature size since the last call of clear().
+		unsigned int smallFeatureCulledNodes_ = 0u;
 };
 
+inline unsigned int GLESTraverser::Statistics::stateChanges() const
+{
+	return programChanges_ + textureChanges_ + materialChanges_ + vertexSetChanges_;
+}
+
+inline bool GLESTraverser::RenderState::operator<(const RenderState& right) const
+{
+	if (program_ != right.program_)
+	{
+		return std::less<const void*>()(program_, right.program_);
+	}
+
+	if (textures_ != right.textures_)
+	{
+		return std::less<const void*>()(textures_, right.textures_);
+	}
+
+	if (material_ != right.material_)
+	{
+		return std::less<const void*>()(material_, right.material_);
+	}
+
+	return std::less<const void*>()(vertexSet_, right.vertexSet_);
+}
+
 inline GLESTraverser::TraverserObject::TraverserObject(const RenderableRef& renderable, const AttributeSetRef& attributeSet, const HomogenousMatrix4& camera_T_renderable, const SquareMatrix3& normalMatrix, const Lights& lights) :
 	renderable_(renderable),
 	attributeSet_(attributeSet),
@@ -201,11 +448,51 @@ inline const SmartObjectRef<GLESRenderable>& GLESTraverser::TraverserObject::ren
 	return renderable_;
 }
 
+inline const GLESTraverser::RenderState& GLESTraverser::TraverserObject::renderState() const
+{
+	return renderState_;
+}
+
+inline bool GLESTraverser::TraverserObject::isInstanceOf(const TraverserObject& traverserObject) const
+{
+	return renderable_ == traverserObject.renderable_ && attributeSet_ == traverserObject.attributeSet_ && lights_ == traverserObject.lights_;
+}
+
+inline bool GLESTraverser::TraverserObject::compareRenderState(const TraverserObject& left, const TraverserObject& right)
+{
+	if (left.renderState_ < right.renderState_)
+	{
+		return true;
+	}
+
+	if (right.renderState_ < left.renderState_)
+	{
+		return false;
+	}
+
+	if (left.renderable_ != right.renderable_)
+	{
+		return std::less<const void*>()(left.renderable_.pointer(), right.renderable_.pointer());
+	}
+
+	return std::less<const void*>()(left.attributeSet_.pointer(), right.attributeSet_.pointer());
+}
+
 inline bool GLESTraverser::TraverserObject::compareDistance(const TraverserObject& left, const TraverserObject& right)
 {
 	return left.camera_T_renderable_.translation().sqr() < right.camera_T_renderable_.translation().sqr();
 }
 
+inline bool GLESTraverser::isCullingEnabled() const
+{
+	return cullingFrustum_.isValid();
+}
+
+inline const GLESTraverser::Statistics& GLESTraverser::statistics() const
+{
+	return statistics_;
+}
+
 }
 
 }
@@ -159,15 +159,15 @@ void GLESTriangleFans::updateBoundingBox()
 {
 	boundingBox_ = BoundingBox();
 
-	if (primitiveVertexSet.isNull() || strips_.empty())
+	if (primitiveVertexSet && !strips_.empty())
 	{
-		return;
-	}
+		const SmartObjectRef<GLESVertexSet> glesVertexSet(primitiveVertexSet);
+		ocean_assert(glesVertexSet);
 
-	const SmartObjectRef<GLESVertexSet> glesVertexSet(primitiveVertexSet);
-	ocean_assert(glesVertexSet);
+		boundingBox_ = glesVertexSet->boundingBox(strips_);
+	}
 
-	boundingBox_ = glesVertexSet->boundingBox(strips_);
+	invalidateParentBoundingBoxes();
 }
 
 }
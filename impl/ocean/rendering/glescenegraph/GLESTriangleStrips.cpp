@@ -177,6 +177,55 @@ void GLESTriangleStrips::render(const SquareMatrix4& projectionMatrix, const Hom
 	ocean_assert(GL_NO_ERROR == glGetError());
 }
 
+bool GLESTriangleStrips::renderInstanced(const GLESFramebuffer& framebuffer, const SquareMatrix4& projectionMatrix, const HomogenousMatrices4& camera_T_instances, const HomogenousMatrix4& camera_T_world, const SquareMatrices3& normalMatrices, GLESAttributeSet& attributeSet, const Lights& lights)
+{
+	ocean_assert(!camera_T_instances.empty() && camera_T_instances.size() == normalMatrices.size());
+
+	if (vboIndices_ == 0u)
+	{
+		return true;
+	}
+
+	const SmartObjectRef<GLESVertexSet> glesVertexSet(vertexSet());
+	if (glesVertexSet.isNull())
+	{
+		return true;
+	}
+
+	if (!attributeSet.isInstancingSupported(lights))
+	{
+		return false;
+	}
+
+	attributeSet.bindAttributes(framebuffer, projectionMatrix, camera_T_instances.front(), camera_T_world, normalMatrices.front(), lights, GLESAttribute::PT_INSTANCED);
+
+	bool result = false;
+
+	const GLESShaderProgramRef shaderProgram(attributeSet.shaderProgram());
+
+	if (shaderProgram && shaderProgram->isCompiled())
+	{
+		glesVertexSet->bindVertexSet(shaderProgram->id());
+
+		if (bindInstances(shaderProgram->id(), camera_T_instances, normalMatrices))
+		{
+			glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, vboIndices_);
+			ocean_assert(GL_NO_ERROR == glGetError());
+
+			glDrawElementsInstanced(GL_TRIANGLE_STRIP, numberIndices_, GL_UNSIGNED_INT, nullptr, GLsizei(camera_T_instances.size()));
+			ocean_assert(GL_NO_ERROR == glGetError());
+
+			unbindInstances(shaderProgram->id());
+
+			result = true;
+		}
+	}
+
+	attributeSet.unbindAttributes();
+
+	return result;
+}
+
 void GLESTriangleStrips::release()
 {
 	if (vboIndices_ != 0u)
@@ -197,15 +246,15 @@ void GLESTriangleStrips::updateBoundingBox()
 {
 	boundingBox_ = BoundingBox();
 
-	if (primitiveVertexSet.isNull() || strips_.empty())
+	if (primitiveVertexSet && !strips_.empty())
 	{
-		return;
-	}
+		const SmartObjectRef<GLESVertexSet> glesVertexSet(primitiveVertexSet);
+		ocean_assert(glesVertexSet);
 
-	const SmartObjectRef<GLESVertexSet> glesVertexSet(primitiveVertexSet);
-	ocean_assert(glesVertexSet);
+		boundingBox_ = glesVertexSet->boundingBox(strips_);
+	}
 
-	boundingBox_ = glesVertexSet->boundingBox(strips_);
+	invalidateParentBoundingBoxes();
 }
 
 }
@@ -64,6 +64,12 @@ class OCEAN_RENDERING_GLES_EXPORT GLESTriangleStrips :
 		 */
 		void render(const SquareMatrix4& projectionMatrix, const HomogenousMatrix4& camera_T_object, const HomogenousMatrix4& camera_T_world, const SquareMatrix3& normalMatrix, GLESShaderProgram& shaderProgram) override;
 
+		/**
+		 * Renders several instances of the triangle strips with one draw call.
+		 * @see GLESRenderable::renderInstanced().
+		 */
+		bool renderInstanced(const GLESFramebuffer& framebuffer, const SquareMatrix4& projectionMatrix, const HomogenousMatrices4& camera_T_instances, const HomogenousMatrix4& camera_T_world, const SquareMatrices3& normalMatrices, GLESAttributeSet& attributeSet, const Lights& lights) override;
+
 	protected:
 
 		/**
@@ -145,6 +145,70 @@ void GLESTriangles::render(const SquareMatrix4& projectionMatrix, const Homogeno
 	drawTriangles();
 }
 
+bool GLESTriangles::renderInstanced(const GLESFramebuffer& framebuffer, const SquareMatrix4& projectionMatrix, const HomogenousMatrices4& camera_T_instances, const HomogenousMatrix4& camera_T_world, const SquareMatrices3& normalMatrices, GLESAttributeSet& attributeSet, const Lights& lights)
+{
+	ocean_assert(!camera_T_instances.empty() && camera_T_instances.size() == normalMatrices.size());
+
+	if (explicitTriangleFaces_.empty() && numberImplicitTriangleFaces_ == 0u)
+	{
+		return true;
+	}
+
+	const SmartObjectRef<GLESVertexSet> glesVertexSet(vertexSet());
+	if (glesVertexSet.isNull())
+	{
+		return true;
+	}
+
+	if (!attributeSet.isInstancingSupported(lights))
+	{
+		return false;
+	}
+
+	attributeSet.bindAttributes(framebuffer, projectionMatrix, camera_T_instances.front(), camera_T_world, normalMatrices.front(), lights, GLESAttribute::PT_INSTANCED);
+
+	bool result = false;
+
+	const GLESShaderProgramRef shaderProgram(attributeSet.shaderProgram());
+
+	if (shaderProgram && shaderProgram->isCompiled())
+	{
+		glesVertexSet->bindVertexSet(shaderProgram->id());
+
+		if (bindInstances(shaderProgram->id(), camera_T_instances, normalMatrices))
+		{
+			const GLsizei numberInstances = GLsizei(camera_T_instances.size());
+
+			if (numberImplicitTriangleFaces_ == 0u)
+			{
+				ocean_assert(vboIndices_ != 0u);
+
+				glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, vboIndices_);
+				ocean_assert(GL_NO_ERROR == glGetError());
+
+				glDrawElementsInstanced(GL_TRIANGLES, GLsizei(explicitTriangleFaces_.size() * 3), GL_UNSIGNED_INT, nullptr, numberInstances);
+				ocean_assert(GL_NO_ERROR == glGetError());
+
+				glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0u);
+				ocean_assert(GL_NO_ERROR == glGetError());
+			}
+			else
+			{
+				glDrawArraysInstanced(GL_TRIANGLES, 0, GLsizei(numberImplicitTriangleFaces_ * 3u), numberInstances);
+				ocean_assert(GL_NO_ERROR == glGetError());
+			}
+
+			unbindInstances(shaderProgram->id());
+
+			result = true;
+		}
+	}
+
+	attributeSet.unbindAttributes();
+
+	return result;
+}
+
 void GLESTriangles::drawTriangles()
 {
 	if (numberImplicitTriangleFaces_ == 0u)
@@ -217,22 +281,22 @@ void GLESTriangles::updateBoundingBox()
 {
 	boundingBox_ = BoundingBox();
 
-	if (primitiveVertexSet.isNull() || explicitTriangleFaces_.empty())
+	if (primitiveVertexSet)
 	{
-		return;
+		const SmartObjectRef<GLESVertexSet> glesVertexSet(primitiveVertexSet);
+		ocean_assert(glesVertexSet);
+
+		if (explicitTriangleFaces_.empty())
+		{
+			boundingBox_ = glesVertexSet->boundingBox(numberImplicitTriangleFaces_ * 3u);
+		}
+		else
+		{
+			boundingBox_ = glesVertexSet->boundingBox(explicitTriangleFaces_);
+		}
 	}
 
-	const SmartObjectRef<GLESVertexSet> glesVertexSet(primitiveVertexSet);
-	ocean_assert(glesVertexSet);
-
-	if (explicitTriangleFaces_.empty())
-	{
-		boundingBox_ = glesVertexSet->boundingBox(numberImplicitTriangleFaces_ * 3u);
-	}
-	else
-	{
-		boundingBox_ = glesVertexSet->boundingBox(explicitTriangleFaces_);
-	}
+	invalidateParentBoundingBoxes();
 }
 
 }
@@ -6,6 +6,7 @@
  */
 
 #include "ocean/rendering/glescenegraph/GLESVertexSet.h"
+#include "ocean/rendering/glescenegraph/GLESPrimitive.h"
 
 #include "ocean/base/String.h"
 
@@ -54,6 +55,20 @@ Vertices GLESVertexSet::vertices() const
 	return vertices_;
 }
 
+Vertices GLESVertexSet::vertices(const unsigned int firstVertex, const unsigned int numberVertices) const
+{
+	const ScopedLock scopedLock(objectLock);
+
+	ocean_assert(size_t(firstVertex) + size_t(numberVertices) <= vertices_.size());
+
+	if (size_t(firstVertex) + size_t(numberVertices) > vertices_.size())
+	{
+		return Vertices();
+	}
+
+	return Vertices(vertices_.data() + firstVertex, vertices_.data() + firstVertex + numberVertices);
+}
+
 RGBAColors GLESVertexSet::colors() const
 {
 	throw NotSupportedException("OpenGL ES does not support reading of colors.");
@@ -109,7 +124,7 @@ void GLESVertexSet::setNormals(const Vector3* normals, const size_t size)
 	}
 	else
 	{
-		bufferNormals_.setData(normals, size);
+		bufferNormals_.setData(normals, size, bufferUsage_);
 	}
 }
 
@@ -128,7 +143,7 @@ void GLESVertexSet::setTextureCoordinates(const TextureCoordinates& textureCoord
 	}
 	else
 	{
-		bufferTextureCoordinates2D_.setData(textureCoordinates.data(), textureCoordinates.size());
+		bufferTextureCoordinates2D_.setData(textureCoordinates.data(), textureCoordinates.size(), bufferUsage_);
 	}
 }
 
@@ -147,7 +162,7 @@ void GLESVertexSet::setPhantomTextureCoordinates(const Vertices& textureCoordina
 	}
 	else
 	{
-		bufferTextureCoordinates3D_.setData(textureCoordinates.data(), textureCoordinates.size());
+		bufferTextureCoordinates3D_.setData(textureCoordinates.data(), textureCoordinates.size(), bufferUsage_);
 	}
 }
 
@@ -165,17 +180,31 @@ void GLESVertexSet::setVertices(const Vertices& vertices)
 
 void GLESVertexSet::setVertices(const Vector3* vertices, const size_t size)
 {
-	const ScopedLock scopedLock(objectLock);
+	{
+		const ScopedLock scopedLock(objectLock);
 
-	vertices_ = Vectors3(vertices, vertices + size);
+		vertices_ = Vectors3(vertices, vertices + size);
 
-	if (vertices_.empty())
-	{
-		bufferVertices_.release();
+		if (vertices_.empty())
+		{
+			bufferVertices_.release();
+		}
+		else
+		{
+			bufferVertices_.setData(vertices, size, bufferUsage_);
+		}
 	}
-	else
+
+	// the bounding boxes of all primitives using this vertex set may have changed
+
+	for (const ObjectRef& parent : parentObjects())
 	{
-		bufferVertices_.setData(vertices, size);
+		const SmartObjectRef<GLESPrimitive> primitive(parent);
+
+		if (primitive)
+		{
+			primitive->onVerticesChanged();
+		}
 	}
 }
 
@@ -187,7 +216,7 @@ void GLESVertexSet::setColors(const RGBAColors& colors)
 	}
 	else
 	{
-		bufferColors_.setData(colors.data(), colors.size());
+		bufferColors_.setData(colors.data(), colors.size(), bufferUsage_);
 	}
 }
 
@@ -370,6 +399,13 @@ void GLESVertexSet::release()
 	vertices_.clear();
 }
 
+MemoryTracker::CategoryId GLESVertexSet::memoryCategoryId()
+{
+	static const MemoryTracker::CategoryId categoryId = MemoryTracker::registerCategory("GLESBuffers");
+
+	return categoryId;
+}
+
 }
 
 }
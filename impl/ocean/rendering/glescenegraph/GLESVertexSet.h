@@ -12,6 +12,8 @@
 #include "ocean/rendering/glescenegraph/GLESObject.h"
 #include "ocean/rendering/glescenegraph/GLESShaderProgram.h"
 
+#include "ocean/base/MemoryTracker.h"
+
 #include "ocean/math/BoundingBox.h"
 
 #include "ocean/rendering/TriangleFace.h"
@@ -134,6 +136,9 @@ class OCEAN_RENDERING_GLES_EXPORT GLESVertexSet :
 
 				/// The number of elements stored in the buffer object.
 				unsigned int numberElements_ = 0u;
+
+				/// The accounting of the memory of the buffer object.
+				MemoryTracker::TrackedBytes trackedMemory_ = MemoryTracker::TrackedBytes(memoryCategoryId());
 		};
 
 	protected:
@@ -164,6 +169,12 @@ class OCEAN_RENDERING_GLES_EXPORT GLESVertexSet :
 		template <typename T>
 		static constexpr bool isFloatComponent();
 
+		/**
+		 * Returns the id of the memory category to which the memory of all vertex buffer objects is reported.
+		 * @return The id of the category
+		 */
+		static MemoryTracker::CategoryId memoryCategoryId();
+
 	public:
 
 		/**
@@ -200,6 +211,14 @@ class OCEAN_RENDERING_GLES_EXPORT GLESVertexSet :
 		 */
 		Vertices vertices() const override;
 
+		/**
+		 * Returns a subset of the vertices of this set.
+		 * @param firstVertex The index of the first vertex to return, with range [0, numberVertices())
+		 * @param numberVertices The number of vertices to return, with range [0, numberVertices() - firstVertex]
+		 * @return The requested vertices
+		 */
+		Vertices vertices(const unsigned int firstVertex, const unsigned int numberVertices) const;
+
 		/**
 		 * Returns the colors of this set.
 		 * @see VertexSet::colors();
@@ -294,6 +313,13 @@ class OCEAN_RENDERING_GLES_EXPORT GLESVertexSet :
 		template <typename T>
 		void setAttribute(const std::string& attributeName, const T* elements, const size_t numberElements);
 
+		/**
+		 * Sets the expected usage pattern of the buffer objects of the standard attributes (vertices, normals, texture coordinates, and colors).
+		 * The usage pattern is applied whenever the attributes are set the next time.
+		 * @param usage The usage pattern, GL_STATIC_DRAW for attributes which are set once, GL_DYNAMIC_DRAW for attributes which are set frequently e.g., every few frames
+		 */
+		inline void setBufferUsage(const GLenum usage);
+
 		/**
 		 * Binds the vertex set to a program.
 		 * @param programId The id of the program to which the buffer will be bound
@@ -373,6 +399,9 @@ class OCEAN_RENDERING_GLES_EXPORT GLESVertexSet :
 
 		/// The vertices stored in this vertex set.
 		Vectors3 vertices_;
+
+		/// The expected usage pattern of the buffer objects of the standard attributes.
+		GLenum bufferUsage_ = GL_STATIC_DRAW;
 };
 
 template <typename T>
@@ -386,7 +415,8 @@ template <typename T>
 GLESVertexSet::VertexBufferObjectT<T>::VertexBufferObjectT(VertexBufferObjectT<T>&& vertexBufferObject) :
 	attributeName_(std::move(vertexBufferObject.attributeName_)),
 	buffer_(vertexBufferObject.buffer_),
-	numberElements_(vertexBufferObject.numberElements_)
+	numberElements_(vertexBufferObject.numberElements_),
+	trackedMemory_(std::move(vertexBufferObject.trackedMemory_))
 {
 	vertexBufferObject.buffer_ = 0u;
 	vertexBufferObject.numberElements_ = 0u;
@@ -411,6 +441,9 @@ void GLESVertexSet::VertexBufferObjectT<T>::setData(const T* elements, const siz
 	setBufferData(GL_ARRAY_BUFFER, elements, numberElements, usage);
 	numberElements_ = (unsigned int)(numberElements);
 
+	// elements with floating point components are always stored as 32 bit floats
+	trackedMemory_.setBytes(numberElements * (isFloatComponent<T>() ? numberComponents<T>() * sizeof(float) : sizeof(T)));
+
 	if (glGetError() == GL_OUT_OF_MEMORY)
 	{
 		release();
@@ -465,6 +498,15 @@ inline unsigned int GLESVertexSet::VertexBufferObjectT<T>::numberElements() cons
 	return numberElements_;
 }
 
+inline void GLESVertexSet::setBufferUsage(const GLenum usage)
+{
+	ocean_assert(usage == GL_STATIC_DRAW || usage == GL_DYNAMIC_DRAW || usage == GL_STREAM_DRAW);
+
+	const ScopedLock scopedLock(objectLock);
+
+	bufferUsage_ = usage;
+}
+
 template <typename T>
 void GLESVertexSet::VertexBufferObjectT<T>::release()
 {
@@ -475,6 +517,8 @@ void GLESVertexSet::VertexBufferObjectT<T>::release()
 
 		buffer_ = 0u;
 		numberElements_ = 0u;
+
+		trackedMemory_.setBytes(0);
 	}
 }
 
@@ -0,0 +1,299 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "ocean/rendering/glescenegraph/android/GLESMovieRecorderSurface.h"
+
+namespace Ocean
+{
+
+namespace Rendering
+{
+
+namespace GLESceneGraph
+{
+
+namespace Android
+{
+
+GLESMovieRecorderSurface::GLESMovieRecorderSurface(const Media::MovieRecorderRef& movieRecorder) :
+	movieRecorder_(movieRecorder)
+{
+	ocean_assert(movieRecorder_);
+	ocean_assert(movieRecorder_->surfaceInput());
+
+	eglPresentationTimeANDROID_ = (PFNEGLPRESENTATIONTIMEANDROIDPROC)(eglGetProcAddress("eglPresentationTimeANDROID"));
+
+	if (eglPresentationTimeANDROID_ == nullptr)
+	{
+		Log::warning() << "eglPresentationTimeANDROID is not supported, the movie will use the system timestamps of the frames";
+	}
+}
+
+GLESMovieRecorderSurface::~GLESMovieRecorderSurface()
+{
+	release();
+}
+
+bool GLESMovieRecorderSurface::addFrame(const GLESTextureFramebuffer& textureFramebuffer)
+{
+	if (!movieRecorder_ || !textureFramebuffer.isValid())
+	{
+		return false;
+	}
+
+	const EGLDisplay display = eglGetCurrentDisplay();
+	const EGLContext context = eglGetCurrentContext();
+
+	if (display == EGL_NO_DISPLAY || context == EGL_NO_CONTEXT)
+	{
+		ocean_assert(false && "Invalid EGL context, the function must be called from the rendering thread!");
+		return false;
+	}
+
+	void* inputSurface = nullptr;
+	double presentationTimestamp = 0.0;
+
+	if (!movieRecorder_->lockSurfaceToFill(inputSurface, presentationTimestamp))
+	{
+		// the recording has stopped (or not yet started), the encoder's surface is invalid
+
+		releaseSurface();
+		return false;
+	}
+
+	ocean_assert(inputSurface != nullptr);
+
+	if (surface_ == EGL_NO_SURFACE || display_ != display || nativeWindow_ != inputSurface)
+	{
+		// the recorder has been restarted, or we have a new display
+
+		releaseSurface();
+
+		if (!createSurface(display, context, inputSurface))
+		{
+			movieRecorder_->unlockSurfaceToFill();
+			return false;
+		}
+	}
+
+	const EGLSurface previousDrawSurface = eglGetCurrentSurface(EGL_DRAW);
+	const EGLSurface previousReadSurface = eglGetCurrentSurface(EGL_READ);
+
+	GLint previousFramebuffer = 0;
+	glGetIntegerv(GL_FRAMEBUFFER_BINDING, &previousFramebuffer);
+
+	GLint previousViewport[4] = {0, 0, 0, 0};
+	glGetIntegerv(GL_VIEWPORT, previousViewport);
+
+	bool result = false;
+
+	if (eglMakeCurrent(display_, surface_, surface_, context) == EGL_TRUE)
+	{
+		result = blitAndSwap(textureFramebuffer, presentationTimestamp);
+
+		if (eglMakeCurrent(display, previousDrawSurface, previousReadSurface, context) != EGL_TRUE)
+		{
+			Log::error() << "Failed to restore the previous EGL surfaces: " << eglGetError();
+			result = false;
+		}
+	}
+	else
+	{
+		Log::error() << "Failed to make the encoder's surface current: " << eglGetError();
+	}
+
+	glBindFramebuffer(GL_FRAMEBUFFER, GLuint(previousFramebuffer));
+	glViewport(previousViewport[0], previousViewport[1], previousViewport[2], previousViewport[3]);
+
+	movieRecorder_->unlockSurfaceToFill();
+
+	return result;
+}
+
+void GLESMovieRecorderSurface::release()
+{
+	releaseSurface();
+
+	movieRecorder_.release();
+}
+
+bool GLESMovieRecorderSurface::createSurface(EGLDisplay display, EGLContext context, void* nativeWindow)
+{
+	ocean_assert(display != EGL_NO_DISPLAY && context != EGL_NO_CONTEXT && nativeWindow != nullptr);
+	ocean_assert(surface_ == EGL_NO_SURFACE);
+
+	// we use the config of the context if the config is recordable, otherwise we select a recordable config with identical color channels
+
+	EGLint configId = 0;
+	if (eglQueryContext(display, context, EGL_CONFIG_ID, &configId) != EGL_TRUE)
+	{
+		Log::error() << "Failed to determine the config of the EGL context: " << eglGetError();
+		return false;
+	}
+
+	const EGLint contextConfigAttributes[] =
+	{
+		EGL_CONFIG_ID, configId,
+		EGL_NONE
+	};
+
+	EGLConfig config = nullptr;
+	EGLint numberConfigs = 0;
+
+	if (eglChooseConfig(display, contextConfigAttributes, &config, 1, &numberConfigs) != EGL_TRUE || numberConfigs != 1)
+	{
+		Log::error() << "Failed to access the config of the EGL context: " << eglGetError();
+		return false;
+	}
+
+	EGLint recordable = EGL_FALSE;
+	eglGetConfigAttrib(display, config, EGL_RECORDABLE_ANDROID, &recordable);
+
+	if (recordable != EGL_TRUE)
+	{
+		EGLint redSize = 0;
+		EGLint greenSize = 0;
+		EGLint blueSize = 0;
+		EGLint alphaSize = 0;
+		EGLint renderableType = 0;
+
+		eglGetConfigAttrib(display, config, EGL_RED_SIZE, &redSize);
+		eglGetConfigAttrib(display, config, EGL_GREEN_SIZE, &greenSize);
+		eglGetConfigAttrib(display, config, EGL_BLUE_SIZE, &blueSize);
+		eglGetConfigAttrib(display, config, EGL_ALPHA_SIZE, &alphaSize);
+		eglGetConfigAttrib(display, config, EGL_RENDERABLE_TYPE, &renderableType);
+
+		const EGLint recordableConfigAttributes[] =
+		{
+			EGL_RED_SIZE, redSize,
+			EGL_GREEN_SIZE, greenSize,
+			EGL_BLUE_SIZE, blueSize,
+			EGL_ALPHA_SIZE, alphaSize,
+			EGL_RENDERABLE_TYPE, renderableType,
+			EGL_SURFACE_TYPE, EGL_WINDOW_BIT,
+			EGL_RECORDABLE_ANDROID, EGL_TRUE,
+			EGL_NONE
+		};
+
+		if (eglChooseConfig(display, recordableConfigAttributes, &config, 1, &numberConfigs) != EGL_TRUE || numberConfigs != 1)
+		{
+			Log::error() << "Failed to determine a recordable EGL config: " << eglGetError();
+			return false;
+		}
+	}
+
+	const EGLint surfaceAttributes[] =
+	{
+		EGL_NONE
+	};
+
+	surface_ = eglCreateWindowSurface(display, config, (EGLNativeWindowType)(nativeWindow), surfaceAttributes);
+
+	if (surface_ == EGL_NO_SURFACE)
+	{
+		Log::error() << "Failed to create an EGL surface for the encoder: " << eglGetError();
+		return false;
+	}
+
+	eglQuerySurface(display, surface_, EGL_WIDTH, &surfaceWidth_);
+	eglQuerySurface(display, surface_, EGL_HEIGHT, &surfaceHeight_);
+
+	if (surfaceWidth_ <= 0 || surfaceHeight_ <= 0)
+	{
+		Log::error() << "The EGL surface of the encoder has an invalid resolution";
+
+		eglDestroySurface(display, surface_);
+		surface_ = EGL_NO_SURFACE;
+
+		return false;
+	}
+
+	display_ = display;
+	nativeWindow_ = nativeWindow;
+
+	return true;
+}
+
+void GLESMovieRecorderSurface::releaseSurface()
+{
+	if (surface_ != EGL_NO_SURFACE)
+	{
+		ocean_assert(display_ != EGL_NO_DISPLAY);
+
+		eglDestroySurface(display_, surface_);
+		surface_ = EGL_NO_SURFACE;
+	}
+
+	display_ = EGL_NO_DISPLAY;
+	nativeWindow_ = nullptr;
+
+	surfaceWidth_ = 0;
+	surfaceHeight_ = 0;
+}
+
+bool GLESMovieRecorderSurface::blitAndSwap(const GLESTextureFramebuffer& textureFramebuffer, const double presentationTimestamp)
+{
+	ocean_assert(surface_ != EGL_NO_SURFACE);
+	ocean_assert(textureFramebuffer.framebufferObjectId() != 0u);
+
+	const GLint sourceWidth = GLint(textureFramebuffer.width());
+	const GLint sourceHeight = GLint(textureFramebuffer.height());
+
+	const bool identicalSize = sourceWidth == surfaceWidth_ && sourceHeight == surfaceHeight_;
+
+	if (textureFramebuffer.multisamples() > 1u && !identicalSize)
+	{
+		// a multisample framebuffer can only be resolved into a framebuffer with identical size
+
+		Log::error() << "A multisample framebuffer must have the same resolution as the movie recorder";
+		return false;
+	}
+
+	glBindFramebuffer(GL_READ_FRAMEBUFFER, textureFramebuffer.framebufferObjectId());
+	ocean_assert(GL_NO_ERROR == glGetError());
+
+	glBindFramebuffer(GL_DRAW_FRAMEBUFFER, 0u);
+	ocean_assert(GL_NO_ERROR == glGetError());
+
+	glViewport(0, 0, surfaceWidth_, surfaceHeight_);
+
+	// both, the texture framebuffer and the window surface have their origin in the lower left corner, so that no flip is necessary
+
+	glBlitFramebuffer(0, 0, sourceWidth, sourceHeight, 0, 0, surfaceWidth_, surfaceHeight_, GL_COLOR_BUFFER_BIT, identicalSize ? GL_NEAREST : GL_LINEAR);
+
+	const GLenum blitError = glGetError();
+
+	if (blitError != GL_NO_ERROR)
+	{
+		Log::error() << "Failed to blit the framebuffer into the encoder's surface: " << blitError;
+		return false;
+	}
+
+	if (eglPresentationTimeANDROID_ != nullptr)
+	{
+		ocean_assert(presentationTimestamp >= 0.0);
+
+		const EGLnsecsANDROID presentationTimeNs = EGLnsecsANDROID(presentationTimestamp * 1000000000.0);
+		eglPresentationTimeANDROID_(display_, surface_, presentationTimeNs);
+	}
+
+	if (eglSwapBuffers(display_, surface_) != EGL_TRUE)
+	{
+		Log::error() << "Failed to swap the encoder's surface: " << eglGetError();
+		return false;
+	}
+
+	return true;
+}
+
+}
+
+}
+
+}
+
+}
@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#ifndef META_OCEAN_RENDERING_GLES_ANDROID_GLES_MOVIE_RECORDER_SURFACE_H
+#define META_OCEAN_RENDERING_GLES_ANDROID_GLES_MOVIE_RECORDER_SURFACE_H
+
+#include "ocean/rendering/glescenegraph/GLESceneGraph.h"
+#include "ocean/rendering/glescenegraph/GLESTextureFramebuffer.h"
+
+#include "ocean/media/MovieRecorder.h"
+
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+
+namespace Ocean
+{
+
+namespace Rendering
+{
+
+namespace GLESceneGraph
+{
+
+namespace Android
+{
+
+/**
+ * This class forwards the content of texture framebuffers to a movie recorder without copying the image content to CPU memory.
+ * The framebuffer is blitted into the input surface of the movie recorder's encoder (an EGL window surface on top of the encoder's ANativeWindow).<br>
+ * The movie recorder must be configured with MovieRecorder::setSurfaceInput() before the recording is started.<br>
+ * All functions must be called from the thread in which the recorder's OpenGL ES context is current.
+ * @ingroup renderinggles
+ */
+class OCEAN_RENDERING_GLES_EXPORT GLESMovieRecorderSurface
+{
+	public:
+
+		/**
+		 * Creates a new object for a movie recorder.
+		 * @param movieRecorder The movie recorder which will receive the frames, must be valid and must use an input surface
+		 */
+		explicit GLESMovieRecorderSurface(const Media::MovieRecorderRef& movieRecorder);
+
+		/**
+		 * Destructs this object and releases the EGL resources.
+		 */
+		~GLESMovieRecorderSurface();
+
+		/**
+		 * Adds the current content of a texture framebuffer as new frame to the movie recorder.
+		 * The framebuffer is scaled to the resolution of the recorder, if necessary.<br>
+		 * The current EGL surfaces and the current framebuffer binding are restored before the function returns.
+		 * @param textureFramebuffer The texture framebuffer providing the color content of the frame, must be valid
+		 * @return True, if succeeded
+		 */
+		bool addFrame(const GLESTextureFramebuffer& textureFramebuffer);
+
+		/**
+		 * Releases the EGL resources of this object.
+		 * The object cannot be used anymore afterwards.
+		 */
+		void release();
+
+	protected:
+
+		/**
+		 * Creates the EGL window surface for the encoder's input surface.
+		 * @param display The EGL display to be used, must be valid
+		 * @param context The EGL context which will render into the surface, must be valid
+		 * @param nativeWindow The encoder's input surface (an ANativeWindow object), must be valid
+		 * @return True, if succeeded
+		 */
+		bool createSurface(EGLDisplay display, EGLContext context, void* nativeWindow);
+
+		/**
+		 * Releases the EGL window surface.
+		 */
+		void releaseSurface();
+
+		/**
+		 * Blits the texture framebuffer into the EGL window surface and swaps the surface.
+		 * The EGL window surface must be current.
+		 * @param textureFramebuffer The texture framebuffer providing the color content of the frame
+		 * @param presentationTimestamp The presentation timestamp of the frame, in seconds, with range [0, infinity)
+		 * @return True, if succeeded
+		 */
+		bool blitAndSwap(const GLESTextureFramebuffer& textureFramebuffer, const double presentationTimestamp);
+
+		/**
+		 * Disabled copy constructor.
+		 */
+		GLESMovieRecorderSurface(const GLESMovieRecorderSurface&) = delete;
+
+		/**
+		 * Disabled copy operator.
+		 * @return Reference to this object
+		 */
+		GLESMovieRecorderSurface& operator=(const GLESMovieRecorderSurface&) = delete;
+
+	protected:
+
+		/// The movie recorder which receives the frames.
+		Media::MovieRecorderRef movieRecorder_;
+
+		/// The EGL display of the window surface.
+		EGLDisplay display_ = EGL_NO_DISPLAY;
+
+		/// The EGL window surface wrapping the encoder's input surface.
+		EGLSurface surface_ = EGL_NO_SURFACE;
+
+		/// The encoder's input surface for which the EGL window surface has been created.
+		void* nativeWindow_ = nullptr;
+
+		/// The width of the EGL window surface, in pixel.
+		EGLint surfaceWidth_ = 0;
+
+		/// The height of the EGL window surface, in pixel.
+		EGLint surfaceHeight_ = 0;
+
+		/// The function pointer to eglPresentationTimeANDROID, nullptr if not supported.
+		PFNEGLPRESENTATIONTIMEANDROIDPROC eglPresentationTimeANDROID_ = nullptr;
+};
+
+}
+
+}
+
+}
+
+}
+
+#endif // META_OCEAN_RENDERING_GLES_ANDROID_GLES_MOVIE_RECORDER_SURFACE_H
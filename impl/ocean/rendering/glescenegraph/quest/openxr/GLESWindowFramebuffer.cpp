@@ -11,6 +11,8 @@
 #include "ocean/rendering/glescenegraph/GLESScene.h"
 #include "ocean/rendering/glescenegraph/GLESStereoView.h"
 
+#include "ocean/base/HighPerformanceTimer.h"
+
 #include "ocean/rendering/Engine.h"
 
 #ifdef OCEAN_RENDERING_GLES_QUEST_PLATFORM_OPENXR
@@ -72,7 +74,7 @@ void GLESWindowFramebuffer::render()
 		return;
 	}
 
-	const HomogenousMatrix4 views_T_world[numberEyes_] =
+	HomogenousMatrix4 views_T_world[numberEyes_] =
 	{
 		glesStereoView->leftTransformation().inverted(),
 		glesStereoView->rightTransformation().inverted()
@@ -84,8 +86,8 @@ void GLESWindowFramebuffer::render()
 		glesStereoView->rightProjectionMatrix()
 	};
 
-	ocean_assert(glesFramebuffers_.size() == numberEyes_);
-	if (glesFramebuffers_.size() != numberEyes_)
+	ocean_assert(glesFramebuffers_.size() == (multiview_ ? 1 : numberEyes_));
+	if (glesFramebuffers_.size() != (multiview_ ? 1 : numberEyes_))
 	{
 		return;
 	}
@@ -93,13 +95,28 @@ void GLESWindowFramebuffer::render()
 	TemporaryScopedLock temporaryScopedLock(objectLock);
 		const RenderCallback preRenderCallback(preRenderCallback_);
 		const RenderCallback postRenderCallback(postRenderCallback_);
+		const LateLatchCallback lateLatchCallback(lateLatchCallback_);
 	temporaryScopedLock.release();
 
 	const Timestamp renderTimestamp = engine().timestamp();
 	ocean_assert(renderTimestamp.isValid());
 
+	const bool recordTiming = frameTiming_.beginFrame(*this, renderTimestamp);
+
+	if (multiview_)
+	{
+		renderMultiview(*glesStereoView, views_T_world, projectionMatrices, preRenderCallback, postRenderCallback, lateLatchCallback, renderTimestamp, recordTiming);
+
+		frameTiming_.endFrame();
+		return;
+	}
+
 	ocean_assert(nextRenderFirstEyeIndex_ < 2);
 
+	// the views are latched once for each frame, right before the draw calls of the first eye are submitted
+
+	bool viewsLatched = !lateLatchCallback;
+
 	for (size_t index = 0; index < glesFramebuffers_.size(); ++index)
 	{
 		const size_t eye = (nextRenderFirstEyeIndex_ + index) % glesFramebuffers_.size();
@@ -120,6 +137,7 @@ void GLESWindowFramebuffer::render()
 
 			nextRenderFirstEyeIndex_ = eye;
 
+			frameTiming_.endFrame();
 			return;
 		}
 
@@ -139,48 +157,17 @@ void GLESWindowFramebuffer::render()
 			preRenderCallback(eye, camera_T_world, projectionMatrix, renderTimestamp);
 		}
 
-		if (cullingMode_ == PrimitiveAttribute::CULLING_DEFAULT)
-		{
-			glEnable(GL_CULL_FACE);
-			ocean_assert(GL_NO_ERROR == glGetError());
+		applyCullingMode();
 
-			glCullFace(GL_BACK);
-			ocean_assert(GL_NO_ERROR == glGetError());
-		}
-		else
-		{
-			switch (cullingMode_)
-			{
-				case PrimitiveAttribute::CULLING_NONE:
-					glDisable(GL_CULL_FACE);
-					ocean_assert(GL_NO_ERROR == glGetError());
-					break;
-
-				case PrimitiveAttribute::CULLING_BACK:
-					glEnable(GL_CULL_FACE);
-					glCullFace(GL_BACK);
-					ocean_assert(GL_NO_ERROR == glGetError());
-					break;
-
-				case PrimitiveAttribute::CULLING_FRONT:
-					glEnable(GL_CULL_FACE);
-					glCullFace(GL_FRONT);
-					ocean_assert(GL_NO_ERROR == glGetError());
-					break;
-
-				case PrimitiveAttribute::CULLING_BOTH:
-					glEnable(GL_CULL_FACE);
-					glCullFace(GL_FRONT_AND_BACK);
-					ocean_assert(GL_NO_ERROR == glGetError());
-					break;
-
-				default:
-					ocean_assert(false && "Invalid parameter!");
-			}
-		}
+		const HighPerformanceTimer traversalTimer;
 
 		traverser_.clear();
 
+		if (viewCulling_)
+		{
+			traverser_.enableCulling(projectionMatrix, framebuffer.height(), minimalFeatureSize_);
+		}
+
 		for (Scenes::const_iterator i = framebufferScenes.begin(); i != framebufferScenes.end(); ++i)
 		{
 			const SmartObjectRef<GLESScene> glesScene(*i);
@@ -197,8 +184,28 @@ void GLESWindowFramebuffer::render()
 			ocean_assert(GL_NO_ERROR == glGetError());
 		}
 
+		if (!viewsLatched)
+		{
+			latchViews(*glesStereoView, lateLatchCallback, eye, views_T_world);
+			viewsLatched = true;
+		}
+
+		if (recordTiming)
+		{
+			frameTiming_.addTraversalDuration(traversalTimer.seconds());
+			frameTiming_.beginPass(eye);
+		}
+
+		const HighPerformanceTimer submitTimer;
+
 		traverser_.render(*this, projectionMatrix, camera_T_world);
 
+		if (recordTiming)
+		{
+			frameTiming_.addSubmitDuration(submitTimer.seconds());
+			frameTiming_.endPass();
+		}
+
 		if (postRenderCallback)
 		{
 			postRenderCallback(eye, camera_T_world, projectionMatrix, renderTimestamp);
@@ -208,6 +215,219 @@ void GLESWindowFramebuffer::render()
 	}
 
 	nextRenderFirstEyeIndex_ = 0;
+
+	frameTiming_.endFrame();
+}
+
+void GLESWindowFramebuffer::renderMultiview(const GLESStereoView& glesStereoView, HomogenousMatrix4* views_T_world, const SquareMatrix4* projectionMatrices, const RenderCallback& preRenderCallback, const RenderCallback& postRenderCallback, const LateLatchCallback& lateLatchCallback, const Timestamp& renderTimestamp, const bool recordTiming)
+{
+	ocean_assert(multiview_ && glesFramebuffers_.size() == 1);
+	ocean_assert(views_T_world != nullptr && projectionMatrices != nullptr);
+
+	Platform::Meta::Quest::OpenXR::GLESFramebuffer& framebuffer = glesFramebuffers_.front();
+
+	ocean_assert(GL_NO_ERROR == glGetError());
+
+	if (!framebuffer.bind())
+	{
+		// the framebuffer cound not be bound (e.g., because the swapchain could not be acquired without a timeout)
+		return;
+	}
+
+	glViewport(GLint(0), GLint(0), GLint(framebuffer.width()), GLint(framebuffer.height()));
+	ocean_assert(GL_NO_ERROR == glGetError());
+
+	const RGBAColor backgroundColor = glesStereoView.backgroundColor();
+
+	glClearColor(backgroundColor.red(), backgroundColor.green(), backgroundColor.blue(), backgroundColor.alpha());
+	ocean_assert(GL_NO_ERROR == glGetError());
+
+	// clears all layers of the texture arrays
+	glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+	ocean_assert(GL_NO_ERROR == glGetError());
+
+	if (preRenderCallback)
+	{
+		for (size_t eye = 0; eye < numberEyes_; ++eye)
+		{
+			preRenderCallback(eye, views_T_world[eye], projectionMatrices[eye], renderTimestamp);
+		}
+	}
+
+	applyCullingMode();
+
+	// the scene is shaded in the coordinate system of the left view, the projection matrices of both views are defined in relation to the left view
+	// leftClip_T_leftView = leftClip_T_leftView * leftView_T_world * world_T_leftView
+	// rightClip_T_leftView = rightClip_T_rightView * rightView_T_world * world_T_leftView
+
+	const auto updateMultiviewProjectionMatrices = [this, views_T_world, projectionMatrices]()
+	{
+		const HomogenousMatrix4 world_T_leftView(views_T_world[0].inverted());
+
+		for (size_t eye = 0; eye < numberEyes_; ++eye)
+		{
+			multiviewProjectionMatrices_[eye] = projectionMatrices[eye] * SquareMatrix4(views_T_world[eye] * world_T_leftView);
+		}
+	};
+
+	updateMultiviewProjectionMatrices();
+
+	multiviewActive_ = true;
+
+	setStereoType(ST_LEFT);
+
+	const HomogenousMatrix4& leftView_T_world = views_T_world[0];
+	const SquareMatrix4& leftProjectionMatrix = projectionMatrices[0];
+
+	const HighPerformanceTimer traversalTimer;
+
+	traverser_.clear();
+
+	if (viewCulling_)
+	{
+		traverser_.enableCulling(leftProjectionMatrix, multiviewProjectionMatrices_[1], framebuffer.height(), minimalFeatureSize_);
+	}
+
+	for (Scenes::const_iterator i = framebufferScenes.begin(); i != framebufferScenes.end(); ++i)
+	{
+		const SmartObjectRef<GLESScene> glesScene(*i);
+		ocean_assert(glesScene);
+
+		Lights lights;
+
+		if (glesScene->useHeadlight() && glesStereoView.useHeadlight() && glesStereoView.headlight())
+		{
+			lights.push_back(LightPair(glesStereoView.headlight(), HomogenousMatrix4(true)));
+		}
+
+		glesScene->addToTraverser(*this, leftProjectionMatrix, leftView_T_world, lights, traverser_);
+		ocean_assert(GL_NO_ERROR == glGetError());
+	}
+
+	if (lateLatchCallback && latchViews(glesStereoView, lateLatchCallback, 0, views_T_world))
+	{
+		// the shaders use the projection matrices in relation to the latched left view
+
+		updateMultiviewProjectionMatrices();
+	}
+
+	if (recordTiming)
+	{
+		frameTiming_.addTraversalDuration(traversalTimer.seconds());
+		frameTiming_.beginPass(0);
+	}
+
+	const HighPerformanceTimer submitTimer;
+
+	traverser_.render(*this, leftProjectionMatrix, leftView_T_world);
+
+	if (recordTiming)
+	{
+		frameTiming_.addSubmitDuration(submitTimer.seconds());
+		frameTiming_.endPass();
+	}
+
+	if (postRenderCallback)
+	{
+		for (size_t eye = 0; eye < numberEyes_; ++eye)
+		{
+			postRenderCallback(eye, views_T_world[eye], projectionMatrices[eye], renderTimestamp);
+		}
+	}
+
+	multiviewActive_ = false;
+
+	framebuffer.unbind();
+}
+
+bool GLESWindowFramebuffer::latchViews(const GLESStereoView& glesStereoView, const LateLatchCallback& lateLatchCallback, const size_t traversedEye, HomogenousMatrix4* views_T_world)
+{
+	ocean_assert(lateLatchCallback);
+	ocean_assert(traversedEye < numberEyes_ && views_T_world != nullptr);
+
+	HomogenousMatrix4 world_T_views[numberEyes_] =
+	{
+		views_T_world[0].inverted(),
+		views_T_world[1].inverted()
+	};
+
+	if (!lateLatchCallback(world_T_views, numberEyes_))
+	{
+		return false;
+	}
+
+	for (size_t eye = 0; eye < numberEyes_; ++eye)
+	{
+		if (!world_T_views[eye].isValid())
+		{
+			ocean_assert(false && "Invalid latched view!");
+			return false;
+		}
+	}
+
+	const HomogenousMatrix4 world_T_previousView(views_T_world[traversedEye].inverted());
+
+	for (size_t eye = 0; eye < numberEyes_; ++eye)
+	{
+		views_T_world[eye] = world_T_views[eye].inverted();
+	}
+
+	// the renderables have been gathered with the previous view, they are moved into the latched view without traversing the scene again
+	// latchedView_T_previousView = latchedView_T_world * world_T_previousView
+
+	traverser_.updateCamera(views_T_world[traversedEye] * world_T_previousView, glesStereoView.headlight());
+
+	return true;
+}
+
+void GLESWindowFramebuffer::applyCullingMode()
+{
+	if (cullingMode_ == PrimitiveAttribute::CULLING_DEFAULT)
+	{
+		glEnable(GL_CULL_FACE);
+		ocean_assert(GL_NO_ERROR == glGetError());
+
+		glCullFace(GL_BACK);
+		ocean_assert(GL_NO_ERROR == glGetError());
+	}
+	else
+	{
+		switch (cullingMode_)
+		{
+			case PrimitiveAttribute::CULLING_NONE:
+				glDisable(GL_CULL_FACE);
+				ocean_assert(GL_NO_ERROR == glGetError());
+				break;
+
+			case PrimitiveAttribute::CULLING_BACK:
+				glEnable(GL_CULL_FACE);
+				glCullFace(GL_BACK);
+				ocean_assert(GL_NO_ERROR == glGetError());
+				break;
+
+			case PrimitiveAttribute::CULLING_FRONT:
+				glEnable(GL_CULL_FACE);
+				glCullFace(GL_FRONT);
+				ocean_assert(GL_NO_ERROR == glGetError());
+				break;
+
+			case PrimitiveAttribute::CULLING_BOTH:
+				glEnable(GL_CULL_FACE);
+				glCullFace(GL_FRONT_AND_BACK);
+				ocean_assert(GL_NO_ERROR == glGetError());
+				break;
+
+			default:
+				ocean_assert(false && "Invalid parameter!");
+		}
+	}
+}
+
+GLESTraverser::Statistics GLESWindowFramebuffer::traverserStatistics() const
+{
+	// the traverser is used within the render thread only
+
+	return traverser_.statistics();
 }
 
 bool GLESWindowFramebuffer::initializeContext()
@@ -229,11 +449,33 @@ bool GLESWindowFramebuffer::initializeContext()
 
 	ocean_assert(glesFramebuffers_.empty());
 
-	glesFramebuffers_ = Platform::Meta::Quest::OpenXR::GLESFramebuffers(numberEyes_);
-
 	const unsigned int framebufferWidth = xrSession->width();
 	const unsigned int framebufferHeight = xrSession->height();
 
+	multiview_ = false;
+
+	if (config_.useMultiview)
+	{
+		// one framebuffer with one layer for each eye
+
+		glesFramebuffers_ = Platform::Meta::Quest::OpenXR::GLESFramebuffers(1);
+
+		if (glesFramebuffers_.front().initialize(*xrSession, GL_SRGB8_ALPHA8, framebufferWidth, framebufferHeight, 4u /*multisamples*/, config_.useStencilBuffer, (unsigned int)(numberEyes_)))
+		{
+			multiview_ = true;
+
+			setViewport(0u, 0u, framebufferWidth, framebufferHeight);
+
+			return true;
+		}
+
+		Log::warning() << "Multiview is not supported, rendering each eye individually";
+
+		glesFramebuffers_.clear();
+	}
+
+	glesFramebuffers_ = Platform::Meta::Quest::OpenXR::GLESFramebuffers(numberEyes_);
+
 	for (Platform::Meta::Quest::OpenXR::GLESFramebuffer& framebuffer : glesFramebuffers_)
 	{
 		if (!framebuffer.initialize(*xrSession, GL_SRGB8_ALPHA8, framebufferWidth, framebufferHeight, 4u /*multisamples*/, config_.useStencilBuffer))
@@ -250,6 +492,7 @@ bool GLESWindowFramebuffer::initializeContext()
 void GLESWindowFramebuffer::release()
 {
 	glesFramebuffers_.clear();
+	multiview_ = false;
 
 	GLESFramebuffer::release();
 
@@ -11,6 +11,7 @@
 #include "ocean/rendering/glescenegraph/GLESceneGraph.h"
 #include "ocean/rendering/glescenegraph/GLESEngine.h"
 #include "ocean/rendering/glescenegraph/GLESFramebuffer.h"
+#include "ocean/rendering/glescenegraph/GLESStereoView.h"
 #include "ocean/rendering/glescenegraph/GLESTraverser.h"
 
 #ifdef OCEAN_RENDERING_GLES_QUEST_PLATFORM_OPENXR
@@ -52,6 +53,16 @@ class OCEAN_RENDERING_GLES_EXPORT GLESWindowFramebuffer :
 		/// The number of framebuffers used.
 		static constexpr size_t numberEyes_ = 2;
 
+		/**
+		 * Definition of a callback function for late latching the views.
+		 * The callback is invoked once for each frame right before the draw calls are submitted, after the scene has been traversed with the views of the stereo view.<br>
+		 * This callback can be used to replace the views with a more recent prediction of the head pose for the same display time.<br>
+		 * First parameter (world_T_views): The transformations between the views and world, one for each eye, to be updated by the callback<br>
+		 * Second parameter (numberViews): The number of views, which is numberEyes_<br>
+		 * Return value: True, if the callback has updated the views; False, to keep the views
+		 */
+		using LateLatchCallback = Callback<bool, HomogenousMatrix4*, const size_t>;
+
 	public:
 
 		/**
@@ -67,6 +78,13 @@ class OCEAN_RENDERING_GLES_EXPORT GLESWindowFramebuffer :
 		 */
 		void render() override;
 
+		/**
+		 * Returns the draw call and state change statistics of the most recently rendered eye.
+		 * This function must be called from the render thread only, e.g., within the post render callback.
+		 * @see GLESFramebuffer::traverserStatistics().
+		 */
+		GLESTraverser::Statistics traverserStatistics() const override;
+
 		/**
 		 * Returns the width of an individual framebuffer.
 		 * @param eyeIndex The index of the eye for which the width will be returned, with range [0, numberEyes_ - 1]
@@ -95,6 +113,26 @@ class OCEAN_RENDERING_GLES_EXPORT GLESWindowFramebuffer :
 		 */
 		inline size_t textureSwapChainIndex(const size_t eyeIndex) const;
 
+		/**
+		 * Returns the index of the layer within the swap chain's texture array for the individual eyes/framebuffers.
+		 * @param eyeIndex The index of the eye for which the layer index will be returned, with range [0, numberEyes_ - 1]
+		 * @return The requested layer index, 0 if both eyes are not rendered with single-pass multiview
+		 */
+		inline uint32_t imageArrayIndex(const size_t eyeIndex) const;
+
+		/**
+		 * Returns whether both eyes are rendered in one pass into a multiview framebuffer.
+		 * @return True, if so
+		 */
+		inline bool isMultiview() const;
+
+		/**
+		 * Sets an optional callback function for late latching the views.
+		 * The callback is invoked from the render thread, the composition layer of the frame must use the latched views.
+		 * @param lateLatchCallback The callback function to be set, an invalid object to remove a previously registered callback
+		 */
+		inline void setLateLatchCallback(const LateLatchCallback& lateLatchCallback);
+
 	protected:
 
 		/**
@@ -118,11 +156,43 @@ class OCEAN_RENDERING_GLES_EXPORT GLESWindowFramebuffer :
 		 */
 		void release() override;
 
+		/**
+		 * Renders both eyes in one pass into the multiview framebuffer.
+		 * All shading happens in the coordinate system of the left eye, the shaders select the projection matrix of the individual eye.
+		 * @param glesStereoView The stereo view to be used, must be valid
+		 * @param views_T_world The transformations between world and the views, one for each eye
+		 * @param projectionMatrices The projection matrices of the views, one for each eye
+		 * @param preRenderCallback The pre render callback, invoked for each eye
+		 * @param postRenderCallback The post render callback, invoked for each eye
+		 * @param lateLatchCallback The late latch callback, invalid if the views are not latched
+		 * @param renderTimestamp The timestamp of the frame to render, must be valid
+		 * @param recordTiming True, if the frame timing of the frame is recorded
+		 */
+		void renderMultiview(const GLESStereoView& glesStereoView, HomogenousMatrix4* views_T_world, const SquareMatrix4* projectionMatrices, const RenderCallback& preRenderCallback, const RenderCallback& postRenderCallback, const LateLatchCallback& lateLatchCallback, const Timestamp& renderTimestamp, const bool recordTiming);
+
+		/**
+		 * Latches the views right before the draw calls are submitted and moves the gathered renderables into the latched view.
+		 * @param glesStereoView The stereo view to be used, must be valid
+		 * @param lateLatchCallback The late latch callback, must be valid
+		 * @param traversedEye The index of the eye for which the renderables have been gathered, with range [0, numberEyes_ - 1]
+		 * @param views_T_world The transformations between world and the views, one for each eye, will be updated if the callback provides new views
+		 * @return True, if the views have been latched
+		 */
+		bool latchViews(const GLESStereoView& glesStereoView, const LateLatchCallback& lateLatchCallback, const size_t traversedEye, HomogenousMatrix4* views_T_world);
+
+		/**
+		 * Applies the face culling mode of this framebuffer to the current OpenGL ES state.
+		 */
+		void applyCullingMode();
+
 	protected:
 
 		/// The actual implementation of the Quest specific framebuffer(s).
 		Platform::Meta::Quest::OpenXR::GLESFramebuffers glesFramebuffers_;
 
+		/// True, if both eyes are rendered in one pass into one multiview framebuffer; False, if each eye has an individual framebuffer.
+		bool multiview_ = false;
+
 		/// The index of the next eye to be rendered first, with range [0, 1]
 		size_t nextRenderFirstEyeIndex_ = 0;
 
@@ -134,15 +204,21 @@ class OCEAN_RENDERING_GLES_EXPORT GLESWindowFramebuffer :
 
 		/// The configuration to be used.
 		Framebuffer::FramebufferConfig config_;
+
+		/// Optional callback function for late latching the views.
+		LateLatchCallback lateLatchCallback_;
 };
 
 inline unsigned int GLESWindowFramebuffer::width(const size_t eyeIndex) const
 {
-	ocean_assert(eyeIndex < numberEyes_ && eyeIndex < glesFramebuffers_.size());
+	ocean_assert(eyeIndex < numberEyes_);
 
-	if (eyeIndex < glesFramebuffers_.size())
+	const size_t framebufferIndex = multiview_ ? 0 : eyeIndex;
+	ocean_assert(framebufferIndex < glesFramebuffers_.size());
+
+	if (framebufferIndex < glesFramebuffers_.size())
 	{
-		return glesFramebuffers_[eyeIndex].width();
+		return glesFramebuffers_[framebufferIndex].width();
 	}
 
 	ocean_assert(false && "Invalid eye index!");
@@ -151,11 +227,14 @@ inline unsigned int GLESWindowFramebuffer::width(const size_t eyeIndex) const
 
 inline unsigned int GLESWindowFramebuffer::height(const size_t eyeIndex) const
 {
-	ocean_assert(eyeIndex < numberEyes_ && eyeIndex < glesFramebuffers_.size());
+	ocean_assert(eyeIndex < numberEyes_);
+
+	const size_t framebufferIndex = multiview_ ? 0 : eyeIndex;
+	ocean_assert(framebufferIndex < glesFramebuffers_.size());
 
-	if (eyeIndex < glesFramebuffers_.size())
+	if (framebufferIndex < glesFramebuffers_.size())
 	{
-		return glesFramebuffers_[eyeIndex].height();
+		return glesFramebuffers_[framebufferIndex].height();
 	}
 
 	ocean_assert(false && "Invalid eye index!");
@@ -164,11 +243,14 @@ inline unsigned int GLESWindowFramebuffer::height(const size_t eyeIndex) const
 
 inline XrSwapchain GLESWindowFramebuffer::xrSwapchain(const size_t eyeIndex) const
 {
-	ocean_assert(eyeIndex < numberEyes_ && eyeIndex < glesFramebuffers_.size());
+	ocean_assert(eyeIndex < numberEyes_);
+
+	const size_t framebufferIndex = multiview_ ? 0 : eyeIndex;
+	ocean_assert(framebufferIndex < glesFramebuffers_.size());
 
-	if (eyeIndex < glesFramebuffers_.size())
+	if (framebufferIndex < glesFramebuffers_.size())
 	{
-		return glesFramebuffers_[eyeIndex].xrSwapchain();
+		return glesFramebuffers_[framebufferIndex].xrSwapchain();
 	}
 
 	ocean_assert(false && "Invalid eye index!");
@@ -177,17 +259,39 @@ inline XrSwapchain GLESWindowFramebuffer::xrSwapchain(const size_t eyeIndex) con
 
 inline size_t GLESWindowFramebuffer::textureSwapChainIndex(const size_t eyeIndex) const
 {
-	ocean_assert(eyeIndex < numberEyes_ && eyeIndex < glesFramebuffers_.size());
+	ocean_assert(eyeIndex < numberEyes_);
 
-	if (eyeIndex < glesFramebuffers_.size())
+	const size_t framebufferIndex = multiview_ ? 0 : eyeIndex;
+	ocean_assert(framebufferIndex < glesFramebuffers_.size());
+
+	if (framebufferIndex < glesFramebuffers_.size())
 	{
-		return glesFramebuffers_[eyeIndex].textureSwapChainIndex();
+		return glesFramebuffers_[framebufferIndex].textureSwapChainIndex();
 	}
 
 	ocean_assert(false && "Invalid eye index!");
 	return 0;
 }
 
+inline uint32_t GLESWindowFramebuffer::imageArrayIndex(const size_t eyeIndex) const
+{
+	ocean_assert(eyeIndex < numberEyes_);
+
+	return multiview_ ? uint32_t(eyeIndex) : 0u;
+}
+
+inline bool GLESWindowFramebuffer::isMultiview() const
+{
+	return multiview_;
+}
+
+inline void GLESWindowFramebuffer::setLateLatchCallback(const LateLatchCallback& lateLatchCallback)
+{
+	const ScopedLock scopedLock(objectLock);
+
+	lateLatchCallback_ = lateLatchCallback;
+}
+
 }
 
 }
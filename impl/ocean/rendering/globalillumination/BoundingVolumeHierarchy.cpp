@@ -0,0 +1,210 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "ocean/rendering/globalillumination/BoundingVolumeHierarchy.h"
+
+#include <algorithm>
+
+namespace Ocean
+{
+
+namespace Rendering
+{
+
+namespace GlobalIllumination
+{
+
+BoundingVolumeHierarchy::PrecomputedRay::PrecomputedRay(const Line3& ray) :
+	point_(ray.point())
+{
+	ocean_assert(ray.isValid());
+
+	const Vector3& direction = ray.direction();
+
+	// a zero component results in a huge inverse, so that the slab of this component either covers the entire ray or nothing of the ray
+
+	for (unsigned int n = 0u; n < 3u; ++n)
+	{
+		inverseDirection_[n] = direction[n] != 0 ? Scalar(1) / direction[n] : Numeric::maxValue();
+	}
+}
+
+void BoundingVolumeHierarchy::build(const std::vector<BoundingBox>& boundingBoxes, const unsigned int maximalPrimitivesPerLeaf)
+{
+	ocean_assert(maximalPrimitivesPerLeaf >= 1u);
+
+	nodes_.clear();
+	primitiveIndices_.clear();
+
+	if (boundingBoxes.empty())
+	{
+		return;
+	}
+
+	Vectors3 centers;
+	centers.reserve(boundingBoxes.size());
+
+	primitiveIndices_.reserve(boundingBoxes.size());
+
+	for (size_t n = 0; n < boundingBoxes.size(); ++n)
+	{
+		ocean_assert(boundingBoxes[n].isValid());
+
+		centers.emplace_back(boundingBoxes[n].center());
+		primitiveIndices_.emplace_back(Index32(n));
+	}
+
+	nodes_.reserve(boundingBoxes.size() * 2);
+
+	buildNode(boundingBoxes, centers, 0u, (unsigned int)(boundingBoxes.size()), std::max(1u, maximalPrimitivesPerLeaf), 0u);
+}
+
+void BoundingVolumeHierarchy::buildNode(const std::vector<BoundingBox>& boundingBoxes, const Vectors3& centers, const unsigned int firstPrimitive, const unsigned int numberPrimitives, const unsigned int maximalPrimitivesPerLeaf, const unsigned int depth)
+{
+	ocean_assert(numberPrimitives >= 1u);
+	ocean_assert(size_t(firstPrimitive) + size_t(numberPrimitives) <= primitiveIndices_.size());
+
+	// we must not keep a reference to the node, as the vector of nodes is extended by the child nodes
+
+	const size_t nodeIndex = nodes_.size();
+	nodes_.emplace_back();
+
+	BoundingBox nodeBoundingBox;
+	BoundingBox centerBoundingBox;
+
+	for (unsigned int n = firstPrimitive; n < firstPrimitive + numberPrimitives; ++n)
+	{
+		const Index32 primitiveIndex = primitiveIndices_[n];
+
+		nodeBoundingBox += boundingBoxes[primitiveIndex];
+		centerBoundingBox += centers[primitiveIndex];
+	}
+
+	nodes_[nodeIndex].boundingBox_ = nodeBoundingBox;
+
+	const Scalar nodeArea = surfaceArea(nodeBoundingBox);
+
+	const Vector3 centerDimension(centerBoundingBox.dimension());
+
+	unsigned int splitAxis = 0u;
+
+	if (centerDimension.y() > centerDimension[splitAxis])
+	{
+		splitAxis = 1u;
+	}
+
+	if (centerDimension.z() > centerDimension[splitAxis])
+	{
+		splitAxis = 2u;
+	}
+
+	const Scalar splitExtent = centerDimension[splitAxis];
+
+	if (numberPrimitives == 1u || depth >= maximalDepth_ || nodeArea <= Numeric::eps() || splitExtent <= Numeric::eps())
+	{
+		nodes_[nodeIndex].index_ = Index32(firstPrimitive);
+		nodes_[nodeIndex].numberPrimitives_ = Index32(numberPrimitives);
+		return;
+	}
+
+	// we distribute the primitives into bins along the split axis and determine the split with the smallest surface area heuristic
+
+	const Scalar splitLower = centerBoundingBox.lower()[splitAxis];
+	const Scalar binFactor = Scalar(numberBins_) / splitExtent;
+
+	const auto binIndex = [&](const Index32 primitiveIndex)
+	{
+		return std::min(numberBins_ - 1u, (unsigned int)((centers[primitiveIndex][splitAxis] - splitLower) * binFactor));
+	};
+
+	BoundingBox binBoundingBoxes[numberBins_];
+	unsigned int binSizes[numberBins_] = {};
+
+	for (unsigned int n = firstPrimitive; n < firstPrimitive + numberPrimitives; ++n)
+	{
+		const Index32 primitiveIndex = primitiveIndices_[n];
+		const unsigned int bin = binIndex(primitiveIndex);
+
+		binBoundingBoxes[bin] += boundingBoxes[primitiveIndex];
+		++binSizes[bin];
+	}
+
+	Scalar rightAreas[numberBins_] = {};
+	unsigned int rightSizes[numberBins_] = {};
+
+	BoundingBox rightBoundingBox;
+	unsigned int rightSize = 0u;
+
+	for (unsigned int bin = numberBins_ - 1u; bin >= 1u; --bin)
+	{
+		if (binSizes[bin] != 0u)
+		{
+			rightBoundingBox += binBoundingBoxes[bin];
+			rightSize += binSizes[bin];
+		}
+
+		rightAreas[bin] = surfaceArea(rightBoundingBox);
+		rightSizes[bin] = rightSize;
+	}
+
+	BoundingBox leftBoundingBox;
+	unsigned int leftSize = 0u;
+
+	Scalar bestCost = Numeric::maxValue();
+	unsigned int bestBin = numberBins_;
+
+	for (unsigned int bin = 0u; bin < numberBins_ - 1u; ++bin)
+	{
+		if (binSizes[bin] != 0u)
+		{
+			leftBoundingBox += binBoundingBoxes[bin];
+			leftSize += binSizes[bin];
+		}
+
+		if (leftSize == 0u || rightSizes[bin + 1u] == 0u)
+		{
+			continue;
+		}
+
+		const Scalar cost = surfaceArea(leftBoundingBox) * Scalar(leftSize) + rightAreas[bin + 1u] * Scalar(rightSizes[bin + 1u]);
+
+		if (cost < bestCost)
+		{
+			bestCost = cost;
+			bestBin = bin;
+		}
+	}
+
+	// the cost of a split is the traversal of the inner node plus the expected intersection tests of both children, the cost of a leaf node is one intersection test for each primitive
+
+	const bool splitIsCheaper = bestBin < numberBins_ && Scalar(1) + bestCost / nodeArea < Scalar(numberPrimitives);
+
+	if (bestBin == numberBins_ || (numberPrimitives <= maximalPrimitivesPerLeaf && !splitIsCheaper))
+	{
+		nodes_[nodeIndex].index_ = Index32(firstPrimitive);
+		nodes_[nodeIndex].numberPrimitives_ = Index32(numberPrimitives);
+		return;
+	}
+
+	const Indices32::iterator firstIterator = primitiveIndices_.begin() + firstPrimitive;
+	const Indices32::iterator middleIterator = std::partition(firstIterator, firstIterator + numberPrimitives, [&](const Index32 primitiveIndex) { return binIndex(primitiveIndex) <= bestBin; });
+
+	const unsigned int numberLeftPrimitives = (unsigned int)(middleIterator - firstIterator);
+	ocean_assert(numberLeftPrimitives != 0u && numberLeftPrimitives < numberPrimitives);
+
+	buildNode(boundingBoxes, centers, firstPrimitive, numberLeftPrimitives, maximalPrimitivesPerLeaf, depth + 1u);
+
+	nodes_[nodeIndex].index_ = Index32(nodes_.size());
+
+	buildNode(boundingBoxes, centers, firstPrimitive + numberLeftPrimitives, numberPrimitives - numberLeftPrimitives, maximalPrimitivesPerLeaf, depth + 1u);
+}
+
+}
+
+}
+
+}
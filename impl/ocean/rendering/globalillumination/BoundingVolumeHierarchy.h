@@ -0,0 +1,349 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#ifndef META_OCEAN_RENDERING_GI_BOUNDING_VOLUME_HIERARCHY_H
+#define META_OCEAN_RENDERING_GI_BOUNDING_VOLUME_HIERARCHY_H
+
+#include "ocean/rendering/globalillumination/GlobalIllumination.h"
+
+#include "ocean/math/BoundingBox.h"
+#include "ocean/math/Line3.h"
+
+namespace Ocean
+{
+
+namespace Rendering
+{
+
+namespace GlobalIllumination
+{
+
+/**
+ * This class implements a bounding volume hierarchy (BVH) of axis aligned bounding boxes allowing to reduce the number of ray/primitive tests.
+ * The hierarchy is built with the surface area heuristic (SAH) and is stored in one continuous array of nodes, the first child of an inner node follows the node directly.<br>
+ * The hierarchy does not store the primitives, it stores the indices of the primitives only (e.g., of triangles or of tracing objects).
+ * @ingroup renderinggi
+ */
+class OCEAN_RENDERING_GI_EXPORT BoundingVolumeHierarchy
+{
+	protected:
+
+		/**
+		 * This class implements one node of the hierarchy.
+		 */
+		class Node
+		{
+			public:
+
+				/**
+				 * Returns whether this node is a leaf node.
+				 * @return True, if so
+				 */
+				inline bool isLeaf() const;
+
+			public:
+
+				/// The bounding box of all primitives of this node.
+				BoundingBox boundingBox_;
+
+				/// The index of the first primitive index of a leaf node, or the index of the second child node of an inner node.
+				Index32 index_ = 0u;
+
+				/// The number of primitives of a leaf node, 0 for an inner node.
+				Index32 numberPrimitives_ = 0u;
+		};
+
+		/**
+		 * Definition of a vector holding nodes.
+		 */
+		using Nodes = std::vector<Node>;
+
+		/**
+		 * This class holds a ray together with precomputed values for fast intersection tests with bounding boxes.
+		 */
+		class PrecomputedRay
+		{
+			public:
+
+				/**
+				 * Creates a new ray object.
+				 * @param ray The ray, must be valid
+				 */
+				explicit PrecomputedRay(const Line3& ray);
+
+				/**
+				 * Determines the entry distance of this ray into a bounding box (slab test).
+				 * @param boundingBox The bounding box to test, must be valid
+				 * @param maximalDistance The maximal distance of intersections of interest, with range [0, infinity)
+				 * @param entryDistance The resulting distance at which the ray enters the box, negative if the ray starts inside the box
+				 * @return True, if the ray intersects the box before the maximal distance
+				 */
+				inline bool intersects(const BoundingBox& boundingBox, const Scalar maximalDistance, Scalar& entryDistance) const;
+
+			protected:
+
+				/// The start point of the ray.
+				Vector3 point_;
+
+				/// The component-wise inverse of the ray's direction.
+				Vector3 inverseDirection_;
+		};
+
+		/// The maximal depth of the hierarchy.
+		static constexpr unsigned int maximalDepth_ = 60u;
+
+		/// The number of bins used to determine the best split with the surface area heuristic.
+		static constexpr unsigned int numberBins_ = 16u;
+
+	public:
+
+		/**
+		 * Creates an empty hierarchy.
+		 */
+		BoundingVolumeHierarchy() = default;
+
+		/**
+		 * Builds the hierarchy for a set of primitives.
+		 * @param boundingBoxes The bounding boxes of the primitives, one for each primitive, all boxes must be valid
+		 * @param maximalPrimitivesPerLeaf The maximal number of primitives in a leaf node if the surface area heuristic does not favor a further split, with range [1, infinity)
+		 */
+		void build(const std::vector<BoundingBox>& boundingBoxes, const unsigned int maximalPrimitivesPerLeaf = 4u);
+
+		/**
+		 * Returns the bounding box of all primitives of this hierarchy.
+		 * @return The hierarchy's bounding box, invalid if the hierarchy is empty
+		 */
+		inline BoundingBox boundingBox() const;
+
+		/**
+		 * Visits all primitives whose bounding boxes are intersected by a ray, nodes closer to the start point of the ray are visited first.
+		 * The functor has the signature 'bool functor(const Index32 primitiveIndex, Scalar& maximalDistance)', it can reduce the maximal distance (e.g., when a closer intersection has been found) and returns True to stop the traversal (e.g., for shadow rays).
+		 * @param ray The ray for which the primitives will be visited, must be valid
+		 * @param maximalDistance The maximal distance of intersections of interest, with range [0, infinity)
+		 * @param functor The functor which will be called for each primitive
+		 * @return True, if the functor stopped the traversal
+		 * @tparam TFunctor The data type of the functor
+		 */
+		template <typename TFunctor>
+		bool traverse(const Line3& ray, Scalar maximalDistance, const TFunctor& functor) const;
+
+		/**
+		 * Returns whether this hierarchy is empty.
+		 * @return True, if so
+		 */
+		inline bool isEmpty() const;
+
+	protected:
+
+		/**
+		 * Builds a node of the hierarchy recursively.
+		 * @param boundingBoxes The bounding boxes of all primitives
+		 * @param centers The centers of the bounding boxes of all primitives
+		 * @param firstPrimitive The index of the first primitive index of the new node, with range [0, primitiveIndices_.size())
+		 * @param numberPrimitives The number of primitives of the new node, with range [1, primitiveIndices_.size() - firstPrimitive]
+		 * @param maximalPrimitivesPerLeaf The maximal number of primitives in a leaf node if the surface area heuristic does not favor a further split
+		 * @param depth The depth of the new node, with range [0, maximalDepth_]
+		 */
+		void buildNode(const std::vector<BoundingBox>& boundingBoxes, const Vectors3& centers, const unsigned int firstPrimitive, const unsigned int numberPrimitives, const unsigned int maximalPrimitivesPerLeaf, const unsigned int depth);
+
+		/**
+		 * Returns the surface area of a bounding box.
+		 * @param boundingBox The bounding box, can be invalid
+		 * @return The box's surface area, 0 for an invalid box
+		 */
+		static inline Scalar surfaceArea(const BoundingBox& boundingBox);
+
+	protected:
+
+		/// The nodes of this hierarchy, the first node is the root node.
+		Nodes nodes_;
+
+		/// The indices of the primitives, the primitives of each leaf node are stored continuously.
+		Indices32 primitiveIndices_;
+};
+
+inline bool BoundingVolumeHierarchy::Node::isLeaf() const
+{
+	return numberPrimitives_ != 0u;
+}
+
+inline bool BoundingVolumeHierarchy::PrecomputedRay::intersects(const BoundingBox& boundingBox, const Scalar maximalDistance, Scalar& entryDistance) const
+{
+	ocean_assert(boundingBox.isValid());
+
+	Scalar tNear = Numeric::minValue();
+	Scalar tFar = maximalDistance;
+
+	for (unsigned int n = 0u; n < 3u; ++n)
+	{
+		Scalar t0 = (boundingBox.lower()[n] - point_[n]) * inverseDirection_[n];
+		Scalar t1 = (boundingBox.higher()[n] - point_[n]) * inverseDirection_[n];
+
+		if (t0 > t1)
+		{
+			std::swap(t0, t1);
+		}
+
+		if (t0 > tNear)
+		{
+			tNear = t0;
+		}
+
+		if (t1 < tFar)
+		{
+			tFar = t1;
+		}
+
+		if (tNear > tFar)
+		{
+			return false;
+		}
+	}
+
+	if (tFar < 0)
+	{
+		return false;
+	}
+
+	entryDistance = tNear;
+	return true;
+}
+
+inline BoundingBox BoundingVolumeHierarchy::boundingBox() const
+{
+	if (nodes_.empty())
+	{
+		return BoundingBox();
+	}
+
+	return nodes_.front().boundingBox_;
+}
+
+template <typename TFunctor>
+bool BoundingVolumeHierarchy::traverse(const Line3& ray, Scalar maximalDistance, const TFunctor& functor) const
+{
+	ocean_assert(ray.isValid());
+
+	if (nodes_.empty())
+	{
+		return false;
+	}
+
+	const PrecomputedRay precomputedRay(ray);
+
+	Scalar entryDistance = 0;
+	if (!precomputedRay.intersects(nodes_.front().boundingBox_, maximalDistance, entryDistance))
+	{
+		return false;
+	}
+
+	// the stack holds the node indices together with their entry distances, one pending node for each level is sufficient
+
+	Index32 stackNodes[maximalDepth_ + 2u];
+	Scalar stackDistances[maximalDepth_ + 2u];
+	unsigned int stackSize = 0u;
+
+	stackNodes[stackSize] = 0u;
+	stackDistances[stackSize] = entryDistance;
+	++stackSize;
+
+	while (stackSize != 0u)
+	{
+		--stackSize;
+
+		if (stackDistances[stackSize] > maximalDistance)
+		{
+			// a closer intersection has been found in the meantime
+			continue;
+		}
+
+		const Node& node = nodes_[stackNodes[stackSize]];
+
+		if (node.isLeaf())
+		{
+			for (Index32 n = node.index_; n < node.index_ + node.numberPrimitives_; ++n)
+			{
+				if (functor(primitiveIndices_[n], maximalDistance))
+				{
+					return true;
+				}
+			}
+
+			continue;
+		}
+
+		const Index32 firstChild = Index32(&node - nodes_.data()) + 1u;
+		const Index32 secondChild = node.index_;
+
+		Scalar firstDistance = 0;
+		Scalar secondDistance = 0;
+
+		const bool firstHit = precomputedRay.intersects(nodes_[firstChild].boundingBox_, maximalDistance, firstDistance);
+		const bool secondHit = precomputedRay.intersects(nodes_[secondChild].boundingBox_, maximalDistance, secondDistance);
+
+		ocean_assert(stackSize + 2u <= maximalDepth_ + 2u);
+
+		if (firstHit && secondHit)
+		{
+			// the closer child is visited first, so it is pushed last
+
+			if (firstDistance <= secondDistance)
+			{
+				stackNodes[stackSize] = secondChild;
+				stackDistances[stackSize++] = secondDistance;
+				stackNodes[stackSize] = firstChild;
+				stackDistances[stackSize++] = firstDistance;
+			}
+			else
+			{
+				stackNodes[stackSize] = firstChild;
+				stackDistances[stackSize++] = firstDistance;
+				stackNodes[stackSize] = secondChild;
+				stackDistances[stackSize++] = secondDistance;
+			}
+		}
+		else if (firstHit)
+		{
+			stackNodes[stackSize] = firstChild;
+			stackDistances[stackSize++] = firstDistance;
+		}
+		else if (secondHit)
+		{
+			stackNodes[stackSize] = secondChild;
+			stackDistances[stackSize++] = secondDistance;
+		}
+	}
+
+	return false;
+}
+
+inline bool BoundingVolumeHierarchy::isEmpty() const
+{
+	return nodes_.empty();
+}
+
+inline Scalar BoundingVolumeHierarchy::surfaceArea(const BoundingBox& boundingBox)
+{
+	if (!boundingBox.isValid())
+	{
+		return 0;
+	}
+
+	const Scalar xDimension = boundingBox.xDimension();
+	const Scalar yDimension = boundingBox.yDimension();
+	const Scalar zDimension = boundingBox.zDimension();
+
+	return Scalar(2) * (xDimension * yDimension + yDimension * zDimension + zDimension * xDimension);
+}
+
+}
+
+}
+
+}
+
+#endif // META_OCEAN_RENDERING_GI_BOUNDING_VOLUME_HIERARCHY_H
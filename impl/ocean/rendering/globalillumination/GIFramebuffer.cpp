@@ -232,13 +232,17 @@ void GIFramebuffer::render()
 		scene->buildTracing(tracingGroup, HomogenousMatrix4(true), lightSources);
 	}
 
+	tracingGroup.buildHierarchy();
+
+	std::atomic<unsigned int> nextTile(0u);
+
 	if (scopedWorker)
 	{
-		scopedWorker()->executeFunction(Worker::Function::create(*this, &GIFramebuffer::renderSubset, &lightSources, (const TracingGroup*)&tracingGroup, scopedWorker()->threads(), 0u, 0u), 0u, scopedWorker()->threads(), 3u, 4u, 1u);
+		scopedWorker()->executeFunction(Worker::Function::create(*this, &GIFramebuffer::renderTiles, &lightSources, (const TracingGroup*)&tracingGroup, &nextTile, 0u, 0u), 0u, scopedWorker()->threads(), 3u, 4u, 1u);
 	}
 	else
 	{
-		GIFramebuffer::renderSubset(&lightSources, &tracingGroup, 1u, 0u, 1u);
+		renderTiles(&lightSources, &tracingGroup, &nextTile, 0u, 1u);
 	}
 
 	if (antialiasingEnabled_ && frame_.width() >= 3u && frame_.height() >= 3u)
@@ -251,58 +255,67 @@ void GIFramebuffer::render()
 
 		CV::FrameFilterSobelMagnitude::Comfort::filterHorizontalVerticalTo1Response(frame_, sobelFrame_, scopedWorker());
 
+		nextTile = 0u;
+
 		if (scopedWorker)
 		{
-			scopedWorker()->executeFunction(Worker::Function::create(*this, &GIFramebuffer::renderAntialiasedSubset, sobelFrame_.constdata<uint8_t>(), sobelFrame_.paddingElements(), &lightSources, (const TracingGroup*)(&tracingGroup), scopedWorker()->threads(), 0u, 0u), 0u, scopedWorker()->threads(), 5u, 6u, 1u);
+			scopedWorker()->executeFunction(Worker::Function::create(*this, &GIFramebuffer::renderAntialiasedTiles, sobelFrame_.constdata<uint8_t>(), sobelFrame_.paddingElements(), &lightSources, (const TracingGroup*)(&tracingGroup), &nextTile, 0u, 0u), 0u, scopedWorker()->threads(), 5u, 6u, 1u);
 		}
 		else
 		{
-			renderAntialiasedSubset(sobelFrame_.constdata<uint8_t>(), sobelFrame_.paddingElements(), &lightSources, &tracingGroup, 1u, 0u, 1u);
+			renderAntialiasedTiles(sobelFrame_.constdata<uint8_t>(), sobelFrame_.paddingElements(), &lightSources, &tracingGroup, &nextTile, 0u, 1u);
 		}
 	}
 }
 
-void GIFramebuffer::renderSubset(LightSources* lightSources, const TracingGroup* group, const unsigned int threads, const unsigned int firstThreadIndex, const unsigned int mustBeOne)
+void GIFramebuffer::renderTiles(LightSources* lightSources, const TracingGroup* group, std::atomic<unsigned int>* nextTile, const unsigned int /*firstThread*/, const unsigned int numberThreads)
 {
 	ocean_assert(lightSources != nullptr);
 	ocean_assert(group != nullptr);
-	ocean_assert_and_suppress_unused(mustBeOne == 1u, mustBeOne);
+	ocean_assert(nextTile != nullptr);
+	ocean_assert_and_suppress_unused(numberThreads == 1u, numberThreads);
 
 	const View* view = &*framebufferView;
 
 	ocean_assert(frame_.isValid());
 
-	for (unsigned int n = firstThreadIndex; n < frame_.pixels(); n += threads)
-	{
-		const unsigned int y = n / frame_.width();
-		const unsigned int x = n % frame_.width();
+	unsigned int left, top, right, bottom;
 
-		const Line3 ray = view->viewingRay(Scalar(x), Scalar(y), frame_.width(), frame_.height());
+	while (tileArea(nextTile->fetch_add(1u, std::memory_order_relaxed), left, top, right, bottom))
+	{
+		for (unsigned int y = top; y < bottom; ++y)
+		{
+			for (unsigned int x = left; x < right; ++x)
+			{
+				const Line3 ray = view->viewingRay(Scalar(x), Scalar(y), frame_.width(), frame_.height());
 
-		RGBAColor color;
+				RGBAColor color;
 
-		if (renderRay(view->transformation().translation(), ray, *group, *lightSources, color))
-		{
-			const float redValue = minmax(0.0f, color.red(), 1.0f);
-			const float greenValue = minmax(0.0f, color.green(), 1.0f);
-			const float blueValue = minmax(0.0f, color.blue(), 1.0f);
+				if (renderRay(view->transformation().translation(), ray, *group, *lightSources, color))
+				{
+					const float redValue = minmax(0.0f, color.red(), 1.0f);
+					const float greenValue = minmax(0.0f, color.green(), 1.0f);
+					const float blueValue = minmax(0.0f, color.blue(), 1.0f);
 
-			uint8_t* const pixel = frame_.pixel<uint8_t>(x, y);
+					uint8_t* const pixel = frame_.pixel<uint8_t>(x, y);
 
-			pixel[0] = uint8_t(redValue * 255.0f + 0.5f);
-			pixel[1] = uint8_t(greenValue * 255.0f + 0.5f);
-			pixel[2] = uint8_t(blueValue * 255.0f + 0.5f);
+					pixel[0] = uint8_t(redValue * 255.0f + 0.5f);
+					pixel[1] = uint8_t(greenValue * 255.0f + 0.5f);
+					pixel[2] = uint8_t(blueValue * 255.0f + 0.5f);
+				}
+			}
 		}
 	}
 }
 
-void GIFramebuffer::renderAntialiasedSubset(const uint8_t* sobelResponse, const unsigned int sobelResponsePaddingElements, LightSources* lightSources, const TracingGroup* group, const unsigned int threads, const unsigned int firstThreadIndex, const unsigned int mustBeOne)
+void GIFramebuffer::renderAntialiasedTiles(const uint8_t* sobelResponse, const unsigned int sobelResponsePaddingElements, LightSources* lightSources, const TracingGroup* group, std::atomic<unsigned int>* nextTile, const unsigned int /*firstThread*/, const unsigned int numberThreads)
 {
 	ocean_assert(sobelResponse != nullptr);
 
 	ocean_assert(lightSources != nullptr);
 	ocean_assert(group != nullptr);
-	ocean_assert_and_suppress_unused(mustBeOne == 1u, mustBeOne);
+	ocean_assert(nextTile != nullptr);
+	ocean_assert_and_suppress_unused(numberThreads == 1u, numberThreads);
 
 	const unsigned int sobelResponseStrideElements = frame_.width() + sobelResponsePaddingElements;
 
@@ -310,75 +323,103 @@ void GIFramebuffer::renderAntialiasedSubset(const uint8_t* sobelResponse, const
 
 	ocean_assert(frame_.isValid());
 
-	for (unsigned int n = firstThreadIndex; n < frame_.pixels(); n += threads)
+	unsigned int left, top, right, bottom;
+
+	while (tileArea(nextTile->fetch_add(1u, std::memory_order_relaxed), left, top, right, bottom))
 	{
-		const unsigned int y = n / frame_.width();
-		const unsigned int x = n % frame_.width();
+		for (unsigned int y = top; y < bottom; ++y)
+		{
+			for (unsigned int x = left; x < right; ++x)
+			{
+				Scalar samplingFactor = 1;
 
-		RGBAColor color(0.0f, 0.0f, 0.0f);
-		Scalar totalFactor = 0;
+				const uint8_t sobelResponsePixel = sobelResponse[y * sobelResponseStrideElements + x];
 
-		Scalar samplingFactor = 1;
+				if (sobelResponsePixel >= 70)
+				{
+					samplingFactor = Scalar(0.1);
+				}
+				else if (sobelResponsePixel >= 50)
+				{
+					samplingFactor = Scalar(0.2);
+				}
+				else if (sobelResponsePixel >= 40)
+				{
+					samplingFactor = Scalar(0.25);
+				}
+				else if (sobelResponsePixel >= 25)
+				{
+					samplingFactor = Scalar(0.5);
+				}
 
-		const uint8_t sobelResponsePixel = sobelResponse[y * sobelResponseStrideElements + x];
+				if (samplingFactor == 1)
+				{
+					continue;
+				}
 
-		if (sobelResponsePixel >= 70)
-		{
-			samplingFactor = Scalar(0.1);
-		}
-		else if (sobelResponsePixel >= 50)
-		{
-			samplingFactor = Scalar(0.2);
-		}
-		else if (sobelResponsePixel >= 40)
-		{
-			samplingFactor = Scalar(0.25);
-		}
-		else if (sobelResponsePixel >= 25)
-		{
-			samplingFactor = Scalar(0.5);
-		}
+				RGBAColor color(0.0f, 0.0f, 0.0f);
+				Scalar totalFactor = 0;
 
-		if (samplingFactor != 1)
-		{
-			for (Scalar xx = Scalar(-0.5); xx <= Scalar(0.501); xx += samplingFactor)
-			{
-				for (Scalar yy = Scalar(-0.5); yy <= Scalar(0.501); yy += samplingFactor)
+				for (Scalar xx = Scalar(-0.5); xx <= Scalar(0.501); xx += samplingFactor)
 				{
-					const Vector2 sample = Vector2(Scalar(x), Scalar(y)) + Vector2(xx, yy);
+					for (Scalar yy = Scalar(-0.5); yy <= Scalar(0.501); yy += samplingFactor)
+					{
+						const Vector2 sample = Vector2(Scalar(x), Scalar(y)) + Vector2(xx, yy);
 
-					const Line3 ray = view->viewingRay(sample.x(), sample.y(), frame_.width(), frame_.height());
+						const Line3 ray = view->viewingRay(sample.x(), sample.y(), frame_.width(), frame_.height());
 
-					const Scalar factor = Numeric::normalizedGaussianDistribution2(xx, yy, Scalar(1), Scalar(1));
+						const Scalar factor = Numeric::normalizedGaussianDistribution2(xx, yy, Scalar(1), Scalar(1));
 
-					RGBAColor localColor;
-					if (!renderRay(view->transformation().translation(), ray, *group, *lightSources, localColor))
-					{
-						uint8_t* const pixel = frame_.pixel<uint8_t>(x, y);
+						RGBAColor localColor;
+						if (!renderRay(view->transformation().translation(), ray, *group, *lightSources, localColor))
+						{
+							uint8_t* const pixel = frame_.pixel<uint8_t>(x, y);
 
-						localColor = RGBAColor(float(pixel[0]) / 255.0f, float(pixel[1]) / 255.0f, float(pixel[2]) / 255.0f);
-					}
+							localColor = RGBAColor(float(pixel[0]) / 255.0f, float(pixel[1]) / 255.0f, float(pixel[2]) / 255.0f);
+						}
 
-					color.combine(localColor.damped(float(factor)));
-					totalFactor += factor;
+						color.combine(localColor.damped(float(factor)));
+						totalFactor += factor;
+					}
 				}
-			}
 
-			color.damp(1.0f / float(totalFactor));
+				color.damp(1.0f / float(totalFactor));
 
-			const float redValue = minmax(0.0f, color.red(), 1.0f);
-			const float greenValue = minmax(0.0f, color.green(), 1.0f);
-			const float blueValue = minmax(0.0f, color.blue(), 1.0f);
+				const float redValue = minmax(0.0f, color.red(), 1.0f);
+				const float greenValue = minmax(0.0f, color.green(), 1.0f);
+				const float blueValue = minmax(0.0f, color.blue(), 1.0f);
 
-			uint8_t* const pixel = frame_.pixel<uint8_t>(x, y);
+				uint8_t* const pixel = frame_.pixel<uint8_t>(x, y);
 
-			pixel[0] = uint8_t(redValue * 255.0f + 0.5f);
-			pixel[1] = uint8_t(greenValue * 255.0f + 0.5f);
-			pixel[2] = uint8_t(blueValue * 255.0f + 0.5f);
+				pixel[0] = uint8_t(redValue * 255.0f + 0.5f);
+				pixel[1] = uint8_t(greenValue * 255.0f + 0.5f);
+				pixel[2] = uint8_t(blueValue * 255.0f + 0.5f);
+			}
 		}
 	}
 }
 
+bool GIFramebuffer::tileArea(const unsigned int tileIndex, unsigned int& left, unsigned int& top, unsigned int& right, unsigned int& bottom) const
+{
+	ocean_assert(frame_.isValid());
+
+	const unsigned int horizontalTiles = (frame_.width() + tileSize_ - 1u) / tileSize_;
+	const unsigned int verticalTiles = (frame_.height() + tileSize_ - 1u) / tileSize_;
+
+	if (tileIndex >= horizontalTiles * verticalTiles)
+	{
+		return false;
+	}
+
+	left = (tileIndex % horizontalTiles) * tileSize_;
+	top = (tileIndex / horizontalTiles) * tileSize_;
+
+	right = std::min(left + tileSize_, frame_.width());
+	bottom = std::min(top + tileSize_, frame_.height());
+
+	return true;
+}
+
 bool GIFramebuffer::intersection(const Line3& /*ray*/, RenderableRef& /*renderable*/, Vector3& /*position*/)
 {
 	ocean_assert(false && "Missing implementation!");
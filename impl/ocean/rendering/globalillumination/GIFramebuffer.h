@@ -20,6 +20,8 @@
 #include "ocean/rendering/Engine.h"
 #include "ocean/rendering/Framebuffer.h"
 
+#include <atomic>
+
 namespace Ocean
 {
 
@@ -185,26 +187,38 @@ class OCEAN_RENDERING_GI_EXPORT GIFramebuffer :
 		~GIFramebuffer() override;
 
 		/**
-		 * Renders a subset of the frame into the framebuffer.
+		 * Renders tiles of the frame into the framebuffer until all tiles have been rendered.
+		 * Each thread takes the next tile which has not been rendered yet, so that expensive image regions do not stall the remaining threads.
 		 * @param lightSources The light sources that will be used for rendering
 		 * @param group The group of tracing objects actually representing the geometry(s) of the scene
-		 * @param threads The number of threads the are currently used concurrently to render the frame, with range [1, infinity)
-		 * @param threadIndex The index of the thread currently executed, with range [0, threads)
-		 * @param mustBeOne Unused parameter which must be 1
+		 * @param nextTile The index of the next tile to be rendered, shared between all threads, must be valid
+		 * @param firstThread The index of the first thread to be handled, unused
+		 * @param numberThreads The number of threads to be handled, must be 1
 		 */
-		void renderSubset(LightSources* lightSources, const TracingGroup* group, const unsigned int threads, const unsigned int threadIndex, const unsigned int mustBeOne);
+		void renderTiles(LightSources* lightSources, const TracingGroup* group, std::atomic<unsigned int>* nextTile, const unsigned int firstThread, const unsigned int numberThreads);
 
 		/**
-		 * Renders a subset of the frame into the framebuffer.
+		 * Renders the antialiased tiles of the frame into the framebuffer until all tiles have been rendered.
 		 * @param sobelResponse The sobel response of the pixel-accurate render result providing a measure for the number of necessary sub-pixel render iterations, must be valid
 		 * @param sobelResponsePaddingElements The number of padding elements at the end of each sobel response row, in elements, with range [0, infinity)
 		 * @param lightSources The light sources that will be used for rendering, must be valid
 		 * @param group The group of tracing objects actually representing the geometry(s) of the scene
-		 * @param threads The number of threads the are currently used concurrently to render the frame, with range [1, infinity)
-		 * @param threadIndex The index of the thread currently executed, with range [0, threads)
-		 * @param mustBeOne Unused parameter which must be 1
+		 * @param nextTile The index of the next tile to be rendered, shared between all threads, must be valid
+		 * @param firstThread The index of the first thread to be handled, unused
+		 * @param numberThreads The number of threads to be handled, must be 1
 		 */
-		void renderAntialiasedSubset(const uint8_t* sobelResponse, const unsigned int sobelResponsePaddingElements, LightSources* lightSources, const TracingGroup* group, const unsigned int threads, const unsigned int threadIndex, const unsigned int mustBeOne);
+		void renderAntialiasedTiles(const uint8_t* sobelResponse, const unsigned int sobelResponsePaddingElements, LightSources* lightSources, const TracingGroup* group, std::atomic<unsigned int>* nextTile, const unsigned int firstThread, const unsigned int numberThreads);
+
+		/**
+		 * Determines the pixel area of a tile.
+		 * @param tileIndex The index of the tile, with range [0, infinity)
+		 * @param left The resulting left pixel of the tile
+		 * @param top The resulting top pixel of the tile
+		 * @param right The resulting right pixel of the tile (exclusive)
+		 * @param bottom The resulting bottom pixel of the tile (exclusive)
+		 * @return True, if the tile exists; False, if all tiles have been handled
+		 */
+		bool tileArea(const unsigned int tileIndex, unsigned int& left, unsigned int& top, unsigned int& right, unsigned int& bottom) const;
 
 		/**
 		 * Renders one specific ray for a given group of tracing objects and light sources.
@@ -239,6 +253,9 @@ class OCEAN_RENDERING_GI_EXPORT GIFramebuffer :
 
 		/// Lighting modes for this framebuffer.
 		Lighting::LightingModes lightingModes_;
+
+		/// The size of the square tiles in which the frame is rendered, in pixel.
+		static constexpr unsigned int tileSize_ = 16u;
 };
 
 }
@@ -126,6 +126,16 @@ bool TracingBox::determineColor(const Vector3& viewPosition, const Vector3& view
 	return Lighting::dampedLight(viewPosition, viewObjectDirection, intersection.position(), intersection.normal(), intersection.textureCoordinate(), material_, textures_, intersection.lightSources(), *this, group, bounces, lightingModes, color);
 }
 
+BoundingBox TracingBox::boundingBox() const
+{
+	if (!tracingLocalBoundingBox.isValid() || !objectTransformation_.isValid())
+	{
+		return BoundingBox();
+	}
+
+	return BoundingBox(tracingLocalBoundingBox * objectTransformation_);
+}
+
 }
 
 }
@@ -26,32 +26,94 @@ TracingGroup::~TracingGroup()
 
 void TracingGroup::findNearestIntersection(const Line3& ray, RayIntersection& intersection, const bool frontFace, const Scalar eps, const TracingObject* excludedObject) const
 {
-	for (TracingObjects::const_iterator i = tracingObjects.begin(); i != tracingObjects.end(); ++i)
+	if (tracingHierarchy.isEmpty())
+	{
+		for (TracingObjects::const_iterator i = tracingObjects.begin(); i != tracingObjects.end(); ++i)
+		{
+			if (*i != excludedObject)
+			{
+				(*i)->findNearestIntersection(ray, intersection, frontFace, eps);
+			}
+		}
+
+		return;
+	}
+
+	for (const TracingObject* tracingObject : tracingUnboundedObjects)
 	{
-		if (*i != excludedObject)
+		if (tracingObject != excludedObject)
 		{
-			(*i)->findNearestIntersection(ray, intersection, frontFace, eps);
+			tracingObject->findNearestIntersection(ray, intersection, frontFace, eps);
 		}
 	}
+
+	tracingHierarchy.traverse(ray, intersection.distance(), [&](const Index32 objectIndex, Scalar& hierarchyDistance)
+	{
+		ocean_assert(objectIndex < tracingHierarchyObjects.size());
+		const TracingObject* tracingObject = tracingHierarchyObjects[objectIndex];
+
+		if (tracingObject != excludedObject)
+		{
+			tracingObject->findNearestIntersection(ray, intersection, frontFace, eps);
+
+			// objects behind the nearest intersection do not need to be visited anymore
+			hierarchyDistance = std::min(hierarchyDistance, intersection.distance());
+		}
+
+		return false;
+	});
 }
 
 bool TracingGroup::hasIntersection(const Line3& ray, const Scalar maximalDistance, const TracingObject* excludedObject) const
 {
-	for (TracingObjects::const_iterator i = tracingObjects.begin(); i != tracingObjects.end(); ++i)
+	if (tracingHierarchy.isEmpty())
 	{
-		if (*i != excludedObject && (*i)->hasIntersection(ray, maximalDistance))
+		for (TracingObjects::const_iterator i = tracingObjects.begin(); i != tracingObjects.end(); ++i)
 		{
+			if (*i != excludedObject && (*i)->hasIntersection(ray, maximalDistance))
+			{
 				return true;
+			}
 		}
+
+		return false;
 	}
 
-	return false;
+	for (const TracingObject* tracingObject : tracingUnboundedObjects)
+	{
+		if (tracingObject != excludedObject && tracingObject->hasIntersection(ray, maximalDistance))
+		{
+			return true;
+		}
+	}
+
+	return tracingHierarchy.traverse(ray, maximalDistance, [&](const Index32 objectIndex, Scalar& hierarchyDistance)
+	{
+		ocean_assert(objectIndex < tracingHierarchyObjects.size());
+		const TracingObject* tracingObject = tracingHierarchyObjects[objectIndex];
+
+		return tracingObject != excludedObject && tracingObject->hasIntersection(ray, hierarchyDistance);
+	});
 }
 
 bool TracingGroup::determineDampingColor(const Line3& ray, RGBAColor& color, const Scalar maximalDistance) const
 {
+	// the damping colors are accumulated in the order of the objects, so that we iterate over all objects but skip objects not intersecting the ray
+
+	const bool useBoundingBoxes = !tracingHierarchy.isEmpty();
+
 	for (TracingObjects::const_iterator i = tracingObjects.begin(); i != tracingObjects.end(); ++i)
 	{
+		if (useBoundingBoxes)
+		{
+			const BoundingBox objectBoundingBox((*i)->boundingBox());
+
+			if (objectBoundingBox.isValid() && !objectBoundingBox.hasIntersection(ray))
+			{
+				continue;
+			}
+		}
+
 		if (!(*i)->determineDampingColor(ray, color, maximalDistance))
 		{
 			return false;
@@ -67,6 +129,58 @@ bool TracingGroup::determineColor(const Vector3& /*viewPosition*/, const Vector3
 	return false;
 }
 
+BoundingBox TracingGroup::boundingBox() const
+{
+	BoundingBox result;
+
+	for (const TracingObject* tracingObject : tracingObjects)
+	{
+		const BoundingBox objectBoundingBox(tracingObject->boundingBox());
+
+		if (!objectBoundingBox.isValid())
+		{
+			// the group does not have a finite extent
+			return BoundingBox();
+		}
+
+		result += objectBoundingBox;
+	}
+
+	return result;
+}
+
+void TracingGroup::buildHierarchy()
+{
+	tracingHierarchyObjects.clear();
+	tracingUnboundedObjects.clear();
+
+	std::vector<BoundingBox> objectBoundingBoxes;
+	objectBoundingBoxes.reserve(tracingObjects.size());
+
+	for (const TracingObject* tracingObject : tracingObjects)
+	{
+		const BoundingBox objectBoundingBox(tracingObject->boundingBox());
+
+		if (objectBoundingBox.isValid())
+		{
+			tracingHierarchyObjects.emplace_back(tracingObject);
+			objectBoundingBoxes.emplace_back(objectBoundingBox);
+		}
+		else
+		{
+			tracingUnboundedObjects.emplace_back(tracingObject);
+		}
+	}
+
+	tracingHierarchy.build(objectBoundingBoxes, 1u);
+
+	if (tracingHierarchy.isEmpty())
+	{
+		// without any bounded object, the linear iteration is used
+		tracingUnboundedObjects.clear();
+	}
+}
+
 }
 
 }
@@ -9,6 +9,7 @@
 #define META_OCEAN_RENDERING_GI_TRACING_GROUP_H
 
 #include "ocean/rendering/globalillumination/GlobalIllumination.h"
+#include "ocean/rendering/globalillumination/BoundingVolumeHierarchy.h"
 #include "ocean/rendering/globalillumination/TracingObject.h"
 
 namespace Ocean
@@ -70,16 +71,42 @@ class OCEAN_RENDERING_GI_EXPORT TracingGroup : public TracingObject
 		 */
 		bool determineColor(const Vector3& viewPosition, const Vector3& viewObjectDirection, const RayIntersection& intersection, const TracingGroup& group, const unsigned int bounces, const TracingObject* excludedObject, const Lighting::LightingModes lightingModes, RGBAColor& color) const override;
 
+		/**
+		 * Returns the bounding box of this tracing object.
+		 * @see TracingObject::boundingBox().
+		 */
+		BoundingBox boundingBox() const override;
+
+		/**
+		 * Builds the bounding volume hierarchy of all objects of this group, should be called after all objects have been added.
+		 * Without hierarchy, all objects are tested for each ray.
+		 */
+		void buildHierarchy();
+
 	private:
 
 		/// The group of tracing objects.
 		TracingObjects tracingObjects;
+
+		/// The bounding volume hierarchy of all tracing objects with finite extent, the primitive indices are indices of tracingHierarchyObjects.
+		BoundingVolumeHierarchy tracingHierarchy;
+
+		/// The tracing objects which are part of the hierarchy.
+		TracingObjects tracingHierarchyObjects;
+
+		/// The tracing objects which are not part of the hierarchy (e.g., without finite extent) and which are tested for each ray.
+		TracingObjects tracingUnboundedObjects;
 };
 
 inline void TracingGroup::addObject(const TracingObject* object)
 {
 	ocean_assert(object);
 	tracingObjects.push_back(object);
+
+	// the hierarchy needs to be built again
+	tracingHierarchy = BoundingVolumeHierarchy();
+	tracingHierarchyObjects.clear();
+	tracingUnboundedObjects.clear();
 }
 
 }
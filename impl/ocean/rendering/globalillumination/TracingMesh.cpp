@@ -19,207 +19,14 @@ namespace Rendering
 namespace GlobalIllumination
 {
 
-TracingMesh::Octree::Octree(const VertexIndices& indices, const TracingMesh& mesh)
-{
-	ocean_assert(!indices.empty());
-
-	for (VertexIndices::const_iterator i = indices.begin(); i != indices.end(); ++i)
-	{
-		const Triangle3& triangle = mesh.tracingTriangles[*i];
-		octreeBoundingBox += triangle.point0();
-		octreeBoundingBox += triangle.point1();
-		octreeBoundingBox += triangle.point2();
-	}
-
-	for (unsigned int n = 0u; n < 8u; ++n)
-	{
-		octreeChildren[n] = nullptr;
-	}
-
-	if (indices.size() > 20)
-	{
-		const Vector3 center(octreeBoundingBox.center());
-
-		VertexIndices newIndices;
-		newIndices.reserve(indices.size());
-
-		size_t debugTotal = 0u;
-
-		unsigned int usedSubsets = 0u;
-		for (unsigned int xArea = 0u; xArea <= 1u; ++xArea)
-		{
-			for (unsigned int yArea = 0u; yArea <= 1u; ++yArea)
-			{
-				for (unsigned int zArea = 0u; zArea <= 1u; ++zArea)
-				{
-					newIndices.clear();
-
-					for (VertexIndices::const_iterator i = indices.begin(); i != indices.end(); ++i)
-					{
-						const Triangle3& triangle = mesh.tracingTriangles[*i];
-
-						if ((xArea == 0u && triangle.point0().x() <= center.x() && triangle.point1().x() <= center.x() && triangle.point2().x() <= center.x())
-									|| (xArea == 1u && (triangle.point0().x() > center.x() || triangle.point1().x() > center.x() || triangle.point2().x() > center.x())))
-						{
-							if ((yArea == 0u && triangle.point0().y() <= center.y() && triangle.point1().y() <= center.y() && triangle.point2().y() <= center.y())
-										|| (yArea == 1u && (triangle.point0().y() > center.y() || triangle.point1().y() > center.y() || triangle.point2().y() > center.y())))
-							{
-								if ((zArea == 0u && triangle.point0().z() <= center.z() && triangle.point1().z() <= center.z() && triangle.point2().z() <= center.z())
-											|| (zArea == 1u && (triangle.point0().z() > center.z() || triangle.point1().z() > center.z() || triangle.point2().z() > center.z())))
-								{
-									newIndices.push_back(*i);
-								}
-							}
-						}
-					}
-
-					if (newIndices.size() == indices.size())
-					{
-						ocean_assert_and_suppress_unused(debugTotal == 0, debugTotal);
-						octreeIndices = indices;
-						return;
-					}
-
-					debugTotal += newIndices.size();
-
-					if (!newIndices.empty())
-					{
-						ocean_assert(usedSubsets < 8);
-
-						octreeChildren[usedSubsets] = new Octree(newIndices, mesh);
-						usedSubsets++;
-					}
-				}
-			}
-		}
-
-		ocean_assert(debugTotal == indices.size());
-	}
-	else
-	{
-		octreeIndices = indices;
-	}
-}
-
-void TracingMesh::Octree::findNearestIntersection(const Line3& ray, const HomogenousMatrix4& objectTransformation, const HomogenousMatrix4& invertedObjectTransformation, const TracingMesh& mesh, RayIntersection& intersection, const bool frontFace, const Scalar eps, const TracingObject* excludedObject) const
-{
-	ocean_assert(ray.isValid());
-
-	if (!octreeBoundingBox.hasIntersection(ray))
-	{
-		return;
-	}
-
-	if (octreeIndices.empty())
-	{
-		for (unsigned int n = 0u; n < 8u && octreeChildren[n]; ++n)
-		{
-			octreeChildren[n]->findNearestIntersection(ray, objectTransformation, invertedObjectTransformation, mesh, intersection, frontFace, eps, excludedObject);
-		}
-	}
-	else
-	{
-		Vector3 intersectionPoint;
-		Vector3 intersectionBarycentric;
-		Scalar intersectionDistance;
-
-		for (VertexIndices::const_iterator i = octreeIndices.begin(); i != octreeIndices.end(); ++i)
-		{
-			ocean_assert(*i < mesh.tracingTriangles.size());
-			const Triangle3& triangle = mesh.tracingTriangles[*i];
-
-			if (triangle.intersection(ray, intersectionPoint, intersectionBarycentric, intersectionDistance) && intersectionDistance > eps && intersectionDistance < intersection.distance())
-			{
-				const Normal& normal0 = mesh.tracingNormals[*i * 3 + 0];
-				const Normal& normal1 = mesh.tracingNormals[*i * 3 + 1];
-				const Normal& normal2 = mesh.tracingNormals[*i * 3 + 2];
-
-				const Normal normal((normal0 * intersectionBarycentric[0] + normal1 * intersectionBarycentric[1] + normal2 * intersectionBarycentric[2]).normalizedOrZero());
-				ocean_assert(Numeric::isEqual(normal.length(), 1));
-
-				const bool isFrontFace = normal * ray.direction() < 0;
-
-				if (isFrontFace == frontFace)
-				{
-					TextureCoordinate textureCoordinate(0, 0);
-
-					if (!mesh.tracingTextureCoordinates.empty())
-					{
-						const TextureCoordinate& coordinate0 = mesh.tracingTextureCoordinates[*i * 3 + 0];
-						const TextureCoordinate& coordinate1 = mesh.tracingTextureCoordinates[*i * 3 + 1];
-						const TextureCoordinate& coordinate2 = mesh.tracingTextureCoordinates[*i * 3 + 2];
-
-						textureCoordinate = coordinate0 * intersectionBarycentric[0] + coordinate1 * intersectionBarycentric[1] + coordinate2 * intersectionBarycentric[2];
-					}
-
-					if (mesh.attributes_)
-					{
-						intersection = RayIntersection(intersectionPoint, ray.direction(), normal, textureCoordinate, intersectionDistance, &mesh, mesh.lightSources_);
-					}
-					else
-					{
-						intersection = RayIntersection(intersectionPoint, ray.direction(), normal, textureCoordinate, intersectionDistance, &mesh, mesh.lightSources_);
-					}
-				}
-			}
-		}
-	}
-}
-
-bool TracingMesh::Octree::hasIntersection(const Line3& ray, const HomogenousMatrix4& objectTransformation, const HomogenousMatrix4& invertedObjectTransformation, const TracingMesh& mesh, const Scalar maximalDistance, const TracingObject* excludedObject) const
-{
-	ocean_assert(ray.isValid());
-
-	if (octreeBoundingBox.hasIntersection(ray, invertedObjectTransformation))
-	{
-		Vector3 intersectionPoint;
-		Scalar intersectionDistance;
-
-		if (octreeIndices.empty())
-		{
-			for (unsigned int n = 0u; n < 8u && octreeChildren[n]; ++n)
-			{
-				if (octreeChildren[n]->hasIntersection(ray, objectTransformation, invertedObjectTransformation, mesh, maximalDistance, excludedObject))
-				{
-					return true;
-				}
-			}
-		}
-		else
-		{
-			for (VertexIndices::const_iterator i = octreeIndices.begin(); i != octreeIndices.end(); ++i)
-			{
-				ocean_assert(*i < mesh.tracingTriangles.size());
-				const Triangle3& triangle = mesh.tracingTriangles[*i];
-
-				if (triangle.intersection(ray, intersectionPoint, intersectionDistance) && intersectionDistance < maximalDistance)
-				{
-					return true;
-				}
-			}
-		}
-	}
-
-	return false;
-}
-
-TracingMesh::Octree::~Octree()
-{
-	for (unsigned int n = 0u; n < 8u; ++n)
-	{
-		delete octreeChildren[n];
-	}
-}
-
-TracingMesh::TracingMesh() :
-	tracingOctree(nullptr)
+TracingMesh::TracingMesh()
 {
 	// nothing to do here
 }
 
 TracingMesh::~TracingMesh()
 {
-	delete tracingOctree;
+	// nothing to do here
 }
 
 void TracingMesh::setTriangles(const Vertices& vertices, const Normals& normals, const TextureCoordinates& textureCoordinates, const TriangleFaces& faces, const HomogenousMatrix4& objectTransformation, const BoundingBox& localBoundingBox)
@@ -330,15 +137,7 @@ void TracingMesh::setTriangles(const Vertices& vertices, const Normals& normals,
 
 	ocean_assert(tracingNormals.size() == tracingTriangles.size() * 3);
 
-	VertexIndices indices;
-	indices.reserve(tracingTriangles.size());
-	for (unsigned int n = 0u; n < tracingTriangles.size(); ++n)
-	{
-		indices.push_back(n);
-	}
-
-	delete tracingOctree;
-	tracingOctree = new Octree(indices, *this);
+	buildHierarchy();
 }
 
 void TracingMesh::setTriangleStrips(const Vertices& vertices, const Normals& normals, const TextureCoordinates& textureCoordinates, const VertexIndexGroups& indicesSet, const HomogenousMatrix4& objectTransformation, const BoundingBox& localBoundingBox)
@@ -550,15 +349,7 @@ void TracingMesh::setTriangleStrips(const Vertices& vertices, const Normals& nor
 
 	ocean_assert(tracingNormals.size() == tracingTriangles.size() * 3);
 
-	VertexIndices indices;
-	indices.reserve(tracingTriangles.size());
-	for (unsigned int n = 0u; n < tracingTriangles.size(); ++n)
-	{
-		indices.push_back(n);
-	}
-
-	delete tracingOctree;
-	tracingOctree = new Octree(indices, *this);
+	buildHierarchy();
 }
 
 void TracingMesh::findNearestIntersection(const Line3& ray, RayIntersection& intersection, const bool frontFace, const Scalar eps, const TracingObject* excludedObject) const
@@ -574,8 +365,7 @@ void TracingMesh::findNearestIntersection(const Line3& ray, RayIntersection& int
 		return;
 	}
 
-	ocean_assert(tracingOctree);
-	tracingOctree->findNearestIntersection(ray, objectTransformation_, invertedObjectTransformation_, *this, intersection, frontFace, eps, excludedObject);
+	findNearestTriangleIntersection(ray, intersection, frontFace, eps);
 }
 
 bool TracingMesh::hasIntersection(const Line3& ray, const Scalar maximalDistance, const TracingObject* excludedObject) const
@@ -591,8 +381,17 @@ bool TracingMesh::hasIntersection(const Line3& ray, const Scalar maximalDistance
 		return false;
 	}
 
-	ocean_assert(tracingOctree);
-	return tracingOctree->hasIntersection(ray, objectTransformation_, invertedObjectTransformation_, *this, maximalDistance, excludedObject);
+	// any intersection is sufficient, so that the traversal stops with the first intersection (e.g., for shadow rays)
+
+	return tracingHierarchy.traverse(ray, maximalDistance, [this, &ray](const Index32 triangleIndex, Scalar& hierarchyDistance)
+	{
+		ocean_assert(triangleIndex < tracingTriangles.size());
+
+		Vector3 intersectionPoint;
+		Scalar intersectionDistance;
+
+		return tracingTriangles[triangleIndex].intersection(ray, intersectionPoint, intersectionDistance) && intersectionDistance < hierarchyDistance;
+	});
 }
 
 bool TracingMesh::determineDampingColor(const Line3& ray, RGBAColor& color, const Scalar maximalDistance) const
@@ -606,9 +405,7 @@ bool TracingMesh::determineDampingColor(const Line3& ray, RGBAColor& color, cons
 	}
 
 	RayIntersection intersection;
-
-	ocean_assert(tracingOctree);
-	tracingOctree->findNearestIntersection(ray, objectTransformation_, invertedObjectTransformation_, *this, intersection, true, Numeric::eps());
+	findNearestTriangleIntersection(ray, intersection, true, Numeric::eps());
 	if (!intersection || intersection.distance() >= maximalDistance)
 	{
 		return true;
@@ -637,6 +434,82 @@ bool TracingMesh::determineColor(const Vector3& viewPosition, const Vector3& vie
 	return Lighting::dampedLight(viewPosition, viewObjectDirection, intersection.position(), intersection.normal(), intersection.textureCoordinate(), material_, textures_, intersection.lightSources(), *this, group, bounces, lightingModes, color);
 }
 
+BoundingBox TracingMesh::boundingBox() const
+{
+	// the triangles are defined in world already
+
+	return tracingHierarchy.boundingBox();
+}
+
+void TracingMesh::buildHierarchy()
+{
+	std::vector<BoundingBox> triangleBoundingBoxes;
+	triangleBoundingBoxes.reserve(tracingTriangles.size());
+
+	for (const Triangle3& triangle : tracingTriangles)
+	{
+		BoundingBox triangleBoundingBox(triangle.point0(), triangle.point0());
+		triangleBoundingBox += triangle.point1();
+		triangleBoundingBox += triangle.point2();
+
+		triangleBoundingBoxes.emplace_back(triangleBoundingBox);
+	}
+
+	tracingHierarchy.build(triangleBoundingBoxes);
+}
+
+void TracingMesh::findNearestTriangleIntersection(const Line3& ray, RayIntersection& intersection, const bool frontFace, const Scalar eps) const
+{
+	ocean_assert(ray.isValid());
+
+	tracingHierarchy.traverse(ray, intersection.distance(), [&](const Index32 triangleIndex, Scalar& hierarchyDistance)
+	{
+		ocean_assert(triangleIndex < tracingTriangles.size());
+		const Triangle3& triangle = tracingTriangles[triangleIndex];
+
+		Vector3 intersectionPoint;
+		Vector3 intersectionBarycentric;
+		Scalar intersectionDistance;
+
+		if (!triangle.intersection(ray, intersectionPoint, intersectionBarycentric, intersectionDistance) || intersectionDistance <= eps || intersectionDistance >= intersection.distance())
+		{
+			return false;
+		}
+
+		const Normal& normal0 = tracingNormals[triangleIndex * 3u + 0u];
+		const Normal& normal1 = tracingNormals[triangleIndex * 3u + 1u];
+		const Normal& normal2 = tracingNormals[triangleIndex * 3u + 2u];
+
+		const Normal normal((normal0 * intersectionBarycentric[0] + normal1 * intersectionBarycentric[1] + normal2 * intersectionBarycentric[2]).normalizedOrZero());
+		ocean_assert(Numeric::isEqual(normal.length(), 1));
+
+		const bool isFrontFace = normal * ray.direction() < 0;
+
+		if (isFrontFace != frontFace)
+		{
+			return false;
+		}
+
+		TextureCoordinate textureCoordinate(0, 0);
+
+		if (!tracingTextureCoordinates.empty())
+		{
+			const TextureCoordinate& coordinate0 = tracingTextureCoordinates[triangleIndex * 3u + 0u];
+			const TextureCoordinate& coordinate1 = tracingTextureCoordinates[triangleIndex * 3u + 1u];
+			const TextureCoordinate& coordinate2 = tracingTextureCoordinates[triangleIndex * 3u + 2u];
+
+			textureCoordinate = coordinate0 * intersectionBarycentric[0] + coordinate1 * intersectionBarycentric[1] + coordinate2 * intersectionBarycentric[2];
+		}
+
+		intersection = RayIntersection(intersectionPoint, ray.direction(), normal, textureCoordinate, intersectionDistance, this, lightSources_);
+
+		// nodes behind the new intersection do not need to be visited anymore
+		hierarchyDistance = intersectionDistance;
+
+		return false;
+	});
+}
+
 }
 
 }
@@ -9,6 +9,7 @@
 #define META_OCEAN_RENDERING_GI_TRACING_MESH_H
 
 #include "ocean/rendering/globalillumination/GlobalIllumination.h"
+#include "ocean/rendering/globalillumination/BoundingVolumeHierarchy.h"
 #include "ocean/rendering/globalillumination/GITextures.h"
 #include "ocean/rendering/globalillumination/TracingObject.h"
 
@@ -34,52 +35,6 @@ namespace GlobalIllumination
  */
 class OCEAN_RENDERING_GI_EXPORT TracingMesh : public TracingObject
 {
-	private:
-
-		/**
-		 * This class implements a simple octree-like structure allowing to optimized the intersection performance.
-		 * An octree instance is composed of a bounding box, a set of vertices belonging to the octree and optional octree children.
-		 */
-		class Octree
-		{
-			public:
-
-				/**
-				 * Creates a new octree object by a set of given indices and an corresponding mesh object.
-				 * @param indices The indices of all vertices which will be covert by the new octree object
-				 * @param mesh The mesh holding the entire mesh already
-				 */
-				Octree(const VertexIndices& indices, const TracingMesh& mesh);
-
-				/**
-				 * Destructs an octree object.
-				 */
-				~Octree();
-
-				/**
-				 * Determines the nearest intersection with between this tracing object and a given 3D ray.
-				 * @see TracingObject::findNearestIntersection().
-				 */
-				void findNearestIntersection(const Line3& ray, const HomogenousMatrix4& objectTransformation, const HomogenousMatrix4& invertedObjectTransformation, const TracingMesh& mesh, RayIntersection& intersection, const bool frontFace, const Scalar eps, const TracingObject* excludedObject = nullptr) const;
-
-				/**
-				 * Determines whether this tracing object has an intersection with a provided 3D ray.
-				 * @see TracingObject::hasIntersection().
-				 */
-				bool hasIntersection(const Line3& ray, const HomogenousMatrix4& objectTransformation, const HomogenousMatrix4& invertedObjectTransformation, const TracingMesh& mesh, const Scalar maximalDistance = Numeric::maxValue(), const TracingObject* excludedObject = nullptr) const;
-
-			protected:
-
-				/// The bounding box of this octree object.
-				BoundingBox octreeBoundingBox;
-
-				/// This indices of all vertices which are covert by this octree object.
-				VertexIndices octreeIndices;
-
-				/// Up to eight octree children object, nullptr if a child does not exist.
-				Octree* octreeChildren[8];
-		};
-
 	public:
 
 		/**
@@ -138,8 +93,28 @@ class OCEAN_RENDERING_GI_EXPORT TracingMesh : public TracingObject
 		 */
 		bool determineColor(const Vector3& viewPosition, const Vector3& viewObjectDirection, const RayIntersection& intersection, const TracingGroup& group, const unsigned int bounces, const TracingObject* excludedObject, const Lighting::LightingModes lightingModes, RGBAColor& color) const override;
 
+		/**
+		 * Returns the bounding box of this tracing object.
+		 * @see TracingObject::boundingBox().
+		 */
+		BoundingBox boundingBox() const override;
+
 	private:
 
+		/**
+		 * Builds the bounding volume hierarchy of all triangles.
+		 */
+		void buildHierarchy();
+
+		/**
+		 * Determines the nearest intersection between the triangles of this mesh and a given 3D ray.
+		 * @param ray The 3D ray, defined in world, must be valid
+		 * @param intersection The resulting nearest intersection, an existing intersection is replaced only by a closer intersection
+		 * @param frontFace True, to determine intersections with front faces; False, to determine intersections with back faces
+		 * @param eps The minimal distance between the start point of the ray and an intersection, with range [0, infinity)
+		 */
+		void findNearestTriangleIntersection(const Line3& ray, RayIntersection& intersection, const bool frontFace, const Scalar eps) const;
+
 		/// The bounding box of this tracing object.
 		BoundingBox tracingLocalBoundingBox;
 
@@ -155,8 +130,8 @@ class OCEAN_RENDERING_GI_EXPORT TracingMesh : public TracingObject
 		/// The set of texture coordinates connected with the mesh's triangles.
 		TextureCoordinates tracingTextureCoordinates;
 
-		/// The octree used to improved the performance of the intersection determination process.
-		Octree* tracingOctree;
+		/// The bounding volume hierarchy of the triangles used to improve the performance of the intersection determination process, defined in world.
+		BoundingVolumeHierarchy tracingHierarchy;
 };
 
 }
@@ -14,6 +14,7 @@
 #include "ocean/rendering/globalillumination/TracingObject.h"
 #include "ocean/rendering/globalillumination/Lighting.h"
 
+#include "ocean/math/BoundingBox.h"
 #include "ocean/math/HomogenousMatrix4.h"
 
 #include "ocean/rendering/AttributeSet.h"
@@ -103,6 +104,12 @@ class OCEAN_RENDERING_GI_EXPORT TracingObject
 		 */
 		virtual bool determineColor(const Vector3& viewPosition, const Vector3& viewObjectDirection, const RayIntersection& intersection, const TracingGroup& group, const unsigned int bounces, const TracingObject* excludedObject, const Lighting::LightingModes lightingModes, RGBAColor& color) const = 0;
 
+		/**
+		 * Returns the bounding box of this tracing object.
+		 * @return The bounding box, defined in world, invalid if the object does not have a finite extent
+		 */
+		virtual BoundingBox boundingBox() const = 0;
+
 	protected:
 
 		/**
@@ -126,6 +126,19 @@ bool TracingSphere::determineColor(const Vector3& viewPosition, const Vector3& v
 	return Lighting::dampedLight(viewPosition, viewObjectDirection, intersection.position(), intersection.normal(), textureCoordinate, material_, textures_, intersection.lightSources(), *this, group, bounces, lightingModes, color);
 }
 
+BoundingBox TracingSphere::boundingBox() const
+{
+	if (!tracingLocalBoundingSphere.isValid() || !objectTransformation_.isValid())
+	{
+		return BoundingBox();
+	}
+
+	const Vector3 radius(tracingLocalBoundingSphere.radius(), tracingLocalBoundingSphere.radius(), tracingLocalBoundingSphere.radius());
+	const BoundingBox localBoundingBox(tracingLocalBoundingSphere.center() - radius, tracingLocalBoundingSphere.center() + radius);
+
+	return BoundingBox(localBoundingBox * objectTransformation_);
+}
+
 }
 
 }
@@ -75,6 +75,12 @@ class OCEAN_RENDERING_GI_EXPORT TracingSphere : public TracingObject
 		 */
 		bool determineColor(const Vector3& viewPosition, const Vector3& viewObjectDirection, const RayIntersection& intersection, const TracingGroup& group, const unsigned int bounces, const TracingObject* excludedObject, const Lighting::LightingModes lightingModes, RGBAColor& color) const override;
 
+		/**
+		 * Returns the bounding box of this tracing object.
+		 * @see TracingObject::boundingBox().
+		 */
+		BoundingBox boundingBox() const override;
+
 	private:
 
 		/// The bounding sphere object providing the radius of the sphere.
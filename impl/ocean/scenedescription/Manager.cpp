@@ -12,6 +12,7 @@
 #include "ocean/io/File.h"
 #include "ocean/io/FileResolver.h"
 
+#include "ocean/base/PluginManager.h"
 #include "ocean/base/String.h"
 
 namespace Ocean
@@ -48,7 +49,7 @@ SceneRef Manager::load(const std::string& filename, const Rendering::EngineRef&
 		files.push_back(file);
 	}
 
-	const ScopedLock lock(libraryLock_);
+	TemporaryScopedLock lock(libraryLock_);
 
 	bool invalidFilename = true;
 
@@ -96,6 +97,17 @@ SceneRef Manager::load(const std::string& filename, const Rendering::EngineRef&
 	if (invalidFilename)
 	{
 		Log::error() << "Failed to load file: \"" << filename << "\".";
+
+		return SceneRef();
+	}
+
+	// the libraries must not be locked while a plugin is loaded, as the plugin registers its library
+
+	lock.release();
+
+	if (!file.extension().empty() && PluginManager::get().loadPluginForCapability(file.extension(), PluginManager::TYPE_SCENEDESCRIPTION))
+	{
+		return load(filename, engine, timestamp, preferredDescriptionType, progress, cancel);
 	}
 
 	return SceneRef();
@@ -195,7 +207,11 @@ Timestamp Manager::preUpdate(const Rendering::ViewRef& view, const Timestamp tim
 	for (UpdateNodes::const_iterator i = updateNodes_.begin(); i != updateNodes_.end(); ++i)
 	{
 		ocean_assert(i->second);
-		realTimestamp = i->second->onPreUpdate(view, realTimestamp);
+
+		if (i->second->isUpdateRequired(realTimestamp, false))
+		{
+			realTimestamp = i->second->onPreUpdate(view, realTimestamp);
+		}
 	}
 
 	ocean_assert(realTimestamp.isValid());
@@ -212,7 +228,7 @@ Timestamp Manager::preUpdate(const std::string& library, const Rendering::ViewRe
 	{
 		ocean_assert(i->second);
 
-		if (i->second->library() == library)
+		if (i->second->library() == library && i->second->isUpdateRequired(realTimestamp, false))
 		{
 			realTimestamp = i->second->onPreUpdate(view, realTimestamp);
 		}
@@ -229,7 +245,13 @@ void Manager::update(const Rendering::ViewRef& view, const Timestamp timestamp)
 	for (UpdateNodes::const_iterator i = updateNodes_.begin(); i != updateNodes_.end(); ++i)
 	{
 		ocean_assert(i->second);
-		i->second->onUpdate(view, timestamp);
+
+		// nodes without pending field events and without need for continuous updates are skipped
+
+		if (i->second->isUpdateRequired(timestamp, true))
+		{
+			i->second->onUpdate(view, timestamp);
+		}
 	}
 }
 
@@ -241,7 +263,7 @@ void Manager::update(const std::string& library, const Rendering::ViewRef& view,
 	{
 		ocean_assert(i->second);
 
-		if (i->second->library() == library)
+		if (i->second->library() == library && i->second->isUpdateRequired(timestamp, true))
 		{
 			i->second->onUpdate(view, timestamp);
 		}
@@ -159,6 +159,7 @@ class OCEAN_SCENEDESCRIPTION_EXPORT Manager :
 		 * Beware: Check the type of returned scene description object.<br>
 		 * Depending on the available scene description libraries the description type may vary.<br>
 		 * To not hold a reference of the returned object longer than necessary!<br>
+		 * If no registered library can load the scene, a collected scene description plugin declaring the file extension is loaded on demand, see PluginManager::loadPluginForCapability().
 		 * @param filename The filename of the scene to load
 		 * @param engine Rendering engine to be connected with the scene description, must be defined for permanent scene description objects only
 		 * @param timestamp The current timestamp, must be valid
@@ -125,6 +125,21 @@ Node::FieldAccessType Node::fieldAccessType(const std::string& fieldName) const
 	return specification_->fieldAccessType(fieldName);
 }
 
+Strings Node::fieldNames() const
+{
+	ocean_assert(specification_ != nullptr);
+
+	Strings names;
+	names.reserve(specification_->fields_.size());
+
+	for (const NodeSpecification::FieldSpecificationMap::value_type& fieldPair : specification_->fields_)
+	{
+		names.push_back(fieldPair.first);
+	}
+
+	return names;
+}
+
 void Node::setName(const std::string& name)
 {
 	name_ = name;
@@ -279,6 +279,12 @@ class OCEAN_SCENEDESCRIPTION_EXPORT Node
 		 */
 		FieldAccessType fieldAccessType(const std::string& fieldName) const;
 
+		/**
+		 * Returns the names of all (standard) fields of this node.
+		 * @return The field names, in alphabetical order
+		 */
+		Strings fieldNames() const;
+
 		/**
 		 * Sets the name of this node.
 		 * @param name The name of this node to set
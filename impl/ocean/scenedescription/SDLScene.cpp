@@ -15,11 +15,20 @@ namespace SceneDescription
 
 SDLScene::SDLScene(const std::string& filename) :
 	Scene(filename),
-	SDLNode()
+	SDLNode(),
+	Thread("SDLScene progressive processing")
 {
 	// nothing to do here
 }
 
+SDLScene::~SDLScene()
+{
+	// derived scenes stop the background processing in their own destructor already
+	ocean_assert(!isThreadActive());
+
+	stopProgressiveProcessing();
+}
+
 Rendering::SceneRef SDLScene::apply(const Rendering::EngineRef& engine)
 {
 	if (engine.isNull())
@@ -45,6 +54,124 @@ Rendering::SceneRef SDLScene::apply(const Rendering::EngineRef& engine)
 	return scene;
 }
 
+Rendering::SceneRef SDLScene::applyProgressive(const Rendering::EngineRef& engine)
+{
+	if (engine.isNull())
+	{
+		return Rendering::ObjectRef();
+	}
+
+	ocean_assert(!isThreadInvokedToStart() && "The scene has been applied already");
+
+	bool progressive = false;
+	Rendering::SceneRef scene(internalApplyProgressive(engine, progressive));
+
+	if (scene.isNull())
+	{
+		Log::error() << "Failure during creation of a rendering scene description of \"" << filename() << "\".";
+		return scene;
+	}
+
+	if (progressive)
+	{
+		{
+			const ScopedLock scopedLock(pendingLock_);
+			processingActive_ = true;
+		}
+
+		if (!startThread())
+		{
+			Log::warning() << "Failed to start the background processing of \"" << filename() << "\".";
+
+			const ScopedLock scopedLock(pendingLock_);
+			processingActive_ = false;
+		}
+	}
+
+	return scene;
+}
+
+bool SDLScene::applyPending(const Rendering::EngineRef& engine, const double maximalDuration)
+{
+	ocean_assert(maximalDuration > 0.0);
+
+	if (engine.isNull())
+	{
+		return false;
+	}
+
+	const Timestamp startTimestamp(true);
+
+	TemporaryScopedLock scopedLock(pendingLock_);
+
+	while (!pendingFunctions_.empty())
+	{
+		const PendingFunction pendingFunction(std::move(pendingFunctions_.front()));
+		pendingFunctions_.pop_front();
+
+		// the pending function is invoked without holding the lock, so that the background processing can continue adding new functions
+
+		scopedLock.release();
+
+		pendingFunction(engine);
+
+		if (Timestamp(true) >= startTimestamp + maximalDuration)
+		{
+			scopedLock.relock(pendingLock_);
+			break;
+		}
+
+		scopedLock.relock(pendingLock_);
+	}
+
+	return !processingActive_ && pendingFunctions_.empty();
+}
+
+Rendering::SceneRef SDLScene::internalApplyProgressive(const Rendering::EngineRef& engine, bool& progressive)
+{
+	progressive = false;
+
+	return internalApply(engine);
+}
+
+void SDLScene::processProgressive()
+{
+	// nothing to do here
+}
+
+void SDLScene::addPendingFunction(PendingFunction&& pendingFunction)
+{
+	ocean_assert(pendingFunction);
+
+	const ScopedLock scopedLock(pendingLock_);
+
+	pendingFunctions_.emplace_back(std::move(pendingFunction));
+}
+
+void SDLScene::stopProgressiveProcessing()
+{
+	stopThread();
+
+	while (isThreadActive())
+	{
+		sleep(1u);
+	}
+
+	const ScopedLock scopedLock(pendingLock_);
+
+	processingActive_ = false;
+	pendingFunctions_.clear();
+}
+
+void SDLScene::threadRun()
+{
+	processProgressive();
+
+	const ScopedLock scopedLock(pendingLock_);
+
+	processingActive_ = false;
+}
+
 Rendering::ObjectRef SDLScene::apply(const Rendering::EngineRef& /*engine*/, const SDLScene& /*scene*/, SDLNode& /*parentDescription*/, const Rendering::ObjectRef& /*parentRendering*/)
 {
 	ocean_assert(false && "This function should never be used.");
@@ -12,6 +12,12 @@
 #include "ocean/scenedescription/Scene.h"
 #include "ocean/scenedescription/SDLNode.h"
 
+#include "ocean/base/Lock.h"
+#include "ocean/base/Thread.h"
+
+#include <deque>
+#include <functional>
+
 namespace Ocean
 {
 
@@ -30,13 +36,36 @@ using SDLSceneRef = SmartObjectRef<SDLScene, Node>;
 
 /**
  * This class implements the base class for all sdl scene object providing access to all elements of a scene.
- * A new scene object can be created by the scene description Manager object.
+ * A new scene object can be created by the scene description Manager object.<br>
+ * A scene can be applied either entirely at once with apply(), or progressively with applyProgressive().<br>
+ * A progressively applied scene processes its data (e.g., parsing and vertex processing) on a background thread and creates the rendering objects incrementally whenever applyPending() is invoked on the rendering thread:
+ * <pre>
+ * // once, after the scene has been loaded
+ * Rendering::SceneRef renderingScene = sdlScene->applyProgressive(engine);
+ * framebuffer->addScene(renderingScene);
+ *
+ * // in each frame, on the rendering thread, spending at most 4ms
+ * sdlScene->applyPending(engine, 0.004);
+ * </pre>
  * @ingroup scenedescription
  */
 class OCEAN_SCENEDESCRIPTION_EXPORT SDLScene :
 	virtual public Scene,
-	virtual public SDLNode
+	virtual public SDLNode,
+	protected Thread
 {
+	protected:
+
+		/**
+		 * Definition of a function creating pending rendering objects, invoked on the rendering thread.
+		 */
+		using PendingFunction = std::function<void(const Rendering::EngineRef& engine)>;
+
+		/**
+		 * Definition of a queue holding pending functions.
+		 */
+		using PendingFunctions = std::deque<PendingFunction>;
+
 	public:
 
 		/**
@@ -46,6 +75,26 @@ class OCEAN_SCENEDESCRIPTION_EXPORT SDLScene :
 		 */
 		Rendering::SceneRef apply(const Rendering::EngineRef& engine);
 
+		/**
+		 * Applies the scene progressively to the rendering engine.
+		 * The function returns immediately, the returned rendering scene is filled while the scene's data is processed in the background and while applyPending() is invoked.<br>
+		 * Scenes not supporting a progressive application are applied entirely instead.<br>
+		 * A scene must be applied either with apply() or with applyProgressive(), and only once.
+		 * @param engine Rendering engine to use
+		 * @return Resulting rendering scene object, may be empty at the moment the function returns
+		 * @see applyPending().
+		 */
+		Rendering::SceneRef applyProgressive(const Rendering::EngineRef& engine);
+
+		/**
+		 * Creates pending rendering objects of a progressively applied scene.
+		 * This function must be invoked on the rendering thread, e.g., once per frame.
+		 * @param engine Rendering engine to use, the same engine which has been used in applyProgressive()
+		 * @param maximalDuration The maximal time this function spends creating rendering objects, in seconds, with range (0, infinity); at least one pending object is created in each call
+		 * @return True, if the scene has been applied entirely; False, if the background processing is still running or if rendering objects are still pending
+		 */
+		bool applyPending(const Rendering::EngineRef& engine, const double maximalDuration = 0.004);
+
 	protected:
 
 		/**
@@ -54,6 +103,11 @@ class OCEAN_SCENEDESCRIPTION_EXPORT SDLScene :
 		 */
 		SDLScene(const std::string& filename);
 
+		/**
+		 * Destructs a scene object.
+		 */
+		~SDLScene() override;
+
 		/**
 		 * Internal function to apply the entire scene to the rendering engine.
 		 * @param engine Rendering engine to use
@@ -61,12 +115,62 @@ class OCEAN_SCENEDESCRIPTION_EXPORT SDLScene :
 		 */
 		virtual Rendering::SceneRef internalApply(const Rendering::EngineRef& engine) = 0;
 
+		/**
+		 * Internal function to apply the scene progressively to the rendering engine.
+		 * The function creates the (possibly empty) rendering scene, the background processing is started afterwards.<br>
+		 * The default implementation applies the entire scene.
+		 * @param engine Rendering engine to use
+		 * @param progressive Resulting state whether the scene will be processed in the background, False if the entire scene has been applied already
+		 * @return Resulting rendering scene object
+		 * @see processProgressive().
+		 */
+		virtual Rendering::SceneRef internalApplyProgressive(const Rendering::EngineRef& engine, bool& progressive);
+
+		/**
+		 * Processes the scene's data in the background after the scene has been applied progressively.
+		 * Rendering objects must not be created in this function, instead pending functions need to be added which will be invoked on the rendering thread.<br>
+		 * The implementation should return early if shouldThreadStop() is True.
+		 * @see addPendingFunction().
+		 */
+		virtual void processProgressive();
+
+		/**
+		 * Adds a new pending function which will be invoked on the rendering thread, pending functions are invoked in the order they have been added.
+		 * @param pendingFunction The function creating rendering objects, must be valid
+		 */
+		void addPendingFunction(PendingFunction&& pendingFunction);
+
+		/**
+		 * Stops the background processing and waits until the processing has stopped.
+		 * Derived classes must invoke this function in their destructor before releasing any resource used in processProgressive().
+		 */
+		void stopProgressiveProcessing();
+
 		/**
 		 * Applies this node to the rendering engine.
 		 * Don't use this function for a scene, use Scene::apply(Rendering::Engine&) instead.
 		 * @see Node::apply().
 		 */
 		Rendering::ObjectRef apply(const Rendering::EngineRef& engine, const SDLScene& scene, SDLNode& parentDescription, const Rendering::ObjectRef& parentRendering) override;
+
+	private:
+
+		/**
+		 * The thread run function processing the scene progressively.
+		 * @see Thread::threadRun().
+		 */
+		void threadRun() override;
+
+	protected:
+
+		/// The pending functions which still need to be invoked on the rendering thread.
+		PendingFunctions pendingFunctions_;
+
+		/// True, if the background processing is still running.
+		bool processingActive_ = false;
+
+		/// The lock for the pending functions.
+		Lock pendingLock_;
 };
 
 }
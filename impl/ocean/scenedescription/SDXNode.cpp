@@ -70,6 +70,7 @@ bool SDXNode::setField(const std::string& fieldName, const Field& field)
 	if (initialized_)
 	{
 		onFieldChanged(fieldName);
+		onFieldEvent(fieldName);
 	}
 
 	return true;
@@ -146,6 +147,11 @@ void SDXNode::onFieldChanged(const std::string& /*fieldName*/)
 	// this function should be implemented in derived classes
 }
 
+void SDXNode::onFieldEvent(const std::string& /*fieldName*/)
+{
+	// nothing to do here
+}
+
 void SDXNode::registerThisNodeAsParent(const SDXNodeRef& child)
 {
 	if (child)
@@ -222,6 +222,13 @@ class OCEAN_SCENEDESCRIPTION_EXPORT SDXNode : virtual public Node
 		 */
 		virtual void onFieldChanged(const std::string& fieldName);
 
+		/**
+		 * Event function to inform the node that a field has been set after the node has been initialized, e.g., by an event route.
+		 * In contrast to onFieldChanged(), this function is invoked for every set field regardless of the field's access type.
+		 * @param fieldName Name of the field which has been set
+		 */
+		virtual void onFieldEvent(const std::string& fieldName);
+
 		/**
 		 * Registers a new parent node for this (child) node.
 		 * @param parentId Id of the parent node to register
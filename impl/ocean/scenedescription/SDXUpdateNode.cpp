@@ -35,6 +35,16 @@ void SDXUpdateNode::onUpdate(const Rendering::ViewRef& /*view*/, const Timestamp
 	// nothing to do here
 }
 
+bool SDXUpdateNode::needsContinuousUpdate(const Timestamp /*timestamp*/) const
+{
+	return true;
+}
+
+void SDXUpdateNode::onFieldEvent(const std::string& /*fieldName*/)
+{
+	requestUpdate();
+}
+
 }
 
 }
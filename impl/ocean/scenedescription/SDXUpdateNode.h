@@ -11,6 +11,8 @@
 #include "ocean/scenedescription/SceneDescription.h"
 #include "ocean/scenedescription/SDXNode.h"
 
+#include <atomic>
+
 namespace Ocean
 {
 
@@ -19,6 +21,8 @@ namespace SceneDescription
 
 /**
  * This class implements the base class for all nodes needing update calls regularly.
+ * By default, an update node is updated in every frame.<br>
+ * Nodes which need updates only under specific conditions re-implement needsContinuousUpdate(), such nodes are updated only while the condition holds or after one of their fields has been set (e.g., by an event route).
  * @ingroup scenedescription
  */
 class OCEAN_SCENEDESCRIPTION_EXPORT SDXUpdateNode : virtual public SDXNode
@@ -56,8 +60,55 @@ class OCEAN_SCENEDESCRIPTION_EXPORT SDXUpdateNode : virtual public SDXNode
 		 * @param timestamp Preferred update timestamp
 		 */
 		virtual void onUpdate(const Rendering::ViewRef& view, const Timestamp timestamp);
+
+		/**
+		 * Returns whether this node needs to be updated even if none of its fields has been set since the last update.
+		 * The default implementation returns True so that the node is updated in every frame.
+		 * @param timestamp The update timestamp
+		 * @return True, if so
+		 */
+		virtual bool needsContinuousUpdate(const Timestamp timestamp) const;
+
+		/**
+		 * Requests an update of this node in the next update call, independently of needsContinuousUpdate().
+		 * This function is thread-safe.
+		 */
+		inline void requestUpdate();
+
+		/**
+		 * Event function to inform the node that a field has been set, the node requests an update.
+		 * @see SDXNode::onFieldEvent().
+		 */
+		void onFieldEvent(const std::string& fieldName) override;
+
+	private:
+
+		/**
+		 * Returns whether this node needs to be updated, used by the manager.
+		 * @param timestamp The update timestamp
+		 * @param resetRequest True, to reset a pending update request
+		 * @return True, if so
+		 */
+		inline bool isUpdateRequired(const Timestamp timestamp, const bool resetRequest);
+
+	private:
+
+		/// True, if an update has been requested; the first update is always requested.
+		std::atomic<bool> updateRequested_ = true;
 };
 
+inline void SDXUpdateNode::requestUpdate()
+{
+	updateRequested_ = true;
+}
+
+inline bool SDXUpdateNode::isUpdateRequired(const Timestamp timestamp, const bool resetRequest)
+{
+	const bool updateRequested = resetRequest ? updateRequested_.exchange(false) : updateRequested_.load();
+
+	return updateRequested || needsContinuousUpdate(timestamp);
+}
+
 }
 
 }
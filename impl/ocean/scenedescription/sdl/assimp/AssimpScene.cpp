@@ -9,6 +9,8 @@
 #include "ocean/scenedescription/sdl/assimp/Material.h"
 #include "ocean/scenedescription/sdl/assimp/Mesh.h"
 
+#include "ocean/base/WorkerPool.h"
+
 #include <assimp/Importer.hpp>
 #include <assimp/postprocess.h>
 
@@ -37,7 +39,7 @@ AssimpScene::AssimpScene(const std::string& filename) :
 
 AssimpScene::~AssimpScene()
 {
-	// nothing to do here
+	stopProgressiveProcessing();
 }
 
 Rendering::SceneRef AssimpScene::internalApply(const Rendering::EngineRef& engine)
@@ -61,14 +63,134 @@ Rendering::SceneRef AssimpScene::internalApply(const Rendering::EngineRef& engin
 	const std::vector<Rendering::AttributeSetRef> attributeSets = Material::parseMaterials(*engine, filename(), *assimpScene);
 	const std::vector<Rendering::GeometryRef> geometries = Mesh::parseMeshes(*engine, attributeSets, *assimpScene);
 
-	ocean_assert(assimpScene->mRootNode != nullptr);
+	const Rendering::SceneRef scene(engine->factory().createScene());
+	ocean_assert(scene);
 
-	using NodePair = std::pair<aiNode*, Rendering::TransformRef>;
+	createHierarchy(*engine, *assimpScene, scene, nullptr, &geometries);
 
-	const Rendering::SceneRef scene(engine->factory().createScene());
+	return scene;
+}
+
+Rendering::SceneRef AssimpScene::internalApplyProgressive(const Rendering::EngineRef& engine, bool& progressive)
+{
+	ocean_assert(engine);
+
+	progressiveScene_ = engine->factory().createScene();
+	ocean_assert(progressiveScene_);
+
+	progressive = true;
+
+	return progressiveScene_;
+}
+
+void AssimpScene::processProgressive()
+{
+	const Timestamp startTimestamp(true);
+
+	importer_ = std::make_unique<::Assimp::Importer>();
+
+	const unsigned int importerFlags = aiProcess_Triangulate | aiProcess_GenSmoothNormals | aiProcess_JoinIdenticalVertices;
+
+	const aiScene* assimpScene = importer_->ReadFile(filename(), importerFlags);
+
+	if (assimpScene == nullptr)
+	{
+		Log::warning() << "ScenedescriptionAssimp: Failed to open `" << filename() << "`";
+		Log::warning() << "Reason: " << importer_->GetErrorString();
+
+		return;
+	}
+
+	if (shouldThreadStop())
+	{
+		return;
+	}
+
+	// the materials and the (empty) node hierarchy are created first, the meshes are added to the hierarchy afterwards
+
+	addPendingFunction([this, assimpScene](const Rendering::EngineRef& engine)
+	{
+		attributeSets_ = Material::parseMaterials(*engine, filename(), *assimpScene);
+
+		meshTransforms_.resize(assimpScene->mNumMeshes);
+		createHierarchy(*engine, *assimpScene, progressiveScene_, &meshTransforms_, nullptr);
+	});
+
+	const WorkerPool::ScopedWorker scopedWorker(WorkerPool::get().scopedWorker());
+
+	if (scopedWorker)
+	{
+		scopedWorker()->executeFunction(Worker::Function::create(*this, &AssimpScene::convertMeshesSubset, 0u, 0u), 0u, assimpScene->mNumMeshes, 0u, 1u, 1u);
+	}
+	else
+	{
+		convertMeshesSubset(0u, assimpScene->mNumMeshes);
+	}
+
+	if (shouldThreadStop())
+	{
+		return;
+	}
+
+	Log::info() << "\"" << filename() << "\" has been read and converted in " << double(Timestamp(true) - startTimestamp) << " seconds.";
+
+	addPendingFunction([this](const Rendering::EngineRef& /*engine*/)
+	{
+		// the Assimp scene is not needed anymore once all meshes have been created
+
+		meshTransforms_.clear();
+		attributeSets_.clear();
+		importer_ = nullptr;
+		progressiveScene_.release();
+	});
+}
+
+void AssimpScene::convertMeshesSubset(const unsigned int firstMesh, const unsigned int numberMeshes)
+{
+	ocean_assert(importer_ && importer_->GetScene() != nullptr);
+
+	const aiScene& assimpScene = *importer_->GetScene();
+	ocean_assert(firstMesh + numberMeshes <= assimpScene.mNumMeshes);
+
+	for (unsigned int meshIndex = firstMesh; meshIndex < firstMesh + numberMeshes; ++meshIndex)
+	{
+		if (shouldThreadStop())
+		{
+			return;
+		}
+
+		const aiMesh* assimpMesh = assimpScene.mMeshes[meshIndex];
+		ocean_assert(assimpMesh != nullptr);
+
+		std::shared_ptr<Mesh::MeshData> meshData = std::make_shared<Mesh::MeshData>();
+
+		if (!Mesh::convertMesh(*assimpMesh, *meshData))
+		{
+			continue;
+		}
+
+		addPendingFunction([this, meshIndex, meshData](const Rendering::EngineRef& engine)
+		{
+			ocean_assert(meshIndex < meshTransforms_.size());
+
+			const Rendering::GeometryRef geometry(Mesh::createGeometry(*engine, attributeSets_, *meshData));
+
+			for (const Rendering::TransformRef& transform : meshTransforms_[meshIndex])
+			{
+				transform->addChild(geometry);
+			}
+		});
+	}
+}
+
+void AssimpScene::createHierarchy(const Rendering::Engine& engine, const aiScene& assimpScene, const Rendering::TransformRef& scene, std::vector<Rendering::TransformRefs>* meshTransforms, const std::vector<Rendering::GeometryRef>* geometries)
+{
+	ocean_assert(assimpScene.mRootNode != nullptr);
 	ocean_assert(scene);
 
-	std::vector<NodePair> nodeStack(1, NodePair(assimpScene->mRootNode, scene));
+	using NodePair = std::pair<aiNode*, Rendering::TransformRef>;
+
+	std::vector<NodePair> nodeStack(1, NodePair(assimpScene.mRootNode, scene));
 
 	while (!nodeStack.empty())
 	{
@@ -80,7 +202,7 @@ Rendering::SceneRef AssimpScene::internalApply(const Rendering::EngineRef& engin
 
 		nodeStack.pop_back();
 
-		Rendering::TransformRef transform = engine->factory().createTransform();
+		Rendering::TransformRef transform = engine.factory().createTransform();
 		ocean_assert(transform);
 
 		if (assimpNode->mName.length != 0u)
@@ -96,9 +218,14 @@ Rendering::SceneRef AssimpScene::internalApply(const Rendering::EngineRef& engin
 		{
 			const unsigned int meshIndex = assimpNode->mMeshes[n];
 
-			if (meshIndex < (unsigned int)(geometries.size()))
+			if (meshTransforms != nullptr && meshIndex < (unsigned int)(meshTransforms->size()))
 			{
-				transform->addChild(geometries[meshIndex]);
+				(*meshTransforms)[meshIndex].push_back(transform);
+			}
+
+			if (geometries != nullptr && meshIndex < (unsigned int)(geometries->size()))
+			{
+				transform->addChild((*geometries)[meshIndex]);
 			}
 		}
 
@@ -110,8 +237,6 @@ Rendering::SceneRef AssimpScene::internalApply(const Rendering::EngineRef& engin
 			nodeStack.emplace_back(childNode, transform);
 		}
 	}
-
-	return scene;
 }
 
 }
@@ -12,6 +12,20 @@
 
 #include "ocean/scenedescription/SDLScene.h"
 
+#include "ocean/rendering/AttributeSet.h"
+#include "ocean/rendering/Geometry.h"
+#include "ocean/rendering/Transform.h"
+
+#include <memory>
+
+// Forward declarations.
+struct aiScene;
+
+namespace Assimp
+{
+	class Importer;
+}
+
 namespace Ocean
 {
 
@@ -50,6 +64,49 @@ class OCEAN_SCENEDESCRIPTION_SDL_ASSIMP_EXPORT AssimpScene : public SDLScene
 		 * @see Scene::internalApply().
 		 */
 		Rendering::SceneRef internalApply(const Rendering::EngineRef& engine) override;
+
+		/**
+		 * Applies the scene progressively to the rendering engine, the file is read in the background and the meshes are added while they are created.
+		 * @see SDLScene::internalApplyProgressive().
+		 */
+		Rendering::SceneRef internalApplyProgressive(const Rendering::EngineRef& engine, bool& progressive) override;
+
+		/**
+		 * Reads the file and converts the meshes in the background.
+		 * @see SDLScene::processProgressive().
+		 */
+		void processProgressive() override;
+
+		/**
+		 * Converts a subset of all meshes of the Assimp scene and adds a pending function for each mesh.
+		 * @param firstMesh The index of the first mesh to be handled
+		 * @param numberMeshes The number of meshes to be handled
+		 */
+		void convertMeshesSubset(const unsigned int firstMesh, const unsigned int numberMeshes);
+
+		/**
+		 * Creates the node hierarchy of an Assimp scene.
+		 * @param engine Rendering engine to use
+		 * @param assimpScene The Assimp scene providing the hierarchy
+		 * @param scene The rendering object receiving the hierarchy, must be valid
+		 * @param meshTransforms Optional resulting transforms referencing each mesh, with one entry for each mesh of the Assimp scene
+		 * @param geometries Optional geometries to be added to the transforms, one for each mesh of the Assimp scene
+		 */
+		static void createHierarchy(const Rendering::Engine& engine, const aiScene& assimpScene, const Rendering::TransformRef& scene, std::vector<Rendering::TransformRefs>* meshTransforms, const std::vector<Rendering::GeometryRef>* geometries);
+
+	protected:
+
+		/// The importer holding the Assimp scene while the scene is applied progressively.
+		std::unique_ptr<::Assimp::Importer> importer_;
+
+		/// The rendering scene which is filled while the scene is applied progressively.
+		Rendering::SceneRef progressiveScene_;
+
+		/// The attribute sets of the Assimp scene while the scene is applied progressively.
+		std::vector<Rendering::AttributeSetRef> attributeSets_;
+
+		/// The transforms referencing each mesh while the scene is applied progressively.
+		std::vector<Rendering::TransformRefs> meshTransforms_;
 };
 
 }
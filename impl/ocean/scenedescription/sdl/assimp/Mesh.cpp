@@ -24,97 +24,104 @@ namespace Assimp
 {
 
 Rendering::GeometryRef Mesh::parseMesh(const Rendering::Engine& engine, const std::vector<Rendering::AttributeSetRef>& attributeSets, const aiMesh& assimpMesh)
+{
+	MeshData meshData;
+
+	if (!convertMesh(assimpMesh, meshData))
+	{
+		return Rendering::GeometryRef();
+	}
+
+	return createGeometry(engine, attributeSets, meshData);
+}
+
+std::vector<Rendering::GeometryRef> Mesh::parseMeshes(const Rendering::Engine& engine, const std::vector<Rendering::AttributeSetRef>& attributeSets, const aiScene& assimpScene)
+{
+	std::vector<Rendering::GeometryRef> geometries;
+	geometries.reserve(assimpScene.mNumMeshes);
+
+	for (unsigned int n = 0u; n < assimpScene.mNumMeshes; ++n)
+	{
+		const aiMesh* mesh = assimpScene.mMeshes[n];
+		ocean_assert(mesh != nullptr);
+
+		geometries.emplace_back(Mesh::parseMesh(engine, attributeSets, *mesh));
+	}
+
+	return geometries;
+}
+
+bool Mesh::convertMesh(const aiMesh& assimpMesh, MeshData& meshData)
 {
 	if ((assimpMesh.mPrimitiveTypes & aiPrimitiveType_TRIANGLE) != aiPrimitiveType_TRIANGLE)
 	{
-		return Rendering::TrianglesRef();
+		return false;
 	}
 
 	if (assimpMesh.mNumVertices == 0u)
 	{
-		return Rendering::TrianglesRef();
+		return false;
 	}
 
-	const Rendering::TrianglesRef triangles = engine.factory().createTriangles();
-	ocean_assert(triangles);
-
 	if (assimpMesh.mName.length != 0u)
 	{
-		triangles->setName(assimpMesh.mName.data);
+		meshData.name_ = assimpMesh.mName.data;
 	}
 
-	const Rendering::VertexSetRef vertexSet = engine.factory().createVertexSet();
-	ocean_assert(vertexSet);
-
 	if (assimpMesh.mVertices != nullptr)
 	{
-		Rendering::Vertices vertices;
-		vertices.reserve(assimpMesh.mNumVertices);
+		meshData.vertices_.reserve(assimpMesh.mNumVertices);
 
 		for (unsigned int n = 0u; n < assimpMesh.mNumVertices; ++n)
 		{
 			const aiVector3D& assimpVertex = assimpMesh.mVertices[n];
 
-			vertices.emplace_back(Scalar(assimpVertex.x), Scalar(assimpVertex.y), Scalar(assimpVertex.z));
+			meshData.vertices_.emplace_back(Scalar(assimpVertex.x), Scalar(assimpVertex.y), Scalar(assimpVertex.z));
 		}
-
-		vertexSet->setVertices(vertices);
 	}
 
 	if (assimpMesh.mNormals != nullptr)
 	{
-		Rendering::Normals normals;
-		normals.reserve(assimpMesh.mNumVertices);
+		meshData.normals_.reserve(assimpMesh.mNumVertices);
 
 		for (unsigned int n = 0u; n < assimpMesh.mNumVertices; ++n)
 		{
 			const aiVector3D& assimpNormal = assimpMesh.mNormals[n];
 
-			normals.emplace_back(Scalar(assimpNormal.x), Scalar(assimpNormal.y), Scalar(assimpNormal.z));
+			meshData.normals_.emplace_back(Scalar(assimpNormal.x), Scalar(assimpNormal.y), Scalar(assimpNormal.z));
 		}
-
-		vertexSet->setNormals(normals);
 	}
 
 	static_assert(AI_MAX_NUMBER_OF_TEXTURECOORDS >= 1, "Invalid texture coordinates");
 
 	if (assimpMesh.mTextureCoords[0] != nullptr)
 	{
-		Rendering::TextureCoordinates textureCoordinates;
-		textureCoordinates.reserve(assimpMesh.mNumVertices);
+		meshData.textureCoordinates_.reserve(assimpMesh.mNumVertices);
 
 		for (unsigned int n = 0u; n < assimpMesh.mNumVertices; ++n)
 		{
 			const aiVector3D& assimpTextureCoordinate = assimpMesh.mTextureCoords[0][n];
 
-			textureCoordinates.emplace_back(Scalar(assimpTextureCoordinate.x), Scalar(assimpTextureCoordinate.y));
+			meshData.textureCoordinates_.emplace_back(Scalar(assimpTextureCoordinate.x), Scalar(assimpTextureCoordinate.y));
 		}
-
-		vertexSet->setTextureCoordinates(textureCoordinates, 0u);
 	}
 
 	static_assert(AI_MAX_NUMBER_OF_COLOR_SETS >= 1, "Invalid color sets");
 
 	if (assimpMesh.mColors[0] != nullptr)
 	{
-		RGBAColors colors;
-		colors.reserve(assimpMesh.mNumVertices);
+		meshData.colors_.reserve(assimpMesh.mNumVertices);
 
 		for (unsigned int n = 0u; n < assimpMesh.mNumVertices; ++n)
 		{
 			const aiColor4D& assimpColor = assimpMesh.mColors[0][n];
 
 			// Assimp's alpha uses 0 for fully transparent and 1 for fully opaque
-			colors.emplace_back(assimpColor.r, assimpColor.g, assimpColor.b, assimpColor.a);
+			meshData.colors_.emplace_back(assimpColor.r, assimpColor.g, assimpColor.b, assimpColor.a);
 		}
-
-		vertexSet->setColors(colors);
 	}
 
-	triangles->setVertexSet(vertexSet);
-
-	Rendering::TriangleFaces triangleFaces;
-	triangleFaces.reserve(assimpMesh.mNumFaces);
+	meshData.triangleFaces_.reserve(assimpMesh.mNumFaces);
 
 	for (unsigned int n = 0u; n < assimpMesh.mNumFaces; ++n)
 	{
@@ -122,40 +129,63 @@ Rendering::GeometryRef Mesh::parseMesh(const Rendering::Engine& engine, const st
 
 		ocean_assert(assimpFace.mNumIndices == 3u);
 
-		triangleFaces.emplace_back(assimpFace.mIndices);
+		meshData.triangleFaces_.emplace_back(assimpFace.mIndices);
 	}
 
-	triangles->setFaces(triangleFaces);
+	meshData.materialIndex_ = assimpMesh.mMaterialIndex;
 
-	const Rendering::GeometryRef geometry = engine.factory().createGeometry();
-	ocean_assert(geometry);
+	return true;
+}
 
-	if (assimpMesh.mMaterialIndex < (unsigned int)(attributeSets.size()))
+Rendering::GeometryRef Mesh::createGeometry(const Rendering::Engine& engine, const std::vector<Rendering::AttributeSetRef>& attributeSets, const MeshData& meshData)
+{
+	const Rendering::TrianglesRef triangles = engine.factory().createTriangles();
+	ocean_assert(triangles);
+
+	if (!meshData.name_.empty())
 	{
-		geometry->addRenderable(triangles, attributeSets[assimpMesh.mMaterialIndex]);
+		triangles->setName(meshData.name_);
 	}
-	else
+
+	const Rendering::VertexSetRef vertexSet = engine.factory().createVertexSet();
+	ocean_assert(vertexSet);
+
+	if (!meshData.vertices_.empty())
 	{
-		geometry->addRenderable(triangles, engine.factory().createAttributeSet());
+		vertexSet->setVertices(meshData.vertices_);
 	}
 
-	return geometry;
-}
+	if (!meshData.normals_.empty())
+	{
+		vertexSet->setNormals(meshData.normals_);
+	}
 
-std::vector<Rendering::GeometryRef> Mesh::parseMeshes(const Rendering::Engine& engine, const std::vector<Rendering::AttributeSetRef>& attributeSets, const aiScene& assimpScene)
-{
-	std::vector<Rendering::GeometryRef> geometries;
-	geometries.reserve(assimpScene.mNumMeshes);
+	if (!meshData.textureCoordinates_.empty())
+	{
+		vertexSet->setTextureCoordinates(meshData.textureCoordinates_, 0u);
+	}
 
-	for (unsigned int n = 0u; n < assimpScene.mNumMeshes; ++n)
+	if (!meshData.colors_.empty())
 	{
-		const aiMesh* mesh = assimpScene.mMeshes[n];
-		ocean_assert(mesh != nullptr);
+		vertexSet->setColors(meshData.colors_);
+	}
 
-		geometries.emplace_back(Mesh::parseMesh(engine, attributeSets, *mesh));
+	triangles->setVertexSet(vertexSet);
+	triangles->setFaces(meshData.triangleFaces_);
+
+	const Rendering::GeometryRef geometry = engine.factory().createGeometry();
+	ocean_assert(geometry);
+
+	if (meshData.materialIndex_ < (unsigned int)(attributeSets.size()))
+	{
+		geometry->addRenderable(triangles, attributeSets[meshData.materialIndex_]);
+	}
+	else
+	{
+		geometry->addRenderable(triangles, engine.factory().createAttributeSet());
 	}
 
-	return geometries;
+	return geometry;
 }
 
 }
@@ -13,6 +13,7 @@
 #include "ocean/rendering/Engine.h"
 #include "ocean/rendering/Material.h"
 #include "ocean/rendering/Geometry.h"
+#include "ocean/rendering/TriangleFace.h"
 
 #include <assimp/mesh.h>
 #include <assimp/scene.h>
@@ -35,6 +36,37 @@ namespace Assimp
  */
 class OCEAN_SCENEDESCRIPTION_SDL_ASSIMP_EXPORT Mesh
 {
+	public:
+
+		/**
+		 * This class holds the converted data of an Assimp mesh, the data does not depend on a rendering engine.
+		 */
+		class MeshData
+		{
+			public:
+
+				/// The name of the mesh.
+				std::string name_;
+
+				/// The vertices of the mesh.
+				Rendering::Vertices vertices_;
+
+				/// The per-vertex normals of the mesh, empty if not defined.
+				Rendering::Normals normals_;
+
+				/// The per-vertex texture coordinates of the mesh, empty if not defined.
+				Rendering::TextureCoordinates textureCoordinates_;
+
+				/// The per-vertex colors of the mesh, empty if not defined.
+				RGBAColors colors_;
+
+				/// The triangle faces of the mesh.
+				Rendering::TriangleFaces triangleFaces_;
+
+				/// The index of the mesh's material.
+				unsigned int materialIndex_ = (unsigned int)(-1);
+		};
+
 	public:
 
 		/**
@@ -54,6 +86,23 @@ class OCEAN_SCENEDESCRIPTION_SDL_ASSIMP_EXPORT Mesh
 		 * @return The resulting Ocean geometry objects (with preserved order)
 		 */
 		static std::vector<Rendering::GeometryRef> parseMeshes(const Rendering::Engine& engine, const std::vector<Rendering::AttributeSetRef>& attributeSets, const aiScene& assimpScene);
+
+		/**
+		 * Converts the data of an Assimp mesh, this function does not use a rendering engine and can be invoked from any thread.
+		 * @param assimpMesh The Assimp mesh to convert
+		 * @param meshData The resulting mesh data
+		 * @return True, if succeeded; False, if the mesh is not composed of triangles or does not have any vertex
+		 */
+		static bool convertMesh(const aiMesh& assimpMesh, MeshData& meshData);
+
+		/**
+		 * Creates an Ocean geometry object from converted mesh data.
+		 * @param engine The rendering engine for which the geometry object will be created
+		 * @param attributeSets All AttributeSet objects which have been parsed/extracted from the Assimp scene in which the Assimp mesh is defined
+		 * @param meshData The converted mesh data
+		 * @return The resulting Ocean geometry object
+		 */
+		static Rendering::GeometryRef createGeometry(const Rendering::Engine& engine, const std::vector<Rendering::AttributeSetRef>& attributeSets, const MeshData& meshData);
 };
 
 }
@@ -7,6 +7,8 @@
 
 #include "ocean/scenedescription/sdl/obj/OBJScene.h"
 
+#include "ocean/base/WorkerPool.h"
+
 #include "ocean/rendering/AttributeSet.h"
 #include "ocean/rendering/DirectionalLight.h"
 #include "ocean/rendering/Geometry.h"
@@ -40,7 +42,7 @@ OBJScene::OBJScene(const std::string& filename) :
 
 OBJScene::~OBJScene()
 {
-	// nothing to do here
+	stopProgressiveProcessing();
 }
 
 void OBJScene::setMaterials(Materials&& materials)
@@ -104,6 +106,97 @@ void OBJScene::setCurrentMaterial(const std::string& material)
 	}
 }
 
+Rendering::SceneRef OBJScene::internalApplyProgressive(const Rendering::EngineRef& engine, bool& progressive)
+{
+	ocean_assert(engine);
+
+	const Rendering::SceneRef renderingScene(engine->factory().createScene());
+	ocean_assert(renderingScene);
+
+	const Rendering::TransformRef renderingTransform(engine->factory().createTransform());
+	ocean_assert(renderingTransform);
+
+	progressiveGroup_ = engine->factory().createGroup();
+	ocean_assert(progressiveGroup_);
+
+	renderingTransform->addChild(progressiveGroup_);
+	renderingScene->addChild(renderingTransform);
+
+	progressive = true;
+
+	return renderingScene;
+}
+
+void OBJScene::processProgressive()
+{
+	const Timestamp startTimestamp(true);
+
+	std::vector<const FacesMap::value_type*> facesPairs;
+	facesPairs.reserve(facesMap_.size());
+
+	for (const FacesMap::value_type& facesPair : facesMap_)
+	{
+		facesPairs.push_back(&facesPair);
+	}
+
+	// the meshes are created on the worker pool, each mesh is forwarded to the rendering thread as soon as it is ready
+
+	const WorkerPool::ScopedWorker scopedWorker(WorkerPool::get().scopedWorker());
+
+	if (scopedWorker)
+	{
+		scopedWorker()->executeFunction(Worker::Function::create(*this, &OBJScene::createMeshesSubset, (const std::vector<const FacesMap::value_type*>*)(&facesPairs), 0u, 0u), 0u, (unsigned int)(facesPairs.size()), 1u, 2u, 1u);
+	}
+	else
+	{
+		createMeshesSubset(&facesPairs, 0u, (unsigned int)(facesPairs.size()));
+	}
+
+	if (shouldThreadStop())
+	{
+		return;
+	}
+
+	Log::info() << "\"" << filename() << "\" has " << (unsigned int)(facesPairs.size()) << " meshes processed in " << double(Timestamp(true) - startTimestamp) << " seconds.";
+
+	addPendingFunction([this](const Rendering::EngineRef& /*engine*/)
+	{
+		// the scene's data is not needed anymore once all meshes have been created
+
+		facesMap_.clear();
+		progressiveGroup_.release();
+	});
+}
+
+void OBJScene::createMeshesSubset(const std::vector<const FacesMap::value_type*>* facesPairs, const unsigned int firstFacesPair, const unsigned int numberFacesPairs)
+{
+	ocean_assert(facesPairs != nullptr);
+	ocean_assert(firstFacesPair + numberFacesPairs <= (unsigned int)(facesPairs->size()));
+
+	for (unsigned int n = firstFacesPair; n < firstFacesPair + numberFacesPairs; ++n)
+	{
+		if (shouldThreadStop())
+		{
+			return;
+		}
+
+		const FacesMap::value_type& facesPair = *(*facesPairs)[n];
+
+		std::shared_ptr<Mesh> mesh = std::make_shared<Mesh>();
+		createMesh(vertices_, normals_, textureCoordinates_, facesPair.first, facesPair.second, *mesh);
+
+		addPendingFunction([this, mesh](const Rendering::EngineRef& engine)
+		{
+			const Rendering::GeometryRef geometry(createGeometry(engine, *mesh));
+
+			if (geometry && progressiveGroup_)
+			{
+				progressiveGroup_->addChild(geometry);
+			}
+		});
+	}
+}
+
 Rendering::NodeRef OBJScene::createTriangles(const Rendering::EngineRef& engine)
 {
 	ocean_assert(engine);
@@ -114,157 +207,175 @@ Rendering::NodeRef OBJScene::createTriangles(const Rendering::EngineRef& engine)
 
 	for (FacesMap::iterator i = facesMap_.begin(); i != facesMap_.end(); /*++i*/)
 	{
-		const FacePair& facePair = i->first;
-		const Faces& faces = i->second;
+		Mesh mesh;
+		createMesh(vertices_, normals_, textureCoordinates_, i->first, i->second, mesh);
 
-		try
+		const Rendering::GeometryRef geometry(createGeometry(engine, mesh));
+
+		if (geometry)
 		{
-			Rendering::GeometryRef geometry(engine->factory().createGeometry());
-			Rendering::VertexSetRef vertexSet(engine->factory().createVertexSet());
-			Rendering::TrianglesRef triangles(engine->factory().createTriangles());
+			group->addChild(geometry);
 
-			Rendering::Vertices vertices;
-			Rendering::Normals normals;
-			Rendering::TextureCoordinates textureCoordinates;
+			sceneTriangles += (unsigned int)(mesh.triangleFaces_.size());
+		}
 
-			for (const Face& face : faces)
-			{
-				const Rendering::VertexIndices& vertexIndices = face.vertexIndices();
-				const Rendering::VertexIndices& normalIndices = face.normalIndices();
-				const Rendering::VertexIndices& textureIndices = face.textureIndices();
+		facesMap_.erase(i++);
+	}
 
-#ifdef OCEAN_DEBUG
-				for (size_t n = 0; n < vertexIndices.size(); n++)
-				{
-					ocean_assert(vertexIndices[n] <= vertices_.size());
-				}
-				for (size_t n = 0; n < normalIndices.size(); n++)
-				{
-					ocean_assert(normalIndices[n] <= normals_.size());
-				}
-				for (size_t n = 0; n < textureIndices.size(); n++)
-				{
-					ocean_assert(textureIndices[n] <= textureCoordinates_.size());
-				}
-#endif // OCEAN_DEBUG
+	Log::info() << "\"" << filename() << "\" has " << sceneTriangles << " triangles.";
 
-				ocean_assert(vertexIndices.size() >= 3);
-
-				vertices.emplace_back(vertices_[vertexIndices[0]]);
-				vertices.emplace_back(vertices_[vertexIndices[1]]);
-				vertices.emplace_back(vertices_[vertexIndices[2]]);
-
-				for (unsigned int n = 3; n < vertexIndices.size(); n++)
-				{
-					vertices.emplace_back(vertices_[vertexIndices[0]]);
-					vertices.emplace_back(vertices_[vertexIndices[n - 1]]);
-					vertices.emplace_back(vertices_[vertexIndices[n]]);
-				}
-
-				if (face.type() & TYPE_VN)
-				{
-					ocean_assert(normalIndices.size() >= 3);
-
-					normals.emplace_back(normals_[normalIndices[0]]);
-					normals.emplace_back(normals_[normalIndices[1]]);
-					normals.emplace_back(normals_[normalIndices[2]]);
-
-					for (unsigned int n = 3; n < normalIndices.size(); n++)
-					{
-						normals.emplace_back(normals_[normalIndices[0]]);
-						normals.emplace_back(normals_[normalIndices[n - 1]]);
-						normals.emplace_back(normals_[normalIndices[n]]);
-					}
-				}
-				else
-				{
-					Rendering::Normal normal((vertices_[vertexIndices[1]] - vertices_[vertexIndices[0]]).cross(vertices_[vertexIndices.back()] - vertices_[vertexIndices[0]]));
-					if (normal.normalize())
-					{
-						normals.insert(normals.end(), 3 * (vertexIndices.size() - 2), normal);
-					}
-					else
-					{
-						Log::warning() << "Could not calculate a valid normal.";
-						normals.insert(normals.end(), 3 * (vertexIndices.size() - 2), Rendering::Normal(0, 0, 1));
-					}
-				}
-
-				if (face.type() & TYPE_VT)
-				{
-					ocean_assert(textureIndices.size() >= 3);
-
-					textureCoordinates.emplace_back(textureCoordinates_[textureIndices[0]]);
-					textureCoordinates.emplace_back(textureCoordinates_[textureIndices[1]]);
-					textureCoordinates.emplace_back(textureCoordinates_[textureIndices[2]]);
-
-					for (size_t n = 3; n < textureIndices.size(); n++)
-					{
-						textureCoordinates.emplace_back(textureCoordinates_[textureIndices[0]]);
-						textureCoordinates.emplace_back(textureCoordinates_[textureIndices[n - 1]]);
-						textureCoordinates.emplace_back(textureCoordinates_[textureIndices[n]]);
-					}
-				}
-			}
+	return group;
+}
 
-			Rendering::TriangleFaces triangleFaces;
-			triangleFaces.reserve(faces.size());
+Rendering::GeometryRef OBJScene::createGeometry(const Rendering::EngineRef& engine, const Mesh& mesh)
+{
+	try
+	{
+		Rendering::GeometryRef geometry(engine->factory().createGeometry());
+		Rendering::VertexSetRef vertexSet(engine->factory().createVertexSet());
+		Rendering::TrianglesRef triangles(engine->factory().createTriangles());
 
-			for (size_t n = 0; n < vertices.size(); n += 3)
-			{
-				triangleFaces.emplace_back(Index32(n));
-			}
+		vertexSet->setVertices(mesh.vertices_);
+		vertexSet->setNormals(mesh.normals_);
 
-			if (System::Performance::get().performanceLevel() >= System::Performance::LEVEL_HIGH || triangleFaces.size() <= 10000)
-			{
-				Rendering::TriangleFace::calculateSmoothedPerVertexNormals(triangleFaces, vertices, normals, Numeric::deg2rad(30));
-			}
+		if (mesh.facePair_.first & TYPE_VT)
+		{
+			vertexSet->setTextureCoordinates(mesh.textureCoordinates_, 0);
+		}
 
-			vertexSet->setVertices(vertices);
-			vertexSet->setNormals(normals);
+		triangles->setFaces(mesh.triangleFaces_);
+		triangles->setVertexSet(vertexSet);
 
-			if (facePair.first & TYPE_VT)
-			{
-				vertexSet->setTextureCoordinates(textureCoordinates, 0);
-			}
+		Rendering::AttributeSetRef attributeSet;
 
-			triangles->setFaces(triangleFaces);
-			triangles->setVertexSet(vertexSet);
+		if (mesh.facePair_.second == invalidMaterialIndex_)
+		{
+			attributeSet = engine->factory().createAttributeSet();
 
-			Rendering::AttributeSetRef attributeSet;
+			// we use a default material
+			attributeSet->addAttribute(engine->factory().createMaterial());
+		}
+		else
+		{
+			attributeSet = materials_[mesh.facePair_.second].attributeSet(engine, *this);
+		}
 
-			if (facePair.second == invalidMaterialIndex_)
-			{
-				attributeSet = engine->factory().createAttributeSet();
+		geometry->addRenderable(triangles, attributeSet);
 
-				// we use a default material
-				attributeSet->addAttribute(engine->factory().createMaterial());
-			}
-			else
-			{
-				attributeSet = materials_[facePair.second].attributeSet(engine, *this);
-			}
+		return geometry;
+	}
+	catch (const Exception& exception)
+	{
+		Log::error() << exception.what();
+	}
+	catch (...)
+	{
+		Log::error() << "Unknown exception during triangle creation.";
+	}
 
-			geometry->addRenderable(triangles, attributeSet);
-			group->addChild(geometry);
+	return Rendering::GeometryRef();
+}
 
-			sceneTriangles += (unsigned int)(triangleFaces.size());
+void OBJScene::createMesh(const Rendering::Vertices& sceneVertices, const Rendering::Normals& sceneNormals, const Rendering::TextureCoordinates& sceneTextureCoordinates, const FacePair& facePair, const Faces& faces, Mesh& mesh)
+{
+	mesh.facePair_ = facePair;
+
+	Rendering::Vertices& vertices = mesh.vertices_;
+	Rendering::Normals& normals = mesh.normals_;
+	Rendering::TextureCoordinates& textureCoordinates = mesh.textureCoordinates_;
+
+	for (const Face& face : faces)
+	{
+		const Rendering::VertexIndices& vertexIndices = face.vertexIndices();
+		const Rendering::VertexIndices& normalIndices = face.normalIndices();
+		const Rendering::VertexIndices& textureIndices = face.textureIndices();
+
+#ifdef OCEAN_DEBUG
+		for (size_t n = 0; n < vertexIndices.size(); n++)
+		{
+			ocean_assert(vertexIndices[n] <= sceneVertices.size());
 		}
-		catch (const Exception& exception)
+		for (size_t n = 0; n < normalIndices.size(); n++)
 		{
-			Log::error() << exception.what();
+			ocean_assert(normalIndices[n] <= sceneNormals.size());
 		}
-		catch (...)
+		for (size_t n = 0; n < textureIndices.size(); n++)
 		{
-			Log::error() << "Unknown exception during triangle creation.";
+			ocean_assert(textureIndices[n] <= sceneTextureCoordinates.size());
 		}
+#endif // OCEAN_DEBUG
 
-		facesMap_.erase(i++);
+		ocean_assert(vertexIndices.size() >= 3);
+
+		vertices.emplace_back(sceneVertices[vertexIndices[0]]);
+		vertices.emplace_back(sceneVertices[vertexIndices[1]]);
+		vertices.emplace_back(sceneVertices[vertexIndices[2]]);
+
+		for (unsigned int n = 3; n < vertexIndices.size(); n++)
+		{
+			vertices.emplace_back(sceneVertices[vertexIndices[0]]);
+			vertices.emplace_back(sceneVertices[vertexIndices[n - 1]]);
+			vertices.emplace_back(sceneVertices[vertexIndices[n]]);
+		}
+
+		if (face.type() & TYPE_VN)
+		{
+			ocean_assert(normalIndices.size() >= 3);
+
+			normals.emplace_back(sceneNormals[normalIndices[0]]);
+			normals.emplace_back(sceneNormals[normalIndices[1]]);
+			normals.emplace_back(sceneNormals[normalIndices[2]]);
+
+			for (unsigned int n = 3; n < normalIndices.size(); n++)
+			{
+				normals.emplace_back(sceneNormals[normalIndices[0]]);
+				normals.emplace_back(sceneNormals[normalIndices[n - 1]]);
+				normals.emplace_back(sceneNormals[normalIndices[n]]);
+			}
+		}
+		else
+		{
+			Rendering::Normal normal((sceneVertices[vertexIndices[1]] - sceneVertices[vertexIndices[0]]).cross(sceneVertices[vertexIndices.back()] - sceneVertices[vertexIndices[0]]));
+			if (normal.normalize())
+			{
+				normals.insert(normals.end(), 3 * (vertexIndices.size() - 2), normal);
+			}
+			else
+			{
+				Log::warning() << "Could not calculate a valid normal.";
+				normals.insert(normals.end(), 3 * (vertexIndices.size() - 2), Rendering::Normal(0, 0, 1));
+			}
+		}
+
+		if (face.type() & TYPE_VT)
+		{
+			ocean_assert(textureIndices.size() >= 3);
+
+			textureCoordinates.emplace_back(sceneTextureCoordinates[textureIndices[0]]);
+			textureCoordinates.emplace_back(sceneTextureCoordinates[textureIndices[1]]);
+			textureCoordinates.emplace_back(sceneTextureCoordinates[textureIndices[2]]);
+
+			for (size_t n = 3; n < textureIndices.size(); n++)
+			{
+				textureCoordinates.emplace_back(sceneTextureCoordinates[textureIndices[0]]);
+				textureCoordinates.emplace_back(sceneTextureCoordinates[textureIndices[n - 1]]);
+				textureCoordinates.emplace_back(sceneTextureCoordinates[textureIndices[n]]);
+			}
+		}
 	}
 
-	Log::info() << "\"" << filename() << "\" has " << sceneTriangles << " triangles.";
+	Rendering::TriangleFaces& triangleFaces = mesh.triangleFaces_;
+	triangleFaces.reserve(faces.size());
 
-	return group;
+	for (size_t n = 0; n < vertices.size(); n += 3)
+	{
+		triangleFaces.emplace_back(Index32(n));
+	}
+
+	if (System::Performance::get().performanceLevel() >= System::Performance::LEVEL_HIGH || triangleFaces.size() <= 10000)
+	{
+		Rendering::TriangleFace::calculateSmoothedPerVertexNormals(triangleFaces, vertices, normals, Numeric::deg2rad(30));
+	}
 }
 
 }
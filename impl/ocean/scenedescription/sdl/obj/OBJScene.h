@@ -14,6 +14,8 @@
 #include "ocean/scenedescription/SDLScene.h"
 
 #include "ocean/rendering/Rendering.h"
+#include "ocean/rendering/Geometry.h"
+#include "ocean/rendering/Group.h"
 #include "ocean/rendering/QuadFace.h"
 #include "ocean/rendering/TriangleFace.h"
 
@@ -138,6 +140,31 @@ class OCEAN_SCENEDESCRIPTION_SDL_OBJ_EXPORT OBJScene : public SDLScene
 		 */
 		using FacesMap = std::map<FacePair, Faces>;
 
+	protected:
+
+		/**
+		 * This class holds the triangulated data of all faces sharing the same face pair, ready to be used for a rendering object.
+		 */
+		class Mesh
+		{
+			public:
+
+				/// The face pair of the mesh.
+				FacePair facePair_ = FacePair(TYPE_V, invalidMaterialIndex_);
+
+				/// The vertices of the mesh, three for each triangle.
+				Rendering::Vertices vertices_;
+
+				/// The normals of the mesh, one for each vertex.
+				Rendering::Normals normals_;
+
+				/// The texture coordinates of the mesh, one for each vertex if the face pair holds texture coordinates.
+				Rendering::TextureCoordinates textureCoordinates_;
+
+				/// The triangle faces of the mesh.
+				Rendering::TriangleFaces triangleFaces_;
+		};
+
 	public:
 
 		/**
@@ -226,6 +253,45 @@ class OCEAN_SCENEDESCRIPTION_SDL_OBJ_EXPORT OBJScene : public SDLScene
 		 */
 		Rendering::NodeRef createTriangles(const Rendering::EngineRef& engine);
 
+		/**
+		 * Applies the scene progressively to the rendering engine, the meshes are added to the scene while they are created.
+		 * @see SDLScene::internalApplyProgressive().
+		 */
+		Rendering::SceneRef internalApplyProgressive(const Rendering::EngineRef& engine, bool& progressive) override;
+
+		/**
+		 * Creates the meshes of the scene in the background.
+		 * @see SDLScene::processProgressive().
+		 */
+		void processProgressive() override;
+
+		/**
+		 * Creates the meshes of a subset of all face pairs and adds a pending function for each mesh.
+		 * @param facesPairs The face pairs with their faces, must be valid
+		 * @param firstFacesPair The first face pair to be handled
+		 * @param numberFacesPairs The number of face pairs to be handled
+		 */
+		void createMeshesSubset(const std::vector<const FacesMap::value_type*>* facesPairs, const unsigned int firstFacesPair, const unsigned int numberFacesPairs);
+
+		/**
+		 * Creates the rendering geometry of a mesh.
+		 * @param engine Rendering engine to use
+		 * @param mesh The mesh for which the geometry will be created
+		 * @return The resulting geometry, invalid if the geometry could not be created
+		 */
+		Rendering::GeometryRef createGeometry(const Rendering::EngineRef& engine, const Mesh& mesh);
+
+		/**
+		 * Triangulates faces and determines the mesh's normals, this function does not use the rendering engine and can be invoked from any thread.
+		 * @param sceneVertices All vertices of the scene
+		 * @param sceneNormals All normals of the scene
+		 * @param sceneTextureCoordinates All texture coordinates of the scene
+		 * @param facePair The face pair of the faces
+		 * @param faces The faces to triangulate, at least one
+		 * @param mesh The resulting mesh
+		 */
+		static void createMesh(const Rendering::Vertices& sceneVertices, const Rendering::Normals& sceneNormals, const Rendering::TextureCoordinates& sceneTextureCoordinates, const FacePair& facePair, const Faces& faces, Mesh& mesh);
+
 	protected:
 
 		/// Vector holding all vertices of the obj scene.
@@ -248,6 +314,9 @@ class OCEAN_SCENEDESCRIPTION_SDL_OBJ_EXPORT OBJScene : public SDLScene
 
 		/// Current selected material index.
 		unsigned int selectedMaterialIndex_ = invalidMaterialIndex_;
+
+		/// The group receiving the meshes while the scene is applied progressively.
+		Rendering::GroupRef progressiveGroup_;
 };
 
 inline OBJScene::Face::Face(const Rendering::VertexIndices& vertexIndices, const Rendering::VertexIndices& normalIndices, const Rendering::VertexIndices& textureIndices) :
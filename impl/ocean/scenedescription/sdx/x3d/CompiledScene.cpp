@@ -0,0 +1,911 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "ocean/scenedescription/sdx/x3d/CompiledScene.h"
+#include "ocean/scenedescription/sdx/x3d/Factory.h"
+#include "ocean/scenedescription/sdx/x3d/X3DNode.h"
+#include "ocean/scenedescription/sdx/x3d/X3DScene.h"
+
+#include "ocean/base/String.h"
+
+#include "ocean/io/Directory.h"
+#include "ocean/io/File.h"
+#include "ocean/io/MemoryInputStream.h"
+#include "ocean/io/MemoryMappedFile.h"
+
+#include "ocean/scenedescription/DynamicNode.h"
+
+#include <cstdio>
+#include <fstream>
+
+namespace Ocean
+{
+
+namespace SceneDescription
+{
+
+namespace SDX
+{
+
+namespace X3D
+{
+
+void CompiledScene::setEnabled(const bool enable, const std::string& directory)
+{
+	const ScopedLock scopedLock(configurationLock());
+
+	configurationEnabled() = enable;
+	configurationDirectory() = directory;
+}
+
+bool CompiledScene::isEnabled()
+{
+	const ScopedLock scopedLock(configurationLock());
+
+	return configurationEnabled();
+}
+
+std::string CompiledScene::compiledFilename(const std::string& filename)
+{
+	ocean_assert(!filename.empty());
+
+	std::string directory;
+
+	{
+		const ScopedLock scopedLock(configurationLock());
+
+		directory = configurationDirectory();
+	}
+
+	if (directory.empty())
+	{
+		return filename + ".ocx3db";
+	}
+
+	// compiled scenes of several source files share the directory, the name is based on the hash of the source file's path (FNV-1a)
+
+	uint64_t hash = 14695981039346656037ull;
+
+	for (const char value : filename)
+	{
+		hash = (hash ^ uint64_t(uint8_t(value))) * 1099511628211ull;
+	}
+
+	return (IO::Directory(directory) + IO::File(IO::File(filename).baseName() + "_" + String::toAStringHex((unsigned long long)(hash), false) + ".ocx3db"))();
+}
+
+uint64_t CompiledScene::sourceHash(const std::string& filename)
+{
+	ocean_assert(!filename.empty());
+
+	const IO::MemoryMappedFile memoryMappedFile(filename);
+
+	if (!memoryMappedFile)
+	{
+		return 0ull;
+	}
+
+	// FNV-1a hash of the file's content, the size is part of the hash to make collisions even more unlikely
+
+	const uint8_t* data = memoryMappedFile.constdata<uint8_t>();
+	const size_t size = memoryMappedFile.size();
+
+	uint64_t hash = 14695981039346656037ull;
+
+	for (size_t n = 0; n < size; ++n)
+	{
+		hash = (hash ^ uint64_t(data[n])) * 1099511628211ull;
+	}
+
+	hash = (hash ^ uint64_t(size)) * 1099511628211ull;
+
+	return hash == 0ull ? 1ull : hash;
+}
+
+bool CompiledScene::write(const SDXScene& scene, const uint64_t sourceHash, const std::string& compiledFilename)
+{
+	ocean_assert(sourceHash != 0ull);
+	ocean_assert(!compiledFilename.empty());
+
+	NodeIndexMap nodeIndexMap;
+	Nodes nodes;
+
+	const MultiNode::Values& children = scene.field<MultiNode>("children").values();
+
+	for (const NodeRef& child : children)
+	{
+		gatherNodes(child, nodeIndexMap, nodes);
+	}
+
+	// the compiled scene is written to a temporary file first, so that concurrent readers never see a partial file
+
+	const std::string temporaryFilename(compiledFilename + ".tmp");
+
+	bool succeeded = false;
+
+	{
+		std::ofstream stream(temporaryFilename.c_str(), std::ios::binary);
+
+		if (!stream.is_open())
+		{
+			return false;
+		}
+
+		IO::OutputBitstream bitstream(stream);
+
+		succeeded = bitstream.write<unsigned long long>(IO::Tag::string2tag("OCX3DBIN"))
+						&& bitstream.write<uint32_t>(formatVersion_)
+						&& bitstream.write<uint32_t>(uint32_t(sizeof(Scalar)))
+						&& bitstream.write<unsigned long long>(sourceHash)
+						&& bitstream.write<uint32_t>(uint32_t(nodes.size()));
+
+		for (size_t nodeIndex = 0; succeeded && nodeIndex < nodes.size(); ++nodeIndex)
+		{
+			succeeded = bitstream.write<std::string>(nodes[nodeIndex]->type()) && bitstream.write<std::string>(nodes[nodeIndex]->name());
+		}
+
+		for (size_t nodeIndex = 0; succeeded && nodeIndex < nodes.size(); ++nodeIndex)
+		{
+			const SDXNode& node = *nodes[nodeIndex];
+
+			Strings compiledFieldNames;
+
+			for (const std::string& fieldName : node.fieldNames())
+			{
+				if (isCompiledField(node, fieldName))
+				{
+					compiledFieldNames.push_back(fieldName);
+				}
+			}
+
+			succeeded = bitstream.write<uint32_t>(uint32_t(compiledFieldNames.size()));
+
+			for (size_t n = 0; succeeded && n < compiledFieldNames.size(); ++n)
+			{
+				succeeded = bitstream.write<std::string>(compiledFieldNames[n]) && writeField(bitstream, node.field(compiledFieldNames[n]), nodeIndexMap);
+			}
+
+			const DynamicNodeRef dynamicNode(nodes[nodeIndex]);
+
+			const unsigned int dynamicFields = dynamicNode ? dynamicNode->dynamicFields() : 0u;
+
+			succeeded = succeeded && bitstream.write<uint32_t>(dynamicFields);
+
+			for (unsigned int n = 0u; succeeded && n < dynamicFields; ++n)
+			{
+				const std::string& fieldName = dynamicNode->dynamicFieldName(n);
+				const Field& field = dynamicNode->dynamicField(fieldName);
+
+				succeeded = bitstream.write<std::string>(fieldName) && bitstream.write<uint32_t>(uint32_t(field.type())) && bitstream.write<uint32_t>(field.dimension()) && writeField(bitstream, field, nodeIndexMap);
+			}
+		}
+
+		// the routes, each route is composed of the index of the start node, the start field, the index of the target node, and the target field
+
+		std::vector<std::pair<unsigned int, const X3DNode::FieldConnectionMap::value_type*>> routes;
+
+		for (size_t nodeIndex = 0; succeeded && nodeIndex < nodes.size(); ++nodeIndex)
+		{
+			const X3DNodeRef x3dNode(nodes[nodeIndex]);
+
+			if (x3dNode)
+			{
+				for (const X3DNode::FieldConnectionMap::value_type& connection : x3dNode->fieldConnections_)
+				{
+					if (nodeIndexMap.find(connection.second.first) != nodeIndexMap.cend())
+					{
+						routes.emplace_back((unsigned int)(nodeIndex), &connection);
+					}
+				}
+			}
+		}
+
+		succeeded = succeeded && bitstream.write<uint32_t>(uint32_t(routes.size()));
+
+		for (size_t n = 0; succeeded && n < routes.size(); ++n)
+		{
+			const X3DNode::FieldConnectionMap::value_type& connection = *routes[n].second;
+
+			succeeded = bitstream.write<uint32_t>(routes[n].first) && bitstream.write<std::string>(connection.first)
+							&& bitstream.write<uint32_t>(nodeIndexMap.find(connection.second.first)->second) && bitstream.write<std::string>(connection.second.second);
+		}
+
+		succeeded = succeeded && bitstream.write<uint32_t>(uint32_t(children.size()));
+
+		for (size_t n = 0; succeeded && n < children.size(); ++n)
+		{
+			const NodeIndexMap::const_iterator iNode = children[n] ? nodeIndexMap.find(children[n]->id()) : nodeIndexMap.cend();
+
+			succeeded = bitstream.write<int32_t>(iNode != nodeIndexMap.cend() ? int32_t(iNode->second) : int32_t(-1));
+		}
+
+		succeeded = succeeded && stream.good();
+	}
+
+	if (!succeeded)
+	{
+		std::remove(temporaryFilename.c_str());
+		return false;
+	}
+
+	std::remove(compiledFilename.c_str());
+
+	if (std::rename(temporaryFilename.c_str(), compiledFilename.c_str()) != 0)
+	{
+		std::remove(temporaryFilename.c_str());
+		return false;
+	}
+
+	return true;
+}
+
+SDXSceneRef CompiledScene::read(const std::string& compiledFilename, const uint64_t sourceHash, const std::string& filename, const Library& library, const Rendering::EngineRef& engine, const Timestamp& timestamp)
+{
+	ocean_assert(!compiledFilename.empty() && !filename.empty());
+	ocean_assert(timestamp.isValid());
+
+	if (sourceHash == 0ull || engine.isNull())
+	{
+		return SDXSceneRef();
+	}
+
+	const IO::MemoryMappedFile memoryMappedFile(compiledFilename);
+
+	if (!memoryMappedFile)
+	{
+		return SDXSceneRef();
+	}
+
+	IO::MemoryInputStream stream(memoryMappedFile.constdata(), memoryMappedFile.size());
+	IO::InputBitstream bitstream(stream);
+
+	unsigned long long tag = 0ull;
+	uint32_t version = 0u;
+	uint32_t scalarSize = 0u;
+	unsigned long long compiledSourceHash = 0ull;
+
+	if (!bitstream.read<unsigned long long>(tag) || tag != IO::Tag::string2tag("OCX3DBIN")
+			|| !bitstream.read<uint32_t>(version) || version != formatVersion_
+			|| !bitstream.read<uint32_t>(scalarSize) || scalarSize != uint32_t(sizeof(Scalar))
+			|| !bitstream.read<unsigned long long>(compiledSourceHash) || compiledSourceHash != sourceHash)
+	{
+		return SDXSceneRef();
+	}
+
+	size_t numberNodes = 0;
+
+	// each node needs at least two string lengths
+
+	if (!readSize(bitstream, sizeof(uint32_t) * 2, numberNodes))
+	{
+		return SDXSceneRef();
+	}
+
+	X3DScene* scenePtr = new X3DScene(filename, library, engine);
+	const SDXSceneRef scene(library.nodeManager().registerNode(scenePtr));
+
+	Nodes nodes;
+	nodes.reserve(numberNodes);
+
+	std::string type;
+	std::string name;
+
+	for (size_t n = 0; n < numberNodes; ++n)
+	{
+		if (!bitstream.read<std::string>(type) || !bitstream.read<std::string>(name))
+		{
+			return SDXSceneRef();
+		}
+
+		SDXNodeRef node(Factory::createNode(type, scenePtr->environment()));
+
+		if (node.isNull())
+		{
+			Log::warning() << "The compiled scene \"" << compiledFilename << "\" contains the unknown node \"" << type << "\".";
+			return SDXSceneRef();
+		}
+
+		if (!name.empty())
+		{
+			node->setName(name);
+		}
+
+		nodes.emplace_back(std::move(node));
+	}
+
+	std::string fieldName;
+
+	for (const SDXNodeRef& node : nodes)
+	{
+		uint32_t numberFields = 0u;
+		if (!bitstream.read<uint32_t>(numberFields))
+		{
+			return SDXSceneRef();
+		}
+
+		for (uint32_t n = 0u; n < numberFields; ++n)
+		{
+			if (!bitstream.read<std::string>(fieldName) || !node->hasField(fieldName) || !readField(bitstream, node->field(fieldName), nodes, timestamp))
+			{
+				return SDXSceneRef();
+			}
+		}
+
+		uint32_t numberDynamicFields = 0u;
+		if (!bitstream.read<uint32_t>(numberDynamicFields))
+		{
+			return SDXSceneRef();
+		}
+
+		if (numberDynamicFields != 0u)
+		{
+			const DynamicNodeRef dynamicNode(node);
+
+			if (dynamicNode.isNull())
+			{
+				return SDXSceneRef();
+			}
+
+			for (uint32_t n = 0u; n < numberDynamicFields; ++n)
+			{
+				uint32_t fieldType = 0u;
+				uint32_t fieldDimension = 0u;
+
+				if (!bitstream.read<std::string>(fieldName) || !bitstream.read<uint32_t>(fieldType) || !bitstream.read<uint32_t>(fieldDimension))
+				{
+					return SDXSceneRef();
+				}
+
+				const std::unique_ptr<Field> field(createField(Field::Type(fieldType), fieldDimension));
+
+				if (!field || !dynamicNode->addField(fieldName, *field) || !readField(bitstream, dynamicNode->dynamicField(fieldName), nodes, timestamp))
+				{
+					return SDXSceneRef();
+				}
+			}
+		}
+	}
+
+	uint32_t numberRoutes = 0u;
+	if (!bitstream.read<uint32_t>(numberRoutes))
+	{
+		return SDXSceneRef();
+	}
+
+	std::string targetFieldName;
+
+	for (uint32_t n = 0u; n < numberRoutes; ++n)
+	{
+		uint32_t startIndex = 0u;
+		uint32_t targetIndex = 0u;
+
+		if (!bitstream.read<uint32_t>(startIndex) || !bitstream.read<std::string>(fieldName) || !bitstream.read<uint32_t>(targetIndex) || !bitstream.read<std::string>(targetFieldName))
+		{
+			return SDXSceneRef();
+		}
+
+		if (size_t(startIndex) >= nodes.size() || size_t(targetIndex) >= nodes.size())
+		{
+			return SDXSceneRef();
+		}
+
+		const X3DNodeRef startNode(nodes[startIndex]);
+
+		if (startNode.isNull())
+		{
+			return SDXSceneRef();
+		}
+
+		startNode->addConnection(fieldName, nodes[targetIndex]->id(), targetFieldName);
+	}
+
+	size_t numberChildren = 0;
+	if (!readSize(bitstream, sizeof(int32_t), numberChildren))
+	{
+		return SDXSceneRef();
+	}
+
+	MultiNode::Values children;
+	children.reserve(numberChildren);
+
+	for (size_t n = 0; n < numberChildren; ++n)
+	{
+		int32_t nodeIndex = -1;
+
+		if (!bitstream.read<int32_t>(nodeIndex) || nodeIndex >= int32_t(nodes.size()))
+		{
+			return SDXSceneRef();
+		}
+
+		if (nodeIndex >= 0)
+		{
+			children.emplace_back(nodes[nodeIndex]);
+		}
+	}
+
+	scene->field<MultiNode>("children").setValues(children, timestamp);
+	scene->initialize(timestamp);
+
+	return scene;
+}
+
+void CompiledScene::gatherNodes(const NodeRef& node, NodeIndexMap& nodeIndexMap, Nodes& nodes)
+{
+	if (node.isNull() || nodeIndexMap.find(node->id()) != nodeIndexMap.cend())
+	{
+		return;
+	}
+
+	const SDXNodeRef sdxNode(node);
+
+	if (sdxNode.isNull())
+	{
+		return;
+	}
+
+	nodeIndexMap.emplace(node->id(), (unsigned int)(nodes.size()));
+	nodes.push_back(sdxNode);
+
+	for (const std::string& fieldName : node->fieldNames())
+	{
+		if (node->fieldType(fieldName) == Field::TYPE_NODE && isCompiledField(*sdxNode, fieldName))
+		{
+			const Field& field = node->field(fieldName);
+
+			if (field.is0D())
+			{
+				gatherNodes(static_cast<const SingleNode&>(field).value(), nodeIndexMap, nodes);
+			}
+			else
+			{
+				for (const NodeRef& childNode : static_cast<const MultiNode&>(field).values())
+				{
+					gatherNodes(childNode, nodeIndexMap, nodes);
+				}
+			}
+		}
+	}
+
+	const DynamicNodeRef dynamicNode(node);
+
+	if (dynamicNode)
+	{
+		for (unsigned int n = 0u; n < dynamicNode->dynamicFields(); ++n)
+		{
+			const Field& field = dynamicNode->dynamicField(dynamicNode->dynamicFieldName(n));
+
+			if (field.type() == Field::TYPE_NODE)
+			{
+				if (field.is0D())
+				{
+					gatherNodes(static_cast<const SingleNode&>(field).value(), nodeIndexMap, nodes);
+				}
+				else
+				{
+					for (const NodeRef& childNode : static_cast<const MultiNode&>(field).values())
+					{
+						gatherNodes(childNode, nodeIndexMap, nodes);
+					}
+				}
+			}
+		}
+	}
+}
+
+bool CompiledScene::isCompiledField(const SDXNode& node, const std::string& fieldName)
+{
+	// fields which have never been set keep their default values, output fields are determined by the node itself
+
+	if (node.field(fieldName).timestamp().isInvalid())
+	{
+		return false;
+	}
+
+	return (node.fieldAccessType(fieldName) & Node::ACCESS_GET_SET) != Node::ACCESS_GET;
+}
+
+bool CompiledScene::writeField(IO::OutputBitstream& bitstream, const Field& field, const NodeIndexMap& nodeIndexMap)
+{
+	if (!bitstream.write<uint32_t>(uint32_t(field.type())) || !bitstream.write<uint32_t>(field.dimension()))
+	{
+		return false;
+	}
+
+	switch (field.type())
+	{
+		case Field::TYPE_BOOLEAN:
+		{
+			if (field.is0D())
+			{
+				return bitstream.write<uint32_t>(1u) && bitstream.write<uint8_t>(static_cast<const SingleBool&>(field).value() ? 1u : 0u);
+			}
+
+			const MultiBool::Values& values = static_cast<const MultiBool&>(field).values();
+
+			bool result = bitstream.write<uint32_t>(uint32_t(values.size()));
+
+			for (size_t n = 0; result && n < values.size(); ++n)
+			{
+				result = bitstream.write<uint8_t>(values[n] ? 1u : 0u);
+			}
+
+			return result;
+		}
+
+		case Field::TYPE_COLOR:
+			return writeValues<RGBAColor, float, 4u>(bitstream, field);
+
+		case Field::TYPE_FLOAT:
+			return writeValues<Scalar, Scalar, 1u>(bitstream, field);
+
+		case Field::TYPE_INT:
+			return writeValues<int, int, 1u>(bitstream, field);
+
+		case Field::TYPE_MATRIX3:
+			return writeValues<SquareMatrix3, Scalar, 9u>(bitstream, field);
+
+		case Field::TYPE_MATRIX4:
+			return writeValues<SquareMatrix4, Scalar, 16u>(bitstream, field);
+
+		case Field::TYPE_NODE:
+		{
+			const MultiNode::Values values = field.is0D() ? MultiNode::Values(1, static_cast<const SingleNode&>(field).value()) : static_cast<const MultiNode&>(field).values();
+
+			bool result = bitstream.write<uint32_t>(uint32_t(values.size()));
+
+			for (size_t n = 0; result && n < values.size(); ++n)
+			{
+				const NodeIndexMap::const_iterator iNode = values[n] ? nodeIndexMap.find(values[n]->id()) : nodeIndexMap.cend();
+
+				result = bitstream.write<int32_t>(iNode != nodeIndexMap.cend() ? int32_t(iNode->second) : int32_t(-1));
+			}
+
+			return result;
+		}
+
+		case Field::TYPE_ROTATION:
+			return writeValues<Rotation, Scalar, 4u>(bitstream, field);
+
+		case Field::TYPE_STRING:
+		{
+			if (field.is0D())
+			{
+				return bitstream.write<uint32_t>(1u) && bitstream.write<std::string>(static_cast<const SingleString&>(field).value());
+			}
+
+			const MultiString::Values& values = static_cast<const MultiString&>(field).values();
+
+			bool result = bitstream.write<uint32_t>(uint32_t(values.size()));
+
+			for (size_t n = 0; result && n < values.size(); ++n)
+			{
+				result = bitstream.write<std::string>(values[n]);
+			}
+
+			return result;
+		}
+
+		case Field::TYPE_TIME:
+		{
+			if (field.is0D())
+			{
+				return bitstream.write<uint32_t>(1u) && bitstream.write<double>(double(static_cast<const SingleTime&>(field).value()));
+			}
+
+			const MultiTime::Values& values = static_cast<const MultiTime&>(field).values();
+
+			bool result = bitstream.write<uint32_t>(uint32_t(values.size()));
+
+			for (size_t n = 0; result && n < values.size(); ++n)
+			{
+				result = bitstream.write<double>(double(values[n]));
+			}
+
+			return result;
+		}
+
+		case Field::TYPE_VECTOR2:
+			return writeValues<Vector2, Scalar, 2u>(bitstream, field);
+
+		case Field::TYPE_VECTOR3:
+			return writeValues<Vector3, Scalar, 3u>(bitstream, field);
+
+		case Field::TYPE_VECTOR4:
+			return writeValues<Vector4, Scalar, 4u>(bitstream, field);
+
+		case Field::TYPE_INVALID:
+			break;
+	}
+
+	ocean_assert(false && "Invalid field type!");
+	return false;
+}
+
+bool CompiledScene::readField(IO::InputBitstream& bitstream, Field& field, const Nodes& nodes, const Timestamp& timestamp)
+{
+	uint32_t type = 0u;
+	uint32_t dimension = 0u;
+
+	if (!bitstream.read<uint32_t>(type) || !bitstream.read<uint32_t>(dimension) || type != uint32_t(field.type()) || dimension != field.dimension())
+	{
+		return false;
+	}
+
+	switch (field.type())
+	{
+		case Field::TYPE_BOOLEAN:
+		{
+			size_t size = 0;
+			if (!readSize(bitstream, sizeof(uint8_t), size) || (field.is0D() && size != 1))
+			{
+				return false;
+			}
+
+			MultiBool::Values values(size);
+
+			for (size_t n = 0; n < size; ++n)
+			{
+				uint8_t value = 0u;
+				if (!bitstream.read<uint8_t>(value))
+				{
+					return false;
+				}
+
+				values[n] = value != 0u;
+			}
+
+			if (field.is0D())
+			{
+				static_cast<SingleBool&>(field).setValue(values.front(), timestamp);
+			}
+			else
+			{
+				static_cast<MultiBool&>(field).setValues(values, timestamp);
+			}
+
+			return true;
+		}
+
+		case Field::TYPE_COLOR:
+			return readValues<RGBAColor, float, 4u>(bitstream, field, timestamp);
+
+		case Field::TYPE_FLOAT:
+			return readValues<Scalar, Scalar, 1u>(bitstream, field, timestamp);
+
+		case Field::TYPE_INT:
+			return readValues<int, int, 1u>(bitstream, field, timestamp);
+
+		case Field::TYPE_MATRIX3:
+			return readValues<SquareMatrix3, Scalar, 9u>(bitstream, field, timestamp);
+
+		case Field::TYPE_MATRIX4:
+			return readValues<SquareMatrix4, Scalar, 16u>(bitstream, field, timestamp);
+
+		case Field::TYPE_NODE:
+		{
+			size_t size = 0;
+			if (!readSize(bitstream, sizeof(int32_t), size) || (field.is0D() && size != 1))
+			{
+				return false;
+			}
+
+			MultiNode::Values values;
+			values.reserve(size);
+
+			for (size_t n = 0; n < size; ++n)
+			{
+				int32_t nodeIndex = -1;
+
+				if (!bitstream.read<int32_t>(nodeIndex) || nodeIndex >= int32_t(nodes.size()))
+				{
+					return false;
+				}
+
+				values.emplace_back(nodeIndex >= 0 ? NodeRef(nodes[nodeIndex]) : NodeRef());
+			}
+
+			if (field.is0D())
+			{
+				static_cast<SingleNode&>(field).setValue(values.front(), timestamp);
+			}
+			else
+			{
+				static_cast<MultiNode&>(field).setValues(values, timestamp);
+			}
+
+			return true;
+		}
+
+		case Field::TYPE_ROTATION:
+			return readValues<Rotation, Scalar, 4u>(bitstream, field, timestamp);
+
+		case Field::TYPE_STRING:
+		{
+			size_t size = 0;
+			if (!readSize(bitstream, sizeof(uint32_t), size) || (field.is0D() && size != 1))
+			{
+				return false;
+			}
+
+			MultiString::Values values(size);
+
+			for (size_t n = 0; n < size; ++n)
+			{
+				if (!bitstream.read<std::string>(values[n]))
+				{
+					return false;
+				}
+			}
+
+			if (field.is0D())
+			{
+				static_cast<SingleString&>(field).setValue(values.front(), timestamp);
+			}
+			else
+			{
+				static_cast<MultiString&>(field).setValues(values, timestamp);
+			}
+
+			return true;
+		}
+
+		case Field::TYPE_TIME:
+		{
+			size_t size = 0;
+			if (!readSize(bitstream, sizeof(double), size) || (field.is0D() && size != 1))
+			{
+				return false;
+			}
+
+			MultiTime::Values values;
+			values.reserve(size);
+
+			for (size_t n = 0; n < size; ++n)
+			{
+				double value = 0.0;
+				if (!bitstream.read<double>(value))
+				{
+					return false;
+				}
+
+				values.emplace_back(value);
+			}
+
+			if (field.is0D())
+			{
+				static_cast<SingleTime&>(field).setValue(values.front(), timestamp);
+			}
+			else
+			{
+				static_cast<MultiTime&>(field).setValues(values, timestamp);
+			}
+
+			return true;
+		}
+
+		case Field::TYPE_VECTOR2:
+			return readValues<Vector2, Scalar, 2u>(bitstream, field, timestamp);
+
+		case Field::TYPE_VECTOR3:
+			return readValues<Vector3, Scalar, 3u>(bitstream, field, timestamp);
+
+		case Field::TYPE_VECTOR4:
+			return readValues<Vector4, Scalar, 4u>(bitstream, field, timestamp);
+
+		case Field::TYPE_INVALID:
+			break;
+	}
+
+	return false;
+}
+
+std::unique_ptr<Field> CompiledScene::createField(const Field::Type type, const unsigned int dimension)
+{
+	if (dimension > 1u)
+	{
+		return nullptr;
+	}
+
+	const bool is0D = dimension == 0u;
+
+	switch (type)
+	{
+		case Field::TYPE_BOOLEAN:
+			return is0D ? std::unique_ptr<Field>(new SingleBool()) : std::unique_ptr<Field>(new MultiBool());
+
+		case Field::TYPE_COLOR:
+			return is0D ? std::unique_ptr<Field>(new SingleColor()) : std::unique_ptr<Field>(new MultiColor());
+
+		case Field::TYPE_FLOAT:
+			return is0D ? std::unique_ptr<Field>(new SingleFloat()) : std::unique_ptr<Field>(new MultiFloat());
+
+		case Field::TYPE_INT:
+			return is0D ? std::unique_ptr<Field>(new SingleInt()) : std::unique_ptr<Field>(new MultiInt());
+
+		case Field::TYPE_MATRIX3:
+			return is0D ? std::unique_ptr<Field>(new SingleMatrix3()) : std::unique_ptr<Field>(new MultiMatrix3());
+
+		case Field::TYPE_MATRIX4:
+			return is0D ? std::unique_ptr<Field>(new SingleMatrix4()) : std::unique_ptr<Field>(new MultiMatrix4());
+
+		case Field::TYPE_NODE:
+			return is0D ? std::unique_ptr<Field>(new SingleNode()) : std::unique_ptr<Field>(new MultiNode());
+
+		case Field::TYPE_ROTATION:
+			return is0D ? std::unique_ptr<Field>(new SingleRotation()) : std::unique_ptr<Field>(new MultiRotation());
+
+		case Field::TYPE_STRING:
+			return is0D ? std::unique_ptr<Field>(new SingleString()) : std::unique_ptr<Field>(new MultiString());
+
+		case Field::TYPE_TIME:
+			return is0D ? std::unique_ptr<Field>(new SingleTime()) : std::unique_ptr<Field>(new MultiTime());
+
+		case Field::TYPE_VECTOR2:
+			return is0D ? std::unique_ptr<Field>(new SingleVector2()) : std::unique_ptr<Field>(new MultiVector2());
+
+		case Field::TYPE_VECTOR3:
+			return is0D ? std::unique_ptr<Field>(new SingleVector3()) : std::unique_ptr<Field>(new MultiVector3());
+
+		case Field::TYPE_VECTOR4:
+			return is0D ? std::unique_ptr<Field>(new SingleVector4()) : std::unique_ptr<Field>(new MultiVector4());
+
+		case Field::TYPE_INVALID:
+			break;
+	}
+
+	return nullptr;
+}
+
+bool CompiledScene::readSize(IO::InputBitstream& bitstream, const size_t minimalElementSize, size_t& size)
+{
+	ocean_assert(minimalElementSize >= 1);
+
+	uint32_t value = 0u;
+	if (!bitstream.read<uint32_t>(value))
+	{
+		return false;
+	}
+
+	// a corrupted size must not result in a huge allocation
+
+	const uint64_t position = bitstream.position();
+	const uint64_t streamSize = bitstream.size();
+
+	if (position > streamSize || uint64_t(value) * uint64_t(minimalElementSize) > streamSize - position)
+	{
+		return false;
+	}
+
+	size = size_t(value);
+	return true;
+}
+
+Lock& CompiledScene::configurationLock()
+{
+	static Lock lock;
+	return lock;
+}
+
+std::string& CompiledScene::configurationDirectory()
+{
+	static std::string directory;
+	return directory;
+}
+
+bool& CompiledScene::configurationEnabled()
+{
+	static bool enabled = true;
+	return enabled;
+}
+
+}
+
+}
+
+}
+
+}
@@ -0,0 +1,274 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#ifndef META_OCEAN_SCENEDESCRIPTION_SDX_X3D_COMPILED_SCENE_H
+#define META_OCEAN_SCENEDESCRIPTION_SDX_X3D_COMPILED_SCENE_H
+
+#include "ocean/scenedescription/sdx/x3d/X3D.h"
+
+#include "ocean/base/Lock.h"
+
+#include "ocean/io/Bitstream.h"
+
+#include "ocean/scenedescription/Library.h"
+#include "ocean/scenedescription/SDXScene.h"
+#include "ocean/scenedescription/Field0D.h"
+#include "ocean/scenedescription/Field1D.h"
+
+#include <memory>
+#include <unordered_map>
+
+namespace Ocean
+{
+
+namespace SceneDescription
+{
+
+namespace SDX
+{
+
+namespace X3D
+{
+
+/**
+ * This class implements a compiled binary representation of x3d scenes.
+ * A compiled scene stores the node graph of a parsed scene: the nodes with their types and names, the values of all fields which have been set, dynamic fields, and routes.<br>
+ * Loading a compiled scene does not need any text parsing, the file is memory mapped and the field values are copied in blocks so that loading mostly means creating the nodes.<br>
+ * Each compiled scene holds the hash of the source file it has been created from, a compiled scene is used only as long as the source file does not change.
+ * @ingroup scenedescriptionsdxx3d
+ */
+class OCEAN_SCENEDESCRIPTION_SDX_X3D_EXPORT CompiledScene
+{
+	protected:
+
+		/**
+		 * Definition of a map mapping node ids to node indices.
+		 */
+		using NodeIndexMap = std::unordered_map<NodeId, unsigned int>;
+
+		/**
+		 * Definition of a vector holding nodes.
+		 */
+		using Nodes = std::vector<SDXNodeRef>;
+
+		/// The version of the compiled scene format.
+		static constexpr uint32_t formatVersion_ = 1u;
+
+	public:
+
+		/**
+		 * Enables or disables compiled scenes, compiled scenes are enabled by default.
+		 * @param enable True, to create compiled scenes when loading a scene for the first time and to use them when loading the scene again
+		 * @param directory The directory in which compiled scenes are stored, empty to store the compiled scene next to the source file
+		 */
+		static void setEnabled(const bool enable, const std::string& directory = std::string());
+
+		/**
+		 * Returns whether compiled scenes are enabled.
+		 * @return True, if so
+		 */
+		static bool isEnabled();
+
+		/**
+		 * Returns the filename of the compiled scene for a given source file.
+		 * @param filename The filename of the source file, must be valid
+		 * @return The filename of the compiled scene
+		 */
+		static std::string compiledFilename(const std::string& filename);
+
+		/**
+		 * Determines the hash of a source file.
+		 * @param filename The filename of the source file, must be valid
+		 * @return The hash of the file, 0 if the file could not be read
+		 */
+		static uint64_t sourceHash(const std::string& filename);
+
+		/**
+		 * Writes a parsed scene as compiled scene.
+		 * @param scene The scene to write, must be valid
+		 * @param sourceHash The hash of the source file of the scene, must not be 0
+		 * @param compiledFilename The filename of the compiled scene, must be valid
+		 * @return True, if succeeded
+		 */
+		static bool write(const SDXScene& scene, const uint64_t sourceHash, const std::string& compiledFilename);
+
+		/**
+		 * Reads a compiled scene and creates the scene's nodes.
+		 * @param compiledFilename The filename of the compiled scene, must be valid
+		 * @param sourceHash The hash of the current source file, the compiled scene is used only if it has been created from a source file with identical hash
+		 * @param filename The filename of the source file, must be valid
+		 * @param library The library providing all nodes
+		 * @param engine Rendering engine object to create corresponding rendering object from
+		 * @param timestamp The timestamp all scene objects will be initialized with, must be valid
+		 * @return The resulting scene, invalid if the compiled scene does not exist, does not match the source file, or is corrupted
+		 */
+		static SDXSceneRef read(const std::string& compiledFilename, const uint64_t sourceHash, const std::string& filename, const Library& library, const Rendering::EngineRef& engine, const Timestamp& timestamp);
+
+	protected:
+
+		/**
+		 * Gathers a node and all nodes referenced by the node's fields.
+		 * @param node The node to gather, can be invalid
+		 * @param nodeIndexMap The map receiving the indices of all gathered nodes
+		 * @param nodes The gathered nodes
+		 */
+		static void gatherNodes(const NodeRef& node, NodeIndexMap& nodeIndexMap, Nodes& nodes);
+
+		/**
+		 * Returns whether a standard field of a node is written to a compiled scene.
+		 * Fields which have not been set and output fields are not written.
+		 * @param node The node owning the field, must be valid
+		 * @param fieldName The name of the field
+		 * @return True, if so
+		 */
+		static bool isCompiledField(const SDXNode& node, const std::string& fieldName);
+
+		/**
+		 * Writes the value of a field.
+		 * @param bitstream The bitstream receiving the value
+		 * @param field The field to write
+		 * @param nodeIndexMap The map with indices of all nodes of the scene
+		 * @return True, if succeeded
+		 */
+		static bool writeField(IO::OutputBitstream& bitstream, const Field& field, const NodeIndexMap& nodeIndexMap);
+
+		/**
+		 * Reads the value of a field.
+		 * @param bitstream The bitstream providing the value
+		 * @param field The field receiving the value
+		 * @param nodes All nodes of the scene
+		 * @param timestamp The timestamp of the field
+		 * @return True, if succeeded
+		 */
+		static bool readField(IO::InputBitstream& bitstream, Field& field, const Nodes& nodes, const Timestamp& timestamp);
+
+		/**
+		 * Creates a new field with specific type and dimension.
+		 * @param type The type of the field
+		 * @param dimension The dimension of the field, with range [0, 1]
+		 * @return The new field, nullptr if the type is not supported
+		 */
+		static std::unique_ptr<Field> createField(const Field::Type type, const unsigned int dimension);
+
+		/**
+		 * Writes the values of a field with trivially copyable elements.
+		 * @param bitstream The bitstream receiving the values
+		 * @param field The field to write, either a Field0D<T> or a Field1D<T> object
+		 * @return True, if succeeded
+		 * @tparam T The data type of the field's elements
+		 * @tparam TScalar The data type of the scalar values of each element
+		 * @tparam tScalars The number of scalar values of each element, with range [1, infinity)
+		 */
+		template <typename T, typename TScalar, unsigned int tScalars>
+		static bool writeValues(IO::OutputBitstream& bitstream, const Field& field);
+
+		/**
+		 * Reads the values of a field with trivially copyable elements.
+		 * @param bitstream The bitstream providing the values
+		 * @param field The field receiving the values, either a Field0D<T> or a Field1D<T> object
+		 * @param timestamp The timestamp of the field
+		 * @return True, if succeeded
+		 * @tparam T The data type of the field's elements
+		 * @tparam TScalar The data type of the scalar values of each element
+		 * @tparam tScalars The number of scalar values of each element, with range [1, infinity)
+		 */
+		template <typename T, typename TScalar, unsigned int tScalars>
+		static bool readValues(IO::InputBitstream& bitstream, Field& field, const Timestamp& timestamp);
+
+		/**
+		 * Reads the number of elements of a field and checks whether the bitstream can hold the elements.
+		 * @param bitstream The bitstream providing the number
+		 * @param minimalElementSize The minimal number of bytes each element needs in the bitstream, with range [1, infinity)
+		 * @param size The resulting number of elements
+		 * @return True, if succeeded
+		 */
+		static bool readSize(IO::InputBitstream& bitstream, const size_t minimalElementSize, size_t& size);
+
+		/**
+		 * Returns the lock of the configuration.
+		 * @return The configuration lock
+		 */
+		static Lock& configurationLock();
+
+		/**
+		 * Returns the directory in which compiled scenes are stored.
+		 * @return The directory, empty to store the compiled scenes next to the source files
+		 */
+		static std::string& configurationDirectory();
+
+		/**
+		 * Returns whether compiled scenes are enabled.
+		 * @return The enable state
+		 */
+		static bool& configurationEnabled();
+};
+
+template <typename T, typename TScalar, unsigned int tScalars>
+bool CompiledScene::writeValues(IO::OutputBitstream& bitstream, const Field& field)
+{
+	static_assert(sizeof(T) == sizeof(TScalar) * tScalars, "Invalid element type!");
+
+	if (field.is0D())
+	{
+		const T& value = static_cast<const Field0D<T>&>(field).value();
+
+		return bitstream.write<uint32_t>(1u) && bitstream.writeArray<TScalar>((const TScalar*)(&value), tScalars);
+	}
+
+	const typename Field1D<T>::Values& values = static_cast<const Field1D<T>&>(field).values();
+
+	return bitstream.write<uint32_t>(uint32_t(values.size())) && bitstream.writeArray<TScalar>((const TScalar*)(values.data()), values.size() * tScalars);
+}
+
+template <typename T, typename TScalar, unsigned int tScalars>
+bool CompiledScene::readValues(IO::InputBitstream& bitstream, Field& field, const Timestamp& timestamp)
+{
+	static_assert(sizeof(T) == sizeof(TScalar) * tScalars, "Invalid element type!");
+
+	size_t size = 0;
+	if (!readSize(bitstream, sizeof(T), size))
+	{
+		return false;
+	}
+
+	if (field.is0D())
+	{
+		T value;
+
+		if (size != 1 || !bitstream.readArray<TScalar>((TScalar*)(&value), tScalars))
+		{
+			return false;
+		}
+
+		static_cast<Field0D<T>&>(field).setValue(value, timestamp);
+		return true;
+	}
+
+	typename Field1D<T>::Values values(size);
+
+	if (!bitstream.readArray<TScalar>((TScalar*)(values.data()), size * tScalars))
+	{
+		return false;
+	}
+
+	Field1D<T>& field1D = static_cast<Field1D<T>&>(field);
+
+	std::swap(field1D.values(), values);
+	field1D.setTimestamp(timestamp);
+
+	return true;
+}
+
+}
+
+}
+
+}
+
+}
+
+#endif // META_OCEAN_SCENEDESCRIPTION_SDX_X3D_COMPILED_SCENE_H
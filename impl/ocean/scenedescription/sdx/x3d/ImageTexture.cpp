@@ -60,7 +60,7 @@ void ImageTexture::onInitialize(const Rendering::SceneRef& scene, const Timestam
 			}
 		}
 
-		applyUrl(urls, Media::Medium::IMAGE);
+		applyUrlAsynchronously(urls, Media::Medium::IMAGE);
 
 		if (urls.empty() && !resolvedFiles.empty())
 		{
@@ -88,7 +88,7 @@ void ImageTexture::onFieldChanged(const std::string& fieldName)
 			}
 		}
 
-		applyUrl(urls, Media::Medium::IMAGE);
+		applyUrlAsynchronously(urls, Media::Medium::IMAGE);
 		return;
 	}
 
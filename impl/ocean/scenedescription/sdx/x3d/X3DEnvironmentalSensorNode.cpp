@@ -112,6 +112,12 @@ void X3DEnvironmentalSensorNode::onUpdate(const Rendering::ViewRef& view, const
 	}
 }
 
+bool X3DEnvironmentalSensorNode::needsContinuousUpdate(const Timestamp /*timestamp*/) const
+{
+	// an enabled sensor needs to check the view's position in each frame
+	return enabled_.value();
+}
+
 HomogenousMatrices4 X3DEnvironmentalSensorNode::sensorTransformations() const
 {
 	const ScopedLock scopedLock(lock_);
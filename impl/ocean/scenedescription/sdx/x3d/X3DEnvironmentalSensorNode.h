@@ -55,6 +55,12 @@ class OCEAN_SCENEDESCRIPTION_SDX_X3D_EXPORT X3DEnvironmentalSensorNode :
 		 */
 		void onUpdate(const Rendering::ViewRef& view, const Timestamp timestamp) override;
 
+		/**
+		 * Returns whether this node needs to be updated even if none of its fields has been set.
+		 * @see SDXUpdateNode::needsContinuousUpdate().
+		 */
+		bool needsContinuousUpdate(const Timestamp timestamp) const override;
+
 		/**
 		 * Event function for the new position and orientaiton inside the defined bounding box.
 		 * This function should be used by derivated classes.
@@ -7,6 +7,7 @@
 
 #include "ocean/scenedescription/sdx/x3d/X3DLibrary.h"
 #include "ocean/scenedescription/sdx/x3d/ClassicParser.h"
+#include "ocean/scenedescription/sdx/x3d/CompiledScene.h"
 
 #ifdef OCEAN_HAS_TINYXML2
 	#include "ocean/scenedescription/sdx/x3d/XMLParser.h"
@@ -62,24 +63,61 @@ SceneRef X3DLibrary::loadPermanent(const std::string& filename, const std::strin
 
 	const std::string extension(String::toLower(fileExtension));
 
+	if (extension != "x3d" && extension != "ox3d" && extension != "x3dv" && extension != "ox3dv" && extension != "wrl")
+	{
+		ocean_assert(false && "This should never happen!");
+		return SceneRef();
+	}
+
+	// a compiled scene is used as long as the source file has not changed, otherwise the file is parsed and compiled again
+
+	const uint64_t sourceHash = CompiledScene::isEnabled() ? CompiledScene::sourceHash(filename) : 0ull;
+	const std::string compiledFilename = sourceHash != 0ull ? CompiledScene::compiledFilename(filename) : std::string();
+
+	if (sourceHash != 0ull)
+	{
+		const SDXSceneRef compiledScene(CompiledScene::read(compiledFilename, sourceHash, filename, *this, engine, timestamp));
+
+		if (compiledScene)
+		{
+			if (progress != nullptr)
+			{
+				*progress = 1.0f;
+			}
+
+			return compiledScene;
+		}
+	}
+
+	SceneRef scene;
+
 	if (extension == "x3d" || extension == "ox3d")
 	{
 #ifdef OCEAN_HAS_TINYXML2
 		XMLParser xmlParser(filename, progress, cancel);
-		return xmlParser.parse(*this, engine, Timestamp());
+		scene = xmlParser.parse(*this, engine, Timestamp());
 #else
 		ocean_assert(false && "Disabled because tinyxml2 is not available");
 		return SceneRef();
 #endif
 	}
-	else if (extension == "x3dv" || extension == "ox3dv" || extension == "wrl")
+	else
 	{
 		ClassicParser classicParser(filename, progress, cancel);
-		return classicParser.parse(*this, engine, timestamp);
+		scene = classicParser.parse(*this, engine, timestamp);
+	}
+
+	if (sourceHash != 0ull && scene && (cancel == nullptr || !*cancel))
+	{
+		const SDXSceneRef sdxScene(scene);
+
+		if (sdxScene && !CompiledScene::write(*sdxScene, sourceHash, compiledFilename))
+		{
+			Log::debug() << "Failed to write the compiled scene \"" << compiledFilename << "\"";
+		}
 	}
 
-	ocean_assert(false && "This should never happen!");
-	return SceneRef();
+	return scene;
 }
 
 }
@@ -153,6 +153,12 @@ void X3DLightNode::onUpdate(const Rendering::ViewRef& /*view*/, const Timestamp
 	}
 }
 
+bool X3DLightNode::needsContinuousUpdate(const Timestamp /*timestamp*/) const
+{
+	// only global lights follow the transformation of their parents
+	return global_.value();
+}
+
 void X3DLightNode::registerLight(bool willBeGlobal)
 {
 	const Rendering::LightSourceRef renderingLightSource(renderingObject_);
@@ -64,6 +64,12 @@ class OCEAN_SCENEDESCRIPTION_SDX_X3D_EXPORT X3DLightNode :
 		 */
 		void onUpdate(const Rendering::ViewRef& view, const Timestamp timestamp) override;
 
+		/**
+		 * Returns whether this node needs to be updated even if none of its fields has been set.
+		 * @see SDXUpdateNode::needsContinuousUpdate().
+		 */
+		bool needsContinuousUpdate(const Timestamp timestamp) const override;
+
 		/**
 		 * Event function to update the position or direction of a light source with global state.
 		 * @param world_T_light The global light transformation, must be valid
@@ -58,6 +58,8 @@ bool X3DNode::setField(const std::string& fieldName, const Field& newField)
 				onFieldChanged(fieldName);
 			}
 
+			onFieldEvent(fieldName);
+
 			if (accessType & ACCESS_GET)
 			{
 				forwardThatFieldHasBeenChanged(fieldName, localField);
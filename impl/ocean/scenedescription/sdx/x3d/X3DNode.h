@@ -33,6 +33,9 @@ namespace X3D
 // Forward declaration.
 class X3DNode;
 
+// Forward declaration.
+class CompiledScene;
+
 /**
  * Definition of a smart object reference for abstract X3D nodes.
  * @see X3DNode, Node.
@@ -46,6 +49,8 @@ using X3DNodeRef = SmartObjectRef<X3DNode, Node>;
  */
 class OCEAN_SCENEDESCRIPTION_SDX_X3D_EXPORT X3DNode : virtual public SDXNode
 {
+	friend class CompiledScene;
+
 	protected:
 
 		/**
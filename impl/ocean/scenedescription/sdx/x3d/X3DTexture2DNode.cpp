@@ -9,8 +9,6 @@
 
 #include "ocean/media/Manager.h"
 
-#include "ocean/rendering/MediaTexture2D.h"
-
 namespace Ocean
 {
 
@@ -87,6 +85,9 @@ void X3DTexture2DNode::applyUrl(const StringVector& resolvedURLs, const Media::F
 		return;
 	}
 
+	// any pending asynchronous request is outdated now
+	++(*loadCounter_);
+
 	Media::FrameMediumRef medium;
 
 	if (!resolvedURLs.empty())
@@ -120,6 +121,34 @@ void X3DTexture2DNode::applyUrl(const StringVector& resolvedURLs, const Media::F
 	renderingTexture2D->setMedium(medium);
 	textureMedium_ = medium;
 
+	updateEnvironmentMode(*renderingTexture2D);
+}
+
+void X3DTexture2DNode::applyUrlAsynchronously(const StringVector& resolvedURLs, const Media::FrameMedium::Type mediumType, const bool start)
+{
+	Rendering::MediaTexture2DRef renderingTexture2D(renderingObject_);
+	if (renderingTexture2D.isNull())
+	{
+		return;
+	}
+
+	const unsigned int loadId = ++(*loadCounter_);
+
+	// until the new medium is available, the texture does not have any medium (the texture acts as placeholder)
+
+	renderingTexture2D->setMedium(Media::FrameMediumRef());
+	textureMedium_.release();
+
+	if (!resolvedURLs.empty())
+	{
+		loadMediumAsynchronously(renderingTexture2D, resolvedURLs, 0, mediumType, start, loadCounter_, loadId);
+	}
+
+	updateEnvironmentMode(*renderingTexture2D);
+}
+
+void X3DTexture2DNode::updateEnvironmentMode(Rendering::MediaTexture2D& renderingTexture2D)
+{
 	// check which texture environment mode has to be chosen
 	bool shouldUseModulate = false;
 	bool shouldUseReplace = false;
@@ -146,11 +175,11 @@ void X3DTexture2DNode::applyUrl(const StringVector& resolvedURLs, const Media::F
 
 	if (!shouldUseModulate)
 	{
-		renderingTexture2D->setEnvironmentMode(Rendering::Texture::MODE_REPLACE);
+		renderingTexture2D.setEnvironmentMode(Rendering::Texture::MODE_REPLACE);
 	}
 	else
 	{
-		renderingTexture2D->setEnvironmentMode(Rendering::Texture::MODE_MODULATE);
+		renderingTexture2D.setEnvironmentMode(Rendering::Texture::MODE_MODULATE);
 	}
 }
 
@@ -159,6 +188,45 @@ void X3DTexture2DNode::onMediumChanged(const Media::MediumRef& /*medium*/)
 	// nothing to do here
 }
 
+void X3DTexture2DNode::loadMediumAsynchronously(const Rendering::MediaTexture2DRef& renderingTexture2D, const StringVector& resolvedURLs, const size_t urlIndex, const Media::FrameMedium::Type mediumType, const bool start, const SharedLoadCounter& loadCounter, const unsigned int loadId)
+{
+	ocean_assert(renderingTexture2D);
+	ocean_assert(urlIndex < resolvedURLs.size());
+	ocean_assert(loadCounter);
+
+	Media::Manager::get().newMediumAsync(resolvedURLs[urlIndex], mediumType, false /*useExclusive*/, [renderingTexture2D, resolvedURLs, urlIndex, mediumType, start, loadCounter, loadId](const Media::MediumRef& mediumRef)
+	{
+		if (loadCounter->load() != loadId)
+		{
+			// the texture has received a new url in the meantime
+			return;
+		}
+
+		const Media::FrameMediumRef medium(mediumRef);
+
+		if (medium.isNull())
+		{
+			if (urlIndex + 1 < resolvedURLs.size())
+			{
+				loadMediumAsynchronously(renderingTexture2D, resolvedURLs, urlIndex + 1, mediumType, start, loadCounter, loadId);
+			}
+			else
+			{
+				Log::warning() << "Failed to load a texture \"" << resolvedURLs[0] << "\".";
+			}
+
+			return;
+		}
+
+		if (start)
+		{
+			medium->start();
+		}
+
+		renderingTexture2D->setMedium(medium);
+	});
+}
+
 }
 
 }
@@ -15,6 +15,10 @@
 
 #include "ocean/media/FrameMedium.h"
 
+#include "ocean/rendering/MediaTexture2D.h"
+
+#include <atomic>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -43,6 +47,11 @@ class OCEAN_SCENEDESCRIPTION_SDX_X3D_EXPORT X3DTexture2DNode : virtual public X3
 		 */
 		using StringVector = Strings;
 
+		/**
+		 * Definition of a shared counter identifying the most recent load request of a texture.
+		 */
+		using SharedLoadCounter = std::shared_ptr<std::atomic<unsigned int>>;
+
 	protected:
 
 		/**
@@ -76,12 +85,41 @@ class OCEAN_SCENEDESCRIPTION_SDX_X3D_EXPORT X3DTexture2DNode : virtual public X3
 		 */
 		void applyUrl(const StringVector& resolvedURLs, const Media::FrameMedium::Type mediumType, const bool start = true);
 
+		/**
+		 * Applies the current url asynchronously.
+		 * The medium is created (e.g., the image is decoded) in the background, the texture does not have any medium until the medium is available.<br>
+		 * Beware: onMediumChanged() is not invoked for asynchronously created media objects.
+		 * @param resolvedURLs Resolved URLs to be create a medium from
+		 * @param mediumType Type of the framed medium to be created
+		 * @param start Determines whether the framed medium will be started directly
+		 */
+		void applyUrlAsynchronously(const StringVector& resolvedURLs, const Media::FrameMedium::Type mediumType, const bool start = true);
+
+		/**
+		 * Updates the texture environment mode of the rendering texture based on the parent nodes.
+		 * @param renderingTexture2D The rendering texture to update, must be valid
+		 */
+		void updateEnvironmentMode(Rendering::MediaTexture2D& renderingTexture2D);
+
 		/**
 		 * Event function to modify properties of a new medium before it will be started and used as texture.
 		 * @param medium Medium object which can be modified
 		 */
 		virtual void onMediumChanged(const Media::MediumRef& medium);
 
+		/**
+		 * Creates a medium asynchronously and forwards the medium to a rendering texture once available.
+		 * In case the medium cannot be created, the next url is tried.
+		 * @param renderingTexture2D The rendering texture receiving the medium, must be valid
+		 * @param resolvedURLs Resolved URLs to be create a medium from
+		 * @param urlIndex The index of the url to be used, with range [0, resolvedURLs.size() - 1]
+		 * @param mediumType Type of the framed medium to be created
+		 * @param start Determines whether the framed medium will be started directly
+		 * @param loadCounter The counter identifying the most recent load request of the texture, must be valid
+		 * @param loadId The id of this load request, the medium is discarded if the id does not match with the counter anymore
+		 */
+		static void loadMediumAsynchronously(const Rendering::MediaTexture2DRef& renderingTexture2D, const StringVector& resolvedURLs, const size_t urlIndex, const Media::FrameMedium::Type mediumType, const bool start, const SharedLoadCounter& loadCounter, const unsigned int loadId);
+
 	protected:
 
 		/// RepeatS field.
@@ -95,6 +133,9 @@ class OCEAN_SCENEDESCRIPTION_SDX_X3D_EXPORT X3DTexture2DNode : virtual public X3
 
 		/// Texture medium.
 		Media::FrameMediumRef textureMedium_;
+
+		/// The counter identifying the most recent load request, outdated asynchronous requests are discarded.
+		SharedLoadCounter loadCounter_ = std::make_shared<std::atomic<unsigned int>>(0u);
 };
 
 }
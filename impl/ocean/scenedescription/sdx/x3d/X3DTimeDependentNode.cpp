@@ -171,6 +171,18 @@ void X3DTimeDependentNode::onUpdate(const Rendering::ViewRef& /*view*/, const Ti
 	}
 }
 
+bool X3DTimeDependentNode::needsContinuousUpdate(const Timestamp timestamp) const
+{
+	// an inactive node needs to be updated only once its start time is reached, this matches the activation condition in onUpdate()
+
+	if (isActive_.value())
+	{
+		return true;
+	}
+
+	return timestamp >= startTime_.value() && (timestamp < stopTime_.value() || stopTime_.value() <= startTime_.value());
+}
+
 void X3DTimeDependentNode::startNode(const Timestamp valueTimestamp, const Timestamp eventTimestamp)
 {
 	ocean_assert(isActive_.value() == false);
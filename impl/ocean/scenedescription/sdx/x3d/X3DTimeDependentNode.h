@@ -71,6 +71,12 @@ class OCEAN_SCENEDESCRIPTION_SDX_X3D_EXPORT X3DTimeDependentNode :
 		 */
 		void onUpdate(const Rendering::ViewRef& view, const Timestamp timestamp) override;
 
+		/**
+		 * Returns whether this node needs to be updated even if none of its fields has been set.
+		 * @see SDXUpdateNode::needsContinuousUpdate().
+		 */
+		bool needsContinuousUpdate(const Timestamp timestamp) const override;
+
 		/**
 		 * Starts the node explicitly.
 		 * The node must not be active before this call.<br>
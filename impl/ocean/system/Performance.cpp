@@ -8,7 +8,16 @@
 #include "ocean/system/Performance.h"
 
 #include "ocean/base/Build.h"
+#include "ocean/base/Messenger.h"
 #include "ocean/base/Processor.h"
+#include "ocean/base/String.h"
+#include "ocean/base/Worker.h"
+
+#include <fstream>
+
+#if defined(_ANDROID)
+	#include <dlfcn.h>
+#endif
 
 namespace Ocean
 {
@@ -16,7 +25,8 @@ namespace Ocean
 namespace System
 {
 
-Performance::Performance()
+Performance::Performance() :
+	Thread("Performance thread")
 {
 	const unsigned int cores = Processor::get().cores();
 
@@ -54,6 +64,11 @@ Performance::Performance()
 	}
 }
 
+Performance::~Performance()
+{
+	stopThreadExplicitly();
+}
+
 Performance::PerformanceLevel Performance::performanceLevel()
 {
 	return performanceLevel_;
@@ -64,6 +79,332 @@ void Performance::setPerformanceLevel(const PerformanceLevel level)
 	performanceLevel_ = level;
 }
 
+bool Performance::setAdaptiveWorkerLoad(const bool enable, const double interval, const double recoveryDuration)
+{
+	ocean_assert(interval > 0.0 && recoveryDuration >= 0.0);
+
+	if (enable)
+	{
+		if (interval <= 0.0 || recoveryDuration < 0.0)
+		{
+			return false;
+		}
+
+		if (thermalStatus() == TS_UNKNOWN)
+		{
+			Log::warning() << "The platform does not provide the thermal status, the worker load cannot be adapted";
+			return false;
+		}
+
+		TemporaryScopedLock scopedLock(lock_);
+
+		adaptationInterval_ = interval;
+		recoveryDuration_ = recoveryDuration;
+
+		if (isThreadActive() || isThreadInvokedToStart())
+		{
+			return true;
+		}
+
+		adaptationEvents_.clear();
+
+		scopedLock.release();
+
+		return startThread();
+	}
+
+	// the thread must not be stopped while holding the lock, the thread may wait for the lock
+	stopThreadExplicitly();
+
+	const float previousLoad = Worker::adaptiveLoad();
+
+	if (previousLoad != 1.0f)
+	{
+		Worker::setAdaptiveLoad(1.0f);
+
+		const ScopedLock scopedLock(lock_);
+		adaptationEvents_.emplace_back(Timestamp(true), TS_UNKNOWN, previousLoad, 1.0f);
+	}
+
+	return true;
+}
+
+bool Performance::isAdaptiveWorkerLoadEnabled() const
+{
+	return isThreadActive() || isThreadInvokedToStart();
+}
+
+Performance::AdaptationEvents Performance::adaptationEvents() const
+{
+	const ScopedLock scopedLock(lock_);
+
+	return adaptationEvents_;
+}
+
+Performance::ThermalStatus Performance::thermalStatus()
+{
+#if defined(_ANDROID)
+
+	using AThermalManager = void;
+
+	using AThermal_acquireManagerFunction = AThermalManager*(*)();
+	using AThermal_getCurrentThermalStatusFunction = int(*)(AThermalManager*);
+
+	// the thermal API is available with API level 30+, therefore the functions are loaded dynamically
+
+	static AThermalManager* thermalManager = nullptr;
+	static AThermal_getCurrentThermalStatusFunction getCurrentThermalStatus = nullptr;
+
+	static const bool initialized = []()
+	{
+		void* libraryHandle = dlopen("libandroid.so", RTLD_LAZY);
+
+		if (libraryHandle == nullptr)
+		{
+			return false;
+		}
+
+		const AThermal_acquireManagerFunction acquireManager = (AThermal_acquireManagerFunction)(dlsym(libraryHandle, "AThermal_acquireManager"));
+		getCurrentThermalStatus = (AThermal_getCurrentThermalStatusFunction)(dlsym(libraryHandle, "AThermal_getCurrentThermalStatus"));
+
+		if (acquireManager == nullptr || getCurrentThermalStatus == nullptr)
+		{
+			return false;
+		}
+
+		thermalManager = acquireManager();
+
+		return thermalManager != nullptr;
+	}();
+
+	if (!initialized)
+	{
+		return TS_UNKNOWN;
+	}
+
+	// ATHERMAL_STATUS_ERROR = -1, ATHERMAL_STATUS_NONE = 0, LIGHT = 1, MODERATE = 2, SEVERE = 3, CRITICAL = 4, EMERGENCY = 5, SHUTDOWN = 6
+	const int status = getCurrentThermalStatus(thermalManager);
+
+	switch (status)
+	{
+		case 0:
+			return TS_NONE;
+
+		case 1:
+			return TS_LIGHT;
+
+		case 2:
+			return TS_MODERATE;
+
+		case 3:
+			return TS_SEVERE;
+
+		default:
+			break;
+	}
+
+	return status < 0 ? TS_UNKNOWN : TS_CRITICAL;
+
+#elif defined(__linux__)
+
+	// we use the highest temperature of all thermal zones, the temperatures are provided in millidegree Celsius
+
+	int maximalTemperature = -1;
+
+	for (unsigned int zone = 0u; zone < 64u; ++zone)
+	{
+		std::ifstream stream("/sys/class/thermal/thermal_zone" + String::toAString(zone) + "/temp");
+
+		if (!stream.is_open())
+		{
+			break;
+		}
+
+		int temperature = -1;
+
+		if (stream >> temperature)
+		{
+			maximalTemperature = std::max(maximalTemperature, temperature);
+		}
+	}
+
+	if (maximalTemperature < 0)
+	{
+		return TS_UNKNOWN;
+	}
+
+	if (maximalTemperature < 60000)
+	{
+		return TS_NONE;
+	}
+
+	if (maximalTemperature < 70000)
+	{
+		return TS_LIGHT;
+	}
+
+	if (maximalTemperature < 80000)
+	{
+		return TS_MODERATE;
+	}
+
+	if (maximalTemperature < 90000)
+	{
+		return TS_SEVERE;
+	}
+
+	return TS_CRITICAL;
+
+#else
+
+	return TS_UNKNOWN;
+
+#endif
+}
+
+std::string Performance::translateThermalStatus(const ThermalStatus thermalStatus)
+{
+	switch (thermalStatus)
+	{
+		case TS_UNKNOWN:
+			return std::string("Unknown");
+
+		case TS_NONE:
+			return std::string("None");
+
+		case TS_LIGHT:
+			return std::string("Light");
+
+		case TS_MODERATE:
+			return std::string("Moderate");
+
+		case TS_SEVERE:
+			return std::string("Severe");
+
+		case TS_CRITICAL:
+			return std::string("Critical");
+	}
+
+	ocean_assert(false && "Invalid thermal status!");
+	return std::string("Invalid");
+}
+
+float Performance::thermalStatus2load(const ThermalStatus thermalStatus, const PerformanceLevel performanceLevel)
+{
+	const bool lowPerformance = performanceLevel == LEVEL_LOW;
+
+	switch (thermalStatus)
+	{
+		case TS_UNKNOWN:
+		case TS_NONE:
+			return 1.0f;
+
+		case TS_LIGHT:
+			return lowPerformance ? 0.75f : 1.0f;
+
+		case TS_MODERATE:
+			return lowPerformance ? 0.5f : 0.75f;
+
+		case TS_SEVERE:
+			return lowPerformance ? 0.25f : 0.5f;
+
+		case TS_CRITICAL:
+			return 0.25f;
+	}
+
+	ocean_assert(false && "Invalid thermal status!");
+	return 1.0f;
+}
+
+float Performance::determineLoad(const ThermalStatus thermalStatus, const PerformanceLevel performanceLevel, const float currentLoad, const Timestamp& timestamp, const double recoveryDuration, Timestamp& recoveryTimestamp)
+{
+	ocean_assert(currentLoad > 0.0f && currentLoad <= 1.0f);
+	ocean_assert(timestamp.isValid() && recoveryDuration >= 0.0);
+
+	if (thermalStatus == TS_UNKNOWN)
+	{
+		return currentLoad;
+	}
+
+	const float targetLoad = thermalStatus2load(thermalStatus, performanceLevel);
+
+	if (targetLoad < currentLoad)
+	{
+		// the load is reduced immediately
+
+		recoveryTimestamp.toInvalid();
+		return targetLoad;
+	}
+
+	if (targetLoad == currentLoad)
+	{
+		recoveryTimestamp.toInvalid();
+		return currentLoad;
+	}
+
+	// the load is increased only if the thermal status has been better for a while
+
+	if (recoveryTimestamp.isInvalid())
+	{
+		recoveryTimestamp = timestamp;
+	}
+
+	if (timestamp >= recoveryTimestamp + recoveryDuration)
+	{
+		recoveryTimestamp.toInvalid();
+		return targetLoad;
+	}
+
+	return currentLoad;
+}
+
+void Performance::threadRun()
+{
+	// the timestamp since which the thermal status allows a higher load
+	Timestamp recoveryTimestamp(false);
+
+	while (!shouldThreadStop())
+	{
+		TemporaryScopedLock scopedLock(lock_);
+			const double interval = adaptationInterval_;
+			const double recoveryDuration = recoveryDuration_;
+			const PerformanceLevel level = performanceLevel_;
+		scopedLock.release();
+
+		const ThermalStatus status = thermalStatus();
+
+		const float currentLoad = Worker::adaptiveLoad();
+		const Timestamp currentTimestamp(true);
+
+		const float targetLoad = determineLoad(status, level, currentLoad, currentTimestamp, recoveryDuration, recoveryTimestamp);
+
+		if (targetLoad != currentLoad)
+		{
+			Worker::setAdaptiveLoad(targetLoad);
+
+			Log::info() << "Adapted the worker load from " << String::toAString(currentLoad, 2u) << " to " << String::toAString(targetLoad, 2u) << " due to thermal status '" << translateThermalStatus(status) << "'";
+
+			const ScopedLock eventLock(lock_);
+
+			if (adaptationEvents_.size() >= maximalAdaptationEvents_)
+			{
+				adaptationEvents_.erase(adaptationEvents_.begin());
+			}
+
+			adaptationEvents_.emplace_back(currentTimestamp, status, currentLoad, targetLoad);
+		}
+
+		// sleeping in small steps to be able to stop the thread quickly
+
+		const Timestamp sleepTimestamp(true);
+
+		while (!shouldThreadStop() && Timestamp(true) < sleepTimestamp + interval)
+		{
+			sleep(10u);
+		}
+	}
+}
+
 }
 
 }
@@ -10,7 +10,12 @@
 
 #include "ocean/system/System.h"
 
+#include "ocean/base/Lock.h"
 #include "ocean/base/Singleton.h"
+#include "ocean/base/Thread.h"
+#include "ocean/base/Timestamp.h"
+
+#include <vector>
 
 namespace Ocean
 {
@@ -20,9 +25,12 @@ namespace System
 
 /**
  * This class implements functionalities concerning the underlying system performance.
+ * Further, the class can adapt the load of all adaptive workers (Worker::TYPE_ADAPTIVE) to the thermal status of the device.
  * @ingroup system
  */
-class OCEAN_SYSTEM_EXPORT Performance : public Singleton<Performance>
+class OCEAN_SYSTEM_EXPORT Performance :
+	public Singleton<Performance>,
+	protected Thread
 {
 	friend class Singleton<Performance>;
 
@@ -45,6 +53,85 @@ class OCEAN_SYSTEM_EXPORT Performance : public Singleton<Performance>
 			LEVEL_ULTRA
 		};
 
+		/**
+		 * Definition of thermal states of the device.
+		 */
+		enum ThermalStatus : uint32_t
+		{
+			/// The thermal status is unknown, e.g., because the platform does not provide the information.
+			TS_UNKNOWN = 0u,
+			/// The device is not throttled.
+			TS_NONE,
+			/// The device is lightly throttled.
+			TS_LIGHT,
+			/// The device is moderately throttled.
+			TS_MODERATE,
+			/// The device is severely throttled.
+			TS_SEVERE,
+			/// The device is critically throttled, the platform may shut down components.
+			TS_CRITICAL
+		};
+
+		/**
+		 * This class holds the information of one adaptation of the worker load.
+		 */
+		class AdaptationEvent
+		{
+			public:
+
+				/**
+				 * Creates a new adaptation event.
+				 * @param timestamp The timestamp of the adaptation
+				 * @param thermalStatus The thermal status which caused the adaptation
+				 * @param previousLoad The load factor before the adaptation, with range (0, 1]
+				 * @param load The load factor after the adaptation, with range (0, 1]
+				 */
+				inline AdaptationEvent(const Timestamp& timestamp, const ThermalStatus thermalStatus, const float previousLoad, const float load);
+
+				/**
+				 * Returns the timestamp of the adaptation.
+				 * @return The adaptation's timestamp
+				 */
+				inline const Timestamp& timestamp() const;
+
+				/**
+				 * Returns the thermal status which caused the adaptation.
+				 * @return The adaptation's thermal status
+				 */
+				inline ThermalStatus thermalStatus() const;
+
+				/**
+				 * Returns the load factor before the adaptation.
+				 * @return The previous load factor, with range (0, 1]
+				 */
+				inline float previousLoad() const;
+
+				/**
+				 * Returns the load factor after the adaptation.
+				 * @return The new load factor, with range (0, 1]
+				 */
+				inline float load() const;
+
+			protected:
+
+				/// The timestamp of the adaptation.
+				Timestamp timestamp_;
+
+				/// The thermal status which caused the adaptation.
+				ThermalStatus thermalStatus_ = TS_UNKNOWN;
+
+				/// The load factor before the adaptation.
+				float previousLoad_ = 1.0f;
+
+				/// The load factor after the adaptation.
+				float load_ = 1.0f;
+		};
+
+		/**
+		 * Definition of a vector holding adaptation events.
+		 */
+		using AdaptationEvents = std::vector<AdaptationEvent>;
+
 	public:
 
 		/**
@@ -59,6 +146,66 @@ class OCEAN_SYSTEM_EXPORT Performance : public Singleton<Performance>
 		 */
 		void setPerformanceLevel(const PerformanceLevel level);
 
+		/**
+		 * Enables or disables the adaptation of the worker load to the thermal status of the device.
+		 * When enabled, a background thread checks the thermal status periodically and defines the load of all adaptive workers via Worker::setAdaptiveLoad().<br>
+		 * The load is reduced immediately when the thermal status gets worse, and is increased again once the thermal status has been better for the recovery duration.<br>
+		 * When disabled, the adaptive workers use all their threads again.
+		 * @param enable True, to enable the adaptation; False, to disable the adaptation
+		 * @param interval The interval in which the thermal status is checked, in seconds, with range (0, infinity)
+		 * @param recoveryDuration The duration the thermal status needs to be better before the load is increased again, in seconds, with range [0, infinity)
+		 * @return True, if succeeded; False, if the platform does not provide the thermal status
+		 */
+		bool setAdaptiveWorkerLoad(const bool enable, const double interval = 1.0, const double recoveryDuration = 10.0);
+
+		/**
+		 * Returns whether the worker load is adapted to the thermal status of the device.
+		 * @return True, if so
+		 */
+		bool isAdaptiveWorkerLoadEnabled() const;
+
+		/**
+		 * Returns all adaptations of the worker load which have been applied since the adaptation has been enabled.
+		 * @return The adaptation events, the most recent event last
+		 */
+		AdaptationEvents adaptationEvents() const;
+
+		/**
+		 * Returns the current thermal status of the device.
+		 * @return The thermal status, TS_UNKNOWN if the platform does not provide the information
+		 */
+		static ThermalStatus thermalStatus();
+
+		/**
+		 * Translates a thermal status to a readable string.
+		 * @param thermalStatus The thermal status to translate
+		 * @return The readable string
+		 */
+		static std::string translateThermalStatus(const ThermalStatus thermalStatus);
+
+		/**
+		 * Returns the worker load factor for a thermal status.
+		 * Devices with low performance level are throttled earlier, so that their load is reduced more.
+		 * @param thermalStatus The thermal status for which the load factor will be returned
+		 * @param performanceLevel The performance level of the device
+		 * @return The load factor, with range (0, 1]
+		 */
+		static float thermalStatus2load(const ThermalStatus thermalStatus, const PerformanceLevel performanceLevel);
+
+		/**
+		 * Determines the worker load factor for a new measurement of the thermal status, applying the hysteresis of the adaptation.
+		 * A lower load is applied immediately, a higher load only after the better thermal status has been measured continuously for the recovery duration.<br>
+		 * The function does not access the device, so that any sequence of thermal states can be provided.
+		 * @param thermalStatus The measured thermal status, TS_UNKNOWN to keep the current load
+		 * @param performanceLevel The performance level of the device
+		 * @param currentLoad The load factor which is currently applied, with range (0, 1]
+		 * @param timestamp The timestamp of the measurement, must be valid
+		 * @param recoveryDuration The duration the thermal status needs to be better before the load is increased, in seconds, with range [0, infinity)
+		 * @param recoveryTimestamp The timestamp since which the thermal status allows a higher load, invalid if the status has not been better; will be updated
+		 * @return The load factor to be applied, with range (0, 1]; the current load if the load does not change
+		 */
+		static float determineLoad(const ThermalStatus thermalStatus, const PerformanceLevel performanceLevel, const float currentLoad, const Timestamp& timestamp, const double recoveryDuration, Timestamp& recoveryTimestamp);
+
 	protected:
 
 		/**
@@ -71,12 +218,67 @@ class OCEAN_SYSTEM_EXPORT Performance : public Singleton<Performance>
 		 */
 		Performance();
 
+		/**
+		 * Destructs the Performance object.
+		 */
+		~Performance() override;
+
+		/**
+		 * The thread run function checking the thermal status.
+		 * @see Thread::threadRun().
+		 */
+		void threadRun() override;
+
 	protected:
 
 		/// Current performance level.
 		PerformanceLevel performanceLevel_ = LEVEL_MEDIUM;
+
+		/// The interval in which the thermal status is checked, in seconds.
+		double adaptationInterval_ = 1.0;
+
+		/// The duration the thermal status needs to be better before the load is increased, in seconds.
+		double recoveryDuration_ = 10.0;
+
+		/// The adaptations of the worker load.
+		AdaptationEvents adaptationEvents_;
+
+		/// The maximal number of adaptation events which are stored.
+		static constexpr size_t maximalAdaptationEvents_ = 1000;
+
+		/// The lock of this object.
+		mutable Lock lock_;
 };
 
+inline Performance::AdaptationEvent::AdaptationEvent(const Timestamp& timestamp, const ThermalStatus thermalStatus, const float previousLoad, const float load) :
+	timestamp_(timestamp),
+	thermalStatus_(thermalStatus),
+	previousLoad_(previousLoad),
+	load_(load)
+{
+	// nothing to do here
+}
+
+inline const Timestamp& Performance::AdaptationEvent::timestamp() const
+{
+	return timestamp_;
+}
+
+inline Performance::ThermalStatus Performance::AdaptationEvent::thermalStatus() const
+{
+	return thermalStatus_;
+}
+
+inline float Performance::AdaptationEvent::previousLoad() const
+{
+	return previousLoad_;
+}
+
+inline float Performance::AdaptationEvent::load() const
+{
+	return load_;
+}
+
 }
 
 }
@@ -0,0 +1,326 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "ocean/test/Benchmark.h"
+
+#include "ocean/base/Build.h"
+#include "ocean/base/Processor.h"
+#include "ocean/base/String.h"
+
+#include <fstream>
+#include <sstream>
+
+namespace Ocean
+{
+
+namespace Test
+{
+
+Benchmark::Benchmark(const Configuration& configuration) :
+	configuration_(configuration)
+{
+	// nothing to do here
+}
+
+void Benchmark::run(const std::string& name, const std::string& parameters, const BenchmarkFunction& function, Worker* worker)
+{
+	ocean_assert(!name.empty());
+	ocean_assert(parameters.find(',') == std::string::npos);
+	ocean_assert(function);
+
+	Log::info() << "Benchmark '" << name << "' (" << parameters << "):";
+
+	const Result singleCoreResult = execute(name, parameters, function, nullptr);
+
+	Log::info() << "Singlecore: median: " << String::toAString(singleCoreResult.medianMs_, 3u) << "ms, P90: " << String::toAString(singleCoreResult.p90Ms_, 3u) << "ms, P99: " << String::toAString(singleCoreResult.p99Ms_, 3u) << "ms";
+
+	results_.emplace_back(singleCoreResult);
+
+	if (worker != nullptr && worker->threads() > 1u && configuration_.compareWorker())
+	{
+		const Result multiCoreResult = execute(name, parameters, function, worker);
+
+		Log::info() << "Multicore: median: " << String::toAString(multiCoreResult.medianMs_, 3u) << "ms, P90: " << String::toAString(multiCoreResult.p90Ms_, 3u) << "ms, P99: " << String::toAString(multiCoreResult.p99Ms_, 3u) << "ms";
+
+		if (multiCoreResult.medianMs_ > 0.0)
+		{
+			Log::info() << "Multicore boost factor: " << String::toAString(singleCoreResult.medianMs_ / multiCoreResult.medianMs_, 1u) << "x";
+		}
+
+		results_.emplace_back(multiCoreResult);
+	}
+
+	Log::info() << " ";
+}
+
+void Benchmark::addMeasurements(const std::string& name, const std::string& parameters, const HighPerformanceStatistic& statistic, const unsigned int threads)
+{
+	ocean_assert(!name.empty());
+	ocean_assert(parameters.find(',') == std::string::npos);
+	ocean_assert(threads >= 1u);
+
+	const Result result = createResult(name, parameters, statistic, threads);
+
+	Log::info() << "Benchmark '" << name << "' (" << parameters << "): " << result.repetitions_ << " measurements, median: " << String::toAString(result.medianMs_, 3u) << "ms, P90: " << String::toAString(result.p90Ms_, 3u) << "ms, P99: " << String::toAString(result.p99Ms_, 3u) << "ms";
+
+	results_.emplace_back(result);
+}
+
+std::string Benchmark::toJSON() const
+{
+	const auto escape = [](const std::string& value)
+	{
+		std::string result;
+		result.reserve(value.size());
+
+		for (const char character : value)
+		{
+			if (character == '"' || character == '\\')
+			{
+				result.push_back('\\');
+			}
+
+			result.push_back(character);
+		}
+
+		return result;
+	};
+
+	std::ostringstream stream;
+
+	stream << "{\n";
+	stream << "\t\"platform\": \"" << escape(Build::buildString()) << "\",\n";
+	stream << "\t\"processor\": \"" << escape(Processor::brand()) << "\",\n";
+	stream << "\t\"warmupIterations\": " << configuration_.warmupIterations() << ",\n";
+	stream << "\t\"repetitions\": " << configuration_.repetitions() << ",\n";
+	stream << "\t\"results\":\n";
+	stream << "\t[\n";
+
+	for (size_t n = 0; n < results_.size(); ++n)
+	{
+		const Result& result = results_[n];
+
+		stream << "\t\t{";
+		stream << "\"name\": \"" << escape(result.name_) << "\", ";
+		stream << "\"parameters\": \"" << escape(result.parameters_) << "\", ";
+		stream << "\"threads\": " << result.threads_ << ", ";
+		stream << "\"repetitions\": " << result.repetitions_ << ", ";
+		stream << "\"median_ms\": " << String::toAString(result.medianMs_, 6u) << ", ";
+		stream << "\"p90_ms\": " << String::toAString(result.p90Ms_, 6u) << ", ";
+		stream << "\"p99_ms\": " << String::toAString(result.p99Ms_, 6u) << ", ";
+		stream << "\"average_ms\": " << String::toAString(result.averageMs_, 6u) << ", ";
+		stream << "\"best_ms\": " << String::toAString(result.bestMs_, 6u) << ", ";
+		stream << "\"worst_ms\": " << String::toAString(result.worstMs_, 6u);
+		stream << (n + 1 < results_.size() ? "},\n" : "}\n");
+	}
+
+	stream << "\t]\n";
+	stream << "}\n";
+
+	return stream.str();
+}
+
+std::string Benchmark::toCSV() const
+{
+	std::ostringstream stream;
+
+	stream << "name,parameters,threads,repetitions,median_ms,p90_ms,p99_ms,average_ms,best_ms,worst_ms\n";
+
+	for (const Result& result : results_)
+	{
+		stream << result.name_ << ',' << result.parameters_ << ',' << result.threads_ << ',' << result.repetitions_ << ',';
+		stream << String::toAString(result.medianMs_, 6u) << ',' << String::toAString(result.p90Ms_, 6u) << ',' << String::toAString(result.p99Ms_, 6u) << ',';
+		stream << String::toAString(result.averageMs_, 6u) << ',' << String::toAString(result.bestMs_, 6u) << ',' << String::toAString(result.worstMs_, 6u) << '\n';
+	}
+
+	return stream.str();
+}
+
+bool Benchmark::writeResults(const std::string& filename) const
+{
+	ocean_assert(!filename.empty());
+
+	std::ofstream stream(filename.c_str(), std::ios::binary);
+
+	if (!stream.is_open())
+	{
+		return false;
+	}
+
+	const bool isJSON = filename.size() >= 5 && String::toLower(filename.substr(filename.size() - 5)) == ".json";
+
+	stream << (isJSON ? toJSON() : toCSV());
+
+	return stream.good();
+}
+
+bool Benchmark::parseCSV(const std::string& csv, Results& results)
+{
+	results.clear();
+
+	std::istringstream stream(csv);
+
+	std::string line;
+
+	if (!std::getline(stream, line) || line.rfind("name,parameters,threads", 0) != 0)
+	{
+		// the header is missing
+		return false;
+	}
+
+	while (std::getline(stream, line))
+	{
+		if (!line.empty() && line.back() == '\r')
+		{
+			line.pop_back();
+		}
+
+		if (line.empty())
+		{
+			continue;
+		}
+
+		std::vector<std::string> values;
+
+		std::istringstream lineStream(line);
+		std::string value;
+
+		while (std::getline(lineStream, value, ','))
+		{
+			values.emplace_back(std::move(value));
+		}
+
+		if (values.size() != 10)
+		{
+			return false;
+		}
+
+		Result result;
+		result.name_ = std::move(values[0]);
+		result.parameters_ = std::move(values[1]);
+
+		int32_t threads = 0;
+		int32_t repetitions = 0;
+
+		if (result.name_.empty() || !String::isInteger32(values[2], &threads) || threads < 1 || !String::isInteger32(values[3], &repetitions) || repetitions < 0)
+		{
+			return false;
+		}
+
+		result.threads_ = (unsigned int)(threads);
+		result.repetitions_ = size_t(repetitions);
+
+		double* const timings[6] = {&result.medianMs_, &result.p90Ms_, &result.p99Ms_, &result.averageMs_, &result.bestMs_, &result.worstMs_};
+
+		for (size_t n = 0; n < 6; ++n)
+		{
+			if (!String::isNumber(values[4 + n], true /*acceptInteger*/, timings[n]))
+			{
+				return false;
+			}
+		}
+
+		results.emplace_back(std::move(result));
+	}
+
+	return true;
+}
+
+bool Benchmark::readCSV(const std::string& filename, Results& results)
+{
+	ocean_assert(!filename.empty());
+
+	std::ifstream stream(filename.c_str(), std::ios::binary);
+
+	if (!stream.is_open())
+	{
+		return false;
+	}
+
+	std::ostringstream content;
+	content << stream.rdbuf();
+
+	return parseCSV(content.str(), results);
+}
+
+Benchmark::Regressions Benchmark::determineRegressions(const Results& results, const Results& baselineResults, const double tolerance)
+{
+	ocean_assert(tolerance >= 0.0);
+
+	Regressions regressions;
+
+	for (const Result& result : results)
+	{
+		for (const Result& baselineResult : baselineResults)
+		{
+			if (!result.isSameBenchmark(baselineResult))
+			{
+				continue;
+			}
+
+			if (baselineResult.medianMs_ > 0.0 && result.medianMs_ > baselineResult.medianMs_ * (1.0 + tolerance))
+			{
+				Regression regression;
+				regression.current_ = result;
+				regression.baseline_ = baselineResult;
+				regression.ratio_ = result.medianMs_ / baselineResult.medianMs_;
+
+				regressions.emplace_back(std::move(regression));
+			}
+
+			break;
+		}
+	}
+
+	return regressions;
+}
+
+Benchmark::Result Benchmark::execute(const std::string& name, const std::string& parameters, const BenchmarkFunction& function, Worker* worker) const
+{
+	ocean_assert(function);
+
+	for (unsigned int n = 0u; n < configuration_.warmupIterations(); ++n)
+	{
+		function(worker);
+	}
+
+	HighPerformanceStatistic performance;
+
+	for (unsigned int n = 0u; n < configuration_.repetitions(); ++n)
+	{
+		performance.start();
+			function(worker);
+		performance.stop();
+	}
+
+	return createResult(name, parameters, performance, worker != nullptr ? worker->threads() : 1u);
+}
+
+Benchmark::Result Benchmark::createResult(const std::string& name, const std::string& parameters, const HighPerformanceStatistic& statistic, const unsigned int threads)
+{
+	Result result;
+	result.name_ = name;
+	result.parameters_ = parameters;
+	result.threads_ = threads;
+	result.repetitions_ = statistic.measurements();
+
+	if (statistic.measurements() != 0)
+	{
+		result.medianMs_ = statistic.medianMseconds();
+		result.p90Ms_ = statistic.percentileMseconds(0.90);
+		result.p99Ms_ = statistic.percentileMseconds(0.99);
+		result.averageMs_ = statistic.averageMseconds();
+		result.bestMs_ = statistic.bestMseconds();
+		result.worstMs_ = statistic.worstMseconds();
+	}
+
+	return result;
+}
+
+}
+
+}
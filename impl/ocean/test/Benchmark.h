@@ -0,0 +1,327 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#ifndef META_OCEAN_TEST_BENCHMARK_H
+#define META_OCEAN_TEST_BENCHMARK_H
+
+#include "ocean/test/Test.h"
+
+#include "ocean/base/HighPerformanceTimer.h"
+#include "ocean/base/Worker.h"
+
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace Ocean
+{
+
+namespace Test
+{
+
+/**
+ * This class implements a micro-benchmark harness with machine-readable output.
+ * In contrast to the tests, a benchmark does not validate any result and is not executed for a specific duration.<br>
+ * Instead, each benchmark function is executed for a fixed number of warm-up iterations followed by a fixed number of measured repetitions.<br>
+ * Each benchmark can be executed single-core and with a worker so that both execution modes can be compared.<br>
+ * The results can be written as JSON or CSV and can be compared with a baseline (e.g., a CSV file from a previous release) to detect performance regressions.
+ * @ingroup test
+ */
+class OCEAN_TEST_EXPORT Benchmark
+{
+	public:
+
+		/**
+		 * This class holds the configuration of a benchmark run.
+		 */
+		class Configuration
+		{
+			public:
+
+				/**
+				 * Creates a new configuration object.
+				 * @param warmupIterations The number of iterations executed before the measurement starts, with range [0, infinity)
+				 * @param repetitions The number of measured repetitions, with range [1, infinity)
+				 * @param compareWorker True, to execute each benchmark with the worker as well (if a worker is provided); False, to execute each benchmark single-core only
+				 */
+				explicit inline Configuration(const unsigned int warmupIterations = 5u, const unsigned int repetitions = 50u, const bool compareWorker = true);
+
+				/**
+				 * Returns the number of iterations executed before the measurement starts.
+				 * @return The number of warm-up iterations, with range [0, infinity)
+				 */
+				inline unsigned int warmupIterations() const;
+
+				/**
+				 * Returns the number of measured repetitions.
+				 * @return The number of repetitions, with range [1, infinity)
+				 */
+				inline unsigned int repetitions() const;
+
+				/**
+				 * Returns whether each benchmark is executed with the worker as well.
+				 * @return True, if so
+				 */
+				inline bool compareWorker() const;
+
+			protected:
+
+				/// The number of iterations executed before the measurement starts.
+				unsigned int warmupIterations_ = 5u;
+
+				/// The number of measured repetitions.
+				unsigned int repetitions_ = 50u;
+
+				/// True, to execute each benchmark with the worker as well.
+				bool compareWorker_ = true;
+		};
+
+		/**
+		 * This class holds the result of one benchmark execution.
+		 */
+		class Result
+		{
+			public:
+
+				/**
+				 * Returns whether this result and a second result belong to the same benchmark in the same execution mode.
+				 * The number of threads of a worker execution is not compared as baselines may be recorded on different devices.
+				 * @param result The second result to compare
+				 * @return True, if so
+				 */
+				inline bool isSameBenchmark(const Result& result) const;
+
+			public:
+
+				/// The hierarchical name of the benchmark, e.g., "frameconverter.y_uv12torgb24".
+				std::string name_;
+
+				/// The parameters of the benchmark, e.g., the frame dimension and pixel format, must not contain a comma.
+				std::string parameters_;
+
+				/// The number of threads which have been used, 1 for single-core executions.
+				unsigned int threads_ = 1u;
+
+				/// The number of measured repetitions.
+				size_t repetitions_ = 0;
+
+				/// The median execution time, in milliseconds.
+				double medianMs_ = -1.0;
+
+				/// The P90 execution time, in milliseconds.
+				double p90Ms_ = -1.0;
+
+				/// The P99 execution time, in milliseconds.
+				double p99Ms_ = -1.0;
+
+				/// The average execution time, in milliseconds.
+				double averageMs_ = -1.0;
+
+				/// The best execution time, in milliseconds.
+				double bestMs_ = -1.0;
+
+				/// The worst execution time, in milliseconds.
+				double worstMs_ = -1.0;
+		};
+
+		/**
+		 * Definition of a vector holding results.
+		 */
+		using Results = std::vector<Result>;
+
+		/**
+		 * This class holds a performance regression of a benchmark in relation to a baseline.
+		 */
+		class Regression
+		{
+			public:
+
+				/// The current result of the benchmark.
+				Result current_;
+
+				/// The baseline result of the benchmark.
+				Result baseline_;
+
+				/// The ratio between current and baseline median execution time, with range (1, infinity).
+				double ratio_ = 1.0;
+		};
+
+		/**
+		 * Definition of a vector holding regressions.
+		 */
+		using Regressions = std::vector<Regression>;
+
+		/**
+		 * Definition of a benchmark function.
+		 * The function receives nullptr for single-core executions and the worker for multi-core executions.<br>
+		 * All data needed by the function should be prepared before the benchmark is executed so that only the function of interest is measured.
+		 */
+		using BenchmarkFunction = std::function<void(Worker*)>;
+
+	public:
+
+		/**
+		 * Creates a new benchmark object.
+		 * @param configuration The configuration to be used
+		 */
+		explicit Benchmark(const Configuration& configuration = Configuration());
+
+		/**
+		 * Executes one benchmark function and adds the results to this object.
+		 * The function is executed single-core, and additionally with the worker if a worker with more than one thread is provided and the configuration asks for it.
+		 * @param name The hierarchical name of the benchmark, e.g., "frameconverter.y_uv12torgb24", must be valid
+		 * @param parameters The parameters of the benchmark, e.g., "1920x1080 Y_UV12 -> RGB24", must not contain a comma
+		 * @param function The function to be benchmarked, must be valid
+		 * @param worker Optional worker object to compare the single-core execution with the multi-core execution
+		 */
+		void run(const std::string& name, const std::string& parameters, const BenchmarkFunction& function, Worker* worker = nullptr);
+
+		/**
+		 * Adds the measurements of a benchmark which has been executed outside of this object.
+		 * This function can be used for benchmarks which cannot be expressed as repeatable function, e.g., the per-frame latency of a tracker replaying a recording.
+		 * @param name The hierarchical name of the benchmark, e.g., "trackermono.handleframe", must be valid
+		 * @param parameters The parameters of the benchmark, e.g., the name of the recording, must not contain a comma
+		 * @param statistic The statistic holding all measurements of the benchmark
+		 * @param threads The number of threads which have been used, with range [1, infinity)
+		 */
+		void addMeasurements(const std::string& name, const std::string& parameters, const HighPerformanceStatistic& statistic, const unsigned int threads = 1u);
+
+		/**
+		 * Returns the results of all benchmarks which have been executed so far.
+		 * @return The benchmark results
+		 */
+		inline const Results& results() const;
+
+		/**
+		 * Returns the configuration of this benchmark object.
+		 * @return The benchmark's configuration
+		 */
+		inline const Configuration& configuration() const;
+
+		/**
+		 * Returns the results of all benchmarks as JSON string.
+		 * The JSON object contains the platform, the processor and one entry for each result.
+		 * @return The JSON string
+		 */
+		std::string toJSON() const;
+
+		/**
+		 * Returns the results of all benchmarks as CSV string.
+		 * The first line holds the column names, each following line holds one result.
+		 * @return The CSV string
+		 */
+		std::string toCSV() const;
+
+		/**
+		 * Writes the results of all benchmarks to a file.
+		 * The format is selected by the file extension, ".json" for JSON, any other extension for CSV.
+		 * @param filename The name of the file, must be valid
+		 * @return True, if succeeded
+		 */
+		bool writeResults(const std::string& filename) const;
+
+		/**
+		 * Parses results from a CSV string as created by toCSV().
+		 * @param csv The CSV string to parse
+		 * @param results The resulting results
+		 * @return True, if succeeded
+		 */
+		static bool parseCSV(const std::string& csv, Results& results);
+
+		/**
+		 * Reads results from a CSV file as created by writeResults().
+		 * @param filename The name of the file, must be valid
+		 * @param results The resulting results
+		 * @return True, if succeeded
+		 */
+		static bool readCSV(const std::string& filename, Results& results);
+
+		/**
+		 * Compares results with baseline results and returns all regressions.
+		 * A benchmark regressed if its median execution time exceeds the median baseline execution time by more than the given tolerance.<br>
+		 * Benchmarks without corresponding baseline are ignored.
+		 * @param results The current results
+		 * @param baselineResults The baseline results
+		 * @param tolerance The relative tolerance, e.g., 0.1 to accept a 10% slower execution, with range [0, infinity)
+		 * @return The regressions, empty if no benchmark regressed
+		 */
+		static Regressions determineRegressions(const Results& results, const Results& baselineResults, const double tolerance);
+
+	protected:
+
+		/**
+		 * Executes one benchmark function in one execution mode.
+		 * @param name The hierarchical name of the benchmark, must be valid
+		 * @param parameters The parameters of the benchmark
+		 * @param function The function to be benchmarked, must be valid
+		 * @param worker The worker to be forwarded to the function, nullptr for single-core execution
+		 * @return The result of the benchmark
+		 */
+		Result execute(const std::string& name, const std::string& parameters, const BenchmarkFunction& function, Worker* worker) const;
+
+		/**
+		 * Creates a result from the measurements of a statistic.
+		 * @param name The hierarchical name of the benchmark, must be valid
+		 * @param parameters The parameters of the benchmark
+		 * @param statistic The statistic holding the measurements
+		 * @param threads The number of threads which have been used, with range [1, infinity)
+		 * @return The resulting result
+		 */
+		static Result createResult(const std::string& name, const std::string& parameters, const HighPerformanceStatistic& statistic, const unsigned int threads);
+
+	protected:
+
+		/// The configuration of this benchmark object.
+		Configuration configuration_;
+
+		/// The results of all benchmarks which have been executed so far.
+		Results results_;
+};
+
+inline Benchmark::Configuration::Configuration(const unsigned int warmupIterations, const unsigned int repetitions, const bool compareWorker) :
+	warmupIterations_(warmupIterations),
+	repetitions_(repetitions),
+	compareWorker_(compareWorker)
+{
+	ocean_assert(repetitions_ >= 1u);
+}
+
+inline unsigned int Benchmark::Configuration::warmupIterations() const
+{
+	return warmupIterations_;
+}
+
+inline unsigned int Benchmark::Configuration::repetitions() const
+{
+	return repetitions_;
+}
+
+inline bool Benchmark::Configuration::compareWorker() const
+{
+	return compareWorker_;
+}
+
+inline bool Benchmark::Result::isSameBenchmark(const Result& result) const
+{
+	return name_ == result.name_ && parameters_ == result.parameters_ && (threads_ == 1u) == (result.threads_ == 1u);
+}
+
+inline const Benchmark::Results& Benchmark::results() const
+{
+	return results_;
+}
+
+inline const Benchmark::Configuration& Benchmark::configuration() const
+{
+	return configuration_;
+}
+
+}
+
+}
+
+#endif // META_OCEAN_TEST_BENCHMARK_H
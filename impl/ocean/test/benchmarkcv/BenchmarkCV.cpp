@@ -0,0 +1,45 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "ocean/test/benchmarkcv/BenchmarkCV.h"
+#include "ocean/test/benchmarkcv/BenchmarkFrameOperations.h"
+
+#include "ocean/base/Build.h"
+#include "ocean/base/Processor.h"
+
+namespace Ocean
+{
+
+namespace Test
+{
+
+namespace BenchmarkCV
+{
+
+void benchmarkCV(Benchmark& benchmark, Worker& worker, const std::string& benchmarkFunctions)
+{
+	const TestSelector selector(benchmarkFunctions);
+
+	Log::info() << "+++   Ocean Computer Vision Library benchmark:   +++";
+	Log::info() << " ";
+	Log::info() << "Platform: " << Build::buildString();
+	Log::info() << "Processor: " << Processor::brand();
+	Log::info() << "Worker threads: " << worker.threads();
+	Log::info() << "Warm-up iterations: " << benchmark.configuration().warmupIterations() << ", repetitions: " << benchmark.configuration().repetitions();
+	Log::info() << " ";
+
+	BenchmarkFrameOperations::benchmark(benchmark, worker, selector);
+
+	Log::info() << "Benchmark finished with " << benchmark.results().size() << " results";
+	Log::info() << " ";
+}
+
+}
+
+}
+
+}
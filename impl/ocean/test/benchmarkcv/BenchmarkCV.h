@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#ifndef META_OCEAN_TEST_BENCHMARKCV_BENCHMARKCV_H
+#define META_OCEAN_TEST_BENCHMARKCV_BENCHMARKCV_H
+
+#include "ocean/test/Test.h"
+#include "ocean/test/Benchmark.h"
+
+#include "ocean/base/Worker.h"
+
+namespace Ocean
+{
+
+namespace Test
+{
+
+namespace BenchmarkCV
+{
+
+/**
+ * @ingroup test
+ * @defgroup benchmarkcv Ocean Benchmark CV Library
+ * @{
+ * The Ocean Benchmark CV Library provides micro-benchmarks for the computer vision functionalities.
+ * In contrast to the Test CV Library, the benchmarks use fixed input sizes and pixel formats and a fixed number of repetitions so that the results can be compared across releases and devices.
+ * The library is platform independent.
+ * @}
+ */
+
+/**
+ * @namespace Ocean::Test::BenchmarkCV Namespace of the CV Benchmark library.<p>
+ * The Namespace Ocean::Test::BenchmarkCV is used in the entire Ocean CV Benchmark Library.
+ */
+
+// Defines OCEAN_BENCHMARK_CV_EXPORT for dll export and import.
+#if defined(_WINDOWS) && defined(OCEAN_RUNTIME_SHARED)
+	#ifdef USE_OCEAN_BENCHMARK_CV_EXPORT
+		#define OCEAN_BENCHMARK_CV_EXPORT __declspec(dllexport)
+	#else
+		#define OCEAN_BENCHMARK_CV_EXPORT __declspec(dllimport)
+	#endif
+#else
+	#define OCEAN_BENCHMARK_CV_EXPORT
+#endif
+
+/**
+ * Executes the micro-benchmarks of the entire Computer Vision library.
+ * @param benchmark The benchmark object receiving the results
+ * @param worker The worker object to compare the single-core executions with multi-core executions
+ * @param benchmarkFunctions Optional comma-separated names of the benchmarks to execute, e.g., "frameconverter, frameshrinker.downsamplebytwo11", empty to execute all benchmarks
+ * @ingroup benchmarkcv
+ */
+OCEAN_BENCHMARK_CV_EXPORT void benchmarkCV(Benchmark& benchmark, Worker& worker, const std::string& benchmarkFunctions = std::string());
+
+}
+
+}
+
+}
+
+#endif // META_OCEAN_TEST_BENCHMARKCV_BENCHMARKCV_H
@@ -0,0 +1,182 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "ocean/test/benchmarkcv/BenchmarkFrameOperations.h"
+
+#include "ocean/base/Frame.h"
+#include "ocean/base/RandomGenerator.h"
+#include "ocean/base/String.h"
+
+#include "ocean/cv/CVUtilities.h"
+#include "ocean/cv/FrameConverterY_UV12.h"
+#include "ocean/cv/FrameFilterGaussian.h"
+#include "ocean/cv/FrameInterpolatorBilinear.h"
+#include "ocean/cv/FrameShrinker.h"
+#include "ocean/cv/FrameStatistics.h"
+
+namespace Ocean
+{
+
+namespace Test
+{
+
+namespace BenchmarkCV
+{
+
+void BenchmarkFrameOperations::benchmark(Benchmark& benchmark, Worker& worker, const TestSelector& selector)
+{
+	if (TestSelector subSelector = selector.shouldRun("frameconverter"))
+	{
+		benchmarkFrameConverter(benchmark, worker, subSelector);
+	}
+
+	if (TestSelector subSelector = selector.shouldRun("frameshrinker"))
+	{
+		benchmarkFrameShrinker(benchmark, worker, subSelector);
+	}
+
+	if (TestSelector subSelector = selector.shouldRun("frameinterpolatorbilinear"))
+	{
+		benchmarkFrameInterpolatorBilinear(benchmark, worker, subSelector);
+	}
+
+	if (TestSelector subSelector = selector.shouldRun("framefiltergaussian"))
+	{
+		benchmarkFrameFilterGaussian(benchmark, worker, subSelector);
+	}
+
+	if (TestSelector subSelector = selector.shouldRun("framestatistics"))
+	{
+		benchmarkFrameStatistics(benchmark, worker, subSelector);
+	}
+}
+
+void BenchmarkFrameOperations::benchmarkFrameConverter(Benchmark& benchmark, Worker& worker, const TestSelector& selector)
+{
+	RandomGenerator randomGenerator(0u);
+
+	const Frame source = CV::CVUtilities::randomizedFrame(FrameType(1920u, 1080u, FrameType::FORMAT_Y_UV12, FrameType::ORIGIN_UPPER_LEFT), &randomGenerator);
+
+	if (selector.shouldRun("y_uv12torgb24"))
+	{
+		Frame target(FrameType(source, FrameType::FORMAT_RGB24));
+
+		benchmark.run("frameconverter.y_uv12torgb24", parameters(source.frameType(), target.frameType()), [&](Worker* useWorker)
+		{
+			CV::FrameConverterY_UV12::convertY_UV12LimitedRangeToRGB24FullRange(source.constdata<uint8_t>(0u), source.constdata<uint8_t>(1u), target.data<uint8_t>(), source.width(), source.height(), CV::FrameConverter::CONVERT_NORMAL, source.paddingElements(0u), source.paddingElements(1u), target.paddingElements(), useWorker);
+		}, &worker);
+	}
+
+	if (selector.shouldRun("y_uv12torgb24resized"))
+	{
+		Frame target(FrameType(source.width() / 2u, source.height() / 2u, FrameType::FORMAT_RGB24, FrameType::ORIGIN_UPPER_LEFT));
+
+		benchmark.run("frameconverter.y_uv12torgb24resized", parameters(source.frameType(), target.frameType()), [&](Worker* useWorker)
+		{
+			CV::FrameConverterY_UV12::convertY_UV12LimitedRangeToRGB24FullRangeResized(source.constdata<uint8_t>(0u), source.constdata<uint8_t>(1u), target.data<uint8_t>(), source.width(), source.height(), target.width(), target.height(), source.paddingElements(0u), source.paddingElements(1u), target.paddingElements(), useWorker);
+		}, &worker);
+	}
+}
+
+void BenchmarkFrameOperations::benchmarkFrameShrinker(Benchmark& benchmark, Worker& worker, const TestSelector& selector)
+{
+	RandomGenerator randomGenerator(0u);
+
+	for (const FrameType::PixelFormat pixelFormat : {FrameType::FORMAT_Y8, FrameType::FORMAT_RGB24})
+	{
+		const Frame source = CV::CVUtilities::randomizedFrame(FrameType(1920u, 1080u, pixelFormat, FrameType::ORIGIN_UPPER_LEFT), &randomGenerator);
+
+		if (selector.shouldRun("downsamplebytwo11"))
+		{
+			Frame target(FrameType(source, source.width() / 2u, source.height() / 2u));
+
+			benchmark.run("frameshrinker.downsamplebytwo11", parameters(source.frameType(), target.frameType()), [&](Worker* useWorker)
+			{
+				CV::FrameShrinker::downsampleByTwo11(source, target, useWorker);
+			}, &worker);
+		}
+	}
+}
+
+void BenchmarkFrameOperations::benchmarkFrameInterpolatorBilinear(Benchmark& benchmark, Worker& worker, const TestSelector& selector)
+{
+	RandomGenerator randomGenerator(0u);
+
+	for (const FrameType::PixelFormat pixelFormat : {FrameType::FORMAT_Y8, FrameType::FORMAT_RGB24})
+	{
+		const Frame source = CV::CVUtilities::randomizedFrame(FrameType(1920u, 1080u, pixelFormat, FrameType::ORIGIN_UPPER_LEFT), &randomGenerator);
+
+		if (selector.shouldRun("resize"))
+		{
+			Frame target(FrameType(source, 1280u, 720u));
+
+			benchmark.run("frameinterpolatorbilinear.resize", parameters(source.frameType(), target.frameType()), [&](Worker* useWorker)
+			{
+				CV::FrameInterpolatorBilinear::Comfort::resize(source, target, useWorker);
+			}, &worker);
+		}
+	}
+}
+
+void BenchmarkFrameOperations::benchmarkFrameFilterGaussian(Benchmark& benchmark, Worker& worker, const TestSelector& selector)
+{
+	RandomGenerator randomGenerator(0u);
+
+	for (const FrameType::PixelFormat pixelFormat : {FrameType::FORMAT_Y8, FrameType::FORMAT_RGB24})
+	{
+		const Frame source = CV::CVUtilities::randomizedFrame(FrameType(1920u, 1080u, pixelFormat, FrameType::ORIGIN_UPPER_LEFT), &randomGenerator);
+
+		for (const unsigned int filterSize : {3u, 7u})
+		{
+			if (selector.shouldRun("filter"))
+			{
+				Frame target(source.frameType());
+
+				CV::FrameFilterGaussian::ReusableMemory reusableMemory;
+
+				benchmark.run("framefiltergaussian.filter", parameters(source.frameType()) + " " + String::toAString(filterSize) + "x" + String::toAString(filterSize), [&](Worker* useWorker)
+				{
+					CV::FrameFilterGaussian::filter(source, target, filterSize, useWorker, &reusableMemory);
+				}, &worker);
+			}
+		}
+	}
+}
+
+void BenchmarkFrameOperations::benchmarkFrameStatistics(Benchmark& benchmark, Worker& worker, const TestSelector& selector)
+{
+	RandomGenerator randomGenerator(0u);
+
+	const Frame source = CV::CVUtilities::randomizedFrame(FrameType(1920u, 1080u, FrameType::FORMAT_Y8, FrameType::ORIGIN_UPPER_LEFT), &randomGenerator);
+
+	if (selector.shouldRun("determinestatistics"))
+	{
+		benchmark.run("framestatistics.determinestatistics", parameters(source.frameType()) + " all", [&](Worker* useWorker)
+		{
+			const CV::FrameStatistics::Statistics8BitPerChannel<1u> statistics = CV::FrameStatistics::determineStatistics8BitPerChannel<1u>(source.constdata<uint8_t>(), source.width(), source.height(), source.paddingElements(), CV::FrameStatistics::ST_ALL, useWorker);
+			ocean_assert_and_suppress_unused(statistics.pixels() != 0ull, statistics);
+		}, &worker);
+	}
+}
+
+std::string BenchmarkFrameOperations::parameters(const FrameType& frameType)
+{
+	ocean_assert(frameType.isValid());
+
+	return String::toAString(frameType.width()) + "x" + String::toAString(frameType.height()) + " " + FrameType::translatePixelFormat(frameType.pixelFormat());
+}
+
+std::string BenchmarkFrameOperations::parameters(const FrameType& sourceFrameType, const FrameType& targetFrameType)
+{
+	return parameters(sourceFrameType) + " -> " + parameters(targetFrameType);
+}
+
+}
+
+}
+
+}
@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#ifndef META_OCEAN_TEST_BENCHMARKCV_BENCHMARK_FRAME_OPERATIONS_H
+#define META_OCEAN_TEST_BENCHMARKCV_BENCHMARK_FRAME_OPERATIONS_H
+
+#include "ocean/test/benchmarkcv/BenchmarkCV.h"
+
+#include "ocean/test/Benchmark.h"
+#include "ocean/test/TestSelector.h"
+
+#include "ocean/base/Frame.h"
+#include "ocean/base/Worker.h"
+
+namespace Ocean
+{
+
+namespace Test
+{
+
+namespace BenchmarkCV
+{
+
+/**
+ * This class implements micro-benchmarks for frame operations like frame conversion, resizing, filtering and statistics.
+ * All benchmarks use fixed frame dimensions and pixel formats, the hierarchical benchmark names can be used to select a subset of benchmarks, e.g., "frameconverter.y_uv12torgb24".
+ * @ingroup benchmarkcv
+ */
+class OCEAN_BENCHMARK_CV_EXPORT BenchmarkFrameOperations
+{
+	public:
+
+		/**
+		 * Executes all selected benchmarks of frame operations.
+		 * @param benchmark The benchmark object receiving the results
+		 * @param worker The worker object to compare the single-core executions with multi-core executions
+		 * @param selector The selector defining the benchmarks to execute
+		 */
+		static void benchmark(Benchmark& benchmark, Worker& worker, const TestSelector& selector = TestSelector());
+
+		/**
+		 * Executes the benchmarks of the frame converter functions.
+		 * @param benchmark The benchmark object receiving the results
+		 * @param worker The worker object to compare the single-core executions with multi-core executions
+		 * @param selector The selector defining the benchmarks to execute
+		 */
+		static void benchmarkFrameConverter(Benchmark& benchmark, Worker& worker, const TestSelector& selector);
+
+		/**
+		 * Executes the benchmarks of the frame shrinker functions.
+		 * @param benchmark The benchmark object receiving the results
+		 * @param worker The worker object to compare the single-core executions with multi-core executions
+		 * @param selector The selector defining the benchmarks to execute
+		 */
+		static void benchmarkFrameShrinker(Benchmark& benchmark, Worker& worker, const TestSelector& selector);
+
+		/**
+		 * Executes the benchmarks of the bilinear frame interpolator functions.
+		 * @param benchmark The benchmark object receiving the results
+		 * @param worker The worker object to compare the single-core executions with multi-core executions
+		 * @param selector The selector defining the benchmarks to execute
+		 */
+		static void benchmarkFrameInterpolatorBilinear(Benchmark& benchmark, Worker& worker, const TestSelector& selector);
+
+		/**
+		 * Executes the benchmarks of the Gaussian frame filter functions.
+		 * @param benchmark The benchmark object receiving the results
+		 * @param worker The worker object to compare the single-core executions with multi-core executions
+		 * @param selector The selector defining the benchmarks to execute
+		 */
+		static void benchmarkFrameFilterGaussian(Benchmark& benchmark, Worker& worker, const TestSelector& selector);
+
+		/**
+		 * Executes the benchmarks of the frame statistics functions.
+		 * @param benchmark The benchmark object receiving the results
+		 * @param worker The worker object to compare the single-core executions with multi-core executions
+		 * @param selector The selector defining the benchmarks to execute
+		 */
+		static void benchmarkFrameStatistics(Benchmark& benchmark, Worker& worker, const TestSelector& selector);
+
+	protected:
+
+		/**
+		 * Returns the parameter string of a benchmark with one frame.
+		 * @param frameType The frame type of the benchmark, must be valid
+		 * @return The parameter string, e.g., "1920x1080 Y8"
+		 */
+		static std::string parameters(const FrameType& frameType);
+
+		/**
+		 * Returns the parameter string of a benchmark with a source and a target frame.
+		 * @param sourceFrameType The frame type of the source frame, must be valid
+		 * @param targetFrameType The frame type of the target frame, must be valid
+		 * @return The parameter string, e.g., "1920x1080 Y_UV12 -> 1920x1080 RGB24"
+		 */
+		static std::string parameters(const FrameType& sourceFrameType, const FrameType& targetFrameType);
+};
+
+}
+
+}
+
+}
+
+#endif // META_OCEAN_TEST_BENCHMARKCV_BENCHMARK_FRAME_OPERATIONS_H
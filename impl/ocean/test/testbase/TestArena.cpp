@@ -0,0 +1,313 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "ocean/test/testbase/TestArena.h"
+
+#include "ocean/base/Arena.h"
+#include "ocean/base/RandomI.h"
+#include "ocean/base/Timestamp.h"
+
+#include "ocean/test/TestResult.h"
+#include "ocean/test/Validation.h"
+
+namespace Ocean
+{
+
+namespace Test
+{
+
+namespace TestBase
+{
+
+bool TestArena::test(const double testDuration, const TestSelector& selector)
+{
+	TestResult testResult("Arena tests");
+
+	Log::info() << " ";
+
+	if (selector.shouldRun("allocation"))
+	{
+		testResult = testAllocation(testDuration);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
+	if (selector.shouldRun("containers"))
+	{
+		testResult = testContainers(testDuration);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
+	if (selector.shouldRun("steadystate"))
+	{
+		testResult = testSteadyState(testDuration);
+
+		Log::info() << " ";
+	}
+
+	Log::info() << testResult;
+
+	return testResult.succeeded();
+}
+
+#ifdef OCEAN_USE_GTEST
+
+TEST(TestArena, Allocation)
+{
+	EXPECT_TRUE(TestArena::testAllocation(GTEST_TEST_DURATION));
+}
+
+TEST(TestArena, Containers)
+{
+	EXPECT_TRUE(TestArena::testContainers(GTEST_TEST_DURATION));
+}
+
+TEST(TestArena, SteadyState)
+{
+	EXPECT_TRUE(TestArena::testSteadyState(GTEST_TEST_DURATION));
+}
+
+#endif // OCEAN_USE_GTEST
+
+bool TestArena::testAllocation(const double testDuration)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Test allocation:";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		Arena arena(size_t(RandomI::random(randomGenerator, 0u, 1024u)));
+
+		const unsigned int numberAllocations = RandomI::random(randomGenerator, 1u, 100u);
+
+		std::vector<std::pair<uint8_t*, size_t>> allocations;
+
+		for (unsigned int n = 0u; n < numberAllocations; ++n)
+		{
+			const size_t bytes = size_t(RandomI::random(randomGenerator, 1u, 2000u));
+			const size_t alignment = size_t(1) << RandomI::random(randomGenerator, 6u);
+
+			uint8_t* const data = static_cast<uint8_t*>(arena.allocate(bytes, alignment));
+
+			OCEAN_EXPECT_TRUE(validation, data != nullptr);
+			OCEAN_EXPECT_EQUAL(validation, size_t(uintptr_t(data) % alignment), size_t(0));
+
+			// each allocation gets an individual pattern so that overlapping allocations can be detected
+
+			memset(data, int(n % 256u), bytes);
+
+			allocations.emplace_back(data, bytes);
+		}
+
+		for (size_t nAllocation = 0; nAllocation < allocations.size(); ++nAllocation)
+		{
+			const uint8_t* const data = allocations[nAllocation].first;
+			const size_t bytes = allocations[nAllocation].second;
+
+			for (size_t n = 0; n < bytes; ++n)
+			{
+				if (data[n] != uint8_t(nAllocation % 256))
+				{
+					OCEAN_SET_FAILED(validation);
+					break;
+				}
+			}
+		}
+
+		OCEAN_EXPECT_GREATER_EQUAL(validation, arena.capacity(), arena.usedBytes());
+		OCEAN_EXPECT_EQUAL(validation, arena.peakBytes(), arena.usedBytes());
+
+		// the most recent allocation can be reused immediately
+
+		const size_t usedBytes = arena.usedBytes();
+
+		uint8_t* const data = static_cast<uint8_t*>(arena.allocate(16, 1));
+		arena.deallocate(data, 16);
+
+		OCEAN_EXPECT_EQUAL(validation, arena.usedBytes(), usedBytes);
+
+		for (const std::pair<uint8_t*, size_t>& allocation : allocations)
+		{
+			arena.deallocate(allocation.first, allocation.second);
+		}
+
+		arena.reset();
+
+		OCEAN_EXPECT_EQUAL(validation, arena.usedBytes(), size_t(0));
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
+bool TestArena::testContainers(const double testDuration)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Test containers:";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	Arena arena;
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		arena.reset();
+
+		const unsigned int numberElements = RandomI::random(randomGenerator, 1u, 1000u);
+
+		{
+			ArenaVector<uint64_t> values(arena);
+
+			for (unsigned int n = 0u; n < numberElements; ++n)
+			{
+				values.push_back(uint64_t(n) * uint64_t(n));
+			}
+
+			OCEAN_EXPECT_EQUAL(validation, values.size(), size_t(numberElements));
+
+			for (unsigned int n = 0u; n < numberElements; ++n)
+			{
+				OCEAN_EXPECT_EQUAL(validation, values[n], uint64_t(n) * uint64_t(n));
+			}
+
+			const ArenaVector<uint64_t> copiedValues(values);
+
+			OCEAN_EXPECT_TRUE(validation, copiedValues == values);
+			OCEAN_EXPECT_TRUE(validation, copiedValues.get_allocator() == values.get_allocator());
+		}
+
+		{
+			ArenaUnorderedSet<Index32> valueSet(16, arena);
+
+			for (unsigned int n = 0u; n < numberElements; ++n)
+			{
+				valueSet.insert(RandomI::random(randomGenerator, 100u));
+			}
+
+			OCEAN_EXPECT_LESS_EQUAL(validation, valueSet.size(), size_t(101));
+
+			for (const Index32 value : valueSet)
+			{
+				OCEAN_EXPECT_LESS_EQUAL(validation, value, 100u);
+			}
+		}
+
+		{
+			// the arena is forwarded to the values of the map
+
+			ArenaUnorderedMap<Index32, ArenaVector<Index32>> valueMap(16, arena);
+
+			for (unsigned int n = 0u; n < numberElements; ++n)
+			{
+				valueMap[n % 10u].push_back(n);
+			}
+
+			size_t numberValues = 0;
+
+			for (const ArenaUnorderedMap<Index32, ArenaVector<Index32>>::value_type& valuePair : valueMap)
+			{
+				OCEAN_EXPECT_TRUE(validation, valuePair.second.get_allocator() == ArenaAllocator<Index32>(arena));
+
+				for (const Index32 value : valuePair.second)
+				{
+					OCEAN_EXPECT_EQUAL(validation, value % 10u, valuePair.first);
+				}
+
+				numberValues += valuePair.second.size();
+			}
+
+			OCEAN_EXPECT_EQUAL(validation, numberValues, size_t(numberElements));
+		}
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
+bool TestArena::testSteadyState(const double testDuration)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Test steady state:";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		Arena arena;
+
+		const unsigned int maximalElements = RandomI::random(randomGenerator, 1u, 2000u);
+		const unsigned int numberFrames = RandomI::random(randomGenerator, 3u, 20u);
+
+		size_t heapAllocations = 0;
+
+		for (unsigned int nFrame = 0u; nFrame < numberFrames; ++nFrame)
+		{
+			arena.reset();
+
+			if (nFrame == 1u)
+			{
+				// the arena has seen the largest frame and has merged all blocks
+
+				heapAllocations = arena.heapAllocations();
+			}
+
+			// the first frame is the largest frame, the following frames have random sizes
+
+			const unsigned int numberElements = nFrame == 0u ? maximalElements : RandomI::random(randomGenerator, 1u, maximalElements);
+
+			ArenaVector<double> values(arena);
+			ArenaVector<Index32> pointIds(arena);
+
+			for (unsigned int n = 0u; n < numberElements; ++n)
+			{
+				values.emplace_back(double(n));
+				pointIds.emplace_back(n);
+			}
+
+			ArenaUnorderedSet<Index32> pointIdSet(pointIds.size(), arena);
+			pointIdSet.insert(pointIds.cbegin(), pointIds.cend());
+
+			OCEAN_EXPECT_EQUAL(validation, pointIdSet.size(), size_t(numberElements));
+		}
+
+		OCEAN_EXPECT_EQUAL(validation, arena.heapAllocations(), heapAllocations);
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
+}
+
+}
+
+}
@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#ifndef META_OCEAN_TEST_TESTBASE_TEST_ARENA_H
+#define META_OCEAN_TEST_TESTBASE_TEST_ARENA_H
+
+#include "ocean/test/testbase/TestBase.h"
+
+#include "ocean/test/TestSelector.h"
+
+namespace Ocean
+{
+
+namespace Test
+{
+
+namespace TestBase
+{
+
+/**
+ * This class implements a test for the arena allocator.
+ * @ingroup testbase
+ */
+class OCEAN_TEST_BASE_EXPORT TestArena
+{
+	public:
+
+		/**
+		 * Tests the arena allocator.
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @param selector The selector to filter individual test cases
+		 * @return True, if succeeded
+		 */
+		static bool test(const double testDuration, const TestSelector& selector = TestSelector());
+
+		/**
+		 * Tests the alignment and the separation of individual allocations.
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @return True, if succeeded
+		 */
+		static bool testAllocation(const double testDuration);
+
+		/**
+		 * Tests STL containers using the arena.
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @return True, if succeeded
+		 */
+		static bool testContainers(const double testDuration);
+
+		/**
+		 * Tests that the arena does not allocate heap memory anymore once a steady state has been reached.
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @return True, if succeeded
+		 */
+		static bool testSteadyState(const double testDuration);
+};
+
+}
+
+}
+
+}
+
+#endif // META_OCEAN_TEST_TESTBASE_TEST_ARENA_H
@@ -6,6 +6,7 @@
  */
 
 #include "ocean/test/testbase/TestBase.h"
+#include "ocean/test/testbase/TestArena.h"
 #include "ocean/test/testbase/TestBinary.h"
 #include "ocean/test/testbase/TestCallback.h"
 #include "ocean/test/testbase/TestCaller.h"
@@ -21,8 +22,14 @@
 #include "ocean/test/testbase/TestLock.h"
 #include "ocean/test/testbase/TestMedian.h"
 #include "ocean/test/testbase/TestMemory.h"
+#include "ocean/test/testbase/TestMemoryPool.h"
+#include "ocean/test/testbase/TestMemoryTracker.h"
+#include "ocean/test/testbase/TestMessenger.h"
 #include "ocean/test/testbase/TestMoveBehavior.h"
+#include "ocean/test/testbase/TestPipeline.h"
+#include "ocean/test/testbase/TestPluginManager.h"
 #include "ocean/test/testbase/TestRandomI.h"
+#include "ocean/test/testbase/TestRandomXoshiro.h"
 #include "ocean/test/testbase/TestRingMap.h"
 #include "ocean/test/testbase/TestScopedFunction.h"
 #include "ocean/test/testbase/TestScopedObject.h"
@@ -32,11 +39,14 @@
 #include "ocean/test/testbase/TestStaticBuffer.h"
 #include "ocean/test/testbase/TestStaticVector.h"
 #include "ocean/test/testbase/TestSTL.h"
+#include "ocean/test/testbase/TestSharedFrameRing.h"
 #include "ocean/test/testbase/TestSignal.h"
 #include "ocean/test/testbase/TestString.h"
 #include "ocean/test/testbase/TestSubset.h"
+#include "ocean/test/testbase/TestTask.h"
 #include "ocean/test/testbase/TestThread.h"
 #include "ocean/test/testbase/TestThreadPool.h"
+#include "ocean/test/testbase/TestTimerWheel.h"
 #include "ocean/test/testbase/TestTimestamp.h"
 #include "ocean/test/testbase/TestUtilities.h"
 #include "ocean/test/testbase/TestValue.h"
@@ -135,6 +145,24 @@ bool testBase(const double testDuration, Worker& worker, const std::string& test
 		testResult = TestLock::test(subSelector);
 	}
 
+	if (TestSelector subSelector = selector.shouldRun("messenger"))
+	{
+		Log::info() << " ";
+		Log::info() << " ";
+		Log::info() << " ";
+		Log::info() << " ";
+		testResult = TestMessenger::test(testDuration, subSelector);
+	}
+
+	if (TestSelector subSelector = selector.shouldRun("pluginmanager"))
+	{
+		Log::info() << " ";
+		Log::info() << " ";
+		Log::info() << " ";
+		Log::info() << " ";
+		testResult = TestPluginManager::test(subSelector);
+	}
+
 	if (TestSelector subSelector = selector.shouldRun("singleton"))
 	{
 		Log::info() << " ";
@@ -153,6 +181,15 @@ bool testBase(const double testDuration, Worker& worker, const std::string& test
 		testResult = TestRandomI::test(testDuration, subSelector);
 	}
 
+	if (TestSelector subSelector = selector.shouldRun("randomxoshiro"))
+	{
+		Log::info() << " ";
+		Log::info() << " ";
+		Log::info() << " ";
+		Log::info() << " ";
+		testResult = TestRandomXoshiro::test(testDuration, subSelector);
+	}
+
 	if (TestSelector subSelector = selector.shouldRun("ringmap"))
 	{
 		Log::info() << " ";
@@ -207,6 +244,15 @@ bool testBase(const double testDuration, Worker& worker, const std::string& test
 		testResult = TestHighPerformanceStatistic::test(subSelector);
 	}
 
+	if (TestSelector subSelector = selector.shouldRun("highperformancebenchmark"))
+	{
+		Log::info() << " ";
+		Log::info() << " ";
+		Log::info() << " ";
+		Log::info() << " ";
+		testResult = TestHighPerformanceBenchmark::test(subSelector);
+	}
+
 	if (TestSelector subSelector = selector.shouldRun("inheritance"))
 	{
 		Log::info() << " ";
@@ -270,6 +316,51 @@ bool testBase(const double testDuration, Worker& worker, const std::string& test
 		testResult = TestMemory::test(testDuration, worker, subSelector);
 	}
 
+	if (TestSelector subSelector = selector.shouldRun("memorypool"))
+	{
+		Log::info() << " ";
+		Log::info() << " ";
+		Log::info() << " ";
+		Log::info() << " ";
+		testResult = TestMemoryPool::test(testDuration, subSelector);
+	}
+
+	if (TestSelector subSelector = selector.shouldRun("arena"))
+	{
+		Log::info() << " ";
+		Log::info() << " ";
+		Log::info() << " ";
+		Log::info() << " ";
+		testResult = TestArena::test(testDuration, subSelector);
+	}
+
+	if (TestSelector subSelector = selector.shouldRun("memorytracker"))
+	{
+		Log::info() << " ";
+		Log::info() << " ";
+		Log::info() << " ";
+		Log::info() << " ";
+		testResult = TestMemoryTracker::test(testDuration, subSelector);
+	}
+
+	if (TestSelector subSelector = selector.shouldRun("timerwheel"))
+	{
+		Log::info() << " ";
+		Log::info() << " ";
+		Log::info() << " ";
+		Log::info() << " ";
+		testResult = TestTimerWheel::test(testDuration, subSelector);
+	}
+
+	if (TestSelector subSelector = selector.shouldRun("sharedframering"))
+	{
+		Log::info() << " ";
+		Log::info() << " ";
+		Log::info() << " ";
+		Log::info() << " ";
+		testResult = TestSharedFrameRing::test(testDuration, subSelector);
+	}
+
 	if (TestSelector subSelector = selector.shouldRun("utilities"))
 	{
 		Log::info() << " ";
@@ -396,6 +487,24 @@ bool testBase(const double testDuration, Worker& worker, const std::string& test
 		testResult = TestThreadPool::test(testDuration, subSelector);
 	}
 
+	if (TestSelector subSelector = selector.shouldRun("pipeline"))
+	{
+		Log::info() << " ";
+		Log::info() << " ";
+		Log::info() << " ";
+		Log::info() << " ";
+		testResult = TestPipeline::test(testDuration, subSelector);
+	}
+
+	if (TestSelector subSelector = selector.shouldRun("task"))
+	{
+		Log::info() << " ";
+		Log::info() << " ";
+		Log::info() << " ";
+		Log::info() << " ";
+		testResult = TestTask::test(testDuration, subSelector);
+	}
+
 	if (TestSelector subSelector = selector.shouldRun("staticbuffer"))
 	{
 		Log::info() << " ";
@@ -568,8 +568,77 @@ bool TestDataType::testFloat16(const double testDuration)
 		OCEAN_EXPECT_EQUAL(validation, value_1_0_16, -2.0f);
 	}
 
+	{
+		// testing the conversion from 32-bit float, all finite 16-bit floats must be converted back to the identical binary value
+
+		for (unsigned int binary = 0u; binary <= 0xFFFFu; ++binary)
+		{
+			const Float16 value = Float16(uint16_t(binary));
+
+			const uint16_t exponent = uint16_t((binary >> 10u) & 0x1Fu);
+			const uint16_t fraction = uint16_t(binary & 0x3FFu);
+
+			if (exponent == 31u && fraction != 0u)
+			{
+				// NaN values are not handled by the cast operator
+				continue;
+			}
+
+			OCEAN_EXPECT_EQUAL(validation, Float16(float(value)), value);
+		}
+
+		OCEAN_EXPECT_EQUAL(validation, Float16(1.0f), Float16(0u, 0u, 15u));
+		OCEAN_EXPECT_EQUAL(validation, Float16(-2.0f), Float16(1u, 0u, 16u));
+		OCEAN_EXPECT_EQUAL(validation, Float16(0.0f), Float16(0u, 0u, 0u));
+		OCEAN_EXPECT_EQUAL(validation, Float16(-0.0f), Float16(1u, 0u, 0u));
+
+		OCEAN_EXPECT_EQUAL(validation, Float16(65504.0f), Float16(0u, 1023u, 30u));
+		OCEAN_EXPECT_EQUAL(validation, Float16(65520.0f), Float16::infinity());
+		OCEAN_EXPECT_EQUAL(validation, Float16(-1.0e10f), -Float16::infinity());
+		OCEAN_EXPECT_EQUAL(validation, Float16(std::numeric_limits<float>::infinity()), Float16::infinity());
+
+		OCEAN_EXPECT_EQUAL(validation, float(Float16::infinity()), std::numeric_limits<float>::infinity());
+
+		// ties are rounded to even
+
+		OCEAN_EXPECT_EQUAL(validation, Float16(1.0f + 1.0f / 2048.0f), Float16(0u, 0u, 15u));
+		OCEAN_EXPECT_EQUAL(validation, Float16(1.0f + 3.0f / 2048.0f), Float16(0u, 2u, 15u));
+
+		// values below half of the smallest subnormal value become zero
+
+		OCEAN_EXPECT_EQUAL(validation, Float16(0.000000029802322f), Float16(0u, 0u, 0u));
+		OCEAN_EXPECT_EQUAL(validation, Float16(0.000000059604645f), Float16(0u, 1u, 0u));
+	}
+
 	do
 	{
+		{
+			// testing the conversion of random 32-bit float values, the result must be the closest 16-bit float value
+
+			const float unitValue = float(double(RandomI::random32(randomGenerator)) / double(0xFFFFFFFFu)) * 2.0f - 1.0f;
+			const float value = unitValue * 65504.0f * (RandomI::boolean(randomGenerator) ? 1.0f : NumericF::pow(2.0f, -float(RandomI::random(randomGenerator, 24u))));
+
+			const Float16 value16(value);
+			const float result = float(value16);
+
+			const uint16_t binary = value16.binary();
+
+			const float lowerNeighbor = float(Float16(uint16_t(binary - 1u)));
+			const float upperNeighbor = float(Float16(uint16_t(binary + 1u)));
+
+			const float error = NumericF::abs(result - value);
+
+			if ((binary & 0x7FFFu) != 0u)
+			{
+				OCEAN_EXPECT_LESS_EQUAL(validation, error, NumericF::abs(lowerNeighbor - value));
+			}
+
+			if ((binary & 0x7FFFu) != 0x7BFFu)
+			{
+				OCEAN_EXPECT_LESS_EQUAL(validation, error, NumericF::abs(upperNeighbor - value));
+			}
+		}
+
 		{
 			// testing inverse
 
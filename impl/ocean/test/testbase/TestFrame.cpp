@@ -17,6 +17,8 @@
 #include "ocean/test/TestSelector.h"
 #include "ocean/test/Validation.h"
 
+#include <thread>
+
 namespace Ocean
 {
 
@@ -303,6 +305,15 @@ bool TestFrame::test(const double testDuration, const TestSelector& selector)
 		Log::info() << " ";
 	}
 
+	if (selector.shouldRun("copyonwrite"))
+	{
+		testResult = testCopyOnWrite(testDuration);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
 	if (selector.shouldRun("formatispacked"))
 	{
 		testResult = testFormatIsPacked();
@@ -594,6 +605,11 @@ TEST(TestFrame, UpdateMemory)
 	EXPECT_TRUE(TestFrame::testUpdateMemory(GTEST_TEST_DURATION));
 }
 
+TEST(TestFrame, CopyOnWrite)
+{
+	EXPECT_TRUE(TestFrame::testCopyOnWrite(GTEST_TEST_DURATION));
+}
+
 #endif // OCEAN_USE_GTEST
 
 bool TestFrame::testDefinedDataTypes()
@@ -1272,7 +1288,8 @@ bool TestFrame::testCopyConstructor(const double testDuration)
 		Frame::ACM_COPY_KEEP_LAYOUT_DO_NOT_COPY_PADDING_DATA,
 		Frame::ACM_COPY_KEEP_LAYOUT_COPY_PADDING_DATA,
 		Frame::ACM_USE_OR_COPY,
-		Frame::ACM_USE_OR_COPY_KEEP_LAYOUT
+		Frame::ACM_USE_OR_COPY_KEEP_LAYOUT,
+		Frame::ACM_SHARE_OR_COPY_KEEP_LAYOUT
 	};
 
 	// ensuring that an invalid frame can be copied but creates an invalid frame
@@ -1363,6 +1380,7 @@ bool TestFrame::testCopyConstructor(const double testDuration)
 				{
 					unsigned int expectedPaddingElements = (unsigned int)(-1);
 					bool expectedIsOwner = false;
+					bool expectedIsShared = false;
 
 					switch (advancedCopyMode)
 					{
@@ -1395,6 +1413,12 @@ bool TestFrame::testCopyConstructor(const double testDuration)
 							expectedPaddingElements = sourceFrameOwner.paddingElements(planeIndex);
 							expectedIsOwner = true;
 							break;
+
+						case Frame::ACM_SHARE_OR_COPY_KEEP_LAYOUT:
+							expectedPaddingElements = sourceFrameOwner.paddingElements(planeIndex);
+							expectedIsOwner = true;
+							expectedIsShared = true;
+							break;
 					}
 
 					ocean_assert(expectedPaddingElements != (unsigned int)(-1));
@@ -1405,7 +1429,9 @@ bool TestFrame::testCopyConstructor(const double testDuration)
 
 					OCEAN_EXPECT_FALSE(validation, frameCopy.isReadOnly());
 
-					OCEAN_EXPECT_FALSE(validation, (expectedIsOwner && frameCopy.constdata<void>(planeIndex) == sourceFrameOwner.constdata<void>(planeIndex)) || (!expectedIsOwner && frameCopy.constdata<void>(planeIndex) != sourceFrameOwner.constdata<void>(planeIndex)));
+					OCEAN_EXPECT_EQUAL(validation, frameCopy.isShared(), expectedIsShared);
+
+					OCEAN_EXPECT_FALSE(validation, (expectedIsOwner && !expectedIsShared && frameCopy.constdata<void>(planeIndex) == sourceFrameOwner.constdata<void>(planeIndex)) || ((!expectedIsOwner || expectedIsShared) && frameCopy.constdata<void>(planeIndex) != sourceFrameOwner.constdata<void>(planeIndex)));
 				}
 			}
 		}
@@ -1466,6 +1492,11 @@ bool TestFrame::testCopyConstructor(const double testDuration)
 							expectedPaddingElements = sourceFrameOwner.paddingElements(planeIndex);
 							expectedIsOwner = false;
 							break;
+
+						case Frame::ACM_SHARE_OR_COPY_KEEP_LAYOUT:
+							expectedPaddingElements = sourceFrameOwner.paddingElements(planeIndex);
+							expectedIsOwner = true;
+							break;
 					}
 
 					ocean_assert(expectedPaddingElements != (unsigned int)(-1));
@@ -1544,6 +1575,11 @@ bool TestFrame::testCopyConstructor(const double testDuration)
 							expectedIsOwner = false;
 							expectedIsReadOnly = true;
 							break;
+
+						case Frame::ACM_SHARE_OR_COPY_KEEP_LAYOUT:
+							expectedPaddingElements = sourceFrameOwner.paddingElements(planeIndex);
+							expectedIsOwner = true;
+							break;
 					}
 
 					ocean_assert(expectedPaddingElements != (unsigned int)(-1));
@@ -5002,6 +5038,353 @@ bool TestFrame::testUpdateMemory(const double testDuration)
 	return validation.succeeded();
 }
 
+bool TestFrame::testCopyOnWrite(const double testDuration)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Copy-on-write test:";
+
+	const FrameType::PixelFormats pixelFormats =
+	{
+		FrameType::FORMAT_Y8,
+		FrameType::FORMAT_RGB24,
+		FrameType::FORMAT_Y_UV12,
+		FrameType::FORMAT_Y_U_V12,
+		FrameType::genericPixelFormat<float, 2u>(),
+	};
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		const FrameType frameType(randomizedFrameType(pixelFormats, &randomGenerator));
+
+		Indices32 paddingElementsPerPlane;
+
+		for (unsigned int planeIndex = 0u; planeIndex < frameType.numberPlanes(); ++planeIndex)
+		{
+			paddingElementsPerPlane.emplace_back(RandomI::random(randomGenerator, 0u, 1u) * RandomI::random(randomGenerator, 1u, 100u));
+		}
+
+		Frame sourceFrame(frameType, paddingElementsPerPlane);
+
+		for (unsigned int planeIndex = 0u; planeIndex < sourceFrame.numberPlanes(); ++planeIndex)
+		{
+			sourceFrame.setValue(0x40u, planeIndex, false /*skipPaddingData*/);
+		}
+
+		OCEAN_EXPECT_FALSE(validation, sourceFrame.isShared());
+
+		{
+			// the copy shares the memory of the source frame
+
+			Frame sharedFrame(sourceFrame, Frame::ACM_SHARE_OR_COPY_KEEP_LAYOUT);
+
+			OCEAN_EXPECT_TRUE(validation, sharedFrame.isValid());
+			OCEAN_EXPECT_EQUAL(validation, sharedFrame.frameType(), sourceFrame.frameType());
+
+			OCEAN_EXPECT_TRUE(validation, sharedFrame.isOwner());
+			OCEAN_EXPECT_FALSE(validation, sharedFrame.isReadOnly());
+
+			OCEAN_EXPECT_TRUE(validation, sharedFrame.isShared());
+			OCEAN_EXPECT_TRUE(validation, sourceFrame.isShared());
+
+			// the memory intersects until one of the frames has been made writable
+
+			OCEAN_EXPECT_TRUE(validation, sharedFrame.haveIntersectingMemory(sourceFrame));
+
+			for (unsigned int planeIndex = 0u; planeIndex < sourceFrame.numberPlanes(); ++planeIndex)
+			{
+				OCEAN_EXPECT_EQUAL(validation, sharedFrame.constdata<void>(planeIndex), sourceFrame.constdata<void>(planeIndex));
+				OCEAN_EXPECT_EQUAL(validation, sharedFrame.paddingElements(planeIndex), sourceFrame.paddingElements(planeIndex));
+			}
+
+			const unsigned int writePlaneIndex = RandomI::random(randomGenerator, sourceFrame.numberPlanes() - 1u);
+
+			Frame& writingFrame = RandomI::boolean(randomGenerator) ? sharedFrame : sourceFrame;
+			const Frame& otherFrame = &writingFrame == &sharedFrame ? sourceFrame : sharedFrame;
+
+			const void* previousMemory = otherFrame.constdata<void>(writePlaneIndex);
+
+			// the read-only accessors do not copy the shared memory
+
+			OCEAN_EXPECT_EQUAL(validation, writingFrame.constdata<void>(writePlaneIndex), previousMemory);
+			OCEAN_EXPECT_TRUE(validation, writingFrame.isShared());
+
+			// making the frame writable copies the memory, the source frame is not affected
+
+			OCEAN_EXPECT_TRUE(validation, writingFrame.makeWritable());
+			OCEAN_EXPECT_FALSE(validation, writingFrame.isShared());
+
+			uint8_t* const writableData = writingFrame.data<uint8_t>(writePlaneIndex);
+
+			OCEAN_EXPECT_TRUE(validation, writableData != nullptr);
+			OCEAN_EXPECT_NOT_EQUAL(validation, (const void*)(writableData), previousMemory);
+			OCEAN_EXPECT_EQUAL(validation, otherFrame.constdata<void>(writePlaneIndex), previousMemory);
+
+			if (writableData != nullptr)
+			{
+				// the copy contains the entire memory, including the padding data
+
+				OCEAN_EXPECT_EQUAL(validation, memcmp(writableData, previousMemory, writingFrame.size(writePlaneIndex)), 0);
+
+				memset(writableData, 0x80, writingFrame.size(writePlaneIndex));
+			}
+
+			OCEAN_EXPECT_FALSE(validation, otherFrame.isShared());
+			OCEAN_EXPECT_FALSE(validation, writingFrame.haveIntersectingMemory(otherFrame));
+
+			for (unsigned int planeIndex = 0u; planeIndex < otherFrame.numberPlanes(); ++planeIndex)
+			{
+				const uint8_t* data = otherFrame.constdata<uint8_t>(planeIndex);
+
+				for (unsigned int n = 0u; n < otherFrame.size(planeIndex); ++n)
+				{
+					if (data[n] != 0x40u)
+					{
+						OCEAN_SET_FAILED(validation);
+						break;
+					}
+				}
+			}
+
+			// a read-only view of a shared frame is not writable
+
+			Frame viewFrame(sharedFrame, Frame::ACM_USE_KEEP_LAYOUT);
+
+			OCEAN_EXPECT_EQUAL(validation, viewFrame.isReadOnly(), sharedFrame.isShared());
+		}
+
+		// the shared frame is disposed, the source frame holds the memory exclusively
+
+		OCEAN_EXPECT_FALSE(validation, sourceFrame.isShared());
+
+		{
+			// a frame not owning the memory cannot share the memory, so that the memory is copied
+
+			const Frame notOwnerFrame(sourceFrame, Frame::ACM_USE_KEEP_LAYOUT);
+			const Frame copiedFrame(notOwnerFrame, Frame::ACM_SHARE_OR_COPY_KEEP_LAYOUT);
+
+			OCEAN_EXPECT_TRUE(validation, copiedFrame.isOwner());
+			OCEAN_EXPECT_FALSE(validation, copiedFrame.isShared());
+			OCEAN_EXPECT_FALSE(validation, sourceFrame.isShared());
+			OCEAN_EXPECT_FALSE(validation, copiedFrame.haveIntersectingMemory(sourceFrame));
+
+			for (unsigned int planeIndex = 0u; planeIndex < copiedFrame.numberPlanes(); ++planeIndex)
+			{
+				OCEAN_EXPECT_EQUAL(validation, copiedFrame.paddingElements(planeIndex), sourceFrame.paddingElements(planeIndex));
+			}
+		}
+
+		{
+			// the frame's own writing functions make shared planes writable before modifying them, the source frame is not affected
+
+			for (unsigned int planeIndex = 0u; planeIndex < sourceFrame.numberPlanes(); ++planeIndex)
+			{
+				sourceFrame.setValue(0x40u, planeIndex, false /*skipPaddingData*/);
+			}
+
+			const unsigned int writeFunction = RandomI::random(randomGenerator, 2u);
+
+			Frame sharedFrame(sourceFrame, Frame::ACM_SHARE_OR_COPY_KEEP_LAYOUT);
+
+			OCEAN_EXPECT_TRUE(validation, sharedFrame.isShared());
+
+			const bool skipPaddingData = RandomI::boolean(randomGenerator);
+
+			for (unsigned int planeIndex = 0u; planeIndex < sharedFrame.numberPlanes(); ++planeIndex)
+			{
+				switch (writeFunction)
+				{
+					case 0u:
+						OCEAN_EXPECT_TRUE(validation, sharedFrame.setValue(0x80u, planeIndex, skipPaddingData));
+						break;
+
+					case 1u:
+					{
+						if (sharedFrame.planes()[planeIndex].elementTypeSize() == sizeof(uint8_t))
+						{
+							const std::vector<uint8_t> planePixelValue(sharedFrame.planeChannels(planeIndex), 0x80u);
+
+							OCEAN_EXPECT_TRUE(validation, sharedFrame.setValue<uint8_t>(planePixelValue.data(), planePixelValue.size(), planeIndex));
+						}
+						else
+						{
+							OCEAN_EXPECT_TRUE(validation, sharedFrame.setValue(0x80u, planeIndex, skipPaddingData));
+						}
+
+						break;
+					}
+
+					default:
+						break;
+				}
+			}
+
+			if (writeFunction == 2u)
+			{
+				Frame constantFrame(sourceFrame.frameType());
+
+				for (unsigned int planeIndex = 0u; planeIndex < constantFrame.numberPlanes(); ++planeIndex)
+				{
+					constantFrame.setValue(0x80u, planeIndex, false /*skipPaddingData*/);
+				}
+
+				OCEAN_EXPECT_TRUE(validation, sharedFrame.copy(0, 0, constantFrame));
+			}
+
+			OCEAN_EXPECT_FALSE(validation, sharedFrame.isShared());
+			OCEAN_EXPECT_FALSE(validation, sourceFrame.isShared());
+			OCEAN_EXPECT_FALSE(validation, sharedFrame.haveIntersectingMemory(sourceFrame));
+
+			for (unsigned int planeIndex = 0u; planeIndex < sourceFrame.numberPlanes(); ++planeIndex)
+			{
+				for (unsigned int y = 0u; y < sourceFrame.planeHeight(planeIndex); ++y)
+				{
+					const uint8_t* const sourceRow = sourceFrame.constrow<uint8_t>(y, planeIndex);
+					const uint8_t* const sharedRow = sharedFrame.constrow<uint8_t>(y, planeIndex);
+
+					for (unsigned int n = 0u; n < sourceFrame.planeWidthBytes(planeIndex); ++n)
+					{
+						if (sourceRow[n] != 0x40u || sharedRow[n] != 0x80u)
+						{
+							OCEAN_SET_FAILED(validation);
+						}
+					}
+				}
+			}
+		}
+
+		{
+			// several threads share and release the memory concurrently
+
+			const Frame& constSourceFrame = sourceFrame;
+			const uint8_t sourceValue = constSourceFrame.constdata<uint8_t>()[0];
+
+			std::vector<std::thread> threads;
+
+			std::atomic<unsigned int> failures(0u);
+
+			for (unsigned int n = 0u; n < 4u; ++n)
+			{
+				threads.emplace_back([&constSourceFrame, &failures]()
+				{
+					for (unsigned int iteration = 0u; iteration < 100u; ++iteration)
+					{
+						Frame sharedFrame(constSourceFrame, Frame::ACM_SHARE_OR_COPY_KEEP_LAYOUT);
+
+						if (sharedFrame.constdata<void>() != constSourceFrame.constdata<void>())
+						{
+							++failures;
+						}
+
+						if (iteration % 10u == 0u)
+						{
+							// writing to the own copy
+
+							if (!sharedFrame.makeWritable() || !sharedFrame.setValue(0x80u, 0u, false /*skipPaddingData*/))
+							{
+								++failures;
+							}
+						}
+					}
+				});
+			}
+
+			for (std::thread& thread : threads)
+			{
+				thread.join();
+			}
+
+			OCEAN_EXPECT_EQUAL(validation, failures.load(), 0u);
+
+			OCEAN_EXPECT_FALSE(validation, sourceFrame.isShared());
+			OCEAN_EXPECT_EQUAL(validation, sourceFrame.constdata<uint8_t>()[0], sourceValue);
+		}
+
+		{
+			// several threads write concurrently into individual rows of a frame which has been made writable once
+
+			for (unsigned int planeIndex = 0u; planeIndex < sourceFrame.numberPlanes(); ++planeIndex)
+			{
+				sourceFrame.setValue(0x40u, planeIndex, false /*skipPaddingData*/);
+			}
+
+			Frame sharedFrame(sourceFrame, Frame::ACM_SHARE_OR_COPY_KEEP_LAYOUT);
+
+			OCEAN_EXPECT_TRUE(validation, sharedFrame.makeWritable());
+
+			const void* writableMemory = sharedFrame.constdata<void>(0u);
+
+			const unsigned int numberThreads = RandomI::random(randomGenerator, 2u, 4u);
+
+			std::vector<std::thread> threads;
+			std::atomic<unsigned int> failures(0u);
+
+			for (unsigned int threadIndex = 0u; threadIndex < numberThreads; ++threadIndex)
+			{
+				threads.emplace_back([&sharedFrame, &failures, threadIndex, numberThreads, writableMemory]()
+				{
+					for (unsigned int planeIndex = 0u; planeIndex < sharedFrame.numberPlanes(); ++planeIndex)
+					{
+						for (unsigned int y = threadIndex; y < sharedFrame.planeHeight(planeIndex); y += numberThreads)
+						{
+							uint8_t* const row = sharedFrame.row<uint8_t>(y, planeIndex);
+
+							if (row == nullptr)
+							{
+								++failures;
+								continue;
+							}
+
+							memset(row, 0x80, sharedFrame.planeWidthBytes(planeIndex));
+						}
+					}
+
+					if (sharedFrame.constdata<void>(0u) != writableMemory)
+					{
+						// the accessors must never reallocate the memory
+						++failures;
+					}
+				});
+			}
+
+			for (std::thread& thread : threads)
+			{
+				thread.join();
+			}
+
+			OCEAN_EXPECT_EQUAL(validation, failures.load(), 0u);
+
+			for (unsigned int planeIndex = 0u; planeIndex < sharedFrame.numberPlanes(); ++planeIndex)
+			{
+				for (unsigned int y = 0u; y < sharedFrame.planeHeight(planeIndex); ++y)
+				{
+					const uint8_t* sharedRow = sharedFrame.constrow<uint8_t>(y, planeIndex);
+					const uint8_t* sourceRow = sourceFrame.constrow<uint8_t>(y, planeIndex);
+
+					for (unsigned int n = 0u; n < sharedFrame.planeWidthBytes(planeIndex); ++n)
+					{
+						if (sharedRow[n] != 0x80u || sourceRow[n] != 0x40u)
+						{
+							OCEAN_SET_FAILED(validation);
+							break;
+						}
+					}
+				}
+			}
+		}
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
 bool TestFrame::testFormatIsPacked()
 {
 	Log::info() << "Format is packed test:";
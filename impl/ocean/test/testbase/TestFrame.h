@@ -246,6 +246,13 @@ class OCEAN_TEST_BASE_EXPORT TestFrame
 		 */
 		static bool testUpdateMemory(const double testDuration);
 
+		/**
+		 * Tests frames sharing their memory with copy-on-write.
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @return True, if succeeded
+		 */
+		static bool testCopyOnWrite(const double testDuration);
+
 		/**
 		 * Tests the formatIsPacked() function.
 		 * @return True, if succeeded
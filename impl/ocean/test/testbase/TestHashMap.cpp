@@ -18,6 +18,7 @@
 
 #include <vector>
 #include <map>
+#include <unordered_map>
 
 namespace Ocean
 {
@@ -52,6 +53,15 @@ bool TestHashMap::test(const double testDuration, const TestSelector& selector)
 		Log::info() << " ";
 	}
 
+	if (selector.shouldRun("flathashmap"))
+	{
+		testResult = testFlatHashMap(testDuration);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
 	Log::info() << testResult;
 
 	return testResult.succeeded();
@@ -69,6 +79,11 @@ TEST(TestHashMap, MultipleIntegers)
 	EXPECT_TRUE(TestHashMap::testMultipleIntegers(GTEST_TEST_DURATION));
 }
 
+TEST(TestHashMap, FlatHashMap)
+{
+	EXPECT_TRUE(TestHashMap::testFlatHashMap(GTEST_TEST_DURATION));
+}
+
 #endif // OCEAN_USE_GTEST
 
 bool TestHashMap::testSingleIntegers(const double testDuration)
@@ -130,6 +145,23 @@ bool TestHashMap::testMultipleIntegers(const double testDuration)
 	return allSucceeded;
 }
 
+bool TestHashMap::testFlatHashMap(const double testDuration)
+{
+	bool allSucceeded = true;
+
+	allSucceeded = validationFlatHashMap(50u, testDuration) && allSucceeded;
+	allSucceeded = validationFlatHashMap(1000u, testDuration) && allSucceeded;
+	allSucceeded = validationFlatHashMap(100000u, testDuration) && allSucceeded;
+
+	Log::info() << " ";
+
+	allSucceeded = testPerformanceFlatHashMap(1000u, testDuration) && allSucceeded;
+	Log::info() << " ";
+	allSucceeded = testPerformanceFlatHashMap(20000u, testDuration) && allSucceeded;
+
+	return allSucceeded;
+}
+
 bool TestHashMap::testPerformanceSingleIntegers(const unsigned int number, const unsigned int occupancy, const double testDuration)
 {
 	ocean_assert(occupancy > 0u && occupancy <= 100u);
@@ -634,6 +666,224 @@ bool TestHashMap::validationMultipleIntegers(const unsigned int number, const un
 	return validation.succeeded();
 }
 
+
+bool TestHashMap::validationFlatHashMap(const unsigned int keyRange, const double testDuration)
+{
+	ocean_assert(keyRange >= 1u);
+	ocean_assert(testDuration > 0);
+
+	Log::info() << "Validation of flat hash map with " << keyRange << " possible keys:";
+
+	using FlatMap = FlatHashMap<Index32, uint64_t>;
+	using StdMap = std::unordered_map<Index32, uint64_t>;
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		const size_t initialCapacity = size_t(RandomI::random(randomGenerator, 100u));
+
+		FlatMap flatMap(initialCapacity);
+		StdMap stdMap;
+
+		const unsigned int operations = RandomI::random(randomGenerator, 1u, 10000u);
+
+		for (unsigned int nOperation = 0u; nOperation < operations; ++nOperation)
+		{
+			const Index32 key = RandomI::random(randomGenerator, keyRange - 1u);
+
+			switch (RandomI::random(randomGenerator, 4u))
+			{
+				case 0u:
+				{
+					const uint64_t value = RandomI::random64(randomGenerator);
+
+					const std::pair<FlatMap::iterator, bool> flatResult = flatMap.emplace(key, value);
+					const std::pair<StdMap::iterator, bool> stdResult = stdMap.emplace(key, value);
+
+					OCEAN_EXPECT_EQUAL(validation, flatResult.second, stdResult.second);
+					OCEAN_EXPECT_EQUAL(validation, flatResult.first->first, key);
+					OCEAN_EXPECT_EQUAL(validation, flatResult.first->second, stdResult.first->second);
+
+					break;
+				}
+
+				case 1u:
+				{
+					const uint64_t value = RandomI::random64(randomGenerator);
+
+					flatMap[key] = value;
+					stdMap[key] = value;
+
+					break;
+				}
+
+				case 2u:
+				{
+					OCEAN_EXPECT_EQUAL(validation, flatMap.erase(key), stdMap.erase(key));
+					break;
+				}
+
+				default:
+				{
+					const FlatMap::const_iterator iFlat = flatMap.find(key);
+					const StdMap::const_iterator iStd = stdMap.find(key);
+
+					OCEAN_EXPECT_EQUAL(validation, iFlat == flatMap.cend(), iStd == stdMap.cend());
+					OCEAN_EXPECT_EQUAL(validation, flatMap.contains(key), stdMap.contains(key));
+
+					if (iFlat != flatMap.cend() && iStd != stdMap.cend())
+					{
+						OCEAN_EXPECT_EQUAL(validation, iFlat->second, iStd->second);
+					}
+
+					break;
+				}
+			}
+
+			OCEAN_EXPECT_EQUAL(validation, flatMap.size(), stdMap.size());
+		}
+
+		// erasing elements while iterating
+
+		const Index32 modulo = RandomI::random(randomGenerator, 1u, 5u);
+
+		for (FlatMap::const_iterator iFlat = flatMap.cbegin(); iFlat != flatMap.cend(); /*noop*/)
+		{
+			if (iFlat->first % modulo == 0u)
+			{
+				OCEAN_EXPECT_EQUAL(validation, stdMap.erase(iFlat->first), size_t(1));
+
+				iFlat = flatMap.erase(iFlat);
+			}
+			else
+			{
+				++iFlat;
+			}
+		}
+
+		OCEAN_EXPECT_EQUAL(validation, flatMap.size(), stdMap.size());
+
+		size_t iteratedElements = 0;
+
+		for (const FlatMap::value_type& flatPair : flatMap)
+		{
+			const StdMap::const_iterator iStd = stdMap.find(flatPair.first);
+
+			if (iStd == stdMap.cend() || iStd->second != flatPair.second)
+			{
+				OCEAN_SET_FAILED(validation);
+			}
+
+			++iteratedElements;
+		}
+
+		OCEAN_EXPECT_EQUAL(validation, iteratedElements, stdMap.size());
+
+		flatMap.clear();
+
+		OCEAN_EXPECT_TRUE(validation, flatMap.empty());
+		OCEAN_EXPECT_FALSE(validation, flatMap.contains(Index32(RandomI::random(randomGenerator, keyRange - 1u))));
+	}
+	while (validation.succeededSoFar() && !startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
+bool TestHashMap::testPerformanceFlatHashMap(const unsigned int number, const double testDuration)
+{
+	ocean_assert(number >= 1u);
+	ocean_assert(testDuration > 0);
+
+	Log::info() << "Lookup performance for " << number << " elements:";
+
+	RandomGenerator randomGenerator;
+
+	using FlatMap = FlatHashMap<Index32, uint64_t>;
+	using StdMap = std::unordered_map<Index32, uint64_t>;
+
+	FlatMap flatMap;
+	StdMap stdMap;
+
+	while (stdMap.size() < size_t(number))
+	{
+		const Index32 key = RandomI::random32(randomGenerator);
+		const uint64_t value = RandomI::random64(randomGenerator);
+
+		stdMap.emplace(key, value);
+		flatMap.emplace(key, value);
+	}
+
+	// half of the lookup keys exist in the maps
+
+	Indices32 lookupKeys;
+	lookupKeys.reserve(stdMap.size() * 2);
+
+	for (const StdMap::value_type& stdPair : stdMap)
+	{
+		lookupKeys.push_back(stdPair.first);
+		lookupKeys.push_back(RandomI::random32(randomGenerator));
+	}
+
+	HighPerformanceStatistic stdPerformance;
+	HighPerformanceStatistic flatPerformance;
+
+	uint64_t stdSum = 0ull;
+	uint64_t flatSum = 0ull;
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		stdPerformance.start();
+
+			for (const Index32 key : lookupKeys)
+			{
+				const StdMap::const_iterator iStd = stdMap.find(key);
+
+				if (iStd != stdMap.cend())
+				{
+					stdSum += iStd->second;
+				}
+			}
+
+		stdPerformance.stop();
+
+		flatPerformance.start();
+
+			for (const Index32 key : lookupKeys)
+			{
+				const FlatMap::const_iterator iFlat = flatMap.find(key);
+
+				if (iFlat != flatMap.cend())
+				{
+					flatSum += iFlat->second;
+				}
+			}
+
+		flatPerformance.stop();
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Std performance: [" << stdPerformance.bestMseconds() << ", " << stdPerformance.medianMseconds() << ", " << stdPerformance.worstMseconds() << "] ms";
+	Log::info() << "Flat performance: [" << flatPerformance.bestMseconds() << ", " << flatPerformance.medianMseconds() << ", " << flatPerformance.worstMseconds() << "] ms";
+	Log::info() << "Boost factor: " << String::toAString(flatPerformance.median() > 0.0 ? stdPerformance.median() / flatPerformance.median() : -1.0, 2u) << "x";
+
+	if (stdSum != flatSum)
+	{
+		Log::info() << "Validation: FAILED!";
+		return false;
+	}
+
+	Log::info() << "Validation: succeeded.";
+
+	return true;
+}
 }
 
 }
@@ -50,6 +50,13 @@ class OCEAN_TEST_BASE_EXPORT TestHashMap
 		 */
 		static bool testMultipleIntegers(const double testDuration);
 
+		/**
+		 * Tests the flat hash map based on open addressing.
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @return True, if succeeded
+		 */
+		static bool testFlatHashMap(const double testDuration);
+
 	protected:
 
 		/**
@@ -96,6 +103,22 @@ class OCEAN_TEST_BASE_EXPORT TestHashMap
 		 * @return True, if succeeded
 		 */
 		static bool validationMultipleIntegers(const unsigned int number, const unsigned int occupancy, const double testDuration);
+
+		/**
+		 * Validates the flat hash map for random insert, find, and erase operations with a given range of keys.
+		 * @param keyRange The number of possible keys, with range [1, infinity)
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @return True, if succeeded
+		 */
+		static bool validationFlatHashMap(const unsigned int keyRange, const double testDuration);
+
+		/**
+		 * Measures the lookup performance of the flat hash map in comparison to std::unordered_map.
+		 * @param number The number of elements in the map, with range [1, infinity)
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @return True, if succeeded
+		 */
+		static bool testPerformanceFlatHashMap(const unsigned int number, const double testDuration);
 };
 
 }
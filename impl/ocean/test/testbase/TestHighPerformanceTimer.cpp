@@ -16,6 +16,7 @@
 #include "ocean/test/Validation.h"
 
 #include <cmath>
+#include <thread>
 
 namespace Ocean
 {
@@ -64,6 +65,25 @@ bool TestHighPerformanceStatistic::test(const TestSelector& selector)
 	return testResult.succeeded();
 }
 
+bool TestHighPerformanceBenchmark::test(const TestSelector& selector)
+{
+	TestResult testResult("Test high performance benchmark");
+	Log::info() << " ";
+
+	if (selector.shouldRun("tracing"))
+	{
+		testResult = testTracing();
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
+	Log::info() << testResult;
+
+	return testResult.succeeded();
+}
+
 #ifdef OCEAN_USE_GTEST
 
 TEST(TestHighPerformanceTimer, Precision)
@@ -76,6 +96,11 @@ TEST(TestHighPerformanceStatistic, Rest)
 	EXPECT_TRUE(TestHighPerformanceStatistic::testReset());
 }
 
+TEST(TestHighPerformanceBenchmark, Tracing)
+{
+	EXPECT_TRUE(TestHighPerformanceBenchmark::testTracing());
+}
+
 #endif // OCEAN_USE_GTEST
 
 bool TestHighPerformanceTimer::testPrecision()
@@ -163,6 +188,94 @@ bool TestHighPerformanceStatistic::testReset()
 	return validation.succeeded();
 }
 
+bool TestHighPerformanceBenchmark::testTracing()
+{
+	Log::info() << "Test Tracing:";
+	Log::info() << " ";
+
+	Validation validation;
+
+	HighPerformanceBenchmark& highPerformanceBenchmark = HighPerformanceBenchmark::get();
+
+	OCEAN_EXPECT_FALSE(validation, highPerformanceBenchmark.isTracing());
+
+	{
+		// events are not recorded while tracing is inactive
+
+		const HighPerformanceBenchmark::ScopedCategory scopedCategory("TestTracing::Inactive");
+
+		highPerformanceBenchmark.addTraceCounter("TestTracing::InactiveCounter", 1.0);
+	}
+
+	constexpr size_t eventsPerThread = 16;
+
+	OCEAN_EXPECT_TRUE(validation, highPerformanceBenchmark.startTracing(eventsPerThread));
+	OCEAN_EXPECT_TRUE(validation, highPerformanceBenchmark.isTracing());
+	OCEAN_EXPECT_FALSE(validation, highPerformanceBenchmark.startTracing(eventsPerThread));
+
+	constexpr unsigned int numberFrames = 20u;
+
+	for (unsigned int frameIndex = 0u; frameIndex < numberFrames; ++frameIndex)
+	{
+		highPerformanceBenchmark.setTraceFrameId(HighPerformanceBenchmark::TraceFrameId(frameIndex));
+
+		const HighPerformanceBenchmark::ScopedCategory scopedCategory("TestTracing::Frame");
+
+		std::thread thread([]()
+		{
+			const HighPerformanceBenchmark::ScopedCategory threadScopedCategory("TestTracing::\"Thread\"");
+
+			HighPerformanceBenchmark::get().addTraceCounter("TestTracing::Counter", 42.5);
+		});
+
+		thread.join();
+	}
+
+	highPerformanceBenchmark.setTraceFrameId(HighPerformanceBenchmark::invalidTraceFrameId_);
+
+	OCEAN_EXPECT_TRUE(validation, highPerformanceBenchmark.stopTracing());
+	OCEAN_EXPECT_FALSE(validation, highPerformanceBenchmark.isTracing());
+
+	std::string json;
+	OCEAN_EXPECT_TRUE(validation, highPerformanceBenchmark.exportChromeTrace(json));
+
+	const auto countOccurrences = [&json](const std::string& value)
+	{
+		size_t count = 0;
+
+		for (size_t position = json.find(value); position != std::string::npos; position = json.find(value, position + value.size()))
+		{
+			++count;
+		}
+
+		return count;
+	};
+
+	OCEAN_EXPECT_EQUAL(validation, countOccurrences("TestTracing::Inactive"), size_t(0));
+
+	// each thread recorded one counter value
+	OCEAN_EXPECT_EQUAL(validation, countOccurrences("\"TestTracing::Counter\""), size_t(numberFrames));
+	OCEAN_EXPECT_EQUAL(validation, countOccurrences("\"ph\":\"C\""), size_t(numberFrames));
+	OCEAN_EXPECT_EQUAL(validation, countOccurrences("\"args\":{\"value\":42.500}"), size_t(numberFrames));
+
+	// the ring buffer of the main thread holds the latest events only
+	OCEAN_EXPECT_EQUAL(validation, countOccurrences("\"TestTracing::Frame\""), size_t(eventsPerThread));
+
+	// each frame used an own thread, with escaped quotation marks
+	OCEAN_EXPECT_EQUAL(validation, countOccurrences("\"TestTracing::\\\"Thread\\\"\""), size_t(numberFrames));
+
+	OCEAN_EXPECT_EQUAL(validation, countOccurrences("\"ph\":\"X\""), size_t(eventsPerThread + numberFrames));
+
+	OCEAN_EXPECT_EQUAL(validation, countOccurrences("\"frame\":" + String::toAString(numberFrames - 1u) + "}"), size_t(2));
+	OCEAN_EXPECT_EQUAL(validation, countOccurrences("\"frame\":0}"), size_t(1));
+
+	OCEAN_EXPECT_TRUE(validation, json.front() == '{' && json.back() == '}');
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
 }
 
 }
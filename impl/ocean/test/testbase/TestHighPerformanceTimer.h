@@ -64,6 +64,28 @@ class OCEAN_TEST_BASE_EXPORT TestHighPerformanceStatistic
 		static bool testReset();
 };
 
+/**
+ * This class implements a test for the HighPerformanceBenchmark class.
+ * @ingroup testbase
+ */
+class OCEAN_TEST_BASE_EXPORT TestHighPerformanceBenchmark
+{
+	public:
+
+		/**
+		 * Tests all high performance benchmark tests.
+		 * @param selector The test selector to filter tests
+		 * @return True, if succeeded
+		 */
+		static bool test(const TestSelector& selector = TestSelector());
+
+		/**
+		 * Tests tracing of scoped categories and the export of the trace.
+		 * @return True, if succeeded
+		 */
+		static bool testTracing();
+};
+
 }
 
 }
@@ -11,6 +11,7 @@
 #include "ocean/base/KdTree.h"
 #include "ocean/base/Timestamp.h"
 #include "ocean/base/Utilities.h"
+#include "ocean/base/WorkerPool.h"
 #include "ocean/math/Numeric.h"
 #include "ocean/math/Random.h"
 
@@ -71,6 +72,24 @@ bool TestKdTree::test(const double testDuration, const TestSelector& selector)
 		Log::info() << " ";
 	}
 
+	if (selector.shouldRun("flatkdtree<double>"))
+	{
+		testResult = testFlatKdTree<double>(testDuration);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
+	if (selector.shouldRun("flatkdtree<float>"))
+	{
+		testResult = testFlatKdTree<float>(testDuration);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
 	Log::info() << testResult;
 
 	return testResult.succeeded();
@@ -98,6 +117,16 @@ TEST(TestKdTree, RadiusSearchInteger_Float)
 	EXPECT_TRUE(TestKdTree::testRadiusSearchInteger<float>(GTEST_TEST_DURATION));
 }
 
+TEST(TestKdTree, FlatKdTree_Double)
+{
+	EXPECT_TRUE(TestKdTree::testFlatKdTree<double>(GTEST_TEST_DURATION));
+}
+
+TEST(TestKdTree, FlatKdTree_Float)
+{
+	EXPECT_TRUE(TestKdTree::testFlatKdTree<float>(GTEST_TEST_DURATION));
+}
+
 #endif // OCEAN_USE_GTEST
 
 template<typename T>
@@ -657,6 +686,212 @@ bool TestKdTree::testRadiusSearchInteger(const unsigned int number, const unsign
 	return validation.succeeded();
 }
 
+template <typename T>
+bool TestKdTree::testFlatKdTree(const double testDuration)
+{
+	static_assert(std::is_same<float, T>::value || std::is_same<double, T>::value, "T must be float or double");
+	ocean_assert(testDuration > 0.0);
+
+	using DistanceType = typename FlatKdTree<T>::DistanceType;
+
+	Log::info() << "Flat k-d tree test for '" << TypeNamer::name<T>() << "':";
+	Log::info() << " ";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	constexpr unsigned int numberQueries = 100u;
+	constexpr unsigned int k = 5u;
+
+	const DistanceType epsilon = std::is_same<float, T>::value ? DistanceType(0.001) : DistanceType(1e-10);
+
+	HighPerformanceStatistic performanceBuild;
+	HighPerformanceStatistic performanceSearch;
+	HighPerformanceStatistic performanceBruteForce;
+
+	const WorkerPool::ScopedWorker scopedWorker(WorkerPool::get().scopedWorker());
+	Worker* const worker = scopedWorker();
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		const unsigned int dimension = RandomI::random(randomGenerator, 1u, 40u);
+		const unsigned int number = RandomI::random(randomGenerator, 0u, 5000u);
+
+		const bool useWorker = RandomI::boolean(randomGenerator);
+
+		std::vector<T> values(size_t(number) * size_t(dimension));
+
+		for (T& value : values)
+		{
+			value = RandomT<T>::scalar(randomGenerator, T(-1), T(1));
+		}
+
+		if (number >= 2u && RandomI::boolean(randomGenerator))
+		{
+			// duplicated values
+
+			for (unsigned int n = 0u; n < number / 2u; ++n)
+			{
+				const unsigned int source = RandomI::random(randomGenerator, number - 1u);
+				const unsigned int target = RandomI::random(randomGenerator, number - 1u);
+
+				memcpy(values.data() + size_t(target) * size_t(dimension), values.data() + size_t(source) * size_t(dimension), sizeof(T) * dimension);
+			}
+		}
+
+		std::vector<T> queries(size_t(numberQueries) * size_t(dimension));
+
+		for (T& query : queries)
+		{
+			query = RandomT<T>::scalar(randomGenerator, T(-1), T(1));
+		}
+
+		FlatKdTree<T> kdTree(dimension);
+
+		performanceBuild.start();
+			OCEAN_EXPECT_TRUE(validation, kdTree.build(values.data(), number, useWorker ? worker : nullptr));
+		performanceBuild.stop();
+
+		OCEAN_EXPECT_EQUAL(validation, kdTree.size(), size_t(number));
+		OCEAN_EXPECT_EQUAL(validation, kdTree.dimension(), dimension);
+
+		Indices32 batchIndices;
+		typename FlatKdTree<T>::DistanceTypes batchSqrDistances;
+
+		performanceSearch.start();
+			kdTree.nearestNeighbors(queries.data(), numberQueries, k, batchIndices, &batchSqrDistances, useWorker ? worker : nullptr);
+		performanceSearch.stop();
+
+		const DistanceType sqrRadius = DistanceType(RandomT<T>::scalar(randomGenerator, T(0), T(dimension) * T(0.25)));
+
+		std::vector<Indices32> batchRadiusIndicesGroups;
+		kdTree.radiusSearch(queries.data(), numberQueries, sqrRadius, batchRadiusIndicesGroups, useWorker ? worker : nullptr);
+
+		OCEAN_EXPECT_EQUAL(validation, batchIndices.size(), size_t(numberQueries * k));
+		OCEAN_EXPECT_EQUAL(validation, batchSqrDistances.size(), size_t(numberQueries * k));
+		OCEAN_EXPECT_EQUAL(validation, batchRadiusIndicesGroups.size(), size_t(numberQueries));
+
+		for (unsigned int q = 0u; q < numberQueries; ++q)
+		{
+			const T* const query = queries.data() + size_t(q) * size_t(dimension);
+
+			performanceBruteForce.start();
+
+			std::vector<std::pair<DistanceType, Index32>> bruteForce;
+			bruteForce.reserve(number);
+
+			for (unsigned int n = 0u; n < number; ++n)
+			{
+				const T* const value = values.data() + size_t(n) * size_t(dimension);
+
+				DistanceType sqrDistance = DistanceType(0);
+
+				for (unsigned int d = 0u; d < dimension; ++d)
+				{
+					sqrDistance += DistanceType(sqr(value[d] - query[d]));
+				}
+
+				bruteForce.emplace_back(sqrDistance, n);
+			}
+
+			std::sort(bruteForce.begin(), bruteForce.end());
+
+			performanceBruteForce.stop();
+
+			// nearest neighbor
+
+			DistanceType sqrDistance = DistanceType(-1);
+			const Index32 nearest = kdTree.nearestNeighbor(query, sqrDistance);
+
+			if (number == 0u)
+			{
+				OCEAN_EXPECT_EQUAL(validation, nearest, FlatKdTree<T>::invalidIndex);
+			}
+			else
+			{
+				OCEAN_EXPECT_LESS(validation, nearest, number);
+				OCEAN_EXPECT_LESS_EQUAL(validation, NumericT<DistanceType>::abs(sqrDistance - bruteForce.front().first), epsilon);
+			}
+
+			// k nearest neighbors, single and batched
+
+			Index32 indices[k];
+			DistanceType sqrDistances[k];
+
+			const size_t found = kdTree.nearestNeighbors(query, k, indices, sqrDistances);
+
+			OCEAN_EXPECT_EQUAL(validation, found, std::min(size_t(k), size_t(number)));
+
+			for (unsigned int i = 0u; i < k; ++i)
+			{
+				const Index32 batchIndex = batchIndices[q * k + i];
+				const DistanceType batchSqrDistance = batchSqrDistances[q * k + i];
+
+				if (i < found)
+				{
+					OCEAN_EXPECT_LESS(validation, indices[i], number);
+					OCEAN_EXPECT_LESS(validation, batchIndex, number);
+
+					OCEAN_EXPECT_LESS_EQUAL(validation, NumericT<DistanceType>::abs(sqrDistances[i] - bruteForce[i].first), epsilon);
+					OCEAN_EXPECT_LESS_EQUAL(validation, NumericT<DistanceType>::abs(batchSqrDistance - bruteForce[i].first), epsilon);
+
+					if (i != 0u)
+					{
+						OCEAN_EXPECT_LESS_EQUAL(validation, sqrDistances[i - 1u], sqrDistances[i]);
+					}
+				}
+				else
+				{
+					OCEAN_EXPECT_EQUAL(validation, batchIndex, FlatKdTree<T>::invalidIndex);
+				}
+			}
+
+			// radius search, single and batched
+
+			Indices32 radiusIndices;
+			kdTree.radiusSearch(query, sqrRadius, radiusIndices);
+
+			UnorderedIndexSet32 radiusIndexSet(radiusIndices.cbegin(), radiusIndices.cend());
+			OCEAN_EXPECT_EQUAL(validation, radiusIndexSet.size(), radiusIndices.size());
+
+			const UnorderedIndexSet32 batchRadiusIndexSet(batchRadiusIndicesGroups[q].cbegin(), batchRadiusIndicesGroups[q].cend());
+			OCEAN_EXPECT_TRUE(validation, radiusIndexSet == batchRadiusIndexSet);
+
+			for (const std::pair<DistanceType, Index32>& entry : bruteForce)
+			{
+				// values close to the border of the radius may be counted differently due to rounding
+
+				if (entry.first + epsilon < sqrRadius)
+				{
+					OCEAN_EXPECT_EQUAL(validation, radiusIndexSet.erase(entry.second), size_t(1));
+				}
+				else if (entry.first > sqrRadius + epsilon)
+				{
+					break;
+				}
+				else
+				{
+					radiusIndexSet.erase(entry.second);
+				}
+			}
+
+			OCEAN_EXPECT_TRUE(validation, radiusIndexSet.empty());
+		}
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Build performance: Best: " << performanceBuild.bestMseconds() << "ms, worst: " << performanceBuild.worstMseconds() << "ms, average: " << performanceBuild.averageMseconds() << "ms";
+	Log::info() << "Batched k-NN performance: Best: " << performanceSearch.bestMseconds() << "ms, worst: " << performanceSearch.worstMseconds() << "ms, average: " << performanceSearch.averageMseconds() << "ms";
+	Log::info() << "Brute force performance (per query): Best: " << performanceBruteForce.bestMseconds() << "ms, worst: " << performanceBruteForce.worstMseconds() << "ms, average: " << performanceBruteForce.averageMseconds() << "ms";
+
+	Log::info() << " ";
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
 }
 
 }
@@ -54,6 +54,15 @@ class OCEAN_TEST_BASE_EXPORT TestKdTree
 		template<typename T>
 		static bool testRadiusSearchInteger(const double testDuration);
 
+		/**
+		 * Tests the nearest neighbor, k-nearest-neighbors, and radius search functions of the flat k-d tree.
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @return True, if succeeded
+		 * @tparam T Scalar type used internally (can be `float` or `double`)
+		 */
+		template<typename T>
+		static bool testFlatKdTree(const double testDuration);
+
 	private:
 
 		/**
@@ -7,6 +7,8 @@
 
 #include "ocean/test/testbase/TestLock.h"
 
+#include "ocean/base/HighPerformanceTimer.h"
+
 #include "ocean/test/TestResult.h"
 #include "ocean/test/TestSelector.h"
 #include "ocean/test/Validation.h"
@@ -78,6 +80,15 @@ bool TestLock::test(const TestSelector& selector)
 		Log::info() << " ";
 	}
 
+	if (selector.shouldRun("profiler"))
+	{
+		testResult = testProfiler();
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
 	Log::info() << testResult;
 
 	return testResult.succeeded();
@@ -110,6 +121,11 @@ TEST(TestLock, DualScopedLock)
 	EXPECT_TRUE(TestLock::testDualScopedLock());
 }
 
+TEST(TestLock, Profiler)
+{
+	EXPECT_TRUE(TestLock::testProfiler());
+}
+
 #endif // OCEAN_USE_GTEST
 
 bool TestLock::testLockUnlock()
@@ -239,6 +255,118 @@ bool TestLock::testDualScopedLock()
 	return validation.succeeded();
 }
 
+
+bool TestLock::testProfiler()
+{
+	Log::info() << "Testing lock profiler:";
+
+	Validation validation;
+
+	LockProfiler& lockProfiler = LockProfiler::get();
+
+	const bool wasRunning = lockProfiler.isRunning();
+
+	lockProfiler.stop();
+	lockProfiler.reset();
+
+	constexpr unsigned int numberThreads = 4u;
+	constexpr unsigned int iterationsPerThread = 20u;
+
+	{
+		Lock lock("TestLock::testProfiler");
+		unsigned int counter = 0u;
+
+		OCEAN_EXPECT_TRUE(validation, lockProfiler.start());
+		OCEAN_EXPECT_FALSE(validation, lockProfiler.start());
+
+		std::vector<std::thread> threads;
+		threads.reserve(numberThreads);
+
+		for (unsigned int n = 0u; n < numberThreads; ++n)
+		{
+			threads.emplace_back([&lock, &counter]()
+			{
+				for (unsigned int i = 0u; i < iterationsPerThread; ++i)
+				{
+					const ScopedLock scopedLock(lock);
+
+					// recursive acquisitions are not counted
+					const ScopedLock recursiveScopedLock(lock);
+
+					++counter;
+					Thread::sleep(1u);
+				}
+			});
+		}
+
+		for (std::thread& thread : threads)
+		{
+			thread.join();
+		}
+
+		OCEAN_EXPECT_TRUE(validation, lockProfiler.stop());
+		OCEAN_EXPECT_FALSE(validation, lockProfiler.isRunning());
+
+		OCEAN_EXPECT_EQUAL(validation, counter, numberThreads * iterationsPerThread);
+
+		// locks which are acquired while the profiler is stopped are not profiled
+		const ScopedLock scopedLock(lock);
+	}
+
+	// the statistic of the destroyed lock must be kept
+
+	const LockProfiler::LockStatistics lockStatistics = lockProfiler.statistics();
+
+	const LockProfiler::LockStatistic* lockStatistic = nullptr;
+
+	for (const LockProfiler::LockStatistic& statistic : lockStatistics)
+	{
+		if (statistic.name_ == "TestLock::testProfiler")
+		{
+			lockStatistic = &statistic;
+			break;
+		}
+	}
+
+	if (lockStatistic != nullptr)
+	{
+		OCEAN_EXPECT_EQUAL(validation, lockStatistic->locks_, size_t(1));
+		OCEAN_EXPECT_EQUAL(validation, lockStatistic->acquisitions_, uint64_t(numberThreads * iterationsPerThread));
+		OCEAN_EXPECT_LESS_EQUAL(validation, lockStatistic->contentions_, lockStatistic->acquisitions_);
+
+		// each acquisition holds the lock for at least one millisecond
+		OCEAN_EXPECT_GREATER_EQUAL(validation, lockStatistic->holdSeconds_, double(numberThreads * iterationsPerThread) * 0.0005);
+		OCEAN_EXPECT_GREATER_EQUAL(validation, lockStatistic->maximalHoldSeconds_, 0.0005);
+		OCEAN_EXPECT_NOT_EQUAL(validation, lockStatistic->ownerThreadId_, uint64_t(0u));
+
+		const uint64_t histogramContentions = std::accumulate(lockStatistic->waitHistogram_.cbegin(), lockStatistic->waitHistogram_.cend(), uint64_t(0u));
+		OCEAN_EXPECT_EQUAL(validation, histogramContentions, lockStatistic->contentions_);
+
+		if (lockStatistic->contentions_ != 0u)
+		{
+			OCEAN_EXPECT_GREATER(validation, lockStatistic->waitSeconds_, 0.0);
+			OCEAN_EXPECT_LESS_EQUAL(validation, lockStatistic->waitPercentileSeconds(0.5), lockStatistic->waitPercentileSeconds(0.99));
+		}
+
+		OCEAN_EXPECT_FALSE(validation, lockProfiler.report().empty());
+	}
+	else
+	{
+		OCEAN_SET_FAILED(validation);
+	}
+
+	lockProfiler.reset();
+
+	if (wasRunning)
+	{
+		lockProfiler.start();
+	}
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
 }
 
 }
@@ -97,6 +97,12 @@ class OCEAN_TEST_BASE_EXPORT TestLock
 		 */
 		static bool testDualScopedLock();
 
+		/**
+		 * Tests the lock profiler.
+		 * @return True, if succeeded
+		 */
+		static bool testProfiler();
+
 	private:
 
 		/**
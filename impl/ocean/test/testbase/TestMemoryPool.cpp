@@ -0,0 +1,250 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "ocean/test/testbase/TestMemoryPool.h"
+
+#include "ocean/base/Frame.h"
+#include "ocean/base/Memory.h"
+#include "ocean/base/MemoryPool.h"
+#include "ocean/base/RandomI.h"
+#include "ocean/base/String.h"
+#include "ocean/base/Timestamp.h"
+
+#include "ocean/test/TestResult.h"
+#include "ocean/test/Validation.h"
+
+namespace Ocean
+{
+
+namespace Test
+{
+
+namespace TestBase
+{
+
+bool TestMemoryPool::test(const double testDuration, const TestSelector& selector)
+{
+	TestResult testResult("MemoryPool tests");
+
+	Log::info() << " ";
+
+	if (selector.shouldRun("allocation"))
+	{
+		testResult = testAllocation(testDuration);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
+	if (selector.shouldRun("frame"))
+	{
+		testResult = testFrame(testDuration);
+
+		Log::info() << " ";
+	}
+
+	Log::info() << testResult;
+
+	return testResult.succeeded();
+}
+
+#ifdef OCEAN_USE_GTEST
+
+TEST(TestMemoryPool, Allocation)
+{
+	EXPECT_TRUE(TestMemoryPool::testAllocation(GTEST_TEST_DURATION));
+}
+
+TEST(TestMemoryPool, Frame)
+{
+	EXPECT_TRUE(TestMemoryPool::testFrame(GTEST_TEST_DURATION));
+}
+
+#endif // OCEAN_USE_GTEST
+
+bool TestMemoryPool::testAllocation(const double testDuration)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Test allocation:";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	MemoryPool& memoryPool = MemoryPool::get();
+
+	const bool wasEnabled = MemoryPool::isEnabled();
+	MemoryPool::setEnabled(true);
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		memoryPool.clear();
+		memoryPool.resetStatistic();
+
+		const size_t size = size_t(RandomI::random(randomGenerator, 1u, 4u * 1024u * 1024u));
+
+		size_t capacity = size_t(-1);
+		void* memory = memoryPool.allocate(size, capacity);
+
+		OCEAN_EXPECT_TRUE(validation, memory != nullptr);
+
+		if (MemoryPool::isPoolable(size))
+		{
+			OCEAN_EXPECT_GREATER_EQUAL(validation, capacity, size);
+
+			// the capacity must not exceed the requested size by more than 25%
+			OCEAN_EXPECT_LESS_EQUAL(validation, capacity, size + size / 4 + 1);
+		}
+		else
+		{
+			OCEAN_EXPECT_EQUAL(validation, capacity, size_t(0));
+		}
+
+		if (memory != nullptr)
+		{
+			memset(memory, 0x80, size);
+
+			memoryPool.free(memory, capacity);
+		}
+
+		// a second allocation of the same size must be served by the pool
+
+		size_t secondCapacity = size_t(-1);
+		void* secondMemory = memoryPool.allocate(size, secondCapacity);
+
+		OCEAN_EXPECT_EQUAL(validation, secondCapacity, capacity);
+
+		const MemoryPool::Statistic statistic = memoryPool.statistic();
+
+		if (MemoryPool::isPoolable(size))
+		{
+			OCEAN_EXPECT_EQUAL(validation, statistic.hits(), uint64_t(1));
+			OCEAN_EXPECT_EQUAL(validation, statistic.misses(), uint64_t(1));
+			OCEAN_EXPECT_EQUAL(validation, statistic.recycled(), uint64_t(1));
+			OCEAN_EXPECT_EQUAL(validation, secondMemory, memory);
+		}
+		else
+		{
+			OCEAN_EXPECT_EQUAL(validation, statistic.hits(), uint64_t(0));
+		}
+
+		OCEAN_EXPECT_EQUAL(validation, statistic.cachedBytes(), size_t(0));
+
+		if (secondMemory != nullptr)
+		{
+			memoryPool.free(secondMemory, secondCapacity);
+		}
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	{
+		// the pool must not cache more memory than allowed
+
+		memoryPool.clear();
+		memoryPool.setMaximalCachedBytes(size_t(64 * 1024));
+
+		std::vector<std::pair<void*, size_t>> blocks;
+
+		for (unsigned int n = 0u; n < 10u; ++n)
+		{
+			size_t capacity = 0;
+			void* memory = memoryPool.allocate(size_t(16 * 1024), capacity);
+			blocks.emplace_back(memory, capacity);
+		}
+
+		for (const std::pair<void*, size_t>& block : blocks)
+		{
+			memoryPool.free(block.first, block.second);
+		}
+
+		OCEAN_EXPECT_LESS_EQUAL(validation, memoryPool.statistic().cachedBytes(), size_t(64 * 1024));
+		OCEAN_EXPECT_GREATER(validation, memoryPool.statistic().discarded(), uint64_t(0));
+
+		memoryPool.setMaximalCachedBytes(size_t(256) * size_t(1024 * 1024));
+	}
+
+	memoryPool.clear();
+	MemoryPool::setEnabled(wasEnabled);
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
+bool TestMemoryPool::testFrame(const double testDuration)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Test frame:";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	MemoryPool& memoryPool = MemoryPool::get();
+
+	const bool wasEnabled = MemoryPool::isEnabled();
+	MemoryPool::setEnabled(true);
+
+	memoryPool.clear();
+	memoryPool.resetStatistic();
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		const unsigned int width = RandomI::random(randomGenerator, 32u, 960u) * 2u;
+		const unsigned int height = RandomI::random(randomGenerator, 32u, 540u) * 2u;
+
+		const FrameType::PixelFormat pixelFormat = RandomI::random(randomGenerator, {FrameType::FORMAT_Y8, FrameType::FORMAT_RGB24, FrameType::FORMAT_Y_UV12});
+
+		for (unsigned int iteration = 0u; iteration < 5u; ++iteration)
+		{
+			Frame frame(FrameType(width, height, pixelFormat, FrameType::ORIGIN_UPPER_LEFT));
+
+			OCEAN_EXPECT_TRUE(validation, frame.isValid());
+
+			frame.setValue(0x40u);
+
+			Frame copiedFrame(frame, Frame::ACM_COPY_REMOVE_PADDING_LAYOUT);
+
+			OCEAN_EXPECT_TRUE(validation, copiedFrame.isValid() && copiedFrame.constpixel<uint8_t>(width - 1u, height - 1u)[0] == 0x40u);
+
+			Frame movedFrame(std::move(copiedFrame));
+
+			OCEAN_EXPECT_TRUE(validation, movedFrame.isValid() && movedFrame.constpixel<uint8_t>(0u, 0u)[0] == 0x40u);
+
+			Memory memory(size_t(width * height), size_t(16));
+
+			OCEAN_EXPECT_TRUE(validation, memory.data() != nullptr && size_t(memory.data()) % 16 == 0);
+		}
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	const MemoryPool::Statistic statistic = memoryPool.statistic();
+
+	// frames of identical size are created several times, thus some allocations must have been served by the pool
+
+	OCEAN_EXPECT_GREATER(validation, statistic.hits(), uint64_t(0));
+
+	Log::info() << "Pool hits: " << statistic.hits() << ", misses: " << statistic.misses() << ", hit ratio: " << String::toAString(statistic.hitRatio() * 100.0, 1u) << "%";
+
+	memoryPool.clear();
+	MemoryPool::setEnabled(wasEnabled);
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
+}
+
+}
+
+}
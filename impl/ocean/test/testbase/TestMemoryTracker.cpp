@@ -0,0 +1,206 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "ocean/test/testbase/TestMemoryTracker.h"
+
+#include "ocean/base/Frame.h"
+#include "ocean/base/MemoryTracker.h"
+#include "ocean/base/RandomI.h"
+#include "ocean/base/Timestamp.h"
+
+#include "ocean/test/TestResult.h"
+#include "ocean/test/Validation.h"
+
+namespace Ocean
+{
+
+namespace Test
+{
+
+namespace TestBase
+{
+
+bool TestMemoryTracker::test(const double testDuration, const TestSelector& selector)
+{
+	TestResult testResult("MemoryTracker tests");
+
+	Log::info() << " ";
+
+	if (selector.shouldRun("trackedbytes"))
+	{
+		testResult = testTrackedBytes(testDuration);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
+	if (selector.shouldRun("frame"))
+	{
+		testResult = testFrame(testDuration);
+
+		Log::info() << " ";
+	}
+
+	Log::info() << testResult;
+
+	return testResult.succeeded();
+}
+
+#ifdef OCEAN_USE_GTEST
+
+TEST(TestMemoryTracker, TrackedBytes)
+{
+	EXPECT_TRUE(TestMemoryTracker::testTrackedBytes(GTEST_TEST_DURATION));
+}
+
+TEST(TestMemoryTracker, Frame)
+{
+	EXPECT_TRUE(TestMemoryTracker::testFrame(GTEST_TEST_DURATION));
+}
+
+#endif // OCEAN_USE_GTEST
+
+bool TestMemoryTracker::testTrackedBytes(const double testDuration)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Test tracked bytes:";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	const MemoryTracker::CategoryId categoryId = MemoryTracker::registerCategory("TestMemoryTracker");
+
+	OCEAN_EXPECT_NOT_EQUAL(validation, categoryId, MemoryTracker::invalidCategoryId_);
+
+	// a category with the same name must not be registered twice
+	OCEAN_EXPECT_EQUAL(validation, MemoryTracker::registerCategory("TestMemoryTracker"), categoryId);
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		const uint64_t initialBytes = MemoryTracker::statistic(categoryId).currentBytes_;
+
+		MemoryTracker::startFrame();
+		MemoryTracker::resetPeaks();
+
+		const size_t firstBytes = size_t(RandomI::random(randomGenerator, 1u, 1024u * 1024u));
+		const size_t secondBytes = size_t(RandomI::random(randomGenerator, 1u, 1024u * 1024u));
+
+		{
+			MemoryTracker::TrackedBytes firstTrackedBytes(categoryId);
+			firstTrackedBytes.setBytes(firstBytes);
+
+			OCEAN_EXPECT_EQUAL(validation, firstTrackedBytes.bytes(), firstBytes);
+			OCEAN_EXPECT_EQUAL(validation, MemoryTracker::statistic(categoryId).currentBytes_, initialBytes + uint64_t(firstBytes));
+
+			// a copy reports the bytes again, a move does not report anything
+
+			MemoryTracker::TrackedBytes copiedTrackedBytes(firstTrackedBytes);
+			OCEAN_EXPECT_EQUAL(validation, MemoryTracker::statistic(categoryId).currentBytes_, initialBytes + uint64_t(firstBytes * 2));
+
+			MemoryTracker::TrackedBytes movedTrackedBytes(std::move(copiedTrackedBytes));
+			OCEAN_EXPECT_EQUAL(validation, copiedTrackedBytes.bytes(), size_t(0));
+			OCEAN_EXPECT_EQUAL(validation, MemoryTracker::statistic(categoryId).currentBytes_, initialBytes + uint64_t(firstBytes * 2));
+
+			movedTrackedBytes.setBytes(secondBytes);
+			OCEAN_EXPECT_EQUAL(validation, MemoryTracker::statistic(categoryId).currentBytes_, initialBytes + uint64_t(firstBytes) + uint64_t(secondBytes));
+
+			const MemoryTracker::Statistic statistic = MemoryTracker::statistic(categoryId);
+
+			OCEAN_EXPECT_EQUAL(validation, statistic.name_, std::string("TestMemoryTracker"));
+			OCEAN_EXPECT_EQUAL(validation, statistic.peakBytes_, initialBytes + uint64_t(firstBytes) + uint64_t(std::max(firstBytes, secondBytes)));
+			OCEAN_EXPECT_EQUAL(validation, statistic.framePeakBytes_, statistic.peakBytes_);
+			OCEAN_EXPECT_EQUAL(validation, statistic.frameAllocations_, secondBytes > firstBytes ? uint64_t(3) : uint64_t(2));
+		}
+
+		const MemoryTracker::Statistic statistic = MemoryTracker::statistic(categoryId);
+
+		OCEAN_EXPECT_EQUAL(validation, statistic.currentBytes_, initialBytes);
+
+		// the budget is based on the peak of the category
+
+		OCEAN_EXPECT_TRUE(validation, MemoryTracker::setBudget(categoryId, statistic.peakBytes_));
+		OCEAN_EXPECT_FALSE(validation, MemoryTracker::statistic(categoryId).exceedsBudget());
+
+		OCEAN_EXPECT_TRUE(validation, MemoryTracker::setBudget(categoryId, statistic.peakBytes_ - 1u));
+		OCEAN_EXPECT_TRUE(validation, MemoryTracker::statistic(categoryId).exceedsBudget());
+		OCEAN_EXPECT_FALSE(validation, MemoryTracker::exceededBudgets().empty());
+
+		OCEAN_EXPECT_TRUE(validation, MemoryTracker::setBudget(categoryId, 0ull));
+		OCEAN_EXPECT_FALSE(validation, MemoryTracker::statistic(categoryId).exceedsBudget());
+
+		MemoryTracker::startFrame();
+
+		OCEAN_EXPECT_EQUAL(validation, MemoryTracker::statistic(categoryId).frameAllocations_, uint64_t(0));
+		OCEAN_EXPECT_EQUAL(validation, MemoryTracker::statistic(categoryId).framePeakBytes_, initialBytes);
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
+bool TestMemoryTracker::testFrame(const double testDuration)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Test frame:";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	const MemoryTracker::CategoryId categoryId = MemoryTracker::registerCategory("Frame");
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		const unsigned int width = RandomI::random(randomGenerator, 1u, 1920u);
+		const unsigned int height = RandomI::random(randomGenerator, 1u, 1080u);
+
+		const FrameType::PixelFormat pixelFormat = RandomI::random(randomGenerator, {FrameType::FORMAT_Y8, FrameType::FORMAT_RGB24, FrameType::FORMAT_RGBA32});
+		const unsigned int paddingElements = RandomI::random(randomGenerator, 0u, 100u);
+
+		// frames may be created and released in other threads, thus we can only check lower bounds
+
+		{
+			Frame frame(FrameType(width, height, pixelFormat, FrameType::ORIGIN_UPPER_LEFT), paddingElements);
+
+			OCEAN_EXPECT_TRUE(validation, frame.isValid());
+
+			OCEAN_EXPECT_GREATER_EQUAL(validation, MemoryTracker::statistic(categoryId).currentBytes_, uint64_t(frame.size()));
+			OCEAN_EXPECT_GREATER_EQUAL(validation, MemoryTracker::statistic(categoryId).peakBytes_, uint64_t(frame.size()));
+
+			const uint64_t allocations = MemoryTracker::statistic(categoryId).allocations_;
+
+			// a frame not owning the memory does not allocate anything
+			const Frame notOwningFrame(frame, Frame::ACM_USE_KEEP_LAYOUT);
+
+			OCEAN_EXPECT_FALSE(validation, notOwningFrame.isOwner());
+
+			const Frame copiedFrame(frame, Frame::ACM_COPY_REMOVE_PADDING_LAYOUT);
+
+			OCEAN_EXPECT_GREATER_EQUAL(validation, MemoryTracker::statistic(categoryId).currentBytes_, uint64_t(frame.size() + copiedFrame.size()));
+			OCEAN_EXPECT_GREATER(validation, MemoryTracker::statistic(categoryId).allocations_, allocations);
+		}
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
+}
+
+}
+
+}
@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#ifndef META_OCEAN_TEST_TESTBASE_TEST_MEMORY_TRACKER_H
+#define META_OCEAN_TEST_TESTBASE_TEST_MEMORY_TRACKER_H
+
+#include "ocean/test/testbase/TestBase.h"
+
+#include "ocean/test/TestSelector.h"
+
+namespace Ocean
+{
+
+namespace Test
+{
+
+namespace TestBase
+{
+
+/**
+ * This class implements a test for the memory tracker.
+ * @ingroup testbase
+ */
+class OCEAN_TEST_BASE_EXPORT TestMemoryTracker
+{
+	public:
+
+		/**
+		 * Tests the memory tracker.
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @param selector The selector to filter individual test cases
+		 * @return True, if succeeded
+		 */
+		static bool test(const double testDuration, const TestSelector& selector = TestSelector());
+
+		/**
+		 * Tests the accounting of tracked bytes including peaks, per-frame counters, and budgets.
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @return True, if succeeded
+		 */
+		static bool testTrackedBytes(const double testDuration);
+
+		/**
+		 * Tests the accounting of frames.
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @return True, if succeeded
+		 */
+		static bool testFrame(const double testDuration);
+};
+
+}
+
+}
+
+}
+
+#endif // META_OCEAN_TEST_TESTBASE_TEST_MEMORY_TRACKER_H
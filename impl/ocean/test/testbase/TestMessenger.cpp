@@ -0,0 +1,353 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "ocean/test/testbase/TestMessenger.h"
+
+#include "ocean/base/RandomGenerator.h"
+#include "ocean/base/RandomI.h"
+#include "ocean/base/String.h"
+#include "ocean/base/Thread.h"
+#include "ocean/base/Timestamp.h"
+
+#include "ocean/test/TestResult.h"
+#include "ocean/test/Validation.h"
+
+#include <thread>
+
+namespace Ocean
+{
+
+namespace Test
+{
+
+namespace TestBase
+{
+
+TestMessenger::ScopedConfiguration::ScopedConfiguration()
+{
+	Messenger& messenger = Messenger::get();
+
+	outputType_ = messenger.outputType();
+	integrateDateTime_ = messenger.integrateDateTime();
+	asynchronousOutput_ = messenger.asynchronousOutput();
+
+	messenger.setAsynchronousOutput(false);
+	messenger.setIntegrateDateTime(false);
+	messenger.setOutputType(Messenger::OUTPUT_QUEUED);
+}
+
+TestMessenger::ScopedConfiguration::~ScopedConfiguration()
+{
+	Messenger& messenger = Messenger::get();
+
+	messenger.setAsynchronousOutput(false);
+	messenger.setOutputType(outputType_);
+	messenger.setIntegrateDateTime(integrateDateTime_);
+
+	if (asynchronousOutput_)
+	{
+		messenger.setAsynchronousOutput(true);
+	}
+}
+
+bool TestMessenger::test(const double testDuration, const TestSelector& selector)
+{
+	ocean_assert(testDuration > 0.0);
+
+	TestResult testResult("Messenger test");
+	Log::info() << " ";
+
+	if (selector.shouldRun("asynchronousorder"))
+	{
+		testResult = testAsynchronousOrder(testDuration);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
+	if (selector.shouldRun("asynchronousdisabling"))
+	{
+		testResult = testAsynchronousDisabling(testDuration);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
+	Log::info() << testResult;
+
+	return testResult.succeeded();
+}
+
+#ifdef OCEAN_USE_GTEST
+
+TEST(TestMessenger, AsynchronousOrder)
+{
+	EXPECT_TRUE(TestMessenger::testAsynchronousOrder(GTEST_TEST_DURATION));
+}
+
+TEST(TestMessenger, AsynchronousDisabling)
+{
+	EXPECT_TRUE(TestMessenger::testAsynchronousDisabling(GTEST_TEST_DURATION));
+}
+
+#endif // OCEAN_USE_GTEST
+
+bool TestMessenger::testAsynchronousOrder(const double testDuration)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Asynchronous output order test:";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		const unsigned int numberThreads = RandomI::random(randomGenerator, 2u, 4u);
+		const unsigned int numberMessages = RandomI::random(randomGenerator, 100u, 1000u);
+
+		std::vector<std::string> messages;
+		uint64_t droppedMessages = 0u;
+
+		{
+			// the messages are not logged before the configuration has been restored
+
+			const ScopedConfiguration scopedConfiguration;
+
+			Messenger& messenger = Messenger::get();
+
+			const uint64_t initialDroppedMessages = messenger.droppedMessages();
+
+			messenger.setAsynchronousOutput(true, size_t(numberMessages));
+
+			// the threads push the messages in turns, so that the order of all messages is known
+
+			std::atomic<unsigned int> nextMessageIndex(0u);
+
+			std::vector<std::thread> threads;
+			threads.reserve(numberThreads);
+
+			for (unsigned int threadIndex = 0u; threadIndex < numberThreads; ++threadIndex)
+			{
+				threads.emplace_back([&messenger, &nextMessageIndex, threadIndex, numberThreads, numberMessages]()
+				{
+					for (unsigned int messageIndex = threadIndex; messageIndex < numberMessages; messageIndex += numberThreads)
+					{
+						while (nextMessageIndex.load(std::memory_order_acquire) != messageIndex)
+						{
+							std::this_thread::yield();
+						}
+
+						messenger.push(Messenger::TYPE_INFORMATION, std::string(), testMessage(threadIndex, messageIndex));
+
+						nextMessageIndex.store(messageIndex + 1u, std::memory_order_release);
+					}
+				});
+			}
+
+			for (std::thread& thread : threads)
+			{
+				thread.join();
+			}
+
+			// the asynchronous output is still enabled, the flush must write all messages pushed so far
+
+			messenger.flushAsynchronousOutput();
+
+			messages = popTestMessages();
+			droppedMessages = messenger.droppedMessages() - initialDroppedMessages;
+		}
+
+		OCEAN_EXPECT_EQUAL(validation, droppedMessages, uint64_t(0u));
+
+		if (messages.size() == size_t(numberMessages))
+		{
+			for (unsigned int messageIndex = 0u; messageIndex < numberMessages; ++messageIndex)
+			{
+				OCEAN_EXPECT_EQUAL(validation, messages[messageIndex], testMessage(messageIndex % numberThreads, messageIndex));
+			}
+		}
+		else
+		{
+			OCEAN_SET_FAILED(validation);
+		}
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
+bool TestMessenger::testAsynchronousDisabling(const double testDuration)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Asynchronous output disabling test:";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		const unsigned int numberThreads = RandomI::random(randomGenerator, 2u, 4u);
+		const unsigned int numberMessagesPerThread = RandomI::random(randomGenerator, 100u, 1000u);
+
+		// small buffers ensure that some messages are dropped
+
+		const size_t bufferCapacity = size_t(RandomI::random(randomGenerator, 16u, 256u));
+		const unsigned int delay = RandomI::random(randomGenerator, 2u);
+
+		std::vector<std::string> messages;
+		uint64_t droppedMessages = 0u;
+
+		{
+			const ScopedConfiguration scopedConfiguration;
+
+			Messenger& messenger = Messenger::get();
+
+			const uint64_t initialDroppedMessages = messenger.droppedMessages();
+
+			messenger.setAsynchronousOutput(true, bufferCapacity);
+
+			std::vector<std::thread> threads;
+			threads.reserve(numberThreads);
+
+			for (unsigned int threadIndex = 0u; threadIndex < numberThreads; ++threadIndex)
+			{
+				threads.emplace_back([&messenger, threadIndex, numberMessagesPerThread]()
+				{
+					for (unsigned int messageIndex = 0u; messageIndex < numberMessagesPerThread; ++messageIndex)
+					{
+						messenger.push(Messenger::TYPE_INFORMATION, std::string(), testMessage(threadIndex, messageIndex));
+					}
+				});
+			}
+
+			// the asynchronous output is disabled while the threads are pushing messages
+
+			if (delay != 0u)
+			{
+				Thread::sleep(delay);
+			}
+
+			messenger.setAsynchronousOutput(false);
+
+			for (std::thread& thread : threads)
+			{
+				thread.join();
+			}
+
+			messages = popTestMessages();
+			droppedMessages = messenger.droppedMessages() - initialDroppedMessages;
+		}
+
+		OCEAN_EXPECT_EQUAL(validation, uint64_t(messages.size()) + droppedMessages, uint64_t(numberThreads * numberMessagesPerThread));
+
+		std::vector<unsigned int> nextMessageIndices(numberThreads, 0u);
+
+		for (const std::string& message : messages)
+		{
+			unsigned int threadIndex = (unsigned int)(-1);
+			unsigned int messageIndex = (unsigned int)(-1);
+
+			if (parseTestMessage(message, threadIndex, messageIndex) && threadIndex < numberThreads)
+			{
+				// dropped messages leave gaps, but the messages of each thread must not be reordered
+
+				OCEAN_EXPECT_GREATER_EQUAL(validation, messageIndex, nextMessageIndices[threadIndex]);
+
+				nextMessageIndices[threadIndex] = messageIndex + 1u;
+			}
+			else
+			{
+				OCEAN_SET_FAILED(validation);
+			}
+		}
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
+std::vector<std::string> TestMessenger::popTestMessages()
+{
+	std::vector<std::string> messages;
+
+	Messenger::MessageType type = Messenger::TYPE_INFORMATION;
+	std::string location;
+	std::string message;
+
+	while (Messenger::get().popMessage(type, location, message))
+	{
+		unsigned int threadIndex;
+		unsigned int messageIndex;
+
+		if (parseTestMessage(message, threadIndex, messageIndex))
+		{
+			messages.emplace_back(std::move(message));
+		}
+
+		type = Messenger::TYPE_INFORMATION;
+	}
+
+	return messages;
+}
+
+std::string TestMessenger::testMessage(const unsigned int threadIndex, const unsigned int messageIndex)
+{
+	return "TestMessenger " + String::toAString(threadIndex) + " " + String::toAString(messageIndex);
+}
+
+bool TestMessenger::parseTestMessage(const std::string& message, unsigned int& threadIndex, unsigned int& messageIndex)
+{
+	const std::string prefix("TestMessenger ");
+
+	if (message.compare(0, prefix.size(), prefix) != 0)
+	{
+		return false;
+	}
+
+	const std::string::size_type separator = message.find(' ', prefix.size());
+
+	if (separator == std::string::npos)
+	{
+		return false;
+	}
+
+	int value = -1;
+
+	if (!String::isInteger32(message.substr(prefix.size(), separator - prefix.size()), &value) || value < 0)
+	{
+		return false;
+	}
+
+	threadIndex = (unsigned int)(value);
+
+	if (!String::isInteger32(message.substr(separator + 1), &value) || value < 0)
+	{
+		return false;
+	}
+
+	messageIndex = (unsigned int)(value);
+
+	return true;
+}
+
+}
+
+}
+
+}
@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#ifndef META_OCEAN_TEST_TESTBASE_TEST_MESSENGER_H
+#define META_OCEAN_TEST_TESTBASE_TEST_MESSENGER_H
+
+#include "ocean/test/testbase/TestBase.h"
+#include "ocean/test/TestSelector.h"
+
+#include "ocean/base/Messenger.h"
+
+namespace Ocean
+{
+
+namespace Test
+{
+
+namespace TestBase
+{
+
+/**
+ * This class implements messenger tests.
+ * @ingroup testbase
+ */
+class OCEAN_TEST_BASE_EXPORT TestMessenger
+{
+	protected:
+
+		/**
+		 * This class configures the messenger for a test and restores the previous configuration afterwards.
+		 * While the object exists, messages are queued only and the asynchronous output is disabled.
+		 */
+		class ScopedConfiguration
+		{
+			public:
+
+				/**
+				 * Creates a new object and configures the messenger.
+				 */
+				ScopedConfiguration();
+
+				/**
+				 * Restores the previous configuration of the messenger.
+				 */
+				~ScopedConfiguration();
+
+			protected:
+
+				/// The previous output type.
+				Messenger::MessageOutput outputType_ = Messenger::OUTPUT_DISCARDED;
+
+				/// The previous date/time integration state.
+				bool integrateDateTime_ = false;
+
+				/// The previous asynchronous output state.
+				bool asynchronousOutput_ = false;
+		};
+
+	public:
+
+		/**
+		 * Tests all messenger functions.
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @param selector The test selector
+		 * @return True, if succeeded
+		 */
+		static bool test(const double testDuration, const TestSelector& selector);
+
+		/**
+		 * Tests that the asynchronous output writes the messages of several threads in the order in which they have been pushed.
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @return True, if succeeded
+		 */
+		static bool testAsynchronousOrder(const double testDuration);
+
+		/**
+		 * Tests that disabling the asynchronous output while several threads are pushing messages does not lose any message.
+		 * Each message is either written or counted as dropped, and the messages of each thread keep their order.
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @return True, if succeeded
+		 */
+		static bool testAsynchronousDisabling(const double testDuration);
+
+	protected:
+
+		/**
+		 * Pops all queued information messages which have been pushed by this test.
+		 * @return The text messages, in the order in which they have been queued
+		 */
+		static std::vector<std::string> popTestMessages();
+
+		/**
+		 * Creates the text of a message pushed by this test.
+		 * @param threadIndex The index of the pushing thread
+		 * @param messageIndex The index of the message
+		 * @return The text message
+		 */
+		static std::string testMessage(const unsigned int threadIndex, const unsigned int messageIndex);
+
+		/**
+		 * Parses the text of a message pushed by this test.
+		 * @param message The text message to parse
+		 * @param threadIndex The resulting index of the pushing thread
+		 * @param messageIndex The resulting index of the message
+		 * @return True, if succeeded
+		 */
+		static bool parseTestMessage(const std::string& message, unsigned int& threadIndex, unsigned int& messageIndex);
+};
+
+}
+
+}
+
+}
+
+#endif // META_OCEAN_TEST_TESTBASE_TEST_MESSENGER_H
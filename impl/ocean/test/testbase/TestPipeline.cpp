@@ -0,0 +1,340 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "ocean/test/testbase/TestPipeline.h"
+
+#include "ocean/base/Pipeline.h"
+#include "ocean/base/RandomI.h"
+#include "ocean/base/Timestamp.h"
+
+#include "ocean/test/TestResult.h"
+#include "ocean/test/Validation.h"
+
+namespace Ocean
+{
+
+namespace Test
+{
+
+namespace TestBase
+{
+
+bool TestPipeline::test(const double testDuration, const TestSelector& selector)
+{
+	TestResult testResult("Pipeline tests");
+
+	Log::info() << " ";
+
+	if (selector.shouldRun("queue"))
+	{
+		testResult = testQueue(testDuration);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
+	if (selector.shouldRun("stages"))
+	{
+		testResult = testStages(testDuration);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
+	if (selector.shouldRun("stop"))
+	{
+		testResult = testStop(testDuration);
+
+		Log::info() << " ";
+	}
+
+	Log::info() << testResult;
+
+	return testResult.succeeded();
+}
+
+#ifdef OCEAN_USE_GTEST
+
+TEST(TestPipeline, Queue)
+{
+	EXPECT_TRUE(TestPipeline::testQueue(GTEST_TEST_DURATION));
+}
+
+TEST(TestPipeline, Stages)
+{
+	EXPECT_TRUE(TestPipeline::testStages(GTEST_TEST_DURATION));
+}
+
+TEST(TestPipeline, Stop)
+{
+	EXPECT_TRUE(TestPipeline::testStop(GTEST_TEST_DURATION));
+}
+
+#endif // OCEAN_USE_GTEST
+
+bool TestPipeline::testQueue(const double testDuration)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Test queue:";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		const size_t capacity = size_t(RandomI::random(randomGenerator, 1u, 10u));
+		const unsigned int numberElements = RandomI::random(randomGenerator, 1u, 30u);
+
+		for (const Pipeline::DropPolicy dropPolicy : {Pipeline::DP_DROP_OLDEST, Pipeline::DP_DROP_NEWEST})
+		{
+			Pipeline pipeline;
+
+			const Pipeline::SharedQueue<unsigned int> queue = pipeline.addQueue<unsigned int>("Queue", capacity, dropPolicy);
+
+			OCEAN_EXPECT_TRUE(validation, queue != nullptr);
+
+			if (!queue)
+			{
+				continue;
+			}
+
+			for (unsigned int n = 0u; n < numberElements; ++n)
+			{
+				const bool pushed = queue->push((unsigned int)(n));
+
+				OCEAN_EXPECT_EQUAL(validation, pushed, dropPolicy == Pipeline::DP_DROP_OLDEST || size_t(n) < capacity);
+			}
+
+			const size_t expectedSize = std::min(capacity, size_t(numberElements));
+
+			OCEAN_EXPECT_EQUAL(validation, queue->size(), expectedSize);
+
+			// the oldest elements are dropped for DP_DROP_OLDEST, the newest elements for DP_DROP_NEWEST
+
+			const unsigned int firstElement = dropPolicy == Pipeline::DP_DROP_OLDEST ? numberElements - (unsigned int)(expectedSize) : 0u;
+
+			for (size_t n = 0; n < expectedSize; ++n)
+			{
+				unsigned int element = (unsigned int)(-1);
+
+				OCEAN_EXPECT_TRUE(validation, queue->pop(element));
+				OCEAN_EXPECT_EQUAL(validation, element, firstElement + (unsigned int)(n));
+			}
+
+			unsigned int element = 0u;
+			OCEAN_EXPECT_FALSE(validation, queue->pop(element));
+
+			const Pipeline::QueueStatistic statistic = queue->statistic();
+
+			OCEAN_EXPECT_EQUAL(validation, statistic.pushed_, uint64_t(dropPolicy == Pipeline::DP_DROP_OLDEST ? numberElements : expectedSize));
+			OCEAN_EXPECT_EQUAL(validation, statistic.popped_, uint64_t(expectedSize));
+			OCEAN_EXPECT_EQUAL(validation, statistic.dropped_, uint64_t(numberElements - expectedSize));
+			OCEAN_EXPECT_EQUAL(validation, statistic.size_, size_t(0));
+		}
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	{
+		// stale elements are dropped when taken from the queue
+
+		Pipeline pipeline;
+
+		const Pipeline::SharedQueue<unsigned int> queue = pipeline.addQueue<unsigned int>("Stale", 4, Pipeline::DP_BLOCK, 0.01);
+
+		OCEAN_EXPECT_TRUE(validation, queue->push(1u));
+		OCEAN_EXPECT_TRUE(validation, queue->push(2u));
+
+		Thread::sleep(50u);
+
+		OCEAN_EXPECT_TRUE(validation, queue->push(3u));
+
+		unsigned int element = 0u;
+
+		OCEAN_EXPECT_TRUE(validation, queue->pop(element));
+		OCEAN_EXPECT_EQUAL(validation, element, 3u);
+
+		OCEAN_EXPECT_EQUAL(validation, queue->statistic().droppedStale_, uint64_t(2));
+	}
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
+bool TestPipeline::testStages(const double testDuration)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Test stages:";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		const size_t capacity = size_t(RandomI::random(randomGenerator, 1u, 4u));
+		const unsigned int numberElements = RandomI::random(randomGenerator, 1u, 200u);
+
+		Pipeline pipeline;
+
+		const Pipeline::SharedQueue<unsigned int> inputQueue = pipeline.addQueue<unsigned int>("Input", capacity);
+		const Pipeline::SharedQueue<uint64_t> intermediateQueue = pipeline.addQueue<uint64_t>("Intermediate", capacity);
+
+		OCEAN_EXPECT_TRUE(validation, pipeline.addStage<unsigned int, uint64_t>("Square", inputQueue, intermediateQueue, [](unsigned int& input, uint64_t& output, Worker* /*worker*/)
+		{
+			output = uint64_t(input) * uint64_t(input);
+
+			// odd elements are filtered
+			return input % 2u == 0u;
+		}));
+
+		Lock resultLock;
+		std::vector<uint64_t> results;
+
+		OCEAN_EXPECT_TRUE(validation, pipeline.addSink<uint64_t>("Sink", intermediateQueue, [&resultLock, &results](uint64_t& input, Worker* /*worker*/)
+		{
+			const ScopedLock scopedLock(resultLock);
+
+			results.emplace_back(input);
+		}));
+
+		OCEAN_EXPECT_TRUE(validation, pipeline.start());
+		OCEAN_EXPECT_TRUE(validation, pipeline.isRunning());
+
+		// the producer is faster than the stages, the bounded queues must apply backpressure without losing any element
+
+		for (unsigned int n = 0u; n < numberElements; ++n)
+		{
+			OCEAN_EXPECT_TRUE(validation, inputQueue->push((unsigned int)(n)));
+
+			OCEAN_EXPECT_LESS_EQUAL(validation, inputQueue->size(), capacity);
+		}
+
+		const unsigned int expectedResults = (numberElements + 1u) / 2u;
+
+		const Timestamp waitTimestamp(true);
+
+		while (!waitTimestamp.hasTimePassed(5.0))
+		{
+			// the first stage must have processed all elements, also the filtered elements
+
+			if (pipeline.stageStatistics().front().executions_ == uint64_t(numberElements))
+			{
+				const ScopedLock scopedLock(resultLock);
+
+				if (results.size() >= expectedResults)
+				{
+					break;
+				}
+			}
+
+			Thread::sleep(1u);
+		}
+
+		pipeline.stop();
+
+		OCEAN_EXPECT_FALSE(validation, pipeline.isRunning());
+
+		OCEAN_EXPECT_EQUAL(validation, results.size(), size_t(expectedResults));
+
+		for (size_t n = 0; n < results.size(); ++n)
+		{
+			OCEAN_EXPECT_EQUAL(validation, results[n], uint64_t(n * 2) * uint64_t(n * 2));
+		}
+
+		const Pipeline::QueueStatistics queueStatistics = pipeline.queueStatistics();
+		const Pipeline::StageStatistics stageStatistics = pipeline.stageStatistics();
+
+		OCEAN_EXPECT_EQUAL(validation, queueStatistics.size(), size_t(2));
+		OCEAN_EXPECT_EQUAL(validation, stageStatistics.size(), size_t(2));
+
+		if (queueStatistics.size() == 2 && stageStatistics.size() == 2)
+		{
+			OCEAN_EXPECT_EQUAL(validation, queueStatistics[0].pushed_, uint64_t(numberElements));
+			OCEAN_EXPECT_EQUAL(validation, queueStatistics[0].dropped_, uint64_t(0));
+			OCEAN_EXPECT_EQUAL(validation, queueStatistics[1].pushed_, uint64_t(expectedResults));
+
+			OCEAN_EXPECT_GREATER_EQUAL(validation, queueStatistics[0].maximalLatency_, queueStatistics[0].averageLatency_);
+
+			OCEAN_EXPECT_EQUAL(validation, stageStatistics[0].executions_, uint64_t(numberElements));
+			OCEAN_EXPECT_EQUAL(validation, stageStatistics[1].executions_, uint64_t(expectedResults));
+		}
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
+bool TestPipeline::testStop(const double testDuration)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Test stop:";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		Pipeline pipeline;
+
+		const Pipeline::SharedQueue<unsigned int> inputQueue = pipeline.addQueue<unsigned int>("Input", 1);
+		const Pipeline::SharedQueue<unsigned int> outputQueue = pipeline.addQueue<unsigned int>("Output", 1);
+
+		// the output queue is never consumed, so that the stage will be blocked
+
+		OCEAN_EXPECT_TRUE(validation, pipeline.addStage<unsigned int, unsigned int>("Forward", inputQueue, outputQueue, [](unsigned int& input, unsigned int& output, Worker* /*worker*/)
+		{
+			output = input;
+			return true;
+		}));
+
+		OCEAN_EXPECT_TRUE(validation, pipeline.start());
+
+		for (unsigned int n = 0u; n < 2u; ++n)
+		{
+			OCEAN_EXPECT_TRUE(validation, inputQueue->push((unsigned int)(n)));
+		}
+
+		Thread::sleep(RandomI::random(randomGenerator, 5u));
+
+		// stopping the pipeline must not dead-lock, although the stage is blocked
+
+		const Timestamp stopTimestamp(true);
+
+		pipeline.stop();
+
+		OCEAN_EXPECT_FALSE(validation, stopTimestamp.hasTimePassed(1.0));
+
+		OCEAN_EXPECT_TRUE(validation, inputQueue->isClosed());
+		OCEAN_EXPECT_FALSE(validation, inputQueue->push(2u));
+
+		OCEAN_EXPECT_EQUAL(validation, outputQueue->size(), size_t(1));
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
+}
+
+}
+
+}
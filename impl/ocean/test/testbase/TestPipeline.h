@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#ifndef META_OCEAN_TEST_TESTBASE_TEST_PIPELINE_H
+#define META_OCEAN_TEST_TESTBASE_TEST_PIPELINE_H
+
+#include "ocean/test/testbase/TestBase.h"
+
+#include "ocean/test/TestSelector.h"
+
+namespace Ocean
+{
+
+namespace Test
+{
+
+namespace TestBase
+{
+
+/**
+ * This class implements a test for the dataflow pipeline.
+ * @ingroup testbase
+ */
+class OCEAN_TEST_BASE_EXPORT TestPipeline
+{
+	public:
+
+		/**
+		 * Tests the pipeline.
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @param selector The selector to filter individual test cases
+		 * @return True, if succeeded
+		 */
+		static bool test(const double testDuration, const TestSelector& selector = TestSelector());
+
+		/**
+		 * Tests the drop policies and the statistics of individual queues.
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @return True, if succeeded
+		 */
+		static bool testQueue(const double testDuration);
+
+		/**
+		 * Tests a pipeline with several stages and backpressure.
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @return True, if succeeded
+		 */
+		static bool testStages(const double testDuration);
+
+		/**
+		 * Tests stopping a pipeline while a producer is blocked.
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @return True, if succeeded
+		 */
+		static bool testStop(const double testDuration);
+};
+
+}
+
+}
+
+}
+
+#endif // META_OCEAN_TEST_TESTBASE_TEST_PIPELINE_H
@@ -0,0 +1,180 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "ocean/test/testbase/TestPluginManager.h"
+
+#include "ocean/base/PluginManager.h"
+#include "ocean/base/RandomGenerator.h"
+
+#include "ocean/test/TestResult.h"
+#include "ocean/test/Validation.h"
+
+namespace Ocean
+{
+
+namespace Test
+{
+
+namespace TestBase
+{
+
+bool TestPluginManager::test(const TestSelector& selector)
+{
+	TestResult testResult("PluginManager test");
+	Log::info() << " ";
+
+	if (selector.shouldRun("translatecapabilities"))
+	{
+		testResult = testTranslateCapabilities();
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
+	if (selector.shouldRun("hascapability"))
+	{
+		testResult = testHasCapability();
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
+	Log::info() << testResult;
+
+	return testResult.succeeded();
+}
+
+#ifdef OCEAN_USE_GTEST
+
+TEST(TestPluginManager, TranslateCapabilities)
+{
+	EXPECT_TRUE(TestPluginManager::testTranslateCapabilities());
+}
+
+TEST(TestPluginManager, HasCapability)
+{
+	EXPECT_TRUE(TestPluginManager::testHasCapability());
+}
+
+#endif // OCEAN_USE_GTEST
+
+bool TestPluginManager::testTranslateCapabilities()
+{
+	Log::info() << "Translate capabilities test:";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	// empty strings, and strings without any actual capability
+
+	OCEAN_EXPECT_TRUE(validation, PluginManager::translateCapabilities("").empty());
+	OCEAN_EXPECT_TRUE(validation, PluginManager::translateCapabilities(" ").empty());
+	OCEAN_EXPECT_TRUE(validation, PluginManager::translateCapabilities(";").empty());
+	OCEAN_EXPECT_TRUE(validation, PluginManager::translateCapabilities(";;;").empty());
+	OCEAN_EXPECT_TRUE(validation, PluginManager::translateCapabilities(" ; \t;\r\n; ").empty());
+
+	// a single capability
+
+	OCEAN_EXPECT_TRUE(validation, PluginManager::translateCapabilities("jpg") == Strings({"jpg"}));
+	OCEAN_EXPECT_TRUE(validation, PluginManager::translateCapabilities("jpg;") == Strings({"jpg"}));
+	OCEAN_EXPECT_TRUE(validation, PluginManager::translateCapabilities(";jpg") == Strings({"jpg"}));
+	OCEAN_EXPECT_TRUE(validation, PluginManager::translateCapabilities("  jpg\t ") == Strings({"jpg"}));
+
+	// several capabilities, with empty entries and surrounding whitespace
+
+	OCEAN_EXPECT_TRUE(validation, PluginManager::translateCapabilities("jpg;png;bmp") == Strings({"jpg", "png", "bmp"}));
+	OCEAN_EXPECT_TRUE(validation, PluginManager::translateCapabilities(" jpg ;; png;\tbmp\r\n;") == Strings({"jpg", "png", "bmp"}));
+
+	// whitespace inside a capability is kept, other separators than semicolons do not separate capabilities
+
+	OCEAN_EXPECT_TRUE(validation, PluginManager::translateCapabilities("Live Video; Image Sequence") == Strings({"live video", "image sequence"}));
+	OCEAN_EXPECT_TRUE(validation, PluginManager::translateCapabilities("jpg,png") == Strings({"jpg,png"}));
+	OCEAN_EXPECT_TRUE(validation, PluginManager::translateCapabilities("jpg png") == Strings({"jpg png"}));
+
+	// capabilities are converted to lower case
+
+	OCEAN_EXPECT_TRUE(validation, PluginManager::translateCapabilities("JPG;Png;bMp") == Strings({"jpg", "png", "bmp"}));
+
+	// duplicates are skipped, also if they differ in case, the order of the first occurrence is kept
+
+	OCEAN_EXPECT_TRUE(validation, PluginManager::translateCapabilities("jpg;jpg") == Strings({"jpg"}));
+	OCEAN_EXPECT_TRUE(validation, PluginManager::translateCapabilities("png;JPG;jpg; Jpg ;png;bmp") == Strings({"png", "jpg", "bmp"}));
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
+bool TestPluginManager::testHasCapability()
+{
+	Log::info() << "Has capability test:";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	{
+		// a plugin without any capability
+
+		const PluginManager::Plugin plugin("plugin.so", "Plugin", "Description", PluginManager::TYPE_MEDIA, PluginManager::PRIORITY_MEDIUM, PluginManager::PluginTypeSet(), "", "");
+
+		OCEAN_EXPECT_FALSE(validation, plugin.hasCapability(""));
+		OCEAN_EXPECT_FALSE(validation, plugin.hasCapability("jpg"));
+	}
+
+	{
+		// a plugin with capabilities translated from an empty string
+
+		const PluginManager::Plugin plugin("plugin.so", "Plugin", "Description", PluginManager::TYPE_MEDIA, PluginManager::PRIORITY_MEDIUM, PluginManager::PluginTypeSet(), "", "", PluginManager::translateCapabilities(" ; "));
+
+		OCEAN_EXPECT_FALSE(validation, plugin.hasCapability(""));
+		OCEAN_EXPECT_FALSE(validation, plugin.hasCapability(" "));
+		OCEAN_EXPECT_FALSE(validation, plugin.hasCapability(";"));
+	}
+
+	{
+		// a plugin with capabilities translated from a string with duplicates, whitespace, and different cases
+
+		const PluginManager::Plugin plugin("plugin.so", "Plugin", "Description", PluginManager::TYPE_MEDIA, PluginManager::PRIORITY_MEDIUM, PluginManager::PluginTypeSet(), "", "", PluginManager::translateCapabilities("JPG; png ;jpg;Live Video"));
+
+		OCEAN_EXPECT_TRUE(validation, plugin.hasCapability("jpg"));
+		OCEAN_EXPECT_TRUE(validation, plugin.hasCapability("JPG"));
+		OCEAN_EXPECT_TRUE(validation, plugin.hasCapability("Jpg"));
+		OCEAN_EXPECT_TRUE(validation, plugin.hasCapability("png"));
+		OCEAN_EXPECT_TRUE(validation, plugin.hasCapability("PNG"));
+		OCEAN_EXPECT_TRUE(validation, plugin.hasCapability("live video"));
+		OCEAN_EXPECT_TRUE(validation, plugin.hasCapability("LIVE VIDEO"));
+
+		OCEAN_EXPECT_FALSE(validation, plugin.hasCapability(""));
+		OCEAN_EXPECT_FALSE(validation, plugin.hasCapability("jp"));
+		OCEAN_EXPECT_FALSE(validation, plugin.hasCapability("jpeg"));
+		OCEAN_EXPECT_FALSE(validation, plugin.hasCapability("jpg;png"));
+		OCEAN_EXPECT_FALSE(validation, plugin.hasCapability("live"));
+		OCEAN_EXPECT_FALSE(validation, plugin.hasCapability("bmp"));
+	}
+
+	{
+		// capabilities which are provided directly are compared case-insensitively as well
+
+		const PluginManager::Plugin plugin("plugin.so", "Plugin", "Description", PluginManager::TYPE_DEVICE, PluginManager::PRIORITY_LOW, PluginManager::PluginTypeSet(), "", "", Strings({"ARKit 6DOF World Tracker", "arkit 6dof world tracker"}));
+
+		OCEAN_EXPECT_TRUE(validation, plugin.hasCapability("ARKit 6DOF World Tracker"));
+		OCEAN_EXPECT_TRUE(validation, plugin.hasCapability("arkit 6dof world tracker"));
+		OCEAN_EXPECT_FALSE(validation, plugin.hasCapability("ARKit 6DOF"));
+	}
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
+}
+
+}
+
+}
@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#ifndef META_OCEAN_TEST_TESTBASE_TEST_PLUGIN_MANAGER_H
+#define META_OCEAN_TEST_TESTBASE_TEST_PLUGIN_MANAGER_H
+
+#include "ocean/test/testbase/TestBase.h"
+#include "ocean/test/TestSelector.h"
+
+namespace Ocean
+{
+
+namespace Test
+{
+
+namespace TestBase
+{
+
+/**
+ * This class implements plugin manager tests.
+ * @ingroup testbase
+ */
+class OCEAN_TEST_BASE_EXPORT TestPluginManager
+{
+	public:
+
+		/**
+		 * Tests all plugin manager functions.
+		 * @param selector The test selector
+		 * @return True, if succeeded
+		 */
+		static bool test(const TestSelector& selector);
+
+		/**
+		 * Tests the translation of capability strings, including empty and malformed strings, duplicates, and different cases.
+		 * @return True, if succeeded
+		 */
+		static bool testTranslateCapabilities();
+
+		/**
+		 * Tests whether plugins report their declared capabilities case-insensitively.
+		 * @return True, if succeeded
+		 */
+		static bool testHasCapability();
+};
+
+}
+
+}
+
+}
+
+#endif // META_OCEAN_TEST_TESTBASE_TEST_PLUGIN_MANAGER_H
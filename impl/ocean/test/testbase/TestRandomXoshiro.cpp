@@ -0,0 +1,289 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "ocean/test/testbase/TestRandomXoshiro.h"
+
+#include "ocean/base/RandomI.h"
+#include "ocean/base/RandomXoshiro.h"
+#include "ocean/base/Timestamp.h"
+
+#include "ocean/test/TestResult.h"
+#include "ocean/test/Validation.h"
+
+namespace Ocean
+{
+
+namespace Test
+{
+
+namespace TestBase
+{
+
+bool TestRandomXoshiro::test(const double testDuration, const TestSelector& selector)
+{
+	TestResult testResult("RandomXoshiro tests");
+
+	Log::info() << " ";
+
+	if (selector.shouldRun("reproducibility"))
+	{
+		testResult = testReproducibility(testDuration);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
+	if (selector.shouldRun("bulk"))
+	{
+		testResult = testBulk(testDuration);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
+	if (selector.shouldRun("distribution"))
+	{
+		testResult = testDistribution(testDuration);
+
+		Log::info() << " ";
+	}
+
+	Log::info() << testResult;
+
+	return testResult.succeeded();
+}
+
+#ifdef OCEAN_USE_GTEST
+
+TEST(TestRandomXoshiro, Reproducibility)
+{
+	EXPECT_TRUE(TestRandomXoshiro::testReproducibility(GTEST_TEST_DURATION));
+}
+
+TEST(TestRandomXoshiro, Bulk)
+{
+	EXPECT_TRUE(TestRandomXoshiro::testBulk(GTEST_TEST_DURATION));
+}
+
+TEST(TestRandomXoshiro, Distribution)
+{
+	EXPECT_TRUE(TestRandomXoshiro::testDistribution(GTEST_TEST_DURATION));
+}
+
+#endif // OCEAN_USE_GTEST
+
+bool TestRandomXoshiro::testReproducibility(const double testDuration)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Test reproducibility:";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		const uint64_t seed = RandomI::random64(randomGenerator);
+		const uint64_t stream = uint64_t(RandomI::random(randomGenerator, 1000u));
+
+		RandomXoshiro generatorA(seed, stream);
+		RandomXoshiro generatorB(seed, stream);
+		RandomXoshiro generatorC(seed, stream + 1ull);
+
+		unsigned int identicalValues = 0u;
+
+		for (unsigned int n = 0u; n < 1000u; ++n)
+		{
+			const uint32_t valueA = generatorA.rand();
+			const uint32_t valueB = generatorB.rand();
+			const uint32_t valueC = generatorC.rand();
+
+			OCEAN_EXPECT_EQUAL(validation, valueA, valueB);
+
+			if (valueA == valueC)
+			{
+				++identicalValues;
+			}
+		}
+
+		// different streams are independent, so that almost all values are different
+		OCEAN_EXPECT_LESS(validation, identicalValues, 5u);
+
+		// generators created from random generators with the same seed are identical
+
+		const unsigned int parentSeed = RandomI::random32(randomGenerator);
+
+		RandomGenerator parentGeneratorA(parentSeed);
+		RandomGenerator parentGeneratorB(parentSeed);
+
+		RandomXoshiro childGeneratorA(parentGeneratorA);
+		RandomXoshiro childGeneratorB(parentGeneratorB);
+
+		for (unsigned int n = 0u; n < 100u; ++n)
+		{
+			OCEAN_EXPECT_EQUAL(validation, childGeneratorA.rand(), childGeneratorB.rand());
+		}
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
+bool TestRandomXoshiro::testBulk(const double testDuration)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Test bulk functions:";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		const uint64_t seed = RandomI::random64(randomGenerator);
+
+		const size_t size = size_t(RandomI::random(randomGenerator, 1u, 1000u));
+
+		// the generator used for bulk functions starts at a random position within the internal buffer
+		const unsigned int skip = RandomI::random(randomGenerator, 7u);
+
+		RandomXoshiro individualGenerator(seed);
+		RandomXoshiro bulkGenerator(seed);
+
+		for (unsigned int n = 0u; n < skip; ++n)
+		{
+			individualGenerator.rand();
+			bulkGenerator.rand();
+		}
+
+		const unsigned int mode = RandomI::random(randomGenerator, 2u);
+
+		if (mode == 0u)
+		{
+			std::vector<uint32_t> values(size);
+			bulkGenerator.fill(values.data(), values.size());
+
+			for (const uint32_t value : values)
+			{
+				OCEAN_EXPECT_EQUAL(validation, value, individualGenerator.rand());
+			}
+		}
+		else if (mode == 1u)
+		{
+			const uint32_t maxValue = RandomI::random(randomGenerator, 1u) == 0u ? RandomI::random(randomGenerator, 100u) : RandomI::random32(randomGenerator);
+
+			Indices32 indices(size);
+			bulkGenerator.fillIndices(indices.data(), indices.size(), maxValue);
+
+			for (const Index32 index : indices)
+			{
+				OCEAN_EXPECT_EQUAL(validation, index, individualGenerator.random(maxValue));
+			}
+		}
+		else
+		{
+			std::vector<float> values(size);
+			bulkGenerator.fillFloats(values.data(), values.size());
+
+			for (const float value : values)
+			{
+				OCEAN_EXPECT_EQUAL(validation, value, individualGenerator.randomFloat());
+			}
+		}
+
+		// both generators continue with the same random number
+
+		OCEAN_EXPECT_EQUAL(validation, bulkGenerator.rand(), individualGenerator.rand());
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
+bool TestRandomXoshiro::testDistribution(const double testDuration)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Test distribution:";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	RandomXoshiro generator(randomGenerator);
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		constexpr unsigned int bins = 16u;
+		constexpr size_t size = 16000;
+
+		const uint32_t maxValue = RandomI::random(randomGenerator, 1u, 1000u);
+
+		Indices32 indices(size);
+		generator.fillIndices(indices.data(), indices.size(), maxValue);
+
+		std::vector<unsigned int> histogram(bins, 0u);
+
+		for (const Index32 index : indices)
+		{
+			OCEAN_EXPECT_LESS_EQUAL(validation, index, maxValue);
+
+			histogram[(uint64_t(index) * uint64_t(bins)) / (uint64_t(maxValue) + 1ull)]++;
+		}
+
+		const float lower = float(RandomI::random(randomGenerator, -100, 100));
+		const float upper = lower + float(RandomI::random(randomGenerator, 1u, 100u));
+
+		std::vector<float> values(size);
+		generator.fillFloats(values.data(), values.size(), lower, upper);
+
+		std::vector<unsigned int> floatHistogram(bins, 0u);
+
+		for (const float value : values)
+		{
+			OCEAN_EXPECT_GREATER_EQUAL(validation, value, lower);
+			OCEAN_EXPECT_LESS_EQUAL(validation, value, upper);
+
+			floatHistogram[std::min(bins - 1u, (unsigned int)((value - lower) / (upper - lower) * float(bins)))]++;
+		}
+
+		const unsigned int expected = (unsigned int)(size) / bins;
+
+		for (unsigned int n = 0u; n < bins; ++n)
+		{
+			// the bins of small ranges are not identical in size
+			if (maxValue >= 100u)
+			{
+				OCEAN_EXPECT_INSIDE_RANGE(validation, expected * 3u / 4u, histogram[n], expected * 5u / 4u);
+			}
+
+			OCEAN_EXPECT_INSIDE_RANGE(validation, expected * 3u / 4u, floatHistogram[n], expected * 5u / 4u);
+		}
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
+}
+
+}
+
+}
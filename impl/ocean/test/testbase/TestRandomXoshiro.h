@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#ifndef META_OCEAN_TEST_TESTBASE_TEST_RANDOM_XOSHIRO_H
+#define META_OCEAN_TEST_TESTBASE_TEST_RANDOM_XOSHIRO_H
+
+#include "ocean/test/testbase/TestBase.h"
+
+#include "ocean/test/TestSelector.h"
+
+namespace Ocean
+{
+
+namespace Test
+{
+
+namespace TestBase
+{
+
+/**
+ * This class implements a test for the xoshiro random number generator.
+ * @ingroup testbase
+ */
+class OCEAN_TEST_BASE_EXPORT TestRandomXoshiro
+{
+	public:
+
+		/**
+		 * Tests the xoshiro random number generator.
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @param selector The selector to filter individual test cases
+		 * @return True, if succeeded
+		 */
+		static bool test(const double testDuration, const TestSelector& selector = TestSelector());
+
+		/**
+		 * Tests that generators with the same seed and stream create the same random numbers while different streams create different random numbers.
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @return True, if succeeded
+		 */
+		static bool testReproducibility(const double testDuration);
+
+		/**
+		 * Tests that the bulk functions create the same random numbers as the individual functions.
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @return True, if succeeded
+		 */
+		static bool testBulk(const double testDuration);
+
+		/**
+		 * Tests the ranges and the distribution of random indices and random floats.
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @return True, if succeeded
+		 */
+		static bool testDistribution(const double testDuration);
+};
+
+}
+
+}
+
+}
+
+#endif // META_OCEAN_TEST_TESTBASE_TEST_RANDOM_XOSHIRO_H
@@ -15,6 +15,8 @@
 #include "ocean/test/TestSelector.h"
 #include "ocean/test/Validation.h"
 
+#include <thread>
+
 namespace Ocean
 {
 
@@ -67,6 +69,15 @@ bool TestRingMap::test(const double testDuration, const TestSelector& selector)
 		Log::info() << " ";
 	}
 
+	if (selector.shouldRun("concurrent"))
+	{
+		testResult = testConcurrent(testDuration);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
 	Log::info() << testResult;
 
 	return testResult.succeeded();
@@ -94,6 +105,11 @@ TEST(TestRingMap, Refresh)
 	EXPECT_TRUE(TestRingMap::testRefresh(GTEST_TEST_DURATION));
 }
 
+TEST(TestRingMap, Concurrent)
+{
+	EXPECT_TRUE(TestRingMap::testConcurrent(GTEST_TEST_DURATION));
+}
+
 #endif // OCEAN_USE_GTEST
 
 bool TestRingMap::testInsert(const double testDuration)
@@ -455,6 +471,135 @@ bool TestRingMap::testRefresh(const double testDuration)
 	return validation.succeeded();
 }
 
+bool TestRingMap::testConcurrent(const double testDuration)
+{
+	Log::info() << "Concurrent test:";
+
+	using ConcurrentStringMap = ConcurrentRingMapT<unsigned int, std::string, 8u>;
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		{
+			// single-threaded behavior
+
+			const unsigned int capacity = RandomI::random(randomGenerator, 20u, 2000u);
+
+			ConcurrentStringMap stringMap(capacity);
+
+			OCEAN_EXPECT_GREATER_EQUAL(validation, stringMap.capacity(), size_t(capacity));
+			OCEAN_EXPECT_LESS(validation, stringMap.capacity(), size_t(capacity + ConcurrentStringMap::numberShards()));
+
+			OCEAN_EXPECT_TRUE(validation, stringMap.isEmpty());
+
+			for (unsigned int n = 0u; n < capacity; ++n)
+			{
+				OCEAN_EXPECT_TRUE(validation, stringMap.insertElement(n, String::toAString(n), false));
+				OCEAN_EXPECT_FALSE(validation, stringMap.insertElement(n, std::string(), false));
+
+				std::string element;
+				OCEAN_EXPECT_TRUE(validation, stringMap.element(n, element));
+				OCEAN_EXPECT_EQUAL(validation, element, String::toAString(n));
+			}
+
+			OCEAN_EXPECT_LESS_EQUAL(validation, stringMap.size(), stringMap.capacity());
+			OCEAN_EXPECT_EQUAL(validation, stringMap.elements().size(), stringMap.size());
+
+			// the most recent element of each shard always exists
+
+			for (unsigned int n = capacity; n < capacity * 2u; ++n)
+			{
+				OCEAN_EXPECT_TRUE(validation, stringMap.insertElement(n, String::toAString(n), false));
+				OCEAN_EXPECT_TRUE(validation, stringMap.hasElement(n));
+				OCEAN_EXPECT_LESS_EQUAL(validation, stringMap.size(), stringMap.capacity());
+			}
+
+			const unsigned int key = RandomI::random(randomGenerator, capacity, capacity * 2u - 1u);
+
+			std::string element;
+			OCEAN_EXPECT_TRUE(validation, stringMap.checkoutElement(key, element));
+			OCEAN_EXPECT_EQUAL(validation, element, String::toAString(key));
+			OCEAN_EXPECT_FALSE(validation, stringMap.hasElement(key));
+			OCEAN_EXPECT_FALSE(validation, stringMap.checkoutElement(key, element));
+
+			stringMap.clear();
+
+			OCEAN_EXPECT_TRUE(validation, stringMap.isEmpty());
+			OCEAN_EXPECT_FALSE(validation, stringMap.element(key, element));
+		}
+
+		{
+			// several threads inserting, reading, and checking out elements concurrently
+
+			const unsigned int numberThreads = RandomI::random(randomGenerator, 2u, 8u);
+			const unsigned int capacity = RandomI::random(randomGenerator, 20u, 500u);
+
+			ConcurrentStringMap stringMap(capacity);
+
+			std::atomic<unsigned int> invalidElements(0u);
+
+			std::vector<std::thread> threads;
+			threads.reserve(numberThreads);
+
+			for (unsigned int nThread = 0u; nThread < numberThreads; ++nThread)
+			{
+				const unsigned int seed = RandomI::random32(randomGenerator);
+
+				threads.emplace_back([&stringMap, &invalidElements, seed, capacity]()
+				{
+					RandomGenerator threadRandomGenerator(seed);
+
+					for (unsigned int n = 0u; n < 2000u; ++n)
+					{
+						const unsigned int key = RandomI::random(threadRandomGenerator, capacity * 2u);
+
+						std::string element;
+
+						switch (RandomI::random(threadRandomGenerator, 2u))
+						{
+							case 0u:
+								stringMap.insertElement(key, String::toAString(key), RandomI::boolean(threadRandomGenerator));
+								break;
+
+							case 1u:
+								if (stringMap.element(key, element) && element != String::toAString(key))
+								{
+									++invalidElements;
+								}
+								break;
+
+							default:
+								if (stringMap.checkoutElement(key, element) && element != String::toAString(key))
+								{
+									++invalidElements;
+								}
+								break;
+						}
+					}
+				});
+			}
+
+			for (std::thread& thread : threads)
+			{
+				thread.join();
+			}
+
+			OCEAN_EXPECT_EQUAL(validation, invalidElements.load(), 0u);
+			OCEAN_EXPECT_LESS_EQUAL(validation, stringMap.size(), stringMap.capacity());
+			OCEAN_EXPECT_EQUAL(validation, stringMap.elements().size(), stringMap.size());
+		}
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
 }
 
 }
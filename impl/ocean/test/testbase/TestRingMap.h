@@ -11,6 +11,7 @@
 #include "ocean/test/testbase/TestBase.h"
 #include "ocean/test/TestSelector.h"
 
+#include "ocean/base/ConcurrentRingMap.h"
 #include "ocean/base/RingMap.h"
 
 namespace Ocean
@@ -72,6 +73,13 @@ class OCEAN_TEST_BASE_EXPORT TestRingMap
 		 * @return True, if succeeded
 		 */
 		static bool testRefresh(const double testDuration);
+
+		/**
+		 * Tests the concurrent ring map.
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @return True, if succeeded
+		 */
+		static bool testConcurrent(const double testDuration);
 };
 
 }
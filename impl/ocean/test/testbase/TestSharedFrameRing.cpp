@@ -0,0 +1,517 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "ocean/test/testbase/TestSharedFrameRing.h"
+
+#include "ocean/base/RandomI.h"
+#include "ocean/base/SharedFrameRing.h"
+#include "ocean/base/String.h"
+#include "ocean/base/Thread.h"
+#include "ocean/base/Timestamp.h"
+
+#include "ocean/test/TestResult.h"
+#include "ocean/test/Validation.h"
+
+#include <thread>
+
+namespace Ocean
+{
+
+namespace Test
+{
+
+namespace TestBase
+{
+
+bool TestSharedFrameRing::test(const double testDuration, const TestSelector& selector)
+{
+	TestResult testResult("SharedFrameRing tests");
+
+	Log::info() << " ";
+
+	if (selector.shouldRun("producerconsumerordering"))
+	{
+		testResult = testProducerConsumerOrdering(testDuration);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
+	if (selector.shouldRun("fullring"))
+	{
+		testResult = testFullRing(testDuration);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
+	if (selector.shouldRun("slowconsumer"))
+	{
+		testResult = testSlowConsumer(testDuration);
+
+		Log::info() << " ";
+	}
+
+	Log::info() << testResult;
+
+	return testResult.succeeded();
+}
+
+#ifdef OCEAN_USE_GTEST
+
+TEST(TestSharedFrameRing, ProducerConsumerOrdering)
+{
+	EXPECT_TRUE(TestSharedFrameRing::testProducerConsumerOrdering(GTEST_TEST_DURATION));
+}
+
+TEST(TestSharedFrameRing, FullRing)
+{
+	EXPECT_TRUE(TestSharedFrameRing::testFullRing(GTEST_TEST_DURATION));
+}
+
+TEST(TestSharedFrameRing, SlowConsumer)
+{
+	EXPECT_TRUE(TestSharedFrameRing::testSlowConsumer(GTEST_TEST_DURATION));
+}
+
+#endif // OCEAN_USE_GTEST
+
+bool TestSharedFrameRing::testProducerConsumerOrdering(const double testDuration)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Test producer consumer ordering:";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		const FrameType frameType(RandomI::random(randomGenerator, 1u, 128u), RandomI::random(randomGenerator, 1u, 128u), RandomI::boolean(randomGenerator) ? FrameType::FORMAT_Y8 : FrameType::FORMAT_RGB24, FrameType::ORIGIN_UPPER_LEFT);
+
+		const unsigned int numberSlots = RandomI::random(randomGenerator, 2u, 8u);
+		const unsigned int numberFrames = RandomI::random(randomGenerator, 1u, 200u);
+
+		const std::wstring name = uniqueName(randomGenerator);
+
+		SharedFrameRing producerRing(name, numberSlots, SharedFrameRing::slotSize(frameType));
+		OCEAN_EXPECT_TRUE(validation, producerRing.isValid() && producerRing.isProducer());
+
+		SharedFrameRing consumerRing(name);
+		OCEAN_EXPECT_TRUE(validation, consumerRing.isValid() && !consumerRing.isProducer());
+
+		if (!producerRing.isValid() || !consumerRing.isValid())
+		{
+			continue;
+		}
+
+		OCEAN_EXPECT_EQUAL(validation, consumerRing.numberSlots(), numberSlots);
+		OCEAN_EXPECT_EQUAL(validation, consumerRing.slotCapacity(), producerRing.slotCapacity());
+
+		std::atomic<unsigned int> failedPublications(0u);
+
+		std::thread producerThread([&]()
+		{
+			for (uint64_t publication = 1ull; publication <= uint64_t(numberFrames); ++publication)
+			{
+				const Frame frame = createFrame(frameType, publication);
+
+				while (!producerRing.publishFrame(frame))
+				{
+					// with two slots, the latest frame and the frame held by the consumer can occupy the entire ring
+
+					++failedPublications;
+					std::this_thread::yield();
+				}
+			}
+		});
+
+		uint64_t publication = 0ull;
+		uint64_t previousPublication = 0ull;
+
+		const Timestamp consumerTimestamp(true);
+
+		while (publication < uint64_t(numberFrames) && !consumerTimestamp.hasTimePassed(10.0))
+		{
+			Frame frame;
+			SharedFrameRing::SlotIndex slotIndex = SharedFrameRing::invalidSlotIndex_;
+
+			if (consumerRing.acquireLatestFrame(frame, slotIndex, publication, 0.1))
+			{
+				// the publications must strictly increase, frames may be skipped
+
+				OCEAN_EXPECT_GREATER(validation, publication, previousPublication);
+				previousPublication = publication;
+
+				OCEAN_EXPECT_TRUE(validation, frame.isValid() && frame.frameType() == frameType);
+				OCEAN_EXPECT_TRUE(validation, frame.isReadOnly());
+				OCEAN_EXPECT_TRUE(validation, isFrameValid(frame, publication));
+
+				OCEAN_EXPECT_TRUE(validation, consumerRing.releaseFrame(slotIndex));
+			}
+		}
+
+		producerThread.join();
+
+		if (numberSlots >= 3u)
+		{
+			// the consumer holds at most one frame, so that the producer always finds a free slot
+
+			OCEAN_EXPECT_EQUAL(validation, failedPublications.load(), 0u);
+		}
+
+		OCEAN_EXPECT_EQUAL(validation, publication, uint64_t(numberFrames));
+
+		// there is no newer frame
+
+		Frame frame;
+		SharedFrameRing::SlotIndex slotIndex = SharedFrameRing::invalidSlotIndex_;
+		OCEAN_EXPECT_FALSE(validation, consumerRing.acquireLatestFrame(frame, slotIndex, publication, 0.0));
+
+		OCEAN_EXPECT_TRUE(validation, consumerRing.isProducerAlive());
+
+		producerRing = SharedFrameRing();
+
+		OCEAN_EXPECT_FALSE(validation, consumerRing.isProducerAlive());
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
+bool TestSharedFrameRing::testFullRing(const double testDuration)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Test full ring:";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		const FrameType frameType(RandomI::random(randomGenerator, 1u, 64u), RandomI::random(randomGenerator, 1u, 64u), FrameType::FORMAT_Y8, FrameType::ORIGIN_UPPER_LEFT);
+
+		const unsigned int numberSlots = RandomI::random(randomGenerator, 2u, 8u);
+
+		const std::wstring name = uniqueName(randomGenerator);
+
+		SharedFrameRing producerRing(name, numberSlots, SharedFrameRing::slotSize(frameType));
+		SharedFrameRing consumerRing(name);
+
+		if (!producerRing.isValid() || !consumerRing.isValid())
+		{
+			OCEAN_SET_FAILED(validation);
+			continue;
+		}
+
+		uint64_t nextPublication = 1ull;
+
+		// without consumer references, the producer overwrites the oldest frames and never drops a frame
+
+		const unsigned int unreferencedFrames = RandomI::random(randomGenerator, numberSlots, numberSlots * 3u);
+
+		for (unsigned int n = 0u; n < unreferencedFrames; ++n)
+		{
+			OCEAN_EXPECT_TRUE(validation, producerRing.publishFrame(createFrame(frameType, nextPublication++)));
+		}
+
+		uint64_t publication = 0ull;
+
+		// the consumer receives the latest frame only
+
+		std::vector<std::pair<SharedFrameRing::SlotIndex, uint64_t>> heldFrames;
+		Frames heldFrameWrappers;
+
+		{
+			Frame frame;
+			SharedFrameRing::SlotIndex slotIndex = SharedFrameRing::invalidSlotIndex_;
+
+			OCEAN_EXPECT_TRUE(validation, consumerRing.acquireLatestFrame(frame, slotIndex, publication, 0.0));
+			OCEAN_EXPECT_EQUAL(validation, publication, uint64_t(nextPublication - 1ull));
+
+			heldFrames.emplace_back(slotIndex, publication);
+			heldFrameWrappers.emplace_back(std::move(frame));
+		}
+
+		// the consumer holds numberSlots - 1 frames, the last free slot receives one more frame
+
+		while (heldFrames.size() < size_t(numberSlots - 1u))
+		{
+			OCEAN_EXPECT_TRUE(validation, producerRing.publishFrame(createFrame(frameType, nextPublication++)));
+
+			Frame frame;
+			SharedFrameRing::SlotIndex slotIndex = SharedFrameRing::invalidSlotIndex_;
+
+			OCEAN_EXPECT_TRUE(validation, consumerRing.acquireLatestFrame(frame, slotIndex, publication, 0.0));
+
+			heldFrames.emplace_back(slotIndex, publication);
+			heldFrameWrappers.emplace_back(std::move(frame));
+		}
+
+		OCEAN_EXPECT_TRUE(validation, producerRing.publishFrame(createFrame(frameType, nextPublication++)));
+
+		const uint64_t latestPublication = nextPublication - 1ull;
+
+		// now, all slots are referenced or hold the latest frame, the producer must drop new frames
+
+		const unsigned int droppedFrames = RandomI::random(randomGenerator, 1u, 5u);
+
+		for (unsigned int n = 0u; n < droppedFrames; ++n)
+		{
+			OCEAN_EXPECT_FALSE(validation, producerRing.publishFrame(createFrame(frameType, nextPublication)));
+
+			SharedFrameRing::SlotIndex slotIndex = SharedFrameRing::invalidSlotIndex_;
+			OCEAN_EXPECT_FALSE(validation, producerRing.beginFrame(frameType, slotIndex).isValid());
+			OCEAN_EXPECT_EQUAL(validation, slotIndex, SharedFrameRing::invalidSlotIndex_);
+		}
+
+		// the held frames are untouched
+
+		for (size_t n = 0; n < heldFrames.size(); ++n)
+		{
+			OCEAN_EXPECT_TRUE(validation, isFrameValid(heldFrameWrappers[n], heldFrames[n].second));
+		}
+
+		// the consumer still receives the latest frame which has been published before the ring was full
+
+		{
+			Frame frame;
+			SharedFrameRing::SlotIndex slotIndex = SharedFrameRing::invalidSlotIndex_;
+
+			OCEAN_EXPECT_TRUE(validation, consumerRing.acquireLatestFrame(frame, slotIndex, publication, 0.0));
+			OCEAN_EXPECT_EQUAL(validation, publication, latestPublication);
+			OCEAN_EXPECT_TRUE(validation, isFrameValid(frame, publication));
+
+			OCEAN_EXPECT_TRUE(validation, consumerRing.releaseFrame(slotIndex));
+		}
+
+		// once the consumer releases one frame, the producer overwrites this slot
+
+		const size_t releaseIndex = size_t(RandomI::random(randomGenerator, (unsigned int)(heldFrames.size()) - 1u));
+
+		OCEAN_EXPECT_TRUE(validation, consumerRing.releaseFrame(heldFrames[releaseIndex].first));
+		const SharedFrameRing::SlotIndex releasedSlotIndex = heldFrames[releaseIndex].first;
+
+		heldFrames.erase(heldFrames.begin() + releaseIndex);
+		heldFrameWrappers.erase(heldFrameWrappers.begin() + releaseIndex);
+
+		SharedFrameRing::SlotIndex slotIndex = SharedFrameRing::invalidSlotIndex_;
+		Frame slotFrame = producerRing.beginFrame(frameType, slotIndex);
+
+		OCEAN_EXPECT_TRUE(validation, slotFrame.isValid());
+		OCEAN_EXPECT_EQUAL(validation, slotIndex, releasedSlotIndex);
+
+		if (slotFrame.isValid())
+		{
+			OCEAN_EXPECT_TRUE(validation, slotFrame.copy(0, 0, createFrame(frameType, nextPublication)));
+			OCEAN_EXPECT_TRUE(validation, producerRing.publishFrame(slotIndex, Timestamp(double(nextPublication))));
+		}
+
+		for (size_t n = 0; n < heldFrames.size(); ++n)
+		{
+			OCEAN_EXPECT_TRUE(validation, isFrameValid(heldFrameWrappers[n], heldFrames[n].second));
+			OCEAN_EXPECT_TRUE(validation, consumerRing.releaseFrame(heldFrames[n].first));
+		}
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
+bool TestSharedFrameRing::testSlowConsumer(const double testDuration)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Test slow consumer:";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		const FrameType frameType(RandomI::random(randomGenerator, 1u, 128u), RandomI::random(randomGenerator, 1u, 128u), FrameType::FORMAT_Y8, FrameType::ORIGIN_UPPER_LEFT);
+
+		// the consumer holds up to two frames at the same time, one further slot holds the latest frame
+
+		const unsigned int numberSlots = RandomI::random(randomGenerator, 4u, 8u);
+
+		const std::wstring name = uniqueName(randomGenerator);
+
+		SharedFrameRing producerRing(name, numberSlots, SharedFrameRing::slotSize(frameType));
+		SharedFrameRing consumerRing(name);
+
+		if (!producerRing.isValid() || !consumerRing.isValid())
+		{
+			OCEAN_SET_FAILED(validation);
+			continue;
+		}
+
+		std::atomic<bool> stopProducer(false);
+		std::atomic<unsigned int> failedPublications(0u);
+		std::atomic<uint64_t> publishedFrames(0ull);
+
+		std::thread producerThread([&]()
+		{
+			uint64_t nextPublication = 1ull;
+
+			while (!stopProducer)
+			{
+				if (producerRing.publishFrame(createFrame(frameType, nextPublication)))
+				{
+					publishedFrames = nextPublication++;
+				}
+				else
+				{
+					++failedPublications;
+				}
+
+				std::this_thread::yield();
+			}
+		});
+
+		uint64_t publication = 0ull;
+		uint64_t previousPublication = 0ull;
+
+		unsigned int receivedFrames = 0u;
+
+		Frame previousFrame;
+		SharedFrameRing::SlotIndex previousSlotIndex = SharedFrameRing::invalidSlotIndex_;
+		uint64_t previousFramePublication = 0ull;
+
+		const unsigned int iterations = RandomI::random(randomGenerator, 5u, 20u);
+
+		for (unsigned int n = 0u; n < iterations; ++n)
+		{
+			Frame frame;
+			SharedFrameRing::SlotIndex slotIndex = SharedFrameRing::invalidSlotIndex_;
+
+			if (!consumerRing.acquireLatestFrame(frame, slotIndex, publication, 1.0))
+			{
+				OCEAN_SET_FAILED(validation);
+				break;
+			}
+
+			++receivedFrames;
+
+			OCEAN_EXPECT_GREATER(validation, publication, previousPublication);
+			previousPublication = publication;
+
+			// while the consumer is busy, the producer continues publishing frames
+
+			Thread::sleep(RandomI::random(randomGenerator, 1u, 5u));
+
+			// the frame has not been overwritten while being referenced, neither the previous frame which is still held
+
+			OCEAN_EXPECT_TRUE(validation, isFrameValid(frame, publication));
+
+			if (previousFrame.isValid())
+			{
+				OCEAN_EXPECT_TRUE(validation, isFrameValid(previousFrame, previousFramePublication));
+				OCEAN_EXPECT_TRUE(validation, consumerRing.releaseFrame(previousSlotIndex));
+			}
+
+			previousFrame = std::move(frame);
+			previousSlotIndex = slotIndex;
+			previousFramePublication = publication;
+		}
+
+		if (previousFrame.isValid())
+		{
+			previousFrame.release();
+			OCEAN_EXPECT_TRUE(validation, consumerRing.releaseFrame(previousSlotIndex));
+		}
+
+		stopProducer = true;
+		producerThread.join();
+
+		// the consumer holds at most two frames, the producer always finds a free slot
+
+		OCEAN_EXPECT_EQUAL(validation, failedPublications.load(), 0u);
+
+		// the producer has been faster than the consumer, so that the consumer has skipped frames
+
+		OCEAN_EXPECT_LESS_EQUAL(validation, uint64_t(receivedFrames), publishedFrames.load());
+		OCEAN_EXPECT_LESS_EQUAL(validation, previousPublication, publishedFrames.load());
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
+std::wstring TestSharedFrameRing::uniqueName(RandomGenerator& randomGenerator)
+{
+	return L"OceanTestSharedFrameRing_" + String::toWString(RandomI::random64(randomGenerator)) + L"_" + String::toWString(uint64_t(Timestamp(true).nanoseconds()));
+}
+
+Frame TestSharedFrameRing::createFrame(const FrameType& frameType, const uint64_t publication)
+{
+	ocean_assert(frameType.isValid() && frameType.dataType() == FrameType::DT_UNSIGNED_INTEGER_8);
+	ocean_assert(publication >= 1ull);
+
+	Frame frame(frameType);
+	frame.setTimestamp(Timestamp(double(publication)));
+
+	// each row starts with a different value, so that rows of different frames cannot be confused
+
+	for (unsigned int y = 0u; y < frame.height(); ++y)
+	{
+		uint8_t* row = frame.row<uint8_t>(y);
+
+		for (unsigned int n = 0u; n < frame.planeWidthElements(0u); ++n)
+		{
+			row[n] = uint8_t((publication * 131ull + uint64_t(y) * 7ull + uint64_t(n)) & 0xFFull);
+		}
+	}
+
+	return frame;
+}
+
+bool TestSharedFrameRing::isFrameValid(const Frame& frame, const uint64_t publication)
+{
+	ocean_assert(frame.isValid());
+
+	if (frame.timestamp() != Timestamp(double(publication)))
+	{
+		return false;
+	}
+
+	for (unsigned int y = 0u; y < frame.height(); ++y)
+	{
+		const uint8_t* row = frame.constrow<uint8_t>(y);
+
+		for (unsigned int n = 0u; n < frame.planeWidthElements(0u); ++n)
+		{
+			if (row[n] != uint8_t((publication * 131ull + uint64_t(y) * 7ull + uint64_t(n)) & 0xFFull))
+			{
+				return false;
+			}
+		}
+	}
+
+	return true;
+}
+
+}
+
+}
+
+}
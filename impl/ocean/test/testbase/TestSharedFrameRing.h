@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#ifndef META_OCEAN_TEST_TESTBASE_TEST_SHARED_FRAME_RING_H
+#define META_OCEAN_TEST_TESTBASE_TEST_SHARED_FRAME_RING_H
+
+#include "ocean/test/testbase/TestBase.h"
+
+#include "ocean/base/Frame.h"
+#include "ocean/base/RandomGenerator.h"
+
+#include "ocean/test/TestSelector.h"
+
+namespace Ocean
+{
+
+namespace Test
+{
+
+namespace TestBase
+{
+
+/**
+ * This class implements tests for the shared frame ring.
+ * @ingroup testbase
+ */
+class OCEAN_TEST_BASE_EXPORT TestSharedFrameRing
+{
+	public:
+
+		/**
+		 * Tests the shared frame ring.
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @param selector The selector to filter individual test cases
+		 * @return True, if succeeded
+		 */
+		static bool test(const double testDuration, const TestSelector& selector = TestSelector());
+
+		/**
+		 * Tests that a consumer receives the frames of a concurrent producer in the order of publication and with intact content.
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @return True, if succeeded
+		 */
+		static bool testProducerConsumerOrdering(const double testDuration);
+
+		/**
+		 * Tests that the producer overwrites the oldest unreferenced frame and drops new frames once all slots are referenced by consumers.
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @return True, if succeeded
+		 */
+		static bool testFullRing(const double testDuration);
+
+		/**
+		 * Tests a consumer which holds frames longer than the producer needs for a new frame, the consumer skips frames while the held frames stay intact.
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @return True, if succeeded
+		 */
+		static bool testSlowConsumer(const double testDuration);
+
+	protected:
+
+		/**
+		 * Returns a unique name for a new ring.
+		 * @param randomGenerator The random generator to be used
+		 * @return The name of the ring
+		 */
+		static std::wstring uniqueName(RandomGenerator& randomGenerator);
+
+		/**
+		 * Creates a frame with content and timestamp both determined by a publication number.
+		 * @param frameType The frame type of the frame, must be valid
+		 * @param publication The publication number of the frame, with range [1, infinity)
+		 * @return The resulting frame
+		 */
+		static Frame createFrame(const FrameType& frameType, const uint64_t publication);
+
+		/**
+		 * Returns whether the content and the timestamp of a frame match a publication number.
+		 * @param frame The frame to check, must be valid
+		 * @param publication The publication number of the frame, with range [1, infinity)
+		 * @return True, if so
+		 */
+		static bool isFrameValid(const Frame& frame, const uint64_t publication);
+};
+
+}
+
+}
+
+}
+
+#endif // META_OCEAN_TEST_TESTBASE_TEST_SHARED_FRAME_RING_H
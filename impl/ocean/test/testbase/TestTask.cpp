@@ -0,0 +1,304 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "ocean/test/testbase/TestTask.h"
+
+#include "ocean/base/HighPerformanceTimer.h"
+#include "ocean/base/RandomI.h"
+#include "ocean/base/Thread.h"
+#include "ocean/base/Timestamp.h"
+
+#include "ocean/test/TestResult.h"
+#include "ocean/test/Validation.h"
+
+#include <stdexcept>
+
+namespace Ocean
+{
+
+namespace Test
+{
+
+namespace TestBase
+{
+
+bool TestTask::test(const double testDuration, const TestSelector& selector)
+{
+	TestResult testResult("Task tests");
+
+	Log::info() << " ";
+
+	if (selector.shouldRun("run"))
+	{
+		testResult = testRun(testDuration);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
+	if (selector.shouldRun("whenall"))
+	{
+		testResult = testWhenAll(testDuration);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
+	if (selector.shouldRun("exception"))
+	{
+		testResult = testException(testDuration);
+
+		Log::info() << " ";
+	}
+
+	Log::info() << testResult;
+
+	return testResult.succeeded();
+}
+
+#ifdef OCEAN_USE_GTEST
+
+TEST(TestTask, Run)
+{
+	EXPECT_TRUE(TestTask::testRun(GTEST_TEST_DURATION));
+}
+
+TEST(TestTask, WhenAll)
+{
+	EXPECT_TRUE(TestTask::testWhenAll(GTEST_TEST_DURATION));
+}
+
+TEST(TestTask, Exception)
+{
+	EXPECT_TRUE(TestTask::testException(GTEST_TEST_DURATION));
+}
+
+#endif // OCEAN_USE_GTEST
+
+bool TestTask::testRun(const double testDuration)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Test run:";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		const unsigned int start = RandomI::random(randomGenerator, 1000u);
+		const unsigned int size = RandomI::random(randomGenerator, 0u, 20u);
+
+		uint64_t expectedSum = 0ull;
+
+		for (unsigned int n = 0u; n < size; ++n)
+		{
+			expectedSum += uint64_t(start + n);
+		}
+
+		{
+			// a task is lazy and does not start before it is needed
+
+			Task<uint64_t> task = sum(start, size);
+
+			OCEAN_EXPECT_TRUE(validation, task.isValid());
+			OCEAN_EXPECT_FALSE(validation, task.isReady());
+
+			OCEAN_EXPECT_EQUAL(validation, task.get(), expectedSum);
+			OCEAN_EXPECT_TRUE(validation, task.isReady());
+		}
+
+		{
+			// a started task can be disposed before it has finished
+
+			Task<uint64_t> task = sum(start, size);
+			task.start();
+		}
+
+		{
+			// tasks without result
+
+			std::atomic<unsigned int> counter = 0u;
+
+			Task<void> task = TaskExecutor::run([&counter, size]()
+			{
+				counter += size;
+			});
+
+			task.get();
+
+			OCEAN_EXPECT_EQUAL(validation, counter.load(), size);
+		}
+
+		{
+			// a moved task keeps its state
+
+			Task<unsigned int> task = TaskExecutor::run([size]() { return size; });
+			task.start();
+
+			Task<unsigned int> movedTask(std::move(task));
+
+			OCEAN_EXPECT_FALSE(validation, task.isValid());
+			OCEAN_EXPECT_EQUAL(validation, movedTask.get(), size);
+		}
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
+bool TestTask::testWhenAll(const double testDuration)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Test when all:";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		const unsigned int numberTasks = RandomI::random(randomGenerator, 1u, 20u);
+
+		std::vector<Task<unsigned int>> tasks;
+		std::vector<unsigned int> expectedResults;
+
+		for (unsigned int n = 0u; n < numberTasks; ++n)
+		{
+			expectedResults.emplace_back(RandomI::random(randomGenerator, 5u));
+			tasks.emplace_back(sleep(expectedResults.back()));
+		}
+
+		const std::vector<unsigned int> results = TaskExecutor::whenAll(std::move(tasks)).get();
+
+		OCEAN_EXPECT_TRUE(validation, results == expectedResults);
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	{
+		// blocking tasks are executed concurrently
+
+		constexpr unsigned int numberTasks = 4u;
+		constexpr unsigned int milliseconds = 50u;
+
+		std::vector<Task<unsigned int>> tasks;
+
+		for (unsigned int n = 0u; n < numberTasks; ++n)
+		{
+			tasks.emplace_back(sleep(milliseconds));
+		}
+
+		const HighPerformanceTimer timer;
+
+		const std::vector<unsigned int> results = TaskExecutor::whenAll(std::move(tasks)).get();
+
+		const double seconds = timer.seconds();
+
+		OCEAN_EXPECT_EQUAL(validation, results.size(), size_t(numberTasks));
+
+		// the executor has at least two threads, so that the tasks need clearly less than the sequential time
+
+		OCEAN_EXPECT_LESS(validation, seconds, double(numberTasks * milliseconds) * 0.75 / 1000.0);
+	}
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
+bool TestTask::testException(const double testDuration)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Test exception:";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		OCEAN_EXPECT_TRUE(validation, catchException().get());
+
+		bool exceptionThrown = false;
+
+		try
+		{
+			throwException().get();
+		}
+		catch (const std::runtime_error&)
+		{
+			exceptionThrown = true;
+		}
+
+		OCEAN_EXPECT_TRUE(validation, exceptionThrown);
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
+Task<uint64_t> TestTask::sum(const unsigned int start, const unsigned int size)
+{
+	uint64_t result = 0ull;
+
+	for (unsigned int n = 0u; n < size; ++n)
+	{
+		const unsigned int value = start + n;
+
+		result += co_await TaskExecutor::run([value]() { return uint64_t(value); });
+	}
+
+	co_return result;
+}
+
+Task<unsigned int> TestTask::sleep(const unsigned int milliseconds)
+{
+	co_await TaskExecutor::get().schedule();
+
+	Thread::sleep(milliseconds);
+
+	co_return milliseconds;
+}
+
+Task<unsigned int> TestTask::throwException()
+{
+	co_await TaskExecutor::get().schedule();
+
+	throw std::runtime_error("Test exception");
+}
+
+Task<bool> TestTask::catchException()
+{
+	try
+	{
+		co_await throwException();
+	}
+	catch (const std::runtime_error&)
+	{
+		co_return true;
+	}
+
+	co_return false;
+}
+
+}
+
+}
+
+}
@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#ifndef META_OCEAN_TEST_TESTBASE_TEST_TASK_H
+#define META_OCEAN_TEST_TESTBASE_TEST_TASK_H
+
+#include "ocean/test/testbase/TestBase.h"
+
+#include "ocean/base/Task.h"
+
+#include "ocean/test/TestSelector.h"
+
+namespace Ocean
+{
+
+namespace Test
+{
+
+namespace TestBase
+{
+
+/**
+ * This class implements a test for coroutine tasks.
+ * @ingroup testbase
+ */
+class OCEAN_TEST_BASE_EXPORT TestTask
+{
+	public:
+
+		/**
+		 * Tests the coroutine tasks.
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @param selector The selector to filter individual test cases
+		 * @return True, if succeeded
+		 */
+		static bool test(const double testDuration, const TestSelector& selector = TestSelector());
+
+		/**
+		 * Tests executing and chaining tasks.
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @return True, if succeeded
+		 */
+		static bool testRun(const double testDuration);
+
+		/**
+		 * Tests executing several blocking tasks concurrently.
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @return True, if succeeded
+		 */
+		static bool testWhenAll(const double testDuration);
+
+		/**
+		 * Tests propagating exceptions from tasks to the awaiting coroutine.
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @return True, if succeeded
+		 */
+		static bool testException(const double testDuration);
+
+	protected:
+
+		/**
+		 * Computes the sum of a range of values, each value is determined in a separate task.
+		 * @param start The first value
+		 * @param size The number of values, with range [0, infinity)
+		 * @return The task providing the sum
+		 */
+		static Task<uint64_t> sum(const unsigned int start, const unsigned int size);
+
+		/**
+		 * Sleeps in the thread pool of the executor for a while.
+		 * @param milliseconds The number of milliseconds to sleep, with range [0, infinity)
+		 * @return The task providing the number of milliseconds
+		 */
+		static Task<unsigned int> sleep(const unsigned int milliseconds);
+
+		/**
+		 * Throws an exception in the thread pool of the executor.
+		 * @return The task which never provides a result
+		 */
+		static Task<unsigned int> throwException();
+
+		/**
+		 * Awaits a task throwing an exception and catches the exception.
+		 * @return The task providing whether the exception has been caught
+		 */
+		static Task<bool> catchException();
+};
+
+}
+
+}
+
+}
+
+#endif // META_OCEAN_TEST_TESTBASE_TEST_TASK_H
@@ -0,0 +1,257 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "ocean/test/testbase/TestTimerWheel.h"
+
+#include "ocean/base/RandomI.h"
+#include "ocean/base/Scheduler.h"
+#include "ocean/base/Timestamp.h"
+#include "ocean/base/TimerWheel.h"
+
+#include "ocean/test/TestResult.h"
+#include "ocean/test/Validation.h"
+
+#include <map>
+
+namespace Ocean
+{
+
+namespace Test
+{
+
+namespace TestBase
+{
+
+bool TestTimerWheel::test(const double testDuration, const TestSelector& selector)
+{
+	TestResult testResult("TimerWheel tests");
+
+	Log::info() << " ";
+
+	if (selector.shouldRun("wheel"))
+	{
+		testResult = testWheel(testDuration);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
+	if (selector.shouldRun("schedulertimers"))
+	{
+		testResult = testSchedulerTimers();
+
+		Log::info() << " ";
+	}
+
+	Log::info() << testResult;
+
+	return testResult.succeeded();
+}
+
+#ifdef OCEAN_USE_GTEST
+
+TEST(TestTimerWheel, Wheel)
+{
+	EXPECT_TRUE(TestTimerWheel::testWheel(GTEST_TEST_DURATION));
+}
+
+TEST(TestTimerWheel, SchedulerTimers)
+{
+	EXPECT_TRUE(TestTimerWheel::testSchedulerTimers());
+}
+
+#endif // OCEAN_USE_GTEST
+
+bool TestTimerWheel::testWheel(const double testDuration)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Test wheel:";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	using Tick = TimerWheel::Tick;
+	using TimerId = TimerWheel::TimerId;
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		const Tick startTick = Tick(RandomI::random64(randomGenerator) % (Tick(1) << 32u));
+
+		TimerWheel timerWheel(startTick);
+
+		std::map<TimerId, Tick> groundTruthMap;
+		Tick currentTick = startTick;
+
+		for (unsigned int iteration = 0u; iteration < 1000u; ++iteration)
+		{
+			const unsigned int operation = RandomI::random(randomGenerator, 3u);
+
+			if (operation == 0u)
+			{
+				const TimerId timerId = TimerId(RandomI::random(randomGenerator, 49u));
+
+				// the delays cover all levels of the wheel and the overflow list
+
+				Tick dueTick = currentTick;
+
+				switch (RandomI::random(randomGenerator, 3u))
+				{
+					case 0u:
+						dueTick += Tick(RandomI::random(randomGenerator, 2u));
+						break;
+
+					case 1u:
+						dueTick += Tick(RandomI::random(randomGenerator, 200u));
+						break;
+
+					case 2u:
+						dueTick += Tick(RandomI::random(randomGenerator, 300000u));
+						break;
+
+					default:
+						dueTick += RandomI::random64(randomGenerator) % (Tick(1) << 26u);
+						break;
+				}
+
+				timerWheel.insert(timerId, dueTick);
+				groundTruthMap[timerId] = std::max(dueTick, currentTick + Tick(1));
+			}
+			else if (operation == 1u)
+			{
+				const TimerId timerId = TimerId(RandomI::random(randomGenerator, 49u));
+
+				const bool removed = timerWheel.remove(timerId);
+				const bool groundTruthRemoved = groundTruthMap.erase(timerId) != 0;
+
+				OCEAN_EXPECT_EQUAL(validation, removed, groundTruthRemoved);
+			}
+			else
+			{
+				Tick nextDueTick = TimerWheel::invalidTick();
+
+				for (const std::pair<const TimerId, Tick>& timer : groundTruthMap)
+				{
+					nextDueTick = std::min(nextDueTick, timer.second);
+				}
+
+				OCEAN_EXPECT_EQUAL(validation, timerWheel.nextDueTick(), nextDueTick);
+
+				Tick tick = currentTick;
+
+				if (nextDueTick != TimerWheel::invalidTick() && RandomI::random(randomGenerator, 1u) == 0u)
+				{
+					tick = nextDueTick;
+				}
+				else if (RandomI::random(randomGenerator, 1u) == 0u)
+				{
+					tick += Tick(RandomI::random(randomGenerator, 1000u));
+				}
+				else
+				{
+					tick += RandomI::random64(randomGenerator) % (Tick(1) << 27u);
+				}
+
+				TimerWheel::TimerIds dueTimerIds;
+				timerWheel.advance(tick, dueTimerIds);
+
+				size_t numberDueTimers = 0;
+
+				for (std::map<TimerId, Tick>::iterator iTimer = groundTruthMap.begin(); iTimer != groundTruthMap.end(); /* noop */)
+				{
+					if (iTimer->second <= tick)
+					{
+						OCEAN_EXPECT_TRUE(validation, std::find(dueTimerIds.cbegin(), dueTimerIds.cend(), iTimer->first) != dueTimerIds.cend());
+
+						iTimer = groundTruthMap.erase(iTimer);
+						++numberDueTimers;
+					}
+					else
+					{
+						++iTimer;
+					}
+				}
+
+				OCEAN_EXPECT_EQUAL(validation, dueTimerIds.size(), numberDueTimers);
+
+				currentTick = std::max(currentTick, tick);
+
+				OCEAN_EXPECT_EQUAL(validation, timerWheel.currentTick(), currentTick);
+			}
+
+			OCEAN_EXPECT_EQUAL(validation, timerWheel.size(), groundTruthMap.size());
+		}
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
+bool TestTimerWheel::testSchedulerTimers()
+{
+	Log::info() << "Test scheduler timers:";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	TimerCounter oneShotCounter;
+	TimerCounter periodicCounter;
+	TimerCounter wakeUpCounter;
+
+	const Scheduler::Callback oneShotCallback = Scheduler::Callback::create(oneShotCounter, &TimerCounter::onTimer);
+	const Scheduler::Callback periodicCallback = Scheduler::Callback::create(periodicCounter, &TimerCounter::onTimer);
+	const Scheduler::Callback wakeUpCallback = Scheduler::Callback::create(wakeUpCounter, &TimerCounter::onTimer);
+
+	Scheduler& scheduler = Scheduler::get();
+
+	const Scheduler::TimerId oneShotTimerId = scheduler.registerTimer(oneShotCallback, 0.0, 0.01);
+	const Scheduler::TimerId periodicTimerId = scheduler.registerTimer(periodicCallback, 0.02);
+	const Scheduler::TimerId wakeUpTimerId = scheduler.registerTimer(wakeUpCallback, 3600.0);
+
+	OCEAN_EXPECT_NOT_EQUAL(validation, oneShotTimerId, Scheduler::invalidTimerId());
+	OCEAN_EXPECT_NOT_EQUAL(validation, periodicTimerId, Scheduler::invalidTimerId());
+	OCEAN_EXPECT_NOT_EQUAL(validation, wakeUpTimerId, Scheduler::invalidTimerId());
+
+	OCEAN_EXPECT_TRUE(validation, scheduler.wakeUpTimer(wakeUpTimerId));
+
+	Thread::sleep(500u);
+
+	OCEAN_EXPECT_TRUE(validation, scheduler.unregisterTimer(periodicTimerId));
+	OCEAN_EXPECT_TRUE(validation, scheduler.unregisterTimer(wakeUpTimerId));
+
+	// the one-shot timer is unregistered automatically
+	OCEAN_EXPECT_FALSE(validation, scheduler.unregisterTimer(oneShotTimerId));
+
+	OCEAN_EXPECT_EQUAL(validation, oneShotCounter.counter_.load(), 1u);
+	OCEAN_EXPECT_EQUAL(validation, wakeUpCounter.counter_.load(), 1u);
+
+	// the periodic timer must have been invoked about 25 times, we are generous as the system may be busy
+
+	OCEAN_EXPECT_GREATER_EQUAL(validation, periodicCounter.counter_.load(), 5u);
+	OCEAN_EXPECT_LESS_EQUAL(validation, periodicCounter.counter_.load(), 26u);
+
+	const unsigned int periodicCounterAfterUnregister = periodicCounter.counter_.load();
+
+	Thread::sleep(100u);
+
+	OCEAN_EXPECT_EQUAL(validation, periodicCounter.counter_.load(), periodicCounterAfterUnregister);
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
+}
+
+}
+
+}
@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#ifndef META_OCEAN_TEST_TESTBASE_TEST_TIMER_WHEEL_H
+#define META_OCEAN_TEST_TESTBASE_TEST_TIMER_WHEEL_H
+
+#include "ocean/test/testbase/TestBase.h"
+
+#include "ocean/test/TestSelector.h"
+
+#include <atomic>
+
+namespace Ocean
+{
+
+namespace Test
+{
+
+namespace TestBase
+{
+
+/**
+ * This class implements a test for the timer wheel and the timers of the scheduler.
+ * @ingroup testbase
+ */
+class OCEAN_TEST_BASE_EXPORT TestTimerWheel
+{
+	protected:
+
+		/**
+		 * This class implements a simple counter for invoked timers.
+		 */
+		class TimerCounter
+		{
+			public:
+
+				/**
+				 * Event function for the timer.
+				 */
+				inline void onTimer();
+
+			public:
+
+				/// The number of invocations.
+				std::atomic<unsigned int> counter_ = 0u;
+		};
+
+	public:
+
+		/**
+		 * Tests the timer wheel.
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @param selector The selector to filter individual test cases
+		 * @return True, if succeeded
+		 */
+		static bool test(const double testDuration, const TestSelector& selector = TestSelector());
+
+		/**
+		 * Tests inserting, removing, and advancing timers against a brute-force ground truth.
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @return True, if succeeded
+		 */
+		static bool testWheel(const double testDuration);
+
+		/**
+		 * Tests one-shot and periodic timers of the scheduler.
+		 * @return True, if succeeded
+		 */
+		static bool testSchedulerTimers();
+};
+
+inline void TestTimerWheel::TimerCounter::onTimer()
+{
+	++counter_;
+}
+
+}
+
+}
+
+}
+
+#endif // META_OCEAN_TEST_TESTBASE_TEST_TIMER_WHEEL_H
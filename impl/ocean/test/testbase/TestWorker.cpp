@@ -9,13 +9,17 @@
 
 #include "ocean/base/HighPerformanceTimer.h"
 #include "ocean/base/Processor.h"
+#include "ocean/base/RandomI.h"
 #include "ocean/base/Timestamp.h"
 
+#include "ocean/system/Performance.h"
+
 #include "ocean/test/TestResult.h"
 #include "ocean/test/TestSelector.h"
 #include "ocean/test/Validation.h"
 
 #include <cmath>
+#include <thread>
 
 namespace Ocean
 {
@@ -102,6 +106,51 @@ bool TestWorker::test(const double testDuration, const TestSelector& selector)
 	{
 		testResult = testSeparableAndAbortableFunction(worker);
 
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
+	if (selector.shouldRun("workstealing"))
+	{
+		testResult = testWorkStealing(testDuration);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
+	if (selector.shouldRun("nestedexecution"))
+	{
+		testResult = testNestedExecution(testDuration);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
+	if (selector.shouldRun("corebudget"))
+	{
+		testResult = testCoreBudget(testDuration);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
+	if (selector.shouldRun("adaptiveload"))
+	{
+		testResult = testAdaptiveLoad(testDuration);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
+	if (selector.shouldRun("thermaladaptation"))
+	{
+		testResult = testThermalAdaptation(testDuration);
+
 		Log::info() << " ";
 	}
 
@@ -177,6 +226,31 @@ TEST(TestWorker, SeparableAndAbortableFunction)
 	}
 }
 
+TEST(TestWorker, WorkStealing)
+{
+	EXPECT_TRUE(TestWorker::testWorkStealing(GTEST_TEST_DURATION));
+}
+
+TEST(TestWorker, NestedExecution)
+{
+	EXPECT_TRUE(TestWorker::testNestedExecution(GTEST_TEST_DURATION));
+}
+
+TEST(TestWorker, CoreBudget)
+{
+	EXPECT_TRUE(TestWorker::testCoreBudget(GTEST_TEST_DURATION));
+}
+
+TEST(TestWorker, AdaptiveLoad)
+{
+	EXPECT_TRUE(TestWorker::testAdaptiveLoad(GTEST_TEST_DURATION));
+}
+
+TEST(TestWorker, ThermalAdaptation)
+{
+	EXPECT_TRUE(TestWorker::testThermalAdaptation(GTEST_TEST_DURATION));
+}
+
 #endif // OCEAN_USE_GTEST
 
 bool TestWorker::testConstructor()
@@ -482,6 +556,405 @@ bool TestWorker::testSeparableAndAbortableFunction(Worker& worker)
 	return validation.succeeded();
 }
 
+bool TestWorker::testWorkStealing(const double testDuration)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Test work-stealing execution mode:";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		const unsigned int numberThreads = RandomI::random(randomGenerator, 2u, 16u);
+
+		Worker worker(numberThreads, Worker::TYPE_CUSTOM);
+
+		OCEAN_EXPECT_EQUAL(validation, worker.executionMode(), Worker::EM_STATIC_BLOCKS);
+
+		worker.setExecutionMode(Worker::EM_WORK_STEALING, RandomI::random(randomGenerator, 1u, 8u));
+
+		OCEAN_EXPECT_EQUAL(validation, worker.executionMode(), Worker::EM_WORK_STEALING);
+
+		for (unsigned int iteration = 0u; iteration < 10u; ++iteration)
+		{
+			const unsigned int first = RandomI::random(randomGenerator, 0u, 100u);
+			const unsigned int size = RandomI::random(randomGenerator, 1u, 10000u);
+			const unsigned int minimalIterations = RandomI::random(randomGenerator, 1u, 100u);
+
+			Indices32 counters(first + size, 0u);
+			Indices32 threadIndices(first + size, (unsigned int)(-1));
+
+			worker.executeFunction(Worker::Function::createStatic(&TestWorker::staticWorkerFunctionCount, counters.data(), threadIndices.data(), 0u, 0u, 0u), first, size, 2u, 3u, minimalIterations, 4u);
+
+			for (unsigned int n = 0u; n < first; ++n)
+			{
+				OCEAN_EXPECT_EQUAL(validation, counters[n], 0u);
+			}
+
+			for (unsigned int n = first; n < first + size; ++n)
+			{
+				OCEAN_EXPECT_EQUAL(validation, counters[n], 1u);
+				OCEAN_EXPECT_LESS(validation, threadIndices[n], numberThreads);
+			}
+		}
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
+bool TestWorker::testNestedExecution(const double testDuration)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Test nested execution:";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	OCEAN_EXPECT_EQUAL(validation, Worker::currentWorker(), (Worker*)(nullptr));
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		const unsigned int numberThreads = RandomI::random(randomGenerator, 2u, 8u);
+
+		Worker worker(numberThreads, Worker::TYPE_CUSTOM);
+
+		if (RandomI::boolean(randomGenerator))
+		{
+			worker.setExecutionMode(Worker::EM_WORK_STEALING);
+		}
+
+		const unsigned int width = RandomI::random(randomGenerator, 1u, 500u);
+		const unsigned int height = RandomI::random(randomGenerator, 1u, 100u);
+
+		Indices32 counters(width * height, 0u);
+		Indices32 threadIndices(width * height, (unsigned int)(-1));
+
+		worker.executeFunction(Worker::Function::createStatic(&TestWorker::staticWorkerFunctionNested, &worker, counters.data(), threadIndices.data(), width, 0u, 0u), 0u, height);
+
+		for (size_t n = 0; n < counters.size(); ++n)
+		{
+			OCEAN_EXPECT_EQUAL(validation, counters[n], 1u);
+			OCEAN_EXPECT_LESS(validation, threadIndices[n], numberThreads);
+		}
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
+bool TestWorker::testCoreBudget(const double testDuration)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Test core budget:";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	const unsigned int cores = Worker::idleCores();
+
+	Log::info() << "Shared budget of " << cores << " cores";
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		const unsigned int numberCallers = RandomI::random(randomGenerator, 2u, 4u);
+		const unsigned int numberThreads = RandomI::random(randomGenerator, 2u, 8u);
+		const bool workStealing = RandomI::boolean(randomGenerator);
+
+		const unsigned int size = RandomI::random(randomGenerator, 1u, 20000u);
+
+		std::atomic<unsigned int> busyThreads(0u);
+		std::atomic<unsigned int> maximalBusyThreads(0u);
+
+		std::vector<Indices32> counters(numberCallers, Indices32(size, 0u));
+
+		std::vector<std::thread> callers;
+		callers.reserve(numberCallers);
+
+		for (unsigned int nCaller = 0u; nCaller < numberCallers; ++nCaller)
+		{
+			callers.emplace_back([&, nCaller]()
+			{
+				// each caller uses an own worker, all workers together must not use more threads than cores
+
+				Worker worker(numberThreads, Worker::TYPE_CUSTOM);
+				worker.setUseCoreBudget(true);
+
+				if (workStealing)
+				{
+					worker.setExecutionMode(Worker::EM_WORK_STEALING);
+				}
+
+				worker.executeFunction(Worker::Function::createStatic(&TestWorker::staticWorkerFunctionBusy, counters[nCaller].data(), &busyThreads, &maximalBusyThreads, 0u, 0u), 0u, size, 3u, 4u, 10u);
+			});
+		}
+
+		for (std::thread& caller : callers)
+		{
+			caller.join();
+		}
+
+		OCEAN_EXPECT_LESS_EQUAL(validation, maximalBusyThreads.load(), cores);
+
+		for (const Indices32& callerCounters : counters)
+		{
+			for (const Index32 counter : callerCounters)
+			{
+				OCEAN_EXPECT_EQUAL(validation, counter, 1u);
+			}
+		}
+
+		// all cores must have been returned to the budget
+
+		OCEAN_EXPECT_EQUAL(validation, Worker::idleCores(), cores);
+
+		{
+			// a worker not taking part in the budget uses its threads without reserving any core
+
+			Worker worker(numberThreads, Worker::TYPE_CUSTOM);
+
+			OCEAN_EXPECT_FALSE(validation, worker.usesCoreBudget());
+
+			if (workStealing)
+			{
+				worker.setExecutionMode(Worker::EM_WORK_STEALING);
+			}
+
+			Indices32 workerCounters(size, 0u);
+			std::atomic<unsigned int> minimalIdleCores(cores);
+
+			worker.executeFunction(Worker::Function::createStatic(&TestWorker::staticWorkerFunctionIdleCores, workerCounters.data(), &minimalIdleCores, 0u, 0u), 0u, size, 2u, 3u, 10u);
+
+			OCEAN_EXPECT_EQUAL(validation, minimalIdleCores.load(), cores);
+
+			for (const Index32 counter : workerCounters)
+			{
+				OCEAN_EXPECT_EQUAL(validation, counter, 1u);
+			}
+		}
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
+bool TestWorker::testAdaptiveLoad(const double testDuration)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Test adaptive load:";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	// the load factor is process-wide, so that we restore the factor afterwards
+
+	const float previousLoad = Worker::adaptiveLoad();
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		const unsigned int maximalNumberCores = RandomI::random(randomGenerator, 2u, 16u);
+
+		Worker worker(Worker::TYPE_ADAPTIVE, maximalNumberCores);
+
+		if (RandomI::boolean(randomGenerator))
+		{
+			worker.setExecutionMode(Worker::EM_WORK_STEALING);
+		}
+
+		const unsigned int threads = worker.threads();
+
+		const float loadFactor = RandomI::boolean(randomGenerator) ? float(RandomI::random(randomGenerator, 1u, 4u)) * 0.25f : float(RandomI::random(randomGenerator, 1u, 100u)) * 0.01f;
+
+		Worker::setAdaptiveLoad(loadFactor);
+		OCEAN_EXPECT_EQUAL(validation, Worker::adaptiveLoad(), loadFactor);
+
+		const unsigned int maximalActiveThreads = std::max(1u, std::min(threads, (unsigned int)(float(threads) * loadFactor + 0.5f)));
+
+		const unsigned int size = RandomI::random(randomGenerator, 1u, 100000u);
+
+		Indices32 counters(size, 0u);
+		Indices32 threadIndices(size, (unsigned int)(-1));
+
+		worker.executeFunction(Worker::Function::createStatic(&TestWorker::staticWorkerFunctionCount, counters.data(), threadIndices.data(), 0u, 0u, 0u), 0u, size, 2u, 3u, 1u, 4u);
+
+		std::vector<uint8_t> usedThreads(threads, 0u);
+
+		for (unsigned int n = 0u; n < size; ++n)
+		{
+			OCEAN_EXPECT_EQUAL(validation, counters[n], 1u);
+
+			// the worker must not use more threads than the load factor allows
+
+			OCEAN_EXPECT_LESS(validation, threadIndices[n], maximalActiveThreads);
+
+			if (threadIndices[n] < threads)
+			{
+				usedThreads[threadIndices[n]] = 1u;
+			}
+		}
+
+		unsigned int numberUsedThreads = 0u;
+
+		for (const uint8_t usedThread : usedThreads)
+		{
+			numberUsedThreads += usedThread;
+		}
+
+		OCEAN_EXPECT_LESS_EQUAL(validation, numberUsedThreads, maximalActiveThreads);
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Worker::setAdaptiveLoad(previousLoad);
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
+bool TestWorker::testThermalAdaptation(const double testDuration)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Test thermal adaptation:";
+
+	using Performance = System::Performance;
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		const Performance::PerformanceLevel performanceLevel = Performance::PerformanceLevel(RandomI::random(randomGenerator, (unsigned int)(Performance::LEVEL_LOW), (unsigned int)(Performance::LEVEL_ULTRA)));
+
+		const double recoveryDuration = double(RandomI::random(randomGenerator, 1u, 20u));
+		const double interval = double(RandomI::random(randomGenerator, 1u, 4u)) * 0.25;
+
+		Timestamp timestamp(double(RandomI::random(randomGenerator, 1u, 1000u)));
+		Timestamp recoveryTimestamp(false);
+
+		float load = 1.0f;
+
+		// the timestamp since which the injected status has allowed a higher load without interruption
+		Timestamp betterTimestamp(false);
+
+		const unsigned int measurements = RandomI::random(randomGenerator, 1u, 200u);
+
+		for (unsigned int n = 0u; n < measurements; ++n)
+		{
+			// we inject thermal states which hold for several measurements, so that the load can recover
+
+			const Performance::ThermalStatus thermalStatus = Performance::ThermalStatus(RandomI::random(randomGenerator, (unsigned int)(Performance::TS_UNKNOWN), (unsigned int)(Performance::TS_CRITICAL)));
+			const unsigned int repetitions = RandomI::random(randomGenerator, 1u, 50u);
+
+			for (unsigned int r = 0u; r < repetitions; ++r)
+			{
+				const float newLoad = Performance::determineLoad(thermalStatus, performanceLevel, load, timestamp, recoveryDuration, recoveryTimestamp);
+
+				OCEAN_EXPECT_TRUE(validation, newLoad > 0.0f && newLoad <= 1.0f);
+
+				if (thermalStatus == Performance::TS_UNKNOWN)
+				{
+					// an unknown status never changes the load
+
+					OCEAN_EXPECT_EQUAL(validation, newLoad, load);
+				}
+				else
+				{
+					const float targetLoad = Performance::thermalStatus2load(thermalStatus, performanceLevel);
+
+					if (targetLoad <= load)
+					{
+						// a worse or identical status is applied immediately
+
+						OCEAN_EXPECT_EQUAL(validation, newLoad, targetLoad);
+
+						betterTimestamp.toInvalid();
+					}
+					else
+					{
+						if (betterTimestamp.isInvalid())
+						{
+							betterTimestamp = timestamp;
+						}
+
+						if (timestamp >= betterTimestamp + recoveryDuration)
+						{
+							// the better status has held for the recovery duration
+
+							OCEAN_EXPECT_EQUAL(validation, newLoad, targetLoad);
+
+							betterTimestamp.toInvalid();
+						}
+						else
+						{
+							// the load must not oscillate, a better status is applied only after the recovery duration
+
+							OCEAN_EXPECT_EQUAL(validation, newLoad, load);
+						}
+					}
+				}
+
+				load = newLoad;
+				timestamp += interval;
+			}
+		}
+
+		// a fixed sequence: the device gets hot, cools down briefly, and cools down for the recovery duration
+
+		recoveryTimestamp.toInvalid();
+		load = 1.0f;
+
+		load = Performance::determineLoad(Performance::TS_SEVERE, performanceLevel, load, timestamp, recoveryDuration, recoveryTimestamp);
+		OCEAN_EXPECT_EQUAL(validation, load, Performance::thermalStatus2load(Performance::TS_SEVERE, performanceLevel));
+		OCEAN_EXPECT_LESS(validation, load, 1.0f);
+
+		const float severeLoad = load;
+
+		load = Performance::determineLoad(Performance::TS_NONE, performanceLevel, load, timestamp + recoveryDuration * 0.5, recoveryDuration, recoveryTimestamp);
+		OCEAN_EXPECT_EQUAL(validation, load, severeLoad);
+
+		// the device gets hotter again before the recovery duration has passed, the recovery starts again
+
+		load = Performance::determineLoad(Performance::TS_SEVERE, performanceLevel, load, timestamp + recoveryDuration * 0.75, recoveryDuration, recoveryTimestamp);
+		OCEAN_EXPECT_EQUAL(validation, load, severeLoad);
+
+		load = Performance::determineLoad(Performance::TS_NONE, performanceLevel, load, timestamp + recoveryDuration, recoveryDuration, recoveryTimestamp);
+		OCEAN_EXPECT_EQUAL(validation, load, severeLoad);
+
+		load = Performance::determineLoad(Performance::TS_NONE, performanceLevel, load, timestamp + recoveryDuration * 1.5, recoveryDuration, recoveryTimestamp);
+		OCEAN_EXPECT_EQUAL(validation, load, severeLoad);
+
+		load = Performance::determineLoad(Performance::TS_NONE, performanceLevel, load, timestamp + recoveryDuration * 2.0, recoveryDuration, recoveryTimestamp);
+		OCEAN_EXPECT_EQUAL(validation, load, 1.0f);
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
 void TestWorker::staticWorkerFunctionDelay(uint64_t* time, const unsigned int first, const unsigned int size)
 {
 	ocean_assert(time);
@@ -531,6 +1004,77 @@ void TestWorker::staticWorkerFunctionSumOfSquareRoots(double* values, const unsi
 	*(values + first) = result;
 }
 
+void TestWorker::staticWorkerFunctionCount(unsigned int* counters, unsigned int* threadIndices, const unsigned int first, const unsigned int size, const unsigned int threadIndex)
+{
+	ocean_assert(counters != nullptr && threadIndices != nullptr);
+
+	for (unsigned int n = first; n < first + size; ++n)
+	{
+		++counters[n];
+		threadIndices[n] = threadIndex;
+	}
+}
+
+void TestWorker::staticWorkerFunctionNested(Worker* worker, unsigned int* counters, unsigned int* threadIndices, const unsigned int width, const unsigned int firstRow, const unsigned int numberRows)
+{
+	ocean_assert(worker != nullptr && counters != nullptr && threadIndices != nullptr);
+
+	for (unsigned int y = firstRow; y < firstRow + numberRows; ++y)
+	{
+		// the nested call must neither dead-lock nor create new threads
+
+		worker->executeFunction(Worker::Function::createStatic(&TestWorker::staticWorkerFunctionCount, counters + y * width, threadIndices + y * width, 0u, 0u, 0u), 0u, width, 2u, 3u, 1u, 4u);
+	}
+}
+
+void TestWorker::staticWorkerFunctionBusy(unsigned int* counters, std::atomic<unsigned int>* busyThreads, std::atomic<unsigned int>* maximalBusyThreads, const unsigned int first, const unsigned int size)
+{
+	ocean_assert(counters != nullptr && busyThreads != nullptr && maximalBusyThreads != nullptr);
+
+	// functions executed by the calling thread (without any core of the budget) are not counted
+
+	const bool isWorkerThread = Worker::currentWorker() != nullptr;
+
+	if (isWorkerThread)
+	{
+		const unsigned int busy = ++(*busyThreads);
+
+		unsigned int maximalBusy = maximalBusyThreads->load();
+		while (busy > maximalBusy && !maximalBusyThreads->compare_exchange_weak(maximalBusy, busy))
+		{
+			// nothing to do here
+		}
+	}
+
+	for (unsigned int n = first; n < first + size; ++n)
+	{
+		++counters[n];
+	}
+
+	if (isWorkerThread)
+	{
+		--(*busyThreads);
+	}
+}
+
+void TestWorker::staticWorkerFunctionIdleCores(unsigned int* counters, std::atomic<unsigned int>* minimalIdleCores, const unsigned int first, const unsigned int size)
+{
+	ocean_assert(counters != nullptr && minimalIdleCores != nullptr);
+
+	const unsigned int idleCores = Worker::idleCores();
+
+	unsigned int minimal = minimalIdleCores->load();
+	while (idleCores < minimal && !minimalIdleCores->compare_exchange_weak(minimal, idleCores))
+	{
+		// nothing to do here
+	}
+
+	for (unsigned int n = first; n < first + size; ++n)
+	{
+		++counters[n];
+	}
+}
+
 bool TestWorker::staticWorkerFunctionAbortable(double* result, bool* abort)
 {
 	ocean_assert(result && abort);
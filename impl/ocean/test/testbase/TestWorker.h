@@ -89,6 +89,42 @@ class OCEAN_TEST_BASE_EXPORT TestWorker : protected Worker
 		 */
 		static bool testSeparableAndAbortableFunction(Worker& worker);
 
+		/**
+		 * Tests the work-stealing execution mode.
+		 * @param testDuration The number of seconds for each test, with range (0, infinity)
+		 * @return True, if succeeded
+		 */
+		static bool testWorkStealing(const double testDuration);
+
+		/**
+		 * Tests nested function calls, functions executed by a worker invoking the same worker again.
+		 * @param testDuration The number of seconds for each test, with range (0, infinity)
+		 * @return True, if succeeded
+		 */
+		static bool testNestedExecution(const double testDuration);
+
+		/**
+		 * Tests that concurrently used workers taking part in the core budget share the cores of the device and never use more worker threads than cores.
+		 * Workers not taking part in the core budget must not change the budget.
+		 * @param testDuration The number of seconds for each test, with range (0, infinity)
+		 * @return True, if succeeded
+		 */
+		static bool testCoreBudget(const double testDuration);
+
+		/**
+		 * Tests adaptive workers with a load factor below 1, the worker must use fewer threads while the results stay correct.
+		 * @param testDuration The number of seconds for each test, with range (0, infinity)
+		 * @return True, if succeeded
+		 */
+		static bool testAdaptiveLoad(const double testDuration);
+
+		/**
+		 * Tests the hysteresis of the adaptation of the worker load to sequences of thermal states.
+		 * @param testDuration The number of seconds for each test, with range (0, infinity)
+		 * @return True, if succeeded
+		 */
+		static bool testThermalAdaptation(const double testDuration);
+
 	private:
 
 		/**
@@ -139,6 +175,46 @@ class OCEAN_TEST_BASE_EXPORT TestWorker : protected Worker
 		 * @return True, if succeeded and not aborted
 		 */
 		static bool staticWorkerFunctionSeparableAndAbortable(double* result, const unsigned int first, const unsigned int size, bool* abort);
+
+		/**
+		 * Static worker function counting how often each element has been handled.
+		 * @param counters The counters, one for each element, must be valid
+		 * @param threadIndices The index of the thread which has handled each element, one for each element, must be valid
+		 * @param first The first element
+		 * @param size The number of elements, with range [1, infinity)
+		 * @param threadIndex The index of the thread executing the function
+		 */
+		static void staticWorkerFunctionCount(unsigned int* counters, unsigned int* threadIndices, const unsigned int first, const unsigned int size, const unsigned int threadIndex);
+
+		/**
+		 * Static worker function invoking a nested worker function for each row.
+		 * @param worker The worker which is executing this function, must be valid
+		 * @param counters The counters, with 'width' elements for each row, must be valid
+		 * @param threadIndices The thread indices, with 'width' elements for each row, must be valid
+		 * @param width The number of elements in each row, with range [1, infinity)
+		 * @param firstRow The first row to be handled
+		 * @param numberRows The number of rows to be handled, with range [1, infinity)
+		 */
+		static void staticWorkerFunctionNested(Worker* worker, unsigned int* counters, unsigned int* threadIndices, const unsigned int width, const unsigned int firstRow, const unsigned int numberRows);
+
+		/**
+		 * Static worker function counting elements and determining the maximal number of worker threads being busy at the same time.
+		 * @param counters The counters of all elements, must be valid
+		 * @param busyThreads The number of worker threads currently executing this function
+		 * @param maximalBusyThreads The maximal number of worker threads which executed this function at the same time
+		 * @param first The first element
+		 * @param size The number of elements, with range [1, infinity)
+		 */
+		static void staticWorkerFunctionBusy(unsigned int* counters, std::atomic<unsigned int>* busyThreads, std::atomic<unsigned int>* maximalBusyThreads, const unsigned int first, const unsigned int size);
+
+		/**
+		 * Static worker function counting elements and determining the minimal number of idle cores of the core budget during the execution.
+		 * @param counters The counters of all elements, must be valid
+		 * @param minimalIdleCores The minimal number of idle cores which has been observed
+		 * @param first The first element
+		 * @param size The number of elements, with range [1, infinity)
+		 */
+		static void staticWorkerFunctionIdleCores(unsigned int* counters, std::atomic<unsigned int>* minimalIdleCores, const unsigned int first, const unsigned int size);
 };
 
 }
@@ -52,6 +52,15 @@ bool TestWorkerPool::test(const double testDuration, const TestSelector& selecto
 		Log::info() << " ";
 	}
 
+	if (selector.shouldRun("priorityclasses"))
+	{
+		testResult = testPriorityClasses(testDuration);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
 	Log::info() << testResult;
 
 	return testResult.succeeded();
@@ -67,6 +76,14 @@ TEST(TestWorkerPool, ScopedWorker)
 	}
 }
 
+TEST(TestWorkerPool, PriorityClasses)
+{
+	if (Processor::get().cores() > 1)
+	{
+		EXPECT_TRUE(TestWorkerPool::testPriorityClasses(GTEST_TEST_DURATION));
+	}
+}
+
 TEST(TestWorkerPool, SetCapacity)
 {
 	// actually we do not want to increase the capacity for this test (as we cannot reduce the capacity anymore),
@@ -166,6 +183,67 @@ bool TestWorkerPool::testScopedWorker(const double testDuration)
 	return validation.succeeded();
 }
 
+bool TestWorkerPool::testPriorityClasses(const double testDuration)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Test ScopedWorker with priority classes:";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		// all default workers are in use, workers of other priority classes must still be available
+
+		const WorkerPool::ScopedWorker firstScopedWorker(WorkerPool::get().scopedWorker());
+		const WorkerPool::ScopedWorker secondScopedWorker(WorkerPool::get().scopedWorker());
+
+		OCEAN_EXPECT_TRUE(validation, firstScopedWorker && secondScopedWorker);
+
+		for (const Thread::PriorityClass priorityClass : {Thread::PC_REALTIME_TRACKING, Thread::PC_INTERACTIVE, Thread::PC_BACKGROUND})
+		{
+			const WorkerPool::ScopedWorker scopedWorker(WorkerPool::get().scopedWorker(priorityClass));
+
+			if (scopedWorker)
+			{
+				OCEAN_EXPECT_EQUAL(validation, scopedWorker()->priorityClass(), priorityClass);
+
+				std::atomic<unsigned int> sum(0u);
+
+				scopedWorker()->executeFunction(Worker::Function::createStatic(&TestWorkerPool::accumulate, &sum, 0u, 0u), 0u, 1000u);
+
+				OCEAN_EXPECT_EQUAL(validation, sum.load(), 1000u * 999u / 2u);
+			}
+			else
+			{
+				OCEAN_SET_FAILED(validation);
+			}
+		}
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
+void TestWorkerPool::accumulate(std::atomic<unsigned int>* sum, const unsigned int first, const unsigned int size)
+{
+	ocean_assert(sum != nullptr);
+
+	unsigned int localSum = 0u;
+
+	for (unsigned int n = first; n < first + size; ++n)
+	{
+		localSum += n;
+	}
+
+	*sum += localSum;
+}
+
 }
 
 }
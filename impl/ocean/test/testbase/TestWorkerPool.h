@@ -11,6 +11,8 @@
 #include "ocean/test/testbase/TestBase.h"
 #include "ocean/test/TestSelector.h"
 
+#include <atomic>
+
 namespace Ocean
 {
 
@@ -42,6 +44,23 @@ class OCEAN_TEST_BASE_EXPORT TestWorkerPool
 		 * @return True, if succeeded
 		 */
 		static bool testScopedWorker(const double testDuration);
+
+		/**
+		 * Tests the acquiring of ScopedWorker objects with individual priority classes.
+		 * @param testDuration Number of seconds for the test, with range (0, infinity)
+		 * @return True, if succeeded
+		 */
+		static bool testPriorityClasses(const double testDuration);
+
+	protected:
+
+		/**
+		 * Adds all indices of a subset to a sum.
+		 * @param sum The sum to which the indices will be added, must be valid
+		 * @param first The first index to add
+		 * @param size The number of indices to add
+		 */
+		static void accumulate(std::atomic<unsigned int>* sum, const unsigned int first, const unsigned int size);
 };
 
 }
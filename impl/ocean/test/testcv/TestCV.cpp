@@ -76,8 +76,10 @@
 #include "ocean/test/testcv/TestFrameNormalizer.h"
 #include "ocean/test/testcv/TestFrameOperations.h"
 #include "ocean/test/testcv/TestFramePyramid.h"
+#include "ocean/test/testcv/TestFramePyramidCache.h"
 #include "ocean/test/testcv/TestFrameShrinker.h"
 #include "ocean/test/testcv/TestFrameShrinkerAlpha.h"
+#include "ocean/test/testcv/TestFrameStatistics.h"
 #include "ocean/test/testcv/TestFrameTransposer.h"
 #include "ocean/test/testcv/TestFrameVariance.h"
 #include "ocean/test/testcv/TestFrequencyAnalysis.h"
@@ -837,6 +839,16 @@ bool testCV(const double testDuration, Worker& worker, const unsigned int width,
 		testResult = TestFramePyramid::test(testDuration, worker, subSelector);
 	}
 
+	if (TestSelector subSelector = selector.shouldRun("framepyramidcache"))
+	{
+		Log::info() << " ";
+		Log::info() << " ";
+		Log::info() << " ";
+		Log::info() << " ";
+
+		testResult = TestFramePyramidCache::test(testDuration, worker, subSelector);
+	}
+
 	if (TestSelector subSelector = selector.shouldRun("frameinterpolatornearestpixel"))
 	{
 		Log::info() << " ";
@@ -914,7 +926,7 @@ bool testCV(const double testDuration, Worker& worker, const unsigned int width,
 		Log::info() << " ";
 		Log::info() << " ";
 
-		testResult = TestIntegralImage::test(width, height, testDuration, subSelector);
+		testResult = TestIntegralImage::test(width, height, testDuration, worker, subSelector);
 	}
 
 	if (TestSelector subSelector = selector.shouldRun("framevariance"))
@@ -977,6 +989,16 @@ bool testCV(const double testDuration, Worker& worker, const unsigned int width,
 		testResult = TestFrameMinMax::test(width, height, testDuration, worker, subSelector);
 	}
 
+	if (TestSelector subSelector = selector.shouldRun("framestatistics"))
+	{
+		Log::info() << " ";
+		Log::info() << " ";
+		Log::info() << " ";
+		Log::info() << " ";
+
+		testResult = TestFrameStatistics::test(width, height, testDuration, worker, subSelector);
+	}
+
 	if (TestSelector subSelector = selector.shouldRun("histogram"))
 	{
 		Log::info() << " ";
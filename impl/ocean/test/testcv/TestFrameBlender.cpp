@@ -75,6 +75,15 @@ bool TestFrameBlender::test(const double testDuration, Worker& worker, const Tes
 		Log::info() << " ";
 		testResult = testBlendWithConstantValue<false>(testDuration, worker);
 
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
+	if (selector.shouldRun("blendpremultiplied"))
+	{
+		testResult = testBlendPremultiplied(testDuration, worker);
+
 		Log::info() << " ";
 	}
 
@@ -127,6 +136,12 @@ TEST(TestFrameBlender, BlendWithConstantValue_Opaque0xFF)
 	EXPECT_TRUE((TestFrameBlender::testBlendWithConstantValue<false>(GTEST_TEST_DURATION, worker)));
 }
 
+TEST(TestFrameBlender, BlendPremultiplied)
+{
+	Worker worker;
+	EXPECT_TRUE(TestFrameBlender::testBlendPremultiplied(GTEST_TEST_DURATION, worker));
+}
+
 #endif // OCEAN_USE_GTEST
 
 bool TestFrameBlender::testConstantAlpha(const double testDuration, Worker& worker)
@@ -386,6 +401,121 @@ bool TestFrameBlender::testBlendWithConstantValue(const double testDuration, Wor
 	return validation.succeeded();
 }
 
+bool TestFrameBlender::testBlendPremultiplied(const double testDuration, Worker& worker)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Test blend function with premultiplied alpha:";
+	Log::info() << " ";
+
+	constexpr unsigned int width = 1920u;
+	constexpr unsigned int height = 1080u;
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	const FrameType::PixelFormats pixelFormats =
+	{
+		FrameType::FORMAT_YA16,
+		FrameType::FORMAT_BGRA32,
+		FrameType::FORMAT_RGBA32,
+		FrameType::FORMAT_ABGR32,
+		FrameType::FORMAT_ARGB32
+	};
+
+	for (const FrameType::PixelFormat pixelFormat : pixelFormats)
+	{
+		for (const bool targetHasAlpha : {false, true})
+		{
+			const FrameType::PixelFormat targetPixelFormat = targetHasAlpha ? pixelFormat : FrameType::formatRemoveAlphaChannel(pixelFormat);
+
+			Log::info() << width << "x" << height << " with " << FrameType::translatePixelFormat(pixelFormat) << " -> " << FrameType::translatePixelFormat(targetPixelFormat);
+
+			HighPerformanceStatistic performanceSinglecore;
+			HighPerformanceStatistic performanceMulticore;
+
+			const unsigned int maxWorkerIterations = worker ? 2u : 1u;
+
+			for (unsigned int workerIteration = 0u; workerIteration < maxWorkerIterations; ++workerIteration)
+			{
+				Worker* useWorker = (workerIteration == 0u) ? nullptr : &worker;
+				HighPerformanceStatistic& performance = useWorker ? performanceMulticore : performanceSinglecore;
+
+				const Timestamp startTimestamp(true);
+
+				do
+				{
+					for (const bool performanceIteration : {true, false})
+					{
+						const unsigned int widthToUse = performanceIteration ? width : RandomI::random(randomGenerator, 1u, width);
+						const unsigned int heightToUse = performanceIteration ? height : RandomI::random(randomGenerator, 1u, height);
+
+						Frame sourceFrameWithAlpha = CV::CVUtilities::randomizedFrame(FrameType(widthToUse, heightToUse, pixelFormat, FrameType::ORIGIN_UPPER_LEFT), &randomGenerator);
+
+						bool alphaIsLastChannel = false;
+						FrameType::formatHasAlphaChannel(pixelFormat, &alphaIsLastChannel);
+
+						const unsigned int alphaIndex = alphaIsLastChannel ? sourceFrameWithAlpha.channels() - 1u : 0u;
+
+						if (RandomI::boolean(randomGenerator))
+						{
+							// we premultiply the data channels for most iterations, otherwise we keep invalid premultiplied values to test the clamping
+
+							for (unsigned int y = 0u; y < sourceFrameWithAlpha.height(); ++y)
+							{
+								for (unsigned int x = 0u; x < sourceFrameWithAlpha.width(); ++x)
+								{
+									uint8_t* const pixel = sourceFrameWithAlpha.pixel<uint8_t>(x, y);
+
+									for (unsigned int n = 0u; n < sourceFrameWithAlpha.channels(); ++n)
+									{
+										if (n != alphaIndex)
+										{
+											pixel[n] = uint8_t((pixel[n] * pixel[alphaIndex] + 127u) / 255u);
+										}
+									}
+								}
+							}
+						}
+
+						Frame targetFrame = CV::CVUtilities::randomizedFrame(FrameType(widthToUse, heightToUse, targetPixelFormat, FrameType::ORIGIN_UPPER_LEFT), &randomGenerator);
+
+						const Frame targetFrameCopy(targetFrame, Frame::ACM_COPY_KEEP_LAYOUT_COPY_PADDING_DATA);
+
+						performance.startIf(performanceIteration);
+							OCEAN_EXPECT_TRUE(validation, CV::FrameBlender::blendPremultiplied(sourceFrameWithAlpha, targetFrame, useWorker));
+						performance.stopIf(performanceIteration);
+
+						if (!CV::CVUtilities::isPaddingMemoryIdentical(targetFrame, targetFrameCopy))
+						{
+							ocean_assert(false && "Invalid padding memory!");
+							OCEAN_SET_FAILED(validation);
+							break;
+						}
+
+						OCEAN_EXPECT_TRUE(validation, validateBlendPremultipliedResult(sourceFrameWithAlpha, targetFrameCopy, targetFrame));
+					}
+				}
+				while (!startTimestamp.hasTimePassed(testDuration));
+			}
+
+			Log::info() << "Singlecore performance: Best: " << String::toAString(performanceSinglecore.bestMseconds(), 2u) << "ms, worst: " << String::toAString(performanceSinglecore.worstMseconds(), 2u) << "ms, average: " << String::toAString(performanceSinglecore.averageMseconds(), 2u) << "ms";
+
+			if (performanceMulticore.measurements() != 0u)
+			{
+				Log::info() << "Multicore performance: Best: " << String::toAString(performanceMulticore.bestMseconds(), 2u) << "ms, worst: " << String::toAString(performanceMulticore.worstMseconds(), 2u) << "ms, average: " << String::toAString(performanceMulticore.averageMseconds(), 2u) << "ms";
+				Log::info() << "Multicore boost: Best: " << String::toAString(performanceSinglecore.best() / performanceMulticore.best(), 1u) << "x, worst: " << String::toAString(performanceSinglecore.worst() / performanceMulticore.worst(), 1u) << "x, average: " << String::toAString(performanceSinglecore.average() / performanceMulticore.average(), 1u) << "x";
+			}
+
+			Log::info() << " ";
+		}
+	}
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
 template <bool tTransparentIs0xFF>
 bool TestFrameBlender::testSeparateAlphaChannelSubFrame(const double testDuration, Worker& worker)
 {
@@ -804,6 +934,54 @@ bool TestFrameBlender::validateBlendResult(const Frame& sourceWithAlpha, const F
 	return true;
 }
 
+bool TestFrameBlender::validateBlendPremultipliedResult(const Frame& sourceWithAlpha, const Frame& target, const Frame& blendResult)
+{
+	ocean_assert(sourceWithAlpha.isValid() && target.isValid() && blendResult.isValid());
+
+	if (target.frameType() != blendResult.frameType() || sourceWithAlpha.width() != target.width() || sourceWithAlpha.height() != target.height())
+	{
+		return false;
+	}
+
+	bool isLastChannel = false;
+	if (!FrameType::formatHasAlphaChannel(sourceWithAlpha.pixelFormat(), &isLastChannel))
+	{
+		return false;
+	}
+
+	const unsigned int sourceAlphaChannelIndex = isLastChannel ? sourceWithAlpha.channels() - 1u : 0u;
+
+	// in case the target holds an alpha channel, the layout is identical to the source layout, otherwise the alpha channel is simply removed
+	const bool targetHasAlpha = target.channels() == sourceWithAlpha.channels();
+	const unsigned int sourceChannelOffset = (!targetHasAlpha && sourceAlphaChannelIndex == 0u) ? 1u : 0u;
+
+	for (unsigned int y = 0u; y < target.height(); ++y)
+	{
+		for (unsigned int x = 0u; x < target.width(); ++x)
+		{
+			const uint8_t* const sourcePixel = sourceWithAlpha.constpixel<uint8_t>(x, y);
+			const uint8_t* const targetPixel = target.constpixel<uint8_t>(x, y);
+			const uint8_t* const resultPixel = blendResult.constpixel<uint8_t>(x, y);
+
+			const unsigned int targetFactor = 0xFFu - sourcePixel[sourceAlphaChannelIndex];
+
+			for (unsigned int n = 0u; n < target.channels(); ++n)
+			{
+				const unsigned int sourceValue = sourcePixel[n + sourceChannelOffset];
+
+				const unsigned int value = std::min(sourceValue + (targetPixel[n] * targetFactor + 127u) / 255u, 255u);
+
+				if (resultPixel[n] != uint8_t(value))
+				{
+					return false;
+				}
+			}
+		}
+	}
+
+	return true;
+}
+
 }
 
 }
@@ -76,6 +76,14 @@ class OCEAN_TEST_CV_EXPORT TestFrameBlender
 		template <bool tTransparentIs0xFF>
 		static bool testBlendWithConstantValue(const double testDuration, Worker& worker);
 
+		/**
+		 * Tests the blend function for source frames with premultiplied alpha channel.
+		 * @param testDuration Test duration in seconds, with range (0, infinity)
+		 * @param worker The worker object to distribute the computation
+		 * @return True, if this test succeeded
+		 */
+		static bool testBlendPremultiplied(const double testDuration, Worker& worker);
+
 	protected:
 
 		/**
@@ -126,6 +134,15 @@ class OCEAN_TEST_CV_EXPORT TestFrameBlender
 		template <bool tTransparentIs0xFF>
 		static bool testFullFrame(const FrameType::PixelFormat sourcePixelFormat, const FrameType::PixelFormat targetPixelFormat, const unsigned int width, const unsigned int height, const double testDuration, Worker& worker);
 
+		/**
+		 * Validates the blend function for source frames with premultiplied alpha channel.
+		 * @param sourceWithAlpha The source frame with premultiplied alpha channel, must be valid
+		 * @param target The target frame before blending, must be valid
+		 * @param blendResult The blend result, must be valid
+		 * @return True, if succeeded
+		 */
+		static bool validateBlendPremultipliedResult(const Frame& sourceWithAlpha, const Frame& target, const Frame& blendResult);
+
 		/**
 		 * Validates the blend function with alpha channel.
 		 * @param sourceWithAlpha The source frame with alpha channel, must be valid
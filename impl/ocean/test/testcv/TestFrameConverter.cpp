@@ -61,6 +61,15 @@ bool TestFrameConverter::test(const double testDuration, Worker& /*worker*/, con
 		Log::info() << " ";
 	}
 
+	if (selector.shouldRun("comfortWarmUp"))
+	{
+		testResult = testComfortWarmUp(testDuration);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
 	if (selector.shouldRun("cast"))
 	{
 		testResult = testCast(testDuration);
@@ -333,6 +342,11 @@ TEST(TestFrameConverter, ComfortChange)
 	EXPECT_TRUE(TestFrameConverter::testComfortChange(GTEST_TEST_DURATION));
 }
 
+TEST(TestFrameConverter, ComfortWarmUp)
+{
+	EXPECT_TRUE(TestFrameConverter::testComfortWarmUp(GTEST_TEST_DURATION));
+}
+
 TEST(TestFrameConverter, Cast)
 {
 	EXPECT_TRUE(TestFrameConverter::testCast(GTEST_TEST_DURATION));
@@ -1085,6 +1099,66 @@ bool TestFrameConverter::testComfortChange(const double testDuration)
 	return validation.succeeded();
 }
 
+bool TestFrameConverter::testComfortWarmUp(const double testDuration)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Test comfort warm up function:";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	const CV::FrameConverter::PixelFormatPairs supportedPixelFormatPairs =
+	{
+		{FrameType::FORMAT_Y_UV12, FrameType::FORMAT_RGB24},
+		{FrameType::FORMAT_Y_U_V12, FrameType::FORMAT_Y8},
+		{FrameType::FORMAT_YUYV16, FrameType::FORMAT_BGR24},
+		{FrameType::FORMAT_RGBA32, FrameType::FORMAT_Y8},
+		{FrameType::FORMAT_Y10_PACKED, FrameType::FORMAT_Y8},
+		{FrameType::FORMAT_RGB24, FrameType::FORMAT_RGB24}
+	};
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		// the table of conversion functions only
+
+		OCEAN_EXPECT_TRUE(validation, CV::FrameConverter::Comfort::warmUp(CV::FrameConverter::PixelFormatPairs()));
+
+		CV::FrameConverter::PixelFormatPairs pixelFormatPairs;
+
+		for (const CV::FrameConverter::PixelFormatPair& pixelFormatPair : supportedPixelFormatPairs)
+		{
+			if (RandomI::boolean(randomGenerator))
+			{
+				pixelFormatPairs.emplace_back(pixelFormatPair);
+			}
+		}
+
+		OCEAN_EXPECT_TRUE(validation, CV::FrameConverter::Comfort::warmUp(pixelFormatPairs));
+
+		// conversions with gamma correction need individual lookup tables
+
+		const float gamma = RandomF::scalar(randomGenerator, 0.4f, 1.9f);
+
+		OCEAN_EXPECT_TRUE(validation, CV::FrameConverter::Comfort::warmUp({{FrameType::FORMAT_Y8, FrameType::FORMAT_Y8}, {FrameType::FORMAT_Y10_PACKED, FrameType::FORMAT_Y8}}, CV::FrameConverter::Options(gamma)));
+
+		// a conversion which is not supported
+
+		OCEAN_EXPECT_FALSE(validation, CV::FrameConverter::Comfort::warmUp({{FrameType::FORMAT_Y8, FrameType::FORMAT_Y10_PACKED}}));
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	// the tables can be created in the background as well
+
+	OCEAN_EXPECT_TRUE(validation, CV::FrameConverter::Comfort::warmUp(supportedPixelFormatPairs, CV::FrameConverter::Options(), true /*background*/));
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
 bool TestFrameConverter::testCast(const double testDuration)
 {
 	ocean_assert(testDuration > 0.0);
@@ -1106,6 +1180,7 @@ bool TestFrameConverter::testCast(const double testDuration)
 
 		allSucceeded = testCast<uint8_t>(width, height, channels) && allSucceeded;
 
+		allSucceeded = testCast<Float16>(width, height, channels) && allSucceeded;
 		allSucceeded = testCast<float>(width, height, channels) && allSucceeded;
 		allSucceeded = testCast<double>(width, height, channels) && allSucceeded;
 
@@ -5632,7 +5707,66 @@ bool TestFrameConverter::testCast(const unsigned int width, const unsigned int h
 
 			for (unsigned int c = 0u; c < channels; ++c)
 			{
-				if (NumericT<T>::isNotEqual(T(sourcePixel[c]), targetPixel[c]))
+				if constexpr (std::is_same<T, Float16>::value)
+				{
+					// all 8 bit values can be represented exactly with 16-bit floats
+
+					if (float(targetPixel[c]) != float(sourcePixel[c]))
+					{
+						return false;
+					}
+				}
+				else
+				{
+					if (NumericT<T>::isNotEqual(T(sourcePixel[c]), targetPixel[c]))
+					{
+						return false;
+					}
+				}
+			}
+		}
+	}
+
+	if constexpr (std::is_same<T, Float16>::value)
+	{
+		// we also check the cast between 16-bit floats and 32-bit floats
+
+		Frame floatFrame = CV::CVUtilities::randomizedFrame(FrameType(sourceFrame, FrameType::genericPixelFormat<float>(channels)));
+
+		for (unsigned int y = 0u; y < height; ++y)
+		{
+			float* const floatRow = floatFrame.row<float>(y);
+
+			for (unsigned int n = 0u; n < width * channels; ++n)
+			{
+				floatRow[n] = RandomF::scalar(-1000.0f, 1000.0f);
+			}
+		}
+
+		Frame float16Frame = CV::CVUtilities::randomizedFrame(FrameType(sourceFrame, FrameType::genericPixelFormat<Float16>(channels)));
+		const Frame copyFloat16Frame(float16Frame, Frame::ACM_COPY_KEEP_LAYOUT_COPY_PADDING_DATA);
+
+		CV::FrameConverter::cast<float, Float16>(floatFrame.constdata<float>(), float16Frame.data<Float16>(), width, height, channels, floatFrame.paddingElements(), float16Frame.paddingElements());
+
+		if (!CV::CVUtilities::isPaddingMemoryIdentical(float16Frame, copyFloat16Frame))
+		{
+			ocean_assert(false && "Invalid padding memory!");
+			return false;
+		}
+
+		Frame backFloatFrame = CV::CVUtilities::randomizedFrame(floatFrame.frameType());
+
+		CV::FrameConverter::cast<Float16, float>(float16Frame.constdata<Float16>(), backFloatFrame.data<float>(), width, height, channels, float16Frame.paddingElements(), backFloatFrame.paddingElements());
+
+		for (unsigned int y = 0u; y < height; ++y)
+		{
+			const float* const floatRow = floatFrame.constrow<float>(y);
+			const Float16* const float16Row = float16Frame.constrow<Float16>(y);
+			const float* const backFloatRow = backFloatFrame.constrow<float>(y);
+
+			for (unsigned int n = 0u; n < width * channels; ++n)
+			{
+				if (float16Row[n] != Float16(floatRow[n]) || backFloatRow[n] != float(float16Row[n]))
 				{
 					return false;
 				}
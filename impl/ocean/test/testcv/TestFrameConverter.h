@@ -71,6 +71,13 @@ class OCEAN_TEST_CV_EXPORT TestFrameConverter : protected CV::FrameConverter
 		 */
 		static bool testComfortChange(const double testDuration);
 
+		/**
+		 * Tests the comfort warm up function.
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @return True, if succeeded
+		 */
+		static bool testComfortWarmUp(const double testDuration);
+
 		/**
 		 * Tests the cast function.
 		 * @param testDuration Number of seconds for each test, with range (0, infinity)
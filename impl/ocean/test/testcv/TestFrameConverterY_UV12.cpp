@@ -7,10 +7,17 @@
 
 #include "ocean/test/testcv/TestFrameConverterY_UV12.h"
 
+#include "ocean/base/HighPerformanceTimer.h"
+#include "ocean/base/RandomI.h"
+#include "ocean/base/Timestamp.h"
+
+#include "ocean/cv/CVUtilities.h"
 #include "ocean/cv/FrameConverterY_UV12.h"
+#include "ocean/cv/FrameInterpolatorBilinear.h"
 
 #include "ocean/test/TestResult.h"
 #include "ocean/test/TestSelector.h"
+#include "ocean/test/Validation.h"
 
 namespace Ocean
 {
@@ -188,6 +195,15 @@ bool TestFrameConverterY_UV12::test(const unsigned int width, const unsigned int
 			testResult = testY_UV12ToY_U_V12(width, height, flag, testDuration, worker);
 		}
 
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
+	if (selector.shouldRun("y_uv12torgbresized"))
+	{
+		testResult = testY_UV12ToRGBResized(width, height, testDuration, worker);
+
 		Log::info() << " ";
 	}
 
@@ -469,6 +485,13 @@ TEST(TestFrameConverterY_UV12, Y_UV12ToY_U_V12FlippedMirrored)
 	EXPECT_TRUE(TestFrameConverterY_UV12::testY_UV12ToY_U_V12(GTEST_TEST_IMAGE_WIDTH, GTEST_TEST_IMAGE_HEIGHT, CV::FrameConverter::CONVERT_FLIPPED_AND_MIRRORED, GTEST_TEST_DURATION, worker));
 }
 
+
+TEST(TestFrameConverterY_UV12, Y_UV12ToRGBResized)
+{
+	Worker worker;
+	EXPECT_TRUE(TestFrameConverterY_UV12::testY_UV12ToRGBResized(GTEST_TEST_IMAGE_WIDTH, GTEST_TEST_IMAGE_HEIGHT, GTEST_TEST_DURATION, worker));
+}
+
 #endif // OCEAN_USE_GTEST
 
 bool TestFrameConverterY_UV12::testY_UV12LimitedRangeToBGR24FullRange(const unsigned int width, const unsigned int height, const CV::FrameConverter::ConversionFlag conversionFlag, const double testDuration, Worker& worker)
@@ -632,6 +655,230 @@ bool TestFrameConverterY_UV12::testY_UV12ToY_U_V12(const unsigned int width, con
 	return FrameConverterTestUtilities::testFrameConversion(FrameType::FORMAT_Y_UV12, FrameType::FORMAT_Y_U_V12, width, height, FrameConverterTestUtilities::FunctionWrapper(CV::FrameConverterY_UV12::convertY_UV12ToY_U_V12), conversionFlag, pixelFunctionY_UV12ForYUV24, pixelFunctionY_U_V12ForYUV24, transformationMatrix, 0.0, 255.0, testDuration, worker);
 }
 
+bool TestFrameConverterY_UV12::testY_UV12ToRGBResized(const unsigned int width, const unsigned int height, const double testDuration, Worker& worker)
+{
+	ocean_assert(testDuration > 0.0);
+	ocean_assert(width >= 2u && height >= 2u);
+
+	Log::info() << "Testing Y_UV12 to RGB24/RGBA32 conversion with fused resize for source resolution " << width << "x" << height << ":";
+	Log::info() << " ";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	const unsigned int performanceSourceWidth = std::max(2u, width & 0xFFFFFFFEu);
+	const unsigned int performanceSourceHeight = std::max(2u, height & 0xFFFFFFFEu);
+
+	for (const FrameType::PixelFormat sourcePixelFormat : {FrameType::FORMAT_Y_UV12_LIMITED_RANGE, FrameType::FORMAT_Y_UV12_FULL_RANGE})
+	{
+		for (const FrameType::PixelFormat targetPixelFormat : {FrameType::FORMAT_RGB24, FrameType::FORMAT_RGBA32})
+		{
+			const bool limitedRange = sourcePixelFormat == FrameType::FORMAT_Y_UV12_LIMITED_RANGE;
+
+			Log::info() << "... " << FrameType::translatePixelFormat(sourcePixelFormat) << " -> " << FrameType::translatePixelFormat(targetPixelFormat) << " with " << performanceSourceWidth / 2u << "x" << performanceSourceHeight / 2u << ":";
+
+			HighPerformanceStatistic performanceSinglecore;
+			HighPerformanceStatistic performanceMulticore;
+			HighPerformanceStatistic performanceTwoStepsSinglecore;
+
+			const unsigned int maxWorkerIterations = worker ? 2u : 1u;
+
+			for (unsigned int workerIteration = 0u; workerIteration < maxWorkerIterations; ++workerIteration)
+			{
+				Worker* useWorker = (workerIteration == 0u) ? nullptr : &worker;
+				HighPerformanceStatistic& performance = useWorker ? performanceMulticore : performanceSinglecore;
+
+				const Timestamp startTimestamp(true);
+
+				do
+				{
+					for (const bool performanceIteration : {true, false})
+					{
+						const unsigned int sourceWidth = performanceIteration ? performanceSourceWidth : RandomI::random(randomGenerator, 1u, performanceSourceWidth / 2u) * 2u;
+						const unsigned int sourceHeight = performanceIteration ? performanceSourceHeight : RandomI::random(randomGenerator, 1u, performanceSourceHeight / 2u) * 2u;
+
+						unsigned int targetWidth = sourceWidth / 2u;
+						unsigned int targetHeight = sourceHeight / 2u;
+
+						if (!performanceIteration && RandomI::boolean(randomGenerator))
+						{
+							targetWidth = RandomI::random(randomGenerator, 1u, sourceWidth * 2u);
+							targetHeight = RandomI::random(randomGenerator, 1u, sourceHeight * 2u);
+						}
+
+						const Frame sourceFrame = CV::CVUtilities::randomizedFrame(FrameType(sourceWidth, sourceHeight, sourcePixelFormat, FrameType::ORIGIN_UPPER_LEFT), &randomGenerator);
+
+						Frame targetFrame = CV::CVUtilities::randomizedFrame(FrameType(targetWidth, targetHeight, targetPixelFormat, FrameType::ORIGIN_UPPER_LEFT), &randomGenerator);
+
+						const Frame targetFrameCopy(targetFrame, Frame::ACM_COPY_KEEP_LAYOUT_COPY_PADDING_DATA);
+
+						const uint8_t alphaValue = uint8_t(RandomI::random(randomGenerator, 255u));
+
+						performance.startIf(performanceIteration);
+
+						if (targetPixelFormat == FrameType::FORMAT_RGB24)
+						{
+							if (limitedRange)
+							{
+								CV::FrameConverterY_UV12::convertY_UV12LimitedRangeToRGB24FullRangeResized(sourceFrame.constdata<uint8_t>(0u), sourceFrame.constdata<uint8_t>(1u), targetFrame.data<uint8_t>(), sourceWidth, sourceHeight, targetWidth, targetHeight, sourceFrame.paddingElements(0u), sourceFrame.paddingElements(1u), targetFrame.paddingElements(), useWorker);
+							}
+							else
+							{
+								CV::FrameConverterY_UV12::convertY_UV12FullRangeToRGB24FullRangeResized(sourceFrame.constdata<uint8_t>(0u), sourceFrame.constdata<uint8_t>(1u), targetFrame.data<uint8_t>(), sourceWidth, sourceHeight, targetWidth, targetHeight, sourceFrame.paddingElements(0u), sourceFrame.paddingElements(1u), targetFrame.paddingElements(), useWorker);
+							}
+						}
+						else
+						{
+							if (limitedRange)
+							{
+								CV::FrameConverterY_UV12::convertY_UV12LimitedRangeToRGBA32FullRangeResized(sourceFrame.constdata<uint8_t>(0u), sourceFrame.constdata<uint8_t>(1u), targetFrame.data<uint8_t>(), sourceWidth, sourceHeight, targetWidth, targetHeight, sourceFrame.paddingElements(0u), sourceFrame.paddingElements(1u), targetFrame.paddingElements(), alphaValue, useWorker);
+							}
+							else
+							{
+								CV::FrameConverterY_UV12::convertY_UV12FullRangeToRGBA32FullRangeResized(sourceFrame.constdata<uint8_t>(0u), sourceFrame.constdata<uint8_t>(1u), targetFrame.data<uint8_t>(), sourceWidth, sourceHeight, targetWidth, targetHeight, sourceFrame.paddingElements(0u), sourceFrame.paddingElements(1u), targetFrame.paddingElements(), alphaValue, useWorker);
+							}
+						}
+
+						performance.stopIf(performanceIteration);
+
+						if (!CV::CVUtilities::isPaddingMemoryIdentical(targetFrame, targetFrameCopy))
+						{
+							ocean_assert(false && "Invalid padding memory!");
+							OCEAN_SET_FAILED(validation);
+							break;
+						}
+
+						OCEAN_EXPECT_TRUE(validation, validateY_UV12ToRGBResized(sourceFrame, targetFrame, alphaValue));
+
+						if (performanceIteration && useWorker == nullptr && targetPixelFormat == FrameType::FORMAT_RGB24)
+						{
+							// the conventional approach: conversion with full resolution, followed by a resize
+
+							Frame intermediateFrame(FrameType(sourceFrame, FrameType::FORMAT_RGB24));
+							Frame resizedFrame(FrameType(intermediateFrame, targetWidth, targetHeight));
+
+							performanceTwoStepsSinglecore.start();
+
+							if (limitedRange)
+							{
+								CV::FrameConverterY_UV12::convertY_UV12LimitedRangeToRGB24FullRange(sourceFrame.constdata<uint8_t>(0u), sourceFrame.constdata<uint8_t>(1u), intermediateFrame.data<uint8_t>(), sourceWidth, sourceHeight, CV::FrameConverter::CONVERT_NORMAL, sourceFrame.paddingElements(0u), sourceFrame.paddingElements(1u), intermediateFrame.paddingElements());
+							}
+							else
+							{
+								CV::FrameConverterY_UV12::convertY_UV12FullRangeToRGB24FullRange(sourceFrame.constdata<uint8_t>(0u), sourceFrame.constdata<uint8_t>(1u), intermediateFrame.data<uint8_t>(), sourceWidth, sourceHeight, CV::FrameConverter::CONVERT_NORMAL, sourceFrame.paddingElements(0u), sourceFrame.paddingElements(1u), intermediateFrame.paddingElements());
+							}
+
+							CV::FrameInterpolatorBilinear::resize<uint8_t, 3u>(intermediateFrame.constdata<uint8_t>(), resizedFrame.data<uint8_t>(), sourceWidth, sourceHeight, targetWidth, targetHeight, intermediateFrame.paddingElements(), resizedFrame.paddingElements());
+
+							performanceTwoStepsSinglecore.stop();
+						}
+					}
+				}
+				while (!startTimestamp.hasTimePassed(testDuration));
+			}
+
+			if (performanceTwoStepsSinglecore.measurements() != 0u)
+			{
+				Log::info() << "Conversion and resize singlecore performance: Best: " << String::toAString(performanceTwoStepsSinglecore.bestMseconds(), 2u) << "ms, worst: " << String::toAString(performanceTwoStepsSinglecore.worstMseconds(), 2u) << "ms, average: " << String::toAString(performanceTwoStepsSinglecore.averageMseconds(), 2u) << "ms";
+			}
+
+			Log::info() << "Singlecore performance: Best: " << String::toAString(performanceSinglecore.bestMseconds(), 2u) << "ms, worst: " << String::toAString(performanceSinglecore.worstMseconds(), 2u) << "ms, average: " << String::toAString(performanceSinglecore.averageMseconds(), 2u) << "ms";
+
+			if (performanceMulticore.measurements() != 0u)
+			{
+				Log::info() << "Multicore performance: Best: " << String::toAString(performanceMulticore.bestMseconds(), 2u) << "ms, worst: " << String::toAString(performanceMulticore.worstMseconds(), 2u) << "ms, average: " << String::toAString(performanceMulticore.averageMseconds(), 2u) << "ms";
+				Log::info() << "Multicore boost: Best: " << String::toAString(performanceSinglecore.best() / performanceMulticore.best(), 1u) << "x, worst: " << String::toAString(performanceSinglecore.worst() / performanceMulticore.worst(), 1u) << "x, average: " << String::toAString(performanceSinglecore.average() / performanceMulticore.average(), 1u) << "x";
+			}
+
+			Log::info() << " ";
+		}
+	}
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
+bool TestFrameConverterY_UV12::validateY_UV12ToRGBResized(const Frame& source, const Frame& target, const uint8_t alphaValue)
+{
+	ocean_assert(source.isValid() && target.isValid());
+	ocean_assert(source.numberPlanes() == 2u);
+
+	const bool limitedRange = source.pixelFormat() == FrameType::FORMAT_Y_UV12_LIMITED_RANGE;
+
+	const MatrixD transformationMatrix = limitedRange ? CV::FrameConverter::transformationMatrix_LimitedRangeYUV24_To_FullRangeRGB24_BT601() : CV::FrameConverter::transformationMatrix_FullRangeYUV24_To_FullRangeRGB24_BT601();
+	ocean_assert(transformationMatrix.rows() == 3 && transformationMatrix.columns() == 4);
+
+	const unsigned int uvWidth = source.width() / 2u;
+	const unsigned int uvHeight = source.height() / 2u;
+
+	// bilinear interpolation of one channel of a plane, with the same sub-pixel mapping as used in FrameInterpolatorBilinear::resize()
+
+	const auto interpolate = [&source](const unsigned int planeIndex, const unsigned int planeWidth, const unsigned int planeHeight, const unsigned int channelIndex, const double x, const double y)
+	{
+		const double sx = minmax(0.0, x, double(planeWidth - 1u));
+		const double sy = minmax(0.0, y, double(planeHeight - 1u));
+
+		const unsigned int left = (unsigned int)(sx);
+		const unsigned int top = (unsigned int)(sy);
+		const unsigned int right = std::min(left + 1u, planeWidth - 1u);
+		const unsigned int bottom = std::min(top + 1u, planeHeight - 1u);
+
+		const double factorRight = sx - double(left);
+		const double factorBottom = sy - double(top);
+
+		const double topValue = double(source.constpixel<uint8_t>(left, top, planeIndex)[channelIndex]) * (1.0 - factorRight) + double(source.constpixel<uint8_t>(right, top, planeIndex)[channelIndex]) * factorRight;
+		const double bottomValue = double(source.constpixel<uint8_t>(left, bottom, planeIndex)[channelIndex]) * (1.0 - factorRight) + double(source.constpixel<uint8_t>(right, bottom, planeIndex)[channelIndex]) * factorRight;
+
+		return topValue * (1.0 - factorBottom) + bottomValue * factorBottom;
+	};
+
+	const double sourceX_s_targetX = double(source.width()) / double(target.width());
+	const double sourceY_s_targetY = double(source.height()) / double(target.height());
+
+	// the color space conversion is applied with 6 bit precision (as the conversion without resize), the interpolation adds further rounding errors
+	constexpr double thresholdMaximalErrorToInteger = 8.0;
+
+	for (unsigned int y = 0u; y < target.height(); ++y)
+	{
+		for (unsigned int x = 0u; x < target.width(); ++x)
+		{
+			const double sx = (double(x) + 0.5) * sourceX_s_targetX - 0.5;
+			const double sy = (double(y) + 0.5) * sourceY_s_targetY - 0.5;
+
+			const double uvSx = (double(x) + 0.5) * sourceX_s_targetX * 0.5 - 0.5;
+			const double uvSy = (double(y) + 0.5) * sourceY_s_targetY * 0.5 - 0.5;
+
+			MatrixD yuv(4, 1);
+			yuv(0, 0) = interpolate(0u, source.width(), source.height(), 0u, sx, sy);
+			yuv(1, 0) = interpolate(1u, uvWidth, uvHeight, 0u, uvSx, uvSy);
+			yuv(2, 0) = interpolate(1u, uvWidth, uvHeight, 1u, uvSx, uvSy);
+			yuv(3, 0) = 1.0;
+
+			const MatrixD rgb = transformationMatrix * yuv;
+
+			const uint8_t* const targetPixel = target.constpixel<uint8_t>(x, y);
+
+			for (unsigned int n = 0u; n < 3u; ++n)
+			{
+				const double expectedValue = NumericD::round64(minmax(0.0, rgb(n, 0), 255.0));
+
+				if (NumericD::abs(expectedValue - double(targetPixel[n])) > thresholdMaximalErrorToInteger)
+				{
+					return false;
+				}
+			}
+
+			if (target.channels() == 4u && targetPixel[3] != alphaValue)
+			{
+				return false;
+			}
+		}
+	}
+
+	return true;
+}
+
 MatrixD TestFrameConverterY_UV12::pixelFunctionY_UV12ForYUV24(const Frame& frame, const unsigned int x, const unsigned int y, const CV::FrameConverter::ConversionFlag conversionFlag)
 {
 	ocean_assert(frame.isValid());
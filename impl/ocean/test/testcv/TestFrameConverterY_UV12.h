@@ -166,8 +166,27 @@ class OCEAN_TEST_CV_EXPORT TestFrameConverterY_UV12
 		 */
 		static bool testY_UV12ToY_U_V12(const unsigned int width, const unsigned int height, const CV::FrameConverter::ConversionFlag conversionFlag, const double testDuration, Worker& worker);
 
+		/**
+		 * Tests the Y_UV12 to RGB24 and RGBA32 conversion fused with a resize.
+		 * @param width The width of the original frame in pixel, with range [2, infinity)
+		 * @param height The height of the original frame in pixel, with range [2, infinity)
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @param worker The worker object to distribute the computation
+		 * @return True, if succeeded
+		 */
+		static bool testY_UV12ToRGBResized(const unsigned int width, const unsigned int height, const double testDuration, Worker& worker);
+
 	protected:
 
+		/**
+		 * Validates the Y_UV12 to RGB24 or RGBA32 conversion fused with a resize.
+		 * @param source The source frame with pixel format Y_UV12_LIMITED_RANGE or Y_UV12_FULL_RANGE, must be valid
+		 * @param target The converted and resized target frame with pixel format RGB24 or RGBA32, must be valid
+		 * @param alphaValue The expected alpha value, ignored for RGB24
+		 * @return True, if succeeded
+		 */
+		static bool validateY_UV12ToRGBResized(const Frame& source, const Frame& target, const uint8_t alphaValue);
+
 		/**
 		 * Extracts one pixel from a Y_UV12 source frame.
 		 * @param frame The frame from which the pixel will be extracted, must be valid
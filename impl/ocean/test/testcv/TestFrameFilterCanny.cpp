@@ -13,6 +13,7 @@
 #include "ocean/cv/CVUtilities.h"
 #include "ocean/cv/FrameFilterCanny.h"
 #include "ocean/cv/FrameFilterScharr.h"
+#include "ocean/cv/FrameFilterSobel.h"
 
 #include "ocean/test/TestResult.h"
 #include "ocean/test/TestSelector.h"
@@ -55,6 +56,17 @@ bool TestFrameFilterCanny::test(const unsigned int width, const unsigned int hei
 
 	Log::info() << " ";
 
+	if (selector.shouldRun("filtercannysobel"))
+	{
+		testResult = testFilterCannySobel<int8_t>(width, height, testDuration, worker);
+		Log::info() << " ";
+		testResult = testFilterCannySobel<int16_t>(width, height, testDuration, worker);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
 	if (selector.shouldRun("filtercannyscharr"))
 	{
 		testResult = testFilterCannyScharr<int8_t>(width, height, testDuration, worker);
@@ -75,6 +87,18 @@ bool TestFrameFilterCanny::test(const unsigned int width, const unsigned int hei
 
 #ifdef OCEAN_USE_GTEST
 
+TEST(TestFrameFilterCanny, FilterCannySobelNormalized)
+{
+	Worker worker;
+	EXPECT_TRUE(TestFrameFilterCanny::testFilterCannySobel<int8_t>(1920u, 1080u, GTEST_TEST_DURATION, worker));
+}
+
+TEST(TestFrameFilterCanny, FilterCannySobel)
+{
+	Worker worker;
+	EXPECT_TRUE(TestFrameFilterCanny::testFilterCannySobel<int16_t>(1920u, 1080u, GTEST_TEST_DURATION, worker));
+}
+
 TEST(TestFrameFilterCanny, FilterCannyScharrNormalized)
 {
 	Worker worker;
@@ -89,15 +113,27 @@ TEST(TestFrameFilterCanny, FilterCannyScharr)
 
 #endif // OCEAN_USE_GTEST
 
+template <typename TFilter>
+bool TestFrameFilterCanny::testFilterCannySobel(const unsigned int performanceWidth, const unsigned int performanceHeight, const double testDuration, Worker& worker)
+{
+	return testFilterCanny<TFilter, false>(performanceWidth, performanceHeight, testDuration, worker);
+}
+
 template <typename TFilter>
 bool TestFrameFilterCanny::testFilterCannyScharr(const unsigned int performanceWidth, const unsigned int performanceHeight, const double testDuration, Worker& worker)
+{
+	return testFilterCanny<TFilter, true>(performanceWidth, performanceHeight, testDuration, worker);
+}
+
+template <typename TFilter, bool tScharr>
+bool TestFrameFilterCanny::testFilterCanny(const unsigned int performanceWidth, const unsigned int performanceHeight, const double testDuration, Worker& worker)
 {
 	static_assert(std::is_same<TFilter, int8_t>::value || std::is_same<TFilter, int16_t>::value, "Invalid type for TFilter");
 
 	ocean_assert(performanceWidth != 0u && performanceHeight != 0u);
 	ocean_assert(testDuration > 0.0);
 
-	Log::info() << "Testing Canny edge detector with Scharr filter" << (std::is_same<TFilter, int8_t>::value ? " (normalized)" : "") << ":";
+	Log::info() << "Testing Canny edge detector with " << (tScharr ? "Scharr" : "Sobel") << " filter" << (std::is_same<TFilter, int8_t>::value ? " (normalized)" : "") << ":";
 
 	HighPerformanceStatistic performanceSinglecore;
 	HighPerformanceStatistic performanceMulticore;
@@ -107,7 +143,7 @@ bool TestFrameFilterCanny::testFilterCannyScharr(const unsigned int performanceW
 
 	const unsigned int maxWorkerIterations = worker ? 2u : 1u;
 
-	constexpr unsigned int maxThreshold = TFilter(std::is_same<TFilter, int8_t>::value ? 127u : 4080u);
+	constexpr unsigned int maxThreshold = TFilter(std::is_same<TFilter, int8_t>::value ? 127u : (tScharr ? 4080u : 1020u));
 	constexpr unsigned int maxThreshold_2 = maxThreshold / 2u;
 
 	for (const bool performanceIteration : {true, false})
@@ -142,20 +178,38 @@ bool TestFrameFilterCanny::testFilterCannyScharr(const unsigned int performanceW
 
 				const Frame clonedTarget(target, Frame::ACM_COPY_KEEP_LAYOUT_COPY_PADDING_DATA);
 
-				if (std::is_same<TFilter, int8_t>::value)
+				if constexpr (std::is_same<TFilter, int8_t>::value)
 				{
 					ocean_assert(highThreshold <= 127u);
 
 					performance.startIf(performanceIteration);
-					CV::FrameFilterCanny::filterCannyScharrNormalized(source.constdata<uint8_t>(), target.data<uint8_t>(), source.width(), source.height(), source.paddingElements(), target.paddingElements(), int8_t(lowThreshold), int8_t(highThreshold), useWorker);
+
+					if constexpr (tScharr)
+					{
+						CV::FrameFilterCanny::filterCannyScharrNormalized(source.constdata<uint8_t>(), target.data<uint8_t>(), source.width(), source.height(), source.paddingElements(), target.paddingElements(), int8_t(lowThreshold), int8_t(highThreshold), useWorker);
+					}
+					else
+					{
+						CV::FrameFilterCanny::filterCannySobelNormalized(source.constdata<uint8_t>(), target.data<uint8_t>(), source.width(), source.height(), source.paddingElements(), target.paddingElements(), int8_t(lowThreshold), int8_t(highThreshold), useWorker);
+					}
+
 					performance.stopIf(performanceIteration);
 				}
 				else
 				{
-					ocean_assert(highThreshold <= 4080u);
+					ocean_assert(highThreshold <= maxThreshold);
 
 					performance.startIf(performanceIteration);
-					CV::FrameFilterCanny::filterCannyScharr(source.constdata<uint8_t>(), target.data<uint8_t>(), source.width(), source.height(), source.paddingElements(), target.paddingElements(), int16_t(lowThreshold), int16_t(highThreshold), useWorker);
+
+					if constexpr (tScharr)
+					{
+						CV::FrameFilterCanny::filterCannyScharr(source.constdata<uint8_t>(), target.data<uint8_t>(), source.width(), source.height(), source.paddingElements(), target.paddingElements(), int16_t(lowThreshold), int16_t(highThreshold), useWorker);
+					}
+					else
+					{
+						CV::FrameFilterCanny::filterCannySobel(source.constdata<uint8_t>(), target.data<uint8_t>(), source.width(), source.height(), source.paddingElements(), target.paddingElements(), int16_t(lowThreshold), int16_t(highThreshold), useWorker);
+					}
+
 					performance.stopIf(performanceIteration);
 				}
 
@@ -166,7 +220,7 @@ bool TestFrameFilterCanny::testFilterCannyScharr(const unsigned int performanceW
 					return false;
 				}
 
-				OCEAN_EXPECT_TRUE(validation, validationCannyFilterScharr(source, target, TFilter(lowThreshold), TFilter(highThreshold)));
+				OCEAN_EXPECT_TRUE(validation, (validationCannyFilter<TFilter, tScharr>(source, target, TFilter(lowThreshold), TFilter(highThreshold))));
 			}
 			while (!startTimestamp.hasTimePassed(testDuration));
 		}
@@ -185,8 +239,8 @@ bool TestFrameFilterCanny::testFilterCannyScharr(const unsigned int performanceW
 	return validation.succeeded();
 }
 
-template <typename TFilter>
-bool TestFrameFilterCanny::validationCannyFilterScharr(const Frame& original, const Frame& filtered, const TFilter lowThreshold, const TFilter highThreshold)
+template <typename TFilter, bool tScharr>
+bool TestFrameFilterCanny::validationCannyFilter(const Frame& original, const Frame& filtered, const TFilter lowThreshold, const TFilter highThreshold)
 {
 	static_assert((std::is_same<uint8_t, uint8_t>::value && std::is_same<TFilter, int8_t>::value) || (std::is_same<uint8_t, uint8_t>::value && std::is_same<TFilter, int16_t>::value), "Invalid data types");
 
@@ -201,7 +255,15 @@ bool TestFrameFilterCanny::validationCannyFilterScharr(const Frame& original, co
 	memset(filterResponses.data(), 0x00, filterResponses.size());
 
 	constexpr unsigned int filterResponsePaddingElements = 0u;
-	CV::FrameFilterScharr::filter8BitPerChannel<TFilter, 1u>(original.constdata<uint8_t>(), (TFilter*)filterResponses.data(), width, height, original.paddingElements(), filterResponsePaddingElements, nullptr);
+
+	if constexpr (tScharr)
+	{
+		CV::FrameFilterScharr::filter8BitPerChannel<TFilter, 1u>(original.constdata<uint8_t>(), (TFilter*)filterResponses.data(), width, height, original.paddingElements(), filterResponsePaddingElements, nullptr);
+	}
+	else
+	{
+		CV::FrameFilterSobel::filter8BitPerChannel<TFilter, 1u>(original.constdata<uint8_t>(), (TFilter*)filterResponses.data(), width, height, original.paddingElements(), filterResponsePaddingElements, nullptr);
+	}
 
 	const TFilter* filterResponsesData = (const TFilter*)filterResponses.data();
 
@@ -42,6 +42,18 @@ class OCEAN_TEST_CV_EXPORT TestFrameFilterCanny
 		 */
 		static bool test(const unsigned int width, const unsigned int height, const double testDuration, Worker& worker, const TestSelector& selector = TestSelector());
 
+		/**
+		 * Tests the Canny edge detector with a Sobel filter
+		 * @param performanceWidth The width of the test frame in pixels used for performance measurements, with range [3, infinity)
+		 * @param performanceHeight The height of the test frame in pixels used for performance measurements, with range [3, infinity)
+		 * @param testDuration The number of seconds for each test, with range (0, infinity)
+		 * @param worker The worker object
+		 * @return True, if succeeded
+		 * @tparam TFilter The underlying type for responses of the Sobel filter, may be either `int8_t` or `int16_t`.
+		 */
+		template <typename TFilter>
+		static bool testFilterCannySobel(const unsigned int performanceWidth, const unsigned int performanceHeight, const double testDuration, Worker& worker);
+
 		/**
 		 * Tests the Canny edge detector with a Scharr filter
 		 * @param performanceWidth The width of the test frame in pixels used for performance measurements, with range [3, infinity)
@@ -54,17 +66,33 @@ class OCEAN_TEST_CV_EXPORT TestFrameFilterCanny
 		template <typename TFilter>
 		static bool testFilterCannyScharr(const unsigned int performanceWidth, const unsigned int performanceHeight, const double testDuration, Worker& worker);
 
+	protected:
+
 		/**
-		 * Validates the result of the Canny edge detector with Scharr filter.
+		 * Tests the Canny edge detector with a Sobel or Scharr filter
+		 * @param performanceWidth The width of the test frame in pixels used for performance measurements, with range [3, infinity)
+		 * @param performanceHeight The height of the test frame in pixels used for performance measurements, with range [3, infinity)
+		 * @param testDuration The number of seconds for each test, with range (0, infinity)
+		 * @param worker The worker object
+		 * @return True, if succeeded
+		 * @tparam TFilter The underlying type for responses of the filter, may be either `int8_t` or `int16_t`.
+		 * @tparam tScharr True, to test the Canny edge detector with Scharr filter; False, to test the detector with Sobel filter
+		 */
+		template <typename TFilter, bool tScharr>
+		static bool testFilterCanny(const unsigned int performanceWidth, const unsigned int performanceHeight, const double testDuration, Worker& worker);
+
+		/**
+		 * Validates the result of the Canny edge detector with Sobel or Scharr filter.
 		 * @param original The original gray scale image, must be valid
 		 * @param filtered The filtered gray scale image, must be valid
 		 * @param lowThreshold The threshold below which edge candidates are immediately rejected, range: [0, highTreshold)
-		 * @param highThreshold The threshold above which edge candidates, which are also local maxima, are immediately accepted as a strong edge, range: (lowThreshold, maxThreshold] where maxThreshold is 127 for TFilter=int8_t and 4080 for TFilter=int16_t
+		 * @param highThreshold The threshold above which edge candidates, which are also local maxima, are immediately accepted as a strong edge, range: (lowThreshold, maxThreshold] where maxThreshold is 127 for TFilter=int8_t and 1020 (Sobel) or 4080 (Scharr) for TFilter=int16_t
 		 * @return True, if succeeded
-		 * @tparam TFilter The underlying type for responses of the Scharr filter, may be either `int8_t` or `int16_t`.
+		 * @tparam TFilter The underlying type for responses of the filter, may be either `int8_t` or `int16_t`.
+		 * @tparam tScharr True, if the Canny edge detector with Scharr filter was applied; False, if Sobel filter was applied
 		 */
-		template <typename TFilter>
-		static bool validationCannyFilterScharr(const Frame& original, const Frame& filtered, const TFilter lowThreshold, const TFilter highThreshold);
+		template <typename TFilter, bool tScharr>
+		static bool validationCannyFilter(const Frame& original, const Frame& filtered, const TFilter lowThreshold, const TFilter highThreshold);
 };
 
 }
@@ -88,6 +88,15 @@ bool TestFrameFilterErosion::test(const unsigned int width, const unsigned int h
 		Log::info() << " ";
 	}
 
+	if (selector.shouldRun("8bitsquare"))
+	{
+		testResult = test8BitSquare(width, height, testDuration, worker);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
 	if (selector.shouldRun("8bit"))
 	{
 		testResult = test8Bit(width, height, testDuration, worker);
@@ -190,6 +199,12 @@ TEST(TestFrameFilterErosion, Filter8Bit24Neighbor_1920x1080u)
 }
 
 
+TEST(TestFrameFilterErosion, Filter8BitSquare_1920x1080u)
+{
+	Worker worker;
+	EXPECT_TRUE(TestFrameFilterErosion::test8BitSquare(1920u, 1080u, GTEST_TEST_DURATION, worker));
+}
+
 TEST(TestFrameFilterErosion, Filter8Bit_1920x1080u)
 {
 	Worker worker;
@@ -621,6 +636,93 @@ bool TestFrameFilterErosion::test8Bit24Neighbor(const unsigned int width, const
 	return validation.succeeded();
 }
 
+bool TestFrameFilterErosion::test8BitSquare(const unsigned int width, const unsigned int height, const double testDuration, Worker& worker)
+{
+	ocean_assert(width >= 1u && height >= 1u);
+
+	constexpr unsigned int benchmarkFilterSize = 21u;
+
+	Log::info() << "Testing 8 bit binary erosion with arbitrary square kernels for " << width << "x" << height << " image (benchmark with kernel " << benchmarkFilterSize << "x" << benchmarkFilterSize << "):";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	HighPerformanceStatistic performanceSinglecore;
+	HighPerformanceStatistic performanceMulticore;
+
+	const unsigned int maxWorkerIterations = worker ? 2u : 1u;
+
+	for (unsigned int workerIteration = 0u; workerIteration < maxWorkerIterations; ++workerIteration)
+	{
+		Worker* useWorker = (workerIteration == 0u) ? nullptr : &worker;
+		HighPerformanceStatistic& performance = useWorker ? performanceMulticore : performanceSinglecore;
+
+		Timestamp startTimestamp(true);
+
+		do
+		{
+			for (const bool benchmarkIteration : {true, false})
+			{
+				const unsigned int testWidth = benchmarkIteration ? width : RandomI::random(randomGenerator, 1u, 200u);
+				const unsigned int testHeight = benchmarkIteration ? height : RandomI::random(randomGenerator, 1u, 200u);
+
+				const unsigned int filterSize = benchmarkIteration ? benchmarkFilterSize : RandomI::random(randomGenerator, 0u, 32u) * 2u + 1u;
+
+				const uint8_t maskValue = uint8_t(RandomI::random(randomGenerator, 0u, 255u));
+
+				const unsigned int maskPaddingElements = RandomI::random(randomGenerator, 1u, 100u) * RandomI::random(randomGenerator, 1u);
+				const unsigned int targetPaddingElements = RandomI::random(randomGenerator, 1u, 100u) * RandomI::random(randomGenerator, 1u);
+
+				Frame mask(FrameType(testWidth, testHeight, FrameType::FORMAT_Y8, FrameType::ORIGIN_UPPER_LEFT), maskPaddingElements);
+				Frame target(mask.frameType(), targetPaddingElements);
+
+				for (unsigned int y = 0u; y < mask.height(); ++y)
+				{
+					uint8_t* const maskRow = mask.row<uint8_t>(y);
+
+					for (unsigned int x = 0u; x < mask.width(); ++x)
+					{
+						// sparse non-mask pixels to avoid trivial results with large kernels
+						maskRow[x] = RandomI::random(randomGenerator, 50u) == 0u ? uint8_t(255u - maskValue) : maskValue;
+					}
+				}
+
+				CV::CVUtilities::randomizeFrame(target, false, &randomGenerator);
+
+				const Frame copyMask(mask, Frame::ACM_COPY_KEEP_LAYOUT_COPY_PADDING_DATA);
+				const Frame copyTarget(target, Frame::ACM_COPY_KEEP_LAYOUT_COPY_PADDING_DATA);
+
+				performance.startIf(benchmarkIteration);
+					CV::FrameFilterErosion::filter1Channel8BitSquare(mask.constdata<uint8_t>(), target.data<uint8_t>(), mask.width(), mask.height(), filterSize, maskValue, mask.paddingElements(), target.paddingElements(), useWorker);
+				performance.stopIf(benchmarkIteration);
+
+				if (!CV::CVUtilities::isPaddingMemoryIdentical(mask, copyMask) || !CV::CVUtilities::isPaddingMemoryIdentical(target, copyTarget))
+				{
+					OCEAN_SET_FAILED(validation);
+				}
+
+				if (!validate8BitSquareKernel(mask.constdata<uint8_t>(), target.constdata<uint8_t>(), mask.width(), mask.height(), filterSize, maskValue, mask.paddingElements(), target.paddingElements()))
+				{
+					OCEAN_SET_FAILED(validation);
+				}
+			}
+		}
+		while (!startTimestamp.hasTimePassed(testDuration));
+	}
+
+	Log::info() << "Singlecore performance: Best: " << String::toAString(performanceSinglecore.bestMseconds(), 2u) << "ms, worst: " << String::toAString(performanceSinglecore.worstMseconds(), 2u) << "ms, average: " << String::toAString(performanceSinglecore.averageMseconds(), 2u) << "ms";
+
+	if (performanceMulticore.measurements() != 0u)
+	{
+		Log::info() << "Multicore performance: Best: " << String::toAString(performanceMulticore.bestMseconds(), 2u) << "ms, worst: " << String::toAString(performanceMulticore.worstMseconds(), 2u) << "ms, average: " << String::toAString(performanceMulticore.averageMseconds(), 2u) << "ms";
+		Log::info() << "Multicore boost: Best: " << String::toAString(performanceSinglecore.best() / performanceMulticore.best(), 1u) << "x, worst: " << String::toAString(performanceSinglecore.worst() / performanceMulticore.worst(), 1u) << "x, average: " << String::toAString(performanceSinglecore.average() / performanceMulticore.average(), 1u) << "x";
+	}
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
 bool TestFrameFilterErosion::test8Bit(const unsigned int width, const unsigned int height, const double testDuration, Worker& worker)
 {
 	ocean_assert(width >= 2u && height >= 2u);
@@ -121,6 +121,16 @@ class OCEAN_TEST_CV_EXPORT TestFrameFilterErosion
 		*/
 		static bool test8Bit24Neighbor(const unsigned int width, const unsigned int height, const double testDuration, Worker& worker);
 
+		/**
+		 * Tests the binary 8 bit erosion filter with arbitrary square filters.
+		 * @param width The width of the test frame in pixel, with range [1, infinity)
+		 * @param height The height of the test frame in pixel, with range [1, infinity)
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @param worker The worker object
+		 * @return True, if succeeded
+		 */
+		static bool test8BitSquare(const unsigned int width, const unsigned int height, const double testDuration, Worker& worker);
+
 		/**
 		 * Tests the binary 8 bit erosion filter for square filters and cross filters.
 		 * @param width The width of the test frame in pixel, with range [4, infinity)
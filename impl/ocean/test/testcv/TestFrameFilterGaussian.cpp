@@ -11,6 +11,7 @@
 #include "ocean/base/HighPerformanceTimer.h"
 
 #include "ocean/cv/CVUtilities.h"
+#include "ocean/cv/FrameConverter.h"
 #include "ocean/cv/FrameFilterGaussian.h"
 
 #include "ocean/test/TestResult.h"
@@ -103,6 +104,26 @@ bool TestFrameFilterGaussian::test(const double testDuration, Worker& worker, co
 		Log::info() << " ";
 	}
 
+	if (selector.shouldRun("recursive"))
+	{
+		testResult = testRecursive<uint8_t, uint32_t>(testDuration, worker);
+		Log::info() << " ";
+		testResult = testRecursive<float, float>(testDuration, worker);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
+	if (selector.shouldRun("float16"))
+	{
+		testResult = testFloat16(testDuration, worker);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
 	Log::info() << " ";
 
 	Log::info() << testResult;
@@ -261,6 +282,26 @@ TEST(TestFrameFilterGaussian, Inplace_float)
 	EXPECT_TRUE((TestFrameFilterGaussian::testInplace<float, float>(GTEST_TEST_DURATION, worker)));
 }
 
+
+TEST(TestFrameFilterGaussian, Recursive_uint8)
+{
+	Worker worker;
+	EXPECT_TRUE((TestFrameFilterGaussian::testRecursive<uint8_t, uint32_t>(GTEST_TEST_DURATION, worker)));
+}
+
+TEST(TestFrameFilterGaussian, Recursive_float)
+{
+	Worker worker;
+	EXPECT_TRUE((TestFrameFilterGaussian::testRecursive<float, float>(GTEST_TEST_DURATION, worker)));
+}
+
+
+TEST(TestFrameFilterGaussian, Float16)
+{
+	Worker worker;
+	EXPECT_TRUE(TestFrameFilterGaussian::testFloat16(GTEST_TEST_DURATION, worker));
+}
+
 #endif // OCEAN_USE_GTEST
 
 bool TestFrameFilterGaussian::testFilterSizeSigmaConversion()
@@ -889,6 +930,284 @@ bool TestFrameFilterGaussian::testInplace(const double testDuration, Worker& wor
 	return validation.succeeded();
 }
 
+template <typename T, typename TFilter>
+bool TestFrameFilterGaussian::testRecursive(const double testDuration, Worker& worker)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Testing recursive filtering '" << TypeNamer::name<T>() << "':";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	HighPerformanceStatistic performanceKernel;
+	HighPerformanceStatistic performanceRecursiveSinglecore;
+	HighPerformanceStatistic performanceRecursiveMulticore;
+
+	constexpr float performanceSigma = 8.0f;
+
+	double sumAbsoluteError = 0.0;
+	size_t numberErrors = 0;
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		// performance for a fixed large sigma, for which the kernel-based filter is expensive
+
+		{
+			const unsigned int channels = RandomI::random(randomGenerator, 1u, 4u);
+
+			const Frame frame = CV::CVUtilities::randomizedFrame(FrameType(1280u, 720u, FrameType::genericPixelFormat<T>(channels), FrameType::ORIGIN_UPPER_LEFT), &randomGenerator);
+
+			Frame kernelFrame;
+			Frame recursiveFrameSinglecore;
+			Frame recursiveFrameMulticore;
+
+			performanceKernel.start();
+				const bool kernelResult = CV::FrameFilterGaussian::filter(frame, kernelFrame, performanceSigma, CV::FrameFilterGaussian::FI_KERNEL, &worker);
+			performanceKernel.stop();
+
+			performanceRecursiveSinglecore.start();
+				const bool singlecoreResult = CV::FrameFilterGaussian::filter(frame, recursiveFrameSinglecore, performanceSigma, CV::FrameFilterGaussian::FI_RECURSIVE, nullptr);
+			performanceRecursiveSinglecore.stop();
+
+			performanceRecursiveMulticore.start();
+				const bool multicoreResult = CV::FrameFilterGaussian::filter(frame, recursiveFrameMulticore, performanceSigma, CV::FrameFilterGaussian::FI_RECURSIVE, &worker);
+			performanceRecursiveMulticore.stop();
+
+			OCEAN_EXPECT_TRUE(validation, kernelResult && singlecoreResult && multicoreResult);
+
+			// the result must not depend on the number of threads
+
+			if (singlecoreResult && multicoreResult)
+			{
+				for (unsigned int y = 0u; y < frame.height(); ++y)
+				{
+					OCEAN_EXPECT_EQUAL(validation, memcmp(recursiveFrameSinglecore.constrow<void>(y), recursiveFrameMulticore.constrow<void>(y), frame.planeWidthBytes(0u)), 0);
+				}
+			}
+		}
+
+		// the recursive filter is intended for large sigmas, for small sigmas the approximation error is significantly larger
+
+		const float sigma = RandomF::scalar(randomGenerator, 2.5f, 16.0f);
+		const unsigned int filterSize = CV::FrameFilterGaussian::sigma2filterSize(sigma);
+
+		const unsigned int width = RandomI::random(randomGenerator, filterSize, 400u);
+		const unsigned int height = RandomI::random(randomGenerator, filterSize, 400u);
+
+		const unsigned int channels = RandomI::random(randomGenerator, 1u, 4u);
+
+		const Frame frame = CV::CVUtilities::randomizedFrame(FrameType(width, height, FrameType::genericPixelFormat<T>(channels), FrameType::ORIGIN_UPPER_LEFT), &randomGenerator);
+
+		Frame targetFrame = CV::CVUtilities::randomizedFrame(frame.frameType(), &randomGenerator);
+		const Frame copyTargetFrame(targetFrame, Frame::ACM_COPY_KEEP_LAYOUT_COPY_PADDING_DATA);
+
+		Worker* useWorker = Random::boolean(randomGenerator) ? &worker : nullptr;
+
+		CV::FrameFilterGaussian::ReusableMemory reusableMemory;
+		CV::FrameFilterGaussian::ReusableMemory* useReusableMemory = Random::boolean(randomGenerator) ? &reusableMemory : nullptr;
+
+		if (!CV::FrameFilterGaussian::filterRecursive<T>(frame.constdata<T>(), targetFrame.data<T>(), width, height, channels, frame.paddingElements(), targetFrame.paddingElements(), sigma, useWorker, useReusableMemory))
+		{
+			OCEAN_SET_FAILED(validation);
+		}
+
+		if (!CV::CVUtilities::isPaddingMemoryIdentical(targetFrame, copyTargetFrame))
+		{
+			ocean_assert(false && "Invalid padding memory!");
+			return false;
+		}
+
+		// the recursive filter approximates the Gaussian, so we compare the result with the kernel-based filter away from the frame border
+
+		Frame kernelFrame(frame.frameType());
+
+		if (!CV::FrameFilterGaussian::filter<T, TFilter>(frame.constdata<T>(), kernelFrame.data<T>(), width, height, channels, frame.paddingElements(), kernelFrame.paddingElements(), filterSize, filterSize, sigma, useWorker))
+		{
+			OCEAN_SET_FAILED(validation);
+		}
+
+		const unsigned int border = filterSize / 2u;
+
+		for (unsigned int y = border; y + border < height; ++y)
+		{
+			for (unsigned int x = border; x + border < width; ++x)
+			{
+				const T* recursivePixel = targetFrame.constpixel<T>(x, y);
+				const T* kernelPixel = kernelFrame.constpixel<T>(x, y);
+
+				for (unsigned int c = 0u; c < channels; ++c)
+				{
+					const double absoluteError = NumericD::abs(double(recursivePixel[c]) - double(kernelPixel[c]));
+
+					// the random frames have a value range of [0, 255] for both data types
+
+					const double maximalAbsoluteError = std::is_same<T, uint8_t>::value ? 4.5 : 4.0;
+
+					if (absoluteError > maximalAbsoluteError)
+					{
+						OCEAN_SET_FAILED(validation);
+					}
+
+					sumAbsoluteError += absoluteError;
+					++numberErrors;
+				}
+			}
+		}
+
+		// a constant frame must stay constant, also at the frame border
+
+		{
+			const T constantValue = T(RandomI::random(randomGenerator, 255u));
+
+			const std::vector<T> constantPixel(channels, constantValue);
+
+			const double maximalConstantError = std::is_same<T, uint8_t>::value ? 0.0 : 0.25;
+
+			Frame inplaceFrame(frame.frameType());
+			inplaceFrame.setValue<T>(constantPixel.data(), constantPixel.size());
+
+			if (!CV::FrameFilterGaussian::filterRecursive<T>(inplaceFrame.constdata<T>(), inplaceFrame.data<T>(), width, height, channels, inplaceFrame.paddingElements(), inplaceFrame.paddingElements(), sigma, useWorker))
+			{
+				OCEAN_SET_FAILED(validation);
+			}
+
+			for (unsigned int y = 0u; y < height; ++y)
+			{
+				for (unsigned int x = 0u; x < width; ++x)
+				{
+					const T* pixel = inplaceFrame.constpixel<T>(x, y);
+
+					for (unsigned int c = 0u; c < channels; ++c)
+					{
+						// the feedback of the recursive filter accumulates floating point rounding errors
+
+						if (NumericD::abs(double(pixel[c]) - double(constantValue)) > maximalConstantError)
+						{
+							OCEAN_SET_FAILED(validation);
+						}
+					}
+				}
+			}
+		}
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	ocean_assert(numberErrors != 0);
+	const double averageAbsoluteError = sumAbsoluteError / double(std::max(numberErrors, size_t(1)));
+
+	Log::info() << "Kernel-based filter with sigma " << String::toAString(performanceSigma, 1u) << ": " << performanceKernel.averageMseconds() << "ms";
+	Log::info() << "Recursive filter with sigma " << String::toAString(performanceSigma, 1u) << ", singlecore: " << performanceRecursiveSinglecore.averageMseconds() << "ms";
+	Log::info() << "Recursive filter with sigma " << String::toAString(performanceSigma, 1u) << ", multicore: " << performanceRecursiveMulticore.averageMseconds() << "ms";
+	Log::info() << "Average absolute error compared to the kernel-based filter: " << String::toAString(averageAbsoluteError, 3u);
+
+	if (averageAbsoluteError > 0.5)
+	{
+		OCEAN_SET_FAILED(validation);
+	}
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
+bool TestFrameFilterGaussian::testFloat16(const double testDuration, Worker& worker)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Testing 16-bit float filtering:";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		const unsigned int filterSize = RandomI::random(randomGenerator, 0u, 7u) * 2u + 1u;
+
+		const unsigned int width = RandomI::random(randomGenerator, filterSize, 400u);
+		const unsigned int height = RandomI::random(randomGenerator, filterSize, 400u);
+
+		const unsigned int channels = RandomI::random(randomGenerator, 1u, 4u);
+
+		// the random float frame has a value range of [0, 255], the reference frame holds the same values after the conversion to 16-bit float
+
+		const Frame floatFrame = CV::CVUtilities::randomizedFrame(FrameType(width, height, FrameType::genericPixelFormat<float>(channels), FrameType::ORIGIN_UPPER_LEFT), &randomGenerator);
+
+		Frame float16Frame = CV::CVUtilities::randomizedFrame(FrameType(floatFrame.frameType(), FrameType::genericPixelFormat<Float16>(channels)), &randomGenerator);
+		CV::FrameConverter::cast<float, Float16>(floatFrame.constdata<float>(), float16Frame.data<Float16>(), width, height, channels, floatFrame.paddingElements(), float16Frame.paddingElements());
+
+		Frame referenceFrame = CV::CVUtilities::randomizedFrame(floatFrame.frameType(), &randomGenerator);
+		CV::FrameConverter::cast<Float16, float>(float16Frame.constdata<Float16>(), referenceFrame.data<float>(), width, height, channels, float16Frame.paddingElements(), referenceFrame.paddingElements());
+
+		if (!CV::FrameFilterGaussian::filter<float, float>(referenceFrame.data<float>(), width, height, channels, referenceFrame.paddingElements(), filterSize, filterSize))
+		{
+			OCEAN_SET_FAILED(validation);
+		}
+
+		Frame targetFrame = CV::CVUtilities::randomizedFrame(float16Frame.frameType(), &randomGenerator);
+		const Frame copyTargetFrame(targetFrame, Frame::ACM_COPY_KEEP_LAYOUT_COPY_PADDING_DATA);
+
+		Worker* useWorker = Random::boolean(randomGenerator) ? &worker : nullptr;
+
+		if (!CV::FrameFilterGaussian::filterFloat16(float16Frame.constdata<Float16>(), targetFrame.data<Float16>(), width, height, channels, float16Frame.paddingElements(), targetFrame.paddingElements(), filterSize, filterSize, -1.0f, useWorker))
+		{
+			OCEAN_SET_FAILED(validation);
+		}
+
+		if (!CV::CVUtilities::isPaddingMemoryIdentical(targetFrame, copyTargetFrame))
+		{
+			ocean_assert(false && "Invalid padding memory!");
+			return false;
+		}
+
+		for (unsigned int y = 0u; y < height; ++y)
+		{
+			for (unsigned int x = 0u; x < width; ++x)
+			{
+				const Float16* targetPixel = targetFrame.constpixel<Float16>(x, y);
+				const float* referencePixel = referenceFrame.constpixel<float>(x, y);
+
+				for (unsigned int c = 0u; c < channels; ++c)
+				{
+					// 16-bit floats have 11 significant bits, and the filter may accumulate with 16-bit float precision
+
+					const float maximalError = 0.01f * std::max(1.0f, NumericF::abs(referencePixel[c]));
+
+					if (NumericF::isNotEqual(float(targetPixel[c]), referencePixel[c], maximalError))
+					{
+						OCEAN_SET_FAILED(validation);
+					}
+				}
+			}
+		}
+
+		// the in-place filter must provide the identical result
+
+		Frame inplaceFrame(float16Frame, Frame::ACM_COPY_KEEP_LAYOUT_COPY_PADDING_DATA);
+
+		if (CV::FrameFilterGaussian::filter(inplaceFrame, filterSize, useWorker))
+		{
+			for (unsigned int y = 0u; y < height; ++y)
+			{
+				OCEAN_EXPECT_EQUAL(validation, memcmp(inplaceFrame.constrow<void>(y), targetFrame.constrow<void>(y), targetFrame.planeWidthBytes(0u)), 0);
+			}
+		}
+		else
+		{
+			OCEAN_SET_FAILED(validation);
+		}
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
 }
 
 }
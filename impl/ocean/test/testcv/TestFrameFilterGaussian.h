@@ -123,6 +123,25 @@ class OCEAN_TEST_CV_EXPORT TestFrameFilterGaussian
 		 */
 		template <typename T, typename TFilter>
 		static bool testInplace(const double testDuration, Worker& worker);
+
+		/**
+		 * Tests the recursive Gaussian blur filter by comparing it with the kernel-based filter.
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @param worker The worker object
+		 * @return True, if succeeded
+		 * @tparam T The data type of each pixel channel, e.g., 'uint8_t', or 'float'
+		 * @tparam TFilter The data type of each filter value of the kernel-based filter, e.g., 'unsigned int', or 'float'
+		 */
+		template <typename T, typename TFilter>
+		static bool testRecursive(const double testDuration, Worker& worker);
+
+		/**
+		 * Tests the Gaussian blur filter for frames with 16-bit float elements by comparing it with the filter for 32-bit float elements.
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @param worker The worker object
+		 * @return True, if succeeded
+		 */
+		static bool testFloat16(const double testDuration, Worker& worker);
 };
 
 }
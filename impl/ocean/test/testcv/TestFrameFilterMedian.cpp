@@ -89,6 +89,33 @@ bool TestFrameFilterMedian::test(const unsigned int width, const unsigned int he
 	{
 		testResult = testMedianInPlace<float>(width, height, 3u, testDuration, worker);
 
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
+	if (selector.shouldRun("medianconstanttime_uint8_1channel"))
+	{
+		testResult = testMedianConstantTime(width, height, 1u, testDuration, worker);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
+	if (selector.shouldRun("medianconstanttime_uint8_3channels"))
+	{
+		testResult = testMedianConstantTime(width, height, 3u, testDuration, worker);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
+	if (selector.shouldRun("medianconstanttime_uint8_4channels"))
+	{
+		testResult = testMedianConstantTime(width, height, 4u, testDuration, worker);
+
 		Log::info() << " ";
 	}
 
@@ -272,6 +299,81 @@ TEST(TestFrameFilterMedian, MedianInPlace_float_3Channels_5)
 	EXPECT_TRUE(TestFrameFilterMedian::testMedianInPlace<float>(GTEST_TEST_IMAGE_WIDTH_2, GTEST_TEST_IMAGE_HEIGHT_2, 3u, 5u, GTEST_TEST_DURATION, worker));
 }
 
+TEST(TestFrameFilterMedian, MedianConstantTime_uint8_1Channel_7)
+{
+	Worker worker;
+	EXPECT_TRUE(TestFrameFilterMedian::testMedianConstantTime<1u>(GTEST_TEST_IMAGE_WIDTH_2, GTEST_TEST_IMAGE_HEIGHT_2, 7u, GTEST_TEST_DURATION, worker));
+}
+
+TEST(TestFrameFilterMedian, MedianConstantTime_uint8_1Channel_15)
+{
+	Worker worker;
+	EXPECT_TRUE(TestFrameFilterMedian::testMedianConstantTime<1u>(GTEST_TEST_IMAGE_WIDTH_2, GTEST_TEST_IMAGE_HEIGHT_2, 15u, GTEST_TEST_DURATION, worker));
+}
+
+TEST(TestFrameFilterMedian, MedianConstantTime_uint8_1Channel_31)
+{
+	Worker worker;
+	EXPECT_TRUE(TestFrameFilterMedian::testMedianConstantTime<1u>(GTEST_TEST_IMAGE_WIDTH_2, GTEST_TEST_IMAGE_HEIGHT_2, 31u, GTEST_TEST_DURATION, worker));
+}
+
+
+TEST(TestFrameFilterMedian, MedianConstantTime_uint8_2Channels_7)
+{
+	Worker worker;
+	EXPECT_TRUE(TestFrameFilterMedian::testMedianConstantTime<2u>(GTEST_TEST_IMAGE_WIDTH_2, GTEST_TEST_IMAGE_HEIGHT_2, 7u, GTEST_TEST_DURATION, worker));
+}
+
+TEST(TestFrameFilterMedian, MedianConstantTime_uint8_2Channels_15)
+{
+	Worker worker;
+	EXPECT_TRUE(TestFrameFilterMedian::testMedianConstantTime<2u>(GTEST_TEST_IMAGE_WIDTH_2, GTEST_TEST_IMAGE_HEIGHT_2, 15u, GTEST_TEST_DURATION, worker));
+}
+
+TEST(TestFrameFilterMedian, MedianConstantTime_uint8_2Channels_31)
+{
+	Worker worker;
+	EXPECT_TRUE(TestFrameFilterMedian::testMedianConstantTime<2u>(GTEST_TEST_IMAGE_WIDTH_2, GTEST_TEST_IMAGE_HEIGHT_2, 31u, GTEST_TEST_DURATION, worker));
+}
+
+
+TEST(TestFrameFilterMedian, MedianConstantTime_uint8_3Channels_7)
+{
+	Worker worker;
+	EXPECT_TRUE(TestFrameFilterMedian::testMedianConstantTime<3u>(GTEST_TEST_IMAGE_WIDTH_2, GTEST_TEST_IMAGE_HEIGHT_2, 7u, GTEST_TEST_DURATION, worker));
+}
+
+TEST(TestFrameFilterMedian, MedianConstantTime_uint8_3Channels_15)
+{
+	Worker worker;
+	EXPECT_TRUE(TestFrameFilterMedian::testMedianConstantTime<3u>(GTEST_TEST_IMAGE_WIDTH_2, GTEST_TEST_IMAGE_HEIGHT_2, 15u, GTEST_TEST_DURATION, worker));
+}
+
+TEST(TestFrameFilterMedian, MedianConstantTime_uint8_3Channels_31)
+{
+	Worker worker;
+	EXPECT_TRUE(TestFrameFilterMedian::testMedianConstantTime<3u>(GTEST_TEST_IMAGE_WIDTH_2, GTEST_TEST_IMAGE_HEIGHT_2, 31u, GTEST_TEST_DURATION, worker));
+}
+
+
+TEST(TestFrameFilterMedian, MedianConstantTime_uint8_4Channels_7)
+{
+	Worker worker;
+	EXPECT_TRUE(TestFrameFilterMedian::testMedianConstantTime<4u>(GTEST_TEST_IMAGE_WIDTH_2, GTEST_TEST_IMAGE_HEIGHT_2, 7u, GTEST_TEST_DURATION, worker));
+}
+
+TEST(TestFrameFilterMedian, MedianConstantTime_uint8_4Channels_15)
+{
+	Worker worker;
+	EXPECT_TRUE(TestFrameFilterMedian::testMedianConstantTime<4u>(GTEST_TEST_IMAGE_WIDTH_2, GTEST_TEST_IMAGE_HEIGHT_2, 15u, GTEST_TEST_DURATION, worker));
+}
+
+TEST(TestFrameFilterMedian, MedianConstantTime_uint8_4Channels_31)
+{
+	Worker worker;
+	EXPECT_TRUE(TestFrameFilterMedian::testMedianConstantTime<4u>(GTEST_TEST_IMAGE_WIDTH_2, GTEST_TEST_IMAGE_HEIGHT_2, 31u, GTEST_TEST_DURATION, worker));
+}
+
 #endif // OCEAN_USE_GTEST
 
 template <typename T>
@@ -492,6 +594,127 @@ bool TestFrameFilterMedian::testMedianInPlace(const unsigned int width, const un
 	return validation.succeeded();
 }
 
+bool TestFrameFilterMedian::testMedianConstantTime(const unsigned int width, const unsigned int height, const unsigned int channels, const double testDuration, Worker& worker)
+{
+	ocean_assert(width >= 51u && height >= 51u);
+	ocean_assert(channels >= 1u && channels <= 4u);
+	ocean_assert(testDuration > 0.0);
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	for (const unsigned int filterSize : {7u, 15u, 31u, 51u})
+	{
+		Log::info().newLine(filterSize != 7u);
+		Log::info().newLine(filterSize != 7u);
+
+		switch (channels)
+		{
+			case 1u:
+				OCEAN_EXPECT_TRUE(validation, testMedianConstantTime<1u>(width, height, filterSize, testDuration, worker));
+				break;
+
+			case 2u:
+				OCEAN_EXPECT_TRUE(validation, testMedianConstantTime<2u>(width, height, filterSize, testDuration, worker));
+				break;
+
+			case 3u:
+				OCEAN_EXPECT_TRUE(validation, testMedianConstantTime<3u>(width, height, filterSize, testDuration, worker));
+				break;
+
+			case 4u:
+				OCEAN_EXPECT_TRUE(validation, testMedianConstantTime<4u>(width, height, filterSize, testDuration, worker));
+				break;
+
+			default:
+				ocean_assert(false && "Invalid channel number!");
+				OCEAN_SET_FAILED(validation);
+		}
+	}
+
+	Log::info() << " ";
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
+template <unsigned int tChannels>
+bool TestFrameFilterMedian::testMedianConstantTime(const unsigned int width, const unsigned int height, const unsigned int filterSize, const double testDuration, Worker& worker)
+{
+	ocean_assert(width >= 51u && height >= 51u);
+	ocean_assert(filterSize >= 3u && filterSize <= 51u && filterSize % 2u == 1u);
+	ocean_assert(testDuration > 0.0);
+
+	const unsigned int maxWorkerIterations = worker ? 2u : 1u;
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	Log::info() << "Testing constant-time median for frame size " << width << "x" << height << " with " << tChannels << " channels, and with filter size " << filterSize << ":";
+	Log::info() << " ";
+
+	HighPerformanceStatistic performanceSinglecore;
+	HighPerformanceStatistic performanceMulticore;
+
+	for (unsigned int workerIteration = 0u; workerIteration < maxWorkerIterations; ++workerIteration)
+	{
+		Worker* useWorker = (workerIteration == 0u) ? nullptr : &worker;
+		HighPerformanceStatistic& performance = useWorker ? performanceMulticore : performanceSinglecore;
+
+		const Timestamp startTimestamp(true);
+
+		do
+		{
+			for (const bool performanceIteration : {true, false})
+			{
+				// the validation is expensive for large filters, so that we use small random frames (which may be smaller than the filter)
+				const unsigned int testWidth = performanceIteration ? width : RandomI::random(randomGenerator, filterSize / 2u, 200u);
+				const unsigned int testHeight = performanceIteration ? height : RandomI::random(randomGenerator, filterSize / 2u, 200u);
+
+				const unsigned int sourcePaddingElements = RandomI::random(randomGenerator, 1u, 100u) * RandomI::random(randomGenerator, 1u);
+				const unsigned int targetPaddingElements = RandomI::random(randomGenerator, 1u, 100u) * RandomI::random(randomGenerator, 1u);
+
+				Frame source(FrameType(testWidth, testHeight, FrameType::genericPixelFormat<uint8_t, tChannels>(), FrameType::ORIGIN_UPPER_LEFT), sourcePaddingElements);
+				Frame target(source.frameType(), targetPaddingElements);
+
+				CV::CVUtilities::randomizeFrame(source, false, &randomGenerator);
+				CV::CVUtilities::randomizeFrame(target, false, &randomGenerator);
+
+				const Frame copyTarget(target, Frame::ACM_COPY_KEEP_LAYOUT_COPY_PADDING_DATA);
+
+				performance.startIf(performanceIteration);
+					CV::FrameFilterMedian::filterConstantTime<tChannels>(source.constdata<uint8_t>(), target.data<uint8_t>(), source.width(), source.height(), source.paddingElements(), target.paddingElements(), filterSize, useWorker);
+				performance.stopIf(performanceIteration);
+
+				if (!CV::CVUtilities::isPaddingMemoryIdentical(target, copyTarget))
+				{
+					ocean_assert(false && "Invalid padding memory!");
+					return false;
+				}
+
+				if (!performanceIteration || RandomI::boolean(randomGenerator))
+				{
+					OCEAN_EXPECT_TRUE(validation, validateMedian<uint8_t>(source, target, filterSize));
+				}
+			}
+		}
+		while (!startTimestamp.hasTimePassed(testDuration));
+	}
+
+	Log::info() << "Performance: Best: " << String::toAString(performanceSinglecore.bestMseconds(), 2u) << "ms, worst: " << String::toAString(performanceSinglecore.worstMseconds(), 2u) << "ms, average: " << String::toAString(performanceSinglecore.averageMseconds(), 2u) << "ms, first: " << String::toAString(performanceSinglecore.firstMseconds(), 2u) << "ms";
+
+	if (performanceMulticore.measurements() != 0u)
+	{
+		Log::info() << "Multicore Best: " << String::toAString(performanceMulticore.bestMseconds(), 2u) << "ms, worst: " << String::toAString(performanceMulticore.worstMseconds(), 2u) << "ms, average: " << String::toAString(performanceMulticore.averageMseconds(), 2u) << "ms";
+		Log::info() << "Multicore boost: Best: " << String::toAString(performanceSinglecore.best() / performanceMulticore.best(), 1u) << "x, worst: " << String::toAString(performanceSinglecore.worst() / performanceMulticore.worst(), 1u) << "x, average: " << String::toAString(performanceSinglecore.average() / performanceMulticore.average(), 1u) << "x";
+	}
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
 template <typename T>
 bool TestFrameFilterMedian::validateMedian(const Frame& frame, const Frame& result, const unsigned int filterSize)
 {
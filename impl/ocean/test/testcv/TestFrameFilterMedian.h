@@ -99,6 +99,30 @@ class OCEAN_TEST_CV_EXPORT TestFrameFilterMedian : protected CV::FrameFilterMedi
 		template <typename T>
 		static bool testMedianInPlace(const unsigned int width, const unsigned int height, const unsigned int channels, const unsigned int filterSize, const double testDuration, Worker& worker);
 
+		/**
+		 * Tests the constant-time median filter for 8 bit frames with several filter sizes.
+		 * @param width The width of the input frame in pixel, with range [51, infinity)
+		 * @param height The height of the input frame in pixel, with range [51, infinity)
+		 * @param channels The number of channels the input frame has, with range [1, 4]
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @param worker The worker object
+		 * @return True, if succeeded
+		 */
+		static bool testMedianConstantTime(const unsigned int width, const unsigned int height, const unsigned int channels, const double testDuration, Worker& worker);
+
+		/**
+		 * Tests the constant-time median filter for 8 bit frames.
+		 * @param width The width of the input frame in pixel, with range [51, infinity)
+		 * @param height The height of the input frame in pixel, with range [51, infinity)
+		 * @param filterSize The size of the filter edge in pixel, must be odd with range [3, 51]
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @param worker The worker object
+		 * @return True, if succeeded
+		 * @tparam tChannels The number of channels the input frame has, with range [1, 4]
+		 */
+		template <unsigned int tChannels>
+		static bool testMedianConstantTime(const unsigned int width, const unsigned int height, const unsigned int filterSize, const double testDuration, Worker& worker);
+
 	protected:
 
 		/**
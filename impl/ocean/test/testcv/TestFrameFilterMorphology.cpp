@@ -120,6 +120,14 @@ bool TestFrameFilterMorphology::test(const double testDuration, Worker& worker,
 	{
 		testResult = testNonMaskPixelsUntouchedStress(testDuration, worker);
 		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
+	if (selector.shouldRun("openclosemaskarbitrarysquare"))
+	{
+		testResult = testOpenCloseMaskArbitrarySquare(testDuration, worker);
+		Log::info() << " ";
 	}
 
 	Log::info() << " ";
@@ -193,6 +201,12 @@ TEST(TestFrameFilterMorphology, NonMaskPixelsUntouchedStress)
 	EXPECT_TRUE(TestFrameFilterMorphology::testNonMaskPixelsUntouchedStress(GTEST_TEST_DURATION, worker));
 }
 
+TEST(TestFrameFilterMorphology, OpenCloseMaskArbitrarySquare)
+{
+	Worker worker;
+	EXPECT_TRUE(TestFrameFilterMorphology::testOpenCloseMaskArbitrarySquare(GTEST_TEST_DURATION, worker));
+}
+
 #endif // OCEAN_USE_GTEST
 
 namespace
@@ -730,6 +744,76 @@ bool TestFrameFilterMorphology::testNonMaskPixelsUntouchedStress(const double te
 	return validation.succeeded();
 }
 
+bool TestFrameFilterMorphology::testOpenCloseMaskArbitrarySquare(const double testDuration, Worker& worker)
+{
+	ocean_assert(testDuration > 0.0);
+	Log::info() << "Testing openMask() and closeMask() with arbitrary square kernels:";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	const Timestamp startTimestamp(true);
+	do
+	{
+		const unsigned int width = RandomI::random(randomGenerator, 8u, 128u);
+		const unsigned int height = RandomI::random(randomGenerator, 8u, 128u);
+		const unsigned int paddingElements = RandomI::random(randomGenerator, 0u, 16u);
+		const uint8_t maskValue = uint8_t(RandomI::random(randomGenerator, 0u, 255u));
+
+		const unsigned int iterations = RandomI::random(randomGenerator, 1u, 8u);
+		const unsigned int filterSize = iterations * 2u + 1u;
+
+		const bool open = RandomI::boolean(randomGenerator);
+
+		Worker* useWorker = RandomI::boolean(randomGenerator) ? &worker : nullptr;
+
+		Frame mask = randomBinaryMask(randomGenerator, width, height, paddingElements, maskValue);
+
+		// the ground truth applies the 3x3 filters iteratively
+
+		Frame expectedMask(mask, Frame::ACM_COPY_REMOVE_PADDING_LAYOUT);
+		Frame intermediate(expectedMask.frameType());
+
+		for (const bool erosion : {open, !open})
+		{
+			for (unsigned int n = 0u; n < iterations; ++n)
+			{
+				if (erosion)
+				{
+					CV::FrameFilterErosion::filter1Channel8Bit8Neighbor(expectedMask.constdata<uint8_t>(), intermediate.data<uint8_t>(), width, height, maskValue, expectedMask.paddingElements(), intermediate.paddingElements(), nullptr);
+				}
+				else
+				{
+					CV::FrameFilterDilation::filter1Channel8Bit8Neighbor(expectedMask.constdata<uint8_t>(), intermediate.data<uint8_t>(), width, height, maskValue, expectedMask.paddingElements(), intermediate.paddingElements(), nullptr);
+				}
+
+				std::swap(expectedMask, intermediate);
+			}
+		}
+
+		if (open)
+		{
+			CV::FrameFilterMorphology::openMask(mask.data<uint8_t>(), width, height, mask.paddingElements(), maskValue, filterSize, useWorker);
+		}
+		else
+		{
+			CV::FrameFilterMorphology::closeMask(mask.data<uint8_t>(), width, height, mask.paddingElements(), maskValue, filterSize, useWorker);
+		}
+
+		for (unsigned int y = 0u; y < height; ++y)
+		{
+			if (memcmp(mask.constrow<uint8_t>(y), expectedMask.constrow<uint8_t>(y), width) != 0)
+			{
+				OCEAN_SET_FAILED(validation);
+			}
+		}
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Validation: " << validation;
+	return validation.succeeded();
+}
+
 } // namespace TestCV
 
 } // namespace Test
@@ -129,6 +129,14 @@ class OCEAN_TEST_CV_EXPORT TestFrameFilterMorphology
 		 * @return True, if succeeded
 		 */
 		static bool testNonMaskPixelsUntouchedStress(const double testDuration, Worker& worker);
+
+		/**
+		 * Tests open and close with arbitrary square kernels: the results must be identical to iterated 3x3 filters with the same overall size.
+		 * @param testDuration Number of seconds for the test, with range (0, infinity)
+		 * @param worker Worker object
+		 * @return True, if succeeded
+		 */
+		static bool testOpenCloseMaskArbitrarySquare(const double testDuration, Worker& worker);
 };
 
 }
@@ -77,6 +77,17 @@ bool TestFrameFilterSeparable::test(const double testDuration, Worker& worker, c
 		Log::info() << " ";
 	}
 
+	if (selector.shouldRun("tiledExecution"))
+	{
+		testResult = testTiledExecution<uint8_t, uint32_t>(testDuration, worker);
+		Log::info() << " ";
+		testResult = testTiledExecution<float, float>(testDuration, worker);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
 	if (selector.shouldRun("separableFilterUniversalExtremeResolutions"))
 	{
 		testResult = testSeparableFilterUniversalExtremeResolutions<char>(testDuration, worker);
@@ -314,6 +325,18 @@ TEST(TestFrameFilterSeparable, ReusableMemoryComfort_float)
 	EXPECT_TRUE((TestFrameFilterSeparable::testReusableMemoryComfort<float>(GTEST_TEST_DURATION)));
 }
 
+TEST(TestFrameFilterSeparable, TiledExecution_uint8)
+{
+	Worker worker;
+	EXPECT_TRUE((TestFrameFilterSeparable::testTiledExecution<uint8_t, uint32_t>(GTEST_TEST_DURATION, worker)));
+}
+
+TEST(TestFrameFilterSeparable, TiledExecution_float)
+{
+	Worker worker;
+	EXPECT_TRUE((TestFrameFilterSeparable::testTiledExecution<float, float>(GTEST_TEST_DURATION, worker)));
+}
+
 
 TEST(TestFrameFilterSeparable, SeparableFilterUniversalExtremeResolutionsShort)
 {
@@ -739,6 +762,109 @@ bool TestFrameFilterSeparable::testReusableMemoryComfort(const double testDurati
 	return validation.succeeded();
 }
 
+template <typename T, typename TFilter>
+bool TestFrameFilterSeparable::testTiledExecution(const double testDuration, Worker& worker)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Testing tiled execution for '" << TypeNamer::name<T>() << "' images:";
+	Log::info() << " ";
+
+	// the tiled execution applies the identical kernels, only the border rows are determined with the core kernel on mirrored intermediate rows
+	const double maximalErrorThreshold = std::is_same<T, float>::value ? 0.01 : 1.0;
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	const ProcessorInstructions processorInstructions = Processor::get().instructions();
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		const unsigned int horizontalFilterSize = RandomI::random(randomGenerator, 0u, 7u) * 2u + 1u;
+		const unsigned int verticalFilterSize = RandomI::random(randomGenerator, 0u, 7u) * 2u + 1u;
+
+		const unsigned int width = RandomI::random(randomGenerator, std::max(16u, horizontalFilterSize + 1u), 1920u);
+		const unsigned int height = RandomI::random(randomGenerator, verticalFilterSize, 1080u);
+		const unsigned int channels = RandomI::random(randomGenerator, 1u, 4u);
+
+		const Frame frame = CV::CVUtilities::randomizedFrame(FrameType(width, height, FrameType::genericPixelFormat<T>(channels), FrameType::ORIGIN_UPPER_LEFT), &randomGenerator);
+
+		Frame fullFrameTarget = CV::CVUtilities::randomizedFrame(frame.frameType(), &randomGenerator);
+		Frame tiledTarget = CV::CVUtilities::randomizedFrame(frame.frameType(), &randomGenerator);
+
+		const Frame tiledTargetCopy(tiledTarget, Frame::ACM_COPY_KEEP_LAYOUT_COPY_PADDING_DATA);
+
+		const std::vector<TFilter> horizontalFilter(randomFilter<TFilter>(randomGenerator, horizontalFilterSize));
+		const std::vector<TFilter> verticalFilter(randomFilter<TFilter>(randomGenerator, verticalFilterSize));
+
+		Worker* useWorker = RandomI::boolean(randomGenerator) ? &worker : nullptr;
+
+		OCEAN_EXPECT_TRUE(validation, (CV::FrameFilterSeparable::filter<T, TFilter>(frame.constdata<T>(), fullFrameTarget.data<T>(), width, height, channels, frame.paddingElements(), fullFrameTarget.paddingElements(), horizontalFilter.data(), horizontalFilterSize, verticalFilter.data(), verticalFilterSize, useWorker, nullptr, processorInstructions, CV::FrameFilterSeparable::EM_FULL_FRAME)));
+		OCEAN_EXPECT_TRUE(validation, (CV::FrameFilterSeparable::filter<T, TFilter>(frame.constdata<T>(), tiledTarget.data<T>(), width, height, channels, frame.paddingElements(), tiledTarget.paddingElements(), horizontalFilter.data(), horizontalFilterSize, verticalFilter.data(), verticalFilterSize, useWorker, nullptr, processorInstructions, CV::FrameFilterSeparable::EM_TILED)));
+
+		if (!CV::CVUtilities::isPaddingMemoryIdentical(tiledTarget, tiledTargetCopy))
+		{
+			ocean_assert(false && "Invalid padding memory!");
+			return false;
+		}
+
+		double maximalAbsError = 0.0;
+
+		for (unsigned int y = 0u; y < height; ++y)
+		{
+			const T* const fullFrameRow = fullFrameTarget.constrow<T>(y);
+			const T* const tiledRow = tiledTarget.constrow<T>(y);
+
+			for (unsigned int n = 0u; n < width * channels; ++n)
+			{
+				maximalAbsError = std::max(maximalAbsError, NumericD::abs(double(fullFrameRow[n]) - double(tiledRow[n])));
+			}
+		}
+
+		OCEAN_EXPECT_LESS_EQUAL(validation, maximalAbsError, maximalErrorThreshold);
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	constexpr unsigned int performanceWidth = 3840u;
+	constexpr unsigned int performanceHeight = 2160u;
+
+	constexpr unsigned int filterSize = 7u;
+
+	HighPerformanceStatistic performanceFullFrame;
+	HighPerformanceStatistic performanceTiled;
+
+	const Frame frame = CV::CVUtilities::randomizedFrame(FrameType(performanceWidth, performanceHeight, FrameType::genericPixelFormat<T, 3u>(), FrameType::ORIGIN_UPPER_LEFT), &randomGenerator);
+	Frame target(frame.frameType());
+
+	const std::vector<TFilter> filter(randomFilter<TFilter>(randomGenerator, filterSize));
+
+	CV::FrameFilterSeparable::ReusableMemory reusableMemory;
+
+	const Timestamp performanceStartTimestamp(true);
+
+	do
+	{
+		for (const CV::FrameFilterSeparable::ExecutionMode executionMode : {CV::FrameFilterSeparable::EM_FULL_FRAME, CV::FrameFilterSeparable::EM_TILED})
+		{
+			HighPerformanceStatistic& performance = executionMode == CV::FrameFilterSeparable::EM_TILED ? performanceTiled : performanceFullFrame;
+
+			performance.start();
+				CV::FrameFilterSeparable::filter<T, TFilter>(frame.constdata<T>(), target.data<T>(), frame.width(), frame.height(), frame.channels(), frame.paddingElements(), target.paddingElements(), filter.data(), filterSize, filter.data(), filterSize, nullptr, &reusableMemory, processorInstructions, executionMode);
+			performance.stop();
+		}
+	}
+	while (!performanceStartTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Full frame performance (" << performanceWidth << "x" << performanceHeight << "): Best: " << performanceFullFrame.bestMseconds() << "ms, worst: " << performanceFullFrame.worstMseconds() << "ms, average: " << performanceFullFrame.averageMseconds() << "ms, median: " << performanceFullFrame.medianMseconds() << "ms";
+	Log::info() << "Tiled performance (" << performanceWidth << "x" << performanceHeight << "): Best: " << performanceTiled.bestMseconds() << "ms, worst: " << performanceTiled.worstMseconds() << "ms, average: " << performanceTiled.averageMseconds() << "ms, median: " << performanceTiled.medianMseconds() << "ms";
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
 template <typename T, typename TFilter>
 bool TestFrameFilterSeparable::testFilter8BitPerChannel(const unsigned int width, const unsigned int height, const unsigned int channels, const unsigned int horizontalFilterSize, const unsigned int verticalFilterSize, const double testDuration, Worker& worker)
 {
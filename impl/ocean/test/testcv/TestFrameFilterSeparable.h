@@ -93,6 +93,17 @@ class OCEAN_TEST_CV_EXPORT TestFrameFilterSeparable
 		template <typename T>
 		static bool testReusableMemoryComfort(const double testDuration);
 
+		/**
+		 * Tests the tiled execution of the frame filter by comparing the results with the full-frame execution.
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @param worker The worker object to be used to distribute the computation
+		 * @return True, if succeeded
+		 * @tparam T The data type of each pixel channel, e.g., 'uint8_t', or 'float'
+		 * @tparam TFilter The data type of each filter value, e.g., 'unsigned int', or 'float'
+		 */
+		template <typename T, typename TFilter>
+		static bool testTiledExecution(const double testDuration, Worker& worker);
+
 		/**
 		 * Tests the filter for frame with 8 bit per channel.
 		 * @param width The width of the test frame in pixel, with range [1, infinity)
@@ -12,8 +12,10 @@
 #include "ocean/base/HighPerformanceTimer.h"
 #include "ocean/base/RandomI.h"
 
+#include "ocean/cv/CameraRemapTable.h"
 #include "ocean/cv/Canvas.h"
 #include "ocean/cv/CVUtilities.h"
+#include "ocean/cv/FrameConverter.h"
 #include "ocean/cv/FrameFilterGaussian.h"
 #include "ocean/cv/FrameInterpolatorBilinear.h"
 #include "ocean/cv/IntegralImage.h"
@@ -184,6 +186,15 @@ bool TestFrameInterpolatorBilinear::test(const unsigned int width, const unsigne
 		Log::info() << " ";
 	}
 
+	if (selector.shouldRun("resize_float16"))
+	{
+		testResult = testResizeFloat16(testDuration, worker);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
 	if (selector.shouldRun("specialCasesResize400x400To224x224"))
 	{
 		testResult = testSpecialCasesResize400x400To224x224_8BitPerChannel(testDuration);
@@ -220,6 +231,15 @@ bool TestFrameInterpolatorBilinear::test(const unsigned int width, const unsigne
 		Log::info() << " ";
 	}
 
+	if (selector.shouldRun("lookupMaskSIMDEquivalence"))
+	{
+		testResult = testLookupMaskSIMDEquivalence(testDuration, worker);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
 	if (selector.shouldRun("rotateFrame"))
 	{
 		testResult = testRotateFrame(width, height, testDuration, worker);
@@ -242,6 +262,15 @@ bool TestFrameInterpolatorBilinear::test(const unsigned int width, const unsigne
 	{
 		testResult = testResampleCameraImage(testDuration, worker);
 
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
+	if (selector.shouldRun("resampleCameraImageRemapTable"))
+	{
+		testResult = testResampleCameraImageRemapTable(testDuration, worker);
+
 		Log::info() << " ";
 	}
 
@@ -410,6 +439,12 @@ TEST(TestFrameInterpolatorBilinear, Resize_1920x1080_to_1803x1080_4channel)
 	EXPECT_TRUE(TestFrameInterpolatorBilinear::testResize(1920u, 1080u, 4u, 1803u, 1080u, GTEST_TEST_DURATION, worker));
 }
 
+TEST(TestFrameInterpolatorBilinear, ResizeFloat16)
+{
+	Worker worker;
+	EXPECT_TRUE(TestFrameInterpolatorBilinear::testResizeFloat16(GTEST_TEST_DURATION, worker));
+}
+
 
 // Special case resize functions
 
@@ -586,6 +621,12 @@ TEST(TestFrameInterpolatorBilinear, LookupMask_1920x1080)
 	EXPECT_TRUE(TestFrameInterpolatorBilinear::testLookupMask(1920u, 1080u, GTEST_TEST_DURATION, worker));
 }
 
+TEST(TestFrameInterpolatorBilinear, LookupMaskSIMDEquivalence)
+{
+	Worker worker;
+	EXPECT_TRUE(TestFrameInterpolatorBilinear::testLookupMaskSIMDEquivalence(GTEST_TEST_DURATION, worker));
+}
+
 
 // Rotate test
 
@@ -617,6 +658,12 @@ TEST(TestFrameInterpolatorBilinear, ResampleCameraImage_float)
 	EXPECT_TRUE((TestFrameInterpolatorBilinear::testResampleCameraImage<float>(GTEST_TEST_DURATION, worker)));
 }
 
+TEST(TestFrameInterpolatorBilinear, ResampleCameraImageRemapTable)
+{
+	Worker worker;
+	EXPECT_TRUE(TestFrameInterpolatorBilinear::testResampleCameraImageRemapTable(GTEST_TEST_DURATION, worker));
+}
+
 #endif
 
 bool TestFrameInterpolatorBilinear::testInterpolatePixel8BitPerChannel(const double testDuration)
@@ -1550,6 +1597,89 @@ bool TestFrameInterpolatorBilinear::testResize(const double testDuration, Worker
 	return validation.succeeded();
 }
 
+bool TestFrameInterpolatorBilinear::testResizeFloat16(const double testDuration, Worker& worker)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Frame resizing test for 16-bit float elements:";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		const unsigned int sourceWidth = RandomI::random(randomGenerator, 1u, 400u);
+		const unsigned int sourceHeight = RandomI::random(randomGenerator, 1u, 400u);
+
+		const unsigned int targetWidth = RandomI::random(randomGenerator, 1u, 400u);
+		const unsigned int targetHeight = RandomI::random(randomGenerator, 1u, 400u);
+
+		const unsigned int channels = RandomI::random(randomGenerator, 1u, 4u);
+
+		// the random float frame has a value range of [0, 255], the reference frame holds the same values after the conversion to 16-bit float
+
+		const Frame floatFrame = CV::CVUtilities::randomizedFrame(FrameType(sourceWidth, sourceHeight, FrameType::genericPixelFormat<float>(channels), FrameType::ORIGIN_UPPER_LEFT), &randomGenerator);
+
+		Frame float16Frame = CV::CVUtilities::randomizedFrame(FrameType(floatFrame.frameType(), FrameType::genericPixelFormat<Float16>(channels)), &randomGenerator);
+		CV::FrameConverter::cast<float, Float16>(floatFrame.constdata<float>(), float16Frame.data<Float16>(), sourceWidth, sourceHeight, channels, floatFrame.paddingElements(), float16Frame.paddingElements());
+
+		Frame referenceSourceFrame = CV::CVUtilities::randomizedFrame(floatFrame.frameType(), &randomGenerator);
+		CV::FrameConverter::cast<Float16, float>(float16Frame.constdata<Float16>(), referenceSourceFrame.data<float>(), sourceWidth, sourceHeight, channels, float16Frame.paddingElements(), referenceSourceFrame.paddingElements());
+
+		Frame referenceTargetFrame = CV::CVUtilities::randomizedFrame(FrameType(floatFrame.frameType(), targetWidth, targetHeight), &randomGenerator);
+
+		if (!CV::FrameInterpolatorBilinear::Comfort::resize(referenceSourceFrame, referenceTargetFrame))
+		{
+			OCEAN_SET_FAILED(validation);
+		}
+
+		Frame targetFrame = CV::CVUtilities::randomizedFrame(FrameType(float16Frame.frameType(), targetWidth, targetHeight), &randomGenerator);
+		const Frame copyTargetFrame(targetFrame, Frame::ACM_COPY_KEEP_LAYOUT_COPY_PADDING_DATA);
+
+		Worker* useWorker = RandomI::boolean(randomGenerator) ? &worker : nullptr;
+
+		if (!CV::FrameInterpolatorBilinear::Comfort::resize(float16Frame, targetFrame, useWorker))
+		{
+			OCEAN_SET_FAILED(validation);
+		}
+
+		if (!CV::CVUtilities::isPaddingMemoryIdentical(targetFrame, copyTargetFrame))
+		{
+			ocean_assert(false && "Invalid padding memory!");
+			return false;
+		}
+
+		for (unsigned int y = 0u; y < targetHeight; ++y)
+		{
+			for (unsigned int x = 0u; x < targetWidth; ++x)
+			{
+				const Float16* targetPixel = targetFrame.constpixel<Float16>(x, y);
+				const float* referencePixel = referenceTargetFrame.constpixel<float>(x, y);
+
+				for (unsigned int c = 0u; c < channels; ++c)
+				{
+					// the interpolation may be applied with 16-bit float precision (11 significant bits),
+					// so the error depends on the magnitude of the interpolated source values (with range [0, 255]) and not on the magnitude of the result
+
+					constexpr float maximalError = 0.5f;
+
+					if (NumericF::isNotEqual(float(targetPixel[c]), referencePixel[c], maximalError))
+					{
+						OCEAN_SET_FAILED(validation);
+					}
+				}
+			}
+		}
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
 bool TestFrameInterpolatorBilinear::testLookup(const double testDuration, Worker& worker)
 {
 	ocean_assert(testDuration > 0.0);
@@ -2772,6 +2902,133 @@ bool TestFrameInterpolatorBilinear::testResampleCameraImage(const double testDur
 	return allSucceeded;
 }
 
+bool TestFrameInterpolatorBilinear::testResampleCameraImageRemapTable(const double testDuration, Worker& worker)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Testing CameraRemapTable:";
+	Log::info() << " ";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	HighPerformanceStatistic performanceResample;
+	HighPerformanceStatistic performanceRemapTable;
+
+	const unsigned int maxWorkerIterations = worker ? 2u : 1u;
+
+	for (unsigned int workerIteration = 0u; workerIteration < maxWorkerIterations; ++workerIteration)
+	{
+		Worker* useWorker = workerIteration == 0u ? nullptr : &worker;
+
+		const Timestamp startTimestamp(true);
+
+		do
+		{
+			const unsigned int sourceWidth = RandomI::random(randomGenerator, 2u, 1000u);
+			const unsigned int sourceHeight = RandomI::random(randomGenerator, 2u, 1000u);
+
+			const unsigned int targetWidth = RandomI::random(randomGenerator, 1u, 1000u);
+			const unsigned int targetHeight = RandomI::random(randomGenerator, 1u, 1000u);
+
+			const unsigned int channels = RandomI::random(randomGenerator, 1u, 4u);
+
+			const FrameType::PixelFormat pixelFormat = FrameType::genericPixelFormat<uint8_t>(channels);
+
+			const Frame sourceFrame = CV::CVUtilities::randomizedFrame(FrameType(sourceWidth, sourceHeight, pixelFormat, FrameType::ORIGIN_UPPER_LEFT), &randomGenerator);
+
+			std::shared_ptr<AnyCamera> sourceCamera;
+
+			if (RandomI::boolean(randomGenerator))
+			{
+				sourceCamera = std::make_shared<AnyCameraPinhole>(PinholeCamera(sourceWidth, sourceHeight, Random::scalar(randomGenerator, Numeric::deg2rad(40), Numeric::deg2rad(90))));
+			}
+			else
+			{
+				sourceCamera = std::make_shared<AnyCameraFisheye>(FisheyeCamera(sourceWidth, sourceHeight, Random::scalar(randomGenerator, Numeric::deg2rad(90), Numeric::deg2rad(150))));
+			}
+
+			const AnyCameraPinhole targetCamera(PinholeCamera(targetWidth, targetHeight, Random::scalar(randomGenerator, Numeric::deg2rad(40), Numeric::deg2rad(90))));
+
+			const SquareMatrix3 source_R_target(Quaternion(Random::vector3(randomGenerator), Random::scalar(randomGenerator, Numeric::deg2rad(-30), Numeric::deg2rad(30))));
+
+			const unsigned int binSize = RandomI::random(randomGenerator, 1u, 16u);
+
+			const uint8_t borderColor[4] = {uint8_t(RandomI::random(randomGenerator, 255u)), uint8_t(RandomI::random(randomGenerator, 255u)), uint8_t(RandomI::random(randomGenerator, 255u)), uint8_t(RandomI::random(randomGenerator, 255u))};
+
+			Frame resampledFrame = CV::CVUtilities::randomizedFrame(FrameType(targetWidth, targetHeight, pixelFormat, FrameType::ORIGIN_UPPER_LEFT), &randomGenerator);
+			Frame remappedFrame = CV::CVUtilities::randomizedFrame(FrameType(targetWidth, targetHeight, pixelFormat, FrameType::ORIGIN_UPPER_LEFT), &randomGenerator);
+
+			const Frame copyRemappedFrame(remappedFrame, Frame::ACM_COPY_KEEP_LAYOUT_COPY_PADDING_DATA);
+
+			performanceResample.start();
+				const bool resampleResult = CV::FrameInterpolatorBilinear::Comfort::resampleCameraImage(sourceFrame, *sourceCamera, source_R_target, targetCamera, resampledFrame, nullptr, useWorker, binSize, borderColor);
+			performanceResample.stop();
+
+			OCEAN_EXPECT_TRUE(validation, resampleResult);
+
+			CV::CameraRemapTable remapTable;
+
+			OCEAN_EXPECT_FALSE(validation, remapTable.isValid());
+
+			OCEAN_EXPECT_TRUE(validation, remapTable.update(*sourceCamera, source_R_target, targetCamera, useWorker, binSize));
+			OCEAN_EXPECT_TRUE(validation, remapTable.isValidFor(*sourceCamera, source_R_target, targetCamera, binSize));
+
+			OCEAN_EXPECT_EQUAL(validation, remapTable.sourceWidth(), sourceWidth);
+			OCEAN_EXPECT_EQUAL(validation, remapTable.sourceHeight(), sourceHeight);
+			OCEAN_EXPECT_EQUAL(validation, remapTable.targetWidth(), targetWidth);
+			OCEAN_EXPECT_EQUAL(validation, remapTable.targetHeight(), targetHeight);
+
+			// a table with different key must not be valid for the current key
+
+			OCEAN_EXPECT_FALSE(validation, remapTable.isValidFor(*sourceCamera, source_R_target, targetCamera, binSize + 1u));
+			OCEAN_EXPECT_FALSE(validation, remapTable.isValidFor(*sourceCamera, source_R_target, AnyCameraPinhole(PinholeCamera(targetWidth + 1u, targetHeight, Numeric::deg2rad(60))), binSize));
+
+			// updating the table with the same key must not re-create the table
+
+			const CV::CameraRemapTable::Entry* const entries = remapTable.entries().data();
+
+			OCEAN_EXPECT_TRUE(validation, remapTable.update(*sourceCamera, source_R_target, targetCamera, useWorker, binSize));
+			OCEAN_EXPECT_EQUAL(validation, remapTable.entries().data(), entries);
+
+			performanceRemapTable.start();
+				const bool remapResult = remapTable.remap(sourceFrame, remappedFrame, useWorker, borderColor);
+			performanceRemapTable.stop();
+
+			OCEAN_EXPECT_TRUE(validation, remapResult);
+
+			if (!CV::CVUtilities::isPaddingMemoryIdentical(remappedFrame, copyRemappedFrame))
+			{
+				OCEAN_SET_FAILED(validation);
+			}
+
+			if (resampleResult && remapResult)
+			{
+				// the fixed-point remap table must create the identical result
+
+				OCEAN_EXPECT_TRUE(validation, remappedFrame.frameType() == resampledFrame.frameType());
+
+				for (unsigned int y = 0u; y < targetHeight; ++y)
+				{
+					if (memcmp(remappedFrame.constrow<uint8_t>(y), resampledFrame.constrow<uint8_t>(y), remappedFrame.planeWidthBytes(0u)) != 0)
+					{
+						OCEAN_SET_FAILED(validation);
+					}
+				}
+			}
+		}
+		while (!startTimestamp.hasTimePassed(testDuration));
+	}
+
+	Log::info() << "Performance Comfort::resampleCameraImage(): " << performanceResample;
+	Log::info() << "Performance CameraRemapTable::remap(): " << performanceRemapTable;
+
+	Log::info() << " ";
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
 bool TestFrameInterpolatorBilinear::testLookupMask(const unsigned int width, const unsigned int height, const double testDuration, Worker& worker)
 {
 	ocean_assert(testDuration > 0.0);
@@ -2887,6 +3144,33 @@ bool TestFrameInterpolatorBilinear::testLookupMask(const unsigned int width, con
 	return allSucceeded;
 }
 
+bool TestFrameInterpolatorBilinear::testLookupMaskSIMDEquivalence(const double testDuration, Worker& worker)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Equivalence of SIMD and scalar frame mask lookup transformation:";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		Worker* useWorker = RandomI::boolean(randomGenerator) ? &worker : nullptr;
+
+		OCEAN_EXPECT_TRUE(validation, validateLookupMaskSIMDEquivalence<1u>(randomGenerator, useWorker));
+		OCEAN_EXPECT_TRUE(validation, validateLookupMaskSIMDEquivalence<2u>(randomGenerator, useWorker));
+		OCEAN_EXPECT_TRUE(validation, validateLookupMaskSIMDEquivalence<3u>(randomGenerator, useWorker));
+		OCEAN_EXPECT_TRUE(validation, validateLookupMaskSIMDEquivalence<4u>(randomGenerator, useWorker));
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
 bool TestFrameInterpolatorBilinear::testRotateFrame(const unsigned int width, const unsigned int height, const double testDuration, Worker& worker)
 {
 	ocean_assert(width >= 1u && height >= 1u);
@@ -3790,6 +4074,112 @@ bool TestFrameInterpolatorBilinear::validateLookupMask(const Frame& sourceFrame,
 	return maxAbsError <= 10u && averageAbsError < 1.0 && ratioInvalidMaskPixels <= 0.05;
 }
 
+template <unsigned int tChannels>
+bool TestFrameInterpolatorBilinear::validateLookupMaskSIMDEquivalence(RandomGenerator& randomGenerator, Worker* worker)
+{
+	static_assert(tChannels >= 1u, "Invalid channel number!");
+
+	// small frames, so that the clamping at the last column/row and the scalar handling of the last pixels in a row are covered frequently
+
+	const unsigned int sourceWidth = RandomI::random(randomGenerator, 1u, 64u);
+	const unsigned int sourceHeight = RandomI::random(randomGenerator, 1u, 64u);
+
+	const unsigned int targetWidth = RandomI::random(randomGenerator, 1u, 67u);
+	const unsigned int targetHeight = RandomI::random(randomGenerator, 1u, 40u);
+
+	const bool offset = RandomI::boolean(randomGenerator);
+
+	CV::FrameInterpolatorBilinear::LookupTable lookupTable(targetWidth, targetHeight, RandomI::random(randomGenerator, 1u, std::min(targetWidth, 10u)), RandomI::random(randomGenerator, 1u, std::min(targetHeight, 10u)));
+
+	for (unsigned int yBin = 0u; yBin <= lookupTable.binsY(); ++yBin)
+	{
+		for (unsigned int xBin = 0u; xBin <= lookupTable.binsX(); ++xBin)
+		{
+			Vector2 position;
+
+			if (RandomI::random(randomGenerator, 3u) == 0u)
+			{
+				// a location exactly on a pixel, or exactly on the last column/row
+
+				position = Vector2(Scalar(RandomI::random(randomGenerator, 0u, sourceWidth - 1u)), Scalar(RandomI::random(randomGenerator, 0u, sourceHeight - 1u)));
+			}
+			else
+			{
+				// a random location, partially outside the source frame
+
+				position = Random::vector2(randomGenerator, Scalar(-2), Scalar(sourceWidth + 1u), Scalar(-2), Scalar(sourceHeight + 1u));
+			}
+
+			if (offset)
+			{
+				position -= Vector2(lookupTable.binTopLeftCornerPosition(xBin, yBin));
+			}
+
+			lookupTable.setBinTopLeftCornerValue(xBin, yBin, position);
+		}
+	}
+
+	const uint8_t maskValue = uint8_t(RandomI::random(randomGenerator, 255u));
+
+	const FrameType::PixelFormat pixelFormat = FrameType::genericPixelFormat<uint8_t, tChannels>();
+
+	const Frame sourceFrame = CV::CVUtilities::randomizedFrame(FrameType(sourceWidth, sourceHeight, pixelFormat, FrameType::ORIGIN_UPPER_LEFT), &randomGenerator);
+	Frame targetFrame = CV::CVUtilities::randomizedFrame(FrameType(sourceFrame, targetWidth, targetHeight), &randomGenerator);
+	Frame targetMask = CV::CVUtilities::randomizedFrame(FrameType(targetFrame, FrameType::FORMAT_Y8), &randomGenerator);
+
+	const Frame copyTargetFrame(targetFrame, Frame::ACM_COPY_KEEP_LAYOUT_COPY_PADDING_DATA);
+	const Frame copyTargetMask(targetMask, Frame::ACM_COPY_KEEP_LAYOUT_COPY_PADDING_DATA);
+
+	CV::FrameInterpolatorBilinear::lookupMask8BitPerChannel<tChannels>(sourceFrame.constdata<uint8_t>(), sourceWidth, sourceHeight, lookupTable, offset, targetFrame.data<uint8_t>(), targetMask.data<uint8_t>(), sourceFrame.paddingElements(), targetFrame.paddingElements(), targetMask.paddingElements(), worker, maskValue);
+
+	if (!CV::CVUtilities::isPaddingMemoryIdentical(targetFrame, copyTargetFrame) || !CV::CVUtilities::isPaddingMemoryIdentical(targetMask, copyTargetMask))
+	{
+		ocean_assert(false && "Invalid padding memory!");
+		return false;
+	}
+
+	// the locations are determined row-wise, exactly as in the transformation function
+
+	Vectors2 sourcePositions(targetWidth);
+
+	for (unsigned int y = 0u; y < targetHeight; ++y)
+	{
+		lookupTable.bilinearValues(y, sourcePositions.data());
+
+		for (unsigned int x = 0u; x < targetWidth; ++x)
+		{
+			Vector2 sourcePosition = sourcePositions[x];
+
+			if (offset)
+			{
+				sourcePosition += Vector2(Scalar(x), Scalar(y));
+			}
+
+			if (sourcePosition.x() >= Scalar(0) && sourcePosition.y() >= Scalar(0) && sourcePosition.x() <= Scalar(sourceWidth - 1u) && sourcePosition.y() <= Scalar(sourceHeight - 1u))
+			{
+				uint8_t pixelValue[tChannels];
+				CV::FrameInterpolatorBilinear::interpolatePixel8BitPerChannel<tChannels, CV::PC_TOP_LEFT>(sourceFrame.constdata<uint8_t>(), sourceWidth, sourceHeight, sourceFrame.paddingElements(), sourcePosition, pixelValue);
+
+				if (memcmp(targetFrame.constpixel<uint8_t>(x, y), pixelValue, tChannels) != 0 || targetMask.constpixel<uint8_t>(x, y)[0] != maskValue)
+				{
+					return false;
+				}
+			}
+			else
+			{
+				// the output pixel must not be modified
+
+				if (memcmp(targetFrame.constpixel<uint8_t>(x, y), copyTargetFrame.constpixel<uint8_t>(x, y), tChannels) != 0 || targetMask.constpixel<uint8_t>(x, y)[0] != uint8_t(0xFF - maskValue))
+				{
+					return false;
+				}
+			}
+		}
+	}
+
+	return true;
+}
+
 bool TestFrameInterpolatorBilinear::validateRotatedFrame(const Frame& source, const Frame& target, const Scalar anchorX, const Scalar anchorY, const Scalar angle)
 {
 	ocean_assert(source.isValid() && target.isValid());
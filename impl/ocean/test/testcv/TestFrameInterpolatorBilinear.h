@@ -11,6 +11,7 @@
 #include "ocean/test/testcv/TestCV.h"
 
 #include "ocean/base/Frame.h"
+#include "ocean/base/RandomGenerator.h"
 #include "ocean/base/Worker.h"
 
 #include "ocean/cv/PixelPosition.h"
@@ -137,6 +138,14 @@ class OCEAN_TEST_CV_EXPORT TestFrameInterpolatorBilinear
 		template <typename T>
 		static bool testResize(const double testDuration, Worker& worker);
 
+		/**
+		 * Tests the bilinear resize function for frames with 16-bit float elements by comparing it with the resize function for 32-bit float elements.
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @param worker The worker object to distribute the CPU load
+		 * @return True, if succeeded
+		 */
+		static bool testResizeFloat16(const double testDuration, Worker& worker);
+
 		/**
 		 * Tests the frame transformation function applying a lookup table.
 		 * @param testDuration Number of seconds for each test, with range (0, infinity)
@@ -165,6 +174,15 @@ class OCEAN_TEST_CV_EXPORT TestFrameInterpolatorBilinear
 		 */
 		static bool testLookupMask(const unsigned int width, const unsigned int height, const double testDuration, Worker& worker);
 
+		/**
+		 * Tests whether the SIMD implementation of the frame mask transformation function applying a lookup table provides the same result as the scalar pixel interpolation.
+		 * The test covers frames with 1-4 channels, locations outside and at the border of the input frame, and rows with a size not being a multiple of the SIMD block size.
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @param worker The worker object to distribute the CPU load
+		 * @return True, if succeeded
+		 */
+		static bool testLookupMaskSIMDEquivalence(const double testDuration, Worker& worker);
+
 		/**
 		 * Tests the frame rotate function.
 		 * @param width The width of the test frame in pixel, with range [1, infinity)
@@ -292,6 +310,14 @@ class OCEAN_TEST_CV_EXPORT TestFrameInterpolatorBilinear
 		template <typename T>
 		static bool testResampleCameraImage(const double testDuration, Worker& worker);
 
+		/**
+		 * Tests the cached fixed-point remap table to re-sample a camera image.
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @param worker The worker object to distribute the CPU load
+		 * @return True, if succeeded
+		 */
+		static bool testResampleCameraImageRemapTable(const double testDuration, Worker& worker);
+
 		/**
 		 * Validates the bilinear frame resize function.
 		 * @param source The source frame that has been resized, must be valid
@@ -434,6 +460,17 @@ class OCEAN_TEST_CV_EXPORT TestFrameInterpolatorBilinear
 		 */
 		static bool validateLookupMask(const Frame& sourceFrame, const Frame& targetFrame, const Frame& targetMask, const LookupCorner2<Vector2>& lookupTable, const bool offset);
 
+		/**
+		 * Applies the frame mask transformation function with a random lookup table to random frames and validates whether the result is bit-identical to the scalar pixel interpolation.
+		 * Output pixels with a location outside the input frame must not be modified.
+		 * @param randomGenerator The random generator to be used
+		 * @param worker Optional worker object to distribute the CPU load
+		 * @return True, if succeeded
+		 * @tparam tChannels The number of frame channels, with range [1, infinity)
+		 */
+		template <unsigned int tChannels>
+		static bool validateLookupMaskSIMDEquivalence(RandomGenerator& randomGenerator, Worker* worker);
+
 		/**
 		 * Validates the rotation of a frame using a bilinear interpolation.
 		 * @param source The source frame to be rotated, must be valid
@@ -12,6 +12,7 @@
 #include "ocean/base/String.h"
 
 #include "ocean/cv/CVUtilities.h"
+#include "ocean/cv/FrameConverter.h"
 
 #include "ocean/math/Numeric.h"
 
@@ -162,6 +163,24 @@ bool TestFramePyramid::test(const double testDuration, Worker& worker, const Tes
 		Log::info() << " ";
 	}
 
+	if (selector.shouldRun("replacey8"))
+	{
+		testResult = testReplaceY8(testDuration, worker);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
+	if (selector.shouldRun("updateregion"))
+	{
+		testResult = testUpdateRegion(testDuration, worker);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
 	if (selector.shouldRun("reducelayers"))
 	{
 		testResult = testReduceLayers(testDuration);
@@ -331,6 +350,20 @@ TEST(TestFramePyramid, Constructor11)
 }
 
 
+TEST(TestFramePyramid, ReplaceY8)
+{
+	Worker worker;
+	EXPECT_TRUE(TestFramePyramid::testReplaceY8(GTEST_TEST_DURATION, worker));
+}
+
+
+TEST(TestFramePyramid, UpdateRegion)
+{
+	Worker worker;
+	EXPECT_TRUE(TestFramePyramid::testUpdateRegion(GTEST_TEST_DURATION, worker));
+}
+
+
 TEST(TestFramePyramid, ReduceLayers)
 {
 	EXPECT_TRUE(TestFramePyramid::testReduceLayers(GTEST_TEST_DURATION));
@@ -2414,6 +2447,167 @@ bool TestFramePyramid::testConstructor11(const double testDuration, Worker& work
 	return validation.succeeded();
 }
 
+bool TestFramePyramid::testReplaceY8(const double testDuration, Worker& worker)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Testing replaceY8():";
+
+	const FrameType::PixelFormats pixelFormats = {FrameType::FORMAT_Y_UV12, FrameType::FORMAT_Y_VU12, FrameType::FORMAT_Y_UV12_FULL_RANGE, FrameType::FORMAT_YUYV16, FrameType::FORMAT_RGB24, FrameType::FORMAT_Y8};
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		const FrameType::PixelFormat pixelFormat = RandomI::random(randomGenerator, pixelFormats);
+
+		const unsigned int widthMultiple = FrameType::widthMultiple(pixelFormat);
+		const unsigned int heightMultiple = FrameType::heightMultiple(pixelFormat);
+
+		const unsigned int width = RandomI::random(randomGenerator, 1u, 1000u) * widthMultiple;
+		const unsigned int height = RandomI::random(randomGenerator, 1u, 1000u) * heightMultiple;
+
+		const unsigned int layers = RandomI::random(randomGenerator, 1u, 12u);
+
+		const FrameType::PixelOrigin pixelOrigin = RandomI::random(randomGenerator, {FrameType::ORIGIN_UPPER_LEFT, FrameType::ORIGIN_LOWER_LEFT});
+
+		Frame frame = CV::CVUtilities::randomizedFrame(FrameType(width, height, pixelFormat, pixelOrigin), &randomGenerator);
+		frame.setTimestamp(Timestamp(double(RandomI::random(randomGenerator, 1000u))));
+
+		Worker* useWorker = RandomI::boolean(randomGenerator) ? &worker : nullptr;
+
+		CV::FramePyramid framePyramid;
+
+		if (RandomI::boolean(randomGenerator))
+		{
+			// an existing pyramid with different layout
+
+			framePyramid = CV::FramePyramid(CV::CVUtilities::randomizedFrame(FrameType(RandomI::random(randomGenerator, 1u, 500u), RandomI::random(randomGenerator, 1u, 500u), FrameType::FORMAT_Y8, pixelOrigin), &randomGenerator), CV::FramePyramid::DM_FILTER_11, CV::FramePyramid::AS_MANY_LAYERS_AS_POSSIBLE, true /*copyFirstLayer*/, nullptr);
+		}
+
+		if (framePyramid.replaceY8(frame, layers, useWorker))
+		{
+			Frame yFrame;
+			if (CV::FrameConverter::Comfort::convert(frame, FrameType::FORMAT_Y8, pixelOrigin, yFrame, CV::FrameConverter::CP_ALWAYS_COPY))
+			{
+				const CV::FramePyramid expectedPyramid(yFrame, CV::FramePyramid::DM_FILTER_11, layers, true /*copyFirstLayer*/, nullptr);
+
+				OCEAN_EXPECT_EQUAL(validation, framePyramid.layers(), expectedPyramid.layers());
+
+				for (unsigned int layerIndex = 0u; layerIndex < std::min(framePyramid.layers(), expectedPyramid.layers()); ++layerIndex)
+				{
+					const Frame& layer = framePyramid[layerIndex];
+					const Frame& expectedLayer = expectedPyramid[layerIndex];
+
+					OCEAN_EXPECT_TRUE(validation, layer.frameType() == expectedLayer.frameType());
+					OCEAN_EXPECT_EQUAL(validation, layer.timestamp(), frame.timestamp());
+
+					if (layer.frameType() == expectedLayer.frameType())
+					{
+						for (unsigned int y = 0u; y < layer.height(); ++y)
+						{
+							OCEAN_EXPECT_EQUAL(validation, memcmp(layer.constrow<void>(y), expectedLayer.constrow<void>(y), layer.planeWidthBytes(0u)), 0);
+						}
+					}
+				}
+			}
+			else
+			{
+				OCEAN_SET_FAILED(validation);
+			}
+		}
+		else
+		{
+			OCEAN_SET_FAILED(validation);
+		}
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
+bool TestFramePyramid::testUpdateRegion(const double testDuration, Worker& worker)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Testing updateRegion():";
+
+	const FrameType::PixelFormats pixelFormats = {FrameType::FORMAT_Y8, FrameType::genericPixelFormat<uint8_t, 2u>(), FrameType::FORMAT_RGB24};
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		const unsigned int width = RandomI::random(randomGenerator, 2u, 1000u);
+		const unsigned int height = RandomI::random(randomGenerator, 2u, 1000u);
+
+		const FrameType::PixelFormat pixelFormat = RandomI::random(randomGenerator, pixelFormats);
+
+		const CV::FramePyramid::DownsamplingMode downsamplingMode = RandomI::random(randomGenerator, {CV::FramePyramid::DM_FILTER_11, CV::FramePyramid::DM_FILTER_14641});
+
+		const unsigned int layers = RandomI::random(randomGenerator, 1u, 12u);
+
+		const Frame frame = CV::CVUtilities::randomizedFrame(FrameType(width, height, pixelFormat, FrameType::ORIGIN_UPPER_LEFT), &randomGenerator);
+
+		CV::FramePyramid framePyramid(frame, downsamplingMode, layers, true /*copyFirstLayer*/, nullptr);
+
+		// changing a random sub-region of the finest layer
+
+		const unsigned int left = RandomI::random(randomGenerator, width - 1u);
+		const unsigned int top = RandomI::random(randomGenerator, height - 1u);
+
+		const unsigned int right = RandomI::random(randomGenerator, left, width - 1u);
+		const unsigned int bottom = RandomI::random(randomGenerator, top, height - 1u);
+
+		const CV::PixelBoundingBox boundingBox(left, top, right, bottom);
+
+		const Frame subRegion = CV::CVUtilities::randomizedFrame(FrameType(framePyramid.finestLayer(), boundingBox.width(), boundingBox.height()), &randomGenerator);
+		framePyramid.finestLayer().copy(int(left), int(top), subRegion);
+
+		Worker* useWorker = RandomI::boolean(randomGenerator) ? &worker : nullptr;
+
+		if (framePyramid.updateRegion(boundingBox, downsamplingMode, useWorker))
+		{
+			const CV::FramePyramid expectedPyramid(framePyramid.finestLayer(), downsamplingMode, layers, true /*copyFirstLayer*/, nullptr);
+
+			OCEAN_EXPECT_EQUAL(validation, framePyramid.layers(), expectedPyramid.layers());
+
+			for (unsigned int layerIndex = 0u; layerIndex < std::min(framePyramid.layers(), expectedPyramid.layers()); ++layerIndex)
+			{
+				const Frame& layer = framePyramid[layerIndex];
+				const Frame& expectedLayer = expectedPyramid[layerIndex];
+
+				OCEAN_EXPECT_TRUE(validation, layer.frameType() == expectedLayer.frameType());
+
+				if (layer.frameType() == expectedLayer.frameType())
+				{
+					for (unsigned int y = 0u; y < layer.height(); ++y)
+					{
+						OCEAN_EXPECT_EQUAL(validation, memcmp(layer.constrow<void>(y), expectedLayer.constrow<void>(y), layer.planeWidthBytes(0u)), 0);
+					}
+				}
+			}
+		}
+		else
+		{
+			OCEAN_SET_FAILED(validation);
+		}
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
 bool TestFramePyramid::testReduceLayers(const double testDuration)
 {
 	Log::info() << "Testing reduce layers:";
@@ -190,6 +190,22 @@ class OCEAN_TEST_CV_EXPORT TestFramePyramid : protected CV::FramePyramid
 		 */
 		static bool testConstructor11(const double testDuration, Worker& worker);
 
+		/**
+		 * Tests the replaceY8() function converting and downsampling a frame in one pass.
+		 * @param testDuration Requested duration of test loop in seconds
+		 * @param worker The worker object to distribute the computation
+		 * @return True, if the test succeeded; otherwise, false is returned.
+		 */
+		static bool testReplaceY8(const double testDuration, Worker& worker);
+
+		/**
+		 * Tests the updateRegion() function.
+		 * @param testDuration Requested duration of test loop in seconds
+		 * @param worker The worker object to distribute the computation
+		 * @return True, if the test succeeded; otherwise, false is returned.
+		 */
+		static bool testUpdateRegion(const double testDuration, Worker& worker);
+
 		/**
 		 * Tests the reduceLayers() function.
 		 * @param testDuration Number of seconds for each test, with range (0, infinity)
@@ -0,0 +1,423 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "ocean/test/testcv/TestFramePyramidCache.h"
+
+#include "ocean/base/RandomI.h"
+#include "ocean/base/Timestamp.h"
+
+#include "ocean/cv/CVUtilities.h"
+#include "ocean/cv/FrameConverter.h"
+#include "ocean/cv/FramePyramidCache.h"
+
+#include "ocean/test/TestResult.h"
+#include "ocean/test/Validation.h"
+
+#include <thread>
+
+namespace Ocean
+{
+
+namespace Test
+{
+
+namespace TestCV
+{
+
+bool TestFramePyramidCache::test(const double testDuration, Worker& worker, const TestSelector& selector)
+{
+	ocean_assert(testDuration > 0.0);
+
+	TestResult testResult("Frame pyramid cache test");
+	Log::info() << " ";
+
+	if (selector.shouldRun("sharedpyramid"))
+	{
+		testResult = testSharedPyramid(testDuration, worker);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
+	if (selector.shouldRun("capacity"))
+	{
+		testResult = testCapacity(testDuration);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
+	if (selector.shouldRun("concurrentrequests"))
+	{
+		testResult = testConcurrentRequests(testDuration);
+
+		Log::info() << " ";
+	}
+
+	Log::info() << testResult;
+
+	return testResult.succeeded();
+}
+
+#ifdef OCEAN_USE_GTEST
+
+TEST(TestFramePyramidCache, SharedPyramid)
+{
+	Worker worker;
+	EXPECT_TRUE(TestFramePyramidCache::testSharedPyramid(GTEST_TEST_DURATION, worker));
+}
+
+TEST(TestFramePyramidCache, Capacity)
+{
+	EXPECT_TRUE(TestFramePyramidCache::testCapacity(GTEST_TEST_DURATION));
+}
+
+TEST(TestFramePyramidCache, ConcurrentRequests)
+{
+	EXPECT_TRUE(TestFramePyramidCache::testConcurrentRequests(GTEST_TEST_DURATION));
+}
+
+#endif // OCEAN_USE_GTEST
+
+bool TestFramePyramidCache::testSharedPyramid(const double testDuration, Worker& worker)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Shared pyramid test:";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		Worker* useWorker = RandomI::boolean(randomGenerator) ? &worker : nullptr;
+
+		CV::FramePyramidCache framePyramidCache;
+
+		for (unsigned int frameIndex = 0u; frameIndex < 3u; ++frameIndex)
+		{
+			const unsigned int width = RandomI::random(randomGenerator, 32u, 640u);
+			const unsigned int height = RandomI::random(randomGenerator, 32u, 480u);
+
+			const FrameType::PixelFormat pixelFormat = RandomI::random(randomGenerator, {FrameType::FORMAT_Y8, FrameType::FORMAT_RGB24, FrameType::FORMAT_Y_UV12});
+			const FrameType::PixelOrigin pixelOrigin = pixelFormat == FrameType::FORMAT_RGB24 ? RandomI::random(randomGenerator, {FrameType::ORIGIN_UPPER_LEFT, FrameType::ORIGIN_LOWER_LEFT}) : FrameType::ORIGIN_UPPER_LEFT;
+
+			Frame frame = CV::CVUtilities::randomizedFrame(FrameType(width & ~1u, height & ~1u, pixelFormat, pixelOrigin), &randomGenerator);
+			frame.setTimestamp(Timestamp(double(frameIndex + 1u)));
+
+			// the first tracker requests the pyramid
+
+			const unsigned int firstLayers = RandomI::random(randomGenerator, 1u, 4u);
+
+			const CV::FramePyramidCache::SharedFramePyramid firstPyramid = framePyramidCache.pyramid(frame, firstLayers, useWorker);
+
+			if (!firstPyramid)
+			{
+				OCEAN_SET_FAILED(validation);
+				continue;
+			}
+
+			OCEAN_EXPECT_EQUAL(validation, firstPyramid->frameType().pixelFormat(), FrameType::FORMAT_Y8);
+			OCEAN_EXPECT_EQUAL(validation, firstPyramid->frameType().pixelOrigin(), FrameType::ORIGIN_UPPER_LEFT);
+			OCEAN_EXPECT_GREATER_EQUAL(validation, framePyramidCache.preferredLayers(), firstLayers);
+
+			// the pyramid must be identical to a pyramid created directly
+
+			Frame yFrame;
+			if (CV::FrameConverter::Comfort::convert(frame, FrameType::FORMAT_Y8, FrameType::ORIGIN_UPPER_LEFT, yFrame, CV::FrameConverter::CP_AVOID_COPY_IF_POSSIBLE))
+			{
+				const CV::FramePyramid expectedPyramid(yFrame, framePyramidCache.preferredLayers(), false /*copyFirstLayer*/);
+
+				OCEAN_EXPECT_EQUAL(validation, firstPyramid->layers(), expectedPyramid.layers());
+
+				for (unsigned int layerIndex = 0u; layerIndex < std::min(firstPyramid->layers(), expectedPyramid.layers()); ++layerIndex)
+				{
+					const Frame& layer = firstPyramid->layer(layerIndex);
+					const Frame& expectedLayer = expectedPyramid.layer(layerIndex);
+
+					if (layer.frameType() != expectedLayer.frameType())
+					{
+						OCEAN_SET_FAILED(validation);
+						continue;
+					}
+
+					for (unsigned int y = 0u; y < layer.height(); ++y)
+					{
+						if (memcmp(layer.constrow<uint8_t>(y), expectedLayer.constrow<uint8_t>(y), layer.planeWidthBytes(0u)) != 0)
+						{
+							OCEAN_SET_FAILED(validation);
+							break;
+						}
+					}
+				}
+			}
+			else
+			{
+				OCEAN_SET_FAILED(validation);
+			}
+
+			// a second tracker with fewer (or the same number of) layers receives the same pyramid
+
+			const unsigned int secondLayers = RandomI::random(randomGenerator, 1u, firstLayers);
+
+			const CV::FramePyramidCache::SharedFramePyramid secondPyramid = framePyramidCache.pyramid(frame, secondLayers, useWorker);
+
+			OCEAN_EXPECT_TRUE(validation, secondPyramid == firstPyramid);
+			OCEAN_EXPECT_TRUE(validation, framePyramidCache.existingPyramid(frame.timestamp(), secondLayers) == firstPyramid);
+
+			// a third tracker with more layers receives a deeper pyramid, the pyramid of the first tracker stays valid
+
+			const unsigned int thirdLayers = framePyramidCache.preferredLayers() + RandomI::random(randomGenerator, 1u, 2u);
+
+			OCEAN_EXPECT_TRUE(validation, framePyramidCache.existingPyramid(frame.timestamp(), thirdLayers) == nullptr);
+
+			const CV::FramePyramidCache::SharedFramePyramid thirdPyramid = framePyramidCache.pyramid(frame, thirdLayers, useWorker);
+
+			if (thirdPyramid)
+			{
+				OCEAN_EXPECT_TRUE(validation, thirdPyramid != firstPyramid);
+				OCEAN_EXPECT_GREATER_EQUAL(validation, thirdPyramid->layers(), firstPyramid->layers());
+				OCEAN_EXPECT_TRUE(validation, firstPyramid->isValid());
+
+				OCEAN_EXPECT_TRUE(validation, framePyramidCache.existingPyramid(frame.timestamp(), thirdLayers) == thirdPyramid);
+				OCEAN_EXPECT_TRUE(validation, framePyramidCache.pyramid(frame, firstLayers, useWorker) == thirdPyramid);
+
+				for (unsigned int layerIndex = 0u; layerIndex < firstPyramid->layers(); ++layerIndex)
+				{
+					const Frame& layer = firstPyramid->layer(layerIndex);
+					const Frame& deeperLayer = thirdPyramid->layer(layerIndex);
+
+					for (unsigned int y = 0u; y < layer.height(); ++y)
+					{
+						if (memcmp(layer.constrow<uint8_t>(y), deeperLayer.constrow<uint8_t>(y), layer.planeWidthBytes(0u)) != 0)
+						{
+							OCEAN_SET_FAILED(validation);
+							break;
+						}
+					}
+				}
+			}
+			else
+			{
+				OCEAN_SET_FAILED(validation);
+			}
+		}
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
+bool TestFramePyramidCache::testCapacity(const double testDuration)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Capacity test:";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		const size_t capacity = size_t(RandomI::random(randomGenerator, 1u, 4u));
+		const unsigned int frames = RandomI::random(randomGenerator, 1u, 8u);
+
+		const unsigned int width = RandomI::random(randomGenerator, 16u, 128u);
+		const unsigned int height = RandomI::random(randomGenerator, 16u, 128u);
+
+		CV::FramePyramidCache framePyramidCache(capacity);
+
+		CV::FramePyramidCache::SharedFramePyramid firstPyramid;
+
+		for (unsigned int frameIndex = 0u; frameIndex < frames; ++frameIndex)
+		{
+			Frame yFrame = CV::CVUtilities::randomizedFrame(FrameType(width, height, FrameType::FORMAT_Y8, FrameType::ORIGIN_UPPER_LEFT), &randomGenerator);
+			yFrame.setTimestamp(Timestamp(double(frameIndex + 1u)));
+
+			const CV::FramePyramidCache::SharedFramePyramid framePyramid = framePyramidCache.pyramid(yFrame, 2u);
+
+			OCEAN_EXPECT_TRUE(validation, framePyramid != nullptr);
+
+			if (frameIndex == 0u)
+			{
+				firstPyramid = framePyramid;
+			}
+		}
+
+		OCEAN_EXPECT_EQUAL(validation, framePyramidCache.size(), std::min(capacity, size_t(frames)));
+
+		for (unsigned int frameIndex = 0u; frameIndex < frames; ++frameIndex)
+		{
+			const bool isCached = size_t(frames - frameIndex) <= capacity;
+
+			OCEAN_EXPECT_EQUAL(validation, framePyramidCache.existingPyramid(Timestamp(double(frameIndex + 1u))) != nullptr, isCached);
+		}
+
+		// a pyramid which has been dropped by the cache stays valid
+
+		if (firstPyramid)
+		{
+			OCEAN_EXPECT_TRUE(validation, firstPyramid->isValid());
+			OCEAN_EXPECT_EQUAL(validation, firstPyramid->finestWidth(), width);
+		}
+		else
+		{
+			OCEAN_SET_FAILED(validation);
+		}
+
+		// frames without timestamp are not cached
+
+		const size_t cachedPyramids = framePyramidCache.size();
+
+		Frame yFrame = CV::CVUtilities::randomizedFrame(FrameType(width, height, FrameType::FORMAT_Y8, FrameType::ORIGIN_UPPER_LEFT), &randomGenerator);
+		yFrame.setTimestamp(Timestamp(false));
+
+		const CV::FramePyramidCache::SharedFramePyramid uncachedPyramid = framePyramidCache.pyramid(yFrame, 1u);
+
+		OCEAN_EXPECT_TRUE(validation, uncachedPyramid != nullptr);
+		OCEAN_EXPECT_EQUAL(validation, framePyramidCache.size(), cachedPyramids);
+
+		framePyramidCache.clear();
+
+		OCEAN_EXPECT_EQUAL(validation, framePyramidCache.size(), size_t(0));
+		OCEAN_EXPECT_EQUAL(validation, framePyramidCache.preferredLayers(), 0u);
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
+bool TestFramePyramidCache::testConcurrentRequests(const double testDuration)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Concurrent requests test:";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		const unsigned int width = RandomI::random(randomGenerator, 32u, 320u) & ~1u;
+		const unsigned int height = RandomI::random(randomGenerator, 32u, 240u) & ~1u;
+
+		constexpr unsigned int numberFrames = 4u;
+
+		Frames frames;
+		Frames downsampledFrames;
+
+		for (unsigned int frameIndex = 0u; frameIndex < numberFrames; ++frameIndex)
+		{
+			// the downsampled frame has the same timestamp as the original frame, e.g., as used by a tracker processing a lower resolution
+
+			frames.emplace_back(CV::CVUtilities::randomizedFrame(FrameType(width, height, FrameType::FORMAT_Y8, FrameType::ORIGIN_UPPER_LEFT), &randomGenerator));
+			frames.back().setTimestamp(Timestamp(double(frameIndex + 1u)));
+
+			downsampledFrames.emplace_back(CV::CVUtilities::randomizedFrame(FrameType(width / 2u, height / 2u, FrameType::FORMAT_Y8, FrameType::ORIGIN_UPPER_LEFT), &randomGenerator));
+			downsampledFrames.back().setTimestamp(Timestamp(double(frameIndex + 1u)));
+		}
+
+		CV::FramePyramidCache framePyramidCache(size_t(numberFrames * 2u));
+
+		const unsigned int numberThreads = RandomI::random(randomGenerator, 2u, 6u);
+
+		// each thread requests the pyramids of all frames, every second thread uses the downsampled frames
+
+		std::vector<std::vector<CV::FramePyramidCache::SharedFramePyramid>> threadPyramids(numberThreads, std::vector<CV::FramePyramidCache::SharedFramePyramid>(numberFrames));
+
+		std::vector<std::thread> threads;
+		threads.reserve(numberThreads);
+
+		for (unsigned int threadIndex = 0u; threadIndex < numberThreads; ++threadIndex)
+		{
+			threads.emplace_back([&framePyramidCache, &frames, &downsampledFrames, &threadPyramids, threadIndex]()
+			{
+				const Frames& threadFrames = threadIndex % 2u == 0u ? frames : downsampledFrames;
+
+				for (unsigned int frameIndex = 0u; frameIndex < numberFrames; ++frameIndex)
+				{
+					threadPyramids[threadIndex][frameIndex] = framePyramidCache.pyramid(threadFrames[frameIndex], 2u);
+				}
+			});
+		}
+
+		for (std::thread& thread : threads)
+		{
+			thread.join();
+		}
+
+		for (unsigned int frameIndex = 0u; frameIndex < numberFrames; ++frameIndex)
+		{
+			for (unsigned int threadIndex = 0u; threadIndex < numberThreads; ++threadIndex)
+			{
+				const CV::FramePyramidCache::SharedFramePyramid& framePyramid = threadPyramids[threadIndex][frameIndex];
+
+				if (!framePyramid)
+				{
+					OCEAN_SET_FAILED(validation);
+					continue;
+				}
+
+				// all threads with the same resolution must receive the same pyramid, the pyramid of the first thread with this resolution
+
+				const CV::FramePyramidCache::SharedFramePyramid& expectedPyramid = threadPyramids[threadIndex % 2u][frameIndex];
+
+				OCEAN_EXPECT_TRUE(validation, framePyramid == expectedPyramid);
+
+				const Frame& frame = threadIndex % 2u == 0u ? frames[frameIndex] : downsampledFrames[frameIndex];
+
+				const Frame& finestLayer = framePyramid->finestLayer();
+
+				if (finestLayer.frameType() == frame.frameType())
+				{
+					for (unsigned int y = 0u; y < finestLayer.height(); ++y)
+					{
+						if (memcmp(finestLayer.constrow<uint8_t>(y), frame.constrow<uint8_t>(y), frame.planeWidthBytes(0u)) != 0)
+						{
+							OCEAN_SET_FAILED(validation);
+							break;
+						}
+					}
+				}
+				else
+				{
+					OCEAN_SET_FAILED(validation);
+				}
+			}
+
+			if (numberThreads >= 2u)
+			{
+				OCEAN_EXPECT_TRUE(validation, threadPyramids[0][frameIndex] != threadPyramids[1][frameIndex]);
+			}
+		}
+
+		OCEAN_EXPECT_EQUAL(validation, framePyramidCache.size(), size_t(numberFrames * 2u));
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
+}
+
+}
+
+}
@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#ifndef META_OCEAN_TEST_TESTCV_TEST_FRAME_PYRAMID_CACHE_H
+#define META_OCEAN_TEST_TESTCV_TEST_FRAME_PYRAMID_CACHE_H
+
+#include "ocean/test/testcv/TestCV.h"
+
+#include "ocean/base/Worker.h"
+
+#include "ocean/test/TestSelector.h"
+
+namespace Ocean
+{
+
+namespace Test
+{
+
+namespace TestCV
+{
+
+/**
+ * This class implements tests for the frame pyramid cache.
+ * @see Ocean::CV::FramePyramidCache
+ * @ingroup testcv
+ */
+class OCEAN_TEST_CV_EXPORT TestFramePyramidCache
+{
+	public:
+
+		/**
+		 * Tests the functionality of the frame pyramid cache.
+		 * @param testDuration Number of seconds for each test
+		 * @param worker The worker object to distribute the computational load
+		 * @param selector The test selector to control which tests to run
+		 * @return True, if succeeded
+		 */
+		static bool test(const double testDuration, Worker& worker, const TestSelector& selector = TestSelector());
+
+		/**
+		 * Tests that trackers requesting the pyramid of the same frame receive the same pyramid, and that the pyramid is identical to a pyramid created directly.
+		 * @param testDuration Number of seconds for each test
+		 * @param worker The worker object to distribute the computational load
+		 * @return True, if succeeded
+		 */
+		static bool testSharedPyramid(const double testDuration, Worker& worker);
+
+		/**
+		 * Tests the capacity of the cache and frames without timestamp.
+		 * @param testDuration Number of seconds for each test
+		 * @return True, if succeeded
+		 */
+		static bool testCapacity(const double testDuration);
+
+		/**
+		 * Tests concurrent requests of several threads for the same frames, in the original and in a downsampled resolution.
+		 * @param testDuration Number of seconds for each test
+		 * @return True, if succeeded
+		 */
+		static bool testConcurrentRequests(const double testDuration);
+};
+
+}
+
+}
+
+}
+
+#endif // META_OCEAN_TEST_TESTCV_TEST_FRAME_PYRAMID_CACHE_H
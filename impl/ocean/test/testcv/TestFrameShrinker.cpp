@@ -15,6 +15,7 @@
 #include "ocean/base/RandomGenerator.h"
 #include "ocean/base/Utilities.h"
 
+#include "ocean/cv/CPUDispatch.h"
 #include "ocean/cv/CVUtilities.h"
 
 #include "ocean/math/Random.h"
@@ -89,6 +90,29 @@ bool TestFrameShrinker::test(const double testDuration, Worker& worker, const Te
 	if (selector.shouldRun("pyramidbytwo11"))
 	{
 		testResult = testPyramidByTwo11(testDuration, worker);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
+	if (selector.shouldRun("framedownsamplingbyarea8bit"))
+	{
+		testResult = testFrameDownsamplingByArea8Bit(testDuration, worker);
+
+		Log::info() << " ";
+		Log::info() << " ";
+
+		testResult = testFrameDownsamplingByAreaRandomResolutions(testDuration, worker);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
+	if (selector.shouldRun("instructionsetlevels"))
+	{
+		testResult = testInstructionSetLevels(testDuration, worker);
 	}
 
 	Log::info() << " ";
@@ -383,6 +407,42 @@ TEST(TestFrameShrinker, PyramidByTwo11)
 	EXPECT_TRUE(TestFrameShrinker::testPyramidByTwo11(GTEST_TEST_DURATION, worker));
 }
 
+TEST(TestFrameShrinker, FrameDownsamplingByArea8Bit_1920x1080_1280x720_1)
+{
+	Worker worker;
+	EXPECT_TRUE(TestFrameShrinker::testFrameDownsamplingByArea8Bit(1920u, 1080u, 1280u, 720u, 1u, GTEST_TEST_DURATION, worker));
+}
+
+TEST(TestFrameShrinker, FrameDownsamplingByArea8Bit_1920x1080_1280x720_3)
+{
+	Worker worker;
+	EXPECT_TRUE(TestFrameShrinker::testFrameDownsamplingByArea8Bit(1920u, 1080u, 1280u, 720u, 3u, GTEST_TEST_DURATION, worker));
+}
+
+TEST(TestFrameShrinker, FrameDownsamplingByArea8Bit_4032x3024_640x480_1)
+{
+	Worker worker;
+	EXPECT_TRUE(TestFrameShrinker::testFrameDownsamplingByArea8Bit(4032u, 3024u, 640u, 480u, 1u, GTEST_TEST_DURATION, worker));
+}
+
+TEST(TestFrameShrinker, FrameDownsamplingByArea8Bit_641x479_123x77_4)
+{
+	Worker worker;
+	EXPECT_TRUE(TestFrameShrinker::testFrameDownsamplingByArea8Bit(641u, 479u, 123u, 77u, 4u, GTEST_TEST_DURATION, worker));
+}
+
+TEST(TestFrameShrinker, FrameDownsamplingByAreaRandomResolutions)
+{
+	Worker worker;
+	EXPECT_TRUE(TestFrameShrinker::testFrameDownsamplingByAreaRandomResolutions(GTEST_TEST_DURATION, worker));
+}
+
+TEST(TestFrameShrinker, InstructionSetLevels)
+{
+	Worker worker;
+	EXPECT_TRUE(TestFrameShrinker::testInstructionSetLevels(GTEST_TEST_DURATION, worker));
+}
+
 #endif // OCEAN_USE_GTEST
 
 bool TestFrameShrinker::testRowDownsamplingByTwoThreeRows8Bit121(const double testDuration)
@@ -922,6 +982,224 @@ bool TestFrameShrinker::testPyramidByTwo11(const double testDuration, Worker& wo
 	return validation.succeeded();
 }
 
+bool TestFrameShrinker::testFrameDownsamplingByArea8Bit(const double testDuration, Worker& worker)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Testing downsampling with arbitrary factors and area averaging:";
+	Log::info() << " ";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	const unsigned int sourceWidths[] = {640u, 641u, 1280u, 1920u, 1920u, 4032u};
+	const unsigned int sourceHeights[] = {480u, 479u, 720u, 1080u, 1080u, 3024u};
+
+	const unsigned int targetWidths[] = {300u, 123u, 1000u, 1280u, 640u, 640u};
+	const unsigned int targetHeights[] = {200u, 77u, 700u, 720u, 360u, 480u};
+
+	for (unsigned int n = 0u; n < sizeof(sourceWidths) / sizeof(sourceWidths[0]); ++n)
+	{
+		const unsigned int sourceWidth = sourceWidths[n];
+		const unsigned int sourceHeight = sourceHeights[n];
+
+		const unsigned int targetWidth = targetWidths[n];
+		const unsigned int targetHeight = targetHeights[n];
+
+		Log::info().newLine(n != 0u);
+		Log::info() << "Testing 8 bit frame with size " << sourceWidth << "x" << sourceHeight << " -> " << targetWidth << "x" << targetHeight << ":";
+
+		for (unsigned int channels = 1u; channels <= 4u; ++channels)
+		{
+			Log::info() << " ";
+
+			OCEAN_EXPECT_TRUE(validation, testFrameDownsamplingByArea8Bit(sourceWidth, sourceHeight, targetWidth, targetHeight, channels, testDuration, worker));
+		}
+
+		Log::info() << " ";
+	}
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
+bool TestFrameShrinker::testFrameDownsamplingByAreaRandomResolutions(const double testDuration, Worker& worker)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Testing downsampling with arbitrary factors and area averaging for random resolutions and pixel formats:";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	const FrameType::PixelFormats pixelFormats = {FrameType::FORMAT_Y8, FrameType::FORMAT_YA16, FrameType::FORMAT_RGB24, FrameType::FORMAT_RGBA32, FrameType::FORMAT_Y_UV12, FrameType::FORMAT_Y_U_V12};
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		const FrameType::PixelFormat pixelFormat = RandomI::random(randomGenerator, pixelFormats);
+
+		const unsigned int widthMultiple = FrameType::widthMultiple(pixelFormat);
+		const unsigned int heightMultiple = FrameType::heightMultiple(pixelFormat);
+
+		const unsigned int sourceWidth = RandomI::random(randomGenerator, 1u, 300u) * widthMultiple;
+		const unsigned int sourceHeight = RandomI::random(randomGenerator, 1u, 300u) * heightMultiple;
+
+		const unsigned int targetWidth = RandomI::random(randomGenerator, 1u, sourceWidth / widthMultiple) * widthMultiple;
+		const unsigned int targetHeight = RandomI::random(randomGenerator, 1u, sourceHeight / heightMultiple) * heightMultiple;
+
+		Worker* useWorker = RandomI::boolean(randomGenerator) ? &worker : nullptr;
+
+		Frame sourceFrame = CV::CVUtilities::randomizedFrame(FrameType(sourceWidth, sourceHeight, pixelFormat, FrameType::ORIGIN_UPPER_LEFT), &randomGenerator);
+		sourceFrame.setTimestamp(Timestamp(double(RandomI::random(randomGenerator, 1000u))));
+
+		Frame targetFrame;
+		if (!CV::FrameShrinker::downsampleByArea(sourceFrame, targetFrame, targetWidth, targetHeight, useWorker))
+		{
+			OCEAN_SET_FAILED(validation);
+			continue;
+		}
+
+		OCEAN_EXPECT_TRUE(validation, targetFrame.frameType() == FrameType(sourceFrame, targetWidth, targetHeight));
+		OCEAN_EXPECT_EQUAL(validation, targetFrame.timestamp(), sourceFrame.timestamp());
+
+		if (targetFrame.frameType() != FrameType(sourceFrame, targetWidth, targetHeight))
+		{
+			continue;
+		}
+
+		for (unsigned int planeIndex = 0u; planeIndex < sourceFrame.numberPlanes(); ++planeIndex)
+		{
+			double maximalAbsError = NumericD::maxValue();
+			validateDownsamplingByArea8Bit(sourceFrame.constdata<uint8_t>(planeIndex), targetFrame.constdata<uint8_t>(planeIndex), sourceFrame.planeWidth(planeIndex), sourceFrame.planeHeight(planeIndex), targetFrame.planeWidth(planeIndex), targetFrame.planeHeight(planeIndex), sourceFrame.planeChannels(planeIndex), sourceFrame.paddingElements(planeIndex), targetFrame.paddingElements(planeIndex), nullptr, &maximalAbsError);
+
+			OCEAN_EXPECT_LESS_EQUAL(validation, maximalAbsError, 1.0);
+		}
+
+		// the in-place function must provide the identical result
+
+		Frame inPlaceFrame(sourceFrame, Frame::ACM_COPY_REMOVE_PADDING_LAYOUT);
+
+		if (CV::FrameShrinker::downsampleByArea(inPlaceFrame, targetWidth, targetHeight, useWorker))
+		{
+			OCEAN_EXPECT_TRUE(validation, inPlaceFrame.frameType() == targetFrame.frameType());
+
+			if (inPlaceFrame.frameType() == targetFrame.frameType())
+			{
+				for (unsigned int planeIndex = 0u; planeIndex < targetFrame.numberPlanes(); ++planeIndex)
+				{
+					for (unsigned int y = 0u; y < targetFrame.planeHeight(planeIndex); ++y)
+					{
+						OCEAN_EXPECT_EQUAL(validation, memcmp(inPlaceFrame.constrow<void>(y, planeIndex), targetFrame.constrow<void>(y, planeIndex), targetFrame.planeWidthBytes(planeIndex)), 0);
+					}
+				}
+			}
+		}
+		else
+		{
+			OCEAN_SET_FAILED(validation);
+		}
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
+bool TestFrameShrinker::testInstructionSetLevels(const double testDuration, Worker& worker)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Testing downsampling with all supported instruction set levels:";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	const CV::CPUDispatch::ISALevel supportedLevel = CV::CPUDispatch::supportedLevel();
+
+	Log::info() << "Supported level: " << CV::CPUDispatch::translateLevel(supportedLevel);
+
+	std::vector<CV::CPUDispatch::ISALevel> levels;
+
+	for (const CV::CPUDispatch::ISALevel level : {CV::CPUDispatch::IL_SSE_4_1, CV::CPUDispatch::IL_AVX_2, CV::CPUDispatch::IL_AVX_512, CV::CPUDispatch::IL_NEON, CV::CPUDispatch::IL_SVE})
+	{
+		if (CV::CPUDispatch::forceLevel(level))
+		{
+			levels.push_back(level);
+		}
+	}
+
+	OCEAN_EXPECT_TRUE(validation, CV::CPUDispatch::forceLevel(CV::CPUDispatch::IL_NONE));
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		const unsigned int width = RandomI::random(randomGenerator, 2u, 1000u);
+		const unsigned int height = RandomI::random(randomGenerator, 2u, 100u);
+		const unsigned int channels = RandomI::random(randomGenerator, 1u, 4u);
+
+		const Frame source = CV::CVUtilities::randomizedFrame(FrameType(width, height, FrameType::genericPixelFormat<uint8_t>(channels), FrameType::ORIGIN_UPPER_LEFT), &randomGenerator);
+
+		Worker* useWorker = RandomI::boolean(randomGenerator) ? &worker : nullptr;
+
+		OCEAN_EXPECT_TRUE(validation, CV::CPUDispatch::forceLevel(CV::CPUDispatch::IL_NONE));
+
+		const unsigned int areaTargetWidth = RandomI::random(randomGenerator, 1u, width);
+		const unsigned int areaTargetHeight = RandomI::random(randomGenerator, 1u, height);
+
+		Frame reference11;
+		Frame reference14641;
+		Frame referenceArea;
+
+		OCEAN_EXPECT_TRUE(validation, CV::FrameShrinker::downsampleByTwo11(source, reference11, useWorker));
+		OCEAN_EXPECT_TRUE(validation, CV::FrameShrinker::downsampleByTwo14641(source, reference14641, useWorker));
+		OCEAN_EXPECT_TRUE(validation, CV::FrameShrinker::downsampleByArea(source, referenceArea, areaTargetWidth, areaTargetHeight, useWorker));
+
+		for (const CV::CPUDispatch::ISALevel level : levels)
+		{
+			OCEAN_EXPECT_TRUE(validation, CV::CPUDispatch::forceLevel(level));
+
+			Frame target11;
+			Frame target14641;
+			Frame targetArea;
+
+			OCEAN_EXPECT_TRUE(validation, CV::FrameShrinker::downsampleByTwo11(source, target11, useWorker));
+			OCEAN_EXPECT_TRUE(validation, CV::FrameShrinker::downsampleByTwo14641(source, target14641, useWorker));
+			OCEAN_EXPECT_TRUE(validation, CV::FrameShrinker::downsampleByArea(source, targetArea, areaTargetWidth, areaTargetHeight, useWorker));
+
+			const Frame* targets[3] = {&target11, &target14641, &targetArea};
+			const Frame* references[3] = {&reference11, &reference14641, &referenceArea};
+
+			for (unsigned int n = 0u; n < 3u; ++n)
+			{
+				const Frame& target = *targets[n];
+				const Frame& reference = *references[n];
+
+				OCEAN_EXPECT_TRUE(validation, target.frameType() == reference.frameType());
+
+				if (target.frameType() == reference.frameType())
+				{
+					for (unsigned int y = 0u; y < target.height(); ++y)
+					{
+						OCEAN_EXPECT_EQUAL(validation, memcmp(target.constrow<void>(y), reference.constrow<void>(y), target.planeWidthBytes(0u)), 0);
+					}
+				}
+			}
+		}
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	CV::CPUDispatch::resetLevel();
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
 bool TestFrameShrinker::testFrameDownsamplingByTwo8Bit11(const unsigned int sourceWidth, const unsigned int sourceHeight, const unsigned int channels, const double testDuration, Worker& worker)
 {
 	ocean_assert(sourceWidth >= 2u && sourceHeight >= 2u);
@@ -1179,6 +1457,89 @@ bool TestFrameShrinker::testFrameDownsamplingByTwo8Bit14641(const unsigned int s
 	return validation.succeeded();
 }
 
+bool TestFrameShrinker::testFrameDownsamplingByArea8Bit(const unsigned int sourceWidth, const unsigned int sourceHeight, const unsigned int targetWidth, const unsigned int targetHeight, const unsigned int channels, const double testDuration, Worker& worker)
+{
+	ocean_assert(sourceWidth >= 1u && sourceHeight >= 1u);
+	ocean_assert(targetWidth >= 1u && targetWidth <= sourceWidth);
+	ocean_assert(targetHeight >= 1u && targetHeight <= sourceHeight);
+	ocean_assert(channels >= 1u);
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << ".... with " << channels << " channels:";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	HighPerformanceStatistic performanceSinglecore;
+	HighPerformanceStatistic performanceMulticore;
+
+	double sumAverageError = 0.0;
+	double maximalError = 0.0;
+
+	uint64_t measurements = 0ull;
+
+	const unsigned int maxWorkerIterations = worker ? 2u : 1u;
+
+	for (unsigned int workerIteration = 0u; workerIteration < maxWorkerIterations; ++workerIteration)
+	{
+		Worker* useWorker = (workerIteration == 0u) ? nullptr : &worker;
+		HighPerformanceStatistic& performance = useWorker ? performanceMulticore : performanceSinglecore;
+
+		const Timestamp startTimestamp(true);
+
+		do
+		{
+			const Frame sourceFrame = CV::CVUtilities::randomizedFrame(FrameType(sourceWidth, sourceHeight, FrameType::genericPixelFormat(FrameType::DT_UNSIGNED_INTEGER_8, channels), FrameType::ORIGIN_UPPER_LEFT), &randomGenerator);
+			Frame targetFrame = CV::CVUtilities::randomizedFrame(FrameType(sourceFrame, targetWidth, targetHeight), &randomGenerator);
+
+			const Frame targetFrameCopy(targetFrame, Frame::ACM_COPY_KEEP_LAYOUT_COPY_PADDING_DATA);
+
+			performance.start();
+				CV::FrameShrinker::downsampleByArea8BitPerChannel(sourceFrame.constdata<uint8_t>(), targetFrame.data<uint8_t>(), sourceFrame.width(), sourceFrame.height(), targetFrame.width(), targetFrame.height(), channels, sourceFrame.paddingElements(), targetFrame.paddingElements(), useWorker);
+			performance.stop();
+
+			double averageAbsError = NumericD::maxValue();
+			double maximalAbsError = NumericD::maxValue();
+			validateDownsamplingByArea8Bit(sourceFrame.constdata<uint8_t>(), targetFrame.constdata<uint8_t>(), sourceFrame.width(), sourceFrame.height(), targetFrame.width(), targetFrame.height(), channels, sourceFrame.paddingElements(), targetFrame.paddingElements(), &averageAbsError, &maximalAbsError);
+
+			if (!CV::CVUtilities::isPaddingMemoryIdentical(targetFrame, targetFrameCopy))
+			{
+				ocean_assert(false && "This must never happen!");
+				maximalAbsError = NumericD::maxValue();
+			}
+
+			sumAverageError += averageAbsError;
+			maximalError = max(maximalError, maximalAbsError);
+			measurements++;
+		}
+		while (!startTimestamp.hasTimePassed(testDuration));
+	}
+
+	Log::info() << "Singlecore performance: Best: " << performanceSinglecore.bestMseconds() << "ms, worst: " << performanceSinglecore.worstMseconds() << "ms, average: " << performanceSinglecore.averageMseconds() << "ms, median: " << performanceSinglecore.medianMseconds() << "ms";
+
+	if (performanceMulticore.measurements() != 0u)
+	{
+		Log::info() << "Multicore performance: Best: " << performanceMulticore.bestMseconds() << "ms, worst: " << performanceMulticore.worstMseconds() << "ms, average: " << performanceMulticore.averageMseconds() << "ms, median: " << performanceMulticore.medianMseconds() << "ms";
+		Log::info() << "Multicore boost: Best: " << String::toAString(performanceSinglecore.best() / performanceMulticore.best(), 1u) << "x, worst: " << String::toAString(performanceSinglecore.worst() / performanceMulticore.worst(), 1u) << "x, average: " << String::toAString(performanceSinglecore.average() / performanceMulticore.average(), 1u) << "x, median: " << String::toAString(performanceSinglecore.median() / performanceMulticore.median(), 1u) << "x";
+	}
+
+	// the fixed point precision allows a deviation of one intensity value only if the exact average is close to a rounding boundary
+
+	const double averageErrorThreshold = 0.1;
+	const double maximalErrorThreshold = 1.0;
+
+	ocean_assert(measurements != 0ull);
+	const double averageAbsError = sumAverageError / double(measurements);
+
+	OCEAN_EXPECT_LESS_EQUAL(validation, averageAbsError, averageErrorThreshold);
+	OCEAN_EXPECT_LESS_EQUAL(validation, maximalError, maximalErrorThreshold);
+
+	Log::info() << "Validation: average error: " << String::toAString(averageAbsError, 2u) << ", maximal error: " << String::toAString(maximalError, 2u);
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
 bool TestFrameShrinker::validateDownsamplingByTwo8Bit11(const Frame& source, const Frame& target, double* averageAbsError, double* maximalAbsError, uint8_t* groundTruth, const unsigned int groundTruthPaddingElements)
 {
 	ocean_assert(source.isValid() && target.isValid());
@@ -1561,6 +1922,92 @@ void TestFrameShrinker::validateDownsamplingByTwo8Bit14641(const uint8_t* source
 	}
 }
 
+void TestFrameShrinker::validateDownsamplingByArea8Bit(const uint8_t* source, const uint8_t* target, const unsigned int sourceWidth, const unsigned int sourceHeight, const unsigned int targetWidth, const unsigned int targetHeight, const unsigned int channels, const unsigned int sourcePaddingElements, const unsigned int targetPaddingElements, double* averageAbsError, double* maximalAbsError)
+{
+	ocean_assert(source != nullptr);
+	ocean_assert(target != nullptr);
+
+	ocean_assert(sourceWidth >= 1u && sourceHeight >= 1u);
+	ocean_assert(targetWidth >= 1u && targetWidth <= sourceWidth);
+	ocean_assert(targetHeight >= 1u && targetHeight <= sourceHeight);
+
+	ocean_assert(channels >= 1u);
+
+	const unsigned int sourceStrideElements = sourceWidth * channels + sourcePaddingElements;
+	const unsigned int targetStrideElements = targetWidth * channels + targetPaddingElements;
+
+	// all locations are defined in units of 1/targetSize source pixels, so that the overlaps are exact integers
+
+	const auto overlap = [](const unsigned int sourceIndex, const unsigned int targetIndex, const unsigned int sourceSize, const unsigned int targetSize)
+	{
+		const uint64_t start = std::max(uint64_t(sourceIndex) * uint64_t(targetSize), uint64_t(targetIndex) * uint64_t(sourceSize));
+		const uint64_t end = std::min(uint64_t(sourceIndex + 1u) * uint64_t(targetSize), uint64_t(targetIndex + 1u) * uint64_t(sourceSize));
+
+		return end > start ? double(end - start) / double(sourceSize) : 0.0;
+	};
+
+	std::vector<double> values(channels);
+
+	double sumAbsError = 0.0;
+	double maxAbsError = 0.0;
+
+	uint64_t measurements = 0ull;
+
+	for (unsigned int yTarget = 0u; yTarget < targetHeight; ++yTarget)
+	{
+		const unsigned int ySourceStart = (unsigned int)(uint64_t(yTarget) * uint64_t(sourceHeight) / uint64_t(targetHeight));
+		const unsigned int ySourceEnd = std::min((unsigned int)((uint64_t(yTarget + 1u) * uint64_t(sourceHeight) + uint64_t(targetHeight) - 1ull) / uint64_t(targetHeight)), sourceHeight);
+
+		for (unsigned int xTarget = 0u; xTarget < targetWidth; ++xTarget)
+		{
+			const unsigned int xSourceStart = (unsigned int)(uint64_t(xTarget) * uint64_t(sourceWidth) / uint64_t(targetWidth));
+			const unsigned int xSourceEnd = std::min((unsigned int)((uint64_t(xTarget + 1u) * uint64_t(sourceWidth) + uint64_t(targetWidth) - 1ull) / uint64_t(targetWidth)), sourceWidth);
+
+			std::fill(values.begin(), values.end(), 0.0);
+
+			for (unsigned int ySource = ySourceStart; ySource < ySourceEnd; ++ySource)
+			{
+				const double weightY = overlap(ySource, yTarget, sourceHeight, targetHeight);
+
+				for (unsigned int xSource = xSourceStart; xSource < xSourceEnd; ++xSource)
+				{
+					const double weight = weightY * overlap(xSource, xTarget, sourceWidth, targetWidth);
+
+					for (unsigned int n = 0u; n < channels; ++n)
+					{
+						values[n] += double(source[ySource * sourceStrideElements + xSource * channels + n]) * weight;
+					}
+				}
+			}
+
+			const uint8_t* targetResult = target + yTarget * targetStrideElements + xTarget * channels;
+
+			for (unsigned int n = 0u; n < channels; ++n)
+			{
+				ocean_assert(values[n] >= 0.0 && values[n] < 255.5);
+
+				const double absError = NumericD::abs(double(targetResult[n]) - double(uint8_t(values[n] + 0.5)));
+
+				sumAbsError += absError;
+				maxAbsError = max(maxAbsError, absError);
+
+				measurements++;
+			}
+		}
+	}
+
+	if (averageAbsError)
+	{
+		ocean_assert(measurements != 0ull);
+		*averageAbsError = sumAbsError / double(measurements);
+	}
+
+	if (maximalAbsError)
+	{
+		*maximalAbsError = maxAbsError;
+	}
+}
+
 }
 
 }
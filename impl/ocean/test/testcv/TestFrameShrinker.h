@@ -102,6 +102,30 @@ class OCEAN_TEST_CV_EXPORT TestFrameShrinker : protected CV::FrameShrinker
 		 */
 		static bool testPyramidByTwo11(const double testDuration, Worker& worker);
 
+		/**
+		 * Tests the 8 bit frame downsampling with arbitrary factors using area averaging.
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @param worker The worker object to distribute the computational load
+		 * @return True, if succeeded
+		 */
+		static bool testFrameDownsamplingByArea8Bit(const double testDuration, Worker& worker);
+
+		/**
+		 * Tests the downsampling of frames with arbitrary pixel formats and arbitrary factors using area averaging.
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @param worker The worker object to distribute the computational load
+		 * @return True, if succeeded
+		 */
+		static bool testFrameDownsamplingByAreaRandomResolutions(const double testDuration, Worker& worker);
+
+		/**
+		 * Tests that all instruction set levels supported by the processor provide the same downsampling results as the plain C++ implementation.
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @param worker The worker object to distribute the computational load
+		 * @return True, if succeeded
+		 */
+		static bool testInstructionSetLevels(const double testDuration, Worker& worker);
+
 		/**
 		 * Tests the 8 bit frame downsampling using 11 filtering.
 		 * @param sourceWidth Width of the source frame in pixel, with range [2, infinity)
@@ -136,6 +160,19 @@ class OCEAN_TEST_CV_EXPORT TestFrameShrinker : protected CV::FrameShrinker
 		 */
 		static bool testFrameDownsamplingByTwo8Bit14641(const unsigned int sourceWidth, const unsigned int sourceHeight, const unsigned int targetWidth, const unsigned int targetHeight, const unsigned int channels, const double testDuration, Worker& worker);
 
+		/**
+		 * Tests the 8 bit frame downsampling with arbitrary factors using area averaging.
+		 * @param sourceWidth Width of the source frame in pixel, with range [1, infinity)
+		 * @param sourceHeight Height of the source frame in pixel, with range [1, infinity)
+		 * @param targetWidth Width of the target frame in pixel, with range [1, sourceWidth]
+		 * @param targetHeight Height of the target frame in pixel, with range [1, sourceHeight]
+		 * @param channels The number of frame channels, with range [1, infinity)
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @param worker The worker object to distribute the computational load
+		 * @return True, if succeeded
+		 */
+		static bool testFrameDownsamplingByArea8Bit(const unsigned int sourceWidth, const unsigned int sourceHeight, const unsigned int targetWidth, const unsigned int targetHeight, const unsigned int channels, const double testDuration, Worker& worker);
+
 	protected:
 
 		/**
@@ -180,6 +217,22 @@ class OCEAN_TEST_CV_EXPORT TestFrameShrinker : protected CV::FrameShrinker
 		 * @param groundTruthPaddingElements Optional number of padding elements at the end of each ground truth row, in elements, with range [0, infinity)
 		 */
 		static void validateDownsamplingByTwo8Bit14641(const uint8_t* source, const uint8_t* target, const unsigned int sourceWidth, const unsigned int sourceHeight, const unsigned int targetWidth, const unsigned int targetHeight, const unsigned int channels, const unsigned int sourcePaddingElements, const unsigned int targetPaddingElements, double* averageAbsError, double* maximalAbsError, uint8_t* groundTruth = nullptr, const unsigned int groundTruthPaddingElements = 0u);
+
+		/**
+		 * Validates the downsampling of a frame with arbitrary factors using area averaging.
+		 * @param source The source frame holding an 8 bit image per channel, must be valid
+		 * @param target The target frame holding the downsampled frame, also 8 bit per channel, must be valid
+		 * @param sourceWidth Width of the source frame in pixel, with range [1, infinity)
+		 * @param sourceHeight Height of the source frame in pixel, with range [1, infinity)
+		 * @param targetWidth Width of the target frame in pixel, with range [1, sourceWidth]
+		 * @param targetHeight Height of the target frame in pixel, with range [1, sourceHeight]
+		 * @param channels The number of frame channels, with range [1, infinity)
+		 * @param sourcePaddingElements Optional number of padding elements at the end of each source row, in elements, with range [0, infinity)
+		 * @param targetPaddingElements Optional number of padding elements at the end of each target row, in elements, with range [0, infinity)
+		 * @param averageAbsError Optional resulting average absolute error between the converted result and the ground truth result, with range [0, infinity)
+		 * @param maximalAbsError Optional resulting maximal absolute error between the converted result and the ground truth result, with range [0, infinity)
+		 */
+		static void validateDownsamplingByArea8Bit(const uint8_t* source, const uint8_t* target, const unsigned int sourceWidth, const unsigned int sourceHeight, const unsigned int targetWidth, const unsigned int targetHeight, const unsigned int channels, const unsigned int sourcePaddingElements, const unsigned int targetPaddingElements, double* averageAbsError, double* maximalAbsError);
 };
 
 }
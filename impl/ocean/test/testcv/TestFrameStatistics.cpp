@@ -0,0 +1,353 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "ocean/test/testcv/TestFrameStatistics.h"
+
+#include "ocean/test/TestResult.h"
+#include "ocean/test/TestSelector.h"
+#include "ocean/test/Validation.h"
+
+#include "ocean/base/HighPerformanceTimer.h"
+#include "ocean/base/RandomGenerator.h"
+#include "ocean/base/RandomI.h"
+#include "ocean/base/String.h"
+#include "ocean/base/Timestamp.h"
+
+#include "ocean/cv/CVUtilities.h"
+#include "ocean/cv/FrameFilterLaplace.h"
+#include "ocean/cv/FrameMinMax.h"
+#include "ocean/cv/FrameVariance.h"
+#include "ocean/cv/Histogram.h"
+
+namespace Ocean
+{
+
+namespace Test
+{
+
+namespace TestCV
+{
+
+bool TestFrameStatistics::test(const unsigned int width, const unsigned int height, const double testDuration, Worker& worker, const TestSelector& selector)
+{
+	ocean_assert(width >= 1u && height >= 1u);
+	ocean_assert(testDuration > 0.0);
+
+	TestResult testResult("Frame statistics test");
+	Log::info() << " ";
+
+	if (selector.shouldRun("determinestatistics"))
+	{
+		testResult = testDetermineStatistics(width, height, testDuration, worker);
+	}
+
+	Log::info() << " ";
+	Log::info() << testResult;
+
+	return testResult.succeeded();
+}
+
+#ifdef OCEAN_USE_GTEST
+
+TEST(TestFrameStatistics, DetermineStatistics_1Channel_1920x1080)
+{
+	Worker worker;
+	EXPECT_TRUE((TestFrameStatistics::testDetermineStatistics<1u>(1920u, 1080u, GTEST_TEST_DURATION, worker)));
+}
+
+TEST(TestFrameStatistics, DetermineStatistics_2Channels_1920x1080)
+{
+	Worker worker;
+	EXPECT_TRUE((TestFrameStatistics::testDetermineStatistics<2u>(1920u, 1080u, GTEST_TEST_DURATION, worker)));
+}
+
+TEST(TestFrameStatistics, DetermineStatistics_3Channels_1920x1080)
+{
+	Worker worker;
+	EXPECT_TRUE((TestFrameStatistics::testDetermineStatistics<3u>(1920u, 1080u, GTEST_TEST_DURATION, worker)));
+}
+
+TEST(TestFrameStatistics, DetermineStatistics_4Channels_1920x1080)
+{
+	Worker worker;
+	EXPECT_TRUE((TestFrameStatistics::testDetermineStatistics<4u>(1920u, 1080u, GTEST_TEST_DURATION, worker)));
+}
+
+#endif // OCEAN_USE_GTEST
+
+bool TestFrameStatistics::testDetermineStatistics(const unsigned int width, const unsigned int height, const double testDuration, Worker& worker)
+{
+	ocean_assert(width >= 1u && height >= 1u);
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Determine statistics test:";
+	Log::info() << " ";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	OCEAN_EXPECT_TRUE(validation, testDetermineStatistics<1u>(width, height, testDuration, worker));
+
+	Log::info() << " ";
+
+	OCEAN_EXPECT_TRUE(validation, testDetermineStatistics<2u>(width, height, testDuration, worker));
+
+	Log::info() << " ";
+
+	OCEAN_EXPECT_TRUE(validation, testDetermineStatistics<3u>(width, height, testDuration, worker));
+
+	Log::info() << " ";
+
+	OCEAN_EXPECT_TRUE(validation, testDetermineStatistics<4u>(width, height, testDuration, worker));
+
+	Log::info() << " ";
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
+template <unsigned int tChannels>
+bool TestFrameStatistics::testDetermineStatistics(const unsigned int width, const unsigned int height, const double testDuration, Worker& worker)
+{
+	ocean_assert(width >= 1u && height >= 1u);
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "... " << width << "x" << height << ", " << tChannels << " channels:";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	HighPerformanceStatistic performanceSinglecore;
+	HighPerformanceStatistic performanceMulticore;
+	HighPerformanceStatistic performanceIndividual;
+
+	const unsigned int maxWorkerIterations = worker ? 2u : 1u;
+
+	for (unsigned int workerIteration = 0u; workerIteration < maxWorkerIterations; ++workerIteration)
+	{
+		Worker* useWorker = (workerIteration == 0u) ? nullptr : &worker;
+		HighPerformanceStatistic& performance = useWorker ? performanceMulticore : performanceSinglecore;
+
+		const Timestamp startTimestamp(true);
+
+		do
+		{
+			for (unsigned int benchmarkIteration = 0u; benchmarkIteration < 2u; ++benchmarkIteration)
+			{
+				const bool benchmark = benchmarkIteration == 0u;
+
+				const unsigned int testWidth = benchmark ? width : RandomI::random(randomGenerator, 1u, width);
+				const unsigned int testHeight = benchmark ? height : RandomI::random(randomGenerator, 1u, height);
+
+				const unsigned int framePaddingElements = RandomI::random(randomGenerator, 1u, 100u) * RandomI::random(randomGenerator, 1u);
+
+				Frame frame(FrameType(testWidth, testHeight, FrameType::genericPixelFormat<uint8_t, tChannels>(), FrameType::ORIGIN_UPPER_LEFT), framePaddingElements);
+
+				// a limited value range ensures that the minimal and maximal values are not always 0 and 255
+
+				const uint8_t rangeMinValue = uint8_t(RandomI::random(randomGenerator, 0u, 255u));
+				const uint8_t rangeMaxValue = uint8_t(RandomI::random(randomGenerator, (unsigned int)(rangeMinValue), 255u));
+
+				CV::CVUtilities::randomizeFrame<uint8_t>(frame, rangeMinValue, rangeMaxValue, false, &randomGenerator);
+
+				CV::FrameStatistics::StatisticType statisticTypes = CV::FrameStatistics::ST_ALL;
+
+				if (!benchmark)
+				{
+					do
+					{
+						statisticTypes = CV::FrameStatistics::StatisticType(RandomI::random(randomGenerator, (unsigned int)(CV::FrameStatistics::ST_ALL)) & CV::FrameStatistics::ST_ALL);
+					}
+					while (statisticTypes == CV::FrameStatistics::ST_NONE);
+				}
+
+				performance.startIf(benchmark);
+					const CV::FrameStatistics::Statistics8BitPerChannel<tChannels> statistics = CV::FrameStatistics::determineStatistics8BitPerChannel<tChannels>(frame.constdata<uint8_t>(), frame.width(), frame.height(), frame.paddingElements(), statisticTypes, useWorker);
+				performance.stopIf(benchmark);
+
+				OCEAN_EXPECT_EQUAL(validation, statistics.statisticTypes(), statisticTypes);
+
+				OCEAN_EXPECT_TRUE(validation, validateStatistics<tChannels>(frame, statistics));
+
+				if (benchmark && useWorker == nullptr)
+				{
+					// the same statistics determined with individual passes over the frame
+
+					double meanValues[tChannels];
+					double varianceValues[tChannels];
+
+					uint8_t minValues[tChannels];
+					uint8_t maxValues[tChannels];
+
+					double sharpness = 0.0;
+
+					performanceIndividual.start();
+						CV::FrameVariance::imageStatistics<uint8_t, uint64_t, uint32_t, tChannels>(frame.constdata<uint8_t>(), frame.width(), frame.height(), frame.paddingElements(), meanValues, varianceValues);
+						CV::FrameMinMax::determineMinMaxValues<uint8_t, tChannels>(frame.constdata<uint8_t>(), frame.width(), frame.height(), frame.paddingElements(), minValues, maxValues);
+						const CV::Histogram::Histogram8BitPerChannel<tChannels> histogram = CV::Histogram::determineHistogram8BitPerChannel<tChannels>(frame.constdata<uint8_t>(), frame.width(), frame.height(), frame.paddingElements());
+
+						if constexpr (tChannels == 1u)
+						{
+							if (frame.width() >= 3u && frame.height() >= 3u)
+							{
+								sharpness = CV::FrameFilterLaplace::variance1Channel8Bit(frame.constdata<uint8_t>(), frame.width(), frame.height(), frame.paddingElements());
+							}
+						}
+					performanceIndividual.stop();
+
+					for (unsigned int n = 0u; n < tChannels; ++n)
+					{
+						OCEAN_EXPECT_TRUE(validation, NumericD::isEqual(statistics.mean(n), meanValues[n], 0.001));
+						OCEAN_EXPECT_TRUE(validation, NumericD::isEqual(statistics.variance(n), varianceValues[n], 0.01));
+
+						OCEAN_EXPECT_EQUAL(validation, statistics.minValue(n), minValues[n]);
+						OCEAN_EXPECT_EQUAL(validation, statistics.maxValue(n), maxValues[n]);
+					}
+
+					OCEAN_EXPECT_TRUE(validation, statistics.histogram() == histogram);
+
+					if constexpr (tChannels == 1u)
+					{
+						OCEAN_EXPECT_TRUE(validation, NumericD::isEqual(statistics.sharpness(), sharpness, 0.01));
+					}
+				}
+			}
+		}
+		while (!startTimestamp.hasTimePassed(testDuration));
+	}
+
+	Log::info() << "Individual functions (singlecore): Best: " << performanceIndividual.bestMseconds() << "ms, worst: " << performanceIndividual.worstMseconds() << "ms, average: " << performanceIndividual.averageMseconds() << "ms";
+	Log::info() << "Singlecore Best: " << performanceSinglecore.bestMseconds() << "ms, worst: " << performanceSinglecore.worstMseconds() << "ms, average: " << performanceSinglecore.averageMseconds() << "ms";
+
+	if (performanceMulticore.measurements() != 0u)
+	{
+		Log::info() << "Multicore Best: " << performanceMulticore.bestMseconds() << "ms, worst: " << performanceMulticore.worstMseconds() << "ms, average: " << performanceMulticore.averageMseconds() << "ms";
+		Log::info() << "Multicore boost: Best: " << String::toAString(performanceSinglecore.best() / performanceMulticore.best(), 1u) << "x, worst: " << String::toAString(performanceSinglecore.worst() / performanceMulticore.worst(), 1u) << "x, average: " << String::toAString(performanceSinglecore.average() / performanceMulticore.average(), 1u) << "x";
+	}
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
+template <unsigned int tChannels>
+bool TestFrameStatistics::validateStatistics(const Frame& frame, const CV::FrameStatistics::Statistics8BitPerChannel<tChannels>& statistics)
+{
+	ocean_assert(frame.isValid() && frame.channels() == tChannels);
+
+	const CV::FrameStatistics::StatisticType statisticTypes = statistics.statisticTypes();
+
+	if (statistics.pixels() != uint64_t(frame.pixels()))
+	{
+		return false;
+	}
+
+	for (unsigned int n = 0u; n < tChannels; ++n)
+	{
+		uint64_t sum = 0ull;
+		uint64_t squaredSum = 0ull;
+
+		uint8_t minValue = 255u;
+		uint8_t maxValue = 0u;
+
+		unsigned int histogramBins[256] = {};
+
+		int64_t laplaceSum = 0ll;
+		uint64_t laplaceSquaredSum = 0ull;
+		uint64_t laplacePixels = 0ull;
+
+		for (unsigned int y = 0u; y < frame.height(); ++y)
+		{
+			for (unsigned int x = 0u; x < frame.width(); ++x)
+			{
+				const uint8_t value = frame.constpixel<uint8_t>(x, y)[n];
+
+				sum += value;
+				squaredSum += uint64_t(value) * uint64_t(value);
+
+				minValue = std::min(minValue, value);
+				maxValue = std::max(maxValue, value);
+
+				++histogramBins[value];
+
+				if (x >= 1u && y >= 1u && x + 1u < frame.width() && y + 1u < frame.height())
+				{
+					const int64_t response = int64_t(value) * 4ll - int64_t(frame.constpixel<uint8_t>(x, y - 1u)[n]) - int64_t(frame.constpixel<uint8_t>(x - 1u, y)[n]) - int64_t(frame.constpixel<uint8_t>(x + 1u, y)[n]) - int64_t(frame.constpixel<uint8_t>(x, y + 1u)[n]);
+
+					laplaceSum += response;
+					laplaceSquaredSum += uint64_t(response * response);
+					++laplacePixels;
+				}
+			}
+		}
+
+		const double pixels = double(frame.pixels());
+
+		if ((statisticTypes & CV::FrameStatistics::ST_MEAN) == CV::FrameStatistics::ST_MEAN)
+		{
+			if (NumericD::isNotEqual(statistics.mean(n), double(sum) / pixels, 0.0001))
+			{
+				return false;
+			}
+		}
+
+		if ((statisticTypes & CV::FrameStatistics::ST_VARIANCE) == CV::FrameStatistics::ST_VARIANCE)
+		{
+			const double mean = double(sum) / pixels;
+			const double variance = std::max(0.0, double(squaredSum) / pixels - mean * mean);
+
+			if (NumericD::isNotEqual(statistics.variance(n), variance, 0.001) || NumericD::isNotEqual(statistics.standardDeviation(n), NumericD::sqrt(variance), 0.001))
+			{
+				return false;
+			}
+		}
+
+		if ((statisticTypes & CV::FrameStatistics::ST_MIN_MAX) == CV::FrameStatistics::ST_MIN_MAX)
+		{
+			if (statistics.minValue(n) != minValue || statistics.maxValue(n) != maxValue)
+			{
+				return false;
+			}
+		}
+
+		if ((statisticTypes & CV::FrameStatistics::ST_HISTOGRAM) == CV::FrameStatistics::ST_HISTOGRAM)
+		{
+			for (unsigned int bin = 0u; bin < 256u; ++bin)
+			{
+				if (statistics.histogram().bin(n, uint8_t(bin)) != histogramBins[bin])
+				{
+					return false;
+				}
+			}
+		}
+
+		if ((statisticTypes & CV::FrameStatistics::ST_SHARPNESS) == CV::FrameStatistics::ST_SHARPNESS)
+		{
+			double sharpness = 0.0;
+
+			if (laplacePixels != 0ull)
+			{
+				const double meanResponse = double(laplaceSum) / double(laplacePixels);
+				sharpness = std::max(0.0, double(laplaceSquaredSum) / double(laplacePixels) - meanResponse * meanResponse);
+			}
+
+			if (NumericD::isNotEqual(statistics.sharpness(n), sharpness, 0.001))
+			{
+				return false;
+			}
+		}
+	}
+
+	return true;
+}
+
+}
+
+}
+
+}
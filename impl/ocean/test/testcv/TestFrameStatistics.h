@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#ifndef OCEAN_TEST_TESTCV_TEST_FRAME_STATISTICS_H
+#define OCEAN_TEST_TESTCV_TEST_FRAME_STATISTICS_H
+
+#include "ocean/test/testcv/TestCV.h"
+
+#include "ocean/test/TestSelector.h"
+
+#include "ocean/base/Frame.h"
+#include "ocean/base/Worker.h"
+
+#include "ocean/cv/FrameStatistics.h"
+
+namespace Ocean
+{
+
+namespace Test
+{
+
+namespace TestCV
+{
+
+/**
+ * This class implements tests for the FrameStatistics class.
+ * @ingroup testcv
+ */
+class OCEAN_TEST_CV_EXPORT TestFrameStatistics
+{
+	public:
+
+		/**
+		 * Starts all test of the FrameStatistics class.
+		 * @param width The width of the test image in pixel, with range [1, infinity)
+		 * @param height The height of the test image in pixel, with range [1, infinity)
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @param worker The worker object to distribute the computation
+		 * @param selector Test selector for filtering sub-tests; default runs all tests
+		 * @return True, if succeeded
+		 */
+		static bool test(const unsigned int width, const unsigned int height, const double testDuration, Worker& worker, const TestSelector& selector = TestSelector());
+
+		/**
+		 * Tests the function determining several statistics within one pass.
+		 * @param width The width of the test image in pixel, with range [1, infinity)
+		 * @param height The height of the test image in pixel, with range [1, infinity)
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @param worker The worker object to distribute the computation
+		 * @return True, if succeeded
+		 */
+		static bool testDetermineStatistics(const unsigned int width, const unsigned int height, const double testDuration, Worker& worker);
+
+		/**
+		 * Tests the function determining several statistics within one pass for a specific number of channels.
+		 * The performance is compared with the individual functions determining the same statistics.
+		 * @param width The width of the test image in pixel, with range [1, infinity)
+		 * @param height The height of the test image in pixel, with range [1, infinity)
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @param worker The worker object to distribute the computation
+		 * @return True, if succeeded
+		 * @tparam tChannels The number of frame channels, with range [1, infinity)
+		 */
+		template <unsigned int tChannels>
+		static bool testDetermineStatistics(const unsigned int width, const unsigned int height, const double testDuration, Worker& worker);
+
+	protected:
+
+		/**
+		 * Validates the statistics of a frame.
+		 * @param frame The frame for which the statistics have been determined, must be valid
+		 * @param statistics The statistics to validate
+		 * @return True, if succeeded
+		 * @tparam tChannels The number of frame channels, with range [1, infinity)
+		 */
+		template <unsigned int tChannels>
+		static bool validateStatistics(const Frame& frame, const CV::FrameStatistics::Statistics8BitPerChannel<tChannels>& statistics);
+};
+
+}
+
+}
+
+}
+
+#endif // OCEAN_TEST_TESTCV_TEST_FRAME_STATISTICS_H
@@ -64,6 +64,15 @@ bool TestFrameTransposer::test(const double testDuration, Worker& worker, const
 	if (selector.shouldRun("rotate"))
 	{
 		testResult = testRotate(testDuration, worker);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
+	if (selector.shouldRun("simdequivalence"))
+	{
+		testResult = testSIMDEquivalence(testDuration, worker);
 	}
 
 	Log::info() << " ";
@@ -157,6 +166,13 @@ TEST(TestFrameTransposer, Rotate)
 	EXPECT_TRUE(TestFrameTransposer::testRotate(GTEST_TEST_DURATION, worker));
 }
 
+
+TEST(TestFrameTransposer, SIMDEquivalence)
+{
+	Worker worker;
+	EXPECT_TRUE(TestFrameTransposer::testSIMDEquivalence(GTEST_TEST_DURATION, worker));
+}
+
 #endif // OCEAN_USE_GTEST
 
 bool TestFrameTransposer::testTransposer(const double testDuration, Worker& worker)
@@ -616,6 +632,162 @@ bool TestFrameTransposer::testRotate(const double testDuration, Worker& worker)
 	return validation.succeeded();
 }
 
+bool TestFrameTransposer::testSIMDEquivalence(const double testDuration, Worker& worker)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Test equivalence of SIMD and scalar implementations:";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		// the block transposers, 'int8_t' and 'int32_t' do not have a SIMD specialization and use the scalar implementation
+
+		OCEAN_EXPECT_TRUE(validation, (validateBlockTransposer8x8<uint8_t, int8_t, 1u, FD_NONE>(randomGenerator)));
+		OCEAN_EXPECT_TRUE(validation, (validateBlockTransposer8x8<uint8_t, int8_t, 1u, FD_LEFT_RIGHT>(randomGenerator)));
+		OCEAN_EXPECT_TRUE(validation, (validateBlockTransposer8x8<uint8_t, int8_t, 1u, FD_TOP_BOTTOM>(randomGenerator)));
+
+		OCEAN_EXPECT_TRUE(validation, (validateBlockTransposer8x8<uint8_t, int8_t, 2u, FD_NONE>(randomGenerator)));
+		OCEAN_EXPECT_TRUE(validation, (validateBlockTransposer8x8<uint8_t, int8_t, 2u, FD_LEFT_RIGHT>(randomGenerator)));
+		OCEAN_EXPECT_TRUE(validation, (validateBlockTransposer8x8<uint8_t, int8_t, 2u, FD_TOP_BOTTOM>(randomGenerator)));
+
+		OCEAN_EXPECT_TRUE(validation, (validateBlockTransposer8x8<uint8_t, int8_t, 3u, FD_NONE>(randomGenerator)));
+		OCEAN_EXPECT_TRUE(validation, (validateBlockTransposer8x8<uint8_t, int8_t, 3u, FD_LEFT_RIGHT>(randomGenerator)));
+		OCEAN_EXPECT_TRUE(validation, (validateBlockTransposer8x8<uint8_t, int8_t, 3u, FD_TOP_BOTTOM>(randomGenerator)));
+
+		OCEAN_EXPECT_TRUE(validation, (validateBlockTransposer8x8<uint8_t, int8_t, 4u, FD_NONE>(randomGenerator)));
+		OCEAN_EXPECT_TRUE(validation, (validateBlockTransposer8x8<uint8_t, int8_t, 4u, FD_LEFT_RIGHT>(randomGenerator)));
+		OCEAN_EXPECT_TRUE(validation, (validateBlockTransposer8x8<uint8_t, int8_t, 4u, FD_TOP_BOTTOM>(randomGenerator)));
+
+		OCEAN_EXPECT_TRUE(validation, (validateBlockTransposer8x8<uint32_t, int32_t, 1u, FD_NONE>(randomGenerator)));
+		OCEAN_EXPECT_TRUE(validation, (validateBlockTransposer8x8<uint32_t, int32_t, 1u, FD_LEFT_RIGHT>(randomGenerator)));
+		OCEAN_EXPECT_TRUE(validation, (validateBlockTransposer8x8<uint32_t, int32_t, 1u, FD_TOP_BOTTOM>(randomGenerator)));
+
+		// the frame rotations, with and without worker
+
+		Worker* useWorker = RandomI::boolean(randomGenerator) ? &worker : nullptr;
+
+		OCEAN_EXPECT_TRUE(validation, (validateRotationEquivalence<uint8_t, 1u>(randomGenerator, useWorker)));
+		OCEAN_EXPECT_TRUE(validation, (validateRotationEquivalence<uint8_t, 2u>(randomGenerator, useWorker)));
+		OCEAN_EXPECT_TRUE(validation, (validateRotationEquivalence<uint8_t, 3u>(randomGenerator, useWorker)));
+		OCEAN_EXPECT_TRUE(validation, (validateRotationEquivalence<uint8_t, 4u>(randomGenerator, useWorker)));
+		OCEAN_EXPECT_TRUE(validation, (validateRotationEquivalence<float, 1u>(randomGenerator, useWorker)));
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
+template <typename T, typename TScalar, unsigned int tChannels, CV::FrameTransposer::FlipDirection tFlipDirection>
+bool TestFrameTransposer::validateBlockTransposer8x8(RandomGenerator& randomGenerator)
+{
+	static_assert(sizeof(T) == sizeof(TScalar), "Invalid data types!");
+	static_assert(tChannels >= 1u, "Invalid channel number!");
+
+	const unsigned int sourceStrideElements = 8u * tChannels + RandomI::random(randomGenerator, 0u, 20u);
+	const unsigned int targetStrideElements = 8u * tChannels + RandomI::random(randomGenerator, 0u, 20u);
+
+	std::vector<T> sourceBlock(sourceStrideElements * 8u);
+	std::vector<T> targetBlock(targetStrideElements * 8u);
+
+	for (T& value : sourceBlock)
+	{
+		value = T(RandomI::random32(randomGenerator));
+	}
+
+	for (T& value : targetBlock)
+	{
+		value = T(RandomI::random32(randomGenerator));
+	}
+
+	// the scalar target block starts with the same (random) memory so that also the untouched elements can be compared
+	std::vector<T> scalarTargetBlock(targetBlock);
+
+	BlockTransposer<T, tChannels>::template transposeBlock8x8<tFlipDirection>(sourceBlock.data(), targetBlock.data(), sourceStrideElements, targetStrideElements);
+	BlockTransposer<TScalar, tChannels>::template transposeBlock8x8<tFlipDirection>((const TScalar*)(sourceBlock.data()), (TScalar*)(scalarTargetBlock.data()), sourceStrideElements, targetStrideElements);
+
+	return memcmp(targetBlock.data(), scalarTargetBlock.data(), targetBlock.size() * sizeof(T)) == 0;
+}
+
+template <typename T, unsigned int tChannels>
+bool TestFrameTransposer::validateRotationEquivalence(RandomGenerator& randomGenerator, Worker* worker)
+{
+	static_assert(tChannels >= 1u, "Invalid channel number!");
+
+	const FrameType::PixelFormat pixelFormat = FrameType::genericPixelFormat<T, tChannels>();
+
+	// odd frame sizes to cover partial blocks
+
+	const unsigned int width = RandomI::random(randomGenerator, 1u, 300u);
+	const unsigned int height = RandomI::random(randomGenerator, 1u, 300u);
+
+	const Frame sourceFrame = CV::CVUtilities::randomizedFrame(FrameType(width, height, pixelFormat, FrameType::ORIGIN_UPPER_LEFT), &randomGenerator);
+
+	bool allSucceeded = true;
+
+	for (const bool clockwise : {true, false})
+	{
+		Frame targetFrame = CV::CVUtilities::randomizedFrame(FrameType(sourceFrame, height, width), &randomGenerator);
+		Frame scalarTargetFrame(targetFrame, Frame::ACM_COPY_KEEP_LAYOUT_COPY_PADDING_DATA);
+
+		CV::FrameTransposer::rotate90<T, tChannels>(sourceFrame.constdata<T>(), targetFrame.data<T>(), width, height, clockwise, sourceFrame.paddingElements(), targetFrame.paddingElements(), worker);
+		rotate90Subset<T, tChannels>(sourceFrame.constdata<T>(), scalarTargetFrame.data<T>(), width, height, clockwise, sourceFrame.paddingElements(), scalarTargetFrame.paddingElements(), 0u, width);
+
+		if (!isMemoryIdentical(targetFrame, scalarTargetFrame))
+		{
+			allSucceeded = false;
+		}
+	}
+
+	{
+		// the scalar 180 degree rotation is composed of two scalar 90 degree rotations
+
+		Frame targetFrame = CV::CVUtilities::randomizedFrame(sourceFrame.frameType(), &randomGenerator);
+		Frame scalarTargetFrame(targetFrame, Frame::ACM_COPY_KEEP_LAYOUT_COPY_PADDING_DATA);
+
+		Frame intermediateFrame = CV::CVUtilities::randomizedFrame(FrameType(sourceFrame, height, width), &randomGenerator);
+
+		CV::FrameTransposer::rotate180<T, tChannels>(sourceFrame.constdata<T>(), targetFrame.data<T>(), width, height, sourceFrame.paddingElements(), targetFrame.paddingElements(), worker);
+
+		rotate90Subset<T, tChannels>(sourceFrame.constdata<T>(), intermediateFrame.data<T>(), width, height, true, sourceFrame.paddingElements(), intermediateFrame.paddingElements(), 0u, width);
+		rotate90Subset<T, tChannels>(intermediateFrame.constdata<T>(), scalarTargetFrame.data<T>(), height, width, true, intermediateFrame.paddingElements(), scalarTargetFrame.paddingElements(), 0u, height);
+
+		if (!isMemoryIdentical(targetFrame, scalarTargetFrame))
+		{
+			allSucceeded = false;
+		}
+	}
+
+	return allSucceeded;
+}
+
+bool TestFrameTransposer::isMemoryIdentical(const Frame& frameA, const Frame& frameB)
+{
+	ocean_assert(frameA.isValid() && frameA.frameType() == frameB.frameType());
+	ocean_assert(frameA.strideBytes() == frameB.strideBytes());
+
+	if (frameA.frameType() != frameB.frameType() || frameA.strideBytes() != frameB.strideBytes())
+	{
+		return false;
+	}
+
+	for (unsigned int y = 0u; y < frameA.height(); ++y)
+	{
+		if (memcmp(frameA.constrow<void>(y), frameB.constrow<void>(y), frameA.strideBytes()) != 0)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
 template <typename T, unsigned int tChannels>
 bool TestFrameTransposer::validateTransposer(const T* frame, const T* transposed, const unsigned int width, const unsigned int height, const unsigned int framePaddingElements, const unsigned int transposedPaddingElements)
 {
@@ -10,6 +10,10 @@
 
 #include "ocean/test/testcv/TestCV.h"
 
+#include "ocean/base/RandomGenerator.h"
+
+#include "ocean/cv/FrameTransposer.h"
+
 #include "ocean/test/TestSelector.h"
 
 namespace Ocean
@@ -25,7 +29,7 @@ namespace TestCV
  * This class implements a test for the frame transposer class.
  * @ingroup testcv
  */
-class OCEAN_TEST_CV_EXPORT TestFrameTransposer
+class OCEAN_TEST_CV_EXPORT TestFrameTransposer : protected CV::FrameTransposer
 {
 	public:
 
@@ -92,8 +96,48 @@ class OCEAN_TEST_CV_EXPORT TestFrameTransposer
 		 */
 		static bool testRotate(const double testDuration, Worker& worker);
 
+		/**
+		 * Tests whether the SIMD implementations of the block transposers and of the 90 and 180 degree rotations provide the same results as the scalar implementations.
+		 * The test covers 8 bit frames with 1 to 4 channels and 32 bit frames with 1 channel.
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @param worker The worker object to distribute the computation
+		 * @return True, if succeeded
+		 */
+		static bool testSIMDEquivalence(const double testDuration, Worker& worker);
+
 	protected:
 
+		/**
+		 * Validates whether the (SIMD) block transposer of a data type provides the same result as the scalar block transposer of a data type with identical memory layout.
+		 * @param randomGenerator The random generator to be used
+		 * @return True, if succeeded
+		 * @tparam T The data type of each element for which the (SIMD) block transposer will be used, e.g., 'uint8_t', 'uint32_t'
+		 * @tparam TScalar The data type of each element for which the scalar block transposer will be used, must have the same size as 'T', e.g., 'int8_t', 'int32_t'
+		 * @tparam tChannels The number of frame channels, with range [1, infinity)
+		 * @tparam tFlipDirection The flip direction to be applied after transposing the block
+		 */
+		template <typename T, typename TScalar, unsigned int tChannels, FlipDirection tFlipDirection>
+		static bool validateBlockTransposer8x8(RandomGenerator& randomGenerator);
+
+		/**
+		 * Validates whether the 90 and 180 degree rotations provide the same results as the scalar per-pixel rotation.
+		 * @param randomGenerator The random generator to be used
+		 * @param worker Optional worker object to distribute the computation
+		 * @return True, if succeeded
+		 * @tparam T The data type of each element, e.g., 'uint8_t', 'float'
+		 * @tparam tChannels The number of frame channels, with range [1, infinity)
+		 */
+		template <typename T, unsigned int tChannels>
+		static bool validateRotationEquivalence(RandomGenerator& randomGenerator, Worker* worker);
+
+		/**
+		 * Returns whether two frames with identical frame type and identical layout have identical memory, including the padding memory.
+		 * @param frameA The first frame, must be valid
+		 * @param frameB The second frame, must be valid
+		 * @return True, if so
+		 */
+		static bool isMemoryIdentical(const Frame& frameA, const Frame& frameB);
+
 		/**
 		 * Validates the frame transposer function.
 		 * @param frame The frame to be transposed, must be valid
@@ -27,7 +27,7 @@ namespace Test
 namespace TestCV
 {
 
-bool TestIntegralImage::test(const unsigned int width, const unsigned int height, const double testDuration, const TestSelector& selector)
+bool TestIntegralImage::test(const unsigned int width, const unsigned int height, const double testDuration, Worker& worker, const TestSelector& selector)
 {
 	ocean_assert(testDuration > 0.0);
 
@@ -144,6 +144,15 @@ bool TestIntegralImage::test(const unsigned int width, const unsigned int height
 	if (selector.shouldRun("variancecalculationtworegions"))
 	{
 		testResult = testVarianceCalculationTwoRegions(testDuration);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
+	if (selector.shouldRun("multithreaded"))
+	{
+		testResult = testMultiThreaded(width, height, testDuration, worker);
 	}
 
 	Log::info() << " ";
@@ -630,6 +639,26 @@ TEST(TestIntegralImage, VarianceCalculationTwoRegions_double_double_double_doubl
 	EXPECT_TRUE((TestIntegralImage::testVarianceCalculationTwoRegions<double, double, double, double>(GTEST_TEST_DURATION)));
 }
 
+// multi-threaded creation
+
+TEST(TestIntegralImage, MultiThreaded_uint8_uint32_uint64_1Channel)
+{
+	Worker worker;
+	EXPECT_TRUE((TestIntegralImage::testMultiThreaded<uint8_t, uint32_t, uint64_t, 1u>(1920u, 1080u, GTEST_TEST_DURATION, worker)));
+}
+
+TEST(TestIntegralImage, MultiThreaded_uint8_uint32_uint64_3Channels)
+{
+	Worker worker;
+	EXPECT_TRUE((TestIntegralImage::testMultiThreaded<uint8_t, uint32_t, uint64_t, 3u>(1920u, 1080u, GTEST_TEST_DURATION, worker)));
+}
+
+TEST(TestIntegralImage, MultiThreaded_double_double_double_1Channel)
+{
+	Worker worker;
+	EXPECT_TRUE((TestIntegralImage::testMultiThreaded<double, double, double, 1u>(1920u, 1080u, GTEST_TEST_DURATION, worker)));
+}
+
 #endif // OCEAN_USE_GTEST
 
 bool TestIntegralImage::testIntegralImage(const unsigned int width, const unsigned int height, const double testDuration)
@@ -1833,6 +1862,165 @@ bool TestIntegralImage::testVarianceCalculationTwoRegions(const double testDurat
 	return validation.succeeded();
 }
 
+bool TestIntegralImage::testMultiThreaded(const unsigned int width, const unsigned int height, const double testDuration, Worker& worker)
+{
+	ocean_assert(width >= 1u && height >= 1u && testDuration > 0.0);
+
+	Log::info() << "Testing multi-threaded integral image creation for " << width << "x" << height << " image:";
+	Log::info() << " ";
+
+	TestResult testResult;
+
+	testResult = testMultiThreaded<uint8_t, uint32_t, uint64_t, 1u>(width, height, testDuration, worker);
+	Log::info() << " ";
+	testResult = testMultiThreaded<uint8_t, uint32_t, uint64_t, 2u>(width, height, testDuration, worker);
+	Log::info() << " ";
+	testResult = testMultiThreaded<uint8_t, uint32_t, uint64_t, 3u>(width, height, testDuration, worker);
+
+	Log::info() << " ";
+	Log::info() << " ";
+
+	testResult = testMultiThreaded<double, double, double, 1u>(width, height, testDuration, worker);
+	Log::info() << " ";
+	testResult = testMultiThreaded<double, double, double, 3u>(width, height, testDuration, worker);
+
+	return testResult.succeeded();
+}
+
+template <typename T, typename TIntegral, typename TIntegralSquared, unsigned int tChannels>
+bool TestIntegralImage::testMultiThreaded(const unsigned int width, const unsigned int height, const double testDuration, Worker& worker)
+{
+	static_assert(tChannels >= 1u, "Invalid channel number!");
+	ocean_assert(width >= 1u && height >= 1u);
+
+	Log::info() << "... for " << tChannels << " channels with '" << TypeNamer::name<T>() << "' elements:";
+
+	const FrameType::PixelFormat sourcePixelFormat = FrameType::genericPixelFormat<T, tChannels>();
+	const FrameType::PixelFormat integralPixelFormat = FrameType::genericPixelFormat<TIntegral, tChannels>();
+	const FrameType::PixelFormat integralSquaredPixelFormat = FrameType::genericPixelFormat<TIntegralSquared, tChannels>();
+
+	const auto isIdentical = [](const Frame& frameA, const Frame& frameB)
+	{
+		ocean_assert(frameA.frameType() == frameB.frameType());
+
+		for (unsigned int y = 0u; y < frameA.height(); ++y)
+		{
+			if (memcmp(frameA.constrow<void>(y), frameB.constrow<void>(y), frameA.planeWidthBytes(0u)) != 0)
+			{
+				return false;
+			}
+		}
+
+		return true;
+	};
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	HighPerformanceStatistic performanceSinglecore;
+	HighPerformanceStatistic performanceMulticore;
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		for (const bool benchmark : {true, false})
+		{
+			const unsigned int testWidth = benchmark ? width : RandomI::random(randomGenerator, 1u, width);
+			const unsigned int testHeight = benchmark ? height : RandomI::random(randomGenerator, 1u, height);
+
+			const Frame sourceFrame = CV::CVUtilities::randomizedFrame(FrameType(testWidth, testHeight, sourcePixelFormat, FrameType::ORIGIN_UPPER_LEFT), &randomGenerator);
+
+			{
+				// lined integral image
+
+				Frame singlecoreFrame = CV::CVUtilities::randomizedFrame(FrameType(testWidth + 1u, testHeight + 1u, integralPixelFormat, FrameType::ORIGIN_UPPER_LEFT), &randomGenerator);
+				Frame multicoreFrame = CV::CVUtilities::randomizedFrame(singlecoreFrame.frameType(), &randomGenerator);
+
+				const Frame copyMulticoreFrame(multicoreFrame, Frame::ACM_COPY_KEEP_LAYOUT_COPY_PADDING_DATA);
+
+				performanceSinglecore.startIf(benchmark);
+					CV::IntegralImage::createLinedImage<T, TIntegral, tChannels>(sourceFrame.constdata<T>(), singlecoreFrame.data<TIntegral>(), testWidth, testHeight, sourceFrame.paddingElements(), singlecoreFrame.paddingElements());
+				performanceSinglecore.stopIf(benchmark);
+
+				performanceMulticore.startIf(benchmark);
+					CV::IntegralImage::createLinedImage<T, TIntegral, tChannels>(sourceFrame.constdata<T>(), multicoreFrame.data<TIntegral>(), testWidth, testHeight, sourceFrame.paddingElements(), multicoreFrame.paddingElements(), &worker);
+				performanceMulticore.stopIf(benchmark);
+
+				OCEAN_EXPECT_TRUE(validation, CV::CVUtilities::isPaddingMemoryIdentical(multicoreFrame, copyMulticoreFrame));
+				OCEAN_EXPECT_TRUE(validation, isIdentical(singlecoreFrame, multicoreFrame));
+			}
+
+			{
+				// joined lined integral and squared integral image
+
+				Frame singlecoreFrame = CV::CVUtilities::randomizedFrame(FrameType((testWidth + 1u) * 2u, testHeight + 1u, integralSquaredPixelFormat, FrameType::ORIGIN_UPPER_LEFT), &randomGenerator);
+				Frame multicoreFrame = CV::CVUtilities::randomizedFrame(singlecoreFrame.frameType(), &randomGenerator);
+
+				const Frame copyMulticoreFrame(multicoreFrame, Frame::ACM_COPY_KEEP_LAYOUT_COPY_PADDING_DATA);
+
+				CV::IntegralImage::createLinedImageAndSquared<T, TIntegralSquared, tChannels>(sourceFrame.constdata<T>(), singlecoreFrame.data<TIntegralSquared>(), testWidth, testHeight, sourceFrame.paddingElements(), singlecoreFrame.paddingElements());
+				CV::IntegralImage::createLinedImageAndSquared<T, TIntegralSquared, tChannels>(sourceFrame.constdata<T>(), multicoreFrame.data<TIntegralSquared>(), testWidth, testHeight, sourceFrame.paddingElements(), multicoreFrame.paddingElements(), &worker);
+
+				OCEAN_EXPECT_TRUE(validation, CV::CVUtilities::isPaddingMemoryIdentical(multicoreFrame, copyMulticoreFrame));
+				OCEAN_EXPECT_TRUE(validation, isIdentical(singlecoreFrame, multicoreFrame));
+			}
+
+			{
+				// separate lined integral and squared integral images
+
+				Frame singlecoreFrame = CV::CVUtilities::randomizedFrame(FrameType(testWidth + 1u, testHeight + 1u, integralPixelFormat, FrameType::ORIGIN_UPPER_LEFT), &randomGenerator);
+				Frame singlecoreSquaredFrame = CV::CVUtilities::randomizedFrame(FrameType(testWidth + 1u, testHeight + 1u, integralSquaredPixelFormat, FrameType::ORIGIN_UPPER_LEFT), &randomGenerator);
+
+				Frame multicoreFrame = CV::CVUtilities::randomizedFrame(singlecoreFrame.frameType(), &randomGenerator);
+				Frame multicoreSquaredFrame = CV::CVUtilities::randomizedFrame(singlecoreSquaredFrame.frameType(), &randomGenerator);
+
+				const Frame copyMulticoreFrame(multicoreFrame, Frame::ACM_COPY_KEEP_LAYOUT_COPY_PADDING_DATA);
+				const Frame copyMulticoreSquaredFrame(multicoreSquaredFrame, Frame::ACM_COPY_KEEP_LAYOUT_COPY_PADDING_DATA);
+
+				CV::IntegralImage::createLinedImageAndSquared<T, TIntegral, TIntegralSquared, tChannels>(sourceFrame.constdata<T>(), singlecoreFrame.data<TIntegral>(), singlecoreSquaredFrame.data<TIntegralSquared>(), testWidth, testHeight, sourceFrame.paddingElements(), singlecoreFrame.paddingElements(), singlecoreSquaredFrame.paddingElements());
+				CV::IntegralImage::createLinedImageAndSquared<T, TIntegral, TIntegralSquared, tChannels>(sourceFrame.constdata<T>(), multicoreFrame.data<TIntegral>(), multicoreSquaredFrame.data<TIntegralSquared>(), testWidth, testHeight, sourceFrame.paddingElements(), multicoreFrame.paddingElements(), multicoreSquaredFrame.paddingElements(), &worker);
+
+				OCEAN_EXPECT_TRUE(validation, CV::CVUtilities::isPaddingMemoryIdentical(multicoreFrame, copyMulticoreFrame));
+				OCEAN_EXPECT_TRUE(validation, CV::CVUtilities::isPaddingMemoryIdentical(multicoreSquaredFrame, copyMulticoreSquaredFrame));
+				OCEAN_EXPECT_TRUE(validation, isIdentical(singlecoreFrame, multicoreFrame));
+				OCEAN_EXPECT_TRUE(validation, isIdentical(singlecoreSquaredFrame, multicoreSquaredFrame));
+			}
+
+			{
+				// bordered integral image with mirrored border
+
+				const unsigned int border = RandomI::random(randomGenerator, 1u, std::min(std::min(testWidth, testHeight), 32u));
+
+				Frame singlecoreFrame = CV::CVUtilities::randomizedFrame(FrameType(testWidth + 1u + border * 2u, testHeight + 1u + border * 2u, integralPixelFormat, FrameType::ORIGIN_UPPER_LEFT), &randomGenerator);
+				Frame multicoreFrame = CV::CVUtilities::randomizedFrame(singlecoreFrame.frameType(), &randomGenerator);
+
+				const Frame copyMulticoreFrame(multicoreFrame, Frame::ACM_COPY_KEEP_LAYOUT_COPY_PADDING_DATA);
+
+				CV::IntegralImage::createBorderedImageMirror<T, TIntegral, tChannels>(sourceFrame.constdata<T>(), singlecoreFrame.data<TIntegral>(), testWidth, testHeight, border, sourceFrame.paddingElements(), singlecoreFrame.paddingElements());
+				CV::IntegralImage::createBorderedImageMirror<T, TIntegral, tChannels>(sourceFrame.constdata<T>(), multicoreFrame.data<TIntegral>(), testWidth, testHeight, border, sourceFrame.paddingElements(), multicoreFrame.paddingElements(), &worker);
+
+				OCEAN_EXPECT_TRUE(validation, CV::CVUtilities::isPaddingMemoryIdentical(multicoreFrame, copyMulticoreFrame));
+				OCEAN_EXPECT_TRUE(validation, isIdentical(singlecoreFrame, multicoreFrame));
+
+				if (!benchmark && !std::is_floating_point<T>::value)
+				{
+					// the validation expects exact values, which is not the case for floating point elements due to the individual summation order
+					OCEAN_EXPECT_TRUE(validation, (validateBorderedIntegralImageMirror<T, TIntegral, tChannels>(sourceFrame.constdata<T>(), multicoreFrame.constdata<TIntegral>(), testWidth, testHeight, border, sourceFrame.paddingElements(), multicoreFrame.paddingElements())));
+				}
+			}
+		}
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Singlecore performance (lined integral image): " << performanceSinglecore;
+	Log::info() << "Multicore performance (lined integral image): " << performanceMulticore;
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
 template <typename T, typename TIntegral>
 bool TestIntegralImage::validateIntegralImage(const T* source, const TIntegral* integral, const unsigned int width, const unsigned int height, const unsigned int channels, const unsigned int sourcePaddingElements, const unsigned int integralPaddingElements, const unsigned int validationChecks)
 {
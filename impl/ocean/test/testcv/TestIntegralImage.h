@@ -10,6 +10,8 @@
 
 #include "ocean/test/testcv/TestCV.h"
 
+#include "ocean/base/Worker.h"
+
 #include "ocean/test/TestSelector.h"
 
 namespace Ocean
@@ -34,10 +36,11 @@ class OCEAN_TEST_CV_EXPORT TestIntegralImage
 		 * @param width The width of the source frame in pixel, with range [1, infinity)
 		 * @param height The height of the source frame in pixel, with range [1, infinity)
 		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @param worker The worker object to distribute the computation
 		 * @param selector Test selector for filtering sub-tests; default runs all tests
 		 * @return True, if succeeded
 		 */
-		static bool test(const unsigned int width, const unsigned int height, const double testDuration, const TestSelector& selector = TestSelector());
+		static bool test(const unsigned int width, const unsigned int height, const double testDuration, Worker& worker, const TestSelector& selector = TestSelector());
 
 		/**
 		 * Tests the standard integral image function without any border.
@@ -290,6 +293,32 @@ class OCEAN_TEST_CV_EXPORT TestIntegralImage
 		template <typename T, typename TIntegral, typename TIntegralSquared, typename TVariance>
 		static bool testVarianceCalculationTwoRegions(const double testDuration);
 
+		/**
+		 * Tests the creation of integral images with a worker object (rows and columns are summed in two parallel passes).
+		 * @param width The width of the source frame in pixel, with range [1, infinity)
+		 * @param height The height of the source frame in pixel, with range [1, infinity)
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @param worker The worker object to distribute the computation
+		 * @return True, if succeeded
+		 */
+		static bool testMultiThreaded(const unsigned int width, const unsigned int height, const double testDuration, Worker& worker);
+
+		/**
+		 * Tests the creation of integral images with a worker object (rows and columns are summed in two parallel passes).
+		 * The results must be identical to the results of the single-threaded creation.
+		 * @param width The width of the source frame in pixel, with range [1, infinity)
+		 * @param height The height of the source frame in pixel, with range [1, infinity)
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @param worker The worker object to distribute the computation
+		 * @return True, if succeeded
+		 * @tparam T The data type of each source elements, e.g,. 'unsigned char'
+		 * @tparam TIntegral The data type of each integral element, e.g., 'unsigned int'
+		 * @tparam TIntegralSquared The data type of each squared integral element, e.g., 'unsigned long long'
+		 * @tparam tChannels The number of channels the source frame has, with range [1, infinity)
+		 */
+		template <typename T, typename TIntegral, typename TIntegralSquared, unsigned int tChannels>
+		static bool testMultiThreaded(const unsigned int width, const unsigned int height, const double testDuration, Worker& worker);
+
 	private:
 
 		/**
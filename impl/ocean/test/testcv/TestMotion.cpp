@@ -31,7 +31,7 @@ namespace Test
 namespace TestCV
 {
 
-bool TestMotion::test(const double testDuration, Worker& /*worker*/, const TestSelector& selector)
+bool TestMotion::test(const double testDuration, Worker& worker, const TestSelector& selector)
 {
 	ocean_assert(testDuration > 0.0);
 
@@ -68,6 +68,15 @@ bool TestMotion::test(const double testDuration, Worker& /*worker*/, const TestS
 		Log::info() << " ";
 	}
 
+	if (selector.shouldRun("trackpointsinpyramidmirroredborder"))
+	{
+		testResult = testTrackPointsInPyramidMirroredBorder(testDuration, worker);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
 	Log::info() << testResult;
 
 	return testResult.succeeded();
@@ -198,6 +207,12 @@ TEST(TestMotion, MotionMirroredBorder4ChannelPatchSize63)
 	EXPECT_TRUE((TestMotion::testMotionMirroredBorder<4u, 63u>(GTEST_TEST_DURATION)));
 }
 
+TEST(TestMotion, TrackPointsInPyramidMirroredBorder)
+{
+	Worker worker;
+	EXPECT_TRUE(TestMotion::testTrackPointsInPyramidMirroredBorder(GTEST_TEST_DURATION, worker));
+}
+
 #endif // OCEAN_USE_GTEST
 
 template <unsigned int tChannels>
@@ -263,6 +278,32 @@ bool TestMotion::testMotionMirroredBorder(const double testDuration)
 	return validation.succeeded();
 }
 
+bool TestMotion::testTrackPointsInPyramidMirroredBorder(const double testDuration, Worker& worker)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Pyramid point tracking test (with mirrored border):";
+	Log::info() << " ";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	OCEAN_EXPECT_TRUE(validation, (testTrackPointsInPyramidMirroredBorder<CV::SumAbsoluteDifferences, 1u, 7u>(640u, 480u, testDuration, worker)));
+	Log::info() << " ";
+	OCEAN_EXPECT_TRUE(validation, (testTrackPointsInPyramidMirroredBorder<CV::SumSquareDifferences, 1u, 7u>(640u, 480u, testDuration, worker)));
+	Log::info() << " ";
+	OCEAN_EXPECT_TRUE(validation, (testTrackPointsInPyramidMirroredBorder<CV::SumSquareDifferences, 1u, 15u>(640u, 480u, testDuration, worker)));
+	Log::info() << " ";
+	OCEAN_EXPECT_TRUE(validation, (testTrackPointsInPyramidMirroredBorder<CV::SumSquareDifferences, 3u, 7u>(640u, 480u, testDuration, worker)));
+	Log::info() << " ";
+	OCEAN_EXPECT_TRUE(validation, (testTrackPointsInPyramidMirroredBorder<CV::ZeroMeanSumSquareDifferences, 1u, 15u>(640u, 480u, testDuration, worker)));
+
+	Log::info() << " ";
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
 template <typename TMetric, unsigned int tChannels, unsigned int tPatchSize>
 bool TestMotion::testMotionMirroredBorder(const unsigned int width0, const unsigned int height0, const unsigned int width1, const unsigned int height1, const double testDuration)
 {
@@ -425,6 +466,145 @@ bool TestMotion::testMotionMirroredBorder(const unsigned int width0, const unsig
 	return validation.succeeded();
 }
 
+template <typename TMetric, unsigned int tChannels, unsigned int tPatchSize>
+bool TestMotion::testTrackPointsInPyramidMirroredBorder(const unsigned int width, const unsigned int height, const double testDuration, Worker& worker)
+{
+	static_assert(tChannels >= 1u, "Invalid channel number!");
+	static_assert(tPatchSize % 2u == 1u && tPatchSize >= 3u, "Invalid patch size!");
+
+	ocean_assert(width >= tPatchSize * 4u && height >= tPatchSize * 4u);
+	ocean_assert(testDuration > 0.0);
+
+	constexpr unsigned int numberPoints = 500u;
+
+	Log::info() << "... with " << tChannels << " channels, " << tPatchSize << "x" << tPatchSize << " patches and " << numberPoints << " points:";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	HighPerformanceStatistic performanceSinglecore;
+	HighPerformanceStatistic performanceMulticore;
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		for (const bool performanceIteration : {true, false})
+		{
+			const unsigned int testWidth = performanceIteration ? width : RandomI::random(randomGenerator, tPatchSize * 4u, width);
+			const unsigned int testHeight = performanceIteration ? height : RandomI::random(randomGenerator, tPatchSize * 4u, height);
+
+			const unsigned int previousPaddingElements = RandomI::random(randomGenerator, 1u, 100u) * RandomI::random(randomGenerator, 1u);
+			const unsigned int currentPaddingElements = RandomI::random(randomGenerator, 1u, 100u) * RandomI::random(randomGenerator, 1u);
+
+			Frame previousFrame(FrameType(testWidth, testHeight, FrameType::genericPixelFormat<FrameType::DT_UNSIGNED_INTEGER_8, tChannels>(), FrameType::ORIGIN_UPPER_LEFT), previousPaddingElements);
+			Frame currentFrame(previousFrame.frameType(), currentPaddingElements);
+
+			CV::CVUtilities::randomizeFrame(previousFrame, false, &randomGenerator);
+			CV::CVUtilities::randomizeFrame(currentFrame, false, &randomGenerator);
+
+			const unsigned int layers = RandomI::random(randomGenerator, 1u, 5u);
+
+			const CV::FramePyramid previousPyramid(previousFrame, CV::FramePyramid::DM_FILTER_14641, layers, false /*copyFirstLayer*/, nullptr);
+			const CV::FramePyramid currentPyramid(currentFrame, CV::FramePyramid::DM_FILTER_14641, layers, false /*copyFirstLayer*/, nullptr);
+
+			CV::PixelPositions previousPoints;
+			CV::PixelPositions roughPoints;
+
+			previousPoints.reserve(numberPoints);
+			roughPoints.reserve(numberPoints);
+
+			for (unsigned int n = 0u; n < numberPoints; ++n)
+			{
+				previousPoints.emplace_back(RandomI::random(randomGenerator, testWidth - 1u), RandomI::random(randomGenerator, testHeight - 1u));
+				roughPoints.emplace_back(RandomI::random(randomGenerator, testWidth - 1u), RandomI::random(randomGenerator, testHeight - 1u));
+			}
+
+			const unsigned int coarsestLayerRadiusX = RandomI::random(randomGenerator, 1u, 8u);
+			const unsigned int coarsestLayerRadiusY = RandomI::random(randomGenerator, 1u, 8u);
+
+			for (const bool useWorker : {false, true})
+			{
+				HighPerformanceStatistic& performance = useWorker ? performanceMulticore : performanceSinglecore;
+
+				CV::PixelPositions currentPoints;
+				std::vector<uint32_t> metricResults;
+				std::vector<uint32_t> metricIdentityResults;
+
+				performance.startIf(performanceIteration);
+					const bool result = CV::MotionT<TMetric>::template trackPointsInPyramidMirroredBorder<tPatchSize>(previousPyramid, currentPyramid, previousPoints, roughPoints, currentPoints, coarsestLayerRadiusX, coarsestLayerRadiusY, useWorker ? &worker : nullptr, &metricResults, &metricIdentityResults);
+				performance.stopIf(performanceIteration);
+
+				if (!result || currentPoints.size() != numberPoints || metricResults.size() != numberPoints || metricIdentityResults.size() != numberPoints)
+				{
+					OCEAN_SET_FAILED(validation);
+					continue;
+				}
+
+				// the reference tracking applies the same coarse-to-fine strategy but determines the motion directly in the pyramid layers
+
+				const unsigned int idealLayers = CV::FramePyramid::idealLayers(testWidth, testHeight, (tPatchSize / 2u) * 4u, (tPatchSize / 2u) * 4u, 2u);
+				const unsigned int numberLayers = std::min(std::min(previousPyramid.layers(), currentPyramid.layers()), idealLayers);
+				ocean_assert(numberLayers >= 1u);
+
+				for (unsigned int n = 0u; n < numberPoints; ++n)
+				{
+					const unsigned int coarsestFactor = currentPyramid.sizeFactor(numberLayers - 1u);
+
+					CV::PixelPosition roughPoint(std::min((roughPoints[n].x() + coarsestFactor / 2u) / coarsestFactor, currentPyramid.layer(numberLayers - 1u).width() - 1u), std::min((roughPoints[n].y() + coarsestFactor / 2u) / coarsestFactor, currentPyramid.layer(numberLayers - 1u).height() - 1u));
+
+					unsigned int radiusX = coarsestLayerRadiusX;
+					unsigned int radiusY = coarsestLayerRadiusY;
+
+					uint32_t testMetric = uint32_t(-1);
+					uint32_t testIdentityMetric = uint32_t(-1);
+
+					for (unsigned int layerIndex = numberLayers - 1u; layerIndex < numberLayers; --layerIndex)
+					{
+						const Frame& previousLayer = previousPyramid[layerIndex];
+						const Frame& currentLayer = currentPyramid[layerIndex];
+
+						const unsigned int layerFactor = 1u << layerIndex;
+
+						const CV::PixelPosition previousPosition(std::min((previousPoints[n].x() + layerFactor / 2u) / layerFactor, previousLayer.width() - 1u), std::min((previousPoints[n].y() + layerFactor / 2u) / layerFactor, previousLayer.height() - 1u));
+
+						const CV::PixelPosition position = CV::MotionT<TMetric>::template pointMotionInFrameMirroredBorder<tChannels, tPatchSize>(previousLayer.constdata<uint8_t>(), currentLayer.constdata<uint8_t>(), previousLayer.width(), previousLayer.height(), currentLayer.width(), currentLayer.height(), previousPosition, radiusX, radiusY, previousLayer.paddingElements(), currentLayer.paddingElements(), roughPoint, &testMetric, layerIndex == 0u ? &testIdentityMetric : nullptr);
+
+						if (layerIndex == 0u)
+						{
+							roughPoint = position;
+						}
+						else
+						{
+							roughPoint = CV::PixelPosition(std::min(position.x() * 2u, currentPyramid[layerIndex - 1u].width() - 1u), std::min(position.y() * 2u, currentPyramid[layerIndex - 1u].height() - 1u));
+						}
+
+						radiusX = 2u;
+						radiusY = 2u;
+					}
+
+					if (currentPoints[n] != roughPoint || metricResults[n] != testMetric || metricIdentityResults[n] != testIdentityMetric)
+					{
+						OCEAN_SET_FAILED(validation);
+					}
+				}
+			}
+		}
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Singlecore performance: " << performanceSinglecore;
+
+	if (performanceMulticore.measurements() != 0u)
+	{
+		Log::info() << "Multicore performance: " << performanceMulticore;
+	}
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
 }
 
 }
@@ -62,6 +62,15 @@ class OCEAN_TEST_CV_EXPORT TestMotion
 		template <unsigned int tChannels, unsigned int tSize>
 		static bool testMotionMirroredBorder(const double testDuration);
 
+		/**
+		 * Tests the pyramid-based point tracking with mirrored border.
+		 * The tracking results are compared with a layer-wise reference tracking based on pointMotionInFrameMirroredBorder().
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @param worker The worker object to be used for computation distribution
+		 * @return True, if succeeded
+		 */
+		static bool testTrackPointsInPyramidMirroredBorder(const double testDuration, Worker& worker);
+
 	protected:
 
 		/**
@@ -79,6 +88,20 @@ class OCEAN_TEST_CV_EXPORT TestMotion
 		 */
 		template <typename TMetric, unsigned int tChannels, unsigned int tSize>
 		static bool testMotionMirroredBorder(const unsigned int width0, const unsigned int height0, const unsigned int width1, const unsigned int height1, const double testDuration);
+
+		/**
+		 * Tests the pyramid-based point tracking with mirrored border.
+		 * @param width The maximal width of the test frames in pixel, with range [tPatchSize * 4, infinity)
+		 * @param height The maximal height of the test frames in pixel, with range [tPatchSize * 4, infinity)
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @param worker The worker object to be used for computation distribution
+		 * @tparam TMetric The metric that is applied for measurements
+		 * @tparam tChannels The number of data channels each frame has
+		 * @tparam tPatchSize The size of the image patch that is applied for measurements, with range [3, infinity), must be odd
+		 * @return True, if succeeded
+		 */
+		template <typename TMetric, unsigned int tChannels, unsigned int tPatchSize>
+		static bool testTrackPointsInPyramidMirroredBorder(const unsigned int width, const unsigned int height, const double testDuration, Worker& worker);
 };
 
 }
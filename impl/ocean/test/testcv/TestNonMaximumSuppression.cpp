@@ -124,6 +124,30 @@ bool TestNonMaximumSuppression::test(const unsigned int width, const unsigned in
 		Log::info() << " ";
 	}
 
+	if (selector.shouldRun("suppressioninresponseframe"))
+	{
+		testResult = testSuppressionInResponseFrame<uint8_t>(width, height, testDuration, worker);
+		Log::info() << " ";
+		testResult = testSuppressionInResponseFrame<int32_t>(width, height, testDuration, worker);
+		Log::info() << " ";
+		testResult = testSuppressionInResponseFrame<float>(width, height, testDuration, worker);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
+	if (selector.shouldRun("suppressioninresponseframestrongestperbin"))
+	{
+		testResult = testSuppressionInResponseFrameStrongestPerBin<int32_t>(width, height, testDuration, worker);
+		Log::info() << " ";
+		testResult = testSuppressionInResponseFrameStrongestPerBin<float>(width, height, testDuration, worker);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
 	Log::info() << " ";
 
 	Log::info() << testResult;
@@ -228,6 +252,38 @@ TEST(TestNonMaximumSuppression, Candidate)
 	EXPECT_TRUE(TestNonMaximumSuppression::testCandidate(GTEST_TEST_DURATION));
 }
 
+
+TEST(TestNonMaximumSuppression, SuppressionInResponseFrame_uint8)
+{
+	Worker worker;
+	EXPECT_TRUE(TestNonMaximumSuppression::testSuppressionInResponseFrame<uint8_t>(1920u, 1080u, GTEST_TEST_DURATION, worker));
+}
+
+TEST(TestNonMaximumSuppression, SuppressionInResponseFrame_int32)
+{
+	Worker worker;
+	EXPECT_TRUE(TestNonMaximumSuppression::testSuppressionInResponseFrame<int32_t>(1920u, 1080u, GTEST_TEST_DURATION, worker));
+}
+
+TEST(TestNonMaximumSuppression, SuppressionInResponseFrame_float)
+{
+	Worker worker;
+	EXPECT_TRUE(TestNonMaximumSuppression::testSuppressionInResponseFrame<float>(1920u, 1080u, GTEST_TEST_DURATION, worker));
+}
+
+
+TEST(TestNonMaximumSuppression, SuppressionInResponseFrameStrongestPerBin_int32)
+{
+	Worker worker;
+	EXPECT_TRUE(TestNonMaximumSuppression::testSuppressionInResponseFrameStrongestPerBin<int32_t>(1920u, 1080u, GTEST_TEST_DURATION, worker));
+}
+
+TEST(TestNonMaximumSuppression, SuppressionInResponseFrameStrongestPerBin_float)
+{
+	Worker worker;
+	EXPECT_TRUE(TestNonMaximumSuppression::testSuppressionInResponseFrameStrongestPerBin<float>(1920u, 1080u, GTEST_TEST_DURATION, worker));
+}
+
 #endif // OCEAN_USE_GTEST
 
 bool TestNonMaximumSuppression::testSuppressionInFrame(const unsigned int width, const unsigned int height, const unsigned int subFrameWidth, const unsigned int subFrameHeight, const bool strictMaximum, const double testDuration, Worker& worker)
@@ -1253,6 +1309,258 @@ bool TestNonMaximumSuppression::testCandidate(const double testDuration)
 	return validation.succeeded();
 }
 
+template <typename T>
+bool TestNonMaximumSuppression::testSuppressionInResponseFrame(const unsigned int width, const unsigned int height, const double testDuration, Worker& worker)
+{
+	ocean_assert(width >= 3u && height >= 3u);
+	ocean_assert(testDuration > 0.0);
+
+	using ResponsePosition = typename CV::NonMaximumSuppressionT<T>::template StrengthPosition<unsigned int, T>;
+	using ResponsePositions = std::vector<ResponsePosition>;
+
+	Log::info() << "Test non maximum suppression in " << width << "x" << height << " response frame with data type '" << TypeNamer::name<T>() << "':";
+	Log::info() << " ";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	HighPerformanceStatistic performanceCandidatesSinglecore;
+	HighPerformanceStatistic performanceCandidatesMulticore;
+
+	HighPerformanceStatistic performanceResponseSinglecore;
+	HighPerformanceStatistic performanceResponseMulticore;
+
+	const unsigned int maxWorkerIterations = worker ? 2u : 1u;
+
+	for (unsigned int workerIteration = 0u; workerIteration < maxWorkerIterations; ++workerIteration)
+	{
+		HighPerformanceStatistic& performanceCandidates = workerIteration == 0u ? performanceCandidatesSinglecore : performanceCandidatesMulticore;
+		HighPerformanceStatistic& performanceResponse = workerIteration == 0u ? performanceResponseSinglecore : performanceResponseMulticore;
+
+		Worker* useWorker = workerIteration == 0u ? nullptr : &worker;
+
+		const Timestamp startTimestamp(true);
+
+		do
+		{
+			for (const bool performanceIteration : {true, false})
+			{
+				const unsigned int testWidth = performanceIteration ? width : RandomI::random(randomGenerator, 3u, width);
+				const unsigned int testHeight = performanceIteration ? height : RandomI::random(randomGenerator, 3u, height);
+
+				const bool strictMaximum = performanceIteration ? true : RandomI::boolean(randomGenerator);
+
+				Frame responseFrame(FrameType(testWidth, testHeight, FrameType::genericPixelFormat<T, 1u>(), FrameType::ORIGIN_UPPER_LEFT), RandomI::random(randomGenerator, 1u, 100u) * RandomI::random(randomGenerator, 1u));
+
+				// a small value range ensures many neighbors with identical values
+
+				const unsigned int maximalValue = RandomI::random(randomGenerator, 1u, 30u);
+
+				for (unsigned int y = 0u; y < testHeight; ++y)
+				{
+					T* const row = responseFrame.row<T>(y);
+
+					for (unsigned int x = 0u; x < testWidth; ++x)
+					{
+						row[x] = T(RandomI::random(randomGenerator, maximalValue));
+					}
+				}
+
+				const T minimalThreshold = T(RandomI::random(randomGenerator, maximalValue));
+
+				ResponsePositions candidatePositions;
+
+				performanceCandidates.startIf(performanceIteration);
+					CV::NonMaximumSuppressionT<T> nonMaximumSuppression(testWidth, testHeight);
+					nonMaximumSuppression.addCandidates(responseFrame.constdata<T>(), responseFrame.paddingElements(), 0u, testWidth, 0u, testHeight, minimalThreshold, useWorker);
+
+					if (strictMaximum)
+					{
+						nonMaximumSuppression.template suppressNonMaximum<unsigned int, T, true>(0u, testWidth, 0u, testHeight, candidatePositions, useWorker);
+					}
+					else
+					{
+						nonMaximumSuppression.template suppressNonMaximum<unsigned int, T, false>(0u, testWidth, 0u, testHeight, candidatePositions, useWorker);
+					}
+				performanceCandidates.stopIf(performanceIteration);
+
+				ResponsePositions responsePositions;
+
+				performanceResponse.startIf(performanceIteration);
+					if (strictMaximum)
+					{
+						CV::NonMaximumSuppressionT<T>::template suppressNonMaximumInFrame<unsigned int, T, true>(responseFrame.constdata<T>(), testWidth, testHeight, responseFrame.paddingElements(), minimalThreshold, responsePositions, useWorker);
+					}
+					else
+					{
+						CV::NonMaximumSuppressionT<T>::template suppressNonMaximumInFrame<unsigned int, T, false>(responseFrame.constdata<T>(), testWidth, testHeight, responseFrame.paddingElements(), minimalThreshold, responsePositions, useWorker);
+					}
+				performanceResponse.stopIf(performanceIteration);
+
+				// the candidate-based suppression does not guarantee any order when using a worker, the response-based suppression provides the positions row by row
+
+				std::sort(candidatePositions.begin(), candidatePositions.end(), [](const ResponsePosition& first, const ResponsePosition& second) { return first.y() < second.y() || (first.y() == second.y() && first.x() < second.x()); });
+
+				if (responsePositions.size() == candidatePositions.size())
+				{
+					for (size_t n = 0; n < responsePositions.size(); ++n)
+					{
+						const ResponsePosition& responsePosition = responsePositions[n];
+						const ResponsePosition& candidatePosition = candidatePositions[n];
+
+						if (responsePosition.x() != candidatePosition.x() || responsePosition.y() != candidatePosition.y() || responsePosition.strength() != candidatePosition.strength())
+						{
+							OCEAN_SET_FAILED(validation);
+							break;
+						}
+					}
+				}
+				else
+				{
+					OCEAN_SET_FAILED(validation);
+				}
+			}
+		}
+		while (!startTimestamp.hasTimePassed(testDuration));
+	}
+
+	Log::info() << "Singlecore candidate-based: " << performanceCandidatesSinglecore;
+	Log::info() << "Singlecore response-based: " << performanceResponseSinglecore;
+
+	if (performanceCandidatesMulticore.measurements() != 0u)
+	{
+		Log::info() << " ";
+		Log::info() << "Multicore candidate-based: " << performanceCandidatesMulticore;
+		Log::info() << "Multicore response-based: " << performanceResponseMulticore;
+	}
+
+	Log::info() << " ";
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
+template <typename T>
+bool TestNonMaximumSuppression::testSuppressionInResponseFrameStrongestPerBin(const unsigned int width, const unsigned int height, const double testDuration, Worker& worker)
+{
+	ocean_assert(width >= 3u && height >= 3u);
+	ocean_assert(testDuration > 0.0);
+
+	using ResponsePosition = typename CV::NonMaximumSuppressionT<T>::template StrengthPosition<unsigned int, T>;
+	using ResponsePositions = std::vector<ResponsePosition>;
+
+	Log::info() << "Test non maximum suppression with strongest positions per bin in " << width << "x" << height << " response frame with data type '" << TypeNamer::name<T>() << "':";
+	Log::info() << " ";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	HighPerformanceStatistic performanceSinglecore;
+	HighPerformanceStatistic performanceMulticore;
+
+	const unsigned int maxWorkerIterations = worker ? 2u : 1u;
+
+	for (unsigned int workerIteration = 0u; workerIteration < maxWorkerIterations; ++workerIteration)
+	{
+		HighPerformanceStatistic& performance = workerIteration == 0u ? performanceSinglecore : performanceMulticore;
+
+		Worker* useWorker = workerIteration == 0u ? nullptr : &worker;
+
+		const Timestamp startTimestamp(true);
+
+		do
+		{
+			for (const bool performanceIteration : {true, false})
+			{
+				const unsigned int testWidth = performanceIteration ? width : RandomI::random(randomGenerator, 3u, width);
+				const unsigned int testHeight = performanceIteration ? height : RandomI::random(randomGenerator, 3u, height);
+
+				const unsigned int horizontalBins = performanceIteration ? std::min(20u, testWidth) : RandomI::random(randomGenerator, 1u, std::min(40u, testWidth));
+				const unsigned int verticalBins = performanceIteration ? std::min(20u, testHeight) : RandomI::random(randomGenerator, 1u, std::min(40u, testHeight));
+
+				const unsigned int maximalPositionsPerBin = performanceIteration ? 5u : RandomI::random(randomGenerator, 1u, 20u);
+
+				Frame responseFrame(FrameType(testWidth, testHeight, FrameType::genericPixelFormat<T, 1u>(), FrameType::ORIGIN_UPPER_LEFT), RandomI::random(randomGenerator, 1u, 100u) * RandomI::random(randomGenerator, 1u));
+
+				const unsigned int maximalValue = RandomI::random(randomGenerator, 1u, 1000u);
+
+				for (unsigned int y = 0u; y < testHeight; ++y)
+				{
+					T* const row = responseFrame.row<T>(y);
+
+					for (unsigned int x = 0u; x < testWidth; ++x)
+					{
+						row[x] = T(RandomI::random(randomGenerator, maximalValue));
+					}
+				}
+
+				const T minimalThreshold = T(RandomI::random(randomGenerator, maximalValue));
+
+				ResponsePositions positions;
+
+				performance.startIf(performanceIteration);
+					CV::NonMaximumSuppressionT<T>::template suppressNonMaximumInFrameStrongestPerBin<unsigned int, T, true>(responseFrame.constdata<T>(), testWidth, testHeight, responseFrame.paddingElements(), minimalThreshold, horizontalBins, verticalBins, maximalPositionsPerBin, positions, useWorker);
+				performance.stopIf(performanceIteration);
+
+				// determining all maxima, distributing them into the bins, and keeping the strongest maxima of each bin
+
+				ResponsePositions allPositions;
+				CV::NonMaximumSuppressionT<T>::template suppressNonMaximumInFrame<unsigned int, T, true>(responseFrame.constdata<T>(), testWidth, testHeight, responseFrame.paddingElements(), minimalThreshold, allPositions, nullptr);
+
+				std::vector<ResponsePositions> bins(horizontalBins * verticalBins);
+
+				for (const ResponsePosition& position : allPositions)
+				{
+					const unsigned int xBin = position.x() * horizontalBins / testWidth;
+					const unsigned int yBin = position.y() * verticalBins / testHeight;
+
+					bins[yBin * horizontalBins + xBin].push_back(position);
+				}
+
+				ResponsePositions testPositions;
+
+				for (ResponsePositions& bin : bins)
+				{
+					// the positions in each bin are already ordered row by row
+
+					std::stable_sort(bin.begin(), bin.end(), [](const ResponsePosition& first, const ResponsePosition& second) { return first.strength() > second.strength(); });
+
+					testPositions.insert(testPositions.end(), bin.begin(), bin.begin() + std::min(bin.size(), size_t(maximalPositionsPerBin)));
+				}
+
+				if (positions.size() == testPositions.size())
+				{
+					for (size_t n = 0; n < positions.size(); ++n)
+					{
+						if (positions[n].x() != testPositions[n].x() || positions[n].y() != testPositions[n].y() || positions[n].strength() != testPositions[n].strength())
+						{
+							OCEAN_SET_FAILED(validation);
+							break;
+						}
+					}
+				}
+				else
+				{
+					OCEAN_SET_FAILED(validation);
+				}
+			}
+		}
+		while (!startTimestamp.hasTimePassed(testDuration));
+	}
+
+	Log::info() << "Singlecore performance: " << performanceSinglecore;
+
+	if (performanceMulticore.measurements() != 0u)
+	{
+		Log::info() << "Multicore performance: " << performanceMulticore;
+	}
+
+	Log::info() << " ";
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
 void TestNonMaximumSuppression::createFeaturePoints(Frame& yFrame, const unsigned int features, const uint8_t featurePointStrength)
 {
 	ocean_assert(yFrame.isValid() && yFrame.pixelFormat() == FrameType::FORMAT_Y8);
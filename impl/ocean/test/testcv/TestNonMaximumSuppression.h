@@ -142,6 +142,30 @@ class OCEAN_TEST_CV_EXPORT TestNonMaximumSuppression
 		 */
 		static bool testCandidate(const double testDuration);
 
+		/**
+		 * Tests the non maximum suppression applied directly on a response frame.
+		 * @param width The maximal width of the test frame in pixel, with range [3, infinity)
+		 * @param height The maximal height of the test frame in pixel, with range [3, infinity)
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @param worker The worker object
+		 * @return True, if succeeded
+		 * @tparam T The data type of the response values
+		 */
+		template <typename T>
+		static bool testSuppressionInResponseFrame(const unsigned int width, const unsigned int height, const double testDuration, Worker& worker);
+
+		/**
+		 * Tests the non maximum suppression applied directly on a response frame keeping the strongest positions in each bin.
+		 * @param width The maximal width of the test frame in pixel, with range [3, infinity)
+		 * @param height The maximal height of the test frame in pixel, with range [3, infinity)
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @param worker The worker object
+		 * @return True, if succeeded
+		 * @tparam T The data type of the response values
+		 */
+		template <typename T>
+		static bool testSuppressionInResponseFrameStrongestPerBin(const unsigned int width, const unsigned int height, const double testDuration, Worker& worker);
+
 	protected:
 
 		/**
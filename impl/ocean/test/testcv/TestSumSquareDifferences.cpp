@@ -72,6 +72,15 @@ bool TestSumSquareDifferences::test(const double testDuration, const TestSelecto
 	{
 		testResult = testPatchMirroredBorder8BitPerChannel(testDuration);
 
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
+	if (selector.shouldRun("patchcandidates8bitperchannel"))
+	{
+		testResult = testPatchCandidates8BitPerChannel(testDuration);
+
 		Log::info() << " ";
 	}
 
@@ -107,6 +116,11 @@ TEST(TestSumSquareDifferences, PatchMirroredBorder8BitPerChannel)
 	EXPECT_TRUE(TestSumSquareDifferences::testPatchMirroredBorder8BitPerChannel(GTEST_TEST_DURATION));
 }
 
+TEST(TestSumSquareDifferences, PatchCandidates8BitPerChannel)
+{
+	EXPECT_TRUE(TestSumSquareDifferences::testPatchCandidates8BitPerChannel(GTEST_TEST_DURATION));
+}
+
 #endif
 
 bool TestSumSquareDifferences::testPatch8BitPerChannel(const double testDuration)
@@ -813,6 +827,89 @@ bool TestSumSquareDifferences::testPatchMirroredBorder8BitPerChannel(const doubl
 	return validation.succeeded();
 }
 
+bool TestSumSquareDifferences::testPatchCandidates8BitPerChannel(const double testDuration)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "SSD between one patch and several candidate patches:";
+	Log::info() << " ";
+
+	constexpr unsigned int width = 1280u;
+	constexpr unsigned int height = 720u;
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	OCEAN_EXPECT_TRUE(validation, testPatchCandidates8BitPerChannel<1u, 5u>(width, height, testDuration));
+
+	Log::info() << " ";
+
+	OCEAN_EXPECT_TRUE(validation, testPatchCandidates8BitPerChannel<2u, 5u>(width, height, testDuration));
+
+	Log::info() << " ";
+
+	OCEAN_EXPECT_TRUE(validation, testPatchCandidates8BitPerChannel<3u, 5u>(width, height, testDuration));
+
+	Log::info() << " ";
+
+	OCEAN_EXPECT_TRUE(validation, testPatchCandidates8BitPerChannel<4u, 5u>(width, height, testDuration));
+
+	Log::info() << " ";
+	Log::info() << " ";
+
+	OCEAN_EXPECT_TRUE(validation, testPatchCandidates8BitPerChannel<1u, 7u>(width, height, testDuration));
+
+	Log::info() << " ";
+
+	OCEAN_EXPECT_TRUE(validation, testPatchCandidates8BitPerChannel<2u, 7u>(width, height, testDuration));
+
+	Log::info() << " ";
+
+	OCEAN_EXPECT_TRUE(validation, testPatchCandidates8BitPerChannel<3u, 7u>(width, height, testDuration));
+
+	Log::info() << " ";
+
+	OCEAN_EXPECT_TRUE(validation, testPatchCandidates8BitPerChannel<4u, 7u>(width, height, testDuration));
+
+	Log::info() << " ";
+	Log::info() << " ";
+
+	OCEAN_EXPECT_TRUE(validation, testPatchCandidates8BitPerChannel<1u, 15u>(width, height, testDuration));
+
+	Log::info() << " ";
+
+	OCEAN_EXPECT_TRUE(validation, testPatchCandidates8BitPerChannel<2u, 15u>(width, height, testDuration));
+
+	Log::info() << " ";
+
+	OCEAN_EXPECT_TRUE(validation, testPatchCandidates8BitPerChannel<3u, 15u>(width, height, testDuration));
+
+	Log::info() << " ";
+
+	OCEAN_EXPECT_TRUE(validation, testPatchCandidates8BitPerChannel<4u, 15u>(width, height, testDuration));
+
+	Log::info() << " ";
+	Log::info() << " ";
+
+	OCEAN_EXPECT_TRUE(validation, testPatchCandidates8BitPerChannel<1u, 31u>(width, height, testDuration));
+
+	Log::info() << " ";
+
+	OCEAN_EXPECT_TRUE(validation, testPatchCandidates8BitPerChannel<2u, 31u>(width, height, testDuration));
+
+	Log::info() << " ";
+
+	OCEAN_EXPECT_TRUE(validation, testPatchCandidates8BitPerChannel<3u, 31u>(width, height, testDuration));
+
+	Log::info() << " ";
+
+	OCEAN_EXPECT_TRUE(validation, testPatchCandidates8BitPerChannel<4u, 31u>(width, height, testDuration));
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
 template <unsigned int tChannels, unsigned int tPatchSize>
 bool TestSumSquareDifferences::testPatch8BitPerChannel(const unsigned int width, const unsigned int height, const double testDuration)
 {
@@ -2000,6 +2097,138 @@ bool TestSumSquareDifferences::testPatchMirroredBorder8BitPerChannel(const unsig
 	return validation.succeeded();
 }
 
+template <unsigned int tChannels, unsigned int tPatchSize>
+bool TestSumSquareDifferences::testPatchCandidates8BitPerChannel(const unsigned int width, const unsigned int height, const double testDuration)
+{
+	static_assert(tChannels >= 1u, "Invalid channel number!");
+	static_assert(tPatchSize % 2u == 1u, "Invalid size");
+
+	constexpr unsigned int searchRadius = 4u;
+
+	ocean_assert(width >= tPatchSize + searchRadius * 2u && height >= tPatchSize + searchRadius * 2u);
+	ocean_assert(testDuration > 0.0);
+
+	constexpr unsigned int tPatchSize_2 = tPatchSize / 2u;
+
+	Log::info() << "... with " << tChannels << " channels and " << tPatchSize * tPatchSize << " pixels (" << tPatchSize << "x" << tPatchSize << "):";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	HighPerformanceStatistic performanceIndividual;
+	HighPerformanceStatistic performanceCandidates;
+
+	constexpr size_t locations = 1000;
+
+	// each location is compared with all candidates within a (searchRadius * 2 + 1)x(searchRadius * 2 + 1) search window
+
+	constexpr size_t candidatesPerLocation = size_t(searchRadius * 2u + 1u) * size_t(searchRadius * 2u + 1u);
+
+	CV::PixelPositions centers0(locations);
+	CV::PixelPositions centers1(locations * candidatesPerLocation);
+
+	Indices32 resultsIndividual(centers1.size());
+	Indices32 resultsCandidates(centers1.size());
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		const unsigned int width0 = RandomI::random(randomGenerator, width - 1u, width + 1u);
+		const unsigned int height0 = RandomI::random(randomGenerator, height - 1u, height + 1u);
+
+		const unsigned int width1 = RandomI::random(randomGenerator, width - 1u, width + 1u);
+		const unsigned int height1 = RandomI::random(randomGenerator, height - 1u, height + 1u);
+
+		const unsigned int paddingElements0 = RandomI::random(randomGenerator, 1u, 100u) * RandomI::random(randomGenerator, 1u);
+		const unsigned int paddingElements1 = RandomI::random(randomGenerator, 1u, 100u) * RandomI::random(randomGenerator, 1u);
+
+		Frame frame0(FrameType(width0, height0, FrameType::genericPixelFormat<uint8_t, tChannels>(), FrameType::ORIGIN_UPPER_LEFT), paddingElements0);
+		Frame frame1(FrameType(width1, height1, FrameType::genericPixelFormat<uint8_t, tChannels>(), FrameType::ORIGIN_UPPER_LEFT), paddingElements1);
+
+		CV::CVUtilities::randomizeFrame(frame0, false, &randomGenerator);
+		CV::CVUtilities::randomizeFrame(frame1, false, &randomGenerator);
+
+		for (size_t n = 0; n < locations; ++n)
+		{
+			unsigned int searchCenterX1 = RandomI::random(randomGenerator, tPatchSize_2 + searchRadius, width1 - tPatchSize_2 - searchRadius - 1u);
+			unsigned int searchCenterY1 = RandomI::random(randomGenerator, tPatchSize_2 + searchRadius, height1 - tPatchSize_2 - searchRadius - 1u);
+
+			if (n == 0)
+			{
+				// valid locations nearest to buffer boundaries to test for memory access violation bugs
+
+				centers0[n] = CV::PixelPosition(tPatchSize_2, tPatchSize_2);
+
+				searchCenterX1 = tPatchSize_2 + searchRadius;
+				searchCenterY1 = tPatchSize_2 + searchRadius;
+			}
+			else if (n == 1)
+			{
+				centers0[n] = CV::PixelPosition(width0 - tPatchSize_2 - 1u, height0 - tPatchSize_2 - 1u);
+
+				searchCenterX1 = width1 - tPatchSize_2 - searchRadius - 1u;
+				searchCenterY1 = height1 - tPatchSize_2 - searchRadius - 1u;
+			}
+			else
+			{
+				centers0[n] = CV::PixelPosition(RandomI::random(randomGenerator, tPatchSize_2, width0 - tPatchSize_2 - 1u), RandomI::random(randomGenerator, tPatchSize_2, height0 - tPatchSize_2 - 1u));
+			}
+
+			CV::PixelPosition* candidates = centers1.data() + n * candidatesPerLocation;
+
+			for (unsigned int y = searchCenterY1 - searchRadius; y <= searchCenterY1 + searchRadius; ++y)
+			{
+				for (unsigned int x = searchCenterX1 - searchRadius; x <= searchCenterX1 + searchRadius; ++x)
+				{
+					*candidates++ = CV::PixelPosition(x, y);
+				}
+			}
+		}
+
+		const uint8_t* const data0 = frame0.constdata<uint8_t>();
+		const uint8_t* const data1 = frame1.constdata<uint8_t>();
+
+		performanceIndividual.start();
+
+			for (size_t n = 0; n < locations; ++n)
+			{
+				for (size_t i = 0; i < candidatesPerLocation; ++i)
+				{
+					const size_t index = n * candidatesPerLocation + i;
+
+					resultsIndividual[index] = CV::SumSquareDifferences::patch8BitPerChannel<tChannels, tPatchSize>(data0, data1, width0, width1, centers0[n].x(), centers0[n].y(), centers1[index].x(), centers1[index].y(), paddingElements0, paddingElements1);
+				}
+			}
+
+		performanceIndividual.stop();
+
+		performanceCandidates.start();
+
+			for (size_t n = 0; n < locations; ++n)
+			{
+				const size_t index = n * candidatesPerLocation;
+
+				CV::SumSquareDifferences::patchCandidates8BitPerChannel<tChannels, tPatchSize>(data0, data1, width0, width1, centers0[n].x(), centers0[n].y(), centers1.data() + index, candidatesPerLocation, paddingElements0, paddingElements1, resultsCandidates.data() + index);
+			}
+
+		performanceCandidates.stop();
+
+		if (resultsIndividual != resultsCandidates)
+		{
+			OCEAN_SET_FAILED(validation);
+		}
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Individual: [" << performanceIndividual.bestMseconds() << ", " << performanceIndividual.medianMseconds() << ", " << performanceIndividual.worstMseconds() << "] ms";
+	Log::info() << "Candidates: [" << performanceCandidates.bestMseconds() << ", " << performanceCandidates.medianMseconds() << ", " << performanceCandidates.worstMseconds() << "] ms";
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
 IndexPair32 TestSumSquareDifferences::calculateAtBorder8BitPerChannel(const Frame& frame0, const Frame& frame1, const CV::PixelPosition& center0, const CV::PixelPosition& center1, const unsigned int patchSize)
 {
 	ocean_assert(frame0.isValid() && frame1.isValid());
@@ -86,6 +86,13 @@ class OCEAN_TEST_CV_EXPORT TestSumSquareDifferences
 		 */
 		static bool testPatchMirroredBorder8BitPerChannel(const double testDuration);
 
+		/**
+		 * Tests the sum square differences function between one image patch and several candidate image patches.
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @return True, if succeeded
+		 */
+		static bool testPatchCandidates8BitPerChannel(const double testDuration);
+
 		/**
 		 * Tests the sum square differences function for image patches with pixel accuracy which can be partially outside of the image.
 		 * @param testDuration Number of seconds for each test, with range (0, infinity)
@@ -155,6 +162,18 @@ class OCEAN_TEST_CV_EXPORT TestSumSquareDifferences
 		template <unsigned int tChannels, unsigned int tSize>
 		static bool testPatchMirroredBorder8BitPerChannel(const unsigned int width, const unsigned int height, const double testDuration);
 
+		/**
+		 * Tests the sum square differences function between one image patch and several candidate image patches.
+		 * @param width The width of the test image, in pixel, with range [tPatchSize, infinity)
+		 * @param height The height of the test image, in pixel, with range [tPatchSize, infinity)
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @return True, if succeeded
+		 * @tparam tChannels The number of frame channels, with range [1, infinity)
+		 * @tparam tPatchSize The size of the patch, with range [1, infinity)
+		 */
+		template <unsigned int tChannels, unsigned int tPatchSize>
+		static bool testPatchCandidates8BitPerChannel(const unsigned int width, const unsigned int height, const double testDuration);
+
 	protected:
 
 		/**
@@ -86,6 +86,17 @@ bool TestAdvancedFrameFilterSeparable::test(const unsigned int width, const unsi
 	{
 		testResult = testFilterInPlace<float>(width, height, testDuration, worker);
 
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
+	if (selector.shouldRun("tiledexecution"))
+	{
+		testResult = testTiledExecution<uint8_t, uint32_t>(width, height, testDuration, worker);
+		Log::info() << " ";
+		testResult = testTiledExecution<float, float>(width, height, testDuration, worker);
+
 		Log::info() << " ";
 	}
 
@@ -210,6 +221,19 @@ TEST(TestAdvancedFrameFilterSeparable, testFilterInPlace_float_7x7)
 	EXPECT_TRUE((TestAdvancedFrameFilterSeparable::testFilterInPlace<float, float>(GTEST_TEST_IMAGE_WIDTH, GTEST_TEST_IMAGE_HEIGHT, 7u, 7u, GTEST_TEST_DURATION, worker)));
 }
 
+
+TEST(TestAdvancedFrameFilterSeparable, testTiledExecution_uint8)
+{
+	Worker worker;
+	EXPECT_TRUE((TestAdvancedFrameFilterSeparable::testTiledExecution<uint8_t, uint32_t>(GTEST_TEST_IMAGE_WIDTH, GTEST_TEST_IMAGE_HEIGHT, GTEST_TEST_DURATION, worker)));
+}
+
+TEST(TestAdvancedFrameFilterSeparable, testTiledExecution_float)
+{
+	Worker worker;
+	EXPECT_TRUE((TestAdvancedFrameFilterSeparable::testTiledExecution<float, float>(GTEST_TEST_IMAGE_WIDTH, GTEST_TEST_IMAGE_HEIGHT, GTEST_TEST_DURATION, worker)));
+}
+
 #endif // OCEAN_USE_GTEST
 
 template <typename T>
@@ -515,6 +539,109 @@ bool TestAdvancedFrameFilterSeparable::testFilterInPlace(const unsigned int widt
 	return validation.succeeded();
 }
 
+template <typename T, typename TFilter>
+bool TestAdvancedFrameFilterSeparable::testTiledExecution(const unsigned int width, const unsigned int height, const double testDuration, Worker& worker)
+{
+	ocean_assert(width >= 16u && height >= 16u);
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Testing tiled execution with data type '" << TypeNamer::name<T>() << "':";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	HighPerformanceStatistic performanceFullFrame;
+	HighPerformanceStatistic performanceTiled;
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		for (const bool performanceIteration : {true, false})
+		{
+			const unsigned int horizontalFilterSize = performanceIteration ? 7u : RandomI::random(randomGenerator, 0u, 7u) * 2u + 1u;
+			const unsigned int verticalFilterSize = performanceIteration ? 7u : RandomI::random(randomGenerator, 0u, 7u) * 2u + 1u;
+
+			const unsigned int testWidth = performanceIteration ? width : RandomI::random(randomGenerator, horizontalFilterSize / 2u + 1u, width);
+			const unsigned int testHeight = performanceIteration ? height : RandomI::random(randomGenerator, verticalFilterSize / 2u + 1u, height);
+			const unsigned int channels = performanceIteration ? 3u : RandomI::random(randomGenerator, 1u, 4u);
+
+			std::vector<TFilter> horizontalFilters(horizontalFilterSize);
+			std::vector<TFilter> verticalFilters(verticalFilterSize);
+
+			for (TFilter& filterValue : horizontalFilters)
+			{
+				filterValue = TFilter(RandomI::random(randomGenerator, 1u, 16u));
+			}
+
+			for (TFilter& filterValue : verticalFilters)
+			{
+				filterValue = TFilter(RandomI::random(randomGenerator, 1u, 16u));
+			}
+
+			const Frame source = CV::CVUtilities::randomizedFrame(FrameType(testWidth, testHeight, FrameType::genericPixelFormat<T>(channels), FrameType::ORIGIN_UPPER_LEFT), &randomGenerator);
+
+			const uint8_t maskValue = uint8_t(RandomI::random(randomGenerator, 255u));
+			const Frame sourceMask = CV::CVUtilities::randomizedBinaryMask(testWidth, testHeight, maskValue, &randomGenerator);
+
+			Frame fullFrameTarget = CV::CVUtilities::randomizedFrame(source.frameType(), &randomGenerator);
+			Frame fullFrameTargetMask = CV::CVUtilities::randomizedFrame(sourceMask.frameType(), &randomGenerator);
+
+			Frame tiledTarget = CV::CVUtilities::randomizedFrame(source.frameType(), &randomGenerator);
+			Frame tiledTargetMask = CV::CVUtilities::randomizedFrame(sourceMask.frameType(), &randomGenerator);
+
+			const Frame tiledTargetCopy(tiledTarget, Frame::ACM_COPY_KEEP_LAYOUT_COPY_PADDING_DATA);
+			const Frame tiledTargetMaskCopy(tiledTargetMask, Frame::ACM_COPY_KEEP_LAYOUT_COPY_PADDING_DATA);
+
+			Worker* useWorker = !performanceIteration && RandomI::boolean(randomGenerator) ? &worker : nullptr;
+
+			performanceFullFrame.startIf(performanceIteration);
+				CV::Advanced::AdvancedFrameFilterSeparable::filter<T, TFilter>(source.constdata<T>(), sourceMask.constdata<uint8_t>(), fullFrameTarget.data<T>(), fullFrameTargetMask.data<uint8_t>(), testWidth, testHeight, channels, source.paddingElements(), sourceMask.paddingElements(), fullFrameTarget.paddingElements(), fullFrameTargetMask.paddingElements(), horizontalFilters.data(), horizontalFilterSize, verticalFilters.data(), verticalFilterSize, maskValue, useWorker, CV::FrameFilterSeparable::EM_FULL_FRAME);
+			performanceFullFrame.stopIf(performanceIteration);
+
+			performanceTiled.startIf(performanceIteration);
+				CV::Advanced::AdvancedFrameFilterSeparable::filter<T, TFilter>(source.constdata<T>(), sourceMask.constdata<uint8_t>(), tiledTarget.data<T>(), tiledTargetMask.data<uint8_t>(), testWidth, testHeight, channels, source.paddingElements(), sourceMask.paddingElements(), tiledTarget.paddingElements(), tiledTargetMask.paddingElements(), horizontalFilters.data(), horizontalFilterSize, verticalFilters.data(), verticalFilterSize, maskValue, useWorker, CV::FrameFilterSeparable::EM_TILED);
+			performanceTiled.stopIf(performanceIteration);
+
+			if (!CV::CVUtilities::isPaddingMemoryIdentical(tiledTarget, tiledTargetCopy) || !CV::CVUtilities::isPaddingMemoryIdentical(tiledTargetMask, tiledTargetMaskCopy))
+			{
+				ocean_assert(false && "Invalid padding memory!");
+				OCEAN_SET_FAILED(validation);
+				break;
+			}
+
+			// the tiled execution applies the identical operations in the identical order, so the results must be identical
+
+			for (unsigned int y = 0u; y < testHeight; ++y)
+			{
+				if (memcmp(fullFrameTargetMask.constrow<uint8_t>(y), tiledTargetMask.constrow<uint8_t>(y), testWidth) != 0)
+				{
+					OCEAN_SET_FAILED(validation);
+					break;
+				}
+
+				const uint8_t* const mask = fullFrameTargetMask.constrow<uint8_t>(y);
+
+				for (unsigned int x = 0u; x < testWidth; ++x)
+				{
+					if (mask[x] != maskValue && memcmp(fullFrameTarget.constpixel<T>(x, y), tiledTarget.constpixel<T>(x, y), sizeof(T) * channels) != 0)
+					{
+						OCEAN_SET_FAILED(validation);
+					}
+				}
+			}
+		}
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Full frame performance: Best: " << String::toAString(performanceFullFrame.bestMseconds(), 2u) << "ms, worst: " << String::toAString(performanceFullFrame.worstMseconds(), 2u) << "ms, average: " << String::toAString(performanceFullFrame.averageMseconds(), 2u) << "ms";
+	Log::info() << "Tiled performance: Best: " << String::toAString(performanceTiled.bestMseconds(), 2u) << "ms, worst: " << String::toAString(performanceTiled.worstMseconds(), 2u) << "ms, average: " << String::toAString(performanceTiled.averageMseconds(), 2u) << "ms";
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
 template <typename T>
 bool TestAdvancedFrameFilterSeparable::validateFilter(const Frame& source, const Frame& sourceMask, const Frame& target, const Frame& targetMask, const std::vector<float>& horizontalFilters, const std::vector<float>& verticalFilters, const uint8_t maskValue)
 {
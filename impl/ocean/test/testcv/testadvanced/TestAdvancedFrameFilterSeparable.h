@@ -99,6 +99,19 @@ class OCEAN_TEST_CV_ADVANCED_EXPORT TestAdvancedFrameFilterSeparable
 		template <typename T, typename TFilter>
 		static bool testFilterInPlace(const unsigned int width, const unsigned int height,const unsigned int horizontalFilterSize, const unsigned int verticalFilterSize, const double testDuration, Worker& worker);
 
+		/**
+		 * Tests the tiled execution of the filter function by comparing the results with the full-frame execution.
+		 * @param width The width of the test frame in pixel, with range [16, infinity)
+		 * @param height The height of the test frame in pixel, with range [16, infinity)
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @param worker The worker object
+		 * @return True, if succeeded
+		 * @tparam T The data type of the frame elements
+		 * @tparam TFilter The data type of the filter factors
+		 */
+		template <typename T, typename TFilter>
+		static bool testTiledExecution(const unsigned int width, const unsigned int height, const double testDuration, Worker& worker);
+
 	protected:
 
 		/**
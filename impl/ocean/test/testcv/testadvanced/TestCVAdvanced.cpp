@@ -18,6 +18,7 @@
 #include "ocean/test/testcv/testadvanced/TestFrameColorAdjustment.h"
 #include "ocean/test/testcv/testadvanced/TestFrameRectification.h"
 #include "ocean/test/testcv/testadvanced/TestPanoramaFrame.h"
+#include "ocean/test/testcv/testadvanced/TestPoissonBlending.h"
 #include "ocean/test/testcv/testadvanced/TestSumSquareDifferencesNoCenter.h"
 
 #include "ocean/test/TestResult.h"
@@ -204,6 +205,15 @@ bool testCVAdvanced(const double testDuration, Worker& worker, const unsigned in
 		testResult = TestAdvancedMotion::test(width, height, testDuration, worker, subSelector);
 	}
 
+	if (TestSelector subSelector = selector.shouldRun("poissonblending"))
+	{
+		Log::info() << " ";
+		Log::info() << " ";
+		Log::info() << " ";
+		Log::info() << " ";
+		testResult = TestPoissonBlending::test(testDuration, worker, subSelector);
+	}
+
 	Log::info() << " ";
 	Log::info() << " ";
 	Log::info() << " ";
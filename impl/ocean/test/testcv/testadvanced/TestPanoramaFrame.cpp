@@ -19,6 +19,7 @@
 #include "ocean/cv/FrameInterpolatorBilinear.h"
 
 #include "ocean/cv/advanced/AdvancedFrameInterpolatorBilinear.h"
+#include "ocean/cv/advanced/TiledPanoramaFrame.h"
 
 #include "ocean/math/Euler.h"
 #include "ocean/math/PinholeCamera.h"
@@ -65,6 +66,24 @@ bool TestPanoramaFrame::test(const double testDuration, Worker& worker, const Te
 	{
 		testResult = testRecreation(worker);
 
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
+	if (selector.shouldRun("cachedcamerarays"))
+	{
+		testResult = testCachedCameraRays(testDuration, worker);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
+	if (selector.shouldRun("tiledpanoramaframe"))
+	{
+		testResult = testTiledPanoramaFrame(testDuration, worker);
+
 		Log::info() << " ";
 	}
 
@@ -195,8 +214,63 @@ TEST(TestPanoramaFrame, Recreation)
 }
 #endif
 
+TEST(TestPanoramaFrame, CachedCameraRays)
+{
+	Worker worker;
+	EXPECT_TRUE(TestPanoramaFrame::testCachedCameraRays(GTEST_TEST_DURATION, worker));
+}
+
+TEST(TestPanoramaFrame, TiledPanoramaFrame)
+{
+	Worker worker;
+	EXPECT_TRUE(TestPanoramaFrame::testTiledPanoramaFrame(GTEST_TEST_DURATION, worker));
+}
+
 #endif // OCEAN_USE_GTEST
 
+TestPanoramaFrame::TileComposer::TileComposer(const FrameType& frameType, const unsigned int tileSize, const uint8_t maskValue) :
+	frame_(frameType),
+	mask_(FrameType(frameType, FrameType::FORMAT_Y8)),
+	tileSize_(tileSize),
+	maskValue_(maskValue)
+{
+	frame_.setValue(0x00u);
+	mask_.setValue(0xFFu - maskValue_);
+}
+
+bool TestPanoramaFrame::TileComposer::onTile(const unsigned int tileX, const unsigned int tileY, const Frame& tileFrame, const Frame& tileMask)
+{
+	ocean_assert(tileFrame.isValid() && tileMask.isValid());
+
+	const unsigned int left = tileX * tileSize_;
+	const unsigned int top = tileY * tileSize_;
+
+	if (tileFrame.pixelFormat() != frame_.pixelFormat() || left + tileFrame.width() > frame_.width() || top + tileFrame.height() > frame_.height())
+	{
+		return false;
+	}
+
+	const unsigned int channels = frame_.channels();
+
+	for (unsigned int y = 0u; y < tileFrame.height(); ++y)
+	{
+		const uint8_t* const tileMaskRow = tileMask.constrow<uint8_t>(y);
+
+		for (unsigned int x = 0u; x < tileFrame.width(); ++x)
+		{
+			if (tileMaskRow[x] == maskValue_)
+			{
+				memcpy(frame_.pixel<uint8_t>(left + x, top + y), tileFrame.constpixel<uint8_t>(x, y), channels);
+				mask_.pixel<uint8_t>(left + x, top + y)[0] = maskValue_;
+			}
+		}
+	}
+
+	++exportedTiles_;
+
+	return true;
+}
+
 bool TestPanoramaFrame::testCameraFrame2cameraFrame(const double testDuration, Worker& worker)
 {
 	ocean_assert(testDuration > 0.0);
@@ -560,6 +634,243 @@ bool TestPanoramaFrame::testRecreation(const unsigned int channels, const bool a
 	return validation.succeeded();
 }
 
+bool TestPanoramaFrame::testCachedCameraRays(const double testDuration, Worker& worker)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Testing panorama frame to camera frame with cached camera rays:";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	constexpr unsigned int panoramaWidth = 1920u * 4u;
+	constexpr unsigned int panoramaHeight = 1920u * 2u;
+
+	HighPerformanceStatistic performanceRays;
+	HighPerformanceStatistic performanceUncached;
+	HighPerformanceStatistic performanceCached;
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		const unsigned int cameraWidth = RandomI::random(randomGenerator, 320u, 1280u);
+		const unsigned int cameraHeight = RandomI::random(randomGenerator, 240u, 720u);
+
+		const PinholeCamera pinholeCamera(cameraWidth, cameraHeight, Random::scalar(randomGenerator, Numeric::deg2rad(40), Numeric::deg2rad(70)));
+
+		const unsigned int channels = RandomI::random(randomGenerator, 1u, 4u);
+
+		const unsigned int subFrameWidth = RandomI::random(randomGenerator, 1u, panoramaWidth);
+		const unsigned int subFrameHeight = RandomI::random(randomGenerator, 1u, panoramaHeight);
+
+		const CV::PixelPosition topLeft(RandomI::random(randomGenerator, panoramaWidth - subFrameWidth), RandomI::random(randomGenerator, panoramaHeight - subFrameHeight));
+
+		Frame panoramaSubFrame(FrameType(subFrameWidth, subFrameHeight, FrameType::genericPixelFormat(FrameType::DT_UNSIGNED_INTEGER_8, channels), FrameType::ORIGIN_UPPER_LEFT));
+		Frame panoramaSubMask(FrameType(panoramaSubFrame, FrameType::FORMAT_Y8));
+
+		CV::CVUtilities::randomizeFrame(panoramaSubFrame, false, &randomGenerator);
+		panoramaSubMask.setValue(0xFFu);
+
+		const SquareMatrix3 orientation(Random::euler(randomGenerator));
+
+		const unsigned int approximationBinSize = RandomI::random(randomGenerator, 2u, 40u);
+
+		Frame uncachedFrame;
+		Frame uncachedMask;
+
+		performanceUncached.start();
+			const bool uncachedResult = CV::Advanced::PanoramaFrame::panoramaFrame2cameraFrame(pinholeCamera, panoramaSubFrame, panoramaSubMask, panoramaWidth, panoramaHeight, topLeft, orientation, uncachedFrame, uncachedMask, 0xFFu, approximationBinSize, &worker);
+		performanceUncached.stop();
+
+		performanceRays.start();
+			const CV::Advanced::PanoramaFrame::RayLookupTable cameraRays = CV::Advanced::PanoramaFrame::cameraRayLookupTable(pinholeCamera, approximationBinSize);
+		performanceRays.stop();
+
+		Frame cachedFrame;
+		Frame cachedMask;
+
+		performanceCached.start();
+			const bool cachedResult = CV::Advanced::PanoramaFrame::panoramaFrame2cameraFrame(pinholeCamera, cameraRays, panoramaSubFrame, panoramaSubMask, panoramaWidth, panoramaHeight, topLeft, orientation, cachedFrame, cachedMask, 0xFFu, &worker);
+		performanceCached.stop();
+
+		OCEAN_EXPECT_TRUE(validation, uncachedResult);
+		OCEAN_EXPECT_TRUE(validation, cachedResult);
+
+		if (uncachedResult && cachedResult)
+		{
+			OCEAN_EXPECT_TRUE(validation, uncachedFrame.frameType() == cachedFrame.frameType());
+			OCEAN_EXPECT_TRUE(validation, uncachedMask.frameType() == cachedMask.frameType());
+
+			if (uncachedFrame.frameType() == cachedFrame.frameType() && uncachedMask.frameType() == cachedMask.frameType())
+			{
+				for (unsigned int y = 0u; y < uncachedFrame.height(); ++y)
+				{
+					OCEAN_EXPECT_EQUAL(validation, memcmp(uncachedFrame.constrow<void>(y), cachedFrame.constrow<void>(y), uncachedFrame.planeWidthBytes(0u)), 0);
+					OCEAN_EXPECT_EQUAL(validation, memcmp(uncachedMask.constrow<void>(y), cachedMask.constrow<void>(y), uncachedMask.planeWidthBytes(0u)), 0);
+				}
+			}
+		}
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Performance without cached rays: " << performanceUncached.averageMseconds() << "ms";
+	Log::info() << "Performance of ray determination: " << performanceRays.averageMseconds() << "ms";
+	Log::info() << "Performance with cached rays: " << performanceCached.averageMseconds() << "ms";
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
+bool TestPanoramaFrame::testTiledPanoramaFrame(const double testDuration, Worker& worker)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Testing tiled panorama frame:";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	constexpr uint8_t maskValue = 0xFFu;
+
+	const CV::Advanced::PanoramaFrame::UpdateMode updateModes[4] = {UM_SET_ALL, UM_SET_NEW, UM_AVERAGE_LOCAL, UM_AVERAGE_GLOBAL};
+
+	HighPerformanceStatistic performanceDense;
+	HighPerformanceStatistic performanceTiled;
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		const unsigned int dimensionWidth = RandomI::random(randomGenerator, 512u, 1536u) * 2u;
+		const unsigned int dimensionHeight = dimensionWidth / 2u;
+
+		const unsigned int tileSize = RandomI::random(randomGenerator, 32u, 300u);
+		const unsigned int channels = RandomI::random(randomGenerator, 1u, 4u);
+
+		const CV::Advanced::PanoramaFrame::UpdateMode updateMode = updateModes[RandomI::random(randomGenerator, 3u)];
+
+		const PinholeCamera pinholeCamera(RandomI::random(randomGenerator, 160u, 640u), RandomI::random(randomGenerator, 120u, 480u), Random::scalar(randomGenerator, Numeric::deg2rad(40), Numeric::deg2rad(80)));
+
+		Worker* useWorker = RandomI::boolean(randomGenerator) ? &worker : nullptr;
+
+		CV::Advanced::PanoramaFrame densePanoramaFrame(dimensionWidth, dimensionHeight, maskValue, updateMode);
+		CV::Advanced::TiledPanoramaFrame tiledPanoramaFrame(dimensionWidth, dimensionHeight, maskValue, updateMode, tileSize);
+
+		// the second tiled panorama frame keeps a small number of tiles in memory only, the remaining tiles are streamed to the composer
+
+		const unsigned int maximalResidentTiles = RandomI::random(randomGenerator, 1u, 4u);
+		TileComposer tileComposer(FrameType(dimensionWidth, dimensionHeight, FrameType::genericPixelFormat<uint8_t>(channels), FrameType::ORIGIN_UPPER_LEFT), tileSize, maskValue);
+
+		CV::Advanced::TiledPanoramaFrame boundedPanoramaFrame(dimensionWidth, dimensionHeight, maskValue, UM_SET_ALL, tileSize, maximalResidentTiles, CV::Advanced::TiledPanoramaFrame::TileCallback::create(tileComposer, &TileComposer::onTile));
+		CV::Advanced::PanoramaFrame denseSetAllPanoramaFrame(dimensionWidth, dimensionHeight, maskValue, UM_SET_ALL);
+
+		const unsigned int numberFrames = RandomI::random(randomGenerator, 1u, 4u);
+
+		for (unsigned int n = 0u; n < numberFrames; ++n)
+		{
+			const Euler euler(Random::scalar(randomGenerator, -Numeric::pi(), Numeric::pi()), Random::scalar(randomGenerator, Numeric::deg2rad(-30), Numeric::deg2rad(30)), Random::scalar(randomGenerator, Numeric::deg2rad(-10), Numeric::deg2rad(10)));
+			const SquareMatrix3 orientation(euler);
+
+			Frame cameraFrame = CV::CVUtilities::randomizedFrame(FrameType(pinholeCamera.width(), pinholeCamera.height(), FrameType::genericPixelFormat<uint8_t>(channels), FrameType::ORIGIN_UPPER_LEFT), &randomGenerator);
+			CV::FrameFilterGaussian::filter(cameraFrame, 5u, useWorker);
+
+			performanceDense.start();
+				OCEAN_EXPECT_TRUE(validation, densePanoramaFrame.addFrame(pinholeCamera, orientation, cameraFrame, Frame(), 0u, useWorker));
+			performanceDense.stop();
+
+			performanceTiled.start();
+				OCEAN_EXPECT_TRUE(validation, tiledPanoramaFrame.addFrame(pinholeCamera, orientation, cameraFrame, Frame(), 0u, useWorker));
+			performanceTiled.stop();
+
+			OCEAN_EXPECT_TRUE(validation, denseSetAllPanoramaFrame.addFrame(pinholeCamera, orientation, cameraFrame, Frame(), 0u, useWorker));
+			OCEAN_EXPECT_TRUE(validation, boundedPanoramaFrame.addFrame(pinholeCamera, orientation, cameraFrame, Frame(), 0u, useWorker));
+		}
+
+		OCEAN_EXPECT_LESS_EQUAL(validation, tiledPanoramaFrame.residentTiles(), size_t(tiledPanoramaFrame.tilesHorizontal() * tiledPanoramaFrame.tilesVertical()));
+
+		// all pending tiles are exported, afterwards no tile is resident anymore
+
+		boundedPanoramaFrame.exportTiles(0u, true);
+		OCEAN_EXPECT_EQUAL(validation, boundedPanoramaFrame.residentTiles(), size_t(0));
+
+		Frame tiledFrame;
+		Frame tiledMask;
+		if (!tiledPanoramaFrame.extractSubFrame(CV::PixelPosition(0u, 0u), dimensionWidth, dimensionHeight, tiledFrame, tiledMask))
+		{
+			OCEAN_SET_FAILED(validation);
+			continue;
+		}
+
+		const std::vector<std::tuple<const CV::Advanced::PanoramaFrame*, const Frame*, const Frame*>> comparisons =
+		{
+			{&densePanoramaFrame, &tiledFrame, &tiledMask},
+			{&denseSetAllPanoramaFrame, &tileComposer.frame_, &tileComposer.mask_}
+		};
+
+		for (const std::tuple<const CV::Advanced::PanoramaFrame*, const Frame*, const Frame*>& comparison : comparisons)
+		{
+			const CV::Advanced::PanoramaFrame& dense = *std::get<0>(comparison);
+			const Frame& testFrame = *std::get<1>(comparison);
+			const Frame& testMask = *std::get<2>(comparison);
+
+			const Frame& denseFrame = dense.frame();
+			const Frame& denseMask = dense.mask();
+			const CV::PixelPosition& denseTopLeft = dense.frameTopLeft();
+
+			// both panorama frames apply the identical per-pixel operations, rounding differences in the ray determination are allowed for few pixels
+
+			size_t validPixels = 0;
+			size_t invalidPixels = 0;
+
+			for (unsigned int y = 0u; y < dimensionHeight; ++y)
+			{
+				const uint8_t* const testMaskRow = testMask.constrow<uint8_t>(y);
+
+				for (unsigned int x = 0u; x < dimensionWidth; ++x)
+				{
+					bool denseValid = false;
+					const uint8_t* densePixel = nullptr;
+
+					if (x >= denseTopLeft.x() && y >= denseTopLeft.y() && x < denseTopLeft.x() + denseFrame.width() && y < denseTopLeft.y() + denseFrame.height())
+					{
+						denseValid = denseMask.constpixel<uint8_t>(x - denseTopLeft.x(), y - denseTopLeft.y())[0] == maskValue;
+						densePixel = denseFrame.constpixel<uint8_t>(x - denseTopLeft.x(), y - denseTopLeft.y());
+					}
+
+					const bool testValid = testMaskRow[x] == maskValue;
+
+					if (!denseValid && !testValid)
+					{
+						continue;
+					}
+
+					++validPixels;
+
+					if (denseValid != testValid || memcmp(densePixel, testFrame.constpixel<uint8_t>(x, y), channels) != 0)
+					{
+						++invalidPixels;
+					}
+				}
+			}
+
+			if (invalidPixels * 1000 > validPixels)
+			{
+				OCEAN_SET_FAILED(validation);
+			}
+		}
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Performance dense: " << performanceDense;
+	Log::info() << "Performance tiled: " << performanceTiled;
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
 double TestPanoramaFrame::averageFrameError(const Frame& frameA, const Frame& frameB)
 {
 	ocean_assert(frameA.isValid() && frameB.isValid());
@@ -34,6 +34,51 @@ namespace TestAdvanced
  */
 class OCEAN_TEST_CV_ADVANCED_EXPORT TestPanoramaFrame : protected CV::Advanced::PanoramaFrame
 {
+	protected:
+
+		/**
+		 * This class composes the tiles exported by a tiled panorama frame into one panorama frame.
+		 */
+		class TileComposer
+		{
+			public:
+
+				/**
+				 * Creates a new composer for a panorama frame.
+				 * @param frameType The frame type of the entire panorama frame, must be valid
+				 * @param tileSize The size of the tiles in pixel, with range [1, infinity)
+				 * @param maskValue The mask value defining valid pixels
+				 */
+				TileComposer(const FrameType& frameType, const unsigned int tileSize, const uint8_t maskValue);
+
+				/**
+				 * Event function for exported tiles, copies all valid pixels of the tile into the composed frame.
+				 * @param tileX The horizontal index of the tile
+				 * @param tileY The vertical index of the tile
+				 * @param tileFrame The frame of the tile
+				 * @param tileMask The mask of the tile
+				 * @return True, if succeeded
+				 */
+				bool onTile(const unsigned int tileX, const unsigned int tileY, const Frame& tileFrame, const Frame& tileMask);
+
+			public:
+
+				/// The composed panorama frame.
+				Frame frame_;
+
+				/// The composed panorama mask.
+				Frame mask_;
+
+				/// The size of the tiles in pixel.
+				unsigned int tileSize_ = 0u;
+
+				/// The mask value defining valid pixels.
+				uint8_t maskValue_ = 0xFFu;
+
+				/// The number of exported tiles.
+				unsigned int exportedTiles_ = 0u;
+		};
+
 	public:
 
 		/**
@@ -81,6 +126,23 @@ class OCEAN_TEST_CV_ADVANCED_EXPORT TestPanoramaFrame : protected CV::Advanced::
 		 */
 		static bool testRecreation(Worker& worker);
 
+		/**
+		 * Tests the conversion from a panorama frame to a camera frame based on cached camera rays.
+		 * The result must be identical to the conversion without cached camera rays.
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @param worker The worker object
+		 * @return True, if succeeded
+		 */
+		static bool testCachedCameraRays(const double testDuration, Worker& worker);
+
+		/**
+		 * Tests the tiled panorama frame by comparing it with a dense panorama frame and tests the export of tiles.
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @param worker The worker object
+		 * @return True, if succeeded
+		 */
+		static bool testTiledPanoramaFrame(const double testDuration, Worker& worker);
+
 	protected:
 
 		/**
@@ -0,0 +1,330 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "ocean/test/testcv/testadvanced/TestPoissonBlending.h"
+
+#include "ocean/test/TestResult.h"
+#include "ocean/test/Validation.h"
+
+#include "ocean/base/HighPerformanceTimer.h"
+#include "ocean/base/RandomI.h"
+
+#include "ocean/cv/CVUtilities.h"
+
+#include "ocean/cv/advanced/PoissonBlending.h"
+
+namespace Ocean
+{
+
+namespace Test
+{
+
+namespace TestCV
+{
+
+namespace TestAdvanced
+{
+
+bool TestPoissonBlending::test(const double testDuration, Worker& worker, const TestSelector& selector)
+{
+	ocean_assert(testDuration > 0.0);
+
+	TestResult testResult("Poisson Blending test");
+	Log::info() << " ";
+
+	if (selector.shouldRun("multigridequivalence"))
+	{
+		testResult = testMultigridEquivalence(testDuration, worker);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
+	if (selector.shouldRun("multigridknownsolution"))
+	{
+		testResult = testMultigridKnownSolution(testDuration, worker);
+
+		Log::info() << " ";
+	}
+
+	Log::info() << testResult;
+
+	return testResult.succeeded();
+}
+
+#ifdef OCEAN_USE_GTEST
+
+TEST(TestPoissonBlending, MultigridEquivalence)
+{
+	Worker worker;
+	EXPECT_TRUE(TestPoissonBlending::testMultigridEquivalence(GTEST_TEST_DURATION, worker));
+}
+
+TEST(TestPoissonBlending, MultigridKnownSolution)
+{
+	Worker worker;
+	EXPECT_TRUE(TestPoissonBlending::testMultigridKnownSolution(GTEST_TEST_DURATION, worker));
+}
+
+#endif // OCEAN_USE_GTEST
+
+bool TestPoissonBlending::testMultigridEquivalence(const double testDuration, Worker& worker)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Multigrid solver compared to sparse direct solver:";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	HighPerformanceStatistic performanceDirect;
+	HighPerformanceStatistic performanceMultigrid;
+
+	unsigned int maximalSolverDifference = 0u;
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		const unsigned int channels = RandomI::random(randomGenerator, 1u, 4u);
+
+		const unsigned int sourceWidth = RandomI::random(randomGenerator, 8u, 64u);
+		const unsigned int sourceHeight = RandomI::random(randomGenerator, 8u, 64u);
+
+		// the source frame must not overlap with the border of the target frame
+
+		const unsigned int targetWidth = sourceWidth + RandomI::random(randomGenerator, 2u, 40u);
+		const unsigned int targetHeight = sourceHeight + RandomI::random(randomGenerator, 2u, 40u);
+
+		const int left = int(RandomI::random(randomGenerator, 1u, targetWidth - sourceWidth - 1u));
+		const int top = int(RandomI::random(randomGenerator, 1u, targetHeight - sourceHeight - 1u));
+
+		const FrameType::PixelFormat pixelFormat = FrameType::genericPixelFormat(FrameType::DT_UNSIGNED_INTEGER_8, channels);
+
+		const uint8_t maskValue = RandomI::boolean(randomGenerator) ? 0xFFu : uint8_t(RandomI::random(randomGenerator, 255u));
+
+		const Frame source = CV::CVUtilities::randomizedFrame(FrameType(sourceWidth, sourceHeight, pixelFormat, FrameType::ORIGIN_UPPER_LEFT), &randomGenerator);
+		const Frame sourceMask = randomMask(sourceWidth, sourceHeight, maskValue, randomGenerator);
+
+		const Frame target = CV::CVUtilities::randomizedFrame(FrameType(source, targetWidth, targetHeight), &randomGenerator);
+
+		Frame directResult(target, Frame::ACM_COPY_KEEP_LAYOUT_COPY_PADDING_DATA);
+		Frame multigridResult(target, Frame::ACM_COPY_KEEP_LAYOUT_COPY_PADDING_DATA);
+		Frame multigridWorkerResult(target, Frame::ACM_COPY_KEEP_LAYOUT_COPY_PADDING_DATA);
+
+		performanceDirect.start();
+			CV::Advanced::PoissonBlending::poissonBlending(source, sourceMask, directResult, left, top, maskValue);
+		performanceDirect.stop();
+
+		performanceMultigrid.start();
+			CV::Advanced::PoissonBlending::poissonBlendingMultigrid(source, sourceMask, multigridResult, left, top, maskValue);
+		performanceMultigrid.stop();
+
+		CV::Advanced::PoissonBlending::poissonBlendingMultigrid(source, sourceMask, multigridWorkerResult, left, top, maskValue, &worker);
+
+		if (!CV::CVUtilities::isPaddingMemoryIdentical(multigridResult, target) || !CV::CVUtilities::isPaddingMemoryIdentical(multigridWorkerResult, target))
+		{
+			ocean_assert(false && "Invalid padding memory!");
+			return false;
+		}
+
+		// the worker distributes the rows of each red-black sweep, the result must be identical
+
+		OCEAN_EXPECT_EQUAL(validation, maximalDifference(multigridResult, multigridWorkerResult), 0u);
+
+		const unsigned int solverDifference = maximalDifference(directResult, multigridResult);
+		maximalSolverDifference = std::max(maximalSolverDifference, solverDifference);
+
+		// both solvers stop at a small residual, after rounding the results may differ slightly
+
+		OCEAN_EXPECT_LESS_EQUAL(validation, solverDifference, 2u);
+
+		// pixels outside the source mask must not be modified
+
+		for (unsigned int y = 0u; y < targetHeight; ++y)
+		{
+			for (unsigned int x = 0u; x < targetWidth; ++x)
+			{
+				const int sourceX = int(x) - left;
+				const int sourceY = int(y) - top;
+
+				const bool isMaskPixel = sourceX >= 0 && sourceY >= 0 && sourceX < int(sourceWidth) && sourceY < int(sourceHeight) && sourceMask.constpixel<uint8_t>((unsigned int)(sourceX), (unsigned int)(sourceY))[0] == maskValue;
+
+				if (!isMaskPixel)
+				{
+					OCEAN_EXPECT_EQUAL(validation, memcmp(multigridResult.constpixel<uint8_t>(x, y), target.constpixel<uint8_t>(x, y), channels), 0);
+				}
+			}
+		}
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Performance sparse direct solver: " << performanceDirect.averageMseconds() << "ms";
+	Log::info() << "Performance multigrid solver: " << performanceMultigrid.averageMseconds() << "ms";
+	Log::info() << "Maximal difference between both solvers: " << maximalSolverDifference;
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
+bool TestPoissonBlending::testMultigridKnownSolution(const double testDuration, Worker& worker)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Multigrid solver with known solution:";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		const unsigned int channels = RandomI::random(randomGenerator, 1u, 4u);
+
+		// the multigrid solver is designed for larger regions, so we also use large frames
+
+		const unsigned int sourceWidth = RandomI::random(randomGenerator, 8u, 300u);
+		const unsigned int sourceHeight = RandomI::random(randomGenerator, 8u, 300u);
+
+		const unsigned int targetWidth = sourceWidth + RandomI::random(randomGenerator, 2u, 40u);
+		const unsigned int targetHeight = sourceHeight + RandomI::random(randomGenerator, 2u, 40u);
+
+		const unsigned int left = RandomI::random(randomGenerator, 1u, targetWidth - sourceWidth - 1u);
+		const unsigned int top = RandomI::random(randomGenerator, 1u, targetHeight - sourceHeight - 1u);
+
+		const FrameType::PixelFormat pixelFormat = FrameType::genericPixelFormat(FrameType::DT_UNSIGNED_INTEGER_8, channels);
+
+		const uint8_t maskValue = RandomI::boolean(randomGenerator) ? 0xFFu : uint8_t(RandomI::random(randomGenerator, 255u));
+
+		Frame sourceMask = randomMask(sourceWidth, sourceHeight, maskValue, randomGenerator);
+
+		Frame target(FrameType(targetWidth, targetHeight, pixelFormat, FrameType::ORIGIN_UPPER_LEFT));
+		Frame source;
+
+		if (RandomI::boolean(randomGenerator))
+		{
+			// a constant source blended into a constant target must result in the constant target
+
+			const uint8_t targetValues[4] = {uint8_t(RandomI::random(randomGenerator, 255u)), uint8_t(RandomI::random(randomGenerator, 255u)), uint8_t(RandomI::random(randomGenerator, 255u)), uint8_t(RandomI::random(randomGenerator, 255u))};
+			const uint8_t sourceValues[4] = {uint8_t(RandomI::random(randomGenerator, 255u)), uint8_t(RandomI::random(randomGenerator, 255u)), uint8_t(RandomI::random(randomGenerator, 255u)), uint8_t(RandomI::random(randomGenerator, 255u))};
+
+			target.setValue<uint8_t>(targetValues, channels);
+
+			source = Frame(FrameType(target, sourceWidth, sourceHeight));
+			source.setValue<uint8_t>(sourceValues, channels);
+		}
+		else
+		{
+			// a sub-region of the target blended into the same location must not change the target, as the guidance field is identical to the gradients of the target
+
+			target = CV::CVUtilities::randomizedFrame(target.frameType(), &randomGenerator);
+
+			source = target.subFrame(left, top, sourceWidth, sourceHeight, Frame::CM_COPY_REMOVE_PADDING_LAYOUT);
+
+			// the guidance field does not contain gradients across the border of the source frame, so that the mask must not touch this border
+
+			for (unsigned int y = 0u; y < sourceHeight; ++y)
+			{
+				uint8_t* const maskRow = sourceMask.row<uint8_t>(y);
+
+				if (y == 0u || y == sourceHeight - 1u)
+				{
+					memset(maskRow, 0xFFu - maskValue, sourceWidth);
+				}
+				else
+				{
+					maskRow[0] = uint8_t(0xFFu - maskValue);
+					maskRow[sourceWidth - 1u] = uint8_t(0xFFu - maskValue);
+				}
+			}
+		}
+
+		Frame result(target, Frame::ACM_COPY_KEEP_LAYOUT_COPY_PADDING_DATA);
+
+		Worker* useWorker = RandomI::boolean(randomGenerator) ? &worker : nullptr;
+
+		CV::Advanced::PoissonBlending::poissonBlendingMultigrid(source, sourceMask, result, int(left), int(top), maskValue, useWorker);
+
+		OCEAN_EXPECT_LESS_EQUAL(validation, maximalDifference(target, result), 1u);
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
+Frame TestPoissonBlending::randomMask(const unsigned int width, const unsigned int height, const uint8_t maskValue, RandomGenerator& randomGenerator)
+{
+	ocean_assert(width >= 1u && height >= 1u);
+
+	Frame mask(FrameType(width, height, FrameType::FORMAT_Y8, FrameType::ORIGIN_UPPER_LEFT));
+	mask.setValue(uint8_t(0xFFu - maskValue));
+
+	const unsigned int shapes = RandomI::random(randomGenerator, 1u, 3u);
+
+	for (unsigned int n = 0u; n < shapes; ++n)
+	{
+		const unsigned int centerX = RandomI::random(randomGenerator, width - 1u);
+		const unsigned int centerY = RandomI::random(randomGenerator, height - 1u);
+
+		const unsigned int radiusX = RandomI::random(randomGenerator, 1u, std::max(1u, width / 2u));
+		const unsigned int radiusY = RandomI::random(randomGenerator, 1u, std::max(1u, height / 2u));
+
+		const bool ellipse = RandomI::boolean(randomGenerator);
+
+		for (unsigned int y = 0u; y < height; ++y)
+		{
+			for (unsigned int x = 0u; x < width; ++x)
+			{
+				const int dx = int(x) - int(centerX);
+				const int dy = int(y) - int(centerY);
+
+				const bool inside = ellipse ? (dx * dx * int(radiusY * radiusY) + dy * dy * int(radiusX * radiusX) <= int(radiusX * radiusX * radiusY * radiusY)) : (std::abs(dx) <= int(radiusX) && std::abs(dy) <= int(radiusY));
+
+				if (inside)
+				{
+					mask.pixel<uint8_t>(x, y)[0] = maskValue;
+				}
+			}
+		}
+	}
+
+	return mask;
+}
+
+unsigned int TestPoissonBlending::maximalDifference(const Frame& frameA, const Frame& frameB)
+{
+	ocean_assert(frameA.isValid() && frameA.frameType() == frameB.frameType());
+	ocean_assert(frameA.dataType() == FrameType::DT_UNSIGNED_INTEGER_8 && frameA.numberPlanes() == 1u);
+
+	unsigned int result = 0u;
+
+	for (unsigned int y = 0u; y < frameA.height(); ++y)
+	{
+		const uint8_t* const rowA = frameA.constrow<uint8_t>(y);
+		const uint8_t* const rowB = frameB.constrow<uint8_t>(y);
+
+		for (unsigned int n = 0u; n < frameA.planeWidthElements(0u); ++n)
+		{
+			result = std::max(result, (unsigned int)(std::abs(int(rowA[n]) - int(rowB[n]))));
+		}
+	}
+
+	return result;
+}
+
+}
+
+}
+
+}
+
+}
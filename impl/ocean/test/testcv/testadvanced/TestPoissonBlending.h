@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#ifndef META_OCEAN_TEST_TESTCV_TESTADVANCED_TEST_POISSON_BLENDING_H
+#define META_OCEAN_TEST_TESTCV_TESTADVANCED_TEST_POISSON_BLENDING_H
+
+#include "ocean/test/testcv/testadvanced/TestCVAdvanced.h"
+
+#include "ocean/base/Frame.h"
+#include "ocean/base/RandomGenerator.h"
+#include "ocean/base/Worker.h"
+
+#include "ocean/test/TestSelector.h"
+
+namespace Ocean
+{
+
+namespace Test
+{
+
+namespace TestCV
+{
+
+namespace TestAdvanced
+{
+
+/**
+ * This class implements a test for the Poisson blending.
+ * @ingroup testcvadvanced
+ */
+class OCEAN_TEST_CV_ADVANCED_EXPORT TestPoissonBlending
+{
+	public:
+
+		/**
+		 * Tests all Poisson blending functions.
+		 * @param testDuration The number of seconds for each test, with range (0, infinity)
+		 * @param worker The worker object to distribute the computation
+		 * @param selector The test selector to filter tests
+		 * @return True, if succeeded
+		 */
+		static bool test(const double testDuration, Worker& worker, const TestSelector& selector);
+
+		/**
+		 * Tests whether the multigrid solver provides the same result as the sparse direct solver.
+		 * Further, the result of the multigrid solver must be identical with and without worker.
+		 * @param testDuration The number of seconds for each test, with range (0, infinity)
+		 * @param worker The worker object to distribute the computation
+		 * @return True, if succeeded
+		 */
+		static bool testMultigridEquivalence(const double testDuration, Worker& worker);
+
+		/**
+		 * Tests the multigrid solver for configurations with known solution.
+		 * Blending a constant source into a constant target must result in the constant target value, blending a sub-region of the target into itself must not change the target.
+		 * @param testDuration The number of seconds for each test, with range (0, infinity)
+		 * @param worker The worker object to distribute the computation
+		 * @return True, if succeeded
+		 */
+		static bool testMultigridKnownSolution(const double testDuration, Worker& worker);
+
+	protected:
+
+		/**
+		 * Creates a random source mask composed of several rectangles and ellipses.
+		 * @param width The width of the mask in pixel, with range [1, infinity)
+		 * @param height The height of the mask in pixel, with range [1, infinity)
+		 * @param maskValue The value of mask pixels inside of the blending region
+		 * @param randomGenerator The random generator to be used
+		 * @return The resulting mask with pixel format FORMAT_Y8, at least one pixel has the mask value
+		 */
+		static Frame randomMask(const unsigned int width, const unsigned int height, const uint8_t maskValue, RandomGenerator& randomGenerator);
+
+		/**
+		 * Returns the maximal absolute difference between two frames with 8 bit per channel.
+		 * @param frameA The first frame, must be valid
+		 * @param frameB The second frame, with same frame type as the first frame, must be valid
+		 * @return The maximal absolute difference, with range [0, 255]
+		 */
+		static unsigned int maximalDifference(const Frame& frameA, const Frame& frameB);
+};
+
+}
+
+}
+
+}
+
+}
+
+#endif // META_OCEAN_TEST_TESTCV_TESTADVANCED_TEST_POISSON_BLENDING_H
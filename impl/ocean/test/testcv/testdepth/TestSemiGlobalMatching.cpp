@@ -0,0 +1,465 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "ocean/test/testcv/testdepth/TestSemiGlobalMatching.h"
+
+#include "ocean/base/RandomI.h"
+#include "ocean/base/Timestamp.h"
+
+#include "ocean/cv/CVUtilities.h"
+
+#include "ocean/math/Numeric.h"
+
+#include "ocean/test/TestResult.h"
+#include "ocean/test/Validation.h"
+
+namespace Ocean
+{
+
+namespace Test
+{
+
+namespace TestCV
+{
+
+namespace TestDepth
+{
+
+bool TestSemiGlobalMatching::test(const unsigned int width, const unsigned int height, const double testDuration, Worker& worker, const TestSelector& selector)
+{
+	ocean_assert(width >= 64u && height >= 64u);
+	ocean_assert(testDuration > 0.0);
+
+	TestResult testResult("Semi-Global Matching test");
+	Log::info() << " ";
+
+	if (selector.shouldRun("knowndisparity"))
+	{
+		testResult = testKnownDisparity(width, height, testDuration, worker);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
+	if (selector.shouldRun("bandborders"))
+	{
+		testResult = testBandBorders(width, height, testDuration);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
+	if (selector.shouldRun("singlevsmultithreaded"))
+	{
+		testResult = testSingleVsMultiThreaded(width, height, testDuration);
+
+		Log::info() << " ";
+	}
+
+	Log::info() << " ";
+
+	Log::info() << testResult;
+
+	return testResult.succeeded();
+}
+
+#ifdef OCEAN_USE_GTEST
+
+TEST(TestSemiGlobalMatching, KnownDisparity)
+{
+	Worker worker;
+	EXPECT_TRUE(TestSemiGlobalMatching::testKnownDisparity(GTEST_TEST_IMAGE_WIDTH, GTEST_TEST_IMAGE_HEIGHT, GTEST_TEST_DURATION, worker));
+}
+
+TEST(TestSemiGlobalMatching, BandBorders)
+{
+	EXPECT_TRUE(TestSemiGlobalMatching::testBandBorders(GTEST_TEST_IMAGE_WIDTH, GTEST_TEST_IMAGE_HEIGHT, GTEST_TEST_DURATION));
+}
+
+TEST(TestSemiGlobalMatching, SingleVsMultiThreaded)
+{
+	EXPECT_TRUE(TestSemiGlobalMatching::testSingleVsMultiThreaded(GTEST_TEST_IMAGE_WIDTH, GTEST_TEST_IMAGE_HEIGHT, GTEST_TEST_DURATION));
+}
+
+#endif // OCEAN_USE_GTEST
+
+bool TestSemiGlobalMatching::testKnownDisparity(const unsigned int width, const unsigned int height, const double testDuration, Worker& worker)
+{
+	ocean_assert(width >= 64u && height >= 64u);
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Known disparity test for " << width << "x" << height << ":";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		const unsigned int backgroundDisparity = RandomI::random(randomGenerator, 0u, 16u);
+		const unsigned int foregroundDisparity = RandomI::random(randomGenerator, backgroundDisparity + 4u, std::min(backgroundDisparity + 48u, width / 4u));
+
+		Frame frameA;
+		Frame frameB;
+		Frame groundTruth;
+		createStereoPair(width, height, backgroundDisparity, foregroundDisparity, frameA, frameB, groundTruth, randomGenerator);
+
+		const unsigned int minimalDisparity = RandomI::random(randomGenerator, 0u, backgroundDisparity);
+		const unsigned int maximalDisparity = RandomI::random(randomGenerator, foregroundDisparity, std::min(foregroundDisparity + 16u, minimalDisparity + maximalNumberDisparities_ - 1u));
+
+		for (const bool coarseToFine : {false, true})
+		{
+			for (const bool useWorker : {false, true})
+			{
+				Frame disparityMap;
+
+				bool result = false;
+
+				if (coarseToFine)
+				{
+					// the ground truth serves as previous disparity map, the matcher must find the same disparities within the restricted range
+
+					result = CV::Depth::SemiGlobalMatching::computeDisparityMap(frameA, frameB, minimalDisparity, maximalDisparity, groundTruth, 2u, disparityMap, 8u, 48u, 1.0f, useWorker ? &worker : nullptr);
+				}
+				else
+				{
+					result = CV::Depth::SemiGlobalMatching::computeDisparityMap(frameA, frameB, minimalDisparity, maximalDisparity, disparityMap, 8u, 48u, 1.0f, useWorker ? &worker : nullptr);
+				}
+
+				OCEAN_EXPECT_TRUE(validation, result);
+
+				if (!result)
+				{
+					continue;
+				}
+
+				OCEAN_EXPECT_EQUAL(validation, disparityMap.frameType(), FrameType(frameA, FrameType::FORMAT_F32));
+
+				// we skip the left border (which does not have a correspondence for all disparities) and the depth discontinuities (which contain occlusions)
+
+				constexpr unsigned int discontinuityMargin = 4u;
+
+				size_t reliablePixels = 0;
+				size_t validPixels = 0;
+				size_t accuratePixels = 0;
+
+				for (unsigned int y = 0u; y < height; ++y)
+				{
+					const float* disparityRow = disparityMap.constrow<float>(y);
+
+					for (unsigned int x = maximalDisparity + discontinuityMargin; x < width; ++x)
+					{
+						const float expectedDisparity = groundTruth.constpixel<float>(x, y)[0];
+
+						bool isDiscontinuity = false;
+
+						for (unsigned int yy = (unsigned int)(std::max(0, int(y) - int(discontinuityMargin))); !isDiscontinuity && yy <= std::min(y + discontinuityMargin, height - 1u); ++yy)
+						{
+							for (unsigned int xx = x - discontinuityMargin; xx <= std::min(x + discontinuityMargin, width - 1u); ++xx)
+							{
+								if (groundTruth.constpixel<float>(xx, yy)[0] != expectedDisparity)
+								{
+									isDiscontinuity = true;
+									break;
+								}
+							}
+						}
+
+						if (isDiscontinuity)
+						{
+							continue;
+						}
+
+						++reliablePixels;
+
+						if (!NumericF::isNan(disparityRow[x]))
+						{
+							++validPixels;
+
+							if (NumericF::abs(disparityRow[x] - expectedDisparity) <= 1.0f)
+							{
+								++accuratePixels;
+							}
+						}
+					}
+				}
+
+				ocean_assert(reliablePixels != 0);
+
+				// the random texture is unique, so that almost all pixels must have a valid and accurate disparity
+
+				OCEAN_EXPECT_GREATER_EQUAL(validation, double(validPixels), double(reliablePixels) * 0.95);
+				OCEAN_EXPECT_GREATER_EQUAL(validation, double(accuratePixels), double(validPixels) * 0.99);
+			}
+		}
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
+bool TestSemiGlobalMatching::testBandBorders(const unsigned int width, const unsigned int height, const double testDuration)
+{
+	ocean_assert(width >= 64u && height >= 64u);
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Band borders test for " << width << "x" << height << ":";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		// we use random image heights so that the image is separated into several bands
+
+		const unsigned int testHeight = RandomI::random(randomGenerator, std::max(64u, height / 2u), std::max(height, bandRows_ * 4u));
+
+		const unsigned int backgroundDisparity = RandomI::random(randomGenerator, 0u, 16u);
+		const unsigned int foregroundDisparity = RandomI::random(randomGenerator, backgroundDisparity + 4u, std::min(backgroundDisparity + 48u, width / 4u));
+
+		Frame frameA;
+		Frame frameB;
+		Frame groundTruth;
+		createStereoPair(width, testHeight, backgroundDisparity, foregroundDisparity, frameA, frameB, groundTruth, randomGenerator);
+
+		const unsigned int minimalDisparity = RandomI::random(randomGenerator, 0u, backgroundDisparity);
+		const unsigned int numberDisparities = foregroundDisparity - minimalDisparity + 1u + RandomI::random(randomGenerator, 16u);
+
+		const uint8_t penalty1 = uint8_t(RandomI::random(randomGenerator, 4u, 16u));
+		const uint8_t penalty2 = uint8_t(RandomI::random(randomGenerator, 32u, 96u));
+
+		const float maximalConsistencyError = RandomI::boolean(randomGenerator) ? 1.0f : -1.0f;
+
+		std::vector<uint32_t> censusA(size_t(width) * size_t(testHeight));
+		std::vector<uint32_t> censusB(censusA.size());
+
+		censusTransformSubset(frameA.constdata<uint8_t>(), width, testHeight, frameA.paddingElements(), censusA.data(), 0u, testHeight);
+		censusTransformSubset(frameB.constdata<uint8_t>(), width, testHeight, frameB.paddingElements(), censusB.data(), 0u, testHeight);
+
+		// the reference aggregates all paths along the entire image, without any band
+
+		Frame entireDisparityMap(groundTruth.frameType());
+		computeDisparityMapSubset(censusA.data(), censusB.data(), width, testHeight, minimalDisparity, numberDisparities, nullptr, 0u, 0u, penalty1, penalty2, maximalConsistencyError, entireDisparityMap.data<float>(), entireDisparityMap.paddingElements(), 0u, testHeight);
+
+		const unsigned int bands = numberBands(testHeight);
+
+		Frame bandDisparityMap(groundTruth.frameType());
+		computeDisparityMapBands(censusA.data(), censusB.data(), width, testHeight, minimalDisparity, numberDisparities, nullptr, 0u, 0u, penalty1, penalty2, maximalConsistencyError, bandDisparityMap.data<float>(), bandDisparityMap.paddingElements(), bands, 0u, bands);
+
+		// the overlapping margin must be large enough so that the paths starting in the margin have converged at the band borders
+
+		for (unsigned int band = 1u; band < bands; ++band)
+		{
+			const unsigned int borderRow = bandFirstRow(band, bands, testHeight);
+
+			const unsigned int firstRow = borderRow - std::min(borderRow, bandMarginRows_);
+			const unsigned int endRow = std::min(borderRow + bandMarginRows_, testHeight);
+
+			size_t accuratePixels = 0;
+			size_t inaccurateBandPixels = 0;
+
+			for (unsigned int y = firstRow; y < endRow; ++y)
+			{
+				const float* groundTruthRow = groundTruth.constrow<float>(y);
+				const float* entireRow = entireDisparityMap.constrow<float>(y);
+				const float* bandRow = bandDisparityMap.constrow<float>(y);
+
+				for (unsigned int x = 0u; x < width; ++x)
+				{
+					// each pixel with accurate disparity in the reference must be accurate in the bands as well
+
+					if (!NumericF::isNan(groundTruthRow[x]) && !NumericF::isNan(entireRow[x]) && NumericF::abs(entireRow[x] - groundTruthRow[x]) <= 1.0f)
+					{
+						++accuratePixels;
+
+						if (NumericF::isNan(bandRow[x]) || NumericF::abs(bandRow[x] - groundTruthRow[x]) > 1.0f)
+						{
+							++inaccurateBandPixels;
+						}
+					}
+				}
+			}
+
+			OCEAN_EXPECT_LESS_EQUAL(validation, double(inaccurateBandPixels), double(accuratePixels) * 0.005);
+		}
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
+bool TestSemiGlobalMatching::testSingleVsMultiThreaded(const unsigned int width, const unsigned int height, const double testDuration)
+{
+	ocean_assert(width >= 64u && height >= 64u);
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Single-threaded vs. multi-threaded test for " << width << "x" << height << ":";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		const unsigned int testHeight = RandomI::random(randomGenerator, std::max(64u, height / 2u), std::max(height, bandRows_ * 4u));
+
+		const unsigned int backgroundDisparity = RandomI::random(randomGenerator, 0u, 16u);
+		const unsigned int foregroundDisparity = RandomI::random(randomGenerator, backgroundDisparity + 4u, std::min(backgroundDisparity + 48u, width / 4u));
+
+		Frame frameA;
+		Frame frameB;
+		Frame groundTruth;
+		createStereoPair(width, testHeight, backgroundDisparity, foregroundDisparity, frameA, frameB, groundTruth, randomGenerator);
+
+		const unsigned int maximalDisparity = foregroundDisparity + RandomI::random(randomGenerator, 16u);
+
+		Frame singleThreadedDisparityMap;
+		OCEAN_EXPECT_TRUE(validation, CV::Depth::SemiGlobalMatching::computeDisparityMap(frameA, frameB, 0u, maximalDisparity, singleThreadedDisparityMap));
+
+		const unsigned int numberThreads = RandomI::random(randomGenerator, 2u, 8u);
+
+		Worker worker(numberThreads, Worker::TYPE_CUSTOM);
+
+		Frame multiThreadedDisparityMap;
+		OCEAN_EXPECT_TRUE(validation, CV::Depth::SemiGlobalMatching::computeDisparityMap(frameA, frameB, 0u, maximalDisparity, multiThreadedDisparityMap, 8u, 48u, 1.0f, &worker));
+
+		if (singleThreadedDisparityMap.isValid() && multiThreadedDisparityMap.isValid())
+		{
+			// the rows directly above and below each band border
+
+			const unsigned int bands = numberBands(testHeight);
+
+			for (unsigned int band = 1u; band < bands; ++band)
+			{
+				const unsigned int borderRow = bandFirstRow(band, bands, testHeight);
+
+				OCEAN_EXPECT_TRUE(validation, isIdentical(singleThreadedDisparityMap, multiThreadedDisparityMap, borderRow - 1u, 2u));
+			}
+
+			OCEAN_EXPECT_TRUE(validation, isIdentical(singleThreadedDisparityMap, multiThreadedDisparityMap, 0u, testHeight));
+		}
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
+void TestSemiGlobalMatching::createStereoPair(const unsigned int width, const unsigned int height, const unsigned int backgroundDisparity, const unsigned int foregroundDisparity, Frame& frameA, Frame& frameB, Frame& groundTruth, RandomGenerator& randomGenerator)
+{
+	ocean_assert(width >= 64u && height >= 64u);
+	ocean_assert(backgroundDisparity < foregroundDisparity && foregroundDisparity <= width / 4u);
+
+	frameA = CV::CVUtilities::randomizedFrame(FrameType(width, height, FrameType::FORMAT_Y8, FrameType::ORIGIN_UPPER_LEFT), &randomGenerator);
+	frameB = CV::CVUtilities::randomizedFrame(frameA.frameType(), &randomGenerator);
+
+	groundTruth.set(FrameType(frameA, FrameType::FORMAT_F32), true /*forceOwner*/, true /*forceWritable*/);
+	groundTruth.setValue<float>({float(backgroundDisparity)});
+
+	// the foreground object covers a random rectangle in the right half of the first image
+
+	const unsigned int objectLeft = RandomI::random(randomGenerator, width / 2u, width * 3u / 4u);
+	const unsigned int objectRight = RandomI::random(randomGenerator, objectLeft + 16u, width - 1u);
+	const unsigned int objectTop = RandomI::random(randomGenerator, height / 8u, height / 2u);
+	const unsigned int objectBottom = RandomI::random(randomGenerator, objectTop + 16u, height - 1u);
+
+	for (unsigned int y = objectTop; y <= objectBottom; ++y)
+	{
+		float* groundTruthRow = groundTruth.row<float>(y);
+
+		for (unsigned int x = objectLeft; x <= objectRight; ++x)
+		{
+			groundTruthRow[x] = float(foregroundDisparity);
+		}
+	}
+
+	// the second image is rendered from the first image, the foreground object is rendered last and occludes the background
+
+	for (const bool foreground : {false, true})
+	{
+		for (unsigned int y = 0u; y < height; ++y)
+		{
+			const uint8_t* rowA = frameA.constrow<uint8_t>(y);
+			const float* groundTruthRow = groundTruth.constrow<float>(y);
+
+			uint8_t* rowB = frameB.row<uint8_t>(y);
+
+			for (unsigned int x = 0u; x < width; ++x)
+			{
+				const unsigned int disparity = (unsigned int)(groundTruthRow[x]);
+
+				if ((disparity == foregroundDisparity) == foreground && x >= disparity)
+				{
+					rowB[x - disparity] = rowA[x];
+				}
+			}
+		}
+	}
+
+	// background pixels occluded in the second image do not have a valid disparity
+
+	for (unsigned int y = objectTop; y <= objectBottom; ++y)
+	{
+		float* groundTruthRow = groundTruth.row<float>(y);
+
+		for (unsigned int x = 0u; x < objectLeft; ++x)
+		{
+			const unsigned int xB = x - std::min(x, backgroundDisparity);
+
+			if (x >= backgroundDisparity && xB + foregroundDisparity >= objectLeft && xB + foregroundDisparity <= objectRight)
+			{
+				groundTruthRow[x] = NumericF::nan();
+			}
+		}
+	}
+}
+
+bool TestSemiGlobalMatching::isIdentical(const Frame& disparityMapA, const Frame& disparityMapB, const unsigned int firstRow, const unsigned int numberRows)
+{
+	ocean_assert(disparityMapA.isValid() && disparityMapA.frameType() == disparityMapB.frameType());
+	ocean_assert(firstRow + numberRows <= disparityMapA.height());
+
+	for (unsigned int y = firstRow; y < firstRow + numberRows; ++y)
+	{
+		const float* rowA = disparityMapA.constrow<float>(y);
+		const float* rowB = disparityMapB.constrow<float>(y);
+
+		for (unsigned int x = 0u; x < disparityMapA.width(); ++x)
+		{
+			if (NumericF::isNan(rowA[x]) != NumericF::isNan(rowB[x]))
+			{
+				return false;
+			}
+
+			if (!NumericF::isNan(rowA[x]) && rowA[x] != rowB[x])
+			{
+				return false;
+			}
+		}
+	}
+
+	return true;
+}
+
+} // namespace TestDepth
+
+} // namespace TestCV
+
+} // namespace Test
+
+} // namespace Ocean
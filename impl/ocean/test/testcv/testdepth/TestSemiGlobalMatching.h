@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#ifndef META_OCEAN_TEST_TESTCV_TESTDEPTH_TEST_SEMI_GLOBAL_MATCHING_H
+#define META_OCEAN_TEST_TESTCV_TESTDEPTH_TEST_SEMI_GLOBAL_MATCHING_H
+
+#include "ocean/test/testcv/testdepth/TestCVDepth.h"
+
+#include "ocean/base/RandomGenerator.h"
+
+#include "ocean/cv/depth/SemiGlobalMatching.h"
+
+#include "ocean/test/TestSelector.h"
+
+namespace Ocean
+{
+
+namespace Test
+{
+
+namespace TestCV
+{
+
+namespace TestDepth
+{
+
+/**
+ * This class implements tests for the Semi-Global Matching stereo matcher.
+ * @ingroup testcvdepth
+ */
+class OCEAN_TEST_CV_DEPTH_EXPORT TestSemiGlobalMatching : protected CV::Depth::SemiGlobalMatching
+{
+	public:
+
+		/**
+		 * Tests all Semi-Global Matching functions.
+		 * @param width The width of the test frame in pixel, with range [64, infinity)
+		 * @param height The height of the test frame in pixel, with range [64, infinity)
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @param worker The worker object to distribute the computational load
+		 * @param selector The test selector
+		 * @return True, if succeeded
+		 */
+		static bool test(const unsigned int width, const unsigned int height, const double testDuration, Worker& worker, const TestSelector& selector);
+
+		/**
+		 * Tests the disparity map of a synthetic rectified stereo pair with known disparities.
+		 * @param width The width of the test frame in pixel, with range [64, infinity)
+		 * @param height The height of the test frame in pixel, with range [64, infinity)
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @param worker The worker object to distribute the computational load
+		 * @return True, if succeeded
+		 */
+		static bool testKnownDisparity(const unsigned int width, const unsigned int height, const double testDuration, Worker& worker);
+
+		/**
+		 * Tests that the disparity map of an image separated into bands matches the disparity map of the entire image at the borders of the bands.
+		 * @param width The width of the test frame in pixel, with range [64, infinity)
+		 * @param height The height of the test frame in pixel, with range [64, infinity)
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @return True, if succeeded
+		 */
+		static bool testBandBorders(const unsigned int width, const unsigned int height, const double testDuration);
+
+		/**
+		 * Tests that the disparity map determined with a worker is identical to the disparity map determined without worker, especially at the borders of the bands.
+		 * @param width The width of the test frame in pixel, with range [64, infinity)
+		 * @param height The height of the test frame in pixel, with range [64, infinity)
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @return True, if succeeded
+		 */
+		static bool testSingleVsMultiThreaded(const unsigned int width, const unsigned int height, const double testDuration);
+
+	protected:
+
+		/**
+		 * Creates a synthetic rectified stereo pair with random texture and known disparities.
+		 * The disparity map contains a background plane and a closer rectangular foreground object, a pixel (x, y) in the first image corresponds with the pixel (x - disparity, y) in the second image.
+		 * @param width The width of the frames in pixel, with range [64, infinity)
+		 * @param height The height of the frames in pixel, with range [64, infinity)
+		 * @param backgroundDisparity The disparity of the background, in pixel, with range [0, foregroundDisparity)
+		 * @param foregroundDisparity The disparity of the foreground object, in pixel, with range (backgroundDisparity, width / 4]
+		 * @param frameA The resulting first frame with pixel format FORMAT_Y8
+		 * @param frameB The resulting second frame with pixel format FORMAT_Y8
+		 * @param groundTruth The resulting ground truth disparity map of the first frame with pixel format FORMAT_F32, NaN for pixels which are occluded in the second frame
+		 * @param randomGenerator The random generator to be used
+		 */
+		static void createStereoPair(const unsigned int width, const unsigned int height, const unsigned int backgroundDisparity, const unsigned int foregroundDisparity, Frame& frameA, Frame& frameB, Frame& groundTruth, RandomGenerator& randomGenerator);
+
+		/**
+		 * Returns whether two disparity maps are identical, NaN values must be located at the same pixels.
+		 * @param disparityMapA The first disparity map, must be valid
+		 * @param disparityMapB The second disparity map, with same frame type as the first map, must be valid
+		 * @param firstRow The first row to be compared, with range [0, height - 1]
+		 * @param numberRows The number of rows to be compared, with range [1, height - firstRow]
+		 * @return True, if so
+		 */
+		static bool isIdentical(const Frame& disparityMapA, const Frame& disparityMapB, const unsigned int firstRow, const unsigned int numberRows);
+};
+
+} // namespace TestDepth
+
+} // namespace TestCV
+
+} // namespace Test
+
+} // namespace Ocean
+
+#endif // META_OCEAN_TEST_TESTCV_TESTDEPTH_TEST_SEMI_GLOBAL_MATCHING_H
@@ -10,12 +10,15 @@
 #include "ocean/test/TestResult.h"
 #include "ocean/test/Validation.h"
 
+#include "ocean/base/HighPerformanceTimer.h"
 #include "ocean/base/RandomGenerator.h"
 #include "ocean/base/RandomI.h"
 #include "ocean/base/Timestamp.h"
 
 #include "ocean/cv/detector/Descriptor.h"
 
+#include "ocean/math/Random.h"
+
 namespace Ocean
 {
 
@@ -28,7 +31,7 @@ namespace TestCV
 namespace TestDetector
 {
 
-bool TestDescriptor::test(const double testDuration, Worker& /*worker*/, const TestSelector& selector)
+bool TestDescriptor::test(const double testDuration, Worker& worker, const TestSelector& selector)
 {
 	ocean_assert(testDuration > 0.0);
 
@@ -40,6 +43,15 @@ bool TestDescriptor::test(const double testDuration, Worker& /*worker*/, const T
 		testResult = testCalculateHammingDistance(testDuration);
 	}
 
+	if (selector.shouldRun("determinebestmatches"))
+	{
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+
+		testResult = testDetermineBestMatches(testDuration, worker);
+	}
+
 	Log::info() << " ";
 	Log::info() << testResult;
 
@@ -53,6 +65,12 @@ TEST(TestDescriptor, CalculateHammingDistance)
 	EXPECT_TRUE(TestDescriptor::testCalculateHammingDistance(GTEST_TEST_DURATION));
 }
 
+TEST(TestDescriptor, DetermineBestMatches)
+{
+	Worker worker;
+	EXPECT_TRUE(TestDescriptor::testDetermineBestMatches(GTEST_TEST_DURATION, worker));
+}
+
 #endif // OCEAN_USE_GTEST
 
 bool TestDescriptor::testCalculateHammingDistance(const double testDuration)
@@ -145,6 +163,188 @@ bool TestDescriptor::testCalculateHammingDistance(const double testDuration)
 	return validation.succeeded();
 }
 
+bool TestDescriptor::testDetermineBestMatches(const double testDuration, Worker& worker)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Test determineBestMatches():";
+	Log::info() << " ";
+
+	bool allSucceeded = true;
+
+	allSucceeded = testDetermineBestMatches<256u>(testDuration, worker) && allSucceeded;
+
+	Log::info() << " ";
+
+	allSucceeded = testDetermineBestMatches<512u>(testDuration, worker) && allSucceeded;
+
+	Log::info() << " ";
+
+	if (allSucceeded)
+	{
+		Log::info() << "Validation: succeeded.";
+	}
+	else
+	{
+		Log::info() << "Validation: FAILED!";
+	}
+
+	return allSucceeded;
+}
+
+template <unsigned int tBits>
+bool TestDescriptor::testDetermineBestMatches(const double testDuration, Worker& worker)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "... with " << tBits << " bits:";
+
+	constexpr size_t descriptorBytes = size_t(tBits / 8u);
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	HighPerformanceStatistic performanceSinglecore;
+	HighPerformanceStatistic performanceMulticore;
+
+	const unsigned int maxWorkerIterations = worker ? 2u : 1u;
+
+	const Timestamp start(true);
+
+	do
+	{
+		for (unsigned int workerIteration = 0u; workerIteration < maxWorkerIterations; ++workerIteration)
+		{
+			Worker* useWorker = workerIteration == 0u ? nullptr : &worker;
+			HighPerformanceStatistic& performance = useWorker != nullptr ? performanceMulticore : performanceSinglecore;
+
+			const bool performanceIteration = RandomI::random(randomGenerator, 1u) == 0u;
+
+			const size_t numberQueryDescriptors = performanceIteration ? 1000 : size_t(RandomI::random(randomGenerator, 1u, 100u));
+			const size_t numberReferenceDescriptors = performanceIteration ? 5000 : size_t(RandomI::random(randomGenerator, 1u, 3000u));
+
+			std::vector<uint8_t> queryDescriptors(numberQueryDescriptors * descriptorBytes);
+			std::vector<uint8_t> referenceDescriptors(numberReferenceDescriptors * descriptorBytes);
+
+			for (uint8_t& value : queryDescriptors)
+			{
+				value = uint8_t(RandomI::random(randomGenerator, 255u));
+			}
+
+			for (uint8_t& value : referenceDescriptors)
+			{
+				value = uint8_t(RandomI::random(randomGenerator, 255u));
+			}
+
+			// some query descriptors are slightly modified copies of reference descriptors
+
+			for (size_t nQuery = 0; nQuery < numberQueryDescriptors; ++nQuery)
+			{
+				if (RandomI::random(randomGenerator, 1u) == 0u)
+				{
+					const size_t nReference = size_t(RandomI::random(randomGenerator, (unsigned int)(numberReferenceDescriptors) - 1u));
+
+					uint8_t* const queryDescriptor = queryDescriptors.data() + nQuery * descriptorBytes;
+
+					memcpy(queryDescriptor, referenceDescriptors.data() + nReference * descriptorBytes, descriptorBytes);
+
+					const unsigned int flips = RandomI::random(randomGenerator, 20u);
+
+					for (unsigned int n = 0u; n < flips; ++n)
+					{
+						const unsigned int bit = RandomI::random(randomGenerator, tBits - 1u);
+						queryDescriptor[bit / 8u] ^= uint8_t(1u << (bit % 8u));
+					}
+				}
+			}
+
+			const bool useGroups = RandomI::random(randomGenerator, 1u) == 0u;
+
+			Indices32 referenceGroups;
+
+			if (useGroups)
+			{
+				const unsigned int numberGroups = RandomI::random(randomGenerator, 1u, (unsigned int)(numberReferenceDescriptors));
+
+				referenceGroups.reserve(numberReferenceDescriptors);
+
+				for (size_t n = 0; n < numberReferenceDescriptors; ++n)
+				{
+					referenceGroups.emplace_back(RandomI::random(randomGenerator, numberGroups - 1u));
+				}
+			}
+
+			Indices32 bestGroups(numberQueryDescriptors);
+			Indices32 bestDistances(numberQueryDescriptors);
+			Indices32 secondBestDistances(numberQueryDescriptors);
+
+			performance.start();
+				CV::Detector::Descriptor::determineBestMatches<tBits>(queryDescriptors.data(), numberQueryDescriptors, referenceDescriptors.data(), numberReferenceDescriptors, useGroups ? referenceGroups.data() : nullptr, bestGroups.data(), bestDistances.data(), secondBestDistances.data(), useWorker);
+			performance.stop();
+
+			for (size_t nQuery = 0; nQuery < numberQueryDescriptors; ++nQuery)
+			{
+				Index32 testBestGroup = Index32(-1);
+				unsigned int testBestDistance = (unsigned int)(-1);
+
+				std::vector<unsigned int> distances(numberReferenceDescriptors);
+
+				for (size_t nReference = 0; nReference < numberReferenceDescriptors; ++nReference)
+				{
+					distances[nReference] = CV::Detector::Descriptor::calculateHammingDistance<tBits>(queryDescriptors.data() + nQuery * descriptorBytes, referenceDescriptors.data() + nReference * descriptorBytes);
+
+					if (distances[nReference] < testBestDistance)
+					{
+						testBestDistance = distances[nReference];
+						testBestGroup = useGroups ? referenceGroups[nReference] : Index32(nReference);
+					}
+				}
+
+				unsigned int testSecondBestDistance = (unsigned int)(-1);
+
+				for (size_t nReference = 0; nReference < numberReferenceDescriptors; ++nReference)
+				{
+					const Index32 group = useGroups ? referenceGroups[nReference] : Index32(nReference);
+
+					if (group != testBestGroup)
+					{
+						testSecondBestDistance = std::min(testSecondBestDistance, distances[nReference]);
+					}
+				}
+
+				OCEAN_EXPECT_EQUAL(validation, bestGroups[nQuery], testBestGroup);
+				OCEAN_EXPECT_EQUAL(validation, bestDistances[nQuery], testBestDistance);
+				OCEAN_EXPECT_EQUAL(validation, secondBestDistances[nQuery], testSecondBestDistance);
+			}
+
+			const unsigned int maximalDistance = RandomI::random(randomGenerator, tBits / 4u);
+			const float maximalRatio = RandomF::scalar(randomGenerator, 0.5f, 1.0f);
+
+			Indices32 matchedGroups(numberQueryDescriptors);
+			CV::Detector::Descriptor::determineMatches<tBits>(queryDescriptors.data(), numberQueryDescriptors, referenceDescriptors.data(), numberReferenceDescriptors, useGroups ? referenceGroups.data() : nullptr, maximalDistance, maximalRatio, matchedGroups.data(), nullptr, useWorker);
+
+			for (size_t nQuery = 0; nQuery < numberQueryDescriptors; ++nQuery)
+			{
+				const bool validMatch = bestDistances[nQuery] <= maximalDistance && (secondBestDistances[nQuery] == (unsigned int)(-1) || float(bestDistances[nQuery]) <= float(secondBestDistances[nQuery]) * maximalRatio);
+
+				OCEAN_EXPECT_EQUAL(validation, matchedGroups[nQuery], validMatch ? bestGroups[nQuery] : Index32(-1));
+			}
+		}
+	}
+	while (!start.hasTimePassed(testDuration));
+
+	Log::info() << "Singlecore performance: " << performanceSinglecore;
+
+	if (performanceMulticore.measurements() != 0u)
+	{
+		Log::info() << "Multicore performance: " << performanceMulticore;
+	}
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
 }
 
 }
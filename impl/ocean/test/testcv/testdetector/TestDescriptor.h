@@ -49,6 +49,26 @@ class OCEAN_TEST_CV_DETECTOR_EXPORT TestDescriptor
 		 * @return True, if succeeded
 		 */
 		static bool testCalculateHammingDistance(const double testDuration);
+
+		/**
+		 * Tests the determineBestMatches() function.
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @param worker The worker object to distribute the computation
+		 * @return True, if succeeded
+		 */
+		static bool testDetermineBestMatches(const double testDuration, Worker& worker);
+
+	protected:
+
+		/**
+		 * Tests the determineBestMatches() function for a specific descriptor size.
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @param worker The worker object to distribute the computation
+		 * @return True, if succeeded
+		 * @tparam tBits The number of bits of each descriptor, with range [128, infinity), must be a multiple of 128
+		 */
+		template <unsigned int tBits>
+		static bool testDetermineBestMatches(const double testDuration, Worker& worker);
 };
 
 }
@@ -18,6 +18,9 @@
 
 #include "ocean/geometry/Jacobian.h"
 
+#include "ocean/math/AnyCamera.h"
+#include "ocean/math/Random.h"
+
 #include <bitset>
 #include <cmath>
 
@@ -54,6 +57,15 @@ bool TestFREAKDescriptorT<tSize>::test(const double testDuration, Worker& worker
 		testResult = testCreateBlurredFramePyramid(testDuration, worker);
 	}
 
+	if (selector.shouldRun("computedescriptors"))
+	{
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+
+		testResult = testComputeDescriptors(testDuration, worker);
+	}
+
 #ifdef OCEAN_USE_EXTERNAL_TEST_FREAK_DESCRIPTOR
 
 	Log::info() << " ";
@@ -82,6 +94,12 @@ TEST(TestFREAKDescriptor32, CreateBlurredFramePyramid)
 	EXPECT_TRUE(TestFREAKDescriptor32::testCreateBlurredFramePyramid(GTEST_TEST_DURATION, worker));
 }
 
+TEST(TestFREAKDescriptor32, ComputeDescriptors)
+{
+	Worker worker;
+	EXPECT_TRUE(TestFREAKDescriptor32::testComputeDescriptors(GTEST_TEST_DURATION, worker));
+}
+
 // 64-byte FREAK
 
 TEST(TestFREAKDescriptor64, CreateBlurredFramePyramid)
@@ -90,6 +108,12 @@ TEST(TestFREAKDescriptor64, CreateBlurredFramePyramid)
 	EXPECT_TRUE(TestFREAKDescriptor64::testCreateBlurredFramePyramid(GTEST_TEST_DURATION, worker));
 }
 
+TEST(TestFREAKDescriptor64, ComputeDescriptors)
+{
+	Worker worker;
+	EXPECT_TRUE(TestFREAKDescriptor64::testComputeDescriptors(GTEST_TEST_DURATION, worker));
+}
+
 #endif // OCEAN_USE_GTEST
 
 template <size_t tSize>
@@ -171,6 +195,91 @@ bool TestFREAKDescriptorT<tSize>::testCreateBlurredFramePyramid(const double tes
 	return validation.succeeded();
 }
 
+template <size_t tSize>
+bool TestFREAKDescriptorT<tSize>::testComputeDescriptors(const double testDuration, Worker& worker)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Testing computation of descriptors for several points:";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	const Timestamp startTime(true);
+
+	do
+	{
+		const unsigned int width = RandomI::random(randomGenerator, 80u, 1280u);
+		const unsigned int height = RandomI::random(randomGenerator, 80u, 720u);
+
+		const Frame yFrame = CV::CVUtilities::randomizedFrame(FrameType(width, height, FrameType::FORMAT_Y8, FrameType::ORIGIN_UPPER_LEFT), &randomGenerator);
+
+		const unsigned int layers = RandomI::random(randomGenerator, 2u, std::min(4u, CV::FramePyramid::idealLayers(width, height, 15u, 15u)));
+
+		const CV::FramePyramid framePyramid = FREAKDescriptorT<tSize>::createFramePyramidWithBlur8BitsPerChannel(yFrame, 5u, 5u, layers, &worker);
+
+		if (framePyramid.layers() != layers)
+		{
+			OCEAN_SET_FAILED(validation);
+			break;
+		}
+
+		const Scalar fovX = Random::scalar(randomGenerator, Numeric::deg2rad(40), Numeric::deg2rad(90));
+		const SharedAnyCamera camera = std::make_shared<AnyCameraPinhole>(PinholeCamera(width, height, fovX));
+
+		const unsigned int pyramidLevel = RandomI::random(randomGenerator, layers - 2u);
+
+		const Frame& layer = framePyramid[pyramidLevel];
+
+		// some points are located close to (or outside of) the image border
+
+		Vectors2 points(RandomI::random(randomGenerator, 1u, 200u));
+
+		for (Vector2& point : points)
+		{
+			point = Random::vector2(randomGenerator, Scalar(-5), Scalar(layer.width() + 5u), Scalar(-5), Scalar(layer.height() + 5u));
+		}
+
+		Worker* useWorker = RandomI::boolean(randomGenerator) ? &worker : nullptr;
+
+		std::vector<FREAKDescriptorT<tSize>> descriptors(points.size());
+		FREAKDescriptorT<tSize>::computeDescriptors(camera, framePyramid, points.data(), points.size(), pyramidLevel, descriptors.data(), useWorker);
+
+		const typename FREAKDescriptorT<tSize>::AnyCameraDerivativeFunctor cameraDerivativeFunctor(camera, layers);
+
+		for (size_t n = 0; n < points.size(); ++n)
+		{
+			const Eigen::Vector2f point(float(points[n].x()), float(points[n].y()));
+
+			float inverseFocalLength = 0.0f;
+			const typename FREAKDescriptorT<tSize>::CameraDerivativeData data = cameraDerivativeFunctor.computeCameraDerivativeData(point, pyramidLevel, inverseFocalLength);
+
+			FREAKDescriptorT<tSize> testDescriptor;
+			const bool testResult = FREAKDescriptorT<tSize>::computeDescriptor(framePyramid, point, pyramidLevel, testDescriptor, data.unprojectRayIF, inverseFocalLength, data.pointJacobianMatrixIF);
+
+			const FREAKDescriptorT<tSize>& descriptor = descriptors[n];
+
+			OCEAN_EXPECT_EQUAL(validation, descriptor.isValid(), testResult);
+			OCEAN_EXPECT_EQUAL(validation, descriptor.descriptorLevels(), testDescriptor.descriptorLevels());
+
+			if (descriptor.isValid() && descriptor.descriptorLevels() == testDescriptor.descriptorLevels())
+			{
+				OCEAN_EXPECT_EQUAL(validation, descriptor.orientation(), testDescriptor.orientation());
+
+				for (unsigned int level = 0u; level < descriptor.descriptorLevels(); ++level)
+				{
+					OCEAN_EXPECT_TRUE(validation, descriptor.data()[level] == testDescriptor.data()[level]);
+				}
+			}
+		}
+	}
+	while (startTime + testDuration > Timestamp(true));
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
 // Explicit instantiations of the test of the FREAK descriptor class
 template class TestFREAKDescriptorT<32>;
 template class TestFREAKDescriptorT<64>;
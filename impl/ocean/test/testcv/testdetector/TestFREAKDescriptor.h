@@ -66,6 +66,14 @@ class OCEAN_TEST_CV_DETECTOR_EXPORT TestFREAKDescriptorT : public CV::Detector::
 		 * @return True if the test has passed, otherwise false
 		 */
 		static bool testCreateBlurredFramePyramid(const double testDuration, Worker& worker);
+
+		/**
+		 * Test the computation of descriptors for several points, which are processed in batches, and compares the result with descriptors computed for individual points.
+		 * @param testDuration Number of seconds that this test will be run, range: (0, infinity)
+		 * @param worker The worker object
+		 * @return True if the test has passed, otherwise false
+		 */
+		static bool testComputeDescriptors(const double testDuration, Worker& worker);
 };
 
 #ifdef OCEAN_USE_EXTERNAL_TEST_FREAK_DESCRIPTOR
@@ -13,6 +13,7 @@
 #include "ocean/base/Frame.h"
 
 #include "ocean/cv/CVUtilities.h"
+#include "ocean/cv/FrameInterpolatorBilinear.h"
 
 #include "ocean/cv/detector/FrameChangeDetector.h"
 
@@ -54,6 +55,12 @@ bool TestFrameChangeDetector::test(const double testDuration, Worker& worker, co
 		}
 	}
 
+	if (selector.shouldRun("rotationcompensation"))
+	{
+		testResult = testRotationCompensation(testDuration, worker);
+		Log::info() << " ";
+	}
+
 	Log::info() << testResult;
 
 	return testResult.succeeded();
@@ -109,6 +116,12 @@ TEST(TestFrameChangeDetector, NonStaticicInputWithSimulatedMotionWithForcedKeyfr
 	EXPECT_TRUE(TestFrameChangeDetector::testInput(GTEST_TEST_DURATION, true, true, true, worker));
 }
 
+TEST(TestFrameChangeDetector, RotationCompensation)
+{
+	Worker worker;
+	EXPECT_TRUE(TestFrameChangeDetector::testRotationCompensation(GTEST_TEST_DURATION, worker));
+}
+
 #endif // OCEAN_USE_GTEST
 
 bool TestFrameChangeDetector::testInput(const double testDuration, bool nonStaticInput, bool simulateDeviceMotion, bool forcedKeyframes, Worker& worker)
@@ -295,6 +308,163 @@ bool TestFrameChangeDetector::testInput(const double testDuration, bool nonStati
 	return validation.succeeded();
 }
 
+bool TestFrameChangeDetector::testRotationCompensation(const double testDuration, Worker& worker)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Rotation compensation test:";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		const unsigned int width = RandomI::random(randomGenerator, 320u, 800u);
+		const unsigned int height = RandomI::random(randomGenerator, 240u, 600u);
+
+		const AnyCameraPinhole camera(PinholeCamera(width, height, Numeric::deg2rad(Random::scalar(randomGenerator, 50, 70))));
+
+		// either the full resolution, or half of the resolution is used
+		const unsigned int targetWidth = RandomI::boolean(randomGenerator) ? width : width / 2u;
+		const unsigned int targetHeight = targetWidth == width ? height : height / 2u;
+
+		const FrameChangeDetector::Options options =
+		{
+			/*.targetFrameWidth =*/ targetWidth,
+			/*.targetFrameHeight =*/ targetHeight,
+			/*.spatialBinSize =*/ RandomI::random(randomGenerator, 16u, 32u),
+			/*.largeMotionAccelerationThreshold =*/ Numeric::maxValue(),
+			/*.largeMotionRotationRateThreshold = */Numeric::maxValue(),
+			/*.rotationThreshold =*/ Numeric::pi(),
+			/*.minimumTimeBetweenKeyframes =*/ 0.0,
+			/*.preferredMaximumTimeBetweenKeyframes =*/ NumericD::maxValue(),
+			/*.absoluteMaximumTimeBetweenKeyframes =*/ NumericD::maxValue(),
+			/*.minimumHistogramDistance =*/ Scalar(0.0),
+			/*.histogramDistanceThreshold =*/ Scalar(1000000), // the tile scores are not saturated
+			/*.changeDetectionThreshold =*/ Scalar(1)
+		};
+
+		// the keyframe is composed of blocks with random intensities, so that the histograms differ between tiles
+
+		const unsigned int tileSize = options.spatialBinSize * width / targetWidth;
+		const unsigned int blockSize = RandomI::random(randomGenerator, tileSize, tileSize * 3u);
+
+		Frame keyframe(FrameType(width, height, FrameType::FORMAT_Y8, FrameType::ORIGIN_UPPER_LEFT));
+
+		for (unsigned int yBlock = 0u; yBlock < height; yBlock += blockSize)
+		{
+			for (unsigned int xBlock = 0u; xBlock < width; xBlock += blockSize)
+			{
+				const uint8_t value = uint8_t(RandomI::random(randomGenerator, 255u));
+
+				for (unsigned int y = yBlock; y < std::min(yBlock + blockSize, height); ++y)
+				{
+					memset(keyframe.row<uint8_t>(y) + xBlock, value, std::min(blockSize, width - xBlock));
+				}
+			}
+		}
+
+		// the second frame is captured after a pure rotation of the camera
+
+		const Vector3 rotationAxis = Vector3(Random::scalar(randomGenerator, -1, 1), Random::scalar(randomGenerator, -1, 1), Random::scalar(randomGenerator, Scalar(-0.2), Scalar(0.2))).normalizedOrZero();
+		const Quaternion world_R_camera(rotationAxis.isNull() ? Vector3(0, 1, 0) : rotationAxis, Numeric::deg2rad(Random::scalar(randomGenerator, 3, 8)));
+
+		Frame frame(keyframe.frameType());
+
+		for (unsigned int y = 0u; y < height; ++y)
+		{
+			for (unsigned int x = 0u; x < width; ++x)
+			{
+				const Vector3 keyframeRay = world_R_camera * camera.vector(Vector2(Scalar(x), Scalar(y)));
+				const Vector2 keyframePoint = camera.projectToImage(keyframeRay);
+
+				if (keyframeRay.z() < Scalar(0) && keyframePoint.x() >= Scalar(0) && keyframePoint.y() >= Scalar(0) && keyframePoint.x() <= Scalar(width - 1u) && keyframePoint.y() <= Scalar(height - 1u))
+				{
+					CV::FrameInterpolatorBilinear::interpolatePixel8BitPerChannel<1u, CV::PC_TOP_LEFT>(keyframe.constdata<uint8_t>(), width, height, keyframe.paddingElements(), keyframePoint, frame.pixel<uint8_t>(x, y));
+				}
+				else
+				{
+					frame.pixel<uint8_t>(x, y)[0] = uint8_t(RandomI::random(randomGenerator, 255u));
+				}
+			}
+		}
+
+		Worker* useWorker = RandomI::boolean(randomGenerator) ? nullptr : &worker;
+
+		Timestamp timestamp(true);
+		keyframe.setTimestamp(timestamp);
+		frame.setTimestamp(timestamp + Timestamp(1.0 / 30.0));
+
+		FrameChangeDetector detector(options);
+		FrameChangeDetector compensatingDetector(options);
+
+		const Quaternion world_R_keyframe(true);
+
+		OCEAN_EXPECT_EQUAL(validation, detector.detectFrameChange(keyframe, world_R_keyframe, useWorker), FrameChangeDetector::FrameChangeResult::CHANGE_DETECTED);
+		OCEAN_EXPECT_EQUAL(validation, compensatingDetector.detectFrameChange(keyframe, camera, world_R_keyframe, useWorker), FrameChangeDetector::FrameChangeResult::CHANGE_DETECTED);
+
+		detector.detectFrameChange(frame, world_R_camera, useWorker);
+		compensatingDetector.detectFrameChange(frame, camera, world_R_camera, useWorker);
+
+		const Matrix& scores = detector.tileScores();
+		const Matrix& compensatedScores = compensatingDetector.tileScores();
+
+		OCEAN_EXPECT_EQUAL(validation, scores.rows(), compensatedScores.rows());
+		OCEAN_EXPECT_EQUAL(validation, scores.columns(), compensatedScores.columns());
+
+		if (scores.rows() == compensatedScores.rows() && scores.columns() == compensatedScores.columns())
+		{
+			// we compare the tiles which are visible in the keyframe, tiles with new content receive the maximal score
+
+			Scalar sumScores = Scalar(0);
+			Scalar sumCompensatedScores = Scalar(0);
+
+			for (unsigned int r = 0u; r < scores.rows(); ++r)
+			{
+				for (unsigned int c = 0u; c < scores.columns(); ++c)
+				{
+					if (compensatedScores(r, c) < options.histogramDistanceThreshold)
+					{
+						sumScores += scores(r, c);
+						sumCompensatedScores += compensatedScores(r, c);
+					}
+				}
+			}
+
+			OCEAN_EXPECT_LESS(validation, sumCompensatedScores, sumScores * Scalar(0.8));
+		}
+
+		// without rotation, the compensation must not have an impact
+
+		FrameChangeDetector staticDetector(options);
+		FrameChangeDetector staticCompensatingDetector(options);
+
+		staticDetector.detectFrameChange(keyframe, world_R_keyframe, useWorker);
+		staticCompensatingDetector.detectFrameChange(keyframe, camera, world_R_keyframe, useWorker);
+
+		staticDetector.detectFrameChange(frame, world_R_keyframe, useWorker);
+		staticCompensatingDetector.detectFrameChange(frame, camera, world_R_keyframe, useWorker);
+
+		const Matrix& staticScores = staticDetector.tileScores();
+		const Matrix& staticCompensatedScores = staticCompensatingDetector.tileScores();
+
+		for (unsigned int r = 0u; r < staticScores.rows(); ++r)
+		{
+			for (unsigned int c = 0u; c < staticScores.columns(); ++c)
+			{
+				OCEAN_EXPECT_TRUE(validation, Numeric::isEqual(staticScores(r, c), staticCompensatedScores(r, c), Scalar(0.1)));
+			}
+		}
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
 } // namespace TestDetector
 
 } // namespace TestCV
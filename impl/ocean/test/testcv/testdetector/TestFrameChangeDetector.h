@@ -51,6 +51,15 @@ class OCEAN_TEST_CV_DETECTOR_EXPORT TestFrameChangeDetector
 		 * @return True, if succeeded
 		 */
 		static bool testInput(const double testDuration, bool nonStaticInput, bool simulateDeviceMotion, bool forcedKeyframes, Worker& worker);
+
+		/**
+		 * Tests the compensation of pure device rotations, the content of a keyframe is rendered for a rotated camera.
+		 * The tiles of the rotated frame must be more similar to the keyframe with compensation than without compensation.
+		 * @param testDuration Number of seconds for the test, with range (0, infinity)
+		 * @param worker The worker object; to test single- and multi-core performance individual trials may or may not use this
+		 * @return True, if succeeded
+		 */
+		static bool testRotationCompensation(const double testDuration, Worker& worker);
 };
 
 }
@@ -943,7 +943,19 @@ bool TestHarrisDetector::testHarrisVoteFrame(const double testDuration, Worker&
 
 				const bool setBorderPixels = RandomI::boolean(randomGenerator);
 
-				CV::Detector::HarrisCornerDetector::harrisVotesFrame(yFrame.constdata<uint8_t>(), yFrame.width(), yFrame.height(), yFrame.paddingElements(), votesFrame.data<int32_t>(), votesFrame.paddingElements(), useWorker, setBorderPixels);
+				Frame sobelFrame;
+
+				if (!performanceIteration && RandomI::boolean(randomGenerator))
+				{
+					sobelFrame = CV::CVUtilities::randomizedFrame(FrameType(yFrame, FrameType::genericPixelFormat<int8_t, 2u>()), &randomGenerator);
+				}
+
+				const Frame copySobelFrame(sobelFrame, Frame::ACM_COPY_KEEP_LAYOUT_COPY_PADDING_DATA);
+
+				int8_t* const sobelResponses = sobelFrame.isValid() ? sobelFrame.data<int8_t>() : nullptr;
+				const unsigned int sobelResponsesPaddingElements = sobelFrame.isValid() ? sobelFrame.paddingElements() : 0u;
+
+				CV::Detector::HarrisCornerDetector::harrisVotesFrame(yFrame.constdata<uint8_t>(), yFrame.width(), yFrame.height(), yFrame.paddingElements(), votesFrame.data<int32_t>(), votesFrame.paddingElements(), useWorker, setBorderPixels, sobelResponses, sobelResponsesPaddingElements);
 
 				if (!CV::CVUtilities::isPaddingMemoryIdentical(votesFrame, copyVotesFrame))
 				{
@@ -951,6 +963,25 @@ bool TestHarrisDetector::testHarrisVoteFrame(const double testDuration, Worker&
 					return false;
 				}
 
+				if (sobelFrame.isValid())
+				{
+					if (!CV::CVUtilities::isPaddingMemoryIdentical(sobelFrame, copySobelFrame))
+					{
+						ocean_assert(false && "Invalid padding memory!");
+						return false;
+					}
+
+					// the sobel responses determined while creating the votes must be identical to the responses of the sobel filter
+
+					Frame testSobelFrame(sobelFrame.frameType());
+					CV::FrameFilterSobel::filterHorizontalVertical8BitPerChannel<int8_t, 1u>(yFrame.constdata<uint8_t>(), testSobelFrame.data<int8_t>(), yFrame.width(), yFrame.height(), yFrame.paddingElements(), testSobelFrame.paddingElements());
+
+					for (unsigned int y = 0u; y < sobelFrame.height(); ++y)
+					{
+						OCEAN_EXPECT_EQUAL(validation, memcmp(sobelFrame.constrow<int8_t>(y), testSobelFrame.constrow<int8_t>(y), sobelFrame.planeWidthBytes(0u)), 0);
+					}
+				}
+
 				for (unsigned int y = 2u; y < yFrame.height() - 2u; ++y)
 				{
 					for (unsigned int x = 2u; x < yFrame.width() - 2u; ++x)
@@ -11,6 +11,7 @@
 #include "ocean/test/Validation.h"
 
 #include "ocean/base/DataType.h"
+#include "ocean/base/HighPerformanceTimer.h"
 #include "ocean/base/RandomI.h"
 #include "ocean/cv/detector/HemiCube.h"
 #include "ocean/math/Random.h"
@@ -32,7 +33,7 @@ namespace TestDetector
 
 using namespace Ocean::CV::Detector;
 
-bool TestHemiCube::test(const double testDuration, Worker& /*worker*/, const TestSelector& selector)
+bool TestHemiCube::test(const double testDuration, Worker& worker, const TestSelector& selector)
 {
 	ocean_assert(testDuration > 0.0);
 
@@ -63,6 +64,20 @@ bool TestHemiCube::test(const double testDuration, Worker& /*worker*/, const Tes
 	if (selector.shouldRun("merge"))
 	{
 		testResult = testMerge(testDuration);
+
+		Log::info() << " ";
+	}
+
+	if (selector.shouldRun("findmergecandidates"))
+	{
+		testResult = testFindMergeCandidates(testDuration, worker);
+
+		Log::info() << " ";
+	}
+
+	if (selector.shouldRun("incrementalmerge"))
+	{
+		testResult = testIncrementalMerge(testDuration);
 	}
 
 	Log::info() << testResult;
@@ -92,6 +107,17 @@ TEST(TestHemiCube, Merge)
 	EXPECT_TRUE(TestHemiCube::testMerge(GTEST_TEST_DURATION));
 }
 
+TEST(TestHemiCube, FindMergeCandidates)
+{
+	Worker worker;
+	EXPECT_TRUE(TestHemiCube::testFindMergeCandidates(GTEST_TEST_DURATION, worker));
+}
+
+TEST(TestHemiCube, IncrementalMerge)
+{
+	EXPECT_TRUE(TestHemiCube::testIncrementalMerge(GTEST_TEST_DURATION));
+}
+
 #endif // OCEAN_USE_GTEST
 
 bool TestHemiCube::testAdd(const double testDuration)
@@ -382,6 +408,201 @@ bool TestHemiCube::testMerge(const double testDuration)
 	return validation.succeeded();
 }
 
+bool TestHemiCube::testFindMergeCandidates(const double testDuration, Worker& worker)
+{
+	Log::info() << "Hemi cube merge candidates test:";
+
+	const Scalar focalLength = Scalar(1);
+	const unsigned int imageWidth = 1920u;
+	const unsigned int imageHeight = 1080u;
+
+	constexpr Scalar searchRadius = Scalar(1.5);
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	HighPerformanceStatistic performanceSingleCore;
+	HighPerformanceStatistic performanceMultiCore;
+
+	const Timestamp startTime(true);
+
+	do
+	{
+		const unsigned int hemiCubeBins = RandomI::random(randomGenerator, 2u, 40u);
+
+		const Scalar maxLineDistance = Random::scalar(randomGenerator, Scalar(0.5), Scalar(3));
+		const Scalar maxLineGap = Random::scalar(randomGenerator, Scalar(1), Scalar(50));
+		const Scalar cosAngle = Numeric::cos(Numeric::deg2rad(Random::scalar(randomGenerator, Scalar(0.5), Scalar(3))));
+
+		HemiCube hemiCube(hemiCubeBins, imageWidth, imageHeight, focalLength);
+
+		const FiniteLines2 lines = generateRandomStructuredFiniteLines2(randomGenerator, imageWidth, imageHeight, RandomI::random(randomGenerator, 1u, 3000u));
+
+		if (RandomI::boolean(randomGenerator))
+		{
+			hemiCube.merge(lines, maxLineDistance, maxLineGap, nullptr, cosAngle);
+		}
+		else
+		{
+			hemiCube.insert(lines);
+		}
+
+		const FiniteLines2 queryLines = generateRandomStructuredFiniteLines2(randomGenerator, imageWidth, imageHeight, RandomI::random(randomGenerator, 1u, 1000u));
+
+		// the candidates must be identical to the candidates determined with the Hemi cube only
+
+		IndexGroups32 candidateGroups;
+		candidateGroups.reserve(queryLines.size());
+
+		for (const FiniteLine2& queryLine : queryLines)
+		{
+			candidateGroups.emplace_back(hemiCube.findMergeCandidates(queryLine, maxLineDistance, maxLineGap, cosAngle));
+
+			Indices32 expectedCandidates;
+
+			for (const Index32& lineIndex : hemiCube.find(queryLine, searchRadius))
+			{
+				const FiniteLine2& line = hemiCube[lineIndex];
+
+				if (!queryLine.isCollinear(line, maxLineDistance, cosAngle))
+				{
+					continue;
+				}
+
+				const Scalar squareLineGap0 = queryLine.nearestPoint(line.point0()).sqrDistance(line.point0());
+				const Scalar squareLineGap1 = queryLine.nearestPoint(line.point1()).sqrDistance(line.point1());
+
+				if (std::min(squareLineGap0, squareLineGap1) < Numeric::sqr(maxLineGap))
+				{
+					expectedCandidates.emplace_back(lineIndex);
+				}
+			}
+
+			Indices32 candidates(candidateGroups.back());
+			std::sort(candidates.begin(), candidates.end());
+
+			OCEAN_EXPECT_EQUAL(validation, candidates, expectedCandidates);
+		}
+
+		// the batched candidates must be identical to the individual candidates
+
+		for (const bool useWorker : {false, true})
+		{
+			HighPerformanceStatistic& performance = useWorker ? performanceMultiCore : performanceSingleCore;
+
+			IndexGroups32 batchedCandidateGroups;
+
+			performance.start();
+				hemiCube.findMergeCandidates(queryLines, maxLineDistance, maxLineGap, batchedCandidateGroups, cosAngle, useWorker ? &worker : nullptr);
+			performance.stop();
+
+			OCEAN_EXPECT_EQUAL(validation, batchedCandidateGroups, candidateGroups);
+		}
+	}
+	while (startTime + testDuration > Timestamp(true));
+
+	Log::info() << "Performance single-core: " << performanceSingleCore;
+	Log::info() << "Performance multi-core: " << performanceMultiCore;
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
+bool TestHemiCube::testIncrementalMerge(const double testDuration)
+{
+	Log::info() << "Hemi cube incremental merge test:";
+
+	const Scalar focalLength = Scalar(1);
+	const unsigned int imageWidth = 1280u;
+	const unsigned int imageHeight = 720u;
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	const Timestamp startTime(true);
+
+	do
+	{
+		const unsigned int hemiCubeBins = RandomI::random(randomGenerator, 2u, 40u);
+
+		const Scalar maxLineDistance = Random::scalar(randomGenerator, Scalar(0.5), Scalar(3));
+		const Scalar maxLineGap = Random::scalar(randomGenerator, Scalar(1), Scalar(50));
+		const Scalar cosAngle = Numeric::cos(Numeric::deg2rad(Random::scalar(randomGenerator, Scalar(0.5), Scalar(3))));
+
+		// the same Hemi cube is re-used for several frames
+
+		HemiCube incrementalHemiCube(hemiCubeBins, imageWidth, imageHeight, focalLength);
+
+		const unsigned int frames = RandomI::random(randomGenerator, 1u, 5u);
+
+		for (unsigned int frameIndex = 0u; frameIndex < frames; ++frameIndex)
+		{
+			incrementalHemiCube.clear();
+
+			const FiniteLines2 lines = generateRandomStructuredFiniteLines2(randomGenerator, imageWidth, imageHeight, RandomI::random(randomGenerator, 1u, 1000u));
+
+			Indices32 incrementalMapping;
+			incrementalMapping.reserve(lines.size());
+
+			for (const FiniteLine2& line : lines)
+			{
+				const Indices32 candidates = incrementalHemiCube.findMergeCandidates(line, maxLineDistance, maxLineGap, cosAngle);
+				const size_t size = incrementalHemiCube.size();
+
+				const Index32 lineIndex = incrementalHemiCube.merge(line, maxLineDistance, maxLineGap, cosAngle);
+
+				// the line is merged with the best candidate, or is added
+
+				if (candidates.empty())
+				{
+					OCEAN_EXPECT_EQUAL(validation, lineIndex, Index32(size));
+					OCEAN_EXPECT_EQUAL(validation, incrementalHemiCube.size(), size + 1);
+				}
+				else
+				{
+					OCEAN_EXPECT_EQUAL(validation, lineIndex, candidates.front());
+					OCEAN_EXPECT_EQUAL(validation, incrementalHemiCube.size(), size);
+				}
+
+				incrementalMapping.emplace_back(lineIndex);
+			}
+
+			// the result must be identical to merging all lines at once
+
+			HemiCube hemiCube(hemiCubeBins, imageWidth, imageHeight, focalLength);
+
+			Indices32 mapping;
+			hemiCube.merge(lines, maxLineDistance, maxLineGap, &mapping, cosAngle);
+
+			OCEAN_EXPECT_EQUAL(validation, mapping, incrementalMapping);
+			OCEAN_EXPECT_EQUAL(validation, hemiCube.size(), incrementalHemiCube.size());
+
+			if (hemiCube.size() == incrementalHemiCube.size())
+			{
+				for (unsigned int lineIndex = 0u; lineIndex < (unsigned int)(hemiCube.size()); ++lineIndex)
+				{
+					OCEAN_EXPECT_TRUE(validation, hemiCube[lineIndex] == incrementalHemiCube[lineIndex]);
+				}
+			}
+
+			// each merged line must still be found at its updated location
+
+			for (unsigned int lineIndex = 0u; lineIndex < (unsigned int)(incrementalHemiCube.size()); ++lineIndex)
+			{
+				const Indices32 candidates = incrementalHemiCube.findMergeCandidates(incrementalHemiCube[lineIndex], maxLineDistance, maxLineGap, cosAngle);
+
+				OCEAN_EXPECT_TRUE(validation, std::find(candidates.cbegin(), candidates.cend(), lineIndex) != candidates.cend());
+			}
+		}
+	}
+	while (startTime + testDuration > Timestamp(true));
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
 FiniteLine2 TestHemiCube::generateRandomFiniteLine2(RandomGenerator& randomGenerator, const unsigned int imageWidth, const unsigned int imageHeight)
 {
 	ocean_assert(imageWidth != 0u && imageHeight != 0u);
@@ -565,6 +786,63 @@ bool TestHemiCube::validateLineFusion(const FiniteLine2& testLine, const FiniteL
 	return validationSuccessful;
 }
 
+FiniteLines2 TestHemiCube::generateRandomStructuredFiniteLines2(RandomGenerator& randomGenerator, const unsigned int imageWidth, const unsigned int imageHeight, const unsigned int numberLines)
+{
+	ocean_assert(imageWidth >= 2u && imageHeight >= 2u);
+	ocean_assert(numberLines >= 1u);
+
+	// few dominant directions, as e.g., of the edges of buildings
+
+	Vectors2 directions;
+
+	for (unsigned int n = 0u; n < RandomI::random(randomGenerator, 1u, 4u); ++n)
+	{
+		directions.emplace_back(Random::vector2(randomGenerator));
+	}
+
+	const Scalar maxX = Scalar(imageWidth - 1u);
+	const Scalar maxY = Scalar(imageHeight - 1u);
+
+	FiniteLines2 lines;
+	lines.reserve(numberLines);
+
+	while (lines.size() < numberLines)
+	{
+		Vector2 point0;
+		Vector2 direction;
+
+		if (!lines.empty() && RandomI::boolean(randomGenerator))
+		{
+			// continuing a previous line with a small gap and slightly different direction
+
+			const FiniteLine2& previousLine = lines[RandomI::random(randomGenerator, (unsigned int)(lines.size() - 1))];
+
+			const Scalar angle = Random::scalar(randomGenerator, Numeric::deg2rad(-1), Numeric::deg2rad(1));
+			const Vector2& previousDirection = previousLine.direction();
+
+			direction = Vector2(Numeric::cos(angle) * previousDirection.x() - Numeric::sin(angle) * previousDirection.y(), Numeric::sin(angle) * previousDirection.x() + Numeric::cos(angle) * previousDirection.y());
+			point0 = previousLine.point1() + previousLine.direction() * Random::scalar(randomGenerator, Scalar(0), Scalar(20)) + previousLine.normal() * Random::scalar(randomGenerator, Scalar(-1), Scalar(1));
+		}
+		else
+		{
+			direction = RandomI::random(randomGenerator, directions);
+			point0 = Random::vector2(randomGenerator, Scalar(0), maxX, Scalar(0), maxY);
+		}
+
+		point0 = Vector2(minmax(Scalar(0), point0.x(), maxX), minmax(Scalar(0), point0.y(), maxY));
+
+		const Vector2 point1 = point0 + direction * Random::scalar(randomGenerator, Scalar(5), Scalar(200));
+		const Vector2 clampedPoint1(minmax(Scalar(0), point1.x(), maxX), minmax(Scalar(0), point1.y(), maxY));
+
+		if (point0.sqrDistance(clampedPoint1) >= Scalar(1))
+		{
+			lines.emplace_back(point0, clampedPoint1);
+		}
+	}
+
+	return lines;
+}
+
 } // namespace TestDetector
 
 } // namespace TestCV
@@ -72,6 +72,21 @@ class OCEAN_TEST_CV_DETECTOR_EXPORT TestHemiCube
 		 */
 		static bool testMerge(const double testDuration);
 
+		/**
+		 * Tests the determination of merge candidates, individually and batched.
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @param worker The worker object
+		 * @return True, if succeeded
+		 */
+		static bool testFindMergeCandidates(const double testDuration, Worker& worker);
+
+		/**
+		 * Tests merging lines incrementally, e.g., frame by frame.
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @return True, if succeeded
+		 */
+		static bool testIncrementalMerge(const double testDuration);
+
 	protected:
 
 		/**
@@ -112,6 +127,16 @@ class OCEAN_TEST_CV_DETECTOR_EXPORT TestHemiCube
 		 * @return True if the result of this function is sufficiently close to `testLine`, otherwise false.
 		 */
 		static bool validateLineFusion(const FiniteLine2& testLine, const FiniteLines2& lines);
+
+		/**
+		 * Generates random line segments with many parallel and collinear line segments, as they appear in man-made environments.
+		 * @param randomGenerator The random generator to be used for the generation of the test data
+		 * @param imageWidth Width of the image
+		 * @param imageHeight Height of the image
+		 * @param numberLines The number of line segments to generate, with range [1, infinity)
+		 * @return The line segments within the image boundaries
+		 */
+		static FiniteLines2 generateRandomStructuredFiniteLines2(RandomGenerator& randomGenerator, const unsigned int imageWidth, const unsigned int imageHeight, const unsigned int numberLines);
 };
 
 } // namespace TestDetector
@@ -28,7 +28,7 @@ namespace TestCV
 namespace TestDetector
 {
 
-bool TestLineDetectorULF::test(const double testDuration, Worker& /*worker*/, const TestSelector& selector)
+bool TestLineDetectorULF::test(const double testDuration, Worker& worker, const TestSelector& selector)
 {
 	ocean_assert(testDuration > 0.0);
 
@@ -119,6 +119,15 @@ bool TestLineDetectorULF::test(const double testDuration, Worker& /*worker*/, co
 	if (selector.shouldRun("horizontalsdstepedgedetector"))
 	{
 		testResult = testHorizontalSDStepEdgeDetector(testDuration);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
+	if (selector.shouldRun("rmsedgedetectorsintegerresponses"))
+	{
+		testResult = testRMSEdgeDetectorsIntegerResponses(testDuration, worker);
 	}
 
 	Log::info() << " ";
@@ -179,6 +188,12 @@ TEST(TestLineDetectorULF, HorizontalSDStepEdgeDetector)
 	EXPECT_TRUE(TestLineDetectorULF::testHorizontalSDStepEdgeDetector(GTEST_TEST_DURATION));
 }
 
+TEST(TestLineDetectorULF, RMSEdgeDetectorsIntegerResponses)
+{
+	Worker worker;
+	EXPECT_TRUE(TestLineDetectorULF::testRMSEdgeDetectorsIntegerResponses(GTEST_TEST_DURATION, worker));
+}
+
 #endif // OCEAN_USE_GTEST
 
 bool TestLineDetectorULF::testRowSums(const double testDuration)
@@ -930,6 +945,136 @@ bool TestLineDetectorULF::testHorizontalSDStepEdgeDetector(const double testDura
 	return testHorizontalEdgeDetector(sdStepEdgeDetectorI, testDuration);
 }
 
+bool TestLineDetectorULF::testRMSEdgeDetectorsIntegerResponses(const double testDuration, Worker& worker)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "RMS edge detector integer responses test:";
+	Log::info() << " ";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+#if defined(OCEAN_HARDWARE_NEON_VERSION) && OCEAN_HARDWARE_NEON_VERSION >= 10
+	// the NEON implementations use approximated reciprocals, so that we check the consistency between single-core and multi-core execution only
+	constexpr bool compareWithScalarResponses = false;
+#else
+	constexpr bool compareWithScalarResponses = true;
+#endif
+
+	HighPerformanceStatistic performanceSinglecore;
+	HighPerformanceStatistic performanceMulticore;
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		const unsigned int width = RandomI::random(randomGenerator, 50u, 1920u);
+		const unsigned int height = RandomI::random(randomGenerator, 50u, 1080u);
+
+		Frame yFrame = CV::CVUtilities::randomizedFrame(FrameType(width, height, FrameType::FORMAT_Y8, FrameType::ORIGIN_UPPER_LEFT), &randomGenerator);
+
+		if (RandomI::boolean(randomGenerator))
+		{
+			// binary images create extreme responses
+
+			for (unsigned int y = 0u; y < height; ++y)
+			{
+				uint8_t* const row = yFrame.row<uint8_t>(y);
+
+				for (unsigned int x = 0u; x < width; ++x)
+				{
+					row[x] = row[x] >= 128u ? 0xFFu : 0x00u;
+				}
+			}
+		}
+
+		for (const bool barDetector : {true, false})
+		{
+			const unsigned int window = RandomI::random(randomGenerator, 1u, barDetector ? 11u : 8u);
+			const unsigned int minimalDelta = RandomI::random(randomGenerator, 0u, 20u);
+
+			std::shared_ptr<EdgeDetector> edgeDetector;
+
+			if (barDetector)
+			{
+				edgeDetector = std::make_shared<RMSBarEdgeDetectorI>(window, minimalDelta);
+			}
+			else
+			{
+				edgeDetector = std::make_shared<RMSStepEdgeDetectorI>(window);
+			}
+
+			Frame responseFrameSinglecore(FrameType(width, height, FrameType::genericPixelFormat<int16_t, 1u>(), FrameType::ORIGIN_UPPER_LEFT));
+			Frame responseFrameMulticore(responseFrameSinglecore.frameType());
+
+			CV::CVUtilities::randomizeFrame(responseFrameSinglecore, false, &randomGenerator);
+			CV::CVUtilities::randomizeFrame(responseFrameMulticore, false, &randomGenerator);
+
+			ocean_assert(responseFrameSinglecore.isContinuous() && responseFrameMulticore.isContinuous());
+
+			performanceSinglecore.start();
+				invokeVertical(*edgeDetector, yFrame.constdata<uint8_t>(), width, height, responseFrameSinglecore.data<int16_t>(), yFrame.paddingElements(), nullptr);
+			performanceSinglecore.stop();
+
+			performanceMulticore.start();
+				invokeVertical(*edgeDetector, yFrame.constdata<uint8_t>(), width, height, responseFrameMulticore.data<int16_t>(), yFrame.paddingElements(), &worker);
+			performanceMulticore.stop();
+
+			OCEAN_EXPECT_EQUAL(validation, memcmp(responseFrameSinglecore.constdata<void>(), responseFrameMulticore.constdata<void>(), responseFrameSinglecore.size()), 0);
+
+			if constexpr (compareWithScalarResponses)
+			{
+				for (unsigned int y = 0u; y < height; ++y)
+				{
+					const int16_t* const responseRow = responseFrameSinglecore.constrow<int16_t>(y);
+
+					for (unsigned int x = 0u; x < width; ++x)
+					{
+						const int16_t expectedResponse = barDetector ? rmsBarEdgeResponseI(yFrame, x, y, window, minimalDelta) : rmsStepEdgeResponseI(yFrame, x, y, window);
+
+						OCEAN_EXPECT_EQUAL(validation, responseRow[x], expectedResponse);
+					}
+				}
+			}
+		}
+
+		// the line detection with worker must provide the identical lines
+
+		const EdgeDetectors edgeDetectors = defaultEdgeDetectors();
+
+		EdgeTypes typesSinglecore;
+		const FiniteLines2 linesSinglecore = detectLines(yFrame.constdata<uint8_t>(), width, height, yFrame.paddingElements(), edgeDetectors, 50u, 20u, 1.6f, &typesSinglecore, SD_VERTICAL_AND_HORIZONTAL, nullptr);
+
+		EdgeTypes typesMulticore;
+		const FiniteLines2 linesMulticore = detectLines(yFrame.constdata<uint8_t>(), width, height, yFrame.paddingElements(), edgeDetectors, 50u, 20u, 1.6f, &typesMulticore, SD_VERTICAL_AND_HORIZONTAL, &worker);
+
+		OCEAN_EXPECT_TRUE(validation, typesSinglecore == typesMulticore);
+
+		if (linesSinglecore.size() == linesMulticore.size())
+		{
+			for (size_t n = 0; n < linesSinglecore.size(); ++n)
+			{
+				OCEAN_EXPECT_TRUE(validation, linesSinglecore[n].point0() == linesMulticore[n].point0() && linesSinglecore[n].point1() == linesMulticore[n].point1());
+			}
+		}
+		else
+		{
+			OCEAN_SET_FAILED(validation);
+		}
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Singlecore performance: " << performanceSinglecore;
+	Log::info() << "Multicore performance: " << performanceMulticore;
+
+	Log::info() << " ";
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
 bool TestLineDetectorULF::testHorizontalEdgeDetector(const EdgeDetector& edgeDetector, const double testDuration)
 {
 	ocean_assert(edgeDetector.hasInvokeHorizontal(50, 50));
@@ -1311,6 +1456,138 @@ double TestLineDetectorULF::sdStepEdgeResponseWithoutNonMaximumSuppression(const
 	return response;
 }
 
+int16_t TestLineDetectorULF::rmsBarEdgeResponseI(const Frame& yFrame, const unsigned int x, const unsigned int y, const unsigned int windowSize, const unsigned int minimalDelta)
+{
+	ocean_assert(yFrame.isValid() && yFrame.isPixelFormatCompatible(FrameType::genericPixelFormat<uint8_t, 1u>()));
+	ocean_assert(x < yFrame.width() && y < yFrame.height());
+	ocean_assert(windowSize >= 1u && windowSize <= 11u);
+
+	constexpr unsigned int barSize_2 = 1u;
+
+	if (x < windowSize + barSize_2 || x >= yFrame.width() - (windowSize + barSize_2))
+	{
+		return 0;
+	}
+
+	const uint8_t* const row = yFrame.constrow<uint8_t>(y);
+
+	// the left window ends before the bar, the right window starts after the bar
+
+	uint32_t sumLeft = 0u;
+	uint32_t sumRight = 0u;
+	uint32_t sqrSum = 0u;
+
+	for (unsigned int n = 0u; n < windowSize; ++n)
+	{
+		const uint32_t valueLeft = row[x - barSize_2 - windowSize + n];
+		const uint32_t valueRight = row[x + barSize_2 + 1u + n];
+
+		sumLeft += valueLeft;
+		sumRight += valueRight;
+
+		sqrSum += valueLeft * valueLeft + valueRight * valueRight;
+	}
+
+	const uint32_t valueWindow = row[x] * windowSize;
+
+	if (!((valueWindow < sumLeft && valueWindow < sumRight) || (valueWindow > sumLeft && valueWindow > sumRight)))
+	{
+		return 0;
+	}
+
+	const uint32_t area = windowSize * 2u;
+	const uint32_t sum = sumLeft + sumRight;
+
+	const uint32_t normalizedSqrResidual = std::max(area * area, area * sqrSum - sum * sum);
+
+	const int valueMinus = int(row[x - 1u] * area) - int(sum);
+	const int valueCenter = int(row[x] * area) - int(sum);
+	const int valuePlus = int(row[x + 1u] * area) - int(sum);
+
+	int peakValue = 0;
+
+	if (valueCenter < 0)
+	{
+		if (valueMinus < valueCenter || valueCenter >= valuePlus)
+		{
+			return 0;
+		}
+
+		peakValue = valueCenter + std::min(valueMinus, valuePlus);
+	}
+	else
+	{
+		if (valueMinus > valueCenter || valueCenter <= valuePlus)
+		{
+			return 0;
+		}
+
+		peakValue = valueCenter + std::max(valueMinus, valuePlus);
+	}
+
+	if (uint32_t(std::abs(peakValue)) < minimalDelta * area * 2u)
+	{
+		return 0;
+	}
+
+	const int response = int((uint32_t(peakValue * peakValue) * 64u + normalizedSqrResidual / 2u) / normalizedSqrResidual);
+
+	return int16_t(minmax<int>(NumericT<int16_t>::minValue(), valueCenter < 0 ? -response : response, NumericT<int16_t>::maxValue()));
+}
+
+int16_t TestLineDetectorULF::rmsStepEdgeResponseI(const Frame& yFrame, const unsigned int x, const unsigned int y, const unsigned int windowSize, const bool applyNonMaximumSuppression)
+{
+	ocean_assert(yFrame.isValid() && yFrame.isPixelFormatCompatible(FrameType::genericPixelFormat<uint8_t, 1u>()));
+	ocean_assert(x < yFrame.width() && y < yFrame.height());
+	ocean_assert(windowSize >= 1u && windowSize <= 8u);
+
+	if (x < windowSize || x >= yFrame.width() - windowSize)
+	{
+		return 0;
+	}
+
+	if (applyNonMaximumSuppression)
+	{
+		const int16_t left = rmsStepEdgeResponseI(yFrame, x - 1u, y, windowSize, false);
+		const int16_t center = rmsStepEdgeResponseI(yFrame, x, y, windowSize, false);
+		const int16_t right = rmsStepEdgeResponseI(yFrame, x + 1u, y, windowSize, false);
+
+		if ((center > 0 && (center <= left || center < right)) || (center < 0 && (center >= left || center > right)))
+		{
+			return 0;
+		}
+
+		return center;
+	}
+
+	const uint8_t* const row = yFrame.constrow<uint8_t>(y);
+
+	uint32_t sumLeft = 0u;
+	uint32_t sumRight = 0u;
+	uint32_t sqrSumLeft = 0u;
+	uint32_t sqrSumRight = 0u;
+
+	for (unsigned int n = 0u; n < windowSize; ++n)
+	{
+		const uint32_t valueLeft = row[x - windowSize + n];
+		const uint32_t valueRight = row[x + 1u + n];
+
+		sumLeft += valueLeft;
+		sumRight += valueRight;
+
+		sqrSumLeft += valueLeft * valueLeft;
+		sqrSumRight += valueRight * valueRight;
+	}
+
+	const uint32_t normalizedSqrResidual = std::max(windowSize * windowSize * 2u, (windowSize * sqrSumLeft - sumLeft * sumLeft) + (windowSize * sqrSumRight - sumRight * sumRight));
+
+	const int normalizedDelta = int(sumLeft) - int(sumRight);
+
+	const int response = NumericT<int>::sign(normalizedDelta) * int((uint32_t(normalizedDelta * normalizedDelta) * 32u + normalizedSqrResidual / 2u) / normalizedSqrResidual);
+
+	return int16_t(minmax<int>(NumericT<int16_t>::minValue(), response, NumericT<int16_t>::maxValue()));
+}
+
 }
 
 }
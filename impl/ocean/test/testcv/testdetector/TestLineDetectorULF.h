@@ -115,6 +115,14 @@ class OCEAN_TEST_CV_DETECTOR_EXPORT TestLineDetectorULF : protected CV::Detector
 		 */
 		static bool testHorizontalSDStepEdgeDetector(const double testDuration);
 
+		/**
+		 * Tests the integer-based RMS bar and step edge detectors with and without worker and compares the responses with the scalar integer implementation.
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @param worker The worker object
+		 * @return True, if succeeded
+		 */
+		static bool testRMSEdgeDetectorsIntegerResponses(const double testDuration, Worker& worker);
+
 	protected:
 
 		/**
@@ -188,6 +196,29 @@ class OCEAN_TEST_CV_DETECTOR_EXPORT TestLineDetectorULF : protected CV::Detector
 		 * @return The response at the specified location
 		 */
 		static double sdStepEdgeResponseWithoutNonMaximumSuppression(const Frame& yFrame, const unsigned int x, const unsigned int y, const unsigned int stepSize, const unsigned int windowSize);
+
+		/**
+		 * Determines the horizontal response of the integer-based RMS bar edge detector for one pixel, with the same integer precision as RMSBarEdgeDetectorI.
+		 * @param yFrame The 8 bit grayscale frame for which the response will be calculated, must be valid, with dimension [window * 2 + 3, infinity)x[1, infinity)
+		 * @param x The horizontal location within the frame, with range [0, width - 1]
+		 * @param y The vertical location within the frame, with range [0, height - 1]
+		 * @param windowSize The size of the window to be used, in pixel, with range [1, 11]
+		 * @param minimalDelta The minimal intensity delta between average and center pixel, with range [0, 255]
+		 * @return The (squared) response at the specified location
+		 */
+		static int16_t rmsBarEdgeResponseI(const Frame& yFrame, const unsigned int x, const unsigned int y, const unsigned int windowSize, const unsigned int minimalDelta);
+
+		/**
+		 * Determines the horizontal response of the integer-based RMS step edge detector for one pixel, with the same integer precision as RMSStepEdgeDetectorI.
+		 * The response applies non-maximum suppression within a 3-neighborhood.
+		 * @param yFrame The 8 bit grayscale frame for which the response will be calculated, must be valid, with dimension [window * 2 + 1, infinity)x[1, infinity)
+		 * @param x The horizontal location within the frame, with range [0, width - 1]
+		 * @param y The vertical location within the frame, with range [0, height - 1]
+		 * @param windowSize The size of the window to be used, in pixel, with range [1, 8]
+		 * @param applyNonMaximumSuppression True, to apply the non-maximum suppression; False, to return the plain response
+		 * @return The (squared) response at the specified location
+		 */
+		static int16_t rmsStepEdgeResponseI(const Frame& yFrame, const unsigned int x, const unsigned int y, const unsigned int windowSize, const bool applyNonMaximumSuppression = true);
 };
 
 }
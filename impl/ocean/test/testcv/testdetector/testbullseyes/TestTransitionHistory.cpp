@@ -67,6 +67,12 @@ bool TestTransitionHistory::test(const double testDuration)
 
 	allSucceeded = testIsTransitionToWhite(testDuration, randomGenerator) && allSucceeded;
 
+	Log::info() << " ";
+	Log::info() << "-";
+	Log::info() << " ";
+
+	allSucceeded = testFindTransition(testDuration, randomGenerator) && allSucceeded;
+
 	Log::info() << " ";
 
 	if (allSucceeded)
@@ -109,6 +115,12 @@ TEST(TestTransitionHistory, IsTransitionToWhite)
 	EXPECT_TRUE(TestDetector::TestBullseyes::TestTransitionHistory::testIsTransitionToWhite(GTEST_TEST_DURATION, randomGenerator));
 }
 
+TEST(TestTransitionHistory, FindTransition)
+{
+	RandomGenerator randomGenerator;
+	EXPECT_TRUE(TestDetector::TestBullseyes::TestTransitionHistory::testFindTransition(GTEST_TEST_DURATION, randomGenerator));
+}
+
 namespace TestBullseyes
 {
 
@@ -522,6 +534,80 @@ bool TestTransitionHistory::testIsTransitionToWhite(const double testDuration, R
 	return validation.succeeded();
 }
 
+bool TestTransitionHistory::testFindTransition(const double testDuration, RandomGenerator& randomGenerator)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "TransitionHistory::findTransitionToBlack() and findTransitionToWhite() test:";
+
+	Validation validation(randomGenerator);
+
+	Timestamp start(true);
+
+	do
+	{
+		// a row with homogeneous segments, gentle gradients, and noise, so that all code paths of the scan are covered
+
+		const unsigned int width = RandomI::random(randomGenerator, 1u, 300u);
+
+		std::vector<uint8_t> row(width);
+
+		unsigned int n = 0u;
+
+		while (n < width)
+		{
+			const unsigned int segmentSize = RandomI::random(randomGenerator, 1u, 40u);
+			const int value = RandomI::random(randomGenerator, 0, 255);
+			const int slope = RandomI::random(randomGenerator, -12, 12);
+			const int noise = RandomI::random(randomGenerator, 0, 5);
+
+			for (unsigned int i = 0u; i < segmentSize && n < width; ++i, ++n)
+			{
+				row[n] = uint8_t(minmax(0, value + slope * int(i) + RandomI::random(randomGenerator, -noise, noise), 255));
+			}
+		}
+
+		const int deltaThreshold = RandomI::boolean(randomGenerator) ? TransitionHistory::defaultDeltaThreshold() : RandomI::random(randomGenerator, 0, 255);
+		const bool toBlack = RandomI::boolean(randomGenerator);
+
+		unsigned int xStart = 1u;
+
+		while (xStart < width)
+		{
+			unsigned int xExpected = xStart;
+
+			TransitionHistory expectedHistory;
+
+			while (xExpected < width && !(toBlack ? TransitionHistory::isTransitionToBlack(row.data() + xExpected, expectedHistory, deltaThreshold) : TransitionHistory::isTransitionToWhite(row.data() + xExpected, expectedHistory, deltaThreshold)))
+			{
+				++xExpected;
+			}
+
+			TransitionHistory history;
+
+			const unsigned int x = toBlack ? TransitionHistory::findTransitionToBlack(row.data(), xStart, width, history, deltaThreshold) : TransitionHistory::findTransitionToWhite(row.data(), xStart, width, history, deltaThreshold);
+
+			OCEAN_EXPECT_EQUAL(validation, x, xExpected);
+
+			if (x != xExpected || x >= width)
+			{
+				break;
+			}
+
+			OCEAN_EXPECT_EQUAL(validation, history.history1(), expectedHistory.history1());
+			OCEAN_EXPECT_EQUAL(validation, history.history2(), expectedHistory.history2());
+			OCEAN_EXPECT_EQUAL(validation, history.history3(), expectedHistory.history3());
+
+			xStart = x + 1u;
+		}
+	}
+	while (Timestamp(true) < start + testDuration);
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
 } // namespace TestBullseyes
 
 } // namespace TestDetector
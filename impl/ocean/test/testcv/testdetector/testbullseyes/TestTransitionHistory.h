@@ -72,6 +72,14 @@ class OCEAN_TEST_CV_DETECTOR_BULLSEYES_EXPORT TestTransitionHistory
 		 * @return True, if succeeded
 		 */
 		static bool testIsTransitionToWhite(const double testDuration, RandomGenerator& randomGenerator);
+
+		/**
+		 * Test for TransitionHistory::findTransitionToBlack() and findTransitionToWhite(), comparing the results with a pixel-by-pixel scan
+		 * @param testDuration The duration in seconds for which this test will be run, must be > 0.0
+		 * @param randomGenerator A random generator that will be used to generate test data
+		 * @return True, if succeeded
+		 */
+		static bool testFindTransition(const double testDuration, RandomGenerator& randomGenerator);
 };
 
 } // namespace TestBullseyes
@@ -8,8 +8,10 @@
 #include "ocean/test/testcv/testdetector/testqrcodes/TestFinderPatternDetector.h"
 #include "ocean/test/testcv/testdetector/testqrcodes/Utilities.h"
 
+#include "ocean/test/Validation.h"
 #include "ocean/test/ValidationPrecision.h"
 
+#include "ocean/base/HighPerformanceTimer.h"
 #include "ocean/base/RandomI.h"
 
 #include "ocean/cv/Canvas.h"
@@ -68,6 +70,18 @@ bool TestFinderPatternDetector::test(const double testDuration, Worker& worker)
 
 	allSucceeded = testDetectFinderPatternSyntheticData(7u, testDuration, worker) && allSucceeded;
 
+	Log::info() << " ";
+	Log::info() << "-";
+	Log::info() << " ";
+
+	allSucceeded = testDetectFinderPatternsInSubRegion(testDuration, worker) && allSucceeded;
+
+	Log::info() << " ";
+	Log::info() << "-";
+	Log::info() << " ";
+
+	allSucceeded = testDetectFinderPatternsCoarseToFine(testDuration, worker) && allSucceeded;
+
 	Log::info() << " ";
 
 	if (allSucceeded)
@@ -108,6 +122,18 @@ TEST(TestCVDetectorQRCodesFinderPatternDetector, TestDetectFinderPatternSyntheti
 	EXPECT_TRUE(TestFinderPatternDetector::testDetectFinderPatternSyntheticData(7u, GTEST_TEST_DURATION, worker));
 }
 
+TEST(TestCVDetectorQRCodesFinderPatternDetector, DetectFinderPatternsInSubRegion)
+{
+	Worker worker;
+	EXPECT_TRUE(TestFinderPatternDetector::testDetectFinderPatternsInSubRegion(GTEST_TEST_DURATION, worker));
+}
+
+TEST(TestCVDetectorQRCodesFinderPatternDetector, DetectFinderPatternsCoarseToFine)
+{
+	Worker worker;
+	EXPECT_TRUE(TestFinderPatternDetector::testDetectFinderPatternsCoarseToFine(GTEST_TEST_DURATION, worker));
+}
+
 #endif // OCEAN_USE_GTEST
 
 bool TestFinderPatternDetector::testDetectFinderPatternSyntheticData(const unsigned int filterSize, const double testDuration, Worker& worker)
@@ -284,6 +310,218 @@ bool TestFinderPatternDetector::testDetectFinderPatternSyntheticData(const unsig
 	return validation.succeeded();
 }
 
+bool TestFinderPatternDetector::testDetectFinderPatternsInSubRegion(const double testDuration, Worker& worker)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Test: detect finder patterns in sub-region";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		const unsigned int width = RandomI::random(randomGenerator, 250u, 1280u);
+		const unsigned int height = RandomI::random(randomGenerator, 250u, 1280u);
+
+		Vectors2 locations;
+		const Frame frame = createFrameWithFinderPatterns(width, height, Scalar(25), randomGenerator, locations, &worker);
+
+		const unsigned int left = RandomI::random(randomGenerator, 0u, width - 20u);
+		const unsigned int top = RandomI::random(randomGenerator, 0u, height - 20u);
+		const unsigned int right = RandomI::random(randomGenerator, left + 15u, width + 100u); // the region may exceed the frame
+		const unsigned int bottom = RandomI::random(randomGenerator, top + 15u, height + 100u);
+
+		const CV::PixelBoundingBox subRegion(left, top, right, bottom);
+
+		const FinderPatterns finderPatterns = FinderPatternDetector::detectFinderPatterns(frame.constdata<uint8_t>(), frame.width(), frame.height(), 10u, frame.paddingElements(), nullptr);
+		const FinderPatterns subRegionFinderPatterns = FinderPatternDetector::detectFinderPatternsInSubRegion(frame.constdata<uint8_t>(), frame.width(), frame.height(), subRegion, 10u, frame.paddingElements(), RandomI::boolean(randomGenerator) ? &worker : nullptr);
+
+		for (const FinderPattern& subRegionFinderPattern : subRegionFinderPatterns)
+		{
+			// all finder patterns must be located inside the sub-region
+
+			OCEAN_EXPECT_GREATER_EQUAL(validation, subRegionFinderPattern.position().x(), Scalar(left));
+			OCEAN_EXPECT_GREATER_EQUAL(validation, subRegionFinderPattern.position().y(), Scalar(top));
+			OCEAN_EXPECT_LESS_EQUAL(validation, subRegionFinderPattern.position().x(), Scalar(std::min(right, width - 1u)));
+			OCEAN_EXPECT_LESS_EQUAL(validation, subRegionFinderPattern.position().y(), Scalar(std::min(bottom, height - 1u)));
+		}
+
+		for (const FinderPattern& finderPattern : finderPatterns)
+		{
+			// each finder pattern which lies entirely inside the sub-region (with some margin) must be detected at the identical location
+
+			const Scalar margin = finderPattern.length() * Scalar(1.5) + Scalar(10);
+
+			const Vector2& position = finderPattern.position();
+
+			if (position.x() - margin < Scalar(left) || position.y() - margin < Scalar(top) || position.x() + margin > Scalar(std::min(right, width - 1u)) || position.y() + margin > Scalar(std::min(bottom, height - 1u)))
+			{
+				continue;
+			}
+
+			bool foundMatch = false;
+
+			for (const FinderPattern& subRegionFinderPattern : subRegionFinderPatterns)
+			{
+				if (subRegionFinderPattern.position().sqrDistance(position) < Numeric::sqr(Scalar(0.5)))
+				{
+					foundMatch = true;
+					break;
+				}
+			}
+
+			OCEAN_EXPECT_TRUE(validation, foundMatch);
+		}
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
+bool TestFinderPatternDetector::testDetectFinderPatternsCoarseToFine(const double testDuration, Worker& worker)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Test: detect finder patterns coarse-to-fine";
+
+	RandomGenerator randomGenerator;
+	ValidationPrecision validation(0.95, randomGenerator);
+
+	uint64_t falsePositiveDetections = 0ull;
+	uint64_t finderPatternsTotal = 0ull;
+
+	HighPerformanceStatistic performanceFull;
+	HighPerformanceStatistic performanceCoarseToFine;
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		const unsigned int width = RandomI::random(randomGenerator, 250u, 1920u);
+		const unsigned int height = RandomI::random(randomGenerator, 250u, 1920u);
+
+		Vectors2 locations;
+		// the coarse-to-fine detection needs modules with at least five pixels
+
+		const Frame frame = createFrameWithFinderPatterns(width, height, Scalar(35), randomGenerator, locations, &worker);
+
+		Worker* useWorker = RandomI::boolean(randomGenerator) ? &worker : nullptr;
+
+		performanceFull.start();
+			const FinderPatterns finderPatterns = FinderPatternDetector::detectFinderPatterns(frame.constdata<uint8_t>(), frame.width(), frame.height(), 10u, frame.paddingElements(), useWorker);
+		performanceFull.stop();
+
+		performanceCoarseToFine.start();
+			const FinderPatterns coarseToFineFinderPatterns = FinderPatternDetector::detectFinderPatternsCoarseToFine(frame.constdata<uint8_t>(), frame.width(), frame.height(), 10u, frame.paddingElements(), useWorker);
+		performanceCoarseToFine.stop();
+
+		finderPatternsTotal += locations.size();
+
+		size_t truePositives = 0;
+
+		for (const Vector2& location : locations)
+		{
+			for (const FinderPattern& finderPattern : coarseToFineFinderPatterns)
+			{
+				if (finderPattern.position().sqrDistance(location) < Numeric::sqr(Scalar(5)))
+				{
+					++truePositives;
+					break;
+				}
+			}
+		}
+
+		validation.addIterations(truePositives, locations.size());
+
+		for (const FinderPattern& finderPattern : coarseToFineFinderPatterns)
+		{
+			bool foundMatch = false;
+
+			for (const Vector2& location : locations)
+			{
+				if (finderPattern.position().sqrDistance(location) < Numeric::sqr(Scalar(5)))
+				{
+					foundMatch = true;
+					break;
+				}
+			}
+
+			if (!foundMatch)
+			{
+				++falsePositiveDetections;
+			}
+		}
+	}
+	while (validation.needMoreIterations() || !startTimestamp.hasTimePassed(testDuration));
+
+	ocean_assert(finderPatternsTotal != 0ull);
+	const double percentFalsePositives = double(falsePositiveDetections) / double(finderPatternsTotal);
+
+	Log::info() << "Full resolution performance: " << performanceFull;
+	Log::info() << "Coarse-to-fine performance: " << performanceCoarseToFine;
+	Log::info() << "Correct detections: " << validation;
+	Log::info() << "False positives:    " << String::toAString(percentFalsePositives * 100.0, 2u) << "%";
+
+	if (percentFalsePositives > 0.01)
+	{
+		OCEAN_SET_FAILED(validation);
+	}
+
+	return validation.succeeded();
+}
+
+Frame TestFinderPatternDetector::createFrameWithFinderPatterns(const unsigned int width, const unsigned int height, const Scalar minimalLength, RandomGenerator& randomGenerator, Vectors2& locations, Worker* worker)
+{
+	ocean_assert(width >= 250u && height >= 250u);
+	ocean_assert(minimalLength >= Scalar(25) && minimalLength <= Scalar(49));
+
+	const uint8_t backgroundColor = uint8_t(RandomI::random(randomGenerator, 200u, 255u));
+
+	Frame frame = CV::CVUtilities::randomizedFrame(FrameType(width, height, FrameType::FORMAT_Y8, FrameType::ORIGIN_UPPER_LEFT), &randomGenerator);
+	frame.setValue(backgroundColor);
+
+	locations.clear();
+	Scalars lengths;
+
+	const unsigned int finderPatternsCount = RandomI::random(randomGenerator, 1u, 30u);
+
+	for (unsigned int n = 0u; n < finderPatternsCount; ++n)
+	{
+		const Scalar length = Random::scalar(randomGenerator, minimalLength, Scalar(49));
+		const Vector2 location = Random::vector2(randomGenerator, length * Scalar(2), Scalar(width) - length * Scalar(2) - Scalar(1), length * Scalar(2), Scalar(height) - length * Scalar(2) - Scalar(1));
+
+		bool tooClose = false;
+
+		for (size_t i = 0; i < locations.size(); ++i)
+		{
+			if (locations[i].distance(location) <= (lengths[i] + length) * Numeric::sqrt(Scalar(2)) * Scalar(1.15))
+			{
+				tooClose = true;
+				break;
+			}
+		}
+
+		if (!tooClose)
+		{
+			const uint8_t foregroundColor = uint8_t(RandomI::random(randomGenerator, 0u, 50u));
+
+			paintFinderPattern(frame, location, length, Random::scalar(randomGenerator, Scalar(0), Numeric::pi_2()), foregroundColor, backgroundColor, worker);
+
+			locations.push_back(location);
+			lengths.push_back(length);
+		}
+	}
+
+	ocean_assert(!locations.empty());
+
+	return frame;
+}
+
 void TestFinderPatternDetector::paintFinderPattern(Frame& yFrame, const Vector2& location, const Scalar& length, const Scalar& rotationAngle, const uint8_t foregroundColor, const uint8_t backgroundColor, Worker* worker)
 {
 	ocean_assert(yFrame.isValid() && yFrame.isPixelFormatDataLayoutCompatible(FrameType::FORMAT_Y8));
@@ -53,6 +53,22 @@ class OCEAN_TEST_CV_DETECTOR_QRCODES_EXPORT TestFinderPatternDetector : protecte
 		 */
 		static bool testDetectFinderPatternSyntheticData(const unsigned int filterSize, const double testDuration, Worker& worker);
 
+		/**
+		 * Tests the detection of finder patterns in a sub-region of an image.
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @param worker The worker object
+		 * @return True, if succeeded
+		 */
+		static bool testDetectFinderPatternsInSubRegion(const double testDuration, Worker& worker);
+
+		/**
+		 * Tests the coarse-to-fine detection of finder patterns.
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @param worker The worker object
+		 * @return True, if succeeded
+		 */
+		static bool testDetectFinderPatternsCoarseToFine(const double testDuration, Worker& worker);
+
 	protected:
 
 		 /**
@@ -66,6 +82,18 @@ class OCEAN_TEST_CV_DETECTOR_QRCODES_EXPORT TestFinderPatternDetector : protecte
 		  * @param worker Optional worker instance
 		  */
 		static void paintFinderPattern(Frame& yFrame, const Vector2& location, const Scalar& length, const Scalar& rotation, const uint8_t foregroundColor, const uint8_t backgroundColor, Worker* worker = nullptr);
+
+		/**
+		 * Creates a random grayscale image with randomly located finder patterns.
+		 * @param width The width of the image, in pixel, with range [250, infinity)
+		 * @param height The height of the image, in pixel, with range [250, infinity)
+		 * @param minimalLength The minimal length of the finder patterns, in pixel, with range [25, 49]
+		 * @param randomGenerator The random generator to be used
+		 * @param locations The resulting locations of the finder patterns
+		 * @param worker Optional worker instance
+		 * @return The resulting image with pixel format FORMAT_Y8
+		 */
+		static Frame createFrameWithFinderPatterns(const unsigned int width, const unsigned int height, const Scalar minimalLength, RandomGenerator& randomGenerator, Vectors2& locations, Worker* worker = nullptr);
 };
 
 } // namespace TestQRCodes
@@ -9,6 +9,7 @@
 #include "ocean/test/testcv/testsegmentation/TestBinPacking.h"
 #include "ocean/test/testcv/testsegmentation/TestMaskAnalyzer.h"
 #include "ocean/test/testcv/testsegmentation/TestMaskCreator.h"
+#include "ocean/test/testcv/testsegmentation/TestSeedSegmentation.h"
 
 #include "ocean/test/TestResult.h"
 
@@ -99,6 +100,15 @@ bool testCVSegmentation(const double testDuration, Worker& worker, const unsigne
 		testResult = TestBinPacking::test(testDuration, worker, subSelector);
 	}
 
+	if (TestSelector subSelector = selector.shouldRun("seedsegmentation"))
+	{
+		Log::info() << " ";
+		Log::info() << " ";
+		Log::info() << " ";
+		Log::info() << " ";
+		testResult = TestSeedSegmentation::test(testDuration, worker, subSelector);
+	}
+
 	Log::info() << " ";
 	Log::info() << " ";
 	Log::info() << " ";
@@ -203,6 +203,15 @@ bool TestMaskAnalyzer::test(const unsigned int width, const unsigned int height,
 		Log::info() << " ";
 	}
 
+	if (selector.shouldRun("detectmaskcomponents"))
+	{
+		testResult = testDetectMaskComponents(testDuration, worker);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
 	if (selector.shouldRun("countmaskpixels"))
 	{
 		testResult = testCountMaskPixels(testDuration);
@@ -336,6 +345,12 @@ TEST(TestMaskAnalyzer, DetectBoundingBoxes)
 	EXPECT_TRUE(TestMaskAnalyzer::testDetectBoundingBoxes(GTEST_TEST_DURATION));
 }
 
+TEST(TestMaskAnalyzer, DetectMaskComponents)
+{
+	Worker worker;
+	EXPECT_TRUE(TestMaskAnalyzer::testDetectMaskComponents(GTEST_TEST_DURATION, worker));
+}
+
 TEST(TestMaskAnalyzer, CountMaskPixels)
 {
 	EXPECT_TRUE(TestMaskAnalyzer::testCountMaskPixels(GTEST_TEST_DURATION));
@@ -1532,6 +1547,213 @@ bool TestMaskAnalyzer::testDetectBoundingBoxes(const double testDuration)
 	return validation.succeeded();
 }
 
+bool TestMaskAnalyzer::testDetectMaskComponents(const double testDuration, Worker& worker)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Detect mask components test:";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		const unsigned int width = RandomI::random(randomGenerator, 1u, 500u);
+		const unsigned int height = RandomI::random(randomGenerator, 1u, 500u);
+
+		const uint8_t maskValue = uint8_t(RandomI::random(randomGenerator, 255u));
+		const uint8_t nonMaskValue = uint8_t(255u - maskValue);
+
+		const unsigned int maskPaddingElements = RandomI::random(randomGenerator, 1u) * RandomI::random(randomGenerator, 1u, 100u);
+
+		Frame mask(FrameType(width, height, FrameType::FORMAT_Y8, FrameType::ORIGIN_UPPER_LEFT), maskPaddingElements);
+		mask.setValue(nonMaskValue);
+
+		if (RandomI::boolean(randomGenerator))
+		{
+			// random noise
+
+			const unsigned int threshold = RandomI::random(randomGenerator, 20u, 60u);
+
+			for (unsigned int y = 0u; y < height; ++y)
+			{
+				for (unsigned int x = 0u; x < width; ++x)
+				{
+					if (RandomI::random(randomGenerator, 99u) < threshold)
+					{
+						mask.pixel<uint8_t>(x, y)[0] = maskValue;
+					}
+				}
+			}
+		}
+		else
+		{
+			// random boxes
+
+			const unsigned int numberBoxes = RandomI::random(randomGenerator, 1u, 30u);
+
+			for (unsigned int n = 0u; n < numberBoxes; ++n)
+			{
+				const unsigned int left = RandomI::random(randomGenerator, 0u, width - 1u);
+				const unsigned int top = RandomI::random(randomGenerator, 0u, height - 1u);
+
+				const unsigned int right = RandomI::random(randomGenerator, left, width - 1u);
+				const unsigned int bottom = RandomI::random(randomGenerator, top, height - 1u);
+
+				mask.subFrame(left, top, right - left + 1u, bottom - top + 1u, Frame::CM_USE_KEEP_LAYOUT).setValue(maskValue);
+			}
+		}
+
+		const bool useNeighborhood4 = RandomI::boolean(randomGenerator);
+		const bool determineContours = RandomI::boolean(randomGenerator);
+
+		const unsigned int labelsPaddingElements = RandomI::random(randomGenerator, 1u) * RandomI::random(randomGenerator, 1u, 100u);
+
+		Frame labels(FrameType(width, height, FrameType::FORMAT_Y32, FrameType::ORIGIN_UPPER_LEFT), labelsPaddingElements);
+		labels.setValue(0xFF);
+
+		Worker* useWorker = RandomI::boolean(randomGenerator) ? &worker : nullptr;
+
+		const MaskComponents components = detectMaskComponents(mask.constdata<uint8_t>(), width, height, mask.paddingElements(), maskValue, useNeighborhood4, determineContours, labels.data<uint32_t>(), labels.paddingElements(), useWorker);
+
+		// determining the components with a flood fill in raster order
+
+		Frame testLabels(labels.frameType());
+		testLabels.setValue(0x00);
+
+		unsigned int testComponents = 0u;
+
+		for (unsigned int yStart = 0u; yStart < height; ++yStart)
+		{
+			for (unsigned int xStart = 0u; xStart < width; ++xStart)
+			{
+				if (mask.constpixel<uint8_t>(xStart, yStart)[0] != maskValue || testLabels.constpixel<uint32_t>(xStart, yStart)[0] != 0u)
+				{
+					continue;
+				}
+
+				const uint32_t label = ++testComponents;
+
+				unsigned int size = 0u;
+				uint64_t sumX = 0ull;
+				uint64_t sumY = 0ull;
+				CV::PixelBoundingBox boundingBox;
+
+				CV::PixelPositions stack(1, CV::PixelPosition(xStart, yStart));
+				testLabels.pixel<uint32_t>(xStart, yStart)[0] = label;
+
+				while (!stack.empty())
+				{
+					const CV::PixelPosition position = stack.back();
+					stack.pop_back();
+
+					++size;
+					sumX += position.x();
+					sumY += position.y();
+					boundingBox += position;
+
+					for (int yOffset = -1; yOffset <= 1; ++yOffset)
+					{
+						for (int xOffset = -1; xOffset <= 1; ++xOffset)
+						{
+							if ((xOffset == 0 && yOffset == 0) || (useNeighborhood4 && xOffset != 0 && yOffset != 0))
+							{
+								continue;
+							}
+
+							const int x = int(position.x()) + xOffset;
+							const int y = int(position.y()) + yOffset;
+
+							if (x >= 0 && y >= 0 && x < int(width) && y < int(height) && mask.constpixel<uint8_t>((unsigned int)(x), (unsigned int)(y))[0] == maskValue && testLabels.constpixel<uint32_t>((unsigned int)(x), (unsigned int)(y))[0] == 0u)
+							{
+								testLabels.pixel<uint32_t>((unsigned int)(x), (unsigned int)(y))[0] = label;
+								stack.emplace_back((unsigned int)(x), (unsigned int)(y));
+							}
+						}
+					}
+				}
+
+				if (label > components.size())
+				{
+					OCEAN_SET_FAILED(validation);
+					continue;
+				}
+
+				const MaskComponent& component = components[label - 1u];
+
+				OCEAN_EXPECT_EQUAL(validation, component.id(), (unsigned int)(label));
+				OCEAN_EXPECT_EQUAL(validation, component.seedPosition(), CV::PixelPosition(xStart, yStart));
+				OCEAN_EXPECT_EQUAL(validation, component.size(), size);
+				OCEAN_EXPECT_EQUAL(validation, component.boundingBox(), boundingBox);
+
+				const bool border = boundingBox.left() == 0u || boundingBox.top() == 0u || boundingBox.rightEnd() == width || boundingBox.bottomEnd() == height;
+				OCEAN_EXPECT_EQUAL(validation, component.border(), border);
+
+				const Vector2 centerOfMass(Scalar(double(sumX) / double(size)), Scalar(double(sumY) / double(size)));
+				OCEAN_EXPECT_TRUE(validation, component.centerOfMass().isEqual(centerOfMass, Scalar(0.01)));
+
+				if (determineContours)
+				{
+					// the contour must start at the seed, must be dense and closed, and must be composed of component pixels
+
+					const CV::PixelPositions& contour = component.contour().pixels();
+
+					if (!contour.empty())
+					{
+						OCEAN_EXPECT_EQUAL(validation, contour.front(), CV::PixelPosition(xStart, yStart));
+
+						for (size_t n = 0; n < contour.size(); ++n)
+						{
+							const CV::PixelPosition& position = contour[n];
+							const CV::PixelPosition& nextPosition = contour[(n + 1) % contour.size()];
+
+							if (contour.size() > 1 && !position.isNeighbor8(nextPosition))
+							{
+								OCEAN_SET_FAILED(validation);
+							}
+
+							if (position.x() >= width || position.y() >= height || testLabels.constpixel<uint32_t>(position.x(), position.y())[0] != label)
+							{
+								OCEAN_SET_FAILED(validation);
+							}
+						}
+
+						if ((size == 1u) != (contour.size() == 1))
+						{
+							OCEAN_SET_FAILED(validation);
+						}
+					}
+					else
+					{
+						OCEAN_SET_FAILED(validation);
+					}
+				}
+				else
+				{
+					OCEAN_EXPECT_TRUE(validation, component.contour().isEmpty());
+				}
+			}
+		}
+
+		OCEAN_EXPECT_EQUAL(validation, components.size(), size_t(testComponents));
+
+		for (unsigned int y = 0u; y < height; ++y)
+		{
+			if (memcmp(labels.constrow<uint32_t>(y), testLabels.constrow<uint32_t>(y), width * sizeof(uint32_t)) != 0)
+			{
+				OCEAN_SET_FAILED(validation);
+			}
+		}
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
 bool TestMaskAnalyzer::testCountMaskPixels(const double testDuration)
 {
 	ocean_assert(testDuration > 0.0);
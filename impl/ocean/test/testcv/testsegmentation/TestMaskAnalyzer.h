@@ -223,6 +223,14 @@ class OCEAN_TEST_CV_SEGMENTATION_EXPORT TestMaskAnalyzer : public CV::Segmentati
 		 */
 		static bool testDetectBoundingBoxes(const double testDuration);
 
+		/**
+		 * Tests the detect mask components function.
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @param worker The worker object
+		 * @return True, if succeeded
+		 */
+		static bool testDetectMaskComponents(const double testDuration, Worker& worker);
+
 		/**
 		 * Tests the count mask pixels functions.
 		 * @param testDuration Number of seconds for each test, with range (0, infinity)
@@ -0,0 +1,377 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "ocean/test/testcv/testsegmentation/TestSeedSegmentation.h"
+
+#include "ocean/test/TestResult.h"
+#include "ocean/test/Validation.h"
+
+#include "ocean/base/HighPerformanceTimer.h"
+#include "ocean/base/RandomI.h"
+#include "ocean/base/Timestamp.h"
+
+#include "ocean/cv/PixelBoundingBox.h"
+
+#include "ocean/cv/segmentation/SeedSegmentation.h"
+
+namespace Ocean
+{
+
+namespace Test
+{
+
+namespace TestCV
+{
+
+namespace TestSegmentation
+{
+
+bool TestSeedSegmentation::test(const double testDuration, Worker& worker, const TestSelector& selector)
+{
+	ocean_assert(testDuration > 0.0);
+
+	TestResult testResult("Seed segmentation test");
+	Log::info() << " ";
+
+	if (selector.shouldRun("scanlineseedsegmentation"))
+	{
+		testResult = testScanlineSeedSegmentation(testDuration, worker);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
+	if (selector.shouldRun("iterativescanlineseedsegmentation"))
+	{
+		testResult = testIterativeScanlineSeedSegmentation(testDuration, worker);
+	}
+
+	Log::info() << " ";
+
+	Log::info() << testResult;
+
+	return testResult.succeeded();
+}
+
+#ifdef OCEAN_USE_GTEST
+
+TEST(TestSeedSegmentation, ScanlineSeedSegmentation)
+{
+	Worker worker;
+	EXPECT_TRUE(TestSeedSegmentation::testScanlineSeedSegmentation(GTEST_TEST_DURATION, worker));
+}
+
+TEST(TestSeedSegmentation, IterativeScanlineSeedSegmentation)
+{
+	Worker worker;
+	EXPECT_TRUE(TestSeedSegmentation::testIterativeScanlineSeedSegmentation(GTEST_TEST_DURATION, worker));
+}
+
+#endif // OCEAN_USE_GTEST
+
+bool TestSeedSegmentation::testScanlineSeedSegmentation(const double testDuration, Worker& worker)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Scanline seed segmentation test:";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	HighPerformanceStatistic performancePixelwise;
+	HighPerformanceStatistic performanceSinglecore;
+	HighPerformanceStatistic performanceMulticore;
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		const bool benchmarkIteration = RandomI::boolean(randomGenerator);
+
+		const unsigned int width = benchmarkIteration ? 1920u : RandomI::random(randomGenerator, 1u, 400u);
+		const unsigned int height = benchmarkIteration ? 1080u : RandomI::random(randomGenerator, 1u, 400u);
+		const unsigned int channels = RandomI::random(randomGenerator, 1u, 4u);
+
+		const Frame frame = createFrame(width, height, channels, randomGenerator);
+
+		const CV::PixelPosition seed(RandomI::random(randomGenerator, width - 1u), RandomI::random(randomGenerator, height - 1u));
+
+		const uint8_t localThreshold = uint8_t(RandomI::random(randomGenerator, 0u, 20u));
+		const uint8_t globalThreshold = RandomI::boolean(randomGenerator) ? uint8_t(0u) : uint8_t(RandomI::random(randomGenerator, 1u, 120u));
+
+		Frame referenceMask(FrameType(frame, FrameType::FORMAT_Y8), RandomI::random(randomGenerator, 1u, 100u) * RandomI::random(randomGenerator, 1u));
+		CV::PixelBoundingBox referenceBoundingBox;
+
+		unsigned int referencePixels = 0u;
+
+		if (benchmarkIteration)
+		{
+			performancePixelwise.start();
+		}
+
+		switch (channels)
+		{
+			case 1u:
+				referencePixels = CV::Segmentation::SeedSegmentation::seedSegmentation<uint8_t, 1u>(frame.constdata<uint8_t>(), referenceMask.data<uint8_t>(), width, height, frame.paddingElements(), referenceMask.paddingElements(), seed, localThreshold, globalThreshold, &referenceBoundingBox);
+				break;
+
+			case 2u:
+				referencePixels = CV::Segmentation::SeedSegmentation::seedSegmentation<uint8_t, 2u>(frame.constdata<uint8_t>(), referenceMask.data<uint8_t>(), width, height, frame.paddingElements(), referenceMask.paddingElements(), seed, localThreshold, globalThreshold, &referenceBoundingBox);
+				break;
+
+			case 3u:
+				referencePixels = CV::Segmentation::SeedSegmentation::seedSegmentation<uint8_t, 3u>(frame.constdata<uint8_t>(), referenceMask.data<uint8_t>(), width, height, frame.paddingElements(), referenceMask.paddingElements(), seed, localThreshold, globalThreshold, &referenceBoundingBox);
+				break;
+
+			case 4u:
+				referencePixels = CV::Segmentation::SeedSegmentation::seedSegmentation<uint8_t, 4u>(frame.constdata<uint8_t>(), referenceMask.data<uint8_t>(), width, height, frame.paddingElements(), referenceMask.paddingElements(), seed, localThreshold, globalThreshold, &referenceBoundingBox);
+				break;
+		}
+
+		if (benchmarkIteration)
+		{
+			performancePixelwise.stop();
+		}
+
+		// the pixel-wise seed segmentation counts the seed pixel twice
+		ocean_assert(referencePixels >= 2u);
+		--referencePixels;
+
+		for (const bool useWorker : {false, true})
+		{
+			Worker* useWorkerPointer = useWorker ? &worker : nullptr;
+			HighPerformanceStatistic& performance = useWorker ? performanceMulticore : performanceSinglecore;
+
+			Frame mask(referenceMask.frameType(), RandomI::random(randomGenerator, 1u, 100u) * RandomI::random(randomGenerator, 1u));
+			CV::PixelBoundingBox boundingBox;
+
+			unsigned int pixels = 0u;
+
+			if (benchmarkIteration)
+			{
+				performance.start();
+			}
+
+			switch (channels)
+			{
+				case 1u:
+					pixels = CV::Segmentation::SeedSegmentation::scanlineSeedSegmentation8BitPerChannel<1u>(frame.constdata<uint8_t>(), mask.data<uint8_t>(), width, height, frame.paddingElements(), mask.paddingElements(), seed, localThreshold, globalThreshold, &boundingBox, useWorkerPointer);
+					break;
+
+				case 2u:
+					pixels = CV::Segmentation::SeedSegmentation::scanlineSeedSegmentation8BitPerChannel<2u>(frame.constdata<uint8_t>(), mask.data<uint8_t>(), width, height, frame.paddingElements(), mask.paddingElements(), seed, localThreshold, globalThreshold, &boundingBox, useWorkerPointer);
+					break;
+
+				case 3u:
+					pixels = CV::Segmentation::SeedSegmentation::scanlineSeedSegmentation8BitPerChannel<3u>(frame.constdata<uint8_t>(), mask.data<uint8_t>(), width, height, frame.paddingElements(), mask.paddingElements(), seed, localThreshold, globalThreshold, &boundingBox, useWorkerPointer);
+					break;
+
+				case 4u:
+					pixels = CV::Segmentation::SeedSegmentation::scanlineSeedSegmentation8BitPerChannel<4u>(frame.constdata<uint8_t>(), mask.data<uint8_t>(), width, height, frame.paddingElements(), mask.paddingElements(), seed, localThreshold, globalThreshold, &boundingBox, useWorkerPointer);
+					break;
+			}
+
+			if (benchmarkIteration)
+			{
+				performance.stop();
+			}
+
+			OCEAN_EXPECT_EQUAL(validation, pixels, referencePixels);
+			OCEAN_EXPECT_TRUE(validation, boundingBox == referenceBoundingBox);
+
+			for (unsigned int y = 0u; y < height; ++y)
+			{
+				if (memcmp(mask.constrow<uint8_t>(y), referenceMask.constrow<uint8_t>(y), width) != 0)
+				{
+					OCEAN_SET_FAILED(validation);
+					break;
+				}
+			}
+		}
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Pixel-wise performance: " << performancePixelwise;
+	Log::info() << "Scanline singlecore performance: " << performanceSinglecore;
+	Log::info() << "Scanline multicore performance: " << performanceMulticore;
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
+bool TestSeedSegmentation::testIterativeScanlineSeedSegmentation(const double testDuration, Worker& worker)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Iterative scanline seed segmentation test:";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		const unsigned int width = RandomI::random(randomGenerator, 1u, 400u);
+		const unsigned int height = RandomI::random(randomGenerator, 1u, 400u);
+		const unsigned int channels = RandomI::random(randomGenerator, 1u, 3u);
+
+		const Frame frame = createFrame(width, height, channels, randomGenerator);
+
+		const CV::PixelPosition seed(RandomI::random(randomGenerator, width - 1u), RandomI::random(randomGenerator, height - 1u));
+
+		const uint8_t localThreshold = uint8_t(RandomI::random(randomGenerator, 0u, 20u));
+		const uint8_t minimalGlobalThreshold = uint8_t(RandomI::random(randomGenerator, 1u, 60u));
+		const uint8_t maximalGlobalThreshold = uint8_t(RandomI::random(randomGenerator, (unsigned int)(minimalGlobalThreshold), 120u));
+		const unsigned int maximalIncreaseFactor = RandomI::random(randomGenerator, 1u, 10u);
+
+		// the reference applies the pixel-wise seed segmentation for each global threshold individually
+
+		Frame referenceMask(FrameType(frame, FrameType::FORMAT_Y8));
+		Frame iterationMask(referenceMask.frameType());
+
+		unsigned int referencePixels = 0u;
+		CV::PixelBoundingBox referenceBoundingBox;
+
+		unsigned int maximalIterationPixels = (unsigned int)(-1);
+
+		for (unsigned int globalThreshold = minimalGlobalThreshold; globalThreshold <= maximalGlobalThreshold; ++globalThreshold)
+		{
+			CV::PixelBoundingBox iterationBoundingBox;
+			unsigned int iterationPixels = 0u;
+
+			switch (channels)
+			{
+				case 1u:
+					iterationPixels = CV::Segmentation::SeedSegmentation::seedSegmentation<uint8_t, 1u>(frame.constdata<uint8_t>(), iterationMask.data<uint8_t>(), width, height, frame.paddingElements(), iterationMask.paddingElements(), seed, localThreshold, uint8_t(globalThreshold), &iterationBoundingBox);
+					break;
+
+				case 2u:
+					iterationPixels = CV::Segmentation::SeedSegmentation::seedSegmentation<uint8_t, 2u>(frame.constdata<uint8_t>(), iterationMask.data<uint8_t>(), width, height, frame.paddingElements(), iterationMask.paddingElements(), seed, localThreshold, uint8_t(globalThreshold), &iterationBoundingBox);
+					break;
+
+				case 3u:
+					iterationPixels = CV::Segmentation::SeedSegmentation::seedSegmentation<uint8_t, 3u>(frame.constdata<uint8_t>(), iterationMask.data<uint8_t>(), width, height, frame.paddingElements(), iterationMask.paddingElements(), seed, localThreshold, uint8_t(globalThreshold), &iterationBoundingBox);
+					break;
+			}
+
+			// the pixel-wise seed segmentation counts the seed pixel twice
+			ocean_assert(iterationPixels >= 2u);
+			--iterationPixels;
+
+			if (globalThreshold != minimalGlobalThreshold)
+			{
+				if (iterationPixels > maximalIterationPixels)
+				{
+					break;
+				}
+
+				maximalIterationPixels = std::max(iterationPixels + maximalIncreaseFactor * (iterationPixels - referencePixels), iterationPixels * 105u / 100u);
+			}
+
+			referencePixels = iterationPixels;
+			referenceBoundingBox = iterationBoundingBox;
+
+			std::swap(referenceMask, iterationMask);
+		}
+
+		for (const bool useWorker : {false, true})
+		{
+			Worker* useWorkerPointer = useWorker ? &worker : nullptr;
+
+			Frame mask(referenceMask.frameType(), RandomI::random(randomGenerator, 1u, 100u) * RandomI::random(randomGenerator, 1u));
+			CV::PixelBoundingBox boundingBox;
+
+			unsigned int pixels = 0u;
+
+			switch (channels)
+			{
+				case 1u:
+					pixels = CV::Segmentation::SeedSegmentation::iterativeScanlineSeedSegmentation8BitPerChannel<1u>(frame.constdata<uint8_t>(), mask.data<uint8_t>(), width, height, frame.paddingElements(), mask.paddingElements(), seed, localThreshold, minimalGlobalThreshold, maximalGlobalThreshold, maximalIncreaseFactor, &boundingBox, useWorkerPointer);
+					break;
+
+				case 2u:
+					pixels = CV::Segmentation::SeedSegmentation::iterativeScanlineSeedSegmentation8BitPerChannel<2u>(frame.constdata<uint8_t>(), mask.data<uint8_t>(), width, height, frame.paddingElements(), mask.paddingElements(), seed, localThreshold, minimalGlobalThreshold, maximalGlobalThreshold, maximalIncreaseFactor, &boundingBox, useWorkerPointer);
+					break;
+
+				case 3u:
+					pixels = CV::Segmentation::SeedSegmentation::iterativeScanlineSeedSegmentation8BitPerChannel<3u>(frame.constdata<uint8_t>(), mask.data<uint8_t>(), width, height, frame.paddingElements(), mask.paddingElements(), seed, localThreshold, minimalGlobalThreshold, maximalGlobalThreshold, maximalIncreaseFactor, &boundingBox, useWorkerPointer);
+					break;
+			}
+
+			OCEAN_EXPECT_EQUAL(validation, pixels, referencePixels);
+			OCEAN_EXPECT_TRUE(validation, boundingBox == referenceBoundingBox);
+
+			for (unsigned int y = 0u; y < height; ++y)
+			{
+				if (memcmp(mask.constrow<uint8_t>(y), referenceMask.constrow<uint8_t>(y), width) != 0)
+				{
+					OCEAN_SET_FAILED(validation);
+					break;
+				}
+			}
+		}
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
+Frame TestSeedSegmentation::createFrame(const unsigned int width, const unsigned int height, const unsigned int channels, RandomGenerator& randomGenerator)
+{
+	ocean_assert(width >= 1u && height >= 1u);
+	ocean_assert(channels >= 1u && channels <= 4u);
+
+	const unsigned int paddingElements = RandomI::random(randomGenerator, 1u, 100u) * RandomI::random(randomGenerator, 1u);
+
+	Frame frame(FrameType(width, height, FrameType::genericPixelFormat<uint8_t>(channels), FrameType::ORIGIN_UPPER_LEFT), paddingElements);
+
+	// the frame is composed of cells with a few different colors so that neighboring cells are often similar
+
+	const unsigned int cellSize = RandomI::random(randomGenerator, 2u, 64u);
+
+	const unsigned int horizontalCells = (width + cellSize - 1u) / cellSize;
+	const unsigned int verticalCells = (height + cellSize - 1u) / cellSize;
+
+	std::vector<uint8_t> cellColors(horizontalCells * verticalCells * channels);
+
+	for (uint8_t& cellColor : cellColors)
+	{
+		cellColor = uint8_t(60u + RandomI::random(randomGenerator, 3u) * 40u);
+	}
+
+	const int noise = int(RandomI::random(randomGenerator, 0u, 8u));
+
+	for (unsigned int y = 0u; y < height; ++y)
+	{
+		uint8_t* const row = frame.row<uint8_t>(y);
+
+		for (unsigned int x = 0u; x < width; ++x)
+		{
+			const uint8_t* const cellColor = cellColors.data() + ((y / cellSize) * horizontalCells + x / cellSize) * channels;
+
+			for (unsigned int n = 0u; n < channels; ++n)
+			{
+				row[x * channels + n] = uint8_t(int(cellColor[n]) + RandomI::random(randomGenerator, -noise, noise));
+			}
+		}
+	}
+
+	return frame;
+}
+
+} // namespace TestSegmentation
+
+} // namespace TestCV
+
+} // namespace Test
+
+} // namespace Ocean
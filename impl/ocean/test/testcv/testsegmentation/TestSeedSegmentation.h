@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#ifndef META_OCEAN_TEST_TESTCV_TESTSEGMENTATION_TEST_SEED_SEGMENTATION_H
+#define META_OCEAN_TEST_TESTCV_TESTSEGMENTATION_TEST_SEED_SEGMENTATION_H
+
+#include "ocean/test/testcv/testsegmentation/TestCVSegmentation.h"
+
+#include "ocean/test/TestSelector.h"
+
+#include "ocean/base/Frame.h"
+#include "ocean/base/RandomGenerator.h"
+#include "ocean/base/Worker.h"
+
+namespace Ocean
+{
+
+namespace Test
+{
+
+namespace TestCV
+{
+
+namespace TestSegmentation
+{
+
+/**
+ * This class implements tests for the seed segmentation.
+ * @ingroup testcvsegmentation
+ */
+class OCEAN_TEST_CV_SEGMENTATION_EXPORT TestSeedSegmentation
+{
+	public:
+
+		/**
+		 * Tests all seed segmentation functions.
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @param worker The worker object to distribute the computational load
+		 * @param selector The test selector
+		 * @return True, if succeeded
+		 */
+		static bool test(const double testDuration, Worker& worker, const TestSelector& selector);
+
+		/**
+		 * Tests the scanline seed segmentation, the result is compared with the pixel-wise seed segmentation.
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @param worker The worker object to distribute the computational load
+		 * @return True, if succeeded
+		 */
+		static bool testScanlineSeedSegmentation(const double testDuration, Worker& worker);
+
+		/**
+		 * Tests the iterative scanline seed segmentation, the result is compared with a sequence of pixel-wise seed segmentations.
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @param worker The worker object to distribute the computational load
+		 * @return True, if succeeded
+		 */
+		static bool testIterativeScanlineSeedSegmentation(const double testDuration, Worker& worker);
+
+	protected:
+
+		/**
+		 * Creates a random frame with 8 bit per channel composed of several constant areas with additional noise, so that the segmentation results in regions of various size.
+		 * @param width The width of the frame in pixel, with range [1, infinity)
+		 * @param height The height of the frame in pixel, with range [1, infinity)
+		 * @param channels The number of channels, with range [1, 4]
+		 * @param randomGenerator The random generator to be used
+		 * @return The resulting frame
+		 */
+		static Frame createFrame(const unsigned int width, const unsigned int height, const unsigned int channels, RandomGenerator& randomGenerator);
+};
+
+} // namespace TestSegmentation
+
+} // namespace TestCV
+
+} // namespace Test
+
+} // namespace Ocean
+
+#endif // META_OCEAN_TEST_TESTCV_TESTSEGMENTATION_TEST_SEED_SEGMENTATION_H
@@ -27,6 +27,7 @@
 #include "ocean/cv/synthesis/InitializerCoarserMappingAdaptionI1.h"
 #include "ocean/cv/synthesis/InitializerCoarserMappingAdaptionAreaConstrainedI1.h"
 #include "ocean/cv/synthesis/InitializerCoarserMappingAdaptionSpatialCostMaskI1.h"
+#include "ocean/cv/synthesis/InitializerHomographyMappingAdaptionCostMaskI1.h"
 #include "ocean/cv/synthesis/InitializerRandomMappingAreaConstrainedI1.h"
 #include "ocean/cv/synthesis/InitializerRandomMappingI1.h"
 #include "ocean/cv/synthesis/InitializerShrinkingErosionI1.h"
@@ -276,6 +277,15 @@ bool TestInitializerI1::test(const unsigned int width, const unsigned int height
 		Log::info() << " ";
 	}
 
+	if (selector.shouldRun("homographymappingadaptioncostmask"))
+	{
+		testResult = testHomographyMappingAdaptionCostMask(width, height, testDuration, worker);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
 	if (selector.shouldRun("randommapping"))
 	{
 		testResult = testRandomMapping(testDuration, worker);
@@ -451,6 +461,31 @@ TEST(TestInitializerI1, CoarserMappingAdaptionSpatialCostMask_4Channels)
 }
 
 
+TEST(TestInitializerI1, HomographyMappingAdaptionCostMask_1Channel)
+{
+	Worker worker;
+	EXPECT_TRUE(TestInitializerI1::testHomographyMappingAdaptionCostMask(GTEST_TEST_IMAGE_WIDTH, GTEST_TEST_IMAGE_HEIGHT, 1u, GTEST_TEST_DURATION, worker));
+}
+
+TEST(TestInitializerI1, HomographyMappingAdaptionCostMask_2Channels)
+{
+	Worker worker;
+	EXPECT_TRUE(TestInitializerI1::testHomographyMappingAdaptionCostMask(GTEST_TEST_IMAGE_WIDTH, GTEST_TEST_IMAGE_HEIGHT, 2u, GTEST_TEST_DURATION, worker));
+}
+
+TEST(TestInitializerI1, HomographyMappingAdaptionCostMask_3Channels)
+{
+	Worker worker;
+	EXPECT_TRUE(TestInitializerI1::testHomographyMappingAdaptionCostMask(GTEST_TEST_IMAGE_WIDTH, GTEST_TEST_IMAGE_HEIGHT, 3u, GTEST_TEST_DURATION, worker));
+}
+
+TEST(TestInitializerI1, HomographyMappingAdaptionCostMask_4Channels)
+{
+	Worker worker;
+	EXPECT_TRUE(TestInitializerI1::testHomographyMappingAdaptionCostMask(GTEST_TEST_IMAGE_WIDTH, GTEST_TEST_IMAGE_HEIGHT, 4u, GTEST_TEST_DURATION, worker));
+}
+
+
 TEST(TestInitializerI1, RandomMapping)
 {
 	Worker worker;
@@ -1646,6 +1681,262 @@ bool TestInitializerI1::testCoarserMappingAdaptionSpatialCostMask(const unsigned
 	return validation.succeeded();
 }
 
+bool TestInitializerI1::testHomographyMappingAdaptionCostMask(const unsigned int width, const unsigned int height, const double testDuration, Worker& worker)
+{
+	ocean_assert(width >= 1u && height >= 1u);
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Testing cost mask homography mapping adaption for " << width << "x" << height << ":";
+
+	bool allSucceeded = true;
+
+	for (const unsigned int channels : {1u, 2u, 3u, 4u})
+	{
+		Log::info() << " ";
+
+		if (!testHomographyMappingAdaptionCostMask(width, height, channels, testDuration, worker))
+		{
+			allSucceeded = false;
+		}
+	}
+
+	Log::info() << " ";
+
+	if (allSucceeded)
+	{
+		Log::info() << "Cost mask homography mapping adaption test succeeded.";
+	}
+	else
+	{
+		Log::info() << "Cost mask homography mapping adaption test FAILED!";
+	}
+
+	return allSucceeded;
+}
+
+bool TestInitializerI1::testHomographyMappingAdaptionCostMask(const unsigned int width, const unsigned int height, const unsigned int channels, const double testDuration, Worker& worker)
+{
+	ocean_assert(width >= 1u && height >= 1u);
+	ocean_assert(channels >= 1u && channels <= 4u);
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "... for " << channels << " channels:";
+
+	constexpr unsigned int borderFactor = 25u;
+	constexpr unsigned int costTolerance = 25u;
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	HighPerformanceStatistic performanceSinglecore;
+	HighPerformanceStatistic performanceMulticore;
+
+	const unsigned int maxWorkerIterations = worker ? 2u : 1u;
+
+	for (unsigned int workerIteration = 0u; workerIteration < maxWorkerIterations; ++workerIteration)
+	{
+		Worker* useWorker = (workerIteration == 0u) ? nullptr : &worker;
+		HighPerformanceStatistic& performance = useWorker ? performanceMulticore : performanceSinglecore;
+
+		const Timestamp startTimestamp(true);
+
+		do
+		{
+			for (const bool performanceIteration : {true, false})
+			{
+				const unsigned int testWidth = performanceIteration ? width : RandomI::random(randomGenerator, 50u, width);
+				const unsigned int testHeight = performanceIteration ? height : RandomI::random(randomGenerator, 50u, height);
+
+				// the previous frame with a synthesized mask area
+
+				Frame previousFrame = CV::CVUtilities::randomizedFrame(FrameType(testWidth, testHeight, FrameType::genericPixelFormat<uint8_t>(channels), FrameType::ORIGIN_UPPER_LEFT), &randomGenerator);
+				Frame previousMask = Utilities::randomizedInpaintingMask(testWidth, testHeight, 0x00u, randomGenerator);
+
+				// mask pixels must not be located at the frame border
+
+				previousMask.subFrame(0u, 0u, testWidth, 2u).setValue(0xFFu);
+				previousMask.subFrame(0u, 0u, 2u, testHeight).setValue(0xFFu);
+				previousMask.subFrame(testWidth - 2u, 0u, 2u, testHeight).setValue(0xFFu);
+				previousMask.subFrame(0u, testHeight - 2u, testWidth, 2u).setValue(0xFFu);
+
+				CV::Synthesis::LayerI1 previousLayer(previousFrame, previousMask);
+				CV::Synthesis::MappingI1& previousMapping = previousLayer.mappingI1();
+
+				for (unsigned int y = 0u; y < testHeight; ++y)
+				{
+					for (unsigned int x = 0u; x < testWidth; ++x)
+					{
+						if (previousMask.constpixel<uint8_t>(x, y)[0] != 0xFFu)
+						{
+							unsigned int sourceX, sourceY;
+
+							do
+							{
+								sourceX = RandomI::random(randomGenerator, testWidth - 1u);
+								sourceY = RandomI::random(randomGenerator, testHeight - 1u);
+							}
+							while (previousMask.constpixel<uint8_t>(sourceX, sourceY)[0] != 0xFFu);
+
+							previousMapping.setPosition(x, y, CV::PixelPosition(sourceX, sourceY));
+						}
+					}
+				}
+
+				previousMapping.applyMapping(previousLayer.frame(), previousLayer.mask(), 0u, testWidth, 0u, testHeight);
+
+				// the current frame is a translated version of the previous frame, the homography maps current points to previous points
+
+				const int translationX = RandomI::random(randomGenerator, -5, 5);
+				const int translationY = RandomI::random(randomGenerator, -5, 5);
+
+				SquareMatrix3 homography(true);
+				homography(0, 2) = Scalar(translationX);
+				homography(1, 2) = Scalar(translationY);
+
+				Frame frame = CV::CVUtilities::randomizedFrame(previousFrame.frameType(), &randomGenerator);
+				Frame mask(previousMask.frameType());
+				mask.setValue(0xFFu);
+
+				for (unsigned int y = 0u; y < testHeight; ++y)
+				{
+					for (unsigned int x = 0u; x < testWidth; ++x)
+					{
+						const unsigned int previousX = (unsigned int)(int(x) + translationX);
+						const unsigned int previousY = (unsigned int)(int(y) + translationY);
+
+						if (previousX < testWidth && previousY < testHeight)
+						{
+							memcpy(frame.pixel<uint8_t>(x, y), previousLayer.frame().constpixel<uint8_t>(previousX, previousY), channels);
+
+							// mask pixels must not be located at the frame border
+
+							if (x >= 2u && y >= 2u && x + 2u < testWidth && y + 2u < testHeight)
+							{
+								mask.pixel<uint8_t>(x, y)[0] = previousMask.constpixel<uint8_t>(previousX, previousY)[0];
+							}
+						}
+					}
+				}
+
+				const Frame copyFrame(frame, Frame::ACM_COPY_KEEP_LAYOUT_COPY_PADDING_DATA);
+
+				CV::Synthesis::LayerI1 layer(frame, mask);
+				const CV::Synthesis::MappingI1& mapping = layer.mappingI1();
+
+				Frame costMask;
+
+				const unsigned int randomSeed = randomGenerator.seed();
+
+				performance.startIf(performanceIteration);
+					OCEAN_EXPECT_TRUE(validation, CV::Synthesis::InitializerHomographyMappingAdaptionCostMaskI1<borderFactor>(layer, randomGenerator, previousLayer, homography, costMask, nullptr, costTolerance).invoke(useWorker));
+				performance.stopIf(performanceIteration);
+
+				if (!CV::CVUtilities::isPaddingMemoryIdentical(layer.frame(), copyFrame))
+				{
+					ocean_assert(false && "Invalid padding memory!");
+					return false;
+				}
+
+				if (!costMask.isValid() || costMask.width() != testWidth || costMask.height() != testHeight)
+				{
+					ocean_assert(false && "This should never happen!");
+					return false;
+				}
+
+				RandomGenerator helperGenerator(randomSeed);
+				RandomGenerator localGenerator(helperGenerator);
+
+				for (unsigned int y = 0u; y < testHeight; ++y)
+				{
+					for (unsigned int x = 0u; x < testWidth; ++x)
+					{
+						const uint8_t costValue = costMask.constpixel<uint8_t>(x, y)[0];
+
+						if (mask.constpixel<uint8_t>(x, y)[0] == 0xFFu)
+						{
+							OCEAN_EXPECT_EQUAL(validation, costValue, uint8_t(0xFFu));
+							continue;
+						}
+
+						const CV::PixelPosition& position = mapping.position(x, y);
+
+						if (mask.constpixel<uint8_t>(position.x(), position.y())[0] != 0xFFu)
+						{
+							OCEAN_SET_FAILED(validation);
+							continue;
+						}
+
+						const unsigned int previousX = (unsigned int)(int(x) + translationX);
+						const unsigned int previousY = (unsigned int)(int(y) + translationY);
+
+						bool adapted = false;
+
+						if (previousX < testWidth && previousY < testHeight && previousMask.constpixel<uint8_t>(previousX, previousY)[0] != 0xFFu)
+						{
+							const CV::PixelPosition& previousPosition = previousMapping.position(previousX, previousY);
+
+							const unsigned int candidateX = (unsigned int)(int(previousPosition.x()) - translationX);
+							const unsigned int candidateY = (unsigned int)(int(previousPosition.y()) - translationY);
+
+							if (candidateX < testWidth && candidateY < testHeight && mask.constpixel<uint8_t>(candidateX, candidateY)[0] == 0xFFu)
+							{
+								OCEAN_EXPECT_EQUAL(validation, position, CV::PixelPosition(candidateX, candidateY));
+
+								adapted = true;
+
+								const unsigned int cost = appearanceCost5x5<borderFactor>(mapping, layer.frame(), mask, x, y, position);
+								const unsigned int previousCost = appearanceCost5x5<borderFactor>(previousMapping, previousLayer.frame(), previousMask, previousX, previousY, previousPosition);
+
+								const bool costGotWorse = uint64_t(cost) * 100ull > uint64_t(previousCost) * uint64_t(100u + costTolerance);
+
+								OCEAN_EXPECT_EQUAL(validation, costValue, costGotWorse ? uint8_t(0x00u) : uint8_t(0xFFu));
+							}
+						}
+
+						if (!adapted)
+						{
+							OCEAN_EXPECT_EQUAL(validation, costValue, uint8_t(0x00u));
+
+							if (useWorker == nullptr)
+							{
+								// the random mapping is deterministic for single-core execution only
+
+								while (true)
+								{
+									const unsigned int xCandidate = RandomI::random(localGenerator, testWidth - 1u);
+									const unsigned int yCandidate = RandomI::random(localGenerator, testHeight - 1u);
+
+									if (mask.constpixel<uint8_t>(xCandidate, yCandidate)[0] == 0xFFu)
+									{
+										OCEAN_EXPECT_EQUAL(validation, position, CV::PixelPosition(xCandidate, yCandidate));
+
+										break;
+									}
+								}
+							}
+						}
+					}
+				}
+			}
+		}
+		while (!startTimestamp.hasTimePassed(testDuration));
+	}
+
+	Log::info() << "Singlecore performance: Best: " << String::toAString(performanceSinglecore.bestMseconds(), 3u) << "ms, worst: " << String::toAString(performanceSinglecore.worstMseconds(), 3u) << "ms, average: " << String::toAString(performanceSinglecore.averageMseconds(), 3u) << "ms";
+
+	if (performanceMulticore.measurements() != 0u)
+	{
+		Log::info() << "Multicore performance: Best: " << String::toAString(performanceMulticore.bestMseconds(), 3u) << "ms, worst: " << String::toAString(performanceMulticore.worstMseconds(), 3u) << "ms, average: " << String::toAString(performanceMulticore.averageMseconds(), 3u) << "ms";
+		Log::info() << "Multicore boost: Best: " << String::toAString(performanceSinglecore.best() / performanceMulticore.best(), 2u) << "x, worst: " << String::toAString(performanceSinglecore.worst() / performanceMulticore.worst(), 2u) << "x, average: " << String::toAString(performanceSinglecore.average() / performanceMulticore.average(), 2u) << "x";
+	}
+
+	Log::info() << " ";
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
 bool TestInitializerI1::testRandomMapping(const double testDuration, Worker& worker)
 {
 	ocean_assert(testDuration > 0.0);
@@ -2629,6 +2920,33 @@ bool TestInitializerI1::allValueSame(const Frame& mask, const unsigned int x, co
 	return true;
 }
 
+template <unsigned int tBorderFactor>
+unsigned int TestInitializerI1::appearanceCost5x5(const CV::Synthesis::MappingI1& mapping, const Frame& frame, const Frame& mask, const unsigned int x, const unsigned int y, const CV::PixelPosition& source)
+{
+	ocean_assert(frame.isValid() && mask.isValid());
+
+	const uint8_t* const frameData = frame.constdata<uint8_t>();
+	const uint8_t* const maskData = mask.constdata<uint8_t>();
+
+	switch (frame.channels())
+	{
+		case 1u:
+			return mapping.appearanceCost5x5<1u, tBorderFactor>(x, y, source.x(), source.y(), frameData, maskData, frame.paddingElements(), mask.paddingElements());
+
+		case 2u:
+			return mapping.appearanceCost5x5<2u, tBorderFactor>(x, y, source.x(), source.y(), frameData, maskData, frame.paddingElements(), mask.paddingElements());
+
+		case 3u:
+			return mapping.appearanceCost5x5<3u, tBorderFactor>(x, y, source.x(), source.y(), frameData, maskData, frame.paddingElements(), mask.paddingElements());
+
+		case 4u:
+			return mapping.appearanceCost5x5<4u, tBorderFactor>(x, y, source.x(), source.y(), frameData, maskData, frame.paddingElements(), mask.paddingElements());
+	}
+
+	ocean_assert(false && "Invalid frame type!");
+	return (unsigned int)(-1);
+}
+
 }
 
 }
@@ -216,6 +216,27 @@ class OCEAN_TEST_CV_SYNTHESIS_EXPORT TestInitializerI1
 		 */
 		static bool testCoarserMappingAdaptionSpatialCostMask(const unsigned int width, const unsigned int height, const unsigned int channels, const double testDuration, Worker& worker);
 
+		/**
+		 * Tests the cost mask homography mapping adaption initializer.
+		 * @param width The width of the source frame in pixel, with range [1, infinity)
+		 * @param height The height of the source frame in pixel, with range [1, infinity)
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @param worker The worker object to distribute the CPU load
+		 * @return True, if succeeded
+		 */
+		static bool testHomographyMappingAdaptionCostMask(const unsigned int width, const unsigned int height, const double testDuration, Worker& worker);
+
+		/**
+		 * Tests the cost mask homography mapping adaption initializer.
+		 * @param width The width of the source frame in pixel, with range [1, infinity)
+		 * @param height The height of the source frame in pixel, with range [1, infinity)
+		 * @param channels The number of frame channels which will be used during the test, with range [1, 4]
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @param worker The worker object to distribute the CPU load
+		 * @return True, if succeeded
+		 */
+		static bool testHomographyMappingAdaptionCostMask(const unsigned int width, const unsigned int height, const unsigned int channels, const double testDuration, Worker& worker);
+
 		/**
 		 * Tests the random mapping initializer.
 		 * @param testDuration Number of seconds for each test, with range (0, infinity)
@@ -331,6 +352,20 @@ class OCEAN_TEST_CV_SYNTHESIS_EXPORT TestInitializerI1
 		 * @return True, if so
 		 */
 		static bool allValueSame(const Frame& mask, const unsigned int x, const unsigned int y, const uint8_t value, const unsigned int neighborhood);
+
+		/**
+		 * Determines the 5x5 appearance cost of a mapping for a frame with arbitrary number of channels.
+		 * @param mapping The mapping to be used, must be valid
+		 * @param frame The frame to be used, with 1 to 4 channels, must be valid
+		 * @param mask The mask of the frame, must be valid
+		 * @param x The horizontal target location, must be a mask pixel, with range [0, frame.width() - 1]
+		 * @param y The vertical target location, must be a mask pixel, with range [0, frame.height() - 1]
+		 * @param source The source location, must not be a mask pixel
+		 * @return The appearance cost
+		 * @tparam tBorderFactor Weight factor of border pixels, with range [1, infinity)
+		 */
+		template <unsigned int tBorderFactor>
+		static unsigned int appearanceCost5x5(const CV::Synthesis::MappingI1& mapping, const Frame& frame, const Frame& mask, const unsigned int x, const unsigned int y, const CV::PixelPosition& source);
 };
 
 }
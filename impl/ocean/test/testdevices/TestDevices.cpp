@@ -7,6 +7,7 @@
 
 #include "ocean/test/testdevices/TestDevices.h"
 #include "ocean/test/testdevices/TestAccelerationSensor3DOF.h"
+#include "ocean/test/testdevices/TestFrameBudget.h"
 #include "ocean/test/testdevices/TestGPSTracker.h"
 #include "ocean/test/testdevices/TestGravityTracker3DOF.h"
 #include "ocean/test/testdevices/TestOrientationTracker3DOF.h"
@@ -84,6 +85,15 @@ bool testDevices(const double testDuration, Worker& /*worker*/, const std::strin
 		testResult = TestAccelerationSensor3DOF::test(testDuration, subSelector);
 	}
 
+	if (TestSelector subSelector = selector.shouldRun("framebudget"))
+	{
+		Log::info() << " ";
+		Log::info() << " ";
+		Log::info() << " ";
+		Log::info() << " ";
+		testResult = TestFrameBudget::test(testDuration, subSelector);
+	}
+
 	if (TestSelector subSelector = selector.shouldRun("gpstracker"))
 	{
 		Log::info() << " ";
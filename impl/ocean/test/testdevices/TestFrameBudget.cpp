@@ -0,0 +1,329 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "ocean/test/testdevices/TestFrameBudget.h"
+
+#include "ocean/test/TestResult.h"
+#include "ocean/test/Validation.h"
+
+#include "ocean/base/RandomI.h"
+#include "ocean/base/Timestamp.h"
+
+#include "ocean/devices/mapbuilding/FrameBudget.h"
+
+namespace Ocean
+{
+
+namespace Test
+{
+
+namespace TestDevices
+{
+
+bool TestFrameBudget::test(const double testDuration, const TestSelector& selector)
+{
+	ocean_assert(testDuration > 0.0);
+
+	TestResult testResult("FrameBudget test");
+	Log::info() << " ";
+
+	if (selector.shouldRun("balancecap"))
+	{
+		testResult = testBalanceCap(testDuration);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
+	if (selector.shouldRun("skipping"))
+	{
+		testResult = testSkipping(testDuration);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
+	if (selector.shouldRun("payback"))
+	{
+		testResult = testPayback(testDuration);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
+	Log::info() << testResult;
+
+	return testResult.succeeded();
+}
+
+#ifdef OCEAN_USE_GTEST
+
+TEST(TestFrameBudget, BalanceCap)
+{
+	EXPECT_TRUE(TestFrameBudget::testBalanceCap(GTEST_TEST_DURATION));
+}
+
+TEST(TestFrameBudget, Skipping)
+{
+	EXPECT_TRUE(TestFrameBudget::testSkipping(GTEST_TEST_DURATION));
+}
+
+TEST(TestFrameBudget, Payback)
+{
+	EXPECT_TRUE(TestFrameBudget::testPayback(GTEST_TEST_DURATION));
+}
+
+#endif
+
+bool TestFrameBudget::testBalanceCap(const double testDuration)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Testing balance cap:";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		{
+			// without budget, every frame is processed, regardless of the processing time
+
+			Devices::MapBuilding::FrameBudget frameBudget;
+
+			OCEAN_EXPECT_FALSE(validation, frameBudget.isBudgeted());
+
+			for (unsigned int n = 0u; n < 100u; ++n)
+			{
+				OCEAN_EXPECT_TRUE(validation, frameBudget.startFrame());
+
+				frameBudget.finishFrame(double(RandomI::random(randomGenerator, 1000u)) * 0.001);
+			}
+		}
+
+		const double budgetPerFrame = randomBudgetPerFrame(randomGenerator);
+
+		// the default cap is three frame budgets
+
+		Devices::MapBuilding::FrameBudget frameBudget(budgetPerFrame);
+
+		OCEAN_EXPECT_TRUE(validation, frameBudget.isBudgeted());
+		OCEAN_EXPECT_EQUAL(validation, frameBudget.budgetPerFrame(), budgetPerFrame);
+
+		const unsigned int cheapFrames = RandomI::random(randomGenerator, 1u, 50u);
+
+		for (unsigned int n = 0u; n < cheapFrames; ++n)
+		{
+			// frames which are cheaper than their budget are always processed
+
+			OCEAN_EXPECT_TRUE(validation, frameBudget.startFrame());
+
+			const double expectedBalance = std::min(double(n + 1u), 3.0) * budgetPerFrame;
+
+			OCEAN_EXPECT_LESS_EQUAL(validation, frameBudget.balance(), budgetPerFrame * 3.0);
+
+			// frames without processing time accumulate their budget until the cap is reached
+
+			OCEAN_EXPECT_EQUAL(validation, frameBudget.balance(), expectedBalance);
+
+			frameBudget.finishFrame(0.0);
+		}
+
+		for (unsigned int n = 0u; n < 50u; ++n)
+		{
+			OCEAN_EXPECT_TRUE(validation, frameBudget.startFrame());
+
+			OCEAN_EXPECT_LESS_EQUAL(validation, frameBudget.balance(), budgetPerFrame * 3.0);
+
+			// the processing time is a quarter multiple of the budget so that the arithmetic is exact
+
+			frameBudget.finishFrame(budgetPerFrame * double(RandomI::random(randomGenerator, 3u)) * 0.25);
+		}
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
+bool TestFrameBudget::testSkipping(const double testDuration)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Testing skipping of frames:";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		const double budgetPerFrame = randomBudgetPerFrame(randomGenerator);
+
+		Devices::MapBuilding::FrameBudget frameBudget(budgetPerFrame);
+
+		OCEAN_EXPECT_TRUE(validation, frameBudget.startFrame());
+
+		// the first frame needs an integer multiple of the budget, so that the balance of the following frames reaches exactly zero
+
+		const unsigned int expensiveBudgets = RandomI::random(randomGenerator, 2u, 10u);
+
+		frameBudget.finishFrame(budgetPerFrame * double(expensiveBudgets));
+
+		// the balance after adding the budget of the following frames is (2 - expensiveBudgets) * budgetPerFrame, ..., 0, budgetPerFrame
+
+		for (unsigned int n = 2u; n <= expensiveBudgets; ++n)
+		{
+			OCEAN_EXPECT_FALSE(validation, frameBudget.startFrame());
+
+			OCEAN_EXPECT_LESS_EQUAL(validation, frameBudget.balance(), 0.0);
+		}
+
+		OCEAN_EXPECT_EQUAL(validation, frameBudget.balance(), 0.0);
+
+		OCEAN_EXPECT_TRUE(validation, frameBudget.startFrame());
+		OCEAN_EXPECT_EQUAL(validation, frameBudget.balance(), budgetPerFrame);
+
+		// a random sequence of frames, each frame is processed if and only if the balance is positive
+
+		for (unsigned int n = 0u; n < 100u; ++n)
+		{
+			const double previousBalance = frameBudget.balance();
+
+			const bool processFrame = frameBudget.startFrame();
+
+			OCEAN_EXPECT_EQUAL(validation, processFrame, frameBudget.balance() > 0.0);
+			OCEAN_EXPECT_EQUAL(validation, frameBudget.balance(), std::min(previousBalance + budgetPerFrame, budgetPerFrame * 3.0));
+
+			if (processFrame)
+			{
+				frameBudget.finishFrame(budgetPerFrame * double(RandomI::random(randomGenerator, 16u)) * 0.25);
+			}
+		}
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
+bool TestFrameBudget::testPayback(const double testDuration)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Testing payback of expensive frames:";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		const double budgetPerFrame = randomBudgetPerFrame(randomGenerator);
+
+		{
+			Devices::MapBuilding::FrameBudget frameBudget(budgetPerFrame);
+
+			// accumulating between one and three budgets with frames without processing time (more frames do not accumulate more budget)
+
+			const unsigned int cheapFrames = RandomI::random(randomGenerator, 0u, 5u);
+
+			for (unsigned int n = 0u; n < cheapFrames; ++n)
+			{
+				OCEAN_EXPECT_TRUE(validation, frameBudget.startFrame());
+				frameBudget.finishFrame(0.0);
+			}
+
+			OCEAN_EXPECT_TRUE(validation, frameBudget.startFrame());
+
+			const unsigned int accumulatedBudgets = std::min(cheapFrames + 1u, 3u);
+			OCEAN_EXPECT_EQUAL(validation, frameBudget.balance(), budgetPerFrame * double(accumulatedBudgets));
+
+			// the expensive frame needs (expensiveBudgets + 0.5) budgets, the balance is (accumulatedBudgets - expensiveBudgets - 0.5) * budgetPerFrame afterwards
+
+			const unsigned int expensiveBudgets = RandomI::random(randomGenerator, 0u, 20u);
+
+			frameBudget.finishFrame(budgetPerFrame * (double(expensiveBudgets) + 0.5));
+
+			const unsigned int expectedSkippedFrames = expensiveBudgets > accumulatedBudgets ? expensiveBudgets - accumulatedBudgets : 0u;
+
+			unsigned int skippedFrames = 0u;
+
+			while (!frameBudget.startFrame())
+			{
+				++skippedFrames;
+
+				if (skippedFrames > expectedSkippedFrames)
+				{
+					break;
+				}
+			}
+
+			OCEAN_EXPECT_EQUAL(validation, skippedFrames, expectedSkippedFrames);
+
+			// the balance of the first processed frame is (accumulatedBudgets - expensiveBudgets + skippedFrames + 0.5) * budgetPerFrame, capped at three budgets
+
+			const double expectedBalance = std::min(double(accumulatedBudgets + skippedFrames) - double(expensiveBudgets) + 0.5, 3.0) * budgetPerFrame;
+
+			OCEAN_EXPECT_EQUAL(validation, frameBudget.balance(), expectedBalance);
+		}
+
+		{
+			// over a random sequence of frames, the overall processing time exceeds the overall budget by at most the most expensive frame
+
+			Devices::MapBuilding::FrameBudget frameBudget(budgetPerFrame);
+
+			double overallBudget = 0.0;
+			double overallProcessing = 0.0;
+			double maximalProcessing = 0.0;
+
+			const unsigned int frames = RandomI::random(randomGenerator, 1u, 1000u);
+
+			for (unsigned int n = 0u; n < frames; ++n)
+			{
+				overallBudget += budgetPerFrame;
+
+				if (frameBudget.startFrame())
+				{
+					const double processing = budgetPerFrame * double(RandomI::random(randomGenerator, 40u)) * 0.125;
+
+					frameBudget.finishFrame(processing);
+
+					overallProcessing += processing;
+					maximalProcessing = std::max(maximalProcessing, processing);
+				}
+			}
+
+			OCEAN_EXPECT_LESS_EQUAL(validation, overallProcessing, overallBudget + maximalProcessing);
+		}
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
+double TestFrameBudget::randomBudgetPerFrame(RandomGenerator& randomGenerator)
+{
+	return double(RandomI::random(randomGenerator, 1u, 100u)) / 1024.0;
+}
+
+} // namespace TestDevices
+
+} // namespace Test
+
+} // namespace Ocean
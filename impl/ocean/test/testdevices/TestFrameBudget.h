@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#ifndef META_OCEAN_TEST_TESTDEVICES_TEST_FRAME_BUDGET_H
+#define META_OCEAN_TEST_TESTDEVICES_TEST_FRAME_BUDGET_H
+
+#include "ocean/test/testdevices/TestDevices.h"
+
+#include "ocean/base/RandomGenerator.h"
+
+#include "ocean/test/TestSelector.h"
+
+namespace Ocean
+{
+
+namespace Test
+{
+
+namespace TestDevices
+{
+
+/**
+ * This class implements tests for the FrameBudget class of the MapBuilding devices library.
+ * @ingroup testdevices
+ */
+class OCEAN_TEST_DEVICES_EXPORT TestFrameBudget
+{
+	public:
+
+		/**
+		 * Invokes all tests.
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @param selector The selector defining which tests will be executed
+		 * @return True, if succeeded
+		 */
+		static bool test(const double testDuration, const TestSelector& selector);
+
+		/**
+		 * Tests that the balance never exceeds three frame budgets while frames are cheaper than their budget.
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @return True, if succeeded
+		 */
+		static bool testBalanceCap(const double testDuration);
+
+		/**
+		 * Tests that frames are skipped as long as the balance is not positive.
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @return True, if succeeded
+		 */
+		static bool testSkipping(const double testDuration);
+
+		/**
+		 * Tests that an expensive frame is paid back by skipping the following frames.
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @return True, if succeeded
+		 */
+		static bool testPayback(const double testDuration);
+
+	protected:
+
+		/**
+		 * Returns a random budget for each frame.
+		 * The budget is a multiple of 1/1024 seconds so that the arithmetic of the balance is exact.
+		 * @param randomGenerator The random generator to be used
+		 * @return The random budget, in seconds, with range (0, 0.1)
+		 */
+		static double randomBudgetPerFrame(RandomGenerator& randomGenerator);
+};
+
+} // namespace TestDevices
+
+} // namespace Test
+
+} // namespace Ocean
+
+#endif // META_OCEAN_TEST_TESTDEVICES_TEST_FRAME_BUDGET_H
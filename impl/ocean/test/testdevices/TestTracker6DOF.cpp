@@ -10,10 +10,14 @@
 #include "ocean/test/TestResult.h"
 #include "ocean/test/Validation.h"
 
+#include "ocean/devices/GyroSensor3DOF.h"
 #include "ocean/devices/Tracker6DOF.h"
 
 #include "ocean/math/Random.h"
 
+#include <atomic>
+#include <thread>
+
 namespace Ocean
 {
 
@@ -78,6 +82,85 @@ class TestableTracker6DOF : public Devices::Tracker6DOF
 		}
 };
 
+/**
+ * This class implements a test gyro sensor for testing predictions.
+ */
+class TestableGyroSensor3DOF : public Devices::GyroSensor3DOF
+{
+	public:
+
+		/**
+		 * Creates a new test gyro sensor.
+		 * @param name The name of the sensor
+		 */
+		explicit TestableGyroSensor3DOF(const std::string& name) :
+			Devices::Device(name, deviceTypeGyroSensor3DOF(SENSOR_GYRO_UNBIASED_3DOF)),
+			Devices::Measurement(name, deviceTypeGyroSensor3DOF(SENSOR_GYRO_UNBIASED_3DOF)),
+			Devices::Sensor(name, deviceTypeGyroSensor3DOF(SENSOR_GYRO_UNBIASED_3DOF)),
+			Devices::GyroSensor3DOF(name, SENSOR_GYRO_UNBIASED_3DOF)
+		{
+			// nothing to do here
+		}
+
+		/**
+		 * Returns the name of the owner library.
+		 * @return The library name
+		 */
+		const std::string& library() const override
+		{
+			static const std::string libraryName("TestLibrary");
+			return libraryName;
+		}
+
+		/**
+		 * Adds a new sample to the sensor.
+		 * @param timestamp The timestamp of the sample
+		 * @param angularVelocity The angular velocity of the device in the coordinate system of the device, in [rad / s]
+		 */
+		void addSample(const Timestamp& timestamp, const Vector3& angularVelocity)
+		{
+			postNewSample(SampleRef(new Gyro3DOFSample(timestamp, ObjectIds(1, ObjectId(0)), Gyro3DOFSample::Measurements(1, angularVelocity))));
+		}
+};
+
+/**
+ * This class counts sample events and checks that the events arrive in chronological order.
+ */
+class SampleEventCounter
+{
+	public:
+
+		/**
+		 * Event function for new samples.
+		 * @param measurement The measurement sending the sample
+		 * @param sample The new sample
+		 */
+		void onSample(const Devices::Measurement* measurement, const Devices::Measurement::SampleRef& sample)
+		{
+			if (measurement == nullptr || !sample || (previousTimestamp_.isValid() && sample->timestamp() <= previousTimestamp_))
+			{
+				isValid_ = false;
+			}
+
+			previousTimestamp_ = sample ? sample->timestamp() : Timestamp(false);
+
+			++numberEvents_;
+		}
+
+	public:
+
+		/// The number of received events.
+		std::atomic<unsigned int> numberEvents_ = 0u;
+
+		/// True, if all events were valid.
+		std::atomic<bool> isValid_ = true;
+
+	protected:
+
+		/// The timestamp of the previous sample.
+		Timestamp previousTimestamp_ = Timestamp(false);
+};
+
 bool TestTracker6DOF::test(const double testDuration, const TestSelector& selector)
 {
 	ocean_assert(testDuration > 0.0);
@@ -94,6 +177,24 @@ bool TestTracker6DOF::test(const double testDuration, const TestSelector& select
 		Log::info() << " ";
 	}
 
+	if (selector.shouldRun("concurrentsamples"))
+	{
+		testResult = testConcurrentSamples(testDuration);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
+	if (selector.shouldRun("sampleprediction"))
+	{
+		testResult = testSamplePrediction(testDuration);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
 	Log::info() << testResult;
 
 	return testResult.succeeded();
@@ -106,6 +207,16 @@ TEST(TestTracker6DOF, SampleInterpolation)
 	EXPECT_TRUE(TestTracker6DOF::testSampleInterpolation(GTEST_TEST_DURATION));
 }
 
+TEST(TestTracker6DOF, ConcurrentSamples)
+{
+	EXPECT_TRUE(TestTracker6DOF::testConcurrentSamples(GTEST_TEST_DURATION));
+}
+
+TEST(TestTracker6DOF, SamplePrediction)
+{
+	EXPECT_TRUE(TestTracker6DOF::testSamplePrediction(GTEST_TEST_DURATION));
+}
+
 #endif
 
 bool TestTracker6DOF::testSampleInterpolation(const double testDuration)
@@ -283,6 +394,297 @@ bool TestTracker6DOF::testSampleInterpolation(const double testDuration)
 	return validation.succeeded();
 }
 
+bool TestTracker6DOF::testConcurrentSamples(const double testDuration)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Testing concurrent sample access and sample events:";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	// the sample with index k has timestamp 'baseTime + k * timeInterval' and position (k, 0, 0)
+
+	constexpr double baseTime = 1000.0;
+	constexpr double timeInterval = 0.001;
+
+	constexpr unsigned int numberReaders = 2u;
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		const std::string trackerName = "Test 6DOF Tracker " + String::toAString(RandomI::random32(randomGenerator));
+
+		Devices::SmartDeviceRef<TestableTracker6DOF> tracker(Devices::DeviceRefManager::get().registerDevice(new TestableTracker6DOF(trackerName), false));
+		ocean_assert(tracker);
+
+		const bool asynchronousEvents = RandomI::random(randomGenerator, 1u) == 0u;
+
+		if (asynchronousEvents)
+		{
+			OCEAN_EXPECT_TRUE(validation, tracker->setAsynchronousSampleEvents(true, size_t(RandomI::random(randomGenerator, 1u, 32u))));
+		}
+
+		SampleEventCounter sampleEventCounter;
+
+		Devices::Measurement::SampleEventSubscription subscription = tracker->subscribeSampleEvent(Devices::Measurement::SampleCallback::create(sampleEventCounter, &SampleEventCounter::onSample));
+		subscription.makeWeak();
+
+		const unsigned int numberSamples = RandomI::random(randomGenerator, 100u, 2000u);
+
+		std::atomic<unsigned int> numberPostedSamples(0u);
+		std::atomic<bool> stopReaders(false);
+		std::atomic<bool> readersSucceeded(true);
+
+		std::vector<std::thread> readers;
+
+		for (unsigned int nReader = 0u; nReader < numberReaders; ++nReader)
+		{
+			const unsigned int readerSeed = RandomI::random32(randomGenerator);
+
+			readers.emplace_back([&tracker, &numberPostedSamples, &stopReaders, &readersSucceeded, readerSeed, baseTime, timeInterval]()
+			{
+				RandomGenerator readerRandomGenerator(readerSeed);
+
+				while (!stopReaders.load())
+				{
+					const unsigned int postedSamples = numberPostedSamples.load();
+
+					if (postedSamples == 0u)
+					{
+						std::this_thread::yield();
+						continue;
+					}
+
+					const unsigned int queryIndex = RandomI::random(readerRandomGenerator, postedSamples - 1u);
+					const Timestamp queryTimestamp(baseTime + double(queryIndex) * timeInterval);
+
+					Devices::Measurement::SampleRef sample;
+
+					switch (RandomI::random(readerRandomGenerator, 2u))
+					{
+						case 0u:
+							sample = tracker->sample();
+							break;
+
+						case 1u:
+							sample = tracker->sample(queryTimestamp);
+							break;
+
+						default:
+							sample = tracker->sample(queryTimestamp, Devices::Measurement::IS_TIMESTAMP_NEAREST);
+							break;
+					}
+
+					const Devices::Tracker6DOF::Tracker6DOFSampleRef tracker6DOFSample(sample);
+
+					if (!tracker6DOFSample || tracker6DOFSample->positions().size() != 1)
+					{
+						readersSucceeded = false;
+						continue;
+					}
+
+					// the timestamp and the position of the sample must belong to each other
+
+					const unsigned int sampleIndex = (unsigned int)(Numeric::round32(tracker6DOFSample->positions().front().x()));
+
+					if (sampleIndex > numberPostedSamples.load() || double(tracker6DOFSample->timestamp()) != baseTime + double(sampleIndex) * timeInterval)
+					{
+						readersSucceeded = false;
+					}
+				}
+			});
+		}
+
+		size_t capacity = tracker->sampleCapacity();
+		size_t numberStoredSamples = 0;
+
+		for (unsigned int nSample = 0u; nSample < numberSamples; ++nSample)
+		{
+			if (RandomI::random(randomGenerator, 200u) == 0u)
+			{
+				capacity = size_t(RandomI::random(randomGenerator, 2u, 300u));
+				OCEAN_EXPECT_TRUE(validation, tracker->setSampleCapacity(capacity));
+
+				numberStoredSamples = std::min(numberStoredSamples, capacity);
+			}
+
+			const Vector3 position(Scalar(nSample), 0, 0);
+
+			tracker->addSample(Timestamp(baseTime + double(nSample) * timeInterval), Devices::Tracker6DOF::Tracker6DOFSample::Orientations(1, Quaternion(true)), Devices::Tracker6DOF::Tracker6DOFSample::Positions(1, position));
+
+			numberPostedSamples = nSample + 1u;
+			numberStoredSamples = std::min(numberStoredSamples + 1, capacity);
+		}
+
+		stopReaders = true;
+
+		for (std::thread& reader : readers)
+		{
+			reader.join();
+		}
+
+		OCEAN_EXPECT_TRUE(validation, readersSucceeded.load());
+
+		// the history must hold the most recent samples
+
+		for (const unsigned int sampleIndex : {numberSamples - 1u, numberSamples - (unsigned int)(numberStoredSamples)})
+		{
+			const Timestamp timestamp(baseTime + double(sampleIndex) * timeInterval);
+
+			const Devices::Measurement::SampleRef sample = tracker->sample(timestamp);
+
+			if (sample)
+			{
+				OCEAN_EXPECT_EQUAL(validation, sample->timestamp(), timestamp);
+			}
+			else
+			{
+				OCEAN_SET_FAILED(validation);
+			}
+		}
+
+		if (asynchronousEvents)
+		{
+			// disabling the asynchronous events dispatches all waiting samples
+
+			OCEAN_EXPECT_TRUE(validation, tracker->setAsynchronousSampleEvents(false));
+		}
+
+		OCEAN_EXPECT_TRUE(validation, sampleEventCounter.isValid_.load());
+		OCEAN_EXPECT_EQUAL(validation, uint64_t(sampleEventCounter.numberEvents_.load()) + tracker->droppedSampleEvents(), uint64_t(numberSamples));
+
+		if (!asynchronousEvents)
+		{
+			OCEAN_EXPECT_EQUAL(validation, tracker->droppedSampleEvents(), uint64_t(0u));
+		}
+
+		subscription.release();
+		tracker.release();
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
+bool TestTracker6DOF::testSamplePrediction(const double testDuration)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Testing predictedSample() function:";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	constexpr double maximalPredictionInterval = 0.1;
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		TestableTracker6DOF tracker("Test 6DOF Tracker");
+
+		const Devices::Tracker::ReferenceSystem referenceSystem = RandomI::random(randomGenerator, 1u) == 0u ? Devices::Tracker::RS_DEVICE_IN_OBJECT : Devices::Tracker::RS_OBJECT_IN_DEVICE;
+
+		// the device moves with constant linear velocity and rotates with constant angular velocity in the coordinate system of the device
+
+		const Quaternion firstOrientation = Random::quaternion(randomGenerator);
+		const Vector3 firstPosition = Random::vector3(randomGenerator, Scalar(-10), Scalar(10));
+
+		const Vector3 linearVelocity = Random::vector3(randomGenerator, Scalar(-2), Scalar(2));
+
+		const Vector3 rotationAxis = Random::vector3(randomGenerator);
+		const Scalar angularSpeed = Random::scalar(randomGenerator, Scalar(0.1), Scalar(3));
+
+		const bool useGyro = RandomI::random(randomGenerator, 1u) == 0u;
+
+		const auto orientationAt = [&](const double interval, const bool rotating)
+		{
+			const Quaternion device_Q_rotatedDevice(rotationAxis, rotating ? angularSpeed * Scalar(interval) : Scalar(0));
+
+			return referenceSystem == Devices::Tracker::RS_DEVICE_IN_OBJECT ? firstOrientation * device_Q_rotatedDevice : device_Q_rotatedDevice.inverted() * firstOrientation;
+		};
+
+		const double firstTime = RandomD::scalar(randomGenerator, 1000.0, 2000.0);
+		const double sampleInterval = RandomD::scalar(randomGenerator, 0.005, 0.05);
+
+		// with gyro measurements, the samples do not rotate so that the prediction must use the gyro's angular velocity
+
+		tracker.addSample(Timestamp(firstTime), Devices::Tracker6DOF::Tracker6DOFSample::Orientations(1, orientationAt(0.0, !useGyro)), Devices::Tracker6DOF::Tracker6DOFSample::Positions(1, firstPosition), referenceSystem);
+
+		Devices::SmartDeviceRef<TestableGyroSensor3DOF> gyroSensor;
+
+		if (useGyro)
+		{
+			gyroSensor = Devices::DeviceRefManager::get().registerDevice(new TestableGyroSensor3DOF("Test Gyro Sensor " + String::toAString(RandomI::random32(randomGenerator))), false);
+			ocean_assert(gyroSensor);
+
+			gyroSensor->addSample(Timestamp(firstTime + sampleInterval), rotationAxis * angularSpeed);
+		}
+
+		{
+			// with one sample, the prediction is the most recent pose
+
+			const Devices::Tracker6DOF::Tracker6DOFSampleRef predictedSample(tracker.predictedSample(Timestamp(firstTime + 0.01)));
+
+			if (predictedSample && predictedSample->positions().size() == 1)
+			{
+				OCEAN_EXPECT_EQUAL(validation, predictedSample->timestamp(), Timestamp(firstTime + 0.01));
+				OCEAN_EXPECT_TRUE(validation, predictedSample->positions().front().isEqual(firstPosition, Scalar(0.0001)));
+				OCEAN_EXPECT_LESS_EQUAL(validation, predictedSample->orientations().front().angle(orientationAt(0.0, !useGyro)), Numeric::deg2rad(Scalar(0.1)));
+			}
+			else
+			{
+				OCEAN_SET_FAILED(validation);
+			}
+		}
+
+		const double latestTime = firstTime + sampleInterval;
+
+		tracker.addSample(Timestamp(latestTime), Devices::Tracker6DOF::Tracker6DOFSample::Orientations(1, orientationAt(sampleInterval, !useGyro)), Devices::Tracker6DOF::Tracker6DOFSample::Positions(1, firstPosition + linearVelocity * Scalar(sampleInterval)), referenceSystem);
+
+		for (unsigned int n = 0u; n < 10u; ++n)
+		{
+			// the interval may exceed the maximal prediction interval, and may query an existing sample
+
+			const double predictionInterval = n == 0u ? 0.0 : RandomD::scalar(randomGenerator, 0.001, maximalPredictionInterval * 2.0);
+			const double clampedPredictionInterval = std::min(predictionInterval, maximalPredictionInterval);
+
+			const Timestamp predictionTimestamp(latestTime + predictionInterval);
+
+			const Devices::Tracker6DOF::Tracker6DOFSampleRef predictedSample(tracker.predictedSample(predictionTimestamp, Devices::GyroSensor3DOFRef(gyroSensor), maximalPredictionInterval));
+
+			if (!predictedSample || predictedSample->positions().size() != 1 || predictedSample->orientations().size() != 1)
+			{
+				OCEAN_SET_FAILED(validation);
+				continue;
+			}
+
+			OCEAN_EXPECT_EQUAL(validation, predictedSample->timestamp(), predictionTimestamp);
+			OCEAN_EXPECT_EQUAL(validation, predictedSample->referenceSystem(), referenceSystem);
+
+			const Vector3 expectedPosition = firstPosition + linearVelocity * Scalar(sampleInterval + clampedPredictionInterval);
+
+			// the samples of the tracker do not rotate if the gyro is used, so that the gyro's rotation is applied to the first orientation
+
+			const Quaternion expectedOrientation = orientationAt(useGyro ? clampedPredictionInterval : sampleInterval + clampedPredictionInterval, true);
+
+			OCEAN_EXPECT_LESS_EQUAL(validation, (predictedSample->positions().front() - expectedPosition).length(), Scalar(0.001));
+			OCEAN_EXPECT_LESS_EQUAL(validation, predictedSample->orientations().front().angle(expectedOrientation), Numeric::deg2rad(Scalar(0.1)));
+		}
+
+		gyroSensor.release();
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
 Quaternion TestTracker6DOF::expectedInterpolatedOrientation(const double queryTime, const Timestamps& timestamps, const Quaternions& orientations)
 {
 	ocean_assert(timestamps.size() == orientations.size());
@@ -49,6 +49,20 @@ class OCEAN_TEST_DEVICES_EXPORT TestTracker6DOF
 		 */
 		static bool testSampleInterpolation(const double testDuration);
 
+		/**
+		 * Tests reading samples concurrently to posting new samples, with synchronous and asynchronous sample events.
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @return True, if succeeded
+		 */
+		static bool testConcurrentSamples(const double testDuration);
+
+		/**
+		 * Tests the predictedSample() function with constant velocities, with and without gyro measurements.
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @return True, if succeeded
+		 */
+		static bool testSamplePrediction(const double testDuration);
+
 	protected:
 
 		/**
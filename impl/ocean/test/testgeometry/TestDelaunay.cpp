@@ -40,6 +40,17 @@ bool TestDelaunay::test(const double testDuration, const TestSelector& selector)
 	if (selector.shouldRun("triangulation"))
 	{
 		testResult = testTriangulation(testDuration);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
+	if (selector.shouldRun("incrementaltriangulation"))
+	{
+		testResult = testIncrementalTriangulation(testDuration);
+
+		Log::info() << " ";
 	}
 
 	Log::info() << testResult;
@@ -88,6 +99,11 @@ TEST(TestDelaunay, Triangulation_2000)
 
 #endif
 
+TEST(TestDelaunay, IncrementalTriangulation)
+{
+	EXPECT_TRUE(TestDelaunay::testIncrementalTriangulation(GTEST_TEST_DURATION));
+}
+
 #endif // OCEAN_USE_GTEST
 
 bool TestDelaunay::testTriangulation(const double testDuration)
@@ -172,6 +188,191 @@ bool TestDelaunay::testTriangulation(const unsigned int pointNumber, const doubl
 	return validation.succeeded();
 }
 
+bool TestDelaunay::testIncrementalTriangulation(const double testDuration)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Incremental triangulation test:";
+
+	constexpr Scalar range = std::is_same<float, Scalar>::value ? Scalar(10) : Scalar(1000);
+
+	constexpr double threshold = std::is_same<float, Scalar>::value ? 0.95 : 0.99;
+
+	RandomGenerator randomGenerator;
+	ValidationPrecision validation(threshold, randomGenerator);
+
+	HighPerformanceStatistic performanceBatch;
+	HighPerformanceStatistic performanceIncremental;
+	HighPerformanceStatistic performanceUpdate;
+
+	constexpr Scalar areaSize = range * Scalar(2);
+	constexpr unsigned int bins = (unsigned int)(range * 10);
+
+	Geometry::SpatialDistribution::OccupancyArray occupancyArray(-range, -range, areaSize, areaSize, bins, bins);
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		occupancyArray.reset();
+
+		ValidationPrecision::ScopedIteration scopedIteration(validation);
+
+		const unsigned int pointNumber = RandomI::random(randomGenerator, 3u, std::is_same<float, Scalar>::value ? 200u : 2000u);
+
+		Vectors2 points;
+		points.reserve(pointNumber);
+
+		while (points.size() < pointNumber)
+		{
+			const Vector2 candidate = Random::vector2(randomGenerator, -range, range);
+
+			if (!occupancyArray.isOccupiedNeighborhood9(candidate)) // let's ensure that we have some space between all points
+			{
+				occupancyArray.addPoint(candidate);
+
+				points.push_back(candidate);
+			}
+		}
+
+		performanceBatch.start();
+			const Geometry::Delaunay::IndexTriangles batchTriangles = Geometry::Delaunay::triangulation(points);
+		performanceBatch.stop();
+
+		Geometry::Delaunay::IncrementalTriangulation triangulation(Box2(-range, -range, range, range));
+
+		performanceIncremental.start();
+
+			for (const Vector2& point : points)
+			{
+				if (triangulation.addPoint(point) == Geometry::Delaunay::IncrementalTriangulation::invalidIndex)
+				{
+					scopedIteration.setInaccurate();
+				}
+			}
+
+		performanceIncremental.stop();
+
+		if (triangulation.size() != points.size() || triangulation.points().size() != points.size())
+		{
+			scopedIteration.setInaccurate();
+		}
+
+		if (!triangulation.checkTriangulation() || !Geometry::Delaunay::checkTriangulation(triangulation.triangles(), points))
+		{
+			scopedIteration.setInaccurate();
+		}
+
+		// the incremental triangulation contains all triangles of the batch triangulation (the batch triangulation may miss triangles at the convex hull)
+
+		{
+			const Geometry::Delaunay::IndexTriangles incrementalTriangles = triangulation.triangles();
+
+			if (incrementalTriangles.size() < batchTriangles.size())
+			{
+				scopedIteration.setInaccurate();
+			}
+		}
+
+		// points outside of the bounding box and existing points cannot be added
+
+		if (triangulation.addPoint(Vector2(range * 2, 0)) != Geometry::Delaunay::IncrementalTriangulation::invalidIndex || triangulation.addPoint(points.front()) != Geometry::Delaunay::IncrementalTriangulation::invalidIndex)
+		{
+			scopedIteration.setInaccurate();
+		}
+
+		// now we remove and add random points
+
+		const unsigned int updates = RandomI::random(randomGenerator, 1u, pointNumber);
+
+		performanceUpdate.start();
+
+			for (unsigned int n = 0u; n < updates; ++n)
+			{
+				if (triangulation.size() > 3 && RandomI::boolean(randomGenerator))
+				{
+					Index32 pointIndex = RandomI::random(randomGenerator, (unsigned int)(triangulation.points().size()) - 1u);
+
+					while (!triangulation.hasPoint(pointIndex))
+					{
+						pointIndex = RandomI::random(randomGenerator, (unsigned int)(triangulation.points().size()) - 1u);
+					}
+
+					if (!triangulation.removePoint(pointIndex) || triangulation.removePoint(pointIndex))
+					{
+						scopedIteration.setInaccurate();
+					}
+				}
+				else
+				{
+					const Vector2 candidate = Random::vector2(randomGenerator, -range, range);
+
+					if (!occupancyArray.isOccupiedNeighborhood9(candidate))
+					{
+						occupancyArray.addPoint(candidate);
+
+						if (triangulation.addPoint(candidate) == Geometry::Delaunay::IncrementalTriangulation::invalidIndex)
+						{
+							scopedIteration.setInaccurate();
+						}
+					}
+				}
+			}
+
+		performanceUpdate.stop();
+
+		// we compact the remaining points to verify the triangulation with the brute force check
+
+		Indices32 compactIndices(triangulation.points().size(), Index32(-1));
+		Vectors2 remainingPoints;
+
+		for (size_t n = 0; n < triangulation.points().size(); ++n)
+		{
+			if (triangulation.hasPoint(Index32(n)))
+			{
+				compactIndices[n] = Index32(remainingPoints.size());
+				remainingPoints.emplace_back(triangulation.points()[n]);
+			}
+		}
+
+		if (remainingPoints.size() != triangulation.size())
+		{
+			scopedIteration.setInaccurate();
+		}
+
+		Geometry::Delaunay::IndexTriangles remainingTriangles;
+
+		for (const Geometry::Delaunay::IndexTriangle& triangle : triangulation.triangles())
+		{
+			const Index32 index0 = compactIndices[triangle.index0()];
+			const Index32 index1 = compactIndices[triangle.index1()];
+			const Index32 index2 = compactIndices[triangle.index2()];
+
+			if (index0 == Index32(-1) || index1 == Index32(-1) || index2 == Index32(-1))
+			{
+				// the triangle references a removed point
+				scopedIteration.setInaccurate();
+				break;
+			}
+
+			remainingTriangles.emplace_back(index0, index1, index2);
+		}
+
+		if (!triangulation.checkTriangulation() || !Geometry::Delaunay::checkTriangulation(remainingTriangles, remainingPoints))
+		{
+			scopedIteration.setInaccurate();
+		}
+	}
+	while (validation.needMoreIterations() || !startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Batch performance: " << performanceBatch.averageMseconds() << "ms";
+	Log::info() << "Incremental performance: " << performanceIncremental.averageMseconds() << "ms";
+	Log::info() << "Update performance: " << performanceUpdate.averageMseconds() << "ms";
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
 }
 
 }
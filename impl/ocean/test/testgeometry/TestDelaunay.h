@@ -51,6 +51,13 @@ class OCEAN_TEST_GEOMETRY_EXPORT TestDelaunay
 		 * @return True, if succeeded
 		 */
 		static bool testTriangulation(const unsigned int pointNumber, const double testDuration);
+
+		/**
+		 * Tests the incremental delaunay triangulation with adding and removing random points.
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @return True, if succeeded
+		 */
+		static bool testIncrementalTriangulation(const double testDuration);
 };
 
 }
@@ -10,6 +10,7 @@
 
 #include "ocean/test/TestResult.h"
 
+#include "ocean/base/HighPerformanceTimer.h"
 #include "ocean/base/Timestamp.h"
 
 #include "ocean/geometry/Error.h"
@@ -71,6 +72,15 @@ bool TestError::test(const double testDuration, const TestSelector& selector)
 		Log::info() << " ";
 	}
 
+	if (selector.shouldRun("determineposeerrorcontiguous"))
+	{
+		testResult = testDeterminePoseErrorContiguous(testDuration);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
 	if (selector.shouldRun("determinehomographyerrorseparate"))
 	{
 		testResult = testDetermineHomographyErrorSeparate(testDuration);
@@ -105,6 +115,11 @@ TEST(TestError, DeterminePoseErrorCombinedAnyCamera)
 	EXPECT_TRUE(TestError::testDeterminePoseErrorCombinedAnyCamera(GTEST_TEST_DURATION));
 }
 
+TEST(TestError, DeterminePoseErrorContiguous)
+{
+	EXPECT_TRUE(TestError::testDeterminePoseErrorContiguous(GTEST_TEST_DURATION));
+}
+
 TEST(TestError, DetermineHomographyErrorSeparate)
 {
 	EXPECT_TRUE(TestError::testDetermineHomographyErrorSeparate(GTEST_TEST_DURATION));
@@ -541,6 +556,199 @@ bool TestError::testDeterminePoseErrorCombinedAnyCamera(const double testDuratio
 	return validation.succeeded();
 }
 
+bool TestError::testDeterminePoseErrorContiguous(const double testDuration)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Testing pose error determination for contiguous correspondences:";
+
+	RandomGenerator randomGenerator;
+	ValidationPrecision validation(0.999, randomGenerator);
+
+	const Scalar epsilon = std::is_same<float, Scalar>::value ? Scalar(0.01) : Scalar(0.001);
+
+	const PinholeCamera patternCamera(1280u, 720u, Numeric::deg2rad(45));
+
+	HighPerformanceStatistic performanceAccessor;
+	HighPerformanceStatistic performanceContiguous;
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		for (unsigned int distortionIteration = 0u; distortionIteration < 4u; ++distortionIteration)
+		{
+			const bool radialDistortion = distortionIteration == 1u || distortionIteration == 3u;
+			const bool tangentialDistortion = distortionIteration == 2u || distortionIteration == 3u;
+
+			const PinholeCamera pinholeCamera(Utilities::distortedCamera(patternCamera, true, radialDistortion, tangentialDistortion));
+			const AnyCameraPinhole anyCamera(pinholeCamera);
+
+			const unsigned int correspondences = RandomI::random(randomGenerator, 1u, 500u);
+
+			const Vectors3 objectPoints = Utilities::objectPoints(Box3(Vector3(-10, -10, -10), Vector3(10, 10, 10)), correspondences, &randomGenerator);
+			const HomogenousMatrix4 world_T_camera(Utilities::viewPosition(pinholeCamera, objectPoints, false, &randomGenerator));
+			const HomogenousMatrix4 flippedCamera_T_world(PinholeCamera::standard2InvertedFlipped(world_T_camera));
+
+			Vectors2 imagePoints;
+			imagePoints.reserve(objectPoints.size());
+
+			for (const Vector3& objectPoint : objectPoints)
+			{
+				Vector2 imagePoint = pinholeCamera.projectToImage<true>(world_T_camera, objectPoint, true);
+
+				if (RandomI::random(randomGenerator, 3u) == 0u)
+				{
+					imagePoint += Random::gaussianNoiseVector2(randomGenerator, Scalar(10), Scalar(10));
+				}
+
+				imagePoints.push_back(imagePoint);
+			}
+
+			const Scalar maximalSqrError = Scalar(3 * 3);
+
+			for (const bool useDistortionParameters : {false, true})
+			{
+				// the pinhole camera with fused projection
+
+				Scalars testSqrErrors(objectPoints.size());
+				Scalar testSqrErrorSum = 0;
+
+				Indices32 testValidIndices;
+				Scalar testValidSqrErrorSum = 0;
+
+				for (size_t n = 0; n < objectPoints.size(); ++n)
+				{
+					testSqrErrors[n] = pinholeCamera.projectToImageIF<true>(flippedCamera_T_world, objectPoints[n], useDistortionParameters).sqrDistance(imagePoints[n]);
+					testSqrErrorSum += testSqrErrors[n];
+
+					if (testSqrErrors[n] <= maximalSqrError)
+					{
+						testValidIndices.push_back(Index32(n));
+						testValidSqrErrorSum += testSqrErrors[n];
+					}
+				}
+
+				if (useDistortionParameters)
+				{
+					Scalars accessorSqrErrors(objectPoints.size());
+
+					performanceAccessor.start();
+						Geometry::Error::determinePoseErrorIF<ConstArrayAccessor<Vector3>, ConstArrayAccessor<Vector2>, true, false, true>(flippedCamera_T_world, pinholeCamera, ConstArrayAccessor<Vector3>(objectPoints), ConstArrayAccessor<Vector2>(imagePoints), useDistortionParameters, Scalar(1), nullptr, accessorSqrErrors.data());
+					performanceAccessor.stop();
+				}
+
+				Scalars sqrErrors(objectPoints.size());
+
+				if (useDistortionParameters)
+				{
+					performanceContiguous.start();
+				}
+
+				const Scalar sqrErrorSum = Geometry::Error::determinePoseErrorSumIF<true>(flippedCamera_T_world, pinholeCamera, objectPoints.data(), imagePoints.data(), objectPoints.size(), useDistortionParameters, Numeric::maxValue(), sqrErrors.data());
+
+				if (useDistortionParameters)
+				{
+					performanceContiguous.stop();
+				}
+
+				for (size_t n = 0; n < objectPoints.size(); ++n)
+				{
+					ValidationPrecision::ScopedIteration scopedIteration(validation);
+
+					if (Numeric::isNotEqual(sqrErrors[n], testSqrErrors[n], epsilon * std::max(Scalar(1), testSqrErrors[n])))
+					{
+						scopedIteration.setInaccurate();
+					}
+				}
+
+				if (Numeric::isNotEqual(sqrErrorSum, testSqrErrorSum, epsilon * std::max(Scalar(1), testSqrErrorSum)))
+				{
+					OCEAN_SET_FAILED(validation);
+				}
+
+				// the early exit
+
+				const Scalar maximalSqrErrorSum = testSqrErrorSum * Random::scalar(randomGenerator, Scalar(0), Scalar(0.9));
+
+				const Scalar earlySqrErrorSum = Geometry::Error::determinePoseErrorSumIF<true>(flippedCamera_T_world, pinholeCamera, objectPoints.data(), imagePoints.data(), objectPoints.size(), useDistortionParameters, maximalSqrErrorSum);
+
+				if (testSqrErrorSum > Scalar(1) && (earlySqrErrorSum <= maximalSqrErrorSum || earlySqrErrorSum > sqrErrorSum * Scalar(1.001) + epsilon))
+				{
+					OCEAN_SET_FAILED(validation);
+				}
+
+				Indices32 validIndices;
+				Scalar validSqrErrorSum = 0;
+				const size_t validCorrespondences = Geometry::Error::determineValidCorrespondencesIF<true>(flippedCamera_T_world, pinholeCamera, objectPoints.data(), imagePoints.data(), objectPoints.size(), useDistortionParameters, maximalSqrError, &validIndices, &validSqrErrorSum);
+
+				if (validCorrespondences != validIndices.size())
+				{
+					OCEAN_SET_FAILED(validation);
+				}
+
+				{
+					ValidationPrecision::ScopedIteration scopedIteration(validation);
+
+					// correspondences with an error close to the threshold may be classified differently due to rounding
+
+					if (validIndices.size() + 2 < testValidIndices.size() || testValidIndices.size() + 2 < validIndices.size() || Numeric::isNotEqual(validSqrErrorSum, testValidSqrErrorSum, Scalar(2) * maximalSqrError + epsilon))
+					{
+						scopedIteration.setInaccurate();
+					}
+				}
+			}
+
+			// the camera profile
+
+			Scalar testSqrErrorSum = 0;
+			size_t testValidCorrespondences = 0;
+
+			for (size_t n = 0; n < objectPoints.size(); ++n)
+			{
+				const Scalar testSqrError = anyCamera.projectToImageIF(flippedCamera_T_world, objectPoints[n]).sqrDistance(imagePoints[n]);
+
+				testSqrErrorSum += testSqrError;
+
+				if (testSqrError <= maximalSqrError)
+				{
+					++testValidCorrespondences;
+				}
+			}
+
+			Scalars sqrErrors(objectPoints.size());
+			const Scalar sqrErrorSum = Geometry::Error::determinePoseErrorSumIF(flippedCamera_T_world, anyCamera, objectPoints.data(), imagePoints.data(), objectPoints.size(), Numeric::maxValue(), sqrErrors.data());
+
+			if (Numeric::isNotEqual(sqrErrorSum, testSqrErrorSum, epsilon * std::max(Scalar(1), testSqrErrorSum)))
+			{
+				OCEAN_SET_FAILED(validation);
+			}
+
+			const Scalar maximalSqrErrorSum = testSqrErrorSum * Random::scalar(randomGenerator, Scalar(0), Scalar(0.9));
+
+			if (testSqrErrorSum > Scalar(1) && Geometry::Error::determinePoseErrorSumIF(flippedCamera_T_world, anyCamera, objectPoints.data(), imagePoints.data(), objectPoints.size(), maximalSqrErrorSum) <= maximalSqrErrorSum)
+			{
+				OCEAN_SET_FAILED(validation);
+			}
+
+			Indices32 validIndices;
+			const size_t validCorrespondences = Geometry::Error::determineValidCorrespondencesIF(flippedCamera_T_world, anyCamera, objectPoints.data(), imagePoints.data(), objectPoints.size(), maximalSqrError, &validIndices);
+
+			if (validCorrespondences != validIndices.size() || validCorrespondences != testValidCorrespondences)
+			{
+				OCEAN_SET_FAILED(validation);
+			}
+		}
+	}
+	while (validation.needMoreIterations() || !startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Accessor performance: " << performanceAccessor;
+	Log::info() << "Contiguous performance: " << performanceContiguous;
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
 bool TestError::testDetermineHomographyErrorSeparate(const double testDuration)
 {
 	ocean_assert(testDuration > 0.0);
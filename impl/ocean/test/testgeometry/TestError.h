@@ -65,6 +65,13 @@ class OCEAN_TEST_GEOMETRY_EXPORT TestError
 		 */
 		static bool testDeterminePoseErrorCombinedAnyCamera(const double testDuration);
 
+		/**
+		 * Tests the pose error determination functions for contiguous arrays of correspondences.
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @return True, if succeeded
+		 */
+		static bool testDeterminePoseErrorContiguous(const double testDuration);
+
 		/**
 		 * Tests the homography error determination function for separate error values.
 		 * @param testDuration Number of seconds for each test, with range (0, infinity)
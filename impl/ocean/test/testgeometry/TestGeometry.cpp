@@ -24,6 +24,7 @@
 #include "ocean/test/testgeometry/TestNonLinearOptimizationPlane.h"
 #include "ocean/test/testgeometry/TestNonLinearOptimizationPose.h"
 #include "ocean/test/testgeometry/TestNonLinearOptimizationTransformation.h"
+#include "ocean/test/testgeometry/TestNonLinearUniversalOptimizationDense.h"
 #include "ocean/test/testgeometry/TestOctree.h"
 #include "ocean/test/testgeometry/TestP3P.h"
 #include "ocean/test/testgeometry/TestP4P.h"
@@ -274,6 +275,15 @@ bool testGeometry(const double testDuration, Worker& worker, const std::string&
 		testResult = TestNonLinearOptimizationTransformation::test(testDuration, &worker, subSelector);
 	}
 
+	if (TestSelector subSelector = selector.shouldRun("nonlinearuniversaloptimizationdense"))
+	{
+		Log::info() << " ";
+		Log::info() << " ";
+		Log::info() << " ";
+		Log::info() << " ";
+		testResult = TestNonLinearUniversalOptimizationDense::test(testDuration, subSelector);
+	}
+
 	if (TestSelector subSelector = selector.shouldRun("epipolargeometry"))
 	{
 		Log::info() << " ";
@@ -325,7 +335,7 @@ bool testGeometry(const double testDuration, Worker& worker, const std::string&
 		Log::info() << " ";
 		Log::info() << " ";
 		Log::info() << " ";
-		testResult = TestStereoscopicGeometry::test(testDuration, subSelector);
+		testResult = TestStereoscopicGeometry::test(testDuration, worker, subSelector);
 	}
 
 	Log::info() << " ";
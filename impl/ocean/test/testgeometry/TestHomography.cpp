@@ -9,6 +9,7 @@
 
 #include "ocean/test/TestResult.h"
 
+#include "ocean/base/DataType.h"
 #include "ocean/base/HighPerformanceTimer.h"
 #include "ocean/base/Timestamp.h"
 
@@ -193,6 +194,28 @@ bool TestHomography::test(const double testDuration, Worker& /*worker*/, const T
 	{
 		testResult = testHomographyMatrixFromPointsAndLinesSVD(testDuration);
 
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
+	if (selector.shouldRun("homographymatrixfromfourpoints"))
+	{
+		testResult = testHomographyMatrixFromFourPoints<float>(testDuration);
+		Log::info() << " ";
+		testResult = testHomographyMatrixFromFourPoints<double>(testDuration);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
+	if (selector.shouldRun("homographymatrixdlt"))
+	{
+		testResult = testHomographyMatrixDLT<float>(testDuration);
+		Log::info() << " ";
+		testResult = testHomographyMatrixDLT<double>(testDuration);
+
 		Log::info() << " ";
 	}
 
@@ -337,6 +360,28 @@ TEST(TestHomography, HomographyMatrixFromPointsAndLinesSVD)
 	EXPECT_TRUE(TestHomography::testHomographyMatrixFromPointsAndLinesSVD(GTEST_TEST_DURATION));
 }
 
+
+TEST(TestHomography, HomographyMatrixFromFourPoints_float)
+{
+	EXPECT_TRUE(TestHomography::testHomographyMatrixFromFourPoints<float>(GTEST_TEST_DURATION));
+}
+
+TEST(TestHomography, HomographyMatrixFromFourPoints_double)
+{
+	EXPECT_TRUE(TestHomography::testHomographyMatrixFromFourPoints<double>(GTEST_TEST_DURATION));
+}
+
+
+TEST(TestHomography, HomographyMatrixDLT_float)
+{
+	EXPECT_TRUE(TestHomography::testHomographyMatrixDLT<float>(GTEST_TEST_DURATION));
+}
+
+TEST(TestHomography, HomographyMatrixDLT_double)
+{
+	EXPECT_TRUE(TestHomography::testHomographyMatrixDLT<double>(GTEST_TEST_DURATION));
+}
+
 #endif // OCEAN_USE_GTEST
 
 bool TestHomography::testRotationalHomographyOnePose(const double testDuration)
@@ -2128,6 +2173,264 @@ bool TestHomography::testHomographyMatrixFromPointsAndLinesSVD(const double test
 	return succeeded;
 }
 
+template <typename T>
+bool TestHomography::testHomographyMatrixFromFourPoints(const double testDuration)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Closed-form homography from four points test, with " << TypeNamer::name<T>() << ":";
+
+	constexpr unsigned int width = std::is_same<float, T>::value ? 640u : 1920u;
+	constexpr unsigned int height = std::is_same<float, T>::value ? 480u : 1080u;
+
+	constexpr size_t batchSize = 8;
+
+	const T maximalPixelError = std::is_same<float, T>::value ? T(0.5) : T(0.01);
+
+	VectorT2<T> leftPoints[batchSize * 4];
+	VectorT2<T> rightPoints[batchSize * 4];
+	VectorT2<T> perfectRightPoints[batchSize * 4];
+
+	RandomGenerator randomGenerator;
+	const double successThreshold = std::is_same<float, T>::value ? 0.95 : 0.99;
+	ValidationPrecision validation(successThreshold, randomGenerator);
+
+	HighPerformanceStatistic performanceSingle;
+	HighPerformanceStatistic performanceBatch;
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		for (size_t i = 0; i < batchSize; ++i)
+		{
+			createCorrespondences<T>(width, height, 4, Scalar(0), randomGenerator, leftPoints + i * 4, rightPoints + i * 4, perfectRightPoints + i * 4);
+		}
+
+		SquareMatrixT3<T> homographies[batchSize];
+		bool validHomographies[batchSize];
+
+		performanceSingle.start();
+			for (size_t i = 0; i < batchSize; ++i)
+			{
+				validHomographies[i] = Geometry::Homography::homographyMatrixFromFourPoints<T>(leftPoints + i * 4, rightPoints + i * 4, homographies[i]);
+			}
+		performanceSingle.stop();
+
+		SquareMatrixT3<T> batchHomographies[batchSize];
+		bool batchValidHomographies[batchSize];
+
+		performanceBatch.start();
+			const unsigned int validBatchHomographies = Geometry::Homography::homographyMatricesFromFourPointsBatch<T, batchSize>(leftPoints, rightPoints, batchHomographies, batchValidHomographies);
+		performanceBatch.stop();
+
+		unsigned int validCounter = 0u;
+
+		for (size_t i = 0; i < batchSize; ++i)
+		{
+			ValidationPrecision::ScopedIteration scopedIteration(validation);
+
+			if (batchValidHomographies[i])
+			{
+				++validCounter;
+			}
+
+			if (validHomographies[i] && batchValidHomographies[i])
+			{
+				for (size_t n = 0; n < 4; ++n)
+				{
+					const VectorT2<T> transformedPoint = homographies[i] * leftPoints[i * 4 + n];
+					const VectorT2<T> batchTransformedPoint = batchHomographies[i] * leftPoints[i * 4 + n];
+
+					if (transformedPoint.distance(perfectRightPoints[i * 4 + n]) > maximalPixelError || batchTransformedPoint.distance(perfectRightPoints[i * 4 + n]) > maximalPixelError)
+					{
+						scopedIteration.setInaccurate();
+						break;
+					}
+				}
+			}
+			else
+			{
+				scopedIteration.setInaccurate();
+			}
+		}
+
+		if (validCounter != validBatchHomographies)
+		{
+			OCEAN_SET_FAILED(validation);
+		}
+	}
+	while (validation.needMoreIterations() || !startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Performance single (" << batchSize << " samples): " << performanceSingle;
+	Log::info() << "Performance batch (" << batchSize << " samples): " << performanceBatch;
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
+template <typename T>
+bool TestHomography::testHomographyMatrixDLT(const double testDuration)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Direct linear transformation homography test, with " << TypeNamer::name<T>() << ":";
+
+	constexpr unsigned int width = std::is_same<float, T>::value ? 640u : 1920u;
+	constexpr unsigned int height = std::is_same<float, T>::value ? 480u : 1080u;
+
+	constexpr size_t batchSize = 4;
+
+	bool allSucceeded = true;
+
+	for (const size_t correspondences : {size_t(4), size_t(8), size_t(50), size_t(500)})
+	{
+		Log::info() << " ";
+		Log::info() << "... with " << correspondences << " points:";
+
+		// four correspondences are fitted exactly, for larger noised sets the result must match the result of the SVD
+
+		const Scalar standardDeviation = correspondences == 4 ? Scalar(0) : Scalar(0.5);
+		const T maximalPixelError = std::is_same<float, T>::value ? T(0.5) : T(0.01);
+
+		std::vector<VectorT2<T>> leftPoints(batchSize * correspondences);
+		std::vector<VectorT2<T>> rightPoints(batchSize * correspondences);
+		std::vector<VectorT2<T>> perfectRightPoints(batchSize * correspondences);
+
+		Vectors2 scalarLeftPoints(correspondences);
+		Vectors2 scalarRightPoints(correspondences);
+
+		RandomGenerator randomGenerator;
+		const double successThreshold = std::is_same<float, T>::value ? 0.95 : 0.99;
+		ValidationPrecision validation(successThreshold, randomGenerator);
+
+		HighPerformanceStatistic performanceSVD;
+		HighPerformanceStatistic performanceSingle;
+		HighPerformanceStatistic performanceBatch;
+
+		const Timestamp startTimestamp(true);
+
+		do
+		{
+			for (size_t i = 0; i < batchSize; ++i)
+			{
+				createCorrespondences<T>(width, height, correspondences, standardDeviation, randomGenerator, leftPoints.data() + i * correspondences, rightPoints.data() + i * correspondences, perfectRightPoints.data() + i * correspondences);
+			}
+
+			for (size_t n = 0; n < correspondences; ++n)
+			{
+				scalarLeftPoints[n] = Vector2(leftPoints[n]);
+				scalarRightPoints[n] = Vector2(rightPoints[n]);
+			}
+
+			SquareMatrix3 svdHomography;
+
+			performanceSVD.start();
+				const bool svdSucceeded = Geometry::Homography::homographyMatrixSVD(scalarLeftPoints.data(), scalarRightPoints.data(), correspondences, svdHomography);
+			performanceSVD.stop();
+
+			SquareMatrixT3<T> homographies[batchSize];
+			bool validHomographies[batchSize];
+
+			performanceSingle.start();
+				validHomographies[0] = Geometry::Homography::homographyMatrixDLT<T>(leftPoints.data(), rightPoints.data(), correspondences, homographies[0]);
+			performanceSingle.stop();
+
+			for (size_t i = 1; i < batchSize; ++i)
+			{
+				validHomographies[i] = Geometry::Homography::homographyMatrixDLT<T>(leftPoints.data() + i * correspondences, rightPoints.data() + i * correspondences, correspondences, homographies[i]);
+			}
+
+			SquareMatrixT3<T> batchHomographies[batchSize];
+			bool batchValidHomographies[batchSize];
+
+			performanceBatch.start();
+				Geometry::Homography::homographyMatricesDLTBatch<T, batchSize>(leftPoints.data(), rightPoints.data(), correspondences, batchHomographies, batchValidHomographies);
+			performanceBatch.stop();
+
+			for (size_t i = 0; i < batchSize; ++i)
+			{
+				ValidationPrecision::ScopedIteration scopedIteration(validation);
+
+				if (validHomographies[i] && batchValidHomographies[i])
+				{
+					for (size_t n = 0; n < correspondences; ++n)
+					{
+						const VectorT2<T>& leftPoint = leftPoints[i * correspondences + n];
+
+						VectorT2<T> expectedRightPoint = perfectRightPoints[i * correspondences + n];
+
+						if (correspondences != 4)
+						{
+							if (i != 0 || !svdSucceeded)
+							{
+								// the SVD reference is only determined for the first sample
+								break;
+							}
+
+							expectedRightPoint = VectorT2<T>(svdHomography * Vector2(leftPoint));
+						}
+
+						if ((homographies[i] * leftPoint).distance(expectedRightPoint) > maximalPixelError || (batchHomographies[i] * leftPoint).distance(expectedRightPoint) > maximalPixelError)
+						{
+							scopedIteration.setInaccurate();
+							break;
+						}
+					}
+				}
+				else
+				{
+					scopedIteration.setInaccurate();
+				}
+			}
+		}
+		while (validation.needMoreIterations() || !startTimestamp.hasTimePassed(testDuration));
+
+		Log::info() << "Performance SVD (" << TypeNamer::name<Scalar>() << "): " << performanceSVD;
+		Log::info() << "Performance single: " << performanceSingle;
+		Log::info() << "Performance batch (" << batchSize << " samples): " << performanceBatch;
+		Log::info() << "Validation: " << validation;
+
+		if (!validation.succeeded())
+		{
+			allSucceeded = false;
+		}
+	}
+
+	return allSucceeded;
+}
+
+template <typename T>
+void TestHomography::createCorrespondences(const unsigned int width, const unsigned int height, const size_t correspondences, const Scalar standardDeviation, RandomGenerator& randomGenerator, VectorT2<T>* leftPoints, VectorT2<T>* rightPoints, VectorT2<T>* perfectRightPoints)
+{
+	ocean_assert(width >= 1u && height >= 1u);
+	ocean_assert(leftPoints != nullptr && rightPoints != nullptr && perfectRightPoints != nullptr);
+
+	const PinholeCamera pinholeCamera(width, height, Numeric::deg2rad(60));
+
+	const Plane3 plane(Vector3(0, 0, -4), Vector3(0, 0, 1));
+
+	const HomogenousMatrix4 leftPose(Random::vector3(randomGenerator, -0.5, 0.5), Random::euler(randomGenerator, 0, Numeric::deg2rad(20)));
+	const HomogenousMatrix4 rightPose(Random::vector3(randomGenerator, -0.5, 0.5), Random::euler(randomGenerator, 0, Numeric::deg2rad(20)));
+
+	for (size_t n = 0; n < correspondences; ++n)
+	{
+		const Vector2 leftPoint = Random::vector2(randomGenerator, Scalar(0), Scalar(width), Scalar(0), Scalar(height));
+
+		Vector3 objectPoint;
+		if (!plane.intersection(pinholeCamera.ray(leftPoint, leftPose), objectPoint))
+		{
+			ocean_assert(false && "This should never happen!");
+		}
+
+		const Vector2 rightPoint = pinholeCamera.projectToImage<false>(rightPose, objectPoint, false);
+
+		leftPoints[n] = VectorT2<T>(leftPoint);
+		perfectRightPoints[n] = VectorT2<T>(rightPoint);
+		rightPoints[n] = standardDeviation > Scalar(0) ? VectorT2<T>(rightPoint + Random::gaussianNoiseVector2(randomGenerator, standardDeviation, standardDeviation)) : perfectRightPoints[n];
+	}
+}
+
 }
 
 }
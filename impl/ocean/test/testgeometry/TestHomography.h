@@ -10,8 +10,11 @@
 
 #include "ocean/test/testgeometry/TestGeometry.h"
 
+#include "ocean/base/RandomGenerator.h"
 #include "ocean/base/Worker.h"
 
+#include "ocean/math/Vector2.h"
+
 #include "ocean/test/TestSelector.h"
 
 namespace Ocean
@@ -193,6 +196,41 @@ class OCEAN_TEST_GEOMETRY_EXPORT TestHomography
 		 * @return True, if succeeded
 		 */
 		static bool testHomographyMatrixFromPointsAndLinesSVD(const double testDuration, const size_t correspondences);
+
+		/**
+		 * Tests the closed-form determination of the homography matrix from four point correspondences, including the batch function.
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @return True, if succeeded
+		 * @tparam T The data type of the scalar to be used, either 'float' or 'double'
+		 */
+		template <typename T>
+		static bool testHomographyMatrixFromFourPoints(const double testDuration);
+
+		/**
+		 * Tests the memory-free direct linear transformation determining the homography matrix, including the batch function.
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @return True, if succeeded
+		 * @tparam T The data type of the scalar to be used, either 'float' or 'double'
+		 */
+		template <typename T>
+		static bool testHomographyMatrixDLT(const double testDuration);
+
+	protected:
+
+		/**
+		 * Creates random point correspondences for a realistic homography between two cameras observing a 3D plane.
+		 * @param width The width of both camera images in pixel, with range [1, infinity)
+		 * @param height The height of both camera images in pixel, with range [1, infinity)
+		 * @param correspondences The number of correspondences to be created, with range [1, infinity)
+		 * @param standardDeviation The standard deviation of the Gaussian noise which is added to the right points, with range [0, infinity)
+		 * @param randomGenerator The random generator to be used
+		 * @param leftPoints The resulting left image points, must be valid
+		 * @param rightPoints The resulting noised right image points, one for each left point, must be valid
+		 * @param perfectRightPoints The resulting perfect right image points without noise, one for each left point, must be valid
+		 * @tparam T The data type of the scalar to be used, either 'float' or 'double'
+		 */
+		template <typename T>
+		static void createCorrespondences(const unsigned int width, const unsigned int height, const size_t correspondences, const Scalar standardDeviation, RandomGenerator& randomGenerator, VectorT2<T>* leftPoints, VectorT2<T>* rightPoints, VectorT2<T>* perfectRightPoints);
 };
 
 }
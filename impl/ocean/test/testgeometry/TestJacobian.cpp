@@ -322,6 +322,17 @@ bool TestJacobian::test(const double testDuration, const TestSelector& selector)
 		Log::info() << " ";
 		testResult = testCalculateFisheyeDistortNormalized2x2<double>(testDuration);
 
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
+	if (selector.shouldRun("automaticjacobian"))
+	{
+		testResult = testAutomaticJacobian<float>(testDuration);
+		Log::info() << " ";
+		testResult = testAutomaticJacobian<double>(testDuration);
+
 		Log::info() << " ";
 	}
 
@@ -536,6 +547,17 @@ TEST(TestJacobian, CalculateFisheyeDistortNormalized2x2_double)
 	EXPECT_TRUE(TestJacobian::testCalculateFisheyeDistortNormalized2x2<double>(GTEST_TEST_DURATION));
 }
 
+
+TEST(TestJacobian, AutomaticJacobian_float)
+{
+	EXPECT_TRUE(TestJacobian::testAutomaticJacobian<float>(GTEST_TEST_DURATION));
+}
+
+TEST(TestJacobian, AutomaticJacobian_double)
+{
+	EXPECT_TRUE(TestJacobian::testAutomaticJacobian<double>(GTEST_TEST_DURATION));
+}
+
 #endif // OCEAN_USE_GTEST
 
 template <typename T, typename TScalar, typename TVariable>
@@ -1564,6 +1586,36 @@ bool TestJacobian::testAnyCameraPoseJacobian2nx6(const double testDuration)
 				Geometry::Jacobian::calculatePoseJacobianRodrigues2nx6IF(jacobian.data(), anyCamera, flippedCamera_P_world, objectPoints.data(), objectPoints.size());
 			}
 
+			{
+				// the one-pass function must provide the same jacobian and the same projected image points
+
+				MatrixT<T> onePassJacobian(2 * objectPoints.size(), 6);
+				VectorsT2<T> imagePoints(objectPoints.size());
+
+				Geometry::Jacobian::calculatePoseJacobianRodrigues2nx6IF(onePassJacobian.data(), imagePoints.data(), anyCamera, flippedCamera_P_world, objectPoints.data(), objectPoints.size());
+
+				// the jacobian function uses the transformation of the 6-DOF pose, which may slightly differ from the original transformation
+				const HomogenousMatrixT4<T> poseFlippedCamera_T_world(flippedCamera_P_world.transformation());
+
+				constexpr T maximalProjectionError = std::is_same<float, T>::value ? T(0.1) : T(0.001);
+
+				for (size_t n = 0; n < objectPoints.size(); ++n)
+				{
+					if (!imagePoints[n].isEqual(anyCamera.projectToImageIF(poseFlippedCamera_T_world, objectPoints[n]), maximalProjectionError))
+					{
+						OCEAN_SET_FAILED(validation);
+					}
+				}
+
+				for (size_t n = 0; n < onePassJacobian.elements(); ++n)
+				{
+					if (NumericT<T>::isNotEqual(onePassJacobian.data()[n], jacobian.data()[n], T(0.001) * std::max(T(1), NumericT<T>::abs(jacobian.data()[n]))))
+					{
+						OCEAN_SET_FAILED(validation);
+					}
+				}
+			}
+
 			{
 				MatrixT<T> naiveJacobian(2 * objectPoints.size(), 6);
 
@@ -6207,6 +6259,112 @@ bool TestJacobian::testCalculateFisheyeDistortNormalized2x2(const double testDur
 	return validation.succeeded();
 }
 
+template <typename T>
+bool TestJacobian::testAutomaticJacobian(const double testDuration)
+{
+	ocean_assert(testDuration > 0.0);
+
+	constexpr unsigned int numberPoints = 50u;
+
+	Log::info() << "Testing automatic Jacobian 2x6 for " << numberPoints << " points with " << sizeof(T) * 8 << "-bit precision:";
+
+	RandomGenerator randomGenerator;
+
+	constexpr double threshold = std::is_same<float, T>::value ? 0.95 : 0.99;
+
+	ValidationPrecision validation(threshold, randomGenerator);
+
+	HighPerformanceStatistic performanceAutomatic;
+	HighPerformanceStatistic performance;
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		const PinholeCameraT<T> pinholeCamera(1920u, 1080u, NumericT<T>::deg2rad(RandomT<T>::scalar(randomGenerator, 30, 70)));
+
+		const QuaternionT<T> world_Q_camera(RandomT<T>::quaternion(randomGenerator));
+		const HomogenousMatrixT4<T> world_T_camera(RandomT<T>::vector3(randomGenerator, -5, 5), world_Q_camera);
+		const PoseT<T> flippedCamera_P_world(PinholeCameraT<T>::standard2InvertedFlipped(world_T_camera));
+
+		VectorsT3<T> objectPoints(numberPoints);
+
+		for (VectorT3<T>& objectPoint : objectPoints)
+		{
+			const VectorT2<T> imagePoint(RandomT<T>::vector2(randomGenerator, T(0), T(pinholeCamera.width()), T(0), T(pinholeCamera.height())));
+
+			objectPoint = pinholeCamera.ray(imagePoint, world_T_camera).point(RandomT<T>::scalar(randomGenerator, 1, 5));
+		}
+
+		MatrixT<T> automaticJacobians(2 * numberPoints, 6);
+		MatrixT<T> jacobians(2 * numberPoints, 6);
+
+		const T poseParameters[6] = {flippedCamera_P_world.rx(), flippedCamera_P_world.ry(), flippedCamera_P_world.rz(), flippedCamera_P_world.x(), flippedCamera_P_world.y(), flippedCamera_P_world.z()};
+
+		performanceAutomatic.start();
+
+		for (unsigned int n = 0u; n < numberPoints; ++n)
+		{
+			const VectorT3<T>& objectPoint = objectPoints[n];
+
+			// projection of an object point with a Rodrigues rotation, and ideal pinhole camera (without distortion)
+
+			const auto function = [&pinholeCamera, &objectPoint](const AutomaticDifferentiationVectorT<T, 6>* pose, AutomaticDifferentiationVectorT<T, 6>* imagePoint)
+			{
+				using AutoDiff = AutomaticDifferentiationVectorT<T, 6>;
+
+				const AutoDiff& wx = pose[0];
+				const AutoDiff& wy = pose[1];
+				const AutoDiff& wz = pose[2];
+
+				const AutoDiff angle(AutoDiff::sqrt(wx * wx + wy * wy + wz * wz));
+				const AutoDiff cosAngle(AutoDiff::cos(angle));
+				const AutoDiff cosAngle1_a2 = (1 - cosAngle) / (angle * angle);
+				const AutoDiff sin_a(AutoDiff::sin(angle) / angle);
+
+				const AutoDiff u = (cosAngle + cosAngle1_a2 * wx * wx) * objectPoint.x() + (cosAngle1_a2 * wx * wy - sin_a * wz) * objectPoint.y() + (cosAngle1_a2 * wx * wz + sin_a * wy) * objectPoint.z() + pose[3];
+				const AutoDiff v = (cosAngle1_a2 * wx * wy + sin_a * wz) * objectPoint.x() + (cosAngle + cosAngle1_a2 * wy * wy) * objectPoint.y() + (cosAngle1_a2 * wy * wz - sin_a * wx) * objectPoint.z() + pose[4];
+				const AutoDiff w = (cosAngle1_a2 * wx * wz - sin_a * wy) * objectPoint.x() + (cosAngle1_a2 * wy * wz + sin_a * wx) * objectPoint.y() + (cosAngle + cosAngle1_a2 * wz * wz) * objectPoint.z() + pose[5];
+
+				imagePoint[0] = u / w * pinholeCamera.focalLengthX() + pinholeCamera.principalPointX();
+				imagePoint[1] = v / w * pinholeCamera.focalLengthY() + pinholeCamera.principalPointY();
+			};
+
+			Geometry::Jacobian::calculateAutomaticJacobian<T, 6, 2>(function, poseParameters, automaticJacobians[2u * n]);
+		}
+
+		performanceAutomatic.stop();
+
+		performance.start();
+
+		for (unsigned int n = 0u; n < numberPoints; ++n)
+		{
+			Geometry::Jacobian::calculatePoseJacobianRodrigues2x6(jacobians[2u * n + 0u], jacobians[2u * n + 1u], pinholeCamera, flippedCamera_P_world, objectPoints[n], false);
+		}
+
+		performance.stop();
+
+		for (size_t n = 0; n < jacobians.elements(); ++n)
+		{
+			ValidationPrecision::ScopedIteration scopedIteration(validation);
+
+			const T tolerance = std::max(T(1), NumericT<T>::abs(jacobians.data()[n])) * NumericT<T>::weakEps();
+
+			if (NumericT<T>::isNotEqual(automaticJacobians.data()[n], jacobians.data()[n], tolerance))
+			{
+				scopedIteration.setInaccurate();
+			}
+		}
+	}
+	while (validation.needMoreIterations() || !startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Performance automatic: " << performanceAutomatic;
+	Log::info() << "Performance analytic: " << performance;
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
 }
 
 }
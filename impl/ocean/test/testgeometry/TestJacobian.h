@@ -490,6 +490,15 @@ class OCEAN_TEST_GEOMETRY_EXPORT TestJacobian : protected Geometry::Jacobian
 		template <typename T>
 		static bool testCalculateFisheyeDistortNormalized2x2(const double testDuration);
 
+		/**
+		 * Tests the Jacobian determination of a custom function with automatic differentiation, using the 2x6 pose Jacobian of a pinhole camera.
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @return True, if succeeded
+		 * @tparam T the data type of the scalar to be used, 'float', or 'double'
+		 */
+		template <typename T>
+		static bool testAutomaticJacobian(const double testDuration);
+
 	private:
 
 		/**
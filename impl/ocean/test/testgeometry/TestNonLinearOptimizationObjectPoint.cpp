@@ -119,6 +119,15 @@ bool TestNonLinearOptimizationObjectPoint::test(const double testDuration, Worke
 		Log::info() << " ";
 	}
 
+	if (selector.shouldRun("nonlinearoptimizationposesobjectpointsschursolvers"))
+	{
+		testResult = testNonLinearOptimizationPosesObjectPointsSchurSolvers(testDuration, worker);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
 	if (selector.shouldRun("nonlinearoptimizationorientationalposesobjectpoints"))
 	{
 		testResult = testNonLinearOptimizationOrientationalPosesObjectPoints(testDuration);
@@ -141,6 +150,15 @@ bool TestNonLinearOptimizationObjectPoint::test(const double testDuration, Worke
 	{
 		testResult = testClampDistantObjectPoints(testDuration);
 
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
+	if (selector.shouldRun("optimizeobjectpointmixedprecision"))
+	{
+		testResult = testOptimizeObjectPointMixedPrecision(testDuration);
+
 		Log::info() << " ";
 	}
 
@@ -314,6 +332,12 @@ TEST(TestNonLinearOptimizationObjectPoint, NonLinearOptimizationPosesObjectPoint
 
 #endif // OCEAN_DEBUG
 
+TEST(TestNonLinearOptimizationObjectPoint, NonLinearOptimizationPosesObjectPointsSchurSolvers)
+{
+	Worker worker;
+	EXPECT_TRUE(TestNonLinearOptimizationObjectPoint::testNonLinearOptimizationPosesObjectPointsSchurSolvers(GTEST_TEST_DURATION, &worker));
+}
+
 
 TEST(TestNonLinearOptimizationObjectPoint, NonLinearOptimizationOrientationalPosesObjectPoints_20Poses_20Points_NoOutliers_NoNoise)
 {
@@ -489,6 +513,11 @@ TEST(TestNonLinearOptimizationObjectPoint, ClampDistantObjectPoints)
 	EXPECT_TRUE(TestNonLinearOptimizationObjectPoint::testClampDistantObjectPoints(GTEST_TEST_DURATION));
 }
 
+TEST(TestNonLinearOptimizationObjectPoint, OptimizeObjectPointMixedPrecision)
+{
+	EXPECT_TRUE(TestNonLinearOptimizationObjectPoint::testOptimizeObjectPointMixedPrecision(GTEST_TEST_DURATION));
+}
+
 #endif // OCEAN_USE_GTEST
 
 bool TestNonLinearOptimizationObjectPoint::testNonLinearOptimizationObjectPointsPinholeCamera(const double testDuration, Worker* worker)
@@ -2848,6 +2877,148 @@ bool TestNonLinearOptimizationObjectPoint::testNonLinearOptimizationPosesObjectP
 	return allValidation.succeeded();
 }
 
+bool TestNonLinearOptimizationObjectPoint::testNonLinearOptimizationPosesObjectPointsSchurSolvers(const double testDuration, Worker* worker)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Optimization of 6DOF camera poses and 3D object point positions with individual Schur solvers:";
+	Log::info() << " ";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	const Box3 objectPointsArea(Vector3(-1, -1, -1), Vector3(1, 1, 1));
+
+	constexpr Scalar noiseStandardDeviation = Scalar(1);
+
+	const Geometry::NonLinearOptimizationObjectPoint::SchurSolver schurSolvers[3] =
+	{
+		Geometry::NonLinearOptimizationObjectPoint::SS_DENSE,
+		Geometry::NonLinearOptimizationObjectPoint::SS_BLOCK_SPARSE_DIRECT,
+		Geometry::NonLinearOptimizationObjectPoint::SS_BLOCK_SPARSE_CONJUGATE_GRADIENT
+	};
+
+	for (const unsigned int numberPoses : {20u, 50u})
+	{
+		for (const unsigned int numberObjectPoints : {50u, 200u})
+		{
+			Log::info() << "With " << numberPoses << " poses and " << numberObjectPoints << " object points:";
+
+			HighPerformanceStatistic performances[3];
+
+			const Timestamp startTimestamp(true);
+
+			do
+			{
+				const SharedAnyCamera camera = Utilities::realisticAnyCamera(AnyCameraType::PINHOLE, RandomI::random(randomGenerator, 1u));
+
+				const Quaternion orientation0(Random::quaternion(randomGenerator));
+				const Vector3 viewDirection0(orientation0 * Vector3(0, 0, -1));
+
+				const Vectors3 perfectObjectPoints(Utilities::objectPoints(objectPointsArea, numberObjectPoints));
+
+				const Scalar objectDimension = Box3(perfectObjectPoints).diagonal() * Scalar(0.01);
+
+				Vectors3 faultyObjectPoints;
+				faultyObjectPoints.reserve(perfectObjectPoints.size());
+
+				for (const Vector3& perfectObjectPoint : perfectObjectPoints)
+				{
+					faultyObjectPoints.emplace_back(perfectObjectPoint + Random::vector3(randomGenerator, -objectDimension, objectDimension));
+				}
+
+				Vectors3 allVisibleObjectPoints(perfectObjectPoints);
+				allVisibleObjectPoints.insert(allVisibleObjectPoints.end(), faultyObjectPoints.begin(), faultyObjectPoints.end());
+
+				HomogenousMatrices4 world_T_cameras;
+				world_T_cameras.emplace_back(Utilities::viewPosition(*camera, allVisibleObjectPoints, viewDirection0));
+
+				while (world_T_cameras.size() < numberPoses)
+				{
+					const Quaternion offsetRotation(Random::euler(randomGenerator, Numeric::deg2rad(5), Numeric::deg2rad(35)));
+					const Vector3 newViewDirection((orientation0 * offsetRotation) * Vector3(0, 0, -1));
+
+					world_T_cameras.emplace_back(Utilities::viewPosition(*camera, allVisibleObjectPoints, newViewDirection, true));
+				}
+
+				Vectors2 imagePoints;
+				imagePoints.reserve(numberPoses * numberObjectPoints);
+
+				for (const HomogenousMatrix4& world_T_camera : world_T_cameras)
+				{
+					for (const Vector3& perfectObjectPoint : perfectObjectPoints)
+					{
+						imagePoints.emplace_back(camera->projectToImage(world_T_camera, perfectObjectPoint) + Random::gaussianNoiseVector2(randomGenerator, noiseStandardDeviation, noiseStandardDeviation));
+					}
+				}
+
+				HomogenousMatrices4 world_T_faultyCameras(world_T_cameras);
+				for (HomogenousMatrix4& world_T_faultyCamera : world_T_faultyCameras)
+				{
+					const Vector3 faultyTranslation = Random::vector3(randomGenerator, -objectDimension, objectDimension) * Scalar(0.1);
+					const Euler faultyEuler(Random::euler(randomGenerator, Numeric::deg2rad(1), Numeric::deg2rad(5)));
+
+					world_T_faultyCamera *= HomogenousMatrix4(faultyTranslation, faultyEuler);
+				}
+
+				const Geometry::NonLinearOptimization::ObjectPointToPoseIndexImagePointCorrespondenceAccessor correspondenceGroups(faultyObjectPoints.size(), ConstTemplateArrayAccessor<Vector2>(imagePoints));
+
+				const Vector3 worldGravityInWorld(0, -1, 0);
+				const Geometry::GravityConstraints gravityConstraints(world_T_cameras, worldGravityInWorld);
+
+				const bool useGravityConstraints = RandomI::boolean(randomGenerator);
+				const Geometry::Estimator::EstimatorType estimatorType = RandomI::boolean(randomGenerator) ? Geometry::Estimator::ET_SQUARE : Geometry::Estimator::ET_HUBER;
+
+				Scalar initialErrors[3] = {Numeric::maxValue(), Numeric::maxValue(), Numeric::maxValue()};
+				Scalar finalErrors[3] = {Numeric::maxValue(), Numeric::maxValue(), Numeric::maxValue()};
+
+				HomogenousMatrices4 world_T_optimizedCameras[3];
+				Vectors3 optimizedObjectPoints[3];
+
+				for (unsigned int solverIndex = 0u; solverIndex < 3u; ++solverIndex)
+				{
+					world_T_optimizedCameras[solverIndex].resize(world_T_cameras.size());
+					NonconstArrayAccessor<HomogenousMatrix4> access_world_T_optimizedCameras(world_T_optimizedCameras[solverIndex]);
+
+					optimizedObjectPoints[solverIndex].resize(faultyObjectPoints.size());
+					NonconstArrayAccessor<Vector3> optimizedObjectPointAccessor(optimizedObjectPoints[solverIndex]);
+
+					Worker* useWorker = solverIndex == 0u ? nullptr : worker;
+
+					performances[solverIndex].start();
+						const bool result = Geometry::NonLinearOptimizationObjectPoint::optimizeObjectPointsAndPoses(*camera, ConstArrayAccessor<HomogenousMatrix4>(world_T_faultyCameras), ConstArrayAccessor<Vector3>(faultyObjectPoints), correspondenceGroups, &access_world_T_optimizedCameras, &optimizedObjectPointAccessor, 20u, estimatorType, Scalar(0.001), Scalar(5), true, &initialErrors[solverIndex], &finalErrors[solverIndex], nullptr, gravityConstraints.conditionalPointer(useGravityConstraints), false, schurSolvers[solverIndex], useWorker);
+					performances[solverIndex].stop();
+
+					OCEAN_EXPECT_TRUE(validation, result);
+				}
+
+				for (unsigned int solverIndex = 1u; solverIndex < 3u; ++solverIndex)
+				{
+					// all solvers start with the identical model, and must end with an (almost) identical error
+
+					OCEAN_EXPECT_TRUE(validation, Numeric::isWeakEqual(initialErrors[0], initialErrors[solverIndex]));
+
+					const Scalar errorThreshold = std::max(Scalar(0.01), finalErrors[0] * Scalar(0.05));
+
+					OCEAN_EXPECT_LESS_EQUAL(validation, Numeric::abs(finalErrors[0] - finalErrors[solverIndex]), errorThreshold);
+
+					OCEAN_EXPECT_LESS(validation, finalErrors[solverIndex], initialErrors[solverIndex]);
+				}
+			}
+			while (!startTimestamp.hasTimePassed(testDuration));
+
+			Log::info() << "Performance dense: " << performances[0];
+			Log::info() << "Performance block-sparse direct: " << performances[1];
+			Log::info() << "Performance block-sparse conjugate gradient: " << performances[2];
+			Log::info() << " ";
+		}
+	}
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
 bool TestNonLinearOptimizationObjectPoint::testNonLinearOptimizationOrientationalPosesObjectPoints(const double testDuration)
 {
 	ocean_assert(testDuration > 0.0);
@@ -3605,6 +3776,117 @@ bool TestNonLinearOptimizationObjectPoint::testClampDistantObjectPoints(const do
 	return validation.succeeded();
 }
 
+
+bool TestNonLinearOptimizationObjectPoint::testOptimizeObjectPointMixedPrecision(const double testDuration)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Mixed-precision optimization of an object point with float and double input, object point far away from the origin:";
+
+	constexpr unsigned int numberPoses = 10u;
+
+	RandomGenerator randomGenerator;
+
+	ValidationPrecision validation(0.95, randomGenerator);
+
+	HighPerformanceStatistic performanceFloat;
+	HighPerformanceStatistic performanceDouble;
+
+	double sumErrorFloat = 0.0;
+	double sumErrorDouble = 0.0;
+	unsigned int measurements = 0u;
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		for (const AnyCameraType anyCameraType : Utilities::realisticCameraTypes())
+		{
+			ValidationPrecision::ScopedIteration scopedIteration(validation);
+
+			const unsigned int cameraIndex = RandomI::random(randomGenerator, 1u);
+
+			const SharedAnyCameraD cameraD = Utilities::realisticAnyCamera<double>(anyCameraType, cameraIndex);
+			const SharedAnyCameraF cameraF = Utilities::realisticAnyCamera<float>(anyCameraType, cameraIndex);
+			ocean_assert(cameraD && cameraF);
+
+			// an object point far away from the origin, as e.g., in large scale maps
+
+			const VectorD3 objectPoint = RandomD::vector3(randomGenerator, -100.0, 100.0);
+
+			HomogenousMatricesF4 world_T_camerasF;
+			HomogenousMatricesD4 world_T_camerasD;
+			VectorsF2 imagePointsF;
+			VectorsD2 imagePointsD;
+
+			for (unsigned int n = 0u; n < numberPoses; ++n)
+			{
+				// each camera is looking roughly towards the object point, the object point does not lie on the principal axis
+
+				const VectorD3 viewingDirection = RandomD::vector3(randomGenerator);
+				const VectorD3 translation = objectPoint - viewingDirection * RandomD::scalar(randomGenerator, 1.0, 5.0) + RandomD::vector3(randomGenerator, -0.25, 0.25);
+
+				const QuaternionD rotation = QuaternionD(VectorD3(0, 0, -1), viewingDirection) * QuaternionD(VectorD3(0, 0, 1), RandomD::scalar(randomGenerator, -NumericD::pi(), NumericD::pi()));
+
+				const HomogenousMatrixD4 world_T_camera(translation, rotation);
+
+				// the poses are rounded to float, the image points are determined for the rounded poses
+
+				world_T_camerasF.emplace_back(world_T_camera);
+				world_T_camerasD.emplace_back(world_T_camerasF.back());
+
+				imagePointsD.emplace_back(cameraD->projectToImage(world_T_camerasD.back(), objectPoint));
+				imagePointsF.emplace_back(imagePointsD.back());
+			}
+
+			const VectorD3 roughObjectPoint = objectPoint + RandomD::vector3(randomGenerator, -0.1, 0.1);
+
+			VectorD3 optimizedObjectPointFloat(0, 0, 0);
+			VectorD3 optimizedObjectPointDouble(0, 0, 0);
+
+			performanceFloat.start();
+				const bool resultFloat = Geometry::NonLinearOptimizationObjectPoint::optimizeObjectPointForFixedPosesMixedPrecision<float>(*cameraF, ConstArrayAccessor<HomogenousMatrixF4>(world_T_camerasF), VectorF3(roughObjectPoint), ConstArrayAccessor<VectorF2>(imagePointsF), optimizedObjectPointFloat, 10u);
+			performanceFloat.stop();
+
+			performanceDouble.start();
+				const bool resultDouble = Geometry::NonLinearOptimizationObjectPoint::optimizeObjectPointForFixedPosesMixedPrecision<double>(*cameraD, ConstArrayAccessor<HomogenousMatrixD4>(world_T_camerasD), roughObjectPoint, ConstArrayAccessor<VectorD2>(imagePointsD), optimizedObjectPointDouble, 10u);
+			performanceDouble.stop();
+
+			if (!resultFloat || !resultDouble)
+			{
+				OCEAN_SET_FAILED(validation);
+				continue;
+			}
+
+			const double errorFloat = optimizedObjectPointFloat.distance(objectPoint);
+			const double errorDouble = optimizedObjectPointDouble.distance(objectPoint);
+
+			sumErrorFloat += errorFloat;
+			sumErrorDouble += errorDouble;
+			++measurements;
+
+			// the rough object point is rounded to float, however the optimized object point is not limited by the float precision
+
+			if (errorFloat > 0.001 || errorDouble > 0.0001)
+			{
+				scopedIteration.setInaccurate();
+			}
+		}
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	if (measurements != 0u)
+	{
+		Log::info() << "Average error: float input: " << String::toAString(sumErrorFloat / double(measurements), 6u) << ", double input: " << String::toAString(sumErrorDouble / double(measurements), 8u);
+	}
+
+	Log::info() << "Performance float: " << performanceFloat;
+	Log::info() << "Performance double: " << performanceDouble;
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
 }
 
 }
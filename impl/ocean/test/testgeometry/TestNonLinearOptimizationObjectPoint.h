@@ -218,6 +218,15 @@ class OCEAN_TEST_GEOMETRY_EXPORT TestNonLinearOptimizationObjectPoint : protecte
 		 */
 		static bool testNonLinearOptimizationPosesObjectPoints(const unsigned int numberPoses, const unsigned int numberObjectPoints, const double testDuration, const Geometry::Estimator::EstimatorType type, const Scalar noiseStandardDeviation = Scalar(0), const unsigned int numberOutliers = 0u);
 
+		/**
+		 * Tests the non linear optimization function for several 6DOF poses and several 3D object points with the individual solvers for the reduced camera system.
+		 * The results of the block-sparse solvers are compared with the results of the dense solver.
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @param worker Optional worker object to distribute the computation of the block-sparse solvers
+		 * @return True, if succeeded
+		 */
+		static bool testNonLinearOptimizationPosesObjectPointsSchurSolvers(const double testDuration, Worker* worker);
+
 		/**
 		 * Tests the non linear optimization function for several 6DOF poses (with fixed translations) and several 3D object points.
 		 * @param testDuration Number of seconds for each test, with range (0, infinity)
@@ -263,6 +272,13 @@ class OCEAN_TEST_GEOMETRY_EXPORT TestNonLinearOptimizationObjectPoint : protecte
 		 * @return True, if succeeded
 		 */
 		static bool testClampDistantObjectPoints(const double testDuration);
+
+		/**
+		 * Tests the mixed-precision optimization of an object point far away from the origin of the coordinate system for fixed camera poses.
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @return True, if succeeded
+		 */
+		static bool testOptimizeObjectPointMixedPrecision(const double testDuration);
 };
 
 }
@@ -59,6 +59,15 @@ bool TestNonLinearOptimizationPose::test(const double testDuration, Worker* /*wo
 	{
 		testResult = testNonLinearOptimizationPoseZoom(testDuration);
 
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
+	if (selector.shouldRun("nonlinearoptimizationposemixedprecision"))
+	{
+		testResult = testNonLinearOptimizationPoseMixedPrecision(testDuration);
+
 		Log::info() << " ";
 	}
 
@@ -111,6 +120,11 @@ TEST(TestNonLinearOptimizationPose, NonLinearOptimizationPoseAnyCamera_100Points
 	}
 }
 
+TEST(TestNonLinearOptimizationPose, NonLinearOptimizationPoseMixedPrecision)
+{
+	EXPECT_TRUE(TestNonLinearOptimizationPose::testNonLinearOptimizationPoseMixedPrecision(GTEST_TEST_DURATION));
+}
+
 #endif // OCEAN_USE_GTEST
 
 bool TestNonLinearOptimizationPose::testNonLinearOptimizationPosePinholeCamera(const double testDuration)
@@ -950,6 +964,173 @@ bool TestNonLinearOptimizationPose::testNonLinearOptimizationPoseZoom(const Pinh
 	return validation.succeeded();
 }
 
+
+bool TestNonLinearOptimizationPose::testNonLinearOptimizationPoseMixedPrecision(const double testDuration)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Mixed-precision optimization of the 6DOF pose with float and double input, camera far away from the origin:";
+
+	constexpr unsigned int correspondences = 100u;
+
+	RandomGenerator randomGenerator;
+
+	ValidationPrecision validation(0.95, randomGenerator);
+
+	HighPerformanceStatistic performanceFloat;
+	HighPerformanceStatistic performanceDouble;
+
+	double sumPixelErrorFloat = 0.0;
+	double sumPixelErrorDouble = 0.0;
+	double sumTranslationErrorFloat = 0.0;
+	double sumTranslationErrorDouble = 0.0;
+	unsigned int measurements = 0u;
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		for (const AnyCameraType anyCameraType : Utilities::realisticCameraTypes())
+		{
+			ValidationPrecision::ScopedIteration scopedIteration(validation);
+
+			const unsigned int cameraIndex = RandomI::random(randomGenerator, 1u);
+
+			const SharedAnyCameraD cameraD = Utilities::realisticAnyCamera<double>(anyCameraType, cameraIndex);
+			const SharedAnyCameraF cameraF = Utilities::realisticAnyCamera<float>(anyCameraType, cameraIndex);
+			ocean_assert(cameraD && cameraF);
+
+			// a camera pose far away from the origin, as e.g., in large scale maps
+
+			const VectorD3 translation = RandomD::vector3(randomGenerator, -100.0, 100.0);
+			const QuaternionD rotation = RandomD::quaternion(randomGenerator);
+
+			const HomogenousMatrixD4 world_T_camera(translation, rotation);
+
+			VectorsF3 objectPoints;
+			VectorsF2 imagePoints;
+
+			objectPoints.reserve(correspondences);
+			imagePoints.reserve(correspondences);
+
+			for (unsigned int n = 0u; n < correspondences; ++n)
+			{
+				const VectorD2 imagePoint(RandomD::scalar(randomGenerator, 5.0, double(cameraD->width() - 5u)), RandomD::scalar(randomGenerator, 5.0, double(cameraD->height() - 5u)));
+
+				const VectorD3 objectPoint = cameraD->ray(imagePoint, world_T_camera).point(RandomD::scalar(randomGenerator, 0.5, 5.0));
+
+				objectPoints.emplace_back(objectPoint);
+				imagePoints.emplace_back(imagePoint);
+			}
+
+			const VectorsD3 objectPointsD(objectPoints.cbegin(), objectPoints.cend());
+			const VectorsD2 imagePointsD(imagePoints.cbegin(), imagePoints.cend());
+
+			HomogenousMatrixD4 world_T_roughCamera(false);
+
+			while (true)
+			{
+				const VectorD3 roughTranslation = translation + RandomD::vector3(randomGenerator, -0.1, 0.1);
+				const QuaternionD roughRotation = rotation * QuaternionD(RandomD::vector3(randomGenerator), RandomD::scalar(randomGenerator, NumericD::deg2rad(-5.0), NumericD::deg2rad(5.0)));
+
+				world_T_roughCamera = HomogenousMatrixD4(roughTranslation, roughRotation);
+
+				// all object points must be located in front of the rough camera (wide-angle cameras are sensitive to this)
+
+				const HomogenousMatrixD4 flippedRoughCamera_T_world(AnyCameraD::standard2InvertedFlipped(world_T_roughCamera));
+
+				bool allInFront = true;
+
+				for (const VectorD3& objectPoint : objectPointsD)
+				{
+					if ((flippedRoughCamera_T_world * objectPoint).z() <= 0.1)
+					{
+						allInFront = false;
+						break;
+					}
+				}
+
+				if (allInFront)
+				{
+					break;
+				}
+			}
+
+			HomogenousMatrixD4 world_T_optimizedCameraFloat(false);
+			HomogenousMatrixD4 world_T_optimizedCameraDouble(false);
+
+			performanceFloat.start();
+				const bool resultFloat = Geometry::NonLinearOptimizationPose::optimizePoseMixedPrecision<float>(*cameraF, HomogenousMatrixF4(world_T_roughCamera), ConstArrayAccessor<VectorF3>(objectPoints), ConstArrayAccessor<VectorF2>(imagePoints), world_T_optimizedCameraFloat, 20u);
+			performanceFloat.stop();
+
+			performanceDouble.start();
+				const bool resultDouble = Geometry::NonLinearOptimizationPose::optimizePoseMixedPrecision<double>(*cameraD, world_T_roughCamera, ConstArrayAccessor<VectorD3>(objectPointsD), ConstArrayAccessor<VectorD2>(imagePointsD), world_T_optimizedCameraDouble, 20u);
+			performanceDouble.stop();
+
+			if (!resultFloat || !resultDouble)
+			{
+				OCEAN_SET_FAILED(validation);
+				continue;
+			}
+
+			double pixelErrorFloat = 0.0;
+			double pixelErrorDouble = 0.0;
+
+			for (size_t n = 0; n < objectPointsD.size(); ++n)
+			{
+				pixelErrorFloat += cameraD->projectToImage(world_T_optimizedCameraFloat, objectPointsD[n]).distance(imagePointsD[n]);
+				pixelErrorDouble += cameraD->projectToImage(world_T_optimizedCameraDouble, objectPointsD[n]).distance(imagePointsD[n]);
+			}
+
+			pixelErrorFloat /= double(objectPointsD.size());
+			pixelErrorDouble /= double(objectPointsD.size());
+
+			const double translationErrorFloat = world_T_optimizedCameraFloat.translation().distance(translation);
+			const double translationErrorDouble = world_T_optimizedCameraDouble.translation().distance(translation);
+
+			const double angleErrorFloat = world_T_optimizedCameraFloat.rotation().smallestAngle(rotation);
+			const double angleErrorDouble = world_T_optimizedCameraDouble.rotation().smallestAngle(rotation);
+
+			sumPixelErrorFloat += pixelErrorFloat;
+			sumPixelErrorDouble += pixelErrorDouble;
+			sumTranslationErrorFloat += translationErrorFloat;
+			sumTranslationErrorDouble += translationErrorDouble;
+			++measurements;
+
+			// the object points are rounded to float, so the reachable accuracy is limited by the input data,
+			// however the float optimization must not add any significant error compared to the double optimization
+
+			if (pixelErrorFloat > 0.1 || translationErrorFloat > 0.001 || angleErrorFloat > NumericD::deg2rad(0.05))
+			{
+				scopedIteration.setInaccurate();
+			}
+
+			if (pixelErrorDouble > 0.1 || translationErrorDouble > 0.001 || angleErrorDouble > NumericD::deg2rad(0.05))
+			{
+				scopedIteration.setInaccurate();
+			}
+
+			if (pixelErrorFloat > pixelErrorDouble + 0.01)
+			{
+				scopedIteration.setInaccurate();
+			}
+		}
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	if (measurements != 0u)
+	{
+		Log::info() << "Average pixel error: float input: " << String::toAString(sumPixelErrorFloat / double(measurements), 4u) << "px, double input: " << String::toAString(sumPixelErrorDouble / double(measurements), 6u) << "px";
+		Log::info() << "Average translation error: float input: " << String::toAString(sumTranslationErrorFloat / double(measurements), 6u) << ", double input: " << String::toAString(sumTranslationErrorDouble / double(measurements), 8u);
+	}
+
+	Log::info() << "Performance float: " << performanceFloat;
+	Log::info() << "Performance double: " << performanceDouble;
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
 }
 
 }
@@ -107,6 +107,13 @@ class OCEAN_TEST_GEOMETRY_EXPORT TestNonLinearOptimizationPose
 		 * @return True, if succeeded
 		 */
 		static bool testNonLinearOptimizationPoseZoom(const PinholeCamera& pinholeCamera, const unsigned int correspondences, const double testDuration, const Geometry::Estimator::EstimatorType type, const Scalar standardDeviation, const unsigned int outliers, const bool useCovariances);
+
+		/**
+		 * Tests the mixed-precision non linear optimization function for a 6DOF pose far away from the origin of the coordinate system.
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @return True, if succeeded
+		 */
+		static bool testNonLinearOptimizationPoseMixedPrecision(const double testDuration);
 };
 
 }
@@ -0,0 +1,574 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "ocean/test/testgeometry/TestNonLinearUniversalOptimizationDense.h"
+
+#include "ocean/base/RandomI.h"
+#include "ocean/base/StaticBuffer.h"
+#include "ocean/base/Timestamp.h"
+
+#include "ocean/geometry/NonLinearUniversalOptimizationDense.h"
+
+#include "ocean/math/ExponentialMap.h"
+#include "ocean/math/Random.h"
+#include "ocean/math/SquareMatrix3.h"
+
+#include "ocean/test/TestResult.h"
+#include "ocean/test/ValidationPrecision.h"
+
+namespace Ocean
+{
+
+namespace Test
+{
+
+namespace TestGeometry
+{
+
+/**
+ * This class implements the data for the optimization of a 2D similarity transformation mapping source points to target points.
+ * The internal model has the following four scalar values: rotation angle, logarithm of the scale, translation-x, translation-y.<br>
+ * The external model has the following six scalar values: the upper two rows of the 3x3 transformation matrix, row by row.
+ */
+class TestNonLinearUniversalOptimizationDense::SimilarityData
+{
+	public:
+
+		/**
+		 * Creates a new data object.
+		 * @param sourcePoints The source points
+		 * @param targetPoints The target points, one for each source point
+		 */
+		SimilarityData(const Vectors2& sourcePoints, const Vectors2& targetPoints) :
+			sourcePoints_(sourcePoints),
+			targetPoints_(targetPoints)
+		{
+			ocean_assert(sourcePoints_.size() == targetPoints_.size());
+		}
+
+		/**
+		 * Determines the value for a given model and measurement.
+		 * @param externalModel The external model
+		 * @param index The index of the measurement
+		 * @param result The resulting transformed source point
+		 */
+		void value(const StaticBuffer<Scalar, 6>& externalModel, const size_t index, StaticBuffer<Scalar, 2>& result)
+		{
+			const Vector2& sourcePoint = sourcePoints_[index];
+
+			result[0] = externalModel[0] * sourcePoint.x() + externalModel[1] * sourcePoint.y() + externalModel[2];
+			result[1] = externalModel[3] * sourcePoint.x() + externalModel[4] * sourcePoint.y() + externalModel[5];
+		}
+
+		/**
+		 * Determines the error for a given model and measurement.
+		 * @param externalModel The external model
+		 * @param index The index of the measurement
+		 * @param result The resulting error for each axis
+		 * @return True, always
+		 */
+		bool error(const StaticBuffer<Scalar, 6>& externalModel, const size_t index, StaticBuffer<Scalar, 2>& result)
+		{
+			value(externalModel, index, result);
+
+			result[0] -= targetPoints_[index].x();
+			result[1] -= targetPoints_[index].y();
+
+			return true;
+		}
+
+		/**
+		 * Transforms the internal model to the external model.
+		 * @param internalModel The internal model
+		 * @param externalModel The resulting external model
+		 */
+		void transformModel(StaticBuffer<Scalar, 4>& internalModel, StaticBuffer<Scalar, 6>& externalModel)
+		{
+			const Scalar scale = Numeric::exp(internalModel[1]);
+
+			const Scalar scaledCos = Numeric::cos(internalModel[0]) * scale;
+			const Scalar scaledSin = Numeric::sin(internalModel[0]) * scale;
+
+			externalModel[0] = scaledCos;
+			externalModel[1] = -scaledSin;
+			externalModel[2] = internalModel[2];
+			externalModel[3] = scaledSin;
+			externalModel[4] = scaledCos;
+			externalModel[5] = internalModel[3];
+		}
+
+	protected:
+
+		/// The source points.
+		const Vectors2& sourcePoints_;
+
+		/// The target points.
+		const Vectors2& targetPoints_;
+};
+
+/**
+ * This class implements the data for the optimization of a 3D rigid transformation mapping source points to target points.
+ * The internal model has the following six scalar values: rotation as exponential map (wx, wy, wz), translation (tx, ty, tz).<br>
+ * The external model has the following twelve scalar values: the upper three rows of the 4x4 transformation matrix, row by row.
+ */
+class TestNonLinearUniversalOptimizationDense::RigidData
+{
+	public:
+
+		/**
+		 * Creates a new data object.
+		 * @param sourcePoints The source points
+		 * @param targetPoints The target points, one for each source point
+		 */
+		RigidData(const Vectors3& sourcePoints, const Vectors3& targetPoints) :
+			sourcePoints_(sourcePoints),
+			targetPoints_(targetPoints)
+		{
+			ocean_assert(sourcePoints_.size() == targetPoints_.size());
+		}
+
+		/**
+		 * Determines the value for a given model and measurement.
+		 * @param externalModel The external model
+		 * @param index The index of the measurement
+		 * @param result The resulting transformed source point
+		 */
+		void value(const StaticBuffer<Scalar, 12>& externalModel, const size_t index, StaticBuffer<Scalar, 3>& result)
+		{
+			const Vector3& sourcePoint = sourcePoints_[index];
+
+			for (unsigned int row = 0u; row < 3u; ++row)
+			{
+				result[row] = externalModel[row * 4u + 0u] * sourcePoint.x() + externalModel[row * 4u + 1u] * sourcePoint.y() + externalModel[row * 4u + 2u] * sourcePoint.z() + externalModel[row * 4u + 3u];
+			}
+		}
+
+		/**
+		 * Determines the error for a given model and measurement.
+		 * @param externalModel The external model
+		 * @param index The index of the measurement
+		 * @param result The resulting error for each axis
+		 * @return True, always
+		 */
+		bool error(const StaticBuffer<Scalar, 12>& externalModel, const size_t index, StaticBuffer<Scalar, 3>& result)
+		{
+			value(externalModel, index, result);
+
+			for (unsigned int row = 0u; row < 3u; ++row)
+			{
+				result[row] -= targetPoints_[index][row];
+			}
+
+			return true;
+		}
+
+		/**
+		 * Transforms the internal model to the external model.
+		 * @param internalModel The internal model
+		 * @param externalModel The resulting external model
+		 */
+		void transformModel(StaticBuffer<Scalar, 6>& internalModel, StaticBuffer<Scalar, 12>& externalModel)
+		{
+			const SquareMatrix3 rotationMatrix(ExponentialMap(internalModel[0], internalModel[1], internalModel[2]).rotation());
+
+			for (unsigned int row = 0u; row < 3u; ++row)
+			{
+				for (unsigned int column = 0u; column < 3u; ++column)
+				{
+					externalModel[row * 4u + column] = rotationMatrix(row, column);
+				}
+
+				externalModel[row * 4u + 3u] = internalModel[3u + row];
+			}
+		}
+
+	protected:
+
+		/// The source points.
+		const Vectors3& sourcePoints_;
+
+		/// The target points.
+		const Vectors3& targetPoints_;
+};
+
+bool TestNonLinearUniversalOptimizationDense::test(const double testDuration, const TestSelector& selector)
+{
+	ocean_assert(testDuration > 0.0);
+
+	TestResult testResult("Universal dense non linear optimization test");
+
+	Log::info() << " ";
+
+	if (selector.shouldRun("similaritytransformation"))
+	{
+		testResult = testSimilarityTransformation(testDuration);
+
+		Log::info() << " ";
+	}
+
+	if (selector.shouldRun("rigidtransformation"))
+	{
+		testResult = testRigidTransformation(testDuration);
+
+		Log::info() << " ";
+	}
+
+	Log::info() << testResult;
+
+	return testResult.succeeded();
+}
+
+#ifdef OCEAN_USE_GTEST
+
+TEST(TestNonLinearUniversalOptimizationDense, SimilarityTransformation)
+{
+	EXPECT_TRUE(TestNonLinearUniversalOptimizationDense::testSimilarityTransformation(GTEST_TEST_DURATION));
+}
+
+TEST(TestNonLinearUniversalOptimizationDense, RigidTransformation)
+{
+	EXPECT_TRUE(TestNonLinearUniversalOptimizationDense::testRigidTransformation(GTEST_TEST_DURATION));
+}
+
+#endif // OCEAN_USE_GTEST
+
+bool TestNonLinearUniversalOptimizationDense::testSimilarityTransformation(const double testDuration)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Optimization of a 2D similarity transformation, fixed-size vs. dynamic implementation:";
+
+	using UniversalOptimization = Geometry::NonLinearUniversalOptimizationDense<4, 2, 6>;
+	static_assert(4u <= UniversalOptimization::maximalStaticModelSize, "The model must be optimized with the fixed-size implementation");
+
+	const Scalar threshold = std::is_same<Scalar, float>::value ? Scalar(0.01) : Scalar(0.0001);
+
+	RandomGenerator randomGenerator;
+	ValidationPrecision validation(0.95, randomGenerator);
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		ValidationPrecision::ScopedIteration scopedIteration(validation);
+
+		const Geometry::Estimator::EstimatorType estimator = randomEstimator(randomGenerator);
+
+		const size_t numberPoints = size_t(RandomI::random(randomGenerator, 10u, 200u));
+
+		UniversalOptimization::Model groundTruthModel;
+		groundTruthModel[0] = Random::scalar(randomGenerator, -Numeric::pi_4(), Numeric::pi_4());
+		groundTruthModel[1] = Random::scalar(randomGenerator, Scalar(-0.5), Scalar(0.5));
+		groundTruthModel[2] = Random::scalar(randomGenerator, Scalar(-10), Scalar(10));
+		groundTruthModel[3] = Random::scalar(randomGenerator, Scalar(-10), Scalar(10));
+
+		const bool useNoise = RandomI::boolean(randomGenerator);
+
+		Vectors2 sourcePoints;
+		Vectors2 targetPoints;
+
+		for (size_t n = 0; n < numberPoints; ++n)
+		{
+			sourcePoints.push_back(Random::vector2(randomGenerator, Scalar(-10), Scalar(10)));
+		}
+
+		targetPoints.resize(numberPoints);
+
+		SimilarityData similarityData(sourcePoints, targetPoints);
+
+		UniversalOptimization::ExternalModel groundTruthExternalModel;
+		similarityData.transformModel(groundTruthModel, groundTruthExternalModel);
+
+		for (size_t n = 0; n < numberPoints; ++n)
+		{
+			UniversalOptimization::Result targetPoint;
+			similarityData.value(groundTruthExternalModel, n, targetPoint);
+
+			targetPoints[n] = Vector2(targetPoint[0], targetPoint[1]);
+
+			if (useNoise)
+			{
+				targetPoints[n] += Random::gaussianNoiseVector2(randomGenerator, Scalar(0.1), Scalar(0.1));
+			}
+		}
+
+		if (!Geometry::Estimator::isStandardEstimator(estimator))
+		{
+			// 10% outliers for robust estimators
+
+			for (size_t n = 0; n < numberPoints / 10; ++n)
+			{
+				targetPoints[RandomI::random(randomGenerator, (unsigned int)(numberPoints) - 1u)] = Random::vector2(randomGenerator, Scalar(-20), Scalar(20));
+			}
+		}
+
+		UniversalOptimization::Model initialModel(groundTruthModel);
+		initialModel[0] += Random::scalar(randomGenerator, Scalar(-0.2), Scalar(0.2));
+		initialModel[1] += Random::scalar(randomGenerator, Scalar(-0.1), Scalar(0.1));
+		initialModel[2] += Random::scalar(randomGenerator, Scalar(-1), Scalar(1));
+		initialModel[3] += Random::scalar(randomGenerator, Scalar(-1), Scalar(1));
+
+		const unsigned int iterations = RandomI::random(randomGenerator, 1u, 20u);
+
+		UniversalOptimization::Model staticModel;
+		Scalar staticInitialError = Numeric::maxValue();
+		Scalar staticFinalError = Numeric::maxValue();
+		Scalars staticIntermediateErrors;
+
+		const bool staticResult = UniversalOptimization::optimizeUniversalModel(initialModel, numberPoints,
+										UniversalOptimization::ValueCallback::create(similarityData, &SimilarityData::value),
+										UniversalOptimization::ErrorCallback::create(similarityData, &SimilarityData::error),
+										UniversalOptimization::ModelTransformationCallback::create(similarityData, &SimilarityData::transformModel),
+										UniversalOptimization::ModelAdjustmentCallback(),
+										staticModel, iterations, estimator, Scalar(0.001), Scalar(5), &staticInitialError, &staticFinalError, &staticIntermediateErrors);
+
+		UniversalOptimization::Model dynamicModel;
+		Scalar dynamicInitialError = Numeric::maxValue();
+		Scalar dynamicFinalError = Numeric::maxValue();
+		Scalars dynamicIntermediateErrors;
+
+		const bool dynamicResult = UniversalOptimization::optimizeUniversalModelDynamic(initialModel, numberPoints,
+										UniversalOptimization::ValueCallback::create(similarityData, &SimilarityData::value),
+										UniversalOptimization::ErrorCallback::create(similarityData, &SimilarityData::error),
+										UniversalOptimization::ModelTransformationCallback::create(similarityData, &SimilarityData::transformModel),
+										UniversalOptimization::ModelAdjustmentCallback(),
+										dynamicModel, iterations, estimator, Scalar(0.001), Scalar(5), &dynamicInitialError, &dynamicFinalError, &dynamicIntermediateErrors);
+
+		OCEAN_EXPECT_EQUAL(validation, staticResult, dynamicResult);
+
+		if (staticResult && dynamicResult)
+		{
+			// both implementations start with the identical model and thus must determine the identical initial error
+
+			OCEAN_EXPECT_TRUE(validation, isAlmostEqual(staticInitialError, dynamicInitialError, threshold));
+
+			OCEAN_EXPECT_LESS_EQUAL(validation, staticFinalError, staticInitialError);
+
+			// the number of intermediate errors is not compared, close to convergence rounding differences decide whether one more iteration improves the error
+
+			if (!isAlmostEqual(staticFinalError, dynamicFinalError, threshold))
+			{
+				scopedIteration.setInaccurate();
+			}
+
+			for (unsigned int n = 0u; n < 4u; ++n)
+			{
+				if (!isAlmostEqual(staticModel[n], dynamicModel[n], threshold))
+				{
+					scopedIteration.setInaccurate();
+				}
+			}
+
+			if (!useNoise && Geometry::Estimator::isStandardEstimator(estimator) && iterations >= 10u)
+			{
+				// noise-free data must be fitted perfectly
+
+				for (unsigned int n = 0u; n < 4u; ++n)
+				{
+					if (!isAlmostEqual(staticModel[n], groundTruthModel[n], threshold))
+					{
+						scopedIteration.setInaccurate();
+					}
+				}
+			}
+		}
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
+bool TestNonLinearUniversalOptimizationDense::testRigidTransformation(const double testDuration)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Optimization of a 3D rigid transformation, fixed-size vs. dynamic implementation:";
+
+	using UniversalOptimization = Geometry::NonLinearUniversalOptimizationDense<6, 3, 12>;
+	static_assert(6u <= UniversalOptimization::maximalStaticModelSize, "The model must be optimized with the fixed-size implementation");
+
+	const Scalar threshold = std::is_same<Scalar, float>::value ? Scalar(0.01) : Scalar(0.0001);
+
+	RandomGenerator randomGenerator;
+	ValidationPrecision validation(0.95, randomGenerator);
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		ValidationPrecision::ScopedIteration scopedIteration(validation);
+
+		const Geometry::Estimator::EstimatorType estimator = randomEstimator(randomGenerator);
+
+		const size_t numberPoints = size_t(RandomI::random(randomGenerator, 10u, 200u));
+
+		const ExponentialMap groundTruthRotation(Random::rotation(randomGenerator));
+		const Vector3 groundTruthTranslation(Random::vector3(randomGenerator, Scalar(-10), Scalar(10)));
+
+		UniversalOptimization::Model groundTruthModel;
+		for (unsigned int n = 0u; n < 3u; ++n)
+		{
+			groundTruthModel[n] = groundTruthRotation[n];
+			groundTruthModel[3u + n] = groundTruthTranslation[n];
+		}
+
+		const bool useNoise = RandomI::boolean(randomGenerator);
+
+		Vectors3 sourcePoints;
+		Vectors3 targetPoints;
+
+		for (size_t n = 0; n < numberPoints; ++n)
+		{
+			sourcePoints.push_back(Random::vector3(randomGenerator, Scalar(-10), Scalar(10)));
+		}
+
+		targetPoints.resize(numberPoints);
+
+		RigidData rigidData(sourcePoints, targetPoints);
+
+		UniversalOptimization::ExternalModel groundTruthExternalModel;
+		rigidData.transformModel(groundTruthModel, groundTruthExternalModel);
+
+		for (size_t n = 0; n < numberPoints; ++n)
+		{
+			UniversalOptimization::Result targetPoint;
+			rigidData.value(groundTruthExternalModel, n, targetPoint);
+
+			targetPoints[n] = Vector3(targetPoint[0], targetPoint[1], targetPoint[2]);
+
+			if (useNoise)
+			{
+				targetPoints[n] += Vector3(Random::gaussianNoise(randomGenerator, Scalar(0.1)), Random::gaussianNoise(randomGenerator, Scalar(0.1)), Random::gaussianNoise(randomGenerator, Scalar(0.1)));
+			}
+		}
+
+		if (!Geometry::Estimator::isStandardEstimator(estimator))
+		{
+			// 10% outliers for robust estimators
+
+			for (size_t n = 0; n < numberPoints / 10; ++n)
+			{
+				targetPoints[RandomI::random(randomGenerator, (unsigned int)(numberPoints) - 1u)] = Random::vector3(randomGenerator, Scalar(-20), Scalar(20));
+			}
+		}
+
+		// the initial model is rotated by at most 10 degree and translated by at most 1
+
+		const ExponentialMap initialRotation(Rotation(Random::vector3(randomGenerator), Random::scalar(randomGenerator, 0, Numeric::deg2rad(10))) * groundTruthRotation.rotation());
+
+		UniversalOptimization::Model initialModel;
+		for (unsigned int n = 0u; n < 3u; ++n)
+		{
+			initialModel[n] = initialRotation[n];
+			initialModel[3u + n] = groundTruthTranslation[n] + Random::scalar(randomGenerator, Scalar(-1), Scalar(1));
+		}
+
+		const unsigned int iterations = RandomI::random(randomGenerator, 1u, 20u);
+
+		UniversalOptimization::Model staticModel;
+		Scalar staticInitialError = Numeric::maxValue();
+		Scalar staticFinalError = Numeric::maxValue();
+		Scalars staticIntermediateErrors;
+
+		const bool staticResult = UniversalOptimization::optimizeUniversalModel(initialModel, numberPoints,
+										UniversalOptimization::ValueCallback::create(rigidData, &RigidData::value),
+										UniversalOptimization::ErrorCallback::create(rigidData, &RigidData::error),
+										UniversalOptimization::ModelTransformationCallback::create(rigidData, &RigidData::transformModel),
+										UniversalOptimization::ModelAdjustmentCallback(),
+										staticModel, iterations, estimator, Scalar(0.001), Scalar(5), &staticInitialError, &staticFinalError, &staticIntermediateErrors);
+
+		UniversalOptimization::Model dynamicModel;
+		Scalar dynamicInitialError = Numeric::maxValue();
+		Scalar dynamicFinalError = Numeric::maxValue();
+		Scalars dynamicIntermediateErrors;
+
+		const bool dynamicResult = UniversalOptimization::optimizeUniversalModelDynamic(initialModel, numberPoints,
+										UniversalOptimization::ValueCallback::create(rigidData, &RigidData::value),
+										UniversalOptimization::ErrorCallback::create(rigidData, &RigidData::error),
+										UniversalOptimization::ModelTransformationCallback::create(rigidData, &RigidData::transformModel),
+										UniversalOptimization::ModelAdjustmentCallback(),
+										dynamicModel, iterations, estimator, Scalar(0.001), Scalar(5), &dynamicInitialError, &dynamicFinalError, &dynamicIntermediateErrors);
+
+		OCEAN_EXPECT_EQUAL(validation, staticResult, dynamicResult);
+
+		if (staticResult && dynamicResult)
+		{
+			OCEAN_EXPECT_TRUE(validation, isAlmostEqual(staticInitialError, dynamicInitialError, threshold));
+
+			OCEAN_EXPECT_LESS_EQUAL(validation, staticFinalError, staticInitialError);
+
+			// the number of intermediate errors is not compared, close to convergence rounding differences decide whether one more iteration improves the error
+
+			if (!isAlmostEqual(staticFinalError, dynamicFinalError, threshold))
+			{
+				scopedIteration.setInaccurate();
+			}
+
+			for (unsigned int n = 0u; n < 6u; ++n)
+			{
+				if (!isAlmostEqual(staticModel[n], dynamicModel[n], threshold))
+				{
+					scopedIteration.setInaccurate();
+				}
+			}
+
+			if (!useNoise && Geometry::Estimator::isStandardEstimator(estimator) && iterations >= 10u)
+			{
+				// noise-free data must be fitted perfectly, the rotations are compared as the exponential map is not unique
+
+				const Quaternion staticRotation = ExponentialMap(staticModel[0], staticModel[1], staticModel[2]).quaternion();
+
+				if (Numeric::rad2deg(staticRotation.smallestAngle(groundTruthRotation.quaternion())) > Scalar(0.1))
+				{
+					scopedIteration.setInaccurate();
+				}
+
+				for (unsigned int n = 3u; n < 6u; ++n)
+				{
+					if (!isAlmostEqual(staticModel[n], groundTruthModel[n], threshold))
+					{
+						scopedIteration.setInaccurate();
+					}
+				}
+			}
+		}
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
+Geometry::Estimator::EstimatorType TestNonLinearUniversalOptimizationDense::randomEstimator(RandomGenerator& randomGenerator)
+{
+	const std::vector<Geometry::Estimator::EstimatorType> estimators =
+	{
+		Geometry::Estimator::ET_SQUARE,
+		Geometry::Estimator::ET_LINEAR,
+		Geometry::Estimator::ET_HUBER,
+		Geometry::Estimator::ET_TUKEY,
+		Geometry::Estimator::ET_CAUCHY
+	};
+
+	return RandomI::random(randomGenerator, estimators);
+}
+
+bool TestNonLinearUniversalOptimizationDense::isAlmostEqual(const Scalar valueA, const Scalar valueB, const Scalar threshold)
+{
+	ocean_assert(threshold >= Scalar(0));
+
+	return Numeric::abs(valueA - valueB) <= threshold * std::max(Scalar(1), std::max(Numeric::abs(valueA), Numeric::abs(valueB)));
+}
+
+}
+
+}
+
+}
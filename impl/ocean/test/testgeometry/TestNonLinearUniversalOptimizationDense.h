@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#ifndef META_OCEAN_TEST_TESTGEOMETRY_TEST_NON_LINEAR_UNIVERSAL_OPTIMIZATION_DENSE_H
+#define META_OCEAN_TEST_TESTGEOMETRY_TEST_NON_LINEAR_UNIVERSAL_OPTIMIZATION_DENSE_H
+
+#include "ocean/test/testgeometry/TestGeometry.h"
+
+#include "ocean/base/RandomGenerator.h"
+
+#include "ocean/geometry/Estimator.h"
+
+#include "ocean/test/TestSelector.h"
+
+namespace Ocean
+{
+
+namespace Test
+{
+
+namespace TestGeometry
+{
+
+/**
+ * This class tests the universal dense non linear optimization, the fixed-size implementation for small models is validated against the dynamic implementation.
+ * @ingroup testgeometry
+ */
+class OCEAN_TEST_GEOMETRY_EXPORT TestNonLinearUniversalOptimizationDense
+{
+	protected:
+
+		/**
+		 * Forward declaration of the data class for a 2D similarity transformation.
+		 */
+		class SimilarityData;
+
+		/**
+		 * Forward declaration of the data class for a 3D rigid transformation.
+		 */
+		class RigidData;
+
+	public:
+
+		/**
+		 * Tests the universal dense non linear optimization.
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @param selector Selector for sub-tests
+		 * @return True, if succeeded
+		 */
+		static bool test(const double testDuration, const TestSelector& selector);
+
+		/**
+		 * Tests the optimization of a 2D similarity transformation with 4 internal and 6 external model parameters.
+		 * The fixed-size implementation must provide the same result as the dynamic implementation.
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @return True, if succeeded
+		 */
+		static bool testSimilarityTransformation(const double testDuration);
+
+		/**
+		 * Tests the optimization of a 3D rigid transformation with 6 internal and 12 external model parameters.
+		 * The fixed-size implementation must provide the same result as the dynamic implementation.
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @return True, if succeeded
+		 */
+		static bool testRigidTransformation(const double testDuration);
+
+	protected:
+
+		/**
+		 * Returns a random estimator.
+		 * @param randomGenerator The random generator to be used
+		 * @return The random estimator
+		 */
+		static Geometry::Estimator::EstimatorType randomEstimator(RandomGenerator& randomGenerator);
+
+		/**
+		 * Returns whether two scalar values are almost identical, the threshold is relative for large values.
+		 * @param valueA The first value
+		 * @param valueB The second value
+		 * @param threshold The maximal difference between both values, with range [0, infinity)
+		 * @return True, if so
+		 */
+		static bool isAlmostEqual(const Scalar valueA, const Scalar valueB, const Scalar threshold);
+};
+
+}
+
+}
+
+}
+
+#endif // META_OCEAN_TEST_TESTGEOMETRY_TEST_NON_LINEAR_UNIVERSAL_OPTIMIZATION_DENSE_H
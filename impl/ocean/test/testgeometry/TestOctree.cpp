@@ -9,6 +9,7 @@
 
 #include "ocean/base/HighPerformanceTimer.h"
 #include "ocean/base/Timestamp.h"
+#include "ocean/base/WorkerPool.h"
 
 #include "ocean/geometry/Octree.h"
 
@@ -52,6 +53,15 @@ bool TestOctree::test(const double testDuration, const TestSelector& selector)
 		Log::info() << " ";
 	}
 
+	if (selector.shouldRun("batchedclosestpoints"))
+	{
+		testResult = testBatchedClosestPoints(testDuration);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
 	if (selector.shouldRun("intersectingleavesforrays"))
 	{
 		testResult = testIntersectingLeavesForRays(testDuration);
@@ -85,6 +95,11 @@ TEST(TestOctree, ClosestPoints)
 	EXPECT_TRUE(TestOctree::testClosestPoints(GTEST_TEST_DURATION));
 }
 
+TEST(TestOctree, BatchedClosestPoints)
+{
+	EXPECT_TRUE(TestOctree::testBatchedClosestPoints(GTEST_TEST_DURATION));
+}
+
 TEST(TestOctree, IntersectingLeavesForRays)
 {
 	EXPECT_TRUE(TestOctree::testIntersectingLeavesForRays(GTEST_TEST_DURATION));
@@ -362,6 +377,154 @@ bool TestOctree::testClosestPoints(const double testDuration)
 	return validation.succeeded();
 }
 
+bool TestOctree::testBatchedClosestPoints(const double testDuration)
+{
+	ocean_assert(testDuration > 0.0);
+
+#ifdef OCEAN_DEBUG
+	constexpr unsigned int benchmarkTreePointNumber = 50000u;
+	constexpr unsigned int benchmarkQueryPointNumber = 5000u;
+#else
+	constexpr unsigned int benchmarkTreePointNumber = 500000u;
+	constexpr unsigned int benchmarkQueryPointNumber = 50000u;
+#endif
+
+	Log::info() << "Test batched closestPoints() with " << benchmarkTreePointNumber << " tree points, and " << benchmarkQueryPointNumber << " query points:";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	HighPerformanceStatistic performanceSingleConstruction;
+	HighPerformanceStatistic performanceMultiConstruction;
+
+	HighPerformanceStatistic performanceIndividualQueries;
+	HighPerformanceStatistic performanceBatchedSingleCore;
+	HighPerformanceStatistic performanceBatchedMultiCore;
+
+	const WorkerPool::ScopedWorker scopedWorker(WorkerPool::get().scopedWorker());
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		for (const bool benchmarkIteration : {false, true})
+		{
+			const unsigned int numberTreePoints = benchmarkIteration ? benchmarkTreePointNumber : RandomI::random(randomGenerator, 1u, 100000u);
+			const unsigned int numberQueryPoints = benchmarkIteration ? benchmarkQueryPointNumber : RandomI::random(randomGenerator, 1u, benchmarkQueryPointNumber);
+
+			Vectors3 treePoints(numberTreePoints);
+			for (Vector3& treePoint : treePoints)
+			{
+				treePoint = Random::vector3(randomGenerator, Scalar(-100), Scalar(100));
+			}
+
+			Vectors3 queryPoints(numberQueryPoints);
+			for (Vector3& queryPoint : queryPoints)
+			{
+				queryPoint = Random::vector3(randomGenerator, Scalar(-110), Scalar(110));
+			}
+
+			const Scalar maximalDistance = benchmarkIteration ? Scalar(2) : Random::scalar(randomGenerator, Scalar(0.1), Scalar(10));
+
+			const bool useTightBoundingBoxes = RandomI::boolean(randomGenerator);
+			const Geometry::Octree::Parameters parameters(RandomI::random(randomGenerator, 1u, 64u), useTightBoundingBoxes);
+
+			performanceSingleConstruction.startIf(benchmarkIteration);
+				const Geometry::Octree octree(treePoints.data(), treePoints.size(), parameters);
+			performanceSingleConstruction.stopIf(benchmarkIteration);
+
+			performanceMultiConstruction.startIf(benchmarkIteration);
+				const Geometry::Octree parallelOctree(treePoints.data(), treePoints.size(), parameters, scopedWorker());
+			performanceMultiConstruction.stopIf(benchmarkIteration);
+
+			// both trees must have an identical structure
+
+			std::vector<std::pair<const Geometry::Octree*, const Geometry::Octree*>> nodePairs(1, std::make_pair(&octree, &parallelOctree));
+
+			while (!nodePairs.empty())
+			{
+				const Geometry::Octree* node = nodePairs.back().first;
+				const Geometry::Octree* parallelNode = nodePairs.back().second;
+				nodePairs.pop_back();
+
+				OCEAN_EXPECT_EQUAL(validation, node->isValid(), parallelNode->isValid());
+
+				if (node->isValid() && parallelNode->isValid())
+				{
+					OCEAN_EXPECT_TRUE(validation, node->boundingBox() == parallelNode->boundingBox());
+				}
+
+				OCEAN_EXPECT_TRUE(validation, node->pointIndices() == parallelNode->pointIndices());
+
+				if (node->childNodes() != nullptr && parallelNode->childNodes() != nullptr)
+				{
+					for (size_t n = 0; n < 8; ++n)
+					{
+						nodePairs.emplace_back(node->childNodes()[n], parallelNode->childNodes()[n]);
+					}
+				}
+				else
+				{
+					OCEAN_EXPECT_TRUE(validation, node->childNodes() == nullptr && parallelNode->childNodes() == nullptr);
+				}
+			}
+
+			std::vector<Indices32> individualPointIndicesGroups(numberQueryPoints);
+
+			performanceIndividualQueries.startIf(benchmarkIteration);
+
+				Geometry::Octree::ReusableData reusableData;
+
+				for (unsigned int nQuery = 0u; nQuery < numberQueryPoints; ++nQuery)
+				{
+					octree.closestPoints(treePoints.data(), queryPoints[nQuery], maximalDistance, individualPointIndicesGroups[nQuery], nullptr, reusableData);
+				}
+
+			performanceIndividualQueries.stopIf(benchmarkIteration);
+
+			for (const bool useWorker : {false, true})
+			{
+				HighPerformanceStatistic& performance = useWorker ? performanceBatchedMultiCore : performanceBatchedSingleCore;
+
+				std::vector<Indices32> batchedPointIndicesGroups;
+
+				performance.startIf(benchmarkIteration);
+					octree.closestPoints(treePoints.data(), queryPoints.data(), queryPoints.size(), maximalDistance, batchedPointIndicesGroups, useWorker ? scopedWorker() : nullptr);
+				performance.stopIf(benchmarkIteration);
+
+				OCEAN_EXPECT_EQUAL(validation, batchedPointIndicesGroups.size(), size_t(numberQueryPoints));
+
+				if (batchedPointIndicesGroups.size() == size_t(numberQueryPoints))
+				{
+					for (unsigned int nQuery = 0u; nQuery < numberQueryPoints; ++nQuery)
+					{
+						Indices32 batchedPointIndices(batchedPointIndicesGroups[nQuery]);
+						Indices32 individualPointIndices(individualPointIndicesGroups[nQuery]);
+
+						std::sort(batchedPointIndices.begin(), batchedPointIndices.end());
+						std::sort(individualPointIndices.begin(), individualPointIndices.end());
+
+						OCEAN_EXPECT_TRUE(validation, batchedPointIndices == individualPointIndices);
+					}
+				}
+			}
+		}
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Construction performance, single-core: " << performanceSingleConstruction;
+	Log::info() << "Construction performance, multi-core: " << performanceMultiConstruction;
+	Log::info() << " ";
+	Log::info() << "Individual queries performance: " << performanceIndividualQueries;
+	Log::info() << "Batched queries performance, single-core: " << performanceBatchedSingleCore;
+	Log::info() << "Batched queries performance, multi-core: " << performanceBatchedMultiCore;
+
+	Log::info() << " ";
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
 bool TestOctree::testIntersectingLeavesForRays(const double testDuration)
 {
 	ocean_assert(testDuration > 0.0);
@@ -53,6 +53,13 @@ class OCEAN_TEST_GEOMETRY_EXPORT TestOctree
 		 */
 		static bool testClosestPoints(const double testDuration);
 
+		/**
+		 * Tests the batched closestPoints() function and the construction of the tree with a worker.
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @return True, if succeeded
+		 */
+		static bool testBatchedClosestPoints(const double testDuration);
+
 		/**
 		 * Tests the intersectingLeaves() function for rays.
 		 * @param testDuration Number of seconds for each test, with range (0, infinity)
@@ -83,6 +83,21 @@ bool TestP3P::test(const double testDuration, const TestSelector& selector)
 		Log::info() << " ";
 		testResult = testP3PWithRaysStressTest<double>(testDuration);
 
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
+	if (selector.shouldRun("p3pbatch"))
+	{
+		testResult = testP3PBatch<float, 4>(testDuration);
+		Log::info() << " ";
+		testResult = testP3PBatch<float, 8>(testDuration);
+		Log::info() << " ";
+		testResult = testP3PBatch<double, 4>(testDuration);
+		Log::info() << " ";
+		testResult = testP3PBatch<double, 8>(testDuration);
+
 		Log::info() << " ";
 	}
 
@@ -136,6 +151,27 @@ TEST(TestP3P, P3PWithRaysStressTest_double)
 	EXPECT_TRUE(TestP3P::testP3PWithRaysStressTest<double>(GTEST_TEST_DURATION));
 }
 
+
+TEST(TestP3P, P3PBatch_float_4)
+{
+	EXPECT_TRUE((TestP3P::testP3PBatch<float, 4>(GTEST_TEST_DURATION)));
+}
+
+TEST(TestP3P, P3PBatch_float_8)
+{
+	EXPECT_TRUE((TestP3P::testP3PBatch<float, 8>(GTEST_TEST_DURATION)));
+}
+
+TEST(TestP3P, P3PBatch_double_4)
+{
+	EXPECT_TRUE((TestP3P::testP3PBatch<double, 4>(GTEST_TEST_DURATION)));
+}
+
+TEST(TestP3P, P3PBatch_double_8)
+{
+	EXPECT_TRUE((TestP3P::testP3PBatch<double, 8>(GTEST_TEST_DURATION)));
+}
+
 #endif // OCEAN_USE_GTEST
 
 template <typename T>
@@ -233,6 +269,9 @@ bool TestP3P::testP3PWithPoints(const double testDuration)
 
 					const T pixelErrorThreshold = std::is_same<T, double>::value ? T(0.9) : T(5);
 
+	// the poses of both functions are not bit-exact, float poses can differ noticeably for ill-conditioned samples
+	const T translationThreshold = std::is_same<T, double>::value ? T(0.01) : T(0.1);
+
 					if (maximalError >= pixelErrorThreshold)
 					{
 						scopedIteration.setInaccurate();
@@ -424,6 +463,9 @@ bool TestP3P::testP3PWithRays(const double testDuration)
 
 				const T pixelErrorThreshold = std::is_same<T, double>::value ? T(0.9) : T(5);
 
+	// the poses of both functions are not bit-exact, float poses can differ noticeably for ill-conditioned samples
+	const T translationThreshold = std::is_same<T, double>::value ? T(0.01) : T(0.1);
+
 				if (maximalError >= pixelErrorThreshold)
 				{
 					scopedIteration.setInaccurate();
@@ -578,6 +620,168 @@ bool TestP3P::testP3PWithRaysStressTest(const double testDuration)
 	return validation.succeeded();
 }
 
+template <typename T, size_t tBatchSize>
+bool TestP3P::testP3PBatch(const double testDuration)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Testing batched P3P with " << tBatchSize << " samples for '" << TypeNamer::name<T>() << "':";
+
+	RandomGenerator randomGenerator;
+
+	constexpr double successThreshold = std::is_same<T, float>::value ? 0.75 : 0.95;
+	ValidationPrecision validation(successThreshold, randomGenerator);
+
+	HighPerformanceStatistic performanceSingle;
+	HighPerformanceStatistic performanceBatch;
+
+	const AnyCameraPinholeT<T> camera(PinholeCameraT<T>(640u, 480u, NumericT<T>::deg2rad(60)));
+
+	const T pixelErrorThreshold = std::is_same<T, double>::value ? T(0.9) : T(5);
+
+	// the poses of both functions are not bit-exact, float poses can differ noticeably for ill-conditioned samples
+	const T translationThreshold = std::is_same<T, double>::value ? T(0.01) : T(0.1);
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		HomogenousMatricesT4<T> world_T_cameras(tBatchSize);
+
+		VectorsT3<T> objectPoints(tBatchSize * 3);
+		VectorsT3<T> imageRays(tBatchSize * 3);
+		VectorsT2<T> imagePoints(tBatchSize * 3);
+
+		for (size_t sample = 0; sample < tBatchSize; ++sample)
+		{
+			world_T_cameras[sample] = HomogenousMatrixT4<T>(RandomT<T>::vector3(randomGenerator, T(-10), T(10)), RandomT<T>::quaternion(randomGenerator));
+
+			while (true)
+			{
+				for (size_t n = 0; n < 3; ++n)
+				{
+					imagePoints[sample * 3 + n] = RandomT<T>::vector2(randomGenerator, T(10), T(camera.width() - 10u), T(10), T(camera.height() - 10u));
+				}
+
+				// the image points must not be collinear
+
+				bool imagePointsCollinear = false;
+
+				for (size_t n = 0; n < 3; ++n)
+				{
+					const VectorT2<T>& imagePoint0 = imagePoints[sample * 3 + n];
+					const VectorT2<T>& imagePoint1 = imagePoints[sample * 3 + (n + 1) % 3];
+					const VectorT2<T>& imagePoint2 = imagePoints[sample * 3 + (n + 2) % 3];
+
+					if (imagePoint0.distance(imagePoint1) < T(20) || LineT2<T>(imagePoint0, (imagePoint1 - imagePoint0).normalized()).distance(imagePoint2) < T(20))
+					{
+						imagePointsCollinear = true;
+					}
+				}
+
+				if (!imagePointsCollinear)
+				{
+					break;
+				}
+			}
+
+			for (size_t n = 0; n < 3; ++n)
+			{
+				imageRays[sample * 3 + n] = camera.vector(imagePoints[sample * 3 + n]);
+				objectPoints[sample * 3 + n] = world_T_cameras[sample] * (imageRays[sample * 3 + n] * RandomT<T>::scalar(randomGenerator, T(1), T(10)));
+			}
+		}
+
+		HomogenousMatrixT4<T> world_T_singleCameras[tBatchSize * 4];
+		unsigned int numberSinglePoses[tBatchSize];
+
+		performanceSingle.start();
+			for (size_t sample = 0; sample < tBatchSize; ++sample)
+			{
+				numberSinglePoses[sample] = Geometry::P3P::poses<T>(objectPoints.data() + sample * 3, imageRays.data() + sample * 3, world_T_singleCameras + sample * 4);
+			}
+		performanceSingle.stop();
+
+		HomogenousMatrixT4<T> world_T_batchCameras[tBatchSize * 4];
+		unsigned int numberBatchPoses[tBatchSize];
+
+		performanceBatch.start();
+			const unsigned int overallBatchPoses = Geometry::P3P::posesBatch<T, tBatchSize>(objectPoints.data(), imageRays.data(), world_T_batchCameras, numberBatchPoses);
+		performanceBatch.stop();
+
+		unsigned int debugOverallBatchPoses = 0u;
+
+		for (size_t sample = 0; sample < tBatchSize; ++sample)
+		{
+			ValidationPrecision::ScopedIteration scopedIteration(validation);
+
+			OCEAN_EXPECT_LESS_EQUAL(validation, numberBatchPoses[sample], 4u);
+
+			debugOverallBatchPoses += numberBatchPoses[sample];
+
+			const HomogenousMatrixT4<T>* world_T_sampleBatchCameras = world_T_batchCameras + sample * 4;
+			const HomogenousMatrixT4<T>* world_T_sampleSingleCameras = world_T_singleCameras + sample * 4;
+
+			// one of the resulting poses must match the random pose
+
+			bool oneBatchPoseIsAccurate = false;
+
+			for (unsigned int n = 0u; n < numberBatchPoses[sample]; ++n)
+			{
+				T maximalError = T(0);
+
+				for (size_t i = 0; i < 3; ++i)
+				{
+					maximalError = std::max(maximalError, imagePoints[sample * 3 + i].distance(camera.projectToImage(world_T_sampleBatchCameras[n], objectPoints[sample * 3 + i])));
+				}
+
+				if (maximalError < pixelErrorThreshold && world_T_sampleBatchCameras[n].translation().distance(world_T_cameras[sample].translation()) < T(0.1))
+				{
+					oneBatchPoseIsAccurate = true;
+				}
+			}
+
+			if (!oneBatchPoseIsAccurate)
+			{
+				scopedIteration.setInaccurate();
+			}
+
+			// each pose of the single-sample function must be part of the batch poses as well
+
+			for (unsigned int nSingle = 0u; nSingle < numberSinglePoses[sample]; ++nSingle)
+			{
+				bool foundPose = false;
+
+				for (unsigned int nBatch = 0u; nBatch < numberBatchPoses[sample]; ++nBatch)
+				{
+					const T translationDistance = world_T_sampleSingleCameras[nSingle].translation().distance(world_T_sampleBatchCameras[nBatch].translation());
+					const T angle = world_T_sampleSingleCameras[nSingle].rotation().smallestAngle(world_T_sampleBatchCameras[nBatch].rotation());
+
+					if (translationDistance < translationThreshold && angle < NumericT<T>::deg2rad(T(0.5)))
+					{
+						foundPose = true;
+						break;
+					}
+				}
+
+				if (!foundPose)
+				{
+					scopedIteration.setInaccurate();
+				}
+			}
+		}
+
+		OCEAN_EXPECT_EQUAL(validation, overallBatchPoses, debugOverallBatchPoses);
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Performance " << tBatchSize << "x single: " << performanceSingle;
+	Log::info() << "Performance batch: " << performanceBatch;
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
 template <typename T>
 VectorT3<T> TestP3P::randomVector(RandomGenerator& randomGenerator)
 {
@@ -79,6 +79,16 @@ class OCEAN_TEST_GEOMETRY_EXPORT TestP3P
 		template <typename T>
 		static bool testP3PWithRaysStressTest(const double testDuration);
 
+		/**
+		 * Tests the batched perspective pose problem for several samples with three rays each.
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @return True, if succeeded
+		 * @tparam T The floating point data type to be used for testing
+		 * @tparam tBatchSize The number of samples in each batch, with range [1, infinity)
+		 */
+		template <typename T, size_t tBatchSize>
+		static bool testP3PBatch(const double testDuration);
+
 	private:
 
 		/**
@@ -54,6 +54,15 @@ bool TestRANSAC::test(const double testDuration, Worker& worker, const TestSelec
 		Log::info() << " ";
 	}
 
+	if (selector.shouldRun("p3ppreemptive"))
+	{
+		testResult = testP3PPreemptive(testDuration, worker);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
 	if (selector.shouldRun("p3pzoom"))
 	{
 		testResult = testP3PZoom(testDuration);
@@ -72,6 +81,15 @@ bool TestRANSAC::test(const double testDuration, Worker& worker, const TestSelec
 		Log::info() << " ";
 	}
 
+	if (selector.shouldRun("objectpoints"))
+	{
+		testResult = testObjectPoints(testDuration, worker);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
 	if (selector.shouldRun("homographymatrix"))
 	{
 		testResult = testHomographyMatrix(testDuration, worker);
@@ -81,6 +99,15 @@ bool TestRANSAC::test(const double testDuration, Worker& worker, const TestSelec
 		Log::info() << " ";
 	}
 
+	if (selector.shouldRun("homographymatrixpreemptive"))
+	{
+		testResult = testHomographyMatrixPreemptive(testDuration, worker);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
 	if (selector.shouldRun("homographymatrixfornonbijectivecorrespondences"))
 	{
 		testResult = testHomographyMatrixForNonBijectiveCorrespondences(testDuration, worker);
@@ -194,6 +221,12 @@ TEST(TestRANSAC, P3P_Fisheye_1000Correspondences_15Outliers)
 }
 
 
+TEST(TestRANSAC, P3PPreemptive)
+{
+	Worker worker;
+	EXPECT_TRUE(TestGeometry::TestRANSAC::testP3PPreemptive(GTEST_TEST_DURATION, worker));
+}
+
 TEST(TestRANSAC, P3PZoom)
 {
 	EXPECT_TRUE(TestRANSAC::testP3PZoom(GTEST_TEST_DURATION));
@@ -205,6 +238,12 @@ TEST(TestRANSAC, ObjectTransformationStereoAnyCamera)
 	EXPECT_TRUE(TestRANSAC::testObjectTransformationStereoAnyCamera(GTEST_TEST_DURATION));
 }
 
+TEST(TestRANSAC, ObjectPoints)
+{
+	Worker worker;
+	EXPECT_TRUE(TestRANSAC::testObjectPoints(GTEST_TEST_DURATION, worker));
+}
+
 
 TEST(TestRANSAC, HomographyMatrixNoRefinementLinear)
 {
@@ -231,6 +270,12 @@ TEST(TestRANSAC, HomographyMatrixWithRefinementSVD)
 }
 
 
+TEST(TestRANSAC, HomographyMatrixPreemptive)
+{
+	Worker worker;
+	EXPECT_TRUE(TestGeometry::TestRANSAC::testHomographyMatrixPreemptive(GTEST_TEST_DURATION, worker));
+}
+
 TEST(TestRANSAC, HomographyMatrixForNonBijectiveCorrespondencesNoRefinementLinear)
 {
 	Worker worker;
@@ -607,6 +652,144 @@ bool TestRANSAC::testP3P(const AnyCameraType anyCameraType, const size_t corresp
 	return outerValidation.succeeded();
 }
 
+bool TestRANSAC::testP3PPreemptive(const double testDuration, Worker& worker)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Testing preemptive P3P:";
+
+	RandomGenerator randomGenerator;
+	Validation outerValidation(randomGenerator);
+
+	for (const AnyCameraType anyCameraType : {AnyCameraType::PINHOLE, AnyCameraType::FISHEYE})
+	{
+		Log::info() << " ";
+		Log::info() << "... with camera '" << (anyCameraType == AnyCameraType::PINHOLE ? "pinhole" : "fisheye") << "':";
+
+		for (const bool progressiveSampling : {false, true})
+		{
+			Log::info() << (progressiveSampling ? "... with progressive sampling" : "... with uniform sampling");
+
+			constexpr double successThreshold = std::is_same<Scalar, float>::value ? 0.85 : 0.95;
+
+			ValidationPrecision validation(successThreshold, randomGenerator);
+
+			HighPerformanceStatistic performanceSinglecore;
+			HighPerformanceStatistic performanceMulticore;
+
+			const Timestamp startTimestamp(true);
+
+			do
+			{
+				const SharedAnyCamera sharedCamera = Utilities::realisticAnyCamera(anyCameraType, RandomI::random(randomGenerator, 1u));
+				ocean_assert(sharedCamera);
+
+				const AnyCamera& camera = *sharedCamera;
+
+				const HomogenousMatrix4 world_T_camera(Random::vector3(randomGenerator, -10, 10), Random::quaternion(randomGenerator));
+
+				const size_t correspondences = size_t(RandomI::random(randomGenerator, 50u, 500u));
+
+				Vectors3 objectPoints;
+				Vectors2 imagePoints;
+
+				constexpr Scalar cameraBorder = Scalar(5);
+
+				for (size_t n = 0; n < correspondences; ++n)
+				{
+					const Vector2 imagePoint = Random::vector2(randomGenerator, cameraBorder, Scalar(camera.width()) - cameraBorder, cameraBorder, Scalar(camera.height()) - cameraBorder);
+					const Scalar distance = Random::scalar(randomGenerator, Scalar(0.1), Scalar(10));
+
+					imagePoints.push_back(imagePoint + Random::vector2(randomGenerator, Scalar(-0.5), Scalar(0.5)));
+					objectPoints.push_back(camera.ray(imagePoint, world_T_camera).point(distance));
+				}
+
+				const double faultyRate = RandomD::scalar(randomGenerator, 0.0, 0.5);
+
+				const size_t faultyCorrespondences = size_t(double(correspondences) * faultyRate);
+				const size_t validCorrespondences = correspondences - faultyCorrespondences;
+
+				UnorderedIndexSet32 faultyIndices;
+
+				while (faultyIndices.size() < faultyCorrespondences)
+				{
+					Index32 index = RandomI::random(randomGenerator, (unsigned int)(correspondences - 1));
+
+					if (progressiveSampling && RandomI::random(randomGenerator, 3u) != 0u)
+					{
+						// correspondences sorted by quality have most outliers at the end
+						index = RandomI::random(randomGenerator, (unsigned int)(correspondences / 2), (unsigned int)(correspondences - 1));
+					}
+
+					if (faultyIndices.emplace(index).second)
+					{
+						imagePoints[index] = Random::vector2(randomGenerator, cameraBorder, Scalar(camera.width()) - cameraBorder, cameraBorder, Scalar(camera.height()) - cameraBorder);
+					}
+				}
+
+				constexpr Scalar sqrPixelErrorThreshold = Scalar(3 * 3);
+
+				for (const bool useWorker : {false, true})
+				{
+					ValidationPrecision::ScopedIteration scopedIteration(validation);
+
+					HighPerformanceStatistic& performance = useWorker ? performanceMulticore : performanceSinglecore;
+
+					Indices32 usedIndices;
+					HomogenousMatrix4 world_T_ransacCamera(false);
+
+					performance.start();
+						const bool result = Geometry::RANSAC::p3pPreemptive(camera, ConstArrayAccessor<Vector3>(objectPoints), ConstArrayAccessor<Vector2>(imagePoints), randomGenerator, world_T_ransacCamera, 10u, true, 500u, sqrPixelErrorThreshold, progressiveSampling, &usedIndices, nullptr, nullptr, useWorker ? &worker : nullptr);
+					performance.stop();
+
+					if (!result)
+					{
+						scopedIteration.setInaccurate();
+						continue;
+					}
+
+					size_t preciseCorrespondences = 0;
+
+					for (size_t n = 0; n < correspondences; ++n)
+					{
+						if (faultyIndices.find(Index32(n)) == faultyIndices.cend())
+						{
+							if (imagePoints[n].sqrDistance(camera.projectToImage(world_T_ransacCamera, objectPoints[n])) <= sqrPixelErrorThreshold)
+							{
+								++preciseCorrespondences;
+							}
+						}
+					}
+
+					// we expect (almost) all valid correspondences to be found
+
+					if (double(preciseCorrespondences) < double(validCorrespondences) * 0.95 || usedIndices.size() < preciseCorrespondences)
+					{
+						scopedIteration.setInaccurate();
+					}
+
+					for (size_t n = 1; n < usedIndices.size(); ++n)
+					{
+						if (usedIndices[n - 1] >= usedIndices[n])
+						{
+							OCEAN_SET_FAILED(validation);
+						}
+					}
+				}
+			}
+			while (validation.needMoreIterations() || !startTimestamp.hasTimePassed(testDuration));
+
+			Log::info() << "Performance single-core: " << performanceSinglecore;
+			Log::info() << "Performance multi-core: " << performanceMulticore;
+			Log::info() << "Validation: " << validation;
+
+			OCEAN_EXPECT_TRUE(outerValidation, validation.succeeded());
+		}
+	}
+
+	return outerValidation.succeeded();
+}
+
 bool TestRANSAC::testP3PZoom(const double testDuration)
 {
 	ocean_assert(testDuration > 0.0);
@@ -863,6 +1046,144 @@ bool TestRANSAC::testObjectTransformationStereoAnyCamera(const double testDurati
 	return outerValidation.succeeded();
 }
 
+bool TestRANSAC::testObjectPoints(const double testDuration, Worker& worker)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Determination of several object points with shared camera poses:";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	constexpr double successThreshold = std::is_same<Scalar, float>::value ? 0.95 : 0.99;
+
+	ValidationPrecision validationPrecision(successThreshold, randomGenerator);
+
+	constexpr double faultyRate = 0.1; // 10%
+
+	HighPerformanceStatistic performanceSinglecore;
+	HighPerformanceStatistic performanceMulticore;
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		const AnyCameraType anyCameraType = RandomI::random(randomGenerator, {AnyCameraType::PINHOLE, AnyCameraType::FISHEYE});
+
+		const SharedAnyCamera camera = Utilities::realisticAnyCamera(anyCameraType, RandomI::random(randomGenerator, 1u));
+		ocean_assert(camera);
+
+		const size_t numberObjectPoints = size_t(RandomI::random(randomGenerator, 1u, 500u));
+
+		const Vectors3 objectPoints = Utilities::objectPoints(Box3(Vector3(-1, -1, -1), Vector3(1, 1, 1)), numberObjectPoints, &randomGenerator);
+
+		const HomogenousMatrix4 world_T_camera = Utilities::viewPosition(*camera, objectPoints, Random::vector3(randomGenerator), true);
+
+		const size_t numberPoses = size_t(RandomI::random(randomGenerator, 2u, 20u));
+
+		HomogenousMatrices4 world_T_cameras;
+		world_T_cameras.reserve(numberPoses);
+
+		for (size_t n = 0; n < numberPoses; ++n)
+		{
+			world_T_cameras.emplace_back(world_T_camera * HomogenousMatrix4(Random::vector3(randomGenerator, Scalar(-0.2), Scalar(0.2)), Random::euler(randomGenerator, Numeric::deg2rad(5))));
+		}
+
+		// each object point is observed in a random subset of the poses, with some faulty observations
+
+		Geometry::NonLinearOptimization::ObjectPointToPoseIndexImagePointCorrespondenceAccessor correspondenceGroups;
+
+		for (const Vector3& objectPoint : objectPoints)
+		{
+			std::vector<std::pair<Index32, Vector2>> poseIndexImagePointPairs;
+
+			for (size_t poseIndex = 0; poseIndex < numberPoses; ++poseIndex)
+			{
+				if (poseIndexImagePointPairs.size() >= 2 && RandomI::boolean(randomGenerator))
+				{
+					continue;
+				}
+
+				Vector2 imagePoint = camera->projectToImage(world_T_cameras[poseIndex], objectPoint);
+
+				if (poseIndexImagePointPairs.size() >= 2 && RandomI::random(randomGenerator, 1000u) <= (unsigned int)(faultyRate * 1000.0))
+				{
+					imagePoint += Random::vector2(randomGenerator) * Random::scalar(randomGenerator, Scalar(10), Scalar(50));
+				}
+
+				poseIndexImagePointPairs.emplace_back(Index32(poseIndex), imagePoint);
+			}
+
+			correspondenceGroups.addObjectPoint(std::move(poseIndexImagePointPairs));
+		}
+
+		const unsigned int seed = RandomI::random32(randomGenerator);
+
+		Vectors3 singlecoreObjectPoints(numberObjectPoints);
+		Vectors3 multicoreObjectPoints(numberObjectPoints);
+
+		std::vector<uint8_t> singlecoreValidObjectPoints(numberObjectPoints, 0u);
+		std::vector<uint8_t> multicoreValidObjectPoints(numberObjectPoints, 0u);
+
+		for (const bool useWorker : {false, true})
+		{
+			RandomGenerator localRandomGenerator(seed);
+
+			Vectors3& determinedObjectPoints = useWorker ? multicoreObjectPoints : singlecoreObjectPoints;
+			std::vector<uint8_t>& validObjectPoints = useWorker ? multicoreValidObjectPoints : singlecoreValidObjectPoints;
+
+			HighPerformanceStatistic& performance = useWorker ? performanceMulticore : performanceSinglecore;
+
+			performance.start();
+				const size_t validNumber = Geometry::RANSAC::objectPoints(*camera, ConstArrayAccessor<HomogenousMatrix4>(world_T_cameras), correspondenceGroups, localRandomGenerator, determinedObjectPoints.data(), validObjectPoints.data(), 20u, Scalar(3 * 3), 2u, true, Geometry::Estimator::ET_SQUARE, useWorker ? &worker : nullptr);
+			performance.stop();
+
+			size_t expectedValidNumber = 0;
+
+			for (const uint8_t validObjectPoint : validObjectPoints)
+			{
+				if (validObjectPoint != 0u)
+				{
+					++expectedValidNumber;
+				}
+			}
+
+			OCEAN_EXPECT_EQUAL(validation, validNumber, expectedValidNumber);
+		}
+
+		// the results must not depend on the worker
+
+		OCEAN_EXPECT_TRUE(validation, singlecoreValidObjectPoints == multicoreValidObjectPoints);
+
+		for (size_t n = 0; n < numberObjectPoints; ++n)
+		{
+			ValidationPrecision::ScopedIteration scopedIteration(validationPrecision);
+
+			if (singlecoreValidObjectPoints[n] == 0u)
+			{
+				scopedIteration.setInaccurate();
+				continue;
+			}
+
+			OCEAN_EXPECT_TRUE(validation, singlecoreObjectPoints[n] == multicoreObjectPoints[n]);
+
+			if (singlecoreObjectPoints[n].distance(objectPoints[n]) > Scalar(0.01))
+			{
+				scopedIteration.setInaccurate();
+			}
+		}
+	}
+	while (validationPrecision.needMoreIterations() || !startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Singlecore performance: " << performanceSinglecore;
+	Log::info() << "Multicore performance: " << performanceMulticore;
+	Log::info() << "Validation: " << validationPrecision;
+
+	OCEAN_EXPECT_TRUE(validation, validationPrecision.succeeded());
+
+	return validation.succeeded();
+}
+
 bool TestRANSAC::testHomographyMatrix(const double testDuration, Worker& worker)
 {
 	ocean_assert(testDuration > 0.0);
@@ -1025,6 +1346,134 @@ bool TestRANSAC::testHomographyMatrix(const double testDuration, const bool refi
 	return outerValidation.succeeded();
 }
 
+bool TestRANSAC::testHomographyMatrixPreemptive(const double testDuration, Worker& worker)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Testing preemptive homography matrix:";
+
+	constexpr unsigned int width = 1920u;
+	constexpr unsigned int height = 1080u;
+
+	const PinholeCamera pinholeCamera(width, height, Numeric::deg2rad(60));
+
+	RandomGenerator randomGenerator;
+	Validation outerValidation(randomGenerator);
+
+	for (const bool progressiveSampling : {false, true})
+	{
+		Log::info() << " ";
+		Log::info() << (progressiveSampling ? "... with progressive sampling:" : "... with uniform sampling:");
+
+		constexpr double successThreshold = 0.95;
+		ValidationPrecision validation(successThreshold, randomGenerator);
+
+		HighPerformanceStatistic performanceSinglecore;
+		HighPerformanceStatistic performanceMulticore;
+
+		const Timestamp startTimestamp(true);
+
+		do
+		{
+			// we create a realistic homography based on two camera poses and a 3D plane in front of both cameras
+
+			const Plane3 plane(Vector3(0, 0, -4), Vector3(0, 0, 1));
+
+			const HomogenousMatrix4 world_leftCamera(Random::vector3(randomGenerator, Scalar(-0.2), Scalar(0.2)), Random::euler(randomGenerator, 0, Numeric::deg2rad(10)));
+			const HomogenousMatrix4 world_rightCamera(Random::vector3(randomGenerator, Scalar(-0.2), Scalar(0.2)), Random::euler(randomGenerator, 0, Numeric::deg2rad(10)));
+
+			const size_t correspondences = size_t(RandomI::random(randomGenerator, 20u, 500u));
+
+			Vectors2 pointsLeft(correspondences);
+			Vectors2 pointsRight(correspondences);
+			Vectors2 pointsRightNoisedAndFaulty(correspondences);
+
+			for (size_t n = 0; n < correspondences; ++n)
+			{
+				pointsLeft[n] = Random::vector2(randomGenerator, Scalar(0), Scalar(width), Scalar(0), Scalar(height));
+
+				Vector3 objectPoint(Numeric::minValue(), Numeric::minValue(), Numeric::minValue());
+				if (!plane.intersection(pinholeCamera.ray(pointsLeft[n], world_leftCamera), objectPoint))
+				{
+					ocean_assert(false && "This should never happen!");
+				}
+
+				pointsRight[n] = pinholeCamera.projectToImage<false>(world_rightCamera, objectPoint, false);
+
+				pointsRightNoisedAndFaulty[n] = pointsRight[n] + Random::vector2(randomGenerator, Scalar(-0.5), Scalar(0.5), Scalar(-0.5), Scalar(0.5));
+			}
+
+			const double faultyRate = RandomD::scalar(randomGenerator, 0.0, 0.5);
+
+			UnorderedIndexSet32 faultySet;
+			while (faultySet.size() < size_t(double(correspondences) * faultyRate))
+			{
+				Index32 index = RandomI::random(randomGenerator, (unsigned int)(correspondences - 1));
+
+				if (progressiveSampling && RandomI::random(randomGenerator, 3u) != 0u)
+				{
+					// correspondences sorted by quality have most outliers at the end
+					index = RandomI::random(randomGenerator, (unsigned int)(correspondences / 2), (unsigned int)(correspondences - 1));
+				}
+
+				if (faultySet.emplace(index).second)
+				{
+					const Vector2 offset(Random::scalar(randomGenerator, Scalar(10), Scalar(50)) * Random::sign(randomGenerator), Random::scalar(randomGenerator, Scalar(10), Scalar(50)) * Random::sign(randomGenerator));
+
+					pointsRightNoisedAndFaulty[index] += offset;
+				}
+			}
+
+			for (const bool useWorker : {false, true})
+			{
+				HighPerformanceStatistic& performance = useWorker ? performanceMulticore : performanceSinglecore;
+
+				const bool refine = RandomI::boolean(randomGenerator);
+
+				Indices32 usedIndices;
+				SquareMatrix3 right_H_left(false);
+
+				performance.start();
+					const bool result = Geometry::RANSAC::homographyMatrixPreemptive(pointsLeft.data(), pointsRightNoisedAndFaulty.data(), correspondences, randomGenerator, right_H_left, refine, 500u, Scalar(1.5 * 1.5), progressiveSampling, &usedIndices, useWorker ? &worker : nullptr);
+				performance.stop();
+
+				if (result)
+				{
+					for (size_t n = 0; n < correspondences; ++n)
+					{
+						ValidationPrecision::ScopedIteration scopedIteration(validation);
+
+						const Vector2 transformedPoint = right_H_left * pointsLeft[n];
+
+						if (!transformedPoint.isEqual(pointsRight[n], 4))
+						{
+							scopedIteration.setInaccurate();
+						}
+					}
+
+					if (usedIndices.size() < 4)
+					{
+						OCEAN_SET_FAILED(validation);
+					}
+				}
+				else
+				{
+					OCEAN_SET_FAILED(validation);
+				}
+			}
+		}
+		while (validation.needMoreIterations() || !startTimestamp.hasTimePassed(testDuration));
+
+		Log::info() << "Performance single-core: " << performanceSinglecore;
+		Log::info() << "Performance multi-core: " << performanceMulticore;
+		Log::info() << "Validation: " << validation;
+
+		OCEAN_EXPECT_TRUE(outerValidation, validation.succeeded());
+	}
+
+	return outerValidation.succeeded();
+}
+
 bool TestRANSAC::testHomographyMatrixForNonBijectiveCorrespondences(const double testDuration, Worker& worker)
 {
 	Log::info() << "Testing determination of non-bijective homography matrix with RANSAC for " << sizeof(Scalar) * 8 << "bit floating point precision:";
@@ -79,6 +79,14 @@ class OCEAN_TEST_GEOMETRY_EXPORT TestRANSAC
 		 */
 		static bool testP3P(const AnyCameraType anyCameraType, const size_t correspondences, const double faultyRate, const double testDuration);
 
+		/**
+		 * Tests the preemptive RANSAC function p3pPreemptive for mono cameras.
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @param worker The worker object to distribute the computation
+		 * @return True, if succeeded
+		 */
+		static bool testP3PPreemptive(const double testDuration, Worker& worker);
+
 		/**
 		 * Tests the RANSAC implementation of the perspective pose problem for three random points including unknown zoom factor.
 		 * @param testDuration Number of seconds for each test, with range (0, infinity)
@@ -93,6 +101,14 @@ class OCEAN_TEST_GEOMETRY_EXPORT TestRANSAC
 		 */
 		static bool testObjectTransformationStereoAnyCamera(const double testDuration);
 
+		/**
+		 * Tests the RANSAC-based function determining several object points observed in shared camera poses.
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @param worker The worker object to distribute the computation
+		 * @return True, if succeeded
+		 */
+		static bool testObjectPoints(const double testDuration, Worker& worker);
+
 		/**
 		 * Tests the RANSAC-based function determining the homography matrix.
 		 * @param testDuration Number of seconds for each test, with range (0, infinity)
@@ -111,6 +127,14 @@ class OCEAN_TEST_GEOMETRY_EXPORT TestRANSAC
 		 */
 		static bool testHomographyMatrix(const double testDuration, const bool refine, const bool useSVD, Worker& worker);
 
+		/**
+		 * Tests the preemptive RANSAC function determining the homography matrix.
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @param worker The worker object to distribute the computation
+		 * @return True, if succeeded
+		 */
+		static bool testHomographyMatrixPreemptive(const double testDuration, Worker& worker);
+
 		/**
 		 * Tests the RANSAC-based function determining the homography matrix for non-bijective correspondences.
 		 * @param testDuration Number of seconds for each test, with range (0, infinity)
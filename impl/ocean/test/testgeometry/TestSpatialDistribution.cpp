@@ -93,6 +93,15 @@ bool TestSpatialDistribution::test(const double testDuration, const TestSelector
 	{
 		testResult = testCopyConstructorWithNeighborhood8(testDuration);
 
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
+	if (selector.shouldRun("bestelementsarray"))
+	{
+		testResult = testBestElementsArray(testDuration);
+
 		Log::info() << " ";
 	}
 
@@ -138,6 +147,11 @@ TEST(TestSpatialDistribution, CopyConstructorWithNeighborhood8)
 	EXPECT_TRUE(TestSpatialDistribution::testCopyConstructorWithNeighborhood8(GTEST_TEST_DURATION));
 }
 
+TEST(TestSpatialDistribution, BestElementsArray)
+{
+	EXPECT_TRUE(TestSpatialDistribution::testBestElementsArray(GTEST_TEST_DURATION));
+}
+
 #endif // OCEAN_USE_GTEST
 
 bool TestSpatialDistribution::testIdealBins(const double testDuration)
@@ -726,6 +740,156 @@ bool TestSpatialDistribution::testCopyConstructorWithNeighborhood8(const double
 	return validation.succeeded();
 }
 
+
+bool TestSpatialDistribution::testBestElementsArray(const double testDuration)
+{
+	ocean_assert(testDuration > 0.0);
+
+	constexpr unsigned int numberPoints = 2000u;
+
+	Log::info() << "Testing best elements array for " << numberPoints << " points:";
+
+	using BestElementsArray = Geometry::SpatialDistribution::BestElementsArray<Vector2, &TestSpatialDistribution::point2position>;
+
+	HighPerformanceStatistic performance;
+
+	RandomGenerator randomGenerator;
+
+	Validation validation(randomGenerator);
+
+	// the same array is used for all iterations, so that the memory is reused
+	BestElementsArray bestElementsArray;
+
+	Vectors2 imagePoints;
+	Vectors2 bestElements;
+
+	std::vector<Vectors2> pointsPerBin;
+	Vectors2 expectedElements;
+
+	Indices32 binIndices;
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		imagePoints.clear();
+
+		for (unsigned int n = 0u; n < numberPoints; ++n)
+		{
+			imagePoints.emplace_back(Random::vector2(randomGenerator, -100, 100));
+		}
+
+		const Scalar left = Random::scalar(randomGenerator, -150, 50);
+		const Scalar top = Random::scalar(randomGenerator, -150, 50);
+
+		const Scalar width = Random::scalar(randomGenerator, Scalar(1), 250);
+		const Scalar height = Random::scalar(randomGenerator, Scalar(1), 250);
+
+		const unsigned int horizontalBins = RandomI::random(randomGenerator, 1u, 40u);
+		const unsigned int verticalBins = RandomI::random(randomGenerator, 1u, 40u);
+
+		const unsigned int capacityPerBin = RandomI::random(randomGenerator, 1u, 5u);
+
+		const size_t maximalElements = RandomI::boolean(randomGenerator) ? size_t(-1) : size_t(RandomI::random(randomGenerator, 0u, numberPoints));
+
+		const bool addIndividually = RandomI::boolean(randomGenerator);
+
+		bestElements.clear();
+
+		performance.start();
+
+			bestElementsArray.reset(left, top, width, height, horizontalBins, verticalBins, capacityPerBin);
+
+			if (addIndividually)
+			{
+				for (const Vector2& imagePoint : imagePoints)
+				{
+					bestElementsArray.addElement(imagePoint);
+				}
+			}
+			else
+			{
+				bestElementsArray.addElements(imagePoints.data(), imagePoints.size());
+			}
+
+			const size_t extractedElements = bestElementsArray.extractElements(bestElements, maximalElements);
+
+		performance.stop();
+
+		OCEAN_EXPECT_EQUAL(validation, extractedElements, bestElements.size());
+		OCEAN_EXPECT_EQUAL(validation, bestElementsArray.size(), size_t(0));
+
+		// the SIMD bin indices must be identical to the individual bin indices
+
+		binIndices.resize(imagePoints.size());
+		bestElementsArray.binIndices(imagePoints.data(), imagePoints.size(), binIndices.data());
+
+		pointsPerBin.assign(bestElementsArray.bins(), Vectors2());
+
+		for (size_t n = 0; n < imagePoints.size(); ++n)
+		{
+			const Vector2& imagePoint = imagePoints[n];
+
+			const int horizontal = bestElementsArray.horizontalBin(imagePoint.x());
+			const int vertical = bestElementsArray.verticalBin(imagePoint.y());
+
+			if (horizontal >= 0 && horizontal < int(horizontalBins) && vertical >= 0 && vertical < int(verticalBins))
+			{
+				const unsigned int binIndex = (unsigned int)(vertical) * horizontalBins + (unsigned int)(horizontal);
+
+				OCEAN_EXPECT_EQUAL(validation, binIndices[n], binIndex);
+
+				pointsPerBin[binIndex].push_back(imagePoint);
+			}
+			else
+			{
+				OCEAN_EXPECT_EQUAL(validation, binIndices[n], (unsigned int)(-1));
+			}
+		}
+
+		// the best elements of each bin are extracted round by round, each round is sorted
+
+		for (Vectors2& binPoints : pointsPerBin)
+		{
+			std::sort(binPoints.begin(), binPoints.end());
+		}
+
+		expectedElements.clear();
+
+		for (unsigned int round = 0u; round < capacityPerBin && expectedElements.size() < maximalElements; ++round)
+		{
+			const size_t roundStart = expectedElements.size();
+
+			for (const Vectors2& binPoints : pointsPerBin)
+			{
+				if (round < binPoints.size())
+				{
+					expectedElements.push_back(binPoints[round]);
+				}
+			}
+
+			std::sort(expectedElements.begin() + roundStart, expectedElements.end());
+
+			if (expectedElements.size() > maximalElements)
+			{
+				expectedElements.resize(maximalElements);
+			}
+		}
+
+		OCEAN_EXPECT_TRUE(validation, bestElements == expectedElements);
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Performance: " << performance;
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
+Vector2 TestSpatialDistribution::point2position(const Vector2& point)
+{
+	return point;
+}
 }
 
 }
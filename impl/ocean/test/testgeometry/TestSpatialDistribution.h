@@ -85,6 +85,22 @@ class OCEAN_TEST_GEOMETRY_EXPORT TestSpatialDistribution
 		 * @return True, if succeeded
 		 */
 		static bool testCopyConstructorWithNeighborhood8(const double testDuration);
+
+		/**
+		 * Tests the array keeping the best elements of each bin.
+		 * @param testDuration Number of seconds for each test, with range  (0, infinity)
+		 * @return True, if succeeded
+		 */
+		static bool testBestElementsArray(const double testDuration);
+
+	protected:
+
+		/**
+		 * Returns the position of a point element.
+		 * @param point The point element
+		 * @return The position of the element, which is the point itself
+		 */
+		static Vector2 point2position(const Vector2& point);
 };
 
 }
@@ -30,7 +30,7 @@ namespace Test
 namespace TestGeometry
 {
 
-bool TestStereoscopicGeometry::test(const double testDuration, const TestSelector& selector)
+bool TestStereoscopicGeometry::test(const double testDuration, Worker& worker, const TestSelector& selector)
 {
 	ocean_assert(testDuration > 0.0);
 
@@ -42,6 +42,15 @@ bool TestStereoscopicGeometry::test(const double testDuration, const TestSelecto
 	{
 		testResult = testCameraPose(testDuration);
 
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
+	if (selector.shouldRun("cameraposes"))
+	{
+		testResult = testCameraPoses(testDuration, worker);
+
 		Log::info() << " ";
 	}
 
@@ -103,6 +112,13 @@ TEST(TestStereoscopicGeometry, CameraPose_6DOF_100)
 	EXPECT_TRUE((TestStereoscopicGeometry::testCameraPose<false>(100u, GTEST_TEST_DURATION)));
 }
 
+
+TEST(TestStereoscopicGeometry, CameraPoses)
+{
+	Worker worker;
+	EXPECT_TRUE(TestStereoscopicGeometry::testCameraPoses(GTEST_TEST_DURATION, worker));
+}
+
 #endif // OCEAN_USE_GTEST
 
 bool TestStereoscopicGeometry::testCameraPose(const double testDuration)
@@ -362,6 +378,155 @@ bool TestStereoscopicGeometry::testCameraPose(const unsigned int numberCorrespon
 	return validation.succeeded();
 }
 
+bool TestStereoscopicGeometry::testCameraPoses(const double testDuration, Worker& worker)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Testing camera poses of several frame pairs:";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	constexpr double successThreshold = std::is_same<float, Scalar>::value ? 0.85 : 0.95;
+
+	ValidationPrecision validationPrecision(successThreshold, randomGenerator);
+
+	HighPerformanceStatistic performanceSinglecore;
+	HighPerformanceStatistic performanceMulticore;
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		const AnyCameraType anyCameraType = RandomI::random(randomGenerator, {AnyCameraType::PINHOLE, AnyCameraType::FISHEYE});
+		const unsigned int cameraIndex = RandomI::random(randomGenerator, 1u);
+
+		const SharedAnyCamera camera = Utilities::realisticAnyCamera(anyCameraType, cameraIndex);
+		ocean_assert(camera);
+
+		const size_t numberPairs = size_t(RandomI::random(randomGenerator, 1u, 16u));
+
+		Geometry::StereoscopicGeometry::CameraPosePairs cameraPosePairs;
+		cameraPosePairs.reserve(numberPairs);
+
+		while (cameraPosePairs.size() < numberPairs)
+		{
+			const Scalar boxDimension = Random::scalar(randomGenerator, 1, 10);
+
+			const unsigned int numberCorrespondences = RandomI::random(randomGenerator, 20u, 100u);
+
+			const Vectors3 objectPoints = Utilities::objectPoints(Box3(Vector3(0, 0, 0), boxDimension, boxDimension, boxDimension), size_t(numberCorrespondences), &randomGenerator);
+
+			const HomogenousMatrix4 world_T_camera0 = Utilities::viewPosition(*camera, objectPoints, Random::vector3(randomGenerator), true);
+
+			const Vector3 translation(Random::scalar(randomGenerator, Scalar(0.01), Scalar(0.1)) * Random::sign(randomGenerator), Random::scalar(randomGenerator, Scalar(0.01), Scalar(0.1)) * Random::sign(randomGenerator), Random::scalar(randomGenerator, Scalar(-0.01), Scalar(0.01)));
+
+			const HomogenousMatrix4 world_T_camera1 = world_T_camera0 * HomogenousMatrix4(translation, Random::euler(randomGenerator, Numeric::deg2rad(10)));
+
+			Vectors2 imagePoints0;
+			Vectors2 imagePoints1;
+
+			for (const Vector3& objectPoint : objectPoints)
+			{
+				const Vector2 imagePoint0 = camera->projectToImage(world_T_camera0, objectPoint);
+				const Vector2 imagePoint1 = camera->projectToImage(world_T_camera1, objectPoint);
+
+				if (camera->isInside(imagePoint0) && camera->isInside(imagePoint1))
+				{
+					imagePoints0.emplace_back(imagePoint0);
+					imagePoints1.emplace_back(imagePoint1);
+				}
+			}
+
+			if (imagePoints0.size() >= 20)
+			{
+				cameraPosePairs.emplace_back(std::move(imagePoints0), std::move(imagePoints1));
+			}
+		}
+
+		// the results must not depend on the worker
+
+		Geometry::StereoscopicGeometry::CameraPosePairs multicoreCameraPosePairs(cameraPosePairs);
+
+		const unsigned int seed = RandomI::random32(randomGenerator);
+
+		RandomGenerator singlecoreRandomGenerator(seed);
+		RandomGenerator multicoreRandomGenerator(seed);
+
+		performanceSinglecore.start();
+			const size_t singlecoreSucceeded = Geometry::StereoscopicGeometry::cameraPoses(*camera, cameraPosePairs, singlecoreRandomGenerator, nullptr, Numeric::sqr(Scalar(0.1)), Numeric::sqr(Scalar(3.5)));
+		performanceSinglecore.stop();
+
+		performanceMulticore.start();
+			const size_t multicoreSucceeded = Geometry::StereoscopicGeometry::cameraPoses(*camera, multicoreCameraPosePairs, multicoreRandomGenerator, &worker, Numeric::sqr(Scalar(0.1)), Numeric::sqr(Scalar(3.5)));
+		performanceMulticore.stop();
+
+		OCEAN_EXPECT_EQUAL(validation, singlecoreSucceeded, multicoreSucceeded);
+
+		size_t succeededPairs = 0;
+
+		for (size_t pairIndex = 0; pairIndex < cameraPosePairs.size(); ++pairIndex)
+		{
+			ValidationPrecision::ScopedIteration scopedIteration(validationPrecision);
+
+			const Geometry::StereoscopicGeometry::CameraPosePair& cameraPosePair = cameraPosePairs[pairIndex];
+			const Geometry::StereoscopicGeometry::CameraPosePair& multicoreCameraPosePair = multicoreCameraPosePairs[pairIndex];
+
+			OCEAN_EXPECT_EQUAL(validation, cameraPosePair.succeeded(), multicoreCameraPosePair.succeeded());
+
+			if (!cameraPosePair.succeeded())
+			{
+				scopedIteration.setInaccurate();
+				continue;
+			}
+
+			++succeededPairs;
+
+			OCEAN_EXPECT_TRUE(validation, cameraPosePair.world_T_camera1_ == multicoreCameraPosePair.world_T_camera1_);
+			OCEAN_EXPECT_TRUE(validation, cameraPosePair.validIndices_ == multicoreCameraPosePair.validIndices_);
+
+			OCEAN_EXPECT_EQUAL(validation, cameraPosePair.objectPoints_.size(), cameraPosePair.validIndices_.size());
+
+			if (cameraPosePair.validIndices_.size() != cameraPosePair.imagePoints0_.size() || cameraPosePair.objectPoints_.size() != cameraPosePair.validIndices_.size())
+			{
+				scopedIteration.setInaccurate();
+				continue;
+			}
+
+			for (unsigned int frameIndex = 0u; frameIndex < 2u; ++frameIndex)
+			{
+				// the first camera pose is the identity camera pose
+
+				const HomogenousMatrix4 world_T_camera = frameIndex == 0u ? HomogenousMatrix4(true) : cameraPosePair.world_T_camera1_;
+				const Vectors2& imagePoints = frameIndex == 0u ? cameraPosePair.imagePoints0_ : cameraPosePair.imagePoints1_;
+
+				Scalar sqrAveragePixelError = Numeric::maxValue();
+				Scalar sqrMinimalPixelError = Numeric::maxValue();
+				Scalar sqrMaximalPixelError = Numeric::maxValue();
+
+				const bool allObjectPointsInFront = Geometry::Error::determinePoseError<ConstArrayAccessor<Vector3>, ConstArrayAccessor<Vector2>, true>(world_T_camera, *camera, ConstArrayAccessor<Vector3>(cameraPosePair.objectPoints_), ConstArrayAccessor<Vector2>(imagePoints), sqrAveragePixelError, sqrMinimalPixelError, sqrMaximalPixelError);
+
+				if (!allObjectPointsInFront || sqrAveragePixelError > Scalar(2 * 2) || sqrMaximalPixelError > Scalar(10 * 10))
+				{
+					scopedIteration.setInaccurate();
+				}
+			}
+		}
+
+		OCEAN_EXPECT_EQUAL(validation, singlecoreSucceeded, succeededPairs);
+	}
+	while (validationPrecision.needMoreIterations() || !startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Singlecore performance: " << performanceSinglecore;
+	Log::info() << "Multicore performance: " << performanceMulticore;
+
+	Log::info() << "Validation: " << validationPrecision;
+
+	OCEAN_EXPECT_TRUE(validation, validationPrecision.succeeded());
+
+	return validation.succeeded();
+}
+
 }
 
 }
@@ -32,10 +32,11 @@ class OCEAN_TEST_GEOMETRY_EXPORT TestStereoscopicGeometry
 		/**
 		 * Invokes all tests.
 		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @param worker The worker object
 		 * @param selector The test selector
 		 * @return True, if succeeded
 		 */
-		static bool test(const double testDuration, const TestSelector& selector);
+		static bool test(const double testDuration, Worker& worker, const TestSelector& selector);
 
 		/**
 		 * Tests the function to determine the transformation between two cameras.
@@ -53,6 +54,14 @@ class OCEAN_TEST_GEOMETRY_EXPORT TestStereoscopicGeometry
 		 */
 		template <bool tPureRotation>
 		static bool testCameraPose(const unsigned int numberCorrespondences, const double testDuration);
+
+		/**
+		 * Tests the function to determine the transformations of several frame pairs concurrently.
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @param worker The worker object
+		 * @return True, if succeeded
+		 */
+		static bool testCameraPoses(const double testDuration, Worker& worker);
 };
 
 }
@@ -10,7 +10,11 @@
 #include "ocean/test/TestResult.h"
 #include "ocean/test/Validation.h"
 
+#include "ocean/base/RandomI.h"
+#include "ocean/base/Timestamp.h"
+
 #include "ocean/io/Bitstream.h"
+#include "ocean/io/MemoryInputStream.h"
 
 #include <sstream>
 
@@ -23,7 +27,7 @@ namespace Test
 namespace TestIO
 {
 
-bool TestBitstream::test(const double /*testDuration*/, const TestSelector& selector)
+bool TestBitstream::test(const double testDuration, const TestSelector& selector)
 {
 	TestResult testResult("Bitstream test");
 
@@ -36,6 +40,24 @@ bool TestBitstream::test(const double /*testDuration*/, const TestSelector& sele
 		Log::info() << " ";
 	}
 
+	if (selector.shouldRun("arrays"))
+	{
+		testResult = testArrays(testDuration);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
+	if (selector.shouldRun("memoryinputstream"))
+	{
+		testResult = testMemoryInputStream(testDuration);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
 	Log::info() << testResult;
 
 	return testResult.succeeded();
@@ -48,6 +70,16 @@ TEST(Bitstream, InputOutputBitstream)
 	EXPECT_TRUE(TestBitstream::testInputOutputBitstream());
 }
 
+TEST(Bitstream, Arrays)
+{
+	EXPECT_TRUE(TestBitstream::testArrays(GTEST_TEST_DURATION));
+}
+
+TEST(Bitstream, MemoryInputStream)
+{
+	EXPECT_TRUE(TestBitstream::testMemoryInputStream(GTEST_TEST_DURATION));
+}
+
 #endif // OCEAN_USE_GTEST
 
 bool TestBitstream::testInputOutputBitstream()
@@ -231,6 +263,175 @@ bool TestBitstream::testInputOutputBitstream()
 	return validation.succeeded();
 }
 
+bool TestBitstream::testArrays(const double testDuration)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Arrays test:";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		const size_t number = size_t(RandomI::random(randomGenerator, 0u, 1000u));
+
+		std::vector<float> floatValues(number);
+		std::vector<uint16_t> shortValues(number);
+		std::vector<double> doubleValues(number);
+
+		for (size_t n = 0; n < number; ++n)
+		{
+			floatValues[n] = float(RandomI::random32(randomGenerator)) * 0.001f;
+			shortValues[n] = uint16_t(RandomI::random(randomGenerator, 65535u));
+			doubleValues[n] = double(RandomI::random32(randomGenerator)) * 0.01;
+		}
+
+		// the arrays must have the same memory layout as individually written values
+
+		std::ostringstream arrayOutput;
+		IO::OutputBitstream arrayBitstream(arrayOutput);
+
+		OCEAN_EXPECT_TRUE(validation, arrayBitstream.writeArray<float>(floatValues.data(), floatValues.size()));
+		OCEAN_EXPECT_TRUE(validation, arrayBitstream.writeArray<uint16_t>(shortValues.data(), shortValues.size()));
+		OCEAN_EXPECT_TRUE(validation, arrayBitstream.writeArray<double>(doubleValues.data(), doubleValues.size()));
+
+		std::ostringstream valueOutput;
+		IO::OutputBitstream valueBitstream(valueOutput);
+
+		for (const float value : floatValues)
+		{
+			OCEAN_EXPECT_TRUE(validation, valueBitstream.write<float>(value));
+		}
+
+		for (const uint16_t value : shortValues)
+		{
+			OCEAN_EXPECT_TRUE(validation, valueBitstream.write<uint16_t>(value));
+		}
+
+		for (const double value : doubleValues)
+		{
+			OCEAN_EXPECT_TRUE(validation, valueBitstream.write<double>(value));
+		}
+
+		OCEAN_EXPECT_EQUAL(validation, arrayBitstream.size(), uint64_t(number * (sizeof(float) + sizeof(uint16_t) + sizeof(double))));
+
+		const std::string arrayString = arrayOutput.str();
+		OCEAN_EXPECT_EQUAL(validation, arrayString, valueOutput.str());
+
+		std::istringstream input(arrayString);
+		IO::InputBitstream inputBitstream(input);
+
+		std::vector<float> readFloatValues(number);
+		std::vector<uint16_t> readShortValues(number);
+		std::vector<double> readDoubleValues(number);
+
+		OCEAN_EXPECT_TRUE(validation, inputBitstream.readArray<float>(readFloatValues.data(), readFloatValues.size()));
+		OCEAN_EXPECT_TRUE(validation, inputBitstream.readArray<uint16_t>(readShortValues.data(), readShortValues.size()));
+		OCEAN_EXPECT_TRUE(validation, inputBitstream.readArray<double>(readDoubleValues.data(), readDoubleValues.size()));
+
+		OCEAN_EXPECT_EQUAL(validation, readFloatValues, floatValues);
+		OCEAN_EXPECT_EQUAL(validation, readShortValues, shortValues);
+		OCEAN_EXPECT_EQUAL(validation, readDoubleValues, doubleValues);
+
+		// reading beyond the end of the stream must fail
+
+		uint32_t value = 0u;
+		OCEAN_EXPECT_FALSE(validation, inputBitstream.readArray<uint32_t>(&value, 1));
+		OCEAN_EXPECT_TRUE(validation, inputBitstream.isEndOfFile());
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
+bool TestBitstream::testMemoryInputStream(const double testDuration)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Memory input stream test:";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		const unsigned int number = RandomI::random(randomGenerator, 1u, 1000u);
+
+		std::ostringstream output;
+		IO::OutputBitstream outputBitstream(output);
+
+		Indices32 values(number);
+
+		for (Index32& value : values)
+		{
+			value = RandomI::random32(randomGenerator);
+		}
+
+		const std::string text = "Number of values";
+
+		OCEAN_EXPECT_TRUE(validation, outputBitstream.write<std::string>(text));
+		OCEAN_EXPECT_TRUE(validation, outputBitstream.write<unsigned int>(number));
+		OCEAN_EXPECT_TRUE(validation, outputBitstream.writeArray<Index32>(values.data(), values.size()));
+
+		const std::string buffer = output.str();
+
+		IO::MemoryInputStream memoryInputStream(buffer.data(), buffer.size());
+		IO::InputBitstream inputBitstream(memoryInputStream);
+
+		OCEAN_EXPECT_EQUAL(validation, inputBitstream.size(), uint64_t(buffer.size()));
+		OCEAN_EXPECT_EQUAL(validation, inputBitstream.position(), uint64_t(0));
+
+		std::string readText;
+		OCEAN_EXPECT_TRUE(validation, inputBitstream.read<std::string>(readText));
+		OCEAN_EXPECT_EQUAL(validation, readText, text);
+
+		const uint64_t valuesPosition = inputBitstream.position();
+
+		unsigned int readNumber = 0u;
+		OCEAN_EXPECT_TRUE(validation, inputBitstream.read<unsigned int>(readNumber));
+		OCEAN_EXPECT_EQUAL(validation, readNumber, number);
+
+		// we skip a random number of values and read the remaining values individually
+
+		const unsigned int skipValues = RandomI::random(randomGenerator, number - 1u);
+		OCEAN_EXPECT_TRUE(validation, inputBitstream.skip(uint64_t(skipValues) * sizeof(Index32)));
+
+		for (unsigned int n = skipValues; n < number; ++n)
+		{
+			OCEAN_EXPECT_TRUE(validation, readValue<Index32>(inputBitstream, values[n]));
+		}
+
+		OCEAN_EXPECT_EQUAL(validation, inputBitstream.position(), uint64_t(buffer.size()));
+
+		uint8_t dummyValue = 0u;
+		OCEAN_EXPECT_FALSE(validation, inputBitstream.read<uint8_t>(dummyValue));
+		OCEAN_EXPECT_TRUE(validation, inputBitstream.isEndOfFile());
+
+		// after a reset, the values can be read again with one call
+
+		OCEAN_EXPECT_TRUE(validation, inputBitstream.reset());
+		OCEAN_EXPECT_TRUE(validation, inputBitstream.setPosition(valuesPosition + sizeof(unsigned int)));
+
+		Indices32 readValues(number);
+		OCEAN_EXPECT_TRUE(validation, inputBitstream.readArray<Index32>(readValues.data(), readValues.size()));
+		OCEAN_EXPECT_EQUAL(validation, readValues, values);
+
+		OCEAN_EXPECT_FALSE(validation, inputBitstream.setPosition(uint64_t(buffer.size()) + 1ull));
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
 }
 
 }
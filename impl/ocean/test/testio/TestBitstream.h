@@ -45,6 +45,20 @@ class OCEAN_TEST_IO_EXPORT TestBitstream
 		 */
 		 static bool testInputOutputBitstream();
 
+		/**
+		 * Tests reading and writing arrays of values with one call.
+		 * @param testDuration The number of seconds for each test
+		 * @return True, if succeeded
+		 */
+		static bool testArrays(const double testDuration);
+
+		/**
+		 * Tests the input bitstream in combination with a memory input stream.
+		 * @param testDuration The number of seconds for each test
+		 * @return True, if succeeded
+		 */
+		static bool testMemoryInputStream(const double testDuration);
+
 		/**
 		 * Reads one value from an input stream and checks whether the value matches with a given value.
 		 * @param inputStream The input stream
@@ -12,7 +12,9 @@
 
 #include "ocean/base/HighPerformanceTimer.h"
 #include "ocean/base/RandomI.h"
+#include "ocean/base/String.h"
 #include "ocean/base/Timestamp.h"
+#include "ocean/base/Worker.h"
 
 #include "ocean/io/Compression.h"
 
@@ -39,6 +41,31 @@ bool TestCompression::test(const double testDuration, const TestSelector& select
 		Log::info() << " ";
 	}
 
+	if (selector.shouldRun("gzipblockcompression"))
+	{
+		testResult = testGzipBlockCompression(testDuration);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
+	if (selector.shouldRun("gzipstreamcompression"))
+	{
+		testResult = testGzipStreamCompression(testDuration);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
+	if (selector.shouldRun("zlibdictionarycompression"))
+	{
+		testResult = testZlibDictionaryCompression(testDuration);
+
+		Log::info() << " ";
+	}
+
 	Log::info() << testResult;
 
 	return testResult.succeeded();
@@ -51,6 +78,21 @@ TEST(TestCompression, GzipCompression)
 	EXPECT_TRUE(TestCompression::testGzipCompression(GTEST_TEST_DURATION));
 }
 
+TEST(TestCompression, GzipBlockCompression)
+{
+	EXPECT_TRUE(TestCompression::testGzipBlockCompression(GTEST_TEST_DURATION));
+}
+
+TEST(TestCompression, GzipStreamCompression)
+{
+	EXPECT_TRUE(TestCompression::testGzipStreamCompression(GTEST_TEST_DURATION));
+}
+
+TEST(TestCompression, ZlibDictionaryCompression)
+{
+	EXPECT_TRUE(TestCompression::testZlibDictionaryCompression(GTEST_TEST_DURATION));
+}
+
 #endif // OCEAN_USE_GTEST
 
 bool TestCompression::testGzipCompression(const double testDuration)
@@ -106,6 +148,226 @@ bool TestCompression::testGzipCompression(const double testDuration)
 	return validation.succeeded();
 }
 
+bool TestCompression::testGzipBlockCompression(const double testDuration)
+{
+	Log::info() << "Gzip block compression test:";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	Worker worker;
+
+	HighPerformanceStatistic performanceSingleCore;
+	HighPerformanceStatistic performanceMultiCore;
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		const size_t size = size_t(RandomI::random(randomGenerator, 1u, 4u * 1024u * 1024u));
+		const size_t blockSize = size_t(RandomI::random(randomGenerator, 1u, 1024u * 1024u));
+
+		const IO::Compression::Buffer uncompressedBuffer = createBuffer(size, randomGenerator);
+
+		const IO::Compression::CompressionLevel compressionLevel = IO::Compression::CompressionLevel(RandomI::random(randomGenerator, 2u));
+
+		for (const bool useWorker : {false, true})
+		{
+			HighPerformanceStatistic& performance = useWorker ? performanceMultiCore : performanceSingleCore;
+
+			IO::Compression::Buffer compressedBuffer;
+
+			performance.start();
+				const bool compressed = IO::Compression::gzipCompress(uncompressedBuffer.data(), uncompressedBuffer.size(), compressedBuffer, compressionLevel, useWorker ? &worker : nullptr, blockSize);
+			performance.stop();
+
+			OCEAN_EXPECT_TRUE(validation, compressed);
+
+			IO::Compression::Buffer testBuffer;
+			OCEAN_EXPECT_TRUE(validation, IO::Compression::gzipDecompress(compressedBuffer.data(), compressedBuffer.size(), testBuffer));
+
+			OCEAN_EXPECT_TRUE(validation, uncompressedBuffer == testBuffer);
+
+			// the stream decompressor must support several gzip members as well
+
+			IO::Compression::GzipStreamDecompressor decompressor;
+			IO::Compression::Buffer streamTestBuffer;
+
+			OCEAN_EXPECT_TRUE(validation, decompressor.decompress(compressedBuffer.data(), compressedBuffer.size(), streamTestBuffer));
+			OCEAN_EXPECT_TRUE(validation, decompressor.isFinished());
+
+			OCEAN_EXPECT_TRUE(validation, uncompressedBuffer == streamTestBuffer);
+		}
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Singlecore: Best: " << performanceSingleCore.bestMseconds() << "ms, worst: " << performanceSingleCore.worstMseconds() << "ms, average: " << performanceSingleCore.averageMseconds() << "ms";
+	Log::info() << "Multicore: Best: " << performanceMultiCore.bestMseconds() << "ms, worst: " << performanceMultiCore.worstMseconds() << "ms, average: " << performanceMultiCore.averageMseconds() << "ms";
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
+bool TestCompression::testGzipStreamCompression(const double testDuration)
+{
+	Log::info() << "Gzip stream compression test:";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		const IO::Compression::CompressionLevel compressionLevel = IO::Compression::CompressionLevel(RandomI::random(randomGenerator, 2u));
+
+		IO::Compression::GzipStreamCompressor compressor(compressionLevel);
+		OCEAN_EXPECT_TRUE(validation, compressor.isValid());
+
+		// the compressor is used for several streams
+
+		const unsigned int numberStreams = RandomI::random(randomGenerator, 1u, 3u);
+
+		for (unsigned int nStream = 0u; nStream < numberStreams; ++nStream)
+		{
+			IO::Compression::Buffer uncompressedBuffer;
+			IO::Compression::Buffer compressedBuffer;
+
+			const unsigned int numberChunks = RandomI::random(randomGenerator, 1u, 20u);
+
+			for (unsigned int nChunk = 0u; nChunk < numberChunks; ++nChunk)
+			{
+				const IO::Compression::Buffer chunk = createBuffer(size_t(RandomI::random(randomGenerator, 0u, 100000u)), randomGenerator);
+
+				OCEAN_EXPECT_TRUE(validation, compressor.compress(chunk.data(), chunk.size(), compressedBuffer));
+
+				uncompressedBuffer.insert(uncompressedBuffer.end(), chunk.cbegin(), chunk.cend());
+			}
+
+			OCEAN_EXPECT_TRUE(validation, compressor.finish(compressedBuffer));
+
+			// the stream must be compatible with the buffer-based decompression
+
+			IO::Compression::Buffer testBuffer;
+			OCEAN_EXPECT_TRUE(validation, IO::Compression::gzipDecompress(compressedBuffer.data(), compressedBuffer.size(), testBuffer));
+
+			OCEAN_EXPECT_TRUE(validation, uncompressedBuffer == testBuffer);
+
+			// now, we decompress the stream in random chunks
+
+			IO::Compression::GzipStreamDecompressor decompressor;
+			IO::Compression::Buffer streamTestBuffer;
+
+			size_t position = 0;
+
+			while (position < compressedBuffer.size())
+			{
+				const size_t chunkSize = std::min(size_t(RandomI::random(randomGenerator, 1u, 10000u)), compressedBuffer.size() - position);
+
+				OCEAN_EXPECT_TRUE(validation, decompressor.decompress(compressedBuffer.data() + position, chunkSize, streamTestBuffer));
+
+				position += chunkSize;
+			}
+
+			OCEAN_EXPECT_TRUE(validation, decompressor.isFinished());
+
+			OCEAN_EXPECT_TRUE(validation, uncompressedBuffer == streamTestBuffer);
+		}
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
+bool TestCompression::testZlibDictionaryCompression(const double testDuration)
+{
+	Log::info() << "Zlib dictionary compression test:";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	uint64_t sizeWithDictionary = 0ull;
+	uint64_t sizeWithoutDictionary = 0ull;
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		// the dictionary contains typical content of the small samples
+
+		const IO::Compression::Buffer dictionary = createBuffer(size_t(RandomI::random(randomGenerator, 1000u, 4000u)), randomGenerator);
+
+		const size_t sampleSize = size_t(RandomI::random(randomGenerator, 1u, 500u));
+		const size_t sampleOffset = size_t(RandomI::random(randomGenerator, (unsigned int)(dictionary.size() - sampleSize)));
+
+		IO::Compression::Buffer sample(dictionary.cbegin() + sampleOffset, dictionary.cbegin() + sampleOffset + sampleSize);
+
+		// we modify a few bytes
+
+		for (unsigned int n = 0u; n < 5u; ++n)
+		{
+			sample[RandomI::random(randomGenerator, (unsigned int)(sample.size() - 1))] = uint8_t(RandomI::random(randomGenerator, 255u));
+		}
+
+		const IO::Compression::CompressionLevel compressionLevel = IO::Compression::CompressionLevel(RandomI::random(randomGenerator, 2u));
+
+		IO::Compression::Buffer compressedWithDictionary;
+		OCEAN_EXPECT_TRUE(validation, IO::Compression::zlibCompress(sample.data(), sample.size(), compressedWithDictionary, dictionary.data(), dictionary.size(), compressionLevel));
+
+		IO::Compression::Buffer compressedWithoutDictionary;
+		OCEAN_EXPECT_TRUE(validation, IO::Compression::zlibCompress(sample.data(), sample.size(), compressedWithoutDictionary, nullptr, 0, compressionLevel));
+
+		sizeWithDictionary += uint64_t(compressedWithDictionary.size());
+		sizeWithoutDictionary += uint64_t(compressedWithoutDictionary.size());
+
+		IO::Compression::Buffer testBuffer;
+		OCEAN_EXPECT_TRUE(validation, IO::Compression::zlibDecompress(compressedWithDictionary.data(), compressedWithDictionary.size(), testBuffer, dictionary.data(), dictionary.size()));
+		OCEAN_EXPECT_TRUE(validation, sample == testBuffer);
+
+		testBuffer.clear();
+		OCEAN_EXPECT_TRUE(validation, IO::Compression::zlibDecompress(compressedWithoutDictionary.data(), compressedWithoutDictionary.size(), testBuffer));
+		OCEAN_EXPECT_TRUE(validation, sample == testBuffer);
+
+		// the decompression must fail without the dictionary
+
+		testBuffer.clear();
+		OCEAN_EXPECT_FALSE(validation, IO::Compression::zlibDecompress(compressedWithDictionary.data(), compressedWithDictionary.size(), testBuffer));
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Average compression ratio with dictionary: " << String::toAString(double(sizeWithDictionary) / double(std::max(sizeWithoutDictionary, uint64_t(1u))) * 100.0, 1u) << "% of the size without dictionary";
+
+	OCEAN_EXPECT_LESS_EQUAL(validation, sizeWithDictionary, sizeWithoutDictionary);
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
+IO::Compression::Buffer TestCompression::createBuffer(const size_t size, RandomGenerator& randomGenerator)
+{
+	// we create a buffer with repeating words, so that the buffer can be compressed well
+
+	IO::Compression::Buffer buffer;
+	buffer.reserve(size);
+
+	while (buffer.size() < size)
+	{
+		const unsigned int wordLength = RandomI::random(randomGenerator, 1u, 8u);
+		const uint8_t character = uint8_t('a' + RandomI::random(randomGenerator, 7u));
+
+		for (unsigned int n = 0u; n < wordLength && buffer.size() < size; ++n)
+		{
+			buffer.emplace_back(character + uint8_t(n));
+		}
+	}
+
+	return buffer;
+}
+
 }
 
 }
@@ -12,6 +12,10 @@
 
 #include "ocean/test/TestSelector.h"
 
+#include "ocean/base/RandomGenerator.h"
+
+#include "ocean/io/Compression.h"
+
 namespace Ocean
 {
 
@@ -43,6 +47,37 @@ class OCEAN_TEST_IO_EXPORT TestCompression
 		 * @return True, if succeeded
 		 */
 		static bool testGzipCompression(const double testDuration);
+
+		/**
+		 * Tests the gzip compression with several blocks compressed in parallel.
+		 * @param testDuration The number of seconds for each test
+		 * @return True, if succeeded
+		 */
+		static bool testGzipBlockCompression(const double testDuration);
+
+		/**
+		 * Tests the gzip stream compressor and decompressor.
+		 * @param testDuration The number of seconds for each test
+		 * @return True, if succeeded
+		 */
+		static bool testGzipStreamCompression(const double testDuration);
+
+		/**
+		 * Tests the zlib compression with preset dictionary.
+		 * @param testDuration The number of seconds for each test
+		 * @return True, if succeeded
+		 */
+		static bool testZlibDictionaryCompression(const double testDuration);
+
+	protected:
+
+		/**
+		 * Creates a random buffer which can be compressed.
+		 * @param size The size of the buffer, in bytes
+		 * @param randomGenerator The random generator to be used
+		 * @return The resulting buffer
+		 */
+		static IO::Compression::Buffer createBuffer(const size_t size, RandomGenerator& randomGenerator);
 };
 
 }
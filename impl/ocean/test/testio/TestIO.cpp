@@ -13,6 +13,7 @@
 #include "ocean/test/testio/TestDirectory.h"
 #include "ocean/test/testio/TestFile.h"
 #include "ocean/test/testio/TestJSONParser.h"
+#include "ocean/test/testio/TestMemoryMappedFile.h"
 #include "ocean/test/testio/TestUtilities.h"
 
 #include "ocean/test/TestResult.h"
@@ -118,6 +119,15 @@ bool testIO(const double testDuration, const std::string& testFunctions)
 		testResult = TestFile::test(testDuration, subSelector);
 	}
 
+	if (TestSelector subSelector = selector.shouldRun("memorymappedfile"))
+	{
+		Log::info() << " ";
+		Log::info() << " ";
+		Log::info() << " ";
+		Log::info() << " ";
+		testResult = TestMemoryMappedFile::test(testDuration, subSelector);
+	}
+
 	if (TestSelector subSelector = selector.shouldRun("utilities"))
 	{
 		Log::info() << " ";
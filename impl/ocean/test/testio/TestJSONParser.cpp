@@ -14,6 +14,7 @@
 
 #include "ocean/math/Random.h"
 
+#include "ocean/io/JSONDocument.h"
 #include "ocean/io/JSONParser.h"
 
 #include "ocean/test/Validation.h"
@@ -281,6 +282,33 @@ bool TestJSONParser::test(const double testDuration, const TestSelector& selecto
 		Log::info() << " ";
 	}
 
+	if (selector.shouldRun("documentstructuralindex"))
+	{
+		testResult = testDocumentStructuralIndex(testDuration);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
+	if (selector.shouldRun("document"))
+	{
+		testResult = testDocument(testDuration);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
+	if (selector.shouldRun("documenterrorhandling"))
+	{
+		testResult = testDocumentErrorHandling();
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
 	Log::info() << testResult;
 
 	return testResult.succeeded();
@@ -328,6 +356,21 @@ TEST(TestJSONParser, StrictAndLenientParsing)
 	EXPECT_TRUE(TestJSONParser::testStrictAndLenientParsing());
 }
 
+TEST(TestJSONParser, DocumentStructuralIndex)
+{
+	EXPECT_TRUE(TestJSONParser::testDocumentStructuralIndex(GTEST_TEST_DURATION));
+}
+
+TEST(TestJSONParser, Document)
+{
+	EXPECT_TRUE(TestJSONParser::testDocument(GTEST_TEST_DURATION));
+}
+
+TEST(TestJSONParser, DocumentErrorHandling)
+{
+	EXPECT_TRUE(TestJSONParser::testDocumentErrorHandling());
+}
+
 #endif // OCEAN_USE_GTEST
 
 bool TestJSONParser::testPrimitives(const double testDuration)
@@ -1250,6 +1293,279 @@ bool TestJSONParser::testStrictAndLenientParsing()
 	return validation.succeeded();
 }
 
+bool TestJSONParser::testDocumentStructuralIndex(const double testDuration)
+{
+	Log::info() << "Document structural index test:";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		// random JSON data with random whitespace, the data does not need to be valid JSON
+
+		const std::string characters = "{}[]:,\"\\ \t\nab01";
+
+		const size_t size = size_t(RandomI::random(randomGenerator, 0u, 300u));
+
+		std::string buffer(size, ' ');
+
+		for (char& character : buffer)
+		{
+			character = characters[RandomI::random(randomGenerator, (unsigned int)(characters.size()) - 1u)];
+		}
+
+		IO::JSONDocument::Indices expectedStructurals;
+
+		bool insideString = false;
+		bool escaped = false;
+
+		for (size_t n = 0; n < buffer.size(); ++n)
+		{
+			const char character = buffer[n];
+
+			if (escaped)
+			{
+				// the character following a backslash is escaped, an escaped quote is not structural
+
+				escaped = false;
+
+				if (character == '\"')
+				{
+					continue;
+				}
+			}
+			else if (character == '\\')
+			{
+				escaped = true;
+				continue;
+			}
+
+			if (character == '\"')
+			{
+				insideString = !insideString;
+				expectedStructurals.emplace_back(uint32_t(n));
+				continue;
+			}
+
+			if (!insideString && (character == '{' || character == '}' || character == '[' || character == ']' || character == ':' || character == ','))
+			{
+				expectedStructurals.emplace_back(uint32_t(n));
+			}
+		}
+
+		IO::JSONDocument::Indices structurals;
+		const bool result = IO::JSONDocument::determineStructurals(buffer, structurals);
+
+		OCEAN_EXPECT_EQUAL(validation, result, !insideString);
+		OCEAN_EXPECT_EQUAL(validation, structurals, expectedStructurals);
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
+bool TestJSONParser::testDocument(const double testDuration)
+{
+	Log::info() << "Document test:";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	{
+		const std::string jsonString = "{\"name\": \"camera\", \"values\": [1, 2.5, -3e2, {\"nested\": [true, false, null]}], \"escaped\": \"a\\\"b\\\\c\\n\\u00e4\", \"empty\": {}, \"name\": \"second\"}";
+
+		std::string errorMessage;
+		const IO::JSONDocument document(jsonString, true, &errorMessage);
+
+		OCEAN_EXPECT_TRUE(validation, document.isValid());
+		OCEAN_EXPECT_TRUE(validation, errorMessage.empty());
+
+		const IO::JSONDocument::Value root = document.root();
+
+		OCEAN_EXPECT_TRUE(validation, root.isObject());
+		OCEAN_EXPECT_EQUAL(validation, root.size(), size_t(5));
+
+		// the last member with the same key is used, like the JSONParser does
+		OCEAN_EXPECT_EQUAL(validation, root.valueFromObject("name").stringView(), std::string_view("second"));
+
+		OCEAN_EXPECT_FALSE(validation, root.valueFromObject("unknown").isValid());
+		OCEAN_EXPECT_FALSE(validation, root.valueFromArray(0).isValid());
+
+		const IO::JSONDocument::Value values = root.valueFromObject("values");
+
+		OCEAN_EXPECT_TRUE(validation, values.isArray());
+		OCEAN_EXPECT_EQUAL(validation, values.size(), size_t(4));
+		OCEAN_EXPECT_EQUAL(validation, values.valueFromArray(0).number(), 1.0);
+		OCEAN_EXPECT_EQUAL(validation, values.valueFromArray(1).number(), 2.5);
+		OCEAN_EXPECT_EQUAL(validation, values.valueFromArray(2).number(), -300.0);
+		OCEAN_EXPECT_FALSE(validation, values.valueFromArray(4).isValid());
+
+		const IO::JSONDocument::Value nested = values.valueFromArray(3).valueFromObject("nested");
+
+		OCEAN_EXPECT_TRUE(validation, nested.isArray());
+		OCEAN_EXPECT_TRUE(validation, nested.valueFromArray(0).isBoolean() && nested.valueFromArray(0).boolean());
+		OCEAN_EXPECT_TRUE(validation, nested.valueFromArray(1).isBoolean() && !nested.valueFromArray(1).boolean());
+		OCEAN_EXPECT_TRUE(validation, nested.valueFromArray(2).isNull());
+
+		const IO::JSONDocument::Value escaped = root.valueFromObject("escaped");
+
+		OCEAN_EXPECT_EQUAL(validation, escaped.stringView(), std::string_view("a\\\"b\\\\c\\n\\u00e4"));
+		OCEAN_EXPECT_EQUAL(validation, escaped.string(), std::string("a\"b\\c\n\xC3\xA4"));
+
+		const IO::JSONDocument::Value empty = root.valueFromObject("empty");
+
+		OCEAN_EXPECT_TRUE(validation, empty.isObject());
+		OCEAN_EXPECT_EQUAL(validation, empty.size(), size_t(0));
+		OCEAN_EXPECT_TRUE(validation, empty.begin() == empty.end());
+	}
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		const unsigned int depth = RandomI::random(randomGenerator, 0u, 5u);
+
+		const JSONTestData testData = JSONTestData::randomValue(randomGenerator, depth);
+
+		std::string jsonString = testData.jsonString_;
+
+		if (RandomI::boolean(randomGenerator))
+		{
+			// additional whitespace around the root value
+			jsonString = "\n\t " + jsonString + " \r\n";
+		}
+
+		std::string errorMessage;
+		const IO::JSONDocument document(std::move(jsonString), RandomI::boolean(randomGenerator), &errorMessage);
+
+		OCEAN_EXPECT_TRUE(validation, document.isValid());
+		OCEAN_EXPECT_TRUE(validation, errorMessage.empty());
+
+		if (document.isValid())
+		{
+			const IO::JSONDocument::Value root = document.root();
+
+			if (!compareDocumentValues(validation, root, testData.expectedValue_))
+			{
+				Log::error() << "Document value does not match expected value for JSON: " << testData.jsonString_;
+			}
+
+			// the conversion must result in the same values as the JSONParser
+
+			if (!compareJSONValues(validation, root.toJSONValue(), testData.expectedValue_))
+			{
+				Log::error() << "Converted value does not match expected value for JSON: " << testData.jsonString_;
+			}
+		}
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
+bool TestJSONParser::testDocumentErrorHandling()
+{
+	Log::info() << "Document error handling test:";
+
+	Validation validation;
+
+	const std::vector<std::string> invalidJSONs =
+	{
+		"",
+		"   ",
+		"[1, 2, 3",
+		"{\"key\": \"value\"",
+		"{\"key\" \"value\"}",
+		"{key: \"value\"}",
+		"[1 2]",
+		"[1, , 2]",
+		"[,]",
+		"\"unterminated",
+		"[\"unterminated\\\"]",
+		"[1, 2}",
+		"{\"key\": 1]",
+		"]",
+		"[tru]",
+		"[nul]",
+		"[01]",
+		"[1.]",
+		"[-]",
+		"[1e]",
+		"[\"a\" \"b\"]",
+		"{\"a\": 1 x}"
+	};
+
+	for (const bool strict : {false, true})
+	{
+		for (const std::string& invalidJSON : invalidJSONs)
+		{
+			std::string errorMessage;
+			const IO::JSONDocument document(invalidJSON, strict, &errorMessage);
+
+			OCEAN_EXPECT_FALSE(validation, document.isValid());
+			OCEAN_EXPECT_FALSE(validation, errorMessage.empty());
+			OCEAN_EXPECT_FALSE(validation, document.root().isValid());
+		}
+	}
+
+	const std::vector<std::string> lenientJSONs =
+	{
+		"[1, 2, 3,]",
+		"{\"key\": \"value\",}",
+		"{\"key\": [1, {\"a\": true,},],}",
+		"[1] trailing"
+	};
+
+	for (const std::string& lenientJSON : lenientJSONs)
+	{
+		std::string errorMessage;
+		const IO::JSONDocument lenientDocument(lenientJSON, false, &errorMessage);
+
+		OCEAN_EXPECT_TRUE(validation, lenientDocument.isValid());
+		OCEAN_EXPECT_TRUE(validation, errorMessage.empty());
+
+		const IO::JSONDocument strictDocument(lenientJSON, true, &errorMessage);
+
+		OCEAN_EXPECT_FALSE(validation, strictDocument.isValid());
+		OCEAN_EXPECT_FALSE(validation, errorMessage.empty());
+
+		if (lenientDocument.isValid())
+		{
+			// the lenient document must provide the same values as the lenient JSONParser
+
+			const IO::JSONParser::JSONValue expectedValue = IO::JSONParser::parse("", lenientJSON, false);
+
+			OCEAN_EXPECT_TRUE(validation, expectedValue.isValid());
+
+			if (expectedValue.isValid())
+			{
+				compareDocumentValues(validation, lenientDocument.root(), expectedValue);
+			}
+		}
+	}
+
+	{
+		// the error message contains the position of the error
+
+		std::string errorMessage;
+		const IO::JSONDocument document(std::string_view("{\n  \"key\": [1,\n  2 3]\n}"), false, &errorMessage);
+
+		OCEAN_EXPECT_FALSE(validation, document.isValid());
+		OCEAN_EXPECT_TRUE(validation, errorMessage.find("line 3, column 3") != std::string::npos);
+	}
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
 bool TestJSONParser::compareJSONValues(Validation& validation, const IO::JSONParser::JSONValue& parsed, const IO::JSONParser::JSONValue& expected)
 {
 	if (parsed.isNull() && expected.isNull())
@@ -1333,6 +1649,86 @@ bool TestJSONParser::compareJSONValues(Validation& validation, const IO::JSONPar
 	return false;
 }
 
+bool TestJSONParser::compareDocumentValues(Validation& validation, const IO::JSONDocument::Value& value, const IO::JSONParser::JSONValue& expected)
+{
+	OCEAN_EXPECT_EQUAL(validation, value.type(), expected.type());
+
+	if (value.type() != expected.type())
+	{
+		return false;
+	}
+
+	switch (expected.type())
+	{
+		case IO::JSONParser::JSONValue::TYPE_INVALID:
+		case IO::JSONParser::JSONValue::TYPE_NULL:
+			return true;
+
+		case IO::JSONParser::JSONValue::TYPE_BOOLEAN:
+			OCEAN_EXPECT_EQUAL(validation, value.boolean(), expected.boolean());
+			return value.boolean() == expected.boolean();
+
+		case IO::JSONParser::JSONValue::TYPE_NUMBER:
+			OCEAN_EXPECT_TRUE(validation, NumericD::isEqual(value.number(), expected.number(), 0.001));
+			return NumericD::isEqual(value.number(), expected.number(), 0.001);
+
+		case IO::JSONParser::JSONValue::TYPE_STRING:
+			OCEAN_EXPECT_EQUAL(validation, value.stringView(), std::string_view(expected.string()));
+			return value.stringView() == expected.string();
+
+		case IO::JSONParser::JSONValue::TYPE_ARRAY:
+		{
+			const IO::JSONParser::JSONValue::Array& expectedArray = expected.array();
+
+			OCEAN_EXPECT_EQUAL(validation, value.size(), expectedArray.size());
+
+			size_t index = 0;
+
+			for (IO::JSONDocument::Iterator iterator = value.begin(); iterator != value.end(); ++iterator)
+			{
+				if (index >= expectedArray.size() || !compareDocumentValues(validation, *iterator, expectedArray[index]))
+				{
+					OCEAN_SET_FAILED(validation);
+					return false;
+				}
+
+				if (!compareDocumentValues(validation, value.valueFromArray(index), expectedArray[index]))
+				{
+					return false;
+				}
+
+				++index;
+			}
+
+			return index == expectedArray.size();
+		}
+
+		case IO::JSONParser::JSONValue::TYPE_OBJECT:
+		{
+			const IO::JSONParser::JSONValue::ObjectMap& expectedObject = expected.object();
+
+			OCEAN_EXPECT_EQUAL(validation, value.size(), expectedObject.size());
+
+			for (const IO::JSONParser::JSONValue::ObjectMap::value_type& expectedMember : expectedObject)
+			{
+				const IO::JSONDocument::Value memberValue = value.valueFromObject(expectedMember.first);
+
+				OCEAN_EXPECT_TRUE(validation, memberValue.isValid());
+
+				if (!memberValue.isValid() || !compareDocumentValues(validation, memberValue, expectedMember.second))
+				{
+					return false;
+				}
+			}
+
+			return true;
+		}
+	}
+
+	OCEAN_SET_FAILED(validation);
+	return false;
+}
+
 } // namespace TestIO
 
 } // namespace Test
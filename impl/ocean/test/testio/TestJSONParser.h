@@ -12,6 +12,7 @@
 
 #include "ocean/base/RandomGenerator.h"
 
+#include "ocean/io/JSONDocument.h"
 #include "ocean/io/JSONParser.h"
 
 #include "ocean/test/TestSelector.h"
@@ -143,8 +144,37 @@ class OCEAN_TEST_IO_EXPORT TestJSONParser
 		*/
 		static bool testStrictAndLenientParsing();
 
+		/**
+		 * Tests the structural index of the JSONDocument against a character-by-character reference implementation.
+		 * @param testDuration The number of seconds for each test
+		 * @return True, if succeeded
+		 */
+		static bool testDocumentStructuralIndex(const double testDuration);
+
+		/**
+		 * Tests the lazy access to randomly generated JSON structures with the JSONDocument.
+		 * @param testDuration The number of seconds for each test
+		 * @return True, if succeeded
+		 */
+		static bool testDocument(const double testDuration);
+
+		/**
+		 * Tests error handling of the JSONDocument with invalid JSON and the strict and lenient parsing modes.
+		 * @return True, if succeeded
+		 */
+		static bool testDocumentErrorHandling();
+
 	protected:
 
+		/**
+		 * Compares a value of a JSONDocument with a value of the JSONParser by using the lazy access functions of the document.
+		 * @param validation The validation object
+		 * @param value The document's value
+		 * @param expected The expected value
+		 * @return True, if both values are equal
+		 */
+		static bool compareDocumentValues(Validation& validation, const IO::JSONDocument::Value& value, const IO::JSONParser::JSONValue& expected);
+
 		/**
 		 * Compares two JSON values for equality.
 		 * @param validation The validation object
@@ -0,0 +1,207 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "ocean/test/testio/TestMemoryMappedFile.h"
+
+#include "ocean/test/TestResult.h"
+#include "ocean/test/Validation.h"
+
+#include "ocean/base/RandomI.h"
+#include "ocean/base/Timestamp.h"
+
+#include "ocean/io/Directory.h"
+#include "ocean/io/File.h"
+#include "ocean/io/MemoryMappedFile.h"
+
+namespace Ocean
+{
+
+namespace Test
+{
+
+namespace TestIO
+{
+
+bool TestMemoryMappedFile::test(const double testDuration, const TestSelector& selector)
+{
+	TestResult testResult("MemoryMappedFile test");
+	Log::info() << " ";
+
+	if (selector.shouldRun("mapping"))
+	{
+		testResult = testMapping(testDuration);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
+	if (selector.shouldRun("invalidfile"))
+	{
+		testResult = testInvalidFile(testDuration);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
+	Log::info() << testResult;
+
+	return testResult.succeeded();
+}
+
+#ifdef OCEAN_USE_GTEST
+
+TEST(TestMemoryMappedFile, Mapping)
+{
+	EXPECT_TRUE(TestMemoryMappedFile::testMapping(GTEST_TEST_DURATION));
+}
+
+TEST(TestMemoryMappedFile, InvalidFile)
+{
+	EXPECT_TRUE(TestMemoryMappedFile::testInvalidFile(GTEST_TEST_DURATION));
+}
+
+#endif // OCEAN_USE_GTEST
+
+bool TestMemoryMappedFile::testMapping(const double testDuration)
+{
+	Log::info() << "Mapping test:";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		const IO::ScopedDirectory scopedDirectory(IO::Directory::createTemporaryDirectory());
+
+		if (!scopedDirectory.isValid() || !scopedDirectory.exists())
+		{
+			OCEAN_SET_FAILED(validation);
+			break;
+		}
+
+		const IO::File file(scopedDirectory + IO::File("mapped_file.bin"));
+
+		const size_t numberElements = size_t(RandomI::random(randomGenerator, 1u, 100000u));
+
+		Indices32 content(numberElements);
+		for (Index32& value : content)
+		{
+			value = RandomI::random32(randomGenerator);
+		}
+
+		{
+			std::ofstream stream(file().c_str(), std::ios::binary);
+
+			stream.write((const char*)(content.data()), std::streamsize(content.size() * sizeof(Index32)));
+
+			OCEAN_EXPECT_TRUE(validation, stream.good());
+		}
+
+		{
+			IO::MemoryMappedFile memoryMappedFile(file());
+
+			if (!memoryMappedFile.isValid())
+			{
+				OCEAN_SET_FAILED(validation);
+				break;
+			}
+
+			OCEAN_EXPECT_EQUAL(validation, memoryMappedFile.size(), content.size() * sizeof(Index32));
+			OCEAN_EXPECT_EQUAL(validation, memoryMappedFile.filename(), file());
+
+			const Index32* mappedContent = memoryMappedFile.constdata<Index32>();
+
+			OCEAN_EXPECT_EQUAL(validation, memcmp(mappedContent, content.data(), content.size() * sizeof(Index32)), 0);
+
+			const size_t elementIndex = size_t(RandomI::random(randomGenerator, (unsigned int)(numberElements - 1)));
+
+			OCEAN_EXPECT_EQUAL(validation, *memoryMappedFile.constdata<Index32>(elementIndex * sizeof(Index32)), content[elementIndex]);
+
+			IO::MemoryMappedFile movedMemoryMappedFile(std::move(memoryMappedFile));
+
+			OCEAN_EXPECT_FALSE(validation, memoryMappedFile.isValid());
+			OCEAN_EXPECT_TRUE(validation, bool(movedMemoryMappedFile));
+			OCEAN_EXPECT_EQUAL(validation, movedMemoryMappedFile.size(), content.size() * sizeof(Index32));
+			OCEAN_EXPECT_TRUE(validation, movedMemoryMappedFile.constdata() == mappedContent);
+
+			movedMemoryMappedFile.release();
+
+			OCEAN_EXPECT_FALSE(validation, movedMemoryMappedFile.isValid());
+			OCEAN_EXPECT_EQUAL(validation, movedMemoryMappedFile.size(), size_t(0));
+		}
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
+bool TestMemoryMappedFile::testInvalidFile(const double testDuration)
+{
+	Log::info() << "Invalid file test:";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		const IO::ScopedDirectory scopedDirectory(IO::Directory::createTemporaryDirectory());
+
+		if (!scopedDirectory.isValid() || !scopedDirectory.exists())
+		{
+			OCEAN_SET_FAILED(validation);
+			break;
+		}
+
+		{
+			// a file which does not exist
+
+			const IO::File file(scopedDirectory + IO::File("not_existing_" + String::toAString(RandomI::random(randomGenerator, 1000u)) + ".bin"));
+
+			const IO::MemoryMappedFile memoryMappedFile(file());
+
+			OCEAN_EXPECT_FALSE(validation, memoryMappedFile.isValid());
+			OCEAN_EXPECT_TRUE(validation, memoryMappedFile.constdata() == nullptr);
+			OCEAN_EXPECT_EQUAL(validation, memoryMappedFile.size(), size_t(0));
+		}
+
+		{
+			// an empty file cannot be mapped
+
+			const IO::File file(scopedDirectory + IO::File("empty.bin"));
+
+			{
+				std::ofstream stream(file().c_str(), std::ios::binary);
+				OCEAN_EXPECT_TRUE(validation, stream.good());
+			}
+
+			OCEAN_EXPECT_TRUE(validation, file.exists());
+
+			const IO::MemoryMappedFile memoryMappedFile(file());
+
+			OCEAN_EXPECT_FALSE(validation, memoryMappedFile.isValid());
+		}
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
+}
+
+}
+
+}
@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#ifndef META_OCEAN_TEST_TESTIO_TEST_MEMORY_MAPPED_FILE_H
+#define META_OCEAN_TEST_TESTIO_TEST_MEMORY_MAPPED_FILE_H
+
+#include "ocean/test/testio/TestIO.h"
+
+#include "ocean/test/TestSelector.h"
+
+namespace Ocean
+{
+
+namespace Test
+{
+
+namespace TestIO
+{
+
+/**
+ * This class implements tests for the MemoryMappedFile class.
+ * @ingroup testio
+ */
+class OCEAN_TEST_IO_EXPORT TestMemoryMappedFile
+{
+	public:
+
+		/**
+		 * Invokes all tests.
+		 * @param testDuration The number of seconds for each test
+		 * @param selector The test selector
+		 * @return True, if succeeded
+		 */
+		static bool test(const double testDuration, const TestSelector& selector);
+
+		/**
+		 * Tests mapping files with random content.
+		 * @param testDuration The number of seconds for each test
+		 * @return True, if succeeded
+		 */
+		static bool testMapping(const double testDuration);
+
+		/**
+		 * Tests mapping invalid files.
+		 * @param testDuration The number of seconds for each test
+		 * @return True, if succeeded
+		 */
+		static bool testInvalidFile(const double testDuration);
+};
+
+}
+
+}
+
+}
+
+#endif // META_OCEAN_TEST_TESTIO_TEST_MEMORY_MAPPED_FILE_H
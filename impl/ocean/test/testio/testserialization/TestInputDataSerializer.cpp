@@ -141,6 +141,15 @@ bool TestInputDataSerializer::test(const double testDuration, const TestSelector
 		Log::info() << " ";
 	}
 
+	if (selector.shouldRun("chunkedlayout"))
+	{
+		testResult = testChunkedLayout(testDuration);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
 	Log::info() << testResult;
 
 	return testResult.succeeded();
@@ -163,6 +172,11 @@ TEST(InputDataSerializer, Sample)
 	EXPECT_TRUE(TestInputDataSerializer::testSample(GTEST_TEST_DURATION));
 }
 
+TEST(InputDataSerializer, ChunkedLayout)
+{
+	EXPECT_TRUE(TestInputDataSerializer::testChunkedLayout(GTEST_TEST_DURATION));
+}
+
 #endif // OCEAN_USE_GTEST
 
 bool TestInputDataSerializer::testFactoryFunction()
@@ -418,6 +432,165 @@ bool TestInputDataSerializer::testSample(const double testDuration)
 	return validation.succeeded();
 }
 
+bool TestInputDataSerializer::testChunkedLayout(const double testDuration)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Chunked layout test:";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		const IO::ScopedDirectory scopedDirectory(IO::Directory::createTemporaryDirectory());
+
+		if (!scopedDirectory.exists())
+		{
+			OCEAN_SET_FAILED(validation);
+			continue;
+		}
+
+		const std::string tempFilename = (scopedDirectory + IO::File("test_chunked.dat"))();
+
+		const unsigned int numberSamples = RandomI::random(randomGenerator, 50u, 200u);
+		const size_t chunkSize = size_t(RandomI::random(randomGenerator, 64u, 1024u));
+		const unsigned int compressionThreads = RandomI::random(randomGenerator, 0u, 4u);
+
+		IO::Serialization::DataSerializer::ChannelId channelIds[2] = {IO::Serialization::DataSerializer::invalidChannelId(), IO::Serialization::DataSerializer::invalidChannelId()};
+
+		{
+			IO::Serialization::FileOutputDataSerializer outputSerializer;
+			OCEAN_EXPECT_TRUE(validation, outputSerializer.setFilename(tempFilename));
+			OCEAN_EXPECT_TRUE(validation, outputSerializer.setChunkedLayout(chunkSize, compressionThreads));
+
+			channelIds[0] = outputSerializer.addChannel("SimpleTestDataSampleInput", "TestChannelA", "TestContent");
+			channelIds[1] = outputSerializer.addChannel("SimpleTestDataSampleInput", "TestChannelB", "TestContent");
+
+			OCEAN_EXPECT_TRUE(validation, outputSerializer.start());
+
+			const Timestamp creationTimestamp(true);
+
+			for (unsigned int nSample = 0u; nSample < numberSamples; ++nSample)
+			{
+				// the samples are created with increasing timestamps, so that the playback timestamps increase by 10ms
+
+				const IO::Serialization::DataTimestamp dataTimestamp{double(nSample)};
+				const std::string payload = "Sample_" + String::toAString(nSample);
+
+				IO::Serialization::UniqueDataSample sample = std::make_unique<SimpleTestDataSampleInput>(dataTimestamp, payload, creationTimestamp + double(nSample) * 0.01);
+
+				OCEAN_EXPECT_TRUE(validation, outputSerializer.addSample(channelIds[nSample % 2u], std::move(sample)));
+			}
+
+			OCEAN_EXPECT_TRUE(validation, outputSerializer.stopAndWait(10.0));
+		}
+
+		const IO::Serialization::InputDataSerializer::FactoryFunction factoryFunction = [](const std::string&)
+		{
+			return std::make_unique<SimpleTestDataSampleInput>();
+		};
+
+		// first, we read all samples, second we seek and subscribe to one channel only
+
+		std::vector<std::pair<IO::Serialization::DataSerializer::ChannelId, double>> allSamples;
+
+		for (const bool seekAndSubscribe : {false, true})
+		{
+			IO::Serialization::FileInputDataSerializer serializer;
+			OCEAN_EXPECT_TRUE(validation, serializer.setFilename(tempFilename));
+			OCEAN_EXPECT_TRUE(validation, serializer.registerFactoryFunction("SimpleTestDataSampleInput", factoryFunction));
+
+			IO::Serialization::DataSerializer::Channels preparsedChannels;
+			bool isStreamCorrupted = true;
+
+			if (!serializer.initialize(&preparsedChannels, &isStreamCorrupted))
+			{
+				OCEAN_SET_FAILED(validation);
+				break;
+			}
+
+			OCEAN_EXPECT_TRUE(validation, serializer.hasChunkIndex());
+			OCEAN_EXPECT_FALSE(validation, isStreamCorrupted);
+			OCEAN_EXPECT_EQUAL(validation, preparsedChannels.size(), size_t(2));
+
+			const IO::Serialization::DataSerializer::ChannelId subscribedChannelId = channelIds[RandomI::random(randomGenerator, 1u)];
+			double seekPlaybackTimestamp = 0.0;
+
+			if (seekAndSubscribe)
+			{
+				if (allSamples.empty())
+				{
+					OCEAN_SET_FAILED(validation);
+					break;
+				}
+
+				seekPlaybackTimestamp = allSamples[RandomI::random(randomGenerator, (unsigned int)(allSamples.size()) - 1u)].second;
+
+				OCEAN_EXPECT_TRUE(validation, serializer.seek(seekPlaybackTimestamp));
+				OCEAN_EXPECT_TRUE(validation, serializer.setSubscribedChannels({subscribedChannelId}));
+			}
+
+			OCEAN_EXPECT_TRUE(validation, serializer.start());
+
+			std::vector<std::pair<IO::Serialization::DataSerializer::ChannelId, double>> samples;
+
+			const Timestamp readStartTimestamp(true);
+
+			while (!serializer.hasFinished() && !readStartTimestamp.hasTimePassed(10.0))
+			{
+				IO::Serialization::DataSerializer::ChannelId channelId = IO::Serialization::DataSerializer::invalidChannelId();
+				IO::Serialization::UniqueDataSample sample = serializer.sample(channelId, 0.0);
+
+				if (sample)
+				{
+					samples.emplace_back(channelId, sample->playbackTimestamp());
+				}
+				else
+				{
+					Thread::sleep(1u);
+				}
+			}
+
+			OCEAN_EXPECT_TRUE(validation, serializer.hasFinished());
+
+			if (!seekAndSubscribe)
+			{
+				OCEAN_EXPECT_EQUAL(validation, samples.size(), size_t(numberSamples));
+
+				allSamples = std::move(samples);
+			}
+			else
+			{
+				size_t expectedSamples = 0;
+
+				for (const std::pair<IO::Serialization::DataSerializer::ChannelId, double>& sample : allSamples)
+				{
+					if (sample.first == subscribedChannelId && sample.second >= seekPlaybackTimestamp)
+					{
+						++expectedSamples;
+					}
+				}
+
+				OCEAN_EXPECT_EQUAL(validation, samples.size(), expectedSamples);
+
+				for (const std::pair<IO::Serialization::DataSerializer::ChannelId, double>& sample : samples)
+				{
+					OCEAN_EXPECT_EQUAL(validation, sample.first, subscribedChannelId);
+					OCEAN_EXPECT_GREATER_EQUAL(validation, sample.second, seekPlaybackTimestamp);
+				}
+			}
+		}
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
 }
 
 }
@@ -63,6 +63,13 @@ class OCEAN_TEST_IO_SERIALIZATION_EXPORT TestInputDataSerializer
 		 * @return True, if succeeded
 		 */
 		static bool testSample(const double testDuration);
+
+		/**
+		 * Tests streams with chunked layout, including seeking and channel subscriptions.
+		 * @param testDuration The number of seconds for each test
+		 * @return True, if succeeded
+		 */
+		static bool testChunkedLayout(const double testDuration);
 };
 
 }
@@ -692,6 +692,61 @@ TestAnyCamera::VerificationResult TestAnyCamera::verifyAnyCamera(const AnyCamera
 		}
 	}
 
+	{
+		// testing batched projection and batched projection with point jacobians with random camera pose
+
+		const VectorT3<T> randomTranslationDirection = RandomT<T>::vector3(randomGenerator);
+		const T randomTranslationScale = RandomT<T>::scalar(randomGenerator, -10, 10);
+		const QuaternionT<T> randomRotation = RandomT<T>::quaternion(randomGenerator);
+
+		const HomogenousMatrixT4<T> world_T_camera(randomTranslationDirection * randomTranslationScale, randomRotation);
+		const HomogenousMatrixT4<T> flippedCamera_T_world(AnyCameraT<T>::standard2InvertedFlipped(world_T_camera));
+
+		// using an odd number of points to test the remaining points of SIMD implementations as well
+		const size_t numberPoints = size_t(RandomI::random(randomGenerator, 1u, 101u));
+
+		VectorsT3<T> objectPoints;
+		objectPoints.reserve(numberPoints);
+
+		for (size_t n = 0; n < numberPoints; ++n)
+		{
+			const VectorT2<T> imagePoint = RandomT<T>::vector2(randomGenerator, T(0), T(anyCamera.width() - 1u), T(0), T(anyCamera.height() - 1u));
+
+			objectPoints.emplace_back(world_T_camera * (anyCamera.vector(imagePoint) * RandomT<T>::scalar(randomGenerator, T(0.5), T(10))));
+		}
+
+		VectorsT2<T> imagePoints(numberPoints);
+		anyCamera.projectToImageIF(flippedCamera_T_world, objectPoints.data(), numberPoints, imagePoints.data());
+
+		VectorsT2<T> imagePointsWithJacobians(numberPoints);
+		std::vector<T> pointJacobians(numberPoints * 6);
+		anyCamera.projectToImageIF(flippedCamera_T_world, objectPoints.data(), numberPoints, imagePointsWithJacobians.data(), pointJacobians.data());
+
+		constexpr T maximalProjectionError = std::is_same<T, float>::value ? T(0.1) : T(0.001);
+
+		for (size_t n = 0; n < numberPoints; ++n)
+		{
+			const VectorT2<T> imagePoint = anyCamera.projectToImageIF(flippedCamera_T_world, objectPoints[n]);
+
+			if (imagePoints[n].distance(imagePoint) > maximalProjectionError || imagePointsWithJacobians[n].distance(imagePoint) > maximalProjectionError)
+			{
+				verificationResult = VR_LOW_PRECISION;
+			}
+
+			T jacobianX[3];
+			T jacobianY[3];
+			anyCamera.pointJacobian2x3IF(flippedCamera_T_world * objectPoints[n], jacobianX, jacobianY);
+
+			for (unsigned int i = 0u; i < 3u; ++i)
+			{
+				if (NumericT<T>::isNotWeakEqual(jacobianX[i], pointJacobians[n * 6 + i]) || NumericT<T>::isNotWeakEqual(jacobianY[i], pointJacobians[n * 6 + 3 + i]))
+				{
+					verificationResult = VR_LOW_PRECISION;
+				}
+			}
+		}
+	}
+
 	return verificationResult;
 }
 
@@ -11,6 +11,7 @@
 #include "ocean/base/Timestamp.h"
 
 #include "ocean/math/AutomaticDifferentiation.h"
+#include "ocean/math/AutomaticDifferentiationVector.h"
 #include "ocean/math/PinholeCamera.h"
 #include "ocean/math/Pose.h"
 #include "ocean/math/StaticMatrix.h"
@@ -91,6 +92,28 @@ bool TestAutomaticDifferentiation::test(const double testDuration, const TestSel
 		Log::info() << " ";
 	}
 
+	if (selector.shouldRun("vectorfunctions"))
+	{
+		testResult = testVectorFunctions<float>(testDuration);
+		Log::info() << " ";
+		testResult = testVectorFunctions<double>(testDuration);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
+	if (selector.shouldRun("vectorpose"))
+	{
+		testResult = testVectorPose<float>(testDuration);
+		Log::info() << " ";
+		testResult = testVectorPose<double>(testDuration);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
 	Log::info() << testResult;
 
 	return testResult.succeeded();
@@ -152,6 +175,28 @@ TEST(TestAutomaticDifferentiation, Pose_double)
 	EXPECT_TRUE(TestAutomaticDifferentiation::testPose<double>(GTEST_TEST_DURATION));
 }
 
+
+TEST(TestAutomaticDifferentiation, VectorFunctions_float)
+{
+	EXPECT_TRUE(TestAutomaticDifferentiation::testVectorFunctions<float>(GTEST_TEST_DURATION));
+}
+
+TEST(TestAutomaticDifferentiation, VectorFunctions_double)
+{
+	EXPECT_TRUE(TestAutomaticDifferentiation::testVectorFunctions<double>(GTEST_TEST_DURATION));
+}
+
+
+TEST(TestAutomaticDifferentiation, VectorPose_float)
+{
+	EXPECT_TRUE(TestAutomaticDifferentiation::testVectorPose<float>(GTEST_TEST_DURATION));
+}
+
+TEST(TestAutomaticDifferentiation, VectorPose_double)
+{
+	EXPECT_TRUE(TestAutomaticDifferentiation::testVectorPose<double>(GTEST_TEST_DURATION));
+}
+
 #endif // OCEAN_USE_GTEST
 
 template <typename T>
@@ -1385,6 +1430,226 @@ bool TestAutomaticDifferentiation::testPose(const double testDuration)
 	return true;
 }
 
+template <typename T>
+bool TestAutomaticDifferentiation::testVectorFunctions(const double testDuration)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Testing automatic differentiation with several derivatives for mathematic functions with " << TypeNamer::name<T>() << ":";
+
+	using AutoDiff = AutomaticDifferentiationT<T>;
+	using AutoDiffVector = AutomaticDifferentiationVectorT<T, 3>;
+
+	RandomGenerator randomGenerator;
+
+	ValidationPrecision validation(0.99, randomGenerator);
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		ValidationPrecision::ScopedIteration scopedIteration(validation);
+
+		const T x = RandomT<T>::scalar(randomGenerator, T(-2), T(2));
+		const T y = RandomT<T>::scalar(randomGenerator, T(-2), T(2));
+		const T z = RandomT<T>::scalar(randomGenerator, T(0.5), T(2));
+
+		// f(x, y, z) = sin(x * y) + sqrt(z^2 + 1) / (x + 3) - exp(y / 4) * log(z + 2) + |x|^1.5 + cos(z) * tan(y / 4) - 2 / (z * z) + max(min(y, 1), -1)
+
+		const auto function = [](const auto& dx, const auto& dy, const auto& dz)
+		{
+			using TAutoDiff = std::decay_t<decltype(dx)>;
+
+			return TAutoDiff::sin(dx * dy) + TAutoDiff::sqrt(TAutoDiff::sqr(dz) + T(1)) / (dx + T(3)) - TAutoDiff::exp(dy / T(4)) * TAutoDiff::log(dz + T(2))
+						+ TAutoDiff::pow(TAutoDiff::abs(dx), T(1.5)) + TAutoDiff::cos(dz) * TAutoDiff::tan(dy / T(4)) - T(2) / (dz * dz) + TAutoDiff::max(TAutoDiff::min(dy, T(1)), T(-1));
+		};
+
+		const AutoDiffVector vectorResult = function(AutoDiffVector(x, 0), AutoDiffVector(y, 1), AutoDiffVector(z, 2));
+
+		for (size_t n = 0; n < 3; ++n)
+		{
+			const AutoDiff scalarResult = function(AutoDiff(x, n == 0), AutoDiff(y, n == 1), AutoDiff(z, n == 2));
+
+			if (n == 0 && NumericT<T>::isNotWeakEqual(scalarResult.value(), vectorResult.value()))
+			{
+				scopedIteration.setInaccurate();
+			}
+
+			if (NumericT<T>::isNotWeakEqual(scalarResult.derivative(), vectorResult.derivative(n)))
+			{
+				scopedIteration.setInaccurate();
+			}
+		}
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
+template <typename T>
+bool TestAutomaticDifferentiation::testVectorPose(const double testDuration)
+{
+	ocean_assert(testDuration > 0.0);
+
+	const unsigned int numberPoints = 50u;
+
+	const unsigned int width = 1920u;
+	const unsigned int height = 1080u;
+
+	Log::info() << "Testing automatic differentiation with several derivatives for the 6-DOF camera pose for " << numberPoints << " points with " << TypeNamer::name<T>() << ":";
+
+	using AutoDiff = AutomaticDifferentiationT<T>;
+	using AutoDiffVector = AutomaticDifferentiationVectorT<T, 6>;
+
+	RandomGenerator randomGenerator;
+
+	ValidationPrecision validation(0.99, randomGenerator);
+
+	HighPerformanceStatistic performanceScalar;
+	HighPerformanceStatistic performanceVector;
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		VectorsT3<T> objectPoints(numberPoints);
+
+		std::vector<T> scalarJacobians(numberPoints * 6u * 2u);
+		std::vector<T> vectorJacobians(numberPoints * 6u * 2u);
+
+		const VectorT3<T> translation(RandomT<T>::vector3(randomGenerator, -10, 10));
+		const QuaternionT<T> quaternion(RandomT<T>::quaternion(randomGenerator));
+
+		const HomogenousMatrixT4<T> world_T_camera(translation, quaternion);
+
+		const HomogenousMatrixT4<T> flippedCamera_T_world(CameraT<T>::standard2InvertedFlipped(world_T_camera));
+		const PoseT<T> flippedCamera_P_world(flippedCamera_T_world);
+
+		const PinholeCameraT<T> pinholeCamera(width, height, NumericT<T>::deg2rad(60));
+
+		for (unsigned int n = 0u; n < numberPoints; ++n)
+		{
+			const VectorT2<T> imagePoint = RandomT<T>::vector2(randomGenerator, T(0), T(pinholeCamera.width()), T(0), T(pinholeCamera.height()));
+
+			const LineT3<T> ray(pinholeCamera.ray(imagePoint, translation, quaternion));
+			objectPoints[n] = ray.point(RandomT<T>::scalar(randomGenerator, 1, 5));
+		}
+
+		const T poseParameters[6] = {flippedCamera_P_world.rx(), flippedCamera_P_world.ry(), flippedCamera_P_world.rz(), flippedCamera_P_world.x(), flippedCamera_P_world.y(), flippedCamera_P_world.z()};
+
+		performanceScalar.start();
+
+		for (unsigned int n = 0u; n < numberPoints; ++n)
+		{
+			T* jx = scalarJacobians.data() + n * 6u * 2u;
+			T* jy = jx + 6;
+
+			// one evaluation for each parameter
+
+			for (unsigned int i = 0u; i < 6u; ++i)
+			{
+				AutoDiff pose[6];
+
+				for (unsigned int p = 0u; p < 6u; ++p)
+				{
+					pose[p] = AutoDiff(poseParameters[p], p == i);
+				}
+
+				AutoDiff imageX, imageY;
+				projectPoseRodrigues<T, AutoDiff>(pose, pinholeCamera, objectPoints[n], imageX, imageY);
+
+				jx[i] = imageX();
+				jy[i] = imageY();
+			}
+		}
+
+		performanceScalar.stop();
+
+		performanceVector.start();
+
+		for (unsigned int n = 0u; n < numberPoints; ++n)
+		{
+			T* jx = vectorJacobians.data() + n * 6u * 2u;
+			T* jy = jx + 6;
+
+			// one evaluation for all parameters
+
+			AutoDiffVector pose[6];
+
+			for (unsigned int p = 0u; p < 6u; ++p)
+			{
+				pose[p] = AutoDiffVector(poseParameters[p], p);
+			}
+
+			AutoDiffVector imageX, imageY;
+			projectPoseRodrigues<T, AutoDiffVector>(pose, pinholeCamera, objectPoints[n], imageX, imageY);
+
+			for (unsigned int i = 0u; i < 6u; ++i)
+			{
+				jx[i] = imageX.derivative(i);
+				jy[i] = imageY.derivative(i);
+			}
+		}
+
+		performanceVector.stop();
+
+		for (size_t n = 0; n < scalarJacobians.size(); ++n)
+		{
+			ValidationPrecision::ScopedIteration scopedIteration(validation);
+
+			const T tolerance = std::max(T(1), NumericT<T>::abs(scalarJacobians[n])) * NumericT<T>::weakEps();
+
+			if (NumericT<T>::isNotEqual(scalarJacobians[n], vectorJacobians[n], tolerance))
+			{
+				scopedIteration.setInaccurate();
+			}
+		}
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Performance scalar (six evaluations): " << performanceScalar;
+	Log::info() << "Performance vector (one evaluation): " << performanceVector;
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
+template <typename T, typename TAutoDiff>
+void TestAutomaticDifferentiation::projectPoseRodrigues(const TAutoDiff* pose, const PinholeCameraT<T>& pinholeCamera, const VectorT3<T>& objectPoint, TAutoDiff& imageX, TAutoDiff& imageY)
+{
+	ocean_assert(pose != nullptr);
+
+	const TAutoDiff& wx = pose[0];
+	const TAutoDiff& wy = pose[1];
+	const TAutoDiff& wz = pose[2];
+
+	const TAutoDiff angle(TAutoDiff::sqrt(wx * wx + wy * wy + wz * wz));
+	const TAutoDiff cosAngle(TAutoDiff::cos(angle));
+	const TAutoDiff cosAngle1_a2 = (1 - cosAngle) / (angle * angle);
+	const TAutoDiff sin_a(TAutoDiff::sin(angle) / angle);
+
+	const TAutoDiff r00 = cosAngle + cosAngle1_a2 * wx * wx;
+	const TAutoDiff r01 = cosAngle1_a2 * wx * wy - sin_a * wz;
+	const TAutoDiff r02 = cosAngle1_a2 * wx * wz + sin_a * wy;
+
+	const TAutoDiff r10 = cosAngle1_a2 * wx * wy + sin_a * wz;
+	const TAutoDiff r11 = cosAngle + cosAngle1_a2 * wy * wy;
+	const TAutoDiff r12 = cosAngle1_a2 * wy * wz - sin_a * wx;
+
+	const TAutoDiff r20 = cosAngle1_a2 * wx * wz - sin_a * wy;
+	const TAutoDiff r21 = cosAngle1_a2 * wy * wz + sin_a * wx;
+	const TAutoDiff r22 = cosAngle + cosAngle1_a2 * wz * wz;
+
+	const TAutoDiff u = r00 * objectPoint.x() + r01 * objectPoint.y() + r02 * objectPoint.z() + pose[3];
+	const TAutoDiff v = r10 * objectPoint.x() + r11 * objectPoint.y() + r12 * objectPoint.z() + pose[4];
+	const TAutoDiff w = r20 * objectPoint.x() + r21 * objectPoint.y() + r22 * objectPoint.z() + pose[5];
+
+	imageX = u / w * pinholeCamera.focalLengthX() + pinholeCamera.principalPointX();
+	imageY = v / w * pinholeCamera.focalLengthY() + pinholeCamera.principalPointY();
+}
+
 }
 
 }
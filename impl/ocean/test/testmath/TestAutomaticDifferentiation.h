@@ -12,6 +12,8 @@
 
 #include "ocean/test/TestSelector.h"
 
+#include "ocean/math/PinholeCamera.h"
+
 namespace Ocean
 {
 
@@ -81,6 +83,39 @@ class OCEAN_TEST_MATH_EXPORT TestAutomaticDifferentiation
 		 */
 		template <typename T>
 		static bool testPose(const double testDuration);
+
+		/**
+		 * Tests the automatic differentiation with several derivatives for mathematic functions.
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @return True, if succeeded
+		 * @tparam T The data type to be used
+		 */
+		template <typename T>
+		static bool testVectorFunctions(const double testDuration);
+
+		/**
+		 * Tests the automatic differentiation with several derivatives for the 6-DOF camera pose function.
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @return True, if succeeded
+		 * @tparam T The data type to be used
+		 */
+		template <typename T>
+		static bool testVectorPose(const double testDuration);
+
+	protected:
+
+		/**
+		 * Projects an object point into a pinhole camera with a 6-DOF pose using a Rodrigues rotation, with differentiation objects as pose parameters.
+		 * @param pose The six pose parameters (wx, wy, wz, tx, ty, tz) of the flipped camera pose, must be valid
+		 * @param pinholeCamera The pinhole camera without distortion
+		 * @param objectPoint The object point to project
+		 * @param imageX The resulting horizontal image coordinate
+		 * @param imageY The resulting vertical image coordinate
+		 * @tparam T The data type to be used
+		 * @tparam TAutoDiff The data type of the differentiation object
+		 */
+		template <typename T, typename TAutoDiff>
+		static void projectPoseRodrigues(const TAutoDiff* pose, const PinholeCameraT<T>& pinholeCamera, const VectorT3<T>& objectPoint, TAutoDiff& imageX, TAutoDiff& imageY);
 };
 
 }
@@ -0,0 +1,581 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "ocean/test/testmath/TestBlockSparseMatrix.h"
+
+#include "ocean/base/HighPerformanceTimer.h"
+#include "ocean/base/Timestamp.h"
+
+#include "ocean/math/BlockSparseCholesky.h"
+#include "ocean/math/Random.h"
+
+#include "ocean/test/TestResult.h"
+#include "ocean/test/ValidationPrecision.h"
+
+namespace Ocean
+{
+
+namespace Test
+{
+
+namespace TestMath
+{
+
+bool TestBlockSparseMatrix::test(const double testDuration, Worker& worker, const TestSelector& selector)
+{
+	ocean_assert(testDuration > 0.0);
+
+	TestResult testResult("Block sparse matrix test");
+
+	Log::info() << " ";
+
+	if (selector.shouldRun("multiply"))
+	{
+		testResult = testMultiply<float>(testDuration, worker);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+
+		testResult = testMultiply<double>(testDuration, worker);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
+	if (selector.shouldRun("cholesky"))
+	{
+		testResult = testCholesky<float>(testDuration);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+
+		testResult = testCholesky<double>(testDuration);
+
+		Log::info() << " ";
+	}
+
+	Log::info() << testResult;
+
+	return testResult.succeeded();
+}
+
+#ifdef OCEAN_USE_GTEST
+
+TEST(TestBlockSparseMatrix, Multiply_float)
+{
+	Worker worker;
+	EXPECT_TRUE(TestBlockSparseMatrix::testMultiply<float>(GTEST_TEST_DURATION, worker));
+}
+
+TEST(TestBlockSparseMatrix, Multiply_double)
+{
+	Worker worker;
+	EXPECT_TRUE(TestBlockSparseMatrix::testMultiply<double>(GTEST_TEST_DURATION, worker));
+}
+
+TEST(TestBlockSparseMatrix, Cholesky_float)
+{
+	EXPECT_TRUE(TestBlockSparseMatrix::testCholesky<float>(GTEST_TEST_DURATION));
+}
+
+TEST(TestBlockSparseMatrix, Cholesky_double)
+{
+	EXPECT_TRUE(TestBlockSparseMatrix::testCholesky<double>(GTEST_TEST_DURATION));
+}
+
+#endif // OCEAN_USE_GTEST
+
+template <typename T>
+bool TestBlockSparseMatrix::testMultiply(const double testDuration, Worker& worker)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Multiplication test with " << TypeNamer::name<T>() << ":";
+
+	RandomGenerator randomGenerator;
+
+	constexpr double successThreshold = std::is_same<float, T>::value ? 0.95 : 0.99;
+
+	ValidationPrecision validation(successThreshold, randomGenerator);
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		for (const bool useWorker : {false, true})
+		{
+			ValidationPrecision::ScopedIteration scopedIteration(validation);
+
+			Worker* useWorkerPointer = useWorker ? &worker : nullptr;
+
+			if (!validateMultiply<T, 3>(useWorkerPointer, randomGenerator) || !validateMultiply<T, 6>(useWorkerPointer, randomGenerator))
+			{
+				scopedIteration.setInaccurate();
+			}
+		}
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	{
+		// performance of the vector multiplication for a matrix with bundle adjustment structure
+
+		const BlockSparseMatrixT<T, 6> matrix = createBundleAdjustmentMatrix<T, 6>(200, 2000, randomGenerator);
+
+		std::vector<T> vector(matrix.columns());
+		for (T& value : vector)
+		{
+			value = RandomT<T>::scalar(randomGenerator, T(-1), T(1));
+		}
+
+		std::vector<T> result(matrix.rows());
+
+		HighPerformanceStatistic performanceSinglecore;
+		HighPerformanceStatistic performanceMulticore;
+
+		for (unsigned int n = 0u; n < 10u; ++n)
+		{
+			performanceSinglecore.start();
+				matrix.multiply(vector.data(), result.data());
+			performanceSinglecore.stop();
+
+			performanceMulticore.start();
+				matrix.multiply(vector.data(), result.data(), &worker);
+			performanceMulticore.stop();
+		}
+
+		Log::info() << "Vector multiplication with " << matrix.nonZeroBlocks() << " 6x6 blocks:";
+		Log::info() << "Singlecore performance: " << performanceSinglecore;
+		Log::info() << "Multicore performance: " << performanceMulticore;
+	}
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
+template <typename T>
+bool TestBlockSparseMatrix::testCholesky(const double testDuration)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Cholesky decomposition test with " << TypeNamer::name<T>() << ":";
+
+	RandomGenerator randomGenerator;
+
+	constexpr double successThreshold = std::is_same<float, T>::value ? 0.95 : 0.99;
+
+	ValidationPrecision validation(successThreshold, randomGenerator);
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		ValidationPrecision::ScopedIteration scopedIteration(validation);
+
+		if (!validateCholesky<T, 3>(randomGenerator) || !validateCholesky<T, 6>(randomGenerator))
+		{
+			scopedIteration.setInaccurate();
+		}
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	{
+		// performance and fill-in with and without fill-reducing ordering
+
+		const BlockSparseMatrixT<T, 6> matrix = createBundleAdjustmentMatrix<T, 6>(50, 500, randomGenerator);
+
+		for (const bool reorder : {false, true})
+		{
+			BlockSparseCholeskyT<T, 6> cholesky;
+
+			HighPerformanceStatistic performanceAnalyze;
+			HighPerformanceStatistic performanceFactorize;
+
+			performanceAnalyze.start();
+				const bool analyzed = cholesky.analyze(matrix, reorder);
+			performanceAnalyze.stop();
+
+			performanceFactorize.start();
+				const bool factorized = analyzed && cholesky.factorize(matrix);
+			performanceFactorize.stop();
+
+			if (!factorized)
+			{
+				OCEAN_SET_FAILED(validation);
+			}
+
+			Log::info() << (reorder ? "With" : "Without") << " minimum degree ordering: " << cholesky.nonZeroBlocks() << " 6x6 blocks in L";
+			Log::info() << "Analyze performance: " << performanceAnalyze;
+			Log::info() << "Factorize performance: " << performanceFactorize;
+		}
+	}
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
+template <typename T, size_t tBlockSize>
+bool TestBlockSparseMatrix::validateMultiply(Worker* worker, RandomGenerator& randomGenerator)
+{
+	using BlockSparseMatrix = BlockSparseMatrixT<T, tBlockSize>;
+
+	const size_t blockRows = size_t(RandomI::random(randomGenerator, 1u, 100u));
+	const size_t blockColumns = size_t(RandomI::random(randomGenerator, 1u, 100u));
+
+	const unsigned int numberEntries = RandomI::random(randomGenerator, 0u, (unsigned int)(blockRows * blockColumns / 4u + 1u));
+
+	typename BlockSparseMatrix::BlockEntries entries;
+	entries.reserve(numberEntries);
+
+	T values[BlockSparseMatrix::blockElements_];
+
+	for (unsigned int n = 0u; n < numberEntries; ++n)
+	{
+		for (T& value : values)
+		{
+			value = RandomT<T>::scalar(randomGenerator, T(-1), T(1));
+		}
+
+		// duplicated entries will be summed
+
+		entries.emplace_back(size_t(RandomI::random(randomGenerator, (unsigned int)(blockRows) - 1u)), size_t(RandomI::random(randomGenerator, (unsigned int)(blockColumns) - 1u)), values);
+	}
+
+	const BlockSparseMatrix matrix(blockRows, blockColumns, entries);
+
+	if (matrix.rows() != blockRows * tBlockSize || matrix.columns() != blockColumns * tBlockSize || matrix.nonZeroBlocks() > entries.size())
+	{
+		return false;
+	}
+
+	MatrixT<T> denseMatrix(matrix.rows(), matrix.columns(), false);
+
+	for (const typename BlockSparseMatrix::BlockEntry& entry : entries)
+	{
+		for (size_t r = 0; r < tBlockSize; ++r)
+		{
+			for (size_t c = 0; c < tBlockSize; ++c)
+			{
+				denseMatrix(entry.blockRow() * tBlockSize + r, entry.blockColumn() * tBlockSize + c) += entry.values()[r * tBlockSize + c];
+			}
+		}
+	}
+
+	const MatrixT<T> testDenseMatrix = matrix.denseMatrix();
+
+	for (size_t n = 0; n < denseMatrix.elements(); ++n)
+	{
+		if (!NumericT<T>::isWeakEqual(denseMatrix.data()[n], testDenseMatrix.data()[n]))
+		{
+			return false;
+		}
+	}
+
+	const T epsilon = std::is_same<float, T>::value ? T(0.001) : T(0.0000001);
+
+	{
+		// vector multiplication
+
+		MatrixT<T> vector(matrix.columns(), 1);
+		for (size_t n = 0; n < vector.elements(); ++n)
+		{
+			vector.data()[n] = RandomT<T>::scalar(randomGenerator, T(-1), T(1));
+		}
+
+		std::vector<T> result(matrix.rows());
+		matrix.multiply(vector.data(), result.data(), worker);
+
+		const MatrixT<T> expectedResult = denseMatrix * vector;
+
+		for (size_t n = 0; n < result.size(); ++n)
+		{
+			if (NumericT<T>::isNotEqual(result[n], expectedResult.data()[n], epsilon))
+			{
+				return false;
+			}
+		}
+	}
+
+	{
+		// matrix multiplication
+
+		MatrixT<T> right(matrix.columns(), size_t(RandomI::random(randomGenerator, 1u, 20u)));
+		for (size_t n = 0; n < right.elements(); ++n)
+		{
+			right.data()[n] = RandomT<T>::scalar(randomGenerator, T(-1), T(1));
+		}
+
+		MatrixT<T> result;
+		if (!matrix.multiply(right, result, worker))
+		{
+			return false;
+		}
+
+		const MatrixT<T> expectedResult = denseMatrix * right;
+
+		if (result.rows() != expectedResult.rows() || result.columns() != expectedResult.columns())
+		{
+			return false;
+		}
+
+		for (size_t n = 0; n < result.elements(); ++n)
+		{
+			if (NumericT<T>::isNotEqual(result.data()[n], expectedResult.data()[n], epsilon))
+			{
+				return false;
+			}
+		}
+	}
+
+	{
+		// block access
+
+		for (unsigned int n = 0u; n < 10u; ++n)
+		{
+			const size_t blockRow = size_t(RandomI::random(randomGenerator, (unsigned int)(blockRows) - 1u));
+			const size_t blockColumn = size_t(RandomI::random(randomGenerator, (unsigned int)(blockColumns) - 1u));
+
+			const T* block = matrix.block(blockRow, blockColumn);
+
+			bool hasEntry = false;
+			for (const typename BlockSparseMatrix::BlockEntry& entry : entries)
+			{
+				if (entry.blockRow() == blockRow && entry.blockColumn() == blockColumn)
+				{
+					hasEntry = true;
+					break;
+				}
+			}
+
+			if ((block != nullptr) != hasEntry)
+			{
+				return false;
+			}
+
+			if (block != nullptr)
+			{
+				for (size_t r = 0; r < tBlockSize; ++r)
+				{
+					for (size_t c = 0; c < tBlockSize; ++c)
+					{
+						if (!NumericT<T>::isWeakEqual(block[r * tBlockSize + c], denseMatrix(blockRow * tBlockSize + r, blockColumn * tBlockSize + c)))
+						{
+							return false;
+						}
+					}
+				}
+			}
+		}
+	}
+
+	return true;
+}
+
+template <typename T, size_t tBlockSize>
+bool TestBlockSparseMatrix::validateCholesky(RandomGenerator& randomGenerator)
+{
+	const size_t cameras = size_t(RandomI::random(randomGenerator, 1u, 10u));
+	const size_t points = size_t(RandomI::random(randomGenerator, 1u, 50u));
+
+	const BlockSparseMatrixT<T, tBlockSize> matrix = createBundleAdjustmentMatrix<T, tBlockSize>(cameras, points, randomGenerator);
+
+	if (!matrix.isSymmetric())
+	{
+		return false;
+	}
+
+	std::vector<T> b(matrix.rows());
+	for (T& value : b)
+	{
+		value = RandomT<T>::scalar(randomGenerator, T(-1), T(1));
+	}
+
+	const bool reorder = RandomI::boolean(randomGenerator);
+
+	BlockSparseCholeskyT<T, tBlockSize> cholesky;
+
+	if (!cholesky.analyze(matrix, reorder) || !cholesky.factorize(matrix))
+	{
+		return false;
+	}
+
+	const Indices32& permutation = cholesky.permutation();
+
+	if (permutation.size() != matrix.blockRows())
+	{
+		return false;
+	}
+
+	Indices32 sortedPermutation(permutation);
+	std::sort(sortedPermutation.begin(), sortedPermutation.end());
+
+	for (size_t n = 0; n < sortedPermutation.size(); ++n)
+	{
+		if (size_t(sortedPermutation[n]) != n)
+		{
+			return false;
+		}
+	}
+
+	std::vector<T> x(matrix.rows());
+
+	if (!cholesky.solve(b.data(), x.data()))
+	{
+		return false;
+	}
+
+	// we check the residual ||A * x - b|| in relation to ||b||
+
+	std::vector<T> ax(matrix.rows());
+	matrix.multiply(x.data(), ax.data());
+
+	T sqrResidual = T(0);
+	T sqrNorm = T(0);
+
+	for (size_t n = 0; n < b.size(); ++n)
+	{
+		sqrResidual += NumericT<T>::sqr(ax[n] - b[n]);
+		sqrNorm += NumericT<T>::sqr(b[n]);
+	}
+
+	const T threshold = std::is_same<float, T>::value ? T(0.001) : T(0.0000001);
+
+	if (NumericT<T>::sqrt(sqrResidual) > threshold * NumericT<T>::sqrt(sqrNorm))
+	{
+		return false;
+	}
+
+	{
+		// an indefinite matrix must be rejected
+
+		typename BlockSparseMatrixT<T, tBlockSize>::BlockEntries entries;
+
+		T values[BlockSparseMatrixT<T, tBlockSize>::blockElements_] = {};
+		for (size_t n = 0; n < tBlockSize; ++n)
+		{
+			values[n * tBlockSize + n] = n + 1 == tBlockSize ? T(-1) : T(1);
+		}
+
+		entries.emplace_back(0, 0, values);
+
+		const BlockSparseMatrixT<T, tBlockSize> indefiniteMatrix(1, 1, entries);
+
+		BlockSparseCholeskyT<T, tBlockSize> indefiniteCholesky;
+
+		if (!indefiniteCholesky.analyze(indefiniteMatrix) || indefiniteCholesky.factorize(indefiniteMatrix))
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+template <typename T, size_t tBlockSize>
+BlockSparseMatrixT<T, tBlockSize> TestBlockSparseMatrix::createBundleAdjustmentMatrix(const size_t cameras, const size_t points, RandomGenerator& randomGenerator)
+{
+	ocean_assert(cameras >= 1 && points >= 1);
+
+	using BlockSparseMatrix = BlockSparseMatrixT<T, tBlockSize>;
+
+	constexpr size_t blockElements = BlockSparseMatrix::blockElements_;
+
+	// we randomly interleave the camera and point blocks so that the ordering has an impact
+
+	Indices32 blockIndices(cameras + points);
+	for (size_t n = 0; n < blockIndices.size(); ++n)
+	{
+		blockIndices[n] = (unsigned int)(n);
+	}
+
+	for (size_t n = blockIndices.size() - 1; n >= 1; --n)
+	{
+		std::swap(blockIndices[n], blockIndices[RandomI::random(randomGenerator, (unsigned int)(n))]);
+	}
+
+	typename BlockSparseMatrix::BlockEntries entries;
+
+	T cameraJacobian[blockElements];
+	T pointJacobian[blockElements];
+
+	T cameraCamera[blockElements];
+	T pointPoint[blockElements];
+	T cameraPoint[blockElements];
+	T pointCamera[blockElements];
+
+	for (size_t point = 0; point < points; ++point)
+	{
+		const size_t pointBlock = size_t(blockIndices[cameras + point]);
+
+		const unsigned int observations = RandomI::random(randomGenerator, 1u, (unsigned int)(std::min(cameras, size_t(4))));
+
+		for (unsigned int o = 0u; o < observations; ++o)
+		{
+			const size_t cameraBlock = size_t(blockIndices[RandomI::random(randomGenerator, (unsigned int)(cameras) - 1u)]);
+
+			for (size_t n = 0; n < blockElements; ++n)
+			{
+				cameraJacobian[n] = RandomT<T>::scalar(randomGenerator, T(-1), T(1));
+				pointJacobian[n] = RandomT<T>::scalar(randomGenerator, T(-1), T(1));
+			}
+
+			// the blocks of J^T * J
+
+			for (size_t r = 0; r < tBlockSize; ++r)
+			{
+				for (size_t c = 0; c < tBlockSize; ++c)
+				{
+					T valueCameraCamera = T(0);
+					T valuePointPoint = T(0);
+					T valueCameraPoint = T(0);
+
+					for (size_t k = 0; k < tBlockSize; ++k)
+					{
+						valueCameraCamera += cameraJacobian[k * tBlockSize + r] * cameraJacobian[k * tBlockSize + c];
+						valuePointPoint += pointJacobian[k * tBlockSize + r] * pointJacobian[k * tBlockSize + c];
+						valueCameraPoint += cameraJacobian[k * tBlockSize + r] * pointJacobian[k * tBlockSize + c];
+					}
+
+					cameraCamera[r * tBlockSize + c] = valueCameraCamera;
+					pointPoint[r * tBlockSize + c] = valuePointPoint;
+					cameraPoint[r * tBlockSize + c] = valueCameraPoint;
+					pointCamera[c * tBlockSize + r] = valueCameraPoint;
+				}
+			}
+
+			entries.emplace_back(cameraBlock, cameraBlock, cameraCamera);
+			entries.emplace_back(pointBlock, pointBlock, pointPoint);
+			entries.emplace_back(cameraBlock, pointBlock, cameraPoint);
+			entries.emplace_back(pointBlock, cameraBlock, pointCamera);
+		}
+	}
+
+	// the damping term ensures a positive definite matrix
+
+	T damping[blockElements] = {};
+	for (size_t n = 0; n < tBlockSize; ++n)
+	{
+		damping[n * tBlockSize + n] = T(1);
+	}
+
+	for (size_t n = 0; n < blockIndices.size(); ++n)
+	{
+		entries.emplace_back(n, n, damping);
+	}
+
+	return BlockSparseMatrix(cameras + points, cameras + points, std::move(entries));
+}
+
+}
+
+}
+
+}
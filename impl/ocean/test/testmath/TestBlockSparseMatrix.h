@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#ifndef META_OCEAN_TEST_TESTMATH_TEST_BLOCK_SPARSE_MATRIX_H
+#define META_OCEAN_TEST_TESTMATH_TEST_BLOCK_SPARSE_MATRIX_H
+
+#include "ocean/test/testmath/TestMath.h"
+
+#include "ocean/test/TestSelector.h"
+
+#include "ocean/base/RandomGenerator.h"
+#include "ocean/base/Worker.h"
+
+#include "ocean/math/BlockSparseMatrix.h"
+
+namespace Ocean
+{
+
+namespace Test
+{
+
+namespace TestMath
+{
+
+/**
+ * This class implements a test for the block sparse matrix and the block sparse Cholesky decomposition.
+ * @ingroup testmath
+ */
+class OCEAN_TEST_MATH_EXPORT TestBlockSparseMatrix
+{
+	public:
+
+		/**
+		 * Tests all block sparse matrix functions.
+		 * @param testDuration The number of seconds for each test, with range (0, infinity)
+		 * @param worker The worker object
+		 * @param selector The test selector
+		 * @return True, if succeeded
+		 */
+		static bool test(const double testDuration, Worker& worker, const TestSelector& selector);
+
+		/**
+		 * Tests the multiplication with vectors and dense matrices.
+		 * @param testDuration The number of seconds for each test, with range (0, infinity)
+		 * @param worker The worker object
+		 * @return True, if succeeded
+		 * @tparam T The data type of each element, e.g., 'float' or 'double'
+		 */
+		template <typename T>
+		static bool testMultiply(const double testDuration, Worker& worker);
+
+		/**
+		 * Tests the sparse Cholesky decomposition.
+		 * @param testDuration The number of seconds for each test, with range (0, infinity)
+		 * @return True, if succeeded
+		 * @tparam T The data type of each element, e.g., 'float' or 'double'
+		 */
+		template <typename T>
+		static bool testCholesky(const double testDuration);
+
+	protected:
+
+		/**
+		 * Validates the multiplication with vectors and dense matrices for one specific block size.
+		 * @param worker Optional worker object
+		 * @param randomGenerator The random generator to be used
+		 * @return True, if succeeded
+		 * @tparam T The data type of each element
+		 * @tparam tBlockSize The size of each block
+		 */
+		template <typename T, size_t tBlockSize>
+		static bool validateMultiply(Worker* worker, RandomGenerator& randomGenerator);
+
+		/**
+		 * Validates the sparse Cholesky decomposition for one specific block size.
+		 * @param randomGenerator The random generator to be used
+		 * @return True, if succeeded
+		 * @tparam T The data type of each element
+		 * @tparam tBlockSize The size of each block
+		 */
+		template <typename T, size_t tBlockSize>
+		static bool validateCholesky(RandomGenerator& randomGenerator);
+
+		/**
+		 * Creates a random symmetric positive definite block sparse matrix with the structure of the normal equations of a bundle adjustment problem.
+		 * @param cameras The number of camera blocks, with range [1, infinity)
+		 * @param points The number of point blocks, with range [1, infinity)
+		 * @param randomGenerator The random generator to be used
+		 * @return The resulting matrix with cameras + points block rows, the camera and point blocks are randomly interleaved
+		 * @tparam T The data type of each element
+		 * @tparam tBlockSize The size of each block
+		 */
+		template <typename T, size_t tBlockSize>
+		static BlockSparseMatrixT<T, tBlockSize> createBundleAdjustmentMatrix(const size_t cameras, const size_t points, RandomGenerator& randomGenerator);
+};
+
+}
+
+}
+
+}
+
+#endif // META_OCEAN_TEST_TESTMATH_TEST_BLOCK_SPARSE_MATRIX_H
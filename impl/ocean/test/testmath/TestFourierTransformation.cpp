@@ -8,6 +8,7 @@
 #include "ocean/test/testmath/TestFourierTransformation.h"
 
 #include "ocean/base/DataType.h"
+#include "ocean/base/HighPerformanceTimer.h"
 #include "ocean/base/RandomI.h"
 #include "ocean/base/Timestamp.h"
 
@@ -16,6 +17,7 @@
 
 #include "ocean/test/TestResult.h"
 #include "ocean/test/Validation.h"
+#include "ocean/test/ValidationPrecision.h"
 
 namespace Ocean
 {
@@ -26,7 +28,7 @@ namespace Test
 namespace TestMath
 {
 
-bool TestFourierTransformation::test(const double testDuration, const TestSelector& selector)
+bool TestFourierTransformation::test(const double testDuration, Worker& worker, const TestSelector& selector)
 {
 	ocean_assert(testDuration > 0.0);
 
@@ -49,6 +51,17 @@ bool TestFourierTransformation::test(const double testDuration, const TestSelect
 		Log::info() << " ";
 	}
 
+	if (selector.shouldRun("halffrequency2"))
+	{
+		testResult = testHalfFrequency2<float>(testDuration, worker);
+		Log::info() << " ";
+		testResult = testHalfFrequency2<double>(testDuration, worker);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
 	if (selector.shouldRun("elementwisemultiplication2"))
 	{
 		testResult = testElementwiseMultiplication2<float>(testDuration);
@@ -96,6 +109,18 @@ TEST(TestFourierTransformation, FourierTransformDoubleComplex)
 	EXPECT_TRUE((TestFourierTransformation::testFourierTransform<double, true>(GTEST_TEST_DURATION)));
 }
 
+TEST(TestFourierTransformation, HalfFrequency2Float)
+{
+	Worker worker;
+	EXPECT_TRUE(TestFourierTransformation::testHalfFrequency2<float>(GTEST_TEST_DURATION, worker));
+}
+
+TEST(TestFourierTransformation, HalfFrequency2Double)
+{
+	Worker worker;
+	EXPECT_TRUE(TestFourierTransformation::testHalfFrequency2<double>(GTEST_TEST_DURATION, worker));
+}
+
 TEST(TestFourierTransformation, ElementwiseMultiplication2Float)
 {
 	EXPECT_TRUE(TestFourierTransformation::testElementwiseMultiplication2<float>(GTEST_TEST_DURATION));
@@ -292,6 +317,173 @@ bool TestFourierTransformation::testFourierTransform(const double testDuration)
 	return validation.succeeded();
 }
 
+template <typename T>
+bool TestFourierTransformation::testHalfFrequency2(const double testDuration, Worker& worker)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Fast Fourier transform test for real signals with " << TypeNamer::name<T>() << ":";
+
+	RandomGenerator randomGenerator;
+
+	constexpr double successThreshold = std::is_same<float, T>::value ? 0.95 : 0.99;
+
+	ValidationPrecision validation(successThreshold, randomGenerator);
+
+	constexpr T epsilon = std::is_same<T, double>::value ? T(0.0000001) : T(0.0001);
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		for (const bool useWorker : {false, true})
+		{
+			ValidationPrecision::ScopedIteration scopedIteration(validation);
+
+			Worker* useWorkerPointer = useWorker ? &worker : nullptr;
+
+			const unsigned int width = 1u << RandomI::random(randomGenerator, 1u, 9u);
+			const unsigned int height = 1u << RandomI::random(randomGenerator, 0u, 9u);
+
+			const unsigned int halfWidth = width / 2u + 1u;
+
+			const unsigned int spatialPaddingElements = RandomI::random(randomGenerator, 1u, 100u) * RandomI::random(randomGenerator, 1u);
+			const unsigned int frequencyPaddingElements = RandomI::random(randomGenerator, 1u, 100u) * RandomI::random(randomGenerator, 1u);
+			const unsigned int reverseSpatialPaddingElements = RandomI::random(randomGenerator, 1u, 100u) * RandomI::random(randomGenerator, 1u);
+
+			const unsigned int spatialStrideElements = width + spatialPaddingElements;
+			const unsigned int frequencyStrideElements = halfWidth * 2u + frequencyPaddingElements;
+			const unsigned int reverseSpatialStrideElements = width + reverseSpatialPaddingElements;
+
+			std::vector<T> spatial(spatialStrideElements * height);
+			std::vector<T> frequency(frequencyStrideElements * height);
+			std::vector<T> reverseSpatial(reverseSpatialStrideElements * height);
+
+			for (T& value : spatial)
+			{
+				value = RandomT<T>::scalar(randomGenerator, -1, 1);
+			}
+
+			for (T& value : frequency)
+			{
+				value = RandomT<T>::scalar(randomGenerator, -1, 1);
+			}
+
+			for (T& value : reverseSpatial)
+			{
+				value = RandomT<T>::scalar(randomGenerator, -1, 1);
+			}
+
+			const std::vector<T> copyFrequency(frequency);
+			const std::vector<T> copyReverseSpatial(reverseSpatial);
+
+			if (!FourierTransformation::spatialToHalfFrequency2(spatial.data(), width, height, frequency.data(), spatialPaddingElements, frequencyPaddingElements, useWorkerPointer))
+			{
+				OCEAN_SET_FAILED(validation);
+				continue;
+			}
+
+			// the half frequency analysis must match the first (width / 2 + 1) frequencies of the full analysis
+
+			std::vector<T> fullFrequency(width * 2u * height);
+			FourierTransformation::spatialToFrequency2(spatial.data(), width, height, fullFrequency.data(), spatialPaddingElements, 0u);
+
+			const T threshold = epsilon * NumericT<T>::sqrt(T(width * height));
+
+			for (unsigned int y = 0u; y < height; ++y)
+			{
+				const std::complex<T>* const frequencyRow = (const std::complex<T>*)(frequency.data() + y * frequencyStrideElements);
+				const std::complex<T>* const fullFrequencyRow = (const std::complex<T>*)(fullFrequency.data() + y * width * 2u);
+
+				for (unsigned int x = 0u; x < halfWidth; ++x)
+				{
+					if (std::abs(frequencyRow[x] - fullFrequencyRow[x]) > threshold)
+					{
+						scopedIteration.setInaccurate();
+					}
+				}
+
+				// we check whether the padding memory is untouched
+
+				if (memcmp(frequency.data() + y * frequencyStrideElements + halfWidth * 2u, copyFrequency.data() + y * frequencyStrideElements + halfWidth * 2u, frequencyPaddingElements * sizeof(T)) != 0)
+				{
+					OCEAN_SET_FAILED(validation);
+				}
+			}
+
+			if (!FourierTransformation::halfFrequencyToSpatial2(frequency.data(), width, height, reverseSpatial.data(), frequencyPaddingElements, reverseSpatialPaddingElements, useWorkerPointer))
+			{
+				OCEAN_SET_FAILED(validation);
+				continue;
+			}
+
+			for (unsigned int y = 0u; y < height; ++y)
+			{
+				const T* const spatialRow = spatial.data() + y * spatialStrideElements;
+				const T* const reverseSpatialRow = reverseSpatial.data() + y * reverseSpatialStrideElements;
+
+				for (unsigned int x = 0u; x < width; ++x)
+				{
+					if (NumericT<T>::isNotEqual(spatialRow[x], reverseSpatialRow[x], epsilon * T(10)))
+					{
+						scopedIteration.setInaccurate();
+					}
+				}
+
+				if (memcmp(reverseSpatialRow + width, copyReverseSpatial.data() + y * reverseSpatialStrideElements + width, reverseSpatialPaddingElements * sizeof(T)) != 0)
+				{
+					OCEAN_SET_FAILED(validation);
+				}
+			}
+		}
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	{
+		// performance for a signal with 512x512 elements
+
+		constexpr unsigned int width = 512u;
+		constexpr unsigned int height = 512u;
+
+		std::vector<T> spatial(width * height);
+		for (T& value : spatial)
+		{
+			value = RandomT<T>::scalar(randomGenerator, -1, 1);
+		}
+
+		std::vector<T> fullFrequency(width * 2u * height);
+		std::vector<T> halfFrequency((width / 2u + 1u) * 2u * height);
+
+		HighPerformanceStatistic performanceFullFrequency;
+		HighPerformanceStatistic performanceSinglecore;
+		HighPerformanceStatistic performanceMulticore;
+
+		for (unsigned int n = 0u; n < 10u; ++n)
+		{
+			performanceFullFrequency.start();
+				FourierTransformation::spatialToFrequency2(spatial.data(), width, height, fullFrequency.data());
+			performanceFullFrequency.stop();
+
+			performanceSinglecore.start();
+				FourierTransformation::spatialToHalfFrequency2(spatial.data(), width, height, halfFrequency.data());
+			performanceSinglecore.stop();
+
+			performanceMulticore.start();
+				FourierTransformation::spatialToHalfFrequency2(spatial.data(), width, height, halfFrequency.data(), 0u, 0u, &worker);
+			performanceMulticore.stop();
+		}
+
+		Log::info() << "Forward transformation of " << width << "x" << height << " elements:";
+		Log::info() << "Full frequency analysis performance: " << performanceFullFrequency;
+		Log::info() << "Singlecore performance: " << performanceSinglecore;
+		Log::info() << "Multicore performance: " << performanceMulticore;
+	}
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
 template <typename T>
 bool TestFourierTransformation::testElementwiseMultiplication2(const double testDuration)
 {
@@ -12,6 +12,8 @@
 
 #include "ocean/test/TestSelector.h"
 
+#include "ocean/base/Worker.h"
+
 namespace Ocean
 {
 
@@ -32,10 +34,11 @@ class OCEAN_TEST_MATH_EXPORT TestFourierTransformation
 		/**
 		 * This functions tests all 3D line functions.
 		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @param worker The worker object
 		 * @param selector The test selector
 		 * @return True, if succeeded
 		 */
-		static bool test(const double testDuration, const TestSelector& selector);
+		static bool test(const double testDuration, Worker& worker, const TestSelector& selector);
 
 		/**
 		 * Tests the forward and backward (inverse) Fourier transformation.
@@ -47,6 +50,16 @@ class OCEAN_TEST_MATH_EXPORT TestFourierTransformation
 		template <typename T, bool tSourceIsComplex>
 		static bool testFourierTransform(const double testDuration);
 
+		/**
+		 * Tests the fast Fourier transformation of real signals determining the non-redundant half of the frequency analysis.
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @param worker The worker object
+		 * @return True, if succeeded
+		 * @tparam T The data type to be tested, 'float' or 'double'
+		 */
+		template <typename T>
+		static bool testHalfFrequency2(const double testDuration, Worker& worker);
+
 		/**
 		 * Tests the element-wise multiplication of two complex spectrums.
 		 * @param testDuration Number of seconds for each test, with range (0, infinity)
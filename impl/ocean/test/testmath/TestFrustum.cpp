@@ -102,6 +102,12 @@ bool TestFrustum::testConstructors(const double testDuration)
 		const Frustum identityFrustum(HomogenousMatrix4(true), pinholeCamera, nearDistance, farDistance);
 
 		OCEAN_EXPECT_TRUE(validation, frustum.isEqual(identityFrustum));
+
+		const SquareMatrix4 projectionMatrix = SquareMatrix4::projectionMatrix(AnyCameraPinhole(pinholeCamera), nearDistance, farDistance);
+
+		const Frustum projectionFrustum(projectionMatrix);
+
+		OCEAN_EXPECT_TRUE(validation, frustum.isEqual(projectionFrustum, Numeric::weakEps()));
 	}
 	while (!startTimestamp.hasTimePassed(testDuration));
 
@@ -8,6 +8,7 @@
 #include "ocean/test/testmath/TestMath.h"
 #include "ocean/test/testmath/TestAnyCamera.h"
 #include "ocean/test/testmath/TestApproximation.h"
+#include "ocean/test/testmath/TestBlockSparseMatrix.h"
 #include "ocean/test/testmath/TestBoundingBox.h"
 #include "ocean/test/testmath/TestBoundingSphere.h"
 #include "ocean/test/testmath/TestBox2.h"
@@ -346,7 +347,7 @@ bool testMath(const double testDuration, Worker& worker, const std::string& test
 		Log::info() << " ";
 		Log::info() << " ";
 		Log::info() << " ";
-		testResult = TestMatrix::test(testDuration, subSelector);
+		testResult = TestMatrix::test(testDuration, worker, subSelector);
 	}
 
 	if (TestSelector subSelector = selector.shouldRun("squarematrix2"))
@@ -457,6 +458,15 @@ bool testMath(const double testDuration, Worker& worker, const std::string& test
 		testResult = TestSparseMatrix::test(testDuration, subSelector);
 	}
 
+	if (TestSelector subSelector = selector.shouldRun("blocksparsematrix"))
+	{
+		Log::info() << " ";
+		Log::info() << " ";
+		Log::info() << " ";
+		Log::info() << " ";
+		testResult = TestBlockSparseMatrix::test(testDuration, worker, subSelector);
+	}
+
 	if (TestSelector subSelector = selector.shouldRun("automaticdifferentiation"))
 	{
 		Log::info() << " ";
@@ -472,7 +482,7 @@ bool testMath(const double testDuration, Worker& worker, const std::string& test
 		Log::info() << " ";
 		Log::info() << " ";
 		Log::info() << " ";
-		testResult = TestFourierTransformation::test(testDuration, subSelector);
+		testResult = TestFourierTransformation::test(testDuration, worker, subSelector);
 	}
 
 	if (TestSelector subSelector = selector.shouldRun("samplemap"))
@@ -25,7 +25,7 @@ namespace Test
 namespace TestMath
 {
 
-bool TestMatrix::test(const double testDuration, const TestSelector& selector)
+bool TestMatrix::test(const double testDuration, Worker& worker, const TestSelector& selector)
 {
 	ocean_assert(testDuration > 0.0);
 
@@ -127,6 +127,15 @@ bool TestMatrix::test(const double testDuration, const TestSelector& selector)
 	{
 		testResult = testMatrixMultiplication(testDuration);
 
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
+	if (selector.shouldRun("largematrixproducts"))
+	{
+		testResult = testLargeMatrixProducts(testDuration, worker);
+
 		Log::info() << " ";
 	}
 
@@ -192,6 +201,12 @@ TEST(TestMatrix, MatrixMultiplication)
 	EXPECT_TRUE(TestMatrix::testMatrixMultiplication(GTEST_TEST_DURATION));
 }
 
+TEST(TestMatrix, LargeMatrixProducts)
+{
+	Worker worker;
+	EXPECT_TRUE(TestMatrix::testLargeMatrixProducts(GTEST_TEST_DURATION, worker));
+}
+
 #endif // OCEAN_USE_GTEST
 
 bool TestMatrix::testElementConstructor(const double testDuration)
@@ -1086,6 +1101,125 @@ bool TestMatrix::testMatrixMultiplication(const double testDuration)
 	return validation.succeeded();
 }
 
+bool TestMatrix::testLargeMatrixProducts(const double testDuration, Worker& worker)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Large matrix products test:";
+
+	RandomGenerator randomGenerator;
+	ValidationPrecision validation(0.99, randomGenerator);
+
+	HighPerformanceStatistic performanceNaive;
+	HighPerformanceStatistic performanceSinglecore;
+	HighPerformanceStatistic performanceMulticore;
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		const unsigned int rows = RandomI::random(randomGenerator, 1u, 300u);
+		const unsigned int columns = RandomI::random(randomGenerator, 1u, 300u);
+		const unsigned int rightColumns = RandomI::random(randomGenerator, 1u, 300u);
+
+		Matrix matrix(rows, columns);
+		Matrix right(rows, rightColumns);
+
+		for (size_t n = 0; n < matrix.elements(); ++n)
+		{
+			matrix(n) = Random::scalar(randomGenerator, -1, 1);
+		}
+
+		for (size_t n = 0; n < right.elements(); ++n)
+		{
+			right(n) = Random::scalar(randomGenerator, -1, 1);
+		}
+
+		const Matrix transposed(matrix.transposed());
+
+		performanceNaive.start();
+			Matrix naiveProduct(columns, rightColumns);
+
+			for (size_t r = 0; r < naiveProduct.rows(); ++r)
+			{
+				for (size_t c = 0; c < naiveProduct.columns(); ++c)
+				{
+					Scalar value = 0;
+
+					for (size_t i = 0; i < rows; ++i)
+					{
+						value += matrix(i, r) * right(i, c);
+					}
+
+					naiveProduct(r, c) = value;
+				}
+			}
+		performanceNaive.stop();
+
+		const Scalar epsilon = Numeric::weakEps() * Scalar(rows);
+
+		for (const bool useWorker : {false, true})
+		{
+			ValidationPrecision::ScopedIteration scopedIteration(validation);
+
+			HighPerformanceStatistic& performance = useWorker ? performanceMulticore : performanceSinglecore;
+
+			Matrix product;
+			Matrix selfProduct;
+			Matrix multiplied;
+
+			performance.start();
+				matrix.transposedMultiply(right, product, useWorker ? &worker : nullptr);
+			performance.stop();
+
+			matrix.selfTransposedSquareMatrix(selfProduct, useWorker ? &worker : nullptr);
+
+			if (!Matrix::multiply(transposed, right, multiplied, useWorker ? &worker : nullptr))
+			{
+				OCEAN_SET_FAILED(validation);
+			}
+
+			if (!product.isEqual(naiveProduct, epsilon) || !multiplied.isEqual(naiveProduct, epsilon))
+			{
+				scopedIteration.setInaccurate();
+			}
+
+			if (selfProduct.rows() != columns || selfProduct.columns() != columns)
+			{
+				OCEAN_SET_FAILED(validation);
+			}
+			else
+			{
+				const Matrix selfProductNaive(transposed * matrix);
+
+				if (!selfProduct.isEqual(selfProductNaive, epsilon))
+				{
+					scopedIteration.setInaccurate();
+				}
+
+				for (size_t r = 0; r < selfProduct.rows(); ++r)
+				{
+					for (size_t c = 0; c < r; ++c)
+					{
+						if (selfProduct(r, c) != selfProduct(c, r))
+						{
+							OCEAN_SET_FAILED(validation);
+						}
+					}
+				}
+			}
+		}
+	}
+	while (validation.needMoreIterations() || !startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Naive performance: " << performanceNaive;
+	Log::info() << "Singlecore performance: " << performanceSinglecore;
+	Log::info() << "Multicore performance: " << performanceMulticore;
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
 bool TestMatrix::validateMatrixMultiplication(const Matrix& left, const Matrix& right, const Matrix& result)
 {
 	// Validation with naive matrix multiplication
@@ -12,6 +12,8 @@
 
 #include "ocean/test/TestSelector.h"
 
+#include "ocean/base/Worker.h"
+
 #include "ocean/math/Matrix.h"
 
 namespace Ocean
@@ -34,10 +36,11 @@ class OCEAN_TEST_MATH_EXPORT TestMatrix
 		/**
 		 * Tests all matrix functions.
 		 * @param testDuration The number of seconds for each test, with range (0, infinity)
+		 * @param worker The worker object
 		 * @param selector The test selector
 		 * @return True, if succeeded
 		 */
-		static bool test(const double testDuration, const TestSelector& selector);
+		static bool test(const double testDuration, Worker& worker, const TestSelector& selector);
 
 		/**
 		 * Tests the element-based constructor.
@@ -117,6 +120,14 @@ class OCEAN_TEST_MATH_EXPORT TestMatrix
 		 */
 		static bool testMatrixMultiplication(const double testDuration);
 
+		/**
+		 * Tests the products of large matrices which are determined with the cache-blocked implementations.
+		 * @param testDuration The number of seconds for each test, with range (0, infinity)
+		 * @param worker The worker object
+		 * @return True, if succeeded
+		 */
+		static bool testLargeMatrixProducts(const double testDuration, Worker& worker);
+
 	private:
 
 		/**
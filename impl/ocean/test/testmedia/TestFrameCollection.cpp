@@ -0,0 +1,495 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "ocean/test/testmedia/TestFrameCollection.h"
+
+#include "ocean/test/TestResult.h"
+#include "ocean/test/Validation.h"
+
+#include "ocean/base/RandomI.h"
+#include "ocean/base/Timestamp.h"
+
+#include "ocean/media/FrameCollection.h"
+
+#include <thread>
+
+namespace Ocean
+{
+
+namespace Test
+{
+
+namespace TestMedia
+{
+
+bool TestFrameCollection::test(const double testDuration, const TestSelector& selector)
+{
+	ocean_assert(testDuration > 0.0);
+
+	TestResult testResult("FrameCollection test");
+
+	Log::info() << " ";
+
+	if (selector.shouldRun("setandget"))
+	{
+		testResult = testSetAndGet(testDuration);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
+	if (selector.shouldRun("referencedframes"))
+	{
+		testResult = testReferencedFrames(testDuration);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
+	if (selector.shouldRun("concurrentaccess"))
+	{
+		testResult = testConcurrentAccess(testDuration);
+
+		Log::info() << " ";
+	}
+
+	Log::info() << selector << " " << testResult;
+
+	return testResult.succeeded();
+}
+
+#ifdef OCEAN_USE_GTEST
+
+TEST(TestFrameCollection, SetAndGet)
+{
+	EXPECT_TRUE(TestFrameCollection::testSetAndGet(GTEST_TEST_DURATION));
+}
+
+TEST(TestFrameCollection, ReferencedFrames)
+{
+	EXPECT_TRUE(TestFrameCollection::testReferencedFrames(GTEST_TEST_DURATION));
+}
+
+TEST(TestFrameCollection, ConcurrentAccess)
+{
+	EXPECT_TRUE(TestFrameCollection::testConcurrentAccess(GTEST_TEST_DURATION));
+}
+
+#endif // OCEAN_USE_GTEST
+
+bool TestFrameCollection::testSetAndGet(const double testDuration)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Set and get test:";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		const unsigned int capacity = RandomI::random(randomGenerator, 1u, 10u);
+		const unsigned int numberFrames = RandomI::random(randomGenerator, 0u, 30u);
+
+		Media::FrameCollection frameCollection(capacity);
+
+		OCEAN_EXPECT_EQUAL(validation, frameCollection.capacity(), size_t(capacity));
+		OCEAN_EXPECT_TRUE(validation, frameCollection.isNull());
+		OCEAN_EXPECT_TRUE(validation, frameCollection.recent().isNull());
+
+		for (unsigned int n = 0u; n < numberFrames; ++n)
+		{
+			Frame frame = createFrame(n, randomGenerator);
+
+			const FrameRef frameRef = RandomI::boolean(randomGenerator) ? frameCollection.set(frame) : frameCollection.set(std::move(frame));
+
+			OCEAN_EXPECT_TRUE(validation, frameRef && verifyFrame(*frameRef, n));
+		}
+
+		OCEAN_EXPECT_EQUAL(validation, frameCollection.isNull(), numberFrames == 0u);
+
+		if (numberFrames != 0u)
+		{
+			const FrameRef recentFrame = frameCollection.recent();
+
+			OCEAN_EXPECT_TRUE(validation, recentFrame && verifyFrame(*recentFrame, numberFrames - 1u));
+		}
+
+		for (unsigned int n = 0u; n < numberFrames + 2u; ++n)
+		{
+			const Timestamp timestamp = Timestamp(double(n));
+
+			const bool expectedHas = n < numberFrames && n + capacity >= numberFrames;
+
+			OCEAN_EXPECT_EQUAL(validation, frameCollection.has(timestamp), expectedHas);
+
+			const FrameRef frame = frameCollection.get(timestamp);
+
+			if (numberFrames == 0u)
+			{
+				OCEAN_EXPECT_TRUE(validation, frame.isNull());
+			}
+			else
+			{
+				// in case the frame does not exist, the most recent frame is returned
+
+				const unsigned int expectedIndex = expectedHas ? n : numberFrames - 1u;
+
+				OCEAN_EXPECT_TRUE(validation, frame && verifyFrame(*frame, expectedIndex));
+			}
+
+			// in contrast to get(), closest() does not return the most recent frame as fallback
+
+			const Timestamp shiftedTimestamp = Timestamp(double(n) + 0.25);
+
+			const FrameRef closestFrame = frameCollection.closest(shiftedTimestamp, 0.3);
+
+			if (expectedHas)
+			{
+				OCEAN_EXPECT_TRUE(validation, closestFrame && verifyFrame(*closestFrame, n));
+			}
+			else if (n + capacity < numberFrames)
+			{
+				OCEAN_EXPECT_TRUE(validation, closestFrame.isNull());
+			}
+
+			OCEAN_EXPECT_TRUE(validation, frameCollection.closest(shiftedTimestamp, 0.1).isNull());
+		}
+
+		{
+			// a copy must contain the same frames
+
+			const Media::FrameCollection copiedFrameCollection(frameCollection);
+
+			OCEAN_EXPECT_EQUAL(validation, copiedFrameCollection.capacity(), frameCollection.capacity());
+
+			for (unsigned int n = 0u; n < numberFrames; ++n)
+			{
+				OCEAN_EXPECT_EQUAL(validation, copiedFrameCollection.has(Timestamp(double(n))), frameCollection.has(Timestamp(double(n))));
+			}
+		}
+
+		{
+			// changing the capacity keeps the most recent frames
+
+			const unsigned int newCapacity = RandomI::random(randomGenerator, 1u, 10u);
+
+			OCEAN_EXPECT_TRUE(validation, frameCollection.setCapacity(newCapacity));
+			OCEAN_EXPECT_EQUAL(validation, frameCollection.capacity(), size_t(newCapacity));
+
+			const unsigned int remainingFrames = std::min(std::min(capacity, newCapacity), numberFrames);
+
+			for (unsigned int n = 0u; n < numberFrames; ++n)
+			{
+				const bool expectedHas = n + remainingFrames >= numberFrames;
+
+				OCEAN_EXPECT_EQUAL(validation, frameCollection.has(Timestamp(double(n))), expectedHas);
+
+				if (expectedHas)
+				{
+					const FrameRef frame = frameCollection.get(Timestamp(double(n)));
+
+					OCEAN_EXPECT_TRUE(validation, frame && verifyFrame(*frame, n));
+				}
+			}
+
+			const unsigned int additionalFrame = numberFrames + 100u;
+
+			OCEAN_EXPECT_FALSE(validation, frameCollection.set(createFrame(additionalFrame, randomGenerator)).isNull());
+			OCEAN_EXPECT_TRUE(validation, frameCollection.has(Timestamp(double(additionalFrame))));
+		}
+
+		{
+			// moving a collection moves the frames
+
+			Media::FrameCollection movedFrameCollection(std::move(frameCollection));
+
+			OCEAN_EXPECT_FALSE(validation, movedFrameCollection.isNull());
+			OCEAN_EXPECT_TRUE(validation, frameCollection.isNull());
+
+			frameCollection = std::move(movedFrameCollection);
+
+			OCEAN_EXPECT_FALSE(validation, frameCollection.isNull());
+		}
+
+		frameCollection.clear();
+
+		OCEAN_EXPECT_TRUE(validation, frameCollection.isNull());
+		OCEAN_EXPECT_FALSE(validation, bool(frameCollection));
+
+		for (unsigned int n = 0u; n < numberFrames; ++n)
+		{
+			OCEAN_EXPECT_FALSE(validation, frameCollection.has(Timestamp(double(n))));
+		}
+
+		const FrameRef frameAfterClear = frameCollection.set(createFrame(0u, randomGenerator));
+
+		OCEAN_EXPECT_TRUE(validation, frameAfterClear && verifyFrame(*frameAfterClear, 0u));
+		OCEAN_EXPECT_TRUE(validation, bool(frameCollection));
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
+bool TestFrameCollection::testReferencedFrames(const double testDuration)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Referenced frames test:";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		const unsigned int capacity = RandomI::random(randomGenerator, 1u, 5u);
+
+		Media::FrameCollection frameCollection(capacity);
+
+		std::vector<std::pair<FrameRef, unsigned int>> referencedFrames;
+
+		const unsigned int numberFrames = RandomI::random(randomGenerator, 1u, 50u);
+
+		unsigned int numberDroppedFrames = 0u;
+
+		for (unsigned int n = 0u; n < numberFrames; ++n)
+		{
+			if (frameCollection.set(createFrame(n, randomGenerator)).isNull())
+			{
+				++numberDroppedFrames;
+			}
+
+			if (RandomI::random(randomGenerator, 3u) == 0u)
+			{
+				// a consumer keeps a reference to the most recent frame
+
+				FrameRef frame = frameCollection.recent();
+
+				if (frame)
+				{
+					const unsigned int timestampIndex = (unsigned int)(double(frame->timestamp()));
+
+					referencedFrames.emplace_back(std::move(frame), timestampIndex);
+				}
+			}
+
+			if (!referencedFrames.empty() && RandomI::random(randomGenerator, 5u) == 0u)
+			{
+				// a consumer releases one reference
+
+				const size_t index = size_t(RandomI::random(randomGenerator, (unsigned int)(referencedFrames.size()) - 1u));
+
+				referencedFrames[index] = std::move(referencedFrames.back());
+				referencedFrames.pop_back();
+			}
+
+			// the referenced frames must never be modified by the producer
+
+			for (const std::pair<FrameRef, unsigned int>& referencedFrame : referencedFrames)
+			{
+				OCEAN_EXPECT_TRUE(validation, verifyFrame(*referencedFrame.first, referencedFrame.second));
+			}
+		}
+
+		if (numberDroppedFrames == 0u)
+		{
+			const FrameRef recentFrame = frameCollection.recent();
+
+			OCEAN_EXPECT_TRUE(validation, recentFrame && verifyFrame(*recentFrame, numberFrames - 1u));
+		}
+
+		// the references remain valid even after the collection has been cleared
+
+		frameCollection.clear();
+
+		for (const std::pair<FrameRef, unsigned int>& referencedFrame : referencedFrames)
+		{
+			OCEAN_EXPECT_TRUE(validation, verifyFrame(*referencedFrame.first, referencedFrame.second));
+		}
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
+bool TestFrameCollection::testConcurrentAccess(const double testDuration)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Concurrent access test:";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		const unsigned int capacity = RandomI::random(randomGenerator, 1u, 5u);
+		const unsigned int numberConsumers = RandomI::random(randomGenerator, 1u, 4u);
+
+		Media::FrameCollection frameCollection(capacity);
+
+		std::atomic<bool> stopProducer(false);
+		std::atomic<unsigned int> numberFailures(0u);
+
+		std::thread producerThread([&frameCollection, &stopProducer, seed = randomGenerator.seed()]()
+		{
+			RandomGenerator producerRandomGenerator(seed);
+
+			unsigned int timestampIndex = 0u;
+
+			while (!stopProducer)
+			{
+				Frame frame = createFrame(timestampIndex++, producerRandomGenerator);
+
+				if (RandomI::boolean(producerRandomGenerator))
+				{
+					frameCollection.set(frame);
+				}
+				else
+				{
+					frameCollection.set(std::move(frame));
+				}
+			}
+		});
+
+		std::vector<std::thread> consumerThreads;
+
+		for (unsigned int nConsumer = 0u; nConsumer < numberConsumers; ++nConsumer)
+		{
+			consumerThreads.emplace_back([&frameCollection, &numberFailures, seed = randomGenerator.seed() + nConsumer]()
+			{
+				RandomGenerator consumerRandomGenerator(seed);
+
+				unsigned int previousTimestampIndex = 0u;
+
+				FrameRefs keptFrames;
+
+				for (unsigned int nIteration = 0u; nIteration < 2000u; ++nIteration)
+				{
+					const FrameRef frame = frameCollection.recent();
+
+					if (frame.isNull())
+					{
+						continue;
+					}
+
+					const unsigned int timestampIndex = (unsigned int)(double(frame->timestamp()));
+
+					// the most recent frame must not be older than a previous most recent frame, and the frame content must match the timestamp
+
+					if (timestampIndex < previousTimestampIndex || !verifyFrame(*frame, timestampIndex))
+					{
+						++numberFailures;
+					}
+
+					previousTimestampIndex = timestampIndex;
+
+					const Timestamp olderTimestamp(double(timestampIndex - std::min(timestampIndex, RandomI::random(consumerRandomGenerator, 3u))));
+
+					const FrameRef olderFrame = frameCollection.get(olderTimestamp);
+
+					if (olderFrame.isNull() || !verifyFrame(*olderFrame, (unsigned int)(double(olderFrame->timestamp()))))
+					{
+						++numberFailures;
+					}
+
+					if (RandomI::random(consumerRandomGenerator, 10u) == 0u)
+					{
+						keptFrames.emplace_back(frame);
+
+						if (keptFrames.size() > 2)
+						{
+							keptFrames.erase(keptFrames.begin());
+						}
+					}
+				}
+
+				for (const FrameRef& keptFrame : keptFrames)
+				{
+					if (!verifyFrame(*keptFrame, (unsigned int)(double(keptFrame->timestamp()))))
+					{
+						++numberFailures;
+					}
+				}
+			});
+		}
+
+		for (std::thread& consumerThread : consumerThreads)
+		{
+			consumerThread.join();
+		}
+
+		stopProducer = true;
+		producerThread.join();
+
+		OCEAN_EXPECT_EQUAL(validation, numberFailures.load(), 0u);
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
+Frame TestFrameCollection::createFrame(const unsigned int timestampIndex, RandomGenerator& randomGenerator)
+{
+	const unsigned int width = RandomI::random(randomGenerator, 1u, 64u);
+	const unsigned int height = RandomI::random(randomGenerator, 1u, 64u);
+
+	const unsigned int paddingElements = RandomI::random(randomGenerator, 1u, 100u) * RandomI::random(randomGenerator, 1u);
+
+	Frame frame(FrameType(width, height, FrameType::FORMAT_Y8, FrameType::ORIGIN_UPPER_LEFT), paddingElements);
+	frame.setValue(uint8_t(timestampIndex % 256u));
+
+	frame.setTimestamp(Timestamp(double(timestampIndex)));
+
+	return frame;
+}
+
+bool TestFrameCollection::verifyFrame(const Frame& frame, const unsigned int timestampIndex)
+{
+	if (!frame.isValid() || frame.timestamp() != Timestamp(double(timestampIndex)))
+	{
+		return false;
+	}
+
+	const uint8_t expectedValue = uint8_t(timestampIndex % 256u);
+
+	for (unsigned int y = 0u; y < frame.height(); ++y)
+	{
+		const uint8_t* const row = frame.constrow<uint8_t>(y);
+
+		for (unsigned int x = 0u; x < frame.width(); ++x)
+		{
+			if (row[x] != expectedValue)
+			{
+				return false;
+			}
+		}
+	}
+
+	return true;
+}
+
+}
+
+}
+
+}
@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#ifndef META_OCEAN_TEST_TESTMEDIA_TEST_FRAME_COLLECTION_H
+#define META_OCEAN_TEST_TESTMEDIA_TEST_FRAME_COLLECTION_H
+
+#include "ocean/test/testmedia/TestMedia.h"
+
+#include "ocean/test/TestSelector.h"
+
+#include "ocean/base/Frame.h"
+#include "ocean/base/RandomGenerator.h"
+
+namespace Ocean
+{
+
+namespace Test
+{
+
+namespace TestMedia
+{
+
+/**
+ * This class implements a test for the FrameCollection class.
+ * @ingroup testmedia
+ */
+class OCEAN_TEST_MEDIA_EXPORT TestFrameCollection
+{
+	public:
+
+		/**
+		 * Invokes all tests that are defined.
+		 * @param testDuration The number of seconds for each test
+		 * @param selector The test selector
+		 * @return True, if succeeded
+		 */
+		static bool test(const double testDuration, const TestSelector& selector);
+
+		/**
+		 * Tests setting and accessing frames with a single thread.
+		 * @param testDuration The number of seconds for each test
+		 * @return True, if succeeded
+		 */
+		static bool testSetAndGet(const double testDuration);
+
+		/**
+		 * Tests that references of consumers are not modified while new frames are set.
+		 * @param testDuration The number of seconds for each test
+		 * @return True, if succeeded
+		 */
+		static bool testReferencedFrames(const double testDuration);
+
+		/**
+		 * Tests one producer thread setting frames while several consumer threads access the frames concurrently.
+		 * @param testDuration The number of seconds for each test
+		 * @return True, if succeeded
+		 */
+		static bool testConcurrentAccess(const double testDuration);
+
+	protected:
+
+		/**
+		 * Creates a frame with a specific timestamp, all pixel values are set to a value derived from the timestamp.
+		 * @param timestampIndex The index of the timestamp, with range [0, infinity)
+		 * @param randomGenerator The random generator to be used
+		 * @return The resulting frame
+		 */
+		static Frame createFrame(const unsigned int timestampIndex, RandomGenerator& randomGenerator);
+
+		/**
+		 * Returns whether a frame has been created with a specific timestamp index.
+		 * @param frame The frame to check
+		 * @param timestampIndex The index of the timestamp which has been used to create the frame
+		 * @return True, if so
+		 */
+		static bool verifyFrame(const Frame& frame, const unsigned int timestampIndex);
+};
+
+}
+
+}
+
+}
+
+#endif // META_OCEAN_TEST_TESTMEDIA_TEST_FRAME_COLLECTION_H
@@ -6,6 +6,7 @@
  */
 
 #include "ocean/test/testmedia/TestMedia.h"
+#include "ocean/test/testmedia/TestFrameCollection.h"
 #include "ocean/test/testmedia/TestMovie.h"
 #include "ocean/test/testmedia/TestOpenImageLibraries.h"
 #include "ocean/test/testmedia/TestSpecial.h"
@@ -167,6 +168,16 @@ bool testMedia(const double testDuration, Worker& /*worker*/, const std::string&
 
 #endif
 
+	if (TestSelector subSelector = selector.shouldRun("framecollection"))
+	{
+		Log::info() << " ";
+		Log::info() << " ";
+		Log::info() << " ";
+		Log::info() << " ";
+
+		testResult = TestFrameCollection::test(testDuration, subSelector);
+	}
+
 	if (TestSelector subSelector = selector.shouldRun("movie"))
 	{
 		Log::info() << " ";
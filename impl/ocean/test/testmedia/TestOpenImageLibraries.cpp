@@ -19,6 +19,9 @@
 #include "ocean/cv/FrameConverter.h"
 #include "ocean/cv/FrameFilterGaussian.h"
 
+#include "ocean/io/Directory.h"
+#include "ocean/io/File.h"
+
 #include "ocean/media/BufferImage.h"
 #include "ocean/media/BufferImageRecorder.h"
 #include "ocean/media/Manager.h"
@@ -76,6 +79,15 @@ bool TestOpenImageLibraries::test(const double testDuration, const TestSelector&
 		Log::info() << " ";
 	}
 
+	if (selector.shouldRun("jpgimagedecodereducedresolution"))
+	{
+		testResult = testJpgImageDecodeReducedResolution(testDuration);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
 	if (selector.shouldRun("jpgdecodestresstest"))
 	{
 	#ifdef OCEAN_DEBUG
@@ -216,6 +228,15 @@ bool TestOpenImageLibraries::test(const double testDuration, const TestSelector&
 		Log::info() << " ";
 	}
 
+	if (selector.shouldRun("asyncimageloading"))
+	{
+		testResult = testAsyncImageLoading(testDuration);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
 	if (selector.shouldRun("decodestresstest"))
 	{
 #ifdef OCEAN_DEBUG
@@ -368,6 +389,11 @@ TEST_F(TestOpenImageLibrariesGTestInstance, JpgImageRGB24Recorder)
 	EXPECT_TRUE(TestOpenImageLibraries::testBufferImageRecorder(FrameType(640u, 480u, FrameType::FORMAT_RGB24, FrameType::ORIGIN_UPPER_LEFT), "jpg", 10.0));
 }
 
+TEST_F(TestOpenImageLibrariesGTestInstance, JpgImageDecodeReducedResolution)
+{
+	EXPECT_TRUE(TestOpenImageLibraries::testJpgImageDecodeReducedResolution(GTEST_TEST_DURATION));
+}
+
 #ifndef OCEAN_DEBUG
 	TEST_F(TestOpenImageLibrariesGTestInstance, JpgDecodeStressTest)
 	{
@@ -534,6 +560,11 @@ TEST_F(TestOpenImageLibrariesGTestInstance, AnyImageEncodeDecode)
 	EXPECT_TRUE(TestOpenImageLibraries::testAnyImageEncodeDecode(GTEST_TEST_DURATION));
 }
 
+TEST_F(TestOpenImageLibrariesGTestInstance, AsyncImageLoading)
+{
+	EXPECT_TRUE(TestOpenImageLibraries::testAsyncImageLoading(GTEST_TEST_DURATION));
+}
+
 
 #ifndef OCEAN_DEBUG
 	TEST_F(TestOpenImageLibrariesGTestInstance, DecodeStressTest)
@@ -620,6 +651,116 @@ bool TestOpenImageLibraries::testJpgImageEncodeDecode(const double testDuration)
 	return validation.succeeded();
 }
 
+bool TestOpenImageLibraries::testJpgImageDecodeReducedResolution(const double testDuration)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "JPEG image decode with reduced resolution test:";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		const unsigned int width = RandomI::random(randomGenerator, 1u, 1000u);
+		const unsigned int height = RandomI::random(randomGenerator, 1u, 1000u);
+
+		const FrameType::PixelFormat pixelFormat = RandomI::random(randomGenerator, {FrameType::FORMAT_Y8, FrameType::FORMAT_RGB24});
+
+		// we use a frame with constant color, so that the reduced image has the same color
+
+		Frame sourceFrame(FrameType(width, height, pixelFormat, FrameType::ORIGIN_UPPER_LEFT));
+
+		uint8_t color[3];
+		for (unsigned int n = 0u; n < 3u; ++n)
+		{
+			color[n] = uint8_t(RandomI::random(randomGenerator, 255u));
+		}
+
+		for (unsigned int y = 0u; y < sourceFrame.height(); ++y)
+		{
+			uint8_t* row = sourceFrame.row<uint8_t>(y);
+
+			for (unsigned int x = 0u; x < sourceFrame.width(); ++x)
+			{
+				for (unsigned int c = 0u; c < sourceFrame.channels(); ++c)
+				{
+					row[x * sourceFrame.channels() + c] = color[c];
+				}
+			}
+		}
+
+		std::vector<uint8_t> buffer;
+		if (!Media::OpenImageLibraries::ImageJpg::encodeImage(sourceFrame, buffer, false /*allowConversion*/, nullptr, 95))
+		{
+			OCEAN_SET_FAILED(validation);
+			break;
+		}
+
+		const unsigned int minimalWidth = RandomI::random(randomGenerator, 0u, width);
+		const unsigned int minimalHeight = RandomI::random(randomGenerator, 0u, height);
+
+		const Frame reducedFrame = Media::OpenImageLibraries::ImageJpg::decodeImage(buffer.data(), buffer.size(), minimalWidth, minimalHeight);
+
+		if (!reducedFrame.isValid())
+		{
+			OCEAN_SET_FAILED(validation);
+			break;
+		}
+
+		// the expected size is based on the largest possible scale denominator
+
+		unsigned int expectedWidth = width;
+		unsigned int expectedHeight = height;
+
+		for (const unsigned int scaleDenominator : {8u, 4u, 2u})
+		{
+			const unsigned int scaledWidth = (width + scaleDenominator - 1u) / scaleDenominator;
+			const unsigned int scaledHeight = (height + scaleDenominator - 1u) / scaleDenominator;
+
+			if (scaledWidth >= minimalWidth && scaledHeight >= minimalHeight)
+			{
+				expectedWidth = scaledWidth;
+				expectedHeight = scaledHeight;
+				break;
+			}
+		}
+
+		OCEAN_EXPECT_EQUAL(validation, reducedFrame.width(), expectedWidth);
+		OCEAN_EXPECT_EQUAL(validation, reducedFrame.height(), expectedHeight);
+
+		OCEAN_EXPECT_GREATER_EQUAL(validation, reducedFrame.width(), minimalWidth);
+		OCEAN_EXPECT_GREATER_EQUAL(validation, reducedFrame.height(), minimalHeight);
+
+		OCEAN_EXPECT_EQUAL(validation, reducedFrame.pixelFormat(), pixelFormat);
+
+		if (reducedFrame.width() == expectedWidth && reducedFrame.height() == expectedHeight && reducedFrame.pixelFormat() == pixelFormat)
+		{
+			for (unsigned int y = 0u; y < reducedFrame.height(); ++y)
+			{
+				const uint8_t* row = reducedFrame.constrow<uint8_t>(y);
+
+				for (unsigned int n = 0u; n < reducedFrame.width() * reducedFrame.channels(); ++n)
+				{
+					// the JPEG compression and color conversion can introduce small errors
+
+					if (std::abs(int(row[n]) - int(color[n % reducedFrame.channels()])) > 8)
+					{
+						OCEAN_SET_FAILED(validation);
+					}
+				}
+			}
+		}
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
 #endif // OCEAN_MEDIA_OIL_SUPPORT_JPG
 
 #ifdef OCEAN_MEDIA_OIL_SUPPORT_PNG
@@ -1586,6 +1727,128 @@ bool TestOpenImageLibraries::testWebpDecodeStressTest()
 
 #endif // OCEAN_MEDIA_OIL_SUPPORT_WEBP
 
+bool TestOpenImageLibraries::testAsyncImageLoading(const double testDuration)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Asynchronous image loading test:";
+
+	const IO::Directory directory = IO::Directory::createTemporaryDirectory();
+
+	if (!directory.isValid())
+	{
+		Log::info() << "Failed to create a temporary directory";
+		return false;
+	}
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		const unsigned int numberImages = RandomI::random(randomGenerator, 1u, 20u);
+
+		Frames sourceFrames;
+		Strings filenames;
+
+		for (unsigned int nImage = 0u; nImage < numberImages; ++nImage)
+		{
+			const unsigned int width = RandomI::random(randomGenerator, 1u, 400u);
+			const unsigned int height = RandomI::random(randomGenerator, 1u, 400u);
+
+			sourceFrames.emplace_back(CV::CVUtilities::randomizedFrame(FrameType(width, height, FrameType::FORMAT_RGB24, FrameType::ORIGIN_UPPER_LEFT), &randomGenerator));
+
+			const IO::File file = directory + IO::File("image_" + String::toAString(nImage) + "_" + String::toAString(RandomI::random32(randomGenerator)) + ".bmp");
+
+			if (!Media::OpenImageLibraries::Image::writeImage(sourceFrames.back(), file()))
+			{
+				OCEAN_SET_FAILED(validation);
+			}
+
+			filenames.emplace_back(file());
+		}
+
+		// one file which does not exist
+
+		filenames.emplace_back((directory + IO::File("not_existing.bmp"))());
+
+		std::atomic<unsigned int> invokedCallbacks(0u);
+
+		std::vector<std::shared_future<Media::MediumRef>> futures;
+
+		for (const std::string& filename : filenames)
+		{
+			futures.emplace_back(Media::Manager::get().newMediumAsync(filename, Media::Medium::IMAGE, true /*useExclusive*/, [&invokedCallbacks](const Media::MediumRef& /*medium*/)
+			{
+				++invokedCallbacks;
+			}));
+		}
+
+		for (size_t nImage = 0; nImage < futures.size(); ++nImage)
+		{
+			const Media::FrameMediumRef frameMedium(futures[nImage].get());
+
+			if (nImage < sourceFrames.size())
+			{
+				if (frameMedium.isNull())
+				{
+					OCEAN_SET_FAILED(validation);
+					continue;
+				}
+
+				const FrameRef frame = frameMedium->frame();
+
+				Frame convertedFrame;
+				if (!frame || !CV::FrameConverter::Comfort::convert(*frame, sourceFrames[nImage].pixelFormat(), sourceFrames[nImage].pixelOrigin(), convertedFrame, CV::FrameConverter::CP_AVOID_COPY_IF_POSSIBLE))
+				{
+					OCEAN_SET_FAILED(validation);
+					continue;
+				}
+
+				double minDifference, aveDifference, maxDifference;
+				if (!determineSimilarity(sourceFrames[nImage], convertedFrame, minDifference, aveDifference, maxDifference) || maxDifference != 0.0)
+				{
+					OCEAN_SET_FAILED(validation);
+				}
+			}
+			else
+			{
+				OCEAN_EXPECT_TRUE(validation, frameMedium.isNull());
+			}
+		}
+
+		// the callbacks are invoked after the futures are ready, so we wait until all callbacks have been invoked
+
+		const Timestamp callbackTimestamp(true);
+
+		while (invokedCallbacks < (unsigned int)(futures.size()) && !callbackTimestamp.hasTimePassed(5.0))
+		{
+			Thread::sleep(1u);
+		}
+
+		OCEAN_EXPECT_EQUAL(validation, (unsigned int)(invokedCallbacks), (unsigned int)(futures.size()));
+
+		for (const std::string& filename : filenames)
+		{
+			const IO::File file(filename);
+
+			if (file.exists())
+			{
+				file.remove();
+			}
+		}
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	directory.remove(true);
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
 bool TestOpenImageLibraries::testBufferImageRecorder(const FrameType& frameType, const std::string& imageType, const double maximalAverageDifference)
 {
 	ocean_assert(frameType.isValid());
@@ -48,6 +48,13 @@ class OCEAN_TEST_MEDIA_EXPORT TestOpenImageLibraries
 		 */
 		static bool testJpgImageEncodeDecode(const double testDuration);
 
+		/**
+		 * Tests decoding JPEG images with reduced resolution.
+		 * @param testDuration The number of seconds for each test
+		 * @return True, if succeeded
+		 */
+		static bool testJpgImageDecodeReducedResolution(const double testDuration);
+
 #endif // OCEAN_MEDIA_OIL_SUPPORT_JPG
 
 #ifdef OCEAN_MEDIA_OIL_SUPPORT_PNG
@@ -90,6 +97,13 @@ class OCEAN_TEST_MEDIA_EXPORT TestOpenImageLibraries
 		 */
 		static bool testAnyImageEncodeDecode(const double testDuration);
 
+		/**
+		 * Tests the asynchronous creation of image media objects via the media manager.
+		 * @param testDuration The number of seconds for each test
+		 * @return True, if succeeded
+		 */
+		static bool testAsyncImageLoading(const double testDuration);
+
 #ifdef OCEAN_MEDIA_OIL_SUPPORT_JPG
 
 		/**
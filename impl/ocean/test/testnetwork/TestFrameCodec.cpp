@@ -0,0 +1,327 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "ocean/test/testnetwork/TestFrameCodec.h"
+
+#include "ocean/test/TestResult.h"
+#include "ocean/test/Validation.h"
+
+#include "ocean/base/HighPerformanceTimer.h"
+#include "ocean/base/RandomI.h"
+#include "ocean/base/String.h"
+#include "ocean/base/Timestamp.h"
+
+#include "ocean/network/FrameCodec.h"
+
+namespace Ocean
+{
+
+namespace Test
+{
+
+namespace TestNetwork
+{
+
+bool TestFrameCodec::test(const double testDuration, const TestSelector& selector)
+{
+	ocean_assert(testDuration > 0.0);
+
+	TestResult testResult("FrameCodec test");
+	Log::info() << " ";
+
+	if (selector.shouldRun("encodedecode"))
+	{
+		testResult = testEncodeDecode(testDuration);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
+	if (selector.shouldRun("lostpacket"))
+	{
+		testResult = testLostPacket(testDuration);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
+	Log::info() << testResult;
+
+	return testResult.succeeded();
+}
+
+#ifdef OCEAN_USE_GTEST
+
+TEST(TestFrameCodec, EncodeDecode)
+{
+	EXPECT_TRUE(TestFrameCodec::testEncodeDecode(GTEST_TEST_DURATION));
+}
+
+TEST(TestFrameCodec, LostPacket)
+{
+	EXPECT_TRUE(TestFrameCodec::testLostPacket(GTEST_TEST_DURATION));
+}
+
+#endif // OCEAN_USE_GTEST
+
+bool TestFrameCodec::testEncodeDecode(const double testDuration)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Encode and decode test:";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	const FrameType::PixelFormats pixelFormats = {FrameType::FORMAT_Y8, FrameType::FORMAT_Y16, FrameType::FORMAT_RGB24, FrameType::FORMAT_RGBA32, FrameType::FORMAT_F32};
+
+	HighPerformanceStatistic performanceEncode;
+	uint64_t staticPacketBytes = 0ull;
+	uint64_t staticFrames = 0ull;
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		const unsigned int width = RandomI::random(randomGenerator, 1u, 1920u);
+		const unsigned int height = RandomI::random(randomGenerator, 1u, 1080u);
+
+		const FrameType::PixelFormat pixelFormat = RandomI::random(randomGenerator, pixelFormats);
+		const FrameType::PixelOrigin pixelOrigin = RandomI::boolean(randomGenerator) ? FrameType::ORIGIN_UPPER_LEFT : FrameType::ORIGIN_LOWER_LEFT;
+
+		const unsigned int tileSize = RandomI::random(randomGenerator, 8u, 64u);
+		const unsigned int keyFrameInterval = RandomI::random(randomGenerator, 1u, 10u);
+
+		const FrameType frameType(width, height, pixelFormat, pixelOrigin);
+		OCEAN_EXPECT_TRUE(validation, Network::FrameCodec::isSupported(frameType));
+
+		const unsigned int paddingElements = RandomI::random(randomGenerator, 0u, 1u) * RandomI::random(randomGenerator, 1u, 100u);
+
+		Frame frame(frameType, Indices32(1, paddingElements));
+		modifyFrame(frame, randomGenerator, 1u);
+
+		Network::FrameCodec::Encoder encoder(tileSize, keyFrameInterval);
+		Network::FrameCodec::Decoder decoder;
+
+		Network::FrameCodec::Buffer packet;
+
+		for (unsigned int nFrame = 0u; nFrame < 8u; ++nFrame)
+		{
+			const unsigned int regions = RandomI::random(randomGenerator, 0u, 3u);
+
+			if (nFrame != 0u)
+			{
+				modifyFrame(frame, randomGenerator, regions);
+			}
+
+			performanceEncode.start();
+				const bool encoded = encoder.encode(frame, packet);
+			performanceEncode.stop();
+
+			OCEAN_EXPECT_TRUE(validation, encoded);
+
+			if (nFrame != 0u && regions == 0u && keyFrameInterval != 1u)
+			{
+				staticPacketBytes += uint64_t(packet.size());
+				++staticFrames;
+			}
+
+			if (decoder.decode(packet.data(), packet.size()))
+			{
+				OCEAN_EXPECT_TRUE(validation, isEqual(frame, decoder.frame()));
+			}
+			else
+			{
+				OCEAN_SET_FAILED(validation);
+			}
+		}
+
+		// a frame with a different frame type results in a key frame
+
+		Frame otherFrame(FrameType(frame.frameType(), pixelFormat == FrameType::FORMAT_Y8 ? FrameType::FORMAT_RGBA32 : FrameType::FORMAT_Y8));
+		modifyFrame(otherFrame, randomGenerator, 1u);
+
+		OCEAN_EXPECT_TRUE(validation, encoder.encode(otherFrame, packet));
+
+		if (decoder.decode(packet.data(), packet.size()))
+		{
+			OCEAN_EXPECT_TRUE(validation, isEqual(otherFrame, decoder.frame()));
+		}
+		else
+		{
+			OCEAN_SET_FAILED(validation);
+		}
+
+		// invalid packets are rejected
+
+		OCEAN_EXPECT_FALSE(validation, decoder.decode(packet.data(), std::min(packet.size(), size_t(20))));
+
+		packet.back() ^= 0xFFu;
+		OCEAN_EXPECT_FALSE(validation, decoder.decode(packet.data(), packet.size()));
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Encoding performance: " << performanceEncode;
+
+	if (staticFrames != 0ull)
+	{
+		Log::info() << "Average packet size for frames without changes: " << String::toAString(double(staticPacketBytes) / double(staticFrames), 1u) << " bytes";
+	}
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
+bool TestFrameCodec::testLostPacket(const double testDuration)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Lost packet test:";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		const unsigned int width = RandomI::random(randomGenerator, 1u, 640u);
+		const unsigned int height = RandomI::random(randomGenerator, 1u, 480u);
+
+		const unsigned int keyFrameInterval = RandomI::random(randomGenerator, 3u, 10u);
+
+		Frame frame(FrameType(width, height, FrameType::FORMAT_RGB24, FrameType::ORIGIN_UPPER_LEFT));
+		modifyFrame(frame, randomGenerator, 1u);
+
+		Network::FrameCodec::Encoder encoder(32u, keyFrameInterval);
+		Network::FrameCodec::Decoder decoder;
+
+		Network::FrameCodec::Buffer packet;
+
+		// the first packet is a key frame
+
+		OCEAN_EXPECT_TRUE(validation, encoder.encode(frame, packet));
+		OCEAN_EXPECT_TRUE(validation, decoder.decode(packet.data(), packet.size()));
+
+		// the second packet is lost
+
+		modifyFrame(frame, randomGenerator, 2u);
+		OCEAN_EXPECT_TRUE(validation, encoder.encode(frame, packet));
+
+		// all following packets cannot be decoded until the next key frame
+
+		for (unsigned int nFrame = 2u; nFrame < keyFrameInterval; ++nFrame)
+		{
+			modifyFrame(frame, randomGenerator, 2u);
+			OCEAN_EXPECT_TRUE(validation, encoder.encode(frame, packet));
+
+			OCEAN_EXPECT_FALSE(validation, decoder.decode(packet.data(), packet.size()));
+		}
+
+		modifyFrame(frame, randomGenerator, 2u);
+		OCEAN_EXPECT_TRUE(validation, encoder.encode(frame, packet));
+
+		if (decoder.decode(packet.data(), packet.size()))
+		{
+			OCEAN_EXPECT_TRUE(validation, isEqual(frame, decoder.frame()));
+		}
+		else
+		{
+			OCEAN_SET_FAILED(validation);
+		}
+
+		// a requested key frame can be decoded by a new decoder
+
+		Network::FrameCodec::Decoder newDecoder;
+
+		modifyFrame(frame, randomGenerator, 1u);
+		OCEAN_EXPECT_TRUE(validation, encoder.encode(frame, packet));
+		OCEAN_EXPECT_FALSE(validation, newDecoder.decode(packet.data(), packet.size()));
+
+		encoder.requestKeyFrame();
+
+		modifyFrame(frame, randomGenerator, 1u);
+		OCEAN_EXPECT_TRUE(validation, encoder.encode(frame, packet));
+
+		if (newDecoder.decode(packet.data(), packet.size()))
+		{
+			OCEAN_EXPECT_TRUE(validation, isEqual(frame, newDecoder.frame()));
+		}
+		else
+		{
+			OCEAN_SET_FAILED(validation);
+		}
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
+void TestFrameCodec::modifyFrame(Frame& frame, RandomGenerator& randomGenerator, const unsigned int regions)
+{
+	ocean_assert(frame.isValid() && frame.numberPlanes() == 1u);
+
+	const unsigned int bytesPerPixel = frame.channels() * frame.bytesPerDataType();
+
+	for (unsigned int nRegion = 0u; nRegion < regions; ++nRegion)
+	{
+		const unsigned int left = RandomI::random(randomGenerator, frame.width() - 1u);
+		const unsigned int top = RandomI::random(randomGenerator, frame.height() - 1u);
+
+		// the first region of a new frame covers the entire frame
+		const bool entireFrame = nRegion == 0u && regions == 1u && RandomI::boolean(randomGenerator);
+
+		const unsigned int regionLeft = entireFrame ? 0u : left;
+		const unsigned int regionTop = entireFrame ? 0u : top;
+		const unsigned int regionWidth = entireFrame ? frame.width() : RandomI::random(randomGenerator, 1u, frame.width() - left);
+		const unsigned int regionHeight = entireFrame ? frame.height() : RandomI::random(randomGenerator, 1u, frame.height() - top);
+
+		const uint8_t value = uint8_t(RandomI::random(randomGenerator, 255u));
+
+		for (unsigned int y = regionTop; y < regionTop + regionHeight; ++y)
+		{
+			uint8_t* const row = frame.row<uint8_t>(y) + regionLeft * bytesPerPixel;
+
+			for (unsigned int n = 0u; n < regionWidth * bytesPerPixel; ++n)
+			{
+				// a mixture of smooth and random content
+				row[n] = RandomI::random(randomGenerator, 7u) == 0u ? uint8_t(RandomI::random(randomGenerator, 255u)) : uint8_t(value + n / 16u);
+			}
+		}
+	}
+}
+
+bool TestFrameCodec::isEqual(const Frame& frameA, const Frame& frameB)
+{
+	ocean_assert(frameA.isValid() && frameB.isValid());
+
+	if (frameA.frameType() != frameB.frameType())
+	{
+		return false;
+	}
+
+	for (unsigned int y = 0u; y < frameA.height(); ++y)
+	{
+		if (memcmp(frameA.constrow<void>(y), frameB.constrow<void>(y), frameA.planeWidthBytes(0u)) != 0)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+}
+
+}
+
+}
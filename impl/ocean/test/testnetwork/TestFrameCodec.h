@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#ifndef META_OCEAN_TEST_TESTNETWORK_TEST_FRAME_CODEC_H
+#define META_OCEAN_TEST_TESTNETWORK_TEST_FRAME_CODEC_H
+
+#include "ocean/test/testnetwork/TestNetwork.h"
+
+#include "ocean/test/TestSelector.h"
+
+#include "ocean/base/Frame.h"
+#include "ocean/base/RandomGenerator.h"
+
+namespace Ocean
+{
+
+namespace Test
+{
+
+namespace TestNetwork
+{
+
+/**
+ * This class implements tests for FrameCodec.
+ * @ingroup testnetwork
+ */
+class OCEAN_TEST_NETWORK_EXPORT TestFrameCodec
+{
+	public:
+
+		/**
+		 * Tests all FrameCodec functions.
+		 * @param testDuration The number of seconds for each test, with range (0, infinity)
+		 * @param selector The selector defining which tests to run
+		 * @return True, if succeeded
+		 */
+		static bool test(const double testDuration, const TestSelector& selector);
+
+		/**
+		 * Tests encoding and decoding sequences of frames with random changes.
+		 * @param testDuration The number of seconds for each test, with range (0, infinity)
+		 * @return True, if succeeded
+		 */
+		static bool testEncodeDecode(const double testDuration);
+
+		/**
+		 * Tests that the decoder waits for the next key frame after a lost packet.
+		 * @param testDuration The number of seconds for each test, with range (0, infinity)
+		 * @return True, if succeeded
+		 */
+		static bool testLostPacket(const double testDuration);
+
+	protected:
+
+		/**
+		 * Modifies random rectangular regions of a frame.
+		 * @param frame The frame to modify, must be valid
+		 * @param randomGenerator The random generator to be used
+		 * @param regions The number of regions to modify, with range [0, infinity)
+		 */
+		static void modifyFrame(Frame& frame, RandomGenerator& randomGenerator, const unsigned int regions);
+
+		/**
+		 * Returns whether two frames have the same frame type and the same pixel values, padding is ignored.
+		 * @param frameA The first frame, must be valid
+		 * @param frameB The second frame, must be valid
+		 * @return True, if so
+		 */
+		static bool isEqual(const Frame& frameA, const Frame& frameB);
+};
+
+}
+
+}
+
+}
+
+#endif // META_OCEAN_TEST_TESTNETWORK_TEST_FRAME_CODEC_H
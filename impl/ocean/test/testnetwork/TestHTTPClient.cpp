@@ -0,0 +1,626 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "ocean/test/testnetwork/TestHTTPClient.h"
+
+#include "ocean/base/RandomI.h"
+#include "ocean/base/String.h"
+#include "ocean/base/Thread.h"
+#include "ocean/base/Timestamp.h"
+
+#include "ocean/test/TestResult.h"
+#include "ocean/test/Validation.h"
+
+#include <future>
+
+namespace Ocean
+{
+
+namespace Test
+{
+
+namespace TestNetwork
+{
+
+TestHTTPClient::HTTPServer::HTTPServer(const bool keepAlive) :
+	keepAlive_(keepAlive)
+{
+	tcpServer_.setConnectionRequestCallback(Network::TCPServer::ConnectionRequestCallback::create(*this, &HTTPServer::onConnectionRequest));
+	tcpServer_.setDisconnectCallback(Network::TCPServer::DisconnectCallback::create(*this, &HTTPServer::onDisconnected));
+	tcpServer_.setReceiveCallback(Network::TCPServer::ReceiveCallback::create(*this, &HTTPServer::onReceive));
+}
+
+TestHTTPClient::HTTPServer::~HTTPServer()
+{
+	stopThread_ = true;
+
+	if (thread_.joinable())
+	{
+		thread_.join();
+	}
+
+	tcpServer_.stop();
+}
+
+bool TestHTTPClient::HTTPServer::start()
+{
+	if (!tcpServer_.start())
+	{
+		return false;
+	}
+
+	thread_ = std::thread(&HTTPServer::sendResponses, this);
+
+	return true;
+}
+
+Network::Port TestHTTPClient::HTTPServer::port() const
+{
+	return tcpServer_.port();
+}
+
+void TestHTTPClient::HTTPServer::setResource(const std::string& uri, Buffer&& data)
+{
+	const ScopedLock scopedLock(lock_);
+
+	resources_[uri] = std::move(data);
+}
+
+void TestHTTPClient::HTTPServer::disconnectAll()
+{
+	TemporaryScopedLock scopedLock(lock_);
+		const std::unordered_set<Network::TCPServer::ConnectionId> connectionIds(connectionIds_);
+	scopedLock.release();
+
+	for (const Network::TCPServer::ConnectionId connectionId : connectionIds)
+	{
+		tcpServer_.disconnect(connectionId);
+	}
+}
+
+bool TestHTTPClient::HTTPServer::onConnectionRequest(const Network::Address4& /*address*/, const Network::Port& /*port*/, const Network::TCPServer::ConnectionId connectionId)
+{
+	const ScopedLock scopedLock(lock_);
+
+	connectionIds_.emplace(connectionId);
+	++connections_;
+
+	return true;
+}
+
+void TestHTTPClient::HTTPServer::onDisconnected(const Network::TCPServer::ConnectionId connectionId)
+{
+	const ScopedLock scopedLock(lock_);
+
+	connectionIds_.erase(connectionId);
+	incompleteRequests_.erase(connectionId);
+}
+
+void TestHTTPClient::HTTPServer::onReceive(const Network::TCPServer::ConnectionId connectionId, const void* data, const size_t size)
+{
+	ocean_assert(data != nullptr && size != 0);
+
+	const ScopedLock scopedLock(lock_);
+
+	std::string& incompleteRequest = incompleteRequests_[connectionId];
+	incompleteRequest.append((const char*)(data), size);
+
+	// several requests may arrive at once on a persistent connection
+
+	std::string::size_type end = incompleteRequest.find("\r\n\r\n");
+
+	while (end != std::string::npos)
+	{
+		const std::string request = incompleteRequest.substr(0, end);
+		incompleteRequest.erase(0, end + 4);
+
+		PendingResponse pendingResponse;
+		pendingResponse.connectionId_ = connectionId;
+		pendingResponse.closeConnection_ = !keepAlive_;
+
+		createResponse(request, pendingResponse.data_);
+
+		pendingResponses_.emplace_back(std::move(pendingResponse));
+
+		end = incompleteRequest.find("\r\n\r\n");
+	}
+}
+
+void TestHTTPClient::HTTPServer::createResponse(const std::string& request, Buffer& response)
+{
+	++requests_;
+
+	// e.g., "GET /uri HTTP/1.1"
+
+	const std::string::size_type methodEnd = request.find(' ');
+	const std::string::size_type uriEnd = methodEnd != std::string::npos ? request.find(' ', methodEnd + 1) : std::string::npos;
+
+	const std::string connectionLine = keepAlive_ ? "Connection: keep-alive\r\n" : "Connection: close\r\n";
+
+	if (uriEnd == std::string::npos || request[methodEnd + 1] != '/')
+	{
+		const std::string header = "HTTP/1.1 400 Bad Request\r\nContent-Length: 0\r\n" + connectionLine + "\r\n";
+		response.assign(header.cbegin(), header.cend());
+		return;
+	}
+
+	const std::string method = request.substr(0, methodEnd);
+	const std::string uri = request.substr(methodEnd + 2, uriEnd - methodEnd - 2);
+
+	const std::unordered_map<std::string, Buffer>::const_iterator iResource = resources_.find(uri);
+
+	if (iResource == resources_.cend() || (method != "GET" && method != "HEAD"))
+	{
+		const std::string header = "HTTP/1.1 404 Not Found\r\nContent-Length: 0\r\n" + connectionLine + "\r\n";
+		response.assign(header.cbegin(), header.cend());
+		return;
+	}
+
+	const Buffer& resource = iResource->second;
+
+	size_t payloadStart = 0;
+	size_t payloadSize = resource.size();
+
+	std::string header;
+
+	const std::string::size_type rangePosition = request.find("\r\nRange: bytes=");
+
+	if (rangePosition != std::string::npos && method == "GET")
+	{
+		++rangeRequests_;
+
+		unsigned long long rangeFirst = 0ull;
+		unsigned long long rangeLast = 0ull;
+
+		if (sscanf(request.c_str() + rangePosition + 15, "%llu-%llu", &rangeFirst, &rangeLast) != 2 || rangeFirst > rangeLast || rangeLast >= resource.size())
+		{
+			header = "HTTP/1.1 416 Range Not Satisfiable\r\nContent-Length: 0\r\n" + connectionLine + "\r\n";
+			response.assign(header.cbegin(), header.cend());
+			return;
+		}
+
+		payloadStart = size_t(rangeFirst);
+		payloadSize = size_t(rangeLast - rangeFirst + 1ull);
+
+		header = "HTTP/1.1 206 Partial Content\r\nContent-Range: bytes " + String::toAString(rangeFirst) + "-" + String::toAString(rangeLast) + "/" + String::toAString(resource.size()) + "\r\n";
+	}
+	else
+	{
+		header = "HTTP/1.1 200 OK\r\n";
+	}
+
+	header += "Content-Length: " + String::toAString(payloadSize) + "\r\nAccept-Ranges: bytes\r\n" + connectionLine + "\r\n";
+
+	response.assign(header.cbegin(), header.cend());
+
+	if (method == "GET")
+	{
+		response.insert(response.end(), resource.cbegin() + payloadStart, resource.cbegin() + payloadStart + payloadSize);
+	}
+}
+
+void TestHTTPClient::HTTPServer::sendResponses()
+{
+	while (!stopThread_)
+	{
+		TemporaryScopedLock scopedLock(lock_);
+			PendingResponses pendingResponses(std::move(pendingResponses_));
+			pendingResponses_.clear();
+		scopedLock.release();
+
+		if (pendingResponses.empty())
+		{
+			Thread::sleep(1u);
+			continue;
+		}
+
+		for (const PendingResponse& pendingResponse : pendingResponses)
+		{
+			tcpServer_.send(pendingResponse.connectionId_, pendingResponse.data_.data(), pendingResponse.data_.size());
+
+			if (pendingResponse.closeConnection_)
+			{
+				tcpServer_.disconnect(pendingResponse.connectionId_);
+			}
+		}
+	}
+}
+
+bool TestHTTPClient::test(const double testDuration, const TestSelector& selector)
+{
+	ocean_assert(testDuration > 0.0);
+
+	TestResult testResult("HTTPClient test");
+	Log::info() << " ";
+
+	if (selector.shouldRun("keepalive"))
+	{
+		testResult = testKeepAlive(testDuration);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
+	if (selector.shouldRun("closedconnections"))
+	{
+		testResult = testClosedConnections(testDuration);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
+	if (selector.shouldRun("paralleldownload"))
+	{
+		testResult = testParallelDownload(testDuration);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
+	if (selector.shouldRun("concurrentrequests"))
+	{
+		testResult = testConcurrentRequests(testDuration);
+
+		Log::info() << " ";
+	}
+
+	Log::info() << testResult;
+
+	return testResult.succeeded();
+}
+
+#ifdef OCEAN_USE_GTEST
+
+TEST(TestHTTPClient, KeepAlive)
+{
+	EXPECT_TRUE(TestHTTPClient::testKeepAlive(GTEST_TEST_DURATION));
+}
+
+TEST(TestHTTPClient, ClosedConnections)
+{
+	EXPECT_TRUE(TestHTTPClient::testClosedConnections(GTEST_TEST_DURATION));
+}
+
+TEST(TestHTTPClient, ParallelDownload)
+{
+	EXPECT_TRUE(TestHTTPClient::testParallelDownload(GTEST_TEST_DURATION));
+}
+
+TEST(TestHTTPClient, ConcurrentRequests)
+{
+	EXPECT_TRUE(TestHTTPClient::testConcurrentRequests(GTEST_TEST_DURATION));
+}
+
+#endif // OCEAN_USE_GTEST
+
+bool TestHTTPClient::testKeepAlive(const double testDuration)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Keep-alive test:";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		HTTPServer server(true /*keepAlive*/);
+
+		if (!server.start())
+		{
+			OCEAN_SET_FAILED(validation);
+			break;
+		}
+
+		const unsigned int numberResources = RandomI::random(randomGenerator, 1u, 5u);
+
+		std::vector<Buffer> resources;
+
+		for (unsigned int n = 0u; n < numberResources; ++n)
+		{
+			resources.emplace_back(createResource(RandomI::random(randomGenerator, 0u, 100000u), randomGenerator));
+			server.setResource("resource" + String::toAString(n), Buffer(resources.back()));
+		}
+
+		const unsigned int numberRequests = RandomI::random(randomGenerator, 2u, 20u);
+
+		for (unsigned int n = 0u; n < numberRequests; ++n)
+		{
+			const unsigned int resourceIndex = RandomI::random(randomGenerator, numberResources - 1u);
+
+			Buffer data;
+			Network::HTTPClient::HTTPHeader::ReplyCode replyCode = Network::HTTPClient::HTTPHeader::RC_INVALID;
+
+			OCEAN_EXPECT_TRUE(validation, Network::HTTPClient::httpGetRequest(localURL("resource" + String::toAString(resourceIndex)), data, server.port(), 5.0, true, nullptr, &replyCode));
+
+			OCEAN_EXPECT_EQUAL(validation, replyCode, Network::HTTPClient::HTTPHeader::RC_OK);
+			OCEAN_EXPECT_TRUE(validation, data == resources[resourceIndex]);
+		}
+
+		// all sequential requests have been sent over one persistent connection
+
+		OCEAN_EXPECT_EQUAL(validation, server.connections(), 1u);
+		OCEAN_EXPECT_EQUAL(validation, server.requests(), numberRequests);
+
+		// the connection of a failed request is not pooled, the next request uses a new connection
+
+		Buffer data;
+		OCEAN_EXPECT_FALSE(validation, Network::HTTPClient::httpGetRequest(localURL("unknown"), data, server.port()));
+
+		OCEAN_EXPECT_TRUE(validation, Network::HTTPClient::httpGetRequest(localURL("resource0"), data, server.port()));
+		OCEAN_EXPECT_TRUE(validation, data == resources[0]);
+
+		OCEAN_EXPECT_EQUAL(validation, server.connections(), 2u);
+		OCEAN_EXPECT_EQUAL(validation, server.requests(), numberRequests + 2u);
+
+		// the pooled connection must not be used for the next server
+
+		Network::HTTPClient::ConnectionPool::get().clear();
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
+bool TestHTTPClient::testClosedConnections(const double testDuration)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Closed connections test:";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		const Buffer resource = createResource(RandomI::random(randomGenerator, 1u, 100000u), randomGenerator);
+
+		{
+			// the server closes each connection after the response, so that no connection can be reused
+
+			HTTPServer server(false /*keepAlive*/);
+
+			if (!server.start())
+			{
+				OCEAN_SET_FAILED(validation);
+				break;
+			}
+
+			server.setResource("resource", Buffer(resource));
+
+			const unsigned int numberRequests = RandomI::random(randomGenerator, 1u, 5u);
+
+			for (unsigned int n = 0u; n < numberRequests; ++n)
+			{
+				Buffer data;
+				OCEAN_EXPECT_TRUE(validation, Network::HTTPClient::httpGetRequest(localURL("resource"), data, server.port()));
+				OCEAN_EXPECT_TRUE(validation, data == resource);
+			}
+
+			OCEAN_EXPECT_EQUAL(validation, server.connections(), numberRequests);
+		}
+
+		Network::HTTPClient::ConnectionPool::get().clear();
+
+		{
+			// the server closes an idle connection while the connection is in the pool, the request must be repeated with a new connection
+
+			HTTPServer server(true /*keepAlive*/);
+
+			if (!server.start())
+			{
+				OCEAN_SET_FAILED(validation);
+				break;
+			}
+
+			server.setResource("resource", Buffer(resource));
+
+			Buffer data;
+			OCEAN_EXPECT_TRUE(validation, Network::HTTPClient::httpGetRequest(localURL("resource"), data, server.port()));
+			OCEAN_EXPECT_TRUE(validation, data == resource);
+
+			server.disconnectAll();
+
+			Thread::sleep(RandomI::random(randomGenerator, 0u, 20u));
+
+			data.clear();
+			OCEAN_EXPECT_TRUE(validation, Network::HTTPClient::httpGetRequest(localURL("resource"), data, server.port()));
+			OCEAN_EXPECT_TRUE(validation, data == resource);
+
+			OCEAN_EXPECT_EQUAL(validation, server.connections(), 2u);
+		}
+
+		Network::HTTPClient::ConnectionPool::get().clear();
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
+bool TestHTTPClient::testParallelDownload(const double testDuration)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Parallel download test:";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		HTTPServer server(true /*keepAlive*/);
+
+		if (!server.start())
+		{
+			OCEAN_SET_FAILED(validation);
+			break;
+		}
+
+		// small resources are downloaded with one request, large resources are split into ranges
+
+		const bool largeResource = RandomI::boolean(randomGenerator);
+
+		const size_t size = largeResource ? size_t(RandomI::random(randomGenerator, 1024u * 1024u, 3u * 1024u * 1024u)) : size_t(RandomI::random(randomGenerator, 1u, 1024u * 1024u - 1u));
+
+		const Buffer resource = createResource(size, randomGenerator);
+		server.setResource("resource", Buffer(resource));
+
+		const unsigned int numberConnections = RandomI::random(randomGenerator, 1u, 6u);
+
+		Buffer data;
+		OCEAN_EXPECT_TRUE(validation, Network::HTTPClient::httpGetRequestParallel(localURL("resource"), data, server.port(), numberConnections));
+
+		OCEAN_EXPECT_TRUE(validation, data == resource);
+
+		if (largeResource && numberConnections >= 2u)
+		{
+			OCEAN_EXPECT_GREATER_EQUAL(validation, server.rangeRequests(), 2u);
+		}
+		else
+		{
+			OCEAN_EXPECT_EQUAL(validation, server.rangeRequests(), 0u);
+		}
+
+		// the server must not be asked for more connections than allowed, the HEAD request uses one of them
+
+		OCEAN_EXPECT_LESS_EQUAL(validation, server.connections(), std::max(1u, numberConnections));
+
+		Network::HTTPClient::ConnectionPool::get().clear();
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
+bool TestHTTPClient::testConcurrentRequests(const double testDuration)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Concurrent requests test:";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		HTTPServer server(true /*keepAlive*/);
+
+		if (!server.start())
+		{
+			OCEAN_SET_FAILED(validation);
+			break;
+		}
+
+		const unsigned int numberResources = RandomI::random(randomGenerator, 1u, 20u);
+
+		std::vector<Buffer> resources;
+		Strings urls;
+
+		for (unsigned int n = 0u; n < numberResources; ++n)
+		{
+			resources.emplace_back(createResource(RandomI::random(randomGenerator, 0u, 50000u), randomGenerator));
+			server.setResource("resource" + String::toAString(n), Buffer(resources.back()));
+
+			urls.emplace_back(localURL("resource" + String::toAString(n)));
+		}
+
+		// one request fails, all others must succeed
+
+		const bool withUnknownResource = RandomI::boolean(randomGenerator);
+
+		if (withUnknownResource)
+		{
+			urls.emplace_back(localURL("unknown"));
+		}
+
+		Network::HTTPClient::Responses responses;
+		OCEAN_EXPECT_EQUAL(validation, Network::HTTPClient::httpGetRequests(urls, responses, server.port()), !withUnknownResource);
+
+		OCEAN_EXPECT_EQUAL(validation, responses.size(), urls.size());
+
+		if (responses.size() == urls.size())
+		{
+			for (unsigned int n = 0u; n < numberResources; ++n)
+			{
+				OCEAN_EXPECT_TRUE(validation, responses[n].first);
+				OCEAN_EXPECT_TRUE(validation, responses[n].second == resources[n]);
+			}
+
+			if (withUnknownResource)
+			{
+				OCEAN_EXPECT_FALSE(validation, responses.back().first);
+			}
+		}
+
+		// asynchronous requests
+
+		const unsigned int resourceIndex = RandomI::random(randomGenerator, numberResources - 1u);
+
+		std::future<Network::HTTPClient::Response> futureResponse = Network::HTTPClient::httpGetRequestAsync(urls[resourceIndex], server.port());
+
+		if (futureResponse.wait_for(std::chrono::seconds(10)) == std::future_status::ready)
+		{
+			const Network::HTTPClient::Response response = futureResponse.get();
+
+			OCEAN_EXPECT_TRUE(validation, response.first);
+			OCEAN_EXPECT_TRUE(validation, response.second == resources[resourceIndex]);
+		}
+		else
+		{
+			OCEAN_SET_FAILED(validation);
+		}
+
+		OCEAN_EXPECT_EQUAL(validation, server.requests(), (unsigned int)(urls.size()) + 1u);
+
+		Network::HTTPClient::ConnectionPool::get().clear();
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
+TestHTTPClient::Buffer TestHTTPClient::createResource(const size_t size, RandomGenerator& randomGenerator)
+{
+	Buffer data(size);
+
+	for (uint8_t& element : data)
+	{
+		element = uint8_t(RandomI::random(randomGenerator, 255u));
+	}
+
+	return data;
+}
+
+std::string TestHTTPClient::localURL(const std::string& uri)
+{
+	return "http://127.0.0.1/" + uri;
+}
+
+}
+
+}
+
+}
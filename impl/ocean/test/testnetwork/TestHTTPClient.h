@@ -0,0 +1,286 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#ifndef META_OCEAN_TEST_TESTNETWORK_TEST_HTTP_CLIENT_H
+#define META_OCEAN_TEST_TESTNETWORK_TEST_HTTP_CLIENT_H
+
+#include "ocean/test/testnetwork/TestNetwork.h"
+
+#include "ocean/base/Lock.h"
+#include "ocean/base/RandomGenerator.h"
+
+#include "ocean/network/HTTPClient.h"
+#include "ocean/network/TCPServer.h"
+
+#include "ocean/test/TestSelector.h"
+
+#include <atomic>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace Ocean
+{
+
+namespace Test
+{
+
+namespace TestNetwork
+{
+
+/**
+ * This class implements tests for HTTPClient, all requests are sent to a minimal HTTP server on the local host.
+ * @ingroup testnetwork
+ */
+class OCEAN_TEST_NETWORK_EXPORT TestHTTPClient
+{
+	protected:
+
+		/**
+		 * Definition of a vector holding bytes.
+		 */
+		using Buffer = Network::HTTPClient::Buffer;
+
+		/**
+		 * This class implements a minimal HTTP/1.1 server supporting GET, HEAD, and range requests.
+		 * The responses are sent from an own thread, so that the socket scheduler can receive the responses on the client side meanwhile.
+		 */
+		class HTTPServer
+		{
+			protected:
+
+				/**
+				 * Definition of a response which is about to be sent.
+				 */
+				class PendingResponse
+				{
+					public:
+
+						/// The id of the connection to which the response is sent.
+						Network::TCPServer::ConnectionId connectionId_ = Network::TCPServer::invalidConnectionId();
+
+						/// The response, header and payload.
+						Buffer data_;
+
+						/// True, to close the connection after the response has been sent.
+						bool closeConnection_ = false;
+				};
+
+				/**
+				 * Definition of a vector holding pending responses.
+				 */
+				using PendingResponses = std::vector<PendingResponse>;
+
+			public:
+
+				/**
+				 * Creates a new server.
+				 * @param keepAlive True, to keep connections open after a response; False, to close each connection after the response
+				 */
+				explicit HTTPServer(const bool keepAlive);
+
+				/**
+				 * Destructs the server.
+				 */
+				~HTTPServer();
+
+				/**
+				 * Starts the server on a free port of the local host.
+				 * @return True, if succeeded
+				 */
+				bool start();
+
+				/**
+				 * Returns the port of the server.
+				 * @return The server's port
+				 */
+				Network::Port port() const;
+
+				/**
+				 * Sets the data of a resource.
+				 * @param uri The URI of the resource, without leading '/'
+				 * @param data The data of the resource
+				 */
+				void setResource(const std::string& uri, Buffer&& data);
+
+				/**
+				 * Closes all connections, e.g., to simulate a server closing idle connections.
+				 */
+				void disconnectAll();
+
+				/**
+				 * Returns the number of connections which have been established so far.
+				 * @return The number of connections
+				 */
+				inline unsigned int connections() const;
+
+				/**
+				 * Returns the number of requests which have been received so far.
+				 * @return The number of requests
+				 */
+				inline unsigned int requests() const;
+
+				/**
+				 * Returns the number of range requests which have been received so far.
+				 * @return The number of range requests
+				 */
+				inline unsigned int rangeRequests() const;
+
+			protected:
+
+				/**
+				 * Event function for connection requests.
+				 * @param address The address of the client
+				 * @param port The port of the client
+				 * @param connectionId The id of the connection
+				 * @return True, to accept the connection
+				 */
+				bool onConnectionRequest(const Network::Address4& address, const Network::Port& port, const Network::TCPServer::ConnectionId connectionId);
+
+				/**
+				 * Event function for disconnected connections.
+				 * @param connectionId The id of the connection
+				 */
+				void onDisconnected(const Network::TCPServer::ConnectionId connectionId);
+
+				/**
+				 * Event function for received data, complete requests are answered.
+				 * @param connectionId The id of the connection
+				 * @param data The received data
+				 * @param size The number of received bytes
+				 */
+				void onReceive(const Network::TCPServer::ConnectionId connectionId, const void* data, const size_t size);
+
+				/**
+				 * Creates the response for one request.
+				 * @param request The request, including the header lines, without the terminating empty line
+				 * @param response The resulting response, header and payload
+				 */
+				void createResponse(const std::string& request, Buffer& response);
+
+				/**
+				 * The thread function sending the pending responses.
+				 */
+				void sendResponses();
+
+			protected:
+
+				/// The TCP server.
+				Network::TCPServer tcpServer_;
+
+				/// True, to keep connections open after a response.
+				const bool keepAlive_;
+
+				/// The resources of the server, mapping URIs to data.
+				std::unordered_map<std::string, Buffer> resources_;
+
+				/// The incomplete requests, per connection.
+				std::unordered_map<Network::TCPServer::ConnectionId, std::string> incompleteRequests_;
+
+				/// The ids of the open connections.
+				std::unordered_set<Network::TCPServer::ConnectionId> connectionIds_;
+
+				/// The responses which are about to be sent.
+				PendingResponses pendingResponses_;
+
+				/// The number of established connections.
+				std::atomic<unsigned int> connections_ = 0u;
+
+				/// The number of received requests.
+				std::atomic<unsigned int> requests_ = 0u;
+
+				/// The number of received range requests.
+				std::atomic<unsigned int> rangeRequests_ = 0u;
+
+				/// True, to stop the thread sending the responses.
+				std::atomic<bool> stopThread_ = false;
+
+				/// The thread sending the responses.
+				std::thread thread_;
+
+				/// The server's lock.
+				mutable Lock lock_;
+		};
+
+	public:
+
+		/**
+		 * Tests all HTTPClient functions.
+		 * @param testDuration The number of seconds for each test, with range (0, infinity)
+		 * @param selector The selector defining which tests to run
+		 * @return True, if succeeded
+		 */
+		static bool test(const double testDuration, const TestSelector& selector);
+
+		/**
+		 * Tests that consecutive requests to the same server reuse one persistent connection.
+		 * @param testDuration The number of seconds for each test, with range (0, infinity)
+		 * @return True, if succeeded
+		 */
+		static bool testKeepAlive(const double testDuration);
+
+		/**
+		 * Tests requests to a server which closes its connections, either after each response or while the connection is idle in the pool.
+		 * @param testDuration The number of seconds for each test, with range (0, infinity)
+		 * @return True, if succeeded
+		 */
+		static bool testClosedConnections(const double testDuration);
+
+		/**
+		 * Tests downloads split into byte ranges which are requested over parallel connections.
+		 * @param testDuration The number of seconds for each test, with range (0, infinity)
+		 * @return True, if succeeded
+		 */
+		static bool testParallelDownload(const double testDuration);
+
+		/**
+		 * Tests asynchronous and concurrent requests executed by the threads of the connection pool.
+		 * @param testDuration The number of seconds for each test, with range (0, infinity)
+		 * @return True, if succeeded
+		 */
+		static bool testConcurrentRequests(const double testDuration);
+
+	protected:
+
+		/**
+		 * Creates a resource with random data.
+		 * @param size The number of bytes of the resource, with range [0, infinity)
+		 * @param randomGenerator The random generator to be used
+		 * @return The resulting resource data
+		 */
+		static Buffer createResource(const size_t size, RandomGenerator& randomGenerator);
+
+		/**
+		 * Returns the URL of a resource of a server on the local host.
+		 * @param uri The URI of the resource, without leading '/'
+		 * @return The resulting URL
+		 */
+		static std::string localURL(const std::string& uri);
+};
+
+inline unsigned int TestHTTPClient::HTTPServer::connections() const
+{
+	return connections_;
+}
+
+inline unsigned int TestHTTPClient::HTTPServer::requests() const
+{
+	return requests_;
+}
+
+inline unsigned int TestHTTPClient::HTTPServer::rangeRequests() const
+{
+	return rangeRequests_;
+}
+
+}
+
+}
+
+}
+
+#endif // META_OCEAN_TEST_TESTNETWORK_TEST_HTTP_CLIENT_H
@@ -0,0 +1,258 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "ocean/test/testnetwork/TestLockFreeBufferQueue.h"
+
+#include "ocean/test/TestResult.h"
+#include "ocean/test/Validation.h"
+
+#include "ocean/base/RandomGenerator.h"
+#include "ocean/base/RandomI.h"
+#include "ocean/base/Timestamp.h"
+
+#include "ocean/network/LockFreeBufferQueue.h"
+
+#include <atomic>
+#include <thread>
+
+namespace Ocean
+{
+
+namespace Test
+{
+
+namespace TestNetwork
+{
+
+bool TestLockFreeBufferQueue::test(const double testDuration, const TestSelector& selector)
+{
+	ocean_assert(testDuration > 0.0);
+
+	TestResult testResult("LockFreeBufferQueue test");
+	Log::info() << " ";
+
+	if (selector.shouldRun("singlethread"))
+	{
+		testResult = testSingleThread(testDuration);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
+	if (selector.shouldRun("multipleproducers"))
+	{
+		testResult = testMultipleProducers(testDuration);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
+	Log::info() << testResult;
+
+	return testResult.succeeded();
+}
+
+#ifdef OCEAN_USE_GTEST
+
+TEST(TestLockFreeBufferQueue, SingleThread)
+{
+	EXPECT_TRUE(TestLockFreeBufferQueue::testSingleThread(GTEST_TEST_DURATION));
+}
+
+TEST(TestLockFreeBufferQueue, MultipleProducers)
+{
+	EXPECT_TRUE(TestLockFreeBufferQueue::testMultipleProducers(GTEST_TEST_DURATION));
+}
+
+#endif // OCEAN_USE_GTEST
+
+bool TestLockFreeBufferQueue::testSingleThread(const double testDuration)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Single thread test:";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		const size_t capacity = size_t(RandomI::random(randomGenerator, 2u, 100u));
+
+		Network::LockFreeBufferQueue queue(capacity);
+
+		OCEAN_EXPECT_GREATER_EQUAL(validation, queue.capacity(), capacity);
+		OCEAN_EXPECT_TRUE(validation, queue.isEmpty());
+
+		Network::LockFreeBufferQueue::Buffer buffer;
+		OCEAN_EXPECT_FALSE(validation, queue.pop(buffer));
+		OCEAN_EXPECT_FALSE(validation, queue.pop(buffer, 0.001));
+
+		for (unsigned int nIteration = 0u; nIteration < 3u; ++nIteration)
+		{
+			std::vector<Network::LockFreeBufferQueue::Buffer> sourceBuffers;
+
+			// we fill the queue entirely
+
+			for (size_t n = 0; n < queue.capacity(); ++n)
+			{
+				Network::LockFreeBufferQueue::Buffer sourceBuffer(RandomI::random(randomGenerator, 1u, 2000u));
+
+				for (uint8_t& value : sourceBuffer)
+				{
+					value = uint8_t(RandomI::random(randomGenerator, 255u));
+				}
+
+				if (RandomI::boolean(randomGenerator))
+				{
+					OCEAN_EXPECT_TRUE(validation, queue.push(sourceBuffer.data(), sourceBuffer.size()));
+				}
+				else
+				{
+					Network::LockFreeBufferQueue::Buffer copyBuffer(sourceBuffer);
+					OCEAN_EXPECT_TRUE(validation, queue.push(std::move(copyBuffer)));
+				}
+
+				sourceBuffers.emplace_back(std::move(sourceBuffer));
+			}
+
+			OCEAN_EXPECT_EQUAL(validation, queue.size(), queue.capacity());
+
+			const uint8_t value = 0u;
+			OCEAN_EXPECT_FALSE(validation, queue.push(&value, 1));
+
+			for (const Network::LockFreeBufferQueue::Buffer& sourceBuffer : sourceBuffers)
+			{
+				if (queue.pop(buffer, 0.0))
+				{
+					OCEAN_EXPECT_TRUE(validation, buffer == sourceBuffer);
+				}
+				else
+				{
+					OCEAN_SET_FAILED(validation);
+				}
+			}
+
+			OCEAN_EXPECT_TRUE(validation, queue.isEmpty());
+			OCEAN_EXPECT_FALSE(validation, queue.pop(buffer));
+		}
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
+bool TestLockFreeBufferQueue::testMultipleProducers(const double testDuration)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Multiple producers test:";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		const unsigned int numberProducers = RandomI::random(randomGenerator, 1u, 8u);
+		const unsigned int buffersPerProducer = RandomI::random(randomGenerator, 1u, 2000u);
+
+		Network::LockFreeBufferQueue queue(size_t(RandomI::random(randomGenerator, 2u, 256u)));
+
+		std::vector<std::thread> producers;
+
+		// in case the consumer fails, the producers must not wait for free slots forever
+		std::atomic<bool> abortProducers(false);
+
+		for (unsigned int nProducer = 0u; nProducer < numberProducers; ++nProducer)
+		{
+			producers.emplace_back([&queue, &abortProducers, nProducer, buffersPerProducer]()
+			{
+				for (unsigned int n = 0u; n < buffersPerProducer; ++n)
+				{
+					// each buffer holds the producer's index and the buffer's index, followed by some payload
+
+					std::vector<uint32_t> values(2u + n % 16u, n);
+					values[0] = nProducer;
+					values[1] = n;
+
+					while (!queue.push(values.data(), values.size() * sizeof(uint32_t)))
+					{
+						if (abortProducers)
+						{
+							return;
+						}
+
+						std::this_thread::yield();
+					}
+				}
+			});
+		}
+
+		// the consumer checks that the buffers of each producer arrive in order
+
+		std::vector<unsigned int> nextIndices(numberProducers, 0u);
+
+		Network::LockFreeBufferQueue::Buffer buffer;
+
+		for (size_t n = 0; n < size_t(numberProducers) * size_t(buffersPerProducer); ++n)
+		{
+			if (!queue.pop(buffer, 5.0))
+			{
+				OCEAN_SET_FAILED(validation);
+
+				abortProducers = true;
+				break;
+			}
+
+			if (buffer.size() < sizeof(uint32_t) * 2 || buffer.size() % sizeof(uint32_t) != 0)
+			{
+				OCEAN_SET_FAILED(validation);
+				continue;
+			}
+
+			uint32_t header[2];
+			memcpy(header, buffer.data(), sizeof(header));
+
+			if (header[0] >= numberProducers)
+			{
+				OCEAN_SET_FAILED(validation);
+				continue;
+			}
+
+			OCEAN_EXPECT_EQUAL(validation, header[1], nextIndices[header[0]]);
+			OCEAN_EXPECT_EQUAL(validation, buffer.size(), (2 + header[1] % 16u) * sizeof(uint32_t));
+
+			nextIndices[header[0]] = header[1] + 1u;
+		}
+
+		for (std::thread& producer : producers)
+		{
+			producer.join();
+		}
+
+		OCEAN_EXPECT_TRUE(validation, queue.isEmpty());
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
+}
+
+}
+
+}
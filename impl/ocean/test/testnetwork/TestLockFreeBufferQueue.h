@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#ifndef META_OCEAN_TEST_TESTNETWORK_TEST_LOCK_FREE_BUFFER_QUEUE_H
+#define META_OCEAN_TEST_TESTNETWORK_TEST_LOCK_FREE_BUFFER_QUEUE_H
+
+#include "ocean/test/testnetwork/TestNetwork.h"
+
+#include "ocean/test/TestSelector.h"
+
+namespace Ocean
+{
+
+namespace Test
+{
+
+namespace TestNetwork
+{
+
+/**
+ * This class implements test for LockFreeBufferQueue.
+ * @ingroup testnetwork
+ */
+class OCEAN_TEST_NETWORK_EXPORT TestLockFreeBufferQueue
+{
+	public:
+
+		/**
+		 * Tests all LockFreeBufferQueue functions.
+		 * @param testDuration The number of seconds for each test, with range (0, infinity)
+		 * @param selector The selector defining which tests to run
+		 * @return True, if succeeded
+		 */
+		static bool test(const double testDuration, const TestSelector& selector);
+
+		/**
+		 * Tests pushing and popping buffers within one thread, including a full queue.
+		 * @param testDuration The number of seconds for each test, with range (0, infinity)
+		 * @return True, if succeeded
+		 */
+		static bool testSingleThread(const double testDuration);
+
+		/**
+		 * Tests several producer threads and one consumer thread waiting for the buffers.
+		 * @param testDuration The number of seconds for each test, with range (0, infinity)
+		 * @return True, if succeeded
+		 */
+		static bool testMultipleProducers(const double testDuration);
+};
+
+}
+
+}
+
+}
+
+#endif // META_OCEAN_TEST_TESTNETWORK_TEST_LOCK_FREE_BUFFER_QUEUE_H
@@ -7,8 +7,13 @@
 
 #include "ocean/test/testnetwork/TestNetwork.h"
 #include "ocean/test/testnetwork/TestData.h"
+#include "ocean/test/testnetwork/TestFrameCodec.h"
+#include "ocean/test/testnetwork/TestHTTPClient.h"
+#include "ocean/test/testnetwork/TestLockFreeBufferQueue.h"
 #include "ocean/test/testnetwork/TestPackagedTCPClient.h"
+#include "ocean/test/testnetwork/TestPackagedUDPClient.h"
 #include "ocean/test/testnetwork/TestResolver.h"
+#include "ocean/test/testnetwork/TestResourceCache.h"
 #include "ocean/test/testnetwork/TestTCPClient.h"
 
 #include "ocean/test/TestResult.h"
@@ -78,6 +83,33 @@ bool testNetwork(const double testDuration, Worker& /*worker*/, const std::strin
 		testResult = TestData::test(testDuration, subSelector);
 	}
 
+	if (TestSelector subSelector = selector.shouldRun("framecodec"))
+	{
+		Log::info() << " ";
+		Log::info() << " ";
+		Log::info() << " ";
+		Log::info() << " ";
+		testResult = TestFrameCodec::test(testDuration, subSelector);
+	}
+
+	if (TestSelector subSelector = selector.shouldRun("httpclient"))
+	{
+		Log::info() << " ";
+		Log::info() << " ";
+		Log::info() << " ";
+		Log::info() << " ";
+		testResult = TestHTTPClient::test(testDuration, subSelector);
+	}
+
+	if (TestSelector subSelector = selector.shouldRun("lockfreebufferqueue"))
+	{
+		Log::info() << " ";
+		Log::info() << " ";
+		Log::info() << " ";
+		Log::info() << " ";
+		testResult = TestLockFreeBufferQueue::test(testDuration, subSelector);
+	}
+
 	if (TestSelector subSelector = selector.shouldRun("tcpclient"))
 	{
 		Log::info() << " ";
@@ -96,6 +128,15 @@ bool testNetwork(const double testDuration, Worker& /*worker*/, const std::strin
 		testResult = TestPackagedTCPClient::test(testDuration, subSelector);
 	}
 
+	if (TestSelector subSelector = selector.shouldRun("packagedudpclient"))
+	{
+		Log::info() << " ";
+		Log::info() << " ";
+		Log::info() << " ";
+		Log::info() << " ";
+		testResult = TestPackagedUDPClient::test(testDuration, subSelector);
+	}
+
 	if (TestSelector subSelector = selector.shouldRun("resolver"))
 	{
 		Log::info() << " ";
@@ -105,6 +146,15 @@ bool testNetwork(const double testDuration, Worker& /*worker*/, const std::strin
 		testResult = TestResolver::test(testDuration, subSelector);
 	}
 
+	if (TestSelector subSelector = selector.shouldRun("resourcecache"))
+	{
+		Log::info() << " ";
+		Log::info() << " ";
+		Log::info() << " ";
+		Log::info() << " ";
+		testResult = TestResourceCache::test(testDuration, subSelector);
+	}
+
 	Log::info() << " ";
 	Log::info() << " ";
 	Log::info() << " ";
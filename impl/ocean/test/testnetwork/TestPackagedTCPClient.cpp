@@ -56,6 +56,49 @@ void TestPackagedTCPClient::ServerReceiver::onReceive(const Network::PackagedTCP
 	buffers_.emplace_back(std::move(buffer));
 }
 
+void TestPackagedTCPClient::ChunkReceiver::onClientChunk(const void* data, const size_t size, const size_t messageOffset, const size_t messageSize)
+{
+	addChunk(data, size, messageOffset, messageSize);
+}
+
+void TestPackagedTCPClient::ChunkReceiver::onServerChunk(const Network::PackagedTCPServer::ConnectionId /*connectionId*/, const void* data, const size_t size, const size_t messageOffset, const size_t messageSize)
+{
+	addChunk(data, size, messageOffset, messageSize);
+}
+
+size_t TestPackagedTCPClient::ChunkReceiver::numberMessages() const
+{
+	const ScopedLock scopedLock(lock_);
+
+	return buffers_.size();
+}
+
+void TestPackagedTCPClient::ChunkReceiver::addChunk(const void* data, const size_t size, const size_t messageOffset, const size_t messageSize)
+{
+	const ScopedLock scopedLock(lock_);
+
+	// all chunks but the last chunk of a message have the maximal size
+
+	if (data == nullptr || size == 0 || size > maximalChunkSize_ || messageOffset != currentBuffer_.size() || messageOffset + size > messageSize)
+	{
+		chunksValid_ = false;
+		return;
+	}
+
+	if (size != maximalChunkSize_ && messageOffset + size != messageSize)
+	{
+		chunksValid_ = false;
+	}
+
+	currentBuffer_.insert(currentBuffer_.end(), (const uint8_t*)(data), (const uint8_t*)(data) + size);
+
+	if (currentBuffer_.size() == messageSize)
+	{
+		buffers_.emplace_back(std::move(currentBuffer_));
+		currentBuffer_.clear();
+	}
+}
+
 bool TestPackagedTCPClient::test(const double testDuration, const TestSelector& selector)
 {
 	ocean_assert(testDuration > 0.0);
@@ -72,6 +115,15 @@ bool TestPackagedTCPClient::test(const double testDuration, const TestSelector&
 		Log::info() << " ";
 	}
 
+	if (selector.shouldRun("chunkedreceive"))
+	{
+		testResult = testChunkedReceive(testDuration);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
 	Log::info() << testResult;
 
 	return testResult.succeeded();
@@ -84,6 +136,11 @@ TEST(TestPackagedTCPClient, SendReceive)
 	EXPECT_TRUE(TestPackagedTCPClient::testSendReceive(GTEST_TEST_DURATION));
 }
 
+TEST(TestPackagedTCPClient, ChunkedReceive)
+{
+	EXPECT_TRUE(TestPackagedTCPClient::testChunkedReceive(GTEST_TEST_DURATION));
+}
+
 #endif // OCEAN_USE_GTEST
 
 bool TestPackagedTCPClient::testSendReceive(const double testDuration)
@@ -243,6 +300,125 @@ bool TestPackagedTCPClient::testSendReceive(const double testDuration)
 	return validation.succeeded();
 }
 
+bool TestPackagedTCPClient::testChunkedReceive(const double testDuration)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "PackagedTCPClient & PackagedTCPServer chunked receive test:";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		ServerReceiver serverReceiver;
+
+		ChunkReceiver serverChunkReceiver;
+		serverChunkReceiver.maximalChunkSize_ = size_t(RandomI::random(randomGenerator, 1u, 100000u));
+
+		Network::PackagedTCPServer tcpServer;
+		tcpServer.setConnectionRequestCallback(Network::TCPServer::ConnectionRequestCallback::create(serverReceiver, &ServerReceiver::onConnectionRequest));
+		tcpServer.setChunkReceiveCallback(Network::PackagedTCPServer::ChunkReceiveCallback::create(serverChunkReceiver, &ChunkReceiver::onServerChunk), serverChunkReceiver.maximalChunkSize_);
+
+		if (!tcpServer.start())
+		{
+			OCEAN_SET_FAILED(validation);
+		}
+
+		ChunkReceiver clientChunkReceiver;
+		clientChunkReceiver.maximalChunkSize_ = size_t(RandomI::random(randomGenerator, 1u, 100000u));
+
+		Network::PackagedTCPClient tcpClient;
+		tcpClient.setChunkReceiveCallback(Network::PackagedTCPClient::ChunkReceiveCallback::create(clientChunkReceiver, &ChunkReceiver::onClientChunk), clientChunkReceiver.maximalChunkSize_);
+
+		if (!tcpClient.connect(Network::Address4::localHost(), tcpServer.port()))
+		{
+			OCEAN_SET_FAILED(validation);
+		}
+
+		// the messages are sent back to back so that headers and chunks are split arbitrarily across the received data,
+		// the messages fit into the socket buffers of the loopback connection as the sender blocks the socket scheduler shared with the receiver
+
+		const unsigned int numberMessages = RandomI::random(randomGenerator, 1u, 5u);
+
+		std::vector<Buffer> messages;
+
+		for (unsigned int n = 0u; n < numberMessages; ++n)
+		{
+			const unsigned int bytes = RandomI::boolean(randomGenerator) ? RandomI::random(randomGenerator, 1u, 1000u) : RandomI::random(randomGenerator, 1u, 500000u);
+
+			Buffer buffer(bytes);
+			for (uint8_t& element : buffer)
+			{
+				element = uint8_t(RandomI::random(randomGenerator, 255u));
+			}
+
+			OCEAN_EXPECT_EQUAL(validation, tcpClient.send(buffer.data(), buffer.size()), Network::PackagedTCPClient::SR_SUCCEEDED);
+
+			messages.emplace_back(std::move(buffer));
+		}
+
+		const Timestamp waitTimestamp(true);
+
+		while (serverChunkReceiver.numberMessages() < messages.size() && !waitTimestamp.hasTimePassed(10.0))
+		{
+			Thread::sleep(1u);
+		}
+
+		if (serverReceiver.connectionId_ != Network::PackagedTCPServer::invalidConnectionId())
+		{
+			for (const Buffer& message : messages)
+			{
+				OCEAN_EXPECT_EQUAL(validation, tcpServer.send(serverReceiver.connectionId_, message.data(), message.size()), Network::PackagedTCPServer::SR_SUCCEEDED);
+			}
+		}
+		else
+		{
+			OCEAN_SET_FAILED(validation);
+		}
+
+		while (clientChunkReceiver.numberMessages() < messages.size() && !waitTimestamp.hasTimePassed(20.0))
+		{
+			Thread::sleep(1u);
+		}
+
+		OCEAN_EXPECT_TRUE(validation, tcpClient.disconnect());
+		OCEAN_EXPECT_TRUE(validation, tcpServer.stop());
+
+		for (const ChunkReceiver* chunkReceiver : {&serverChunkReceiver, &clientChunkReceiver})
+		{
+			const ScopedLock scopedLock(chunkReceiver->lock_);
+
+			OCEAN_EXPECT_TRUE(validation, chunkReceiver->chunksValid_);
+			OCEAN_EXPECT_TRUE(validation, chunkReceiver->currentBuffer_.empty());
+
+			if (chunkReceiver->buffers_.size() == messages.size())
+			{
+				for (size_t n = 0; n < messages.size(); ++n)
+				{
+					OCEAN_EXPECT_TRUE(validation, chunkReceiver->buffers_[n] == messages[n]);
+				}
+			}
+			else
+			{
+				OCEAN_SET_FAILED(validation);
+			}
+		}
+
+#ifdef OCEAN_USE_GTEST
+		// one execution is enough for GTest
+		break;
+#endif
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
 }
 
 }
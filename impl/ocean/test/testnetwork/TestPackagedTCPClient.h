@@ -100,6 +100,67 @@ class OCEAN_TEST_NETWORK_EXPORT TestPackagedTCPClient
 				std::vector<Buffer> buffers_;
 		};
 
+		/**
+		 * This class implements a receiver for the chunks of streamed messages.
+		 */
+		class OCEAN_TEST_NETWORK_EXPORT ChunkReceiver
+		{
+			public:
+
+				/**
+				 * Event function for receiving a chunk on the client side.
+				 * @param data The data of the chunk
+				 * @param size The size of the chunk in bytes
+				 * @param messageOffset The offset of the chunk within the message, in bytes
+				 * @param messageSize The size of the entire message, in bytes
+				 */
+				void onClientChunk(const void* data, const size_t size, const size_t messageOffset, const size_t messageSize);
+
+				/**
+				 * Event function for receiving a chunk on the server side.
+				 * @param connectionId The id of the connection from which the chunk has been received
+				 * @param data The data of the chunk
+				 * @param size The size of the chunk in bytes
+				 * @param messageOffset The offset of the chunk within the message, in bytes
+				 * @param messageSize The size of the entire message, in bytes
+				 */
+				void onServerChunk(const Network::PackagedTCPServer::ConnectionId connectionId, const void* data, const size_t size, const size_t messageOffset, const size_t messageSize);
+
+				/**
+				 * Returns the number of messages which have been received entirely.
+				 * @return The number of messages
+				 */
+				size_t numberMessages() const;
+
+			protected:
+
+				/**
+				 * Adds a chunk.
+				 * @param data The data of the chunk
+				 * @param size The size of the chunk in bytes
+				 * @param messageOffset The offset of the chunk within the message, in bytes
+				 * @param messageSize The size of the entire message, in bytes
+				 */
+				void addChunk(const void* data, const size_t size, const size_t messageOffset, const size_t messageSize);
+
+			public:
+
+				/// The maximal chunk size which is expected.
+				size_t maximalChunkSize_ = 0;
+
+				/// The messages which have been assembled from the chunks.
+				std::vector<Buffer> buffers_;
+
+				/// The message which is currently received.
+				Buffer currentBuffer_;
+
+				/// True, if all chunks have been delivered in order and with valid sizes.
+				bool chunksValid_ = true;
+
+				/// The lock of the receiver.
+				mutable Lock lock_;
+		};
+
 	public:
 
 		/**
@@ -116,6 +177,13 @@ class OCEAN_TEST_NETWORK_EXPORT TestPackagedTCPClient
 		 * @return True, if succeeded
 		 */
 		static bool testSendReceive(const double testDuration);
+
+		/**
+		 * Tests sending large messages which are received in chunks.
+		 * @param testDuration The number of seconds for each test, with range (0, infinity)
+		 * @return True, if succeeded
+		 */
+		static bool testChunkedReceive(const double testDuration);
 };
 
 }
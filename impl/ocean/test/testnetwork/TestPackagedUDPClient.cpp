@@ -0,0 +1,413 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "ocean/test/testnetwork/TestPackagedUDPClient.h"
+
+#include "ocean/test/TestResult.h"
+
+#include "ocean/base/RandomGenerator.h"
+#include "ocean/base/RandomI.h"
+#include "ocean/base/Thread.h"
+#include "ocean/base/Timestamp.h"
+
+#include "ocean/network/PackagedUDPClient.h"
+
+#include "ocean/test/Validation.h"
+
+namespace Ocean
+{
+
+namespace Test
+{
+
+namespace TestNetwork
+{
+
+void TestPackagedUDPClient::ServerReceiver::onReceive(const Network::Address4& /*senderAddress*/, const Network::Port& /*senderPort*/, const void* data, const size_t size, const Network::PackagedUDPServer::MessageId /*messageId*/)
+{
+	const ScopedLock scopedLock(lock_);
+
+	if (data == nullptr)
+	{
+		// the message could not be received, we store an empty buffer
+		buffers_.emplace_back();
+		return;
+	}
+
+	std::vector<uint8_t> buffer(size);
+	memcpy(buffer.data(), data, size);
+
+	buffers_.emplace_back(std::move(buffer));
+}
+
+size_t TestPackagedUDPClient::ServerReceiver::numberMessages() const
+{
+	const ScopedLock scopedLock(lock_);
+
+	return buffers_.size();
+}
+
+bool TestPackagedUDPClient::test(const double testDuration, const TestSelector& selector)
+{
+	ocean_assert(testDuration > 0.0);
+
+	TestResult testResult("PackagedUDPClient test");
+	Log::info() << " ";
+
+	if (selector.shouldRun("sendreceive"))
+	{
+		testResult = testSendReceive(testDuration);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
+	if (selector.shouldRun("sendmultiplerecipients"))
+	{
+		testResult = testSendMultipleRecipients(testDuration);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
+	if (selector.shouldRun("statistics"))
+	{
+		testResult = testStatistics(testDuration);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
+	Log::info() << testResult;
+
+	return testResult.succeeded();
+}
+
+#ifdef OCEAN_USE_GTEST
+
+TEST(TestPackagedUDPClient, SendReceive)
+{
+	EXPECT_TRUE(TestPackagedUDPClient::testSendReceive(GTEST_TEST_DURATION));
+}
+
+TEST(TestPackagedUDPClient, SendMultipleRecipients)
+{
+	EXPECT_TRUE(TestPackagedUDPClient::testSendMultipleRecipients(GTEST_TEST_DURATION));
+}
+
+TEST(TestPackagedUDPClient, Statistics)
+{
+	EXPECT_TRUE(TestPackagedUDPClient::testStatistics(GTEST_TEST_DURATION));
+}
+
+#endif // OCEAN_USE_GTEST
+
+bool TestPackagedUDPClient::testSendReceive(const double testDuration)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "PackagedUDPClient & PackagedUDPServer test:";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		Network::PackagedUDPServer udpServer;
+
+		ServerReceiver serverReceiver;
+		udpServer.setReceiveCallback(Network::PackagedUDPServer::ReceiveCallback::create(serverReceiver, &ServerReceiver::onReceive));
+
+		if (!udpServer.start())
+		{
+			OCEAN_SET_FAILED(validation);
+		}
+
+		const Network::Port serverPort = udpServer.port();
+
+		Network::PackagedUDPClient udpClient;
+
+		const unsigned int numberMessages = RandomI::random(randomGenerator, 1u, 10u);
+
+		std::vector<Buffer> messages;
+
+		for (unsigned int n = 0u; n < numberMessages; ++n)
+		{
+			messages.emplace_back(randomMessage(randomGenerator));
+
+			OCEAN_EXPECT_EQUAL(validation, udpClient.send(Network::Address4::localHost(), serverPort, messages.back().data(), messages.back().size()), Network::PackagedUDPClient::SR_SUCCEEDED);
+
+			// we give the server the chance to handle the datagrams so that the socket's receive buffer does not overflow
+			Thread::sleep(5u);
+		}
+
+		OCEAN_EXPECT_TRUE(validation, waitForMessages(serverReceiver, messages.size()));
+
+		OCEAN_EXPECT_TRUE(validation, udpServer.stop());
+
+		const ScopedLock scopedLock(serverReceiver.lock_);
+
+		// all messages are sent from the same client to the same server via loopback, so that the order is preserved
+
+		if (serverReceiver.buffers_.size() == messages.size())
+		{
+			for (size_t n = 0; n < messages.size(); ++n)
+			{
+				OCEAN_EXPECT_TRUE(validation, messages[n] == serverReceiver.buffers_[n]);
+			}
+		}
+		else
+		{
+			OCEAN_SET_FAILED(validation);
+		}
+
+#ifdef OCEAN_USE_GTEST
+		// one execution is enough for GTest
+		break;
+#endif
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
+bool TestPackagedUDPClient::testSendMultipleRecipients(const double testDuration)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "PackagedUDPClient with multiple recipients test:";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		const unsigned int numberServers = RandomI::random(randomGenerator, 1u, 8u);
+
+		std::vector<std::unique_ptr<Network::PackagedUDPServer>> udpServers;
+		std::vector<std::unique_ptr<ServerReceiver>> serverReceivers;
+
+		Network::PackagedUDPClient::Recipients recipients;
+
+		for (unsigned int nServer = 0u; nServer < numberServers; ++nServer)
+		{
+			udpServers.emplace_back(std::make_unique<Network::PackagedUDPServer>());
+			serverReceivers.emplace_back(std::make_unique<ServerReceiver>());
+
+			udpServers.back()->setReceiveCallback(Network::PackagedUDPServer::ReceiveCallback::create(*serverReceivers.back(), &ServerReceiver::onReceive));
+
+			if (!udpServers.back()->start())
+			{
+				OCEAN_SET_FAILED(validation);
+			}
+
+			recipients.emplace_back(Network::Address4::localHost(), udpServers.back()->port());
+		}
+
+		Network::PackagedUDPClient udpClient;
+
+		const unsigned int numberMessages = RandomI::random(randomGenerator, 1u, 5u);
+
+		std::vector<Buffer> messages;
+
+		for (unsigned int n = 0u; n < numberMessages; ++n)
+		{
+			messages.emplace_back(randomMessage(randomGenerator));
+
+			OCEAN_EXPECT_EQUAL(validation, udpClient.send(recipients, messages.back().data(), messages.back().size()), Network::PackagedUDPClient::SR_SUCCEEDED);
+
+			Thread::sleep(5u);
+		}
+
+		for (size_t nServer = 0; nServer < udpServers.size(); ++nServer)
+		{
+			OCEAN_EXPECT_TRUE(validation, waitForMessages(*serverReceivers[nServer], messages.size()));
+
+			OCEAN_EXPECT_TRUE(validation, udpServers[nServer]->stop());
+
+			const ScopedLock scopedLock(serverReceivers[nServer]->lock_);
+
+			if (serverReceivers[nServer]->buffers_.size() == messages.size())
+			{
+				for (size_t n = 0; n < messages.size(); ++n)
+				{
+					OCEAN_EXPECT_TRUE(validation, messages[n] == serverReceivers[nServer]->buffers_[n]);
+				}
+			}
+			else
+			{
+				OCEAN_SET_FAILED(validation);
+			}
+		}
+
+#ifdef OCEAN_USE_GTEST
+		// one execution is enough for GTest
+		break;
+#endif
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
+bool TestPackagedUDPClient::testStatistics(const double testDuration)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "PackagedUDPClient & PackagedUDPServer statistics test:";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	using SocketStatistics = Network::SocketStatistics;
+
+	OCEAN_EXPECT_EQUAL(validation, SocketStatistics::latencyBin(0.0), 0u);
+	OCEAN_EXPECT_EQUAL(validation, SocketStatistics::latencyBin(0.0000015), 1u);
+	OCEAN_EXPECT_EQUAL(validation, SocketStatistics::latencyBin(0.001), 10u);
+	OCEAN_EXPECT_EQUAL(validation, SocketStatistics::latencyBin(100.0), (unsigned int)(SocketStatistics::numberLatencyBins_ - 1));
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		Network::PackagedUDPServer udpServer;
+
+		ServerReceiver serverReceiver;
+		udpServer.setReceiveCallback(Network::PackagedUDPServer::ReceiveCallback::create(serverReceiver, &ServerReceiver::onReceive));
+
+		if (!udpServer.start())
+		{
+			OCEAN_SET_FAILED(validation);
+		}
+
+		Network::PackagedUDPClient udpClient;
+
+		const SocketStatistics::Snapshot initialSnapshot = udpClient.statistics();
+
+		OCEAN_EXPECT_EQUAL(validation, initialSnapshot.sentBytes_, uint64_t(0));
+		OCEAN_EXPECT_EQUAL(validation, initialSnapshot.sentMessages_, uint64_t(0));
+
+		const unsigned int numberMessages = RandomI::random(randomGenerator, 1u, 10u);
+
+		uint64_t payloadBytes = 0ull;
+
+		for (unsigned int n = 0u; n < numberMessages; ++n)
+		{
+			const Buffer message = randomMessage(randomGenerator);
+			payloadBytes += uint64_t(message.size());
+
+			OCEAN_EXPECT_EQUAL(validation, udpClient.send(Network::Address4::localHost(), udpServer.port(), message.data(), message.size()), Network::PackagedUDPClient::SR_SUCCEEDED);
+
+			Thread::sleep(5u);
+		}
+
+		OCEAN_EXPECT_TRUE(validation, waitForMessages(serverReceiver, numberMessages));
+
+		// the callback durations are measured once the callbacks have returned
+
+		SocketStatistics::Snapshot serverSnapshot = udpServer.statistics();
+
+		const Timestamp waitTimestamp(true);
+
+		while (SocketStatistics::Snapshot::latencyMeasurements(serverSnapshot.callbackDurationBins_) < uint64_t(numberMessages) && !waitTimestamp.hasTimePassed(5.0))
+		{
+			Thread::sleep(1u);
+			serverSnapshot = udpServer.statistics();
+		}
+
+		OCEAN_EXPECT_TRUE(validation, udpServer.stop());
+
+		const SocketStatistics::Snapshot clientSnapshot = udpClient.statistics();
+
+		OCEAN_EXPECT_EQUAL(validation, clientSnapshot.sentMessages_, uint64_t(numberMessages));
+		OCEAN_EXPECT_GREATER(validation, clientSnapshot.sentBytes_, payloadBytes);
+		OCEAN_EXPECT_GREATER_EQUAL(validation, clientSnapshot.sentBytesPerSecond(initialSnapshot), 0.0);
+
+		// all datagrams are sent via loopback, nothing is lost
+
+		OCEAN_EXPECT_EQUAL(validation, serverSnapshot.receivedMessages_, uint64_t(numberMessages));
+		OCEAN_EXPECT_EQUAL(validation, serverSnapshot.receivedBytes_, clientSnapshot.sentBytes_);
+		OCEAN_EXPECT_EQUAL(validation, serverSnapshot.droppedMessages_, uint64_t(0));
+
+		OCEAN_EXPECT_EQUAL(validation, SocketStatistics::Snapshot::latencyMeasurements(serverSnapshot.deliveryLatencyBins_), uint64_t(numberMessages));
+		OCEAN_EXPECT_EQUAL(validation, SocketStatistics::Snapshot::latencyMeasurements(serverSnapshot.callbackDurationBins_), uint64_t(numberMessages));
+		OCEAN_EXPECT_GREATER_EQUAL(validation, SocketStatistics::Snapshot::latencyMeasurements(serverSnapshot.schedulerDelayBins_), uint64_t(1));
+
+		const double medianLatency = SocketStatistics::Snapshot::latencyPercentile(serverSnapshot.deliveryLatencyBins_, 0.5);
+		const double maximalLatency = SocketStatistics::Snapshot::latencyPercentile(serverSnapshot.deliveryLatencyBins_, 1.0);
+
+		OCEAN_EXPECT_GREATER(validation, medianLatency, 0.0);
+		OCEAN_EXPECT_LESS_EQUAL(validation, medianLatency, maximalLatency);
+
+		udpClient.resetStatistics();
+
+		const SocketStatistics::Snapshot resetSnapshot = udpClient.statistics();
+
+		OCEAN_EXPECT_EQUAL(validation, resetSnapshot.sentBytes_, uint64_t(0));
+		OCEAN_EXPECT_EQUAL(validation, resetSnapshot.sentMessages_, uint64_t(0));
+
+#ifdef OCEAN_USE_GTEST
+		// one execution is enough for GTest
+		break;
+#endif
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
+TestPackagedUDPClient::Buffer TestPackagedUDPClient::randomMessage(RandomGenerator& randomGenerator)
+{
+	// the message sizes cover single packages and messages with more packages than one batch
+
+	const unsigned int bytes = RandomI::boolean(randomGenerator) ? RandomI::random(randomGenerator, 1u, 1000u) : RandomI::random(randomGenerator, 1u, 60000u);
+
+	Buffer buffer(bytes);
+
+	for (uint8_t& element : buffer)
+	{
+		element = uint8_t(RandomI::random(randomGenerator, 255u));
+	}
+
+	return buffer;
+}
+
+bool TestPackagedUDPClient::waitForMessages(const ServerReceiver& receiver, const size_t numberMessages)
+{
+	const Timestamp startTimestamp(true);
+
+	while (receiver.numberMessages() < numberMessages)
+	{
+		if (startTimestamp.hasTimePassed(5.0))
+		{
+			return false;
+		}
+
+		Thread::sleep(1u);
+	}
+
+	return true;
+}
+
+}
+
+}
+
+}
@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#ifndef META_OCEAN_TEST_TESTNETWORK_TEST_PACKAGED_UDP_CLIENT_H
+#define META_OCEAN_TEST_TESTNETWORK_TEST_PACKAGED_UDP_CLIENT_H
+
+#include "ocean/test/testnetwork/TestNetwork.h"
+
+#include "ocean/network/PackagedUDPServer.h"
+
+#include "ocean/base/Lock.h"
+#include "ocean/base/RandomGenerator.h"
+
+#include "ocean/test/TestSelector.h"
+
+namespace Ocean
+{
+
+namespace Test
+{
+
+namespace TestNetwork
+{
+
+/**
+ * This class implements test for PackagedUDPClient.
+ * @ingroup testnetwork
+ */
+class OCEAN_TEST_NETWORK_EXPORT TestPackagedUDPClient
+{
+	protected:
+
+		/**
+		 * Definition of a vector holding bytes.
+		 */
+		using Buffer = std::vector<uint8_t>;
+
+		/**
+		 * This class implements a receiver for servers.
+		 */
+		class OCEAN_TEST_NETWORK_EXPORT ServerReceiver
+		{
+			public:
+
+				/**
+				 * Event function for receiving data.
+				 * @param senderAddress The address of the sender
+				 * @param senderPort The port of the sender
+				 * @param data The data that has been received, nullptr if the message could not be received
+				 * @param size The number of bytes
+				 * @param messageId The id of the message
+				 */
+				void onReceive(const Network::Address4& senderAddress, const Network::Port& senderPort, const void* data, const size_t size, const Network::PackagedUDPServer::MessageId messageId);
+
+				/**
+				 * Returns the number of received messages.
+				 * @return The number of messages
+				 */
+				size_t numberMessages() const;
+
+			public:
+
+				/// The memory buffers of all received messages.
+				std::vector<Buffer> buffers_;
+
+				/// The lock of the receiver.
+				mutable Lock lock_;
+		};
+
+	public:
+
+		/**
+		 * Tests all PackagedUDPClient functions.
+		 * @param testDuration The number of seconds for each test, with range (0, infinity)
+		 * @param selector The selector defining which tests to run
+		 * @return True, if succeeded
+		 */
+		static bool test(const double testDuration, const TestSelector& selector);
+
+		/**
+		 * Tests sending and receiving messages with one recipient.
+		 * @param testDuration The number of seconds for each test, with range (0, infinity)
+		 * @return True, if succeeded
+		 */
+		static bool testSendReceive(const double testDuration);
+
+		/**
+		 * Tests sending messages to several recipients with one call.
+		 * @param testDuration The number of seconds for each test, with range (0, infinity)
+		 * @return True, if succeeded
+		 */
+		static bool testSendMultipleRecipients(const double testDuration);
+
+		/**
+		 * Tests the statistics of the client and the server.
+		 * @param testDuration The number of seconds for each test, with range (0, infinity)
+		 * @return True, if succeeded
+		 */
+		static bool testStatistics(const double testDuration);
+
+	protected:
+
+		/**
+		 * Creates a message with random content.
+		 * @param randomGenerator The random generator to be used
+		 * @return The random message
+		 */
+		static Buffer randomMessage(RandomGenerator& randomGenerator);
+
+		/**
+		 * Waits until a receiver has received a specific number of messages.
+		 * @param receiver The receiver to wait for
+		 * @param numberMessages The number of expected messages
+		 * @return True, if the receiver received the messages before the timeout
+		 */
+		static bool waitForMessages(const ServerReceiver& receiver, const size_t numberMessages);
+};
+
+}
+
+}
+
+}
+
+#endif // META_OCEAN_TEST_TESTNETWORK_TEST_PACKAGED_UDP_CLIENT_H
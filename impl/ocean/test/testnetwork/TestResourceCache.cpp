@@ -0,0 +1,339 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "ocean/test/testnetwork/TestResourceCache.h"
+
+#include "ocean/test/TestResult.h"
+#include "ocean/test/Validation.h"
+
+#include "ocean/base/RandomGenerator.h"
+#include "ocean/base/RandomI.h"
+#include "ocean/base/String.h"
+#include "ocean/base/Thread.h"
+#include "ocean/base/Timestamp.h"
+
+#include "ocean/io/Directory.h"
+
+#include "ocean/network/ResourceCache.h"
+
+namespace Ocean
+{
+
+namespace Test
+{
+
+namespace TestNetwork
+{
+
+bool TestResourceCache::test(const double testDuration, const TestSelector& selector)
+{
+	ocean_assert(testDuration > 0.0);
+
+	TestResult testResult("ResourceCache test");
+	Log::info() << " ";
+
+	if (selector.shouldRun("storelookup"))
+	{
+		testResult = testStoreLookup(testDuration);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
+	if (selector.shouldRun("eviction"))
+	{
+		testResult = testEviction(testDuration);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
+	Log::info() << testResult;
+
+	return testResult.succeeded();
+}
+
+#ifdef OCEAN_USE_GTEST
+
+TEST(TestResourceCache, StoreLookup)
+{
+	EXPECT_TRUE(TestResourceCache::testStoreLookup(GTEST_TEST_DURATION));
+}
+
+TEST(TestResourceCache, Eviction)
+{
+	EXPECT_TRUE(TestResourceCache::testEviction(GTEST_TEST_DURATION));
+}
+
+#endif // OCEAN_USE_GTEST
+
+bool TestResourceCache::testStoreLookup(const double testDuration)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Store and lookup test:";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		const IO::ScopedDirectory scopedDirectory(IO::Directory::createTemporaryDirectory());
+
+		if (!scopedDirectory.exists())
+		{
+			OCEAN_SET_FAILED(validation);
+			continue;
+		}
+
+		const unsigned int numberResources = RandomI::random(randomGenerator, 1u, 20u);
+
+		Strings urls;
+		std::vector<std::vector<uint8_t>> payloads;
+		std::vector<Network::CacheValidators> validatorsVector;
+
+		for (unsigned int n = 0u; n < numberResources; ++n)
+		{
+			urls.emplace_back("https://tiles.example.com/" + String::toAString(n) + ".tile");
+
+			if (n != 0u && RandomI::random(randomGenerator, 3u) == 0u)
+			{
+				// identical payloads are stored only once
+				payloads.emplace_back(payloads[RandomI::random(randomGenerator, n - 1u)]);
+			}
+			else
+			{
+				std::vector<uint8_t> payload(RandomI::random(randomGenerator, 1u, 5000u));
+
+				for (uint8_t& value : payload)
+				{
+					value = uint8_t(RandomI::random(randomGenerator, 255u));
+				}
+
+				payloads.emplace_back(std::move(payload));
+			}
+
+			validatorsVector.emplace_back("\"" + String::toAString(RandomI::random32(randomGenerator)) + "\"", RandomI::boolean(randomGenerator) ? std::string("Wed, 21 Oct 2015 07:28:00 GMT") : std::string());
+		}
+
+		uint64_t expectedSize = 0ull;
+
+		{
+			Network::ResourceCache resourceCache(scopedDirectory(), 1024ull * 1024ull, 3600.0);
+			OCEAN_EXPECT_TRUE(validation, resourceCache.isValid());
+
+			Network::ResourceCache::Resource resource;
+			OCEAN_EXPECT_FALSE(validation, resourceCache.lookup(urls.front(), resource));
+			OCEAN_EXPECT_FALSE(validation, resource.isValid());
+
+			for (unsigned int n = 0u; n < numberResources; ++n)
+			{
+				OCEAN_EXPECT_TRUE(validation, resourceCache.store(urls[n], payloads[n].data(), payloads[n].size(), validatorsVector[n]));
+			}
+
+			for (unsigned int n = 0u; n < numberResources; ++n)
+			{
+				bool unique = true;
+
+				for (unsigned int i = 0u; i < n; ++i)
+				{
+					if (payloads[i] == payloads[n])
+					{
+						unique = false;
+						break;
+					}
+				}
+
+				if (unique)
+				{
+					expectedSize += uint64_t(payloads[n].size());
+				}
+			}
+
+			OCEAN_EXPECT_EQUAL(validation, resourceCache.size(), expectedSize);
+
+			for (unsigned int n = 0u; n < numberResources; ++n)
+			{
+				if (resourceCache.lookup(urls[n], resource))
+				{
+					OCEAN_EXPECT_TRUE(validation, resource.isFresh());
+					OCEAN_EXPECT_EQUAL(validation, resource.size(), payloads[n].size());
+					OCEAN_EXPECT_TRUE(validation, resource.size() == payloads[n].size() && memcmp(resource.data(), payloads[n].data(), resource.size()) == 0);
+					OCEAN_EXPECT_EQUAL(validation, resource.validators().entityTag(), validatorsVector[n].entityTag());
+					OCEAN_EXPECT_EQUAL(validation, resource.validators().lastModified(), validatorsVector[n].lastModified());
+				}
+				else
+				{
+					OCEAN_SET_FAILED(validation);
+				}
+			}
+
+			// a resource without maximal age must be revalidated
+
+			OCEAN_EXPECT_TRUE(validation, resourceCache.store(urls.front(), payloads.front().data(), payloads.front().size(), Network::CacheValidators(validatorsVector.front().entityTag(), std::string(), 0.0)));
+
+			if (resourceCache.lookup(urls.front(), resource))
+			{
+				OCEAN_EXPECT_FALSE(validation, resource.isFresh());
+
+				OCEAN_EXPECT_TRUE(validation, resourceCache.refresh(urls.front(), Network::CacheValidators(std::string(), std::string(), 3600.0)));
+
+				OCEAN_EXPECT_TRUE(validation, resourceCache.lookup(urls.front(), resource));
+				OCEAN_EXPECT_TRUE(validation, resource.isFresh());
+				OCEAN_EXPECT_EQUAL(validation, resource.validators().entityTag(), validatorsVector.front().entityTag());
+			}
+			else
+			{
+				OCEAN_SET_FAILED(validation);
+			}
+		}
+
+		{
+			// the cache is opened again
+
+			Network::ResourceCache resourceCache(scopedDirectory(), 1024ull * 1024ull, 3600.0);
+			OCEAN_EXPECT_EQUAL(validation, resourceCache.size(), expectedSize);
+
+			Network::ResourceCache::Resource resource;
+
+			for (unsigned int n = 0u; n < numberResources; ++n)
+			{
+				if (resourceCache.lookup(urls[n], resource))
+				{
+					OCEAN_EXPECT_TRUE(validation, resource.size() == payloads[n].size() && memcmp(resource.data(), payloads[n].data(), resource.size()) == 0);
+					OCEAN_EXPECT_EQUAL(validation, resource.validators().entityTag(), validatorsVector[n].entityTag());
+				}
+				else
+				{
+					OCEAN_SET_FAILED(validation);
+				}
+			}
+
+			const unsigned int removeIndex = RandomI::random(randomGenerator, numberResources - 1u);
+
+			OCEAN_EXPECT_TRUE(validation, resourceCache.remove(urls[removeIndex]));
+			OCEAN_EXPECT_FALSE(validation, resourceCache.remove(urls[removeIndex]));
+			OCEAN_EXPECT_FALSE(validation, resourceCache.lookup(urls[removeIndex], resource));
+
+			resourceCache.clear();
+
+			OCEAN_EXPECT_EQUAL(validation, resourceCache.size(), uint64_t(0));
+
+			for (unsigned int n = 0u; n < numberResources; ++n)
+			{
+				OCEAN_EXPECT_FALSE(validation, resourceCache.lookup(urls[n], resource));
+			}
+		}
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
+bool TestResourceCache::testEviction(const double testDuration)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Eviction test:";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		const IO::ScopedDirectory scopedDirectory(IO::Directory::createTemporaryDirectory());
+
+		if (!scopedDirectory.exists())
+		{
+			OCEAN_SET_FAILED(validation);
+			continue;
+		}
+
+		constexpr size_t payloadSize = 1000;
+		constexpr unsigned int capacity = 10u;
+
+		Network::ResourceCache resourceCache(scopedDirectory(), uint64_t(payloadSize * capacity));
+
+		Strings urls;
+
+		for (unsigned int n = 0u; n <= capacity; ++n)
+		{
+			urls.emplace_back("http://assets.example.com/" + String::toAString(n));
+		}
+
+		std::vector<uint8_t> payload(payloadSize);
+
+		for (unsigned int n = 0u; n < capacity; ++n)
+		{
+			for (uint8_t& value : payload)
+			{
+				value = uint8_t(RandomI::random(randomGenerator, 255u));
+			}
+
+			OCEAN_EXPECT_TRUE(validation, resourceCache.store(urls[n], payload.data(), payload.size(), Network::CacheValidators()));
+
+			// ensuring distinct access timestamps
+			Thread::sleep(1u);
+		}
+
+		OCEAN_EXPECT_EQUAL(validation, resourceCache.size(), uint64_t(payloadSize * capacity));
+
+		// the first resource is used again, so that the second and third resources are the least recently used
+
+		Network::ResourceCache::Resource resource;
+		OCEAN_EXPECT_TRUE(validation, resourceCache.lookup(urls[0], resource));
+
+		Thread::sleep(1u);
+
+		for (uint8_t& value : payload)
+		{
+			value = uint8_t(RandomI::random(randomGenerator, 255u));
+		}
+
+		OCEAN_EXPECT_TRUE(validation, resourceCache.store(urls[capacity], payload.data(), payload.size(), Network::CacheValidators()));
+
+		OCEAN_EXPECT_LESS_EQUAL(validation, resourceCache.size(), resourceCache.maximalSize());
+
+		OCEAN_EXPECT_TRUE(validation, resourceCache.lookup(urls[0], resource));
+		OCEAN_EXPECT_FALSE(validation, resourceCache.lookup(urls[1], resource));
+		OCEAN_EXPECT_FALSE(validation, resourceCache.lookup(urls[2], resource));
+
+		for (unsigned int n = 3u; n <= capacity; ++n)
+		{
+			OCEAN_EXPECT_TRUE(validation, resourceCache.lookup(urls[n], resource));
+		}
+
+		// the most recent resource holds the most recent payload
+
+		OCEAN_EXPECT_EQUAL(validation, resource.size(), payloadSize);
+		OCEAN_EXPECT_TRUE(validation, resource.size() == payloadSize && memcmp(resource.data(), payload.data(), payloadSize) == 0);
+
+		// resources larger than the cache are not stored
+
+		const std::vector<uint8_t> largePayload(payloadSize * capacity + 1, 0u);
+		OCEAN_EXPECT_FALSE(validation, resourceCache.store(urls[0], largePayload.data(), largePayload.size(), Network::CacheValidators()));
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
+}
+
+}
+
+}
@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#ifndef META_OCEAN_TEST_TESTNETWORK_TEST_RESOURCE_CACHE_H
+#define META_OCEAN_TEST_TESTNETWORK_TEST_RESOURCE_CACHE_H
+
+#include "ocean/test/testnetwork/TestNetwork.h"
+
+#include "ocean/test/TestSelector.h"
+
+namespace Ocean
+{
+
+namespace Test
+{
+
+namespace TestNetwork
+{
+
+/**
+ * This class implements test for ResourceCache.
+ * @ingroup testnetwork
+ */
+class OCEAN_TEST_NETWORK_EXPORT TestResourceCache
+{
+	public:
+
+		/**
+		 * Tests all ResourceCache functions.
+		 * @param testDuration The number of seconds for each test, with range (0, infinity)
+		 * @param selector The selector defining which tests to run
+		 * @return True, if succeeded
+		 */
+		static bool test(const double testDuration, const TestSelector& selector);
+
+		/**
+		 * Tests storing and looking up resources, including resources which persist when the cache is opened again.
+		 * @param testDuration The number of seconds for each test, with range (0, infinity)
+		 * @return True, if succeeded
+		 */
+		static bool testStoreLookup(const double testDuration);
+
+		/**
+		 * Tests the eviction of the least recently used resources.
+		 * @param testDuration The number of seconds for each test, with range (0, infinity)
+		 * @return True, if succeeded
+		 */
+		static bool testEviction(const double testDuration);
+};
+
+}
+
+}
+
+}
+
+#endif // META_OCEAN_TEST_TESTNETWORK_TEST_RESOURCE_CACHE_H
@@ -63,6 +63,15 @@ bool TestTCPClient::test(const double testDuration, const TestSelector& selector
 		Log::info() << " ";
 	}
 
+	if (selector.shouldRun("manyconnections"))
+	{
+		testResult = testManyConnections(testDuration);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
 	Log::info() << testResult;
 
 	return testResult.succeeded();
@@ -75,6 +84,11 @@ TEST(TestTCPClient, SendReceive)
 	EXPECT_TRUE(TestTCPClient::testSendReceive(GTEST_TEST_DURATION));
 }
 
+TEST(TestTCPClient, ManyConnections)
+{
+	EXPECT_TRUE(TestTCPClient::testManyConnections(GTEST_TEST_DURATION));
+}
+
 #endif // OCEAN_USE_GTEST
 
 bool TestTCPClient::testSendReceive(const double testDuration)
@@ -207,6 +221,102 @@ bool TestTCPClient::testSendReceive(const double testDuration)
 	return validation.succeeded();
 }
 
+bool TestTCPClient::testManyConnections(const double testDuration)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "TCPServer with many connections test:";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		Network::TCPServer tcpServer;
+
+		Receiver receiver;
+		tcpServer.setConnectionRequestCallback(Network::TCPServer::ConnectionRequestCallback::create(receiver, &Receiver::onConnectionRequest));
+		tcpServer.setDisconnectCallback(Network::TCPServer::DisconnectCallback::create(receiver, &Receiver::onConnectionDisconnected));
+		tcpServer.setReceiveCallback(Network::TCPServer::ReceiveCallback::create(receiver, &Receiver::onReceive));
+
+		if (!tcpServer.start())
+		{
+			OCEAN_SET_FAILED(validation);
+		}
+
+		const Network::Port serverPort = tcpServer.port();
+
+		const unsigned int numberClients = RandomI::random(randomGenerator, 2u, 50u);
+
+		std::vector<std::unique_ptr<Network::TCPClient>> tcpClients;
+		tcpClients.reserve(numberClients);
+
+		for (unsigned int n = 0u; n < numberClients; ++n)
+		{
+			tcpClients.emplace_back(std::make_unique<Network::TCPClient>());
+
+			if (!tcpClients.back()->connect(Network::Address4::localHost(), serverPort))
+			{
+				OCEAN_SET_FAILED(validation);
+			}
+		}
+
+		// the scheduler must accept all connections, although none of the connections is sending data
+
+		const Timestamp connectionTimestamp(true);
+
+		while (tcpServer.connections() < numberClients && !connectionTimestamp.hasTimePassed(5.0))
+		{
+			Thread::sleep(1u);
+		}
+
+		OCEAN_EXPECT_EQUAL(validation, tcpServer.connections(), size_t(numberClients));
+
+		size_t sourceBufferSize = 0;
+
+		for (const std::unique_ptr<Network::TCPClient>& tcpClient : tcpClients)
+		{
+			const unsigned int bytes = RandomI::random(randomGenerator, 1u, 1000u);
+
+			Buffer buffer(bytes);
+			for (uint8_t& element : buffer)
+			{
+				element = uint8_t(RandomI::random(randomGenerator, 255u));
+			}
+
+			OCEAN_EXPECT_EQUAL(validation, tcpClient->send(buffer.data(), buffer.size()), Network::TCPClient::SR_SUCCEEDED);
+
+			sourceBufferSize += buffer.size();
+		}
+
+		Thread::sleep(100u);
+
+		OCEAN_EXPECT_TRUE(validation, tcpServer.stop());
+
+		OCEAN_EXPECT_EQUAL(validation, receiver.numberConnectionRequests_, numberClients);
+
+		size_t targetBufferSize = 0;
+		for (const Buffer& buffer : receiver.buffers_)
+		{
+			targetBufferSize += buffer.size();
+		}
+
+		OCEAN_EXPECT_EQUAL(validation, sourceBufferSize, targetBufferSize);
+
+#ifdef OCEAN_USE_GTEST
+		// one execution is enough for GTest
+		break;
+#endif
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
 }
 
 }
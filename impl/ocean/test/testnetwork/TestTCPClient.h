@@ -93,6 +93,13 @@ class OCEAN_TEST_NETWORK_EXPORT TestTCPClient
 		 * @return True, if succeeded
 		 */
 		static bool testSendReceive(const double testDuration);
+
+		/**
+		 * Tests sending and receiving data with several concurrent connections served by the socket scheduler.
+		 * @param testDuration The number of seconds for each test, with range (0, infinity)
+		 * @return True, if succeeded
+		 */
+		static bool testManyConnections(const double testDuration);
 };
 
 }
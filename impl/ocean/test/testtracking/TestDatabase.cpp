@@ -13,8 +13,12 @@
 #include "ocean/base/Timestamp.h"
 #include "ocean/base/RandomI.h"
 
+#include "ocean/math/Random.h"
+
 #include "ocean/tracking/Utilities.h"
 
+#include <thread>
+
 namespace Ocean
 {
 
@@ -49,6 +53,15 @@ bool TestDatabase::test(const double testDuration, const TestSelector& selector)
 		Log::info() << " ";
 	}
 
+	if (selector.shouldRun("snapshot"))
+	{
+		testResult = testSnapshot(testDuration);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
 	Log::info() << testResult;
 
 	return testResult.succeeded();
@@ -66,6 +79,11 @@ TEST(TestDatabase, Serialization)
 	EXPECT_TRUE(TestDatabase::testSerialization(GTEST_TEST_DURATION));
 }
 
+TEST(TestDatabase, Snapshot)
+{
+	EXPECT_TRUE(TestDatabase::testSnapshot(GTEST_TEST_DURATION));
+}
+
 
 #endif // OCEAN_USE_GTEST
 
@@ -435,6 +453,101 @@ bool TestDatabase::testSerialization(const double testDuration)
 	return validation.succeeded();
 }
 
+bool TestDatabase::testSnapshot(const double testDuration)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Test snapshot:";
+
+	const static unsigned int maxNumberPoses = 100u;
+	const static unsigned int maxNumberObjectPoints = 100u;
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		const unsigned int numberPoses = RandomI::random(randomGenerator, 1u, maxNumberPoses);
+		const unsigned int numberObjectPoints = RandomI::random(randomGenerator, 1u, maxNumberObjectPoints);
+
+		Tracking::Database database(createDatabaseWithRandomTopology(randomGenerator, 0u, maxNumberPoses - 1u, numberPoses, numberObjectPoints, 0u, numberObjectPoints));
+
+		{
+			// an unmodified database must return the same snapshot
+
+			const Tracking::SharedConstDatabase snapshot = database.snapshot();
+			const Tracking::SharedConstDatabase secondSnapshot = database.snapshot();
+
+			OCEAN_EXPECT_TRUE(validation, snapshot != nullptr);
+			OCEAN_EXPECT_TRUE(validation, snapshot == secondSnapshot);
+
+			// a modified database must return a new snapshot, while the previous snapshot is not affected
+
+			const Indices32 poseIds = database.poseIds<false>();
+			ocean_assert(!poseIds.empty());
+
+			const Index32 poseId = poseIds[RandomI::random(randomGenerator, (unsigned int)(poseIds.size()) - 1u)];
+
+			const HomogenousMatrix4 oldPose = database.pose<false>(poseId);
+			const HomogenousMatrix4 newPose(Random::vector3(randomGenerator), Random::quaternion(randomGenerator));
+
+			const uint64_t version = database.version();
+
+			database.setPose<true>(poseId, newPose);
+
+			OCEAN_EXPECT_NOT_EQUAL(validation, database.version(), version);
+
+			const Tracking::SharedConstDatabase thirdSnapshot = database.snapshot();
+
+			OCEAN_EXPECT_TRUE(validation, thirdSnapshot != snapshot);
+
+			OCEAN_EXPECT_TRUE(validation, snapshot->pose<false>(poseId) == oldPose);
+			OCEAN_EXPECT_TRUE(validation, thirdSnapshot->pose<false>(poseId) == newPose);
+		}
+
+		{
+			// a writer thread sets all poses to one unique pose, so that every snapshot must contain identical poses only
+
+			database.setPoses<true>(HomogenousMatrix4(true));
+
+			std::atomic<bool> stopWriter(false);
+
+			std::thread writerThread([&database, &stopWriter]()
+			{
+				RandomGenerator writerRandomGenerator;
+
+				while (!stopWriter)
+				{
+					database.setPoses<true>(HomogenousMatrix4(Random::vector3(writerRandomGenerator), Random::quaternion(writerRandomGenerator)));
+				}
+			});
+
+			for (unsigned int nIteration = 0u; nIteration < 10u; ++nIteration)
+			{
+				const Tracking::SharedConstDatabase snapshot = database.snapshot();
+
+				const Indices32 poseIds = snapshot->poseIds<false>();
+				const HomogenousMatrices4 poses = snapshot->poses<false>(poseIds.data(), poseIds.size());
+
+				for (const HomogenousMatrix4& pose : poses)
+				{
+					OCEAN_EXPECT_TRUE(validation, pose == poses.front());
+				}
+			}
+
+			stopWriter = true;
+			writerThread.join();
+		}
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
 Tracking::Database TestDatabase::createDatabaseWithRandomTopology(RandomGenerator& randomGenerator, const unsigned int lowerPoseId, const unsigned int upperPoseId, const unsigned int numberPoses, const unsigned int numberObjectPoints, const unsigned int minimalNumberObservations, const unsigned int maximalNumberObservations)
 {
 	ocean_assert(lowerPoseId <= upperPoseId);
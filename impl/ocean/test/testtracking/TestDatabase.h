@@ -55,6 +55,13 @@ class OCEAN_TEST_TRACKING_EXPORT TestDatabase
 		 */
 		static bool testSerialization(const double testDuration);
 
+		/**
+		 * Tests the snapshot of the database, also while the database is modified concurrently.
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @return True, if succeeded
+		 */
+		static bool testSnapshot(const double testDuration);
+
 	protected:
 
 		/**
@@ -0,0 +1,343 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "ocean/test/testtracking/TestMultiViewPlaneFinder.h"
+
+#include "ocean/test/TestResult.h"
+#include "ocean/test/ValidationPrecision.h"
+
+#include "ocean/base/RandomI.h"
+#include "ocean/base/Timestamp.h"
+
+#include "ocean/math/Random.h"
+
+#include "ocean/tracking/MultiViewPlaneFinder.h"
+
+namespace Ocean
+{
+
+namespace Test
+{
+
+namespace TestTracking
+{
+
+bool TestMultiViewPlaneFinder::test(const double testDuration, Worker& worker, const TestSelector& selector)
+{
+	ocean_assert(testDuration > 0.0);
+
+	TestResult testResult("MultiViewPlaneFinder test");
+	Log::info() << " ";
+
+	if (selector.shouldRun("determineplane"))
+	{
+		testResult = testDeterminePlane(testDuration, worker);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
+	if (selector.shouldRun("refineplane"))
+	{
+		testResult = testRefinePlane(testDuration, worker);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
+	Log::info() << testResult;
+
+	return testResult.succeeded();
+}
+
+#ifdef OCEAN_USE_GTEST
+
+TEST(TestMultiViewPlaneFinder, DeterminePlane)
+{
+	Worker worker;
+	EXPECT_TRUE(TestMultiViewPlaneFinder::testDeterminePlane(GTEST_TEST_DURATION, worker));
+}
+
+TEST(TestMultiViewPlaneFinder, RefinePlane)
+{
+	Worker worker;
+	EXPECT_TRUE(TestMultiViewPlaneFinder::testRefinePlane(GTEST_TEST_DURATION, worker));
+}
+
+#endif // OCEAN_USE_GTEST
+
+bool TestMultiViewPlaneFinder::testDeterminePlane(const double testDuration, Worker& worker)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Testing determinePlane() with eight views, with and without worker:";
+
+	RandomGenerator randomGenerator;
+	ValidationPrecision validation(0.95, randomGenerator);
+
+	const PinholeCamera pinholeCamera(640u, 480u, Numeric::deg2rad(60));
+
+	constexpr size_t numberViews = 8;
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		const size_t numberPoints = size_t(RandomI::random(randomGenerator, 50u, 150u));
+		const bool noise = RandomI::boolean(randomGenerator);
+
+		Plane3 groundTruthPlane;
+		HomogenousMatrices4 world_T_cameras;
+		std::vector<Vectors2> imagePointGroups;
+		createViews(pinholeCamera, numberViews, numberPoints, noise, randomGenerator, groundTruthPlane, world_T_cameras, imagePointGroups);
+
+		Tracking::MultiViewPlaneFinder planeFinder;
+
+		for (const Vectors2& imagePoints : imagePointGroups)
+		{
+			OCEAN_EXPECT_TRUE(validation, planeFinder.addImagePoint(imagePoints));
+		}
+
+		const Scalar maximalAngle = noise ? Numeric::deg2rad(2) : Numeric::deg2rad(Scalar(0.5));
+		const Scalar maximalDistance = noise ? Scalar(0.05) : Scalar(0.01);
+
+		for (const bool useWorker : {false, true})
+		{
+			ValidationPrecision::ScopedIteration scopedIteration(validation);
+
+			Plane3 plane;
+			HomogenousMatrices4 poses;
+
+			if (planeFinder.determinePlane(pinholeCamera, plane, poses, HomogenousMatrix4(Vector3(0, 0, 1)), Plane3(Vector3(0, 0, 1), 0), useWorker ? &worker : nullptr))
+			{
+				OCEAN_EXPECT_EQUAL(validation, poses.size(), numberViews);
+
+				if (!isAccurate(plane, poses, groundTruthPlane, world_T_cameras, maximalAngle, maximalDistance))
+				{
+					scopedIteration.setInaccurate();
+				}
+			}
+			else
+			{
+				scopedIteration.setInaccurate();
+			}
+		}
+	}
+	while (validation.needMoreIterations() || !startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
+bool TestMultiViewPlaneFinder::testRefinePlane(const double testDuration, Worker& worker)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Testing refinePlane() with five known and three new views:";
+
+	RandomGenerator randomGenerator;
+	ValidationPrecision validation(0.95, randomGenerator);
+
+	const PinholeCamera pinholeCamera(640u, 480u, Numeric::deg2rad(60));
+
+	constexpr size_t numberViews = 8;
+	constexpr size_t numberKnownViews = 5;
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		ValidationPrecision::ScopedIteration scopedIteration(validation);
+
+		const size_t numberPoints = size_t(RandomI::random(randomGenerator, 50u, 150u));
+		const bool noise = RandomI::boolean(randomGenerator);
+
+		Plane3 groundTruthPlane;
+		HomogenousMatrices4 world_T_cameras;
+		std::vector<Vectors2> imagePointGroups;
+		createViews(pinholeCamera, numberViews, numberPoints, noise, randomGenerator, groundTruthPlane, world_T_cameras, imagePointGroups);
+
+		const Scalar maximalAngle = noise ? Numeric::deg2rad(2) : Numeric::deg2rad(Scalar(0.5));
+		const Scalar maximalDistance = noise ? Scalar(0.05) : Scalar(0.01);
+
+		// the reference result is determined from all views at once
+
+		Tracking::MultiViewPlaneFinder allViewsPlaneFinder;
+
+		for (const Vectors2& imagePoints : imagePointGroups)
+		{
+			OCEAN_EXPECT_TRUE(validation, allViewsPlaneFinder.addImagePoint(imagePoints));
+		}
+
+		Plane3 allViewsPlane;
+		HomogenousMatrices4 allViewsPoses;
+		const bool allViewsResult = allViewsPlaneFinder.determinePlane(pinholeCamera, allViewsPlane, allViewsPoses);
+
+		// the incremental result is determined from the first views, and refined with the remaining views afterwards
+
+		Tracking::MultiViewPlaneFinder planeFinder;
+
+		for (size_t n = 0; n < numberKnownViews; ++n)
+		{
+			OCEAN_EXPECT_TRUE(validation, planeFinder.addImagePoint(imagePointGroups[n]));
+		}
+
+		Plane3 plane;
+		HomogenousMatrices4 poses;
+
+		if (!allViewsResult || !planeFinder.determinePlane(pinholeCamera, plane, poses))
+		{
+			scopedIteration.setInaccurate();
+			continue;
+		}
+
+		OCEAN_EXPECT_EQUAL(validation, poses.size(), numberKnownViews);
+
+		for (size_t n = numberKnownViews; n < numberViews; ++n)
+		{
+			OCEAN_EXPECT_TRUE(validation, planeFinder.addImagePoint(imagePointGroups[n]));
+		}
+
+		const bool useWorker = RandomI::boolean(randomGenerator);
+
+		if (planeFinder.refinePlane(pinholeCamera, plane, poses, useWorker ? &worker : nullptr))
+		{
+			OCEAN_EXPECT_EQUAL(validation, poses.size(), numberViews);
+
+			if (!isAccurate(plane, poses, groundTruthPlane, world_T_cameras, maximalAngle, maximalDistance))
+			{
+				scopedIteration.setInaccurate();
+			}
+
+			// the refinement has to match the determination with all views
+
+			if (!isAccurate(plane, poses, allViewsPlane, allViewsPoses, maximalAngle, maximalDistance))
+			{
+				scopedIteration.setInaccurate();
+			}
+		}
+		else
+		{
+			// the known plane and poses must be untouched
+
+			OCEAN_EXPECT_EQUAL(validation, poses.size(), numberKnownViews);
+
+			scopedIteration.setInaccurate();
+		}
+	}
+	while (validation.needMoreIterations() || !startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
+void TestMultiViewPlaneFinder::createViews(const PinholeCamera& pinholeCamera, const size_t numberViews, const size_t numberPoints, const bool noise, RandomGenerator& randomGenerator, Plane3& plane, HomogenousMatrices4& world_T_cameras, std::vector<Vectors2>& imagePointGroups)
+{
+	ocean_assert(pinholeCamera.isValid());
+	ocean_assert(numberViews >= 2 && numberPoints >= 4);
+
+	// the plane contains the origin and is slightly tilted, the first camera is located one meter above the origin looking towards the negative z-axis
+
+	plane = Plane3(Quaternion(Random::vector3(randomGenerator), Random::scalar(randomGenerator, 0, Numeric::deg2rad(20))) * Vector3(0, 0, 1), 0);
+
+	world_T_cameras.clear();
+	world_T_cameras.reserve(numberViews);
+
+	world_T_cameras.emplace_back(Vector3(0, 0, 1));
+
+	while (world_T_cameras.size() < numberViews)
+	{
+		const Vector3 translation = Random::vector3(randomGenerator, Scalar(-0.3), Scalar(0.3), Scalar(-0.3), Scalar(0.3), Scalar(0.8), Scalar(1.2));
+
+		if (Vector2(translation.x(), translation.y()).length() < Scalar(0.15))
+		{
+			// we ensure a minimal baseline to the first camera
+			continue;
+		}
+
+		world_T_cameras.emplace_back(translation, Random::euler(randomGenerator, Numeric::deg2rad(5)));
+	}
+
+	imagePointGroups = std::vector<Vectors2>(numberViews);
+
+	constexpr Scalar border = Scalar(20);
+
+	while (imagePointGroups.front().size() < numberPoints)
+	{
+		const Vector2 imagePoint = Random::vector2(randomGenerator, border, Scalar(pinholeCamera.width()) - border, border, Scalar(pinholeCamera.height()) - border);
+
+		Vector3 objectPoint;
+		if (!plane.intersection(pinholeCamera.ray(imagePoint, world_T_cameras.front()), objectPoint))
+		{
+			continue;
+		}
+
+		Vectors2 imagePoints(1, imagePoint);
+
+		for (size_t n = 1; n < numberViews; ++n)
+		{
+			const Vector2 projectedImagePoint = pinholeCamera.projectToImage<true>(world_T_cameras[n], objectPoint, false);
+
+			if (!pinholeCamera.isInside(projectedImagePoint))
+			{
+				break;
+			}
+
+			imagePoints.push_back(noise ? projectedImagePoint + Random::gaussianNoiseVector2(randomGenerator, Scalar(0.5), Scalar(0.5)) : projectedImagePoint);
+		}
+
+		if (imagePoints.size() == numberViews)
+		{
+			for (size_t n = 0; n < numberViews; ++n)
+			{
+				imagePointGroups[n].push_back(imagePoints[n]);
+			}
+		}
+	}
+}
+
+bool TestMultiViewPlaneFinder::isAccurate(const Plane3& plane, const HomogenousMatrices4& poses, const Plane3& groundTruthPlane, const HomogenousMatrices4& world_T_cameras, const Scalar maximalAngle, const Scalar maximalDistance)
+{
+	ocean_assert(plane.isValid() && groundTruthPlane.isValid());
+
+	if (poses.size() != world_T_cameras.size())
+	{
+		return false;
+	}
+
+	// the normal of the plane may be flipped
+
+	if (Numeric::abs(plane.normal() * groundTruthPlane.normal()) < Numeric::cos(maximalAngle))
+	{
+		return false;
+	}
+
+	for (size_t n = 0; n < poses.size(); ++n)
+	{
+		if (poses[n].translation().distance(world_T_cameras[n].translation()) > maximalDistance)
+		{
+			return false;
+		}
+
+		if (poses[n].rotation().smallestAngle(world_T_cameras[n].rotation()) > maximalAngle)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+}
+
+}
+
+}
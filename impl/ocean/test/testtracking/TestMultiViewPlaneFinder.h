@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#ifndef META_OCEAN_TEST_TESTTRACKING_TEST_MULTI_VIEW_PLANE_FINDER_H
+#define META_OCEAN_TEST_TESTTRACKING_TEST_MULTI_VIEW_PLANE_FINDER_H
+
+#include "ocean/test/testtracking/TestTracking.h"
+
+#include "ocean/base/RandomGenerator.h"
+#include "ocean/base/Worker.h"
+
+#include "ocean/math/HomogenousMatrix4.h"
+#include "ocean/math/PinholeCamera.h"
+#include "ocean/math/Plane3.h"
+
+#include "ocean/test/TestSelector.h"
+
+namespace Ocean
+{
+
+namespace Test
+{
+
+namespace TestTracking
+{
+
+/**
+ * This class implements tests for the Tracking::MultiViewPlaneFinder class.
+ * @ingroup testtracking
+ */
+class OCEAN_TEST_TRACKING_EXPORT TestMultiViewPlaneFinder
+{
+	public:
+
+		/**
+		 * Starts all tests for the MultiViewPlaneFinder class.
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @param worker The worker object
+		 * @param selector The test selector
+		 * @return True, if succeeded
+		 */
+		static bool test(const double testDuration, Worker& worker, const TestSelector& selector);
+
+		/**
+		 * Tests the determination of the plane and the camera poses from eight synthetic views, with and without worker.
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @param worker The worker object
+		 * @return True, if succeeded
+		 */
+		static bool testDeterminePlane(const double testDuration, Worker& worker);
+
+		/**
+		 * Tests the incremental refinement of a plane determined from the first five of eight synthetic views.
+		 * The refined result must match the ground truth as well as the plane and poses determined from all views at once.
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @param worker The worker object
+		 * @return True, if succeeded
+		 */
+		static bool testRefinePlane(const double testDuration, Worker& worker);
+
+	protected:
+
+		/**
+		 * Creates synthetic views of object points located on a plane.
+		 * The first camera pose is identical to the default initial pose of the plane finder, the plane contains the origin and is slightly tilted.
+		 * @param pinholeCamera The camera profile to be used, must be valid
+		 * @param numberViews The number of views to be created, with range [2, infinity)
+		 * @param numberPoints The number of object points to be created, with range [4, infinity)
+		 * @param noise True, to add Gaussian noise to the image points of all views but the first one
+		 * @param randomGenerator The random generator to be used
+		 * @param plane The resulting ground truth plane
+		 * @param world_T_cameras The resulting ground truth camera poses, one for each view
+		 * @param imagePointGroups The resulting image points, one group for each view, all object points are visible in all views
+		 */
+		static void createViews(const PinholeCamera& pinholeCamera, const size_t numberViews, const size_t numberPoints, const bool noise, RandomGenerator& randomGenerator, Plane3& plane, HomogenousMatrices4& world_T_cameras, std::vector<Vectors2>& imagePointGroups);
+
+		/**
+		 * Returns whether a determined plane and determined camera poses match with the ground truth.
+		 * @param plane The determined plane, must be valid
+		 * @param poses The determined camera poses
+		 * @param groundTruthPlane The ground truth plane, must be valid
+		 * @param world_T_cameras The ground truth camera poses
+		 * @param maximalAngle The maximal angle between the normals of both planes and between corresponding camera orientations, in radian, with range [0, PI/2)
+		 * @param maximalDistance The maximal distance between corresponding camera positions, with range [0, infinity)
+		 * @return True, if so
+		 */
+		static bool isAccurate(const Plane3& plane, const HomogenousMatrices4& poses, const Plane3& groundTruthPlane, const HomogenousMatrices4& world_T_cameras, const Scalar maximalAngle, const Scalar maximalDistance);
+};
+
+}
+
+}
+
+}
+
+#endif // META_OCEAN_TEST_TESTTRACKING_TEST_MULTI_VIEW_PLANE_FINDER_H
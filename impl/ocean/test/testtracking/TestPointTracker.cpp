@@ -0,0 +1,280 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "ocean/test/testtracking/TestPointTracker.h"
+
+#include "ocean/test/TestResult.h"
+#include "ocean/test/Validation.h"
+
+#include "ocean/base/RandomI.h"
+#include "ocean/base/Timestamp.h"
+
+#include "ocean/cv/CVUtilities.h"
+#include "ocean/cv/FrameFilterGaussian.h"
+
+#include "ocean/tracking/point/PointTracker.h"
+
+namespace Ocean
+{
+
+namespace Test
+{
+
+namespace TestTracking
+{
+
+bool TestPointTracker::test(const double testDuration, Worker& worker, const TestSelector& selector)
+{
+	ocean_assert(testDuration > 0.0);
+
+	TestResult testResult("PointTracker test");
+	Log::info() << " ";
+
+	if (selector.shouldRun("historydepth"))
+	{
+		testResult = testHistoryDepth(testDuration);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
+	if (selector.shouldRun("trackarchive"))
+	{
+		testResult = testTrackArchive(testDuration, worker);
+
+		Log::info() << " ";
+	}
+
+	Log::info() << testResult;
+
+	return testResult.succeeded();
+}
+
+#ifdef OCEAN_USE_GTEST
+
+TEST(TestPointTracker, HistoryDepth)
+{
+	EXPECT_TRUE(TestPointTracker::testHistoryDepth(GTEST_TEST_DURATION));
+}
+
+TEST(TestPointTracker, TrackArchive)
+{
+	Worker worker;
+	EXPECT_TRUE(TestPointTracker::testTrackArchive(GTEST_TEST_DURATION, worker));
+}
+
+#endif // OCEAN_USE_GTEST
+
+bool TestPointTracker::testHistoryDepth(const double testDuration)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "History depth test:";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	constexpr unsigned int cameraWidth = 160u;
+	constexpr unsigned int cameraHeight = 120u;
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		const Frame environmentFrame = createEnvironmentFrame(cameraWidth + 40u, cameraHeight + 40u, randomGenerator);
+
+		const unsigned int historyDepth = RandomI::random(randomGenerator, 2u, 8u);
+		const unsigned int frames = RandomI::random(randomGenerator, historyDepth, 24u);
+
+		// the tracker keeping all frames serves as ground truth, both trackers are applied without worker to ensure identical feature points
+
+		Tracking::Point::PointTracker boundedTracker;
+		boundedTracker.setHistoryDepth(historyDepth);
+
+		Tracking::Point::PointTracker unboundedTracker;
+
+		OCEAN_EXPECT_EQUAL(validation, boundedTracker.historyDepth(), historyDepth);
+		OCEAN_EXPECT_EQUAL(validation, unboundedTracker.historyDepth(), 0u);
+
+		int left = 20;
+		int top = 20;
+
+		for (unsigned int frameIndex = 0u; frameIndex < frames; ++frameIndex)
+		{
+			left = minmax(0, left + RandomI::random(randomGenerator, -2, 2), int(environmentFrame.width() - cameraWidth));
+			top = minmax(0, top + RandomI::random(randomGenerator, -2, 2), int(environmentFrame.height() - cameraHeight));
+
+			const Frame cameraFrame = environmentFrame.subFrame((unsigned int)(left), (unsigned int)(top), cameraWidth, cameraHeight, Frame::CM_COPY_REMOVE_PADDING_LAYOUT);
+
+			const Index32 boundedFrameIndex = boundedTracker.newFrame(cameraFrame);
+			const Index32 unboundedFrameIndex = unboundedTracker.newFrame(cameraFrame);
+
+			OCEAN_EXPECT_EQUAL(validation, boundedFrameIndex, frameIndex);
+			OCEAN_EXPECT_EQUAL(validation, unboundedFrameIndex, frameIndex);
+
+			if (boundedFrameIndex != frameIndex || unboundedFrameIndex != frameIndex)
+			{
+				break;
+			}
+
+			// the database of the bounded tracker must contain the most recent frames only
+
+			const Tracking::Database& boundedDatabase = boundedTracker.database();
+
+			Index32 lowerFrameIndex = Index32(-1);
+			Index32 upperFrameIndex = Index32(-1);
+
+			if (boundedDatabase.poseBorders<false>(lowerFrameIndex, upperFrameIndex))
+			{
+				const Index32 expectedLowerFrameIndex = frameIndex + 1u >= historyDepth ? frameIndex + 1u - historyDepth : 0u;
+
+				OCEAN_EXPECT_EQUAL(validation, lowerFrameIndex, expectedLowerFrameIndex);
+				OCEAN_EXPECT_EQUAL(validation, upperFrameIndex, frameIndex);
+			}
+			else
+			{
+				OCEAN_SET_FAILED(validation);
+			}
+
+			OCEAN_EXPECT_EQUAL(validation, boundedDatabase.poseNumber<false>(), size_t(std::min(frameIndex + 1u, historyDepth)));
+			OCEAN_EXPECT_LESS_EQUAL(validation, boundedDatabase.imagePointNumber<false>(), unboundedTracker.database().imagePointNumber<false>());
+
+			// the tracks within the history must be identical
+
+			const Tracking::Point::PointTracker::PointTracks boundedTracks = boundedTracker.pointTracks(frameIndex, historyDepth);
+			const Tracking::Point::PointTracker::PointTracks unboundedTracks = unboundedTracker.pointTracks(frameIndex, historyDepth);
+
+			OCEAN_EXPECT_EQUAL(validation, boundedTracks.size(), unboundedTracks.size());
+
+			if (boundedTracks.size() == unboundedTracks.size())
+			{
+				for (size_t n = 0; n < boundedTracks.size(); ++n)
+				{
+					OCEAN_EXPECT_LESS_EQUAL(validation, boundedTracks[n].size(), size_t(historyDepth));
+					OCEAN_EXPECT_TRUE(validation, boundedTracks[n] == unboundedTracks[n]);
+				}
+			}
+		}
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
+bool TestPointTracker::testTrackArchive(const double testDuration, Worker& worker)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Track archive test:";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	constexpr unsigned int cameraWidth = 160u;
+	constexpr unsigned int cameraHeight = 120u;
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		Worker* useWorker = RandomI::boolean(randomGenerator) ? &worker : nullptr;
+
+		const Frame environmentFrame = createEnvironmentFrame(cameraWidth + 80u, cameraHeight + 80u, randomGenerator);
+
+		const unsigned int frames = RandomI::random(randomGenerator, 2u, 24u);
+
+		Tracking::Point::PointTracker pointTracker;
+		pointTracker.setArchiveFinishedTracks(true);
+
+		size_t archivedTracks = 0;
+
+		int left = 40;
+		int top = 40;
+
+		for (unsigned int frameIndex = 0u; frameIndex < frames; ++frameIndex)
+		{
+			// large jumps let points leave the camera frame
+
+			const int maximalOffset = RandomI::boolean(randomGenerator) ? 2 : 16;
+
+			left = minmax(0, left + RandomI::random(randomGenerator, -maximalOffset, maximalOffset), int(environmentFrame.width() - cameraWidth));
+			top = minmax(0, top + RandomI::random(randomGenerator, -maximalOffset, maximalOffset), int(environmentFrame.height() - cameraHeight));
+
+			const Frame cameraFrame = environmentFrame.subFrame((unsigned int)(left), (unsigned int)(top), cameraWidth, cameraHeight, Frame::CM_COPY_REMOVE_PADDING_LAYOUT);
+
+			if (pointTracker.newFrame(cameraFrame, useWorker) != frameIndex)
+			{
+				OCEAN_SET_FAILED(validation);
+				break;
+			}
+
+			const Tracking::Point::PointTracker::TrackArchive trackArchive = pointTracker.takeTrackArchive();
+
+			OCEAN_EXPECT_TRUE(validation, pointTracker.takeTrackArchive().isEmpty());
+
+			const Tracking::Database& database = pointTracker.database();
+
+			size_t numberObservations = 0;
+
+			for (size_t trackIndex = 0; trackIndex < trackArchive.size(); ++trackIndex)
+			{
+				const Index32 firstFrameIndex = trackArchive.firstFrameIndex(trackIndex);
+				const size_t trackLength = trackArchive.trackLength(trackIndex);
+				const Vector2* observations = trackArchive.trackObservations(trackIndex);
+
+				numberObservations += trackLength;
+
+				// the track has been lost in the current frame
+
+				OCEAN_EXPECT_GREATER_EQUAL(validation, trackLength, size_t(1));
+				OCEAN_EXPECT_EQUAL(validation, firstFrameIndex + Index32(trackLength), frameIndex);
+
+				for (size_t n = 0; n < trackLength; ++n)
+				{
+					const Vectors2 imagePoints = database.imagePoints<false>(firstFrameIndex + Index32(n));
+
+					OCEAN_EXPECT_TRUE(validation, std::find(imagePoints.cbegin(), imagePoints.cend(), observations[n]) != imagePoints.cend());
+				}
+			}
+
+			OCEAN_EXPECT_EQUAL(validation, numberObservations, trackArchive.numberObservations());
+
+			archivedTracks += trackArchive.size();
+
+			// each object point is either visible in the current frame, or its track has been archived
+
+			const size_t activeTracks = database.imagePoints<false>(frameIndex).size();
+
+			OCEAN_EXPECT_EQUAL(validation, archivedTracks + activeTracks, database.objectPointNumber<false>());
+		}
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
+Frame TestPointTracker::createEnvironmentFrame(const unsigned int width, const unsigned int height, RandomGenerator& randomGenerator)
+{
+	ocean_assert(width >= 1u && height >= 1u);
+
+	Frame frame = CV::CVUtilities::randomizedFrame(FrameType(width, height, FrameType::FORMAT_Y8, FrameType::ORIGIN_UPPER_LEFT), &randomGenerator);
+
+	CV::FrameFilterGaussian::filter(frame, 5u);
+
+	return frame;
+}
+
+}
+
+}
+
+}
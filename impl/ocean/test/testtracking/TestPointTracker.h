@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#ifndef META_OCEAN_TEST_TESTTRACKING_TEST_POINT_TRACKER_H
+#define META_OCEAN_TEST_TESTTRACKING_TEST_POINT_TRACKER_H
+
+#include "ocean/test/testtracking/TestTracking.h"
+
+#include "ocean/base/Frame.h"
+#include "ocean/base/RandomGenerator.h"
+#include "ocean/base/Worker.h"
+
+#include "ocean/test/TestSelector.h"
+
+namespace Ocean
+{
+
+namespace Test
+{
+
+namespace TestTracking
+{
+
+/**
+ * This class implements tests for the PointTracker class.
+ * @ingroup testtracking
+ */
+class OCEAN_TEST_TRACKING_EXPORT TestPointTracker
+{
+	public:
+
+		/**
+		 * Starts all tests for the point tracker class.
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @param worker The worker object
+		 * @param selector The test selector
+		 * @return True, if succeeded
+		 */
+		static bool test(const double testDuration, Worker& worker, const TestSelector& selector);
+
+		/**
+		 * Tests the bounded history of the tracker, the tracks within the history must be identical to the tracks of a tracker keeping all frames.
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @return True, if succeeded
+		 */
+		static bool testHistoryDepth(const double testDuration);
+
+		/**
+		 * Tests the archive of finished tracks.
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @param worker The worker object
+		 * @return True, if succeeded
+		 */
+		static bool testTrackArchive(const double testDuration, Worker& worker);
+
+	protected:
+
+		/**
+		 * Creates a random textured frame in which the camera frames are located.
+		 * @param width The width of the frame, in pixel, with range [1, infinity)
+		 * @param height The height of the frame, in pixel, with range [1, infinity)
+		 * @param randomGenerator The random generator to be used
+		 * @return The resulting frame with pixel format FORMAT_Y8
+		 */
+		static Frame createEnvironmentFrame(const unsigned int width, const unsigned int height, RandomGenerator& randomGenerator);
+};
+
+}
+
+}
+
+}
+
+#endif // META_OCEAN_TEST_TESTTRACKING_TEST_POINT_TRACKER_H
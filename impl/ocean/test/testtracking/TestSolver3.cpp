@@ -0,0 +1,276 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "ocean/test/testtracking/TestSolver3.h"
+
+#include "ocean/test/TestResult.h"
+#include "ocean/test/Validation.h"
+
+#include "ocean/base/HighPerformanceTimer.h"
+#include "ocean/base/RandomI.h"
+#include "ocean/base/Timestamp.h"
+
+#include "ocean/math/Random.h"
+
+#include "ocean/tracking/Solver3.h"
+
+namespace Ocean
+{
+
+namespace Test
+{
+
+namespace TestTracking
+{
+
+bool TestSolver3::test(const double testDuration, Worker& worker, const TestSelector& selector)
+{
+	ocean_assert(testDuration > 0.0);
+
+	TestResult testResult("Solver3 test");
+	Log::info() << " ";
+
+	if (selector.shouldRun("determineinitialobjectpointsfromsparsekeyframesransac"))
+	{
+		testResult = testDetermineInitialObjectPointsFromSparseKeyFramesRANSAC(testDuration, worker);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
+	Log::info() << testResult;
+
+	return testResult.succeeded();
+}
+
+#ifdef OCEAN_USE_GTEST
+
+// Invariant: the RANSAC iterations distributed over a worker reach the same quality as the single-threaded execution
+TEST(TestSolver3, DetermineInitialObjectPointsFromSparseKeyFramesRANSAC)
+{
+	Worker worker;
+	EXPECT_TRUE(TestSolver3::testDetermineInitialObjectPointsFromSparseKeyFramesRANSAC(GTEST_TEST_DURATION, worker));
+}
+
+#endif // OCEAN_USE_GTEST
+
+bool TestSolver3::testDetermineInitialObjectPointsFromSparseKeyFramesRANSAC(const double testDuration, Worker& worker)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Testing determineInitialObjectPointsFromSparseKeyFramesRANSAC() with and without worker:";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	const PinholeCamera pinholeCamera(640u, 480u, Numeric::deg2rad(60));
+
+	HighPerformanceStatistic performanceSingleCore;
+	HighPerformanceStatistic performanceMultiCore;
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		const unsigned int numberKeyFrames = RandomI::random(randomGenerator, 3u, 8u);
+		const unsigned int numberObjectPoints = RandomI::random(randomGenerator, 50u, 150u);
+
+		HomogenousMatrices4 world_T_cameras;
+		Vectors3 groundTruthObjectPoints;
+		Tracking::Database::ImagePointGroups imagePointGroups;
+
+		if (!createKeyFrames(pinholeCamera, numberKeyFrames, numberObjectPoints, randomGenerator, world_T_cameras, groundTruthObjectPoints, imagePointGroups))
+		{
+			OCEAN_SET_FAILED(validation);
+			continue;
+		}
+
+		constexpr unsigned int iterations = 20u;
+
+		size_t qualities[2] = {0, 0};
+
+		for (const bool useWorker : {false, true})
+		{
+			RandomGenerator localRandomGenerator(randomGenerator);
+
+			HomogenousMatrices4 poses;
+			Indices32 validPoseIndices;
+			Vectors3 objectPoints;
+			Indices32 validObjectPointIndices;
+
+			HighPerformanceStatistic& performance = useWorker ? performanceMultiCore : performanceSingleCore;
+
+			performance.start();
+				const bool result = Tracking::Solver3::determineInitialObjectPointsFromSparseKeyFramesRANSAC(pinholeCamera, imagePointGroups, localRandomGenerator, poses, validPoseIndices, objectPoints, validObjectPointIndices, iterations, Tracking::Solver3::RelativeThreshold(10u, Scalar(0.3), 20u), Scalar(3.5 * 3.5), nullptr, nullptr, nullptr, useWorker ? &worker : nullptr);
+			performance.stop();
+
+			OCEAN_EXPECT_TRUE(validation, result);
+
+			if (!result)
+			{
+				continue;
+			}
+
+			OCEAN_EXPECT_EQUAL(validation, poses.size(), validPoseIndices.size());
+			OCEAN_EXPECT_EQUAL(validation, objectPoints.size(), validObjectPointIndices.size());
+
+			if (poses.size() != validPoseIndices.size() || objectPoints.size() != validObjectPointIndices.size())
+			{
+				continue;
+			}
+
+			// the key frames do not contain outliers, so that almost all key frames and object points must be determined
+
+			OCEAN_EXPECT_EQUAL(validation, poses.size(), size_t(numberKeyFrames));
+			OCEAN_EXPECT_GREATER_EQUAL(validation, objectPoints.size() * 10, size_t(numberObjectPoints) * 9);
+
+			// the image points are disturbed by uniform noise in the range [-0.5, 0.5]
+
+			OCEAN_EXPECT_LESS_EQUAL(validation, averageSqrProjectionError(pinholeCamera, imagePointGroups, poses, validPoseIndices, objectPoints, validObjectPointIndices), Scalar(1));
+
+			// we use the same measure as the RANSAC to compare both results
+
+			qualities[useWorker ? 1 : 0] = poses.size() * objectPoints.size();
+		}
+
+		// the distribution of the iterations must not reduce the quality noticeably
+
+		OCEAN_EXPECT_GREATER_EQUAL(validation, qualities[1] * 10, qualities[0] * 9);
+		OCEAN_EXPECT_GREATER_EQUAL(validation, qualities[0] * 10, qualities[1] * 9);
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Performance without worker: " << performanceSingleCore.averageMseconds() << "ms";
+	Log::info() << "Performance with worker: " << performanceMultiCore.averageMseconds() << "ms";
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
+bool TestSolver3::createKeyFrames(const PinholeCamera& pinholeCamera, const unsigned int numberKeyFrames, const unsigned int numberObjectPoints, RandomGenerator& randomGenerator, HomogenousMatrices4& world_T_cameras, Vectors3& objectPoints, Tracking::Database::ImagePointGroups& imagePointGroups)
+{
+	ocean_assert(pinholeCamera.isValid());
+	ocean_assert(numberKeyFrames >= 2u && numberObjectPoints >= 1u);
+
+	// the cameras are located on a plane with a baseline of up to one meter and with a small rotation, all cameras are looking towards the negative z-axis
+
+	world_T_cameras.clear();
+	world_T_cameras.reserve(numberKeyFrames);
+
+	world_T_cameras.emplace_back(true);
+
+	while (world_T_cameras.size() < numberKeyFrames)
+	{
+		const Vector3 translation = Random::vector3(randomGenerator, Scalar(-0.5), Scalar(0.5), Scalar(-0.5), Scalar(0.5), Scalar(-0.1), Scalar(0.1));
+
+		if (translation.length() < Scalar(0.2))
+		{
+			// we ensure a minimal baseline to the first camera
+			continue;
+		}
+
+		world_T_cameras.emplace_back(translation, Random::euler(randomGenerator, Numeric::deg2rad(5)));
+	}
+
+	objectPoints.clear();
+	objectPoints.reserve(numberObjectPoints);
+
+	constexpr Scalar border = Scalar(10);
+
+	unsigned int attempts = 0u;
+
+	while (objectPoints.size() < numberObjectPoints)
+	{
+		if (++attempts > numberObjectPoints * 100u)
+		{
+			return false;
+		}
+
+		const Vector2 imagePoint = Random::vector2(randomGenerator, border, Scalar(pinholeCamera.width()) - border, border, Scalar(pinholeCamera.height()) - border);
+
+		const Vector3 objectPoint = pinholeCamera.ray(imagePoint, world_T_cameras.front()).point(Random::scalar(randomGenerator, Scalar(3), Scalar(6)));
+
+		bool isVisible = true;
+
+		for (size_t n = 1; isVisible && n < world_T_cameras.size(); ++n)
+		{
+			const HomogenousMatrix4& world_T_camera = world_T_cameras[n];
+
+			if ((world_T_camera.inverted() * objectPoint).z() >= Scalar(0))
+			{
+				isVisible = false;
+			}
+			else
+			{
+				const Vector2 projectedPoint = pinholeCamera.projectToImage<false>(world_T_camera, objectPoint, false);
+
+				isVisible = projectedPoint.x() >= border && projectedPoint.y() >= border && projectedPoint.x() < Scalar(pinholeCamera.width()) - border && projectedPoint.y() < Scalar(pinholeCamera.height()) - border;
+			}
+		}
+
+		if (isVisible)
+		{
+			objectPoints.push_back(objectPoint);
+		}
+	}
+
+	imagePointGroups.clear();
+	imagePointGroups.resize(numberKeyFrames);
+
+	for (unsigned int n = 0u; n < numberKeyFrames; ++n)
+	{
+		Vectors2& imagePoints = imagePointGroups[n];
+		imagePoints.reserve(numberObjectPoints);
+
+		for (const Vector3& objectPoint : objectPoints)
+		{
+			const Vector2 projectedPoint = pinholeCamera.projectToImage<false>(world_T_cameras[n], objectPoint, false);
+
+			imagePoints.push_back(projectedPoint + Random::vector2(randomGenerator, Scalar(-0.5), Scalar(0.5)));
+
+			ocean_assert(pinholeCamera.isInside(imagePoints.back()));
+		}
+	}
+
+	return true;
+}
+
+Scalar TestSolver3::averageSqrProjectionError(const PinholeCamera& pinholeCamera, const Tracking::Database::ImagePointGroups& imagePointGroups, const HomogenousMatrices4& poses, const Indices32& validPoseIndices, const Vectors3& objectPoints, const Indices32& validObjectPointIndices)
+{
+	ocean_assert(poses.size() == validPoseIndices.size());
+	ocean_assert(objectPoints.size() == validObjectPointIndices.size());
+
+	Scalar sqrError = Scalar(0);
+	size_t measurements = 0;
+
+	for (size_t i = 0; i < poses.size(); ++i)
+	{
+		const Vectors2& imagePoints = imagePointGroups[validPoseIndices[i]];
+
+		for (size_t n = 0; n < objectPoints.size(); ++n)
+		{
+			const Vector2 projectedPoint = pinholeCamera.projectToImage<false>(poses[i], objectPoints[n], false);
+
+			sqrError += projectedPoint.sqrDistance(imagePoints[validObjectPointIndices[n]]);
+			++measurements;
+		}
+	}
+
+	if (measurements == 0)
+	{
+		return Numeric::maxValue();
+	}
+
+	return sqrError / Scalar(measurements);
+}
+
+}
+
+}
+
+}
@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#ifndef META_OCEAN_TEST_TESTTRACKING_TEST_SOLVER3_H
+#define META_OCEAN_TEST_TESTTRACKING_TEST_SOLVER3_H
+
+#include "ocean/test/testtracking/TestTracking.h"
+
+#include "ocean/base/RandomGenerator.h"
+#include "ocean/base/Worker.h"
+
+#include "ocean/math/HomogenousMatrix4.h"
+#include "ocean/math/PinholeCamera.h"
+
+#include "ocean/test/TestSelector.h"
+
+#include "ocean/tracking/Database.h"
+
+namespace Ocean
+{
+
+namespace Test
+{
+
+namespace TestTracking
+{
+
+/**
+ * This class implements tests for the Tracking::Solver3 class.
+ * @ingroup testtracking
+ */
+class OCEAN_TEST_TRACKING_EXPORT TestSolver3
+{
+	public:
+
+		/**
+		 * Starts all tests for the Solver3 class.
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @param worker The worker object
+		 * @param selector The test selector
+		 * @return True, if succeeded
+		 */
+		static bool test(const double testDuration, Worker& worker, const TestSelector& selector);
+
+		/**
+		 * Tests the RANSAC-based determination of initial object points from sparse key frames.
+		 * The function is applied with and without worker on synthetic key frames, both executions must reach the same quality.
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @param worker The worker object
+		 * @return True, if succeeded
+		 */
+		static bool testDetermineInitialObjectPointsFromSparseKeyFramesRANSAC(const double testDuration, Worker& worker);
+
+	protected:
+
+		/**
+		 * Creates synthetic key frames observing random 3D object points, all object points are visible in all key frames.
+		 * @param pinholeCamera The camera profile to be used, must be valid
+		 * @param numberKeyFrames The number of key frames to create, with range [2, infinity)
+		 * @param numberObjectPoints The number of object points to create, with range [1, infinity)
+		 * @param randomGenerator The random generator to be used
+		 * @param world_T_cameras The resulting camera poses, one for each key frame
+		 * @param objectPoints The resulting 3D object points
+		 * @param imagePointGroups The resulting noisy image points, one group for each key frame, one image point for each object point
+		 * @return True, if succeeded
+		 */
+		static bool createKeyFrames(const PinholeCamera& pinholeCamera, const unsigned int numberKeyFrames, const unsigned int numberObjectPoints, RandomGenerator& randomGenerator, HomogenousMatrices4& world_T_cameras, Vectors3& objectPoints, Tracking::Database::ImagePointGroups& imagePointGroups);
+
+		/**
+		 * Determines the average squared projection error of object points in key frames.
+		 * @param pinholeCamera The camera profile which has been used, must be valid
+		 * @param imagePointGroups The groups of image points of all key frames
+		 * @param poses The camera poses of the valid key frames
+		 * @param validPoseIndices The indices of the valid key frames, one for each pose
+		 * @param objectPoints The 3D object points
+		 * @param validObjectPointIndices The indices of the image points corresponding to the object points, one for each object point
+		 * @return The average squared projection error, in pixel
+		 */
+		static Scalar averageSqrProjectionError(const PinholeCamera& pinholeCamera, const Tracking::Database::ImagePointGroups& imagePointGroups, const HomogenousMatrices4& poses, const Indices32& validPoseIndices, const Vectors3& objectPoints, const Indices32& validObjectPointIndices);
+};
+
+}
+
+}
+
+}
+
+#endif // META_OCEAN_TEST_TESTTRACKING_TEST_SOLVER3_H
@@ -8,8 +8,11 @@
 #include "ocean/test/testtracking/TestTracking.h"
 #include "ocean/test/testtracking/TestDatabase.h"
 #include "ocean/test/testtracking/TestHomographyImageAlignmentDense.h"
+#include "ocean/test/testtracking/TestMultiViewPlaneFinder.h"
 #include "ocean/test/testtracking/TestPatternTracker.h"
+#include "ocean/test/testtracking/TestPointTracker.h"
 #include "ocean/test/testtracking/TestSmoothedTransformation.h"
+#include "ocean/test/testtracking/TestSolver3.h"
 #include "ocean/test/testtracking/TestUnidirectionalCorrespondences.h"
 #include "ocean/test/testtracking/TestSimilarityTracker.h"
 #include "ocean/test/testtracking/TestVocabularyTree.h"
@@ -84,6 +87,15 @@ bool testTracking(const double testDuration, Worker& worker, const std::string&
 		testResult = TestDatabase::test(testDuration, subSelector);
 	}
 
+	if (TestSelector subSelector = selector.shouldRun("multiviewplanefinder"))
+	{
+		Log::info() << " ";
+		Log::info() << " ";
+		Log::info() << " ";
+		Log::info() << " ";
+		testResult = TestMultiViewPlaneFinder::test(testDuration, worker, subSelector);
+	}
+
 	if (TestSelector subSelector = selector.shouldRun("similaritytracker"))
 	{
 		Log::info() << " ";
@@ -102,6 +114,15 @@ bool testTracking(const double testDuration, Worker& worker, const std::string&
 		testResult = TestSmoothedTransformation::test(testDuration, worker, subSelector);
 	}
 
+	if (TestSelector subSelector = selector.shouldRun("solver3"))
+	{
+		Log::info() << " ";
+		Log::info() << " ";
+		Log::info() << " ";
+		Log::info() << " ";
+		testResult = TestSolver3::test(testDuration, worker, subSelector);
+	}
+
 	if (TestSelector subSelector = selector.shouldRun("vocabularytree"))
 	{
 		Log::info() << " ";
@@ -120,6 +141,15 @@ bool testTracking(const double testDuration, Worker& worker, const std::string&
 		testResult = TestPatternTracker::test(testDuration, worker, subSelector);
 	}
 
+	if (TestSelector subSelector = selector.shouldRun("pointtracker"))
+	{
+		Log::info() << " ";
+		Log::info() << " ";
+		Log::info() << " ";
+		Log::info() << " ";
+		testResult = TestPointTracker::test(testDuration, worker, subSelector);
+	}
+
 	if (TestSelector subSelector = selector.shouldRun("homographyimagealignmentdense"))
 	{
 		Log::info() << " ";
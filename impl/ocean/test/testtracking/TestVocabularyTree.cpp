@@ -18,6 +18,8 @@
 
 #include "ocean/math/Random.h"
 
+#include "ocean/tracking/VocabularyHash.h"
+
 namespace Ocean
 {
 
@@ -255,6 +257,15 @@ bool TestVocabularyTree::test(const double testDuration, Worker& worker, const T
 		Log::info() << " ";
 	}
 
+	if (selector.shouldRun("matchingdescriptorswithhashbinary"))
+	{
+		testResult = testMatchingDescriptorsWithHash(testDuration, worker);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
 	Log::info() << testResult;
 
 	return testResult.succeeded();
@@ -324,6 +335,12 @@ TEST(TestVocabularyTree, MatchingDescriptorsWithForest_Float)
 	EXPECT_TRUE((TestVocabularyTree::testMatchingDescriptorsWithForest<TestVocabularyTree::DT_FLOAT>(GTEST_TEST_DURATION, worker)));
 }
 
+TEST(TestVocabularyTree, MatchingDescriptorsWithHash_Binary)
+{
+	Worker worker;
+	EXPECT_TRUE(TestVocabularyTree::testMatchingDescriptorsWithHash(GTEST_TEST_DURATION, worker));
+}
+
 #endif // OCEAN_DEBUG
 
 #endif // OCEAN_USE_GTEST
@@ -595,7 +612,15 @@ bool TestVocabularyTree::testConstructor(const double testDuration, Worker& work
 
 				Worker* useWorker = multicoreItaration ? &worker : nullptr;
 
-				const typename VocabularyTree::Parameters parameters;
+				typename VocabularyTree::Parameters parameters;
+
+				if (!benchmarkIteration)
+				{
+					// the resulting tree must be valid for every initialization strategy, with and without mini-batches
+
+					parameters.initializationStrategy_ = typename VocabularyTree::InitializationStrategy(RandomI::random(randomGenerator, (unsigned int)(VocabularyTree::IS_PURE_RANDOM), (unsigned int)(VocabularyTree::IS_PLUS_PLUS)));
+					parameters.miniBatchSize_ = RandomI::boolean(randomGenerator) ? RandomI::random(randomGenerator, 50u, 500u) : 0u;
+				}
 
 				performance.startIf(benchmarkIteration);
 					const VocabularyTree vocabularyTree(descriptors.data(), descriptors.size(), TypeHelper::clusterMeanFunction_, parameters, useWorker, &randomGenerator);
@@ -1416,6 +1441,190 @@ bool TestVocabularyTree::testMatchingDescriptorsWithForest(const double testDura
 	return validation.succeeded();
 }
 
+bool TestVocabularyTree::testMatchingDescriptorsWithHash(const double testDuration, Worker& worker)
+{
+	ocean_assert(testDuration > 0.0);
+
+#ifdef OCEAN_USE_GTEST
+	constexpr unsigned int numberDescriptors = 500u;
+	constexpr unsigned int numberQueryDescriptors = 50u;
+#else
+	constexpr unsigned int numberDescriptors = 5000u;
+	constexpr unsigned int numberQueryDescriptors = 100u;
+#endif
+
+	using TypeHelper = TypeHelper<DT_BINARY>;
+
+	Log::info() << "Test hash matching with " << numberDescriptors << " descriptor hash features, with a " << TypeHelper::name_ << " Hash, and " << numberQueryDescriptors << " query features:";
+
+	using Descriptor = TypeHelper::Descriptor;
+	using Descriptors = TypeHelper::Descriptors;
+	using DistanceType = TypeHelper::DistanceType;
+	using VocabularyHash = Tracking::VocabularyHash<Descriptor, DistanceType, TypeHelper::determineDistance>;
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	// each stage trades latency for recall: more tables and a larger probe radius visit more buckets
+
+	constexpr unsigned int numberStages = 3u;
+
+	const VocabularyHash::HashParameters stageParameters[numberStages] =
+	{
+		VocabularyHash::HashParameters(4u, 0u, 0u),
+		VocabularyHash::HashParameters(8u, 0u, 1u),
+		VocabularyHash::HashParameters(8u, 0u, 2u)
+	};
+
+	const double minimalStagePercents[numberStages] = {0.30, 0.60, 0.80};
+
+	unsigned int sumQueryDescriptorStages[numberStages] = {0u};
+	unsigned int sumValidDistances = 0u;
+	unsigned int sumMatches = 0u;
+
+	HighPerformanceStatistic performanceQueryBruteForce;
+	HighPerformanceStatistic performanceConstruction[numberStages];
+	HighPerformanceStatistic performanceQueryStages[numberStages];
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		Descriptors descriptors(numberDescriptors);
+
+		for (Descriptor& descriptor : descriptors)
+		{
+			TypeHelper::randomizeDescriptor(descriptor, randomGenerator);
+		}
+
+		Descriptors queryDescriptors;
+		queryDescriptors.reserve(numberQueryDescriptors);
+
+		for (size_t n = 0; n < numberQueryDescriptors; ++n)
+		{
+			const Index32 index = RandomI::random(randomGenerator, numberDescriptors - 1u);
+
+			queryDescriptors.emplace_back(TypeHelper::modifyDescriptor(descriptors[index], randomGenerator));
+		}
+
+		IndexGroups32 bruteForceResult;
+
+		{
+			// testing brute force
+
+			bruteForceResult.reserve(numberQueryDescriptors);
+
+			performanceQueryBruteForce.start();
+				for (unsigned int nQuery = 0u; nQuery < numberQueryDescriptors; ++nQuery)
+				{
+					const Descriptor& queryDescriptor = queryDescriptors[nQuery];
+
+					Indices32 bestIndices;
+					bestIndices.reserve(4);
+
+					DistanceType bestDistance = NumericT<DistanceType>::maxValue();
+
+					for (unsigned int nDescriptor = 0u; nDescriptor < numberDescriptors; ++nDescriptor)
+					{
+						const DistanceType distance = TypeHelper::determineDistance(queryDescriptor, descriptors[nDescriptor]);
+
+						if (distance < bestDistance)
+						{
+							bestDistance = distance;
+
+							bestIndices.clear();
+							bestIndices.emplace_back(nDescriptor);
+						}
+						else if (distance == bestDistance)
+						{
+							bestIndices.emplace_back(nDescriptor);
+						}
+					}
+
+					bruteForceResult.emplace_back(std::move(bestIndices));
+				}
+			performanceQueryBruteForce.stop();
+		}
+
+		for (unsigned int stageIndex = 0u; stageIndex < numberStages; ++stageIndex)
+		{
+			Worker* useWorker = RandomI::boolean(randomGenerator) ? &worker : nullptr;
+
+			performanceConstruction[stageIndex].start();
+				const VocabularyHash vocabularyHash(descriptors.data(), descriptors.size(), stageParameters[stageIndex], useWorker, &randomGenerator);
+			performanceConstruction[stageIndex].stop();
+
+			OCEAN_EXPECT_EQUAL(validation, vocabularyHash.numberDescriptors(), size_t(numberDescriptors));
+			OCEAN_EXPECT_EQUAL(validation, vocabularyHash.numberTables(), size_t(stageParameters[stageIndex].numberTables_));
+
+			performanceQueryStages[stageIndex].start();
+				VocabularyHash::Matches matches;
+				vocabularyHash.matchDescriptors(descriptors.data(), queryDescriptors.data(), queryDescriptors.size(), NumericT<DistanceType>::maxValue(), matches, &worker);
+			performanceQueryStages[stageIndex].stop();
+
+			for (const VocabularyHash::Match& match : matches)
+			{
+				if (match.queryDescriptorIndex() >= numberQueryDescriptors || match.candidateDescriptorIndex() >= numberDescriptors)
+				{
+					OCEAN_SET_FAILED(validation);
+					continue;
+				}
+
+				// the reported distance must be the actual distance between both descriptors
+
+				if (match.distance() == TypeHelper::determineDistance(queryDescriptors[match.queryDescriptorIndex()], descriptors[match.candidateDescriptorIndex()]))
+				{
+					++sumValidDistances;
+				}
+
+				++sumMatches;
+
+				if (hasElement(bruteForceResult[match.queryDescriptorIndex()], match.candidateDescriptorIndex()))
+				{
+					++sumQueryDescriptorStages[stageIndex];
+				}
+			}
+
+			// the single-descriptor query must be identical to the first result of the batch query
+
+			const Index32 queryIndex = RandomI::random(randomGenerator, numberQueryDescriptors - 1u);
+
+			DistanceType distance = NumericT<DistanceType>::maxValue();
+			const Index32 candidateIndex = vocabularyHash.matchDescriptor(descriptors.data(), queryDescriptors[queryIndex], &distance);
+
+			if (candidateIndex != VocabularyHash::invalidMatchIndex())
+			{
+				OCEAN_EXPECT_EQUAL(validation, distance, TypeHelper::determineDistance(queryDescriptors[queryIndex], descriptors[candidateIndex]));
+			}
+		}
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	OCEAN_EXPECT_EQUAL(validation, sumValidDistances, sumMatches);
+
+	ocean_assert(performanceQueryBruteForce.measurements() >= 1u);
+	Log::info() << "Brute-force Performance: " << String::toAString(performanceQueryBruteForce.average(), 2u) << "s";
+	Log::info() << " ";
+
+	for (unsigned int stageIndex = 0u; stageIndex < numberStages; ++stageIndex)
+	{
+		ocean_assert(performanceQueryStages[stageIndex].measurements() >= 1u);
+		const double queryDescriptorPercent = double(sumQueryDescriptorStages[stageIndex]) / double(numberQueryDescriptors * performanceQueryStages[stageIndex].measurements());
+
+		if (queryDescriptorPercent < minimalStagePercents[stageIndex])
+		{
+			OCEAN_SET_FAILED(validation);
+		}
+
+		Log::info() << "Find query descriptors, " << stageParameters[stageIndex].numberTables_ << " tables with probe radius " << stageParameters[stageIndex].probeRadius_ << ": Found " << String::toAString(queryDescriptorPercent * 100.0, 1u) << "% descriptors";
+		Log::info() << "Construction: " << String::toAString(performanceConstruction[stageIndex].averageMseconds(), 2u) << "ms, query: " << String::toAString(performanceQueryStages[stageIndex].averageMseconds(), 2u) << "ms";
+	}
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
 Indices32 TestVocabularyTree::separateBinaryDescriptor(const BinaryDescriptor& descriptor)
 {
 	Indices32 result(descriptor.size() * 8, 0u);
@@ -141,6 +141,14 @@ class OCEAN_TEST_TRACKING_EXPORT TestVocabularyTree
 		template <DescriptorType tDescriptorType>
 		static bool testMatchingDescriptorsWithForest(const double testDuration, Worker& worker);
 
+		/**
+		 * Tests descriptor matching with a multi-probe vocabulary hash, binary descriptors only.
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @param worker The worker object to distribute the computation
+		 * @return True, if succeeded
+		 */
+		static bool testMatchingDescriptorsWithHash(const double testDuration, Worker& worker);
+
 	protected:
 
 		/**
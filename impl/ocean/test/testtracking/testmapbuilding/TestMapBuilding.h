@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#ifndef META_OCEAN_TEST_TESTTRACKING_TESTMAPBUILDING_TESTMAPBUILDING_H
+#define META_OCEAN_TEST_TESTTRACKING_TESTMAPBUILDING_TESTMAPBUILDING_H
+
+#include "ocean/test/testtracking/TestTracking.h"
+
+#include "ocean/tracking/mapbuilding/MapBuilding.h"
+
+#include "ocean/base/Worker.h"
+
+namespace Ocean
+{
+
+namespace Test
+{
+
+namespace TestTracking
+{
+
+namespace TestMapBuilding
+{
+
+/**
+ * @ingroup testtracking
+ * @defgroup testtrackingtestmapbuilding Ocean Test Tracking Map Building Library
+ * @{
+ * The Ocean Test Tracking Map Building Library provides several functions to test the performance and validation of the Ocean Tracking Map Building Library.
+ * The library is platform independent.
+ * @}
+ */
+
+/**
+ * @namespace Ocean::Test::TestTracking::TestMapBuilding Namespace of the Map Building Tracking Test library.<p>
+ * The Namespace Ocean::Test::TestTracking::TestMapBuilding is used in the entire Ocean Map Building Tracking Test Library.
+ */
+
+// Defines OCEAN_TEST_TRACKING_MAPBUILDING_EXPORT for dll export and import.
+#if defined(_WINDOWS) && defined(OCEAN_RUNTIME_SHARED)
+	#ifdef USE_OCEAN_TEST_TRACKING_MAPBUILDING_EXPORT
+		#define OCEAN_TEST_TRACKING_MAPBUILDING_EXPORT __declspec(dllexport)
+	#else
+		#define OCEAN_TEST_TRACKING_MAPBUILDING_EXPORT __declspec(dllimport)
+	#endif
+#else
+	#define OCEAN_TEST_TRACKING_MAPBUILDING_EXPORT
+#endif
+
+/**
+ * Tests the entire map building tracking library.
+ * @param testDuration Number of seconds for each test, with range (0, infinity)
+ * @param worker The worker object to distribute some computation on as many CPU cores as defined in the worker object.
+ * @param testFunctions Optional name of the functions to be tested
+ * @return True, if the entire test succeeded
+ * @ingroup testtrackingtestmapbuilding
+ */
+OCEAN_TEST_TRACKING_MAPBUILDING_EXPORT bool testMapBuilding(const double testDuration, Worker& worker, const std::string& testFunctions = std::string());
+
+/**
+ * Tests the entire map building tracking library.
+ * This function returns directly as the actual test is invoked in an own thread.<br>
+ * This function is intended for non-console applications like e.g., mobile devices.
+ * @param testDuration Number of seconds for each test, with range (0, infinity)
+ * @param testFunctions Optional name of the functions to be tested
+ * @ingroup testtrackingtestmapbuilding
+ */
+OCEAN_TEST_TRACKING_MAPBUILDING_EXPORT void testMapBuildingAsynchron(const double testDuration, const std::string& testFunctions = std::string());
+
+}
+
+}
+
+}
+
+}
+
+#endif // META_OCEAN_TEST_TESTTRACKING_TESTMAPBUILDING_TESTMAPBUILDING_H
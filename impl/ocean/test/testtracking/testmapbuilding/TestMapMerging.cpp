@@ -0,0 +1,339 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "ocean/test/testtracking/testmapbuilding/TestMapMerging.h"
+
+#include "ocean/base/Timestamp.h"
+
+#include "ocean/math/Quaternion.h"
+#include "ocean/math/Random.h"
+
+#include "ocean/test/TestResult.h"
+#include "ocean/test/Validation.h"
+
+#include "ocean/tracking/mapbuilding/MapMerging.h"
+
+namespace Ocean
+{
+
+namespace Test
+{
+
+namespace TestTracking
+{
+
+namespace TestMapBuilding
+{
+
+bool TestMapMerging::test(const double testDuration, Worker& worker, const TestSelector& selector)
+{
+	ocean_assert(testDuration > 0.0);
+
+	TestResult testResult("MapMerging test");
+	Log::info() << " ";
+
+	if (selector.shouldRun("bundleadjustmenttiled"))
+	{
+		testResult = testBundleAdjustmentTiled(testDuration, worker);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
+	Log::info() << testResult;
+
+	return testResult.succeeded();
+}
+
+#ifdef OCEAN_USE_GTEST
+
+TEST(TestMapMerging, BundleAdjustmentTiled)
+{
+	Worker worker;
+	EXPECT_TRUE(TestMapMerging::testBundleAdjustmentTiled(GTEST_TEST_DURATION, worker));
+}
+
+#endif // OCEAN_USE_GTEST
+
+bool TestMapMerging::testBundleAdjustmentTiled(const double testDuration, Worker& worker)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Testing tiled bundle adjustment:";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	const PinholeCamera pinholeCamera(640u, 480u, Numeric::deg2rad(60));
+
+	// the cameras move along the x-axis from 0.05m to 3.95m, so that a tile size of 2m separates the poses into two tiles with 30 poses each
+
+	constexpr unsigned int numberPoses = 60u;
+	constexpr Scalar trajectoryLength = Scalar(3.9);
+	constexpr Scalar tileSize = Scalar(2);
+
+	constexpr Index32 firstTileLowerPoseId = 0u;
+	constexpr Index32 firstTileUpperPoseId = numberPoses / 2u - 1u;
+	constexpr Index32 secondTileLowerPoseId = numberPoses / 2u;
+	constexpr Index32 secondTileUpperPoseId = numberPoses - 1u;
+
+	constexpr unsigned int iterations = 20u;
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		Vectors3 groundTruthObjectPoints;
+		const Tracking::Database initialDatabase = createDatabase(pinholeCamera, numberPoses, trajectoryLength, randomGenerator, groundTruthObjectPoints);
+
+		const Scalar initialError = averageSqrProjectionError(initialDatabase, pinholeCamera, firstTileLowerPoseId, secondTileUpperPoseId);
+
+		Tracking::Database globalDatabase(initialDatabase);
+
+		RandomGenerator globalRandomGenerator(randomGenerator);
+		if (!Tracking::MapBuilding::MapMerging::bundleAdjustment(globalDatabase, pinholeCamera, globalRandomGenerator, iterations))
+		{
+			OCEAN_SET_FAILED(validation);
+			continue;
+		}
+
+		size_t globalObservations = 0;
+		const Scalar globalError = averageSqrProjectionError(globalDatabase, pinholeCamera, firstTileLowerPoseId, secondTileUpperPoseId, nullptr, &globalObservations);
+
+		for (const bool useWorker : {false, true})
+		{
+			Tracking::Database tiledDatabase(initialDatabase);
+
+			RandomGenerator tiledRandomGenerator(randomGenerator);
+
+			const bool result = Tracking::MapBuilding::MapMerging::bundleAdjustmentTiled(tiledDatabase, pinholeCamera, tiledRandomGenerator, iterations, tileSize, useWorker ? &worker : nullptr);
+
+			OCEAN_EXPECT_TRUE(validation, result);
+
+			if (!result)
+			{
+				continue;
+			}
+
+			OCEAN_EXPECT_EQUAL(validation, tiledDatabase.poseNumber<false>(), size_t(numberPoses));
+
+			size_t tiledObservations = 0;
+			const Scalar tiledError = averageSqrProjectionError(tiledDatabase, pinholeCamera, firstTileLowerPoseId, secondTileUpperPoseId, nullptr, &tiledObservations);
+
+			OCEAN_EXPECT_GREATER_EQUAL(validation, tiledError, Scalar(0));
+
+			if (tiledError < Scalar(0))
+			{
+				continue;
+			}
+
+			// the tiles must not lose noticeably more observations than the global bundle adjustment
+
+			OCEAN_EXPECT_GREATER_EQUAL(validation, tiledObservations * 10, globalObservations * 9);
+
+			// the tiled bundle adjustment must reduce the projection error and must not be worse than the global bundle adjustment
+
+			OCEAN_EXPECT_LESS(validation, tiledError, initialError);
+			OCEAN_EXPECT_LESS_EQUAL(validation, tiledError, globalError + Scalar(0.05));
+
+			// object points visible in both tiles receive the location of one tile, the location must fit to the poses of the other tile as well
+
+			Indices32 sharedObjectPointIds;
+
+			for (Index32 objectPointId = 0u; objectPointId < Index32(groundTruthObjectPoints.size()); ++objectPointId)
+			{
+				if (tiledDatabase.objectPoint<false>(objectPointId) == Tracking::Database::invalidObjectPoint())
+				{
+					continue;
+				}
+
+				const IndexSet32 poseIds = tiledDatabase.posesFromObjectPoint<false>(objectPointId);
+
+				if (!poseIds.empty() && *poseIds.cbegin() <= firstTileUpperPoseId && *poseIds.crbegin() >= secondTileLowerPoseId)
+				{
+					sharedObjectPointIds.push_back(objectPointId);
+				}
+			}
+
+			OCEAN_EXPECT_GREATER_EQUAL(validation, sharedObjectPointIds.size(), size_t(20));
+
+			if (sharedObjectPointIds.empty())
+			{
+				continue;
+			}
+
+			const Scalar firstTileSharedError = averageSqrProjectionError(tiledDatabase, pinholeCamera, firstTileLowerPoseId, firstTileUpperPoseId, &sharedObjectPointIds);
+			const Scalar secondTileSharedError = averageSqrProjectionError(tiledDatabase, pinholeCamera, secondTileLowerPoseId, secondTileUpperPoseId, &sharedObjectPointIds);
+
+			// the image points are disturbed by uniform noise in the range [-0.5, 0.5], so that the expected squared error is 1/6
+
+			OCEAN_EXPECT_GREATER_EQUAL(validation, firstTileSharedError, Scalar(0));
+			OCEAN_EXPECT_GREATER_EQUAL(validation, secondTileSharedError, Scalar(0));
+
+			OCEAN_EXPECT_LESS_EQUAL(validation, firstTileSharedError, Scalar(0.25));
+			OCEAN_EXPECT_LESS_EQUAL(validation, secondTileSharedError, Scalar(0.25));
+
+			for (const Index32 objectPointId : sharedObjectPointIds)
+			{
+				// the tiles are aligned with the initial poses, so that the object points stay close to the ground truth
+
+				OCEAN_EXPECT_LESS_EQUAL(validation, tiledDatabase.objectPoint<false>(objectPointId).distance(groundTruthObjectPoints[objectPointId]), Scalar(0.25));
+			}
+		}
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
+Tracking::Database TestMapMerging::createDatabase(const PinholeCamera& pinholeCamera, const unsigned int numberPoses, const Scalar trajectoryLength, RandomGenerator& randomGenerator, Vectors3& objectPoints)
+{
+	ocean_assert(pinholeCamera.isValid());
+	ocean_assert(numberPoses >= 2u && trajectoryLength > Numeric::eps());
+
+	// the cameras are looking towards the negative z-axis, the y- and z-coordinates stay inside the first tile
+
+	HomogenousMatrices4 world_T_cameras;
+	world_T_cameras.reserve(numberPoses);
+
+	for (unsigned int n = 0u; n < numberPoses; ++n)
+	{
+		const Scalar x = Scalar(0.05) + trajectoryLength * Scalar(n) / Scalar(numberPoses - 1u);
+
+		world_T_cameras.emplace_back(Vector3(x, Random::scalar(randomGenerator, Scalar(0.9), Scalar(1.1)), Random::scalar(randomGenerator, Scalar(0.9), Scalar(1.1))), Random::euler(randomGenerator, Numeric::deg2rad(5)));
+	}
+
+	objectPoints.clear();
+
+	constexpr unsigned int numberObjectPoints = 500u;
+	constexpr Scalar border = Scalar(10);
+
+	Tracking::Database database;
+
+	for (unsigned int n = 0u; n < numberPoses; ++n)
+	{
+		// the database receives slightly disturbed poses
+
+		const HomogenousMatrix4 disturbedWorld_T_camera(world_T_cameras[n].translation() + Random::vector3(randomGenerator, Scalar(-0.02), Scalar(0.02)), world_T_cameras[n].rotation() * Quaternion(Random::euler(randomGenerator, Numeric::deg2rad(Scalar(0.5)))));
+
+		database.addPose<false>(Index32(n), disturbedWorld_T_camera);
+	}
+
+	while (objectPoints.size() < numberObjectPoints)
+	{
+		const Vector3 objectPoint = Random::vector3(randomGenerator, Scalar(-2), trajectoryLength + Scalar(2), Scalar(-1.5), Scalar(3.5), Scalar(-5), Scalar(-3));
+
+		Indices32 poseIds;
+		Vectors2 imagePoints;
+
+		for (unsigned int n = 0u; n < numberPoses; ++n)
+		{
+			const HomogenousMatrix4& world_T_camera = world_T_cameras[n];
+
+			if ((world_T_camera.inverted() * objectPoint).z() >= Scalar(0))
+			{
+				continue;
+			}
+
+			const Vector2 imagePoint = pinholeCamera.projectToImage<false>(world_T_camera, objectPoint, false) + Random::vector2(randomGenerator, Scalar(-0.5), Scalar(0.5));
+
+			if (imagePoint.x() >= border && imagePoint.y() >= border && imagePoint.x() < Scalar(pinholeCamera.width()) - border && imagePoint.y() < Scalar(pinholeCamera.height()) - border)
+			{
+				poseIds.push_back(Index32(n));
+				imagePoints.push_back(imagePoint);
+			}
+		}
+
+		if (poseIds.size() < 2)
+		{
+			continue;
+		}
+
+		// the database receives slightly disturbed object points
+
+		const Index32 objectPointId = database.addObjectPoint<false>(objectPoint + Random::vector3(randomGenerator, Scalar(-0.05), Scalar(0.05)));
+		ocean_assert_and_suppress_unused(objectPointId == Index32(objectPoints.size()), objectPointId);
+
+		objectPoints.push_back(objectPoint);
+
+		for (size_t i = 0; i < poseIds.size(); ++i)
+		{
+			const Index32 imagePointId = database.addImagePoint<false>(imagePoints[i]);
+
+			database.attachImagePointToPose<false>(imagePointId, poseIds[i]);
+			database.attachImagePointToObjectPoint<false>(imagePointId, Index32(objectPoints.size() - 1));
+		}
+	}
+
+	return database;
+}
+
+Scalar TestMapMerging::averageSqrProjectionError(const Tracking::Database& database, const PinholeCamera& pinholeCamera, const Index32 lowerPoseId, const Index32 upperPoseId, const Indices32* objectPointIds, size_t* observations)
+{
+	ocean_assert(pinholeCamera.isValid());
+	ocean_assert(lowerPoseId <= upperPoseId);
+
+	const UnorderedIndexSet32 objectPointIdSet = objectPointIds != nullptr ? UnorderedIndexSet32(objectPointIds->cbegin(), objectPointIds->cend()) : UnorderedIndexSet32();
+
+	Scalar sqrError = Scalar(0);
+	size_t measurements = 0;
+
+	for (Index32 poseId = lowerPoseId; poseId <= upperPoseId; ++poseId)
+	{
+		const HomogenousMatrix4& world_T_camera = database.pose<false>(poseId);
+
+		if (!world_T_camera.isValid())
+		{
+			continue;
+		}
+
+		const HomogenousMatrix4 flippedCamera_T_world(PinholeCamera::standard2InvertedFlipped(world_T_camera));
+
+		for (const Index32 imagePointId : database.imagePointsFromPose<false>(poseId))
+		{
+			const Index32 objectPointId = database.objectPointFromImagePoint<false>(imagePointId);
+
+			if (objectPointId == Tracking::Database::invalidId || (objectPointIds != nullptr && objectPointIdSet.find(objectPointId) == objectPointIdSet.cend()))
+			{
+				continue;
+			}
+
+			const Vector3& objectPoint = database.objectPoint<false>(objectPointId);
+
+			if (objectPoint == Tracking::Database::invalidObjectPoint())
+			{
+				continue;
+			}
+
+			sqrError += pinholeCamera.projectToImageIF<false>(flippedCamera_T_world, objectPoint, false).sqrDistance(database.imagePoint<false>(imagePointId));
+			++measurements;
+		}
+	}
+
+	if (observations != nullptr)
+	{
+		*observations = measurements;
+	}
+
+	if (measurements == 0)
+	{
+		return Scalar(-1);
+	}
+
+	return sqrError / Scalar(measurements);
+}
+
+}
+
+}
+
+}
+
+}
@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#ifndef META_OCEAN_TEST_TESTTRACKING_TESTMAPBUILDING_TEST_MAP_MERGING_H
+#define META_OCEAN_TEST_TESTTRACKING_TESTMAPBUILDING_TEST_MAP_MERGING_H
+
+#include "ocean/test/testtracking/testmapbuilding/TestMapBuilding.h"
+
+#include "ocean/base/RandomGenerator.h"
+#include "ocean/base/Worker.h"
+
+#include "ocean/math/HomogenousMatrix4.h"
+#include "ocean/math/PinholeCamera.h"
+
+#include "ocean/test/TestSelector.h"
+
+#include "ocean/tracking/Database.h"
+
+namespace Ocean
+{
+
+namespace Test
+{
+
+namespace TestTracking
+{
+
+namespace TestMapBuilding
+{
+
+/**
+ * This class implements tests for the MapMerging class.
+ * @ingroup testtrackingtestmapbuilding
+ */
+class OCEAN_TEST_TRACKING_MAPBUILDING_EXPORT TestMapMerging
+{
+	public:
+
+		/**
+		 * Invokes all tests.
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @param worker The worker object
+		 * @param selector The selector defining which tests will be executed
+		 * @return True, if succeeded
+		 */
+		static bool test(const double testDuration, Worker& worker, const TestSelector& selector);
+
+		/**
+		 * Tests the tiled bundle adjustment on a synthetic database covering two tiles.
+		 * The result is compared with the global bundle adjustment, object points visible in both tiles must fit to the poses of both tiles.
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @param worker The worker object
+		 * @return True, if succeeded
+		 */
+		static bool testBundleAdjustmentTiled(const double testDuration, Worker& worker);
+
+	protected:
+
+		/**
+		 * Creates a synthetic database with camera poses moving along the x-axis and object points in front of the cameras.
+		 * The database holds disturbed poses and object points, while the image points are the noisy projections of the ground truth.
+		 * @param pinholeCamera The camera profile to be used, must be valid
+		 * @param numberPoses The number of camera poses, with range [2, infinity)
+		 * @param trajectoryLength The length of the camera trajectory along the x-axis, in meter, with range (0, infinity)
+		 * @param randomGenerator The random generator to be used
+		 * @param objectPoints The resulting ground truth object points, the index of each object point is identical to the id of the object point in the database
+		 * @return The resulting database
+		 */
+		static Tracking::Database createDatabase(const PinholeCamera& pinholeCamera, const unsigned int numberPoses, const Scalar trajectoryLength, RandomGenerator& randomGenerator, Vectors3& objectPoints);
+
+		/**
+		 * Determines the average squared projection error between all located object points and their observations in all valid poses.
+		 * @param database The database to be used
+		 * @param pinholeCamera The camera profile which has been used, must be valid
+		 * @param lowerPoseId The id of the first pose to be used
+		 * @param upperPoseId The id of the last pose to be used (including), with range [lowerPoseId, infinity)
+		 * @param objectPointIds Optional ids of the object points to be used, nullptr to use all object points
+		 * @param observations Optional resulting number of observations which have been used
+		 * @return The average squared projection error, in pixel, -1 if no observation could be used
+		 */
+		static Scalar averageSqrProjectionError(const Tracking::Database& database, const PinholeCamera& pinholeCamera, const Index32 lowerPoseId, const Index32 upperPoseId, const Indices32* objectPointIds = nullptr, size_t* observations = nullptr);
+};
+
+}
+
+}
+
+}
+
+}
+
+#endif // META_OCEAN_TEST_TESTTRACKING_TESTMAPBUILDING_TEST_MAP_MERGING_H
@@ -0,0 +1,636 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "ocean/test/testtracking/testmapbuilding/TestRelocalizationServer.h"
+
+#include "ocean/base/RandomI.h"
+#include "ocean/base/Thread.h"
+#include "ocean/base/Timestamp.h"
+
+#include "ocean/math/Quaternion.h"
+#include "ocean/math/Random.h"
+
+#include "ocean/network/Address4.h"
+
+#include "ocean/test/TestResult.h"
+#include "ocean/test/Validation.h"
+
+#include "ocean/test/testgeometry/Utilities.h"
+
+#include "ocean/tracking/mapbuilding/Unified.h"
+#include "ocean/tracking/mapbuilding/UnifiedDescriptorMap.h"
+#include "ocean/tracking/mapbuilding/UnifiedFeatureMap.h"
+
+namespace Ocean
+{
+
+namespace Test
+{
+
+namespace TestTracking
+{
+
+namespace TestMapBuilding
+{
+
+using namespace Tracking::MapBuilding;
+
+TestRelocalizationServer::Client::Client()
+{
+	tcpClient_.setReceiveCallback(Network::PackagedTCPClient::ReceiveCallback::create(*this, &Client::onReceive));
+}
+
+bool TestRelocalizationServer::Client::connect(const Network::Port& port)
+{
+	return tcpClient_.connect(Network::Address4::localHost(), port, 5000u);
+}
+
+bool TestRelocalizationServer::Client::send(const void* data, const size_t size)
+{
+	return tcpClient_.send(data, size) == Network::PackagedTCPClient::SR_SUCCEEDED;
+}
+
+bool TestRelocalizationServer::Client::waitForResponses(const size_t numberResponses, const double timeout) const
+{
+	ocean_assert(numberResponses >= 1);
+	ocean_assert(timeout > 0.0);
+
+	const Timestamp startTimestamp(true);
+
+	while (!startTimestamp.hasTimePassed(timeout))
+	{
+		{
+			const ScopedLock scopedLock(lock_);
+
+			if (responseMap_.size() + invalidResponses_ >= numberResponses)
+			{
+				return responseMap_.size() == numberResponses;
+			}
+		}
+
+		Thread::sleep(1u);
+	}
+
+	return false;
+}
+
+bool TestRelocalizationServer::Client::response(const uint32_t requestId, RelocalizationServer::Response& response) const
+{
+	const ScopedLock scopedLock(lock_);
+
+	const ResponseMap::const_iterator iResponse = responseMap_.find(requestId);
+
+	if (iResponse == responseMap_.cend())
+	{
+		return false;
+	}
+
+	response = iResponse->second;
+
+	return true;
+}
+
+void TestRelocalizationServer::Client::onReceive(const void* data, const size_t size)
+{
+	RelocalizationServer::Response response;
+	const bool validResponse = RelocalizationServer::readResponse(data, size, response);
+
+	const ScopedLock scopedLock(lock_);
+
+	if (!validResponse || responseMap_.find(response.requestId_) != responseMap_.cend())
+	{
+		++invalidResponses_;
+		return;
+	}
+
+	responseMap_.emplace(response.requestId_, response);
+}
+
+bool TestRelocalizationServer::test(const double testDuration, Worker& worker, const TestSelector& selector)
+{
+	ocean_assert(testDuration > 0.0);
+
+	TestResult testResult("RelocalizationServer test");
+
+	Log::info() << " ";
+
+	if (selector.shouldRun("serialization"))
+	{
+		testResult = testSerialization(testDuration);
+
+		Log::info() << " ";
+	}
+
+	if (selector.shouldRun("loopback"))
+	{
+		testResult = testLoopback(testDuration, worker);
+
+		Log::info() << " ";
+	}
+
+	Log::info() << testResult;
+
+	return testResult.succeeded();
+}
+
+#ifdef OCEAN_USE_GTEST
+
+TEST(TestRelocalizationServer, Serialization)
+{
+	EXPECT_TRUE(TestRelocalizationServer::testSerialization(GTEST_TEST_DURATION));
+}
+
+TEST(TestRelocalizationServer, Loopback)
+{
+	Worker worker;
+	EXPECT_TRUE(TestRelocalizationServer::testLoopback(GTEST_TEST_DURATION, worker));
+}
+
+#endif // OCEAN_USE_GTEST
+
+bool TestRelocalizationServer::testSerialization(const double testDuration)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Serialization test:";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	const std::vector<AnyCameraType> cameraTypes = TestGeometry::Utilities::realisticCameraTypes();
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		{
+			// request
+
+			RelocalizationServer::Request request;
+
+			request.requestId_ = RandomI::random32(randomGenerator);
+			request.camera_ = TestGeometry::Utilities::realisticAnyCamera<Scalar>(RandomI::random(randomGenerator, cameraTypes), RandomI::random(randomGenerator, 1u));
+
+			if (RandomI::boolean(randomGenerator))
+			{
+				request.world_T_roughCamera_ = HomogenousMatrix4(Random::vector3(randomGenerator, Scalar(-10), Scalar(10)), Random::quaternion(randomGenerator));
+			}
+
+			const unsigned int numberFeatures = RandomI::random(randomGenerator, 1u, 500u);
+
+			for (unsigned int n = 0u; n < numberFeatures; ++n)
+			{
+				request.imagePoints_.emplace_back(Random::vector2(randomGenerator, Scalar(0), Scalar(request.camera_->width()), Scalar(0), Scalar(request.camera_->height())));
+				request.imagePointDescriptors_.emplace_back(randomDescriptor(randomGenerator, RandomI::random(randomGenerator, 1u, 3u)));
+			}
+
+			RelocalizationServer::Buffer buffer;
+
+			if (RelocalizationServer::writeRequest(request, buffer))
+			{
+				RelocalizationServer::Request readRequest;
+
+				if (RelocalizationServer::readRequest(buffer.data(), buffer.size(), readRequest))
+				{
+					OCEAN_EXPECT_EQUAL(validation, readRequest.requestId_, request.requestId_);
+
+					OCEAN_EXPECT_TRUE(validation, readRequest.camera_->isEqual(*request.camera_, Numeric::weakEps()));
+
+					OCEAN_EXPECT_EQUAL(validation, readRequest.world_T_roughCamera_.isValid(), request.world_T_roughCamera_.isValid());
+
+					if (readRequest.world_T_roughCamera_.isValid() && request.world_T_roughCamera_.isValid())
+					{
+						OCEAN_EXPECT_TRUE(validation, readRequest.world_T_roughCamera_.isEqual(request.world_T_roughCamera_, Numeric::weakEps()));
+					}
+
+					if (readRequest.imagePoints_.size() == request.imagePoints_.size() && readRequest.imagePointDescriptors_.size() == request.imagePointDescriptors_.size())
+					{
+						for (size_t n = 0; n < request.imagePoints_.size(); ++n)
+						{
+							// the image points are transmitted with 32 bit precision
+
+							OCEAN_EXPECT_TRUE(validation, readRequest.imagePoints_[n].isEqual(request.imagePoints_[n], Scalar(0.001)));
+
+							OCEAN_EXPECT_TRUE(validation, isEqual(readRequest.imagePointDescriptors_[n], request.imagePointDescriptors_[n]));
+						}
+					}
+					else
+					{
+						OCEAN_SET_FAILED(validation);
+					}
+				}
+				else
+				{
+					OCEAN_SET_FAILED(validation);
+				}
+
+				// a truncated request must be rejected
+
+				const size_t truncatedSize = RandomI::random(randomGenerator, 1u, (unsigned int)(buffer.size()) - 1u);
+
+				RelocalizationServer::Request truncatedRequest;
+				OCEAN_EXPECT_FALSE(validation, RelocalizationServer::readRequest(buffer.data(), truncatedSize, truncatedRequest));
+			}
+			else
+			{
+				OCEAN_SET_FAILED(validation);
+			}
+		}
+
+		{
+			// response
+
+			RelocalizationServer::Response response;
+
+			response.requestId_ = RandomI::random32(randomGenerator);
+			response.succeeded_ = RandomI::boolean(randomGenerator);
+
+			if (response.succeeded_)
+			{
+				response.world_T_camera_ = HomogenousMatrix4(Random::vector3(randomGenerator, Scalar(-10), Scalar(10)), Random::quaternion(randomGenerator));
+				response.numberCorrespondences_ = RandomI::random(randomGenerator, 4u, 1000u);
+			}
+
+			response.queueLatency_ = RandomD::scalar(randomGenerator, 0.0, 1.0);
+			response.computeLatency_ = RandomD::scalar(randomGenerator, 0.0, 1.0);
+
+			RelocalizationServer::Buffer buffer;
+
+			if (RelocalizationServer::writeResponse(response, buffer))
+			{
+				RelocalizationServer::Response readResponse;
+
+				if (RelocalizationServer::readResponse(buffer.data(), buffer.size(), readResponse))
+				{
+					OCEAN_EXPECT_EQUAL(validation, readResponse.requestId_, response.requestId_);
+					OCEAN_EXPECT_EQUAL(validation, readResponse.succeeded_, response.succeeded_);
+					OCEAN_EXPECT_EQUAL(validation, readResponse.world_T_camera_.isValid(), response.world_T_camera_.isValid());
+
+					if (readResponse.world_T_camera_.isValid() && response.world_T_camera_.isValid())
+					{
+						OCEAN_EXPECT_TRUE(validation, readResponse.world_T_camera_.isEqual(response.world_T_camera_, Numeric::weakEps()));
+					}
+
+					OCEAN_EXPECT_EQUAL(validation, readResponse.numberCorrespondences_, response.numberCorrespondences_);
+					OCEAN_EXPECT_EQUAL(validation, readResponse.queueLatency_, response.queueLatency_);
+					OCEAN_EXPECT_EQUAL(validation, readResponse.computeLatency_, response.computeLatency_);
+				}
+				else
+				{
+					OCEAN_SET_FAILED(validation);
+				}
+
+				const size_t truncatedSize = RandomI::random(randomGenerator, 1u, (unsigned int)(buffer.size()) - 1u);
+
+				RelocalizationServer::Response truncatedResponse;
+				OCEAN_EXPECT_FALSE(validation, RelocalizationServer::readResponse(buffer.data(), truncatedSize, truncatedResponse));
+			}
+			else
+			{
+				OCEAN_SET_FAILED(validation);
+			}
+
+			// a succeeded response without valid pose is inconsistent and must be rejected
+
+			RelocalizationServer::Response inconsistentResponse;
+			inconsistentResponse.succeeded_ = true;
+
+			if (RelocalizationServer::writeResponse(inconsistentResponse, buffer))
+			{
+				RelocalizationServer::Response readResponse;
+				OCEAN_EXPECT_FALSE(validation, RelocalizationServer::readResponse(buffer.data(), buffer.size(), readResponse));
+			}
+			else
+			{
+				OCEAN_SET_FAILED(validation);
+			}
+		}
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
+bool TestRelocalizationServer::testLoopback(const double testDuration, Worker& worker)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Loopback test:";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	constexpr unsigned int minimalNumberCorrespondences = 20u;
+	constexpr Scalar maximalProjectionError = Scalar(3.5);
+
+	constexpr Scalar maximalTranslationError = Scalar(0.05);
+	const Scalar maximalRotationError = Numeric::deg2rad(1);
+
+	const std::vector<AnyCameraType> cameraTypes = TestGeometry::Utilities::realisticCameraTypes();
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		for (const bool useWorker : {false, true})
+		{
+			const SharedAnyCamera camera = TestGeometry::Utilities::realisticAnyCamera<Scalar>(RandomI::random(randomGenerator, cameraTypes), RandomI::random(randomGenerator, 1u));
+			ocean_assert(camera);
+
+			Vectors3 objectPoints;
+			CV::Detector::FREAKDescriptors32 objectPointDescriptors;
+
+			SharedUnifiedFeatureMap featureMap = createFeatureMap(*camera, 300, randomGenerator, objectPoints, objectPointDescriptors);
+
+			const unsigned int maximalBatchSize = RandomI::random(randomGenerator, 1u, 4u);
+
+			RelocalizationServer server(std::move(featureMap), useWorker ? &worker : nullptr, maximalBatchSize);
+			OCEAN_EXPECT_TRUE(validation, server.setParameters(minimalNumberCorrespondences, maximalProjectionError));
+
+			if (!server.start())
+			{
+				OCEAN_SET_FAILED(validation);
+				break;
+			}
+
+			Client client;
+
+			if (!client.connect(server.port()))
+			{
+				OCEAN_SET_FAILED(validation);
+				break;
+			}
+
+			// the request ids start with 1, the response of an invalid request has id 0
+
+			const unsigned int numberRequests = RandomI::random(randomGenerator, 1u, 8u);
+
+			HomogenousMatrices4 world_T_cameras;
+			world_T_cameras.reserve(numberRequests);
+
+			RelocalizationServer::Buffer buffer;
+
+			for (unsigned int n = 0u; n < numberRequests; ++n)
+			{
+				const HomogenousMatrix4 world_T_camera(Random::vector3(randomGenerator, Scalar(-0.2), Scalar(0.2)), Random::euler(randomGenerator, Numeric::deg2rad(5)));
+
+				const RelocalizationServer::Request request = createRequest(n + 1u, camera, world_T_camera, objectPoints, objectPointDescriptors, randomGenerator);
+
+				world_T_cameras.push_back(world_T_camera);
+
+				if (!request.isValid() || !RelocalizationServer::writeRequest(request, buffer) || !client.send(buffer.data(), buffer.size()))
+				{
+					OCEAN_SET_FAILED(validation);
+				}
+			}
+
+			const bool sendInvalidRequest = RandomI::boolean(randomGenerator);
+
+			if (sendInvalidRequest)
+			{
+				buffer.resize(RandomI::random(randomGenerator, 1u, 1000u));
+
+				for (uint8_t& value : buffer)
+				{
+					value = uint8_t(RandomI::random(randomGenerator, 255u));
+				}
+
+				if (!client.send(buffer.data(), buffer.size()))
+				{
+					OCEAN_SET_FAILED(validation);
+				}
+			}
+
+			const size_t expectedResponses = size_t(numberRequests) + (sendInvalidRequest ? 1 : 0);
+
+			if (client.waitForResponses(expectedResponses, 30.0))
+			{
+				for (unsigned int n = 0u; n < numberRequests; ++n)
+				{
+					RelocalizationServer::Response response;
+
+					if (client.response(n + 1u, response))
+					{
+						OCEAN_EXPECT_TRUE(validation, response.succeeded_);
+
+						OCEAN_EXPECT_GREATER_EQUAL(validation, response.queueLatency_, 0.0);
+						OCEAN_EXPECT_GREATER_EQUAL(validation, response.computeLatency_, 0.0);
+
+						if (response.succeeded_)
+						{
+							OCEAN_EXPECT_GREATER_EQUAL(validation, response.numberCorrespondences_, minimalNumberCorrespondences);
+
+							const HomogenousMatrix4& world_T_camera = world_T_cameras[n];
+
+							const Scalar translationError = response.world_T_camera_.translation().distance(world_T_camera.translation());
+							const Scalar rotationError = Quaternion(response.world_T_camera_.rotation()).smallestAngle(Quaternion(world_T_camera.rotation()));
+
+							OCEAN_EXPECT_LESS_EQUAL(validation, translationError, maximalTranslationError);
+							OCEAN_EXPECT_LESS_EQUAL(validation, rotationError, maximalRotationError);
+						}
+					}
+					else
+					{
+						OCEAN_SET_FAILED(validation);
+					}
+				}
+
+				if (sendInvalidRequest)
+				{
+					RelocalizationServer::Response response;
+
+					if (client.response(0u, response))
+					{
+						OCEAN_EXPECT_FALSE(validation, response.succeeded_);
+						OCEAN_EXPECT_FALSE(validation, response.world_T_camera_.isValid());
+					}
+					else
+					{
+						OCEAN_SET_FAILED(validation);
+					}
+				}
+			}
+			else
+			{
+				OCEAN_SET_FAILED(validation);
+			}
+
+			OCEAN_EXPECT_EQUAL(validation, client.invalidResponses(), size_t(0));
+
+			OCEAN_EXPECT_TRUE(validation, server.stop());
+		}
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
+CV::Detector::FREAKDescriptor32 TestRelocalizationServer::randomDescriptor(RandomGenerator& randomGenerator, const unsigned int descriptorLevels)
+{
+	ocean_assert(descriptorLevels >= 1u && descriptorLevels <= 3u);
+
+	CV::Detector::FREAKDescriptor32::MultilevelDescriptorData descriptorData;
+
+	for (CV::Detector::FREAKDescriptor32::SinglelevelDescriptorData& levelData : descriptorData)
+	{
+		for (uint8_t& value : levelData)
+		{
+			value = uint8_t(RandomI::random(randomGenerator, 255u));
+		}
+	}
+
+	const float orientation = RandomF::scalar(randomGenerator, -NumericF::pi(), NumericF::pi());
+
+	return CV::Detector::FREAKDescriptor32(std::move(descriptorData), descriptorLevels, orientation);
+}
+
+CV::Detector::FREAKDescriptor32 TestRelocalizationServer::modifiedDescriptor(const CV::Detector::FREAKDescriptor32& descriptor, const unsigned int maximalFlippedBits, RandomGenerator& randomGenerator)
+{
+	ocean_assert(maximalFlippedBits <= 256u);
+
+	CV::Detector::FREAKDescriptor32::MultilevelDescriptorData descriptorData(descriptor.data());
+
+	for (unsigned int level = 0u; level < descriptor.descriptorLevels(); ++level)
+	{
+		const unsigned int flippedBits = RandomI::random(randomGenerator, maximalFlippedBits);
+
+		for (unsigned int n = 0u; n < flippedBits; ++n)
+		{
+			const unsigned int bit = RandomI::random(randomGenerator, 255u);
+
+			descriptorData[level][bit / 8u] ^= uint8_t(1u << (bit % 8u));
+		}
+	}
+
+	return CV::Detector::FREAKDescriptor32(std::move(descriptorData), descriptor.descriptorLevels(), descriptor.orientation());
+}
+
+SharedUnifiedFeatureMap TestRelocalizationServer::createFeatureMap(const AnyCamera& camera, const size_t numberObjectPoints, RandomGenerator& randomGenerator, Vectors3& objectPoints, CV::Detector::FREAKDescriptors32& objectPointDescriptors)
+{
+	ocean_assert(camera.isValid());
+	ocean_assert(numberObjectPoints >= 1);
+
+	objectPoints.clear();
+	objectPoints.reserve(numberObjectPoints);
+
+	objectPointDescriptors.clear();
+	objectPointDescriptors.reserve(numberObjectPoints);
+
+	Indices32 objectPointIds;
+	objectPointIds.reserve(numberObjectPoints);
+
+	UnifiedDescriptorMapFreakMultiLevelMultiViewDescriptor256::DescriptorMap descriptorMap;
+
+	const Scalar border = Scalar(std::min(camera.width(), camera.height())) * Scalar(0.05);
+
+	for (size_t n = 0; n < numberObjectPoints; ++n)
+	{
+		// the object points are located in front of a camera with identity pose, the camera is looking towards the negative z-space
+
+		const Vector2 imagePoint = Random::vector2(randomGenerator, border, Scalar(camera.width()) - border, border, Scalar(camera.height()) - border);
+		const Scalar distance = Random::scalar(randomGenerator, Scalar(2), Scalar(6));
+
+		objectPoints.push_back(camera.vector(imagePoint) * distance);
+		objectPointDescriptors.push_back(randomDescriptor(randomGenerator));
+
+		const Index32 objectPointId = Index32(n);
+
+		objectPointIds.push_back(objectPointId);
+		descriptorMap[objectPointId] = CV::Detector::FREAKDescriptors32(1, objectPointDescriptors.back());
+	}
+
+	using ImagePointDescriptor = UnifiedDescriptor::FreakMultiDescriptor256;
+	using ObjectPointDescriptor = UnifiedDescriptor::FreakMultiDescriptors256;
+	using ObjectPointVocabularyDescriptor = UnifiedDescriptor::BinaryDescriptor<256u>;
+
+	using UnifiedFeatureMap = UnifiedFeatureMapT<ImagePointDescriptor, ObjectPointDescriptor, ObjectPointVocabularyDescriptor>;
+
+	SharedUnifiedDescriptorMap unifiedDescriptorMap = std::make_shared<UnifiedDescriptorMapFreakMultiLevelMultiViewDescriptor256>(std::move(descriptorMap));
+
+	return std::make_shared<UnifiedFeatureMap>(Vectors3(objectPoints), std::move(objectPointIds), std::move(unifiedDescriptorMap), randomGenerator, &UnifiedFeatureMap::VocabularyForest::TVocabularyTree::determineClustersMeanForBinaryDescriptor<256u>, &UnifiedHelperFreakMultiDescriptor256::extractVocabularyDescriptorsFromMap);
+}
+
+RelocalizationServer::Request TestRelocalizationServer::createRequest(const uint32_t requestId, const SharedAnyCamera& camera, const HomogenousMatrix4& world_T_camera, const Vectors3& objectPoints, const CV::Detector::FREAKDescriptors32& objectPointDescriptors, RandomGenerator& randomGenerator)
+{
+	ocean_assert(camera && camera->isValid());
+	ocean_assert(world_T_camera.isValid());
+	ocean_assert(objectPoints.size() == objectPointDescriptors.size());
+
+	const HomogenousMatrix4 flippedCamera_T_world(Camera::standard2InvertedFlipped(world_T_camera));
+
+	RelocalizationServer::Request request;
+
+	request.requestId_ = requestId;
+	request.camera_ = camera;
+
+	for (size_t n = 0; n < objectPoints.size(); ++n)
+	{
+		const Vector3& objectPoint = objectPoints[n];
+
+		if (!Camera::isObjectPointInFrontIF(flippedCamera_T_world, objectPoint))
+		{
+			continue;
+		}
+
+		const Vector2 imagePoint = camera->projectToImageIF(flippedCamera_T_world, objectPoint) + Random::vector2(randomGenerator, Scalar(-0.5), Scalar(0.5));
+
+		if (camera->isInside(imagePoint))
+		{
+			// the image point descriptor differs from the object point descriptor, as if the feature had been observed from a slightly different viewpoint
+
+			request.imagePoints_.push_back(imagePoint);
+			request.imagePointDescriptors_.push_back(modifiedDescriptor(objectPointDescriptors[n], 10u, randomGenerator));
+		}
+	}
+
+	if (request.imagePoints_.size() < 50)
+	{
+		return RelocalizationServer::Request();
+	}
+
+	// 20% of the image points are outliers
+
+	const size_t numberOutliers = request.imagePoints_.size() / 4;
+
+	for (size_t n = 0; n < numberOutliers; ++n)
+	{
+		request.imagePoints_.push_back(Random::vector2(randomGenerator, Scalar(0), Scalar(camera->width()), Scalar(0), Scalar(camera->height())));
+		request.imagePointDescriptors_.push_back(randomDescriptor(randomGenerator));
+	}
+
+	return request;
+}
+
+bool TestRelocalizationServer::isEqual(const CV::Detector::FREAKDescriptor32& descriptorA, const CV::Detector::FREAKDescriptor32& descriptorB)
+{
+	if (descriptorA.descriptorLevels() != descriptorB.descriptorLevels() || descriptorA.orientation() != descriptorB.orientation())
+	{
+		return false;
+	}
+
+	for (unsigned int level = 0u; level < descriptorA.descriptorLevels(); ++level)
+	{
+		if (descriptorA.data()[level] != descriptorB.data()[level])
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+}
+
+}
+
+}
+
+}
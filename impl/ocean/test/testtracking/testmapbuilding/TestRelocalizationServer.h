@@ -0,0 +1,218 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#ifndef META_OCEAN_TEST_TESTTRACKING_TESTMAPBUILDING_TEST_RELOCALIZATION_SERVER_H
+#define META_OCEAN_TEST_TESTTRACKING_TESTMAPBUILDING_TEST_RELOCALIZATION_SERVER_H
+
+#include "ocean/test/testtracking/testmapbuilding/TestMapBuilding.h"
+
+#include "ocean/base/Lock.h"
+#include "ocean/base/RandomGenerator.h"
+#include "ocean/base/Worker.h"
+
+#include "ocean/network/PackagedTCPClient.h"
+
+#include "ocean/tracking/mapbuilding/RelocalizationServer.h"
+
+#include "ocean/test/TestSelector.h"
+
+#include <unordered_map>
+
+namespace Ocean
+{
+
+namespace Test
+{
+
+namespace TestTracking
+{
+
+namespace TestMapBuilding
+{
+
+/**
+ * This class implements tests for the RelocalizationServer.
+ * @ingroup testtrackingtestmapbuilding
+ */
+class OCEAN_TEST_TRACKING_MAPBUILDING_EXPORT TestRelocalizationServer
+{
+	protected:
+
+		/**
+		 * This class implements a client sending requests to the server on the local host and collecting the responses.
+		 */
+		class Client
+		{
+			protected:
+
+				/**
+				 * Definition of an unordered map mapping request ids to responses.
+				 */
+				using ResponseMap = std::unordered_map<uint32_t, Tracking::MapBuilding::RelocalizationServer::Response>;
+
+			public:
+
+				/**
+				 * Creates a new client.
+				 */
+				Client();
+
+				/**
+				 * Connects the client with a server on the local host.
+				 * @param port The port of the server, must be valid
+				 * @return True, if succeeded
+				 */
+				bool connect(const Network::Port& port);
+
+				/**
+				 * Sends data to the server.
+				 * @param data The data to send, must be valid
+				 * @param size The number of bytes to send, with range [1, infinity)
+				 * @return True, if succeeded
+				 */
+				bool send(const void* data, const size_t size);
+
+				/**
+				 * Waits until a specified number of responses has been received.
+				 * @param numberResponses The number of responses to wait for, with range [1, infinity)
+				 * @param timeout The maximal time to wait, in seconds, with range (0, infinity)
+				 * @return True, if all responses have been received in time
+				 */
+				bool waitForResponses(const size_t numberResponses, const double timeout) const;
+
+				/**
+				 * Returns the response for a specific request.
+				 * @param requestId The id of the request for which the response will be returned
+				 * @param response The resulting response
+				 * @return True, if the response exists
+				 */
+				bool response(const uint32_t requestId, Tracking::MapBuilding::RelocalizationServer::Response& response) const;
+
+				/**
+				 * Returns the number of received responses which could not be parsed or which belong to the same request as a previous response.
+				 * @return The number of invalid responses
+				 */
+				inline size_t invalidResponses() const;
+
+			protected:
+
+				/**
+				 * Event function for received data.
+				 * @param data The received data
+				 * @param size The number of received bytes
+				 */
+				void onReceive(const void* data, const size_t size);
+
+			protected:
+
+				/// The received responses.
+				ResponseMap responseMap_;
+
+				/// The number of invalid responses.
+				size_t invalidResponses_ = 0;
+
+				/// The client's lock.
+				mutable Lock lock_;
+
+				/// The TCP client, declared last so that the connection is closed before the remaining members are destructed.
+				Network::PackagedTCPClient tcpClient_;
+		};
+
+	public:
+
+		/**
+		 * Tests all RelocalizationServer functions.
+		 * @param testDuration The number of seconds for each test, with range (0, infinity)
+		 * @param worker The worker to be used
+		 * @param selector The selector defining which tests to run
+		 * @return True, if succeeded
+		 */
+		static bool test(const double testDuration, Worker& worker, const TestSelector& selector);
+
+		/**
+		 * Tests writing and reading requests and responses.
+		 * @param testDuration The number of seconds for each test, with range (0, infinity)
+		 * @return True, if succeeded
+		 */
+		static bool testSerialization(const double testDuration);
+
+		/**
+		 * Tests the round trip of requests sent to a server on the local host, with and without worker.
+		 * The server relocalizes the cameras of the requests in a synthetic feature map, invalid requests must result in failed responses.
+		 * @param testDuration The number of seconds for each test, with range (0, infinity)
+		 * @param worker The worker to be used
+		 * @return True, if succeeded
+		 */
+		static bool testLoopback(const double testDuration, Worker& worker);
+
+	protected:
+
+		/**
+		 * Creates a random multi-level FREAK descriptor.
+		 * @param randomGenerator The random generator to be used
+		 * @param descriptorLevels The number of descriptor levels, with range [1, 3]
+		 * @return The resulting descriptor
+		 */
+		static CV::Detector::FREAKDescriptor32 randomDescriptor(RandomGenerator& randomGenerator, const unsigned int descriptorLevels = 3u);
+
+		/**
+		 * Creates a copy of a descriptor with a few random bits flipped on each level.
+		 * @param descriptor The descriptor to copy
+		 * @param maximalFlippedBits The maximal number of bits to flip on each level, with range [0, 256]
+		 * @param randomGenerator The random generator to be used
+		 * @return The resulting descriptor
+		 */
+		static CV::Detector::FREAKDescriptor32 modifiedDescriptor(const CV::Detector::FREAKDescriptor32& descriptor, const unsigned int maximalFlippedBits, RandomGenerator& randomGenerator);
+
+		/**
+		 * Creates a synthetic feature map with random 3D object points located in front of a camera with identity pose, each object point has random descriptors.
+		 * @param camera The camera profile, must be valid
+		 * @param numberObjectPoints The number of object points, with range [1, infinity)
+		 * @param randomGenerator The random generator to be used
+		 * @param objectPoints The resulting 3D object points
+		 * @param objectPointDescriptors The resulting descriptors, one for each object point
+		 * @return The resulting feature map
+		 */
+		static Tracking::MapBuilding::SharedUnifiedFeatureMap createFeatureMap(const AnyCamera& camera, const size_t numberObjectPoints, RandomGenerator& randomGenerator, Vectors3& objectPoints, CV::Detector::FREAKDescriptors32& objectPointDescriptors);
+
+		/**
+		 * Creates a request for a camera observing the object points of a feature map, some image points are outliers.
+		 * @param requestId The id of the request
+		 * @param camera The camera profile, must be valid
+		 * @param world_T_camera The pose of the camera, must be valid
+		 * @param objectPoints The 3D object points of the feature map
+		 * @param objectPointDescriptors The descriptors of the object points, one for each object point
+		 * @param randomGenerator The random generator to be used
+		 * @return The resulting request, invalid if too few object points are visible
+		 */
+		static Tracking::MapBuilding::RelocalizationServer::Request createRequest(const uint32_t requestId, const SharedAnyCamera& camera, const HomogenousMatrix4& world_T_camera, const Vectors3& objectPoints, const CV::Detector::FREAKDescriptors32& objectPointDescriptors, RandomGenerator& randomGenerator);
+
+		/**
+		 * Returns whether two descriptors are identical.
+		 * @param descriptorA The first descriptor
+		 * @param descriptorB The second descriptor
+		 * @return True, if so
+		 */
+		static bool isEqual(const CV::Detector::FREAKDescriptor32& descriptorA, const CV::Detector::FREAKDescriptor32& descriptorB);
+};
+
+inline size_t TestRelocalizationServer::Client::invalidResponses() const
+{
+	const ScopedLock scopedLock(lock_);
+
+	return invalidResponses_;
+}
+
+}
+
+}
+
+}
+
+}
+
+#endif // META_OCEAN_TEST_TESTTRACKING_TESTMAPBUILDING_TEST_RELOCALIZATION_SERVER_H
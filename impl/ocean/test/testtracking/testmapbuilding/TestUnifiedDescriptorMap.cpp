@@ -0,0 +1,404 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "ocean/test/testtracking/testmapbuilding/TestUnifiedDescriptorMap.h"
+
+#include "ocean/base/RandomI.h"
+#include "ocean/base/Timestamp.h"
+
+#include "ocean/math/Random.h"
+
+#include "ocean/test/TestResult.h"
+#include "ocean/test/Validation.h"
+
+namespace Ocean
+{
+
+namespace Test
+{
+
+namespace TestTracking
+{
+
+namespace TestMapBuilding
+{
+
+using namespace Tracking::MapBuilding;
+
+bool TestUnifiedDescriptorMap::test(const double testDuration, Worker& worker, const TestSelector& selector)
+{
+	ocean_assert(testDuration > 0.0);
+
+	TestResult testResult("UnifiedDescriptorMap test");
+	Log::info() << " ";
+
+	if (selector.shouldRun("compactfreakmap"))
+	{
+		testResult = testCompactFreakMap(testDuration, worker);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
+	if (selector.shouldRun("compactfloatmap"))
+	{
+		testResult = testCompactFloatMap(testDuration, worker);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
+	Log::info() << testResult;
+
+	return testResult.succeeded();
+}
+
+#ifdef OCEAN_USE_GTEST
+
+TEST(TestUnifiedDescriptorMap, CompactFreakMap)
+{
+	Worker worker;
+	EXPECT_TRUE(TestUnifiedDescriptorMap::testCompactFreakMap(GTEST_TEST_DURATION, worker));
+}
+
+TEST(TestUnifiedDescriptorMap, CompactFloatMap)
+{
+	Worker worker;
+	EXPECT_TRUE(TestUnifiedDescriptorMap::testCompactFloatMap(GTEST_TEST_DURATION, worker));
+}
+
+#endif // OCEAN_USE_GTEST
+
+bool TestUnifiedDescriptorMap::testCompactFreakMap(const double testDuration, Worker& worker)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Testing compact() for a map with FREAK descriptors:";
+
+	return testCompact<UnifiedDescriptorMapFreakMultiLevelMultiViewDescriptor256>(testDuration, worker);
+}
+
+bool TestUnifiedDescriptorMap::testCompactFloatMap(const double testDuration, Worker& worker)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Testing compact() for a map with float descriptors:";
+
+	return testCompact<FloatDescriptorMap>(testDuration, worker);
+}
+
+template <typename TDescriptorMap>
+bool TestUnifiedDescriptorMap::testCompact(const double testDuration, Worker& worker)
+{
+	ocean_assert(testDuration > 0.0);
+
+	using Descriptor = typename TDescriptorMap::Descriptor;
+	using DescriptorMap = typename TDescriptorMap::DescriptorMap;
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		// the worker is used for maps with at least 1000 object points only
+
+		const bool largeMap = RandomI::random(randomGenerator, 9u) == 0u;
+
+		const unsigned int numberObjectPoints = largeMap ? RandomI::random(randomGenerator, 1000u, 1100u) : RandomI::random(randomGenerator, 1u, 50u);
+		const unsigned int maximalNumberDescriptors = largeMap ? 6u : 20u;
+
+		const size_t maximalDescriptorsPerObjectPoint = size_t(RandomI::random(randomGenerator, 1u, 5u));
+
+		DescriptorMap descriptorMap;
+
+		while (descriptorMap.size() < size_t(numberObjectPoints))
+		{
+			const Index32 objectPointId = RandomI::random32(randomGenerator);
+
+			if (descriptorMap.find(objectPointId) == descriptorMap.cend())
+			{
+				createDescriptors(size_t(RandomI::random(randomGenerator, 1u, maximalNumberDescriptors)), randomGenerator, descriptorMap[objectPointId]);
+			}
+		}
+
+		const DescriptorMap copyDescriptorMap(descriptorMap);
+
+		size_t expectedRemovedDescriptors = 0;
+
+		for (typename DescriptorMap::const_iterator iMap = copyDescriptorMap.cbegin(); iMap != copyDescriptorMap.cend(); ++iMap)
+		{
+			if (iMap->second.size() > maximalDescriptorsPerObjectPoint)
+			{
+				expectedRemovedDescriptors += iMap->second.size() - maximalDescriptorsPerObjectPoint;
+			}
+		}
+
+		TDescriptorMap unifiedDescriptorMap(std::move(descriptorMap));
+
+		const size_t trackedMemoryBeforeCompaction = unifiedDescriptorMap.trackedMemory();
+
+		const bool useWorker = RandomI::boolean(randomGenerator);
+
+		const size_t removedDescriptors = unifiedDescriptorMap.compact(maximalDescriptorsPerObjectPoint, useWorker ? &worker : nullptr);
+
+		OCEAN_EXPECT_EQUAL(validation, removedDescriptors, expectedRemovedDescriptors);
+
+		OCEAN_EXPECT_LESS_EQUAL(validation, unifiedDescriptorMap.trackedMemory(), trackedMemoryBeforeCompaction);
+
+		// all object points must still exist
+
+		OCEAN_EXPECT_EQUAL(validation, unifiedDescriptorMap.numberObjectPoints(), size_t(numberObjectPoints));
+
+		Indices32 objectPointIds = unifiedDescriptorMap.objectPointIds();
+		std::sort(objectPointIds.begin(), objectPointIds.end());
+
+		Indices32 expectedObjectPointIds;
+		expectedObjectPointIds.reserve(copyDescriptorMap.size());
+
+		for (typename DescriptorMap::const_iterator iMap = copyDescriptorMap.cbegin(); iMap != copyDescriptorMap.cend(); ++iMap)
+		{
+			expectedObjectPointIds.push_back(iMap->first);
+		}
+
+		std::sort(expectedObjectPointIds.begin(), expectedObjectPointIds.end());
+
+		OCEAN_EXPECT_TRUE(validation, objectPointIds == expectedObjectPointIds);
+
+		for (typename DescriptorMap::const_iterator iMap = copyDescriptorMap.cbegin(); iMap != copyDescriptorMap.cend(); ++iMap)
+		{
+			const Descriptor& originalDescriptors = iMap->second;
+
+			const typename DescriptorMap::const_iterator iCompacted = unifiedDescriptorMap.descriptorMap().find(iMap->first);
+
+			if (iCompacted == unifiedDescriptorMap.descriptorMap().cend())
+			{
+				OCEAN_SET_FAILED(validation);
+				continue;
+			}
+
+			const Descriptor& compactedDescriptors = iCompacted->second;
+
+			OCEAN_EXPECT_EQUAL(validation, unifiedDescriptorMap.numberDescriptors(iMap->first), compactedDescriptors.size());
+
+			if (originalDescriptors.size() <= maximalDescriptorsPerObjectPoint)
+			{
+				// the object point keeps all of its descriptors
+
+				if (compactedDescriptors.size() == originalDescriptors.size())
+				{
+					for (size_t n = 0; n < originalDescriptors.size(); ++n)
+					{
+						OCEAN_EXPECT_TRUE(validation, isEqual(compactedDescriptors[n], originalDescriptors[n]));
+					}
+				}
+				else
+				{
+					OCEAN_SET_FAILED(validation);
+				}
+
+				continue;
+			}
+
+			if (compactedDescriptors.size() != maximalDescriptorsPerObjectPoint)
+			{
+				OCEAN_SET_FAILED(validation);
+				continue;
+			}
+
+			const size_t size = originalDescriptors.size();
+
+			std::vector<double> distances(size * size, 0.0);
+
+			for (size_t a = 0; a < size; ++a)
+			{
+				for (size_t b = 0; b < size; ++b)
+				{
+					distances[a * size + b] = determineDistance(originalDescriptors[a], originalDescriptors[b]);
+				}
+			}
+
+			// each medoid must be one of the original descriptors, and must be the best choice given the medoids selected before
+
+			std::vector<double> closestDistances(size, NumericD::maxValue());
+			std::vector<uint8_t> isMedoid(size, 0u);
+
+			for (size_t nMedoid = 0; nMedoid < compactedDescriptors.size(); ++nMedoid)
+			{
+				Index32 medoidIndex = Index32(-1);
+
+				for (size_t n = 0; n < size; ++n)
+				{
+					if (isMedoid[n] == 0u && isEqual(compactedDescriptors[nMedoid], originalDescriptors[n]))
+					{
+						medoidIndex = Index32(n);
+						break;
+					}
+				}
+
+				if (medoidIndex == Index32(-1))
+				{
+					OCEAN_SET_FAILED(validation);
+					break;
+				}
+
+				double bestCost = NumericD::maxValue();
+				double medoidCost = NumericD::maxValue();
+
+				for (size_t candidate = 0; candidate < size; ++candidate)
+				{
+					if (isMedoid[candidate] != 0u)
+					{
+						continue;
+					}
+
+					double cost = 0.0;
+
+					for (size_t n = 0; n < size; ++n)
+					{
+						cost += std::min(closestDistances[n], distances[candidate * size + n]);
+					}
+
+					bestCost = std::min(bestCost, cost);
+
+					if (candidate == size_t(medoidIndex))
+					{
+						medoidCost = cost;
+					}
+				}
+
+				// float distances may be determined with slightly different precision
+
+				OCEAN_EXPECT_LESS_EQUAL(validation, medoidCost, bestCost + bestCost * 0.0001 + 0.0001);
+
+				isMedoid[medoidIndex] = 1u;
+
+				for (size_t n = 0; n < size; ++n)
+				{
+					closestDistances[n] = std::min(closestDistances[n], distances[size_t(medoidIndex) * size + n]);
+				}
+			}
+		}
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
+void TestUnifiedDescriptorMap::createDescriptors(const size_t numberDescriptors, RandomGenerator& randomGenerator, UnifiedDescriptor::FreakMultiDescriptors256& descriptors)
+{
+	ocean_assert(numberDescriptors >= 1);
+
+	using FreakDescriptor = UnifiedDescriptor::FreakMultiDescriptor256;
+
+	FreakDescriptor::MultilevelDescriptorData commonData;
+
+	for (FreakDescriptor::SinglelevelDescriptorData& levelData : commonData)
+	{
+		for (uint8_t& value : levelData)
+		{
+			value = uint8_t(RandomI::random(randomGenerator, 255u));
+		}
+	}
+
+	const unsigned int levels = RandomI::random(randomGenerator, 1u, 3u);
+
+	descriptors.clear();
+	descriptors.reserve(numberDescriptors);
+
+	while (descriptors.size() < numberDescriptors)
+	{
+		FreakDescriptor::MultilevelDescriptorData data(commonData);
+
+		// most descriptors are modified by a few bits, some descriptors are outliers
+
+		const unsigned int modifiedBits = RandomI::random(randomGenerator, 9u) == 0u ? 128u : RandomI::random(randomGenerator, 0u, 20u);
+
+		for (unsigned int n = 0u; n < modifiedBits; ++n)
+		{
+			const unsigned int bit = RandomI::random(randomGenerator, 255u);
+
+			for (FreakDescriptor::SinglelevelDescriptorData& levelData : data)
+			{
+				levelData[bit / 8u] ^= uint8_t(1u << (bit % 8u));
+			}
+		}
+
+		descriptors.emplace_back(std::move(data), levels, RandomF::scalar(randomGenerator, -NumericF::pi(), NumericF::pi()));
+	}
+}
+
+void TestUnifiedDescriptorMap::createDescriptors(const size_t numberDescriptors, RandomGenerator& randomGenerator, FloatDescriptorMap::Descriptor& descriptors)
+{
+	ocean_assert(numberDescriptors >= 1);
+
+	FloatDescriptorMap::SingleDescriptor commonDescriptor;
+
+	for (float& value : commonDescriptor)
+	{
+		value = RandomF::scalar(randomGenerator, -1.0f, 1.0f);
+	}
+
+	descriptors.clear();
+	descriptors.reserve(numberDescriptors);
+
+	while (descriptors.size() < numberDescriptors)
+	{
+		FloatDescriptorMap::SingleDescriptor descriptor(commonDescriptor);
+
+		// most descriptors are slightly noisy, some descriptors are outliers
+
+		const float sigma = RandomI::random(randomGenerator, 9u) == 0u ? 1.0f : RandomF::scalar(randomGenerator, 0.0f, 0.1f);
+
+		for (float& value : descriptor)
+		{
+			value += RandomF::gaussianNoise(randomGenerator, std::max(sigma, NumericF::weakEps()));
+		}
+
+		descriptors.push_back(descriptor);
+	}
+}
+
+double TestUnifiedDescriptorMap::determineDistance(const UnifiedDescriptor::FreakMultiDescriptor256& descriptorA, const UnifiedDescriptor::FreakMultiDescriptor256& descriptorB)
+{
+	return double(UnifiedDescriptorT<UnifiedDescriptor::FreakMultiDescriptor256>::determineDistance(descriptorA, descriptorB));
+}
+
+double TestUnifiedDescriptorMap::determineDistance(const FloatDescriptorMap::SingleDescriptor& descriptorA, const FloatDescriptorMap::SingleDescriptor& descriptorB)
+{
+	double sqrDistance = 0.0;
+
+	for (size_t n = 0; n < descriptorA.size(); ++n)
+	{
+		sqrDistance += NumericD::sqr(double(descriptorA[n]) - double(descriptorB[n]));
+	}
+
+	return sqrDistance;
+}
+
+bool TestUnifiedDescriptorMap::isEqual(const UnifiedDescriptor::FreakMultiDescriptor256& descriptorA, const UnifiedDescriptor::FreakMultiDescriptor256& descriptorB)
+{
+	return descriptorA.descriptorLevels() == descriptorB.descriptorLevels() && descriptorA.orientation() == descriptorB.orientation() && descriptorA.data() == descriptorB.data();
+}
+
+bool TestUnifiedDescriptorMap::isEqual(const FloatDescriptorMap::SingleDescriptor& descriptorA, const FloatDescriptorMap::SingleDescriptor& descriptorB)
+{
+	return descriptorA == descriptorB;
+}
+
+}
+
+}
+
+}
+
+}
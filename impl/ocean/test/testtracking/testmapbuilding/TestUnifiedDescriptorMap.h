@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#ifndef META_OCEAN_TEST_TESTTRACKING_TESTMAPBUILDING_TEST_UNIFIED_DESCRIPTOR_MAP_H
+#define META_OCEAN_TEST_TESTTRACKING_TESTMAPBUILDING_TEST_UNIFIED_DESCRIPTOR_MAP_H
+
+#include "ocean/test/testtracking/testmapbuilding/TestMapBuilding.h"
+
+#include "ocean/base/RandomGenerator.h"
+#include "ocean/base/Worker.h"
+
+#include "ocean/test/TestSelector.h"
+
+#include "ocean/tracking/mapbuilding/UnifiedDescriptorMap.h"
+
+namespace Ocean
+{
+
+namespace Test
+{
+
+namespace TestTracking
+{
+
+namespace TestMapBuilding
+{
+
+/**
+ * This class implements tests for the UnifiedDescriptorMap class.
+ * @ingroup testtrackingtestmapbuilding
+ */
+class OCEAN_TEST_TRACKING_MAPBUILDING_EXPORT TestUnifiedDescriptorMap
+{
+	protected:
+
+		/**
+		 * Definition of the float descriptor map which is tested.
+		 */
+		using FloatDescriptorMap = Tracking::MapBuilding::UnifiedDescriptorMapFloatSingleLevelMultiViewDescriptor<128u>;
+
+	public:
+
+		/**
+		 * Invokes all tests.
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @param worker The worker object
+		 * @param selector The selector defining which tests will be executed
+		 * @return True, if succeeded
+		 */
+		static bool test(const double testDuration, Worker& worker, const TestSelector& selector);
+
+		/**
+		 * Tests the compaction of a small map with multi-level multi-view FREAK descriptors.
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @param worker The worker object
+		 * @return True, if succeeded
+		 */
+		static bool testCompactFreakMap(const double testDuration, Worker& worker);
+
+		/**
+		 * Tests the compaction of a small map with single-level multi-view float descriptors.
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @param worker The worker object
+		 * @return True, if succeeded
+		 */
+		static bool testCompactFloatMap(const double testDuration, Worker& worker);
+
+	protected:
+
+		/**
+		 * Tests the compaction of a small map.
+		 * The map keeps the ids of all object points, object points with many descriptors keep the greedily selected medoids only.
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @param worker The worker object
+		 * @return True, if succeeded
+		 * @tparam TDescriptorMap The data type of the descriptor map
+		 */
+		template <typename TDescriptorMap>
+		static bool testCompact(const double testDuration, Worker& worker);
+
+		/**
+		 * Creates random FREAK descriptors of one object point, most descriptors are slightly modified versions of one common descriptor.
+		 * @param numberDescriptors The number of descriptors to create, with range [1, infinity)
+		 * @param randomGenerator The random generator to be used
+		 * @param descriptors The resulting descriptors
+		 */
+		static void createDescriptors(const size_t numberDescriptors, RandomGenerator& randomGenerator, Tracking::MapBuilding::UnifiedDescriptor::FreakMultiDescriptors256& descriptors);
+
+		/**
+		 * Creates random float descriptors of one object point, most descriptors are slightly modified versions of one common descriptor.
+		 * @param numberDescriptors The number of descriptors to create, with range [1, infinity)
+		 * @param randomGenerator The random generator to be used
+		 * @param descriptors The resulting descriptors
+		 */
+		static void createDescriptors(const size_t numberDescriptors, RandomGenerator& randomGenerator, FloatDescriptorMap::Descriptor& descriptors);
+
+		/**
+		 * Returns the distance between two FREAK descriptors.
+		 * @param descriptorA The first descriptor
+		 * @param descriptorB The second descriptor
+		 * @return The Hamming distance between both descriptors
+		 */
+		static double determineDistance(const Tracking::MapBuilding::UnifiedDescriptor::FreakMultiDescriptor256& descriptorA, const Tracking::MapBuilding::UnifiedDescriptor::FreakMultiDescriptor256& descriptorB);
+
+		/**
+		 * Returns the distance between two float descriptors.
+		 * @param descriptorA The first descriptor
+		 * @param descriptorB The second descriptor
+		 * @return The square distance between both descriptors
+		 */
+		static double determineDistance(const FloatDescriptorMap::SingleDescriptor& descriptorA, const FloatDescriptorMap::SingleDescriptor& descriptorB);
+
+		/**
+		 * Returns whether two FREAK descriptors are identical.
+		 * @param descriptorA The first descriptor
+		 * @param descriptorB The second descriptor
+		 * @return True, if so
+		 */
+		static bool isEqual(const Tracking::MapBuilding::UnifiedDescriptor::FreakMultiDescriptor256& descriptorA, const Tracking::MapBuilding::UnifiedDescriptor::FreakMultiDescriptor256& descriptorB);
+
+		/**
+		 * Returns whether two float descriptors are identical.
+		 * @param descriptorA The first descriptor
+		 * @param descriptorB The second descriptor
+		 * @return True, if so
+		 */
+		static bool isEqual(const FloatDescriptorMap::SingleDescriptor& descriptorA, const FloatDescriptorMap::SingleDescriptor& descriptorB);
+};
+
+}
+
+}
+
+}
+
+}
+
+#endif // META_OCEAN_TEST_TESTTRACKING_TESTMAPBUILDING_TEST_UNIFIED_DESCRIPTOR_MAP_H
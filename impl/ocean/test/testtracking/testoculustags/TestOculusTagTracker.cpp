@@ -50,6 +50,15 @@ bool TestOculusTagTracker::test(const double testDuration, Worker& worker, const
 		Log::info() << " ";
 	}
 
+	if (selector.shouldRun("detectiontile"))
+	{
+		testResult = testDetectionTile(testDuration);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
 	Log::info() << testResult;
 
 	return testResult.succeeded();
@@ -76,6 +85,11 @@ TEST(TestOculusTags, OculusTagTrackerStressTestNegative)
 	EXPECT_TRUE(TestOculusTagTracker::testStressTestNegative(GTEST_TEST_DURATION, worker));
 }
 
+TEST(TestOculusTags, OculusTagTrackerDetectionTile)
+{
+	EXPECT_TRUE(TestOculusTagTracker::testDetectionTile(GTEST_TEST_DURATION));
+}
+
 #endif // OCEAN_USE_GTEST
 
 bool TestOculusTagTracker::testStressTestNegative(const double testDuration, Worker& /*worker*/)
@@ -98,6 +112,7 @@ bool TestOculusTagTracker::testStressTestNegative(const double testDuration, Wor
 		const SharedAnyCamera anyCameraB = Test::TestGeometry::Utilities::realisticAnyCamera(AnyCameraType::FISHEYE, RandomI::random(randomGenerator, 1u));
 
 		OculusTagTracker oculusTagTracker;
+		oculusTagTracker.setDetectionMode(RandomI::boolean(randomGenerator) ? OculusTagTracker::DM_FULL_FRAME : OculusTagTracker::DM_PREDICTED_REGIONS);
 
 		const unsigned int frameNumbers = RandomI::random(randomGenerator, 1u, 5u);
 
@@ -135,6 +150,68 @@ bool TestOculusTagTracker::testStressTestNegative(const double testDuration, Wor
 	return validation.succeeded();
 }
 
+bool TestOculusTagTracker::testDetectionTile(const double testDuration)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Detection tile test:";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		const unsigned int width = RandomI::random(randomGenerator, 1u, 1920u);
+		const unsigned int numberTiles = RandomI::random(randomGenerator, 1u, 10u);
+		const unsigned int height = RandomI::random(randomGenerator, numberTiles, 1080u);
+
+		CV::PixelBoundingBoxes tiles;
+
+		for (unsigned int tileIndex = 0u; tileIndex < numberTiles; ++tileIndex)
+		{
+			const CV::PixelBoundingBox tile = detectionTile(width, height, tileIndex, numberTiles);
+
+			OCEAN_EXPECT_TRUE(validation, tile.isValid());
+			OCEAN_EXPECT_EQUAL(validation, tile.left(), 0u);
+			OCEAN_EXPECT_EQUAL(validation, tile.width(), width);
+			OCEAN_EXPECT_LESS(validation, tile.bottom(), height);
+
+			tiles.emplace_back(tile);
+		}
+
+		// any tag with height up to height / numberTiles must be located inside at least one tile
+
+		const unsigned int maximalTagHeight = height / numberTiles;
+
+		for (unsigned int n = 0u; n < 10u; ++n)
+		{
+			const unsigned int tagHeight = RandomI::random(randomGenerator, 1u, std::max(1u, maximalTagHeight));
+			const unsigned int tagTop = RandomI::random(randomGenerator, height - tagHeight);
+			const unsigned int tagBottom = tagTop + tagHeight - 1u;
+
+			bool isInside = false;
+
+			for (const CV::PixelBoundingBox& tile : tiles)
+			{
+				if (tile.top() <= tagTop && tagBottom <= tile.bottom())
+				{
+					isInside = true;
+					break;
+				}
+			}
+
+			OCEAN_EXPECT_TRUE(validation, isInside);
+		}
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
 } // namespace TestTrackingOculusTag
 
 } // namespace TestTracking
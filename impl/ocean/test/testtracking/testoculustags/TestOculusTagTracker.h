@@ -51,6 +51,13 @@ class OCEAN_TEST_TRACKING_OCULUSTAGS_EXPORT TestOculusTagTracker : protected Tra
 		 * @return True, if succeeded
 		 */
 		static bool testStressTestNegative(const double testDuration, Worker& worker);
+
+		/**
+		 * Tests the tiles which are used to amortize the detection over several frames.
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @return True, if succeeded
+		 */
+		static bool testDetectionTile(const double testDuration);
 };
 
 }
@@ -0,0 +1,174 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "ocean/test/testtracking/testslam/TestCovisibilityGraph.h"
+
+#include "ocean/tracking/slam/CovisibilityGraph.h"
+
+#include "ocean/base/Timestamp.h"
+
+#include "ocean/math/Random.h"
+
+#include "ocean/test/TestResult.h"
+#include "ocean/test/Validation.h"
+
+namespace Ocean
+{
+
+namespace Test
+{
+
+namespace TestTracking
+{
+
+namespace TestSLAM
+{
+
+bool TestCovisibilityGraph::test(const double testDuration, const TestSelector& selector)
+{
+	ocean_assert(testDuration > 0.0);
+
+	TestResult testResult("CovisibilityGraph test");
+
+	Log::info() << " ";
+
+	if (selector.shouldRun("observations"))
+	{
+		testResult = testObservations(testDuration);
+
+		Log::info() << " ";
+	}
+
+	Log::info() << testResult;
+
+	return testResult.succeeded();
+}
+
+#ifdef OCEAN_USE_GTEST
+
+TEST(TestCovisibilityGraph, Observations)
+{
+	EXPECT_TRUE(TestCovisibilityGraph::testObservations(GTEST_TEST_DURATION));
+}
+
+#endif // OCEAN_USE_GTEST
+
+bool TestCovisibilityGraph::testObservations(const double testDuration)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Observations test:";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		constexpr Index32 numberFrames = 50u;
+
+		Tracking::SLAM::LocalizedObjectPointMap localizedObjectPointMap;
+		Tracking::SLAM::CovisibilityGraph covisibilityGraph;
+
+		const unsigned int numberObjectPoints = RandomI::random(randomGenerator, 1u, 200u);
+
+		for (Index32 objectPointId = 0u; objectPointId < numberObjectPoints; ++objectPointId)
+		{
+			const Index32 firstFrameIndex = RandomI::random(randomGenerator, numberFrames - 2u);
+			const unsigned int trackLength = RandomI::random(randomGenerator, 2u, numberFrames - firstFrameIndex);
+
+			Vectors2 imagePoints;
+			imagePoints.reserve(trackLength);
+
+			for (unsigned int n = 0u; n < trackLength; ++n)
+			{
+				imagePoints.emplace_back(Random::vector2(randomGenerator, 0, 1920, 0, 1080));
+			}
+
+			const Tracking::SLAM::PointTrack pointTrack(firstFrameIndex, std::move(imagePoints));
+
+			localizedObjectPointMap.emplace(objectPointId, Tracking::SLAM::LocalizedObjectPoint(pointTrack));
+			covisibilityGraph.addObservations(objectPointId, pointTrack);
+		}
+
+		// some object points receive additional observations in the subsequent frames
+
+		for (Tracking::SLAM::LocalizedObjectPointMap::value_type& objectPointPair : localizedObjectPointMap)
+		{
+			if (RandomI::boolean(randomGenerator))
+			{
+				Tracking::SLAM::LocalizedObjectPoint& localizedObjectPoint = objectPointPair.second;
+
+				const Index32 frameIndex = localizedObjectPoint.lastObservationFrameIndex() + 1u;
+
+				localizedObjectPoint.addObservation(frameIndex, Random::vector2(randomGenerator, 0, 1920, 0, 1080));
+				covisibilityGraph.addObservation(frameIndex, objectPointPair.first);
+			}
+		}
+
+		// some object points are removed from the map, but not from the graph
+
+		const unsigned int numberRemoved = RandomI::random(randomGenerator, numberObjectPoints / 2u);
+
+		for (unsigned int n = 0u; n < numberRemoved; ++n)
+		{
+			localizedObjectPointMap.erase(RandomI::random(randomGenerator, numberObjectPoints - 1u));
+		}
+
+		for (Index32 frameIndex = 0u; frameIndex <= numberFrames; ++frameIndex)
+		{
+			size_t expectedNumber = 0;
+
+			for (const Tracking::SLAM::LocalizedObjectPointMap::value_type& objectPointPair : localizedObjectPointMap)
+			{
+				if (objectPointPair.second.hasObservation(frameIndex))
+				{
+					++expectedNumber;
+				}
+			}
+
+			OCEAN_EXPECT_EQUAL(validation, covisibilityGraph.numberLocalizedObjectPoints(frameIndex, localizedObjectPointMap), expectedNumber);
+
+			const Indices32* objectPointIds = covisibilityGraph.objectPointIds(frameIndex);
+
+			if (objectPointIds != nullptr)
+			{
+				for (const Index32 objectPointId : *objectPointIds)
+				{
+					const Tracking::SLAM::LocalizedObjectPointMap::const_iterator iObjectPoint = localizedObjectPointMap.find(objectPointId);
+
+					if (iObjectPoint != localizedObjectPointMap.cend())
+					{
+						OCEAN_EXPECT_TRUE(validation, iObjectPoint->second.hasObservation(frameIndex));
+					}
+				}
+			}
+			else
+			{
+				OCEAN_EXPECT_EQUAL(validation, expectedNumber, size_t(0));
+			}
+		}
+
+		covisibilityGraph.clear();
+
+		OCEAN_EXPECT_TRUE(validation, covisibilityGraph.isEmpty());
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
+}
+
+}
+
+}
+
+}
@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#ifndef META_OCEAN_TEST_TESTTRACKING_TESTSLAM_TEST_COVISIBILITY_GRAPH_H
+#define META_OCEAN_TEST_TESTTRACKING_TESTSLAM_TEST_COVISIBILITY_GRAPH_H
+
+#include "ocean/test/testtracking/testslam/TestSLAM.h"
+
+#include "ocean/test/TestSelector.h"
+
+namespace Ocean
+{
+
+namespace Test
+{
+
+namespace TestTracking
+{
+
+namespace TestSLAM
+{
+
+/**
+ * This class implements CovisibilityGraph tests.
+ * @ingroup testtrackingtestslam
+ */
+class OCEAN_TEST_TRACKING_SLAM_EXPORT TestCovisibilityGraph
+{
+	public:
+
+		/**
+		 * Executes all CovisibilityGraph tests.
+		 * @param testDuration Number of seconds for each test
+		 * @param selector The test selector
+		 * @return True, if succeeded
+		 */
+		static bool test(const double testDuration, const TestSelector& selector);
+
+		/**
+		 * Tests the observations of the graph in comparison to the observations of the localized object points.
+		 * @param testDuration Number of seconds for each test
+		 * @return True, if succeeded
+		 */
+		static bool testObservations(const double testDuration);
+};
+
+}
+
+}
+
+}
+
+}
+
+#endif // META_OCEAN_TEST_TESTTRACKING_TESTSLAM_TEST_COVISIBILITY_GRAPH_H
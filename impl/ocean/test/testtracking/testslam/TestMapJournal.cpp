@@ -0,0 +1,328 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "ocean/test/testtracking/testslam/TestMapJournal.h"
+
+#include "ocean/tracking/slam/MapJournal.h"
+
+#include "ocean/base/RandomI.h"
+#include "ocean/base/Timestamp.h"
+
+#include "ocean/math/Random.h"
+
+#include "ocean/test/TestResult.h"
+#include "ocean/test/Validation.h"
+
+#include <map>
+#include <sstream>
+
+namespace Ocean
+{
+
+namespace Test
+{
+
+namespace TestTracking
+{
+
+namespace TestSLAM
+{
+
+bool TestMapJournal::test(const double testDuration, const TestSelector& selector)
+{
+	ocean_assert(testDuration > 0.0);
+
+	TestResult testResult("MapJournal test");
+
+	Log::info() << " ";
+
+	if (selector.shouldRun("serialization"))
+	{
+		testResult = testSerialization(testDuration);
+
+		Log::info() << " ";
+	}
+
+	if (selector.shouldRun("applycheckpoint"))
+	{
+		testResult = testApplyCheckpoint(testDuration);
+
+		Log::info() << " ";
+	}
+
+	Log::info() << testResult;
+
+	return testResult.succeeded();
+}
+
+#ifdef OCEAN_USE_GTEST
+
+TEST(TestMapJournal, Serialization)
+{
+	EXPECT_TRUE(TestMapJournal::testSerialization(GTEST_TEST_DURATION));
+}
+
+TEST(TestMapJournal, ApplyCheckpoint)
+{
+	EXPECT_TRUE(TestMapJournal::testApplyCheckpoint(GTEST_TEST_DURATION));
+}
+
+#endif // OCEAN_USE_GTEST
+
+bool TestMapJournal::testSerialization(const double testDuration)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Serialization test:";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		const uint32_t checkpointIndex = RandomI::random32(randomGenerator);
+		const bool isSnapshot = RandomI::boolean(randomGenerator);
+
+		const unsigned int numberChangedPoints = RandomI::random(randomGenerator, 0u, 100u);
+
+		Tracking::SLAM::MapJournal::PointRecords changedPoints;
+
+		for (unsigned int n = 0u; n < numberChangedPoints; ++n)
+		{
+			changedPoints.push_back(randomPointRecord(Index32(n), randomGenerator));
+		}
+
+		Indices32 removedObjectPointIds;
+
+		if (!isSnapshot)
+		{
+			const unsigned int numberRemovedPoints = RandomI::random(randomGenerator, 0u, 50u);
+
+			for (unsigned int n = 0u; n < numberRemovedPoints; ++n)
+			{
+				removedObjectPointIds.push_back(RandomI::random32(randomGenerator));
+			}
+		}
+
+		const Tracking::SLAM::MapJournal::PointRecords copyChangedPoints(changedPoints);
+		const Indices32 copyRemovedObjectPointIds(removedObjectPointIds);
+
+		const Timestamp timestamp(Random::scalar(randomGenerator, 0, 1000));
+
+		Tracking::SLAM::MapJournal::DataSampleCheckpoint checkpoint(checkpointIndex, isSnapshot, std::move(changedPoints), std::move(removedObjectPointIds), timestamp);
+		checkpoint.configurePlaybackTimestamp(startTimestamp);
+
+		std::ostringstream outputStream(std::ios::binary);
+		IO::OutputBitstream outputBitstream(outputStream);
+
+		OCEAN_EXPECT_TRUE(validation, checkpoint.writeSample(outputBitstream));
+
+		std::istringstream inputStream(outputStream.str(), std::ios::binary);
+		IO::InputBitstream inputBitstream(inputStream);
+
+		Tracking::SLAM::MapJournal::DataSampleCheckpoint readCheckpoint;
+
+		if (readCheckpoint.readSample(inputBitstream))
+		{
+			OCEAN_EXPECT_EQUAL(validation, readCheckpoint.checkpointIndex(), checkpointIndex);
+			OCEAN_EXPECT_EQUAL(validation, readCheckpoint.isSnapshot(), isSnapshot);
+			OCEAN_EXPECT_TRUE(validation, readCheckpoint.removedObjectPointIds() == copyRemovedObjectPointIds);
+
+			if (readCheckpoint.changedPoints().size() == copyChangedPoints.size())
+			{
+				for (size_t n = 0; n < copyChangedPoints.size(); ++n)
+				{
+					OCEAN_EXPECT_TRUE(validation, isEqual(readCheckpoint.changedPoints()[n], copyChangedPoints[n]));
+				}
+			}
+			else
+			{
+				OCEAN_SET_FAILED(validation);
+			}
+		}
+		else
+		{
+			OCEAN_SET_FAILED(validation);
+		}
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
+bool TestMapJournal::testApplyCheckpoint(const double testDuration)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Apply checkpoint test:";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		// the ground truth map, and the map replayed from the checkpoints
+
+		std::map<Index32, Tracking::SLAM::MapJournal::PointRecord> groundTruthMap;
+		Tracking::SLAM::MapJournal::PointRecordMap pointRecordMap;
+
+		const unsigned int numberCheckpoints = RandomI::random(randomGenerator, 1u, 20u);
+
+		for (unsigned int nCheckpoint = 0u; nCheckpoint < numberCheckpoints; ++nCheckpoint)
+		{
+			const bool isSnapshot = nCheckpoint == 0u || RandomI::random(randomGenerator, 9u) == 0u;
+
+			Tracking::SLAM::MapJournal::PointRecords changedPoints;
+			Indices32 removedObjectPointIds;
+
+			if (isSnapshot)
+			{
+				groundTruthMap.clear();
+
+				const unsigned int numberPoints = RandomI::random(randomGenerator, 0u, 100u);
+
+				for (unsigned int n = 0u; n < numberPoints; ++n)
+				{
+					const Index32 objectPointId = RandomI::random(randomGenerator, 200u);
+
+					groundTruthMap[objectPointId] = randomPointRecord(objectPointId, randomGenerator);
+				}
+
+				for (const std::map<Index32, Tracking::SLAM::MapJournal::PointRecord>::value_type& pointPair : groundTruthMap)
+				{
+					changedPoints.push_back(pointPair.second);
+				}
+			}
+			else
+			{
+				UnorderedIndexSet32 changedObjectPointIds;
+
+				const unsigned int numberChanges = RandomI::random(randomGenerator, 0u, 50u);
+
+				for (unsigned int n = 0u; n < numberChanges; ++n)
+				{
+					const Index32 objectPointId = RandomI::random(randomGenerator, 200u);
+
+					if (!changedObjectPointIds.emplace(objectPointId).second)
+					{
+						// each object point is changed at most once per checkpoint
+						continue;
+					}
+
+					if (RandomI::random(randomGenerator, 3u) == 0u)
+					{
+						if (groundTruthMap.erase(objectPointId) != 0)
+						{
+							removedObjectPointIds.push_back(objectPointId);
+						}
+					}
+					else
+					{
+						Tracking::SLAM::MapJournal::PointRecord pointRecord = randomPointRecord(objectPointId, randomGenerator);
+
+						groundTruthMap[objectPointId] = pointRecord;
+						changedPoints.push_back(std::move(pointRecord));
+					}
+				}
+			}
+
+			const Tracking::SLAM::MapJournal::DataSampleCheckpoint checkpoint(nCheckpoint, isSnapshot, std::move(changedPoints), std::move(removedObjectPointIds), Timestamp(true));
+
+			Tracking::SLAM::MapJournal::applyCheckpoint(checkpoint, pointRecordMap);
+		}
+
+		OCEAN_EXPECT_EQUAL(validation, pointRecordMap.size(), groundTruthMap.size());
+
+		for (const std::map<Index32, Tracking::SLAM::MapJournal::PointRecord>::value_type& pointPair : groundTruthMap)
+		{
+			const Tracking::SLAM::MapJournal::PointRecordMap::const_iterator iPointRecord = pointRecordMap.find(pointPair.first);
+
+			if (iPointRecord != pointRecordMap.cend())
+			{
+				OCEAN_EXPECT_TRUE(validation, isEqual(iPointRecord->second, pointPair.second));
+			}
+			else
+			{
+				OCEAN_SET_FAILED(validation);
+			}
+		}
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
+Tracking::SLAM::MapJournal::PointRecord TestMapJournal::randomPointRecord(const Index32 objectPointId, RandomGenerator& randomGenerator)
+{
+	Tracking::SLAM::MapJournal::PointRecord pointRecord;
+
+	pointRecord.objectPointId_ = objectPointId;
+	pointRecord.position_ = RandomF::vector3(randomGenerator, -10.0f, 10.0f);
+	pointRecord.localizationPrecision_ = Tracking::SLAM::LocalizedObjectPoint::LocalizationPrecision(RandomI::random(randomGenerator, 1u, 4u));
+
+	const unsigned int numberObservations = RandomI::random(randomGenerator, 1u, 20u);
+	Index32 frameIndex = RandomI::random(randomGenerator, 1000u);
+
+	for (unsigned int n = 0u; n < numberObservations; ++n)
+	{
+		pointRecord.observations_.emplace_back(frameIndex, RandomF::vector2(randomGenerator, 0.0f, 1920.0f, 0.0f, 1080.0f));
+
+		pointRecord.lastObservationFrameIndex_ = frameIndex;
+		frameIndex += RandomI::random(randomGenerator, 1u, 5u);
+	}
+
+	return pointRecord;
+}
+
+bool TestMapJournal::isEqual(const Tracking::SLAM::MapJournal::PointRecord& pointRecordA, const Tracking::SLAM::MapJournal::PointRecord& pointRecordB)
+{
+	if (pointRecordA.objectPointId_ != pointRecordB.objectPointId_ || pointRecordA.lastObservationFrameIndex_ != pointRecordB.lastObservationFrameIndex_ || pointRecordA.localizationPrecision_ != pointRecordB.localizationPrecision_)
+	{
+		return false;
+	}
+
+	// the data is written as binary floats, so that the values must be identical
+
+	if (pointRecordA.position_.x() != pointRecordB.position_.x() || pointRecordA.position_.y() != pointRecordB.position_.y() || pointRecordA.position_.z() != pointRecordB.position_.z())
+	{
+		return false;
+	}
+
+	if (pointRecordA.observations_.size() != pointRecordB.observations_.size())
+	{
+		return false;
+	}
+
+	for (size_t n = 0; n < pointRecordA.observations_.size(); ++n)
+	{
+		const Tracking::SLAM::MapJournal::PointRecord::Observation& observationA = pointRecordA.observations_[n];
+		const Tracking::SLAM::MapJournal::PointRecord::Observation& observationB = pointRecordB.observations_[n];
+
+		if (observationA.first != observationB.first || observationA.second.x() != observationB.second.x() || observationA.second.y() != observationB.second.y())
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+}
+
+}
+
+}
+
+}
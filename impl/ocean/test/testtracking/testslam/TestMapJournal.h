@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#ifndef META_OCEAN_TEST_TESTTRACKING_TESTSLAM_TEST_MAP_JOURNAL_H
+#define META_OCEAN_TEST_TESTTRACKING_TESTSLAM_TEST_MAP_JOURNAL_H
+
+#include "ocean/test/testtracking/testslam/TestSLAM.h"
+
+#include "ocean/base/RandomGenerator.h"
+
+#include "ocean/tracking/slam/MapJournal.h"
+
+#include "ocean/test/TestSelector.h"
+
+namespace Ocean
+{
+
+namespace Test
+{
+
+namespace TestTracking
+{
+
+namespace TestSLAM
+{
+
+/**
+ * This class implements MapJournal tests.
+ * @ingroup testtrackingtestslam
+ */
+class OCEAN_TEST_TRACKING_SLAM_EXPORT TestMapJournal
+{
+	public:
+
+		/**
+		 * Executes all MapJournal tests.
+		 * @param testDuration Number of seconds for each test
+		 * @param selector The test selector
+		 * @return True, if succeeded
+		 */
+		static bool test(const double testDuration, const TestSelector& selector);
+
+		/**
+		 * Tests writing and reading checkpoint samples.
+		 * @param testDuration Number of seconds for each test
+		 * @return True, if succeeded
+		 */
+		static bool testSerialization(const double testDuration);
+
+		/**
+		 * Tests applying a sequence of snapshot and delta checkpoints.
+		 * @param testDuration Number of seconds for each test
+		 * @return True, if succeeded
+		 */
+		static bool testApplyCheckpoint(const double testDuration);
+
+	protected:
+
+		/**
+		 * Creates a random point record.
+		 * @param objectPointId The id of the object point
+		 * @param randomGenerator The random generator to be used
+		 * @return The random record
+		 */
+		static Tracking::SLAM::MapJournal::PointRecord randomPointRecord(const Index32 objectPointId, RandomGenerator& randomGenerator);
+
+		/**
+		 * Returns whether two point records are identical.
+		 * @param pointRecordA The first record
+		 * @param pointRecordB The second record
+		 * @return True, if so
+		 */
+		static bool isEqual(const Tracking::SLAM::MapJournal::PointRecord& pointRecordA, const Tracking::SLAM::MapJournal::PointRecord& pointRecordB);
+};
+
+}
+
+}
+
+}
+
+}
+
+#endif // META_OCEAN_TEST_TESTTRACKING_TESTSLAM_TEST_MAP_JOURNAL_H
@@ -6,8 +6,12 @@
  */
 
 #include "ocean/test/testtracking/testslam/TestSLAM.h"
+#include "ocean/test/testtracking/testslam/TestCovisibilityGraph.h"
 #include "ocean/test/testtracking/testslam/TestFramePyramidManager.h"
 #include "ocean/test/testtracking/testslam/TestLocalizedObjectPoint.h"
+#include "ocean/test/testtracking/testslam/TestMapJournal.h"
+#include "ocean/test/testtracking/testslam/TestTrackerMono.h"
+#include "ocean/test/testtracking/testslam/TestTrackerMulti.h"
 
 #include "ocean/test/TestResult.h"
 #include "ocean/test/TestSelector.h"
@@ -93,6 +97,42 @@ bool testSLAM(const double testDuration, Worker& /*worker*/, const std::string&
 		testResult = TestFramePyramidManager::test(testDuration, subSelector);
 	}
 
+	if (TestSelector subSelector = selector.shouldRun("covisibilitygraph"))
+	{
+		Log::info() << " ";
+		Log::info() << " ";
+		Log::info() << " ";
+		Log::info() << " ";
+		testResult = TestCovisibilityGraph::test(testDuration, subSelector);
+	}
+
+	if (TestSelector subSelector = selector.shouldRun("trackermono"))
+	{
+		Log::info() << " ";
+		Log::info() << " ";
+		Log::info() << " ";
+		Log::info() << " ";
+		testResult = TestTrackerMono::test(testDuration, subSelector);
+	}
+
+	if (TestSelector subSelector = selector.shouldRun("trackermulti"))
+	{
+		Log::info() << " ";
+		Log::info() << " ";
+		Log::info() << " ";
+		Log::info() << " ";
+		testResult = TestTrackerMulti::test(testDuration, subSelector);
+	}
+
+	if (TestSelector subSelector = selector.shouldRun("mapjournal"))
+	{
+		Log::info() << " ";
+		Log::info() << " ";
+		Log::info() << " ";
+		Log::info() << " ";
+		testResult = TestMapJournal::test(testDuration, subSelector);
+	}
+
 	Log::info() << " ";
 	Log::info() << " ";
 	Log::info() << " ";
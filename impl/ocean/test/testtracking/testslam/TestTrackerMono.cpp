@@ -0,0 +1,367 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "ocean/test/testtracking/testslam/TestTrackerMono.h"
+
+#include "ocean/base/Thread.h"
+#include "ocean/base/Timestamp.h"
+
+#include "ocean/cv/CVUtilities.h"
+#include "ocean/cv/FrameFilterGaussian.h"
+
+#include "ocean/geometry/AbsoluteTransformation.h"
+
+#include "ocean/math/Random.h"
+
+#include "ocean/test/TestResult.h"
+#include "ocean/test/Validation.h"
+
+#include "ocean/tracking/slam/TrackerMono.h"
+
+namespace Ocean
+{
+
+namespace Test
+{
+
+namespace TestTracking
+{
+
+namespace TestSLAM
+{
+
+bool TestTrackerMono::test(const double testDuration, const TestSelector& selector)
+{
+	ocean_assert(testDuration > 0.0);
+
+	TestResult testResult("TrackerMono test");
+
+	Log::info() << " ";
+
+	if (selector.shouldRun("concurrentcornerdetection"))
+	{
+		testResult = testConcurrentCornerDetection(testDuration);
+
+		Log::info() << " ";
+	}
+
+	Log::info() << testResult;
+
+	return testResult.succeeded();
+}
+
+#ifdef OCEAN_USE_GTEST
+
+TEST(TestTrackerMono, ConcurrentCornerDetection)
+{
+	EXPECT_TRUE(TestTrackerMono::testConcurrentCornerDetection(GTEST_TEST_DURATION));
+}
+
+#endif // OCEAN_USE_GTEST
+
+bool TestTrackerMono::testConcurrentCornerDetection(const double testDuration)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Concurrent corner detection test:";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	constexpr unsigned int width = 320u;
+	constexpr unsigned int height = 240u;
+
+	constexpr size_t numberFrames = 150;
+
+	const AnyCameraPinhole camera(PinholeCamera(width, height, Numeric::deg2rad(60)));
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		Frames yFrames;
+		HomogenousMatrices4 world_T_cameras;
+		createSequence(camera, numberFrames, randomGenerator, yFrames, world_T_cameras);
+
+		HomogenousMatrices4 slam_T_cameras[2];
+		std::vector<Tracking::SLAM::TrackerMono::DebugData::TracksMap> tracksMaps[2];
+
+		for (const bool detectCornersConcurrently : {false, true})
+		{
+			const size_t runIndex = detectCornersConcurrently ? 1 : 0;
+
+			Tracking::SLAM::TrackerMono::Configuration configuration;
+			configuration.detectCornersConcurrently_ = detectCornersConcurrently;
+
+			Tracking::SLAM::TrackerMono tracker;
+			OCEAN_EXPECT_TRUE(validation, tracker.configure(configuration));
+
+			for (size_t nFrame = 0; nFrame < numberFrames; ++nFrame)
+			{
+				const HomogenousMatrix4& world_T_camera = world_T_cameras[nFrame];
+
+				// the tracker receives the ground truth gravity and orientation, as if the device had an IMU
+
+				const Vector3 cameraGravity = world_T_camera.rotation().inverted() * Vector3(0, -1, 0);
+
+				Frame yFrame(yFrames[nFrame], Frame::ACM_COPY_REMOVE_PADDING_LAYOUT);
+
+				const Timestamp frameTimestamp(true);
+
+				HomogenousMatrix4 slam_T_camera(false);
+				Tracking::SLAM::TrackerMono::DebugData debugData;
+
+				OCEAN_EXPECT_TRUE(validation, tracker.handleFrame(camera, std::move(yFrame), slam_T_camera, cameraGravity, world_T_camera.rotation(), &debugData));
+
+				slam_T_cameras[runIndex].push_back(slam_T_camera);
+				tracksMaps[runIndex].push_back(std::move(debugData.tracksMap_));
+
+				// the map is created and optimized in the background, so that the frames are provided in real time
+
+				while (!frameTimestamp.hasTimePassed(1.0 / 30.0))
+				{
+					Thread::sleep(1u);
+				}
+			}
+		}
+
+		// as long as the tracker is initializing, the tracked image points depend on the detected corners only, while the initial map is created asynchronously afterwards
+
+		size_t firstPoseIndex = numberFrames;
+
+		for (size_t runIndex = 0; runIndex < 2; ++runIndex)
+		{
+			for (size_t nFrame = 0; nFrame < numberFrames; ++nFrame)
+			{
+				if (slam_T_cameras[runIndex][nFrame].isValid())
+				{
+					firstPoseIndex = std::min(firstPoseIndex, nFrame);
+					break;
+				}
+			}
+		}
+
+		OCEAN_EXPECT_LESS(validation, firstPoseIndex, numberFrames / 2);
+
+		for (size_t nFrame = 0; nFrame < firstPoseIndex; ++nFrame)
+		{
+			const Tracking::SLAM::TrackerMono::DebugData::TracksMap& tracksMap = tracksMaps[0][nFrame];
+			const Tracking::SLAM::TrackerMono::DebugData::TracksMap& concurrentTracksMap = tracksMaps[1][nFrame];
+
+			OCEAN_EXPECT_EQUAL(validation, tracksMap.size(), concurrentTracksMap.size());
+
+			for (const Tracking::SLAM::TrackerMono::DebugData::TracksMap::value_type& trackPair : tracksMap)
+			{
+				const Tracking::SLAM::TrackerMono::DebugData::TracksMap::const_iterator iConcurrent = concurrentTracksMap.find(trackPair.first);
+
+				if (iConcurrent == concurrentTracksMap.cend())
+				{
+					OCEAN_SET_FAILED(validation);
+					continue;
+				}
+
+				const Vectors2& imagePoints = trackPair.second.second;
+				const Vectors2& concurrentImagePoints = iConcurrent->second.second;
+
+				OCEAN_EXPECT_EQUAL(validation, trackPair.second.first, iConcurrent->second.first);
+				OCEAN_EXPECT_EQUAL(validation, imagePoints.size(), concurrentImagePoints.size());
+
+				for (size_t n = 0; n < std::min(imagePoints.size(), concurrentImagePoints.size()); ++n)
+				{
+					OCEAN_EXPECT_EQUAL(validation, imagePoints[n], concurrentImagePoints[n]);
+				}
+			}
+		}
+
+		// the map is optimized asynchronously, so that the poses of both configurations can differ slightly
+
+		HomogenousMatrices4 world_T_alignedCameras[2];
+
+		for (size_t runIndex = 0; runIndex < 2; ++runIndex)
+		{
+			const Scalar averageError = alignedPoseError(world_T_cameras, slam_T_cameras[runIndex], numberFrames / 2, world_T_alignedCameras[runIndex]);
+
+			OCEAN_EXPECT_GREATER_EQUAL(validation, averageError, Scalar(0));
+			OCEAN_EXPECT_LESS_EQUAL(validation, averageError, Scalar(0.05));
+		}
+
+		for (size_t nFrame = 0; nFrame < numberFrames; ++nFrame)
+		{
+			const HomogenousMatrix4& world_T_alignedCamera = world_T_alignedCameras[0][nFrame];
+			const HomogenousMatrix4& world_T_concurrentAlignedCamera = world_T_alignedCameras[1][nFrame];
+
+			if (world_T_alignedCamera.isValid() && world_T_concurrentAlignedCamera.isValid())
+			{
+				OCEAN_EXPECT_LESS_EQUAL(validation, world_T_alignedCamera.translation().distance(world_T_concurrentAlignedCamera.translation()), Scalar(0.1));
+				OCEAN_EXPECT_LESS_EQUAL(validation, world_T_alignedCamera.rotation().smallestAngle(world_T_concurrentAlignedCamera.rotation()), Numeric::deg2rad(5));
+			}
+		}
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
+void TestTrackerMono::createSequence(const AnyCamera& camera, const size_t numberFrames, RandomGenerator& randomGenerator, Frames& yFrames, HomogenousMatrices4& world_T_cameras)
+{
+	ocean_assert(camera.isValid());
+	ocean_assert(numberFrames >= 1);
+
+	// the walls of the box are covered with a smooth random texture, with one texel every 2.5cm
+
+	Frame texture(FrameType(64u, 64u, FrameType::FORMAT_Y8, FrameType::ORIGIN_UPPER_LEFT));
+	CV::CVUtilities::randomizeFrame(texture, false, &randomGenerator);
+	CV::FrameFilterGaussian::filter(texture, 3u);
+
+	constexpr Scalar texelSize = Scalar(0.025);
+
+	// the box is defined by six planes (axis, position), the camera is always located inside the box
+
+	const Vector3 boxLower(-2, Scalar(-1.2), -3);
+	const Vector3 boxUpper(2, Scalar(1.5), 3);
+
+	const Scalar phase = Random::scalar(randomGenerator, 0, Numeric::pi2());
+
+	yFrames.clear();
+	yFrames.reserve(numberFrames);
+
+	world_T_cameras.clear();
+	world_T_cameras.reserve(numberFrames);
+
+	for (size_t nFrame = 0; nFrame < numberFrames; ++nFrame)
+	{
+		const Scalar time = Scalar(nFrame) / Scalar(30);
+
+		const Vector3 translation(Scalar(0.5) * Numeric::sin(Numeric::pi2() * time / Scalar(4) + phase), Scalar(0.1) * Numeric::sin(Numeric::pi2() * time / Scalar(3)), Scalar(0.5) + Scalar(0.2) * Numeric::sin(Numeric::pi2() * time / Scalar(5)));
+		const Quaternion orientation = Quaternion(Vector3(0, 1, 0), Numeric::deg2rad(10) * Numeric::sin(Numeric::pi2() * time / Scalar(6) + phase)) * Quaternion(Vector3(1, 0, 0), Numeric::deg2rad(5) * Numeric::sin(Numeric::pi2() * time / Scalar(4)));
+
+		const HomogenousMatrix4 world_T_camera(translation, orientation);
+
+		Frame yFrame(FrameType(texture, camera.width(), camera.height()));
+		yFrame.setTimestamp(Timestamp(double(nFrame) / 30.0));
+
+		for (unsigned int y = 0u; y < yFrame.height(); ++y)
+		{
+			uint8_t* const row = yFrame.row<uint8_t>(y);
+
+			for (unsigned int x = 0u; x < yFrame.width(); ++x)
+			{
+				const Vector3 ray = world_T_camera.rotationMatrix(camera.vector(Vector2(Scalar(x), Scalar(y))));
+
+				// determining the closest wall in front of the camera
+
+				Scalar minDistance = Numeric::maxValue();
+				Vector2 texturePosition(0, 0);
+
+				for (unsigned int axis = 0u; axis < 3u; ++axis)
+				{
+					if (Numeric::isEqualEps(ray[axis]))
+					{
+						continue;
+					}
+
+					for (const Scalar wall : {boxLower[axis], boxUpper[axis]})
+					{
+						const Scalar distance = (wall - translation[axis]) / ray[axis];
+
+						if (distance > 0 && distance < minDistance)
+						{
+							minDistance = distance;
+
+							const Vector3 point = translation + ray * distance;
+
+							// each wall uses an individual part of the texture
+
+							texturePosition = Vector2(point[(axis + 1u) % 3u] + wall * Scalar(7), point[(axis + 2u) % 3u] + Scalar(axis) * Scalar(5)) / texelSize;
+						}
+					}
+				}
+
+				ocean_assert(minDistance != Numeric::maxValue());
+
+				// bilinear interpolation of the repeated texture
+
+				const Scalar textureX = texturePosition.x() - Numeric::floor(texturePosition.x() / Scalar(texture.width())) * Scalar(texture.width());
+				const Scalar textureY = texturePosition.y() - Numeric::floor(texturePosition.y() / Scalar(texture.height())) * Scalar(texture.height());
+
+				const unsigned int left = std::min((unsigned int)(textureX), texture.width() - 1u);
+				const unsigned int top = std::min((unsigned int)(textureY), texture.height() - 1u);
+				const unsigned int right = (left + 1u) % texture.width();
+				const unsigned int bottom = (top + 1u) % texture.height();
+
+				const Scalar factorRight = textureX - Scalar(left);
+				const Scalar factorBottom = textureY - Scalar(top);
+
+				const Scalar topValue = Scalar(texture.constpixel<uint8_t>(left, top)[0]) * (1 - factorRight) + Scalar(texture.constpixel<uint8_t>(right, top)[0]) * factorRight;
+				const Scalar bottomValue = Scalar(texture.constpixel<uint8_t>(left, bottom)[0]) * (1 - factorRight) + Scalar(texture.constpixel<uint8_t>(right, bottom)[0]) * factorRight;
+
+				row[x] = uint8_t(minmax<int>(0, Numeric::round32(topValue * (1 - factorBottom) + bottomValue * factorBottom), 255));
+			}
+		}
+
+		yFrames.push_back(std::move(yFrame));
+		world_T_cameras.push_back(world_T_camera);
+	}
+}
+
+Scalar TestTrackerMono::alignedPoseError(const HomogenousMatrices4& world_T_cameras, const HomogenousMatrices4& slam_T_cameras, const size_t minimalPoses, HomogenousMatrices4& world_T_alignedCameras)
+{
+	ocean_assert(world_T_cameras.size() == slam_T_cameras.size());
+	ocean_assert(minimalPoses >= 3);
+
+	world_T_alignedCameras = HomogenousMatrices4(world_T_cameras.size(), HomogenousMatrix4(false));
+
+	Vectors3 worldCenters;
+	Vectors3 slamCenters;
+
+	for (size_t n = 0; n < world_T_cameras.size(); ++n)
+	{
+		if (slam_T_cameras[n].isValid())
+		{
+			worldCenters.push_back(world_T_cameras[n].translation());
+			slamCenters.push_back(slam_T_cameras[n].translation());
+		}
+	}
+
+	if (slamCenters.size() < minimalPoses)
+	{
+		return Scalar(-1);
+	}
+
+	// the monocular map has an arbitrary origin and scale
+
+	HomogenousMatrix4 world_T_slam(false);
+	Scalar scale = 0;
+	if (!Geometry::AbsoluteTransformation::calculateTransformation(slamCenters.data(), worldCenters.data(), slamCenters.size(), world_T_slam, Geometry::AbsoluteTransformation::ScaleErrorType::RightBiased, &scale))
+	{
+		return Scalar(-1);
+	}
+
+	Scalar sumDistances = 0;
+
+	for (size_t n = 0; n < world_T_cameras.size(); ++n)
+	{
+		if (slam_T_cameras[n].isValid())
+		{
+			world_T_alignedCameras[n] = HomogenousMatrix4(world_T_slam * (slam_T_cameras[n].translation() * scale), world_T_slam.rotation() * slam_T_cameras[n].rotation());
+
+			sumDistances += world_T_alignedCameras[n].translation().distance(world_T_cameras[n].translation());
+		}
+	}
+
+	return sumDistances / Scalar(slamCenters.size());
+}
+
+}
+
+}
+
+}
+
+}
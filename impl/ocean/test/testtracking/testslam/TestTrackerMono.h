@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#ifndef META_OCEAN_TEST_TESTTRACKING_TESTSLAM_TEST_TRACKER_MONO_H
+#define META_OCEAN_TEST_TESTTRACKING_TESTSLAM_TEST_TRACKER_MONO_H
+
+#include "ocean/test/testtracking/testslam/TestSLAM.h"
+
+#include "ocean/test/TestSelector.h"
+
+#include "ocean/base/Frame.h"
+#include "ocean/base/RandomGenerator.h"
+
+#include "ocean/math/AnyCamera.h"
+#include "ocean/math/HomogenousMatrix4.h"
+
+namespace Ocean
+{
+
+namespace Test
+{
+
+namespace TestTracking
+{
+
+namespace TestSLAM
+{
+
+/**
+ * This class implements TrackerMono tests.
+ * @ingroup testtrackingtestslam
+ */
+class OCEAN_TEST_TRACKING_SLAM_EXPORT TestTrackerMono
+{
+	public:
+
+		/**
+		 * Executes all TrackerMono tests.
+		 * @param testDuration Number of seconds for each test
+		 * @param selector The test selector
+		 * @return True, if succeeded
+		 */
+		static bool test(const double testDuration, const TestSelector& selector);
+
+		/**
+		 * Tests the concurrent detection of corners by running the tracker on a synthetic sequence with and without concurrent detection.
+		 * Both configurations must detect the same corners and must determine matching camera poses.
+		 * @param testDuration Number of seconds for each test
+		 * @return True, if succeeded
+		 */
+		static bool testConcurrentCornerDetection(const double testDuration);
+
+	protected:
+
+		/**
+		 * Creates a synthetic sequence of a camera moving inside a textured box.
+		 * @param camera The camera profile to be used, must be valid
+		 * @param numberFrames The number of frames to be created, with range [1, infinity)
+		 * @param randomGenerator The random generator to be used
+		 * @param yFrames The resulting grayscale frames, with valid timestamps
+		 * @param world_T_cameras The resulting ground truth camera poses, one for each frame
+		 */
+		static void createSequence(const AnyCamera& camera, const size_t numberFrames, RandomGenerator& randomGenerator, Frames& yFrames, HomogenousMatrices4& world_T_cameras);
+
+		/**
+		 * Returns the average distance between the camera centers of ground truth poses and of estimated poses after the estimated poses have been aligned with the ground truth.
+		 * @param world_T_cameras The ground truth camera poses, must be valid
+		 * @param slam_T_cameras The estimated camera poses, one for each ground truth pose, invalid if unknown
+		 * @param minimalPoses The minimal number of valid estimated poses, with range [3, infinity)
+		 * @param world_T_alignedCameras The resulting aligned estimated poses, one for each ground truth pose, invalid if unknown
+		 * @return The average distance, in the units of the ground truth poses, -1 if the alignment failed
+		 */
+		static Scalar alignedPoseError(const HomogenousMatrices4& world_T_cameras, const HomogenousMatrices4& slam_T_cameras, const size_t minimalPoses, HomogenousMatrices4& world_T_alignedCameras);
+};
+
+}
+
+}
+
+}
+
+}
+
+#endif // META_OCEAN_TEST_TESTTRACKING_TESTSLAM_TEST_TRACKER_MONO_H
@@ -0,0 +1,201 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "ocean/test/testtracking/testslam/TestTrackerMulti.h"
+
+#include "ocean/tracking/slam/TrackerMulti.h"
+
+#include "ocean/base/Timestamp.h"
+
+#include "ocean/math/PinholeCamera.h"
+#include "ocean/math/Random.h"
+
+#include "ocean/test/TestResult.h"
+#include "ocean/test/ValidationPrecision.h"
+
+namespace Ocean
+{
+
+namespace Test
+{
+
+namespace TestTracking
+{
+
+namespace TestSLAM
+{
+
+bool TestTrackerMulti::test(const double testDuration, const TestSelector& selector)
+{
+	ocean_assert(testDuration > 0.0);
+
+	TestResult testResult("TrackerMulti test");
+
+	Log::info() << " ";
+
+	if (selector.shouldRun("determinepose"))
+	{
+		testResult = testDeterminePose(testDuration);
+
+		Log::info() << " ";
+	}
+
+	Log::info() << testResult;
+
+	return testResult.succeeded();
+}
+
+#ifdef OCEAN_USE_GTEST
+
+TEST(TestTrackerMulti, DeterminePose)
+{
+	EXPECT_TRUE(TestTrackerMulti::testDeterminePose(GTEST_TEST_DURATION));
+}
+
+#endif // OCEAN_USE_GTEST
+
+bool TestTrackerMulti::testDeterminePose(const double testDuration)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Determine device pose test:";
+
+	RandomGenerator randomGenerator;
+	ValidationPrecision validation(0.95, randomGenerator);
+
+	constexpr unsigned int width = 640u;
+	constexpr unsigned int height = 480u;
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		ValidationPrecision::ScopedIteration scopedIteration(validation);
+
+		// a rig with two to four cameras, all cameras are located around the device's origin and are looking in different directions
+
+		const size_t numberCameras = size_t(RandomI::random(randomGenerator, 2u, 4u));
+
+		SharedAnyCameras cameras;
+		HomogenousMatrices4 device_T_cameras;
+
+		for (size_t nCamera = 0; nCamera < numberCameras; ++nCamera)
+		{
+			const Scalar fovX = Random::scalar(randomGenerator, Numeric::deg2rad(50), Numeric::deg2rad(90));
+
+			cameras.emplace_back(std::make_shared<AnyCameraPinhole>(PinholeCamera(width, height, fovX)));
+
+			const Vector3 device_t_camera = Random::vector3(randomGenerator, Scalar(-0.1), Scalar(0.1));
+			const Quaternion device_Q_camera = Quaternion(Vector3(0, 1, 0), Random::scalar(randomGenerator, Numeric::deg2rad(-60), Numeric::deg2rad(60))) * Quaternion(Vector3(1, 0, 0), Random::scalar(randomGenerator, Numeric::deg2rad(-20), Numeric::deg2rad(20)));
+
+			device_T_cameras.emplace_back(device_t_camera, device_Q_camera);
+		}
+
+		const HomogenousMatrix4 world_T_device(Random::vector3(randomGenerator, -1, 1), Random::quaternion(randomGenerator));
+
+		const bool useRoughPose = RandomI::boolean(randomGenerator);
+		const bool addNoise = RandomI::boolean(randomGenerator);
+		const Scalar outlierRatio = Random::scalar(randomGenerator, 0, Scalar(0.2));
+
+		Geometry::ObjectPointGroups objectPointGroups(numberCameras);
+		Geometry::ImagePointGroups imagePointGroups(numberCameras);
+
+		size_t numberInliers = 0;
+
+		for (size_t nCamera = 0; nCamera < numberCameras; ++nCamera)
+		{
+			// some cameras may not observe any object point
+
+			const unsigned int numberCorrespondences = (nCamera == 0 || RandomI::boolean(randomGenerator)) ? RandomI::random(randomGenerator, 30u, 100u) : RandomI::random(randomGenerator, 0u, 10u);
+
+			const AnyCamera& camera = *cameras[nCamera];
+			const HomogenousMatrix4 world_T_camera = world_T_device * device_T_cameras[nCamera];
+
+			for (unsigned int n = 0u; n < numberCorrespondences; ++n)
+			{
+				const Vector2 imagePoint = Random::vector2(randomGenerator, Scalar(5), Scalar(width - 5u), Scalar(5), Scalar(height - 5u));
+				const Scalar depth = Random::scalar(randomGenerator, Scalar(0.5), Scalar(5));
+
+				const Vector3 objectPoint = world_T_camera * (camera.vector(imagePoint) * depth);
+
+				objectPointGroups[nCamera].push_back(objectPoint);
+
+				if (Random::scalar(randomGenerator, 0, 1) < outlierRatio)
+				{
+					imagePointGroups[nCamera].push_back(Random::vector2(randomGenerator, 0, Scalar(width), 0, Scalar(height)));
+				}
+				else
+				{
+					const Vector2 noise = addNoise ? Random::gaussianNoiseVector2(randomGenerator, Scalar(0.5), Scalar(0.5)) : Vector2(0, 0);
+
+					imagePointGroups[nCamera].push_back(camera.projectToImage(world_T_camera, objectPoint) + noise);
+
+					++numberInliers;
+				}
+			}
+		}
+
+		HomogenousMatrix4 world_T_roughDevice(false);
+
+		if (useRoughPose)
+		{
+			const Quaternion offset_Q_device(Random::vector3(randomGenerator), Random::scalar(randomGenerator, Numeric::deg2rad(0), Numeric::deg2rad(3)));
+
+			world_T_roughDevice = HomogenousMatrix4(world_T_device.translation() + Random::vector3(randomGenerator, Scalar(-0.05), Scalar(0.05)), world_T_device.rotation() * offset_Q_device);
+		}
+
+		HomogenousMatrix4 world_T_estimatedDevice(false);
+		IndexGroups32 usedIndexGroups;
+		Scalar sqrAccuracy = Numeric::maxValue();
+
+		if (Tracking::SLAM::TrackerMulti::determineDevicePose(cameras, device_T_cameras, objectPointGroups, imagePointGroups, world_T_roughDevice, randomGenerator, world_T_estimatedDevice, 20, Scalar(3.5), &usedIndexGroups, &sqrAccuracy))
+		{
+			OCEAN_EXPECT_EQUAL(validation, usedIndexGroups.size(), numberCameras);
+
+			size_t numberUsedCorrespondences = 0;
+
+			for (size_t nCamera = 0; nCamera < std::min(numberCameras, usedIndexGroups.size()); ++nCamera)
+			{
+				for (const Index32 usedIndex : usedIndexGroups[nCamera])
+				{
+					OCEAN_EXPECT_LESS(validation, size_t(usedIndex), objectPointGroups[nCamera].size());
+				}
+
+				numberUsedCorrespondences += usedIndexGroups[nCamera].size();
+			}
+
+			OCEAN_EXPECT_LESS_EQUAL(validation, sqrAccuracy, Numeric::sqr(Scalar(3.5)));
+
+			const Scalar translationError = world_T_estimatedDevice.translation().distance(world_T_device.translation());
+			const Scalar angleError = world_T_estimatedDevice.rotation().smallestAngle(world_T_device.rotation());
+
+			// random outliers may be located close to the correct projection, so that slightly more correspondences can be used
+
+			if (numberUsedCorrespondences < numberInliers * 9 / 10 || translationError > Scalar(0.01) || angleError > Numeric::deg2rad(Scalar(0.5)))
+			{
+				scopedIteration.setInaccurate();
+			}
+		}
+		else
+		{
+			scopedIteration.setInaccurate();
+		}
+	}
+	while (validation.needMoreIterations() || !startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
+}
+
+}
+
+}
+
+}
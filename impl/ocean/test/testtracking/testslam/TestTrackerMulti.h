@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#ifndef META_OCEAN_TEST_TESTTRACKING_TESTSLAM_TEST_TRACKER_MULTI_H
+#define META_OCEAN_TEST_TESTTRACKING_TESTSLAM_TEST_TRACKER_MULTI_H
+
+#include "ocean/test/testtracking/testslam/TestSLAM.h"
+
+#include "ocean/test/TestSelector.h"
+
+namespace Ocean
+{
+
+namespace Test
+{
+
+namespace TestTracking
+{
+
+namespace TestSLAM
+{
+
+/**
+ * This class implements TrackerMulti tests.
+ * @ingroup testtrackingtestslam
+ */
+class OCEAN_TEST_TRACKING_SLAM_EXPORT TestTrackerMulti
+{
+	public:
+
+		/**
+		 * Executes all TrackerMulti tests.
+		 * @param testDuration Number of seconds for each test
+		 * @param selector The test selector
+		 * @return True, if succeeded
+		 */
+		static bool test(const double testDuration, const TestSelector& selector);
+
+		/**
+		 * Tests the determination of the device pose of a camera rig with several cameras.
+		 * @param testDuration Number of seconds for each test
+		 * @return True, if succeeded
+		 */
+		static bool testDeterminePose(const double testDuration);
+};
+
+}
+
+}
+
+}
+
+}
+
+#endif // META_OCEAN_TEST_TESTTRACKING_TESTSLAM_TEST_TRACKER_MULTI_H
@@ -13,6 +13,23 @@ namespace Ocean
 namespace Tracking
 {
 
+SharedConstDatabase Database::snapshot() const
+{
+	const ScopedLock scopedLock(databaseLock);
+
+	const uint64_t currentVersion = databaseVersion.load();
+
+	if (!databaseSnapshot || databaseSnapshotVersion != currentVersion)
+	{
+		// the database has been modified since the latest snapshot, readers of the previous snapshot keep their copy alive as long as they need it
+
+		databaseSnapshot = std::make_shared<const Database>(*this);
+		databaseSnapshotVersion = currentVersion;
+	}
+
+	return databaseSnapshot;
+}
+
 Database::PoseImagePointTopologyGroups Database::objectPointTopology(const TopologyTriples& topologyTriples, const Indices32* indices)
 {
 	ocean_assert(indices == nullptr || indices->size() <= topologyTriples.size());
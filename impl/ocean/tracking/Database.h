@@ -18,12 +18,24 @@
 #include "ocean/math/HomogenousMatrix4.h"
 #include "ocean/math/SquareMatrix4.h"
 
+#include <atomic>
+
 namespace Ocean
 {
 
 namespace Tracking
 {
 
+// Forward declaration.
+class Database;
+
+/**
+ * Definition of a shared pointer holding an immutable snapshot of a database.
+ * @see Database::snapshot().
+ * @ingroup tracking
+ */
+using SharedConstDatabase = std::shared_ptr<const Database>;
+
 /**
  * This class implements a database for 3D object points, 2D image points and 6DOF camera poses.
  * Any 2D image point is located in a camera frame, while any camera frame has an own camera pose.<br>
@@ -694,6 +706,23 @@ class OCEAN_TRACKING_EXPORT Database
 		 */
 		inline Lock& lock();
 
+		/**
+		 * Returns the version of this database.
+		 * The version is increased whenever the database is modified, the version can be used to determine whether the database has changed since a specific moment.
+		 * @return The database's current version
+		 */
+		inline uint64_t version() const;
+
+		/**
+		 * Returns an immutable snapshot of this database.
+		 * The snapshot is a copy of the database at the moment this function is called, readers can access the snapshot from several threads concurrently without any lock (using the functions with tThreadSafe = false) while the database itself is modified.<br>
+		 * As long as the database has not been modified after the previous call, the previous snapshot is returned without creating a new copy.<br>
+		 * This function is thread-safe, the database need to be modified via thread-safe functions (or while holding the database's lock) to receive a consistent snapshot.
+		 * @return The snapshot of this database
+		 * @see version().
+		 */
+		SharedConstDatabase snapshot() const;
+
 		/**
 		 * Returns whether this database holds at least one image point, one object point or one camera pose.
 		 * @return True, if so
@@ -1898,8 +1927,17 @@ class OCEAN_TRACKING_EXPORT Database
 		/// The counter for unique image point ids.
 		Index32 databaseImagePointIdCounter;
 
+		/// The version of the database, increased with every modification.
+		std::atomic<uint64_t> databaseVersion = 0ull;
+
+		/// The latest snapshot of this database, nullptr if no snapshot has been created yet.
+		mutable SharedConstDatabase databaseSnapshot;
+
+		/// The version of the database at the moment the latest snapshot was created.
+		mutable uint64_t databaseSnapshotVersion = 0ull;
+
 		/// The lock for the entire database.
-		mutable Lock databaseLock;
+		mutable Lock databaseLock{"Tracking::Database"};
 };
 
 inline Vector3 Database::invalidObjectPoint()
@@ -2224,6 +2262,8 @@ inline Database::Database(Database&& database) noexcept :
 	database.databasePoses = 0u;
 	database.databaseObjectPointIdCounter = invalidId;
 	database.databaseImagePointIdCounter = invalidId;
+
+	++database.databaseVersion;
 }
 
 inline Lock& Database::lock()
@@ -2231,6 +2271,11 @@ inline Lock& Database::lock()
 	return databaseLock;
 }
 
+inline uint64_t Database::version() const
+{
+	return databaseVersion.load();
+}
+
 template <bool tThreadSafe>
 inline bool Database::isEmpty() const
 {
@@ -2971,6 +3016,8 @@ inline Index32 Database::addImagePoint(const Vector2& imagePoint)
 {
 	const TemplatedScopedLock<tThreadSafe> scopedLock(databaseLock);
 
+	++databaseVersion;
+
 	databaseImagePointMap.insert(std::make_pair(++databaseImagePointIdCounter, ImagePointData(imagePoint)));
 	return databaseImagePointIdCounter;
 }
@@ -2982,6 +3029,8 @@ inline void Database::removeImagePoint(const Index32 imagePointId)
 
 	const TemplatedScopedLock<tThreadSafe> scopedLock(databaseLock);
 
+	++databaseVersion;
+
 	const ImagePointMap::iterator i = databaseImagePointMap.find(imagePointId);
 	ocean_assert(i != databaseImagePointMap.end());
 
@@ -3028,6 +3077,8 @@ inline Index32 Database::addObjectPoint(const Vector3& objectPoint, const Scalar
 {
 	const TemplatedScopedLock<tThreadSafe> scopedLock(databaseLock);
 
+	++databaseVersion;
+
 	ocean_assert(databaseObjectPointMap.find(databaseObjectPointIdCounter + 1u) == databaseObjectPointMap.end() && "You mixed calls with the add-objectPoint-function using external object point ids!");
 
 	databaseObjectPointMap.insert(std::make_pair(++databaseObjectPointIdCounter, ObjectPointData(objectPoint, priority)));
@@ -3039,6 +3090,8 @@ inline void Database::addObjectPoint(const Index32 objectPointId, const Vector3&
 {
 	const TemplatedScopedLock<tThreadSafe> scopedLock(databaseLock);
 
+	++databaseVersion;
+
 	ocean_assert(databaseObjectPointMap.find(objectPointId) == databaseObjectPointMap.end());
 	ocean_assert((databaseObjectPointIdCounter == invalidId || objectPointId + 1u <= databaseObjectPointIdCounter) && "You mixed calls with the add-objectPoint-function using external object point ids!");
 
@@ -3134,6 +3187,8 @@ inline void Database::removeObjectPoint(const Index32 objectPointId)
 
 	const TemplatedScopedLock<tThreadSafe> scopedLock(databaseLock);
 
+	++databaseVersion;
+
 	const ObjectPointMap::iterator i = databaseObjectPointMap.find(objectPointId);
 	ocean_assert(i != databaseObjectPointMap.end());
 
@@ -3165,6 +3220,8 @@ void Database::removeObjectPointAndAttachedImagePoints(const Index32 objectPoint
 
 	const TemplatedScopedLock<tThreadSafe> scopedLock(databaseLock);
 
+	++databaseVersion;
+
 	const ObjectPointMap::iterator iObjectPoint = databaseObjectPointMap.find(objectPointId);
 	ocean_assert(iObjectPoint != databaseObjectPointMap.cend());
 
@@ -3203,6 +3260,8 @@ inline void Database::renameObjectPoint(const Index32 oldObjectPointId, const In
 
 	const TemplatedScopedLock<tThreadSafe> scopedLock(databaseLock);
 
+	++databaseVersion;
+
 	ocean_assert(databaseObjectPointMap.find(newObjectPointId) == databaseObjectPointMap.end());
 
 	ObjectPointMap::iterator iOld = databaseObjectPointMap.find(oldObjectPointId);
@@ -3236,6 +3295,8 @@ inline void Database::mergeObjectPoints(const Index32 remainingObjectPointId, co
 
 	const TemplatedScopedLock<tThreadSafe> scopedLock(databaseLock);
 
+	++databaseVersion;
+
 	ObjectPointMap::iterator iObjectPointRemaining = databaseObjectPointMap.find(remainingObjectPointId);
 	ocean_assert(iObjectPointRemaining != databaseObjectPointMap.cend());
 
@@ -3294,6 +3355,8 @@ inline bool Database::addPose(const Index32 poseId, const HomogenousMatrix4& pos
 {
 	const TemplatedScopedLock<tThreadSafe> scopedLock(databaseLock);
 
+	++databaseVersion;
+
 	const PoseMap::const_iterator i = databasePoseMap.find(poseId);
 	if (i != databasePoseMap.end())
 	{
@@ -3315,6 +3378,8 @@ inline void Database::removePose(const Index32 poseId)
 
 	const TemplatedScopedLock<tThreadSafe> scopedLock(databaseLock);
 
+	++databaseVersion;
+
 	const PoseMap::iterator i = databasePoseMap.find(poseId);
 	ocean_assert(i != databasePoseMap.end());
 
@@ -3499,6 +3564,8 @@ inline void Database::attachImagePointToObjectPoint(const Index32 imagePointId,
 
 	const TemplatedScopedLock<tThreadSafe> scopedLock(databaseLock);
 
+	++databaseVersion;
+
 	ImagePointMap::iterator iI = databaseImagePointMap.find(imagePointId);
 	ocean_assert(iI != databaseImagePointMap.end());
 	ocean_assert(iI->second.objectPointId() == invalidId);
@@ -3526,6 +3593,8 @@ inline void Database::detachImagePointFromObjectPoint(const Index32 imagePointId
 
 	const TemplatedScopedLock<tThreadSafe> scopedLock(databaseLock);
 
+	++databaseVersion;
+
 	ImagePointMap::iterator iI = databaseImagePointMap.find(imagePointId);
 	ocean_assert(iI != databaseImagePointMap.end());
 
@@ -3555,6 +3624,8 @@ inline void Database::attachImagePointToPose(const Index32 imagePointId, const I
 
 	const TemplatedScopedLock<tThreadSafe> scopedLock(databaseLock);
 
+	++databaseVersion;
+
 	ImagePointMap::iterator iI = databaseImagePointMap.find(imagePointId);
 	ocean_assert(iI != databaseImagePointMap.end());
 	ocean_assert(iI->second.poseId() == invalidId);
@@ -3582,6 +3653,8 @@ inline void Database::detachImagePointFromPose(const Index32 imagePointId)
 
 	const TemplatedScopedLock<tThreadSafe> scopedLock(databaseLock);
 
+	++databaseVersion;
+
 	ImagePointMap::iterator iI = databaseImagePointMap.find(imagePointId);
 	ocean_assert(iI != databaseImagePointMap.end());
 
@@ -3611,6 +3684,8 @@ inline void Database::setImagePoint(const Index32 imagePointId, const Vector2& i
 
 	const TemplatedScopedLock<tThreadSafe> scopedLock(databaseLock);
 
+	++databaseVersion;
+
 	const ImagePointMap::iterator i = databaseImagePointMap.find(imagePointId);
 	ocean_assert(i != databaseImagePointMap.end());
 
@@ -3624,6 +3699,8 @@ inline void Database::setObjectPoint(const Index32 objectPointId, const Vector3&
 
 	const TemplatedScopedLock<tThreadSafe> scopedLock(databaseLock);
 
+	++databaseVersion;
+
 	const ObjectPointMap::iterator i = databaseObjectPointMap.find(objectPointId);
 	ocean_assert(i != databaseObjectPointMap.end());
 
@@ -3637,6 +3714,8 @@ inline void Database::setObjectPoints(const Index32* objectPointIds, const Vecto
 
 	const TemplatedScopedLock<tThreadSafe> scopedLock(databaseLock);
 
+	++databaseVersion;
+
 	for (size_t n = 0; n < number; ++ n)
 	{
 		const ObjectPointMap::iterator i = databaseObjectPointMap.find(objectPointIds[n]);
@@ -3653,6 +3732,8 @@ inline void Database::setObjectPoints(const Index32* objectPointIds, const size_
 
 	const TemplatedScopedLock<tThreadSafe> scopedLock(databaseLock);
 
+	++databaseVersion;
+
 	for (size_t n = 0; n < number; ++ n)
 	{
 		const ObjectPointMap::iterator i = databaseObjectPointMap.find(objectPointIds[n]);
@@ -3667,6 +3748,8 @@ inline void Database::setObjectPoints(const Vector3& objectPoint)
 {
 	const TemplatedScopedLock<tThreadSafe> scopedLock(databaseLock);
 
+	++databaseVersion;
+
 	for (ObjectPointMap::iterator i = databaseObjectPointMap.begin(); i != databaseObjectPointMap.end(); ++i)
 		i->second.setPoint(objectPoint);
 }
@@ -3678,6 +3761,8 @@ inline void Database::setObjectPoint(const Index32 objectPointId, const Vector3&
 
 	const TemplatedScopedLock<tThreadSafe> scopedLock(databaseLock);
 
+	++databaseVersion;
+
 	const ObjectPointMap::iterator i = databaseObjectPointMap.find(objectPointId);
 	ocean_assert(i != databaseObjectPointMap.end());
 
@@ -3692,6 +3777,8 @@ inline void Database::setObjectPointPriority(const Index32 objectPointId, const
 
 	const TemplatedScopedLock<tThreadSafe> scopedLock(databaseLock);
 
+	++databaseVersion;
+
 	const ObjectPointMap::iterator i = databaseObjectPointMap.find(objectPointId);
 	ocean_assert(i != databaseObjectPointMap.end());
 
@@ -3705,6 +3792,8 @@ inline void Database::setPose(const Index32 poseId, const HomogenousMatrix4& pos
 
 	const TemplatedScopedLock<tThreadSafe> scopedLock(databaseLock);
 
+	++databaseVersion;
+
 	const PoseMap::iterator i = databasePoseMap.find(poseId);
 	ocean_assert(i != databasePoseMap.end());
 
@@ -3718,6 +3807,8 @@ inline void Database::setPoses(const Index32* poseIds, const HomogenousMatrix4*
 
 	const TemplatedScopedLock<tThreadSafe> scopedLock(databaseLock);
 
+	++databaseVersion;
+
 	for (size_t n = 0; n < number; ++n)
 	{
 		const PoseMap::iterator i = databasePoseMap.find(poseIds[n]);
@@ -3732,6 +3823,8 @@ inline void Database::setPoses(const ShiftVector<HomogenousMatrix4>& poses)
 {
 	const TemplatedScopedLock<tThreadSafe> scopedLock(databaseLock);
 
+	++databaseVersion;
+
 	for (ShiftVector<HomogenousMatrix4>::Index n = poses.firstIndex(); n < poses.endIndex(); ++n)
 	{
 		ocean_assert(n >= 0);
@@ -3749,6 +3842,8 @@ inline void Database::setPoses(const HomogenousMatrix4& pose)
 {
 	const TemplatedScopedLock<tThreadSafe> scopedLock(databaseLock);
 
+	++databaseVersion;
+
 	for (PoseMap::iterator i = databasePoseMap.begin(); i != databasePoseMap.end(); ++i)
 		i->second.setPose(pose);
 }
@@ -4878,6 +4973,8 @@ inline void Database::clear()
 {
 	const TemplatedScopedLock<tThreadSafe> scopedLock(databaseLock);
 
+	++databaseVersion;
+
 	databasePoseMap.clear();
 	databaseObjectPointMap.clear();
 	databaseImagePointMap.clear();
@@ -4894,6 +4991,8 @@ inline void Database::reset(const Vector3& referenceObjectPoint, const Homogenou
 {
 	const TemplatedScopedLock<tThreadSafe> scopedLock(databaseLock);
 
+	++databaseVersion;
+
 	for (ObjectPointMap::iterator i = databaseObjectPointMap.begin(); i != databaseObjectPointMap.end(); ++i)
 	{
 		i->second.setPoint(referenceObjectPoint);
@@ -4910,6 +5009,8 @@ void Database::reset(const size_t numberPoses, const Index32* poseIds, const Hom
 {
 	const TemplatedScopedLock<tThreadSafe> scopedLock(databaseLock);
 
+	++databaseVersion;
+
 	clear<false>();
 
 	databasePoses = 0u;
@@ -5058,6 +5159,8 @@ inline Database& Database::operator=(const Database& database)
 		databasePoses = database.databasePoses;
 		databaseObjectPointIdCounter = database.databaseObjectPointIdCounter;
 		databaseImagePointIdCounter = database.databaseImagePointIdCounter;
+
+		++databaseVersion;
 	}
 
 	return *this;
@@ -5079,6 +5182,9 @@ inline Database& Database::operator=(Database&& database) noexcept
 		database.databasePoses = 0u;
 		database.databaseObjectPointIdCounter = invalidId;
 		database.databaseImagePointIdCounter = invalidId;
+
+		++databaseVersion;
+		++database.databaseVersion;
 	}
 
 	return *this;
@@ -44,14 +44,27 @@ bool HomographyTracker::trackPoints(const Frame& currentFrame, const Frame& yPre
 		return false;
 	}
 
+	frameAllocations_ = 0u;
+
+	// the pyramid reuses its memory as long as the frame type does not change, the finest layer is located at the beginning of the memory
+
+	const void* const currentPyramidMemory = currentFramePyramid_.isValid() ? currentFramePyramid_.finestLayer().constdata<void>() : nullptr;
+
 	if (!currentFramePyramid_.replace(currentFrame, CV::FramePyramid::DM_FILTER_14641, pyramidLayers, true /*copyFirstLayer*/, worker))
 	{
 		return false;
 	}
 
+	if (currentFramePyramid_.finestLayer().constdata<void>() != currentPyramidMemory)
+	{
+		++frameAllocations_;
+	}
+
 	if (!previousFramePyramid_)
 	{
 		// this is the first function call so that we simply store the frame pyramid of the current frame and we return the identity homography
+		allocations_ += frameAllocations_;
+
 		std::swap(previousFramePyramid_, currentFramePyramid_);
 
 		homography.toIdentity();
@@ -66,26 +79,35 @@ bool HomographyTracker::trackPoints(const Frame& currentFrame, const Frame& yPre
 	}
 	else
 	{
-		Vectors2 clippedPreviousPositions;
-		clippedPreviousPositions.reserve(previousPositions.size());
+		if (clippedPreviousPositions_.capacity() < previousPositions.size())
+		{
+			++frameAllocations_;
+		}
+
+		clippedPreviousPositions_.clear();
+		clippedPreviousPositions_.reserve(previousPositions.size());
 
 		for (const Vector2& previousPoint : previousPositions)
 		{
 			if (previousPoint.x() >= frameBorder && previousPoint.x() < Scalar(currentFrame.width()) - frameBorder && previousPoint.y() >= frameBorder && previousPoint.y() < Scalar(currentFrame.height()) - frameBorder)
 			{
-				clippedPreviousPositions.emplace_back(previousPoint);
+				clippedPreviousPositions_.emplace_back(previousPoint);
 			}
 		}
 
-		if (clippedPreviousPositions.empty())
+		if (clippedPreviousPositions_.empty())
 		{
+			allocations_ += frameAllocations_;
+
 			std::swap(previousFramePyramid_, currentFramePyramid_);
 			return false;
 		}
 
-		result = trackPoints(yPreviousFrame, previousFramePyramid_, currentFramePyramid_, randomGenerator, clippedPreviousPositions, homography, worker, patchSize_);
+		result = trackPoints(yPreviousFrame, previousFramePyramid_, currentFramePyramid_, randomGenerator, clippedPreviousPositions_, homography, worker, patchSize_);
 	}
 
+	allocations_ += frameAllocations_;
+
 	std::swap(previousFramePyramid_, currentFramePyramid_);
 
 	return result;
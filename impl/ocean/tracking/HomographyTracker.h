@@ -81,6 +81,21 @@ class OCEAN_TRACKING_EXPORT HomographyTracker
 		 */
 		inline void clear();
 
+		/**
+		 * Returns the number of buffer allocations which have been necessary for the most recent frame.
+		 * The tracker keeps two frame pyramids and a buffer for image points which are swapped and reused for each new frame.<br>
+		 * Once the tracker has seen two frames with the same frame type (and a similar number of image points), the number of allocations is zero.
+		 * @return The number of allocations of the frame pyramids and the point buffer during the most recent call of trackPoints()
+		 */
+		inline unsigned int frameAllocations() const;
+
+		/**
+		 * Returns the overall number of buffer allocations which have been necessary since the creation of this tracker.
+		 * @return The overall number of allocations of the frame pyramids and the point buffer
+		 * @see frameAllocations().
+		 */
+		inline uint64_t allocations() const;
+
 		/**
 		 * Tracks a group of given image points from the previous frame to the current frame and determines the corresponding homography afterwards.
 		 * The resulting homography will transform points defined in the previous frame to points defined in the current frame (pointCurrent = H * pointPrevious).
@@ -115,6 +130,15 @@ class OCEAN_TRACKING_EXPORT HomographyTracker
 
 		/// The size of the image patches used for tracking, possible values can be [5, 7, 15, 31].
 		unsigned int patchSize_ = 31u;
+
+		/// The reusable buffer for the image points of the previous frame not located in the frame border.
+		Vectors2 clippedPreviousPositions_;
+
+		/// The number of buffer allocations of the most recent frame.
+		unsigned int frameAllocations_ = 0u;
+
+		/// The overall number of buffer allocations.
+		uint64_t allocations_ = 0ull;
 };
 
 HomographyTracker::HomographyTracker(const unsigned int patchSize) :
@@ -140,6 +164,16 @@ inline void HomographyTracker::clear()
 	previousFramePyramid_.clear();
 }
 
+inline unsigned int HomographyTracker::frameAllocations() const
+{
+	return frameAllocations_;
+}
+
+inline uint64_t HomographyTracker::allocations() const
+{
+	return allocations_;
+}
+
 inline Vectors2 HomographyTracker::transformPoints(const Vectors2& points, const SquareMatrix3& transformation)
 {
 	Vectors2 result;
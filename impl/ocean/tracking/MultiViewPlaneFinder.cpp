@@ -17,7 +17,7 @@ namespace Ocean
 namespace Tracking
 {
 
-bool MultiViewPlaneFinder::determinePlane(const PinholeCamera& pinholeCamera, Plane3& plane, HomogenousMatrices4& poses, const HomogenousMatrix4& initialPose, const Plane3& initialPlane) const
+bool MultiViewPlaneFinder::determinePlane(const PinholeCamera& pinholeCamera, Plane3& plane, HomogenousMatrices4& poses, const HomogenousMatrix4& initialPose, const Plane3& initialPlane, Worker* worker) const
 {
 	ocean_assert(imagePointCorrespondences.size() >= 2);
 
@@ -42,7 +42,7 @@ bool MultiViewPlaneFinder::determinePlane(const PinholeCamera& pinholeCamera, Pl
 	}
 
 	HomogenousMatrices4 successivePoses;
-	if (!determineInitialPoses(pinholeCamera, initialPose, plane, imagePointsFirst, successiveImagePoints, successivePoses))
+	if (!determineInitialPoses(pinholeCamera, initialPose, plane, imagePointsFirst, successiveImagePoints, successivePoses, worker))
 	{
 		return false;
 	}
@@ -60,6 +60,60 @@ bool MultiViewPlaneFinder::determinePlane(const PinholeCamera& pinholeCamera, Pl
 	return true;
 }
 
+bool MultiViewPlaneFinder::refinePlane(const PinholeCamera& pinholeCamera, Plane3& plane, HomogenousMatrices4& poses, Worker* worker) const
+{
+	ocean_assert(pinholeCamera.isValid() && plane.isValid());
+	ocean_assert(!poses.empty() && poses.size() <= imagePointCorrespondences.size());
+
+	const std::vector<Vectors2>& correspondences = imagePointCorrespondences.correspondences();
+
+	if (correspondences.size() < 2 || !plane.isValid() || poses.empty() || poses.size() > correspondences.size())
+	{
+		return false;
+	}
+
+	const HomogenousMatrix4 initialPose(poses.front());
+	ocean_assert(initialPose.isValid());
+
+	const Vectors2& imagePointsFirst = correspondences.front();
+	const std::vector<Vectors2> successiveImagePoints(correspondences.cbegin() + 1, correspondences.cend());
+
+	// the poses of all known views are used as they are, only the poses of new views need to be determined
+
+	HomogenousMatrices4 successivePoses(poses.cbegin() + 1, poses.cend());
+	const size_t knownSuccessivePoses = successivePoses.size();
+
+	if (knownSuccessivePoses < successiveImagePoints.size())
+	{
+		if (!determineInitialPoses(pinholeCamera, initialPose, plane, imagePointsFirst, successiveImagePoints, successivePoses, worker, knownSuccessivePoses))
+		{
+			return false;
+		}
+	}
+
+	ocean_assert(successivePoses.size() == successiveImagePoints.size());
+
+	// the optimization writes into temporary objects, so that the known plane and poses are untouched in case the optimization fails
+
+	HomogenousMatrices4 optimizedPoses;
+	Plane3 optimizedPlane;
+
+	if (!Geometry::NonLinearOptimizationPlane::optimizePosesPlane(pinholeCamera, initialPose, imagePointsFirst, successivePoses, plane, successiveImagePoints, pinholeCamera.hasDistortionParameters(), optimizedPoses, optimizedPlane, 30u, Geometry::Estimator::ET_SQUARE, Scalar(0.001), Scalar(5), true))
+	{
+		return false;
+	}
+
+	ocean_assert(optimizedPlane.isValid());
+
+	optimizedPoses.insert(optimizedPoses.begin(), initialPose);
+	ocean_assert(optimizedPoses.size() == correspondences.size());
+
+	plane = optimizedPlane;
+	poses = std::move(optimizedPoses);
+
+	return true;
+}
+
 bool MultiViewPlaneFinder::determinePlaneFromTwoViews(const PinholeCamera& pinholeCamera, const HomogenousMatrix4& poseFirst, const Plane3& roughPlane, const ConstIndexedAccessor<Vector2>& imagePointsFirst, const ConstIndexedAccessor<Vector2>& imagePointsSecond, HomogenousMatrix4& poseSecond, Plane3& plane)
 {
 	ocean_assert(pinholeCamera.isValid() && poseFirst.isValid() && roughPlane.isValid());
@@ -70,26 +124,42 @@ bool MultiViewPlaneFinder::determinePlaneFromTwoViews(const PinholeCamera& pinho
 	return Geometry::NonLinearOptimizationPlane::optimizeOnePoseOnePlane(pinholeCamera, poseFirst, poseFirstOffset, roughPlane, imagePointsFirst, imagePointsSecond, pinholeCamera.hasDistortionParameters(), poseSecond, plane, 30u, Geometry::Estimator::ET_SQUARE);
 }
 
-bool MultiViewPlaneFinder::determineInitialPoses(const PinholeCamera& pinholeCamera, const HomogenousMatrix4& poseFirst, const Plane3& plane, const Vectors2& imagePointsFirst, const std::vector<Vectors2>& imagePointsSuccessive, HomogenousMatrices4& posesSuccessive)
+bool MultiViewPlaneFinder::determineInitialPoses(const PinholeCamera& pinholeCamera, const HomogenousMatrix4& poseFirst, const Plane3& plane, const Vectors2& imagePointsFirst, const std::vector<Vectors2>& imagePointsSuccessive, HomogenousMatrices4& posesSuccessive, Worker* worker, const size_t firstSuccessive)
 {
 	ocean_assert(pinholeCamera.isValid() && poseFirst.isValid() && plane.isValid());
 	ocean_assert(!imagePointsSuccessive.empty());
 	ocean_assert(imagePointsFirst.size() == imagePointsSuccessive.front().size());
+	ocean_assert(firstSuccessive < imagePointsSuccessive.size());
 
-	const Vectors3 objectPoints(Geometry::Utilities::backProjectImagePoints(pinholeCamera, poseFirst, plane, imagePointsFirst.data(), imagePointsFirst.size(), pinholeCamera.hasDistortionParameters()));
-	posesSuccessive.resize(imagePointsSuccessive.size());
-
-	for (size_t n = 0; n < imagePointsSuccessive.size(); ++n)
+	for (size_t n = firstSuccessive; n < imagePointsSuccessive.size(); ++n)
 	{
-		const Vectors2& imagePoints = imagePointsSuccessive[n];
-		ocean_assert(imagePoints.size() == objectPoints.size());
+		ocean_assert(imagePointsSuccessive[n].size() == imagePointsFirst.size());
 
-		if (imagePoints.size() != objectPoints.size())
+		if (imagePointsSuccessive[n].size() != imagePointsFirst.size())
 		{
 			return false;
 		}
+	}
+
+	const Vectors3 objectPoints(Geometry::Utilities::backProjectImagePoints(pinholeCamera, poseFirst, plane, imagePointsFirst.data(), imagePointsFirst.size(), pinholeCamera.hasDistortionParameters()));
+	posesSuccessive.resize(imagePointsSuccessive.size());
+
+	const unsigned int numberSuccessive = (unsigned int)(imagePointsSuccessive.size() - firstSuccessive);
+
+	// the poses of the individual views are independent of each other
+
+	if (worker != nullptr && numberSuccessive >= 2u)
+	{
+		worker->executeFunction(Worker::Function::createStatic(&MultiViewPlaneFinder::determineInitialPosesSubset, &pinholeCamera, &poseFirst, &objectPoints, &imagePointsSuccessive, posesSuccessive.data(), 0u, 0u), (unsigned int)(firstSuccessive), numberSuccessive);
+	}
+	else
+	{
+		determineInitialPosesSubset(&pinholeCamera, &poseFirst, &objectPoints, &imagePointsSuccessive, posesSuccessive.data(), (unsigned int)(firstSuccessive), numberSuccessive);
+	}
 
-		if (!Geometry::NonLinearOptimizationPose::optimizePose(AnyCameraPinhole(pinholeCamera), poseFirst, ConstArrayAccessor<Vector3>(objectPoints), ConstArrayAccessor<Vector2>(imagePoints), posesSuccessive[n]))
+	for (size_t n = firstSuccessive; n < posesSuccessive.size(); ++n)
+	{
+		if (!posesSuccessive[n].isValid())
 		{
 			return false;
 		}
@@ -98,6 +168,25 @@ bool MultiViewPlaneFinder::determineInitialPoses(const PinholeCamera& pinholeCam
 	return true;
 }
 
+void MultiViewPlaneFinder::determineInitialPosesSubset(const PinholeCamera* pinholeCamera, const HomogenousMatrix4* poseFirst, const Vectors3* objectPoints, const std::vector<Vectors2>* imagePointsSuccessive, HomogenousMatrix4* posesSuccessive, const unsigned int firstSuccessive, const unsigned int numberSuccessive)
+{
+	ocean_assert(pinholeCamera != nullptr && poseFirst != nullptr && objectPoints != nullptr && imagePointsSuccessive != nullptr && posesSuccessive != nullptr);
+	ocean_assert(firstSuccessive + numberSuccessive <= imagePointsSuccessive->size());
+
+	const AnyCameraPinhole anyCamera(*pinholeCamera);
+
+	for (unsigned int n = firstSuccessive; n < firstSuccessive + numberSuccessive; ++n)
+	{
+		const Vectors2& imagePoints = (*imagePointsSuccessive)[n];
+		ocean_assert(imagePoints.size() == objectPoints->size());
+
+		if (!Geometry::NonLinearOptimizationPose::optimizePose(anyCamera, *poseFirst, ConstArrayAccessor<Vector3>(*objectPoints), ConstArrayAccessor<Vector2>(imagePoints), posesSuccessive[n]))
+		{
+			posesSuccessive[n].toNull();
+		}
+	}
+}
+
 }
 
 }
@@ -12,6 +12,7 @@
 #include "ocean/tracking/PlaneFinder.h"
 
 #include "ocean/base/Accessor.h"
+#include "ocean/base/Worker.h"
 
 namespace Ocean
 {
@@ -36,9 +37,23 @@ class OCEAN_TRACKING_EXPORT MultiViewPlaneFinder : public PlaneFinder
 		 * @param poses Resulting poses that correspond to the given image points
 		 * @param initialPose Pose of the first camera position
 		 * @param initialPlane Initial plane that will be determined more accurate (the plane can be very rough while it should be in front of the initial pose)
+		 * @param worker Optional worker object to distribute the determination of the initial poses
 		 * @return True, if succeeded
+		 * @see refinePlane().
 		 */
-		bool determinePlane(const PinholeCamera& pinholeCamera, Plane3& plane, HomogenousMatrices4& poses, const HomogenousMatrix4& initialPose = HomogenousMatrix4(Vector3(0, 0, 1)), const Plane3& initialPlane = Plane3(Vector3(0, 0, 1), 0)) const;
+		bool determinePlane(const PinholeCamera& pinholeCamera, Plane3& plane, HomogenousMatrices4& poses, const HomogenousMatrix4& initialPose = HomogenousMatrix4(Vector3(0, 0, 1)), const Plane3& initialPlane = Plane3(Vector3(0, 0, 1), 0), Worker* worker = nullptr) const;
+
+		/**
+		 * Refines a known 3D plane and the corresponding 6DOF camera poses with all currently stored sets of image points.
+		 * In contrast to determinePlane(), this function does not determine the plane from scratch but starts with a plane and poses determined for the first sets of image points (e.g., in a previous call).<br>
+		 * Only the poses of views which have been added since are determined, afterwards the plane and all poses are optimized jointly.
+		 * @param pinholeCamera The pinhole camera object that is applied for the projection
+		 * @param plane The known 3D plane which will be refined, must be valid
+		 * @param poses The known camera poses, one for each of the first sets of image points with the pose of the first view at the front, receiving one pose for each stored set of image points, with range [1, size()]
+		 * @param worker Optional worker object to distribute the determination of the poses of new views
+		 * @return True, if succeeded; False, if failed while the given plane and poses are untouched
+		 */
+		bool refinePlane(const PinholeCamera& pinholeCamera, Plane3& plane, HomogenousMatrices4& poses, Worker* worker = nullptr) const;
 
 		/**
 		 * Returns whether this plane finder object holds at least two sets of corresponding image points.
@@ -69,9 +84,23 @@ class OCEAN_TRACKING_EXPORT MultiViewPlaneFinder : public PlaneFinder
 		 * @param imagePointsFirst Image points in the first view associated with the first pose
 		 * @param imagePointsSuccessive The sets of image points visible in the successive views
 		 * @param posesSuccessive Resulting poses for the successive views
+		 * @param worker Optional worker object to distribute the computation
+		 * @param firstSuccessive The index of the first successive view for which the pose will be determined, all poses of views before this index are expected to be known already, with range [0, imagePointsSuccessive.size())
 		 * @return True, if succeeded
 		 */
-		static bool determineInitialPoses(const PinholeCamera& pinholeCamera, const HomogenousMatrix4& poseFirst, const Plane3& plane, const Vectors2& imagePointsFirst, const std::vector<Vectors2>& imagePointsSuccessive, HomogenousMatrices4& posesSuccessive);
+		static bool determineInitialPoses(const PinholeCamera& pinholeCamera, const HomogenousMatrix4& poseFirst, const Plane3& plane, const Vectors2& imagePointsFirst, const std::vector<Vectors2>& imagePointsSuccessive, HomogenousMatrices4& posesSuccessive, Worker* worker = nullptr, const size_t firstSuccessive = 0);
+
+		/**
+		 * Determines the poses of a subset of successive views.
+		 * @param pinholeCamera The pinhole camera object that is applied for the projection
+		 * @param poseFirst First pose that is associated with the image points from the first view
+		 * @param objectPoints The 3D object points located on the plane, one for each image point in the first view
+		 * @param imagePointsSuccessive The sets of image points visible in the successive views
+		 * @param posesSuccessive The resulting poses for the successive views, a pose will be invalid if it could not be determined
+		 * @param firstSuccessive The index of the first successive view to be handled
+		 * @param numberSuccessive The number of successive views to be handled
+		 */
+		static void determineInitialPosesSubset(const PinholeCamera* pinholeCamera, const HomogenousMatrix4* poseFirst, const Vectors3* objectPoints, const std::vector<Vectors2>* imagePointsSuccessive, HomogenousMatrix4* posesSuccessive, const unsigned int firstSuccessive, const unsigned int numberSuccessive);
 };
 
 inline MultiViewPlaneFinder::operator bool() const
@@ -7,6 +7,8 @@
 
 #include "ocean/tracking/PointCorrespondences.h"
 
+#include "ocean/geometry/Error.h"
+
 #include "ocean/base/Median.h"
 #include "ocean/base/Utilities.h"
 
@@ -21,32 +23,10 @@ unsigned int PointCorrespondences::determineValidCorrespondencesIF(const Homogen
 	ocean_assert(objectPoints && imagePoints);
 	ocean_assert(sqrPixelError >= 0);
 
-	unsigned int result = 0u;
+	const size_t result = Geometry::Error::determineValidCorrespondencesIF<true>(invertedFlippedExtrinsic, pinholeCamera, objectPoints, imagePoints, correspondences, distortImagePoints, sqrPixelError, validCorrespondences);
 
-	if (distortImagePoints && pinholeCamera.hasDistortionParameters())
-	{
-		for (unsigned int n = 0u; n < correspondences; ++n)
-			if (pinholeCamera.projectToImageIF<true, true>(invertedFlippedExtrinsic, objectPoints[n]).sqrDistance(imagePoints[n]) <= sqrPixelError)
-			{
-				++result;
-
-				if (validCorrespondences)
-					validCorrespondences->push_back(n);
-			}
-	}
-	else
-	{
-		for (unsigned int n = 0u; n < correspondences; ++n)
-			if (pinholeCamera.projectToImageIF<false, true>(invertedFlippedExtrinsic, objectPoints[n]).sqrDistance(imagePoints[n]) <= sqrPixelError)
-			{
-				++result;
-
-				if (validCorrespondences)
-					validCorrespondences->push_back(n);
-			}
-	}
-
-	return result;
+	ocean_assert(NumericT<unsigned int>::isInsideValueRange(result));
+	return (unsigned int)(result);
 }
 
 void PointCorrespondences::removeInvalidCorrespondencesIF(const HomogenousMatrix4& invertedFlippedExtrinsic, const PinholeCamera& pinholeCamera, Vectors3& objectPoints, Vectors2& imagePoints, const bool distortImagePoints, const Scalar sqrPixelError)
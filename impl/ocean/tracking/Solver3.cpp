@@ -395,7 +395,7 @@ Solver3::ObjectPointToPoseIndexImagePointCorrespondenceAccessor::ObjectPointToPo
 	}
 }
 
-bool Solver3::determineInitialObjectPointsFromSparseKeyFrames(const Database& database, const PinholeCamera& pinholeCamera, RandomGenerator& randomGenerator, const unsigned int lowerFrame, const unsigned int startFrame, const unsigned int upperFrame, const Scalar maximalStaticImagePointFilterRatio, Vectors3& initialObjectPoints, Indices32& initialObjectPointIds, const RelativeThreshold& pointsThreshold, const unsigned int minimalKeyFrames, const unsigned int maximalKeyFrames, const Scalar maximalSqrError, Indices32* usedPoseIds, Scalar* finalSqrError, Scalar* finalImagePointDistance, bool* abort)
+bool Solver3::determineInitialObjectPointsFromSparseKeyFrames(const Database& database, const PinholeCamera& pinholeCamera, RandomGenerator& randomGenerator, const unsigned int lowerFrame, const unsigned int startFrame, const unsigned int upperFrame, const Scalar maximalStaticImagePointFilterRatio, Vectors3& initialObjectPoints, Indices32& initialObjectPointIds, const RelativeThreshold& pointsThreshold, const unsigned int minimalKeyFrames, const unsigned int maximalKeyFrames, const Scalar maximalSqrError, Indices32* usedPoseIds, Scalar* finalSqrError, Scalar* finalImagePointDistance, Worker* worker, bool* abort)
 {
 	ocean_assert(pinholeCamera.isValid());
 	ocean_assert(lowerFrame < upperFrame);
@@ -486,7 +486,7 @@ bool Solver3::determineInitialObjectPointsFromSparseKeyFrames(const Database& da
 	Indices32 roughPoseIndices;
 	Indices32 roughObjectPointIndices;
 
-	if (!determineInitialObjectPointsFromSparseKeyFramesRANSAC(pinholeCamera, keyFramesImagePointGroups, randomGenerator, roughPoses, roughPoseIndices, roughObjectPoints, roughObjectPointIndices, ransacIterations, RelativeThreshold(10u, Scalar(0.3), 25u), maximalSqrError, &database, &keyFrameIndices, &objectPointIds, abort))
+	if (!determineInitialObjectPointsFromSparseKeyFramesRANSAC(pinholeCamera, keyFramesImagePointGroups, randomGenerator, roughPoses, roughPoseIndices, roughObjectPoints, roughObjectPointIndices, ransacIterations, RelativeThreshold(10u, Scalar(0.3), 25u), maximalSqrError, &database, &keyFrameIndices, &objectPointIds, worker, abort))
 	{
 		return false;
 	}
@@ -788,7 +788,7 @@ bool Solver3::determineInitialObjectPointsFromSparseKeyFramesBySteps(const Datab
 	return result;
 }
 
-bool Solver3::determineInitialObjectPointsFromSparseKeyFramesRANSAC(const PinholeCamera& pinholeCamera, const Database::ImagePointGroups& imagePointGroups, RandomGenerator& randomGenerator, HomogenousMatrices4& poses, Indices32& validPoseIndices, Vectors3& objectPoints, Indices32& validObjectPointIndices, const unsigned int iterations, const RelativeThreshold& minimalValidObjectPoints, const Scalar maximalSqrError, const Database* database, const Indices32* keyFrameIds, const Indices32* objectPointIds, bool* abort)
+bool Solver3::determineInitialObjectPointsFromSparseKeyFramesRANSAC(const PinholeCamera& pinholeCamera, const Database::ImagePointGroups& imagePointGroups, RandomGenerator& randomGenerator, HomogenousMatrices4& poses, Indices32& validPoseIndices, Vectors3& objectPoints, Indices32& validObjectPointIndices, const unsigned int iterations, const RelativeThreshold& minimalValidObjectPoints, const Scalar maximalSqrError, const Database* database, const Indices32* keyFrameIds, const Indices32* objectPointIds, Worker* worker, bool* abort)
 {
 	ocean_assert(pinholeCamera.isValid());
 	ocean_assert(imagePointGroups.size() >= 2);
@@ -800,80 +800,16 @@ bool Solver3::determineInitialObjectPointsFromSparseKeyFramesRANSAC(const Pinhol
 
 	Scalar bestPointDistance = Numeric::maxValue();
 
-	for (unsigned int n = 0u; n < iterations && (!abort || !*abort); ++n)
-	{
-		// **TODO** a iteration over each possible pair could be a good idea
-
-		unsigned int index0, index1;
-		RandomI::random(randomGenerator, (unsigned int)imagePointGroups.size() - 1u, index0, index1);
-		ocean_assert(index0 != index1);
-
-		HomogenousMatrices4 iterationPoses;
-		Indices32 iterationPoseIndices;
-		Vectors3 iterationObjectPoints;
-		Indices32 iterationObjectPointIndices;
-
-		if (determineInitialObjectPointsFromSparseKeyFrames(pinholeCamera, imagePointGroups, randomGenerator, index0, index1, iterationPoses, iterationPoseIndices, iterationObjectPoints, iterationObjectPointIndices, minimalValidObjectPoints, maximalSqrError))
-		{
-			ocean_assert(iterationPoses.size() == iterationPoseIndices.size());
-			ocean_assert(iterationObjectPoints.size() == iterationObjectPointIndices.size());
-
-			// our target is to find several object points visible in several camera poses
-			// bad: 2 poses, large number of object points
-			// good: several poses, several object points
-			// bad: several poses, a small number of object points
-			// therefore, we take the product of the number of poses and object points as measure for a good result
-
-			if (iterationPoses.size() * iterationObjectPoints.size() >= poses.size() * objectPoints.size())
-			{
-				Scalar pointDistance = 0;
-
-				for (size_t i = 0u; i < iterationPoses.size(); ++i)
-				{
-					const Index32 poseIndex = iterationPoseIndices[i];
-
-					const Vectors2 iterationImagePoints = Subset::subset(imagePointGroups[poseIndex], iterationObjectPointIndices);
-					pointDistance += averagePointDistance(iterationImagePoints.data(), iterationImagePoints.size());
-				}
-
-				pointDistance /= Scalar(iterationPoses.size());
-
-				// we use the 'point sparsity' of the image points to find image points with large separation (as separated points will provide better than points close to each other)
-				if (iterationPoses.size() * iterationObjectPoints.size() > poses.size() * objectPoints.size() || pointDistance > bestPointDistance)
-				{
-					// now we finally can ensure that all intermediate poses (which have not been investigated) can be determined (than the subset of poses was not representative and we have to select other ones)
-
-					bool allPosesValid = true;
-					if (database && keyFrameIds && objectPointIds)
-					{
-						Indices32 poseIds = Subset::subset(*keyFrameIds, iterationPoseIndices);
-						std::sort(poseIds.begin(), poseIds.end());
-
-						const Indices32 iterationObjectPointIds = Subset::subset(*objectPointIds, iterationObjectPointIndices);
-
-						for (unsigned int poseId = poseIds.front() + 1u; (!abort || !*abort) && allPosesValid && poseId < poseIds.back(); ++poseId)
-						{
-							Scalar finalSqrError = Numeric::maxValue();
-							if (determinePose(*database, AnyCameraPinhole(pinholeCamera), randomGenerator, poseId, ConstArrayAccessor<Vector3>(iterationObjectPoints), ConstArrayAccessor<Index32>(iterationObjectPointIds), HomogenousMatrix4(false), Geometry::Estimator::ET_SQUARE, Scalar(0.9), maximalSqrError, &finalSqrError).isNull() || finalSqrError * 2 > maximalSqrError)
-							{
-								allPosesValid = false;
-							}
-						}
-					}
-
-					if (allPosesValid)
-					{
-						bestPointDistance = pointDistance;
-
-						objectPoints = std::move(iterationObjectPoints);
-						poses = std::move(iterationPoses);
+	unsigned int remainingIterations = iterations;
 
-						validPoseIndices = std::move(iterationPoseIndices);
-						validObjectPointIndices = std::move(iterationObjectPointIndices);
-					}
-				}
-			}
-		}
+	if (worker != nullptr)
+	{
+		Lock lock;
+		worker->executeFunction(Worker::Function::createStatic(&determineInitialObjectPointsFromSparseKeyFramesRANSACSubset, &pinholeCamera, &imagePointGroups, &randomGenerator, &poses, &validPoseIndices, &objectPoints, &validObjectPointIndices, &bestPointDistance, &minimalValidObjectPoints, maximalSqrError, database, keyFrameIds, objectPointIds, &remainingIterations, &lock, abort, 0u, 0u), 0u, iterations);
+	}
+	else
+	{
+		determineInitialObjectPointsFromSparseKeyFramesRANSACSubset(&pinholeCamera, &imagePointGroups, &randomGenerator, &poses, &validPoseIndices, &objectPoints, &validObjectPointIndices, &bestPointDistance, &minimalValidObjectPoints, maximalSqrError, database, keyFrameIds, objectPointIds, &remainingIterations, nullptr, abort, 0u, iterations);
 	}
 
 #ifdef OCEAN_DEBUG
@@ -4280,7 +4216,7 @@ void Solver3::determineInitialObjectPointsFromSparseKeyFramesByStepsSubset(const
 		iterationObjectPointIds.clear();
 		iterationPoseIds.clear();
 
-		if (determineInitialObjectPointsFromSparseKeyFrames(*database, *pinholeCamera, localRandomGenerator, lowerFrame, startFrame, upperFrame, maximalStaticImagePointFilterRatio, iterationObjectPoints, iterationObjectPointIds, *pointsThreshold, minimalKeyFrames, maximalKeyFrames, maximalSqrError, &iterationPoseIds, &iterationSqrError, &iterationPointDistance, abort))
+		if (determineInitialObjectPointsFromSparseKeyFrames(*database, *pinholeCamera, localRandomGenerator, lowerFrame, startFrame, upperFrame, maximalStaticImagePointFilterRatio, iterationObjectPoints, iterationObjectPointIds, *pointsThreshold, minimalKeyFrames, maximalKeyFrames, maximalSqrError, &iterationPoseIds, &iterationSqrError, &iterationPointDistance, nullptr, abort))
 		{
 			const size_t iterationProduct = iterationObjectPoints.size() * iterationPoseIds.size();
 
@@ -4300,6 +4236,135 @@ void Solver3::determineInitialObjectPointsFromSparseKeyFramesByStepsSubset(const
 	}
 }
 
+void Solver3::determineInitialObjectPointsFromSparseKeyFramesRANSACSubset(const PinholeCamera* pinholeCamera, const Database::ImagePointGroups* imagePointGroups, RandomGenerator* randomGenerator, HomogenousMatrices4* poses, Indices32* validPoseIndices, Vectors3* objectPoints, Indices32* validObjectPointIndices, Scalar* bestPointDistance, const RelativeThreshold* minimalValidObjectPoints, const Scalar maximalSqrError, const Database* database, const Indices32* keyFrameIds, const Indices32* objectPointIds, unsigned int* remainingIterations, Lock* lock, bool* abort, unsigned int /*firstIteration*/, unsigned int /*numberIterations*/)
+{
+	ocean_assert(pinholeCamera && pinholeCamera->isValid());
+	ocean_assert(imagePointGroups && imagePointGroups->size() >= 2);
+	ocean_assert(randomGenerator && minimalValidObjectPoints);
+	ocean_assert(poses && validPoseIndices && objectPoints && validObjectPointIndices && bestPointDistance);
+	ocean_assert(remainingIterations);
+
+	ocean_assert((database && keyFrameIds && objectPointIds) || (!database && !keyFrameIds && !objectPointIds));
+
+	RandomGenerator localRandomGenerator(*randomGenerator);
+
+	Scalar localBestPointDistance = Numeric::maxValue();
+	HomogenousMatrices4 localPoses;
+	Indices32 localValidPoseIndices;
+	Vectors3 localObjectPoints;
+	Indices32 localValidObjectPointIndices;
+
+	HomogenousMatrices4 iterationPoses;
+	Indices32 iterationPoseIndices;
+	Vectors3 iterationObjectPoints;
+	Indices32 iterationObjectPointIndices;
+
+	while (!abort || !*abort)
+	{
+		{
+			// we check whether all parallel threads have handled the number of requested iterations
+			const OptionalScopedLock scopedLock(lock);
+
+			if (*remainingIterations == 0u)
+			{
+				break;
+			}
+
+			(*remainingIterations)--;
+		}
+
+		// **TODO** a iteration over each possible pair could be a good idea
+
+		unsigned int index0, index1;
+		RandomI::random(localRandomGenerator, (unsigned int)imagePointGroups->size() - 1u, index0, index1);
+		ocean_assert(index0 != index1);
+
+		iterationPoses.clear();
+		iterationPoseIndices.clear();
+		iterationObjectPoints.clear();
+		iterationObjectPointIndices.clear();
+
+		if (determineInitialObjectPointsFromSparseKeyFrames(*pinholeCamera, *imagePointGroups, localRandomGenerator, index0, index1, iterationPoses, iterationPoseIndices, iterationObjectPoints, iterationObjectPointIndices, *minimalValidObjectPoints, maximalSqrError))
+		{
+			ocean_assert(iterationPoses.size() == iterationPoseIndices.size());
+			ocean_assert(iterationObjectPoints.size() == iterationObjectPointIndices.size());
+
+			// our target is to find several object points visible in several camera poses
+			// bad: 2 poses, large number of object points
+			// good: several poses, several object points
+			// bad: several poses, a small number of object points
+			// therefore, we take the product of the number of poses and object points as measure for a good result
+
+			if (iterationPoses.size() * iterationObjectPoints.size() >= localPoses.size() * localObjectPoints.size())
+			{
+				Scalar pointDistance = 0;
+
+				for (size_t i = 0u; i < iterationPoses.size(); ++i)
+				{
+					const Index32 poseIndex = iterationPoseIndices[i];
+
+					const Vectors2 iterationImagePoints = Subset::subset((*imagePointGroups)[poseIndex], iterationObjectPointIndices);
+					pointDistance += averagePointDistance(iterationImagePoints.data(), iterationImagePoints.size());
+				}
+
+				pointDistance /= Scalar(iterationPoses.size());
+
+				// we use the 'point sparsity' of the image points to find image points with large separation (as separated points will provide better than points close to each other)
+				if (iterationPoses.size() * iterationObjectPoints.size() > localPoses.size() * localObjectPoints.size() || pointDistance > localBestPointDistance)
+				{
+					// now we finally can ensure that all intermediate poses (which have not been investigated) can be determined (than the subset of poses was not representative and we have to select other ones)
+
+					bool allPosesValid = true;
+					if (database && keyFrameIds && objectPointIds)
+					{
+						Indices32 poseIds = Subset::subset(*keyFrameIds, iterationPoseIndices);
+						std::sort(poseIds.begin(), poseIds.end());
+
+						const Indices32 iterationObjectPointIds = Subset::subset(*objectPointIds, iterationObjectPointIndices);
+
+						for (unsigned int poseId = poseIds.front() + 1u; (!abort || !*abort) && allPosesValid && poseId < poseIds.back(); ++poseId)
+						{
+							Scalar finalSqrError = Numeric::maxValue();
+							if (determinePose(*database, AnyCameraPinhole(*pinholeCamera), localRandomGenerator, poseId, ConstArrayAccessor<Vector3>(iterationObjectPoints), ConstArrayAccessor<Index32>(iterationObjectPointIds), HomogenousMatrix4(false), Geometry::Estimator::ET_SQUARE, Scalar(0.9), maximalSqrError, &finalSqrError).isNull() || finalSqrError * 2 > maximalSqrError)
+							{
+								allPosesValid = false;
+							}
+						}
+					}
+
+					if (allPosesValid)
+					{
+						localBestPointDistance = pointDistance;
+
+						localObjectPoints = std::move(iterationObjectPoints);
+						localPoses = std::move(iterationPoses);
+
+						localValidPoseIndices = std::move(iterationPoseIndices);
+						localValidObjectPointIndices = std::move(iterationObjectPointIndices);
+					}
+				}
+			}
+		}
+	}
+
+	if ((!abort || !*abort) && !localPoses.empty())
+	{
+		const OptionalScopedLock scopedLock(lock);
+
+		if (localPoses.size() * localObjectPoints.size() > poses->size() * objectPoints->size()
+				|| (localPoses.size() * localObjectPoints.size() == poses->size() * objectPoints->size() && localBestPointDistance > *bestPointDistance))
+		{
+			*poses = std::move(localPoses);
+			*validPoseIndices = std::move(localValidPoseIndices);
+
+			*objectPoints = std::move(localObjectPoints);
+			*validObjectPointIndices = std::move(localValidObjectPointIndices);
+
+			*bestPointDistance = localBestPointDistance;
+		}
+	}
+}
+
 void Solver3::determineInitialObjectPointsFromDenseFramesRANSACSubset(const PinholeCamera* pinholeCamera, const ImagePointGroups* imagePointGroups, RandomGenerator* randomGenerator, HomogenousMatrices4* validPoses, Indices32* validPoseIds, Vectors3* objectPoints, Indices32* validObjectPointIndices, Scalar* totalError, const RelativeThreshold* minimalValidObjectPoints, const Scalar maximalSqrError, unsigned int* remainingIterations, Lock* lock, bool* abort, unsigned int /*firstIteration*/, unsigned int /*numberIterations*/)
 {
 	ocean_assert(pinholeCamera && pinholeCamera->isValid());
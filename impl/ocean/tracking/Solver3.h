@@ -422,10 +422,11 @@ class OCEAN_TRACKING_EXPORT Solver3
 		 * @param usedPoseIds Optional resulting ids of all camera poses which have been used to determine the initial object points
 		 * @param finalSqrError Optional resulting final average error
 		 * @param finalImagePointDistance Optional resulting final average distance between the individual image points and the center of these image points
+		 * @param worker Optional worker object to distribute the RANSAC iterations
 		 * @param abort Optional abort statement allowing to stop the execution; True, if the execution has to stop
 		 * @return True, if succeeded
 		 */
-		static bool determineInitialObjectPointsFromSparseKeyFrames(const Database& database, const PinholeCamera& pinholeCamera, RandomGenerator& randomGenerator, const unsigned int lowerFrame, const unsigned int startFrame, const unsigned int upperFrame, const Scalar maximalStaticImagePointFilterRatio, Vectors3& initialObjectPoints, Indices32& initialObjectPointIds, const RelativeThreshold& pointsThreshold = RelativeThreshold(20u, Scalar(0.5), 100u), const unsigned int minimalKeyFrames = 3u, const unsigned int maximalKeyFrames = 10u, const Scalar maximalSqrError = Scalar(3.5 * 3.5), Indices32* usedPoseIds = nullptr, Scalar* finalSqrError = nullptr, Scalar* finalImagePointDistance = nullptr, bool* abort = nullptr);
+		static bool determineInitialObjectPointsFromSparseKeyFrames(const Database& database, const PinholeCamera& pinholeCamera, RandomGenerator& randomGenerator, const unsigned int lowerFrame, const unsigned int startFrame, const unsigned int upperFrame, const Scalar maximalStaticImagePointFilterRatio, Vectors3& initialObjectPoints, Indices32& initialObjectPointIds, const RelativeThreshold& pointsThreshold = RelativeThreshold(20u, Scalar(0.5), 100u), const unsigned int minimalKeyFrames = 3u, const unsigned int maximalKeyFrames = 10u, const Scalar maximalSqrError = Scalar(3.5 * 3.5), Indices32* usedPoseIds = nullptr, Scalar* finalSqrError = nullptr, Scalar* finalImagePointDistance = nullptr, Worker* worker = nullptr, bool* abort = nullptr);
 
 		/**
 		 * Determines the initial positions of 3D object points in a database if no camera poses or structure information is known.
@@ -507,11 +508,12 @@ class OCEAN_TRACKING_EXPORT Solver3
 		 * @param database Optional database holding the image points from the imagePointGroups to validate the resulting 3D object positions even for camera poses not corresponding to the provided groups of image points; if defined also 'keyFrameIds' and 'objectPointIds' must be defined
 		 * @param keyFrameIds Optional ids of the individual keyframes to which the set of image point groups from 'imagePointGroups' belong, each key frame id corresponds with one group of image points, if defined also 'database' and 'objectPointIds' must be defined
 		 * @param objectPointIds Optional ids of the individual object points which projections are provided as groups of image points in 'imagePointGroups', if defined also 'database' and 'keyFrameIds' must be defined
+		 * @param worker Optional worker object to distribute the RANSAC iterations
 		 * @param abort Optional abort statement allowing to stop the execution; True, if the execution has to stop
 		 * @return True, if succeeded
 		 * @see determineInitialObjectPointsFromDenseFramesRANSAC().
 		 */
-		static bool determineInitialObjectPointsFromSparseKeyFramesRANSAC(const PinholeCamera& pinholeCamera, const Database::ImagePointGroups& imagePointGroups, RandomGenerator& randomGenerator, HomogenousMatrices4& validPoses, Indices32& validPoseIndices, Vectors3& objectPoints, Indices32& validObjectPointIndices, const unsigned int iterations = 20u, const RelativeThreshold& minimalValidObjectPoints = RelativeThreshold(10u, Scalar(0.3), 20u), const Scalar maximalSqrError = Scalar(3.5 * 3.5), const Database* database = nullptr, const Indices32* keyFrameIds = nullptr, const Indices32* objectPointIds = nullptr, bool* abort = nullptr);
+		static bool determineInitialObjectPointsFromSparseKeyFramesRANSAC(const PinholeCamera& pinholeCamera, const Database::ImagePointGroups& imagePointGroups, RandomGenerator& randomGenerator, HomogenousMatrices4& validPoses, Indices32& validPoseIndices, Vectors3& objectPoints, Indices32& validObjectPointIndices, const unsigned int iterations = 20u, const RelativeThreshold& minimalValidObjectPoints = RelativeThreshold(10u, Scalar(0.3), 20u), const Scalar maximalSqrError = Scalar(3.5 * 3.5), const Database* database = nullptr, const Indices32* keyFrameIds = nullptr, const Indices32* objectPointIds = nullptr, Worker* worker = nullptr, bool* abort = nullptr);
 
 		/**
 		 * Determines the initial object point positions for a set of frames (image point groups) observing the unique object points in individual camera poses.
@@ -1589,6 +1591,32 @@ class OCEAN_TRACKING_EXPORT Solver3
 		 */
 		static void determineInitialObjectPointsFromSparseKeyFramesByStepsSubset(const Database* database, const PinholeCamera* pinholeCamera, RandomGenerator* randomGenerator, const unsigned int lowerFrame, const Indices32* startFrames, const unsigned int upperFrame, const Scalar maximalStaticImagePointFilterRatio, Vectors3* initialObjectPoints, Indices32* initialObjectPointIds, Indices32* initialPoseIds, Scalar* initialPointDistance, const RelativeThreshold* pointsThreshold, const unsigned int minimalKeyFrames, const unsigned int maximalKeyFrames, const Scalar maximalSqrError, Lock* lock, bool* abort, const unsigned int numberThreads, const unsigned int threadIndex, const unsigned int numberThreadsOne);
 
+		/**
+		 * Determines the initial object point positions for a set of key frames (image point groups) observing the unique object points in individual camera poses by a RANSAC algorithm.
+		 * This function is executed by several threads concurrently, each thread applies RANSAC iterations with an own random generator and own result buffers until all requested iterations have been applied.<br>
+		 * Afterwards, the best result of each thread is compared with the best overall result.
+		 * @param pinholeCamera The pinhole camera profile to be applied
+		 * @param imagePointGroups Key frames of image points, all points in one group are located in the same camera frame and the individual points correspond to the same unique object points
+		 * @param randomGenerator A random generator object
+		 * @param poses The resulting poses that could be determined
+		 * @param validPoseIndices The indices of resulting valid poses in relation to the given image point groups
+		 * @param objectPoints The resulting object points that could be determined
+		 * @param validObjectPointIndices The indices of resulting valid object points in relation to the given image point groups
+		 * @param bestPointDistance The average distance between the image points of the best RANSAC iteration
+		 * @param minimalValidObjectPoints The threshold of object points that must be valid
+		 * @param maximalSqrError The maximal square distance between an image points and a projected object point
+		 * @param database Optional database holding the image points from the imagePointGroups to validate the resulting 3D object positions even for camera poses not corresponding to the provided groups of image points
+		 * @param keyFrameIds Optional ids of the individual keyframes to which the set of image point groups from 'imagePointGroups' belong
+		 * @param objectPointIds Optional ids of the individual object points which projections are provided as groups of image points in 'imagePointGroups'
+		 * @param remainingIterations The number of RANSAC iterations that still need to be applied
+		 * @param lock The lock object which must be defined if this function is executed in parallel on several threads, otherwise nullptr
+		 * @param abort Optional abort statement allowing to stop the execution; True, if the execution has to stop
+		 * @param firstIteration The first RANSAC iteration to apply, has no meaning as 'remainingIterations' is used instead
+		 * @param numberIterations The number of RANSAC iterations to apply, has no meaning as 'remainingIterations' is used instead
+		 * @see determineInitialObjectPointsFromSparseKeyFramesRANSAC().
+		 */
+		static void determineInitialObjectPointsFromSparseKeyFramesRANSACSubset(const PinholeCamera* pinholeCamera, const Database::ImagePointGroups* imagePointGroups, RandomGenerator* randomGenerator, HomogenousMatrices4* poses, Indices32* validPoseIndices, Vectors3* objectPoints, Indices32* validObjectPointIndices, Scalar* bestPointDistance, const RelativeThreshold* minimalValidObjectPoints, const Scalar maximalSqrError, const Database* database, const Indices32* keyFrameIds, const Indices32* objectPointIds, unsigned int* remainingIterations, Lock* lock, bool* abort, unsigned int firstIteration, unsigned int numberIterations);
+
 		/**
 		 * Determines the initial object point positions for a set of frames (image point groups) observing the unique object points in individual camera poses by a RANSAC algorithm.
 		 * This function applies a RANSAC mechanism randomly selecting individual start key frames (pairs of image points).<br>
@@ -503,7 +503,7 @@ bool SphericalEnvironment::extendEnvironment(const PinholeCamera& pinholeCamera,
 		Frame correspondingPanoramaMask(FrameType(frame, FrameType::FORMAT_Y8));
 
 		// extract the panorama frame matching with the current frame to make the orientation more accurate
-		if (!extractFrame(currentCamera, currentOrientation, correspondingPanoramaFrame, correspondingPanoramaMask, approximationBinSize, worker))
+		if (!extractFrameWithCachedRays(currentCamera, currentOrientation, correspondingPanoramaFrame, correspondingPanoramaMask, approximationBinSize, worker))
 		{
 			return false;
 		}
@@ -557,7 +557,7 @@ bool SphericalEnvironment::extendEnvironment(const PinholeCamera& pinholeCamera,
 		if (fineAdjustmentEstimator != Geometry::Estimator::ET_INVALID)
 		{
 			// finally extract the panorama frame matching with the current frame again
-			if (!extractFrame(currentCamera, currentOrientation, correspondingPanoramaFrame, correspondingPanoramaMask, approximationBinSize, worker))
+			if (!extractFrameWithCachedRays(currentCamera, currentOrientation, correspondingPanoramaFrame, correspondingPanoramaMask, approximationBinSize, worker))
 			{
 				return false;
 			}
@@ -630,7 +630,7 @@ bool SphericalEnvironment::optimizeOrientation(const PinholeCamera& pinholeCamer
 	ocean_assert(!mask.isValid() || FrameType::formatIsGeneric(mask.pixelFormat(), FrameType::DT_UNSIGNED_INTEGER_8, 1u));
 
 	Frame referenceFrame, referenceMask;
-	if (!extractFrame(pinholeCamera, orientation, referenceFrame, referenceMask, approximationBinSize, worker))
+	if (!extractFrameWithCachedRays(pinholeCamera, orientation, referenceFrame, referenceMask, approximationBinSize, worker))
 	{
 		return false;
 	}
@@ -678,7 +678,7 @@ bool SphericalEnvironment::optimizeOrientation(const PinholeCamera& pinholeCamer
 	if (fineAdjustment)
 	{
 		// we extract the panorama reference frame with the optimized orientation and optional optimized camera
-		if (!extractFrame(optimizedCamera ? *optimizedCamera : pinholeCamera, optimizedOrientation, referenceFrame, referenceMask, approximationBinSize, worker))
+		if (!extractFrameWithCachedRays(optimizedCamera ? *optimizedCamera : pinholeCamera, optimizedOrientation, referenceFrame, referenceMask, approximationBinSize, worker))
 		{
 			return false;
 		}
@@ -721,6 +721,36 @@ void SphericalEnvironment::clear()
 	previousCamera_ = PinholeCamera();
 
 	previousFramePyramid_.clear();
+
+	cameraRays_ = RayLookupTable();
+	cameraRaysCamera_ = PinholeCamera();
+	cameraRaysBinSize_ = 0u;
+}
+
+bool SphericalEnvironment::extractFrameWithCachedRays(const PinholeCamera& pinholeCamera, const SquareMatrix3& orientation, Frame& frame, Frame& mask, const unsigned int approximationBinSize, Worker* worker)
+{
+	ocean_assert(pinholeCamera.isValid() && !orientation.isSingular());
+
+	if (approximationBinSize <= 1u)
+	{
+		return extractFrame(pinholeCamera, orientation, frame, mask, approximationBinSize, worker);
+	}
+
+	if (!frame_.isValid() || !pinholeCamera.isValid() || orientation.isSingular())
+	{
+		return false;
+	}
+
+	// the viewing rays depend on the camera profile only, so that they need to be updated whenever the camera profile changes
+
+	if (cameraRaysBinSize_ != approximationBinSize || !(cameraRaysCamera_ == pinholeCamera))
+	{
+		cameraRays_ = cameraRayLookupTable(pinholeCamera, approximationBinSize);
+		cameraRaysCamera_ = pinholeCamera;
+		cameraRaysBinSize_ = approximationBinSize;
+	}
+
+	return panoramaFrame2cameraFrame(pinholeCamera, cameraRays_, frame_, mask_, dimensionWidth_, dimensionHeight_, frameTopLeft_, orientation, frame, mask, maskValue_, worker);
 }
 
 bool SphericalEnvironment::determinePointCorrespondencesHomography(const Frame& sourceFrame, const Frame& targetFrame, const SquareMatrix3& homography, Vectors2& sourcePoints, Vectors2& targetPoints, const unsigned int patchSize, const unsigned int maximalDistance, const unsigned int coarsestLayerRadius, const CV::FramePyramid::DownsamplingMode downsamplingMode, Worker* worker)
@@ -453,6 +453,21 @@ class OCEAN_TRACKING_EXPORT SphericalEnvironment : public CV::Advanced::Panorama
 		 */
 		static inline uint32_t pointIndex(const uint64_t id);
 
+		/**
+		 * Copies (interpolates) a section from the panorama frame to a camera frame with specified camera orientation.
+		 * In contrast to extractFrame(), the viewing rays of the camera are cached and reused as long as the camera profile and the approximation bin size do not change.<br>
+		 * Thus, each frame needs to rotate the cached rays only.
+		 * @param pinholeCamera The pinhole camera profile of the resulting camera frame, must be valid
+		 * @param orientation The orientation of the resulting camera frame, must be valid
+		 * @param frame The resulting camera frame
+		 * @param mask The resulting camera mask
+		 * @param approximationBinSize Optional width/height of a bin in a lookup table to speedup the in interpolation in pixel, 0u to avoid the application of a lookup table
+		 * @param worker Optional worker object to distribute the computation
+		 * @return True, if succeeded
+		 * @see extractFrame().
+		 */
+		bool extractFrameWithCachedRays(const PinholeCamera& pinholeCamera, const SquareMatrix3& orientation, Frame& frame, Frame& mask, const unsigned int approximationBinSize, Worker* worker);
+
 	protected:
 
 		/// The initial orientation of the first camera frame.
@@ -466,6 +481,15 @@ class OCEAN_TRACKING_EXPORT SphericalEnvironment : public CV::Advanced::Panorama
 
 		/// The frame pyramid of the most recent frame.
 		CV::FramePyramid previousFramePyramid_;
+
+		/// The cached viewing rays of the camera, for the camera profile 'cameraRaysCamera_' and the bin size 'cameraRaysBinSize_'.
+		RayLookupTable cameraRays_;
+
+		/// The camera profile for which the cached viewing rays have been determined.
+		PinholeCamera cameraRaysCamera_;
+
+		/// The approximation bin size for which the cached viewing rays have been determined, 0 if no rays are cached.
+		unsigned int cameraRaysBinSize_ = 0u;
 };
 
 inline SphericalEnvironment::SphericalEnvironment(const unsigned int dimensionWidth, const unsigned int dimensionHeight, const uint8_t maskValue, const UpdateMode updateMode) :
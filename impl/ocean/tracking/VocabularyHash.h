@@ -0,0 +1,793 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#ifndef META_OCEAN_TRACKING_VOCABULARY_HASH_H
+#define META_OCEAN_TRACKING_VOCABULARY_HASH_H
+
+#include "ocean/tracking/Tracking.h"
+#include "ocean/tracking/VocabularyTree.h"
+
+#include "ocean/base/Lock.h"
+#include "ocean/base/Memory.h"
+#include "ocean/base/RandomGenerator.h"
+#include "ocean/base/RandomI.h"
+#include "ocean/base/Worker.h"
+
+namespace Ocean
+{
+
+namespace Tracking
+{
+
+/**
+ * This class implements a multi-probe locality-sensitive hash (LSH) index for binary feature descriptors.
+ * The index is an alternative to VocabularyForest for large maps, the matching functions have the same interface and provide the same Match objects.<br>
+ * Each hash table uses a random subset of the descriptor bits as key, similar descriptors therefore end up in the same bucket with high probability.<br>
+ * During matching, not only the query's bucket but also all buckets with keys within a small Hamming radius are probed (multi-probe LSH).<br>
+ * The number of tables, the number of key bits, and the probing radius allow to balance recall and latency.<br>
+ * The index will not own the memory of the provided descriptors, the descriptors need to exist as long as the index exists.<br>
+ * All tables are stored in flat memory blocks, so that an index can also be used directly from external memory, e.g., from a memory-mapped file.
+ * @tparam TDescriptor The data type of the binary descriptors for which the index will be created, e.g., std::array<uint8_t, 32>
+ * @tparam TDistance The data type of the distance measure between two descriptors, e.g., 'unsigned int'
+ * @tparam tDistanceFunction The pointers to the function able to calculate the distance between two descriptors
+ * @see VocabularyForest
+ * @ingroup tracking
+ */
+template <typename TDescriptor, typename TDistance, TDistance(*tDistanceFunction)(const TDescriptor&, const TDescriptor&)>
+class VocabularyHash : public VocabularyStructure
+{
+	public:
+
+		/**
+		 * The descriptor type of this index.
+		 */
+		using Descriptor = TDescriptor;
+
+		/**
+		 * The distance data type of this index.
+		 */
+		using Distance = TDistance;
+
+		/**
+		 * The pointer to the function determining the distance between two descriptors of this index.
+		 */
+		static constexpr TDistance(*distanceFunction)(const TDescriptor&, const TDescriptor&) = tDistanceFunction;
+
+		/**
+		 * Definition of a Match object using the distance data type of this index.
+		 */
+		using Match = Match<TDistance>;
+
+		/**
+		 * Definition of a vector holding Match objects.
+		 */
+		using Matches = Matches<TDistance>;
+
+		/**
+		 * Definition of a function pointer to a function allowing to return individual descriptors from a multi-descriptor.
+		 * First function parameter is the multi-descriptor, second parameter is the index of the actual descriptor to return, returns nullptr if the index is out of range
+		 */
+		template <typename TMultiDescriptor>
+		using MultiDescriptorFunction = const TDescriptor*(*)(const TMultiDescriptor&, const size_t);
+
+		/**
+		 * This class stores construction parameters for a VocabularyHash.
+		 */
+		class HashParameters
+		{
+			public:
+
+				/**
+				 * Default constructor.
+				 */
+				HashParameters() = default;
+
+				/**
+				 * Creates a new parameters object.
+				 * @param numberTables The number of hash tables, more tables increase the recall and the latency, with range [1, infinity)
+				 * @param keyBits The number of descriptor bits used as key in each table, more bits decrease the recall and the latency, with range [1, 24], 0 to determine the number of bits based on the number of descriptors
+				 * @param probeRadius The Hamming radius of the keys of all buckets which will be probed, with range [0, 2]
+				 */
+				inline HashParameters(const unsigned int numberTables, const unsigned int keyBits = 0u, const unsigned int probeRadius = 1u);
+
+				/**
+				 * Returns whether this object holds valid parameters.
+				 * @return True, if so
+				 */
+				inline bool isValid() const;
+
+			public:
+
+				/// The number of hash tables, with range [1, infinity).
+				unsigned int numberTables_ = 8u;
+
+				/// The number of descriptor bits used as key in each table, with range [1, 24], 0 to determine the number of bits based on the number of descriptors.
+				unsigned int keyBits_ = 0u;
+
+				/// The Hamming radius of the keys of all buckets which will be probed, with range [0, 2].
+				unsigned int probeRadius_ = 1u;
+		};
+
+	protected:
+
+		/**
+		 * This class implements one hash table.
+		 * The descriptor indices of all buckets are stored in one consecutive block of memory, the memory is either owned or external.
+		 */
+		class HashTable
+		{
+			public:
+
+				/// The indices of the descriptor bits which are used as key, one for each key bit.
+				Indices32 bitIndices_;
+
+				/// The offsets of the individual buckets within 'descriptorIndices_', with (2^keyBits + 1) elements of type Index32.
+				Memory bucketOffsets_;
+
+				/// The indices of the descriptors, sorted by buckets, with 'numberDescriptors' elements of type Index32.
+				Memory descriptorIndices_;
+		};
+
+		/**
+		 * Definition of a vector holding hash tables.
+		 */
+		using HashTables = std::vector<HashTable>;
+
+	public:
+
+		/**
+		 * Creates a new empty index.
+		 */
+		VocabularyHash() = default;
+
+		/**
+		 * Creates a new index for given descriptors.
+		 * The given descriptors must not change afterwards, the descriptors must exist as long as the index exists.
+		 * @param descriptors The descriptors for which the new index will be created, must be valid
+		 * @param numberDescriptors The number of descriptors, with range [1, infinity)
+		 * @param parameters The parameters used to construct the index, must be valid
+		 * @param worker Optional worker object to distribute the computation
+		 * @param randomGenerator Optional explicit random generator object
+		 */
+		VocabularyHash(const TDescriptor* descriptors, const size_t numberDescriptors, const HashParameters& parameters = HashParameters(), Worker* worker = nullptr, RandomGenerator* randomGenerator = nullptr);
+
+		/**
+		 * Creates a new index using external memory holding the tables of an index which has been created before.
+		 * The index will not own the memory, the memory needs to exist as long as the index exists.<br>
+		 * The memory holds the tables one after another, each table with the layout [bitIndices, bucketOffsets, descriptorIndices], see tableElements().
+		 * @param useTables The external memory holding all tables, must be valid
+		 * @param numberTables The number of tables in the external memory, with range [1, infinity)
+		 * @param numberDescriptors The number of descriptors the index has been created with, with range [1, infinity)
+		 * @param keyBits The number of key bits of each table, with range [1, 24]
+		 * @param probeRadius The Hamming radius of the keys of all buckets which will be probed, with range [0, 2]
+		 * @see tableData().
+		 */
+		VocabularyHash(const Index32* useTables, const size_t numberTables, const size_t numberDescriptors, const unsigned int keyBits, const unsigned int probeRadius);
+
+		/**
+		 * Matches a query descriptor with all candidate descriptors in this index.
+		 * @param candidateDescriptors The entire set of candidate descriptors which have been used to create the index, must be valid
+		 * @param queryDescriptor The query descriptor for which the best matching candidate descriptor will be determined
+		 * @param distance Optional resulting distance, nullptr if not of interest
+		 * @return The index of the matched candidate descriptor, with range [0, 'numberDescriptors' - 1], invalidMatchIndex() if no match could be determined
+		 */
+		Index32 matchDescriptor(const TDescriptor* candidateDescriptors, const TDescriptor& queryDescriptor, TDistance* distance = nullptr) const;
+
+		/**
+		 * Matches a query multi-descriptor with all candidate descriptors in this index.
+		 * @param candidateDescriptors The entire set of candidate descriptors which have been used to create the index, must be valid
+		 * @param queryMultiDescriptor The query multi-descriptor for which the best matching candidate descriptor will be determined
+		 * @param distance Optional resulting distance, nullptr if not of interest
+		 * @return The index of the matched candidate descriptor, with range [0, 'numberDescriptors' - 1], invalidMatchIndex() if no match could be determined
+		 * @tparam TMultiDescriptor The data type of the multi-descriptor
+		 * @tparam tMultiDescriptorFunction The function pointer to a static function allowing to access one single-descriptor of a multi-descriptor, must be valid
+		 */
+		template <typename TMultiDescriptor, MultiDescriptorFunction<TMultiDescriptor> tMultiDescriptorFunction>
+		Index32 matchMultiDescriptor(const TDescriptor* candidateDescriptors, const TMultiDescriptor& queryMultiDescriptor, TDistance* distance = nullptr) const;
+
+		/**
+		 * Matches several query descriptors with all candidate descriptors in this index.
+		 * @param candidateDescriptors The entire set of candidate descriptors which have been used to create the index, must be valid
+		 * @param queryDescriptors The query descriptors for which the best matching candidate descriptors will be determined, can be nullptr if 'numberQueryDescriptors == 0'
+		 * @param numberQueryDescriptors The number of given query descriptors, with range [0, infinity)
+		 * @param maximalDistance The maximal distance between two matching descriptors, with range [0, infinity)
+		 * @param matches The resulting matches
+		 * @param worker Optional worker object to distribute the computation
+		 * @see VocabularyForest::matchDescriptors().
+		 */
+		void matchDescriptors(const TDescriptor* candidateDescriptors, const TDescriptor* queryDescriptors, const size_t numberQueryDescriptors, const TDistance maximalDistance, Matches& matches, Worker* worker = nullptr) const;
+
+		/**
+		 * Matches several query multi-descriptors with all candidate descriptors in this index.
+		 * @param candidateDescriptors The entire set of candidate descriptors which have been used to create the index, must be valid
+		 * @param queryMultiDescriptors The query multi-descriptors for which the best matching candidate descriptors will be determined, can be nullptr if 'numberQueryMultiDescriptors == 0'
+		 * @param numberQueryMultiDescriptors The number of given query multi-descriptors, with range [0, infinity)
+		 * @param maximalDistance The maximal distance between two matching descriptors, with range [0, infinity)
+		 * @param matches The resulting matches
+		 * @param worker Optional worker object to distribute the computation
+		 * @tparam TMultiDescriptor The data type of a multi-descriptor
+		 * @tparam tMultiDescriptorFunction The function pointer to a static function allowing to access one single-descriptor of a multi-descriptor, must be valid
+		 * @see VocabularyForest::matchMultiDescriptors().
+		 */
+		template <typename TMultiDescriptor, MultiDescriptorFunction<TMultiDescriptor> tMultiDescriptorFunction>
+		void matchMultiDescriptors(const TDescriptor* candidateDescriptors, const TMultiDescriptor* queryMultiDescriptors, const size_t numberQueryMultiDescriptors, const TDistance maximalDistance, Matches& matches, Worker* worker = nullptr) const;
+
+		/**
+		 * Returns the number of descriptors this index has been created with.
+		 * @return The number of descriptors
+		 */
+		inline size_t numberDescriptors() const;
+
+		/**
+		 * Returns the number of hash tables of this index.
+		 * @return The number of tables
+		 */
+		inline size_t numberTables() const;
+
+		/**
+		 * Returns the number of key bits of each hash table.
+		 * @return The number of key bits, with range [1, 24]
+		 */
+		inline unsigned int keyBits() const;
+
+		/**
+		 * Returns the Hamming radius of the keys of all buckets which are probed.
+		 * @return The probe radius, with range [0, 2]
+		 */
+		inline unsigned int probeRadius() const;
+
+		/**
+		 * Copies the flat data of one table into a buffer, e.g., to write the index into a file.
+		 * @param tableIndex The index of the table, with range [0, numberTables() - 1]
+		 * @param buffer The buffer receiving the table data with layout [bitIndices, bucketOffsets, descriptorIndices], must provide tableElements(keyBits(), numberDescriptors()) elements
+		 * @see VocabularyHash(const Index32*, ...).
+		 */
+		void tableData(const size_t tableIndex, Index32* buffer) const;
+
+		/**
+		 * Returns whether this index holds at least one hash table.
+		 * @return True, if so
+		 */
+		inline bool isValid() const;
+
+		/**
+		 * Returns the number of elements of the flat data of one table.
+		 * @param keyBits The number of key bits of the table, with range [1, 24]
+		 * @param numberDescriptors The number of descriptors of the index, with range [1, infinity)
+		 * @return The number of Index32 elements
+		 */
+		static constexpr size_t tableElements(const unsigned int keyBits, const size_t numberDescriptors);
+
+	protected:
+
+		/**
+		 * Creates a subset of the hash tables.
+		 * @param descriptors The descriptors for which the tables will be created, must be valid
+		 * @param numberDescriptors The number of descriptors, with range [1, infinity)
+		 * @param firstTable The index of the first table to be created, with range [0, numberTables() - 1]
+		 * @param numberTables The number of tables to be created, with range [1, numberTables() - firstTable]
+		 */
+		void createTablesSubset(const TDescriptor* descriptors, const size_t numberDescriptors, const unsigned int firstTable, const unsigned int numberTables);
+
+		/**
+		 * Matches a query descriptor with all candidate descriptors in this index and updates the best match.
+		 * @param candidateDescriptors The entire set of candidate descriptors which have been used to create the index, must be valid
+		 * @param queryDescriptor The query descriptor
+		 * @param bestCandidateIndex The index of the best candidate descriptor so far, will be updated
+		 * @param bestDistance The distance of the best candidate descriptor so far, will be updated
+		 */
+		void matchDescriptor(const TDescriptor* candidateDescriptors, const TDescriptor& queryDescriptor, Index32& bestCandidateIndex, TDistance& bestDistance) const;
+
+		/**
+		 * Matches a subset of several query descriptors with all candidate descriptors.
+		 * @param candidateDescriptors The entire set of candidate descriptors which have been used to create the index, must be valid
+		 * @param queryDescriptors The query descriptors, must be valid
+		 * @param maximalDistance The maximal distance between two matching descriptors, with range [0, infinity)
+		 * @param matches The resulting matches
+		 * @param lock Optional lock when executed in multiple threads in parallel, nullptr otherwise
+		 * @param firstQueryDescriptor The index of the first query descriptor to be handled, with range [0, infinity)
+		 * @param numberQueryDescriptors The number of query descriptors to be handled, with range [1, infinity)
+		 */
+		void matchDescriptorsSubset(const TDescriptor* candidateDescriptors, const TDescriptor* queryDescriptors, const TDistance maximalDistance, Matches* matches, Lock* lock, const unsigned int firstQueryDescriptor, const unsigned int numberQueryDescriptors) const;
+
+		/**
+		 * Matches a subset of several query multi-descriptors with all candidate descriptors.
+		 * @param candidateDescriptors The entire set of candidate descriptors which have been used to create the index, must be valid
+		 * @param queryMultiDescriptors The query multi-descriptors, must be valid
+		 * @param maximalDistance The maximal distance between two matching descriptors, with range [0, infinity)
+		 * @param matches The resulting matches
+		 * @param lock Optional lock when executed in multiple threads in parallel, nullptr otherwise
+		 * @param firstQueryMultiDescriptor The index of the first query multi-descriptor to be handled, with range [0, infinity)
+		 * @param numberQueryMultiDescriptors The number of query multi-descriptors to be handled, with range [1, infinity)
+		 * @tparam TMultiDescriptor The data type of a multi-descriptor
+		 * @tparam tMultiDescriptorFunction The function pointer to a static function allowing to access one single-descriptor of a multi-descriptor, must be valid
+		 */
+		template <typename TMultiDescriptor, MultiDescriptorFunction<TMultiDescriptor> tMultiDescriptorFunction>
+		void matchMultiDescriptorsSubset(const TDescriptor* candidateDescriptors, const TMultiDescriptor* queryMultiDescriptors, const TDistance maximalDistance, Matches* matches, Lock* lock, const unsigned int firstQueryMultiDescriptor, const unsigned int numberQueryMultiDescriptors) const;
+
+		/**
+		 * Determines the key of a descriptor for a hash table.
+		 * @param descriptor The descriptor for which the key will be determined
+		 * @param bitIndices The indices of the descriptor bits composing the key, must be valid
+		 * @param keyBits The number of key bits, with range [1, 24]
+		 * @return The resulting key, with range [0, 2^keyBits - 1]
+		 */
+		static inline Index32 determineKey(const TDescriptor& descriptor, const Index32* bitIndices, const unsigned int keyBits);
+
+		/**
+		 * Determines the number of key bits for a given number of descriptors so that each bucket holds 16 to 32 descriptors on average.
+		 * @param numberDescriptors The number of descriptors, with range [1, infinity)
+		 * @return The number of key bits, with range [8, min(24, descriptor bits)]
+		 */
+		static unsigned int determineKeyBits(const size_t numberDescriptors);
+
+	protected:
+
+		/// The hash tables of this index.
+		HashTables hashTables_;
+
+		/// The number of key bits of each hash table, with range [1, 24].
+		unsigned int keyBits_ = 0u;
+
+		/// The Hamming radius of the keys of all buckets which will be probed, with range [0, 2].
+		unsigned int probeRadius_ = 0u;
+
+		/// The number of descriptors this index has been created with.
+		size_t numberDescriptors_ = 0;
+};
+
+template <typename TDescriptor, typename TDistance, TDistance(*tDistanceFunction)(const TDescriptor&, const TDescriptor&)>
+inline VocabularyHash<TDescriptor, TDistance, tDistanceFunction>::HashParameters::HashParameters(const unsigned int numberTables, const unsigned int keyBits, const unsigned int probeRadius) :
+	numberTables_(numberTables),
+	keyBits_(keyBits),
+	probeRadius_(probeRadius)
+{
+	// nothing to do here
+}
+
+template <typename TDescriptor, typename TDistance, TDistance(*tDistanceFunction)(const TDescriptor&, const TDescriptor&)>
+inline bool VocabularyHash<TDescriptor, TDistance, tDistanceFunction>::HashParameters::isValid() const
+{
+	return numberTables_ >= 1u && keyBits_ <= 24u && keyBits_ <= (unsigned int)(sizeof(TDescriptor) * 8) && probeRadius_ <= 2u;
+}
+
+template <typename TDescriptor, typename TDistance, TDistance(*tDistanceFunction)(const TDescriptor&, const TDescriptor&)>
+VocabularyHash<TDescriptor, TDistance, tDistanceFunction>::VocabularyHash(const TDescriptor* descriptors, const size_t numberDescriptors, const HashParameters& parameters, Worker* worker, RandomGenerator* randomGenerator)
+{
+	static_assert(tDistanceFunction != nullptr, "Invalid distance function!");
+	static_assert(std::is_trivially_copyable<TDescriptor>::value, "The descriptor must be a plain binary descriptor!");
+
+	ocean_assert(descriptors != nullptr && numberDescriptors != 0);
+	ocean_assert(parameters.isValid());
+
+	if (descriptors == nullptr || numberDescriptors == 0 || !parameters.isValid())
+	{
+		return;
+	}
+
+	numberDescriptors_ = numberDescriptors;
+	keyBits_ = parameters.keyBits_ != 0u ? parameters.keyBits_ : determineKeyBits(numberDescriptors);
+	probeRadius_ = parameters.probeRadius_;
+
+	constexpr unsigned int descriptorBits = (unsigned int)(sizeof(TDescriptor) * 8);
+	ocean_assert(keyBits_ >= 1u && keyBits_ <= descriptorBits);
+
+	RandomGenerator localRandomGenerator(randomGenerator);
+
+	hashTables_.resize(parameters.numberTables_);
+
+	// the key bits are selected sequentially to ensure deterministic tables, the tables are filled in parallel
+
+	for (HashTable& hashTable : hashTables_)
+	{
+		UnorderedIndexSet32 bitIndexSet;
+		bitIndexSet.reserve(keyBits_);
+
+		hashTable.bitIndices_.reserve(keyBits_);
+
+		while (hashTable.bitIndices_.size() < size_t(keyBits_))
+		{
+			const Index32 bitIndex = RandomI::random(localRandomGenerator, descriptorBits - 1u);
+
+			if (bitIndexSet.emplace(bitIndex).second)
+			{
+				hashTable.bitIndices_.emplace_back(bitIndex);
+			}
+		}
+	}
+
+	if (worker != nullptr && hashTables_.size() >= 2)
+	{
+		worker->executeFunction(Worker::Function::create(*this, &VocabularyHash<TDescriptor, TDistance, tDistanceFunction>::createTablesSubset, descriptors, numberDescriptors, 0u, 0u), 0u, (unsigned int)(hashTables_.size()));
+	}
+	else
+	{
+		createTablesSubset(descriptors, numberDescriptors, 0u, (unsigned int)(hashTables_.size()));
+	}
+}
+
+template <typename TDescriptor, typename TDistance, TDistance(*tDistanceFunction)(const TDescriptor&, const TDescriptor&)>
+VocabularyHash<TDescriptor, TDistance, tDistanceFunction>::VocabularyHash(const Index32* useTables, const size_t numberTables, const size_t numberDescriptors, const unsigned int keyBits, const unsigned int probeRadius)
+{
+	ocean_assert(useTables != nullptr && numberTables != 0 && numberDescriptors != 0);
+	ocean_assert(keyBits >= 1u && keyBits <= 24u && keyBits <= (unsigned int)(sizeof(TDescriptor) * 8));
+	ocean_assert(probeRadius <= 2u);
+
+	if (useTables == nullptr || numberTables == 0 || numberDescriptors == 0 || keyBits == 0u || keyBits > 24u || keyBits > (unsigned int)(sizeof(TDescriptor) * 8) || probeRadius > 2u)
+	{
+		return;
+	}
+
+	numberDescriptors_ = numberDescriptors;
+	keyBits_ = keyBits;
+	probeRadius_ = probeRadius;
+
+	const size_t numberBuckets = size_t(1) << keyBits_;
+
+	hashTables_.resize(numberTables);
+
+	const Index32* tableData = useTables;
+
+	for (HashTable& hashTable : hashTables_)
+	{
+		hashTable.bitIndices_.assign(tableData, tableData + keyBits_);
+		tableData += keyBits_;
+
+		hashTable.bucketOffsets_ = Memory(tableData, sizeof(Index32) * (numberBuckets + 1));
+		tableData += numberBuckets + 1;
+
+		hashTable.descriptorIndices_ = Memory(tableData, sizeof(Index32) * numberDescriptors_);
+		tableData += numberDescriptors_;
+
+		ocean_assert(hashTable.bucketOffsets_.template constdata<Index32>()[numberBuckets] == Index32(numberDescriptors_));
+	}
+
+	ocean_assert(size_t(tableData - useTables) == numberTables * tableElements(keyBits_, numberDescriptors_));
+}
+
+template <typename TDescriptor, typename TDistance, TDistance(*tDistanceFunction)(const TDescriptor&, const TDescriptor&)>
+Index32 VocabularyHash<TDescriptor, TDistance, tDistanceFunction>::matchDescriptor(const TDescriptor* candidateDescriptors, const TDescriptor& queryDescriptor, TDistance* distance) const
+{
+	Index32 bestCandidateIndex = invalidMatchIndex();
+	TDistance bestDistance = NumericT<TDistance>::maxValue();
+
+	matchDescriptor(candidateDescriptors, queryDescriptor, bestCandidateIndex, bestDistance);
+
+	if (distance != nullptr)
+	{
+		*distance = bestDistance;
+	}
+
+	return bestCandidateIndex;
+}
+
+template <typename TDescriptor, typename TDistance, TDistance(*tDistanceFunction)(const TDescriptor&, const TDescriptor&)>
+template <typename TMultiDescriptor, const TDescriptor*(*tMultiDescriptorFunction)(const TMultiDescriptor&, const size_t)>
+Index32 VocabularyHash<TDescriptor, TDistance, tDistanceFunction>::matchMultiDescriptor(const TDescriptor* candidateDescriptors, const TMultiDescriptor& queryMultiDescriptor, TDistance* distance) const
+{
+	static_assert(tMultiDescriptorFunction != nullptr, "Invalid function!");
+
+	Index32 bestCandidateIndex = invalidMatchIndex();
+	TDistance bestDistance = NumericT<TDistance>::maxValue();
+
+	unsigned int index = 0u;
+	while (const TDescriptor* queryDescriptor = tMultiDescriptorFunction(queryMultiDescriptor, index++))
+	{
+		ocean_assert(queryDescriptor != nullptr);
+
+		matchDescriptor(candidateDescriptors, *queryDescriptor, bestCandidateIndex, bestDistance);
+	}
+
+	if (distance != nullptr)
+	{
+		*distance = bestDistance;
+	}
+
+	return bestCandidateIndex;
+}
+
+template <typename TDescriptor, typename TDistance, TDistance(*tDistanceFunction)(const TDescriptor&, const TDescriptor&)>
+void VocabularyHash<TDescriptor, TDistance, tDistanceFunction>::matchDescriptors(const TDescriptor* candidateDescriptors, const TDescriptor* queryDescriptors, const size_t numberQueryDescriptors, const TDistance maximalDistance, Matches& matches, Worker* worker) const
+{
+	matches.clear();
+
+	ocean_assert(candidateDescriptors != nullptr);
+	if (numberQueryDescriptors == 0)
+	{
+		return;
+	}
+
+	ocean_assert(queryDescriptors != nullptr);
+
+	if (worker && numberQueryDescriptors >= 50)
+	{
+		Lock lock;
+		worker->executeFunction(Worker::Function::create(*this, &VocabularyHash<TDescriptor, TDistance, tDistanceFunction>::matchDescriptorsSubset, candidateDescriptors, queryDescriptors, maximalDistance, &matches, &lock, 0u, 0u), 0u, (unsigned int)(numberQueryDescriptors), 5u, 6u, 50u);
+	}
+	else
+	{
+		matchDescriptorsSubset(candidateDescriptors, queryDescriptors, maximalDistance, &matches, nullptr, 0u, (unsigned int)(numberQueryDescriptors));
+	}
+}
+
+template <typename TDescriptor, typename TDistance, TDistance(*tDistanceFunction)(const TDescriptor&, const TDescriptor&)>
+template <typename TMultiDescriptor, const TDescriptor*(*tMultiDescriptorFunction)(const TMultiDescriptor&, const size_t)>
+void VocabularyHash<TDescriptor, TDistance, tDistanceFunction>::matchMultiDescriptors(const TDescriptor* candidateDescriptors, const TMultiDescriptor* queryMultiDescriptors, const size_t numberQueryMultiDescriptors, const TDistance maximalDistance, Matches& matches, Worker* worker) const
+{
+	static_assert(tMultiDescriptorFunction != nullptr, "Invalid function!");
+
+	matches.clear();
+
+	ocean_assert(candidateDescriptors != nullptr);
+	if (numberQueryMultiDescriptors == 0)
+	{
+		return;
+	}
+
+	ocean_assert(queryMultiDescriptors != nullptr);
+
+	if (worker && numberQueryMultiDescriptors >= 50)
+	{
+		Lock lock;
+		worker->executeFunction(Worker::Function::create(*this, &VocabularyHash<TDescriptor, TDistance, tDistanceFunction>::matchMultiDescriptorsSubset<TMultiDescriptor, tMultiDescriptorFunction>, candidateDescriptors, queryMultiDescriptors, maximalDistance, &matches, &lock, 0u, 0u), 0u, (unsigned int)(numberQueryMultiDescriptors), 5u, 6u, 50u);
+	}
+	else
+	{
+		matchMultiDescriptorsSubset<TMultiDescriptor, tMultiDescriptorFunction>(candidateDescriptors, queryMultiDescriptors, maximalDistance, &matches, nullptr, 0u, (unsigned int)(numberQueryMultiDescriptors));
+	}
+}
+
+template <typename TDescriptor, typename TDistance, TDistance(*tDistanceFunction)(const TDescriptor&, const TDescriptor&)>
+inline size_t VocabularyHash<TDescriptor, TDistance, tDistanceFunction>::numberDescriptors() const
+{
+	return numberDescriptors_;
+}
+
+template <typename TDescriptor, typename TDistance, TDistance(*tDistanceFunction)(const TDescriptor&, const TDescriptor&)>
+inline size_t VocabularyHash<TDescriptor, TDistance, tDistanceFunction>::numberTables() const
+{
+	return hashTables_.size();
+}
+
+template <typename TDescriptor, typename TDistance, TDistance(*tDistanceFunction)(const TDescriptor&, const TDescriptor&)>
+inline unsigned int VocabularyHash<TDescriptor, TDistance, tDistanceFunction>::keyBits() const
+{
+	return keyBits_;
+}
+
+template <typename TDescriptor, typename TDistance, TDistance(*tDistanceFunction)(const TDescriptor&, const TDescriptor&)>
+inline unsigned int VocabularyHash<TDescriptor, TDistance, tDistanceFunction>::probeRadius() const
+{
+	return probeRadius_;
+}
+
+template <typename TDescriptor, typename TDistance, TDistance(*tDistanceFunction)(const TDescriptor&, const TDescriptor&)>
+void VocabularyHash<TDescriptor, TDistance, tDistanceFunction>::tableData(const size_t tableIndex, Index32* buffer) const
+{
+	ocean_assert(tableIndex < hashTables_.size());
+	ocean_assert(buffer != nullptr);
+
+	const HashTable& hashTable = hashTables_[tableIndex];
+
+	const size_t numberBuckets = size_t(1) << keyBits_;
+
+	memcpy(buffer, hashTable.bitIndices_.data(), sizeof(Index32) * keyBits_);
+	buffer += keyBits_;
+
+	memcpy(buffer, hashTable.bucketOffsets_.constdata(), sizeof(Index32) * (numberBuckets + 1));
+	buffer += numberBuckets + 1;
+
+	memcpy(buffer, hashTable.descriptorIndices_.constdata(), sizeof(Index32) * numberDescriptors_);
+}
+
+template <typename TDescriptor, typename TDistance, TDistance(*tDistanceFunction)(const TDescriptor&, const TDescriptor&)>
+inline bool VocabularyHash<TDescriptor, TDistance, tDistanceFunction>::isValid() const
+{
+	return !hashTables_.empty();
+}
+
+template <typename TDescriptor, typename TDistance, TDistance(*tDistanceFunction)(const TDescriptor&, const TDescriptor&)>
+constexpr size_t VocabularyHash<TDescriptor, TDistance, tDistanceFunction>::tableElements(const unsigned int keyBits, const size_t numberDescriptors)
+{
+	return size_t(keyBits) + (size_t(1) << keyBits) + 1 + numberDescriptors;
+}
+
+template <typename TDescriptor, typename TDistance, TDistance(*tDistanceFunction)(const TDescriptor&, const TDescriptor&)>
+void VocabularyHash<TDescriptor, TDistance, tDistanceFunction>::createTablesSubset(const TDescriptor* descriptors, const size_t numberDescriptors, const unsigned int firstTable, const unsigned int numberTables)
+{
+	ocean_assert(descriptors != nullptr && numberDescriptors != 0);
+	ocean_assert(firstTable + numberTables <= hashTables_.size());
+
+	const size_t numberBuckets = size_t(1) << keyBits_;
+
+	Indices32 keys(numberDescriptors);
+
+	for (unsigned int tableIndex = firstTable; tableIndex < firstTable + numberTables; ++tableIndex)
+	{
+		HashTable& hashTable = hashTables_[tableIndex];
+		ocean_assert(hashTable.bitIndices_.size() == size_t(keyBits_));
+
+		hashTable.bucketOffsets_ = Memory::create<Index32>(numberBuckets + 1);
+		Index32* const bucketOffsets = hashTable.bucketOffsets_.template data<Index32>();
+
+		memset(bucketOffsets, 0, sizeof(Index32) * (numberBuckets + 1));
+
+		// counting sort: determining the bucket sizes, the bucket offsets, and finally the sorted descriptor indices
+
+		for (size_t n = 0; n < numberDescriptors; ++n)
+		{
+			keys[n] = determineKey(descriptors[n], hashTable.bitIndices_.data(), keyBits_);
+			++bucketOffsets[keys[n] + 1u];
+		}
+
+		for (size_t n = 1; n <= numberBuckets; ++n)
+		{
+			bucketOffsets[n] += bucketOffsets[n - 1];
+		}
+
+		ocean_assert(bucketOffsets[numberBuckets] == Index32(numberDescriptors));
+
+		Indices32 bucketPositions(bucketOffsets, bucketOffsets + numberBuckets);
+
+		hashTable.descriptorIndices_ = Memory::create<Index32>(numberDescriptors);
+		Index32* const descriptorIndices = hashTable.descriptorIndices_.template data<Index32>();
+
+		for (size_t n = 0; n < numberDescriptors; ++n)
+		{
+			descriptorIndices[bucketPositions[keys[n]]++] = Index32(n);
+		}
+	}
+}
+
+template <typename TDescriptor, typename TDistance, TDistance(*tDistanceFunction)(const TDescriptor&, const TDescriptor&)>
+void VocabularyHash<TDescriptor, TDistance, tDistanceFunction>::matchDescriptor(const TDescriptor* candidateDescriptors, const TDescriptor& queryDescriptor, Index32& bestCandidateIndex, TDistance& bestDistance) const
+{
+	ocean_assert(candidateDescriptors != nullptr);
+
+	for (const HashTable& hashTable : hashTables_)
+	{
+		const Index32* const bucketOffsets = hashTable.bucketOffsets_.template constdata<Index32>();
+		const Index32* const descriptorIndices = hashTable.descriptorIndices_.template constdata<Index32>();
+
+		const Index32 queryKey = determineKey(queryDescriptor, hashTable.bitIndices_.data(), keyBits_);
+
+		const auto matchBucket = [&](const Index32 key)
+		{
+			ocean_assert((size_t(key) + 1) * sizeof(Index32) < hashTable.bucketOffsets_.size());
+
+			const Index32 bucketEnd = bucketOffsets[key + 1u];
+
+			for (Index32 n = bucketOffsets[key]; n < bucketEnd; ++n)
+			{
+				const Index32 candidateIndex = descriptorIndices[n];
+
+				const TDistance distance = tDistanceFunction(queryDescriptor, candidateDescriptors[candidateIndex]);
+
+				if (distance < bestDistance || (distance == bestDistance && candidateIndex < bestCandidateIndex))
+				{
+					bestDistance = distance;
+					bestCandidateIndex = candidateIndex;
+				}
+			}
+		};
+
+		matchBucket(queryKey);
+
+		if (probeRadius_ >= 1u)
+		{
+			for (unsigned int bitA = 0u; bitA < keyBits_; ++bitA)
+			{
+				const Index32 keyA = queryKey ^ (1u << bitA);
+
+				matchBucket(keyA);
+
+				if (probeRadius_ >= 2u)
+				{
+					for (unsigned int bitB = bitA + 1u; bitB < keyBits_; ++bitB)
+					{
+						matchBucket(keyA ^ (1u << bitB));
+					}
+				}
+			}
+		}
+	}
+}
+
+template <typename TDescriptor, typename TDistance, TDistance(*tDistanceFunction)(const TDescriptor&, const TDescriptor&)>
+void VocabularyHash<TDescriptor, TDistance, tDistanceFunction>::matchDescriptorsSubset(const TDescriptor* candidateDescriptors, const TDescriptor* queryDescriptors, const TDistance maximalDistance, Matches* matches, Lock* lock, const unsigned int firstQueryDescriptor, const unsigned int numberQueryDescriptors) const
+{
+	ocean_assert(candidateDescriptors != nullptr);
+	ocean_assert(matches != nullptr);
+	ocean_assert(numberQueryDescriptors >= 1u);
+
+	Matches localMatches;
+	localMatches.reserve(numberQueryDescriptors);
+
+	for (unsigned int nQuery = firstQueryDescriptor; nQuery < firstQueryDescriptor + numberQueryDescriptors; ++nQuery)
+	{
+		TDistance distance = NumericT<TDistance>::maxValue();
+		const Index32 matchingCandidateIndex = matchDescriptor(candidateDescriptors, queryDescriptors[nQuery], &distance);
+
+		if (distance <= maximalDistance && matchingCandidateIndex != invalidMatchIndex())
+		{
+			localMatches.emplace_back(matchingCandidateIndex, nQuery, distance);
+		}
+	}
+
+	const OptionalScopedLock scopedLock(lock);
+
+	matches->insert(matches->cend(), localMatches.cbegin(), localMatches.cend());
+}
+
+template <typename TDescriptor, typename TDistance, TDistance(*tDistanceFunction)(const TDescriptor&, const TDescriptor&)>
+template <typename TMultiDescriptor, const TDescriptor*(*tMultiDescriptorFunction)(const TMultiDescriptor&, const size_t)>
+void VocabularyHash<TDescriptor, TDistance, tDistanceFunction>::matchMultiDescriptorsSubset(const TDescriptor* candidateDescriptors, const TMultiDescriptor* queryMultiDescriptors, const TDistance maximalDistance, Matches* matches, Lock* lock, const unsigned int firstQueryMultiDescriptor, const unsigned int numberQueryMultiDescriptors) const
+{
+	ocean_assert(candidateDescriptors != nullptr);
+	ocean_assert(matches != nullptr);
+	ocean_assert(numberQueryMultiDescriptors >= 1u);
+
+	Matches localMatches;
+	localMatches.reserve(numberQueryMultiDescriptors);
+
+	for (unsigned int nQuery = firstQueryMultiDescriptor; nQuery < firstQueryMultiDescriptor + numberQueryMultiDescriptors; ++nQuery)
+	{
+		TDistance distance = NumericT<TDistance>::maxValue();
+		const Index32 matchingCandidateIndex = matchMultiDescriptor<TMultiDescriptor, tMultiDescriptorFunction>(candidateDescriptors, queryMultiDescriptors[nQuery], &distance);
+
+		if (distance <= maximalDistance && matchingCandidateIndex != invalidMatchIndex())
+		{
+			localMatches.emplace_back(matchingCandidateIndex, nQuery, distance);
+		}
+	}
+
+	const OptionalScopedLock scopedLock(lock);
+
+	matches->insert(matches->cend(), localMatches.cbegin(), localMatches.cend());
+}
+
+template <typename TDescriptor, typename TDistance, TDistance(*tDistanceFunction)(const TDescriptor&, const TDescriptor&)>
+inline Index32 VocabularyHash<TDescriptor, TDistance, tDistanceFunction>::determineKey(const TDescriptor& descriptor, const Index32* bitIndices, const unsigned int keyBits)
+{
+	ocean_assert(bitIndices != nullptr);
+	ocean_assert(keyBits >= 1u && keyBits <= 24u);
+
+	const uint8_t* const descriptorBytes = (const uint8_t*)(&descriptor);
+
+	Index32 key = 0u;
+
+	for (unsigned int n = 0u; n < keyBits; ++n)
+	{
+		const Index32 bitIndex = bitIndices[n];
+		ocean_assert(bitIndex < sizeof(TDescriptor) * 8);
+
+		key |= Index32((descriptorBytes[bitIndex / 8u] >> (bitIndex % 8u)) & 1u) << n;
+	}
+
+	return key;
+}
+
+template <typename TDescriptor, typename TDistance, TDistance(*tDistanceFunction)(const TDescriptor&, const TDescriptor&)>
+unsigned int VocabularyHash<TDescriptor, TDistance, tDistanceFunction>::determineKeyBits(const size_t numberDescriptors)
+{
+	ocean_assert(numberDescriptors != 0);
+
+	unsigned int keyBits = 0u;
+
+	while (keyBits < 24u && (size_t(16) << (keyBits + 1u)) <= numberDescriptors)
+	{
+		++keyBits;
+	}
+
+	return std::min(std::max(keyBits, 8u), (unsigned int)(sizeof(TDescriptor) * 8));
+}
+
+}
+
+}
+
+#endif // META_OCEAN_TRACKING_VOCABULARY_HASH_H
@@ -17,6 +17,7 @@
 #include "ocean/base/Worker.h"
 
 #include "ocean/math/Numeric.h"
+#include "ocean/math/Random.h"
 
 namespace Ocean
 {
@@ -58,7 +59,9 @@ class VocabularyStructure
 			/// All initial clusters are chosen randomly.
 			IS_PURE_RANDOM,
 			/// The initial first cluster is chosen randomly, the remaining clusters are chosen with largest distance to each other.
-			IS_LARGEST_DISTANCE
+			IS_LARGEST_DISTANCE,
+			/// The initial first cluster is chosen randomly, the remaining clusters are chosen randomly with a probability proportional to the square distance to the nearest existing cluster (k-means++ seeding).
+			IS_PLUS_PLUS
 		};
 
 		/**
@@ -161,8 +164,9 @@ class VocabularyStructure
 				 * @param maximalDescriptorsPerLeaf The maximal number of descriptors each leaf can have, with range [1, infinity)
 				 * @param maximalLevels The maximal number of tree levels, at tree will never have more level regardless what has been specified in 'maximalNumberClustersPerLevel' or 'maximalDescriptorsPerLeaf'
 				 * @param initializationStrategy The initialization strategy for initial clusters
+				 * @param miniBatchSize The number of descriptors in each mini-batch which is used to refine the initial clusters before all descriptors are clustered, with range [1, infinity), 0 to cluster with all descriptors only
 				 */
-				inline Parameters(const unsigned int maximalNumberClustersPerLevel, const unsigned int maximalDescriptorsPerLeaf, const unsigned int maximalLevels = (unsigned int)(-1), const InitializationStrategy initializationStrategy = IS_LARGEST_DISTANCE);
+				inline Parameters(const unsigned int maximalNumberClustersPerLevel, const unsigned int maximalDescriptorsPerLeaf, const unsigned int maximalLevels = (unsigned int)(-1), const InitializationStrategy initializationStrategy = IS_LARGEST_DISTANCE, const unsigned int miniBatchSize = 0u);
 
 				/**
 				 * Returns whether this object holds valid parameters.
@@ -183,6 +187,9 @@ class VocabularyStructure
 
 				/// The initialization strategy for initial clusters.
 				InitializationStrategy initializationStrategy_ = IS_LARGEST_DISTANCE;
+
+				/// The number of descriptors in each mini-batch which is used to refine the initial clusters of large nodes, with range [1, infinity), 0 to cluster with all descriptors only.
+				unsigned int miniBatchSize_ = 0u;
 		};
 
 	public:
@@ -642,6 +649,18 @@ class VocabularyTree : public VocabularyStructure
 		 */
 		TDescriptors initialClustersPureRandom(const Parameters& parameters, const TDescriptor* treeDescriptors, Index32* descriptorIndices, const size_t numberDescriptorsIndices, RandomGenerator& randomGenerator) const;
 
+		/**
+		 * Determines the initial clusters based on k-means++ seeding.
+		 * The first cluster is selected randomly, each following cluster is selected randomly with a probability proportional to the square distance to the nearest existing cluster.
+		 * @param parameters The parameters used to construct the tree, must be valid
+		 * @param treeDescriptors The descriptors of the entire tree from which some will be part of the clusters, must be valid
+		 * @param descriptorIndices The indices of the tree descriptors for which the new clusters will be determined, must be valid
+		 * @param numberDescriptorsIndices The number of provided indices of the tree descriptors, with range [1, infinity)
+		 * @param randomGenerator The random generator to be used
+		 * @return The descriptors of the centers of the initial clusters
+		 */
+		TDescriptors initialClustersPlusPlus(const Parameters& parameters, const TDescriptor* treeDescriptors, Index32* descriptorIndices, const size_t numberDescriptorsIndices, RandomGenerator& randomGenerator) const;
+
 		/**
 		 * Assigns descriptors to clusters.
 		 * @param clusterCenters The centers of the clusters to which the descriptors will be assigned, must be valid
@@ -689,6 +708,22 @@ class VocabularyTree : public VocabularyStructure
 		 */
 		static void assignDescriptorsToClustersSubset(const TDescriptor* clusterCenters, const unsigned int numberClusters, const TDescriptor* treeDescriptors, const Index32* descriptorIndices, Index32* clusterIndicesForDescriptors, Index32* clusterSizes, TSumDistances* sumDistances, Lock* lock, const unsigned int firstDescriptorIndex, const unsigned int numberDescriptorIndices);
 
+		/**
+		 * Sums the individual bits of a subset of binary descriptors for each cluster.
+		 * @param numberClusters The number of clusters, with range [1, infinity)
+		 * @param treeDescriptors The descriptors of the entire tree from which some will be part of the clusters, must be valid
+		 * @param descriptorIndices The indices of the individual descriptors wrt. the given descriptors, must be valid
+		 * @param clusterIndicesForDescriptors The indices of the clusters to which each individual descriptor belongs, one for each descriptor
+		 * @param meanDescriptorsSum The resulting sums of the bits, `tSize` sums for each cluster, must be valid
+		 * @param numberDescriptorsInClusters The resulting numbers of descriptors in each cluster, one for each cluster, must be valid
+		 * @param lock Optional lock when executed in multiple threads in parallel, nullptr otherwise
+		 * @param firstDescriptorIndex The first descriptor index to be handled, with range [0, infinity)
+		 * @param numberDescriptorIndices The number of descriptor indices to be handled, with range [1, infinity)
+		 * @tparam tSize The number of bits per binary descriptor
+		 */
+		template <unsigned int tSize>
+		static void sumClustersForBinaryDescriptorSubset(const unsigned int numberClusters, const TDescriptor* treeDescriptors, const Index32* descriptorIndices, const Index32* clusterIndicesForDescriptors, Index32* meanDescriptorsSum, Index32* numberDescriptorsInClusters, Lock* lock, const unsigned int firstDescriptorIndex, const unsigned int numberDescriptorIndices);
+
 		/**
 		 * Matches a subset of several query descriptors with all tree candidate descriptors.
 		 * @param candidateDescriptors The entire set of tree candidate descriptors which have been used to create the tree, from which the best matching descriptor will be determined, must be valid
@@ -1060,11 +1095,12 @@ inline bool VocabularyStructure::Match<TDistance>::isValid() const
 	return candidateDescriptorIndex_ != invalidMatchIndex() && queryDescriptorIndex_ != invalidMatchIndex();
 }
 
-inline VocabularyStructure::Parameters::Parameters(const unsigned int maximalNumberClustersPerLevel, const unsigned int maximalDescriptorsPerLeaf, const unsigned int maximalLevels, const InitializationStrategy initializationStrategy) :
+inline VocabularyStructure::Parameters::Parameters(const unsigned int maximalNumberClustersPerLevel, const unsigned int maximalDescriptorsPerLeaf, const unsigned int maximalLevels, const InitializationStrategy initializationStrategy, const unsigned int miniBatchSize) :
 	maximalNumberClustersPerLevel_(maximalNumberClustersPerLevel),
 	maximalDescriptorsPerLeaf_(maximalDescriptorsPerLeaf),
 	maximalLevels_(maximalLevels),
-	initializationStrategy_(initializationStrategy)
+	initializationStrategy_(initializationStrategy),
+	miniBatchSize_(miniBatchSize)
 {
 	// nothing to do here
 }
@@ -1605,6 +1641,39 @@ typename VocabularyTree<TDescriptor, TDistance, tDistanceFunction>::TDescriptors
 	const unsigned int numberClusters = (unsigned int)(clusterCenters.size());
 	ocean_assert(numberClusters >= 1u && numberClusters * parameters.maximalDescriptorsPerLeaf_ <= numberDescriptorsIndices + parameters.maximalDescriptorsPerLeaf_);
 
+	if (parameters.miniBatchSize_ != 0u && numberDescriptorsIndices > size_t(parameters.miniBatchSize_) * 2)
+	{
+		// the initial clusters are refined with small random subsets of the descriptors (mini-batches),
+		// so that the following iterations on all descriptors start close to the final clustering and converge after a few iterations
+
+		constexpr unsigned int miniBatchIterations = 10u;
+
+		Indices32 batchDescriptorIndices(parameters.miniBatchSize_);
+
+		for (unsigned int nIteration = 0u; nIteration < miniBatchIterations; ++nIteration)
+		{
+			for (Index32& batchDescriptorIndex : batchDescriptorIndices)
+			{
+				batchDescriptorIndex = reusableDescriptorIndicesInput[RandomI::random(randomGenerator, (unsigned int)(numberDescriptorsIndices) - 1u)];
+			}
+
+			const Indices32 batchClusterSizes = assignDescriptorsToClusters(clusterCenters.data(), numberClusters, treeDescriptors, batchDescriptorIndices.data(), reusableClusterIndicesForDescriptors, batchDescriptorIndices.size(), nullptr, worker);
+
+			const TDescriptors batchClusterCenters = clustersMeanFunction(numberClusters, treeDescriptors, batchDescriptorIndices.data(), reusableClusterIndicesForDescriptors, batchDescriptorIndices.size(), worker);
+			ocean_assert(batchClusterCenters.size() == clusterCenters.size());
+
+			for (unsigned int nCluster = 0u; nCluster < numberClusters; ++nCluster)
+			{
+				// clusters without descriptors in the current mini-batch keep their previous center
+
+				if (batchClusterSizes[nCluster] != 0u)
+				{
+					clusterCenters[nCluster] = batchClusterCenters[nCluster];
+				}
+			}
+		}
+	}
+
 	TSumDistances previousSumDistances = NumericT<TSumDistances>::maxValue();
 	Indices32 internalClusterSizes;
 
@@ -1712,6 +1781,9 @@ typename VocabularyTree<TDescriptor, TDistance, tDistanceFunction>::TDescriptors
 		case IS_LARGEST_DISTANCE:
 			return initialClustersLargestDistance(parameters, treeDescriptors, reusableDescriptorIndicesInput, reusableDescriptorIndicesOutput, numberDescriptorsIndices, randomGenerator);
 
+		case IS_PLUS_PLUS:
+			return initialClustersPlusPlus(parameters, treeDescriptors, reusableDescriptorIndicesInput, numberDescriptorsIndices, randomGenerator);
+
 		default:
 			ocean_assert(parameters.initializationStrategy_ == IS_PURE_RANDOM);
 			return initialClustersPureRandom(parameters, treeDescriptors, reusableDescriptorIndicesInput, numberDescriptorsIndices, randomGenerator);
@@ -1828,6 +1900,73 @@ typename VocabularyTree<TDescriptor, TDistance, tDistanceFunction>::TDescriptors
 	return clusterCenters;
 }
 
+template <typename TDescriptor, typename TDistance, TDistance(*tDistanceFunction)(const TDescriptor&, const TDescriptor&)>
+typename VocabularyTree<TDescriptor, TDistance, tDistanceFunction>::TDescriptors VocabularyTree<TDescriptor, TDistance, tDistanceFunction>::initialClustersPlusPlus(const Parameters& parameters, const TDescriptor* treeDescriptors, Index32* descriptorIndices, const size_t numberDescriptorsIndices, RandomGenerator& randomGenerator) const
+{
+	ocean_assert(parameters.isValid());
+	ocean_assert(parameters.maximalNumberClustersPerLevel_ <= numberDescriptorsIndices);
+	ocean_assert(treeDescriptors != nullptr && descriptorIndices != nullptr);
+	ocean_assert(numberDescriptorsIndices >= 1);
+
+	const unsigned int maximalClusters = std::min(parameters.maximalNumberClustersPerLevel_, (unsigned int)(numberDescriptorsIndices + parameters.maximalDescriptorsPerLeaf_ - 1u) / parameters.maximalDescriptorsPerLeaf_);
+
+	TDescriptors clusterCenters;
+	clusterCenters.reserve(maximalClusters);
+
+	clusterCenters.emplace_back(treeDescriptors[descriptorIndices[RandomI::random(randomGenerator, (unsigned int)(numberDescriptorsIndices) - 1u)]]);
+
+	// the square distance between each descriptor and the nearest cluster center, updated whenever a new cluster center is added
+
+	std::vector<double> sqrDistances(numberDescriptorsIndices, NumericD::maxValue());
+
+	for (unsigned int nCluster = 1u; nCluster < maximalClusters; ++nCluster)
+	{
+		const TDescriptor& latestClusterCenter = clusterCenters.back();
+
+		double sumSqrDistances = 0.0;
+
+		for (size_t nDescriptor = 0; nDescriptor < numberDescriptorsIndices; ++nDescriptor)
+		{
+			const double distance = double(tDistanceFunction(treeDescriptors[descriptorIndices[nDescriptor]], latestClusterCenter));
+
+			sqrDistances[nDescriptor] = std::min(sqrDistances[nDescriptor], distance * distance);
+
+			sumSqrDistances += sqrDistances[nDescriptor];
+		}
+
+		if (sumSqrDistances <= 0.0)
+		{
+			// all descriptors are identical to the existing cluster centers
+			break;
+		}
+
+		const double randomSqrDistance = RandomD::scalar(randomGenerator, 0.0, sumSqrDistances);
+
+		size_t selectedDescriptor = numberDescriptorsIndices - 1;
+		double accumulatedSqrDistances = 0.0;
+
+		for (size_t nDescriptor = 0; nDescriptor < numberDescriptorsIndices; ++nDescriptor)
+		{
+			accumulatedSqrDistances += sqrDistances[nDescriptor];
+
+			if (accumulatedSqrDistances >= randomSqrDistance && sqrDistances[nDescriptor] > 0.0)
+			{
+				selectedDescriptor = nDescriptor;
+				break;
+			}
+		}
+
+		if (sqrDistances[selectedDescriptor] <= 0.0)
+		{
+			break;
+		}
+
+		clusterCenters.emplace_back(treeDescriptors[descriptorIndices[selectedDescriptor]]);
+	}
+
+	return clusterCenters;
+}
+
 template <typename TDescriptor, typename TDistance, TDistance(*tDistanceFunction)(const TDescriptor&, const TDescriptor&)>
 VocabularyTree<TDescriptor, TDistance, tDistanceFunction>& VocabularyTree<TDescriptor, TDistance, tDistanceFunction>::operator=(VocabularyTree<TDescriptor, TDistance, tDistanceFunction>&& VocabularyTree)
 {
@@ -1843,14 +1982,10 @@ VocabularyTree<TDescriptor, TDistance, tDistanceFunction>& VocabularyTree<TDescr
 
 template <typename TDescriptor, typename TDistance, TDistance(*tDistanceFunction)(const TDescriptor&, const TDescriptor&)>
 template <unsigned int tSize>
-typename VocabularyTree<TDescriptor, TDistance, tDistanceFunction>::TDescriptors VocabularyTree<TDescriptor, TDistance, tDistanceFunction>::determineClustersMeanForBinaryDescriptor(const unsigned int numberClusters, const TDescriptor* treeDescriptors, const Index32* descriptorIndices, const Index32* clusterIndicesForDescriptors, const size_t numberDescriptorIndices, Worker* /*worker todo*/)
+typename VocabularyTree<TDescriptor, TDistance, tDistanceFunction>::TDescriptors VocabularyTree<TDescriptor, TDistance, tDistanceFunction>::determineClustersMeanForBinaryDescriptor(const unsigned int numberClusters, const TDescriptor* treeDescriptors, const Index32* descriptorIndices, const Index32* clusterIndicesForDescriptors, const size_t numberDescriptorIndices, Worker* worker)
 {
 	static_assert(tSize >= 1u && tSize % 8u == 0u, "Invalid descriptor size!");
 
-#ifndef OCEAN_DONT_USE_LOOKUP_TABLE_IN_VOCABULARY_TREE
-	static const std::vector<uint8_t> lookup(generateBitSeparationLookup8());
-#endif
-
 	constexpr unsigned int tBytes = tSize / 8u;
 
 	ocean_assert(numberClusters >= 1u);
@@ -1861,38 +1996,14 @@ typename VocabularyTree<TDescriptor, TDistance, tDistanceFunction>::TDescriptors
 	Indices32 meanDescriptorsSum(numberClusters * tSize, 0u);
 	Indices32 numberDescriptorsInClusters(numberClusters, 0u);
 
-	for (size_t nDescriptor = 0; nDescriptor < numberDescriptorIndices; ++nDescriptor)
+	if (worker != nullptr && numberDescriptorIndices >= 5000)
 	{
-		const Index32& descriptorIndex = descriptorIndices[nDescriptor];
-
-		ocean_assert(clusterIndicesForDescriptors[descriptorIndex] < numberClusters);
-
-		++numberDescriptorsInClusters[clusterIndicesForDescriptors[descriptorIndex]];
-		Index32* meanDescriptor = meanDescriptorsSum.data() + clusterIndicesForDescriptors[descriptorIndex] * tSize;
-
-		const uint8_t* const descriptor = (const uint8_t*)(treeDescriptors + descriptorIndex);
-
-		for (unsigned int nByte = 0u; nByte < tBytes; ++nByte)
-		{
-#ifdef OCEAN_DONT_USE_LOOKUP_TABLE_IN_VOCABULARY_TREE
-			for (unsigned int nBit = 0u; nBit < 8u; ++nBit)
-			{
-				if (descriptor[nByte] & (1u << nBit))
-				{
-					(*meanDescriptor)++;
-				}
-
-				++meanDescriptor;
-			}
-#else
-			const uint8_t* lookupValues = lookup.data() + descriptor[nByte] * 8;
-
-			for (unsigned int nBit = 0u; nBit < 8u; ++nBit)
-			{
-				*meanDescriptor++ += lookupValues[nBit];
-			}
-#endif // OCEAN_DONT_USE_LOOKUP_TABLE_IN_VOCABULARY_TREE
-		}
+		Lock lock;
+		worker->executeFunction(Worker::Function::createStatic(&VocabularyTree<TDescriptor, TDistance, tDistanceFunction>::sumClustersForBinaryDescriptorSubset<tSize>, numberClusters, treeDescriptors, descriptorIndices, clusterIndicesForDescriptors, meanDescriptorsSum.data(), numberDescriptorsInClusters.data(), &lock, 0u, 0u), 0u, (unsigned int)(numberDescriptorIndices));
+	}
+	else
+	{
+		sumClustersForBinaryDescriptorSubset<tSize>(numberClusters, treeDescriptors, descriptorIndices, clusterIndicesForDescriptors, meanDescriptorsSum.data(), numberDescriptorsInClusters.data(), nullptr, 0u, (unsigned int)(numberDescriptorIndices));
 	}
 
 	TDescriptors meanDescriptors(numberClusters);
@@ -1932,6 +2043,80 @@ typename VocabularyTree<TDescriptor, TDistance, tDistanceFunction>::TDescriptors
 	return meanDescriptors;
 }
 
+template <typename TDescriptor, typename TDistance, TDistance(*tDistanceFunction)(const TDescriptor&, const TDescriptor&)>
+template <unsigned int tSize>
+void VocabularyTree<TDescriptor, TDistance, tDistanceFunction>::sumClustersForBinaryDescriptorSubset(const unsigned int numberClusters, const TDescriptor* treeDescriptors, const Index32* descriptorIndices, const Index32* clusterIndicesForDescriptors, Index32* meanDescriptorsSum, Index32* numberDescriptorsInClusters, Lock* lock, const unsigned int firstDescriptorIndex, const unsigned int numberDescriptorIndices)
+{
+	static_assert(tSize >= 1u && tSize % 8u == 0u, "Invalid descriptor size!");
+
+#ifndef OCEAN_DONT_USE_LOOKUP_TABLE_IN_VOCABULARY_TREE
+	static const std::vector<uint8_t> lookup(generateBitSeparationLookup8());
+#endif
+
+	constexpr unsigned int tBytes = tSize / 8u;
+
+	ocean_assert(numberClusters >= 1u);
+	ocean_assert(treeDescriptors != nullptr && descriptorIndices != nullptr && clusterIndicesForDescriptors != nullptr);
+	ocean_assert(meanDescriptorsSum != nullptr && numberDescriptorsInClusters != nullptr);
+
+	// when executed in parallel, the sums are determined locally and added to the shared sums afterwards
+
+	Indices32 localMeanDescriptorsSum(lock != nullptr ? numberClusters * tSize : 0u, 0u);
+	Indices32 localNumberDescriptorsInClusters(lock != nullptr ? numberClusters : 0u, 0u);
+
+	Index32* const targetMeanDescriptorsSum = lock != nullptr ? localMeanDescriptorsSum.data() : meanDescriptorsSum;
+	Index32* const targetNumberDescriptorsInClusters = lock != nullptr ? localNumberDescriptorsInClusters.data() : numberDescriptorsInClusters;
+
+	for (unsigned int nDescriptor = firstDescriptorIndex; nDescriptor < firstDescriptorIndex + numberDescriptorIndices; ++nDescriptor)
+	{
+		const Index32& descriptorIndex = descriptorIndices[nDescriptor];
+
+		ocean_assert(clusterIndicesForDescriptors[descriptorIndex] < numberClusters);
+
+		++targetNumberDescriptorsInClusters[clusterIndicesForDescriptors[descriptorIndex]];
+		Index32* meanDescriptor = targetMeanDescriptorsSum + clusterIndicesForDescriptors[descriptorIndex] * tSize;
+
+		const uint8_t* const descriptor = (const uint8_t*)(treeDescriptors + descriptorIndex);
+
+		for (unsigned int nByte = 0u; nByte < tBytes; ++nByte)
+		{
+#ifdef OCEAN_DONT_USE_LOOKUP_TABLE_IN_VOCABULARY_TREE
+			for (unsigned int nBit = 0u; nBit < 8u; ++nBit)
+			{
+				if (descriptor[nByte] & (1u << nBit))
+				{
+					(*meanDescriptor)++;
+				}
+
+				++meanDescriptor;
+			}
+#else
+			const uint8_t* lookupValues = lookup.data() + descriptor[nByte] * 8;
+
+			for (unsigned int nBit = 0u; nBit < 8u; ++nBit)
+			{
+				*meanDescriptor++ += lookupValues[nBit];
+			}
+#endif // OCEAN_DONT_USE_LOOKUP_TABLE_IN_VOCABULARY_TREE
+		}
+	}
+
+	if (lock != nullptr)
+	{
+		const ScopedLock scopedLock(*lock);
+
+		for (unsigned int n = 0u; n < numberClusters * tSize; ++n)
+		{
+			meanDescriptorsSum[n] += localMeanDescriptorsSum[n];
+		}
+
+		for (unsigned int nCluster = 0u; nCluster < numberClusters; ++nCluster)
+		{
+			numberDescriptorsInClusters[nCluster] += localNumberDescriptorsInClusters[nCluster];
+		}
+	}
+}
+
 template <typename TDescriptor, typename TDistance, TDistance(*tDistanceFunction)(const TDescriptor&, const TDescriptor&)>
 template <unsigned int tSize>
 typename VocabularyTree<TDescriptor, TDistance, tDistanceFunction>::TDescriptors VocabularyTree<TDescriptor, TDistance, tDistanceFunction>::determineClustersMeanForFloatDescriptor(const unsigned int numberClusters, const TDescriptor* treeDescriptors, const Index32* descriptorIndices, const Index32* clusterIndicesForDescriptors, const size_t numberDescriptorIndices, Worker* /*worker*/)
@@ -67,6 +67,350 @@ bool MapMerging::bundleAdjustment(Database& database, const PinholeCamera& pinho
 	return true;
 }
 
+bool MapMerging::bundleAdjustmentTiled(Database& database, const PinholeCamera& pinholeCamera, RandomGenerator& randomGenerator, const unsigned int iterations, const Scalar tileSize, Worker* worker)
+{
+	ocean_assert(pinholeCamera.isValid());
+	ocean_assert(iterations >= 1u);
+	ocean_assert(tileSize > Numeric::eps());
+
+	if (tileSize <= Numeric::eps())
+	{
+		return false;
+	}
+
+	HomogenousMatrices4 world_T_cameras;
+	const Indices32 poseIds = database.poseIds<false, false>(HomogenousMatrix4(false), &world_T_cameras);
+
+	// we assign each pose to the tile containing the camera's position, the map is ordered so that the tiles do not depend on the order of the poses
+
+	std::map<uint64_t, Indices32> tileMap;
+
+	for (size_t n = 0; n < poseIds.size(); ++n)
+	{
+		const Vector3 tilePosition = world_T_cameras[n].translation() / tileSize;
+
+		const uint64_t tileX = uint64_t(int64_t(Numeric::floor(tilePosition.x())) & 0x1FFFFF);
+		const uint64_t tileY = uint64_t(int64_t(Numeric::floor(tilePosition.y())) & 0x1FFFFF);
+		const uint64_t tileZ = uint64_t(int64_t(Numeric::floor(tilePosition.z())) & 0x1FFFFF);
+
+		tileMap[(tileX << 42ull) | (tileY << 21ull) | tileZ].push_back(poseIds[n]);
+	}
+
+	Tiles tiles;
+	tiles.reserve(tileMap.size());
+
+	for (std::map<uint64_t, Indices32>::iterator iTile = tileMap.begin(); iTile != tileMap.end(); ++iTile)
+	{
+		tiles.emplace_back();
+		tiles.back().poseIds_ = std::move(iTile->second);
+	}
+
+	if (tiles.empty())
+	{
+		return false;
+	}
+
+	if (worker != nullptr && tiles.size() >= 2)
+	{
+		worker->executeFunction(Worker::Function::createStatic(&MapMerging::bundleAdjustmentTilesSubset, (const Database*)(&database), &pinholeCamera, &randomGenerator, iterations, tiles.data(), 0u, 0u), 0u, (unsigned int)(tiles.size()), 5u, 6u, 1u);
+	}
+	else
+	{
+		bundleAdjustmentTilesSubset(&database, &pinholeCamera, &randomGenerator, iterations, tiles.data(), 0u, (unsigned int)(tiles.size()));
+	}
+
+	// each object point receives the location of the tile with most observations
+
+	std::unordered_map<Index32, std::pair<Index32, size_t>> objectPointTileMap;
+	objectPointTileMap.reserve(database.objectPointNumber<false>());
+
+	size_t succeededTiles = 0;
+
+	for (size_t tileIndex = 0; tileIndex < tiles.size(); ++tileIndex)
+	{
+		const Tile& tile = tiles[tileIndex];
+
+		if (!tile.succeeded_)
+		{
+			continue;
+		}
+
+		++succeededTiles;
+
+		std::unordered_map<Index32, size_t> observationMap;
+
+		for (const Index32 poseId : tile.poseIds_)
+		{
+			for (const Index32 imagePointId : database.imagePointsFromPose<false>(poseId))
+			{
+				const Index32 objectPointId = database.objectPointFromImagePoint<false>(imagePointId);
+
+				if (objectPointId != Database::invalidId)
+				{
+					++observationMap[objectPointId];
+				}
+			}
+		}
+
+		for (const std::unordered_map<Index32, size_t>::value_type& observationPair : observationMap)
+		{
+			std::pair<Index32, size_t>& objectPointTile = objectPointTileMap.emplace(observationPair.first, std::make_pair(Index32(tileIndex), size_t(0))).first->second;
+
+			if (observationPair.second > objectPointTile.second)
+			{
+				objectPointTile = std::make_pair(Index32(tileIndex), observationPair.second);
+			}
+		}
+	}
+
+	if (succeededTiles == 0)
+	{
+		Log::error() << "Tiled bundle adjustment failed!";
+		return false;
+	}
+
+	// all object points of an optimized tile which could not be optimized lose their location, as in the non-tiled bundle adjustment
+
+	for (const std::unordered_map<Index32, std::pair<Index32, size_t>>::value_type& objectPointTile : objectPointTileMap)
+	{
+		database.setObjectPoint<false>(objectPointTile.first, Database::invalidObjectPoint());
+	}
+
+	for (size_t tileIndex = 0; tileIndex < tiles.size(); ++tileIndex)
+	{
+		const Tile& tile = tiles[tileIndex];
+
+		if (!tile.succeeded_)
+		{
+			continue;
+		}
+
+		ocean_assert(tile.poseIds_.size() == tile.world_T_optimizedCameras_.size());
+
+		for (size_t n = 0; n < tile.poseIds_.size(); ++n)
+		{
+			database.setPose<false>(tile.poseIds_[n], tile.world_T_optimizedCameras_[n]);
+		}
+
+		ocean_assert(tile.optimizedObjectPointIds_.size() == tile.optimizedObjectPoints_.size());
+
+		for (size_t n = 0; n < tile.optimizedObjectPointIds_.size(); ++n)
+		{
+			const Index32 objectPointId = tile.optimizedObjectPointIds_[n];
+
+			ocean_assert(objectPointTileMap.find(objectPointId) != objectPointTileMap.cend());
+			if (objectPointTileMap[objectPointId].first == Index32(tileIndex))
+			{
+				database.setObjectPoint<false>(objectPointId, tile.optimizedObjectPoints_[n]);
+			}
+		}
+	}
+
+	// the tiles have been optimized independently, so that object points visible in several tiles do not fit perfectly to the poses of the other tiles,
+	// therefore, we alternately optimize the object points with fixed poses and the poses with fixed object points, each object point and each pose is optimized individually
+
+	Indices32 objectPointIds;
+	objectPointIds.reserve(objectPointTileMap.size());
+
+	for (const std::unordered_map<Index32, std::pair<Index32, size_t>>::value_type& objectPointTile : objectPointTileMap)
+	{
+		if (database.objectPoint<false>(objectPointTile.first) != Database::invalidObjectPoint())
+		{
+			objectPointIds.push_back(objectPointTile.first);
+		}
+	}
+
+	const AnyCameraPinhole anyCamera(pinholeCamera);
+
+	for (unsigned int iteration = 0u; iteration < 3u; ++iteration)
+	{
+		Vectors3 optimizedObjectPoints;
+		Indices32 optimizedObjectPointIds;
+
+		if (Tracking::Solver3::optimizeObjectPointsWithFixedPoses(database, pinholeCamera, Tracking::Solver3::CM_UNKNOWN, objectPointIds, optimizedObjectPoints, optimizedObjectPointIds, 2u, Geometry::Estimator::ET_HUBER, Scalar(3.5 * 3.5), worker))
+		{
+			database.setObjectPoints<false>(optimizedObjectPointIds.data(), optimizedObjectPoints.data(), optimizedObjectPointIds.size());
+		}
+
+		for (const Tile& tile : tiles)
+		{
+			if (!tile.succeeded_)
+			{
+				continue;
+			}
+
+			for (const Index32 poseId : tile.poseIds_)
+			{
+				const HomogenousMatrix4& world_T_roughCamera = database.pose<false>(poseId);
+
+				if (world_T_roughCamera.isValid())
+				{
+					const HomogenousMatrix4 world_T_camera = Tracking::Solver3::determinePose(database, anyCamera, randomGenerator, poseId, world_T_roughCamera, 10u, Geometry::Estimator::ET_HUBER);
+
+					if (world_T_camera.isValid())
+					{
+						database.setPose<false>(poseId, world_T_camera);
+					}
+				}
+			}
+		}
+	}
+
+	Log::info() << "Finished tiled Bundle Adjustment with " << succeededTiles << " of " << tiles.size() << " tiles";
+
+	return true;
+}
+
+void MapMerging::bundleAdjustmentTilesSubset(const Database* database, const PinholeCamera* pinholeCamera, RandomGenerator* randomGenerator, const unsigned int iterations, Tile* tiles, const unsigned int firstTile, const unsigned int numberTiles)
+{
+	ocean_assert(database != nullptr && pinholeCamera != nullptr && randomGenerator != nullptr && tiles != nullptr);
+
+	RandomGenerator localRandomGenerator(*randomGenerator);
+
+	for (unsigned int tileIndex = firstTile; tileIndex < firstTile + numberTiles; ++tileIndex)
+	{
+		tiles[tileIndex].succeeded_ = bundleAdjustmentTile(*database, *pinholeCamera, localRandomGenerator, iterations, tiles[tileIndex]);
+	}
+}
+
+bool MapMerging::bundleAdjustmentTile(const Database& database, const PinholeCamera& pinholeCamera, RandomGenerator& randomGenerator, const unsigned int iterations, Tile& tile)
+{
+	ocean_assert(!tile.poseIds_.empty());
+
+	const unsigned int numberPoses = (unsigned int)(tile.poseIds_.size());
+
+	if (numberPoses < 2u)
+	{
+		return false;
+	}
+
+	// the tile database holds the poses of the tile and all observations of object points visible in these poses
+
+	Database tileDatabase;
+
+	HomogenousMatrices4 world_T_cameras;
+	world_T_cameras.reserve(numberPoses);
+
+	for (const Index32 poseId : tile.poseIds_)
+	{
+		const HomogenousMatrix4& world_T_camera = database.pose<false>(poseId);
+		ocean_assert(world_T_camera.isValid());
+
+		world_T_cameras.push_back(world_T_camera);
+		tileDatabase.addPose<false>(poseId, world_T_camera);
+
+		for (const Index32 imagePointId : database.imagePointsFromPose<false>(poseId))
+		{
+			const Index32 objectPointId = database.objectPointFromImagePoint<false>(imagePointId);
+
+			if (objectPointId == Database::invalidId)
+			{
+				continue;
+			}
+
+			const Vector3& objectPoint = database.objectPoint<false>(objectPointId);
+
+			if (objectPoint == Database::invalidObjectPoint())
+			{
+				continue;
+			}
+
+			if (!tileDatabase.hasObjectPoint<false>(objectPointId))
+			{
+				tileDatabase.addObjectPoint<false>(objectPointId, objectPoint);
+			}
+
+			const Index32 tileImagePointId = tileDatabase.addImagePoint<false>(database.imagePoint<false>(imagePointId));
+
+			tileDatabase.attachImagePointToPose<false>(tileImagePointId, poseId);
+			tileDatabase.attachImagePointToObjectPoint<false>(tileImagePointId, objectPointId);
+		}
+	}
+
+	const unsigned int minimalNumberKeyFrames = std::min(10u, numberPoses);
+	const unsigned int maximalNumberKeyFrames = std::max(minimalNumberKeyFrames, numberPoses / 5u); // we use every 5th frame
+
+	const unsigned int minimalObservations = std::min(10u, minimalNumberKeyFrames);
+
+	Vectors3 optimizedObjectPoints;
+	Indices32 optimizedObjectPointIds;
+
+	HomogenousMatrices4 optimizedPoses;
+	Indices32 optimizedPoseIds;
+
+	if (!Tracking::Solver3::optimizeObjectPointsWithVariablePoses(tileDatabase, pinholeCamera, optimizedObjectPoints, optimizedObjectPointIds, &optimizedPoses, &optimizedPoseIds, minimalNumberKeyFrames, maximalNumberKeyFrames, minimalObservations, Geometry::Estimator::ET_HUBER, iterations))
+	{
+		return false;
+	}
+
+	tileDatabase.setObjectPoints<false>(Database::invalidObjectPoint());
+	tileDatabase.setObjectPoints<false>(optimizedObjectPointIds.data(), optimizedObjectPoints.data(), optimizedObjectPointIds.size());
+
+	tileDatabase.setPoses<false>(optimizedPoseIds.data(), optimizedPoses.data(), optimizedPoseIds.size());
+
+	const UnorderedIndexSet32 optimizedPoseIdSet(optimizedPoseIds.cbegin(), optimizedPoseIds.cend());
+
+	const AnyCameraPinhole anyCamera(pinholeCamera);
+
+	tile.world_T_optimizedCameras_.clear();
+	tile.world_T_optimizedCameras_.reserve(numberPoses);
+
+	HomogenousMatrices4 validWorld_T_cameras;
+	HomogenousMatrices4 validOptimized_T_cameras;
+
+	for (size_t n = 0; n < tile.poseIds_.size(); ++n)
+	{
+		const Index32 poseId = tile.poseIds_[n];
+
+		HomogenousMatrix4 optimized_T_camera = tileDatabase.pose<false>(poseId);
+
+		if (optimizedPoseIdSet.find(poseId) == optimizedPoseIdSet.cend())
+		{
+			optimized_T_camera = Tracking::Solver3::determinePose(tileDatabase, anyCamera, randomGenerator, poseId, optimized_T_camera, 10u, Geometry::Estimator::ET_HUBER);
+		}
+
+		if (optimized_T_camera.isValid())
+		{
+			validWorld_T_cameras.push_back(world_T_cameras[n]);
+			validOptimized_T_cameras.push_back(optimized_T_camera);
+		}
+
+		tile.world_T_optimizedCameras_.push_back(optimized_T_camera);
+	}
+
+	// the optimization of the tile may have drifted, so that we align the optimized poses with the original poses
+
+	HomogenousMatrix4 world_T_optimized(false);
+	Scalar scale;
+	if (validOptimized_T_cameras.empty() || !Geometry::AbsoluteTransformation::calculateTransformation(validOptimized_T_cameras.data(), validWorld_T_cameras.data(), validOptimized_T_cameras.size(), world_T_optimized, Geometry::AbsoluteTransformation::ScaleErrorType::Symmetric, &scale))
+	{
+		return false;
+	}
+
+	world_T_optimized.applyScale(Vector3(scale, scale, scale));
+
+	for (HomogenousMatrix4& world_T_optimizedCamera : tile.world_T_optimizedCameras_)
+	{
+		if (world_T_optimizedCamera.isValid())
+		{
+			const HomogenousMatrix4 world_T_camera = world_T_optimized * world_T_optimizedCamera;
+			world_T_optimizedCamera = HomogenousMatrix4(world_T_camera.translation(), world_T_camera.rotation());
+		}
+	}
+
+	tile.optimizedObjectPointIds_ = std::move(optimizedObjectPointIds);
+
+	tile.optimizedObjectPoints_.clear();
+	tile.optimizedObjectPoints_.reserve(optimizedObjectPoints.size());
+
+	for (const Vector3& optimizedObjectPoint : optimizedObjectPoints)
+	{
+		tile.optimizedObjectPoints_.push_back(world_T_optimized * optimizedObjectPoint);
+	}
+
+	return true;
+}
+
 size_t MapMerging::closeLoops(Database& database, FreakMultiDescriptorMap256& freakMap, const PinholeCamera& pinholeCamera, RandomGenerator& randomGenerator, const unsigned int minimalNumberValidCorrespondences, const unsigned int maximalNumberOverlappingObjectPointInPosePair, const unsigned int maximalDescriptorDistance, const unsigned int iterationsWithoutImprovements)
 {
 	ocean_assert(pinholeCamera.isValid());
@@ -690,7 +1034,7 @@ size_t MapMerging::mergeObjectPoints(Database& database, FreakMultiDescriptorMap
 	return correspondingFeaturePointIdGroups.size();
 }
 
-bool MapMerging::mergeMaps(const PinholeCamera& sourceCamera, const Database& sourceDatabase, const UnifiedDescriptorMap& sourceDescriptorMap, const PinholeCamera& targetCamera, Database& targetDatabase, UnifiedDescriptorMap& targetDescriptorMap, RandomGenerator& randomGenerator, const unsigned int minimalNumberCorrespondingFeaturesPerPose, const unsigned int minimalNumberCorrespondingPoses, const unsigned int iterationsWithoutImprovements, const unsigned int maximalNumberImprovements)
+bool MapMerging::mergeMaps(const PinholeCamera& sourceCamera, const Database& sourceDatabase, const UnifiedDescriptorMap& sourceDescriptorMap, const PinholeCamera& targetCamera, Database& targetDatabase, UnifiedDescriptorMap& targetDescriptorMap, RandomGenerator& randomGenerator, const unsigned int minimalNumberCorrespondingFeaturesPerPose, const unsigned int minimalNumberCorrespondingPoses, const unsigned int iterationsWithoutImprovements, const unsigned int maximalNumberImprovements, const Scalar tileSize, Worker* worker)
 {
 	ocean_assert(minimalNumberCorrespondingFeaturesPerPose >= 4u);
 	ocean_assert(minimalNumberCorrespondingPoses >= 1u);
@@ -1184,7 +1528,14 @@ bool MapMerging::mergeMaps(const PinholeCamera& sourceCamera, const Database& so
 
 	Tracking::Solver3::removeObjectPointsNotInFrontOfCamera(targetDatabase);
 
-	if (!Tracking::MapBuilding::MapMerging::bundleAdjustment(targetDatabase, targetCamera, randomGenerator, 40u))
+	if (tileSize > Scalar(0))
+	{
+		if (!Tracking::MapBuilding::MapMerging::bundleAdjustmentTiled(targetDatabase, targetCamera, randomGenerator, 40u, tileSize, worker))
+		{
+			return false;
+		}
+	}
+	else if (!Tracking::MapBuilding::MapMerging::bundleAdjustment(targetDatabase, targetCamera, randomGenerator, 40u))
 	{
 		return false;
 	}
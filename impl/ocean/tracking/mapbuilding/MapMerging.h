@@ -46,6 +46,24 @@ class OCEAN_TRACKING_MAPBUILDING_EXPORT MapMerging : public DescriptorHandling
 		 */
 		static bool bundleAdjustment(Database& database, const PinholeCamera& pinholeCamera, RandomGenerator& randomGenerator, const unsigned int iterations);
 
+		/**
+		 * Executes bundle adjustment in a given database tile by tile.
+		 * The database is partitioned into cubic tiles based on the positions of the cameras, each tile is optimized in an own database holding the poses of the tile and all object points visible in these poses.<br>
+		 * Thus, the tiles can be optimized concurrently and the size of each optimization is bounded by the size of the tile instead of the size of the entire map.<br>
+		 * Object points visible in several tiles receive the location determined in the tile with most observations.<br>
+		 * The optimized poses of each tile are aligned with the original poses so that the individual tiles do not drift apart.<br>
+		 * Finally, the object points and the poses of all optimized tiles are refined alternately (object points with fixed poses, poses with fixed object points) so that object points visible in several tiles fit to the poses of all tiles.
+		 * @param database The database in which the bundle adjustment will be executed
+		 * @param pinholeCamera The pinhole camera profile to be used, must be valid
+		 * @param randomGenerator The random generator object to be used
+		 * @param iterations The number of optimization iterations, with range [1, infinity)
+		 * @param tileSize The edge length of the tiles, in world units, should be large enough so that each tile holds several camera poses, with range (0, infinity)
+		 * @param worker Optional worker object to optimize the tiles concurrently
+		 * @return True, if at least one tile could be optimized
+		 * @see bundleAdjustment().
+		 */
+		static bool bundleAdjustmentTiled(Database& database, const PinholeCamera& pinholeCamera, RandomGenerator& randomGenerator, const unsigned int iterations, const Scalar tileSize, Worker* worker = nullptr);
+
 		/**
 		 * Closes the loop(s) in a database and merges all corresponding 3D object points.
 		 * @param database The database in which the loops will be closed
@@ -87,9 +105,67 @@ class OCEAN_TRACKING_MAPBUILDING_EXPORT MapMerging : public DescriptorHandling
 		 * @param minimalNumberCorrespondingPoses The minimal number of corresponding poses between source and target database so that a set of candidate correspondences count as valid, with range [1, infinity)
 		 * @param iterationsWithoutImprovements The number of searching iterations without any further improvement until the search for further improvements stops, with range [1, infinity)
 		 * @param maximalNumberImprovements The maximal number of merging improvements, with range [1, infinity)
+		 * @param tileSize The edge length of the tiles used for the final bundle adjustment of the merged map, in world units, 0 to optimize the entire map at once, with range [0, infinity)
+		 * @param worker Optional worker object to optimize the tiles of the merged map concurrently, ignored if 'tileSize == 0'
+		 * @return True, if succeeded
+		 * @see bundleAdjustmentTiled().
+		 */
+		static bool mergeMaps(const PinholeCamera& sourceCamera, const Database& sourceDatabase, const UnifiedDescriptorMap& sourceDescriptorMap, const PinholeCamera& targetCamera, Database& targetDatabase, UnifiedDescriptorMap& targetDescriptorMap, RandomGenerator& randomGenerator, const unsigned int minimalNumberCorrespondingFeaturesPerPose = 50u, const unsigned int minimalNumberCorrespondingPoses = 20u, const unsigned int iterationsWithoutImprovements = 100u, const unsigned int maximalNumberImprovements = (unsigned int)(-1), const Scalar tileSize = Scalar(0), Worker* worker = nullptr);
+
+	protected:
+
+		/**
+		 * This class holds the poses of one tile and the results of the optimization of the tile.
+		 */
+		class Tile
+		{
+			public:
+
+				/// The ids of all poses belonging to the tile.
+				Indices32 poseIds_;
+
+				/// The optimized poses, one for each pose id, invalid if a pose could not be determined.
+				HomogenousMatrices4 world_T_optimizedCameras_;
+
+				/// The ids of all optimized object points.
+				Indices32 optimizedObjectPointIds_;
+
+				/// The optimized object points, one for each object point id.
+				Vectors3 optimizedObjectPoints_;
+
+				/// True, if the tile has been optimized successfully.
+				bool succeeded_ = false;
+		};
+
+		/**
+		 * Definition of a vector holding tiles.
+		 */
+		using Tiles = std::vector<Tile>;
+
+	protected:
+
+		/**
+		 * Executes bundle adjustment for a subset of all tiles.
+		 * @param database The database holding all tiles, must be valid
+		 * @param pinholeCamera The pinhole camera profile to be used, must be valid
+		 * @param randomGenerator The random generator object to be used, must be valid
+		 * @param iterations The number of optimization iterations, with range [1, infinity)
+		 * @param tiles The tiles to optimize, must be valid
+		 * @param firstTile The first tile to be handled
+		 * @param numberTiles The number of tiles to be handled, with range [1, infinity)
+		 */
+		static void bundleAdjustmentTilesSubset(const Database* database, const PinholeCamera* pinholeCamera, RandomGenerator* randomGenerator, const unsigned int iterations, Tile* tiles, const unsigned int firstTile, const unsigned int numberTiles);
+
+		/**
+		 * Executes bundle adjustment for one tile.
+		 * @param database The database holding the tile
+		 * @param pinholeCamera The pinhole camera profile to be used, must be valid
+		 * @param randomGenerator The random generator object to be used
+		 * @param iterations The number of optimization iterations, with range [1, infinity)
+		 * @param tile The tile to optimize, receiving the optimization results
 		 * @return True, if succeeded
 		 */
-		static bool mergeMaps(const PinholeCamera& sourceCamera, const Database& sourceDatabase, const UnifiedDescriptorMap& sourceDescriptorMap, const PinholeCamera& targetCamera, Database& targetDatabase, UnifiedDescriptorMap& targetDescriptorMap, RandomGenerator& randomGenerator, const unsigned int minimalNumberCorrespondingFeaturesPerPose = 50u, const unsigned int minimalNumberCorrespondingPoses = 20u, const unsigned int iterationsWithoutImprovements = 100u, const unsigned int maximalNumberImprovements = (unsigned int)(-1));
+		static bool bundleAdjustmentTile(const Database& database, const PinholeCamera& pinholeCamera, RandomGenerator& randomGenerator, const unsigned int iterations, Tile& tile);
 };
 
 }
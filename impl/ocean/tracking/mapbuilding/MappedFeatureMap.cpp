@@ -0,0 +1,488 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "ocean/tracking/mapbuilding/MappedFeatureMap.h"
+
+#include "ocean/base/WorkerPool.h"
+
+#include "ocean/math/Camera.h"
+
+#include <fstream>
+
+namespace Ocean
+{
+
+namespace Tracking
+{
+
+namespace MapBuilding
+{
+
+MappedFeatureMap::GuidedMatching::GuidedMatching(const Vector2* imagePoints, const ImagePointDescriptor* imagePointDescriptors, const size_t numberImagePoints, const Vector3* objectPoints, const size_t numberObjectPoints, const Geometry::Octree& objectPointOctree, const Index32* objectPointIds, const Index32* descriptorOffsets, const ObjectPointDescriptor* objectPointDescriptors) :
+	UnifiedGuidedMatching(imagePoints, numberImagePoints, objectPoints, numberObjectPoints, objectPointOctree, objectPointIds),
+	imagePointDescriptors_(imagePointDescriptors),
+	descriptorOffsets_(descriptorOffsets),
+	objectPointDescriptors_(objectPointDescriptors)
+{
+	// nothing to do here
+}
+
+void MappedFeatureMap::GuidedMatching::determineGuidedMatchings(const AnyCamera& anyCamera, const HomogenousMatrix4& world_T_camera, Vectors2& matchedImagePoints, Vectors3& matchedObjectPoints, const DistanceValue& maximalDescriptorDistance, Indices32* matchedImagePointIndices, Indices32* matchedObjectPointIds, Worker* worker) const
+{
+	ocean_assert(anyCamera.isValid() && world_T_camera.isValid());
+	ocean_assert(imagePoints_ != nullptr && imagePointDescriptors_ != nullptr && numberImagePoints_ >= 1);
+	ocean_assert(objectPoints_ != nullptr && objectPointIds_ != nullptr);
+
+	ocean_assert(matchedImagePoints.empty());
+	ocean_assert(matchedObjectPoints.empty());
+
+	if (matchedObjectPointIds != nullptr)
+	{
+		matchedObjectPointIds->clear();
+	}
+
+	if (matchedImagePointIndices != nullptr)
+	{
+		matchedImagePointIndices->clear();
+	}
+
+	const unsigned int maximalDistance = maximalDescriptorDistance.binaryDistance();
+
+	if (worker != nullptr)
+	{
+		Lock lock;
+		worker->executeFunction(Worker::Function::create(*this, &GuidedMatching::determineGuidedMatchingsSubset, &anyCamera, &world_T_camera, &matchedImagePoints, &matchedObjectPoints, maximalDistance, matchedImagePointIndices, matchedObjectPointIds, &lock, 0u, 0u), 0u, (unsigned int)(numberImagePoints_));
+	}
+	else
+	{
+		determineGuidedMatchingsSubset(&anyCamera, &world_T_camera, &matchedImagePoints, &matchedObjectPoints, maximalDistance, matchedImagePointIndices, matchedObjectPointIds, nullptr, 0u, (unsigned int)(numberImagePoints_));
+	}
+}
+
+void MappedFeatureMap::GuidedMatching::determineGuidedMatchingsSubset(const AnyCamera* anyCamera, const HomogenousMatrix4* world_T_camera, Vectors2* matchedImagePoints, Vectors3* matchedObjectPoints, const unsigned int maximalDescriptorDistance, Indices32* matchedImagePointIndices, Indices32* matchedObjectPointIds, Lock* lock, const unsigned int firstImagePoint, const unsigned int numberImagePoints) const
+{
+	ocean_assert(anyCamera != nullptr && anyCamera->isValid());
+	ocean_assert(world_T_camera != nullptr && world_T_camera->isValid());
+
+	ocean_assert(descriptorOffsets_ != nullptr && objectPointDescriptors_ != nullptr);
+
+	ocean_assert(matchedImagePoints != nullptr);
+	ocean_assert(matchedObjectPoints != nullptr);
+
+	Vectors2 localMatchedImagePoints;
+	Vectors3 localMatchedObjectPoints;
+	Indices32 localMatchedImagePointIndices;
+	Indices32 localMatchedObjectPointIds;
+
+	localMatchedImagePoints.reserve(numberImagePoints);
+	localMatchedObjectPoints.reserve(numberImagePoints);
+	localMatchedImagePointIndices.reserve(numberImagePoints);
+	localMatchedObjectPointIds.reserve(numberImagePoints);
+
+	const HomogenousMatrix4 flippedCamera_T_world(Camera::standard2InvertedFlipped(*world_T_camera));
+
+	const Scalar tanHalfAngle = Numeric::tan(Numeric::deg2rad(Scalar(0.2)));
+
+	std::vector<const Indices32*> leaves;
+	leaves.reserve(32);
+
+	constexpr Scalar generousSqrProjectionError = Scalar(20 * 20);
+
+	Geometry::Octree::ReusableData reusableData;
+
+	for (unsigned int nImagePoint = firstImagePoint; nImagePoint < firstImagePoint + numberImagePoints; ++nImagePoint)
+	{
+		const Vector2& imagePoint = imagePoints_[nImagePoint];
+		ocean_assert(anyCamera->isInside(imagePoint));
+
+		const ImagePointDescriptor& imagePointDescriptor = imagePointDescriptors_[nImagePoint];
+
+		const Line3 ray = anyCamera->ray(imagePoint, *world_T_camera);
+
+		leaves.clear();
+		objectPointOctree_.intersectingLeaves(ray, tanHalfAngle, leaves, reusableData);
+
+		unsigned int bestDistance = NumericT<unsigned int>::maxValue();
+		Index32 bestObjectPointIndex = Index32(-1);
+
+		for (const Indices32* leaf : leaves)
+		{
+			for (const Index32& objectPointIndex : *leaf)
+			{
+				const Vector3& objectPoint = objectPoints_[objectPointIndex];
+
+				if (Camera::isObjectPointInFrontIF(flippedCamera_T_world, objectPoint) && anyCamera->projectToImageIF(flippedCamera_T_world, objectPoint).sqrDistance(imagePoint) <= generousSqrProjectionError)
+				{
+					// the descriptors of the object point are stored consecutively, no lookup via the object point id is necessary
+
+					const Index32 descriptorsBegin = descriptorOffsets_[objectPointIndex];
+					const Index32 descriptorsEnd = descriptorOffsets_[objectPointIndex + 1u];
+					ocean_assert(descriptorsBegin <= descriptorsEnd);
+
+					for (Index32 descriptorIndex = descriptorsBegin; descriptorIndex < descriptorsEnd; ++descriptorIndex)
+					{
+						const unsigned int distance = imagePointDescriptor.distance(objectPointDescriptors_[descriptorIndex]);
+
+						if (distance < bestDistance)
+						{
+							bestDistance = distance;
+							bestObjectPointIndex = objectPointIndex;
+						}
+					}
+				}
+			}
+		}
+
+		if (bestDistance <= maximalDescriptorDistance)
+		{
+			ocean_assert(bestObjectPointIndex != Index32(-1));
+
+			localMatchedImagePoints.emplace_back(imagePoint);
+			localMatchedObjectPoints.emplace_back(objectPoints_[bestObjectPointIndex]);
+
+			localMatchedImagePointIndices.emplace_back(nImagePoint);
+			localMatchedObjectPointIds.emplace_back(objectPointIds_[bestObjectPointIndex]);
+		}
+	}
+
+	const OptionalScopedLock scopedLock(lock);
+
+	matchedImagePoints->insert(matchedImagePoints->cend(), localMatchedImagePoints.cbegin(), localMatchedImagePoints.cend());
+	matchedObjectPoints->insert(matchedObjectPoints->cend(), localMatchedObjectPoints.cbegin(), localMatchedObjectPoints.cend());
+
+	if (matchedImagePointIndices != nullptr)
+	{
+		matchedImagePointIndices->insert(matchedImagePointIndices->cend(), localMatchedImagePointIndices.cbegin(), localMatchedImagePointIndices.cend());
+	}
+
+	if (matchedObjectPointIds != nullptr)
+	{
+		matchedObjectPointIds->insert(matchedObjectPointIds->cend(), localMatchedObjectPointIds.cbegin(), localMatchedObjectPointIds.cend());
+	}
+}
+
+MappedFeatureMap::MappedFeatureMap(const std::string& filename) :
+	memoryMappedFile_(filename)
+{
+	if (!memoryMappedFile_.isValid())
+	{
+		return;
+	}
+
+	Header header;
+	if (!readHeader(memoryMappedFile_, header))
+	{
+		memoryMappedFile_.release();
+		return;
+	}
+
+	const size_t numberObjectPoints = size_t(header.numberObjectPoints_);
+	const size_t numberVocabularyDescriptors = size_t(header.numberVocabularyDescriptors_);
+
+	descriptorOffsets_ = memoryMappedFile_.constdata<Index32>(size_t(header.sectionOffsets_[SI_DESCRIPTOR_OFFSETS]));
+
+	if (descriptorOffsets_[0] != 0u || descriptorOffsets_[numberObjectPoints] != header.numberObjectPointDescriptors_)
+	{
+		memoryMappedFile_.release();
+		descriptorOffsets_ = nullptr;
+		return;
+	}
+
+	objectPointDescriptors_ = memoryMappedFile_.constdata<ObjectPointDescriptor>(size_t(header.sectionOffsets_[SI_OBJECT_POINT_DESCRIPTORS]));
+
+	const ScopedLock scopedLock(lock_);
+
+	// the base class exposes the object points, the ids, and the indices as vectors, so that these (small) sections are copied
+
+	const Vector3* objectPoints = memoryMappedFile_.constdata<Vector3>(size_t(header.sectionOffsets_[SI_OBJECT_POINTS]));
+	objectPoints_.assign(objectPoints, objectPoints + numberObjectPoints);
+
+	const Index32* objectPointIds = memoryMappedFile_.constdata<Index32>(size_t(header.sectionOffsets_[SI_OBJECT_POINT_IDS]));
+	objectPointIds_.assign(objectPointIds, objectPointIds + numberObjectPoints);
+
+	const Index32* objectPointIndices = memoryMappedFile_.constdata<Index32>(size_t(header.sectionOffsets_[SI_OBJECT_POINT_INDICES]));
+	objectPointIndices_.assign(objectPointIndices, objectPointIndices + numberVocabularyDescriptors);
+
+	const ObjectPointVocabularyDescriptor* vocabularyDescriptors = memoryMappedFile_.constdata<ObjectPointVocabularyDescriptor>(size_t(header.sectionOffsets_[SI_VOCABULARY_DESCRIPTORS]));
+	objectPointVocabularyDescriptors_ = std::make_shared<UnifiedDescriptorsBinarySingleLevelSingleView<256u>>(vocabularyDescriptors, numberVocabularyDescriptors);
+
+	const Index32* hashTables = memoryMappedFile_.constdata<Index32>(size_t(header.sectionOffsets_[SI_HASH_TABLES]));
+	objectPointDescriptorsHash_ = VocabularyHash(hashTables, size_t(header.numberHashTables_), numberVocabularyDescriptors, header.hashKeyBits_, header.hashProbeRadius_);
+
+	vocabularyStructureType_ = VST_HASH;
+
+	// the octree is not part of the file, the octree stores pointers and is fast to create
+
+	objectPointOctree_ = Geometry::Octree(objectPoints_.data(), objectPoints_.size(), Geometry::Octree::Parameters(40u, true));
+}
+
+const VocabularyStructure& MappedFeatureMap::objectPointDescriptorsForest() const
+{
+	return objectPointDescriptorsHash_;
+}
+
+const VocabularyStructure& MappedFeatureMap::objectPointVocabularyStructure() const
+{
+	return objectPointDescriptorsHash_;
+}
+
+bool MappedFeatureMap::updateFeatureMap(Vectors3&& /*objectPoints*/, Indices32&& /*objectPointIds*/, SharedUnifiedDescriptorMap&& /*descriptorMap*/, RandomGenerator& /*randomGenerator*/)
+{
+	ocean_assert(false && "A mapped feature map cannot be updated!");
+	return false;
+}
+
+bool MappedFeatureMap::createMatchingObjects(const Vector2* imagePoints, const UnifiedDescriptors* imagePointDescriptors, SharedUnifiedUnguidedMatching& unifiedUnguidedMatching, SharedUnifiedGuidedMatching& unifiedGuidedMatching)
+{
+	ocean_assert(imagePoints != nullptr && imagePointDescriptors != nullptr);
+
+	if (imagePoints == nullptr || imagePointDescriptors == nullptr || !isValid())
+	{
+		return false;
+	}
+
+	const UnifiedDescriptorsT<ImagePointDescriptor>* specializedImagePointDescriptors = dynamic_cast<const UnifiedDescriptorsT<ImagePointDescriptor>*>(imagePointDescriptors);
+
+	if (specializedImagePointDescriptors == nullptr)
+	{
+		return false;
+	}
+
+	const UnifiedDescriptorsT<ObjectPointVocabularyDescriptor>& vocabularyDescriptors = dynamic_cast<const UnifiedDescriptorsT<ObjectPointVocabularyDescriptor>&>(*objectPointVocabularyDescriptors_);
+
+	unifiedUnguidedMatching = std::make_shared<UnguidedMatching>(imagePoints, specializedImagePointDescriptors->descriptors(), specializedImagePointDescriptors->numberDescriptors(), objectPoints_.data(), vocabularyDescriptors.descriptors(), objectPoints_.size(), objectPointIndices_.data(), objectPointVocabularyStructure());
+	unifiedGuidedMatching = std::make_shared<GuidedMatching>(imagePoints, specializedImagePointDescriptors->descriptors(), specializedImagePointDescriptors->numberDescriptors(), objectPoints_.data(), objectPoints_.size(), objectPointOctree_, objectPointIds_.data(), descriptorOffsets_, objectPointDescriptors_);
+
+	return true;
+}
+
+bool MappedFeatureMap::writeFeatureMap(const UnifiedFeatureMap& featureMap, const std::string& filename, const VocabularyHash::HashParameters& hashParameters)
+{
+	ocean_assert(featureMap.isValid() && !filename.empty());
+
+	if (!featureMap.isValid() || filename.empty())
+	{
+		return false;
+	}
+
+	if (dynamic_cast<const MappedFeatureMap*>(&featureMap) != nullptr)
+	{
+		// a mapped feature map does not have a descriptor map, the file can be copied instead
+		return false;
+	}
+
+	const UnifiedDescriptorMapFreakMultiLevelMultiViewDescriptor256* descriptorMap = dynamic_cast<const UnifiedDescriptorMapFreakMultiLevelMultiViewDescriptor256*>(&featureMap.descriptorMap());
+	const UnifiedDescriptorsT<ObjectPointVocabularyDescriptor>* vocabularyDescriptors = dynamic_cast<const UnifiedDescriptorsT<ObjectPointVocabularyDescriptor>*>(&featureMap.objectPointVocabularyDescriptors());
+
+	if (descriptorMap == nullptr || vocabularyDescriptors == nullptr)
+	{
+		return false;
+	}
+
+	const Vectors3& objectPoints = featureMap.objectPoints();
+	const Indices32& objectPointIds = featureMap.objectPointIds();
+	const Indices32& objectPointIndices = featureMap.objectPointIndices();
+
+	ocean_assert(objectPoints.size() == objectPointIds.size());
+	ocean_assert(objectPointIndices.size() == vocabularyDescriptors->numberDescriptors());
+
+	if (objectPoints.size() != objectPointIds.size() || objectPointIndices.size() != vocabularyDescriptors->numberDescriptors())
+	{
+		return false;
+	}
+
+	// the forest consists of pointer-based nodes, so that a map with forest is written with a hash
+
+	VocabularyHash ownVocabularyHash;
+	const VocabularyHash* vocabularyHash = dynamic_cast<const VocabularyHash*>(&featureMap.objectPointVocabularyStructure());
+
+	if (vocabularyHash == nullptr)
+	{
+		ownVocabularyHash = VocabularyHash(vocabularyDescriptors->descriptors(), vocabularyDescriptors->numberDescriptors(), hashParameters, WorkerPool::get().scopedWorker()());
+		vocabularyHash = &ownVocabularyHash;
+	}
+
+	if (!vocabularyHash->isValid())
+	{
+		return false;
+	}
+
+	// the descriptors of all object points are serialized consecutively, in the order of the object points
+
+	Indices32 descriptorOffsets;
+	descriptorOffsets.reserve(objectPoints.size() + 1);
+	descriptorOffsets.emplace_back(0u);
+
+	CV::Detector::FREAKDescriptors32 objectPointDescriptors;
+	objectPointDescriptors.reserve(objectPoints.size() * 2);
+
+	for (const Index32& objectPointId : objectPointIds)
+	{
+		const UnifiedDescriptorMapFreakMultiLevelMultiViewDescriptor256::DescriptorMap::const_iterator iDescriptors = descriptorMap->descriptorMap().find(objectPointId);
+
+		if (iDescriptors != descriptorMap->descriptorMap().cend())
+		{
+			objectPointDescriptors.insert(objectPointDescriptors.cend(), iDescriptors->second.cbegin(), iDescriptors->second.cend());
+		}
+
+		if (!NumericT<Index32>::isInsideValueRange(objectPointDescriptors.size()))
+		{
+			return false;
+		}
+
+		descriptorOffsets.emplace_back(Index32(objectPointDescriptors.size()));
+	}
+
+	Header header;
+	header.version_ = fileVersion_;
+	header.numberObjectPoints_ = uint32_t(objectPoints.size());
+	header.numberObjectPointDescriptors_ = uint32_t(objectPointDescriptors.size());
+	header.numberVocabularyDescriptors_ = uint32_t(vocabularyDescriptors->numberDescriptors());
+	header.numberHashTables_ = uint32_t(vocabularyHash->numberTables());
+	header.hashKeyBits_ = vocabularyHash->keyBits();
+	header.hashProbeRadius_ = vocabularyHash->probeRadius();
+
+	uint64_t sectionSizes[SI_END];
+	determineSectionSizes(header, sectionSizes);
+
+	uint64_t offset = sizeof(Header);
+
+	for (unsigned int nSection = 0u; nSection < SI_END; ++nSection)
+	{
+		offset = (offset + sectionAlignment_ - 1ull) / sectionAlignment_ * sectionAlignment_;
+
+		header.sectionOffsets_[nSection] = offset;
+		offset += sectionSizes[nSection];
+	}
+
+	std::ofstream stream(filename.c_str(), std::ios::binary);
+
+	if (!stream.good())
+	{
+		return false;
+	}
+
+	stream.write((const char*)(&header), sizeof(Header));
+
+	const void* sectionData[SI_END] =
+	{
+		objectPoints.data(),
+		objectPointIds.data(),
+		descriptorOffsets.data(),
+		objectPointDescriptors.data(),
+		vocabularyDescriptors->descriptors(),
+		objectPointIndices.data(),
+		nullptr // the hash tables are written table by table
+	};
+
+	const char padding[sectionAlignment_] = {};
+
+	for (unsigned int nSection = 0u; nSection < SI_END; ++nSection)
+	{
+		const uint64_t currentOffset = uint64_t(stream.tellp());
+		ocean_assert(currentOffset <= header.sectionOffsets_[nSection]);
+
+		stream.write(padding, std::streamsize(header.sectionOffsets_[nSection] - currentOffset));
+
+		if (nSection == SI_HASH_TABLES)
+		{
+			Indices32 tableData(VocabularyHash::tableElements(vocabularyHash->keyBits(), vocabularyHash->numberDescriptors()));
+
+			for (size_t nTable = 0; nTable < vocabularyHash->numberTables(); ++nTable)
+			{
+				vocabularyHash->tableData(nTable, tableData.data());
+
+				stream.write((const char*)(tableData.data()), std::streamsize(tableData.size() * sizeof(Index32)));
+			}
+		}
+		else if (sectionSizes[nSection] != 0ull)
+		{
+			stream.write((const char*)(sectionData[nSection]), std::streamsize(sectionSizes[nSection]));
+		}
+	}
+
+	return stream.good();
+}
+
+bool MappedFeatureMap::readHeader(const IO::MemoryMappedFile& memoryMappedFile, Header& header)
+{
+	ocean_assert(memoryMappedFile.isValid());
+
+	if (memoryMappedFile.size() < sizeof(Header))
+	{
+		return false;
+	}
+
+	memcpy(&header, memoryMappedFile.constdata(), sizeof(Header));
+
+	const Header defaultHeader;
+
+	if (memcmp(header.tag_, defaultHeader.tag_, sizeof(header.tag_)) != 0)
+	{
+		return false;
+	}
+
+	if (header.version_ != fileVersion_ || header.byteOrder_ != defaultHeader.byteOrder_)
+	{
+		return false;
+	}
+
+	if (header.scalarSize_ != defaultHeader.scalarSize_ || header.objectPointDescriptorSize_ != defaultHeader.objectPointDescriptorSize_)
+	{
+		return false;
+	}
+
+	if (header.numberObjectPoints_ == 0u || header.numberVocabularyDescriptors_ == 0u || header.numberHashTables_ == 0u || header.hashKeyBits_ == 0u || header.hashKeyBits_ > 24u || header.hashProbeRadius_ > 2u)
+	{
+		return false;
+	}
+
+	uint64_t sectionSizes[SI_END];
+	determineSectionSizes(header, sectionSizes);
+
+	for (unsigned int nSection = 0u; nSection < SI_END; ++nSection)
+	{
+		const uint64_t sectionOffset = header.sectionOffsets_[nSection];
+
+		if (sectionOffset < sizeof(Header) || sectionOffset % sectionAlignment_ != 0ull)
+		{
+			return false;
+		}
+
+		if (sectionOffset > uint64_t(memoryMappedFile.size()) || sectionSizes[nSection] > uint64_t(memoryMappedFile.size()) - sectionOffset)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+void MappedFeatureMap::determineSectionSizes(const Header& header, uint64_t sectionSizes[SI_END])
+{
+	sectionSizes[SI_OBJECT_POINTS] = uint64_t(header.numberObjectPoints_) * sizeof(Vector3);
+	sectionSizes[SI_OBJECT_POINT_IDS] = uint64_t(header.numberObjectPoints_) * sizeof(Index32);
+	sectionSizes[SI_DESCRIPTOR_OFFSETS] = (uint64_t(header.numberObjectPoints_) + 1ull) * sizeof(Index32);
+	sectionSizes[SI_OBJECT_POINT_DESCRIPTORS] = uint64_t(header.numberObjectPointDescriptors_) * sizeof(ObjectPointDescriptor);
+	sectionSizes[SI_VOCABULARY_DESCRIPTORS] = uint64_t(header.numberVocabularyDescriptors_) * sizeof(ObjectPointVocabularyDescriptor);
+	sectionSizes[SI_OBJECT_POINT_INDICES] = uint64_t(header.numberVocabularyDescriptors_) * sizeof(Index32);
+
+	if (header.hashKeyBits_ >= 1u && header.hashKeyBits_ <= 24u)
+	{
+		sectionSizes[SI_HASH_TABLES] = uint64_t(header.numberHashTables_) * uint64_t(VocabularyHash::tableElements(header.hashKeyBits_, size_t(header.numberVocabularyDescriptors_))) * sizeof(Index32);
+	}
+	else
+	{
+		sectionSizes[SI_HASH_TABLES] = 0ull;
+	}
+}
+
+}
+
+}
+
+}
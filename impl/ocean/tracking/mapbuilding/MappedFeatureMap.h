@@ -0,0 +1,304 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#ifndef META_OCEAN_TRACKING_MAPBUILDING_MAPPED_FEATURE_MAP_H
+#define META_OCEAN_TRACKING_MAPBUILDING_MAPPED_FEATURE_MAP_H
+
+#include "ocean/tracking/mapbuilding/MapBuilding.h"
+#include "ocean/tracking/mapbuilding/UnifiedFeatureMap.h"
+#include "ocean/tracking/mapbuilding/UnifiedMatching.h"
+
+#include "ocean/io/MemoryMappedFile.h"
+
+namespace Ocean
+{
+
+namespace Tracking
+{
+
+namespace MapBuilding
+{
+
+/**
+ * This class implements a read-only feature map which is used directly from a memory-mapped file.
+ * The file stores all data of the feature map in a flat, versioned layout so that the map does not need to be deserialized.<br>
+ * The descriptors of the object points, the vocabulary descriptors and the vocabulary hash are used directly from the mapped pages, the operating system loads the pages on demand and can page out cold regions.<br>
+ * The object points, their ids, and the octree are the only data copied onto the heap, as they are needed as contiguous vectors or need to be created.<br>
+ * The map supports FREAK Multi descriptors with 32 bytes only, the file does not hold a descriptor map, therefore descriptorMap() must not be used.
+ *
+ * The file has the following layout, all data is stored in the native byte order, all sections start at a 64 byte boundary:
+ * <pre>
+ * Header
+ * Object points:                 numberObjectPoints * Vector3
+ * Object point ids:              numberObjectPoints * Index32
+ * Descriptor offsets:            (numberObjectPoints + 1) * Index32, the offsets of the first descriptor of each object point
+ * Object point descriptors:      numberObjectPointDescriptors * FREAKDescriptor32
+ * Vocabulary descriptors:        numberVocabularyDescriptors * BinaryDescriptor<256>
+ * Object point indices:          numberVocabularyDescriptors * Index32, one for each vocabulary descriptor
+ * Vocabulary hash tables:        numberHashTables * VocabularyHash::tableElements() * Index32
+ * </pre>
+ * @see writeFeatureMap(), UnifiedFeatureMapT.
+ * @ingroup trackingmapbuilding
+ */
+class OCEAN_TRACKING_MAPBUILDING_EXPORT MappedFeatureMap : public UnifiedFeatureMap
+{
+	public:
+
+		/**
+		 * Definition of the descriptor for 2D image points.
+		 */
+		using ImagePointDescriptor = CV::Detector::FREAKDescriptor32;
+
+		/**
+		 * Definition of one descriptor of a 3D object point, each object point can have several descriptors.
+		 */
+		using ObjectPointDescriptor = CV::Detector::FREAKDescriptor32;
+
+		/**
+		 * Definition of the vocabulary descriptor of the object points.
+		 */
+		using ObjectPointVocabularyDescriptor = UnifiedDescriptor::BinaryDescriptor<256u>;
+
+		/**
+		 * Definition of the unguided matching object which is used with this map.
+		 */
+		using UnguidedMatching = UnifiedUnguidedMatchingFreakMultiLevelDescriptor256;
+
+		/**
+		 * Definition of the vocabulary hash which is used for unguided matching.
+		 */
+		using VocabularyHash = UnguidedMatching::VocabularyHash;
+
+		/**
+		 * This class implements the guided matching object for a mapped feature map.
+		 * The object point descriptors are accessed via the index of the object point, no descriptor map is necessary.
+		 */
+		class OCEAN_TRACKING_MAPBUILDING_EXPORT GuidedMatching : public UnifiedGuidedMatching
+		{
+			public:
+
+				/**
+				 * Creates a new guided matching object.
+				 * Does not create a copy of the given input.
+				 * @param imagePoints The 2D image points, must be valid
+				 * @param imagePointDescriptors The descriptors of the image points, one for each image point, must be valid
+				 * @param numberImagePoints The number of image points, with range [1, infinity)
+				 * @param objectPoints The 3D object points, must be valid
+				 * @param numberObjectPoints The number of 3D object points, with range [1, infinity)
+				 * @param objectPointOctree The octree holding all 3D object points
+				 * @param objectPointIds The ids of all 3D object points, must be valid
+				 * @param descriptorOffsets The offsets of the first descriptor of each object point, with 'numberObjectPoints + 1' elements, must be valid
+				 * @param objectPointDescriptors The descriptors of all object points, must be valid
+				 */
+				GuidedMatching(const Vector2* imagePoints, const ImagePointDescriptor* imagePointDescriptors, const size_t numberImagePoints, const Vector3* objectPoints, const size_t numberObjectPoints, const Geometry::Octree& objectPointOctree, const Index32* objectPointIds, const Index32* descriptorOffsets, const ObjectPointDescriptor* objectPointDescriptors);
+
+				/**
+				 * Determines the guided matching between 2D and 3D feature points.
+				 * @see UnifiedGuidedMatching::determineGuidedMatchings().
+				 */
+				void determineGuidedMatchings(const AnyCamera& anyCamera, const HomogenousMatrix4& world_T_camera, Vectors2& matchedImagePoints, Vectors3& matchedObjectPoints, const DistanceValue& maximalDescriptorDistance, Indices32* matchedImagePointIndices = nullptr, Indices32* matchedObjectPointIds = nullptr, Worker* worker = nullptr) const override;
+
+			protected:
+
+				/**
+				 * Determines the guided matching for a subset of the image points.
+				 * @param anyCamera The camera profile defining the projection, must be valid
+				 * @param world_T_camera The camera pose, transforming camera to world, must be valid
+				 * @param matchedImagePoints The resulting matched 2D image points
+				 * @param matchedObjectPoints The resulting matched 3D object points
+				 * @param maximalDescriptorDistance The maximal descriptor distance so that two descriptors count as match
+				 * @param matchedImagePointIndices Optional resulting indices of the matched 2D image points, nullptr if not of interest
+				 * @param matchedObjectPointIds Optional resulting ids of the matched 3D object points, nullptr if not of interest
+				 * @param lock Optional lock when executed in multiple threads in parallel, nullptr otherwise
+				 * @param firstImagePoint The index of the first image point to be handled, with range [0, numberImagePoints_ - 1]
+				 * @param numberImagePoints The number of image points to be handled, with range [1, numberImagePoints_ - firstImagePoint]
+				 */
+				void determineGuidedMatchingsSubset(const AnyCamera* anyCamera, const HomogenousMatrix4* world_T_camera, Vectors2* matchedImagePoints, Vectors3* matchedObjectPoints, const unsigned int maximalDescriptorDistance, Indices32* matchedImagePointIndices, Indices32* matchedObjectPointIds, Lock* lock, const unsigned int firstImagePoint, const unsigned int numberImagePoints) const;
+
+			protected:
+
+				/// The descriptors of the image points.
+				const ImagePointDescriptor* imagePointDescriptors_ = nullptr;
+
+				/// The offsets of the first descriptor of each object point, with 'numberObjectPoints_ + 1' elements.
+				const Index32* descriptorOffsets_ = nullptr;
+
+				/// The descriptors of all object points.
+				const ObjectPointDescriptor* objectPointDescriptors_ = nullptr;
+		};
+
+	protected:
+
+		/**
+		 * This class defines the header of a mapped feature map file.
+		 */
+		class Header
+		{
+			public:
+
+				/// The magic tag of the file.
+				uint8_t tag_[8] = {'O', 'C', 'N', 'F', 'M', 'A', 'P', '\0'};
+
+				/// The version of the file.
+				uint32_t version_ = 0u;
+
+				/// The tag allowing to identify the byte order of the file.
+				uint32_t byteOrder_ = 0x01020304u;
+
+				/// The size of one Scalar value, in bytes, 4 or 8.
+				uint32_t scalarSize_ = uint32_t(sizeof(Scalar));
+
+				/// The size of one object point descriptor, in bytes.
+				uint32_t objectPointDescriptorSize_ = uint32_t(sizeof(ObjectPointDescriptor));
+
+				/// The number of object points.
+				uint32_t numberObjectPoints_ = 0u;
+
+				/// The number of object point descriptors of all object points.
+				uint32_t numberObjectPointDescriptors_ = 0u;
+
+				/// The number of vocabulary descriptors.
+				uint32_t numberVocabularyDescriptors_ = 0u;
+
+				/// The number of tables of the vocabulary hash.
+				uint32_t numberHashTables_ = 0u;
+
+				/// The number of key bits of each table of the vocabulary hash.
+				uint32_t hashKeyBits_ = 0u;
+
+				/// The probe radius of the vocabulary hash.
+				uint32_t hashProbeRadius_ = 0u;
+
+				/// The byte offsets of the individual sections, in the order of the file layout.
+				uint64_t sectionOffsets_[7] = {};
+
+				/// Reserved for future use.
+				uint8_t reserved_[8] = {};
+		};
+
+		static_assert(sizeof(Header) == 112, "Invalid header size!");
+		static_assert(std::is_trivially_copyable<ObjectPointDescriptor>::value, "The object point descriptor must be trivially copyable!");
+
+		/**
+		 * Definition of the individual sections of the file.
+		 */
+		enum SectionIndex : uint32_t
+		{
+			/// The section with the object points.
+			SI_OBJECT_POINTS = 0u,
+			/// The section with the object point ids.
+			SI_OBJECT_POINT_IDS,
+			/// The section with the descriptor offsets.
+			SI_DESCRIPTOR_OFFSETS,
+			/// The section with the object point descriptors.
+			SI_OBJECT_POINT_DESCRIPTORS,
+			/// The section with the vocabulary descriptors.
+			SI_VOCABULARY_DESCRIPTORS,
+			/// The section with the object point indices.
+			SI_OBJECT_POINT_INDICES,
+			/// The section with the hash tables.
+			SI_HASH_TABLES,
+			/// The number of sections.
+			SI_END
+		};
+
+		/// The current version of the file layout.
+		static constexpr uint32_t fileVersion_ = 1u;
+
+		/// The byte alignment of each section.
+		static constexpr uint64_t sectionAlignment_ = 64ull;
+
+	public:
+
+		/**
+		 * Creates an invalid feature map.
+		 */
+		MappedFeatureMap() = default;
+
+		/**
+		 * Creates a new feature map from a mapped feature map file.
+		 * @param filename The name of the file which has been written with writeFeatureMap(), must be valid
+		 * @see isValid().
+		 */
+		explicit MappedFeatureMap(const std::string& filename);
+
+		/**
+		 * Returns the vocabulary hash holding the descriptors of the object points of the map.
+		 * The mapped feature map does not have a vocabulary forest, the vocabulary hash is returned instead.
+		 * @see UnifiedFeatureMap::objectPointDescriptorsForest().
+		 */
+		const VocabularyStructure& objectPointDescriptorsForest() const override;
+
+		/**
+		 * Returns the vocabulary hash holding the descriptors of the object points of the map.
+		 * @see UnifiedFeatureMap::objectPointVocabularyStructure().
+		 */
+		const VocabularyStructure& objectPointVocabularyStructure() const override;
+
+		/**
+		 * A mapped feature map is read-only, this function does nothing.
+		 * @see UnifiedFeatureMap::updateFeatureMap().
+		 */
+		bool updateFeatureMap(Vectors3&& objectPoints, Indices32&& objectPointIds, SharedUnifiedDescriptorMap&& descriptorMap, RandomGenerator& randomGenerator) override;
+
+		/**
+		 * Creates the unguided matching and the guided matching object and initializes the objects with the necessary information.
+		 * Objects without image points are not supported.
+		 * @see UnifiedFeatureMap::createMatchingObjects().
+		 */
+		bool createMatchingObjects(const Vector2* imagePoints, const UnifiedDescriptors* imagePointDescriptors, SharedUnifiedUnguidedMatching& unifiedUnguidedMatching, SharedUnifiedGuidedMatching& unifiedGuidedMatching) override;
+
+		/**
+		 * Writes a feature map into a file with flat layout which can be used with MappedFeatureMap.
+		 * The feature map must use FREAK Multi descriptors with 32 bytes and binary vocabulary descriptors with 256 bits.<br>
+		 * In case the feature map does not use a vocabulary hash, a new hash will be created for the file.
+		 * @param featureMap The feature map to write, must be valid
+		 * @param filename The name of the resulting file, must be valid
+		 * @param hashParameters The parameters of the vocabulary hash, used if the feature map does not use a vocabulary hash
+		 * @return True, if succeeded
+		 */
+		static bool writeFeatureMap(const UnifiedFeatureMap& featureMap, const std::string& filename, const VocabularyHash::HashParameters& hashParameters = VocabularyHash::HashParameters());
+
+	protected:
+
+		/**
+		 * Reads and verifies the header of a mapped file.
+		 * @param memoryMappedFile The mapped file, must be valid
+		 * @param header The resulting header
+		 * @return True, if the header is valid and if all sections are inside the file
+		 */
+		static bool readHeader(const IO::MemoryMappedFile& memoryMappedFile, Header& header);
+
+		/**
+		 * Determines the sizes of the individual sections, in bytes.
+		 * @param header The header for which the sizes will be determined
+		 * @param sectionSizes The resulting section sizes, one for each section
+		 */
+		static void determineSectionSizes(const Header& header, uint64_t sectionSizes[SI_END]);
+
+	protected:
+
+		/// The memory-mapped file.
+		IO::MemoryMappedFile memoryMappedFile_;
+
+		/// The offsets of the first descriptor of each object point, with 'numberObjectPoints + 1' elements, pointing into the mapped file.
+		const Index32* descriptorOffsets_ = nullptr;
+
+		/// The descriptors of all object points, pointing into the mapped file.
+		const ObjectPointDescriptor* objectPointDescriptors_ = nullptr;
+
+		/// The vocabulary hash holding the vocabulary descriptors, using the tables of the mapped file.
+		VocabularyHash objectPointDescriptorsHash_;
+};
+
+}
+
+}
+
+}
+
+#endif // META_OCEAN_TRACKING_MAPBUILDING_MAPPED_FEATURE_MAP_H
@@ -53,7 +53,8 @@ bool PoseEstimation::determinePose(const AnyCamera& anyCamera, const UnifiedUngu
 
 	const unsigned int unguidedIterations = Geometry::RANSAC::iterations(3u, Scalar(0.99), faultyRate);
 
-	if (world_T_roughCamera.isValid() || Geometry::RANSAC::p3p(anyCamera, ConstArrayAccessor<Vector3>(matchedObjectPoints), ConstArrayAccessor<Vector2>(matchedImagePoints), randomGenerator, world_T_camera, 20u, true, unguidedIterations, maximalSqrProjectionError))
+	// the unguided matches are not sorted by quality, the preemptive RANSAC uses the expected iterations as upper bound only
+	if (world_T_roughCamera.isValid() || Geometry::RANSAC::p3pPreemptive(anyCamera, ConstArrayAccessor<Vector3>(matchedObjectPoints), ConstArrayAccessor<Vector2>(matchedImagePoints), randomGenerator, world_T_camera, 20u, true, unguidedIterations, maximalSqrProjectionError, false /*progressiveSampling*/, nullptr, nullptr, nullptr, worker))
 	{
 		if (world_T_roughCamera.isValid())
 		{
@@ -0,0 +1,748 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "ocean/tracking/mapbuilding/RelocalizationServer.h"
+#include "ocean/tracking/mapbuilding/RelocalizerMono.h"
+#include "ocean/tracking/mapbuilding/UnifiedDescriptors.h"
+
+#include "ocean/base/HighPerformanceTimer.h"
+
+#include <sstream>
+
+namespace Ocean
+{
+
+namespace Tracking
+{
+
+namespace MapBuilding
+{
+
+RelocalizationServer::RelocalizationServer(SharedUnifiedFeatureMap featureMap, Worker* worker, const unsigned int maximalBatchSize, const double batchWindow) :
+	Thread("RelocalizationServer"),
+	featureMap_(std::move(featureMap)),
+	worker_(worker),
+	maximalBatchSize_(maximalBatchSize),
+	batchWindow_(batchWindow)
+{
+	ocean_assert(featureMap_ && featureMap_->isValid());
+	ocean_assert(maximalBatchSize_ >= 1u);
+	ocean_assert(batchWindow_ >= 0.0);
+
+	tcpServer_.setConnectionRequestCallback(Network::PackagedTCPServer::ConnectionRequestCallback::create(*this, &RelocalizationServer::onConnectionRequest));
+	tcpServer_.setDisconnectCallback(Network::PackagedTCPServer::DisconnectCallback::create(*this, &RelocalizationServer::onDisconnect));
+	tcpServer_.setReceiveCallback(Network::PackagedTCPServer::ReceiveCallback::create(*this, &RelocalizationServer::onReceive));
+}
+
+RelocalizationServer::~RelocalizationServer()
+{
+	stop();
+}
+
+bool RelocalizationServer::setParameters(const unsigned int minimalNumberCorrespondences, const Scalar maximalProjectionError, const Scalar inlierRate)
+{
+	ocean_assert(minimalNumberCorrespondences >= 4u);
+	ocean_assert(maximalProjectionError >= Scalar(0));
+	ocean_assert(inlierRate > Scalar(0) && inlierRate <= Scalar(1));
+
+	if (minimalNumberCorrespondences < 4u || maximalProjectionError < Scalar(0) || inlierRate <= Scalar(0) || inlierRate > Scalar(1))
+	{
+		return false;
+	}
+
+	const ScopedLock scopedLock(lock_);
+
+	if (isThreadActive())
+	{
+		return false;
+	}
+
+	minimalNumberCorrespondences_ = minimalNumberCorrespondences;
+	maximalProjectionError_ = maximalProjectionError;
+	inlierRate_ = inlierRate;
+
+	return true;
+}
+
+bool RelocalizationServer::start(const Network::Port& port)
+{
+	if (!featureMap_ || !featureMap_->isValid())
+	{
+		return false;
+	}
+
+	if (isThreadActive())
+	{
+		return true;
+	}
+
+	if (port.isValid() && !tcpServer_.setPort(port))
+	{
+		return false;
+	}
+
+	if (!startThread())
+	{
+		return false;
+	}
+
+	if (!tcpServer_.start())
+	{
+		stopThreadExplicitly();
+		return false;
+	}
+
+	return true;
+}
+
+bool RelocalizationServer::stop()
+{
+	tcpServer_.stop();
+
+	stopThread();
+	requestSignal_.pulse();
+
+	const bool result = joinThread();
+
+	const ScopedLock scopedLock(lock_);
+	pendingRequests_.clear();
+
+	return result;
+}
+
+size_t RelocalizationServer::pendingRequests() const
+{
+	const ScopedLock scopedLock(lock_);
+
+	return pendingRequests_.size();
+}
+
+bool RelocalizationServer::writeRequest(const Request& request, Buffer& buffer)
+{
+	ocean_assert(request.isValid());
+
+	if (!request.isValid())
+	{
+		return false;
+	}
+
+	std::ostringstream stringStream(std::ios::binary);
+	IO::OutputBitstream outputBitstream(stringStream);
+
+	if (!outputBitstream.write<std::string>("OCN_RELOCALIZATION_REQUEST") || !outputBitstream.write<unsigned int>(1u))
+	{
+		return false;
+	}
+
+	if (!outputBitstream.write<unsigned int>(request.requestId_) || !writeCamera(*request.camera_, outputBitstream) || !writePose(request.world_T_roughCamera_, outputBitstream))
+	{
+		return false;
+	}
+
+	if (!outputBitstream.write<unsigned int>((unsigned int)(request.imagePoints_.size())))
+	{
+		return false;
+	}
+
+	for (size_t n = 0; n < request.imagePoints_.size(); ++n)
+	{
+		const Vector2& imagePoint = request.imagePoints_[n];
+		const CV::Detector::FREAKDescriptor32& descriptor = request.imagePointDescriptors_[n];
+
+		if (!outputBitstream.write<float>(float(imagePoint.x())) || !outputBitstream.write<float>(float(imagePoint.y())))
+		{
+			return false;
+		}
+
+		if (!outputBitstream.write<float>(descriptor.orientation()) || !outputBitstream.write<unsigned int>(descriptor.descriptorLevels()))
+		{
+			return false;
+		}
+
+		for (unsigned int level = 0u; level < descriptor.descriptorLevels(); ++level)
+		{
+			if (!outputBitstream.write(descriptor.data()[level].data(), descriptor.data()[level].size()))
+			{
+				return false;
+			}
+		}
+	}
+
+	const std::string data = stringStream.str();
+
+	buffer.resize(data.size());
+	memcpy(buffer.data(), data.data(), data.size());
+
+	return true;
+}
+
+bool RelocalizationServer::readRequest(const void* data, const size_t size, Request& request)
+{
+	ocean_assert(data != nullptr && size != 0);
+
+	if (data == nullptr || size == 0)
+	{
+		return false;
+	}
+
+	std::istringstream stringStream(std::string((const char*)(data), size), std::ios::binary);
+	IO::InputBitstream inputBitstream(stringStream);
+
+	std::string tag;
+	unsigned int version = 0u;
+
+	if (!inputBitstream.read<std::string>(tag) || tag != "OCN_RELOCALIZATION_REQUEST" || !inputBitstream.read<unsigned int>(version) || version != 1u)
+	{
+		return false;
+	}
+
+	request = Request();
+
+	unsigned int numberFeatures = 0u;
+
+	if (!inputBitstream.read<unsigned int>(request.requestId_) || !readCamera(inputBitstream, request.camera_) || !readPose(inputBitstream, request.world_T_roughCamera_) || !inputBitstream.read<unsigned int>(numberFeatures))
+	{
+		return false;
+	}
+
+	// each feature needs at least 48 bytes, a corrupted number of features must not result in a huge allocation
+
+	constexpr unsigned int maximalNumberFeatures = 100000u;
+
+	if (numberFeatures == 0u || numberFeatures > maximalNumberFeatures || uint64_t(numberFeatures) * 48ull > uint64_t(size))
+	{
+		return false;
+	}
+
+	request.imagePoints_.reserve(numberFeatures);
+	request.imagePointDescriptors_.reserve(numberFeatures);
+
+	for (unsigned int n = 0u; n < numberFeatures; ++n)
+	{
+		float x = 0.0f;
+		float y = 0.0f;
+		float orientation = 0.0f;
+		unsigned int levels = 0u;
+
+		if (!inputBitstream.read<float>(x) || !inputBitstream.read<float>(y) || !inputBitstream.read<float>(orientation) || !inputBitstream.read<unsigned int>(levels))
+		{
+			return false;
+		}
+
+		if (levels < 1u || levels > 3u || !NumericF::isInsideRange(-NumericF::pi(), orientation, NumericF::pi()))
+		{
+			return false;
+		}
+
+		CV::Detector::FREAKDescriptor32::MultilevelDescriptorData descriptorData;
+
+		for (unsigned int level = 0u; level < levels; ++level)
+		{
+			if (!inputBitstream.read(descriptorData[level].data(), descriptorData[level].size()))
+			{
+				return false;
+			}
+		}
+
+		request.imagePoints_.emplace_back(Scalar(x), Scalar(y));
+		request.imagePointDescriptors_.emplace_back(std::move(descriptorData), levels, orientation);
+	}
+
+	return request.isValid();
+}
+
+bool RelocalizationServer::writeResponse(const Response& response, Buffer& buffer)
+{
+	std::ostringstream stringStream(std::ios::binary);
+	IO::OutputBitstream outputBitstream(stringStream);
+
+	if (!outputBitstream.write<std::string>("OCN_RELOCALIZATION_RESPONSE") || !outputBitstream.write<unsigned int>(1u))
+	{
+		return false;
+	}
+
+	if (!outputBitstream.write<unsigned int>(response.requestId_) || !outputBitstream.write<bool>(response.succeeded_) || !writePose(response.world_T_camera_, outputBitstream))
+	{
+		return false;
+	}
+
+	if (!outputBitstream.write<unsigned int>(response.numberCorrespondences_) || !outputBitstream.write<double>(response.queueLatency_) || !outputBitstream.write<double>(response.computeLatency_))
+	{
+		return false;
+	}
+
+	const std::string data = stringStream.str();
+
+	buffer.resize(data.size());
+	memcpy(buffer.data(), data.data(), data.size());
+
+	return true;
+}
+
+bool RelocalizationServer::readResponse(const void* data, const size_t size, Response& response)
+{
+	ocean_assert(data != nullptr && size != 0);
+
+	if (data == nullptr || size == 0)
+	{
+		return false;
+	}
+
+	std::istringstream stringStream(std::string((const char*)(data), size), std::ios::binary);
+	IO::InputBitstream inputBitstream(stringStream);
+
+	std::string tag;
+	unsigned int version = 0u;
+
+	if (!inputBitstream.read<std::string>(tag) || tag != "OCN_RELOCALIZATION_RESPONSE" || !inputBitstream.read<unsigned int>(version) || version != 1u)
+	{
+		return false;
+	}
+
+	response = Response();
+
+	if (!inputBitstream.read<unsigned int>(response.requestId_) || !inputBitstream.read<bool>(response.succeeded_) || !readPose(inputBitstream, response.world_T_camera_))
+	{
+		return false;
+	}
+
+	if (!inputBitstream.read<unsigned int>(response.numberCorrespondences_) || !inputBitstream.read<double>(response.queueLatency_) || !inputBitstream.read<double>(response.computeLatency_))
+	{
+		return false;
+	}
+
+	return response.succeeded_ == response.world_T_camera_.isValid();
+}
+
+void RelocalizationServer::threadRun()
+{
+	PendingRequests batch;
+	Responses responses;
+	Buffer buffer;
+
+	while (!shouldThreadStop())
+	{
+		requestSignal_.wait(100u);
+
+		Timestamp firstReceiveTimestamp(false);
+
+		{
+			const ScopedLock scopedLock(lock_);
+
+			if (pendingRequests_.empty())
+			{
+				continue;
+			}
+
+			firstReceiveTimestamp = pendingRequests_.front().receiveTimestamp_;
+		}
+
+		// we wait a short moment for further requests so that they can be processed in the same batch
+
+		while (!shouldThreadStop() && !firstReceiveTimestamp.hasTimePassed(batchWindow_))
+		{
+			{
+				const ScopedLock scopedLock(lock_);
+
+				if (pendingRequests_.size() >= maximalBatchSize_)
+				{
+					break;
+				}
+			}
+
+			Thread::sleep(1u);
+		}
+
+		{
+			const ScopedLock scopedLock(lock_);
+
+			const size_t batchSize = std::min(pendingRequests_.size(), size_t(maximalBatchSize_));
+
+			batch.clear();
+			batch.insert(batch.end(), std::make_move_iterator(pendingRequests_.begin()), std::make_move_iterator(pendingRequests_.begin() + batchSize));
+			pendingRequests_.erase(pendingRequests_.begin(), pendingRequests_.begin() + batchSize);
+
+			if (!pendingRequests_.empty())
+			{
+				// the remaining requests are handled in the next iteration without waiting for a signal
+				requestSignal_.pulse();
+			}
+		}
+
+		if (batch.empty())
+		{
+			continue;
+		}
+
+		processBatch(batch, responses);
+
+		ocean_assert(batch.size() == responses.size());
+
+		for (size_t n = 0; n < batch.size(); ++n)
+		{
+			if (writeResponse(responses[n], buffer))
+			{
+				tcpServer_.send(batch[n].connectionId_, buffer.data(), buffer.size());
+			}
+		}
+	}
+}
+
+void RelocalizationServer::processBatch(const PendingRequests& pendingRequests, Responses& responses)
+{
+	ocean_assert(!pendingRequests.empty());
+
+	responses.clear();
+	responses.resize(pendingRequests.size());
+
+	if (worker_ != nullptr && pendingRequests.size() >= 2)
+	{
+		// each request is relocalized in its own thread, the matching of all requests in the batch shares one pass of the worker
+
+		worker_->executeFunction(Worker::Function::create(*this, &RelocalizationServer::processBatchSubset, pendingRequests.data(), responses.data(), (Worker*)(nullptr), 0u, 0u), 0u, (unsigned int)(pendingRequests.size()), 3u, 4u, 1u);
+	}
+	else
+	{
+		// a single request can use the entire worker
+
+		processBatchSubset(pendingRequests.data(), responses.data(), worker_, 0u, (unsigned int)(pendingRequests.size()));
+	}
+}
+
+void RelocalizationServer::processBatchSubset(const PendingRequest* pendingRequests, Response* responses, Worker* worker, const unsigned int firstRequest, const unsigned int numberRequests)
+{
+	ocean_assert(pendingRequests != nullptr && responses != nullptr);
+	ocean_assert(featureMap_);
+
+	RandomGenerator randomGenerator(randomGenerator_);
+
+	for (unsigned int n = firstRequest; n < firstRequest + numberRequests; ++n)
+	{
+		const PendingRequest& pendingRequest = pendingRequests[n];
+		const Request& request = pendingRequest.request_;
+
+		Response& response = responses[n];
+
+		// requests handled later within the same subset are waiting for the previous requests, which counts as queueing
+
+		response.requestId_ = request.requestId_;
+		response.queueLatency_ = std::max(0.0, double(Timestamp(true) - pendingRequest.receiveTimestamp_));
+
+		const HighPerformanceTimer timer;
+
+		const UnifiedDescriptorsFreakMultiLevelSingleViewDescriptor256 imagePointDescriptors(CV::Detector::FREAKDescriptors32(request.imagePointDescriptors_));
+
+		Indices32 usedObjectPointIds;
+
+		HomogenousMatrix4 world_T_camera(false);
+		if (RelocalizerMono::relocalize(*request.camera_, *featureMap_, request.imagePoints_, imagePointDescriptors, randomGenerator, world_T_camera, minimalNumberCorrespondences_, maximalProjectionError_, inlierRate_, request.world_T_roughCamera_, worker, &usedObjectPointIds))
+		{
+			response.succeeded_ = true;
+			response.world_T_camera_ = world_T_camera;
+			response.numberCorrespondences_ = (unsigned int)(usedObjectPointIds.size());
+		}
+
+		response.computeLatency_ = timer.seconds();
+	}
+}
+
+void RelocalizationServer::onReceive(const Network::PackagedTCPServer::ConnectionId connectionId, const void* data, const size_t size)
+{
+	PendingRequest pendingRequest;
+	pendingRequest.connectionId_ = connectionId;
+	pendingRequest.receiveTimestamp_.toNow();
+
+	if (!readRequest(data, size, pendingRequest.request_))
+	{
+		Log::warning() << "RelocalizationServer: Received an invalid request from connection " << connectionId;
+
+		Response response;
+		Buffer buffer;
+
+		if (writeResponse(response, buffer))
+		{
+			tcpServer_.send(connectionId, buffer.data(), buffer.size());
+		}
+
+		return;
+	}
+
+	const ScopedLock scopedLock(lock_);
+
+	pendingRequests_.emplace_back(std::move(pendingRequest));
+
+	requestSignal_.pulse();
+}
+
+bool RelocalizationServer::onConnectionRequest(const Network::Address4& /*address*/, const Network::Port& /*port*/, const Network::PackagedTCPServer::ConnectionId /*connectionId*/)
+{
+	return true;
+}
+
+void RelocalizationServer::onDisconnect(const Network::PackagedTCPServer::ConnectionId connectionId)
+{
+	// requests of a disconnected client do not need to be processed anymore
+
+	const ScopedLock scopedLock(lock_);
+
+	for (size_t n = 0; n < pendingRequests_.size(); /*noop*/)
+	{
+		if (pendingRequests_[n].connectionId_ == connectionId)
+		{
+			pendingRequests_.erase(pendingRequests_.begin() + n);
+		}
+		else
+		{
+			++n;
+		}
+	}
+}
+
+bool RelocalizationServer::writeCamera(const AnyCamera& camera, IO::OutputBitstream& outputBitstream)
+{
+	ocean_assert(camera.isValid());
+
+	unsigned int width = 0u;
+	unsigned int height = 0u;
+	Scalars parameters;
+	unsigned int parameterConfiguration = 0u;
+
+	if (camera.anyCameraType() == AnyCameraType::PINHOLE)
+	{
+		const AnyCameraPinhole* anyCameraPinhole = dynamic_cast<const AnyCameraPinhole*>(&camera);
+
+		if (anyCameraPinhole == nullptr)
+		{
+			return false;
+		}
+
+		PinholeCamera::ParameterConfiguration pinholeParameterConfiguration = PinholeCamera::PC_UNKNOWN;
+		anyCameraPinhole->actualCamera().copyParameters(width, height, parameters, pinholeParameterConfiguration);
+
+		parameterConfiguration = (unsigned int)(pinholeParameterConfiguration);
+	}
+	else if (camera.anyCameraType() == AnyCameraType::FISHEYE)
+	{
+		const AnyCameraFisheye* anyCameraFisheye = dynamic_cast<const AnyCameraFisheye*>(&camera);
+
+		if (anyCameraFisheye == nullptr)
+		{
+			return false;
+		}
+
+		FisheyeCamera::ParameterConfiguration fisheyeParameterConfiguration = FisheyeCamera::PC_UNKNOWN;
+		anyCameraFisheye->actualCamera().copyParameters(width, height, parameters, fisheyeParameterConfiguration);
+
+		parameterConfiguration = (unsigned int)(fisheyeParameterConfiguration);
+	}
+	else
+	{
+		return false;
+	}
+
+	if (!outputBitstream.write<unsigned int>((unsigned int)(camera.anyCameraType())) || !outputBitstream.write<unsigned int>(width) || !outputBitstream.write<unsigned int>(height))
+	{
+		return false;
+	}
+
+	if (!outputBitstream.write<unsigned int>(parameterConfiguration) || !outputBitstream.write<unsigned int>((unsigned int)(parameters.size())))
+	{
+		return false;
+	}
+
+	for (const Scalar& parameter : parameters)
+	{
+		if (!outputBitstream.write<double>(double(parameter)))
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+bool RelocalizationServer::readCamera(IO::InputBitstream& inputBitstream, SharedAnyCamera& camera)
+{
+	unsigned int cameraType = 0u;
+	unsigned int width = 0u;
+	unsigned int height = 0u;
+	unsigned int parameterConfiguration = 0u;
+	unsigned int numberParameters = 0u;
+
+	if (!inputBitstream.read<unsigned int>(cameraType) || !inputBitstream.read<unsigned int>(width) || !inputBitstream.read<unsigned int>(height))
+	{
+		return false;
+	}
+
+	if (!inputBitstream.read<unsigned int>(parameterConfiguration) || !inputBitstream.read<unsigned int>(numberParameters))
+	{
+		return false;
+	}
+
+	if (width == 0u || height == 0u || numberParameters > 12u)
+	{
+		return false;
+	}
+
+	Scalars parameters(numberParameters);
+
+	for (Scalar& parameter : parameters)
+	{
+		double value = 0.0;
+
+		if (!inputBitstream.read<double>(value))
+		{
+			return false;
+		}
+
+		parameter = Scalar(value);
+	}
+
+	if (cameraType == (unsigned int)(AnyCameraType::PINHOLE))
+	{
+		switch (PinholeCamera::ParameterConfiguration(parameterConfiguration))
+		{
+			case PinholeCamera::PC_3_PARAMETERS_ONE_FOCAL_LENGTH:
+				if (numberParameters != 3u)
+				{
+					return false;
+				}
+				break;
+
+			case PinholeCamera::PC_4_PARAMETERS:
+				if (numberParameters != 4u)
+				{
+					return false;
+				}
+				break;
+
+			case PinholeCamera::PC_7_PARAMETERS_ONE_FOCAL_LENGTH:
+				if (numberParameters != 7u)
+				{
+					return false;
+				}
+				break;
+
+			case PinholeCamera::PC_8_PARAMETERS:
+				if (numberParameters != 8u)
+				{
+					return false;
+				}
+				break;
+
+			default:
+				return false;
+		}
+
+		camera = std::make_shared<AnyCameraPinhole>(PinholeCamera(width, height, PinholeCamera::ParameterConfiguration(parameterConfiguration), parameters.data()));
+	}
+	else if (cameraType == (unsigned int)(AnyCameraType::FISHEYE))
+	{
+		switch (FisheyeCamera::ParameterConfiguration(parameterConfiguration))
+		{
+			case FisheyeCamera::PC_3_PARAMETERS_ONE_FOCAL_LENGTH:
+				if (numberParameters != 3u)
+				{
+					return false;
+				}
+				break;
+
+			case FisheyeCamera::PC_4_PARAMETERS:
+				if (numberParameters != 4u)
+				{
+					return false;
+				}
+				break;
+
+			case FisheyeCamera::PC_11_PARAMETERS_ONE_FOCAL_LENGTH:
+				if (numberParameters != 11u)
+				{
+					return false;
+				}
+				break;
+
+			case FisheyeCamera::PC_12_PARAMETERS:
+				if (numberParameters != 12u)
+				{
+					return false;
+				}
+				break;
+
+			default:
+				return false;
+		}
+
+		camera = std::make_shared<AnyCameraFisheye>(FisheyeCamera(width, height, FisheyeCamera::ParameterConfiguration(parameterConfiguration), parameters.data()));
+	}
+	else
+	{
+		return false;
+	}
+
+	return camera->isValid();
+}
+
+bool RelocalizationServer::writePose(const HomogenousMatrix4& pose, IO::OutputBitstream& outputBitstream)
+{
+	if (!outputBitstream.write<bool>(pose.isValid()))
+	{
+		return false;
+	}
+
+	if (pose.isValid())
+	{
+		for (unsigned int n = 0u; n < 16u; ++n)
+		{
+			if (!outputBitstream.write<double>(double(pose[n])))
+			{
+				return false;
+			}
+		}
+	}
+
+	return true;
+}
+
+bool RelocalizationServer::readPose(IO::InputBitstream& inputBitstream, HomogenousMatrix4& pose)
+{
+	bool isValid = false;
+
+	if (!inputBitstream.read<bool>(isValid))
+	{
+		return false;
+	}
+
+	pose = HomogenousMatrix4(false);
+
+	if (isValid)
+	{
+		double values[16];
+
+		for (double& value : values)
+		{
+			if (!inputBitstream.read<double>(value))
+			{
+				return false;
+			}
+		}
+
+		pose = HomogenousMatrix4(values);
+
+		if (!pose.isValid())
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+}
+
+}
+
+}
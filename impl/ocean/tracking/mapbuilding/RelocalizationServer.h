@@ -0,0 +1,362 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#ifndef META_OCEAN_TRACKING_MAPBUILDING_RELOCALIZATION_SERVER_H
+#define META_OCEAN_TRACKING_MAPBUILDING_RELOCALIZATION_SERVER_H
+
+#include "ocean/tracking/mapbuilding/MapBuilding.h"
+#include "ocean/tracking/mapbuilding/UnifiedFeatureMap.h"
+
+#include "ocean/base/Lock.h"
+#include "ocean/base/RandomGenerator.h"
+#include "ocean/base/Signal.h"
+#include "ocean/base/Thread.h"
+#include "ocean/base/Timestamp.h"
+#include "ocean/base/Worker.h"
+
+#include "ocean/cv/detector/FREAKDescriptor.h"
+
+#include "ocean/io/Bitstream.h"
+
+#include "ocean/math/AnyCamera.h"
+#include "ocean/math/HomogenousMatrix4.h"
+
+#include "ocean/network/PackagedTCPServer.h"
+
+namespace Ocean
+{
+
+namespace Tracking
+{
+
+namespace MapBuilding
+{
+
+/**
+ * This class implements a server relocalizing remote mono cameras within a feature map, e.g., for devices which cannot hold a large map.
+ * Clients do not send images but the 2D image points and the multi-level FREAK descriptors of their features, the server responds with the camera pose.<br>
+ * The server collects the requests of all clients in a short time window and processes the entire batch at once, distributing the matching of individual requests across a worker.<br>
+ * Each response contains the time a request has been waiting in the queue and the time needed to relocalize the request.<br>
+ * Requests and responses are serialized with writeRequest(), readRequest(), writeResponse(), and readResponse(), and are transmitted as individual packages of a PackagedTCPServer and PackagedTCPClient.
+ * @ingroup trackingmapbuilding
+ */
+class OCEAN_TRACKING_MAPBUILDING_EXPORT RelocalizationServer : protected Thread
+{
+	public:
+
+		/**
+		 * Definition of a vector holding bytes.
+		 */
+		using Buffer = std::vector<uint8_t>;
+
+		/**
+		 * This class holds a relocalization request of a client.
+		 */
+		class Request
+		{
+			public:
+
+				/**
+				 * Returns whether this request holds valid data.
+				 * @return True, if so
+				 */
+				inline bool isValid() const;
+
+			public:
+
+				/// The client-defined id of the request, returned with the response.
+				uint32_t requestId_ = 0u;
+
+				/// The camera profile of the camera which has captured the image, a pinhole or a fisheye camera.
+				SharedAnyCamera camera_;
+
+				/// Optional rough camera pose transforming camera to world, invalid if unknown.
+				HomogenousMatrix4 world_T_roughCamera_ = HomogenousMatrix4(false);
+
+				/// The 2D image points of the features.
+				Vectors2 imagePoints_;
+
+				/// The descriptors of the image points, one for each image point.
+				CV::Detector::FREAKDescriptors32 imagePointDescriptors_;
+		};
+
+		/**
+		 * This class holds the response for a relocalization request.
+		 */
+		class Response
+		{
+			public:
+
+				/// The id of the request to which this response belongs.
+				uint32_t requestId_ = 0u;
+
+				/// True, if the request could be relocalized.
+				bool succeeded_ = false;
+
+				/// The resulting camera pose transforming camera to world, invalid if the relocalization failed.
+				HomogenousMatrix4 world_T_camera_ = HomogenousMatrix4(false);
+
+				/// The number of 2D/3D correspondences which have been used to determine the pose.
+				uint32_t numberCorrespondences_ = 0u;
+
+				/// The time the request was waiting in the queue of the server before the relocalization started, in seconds, with range [0, infinity).
+				double queueLatency_ = 0.0;
+
+				/// The time the server needed to relocalize the request, in seconds, with range [0, infinity).
+				double computeLatency_ = 0.0;
+		};
+
+	protected:
+
+		/**
+		 * This class holds a request which has been received and which is waiting for processing.
+		 */
+		class PendingRequest
+		{
+			public:
+
+				/// The id of the connection from which the request has been received.
+				Network::PackagedTCPServer::ConnectionId connectionId_ = Network::PackagedTCPServer::invalidConnectionId();
+
+				/// The timestamp when the request has been received.
+				Timestamp receiveTimestamp_ = Timestamp(false);
+
+				/// The request.
+				Request request_;
+		};
+
+		/**
+		 * Definition of a vector holding pending requests.
+		 */
+		using PendingRequests = std::vector<PendingRequest>;
+
+		/**
+		 * Definition of a vector holding responses.
+		 */
+		using Responses = std::vector<Response>;
+
+	public:
+
+		/**
+		 * Creates a new relocalization server.
+		 * @param featureMap The feature map in which the cameras will be relocalized, with multi-level FREAK descriptors, must be valid
+		 * @param worker Optional worker to distribute the relocalization of a batch of requests, nullptr to process all requests in the thread of the server
+		 * @param maximalBatchSize The maximal number of requests which are processed within one batch, with range [1, infinity)
+		 * @param batchWindow The time the server waits for further requests after the first request of a new batch has been received, in seconds, with range [0, infinity)
+		 */
+		explicit RelocalizationServer(SharedUnifiedFeatureMap featureMap, Worker* worker = nullptr, const unsigned int maximalBatchSize = 16u, const double batchWindow = 0.005);
+
+		/**
+		 * Destructs the server, the server is stopped.
+		 */
+		~RelocalizationServer() override;
+
+		/**
+		 * Sets the parameters of the relocalization, should be called before the server is started.
+		 * @param minimalNumberCorrespondences The minimal number of 2D/3D correspondences so that a camera pose counts as valid, with range [4, infinity)
+		 * @param maximalProjectionError The maximal projection error between 3D object points and their 2D observations, in pixels, with range [0, infinity)
+		 * @param inlierRate The rate of correspondence inliers within the entire set of correspondences, with range (0, 1]
+		 * @return True, if succeeded
+		 */
+		bool setParameters(const unsigned int minimalNumberCorrespondences, const Scalar maximalProjectionError, const Scalar inlierRate = Scalar(0.15));
+
+		/**
+		 * Starts the server.
+		 * @param port The port on which the server will listen for connections, a default port to use an arbitrary free port
+		 * @return True, if succeeded
+		 * @see port().
+		 */
+		bool start(const Network::Port& port = Network::Port());
+
+		/**
+		 * Stops the server, pending requests are discarded.
+		 * @return True, if succeeded
+		 */
+		bool stop();
+
+		/**
+		 * Returns the port on which the server is listening.
+		 * @return The server's port
+		 */
+		inline Network::Port port() const;
+
+		/**
+		 * Returns the number of requests which have been received and which are waiting for processing.
+		 * @return The number of pending requests
+		 */
+		size_t pendingRequests() const;
+
+		/**
+		 * Serializes a relocalization request.
+		 * @param request The request to serialize, must be valid
+		 * @param buffer The resulting buffer holding the serialized request
+		 * @return True, if succeeded
+		 */
+		static bool writeRequest(const Request& request, Buffer& buffer);
+
+		/**
+		 * Parses a serialized relocalization request.
+		 * @param data The serialized request, must be valid
+		 * @param size The size of the serialized request, in bytes, with range [1, infinity)
+		 * @param request The resulting request
+		 * @return True, if succeeded
+		 */
+		static bool readRequest(const void* data, const size_t size, Request& request);
+
+		/**
+		 * Serializes the response of a relocalization request.
+		 * @param response The response to serialize
+		 * @param buffer The resulting buffer holding the serialized response
+		 * @return True, if succeeded
+		 */
+		static bool writeResponse(const Response& response, Buffer& buffer);
+
+		/**
+		 * Parses a serialized response of a relocalization request.
+		 * @param data The serialized response, must be valid
+		 * @param size The size of the serialized response, in bytes, with range [1, infinity)
+		 * @param response The resulting response
+		 * @return True, if succeeded
+		 */
+		static bool readResponse(const void* data, const size_t size, Response& response);
+
+	protected:
+
+		/**
+		 * The thread run function collecting and processing the batches of requests.
+		 * @see Thread::threadRun().
+		 */
+		void threadRun() override;
+
+		/**
+		 * Relocalizes a batch of requests.
+		 * @param pendingRequests The requests to relocalize, at least one
+		 * @param responses The resulting responses, one for each request
+		 */
+		void processBatch(const PendingRequests& pendingRequests, Responses& responses);
+
+		/**
+		 * Relocalizes a subset of a batch of requests.
+		 * @param pendingRequests The requests of the entire batch, must be valid
+		 * @param responses The responses of the entire batch, one for each request, must be valid
+		 * @param worker Optional worker to be used for the relocalization of an individual request, nullptr if the batch is distributed already
+		 * @param firstRequest The index of the first request to be handled, with range [0, numberRequests)
+		 * @param numberRequests The number of requests to be handled, with range [1, numberRequests - firstRequest]
+		 */
+		void processBatchSubset(const PendingRequest* pendingRequests, Response* responses, Worker* worker, const unsigned int firstRequest, const unsigned int numberRequests);
+
+		/**
+		 * Event function for received data.
+		 * @param connectionId The id of the connection from which the data has been received
+		 * @param data The received data
+		 * @param size The size of the received data, in bytes
+		 */
+		void onReceive(const Network::PackagedTCPServer::ConnectionId connectionId, const void* data, const size_t size);
+
+		/**
+		 * Event function for new connection requests.
+		 * @param address The address of the client
+		 * @param port The port of the client
+		 * @param connectionId The id of the new connection
+		 * @return True, to accept the connection
+		 */
+		bool onConnectionRequest(const Network::Address4& address, const Network::Port& port, const Network::PackagedTCPServer::ConnectionId connectionId);
+
+		/**
+		 * Event function for disconnected connections.
+		 * @param connectionId The id of the connection which has been disconnected
+		 */
+		void onDisconnect(const Network::PackagedTCPServer::ConnectionId connectionId);
+
+		/**
+		 * Writes a camera profile to a bitstream.
+		 * @param camera The camera profile to write, a pinhole or fisheye camera, must be valid
+		 * @param outputBitstream The bitstream to which the camera will be written
+		 * @return True, if succeeded
+		 */
+		static bool writeCamera(const AnyCamera& camera, IO::OutputBitstream& outputBitstream);
+
+		/**
+		 * Reads a camera profile from a bitstream.
+		 * @param inputBitstream The bitstream from which the camera will be read
+		 * @param camera The resulting camera profile
+		 * @return True, if succeeded
+		 */
+		static bool readCamera(IO::InputBitstream& inputBitstream, SharedAnyCamera& camera);
+
+		/**
+		 * Writes a camera pose to a bitstream.
+		 * @param pose The pose to write, can be invalid
+		 * @param outputBitstream The bitstream to which the pose will be written
+		 * @return True, if succeeded
+		 */
+		static bool writePose(const HomogenousMatrix4& pose, IO::OutputBitstream& outputBitstream);
+
+		/**
+		 * Reads a camera pose from a bitstream.
+		 * @param inputBitstream The bitstream from which the pose will be read
+		 * @param pose The resulting pose
+		 * @return True, if succeeded
+		 */
+		static bool readPose(IO::InputBitstream& inputBitstream, HomogenousMatrix4& pose);
+
+	protected:
+
+		/// The feature map in which the cameras are relocalized.
+		SharedUnifiedFeatureMap featureMap_;
+
+		/// Optional worker to distribute the relocalization of a batch.
+		Worker* worker_ = nullptr;
+
+		/// The maximal number of requests within one batch.
+		unsigned int maximalBatchSize_ = 16u;
+
+		/// The time the server waits for further requests of a new batch, in seconds.
+		double batchWindow_ = 0.005;
+
+		/// The minimal number of 2D/3D correspondences so that a camera pose counts as valid.
+		unsigned int minimalNumberCorrespondences_ = 30u;
+
+		/// The maximal projection error between 3D object points and their 2D observations, in pixels.
+		Scalar maximalProjectionError_ = Scalar(3.5);
+
+		/// The rate of correspondence inliers within the entire set of correspondences.
+		Scalar inlierRate_ = Scalar(0.15);
+
+		/// The TCP server receiving the requests and sending the responses.
+		Network::PackagedTCPServer tcpServer_;
+
+		/// The requests which have been received and which are waiting for processing.
+		PendingRequests pendingRequests_;
+
+		/// The signal which is pulsed whenever a new request has been received.
+		Signal requestSignal_;
+
+		/// The random generator of the server.
+		RandomGenerator randomGenerator_;
+
+		/// The lock of the pending requests.
+		mutable Lock lock_;
+};
+
+inline bool RelocalizationServer::Request::isValid() const
+{
+	return camera_ && camera_->isValid() && !imagePoints_.empty() && imagePoints_.size() == imagePointDescriptors_.size();
+}
+
+inline Network::Port RelocalizationServer::port() const
+{
+	return tcpServer_.port();
+}
+
+}
+
+}
+
+}
+
+#endif // META_OCEAN_TRACKING_MAPBUILDING_RELOCALIZATION_SERVER_H
@@ -30,6 +30,11 @@ bool Relocalizer::setImageFeaturePointDetectorFunction(ImageFeaturePointDetector
 
 	imageFeaturePointDetectorFunction_ = std::move(imageFeaturePointDetectorFunction);
 
+	for (FeatureCache& featureCache : featureCaches_)
+	{
+		featureCache.reset();
+	}
+
 	return true;
 }
 
@@ -39,6 +44,34 @@ bool Relocalizer::setFeatureMap(SharedUnifiedFeatureMap featureMap)
 
 	featureMap_ = std::move(featureMap);
 
+	// the cached features are still valid for the new map, but failed attempts need to be repeated
+
+	for (FeatureCache& featureCache : featureCaches_)
+	{
+		featureCache.setAttemptFailed(false);
+	}
+
+	return true;
+}
+
+bool Relocalizer::setFeatureCache(const double maximalCacheAge, const bool skipFailedAttempts)
+{
+	ocean_assert(maximalCacheAge >= 0.0);
+
+	if (maximalCacheAge < 0.0)
+	{
+		return false;
+	}
+
+	const ScopedLock scopedLock(lock_);
+
+	for (FeatureCache& featureCache : featureCaches_)
+	{
+		featureCache.setMaximalAge(maximalCacheAge);
+	}
+
+	skipFailedAttempts_ = skipFailedAttempts;
+
 	return true;
 }
 
@@ -103,11 +136,107 @@ Relocalizer& Relocalizer::operator=(Relocalizer&& relocalizer)
 		featureMap_ = std::move(relocalizer.featureMap_);
 
 		randomGenerator_ = std::move(relocalizer.randomGenerator_);
+
+		featureCaches_ = std::move(relocalizer.featureCaches_);
+
+		skipFailedAttempts_ = relocalizer.skipFailedAttempts_;
 	}
 
 	return *this;
 }
 
+Relocalizer::FeatureCache::CacheResult Relocalizer::FeatureCache::features(const ImageFeaturePointDetectorFunction& imageFeaturePointDetectorFunction, const AnyCamera& camera, const Frame& yFrame, Vectors2& imagePoints, SharedUnifiedDescriptors& imagePointDescriptors, Worker* worker)
+{
+	ocean_assert(imageFeaturePointDetectorFunction);
+	ocean_assert(camera.isValid() && yFrame.isValid());
+
+	if (isEnabled() && yFrame.timestamp().isValid())
+	{
+		if (yFrame.width() != keyframeWidth_ || yFrame.height() != keyframeHeight_ || (keyframeTimestamp_.isValid() && yFrame.timestamp() < keyframeTimestamp_))
+		{
+			reset();
+		}
+
+		if (!frameChangeDetector_.isValid())
+		{
+			// the change detector works on a small version of the frame, large enough to cover the frame with several tiles
+
+			CV::Detector::FrameChangeDetector::Options options;
+			options.targetFrameWidth = std::min(yFrame.width(), 160u);
+			options.targetFrameHeight = std::max(1u, (yFrame.height() * options.targetFrameWidth + yFrame.width() / 2u) / yFrame.width());
+			options.spatialBinSize = std::max(4u, std::min(20u, std::min(options.targetFrameWidth, options.targetFrameHeight) / 2u));
+			options.preferredMaximumTimeBetweenKeyframes = maximalAge_;
+			options.absoluteMaximumTimeBetweenKeyframes = maximalAge_;
+
+			frameChangeDetector_ = CV::Detector::FrameChangeDetector(options);
+
+			keyframeWidth_ = yFrame.width();
+			keyframeHeight_ = yFrame.height();
+		}
+
+		const CV::Detector::FrameChangeDetector::FrameChangeResult frameChangeResult = frameChangeDetector_.detectFrameChange(yFrame, Quaternion(false), worker);
+
+		if (frameChangeResult == CV::Detector::FrameChangeDetector::FrameChangeResult::NO_CHANGE_DETECTED && imagePointDescriptors_ && double(yFrame.timestamp() - keyframeTimestamp_) <= maximalAge_)
+		{
+			imagePoints = imagePoints_;
+			imagePointDescriptors = imagePointDescriptors_;
+
+			return CR_REUSED;
+		}
+
+		imagePoints_.clear();
+		imagePointDescriptors_ = nullptr;
+		attemptFailed_ = false;
+
+		if (frameChangeResult != CV::Detector::FrameChangeDetector::FrameChangeResult::CHANGE_DETECTED)
+		{
+			// the frame is not a keyframe (e.g., as the keyframe's features could not be determined), the keyframe needs to be replaced with the next frame
+
+			reset();
+		}
+	}
+
+	if (!imageFeaturePointDetectorFunction(camera, yFrame, imagePoints, imagePointDescriptors) || !imagePointDescriptors || imagePoints.empty())
+	{
+		return CR_FAILED;
+	}
+
+	if (isEnabled() && frameChangeDetector_.isValid())
+	{
+		imagePoints_ = imagePoints;
+		imagePointDescriptors_ = imagePointDescriptors;
+		keyframeTimestamp_ = yFrame.timestamp();
+	}
+
+	return CR_DETECTED;
+}
+
+void Relocalizer::FeatureCache::setMaximalAge(const double maximalAge)
+{
+	ocean_assert(maximalAge >= 0.0);
+
+	if (maximalAge != maximalAge_)
+	{
+		maximalAge_ = maximalAge;
+
+		reset();
+	}
+}
+
+void Relocalizer::FeatureCache::reset()
+{
+	frameChangeDetector_ = CV::Detector::FrameChangeDetector();
+
+	imagePoints_.clear();
+	imagePointDescriptors_ = nullptr;
+
+	keyframeTimestamp_.toInvalid();
+	keyframeWidth_ = 0u;
+	keyframeHeight_ = 0u;
+
+	attemptFailed_ = false;
+}
+
 }
 
 }
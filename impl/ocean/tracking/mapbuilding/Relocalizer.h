@@ -12,6 +12,9 @@
 #include "ocean/tracking/mapbuilding/UnifiedDescriptor.h"
 #include "ocean/tracking/mapbuilding/UnifiedFeatureMap.h"
 
+#include "ocean/cv/detector/FrameChangeDetector.h"
+
+#include <array>
 #include <functional>
 
 namespace Ocean
@@ -41,6 +44,105 @@ class OCEAN_TRACKING_MAPBUILDING_EXPORT Relocalizer
 		 */
 		using ImageFeaturePointDetectorFunction = std::function<bool(const AnyCamera& camera, const Frame& yFrame, Vectors2& imagePoints, SharedUnifiedDescriptors& imagePointDescriptors)>;
 
+	protected:
+
+		/**
+		 * This class implements a short-lived cache for the features of a keyframe.
+		 * The cache avoids detecting and describing features in every relocalization attempt while the camera observes almost the same content.<br>
+		 * Whether a frame is similar enough to the cached keyframe is determined with a frame change detector based on local intensity histograms, the cached features are not reused once they are older than the maximal cache age.
+		 */
+		class OCEAN_TRACKING_MAPBUILDING_EXPORT FeatureCache
+		{
+			public:
+
+				/**
+				 * Definition of individual results when requesting features.
+				 */
+				enum CacheResult : uint32_t
+				{
+					/// The features could not be determined.
+					CR_FAILED = 0u,
+					/// The features have been detected in the given frame, the frame is the new keyframe of the cache.
+					CR_DETECTED,
+					/// The features of the cached keyframe have been reused as the given frame is similar to the keyframe.
+					CR_REUSED
+				};
+
+			public:
+
+				/**
+				 * Creates a new disabled cache.
+				 */
+				FeatureCache() = default;
+
+				/**
+				 * Returns the features of a given frame, either reused from the cached keyframe or freshly detected.
+				 * @param imageFeaturePointDetectorFunction The function to detect and describe feature points, must be valid
+				 * @param camera The camera profile associated with the frame, must be valid
+				 * @param yFrame The frame for which the features will be returned, with pixel format FORMAT_Y8, must be valid
+				 * @param imagePoints The resulting image points
+				 * @param imagePointDescriptors The resulting descriptors, one for each image point
+				 * @param worker Optional worker to distribute the computation
+				 * @return The result of the request
+				 */
+				CacheResult features(const ImageFeaturePointDetectorFunction& imageFeaturePointDetectorFunction, const AnyCamera& camera, const Frame& yFrame, Vectors2& imagePoints, SharedUnifiedDescriptors& imagePointDescriptors, Worker* worker);
+
+				/**
+				 * Sets the maximal age of the cached features.
+				 * @param maximalAge The maximal time between the keyframe and a frame reusing the keyframe's features, in seconds, with range [0, infinity), 0 to disable the cache
+				 */
+				void setMaximalAge(const double maximalAge);
+
+				/**
+				 * Marks whether the relocalization with the currently cached features has failed.
+				 * @param failed True, if the relocalization failed
+				 */
+				inline void setAttemptFailed(const bool failed);
+
+				/**
+				 * Returns whether a relocalization with the currently cached features has failed already.
+				 * @return True, if so
+				 */
+				inline bool attemptFailed() const;
+
+				/**
+				 * Returns whether this cache is enabled.
+				 * @return True, if so
+				 */
+				inline bool isEnabled() const;
+
+				/**
+				 * Removes all cached features, the next request will detect new features.
+				 */
+				void reset();
+
+			protected:
+
+				/// The maximal age of the cached features in seconds, 0 if the cache is disabled.
+				double maximalAge_ = 0.0;
+
+				/// The frame change detector deciding whether a frame is similar to the keyframe.
+				CV::Detector::FrameChangeDetector frameChangeDetector_;
+
+				/// The image points of the cached keyframe.
+				Vectors2 imagePoints_;
+
+				/// The descriptors of the cached keyframe, one for each image point.
+				SharedUnifiedDescriptors imagePointDescriptors_;
+
+				/// The timestamp of the cached keyframe.
+				Timestamp keyframeTimestamp_ = Timestamp(false);
+
+				/// The width of the cached keyframe, in pixel.
+				unsigned int keyframeWidth_ = 0u;
+
+				/// The height of the cached keyframe, in pixel.
+				unsigned int keyframeHeight_ = 0u;
+
+				/// True, if a relocalization with the cached features has failed.
+				bool attemptFailed_ = false;
+		};
+
 	public:
 
 		/**
@@ -62,6 +164,15 @@ class OCEAN_TRACKING_MAPBUILDING_EXPORT Relocalizer
 		 */
 		virtual bool setFeatureMap(SharedUnifiedFeatureMap featureMap);
 
+		/**
+		 * Configures the short-lived cache for the features of a keyframe.
+		 * While enabled, relocalization attempts for frames which are similar to the last keyframe reuse the keyframe's features instead of detecting and describing new features.
+		 * @param maximalCacheAge The maximal time a keyframe's features are reused, in seconds, with range [0, infinity), 0 to disable the cache
+		 * @param skipFailedAttempts True, to skip relocalization attempts for frames which are similar to a keyframe for which the relocalization has failed already (unless a rough pose is provided); False, to always relocalize
+		 * @return True, if succeeded
+		 */
+		bool setFeatureCache(const double maximalCacheAge, const bool skipFailedAttempts = true);
+
 		/**
 		 * Returns the object points of this relocalizer.
 		 * This function is not thread-safe.
@@ -123,10 +234,31 @@ class OCEAN_TRACKING_MAPBUILDING_EXPORT Relocalizer
 		/// The random generator object to be used.
 		RandomGenerator randomGenerator_;
 
+		/// The caches for the features of keyframes, one for each camera; mono relocalizers use the first cache only.
+		std::array<FeatureCache, 2> featureCaches_;
+
+		/// True, to skip relocalization attempts for frames similar to a keyframe for which the relocalization has failed already.
+		bool skipFailedAttempts_ = true;
+
 		/// The relocalizer's lock.
 		mutable Lock lock_;
 };
 
+inline void Relocalizer::FeatureCache::setAttemptFailed(const bool failed)
+{
+	attemptFailed_ = failed;
+}
+
+inline bool Relocalizer::FeatureCache::attemptFailed() const
+{
+	return attemptFailed_;
+}
+
+inline bool Relocalizer::FeatureCache::isEnabled() const
+{
+	return maximalAge_ > 0.0;
+}
+
 inline const Vectors3& Relocalizer::objectPoints() const
 {
 	ocean_assert(isValid());
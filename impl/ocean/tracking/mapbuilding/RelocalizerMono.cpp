@@ -47,44 +47,42 @@ bool RelocalizerMono::relocalize(const AnyCamera& camera, const Frame& yFrame, H
 	Vectors2 imagePoints;
 	SharedUnifiedDescriptors imagePointDescriptors;
 
+	FeatureCache& featureCache = featureCaches_[0];
+
 	ocean_assert(imageFeaturePointDetectorFunction_);
-	if (!imageFeaturePointDetectorFunction_(camera, yFrame, imagePoints, imagePointDescriptors))
+	const FeatureCache::CacheResult cacheResult = featureCache.features(imageFeaturePointDetectorFunction_, camera, yFrame, imagePoints, imagePointDescriptors, worker);
+
+	if (cacheResult == FeatureCache::CR_FAILED)
 	{
 		return false;
 	}
 
-	ocean_assert(imagePointDescriptors && !imagePoints.empty() && imagePoints.size() == imagePointDescriptors->numberDescriptors());
-
-	const SharedUnifiedFeatureMap featureMap(featureMap_);
-
-	if (!featureMap || !featureMap->isValid())
+	if (cacheResult == FeatureCache::CR_REUSED && featureCache.attemptFailed() && skipFailedAttempts_ && !world_T_roughCamera.isValid())
 	{
+		// the frame is almost identical to a keyframe which could not be relocalized, there is no reason to try again
 		return false;
 	}
 
-	SharedUnifiedUnguidedMatching unifiedUnguidedMatching;
-	SharedUnifiedGuidedMatching unifiedGuidedMatching;
+	ocean_assert(imagePointDescriptors && !imagePoints.empty() && imagePoints.size() == imagePointDescriptors->numberDescriptors());
 
-	if (!featureMap->createMatchingObjects(imagePoints.data(), imagePointDescriptors.get(), unifiedUnguidedMatching, unifiedGuidedMatching))
+	const SharedUnifiedFeatureMap featureMap(featureMap_);
+
+	if (!featureMap || !featureMap->isValid())
 	{
 		return false;
 	}
 
-	constexpr unsigned int binaryDistanceThreshold = 256u * 20u / 100u; // **TODO**
-	constexpr float floatDistanceThreshold = 0.5f; // **TODO**
-
-	const UnifiedMatching::DistanceValue maximalDescriptorDistance(binaryDistanceThreshold, floatDistanceThreshold);
-
-	ocean_assert(unifiedUnguidedMatching && unifiedGuidedMatching);
-
 	Indices32 imagePointIndices;
 
-	world_T_camera.toNull();
-	if (!Tracking::MapBuilding::PoseEstimation::determinePose(camera, *unifiedUnguidedMatching, *unifiedGuidedMatching, randomGenerator_, world_T_camera, minimalNumberCorrespondence, maximalDescriptorDistance, maximalProjectionError, inlierRate, usedObjectPointIds, &imagePointIndices, world_T_roughCamera, worker))
+	if (!relocalize(camera, *featureMap, imagePoints, *imagePointDescriptors, randomGenerator_, world_T_camera, minimalNumberCorrespondence, maximalProjectionError, inlierRate, world_T_roughCamera, worker, usedObjectPointIds, &imagePointIndices))
 	{
+		featureCache.setAttemptFailed(true);
+
 		return false;
 	}
 
+	featureCache.setAttemptFailed(false);
+
 	if (usedImagePoints != nullptr)
 	{
 		for (const Index32& imagePointIndex : imagePointIndices)
@@ -114,6 +112,40 @@ bool RelocalizerMono::relocalize(const AnyCamera& camera, const Frame& yFrame, H
 	return true;
 }
 
+bool RelocalizerMono::relocalize(const AnyCamera& camera, UnifiedFeatureMap& featureMap, const Vectors2& imagePoints, const UnifiedDescriptors& imagePointDescriptors, RandomGenerator& randomGenerator, HomogenousMatrix4& world_T_camera, const unsigned int minimalNumberCorrespondence, const Scalar maximalProjectionError, const Scalar inlierRate, const HomogenousMatrix4& world_T_roughCamera, Worker* worker, Indices32* usedObjectPointIds, Indices32* usedImagePointIndices)
+{
+	ocean_assert(camera.isValid() && featureMap.isValid());
+	ocean_assert(!imagePoints.empty() && imagePoints.size() == imagePointDescriptors.numberDescriptors());
+
+	ocean_assert(minimalNumberCorrespondence >= 4u);
+	ocean_assert(maximalProjectionError >= Scalar(0));
+	ocean_assert(inlierRate > Scalar(0) && inlierRate <= Scalar(1));
+
+	world_T_camera.toNull();
+
+	if (!camera.isValid() || !featureMap.isValid() || imagePoints.empty() || imagePoints.size() != imagePointDescriptors.numberDescriptors())
+	{
+		return false;
+	}
+
+	SharedUnifiedUnguidedMatching unifiedUnguidedMatching;
+	SharedUnifiedGuidedMatching unifiedGuidedMatching;
+
+	if (!featureMap.createMatchingObjects(imagePoints.data(), &imagePointDescriptors, unifiedUnguidedMatching, unifiedGuidedMatching))
+	{
+		return false;
+	}
+
+	constexpr unsigned int binaryDistanceThreshold = 256u * 20u / 100u; // **TODO**
+	constexpr float floatDistanceThreshold = 0.5f; // **TODO**
+
+	const UnifiedMatching::DistanceValue maximalDescriptorDistance(binaryDistanceThreshold, floatDistanceThreshold);
+
+	ocean_assert(unifiedUnguidedMatching && unifiedGuidedMatching);
+
+	return Tracking::MapBuilding::PoseEstimation::determinePose(camera, *unifiedUnguidedMatching, *unifiedGuidedMatching, randomGenerator, world_T_camera, minimalNumberCorrespondence, maximalDescriptorDistance, maximalProjectionError, inlierRate, usedObjectPointIds, usedImagePointIndices, world_T_roughCamera, worker);
+}
+
 }
 
 }
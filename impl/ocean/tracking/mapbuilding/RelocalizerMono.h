@@ -95,6 +95,26 @@ class OCEAN_TRACKING_MAPBUILDING_EXPORT RelocalizerMono : public Relocalizer
 		 */
 		bool relocalize(const AnyCamera& camera, const Frame& yFrame, HomogenousMatrix4& world_T_camera, const unsigned int minimalNumberCorrespondences, const Scalar maximalProjectionError, const Scalar inlierRate = Scalar(0.15), const HomogenousMatrix4& world_T_roughCamera = HomogenousMatrix4(false), Worker* worker = nullptr, Indices32* usedObjectPointIds = nullptr, Vectors2* usedImagePoints = nullptr);
 
+		/**
+		 * Relocalizes a camera based on image features which have been detected and described already, e.g., by a remote device.
+		 * This function is thread-safe as long as the feature map is not modified concurrently.
+		 * @param camera The camera profile defining the projection, must be valid
+		 * @param featureMap The feature map to be used for relocalization, must be valid
+		 * @param imagePoints The 2D image points of the features, at least one
+		 * @param imagePointDescriptors The descriptors of the image points, one for each image point, must match the descriptor type of the feature map
+		 * @param randomGenerator The random generator to be used
+		 * @param world_T_camera The resulting camera pose transforming camera to world, with default camera pose pointing towards the negative z-space and y-axis upwards
+		 * @param minimalNumberCorrespondences The minimal number of 2D/3D correspondences so that a camera pose counts as valid, with range [4, infinity)
+		 * @param maximalProjectionError The maximal projection error between 3D object points and their 2D observations, in pixels, with range [0, infinity)
+		 * @param inlierRate The rate of correspondence inliers within the entire set of correspondences, with range (0, 1]
+		 * @param world_T_roughCamera Optional rough camera pose to speedup the relocalization, if known, invalid otherwise
+		 * @param worker Optional worker to distribute the computation
+		 * @param usedObjectPointIds Optional resulting ids of the 3D object points which have been used during relocalization, nullptr if not of interest
+		 * @param usedImagePointIndices Optional resulting indices of the 2D image points which have been used during relocalization, nullptr if not of interest
+		 * @return True, if succeeded
+		 */
+		static bool relocalize(const AnyCamera& camera, UnifiedFeatureMap& featureMap, const Vectors2& imagePoints, const UnifiedDescriptors& imagePointDescriptors, RandomGenerator& randomGenerator, HomogenousMatrix4& world_T_camera, const unsigned int minimalNumberCorrespondences, const Scalar maximalProjectionError, const Scalar inlierRate = Scalar(0.15), const HomogenousMatrix4& world_T_roughCamera = HomogenousMatrix4(false), Worker* worker = nullptr, Indices32* usedObjectPointIds = nullptr, Indices32* usedImagePointIndices = nullptr);
+
 		/**
 		 * Move operator.
 		 * @param relocalizerMono The relocalizer to be moved
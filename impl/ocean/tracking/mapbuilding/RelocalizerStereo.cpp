@@ -53,8 +53,12 @@ bool RelocalizerStereo::relocalize(const AnyCamera& cameraA, const AnyCamera& ca
 	Vectors2 imagePointsA;
 	SharedUnifiedDescriptors imagePointDescriptorsA;
 
+	FeatureCache& featureCacheA = featureCaches_[0];
+
 	ocean_assert(imageFeaturePointDetectorFunction_);
-	if (!imageFeaturePointDetectorFunction_(cameraA, yFrameA, imagePointsA, imagePointDescriptorsA) || imagePointsA.empty())
+	const FeatureCache::CacheResult cacheResultA = featureCacheA.features(imageFeaturePointDetectorFunction_, cameraA, yFrameA, imagePointsA, imagePointDescriptorsA, worker);
+
+	if (cacheResultA == FeatureCache::CR_FAILED)
 	{
 		return false;
 	}
@@ -62,12 +66,21 @@ bool RelocalizerStereo::relocalize(const AnyCamera& cameraA, const AnyCamera& ca
 	Vectors2 imagePointsB;
 	SharedUnifiedDescriptors imagePointDescriptorsB;
 
-	ocean_assert(imageFeaturePointDetectorFunction_);
-	if (!imageFeaturePointDetectorFunction_(cameraB, yFrameB, imagePointsB, imagePointDescriptorsB) || imagePointsB.empty())
+	FeatureCache& featureCacheB = featureCaches_[1];
+
+	const FeatureCache::CacheResult cacheResultB = featureCacheB.features(imageFeaturePointDetectorFunction_, cameraB, yFrameB, imagePointsB, imagePointDescriptorsB, worker);
+
+	if (cacheResultB == FeatureCache::CR_FAILED)
 	{
 		return false;
 	}
 
+	if (cacheResultA == FeatureCache::CR_REUSED && cacheResultB == FeatureCache::CR_REUSED && featureCacheA.attemptFailed() && featureCacheB.attemptFailed() && skipFailedAttempts_ && !world_T_roughDevice.isValid())
+	{
+		// both frames are almost identical to keyframes which could not be relocalized, there is no reason to try again
+		return false;
+	}
+
 	ocean_assert(imagePointDescriptorsA && !imagePointsA.empty() && imagePointsA.size() == imagePointDescriptorsA->numberDescriptors());
 	ocean_assert(imagePointDescriptorsB && !imagePointsB.empty() && imagePointsB.size() == imagePointDescriptorsB->numberDescriptors());
 	ocean_assert(imagePointDescriptorsA->descriptorType() == imagePointDescriptorsB->descriptorType());
@@ -85,37 +98,26 @@ bool RelocalizerStereo::relocalize(const AnyCamera& cameraA, const AnyCamera& ca
 		return false;
 	}
 
-	const CV::Detector::FREAKDescriptor32* freakImagePointDescriptorsA = dynamic_cast<const UnifiedDescriptorsFreakMultiLevelSingleViewDescriptor256*>(imagePointDescriptorsA.get())->descriptors();
-	const CV::Detector::FREAKDescriptor32* freakImagePointDescriptorsB = dynamic_cast<const UnifiedDescriptorsFreakMultiLevelSingleViewDescriptor256*>(imagePointDescriptorsB.get())->descriptors();
+	// the feature map creates the matching objects, so that the relocalizer does not depend on the map's internal data structures (e.g., for memory-mapped maps)
+
+	SharedUnifiedUnguidedMatching unifiedUnguidedMatchingA;
+	SharedUnifiedGuidedMatching unifiedGuidedMatchingA;
 
-	if (featureMap->descriptorMap().descriptorType() != UnifiedDescriptor::DT_FREAK_MULTI_LEVEL_MULTI_VIEW_256)
+	if (!featureMap->createMatchingObjects(imagePointsA.data(), imagePointDescriptorsA.get(), unifiedUnguidedMatchingA, unifiedGuidedMatchingA))
 	{
-		ocean_assert(false && "Other descriptors not yet supported!");
 		return false;
 	}
 
-	if (featureMap->objectPointVocabularyDescriptors().descriptorType() != UnifiedDescriptor::binaryDescriptorType<false, false, 256u>())
+	SharedUnifiedUnguidedMatching unifiedUnguidedMatchingB;
+	SharedUnifiedGuidedMatching unifiedGuidedMatchingB;
+
+	if (!featureMap->createMatchingObjects(imagePointsB.data(), imagePointDescriptorsB.get(), unifiedUnguidedMatchingB, unifiedGuidedMatchingB))
 	{
-		ocean_assert(false && "Other descriptors not yet supported!");
 		return false;
 	}
 
-	using Descriptor = UnifiedDescriptor::BinaryDescriptor<256u>;
-	using VocabularyForest = Tracking::VocabularyForest<Descriptor, unsigned int, UnifiedDescriptorT<Descriptor>::determineDistance>;
-
-	const UnifiedDescriptorsBinarySingleLevelSingleView<256u>* specializedObjectPointDescriptors = dynamic_cast<const UnifiedDescriptorsBinarySingleLevelSingleView<256u>*>(&featureMap->objectPointVocabularyDescriptors());
-	ocean_assert(specializedObjectPointDescriptors != nullptr);
-
-	const VocabularyForest* vocabularyForest = dynamic_cast<const VocabularyForest*>(&featureMap->objectPointDescriptorsForest());
-	ocean_assert(vocabularyForest != nullptr);
-
-	const Tracking::MapBuilding::UnifiedDescriptorMapFreakMultiLevelMultiViewDescriptor256::DescriptorMap& specializedDescriptorMap = ((Tracking::MapBuilding::UnifiedDescriptorMapFreakMultiLevelMultiViewDescriptor256&)(featureMap->descriptorMap())).descriptorMap();
-
-	const Tracking::MapBuilding::UnifiedUnguidedMatchingFreakMultiLevelDescriptor256 unifiedUnguidedMatchingA(imagePointsA.data(), freakImagePointDescriptorsA, imagePointsA.size(), featureMap->objectPoints().data(), specializedObjectPointDescriptors->descriptors(), featureMap->objectPoints().size(), featureMap->objectPointIndices().data(), *vocabularyForest);
-	const Tracking::MapBuilding::UnifiedGuidedMatchingFreakMultiLevelDescriptor256 unifiedGuidedMatchingA(imagePointsA.data(), freakImagePointDescriptorsA, imagePointsA.size(), featureMap->objectPoints().data(), featureMap->objectPoints().size(), featureMap->objectPointOctree(), featureMap->objectPointIds().data(), specializedDescriptorMap);
-
-	const Tracking::MapBuilding::UnifiedUnguidedMatchingFreakMultiLevelDescriptor256 unifiedUnguidedMatchingB(imagePointsB.data(), freakImagePointDescriptorsB, imagePointsB.size(), featureMap->objectPoints().data(), specializedObjectPointDescriptors->descriptors(), featureMap->objectPoints().size(), featureMap->objectPointIndices().data(), *vocabularyForest);
-	const Tracking::MapBuilding::UnifiedGuidedMatchingFreakMultiLevelDescriptor256 unifiedGuidedMatchingB(imagePointsB.data(), freakImagePointDescriptorsB, imagePointsB.size(), featureMap->objectPoints().data(), featureMap->objectPoints().size(), featureMap->objectPointOctree(), featureMap->objectPointIds().data(), specializedDescriptorMap);
+	ocean_assert(unifiedUnguidedMatchingA && unifiedGuidedMatchingA);
+	ocean_assert(unifiedUnguidedMatchingB && unifiedGuidedMatchingB);
 
 	Indices32 usedImagePointIndicesA;
 	Indices32 usedImagePointIndicesB;
@@ -123,11 +125,17 @@ bool RelocalizerStereo::relocalize(const AnyCamera& cameraA, const AnyCamera& ca
 	const UnifiedMatching::DistanceValue distanceThreshold(256u * 25u / 100u); // **TODO**
 
 	world_T_device.toNull();
-	if (!Tracking::MapBuilding::PoseEstimation::determinePose(cameraA, cameraB, device_T_cameraA, device_T_cameraB, unifiedUnguidedMatchingA, unifiedUnguidedMatchingB, unifiedGuidedMatchingA, unifiedGuidedMatchingB, randomGenerator_, world_T_device, minimalNumberCorrespondences, distanceThreshold, maximalProjectionError, inlierRate, usedObjectPointIdsA, usedObjectPointIdsB, &usedImagePointIndicesA, &usedImagePointIndicesB, world_T_roughDevice, worker))
+	if (!Tracking::MapBuilding::PoseEstimation::determinePose(cameraA, cameraB, device_T_cameraA, device_T_cameraB, *unifiedUnguidedMatchingA, *unifiedUnguidedMatchingB, *unifiedGuidedMatchingA, *unifiedGuidedMatchingB, randomGenerator_, world_T_device, minimalNumberCorrespondences, distanceThreshold, maximalProjectionError, inlierRate, usedObjectPointIdsA, usedObjectPointIdsB, &usedImagePointIndicesA, &usedImagePointIndicesB, world_T_roughDevice, worker))
 	{
+		featureCacheA.setAttemptFailed(true);
+		featureCacheB.setAttemptFailed(true);
+
 		return false;
 	}
 
+	featureCacheA.setAttemptFailed(false);
+	featureCacheB.setAttemptFailed(false);
+
 	if (usedFeatureCorrespondences != nullptr)
 	{
 		*usedFeatureCorrespondences = usedImagePointIndicesA.size() + usedImagePointIndicesB.size();
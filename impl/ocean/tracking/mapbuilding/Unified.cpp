@@ -35,7 +35,13 @@ bool UnifiedDescriptorExtractorFreakMultiDescriptor256::createAndAddDescriptor(c
 	DescriptorHandling::FreakMultiDescriptor256 newFreakDescriptor;
 	if (DescriptorHandling::computeFreakDescriptor(yFramePyramid, anyCamera, imagePoint, newFreakDescriptor))
 	{
-		DescriptorHandling::FreakMultiDescriptors256& existingFreakDescriptors = unifiedDescriptorMapFreak256.descriptorMap()[objectPointId];
+		UnifiedDescriptorMapFreakMultiLevelMultiViewDescriptor256::DescriptorMap& descriptorMap = unifiedDescriptorMapFreak256.descriptorMap();
+
+		const size_t previousNumberObjectPoints = descriptorMap.size();
+
+		DescriptorHandling::FreakMultiDescriptors256& existingFreakDescriptors = descriptorMap[objectPointId];
+
+		const size_t previousEntryBytes = descriptorMap.size() == previousNumberObjectPoints ? UnifiedDescriptorMapFreakMultiLevelMultiViewDescriptor256::entryBytes(existingFreakDescriptors.capacity()) : 0;
 
 		bool similarDescriptorExists = false;
 
@@ -51,6 +57,9 @@ bool UnifiedDescriptorExtractorFreakMultiDescriptor256::createAndAddDescriptor(c
 		if (!similarDescriptorExists)
 		{
 			existingFreakDescriptors.emplace_back(newFreakDescriptor);
+
+			unifiedDescriptorMapFreak256.updateTrackedMemory(previousEntryBytes, UnifiedDescriptorMapFreakMultiLevelMultiViewDescriptor256::entryBytes(existingFreakDescriptors.capacity()));
+
 			return true;
 		}
 	}
@@ -323,8 +323,8 @@ class UnifiedDescriptor
  * @tparam tNumberBytes The number of byte elements the descriptor has, with range [8, 8191]
  * @ingroup trackingmapbuilding
  */
-template <uint16_t tNumberBytes>
-class UnifiedDescriptor::DistanceTyper<UnifiedDescriptor::ByteDescriptor<tNumberBytes>>
+template <size_t tNumberBytes>
+class UnifiedDescriptor::DistanceTyper<std::array<uint8_t, tNumberBytes>>
 {
 	static_assert(tNumberBytes >= 8u, "Most likely wrong descriptor!");
 	static_assert(tNumberBytes <= 8191u, "Invalid descriptor!");
@@ -340,8 +340,8 @@ class UnifiedDescriptor::DistanceTyper<UnifiedDescriptor::ByteDescriptor<tNumber
  * @tparam tNumberElements The number of float elements the descriptor has, with range [1, infinity)
  * @ingroup trackingmapbuilding
  */
-template <uint16_t tNumberElements>
-class UnifiedDescriptor::DistanceTyper<UnifiedDescriptor::FloatDescriptor<tNumberElements>>
+template <size_t tNumberElements>
+class UnifiedDescriptor::DistanceTyper<std::array<float, tNumberElements>>
 {
 	static_assert(tNumberElements >= 1u, "Invalid number of elements!");
 
@@ -370,8 +370,8 @@ class UnifiedDescriptor::DistanceTyper<CV::Detector::FREAKDescriptor32>
  * @tparam tNumberBytes The number of byte elements the descriptor has, with range [8, 8191]
  * @ingroup trackingmapbuilding
  */
-template <uint16_t tNumberBytes>
-class UnifiedDescriptor::DescriptorTyper<UnifiedDescriptor::ByteDescriptor<tNumberBytes>>
+template <size_t tNumberBytes>
+class UnifiedDescriptor::DescriptorTyper<std::array<uint8_t, tNumberBytes>>
 {
 	static_assert(tNumberBytes >= 8u, "Most likely wrong descriptor!");
 	static_assert(tNumberBytes <= 8191u, "Invalid descriptor!");
@@ -393,8 +393,8 @@ class UnifiedDescriptor::DescriptorTyper<UnifiedDescriptor::ByteDescriptor<tNumb
  * @tparam tNumberBytes The number of byte elements the descriptor has, with range [8, 8191]
  * @ingroup trackingmapbuilding
  */
-template <uint16_t tNumberBytes>
-class UnifiedDescriptor::DescriptorTyper<UnifiedDescriptor::ByteDescriptors<tNumberBytes>>
+template <size_t tNumberBytes>
+class UnifiedDescriptor::DescriptorTyper<std::vector<std::array<uint8_t, tNumberBytes>>>
 {
 	static_assert(tNumberBytes >= 8u, "Most likely wrong descriptor!");
 	static_assert(tNumberBytes <= 8191u, "Invalid descriptor!");
@@ -416,8 +416,8 @@ class UnifiedDescriptor::DescriptorTyper<UnifiedDescriptor::ByteDescriptors<tNum
  * @tparam tNumberElements The number of float elements the descriptor has, with range [1, infinity)
  * @ingroup trackingmapbuilding
  */
-template <uint16_t tNumberElements>
-class UnifiedDescriptor::DescriptorTyper<UnifiedDescriptor::FloatDescriptor<tNumberElements>>
+template <size_t tNumberElements>
+class UnifiedDescriptor::DescriptorTyper<std::array<float, tNumberElements>>
 {
 	static_assert(tNumberElements >= 1u, "Invalid number of elements!");
 
@@ -438,8 +438,8 @@ class UnifiedDescriptor::DescriptorTyper<UnifiedDescriptor::FloatDescriptor<tNum
  * @tparam tNumberElements The number of float elements the descriptor has, with range [1, infinity)
  * @ingroup trackingmapbuilding
  */
-template <uint16_t tNumberElements>
-class UnifiedDescriptor::DescriptorTyper<UnifiedDescriptor::FloatDescriptors<tNumberElements>>
+template <size_t tNumberElements>
+class UnifiedDescriptor::DescriptorTyper<std::vector<std::array<float, tNumberElements>>>
 {
 	static_assert(tNumberElements >= 1u, "Invalid number of elements!");
 
@@ -601,8 +601,8 @@ class UnifiedDescriptorT : public UnifiedDescriptor
  * @tparam tNumberBytes The number of bytes the descriptor has, with range [8, 8191]
  * @ingroup trackingmapbuilding
  */
-template <uint16_t tNumberBytes>
-class UnifiedDescriptorT<UnifiedDescriptor::ByteDescriptor<tNumberBytes>> : public UnifiedDescriptor
+template <size_t tNumberBytes>
+class UnifiedDescriptorT<std::array<uint8_t, tNumberBytes>> : public UnifiedDescriptor
 {
 	static_assert(tNumberBytes >= 8u && tNumberBytes <= 8191u, "Most likely wrong descriptor!");
 	static_assert(tNumberBytes <= 8191u, "Invalid descriptor!");
@@ -640,14 +640,14 @@ class UnifiedDescriptorT<UnifiedDescriptor::ByteDescriptor<tNumberBytes>> : publ
 		static OCEAN_FORCE_INLINE unsigned int determineDistance(const Descriptor& descriptorA, const Descriptors& descriptorsB);
 };
 
-template <uint16_t tNumberBytes>
-OCEAN_FORCE_INLINE unsigned int UnifiedDescriptorT<typename UnifiedDescriptor::ByteDescriptor<tNumberBytes>>::determineDistance(const Descriptor& descriptorA, const Descriptor& descriptorB)
+template <size_t tNumberBytes>
+OCEAN_FORCE_INLINE unsigned int UnifiedDescriptorT<std::array<uint8_t, tNumberBytes>>::determineDistance(const Descriptor& descriptorA, const Descriptor& descriptorB)
 {
 	return CV::Detector::Descriptor::calculateHammingDistance<sizeof(Descriptor) * 8>(&descriptorA, &descriptorB);
 }
 
-template <uint16_t tNumberBytes>
-OCEAN_FORCE_INLINE unsigned int UnifiedDescriptorT<typename UnifiedDescriptor::ByteDescriptor<tNumberBytes>>::determineDistance(const Descriptor& descriptorA, const Descriptors& descriptorsB)
+template <size_t tNumberBytes>
+OCEAN_FORCE_INLINE unsigned int UnifiedDescriptorT<std::array<uint8_t, tNumberBytes>>::determineDistance(const Descriptor& descriptorA, const Descriptors& descriptorsB)
 {
 	unsigned int bestDistance = (unsigned int)(-1);
 
@@ -669,8 +669,8 @@ OCEAN_FORCE_INLINE unsigned int UnifiedDescriptorT<typename UnifiedDescriptor::B
  * @tparam tNumberElements The number of float elements the descriptor has, with range [1, infinity)
  * @ingroup trackingmapbuilding
  */
-template <uint16_t tNumberElements>
-class UnifiedDescriptorT<UnifiedDescriptor::FloatDescriptor<tNumberElements>> : public UnifiedDescriptor
+template <size_t tNumberElements>
+class UnifiedDescriptorT<std::array<float, tNumberElements>> : public UnifiedDescriptor
 {
 	static_assert(tNumberElements >= 1u, "Invalid number of elements!");
 
@@ -707,8 +707,8 @@ class UnifiedDescriptorT<UnifiedDescriptor::FloatDescriptor<tNumberElements>> :
 		static OCEAN_FORCE_INLINE float determineDistance(const Descriptor& descriptorA, const Descriptors& descriptorsB);
 };
 
-template <uint16_t tNumberElements>
-OCEAN_FORCE_INLINE float UnifiedDescriptorT<typename UnifiedDescriptor::FloatDescriptor<tNumberElements>>::determineDistance(const Descriptor& descriptorA, const Descriptor& descriptorB)
+template <size_t tNumberElements>
+OCEAN_FORCE_INLINE float UnifiedDescriptorT<std::array<float, tNumberElements>>::determineDistance(const Descriptor& descriptorA, const Descriptor& descriptorB)
 {
 	static_assert(tNumberElements >= 1u, "Invalid number of elements!");
 
@@ -724,8 +724,8 @@ OCEAN_FORCE_INLINE float UnifiedDescriptorT<typename UnifiedDescriptor::FloatDes
 	return sqrDistance;
 }
 
-template <uint16_t tNumberElements>
-OCEAN_FORCE_INLINE float UnifiedDescriptorT<typename UnifiedDescriptor::FloatDescriptor<tNumberElements>>::determineDistance(const Descriptor& descriptorA, const Descriptors& descriptorsB)
+template <size_t tNumberElements>
+OCEAN_FORCE_INLINE float UnifiedDescriptorT<std::array<float, tNumberElements>>::determineDistance(const Descriptor& descriptorA, const Descriptors& descriptorsB)
 {
 	static_assert(tNumberElements >= 1u, "Invalid number of elements!");
 
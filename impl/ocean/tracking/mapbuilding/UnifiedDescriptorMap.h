@@ -11,6 +11,9 @@
 #include "ocean/tracking/mapbuilding/MapBuilding.h"
 #include "ocean/tracking/mapbuilding/UnifiedDescriptor.h"
 
+#include "ocean/base/MemoryTracker.h"
+#include "ocean/base/Worker.h"
+
 namespace Ocean
 {
 
@@ -75,6 +78,19 @@ class UnifiedDescriptorMap : public UnifiedDescriptor
 		 */
 		virtual std::unique_ptr<UnifiedDescriptorMap> clone() const = 0;
 
+		/**
+		 * Returns the approximated number of bytes this map currently reports to the memory accounting.
+		 * @return The map's memory, in bytes
+		 * @see MemoryTracker.
+		 */
+		inline size_t trackedMemory() const;
+
+		/**
+		 * Returns the id of the memory category to which the memory of all descriptor maps is reported.
+		 * @return The id of the category
+		 */
+		static inline MemoryTracker::CategoryId memoryCategoryId();
+
 	protected:
 
 		/**
@@ -82,6 +98,11 @@ class UnifiedDescriptorMap : public UnifiedDescriptor
 		 * @param descriptorType The type of the descriptors
 		 */
 		explicit inline UnifiedDescriptorMap(const DescriptorType descriptorType);
+
+	protected:
+
+		/// The accounting of the map's memory.
+		MemoryTracker::TrackedBytes trackedMemory_ = MemoryTracker::TrackedBytes(memoryCategoryId());
 };
 
 /**
@@ -104,6 +125,11 @@ class UnifiedDescriptorMapT : public UnifiedDescriptorMap
 		 */
 		using DescriptorMap = std::unordered_map<Index32, Descriptor>;
 
+		/**
+		 * Definition of the single-view descriptors of a multi-view descriptor.
+		 */
+		using SingleDescriptor = typename Descriptor::value_type;
+
 	public:
 
 		/**
@@ -159,6 +185,65 @@ class UnifiedDescriptorMapT : public UnifiedDescriptorMap
 		 */
 		inline DescriptorMap& descriptorMap();
 
+		/**
+		 * Updates the memory accounting after the descriptors of one object point have been modified via descriptorMap().
+		 * @param previousEntryBytes The number of bytes of the object point's entry before the modification, 0 if the entry did not exist
+		 * @param newEntryBytes The number of bytes of the object point's entry after the modification, 0 if the entry has been removed
+		 * @see entryBytes(), updateTrackedMemory().
+		 */
+		inline void updateTrackedMemory(const size_t previousEntryBytes, const size_t newEntryBytes);
+
+		/**
+		 * Determines the memory of the entire map and updates the memory accounting.
+		 * The function needs to visit all entries, it should be called after bulk modifications via descriptorMap() only.
+		 */
+		void updateTrackedMemory();
+
+		/**
+		 * Compacts the map by reducing the descriptors of each object point to a few representative descriptors.
+		 * The descriptors of an object point (e.g., descriptors from several views) are clustered and each cluster is represented by its medoid, the descriptor with minimal distance to all other descriptors of the cluster.<br>
+		 * The medoids are selected greedily, starting with the medoid of all descriptors, followed by the descriptor reducing the summed distance of all descriptors to their closest medoid the most.<br>
+		 * Object points with at most 'maximalDescriptorsPerObjectPoint' descriptors keep their descriptors, the memory of all entries is trimmed.
+		 * @param maximalDescriptorsPerObjectPoint The maximal number of descriptors each object point keeps, with range [1, infinity)
+		 * @param worker Optional worker to distribute the computation
+		 * @return The number of descriptors which have been removed
+		 */
+		size_t compact(const size_t maximalDescriptorsPerObjectPoint, Worker* worker = nullptr);
+
+		/**
+		 * Returns the approximated number of bytes of one entry in the map.
+		 * @param descriptorCapacity The capacity of the entry's descriptors, with range [0, infinity)
+		 * @return The entry's memory, in bytes
+		 */
+		static constexpr size_t entryBytes(const size_t descriptorCapacity);
+
+	protected:
+
+		/**
+		 * Compacts the descriptors of a subset of object points.
+		 * @param descriptors The descriptors of all object points to be compacted, must be valid
+		 * @param maximalDescriptorsPerObjectPoint The maximal number of descriptors each object point keeps, with range [1, infinity)
+		 * @param removedDescriptors The resulting number of descriptors which have been removed, one for each object point
+		 * @param firstObjectPoint The first object point to be handled
+		 * @param numberObjectPoints The number of object points to be handled
+		 */
+		static void compactSubset(Descriptor** descriptors, const size_t maximalDescriptorsPerObjectPoint, size_t* removedDescriptors, const unsigned int firstObjectPoint, const unsigned int numberObjectPoints);
+
+		/**
+		 * Determines the distance between two single-view descriptors of an object point.
+		 * @param descriptorA The first descriptor
+		 * @param descriptorB The second descriptor
+		 * @return The distance between both descriptors, Hamming distance for FREAK descriptors, square distance for float descriptors
+		 */
+		static double determineDistance(const SingleDescriptor& descriptorA, const SingleDescriptor& descriptorB);
+
+		/**
+		 * Replaces the descriptors of one object point by their medoids.
+		 * @param descriptors The descriptors of the object point, at least 'maximalDescriptors + 1' descriptors
+		 * @param maximalDescriptors The number of medoids to keep, with range [1, descriptors.size())
+		 */
+		static void determineMedoids(Descriptor& descriptors, const size_t maximalDescriptors);
+
 	protected:
 
 		/// The internal descriptor map.
@@ -185,6 +270,18 @@ inline UnifiedDescriptorMap::UnifiedDescriptorMap(const DescriptorType descripto
 	// nothing to do here
 }
 
+inline size_t UnifiedDescriptorMap::trackedMemory() const
+{
+	return trackedMemory_.bytes();
+}
+
+inline MemoryTracker::CategoryId UnifiedDescriptorMap::memoryCategoryId()
+{
+	static const MemoryTracker::CategoryId categoryId = MemoryTracker::registerCategory("UnifiedDescriptorMap");
+
+	return categoryId;
+}
+
 template <typename TDescriptor>
 inline UnifiedDescriptorMapT<TDescriptor>::UnifiedDescriptorMapT() :
 	UnifiedDescriptorMap(DescriptorTyper<TDescriptor>::type())
@@ -198,6 +295,8 @@ inline UnifiedDescriptorMapT<TDescriptor>::UnifiedDescriptorMapT(DescriptorMap&&
 	descriptorMap_(std::move(descriptorMap))
 {
 	ocean_assert(descriptorType() != DescriptorType::DT_INVALID);
+
+	updateTrackedMemory();
 }
 
 template <typename TDescriptor>
@@ -212,6 +311,205 @@ inline typename UnifiedDescriptorMapT<TDescriptor>::DescriptorMap& UnifiedDescri
 	return descriptorMap_;
 }
 
+template <typename TDescriptor>
+inline void UnifiedDescriptorMapT<TDescriptor>::updateTrackedMemory(const size_t previousEntryBytes, const size_t newEntryBytes)
+{
+	ocean_assert(trackedMemory_.bytes() >= previousEntryBytes);
+
+	trackedMemory_.setBytes(trackedMemory_.bytes() - std::min(trackedMemory_.bytes(), previousEntryBytes) + newEntryBytes);
+}
+
+template <typename TDescriptor>
+void UnifiedDescriptorMapT<TDescriptor>::updateTrackedMemory()
+{
+	size_t bytes = descriptorMap_.bucket_count() * sizeof(void*);
+
+	for (const typename DescriptorMap::value_type& descriptorPair : descriptorMap_)
+	{
+		bytes += entryBytes(descriptorPair.second.capacity());
+	}
+
+	trackedMemory_.setBytes(bytes);
+}
+
+template <typename TDescriptor>
+size_t UnifiedDescriptorMapT<TDescriptor>::compact(const size_t maximalDescriptorsPerObjectPoint, Worker* worker)
+{
+	ocean_assert(maximalDescriptorsPerObjectPoint >= 1);
+
+	if (maximalDescriptorsPerObjectPoint == 0)
+	{
+		return 0;
+	}
+
+	std::vector<Descriptor*> descriptors;
+	descriptors.reserve(descriptorMap_.size());
+
+	for (typename DescriptorMap::value_type& descriptorPair : descriptorMap_)
+	{
+		descriptors.push_back(&descriptorPair.second);
+	}
+
+	std::vector<size_t> removedDescriptors(descriptors.size(), 0);
+
+	if (worker && descriptors.size() >= 1000)
+	{
+		worker->executeFunction(Worker::Function::createStatic(&UnifiedDescriptorMapT<TDescriptor>::compactSubset, descriptors.data(), maximalDescriptorsPerObjectPoint, removedDescriptors.data(), 0u, 0u), 0u, (unsigned int)(descriptors.size()), 100u);
+	}
+	else
+	{
+		compactSubset(descriptors.data(), maximalDescriptorsPerObjectPoint, removedDescriptors.data(), 0u, (unsigned int)(descriptors.size()));
+	}
+
+	updateTrackedMemory();
+
+	size_t numberRemovedDescriptors = 0;
+
+	for (const size_t removed : removedDescriptors)
+	{
+		numberRemovedDescriptors += removed;
+	}
+
+	return numberRemovedDescriptors;
+}
+
+template <typename TDescriptor>
+void UnifiedDescriptorMapT<TDescriptor>::compactSubset(Descriptor** descriptors, const size_t maximalDescriptorsPerObjectPoint, size_t* removedDescriptors, const unsigned int firstObjectPoint, const unsigned int numberObjectPoints)
+{
+	ocean_assert(descriptors != nullptr && removedDescriptors != nullptr);
+	ocean_assert(maximalDescriptorsPerObjectPoint >= 1);
+
+	for (unsigned int n = firstObjectPoint; n < firstObjectPoint + numberObjectPoints; ++n)
+	{
+		Descriptor& objectPointDescriptors = *descriptors[n];
+
+		const size_t previousDescriptors = objectPointDescriptors.size();
+
+		if (previousDescriptors > maximalDescriptorsPerObjectPoint)
+		{
+			determineMedoids(objectPointDescriptors, maximalDescriptorsPerObjectPoint);
+		}
+
+		objectPointDescriptors.shrink_to_fit();
+
+		removedDescriptors[n] = previousDescriptors - objectPointDescriptors.size();
+	}
+}
+
+template <typename TDescriptor>
+double UnifiedDescriptorMapT<TDescriptor>::determineDistance(const SingleDescriptor& descriptorA, const SingleDescriptor& descriptorB)
+{
+	if constexpr (std::is_same<SingleDescriptor, FreakMultiDescriptor256>::value)
+	{
+		return double(UnifiedDescriptorT<FreakMultiDescriptor256>::determineDistance(descriptorA, descriptorB));
+	}
+	else
+	{
+		static_assert(std::is_same<typename SingleDescriptor::value_type, float>::value, "Invalid descriptor!");
+
+		// square distance, as used for float descriptors
+
+		float sqrDistance = 0.0f;
+
+		for (size_t n = 0; n < descriptorA.size(); ++n)
+		{
+			sqrDistance += NumericF::sqr(descriptorA[n] - descriptorB[n]);
+		}
+
+		return double(sqrDistance);
+	}
+}
+
+template <typename TDescriptor>
+void UnifiedDescriptorMapT<TDescriptor>::determineMedoids(Descriptor& descriptors, const size_t maximalDescriptors)
+{
+	ocean_assert(maximalDescriptors >= 1 && maximalDescriptors < descriptors.size());
+
+	const size_t size = descriptors.size();
+
+	// the pairwise distances between all descriptors of the object point
+
+	std::vector<double> distances(size * size, 0.0);
+
+	for (size_t a = 0; a < size; ++a)
+	{
+		for (size_t b = a + 1; b < size; ++b)
+		{
+			const double distance = determineDistance(descriptors[a], descriptors[b]);
+
+			distances[a * size + b] = distance;
+			distances[b * size + a] = distance;
+		}
+	}
+
+	// the distance of each descriptor to the closest medoid, in the beginning no medoid exists
+
+	std::vector<double> closestDistances(size, NumericD::maxValue());
+	std::vector<uint8_t> isMedoid(size, 0u);
+
+	Indices32 medoidIndices;
+	medoidIndices.reserve(maximalDescriptors);
+
+	while (medoidIndices.size() < maximalDescriptors)
+	{
+		double bestCost = NumericD::maxValue();
+		Index32 bestIndex = Index32(-1);
+
+		for (size_t candidate = 0; candidate < size; ++candidate)
+		{
+			if (isMedoid[candidate] != 0u)
+			{
+				continue;
+			}
+
+			const double* candidateDistances = distances.data() + candidate * size;
+
+			double cost = 0.0;
+
+			for (size_t n = 0; n < size; ++n)
+			{
+				cost += std::min(closestDistances[n], candidateDistances[n]);
+			}
+
+			if (cost < bestCost)
+			{
+				bestCost = cost;
+				bestIndex = Index32(candidate);
+			}
+		}
+
+		ocean_assert(bestIndex < size);
+
+		isMedoid[bestIndex] = 1u;
+		medoidIndices.push_back(bestIndex);
+
+		const double* medoidDistances = distances.data() + bestIndex * size;
+
+		for (size_t n = 0; n < size; ++n)
+		{
+			closestDistances[n] = std::min(closestDistances[n], medoidDistances[n]);
+		}
+	}
+
+	Descriptor medoids;
+	medoids.reserve(medoidIndices.size());
+
+	for (const Index32 medoidIndex : medoidIndices)
+	{
+		medoids.push_back(descriptors[medoidIndex]);
+	}
+
+	descriptors = std::move(medoids);
+}
+
+template <typename TDescriptor>
+constexpr size_t UnifiedDescriptorMapT<TDescriptor>::entryBytes(const size_t descriptorCapacity)
+{
+	// the node of the map stores the pair and a pointer to the next node, the descriptors are stored in a separate block
+
+	return sizeof(typename DescriptorMap::value_type) + sizeof(void*) + descriptorCapacity * sizeof(typename TDescriptor::value_type);
+}
+
 template <typename TDescriptor>
 size_t UnifiedDescriptorMapT<TDescriptor>::numberObjectPoints() const
 {
@@ -255,6 +553,8 @@ bool UnifiedDescriptorMapT<TDescriptor>::removeDescriptors(const Index32& object
 		return false;
 	}
 
+	updateTrackedMemory(entryBytes(i->second.capacity()), 0);
+
 	descriptorMap_.erase(i);
 
 	return true;
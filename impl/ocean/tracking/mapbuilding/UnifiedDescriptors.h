@@ -87,6 +87,14 @@ class UnifiedDescriptorsT final : public UnifiedDescriptors
 		 */
 		explicit UnifiedDescriptorsT(std::vector<TDescriptor>&& descriptors);
 
+		/**
+		 * Creates a new object using external descriptors, e.g., descriptors stored in a memory-mapped file.
+		 * This object will not be the owner of the descriptors, the descriptors need to exist as long as this object exists.
+		 * @param useDescriptors The external descriptors to be used, must be valid
+		 * @param numberDescriptors The number of external descriptors, with range [1, infinity)
+		 */
+		UnifiedDescriptorsT(const TDescriptor* useDescriptors, const size_t numberDescriptors);
+
 		/**
 		 * Returns the pointer to the memory holding all descriptors of this object.
 		 * @return The memory with all descriptors if 'isValid() == true'
@@ -107,8 +115,14 @@ class UnifiedDescriptorsT final : public UnifiedDescriptors
 
 	protected:
 
-		/// The object's descriptors.
+		/// The object's descriptors, empty if the object uses external descriptors.
 		std::vector<TDescriptor> descriptors_;
+
+		/// The external descriptors, nullptr if the object owns the descriptors.
+		const TDescriptor* useDescriptors_ = nullptr;
+
+		/// The number of external descriptors.
+		size_t numberUseDescriptors_ = 0;
 };
 
 using UnifiedDescriptorsFreakMultiLevelSingleViewDescriptor256 = UnifiedDescriptorsT<DescriptorHandling::FreakMultiDescriptor256>;
@@ -145,22 +159,42 @@ UnifiedDescriptorsT<TDescriptor>::UnifiedDescriptorsT(std::vector<TDescriptor>&&
 	ocean_assert(descriptorType() != DescriptorType::DT_INVALID);
 }
 
+template <typename TDescriptor>
+UnifiedDescriptorsT<TDescriptor>::UnifiedDescriptorsT(const TDescriptor* useDescriptors, const size_t numberDescriptors) :
+	UnifiedDescriptors(DescriptorTyper<TDescriptor>::type()),
+	useDescriptors_(useDescriptors),
+	numberUseDescriptors_(useDescriptors != nullptr ? numberDescriptors : 0)
+{
+	ocean_assert(descriptorType() != DescriptorType::DT_INVALID);
+	ocean_assert(useDescriptors != nullptr && numberDescriptors != 0);
+}
+
 template <typename TDescriptor>
 inline const TDescriptor* UnifiedDescriptorsT<TDescriptor>::descriptors() const
 {
+	if (useDescriptors_ != nullptr)
+	{
+		return useDescriptors_;
+	}
+
 	return descriptors_.data();
 }
 
 template <typename TDescriptor>
 size_t UnifiedDescriptorsT<TDescriptor>::numberDescriptors() const
 {
+	if (useDescriptors_ != nullptr)
+	{
+		return numberUseDescriptors_;
+	}
+
 	return descriptors_.size();
 }
 
 template <typename TDescriptor>
 bool UnifiedDescriptorsT<TDescriptor>::isValid() const
 {
-	return !descriptors_.empty();
+	return numberDescriptors() != 0;
 }
 
 }
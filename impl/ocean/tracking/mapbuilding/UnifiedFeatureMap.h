@@ -43,6 +43,19 @@ using SharedUnifiedFeatureMap = std::shared_ptr<UnifiedFeatureMap>;
  */
 class OCEAN_TRACKING_MAPBUILDING_EXPORT UnifiedFeatureMap
 {
+	public:
+
+		/**
+		 * Definition of individual vocabulary structures which can be used for unguided matching.
+		 */
+		enum VocabularyStructureType : uint32_t
+		{
+			/// A vocabulary forest with several vocabulary trees.
+			VST_FOREST = 0u,
+			/// A multi-probe locality-sensitive hash, binary descriptors only, better suited for large maps.
+			VST_HASH
+		};
+
 	public:
 
 		/**
@@ -85,6 +98,20 @@ class OCEAN_TRACKING_MAPBUILDING_EXPORT UnifiedFeatureMap
 		 */
 		virtual const Tracking::VocabularyStructure& objectPointDescriptorsForest() const = 0;
 
+		/**
+		 * Returns the vocabulary structure holding the descriptors of the object points of the map, either the forest or the hash.
+		 * This function is not thread-safe.
+		 * @return The map's vocabulary structure used for unguided matching
+		 * @see vocabularyStructureType().
+		 */
+		virtual const Tracking::VocabularyStructure& objectPointVocabularyStructure() const = 0;
+
+		/**
+		 * Returns the type of the vocabulary structure which is used for unguided matching.
+		 * @return The vocabulary structure type
+		 */
+		inline VocabularyStructureType vocabularyStructureType() const;
+
 		/**
 		 * Returns the octree holding the object points of the map.
 		 * This function is not thread-safe.
@@ -151,6 +178,9 @@ class OCEAN_TRACKING_MAPBUILDING_EXPORT UnifiedFeatureMap
 		/// The map mapping object point ids to their associated descriptors.
 		SharedUnifiedDescriptorMap descriptorMap_;
 
+		/// The type of the vocabulary structure which is used for unguided matching.
+		VocabularyStructureType vocabularyStructureType_ = VST_FOREST;
+
 		/// The feature map's lock.
 		mutable Lock lock_;
 };
@@ -174,6 +204,11 @@ class UnifiedFeatureMapT : public UnifiedFeatureMap
 		 */
 		using VocabularyForest = Tracking::VocabularyForest<TObjectPointVocabularyDescriptor, TDescriptorDistance, tVocabularyDistanceFunction>;
 
+		/**
+		 * Definition of a vocabulary hash which can be used for unguided pose estimation instead of the forest.
+		 */
+		using VocabularyHash = Tracking::VocabularyHash<TObjectPointVocabularyDescriptor, TDescriptorDistance, tVocabularyDistanceFunction>;
+
 		/**
 		 * Definition of a vector holding vocabulary descriptors.
 		 */
@@ -200,8 +235,10 @@ class UnifiedFeatureMapT : public UnifiedFeatureMap
 		 * @param randomGenerator The random generator to be used
 		 * @param clustersMeanFunction The function allowing to determine the mean descriptors for individual clusters, must be valid
 		 * @param extractVocabularyDescriptorsFromMapFunction The function allowing to extract the 3D object point descriptors from the feature map and creating serialized descriptors which can be processed in the vocabulary tree, must be valid
+		 * @param vocabularyStructureType The type of the vocabulary structure to be used for unguided matching, VST_HASH is supported for binary descriptors only
+		 * @param hashParameters The parameters of the vocabulary hash, defining the balance between recall and latency, used for VST_HASH only
 		 */
-		UnifiedFeatureMapT(Vectors3&& objectPoints, Indices32&& objectPointIds, SharedUnifiedDescriptorMap&& descriptorMap, RandomGenerator& randomGenerator, typename VocabularyForest::ClustersMeanFunction clustersMeanFunction, ExtractVocabularyDescriptorsFromMapFunction extractVocabularyDescriptorsFromMapFunction);
+		UnifiedFeatureMapT(Vectors3&& objectPoints, Indices32&& objectPointIds, SharedUnifiedDescriptorMap&& descriptorMap, RandomGenerator& randomGenerator, typename VocabularyForest::ClustersMeanFunction clustersMeanFunction, ExtractVocabularyDescriptorsFromMapFunction extractVocabularyDescriptorsFromMapFunction, const VocabularyStructureType vocabularyStructureType = VST_FOREST, const typename VocabularyHash::HashParameters& hashParameters = typename VocabularyHash::HashParameters());
 
 		/**
 		 * Returns the descriptors of the object points used in the vocabulary tree.
@@ -216,6 +253,12 @@ class UnifiedFeatureMapT : public UnifiedFeatureMap
 		 */
 		const VocabularyForest& objectPointDescriptorsForest() const override;
 
+		/**
+		 * Returns the vocabulary structure holding the descriptors of the object points of the map.
+		 * @see UnifiedFeatureMap::objectPointVocabularyStructure().
+		 */
+		const VocabularyStructure& objectPointVocabularyStructure() const override;
+
 		/**
 		 * Sets or updates the feature map to be used for relocalization.
 		 * @see UnifiedFeatureMap::updateFeatureMap().
@@ -236,8 +279,14 @@ class UnifiedFeatureMapT : public UnifiedFeatureMap
 		/// The function allowing to extract the 3D object point descriptors from the feature map and creating serialized descriptors which can be processed in the vocabulary tree.
 		ExtractVocabularyDescriptorsFromMapFunction extractVocabularyDescriptorsFromMapFunction_;
 
-		/// The vocabulary forest holding the descriptors of the object points of the map.
+		/// The vocabulary forest holding the descriptors of the object points of the map, empty if the hash is used.
 		VocabularyForest objectPointDescriptorsForest_;
+
+		/// The parameters of the vocabulary hash.
+		typename VocabularyHash::HashParameters hashParameters_;
+
+		/// The vocabulary hash holding the descriptors of the object points of the map, empty if the forest is used.
+		VocabularyHash objectPointDescriptorsHash_;
 };
 
 inline const Vectors3& UnifiedFeatureMap::objectPoints() const
@@ -272,6 +321,11 @@ inline const Tracking::MapBuilding::UnifiedDescriptorMap& UnifiedFeatureMap::des
 	return *descriptorMap_;
 }
 
+inline UnifiedFeatureMap::VocabularyStructureType UnifiedFeatureMap::vocabularyStructureType() const
+{
+	return vocabularyStructureType_;
+}
+
 inline bool UnifiedFeatureMap::isValid() const
 {
 	const ScopedLock scopedLock(lock_);
@@ -280,12 +334,25 @@ inline bool UnifiedFeatureMap::isValid() const
 }
 
 template <typename TImagePointDescriptor, typename TObjectPointDescriptor, typename TObjectPointVocabularyDescriptor, typename TDescriptorDistance, TDescriptorDistance(*tVocabularyDistanceFunction)(const TObjectPointVocabularyDescriptor&, const TObjectPointVocabularyDescriptor&)>
-UnifiedFeatureMapT<TImagePointDescriptor, TObjectPointDescriptor, TObjectPointVocabularyDescriptor, TDescriptorDistance, tVocabularyDistanceFunction>::UnifiedFeatureMapT(Vectors3&& objectPoints, Indices32&& objectPointIds, SharedUnifiedDescriptorMap&& descriptorMap, RandomGenerator& randomGenerator, typename VocabularyForest::ClustersMeanFunction clustersMeanFunction, ExtractVocabularyDescriptorsFromMapFunction extractVocabularyDescriptorsFromMapFunction) :
+UnifiedFeatureMapT<TImagePointDescriptor, TObjectPointDescriptor, TObjectPointVocabularyDescriptor, TDescriptorDistance, tVocabularyDistanceFunction>::UnifiedFeatureMapT(Vectors3&& objectPoints, Indices32&& objectPointIds, SharedUnifiedDescriptorMap&& descriptorMap, RandomGenerator& randomGenerator, typename VocabularyForest::ClustersMeanFunction clustersMeanFunction, ExtractVocabularyDescriptorsFromMapFunction extractVocabularyDescriptorsFromMapFunction, const VocabularyStructureType vocabularyStructureType, const typename VocabularyHash::HashParameters& hashParameters) :
 	clustersMeanFunction_(std::move(clustersMeanFunction)),
-	extractVocabularyDescriptorsFromMapFunction_(std::move(extractVocabularyDescriptorsFromMapFunction))
+	extractVocabularyDescriptorsFromMapFunction_(std::move(extractVocabularyDescriptorsFromMapFunction)),
+	hashParameters_(hashParameters)
 {
 	ocean_assert(clustersMeanFunction_);
 	ocean_assert(extractVocabularyDescriptorsFromMapFunction_);
+	ocean_assert(hashParameters_.isValid());
+
+	// the hash sub-samples descriptor bits, float descriptors always use the forest
+
+	if constexpr (std::is_integral<TDescriptorDistance>::value)
+	{
+		vocabularyStructureType_ = vocabularyStructureType;
+	}
+	else
+	{
+		ocean_assert(vocabularyStructureType == VST_FOREST && "The vocabulary hash supports binary descriptors only");
+	}
 
 	const bool result = updateFeatureMap(std::move(objectPoints), std::move(objectPointIds), std::move(descriptorMap), randomGenerator);
 	ocean_assert_and_suppress_unused(result, result);
@@ -322,6 +389,17 @@ inline const typename UnifiedFeatureMapT<TImagePointDescriptor, TObjectPointDesc
 	return objectPointDescriptorsForest_;
 }
 
+template <typename TImagePointDescriptor, typename TObjectPointDescriptor, typename TObjectPointVocabularyDescriptor, typename TDescriptorDistance, TDescriptorDistance(*tVocabularyDistanceFunction)(const TObjectPointVocabularyDescriptor&, const TObjectPointVocabularyDescriptor&)>
+const VocabularyStructure& UnifiedFeatureMapT<TImagePointDescriptor, TObjectPointDescriptor, TObjectPointVocabularyDescriptor, TDescriptorDistance, tVocabularyDistanceFunction>::objectPointVocabularyStructure() const
+{
+	if (vocabularyStructureType_ == VST_HASH)
+	{
+		return objectPointDescriptorsHash_;
+	}
+
+	return objectPointDescriptorsForest_;
+}
+
 template <typename TImagePointDescriptor, typename TObjectPointDescriptor, typename TObjectPointVocabularyDescriptor, typename TDescriptorDistance, TDescriptorDistance(*tVocabularyDistanceFunction)(const TObjectPointVocabularyDescriptor&, const TObjectPointVocabularyDescriptor&)>
 bool UnifiedFeatureMapT<TImagePointDescriptor, TObjectPointDescriptor, TObjectPointVocabularyDescriptor, TDescriptorDistance, tVocabularyDistanceFunction>::updateFeatureMap(Vectors3&& objectPoints, Indices32&& objectPointIds, SharedUnifiedDescriptorMap&& descriptorMap, RandomGenerator& randomGenerator)
 {
@@ -365,9 +443,23 @@ bool UnifiedFeatureMapT<TImagePointDescriptor, TObjectPointDescriptor, TObjectPo
 
 	const UnifiedDescriptorsVocabulary& unifiedDescriptorsVocabulary = dynamic_cast<const UnifiedDescriptorsVocabulary&>(*objectPointVocabularyDescriptors_);
 
-	const typename VocabularyForest::Parameters parameters;
+	objectPointDescriptorsForest_ = VocabularyForest();
+	objectPointDescriptorsHash_ = VocabularyHash();
+
+	if constexpr (std::is_integral<TDescriptorDistance>::value)
+	{
+		if (vocabularyStructureType_ == VST_HASH)
+		{
+			objectPointDescriptorsHash_ = VocabularyHash(unifiedDescriptorsVocabulary.descriptors(), unifiedDescriptorsVocabulary.numberDescriptors(), hashParameters_, WorkerPool::get().scopedWorker()(), &randomGenerator);
+		}
+	}
+
+	if (vocabularyStructureType_ == VST_FOREST)
+	{
+		const typename VocabularyForest::Parameters parameters;
 
-	objectPointDescriptorsForest_ = VocabularyForest(2, unifiedDescriptorsVocabulary.descriptors(), unifiedDescriptorsVocabulary.numberDescriptors(), clustersMeanFunction_, parameters, WorkerPool::get().scopedWorker()(), &randomGenerator);
+		objectPointDescriptorsForest_ = VocabularyForest(2, unifiedDescriptorsVocabulary.descriptors(), unifiedDescriptorsVocabulary.numberDescriptors(), clustersMeanFunction_, parameters, WorkerPool::get().scopedWorker()(), &randomGenerator);
+	}
 
 	objectPointOctree_ = Geometry::Octree(objectPoints_.data(), objectPoints_.size(), Geometry::Octree::Parameters(40u, true));
 
@@ -399,12 +491,12 @@ bool UnifiedFeatureMapT<TImagePointDescriptor, TObjectPointDescriptor, TObjectPo
 			return false;
 		}
 
-		unifiedUnguidedMatching = std::make_shared<UnifiedUnguidedMatching>(imagePoints, specializedImagePointDescriptors->descriptors(), specializedImagePointDescriptors->numberDescriptors(), objectPoints_.data(), objectPointVocabularyDescriptors(), objectPoints_.size(), objectPointIndices_.data(), objectPointDescriptorsForest());
+		unifiedUnguidedMatching = std::make_shared<UnifiedUnguidedMatching>(imagePoints, specializedImagePointDescriptors->descriptors(), specializedImagePointDescriptors->numberDescriptors(), objectPoints_.data(), objectPointVocabularyDescriptors(), objectPoints_.size(), objectPointIndices_.data(), objectPointVocabularyStructure());
 		unifiedGuidedMatching = std::make_shared<UnifiedGuidedMatching>(imagePoints, specializedImagePointDescriptors->descriptors(), specializedImagePointDescriptors->numberDescriptors(), objectPoints_.data(), objectPoints_.size(), objectPointOctree_, objectPointIds_.data(), specializedDescriptorMap->descriptorMap());
 	}
 	else
 	{
-		unifiedUnguidedMatching = std::make_shared<UnifiedUnguidedMatching>(objectPoints_.data(), objectPointVocabularyDescriptors(), objectPoints_.size(), objectPointIndices_.data(), objectPointDescriptorsForest());
+		unifiedUnguidedMatching = std::make_shared<UnifiedUnguidedMatching>(objectPoints_.data(), objectPointVocabularyDescriptors(), objectPoints_.size(), objectPointIndices_.data(), objectPointVocabularyStructure());
 		unifiedGuidedMatching = std::make_shared<UnifiedGuidedMatching>(objectPoints_.data(), objectPoints_.size(), objectPointOctree_, objectPointIds_.data(), specializedDescriptorMap->descriptorMap());
 	}
 
@@ -26,6 +26,7 @@
 
 #include "ocean/tracking/Database.h"
 #include "ocean/tracking/PoseEstimationT.h"
+#include "ocean/tracking/VocabularyHash.h"
 #include "ocean/tracking/VocabularyTree.h"
 
 namespace Ocean
@@ -397,6 +398,9 @@ class UnifiedUnguidedMatchingT : public UnifiedUnguidedMatching
 		/// Definition of a vocabulary tree for object point descriptors.
 		using VocabularyTree = typename VocabularyForest::TVocabularyTree;
 
+		/// Definition of a vocabulary hash for object point descriptors.
+		using VocabularyHash = Tracking::VocabularyHash<ObjectPointVocabularyDescriptor, DescriptorDistance, UnifiedDescriptorT<ObjectPointVocabularyDescriptor>::determineDistance>;
+
 	public:
 
 		/**
@@ -406,9 +410,9 @@ class UnifiedUnguidedMatchingT : public UnifiedUnguidedMatching
 		 * @param objectPointVocabularyDescriptors The descriptors for the object points, one for each index in 'objectPointIndices'
 		 * @param numberObjectPoints The number of 3D object points, with range [0, infinity)
 		 * @param objectPointIndices The indices of the corresponding 3D object points, one for each object point descriptor, mainly a map mapping descriptor indices to point indices
-		 * @param forestObjectPointDescriptors The vocabulary forest for the object point features
+		 * @param vocabularyStructure The vocabulary structure for the object point features, either a VocabularyForest or a VocabularyHash object
 		 */
-		inline UnifiedUnguidedMatchingT(const Vector3* objectPoints, const ObjectPointVocabularyDescriptor* objectPointVocabularyDescriptors, const size_t numberObjectPoints, const Index32* objectPointIndices, const VocabularyForest& forestObjectPointDescriptors);
+		inline UnifiedUnguidedMatchingT(const Vector3* objectPoints, const ObjectPointVocabularyDescriptor* objectPointVocabularyDescriptors, const size_t numberObjectPoints, const Index32* objectPointIndices, const VocabularyStructure& vocabularyStructure);
 
 		/**
 		 * Creates a new matching object with 2D image points and 3D object points only.
@@ -420,9 +424,9 @@ class UnifiedUnguidedMatchingT : public UnifiedUnguidedMatching
 		 * @param objectPointVocabularyDescriptors The descriptors for the object points, one for each index in 'objectPointIndices'
 		 * @param numberObjectPoints The number of 3D object points, with range [0, infinity)
 		 * @param objectPointIndices The indices of the corresponding 3D object points, one for each object point descriptor, mainly a map mapping descriptor indices to point indices, must be valid
-		 * @param forestObjectPointDescriptors The vocabulary forest for the object point features
+		 * @param vocabularyStructure The vocabulary structure for the object point features, either a VocabularyForest or a VocabularyHash object
 		 */
-		inline UnifiedUnguidedMatchingT(const Vector2* imagePoints, const ImagePointDescriptor* imagePointDescriptors, const size_t numberImagePoints, const Vector3* objectPoints, const ObjectPointVocabularyDescriptor* objectPointVocabularyDescriptors, const size_t numberObjectPoints, const Index32* objectPointIndices, const VocabularyForest& forestObjectPointDescriptors);
+		inline UnifiedUnguidedMatchingT(const Vector2* imagePoints, const ImagePointDescriptor* imagePointDescriptors, const size_t numberImagePoints, const Vector3* objectPoints, const ObjectPointVocabularyDescriptor* objectPointVocabularyDescriptors, const size_t numberObjectPoints, const Index32* objectPointIndices, const VocabularyStructure& vocabularyStructure);
 
 		/**
 		 * Updates the 2D image points e.g., to allow matching for a new camera frame.
@@ -452,8 +456,8 @@ class UnifiedUnguidedMatchingT : public UnifiedUnguidedMatching
 		/// The descriptors for the object points, one for each index in 'objectPointIndices'.
 		const ObjectPointVocabularyDescriptor* objectPointVocabularyDescriptors_;
 
-		/// The vocabulary forest for the object point features.
-		const VocabularyForest& forestObjectPointDescriptors_;
+		/// The vocabulary structure for the object point features, either a VocabularyForest or a VocabularyHash object.
+		const VocabularyStructure& vocabularyStructure_;
 };
 
 /**
@@ -778,20 +782,20 @@ void UnifiedGuidedMatchingT<TImagePointDescriptor, TObjectPointDescriptor, TDist
 }
 
 template <typename TImagePointDescriptor, typename TObjectPointVocabularyDescriptor, typename TDistance>
-inline UnifiedUnguidedMatchingT<TImagePointDescriptor, TObjectPointVocabularyDescriptor, TDistance>::UnifiedUnguidedMatchingT(const Vector3* objectPoints, const ObjectPointVocabularyDescriptor* objectPointVocabularyDescriptors, const size_t numberObjectPoints, const Index32* objectPointIndices, const VocabularyForest& forestObjectPointDescriptors) :
+inline UnifiedUnguidedMatchingT<TImagePointDescriptor, TObjectPointVocabularyDescriptor, TDistance>::UnifiedUnguidedMatchingT(const Vector3* objectPoints, const ObjectPointVocabularyDescriptor* objectPointVocabularyDescriptors, const size_t numberObjectPoints, const Index32* objectPointIndices, const VocabularyStructure& vocabularyStructure) :
 	UnifiedUnguidedMatching(objectPoints, numberObjectPoints, objectPointIndices),
 	objectPointVocabularyDescriptors_(objectPointVocabularyDescriptors),
-	forestObjectPointDescriptors_(forestObjectPointDescriptors)
+	vocabularyStructure_(vocabularyStructure)
 {
 	// nothing to do here
 }
 
 template <typename TImagePointDescriptor, typename TObjectPointVocabularyDescriptor, typename TDistance>
-inline UnifiedUnguidedMatchingT<TImagePointDescriptor, TObjectPointVocabularyDescriptor, TDistance>::UnifiedUnguidedMatchingT(const Vector2* imagePoints, const ImagePointDescriptor* imagePointDescriptors, const size_t numberImagePoints, const Vector3* objectPoints, const ObjectPointVocabularyDescriptor* objectPointVocabularyDescriptors, const size_t numberObjectPoints, const Index32* objectPointIndices, const VocabularyForest& forestObjectPointDescriptors) :
+inline UnifiedUnguidedMatchingT<TImagePointDescriptor, TObjectPointVocabularyDescriptor, TDistance>::UnifiedUnguidedMatchingT(const Vector2* imagePoints, const ImagePointDescriptor* imagePointDescriptors, const size_t numberImagePoints, const Vector3* objectPoints, const ObjectPointVocabularyDescriptor* objectPointVocabularyDescriptors, const size_t numberObjectPoints, const Index32* objectPointIndices, const VocabularyStructure& vocabularyStructure) :
 	UnifiedUnguidedMatching(imagePoints, numberImagePoints, objectPoints, numberObjectPoints, objectPointIndices),
 	imagePointDescriptors_(imagePointDescriptors),
 	objectPointVocabularyDescriptors_(objectPointVocabularyDescriptors),
-	forestObjectPointDescriptors_(forestObjectPointDescriptors)
+	vocabularyStructure_(vocabularyStructure)
 {
 	// nothing to do here
 }
@@ -822,13 +826,37 @@ bool UnifiedUnguidedMatchingT<TImagePointDescriptor, TObjectPointVocabularyDescr
 
 	typename VocabularyForest::Matches matches;
 
-	if constexpr (std::is_same<TImagePointDescriptor, DescriptorHandling::FreakMultiDescriptor256>::value) // TODO HACK
+	const VocabularyHash* vocabularyHash = dynamic_cast<const VocabularyHash*>(&vocabularyStructure_);
+
+	if (vocabularyHash != nullptr)
 	{
-		forestObjectPointDescriptors_.template matchMultiDescriptors<ImagePointDescriptor, DescriptorHandling::multiDescriptorFunction, VocabularyTree::MM_ALL_GOOD_LEAVES_2>(objectPointVocabularyDescriptors_, imagePointDescriptors_, numberImagePoints_, maximalDescriptorDistance.distance<TDistance>(), matches, worker);
+		if constexpr (std::is_same<TImagePointDescriptor, DescriptorHandling::FreakMultiDescriptor256>::value) // TODO HACK
+		{
+			vocabularyHash->template matchMultiDescriptors<ImagePointDescriptor, DescriptorHandling::multiDescriptorFunction>(objectPointVocabularyDescriptors_, imagePointDescriptors_, numberImagePoints_, maximalDescriptorDistance.distance<TDistance>(), matches, worker);
+		}
+		else
+		{
+			vocabularyHash->matchDescriptors(objectPointVocabularyDescriptors_, imagePointDescriptors_, numberImagePoints_, maximalDescriptorDistance.distance<TDistance>(), matches, worker);
+		}
 	}
 	else
 	{
-		forestObjectPointDescriptors_.template matchDescriptors<VocabularyTree::MM_ALL_GOOD_LEAVES_2>(objectPointVocabularyDescriptors_, imagePointDescriptors_, numberImagePoints_, maximalDescriptorDistance.distance<TDistance>(), matches, worker);
+		const VocabularyForest* vocabularyForest = dynamic_cast<const VocabularyForest*>(&vocabularyStructure_);
+
+		if (vocabularyForest == nullptr)
+		{
+			ocean_assert(false && "Invalid vocabulary structure!");
+			return false;
+		}
+
+		if constexpr (std::is_same<TImagePointDescriptor, DescriptorHandling::FreakMultiDescriptor256>::value) // TODO HACK
+		{
+			vocabularyForest->template matchMultiDescriptors<ImagePointDescriptor, DescriptorHandling::multiDescriptorFunction, VocabularyTree::MM_ALL_GOOD_LEAVES_2>(objectPointVocabularyDescriptors_, imagePointDescriptors_, numberImagePoints_, maximalDescriptorDistance.distance<TDistance>(), matches, worker);
+		}
+		else
+		{
+			vocabularyForest->template matchDescriptors<VocabularyTree::MM_ALL_GOOD_LEAVES_2>(objectPointVocabularyDescriptors_, imagePointDescriptors_, numberImagePoints_, maximalDescriptorDistance.distance<TDistance>(), matches, worker);
+		}
 	}
 
 	if (matches.size() < size_t(minimalNumberCorrespondences))
@@ -9,6 +9,8 @@
 
 #include "ocean/tracking/PoseEstimationT.h"
 
+#include "ocean/cv/detector/Descriptor.h"
+
 namespace Ocean
 {
 
@@ -138,10 +140,16 @@ bool UnifiedBruteForcePoseEstimation::determineBruteForceMatchings(const Unified
 	{
 		case UnifiedDescriptor::DT_FREAK_MULTI_LEVEL_SINGLE_VIEW_256:
 		{
-			using SpecializedUnifiedDescriptors = UnifiedDescriptorsFreakMultiLevelSingleViewDescriptor256;
-			using DistanceType = unsigned int;
+			const UnifiedDescriptorsFreakMultiLevelSingleViewDescriptor256* descriptorsFreakA = dynamic_cast<const UnifiedDescriptorsFreakMultiLevelSingleViewDescriptor256*>(&descriptorsA);
+			const UnifiedDescriptorsFreakMultiLevelSingleViewDescriptor256* descriptorsFreakB = dynamic_cast<const UnifiedDescriptorsFreakMultiLevelSingleViewDescriptor256*>(&descriptorsB);
 
-			return determineBruteForceMatchings<SpecializedUnifiedDescriptors, SpecializedUnifiedDescriptors, DistanceType>(descriptorsA, descriptorsB, maximalDescriptorDistance.distance<DistanceType>(), indicesA, indicesB, distances, worker);
+			ocean_assert(descriptorsFreakA != nullptr && descriptorsFreakB != nullptr);
+			if (descriptorsFreakA != nullptr && descriptorsFreakB != nullptr)
+			{
+				return determineBruteForceMatchingsFreak(*descriptorsFreakA, *descriptorsFreakB, maximalDescriptorDistance.distance<unsigned int>(), indicesA, indicesB, distances, worker);
+			}
+
+			return false;
 		}
 
 		case UnifiedDescriptor::DT_FLOAT_SINGLE_LEVEL_SINGLE_VIEW_128:
@@ -180,6 +188,94 @@ bool UnifiedBruteForcePoseEstimation::determineBruteForceMatchings(const Unified
 	return false;
 }
 
+bool UnifiedBruteForcePoseEstimation::determineBruteForceMatchingsFreak(const UnifiedDescriptorsFreakMultiLevelSingleViewDescriptor256& descriptorsA, const UnifiedDescriptorsFreakMultiLevelSingleViewDescriptor256& descriptorsB, const unsigned int maximalDescriptorDistance, Indices32& indicesA, Indices32& indicesB, std::vector<double>* distances, Worker* worker)
+{
+	using Descriptor = UnifiedDescriptor::FreakMultiDescriptor256;
+	using LevelData = Descriptor::SinglelevelDescriptorData;
+
+	static_assert(sizeof(LevelData) == 256u / 8u, "Invalid data type!");
+
+	if (descriptorsA.numberDescriptors() == 0 || descriptorsB.numberDescriptors() == 0)
+	{
+		return true;
+	}
+
+	// all levels of all descriptors are stored in consecutive memory, the group of a level is the index of its descriptor
+
+	std::vector<LevelData> levelsA;
+	std::vector<LevelData> levelsB;
+	Indices32 groupsA;
+	Indices32 groupsB;
+
+	levelsA.reserve(descriptorsA.numberDescriptors() * 3);
+	groupsA.reserve(descriptorsA.numberDescriptors() * 3);
+
+	levelsB.reserve(descriptorsB.numberDescriptors() * 3);
+	groupsB.reserve(descriptorsB.numberDescriptors() * 3);
+
+	for (size_t n = 0; n < descriptorsA.numberDescriptors(); ++n)
+	{
+		const Descriptor& descriptor = descriptorsA.descriptors()[n];
+
+		for (unsigned int nLevel = 0u; nLevel < descriptor.descriptorLevels(); ++nLevel)
+		{
+			levelsA.emplace_back(descriptor.data()[nLevel]);
+			groupsA.emplace_back(Index32(n));
+		}
+	}
+
+	for (size_t n = 0; n < descriptorsB.numberDescriptors(); ++n)
+	{
+		const Descriptor& descriptor = descriptorsB.descriptors()[n];
+
+		for (unsigned int nLevel = 0u; nLevel < descriptor.descriptorLevels(); ++nLevel)
+		{
+			levelsB.emplace_back(descriptor.data()[nLevel]);
+			groupsB.emplace_back(Index32(n));
+		}
+	}
+
+	Indices32 bestGroups(levelsB.size());
+	Indices32 bestDistances(levelsB.size());
+	Indices32 secondBestDistances(levelsB.size());
+
+	CV::Detector::Descriptor::determineBestMatches<256u>(levelsB.data(), levelsB.size(), levelsA.data(), levelsA.size(), groupsA.data(), bestGroups.data(), bestDistances.data(), secondBestDistances.data(), worker);
+
+	// the best match of a descriptor is the best match of any of its levels, ties are resolved by the smallest index as in the generic brute-force matching
+
+	size_t levelIndex = 0;
+
+	while (levelIndex < levelsB.size())
+	{
+		const Index32 indexB = groupsB[levelIndex];
+
+		Index32 bestIndexA = bestGroups[levelIndex];
+		unsigned int bestDistance = bestDistances[levelIndex];
+
+		for (++levelIndex; levelIndex < levelsB.size() && groupsB[levelIndex] == indexB; ++levelIndex)
+		{
+			if (bestDistances[levelIndex] < bestDistance || (bestDistances[levelIndex] == bestDistance && bestGroups[levelIndex] < bestIndexA))
+			{
+				bestIndexA = bestGroups[levelIndex];
+				bestDistance = bestDistances[levelIndex];
+			}
+		}
+
+		if (bestDistance <= maximalDescriptorDistance)
+		{
+			indicesA.emplace_back(bestIndexA);
+			indicesB.emplace_back(indexB);
+
+			if (distances != nullptr)
+			{
+				distances->emplace_back(double(bestDistance));
+			}
+		}
+	}
+
+	return true;
+}
+
 SharedUnifiedDescriptors UnifiedBruteForcePoseEstimation::extractObjectPointDescriptors(const UnifiedDescriptorMap& unifiedDescriptorMap, const Indices32& objectPointIds)
 {
 	switch (unifiedDescriptorMap.descriptorType())
@@ -95,6 +95,20 @@ class UnifiedBruteForcePoseEstimation
 		template <typename TUnifiedDescriptorsA, typename TUnifiedDescriptorsB, typename TDescriptorDistance>
 		static bool determineBruteForceMatchings(const UnifiedDescriptors& descriptorsA, const UnifiedDescriptors& descriptorsB, const TDescriptorDistance maximalDescriptorDistance, Indices32& indicesA, Indices32& indicesB, std::vector<double>* distances = nullptr, Worker* worker = nullptr);
 
+		/**
+		 * Determines the brute-force matching between two sets of multi-level FREAK descriptors.
+		 * The levels of all descriptors are matched with the tiled binary matcher of CV::Detector::Descriptor, the distance between two descriptors is the minimal distance between any of their levels.
+		 * @param descriptorsA The first set of feature descriptors
+		 * @param descriptorsB The second set of feature descriptors
+		 * @param maximalDescriptorDistance The maximal distance between feature descriptors to count as a valid descriptor match, with range [0, 256]
+		 * @param indicesA The resulting indices of descriptors from the first set which could be matched to descriptors from the second set
+		 * @param indicesB The resulting indices of descriptors from the second set which could be matched to descriptors from the first set
+		 * @param distances Optional resulting distances between the individually matched descriptors, nullptr if not of interest
+		 * @param worker Optional worker to distribute the computation
+		 * @return True, if succeeded
+		 */
+		static bool determineBruteForceMatchingsFreak(const UnifiedDescriptorsFreakMultiLevelSingleViewDescriptor256& descriptorsA, const UnifiedDescriptorsFreakMultiLevelSingleViewDescriptor256& descriptorsB, const unsigned int maximalDescriptorDistance, Indices32& indicesA, Indices32& indicesB, std::vector<double>* distances = nullptr, Worker* worker = nullptr);
+
 		/**
 		 * Extracts serialized descriptors from a descriptor map.
 		 * @param unifiedDescriptorMap The map from which the descriptors will be extracted
@@ -149,9 +163,9 @@ void UnifiedBruteForcePoseEstimation::determineBruteForceMatchings(const TDescri
 	ocean_assert(numberDescriptorsB != 0);
 
 	Indices32 indicesB2A(numberDescriptorsB);
-	Indices32 floatDistances(numberDescriptorsB);
+	std::vector<TDescriptorDistance> descriptorDistances(distances != nullptr ? numberDescriptorsB : 0);
 
-	PoseEstimationT::determineUnguidedBruteForceMatchings<TDescriptorA, TDescriptorB, TDescriptorDistance, tDescriptorDistanceFunction>(descriptorsA, numberDescriptorsA, descriptorsB, numberDescriptorsB, maximalDescriptorDistance, indicesB2A.data(), worker);
+	PoseEstimationT::determineUnguidedBruteForceMatchings<TDescriptorA, TDescriptorB, TDescriptorDistance, tDescriptorDistanceFunction>(descriptorsA, numberDescriptorsA, descriptorsB, numberDescriptorsB, maximalDescriptorDistance, indicesB2A.data(), worker, distances != nullptr ? descriptorDistances.data() : nullptr);
 
 	for (size_t n = 0; n < indicesB2A.size(); ++n)
 	{
@@ -164,7 +178,7 @@ void UnifiedBruteForcePoseEstimation::determineBruteForceMatchings(const TDescri
 
 			if (distances != nullptr)
 			{
-				distances->emplace_back(double(floatDistances[n]));
+				distances->emplace_back(double(descriptorDistances[n]));
 			}
 		}
 	}
@@ -77,12 +77,13 @@ bool Utilities::writeDescriptorMap(const UnifiedDescriptorMap& unifiedDescriptor
 				return false;
 			}
 
-			for (unsigned int n = 0u; n < freakDescriptor.descriptorLevels(); ++n)
+			// the levels are stored contiguously, so that we can write all levels at once
+
+			static_assert(sizeof(CV::Detector::FREAKDescriptor32::MultilevelDescriptorData) == sizeof(CV::Detector::FREAKDescriptor32::SinglelevelDescriptorData) * 3, "Invalid data type!");
+
+			if (!outputStream.writeArray<CV::Detector::FREAKDescriptor32::PixelType>(freakDescriptor.data()[0].data(), freakDescriptor.descriptorLevels() * sizeof(CV::Detector::FREAKDescriptor32::SinglelevelDescriptorData)))
 			{
-				if (!outputStream.write(freakDescriptor.data()[n].data(), sizeof(std::array<CV::Detector::FREAKDescriptor32::PixelType, 32>)))
-				{
-					return false;
-				}
+				return false;
 			}
 		}
 	}
@@ -156,12 +157,9 @@ bool Utilities::readDescriptorMap(IO::InputBitstream& inputStream, std::shared_p
 
 			CV::Detector::FREAKDescriptor32::MultilevelDescriptorData multiLevelData;
 
-			for (unsigned int nLayer = 0u; nLayer < layers; ++nLayer)
+			if (!inputStream.readArray<CV::Detector::FREAKDescriptor32::PixelType>(multiLevelData[0].data(), layers * sizeof(CV::Detector::FREAKDescriptor32::SinglelevelDescriptorData)))
 			{
-				if (!inputStream.read(multiLevelData[nLayer].data(), sizeof(std::array<CV::Detector::FREAKDescriptor32::PixelType, 32>)))
-				{
-					return false;
-				}
+				return false;
 			}
 
 			freakDescriptors.emplace_back(std::move(multiLevelData), layers, orientation);
@@ -851,6 +851,16 @@ void NewTextureGenerator::threadRun()
 			TexturedMeshMap texturedMeshMap;
 			Frame textureFrame;
 			convertToTexture(texturedRegionMap, texturedMeshMap, textureFrame);
+
+			// the dirty regions are determined in this thread so that the render thread needs to upload the changed parts of the texture only
+
+			CV::PixelBoundingBoxes dirtyRegions;
+
+			if (textureFrame.isValid())
+			{
+				dirtyRegions = determineDirtyRegions(previousTextureFrame_, textureFrame);
+				previousTextureFrame_.copy(textureFrame);
+			}
 		performanceActual.stop();
 
 		UnorderedIndexSet32 usedKeyframeIds;
@@ -935,6 +945,7 @@ void NewTextureGenerator::threadRun()
 
 		latestTexturedMeshMap_ = std::move(texturedMeshMap);
 		latestTextureFrame_ = std::move(textureFrame);
+		latestDirtyRegions_ = std::move(dirtyRegions);
 
 		executionMode_ = EM_MESES_PROCESSED;
 	}
@@ -982,6 +993,62 @@ BlockedMeshes NewTextureGenerator::extractVisibleMeshes(const Frustums& cameraFr
 	return blockedMeshes;
 }
 
+CV::PixelBoundingBoxes NewTextureGenerator::determineDirtyRegions(const Frame& previousFrame, const Frame& frame, const unsigned int tileSize)
+{
+	ocean_assert(frame.isValid());
+	ocean_assert(tileSize >= 1u);
+
+	if (!previousFrame.isValid() || previousFrame.frameType() != frame.frameType() || frame.numberPlanes() != 1u)
+	{
+		return CV::PixelBoundingBoxes(1, CV::PixelBoundingBox(CV::PixelPosition(0u, 0u), frame.width(), frame.height()));
+	}
+
+	const unsigned int bytesPerPixel = frame.planeBytesPerPixel(0u);
+	ocean_assert(bytesPerPixel != 0u);
+
+	CV::PixelBoundingBoxes dirtyRegions;
+
+	for (unsigned int tileTop = 0u; tileTop < frame.height(); tileTop += tileSize)
+	{
+		const unsigned int tileBottomEnd = std::min(tileTop + tileSize, frame.height());
+
+		unsigned int dirtyLeft = (unsigned int)(-1);
+
+		for (unsigned int tileLeft = 0u; tileLeft < frame.width(); tileLeft += tileSize)
+		{
+			const unsigned int tileRightEnd = std::min(tileLeft + tileSize, frame.width());
+			const size_t tileWidthBytes = size_t(tileRightEnd - tileLeft) * size_t(bytesPerPixel);
+
+			bool isDirty = false;
+
+			for (unsigned int y = tileTop; !isDirty && y < tileBottomEnd; ++y)
+			{
+				isDirty = memcmp(previousFrame.constpixel<uint8_t>(tileLeft, y), frame.constpixel<uint8_t>(tileLeft, y), tileWidthBytes) != 0;
+			}
+
+			if (isDirty)
+			{
+				if (dirtyLeft == (unsigned int)(-1))
+				{
+					dirtyLeft = tileLeft;
+				}
+			}
+			else if (dirtyLeft != (unsigned int)(-1))
+			{
+				dirtyRegions.emplace_back(CV::PixelPosition(dirtyLeft, tileTop), tileLeft - dirtyLeft, tileBottomEnd - tileTop);
+				dirtyLeft = (unsigned int)(-1);
+			}
+		}
+
+		if (dirtyLeft != (unsigned int)(-1))
+		{
+			dirtyRegions.emplace_back(CV::PixelPosition(dirtyLeft, tileTop), frame.width() - dirtyLeft, tileBottomEnd - tileTop);
+		}
+	}
+
+	return dirtyRegions;
+}
+
 Frame NewTextureGenerator::downsampleDepthFrame(const Frame& depthFrame, const unsigned int iterations)
 {
 	ocean_assert(depthFrame.isValid() && depthFrame.isPixelFormatCompatible(FrameType::FORMAT_F32));
@@ -196,6 +196,16 @@ class OCEAN_TRACKING_MAPTEXTURING_EXPORT NewTextureGenerator : protected Thread
 		 */
 		inline bool latestTexturedMeshes(TexturedMeshMap& texturedMeshMap, Frame& textureFrame);
 
+		/**
+		 * Returns the latest textured meshes together with the regions of the texture which have changed since the previous texture.
+		 * The dirty regions allow to update only the changed parts of a large texture, e.g., with Rendering::FrameTexture2D::setTextureRegions().
+		 * @param texturedMeshMap The resulting map holding the textured meshes
+		 * @param textureFrame The resulting texture associated with the meshes
+		 * @param dirtyRegions The resulting regions of the texture which have changed since the previous texture, a region covering the entire texture if the texture's frame type has changed
+		 * @return True, if meshes existed; False, if the generator has now new meshes or is still processing the meshes
+		 */
+		inline bool latestTexturedMeshes(TexturedMeshMap& texturedMeshMap, Frame& textureFrame, CV::PixelBoundingBoxes& dirtyRegions);
+
 		/**
 		 * Returns the current memory usage of this texture generator.
 		 * The memory usage is mainly determined by the keyframes the generator stores.
@@ -211,6 +221,16 @@ class OCEAN_TRACKING_MAPTEXTURING_EXPORT NewTextureGenerator : protected Thread
 		 */
 		static Frame downsampleDepthFrame(const Frame& depthFrame, const unsigned int iterations = 2u);
 
+		/**
+		 * Determines the tiles of a frame which differ from a previous frame.
+		 * Neighboring dirty tiles within the same row of tiles are combined into one region.
+		 * @param previousFrame The previous frame, can be invalid
+		 * @param frame The current frame, must be valid
+		 * @param tileSize The size of the square tiles, in pixel, with range [1, infinity)
+		 * @return The regions which differ, one region covering the entire frame if both frames have different frame types
+		 */
+		static CV::PixelBoundingBoxes determineDirtyRegions(const Frame& previousFrame, const Frame& frame, const unsigned int tileSize = 64u);
+
 	protected:
 
 		void convertToTexture(const TexturedRegionMap& texturedRegionMap, TexturedMeshMap& texturedMeshMap, Frame& textureFrame);
@@ -268,6 +288,12 @@ class OCEAN_TRACKING_MAPTEXTURING_EXPORT NewTextureGenerator : protected Thread
 		/// The latest texture associated with the latest textured meshes.
 		Frame latestTextureFrame_;
 
+		/// The regions of the latest texture which have changed since the previous texture.
+		CV::PixelBoundingBoxes latestDirtyRegions_;
+
+		/// A copy of the previous texture, used to determine the dirty regions of the next texture.
+		Frame previousTextureFrame_;
+
 		/// The generator's lock.
 		mutable Lock lock_;
 };
@@ -313,6 +339,20 @@ inline bool NewTextureGenerator::latestTexturedMeshes(TexturedMeshMap& texturedM
 	return true;
 }
 
+inline bool NewTextureGenerator::latestTexturedMeshes(TexturedMeshMap& texturedMeshMap, Frame& textureFrame, CV::PixelBoundingBoxes& dirtyRegions)
+{
+	const ScopedLock scopedLock(lock_);
+
+	if (executionMode_ != EM_MESES_PROCESSED)
+	{
+		return false;
+	}
+
+	dirtyRegions = std::move(latestDirtyRegions_);
+
+	return latestTexturedMeshes(texturedMeshMap, textureFrame);
+}
+
 }
 
 }
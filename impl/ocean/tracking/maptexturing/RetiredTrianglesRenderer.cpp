@@ -310,22 +310,63 @@ bool RetiredTrianglesRenderer::render(const Rendering::Engine& engine, const Ren
 
 	deletedTriangleIds.clear();
 
+	// the states are copied to memory asynchronously, so that the render thread never waits for the GPU
+	// first, we finish the oldest pending copy (if the GPU has executed the copy already), afterwards we start the copy of the current states
+
+	if (!pendingReadbacks_.empty() && glesTextureFramebuffer.finishColorTextureReadback(stateFrame_))
+	{
+		const PendingReadback pendingReadback = pendingReadbacks_.front();
+		pendingReadbacks_.pop();
+
+		ocean_assert(stateFrame_.isContinuous());
+		ocean_assert(stateFrame_.pixels() >= pendingReadback.numberTriangles_);
+
+		const uint8_t* trianglesState = stateFrame_.constdata<uint8_t>();
+
+		for (unsigned int triangleId = 0u; triangleId < pendingReadback.numberTriangles_; ++triangleId)
+		{
+			if (trianglesState[triangleId] != 255u)
+			{
+				const ReportedTriangleMap::const_iterator iReported = reportedTriangleMap_.find(triangleId);
+
+				if (iReported != reportedTriangleMap_.cend() && pendingReadback.sequence_ < iReported->second)
+				{
+					// the triangle has been reported already, the copy has been started before the deletion was known to the manager
+
+					continue;
+				}
+
+				deletedTriangleIds.emplace_back(triangleId);
+			}
+		}
+
+		// all remaining copies have been started after this copy, so reported triangles which are not stale in this copy will not be stale in any remaining copy
+
+		for (ReportedTriangleMap::iterator iReported = reportedTriangleMap_.begin(); iReported != reportedTriangleMap_.end(); /* noop */)
+		{
+			if (iReported->second <= pendingReadback.sequence_)
+			{
+				iReported = reportedTriangleMap_.erase(iReported);
+			}
+			else
+			{
+				++iReported;
+			}
+		}
+	}
+
 	const unsigned int frameHeight = (numberTriangles + framebufferWidth - 1u) / framebufferWidth;
 
-	if (!glesTextureFramebuffer.copyColorTextureToFrame(stateFrame_, CV::PixelBoundingBox(CV::PixelPosition(0u, 0u), framebufferWidth, frameHeight)))
+	if (glesTextureFramebuffer.startColorTextureReadback(CV::PixelBoundingBox(CV::PixelPosition(0u, 0u), framebufferWidth, frameHeight)))
 	{
-		return false;
+		pendingReadbacks_.emplace(nextReadbackSequence_++, numberTriangles);
 	}
 
-	ocean_assert(stateFrame_.isContinuous());
-	const uint8_t* trianglesState = stateFrame_.constdata<uint8_t>();
+	// the manager will know the deleted triangles after this call, so that only copies started from now on will respect the deletion
 
-	for (unsigned int triangleId = 0u; triangleId < numberTriangles; ++triangleId)
+	for (const Index32 deletedTriangleId : deletedTriangleIds)
 	{
-		if (trianglesState[triangleId] != 255u)
-		{
-			deletedTriangleIds.emplace_back(triangleId);
-		}
+		reportedTriangleMap_[deletedTriangleId] = nextReadbackSequence_;
 	}
 
 	return true;
@@ -336,6 +377,9 @@ void RetiredTrianglesRenderer::release()
 	textureFramebuffer_.release();
 	shaderProgramRetiredTriangles_.release();
 	stateFrame_.release();
+
+	pendingReadbacks_ = PendingReadbacks();
+	reportedTriangleMap_.clear();
 }
 
 inline bool RetiredTrianglesRenderer::isValid() const
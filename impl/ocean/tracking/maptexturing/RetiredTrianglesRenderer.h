@@ -20,6 +20,9 @@
 #include "ocean/rendering/Triangles.h"
 #include "ocean/rendering/VertexSet.h"
 
+#include <queue>
+#include <unordered_map>
+
 namespace Ocean
 {
 
@@ -35,6 +38,41 @@ namespace MapTexturing
  */
 class OCEAN_TRACKING_MAPTEXTURING_EXPORT RetiredTrianglesRenderer
 {
+	protected:
+
+		/**
+		 * This class holds the information of a copy of the triangle states which has been started but not yet finished.
+		 */
+		class PendingReadback
+		{
+			public:
+
+				/**
+				 * Creates a new object.
+				 * @param sequence The sequence number of the copy
+				 * @param numberTriangles The number of triangles which have been rendered when the copy has been started
+				 */
+				inline PendingReadback(const uint64_t sequence, const unsigned int numberTriangles);
+
+			public:
+
+				/// The sequence number of the copy.
+				uint64_t sequence_ = 0ull;
+
+				/// The number of triangles which have been rendered when the copy has been started.
+				unsigned int numberTriangles_ = 0u;
+		};
+
+		/**
+		 * Definition of a queue holding pending copies, the oldest copy is the first element.
+		 */
+		using PendingReadbacks = std::queue<PendingReadback>;
+
+		/**
+		 * Definition of an unordered map mapping ids of reported triangles to the sequence number of the first copy respecting the deletion of the triangles.
+		 */
+		using ReportedTriangleMap = std::unordered_map<Index32, uint64_t>;
+
 	public:
 
 		/**
@@ -54,7 +92,7 @@ class OCEAN_TRACKING_MAPTEXTURING_EXPORT RetiredTrianglesRenderer
 		 * @param downsampledDepthFramebuffer The down-sampled and filtered texture framebuffer holding the depth image, must be valid
 		 * @param nearDistance The view's near distance, with range (0, infinity)
 		 * @param farDistance the view's far distance, with range (nearDistance, infinity)
-		 * @param deletedTriangleIds The resulting ids of all triangles which's states have changed from retired to deleted
+		 * @param deletedTriangleIds The resulting ids of all triangles which's states have changed from retired to deleted, the states are copied to memory asynchronously so that the ids belong to a previous call (usually one or two frames ago), each id is reported once
 		 * @return True, if succeeded
 		 */
 		bool render(const Rendering::Engine& engine, const Rendering::VertexSetRef& vertexSet, const Rendering::TrianglesRef& triangles, const unsigned int numberTriangles, const SquareMatrix4& projectionMatrix, const HomogenousMatrix4& world_T_camera, const Rendering::TextureFramebufferRef& trianglesStateFramebuffer, const Rendering::TextureFramebufferRef& downsampledDepthFramebuffer, const Scalar nearDistance, const Scalar farDistance, Indices32& deletedTriangleIds);
@@ -87,6 +125,15 @@ class OCEAN_TRACKING_MAPTEXTURING_EXPORT RetiredTrianglesRenderer
 		/// The intermediate state frame.
 		Frame stateFrame_;
 
+		/// The copies of the triangle states which have been started but not yet finished.
+		PendingReadbacks pendingReadbacks_;
+
+		/// The sequence number of the next copy of the triangle states.
+		uint64_t nextReadbackSequence_ = 0ull;
+
+		/// The map of triangles which have been reported as deleted and which may still be reported by pending copies.
+		ReportedTriangleMap reportedTriangleMap_;
+
 		/// The platform-specific shader part.
 		static const char* partPlatform_;
 
@@ -97,6 +144,13 @@ class OCEAN_TRACKING_MAPTEXTURING_EXPORT RetiredTrianglesRenderer
 		static const char* programFragmentShaderRetiredTriangles_;
 };
 
+inline RetiredTrianglesRenderer::PendingReadback::PendingReadback(const uint64_t sequence, const unsigned int numberTriangles) :
+	sequence_(sequence),
+	numberTriangles_(numberTriangles)
+{
+	// nothing to do here
+}
+
 inline const Rendering::TextureFramebufferRef& RetiredTrianglesRenderer::textureFramebuffer() const
 {
 	return textureFramebuffer_;
@@ -342,6 +342,8 @@ void TexturedTrianglesRenderer::release()
 	texture_.release();
 	textureFramebufferMap_.clear();
 	shaderProgram_.release();
+
+	textureAtlasMemory_.setBytes(0);
 }
 
 inline bool TexturedTrianglesRenderer::isValid() const
@@ -388,6 +390,9 @@ bool TexturedTrianglesRenderer::renderMesh(const Rendering::Engine& engine, cons
 		return false;
 	}
 
+	// all texture framebuffers have the same size
+	textureAtlasMemory_.setBytes(textureFramebufferMap_.size() * size_t(FrameType(textureAtlas.textureSizePixels(), textureAtlas.textureSizePixels(), FrameType::FORMAT_RGB24, FrameType::ORIGIN_LOWER_LEFT).frameTypeSize()));
+
 	glViewport(0, 0, textureAtlas.textureSizePixels(), textureAtlas.textureSizePixels());
 	ocean_assert(GL_NO_ERROR == glGetError());
 
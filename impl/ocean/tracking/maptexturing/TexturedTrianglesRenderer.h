@@ -13,6 +13,7 @@
 #include "ocean/tracking/maptexturing/TextureAtlas.h"
 
 #include "ocean/base/Frame.h"
+#include "ocean/base/MemoryTracker.h"
 
 #include "ocean/math/HomogenousMatrix4.h"
 
@@ -134,6 +135,9 @@ class OCEAN_TRACKING_MAPTEXTURING_EXPORT TexturedTrianglesRenderer
 		/// The frame texture holding the texture information for the triangles.
 		Rendering::FrameTexture2DRef texture_;
 
+		/// The accounting of the memory of all texture atlases, the memory of the texture framebuffers.
+		MemoryTracker::TrackedBytes textureAtlasMemory_ = MemoryTracker::TrackedBytes(MemoryTracker::registerCategory("TextureAtlas"));
+
 		/// The platform-specific shader part.
 		static const char* partPlatform_;
 
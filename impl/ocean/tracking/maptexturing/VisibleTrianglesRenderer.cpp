@@ -41,16 +41,23 @@ namespace MapTexturing
 
 const char* VisibleTrianglesRenderer::programVertexShaderVisibleTriangles_ =
 	R"SHADER(
-		// Vertex attribute
-		in OCEAN_HIGHP uint aId;
+		// The texture holding the triangle ids, one point is rendered for each pixel of the texture
+		uniform OCEAN_HIGHP usampler2D idTexture;
+
+		uniform uint uInputWidth;
 
 		uniform uint uFramebufferWidth;
 		uniform uint uFramebufferHeight;
 
 		void main(void)
 		{
-			OCEAN_HIGHP uint xId = aId % uFramebufferWidth;
-			OCEAN_HIGHP uint yId = aId / uFramebufferWidth;
+			OCEAN_HIGHP uint xCoordinate = uint(gl_VertexID) % uInputWidth;
+			OCEAN_HIGHP uint yCoordinate = uint(gl_VertexID) / uInputWidth;
+
+			OCEAN_HIGHP uint id = texelFetch(idTexture, ivec2(xCoordinate, yCoordinate), 0).r;
+
+			OCEAN_HIGHP uint xId = id % uFramebufferWidth;
+			OCEAN_HIGHP uint yId = id / uFramebufferWidth;
 
 			OCEAN_HIGHP float xOutputPosition = (float(xId * 2u) + 0.5) / float(uFramebufferWidth) - 1.0; // with range [-1, 1]
 			OCEAN_HIGHP float yOutputPosition = (float(yId * 2u) + 0.5) / float(uFramebufferHeight) - 1.0;
@@ -62,8 +69,8 @@ const char* VisibleTrianglesRenderer::programVertexShaderVisibleTriangles_ =
 
 const char* VisibleTrianglesRenderer::programVertexShaderOccludedTriangles_ =
 	R"SHADER(
-		// Vertex attribute
-		in OCEAN_HIGHP uint aId;
+		// The texture holding the triangle ids, one point is rendered for each pixel of the texture
+		uniform OCEAN_HIGHP usampler2D idTexture;
 
 		uniform uint uInputWidth;
 		uniform uint uInputHeight;
@@ -75,12 +82,14 @@ const char* VisibleTrianglesRenderer::programVertexShaderOccludedTriangles_ =
 
 		void main(void)
 		{
-			OCEAN_HIGHP uint xId = aId % uFramebufferWidth;
-			OCEAN_HIGHP uint yId = aId / uFramebufferWidth;
-
 			OCEAN_HIGHP uint xCoordinate = uint(gl_VertexID) % uInputWidth;
 			OCEAN_HIGHP uint yCoordinate = uint(gl_VertexID) / uInputWidth;
 
+			OCEAN_HIGHP uint id = texelFetch(idTexture, ivec2(xCoordinate, yCoordinate), 0).r;
+
+			OCEAN_HIGHP uint xId = id % uFramebufferWidth;
+			OCEAN_HIGHP uint yId = id / uFramebufferWidth;
+
 			inputPosition.x = (float(xCoordinate) + 0.5) / float(uInputWidth); // with range [0, 1]
 			inputPosition.y = (float(yCoordinate) + 0.5) / float(uInputHeight);
 
@@ -148,12 +157,19 @@ bool VisibleTrianglesRenderer::render(const Rendering::Engine& engine, const Ren
 {
 	Rendering::GLESceneGraph::GLESTextureFramebuffer& glesTrianglesIdFrameBuffer = trianglesIdFramebuffer.force<Rendering::GLESceneGraph::GLESTextureFramebuffer>();
 
-	if (!glesTrianglesIdFrameBuffer.copyColorTextureToFrame(idFrame_) || idFrame_.pixelFormat() != FrameType::FORMAT_Y32)
+	// the ids are read from the id texture directly in the vertex shaders, so that the ids never need to be copied to memory
+
+	const GLuint idTextureId = glesTrianglesIdFrameBuffer.colorTextureId();
+
+	if (idTextureId == 0u || glesTrianglesIdFrameBuffer.pixelFormat() != FrameType::FORMAT_Y32)
 	{
 		return false;
 	}
 
-	const size_t numberIds = size_t(idFrame_.pixels());
+	const unsigned int inputWidth = glesTrianglesIdFrameBuffer.width();
+	const unsigned int inputHeight = glesTrianglesIdFrameBuffer.height();
+
+	const unsigned int numberIds = inputWidth * inputHeight;
 
 	if (shaderProgramVisibleTriangles_.isNull())
 	{
@@ -195,7 +211,13 @@ bool VisibleTrianglesRenderer::render(const Rendering::Engine& engine, const Ren
 		vertexSet_ = engine.factory().createVertexSet();
 
 		points_ = engine.factory().createPoints();
-		points_->setIndices((unsigned int)(numberIds));
+	}
+
+	ocean_assert(vertexSet_ && points_);
+
+	if (points_->numberIndices() != numberIds)
+	{
+		points_->setIndices(numberIds);
 	}
 
 	ocean_assert(shaderProgramVisibleTriangles_ && shaderProgramOccludedTriangles_ && textureFramebuffer_);
@@ -215,10 +237,6 @@ bool VisibleTrianglesRenderer::render(const Rendering::Engine& engine, const Ren
 
 		Rendering::GLESceneGraph::GLESShaderProgram& glesShaderProgramVisibleTriangles = shaderProgramVisibleTriangles_.force<Rendering::GLESceneGraph::GLESShaderProgram>();
 
-		ocean_assert(vertexSet_ && points_);
-
-		vertexSet_.force<Rendering::GLESceneGraph::GLESVertexSet>().setAttribute<uint32_t>("aId", idFrame_.data<uint32_t>(), numberIds);
-
 		glViewport(0, 0, framebufferWidth, framebufferHeight);
 		ocean_assert(GL_NO_ERROR == glGetError());
 
@@ -238,6 +256,12 @@ bool VisibleTrianglesRenderer::render(const Rendering::Engine& engine, const Ren
 		ocean_assert(framebufferHeightLocation != -1);
 		Rendering::GLESceneGraph::GLESObject::setUniform(framebufferHeightLocation, framebufferHeight);
 
+		const GLint inputWidthLocation = glGetUniformLocation(glesShaderProgramVisibleTriangles.id(), "uInputWidth");
+		ocean_assert(inputWidthLocation != -1);
+		Rendering::GLESceneGraph::GLESObject::setUniform(inputWidthLocation, inputWidth);
+
+		bindIdTexture(glesShaderProgramVisibleTriangles.id(), idTextureId, 0u);
+
 		vertexSet_.force<Rendering::GLESceneGraph::GLESVertexSet>().bindVertexSet(glesShaderProgramVisibleTriangles.id());
 
 		points_.force<Rendering::GLESceneGraph::GLESPoints>().drawPoints();
@@ -258,9 +282,6 @@ bool VisibleTrianglesRenderer::render(const Rendering::Engine& engine, const Ren
 
 		Rendering::GLESceneGraph::GLESShaderProgram& glesShaderProgramOccludedTriangles = shaderProgramOccludedTriangles_.force<Rendering::GLESceneGraph::GLESShaderProgram>();
 
-		const unsigned int inputWidth = glesTrianglesIdFrameBuffer.width();
-		const unsigned int inputHeight = glesTrianglesIdFrameBuffer.height();
-
 		glesShaderProgramOccludedTriangles.bind(SquareMatrix4(false), HomogenousMatrix4(false), HomogenousMatrix4(false), SquareMatrix3(false));
 
 		const GLint inputWidthLocation = glGetUniformLocation(glesShaderProgramOccludedTriangles.id(), "uInputWidth");
@@ -341,6 +362,8 @@ bool VisibleTrianglesRenderer::render(const Rendering::Engine& engine, const Ren
 		ocean_assert(locationFilteredDepthTexture != -1);
 		Rendering::GLESceneGraph::GLESObject::setUniform(locationFilteredDepthTexture, 1);
 
+		bindIdTexture(glesShaderProgramOccludedTriangles.id(), idTextureId, 2u);
+
 		vertexSet_.force<Rendering::GLESceneGraph::GLESVertexSet>().bindVertexSet(glesShaderProgramOccludedTriangles.id());
 
 		points_.force<Rendering::GLESceneGraph::GLESPoints>().drawPoints();
@@ -358,7 +381,29 @@ void VisibleTrianglesRenderer::release()
 	textureFramebuffer_.release();
 	shaderProgramVisibleTriangles_.release();
 	shaderProgramOccludedTriangles_.release();
-	idFrame_.release();
+}
+
+void VisibleTrianglesRenderer::bindIdTexture(const unsigned int programId, const unsigned int idTextureId, const unsigned int textureUnit)
+{
+	ocean_assert(programId != 0u && idTextureId != 0u);
+
+	glActiveTexture(GL_TEXTURE0 + textureUnit);
+	ocean_assert(GL_NO_ERROR == glGetError());
+
+	glBindTexture(GL_TEXTURE_2D, idTextureId);
+	ocean_assert(GL_NO_ERROR == glGetError());
+
+	// integer textures do not support linear filtering, texelFetch() would return zero for an incomplete texture
+
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+	ocean_assert(GL_NO_ERROR == glGetError());
+
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+	ocean_assert(GL_NO_ERROR == glGetError());
+
+	const GLint locationIdTexture = glGetUniformLocation(programId, "idTexture");
+	ocean_assert(locationIdTexture != -1);
+	Rendering::GLESceneGraph::GLESObject::setUniform(locationIdTexture, int(textureUnit));
 }
 
 inline bool VisibleTrianglesRenderer::isValid() const
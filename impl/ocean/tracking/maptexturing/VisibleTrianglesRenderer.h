@@ -71,6 +71,16 @@ class OCEAN_TRACKING_MAPTEXTURING_EXPORT VisibleTrianglesRenderer
 		 */
 		inline bool isValid() const;
 
+	protected:
+
+		/**
+		 * Binds the texture holding the triangle ids to a shader program.
+		 * @param programId The id of the shader program, must be valid
+		 * @param idTextureId The id of the texture holding the triangle ids, must be valid
+		 * @param textureUnit The index of the texture unit to which the texture will be bound, with range [0, infinity)
+		 */
+		static void bindIdTexture(const unsigned int programId, const unsigned int idTextureId, const unsigned int textureUnit);
+
 	protected:
 
 		/// The shader program rendering the ids of visible triangles.
@@ -88,9 +98,6 @@ class OCEAN_TRACKING_MAPTEXTURING_EXPORT VisibleTrianglesRenderer
 		/// The triangle object which will be used to render the triangles.
 		Rendering::PointsRef points_;
 
-		/// The intermediate frame holding the ids of all visible triangles.
-		Frame idFrame_;
-
 		/// The platform-specific shader part.
 		static const char* partPlatform_;
 
@@ -16,6 +16,8 @@
 #include "ocean/geometry/NonLinearOptimizationTransformation.h"
 #include "ocean/geometry/RANSAC.h"
 
+#include "ocean/math/Box2.h"
+
 #include "ocean/tracking/oculustags/OculusTagDebugElements.h"
 #include "ocean/tracking/oculustags/Utilities.h"
 
@@ -127,7 +129,9 @@ bool OculusTagTracker::TagObservationHistory::optimizePose(const AnyCamera& anyC
 }
 
 OculusTagTracker::OculusTagTracker() :
-	frameCounter_(0u)
+	frameCounter_(0u),
+	detectionMode_(DM_FULL_FRAME),
+	detectionIteration_(0u)
 {
 	// Nothing else todo
 }
@@ -149,6 +153,9 @@ OculusTagTracker& OculusTagTracker::operator=(OculusTagTracker&& otherTracker)
 		frameCounter_ = otherTracker.frameCounter_;
 		trackedTagMap_ = std::move(otherTracker.trackedTagMap_);
 
+		detectionMode_ = otherTracker.detectionMode_;
+		detectionIteration_ = otherTracker.detectionIteration_;
+
 		for (unsigned int cameraIndex = 0u; cameraIndex < 2u; ++cameraIndex)
 		{
 			previousYFrames_[cameraIndex] = std::move(otherTracker.previousYFrames_[cameraIndex]);
@@ -327,9 +334,72 @@ bool OculusTagTracker::trackTagsStereo(const AnyCamera& anyCameraA, const AnyCam
 
 	// Detection
 
-	if (visibleTagsIndices.empty() || frameCounter_ % detectionCadence_ == 0u)
+	TrackedTags detectedTags;
+
+	if (detectionMode_ == DM_FULL_FRAME)
+	{
+		if (visibleTagsIndices.empty() || frameCounter_ % detectionCadence_ == 0u)
+		{
+			detectedTags = detectTagsStereo(anyCameras, yFrames, world_T_device, device_T_cameras);
+		}
+	}
+	else
+	{
+		ocean_assert(detectionMode_ == DM_PREDICTED_REGIONS);
+
+		CV::PixelBoundingBoxes detectionRegionGroups[2];
+
+		// known tags which could not be tracked are verified inside their predicted regions only
+
+		for (const TrackedTagMap::value_type& trackedTagIter : trackedTagMap_)
+		{
+			const TrackedTag& trackedTag = trackedTagIter.second;
+
+			if (trackedTag.trackingState_ == TS_TRACKING || !trackedTag.tag_.isValid())
+			{
+				continue;
+			}
+
+			for (size_t cameraIndex = 0; cameraIndex < 2; ++cameraIndex)
+			{
+				const CV::PixelBoundingBox predictedRegion = predictTagRegion(*anyCameras[cameraIndex], trackedTag.tag_.world_T_tag().inverted() * world_T_device * device_T_cameras[cameraIndex], trackedTag.tag_.tagSize());
+
+				if (predictedRegion.isValid())
+				{
+					detectionRegionGroups[cameraIndex].emplace_back(predictedRegion);
+				}
+			}
+		}
+
+		// new tags are detected in one tile per detection, after all tiles the entire frame is scanned once to find tags which are larger than a tile
+
+		if (visibleTagsIndices.empty() || frameCounter_ % detectionCadence_ == 0u)
+		{
+			const unsigned int tileIndex = detectionIteration_ % (numberDetectionTiles_ + 1u);
+
+			for (size_t cameraIndex = 0; cameraIndex < 2; ++cameraIndex)
+			{
+				if (tileIndex == numberDetectionTiles_)
+				{
+					detectionRegionGroups[cameraIndex] = { CV::PixelBoundingBox(0u, 0u, yFrames[cameraIndex].width() - 1u, yFrames[cameraIndex].height() - 1u) };
+				}
+				else
+				{
+					detectionRegionGroups[cameraIndex].emplace_back(detectionTile(yFrames[cameraIndex].width(), yFrames[cameraIndex].height(), tileIndex, numberDetectionTiles_));
+				}
+			}
+
+			++detectionIteration_;
+		}
+
+		if (!detectionRegionGroups[0].empty() || !detectionRegionGroups[1].empty())
+		{
+			detectedTags = detectTagsStereo(anyCameras, yFrames, world_T_device, device_T_cameras, detectionRegionGroups);
+		}
+	}
+
+	if (!detectedTags.empty())
 	{
-		TrackedTags detectedTags = detectTagsStereo(anyCameras, yFrames, world_T_device, device_T_cameras);
 
 		for (size_t t = 0; t < detectedTags.size(); ++t)
 		{
@@ -530,7 +600,7 @@ bool OculusTagTracker::extractRectifiedTagImage(const AnyCamera& anyCameraA, con
 	return rectificationSuccessful;
 }
 
-OculusTags OculusTagTracker::detectTagsMono(const AnyCamera& anyCamera, const Frame& yFrame, const HomogenousMatrix4& world_T_device, const HomogenousMatrix4& device_T_camera, const Scalar defaultTagSize, const TagSizeMap& tagSizeMap, TagObservationHistories* tagObservationHistories)
+OculusTags OculusTagTracker::detectTagsMono(const AnyCamera& anyCamera, const Frame& yFrame, const HomogenousMatrix4& world_T_device, const HomogenousMatrix4& device_T_camera, const Scalar defaultTagSize, const TagSizeMap& tagSizeMap, TagObservationHistories* tagObservationHistories, const CV::PixelBoundingBoxes& detectionRegions)
 {
 	ocean_assert(anyCamera.isValid());
 	ocean_assert(yFrame.isValid() && FrameType::arePixelFormatsCompatible(yFrame.pixelFormat(), FrameType::genericPixelFormat<FrameType::DT_UNSIGNED_INTEGER_8, 1u>()));
@@ -543,7 +613,44 @@ OculusTags OculusTagTracker::detectTagsMono(const AnyCamera& anyCamera, const Fr
 	OculusTags tags;
 	TagObservationHistories localTagObservationHistories;
 
-	const QuadDetector::Quads candidateQuads = QuadDetector::detectQuads(yFrame, frameBorder_);
+	QuadDetector::Quads candidateQuads;
+
+	if (detectionRegions.empty())
+	{
+		candidateQuads = QuadDetector::detectQuads(yFrame, frameBorder_);
+	}
+	else
+	{
+		for (const CV::PixelBoundingBox& detectionRegion : detectionRegions)
+		{
+			const QuadDetector::Quads regionQuads = QuadDetector::detectQuads(yFrame, detectionRegion, frameBorder_);
+
+			for (const QuadDetector::Quad& regionQuad : regionQuads)
+			{
+				// the regions may overlap, so that the same quad can be detected several times
+
+				const Vector2 regionQuadCenter = (regionQuad[0] + regionQuad[1] + regionQuad[2] + regionQuad[3]) * Scalar(0.25);
+
+				bool isDuplicate = false;
+
+				for (const QuadDetector::Quad& candidateQuad : candidateQuads)
+				{
+					const Vector2 candidateQuadCenter = (candidateQuad[0] + candidateQuad[1] + candidateQuad[2] + candidateQuad[3]) * Scalar(0.25);
+
+					if (regionQuadCenter.sqrDistance(candidateQuadCenter) < Scalar(2 * 2))
+					{
+						isDuplicate = true;
+						break;
+					}
+				}
+
+				if (!isDuplicate)
+				{
+					candidateQuads.emplace_back(regionQuad);
+				}
+			}
+		}
+	}
 
 	for (const QuadDetector::Quad& candidateQuad : candidateQuads)
 	{
@@ -908,7 +1015,7 @@ bool OculusTagTracker::trackTagCornersTemporally(const AnyCamera& anyCamera, con
 	return CV::Advanced::AdvancedMotionZeroMeanSSD::trackPointsSubPixelMirroredBorder<1u, 7u>(previousFramePyramid, framePyramid, previousImagePoints, predictedImagePoints, imagePoints, /* coarsestLayerRadius */ 2u);
 }
 
-OculusTagTracker::TrackedTags OculusTagTracker::detectTagsStereo(const SharedAnyCameras& anyCameras, const Frames& yFrames,  const HomogenousMatrix4& world_T_device, const HomogenousMatrices4& device_T_cameras)
+OculusTagTracker::TrackedTags OculusTagTracker::detectTagsStereo(const SharedAnyCameras& anyCameras, const Frames& yFrames,  const HomogenousMatrix4& world_T_device, const HomogenousMatrices4& device_T_cameras, const CV::PixelBoundingBoxes* detectionRegionGroups)
 {
 	ocean_assert(anyCameras.size() >= 2);
 	ocean_assert(anyCameras.size() == yFrames.size());
@@ -936,7 +1043,13 @@ OculusTagTracker::TrackedTags OculusTagTracker::detectTagsStereo(const SharedAny
 	OculusTags tagGroups[2];
 	for (size_t cameraIndex : {0, 1})
 	{
-		tagGroups[cameraIndex] = OculusTagTracker::detectTagsMono(*anyCameras[cameraIndex], yFrames[cameraIndex], world_T_device, device_T_cameras[cameraIndex], dummyTagSize, TagSizeMap(), &observationHistoryGroups[cameraIndex]);
+		if (detectionRegionGroups != nullptr && detectionRegionGroups[cameraIndex].empty())
+		{
+			// no region to scan in this camera
+			continue;
+		}
+
+		tagGroups[cameraIndex] = OculusTagTracker::detectTagsMono(*anyCameras[cameraIndex], yFrames[cameraIndex], world_T_device, device_T_cameras[cameraIndex], dummyTagSize, TagSizeMap(), &observationHistoryGroups[cameraIndex], detectionRegionGroups != nullptr ? detectionRegionGroups[cameraIndex] : CV::PixelBoundingBoxes());
 		ocean_assert(tagGroups[cameraIndex].size() == observationHistoryGroups[cameraIndex].size());
 	};
 
@@ -1089,6 +1202,63 @@ OculusTagTracker::TrackedTags OculusTagTracker::detectTagsStereo(const SharedAny
 	return newTags;
 }
 
+CV::PixelBoundingBox OculusTagTracker::detectionTile(const unsigned int width, const unsigned int height, const unsigned int tileIndex, const unsigned int numberTiles)
+{
+	ocean_assert(width != 0u && height >= numberTiles);
+	ocean_assert(tileIndex < numberTiles);
+
+	const unsigned int stripeHeight = (height + numberTiles - 1u) / numberTiles;
+
+	// each tile has the height of two stripes, so that neighboring tiles overlap by one stripe
+
+	const unsigned int tileHeight = std::min(2u * stripeHeight, height);
+
+	const unsigned int top = std::min(tileIndex * stripeHeight >= stripeHeight / 2u ? tileIndex * stripeHeight - stripeHeight / 2u : 0u, height - tileHeight);
+	const unsigned int bottom = top + tileHeight - 1u;
+
+	return CV::PixelBoundingBox(0u, top, width - 1u, bottom);
+}
+
+CV::PixelBoundingBox OculusTagTracker::predictTagRegion(const AnyCamera& anyCamera, const HomogenousMatrix4& tag_T_camera, const Scalar tagSize)
+{
+	ocean_assert(anyCamera.isValid());
+	ocean_assert(tag_T_camera.isValid());
+	ocean_assert(tagSize > 0);
+
+	if (!isTagVisible(anyCamera, tag_T_camera, tagSize, Scalar(frameBorder_)))
+	{
+		return CV::PixelBoundingBox();
+	}
+
+	const HomogenousMatrix4 flippedCamera_T_tag = AnyCamera::standard2InvertedFlipped(tag_T_camera);
+
+	const Vectors3 tagObjectPoints = getTagObjectPoints(TPG_CORNERS_0_TO_3, tagSize);
+	ocean_assert(tagObjectPoints.size() == 4);
+
+	Box2 boundingBox;
+
+	for (const Vector3& tagObjectPoint : tagObjectPoints)
+	{
+		boundingBox += anyCamera.projectToImageIF(flippedCamera_T_tag * tagObjectPoint);
+	}
+
+	// the margin covers the motion of the tag since the last observation, as well as the quiet zone around the tag
+
+	const Scalar margin = std::max(Scalar(16), std::max(boundingBox.width(), boundingBox.height()) * Scalar(0.5));
+
+	const int left = std::max(0, int(boundingBox.lower().x() - margin));
+	const int top = std::max(0, int(boundingBox.lower().y() - margin));
+	const int right = std::min(int(anyCamera.width()) - 1, int(boundingBox.higher().x() + margin));
+	const int bottom = std::min(int(anyCamera.height()) - 1, int(boundingBox.higher().y() + margin));
+
+	if (left > right || top > bottom)
+	{
+		return CV::PixelBoundingBox();
+	}
+
+	return CV::PixelBoundingBox((unsigned int)(left), (unsigned int)(top), (unsigned int)(right), (unsigned int)(bottom));
+}
+
 bool OculusTagTracker::readTag(const AnyCamera& anyCamera, const Frame& yFrame, const QuadDetector::Quad& unorientedQuad, const HomogenousMatrix4& world_T_device, const HomogenousMatrix4& device_T_camera, const Scalar tagSize, OculusTag& tag, QuadDetector::Quad& quad, const TagSizeMap& tagSizeMap)
 {
 	ocean_assert(anyCamera.isValid());
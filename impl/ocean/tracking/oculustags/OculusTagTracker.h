@@ -71,6 +71,18 @@ class OCEAN_TRACKING_OCULUSTAGS_EXPORT OculusTagTracker
 			MT_STATIC,
 		};
 
+		/**
+		 * Definition of the modes in which new detections are determined
+		 */
+		enum DetectionMode
+		{
+			/// The detector scans the entire frame whenever new detections are needed
+			DM_FULL_FRAME = 0,
+
+			/// The detector scans one tile of the frame per detection (so that one full pass is amortized over several frames) and the predicted regions of known tags which are currently not tracked
+			DM_PREDICTED_REGIONS
+		};
+
 		/**
 		 * Definition of groups of object corners on a tag.
 		 *
@@ -409,6 +421,18 @@ class OCEAN_TRACKING_OCULUSTAGS_EXPORT OculusTagTracker
 		 */
 		inline const TrackedTagMap& trackedTagMap() const;
 
+		/**
+		 * Sets the mode in which new detections are determined
+		 * @param detectionMode The detection mode to be used
+		 */
+		inline void setDetectionMode(const DetectionMode detectionMode);
+
+		/**
+		 * Returns the mode in which new detections are determined
+		 * @return The detection mode
+		 */
+		inline DetectionMode detectionMode() const;
+
 		/**
 		 * Creates a rectified image of a tag for visualization
 		 * @param anyCameraA The first camera with which the first input image has been recorded, must be valid
@@ -434,9 +458,10 @@ class OCEAN_TRACKING_OCULUSTAGS_EXPORT OculusTagTracker
 		 * @param defaultTagSize The edge length of all detected tags that are not specified in `tagSizeMap`, range: (0, infinity)
 		 * @param tagSizeMap Optional mapping of tag IDs to specific tag sizes, range of tag IDs (key): [0, 1024), range of tag sizes (value): (0, infinity)
 		 * @param tagObservationHistories Optional return value holding the tag observations (2D-3D point correspondences)
+		 * @param detectionRegions Optional regions of the image in which tags will be detected, an empty vector to detect tags in the entire image
 		 * @return The detected tags
 		 */
-		static OculusTags detectTagsMono(const AnyCamera& anyCamera, const Frame& yFrame, const HomogenousMatrix4& world_T_device, const HomogenousMatrix4& device_T_camera, const Scalar defaultTagSize, const TagSizeMap& tagSizeMap = TagSizeMap(), TagObservationHistories* tagObservationHistories = nullptr);
+		static OculusTags detectTagsMono(const AnyCamera& anyCamera, const Frame& yFrame, const HomogenousMatrix4& world_T_device, const HomogenousMatrix4& device_T_camera, const Scalar defaultTagSize, const TagSizeMap& tagSizeMap = TagSizeMap(), TagObservationHistories* tagObservationHistories = nullptr, const CV::PixelBoundingBoxes& detectionRegions = CV::PixelBoundingBoxes());
 
 		/**
 		 * Locates a detected tag in a different camera image, e.g., the second camera of a stereo camera
@@ -499,9 +524,30 @@ class OCEAN_TRACKING_OCULUSTAGS_EXPORT OculusTagTracker
 		 * @param yFrames The 8-bit grayscale images in which the tags will be detected, must have two valid elements
 		 * @param world_T_device The world pose of the device, must be valid
 		 * @param device_T_cameras The device poses of the all cameras, must have two valid elements
+		 * @param detectionRegionGroups Optional regions in which tags will be detected, one group for each camera, an empty group to skip the detection in the corresponding camera, nullptr to detect tags in the entire images
 		 * @return The detected tags.
 		 */
-		static TrackedTags detectTagsStereo(const SharedAnyCameras& anyCameras, const Frames& yFrames, const HomogenousMatrix4& world_T_device, const HomogenousMatrices4& device_T_cameras);
+		static TrackedTags detectTagsStereo(const SharedAnyCameras& anyCameras, const Frames& yFrames, const HomogenousMatrix4& world_T_device, const HomogenousMatrices4& device_T_cameras, const CV::PixelBoundingBoxes* detectionRegionGroups = nullptr);
+
+		/**
+		 * Returns one tile of an image, all tiles together cover the entire image.
+		 * The tiles are horizontal stripes, neighboring tiles overlap so that any tag with a height up to `height / numberTiles` is located entirely inside at least one tile.
+		 * @param width The width of the image in pixels, range: [1, infinity)
+		 * @param height The height of the image in pixels, range: [numberTiles, infinity)
+		 * @param tileIndex The index of the tile, range: [0, numberTiles)
+		 * @param numberTiles The number of tiles, range: [1, infinity)
+		 * @return The tile
+		 */
+		static CV::PixelBoundingBox detectionTile(const unsigned int width, const unsigned int height, const unsigned int tileIndex, const unsigned int numberTiles);
+
+		/**
+		 * Predicts the region of an image in which a tag will be visible
+		 * @param anyCamera The camera with which the image has been recorded, must be valid
+		 * @param tag_T_camera The transformation that converts points in the camera to tag points, must be valid
+		 * @param tagSize The edge length of the tag, range: (0, infinity)
+		 * @return The predicted region including a margin for the motion of the tag, an invalid region if the tag is not visible
+		 */
+		static CV::PixelBoundingBox predictTagRegion(const AnyCamera& anyCamera, const HomogenousMatrix4& tag_T_camera, const Scalar tagSize);
 
 		/**
 		 * Reads the tag information from an image given the locations of its four outer corners
@@ -637,6 +683,12 @@ class OCEAN_TRACKING_OCULUSTAGS_EXPORT OculusTagTracker
 		/// The poses of the input cameras of the previous tracking iteration
 		HomogenousMatrix4 previousDevice_T_cameras_[2];
 
+		/// The mode in which new detections are determined
+		DetectionMode detectionMode_;
+
+		/// The number of detections that have been executed in the predicted-regions mode, determines the next tile to be scanned
+		unsigned int detectionIteration_;
+
 		/// The border area along the inside of the image which will be ignored completely (in pixels), range: [0, min(imageWidth, imageHeight))
 		static constexpr uint32_t frameBorder_ = 10u;
 
@@ -657,6 +709,9 @@ class OCEAN_TRACKING_OCULUSTAGS_EXPORT OculusTagTracker
 
 		/// The number of layers used for the frame pyramids, maximum supported pixel motion: 2^LAYERS, range: [1, infinity)
 		static constexpr unsigned int numberFrameLayers_ = 6u;
+
+		/// The number of tiles into which a frame is split in the predicted-regions mode, after all tiles have been scanned the entire frame is scanned once, range: [1, infinity)
+		static constexpr unsigned int numberDetectionTiles_ = 6u;
 };
 
 inline void OculusTagTracker::TagObservationHistory::addObservation(const HomogenousMatrix4& world_T_camera, Vectors3&& objectPoints, Vectors2&& imagePoints, Vectors2&& trackingImagePoints, Vectors3&& trackingObjectPoints)
@@ -845,6 +900,16 @@ inline const OculusTagTracker::TrackedTagMap& OculusTagTracker::trackedTagMap()
 	return trackedTagMap_;
 }
 
+inline void OculusTagTracker::setDetectionMode(const DetectionMode detectionMode)
+{
+	detectionMode_ = detectionMode;
+}
+
+inline OculusTagTracker::DetectionMode OculusTagTracker::detectionMode() const
+{
+	return detectionMode_;
+}
+
 }  // namespace OculusTags
 
 }  // namespace Tracking
@@ -115,6 +115,42 @@ QuadDetector::Quads QuadDetector::detectQuads(const Frame& yFrame, const uint32_
 	return quads;
 }
 
+QuadDetector::Quads QuadDetector::detectQuads(const Frame& yFrame, const CV::PixelBoundingBox& subRegion, const uint32_t frameBorder)
+{
+	ocean_assert(yFrame.isValid() && FrameType::arePixelFormatsCompatible(yFrame.pixelFormat(), FrameType::genericPixelFormat<FrameType::DT_UNSIGNED_INTEGER_8, 1u>()));
+	ocean_assert(yFrame.width() >= 2u * frameBorder && yFrame.height() >= 2u * frameBorder);
+	ocean_assert(subRegion.isValid());
+
+	const CV::PixelBoundingBox validArea(frameBorder, frameBorder, yFrame.width() - frameBorder - 1u, yFrame.height() - frameBorder - 1u);
+
+	const CV::PixelBoundingBox clippedSubRegion = subRegion && validArea;
+
+	// a boundary pattern needs at least a few pixels per module
+
+	constexpr unsigned int minimalSize = 2u * OculusTag::numberOfModules;
+
+	if (!clippedSubRegion.isValid() || clippedSubRegion.width() < minimalSize || clippedSubRegion.height() < minimalSize)
+	{
+		return Quads();
+	}
+
+	const Frame ySubFrame = yFrame.subFrame(clippedSubRegion.left(), clippedSubRegion.top(), clippedSubRegion.width(), clippedSubRegion.height(), Frame::CM_USE_KEEP_LAYOUT);
+
+	Quads quads = detectQuads(ySubFrame, 0u);
+
+	const Vector2 offset(Scalar(clippedSubRegion.left()), Scalar(clippedSubRegion.top()));
+
+	for (Quad& quad : quads)
+	{
+		for (Vector2& corner : quad)
+		{
+			corner += offset;
+		}
+	}
+
+	return quads;
+}
+
 QuadDetector::Quads QuadDetector::extractQuads(const Frame& yFrame, const CV::Detector::ShapeDetector::LShapes& lShapes, const FiniteLines2& finiteLines, const Scalar angleThreshold, const uint32_t frameBorder)
 {
 	ocean_assert(yFrame.isValid() && FrameType::arePixelFormatsCompatible(yFrame.pixelFormat(), FrameType::genericPixelFormat<FrameType::DT_UNSIGNED_INTEGER_8, 1u>()));
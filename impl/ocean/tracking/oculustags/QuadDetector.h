@@ -12,6 +12,8 @@
 
 #include "ocean/base/Frame.h"
 
+#include "ocean/cv/PixelBoundingBox.h"
+
 #include "ocean/cv/detector/ShapeDetector.h"
 
 #include "ocean/math/Vector2.h"
@@ -53,6 +55,16 @@ class OCEAN_TRACKING_OCULUSTAGS_EXPORT QuadDetector
 		 */
 		static Quads detectQuads(const Frame& yFrame, const uint32_t frameBorder = 0u);
 
+		/**
+		 * Detects boundary patterns (possible candidates) inside a sub-region of an image and filters them
+		 * Only boundary patterns located entirely inside the sub-region can be detected, the cost of the detection is proportional to the size of the sub-region.
+		 * @param yFrame The image in which boundary patterns will be searched, must be valid
+		 * @param subRegion The sub-region of the image in which boundary patterns will be searched, will be clipped to the image without the frame border, must be valid
+		 * @param frameBorder Defines a perimeter inside the image along the image border in which nothing will be processed (in pixels), range: [0, min(yFrame.width(), yFrame.height())/2)
+		 * @return A vector of detected boundary patterns, defined in the coordinate system of the entire image
+		 */
+		static Quads detectQuads(const Frame& yFrame, const CV::PixelBoundingBox& subRegion, const uint32_t frameBorder = 0u);
+
 	protected:
 
 		/**
@@ -8,6 +8,7 @@
 #include "ocean/tracking/offline/PointPaths.h"
 
 #include "ocean/base/Median.h"
+#include "ocean/base/String.h"
 #include "ocean/base/Subset.h"
 
 #include "ocean/cv/FrameConverter.h"
@@ -16,6 +17,14 @@
 
 #include "ocean/cv/detector/FeatureDetector.h"
 
+#include "ocean/io/Bitstream.h"
+#include "ocean/io/Directory.h"
+#include "ocean/io/File.h"
+
+#include "ocean/tracking/Utilities.h"
+
+#include <fstream>
+
 namespace Ocean
 {
 
@@ -1147,6 +1156,248 @@ bool PointPaths::determinePointPaths(CV::FrameProviderInterface& frameProviderIn
 	return !abort || !*abort;
 }
 
+bool PointPaths::determinePointPathsSegmented(CV::FrameProviderInterface& frameProviderInterface, const FrameType::PixelFormat pixelFormat, const FrameType::PixelOrigin pixelOrigin, const TrackingConfiguration& trackingConfiguration, const unsigned int lowerFrameIndex, const unsigned int upperFrameIndex, const unsigned int invalidBorderSize, Database& database, const unsigned int segmentSize, const unsigned int segmentOverlap, const std::string& checkpointDirectory, Worker* worker, bool* abort, Scalar* progress)
+{
+	ocean_assert(lowerFrameIndex <= upperFrameIndex);
+	ocean_assert(segmentSize >= 2u && segmentOverlap >= 1u && segmentOverlap < segmentSize);
+
+	if (lowerFrameIndex > upperFrameIndex || segmentSize < 2u || segmentOverlap == 0u || segmentOverlap >= segmentSize)
+	{
+		return false;
+	}
+
+	while (!frameProviderInterface.isInitialized())
+	{
+		if (abort && *abort)
+		{
+			return false;
+		}
+
+		Thread::sleep(1);
+	}
+
+	// we split the frame range into segments, two neighboring segments share 'segmentOverlap' frames
+
+	IndexPairs32 segments;
+
+	for (unsigned int segmentLowerFrameIndex = lowerFrameIndex; true; segmentLowerFrameIndex += segmentSize)
+	{
+		unsigned int segmentUpperFrameIndex = (unsigned int)(std::min(uint64_t(upperFrameIndex), uint64_t(segmentLowerFrameIndex) + uint64_t(segmentSize + segmentOverlap - 1u)));
+
+		if (upperFrameIndex - segmentUpperFrameIndex <= segmentOverlap)
+		{
+			// we avoid a tiny last segment which would not have any frame on its own
+			segmentUpperFrameIndex = upperFrameIndex;
+		}
+
+		segments.emplace_back(segmentLowerFrameIndex, segmentUpperFrameIndex);
+
+		if (segmentUpperFrameIndex == upperFrameIndex)
+		{
+			break;
+		}
+	}
+
+	Log::info() << "Determining point paths in " << segments.size() << " segments";
+
+	std::vector<Database> segmentDatabases(segments.size());
+	std::vector<uint8_t> segmentResults(segments.size(), 0u);
+
+	// each segment is tracked on one thread, the frame provider decodes the frames of all segments concurrently
+
+	if (worker != nullptr && segments.size() >= 2)
+	{
+		worker->executeFunction(Worker::Function::createStatic(&PointPaths::determinePointPathsSegmentsSubset, &frameProviderInterface, pixelFormat, pixelOrigin, &trackingConfiguration, (const IndexPairs32*)(&segments), invalidBorderSize, &checkpointDirectory, segmentDatabases.data(), segmentResults.data(), abort, 0u, 0u), 0u, (unsigned int)(segments.size()));
+	}
+	else
+	{
+		for (unsigned int nSegment = 0u; nSegment < (unsigned int)(segments.size()); ++nSegment)
+		{
+			determinePointPathsSegmentsSubset(&frameProviderInterface, pixelFormat, pixelOrigin, &trackingConfiguration, &segments, invalidBorderSize, &checkpointDirectory, segmentDatabases.data(), segmentResults.data(), abort, nSegment, 1u);
+
+			if (progress)
+			{
+				*progress = Scalar(0.95) * Scalar(nSegment + 1u) / Scalar(segments.size());
+			}
+		}
+	}
+
+	if (abort && *abort)
+	{
+		return false;
+	}
+
+	for (const uint8_t segmentResult : segmentResults)
+	{
+		if (segmentResult == 0u)
+		{
+			return false;
+		}
+	}
+
+	// now we stitch the point paths of all segments, neighboring segments are stitched in the frames they share
+
+	for (size_t nSegment = 0; nSegment < segments.size(); ++nSegment)
+	{
+		const unsigned int overlapLowerFrameIndex = segments[nSegment].first;
+		const unsigned int overlapUpperFrameIndex = nSegment == 0 ? (unsigned int)(-1) : segments[nSegment - 1].second;
+
+		const size_t stitchedObjectPoints = stitchPointPaths(segmentDatabases[nSegment], overlapLowerFrameIndex, overlapUpperFrameIndex, database);
+
+		if (nSegment != 0)
+		{
+			Log::debug() << "Stitched " << stitchedObjectPoints << " object points between segment " << nSegment - 1 << " and " << nSegment;
+		}
+
+		// the segment is not needed anymore
+		segmentDatabases[nSegment].clear<false>();
+
+		if (progress)
+		{
+			*progress = Scalar(0.95) + Scalar(0.05) * Scalar(nSegment + 1) / Scalar(segments.size());
+		}
+	}
+
+	return true;
+}
+
+size_t PointPaths::stitchPointPaths(const Database& segmentDatabase, const unsigned int overlapLowerFrameIndex, const unsigned int overlapUpperFrameIndex, Database& database, const Scalar maximalSqrDistance)
+{
+	ocean_assert(maximalSqrDistance >= 0);
+
+	// first, we determine the object points of the segment which correspond to object points of the database
+
+	std::unordered_map<Index32, Index32> segmentObjectPointId2ObjectPointId;
+	UnorderedIndexSet32 usedObjectPointIds;
+
+	if (overlapUpperFrameIndex != (unsigned int)(-1))
+	{
+		ocean_assert(overlapLowerFrameIndex <= overlapUpperFrameIndex);
+
+		Indices32 objectPointIds;
+		Indices32 segmentObjectPointIds;
+
+		for (unsigned int frameIndex = overlapLowerFrameIndex; frameIndex <= overlapUpperFrameIndex; ++frameIndex)
+		{
+			if (!database.hasPose<false>(frameIndex) || !segmentDatabase.hasPose<false>(frameIndex))
+			{
+				continue;
+			}
+
+			objectPointIds.clear();
+			const Vectors2 imagePoints = database.imagePointsWithObjectPoints<false>(frameIndex, objectPointIds);
+
+			segmentObjectPointIds.clear();
+			const Vectors2 segmentImagePoints = segmentDatabase.imagePointsWithObjectPoints<false>(frameIndex, segmentObjectPointIds);
+
+			for (size_t nSegment = 0; nSegment < segmentImagePoints.size(); ++nSegment)
+			{
+				const Index32 segmentObjectPointId = segmentObjectPointIds[nSegment];
+
+				if (segmentObjectPointId2ObjectPointId.find(segmentObjectPointId) != segmentObjectPointId2ObjectPointId.cend())
+				{
+					// the object point has been stitched in a previous frame already
+					continue;
+				}
+
+				const Vector2& segmentImagePoint = segmentImagePoints[nSegment];
+
+				Index32 bestObjectPointId = Database::invalidId;
+				Scalar bestSqrDistance = Numeric::maxValue();
+
+				for (size_t n = 0; n < imagePoints.size(); ++n)
+				{
+					const Scalar sqrDistance = imagePoints[n].sqrDistance(segmentImagePoint);
+
+					if (sqrDistance < bestSqrDistance && usedObjectPointIds.find(objectPointIds[n]) == usedObjectPointIds.cend())
+					{
+						bestSqrDistance = sqrDistance;
+						bestObjectPointId = objectPointIds[n];
+					}
+				}
+
+				if (bestSqrDistance > maximalSqrDistance)
+				{
+					continue;
+				}
+
+				// both paths must be consistent in all frames both object points are visible
+
+				bool consistent = true;
+
+				for (unsigned int checkFrameIndex = frameIndex + 1u; consistent && checkFrameIndex <= overlapUpperFrameIndex; ++checkFrameIndex)
+				{
+					Vector2 imagePoint;
+					Vector2 checkSegmentImagePoint;
+
+					if (database.hasPose<false>(checkFrameIndex) && segmentDatabase.hasPose<false>(checkFrameIndex)
+							&& database.hasObservation<false>(checkFrameIndex, bestObjectPointId, &imagePoint) && segmentDatabase.hasObservation<false>(checkFrameIndex, segmentObjectPointId, &checkSegmentImagePoint))
+					{
+						consistent = imagePoint.sqrDistance(checkSegmentImagePoint) <= maximalSqrDistance;
+					}
+				}
+
+				if (consistent)
+				{
+					segmentObjectPointId2ObjectPointId.emplace(segmentObjectPointId, bestObjectPointId);
+					usedObjectPointIds.emplace(bestObjectPointId);
+				}
+			}
+		}
+	}
+
+	// now we add all poses and point paths of the segment
+
+	const Indices32 segmentPoseIds = segmentDatabase.poseIds<false>();
+
+	for (const Index32 segmentPoseId : segmentPoseIds)
+	{
+		if (!database.hasPose<false>(segmentPoseId))
+		{
+			database.addPose<false>(segmentPoseId);
+		}
+	}
+
+	const Indices32 segmentObjectPointIds = segmentDatabase.objectPointIds<false>();
+
+	Indices32 poseIds;
+	Indices32 imagePointIds;
+	Vectors2 imagePoints;
+
+	for (const Index32 segmentObjectPointId : segmentObjectPointIds)
+	{
+		const std::unordered_map<Index32, Index32>::const_iterator iObjectPoint = segmentObjectPointId2ObjectPointId.find(segmentObjectPointId);
+
+		if (iObjectPoint == segmentObjectPointId2ObjectPointId.cend())
+		{
+			database.addObjectPointFromDatabase(segmentDatabase, segmentObjectPointId);
+			continue;
+		}
+
+		// the object point exists already, so we extend the existing path with all observations which are not yet known
+
+		const Index32 objectPointId = iObjectPoint->second;
+
+		poseIds.clear();
+		imagePointIds.clear();
+		imagePoints.clear();
+		segmentDatabase.observationsFromObjectPoint<false>(segmentObjectPointId, poseIds, imagePointIds, &imagePoints);
+
+		for (size_t n = 0; n < poseIds.size(); ++n)
+		{
+			if (!database.hasObservation<false>(poseIds[n], objectPointId))
+			{
+				const Index32 imagePointId = database.addImagePoint<false>(imagePoints[n]);
+
+				database.attachImagePointToPose<false>(imagePointId, poseIds[n]);
+				database.attachImagePointToObjectPoint<false>(imagePointId, objectPointId);
+			}
+		}
+	}
+
+	return segmentObjectPointId2ObjectPointId.size();
+}
+
 bool PointPaths::determineTrackingConfiguration(CV::FrameProviderInterface& frameProviderInterface, const CV::SubRegion& regionOfInterest, const OfflineTracker::TrackingQuality trackingQuality, const MotionSpeed motionSpeed, TrackingConfiguration* frameTrackingConfiguration, TrackingConfiguration* regionOfInterestTrackingConfiguration, bool* abort)
 {
 	ocean_assert(regionOfInterest.isEmpty() || regionOfInterestTrackingConfiguration);
@@ -1865,6 +2116,164 @@ void PointPaths::idealPyramidParameters(const unsigned int width, const unsigned
 	ocean_assert(coarsestLayerRadius <= maximalCoarsestLayerRadius);
 }
 
+void PointPaths::determinePointPathsSegmentsSubset(CV::FrameProviderInterface* frameProviderInterface, const FrameType::PixelFormat pixelFormat, const FrameType::PixelOrigin pixelOrigin, const TrackingConfiguration* trackingConfiguration, const IndexPairs32* segments, const unsigned int invalidBorderSize, const std::string* checkpointDirectory, Database* segmentDatabases, uint8_t* segmentResults, bool* abort, const unsigned int firstSegment, const unsigned int numberSegments)
+{
+	ocean_assert(frameProviderInterface != nullptr && trackingConfiguration != nullptr && segments != nullptr && checkpointDirectory != nullptr);
+	ocean_assert(segmentDatabases != nullptr && segmentResults != nullptr);
+	ocean_assert(firstSegment + numberSegments <= segments->size());
+
+	for (unsigned int nSegment = firstSegment; nSegment < firstSegment + numberSegments && (!abort || !*abort); ++nSegment)
+	{
+		const unsigned int segmentLowerFrameIndex = (*segments)[nSegment].first;
+		const unsigned int segmentUpperFrameIndex = (*segments)[nSegment].second;
+
+		Database& segmentDatabase = segmentDatabases[nSegment];
+
+		std::string checkpointFilename;
+
+		if (!checkpointDirectory->empty())
+		{
+			checkpointFilename = (IO::Directory(*checkpointDirectory) + IO::File("pointpaths_" + String::toAString(segmentLowerFrameIndex) + "_" + String::toAString(segmentUpperFrameIndex) + ".ocnpp"))();
+
+			if (readSegmentCheckpoint(checkpointFilename, *trackingConfiguration, segmentLowerFrameIndex, segmentUpperFrameIndex, invalidBorderSize, segmentDatabase))
+			{
+				Log::info() << "Resuming segment [" << segmentLowerFrameIndex << ", " << segmentUpperFrameIndex << "] from checkpoint";
+
+				segmentResults[nSegment] = 1u;
+				continue;
+			}
+
+			// the checkpoint is invalid or has been written only partially
+			segmentDatabase.clear<false>();
+		}
+
+		// the segment is tracked on this thread only, as the worker is busy with the segments
+
+		if (!determinePointPaths(*frameProviderInterface, pixelFormat, pixelOrigin, *trackingConfiguration, segmentLowerFrameIndex, segmentLowerFrameIndex, segmentUpperFrameIndex, invalidBorderSize, false /*onlyNewObjectPoints*/, segmentDatabase, nullptr /*worker*/, abort))
+		{
+			continue;
+		}
+
+		if (abort && *abort)
+		{
+			break;
+		}
+
+		if (!checkpointFilename.empty() && !writeSegmentCheckpoint(checkpointFilename, *trackingConfiguration, segmentLowerFrameIndex, segmentUpperFrameIndex, invalidBorderSize, segmentDatabase))
+		{
+			Log::warning() << "Failed to write the checkpoint '" << checkpointFilename << "'";
+		}
+
+		segmentResults[nSegment] = 1u;
+	}
+}
+
+bool PointPaths::writeSegmentCheckpoint(const std::string& filename, const TrackingConfiguration& trackingConfiguration, const unsigned int lowerFrameIndex, const unsigned int upperFrameIndex, const unsigned int invalidBorderSize, const Database& database)
+{
+	ocean_assert(!filename.empty());
+	ocean_assert(lowerFrameIndex <= upperFrameIndex);
+
+	const std::string temporaryFilename = filename + ".tmp";
+
+	{
+		std::ofstream stream(temporaryFilename.c_str(), std::ios::binary);
+		IO::OutputBitstream outputBitstream(stream);
+
+		if (!outputBitstream.write<std::string>("OCN_POINT_PATHS_SEGMENT"))
+		{
+			return false;
+		}
+
+		constexpr unsigned int version = 1u;
+
+		if (!outputBitstream.write<unsigned int>(version))
+		{
+			return false;
+		}
+
+		if (!outputBitstream.write<unsigned int>(lowerFrameIndex) || !outputBitstream.write<unsigned int>(upperFrameIndex) || !outputBitstream.write<unsigned int>(invalidBorderSize))
+		{
+			return false;
+		}
+
+		if (!outputBitstream.write<unsigned int>((unsigned int)(trackingConfiguration.trackingMethod())) || !outputBitstream.write<unsigned int>(trackingConfiguration.horizontalBinSize()) || !outputBitstream.write<unsigned int>(trackingConfiguration.verticalBinSize())
+				|| !outputBitstream.write<unsigned int>(trackingConfiguration.strength()) || !outputBitstream.write<unsigned int>(trackingConfiguration.coarsestLayerRadius()) || !outputBitstream.write<unsigned int>(trackingConfiguration.pyramidLayers()))
+		{
+			return false;
+		}
+
+		if (!Utilities::writeDatabase(database, outputBitstream))
+		{
+			return false;
+		}
+
+		if (!stream.good())
+		{
+			return false;
+		}
+	}
+
+	// the checkpoint becomes visible only after it has been written entirely
+
+	std::remove(filename.c_str());
+
+	return std::rename(temporaryFilename.c_str(), filename.c_str()) == 0;
+}
+
+bool PointPaths::readSegmentCheckpoint(const std::string& filename, const TrackingConfiguration& trackingConfiguration, const unsigned int lowerFrameIndex, const unsigned int upperFrameIndex, const unsigned int invalidBorderSize, Database& database)
+{
+	ocean_assert(!filename.empty());
+	ocean_assert(database.isEmpty<false>());
+
+	if (!IO::File(filename).exists())
+	{
+		return false;
+	}
+
+	std::ifstream stream(filename.c_str(), std::ios::binary);
+	IO::InputBitstream inputBitstream(stream);
+
+	std::string tag;
+	if (!inputBitstream.read<std::string>(tag) || tag != "OCN_POINT_PATHS_SEGMENT")
+	{
+		return false;
+	}
+
+	unsigned int version = 0u;
+	if (!inputBitstream.read<unsigned int>(version) || version != 1u)
+	{
+		return false;
+	}
+
+	unsigned int values[9] = {};
+
+	for (unsigned int& value : values)
+	{
+		if (!inputBitstream.read<unsigned int>(value))
+		{
+			return false;
+		}
+	}
+
+	const unsigned int expectedValues[9] =
+	{
+		lowerFrameIndex, upperFrameIndex, invalidBorderSize,
+		(unsigned int)(trackingConfiguration.trackingMethod()), trackingConfiguration.horizontalBinSize(), trackingConfiguration.verticalBinSize(),
+		trackingConfiguration.strength(), trackingConfiguration.coarsestLayerRadius(), trackingConfiguration.pyramidLayers()
+	};
+
+	for (unsigned int n = 0u; n < 9u; ++n)
+	{
+		if (values[n] != expectedValues[n])
+		{
+			// the checkpoint has been created for a different segment or with a different configuration
+			return false;
+		}
+	}
+
+	return Utilities::readDatabase(inputBitstream, database);
+}
+
 bool PointPaths::trackPoints(const CV::FramePyramid& previousFramePyramid, const CV::FramePyramid& currentFramePyramid, const unsigned int coarsestLayerRadius, const Strengths& /*previousFeatureStrengths*/, const TrackingMethod trackingMethod, Vectors2& previousFeaturePoints, Vectors2& currentFeaturePoints, Indices32& validIndices, Worker* worker)
 {
 	if (previousFeaturePoints.empty())
@@ -251,6 +251,42 @@ class OCEAN_TRACKING_OFFLINE_EXPORT PointPaths
 		 */
 		static bool determinePointPaths(CV::FrameProviderInterface& frameProviderInterface, const FrameType::PixelFormat pixelFormat, const FrameType::PixelOrigin pixelOrigin, const TrackingConfiguration& trackingConfiguration, const unsigned int lowerFrameIndex, const CV::SubRegion& subRegion, const unsigned int subRegionFrameIndex, const unsigned int upperFrameIndex, const unsigned int invalidBorderSize, const bool onlyNewObjectPoints, Database& database, Worker* worker = nullptr, bool* abort = nullptr, Scalar* progress = nullptr);
 
+		/**
+		 * Tracks reliable points between successive frames like determinePointPaths(), but splits the frame range into overlapping segments which are tracked concurrently.
+		 * Each segment is tracked into an individual database, afterwards the point paths of neighboring segments are stitched in the frames both segments share.<br>
+		 * If a checkpoint directory is specified, the point paths of each segment are written to the directory as soon as the segment has been tracked.<br>
+		 * Segments with a valid checkpoint (same frame range and tracking configuration) are not tracked again, so that an aborted or crashed job can be resumed.
+		 * @param frameProviderInterface The frame provider interface which is used to extract the individual frames, must be valid, must be initialized, and must be able to handle concurrent requests
+		 * @param pixelFormat The pixel format which is used for each frame
+		 * @param pixelOrigin The pixel origin which is used for each frame
+		 * @param trackingConfiguration The tracking configuration that is applied to track the points
+		 * @param lowerFrameIndex The index of the lower frame which will be used for tracking
+		 * @param upperFrameIndex The index of the upper frame which will be used for tracking, with range [lowerFrame, infinity)
+		 * @param invalidBorderSize The border size at the outer frame border in which tracked points will count as invalid, in pixel, with range [0, min(width / 2, height / 2))
+		 * @param database The resulting database holding the object points, image points and camera poses after tracking, should be empty
+		 * @param segmentSize The number of frames between the first frames of two neighboring segments, with range [2, infinity)
+		 * @param segmentOverlap The number of frames two neighboring segments share, with range [1, segmentSize)
+		 * @param checkpointDirectory Optional directory in which the point paths of the individual segments will be stored, must exist, an empty string to avoid checkpoints
+		 * @param worker Optional worker object to track the individual segments concurrently
+		 * @param abort Optional abort statement allowing to stop the execution; True, if the execution has to stop
+		 * @param progress Optional resulting progress with range [0, 1]
+		 * @return True, if succeeded
+		 * @see stitchPointPaths().
+		 */
+		static bool determinePointPathsSegmented(CV::FrameProviderInterface& frameProviderInterface, const FrameType::PixelFormat pixelFormat, const FrameType::PixelOrigin pixelOrigin, const TrackingConfiguration& trackingConfiguration, const unsigned int lowerFrameIndex, const unsigned int upperFrameIndex, const unsigned int invalidBorderSize, Database& database, const unsigned int segmentSize = 300u, const unsigned int segmentOverlap = 10u, const std::string& checkpointDirectory = std::string(), Worker* worker = nullptr, bool* abort = nullptr, Scalar* progress = nullptr);
+
+		/**
+		 * Stitches the point paths of a segment to the point paths of a database.
+		 * Object points of the segment which are observed at the same location as an object point of the database in the overlapping frames are merged, all remaining object points are added as new object points.
+		 * @param segmentDatabase The database holding the point paths of the segment
+		 * @param overlapLowerFrameIndex The index of the first frame both databases share, with range [0, infinity)
+		 * @param overlapUpperFrameIndex The index of the last frame both databases share, with range [overlapLowerFrameIndex, infinity), (unsigned int)(-1) if both databases do not share any frame
+		 * @param database The database to which the point paths of the segment will be added
+		 * @param maximalSqrDistance The maximal square distance between two image points so that the corresponding object points count as identical, in (pixel * pixel), with range [0, infinity)
+		 * @return The number of object points of the segment which have been merged with existing object points
+		 */
+		static size_t stitchPointPaths(const Database& segmentDatabase, const unsigned int overlapLowerFrameIndex, const unsigned int overlapUpperFrameIndex, Database& database, const Scalar maximalSqrDistance = Scalar(1));
+
 		/**
 		 * Determines the tracking configuration for an explicit specified tracking quality.
 		 * @param frameProviderInterface The frame provider interface providing the frame access
@@ -309,6 +345,49 @@ class OCEAN_TRACKING_OFFLINE_EXPORT PointPaths
 
 	protected:
 
+		/**
+		 * Tracks a subset of segments, this function is called by determinePointPathsSegmented().
+		 * @param frameProviderInterface The frame provider interface which is used to extract the individual frames, must be valid
+		 * @param pixelFormat The pixel format which is used for each frame
+		 * @param pixelOrigin The pixel origin which is used for each frame
+		 * @param trackingConfiguration The tracking configuration that is applied to track the points, must be valid
+		 * @param segments The frame ranges of all segments, each pair holds the lower and upper frame index, must be valid
+		 * @param invalidBorderSize The border size at the outer frame border in which tracked points will count as invalid, in pixel
+		 * @param checkpointDirectory The directory in which the point paths of the individual segments will be stored, an empty string to avoid checkpoints, must be valid
+		 * @param segmentDatabases The resulting databases, one for each segment, must be valid
+		 * @param segmentResults The resulting states of the segments, one for each segment, 1 if the segment succeeded, must be valid
+		 * @param abort Optional abort statement allowing to stop the execution; True, if the execution has to stop
+		 * @param firstSegment The first segment to be handled
+		 * @param numberSegments The number of segments to be handled
+		 */
+		static void determinePointPathsSegmentsSubset(CV::FrameProviderInterface* frameProviderInterface, const FrameType::PixelFormat pixelFormat, const FrameType::PixelOrigin pixelOrigin, const TrackingConfiguration* trackingConfiguration, const IndexPairs32* segments, const unsigned int invalidBorderSize, const std::string* checkpointDirectory, Database* segmentDatabases, uint8_t* segmentResults, bool* abort, const unsigned int firstSegment, const unsigned int numberSegments);
+
+		/**
+		 * Writes the point paths of one segment to a checkpoint file.
+		 * The file is written to a temporary file first and renamed afterwards, so that an interrupted write never results in a corrupted checkpoint.
+		 * @param filename The name of the checkpoint file, must be valid
+		 * @param trackingConfiguration The tracking configuration which has been used to track the segment
+		 * @param lowerFrameIndex The index of the first frame of the segment
+		 * @param upperFrameIndex The index of the last frame of the segment, with range [lowerFrameIndex, infinity)
+		 * @param invalidBorderSize The border size which has been used to track the segment
+		 * @param database The database holding the point paths of the segment
+		 * @return True, if succeeded
+		 */
+		static bool writeSegmentCheckpoint(const std::string& filename, const TrackingConfiguration& trackingConfiguration, const unsigned int lowerFrameIndex, const unsigned int upperFrameIndex, const unsigned int invalidBorderSize, const Database& database);
+
+		/**
+		 * Reads the point paths of one segment from a checkpoint file.
+		 * The checkpoint is accepted only if it has been created for the same segment with the same tracking configuration.
+		 * @param filename The name of the checkpoint file, must be valid
+		 * @param trackingConfiguration The tracking configuration which is used to track the segment
+		 * @param lowerFrameIndex The index of the first frame of the segment
+		 * @param upperFrameIndex The index of the last frame of the segment, with range [lowerFrameIndex, infinity)
+		 * @param invalidBorderSize The border size which is used to track the segment
+		 * @param database The resulting database holding the point paths of the segment, must be empty
+		 * @return True, if the checkpoint exists and is valid
+		 */
+		static bool readSegmentCheckpoint(const std::string& filename, const TrackingConfiguration& trackingConfiguration, const unsigned int lowerFrameIndex, const unsigned int upperFrameIndex, const unsigned int invalidBorderSize, Database& database);
+
 		/**
 		 * Applies a bidirectional tracking of points between to frames.
 		 * @param previousFramePyramid The frame pyramid of the previous frame, must be valid
@@ -171,6 +171,27 @@ bool SLAMTracker::setRegionOfInterest(const CV::SubRegion& regionOfInterest, con
 	return true;
 }
 
+bool SLAMTracker::setPointPathSegmentation(const unsigned int segmentSize, const unsigned int segmentOverlap, const std::string& checkpointDirectory)
+{
+	const ScopedLock scopedLock(lock_);
+
+	if (running())
+	{
+		return false;
+	}
+
+	if (segmentSize != 0u && (segmentSize < 2u || segmentOverlap == 0u || segmentOverlap >= segmentSize))
+	{
+		return false;
+	}
+
+	pointPathSegmentSize_ = segmentSize;
+	pointPathSegmentOverlap_ = segmentOverlap;
+	pointPathCheckpointDirectory_ = checkpointDirectory;
+
+	return true;
+}
+
 bool SLAMTracker::extractPoses(const unsigned int lowerFrameIndex, const unsigned int upperFrameIndex, OfflinePoses& offlinePoses, const unsigned int minimalCorrespondences, const Geometry::Estimator::EstimatorType estimator, const Scalar minimalValidCorrespondenceRatio, const Scalar ransacMaximalSqrError, const Scalar maximalRobustError, Scalar* finalAverageError, Worker* worker, bool* abort) const
 {
 	ocean_assert(lowerFrameIndex <= upperFrameIndex);
@@ -523,6 +544,9 @@ bool SLAMTracker::applyFrameTracking(const FrameType& frameType)
 
 	Log::info() << "Starting point path determination";
 
+	// we measure the duration of each individual stage to provide a timing breakdown once the tracking has finished
+	HighPerformanceTimer stageTimer;
+
 	PointPaths::TrackingConfiguration regionOfInterestTrackingConfiguration, frameTrackingConfiguration;
 
 	localProgress_ = 0;
@@ -638,20 +662,34 @@ bool SLAMTracker::applyFrameTracking(const FrameType& frameType)
 
 		Log::info() << "Determining point paths in entire area with " << frameTrackingConfiguration.horizontalBinSize() << "x" << frameTrackingConfiguration.verticalBinSize() << " bins " << frameTrackingConfiguration.strength() << " minimal strength and " << frameTrackingConfiguration.trackingMethod() << " as tracking method";
 
-		if (!PointPaths::determinePointPaths(*frameProviderInterface_, FrameType::FORMAT_RGB24, FrameType::ORIGIN_UPPER_LEFT, frameTrackingConfiguration, lowerFrameIndex_, (useRegionOfInterest && startFrameIndex_ != (unsigned int)(-1)) ? startFrameIndex_ : lowerFrameIndex_, upperFrameIndex_, invalidBorderSize, true, database_, WorkerPool::get().scopedWorker()(), &shouldStop_, &localProgress_))
+		if (!useRegionOfInterest && pointPathSegmentSize_ != 0u && upperFrameIndex_ - lowerFrameIndex_ >= pointPathSegmentSize_ + pointPathSegmentOverlap_)
+		{
+			// long sequences are split into segments which are tracked concurrently
+
+			if (!PointPaths::determinePointPathsSegmented(*frameProviderInterface_, FrameType::FORMAT_RGB24, FrameType::ORIGIN_UPPER_LEFT, frameTrackingConfiguration, lowerFrameIndex_, upperFrameIndex_, invalidBorderSize, database_, pointPathSegmentSize_, pointPathSegmentOverlap_, pointPathCheckpointDirectory_, WorkerPool::get().scopedWorker()(), &shouldStop_, &localProgress_))
+			{
+				Log::error() << "determinePointPathsSegmented() FAILED!";
+				return false;
+			}
+		}
+		else if (!PointPaths::determinePointPaths(*frameProviderInterface_, FrameType::FORMAT_RGB24, FrameType::ORIGIN_UPPER_LEFT, frameTrackingConfiguration, lowerFrameIndex_, (useRegionOfInterest && startFrameIndex_ != (unsigned int)(-1)) ? startFrameIndex_ : lowerFrameIndex_, upperFrameIndex_, invalidBorderSize, true, database_, WorkerPool::get().scopedWorker()(), &shouldStop_, &localProgress_))
 		{
 			Log::error() << "determinePointPaths() FAILED!";
 			return false;
 		}
 	}
 
-	Log::info() << "Finished point path determination";
+	const double pointPathSeconds = stageTimer.seconds();
+
+	Log::info() << "Finished point path determination in " << pointPathSeconds << "s";
 
 	Log::info() << "Starting SLAM Tracker with a camera with " << Numeric::rad2deg(camera_.fovX()) << "deg field of view:";
 
 	scopedProgress.modify(Scalar(0.80));
 	localProgress_ = 0;
 
+	stageTimer.start();
+
 	unsigned int lowerPoseBorder, upperPoseBorder;
 	if (!determineInitialObjectPoints(camera_, database_, randomGenerator, lowerFrameIndex_, startFrameIndex_ != (unsigned int)(-1) ? &startFrameIndex_ : nullptr, upperFrameIndex_, useRegionOfInterest ? regionOfInterest_ : CV::SubRegion(), soleRegionOfInterestApplication_, &lowerPoseBorder, &upperPoseBorder, &shouldStop_, &localProgress_))
 	{
@@ -659,11 +697,15 @@ bool SLAMTracker::applyFrameTracking(const FrameType& frameType)
 		return false;
 	}
 
+	const double initialObjectPointsSeconds = stageTimer.seconds();
+
 	maintenanceSendEnvironment();
 
 	scopedProgress.modify(Scalar(0.85));
 	localProgress_ = 0;
 
+	stageTimer.start();
+
 	unsigned int maximalValidInitialCorrespondences = 0u;
 	database_.poseWithMostCorrespondences<false, false, true>(lowerFrameIndex_, upperFrameIndex_, nullptr, &maximalValidInitialCorrespondences);
 	ocean_assert(maximalValidInitialCorrespondences != 0u);
@@ -680,6 +722,8 @@ bool SLAMTracker::applyFrameTracking(const FrameType& frameType)
 		return false;
 	}
 
+	const double extendInitialObjectPointsSeconds = stageTimer.seconds();
+
 	maintenanceSendEnvironment();
 
 	const bool findInitialFieldOfView = cameraOptimizationStrategy_ != PinholeCamera::OS_NONE && cameraFieldOfView_ < 0;
@@ -691,6 +735,8 @@ bool SLAMTracker::applyFrameTracking(const FrameType& frameType)
 	scopedProgress.modify(Scalar(0.90));
 	localProgress_ = 0;
 
+	stageTimer.start();
+
 	Scalar optimizedCameraFinalSqrError;
 	if (optimizeCamera(camera_, database_, lowerFrameIndex_, upperFrameIndex_, findInitialFieldOfView, cameraOptimizationStrategy_, min(25u, frameRangeNumber), optimizedCamera, optimizedDatabase, &cameraMotion, &shouldStop_, &optimizedCameraFinalSqrError))
 	{
@@ -721,15 +767,21 @@ bool SLAMTracker::applyFrameTracking(const FrameType& frameType)
 		}
 	}
 
+	const double cameraOptimizationSeconds = stageTimer.seconds();
+
 	scopedProgress.modify(Scalar(0.95));
 	localProgress_ = 0;
 
+	stageTimer.start();
+
 	if (!extendStableObjectPoints(camera_, database_, randomGenerator, lowerFrameIndex_, upperFrameIndex_, cameraMotion, Solver3::RelativeThreshold(10u, Scalar(0.4), 25u), &lowerPoseBorder, &upperPoseBorder, &cameraMotion_, &shouldStop_, &localProgress_))
 	{
 		Log::error() << "extendStableObjectPoints() FAILED!";
 		return false;
 	}
 
+	const double extendStableObjectPointsSeconds = stageTimer.seconds();
+
 	Index32 validLowerPoseIndex, validUpperPoseIndex;
 	if (database_.largestValidPoseRange<false>(lowerFrameIndex_, upperFrameIndex_, validLowerPoseIndex, validUpperPoseIndex))
 	{
@@ -743,6 +795,13 @@ bool SLAMTracker::applyFrameTracking(const FrameType& frameType)
 	Log::info() << "Camera Intrinsic: " << camera_.focalLengthX() << ", " << camera_.focalLengthY() << ", " << camera_.principalPointX() << ", " << camera_.principalPointY();
 	Log::info() << "Camera Distortion: " << camera_.radialDistortion().first << ", " << camera_.radialDistortion().second << ", " << camera_.tangentialDistortion().first << ", " << camera_.tangentialDistortion().second;
 	Log::info() << " ";
+	Log::info() << "Timing of the individual stages:";
+	Log::info() << "Point paths: " << pointPathSeconds << "s";
+	Log::info() << "Initial object points: " << initialObjectPointsSeconds << "s";
+	Log::info() << "Extension of initial object points: " << extendInitialObjectPointsSeconds << "s";
+	Log::info() << "Camera optimization: " << cameraOptimizationSeconds << "s";
+	Log::info() << "Extension of stable object points: " << extendStableObjectPointsSeconds << "s";
+	Log::info() << " ";
 	Log::info() << "*** FINISHED TRACKING ***";
 
 	if (Maintenance::get().isActive())
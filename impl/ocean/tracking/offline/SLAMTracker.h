@@ -211,6 +211,17 @@ class OCEAN_TRACKING_OFFLINE_EXPORT SLAMTracker : public FrameTracker
 		 */
 		bool setRegionOfInterest(const CV::SubRegion& regionOfInterest, const bool soleApplication);
 
+		/**
+		 * Enables the segmented determination of point paths for long sequences.
+		 * The frame range is split into overlapping segments which are tracked concurrently and stitched afterwards, see PointPaths::determinePointPathsSegmented().<br>
+		 * The segmentation is applied if the tracker does not use a region of interest, the segmentation cannot be set if the tracker is active.
+		 * @param segmentSize The number of frames between the first frames of two neighboring segments, with range [2, infinity), 0 to disable the segmentation
+		 * @param segmentOverlap The number of frames two neighboring segments share, with range [1, segmentSize)
+		 * @param checkpointDirectory Optional directory in which the point paths of each segment will be stored so that an aborted job can be resumed, an empty string to avoid checkpoints
+		 * @return True, if succeeded
+		 */
+		bool setPointPathSegmentation(const unsigned int segmentSize, const unsigned int segmentOverlap = 10u, const std::string& checkpointDirectory = std::string());
+
 		/**
 		 * Extracts the poses from this tracker for a specified frame range not considering any specific region of interest.
 		 * Beware: The tracker must have finished before calling this function!<br>
@@ -696,6 +707,15 @@ class OCEAN_TRACKING_OFFLINE_EXPORT SLAMTracker : public FrameTracker
 		// True, if the tracker uses only the region of interest and not the remaining frame information for tracking
 		bool soleRegionOfInterestApplication_ = false;
 
+		/// The number of frames between the first frames of two neighboring point path segments, 0 to determine the point paths in one piece.
+		unsigned int pointPathSegmentSize_ = 0u;
+
+		/// The number of frames two neighboring point path segments share.
+		unsigned int pointPathSegmentOverlap_ = 10u;
+
+		/// The directory in which the point paths of each segment are stored, empty to avoid checkpoints.
+		std::string pointPathCheckpointDirectory_;
+
 		/// The progress of this tracker for the current sub-task, with range [0, 1], -1 if undefined.
 		Scalar localProgress_ = Scalar(-1);
 
@@ -26,8 +26,6 @@
 
 #include "ocean/media/Utilities.h"
 
-#include "ocean/tracking/UnidirectionalCorrespondences.h"
-
 namespace Ocean
 {
 
@@ -97,6 +95,69 @@ void PatternTrackerCore6DOF::Pattern::reset()
 	poseGuessTimestamp_.toInvalid();
 }
 
+PatternTrackerCore6DOF::DescriptorIndex::DescriptorIndex(const PatternMap& patternMap, RandomGenerator& randomGenerator, Worker* worker)
+{
+	size_t numberDescriptors = 0;
+
+	for (const PatternMap::value_type& patternPair : patternMap)
+	{
+		numberDescriptors += patternPair.second.featureMap().descriptors().size() * 3;
+	}
+
+	descriptors_.reserve(numberDescriptors);
+	descriptorOrigins_.reserve(numberDescriptors);
+
+	for (const PatternMap::value_type& patternPair : patternMap)
+	{
+		const Descriptors& patternDescriptors = patternPair.second.featureMap().descriptors();
+
+		for (size_t nFeature = 0; nFeature < patternDescriptors.size(); ++nFeature)
+		{
+			const Descriptor& patternDescriptor = patternDescriptors[nFeature];
+
+			for (unsigned int nLevel = 0u; nLevel < patternDescriptor.descriptorLevels(); ++nLevel)
+			{
+				descriptors_.push_back(patternDescriptor.data()[nLevel]);
+				descriptorOrigins_.emplace_back(patternPair.first, Index32(nFeature));
+			}
+		}
+	}
+
+	if (descriptors_.empty())
+	{
+		return;
+	}
+
+	using VocabularyTree = VocabularyForest::TVocabularyTree;
+
+	const VocabularyTree::ClustersMeanFunction clustersMeanFunction = &VocabularyTree::determineClustersMeanForBinaryDescriptor<(unsigned int)(Descriptor::size() * 8)>;
+
+	vocabularyForest_ = VocabularyForest(2, descriptors_.data(), descriptors_.size(), clustersMeanFunction, VocabularyForest::Parameters(), worker, &randomGenerator);
+}
+
+void PatternTrackerCore6DOF::DescriptorIndex::matchDescriptors(const Descriptors& imagePointDescriptors, const unsigned int maximalDistance, PatternCorrespondenceMap& patternCorrespondenceMap, Worker* worker) const
+{
+	ocean_assert(isValid());
+
+	patternCorrespondenceMap.clear();
+
+	if (imagePointDescriptors.empty())
+	{
+		return;
+	}
+
+	VocabularyForest::Matches matches;
+	vocabularyForest_.matchMultiDescriptors<Descriptor, multiDescriptorFunction, VocabularyForest::MM_ALL_GOOD_LEAVES_2>(descriptors_.data(), imagePointDescriptors.data(), imagePointDescriptors.size(), maximalDistance, matches, worker);
+
+	for (const VocabularyForest::Match& match : matches)
+	{
+		ocean_assert(match.candidateDescriptorIndex() < descriptorOrigins_.size());
+		const IndexPair32& descriptorOrigin = descriptorOrigins_[match.candidateDescriptorIndex()];
+
+		patternCorrespondenceMap[descriptorOrigin.first].emplace_back(match.queryDescriptorIndex(), descriptorOrigin.second);
+	}
+}
+
 PatternTrackerCore6DOF::PatternTrackerCore6DOF(const Options& options) :
 	options_(options)
 {
@@ -151,6 +212,8 @@ unsigned int PatternTrackerCore6DOF::addPattern(const uint8_t* yFrame, const uns
 	const unsigned int patternId = patternMapIdCounter_++;
 	patternMap_[patternId] = Pattern(yFrame, width, height, yFramePaddingElements, patternDimension, worker);
 
+	descriptorIndexOutdated_ = true;
+
 	lastRecognitionPatternId_ = patternId;
 
 	return patternId;
@@ -193,6 +256,8 @@ bool PatternTrackerCore6DOF::removePattern(const unsigned int patternId)
 
 	ocean_assert(patternMap_.find(patternId) != patternMap_.end());
 
+	descriptorIndexOutdated_ = true;
+
 	return patternMap_.erase(patternId) == 1;
 }
 
@@ -202,6 +267,9 @@ bool PatternTrackerCore6DOF::removePatterns()
 
 	patternMap_.clear();
 
+	descriptorIndex_ = DescriptorIndex();
+	descriptorIndexOutdated_ = true;
+
 	return true;
 }
 
@@ -299,6 +367,9 @@ void PatternTrackerCore6DOF::reset()
 	currentFramePyramid_.clear();
 	previousFramePyramid_.clear();
 
+	currentSharedFramePyramid_ = nullptr;
+	previousSharedFramePyramid_ = nullptr;
+
 	for (PatternMap::iterator i = patternMap_.begin(); i != patternMap_.end(); ++i)
 	{
 		i->second.reset();
@@ -465,7 +536,29 @@ bool PatternTrackerCore6DOF::determinePosesWithDownsampledResolution(const bool
 		return false;
 	}
 
-	currentFramePyramid_.replace8BitPerChannel11(yFrame.constdata<uint8_t>(), yFrame.width(), yFrame.height(), yFrame.channels(), yFrame.pixelOrigin(), pyramidLayers,  yFrame.paddingElements(), true /*copyFirstLayer*/, worker, yFrame.pixelFormat(), yFrame.timestamp());
+	if (currentSharedFramePyramid_)
+	{
+		// the pyramid used the memory of a shared pyramid, so that the memory cannot be re-used
+		currentFramePyramid_.clear();
+		currentSharedFramePyramid_ = nullptr;
+	}
+
+	if (framePyramidCache_ && yFrame.pixelOrigin() == FrameType::ORIGIN_UPPER_LEFT)
+	{
+		// the pyramid may have been created already by another tracker processing the same frame
+
+		currentSharedFramePyramid_ = framePyramidCache_->pyramid(yFrame, pyramidLayers, worker);
+	}
+
+	if (currentSharedFramePyramid_)
+	{
+		// the pyramid uses the memory of the shared pyramid without copying the image content
+		currentFramePyramid_ = CV::FramePyramid(*currentSharedFramePyramid_, 0u, pyramidLayers, false /*copyData*/);
+	}
+	else
+	{
+		currentFramePyramid_.replace8BitPerChannel11(yFrame.constdata<uint8_t>(), yFrame.width(), yFrame.height(), yFrame.channels(), yFrame.pixelOrigin(), pyramidLayers,  yFrame.paddingElements(), true /*copyFirstLayer*/, worker, yFrame.pixelFormat(), yFrame.timestamp());
+	}
 
 	for (PatternMap::iterator i = patternMap_.begin(); i != patternMap_.end(); ++i)
 	{
@@ -562,6 +655,7 @@ bool PatternTrackerCore6DOF::determinePosesWithDownsampledResolution(const bool
 
 	// we use the current frame pyramid as previous frame pyramid in the next tracking iteration
 	std::swap(previousFramePyramid_, currentFramePyramid_);
+	std::swap(previousSharedFramePyramid_, currentSharedFramePyramid_);
 
 	// at this moment the previous pose is also the pose for the current frame
 	for (PatternMap::iterator i = patternMap_.begin(); i != patternMap_.end(); ++i)
@@ -1198,6 +1292,13 @@ bool PatternTrackerCore6DOF::determinePosesWithoutKnowledge(const PinholeCamera&
 		}
 	}
 
+	if (options_.minimalPatternsForDescriptorIndex_ != 0u && patternMap_.size() >= size_t(options_.minimalPatternsForDescriptorIndex_))
+	{
+		// with many patterns, one query in a shared descriptor index is significantly faster than matching each pattern individually
+
+		return determinePosesWithDescriptorIndex(pinholeCamera, yFrame, currentFramePyramid, imagePoints, imagePointDescriptors, previousCamera_R_camera_OrIdentity, recognitionStartTimestamp, worker);
+	}
+
 	Vectors2 strongHarrisCorners;
 
 	// Run detection in a round-robin manner.
@@ -1215,9 +1316,6 @@ bool PatternTrackerCore6DOF::determinePosesWithoutKnowledge(const PinholeCamera&
 	Vectors2 guessImagePoints;
 	Descriptors guessImagePointDescriptors;
 
-	Vectors2 subsetImagePoints;
-	Vectors3 subsetObjectPoints;
-
 	for (size_t index = 0; index < patternMap_.size(); ++index, ++iPattern)
 	{
 		if (index > 0 && recognitionStartTimestamp.hasTimePassed(options_.maxRecognitionTime_))
@@ -1284,98 +1382,252 @@ bool PatternTrackerCore6DOF::determinePosesWithoutKnowledge(const PinholeCamera&
 			continue;
 		}
 
-		subsetImagePoints.clear();
-		subsetObjectPoints.clear();
-		UnidirectionalCorrespondences::extractCorrespondenceElements(correspondenceCandidates, imagePointCandidates->data(), imagePointCandidates->size(), pattern.featureMap().objectPoints().data(), pattern.featureMap().objectPoints().size(), subsetImagePoints, subsetObjectPoints);
-		ocean_assert(subsetImagePoints.size() == subsetObjectPoints.size());
-
-		HomogenousMatrix4 pattern_T_camera;
-			Indices32 toto;
-		if (!Geometry::RANSAC::p3p(AnyCameraPinhole(pinholeCamera), ConstArrayAccessor<Vector3>(subsetObjectPoints), ConstArrayAccessor<Vector2>(subsetImagePoints), randomGenerator_, pattern_T_camera, 10u, true, options_.recognitionRansacIterations_, Scalar(5 * 5), &toto))
+		CV::SubRegion patternSubRegion;
+		if (!verifyPatternCandidate(pinholeCamera, yFrame, currentFramePyramid, pattern, *imagePointCandidates, *imagePointDescriptorCandidates, correspondenceCandidates, strongHarrisCorners, patternSubRegion, worker))
 		{
 			continue;
 		}
 
-		// let's apply another iteration of feature matching, now guided with the known pose - this will increase the number of feature correspondences significantly
+		if (!patternSubRegion.isEmpty() && patternMap_.size() >= 2)
+		{
+			// now we remove all features lying in the current subset
 
-		correspondenceCandidates = UnidirectionalCorrespondences::determineCorrespondingFeatures<Descriptor, unsigned int, determineDescriptorDistance>(AnyCameraPinhole(pinholeCamera), pattern_T_camera, pattern.featureMap().objectPoints().data(), pattern.featureMap().descriptors().data(), pattern.featureMap().objectPoints().size(), imagePointCandidates->data(), imagePointDescriptorCandidates->data(), imagePointCandidates->size(), maximalDescriptorDistance_, Scalar(10));
+			for (size_t n = 0; n < imagePoints.size(); ++n)
+			{
+				if (patternSubRegion.isInside(imagePoints[n]))
+				{
+					imagePoints[n] = imagePoints.back();
+					imagePointDescriptors[n] = imagePointDescriptors.back();
 
-		subsetImagePoints.clear();
-		subsetObjectPoints.clear();
-		UnidirectionalCorrespondences::extractCorrespondenceElements(correspondenceCandidates, imagePointCandidates->data(), imagePointCandidates->size(), pattern.featureMap().objectPoints().data(), pattern.featureMap().objectPoints().size(), subsetImagePoints, subsetObjectPoints);
-		ocean_assert(subsetImagePoints.size() == subsetObjectPoints.size());
+					imagePoints.pop_back();
+					imagePointDescriptors.pop_back();
+				}
+			}
+		}
 
-		Indices32 resultingValidCorrespondences;
-		if (!Geometry::RANSAC::p3p(AnyCameraPinhole(pinholeCamera), ConstArrayAccessor<Vector3>(subsetObjectPoints), ConstArrayAccessor<Vector2>(subsetImagePoints), randomGenerator_, pattern_T_camera, 10u, true, options_.recognitionRansacIterations_, Scalar(3.5 * 3.5), &resultingValidCorrespondences))
+		if (internalNumberVisiblePattern() >= internalMaxConcurrentlyVisiblePattern())
+		{
+			return true;
+		}
+	}
+
+	return true;
+}
+
+bool PatternTrackerCore6DOF::determinePosesWithDescriptorIndex(const PinholeCamera& pinholeCamera, const Frame& yFrame, const CV::FramePyramid& currentFramePyramid, const Vectors2& imagePoints, const Descriptors& imagePointDescriptors, const Quaternion& previousCamera_R_camera_OrIdentity, const Timestamp& recognitionStartTimestamp, Worker* worker)
+{
+	ocean_assert(imagePoints.size() == imagePointDescriptors.size());
+	ocean_assert(previousCamera_R_camera_OrIdentity.isValid());
+
+	if (descriptorIndexOutdated_)
+	{
+		// the index is created once after patterns have been added or removed, the creation is more expensive than one recognition attempt
+
+		descriptorIndex_ = DescriptorIndex(patternMap_, randomGenerator_, worker);
+		descriptorIndexOutdated_ = false;
+	}
+
+	if (!descriptorIndex_.isValid())
+	{
+		return false;
+	}
+
+	// one query for all patterns, the matches are grouped by pattern
+
+	DescriptorIndex::PatternCorrespondenceMap patternCorrespondenceMap;
+	descriptorIndex_.matchDescriptors(imagePointDescriptors, maximalDescriptorDistance_, patternCorrespondenceMap, worker);
+
+	using PatternCandidate = std::pair<unsigned int, UnidirectionalCorrespondences::CorrespondencePairs*>;
+	std::vector<PatternCandidate> patternCandidates;
+	patternCandidates.reserve(patternCorrespondenceMap.size());
+
+	for (DescriptorIndex::PatternCorrespondenceMap::value_type& correspondencePair : patternCorrespondenceMap)
+	{
+		if (correspondencePair.second.size() < 12)
 		{
 			continue;
 		}
 
-		if (resultingValidCorrespondences.size() < 30)
+		const PatternMap::const_iterator iPattern = patternMap_.find(correspondencePair.first);
+		ocean_assert(iPattern != patternMap_.cend());
+
+		if (iPattern == patternMap_.cend() || iPattern->second.previousPose().isValid())
 		{
 			continue;
 		}
 
-		ocean_assert(pattern_T_camera.isValid());
-		pattern.previousPose() = pattern_T_camera;
+		patternCandidates.emplace_back(correspondencePair.first, &correspondencePair.second);
+	}
+
+	// the patterns with most matches are verified first
+
+	std::sort(patternCandidates.begin(), patternCandidates.end(), [](const PatternCandidate& candidateA, const PatternCandidate& candidateB)
+	{
+		return candidateA.second->size() > candidateB.second->size() || (candidateA.second->size() == candidateB.second->size() && candidateA.first < candidateB.first);
+	});
+
+	Vectors2 strongHarrisCorners;
+
+	std::vector<CV::SubRegion> recognizedSubRegions;
 
-		Geometry::SpatialDistribution::OccupancyArray occupancyArray;
-		optimizePoseByRectification(pinholeCamera, currentFramePyramid, HomogenousMatrix4(pattern.previousPose()), pattern, pattern.previousPose(), worker, &occupancyArray);
+	UnidirectionalCorrespondences::CorrespondencePairs correspondenceCandidates;
 
-		if (occupancyArray)
+	for (size_t nCandidate = 0; nCandidate < patternCandidates.size(); ++nCandidate)
+	{
+		if (nCandidate > 0 && recognitionStartTimestamp.hasTimePassed(options_.maxRecognitionTime_))
 		{
-			const Triangles2 triangles(pattern.triangles2(pinholeCamera));
-			const CV::SubRegion subRegion(triangles2subRegion(triangles, pinholeCamera.width(), pinholeCamera.height()));
+			return true;
+		}
 
-			ocean_assert(pattern.previousPose().isValid());
+		const unsigned int patternId = patternCandidates[nCandidate].first;
+
+		lastRecognitionPatternId_ = patternId;
+
+		Pattern& pattern = patternMap_[patternId];
+
+		HomogenousMatrix4 poseGuess(false);
+		if (pattern.hasPoseGuess(poseGuess, 0.05))
+		{
+			poseGuess *= previousCamera_R_camera_OrIdentity;
+		}
+
+		const CV::SubRegion guessSubRegion = poseGuess.isValid() ? triangles2subRegion(pattern.triangles2(pinholeCamera, poseGuess), pinholeCamera.width(), pinholeCamera.height()) : CV::SubRegion();
 
-			if (strongHarrisCorners.empty())
+		correspondenceCandidates.clear();
+
+		for (const UnidirectionalCorrespondences::CorrespondencePair& correspondence : *patternCandidates[nCandidate].second)
+		{
+			const Vector2& imagePoint = imagePoints[correspondence.first];
+
+			// in case we have a rough pose, we use image features which are visible in the projected area of the pattern only
+
+			if (!guessSubRegion.isEmpty() && !guessSubRegion.isInside(imagePoint))
 			{
-				strongHarrisCorners = CV::Detector::FeatureDetector::determineHarrisPoints(yFrame.constdata<uint8_t>(), yFrame.width(), yFrame.height(), yFrame.paddingElements(), CV::SubRegion(), 0u, 0u, 15u, worker);
+				continue;
 			}
 
-			Vectors2 validPoints;
-			validPoints.reserve(strongHarrisCorners.size() / 2);
+			// image features covered by an already recognized pattern are not used
+
+			bool isCovered = false;
 
-			for (size_t n = 0; n < strongHarrisCorners.size(); ++n)
+			for (const CV::SubRegion& recognizedSubRegion : recognizedSubRegions)
 			{
-				if (occupancyArray(strongHarrisCorners[n]) && subRegion.isInside(strongHarrisCorners[n]))
+				if (recognizedSubRegion.isInside(imagePoint))
 				{
-					validPoints.push_back(strongHarrisCorners[n]);
+					isCovered = true;
+					break;
 				}
 			}
 
-			if (validPoints.empty())
+			if (!isCovered)
 			{
-				continue;
+				correspondenceCandidates.push_back(correspondence);
 			}
+		}
 
-			pattern.imagePoints() = Geometry::SpatialDistribution::distributeAndFilter(validPoints.data(), validPoints.size(), subRegion.boundingBox().left(), subRegion.boundingBox().top(), subRegion.boundingBox().width(), subRegion.boundingBox().height(), 15u, 15u);
+		if (correspondenceCandidates.size() < 12)
+		{
+			continue;
+		}
 
-			pattern.objectPoints() = Geometry::Utilities::backProjectImagePoints(pinholeCamera, pattern.previousPose(), Plane3(Vector3(0, 0, 0), Vector3(0, 1, 0)), pattern.imagePoints().data(), pattern.imagePoints().size(), pinholeCamera.hasDistortionParameters());
+		CV::SubRegion patternSubRegion;
+		if (!verifyPatternCandidate(pinholeCamera, yFrame, currentFramePyramid, pattern, imagePoints, imagePointDescriptors, correspondenceCandidates, strongHarrisCorners, patternSubRegion, worker))
+		{
+			continue;
+		}
 
-			if (patternMap_.size() >= 2)
-			{
-				// now we remove all features lying in the current subset
+		if (!patternSubRegion.isEmpty())
+		{
+			recognizedSubRegions.push_back(std::move(patternSubRegion));
+		}
 
-				for (size_t n = 0; n < imagePoints.size(); ++n)
-				{
-					if (subRegion.isInside(imagePoints[n]))
-					{
-						imagePoints[n] = imagePoints.back();
-						imagePointDescriptors[n] = imagePointDescriptors.back();
+		if (internalNumberVisiblePattern() >= internalMaxConcurrentlyVisiblePattern())
+		{
+			return true;
+		}
+	}
 
-						imagePoints.pop_back();
-						imagePointDescriptors.pop_back();
-					}
-				}
+	return true;
+}
+
+bool PatternTrackerCore6DOF::verifyPatternCandidate(const PinholeCamera& pinholeCamera, const Frame& yFrame, const CV::FramePyramid& currentFramePyramid, Pattern& pattern, const Vectors2& imagePoints, const Descriptors& imagePointDescriptors, const UnidirectionalCorrespondences::CorrespondencePairs& correspondenceCandidates, Vectors2& strongHarrisCorners, CV::SubRegion& patternSubRegion, Worker* worker)
+{
+	ocean_assert(imagePoints.size() == imagePointDescriptors.size());
+	ocean_assert(correspondenceCandidates.size() >= 12);
+	ocean_assert(!pattern.previousPose().isValid());
+
+	patternSubRegion = CV::SubRegion();
+
+	Vectors2 subsetImagePoints;
+	Vectors3 subsetObjectPoints;
+	UnidirectionalCorrespondences::extractCorrespondenceElements(correspondenceCandidates, imagePoints.data(), imagePoints.size(), pattern.featureMap().objectPoints().data(), pattern.featureMap().objectPoints().size(), subsetImagePoints, subsetObjectPoints);
+	ocean_assert(subsetImagePoints.size() == subsetObjectPoints.size());
+
+	HomogenousMatrix4 pattern_T_camera;
+	if (!Geometry::RANSAC::p3p(AnyCameraPinhole(pinholeCamera), ConstArrayAccessor<Vector3>(subsetObjectPoints), ConstArrayAccessor<Vector2>(subsetImagePoints), randomGenerator_, pattern_T_camera, 10u, true, options_.recognitionRansacIterations_, Scalar(5 * 5)))
+	{
+		return false;
+	}
+
+	// let's apply another iteration of feature matching, now guided with the known pose - this will increase the number of feature correspondences significantly
+
+	const UnidirectionalCorrespondences::CorrespondencePairs guidedCorrespondences = UnidirectionalCorrespondences::determineCorrespondingFeatures<Descriptor, unsigned int, determineDescriptorDistance>(AnyCameraPinhole(pinholeCamera), pattern_T_camera, pattern.featureMap().objectPoints().data(), pattern.featureMap().descriptors().data(), pattern.featureMap().objectPoints().size(), imagePoints.data(), imagePointDescriptors.data(), imagePoints.size(), maximalDescriptorDistance_, Scalar(10));
+
+	subsetImagePoints.clear();
+	subsetObjectPoints.clear();
+	UnidirectionalCorrespondences::extractCorrespondenceElements(guidedCorrespondences, imagePoints.data(), imagePoints.size(), pattern.featureMap().objectPoints().data(), pattern.featureMap().objectPoints().size(), subsetImagePoints, subsetObjectPoints);
+	ocean_assert(subsetImagePoints.size() == subsetObjectPoints.size());
+
+	Indices32 resultingValidCorrespondences;
+	if (!Geometry::RANSAC::p3p(AnyCameraPinhole(pinholeCamera), ConstArrayAccessor<Vector3>(subsetObjectPoints), ConstArrayAccessor<Vector2>(subsetImagePoints), randomGenerator_, pattern_T_camera, 10u, true, options_.recognitionRansacIterations_, Scalar(3.5 * 3.5), &resultingValidCorrespondences))
+	{
+		return false;
+	}
+
+	if (resultingValidCorrespondences.size() < 30)
+	{
+		return false;
+	}
+
+	ocean_assert(pattern_T_camera.isValid());
+	pattern.previousPose() = pattern_T_camera;
+
+	Geometry::SpatialDistribution::OccupancyArray occupancyArray;
+	optimizePoseByRectification(pinholeCamera, currentFramePyramid, HomogenousMatrix4(pattern.previousPose()), pattern, pattern.previousPose(), worker, &occupancyArray);
+
+	if (occupancyArray)
+	{
+		const Triangles2 triangles(pattern.triangles2(pinholeCamera));
+		CV::SubRegion subRegion(triangles2subRegion(triangles, pinholeCamera.width(), pinholeCamera.height()));
+
+		ocean_assert(pattern.previousPose().isValid());
+
+		if (strongHarrisCorners.empty())
+		{
+			strongHarrisCorners = CV::Detector::FeatureDetector::determineHarrisPoints(yFrame.constdata<uint8_t>(), yFrame.width(), yFrame.height(), yFrame.paddingElements(), CV::SubRegion(), 0u, 0u, 15u, worker);
+		}
+
+		Vectors2 validPoints;
+		validPoints.reserve(strongHarrisCorners.size() / 2);
+
+		for (size_t n = 0; n < strongHarrisCorners.size(); ++n)
+		{
+			if (occupancyArray(strongHarrisCorners[n]) && subRegion.isInside(strongHarrisCorners[n]))
+			{
+				validPoints.push_back(strongHarrisCorners[n]);
 			}
 		}
 
-		if (internalNumberVisiblePattern() >= internalMaxConcurrentlyVisiblePattern())
+		if (validPoints.empty())
 		{
 			return true;
 		}
+
+		pattern.imagePoints() = Geometry::SpatialDistribution::distributeAndFilter(validPoints.data(), validPoints.size(), subRegion.boundingBox().left(), subRegion.boundingBox().top(), subRegion.boundingBox().width(), subRegion.boundingBox().height(), 15u, 15u);
+
+		pattern.objectPoints() = Geometry::Utilities::backProjectImagePoints(pinholeCamera, pattern.previousPose(), Plane3(Vector3(0, 0, 0), Vector3(0, 1, 0)), pattern.imagePoints().data(), pattern.imagePoints().size(), pinholeCamera.hasDistortionParameters());
+
+		patternSubRegion = std::move(subRegion);
 	}
 
 	return true;
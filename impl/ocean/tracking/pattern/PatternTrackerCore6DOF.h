@@ -17,6 +17,7 @@
 #include "ocean/base/Worker.h"
 
 #include "ocean/cv/FramePyramid.h"
+#include "ocean/cv/FramePyramidCache.h"
 #include "ocean/cv/SubRegion.h"
 
 #include "ocean/cv/detector/FREAKDescriptor.h"
@@ -26,7 +27,9 @@
 #include "ocean/math/HomogenousMatrix4.h"
 #include "ocean/math/AnyCamera.h"
 
+#include "ocean/tracking/UnidirectionalCorrespondences.h"
 #include "ocean/tracking/VisualTracker.h"
+#include "ocean/tracking/VocabularyTree.h"
 
 namespace Ocean
 {
@@ -78,6 +81,9 @@ class OCEAN_TRACKING_PATTERN_EXPORT PatternTrackerCore6DOF
 				/// The number of iterations to run RANSAC when attempting to verify a newly recognized target.
 				unsigned int recognitionRansacIterations_ = 50u;
 
+				/// The minimal number of registered patterns for which the recognition is based on one shared descriptor index instead of matching each pattern individually, with range [1, infinity), 0 to never use the index.
+				unsigned int minimalPatternsForDescriptorIndex_ = 8u;
+
 				/// True, to skip frame-to-frame tracking and to apply a full re-detection for every frame.
 				bool noFrameToFrameTracking_ = false;
 
@@ -370,6 +376,95 @@ class OCEAN_TRACKING_PATTERN_EXPORT PatternTrackerCore6DOF
 		 */
 		using PatternMap = std::map<unsigned int, Pattern>;
 
+		/**
+		 * This class implements an index for the descriptors of all registered patterns.
+		 * The index allows to recognize patterns with one descriptor query per frame, regardless of the number of registered patterns.<br>
+		 * The multi-level FREAK descriptors of the patterns are split into their single-level descriptors, which are stored in a vocabulary forest.
+		 */
+		class DescriptorIndex
+		{
+			public:
+
+				/**
+				 * Definition of a single-level FREAK descriptor.
+				 */
+				using SingleLevelDescriptor = Descriptor::SinglelevelDescriptorData;
+
+				/**
+				 * Definition of a vector holding single-level descriptors.
+				 */
+				using SingleLevelDescriptors = std::vector<SingleLevelDescriptor>;
+
+				/**
+				 * Definition of a map mapping pattern ids to feature correspondences between image points (first index) and features of the pattern's feature map (second index).
+				 */
+				using PatternCorrespondenceMap = std::map<unsigned int, UnidirectionalCorrespondences::CorrespondencePairs>;
+
+			protected:
+
+				/**
+				 * Returns the distance between two single-level descriptors.
+				 * @param descriptorA The first descriptor
+				 * @param descriptorB The second descriptor
+				 * @return The hamming distance between both descriptors, with range [0, 256]
+				 */
+				static OCEAN_FORCE_INLINE unsigned int determineDistance(const SingleLevelDescriptor& descriptorA, const SingleLevelDescriptor& descriptorB);
+
+				/**
+				 * Returns one single-level descriptor of a multi-level descriptor.
+				 * @param descriptor The multi-level descriptor
+				 * @param index The index of the level, with range [0, infinity)
+				 * @return The single-level descriptor, nullptr if the index is out of range
+				 */
+				static OCEAN_FORCE_INLINE const SingleLevelDescriptor* multiDescriptorFunction(const Descriptor& descriptor, const size_t index);
+
+				/**
+				 * Definition of the vocabulary forest holding the single-level descriptors.
+				 */
+				using VocabularyForest = Tracking::VocabularyForest<SingleLevelDescriptor, unsigned int, determineDistance>;
+
+			public:
+
+				/**
+				 * Creates an invalid index.
+				 */
+				DescriptorIndex() = default;
+
+				/**
+				 * Creates a new index for all patterns.
+				 * @param patternMap The patterns for which the index will be created
+				 * @param randomGenerator The random generator to be used
+				 * @param worker Optional worker object to distribute the computation
+				 */
+				DescriptorIndex(const PatternMap& patternMap, RandomGenerator& randomGenerator, Worker* worker = nullptr);
+
+				/**
+				 * Matches image point descriptors with the descriptors of all patterns and groups the resulting correspondences by pattern.
+				 * @param imagePointDescriptors The descriptors of the image points
+				 * @param maximalDistance The maximal distance between two matching descriptors, with range [0, 256]
+				 * @param patternCorrespondenceMap The resulting correspondences for each pattern with at least one correspondence
+				 * @param worker Optional worker object to distribute the computation
+				 */
+				void matchDescriptors(const Descriptors& imagePointDescriptors, const unsigned int maximalDistance, PatternCorrespondenceMap& patternCorrespondenceMap, Worker* worker = nullptr) const;
+
+				/**
+				 * Returns whether this index holds at least one descriptor.
+				 * @return True, if so
+				 */
+				inline bool isValid() const;
+
+			protected:
+
+				/// The single-level descriptors of all patterns.
+				SingleLevelDescriptors descriptors_;
+
+				/// The pattern ids and feature indices of all single-level descriptors, one pair for each descriptor.
+				IndexPairs32 descriptorOrigins_;
+
+				/// The vocabulary forest holding all single-level descriptors.
+				VocabularyForest vocabularyForest_;
+		};
+
 	public:
 
 		/**
@@ -462,6 +557,13 @@ class OCEAN_TRACKING_PATTERN_EXPORT PatternTrackerCore6DOF
 		 */
 		inline void setMaxConcurrentlyVisiblePattern(const unsigned int maxConcurrentlyVisiblePattern);
 
+		/**
+		 * Sets a pyramid cache which is shared with other trackers processing the same camera stream.
+		 * With a cache, the pyramid of each frame (with pixel origin ORIGIN_UPPER_LEFT) is taken from the cache instead of being created by this tracker.
+		 * @param framePyramidCache The pyramid cache to be used, nullptr to create the pyramids within the tracker
+		 */
+		inline void setFramePyramidCache(CV::SharedFramePyramidCache framePyramidCache);
+
 		/**
 		 * Returns the latest 2D/3D correspondences for a pattern which has been used to determine the camera pose.
 		 * This function is mainly intended for debugging and visualization purposes.
@@ -532,6 +634,37 @@ class OCEAN_TRACKING_PATTERN_EXPORT PatternTrackerCore6DOF
 		 */
 		bool determinePosesWithoutKnowledge(const PinholeCamera& pinholeCamera, const Frame& yFrame, const CV::FramePyramid& currentFramePyramid, const Quaternion& previousCamera_R_camera = Quaternion(false), Worker* worker = nullptr);
 
+		/**
+		 * Recognizes untracked patterns with the shared descriptor index of all patterns.
+		 * Only the patterns with the largest number of descriptor matches are verified.
+		 * @param pinholeCamera The pinhole camera object associated with the frame
+		 * @param yFrame The current camera frame with grayscale pixel format (Y8), must be valid
+		 * @param currentFramePyramid The frame pyramid of the current frame
+		 * @param imagePoints The image points of the current frame which are not located in any tracked pattern
+		 * @param imagePointDescriptors The descriptors of the image points, one for each image point
+		 * @param previousCamera_R_camera_OrIdentity The relative orientation between the previous frame and the current frame, must be valid
+		 * @param recognitionStartTimestamp The timestamp at which the recognition started, must be valid
+		 * @param worker Optional worker object
+		 * @return True, if succeeded
+		 */
+		bool determinePosesWithDescriptorIndex(const PinholeCamera& pinholeCamera, const Frame& yFrame, const CV::FramePyramid& currentFramePyramid, const Vectors2& imagePoints, const Descriptors& imagePointDescriptors, const Quaternion& previousCamera_R_camera_OrIdentity, const Timestamp& recognitionStartTimestamp, Worker* worker = nullptr);
+
+		/**
+		 * Verifies a pattern candidate based on feature correspondences and determines the pattern's pose and tracking points.
+		 * @param pinholeCamera The pinhole camera object associated with the frame
+		 * @param yFrame The current camera frame with grayscale pixel format (Y8), must be valid
+		 * @param currentFramePyramid The frame pyramid of the current frame
+		 * @param pattern The pattern to verify, which is currently not tracked
+		 * @param imagePoints The image points of the current frame
+		 * @param imagePointDescriptors The descriptors of the image points, one for each image point
+		 * @param correspondenceCandidates The candidate correspondences between the image points (first index) and the pattern's features (second index), at least 12
+		 * @param strongHarrisCorners The strong Harris corners of the current frame, will be determined if empty and needed
+		 * @param patternSubRegion The resulting sub-region covered by the pattern if image points inside this region should not be used for further recognitions, an empty region otherwise
+		 * @param worker Optional worker object
+		 * @return True, if the pattern's pose could be determined
+		 */
+		bool verifyPatternCandidate(const PinholeCamera& pinholeCamera, const Frame& yFrame, const CV::FramePyramid& currentFramePyramid, Pattern& pattern, const Vectors2& imagePoints, const Descriptors& imagePointDescriptors, const UnidirectionalCorrespondences::CorrespondencePairs& correspondenceCandidates, Vectors2& strongHarrisCorners, CV::SubRegion& patternSubRegion, Worker* worker = nullptr);
+
 		/**
 		 * Counts the number of currently visible pattern.
 		 * @return The number of visible pattern
@@ -659,6 +792,15 @@ class OCEAN_TRACKING_PATTERN_EXPORT PatternTrackerCore6DOF
 		/// Frame pyramid of the previous tracking frame.
 		CV::FramePyramid previousFramePyramid_;
 
+		/// The optional pyramid cache shared with other trackers, nullptr if the tracker creates the pyramids.
+		CV::SharedFramePyramidCache framePyramidCache_;
+
+		/// The shared pyramid from the cache whose memory is used by the current frame pyramid, nullptr if the current frame pyramid owns the memory.
+		CV::FramePyramidCache::SharedFramePyramid currentSharedFramePyramid_;
+
+		/// The shared pyramid from the cache whose memory is used by the previous frame pyramid, nullptr if the previous frame pyramid owns the memory.
+		CV::FramePyramidCache::SharedFramePyramid previousSharedFramePyramid_;
+
 		/// The map holding all registered pattern object.
 		PatternMap patternMap_;
 
@@ -682,6 +824,12 @@ class OCEAN_TRACKING_PATTERN_EXPORT PatternTrackerCore6DOF
 
 		/// The id of the pattern that has been tried to recognized last.
 		unsigned int lastRecognitionPatternId_ = 0u;
+
+		/// The shared index of the descriptors of all patterns, invalid if not used.
+		DescriptorIndex descriptorIndex_;
+
+		/// True, if the descriptor index needs to be created again before the next recognition (e.g., as patterns have been added or removed).
+		bool descriptorIndexOutdated_ = true;
 };
 
 inline const Vectors3& PatternTrackerCore6DOF::FeatureMap::objectPoints() const
@@ -865,6 +1013,13 @@ inline void PatternTrackerCore6DOF::setMaxConcurrentlyVisiblePattern(const unsig
 	options_.maxConcurrentlyVisiblePattern_ = maxConcurrentlyVisiblePattern;
 }
 
+inline void PatternTrackerCore6DOF::setFramePyramidCache(CV::SharedFramePyramidCache framePyramidCache)
+{
+	const ScopedLock scopedLock(lock_);
+
+	framePyramidCache_ = std::move(framePyramidCache);
+}
+
 inline double PatternTrackerCore6DOF::maximumDurationBetweenRecognitionAttempts() const
 {
 	return (internalNumberVisiblePattern() == 0) ? options_.recognitionCadenceWithoutTrackedPatterns_ : options_.recognitionCadenceWithTrackedPatterns_;
@@ -897,6 +1052,26 @@ inline unsigned int PatternTrackerCore6DOF::internalMaxConcurrentlyVisiblePatter
 	}
 }
 
+inline bool PatternTrackerCore6DOF::DescriptorIndex::isValid() const
+{
+	return !descriptors_.empty();
+}
+
+OCEAN_FORCE_INLINE unsigned int PatternTrackerCore6DOF::DescriptorIndex::determineDistance(const SingleLevelDescriptor& descriptorA, const SingleLevelDescriptor& descriptorB)
+{
+	return CV::Detector::Descriptor::calculateHammingDistance<Descriptor::size() * 8>(descriptorA.data(), descriptorB.data());
+}
+
+OCEAN_FORCE_INLINE const PatternTrackerCore6DOF::DescriptorIndex::SingleLevelDescriptor* PatternTrackerCore6DOF::DescriptorIndex::multiDescriptorFunction(const Descriptor& descriptor, const size_t index)
+{
+	if (index >= descriptor.descriptorLevels())
+	{
+		return nullptr;
+	}
+
+	return &descriptor.data()[index];
+}
+
 OCEAN_FORCE_INLINE unsigned int PatternTrackerCore6DOF::determineDescriptorDistance(const Descriptor& descriptorA, const Descriptor& descriptorB)
 {
 	return descriptorA.distance(descriptorB);
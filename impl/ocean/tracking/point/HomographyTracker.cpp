@@ -189,8 +189,20 @@ bool HomographyTracker::determineHomography(const AnyCamera& camera, const Frame
 
 	constexpr bool copyFirstLayer = true; // we need to make a copy of the first layer, as this pyramid will be used as 'previousPyramid' in the next call of resetRegion()
 
+	// the frame pyramids and the point pyramids are double-buffered, both buffers are swapped at the end of this function and reused for the next frame
+
+	frameAllocations_ = 0u;
+
+	const void* const currentPyramidMemory = currentFramePyramid_.isValid() ? currentFramePyramid_.finestLayer().constdata<void>() : nullptr;
+	const size_t pointsPyramidsCapacity = capacity(initialPointsPyramid_) + capacity(previousPointsPyramid_) + capacity(currentPointsPyramid_);
+
 	currentFramePyramid_.replace8BitPerChannel11(yFrame.constdata<uint8_t>(), yFrame.width(), yFrame.height(), 1u, yFrame.pixelOrigin(), pyramidLayers, yFrame.paddingElements(), copyFirstLayer, worker);
 
+	if (currentFramePyramid_.finestLayer().constdata<void>() != currentPyramidMemory)
+	{
+		++frameAllocations_;
+	}
+
 	homography.toNull();
 
 	if (previousFramePyramid_ && isRegionVisible(globalCameraOrientation_, cameraOrientation))
@@ -222,8 +234,7 @@ bool HomographyTracker::determineHomography(const AnyCamera& camera, const Frame
 				return false; // **TODO** we should ensure that the track will be reset in this case
 			}
 
-			Vectors2Pyramid currentPointsPyramid;
-			const HomographyQuality homographyQuality = determineHomographyWithPyramid(camera, plane_, previousFramePyramid_, currentFramePyramid_, previousPointsPyramid_, currentPointsPyramid, initialPointsPyramid_, globalHomography_, region_, homography, pose, predictedLocalHomography, initialCameraOrientation_, cameraOrientation, randomGenerator_, -1.0f, worker);
+			const HomographyQuality homographyQuality = determineHomographyWithPyramid(camera, plane_, previousFramePyramid_, currentFramePyramid_, previousPointsPyramid_, currentPointsPyramid_, initialPointsPyramid_, globalHomography_, region_, homography, pose, predictedLocalHomography, initialCameraOrientation_, cameraOrientation, randomGenerator_, -1.0f, worker);
 
 			if (homographyQuality == HQ_FAILED)
 			{
@@ -254,9 +265,9 @@ bool HomographyTracker::determineHomography(const AnyCamera& camera, const Frame
 					{
 						bool enoughPoints = true;
 
-						for (size_t nLayer = 0; nLayer < currentPointsPyramid.size(); ++nLayer)
+						for (size_t nLayer = 0; nLayer < currentPointsPyramid_.size(); ++nLayer)
 						{
-							if (currentPointsPyramid[nLayer].size() > 0 && currentPointsPyramid[nLayer].size() < 25)
+							if (currentPointsPyramid_[nLayer].size() > 0 && currentPointsPyramid_[nLayer].size() < 25)
 							{
 								enoughPoints = false;
 								break;
@@ -289,7 +300,7 @@ bool HomographyTracker::determineHomography(const AnyCamera& camera, const Frame
 
 								if (needsUpdate)
 								{
-									keyFrames_[1] = KeyFrame(yFrame.timestamp(), initialPointsPyramid_, currentPointsPyramid, currentFramePyramid_, globalHomography_, cameraOrientation);
+									keyFrames_[1] = KeyFrame(yFrame.timestamp(), initialPointsPyramid_, currentPointsPyramid_, currentFramePyramid_, globalHomography_, cameraOrientation);
 								}
 							}
 						}
@@ -297,7 +308,7 @@ bool HomographyTracker::determineHomography(const AnyCamera& camera, const Frame
 				}
 			}
 
-			previousPointsPyramid_ = std::move(currentPointsPyramid);
+			std::swap(previousPointsPyramid_, currentPointsPyramid_);
 		}
 
 		static_assert(numberKeyFrames_ >= 2, "Invalid key frames!");
@@ -414,18 +425,16 @@ bool HomographyTracker::determineHomography(const AnyCamera& camera, const Frame
 					}
 #endif
 
-					Vectors2Pyramid currentPointsPyramid;
-
 					const float explicitMaximalOffsetPercent = 0.10f; // 10 %
 
-					const HomographyQuality homographyQuality = determineHomographyWithPyramid(camera, plane_, transformedKeyFramePyramid, currentFramePyramid_, copyKeyFramePointsPyramid, currentPointsPyramid, copyKeyFrameInitialPointsPyramid, keyFrame.globalHomography_, Box2(), homography, pose, predictedKeyFrameHomography, initialCameraOrientation_, cameraOrientation, randomGenerator_, explicitMaximalOffsetPercent, worker);
+					const HomographyQuality homographyQuality = determineHomographyWithPyramid(camera, plane_, transformedKeyFramePyramid, currentFramePyramid_, copyKeyFramePointsPyramid, currentPointsPyramid_, copyKeyFrameInitialPointsPyramid, keyFrame.globalHomography_, Box2(), homography, pose, predictedKeyFrameHomography, initialCameraOrientation_, cameraOrientation, randomGenerator_, explicitMaximalOffsetPercent, worker);
 
 					if (homographyQuality == HQ_GOOD)
 					{
 						globalHomography_ = homography;
 						globalCameraOrientation_ = cameraOrientation;
 
-						previousPointsPyramid_ = std::move(currentPointsPyramid);
+						std::swap(previousPointsPyramid_, currentPointsPyramid_);
 						initialPointsPyramid_ = std::move(copyKeyFrameInitialPointsPyramid);
 
 						needsReInitialization_ = false;
@@ -478,6 +487,13 @@ bool HomographyTracker::determineHomography(const AnyCamera& camera, const Frame
 
 	previousCameraOrientation_ = cameraOrientation;
 
+	if (capacity(initialPointsPyramid_) + capacity(previousPointsPyramid_) + capacity(currentPointsPyramid_) > pointsPyramidsCapacity)
+	{
+		++frameAllocations_;
+	}
+
+	allocations_ += frameAllocations_;
+
 	return !homography.isNull(); // 'true' if we were able to determine valid homography - otherwise 'false' (e.g., when the tracking region is out of view)
 }
 
@@ -688,7 +704,14 @@ HomographyTracker::HomographyQuality HomographyTracker::determineHomographyWithP
 		return HQ_FAILED;
 	}
 
-	currentPointsPyramid = Vectors2Pyramid(previousPointsPyramid.size());
+	// the point buffers are reused, we keep the memory of each layer
+
+	currentPointsPyramid.resize(previousPointsPyramid.size());
+
+	for (Vectors2& currentLayerPoints : currentPointsPyramid)
+	{
+		currentLayerPoints.clear();
+	}
 	Indices32 validTrackedPointIndices;
 
 	SquareMatrix3 roughHomography(false); // (finestCurrentPoint = roughHomography * finestPreviousPoint)
@@ -772,8 +795,8 @@ HomographyTracker::HomographyQuality HomographyTracker::determineHomographyWithP
 							{
 								// we update the points in the current pyramid layer so that we keep well trackable points only
 
-								previousPointsPyramid[layer] = Subset::subset(trackedPreviousPoints, validPoseIndices);
-								currentPointsPyramid[layer] = Subset::subset(trackedCurrentPoints, validPoseIndices);
+								assignSubset(trackedPreviousPoints, validPoseIndices, previousPointsPyramid[layer]);
+								assignSubset(trackedCurrentPoints, validPoseIndices, currentPointsPyramid[layer]);
 
 								SquareMatrix3 layerHomography(false); // this is a different way to determine the local homography
 								if (Geometry::Homography::homographyMatrixLinearWithoutOptimations(previousPointsPyramid[layer].data(), currentPointsPyramid[layer].data(), previousPointsPyramid[layer].size(), layerHomography)) // layerHomography = cHp (for the layer)
@@ -790,7 +813,7 @@ HomographyTracker::HomographyQuality HomographyTracker::determineHomographyWithP
 										validInitialPoints.emplace_back(initialPointsPyramid[layer][validTrackedPointIndices[validHomographyIndex]]);
 									}
 
-									initialPointsPyramid[layer] = std::move(validInitialPoints);
+									initialPointsPyramid[layer].assign(validInitialPoints.cbegin(), validInitialPoints.cend());
 
 									lastSuccessfulLayer = layer;
 
@@ -815,8 +838,8 @@ HomographyTracker::HomographyQuality HomographyTracker::determineHomographyWithP
 
 								// we update the points in the current pyramid layer so that we keep well trackable points only
 
-								previousPointsPyramid[layer] = Subset::subset(trackedPreviousPoints, validHomographyIndices);
-								currentPointsPyramid[layer] = Subset::subset(trackedCurrentPoints, validHomographyIndices);
+								assignSubset(trackedPreviousPoints, validHomographyIndices, previousPointsPyramid[layer]);
+								assignSubset(trackedCurrentPoints, validHomographyIndices, currentPointsPyramid[layer]);
 
 								// we have to shrink the set of initial image points so that it fits with the set of all tracked points
 
@@ -828,7 +851,7 @@ HomographyTracker::HomographyQuality HomographyTracker::determineHomographyWithP
 									validInitialPoints.emplace_back(initialPointsPyramid[layer][validTrackedPointIndices[validHomographyIndex]]);
 								}
 
-								initialPointsPyramid[layer] = std::move(validInitialPoints);
+								initialPointsPyramid[layer].assign(validInitialPoints.cbegin(), validInitialPoints.cend());
 
 								lastSuccessfulLayer = layer;
 							}
@@ -162,8 +162,40 @@ class OCEAN_TRACKING_POINT_EXPORT HomographyTracker
 		 */
 		inline void reset();
 
+		/**
+		 * Returns the number of buffer allocations which have been necessary for the most recent frame.
+		 * The tracker keeps two frame pyramids and two pyramids of image points which are swapped and reused for each new frame.<br>
+		 * Once the tracker has seen two frames with the same frame type (and a similar number of feature points), the number of allocations is zero.<br>
+		 * Key-frames are not part of this statistic.
+		 * @return The number of allocations of the frame pyramids and the point pyramids during the most recent call of determineHomography()
+		 */
+		inline unsigned int frameAllocations() const;
+
+		/**
+		 * Returns the overall number of buffer allocations which have been necessary since the creation (or the last reset) of this tracker.
+		 * @return The overall number of allocations of the frame pyramids and the point pyramids
+		 * @see frameAllocations().
+		 */
+		inline uint64_t allocations() const;
+
 	protected:
 
+		/**
+		 * Returns the overall capacity of a pyramid of points.
+		 * As the point buffers of the tracker never shrink, an increased capacity indicates an allocation.
+		 * @param pointsPyramid The pyramid of points
+		 * @return The sum of the capacities of all layers and of the pyramid itself
+		 */
+		static inline size_t capacity(const Vectors2Pyramid& pointsPyramid);
+
+		/**
+		 * Replaces the points of a buffer with a subset of points while keeping the memory of the buffer.
+		 * @param points The points from which the subset will be taken
+		 * @param indices The indices of the points defining the subset, each index with range [0, points.size() - 1]
+		 * @param subset The resulting subset of points, must not be 'points'
+		 */
+		static inline void assignSubset(const Vectors2& points, const Indices32& indices, Vectors2& subset);
+
 		/**
 		 * Adds new feature points to all pyramid layers (at least to all desired layers e.g., layer 0 and 2) if the layers do not contain enough feature points already.
 		 * @param yFramePyramid The frame pyramid of the frame for which the new feature points will be determined, must be valid
@@ -293,6 +325,9 @@ class OCEAN_TRACKING_POINT_EXPORT HomographyTracker
 		/// The image points located in 'previousFramePyramid_'.
 		Vectors2Pyramid previousPointsPyramid_;
 
+		/// The image points located in 'currentFramePyramid_', swapped with 'previousPointsPyramid_' after each frame.
+		Vectors2Pyramid currentPointsPyramid_;
+
 		/// The orientation of the initial camera frame, (wRi), if known.
 		Quaternion initialCameraOrientation_;
 
@@ -316,6 +351,12 @@ class OCEAN_TRACKING_POINT_EXPORT HomographyTracker
 
 		/// True, if the tracker needs to be re-initialized.
 		bool needsReInitialization_ = false;
+
+		/// The number of buffer allocations of the most recent frame.
+		unsigned int frameAllocations_ = 0u;
+
+		/// The overall number of buffer allocations.
+		uint64_t allocations_ = 0ull;
 };
 
 inline HomographyTracker::KeyFrame::KeyFrame() :
@@ -361,6 +402,7 @@ inline void HomographyTracker::reset()
 
 	initialPointsPyramid_.clear();
 	previousPointsPyramid_.clear();
+	currentPointsPyramid_.clear();
 
 	initialCameraOrientation_ = Quaternion(false);
 
@@ -378,6 +420,44 @@ inline void HomographyTracker::reset()
 	}
 
 	needsReInitialization_ = false;
+
+	frameAllocations_ = 0u;
+	allocations_ = 0ull;
+}
+
+inline unsigned int HomographyTracker::frameAllocations() const
+{
+	return frameAllocations_;
+}
+
+inline uint64_t HomographyTracker::allocations() const
+{
+	return allocations_;
+}
+
+inline size_t HomographyTracker::capacity(const Vectors2Pyramid& pointsPyramid)
+{
+	size_t result = pointsPyramid.capacity();
+
+	for (const Vectors2& layerPoints : pointsPyramid)
+	{
+		result += layerPoints.capacity();
+	}
+
+	return result;
+}
+
+inline void HomographyTracker::assignSubset(const Vectors2& points, const Indices32& indices, Vectors2& subset)
+{
+	ocean_assert(&points != &subset);
+
+	subset.clear();
+
+	for (const Index32& index : indices)
+	{
+		ocean_assert(index < points.size());
+		subset.emplace_back(points[index]);
+	}
 }
 
 }
@@ -36,7 +36,10 @@ PointTracker::PointTracker(const PointTracker& pointTracker) :
 	currentFramePyramid_(pointTracker.currentFramePyramid_, true /*copyData*/),
 	previousFrameIndex_(pointTracker.previousFrameIndex_),
 	featurePointStrengthThreshold_(pointTracker.featurePointStrengthThreshold_),
-	binSize_(pointTracker.binSize_)
+	binSize_(pointTracker.binSize_),
+	historyDepth_(pointTracker.historyDepth_),
+	archiveFinishedTracks_(pointTracker.archiveFinishedTracks_),
+	trackArchive_(pointTracker.trackArchive_)
 {
 	// nothing to do here
 }
@@ -97,6 +100,26 @@ Index32 PointTracker::newFrame(const Frame& yFrame, Worker* worker)
 			ocean_assert(previousImagePoints.size() == currentImagePoints.size());
 			ocean_assert(validCorrespondences.size() <= currentImagePoints.size());
 
+			if (archiveFinishedTracks_ && validCorrespondences.size() < previousImagePoints.size())
+			{
+				// all object points which could not be tracked into the current frame have finished tracks
+
+				std::vector<uint8_t> trackedStatements(previousImagePoints.size(), 0u);
+
+				for (const Index32& validIndex : validCorrespondences)
+				{
+					trackedStatements[validIndex] = 1u;
+				}
+
+				for (size_t n = 0; n < trackedStatements.size(); ++n)
+				{
+					if (trackedStatements[n] == 0u)
+					{
+						archiveTrack(database_.objectPointFromImagePoint<false>(previousImagePointIds[n]));
+					}
+				}
+			}
+
 			for (const Index32& validIndex : validCorrespondences)
 			{
 				ocean_assert(validIndex < (unsigned int)previousImagePoints.size());
@@ -146,6 +169,13 @@ Index32 PointTracker::newFrame(const Frame& yFrame, Worker* worker)
 
 	std::swap(previousFramePyramid_, currentFramePyramid_);
 
+	if (historyDepth_ != 0u && currentFrameIndex >= historyDepth_)
+	{
+		// the oldest frame(s) leave the history, so that the size of the database does not grow
+
+		removeFramesUpTo(currentFrameIndex + 1u - historyDepth_);
+	}
+
 	return currentFrameIndex;
 }
 
@@ -155,6 +185,13 @@ void PointTracker::clearUpTo(const unsigned int frameIndex)
 
 	const ScopedLock scopedLock(lock_);
 
+	removeFramesUpTo(frameIndex);
+}
+
+void PointTracker::removeFramesUpTo(const Index32 frameIndex)
+{
+	ocean_assert(frameIndex != invalidFrameIndex);
+
 	Index32 lowestFrameIndex;
 	Index32 highestFrameIndex;
 
@@ -245,6 +282,12 @@ PointTracker& PointTracker::operator=(PointTracker&& pointTracker) noexcept
 		pointTracker.featurePointStrengthThreshold_ = 15u;
 		binSize_ = pointTracker.binSize_;
 		pointTracker.binSize_ = 40u;
+		historyDepth_ = pointTracker.historyDepth_;
+		pointTracker.historyDepth_ = 0u;
+		archiveFinishedTracks_ = pointTracker.archiveFinishedTracks_;
+		pointTracker.archiveFinishedTracks_ = false;
+		trackArchive_ = std::move(pointTracker.trackArchive_);
+		pointTracker.trackArchive_.clear();
 	}
 
 	return *this;
@@ -262,6 +305,9 @@ PointTracker& PointTracker::operator=(const PointTracker& pointTracker)
 		previousFrameIndex_ = pointTracker.previousFrameIndex_;
 		featurePointStrengthThreshold_ = pointTracker.featurePointStrengthThreshold_;
 		binSize_ = pointTracker.binSize_;
+		historyDepth_ = pointTracker.historyDepth_;
+		archiveFinishedTracks_ = pointTracker.archiveFinishedTracks_;
+		trackArchive_ = pointTracker.trackArchive_;
 	}
 
 	return *this;
@@ -294,6 +340,43 @@ void PointTracker::detectNewFeaturePoints(const Frame& yFrame, Geometry::Spatial
 	}
 }
 
+void PointTracker::archiveTrack(const Index32 objectPointId)
+{
+	ocean_assert(objectPointId != Database::invalidId);
+
+	const IndexSet32& imagePointIds = database_.imagePointsFromObjectPoint<false>(objectPointId);
+	ocean_assert(!imagePointIds.empty());
+
+	if (imagePointIds.empty())
+	{
+		return;
+	}
+
+	// the track contains one image point in each consecutive frame, so that the observations can be sorted by frame index
+
+	IndexPairs32 frameImagePointPairs;
+	frameImagePointPairs.reserve(imagePointIds.size());
+
+	for (const Index32& imagePointId : imagePointIds)
+	{
+		frameImagePointPairs.emplace_back(database_.poseFromImagePoint<false>(imagePointId), imagePointId);
+	}
+
+	std::sort(frameImagePointPairs.begin(), frameImagePointPairs.end());
+
+	Vectors2 observations;
+	observations.reserve(frameImagePointPairs.size());
+
+	for (const IndexPair32& frameImagePointPair : frameImagePointPairs)
+	{
+		ocean_assert(observations.empty() || frameImagePointPair.first == frameImagePointPairs.front().first + Index32(observations.size()));
+
+		observations.emplace_back(database_.imagePoint<false>(frameImagePointPair.second));
+	}
+
+	trackArchive_.addTrack(frameImagePointPairs.front().first, observations.data(), observations.size());
+}
+
 bool PointTracker::trackFeaturePoints(const TrackingMode trackingMode, const CV::FramePyramid& previousFramePyramid, const CV::FramePyramid& currentFramePyramid, Vectors2& previousImagePoints, Vectors2& currentImagePoints, Indices32& validIndices, Worker* worker)
 {
 	ocean_assert(previousFramePyramid && currentFramePyramid);
@@ -38,6 +38,10 @@ namespace Point
  * All points are tracked from the previous frame to the current frame (and not from a common reference frame to the current frame).<br>
  * Whenever an object point (feature point) is lost the tracker will add a new feature point in the empty region - so that the tracker is always tracking a high number of feature points.<br>
  * Tracking is based on matches between small image patches around the image points.
+ *
+ * By default, the database keeps the image points of all frames.<br>
+ * For long sessions, the history can be limited to a fixed number of frames so that memory and the per-frame costs stay constant, see setHistoryDepth().<br>
+ * Tracks which have been lost can be moved into a compact archive before they leave the history, see setArchiveFinishedTracks().
  * @ingroup trackingpoint
  */
 class OCEAN_TRACKING_POINT_EXPORT PointTracker
@@ -77,6 +81,78 @@ class OCEAN_TRACKING_POINT_EXPORT PointTracker
 			TM_END
 		};
 
+		/**
+		 * This class stores finished point tracks in a compact layout.
+		 * The observations of all tracks are stored in one contiguous vector, each track is defined by the index of its first frame and the offset of its first observation.
+		 */
+		class TrackArchive
+		{
+			public:
+
+				/**
+				 * Returns the number of tracks in this archive.
+				 * @return The archive's number of tracks
+				 */
+				inline size_t size() const;
+
+				/**
+				 * Returns whether this archive does not contain any track.
+				 * @return True, if so
+				 */
+				inline bool isEmpty() const;
+
+				/**
+				 * Returns the index of the frame in which a track starts.
+				 * @param trackIndex The index of the track, with range [0, size() - 1]
+				 * @return The index of the first frame of the track
+				 */
+				inline Index32 firstFrameIndex(const size_t trackIndex) const;
+
+				/**
+				 * Returns the number of observations of a track, one observation for each frame.
+				 * @param trackIndex The index of the track, with range [0, size() - 1]
+				 * @return The track's number of observations, with range [1, infinity)
+				 */
+				inline size_t trackLength(const size_t trackIndex) const;
+
+				/**
+				 * Returns the observations of a track, the first observation belongs to the first frame of the track.
+				 * @param trackIndex The index of the track, with range [0, size() - 1]
+				 * @return The track's observations, trackLength() elements
+				 */
+				inline const Vector2* trackObservations(const size_t trackIndex) const;
+
+				/**
+				 * Returns the number of observations of all tracks.
+				 * @return The archive's overall number of observations
+				 */
+				inline size_t numberObservations() const;
+
+				/**
+				 * Adds a new track to this archive.
+				 * @param firstFrameIndex The index of the frame in which the track starts
+				 * @param observations The observations of the track, one for each consecutive frame, must be valid
+				 * @param size The number of observations, with range [1, infinity)
+				 */
+				inline void addTrack(const Index32 firstFrameIndex, const Vector2* observations, const size_t size);
+
+				/**
+				 * Removes all tracks from this archive.
+				 */
+				inline void clear();
+
+			protected:
+
+				/// The index of the first frame of each track.
+				Indices32 firstFrameIndices_;
+
+				/// The offset of the first observation of each track within the observations.
+				Indices32 observationOffsets_;
+
+				/// The observations of all tracks.
+				Vectors2 observations_;
+		};
+
 	public:
 
 		/**
@@ -125,6 +201,36 @@ class OCEAN_TRACKING_POINT_EXPORT PointTracker
 		 */
 		PointTracks pointTracks(const Index32 imageIndex, const unsigned int maximalLength = (unsigned int)(-1));
 
+		/**
+		 * Sets the number of most recent frames for which the database keeps the image points.
+		 * Whenever a new frame exceeds the history, the oldest frame is removed from the database, as clearUpTo() does.
+		 * @param historyDepth The number of frames to keep, with range [2, infinity), 0 to keep all frames
+		 */
+		inline void setHistoryDepth(const unsigned int historyDepth);
+
+		/**
+		 * Returns the number of most recent frames for which the database keeps the image points.
+		 * @return The tracker's history depth, 0 if all frames are kept
+		 */
+		inline unsigned int historyDepth() const;
+
+		/**
+		 * Sets whether tracks which have been lost are copied into the track archive.
+		 * A track is archived in the frame in which it is lost, with all observations which are still part of the history.<br>
+		 * Thus, tracks longer than the history depth are archived with their most recent observations only.
+		 * @param archive True, to archive finished tracks
+		 * @see takeTrackArchive().
+		 */
+		inline void setArchiveFinishedTracks(const bool archive);
+
+		/**
+		 * Returns the archive with all tracks which have been finished since the last call of this function.
+		 * The internal archive is empty afterwards, so that the tracker's memory does not grow if the archive is taken regularly.
+		 * @return The archive of finished tracks
+		 * @see setArchiveFinishedTracks().
+		 */
+		inline TrackArchive takeTrackArchive();
+
 		/**
 		 * Removes all entries from the tracking database older than a specified frame index.
 		 * @param frameIndex The index of the frame which will be the first frame in the database for which data exists
@@ -183,6 +289,19 @@ class OCEAN_TRACKING_POINT_EXPORT PointTracker
 		 */
 		static bool trackFeaturePoints(const TrackingMode trackingMode, const CV::FramePyramid& previousFramePyramid, const CV::FramePyramid& currentFramePyramid, Vectors2& previousImagePoints, Vectors2& currentImagePoints, Indices32& validIndices, Worker* worker);
 
+		/**
+		 * Removes all entries from the tracking database older than a specified frame index, the tracker must be locked.
+		 * @param frameIndex The index of the frame which will be the first frame in the database for which data exists
+		 * @see clearUpTo().
+		 */
+		void removeFramesUpTo(const Index32 frameIndex);
+
+		/**
+		 * Copies the track of an object point into the track archive, the tracker must be locked.
+		 * @param objectPointId The id of the object point whose track will be archived, must be valid
+		 */
+		void archiveTrack(const Index32 objectPointId);
+
 	protected:
 
 		/// The tracking mode to be used.
@@ -206,10 +325,77 @@ class OCEAN_TRACKING_POINT_EXPORT PointTracker
 		/// The size of each bin (edge length) in pixel controlling whether new feature points will be added in an empty region.
 		unsigned int binSize_ = 40u;
 
+		/// The number of most recent frames for which the database keeps the image points, 0 to keep all frames.
+		unsigned int historyDepth_ = 0u;
+
+		/// True, to copy tracks which have been lost into the track archive.
+		bool archiveFinishedTracks_ = false;
+
+		/// The archive of finished tracks.
+		TrackArchive trackArchive_;
+
 		/// The lock for this tracker.
 		mutable Lock lock_;
 };
 
+inline size_t PointTracker::TrackArchive::size() const
+{
+	ocean_assert(firstFrameIndices_.size() == observationOffsets_.size());
+
+	return firstFrameIndices_.size();
+}
+
+inline bool PointTracker::TrackArchive::isEmpty() const
+{
+	return firstFrameIndices_.empty();
+}
+
+inline Index32 PointTracker::TrackArchive::firstFrameIndex(const size_t trackIndex) const
+{
+	ocean_assert(trackIndex < size());
+
+	return firstFrameIndices_[trackIndex];
+}
+
+inline size_t PointTracker::TrackArchive::trackLength(const size_t trackIndex) const
+{
+	ocean_assert(trackIndex < size());
+
+	const size_t endOffset = trackIndex + 1 < observationOffsets_.size() ? size_t(observationOffsets_[trackIndex + 1]) : observations_.size();
+
+	return endOffset - size_t(observationOffsets_[trackIndex]);
+}
+
+inline const Vector2* PointTracker::TrackArchive::trackObservations(const size_t trackIndex) const
+{
+	ocean_assert(trackIndex < size());
+
+	return observations_.data() + observationOffsets_[trackIndex];
+}
+
+inline size_t PointTracker::TrackArchive::numberObservations() const
+{
+	return observations_.size();
+}
+
+inline void PointTracker::TrackArchive::addTrack(const Index32 firstFrameIndex, const Vector2* observations, const size_t size)
+{
+	ocean_assert(observations != nullptr && size >= 1);
+	ocean_assert(observations_.size() + size <= size_t(NumericT<Index32>::maxValue()));
+
+	firstFrameIndices_.emplace_back(firstFrameIndex);
+	observationOffsets_.emplace_back(Index32(observations_.size()));
+
+	observations_.insert(observations_.end(), observations, observations + size);
+}
+
+inline void PointTracker::TrackArchive::clear()
+{
+	firstFrameIndices_.clear();
+	observationOffsets_.clear();
+	observations_.clear();
+}
+
 inline void PointTracker::setTrackingMode(const TrackingMode trackingMode)
 {
 	const ScopedLock scopedLock(lock_);
@@ -224,6 +410,39 @@ inline PointTracker::TrackingMode PointTracker::trackingMode() const
 	return trackingMode_;
 }
 
+inline void PointTracker::setHistoryDepth(const unsigned int historyDepth)
+{
+	ocean_assert(historyDepth == 0u || historyDepth >= 2u);
+
+	const ScopedLock scopedLock(lock_);
+
+	historyDepth_ = historyDepth == 0u ? 0u : std::max(2u, historyDepth);
+}
+
+inline unsigned int PointTracker::historyDepth() const
+{
+	const ScopedLock scopedLock(lock_);
+
+	return historyDepth_;
+}
+
+inline void PointTracker::setArchiveFinishedTracks(const bool archive)
+{
+	const ScopedLock scopedLock(lock_);
+
+	archiveFinishedTracks_ = archive;
+}
+
+inline PointTracker::TrackArchive PointTracker::takeTrackArchive()
+{
+	const ScopedLock scopedLock(lock_);
+
+	TrackArchive trackArchive(std::move(trackArchive_));
+	trackArchive_.clear();
+
+	return trackArchive;
+}
+
 inline void PointTracker::clear()
 {
 	const ScopedLock scopedLock(lock_);
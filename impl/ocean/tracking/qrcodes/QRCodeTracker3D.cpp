@@ -304,6 +304,52 @@ const QRCodeTracker3D::TrackedQRCodesMap& QRCodeTracker3D::trackQRCodes(const Sh
 		}
 	}
 
+	// Re-detection of lost codes in the regions in which they are expected, this is significantly cheaper than a detection in the entire frames
+
+	if (!forceDetectionOnlyAndAllow2DCodes_ && parameters_.redetectLostCodesInRegions_ && numberTrackedCodes < trackedQRCodesMap_.size() && frameCounter_ % parameters_.detectionCadence_ != 0u)
+	{
+		std::vector<CV::PixelBoundingBoxes> detectionRegionGroups(yFrames.size());
+
+		for (TrackedQRCodesMap::const_iterator trackedQRCodeIter = trackedQRCodesMap_.cbegin(); trackedQRCodeIter != trackedQRCodesMap_.cend(); ++trackedQRCodeIter)
+		{
+			const TrackedQRCode& trackedCode = trackedQRCodeIter->second;
+
+			if (trackedCode.trackingState() != TS_LOST || !trackedCode.world_T_code().isValid() || trackedCode.codeSize() <= Scalar(0))
+			{
+				continue;
+			}
+
+			for (size_t iCamera = 0; iCamera < yFrames.size(); ++iCamera)
+			{
+				const CV::PixelBoundingBox detectionRegion = determineDetectionRegion(*sharedAnyCameras[iCamera], world_T_device * device_T_cameras[iCamera], trackedCode.world_T_code(), trackedCode.codeSize());
+
+				if (detectionRegion.isValid())
+				{
+					detectionRegionGroups[iCamera].push_back(detectionRegion);
+				}
+			}
+		}
+
+		CV::Detector::QRCodes::QRCodes newCodes;
+		HomogenousMatrices4 world_T_newCodes;
+		Scalars newCodeSizes;
+
+		if (CV::Detector::QRCodes::QRCodeDetector3D::detectQRCodesInRegions(sharedAnyCameras, yFrames, world_T_device, device_T_cameras, detectionRegionGroups, newCodes, world_T_newCodes, newCodeSizes, worker))
+		{
+			addDetectedCodes(newCodes, world_T_newCodes, newCodeSizes, trackingTimestamp);
+
+			numberTrackedCodes = 0u;
+
+			for (TrackedQRCodesMap::const_iterator trackedQRCodeIter = trackedQRCodesMap_.cbegin(); trackedQRCodeIter != trackedQRCodesMap_.cend(); ++trackedQRCodeIter)
+			{
+				if (trackedQRCodeIter->second.trackingState() == TS_TRACKING)
+				{
+					++numberTrackedCodes;
+				}
+			}
+		}
+	}
+
 	// Detection
 
 	if (trackedQRCodesMap_.empty() || numberTrackedCodes == 0u || (frameCounter_ % parameters_.detectionCadence_ == 0u) || forceDetectionOnlyAndAllow2DCodes_)
@@ -319,74 +365,133 @@ const QRCodeTracker3D::TrackedQRCodesMap& QRCodeTracker3D::trackQRCodes(const Sh
 			ocean_assert(newCodes.size() == world_T_newCodes.size());
 			ocean_assert(newCodes.size() == newCodeSizes.size());
 
-			for (size_t i = 0; i < newCodes.size(); ++i)
-			{
-				CV::Detector::QRCodes::QRCode& newCode = newCodes[i];
-				HomogenousMatrix4& world_T_newCode = world_T_newCodes[i];
-				const Scalar newCodeSize = newCodeSizes[i];
-
-				const bool is2DCode = newCodeSize <= Scalar(0) || !world_T_newCode.isValid();
+			addDetectedCodes(newCodes, world_T_newCodes, newCodeSizes, trackingTimestamp);
+		}
+	}
 
-				ocean_assert(forceDetectionOnlyAndAllow2DCodes_ || !is2DCode);
+	previousSharedAnyCameras_ = sharedAnyCameras;
+	previousFramePyramids_ = std::move(framePyramids);
 
-				ObjectId objectId = invalidObjectId();
-				TrackedQRCodesMap::iterator iter;
+	previousWorld_T_device_ = world_T_device;
+	previousDevice_T_cameras_ = std::move(device_T_cameras);
 
-				if (!is2DCode && isAlreadyTracked(trackedQRCodesMap_, newCode, world_T_newCode, newCodeSize, objectId))
-				{
-					// Update the code that has been tracked already
-					iter = trackedQRCodesMap_.find(objectId);
-					ocean_assert(iter != trackedQRCodesMap_.end());
+	return trackedQRCodesMap_;
+}
 
-					if (iter->second.trackingState() != TS_TRACKING)
-					{
-						iter->second.updateTrackingPose(std::move(world_T_newCode), newCodeSize, trackingTimestamp);
-					}
-				}
-				else
-				{
-					// Add the code to the map of tracked codes.
-					const ObjectId newCodeObjectId = objectIdCounter_;
+constexpr QRCodeTracker3D::ObjectId QRCodeTracker3D::invalidObjectId()
+{
+	return ObjectId(-1);
+}
 
-					++objectIdCounter_;
+void QRCodeTracker3D::addDetectedCodes(CV::Detector::QRCodes::QRCodes& newCodes, HomogenousMatrices4& world_T_newCodes, const Scalars& newCodeSizes, const Timestamp& trackingTimestamp)
+{
+	ocean_assert(newCodes.size() == world_T_newCodes.size());
+	ocean_assert(newCodes.size() == newCodeSizes.size());
 
-					if (callbackNewQRCode_ != nullptr)
-					{
-						callbackNewQRCode_(newCode, world_T_newCode, newCodeSize, newCodeObjectId);
-					}
+	for (size_t i = 0; i < newCodes.size(); ++i)
+	{
+		CV::Detector::QRCodes::QRCode& newCode = newCodes[i];
+		HomogenousMatrix4& world_T_newCode = world_T_newCodes[i];
+		const Scalar newCodeSize = newCodeSizes[i];
 
-					// Define object points that can be used for tracking, if applicable
-					Vectors3 trackingObjectPoints;
+		const bool is2DCode = newCodeSize <= Scalar(0) || !world_T_newCode.isValid();
 
-					if (!is2DCode)
-					{
-						ocean_assert(newCodeSize > Scalar(0));
+		ocean_assert(forceDetectionOnlyAndAllow2DCodes_ || !is2DCode);
 
-						trackingObjectPoints = createTrackingObjectPoints(newCode, newCodeSize);
-					}
+		ObjectId objectId = invalidObjectId();
+		TrackedQRCodesMap::iterator iter;
 
-					iter = trackedQRCodesMap_.end();
-					bool isAdded = false;
-					std::tie(iter, isAdded) = trackedQRCodesMap_.emplace(std::piecewise_construct, std::forward_as_tuple(newCodeObjectId), std::forward_as_tuple(std::move(newCode), std::move(world_T_newCode), newCodeSize, std::move(trackingObjectPoints), /* trackingState */ TS_TRACKING, trackingTimestamp));
+		if (!is2DCode && isAlreadyTracked(trackedQRCodesMap_, newCode, world_T_newCode, newCodeSize, objectId))
+		{
+			// Update the code that has been tracked already
+			iter = trackedQRCodesMap_.find(objectId);
+			ocean_assert(iter != trackedQRCodesMap_.end());
 
-					ocean_assert(isAdded && iter != trackedQRCodesMap_.end());
-				}
+			if (iter->second.trackingState() != TS_TRACKING)
+			{
+				iter->second.updateTrackingPose(std::move(world_T_newCode), newCodeSize, trackingTimestamp);
 			}
 		}
-	}
+		else
+		{
+			// Add the code to the map of tracked codes.
+			const ObjectId newCodeObjectId = objectIdCounter_;
 
-	previousSharedAnyCameras_ = sharedAnyCameras;
-	previousFramePyramids_ = std::move(framePyramids);
+			++objectIdCounter_;
 
-	previousWorld_T_device_ = world_T_device;
-	previousDevice_T_cameras_ = std::move(device_T_cameras);
+			if (callbackNewQRCode_ != nullptr)
+			{
+				callbackNewQRCode_(newCode, world_T_newCode, newCodeSize, newCodeObjectId);
+			}
 
-	return trackedQRCodesMap_;
+			// Define object points that can be used for tracking, if applicable
+			Vectors3 trackingObjectPoints;
+
+			if (!is2DCode)
+			{
+				ocean_assert(newCodeSize > Scalar(0));
+
+				trackingObjectPoints = createTrackingObjectPoints(newCode, newCodeSize);
+			}
+
+			iter = trackedQRCodesMap_.end();
+			bool isAdded = false;
+			std::tie(iter, isAdded) = trackedQRCodesMap_.emplace(std::piecewise_construct, std::forward_as_tuple(newCodeObjectId), std::forward_as_tuple(std::move(newCode), std::move(world_T_newCode), newCodeSize, std::move(trackingObjectPoints), /* trackingState */ TS_TRACKING, trackingTimestamp));
+
+			ocean_assert(isAdded && iter != trackedQRCodesMap_.end());
+		}
+	}
 }
 
-constexpr QRCodeTracker3D::ObjectId QRCodeTracker3D::invalidObjectId()
+CV::PixelBoundingBox QRCodeTracker3D::determineDetectionRegion(const AnyCamera& anyCamera, const HomogenousMatrix4& world_T_camera, const HomogenousMatrix4& world_T_code, const Scalar codeSize)
 {
-	return ObjectId(-1);
+	ocean_assert(anyCamera.isValid());
+	ocean_assert(world_T_camera.isValid() && world_T_code.isValid());
+	ocean_assert(codeSize > Scalar(0));
+
+	const HomogenousMatrix4 flippedCamera_T_code = AnyCamera::standard2InvertedFlipped(world_T_camera) * world_T_code;
+
+	const Scalar codeSize_2 = codeSize * Scalar(0.5);
+
+	const Vector3 codeCorners[4] =
+	{
+		Vector3(-codeSize_2, codeSize_2, Scalar(0)),
+		Vector3(-codeSize_2, -codeSize_2, Scalar(0)),
+		Vector3(codeSize_2, -codeSize_2, Scalar(0)),
+		Vector3(codeSize_2, codeSize_2, Scalar(0))
+	};
+
+	Box2 codeBox;
+
+	for (const Vector3& codeCorner : codeCorners)
+	{
+		const Vector3 flippedCameraCorner = flippedCamera_T_code * codeCorner;
+
+		if (flippedCameraCorner.z() <= Numeric::eps())
+		{
+			// the code is (partially) located behind the camera
+			return CV::PixelBoundingBox();
+		}
+
+		codeBox += anyCamera.projectToImageIF(flippedCameraCorner);
+	}
+
+	// the region needs to cover the quiet zone around the code, and needs to compensate the motion since the code was lost
+
+	const Scalar margin = std::max(Scalar(16), std::max(codeBox.width(), codeBox.height()) * Scalar(0.5));
+
+	const Scalar left = std::max(Scalar(0), codeBox.lower().x() - margin);
+	const Scalar top = std::max(Scalar(0), codeBox.lower().y() - margin);
+	const Scalar right = std::min(Scalar(anyCamera.width() - 1u), codeBox.higher().x() + margin);
+	const Scalar bottom = std::min(Scalar(anyCamera.height() - 1u), codeBox.higher().y() + margin);
+
+	if (left > right || top > bottom)
+	{
+		// the code is not visible in the camera
+		return CV::PixelBoundingBox();
+	}
+
+	return CV::PixelBoundingBox((unsigned int)(left), (unsigned int)(top), (unsigned int)(right), (unsigned int)(bottom));
 }
 
 bool QRCodeTracker3D::trackQRCode(const SharedAnyCamera& previousSharedAnyCameraA, const SharedAnyCamera& previousSharedAnyCameraB, const HomogenousMatrix4& previousWorld_T_device, const HomogenousMatrix4& previousDevice_T_cameraA, const HomogenousMatrix4& previousDevice_T_cameraB, const SharedAnyCamera& sharedAnyCameraA, const SharedAnyCamera& sharedAnyCameraB, const HomogenousMatrix4& world_T_device, const HomogenousMatrix4& device_T_cameraA, const HomogenousMatrix4& device_T_cameraB, const CV::FramePyramid& previousFramePyramidA, const CV::FramePyramid& previousFramePyramidB, const CV::FramePyramid& framePyramidA, const CV::FramePyramid& framePyramidB, const Timestamp& trackingTimestamp, TrackedQRCode& trackedCode)
@@ -10,6 +10,7 @@
 #include "ocean/tracking/qrcodes/QRCodes.h"
 
 #include "ocean/cv/FramePyramid.h"
+#include "ocean/cv/PixelBoundingBox.h"
 
 #include "ocean/cv/detector/qrcodes/QRCodeDetector3D.h"
 
@@ -81,6 +82,9 @@ class OCEAN_TRACKING_QRCODES_EXPORT QRCodeTracker3D : public CV::Detector::QRCod
 
 			/// The maximum amount of outliers (points) that different observations may have to be counted as identical, in percent, range: [0, 1]
 			Scalar observationHistoryMaxOutliersPercent = Scalar(0.1);
+
+			/// True, to re-detect lost codes in the regions in which they are expected (in each frame between two regular detections); False, to re-detect lost codes with the regular detection only
+			bool redetectLostCodesInRegions_ = true;
 		};
 
 		/**
@@ -347,6 +351,26 @@ class OCEAN_TRACKING_QRCODES_EXPORT QRCodeTracker3D : public CV::Detector::QRCod
 		 */
 		static bool trackQRCode(const SharedAnyCamera& previousSharedAnyCameraA, const SharedAnyCamera& previousSharedAnyCameraB, const HomogenousMatrix4& previousWorld_T_device, const HomogenousMatrix4& previousDevice_T_cameraA, const HomogenousMatrix4& previousDevice_T_cameraB, const SharedAnyCamera& sharedAnyCameraA, const SharedAnyCamera& sharedAnyCameraB, const HomogenousMatrix4& world_T_device, const HomogenousMatrix4& device_T_cameraA, const HomogenousMatrix4& device_T_cameraB, const CV::FramePyramid& previousFramePyramidA, const CV::FramePyramid& previousFramePyramidB, const CV::FramePyramid& framePyramidA, const CV::FramePyramid& framePyramidB, const Timestamp& trackingTimestamp, TrackedQRCode& trackedCode);
 
+		/**
+		 * Adds new detections to the database of tracked QR codes, detections of codes which are already known update the poses of these codes.
+		 * @param newCodes The detected codes, will be moved
+		 * @param world_T_newCodes The 6DOF poses of the detected codes, one for each code, will be moved
+		 * @param newCodeSizes The sizes of the detected codes, one for each code
+		 * @param trackingTimestamp The time stamp of the detections, must be valid
+		 */
+		void addDetectedCodes(CV::Detector::QRCodes::QRCodes& newCodes, HomogenousMatrices4& world_T_newCodes, const Scalars& newCodeSizes, const Timestamp& trackingTimestamp);
+
+		/**
+		 * Determines the image region in which a known code is expected to be visible.
+		 * The region covers the projected code and includes a margin for the quiet zone and for the motion since the code was observed.
+		 * @param anyCamera The camera for which the region will be determined, must be valid
+		 * @param world_T_camera The transformation between camera and world, must be valid
+		 * @param world_T_code The most recent 6DOF pose of the code, must be valid
+		 * @param codeSize The size of the code in the physical world, in meters, range: (0, infinity)
+		 * @return The region, clipped to the camera image, invalid if the code is not visible in the camera
+		 */
+		static CV::PixelBoundingBox determineDetectionRegion(const AnyCamera& anyCamera, const HomogenousMatrix4& world_T_camera, const HomogenousMatrix4& world_T_code, const Scalar codeSize);
+
 		/**
 		 * Checks if a specified code is already stored in the database of tracked QR codes.
 		 * @param trackedQRCodesMap The map containing all currently tracked QR codes.
@@ -21,6 +21,265 @@ namespace Tracking
 namespace RMV
 {
 
+template <Geometry::Estimator::EstimatorType tEstimator>
+Scalar RandomModelVariation::PointCloudGrid::averagedRobustErrorInPointCloud(const Vector2* imagePoints, const size_t numberImagePoints, const size_t validImagePoints, const Vector2* candidatePoints, const size_t numberCandidatePoints, const Geometry::Error::ErrorDetermination errorDetermination)
+{
+	ocean_assert(imagePoints && candidatePoints);
+	ocean_assert(numberImagePoints <= numberCandidatePoints);
+	ocean_assert(validImagePoints <= numberImagePoints);
+
+	if (errorDetermination == Geometry::Error::ED_UNIQUE)
+	{
+		// the unique error needs all pairs of points, so that a grid does not help
+		return Geometry::Error::averagedRobustErrorInPointCloud<tEstimator>(imagePoints, numberImagePoints, validImagePoints, candidatePoints, numberCandidatePoints, errorDetermination);
+	}
+
+	ocean_assert(errorDetermination == Geometry::Error::ED_APPROXIMATED || errorDetermination == Geometry::Error::ED_AMBIGUOUS);
+
+	if (numberImagePoints > numberCandidatePoints)
+	{
+		return Numeric::maxValue();
+	}
+
+	if (validImagePoints == 0 || numberImagePoints == 0)
+	{
+		return 0;
+	}
+
+	distributeCandidates(imagePoints, numberImagePoints, candidatePoints, numberCandidatePoints);
+
+	const bool skipUsedCandidates = errorDetermination == Geometry::Error::ED_APPROXIMATED;
+
+	if (skipUsedCandidates)
+	{
+		usedCandidates_.assign(numberCandidatePoints, 0u);
+	}
+
+	sqrErrors_.resize(numberImagePoints);
+
+	for (size_t n = 0; n < numberImagePoints; ++n)
+	{
+		const Index32 candidateIndex = nearestCandidate(imagePoints[n], candidatePoints, skipUsedCandidates, sqrErrors_[n]);
+		ocean_assert(candidateIndex < numberCandidatePoints);
+
+		if (skipUsedCandidates)
+		{
+			ocean_assert(usedCandidates_[candidateIndex] == 0u);
+			usedCandidates_[candidateIndex] = 1u;
+		}
+	}
+
+	const size_t numberUsedErrors = min(validImagePoints, numberImagePoints);
+
+	// we need the smallest errors in ascending order, to sum them up in the same order as Geometry::Error does
+
+	std::nth_element(sqrErrors_.begin(), sqrErrors_.begin() + (numberUsedErrors - 1), sqrErrors_.end());
+	std::sort(sqrErrors_.begin(), sqrErrors_.begin() + numberUsedErrors);
+
+	// the ambiguous error applies the robust estimator for standard estimators only, as done in Geometry::Error
+	const bool applyEstimator = errorDetermination == Geometry::Error::ED_APPROXIMATED ? !Geometry::Estimator::isStandardEstimator<tEstimator>() : Geometry::Estimator::isStandardEstimator<tEstimator>();
+
+	if (applyEstimator)
+	{
+		return Geometry::Error::averagedRobustError<tEstimator>(sqrErrors_.data(), numberUsedErrors);
+	}
+
+	Scalar sqrErrors = 0;
+
+	for (size_t n = 0; n < numberUsedErrors; ++n)
+	{
+		sqrErrors += sqrErrors_[n];
+	}
+
+	return sqrErrors / Scalar(numberUsedErrors);
+}
+
+void RandomModelVariation::PointCloudGrid::distributeCandidates(const Vector2* imagePoints, const size_t numberImagePoints, const Vector2* candidatePoints, const size_t numberCandidatePoints)
+{
+	ocean_assert(imagePoints && numberImagePoints != 0);
+	ocean_assert(candidatePoints && numberCandidatePoints != 0);
+
+	Scalar left = imagePoints[0].x();
+	Scalar top = imagePoints[0].y();
+	Scalar right = left;
+	Scalar bottom = top;
+
+	for (size_t n = 1; n < numberImagePoints; ++n)
+	{
+		left = min(left, imagePoints[n].x());
+		top = min(top, imagePoints[n].y());
+		right = max(right, imagePoints[n].x());
+		bottom = max(bottom, imagePoints[n].y());
+	}
+
+	// the grid covers the candidate points as well, as long as they are located close to the image points
+
+	const Scalar margin = max(Scalar(1), max(right - left, bottom - top));
+
+	const Scalar leftLimit = left - margin;
+	const Scalar topLimit = top - margin;
+	const Scalar rightLimit = right + margin;
+	const Scalar bottomLimit = bottom + margin;
+
+	for (size_t n = 0; n < numberCandidatePoints; ++n)
+	{
+		const Vector2& candidatePoint = candidatePoints[n];
+
+		if (candidatePoint.x() >= leftLimit && candidatePoint.y() >= topLimit && candidatePoint.x() <= rightLimit && candidatePoint.y() <= bottomLimit)
+		{
+			left = min(left, candidatePoint.x());
+			top = min(top, candidatePoint.y());
+			right = max(right, candidatePoint.x());
+			bottom = max(bottom, candidatePoint.y());
+		}
+	}
+
+	const Scalar width = max(Scalar(1), right - left);
+	const Scalar height = max(Scalar(1), bottom - top);
+
+	// we select square bins so that each bin holds approximately two candidates (if the candidates are located in the area of the image points)
+
+	constexpr unsigned int maximalBins = 64u;
+
+	binSize_ = max(Numeric::sqrt(width * height * Scalar(2) / Scalar(numberCandidatePoints)), max(width, height) / Scalar(maximalBins));
+	ocean_assert(binSize_ > 0);
+
+	left_ = left;
+	top_ = top;
+
+	horizontalBins_ = minmax(1u, (unsigned int)(width / binSize_) + 1u, maximalBins);
+	verticalBins_ = minmax(1u, (unsigned int)(height / binSize_) + 1u, maximalBins);
+
+	const unsigned int bins = horizontalBins_ * verticalBins_;
+
+	binOffsets_.assign(bins + 1u, 0u);
+	candidateBins_.resize(numberCandidatePoints);
+	outsideCandidates_.clear();
+
+	const Scalar invBinSize = Scalar(1) / binSize_;
+
+	for (size_t n = 0; n < numberCandidatePoints; ++n)
+	{
+		const Scalar x = (candidatePoints[n].x() - left_) * invBinSize;
+		const Scalar y = (candidatePoints[n].y() - top_) * invBinSize;
+
+		if (x >= 0 && y >= 0 && x < Scalar(horizontalBins_) && y < Scalar(verticalBins_))
+		{
+			const Index32 bin = (unsigned int)(y) * horizontalBins_ + (unsigned int)(x);
+
+			candidateBins_[n] = bin;
+			++binOffsets_[bin + 1u];
+		}
+		else
+		{
+			candidateBins_[n] = Index32(-1);
+			outsideCandidates_.push_back(Index32(n));
+		}
+	}
+
+	for (unsigned int n = 1u; n <= bins; ++n)
+	{
+		binOffsets_[n] += binOffsets_[n - 1u];
+	}
+
+	binCandidates_.resize(binOffsets_[bins]);
+
+	// the candidates are added in ascending order, so that candidates within a bin are sorted by their index
+
+	for (size_t n = 0; n < numberCandidatePoints; ++n)
+	{
+		const Index32 bin = candidateBins_[n];
+
+		if (bin != Index32(-1))
+		{
+			// we use the offsets of the previous bins as write positions, they will be restored below
+			binCandidates_[binOffsets_[bin]++] = Index32(n);
+		}
+	}
+
+	for (unsigned int n = bins; n >= 1u; --n)
+	{
+		binOffsets_[n] = binOffsets_[n - 1u];
+	}
+
+	binOffsets_[0] = 0u;
+}
+
+Index32 RandomModelVariation::PointCloudGrid::nearestCandidate(const Vector2& imagePoint, const Vector2* candidatePoints, const bool skipUsedCandidates, Scalar& sqrDistance) const
+{
+	ocean_assert(candidatePoints != nullptr);
+	ocean_assert(horizontalBins_ != 0u && verticalBins_ != 0u);
+
+	Scalar bestSqrDistance = Numeric::maxValue();
+	Index32 bestIndex = Index32(-1);
+
+	const auto testCandidate = [&](const Index32 candidateIndex)
+	{
+		if (skipUsedCandidates && usedCandidates_[candidateIndex] != 0u)
+		{
+			return;
+		}
+
+		const Scalar value = imagePoint.sqrDistance(candidatePoints[candidateIndex]);
+
+		// in case of identical distances, the candidate with smaller index wins (as when testing all candidates in order)
+		if (value < bestSqrDistance || (value == bestSqrDistance && candidateIndex < bestIndex))
+		{
+			bestSqrDistance = value;
+			bestIndex = candidateIndex;
+		}
+	};
+
+	for (const Index32 candidateIndex : outsideCandidates_)
+	{
+		testCandidate(candidateIndex);
+	}
+
+	const int binX = minmax(0, int((imagePoint.x() - left_) / binSize_), int(horizontalBins_) - 1);
+	const int binY = minmax(0, int((imagePoint.y() - top_) / binSize_), int(verticalBins_) - 1);
+
+	const int maximalRing = int(max(horizontalBins_, verticalBins_));
+
+	for (int ring = 0; ring <= maximalRing; ++ring)
+	{
+		const int yStart = max(0, binY - ring);
+		const int yEnd = min(int(verticalBins_) - 1, binY + ring);
+
+		for (int y = yStart; y <= yEnd; ++y)
+		{
+			const bool borderRow = y == binY - ring || y == binY + ring;
+
+			// inner rows of the ring contain the left and right bin only
+			const int xStep = borderRow ? 1 : max(1, 2 * ring);
+
+			for (int x = binX - ring; x <= binX + ring; x += xStep)
+			{
+				if (x < 0 || x >= int(horizontalBins_))
+				{
+					continue;
+				}
+
+				const unsigned int bin = (unsigned int)(y) * horizontalBins_ + (unsigned int)(x);
+
+				for (Index32 n = binOffsets_[bin]; n < binOffsets_[bin + 1u]; ++n)
+				{
+					testCandidate(binCandidates_[n]);
+				}
+			}
+		}
+
+		// all candidates in bins outside of the current ring have a distance of at least 'ring * binSize_'
+		if (bestSqrDistance < Numeric::sqr(Scalar(ring) * binSize_))
+		{
+			break;
+		}
+	}
+
+	sqrDistance = bestSqrDistance;
+
+	return bestIndex;
+}
+
 template <bool tLessImagePoints>
 bool RandomModelVariation::optimizedPoseFromPointCloudsWithOneInitialPoseIF(const HomogenousMatrix4& initialFlippedCamera_T_world, const AnyCamera& camera, const Vector3* objectPoints, const size_t numberObjectPoints, const Vector2* imagePoints, const size_t numberImagePoints, const size_t numberValidCorrespondences, RandomGenerator& randomGenerator, HomogenousMatrix4& flippedCamera_T_world, const Geometry::Error::ErrorDetermination errorDetermination, const Scalar targetAverageSqrError, const Vector3& maximalTranslationOffset, const Scalar maximalOrientationOffset, const double timeout, Scalar* resultingSqrError, IndexPairs32* correspondences, bool* explicitStop, Worker* worker)
 {
@@ -172,7 +431,10 @@ bool RandomModelVariation::optimizedPoseFromPointCloudsAbortableIF(const Homogen
 
 	ocean_assert(smallPointGroup != largePointGroup);
 
-	const Scalar initialError = Geometry::Error::averagedRobustErrorInPointCloud<Geometry::Estimator::ET_HUBER>(smallPointGroup, smallPointGroupNumber, numberValidCorrespondences, largePointGroup, largePointGroupNumber, errorDetermination);
+	// the grid is re-used for all hypotheses of this thread
+	PointCloudGrid pointCloudGrid;
+
+	const Scalar initialError = pointCloudGrid.averagedRobustErrorInPointCloud<Geometry::Estimator::ET_HUBER>(smallPointGroup, smallPointGroupNumber, numberValidCorrespondences, largePointGroup, largePointGroupNumber, errorDetermination);
 
 	// check whether the initial pose is accurate enough
 	if (initialError <= targetAverageSqrError)
@@ -220,7 +482,7 @@ bool RandomModelVariation::optimizedPoseFromPointCloudsAbortableIF(const Homogen
 				return false;
 			}
 
-			const Scalar testError = Geometry::Error::averagedRobustErrorInPointCloud<Geometry::Estimator::ET_HUBER>(smallPointGroup, smallPointGroupNumber, numberValidCorrespondences, largePointGroup, largePointGroupNumber, errorDetermination);
+			const Scalar testError = pointCloudGrid.averagedRobustErrorInPointCloud<Geometry::Estimator::ET_HUBER>(smallPointGroup, smallPointGroupNumber, numberValidCorrespondences, largePointGroup, largePointGroupNumber, errorDetermination);
 
 			if (testError > optimizedError)
 			{
@@ -33,6 +33,91 @@ namespace RMV
  */
 class OCEAN_TRACKING_RMV_EXPORT RandomModelVariation
 {
+	protected:
+
+		/**
+		 * This class implements a uniform grid for nearest neighbor lookups between two point clouds.
+		 * The grid covers the area of the query points (and nearby candidate points) and holds the candidate points so that the nearest candidate of a query point can be found without testing all candidates.<br>
+		 * Candidate points outside of the grid are tested for each lookup.<br>
+		 * The resulting errors are identical to the errors of Geometry::Error::averagedRobustErrorInPointCloud(), the object keeps all intermediate buffers so that the grid can be updated for each pose hypothesis without memory allocations.
+		 */
+		class PointCloudGrid
+		{
+			public:
+
+				/**
+				 * Determines the robust minimal average square error between two 2D point clouds.
+				 * The function returns the same error as Geometry::Error::averagedRobustErrorInPointCloud(), unique errors are forwarded to this function.
+				 * @param imagePoints Image points to determine the minimal errors for, must be valid
+				 * @param numberImagePoints Number of given image points, with range [1, numberCandidatePoints]
+				 * @param validImagePoints The number of image points which can be expected to have a corresponding point inside the candidate set, with range [1, numberImagePoints]
+				 * @param candidatePoints Possible candidate points to be used for finding the minimal error, must be valid
+				 * @param numberCandidatePoints Number of given candidate points, with range [1, infinity)
+				 * @param errorDetermination The error determination to be used
+				 * @return Robust averaged square error
+				 * @tparam tEstimator Estimator type to be applied
+				 */
+				template <Geometry::Estimator::EstimatorType tEstimator>
+				Scalar averagedRobustErrorInPointCloud(const Vector2* imagePoints, const size_t numberImagePoints, const size_t validImagePoints, const Vector2* candidatePoints, const size_t numberCandidatePoints, const Geometry::Error::ErrorDetermination errorDetermination);
+
+			protected:
+
+				/**
+				 * Distributes the candidate points into a grid covering the image points and the nearby candidate points.
+				 * @param imagePoints The image points defining the area of the grid, must be valid
+				 * @param numberImagePoints The number of image points, with range [1, infinity)
+				 * @param candidatePoints The candidate points to distribute, must be valid
+				 * @param numberCandidatePoints The number of candidate points, with range [1, infinity)
+				 */
+				void distributeCandidates(const Vector2* imagePoints, const size_t numberImagePoints, const Vector2* candidatePoints, const size_t numberCandidatePoints);
+
+				/**
+				 * Determines the nearest candidate point of an image point.
+				 * In case several candidate points have the same distance, the candidate with smallest index is returned.
+				 * @param imagePoint The image point for which the nearest candidate will be determined, must be located inside the area of the grid
+				 * @param candidatePoints The candidate points which have been distributed, must be valid
+				 * @param skipUsedCandidates True, to skip all candidates which have been marked as used
+				 * @param sqrDistance The resulting square distance between image point and nearest candidate point
+				 * @return The index of the nearest candidate point, -1 if no candidate point exists
+				 */
+				Index32 nearestCandidate(const Vector2& imagePoint, const Vector2* candidatePoints, const bool skipUsedCandidates, Scalar& sqrDistance) const;
+
+			protected:
+
+				/// The left border of the grid.
+				Scalar left_ = 0;
+
+				/// The top border of the grid.
+				Scalar top_ = 0;
+
+				/// The size of one (square) bin.
+				Scalar binSize_ = 1;
+
+				/// The number of horizontal bins.
+				unsigned int horizontalBins_ = 0u;
+
+				/// The number of vertical bins.
+				unsigned int verticalBins_ = 0u;
+
+				/// The index of the first candidate of each bin within 'binCandidates_', with one additional element at the end.
+				Indices32 binOffsets_;
+
+				/// The indices of all candidates inside the grid, sorted by bins.
+				Indices32 binCandidates_;
+
+				/// The indices of all candidates outside the grid.
+				Indices32 outsideCandidates_;
+
+				/// The bin of each candidate point, -1 for candidates outside the grid.
+				Indices32 candidateBins_;
+
+				/// The usage state of each candidate point, 1 if the candidate has been assigned already.
+				std::vector<uint8_t> usedCandidates_;
+
+				/// The minimal square errors of the image points.
+				Scalars sqrErrors_;
+		};
+
 	public:
 
 		/**
@@ -7,6 +7,7 @@
 
 #include "ocean/tracking/slam/BackgroundTask.h"
 
+#include "ocean/base/HighPerformanceTimer.h"
 #include "ocean/base/Thread.h"
 
 namespace Ocean
@@ -160,7 +161,12 @@ void BackgroundTask::threadRun(std::stop_token stopToken)
 
 		// execute the task without holding the lock
 		ocean_assert(task_);
-		task_();
+
+		{
+			const HighPerformanceBenchmark::ScopedCategory scopedCategory("BackgroundTask");
+
+			task_();
+		}
 
 		// signal that the task has been processed
 
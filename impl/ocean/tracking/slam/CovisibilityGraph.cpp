@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "ocean/tracking/slam/CovisibilityGraph.h"
+
+namespace Ocean
+{
+
+namespace Tracking
+{
+
+namespace SLAM
+{
+
+void CovisibilityGraph::addObservations(const Index32 objectPointId, const PointTrack& pointTrack)
+{
+	ocean_assert(objectPointId != Index32(-1));
+	ocean_assert(pointTrack.isValid());
+
+	for (Index32 frameIndex = pointTrack.firstFrameIndex(); frameIndex <= pointTrack.lastFrameIndex(); ++frameIndex)
+	{
+		frameMap_[frameIndex].push_back(objectPointId);
+	}
+}
+
+size_t CovisibilityGraph::numberLocalizedObjectPoints(const Index32 frameIndex, const LocalizedObjectPointMap& localizedObjectPointMap) const
+{
+	const Indices32* ids = objectPointIds(frameIndex);
+
+	if (ids == nullptr)
+	{
+		return 0;
+	}
+
+	size_t number = 0;
+
+	for (const Index32 objectPointId : *ids)
+	{
+		const LocalizedObjectPointMap::const_iterator iObjectPoint = localizedObjectPointMap.find(objectPointId);
+
+		if (iObjectPoint != localizedObjectPointMap.cend())
+		{
+			ocean_assert(iObjectPoint->second.hasObservation(frameIndex));
+
+			++number;
+		}
+	}
+
+	return number;
+}
+
+}
+
+}
+
+}
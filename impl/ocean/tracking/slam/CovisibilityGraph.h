@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#ifndef META_OCEAN_TRACKING_SLAM_COVISIBILITY_GRAPH_H
+#define META_OCEAN_TRACKING_SLAM_COVISIBILITY_GRAPH_H
+
+#include "ocean/tracking/slam/SLAM.h"
+#include "ocean/tracking/slam/LocalizedObjectPoint.h"
+#include "ocean/tracking/slam/PointTrack.h"
+
+#include "ocean/base/HashMap.h"
+
+namespace Ocean
+{
+
+namespace Tracking
+{
+
+namespace SLAM
+{
+
+/**
+ * This class implements a co-visibility graph connecting frames with the localized object points observed in the frames.
+ * The graph is updated incrementally whenever observations are added to localized object points, so that the topology of a Bundle Adjustment can be determined without visiting the entire map.<br>
+ * Object points which are removed from the map are not removed from the graph explicitly, instead all lookups verify the object points against the map of localized object points.<br>
+ * The object is not thread-safe, the graph needs to be protected by the same lock as the map of localized object points.
+ * @ingroup trackingslam
+ */
+class OCEAN_TRACKING_SLAM_EXPORT CovisibilityGraph
+{
+	protected:
+
+		/**
+		 * Definition of a map mapping frame indices to the ids of all object points observed in the frame.
+		 */
+		using FrameMap = FlatHashMap<Index32, Indices32>;
+
+	public:
+
+		/**
+		 * Creates a new empty graph.
+		 */
+		CovisibilityGraph() = default;
+
+		/**
+		 * Adds a new observation of a localized object point.
+		 * Complexity: O(1).
+		 * @param frameIndex The index of the frame in which the object point is observed, with range [0, infinity)
+		 * @param objectPointId The id of the observed object point, must be valid
+		 */
+		inline void addObservation(const Index32 frameIndex, const Index32 objectPointId);
+
+		/**
+		 * Adds all observations of a point track for a localized object point.
+		 * Complexity: O(pointTrack.numberObservations()).
+		 * @param objectPointId The id of the localized object point which received the observations of the point track, must be valid
+		 * @param pointTrack The point track providing the observations, must be valid
+		 */
+		void addObservations(const Index32 objectPointId, const PointTrack& pointTrack);
+
+		/**
+		 * Returns the ids of all object points which have been observed in a frame.
+		 * The ids may contain object points which have been removed from the map of localized object points in the meantime.
+		 * @param frameIndex The index of the frame, with range [0, infinity)
+		 * @return The ids of the observed object points, nullptr if the frame does not contain any observation
+		 */
+		inline const Indices32* objectPointIds(const Index32 frameIndex) const;
+
+		/**
+		 * Returns the number of localized object points which are observed in a frame.
+		 * Complexity: O(number of observations in the frame).
+		 * @param frameIndex The index of the frame, with range [0, infinity)
+		 * @param localizedObjectPointMap The map of all localized object points, used to skip removed object points
+		 * @return The number of localized object points observed in the frame
+		 */
+		size_t numberLocalizedObjectPoints(const Index32 frameIndex, const LocalizedObjectPointMap& localizedObjectPointMap) const;
+
+		/**
+		 * Removes all frames from this graph.
+		 */
+		inline void clear();
+
+		/**
+		 * Returns whether this graph does not contain any observation.
+		 * @return True, if so
+		 */
+		inline bool isEmpty() const;
+
+	protected:
+
+		/// The map mapping frame indices to the ids of the object points observed in the frames.
+		FrameMap frameMap_;
+};
+
+inline void CovisibilityGraph::addObservation(const Index32 frameIndex, const Index32 objectPointId)
+{
+	ocean_assert(objectPointId != Index32(-1));
+
+	frameMap_[frameIndex].push_back(objectPointId);
+}
+
+inline const Indices32* CovisibilityGraph::objectPointIds(const Index32 frameIndex) const
+{
+	const FrameMap::const_iterator iFrame = frameMap_.find(frameIndex);
+
+	if (iFrame == frameMap_.cend())
+	{
+		return nullptr;
+	}
+
+	return &iFrame->second;
+}
+
+inline void CovisibilityGraph::clear()
+{
+	frameMap_.clear();
+}
+
+inline bool CovisibilityGraph::isEmpty() const
+{
+	return frameMap_.empty();
+}
+
+}
+
+}
+
+}
+
+#endif // META_OCEAN_TRACKING_SLAM_COVISIBILITY_GRAPH_H
@@ -53,40 +53,32 @@ FramePyramidManager::ScopedPyramid FramePyramidManager::newPyramid(const Index32
 
 	const ScopedLock scopedLock(lock_);
 
-#ifdef OCEAN_DEBUG
-
-	for (const SharedObject& object : usedObjects_)
-	{
-		ocean_assert(object);
-		ocean_assert(object->frameIndex_ != frameIndex);
-	}
-
-#endif // OCEAN_DEBUG
+	Object& object = newObject(frameIndex);
 
-	Object* object = nullptr;
+	return ScopedPyramid(*this, object.framePyramid_, frameIndex);
+}
 
-	if (!freeObjects_.empty())
-	{
-		// we re-used an existing object
-		usedObjects_.emplaceBack(std::move(freeObjects_.back()));
-		object = usedObjects_.back().get();
+FramePyramidManager::ScopedPyramid FramePyramidManager::newPyramid(const Index32 frameIndex, const CV::FramePyramidCache::SharedFramePyramid& sharedFramePyramid, const unsigned int layers)
+{
+	ocean_assert(frameIndex != Index32(-1));
+	ocean_assert(sharedFramePyramid && sharedFramePyramid->isValid());
+	ocean_assert(layers >= 1u);
 
-		freeObjects_.popBack();
-	}
-	else
+	if (!sharedFramePyramid || !sharedFramePyramid->isValid() || layers == 0u)
 	{
-		// we have to create a new object
-		usedObjects_.emplaceBack(std::make_shared<Object>());
-		object = usedObjects_.back().get();
+		return ScopedPyramid();
 	}
 
-	ocean_assert(object->frameIndex_ == Index32(-1));
-	object->frameIndex_ = frameIndex;
+	const ScopedLock scopedLock(lock_);
 
-	ocean_assert(object->usageCounter_ == 0u);
-	object->usageCounter_ = 1u;
+	Object& object = newObject(frameIndex);
+
+	// the pyramid uses the memory of the shared pyramid without copying the image content
+
+	object.framePyramid_ = CV::FramePyramid(*sharedFramePyramid, 0u, layers, false /*copyData*/);
+	object.sharedFramePyramid_ = sharedFramePyramid;
 
-	return ScopedPyramid(*this, object->framePyramid_, frameIndex);
+	return ScopedPyramid(*this, object.framePyramid_, frameIndex);
 }
 
 FramePyramidManager::ScopedPyramid FramePyramidManager::existingPyramid(const Index32 frameIndex)
@@ -155,6 +147,46 @@ void FramePyramidManager::updateLatest(const Index32 frameIndex)
 	ocean_assert(false && "The pyramid does not exist!");
 }
 
+FramePyramidManager::Object& FramePyramidManager::newObject(const Index32 frameIndex)
+{
+	ocean_assert(frameIndex != Index32(-1));
+
+#ifdef OCEAN_DEBUG
+
+	for (const SharedObject& object : usedObjects_)
+	{
+		ocean_assert(object);
+		ocean_assert(object->frameIndex_ != frameIndex);
+	}
+
+#endif // OCEAN_DEBUG
+
+	Object* object = nullptr;
+
+	if (!freeObjects_.empty())
+	{
+		// we re-used an existing object
+		usedObjects_.emplaceBack(std::move(freeObjects_.back()));
+		object = usedObjects_.back().get();
+
+		freeObjects_.popBack();
+	}
+	else
+	{
+		// we have to create a new object
+		usedObjects_.emplaceBack(std::make_shared<Object>());
+		object = usedObjects_.back().get();
+	}
+
+	ocean_assert(object->frameIndex_ == Index32(-1));
+	object->frameIndex_ = frameIndex;
+
+	ocean_assert(object->usageCounter_ == 0u);
+	object->usageCounter_ = 1u;
+
+	return *object;
+}
+
 void FramePyramidManager::unlockPyramid(const Index32 frameIndex)
 {
 	ocean_assert(frameIndex != Index32(-1));
@@ -176,6 +208,14 @@ void FramePyramidManager::unlockPyramid(const Index32 frameIndex)
 			{
 				object->frameIndex_ = Index32(-1);
 
+				if (object->sharedFramePyramid_)
+				{
+					// the pyramid does not own the memory, so that the pyramid cannot be reused
+
+					object->framePyramid_.clear();
+					object->sharedFramePyramid_ = nullptr;
+				}
+
 				freeObjects_.emplaceBack(std::move(object));
 
 				usedObjects_[nObject] = std::move(usedObjects_.back());
@@ -14,6 +14,7 @@
 #include "ocean/base/StaticVector.h"
 
 #include "ocean/cv/FramePyramid.h"
+#include "ocean/cv/FramePyramidCache.h"
 
 namespace Ocean
 {
@@ -26,7 +27,8 @@ namespace SLAM
 
 /**
  * This class manages a pool of frame pyramids for efficient reuse.
- * The manager provides thread-safe access to frame pyramids with automatic lifetime management.
+ * The manager provides thread-safe access to frame pyramids with automatic lifetime management.<br>
+ * Pyramids can either be created by the manager's user, or can be taken from a CV::FramePyramidCache shared with other trackers processing the same camera stream.
  * @ingroup trackingslam
  */
 class OCEAN_TRACKING_SLAM_EXPORT FramePyramidManager
@@ -187,8 +189,11 @@ class OCEAN_TRACKING_SLAM_EXPORT FramePyramidManager
 				/// The usage counter.
 				unsigned int usageCounter_ = 0u;
 
-				/// The actual frame pyramid.
+				/// The actual frame pyramid, either owning the memory or using the memory of the shared pyramid.
 				CV::FramePyramid framePyramid_;
+
+				/// The shared pyramid from a pyramid cache which is used by the frame pyramid, nullptr if the frame pyramid owns the memory.
+				CV::FramePyramidCache::SharedFramePyramid sharedFramePyramid_;
 		};
 
 		/// Definition of a shared pointer to an object.
@@ -211,6 +216,16 @@ class OCEAN_TRACKING_SLAM_EXPORT FramePyramidManager
 		 */
 		ScopedPyramid newPyramid(const Index32 frameIndex);
 
+		/**
+		 * Creates a new pyramid for a given frame index using the memory of a shared pyramid, e.g., from a CV::FramePyramidCache.
+		 * The shared pyramid is kept alive as long as the pyramid is used, the pyramid must not be modified.
+		 * @param frameIndex The frame index for which a new pyramid will be created, must be valid
+		 * @param sharedFramePyramid The shared pyramid which will be used, must be valid
+		 * @param layers The number of layers which will be used from the shared pyramid, with range [1, infinity), AS_MANY_LAYERS_AS_POSSIBLE to use all layers
+		 * @return The scoped pyramid object
+		 */
+		ScopedPyramid newPyramid(const Index32 frameIndex, const CV::FramePyramidCache::SharedFramePyramid& sharedFramePyramid, const unsigned int layers);
+
 		/**
 		 * Returns an existing pyramid for a given frame index.
 		 * @param frameIndex The frame index for which the pyramid will be returned, must be valid
@@ -231,6 +246,14 @@ class OCEAN_TRACKING_SLAM_EXPORT FramePyramidManager
 		 */
 		void updateLatest(const Index32 frameIndex);
 
+		/**
+		 * Acquires a free object (or creates a new one) and assigns it to a given frame index.
+		 * The manager's lock must be locked when calling this function.
+		 * @param frameIndex The frame index for which the object will be used, must be valid
+		 * @return The object, with usage counter 1
+		 */
+		Object& newObject(const Index32 frameIndex);
+
 		/**
 		 * Unlocks a pyramid for a given frame index.
 		 * @param frameIndex The frame index of the pyramid to unlock, must be valid
@@ -13,6 +13,7 @@
 #include "ocean/tracking/slam/Observation.h"
 #include "ocean/tracking/slam/PointTrack.h"
 
+#include "ocean/base/HashMap.h"
 #include "ocean/base/RandomGenerator.h"
 
 #include "ocean/cv/detector/FREAKDescriptor.h"
@@ -38,9 +39,10 @@ class LocalizedObjectPoint;
 
 /**
  * Definition of an unordered map mapping object point ids to localized object points.
+ * The map is based on open addressing, inserting or erasing points may invalidate iterators and references.
  * @ingroup trackingslam
  */
-using LocalizedObjectPointMap = std::unordered_map<Index32, LocalizedObjectPoint>;
+using LocalizedObjectPointMap = FlatHashMap<Index32, LocalizedObjectPoint>;
 
 /**
  * This class implements a localized 3D object point.
@@ -50,6 +52,8 @@ using LocalizedObjectPointMap = std::unordered_map<Index32, LocalizedObjectPoint
  */
 class OCEAN_TRACKING_SLAM_EXPORT LocalizedObjectPoint
 {
+	friend class MapJournal;
+
 	public:
 
 		/**
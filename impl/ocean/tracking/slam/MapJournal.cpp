@@ -0,0 +1,405 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "ocean/tracking/slam/MapJournal.h"
+
+namespace Ocean
+{
+
+namespace Tracking
+{
+
+namespace SLAM
+{
+
+MapJournal::PointRecord::PointRecord(const Index32 objectPointId, const LocalizedObjectPoint& localizedObjectPoint) :
+	objectPointId_(objectPointId),
+	position_(localizedObjectPoint.position()),
+	lastObservationFrameIndex_(localizedObjectPoint.lastObservationFrameIndex()),
+	localizationPrecision_(localizedObjectPoint.localizationPrecision())
+{
+	const LocalizedObjectPoint::ObservationMap& observationMap = localizedObjectPoint.observationMap_;
+
+	observations_.reserve(observationMap.size());
+
+	for (const LocalizedObjectPoint::ObservationMap::value_type& observationPair : observationMap)
+	{
+		observations_.emplace_back(observationPair.first, VectorF2(observationPair.second));
+	}
+
+	// sorting the observations to ensure a deterministic output
+
+	std::sort(observations_.begin(), observations_.end(), [](const Observation& observationA, const Observation& observationB)
+	{
+		return observationA.first < observationB.first;
+	});
+}
+
+bool MapJournal::PointRecord::read(IO::InputBitstream& inputBitstream)
+{
+	if (!inputBitstream.read<Index32>(objectPointId_))
+	{
+		return false;
+	}
+
+	if (!inputBitstream.readArray<float>(position_(), 3))
+	{
+		return false;
+	}
+
+	if (!inputBitstream.read<Index32>(lastObservationFrameIndex_))
+	{
+		return false;
+	}
+
+	uint8_t localizationPrecision = 0u;
+	if (!inputBitstream.read<uint8_t>(localizationPrecision))
+	{
+		return false;
+	}
+
+	if (localizationPrecision > uint8_t(LocalizedObjectPoint::LP_HIGH))
+	{
+		return false;
+	}
+
+	localizationPrecision_ = LocalizedObjectPoint::LocalizationPrecision(localizationPrecision);
+
+	uint32_t numberObservations = 0u;
+	if (!inputBitstream.read<uint32_t>(numberObservations))
+	{
+		return false;
+	}
+
+	constexpr uint32_t maximalObservations = 1000u * 1000u;
+
+	if (numberObservations > maximalObservations)
+	{
+		return false;
+	}
+
+	observations_.resize(numberObservations);
+
+	for (Observation& observation : observations_)
+	{
+		if (!inputBitstream.read<Index32>(observation.first))
+		{
+			return false;
+		}
+
+		if (!inputBitstream.read<float>(observation.second.x()) || !inputBitstream.read<float>(observation.second.y()))
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+bool MapJournal::PointRecord::write(IO::OutputBitstream& outputBitstream) const
+{
+	if (!outputBitstream.write<Index32>(objectPointId_))
+	{
+		return false;
+	}
+
+	if (!outputBitstream.writeArray<float>(position_(), 3))
+	{
+		return false;
+	}
+
+	if (!outputBitstream.write<Index32>(lastObservationFrameIndex_))
+	{
+		return false;
+	}
+
+	if (!outputBitstream.write<uint8_t>(uint8_t(localizationPrecision_)))
+	{
+		return false;
+	}
+
+	ocean_assert(NumericT<uint32_t>::isInsideValueRange(observations_.size()));
+	if (!outputBitstream.write<uint32_t>(uint32_t(observations_.size())))
+	{
+		return false;
+	}
+
+	for (const Observation& observation : observations_)
+	{
+		if (!outputBitstream.write<Index32>(observation.first))
+		{
+			return false;
+		}
+
+		if (!outputBitstream.write<float>(observation.second.x()) || !outputBitstream.write<float>(observation.second.y()))
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+MapJournal::DataSampleCheckpoint::DataSampleCheckpoint(const uint32_t checkpointIndex, const bool isSnapshot, PointRecords&& changedPoints, Indices32&& removedObjectPointIds, const Timestamp& timestamp) :
+	DataSample(IO::Serialization::DataTimestamp(double(timestamp))),
+	checkpointIndex_(checkpointIndex),
+	isSnapshot_(isSnapshot),
+	changedPoints_(std::move(changedPoints)),
+	removedObjectPointIds_(std::move(removedObjectPointIds))
+{
+	ocean_assert(timestamp.isValid());
+	ocean_assert(!isSnapshot_ || removedObjectPointIds_.empty());
+}
+
+bool MapJournal::DataSampleCheckpoint::readSample(IO::InputBitstream& inputBitstream)
+{
+	if (!DataSample::readSample(inputBitstream))
+	{
+		return false;
+	}
+
+	uint32_t version = 0u;
+	if (!inputBitstream.read<uint32_t>(version) || version != 1u)
+	{
+		return false;
+	}
+
+	if (!inputBitstream.read<uint32_t>(checkpointIndex_))
+	{
+		return false;
+	}
+
+	if (!inputBitstream.read<bool>(isSnapshot_))
+	{
+		return false;
+	}
+
+	constexpr uint32_t maximalElements = 100u * 1000u * 1000u;
+
+	uint32_t numberChangedPoints = 0u;
+	if (!inputBitstream.read<uint32_t>(numberChangedPoints) || numberChangedPoints > maximalElements)
+	{
+		return false;
+	}
+
+	changedPoints_.resize(numberChangedPoints);
+
+	for (PointRecord& pointRecord : changedPoints_)
+	{
+		if (!pointRecord.read(inputBitstream))
+		{
+			return false;
+		}
+	}
+
+	uint32_t numberRemovedObjectPointIds = 0u;
+	if (!inputBitstream.read<uint32_t>(numberRemovedObjectPointIds) || numberRemovedObjectPointIds > maximalElements)
+	{
+		return false;
+	}
+
+	removedObjectPointIds_.resize(numberRemovedObjectPointIds);
+
+	if (numberRemovedObjectPointIds != 0u && !inputBitstream.read(removedObjectPointIds_.data(), removedObjectPointIds_.size() * sizeof(Index32)))
+	{
+		return false;
+	}
+
+	return true;
+}
+
+bool MapJournal::DataSampleCheckpoint::writeSample(IO::OutputBitstream& outputBitstream) const
+{
+	if (!DataSample::writeSample(outputBitstream))
+	{
+		return false;
+	}
+
+	constexpr uint32_t version = 1u;
+
+	if (!outputBitstream.write<uint32_t>(version))
+	{
+		return false;
+	}
+
+	if (!outputBitstream.write<uint32_t>(checkpointIndex_))
+	{
+		return false;
+	}
+
+	if (!outputBitstream.write<bool>(isSnapshot_))
+	{
+		return false;
+	}
+
+	if (!NumericT<uint32_t>::isInsideValueRange(changedPoints_.size()) || !NumericT<uint32_t>::isInsideValueRange(removedObjectPointIds_.size()))
+	{
+		ocean_assert(false && "This should never happen!");
+		return false;
+	}
+
+	if (!outputBitstream.write<uint32_t>(uint32_t(changedPoints_.size())))
+	{
+		return false;
+	}
+
+	for (const PointRecord& pointRecord : changedPoints_)
+	{
+		if (!pointRecord.write(outputBitstream))
+		{
+			return false;
+		}
+	}
+
+	if (!outputBitstream.write<uint32_t>(uint32_t(removedObjectPointIds_.size())))
+	{
+		return false;
+	}
+
+	if (!removedObjectPointIds_.empty() && !outputBitstream.write(removedObjectPointIds_.data(), removedObjectPointIds_.size() * sizeof(Index32)))
+	{
+		return false;
+	}
+
+	return true;
+}
+
+const std::string& MapJournal::DataSampleCheckpoint::sampleType()
+{
+	static const std::string typeName = "ocean/tracking/slam/mapcheckpoint";
+
+	return typeName;
+}
+
+IO::Serialization::UniqueDataSample MapJournal::DataSampleCheckpoint::createSample(const std::string& /*sampleType*/)
+{
+	return std::make_unique<DataSampleCheckpoint>();
+}
+
+MapJournal::MapJournal(IO::Serialization::OutputDataSerializer& outputDataSerializer, const std::string& channelName, const unsigned int snapshotInterval) :
+	snapshotInterval_(snapshotInterval)
+{
+	ocean_assert(!channelName.empty());
+
+	channelId_ = outputDataSerializer.addChannel(DataSampleCheckpoint::sampleType(), channelName, "ocean/slam");
+
+	if (channelId_ != IO::Serialization::DataSerializer::invalidChannelId())
+	{
+		outputDataSerializer_ = &outputDataSerializer;
+	}
+}
+
+bool MapJournal::checkpoint(const LocalizedObjectPointMap& localizedObjectPointMap, const Timestamp& timestamp, const bool forceSnapshot, size_t* numberChangedPoints)
+{
+	ocean_assert(isValid());
+	ocean_assert(timestamp.isValid());
+
+	if (!isValid())
+	{
+		return false;
+	}
+
+	const bool isSnapshot = forceSnapshot || checkpoints_ == 0u || (snapshotInterval_ != 0u && checkpoints_ % snapshotInterval_ == 0u);
+
+	PointRecords changedPoints;
+	Indices32 removedObjectPointIds;
+
+	FingerprintMap fingerprintMap(localizedObjectPointMap.size());
+
+	for (const LocalizedObjectPointMap::value_type& objectPointPair : localizedObjectPointMap)
+	{
+		const Index32 objectPointId = objectPointPair.first;
+		const LocalizedObjectPoint& localizedObjectPoint = objectPointPair.second;
+
+		const Fingerprint fingerprint(localizedObjectPoint);
+
+		if (!isSnapshot)
+		{
+			const FingerprintMap::const_iterator iFingerprint = fingerprintMap_.find(objectPointId);
+
+			if (iFingerprint != fingerprintMap_.cend() && iFingerprint->second == fingerprint)
+			{
+				// the object point has not changed since the previous checkpoint
+				fingerprintMap.emplace(objectPointId, fingerprint);
+
+				continue;
+			}
+		}
+
+		changedPoints.emplace_back(objectPointId, localizedObjectPoint);
+
+		fingerprintMap.emplace(objectPointId, fingerprint);
+	}
+
+	if (!isSnapshot)
+	{
+		for (const FingerprintMap::value_type& fingerprintPair : fingerprintMap_)
+		{
+			if (!localizedObjectPointMap.contains(fingerprintPair.first))
+			{
+				removedObjectPointIds.push_back(fingerprintPair.first);
+			}
+		}
+	}
+
+	if (numberChangedPoints != nullptr)
+	{
+		*numberChangedPoints = changedPoints.size();
+	}
+
+	if (!isSnapshot && changedPoints.empty() && removedObjectPointIds.empty())
+	{
+		// nothing has changed, so there is no need to write an empty checkpoint
+		return true;
+	}
+
+	// the serializer's background thread takes care of the actual serialization, the tracking thread is not blocked
+
+	if (!outputDataSerializer_->addSample(channelId_, std::make_unique<DataSampleCheckpoint>(checkpoints_, isSnapshot, std::move(changedPoints), std::move(removedObjectPointIds), timestamp)))
+	{
+		return false;
+	}
+
+	fingerprintMap_ = std::move(fingerprintMap);
+
+	++checkpoints_;
+
+	return true;
+}
+
+void MapJournal::applyCheckpoint(const DataSampleCheckpoint& checkpoint, PointRecordMap& pointRecordMap)
+{
+	if (checkpoint.isSnapshot())
+	{
+		pointRecordMap.clear();
+	}
+
+	for (const Index32 removedObjectPointId : checkpoint.removedObjectPointIds())
+	{
+		pointRecordMap.erase(removedObjectPointId);
+	}
+
+	for (const PointRecord& pointRecord : checkpoint.changedPoints())
+	{
+		const PointRecordMap::iterator iPointRecord = pointRecordMap.find(pointRecord.objectPointId_);
+
+		if (iPointRecord != pointRecordMap.end())
+		{
+			iPointRecord->second = pointRecord;
+		}
+		else
+		{
+			pointRecordMap.emplace(pointRecord.objectPointId_, pointRecord);
+		}
+	}
+}
+
+}
+
+}
+
+}
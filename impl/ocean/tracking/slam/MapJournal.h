@@ -0,0 +1,374 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#ifndef META_OCEAN_TRACKING_SLAM_MAP_JOURNAL_H
+#define META_OCEAN_TRACKING_SLAM_MAP_JOURNAL_H
+
+#include "ocean/tracking/slam/SLAM.h"
+#include "ocean/tracking/slam/LocalizedObjectPoint.h"
+
+#include "ocean/base/HashMap.h"
+#include "ocean/base/Timestamp.h"
+
+#include "ocean/io/serialization/DataSample.h"
+#include "ocean/io/serialization/OutputDataSerializer.h"
+
+#include "ocean/math/Vector2.h"
+#include "ocean/math/Vector3.h"
+
+namespace Ocean
+{
+
+namespace Tracking
+{
+
+namespace SLAM
+{
+
+/**
+ * This class implements an incremental journal for maps of localized object points.
+ * Instead of writing the entire map at once (as LocalizedObjectPoint::serialize() does), the journal writes checkpoints containing only the object points which have been added, changed, or removed since the previous checkpoint.<br>
+ * A checkpoint copies the changed object points (without descriptors) into a data sample, the sample is then written by the background thread of an OutputDataSerializer so that the tracking thread is never blocked by the actual serialization.<br>
+ * The first checkpoint and every n-th checkpoint (if configured) is a full snapshot, a reader can start at any snapshot and apply all following deltas with applyCheckpoint().<br>
+ * The object is not thread-safe, the map needs to be protected (e.g., by a read lock) while a checkpoint is created.
+ * @ingroup trackingslam
+ */
+class OCEAN_TRACKING_SLAM_EXPORT MapJournal
+{
+	public:
+
+		/**
+		 * This class holds the serializable state of one localized object point.
+		 */
+		class PointRecord
+		{
+			public:
+
+				/**
+				 * Definition of a pair combining a frame index with an image point.
+				 */
+				using Observation = std::pair<Index32, VectorF2>;
+
+				/**
+				 * Definition of a vector holding observations.
+				 */
+				using Observations = std::vector<Observation>;
+
+			public:
+
+				/**
+				 * Creates an invalid record.
+				 */
+				PointRecord() = default;
+
+				/**
+				 * Creates a new record for a localized object point.
+				 * @param objectPointId The id of the object point, must be valid
+				 * @param localizedObjectPoint The localized object point to copy
+				 */
+				PointRecord(const Index32 objectPointId, const LocalizedObjectPoint& localizedObjectPoint);
+
+				/**
+				 * Reads the record from an input bitstream.
+				 * @param inputBitstream The input bitstream from which the record will be read
+				 * @return True, if succeeded
+				 */
+				bool read(IO::InputBitstream& inputBitstream);
+
+				/**
+				 * Writes the record to an output bitstream, using the same layout as LocalizedObjectPoint::serialize().
+				 * @param outputBitstream The output bitstream to which the record will be written
+				 * @return True, if succeeded
+				 */
+				bool write(IO::OutputBitstream& outputBitstream) const;
+
+			public:
+
+				/// The id of the object point.
+				Index32 objectPointId_ = Index32(-1);
+
+				/// The 3D position of the object point.
+				VectorF3 position_ = VectorF3(0.0f, 0.0f, 0.0f);
+
+				/// The index of the last observation.
+				Index32 lastObservationFrameIndex_ = Index32(-1);
+
+				/// The localization precision of the object point.
+				LocalizedObjectPoint::LocalizationPrecision localizationPrecision_ = LocalizedObjectPoint::LP_INVALID;
+
+				/// The observations of the object point.
+				Observations observations_;
+		};
+
+		/**
+		 * Definition of a vector holding point records.
+		 */
+		using PointRecords = std::vector<PointRecord>;
+
+		/**
+		 * Definition of a map mapping object point ids to point records, e.g., to replay a journal.
+		 */
+		using PointRecordMap = FlatHashMap<Index32, PointRecord>;
+
+		/**
+		 * This class implements a data sample holding one checkpoint of the journal.
+		 */
+		class OCEAN_TRACKING_SLAM_EXPORT DataSampleCheckpoint : public IO::Serialization::DataSample
+		{
+			public:
+
+				/**
+				 * Default constructor creating an invalid sample.
+				 */
+				DataSampleCheckpoint() = default;
+
+				/**
+				 * Creates a new checkpoint sample.
+				 * @param checkpointIndex The index of the checkpoint, with range [0, infinity)
+				 * @param isSnapshot True, if the sample holds the entire map; False, if the sample holds the changes since the previous checkpoint
+				 * @param changedPoints The records of all added or changed object points, will be moved
+				 * @param removedObjectPointIds The ids of all removed object points, will be moved
+				 * @param timestamp The timestamp of the checkpoint, must be valid
+				 */
+				DataSampleCheckpoint(const uint32_t checkpointIndex, const bool isSnapshot, PointRecords&& changedPoints, Indices32&& removedObjectPointIds, const Timestamp& timestamp);
+
+				/**
+				 * Reads the sample from an input bitstream.
+				 * @param inputBitstream The input bitstream from which the sample will be read
+				 * @return True, if succeeded
+				 */
+				bool readSample(IO::InputBitstream& inputBitstream) override;
+
+				/**
+				 * Writes the sample to an output bitstream.
+				 * @param outputBitstream The output bitstream to which the sample will be written
+				 * @return True, if succeeded
+				 */
+				bool writeSample(IO::OutputBitstream& outputBitstream) const override;
+
+				/**
+				 * Returns the type of the sample.
+				 * @return The sample type
+				 */
+				inline const std::string& type() const override;
+
+				/**
+				 * Returns the index of the checkpoint.
+				 * @return The checkpoint's index
+				 */
+				inline uint32_t checkpointIndex() const;
+
+				/**
+				 * Returns whether this sample holds the entire map.
+				 * @return True, if so; False, if the sample holds changes only
+				 */
+				inline bool isSnapshot() const;
+
+				/**
+				 * Returns the records of all added or changed object points.
+				 * @return The changed points
+				 */
+				inline const PointRecords& changedPoints() const;
+
+				/**
+				 * Returns the ids of all removed object points.
+				 * @return The removed ids
+				 */
+				inline const Indices32& removedObjectPointIds() const;
+
+				/**
+				 * Returns the type of the sample.
+				 * @return The sample type
+				 */
+				static const std::string& sampleType();
+
+				/**
+				 * Factory function for creating a DataSampleCheckpoint.
+				 * This function can be used with InputDataSerializer::registerFactoryFunction().
+				 * @param sampleType The sample type (unused, but required by the factory function signature)
+				 * @return A new DataSampleCheckpoint instance
+				 */
+				static IO::Serialization::UniqueDataSample createSample(const std::string& sampleType);
+
+			protected:
+
+				/// The index of the checkpoint.
+				uint32_t checkpointIndex_ = 0u;
+
+				/// True, if the sample holds the entire map.
+				bool isSnapshot_ = false;
+
+				/// The records of all added or changed object points.
+				PointRecords changedPoints_;
+
+				/// The ids of all removed object points.
+				Indices32 removedObjectPointIds_;
+		};
+
+	protected:
+
+		/**
+		 * This class holds a lightweight fingerprint of a localized object point allowing to detect changes.
+		 */
+		class Fingerprint
+		{
+			public:
+
+				/**
+				 * Creates a new fingerprint for a localized object point.
+				 * @param localizedObjectPoint The localized object point for which the fingerprint will be created
+				 */
+				explicit inline Fingerprint(const LocalizedObjectPoint& localizedObjectPoint);
+
+				/**
+				 * Returns whether two fingerprints are identical.
+				 * @param fingerprint The second fingerprint
+				 * @return True, if so
+				 */
+				inline bool operator==(const Fingerprint& fingerprint) const;
+
+			protected:
+
+				/// The position of the object point.
+				Vector3 position_;
+
+				/// The index of the last observation.
+				Index32 lastObservationFrameIndex_;
+
+				/// The number of observations.
+				size_t numberObservations_;
+
+				/// The localization precision.
+				LocalizedObjectPoint::LocalizationPrecision localizationPrecision_;
+		};
+
+		/**
+		 * Definition of a map mapping object point ids to fingerprints.
+		 */
+		using FingerprintMap = FlatHashMap<Index32, Fingerprint>;
+
+	public:
+
+		/**
+		 * Creates an invalid journal.
+		 */
+		MapJournal() = default;
+
+		/**
+		 * Creates a new journal writing to a given output serializer.
+		 * The serializer must exist as long as this journal is in use, the serializer needs to be started before the first checkpoint.
+		 * @param outputDataSerializer The serializer receiving the checkpoints
+		 * @param channelName The name of the channel the journal will use, must be valid
+		 * @param snapshotInterval The number of checkpoints after which a full snapshot is written, with range [1, infinity), 0 to write only one snapshot with the first checkpoint
+		 */
+		MapJournal(IO::Serialization::OutputDataSerializer& outputDataSerializer, const std::string& channelName = "slammap", const unsigned int snapshotInterval = 0u);
+
+		/**
+		 * Creates the next checkpoint for a map of localized object points.
+		 * The function determines all changes since the previous checkpoint and hands them over to the serializer, the data is written asynchronously.<br>
+		 * Complexity: O(localizedObjectPointMap.size()) for the change detection, the copy and serialization effort depends on the changed points only.
+		 * @param localizedObjectPointMap The map for which the checkpoint will be created, must not be modified during this call
+		 * @param timestamp The timestamp of the checkpoint, must be valid
+		 * @param forceSnapshot True, to write the entire map; False, to write the changes only
+		 * @param numberChangedPoints Optional resulting number of added or changed object points written in this checkpoint
+		 * @return True, if succeeded
+		 */
+		bool checkpoint(const LocalizedObjectPointMap& localizedObjectPointMap, const Timestamp& timestamp, const bool forceSnapshot = false, size_t* numberChangedPoints = nullptr);
+
+		/**
+		 * Returns the number of checkpoints this journal has created so far.
+		 * @return The number of checkpoints
+		 */
+		inline uint32_t checkpoints() const;
+
+		/**
+		 * Returns whether this journal is valid.
+		 * @return True, if so
+		 */
+		inline bool isValid() const;
+
+		/**
+		 * Applies a checkpoint to a map of records, e.g., while reading a journal.
+		 * @param checkpoint The checkpoint to apply
+		 * @param pointRecordMap The map to which the checkpoint will be applied, will be cleared in case the checkpoint is a snapshot
+		 */
+		static void applyCheckpoint(const DataSampleCheckpoint& checkpoint, PointRecordMap& pointRecordMap);
+
+	protected:
+
+		/// The serializer receiving the checkpoints, nullptr if invalid.
+		IO::Serialization::OutputDataSerializer* outputDataSerializer_ = nullptr;
+
+		/// The id of the channel of this journal.
+		IO::Serialization::DataSerializer::ChannelId channelId_ = IO::Serialization::DataSerializer::invalidChannelId();
+
+		/// The number of checkpoints after which a full snapshot is written, 0 to write one snapshot only.
+		unsigned int snapshotInterval_ = 0u;
+
+		/// The number of checkpoints created so far.
+		uint32_t checkpoints_ = 0u;
+
+		/// The fingerprints of all object points as written in the latest checkpoint.
+		FingerprintMap fingerprintMap_;
+};
+
+inline const std::string& MapJournal::DataSampleCheckpoint::type() const
+{
+	return sampleType();
+}
+
+inline uint32_t MapJournal::DataSampleCheckpoint::checkpointIndex() const
+{
+	return checkpointIndex_;
+}
+
+inline bool MapJournal::DataSampleCheckpoint::isSnapshot() const
+{
+	return isSnapshot_;
+}
+
+inline const MapJournal::PointRecords& MapJournal::DataSampleCheckpoint::changedPoints() const
+{
+	return changedPoints_;
+}
+
+inline const Indices32& MapJournal::DataSampleCheckpoint::removedObjectPointIds() const
+{
+	return removedObjectPointIds_;
+}
+
+inline MapJournal::Fingerprint::Fingerprint(const LocalizedObjectPoint& localizedObjectPoint) :
+	position_(localizedObjectPoint.position()),
+	lastObservationFrameIndex_(localizedObjectPoint.lastObservationFrameIndex()),
+	numberObservations_(localizedObjectPoint.numberObservations()),
+	localizationPrecision_(localizedObjectPoint.localizationPrecision())
+{
+	// nothing to do here
+}
+
+inline bool MapJournal::Fingerprint::operator==(const Fingerprint& fingerprint) const
+{
+	return position_ == fingerprint.position_ && lastObservationFrameIndex_ == fingerprint.lastObservationFrameIndex_ && numberObservations_ == fingerprint.numberObservations_ && localizationPrecision_ == fingerprint.localizationPrecision_;
+}
+
+inline uint32_t MapJournal::checkpoints() const
+{
+	return checkpoints_;
+}
+
+inline bool MapJournal::isValid() const
+{
+	return outputDataSerializer_ != nullptr && channelId_ != IO::Serialization::DataSerializer::invalidChannelId();
+}
+
+}
+
+}
+
+}
+
+#endif // META_OCEAN_TRACKING_SLAM_MAP_JOURNAL_H
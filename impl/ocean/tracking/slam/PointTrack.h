@@ -10,6 +10,8 @@
 
 #include "ocean/tracking/slam/SLAM.h"
 
+#include "ocean/base/HashMap.h"
+
 #include "ocean/math/AnyCamera.h"
 #include "ocean/math/HomogenousMatrix4.h"
 
@@ -27,9 +29,10 @@ class PointTrack;
 
 /**
  * Definition of an unordered map mapping object point ids to point tracks.
+ * The map is based on open addressing, inserting or erasing point tracks may invalidate iterators and references.
  * @ingroup trackingslam
  */
-using PointTrackMap = std::unordered_map<Index32, PointTrack>;
+using PointTrackMap = FlatHashMap<Index32, PointTrack>;
 
 /**
  * This class implements a point track which stores continuous 2D observations of a 3D object point over consecutive frames.
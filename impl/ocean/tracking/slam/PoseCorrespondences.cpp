@@ -36,7 +36,7 @@ void PoseCorrespondences::reset(const TrackingCorrespondences& trackingCorrespon
 	mapVersion_ = trackingCorrespondences.mapVersion();
 
 	const Vectors3& trackedObjectPoints = trackingCorrespondences.objectPoints();
-	const LocalizedObjectPoint::LocalizationPrecisions trackedObjectPointPrecisions = trackingCorrespondences.objectPointPrecisions();
+	const LocalizedObjectPoint::LocalizationPrecisions& trackedObjectPointPrecisions = trackingCorrespondences.objectPointPrecisions();
 
 	const Vectors2& trackedPreviousImagePoints = trackingCorrespondences.previousImagePoints();
 	const Vectors2& trackedCurrentImagePoints = trackingCorrespondences.currentImagePoints();
@@ -151,22 +151,25 @@ SharedCameraPose PoseCorrespondences::determinePose(const AnyCamera& camera, con
 		return nullptr;
 	}
 
-	for (const Index32 validIndex : inlierIndices_)
+	if (determineObjectPointIdSets_)
 	{
-		ocean_assert(validIndex < objectPointIds_.size());
+		for (const Index32 validIndex : inlierIndices_)
+		{
+			ocean_assert(validIndex < objectPointIds_.size());
 
-		const Index32 objectPointId = objectPointIds_[validIndex];
+			const Index32 objectPointId = objectPointIds_[validIndex];
 
-		preciseObjectPointIds_.insert(objectPointId);
-	}
+			preciseObjectPointIds_.insert(objectPointId);
+		}
 
-	ocean_assert(preciseObjectPointIds_.size() == inlierIndices_.size());
+		ocean_assert(preciseObjectPointIds_.size() == inlierIndices_.size());
 
-	for (const Index32 objectPointId : objectPointIds_)
-	{
-		if (!preciseObjectPointIds_.contains(objectPointId))
+		for (const Index32 objectPointId : objectPointIds_)
 		{
-			impreciseObjectPointIds_.emplace(objectPointId);
+			if (!preciseObjectPointIds_.contains(objectPointId))
+			{
+				impreciseObjectPointIds_.emplace(objectPointId);
+			}
 		}
 	}
 
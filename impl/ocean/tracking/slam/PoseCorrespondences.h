@@ -135,6 +135,9 @@ class OCEAN_TRACKING_SLAM_EXPORT PoseCorrespondences
 		/// The IDs of object points that did not contribute precisely to the pose (for debugging/visualization).
 		UnorderedIndexSet32 impreciseObjectPointIds_;
 
+		/// True, to determine preciseObjectPointIds_ and impreciseObjectPointIds_ in determinePose(); the sets are needed for debugging only and cost one heap allocation per object point.
+		bool determineObjectPointIdSets_ = false;
+
 		/// The map version at the time the correspondences were gathered.
 		Index32 mapVersion_ = 0u;
 
@@ -25,8 +25,8 @@ namespace SLAM
  * @{
  * The Ocean SLAM Tracking Library provides a monocular visual SLAM implementation for real-time camera tracking and 3D environment reconstruction, optimized for mobile AR/VR applications.
  * The pipeline detects and tracks Harris corner features across image pyramids, estimates camera poses using P3P+RANSAC with optional IMU gravity constraints, and builds a 3D map through multi-view triangulation with background bundle adjustment.
- * Core classes include TrackerMono (main tracker), LocalizedObjectPoint (3D map points with FREAK descriptors), CameraPoses (thread-safe pose storage), and TrackingCorrespondences (frame-to-frame feature tracking).
- * @see Tracker, TrackerMono, CameraPose, LocalizedObjectPoint
+ * Core classes include TrackerMono (main tracker), TrackerMulti (tracker for rigs with several cameras), LocalizedObjectPoint (3D map points with FREAK descriptors), CameraPoses (thread-safe pose storage), and TrackingCorrespondences (frame-to-frame feature tracking).
+ * @see Tracker, TrackerMono, TrackerMulti, CameraPose, LocalizedObjectPoint
  * @}
  */
 
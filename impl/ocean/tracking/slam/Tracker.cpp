@@ -167,6 +167,20 @@ const Tracker::TrackingParameterPair& Tracker::TrackingParameters::parameterPair
 	return trackingParametersUnguided_;
 }
 
+unsigned int Tracker::TrackingParameters::pyramidLayers(const bool rotationPriorAvailable) const
+{
+	ocean_assert(isValid());
+
+	constexpr unsigned int minimalLayers = 2u;
+
+	if (rotationPriorAvailable)
+	{
+		return std::max(minimalLayers, std::max(trackingParametersGuidedIMU_.layers_, trackingParametersGuidedObjectPoint_.layers_));
+	}
+
+	return std::max(minimalLayers, trackingParametersUnguided_.layers_);
+}
+
 }
 
 }
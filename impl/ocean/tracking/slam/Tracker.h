@@ -121,6 +121,10 @@ class OCEAN_TRACKING_SLAM_EXPORT Tracker
 
 				/// The expected number of frames per second, with range (0, infinity).
 				double expectedFramesPerSecond_ = 30.0;
+
+				/// True, to detect the Harris corners of a new frame concurrently with the pose estimation of this frame; False, to detect the corners in the post-processing stage.
+				/// The concurrent detection shortens the post-processing stage (higher throughput for high frame rates) at the cost of an additional busy core while the pose is determined (possibly higher pose latency on devices with few cores).
+				bool detectCornersConcurrently_ = false;
 		};
 
 		/**
@@ -143,6 +147,15 @@ class OCEAN_TRACKING_SLAM_EXPORT Tracker
 				 */
 				inline TrackingParameterPair(const unsigned int layers, const unsigned int coarsestLayerRadius);
 
+				/**
+				 * Returns a parameter pair using at most a specified number of pyramid layers.
+				 * In case layers need to be removed, the search radius in the coarsest layer is increased so that the overall tracking distance is preserved as far as possible.
+				 * This pair must be valid.
+				 * @param maximalLayers The maximal number of pyramid layers available, with range [1, infinity)
+				 * @return The resulting parameter pair, this pair if the number of layers does not exceed the specified maximum
+				 */
+				inline TrackingParameterPair limitedLayers(const unsigned int maximalLayers) const;
+
 				/**
 				 * Returns whether this parameter pair is valid.
 				 * A parameter pair is valid if both the number of layers and the coarsest layer radius are non-zero.
@@ -189,6 +202,15 @@ class OCEAN_TRACKING_SLAM_EXPORT Tracker
 				 */
 				const TrackingParameterPair& parameterPair(const HomogenousMatrix4& world_T_previousCamera, const Quaternion& previousCamera_Q_currentCamera, const Scalar strongMotionAngle = Numeric::deg2rad(1)) const;
 
+				/**
+				 * Returns the number of pyramid layers a frame pyramid needs so that it can be used for frame-to-frame tracking.
+				 * With a rotation prior (e.g., from the IMU), point locations can be predicted and the guided tracking parameters need less layers than unguided tracking.<br>
+				 * The resulting number of layers is never smaller than two, as the descriptors use the second pyramid layer.
+				 * @param rotationPriorAvailable True, if a rotation prior is available for the frame; False, if the tracking needs to be unguided
+				 * @return The number of pyramid layers, with range [2, infinity)
+				 */
+				unsigned int pyramidLayers(const bool rotationPriorAvailable) const;
+
 				/**
 				 * Returns whether these tracking parameters are valid.
 				 * Tracking parameters are valid if the patch size is non-zero and all parameter pairs are valid.
@@ -335,6 +357,25 @@ inline Tracker::TrackingParameterPair::TrackingParameterPair(const unsigned int
 	// nothing to do here
 }
 
+inline Tracker::TrackingParameterPair Tracker::TrackingParameterPair::limitedLayers(const unsigned int maximalLayers) const
+{
+	ocean_assert(isValid());
+	ocean_assert(maximalLayers >= 1u);
+
+	if (layers_ <= maximalLayers || maximalLayers == 0u)
+	{
+		return *this;
+	}
+
+	// each removed layer doubles the search radius in the new coarsest layer, due to performance reasons we do not exceed a radius of 32 pixels
+
+	constexpr unsigned int maximalCoarsestLayerRadius = 32u;
+
+	const unsigned int removedLayers = std::min(layers_ - maximalLayers, 5u);
+
+	return TrackingParameterPair(maximalLayers, std::min(coarsestLayerRadius_ << removedLayers, std::max(coarsestLayerRadius_, maximalCoarsestLayerRadius)));
+}
+
 inline bool Tracker::TrackingParameterPair::isValid() const
 {
 	return layers_ != 0u && coarsestLayerRadius_ != 0u;
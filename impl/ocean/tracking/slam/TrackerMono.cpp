@@ -10,6 +10,7 @@
 #include "ocean/tracking/slam/SLAMDebugElements.h"
 
 #include "ocean/base/Median.h"
+#include "ocean/base/WorkerPool.h"
 
 #include "ocean/cv/detector/HarrisCornerDetector.h"
 
@@ -181,6 +182,7 @@ std::string TrackerMono::PerformanceStatistics::toString() const
 
 	result += "Main thread:";
 	result += "\nHandle frame: " + handleFrame_.toString();
+	result += "\n   Create pyramid: " + createPyramid_.toString();
 	result += "\nTrack image points: " + trackImagePoints_.toString();
 	result += "\n   Update database: " + trackImagePointsDatabase_.toString();
 	result += "\nDetermine camera pose: " + determineCameraPose_.toString();
@@ -307,11 +309,16 @@ TrackerMono::TrackerMono()
 	harrisThreshold_ = configuration_.harrisThresholdMean();
 
 	postHandleFrameTask_.setTask(std::bind(&TrackerMono::postHandleFrame, this));
+	cornerDetectionTask_.setTask(std::bind(&TrackerMono::detectCornersConcurrently, this));
+
+	// the corner detection task is executed on demand only, so that we consume the initial processed state immediately; afterwards each execute() is followed by exactly one wait()
+	cornerDetectionTask_.wait();
 }
 
 TrackerMono::~TrackerMono()
 {
 	postHandleFrameTask_.release();
+	cornerDetectionTask_.release();
 
 	stopThreadExplicitly();
 }
@@ -405,10 +412,13 @@ bool TrackerMono::handleFrame(const AnyCamera& camera, Frame&& yFrame, Homogenou
 	// first, let's create a pyramid for the current frame
 	// we store the new pyramid in a temporary variable until the background task has finished
 
-	yFrame.makeOwner();
-
 	const Index32 currentFrameIndex = cameraPoses_.nextFrameIndex();
 
+	// all traced categories of this frame (including the post processing in the background) will be associated with the frame index
+	HighPerformanceBenchmark::get().setTraceFrameId(HighPerformanceBenchmark::TraceFrameId(currentFrameIndex));
+
+	const HighPerformanceBenchmark::ScopedCategory scopedCategory("TrackerMono::handleFrame");
+
 	if (frameStatisticsEnabled_)
 	{
 		framesStatistics_.emplace_back(currentFrameIndex);
@@ -429,8 +439,33 @@ bool TrackerMono::handleFrame(const AnyCamera& camera, Frame&& yFrame, Homogenou
 		}
 	}
 
-	FramePyramidManager::ScopedPyramid tempCurrentPyramid = framePyramidManager_.newPyramid(currentFrameIndex);
-	tempCurrentPyramid->replace(CV::FramePyramid::DM_FILTER_11, std::move(yFrame), CV::FramePyramid::AS_MANY_LAYERS_AS_POSSIBLE, nullptr);
+	// with a rotation prior, the point tracking is guided and needs less pyramid layers, in case the next frame comes without prior, the tracking falls back to the available layers
+
+	const unsigned int pyramidLayers = trackingParameters_.isValid() ? trackingParameters_.pyramidLayers(anyWorld_Q_camera.isValid()) : CV::FramePyramid::AS_MANY_LAYERS_AS_POSSIBLE;
+
+	performanceStatistics_.start(performanceStatistics_.createPyramid_);
+		FramePyramidManager::ScopedPyramid tempCurrentPyramid;
+
+		if (framePyramidCache_)
+		{
+			// the pyramid may have been created already by another tracker processing the same frame
+
+			const CV::FramePyramidCache::SharedFramePyramid sharedFramePyramid = framePyramidCache_->pyramid(yFrame, pyramidLayers, nullptr);
+
+			if (sharedFramePyramid)
+			{
+				tempCurrentPyramid = framePyramidManager_.newPyramid(currentFrameIndex, sharedFramePyramid, pyramidLayers);
+			}
+		}
+
+		if (!tempCurrentPyramid)
+		{
+			yFrame.makeOwner();
+
+			tempCurrentPyramid = framePyramidManager_.newPyramid(currentFrameIndex);
+			tempCurrentPyramid->replace(CV::FramePyramid::DM_FILTER_11, std::move(yFrame), pyramidLayers, nullptr);
+		}
+	performanceStatistics_.stop(performanceStatistics_.createPyramid_);
 
 	// we need to wait until the background task has finished with post processing of the previous handleFrame() call
 
@@ -466,6 +501,22 @@ bool TrackerMono::handleFrame(const AnyCamera& camera, Frame&& yFrame, Homogenou
 		previousCamera_Q_currentCamera = anyWorld_Q_previousCamera_.inverted() * anyWorld_Q_camera;
 	}
 
+	ocean_assert(!cornerDetectionPending_);
+
+	if (configuration_.detectCornersConcurrently_ && occupancyArray_.isValid() && occupancyArray_.needMorePoints())
+	{
+		// the occupancy array still reflects the previous frame, which is a good indicator whether the current frame will need new features
+		// the corners are detected while the pose is determined, the post-processing stage will simply use the detected corners
+
+		cornerDetectionThreshold_ = harrisThreshold_;
+
+		cornerDetectionPending_ = cornerDetectionTask_.execute();
+	}
+
+	// the sets of (im-)precise object point ids need heap allocations and are determined for debugging only
+
+	poseCorrespondences_.determineObjectPointIdSets_ = debugData != nullptr;
+
 	SharedCameraPose cameraPose = trackImagePointsAndDeterminePose(camera, currentFrameIndex, randomGenerator_, previousCamera_Q_currentCamera);
 
 	if (cameraPose)
@@ -781,17 +832,43 @@ TrackerMono::FramesStatistics TrackerMono::framesStatistics() const
 	return framesStatistics_;
 }
 
+bool TrackerMono::checkpointMap(MapJournal& mapJournal, const Timestamp& timestamp, const bool forceSnapshot) const
+{
+	ocean_assert(mapJournal.isValid());
+
+	const ReadLock readLock(mutex_, "TrackerMono::checkpointMap()");
+
+	return mapJournal.checkpoint(localizedObjectPointMap_, timestamp, forceSnapshot);
+}
+
 void TrackerMono::postHandleFrame()
 {
+	const HighPerformanceBenchmark::ScopedCategory scopedCategory("TrackerMono::postHandleFrame");
+
 	ocean_assert(camera_ && camera_->isValid());
 
 	ocean_assert(currentPyramid_);
 	ocean_assert(currentPyramid_.frameIndex() == cameraPoses_.frameIndex());
 
+	// all temporary containers of the previous frame have been disposed
+
+	postHandleFrameArena_.reset();
+
 	const Index32 currentFrameIndex = currentPyramid_.frameIndex();
 
 	const SharedCameraPose currentCameraPose = cameraPoses_.pose(currentFrameIndex);
 
+	bool precomputedCornersAvailable = false;
+
+	if (cornerDetectionPending_)
+	{
+		// the corner detection task needs to be finished before the next frame can be handled
+
+		cornerDetectionPending_ = false;
+
+		precomputedCornersAvailable = cornerDetectionTask_.wait() == BackgroundTask::WR_PROCESSED && cornerDetectionSucceeded_;
+	}
+
 	const unsigned int frameWidth = camera_->width();
 	const unsigned int frameHeight = camera_->height();
 
@@ -852,7 +929,7 @@ void TrackerMono::postHandleFrame()
 		}
 	}
 
-	detectNewImagePoints(*camera_, currentFrameIndex, *currentPyramid_, tryMatchCornersToLocalizedObjectPoints);
+	detectNewImagePoints(*camera_, currentFrameIndex, *currentPyramid_, tryMatchCornersToLocalizedObjectPoints, precomputedCornersAvailable ? &cornerDetectionCorners_ : nullptr);
 
 	ReadLock readLock(mutex_, "TrackerMono::postHandleFrame(), update correspondences");
 		trackingCorrespondences_.update(currentFrameIndex, mapVersion_, localizedObjectPointMap_, pointTrackMap_, minimalFrontPrecision_);
@@ -886,6 +963,7 @@ void TrackerMono::resetLocalizedObjectPoints()
 	ocean_assert(trackerState_ == TS_INITIALIZING);
 
 	localizedObjectPointMap_.clear();
+	covisibilityGraph_.clear();
 	inaccurateObjectPointIdSet_.clear();
 
 	cameraPoses_.removePoses();
@@ -917,6 +995,10 @@ void TrackerMono::threadRun()
 
 		ocean_assert(camera_ && camera_->isValid());
 
+		// all temporary containers of the previous iteration have been disposed
+
+		backgroundArena_.reset();
+
 		if (taskDetermineInitialObjectPoints_)
 		{
 			// let's try to determine the initial positions of 3D object points
@@ -1098,6 +1180,7 @@ bool TrackerMono::determineInitialObjectPoints(const AnyCamera& camera, const In
 			constexpr LocalizedObjectPoint::LocalizationPrecision initialLocalizationPrecision = LocalizedObjectPoint::LP_UNKNOWN;
 
 			localizedObjectPointMap_.emplace(objectPointId, LocalizedObjectPoint(pointTrack, position, initialLocalizationPrecision, true /*isBundleAdjusted*/));
+			covisibilityGraph_.addObservations(objectPointId, pointTrack);
 
 			bundleAdjustmentObjectPointIdSet_.insert(objectPointId);
 		}
@@ -1300,7 +1383,7 @@ void TrackerMono::bundleAdjustment(const AnyCamera& camera, const Index32 curren
 		Indices32 keyFrameIndices = bundleAdjustmentKeyFrameIndices_;
 
 		ObjectPointToObservations objectPointToObservations;
-		if (!determineBundleAdjustmentTopology(necessaryMapVersion, cameraPoses_, localizedObjectPointMap_, maximalNumberNewKeyFrames, maximalNumberKeyFrames, keyFrameIndices, objectPointToObservations, minimalNumberKeyFrames))
+		if (!determineBundleAdjustmentTopology(necessaryMapVersion, cameraPoses_, localizedObjectPointMap_, covisibilityGraph_, maximalNumberNewKeyFrames, maximalNumberKeyFrames, keyFrameIndices, objectPointToObservations, minimalNumberKeyFrames))
 		{
 			return;
 		}
@@ -1446,7 +1529,10 @@ void TrackerMono::bundleAdjustment(const AnyCamera& camera, const Index32 curren
 
 	constexpr Geometry::Estimator::EstimatorType estimatorType = Geometry::Estimator::ET_SQUARE;
 
-	if (!Geometry::NonLinearOptimizationObjectPoint::optimizeObjectPointsAndPosesIF(camera, ConstArrayAccessor<HomogenousMatrix4>(flippedCameras_T_world), ConstArrayAccessor<Vector3>(objectPoints), correspondenceGroups, &accessorOptimizedPoses, &accessorOptimizedObjectPoints, 20u, estimatorType, Scalar(0.001), Scalar(5), true /*onlyFrontObjectPoints*/, &initialError, &finalError, nullptr, gravityConstraints.isValid() ? &gravityConstraints : nullptr, applyAbsolutePoseAlignment))
+	// the key frames observe mostly disjoint sets of object points, so that the reduced camera system is sparse, for many key frames we solve it iteratively
+	const Geometry::NonLinearOptimizationObjectPoint::SchurSolver schurSolver = keyFrameIndices.size() >= 100 ? Geometry::NonLinearOptimizationObjectPoint::SS_BLOCK_SPARSE_CONJUGATE_GRADIENT : Geometry::NonLinearOptimizationObjectPoint::SS_BLOCK_SPARSE_DIRECT;
+
+	if (!Geometry::NonLinearOptimizationObjectPoint::optimizeObjectPointsAndPosesIF(camera, ConstArrayAccessor<HomogenousMatrix4>(flippedCameras_T_world), ConstArrayAccessor<Vector3>(objectPoints), correspondenceGroups, &accessorOptimizedPoses, &accessorOptimizedObjectPoints, 20u, estimatorType, Scalar(0.001), Scalar(5), true /*onlyFrontObjectPoints*/, &initialError, &finalError, nullptr, gravityConstraints.isValid() ? &gravityConstraints : nullptr, applyAbsolutePoseAlignment, schurSolver, WorkerPool::get().scopedWorker()()))
 	{
 		Log::warning() << "Failed to run Bundle Adjustment";
 		return;
@@ -1898,6 +1984,7 @@ void TrackerMono::localizeUnlocalizedObjectPoints(const AnyCamera& camera, const
 
 			ocean_assert(!localizedObjectPointMap_.contains(objectPointId));
 			localizedObjectPointMap_.emplace(objectPointId, LocalizedObjectPoint(iPointTrack->second, position, precision, false /*isBundleAdjusted*/));
+			covisibilityGraph_.addObservations(objectPointId, iPointTrack->second);
 
 			if (trackerIsTracking)
 			{
@@ -2145,6 +2232,7 @@ bool TrackerMono::relocalize(const AnyCamera& camera, const Index32 latestFrameI
 			LocalizedObjectPoint& localizedObjectPoint = iLocalized->second;
 
 			localizedObjectPoint.addObservations(pointTrack);
+			covisibilityGraph_.addObservations(localizedObjectPointId, pointTrack);
 
 			poseQualityCalculator.addObjectPoint(localizedObjectPoint.localizationPrecision());
 
@@ -2358,6 +2446,7 @@ void TrackerMono::processTrackingResults(const Index32 currentFrameIndex, const
 #endif // OCEAN_DEBUG
 
 					localizedObjectPoint.addObservation(currentFrameIndex, currentImagePoint);
+					covisibilityGraph_.addObservation(currentFrameIndex, objectPointId);
 				}
 				else
 				{
@@ -2375,7 +2464,7 @@ void TrackerMono::processTrackingResults(const Index32 currentFrameIndex, const
 	}
 }
 
-bool TrackerMono::detectNewImagePoints(const AnyCamera& camera, const Index32 currentFrameIndex, const CV::FramePyramid& yFramePyramid, const bool tryMatchCornersToLocalizedObjectPoints)
+bool TrackerMono::detectNewImagePoints(const AnyCamera& camera, const Index32 currentFrameIndex, const CV::FramePyramid& yFramePyramid, const bool tryMatchCornersToLocalizedObjectPoints, CV::Detector::HarrisCorners* precomputedCorners)
 {
 	ocean_assert(camera.isValid());
 	ocean_assert(yFramePyramid.isValid());
@@ -2400,7 +2489,13 @@ bool TrackerMono::detectNewImagePoints(const AnyCamera& camera, const Index32 cu
 	ocean_assert(configuration_.harrisThresholdMin_ <= harrisThreshold_ && harrisThreshold_ <= configuration_.harrisThresholdMax_);
 
 	CV::Detector::HarrisCorners corners;
-	if (!CV::Detector::HarrisCornerDetector::detectCorners(yFrame.constdata<uint8_t>(), yFrame.width(), yFrame.height(), yFrame.paddingElements(), harrisThreshold_, false /*frameIsUndistorted*/, corners, true /*determineExactPosition*/))
+
+	if (precomputedCorners != nullptr)
+	{
+		corners = std::move(*precomputedCorners);
+		precomputedCorners->clear();
+	}
+	else if (!CV::Detector::HarrisCornerDetector::detectCorners(yFrame.constdata<uint8_t>(), yFrame.width(), yFrame.height(), yFrame.paddingElements(), harrisThreshold_, false /*frameIsUndistorted*/, corners, true /*determineExactPosition*/))
 	{
 		return false;
 	}
@@ -2482,6 +2577,22 @@ bool TrackerMono::detectNewImagePoints(const AnyCamera& camera, const Index32 cu
 	return true;
 }
 
+void TrackerMono::detectCornersConcurrently()
+{
+	const HighPerformanceBenchmark::ScopedCategory scopedCategory("TrackerMono::detectCornersConcurrently");
+
+	ocean_assert(currentPyramid_);
+
+	// the current pyramid is not modified before the task has been waited for in postHandleFrame()
+
+	const Frame& yFrame = currentPyramid_->finestLayer();
+
+	ocean_assert(configuration_.harrisThresholdMin_ <= cornerDetectionThreshold_ && cornerDetectionThreshold_ <= configuration_.harrisThresholdMax_);
+
+	cornerDetectionCorners_.clear();
+	cornerDetectionSucceeded_ = CV::Detector::HarrisCornerDetector::detectCorners(yFrame.constdata<uint8_t>(), yFrame.width(), yFrame.height(), yFrame.paddingElements(), cornerDetectionThreshold_, false /*frameIsUndistorted*/, cornerDetectionCorners_, true /*determineExactPosition*/);
+}
+
 void TrackerMono::matchCornersToLocalizedObjectPoints(const AnyCamera& camera, const Index32 currentFrameIndex, const CameraPose& cameraPose, const CV::FramePyramid& yFramePyramid, CV::Detector::HarrisCorners& corners)
 {
 	ocean_assert(!corners.empty());
@@ -2495,8 +2606,8 @@ void TrackerMono::matchCornersToLocalizedObjectPoints(const AnyCamera& camera, c
 
 	// first let's gather all corners which are close to projected localized object points (which are currently not visible)
 
-	using CornerIndexToObjectPointIdsMap = std::unordered_map<Index32, Indices32>;
-	CornerIndexToObjectPointIdsMap cornerIndexToObjectPointsMap;
+	using CornerIndexToObjectPointIdsMap = ArenaUnorderedMap<Index32, ArenaVector<Index32>>;
+	CornerIndexToObjectPointIdsMap cornerIndexToObjectPointsMap(corners.size(), postHandleFrameArena_);
 
 	const Scalar maximalProjectionError = configuration_.maximalProjectionError_;
 
@@ -2556,10 +2667,12 @@ void TrackerMono::matchCornersToLocalizedObjectPoints(const AnyCamera& camera, c
 
 	// let's describe all corners with corresponding object point candidates so that we can match them afterwards
 
-	using MatchedObjectPointIdToCornerIndexMap = std::unordered_map<Index32, Index32>;
-	MatchedObjectPointIdToCornerIndexMap matchedObjectPointIdToCornerIndexMap; // TODO make reusable
-	Indices32 matchedCornerIndices;
-	Vectors2 imagePoints;
+	using MatchedObjectPointIdToCornerIndexMap = ArenaUnorderedMap<Index32, Index32>;
+	MatchedObjectPointIdToCornerIndexMap matchedObjectPointIdToCornerIndexMap(cornerIndexToObjectPointsMap.size(), postHandleFrameArena_);
+	ArenaVector<Index32> matchedCornerIndices(postHandleFrameArena_);
+	ArenaVector<Vector2> imagePoints(postHandleFrameArena_);
+
+	imagePoints.reserve(cornerIndexToObjectPointsMap.size());
 
 	for (const CornerIndexToObjectPointIdsMap::value_type& pair : cornerIndexToObjectPointsMap)
 	{
@@ -2569,7 +2682,7 @@ void TrackerMono::matchCornersToLocalizedObjectPoints(const AnyCamera& camera, c
 		imagePoints.emplace_back(corner.observation());
 	}
 
-	CV::Detector::FREAKDescriptors32 freakDescriptors(imagePoints.size());
+	ArenaVector<CV::Detector::FREAKDescriptor32> freakDescriptors(imagePoints.size(), postHandleFrameArena_);
 	CV::Detector::FREAKDescriptor32::computeDescriptors(camera.clone(), yFramePyramid, imagePoints.data(), imagePoints.size(), 0u /*pyramidLevel*/, freakDescriptors.data());
 
 	readLock = ReadLock(mutex_, "TrackerMono::matchCornersToLocalizedObjectPoints() post description");
@@ -2588,7 +2701,7 @@ void TrackerMono::matchCornersToLocalizedObjectPoints(const AnyCamera& camera, c
 			}
 
 			const Index32& cornerIndex = pair.first;
-			const Indices32& localizedObjectPointIds = pair.second;
+			const ArenaVector<Index32>& localizedObjectPointIds = pair.second;
 			ocean_assert(!localizedObjectPointIds.empty());
 
 			unsigned int bestDistance = (unsigned int)(-1);
@@ -2649,6 +2762,7 @@ void TrackerMono::matchCornersToLocalizedObjectPoints(const AnyCamera& camera, c
 
 				ocean_assert(localizedObjectPoint.lastObservationFrameIndex() != currentFrameIndex);
 				localizedObjectPoint.addObservation(currentFrameIndex, imagePoint);
+				covisibilityGraph_.addObservation(currentFrameIndex, iObjectPoint->first);
 
 				matchedCornerIndices.push_back(cornerIndex);
 			}
@@ -2895,6 +3009,7 @@ void TrackerMono::matchLocalizedObjectPointsToCorners(const AnyCamera& camera, c
 
 			ocean_assert(localizedObjectPoint.lastObservationFrameIndex() != currentFrameIndex);
 			localizedObjectPoint.addObservation(currentFrameIndex, imagePoint);
+			covisibilityGraph_.addObservation(currentFrameIndex, iObjectPoint->first);
 
 			++debugCounter;
 
@@ -2994,7 +3109,7 @@ bool TrackerMono::isBundleAdjustmentNeeded(const AnyCamera& camera, const Camera
 	return false;
 }
 
-bool TrackerMono::determineBundleAdjustmentTopology(const Index32 necessaryMapVersion, const CameraPoses& cameraPoses, const LocalizedObjectPointMap& localizedObjectPointMap, const size_t maximalNumberNewKeyFrames, const size_t maximalNumberKeyFrames, Indices32& keyFrameIndices, ObjectPointToObservations& objectPointToObservations, const size_t minimalNumberKeyFrames, const size_t maximalFrameHistory)
+bool TrackerMono::determineBundleAdjustmentTopology(const Index32 necessaryMapVersion, const CameraPoses& cameraPoses, const LocalizedObjectPointMap& localizedObjectPointMap, const CovisibilityGraph& covisibilityGraph, const size_t maximalNumberNewKeyFrames, const size_t maximalNumberKeyFrames, Indices32& keyFrameIndices, ObjectPointToObservations& objectPointToObservations, const size_t minimalNumberKeyFrames, const size_t maximalFrameHistory)
 {
 	// we select a subset of keyframes to be used in the bundle adjustment.
 	// the selection strategy tries to maximize the spatial distribution of keyframes while ensuring sufficient feature overlap.
@@ -3023,7 +3138,7 @@ bool TrackerMono::determineBundleAdjustmentTopology(const Index32 necessaryMapVe
 
 	if (keyFrameIndices.empty())
 	{
-		const Index32 firstFrameIndex = frameIndexWithMostLocalizedObjectPoints(necessaryMapVersion, cameraPoses, localizedObjectPointMap, minimalNumberObjectPoints);
+		const Index32 firstFrameIndex = frameIndexWithMostLocalizedObjectPoints(necessaryMapVersion, cameraPoses, localizedObjectPointMap, covisibilityGraph, minimalNumberObjectPoints);
 
 		if (firstFrameIndex == Index32(-1))
 		{
@@ -3123,17 +3238,7 @@ bool TrackerMono::determineBundleAdjustmentTopology(const Index32 necessaryMapVe
 
 			const Index32 frameIndex = distancePair.second;
 
-			size_t objectPoints = 0;
-
-			for (const LocalizedObjectPointMap::value_type& objectPointPair : localizedObjectPointMap)
-			{
-				const LocalizedObjectPoint& localizedObjectPoint = objectPointPair.second;
-
-				if (localizedObjectPoint.hasObservation(frameIndex))
-				{
-					++objectPoints;
-				}
-			}
+			const size_t objectPoints = covisibilityGraph.numberLocalizedObjectPoints(frameIndex, localizedObjectPointMap);
 
 			if (objectPoints > bestObjectPoints)
 			{
@@ -3234,19 +3339,31 @@ bool TrackerMono::determineBundleAdjustmentTopology(const Index32 necessaryMapVe
 		ocean_assert(flippedCamera_T_world.isValid());
 #endif
 
-		for (const LocalizedObjectPointMap::value_type& objectPointPair : localizedObjectPointMap)
-		{
-			const Index32& objectPointId = objectPointPair.first;
-			const LocalizedObjectPoint& localizedObjectPoint = objectPointPair.second;
+		const Indices32* objectPointIds = covisibilityGraph.objectPointIds(keyFrameIndex);
 
-			Vector2 imagePoint;
-			if (localizedObjectPoint.hasObservation(keyFrameIndex, &imagePoint))
+		if (objectPointIds != nullptr)
+		{
+			for (const Index32 objectPointId : *objectPointIds)
 			{
+				const LocalizedObjectPointMap::const_iterator iObjectPoint = localizedObjectPointMap.find(objectPointId);
+
+				if (iObjectPoint == localizedObjectPointMap.cend())
+				{
+					// the object point has been removed from the map in the meantime
+					continue;
+				}
+
+				const LocalizedObjectPoint& localizedObjectPoint = iObjectPoint->second;
+
+				Vector2 imagePoint;
+				if (localizedObjectPoint.hasObservation(keyFrameIndex, &imagePoint))
+				{
 #ifdef OCEAN_DEBUG
-				ocean_assert(Camera::isObjectPointInFrontIF(flippedCamera_T_world, localizedObjectPoint.position()));
+					ocean_assert(Camera::isObjectPointInFrontIF(flippedCamera_T_world, localizedObjectPoint.position()));
 #endif
 
-				objectPointToObservations[objectPointId].emplace_back(Index32(poseIndex), imagePoint);
+					objectPointToObservations[objectPointId].emplace_back(Index32(poseIndex), imagePoint);
+				}
 			}
 		}
 
@@ -3308,8 +3425,8 @@ void TrackerMono::describeObjectPoints(const AnyCamera& camera, const Index32 cu
 			return;
 		}
 
-		Indices32 objectPointIds; // TODO reuse
-		Vectors2 imagePoints;
+		ArenaVector<Index32> objectPointIds(backgroundArena_);
+		ArenaVector<Vector2> imagePoints(backgroundArena_);
 
 		for (const LocalizedObjectPointMap::value_type& objectPointPair : localizedObjectPointMap_)
 		{
@@ -3337,7 +3454,7 @@ void TrackerMono::describeObjectPoints(const AnyCamera& camera, const Index32 cu
 		return;
 	}
 
-	CV::Detector::FREAKDescriptors32 freakDescriptors(imagePoints.size());
+	ArenaVector<CV::Detector::FREAKDescriptor32> freakDescriptors(imagePoints.size(), backgroundArena_);
 	CV::Detector::FREAKDescriptor32::computeDescriptors(camera.clone(), yFramePyramid, imagePoints.data(), imagePoints.size(), 0u /*pyramidLevel*/, freakDescriptors.data());
 
 	ocean_assert(objectPointIds.size() == imagePoints.size());
@@ -3380,7 +3497,7 @@ void TrackerMono::describeObjectPoints(const AnyCamera& camera, const Index32 cu
 		}
 }
 
-Index32 TrackerMono::frameIndexWithMostLocalizedObjectPoints(const Index32 necessaryMapVersion, const CameraPoses& cameraPoses, const LocalizedObjectPointMap& localizedObjectPointMap, const size_t minimalNumberObjectPoints, const UnorderedIndexSet32* ignoreFrameIndices)
+Index32 TrackerMono::frameIndexWithMostLocalizedObjectPoints(const Index32 necessaryMapVersion, const CameraPoses& cameraPoses, const LocalizedObjectPointMap& localizedObjectPointMap, const CovisibilityGraph& covisibilityGraph, const size_t minimalNumberObjectPoints, const UnorderedIndexSet32* ignoreFrameIndices)
 {
 	ocean_assert(!cameraPoses.isEmpty());
 	ocean_assert(ignoreFrameIndices == nullptr || ignoreFrameIndices->size() <= cameraPoses.size());
@@ -3412,19 +3529,7 @@ Index32 TrackerMono::frameIndexWithMostLocalizedObjectPoints(const Index32 neces
 			continue;
 		}
 
-		size_t objectPoints = 0;
-
-		// TODO, this should be optimized by storing some information in CameraPose about which object points are used
-
-		for (const LocalizedObjectPointMap::value_type& objectPointPair : localizedObjectPointMap)
-		{
-			const LocalizedObjectPoint& localizedObjectPoint = objectPointPair.second;
-
-			if (localizedObjectPoint.hasObservation(frameIndex))
-			{
-				++objectPoints;
-			}
-		}
+		const size_t objectPoints = covisibilityGraph.numberLocalizedObjectPoints(frameIndex, localizedObjectPointMap);
 
 		if (objectPoints > bestObjectPoints)
 		{
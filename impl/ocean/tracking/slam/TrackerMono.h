@@ -13,21 +13,26 @@
 #include "ocean/tracking/slam/BackgroundTask.h"
 #include "ocean/tracking/slam/CameraPose.h"
 #include "ocean/tracking/slam/CameraPoses.h"
+#include "ocean/tracking/slam/CovisibilityGraph.h"
 #include "ocean/tracking/slam/FramePyramidManager.h"
 #include "ocean/tracking/slam/Gravities.h"
 #include "ocean/tracking/slam/LocalizedObjectPoint.h"
+#include "ocean/tracking/slam/MapJournal.h"
 #include "ocean/tracking/slam/Mutex.h"
 #include "ocean/tracking/slam/OccupancyArray.h"
 #include "ocean/tracking/slam/PointTrack.h"
 #include "ocean/tracking/slam/PoseCorrespondences.h"
 #include "ocean/tracking/slam/TrackingCorrespondences.h"
 
+#include "ocean/base/Arena.h"
 #include "ocean/base/Frame.h"
+#include "ocean/base/HashMap.h"
 #include "ocean/base/HighPerformanceTimer.h"
 #include "ocean/base/RandomGenerator.h"
 #include "ocean/base/Thread.h"
 
 #include "ocean/cv/FramePyramid.h"
+#include "ocean/cv/FramePyramidCache.h"
 
 #include "ocean/math/AnyCamera.h"
 #include "ocean/math/Quaternion.h"
@@ -184,7 +189,9 @@ class OCEAN_TRACKING_SLAM_EXPORT TrackerMono :
 		/**
 		 * Definition of an unordered map mapping object point ids to observation pairs.
 		 */
-		using ObjectPointToObservations = std::unordered_map<Index32, PoseIndexToImagePointPairs>;
+		using ObjectPointToObservations = FlatHashMap<Index32, PoseIndexToImagePointPairs>;
+
+	public:
 
 		/**
 		 * This class encapsulates all performance measurement logic for the TrackerMono.
@@ -253,6 +260,9 @@ class OCEAN_TRACKING_SLAM_EXPORT TrackerMono :
 				/// Performance statistic for the handleFrame() function.
 				HighPerformanceStatistic handleFrame_;
 
+				/// Performance statistic for creating the frame pyramid of the current frame.
+				HighPerformanceStatistic createPyramid_;
+
 				/// Performance statistic for tracking image points.
 				HighPerformanceStatistic trackImagePoints_;
 
@@ -284,6 +294,8 @@ class OCEAN_TRACKING_SLAM_EXPORT TrackerMono :
 				HighPerformanceStatistic matchLocalizedObjectPointsToCorners_;
 		};
 
+	protected:
+
 		/**
 		 * Definition of a pair combining object point ids and object point positions.
 		 */
@@ -406,6 +418,14 @@ class OCEAN_TRACKING_SLAM_EXPORT TrackerMono :
 		 */
 		bool configure(const Configuration& configuration);
 
+		/**
+		 * Sets a pyramid cache which is shared with other trackers processing the same camera stream.
+		 * With a cache, the pyramid of each frame is taken from the cache instead of being created by this tracker, the frames must have a valid timestamp.<br>
+		 * This function must be called before the first frame is processed.
+		 * @param framePyramidCache The pyramid cache to be used, nullptr to create the pyramids within the tracker
+		 */
+		inline void setFramePyramidCache(CV::SharedFramePyramidCache framePyramidCache);
+
 		/**
 		 * Processes a new camera frame and determines the camera pose.
 		 * This is the main entry point for the tracker. The function tracks feature points from the previous frame, estimates the 6-DOF camera pose, and triggers background processing for map maintenance.<br>
@@ -440,6 +460,24 @@ class OCEAN_TRACKING_SLAM_EXPORT TrackerMono :
 		 */
 		FramesStatistics framesStatistics() const;
 
+		/**
+		 * Returns the performance statistics of the individual stages of the tracker, e.g., for benchmarking.
+		 * Call only after the tracker has finished.
+		 * @return The tracker's performance statistics, without measurements if PerformanceStatistics::isEnabled_ is false
+		 */
+		inline const PerformanceStatistics& performanceStatistics() const;
+
+		/**
+		 * Writes a checkpoint of the tracker's map of localized object points to a journal.
+		 * Only the object points which have changed since the journal's previous checkpoint are copied, the actual serialization is done asynchronously by the journal's serializer.<br>
+		 * The map is read-locked while the changes are gathered; thus, this function can be called from the tracking thread or any other thread at any time.
+		 * @param mapJournal The journal receiving the checkpoint, must be valid
+		 * @param timestamp The timestamp of the checkpoint, must be valid
+		 * @param forceSnapshot True, to write the entire map; False, to write the changes only
+		 * @return True, if succeeded
+		 */
+		bool checkpointMap(MapJournal& mapJournal, const Timestamp& timestamp, const bool forceSnapshot = false) const;
+
 	protected:
 
 		/**
@@ -497,9 +535,20 @@ class OCEAN_TRACKING_SLAM_EXPORT TrackerMono :
 		 * @param currentFrameIndex The index of the current frame, with range [0, infinity)
 		 * @param yFramePyramid The grayscale frame pyramid for corner detection, must be valid and match camera dimensions
 		 * @param tryMatchCornersToLocalizedObjectPoints True to attempt matching corners to existing localized object points before adding as new tracks
+		 * @param precomputedCorners Optional Harris corners which have been detected in the finest pyramid layer already, nullptr to detect the corners within this function
 		 * @return True if detection succeeded or was skipped due to sufficient coverage; false if corner detection failed
+		 * @see detectCornersConcurrently().
 		 */
-		bool detectNewImagePoints(const AnyCamera& camera, const Index32 currentFrameIndex, const CV::FramePyramid& yFramePyramid, const bool tryMatchCornersToLocalizedObjectPoints);
+		bool detectNewImagePoints(const AnyCamera& camera, const Index32 currentFrameIndex, const CV::FramePyramid& yFramePyramid, const bool tryMatchCornersToLocalizedObjectPoints, CV::Detector::HarrisCorners* precomputedCorners = nullptr);
+
+		/**
+		 * Concurrent processing function:
+		 *
+		 * Detects the Harris corners in the finest layer of the current frame pyramid while the foreground thread determines the camera pose of the current frame.
+		 * The resulting corners are used by the post-processing function afterwards.
+		 * @see Configuration::detectCornersConcurrently_, detectNewImagePoints().
+		 */
+		void detectCornersConcurrently();
 
 		/**
 		 * Post-processing function:
@@ -634,10 +683,12 @@ class OCEAN_TRACKING_SLAM_EXPORT TrackerMono :
 		 *
 		 * Determines the topology for the bundle adjustment.
 		 * The function selects a subset of keyframes to be used in the bundle adjustment.
-		 * The selection strategy tries to maximize the spatial distribution of keyframes while ensuring sufficient feature overlap.
+		 * The selection strategy tries to maximize the spatial distribution of keyframes while ensuring sufficient feature overlap.<br>
+		 * The co-visibility graph is used to visit only the object points observed in candidate frames, so that the costs do not grow with the size of the entire map.
 		 * @param necessaryDataVersion The required map version; only frames with camera poses matching this version are considered
 		 * @param cameraPoses The camera poses of all frames, must be valid
 		 * @param localizedObjectPointMap The map of localized object points, must be valid
+		 * @param covisibilityGraph The co-visibility graph of the localized object points
 		 * @param maximalNumberNewKeyFrames The maximal number of new keyframes to add in this call, with range [1, infinity)
 		 * @param maximalNumberKeyFrames The maximal number of keyframes to be selected, with range [2, infinity)
 		 * @param keyFrameIndices The indices of the selected keyframes, will be updated with new keyframes and may have old ones removed
@@ -646,7 +697,7 @@ class OCEAN_TRACKING_SLAM_EXPORT TrackerMono :
 		 * @param maximalFrameHistory The maximal frame history to consider when selecting keyframes, with range [1, infinity)
 		 * @return True if the topology was successfully determined with at least minimalNumberKeyFrames; false otherwise
 		 */
-		static bool determineBundleAdjustmentTopology(const Index32 necessaryDataVersion, const CameraPoses& cameraPoses, const LocalizedObjectPointMap& localizedObjectPointMap, const size_t maximalNumberNewKeyFrames, const size_t maximalNumberKeyFrames, Indices32& keyFrameIndices, ObjectPointToObservations& objectPointToObservations, const size_t minimalNumberKeyFrames = 3, const size_t maximalFrameHistory = 300);
+		static bool determineBundleAdjustmentTopology(const Index32 necessaryDataVersion, const CameraPoses& cameraPoses, const LocalizedObjectPointMap& localizedObjectPointMap, const CovisibilityGraph& covisibilityGraph, const size_t maximalNumberNewKeyFrames, const size_t maximalNumberKeyFrames, Indices32& keyFrameIndices, ObjectPointToObservations& objectPointToObservations, const size_t minimalNumberKeyFrames = 3, const size_t maximalFrameHistory = 300);
 
 		/**
 		 * Background function:
@@ -662,16 +713,17 @@ class OCEAN_TRACKING_SLAM_EXPORT TrackerMono :
 		/**
 		 * Determines the frame index with the most visible localized object points.
 		 * This function iterates through all frames with valid camera poses and counts how many
-		 * localized object points have observations in each frame, returning the frame with the highest count.
+		 * localized object points have observations in each frame (based on the co-visibility graph), returning the frame with the highest count.
 		 * Only frames whose camera pose has a matching map version are considered.
 		 * @param necessaryDataVersion The required map version; only frames with camera poses matching this version are considered
 		 * @param cameraPoses The camera poses for all frames, must not be empty
 		 * @param localizedObjectPointMap The map of localized 3D object points with their observations
+		 * @param covisibilityGraph The co-visibility graph of the localized object points
 		 * @param minimalNumberObjectPoints The minimal number of object points that must be visible in a frame for it to be considered valid, with range [1, infinity)
 		 * @param ignoreFrameIndices Optional set of frame indices to skip during the search, nullptr to consider all frames
 		 * @return The index of the frame with the most visible object points (meeting the threshold), or Index32(-1) if no valid frame was found
 		 */
-		static Index32 frameIndexWithMostLocalizedObjectPoints(const Index32 necessaryDataVersion, const CameraPoses& cameraPoses, const LocalizedObjectPointMap& localizedObjectPointMap, const size_t minimalNumberObjectPoints, const UnorderedIndexSet32* ignoreFrameIndices = nullptr);
+		static Index32 frameIndexWithMostLocalizedObjectPoints(const Index32 necessaryDataVersion, const CameraPoses& cameraPoses, const LocalizedObjectPointMap& localizedObjectPointMap, const CovisibilityGraph& covisibilityGraph, const size_t minimalNumberObjectPoints, const UnorderedIndexSet32* ignoreFrameIndices = nullptr);
 
 		/**
 		 * Returns the maximal distance between two descriptors so that they are considered a match (35% of descriptor size).
@@ -699,12 +751,18 @@ class OCEAN_TRACKING_SLAM_EXPORT TrackerMono :
 		/// The map of localized 3D object points, mapping object point ids to their 3D positions and observation history.
 		LocalizedObjectPointMap localizedObjectPointMap_;
 
+		/// The co-visibility graph of all localized object points, updated whenever observations are added to localized object points.
+		CovisibilityGraph covisibilityGraph_;
+
 		/// The counter for generating unique object point ids.
 		Index32 objectPointIdCounter_ = 0u;
 
 		/// The manager for frame pyramids providing thread-safe access to image pyramids for foreground and background processing.
 		FramePyramidManager framePyramidManager_;
 
+		/// The optional pyramid cache shared with other trackers, nullptr if the tracker creates the pyramids.
+		CV::SharedFramePyramidCache framePyramidCache_;
+
 		/// The adaptive Harris corner detection threshold, adjusted dynamically based on feature coverage.
 		unsigned int harrisThreshold_ = 0u;
 
@@ -738,6 +796,12 @@ class OCEAN_TRACKING_SLAM_EXPORT TrackerMono :
 		/// The random generator for the background thread.
 		RandomGenerator randomGeneratorBackground_;
 
+		/// The arena for temporary containers of the post-processing of a frame, reset with each frame to avoid memory allocations.
+		Arena postHandleFrameArena_;
+
+		/// The arena for temporary containers of the background thread, reset with each iteration to avoid memory allocations.
+		Arena backgroundArena_;
+
 		/// The frame indices of keyframes used in the most recent Bundle Adjustment.
 		Indices32 bundleAdjustmentKeyFrameIndices_;
 
@@ -756,6 +820,21 @@ class OCEAN_TRACKING_SLAM_EXPORT TrackerMono :
 		/// The background task which will execute the post processing for the handleFrame() function.
 		BackgroundTask postHandleFrameTask_;
 
+		/// The background task which will detect the Harris corners of the current frame concurrently to the pose estimation, if enabled in the configuration.
+		BackgroundTask cornerDetectionTask_;
+
+		/// True, if the corner detection task has been executed for the current frame and still needs to be waited for.
+		bool cornerDetectionPending_ = false;
+
+		/// The Harris threshold which is used by the corner detection task, with range [harrisThresholdMin_, harrisThresholdMax_].
+		unsigned int cornerDetectionThreshold_ = 0u;
+
+		/// True, if the corner detection task succeeded.
+		bool cornerDetectionSucceeded_ = false;
+
+		/// The Harris corners which have been detected by the corner detection task.
+		CV::Detector::HarrisCorners cornerDetectionCorners_;
+
 		/// The rate calculator for measuring the frame processing rate.
 		RateCalculator handleFrameRateCalculator_;
 
@@ -844,11 +923,21 @@ inline void TrackerMono::PerformanceStatistics::stop(HighPerformanceStatistic& s
 	}
 }
 
+inline void TrackerMono::setFramePyramidCache(CV::SharedFramePyramidCache framePyramidCache)
+{
+	framePyramidCache_ = std::move(framePyramidCache);
+}
+
 inline Index32 TrackerMono::frameIndex() const
 {
 	return cameraPoses_.frameIndex();
 }
 
+inline const TrackerMono::PerformanceStatistics& TrackerMono::performanceStatistics() const
+{
+	return performanceStatistics_;
+}
+
 inline Index32 TrackerMono::uniqueObjectPointId()
 {
 	// now thread-safty necessary as the function is only called from one place
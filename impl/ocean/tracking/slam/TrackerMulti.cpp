@@ -0,0 +1,1469 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "ocean/tracking/slam/TrackerMulti.h"
+
+#include "ocean/base/Subset.h"
+#include "ocean/base/WorkerPool.h"
+
+#include "ocean/cv/detector/HarrisCornerDetector.h"
+
+#include "ocean/geometry/NonLinearOptimizationObjectPoint.h"
+#include "ocean/geometry/NonLinearOptimizationTransformation.h"
+#include "ocean/geometry/RANSAC.h"
+#include "ocean/geometry/SpatialDistribution.h"
+#include "ocean/geometry/Utilities.h"
+
+namespace Ocean
+{
+
+namespace Tracking
+{
+
+namespace SLAM
+{
+
+TrackerMulti::CameraFrontEnd::CameraFrontEnd(const unsigned int cameraIndex, const unsigned int numberCameras, SharedAnyCamera camera, const HomogenousMatrix4& device_T_camera, const Configuration& configuration, RandomGenerator& randomGenerator) :
+	camera_(std::move(camera)),
+	device_T_camera_(device_T_camera),
+	flippedCamera_T_device_(Camera::standard2InvertedFlipped(device_T_camera)),
+	harrisThreshold_(configuration.harrisThresholdMean()),
+	randomGenerator_(randomGenerator),
+	cameraIndex_(cameraIndex),
+	numberCameras_(numberCameras)
+{
+	ocean_assert(camera_ && camera_->isValid());
+	ocean_assert(device_T_camera_.isValid());
+	ocean_assert(cameraIndex_ < numberCameras_);
+
+	trackingParameters_ = TrackingParameters(camera_->width(), camera_->height(), configuration);
+	ocean_assert(trackingParameters_.isValid());
+}
+
+TrackerMulti::TrackerMulti()
+{
+	ocean_assert(configuration_.isValid());
+
+	postHandleFramesTask_.setTask(std::bind(&TrackerMulti::postHandleFrames, this));
+}
+
+TrackerMulti::~TrackerMulti()
+{
+	postHandleFramesTask_.release();
+}
+
+bool TrackerMulti::configure(const Configuration& configuration)
+{
+	if (!configuration.isValid())
+	{
+		return false;
+	}
+
+	if (!frontEnds_.empty())
+	{
+		return false;
+	}
+
+	configuration_ = configuration;
+
+	return true;
+}
+
+bool TrackerMulti::handleFrames(const SharedAnyCameras& cameras, const HomogenousMatrices4& device_T_cameras, Frames&& yFrames, HomogenousMatrix4& world_T_device, Worker* worker)
+{
+	world_T_device.toNull();
+
+	ocean_assert(configuration_.isValid());
+	if (!configuration_.isValid())
+	{
+		return false;
+	}
+
+	ocean_assert(cameras.size() >= 2);
+	ocean_assert(cameras.size() == device_T_cameras.size() && cameras.size() == yFrames.size());
+
+	if (cameras.size() < 2 || cameras.size() != device_T_cameras.size() || cameras.size() != yFrames.size())
+	{
+		return false;
+	}
+
+	for (size_t nCamera = 0; nCamera < cameras.size(); ++nCamera)
+	{
+		const SharedAnyCamera& camera = cameras[nCamera];
+		const Frame& yFrame = yFrames[nCamera];
+
+		ocean_assert(camera && camera->isValid());
+		if (!camera || !camera->isValid())
+		{
+			return false;
+		}
+
+		ocean_assert(device_T_cameras[nCamera].isValid());
+		if (!device_T_cameras[nCamera].isValid())
+		{
+			return false;
+		}
+
+		ocean_assert(yFrame.width() == camera->width() && yFrame.height() == camera->height());
+		if (yFrame.width() != camera->width() || yFrame.height() != camera->height())
+		{
+			return false;
+		}
+
+		ocean_assert(yFrame.isPixelFormatDataLayoutCompatible(FrameType::FORMAT_Y8));
+		if (!yFrame.isPixelFormatDataLayoutCompatible(FrameType::FORMAT_Y8))
+		{
+			return false;
+		}
+
+		ocean_assert(yFrame.timestamp().isValid());
+		if (!yFrame.timestamp().isValid())
+		{
+			return false;
+		}
+	}
+
+	if (frontEnds_.empty())
+	{
+		// we make a clone of the very first valid camera models, afterwards we assume that the models and the rig never change
+
+		ocean_assert(trackerState_ == TS_UNKNOWN);
+
+		cameras_.reserve(cameras.size());
+		frontEnds_.reserve(cameras.size());
+
+		for (size_t nCamera = 0; nCamera < cameras.size(); ++nCamera)
+		{
+			cameras_.emplace_back(cameras[nCamera]->clone());
+
+			frontEnds_.emplace_back(std::make_unique<CameraFrontEnd>((unsigned int)(nCamera), (unsigned int)(cameras.size()), cameras_.back(), device_T_cameras[nCamera], configuration_, randomGenerator_));
+		}
+
+		device_T_cameras_ = device_T_cameras;
+
+		trackerState_ = TS_INITIALIZING;
+	}
+
+	ocean_assert(frontEnds_.size() == cameras.size());
+	if (frontEnds_.size() != cameras.size())
+	{
+		return false;
+	}
+
+#ifdef OCEAN_DEBUG
+	for (size_t nCamera = 0; nCamera < cameras.size(); ++nCamera)
+	{
+		ocean_assert(cameras_[nCamera]->isEqual(*cameras[nCamera]));
+		ocean_assert(device_T_cameras_[nCamera].isEqual(device_T_cameras[nCamera]));
+	}
+#endif
+
+	const unsigned int numberCameras = (unsigned int)(frontEnds_.size());
+
+	for (Frame& yFrame : yFrames)
+	{
+		yFrame.makeOwner();
+	}
+
+	// first, let's create the pyramids of the new frames while the background task may still be busy with the previous frames
+
+	if (worker != nullptr)
+	{
+		worker->executeFunction(Worker::Function::create(*this, &TrackerMulti::createPyramidsSubset, &yFrames, 0u, 0u), 0u, numberCameras);
+	}
+	else
+	{
+		createPyramidsSubset(&yFrames, 0u, numberCameras);
+	}
+
+	// we need to wait until the background task has finished with post processing of the previous handleFrames() call
+
+	const BackgroundTask::WaitResult postHandleFramesResult = postHandleFramesTask_.wait();
+
+	ocean_assert(postHandleFramesResult == BackgroundTask::WR_RELEASED || postHandleFramesResult == BackgroundTask::WR_PROCESSED);
+	if (postHandleFramesResult == BackgroundTask::WR_RELEASED)
+	{
+		return false;
+	}
+
+	devicePoses_.nextFrame();
+
+	const Index32 currentFrameIndex = devicePoses_.frameIndex();
+
+	if constexpr (loggingEnabled_)
+	{
+		Log::info() << " ";
+		Log::info() << "Frame index: " << currentFrameIndex << ", " << translateTrackerState(trackerState_);
+	}
+
+	for (const std::unique_ptr<CameraFrontEnd>& frontEnd : frontEnds_)
+	{
+		frontEnd->cameraPoses_.nextFrame();
+		ocean_assert(frontEnd->cameraPoses_.frameIndex() == currentFrameIndex);
+
+		// we rotate the pyramids, so that the memory of the previous pyramid can be re-used for the next frame
+
+		std::swap(frontEnd->previousPyramid_, frontEnd->currentPyramid_);
+		std::swap(frontEnd->currentPyramid_, frontEnd->nextPyramid_);
+	}
+
+	if (currentFrameIndex != 0u)
+	{
+		// the frame-to-frame tracking of the individual cameras is independent, so that all cameras are tracked concurrently
+
+		if (worker != nullptr)
+		{
+			worker->executeFunction(Worker::Function::create(*this, &TrackerMulti::trackImagePointsSubset, currentFrameIndex, 0u, 0u), 0u, numberCameras);
+		}
+		else
+		{
+			trackImagePointsSubset(currentFrameIndex, 0u, numberCameras);
+		}
+
+		if (trackerState_ == TS_TRACKING)
+		{
+			const HomogenousMatrix4 world_T_currentDevice = determineCurrentDevicePose(currentFrameIndex);
+
+			if (world_T_currentDevice.isValid())
+			{
+				world_T_device = world_T_currentDevice;
+
+				numberFramesWithoutPose_ = 0u;
+			}
+			else
+			{
+				++numberFramesWithoutPose_;
+			}
+		}
+	}
+
+	postHandleFramesTask_.execute();
+
+	return true;
+}
+
+bool TrackerMulti::determineDevicePose(const SharedAnyCameras& cameras, const HomogenousMatrices4& device_T_cameras, const Geometry::ObjectPointGroups& objectPointGroups, const Geometry::ImagePointGroups& imagePointGroups, const HomogenousMatrix4& world_T_roughDevice, RandomGenerator& randomGenerator, HomogenousMatrix4& world_T_device, const size_t minimalNumberCorrespondences, const Scalar maximalProjectionError, IndexGroups32* usedIndexGroups, Scalar* sqrAccuracy)
+{
+	ocean_assert(!cameras.empty());
+	ocean_assert(cameras.size() == device_T_cameras.size());
+	ocean_assert(cameras.size() == objectPointGroups.size() && cameras.size() == imagePointGroups.size());
+	ocean_assert(minimalNumberCorrespondences >= 5);
+	ocean_assert(maximalProjectionError >= 0);
+
+	if (cameras.empty() || cameras.size() != device_T_cameras.size() || cameras.size() != objectPointGroups.size() || cameras.size() != imagePointGroups.size())
+	{
+		return false;
+	}
+
+	size_t numberCorrespondences = 0;
+	size_t bestCameraIndex = 0;
+
+	for (size_t nCamera = 0; nCamera < cameras.size(); ++nCamera)
+	{
+		ocean_assert(objectPointGroups[nCamera].size() == imagePointGroups[nCamera].size());
+		if (objectPointGroups[nCamera].size() != imagePointGroups[nCamera].size())
+		{
+			return false;
+		}
+
+		numberCorrespondences += objectPointGroups[nCamera].size();
+
+		if (objectPointGroups[nCamera].size() > objectPointGroups[bestCameraIndex].size())
+		{
+			bestCameraIndex = nCamera;
+		}
+	}
+
+	if (numberCorrespondences < minimalNumberCorrespondences)
+	{
+		return false;
+	}
+
+	const Scalar sqrMaximalProjectionError = Numeric::sqr(maximalProjectionError);
+
+	HomogenousMatrix4 world_T_initialDevice(world_T_roughDevice);
+
+	if (!world_T_initialDevice.isValid())
+	{
+		// we do not have a rough pose, so we determine the pose of the camera with most correspondences and derive the initial device pose from this camera
+
+		const Vectors3& objectPoints = objectPointGroups[bestCameraIndex];
+		const Vectors2& imagePoints = imagePointGroups[bestCameraIndex];
+
+		if (objectPoints.size() < 5)
+		{
+			return false;
+		}
+
+		HomogenousMatrix4 world_T_camera(false);
+		if (!Geometry::RANSAC::p3p(*cameras[bestCameraIndex], ConstArrayAccessor<Vector3>(objectPoints), ConstArrayAccessor<Vector2>(imagePoints), randomGenerator, world_T_camera, 5u, true /*refine*/, 50u, sqrMaximalProjectionError))
+		{
+			return false;
+		}
+
+		world_T_initialDevice = world_T_camera * device_T_cameras[bestCameraIndex].inverted();
+	}
+
+	// now, we optimize the device pose with the correspondences of all cameras
+	// the device defines the coordinate system of the (static) cameras, the world coordinate system is the object which is transformed
+
+	std::vector<const AnyCamera*> groupCameras;
+	HomogenousMatrices4 flippedCameras_T_device;
+	Geometry::ObjectPointGroups groupObjectPoints;
+	Geometry::ImagePointGroups groupImagePoints;
+	Indices32 groupCameraIndices;
+
+	groupCameras.reserve(cameras.size());
+	flippedCameras_T_device.reserve(cameras.size());
+	groupObjectPoints.reserve(cameras.size());
+	groupImagePoints.reserve(cameras.size());
+	groupCameraIndices.reserve(cameras.size());
+
+	for (size_t nCamera = 0; nCamera < cameras.size(); ++nCamera)
+	{
+		if (objectPointGroups[nCamera].empty())
+		{
+			continue;
+		}
+
+		groupCameras.push_back(cameras[nCamera].get());
+		flippedCameras_T_device.push_back(Camera::standard2InvertedFlipped(device_T_cameras[nCamera]));
+		groupObjectPoints.push_back(objectPointGroups[nCamera]);
+		groupImagePoints.push_back(imagePointGroups[nCamera]);
+		groupCameraIndices.push_back(Index32(nCamera));
+	}
+
+	HomogenousMatrix4 device_T_world(false);
+	if (!Geometry::NonLinearOptimizationTransformation::optimizeObjectTransformationIF(ConstArrayAccessor<const AnyCamera*>(groupCameras), flippedCameras_T_device, world_T_initialDevice.inverted(), groupObjectPoints, groupImagePoints, device_T_world, 20u, Geometry::Estimator::ET_HUBER))
+	{
+		return false;
+	}
+
+	// let's identify the outliers and optimize the pose again with the inliers only
+
+	IndexGroups32 validIndexGroups(cameras.size());
+
+	size_t numberValidCorrespondences = 0;
+	size_t numberGroupsWithOutliers = 0;
+
+	for (size_t nGroup = 0; nGroup < groupCameras.size(); ++nGroup)
+	{
+		const AnyCamera& camera = *groupCameras[nGroup];
+		const HomogenousMatrix4 flippedCamera_T_world(flippedCameras_T_device[nGroup] * device_T_world);
+
+		const Vectors3& objectPoints = groupObjectPoints[nGroup];
+		const Vectors2& imagePoints = groupImagePoints[nGroup];
+
+		Indices32& validIndices = validIndexGroups[groupCameraIndices[nGroup]];
+		validIndices.reserve(objectPoints.size());
+
+		for (size_t nCorrespondence = 0; nCorrespondence < objectPoints.size(); ++nCorrespondence)
+		{
+			const Vector3& objectPoint = objectPoints[nCorrespondence];
+
+			if (AnyCamera::isObjectPointInFrontIF(flippedCamera_T_world, objectPoint) && camera.projectToImageIF(flippedCamera_T_world, objectPoint).sqrDistance(imagePoints[nCorrespondence]) <= sqrMaximalProjectionError)
+			{
+				validIndices.push_back(Index32(nCorrespondence));
+			}
+		}
+
+		numberValidCorrespondences += validIndices.size();
+
+		if (validIndices.size() != objectPoints.size())
+		{
+			++numberGroupsWithOutliers;
+		}
+	}
+
+	if (numberValidCorrespondences < minimalNumberCorrespondences)
+	{
+		return false;
+	}
+
+	if (numberGroupsWithOutliers != 0)
+	{
+		std::vector<const AnyCamera*> inlierCameras;
+		HomogenousMatrices4 inlierFlippedCameras_T_device;
+		Geometry::ObjectPointGroups inlierObjectPoints;
+		Geometry::ImagePointGroups inlierImagePoints;
+
+		for (size_t nGroup = 0; nGroup < groupCameras.size(); ++nGroup)
+		{
+			const Indices32& validIndices = validIndexGroups[groupCameraIndices[nGroup]];
+
+			if (validIndices.empty())
+			{
+				continue;
+			}
+
+			inlierCameras.push_back(groupCameras[nGroup]);
+			inlierFlippedCameras_T_device.push_back(flippedCameras_T_device[nGroup]);
+			inlierObjectPoints.emplace_back(Subset::subset(groupObjectPoints[nGroup], validIndices));
+			inlierImagePoints.emplace_back(Subset::subset(groupImagePoints[nGroup], validIndices));
+		}
+
+		HomogenousMatrix4 device_T_optimizedWorld(false);
+		if (!Geometry::NonLinearOptimizationTransformation::optimizeObjectTransformationIF(ConstArrayAccessor<const AnyCamera*>(inlierCameras), inlierFlippedCameras_T_device, device_T_world, inlierObjectPoints, inlierImagePoints, device_T_optimizedWorld, 20u, Geometry::Estimator::ET_SQUARE))
+		{
+			return false;
+		}
+
+		device_T_world = device_T_optimizedWorld;
+	}
+
+	if (sqrAccuracy != nullptr)
+	{
+		Scalar sumSqrErrors = 0;
+
+		for (size_t nCamera = 0; nCamera < cameras.size(); ++nCamera)
+		{
+			const HomogenousMatrix4 flippedCamera_T_world(Camera::standard2InvertedFlipped(device_T_cameras[nCamera]) * device_T_world);
+
+			for (const Index32& validIndex : validIndexGroups[nCamera])
+			{
+				sumSqrErrors += cameras[nCamera]->projectToImageIF(flippedCamera_T_world, objectPointGroups[nCamera][validIndex]).sqrDistance(imagePointGroups[nCamera][validIndex]);
+			}
+		}
+
+		*sqrAccuracy = sumSqrErrors / Scalar(numberValidCorrespondences);
+	}
+
+	if (usedIndexGroups != nullptr)
+	{
+		*usedIndexGroups = std::move(validIndexGroups);
+	}
+
+	world_T_device = device_T_world.inverted();
+
+	return true;
+}
+
+void TrackerMulti::createPyramidsSubset(Frames* yFrames, const unsigned int firstCamera, const unsigned int numberCameras)
+{
+	ocean_assert(yFrames != nullptr);
+	ocean_assert(firstCamera + numberCameras <= frontEnds_.size());
+
+	for (unsigned int nCamera = firstCamera; nCamera < firstCamera + numberCameras; ++nCamera)
+	{
+		CameraFrontEnd& frontEnd = *frontEnds_[nCamera];
+
+		// the front-ends track without rotation prior, so the pyramids need the layers for unguided tracking only
+
+		if (!frontEnd.nextPyramid_.replace(CV::FramePyramid::DM_FILTER_11, std::move((*yFrames)[nCamera]), frontEnd.trackingParameters_.pyramidLayers(false), nullptr))
+		{
+			ocean_assert(false && "This should never happen!");
+		}
+	}
+}
+
+void TrackerMulti::trackImagePointsSubset(const Index32 currentFrameIndex, const unsigned int firstCamera, const unsigned int numberCameras)
+{
+	ocean_assert(currentFrameIndex >= 1u);
+	ocean_assert(firstCamera + numberCameras <= frontEnds_.size());
+
+	const Index32 previousFrameIndex = currentFrameIndex - 1u;
+
+	for (unsigned int nCamera = firstCamera; nCamera < firstCamera + numberCameras; ++nCamera)
+	{
+		CameraFrontEnd& frontEnd = *frontEnds_[nCamera];
+
+		ocean_assert(frontEnd.previousPyramid_.isValid() && frontEnd.currentPyramid_.isValid());
+
+		HomogenousMatrix4 world_T_previousCamera(false);
+
+		if (trackerState_ == TS_TRACKING)
+		{
+			const SharedCameraPose previousCameraPose = frontEnd.cameraPoses_.pose(previousFrameIndex);
+
+			if (previousCameraPose && previousCameraPose->mapVersion() == frontEnd.trackingCorrespondences_.mapVersion())
+			{
+				world_T_previousCamera = previousCameraPose->world_T_camera();
+			}
+		}
+
+		frontEnd.trackingCorrespondences_.trackImagePoints(currentFrameIndex, *frontEnd.camera_, world_T_previousCamera, frontEnd.previousPyramid_, frontEnd.currentPyramid_, frontEnd.trackingParameters_, Quaternion(false), minimalFrontPrecision_);
+
+		frontEnd.poseCorrespondences_.reset(frontEnd.trackingCorrespondences_);
+	}
+}
+
+HomogenousMatrix4 TrackerMulti::determineCurrentDevicePose(const Index32 currentFrameIndex)
+{
+	ocean_assert(currentFrameIndex >= 1u);
+	ocean_assert(trackerState_ == TS_TRACKING);
+
+	const size_t numberCameras = frontEnds_.size();
+
+	Geometry::ObjectPointGroups objectPointGroups(numberCameras);
+	Geometry::ImagePointGroups imagePointGroups(numberCameras);
+
+	for (size_t nCamera = 0; nCamera < numberCameras; ++nCamera)
+	{
+		const PoseCorrespondences& poseCorrespondences = frontEnds_[nCamera]->poseCorrespondences_;
+
+		if (poseCorrespondences.mapVersion_ != mapVersion_)
+		{
+			// the correspondences are based on an outdated map, this should never happen as the correspondences are updated after each Bundle Adjustment
+			continue;
+		}
+
+		objectPointGroups[nCamera] = poseCorrespondences.objectPoints_;
+		imagePointGroups[nCamera] = poseCorrespondences.imagePoints_;
+	}
+
+	const HomogenousMatrix4 world_T_previousDevice = devicePoses_.world_T_camera(currentFrameIndex - 1u);
+
+	constexpr size_t minimalNumberCorrespondences = 20;
+
+	HomogenousMatrix4 world_T_device(false);
+	IndexGroups32 usedIndexGroups;
+	Scalar sqrAccuracy = Numeric::maxValue();
+
+	if (!determineDevicePose(cameras_, device_T_cameras_, objectPointGroups, imagePointGroups, world_T_previousDevice, randomGenerator_, world_T_device, minimalNumberCorrespondences, configuration_.maximalProjectionError_, &usedIndexGroups, &sqrAccuracy))
+	{
+		if constexpr (loggingEnabled_)
+		{
+			Log::info() << "Device pose estimation failed";
+		}
+
+		return HomogenousMatrix4(false);
+	}
+
+	size_t numberUsedCorrespondences = 0;
+
+	std::vector<CameraPose::EstimatedMotion> cameraMotions(numberCameras, CameraPose::EM_UNKNOWN);
+
+	for (size_t nCamera = 0; nCamera < numberCameras; ++nCamera)
+	{
+		CameraFrontEnd& frontEnd = *frontEnds_[nCamera];
+		const PoseCorrespondences& poseCorrespondences = frontEnd.poseCorrespondences_;
+
+		const Indices32& usedIndices = usedIndexGroups[nCamera];
+
+		numberUsedCorrespondences += usedIndices.size();
+
+		// all correspondences which have not been used are outliers, the corresponding object points will be removed in the post processing
+
+		ocean_assert(frontEnd.outlierObjectPointIds_.empty());
+
+		if (usedIndices.size() != objectPointGroups[nCamera].size())
+		{
+			const UnorderedIndexSet32 usedIndexSet(usedIndices.cbegin(), usedIndices.cend());
+
+			for (size_t nCorrespondence = 0; nCorrespondence < objectPointGroups[nCamera].size(); ++nCorrespondence)
+			{
+				if (!usedIndexSet.contains(Index32(nCorrespondence)))
+				{
+					frontEnd.outlierObjectPointIds_.push_back(poseCorrespondences.objectPointIds_[nCorrespondence]);
+				}
+			}
+		}
+
+		if (!poseCorrespondences.imagePointSqrDistances_.empty())
+		{
+			cameraMotions[nCamera] = CameraPose::motionFromOpticalFlow(poseCorrespondences.imagePointSqrDistances_.data(), poseCorrespondences.imagePointSqrDistances_.size(), frontEnd.camera_->width(), frontEnd.camera_->height());
+		}
+	}
+
+	if constexpr (loggingEnabled_)
+	{
+		Log::info() << "Device pose estimation succeeded with " << numberUsedCorrespondences << " correspondences, with a projection error of " << Numeric::sqrt(sqrAccuracy) << "px";
+	}
+
+	const CameraPose::PoseQuality poseQuality = numberUsedCorrespondences >= minimalNumberCorrespondences * 4 ? CameraPose::PQ_MEDIUM : CameraPose::PQ_LOW;
+
+	setDevicePose(currentFrameIndex, world_T_device, poseQuality, cameraMotions.data());
+
+	return world_T_device;
+}
+
+void TrackerMulti::setDevicePose(const Index32 frameIndex, const HomogenousMatrix4& world_T_device, const CameraPose::PoseQuality poseQuality, const CameraPose::EstimatedMotion* cameraMotions)
+{
+	ocean_assert(world_T_device.isValid());
+
+	devicePoses_.setPose(frameIndex, std::make_shared<CameraPose>(world_T_device, poseQuality), mapVersion_);
+
+	for (size_t nCamera = 0; nCamera < frontEnds_.size(); ++nCamera)
+	{
+		CameraFrontEnd& frontEnd = *frontEnds_[nCamera];
+
+		const CameraPose::EstimatedMotion estimatedMotion = cameraMotions != nullptr ? cameraMotions[nCamera] : CameraPose::EM_UNKNOWN;
+
+		frontEnd.cameraPoses_.setPose(frameIndex, std::make_shared<CameraPose>(world_T_device * frontEnd.device_T_camera_, poseQuality, estimatedMotion), mapVersion_);
+	}
+}
+
+void TrackerMulti::postHandleFrames()
+{
+	ocean_assert(!frontEnds_.empty());
+
+	const Index32 currentFrameIndex = devicePoses_.frameIndex();
+
+	if (trackerState_ == TS_TRACKING && numberFramesWithoutPose_ >= maximalNumberFramesWithoutPose_)
+	{
+		Log::warning() << "TrackerMulti: Device pose could not be determined for " << numberFramesWithoutPose_ << " frames, resetting the map for frame index " << currentFrameIndex;
+
+		resetMap();
+	}
+
+	const unsigned int numberCameras = (unsigned int)(frontEnds_.size());
+
+	// first, the individual front-ends are updated concurrently
+
+	{
+		const WorkerPool::ScopedWorker scopedWorker(WorkerPool::get().scopedWorker());
+
+		if (scopedWorker)
+		{
+			scopedWorker()->executeFunction(Worker::Function::create(*this, &TrackerMulti::postHandleFramesSubset, currentFrameIndex, 0u, 0u), 0u, numberCameras);
+		}
+		else
+		{
+			postHandleFramesSubset(currentFrameIndex, 0u, numberCameras);
+		}
+	}
+
+	// now, let's use the known transformations between the cameras to initialize or to extend the map
+
+	if (trackerState_ == TS_INITIALIZING)
+	{
+		// the device pose of the initialization frame defines the world coordinate system
+
+		const HomogenousMatrix4 world_T_device(true);
+
+		if (triangulateStereoObjectPoints(currentFrameIndex, world_T_device, minimalNumberInitialObjectPoints_) != 0)
+		{
+			setDevicePose(currentFrameIndex, world_T_device, CameraPose::PQ_HIGH);
+
+			trackerState_ = TS_TRACKING;
+
+			stereoTriangulationFrameIndex_ = currentFrameIndex;
+			bundleAdjustmentFrameIndex_ = currentFrameIndex;
+
+			numberFramesWithoutPose_ = 0u;
+
+			if constexpr (loggingEnabled_)
+			{
+				Log::info() << "Map initialized in frame " << currentFrameIndex;
+			}
+		}
+	}
+	else if (trackerState_ == TS_TRACKING)
+	{
+		const HomogenousMatrix4 world_T_device = devicePoses_.world_T_camera(currentFrameIndex);
+
+		if (world_T_device.isValid())
+		{
+			if (currentFrameIndex >= stereoTriangulationFrameIndex_ + stereoTriangulationInterval_)
+			{
+				triangulateStereoObjectPoints(currentFrameIndex, world_T_device, 1);
+
+				stereoTriangulationFrameIndex_ = currentFrameIndex;
+			}
+
+			if (currentFrameIndex >= bundleAdjustmentFrameIndex_ + bundleAdjustmentInterval_)
+			{
+				bundleAdjustment(currentFrameIndex);
+
+				bundleAdjustmentFrameIndex_ = currentFrameIndex;
+			}
+		}
+	}
+
+	// finally, we prepare the correspondences for the next frame
+
+	updateCorrespondencesSubset(currentFrameIndex, 0u, numberCameras);
+}
+
+void TrackerMulti::postHandleFramesSubset(const Index32 currentFrameIndex, const unsigned int firstCamera, const unsigned int numberCameras)
+{
+	ocean_assert(firstCamera + numberCameras <= frontEnds_.size());
+
+	for (unsigned int nCamera = firstCamera; nCamera < firstCamera + numberCameras; ++nCamera)
+	{
+		CameraFrontEnd& frontEnd = *frontEnds_[nCamera];
+
+		ocean_assert(frontEnd.currentPyramid_.isValid());
+
+		const unsigned int frameWidth = frontEnd.camera_->width();
+		const unsigned int frameHeight = frontEnd.camera_->height();
+
+		// first, let's initialize or clear the occupancy array
+
+		if (!frontEnd.occupancyArray_.isValid())
+		{
+			unsigned int horizontalBins = 0u;
+			unsigned int verticalBins = 0u;
+			Geometry::SpatialDistribution::idealBins(frameWidth, frameHeight, configuration_.numberBins_, horizontalBins, verticalBins);
+
+			ocean_assert(horizontalBins >= 1u && verticalBins >= 1u);
+			if (horizontalBins == 0u || verticalBins == 0u)
+			{
+				continue;
+			}
+
+			constexpr unsigned int neighborhoodSize = 3u;
+			constexpr float minCoverageThreshold = 0.8f;
+
+			horizontalBins *= neighborhoodSize;
+			verticalBins *= neighborhoodSize;
+
+			frontEnd.occupancyArray_ = OccupancyArray(Scalar(0), Scalar(0), frameWidth, frameHeight, horizontalBins, verticalBins, neighborhoodSize, minCoverageThreshold);
+		}
+		else
+		{
+			frontEnd.occupancyArray_.removePoints();
+		}
+
+		// the outliers of the pose estimation are removed from the map of this camera
+
+		for (const Index32 outlierObjectPointId : frontEnd.outlierObjectPointIds_)
+		{
+			frontEnd.localizedObjectPointMap_.erase(outlierObjectPointId);
+		}
+
+		frontEnd.outlierObjectPointIds_.clear();
+
+		processTrackingResults(frontEnd, currentFrameIndex);
+
+		if (trackerState_ == TS_TRACKING)
+		{
+			localizeUnlocalizedObjectPoints(frontEnd, currentFrameIndex);
+		}
+
+		detectNewImagePoints(frontEnd, currentFrameIndex, configuration_);
+	}
+}
+
+void TrackerMulti::updateCorrespondencesSubset(const Index32 currentFrameIndex, const unsigned int firstCamera, const unsigned int numberCameras)
+{
+	ocean_assert(firstCamera + numberCameras <= frontEnds_.size());
+
+	for (unsigned int nCamera = firstCamera; nCamera < firstCamera + numberCameras; ++nCamera)
+	{
+		CameraFrontEnd& frontEnd = *frontEnds_[nCamera];
+
+		frontEnd.trackingCorrespondences_.update(currentFrameIndex, mapVersion_, frontEnd.localizedObjectPointMap_, frontEnd.pointTrackMap_, minimalFrontPrecision_);
+	}
+}
+
+void TrackerMulti::processTrackingResults(CameraFrontEnd& frontEnd, const Index32 currentFrameIndex)
+{
+	const TrackingCorrespondences& trackingCorrespondences = frontEnd.trackingCorrespondences_;
+
+	const Vectors2& currentImagePoints = trackingCorrespondences.currentImagePoints();
+	const Indices32& pointIds = trackingCorrespondences.pointIds();
+	const TrackingCorrespondences::ValidCorrespondences& validCorrespondences = trackingCorrespondences.validCorrespondences();
+
+	ocean_assert(currentImagePoints.size() == pointIds.size());
+	ocean_assert(currentImagePoints.size() == validCorrespondences.size());
+
+	for (size_t nCorrespondence = 0; nCorrespondence < currentImagePoints.size(); ++nCorrespondence)
+	{
+		const Vector2& currentImagePoint = currentImagePoints[nCorrespondence];
+		const Index32 objectPointId = pointIds[nCorrespondence];
+		const bool isValid = validCorrespondences[nCorrespondence] == uint8_t(1);
+
+		if (isValid)
+		{
+			frontEnd.occupancyArray_.addPoint(currentImagePoint);
+		}
+
+		const PointTrackMap::iterator iPointTrack = frontEnd.pointTrackMap_.find(objectPointId);
+
+		if (iPointTrack != frontEnd.pointTrackMap_.cend())
+		{
+			if (isValid)
+			{
+				ocean_assert(iPointTrack->second.lastFrameIndex() + 1u == currentFrameIndex);
+
+				iPointTrack->second.addObservation(currentFrameIndex, currentImagePoint);
+			}
+			else
+			{
+				frontEnd.pointTrackMap_.erase(iPointTrack);
+			}
+
+			continue;
+		}
+
+		const LocalizedObjectPointMap::iterator iObjectPoint = frontEnd.localizedObjectPointMap_.find(objectPointId);
+
+		if (iObjectPoint != frontEnd.localizedObjectPointMap_.cend())
+		{
+			if (isValid)
+			{
+				iObjectPoint->second.addObservation(currentFrameIndex, currentImagePoint);
+			}
+			else
+			{
+				// the tracker does not support re-localization, so that object points which cannot be tracked anymore will never be used again
+
+				frontEnd.localizedObjectPointMap_.erase(iObjectPoint);
+			}
+		}
+	}
+}
+
+bool TrackerMulti::detectNewImagePoints(CameraFrontEnd& frontEnd, const Index32 currentFrameIndex, const Configuration& configuration)
+{
+	ocean_assert(frontEnd.currentPyramid_.isValid());
+	ocean_assert(frontEnd.occupancyArray_.isValid());
+
+	if (!frontEnd.occupancyArray_.needMorePoints())
+	{
+		// most of the bins are containing feature points, so we don't need to add new features
+
+		return true;
+	}
+
+	const Frame& yFrame = frontEnd.currentPyramid_.finestLayer();
+	ocean_assert(yFrame.isPixelFormatDataLayoutCompatible(FrameType::FORMAT_Y8));
+
+	ocean_assert(configuration.harrisThresholdMin_ <= frontEnd.harrisThreshold_ && frontEnd.harrisThreshold_ <= configuration.harrisThresholdMax_);
+
+	CV::Detector::HarrisCorners corners;
+	if (!CV::Detector::HarrisCornerDetector::detectCorners(yFrame.constdata<uint8_t>(), yFrame.width(), yFrame.height(), yFrame.paddingElements(), frontEnd.harrisThreshold_, false /*frameIsUndistorted*/, corners, true /*determineExactPosition*/))
+	{
+		return false;
+	}
+
+	// we sort all corners by strength to ensure that we add the strongest corners first
+
+	std::sort(corners.begin(), corners.end());
+
+	for (const CV::Detector::HarrisCorner& corner : corners)
+	{
+		if (frontEnd.occupancyArray_.addPointIfEmpty(corner.observation()))
+		{
+			frontEnd.pointTrackMap_.emplace(frontEnd.uniqueObjectPointId(), PointTrack(currentFrameIndex, corner.observation()));
+		}
+	}
+
+	const size_t coveragePercent = size_t(frontEnd.occupancyArray_.coverage() * 100.0f + 0.5f);
+
+	if (coveragePercent < 40) // target is 40%
+	{
+		if (frontEnd.harrisThreshold_ > configuration.harrisThresholdMin_)
+		{
+			--frontEnd.harrisThreshold_;
+		}
+	}
+	else
+	{
+		if (frontEnd.harrisThreshold_ < configuration.harrisThresholdMax_)
+		{
+			++frontEnd.harrisThreshold_;
+		}
+	}
+
+	return true;
+}
+
+void TrackerMulti::localizeUnlocalizedObjectPoints(CameraFrontEnd& frontEnd, const Index32 currentFrameIndex)
+{
+	SharedCameraPose currentCameraPose;
+	if (!frontEnd.cameraPoses_.hasPose(currentFrameIndex, currentCameraPose))
+	{
+		return;
+	}
+
+	ocean_assert(currentCameraPose);
+	if (currentCameraPose->estimatedMotion() != CameraPose::EM_TRANSLATIONAL)
+	{
+		// the camera is currently not moving, so there is not enough baseline to determine a 3D location
+		return;
+	}
+
+	const AnyCamera& camera = *frontEnd.camera_;
+
+	constexpr size_t minimalNumberObservations = 10;
+	constexpr size_t maximalNumberObservations = 100;
+	constexpr size_t maximalNumberInvalidObservations = 2;
+
+	Vectors2 imagePoints;
+	HomogenousMatrices4 world_T_cameras;
+	HomogenousMatrices4 flippedCameras_T_world;
+	Indices32 validIndices;
+
+	Indices32 localizedObjectPointIds;
+
+	for (const PointTrackMap::value_type& pointPair : frontEnd.pointTrackMap_)
+	{
+		const PointTrack& pointTrack = pointPair.second;
+
+		const size_t numberObservations = pointTrack.numberObservationsUntil(currentFrameIndex);
+
+		if (numberObservations < minimalNumberObservations)
+		{
+			continue;
+		}
+
+		imagePoints.clear();
+		world_T_cameras.clear();
+		flippedCameras_T_world.clear();
+
+		const Index32 firstFrameIndex = pointTrack.firstFrameIndex() + Index32(numberObservations - std::min(numberObservations, maximalNumberObservations));
+
+		for (Index32 frameIndex = firstFrameIndex; frameIndex <= currentFrameIndex; ++frameIndex)
+		{
+			SharedCameraPose cameraPose;
+			if (!frontEnd.cameraPoses_.hasPose(frameIndex, cameraPose))
+			{
+				continue;
+			}
+
+			imagePoints.push_back(pointTrack.observation(frameIndex));
+			world_T_cameras.push_back(cameraPose->world_T_camera());
+			flippedCameras_T_world.push_back(cameraPose->flippedCamera_T_world());
+		}
+
+		if (imagePoints.size() < minimalNumberObservations)
+		{
+			continue;
+		}
+
+		// let's make a quick check whether the viewing rays come with enough parallax
+
+		const Vector3 firstViewingDirection = world_T_cameras.front().rotation() * camera.vector(imagePoints.front());
+		const Vector3 lastViewingDirection = world_T_cameras.back().rotation() * camera.vector(imagePoints.back());
+
+		if (firstViewingDirection.angle(lastViewingDirection) < Numeric::deg2rad(Scalar(1.5)))
+		{
+			continue;
+		}
+
+		Vector3 objectPoint;
+
+		validIndices.clear();
+		if (!Geometry::RANSAC::objectPoint(camera, ConstArrayAccessor<HomogenousMatrix4>(world_T_cameras), ConstArrayAccessor<Vector2>(imagePoints), frontEnd.randomGenerator_, objectPoint, 20u, Scalar(3 * 3), 2u, true, Geometry::Estimator::ET_HUBER, nullptr, &validIndices))
+		{
+			continue;
+		}
+
+		if (validIndices.size() + maximalNumberInvalidObservations < imagePoints.size())
+		{
+			continue;
+		}
+
+		const LocalizedObjectPoint::LocalizationPrecision precision = LocalizedObjectPoint::determineLocalizedObjectPointUncertaintyIF(camera, flippedCameras_T_world, objectPoint);
+		ocean_assert(precision != LocalizedObjectPoint::LP_INVALID);
+
+		ocean_assert(!frontEnd.localizedObjectPointMap_.contains(pointPair.first));
+		frontEnd.localizedObjectPointMap_.emplace(pointPair.first, LocalizedObjectPoint(pointTrack, objectPoint, precision, false /*isBundleAdjusted*/));
+
+		localizedObjectPointIds.push_back(pointPair.first);
+	}
+
+	for (const Index32 objectPointId : localizedObjectPointIds)
+	{
+		frontEnd.pointTrackMap_.erase(objectPointId);
+	}
+
+	if constexpr (loggingEnabled_)
+	{
+		if (!localizedObjectPointIds.empty())
+		{
+			Log::info() << "Converted " << localizedObjectPointIds.size() << " point tracks to localized object points";
+		}
+	}
+}
+
+size_t TrackerMulti::triangulateStereoObjectPoints(const Index32 currentFrameIndex, const HomogenousMatrix4& world_T_device, const size_t minimalNumberObjectPoints)
+{
+	ocean_assert(world_T_device.isValid());
+	ocean_assert(minimalNumberObjectPoints >= 1);
+
+	const size_t numberCameras = frontEnds_.size();
+
+	// first, we describe the current observations of all point tracks of all cameras
+
+	std::vector<Indices32> pointIdGroups(numberCameras);
+	std::vector<Vectors2> imagePointGroups(numberCameras);
+	std::vector<CV::Detector::FREAKDescriptors32> descriptorGroups(numberCameras);
+
+	for (size_t nCamera = 0; nCamera < numberCameras; ++nCamera)
+	{
+		const CameraFrontEnd& frontEnd = *frontEnds_[nCamera];
+
+		Indices32& pointIds = pointIdGroups[nCamera];
+		Vectors2& imagePoints = imagePointGroups[nCamera];
+		CV::Detector::FREAKDescriptors32& descriptors = descriptorGroups[nCamera];
+
+		pointIds.reserve(frontEnd.pointTrackMap_.size());
+		imagePoints.reserve(frontEnd.pointTrackMap_.size());
+
+		for (const PointTrackMap::value_type& pointPair : frontEnd.pointTrackMap_)
+		{
+			ocean_assert(pointPair.second.lastFrameIndex() == currentFrameIndex);
+
+			pointIds.push_back(pointPair.first);
+			imagePoints.push_back(pointPair.second.lastImagePoint());
+		}
+
+		if (imagePoints.empty())
+		{
+			continue;
+		}
+
+		descriptors.resize(imagePoints.size());
+		CV::Detector::FREAKDescriptor32::computeDescriptors(frontEnd.camera_, frontEnd.currentPyramid_, imagePoints.data(), imagePoints.size(), 0u /*pyramidLevel*/, descriptors.data());
+
+		// now, let's remove all points with invalid descriptors
+
+		for (size_t nPoint = 0; nPoint < imagePoints.size(); /*noop*/)
+		{
+			if (descriptors[nPoint].isValid())
+			{
+				++nPoint;
+			}
+			else
+			{
+				pointIds[nPoint] = pointIds.back();
+				imagePoints[nPoint] = imagePoints.back();
+				descriptors[nPoint] = descriptors.back();
+
+				pointIds.pop_back();
+				imagePoints.pop_back();
+				descriptors.pop_back();
+			}
+		}
+	}
+
+	/**
+	 * Definition of a stereo triangulated object point.
+	 */
+	struct StereoObjectPoint
+	{
+		/// The index of the first camera.
+		size_t cameraIndex0_ = 0;
+
+		/// The id of the point track in the first camera, which will be the id of the object point in both cameras.
+		Index32 pointId0_ = Index32(-1);
+
+		/// The index of the second camera.
+		size_t cameraIndex1_ = 0;
+
+		/// The id of the point track in the second camera.
+		Index32 pointId1_ = Index32(-1);
+
+		/// The position of the object point.
+		Vector3 position_;
+
+		/// The localization precision of the object point.
+		LocalizedObjectPoint::LocalizationPrecision precision_ = LocalizedObjectPoint::LP_INVALID;
+	};
+
+	std::vector<StereoObjectPoint> stereoObjectPoints;
+
+	// each point track can be used for one stereo pair only
+
+	std::vector<std::vector<uint8_t>> usedPointGroups(numberCameras);
+	for (size_t nCamera = 0; nCamera < numberCameras; ++nCamera)
+	{
+		usedPointGroups[nCamera].resize(pointIdGroups[nCamera].size(), 0u);
+	}
+
+	constexpr unsigned int threshold = descriptorThreshold();
+
+	Indices32 matches0;
+	Indices32 matches1;
+	Vectors2 matchedImagePoints0;
+	Vectors2 matchedImagePoints1;
+	Vectors3 objectPoints;
+	Indices32 validIndices;
+
+	for (size_t nCamera0 = 0; nCamera0 < numberCameras; ++nCamera0)
+	{
+		for (size_t nCamera1 = nCamera0 + 1; nCamera1 < numberCameras; ++nCamera1)
+		{
+			const CV::Detector::FREAKDescriptors32& descriptors0 = descriptorGroups[nCamera0];
+			const CV::Detector::FREAKDescriptors32& descriptors1 = descriptorGroups[nCamera1];
+
+			if (descriptors0.empty() || descriptors1.empty())
+			{
+				continue;
+			}
+
+			// we determine the best matches from the first to the second camera, and accept mutual best matches only
+
+			Indices32 bestMatches1To0(descriptors1.size(), Index32(-1));
+
+			for (size_t n1 = 0; n1 < descriptors1.size(); ++n1)
+			{
+				if (usedPointGroups[nCamera1][n1] != 0u)
+				{
+					continue;
+				}
+
+				unsigned int bestDistance = threshold + 1u;
+
+				for (size_t n0 = 0; n0 < descriptors0.size(); ++n0)
+				{
+					if (usedPointGroups[nCamera0][n0] == 0u)
+					{
+						const unsigned int distance = descriptors1[n1].distance(descriptors0[n0]);
+
+						if (distance < bestDistance)
+						{
+							bestDistance = distance;
+							bestMatches1To0[n1] = Index32(n0);
+						}
+					}
+				}
+			}
+
+			matches0.clear();
+			matches1.clear();
+			matchedImagePoints0.clear();
+			matchedImagePoints1.clear();
+
+			for (size_t n0 = 0; n0 < descriptors0.size(); ++n0)
+			{
+				if (usedPointGroups[nCamera0][n0] != 0u)
+				{
+					continue;
+				}
+
+				unsigned int bestDistance = threshold + 1u;
+				Index32 bestIndex1 = Index32(-1);
+
+				for (size_t n1 = 0; n1 < descriptors1.size(); ++n1)
+				{
+					if (usedPointGroups[nCamera1][n1] == 0u)
+					{
+						const unsigned int distance = descriptors0[n0].distance(descriptors1[n1]);
+
+						if (distance < bestDistance)
+						{
+							bestDistance = distance;
+							bestIndex1 = Index32(n1);
+						}
+					}
+				}
+
+				if (bestIndex1 != Index32(-1) && bestMatches1To0[bestIndex1] == Index32(n0))
+				{
+					matches0.push_back(Index32(n0));
+					matches1.push_back(bestIndex1);
+
+					matchedImagePoints0.push_back(imagePointGroups[nCamera0][n0]);
+					matchedImagePoints1.push_back(imagePointGroups[nCamera1][bestIndex1]);
+				}
+			}
+
+			if (matches0.empty())
+			{
+				continue;
+			}
+
+			const HomogenousMatrix4 world_T_camera0 = world_T_device * device_T_cameras_[nCamera0];
+			const HomogenousMatrix4 world_T_camera1 = world_T_device * device_T_cameras_[nCamera1];
+
+			// the triangulation with a small projection error rejects wrong matches without a valid epipolar geometry
+
+			objectPoints.clear();
+			validIndices.clear();
+			Geometry::Utilities::triangulateObjectPoints(*cameras_[nCamera0], *cameras_[nCamera1], world_T_camera0, world_T_camera1, ConstArrayAccessor<Vector2>(matchedImagePoints0), ConstArrayAccessor<Vector2>(matchedImagePoints1), objectPoints, validIndices, true /*onlyFrontPoints*/, Scalar(2 * 2));
+
+			ocean_assert(objectPoints.size() == validIndices.size());
+
+			for (size_t nValid = 0; nValid < validIndices.size(); ++nValid)
+			{
+				const Index32 validIndex = validIndices[nValid];
+				const Vector3& objectPoint = objectPoints[nValid];
+
+				const Index32 index0 = matches0[validIndex];
+				const Index32 index1 = matches1[validIndex];
+
+				ocean_assert(usedPointGroups[nCamera0][index0] == 0u && usedPointGroups[nCamera1][index1] == 0u);
+
+				usedPointGroups[nCamera0][index0] = 1u;
+				usedPointGroups[nCamera1][index1] = 1u;
+
+				// the precision of the new object point is determined by the angle between both viewing rays
+
+				const Scalar rayAngle = (world_T_camera0.translation() - objectPoint).angle(world_T_camera1.translation() - objectPoint);
+
+				StereoObjectPoint stereoObjectPoint;
+				stereoObjectPoint.cameraIndex0_ = nCamera0;
+				stereoObjectPoint.pointId0_ = pointIdGroups[nCamera0][index0];
+				stereoObjectPoint.cameraIndex1_ = nCamera1;
+				stereoObjectPoint.pointId1_ = pointIdGroups[nCamera1][index1];
+				stereoObjectPoint.position_ = objectPoint;
+				stereoObjectPoint.precision_ = rayAngle >= Numeric::deg2rad(3) ? LocalizedObjectPoint::LP_MEDIUM : LocalizedObjectPoint::LP_LOW;
+
+				stereoObjectPoints.push_back(stereoObjectPoint);
+			}
+		}
+	}
+
+	if (stereoObjectPoints.size() < minimalNumberObjectPoints)
+	{
+		return 0;
+	}
+
+	// the new object points are added to the maps of both cameras with the id of the first camera, the point tracks are not needed anymore
+
+	for (const StereoObjectPoint& stereoObjectPoint : stereoObjectPoints)
+	{
+		CameraFrontEnd& frontEnd0 = *frontEnds_[stereoObjectPoint.cameraIndex0_];
+		CameraFrontEnd& frontEnd1 = *frontEnds_[stereoObjectPoint.cameraIndex1_];
+
+		const PointTrackMap::iterator iPointTrack0 = frontEnd0.pointTrackMap_.find(stereoObjectPoint.pointId0_);
+		const PointTrackMap::iterator iPointTrack1 = frontEnd1.pointTrackMap_.find(stereoObjectPoint.pointId1_);
+
+		ocean_assert(iPointTrack0 != frontEnd0.pointTrackMap_.end() && iPointTrack1 != frontEnd1.pointTrackMap_.end());
+
+		ocean_assert(!frontEnd0.localizedObjectPointMap_.contains(stereoObjectPoint.pointId0_));
+		ocean_assert(!frontEnd1.localizedObjectPointMap_.contains(stereoObjectPoint.pointId0_));
+
+		frontEnd0.localizedObjectPointMap_.emplace(stereoObjectPoint.pointId0_, LocalizedObjectPoint(iPointTrack0->second, stereoObjectPoint.position_, stereoObjectPoint.precision_, false /*isBundleAdjusted*/));
+		frontEnd1.localizedObjectPointMap_.emplace(stereoObjectPoint.pointId0_, LocalizedObjectPoint(iPointTrack1->second, stereoObjectPoint.position_, stereoObjectPoint.precision_, false /*isBundleAdjusted*/));
+
+		frontEnd0.pointTrackMap_.erase(iPointTrack0);
+		frontEnd1.pointTrackMap_.erase(iPointTrack1);
+	}
+
+	if constexpr (loggingEnabled_)
+	{
+		Log::info() << "Triangulated " << stereoObjectPoints.size() << " stereo object points in frame " << currentFrameIndex;
+	}
+
+	return stereoObjectPoints.size();
+}
+
+bool TrackerMulti::bundleAdjustment(const Index32 currentFrameIndex)
+{
+	constexpr size_t maximalNumberKeyFrames = 8;
+	constexpr Index32 keyFrameStride = 5u;
+
+	// the key frames are the current frame and previous frames with valid device pose
+
+	Indices32 keyFrameIndices;
+	keyFrameIndices.reserve(maximalNumberKeyFrames);
+
+	for (Index32 frameIndex = currentFrameIndex; keyFrameIndices.size() < maximalNumberKeyFrames; frameIndex -= keyFrameStride)
+	{
+		if (devicePoses_.hasPose(frameIndex))
+		{
+			keyFrameIndices.push_back(frameIndex);
+		}
+
+		if (frameIndex < keyFrameStride)
+		{
+			break;
+		}
+	}
+
+	if (keyFrameIndices.size() < 2)
+	{
+		return false;
+	}
+
+	const size_t numberCameras = frontEnds_.size();
+
+	// each combination of key frame and camera is one view, the view index is keyFrame * numberCameras + camera
+
+	const size_t numberViews = keyFrameIndices.size() * numberCameras;
+
+	std::vector<const AnyCamera*> viewCameras(numberViews, nullptr);
+	HomogenousMatrices4 flippedCameras_T_world(numberViews);
+
+	for (size_t nKeyFrame = 0; nKeyFrame < keyFrameIndices.size(); ++nKeyFrame)
+	{
+		for (size_t nCamera = 0; nCamera < numberCameras; ++nCamera)
+		{
+			const size_t viewIndex = nKeyFrame * numberCameras + nCamera;
+
+			viewCameras[viewIndex] = cameras_[nCamera].get();
+			flippedCameras_T_world[viewIndex] = frontEnds_[nCamera]->cameraPoses_.flippedCamera_T_world(keyFrameIndices[nKeyFrame]);
+
+			ocean_assert(flippedCameras_T_world[viewIndex].isValid());
+		}
+	}
+
+	// now, we gather the observations of all object points in all views, stereo object points share the same id in several cameras
+
+	std::unordered_map<Index32, size_t> objectPointIdToIndex;
+
+	Indices32 objectPointIds;
+	Vectors3 objectPoints;
+	std::vector<ViewIndexToImagePointPairs> observationGroups;
+
+	for (size_t nCamera = 0; nCamera < numberCameras; ++nCamera)
+	{
+		for (const LocalizedObjectPointMap::value_type& objectPointPair : frontEnds_[nCamera]->localizedObjectPointMap_)
+		{
+			const Index32 objectPointId = objectPointPair.first;
+			const LocalizedObjectPoint& localizedObjectPoint = objectPointPair.second;
+
+			for (size_t nKeyFrame = 0; nKeyFrame < keyFrameIndices.size(); ++nKeyFrame)
+			{
+				Vector2 imagePoint;
+				if (localizedObjectPoint.hasObservation(keyFrameIndices[nKeyFrame], &imagePoint))
+				{
+					const std::unordered_map<Index32, size_t>::const_iterator iObjectPoint = objectPointIdToIndex.emplace(objectPointId, objectPoints.size()).first;
+
+					if (iObjectPoint->second == objectPoints.size())
+					{
+						objectPointIds.push_back(objectPointId);
+						objectPoints.push_back(localizedObjectPoint.position());
+						observationGroups.emplace_back();
+					}
+
+					observationGroups[iObjectPoint->second].emplace_back((unsigned int)(nKeyFrame * numberCameras + nCamera), imagePoint);
+				}
+			}
+		}
+	}
+
+	// we use object points with at least two observations and without large projection errors only
+
+	const Scalar sqrMaximalProjectionError = Numeric::sqr(configuration_.maximalProjectionError_ * Scalar(2));
+
+	Geometry::NonLinearOptimization::ObjectPointToPoseIndexImagePointCorrespondenceAccessor correspondenceGroups;
+
+	for (size_t nObjectPoint = 0; nObjectPoint < objectPoints.size(); /*noop*/)
+	{
+		const ViewIndexToImagePointPairs& observations = observationGroups[nObjectPoint];
+
+		bool useForBundleAdjustment = observations.size() >= 2;
+
+		for (size_t nObservation = 0; useForBundleAdjustment && nObservation < observations.size(); ++nObservation)
+		{
+			const HomogenousMatrix4& flippedCamera_T_world = flippedCameras_T_world[observations[nObservation].first];
+			const AnyCamera& camera = *viewCameras[observations[nObservation].first];
+
+			if (!AnyCamera::isObjectPointInFrontIF(flippedCamera_T_world, objectPoints[nObjectPoint]) || camera.projectToImageIF(flippedCamera_T_world, objectPoints[nObjectPoint]).sqrDistance(observations[nObservation].second) > sqrMaximalProjectionError)
+			{
+				useForBundleAdjustment = false;
+			}
+		}
+
+		if (useForBundleAdjustment)
+		{
+			correspondenceGroups.addObjectPoint(ViewIndexToImagePointPairs(observations));
+
+			++nObjectPoint;
+		}
+		else
+		{
+			objectPointIds[nObjectPoint] = objectPointIds.back();
+			objectPoints[nObjectPoint] = objectPoints.back();
+			observationGroups[nObjectPoint] = std::move(observationGroups.back());
+
+			objectPointIds.pop_back();
+			objectPoints.pop_back();
+			observationGroups.pop_back();
+		}
+	}
+
+	ocean_assert(correspondenceGroups.groups() == objectPoints.size());
+
+	if (objectPoints.size() < 10)
+	{
+		return false;
+	}
+
+	HomogenousMatrices4 optimizedFlippedCameras_T_world(numberViews);
+	Vectors3 optimizedObjectPoints(objectPoints.size());
+
+	NonconstArrayAccessor<HomogenousMatrix4> accessorOptimizedPoses(optimizedFlippedCameras_T_world);
+	NonconstArrayAccessor<Vector3> accessorOptimizedObjectPoints(optimizedObjectPoints);
+
+	Scalar initialError = Numeric::maxValue();
+	Scalar finalError = Numeric::maxValue();
+
+	constexpr bool applyAbsolutePoseAlignment = true;
+
+	if (!Geometry::NonLinearOptimizationObjectPoint::optimizeObjectPointsAndPosesIF(ConstArrayAccessor<const AnyCamera*>(viewCameras), ConstArrayAccessor<HomogenousMatrix4>(flippedCameras_T_world), ConstArrayAccessor<Vector3>(objectPoints), correspondenceGroups, &accessorOptimizedPoses, &accessorOptimizedObjectPoints, 20u, Geometry::Estimator::ET_HUBER, Scalar(0.001), Scalar(5), true /*onlyFrontObjectPoints*/, &initialError, &finalError, nullptr, nullptr, applyAbsolutePoseAlignment, Geometry::NonLinearOptimizationObjectPoint::SS_BLOCK_SPARSE_DIRECT, WorkerPool::get().scopedWorker()()))
+	{
+		Log::warning() << "TrackerMulti: Failed to run Bundle Adjustment";
+		return false;
+	}
+
+	if constexpr (loggingEnabled_)
+	{
+		Log::info() << "Bundle Adjustment with " << keyFrameIndices.size() << " key frames, " << numberViews << " views, and " << objectPoints.size() << " object points: " << initialError << " -> " << finalError;
+	}
+
+	// the optimized object points are updated in all cameras observing the points
+
+	for (size_t nObjectPoint = 0; nObjectPoint < objectPoints.size(); ++nObjectPoint)
+	{
+		for (const std::unique_ptr<CameraFrontEnd>& frontEnd : frontEnds_)
+		{
+			const LocalizedObjectPointMap::iterator iObjectPoint = frontEnd->localizedObjectPointMap_.find(objectPointIds[nObjectPoint]);
+
+			if (iObjectPoint != frontEnd->localizedObjectPointMap_.end())
+			{
+				iObjectPoint->second.setPosition(optimizedObjectPoints[nObjectPoint], true /*isBundleAdjusted*/);
+			}
+		}
+	}
+
+	++mapVersion_;
+
+	// the views have been optimized individually, so we determine rigid device poses for all key frames based on the optimized object points
+
+	std::vector<Geometry::ObjectPointGroups> keyFrameObjectPointGroups(keyFrameIndices.size(), Geometry::ObjectPointGroups(numberCameras));
+	std::vector<Geometry::ImagePointGroups> keyFrameImagePointGroups(keyFrameIndices.size(), Geometry::ImagePointGroups(numberCameras));
+
+	for (size_t nObjectPoint = 0; nObjectPoint < objectPoints.size(); ++nObjectPoint)
+	{
+		for (const ViewIndexToImagePointPair& observation : observationGroups[nObjectPoint])
+		{
+			const size_t nKeyFrame = observation.first / numberCameras;
+			const size_t nCamera = observation.first % numberCameras;
+
+			keyFrameObjectPointGroups[nKeyFrame][nCamera].push_back(optimizedObjectPoints[nObjectPoint]);
+			keyFrameImagePointGroups[nKeyFrame][nCamera].push_back(observation.second);
+		}
+	}
+
+	for (size_t nKeyFrame = 0; nKeyFrame < keyFrameIndices.size(); ++nKeyFrame)
+	{
+		const Index32 keyFrameIndex = keyFrameIndices[nKeyFrame];
+
+		HomogenousMatrix4 world_T_optimizedDevice(false);
+		if (determineDevicePose(cameras_, device_T_cameras_, keyFrameObjectPointGroups[nKeyFrame], keyFrameImagePointGroups[nKeyFrame], devicePoses_.world_T_camera(keyFrameIndex), randomGeneratorBackground_, world_T_optimizedDevice, 10, configuration_.maximalProjectionError_))
+		{
+			setDevicePose(keyFrameIndex, world_T_optimizedDevice, CameraPose::PQ_HIGH);
+		}
+	}
+
+	return true;
+}
+
+void TrackerMulti::resetMap()
+{
+	for (const std::unique_ptr<CameraFrontEnd>& frontEnd : frontEnds_)
+	{
+		// the point tracks are kept so that the map can be initialized again as soon as possible
+
+		frontEnd->localizedObjectPointMap_.clear();
+		frontEnd->outlierObjectPointIds_.clear();
+		frontEnd->cameraPoses_.removePoses();
+	}
+
+	devicePoses_.removePoses();
+
+	++mapVersion_;
+
+	bundleAdjustmentFrameIndex_ = Index32(-1);
+	stereoTriangulationFrameIndex_ = Index32(-1);
+	numberFramesWithoutPose_ = 0u;
+
+	trackerState_ = TS_INITIALIZING;
+}
+
+}
+
+}
+
+}
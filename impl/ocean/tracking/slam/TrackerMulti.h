@@ -0,0 +1,439 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#ifndef META_OCEAN_TRACKING_SLAM_TRACKER_MULTI_H
+#define META_OCEAN_TRACKING_SLAM_TRACKER_MULTI_H
+
+#include "ocean/tracking/slam/SLAM.h"
+#include "ocean/tracking/slam/Tracker.h"
+#include "ocean/tracking/slam/BackgroundTask.h"
+#include "ocean/tracking/slam/CameraPose.h"
+#include "ocean/tracking/slam/CameraPoses.h"
+#include "ocean/tracking/slam/LocalizedObjectPoint.h"
+#include "ocean/tracking/slam/OccupancyArray.h"
+#include "ocean/tracking/slam/PointTrack.h"
+#include "ocean/tracking/slam/PoseCorrespondences.h"
+#include "ocean/tracking/slam/TrackingCorrespondences.h"
+
+#include "ocean/base/Frame.h"
+#include "ocean/base/RandomGenerator.h"
+#include "ocean/base/Worker.h"
+
+#include "ocean/cv/FramePyramid.h"
+
+#include "ocean/cv/detector/FREAKDescriptor.h"
+
+#include "ocean/geometry/Geometry.h"
+
+#include "ocean/math/AnyCamera.h"
+#include "ocean/math/HomogenousMatrix4.h"
+
+namespace Ocean
+{
+
+namespace Tracking
+{
+
+namespace SLAM
+{
+
+/**
+ * This class implements a SLAM tracker for devices with several rigidly mounted cameras (e.g., a stereo camera or a headset with up to four tracking cameras).
+ * The tracker determines the pose of the device, the transformations between the individual cameras and the device need to be known.<br>
+ * Each camera has an own front-end holding the frame pyramids, the 2D point tracks, and the localized 3D object points observed by this camera.<br>
+ * The front-ends are independent of each other so that pyramid creation, frame-to-frame tracking, corner detection, and triangulation are executed concurrently for all cameras.<br>
+ * The front-ends are coupled by a joint 6-DOF device pose which is determined with all 2D/3D correspondences of all cameras, by the initial stereo triangulation, and by a joint Bundle Adjustment.<br>
+ * The map is initialized with known metric scale by triangulating corners which are visible in two cameras with overlapping fields of view, thus at least two cameras are necessary.<br>
+ * Localized object points which cannot be tracked anymore are removed from the map, a re-localization is not yet supported.
+ * @see TrackerMono.
+ * @ingroup trackingslam
+ */
+class OCEAN_TRACKING_SLAM_EXPORT TrackerMulti : public Tracker
+{
+	protected:
+
+		/**
+		 * This class holds all data of the front-end for one camera.
+		 * All frame indices used within a front-end are the frame indices of the tracker, the camera poses of the front-end are the poses of the camera, not of the device.
+		 */
+		class CameraFrontEnd
+		{
+			public:
+
+				/**
+				 * Creates a new front-end for a camera.
+				 * @param cameraIndex The index of the camera, with range [0, numberCameras - 1]
+				 * @param numberCameras The number of cameras of the device, with range [1, infinity)
+				 * @param camera The camera profile of the camera, must be valid
+				 * @param device_T_camera The transformation between camera and device, must be valid
+				 * @param configuration The configuration of the tracker, must be valid
+				 * @param randomGenerator The random generator to be used to initialize the random generator of the front-end
+				 */
+				CameraFrontEnd(const unsigned int cameraIndex, const unsigned int numberCameras, SharedAnyCamera camera, const HomogenousMatrix4& device_T_camera, const Configuration& configuration, RandomGenerator& randomGenerator);
+
+				/**
+				 * Returns a new unique object point id for the point tracks of this front-end.
+				 * The ids are unique across all front-ends of the tracker so that an object point observed by several cameras can share the same id in all front-ends.
+				 * @return The unique id
+				 */
+				inline Index32 uniqueObjectPointId();
+
+			public:
+
+				/// The camera profile of the camera.
+				SharedAnyCamera camera_;
+
+				/// The transformation between camera and device.
+				HomogenousMatrix4 device_T_camera_ = HomogenousMatrix4(false);
+
+				/// The transformation between device and flipped camera.
+				HomogenousMatrix4 flippedCamera_T_device_ = HomogenousMatrix4(false);
+
+				/// The tracking parameters defining the pyramid configuration for feature tracking.
+				TrackingParameters trackingParameters_;
+
+				/// The frame pyramid of the previous frame.
+				CV::FramePyramid previousPyramid_;
+
+				/// The frame pyramid of the current frame.
+				CV::FramePyramid currentPyramid_;
+
+				/// The frame pyramid of the next frame, created while the post-processing of the current frame is still active.
+				CV::FramePyramid nextPyramid_;
+
+				/// Frame-to-frame tracking correspondences.
+				TrackingCorrespondences trackingCorrespondences_;
+
+				/// Pose estimation correspondences.
+				PoseCorrespondences poseCorrespondences_;
+
+				/// The ids of object points that were identified as outliers during the determination of the device pose.
+				Indices32 outlierObjectPointIds_;
+
+				/// The occupancy array for spatial distribution of feature points across the image.
+				OccupancyArray occupancyArray_;
+
+				/// The map of 2D point tracks which are not yet localized.
+				PointTrackMap pointTrackMap_;
+
+				/// The map of localized 3D object points observed by this camera.
+				LocalizedObjectPointMap localizedObjectPointMap_;
+
+				/// The history of camera poses of this camera.
+				CameraPoses cameraPoses_;
+
+				/// The adaptive Harris corner detection threshold.
+				unsigned int harrisThreshold_ = 0u;
+
+				/// The random generator of this front-end.
+				RandomGenerator randomGenerator_;
+
+			protected:
+
+				/// The index of the camera.
+				unsigned int cameraIndex_ = 0u;
+
+				/// The number of cameras of the device.
+				unsigned int numberCameras_ = 0u;
+
+				/// The counter for generating unique object point ids.
+				Index32 objectPointIdCounter_ = 0u;
+		};
+
+		/// Definition of a vector holding camera front-ends.
+		using CameraFrontEnds = std::vector<std::unique_ptr<CameraFrontEnd>>;
+
+		/**
+		 * Definition of a pair combining a view index with an image point.
+		 */
+		using ViewIndexToImagePointPair = std::pair<unsigned int, Vector2>;
+
+		/**
+		 * Definition of a vector holding ViewIndexToImagePointPair objects.
+		 */
+		using ViewIndexToImagePointPairs = std::vector<ViewIndexToImagePointPair>;
+
+	public:
+
+		/**
+		 * Creates a new tracker object.
+		 */
+		TrackerMulti();
+
+		/**
+		 * Destructs this tracker object.
+		 */
+		~TrackerMulti() override;
+
+		/**
+		 * Configures the tracker with the specified settings.
+		 * This function must be called before the first frames are processed.
+		 * @param configuration The configuration object containing all tracker settings, must be valid
+		 * @return True if configuration was successful
+		 */
+		bool configure(const Configuration& configuration);
+
+		/**
+		 * Processes new synchronized camera frames and determines the device pose.
+		 * The camera profiles and the camera transformations must be identical for all calls.
+		 * @param cameras The camera profiles of all cameras, at least two
+		 * @param device_T_cameras The transformations between cameras and device, one for each camera, with default camera pointing towards the negative z-space and y-axis upwards
+		 * @param yFrames The current grayscale frames (FORMAT_Y8), one for each camera, will be moved, must be valid with matching dimensions
+		 * @param world_T_device The resulting device pose transforming device to world coordinates, invalid if the pose could not be determined
+		 * @param worker Optional worker to execute the individual cameras concurrently, nullptr to use the calling thread only
+		 * @return True if the frames were processed successfully; false on error
+		 */
+		bool handleFrames(const SharedAnyCameras& cameras, const HomogenousMatrices4& device_T_cameras, Frames&& yFrames, HomogenousMatrix4& world_T_device, Worker* worker = nullptr);
+
+		/**
+		 * Returns the index of the current frame which the tracker has just processed.
+		 * @return The tracker's current frame index, with range [0, infinity)
+		 */
+		inline Index32 frameIndex() const;
+
+		/**
+		 * Returns the current state of the tracker.
+		 * @return The tracker's state
+		 */
+		inline TrackerState trackerState() const;
+
+		/**
+		 * Determines the 6-DOF pose of a device with several cameras based on 2D/3D correspondences of all cameras.
+		 * In case a rough device pose is not known, a RANSAC-based P3P is applied to the camera with most correspondences first.<br>
+		 * Afterwards, the device pose is optimized with all correspondences of all cameras.
+		 * @param cameras The camera profiles of all cameras, at least one
+		 * @param device_T_cameras The transformations between cameras and device, one for each camera
+		 * @param objectPointGroups The 3D object points, one group for each camera, groups can be empty
+		 * @param imagePointGroups The 2D image points, one group for each camera, one image point for each object point
+		 * @param world_T_roughDevice The rough device pose e.g., from the previous frame, invalid if unknown
+		 * @param randomGenerator The random generator to be used
+		 * @param world_T_device The resulting device pose
+		 * @param minimalNumberCorrespondences The minimal number of valid correspondences across all cameras, with range [5, infinity)
+		 * @param maximalProjectionError The maximal projection error of valid correspondences, in pixel, with range [0, infinity)
+		 * @param usedIndexGroups Optional resulting indices of the valid correspondences, one group for each camera
+		 * @param sqrAccuracy Optional resulting average square projection error of the valid correspondences, in squared pixel
+		 * @return True, if succeeded
+		 */
+		static bool determineDevicePose(const SharedAnyCameras& cameras, const HomogenousMatrices4& device_T_cameras, const Geometry::ObjectPointGroups& objectPointGroups, const Geometry::ImagePointGroups& imagePointGroups, const HomogenousMatrix4& world_T_roughDevice, RandomGenerator& randomGenerator, HomogenousMatrix4& world_T_device, const size_t minimalNumberCorrespondences = 20, const Scalar maximalProjectionError = Scalar(3.5), IndexGroups32* usedIndexGroups = nullptr, Scalar* sqrAccuracy = nullptr);
+
+	protected:
+
+		/**
+		 * Concurrent processing function:
+		 *
+		 * Creates the frame pyramids of the next frames for a subset of the cameras.
+		 * @param yFrames The frames of all cameras, the frames of the subset will be moved, must be valid
+		 * @param firstCamera The index of the first camera to be handled
+		 * @param numberCameras The number of cameras to be handled
+		 */
+		void createPyramidsSubset(Frames* yFrames, const unsigned int firstCamera, const unsigned int numberCameras);
+
+		/**
+		 * Concurrent processing function:
+		 *
+		 * Tracks the image points from the previous frame to the current frame for a subset of the cameras and prepares the pose correspondences.
+		 * @param currentFrameIndex The index of the current frame, with range [0, infinity)
+		 * @param firstCamera The index of the first camera to be handled
+		 * @param numberCameras The number of cameras to be handled
+		 */
+		void trackImagePointsSubset(const Index32 currentFrameIndex, const unsigned int firstCamera, const unsigned int numberCameras);
+
+		/**
+		 * Determines the pose of the device for the current frame based on the pose correspondences of all cameras.
+		 * @param currentFrameIndex The index of the current frame, with range [1, infinity)
+		 * @return The device pose, invalid if the pose could not be determined
+		 */
+		HomogenousMatrix4 determineCurrentDevicePose(const Index32 currentFrameIndex);
+
+		/**
+		 * Sets the pose of the device and the resulting poses of all cameras for a specific frame.
+		 * @param frameIndex The index of the frame, with range [0, infinity)
+		 * @param world_T_device The pose of the device, must be valid
+		 * @param poseQuality The quality of the pose
+		 * @param cameraMotions Optional estimated motions of the individual cameras, one for each camera, nullptr if unknown
+		 */
+		void setDevicePose(const Index32 frameIndex, const HomogenousMatrix4& world_T_device, const CameraPose::PoseQuality poseQuality, const CameraPose::EstimatedMotion* cameraMotions = nullptr);
+
+		/**
+		 * Post-processing function:
+		 *
+		 * Performs the post-processing after the frames have been handled, executed in the background.
+		 * The function updates the individual front-ends concurrently, initializes or extends the map, and executes the Bundle Adjustment.
+		 */
+		void postHandleFrames();
+
+		/**
+		 * Post-processing function:
+		 *
+		 * Updates the point tracks and localized object points, localizes point tracks, and detects new image points for a subset of the cameras.
+		 * @param currentFrameIndex The index of the current frame, with range [0, infinity)
+		 * @param firstCamera The index of the first camera to be handled
+		 * @param numberCameras The number of cameras to be handled
+		 */
+		void postHandleFramesSubset(const Index32 currentFrameIndex, const unsigned int firstCamera, const unsigned int numberCameras);
+
+		/**
+		 * Post-processing function:
+		 *
+		 * Updates the tracking correspondences for the next frame for a subset of the cameras.
+		 * @param currentFrameIndex The index of the current frame, with range [0, infinity)
+		 * @param firstCamera The index of the first camera to be handled
+		 * @param numberCameras The number of cameras to be handled
+		 */
+		void updateCorrespondencesSubset(const Index32 currentFrameIndex, const unsigned int firstCamera, const unsigned int numberCameras);
+
+		/**
+		 * Post-processing function:
+		 *
+		 * Processes the tracking results of one camera by updating point tracks and localized object points with new observations.
+		 * @param frontEnd The front-end of the camera
+		 * @param currentFrameIndex The index of the current frame, with range [0, infinity)
+		 */
+		static void processTrackingResults(CameraFrontEnd& frontEnd, const Index32 currentFrameIndex);
+
+		/**
+		 * Post-processing function:
+		 *
+		 * Detects new Harris corners in empty areas of the current frame of one camera and adds them as new point tracks.
+		 * @param frontEnd The front-end of the camera
+		 * @param currentFrameIndex The index of the current frame, with range [0, infinity)
+		 * @param configuration The configuration of the tracker
+		 * @return True if succeeded
+		 */
+		static bool detectNewImagePoints(CameraFrontEnd& frontEnd, const Index32 currentFrameIndex, const Configuration& configuration);
+
+		/**
+		 * Post-processing function:
+		 *
+		 * Localizes the point tracks of one camera which have been observed in enough frames with known camera poses.
+		 * @param frontEnd The front-end of the camera
+		 * @param currentFrameIndex The index of the current frame, with range [0, infinity)
+		 */
+		static void localizeUnlocalizedObjectPoints(CameraFrontEnd& frontEnd, const Index32 currentFrameIndex);
+
+		/**
+		 * Post-processing function:
+		 *
+		 * Matches the point tracks of all pairs of cameras in the current frame and triangulates the matched points with the known transformation between both cameras.
+		 * The resulting object points have metric scale and are added to the maps of both cameras with the same object point id.
+		 * @param currentFrameIndex The index of the current frame, with range [0, infinity)
+		 * @param world_T_device The pose of the device in the current frame, must be valid
+		 * @param minimalNumberObjectPoints The minimal number of triangulated object points necessary to add the points to the maps, with range [1, infinity)
+		 * @return The number of object points which have been added, 0 if less than 'minimalNumberObjectPoints' object points could be triangulated
+		 */
+		size_t triangulateStereoObjectPoints(const Index32 currentFrameIndex, const HomogenousMatrix4& world_T_device, const size_t minimalNumberObjectPoints);
+
+		/**
+		 * Post-processing function:
+		 *
+		 * Applies a joint Bundle Adjustment for the recent keyframes of all cameras.
+		 * All cameras of all keyframes and all object points visible in at least two keyframes are optimized in one optimization problem.<br>
+		 * Afterwards, the device poses of the keyframes are determined from the optimized object points so that the rig stays rigid.
+		 * @param currentFrameIndex The index of the current frame, with range [0, infinity)
+		 * @return True, if succeeded
+		 */
+		bool bundleAdjustment(const Index32 currentFrameIndex);
+
+		/**
+		 * Resets the map and all front-ends so that the tracker initializes again.
+		 */
+		void resetMap();
+
+		/**
+		 * Returns the maximal distance between two descriptors so that they are considered a match (35% of descriptor size).
+		 * @return The descriptor matching threshold
+		 */
+		static constexpr unsigned int descriptorThreshold();
+
+	protected:
+
+		/// The current operational state of the tracker, modified by the post-processing task, read by the foreground thread after the task has finished.
+		TrackerState trackerState_ = TS_UNKNOWN;
+
+		/// The configuration of the tracker.
+		Configuration configuration_;
+
+		/// The camera profiles of all cameras, identical for all frames.
+		SharedAnyCameras cameras_;
+
+		/// The transformations between cameras and device, one for each camera.
+		HomogenousMatrices4 device_T_cameras_;
+
+		/// The front-ends of all cameras, one for each camera.
+		CameraFrontEnds frontEnds_;
+
+		/// The history of device poses for all processed frames, the poses transform the device to world coordinates.
+		CameraPoses devicePoses_;
+
+		/// The version counter for the map, incremented after each Bundle Adjustment.
+		Index32 mapVersion_ = 0u;
+
+		/// The index of the frame of the most recent Bundle Adjustment, -1 if no Bundle Adjustment has been applied yet.
+		Index32 bundleAdjustmentFrameIndex_ = Index32(-1);
+
+		/// The index of the frame of the most recent stereo triangulation, -1 if no triangulation has been applied yet.
+		Index32 stereoTriangulationFrameIndex_ = Index32(-1);
+
+		/// The number of consecutive frames for which the device pose could not be determined while tracking.
+		unsigned int numberFramesWithoutPose_ = 0u;
+
+		/// The random generator for the foreground thread.
+		RandomGenerator randomGenerator_;
+
+		/// The random generator for the post-processing task.
+		RandomGenerator randomGeneratorBackground_;
+
+		/// The background task which will execute the post processing for the handleFrames() function.
+		BackgroundTask postHandleFramesTask_;
+
+		/// The minimal localization precision for projecting object points; points below this threshold use the previous 2D position instead.
+		static constexpr LocalizedObjectPoint::LocalizationPrecision minimalFrontPrecision_ = LocalizedObjectPoint::LP_LOW;
+
+		/// The number of frames between two Bundle Adjustments, with range [1, infinity).
+		static constexpr Index32 bundleAdjustmentInterval_ = 10u;
+
+		/// The number of frames between two stereo triangulations while tracking, with range [1, infinity).
+		static constexpr Index32 stereoTriangulationInterval_ = 5u;
+
+		/// The minimal number of stereo triangulated object points necessary to initialize the map, with range [1, infinity).
+		static constexpr size_t minimalNumberInitialObjectPoints_ = 30;
+
+		/// The number of consecutive frames without device pose after which the tracker initializes again, with range [1, infinity).
+		static constexpr unsigned int maximalNumberFramesWithoutPose_ = 15u;
+};
+
+inline Index32 TrackerMulti::CameraFrontEnd::uniqueObjectPointId()
+{
+	// the ids of all front-ends are interleaved, no thread-safety necessary as each front-end is handled by one thread at a time
+
+	ocean_assert(numberCameras_ >= 1u && cameraIndex_ < numberCameras_);
+
+	return (++objectPointIdCounter_) * Index32(numberCameras_) + Index32(cameraIndex_);
+}
+
+inline Index32 TrackerMulti::frameIndex() const
+{
+	return devicePoses_.frameIndex();
+}
+
+inline Tracker::TrackerState TrackerMulti::trackerState() const
+{
+	return trackerState_;
+}
+
+constexpr unsigned int TrackerMulti::descriptorThreshold()
+{
+	return CV::Detector::FREAKDescriptor32::descriptorMatchingThreshold(35u);
+}
+
+}
+
+}
+
+}
+
+#endif // META_OCEAN_TRACKING_SLAM_TRACKER_MULTI_H
@@ -44,12 +44,16 @@ void TrackingCorrespondences::update(const Index32 previousFrameIndex, const Ind
 	currentImagePoints_.clear();
 
 	pointIds_.clear();
-	pointIdSet_.clear();
 	validCorrespondences_.clear();
 
 	objectPoints_.clear();
 	objectPointPrecisions_.clear();
 
+	arena_.reset();
+
+	// set of point ids for fast lookup, workaround for separation between localized object points and point tracks
+	ArenaUnorderedSet<Index32> pointIdSet(previousImagePoints_.capacity(), arena_);
+
 	for (const LocalizedObjectPointMap::value_type& objectPointPair : localizedObjectPointMap) // TODO iterate only over visible object points
 	{
 		const Index32& objectPointId = objectPointPair.first;
@@ -65,8 +69,8 @@ void TrackingCorrespondences::update(const Index32 previousFrameIndex, const Ind
 			objectPoints_.push_back(localizedObjectPoint.position());
 			objectPointPrecisions_.push_back(localizedObjectPoint.localizationPrecision());
 
-			ocean_assert(!pointIdSet_.contains(objectPointId));
-			pointIdSet_.insert(objectPointId);
+			ocean_assert(!pointIdSet.contains(objectPointId));
+			pointIdSet.insert(objectPointId);
 		}
 	}
 
@@ -95,7 +99,7 @@ void TrackingCorrespondences::update(const Index32 previousFrameIndex, const Ind
 	{
 		bool reachedEndOfPrecisePoints = false;
 
-		UnorderedIndexSet32 pointIdSet;
+		UnorderedIndexSet32 debugPointIdSet;
 
 		for (size_t n = 0; n < objectPointPrecisions_.size(); ++n)
 		{
@@ -108,11 +112,11 @@ void TrackingCorrespondences::update(const Index32 previousFrameIndex, const Ind
 				reachedEndOfPrecisePoints = true;
 			}
 
-			ocean_assert(!pointIdSet.contains(pointIds_[n]));
-			pointIdSet.insert(pointIds_[n]);
+			ocean_assert(!debugPointIdSet.contains(pointIds_[n]));
+			debugPointIdSet.insert(pointIds_[n]);
 		}
 
-		ocean_assert(pointIdSet_.size() == pointIdSet.size());
+		ocean_assert(pointIdSet.size() == debugPointIdSet.size());
 	}
 #endif // OCEAN_DEBUG
 
@@ -120,7 +124,7 @@ void TrackingCorrespondences::update(const Index32 previousFrameIndex, const Ind
 	{
 		const Index32& objectPointId = pointPair.first;
 
-		if (!pointIdSet_.contains(objectPointId)) // TODO should not be necessary once point tracks and unlocalized are merged
+		if (!pointIdSet.contains(objectPointId)) // TODO should not be necessary once point tracks and unlocalized are merged
 		{
 			const PointTrack& pointTrack = pointPair.second;
 			ocean_assert(pointTrack.isValid());
@@ -225,6 +229,11 @@ void TrackingCorrespondences::trackImagePoints(const Index32 currentFrameIndex,
 
 	validCorrespondences_.resize(previousImagePoints_.size());
 
+	// the pyramids may have been created with less layers than needed for unguided tracking (e.g., when a rotation prior was expected)
+
+	const unsigned int availableLayers = std::min(yPreviousFramePyramid.layers(), yCurrentFramePyramid.layers());
+	ocean_assert(availableLayers >= 1u);
+
 	StaticVector<CV::Advanced::AdvancedMotion::PointCorrespondences, 2> pointCorrespondences;
 
 	constexpr Scalar strongMotionAngle = Numeric::deg2rad(0.5); // TODO move parameter to configuration
@@ -285,7 +294,7 @@ void TrackingCorrespondences::trackImagePoints(const Index32 currentFrameIndex,
 				{
 					// we have at least one precise object point, so we can use the guided tracking approach
 
-					const Tracker::TrackingParameterPair& parameterPair = trackingParameters.parameterPair(world_T_previousCamera, previousCamera_Q_currentCamera, strongMotionAngle);
+					const Tracker::TrackingParameterPair parameterPair = trackingParameters.parameterPair(world_T_previousCamera, previousCamera_Q_currentCamera, strongMotionAngle).limitedLayers(availableLayers);
 
 					ocean_assert(currentImagePoints_.size() <= objectPoints_.size());
 					pointCorrespondences.emplaceBack(previousImagePoints_.data(), currentImagePoints_.data(), validCorrespondences_.data(), currentImagePoints_.size(), parameterPair.layers_, parameterPair.coarsestLayerRadius_, maximalSqrError, subPixelIterations);
@@ -331,7 +340,7 @@ void TrackingCorrespondences::trackImagePoints(const Index32 currentFrameIndex,
 				}
 			}
 
-			const Tracker::TrackingParameterPair& parameterPair = trackingParameters.parameterPair(HomogenousMatrix4(false), previousCamera_Q_currentCamera, strongMotionAngle);
+			const Tracker::TrackingParameterPair parameterPair = trackingParameters.parameterPair(HomogenousMatrix4(false), previousCamera_Q_currentCamera, strongMotionAngle).limitedLayers(availableLayers);
 
 			pointCorrespondences.emplaceBack(previousImagePoints_.data() + imagePointStartIndex, currentImagePoints_.data() + imagePointStartIndex, validCorrespondences_.data() + imagePointStartIndex, remainingImagePoints, parameterPair.layers_, parameterPair.coarsestLayerRadius_, maximalSqrError, subPixelIterations);
 		}
@@ -340,7 +349,7 @@ void TrackingCorrespondences::trackImagePoints(const Index32 currentFrameIndex,
 	{
 		currentImagePoints_.assign(previousImagePoints_.cbegin(), previousImagePoints_.cend());
 
-		const Tracker::TrackingParameterPair& parameterPair = trackingParameters.parameterPair(HomogenousMatrix4(false), Quaternion(false), strongMotionAngle);
+		const Tracker::TrackingParameterPair parameterPair = trackingParameters.parameterPair(HomogenousMatrix4(false), Quaternion(false), strongMotionAngle).limitedLayers(availableLayers);
 
 		pointCorrespondences.emplaceBack(previousImagePoints_.data(), currentImagePoints_.data(), validCorrespondences_.data(), previousImagePoints_.size(), parameterPair.layers_, parameterPair.coarsestLayerRadius_, maximalSqrError, subPixelIterations);
 	}
@@ -349,42 +358,65 @@ void TrackingCorrespondences::trackImagePoints(const Index32 currentFrameIndex,
 	Vectors2 debugCopyCurrentImagePoints(currentImagePoints_);
 #endif
 
-	switch (trackingParameters.patchSize_)
+	if (!trackPoints(yPreviousFramePyramid, yCurrentFramePyramid, trackingParameters.patchSize_, pointCorrespondences.data(), pointCorrespondences.size()))
 	{
-		case 7u:
+		ocean_assert(false && "This should never happen!");
+		return;
+	}
+
+	if (previousCamera_Q_currentCamera.isValid())
+	{
+		// the guided tracking uses small search radii around the predicted locations. the prediction can fail (e.g., due to an inaccurate rotation prior, or a wrong object point),
+		// therefore, we re-track all failed points once more with the unguided parameters starting at their previous locations
+
+		ocean_assert(fallbackIndices_.empty());
+
+		for (size_t n = 0; n < validCorrespondences_.size(); ++n)
 		{
-			if (!CV::Advanced::AdvancedMotionSSD::trackPointsBidirectionalSubPixelMirroredBorder<1u, 7u>(yPreviousFramePyramid, yCurrentFramePyramid, pointCorrespondences.data(), pointCorrespondences.size()))
+			if (!validCorrespondences_[n])
 			{
-				ocean_assert(false && "This should never happen!");
-				return;
+				fallbackIndices_.push_back(Index32(n));
 			}
-
-			break;
 		}
 
-		case 31u:
+		if (!fallbackIndices_.empty())
 		{
-			if (!CV::Advanced::AdvancedMotionSSD::trackPointsBidirectionalSubPixelMirroredBorder<1u, 31u>(yPreviousFramePyramid, yCurrentFramePyramid, pointCorrespondences.data(), pointCorrespondences.size()))
+			fallbackPreviousImagePoints_.clear();
+			fallbackPreviousImagePoints_.reserve(fallbackIndices_.size());
+
+			for (const Index32 index : fallbackIndices_)
 			{
-				ocean_assert(false && "This should never happen!");
-				return;
+				fallbackPreviousImagePoints_.push_back(previousImagePoints_[index]);
 			}
 
-			break;
-		}
+			fallbackCurrentImagePoints_.assign(fallbackPreviousImagePoints_.cbegin(), fallbackPreviousImagePoints_.cend());
+			fallbackValidCorrespondences_.resize(fallbackIndices_.size());
 
-		default:
-		{
-			ocean_assert(trackingParameters.patchSize_ == 15u);
+			const Tracker::TrackingParameterPair parameterPair = trackingParameters.parameterPair(HomogenousMatrix4(false), Quaternion(false), strongMotionAngle).limitedLayers(availableLayers);
+
+			CV::Advanced::AdvancedMotion::PointCorrespondences fallbackCorrespondences(fallbackPreviousImagePoints_.data(), fallbackCurrentImagePoints_.data(), fallbackValidCorrespondences_.data(), fallbackIndices_.size(), parameterPair.layers_, parameterPair.coarsestLayerRadius_, maximalSqrError, subPixelIterations);
 
-			if (!CV::Advanced::AdvancedMotionSSD::trackPointsBidirectionalSubPixelMirroredBorder<1u, 15u>(yPreviousFramePyramid, yCurrentFramePyramid, pointCorrespondences.data(), pointCorrespondences.size()))
+			if (trackPoints(yPreviousFramePyramid, yCurrentFramePyramid, trackingParameters.patchSize_, &fallbackCorrespondences, 1))
 			{
-				ocean_assert(false && "This should never happen!");
-				return;
+				for (size_t n = 0; n < fallbackIndices_.size(); ++n)
+				{
+					if (fallbackValidCorrespondences_[n])
+					{
+						const Index32 index = fallbackIndices_[n];
+
+						currentImagePoints_[index] = fallbackCurrentImagePoints_[n];
+						validCorrespondences_[index] = 1u;
+					}
+				}
 			}
 
-			break;
+			if constexpr (Tracker::loggingEnabled_)
+			{
+				Log::info() << "Frame-to-frame tracking: Re-tracked " << fallbackIndices_.size() << " failed guided points";
+			}
 		}
+
+		fallbackIndices_.clear();
 	}
 
 	ocean_assert(previousImagePoints_.size() == currentImagePoints_.size());
@@ -409,6 +441,27 @@ void TrackingCorrespondences::trackImagePoints(const Index32 currentFrameIndex,
 	}
 }
 
+bool TrackingCorrespondences::trackPoints(const CV::FramePyramid& yPreviousFramePyramid, const CV::FramePyramid& yCurrentFramePyramid, const unsigned int patchSize, CV::Advanced::AdvancedMotion::PointCorrespondences* pointCorrespondences, const size_t numberPointCorrespondences)
+{
+	ocean_assert(pointCorrespondences != nullptr || numberPointCorrespondences == 0);
+
+	switch (patchSize)
+	{
+		case 7u:
+			return CV::Advanced::AdvancedMotionSSD::trackPointsBidirectionalSubPixelMirroredBorder<1u, 7u>(yPreviousFramePyramid, yCurrentFramePyramid, pointCorrespondences, numberPointCorrespondences);
+
+		case 31u:
+			return CV::Advanced::AdvancedMotionSSD::trackPointsBidirectionalSubPixelMirroredBorder<1u, 31u>(yPreviousFramePyramid, yCurrentFramePyramid, pointCorrespondences, numberPointCorrespondences);
+
+		default:
+			break;
+	}
+
+	ocean_assert(patchSize == 15u);
+
+	return CV::Advanced::AdvancedMotionSSD::trackPointsBidirectionalSubPixelMirroredBorder<1u, 15u>(yPreviousFramePyramid, yCurrentFramePyramid, pointCorrespondences, numberPointCorrespondences);
+}
+
 }
 
 }
@@ -13,8 +13,12 @@
 #include "ocean/tracking/slam/PointTrack.h"
 #include "ocean/tracking/slam/Tracker.h"
 
+#include "ocean/base/Arena.h"
+
 #include "ocean/cv/FramePyramid.h"
 
+#include "ocean/cv/advanced/AdvancedMotion.h"
+
 #include "ocean/geometry/Estimator.h"
 #include "ocean/geometry/GravityConstraints.h"
 
@@ -153,6 +157,19 @@ class OCEAN_TRACKING_SLAM_EXPORT TrackingCorrespondences
 		 */
 		inline bool isEmpty() const;
 
+	protected:
+
+		/**
+		 * Tracks groups of point correspondences bidirectionally between two frame pyramids.
+		 * @param yPreviousFramePyramid The frame pyramid of the previous frame, must be valid
+		 * @param yCurrentFramePyramid The frame pyramid of the current frame, must be valid
+		 * @param patchSize The size of the image patches to be used, possible values are {7, 15, 31}
+		 * @param pointCorrespondences The groups of point correspondences to track, must be valid
+		 * @param numberPointCorrespondences The number of given groups, with range [1, infinity)
+		 * @return True, if succeeded
+		 */
+		static bool trackPoints(const CV::FramePyramid& yPreviousFramePyramid, const CV::FramePyramid& yCurrentFramePyramid, const unsigned int patchSize, CV::Advanced::AdvancedMotion::PointCorrespondences* pointCorrespondences, const size_t numberPointCorrespondences);
+
 	protected:
 
 		/// The index of the previous frame.
@@ -170,9 +187,6 @@ class OCEAN_TRACKING_SLAM_EXPORT TrackingCorrespondences
 		/// The unique IDs of the points, one for each previous image point.
 		Indices32 pointIds_;
 
-		/// Set of point ids for fast lookup, workaround for separation between localized object points and point tracks.
-		UnorderedIndexSet32 pointIdSet_;
-
 		/// Flags indicating which correspondences are valid after tracking.
 		ValidCorrespondences validCorrespondences_;
 
@@ -182,6 +196,21 @@ class OCEAN_TRACKING_SLAM_EXPORT TrackingCorrespondences
 		/// The localization precisions for localized correspondences.
 		LocalizedObjectPoint::LocalizationPrecisions objectPointPrecisions_;
 
+		/// The indices of correspondences which failed the guided tracking and are re-tracked unguided, reused to avoid memory allocations.
+		Indices32 fallbackIndices_;
+
+		/// The previous image points of the correspondences to re-track, reused to avoid memory allocations.
+		Vectors2 fallbackPreviousImagePoints_;
+
+		/// The current image points of the correspondences to re-track, reused to avoid memory allocations.
+		Vectors2 fallbackCurrentImagePoints_;
+
+		/// The valid flags of the correspondences to re-track, reused to avoid memory allocations.
+		ValidCorrespondences fallbackValidCorrespondences_;
+
+		/// The arena for temporary containers which are needed during one update, reset with each update to avoid memory allocations.
+		Arena arena_;
+
 		// TODO add whether object point has descriptor (to ensure that we can switch from TS_INITIALIZING to TS_TRACKING)
 };
 